@@ -0,0 +1,12 @@
+#pragma once
+
+// Headless CPU benchmarks of geGL.
+// OpenGL is replaced by function table that only counts calls
+// (or by emulated OpenGL of NullLoader in the headless benchmark),
+// so the benchmarks measure geGL overhead and number of issued GL calls.
+// Each benchmark prints its results to standard output.
+
+void uniformBenchmark();
+void profilingBenchmark();
+void replayBenchmark();
+void headlessBenchmark();
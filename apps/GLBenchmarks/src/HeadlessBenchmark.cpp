@@ -0,0 +1,75 @@
+#include "Benchmarks.h"
+#include <geGL/geGL.h>
+#include <geGL/NullLoader.h>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+using namespace ge::gl;
+
+namespace {
+
+const unsigned numIterations = 10000;
+
+template<typename F>
+void measure(const char *label,F const&f) {
+  auto t1 = std::chrono::high_resolution_clock::now();
+  for(unsigned i=0; i<numIterations; i++)
+    f(i);
+  auto t2 = std::chrono::high_resolution_clock::now();
+  std::cout << std::left << std::setw(24) << label << std::right
+            << std::fixed << std::setprecision(1)
+            << std::setw(10) << std::chrono::duration<double,std::nano>(t2-t1).count()/double(numIterations)
+            << " ns/iteration" << std::endl;
+}
+
+}
+
+// Whole geGL objects on top of emulated OpenGL (NullLoader).
+// Unlike other benchmarks, buffers, vertex arrays and programs really exist,
+// so the measured time includes emulation of OpenGL objects in host memory.
+void headlessBenchmark() {
+  auto loader = std::make_shared<NullLoader>();
+  ge::gl::init(loader);
+
+  std::vector<float> data(1024,1.f);
+  measure("buffer create+delete",[&](unsigned) {
+    Buffer buffer(data.size()*sizeof(float),data.data());
+  });
+
+  Buffer buffer(data.size()*sizeof(float),data.data(),GL_DYNAMIC_DRAW);
+  measure("buffer setData 4KiB",[&](unsigned) {
+    buffer.setData(data.data());
+  });
+  measure("buffer map+unmap",[&](unsigned i) {
+    static_cast<float*>(buffer.map(GL_MAP_WRITE_BIT))[i%data.size()] = 2.f;
+    buffer.unmap();
+  });
+
+  auto vbo = std::make_shared<Buffer>(data.size()*sizeof(float),data.data());
+  measure("vertex array 2 attribs",[&](unsigned) {
+    auto vao = std::make_shared<VertexArray>();
+    vao->addAttrib(vbo,0,3,GL_FLOAT,sizeof(float)*5);
+    vao->addAttrib(vbo,1,2,GL_FLOAT,sizeof(float)*5,sizeof(float)*3);
+  });
+
+  auto vs = std::make_shared<Shader>(GL_VERTEX_SHADER,Shader::Sources{
+      "#version 450\n"
+      "layout(location=0)in vec3 position;\n"
+      "uniform mat4 mvp;\n"
+      "uniform vec4 color;\n"
+      "uniform vec4 lights[4];\n"
+      "void main(){gl_Position=mvp*vec4(position,1);}\n"});
+  measure("program link",[&](unsigned) {
+    Program program(vs);
+  });
+
+  Program program(vs);
+  measure("program set4f",[&](unsigned i) {
+    program.set4f("color",float(i),0.f,0.f,1.f);
+  });
+
+  std::cout << "living objects: " << loader->getNofObjects() << std::endl;
+}
@@ -0,0 +1,89 @@
+#include "Benchmarks.h"
+#include <geGL/LoaderTableDecorator.h>
+#include <geGL/ProfilingTableDecorator.h>
+#include <chrono>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+using namespace ge::gl;
+
+namespace {
+
+size_t numCalls = 0;
+
+void fakeBindBuffer(GLenum,GLuint) { numCalls++; }
+void fakeDrawArrays(GLenum,GLint,GLsizei) { numCalls++; }
+
+class FakeLoader : public FunctionLoaderInterface {
+public:
+  virtual FUNCTION_POINTER load(char const *fceName) const override {
+    if(strcmp(fceName,"glBindBuffer")==0) return reinterpret_cast<FUNCTION_POINTER>(fakeBindBuffer);
+    if(strcmp(fceName,"glDrawArrays")==0) return reinterpret_cast<FUNCTION_POINTER>(fakeDrawArrays);
+    return nullptr;
+  }
+};
+
+const unsigned numFrames = 100;
+const unsigned callsPerFrame = 20000;
+
+// Issues frames of bind+draw pairs and returns time per GL call in ns.
+template<typename Table>
+double run(const Table &table,FunctionProfiler *profiler) {
+  numCalls = 0;
+  auto t1 = std::chrono::high_resolution_clock::now();
+  for(unsigned f=0; f<numFrames; f++) {
+    if(profiler) profiler->beginFrame();
+    for(unsigned i=0; i<callsPerFrame/2; i++) {
+      table.glBindBuffer(GL_ARRAY_BUFFER,i);
+      table.glDrawArrays(GL_TRIANGLES,0,3);
+    }
+    if(profiler) profiler->endFrame();
+  }
+  auto t2 = std::chrono::high_resolution_clock::now();
+  return std::chrono::duration<double,std::nano>(t2-t1).count()/double(numCalls);
+}
+
+void print(const char *label,double ns,double baseNs) {
+  std::cout << std::left << std::setw(20) << label << std::right
+            << std::fixed << std::setprecision(1)
+            << std::setw(8) << ns << " ns/call  (+"
+            << ns-baseNs << " ns)" << std::endl;
+}
+
+}
+
+void profilingBenchmark() {
+  auto loader = std::make_shared<FakeLoader>();
+  LoaderTableDecorator<FunctionTable> plain(loader);
+  plain.construct();
+  ProfilingTableDecorator<LoaderTableDecorator<FunctionTable>> profiled(loader);
+  profiled.construct();
+
+  std::cout << numFrames << " frames, " << callsPerFrame << " calls per frame" << std::endl;
+  double base = run(plain,nullptr);
+  print("no profiling",base,base);
+
+  profiled.profiler.setTimingEnabled(false);
+  print("call counts",run(profiled,&profiled.profiler),base);
+
+  profiled.profiler.setTimingEnabled(true);
+  profiled.profiler.setTimingPeriod(16);
+  print("timing 1/16 calls",run(profiled,&profiled.profiler),base);
+
+  profiled.profiler.setTimingPeriod(1);
+  print("timing",run(profiled,&profiled.profiler),base);
+
+  profiled.profiler.setTracingEnabled(true,numFrames*callsPerFrame);
+  print("timing + trace",run(profiled,&profiled.profiler),base);
+
+  std::ostringstream trace;
+  auto t1 = std::chrono::high_resolution_clock::now();
+  profiled.profiler.writeChromeTrace(trace);
+  auto t2 = std::chrono::high_resolution_clock::now();
+  std::cout << "Chrome trace export: " << profiled.profiler.getTrace().size() << " events, "
+            << trace.str().size()/1024 << " KiB, "
+            << std::chrono::duration<double,std::milli>(t2-t1).count() << " ms" << std::endl;
+  profiled.profiler.writeJSON(std::cout);
+}
@@ -0,0 +1,93 @@
+#include "Benchmarks.h"
+#include <geGL/LoaderTableDecorator.h>
+#include <geGL/RecordingTableDecorator.h>
+#include <geGL/CallReplayer.h>
+#include <chrono>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+using namespace ge::gl;
+
+namespace {
+
+size_t numCalls = 0;
+
+void fakeBindBuffer(GLenum,GLuint) { numCalls++; }
+void fakeDrawArrays(GLenum,GLint,GLsizei) { numCalls++; }
+void fakeUniform4fv(GLint,GLsizei,const GLfloat*) { numCalls++; }
+
+class FakeLoader : public FunctionLoaderInterface {
+public:
+  virtual FUNCTION_POINTER load(char const *fceName) const override {
+    if(strcmp(fceName,"glBindBuffer")==0) return reinterpret_cast<FUNCTION_POINTER>(fakeBindBuffer);
+    if(strcmp(fceName,"glDrawArrays")==0) return reinterpret_cast<FUNCTION_POINTER>(fakeDrawArrays);
+    if(strcmp(fceName,"glUniform4fv")==0) return reinterpret_cast<FUNCTION_POINTER>(fakeUniform4fv);
+    return nullptr;
+  }
+};
+
+const unsigned numFrames = 100;
+const unsigned drawsPerFrame = 5000;
+
+// Issues frames of bind+uniform+draw triples and returns time per GL call in ns.
+template<typename Table>
+double run(const Table &table,CallRecorder *recorder) {
+  GLfloat color[4] = { 1.f, 0.f, 0.f, 1.f };
+  numCalls = 0;
+  auto t1 = std::chrono::high_resolution_clock::now();
+  for(unsigned f=0; f<numFrames; f++) {
+    for(unsigned i=0; i<drawsPerFrame; i++) {
+      table.glBindBuffer(GL_ARRAY_BUFFER,i);
+      table.glUniform4fv(0,1,color);
+      table.glDrawArrays(GL_TRIANGLES,0,3);
+    }
+    if(recorder) recorder->endFrame();
+  }
+  auto t2 = std::chrono::high_resolution_clock::now();
+  return std::chrono::duration<double,std::nano>(t2-t1).count()/double(numCalls);
+}
+
+void print(const char *label,double ns) {
+  std::cout << std::left << std::setw(20) << label << std::right
+            << std::fixed << std::setprecision(1)
+            << std::setw(8) << ns << " ns/call" << std::endl;
+}
+
+}
+
+void replayBenchmark() {
+  auto loader = std::make_shared<FakeLoader>();
+  LoaderTableDecorator<FunctionTable> plain(loader);
+  plain.construct();
+  RecordingTableDecorator<LoaderTableDecorator<FunctionTable>> recording(loader);
+  recording.construct();
+
+  std::cout << numFrames << " frames, " << drawsPerFrame*3 << " calls per frame" << std::endl;
+  print("direct calls",run(plain,nullptr));
+  print("recording",run(recording,&recording.recorder));
+  recording.recorder.clear();
+  print("recording again",run(recording,&recording.recorder));
+
+  std::stringstream stream;
+  recording.recorder.save(stream);
+  std::cout << "stream: " << stream.str().size()/1024 << " KiB, "
+            << double(recording.recorder.getSize())/double(recording.recorder.getNofCalls())
+            << " bytes/call" << std::endl;
+
+  auto table = std::make_shared<LoaderTableDecorator<FunctionTable>>(loader);
+  table->construct();
+  CallReplayer replayer(table);
+  if(!replayer.load(stream)) {
+    std::cout << "stream was not loaded" << std::endl;
+    return;
+  }
+  numCalls = 0;
+  auto t1 = std::chrono::high_resolution_clock::now();
+  while(replayer.replayFrame());
+  auto t2 = std::chrono::high_resolution_clock::now();
+  print("replay",std::chrono::duration<double,std::nano>(t2-t1).count()/double(numCalls));
+  std::cout << "replayed " << replayer.getNofReplayedFrames() << " frames, "
+            << replayer.getNofReplayedCalls() << " calls" << std::endl;
+}
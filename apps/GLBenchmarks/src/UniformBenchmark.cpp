@@ -0,0 +1,169 @@
+#include "Benchmarks.h"
+#include <geGL/geGL.h>
+#include <geGL/LoaderTableDecorator.h>
+#include <chrono>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+using namespace ge::gl;
+
+namespace {
+
+// Active uniforms of the fake program.
+struct FakeUniform {
+  const char *name;
+  GLenum type;
+  GLint size;
+};
+
+const FakeUniform fakeUniforms[] = {
+  { "mvp",       GL_FLOAT_MAT4, 1 },
+  { "color",     GL_FLOAT_VEC4, 1 },
+  { "lightPos",  GL_FLOAT_VEC3, 1 },
+  { "lights[0]", GL_FLOAT_VEC4, 4 },
+  { "twoSided",  GL_INT,        1 },
+};
+const GLint numFakeUniforms = GLint(sizeof(fakeUniforms)/sizeof(fakeUniforms[0]));
+
+// Number of glProgramUniform* calls issued through the fake function table.
+size_t numUniformCalls = 0;
+
+GLuint fakeCreateProgram() { return 1; }
+void fakeLinkProgram(GLuint) {}
+void fakeDeleteProgram(GLuint) {}
+
+void fakeGetProgramiv(GLuint,GLenum pname,GLint *params) {
+  switch(pname) {
+    case GL_LINK_STATUS: *params = GL_TRUE; break;
+    case GL_ACTIVE_UNIFORMS: *params = numFakeUniforms; break;
+    case GL_ACTIVE_UNIFORM_MAX_LENGTH: *params = 32; break;
+    default: *params = 0;
+  }
+}
+
+void fakeGetActiveUniform(GLuint,GLuint index,GLsizei bufSize,GLsizei *length,GLint *size,GLenum *type,GLchar *name) {
+  const FakeUniform &u = fakeUniforms[index];
+  strncpy(name,u.name,size_t(bufSize));
+  *length = GLsizei(strlen(name));
+  *size = u.size;
+  *type = u.type;
+}
+
+// location is index of uniform multiplied by 16 plus array index
+GLint fakeGetUniformLocation(GLuint,const GLchar *name) {
+  std::string n(name);
+  GLint element = 0;
+  size_t bracket = n.find('[');
+  if(bracket!=std::string::npos) {
+    element = GLint(std::stoi(n.substr(bracket+1)));
+    n = n.substr(0,bracket);
+  }
+  for(GLint i=0; i<numFakeUniforms; i++) {
+    std::string u(fakeUniforms[i].name);
+    if(u.substr(0,u.find('['))==n)
+      return i*16+element;
+  }
+  return -1;
+}
+
+void fakeGetProgramInterfaceiv(GLuint,GLenum,GLenum,GLint *params) { *params = 0; }
+
+void fakeProgramUniform1i(GLuint,GLint,GLint) { numUniformCalls++; }
+void fakeProgramUniform3f(GLuint,GLint,GLfloat,GLfloat,GLfloat) { numUniformCalls++; }
+void fakeProgramUniform4f(GLuint,GLint,GLfloat,GLfloat,GLfloat,GLfloat) { numUniformCalls++; }
+void fakeProgramUniform4fv(GLuint,GLint,GLsizei,const GLfloat*) { numUniformCalls++; }
+void fakeProgramUniformMatrix4fv(GLuint,GLint,GLsizei,GLboolean,const GLfloat*) { numUniformCalls++; }
+
+// Loader that provides only functions used by Program,
+// all other functions stay nullptr.
+class CountingLoader : public FunctionLoaderInterface {
+public:
+  CountingLoader() {
+    add("glCreateProgram",fakeCreateProgram);
+    add("glLinkProgram",fakeLinkProgram);
+    add("glDeleteProgram",fakeDeleteProgram);
+    add("glGetProgramiv",fakeGetProgramiv);
+    add("glGetActiveUniform",fakeGetActiveUniform);
+    add("glGetUniformLocation",fakeGetUniformLocation);
+    add("glGetProgramInterfaceiv",fakeGetProgramInterfaceiv);
+    add("glProgramUniform1i",fakeProgramUniform1i);
+    add("glProgramUniform3f",fakeProgramUniform3f);
+    add("glProgramUniform4f",fakeProgramUniform4f);
+    add("glProgramUniform4fv",fakeProgramUniform4fv);
+    add("glProgramUniformMatrix4fv",fakeProgramUniformMatrix4fv);
+  }
+  virtual FUNCTION_POINTER load(char const *fceName) const override {
+    auto it = functions.find(fceName);
+    return it!=functions.end() ? it->second : nullptr;
+  }
+protected:
+  template<typename F>
+  void add(const char *name,F f) { functions[name] = reinterpret_cast<FUNCTION_POINTER>(f); }
+  std::map<std::string,FUNCTION_POINTER> functions;
+};
+
+// Scene of objects sorted by material: model-view-projection matrix
+// changes for each object, color changes only between materials,
+// light setup and twoSided flag are the same for the whole frame.
+const unsigned numObjects = 10000;
+const unsigned objectsPerMaterial = 50;
+const unsigned numFrames = 20;
+const unsigned setsPerObject = 4;
+
+enum class Mode { Name, NameCached, HandleCached };
+
+void run(const std::shared_ptr<Program> &program,Mode mode,const char *label) {
+  program->setUniformCaching(mode!=Mode::Name);
+  UniformHandle mvp = program->getUniformHandle("mvp");
+  UniformHandle color = program->getUniformHandle("color");
+  UniformHandle lightPos = program->getUniformHandle("lightPos");
+  UniformHandle twoSided = program->getUniformHandle("twoSided");
+  float matrix[16] = { 1,0,0,0, 0,1,0,0, 0,0,1,0, 0,0,0,1 };
+
+  numUniformCalls = 0;
+  auto t1 = std::chrono::high_resolution_clock::now();
+  for(unsigned f=0; f<numFrames; f++)
+    for(unsigned i=0; i<numObjects; i++) {
+      matrix[12] = float(i);
+      float c = float(i/objectsPerMaterial);
+      if(mode==Mode::HandleCached) {
+        program->setMatrix4fv(mvp,matrix);
+        program->set4f(color,c,c,c,1.f);
+        program->set3f(lightPos,0.f,10.f,0.f);
+        program->set1i(twoSided,1);
+      } else {
+        program->setMatrix4fv("mvp",matrix);
+        program->set4f("color",c,c,c,1.f);
+        program->set3f("lightPos",0.f,10.f,0.f);
+        program->set1i("twoSided",1);
+      }
+    }
+  auto t2 = std::chrono::high_resolution_clock::now();
+
+  double numSets = double(numFrames)*numObjects*setsPerObject;
+  double ns = std::chrono::duration<double,std::nano>(t2-t1).count();
+  std::cout << std::left << std::setw(16) << label << std::right
+            << std::fixed << std::setprecision(1)
+            << std::setw(8) << ns/numSets << " ns/set   "
+            << std::setw(10) << numUniformCalls << " GL calls ("
+            << std::setprecision(2) << double(numUniformCalls)/numSets << " per set)" << std::endl;
+}
+
+}
+
+void uniformBenchmark() {
+  auto table = std::make_shared<LoaderTableDecorator<FunctionTable>>(std::make_shared<CountingLoader>());
+  table->construct();
+  auto program = std::make_shared<Program>(FunctionTablePointer(table));
+  program->link();
+
+  std::cout << numObjects << " objects, " << numFrames << " frames, "
+            << setsPerObject << " uniforms per object" << std::endl;
+  run(program,Mode::Name,"name");
+  run(program,Mode::NameCached,"name, cached");
+  run(program,Mode::HandleCached,"handle, cached");
+}
@@ -0,0 +1,34 @@
+#include "Benchmarks.h"
+#include <cstring>
+#include <iostream>
+
+struct Benchmark {
+  const char *name;
+  void (*func)();
+};
+
+static const Benchmark benchmarks[] = {
+  { "uniforms", uniformBenchmark },
+  { "profiling", profilingBenchmark },
+  { "replay", replayBenchmark },
+  { "headless", headlessBenchmark },
+};
+
+int main(int argc, char *argv[]) {
+  bool found = false;
+  for(auto &b : benchmarks) {
+    if(argc>1 && strcmp(argv[1],b.name)!=0)
+      continue;
+    std::cout << "=== " << b.name << " ===" << std::endl;
+    b.func();
+    found = true;
+  }
+  if(!found) {
+    std::cout << "Usage: " << argv[0] << " [benchmark]\nBenchmarks:";
+    for(auto &b : benchmarks)
+      std::cout << " " << b.name;
+    std::cout << std::endl;
+    return 1;
+  }
+  return 0;
+}
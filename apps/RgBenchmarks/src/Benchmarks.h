@@ -0,0 +1,9 @@
+#pragma once
+
+// Headless CPU benchmarks of geRG internals.
+// Each benchmark prints its results to standard output.
+
+void compactionBenchmark();
+void transformationBenchmark();
+void flattenedGraphBenchmark();
+void drawCommandBenchmark();
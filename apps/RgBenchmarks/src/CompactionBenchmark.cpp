@@ -0,0 +1,80 @@
+#include "Benchmarks.h"
+#include <geRG/AllocationManagers.h>
+#include <chrono>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace ge::rg;
+
+namespace {
+
+struct Owner {};
+
+// Simulates AttribStorage vertex buffer in host memory: meshes are loaded
+// and unloaded until the buffer is fragmented, then compaction runs
+// with the given per-frame budget. Memory reclaimed at the end of the buffer
+// is reported against the number of copied bytes and the copy time.
+void run(unsigned budgetBytes) {
+  const unsigned vertexSize = 32;
+  const unsigned capacity = 1024*1024;
+  ArrayAllocationManager<Owner> m(capacity,1);
+  std::vector<uint8_t> buffer(size_t(capacity)*vertexSize);
+  std::vector<unsigned> ids;
+  Owner o;
+
+  // fill and churn
+  std::mt19937 rnd(1);
+  std::uniform_int_distribution<unsigned> sizeDist(64,4096);
+  while(true) {
+    unsigned id = m.alloc(sizeDist(rnd),o);
+    if(id==0)
+      break;
+    ids.push_back(id);
+  }
+  for(unsigned i=0; i<ids.size(); )
+    if(rnd()%2) {
+      m.free(ids[i]);
+      ids[i] = ids.back();  // the swapped element is tested in the next iteration
+      ids.pop_back();
+    }
+    else
+      i++;
+
+  unsigned endBefore = m.numItemsAvailableAtTheEnd();
+  float fragmentationBefore = m.fragmentation();
+
+  // compact frame by frame
+  unsigned frames = 0;
+  size_t copiedBytes = 0;
+  auto t1 = std::chrono::high_resolution_clock::now();
+  while(m.numFreeBlocks()>0) {
+    unsigned n = m.compact(budgetBytes/vertexSize,
+        [&buffer](unsigned src,unsigned dst,unsigned num) {
+          memmove(&buffer[size_t(dst)*vertexSize],&buffer[size_t(src)*vertexSize],size_t(num)*vertexSize);
+        },
+        [](unsigned,unsigned) {});
+    copiedBytes += size_t(n)*vertexSize;
+    frames++;
+  }
+  auto t2 = std::chrono::high_resolution_clock::now();
+  double ms = std::chrono::duration<double,std::milli>(t2-t1).count();
+
+  size_t reclaimedBytes = size_t(m.numItemsAvailableAtTheEnd()-endBefore)*vertexSize;
+  std::cout << std::setw(8) << budgetBytes/1024 << " KiB/frame: "
+            << "fragmentation " << std::setprecision(3) << fragmentationBefore << " -> " << m.fragmentation()
+            << ", reclaimed " << reclaimedBytes/1024 << " KiB"
+            << ", copied " << copiedBytes/1024 << " KiB"
+            << " in " << frames << " frames"
+            << ", " << std::setprecision(4) << ms << " ms total"
+            << ", " << ms/frames << " ms/frame" << std::endl;
+}
+
+}
+
+void compactionBenchmark() {
+  for(unsigned budget : { 64*1024u, 256*1024u, 1024*1024u, 4*1024*1024u })
+    run(budget);
+}
@@ -0,0 +1,85 @@
+#include "Benchmarks.h"
+#include <geRG/DrawCommandProcessor.h>
+#include <geCore/ThreadPool.h>
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace ge::rg;
+
+// Expands one million draw commands referencing random primitives,
+// matrix lists and StateSets into draw indirect buffer by DrawCommandProcessor,
+// single-threaded and by ThreadPool of increasing size.
+void drawCommandBenchmark() {
+  const unsigned numDrawCommands = 1000000;
+  const unsigned numPrimitives = 10000;
+  const unsigned numMatrixLists = 10000;
+  const unsigned numStateSets = 64;
+  std::mt19937 rnd(1);
+
+  std::vector<unsigned> primitives(numPrimitives*3);
+  for(unsigned i=1; i<numPrimitives; i++) {
+    primitives[i*3+0] = (rnd()%2 ? 0x80000000 : 0) | unsigned(3+rnd()%3000);
+    primitives[i*3+1] = unsigned(rnd()%1000);
+    primitives[i*3+2] = unsigned(rnd()%100000);
+  }
+  std::vector<unsigned> matrixListControl(numMatrixLists*2);
+  for(unsigned i=1; i<numMatrixLists; i++) {
+    matrixListControl[i*2+0] = unsigned(rnd()%100000);
+    matrixListControl[i*2+1] = unsigned(1+rnd()%16);
+  }
+  std::vector<unsigned> drawCommands(numDrawCommands*3);
+  std::vector<unsigned> sizes(numStateSets,0);
+  for(unsigned i=1; i<numDrawCommands; i++) {
+    unsigned p = 1+unsigned(rnd()%(numPrimitives-1));
+    unsigned s = 1+unsigned(rnd()%(numStateSets-1));
+    drawCommands[i*3+0] = p*3;
+    drawCommands[i*3+1] = (1+unsigned(rnd()%(numMatrixLists-1)))*2;
+    drawCommands[i*3+2] = s;
+    sizes[s] += DrawCommandProcessor::recordSize(primitives[p*3]);
+  }
+  std::vector<unsigned> initialStateSets(numStateSets,0);
+  unsigned position = 4;
+  for(unsigned s=1; s<numStateSets; s++) {
+    initialStateSets[s] = position;
+    position += sizes[s];
+  }
+  std::vector<unsigned> drawIndirect(position);
+  std::vector<unsigned> stateSets;
+  DrawCommandProcessor::Buffers b{primitives.data(),drawCommands.data(),matrixListControl.data(),
+                                  drawIndirect.data(),nullptr,numStateSets,nullptr,nullptr,nullptr,0,nullptr,nullptr};
+
+  const unsigned repeats = 10;
+  DrawCommandProcessor processor;
+  auto run = [&](ge::core::ThreadPool *pool) {
+    auto t1 = std::chrono::high_resolution_clock::now();
+    for(unsigned i=0; i<repeats; i++) {
+      stateSets = initialStateSets;
+      b.stateSetBuffer = stateSets.data();
+      processor.process(b,numDrawCommands,pool);
+    }
+    auto t2 = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double,std::milli>(t2-t1).count()/repeats;
+  };
+
+  std::cout << "draw commands: " << numDrawCommands << std::endl;
+  double serialTime = run(nullptr);
+  std::vector<unsigned> reference = drawIndirect;
+  std::cout << std::fixed << std::setprecision(2)
+            << "single-threaded: " << serialTime << " ms" << std::endl;
+
+  unsigned maxThreads = std::max(std::thread::hardware_concurrency(),1u);
+  for(unsigned n=2; n<=maxThreads; n*=2) {
+    ge::core::ThreadPool pool(n);
+    std::fill(drawIndirect.begin(),drawIndirect.end(),0);
+    double t = run(&pool);
+    std::cout << "threads: " << std::setw(3) << n
+              << "  time: " << std::setw(8) << t << " ms"
+              << "  speedup: " << std::setw(5) << serialTime/t
+              << "  identical: " << (drawIndirect==reference?"yes":"NO") << std::endl;
+  }
+}
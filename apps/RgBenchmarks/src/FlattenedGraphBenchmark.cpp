@@ -0,0 +1,115 @@
+#include "Benchmarks.h"
+#include <geRG/FlattenedTransformationGraph.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace ge::rg;
+
+namespace {
+
+// Pointer-based node with shared_ptr child list and local matrix
+// placed in a shared buffer, like geRG Transformation.
+struct Node {
+  unsigned localOffset64;
+  unsigned outputOffset64;
+  std::vector<std::shared_ptr<Node>> children;
+};
+
+void processNode(const Node *n,const float *parent,const float *localMatrices,MatrixGpuData *out) {
+  float mv[16];
+  FlattenedTransformationGraph::multiplyMatrices(parent,&localMatrices[n->localOffset64*16],mv);
+  std::copy(mv,mv+16,out[n->outputOffset64].matrix);
+  for(auto &c : n->children)
+    processNode(c.get(),mv,localMatrices,out);
+}
+
+} // namespace
+
+// Compares recursive evaluation of pointer-based graph with the linear pass
+// of FlattenedTransformationGraph on a graph of about 100k nodes.
+// Nodes and their local matrices are allocated in shuffled order
+// to simulate the graph built and modified over time.
+void flattenedGraphBenchmark() {
+  const unsigned numNodes = 100000;
+  std::mt19937 rnd(1);
+
+  // local matrices (index 0 is identity null item)
+  std::vector<float> localMatrices((numNodes+1)*16,0.f);
+  std::uniform_real_distribution<float> dist(-1.f,1.f);
+  for(unsigned i=0; i<=numNodes; i++) {
+    float *m = &localMatrices[i*16];
+    m[0] = m[5] = m[10] = m[15] = 1.f;
+    if(i>0) {
+      m[12] = dist(rnd); m[13] = dist(rnd); m[14] = dist(rnd);
+    }
+  }
+  std::vector<unsigned> localOffsets(numNodes);
+  for(unsigned i=0; i<numNodes; i++)
+    localOffsets[i] = i+1;
+  std::shuffle(localOffsets.begin(),localOffsets.end(),rnd);
+
+  // allocate nodes in shuffled order, each node gets a random earlier node as parent
+  std::vector<std::shared_ptr<Node>> nodes(numNodes);
+  std::vector<unsigned> allocOrder(numNodes);
+  for(unsigned i=0; i<numNodes; i++)
+    allocOrder[i] = i;
+  std::shuffle(allocOrder.begin(),allocOrder.end(),rnd);
+  for(unsigned i : allocOrder)
+    nodes[i] = std::make_shared<Node>();
+  for(unsigned i=0; i<numNodes; i++) {
+    nodes[i]->localOffset64 = localOffsets[i];
+    if(i>0)
+      nodes[unsigned(rnd()%i)]->children.push_back(nodes[i]);
+  }
+
+  // assign output offsets in depth-first order
+  // and build flattened graph in breadth-first order
+  unsigned position = 1;
+  std::vector<Node*> stack{nodes[0].get()};
+  while(!stack.empty()) {
+    Node *n = stack.back();
+    stack.pop_back();
+    n->outputOffset64 = position++;
+    for(auto it=n->children.rbegin(); it!=n->children.rend(); it++)
+      stack.push_back(it->get());
+  }
+  FlattenedTransformationGraph g;
+  std::vector<std::pair<Node*,unsigned>> queue{{nodes[0].get(),FlattenedTransformationGraph::noParent}};
+  for(unsigned i=0; i<queue.size(); i++) {
+    Node *n = queue[i].first;
+    unsigned index = g.addNode(queue[i].second,n->localOffset64,n->outputOffset64);
+    for(auto &c : n->children)
+      queue.emplace_back(c.get(),index);
+  }
+
+  const unsigned repeats = 20;
+  std::vector<MatrixGpuData> out1(numNodes+1),out2(numNodes+1);
+
+  auto t1 = std::chrono::high_resolution_clock::now();
+  for(unsigned i=0; i<repeats; i++)
+    processNode(nodes[0].get(),&localMatrices[0],localMatrices.data(),out1.data());
+  auto t2 = std::chrono::high_resolution_clock::now();
+  for(unsigned i=0; i<repeats; i++)
+    g.evaluate(localMatrices.data(),out2.data());
+  auto t3 = std::chrono::high_resolution_clock::now();
+
+  float maxDiff = 0.f;
+  for(unsigned i=1; i<=numNodes; i++)
+    for(unsigned j=0; j<16; j++)
+      maxDiff = std::max(maxDiff,std::abs(out1[i].matrix[j]-out2[i].matrix[j]));
+
+  double pointerTime = std::chrono::duration<double,std::milli>(t2-t1).count()/repeats;
+  double flattenedTime = std::chrono::duration<double,std::milli>(t3-t2).count()/repeats;
+  std::cout << "nodes: " << numNodes << std::endl;
+  std::cout << std::fixed << std::setprecision(3)
+            << "pointer graph:   " << pointerTime << " ms" << std::endl
+            << "flattened graph: " << flattenedTime << " ms" << std::endl
+            << "speedup: " << std::setprecision(2) << pointerTime/flattenedTime
+            << "  max difference: " << std::scientific << maxDiff << std::endl;
+}
@@ -0,0 +1,101 @@
+#include "Benchmarks.h"
+#include <geCore/ThreadPool.h>
+#include <geGL/geGL.h>
+#include <geGL/NullLoader.h>
+#include <geRG/RenderingContext.h>
+#include <geRG/Transformation.h>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace ge::core;
+using namespace ge::rg;
+
+namespace {
+
+// Builds subtree of geRG Transformations, each of them with its own MatrixList.
+void buildSubtree(const std::shared_ptr<Transformation> &t,unsigned depth,unsigned branching,
+                  std::mt19937 &rnd,unsigned &numNodes) {
+  std::uniform_real_distribution<float> dist(-1.f,1.f);
+  float m[16] = { 1.f,0.f,0.f,0.f, 0.f,1.f,0.f,0.f, 0.f,0.f,1.f,0.f,
+                  dist(rnd),dist(rnd),dist(rnd),1.f };
+  t->uploadMatrix(m);
+  t->getOrCreateMatrixList();
+  numNodes++;
+  if(depth==0)
+    return;
+  unsigned n = 1+unsigned(rnd()%(branching*2));
+  for(unsigned i=0; i<n; i++) {
+    auto child = std::make_shared<Transformation>();
+    t->addChild(child);
+    buildSubtree(child,depth-1,branching,rnd,numNodes);
+  }
+}
+
+std::vector<float> matrixContent(RenderingContext *rc) {
+  rc->unmapBuffers();
+  std::vector<float> data(size_t(rc->bufferPosition())*16);
+  rc->matrixStorage()->buffer()->getData(data.data(),data.size()*sizeof(float));
+  return data;
+}
+
+double measure(const std::function<void()> &f,unsigned repeats) {
+  auto t1 = std::chrono::high_resolution_clock::now();
+  for(unsigned i=0; i<repeats; i++)
+    f();
+  auto t2 = std::chrono::high_resolution_clock::now();
+  return std::chrono::duration<double,std::milli>(t2-t1).count()/repeats;
+}
+
+} // namespace
+
+// Runs RenderingContext::evaluateTransformationGraph() on a graph
+// of 256 top-level subtrees (about 140k Transformations) serially
+// and by ThreadPool of increasing size. OpenGL is provided by NullLoader,
+// so matrix buffers live in host memory. Parallel results are checked
+// to be identical to the serial ones.
+void transformationBenchmark() {
+  ge::gl::init(std::make_shared<ge::gl::NullLoader>());
+  RenderingContext::setCurrent(std::make_shared<RenderingContext>());
+  RenderingContext *rc = RenderingContext::current().get();
+  {
+    std::vector<std::shared_ptr<Transformation>> roots;
+    std::mt19937 rnd(1);
+    unsigned numNodes = 0;
+    for(unsigned i=0; i<256; i++) {
+      roots.emplace_back(std::make_shared<Transformation>());
+      buildSubtree(roots.back(),4,4,rnd,numNodes);
+      rc->addTransformationGraph(roots.back());
+    }
+    std::cout << "nodes: " << numNodes << std::endl;
+
+    const unsigned repeats = 10;
+    rc->evaluateTransformationGraph(); // allocates matrix buffer
+    double serialTime = measure([rc] { rc->evaluateTransformationGraph(); },repeats);
+    std::vector<float> serial = matrixContent(rc);
+    std::cout << "serial: " << std::fixed << std::setprecision(2) << serialTime << " ms" << std::endl;
+
+    unsigned maxThreads = std::max(std::thread::hardware_concurrency(),1u);
+    for(unsigned n=1; n<=maxThreads; n*=2) {
+      rc->setThreadPool(std::make_shared<ThreadPool>(n));
+      double t = measure([rc] { rc->evaluateTransformationGraph(); },repeats);
+      bool identical = matrixContent(rc)==serial;
+      std::cout << "threads: " << std::setw(3) << n
+                << "  time: " << std::setw(8) << t << " ms"
+                << "  speedup: " << std::setw(5) << serialTime/t
+                << "  identical: " << (identical?"yes":"NO") << std::endl;
+    }
+    rc->setThreadPool(nullptr);
+
+    for(auto &r : roots)
+      rc->removeTransformationGraph(r);
+  }
+  RenderingContext::setCurrent(nullptr);
+}
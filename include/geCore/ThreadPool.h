@@ -0,0 +1,84 @@
+#ifndef GE_CORE_THREAD_POOL_H
+#define GE_CORE_THREAD_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <geCore/Export.h>
+
+namespace ge
+{
+   namespace core
+   {
+
+      /** Pool of worker threads for data-parallel loops.
+       *
+       *  ThreadPool keeps its worker threads alive for its whole lifetime,
+       *  so it can be used every frame without thread creation overhead.
+       *  The work is submitted by parallelFor() that executes the given function
+       *  for each task index in the range <0,numTasks). Task indices are
+       *  handed out dynamically one by one, so the threads that finish
+       *  their tasks early take over remaining tasks of the slower ones.
+       *  The calling thread participates on the work as well and
+       *  parallelFor() returns after all the tasks were finished.
+       *
+       *  If a task throws, the remaining tasks are skipped and parallelFor()
+       *  rethrows the first exception after all the threads stopped working.
+       *
+       *  Only one parallelFor() may be in progress at a time. Concurrent calls
+       *  from different threads are serialized.
+       */
+      class GECORE_EXPORT ThreadPool {
+      public:
+
+         typedef std::function<void(unsigned taskIndex)> Task;
+
+         ThreadPool(unsigned numThreads=0);
+         ~ThreadPool();
+
+         void parallelFor(unsigned numTasks,const Task& task);
+
+         inline unsigned numThreads() const;  ///< Returns the number of threads executing the tasks, including the thread calling parallelFor().
+
+         ThreadPool(const ThreadPool&) = delete;
+         ThreadPool& operator=(const ThreadPool&) = delete;
+
+      protected:
+
+         void workerMain();
+         void runTasks();
+
+         std::vector<std::thread> _workers;
+         std::mutex _mutex;
+         std::mutex _parallelForMutex;
+         std::condition_variable _workAvailable;
+         std::condition_variable _workDone;
+         const Task* _task;
+         unsigned _numTasks;
+         std::atomic<unsigned> _nextTask;
+         std::exception_ptr _exception;  ///< The first exception thrown by a task of the current parallelFor().
+         unsigned _numWorkersRunning;
+         unsigned _generation;
+         bool _quit;
+
+      };
+
+   }
+}
+
+
+
+// inline methods
+namespace ge
+{
+   namespace core
+   {
+      inline unsigned ThreadPool::numThreads() const  { return unsigned(_workers.size())+1; }
+   }
+}
+
+#endif /* GE_CORE_THREAD_POOL_H */
@@ -67,6 +67,10 @@ class GEGL_EXPORT ge::gl::Buffer:
     bool realloc(
         GLsizeiptr   const&newSize             ,
         ReallocFlags const&flags   = NEW_BUFFER);
+    bool realloc(
+        GLsizeiptr   const&newSize    ,
+        ReallocFlags const&flags      ,
+        GLbitfield   const&bufferFlags);
     void copy(
         Buffer const&buffer)const;
     void flushMapped(
@@ -96,6 +100,7 @@ class GEGL_EXPORT ge::gl::Buffer:
     GLsizeiptr getMapSize    ()const;
     GLvoid*    getMapPointer ()const;
     GLboolean  isImmutable   ()const;
+    GLbitfield getStorageFlags()const;
   private:
     GLint   _getBufferParameter(
         GLenum const&pname)const;
@@ -0,0 +1,112 @@
+#pragma once
+
+#include<geGL/OpenGL.h>
+#include<algorithm>
+#include<cstring>
+#include<iostream>
+#include<map>
+#include<vector>
+
+/**
+ * @brief binary stream of OpenGL calls
+ * It is filled by RecordingTableDecorator and replayed by CallReplayer.
+ * Every call is stored as id of function followed by its arguments.
+ * Client memory that is read by OpenGL (buffer data, uniform arrays, images, strings)
+ * is copied into the stream.
+ * Data written to mapped buffers are captured before calls that can read them
+ * (draws, dispatches, barriers, fences, unmapping, flushing).
+ * Calls that pass client memory of unknown size are not recorded, they are counted as refused.
+ */
+class GEGL_EXPORT ge::gl::CallRecorder{
+  public:
+    static uint32_t const frameMarker = 0xffffffffu;
+    static uint32_t const mappedWrite = 0xfffffffeu;
+    static uint32_t const version     = 2;
+    /**
+     * @brief state set by glPixelStorei
+     */
+    struct PixelStore{
+      GLint alignment   = 4;
+      GLint rowLength   = 0;
+      GLint imageHeight = 0;
+      GLint skipPixels  = 0;
+      GLint skipRows    = 0;
+      GLint skipImages  = 0;
+    };
+    CallRecorder();
+    void clear   ();
+    void endFrame();
+    size_t                     getNofCalls ()const;
+    size_t                     getNofFrames()const;
+    size_t                     getNofRefusedCalls()const;
+    uint8_t const*             getData     ()const;
+    size_t                     getSize     ()const;
+    void save(std::ostream&out)const;
+    static size_t pixelSize (GLenum format,GLenum type);
+    static size_t stringSize(GLchar const*string,GLint length);
+    size_t unpackImageSize(GLenum format,GLenum type,GLsizei width,GLsizei height,GLsizei depth)const;
+    size_t packImageSize  (GLenum format,GLenum type,GLsizei width,GLsizei height,GLsizei depth)const;
+    bool beginCall(uint32_t id,bool captureMappedMemory,bool recordable = true);
+    void endCall  ();
+    template<typename T>
+      void value(T const&v);
+    void data        (void const*data,size_t size);
+    void pixels      (void const*data,size_t size);
+    void strings     (GLsizei count,GLchar const*const*strings,GLint const*length);
+    void output      (void const*data,size_t size);
+    void outputPixels(void const*data,size_t size);
+    void names       (GLsizei n,GLuint const*names);
+    void captureMappedMemory();
+    void onBindBuffer         (GLenum target,GLuint buffer);
+    void onBindBufferBase     (GLenum target,GLuint index,GLuint buffer);
+    void onBindBufferRange    (GLenum target,GLuint index,GLuint buffer,GLintptr offset,GLsizeiptr size);
+    void onBufferData         (GLenum target,GLsizeiptr size,void const*data,GLenum usage);
+    void onBufferStorage      (GLenum target,GLsizeiptr size,void const*data,GLbitfield flags);
+    void onNamedBufferData    (GLuint buffer,GLsizeiptr size,void const*data,GLenum usage);
+    void onNamedBufferStorage (GLuint buffer,GLsizeiptr size,void const*data,GLbitfield flags);
+    void onDeleteBuffers      (GLsizei n,GLuint const*buffers);
+    void onPixelStorei        (GLenum pname,GLint param);
+    void onMapBuffer          (GLenum target,GLenum access,void*pointer);
+    void onMapBufferRange     (GLenum target,GLintptr offset,GLsizeiptr length,GLbitfield access,void*pointer);
+    void onMapNamedBuffer     (GLuint buffer,GLenum access,void*pointer);
+    void onMapNamedBufferRange(GLuint buffer,GLintptr offset,GLsizeiptr length,GLbitfield access,void*pointer);
+    void onUnmapBuffer        (GLenum target,GLboolean result);
+    void onUnmapNamedBuffer   (GLuint buffer,GLboolean result);
+  protected:
+    struct Mapping{
+      uint8_t*             pointer = nullptr;
+      std::vector<uint8_t> shadow         ;///< content of mapped memory that is already in the stream
+    };
+    std::vector<uint8_t>    _data              ;///< storage, only first _size bytes are used
+    size_t                  _size       = 0    ;
+    bool                    _inCall     = false;
+    size_t                  _nofCalls   = 0    ;
+    size_t                  _nofFrames  = 0    ;
+    size_t                  _nofRefusedCalls = 0;
+    std::map<GLenum,GLuint> _bufferBindings    ;
+    std::map<GLuint,size_t> _bufferSizes       ;
+    std::map<GLuint,Mapping>_mappings          ;///< buffers that are mapped for writing
+    PixelStore              _unpack            ;
+    PixelStore              _pack              ;
+    void _write(void const*data,size_t size);
+    void _align();
+    void _map  (GLuint buffer,size_t size,bool write,void*pointer);
+    static size_t _imageSize(PixelStore const&store,GLenum format,GLenum type,GLsizei width,GLsizei height,GLsizei depth);
+};
+
+/**
+ * @brief writes argument by value
+ *
+ * @param v scalar or pointer
+ */
+template<typename T>
+inline void ge::gl::CallRecorder::value(T const&v){
+  this->_write(&v,sizeof(T));
+}
+
+inline void ge::gl::CallRecorder::_write(void const*data,size_t size){
+  if(this->_size+size > this->_data.size())
+    this->_data.resize(std::max(this->_data.size()*2,this->_size+size+(1<<16)));
+  std::memcpy(this->_data.data()+this->_size,data,size);
+  this->_size += size;
+}
@@ -0,0 +1,141 @@
+#pragma once
+
+#include<geGL/CallRecorder.h>
+#include<cassert>
+#include<map>
+#include<vector>
+
+/**
+ * @brief replays OpenGL calls recorded by RecordingTableDecorator
+ * Calls are issued to any function table, for example to a table without GPU.
+ * The table has to provide all recorded functions.
+ * Client memory is passed as pointers into the loaded stream.
+ * Memory written by OpenGL (glGet*, glReadPixels) is replaced by scratch memory.
+ * Objects are expected to get the same names as during recording,
+ * names returned by glGen*, glCreate* are compared and mismatches are counted.
+ * Syncs and mapped buffers are translated.
+ * Corrupted or truncated stream stops the replay, isCorrupted() reports it.
+ */
+class GEGL_EXPORT ge::gl::CallReplayer{
+  public:
+    static size_t const defaultOutputSize = 1<<16;
+    CallReplayer(FunctionTablePointer const&table);
+    bool load   (std::istream&in);
+    void setData(uint8_t const*data,size_t size);
+    bool replayCall ();
+    bool replayFrame();
+    void replay     ();
+    void rewind     ();
+    size_t getPosition()const;
+    void   setPosition(size_t position);
+    size_t getSize    ()const;
+    size_t getNofReplayedCalls  ()const;
+    size_t getNofReplayedFrames ()const;
+    size_t getNofNameMismatches ()const;
+    bool   isCorrupted          ()const;
+    template<typename T>T value       ();
+    template<typename T>T null        ();
+    template<typename T>T data        ();
+    template<typename T>T pixels      ();
+    template<typename T>T output      ();
+    template<typename T>T outputPixels();
+    GLchar const*const*strings();
+    GLsync sync();
+    void checkNames(GLuint const*names);
+    void checkName (GLuint name);
+    void syncResult(GLsync sync);
+    void mapResult (void*pointer);
+  protected:
+    FunctionTablePointer                _table                ;
+    std::vector<uint8_t>                _data                 ;
+    size_t                              _position          = 0;
+    size_t                              _nofCalls          = 0;
+    size_t                              _nofFrames         = 0;
+    size_t                              _nofNameMismatches = 0;
+    bool                                _corrupted         = false;
+    std::map<GLsync,GLsync>             _syncs                ;
+    std::map<void const*,uint8_t*>      _mappings             ;///< recorded mapped pointer -> replayed mapped pointer
+    std::vector<GLchar const*>          _strings              ;
+    std::vector<std::vector<uint8_t>>   _outputs              ;
+    size_t                              _nofOutputs        = 0;
+    void       _read(void*data,size_t size);
+    void const*_blob();
+    void*      _output();
+    void       _replayMappedWrite();
+};
+
+/**
+ * @brief reads argument stored by value
+ *
+ * @return argument
+ */
+template<typename T>
+inline T ge::gl::CallReplayer::value(){
+  T v;
+  this->_read(&v,sizeof(T));
+  return v;
+}
+
+/**
+ * @brief reads argument that is replayed as nullptr (callbacks)
+ *
+ * @return nullptr
+ */
+template<typename T>
+inline T ge::gl::CallReplayer::null(){
+  this->value<T>();
+  return nullptr;
+}
+
+/**
+ * @brief reads client memory
+ *
+ * @return pointer into stream or nullptr
+ */
+template<typename T>
+inline T ge::gl::CallReplayer::data(){
+  return (T)this->_blob();
+}
+
+/**
+ * @brief reads image data, they are offset into pixel unpack buffer or client memory
+ *
+ * @return offset or pointer into stream
+ */
+template<typename T>
+inline T ge::gl::CallReplayer::pixels(){
+  if(this->value<uint8_t>() == 0)return (T)this->value<void const*>();
+  return this->data<T>();
+}
+
+/**
+ * @brief reads client memory written by OpenGL
+ *
+ * @return scratch memory or nullptr
+ */
+template<typename T>
+inline T ge::gl::CallReplayer::output(){
+  return (T)this->_output();
+}
+
+/**
+ * @brief reads image data written by OpenGL, they are offset into pixel pack buffer or client memory
+ *
+ * @return offset or scratch memory
+ */
+template<typename T>
+inline T ge::gl::CallReplayer::outputPixels(){
+  if(this->value<uint8_t>() == 0)return (T)this->value<void const*>();
+  return this->output<T>();
+}
+
+inline void ge::gl::CallReplayer::_read(void*data,size_t size){
+  if(size > this->_data.size()-this->_position){
+    std::memset(data,0,size);
+    this->_position  = this->_data.size();
+    this->_corrupted = true;
+    return;
+  }
+  std::memcpy(data,this->_data.data()+this->_position,size);
+  this->_position += size;
+}
@@ -0,0 +1,129 @@
+#pragma once
+
+#include<geGL/OpenGLContext.h>
+#include<chrono>
+#include<deque>
+#include<iostream>
+#include<map>
+#include<string>
+#include<vector>
+
+/**
+ * @brief non-blocking CPU and GPU profiler of frames
+ * Frame (beginFrame/endFrame) is divided into named nested scopes (begin/end or Scope).
+ * Each scope measures CPU time by steady clock and GPU time by pair of GL_TIMESTAMP
+ * queries (glQueryCounter), so scopes can be nested unlike GL_TIME_ELAPSED queries.
+ * Queries are taken from a pool and they are read back when the last query of the frame
+ * is available, so reading never stalls the pipeline. If GPU falls more than maxLatency
+ * frames behind, the oldest frame is dropped instead of waiting for it.
+ * Resolved frames feed rolling statistics of scopes (min/avg/p99 over the last historySize frames)
+ * and combined CPU+GPU timeline of the last resolved frame. GPU times are converted to CPU clock
+ * using offset sampled by glGetInteger64v(GL_TIMESTAMP) every calibrationPeriod frames.
+ * Scopes are identified by paths of names of nested scopes separated by '/', root scope is "frame".
+ */
+class GEGL_EXPORT ge::gl::FrameProfiler{
+  public:
+    using Clock = std::chrono::steady_clock;
+    /**
+     * @brief statistics of one scope over the history, times are in nanoseconds
+     */
+    struct Statistics{
+      uint64_t samples = 0;
+      uint64_t min     = 0;
+      uint64_t avg     = 0;
+      uint64_t p99     = 0;
+      uint64_t max     = 0;
+      uint64_t last    = 0;
+    };
+    /**
+     * @brief scope of resolved frame, times are in nanoseconds since construction of profiler
+     */
+    struct Event{
+      std::string name    ;
+      size_t      depth   ;
+      uint64_t    cpuBegin;
+      uint64_t    cpuEnd  ;
+      uint64_t    gpuBegin;///< GPU time converted to CPU clock
+      uint64_t    gpuEnd  ;
+    };
+    /**
+     * @brief scope guard
+     */
+    class Scope{
+      public:
+        Scope(FrameProfiler&profiler,std::string const&name);
+        ~Scope();
+        Scope(Scope const&) = delete;
+      protected:
+        FrameProfiler&_profiler;
+    };
+    FrameProfiler(
+        size_t                     maxLatency  = 3  ,
+        size_t                     historySize = 128);
+    FrameProfiler(
+        FunctionTablePointer const&table            ,
+        size_t                     maxLatency  = 3  ,
+        size_t                     historySize = 128);
+    ~FrameProfiler();
+    FrameProfiler(FrameProfiler const&) = delete;
+    void beginFrame();
+    void endFrame  ();
+    void begin(std::string const&name);
+    void end  ();
+    void   setEnabled(bool enable = true);
+    bool   isEnabled ()const;
+    void   setCalibrationPeriod(size_t frames);
+    size_t getCalibrationPeriod()const;
+    std::vector<std::string>getScopeNames()const;
+    Statistics getCpuStatistics(std::string const&name)const;
+    Statistics getGpuStatistics(std::string const&name)const;
+    std::vector<Event>const&getTimeline()const;
+    uint64_t getFrameId          ()const;
+    uint64_t getNofResolvedFrames()const;
+    uint64_t getNofDroppedFrames ()const;
+    size_t   getNofPendingFrames ()const;
+    size_t   getNofQueries       ()const;
+    void writeChromeTrace(std::ostream&out)const;
+  protected:
+    struct PendingScope{
+      std::string name    ;
+      size_t      depth   ;
+      uint64_t    cpuBegin;
+      uint64_t    cpuEnd  ;
+      GLuint      begin   ;///< timestamp query
+      GLuint      end     ;///< timestamp query
+    };
+    struct PendingFrame{
+      uint64_t                 id    ;
+      int64_t                  offset;///< GPU time - CPU time
+      std::vector<PendingScope>scopes;///< root scope is the first one
+    };
+    struct History{
+      std::deque<uint64_t>cpu;
+      std::deque<uint64_t>gpu;
+    };
+    Context                       _gl                       ;
+    size_t                        _maxLatency               ;
+    size_t                        _historySize              ;
+    size_t                        _calibrationPeriod = 60   ;
+    bool                          _enabled           = true ;
+    bool                          _inFrame           = false;
+    Clock::time_point             _epoch                    ;
+    int64_t                       _offset            = 0    ;
+    uint64_t                      _frameId           = 0    ;
+    uint64_t                      _nofResolved       = 0    ;
+    uint64_t                      _nofDropped        = 0    ;
+    size_t                        _nofQueries        = 0    ;
+    std::vector<GLuint>           _freeQueries              ;
+    PendingFrame                  _frame                    ;///< frame that is being recorded
+    std::vector<size_t>           _stack                    ;///< open scopes of _frame
+    std::deque<PendingFrame>      _pending                  ;
+    std::map<std::string,History> _history                  ;
+    std::vector<Event>            _timeline                 ;
+    uint64_t _now()const;
+    GLuint _allocateQuery();
+    void _resolve();
+    void _resolveFrame(PendingFrame const&frame);
+    void _dropFrame(PendingFrame const&frame);
+    static Statistics _statistics(std::deque<uint64_t>const&samples);
+};
@@ -0,0 +1,130 @@
+#pragma once
+
+#include<geGL/OpenGL.h>
+#include<chrono>
+#include<iostream>
+#include<string>
+#include<vector>
+
+/**
+ * @brief CPU-side statistics of OpenGL function calls
+ * It is filled by ProfilingTableDecorator.
+ * Each function has number of calls, time spent in the function and latency histogram.
+ * Statistics are kept for the whole run and for the current frame (since beginFrame()).
+ * Calls are always counted. Timing can be limited to every n-th call of each function
+ * (setTimingPeriod), that keeps the overhead of clock reads low in production builds.
+ * Individual calls can be recorded for Chrome trace export (chrome://tracing).
+ */
+class GEGL_EXPORT ge::gl::FunctionProfiler{
+  public:
+    using Clock = std::chrono::steady_clock;
+    using FunctionName = char const*(*)(size_t id);
+    static size_t const nofHistogramBuckets = 16;
+    static size_t const noFunction = size_t(-1);
+    /**
+     * @brief statistics of one function, times are in nanoseconds
+     * Histogram bucket i counts calls that took [32<<i,64<<i) ns,
+     * the first bucket includes shorter calls and the last one longer calls.
+     */
+    struct Statistics{
+      uint64_t calls      = 0;
+      uint64_t timedCalls = 0;///< number of calls included in time, maxTime and histogram
+      uint64_t time    = 0;
+      uint64_t maxTime = 0;
+      uint64_t histogram[nofHistogramBuckets] = {};
+    };
+    struct TraceEvent{
+      size_t            function;
+      Clock::time_point start   ;
+      Clock::duration   duration;
+    };
+    struct Frame{
+      uint64_t          id      ;
+      Clock::time_point start   ;
+      Clock::duration   duration;
+      uint64_t          calls   ;
+    };
+    FunctionProfiler();
+    void        setFunctions(size_t nofFunctions,FunctionName const&name);
+    size_t      getNofFunctions()const;
+    char const* getFunctionName(size_t id)const;
+    size_t      findFunction(std::string const&name)const;
+    void setTimingEnabled (bool enable = true);
+    bool isTimingEnabled  ()const;
+    void   setTimingPeriod(size_t period);
+    size_t getTimingPeriod()const;
+    void setTracingEnabled(bool enable = true,size_t maxEvents = 1<<20);
+    bool isTracingEnabled ()const;
+    void reset     ();
+    void beginFrame();
+    void endFrame  ();
+    uint64_t                getFrameId        ()const;
+    Statistics       const& getStatistics     (size_t id)const;
+    Statistics       const& getFrameStatistics(size_t id)const;
+    std::vector<TraceEvent>const&getTrace     ()const;
+    std::vector<Frame>     const&getFrames    ()const;
+    void writeJSON       (std::ostream&out)const;
+    void writeChromeTrace(std::ostream&out)const;
+    Clock::time_point begin(size_t id)const;
+    void end(size_t id,Clock::time_point const&start);
+  protected:
+    FunctionName            _functionName   = nullptr;
+    std::vector<Statistics> _statistics          ;
+    std::vector<Statistics> _frameStatistics     ;
+    std::vector<size_t>     _frameFunctions      ;///< functions with nonzero frame statistics
+    std::vector<TraceEvent> _trace               ;
+    std::vector<Frame>      _frames              ;
+    size_t                  _maxTraceEvents = 0  ;
+    bool                    _timing         = true ;
+    uint64_t                _timingMask     = 0  ;///< timing period - 1
+    bool                    _tracing        = false;
+    uint64_t                _frameId        = 0  ;
+    uint64_t                _frameCalls     = 0  ;
+    Clock::time_point       _frameStart          ;
+    Clock::time_point       _epoch               ;
+    static void _add(Statistics&statistics,uint64_t time,size_t bucket);
+    void _writeStatistics(std::ostream&out,std::vector<Statistics>const&statistics)const;
+};
+
+/**
+ * @brief starts measurement of a call
+ *
+ * @param id id of function
+ *
+ * @return start time of the call if the call is timed, zero time point otherwise
+ */
+inline ge::gl::FunctionProfiler::Clock::time_point ge::gl::FunctionProfiler::begin(size_t id)const{
+  if(!this->_timing || (this->_statistics[id].calls & this->_timingMask))return Clock::time_point();
+  return Clock::now();
+}
+
+/**
+ * @brief ends measurement of a call
+ *
+ * @param id id of function
+ * @param start value returned by begin()
+ */
+inline void ge::gl::FunctionProfiler::end(size_t id,Clock::time_point const&start){
+  Statistics&total = this->_statistics     [id];
+  Statistics&frame = this->_frameStatistics[id];
+  if(frame.calls == 0)this->_frameFunctions.push_back(id);
+  this->_frameCalls++;
+  total.calls++;
+  frame.calls++;
+  if(start == Clock::time_point())return;
+  auto const now = Clock::now();
+  uint64_t const time = uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(now-start).count());
+  size_t bucket = 0;
+  for(uint64_t t = time>>6;t && bucket+1<nofHistogramBuckets;t>>=1)bucket++;
+  _add(total,time,bucket);
+  _add(frame,time,bucket);
+  if(this->_tracing && this->_trace.size() < this->_maxTraceEvents)
+    this->_trace.push_back({id,start,now-start});
+}
+
+inline void ge::gl::FunctionProfiler::_add(Statistics&statistics,uint64_t time,size_t bucket){
+  statistics.timedCalls++;
+  statistics.time += time;
+  if(time > statistics.maxTime)statistics.maxTime = time;
+  statistics.histogram[bucket]++;
+}
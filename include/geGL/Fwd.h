@@ -13,6 +13,16 @@ namespace ge{
     class OpenGLObject;
     class Buffer;
     class Program;
+    class ProgramBinaryCache;
+    class ShaderPreprocessor;
+    class TextureStreamer;
+    class UploadBatcher;
+    class UniformHandle;
+    class FunctionProfiler;
+    class FrameProfiler;
+    class CallRecorder;
+    class CallReplayer;
+    class NullLoader;
     class Shader;
     class Texture;
     class VertexArray;
@@ -0,0 +1,5712 @@
+static void null_glMultiDrawArraysIndirectBindlessCountNV(GLenum,const void*,GLsizei,GLsizei,GLsizei,GLint){}
+static void null_glTextureParameterfv(GLuint,GLenum,const GLfloat*){}
+static void null_glGetListParameterivSGIX(GLuint,GLenum,GLint*){}
+static void null_glProgramUniform1i64ARB(GLuint,GLint,GLint64){}
+static void null_glVertexArrayElementBuffer(GLuint,GLuint){}
+static void null_glHintPGI(GLenum,GLint){}
+static void null_glStencilMaskSeparate(GLenum,GLuint){}
+static void null_glGetFramebufferAttachmentParameterivEXT(GLenum,GLenum,GLenum,GLint*){}
+static void null_glTextureStorage3DMultisample(GLuint,GLsizei,GLenum,GLsizei,GLsizei,GLsizei,GLboolean){}
+static void null_glGetIntegerIndexedvEXT(GLenum,GLuint,GLint*){}
+static void null_glCopyTexImage1D(GLenum,GLint,GLenum,GLint,GLint,GLsizei,GLint){}
+static void null_glVertexAttrib4usv(GLuint,const GLushort*){}
+static void null_glTexRenderbufferNV(GLenum,GLuint){}
+static void null_glVertexAttrib3hvNV(GLuint,const GLhalfNV*){}
+static void null_glProgramUniform4ui64ARB(GLuint,GLint,GLuint64,GLuint64,GLuint64,GLuint64){}
+static void null_glInstrumentsBufferSGIX(GLsizei,GLint*){}
+static void null_glIndexi(GLint){}
+static void null_glMultiTexCoord2sARB(GLenum,GLshort,GLshort){}
+static void null_glProgramEnvParameter4fARB(GLenum,GLuint,GLfloat,GLfloat,GLfloat,GLfloat){}
+static void null_glCompressedTexSubImage3D(GLenum,GLint,GLint,GLint,GLint,GLsizei,GLsizei,GLsizei,GLenum,GLsizei,const GLvoid*){}
+static void null_glEvalCoord2d(GLdouble,GLdouble){}
+static void null_glEvalCoord2f(GLfloat,GLfloat){}
+static void null_glIndexd(GLdouble){}
+static void null_glSecondaryColor3hvNV(const GLhalfNV*){}
+static void null_glIndexf(GLfloat){}
+static void null_glFrustumxOES(GLfixed,GLfixed,GLfixed,GLfixed,GLfixed,GLfixed){}
+static void null_glTextureStorage3DEXT(GLuint,GLenum,GLsizei,GLenum,GLsizei,GLsizei,GLsizei){}
+static void null_glDrawCommandsStatesNV(GLuint,const GLintptr*,const GLsizei*,const GLuint*,const GLuint*,GLuint){}
+static void null_glUniform4uiEXT(GLint,GLuint,GLuint,GLuint,GLuint){}
+static void null_glProgramUniform3ui64ARB(GLuint,GLint,GLuint64,GLuint64,GLuint64){}
+static void null_glIndexs(GLshort){}
+static void null_glVertexArrayBindVertexBufferEXT(GLuint,GLuint,GLuint,GLintptr,GLsizei){}
+static void null_glConvolutionParameteriEXT(GLenum,GLenum,GLint){}
+static void null_glColor4ubVertex2fSUN(GLubyte,GLubyte,GLubyte,GLubyte,GLfloat,GLfloat){}
+static void null_glProgramUniform1ivEXT(GLuint,GLint,GLsizei,const GLint*){}
+static void null_glGetnMapfv(GLenum,GLenum,GLsizei,GLfloat*){}
+static void null_glTransformFeedbackBufferRange(GLuint,GLuint,GLuint,GLintptr,GLsizeiptr){}
+static void null_glPathGlyphsNV(GLuint,GLenum,const void*,GLbitfield,GLsizei,GLenum,const void*,GLenum,GLuint,GLfloat){}
+static void null_glSecondaryColor3fv(const GLfloat*){}
+static void null_glGetCombinerInputParameterivNV(GLenum,GLenum,GLenum,GLenum,GLint*){}
+static void null_glEndPerfMonitorAMD(GLuint){}
+static void null_glPointParameterfvARB(GLenum,const GLfloat*){}
+static void null_glVertex2xOES(GLfixed){}
+static void null_glDrawElementsInstancedBaseInstance(GLenum,GLsizei,GLenum,const void*,GLsizei,GLuint){}
+static void null_glMultTransposeMatrixdARB(const GLdouble*){}
+static void null_glVertexAttribL4dEXT(GLuint,GLdouble,GLdouble,GLdouble,GLdouble){}
+static void null_glVertex4iv(const GLint*){}
+static void null_glCoverStrokePathInstancedNV(GLsizei,GLenum,const void*,GLuint,GLenum,GLenum,const GLfloat*){}
+static void null_glDeformSGIX(GLbitfield){}
+static void null_glUniform2ui64NV(GLint,GLuint64EXT,GLuint64EXT){}
+static void null_glCopyPathNV(GLuint,GLuint){}
+static void null_glVertexAttribP4ui(GLuint,GLenum,GLboolean,GLuint){}
+static void null_glVertexAttribL2d(GLuint,GLdouble,GLdouble){}
+static void null_glGetMultisamplefv(GLenum,GLuint,GLfloat*){}
+static void null_glCompressedMultiTexSubImage3DEXT(GLenum,GLenum,GLint,GLint,GLint,GLint,GLsizei,GLsizei,GLsizei,GLenum,GLsizei,const void*){}
+static GLvdpauSurfaceNV null_glVDPAURegisterOutputSurfaceNV(const void*,GLenum,GLsizei,const GLuint*){return (GLvdpauSurfaceNV)0;}
+static void null_glMinSampleShading(GLfloat){}
+static void null_glProgramUniform4fEXT(GLuint,GLint,GLfloat,GLfloat,GLfloat,GLfloat){}
+static void null_glCoverStrokePathNV(GLuint,GLenum){}
+static void null_glTextureImage2DMultisampleNV(GLuint,GLenum,GLsizei,GLint,GLsizei,GLsizei,GLboolean){}
+static void null_glVertex3bOES(GLbyte,GLbyte,GLbyte){}
+static void null_glTessellationFactorAMD(GLfloat){}
+static void null_glDebugMessageControl(GLenum,GLenum,GLenum,GLsizei,const GLuint*,GLboolean){}
+static GLboolean null_glIsObjectBufferATI(GLuint){return (GLboolean)0;}
+static void null_glPopAttrib(){}
+static void null_glProgramUniform4iEXT(GLuint,GLint,GLint,GLint,GLint,GLint){}
+static void null_glVertexAttrib4ubNV(GLuint,GLubyte,GLubyte,GLubyte,GLubyte){}
+static void null_glColorMaterial(GLenum,GLenum){}
+static void null_glVertexAttrib2svARB(GLuint,const GLshort*){}
+static void null_glMinSampleShadingARB(GLfloat){}
+static void null_glColor3b(GLbyte,GLbyte,GLbyte){}
+static void null_glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN(GLuint,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat){}
+static void null_glColor3f(GLfloat,GLfloat,GLfloat){}
+static void null_glVDPAUGetSurfaceivNV(GLvdpauSurfaceNV,GLenum,GLsizei,GLsizei*,GLint*){}
+static void null_glColor3d(GLdouble,GLdouble,GLdouble){}
+static void null_glGetnMapiv(GLenum,GLenum,GLsizei,GLint*){}
+static void null_glColor3i(GLint,GLint,GLint){}
+static void null_glGetInternalformatSampleivNV(GLenum,GLenum,GLsizei,GLenum,GLsizei,GLint*){}
+static void null_glVertexAttrib4ubv(GLuint,const GLubyte*){}
+static void null_glColor3s(GLshort,GLshort,GLshort){}
+static void null_glVertexAttribs4hvNV(GLuint,GLsizei,const GLhalfNV*){}
+static void null_glVertexAttrib4NubvARB(GLuint,const GLubyte*){}
+static void null_glMultiTexCoord3hvNV(GLenum,const GLhalfNV*){}
+static void null_glMatrixPushEXT(GLenum){}
+static void null_glProgramUniform2fEXT(GLuint,GLint,GLfloat,GLfloat){}
+static void null_glGetVertexArrayIndexediv(GLuint,GLuint,GLenum,GLint*){}
+static void null_glBlitFramebuffer(GLint,GLint,GLint,GLint,GLint,GLint,GLint,GLint,GLbitfield,GLenum){}
+static void null_glMultiTexCoordP2ui(GLenum,GLenum,GLuint){}
+static void null_glColorPointerListIBM(GLint,GLenum,GLint,const void**,GLint){}
+static void null_glVertexAttribL4d(GLuint,GLdouble,GLdouble,GLdouble,GLdouble){}
+static void null_glGetFragmentMaterialfvSGIX(GLenum,GLenum,GLfloat*){}
+static void null_glVertex2iv(const GLint*){}
+static void null_glGetTexEnvxvOES(GLenum,GLenum,GLfixed*){}
+static void null_glUniformMatrix3dv(GLint,GLsizei,GLboolean,const GLdouble*){}
+static void null_glGetVertexAttribLdvEXT(GLuint,GLenum,GLdouble*){}
+static void null_glTexCoordP3uiv(GLenum,const GLuint*){}
+static void null_glDeformationMap3dSGIX(GLenum,GLdouble,GLdouble,GLint,GLint,GLdouble,GLdouble,GLint,GLint,GLdouble,GLdouble,GLint,GLint,const GLdouble*){}
+static void null_glResumeTransformFeedback(){}
+static void null_glInsertEventMarkerEXT(GLsizei,const GLchar*){}
+static void null_glTessellationModeAMD(GLenum){}
+static void null_glDrawCommandsAddressNV(GLenum,const GLuint64*,const GLsizei*,GLuint){}
+static void null_glFogi(GLenum,GLint){}
+static void null_glGetTexParameterxvOES(GLenum,GLenum,GLfixed*){}
+static void null_glVertexPointer(GLint,GLenum,GLsizei,const GLvoid*){}
+static void null_glGetPerfMonitorCounterDataAMD(GLuint,GLenum,GLsizei,GLuint*,GLint*){}
+static void null_glFogf(GLenum,GLfloat){}
+static void null_glMultiTexCoord1d(GLenum,GLdouble){}
+static void null_glMultiTexCoord1f(GLenum,GLfloat){}
+static void null_glGetMultiTexParameterivEXT(GLenum,GLenum,GLenum,GLint*){}
+static void null_glProgramUniformMatrix3x4fvEXT(GLuint,GLint,GLsizei,GLboolean,const GLfloat*){}
+static void null_glVertexAttribI2i(GLuint,GLint,GLint){}
+static void null_glMultiTexCoord1i(GLenum,GLint){}
+static void null_glUniform1ui64vARB(GLint,GLsizei,const GLuint64*){}
+static void null_glLoadProgramNV(GLenum,GLuint,GLsizei,const GLubyte*){}
+static void null_glWriteMaskEXT(GLuint,GLuint,GLenum,GLenum,GLenum,GLenum){}
+static GLenum null_glGetGraphicsResetStatus(){return (GLenum)0;}
+static void null_glVertexAttrib1fv(GLuint,const GLfloat*){}
+static GLboolean null_glIsEnabled(GLenum){return (GLboolean)0;}
+static void null_glImageTransformParameterfvHP(GLenum,GLenum,const GLfloat*){}
+static void null_glFramebufferTexture2D(GLenum,GLenum,GLenum,GLuint,GLint){}
+static void null_glGetFragmentLightfvSGIX(GLenum,GLenum,GLfloat*){}
+static void null_glListParameterfSGIX(GLuint,GLenum,GLfloat){}
+static void null_glTexCoord3sv(const GLshort*){}
+static void null_glNamedFramebufferRenderbufferEXT(GLuint,GLenum,GLenum,GLuint){}
+static void null_glFragmentLightModelfSGIX(GLenum,GLfloat){}
+static void null_glIndexPointerEXT(GLenum,GLsizei,GLsizei,const void*){}
+static void null_glBlendEquationSeparateATI(GLenum,GLenum){}
+static void null_glVertexArrayAttribIFormat(GLuint,GLuint,GLint,GLenum,GLuint){}
+static void null_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN(GLuint,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat){}
+static void null_glReplacementCodeubvSUN(const GLubyte*){}
+static void null_glGenFramebuffers(GLsizei,GLuint*){}
+static void null_glPixelMapx(GLenum,GLint,const GLfixed*){}
+static void null_glTexSubImage3DEXT(GLenum,GLint,GLint,GLint,GLint,GLsizei,GLsizei,GLsizei,GLenum,GLenum,const void*){}
+static void null_glGetAttachedShaders(GLuint,GLsizei,GLsizei*,GLuint*){}
+static void null_glGetPixelTexGenParameterfvSGIS(GLenum,GLfloat*){}
+static void null_glReplacementCodeuiNormal3fVertex3fSUN(GLuint,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat){}
+static GLuint null_glGetDebugMessageLogAMD(GLuint,GLsizei,GLenum*,GLuint*,GLuint*,GLsizei*,GLchar*){return (GLuint)0;}
+static void null_glVertexStream4sATI(GLenum,GLshort,GLshort,GLshort,GLshort){}
+static void null_glVertexAttribs4dvNV(GLuint,GLsizei,const GLdouble*){}
+static void null_glGetnMapdvARB(GLenum,GLenum,GLsizei,GLdouble*){}
+static void null_glOrthofOES(GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat){}
+static void null_glViewportArrayv(GLuint,GLsizei,const GLfloat*){}
+static void null_glDrawElementArrayATI(GLenum,GLsizei){}
+static void null_glGetPathColorGenfvNV(GLenum,GLenum,GLfloat*){}
+static void null_glWindowPos3iMESA(GLint,GLint,GLint){}
+static void null_glMultiTexCoord2s(GLenum,GLshort,GLshort){}
+static void null_glVertex3dv(const GLdouble*){}
+static void null_glVertexAttribI3uivEXT(GLuint,const GLuint*){}
+static void null_glUniform3ui64ARB(GLint,GLuint64,GLuint64,GLuint64){}
+static void null_glVertexAttrib2fvNV(GLuint,const GLfloat*){}
+static void null_glGetNamedBufferSubDataEXT(GLuint,GLintptr,GLsizeiptr,void*){}
+static void null_glConvolutionFilter2D(GLenum,GLenum,GLsizei,GLsizei,GLenum,GLenum,const GLvoid*){}
+static void null_glMemoryBarrierByRegion(GLbitfield){}
+static void null_glVertexArrayBindingDivisor(GLuint,GLuint,GLuint){}
+static void null_glMatrixRotatedEXT(GLenum,GLdouble,GLdouble,GLdouble,GLdouble){}
+static void null_glTexCoord2sv(const GLshort*){}
+static GLboolean null_glIsProgramNV(GLuint){return (GLboolean)0;}
+static void null_glUniform2dv(GLint,GLsizei,const GLdouble*){}
+static void null_glGetPixelMapuiv(GLenum,GLuint*){}
+static void null_glDepthBoundsEXT(GLclampd,GLclampd){}
+static void null_glVertexAttrib4hvNV(GLuint,const GLhalfNV*){}
+static void null_glMultiTexParameteriEXT(GLenum,GLenum,GLenum,GLint){}
+static void null_glGetPointerv(GLenum,GLvoid**){}
+static void null_glPathCommandsNV(GLuint,GLsizei,const GLubyte*,GLsizei,GLenum,const void*){}
+static void null_glGetUniformfv(GLuint,GLint,GLfloat*){}
+static void null_glGetUniformuiv(GLuint,GLint,GLuint*){}
+static void null_glDebugMessageInsertAMD(GLenum,GLenum,GLuint,GLsizei,const GLchar*){}
+static void null_glFrustum(GLdouble,GLdouble,GLdouble,GLdouble,GLdouble,GLdouble){}
+static void null_glVertexAttribL1ui64vNV(GLuint,const GLuint64EXT*){}
+static void null_glClearColorxOES(GLfixed,GLfixed,GLfixed,GLfixed){}
+static void null_glProgramUniformMatrix3fv(GLuint,GLint,GLsizei,GLboolean,const GLfloat*){}
+static void null_glSampleMaskIndexedNV(GLuint,GLbitfield){}
+static void null_glCompileShaderIncludeARB(GLuint,GLsizei,const GLchar*const*,const GLint*){}
+static void null_glGetArrayObjectfvATI(GLenum,GLenum,GLfloat*){}
+static void null_glVertexStream4svATI(GLenum,const GLshort*){}
+static void null_glMultiTexCoord4iARB(GLenum,GLint,GLint,GLint,GLint){}
+static void null_glVariantfvEXT(GLuint,const GLfloat*){}
+static void null_glMatrixLoadfEXT(GLenum,const GLfloat*){}
+static void null_glLoadIdentityDeformationMapSGIX(GLbitfield){}
+static void null_glGetRenderbufferParameteriv(GLenum,GLenum,GLint*){}
+static void null_glProgramUniform3fEXT(GLuint,GLint,GLfloat,GLfloat,GLfloat){}
+static void null_glNamedRenderbufferStorage(GLuint,GLenum,GLsizei,GLsizei){}
+static void null_glProgramPathFragmentInputGenNV(GLuint,GLint,GLenum,GLint,const GLfloat*){}
+static void null_glFogCoordPointerListIBM(GLenum,GLint,const void**,GLint){}
+static GLsync null_glFenceSync(GLenum,GLbitfield){return (GLsync)0;}
+static void null_glGetVertexAttribIivEXT(GLuint,GLenum,GLint*){}
+static void null_glFramebufferDrawBuffersEXT(GLuint,GLsizei,const GLenum*){}
+static void null_glVertexAttribs4fvNV(GLuint,GLsizei,const GLfloat*){}
+static void null_glPauseTransformFeedbackNV(){}
+static void null_glGetQueryObjecti64vEXT(GLuint,GLenum,GLint64*){}
+static void null_glVDPAUSurfaceAccessNV(GLvdpauSurfaceNV,GLenum){}
+static void null_glValidateProgramPipeline(GLuint){}
+static void null_glTexPageCommitmentARB(GLenum,GLint,GLint,GLint,GLint,GLsizei,GLsizei,GLsizei,GLboolean){}
+static void null_glWindowPos3dvARB(const GLdouble*){}
+static void null_glStencilStrokePathInstancedNV(GLsizei,GLenum,const void*,GLuint,GLint,GLuint,GLenum,const GLfloat*){}
+static void null_glFogfv(GLenum,const GLfloat*){}
+static void null_glGenQueriesARB(GLsizei,GLuint*){}
+static void null_glProgramUniform2i64NV(GLuint,GLint,GLint64EXT,GLint64EXT){}
+static void null_glVertexP4ui(GLenum,GLuint){}
+static void null_glVertexStream1ivATI(GLenum,const GLint*){}
+static void null_glProgramEnvParameterI4iNV(GLenum,GLuint,GLint,GLint,GLint,GLint){}
+static void null_glGenVertexArraysAPPLE(GLsizei,GLuint*){}
+static void null_glDrawTransformFeedbackInstanced(GLenum,GLuint,GLsizei){}
+static void null_glStencilThenCoverStrokePathNV(GLuint,GLint,GLuint,GLenum){}
+static void null_glDeleteVertexArraysAPPLE(GLsizei,const GLuint*){}
+static void null_glGetNamedBufferParameterui64vNV(GLuint,GLenum,GLuint64EXT*){}
+static GLbitfield null_glQueryMatrixxOES(GLfixed*,GLint*){return (GLbitfield)0;}
+static void null_glSecondaryColor3usv(const GLushort*){}
+static void null_glTranslatexOES(GLfixed,GLfixed,GLfixed){}
+static void null_glDrawTransformFeedback(GLenum,GLuint){}
+static void null_glTexCoord2fColor4fNormal3fVertex3fvSUN(const GLfloat*,const GLfloat*,const GLfloat*,const GLfloat*){}
+static GLvdpauSurfaceNV null_glVDPAURegisterVideoSurfaceNV(const void*,GLenum,GLsizei,const GLuint*){return (GLvdpauSurfaceNV)0;}
+static void null_glGetTexParameterIuiv(GLenum,GLenum,GLuint*){}
+static void null_glBindBufferBaseNV(GLenum,GLuint,GLuint){}
+static void null_glIndexPointer(GLenum,GLsizei,const GLvoid*){}
+static void null_glVertexAttrib4Nbv(GLuint,const GLbyte*){}
+static void null_glListParameteriSGIX(GLuint,GLenum,GLint){}
+static void null_glBlendColorxOES(GLfixed,GLfixed,GLfixed,GLfixed){}
+static void null_glUniformui64vNV(GLint,GLsizei,const GLuint64EXT*){}
+static GLboolean null_glIsSync(GLsync){return (GLboolean)0;}
+static void null_glGetTextureParameterivEXT(GLuint,GLenum,GLenum,GLint*){}
+static void null_glFogCoordhvNV(const GLhalfNV*){}
+static void null_glFramebufferTextureLayerEXT(GLenum,GLenum,GLuint,GLint,GLint){}
+static void null_glGetObjectPtrLabel(const void*,GLsizei,GLsizei*,GLchar*){}
+static void null_glTextureParameteri(GLuint,GLenum,GLint){}
+static void null_glMultiTexCoord1fARB(GLenum,GLfloat){}
+static void null_glUniformMatrix2x3dv(GLint,GLsizei,GLboolean,const GLdouble*){}
+static void null_glFramebufferDrawBufferEXT(GLuint,GLenum){}
+static void null_glCopyColorSubTable(GLenum,GLsizei,GLint,GLint,GLsizei){}
+static void null_glVertexAttribL3d(GLuint,GLdouble,GLdouble,GLdouble){}
+static void null_glFragmentMaterialfvSGIX(GLenum,GLenum,const GLfloat*){}
+static void null_glMatrixLoadTranspose3x3fNV(GLenum,const GLfloat*){}
+static void null_glDeleteNamesAMD(GLenum,GLuint,const GLuint*){}
+static void null_glDrawRangeElementsEXT(GLenum,GLuint,GLuint,GLsizei,GLenum,const void*){}
+static void null_glOrtho(GLdouble,GLdouble,GLdouble,GLdouble,GLdouble,GLdouble){}
+static void null_glProgramUniform1dvEXT(GLuint,GLint,GLsizei,const GLdouble*){}
+static void null_glColor4xOES(GLfixed,GLfixed,GLfixed,GLfixed){}
+static void null_glTexImage4DSGIS(GLenum,GLint,GLenum,GLsizei,GLsizei,GLsizei,GLsizei,GLint,GLenum,GLenum,const void*){}
+static void null_glProgramUniform1ui(GLuint,GLint,GLuint){}
+static void null_glDeleteBuffersARB(GLsizei,const GLuint*){}
+static GLboolean null_glUnmapBufferARB(GLenum){return (GLboolean)0;}
+static void null_glCopyTexImage2D(GLenum,GLint,GLenum,GLint,GLint,GLsizei,GLsizei,GLint){}
+static void null_glMaterialxOES(GLenum,GLenum,GLfixed){}
+static void null_glProgramUniformMatrix2x4fvEXT(GLuint,GLint,GLsizei,GLboolean,const GLfloat*){}
+static GLboolean null_glTestObjectAPPLE(GLenum,GLuint){return (GLboolean)0;}
+static void null_glRenderbufferStorageEXT(GLenum,GLenum,GLsizei,GLsizei){}
+static void null_glVertexAttribL1ui64ARB(GLuint,GLuint64EXT){}
+static void null_glEndFragmentShaderATI(){}
+static void null_glPathParameterivNV(GLuint,GLenum,const GLint*){}
+static void null_glUniform4uiv(GLint,GLsizei,const GLuint*){}
+static void null_glFrameZoomSGIX(GLint){}
+static void null_glSecondaryColor3fEXT(GLfloat,GLfloat,GLfloat){}
+static void null_glVertexAttribL1dv(GLuint,const GLdouble*){}
+static void null_glNormalStream3svATI(GLenum,const GLshort*){}
+static void null_glPathStencilFuncNV(GLenum,GLint,GLuint){}
+static void null_glSetInvariantEXT(GLuint,GLenum,const void*){}
+static void null_glGetTexBumpParameterivATI(GLenum,GLint*){}
+static void null_glBlendEquationSeparateEXT(GLenum,GLenum){}
+static void null_glEndOcclusionQueryNV(){}
+static void null_glScissorArrayv(GLuint,GLsizei,const GLint*){}
+static void null_glCallList(GLuint){}
+static void* null_glMapTexture2DINTEL(GLuint,GLint,GLbitfield,GLint*,GLenum*){return (void*)0;}
+static void null_glPixelTransferxOES(GLenum,GLfixed){}
+static void null_glDeleteRenderbuffersEXT(GLsizei,const GLuint*){}
+static void null_glTexCoord4fColor4fNormal3fVertex4fSUN(GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat){}
+static void null_glProgramUniformMatrix4dvEXT(GLuint,GLint,GLsizei,GLboolean,const GLdouble*){}
+static void null_glGetnColorTable(GLenum,GLenum,GLenum,GLsizei,void*){}
+static void null_glFramebufferTextureLayerARB(GLenum,GLenum,GLuint,GLint,GLint){}
+static void null_glVertexAttribL2dvEXT(GLuint,const GLdouble*){}
+static void null_glGetCombinerStageParameterfvNV(GLenum,GLenum,GLfloat*){}
+static void null_glMultiTexCoord1xvOES(GLenum,const GLfixed*){}
+static void* null_glMapBuffer(GLenum,GLenum){return (void*)0;}
+static void null_glSecondaryColor3d(GLdouble,GLdouble,GLdouble){}
+static void null_glSecondaryColor3f(GLfloat,GLfloat,GLfloat){}
+static void null_glVertexAttribLFormat(GLuint,GLint,GLenum,GLuint){}
+static void null_glElementPointerAPPLE(GLenum,const void*){}
+static void null_glVertexStream1fATI(GLenum,GLfloat){}
+static void null_glCoverageModulationNV(GLenum){}
+static void null_glSecondaryColor3i(GLint,GLint,GLint){}
+static void null_glDeleteSync(GLsync){}
+static void null_glGetProgramParameterfvNV(GLenum,GLuint,GLenum,GLfloat*){}
+static void null_glMaxShaderCompilerThreadsARB(GLuint){}
+static void null_glUniformMatrix4x2dv(GLint,GLsizei,GLboolean,const GLdouble*){}
+static void null_glVertexArrayVertexAttribLOffsetEXT(GLuint,GLuint,GLuint,GLint,GLenum,GLsizei,GLintptr){}
+static void null_glSecondaryColor3s(GLshort,GLshort,GLshort){}
+static GLboolean null_glIsImageHandleResidentNV(GLuint64){return (GLboolean)0;}
+static void null_glUniform3iv(GLint,GLsizei,const GLint*){}
+static void null_glVertexAttribL3i64vNV(GLuint,const GLint64EXT*){}
+static void null_glPolygonMode(GLenum,GLenum){}
+static void null_glConvolutionFilter1DEXT(GLenum,GLenum,GLsizei,GLenum,GLenum,const void*){}
+static void null_glVertexAttrib1dvARB(GLuint,const GLdouble*){}
+static void null_glTextureSubImage2DEXT(GLuint,GLenum,GLint,GLint,GLint,GLsizei,GLsizei,GLenum,GLenum,const void*){}
+static GLboolean null_glIsVertexArrayAPPLE(GLuint){return (GLboolean)0;}
+static void null_glUseProgram(GLuint){}
+static void null_glLineStipple(GLint,GLushort){}
+static void null_glMultiTexCoord4fvARB(GLenum,const GLfloat*){}
+static GLenum null_glVideoCaptureNV(GLuint,GLuint*,GLuint64EXT*){return (GLenum)0;}
+static void null_glVertexArrayVertexAttribLFormatEXT(GLuint,GLuint,GLint,GLenum,GLuint){}
+static void null_glUniform3fvARB(GLint,GLsizei,const GLfloat*){}
+static void null_glProgramUniformMatrix3x2fvEXT(GLuint,GLint,GLsizei,GLboolean,const GLfloat*){}
+static void null_glCopyTextureSubImage3DEXT(GLuint,GLenum,GLint,GLint,GLint,GLint,GLint,GLint,GLsizei,GLsizei){}
+static void null_glMultiTexCoord2bvOES(GLenum,const GLbyte*){}
+static void null_glDeleteObjectARB(GLhandleARB){}
+static void null_glTextureLightEXT(GLenum){}
+static void null_glMultiTexCoord3dARB(GLenum,GLdouble,GLdouble,GLdouble){}
+static void null_glNamedFramebufferTextureEXT(GLuint,GLenum,GLuint,GLint){}
+static void null_glTextureParameteriEXT(GLuint,GLenum,GLenum,GLint){}
+static void null_glEvalCoord2xvOES(const GLfixed*){}
+static void null_glBindVideoCaptureStreamBufferNV(GLuint,GLuint,GLenum,GLintptrARB){}
+static void null_glTexImage2DMultisampleCoverageNV(GLenum,GLsizei,GLsizei,GLint,GLsizei,GLsizei,GLboolean){}
+static GLint null_glGetAttribLocationARB(GLhandleARB,const GLcharARB*){return (GLint)0;}
+static void null_glDeleteShader(GLuint){}
+static void null_glVertexAttrib1fARB(GLuint,GLfloat){}
+static void null_glTexCoord2fColor4ubVertex3fSUN(GLfloat,GLfloat,GLubyte,GLubyte,GLubyte,GLubyte,GLfloat,GLfloat,GLfloat){}
+static void null_glTexCoord4fVertex4fSUN(GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat){}
+static void null_glGetMapdv(GLenum,GLenum,GLdouble*){}
+static void null_glMapParameterfvNV(GLenum,GLenum,const GLfloat*){}
+static void null_glTextureParameterIuiv(GLuint,GLenum,const GLuint*){}
+static void null_glTransformFeedbackAttribsNV(GLsizei,const GLint*,GLenum){}
+static void null_glFragmentLightfvSGIX(GLenum,GLenum,const GLfloat*){}
+static void null_glWindowPos3sARB(GLshort,GLshort,GLshort){}
+static void null_glGetConvolutionParameterfv(GLenum,GLenum,GLfloat*){}
+static void null_glCopyTexSubImage3D(GLenum,GLint,GLint,GLint,GLint,GLint,GLint,GLsizei,GLsizei){}
+static void null_glVertexAttribI3i(GLuint,GLint,GLint,GLint){}
+static GLhandleARB null_glCreateShaderObjectARB(GLenum){return (GLhandleARB)0;}
+static void null_glVertexAttribFormat(GLuint,GLint,GLenum,GLboolean,GLuint){}
+static void null_glGetProgramivARB(GLenum,GLenum,GLint*){}
+static void null_glVertexAttribI4usv(GLuint,const GLushort*){}
+static void null_glTexParameterf(GLenum,GLenum,GLfloat){}
+static void null_glVertexAttribBinding(GLuint,GLuint){}
+static void null_glGetHistogramParameteriv(GLenum,GLenum,GLint*){}
+static void null_glTexParameteri(GLenum,GLenum,GLint){}
+static void null_glGetShaderSource(GLuint,GLsizei,GLsizei*,GLchar*){}
+static void null_glVertexAttrib4s(GLuint,GLshort,GLshort,GLshort,GLshort){}
+static void null_glVertexAttrib4dvNV(GLuint,const GLdouble*){}
+static void null_glVertexAttrib1dvNV(GLuint,const GLdouble*){}
+static void null_glPopName(){}
+static void null_glTextureBufferEXT(GLuint,GLenum,GLenum,GLuint){}
+static void null_glGetMultiTexImageEXT(GLenum,GLenum,GLint,GLenum,GLenum,void*){}
+static void null_glGetPointerIndexedvEXT(GLenum,GLuint,void**){}
+static GLboolean null_glIsNameAMD(GLenum,GLuint){return (GLboolean)0;}
+static void null_glColor4ub(GLubyte,GLubyte,GLubyte,GLubyte){}
+static void null_glBufferParameteriAPPLE(GLenum,GLenum,GLint){}
+static void null_glColor4ui(GLuint,GLuint,GLuint,GLuint){}
+static void null_glGetInternalformativ(GLenum,GLenum,GLenum,GLsizei,GLint*){}
+static void null_glColor4us(GLushort,GLushort,GLushort,GLushort){}
+static void null_glVertexAttribP1uiv(GLuint,GLenum,GLboolean,const GLuint*){}
+static void null_glLinkProgram(GLuint){}
+static void null_glTexCoord3s(GLshort,GLshort,GLshort){}
+static void null_glTexCoord2dv(const GLdouble*){}
+static void null_glGetObjectLabel(GLenum,GLuint,GLsizei,GLsizei*,GLchar*){}
+static void null_glVertexPointerEXT(GLint,GLenum,GLsizei,GLsizei,const void*){}
+static void null_glDebugMessageCallbackARB(GLDEBUGPROCARB,const void*){}
+static const GLubyte* null_glGetString(GLenum){return (const GLubyte*)0;}
+static void null_glGetPathParameterfvNV(GLuint,GLenum,GLfloat*){}
+static void null_glLightxvOES(GLenum,GLenum,const GLfixed*){}
+static void null_glEndQuery(GLenum){}
+static void null_glSecondaryColor3uiv(const GLuint*){}
+static void null_glPrioritizeTexturesxOES(GLsizei,const GLuint*,const GLfixed*){}
+static void null_glEdgeFlagPointer(GLsizei,const GLvoid*){}
+static void null_glFramebufferParameteri(GLenum,GLenum,GLint){}
+static void null_glTexCoord3hNV(GLhalfNV,GLhalfNV,GLhalfNV){}
+static void null_glMultiModeDrawElementsIBM(const GLenum*,const GLsizei*,GLenum,const void*const*,GLsizei,GLint){}
+static void null_glCopyPixels(GLint,GLint,GLsizei,GLsizei,GLenum){}
+static void null_glVertexAttribI2ui(GLuint,GLuint,GLuint){}
+static void null_glClampColorARB(GLenum,GLenum){}
+static void null_glColorPointervINTEL(GLint,GLenum,const void**){}
+static void null_glDeleteTextures(GLsizei,const GLuint*){}
+static void null_glGetMinmaxParameterfvEXT(GLenum,GLenum,GLfloat*){}
+static void null_glWindowPos3sMESA(GLshort,GLshort,GLshort){}
+static void null_glVertexAttrib4f(GLuint,GLfloat,GLfloat,GLfloat,GLfloat){}
+static void null_glNamedFramebufferParameteri(GLuint,GLenum,GLint){}
+static void null_glTexCoord2fVertex3fvSUN(const GLfloat*,const GLfloat*){}
+static void null_glReplacementCodeusSUN(GLushort){}
+static void null_glGetNamedFramebufferParameteriv(GLuint,GLenum,GLint*){}
+static void null_glVertexStream1fvATI(GLenum,const GLfloat*){}
+static void null_glCreateVertexArrays(GLsizei,GLuint*){}
+static void null_glBeginConditionalRender(GLuint,GLenum){}
+static void null_glConvolutionFilter1D(GLenum,GLenum,GLsizei,GLenum,GLenum,const GLvoid*){}
+static void null_glMultiTexCoord3fARB(GLenum,GLfloat,GLfloat,GLfloat){}
+static void null_glGetQueryObjectuivARB(GLuint,GLenum,GLuint*){}
+static void null_glScalexOES(GLfixed,GLfixed,GLfixed){}
+static void null_glSamplerParameteri(GLuint,GLenum,GLint){}
+static void null_glSamplerParameterf(GLuint,GLenum,GLfloat){}
+static void null_glShaderOp1EXT(GLenum,GLuint,GLuint){}
+static void null_glBeginVideoCaptureNV(GLuint){}
+static void null_glGetnHistogram(GLenum,GLboolean,GLenum,GLenum,GLsizei,void*){}
+static void null_glUniform1d(GLint,GLdouble){}
+static GLint null_glRenderMode(GLenum){return (GLint)0;}
+static void null_glClearColorIiEXT(GLint,GLint,GLint,GLint){}
+static void null_glGetCompressedTexImage(GLenum,GLint,GLvoid*){}
+static void null_glCompressedTextureImage1DEXT(GLuint,GLenum,GLint,GLenum,GLsizei,GLint,GLsizei,const void*){}
+static void null_glGetActiveUniformBlockiv(GLuint,GLuint,GLenum,GLint*){}
+static void null_glUniform1i(GLint,GLint){}
+static void null_glGetTexEnvfv(GLenum,GLenum,GLfloat*){}
+static void null_glColorTableParameterivSGI(GLenum,GLenum,const GLint*){}
+static void null_glCullFace(GLenum){}
+static void null_glDeleteFencesAPPLE(GLsizei,const GLuint*){}
+static void null_glProgramUniform4i(GLuint,GLint,GLint,GLint,GLint,GLint){}
+static void null_glUniformHandleui64ARB(GLint,GLuint64){}
+static void null_glProgramUniform4f(GLuint,GLint,GLfloat,GLfloat,GLfloat,GLfloat){}
+static void null_glViewportIndexedf(GLuint,GLfloat,GLfloat,GLfloat,GLfloat){}
+static void null_glProgramUniform4d(GLuint,GLint,GLdouble,GLdouble,GLdouble,GLdouble){}
+static void null_glTexCoord1xOES(GLfixed){}
+static void null_glVertexStream3ivATI(GLenum,const GLint*){}
+static const GLubyte* null_glGetStringi(GLenum,GLuint){return (const GLubyte*)0;}
+static void null_glEndQueryARB(GLenum){}
+static void null_glVDPAUMapSurfacesNV(GLsizei,const GLvdpauSurfaceNV*){}
+static void null_glVertex3i(GLint,GLint,GLint){}
+static void null_glVertexAttrib4uivARB(GLuint,const GLuint*){}
+static void null_glResumeTransformFeedbackNV(){}
+static void null_glAttachShader(GLuint,GLuint){}
+static void null_glColor4hNV(GLhalfNV,GLhalfNV,GLhalfNV,GLhalfNV){}
+static void null_glGetFenceivNV(GLuint,GLenum,GLint*){}
+static void null_glTexCoord2fColor4ubVertex3fvSUN(const GLfloat*,const GLubyte*,const GLfloat*){}
+static void null_glGetColorTable(GLenum,GLenum,GLenum,GLvoid*){}
+static void null_glFogCoordPointer(GLenum,GLsizei,const void*){}
+static void null_glTexStorageSparseAMD(GLenum,GLenum,GLsizei,GLsizei,GLsizei,GLsizei,GLbitfield){}
+static GLboolean null_glUnmapNamedBuffer(GLuint){return (GLboolean)0;}
+static void null_glTexCoord4bvOES(const GLbyte*){}
+static void null_glVertexAttrib3fARB(GLuint,GLfloat,GLfloat,GLfloat){}
+static void null_glRasterPos2xOES(GLfixed,GLfixed){}
+static void null_glColor4ubVertex2fvSUN(const GLubyte*,const GLfloat*){}
+static void null_glSecondaryColor3dv(const GLdouble*){}
+static void null_glVertexAttribI4sv(GLuint,const GLshort*){}
+static void null_glDrawTransformFeedbackStreamInstanced(GLenum,GLuint,GLuint,GLsizei){}
+static void null_glMultiTexCoord4ivARB(GLenum,const GLint*){}
+static void null_glSpriteParameterfSGIX(GLenum,GLfloat){}
+static void null_glSecondaryColor3sv(const GLshort*){}
+static void null_glBindVideoCaptureStreamTextureNV(GLuint,GLuint,GLenum,GLenum,GLuint){}
+static void null_glTexParameterIuiv(GLenum,GLenum,const GLuint*){}
+static void null_glFlushPixelDataRangeNV(GLenum){}
+static void null_glWindowPos3fv(const GLfloat*){}
+static void null_glVertexAttribLFormatNV(GLuint,GLint,GLenum,GLsizei){}
+static void null_glLightModelfv(GLenum,const GLfloat*){}
+static void null_glGetColorTableSGI(GLenum,GLenum,GLenum,void*){}
+static void null_glGetCompressedTexImageARB(GLenum,GLint,void*){}
+static void null_glConvolutionParameteri(GLenum,GLenum,GLint){}
+static void null_glVertexWeighthNV(GLhalfNV){}
+static void null_glColorMaskIndexedEXT(GLuint,GLboolean,GLboolean,GLboolean,GLboolean){}
+static void null_glColorMaski(GLuint,GLboolean,GLboolean,GLboolean,GLboolean){}
+static void null_glColorFragmentOp1ATI(GLenum,GLuint,GLuint,GLuint,GLuint,GLuint,GLuint){}
+static void null_glVertexAttribI4ubvEXT(GLuint,const GLubyte*){}
+static void null_glVertexAttrib1dNV(GLuint,GLdouble){}
+static void null_glUnmapObjectBufferATI(GLuint){}
+static void null_glNamedProgramLocalParameterI4uiEXT(GLuint,GLenum,GLuint,GLuint,GLuint,GLuint,GLuint){}
+static void null_glProgramUniform1iEXT(GLuint,GLint,GLint){}
+static void null_glDeleteQueriesARB(GLsizei,const GLuint*){}
+static void null_glWindowPos3svARB(const GLshort*){}
+static void null_glVertex4s(GLshort,GLshort,GLshort,GLshort){}
+static void null_glStringMarkerGREMEDY(GLsizei,const void*){}
+static GLboolean null_glIsTransformFeedback(GLuint){return (GLboolean)0;}
+static void null_glProgramUniformMatrix2x3dvEXT(GLuint,GLint,GLsizei,GLboolean,const GLdouble*){}
+static void null_glGetObjectLabelEXT(GLenum,GLuint,GLsizei,GLsizei*,GLchar*){}
+static void null_glUniformHandleui64vNV(GLint,GLsizei,const GLuint64*){}
+static void null_glRotated(GLdouble,GLdouble,GLdouble,GLdouble){}
+static GLboolean null_glIsProgramPipeline(GLuint){return (GLboolean)0;}
+static void null_glRotatef(GLfloat,GLfloat,GLfloat,GLfloat){}
+static void null_glVertex4i(GLint,GLint,GLint,GLint){}
+static void null_glGetActiveSubroutineUniformName(GLuint,GLenum,GLuint,GLsizei,GLsizei*,GLchar*){}
+static void null_glVertexAttrib4sNV(GLuint,GLshort,GLshort,GLshort,GLshort){}
+static void null_glProgramLocalParameter4dvARB(GLenum,GLuint,const GLdouble*){}
+static void null_glReplacementCodeubSUN(GLubyte){}
+static void null_glMultiDrawElementsIndirectBindlessNV(GLenum,GLenum,const void*,GLsizei,GLsizei,GLint){}
+static void null_glUniformMatrix3fv(GLint,GLsizei,GLboolean,const GLfloat*){}
+static void null_glGetnMapfvARB(GLenum,GLenum,GLsizei,GLfloat*){}
+static void null_glGetnUniformfv(GLuint,GLint,GLsizei,GLfloat*){}
+static void null_glVertexAttribL2dv(GLuint,const GLdouble*){}
+static void null_glVertexWeightPointerEXT(GLint,GLenum,GLsizei,const void*){}
+static void null_glTangent3sEXT(GLshort,GLshort,GLshort){}
+static void null_glSecondaryColorPointer(GLint,GLenum,GLsizei,const void*){}
+static void null_glAlphaFunc(GLenum,GLclampf){}
+static void null_glGetNamedStringARB(GLint,const GLchar*,GLsizei,GLint*,GLchar*){}
+static void null_glTexCoord4d(GLdouble,GLdouble,GLdouble,GLdouble){}
+static void null_glBufferPageCommitmentARB(GLenum,GLintptr,GLsizeiptr,GLboolean){}
+static void null_glProgramLocalParameters4fvEXT(GLenum,GLuint,GLsizei,const GLfloat*){}
+static void null_glStencilFunc(GLenum,GLint,GLuint){}
+static void null_glGetVertexAttribdvNV(GLuint,GLenum,GLdouble*){}
+static void null_glTexCoord3dv(const GLdouble*){}
+static void null_glGetQueryBufferObjectiv(GLuint,GLuint,GLenum,GLintptr){}
+static void null_glTexGenxOES(GLenum,GLenum,GLfixed){}
+static void null_glMultiTexCoord1fvARB(GLenum,const GLfloat*){}
+static void null_glLightEnviSGIX(GLenum,GLint){}
+static void null_glGetProgramPipelineiv(GLuint,GLenum,GLint*){}
+static void null_glVertexStream2ivATI(GLenum,const GLint*){}
+static void null_glGetColorTableEXT(GLenum,GLenum,GLenum,void*){}
+static void null_glGetShaderInfoLog(GLuint,GLsizei,GLsizei*,GLchar*){}
+static void null_glGetOcclusionQueryuivNV(GLuint,GLenum,GLuint*){}
+static void null_glInvalidateNamedFramebufferSubData(GLuint,GLsizei,const GLenum*,GLint,GLint,GLsizei,GLsizei){}
+static void null_glVertexAttribL1i64NV(GLuint,GLint64EXT){}
+static void null_glVDPAUInitNV(const void*,const void*){}
+static void null_glVertexAttrib1hvNV(GLuint,const GLhalfNV*){}
+static void null_glVertexAttribI4i(GLuint,GLint,GLint,GLint,GLint){}
+static void null_glRasterPos2iv(const GLint*){}
+static void null_glGetIntegerui64i_vNV(GLenum,GLuint,GLuint64EXT*){}
+static void null_glUniformHandleui64NV(GLint,GLuint64){}
+static void null_glWindowPos3ivMESA(const GLint*){}
+static void null_glBlendEquationSeparate(GLenum,GLenum){}
+static void null_glDrawElementsInstancedARB(GLenum,GLsizei,GLenum,const void*,GLsizei){}
+static GLuint null_glGetSubroutineIndex(GLuint,GLenum,const GLchar*){return (GLuint)0;}
+static void null_glVertexAttrib2sv(GLuint,const GLshort*){}
+static void null_glSamplePatternSGIS(GLenum){}
+static void null_glEGLImageTargetRenderbufferStorageOES(GLenum,GLeglImageOES){}
+static void null_glPushAttrib(GLbitfield){}
+static void null_glVertex3hNV(GLhalfNV,GLhalfNV,GLhalfNV){}
+static void null_glRasterPos3xvOES(const GLfixed*){}
+static void null_glPathParameterfNV(GLuint,GLenum,GLfloat){}
+static void null_glGetUniformi64vNV(GLuint,GLint,GLint64EXT*){}
+static void null_glLightiv(GLenum,GLenum,const GLint*){}
+static void null_glMaterialxvOES(GLenum,GLenum,const GLfixed*){}
+static void null_glNamedProgramLocalParameter4fEXT(GLuint,GLenum,GLuint,GLfloat,GLfloat,GLfloat,GLfloat){}
+static void null_glVertexAttribL1dEXT(GLuint,GLdouble){}
+static void null_glGetnUniformdvARB(GLuint,GLint,GLsizei,GLdouble*){}
+static void null_glSecondaryColor3bEXT(GLbyte,GLbyte,GLbyte){}
+static void null_glBeginPerfQueryINTEL(GLuint){}
+static void null_glProgramUniform1uivEXT(GLuint,GLint,GLsizei,const GLuint*){}
+static void null_glImageTransformParameterivHP(GLenum,GLenum,const GLint*){}
+static void null_glDeleteBuffers(GLsizei,const GLuint*){}
+static void null_glBindProgramPipeline(GLuint){}
+static void null_glScissor(GLint,GLint,GLsizei,GLsizei){}
+static void null_glProgramUniform4fv(GLuint,GLint,GLsizei,const GLfloat*){}
+static void null_glGetBooleanv(GLenum,GLboolean*){}
+static void null_glMaterialfv(GLenum,GLenum,const GLfloat*){}
+static void null_glWindowPos4fvMESA(const GLfloat*){}
+static void null_glVertexAttribIPointerEXT(GLuint,GLint,GLenum,GLsizei,const void*){}
+static void null_glProgramBufferParametersfvNV(GLenum,GLuint,GLuint,GLsizei,const GLfloat*){}
+static void null_glAlphaFuncxOES(GLenum,GLfixed){}
+static void null_glMultiDrawArraysIndirectAMD(GLenum,const void*,GLsizei,GLsizei){}
+static void null_glNormalStream3ivATI(GLenum,const GLint*){}
+static void null_glTextureImage3DMultisampleNV(GLuint,GLenum,GLsizei,GLint,GLsizei,GLsizei,GLsizei,GLboolean){}
+static void null_glProgramUniform4uivEXT(GLuint,GLint,GLsizei,const GLuint*){}
+static void null_glReplacementCodeusvSUN(const GLushort*){}
+static GLint null_glPollInstrumentsSGIX(GLint*){return (GLint)0;}
+static void null_glGetTextureLevelParameteriv(GLuint,GLint,GLenum,GLint*){}
+static void null_glVertexAttribI2uiv(GLuint,const GLuint*){}
+static void null_glMapControlPointsNV(GLenum,GLuint,GLenum,GLsizei,GLsizei,GLint,GLint,GLboolean,const void*){}
+static void null_glColor4dv(const GLdouble*){}
+static void null_glInvalidateBufferSubData(GLuint,GLintptr,GLsizeiptr){}
+static void null_glMultiTexCoord1hNV(GLenum,GLhalfNV){}
+static void null_glPointParameterfv(GLenum,const GLfloat*){}
+static void null_glUniformMatrix2fvARB(GLint,GLsizei,GLboolean,const GLfloat*){}
+static void null_glUniform2fv(GLint,GLsizei,const GLfloat*){}
+static void null_glVertexPointerListIBM(GLint,GLenum,GLint,const void**,GLint){}
+static void null_glGetMultiTexGenfvEXT(GLenum,GLenum,GLenum,GLfloat*){}
+static void null_glGetMinmaxEXT(GLenum,GLboolean,GLenum,GLenum,void*){}
+static GLboolean null_glIsFenceNV(GLuint){return (GLboolean)0;}
+static void null_glMatrixFrustumEXT(GLenum,GLdouble,GLdouble,GLdouble,GLdouble,GLdouble,GLdouble){}
+static void null_glDispatchComputeIndirect(GLintptr){}
+static void null_glMultiTexCoord4bOES(GLenum,GLbyte,GLbyte,GLbyte,GLbyte){}
+static void null_glProgramEnvParameter4dARB(GLenum,GLuint,GLdouble,GLdouble,GLdouble,GLdouble){}
+static void null_glProgramUniform1uiEXT(GLuint,GLint,GLuint){}
+static void null_glBindBufferRange(GLenum,GLuint,GLuint,GLintptr,GLsizeiptr){}
+static void null_glNormal3iv(const GLint*){}
+static void null_glVertexAttribL3dv(GLuint,const GLdouble*){}
+static void null_glGetUniformdv(GLuint,GLint,GLdouble*){}
+static void null_glGetMultiTexLevelParameterfvEXT(GLenum,GLenum,GLint,GLenum,GLfloat*){}
+static void null_glFinalCombinerInputNV(GLenum,GLenum,GLenum,GLenum){}
+static void null_glCullParameterdvEXT(GLenum,GLdouble*){}
+static void null_glMultiTexCoord4s(GLenum,GLshort,GLshort,GLshort,GLshort){}
+static void null_glMapVertexAttrib1fAPPLE(GLuint,GLuint,GLfloat,GLfloat,GLint,GLint,const GLfloat*){}
+static void null_glConvolutionParameterfEXT(GLenum,GLenum,GLfloat){}
+static void null_glTexCoord1iv(const GLint*){}
+static void null_glProgramUniform3fvEXT(GLuint,GLint,GLsizei,const GLfloat*){}
+static void null_glColor3uiv(const GLuint*){}
+static void null_glListBase(GLuint){}
+static void null_glTexCoord2bOES(GLbyte,GLbyte){}
+static GLuint null_glBindMaterialParameterEXT(GLenum,GLenum){return (GLuint)0;}
+static void null_glGlobalAlphaFactorubSUN(GLubyte){}
+static void null_glVertexAttribL1ui64NV(GLuint,GLuint64EXT){}
+static void null_glPointParameterfSGIS(GLenum,GLfloat){}
+static void null_glGetImageTransformParameterivHP(GLenum,GLenum,GLint*){}
+static void null_glColorSubTableEXT(GLenum,GLsizei,GLsizei,GLenum,GLenum,const void*){}
+static void null_glPixelTexGenParameterfvSGIS(GLenum,const GLfloat*){}
+static GLenum null_glClientWaitSync(GLsync,GLbitfield,GLuint64){return (GLenum)0;}
+static void null_glQueryObjectParameteruiAMD(GLenum,GLuint,GLenum,GLuint){}
+static void null_glVertexAttribs1fvNV(GLuint,GLsizei,const GLfloat*){}
+static void null_glVertexAttrib4NusvARB(GLuint,const GLushort*){}
+static void null_glVariantPointerEXT(GLuint,GLenum,GLuint,const void*){}
+static void null_glTextureBuffer(GLuint,GLenum,GLuint){}
+static void null_glVertexAttribI1uiEXT(GLuint,GLuint){}
+static void null_glInvalidateTexImage(GLuint,GLint){}
+static void null_glProgramEnvParametersI4ivNV(GLenum,GLuint,GLsizei,const GLint*){}
+static GLenum null_glPathGlyphIndexArrayNV(GLuint,GLenum,const void*,GLbitfield,GLuint,GLsizei,GLuint,GLfloat){return (GLenum)0;}
+static void null_glCopyImageSubData(GLuint,GLenum,GLint,GLint,GLint,GLint,GLuint,GLenum,GLint,GLint,GLint,GLint,GLsizei,GLsizei,GLsizei){}
+static void null_glGetUniformSubroutineuiv(GLenum,GLint,GLuint*){}
+static void null_glBindVertexBuffer(GLuint,GLuint,GLintptr,GLsizei){}
+static void null_glMultiTexCoord1iARB(GLenum,GLint){}
+static void null_glDebugMessageInsert(GLenum,GLenum,GLuint,GLenum,GLsizei,const GLchar*){}
+static void null_glBeginVertexShaderEXT(){}
+static GLboolean null_glIsVariantEnabledEXT(GLuint,GLenum){return (GLboolean)0;}
+static void null_glPassThroughxOES(GLfixed){}
+static GLboolean null_glIsSampler(GLuint){return (GLboolean)0;}
+static void null_glConservativeRasterParameterfNV(GLenum,GLfloat){}
+static void null_glMultiTexGenivEXT(GLenum,GLenum,GLenum,const GLint*){}
+static void null_glNamedFramebufferTexture2DEXT(GLuint,GLenum,GLenum,GLuint,GLint){}
+static void null_glCopyTexSubImage1D(GLenum,GLint,GLint,GLint,GLint,GLsizei){}
+static void null_glTexCoord1i(GLint){}
+static GLenum null_glCheckFramebufferStatus(GLenum){return (GLenum)0;}
+static void null_glDrawElementArrayAPPLE(GLenum,GLint,GLsizei){}
+static void null_glTexCoord1d(GLdouble){}
+static void null_glTexCoord1f(GLfloat){}
+static void null_glFragmentLightivSGIX(GLenum,GLenum,const GLint*){}
+static void null_glBindImageTexture(GLuint,GLuint,GLint,GLboolean,GLint,GLenum,GLenum){}
+static void null_glTransformFeedbackVaryings(GLuint,GLsizei,const GLchar*const*,GLenum){}
+static void null_glDrawRangeElements(GLenum,GLuint,GLuint,GLsizei,GLenum,const GLvoid*){}
+static void null_glTexCoord1s(GLshort){}
+static void null_glBindBufferBase(GLenum,GLuint,GLuint){}
+static void null_glColor3bv(const GLbyte*){}
+static void null_glSyncTextureINTEL(GLuint){}
+static void null_glCreateSamplers(GLsizei,GLuint*){}
+static void null_glCombinerParameterfNV(GLenum,GLfloat){}
+static void null_glGetArrayObjectivATI(GLenum,GLenum,GLint*){}
+static void null_glMultiDrawArrays(GLenum,const GLint*,const GLsizei*,GLsizei){}
+static void null_glSampleMapATI(GLuint,GLuint,GLenum){}
+static void null_glProgramUniform2i64ARB(GLuint,GLint,GLint64,GLint64){}
+static void null_glBinormal3ivEXT(const GLint*){}
+static void null_glMultiDrawArraysIndirectCountARB(GLenum,GLintptr,GLintptr,GLsizei,GLsizei){}
+static void null_glUniformBufferEXT(GLuint,GLint,GLuint){}
+static void null_glWindowPos2ivMESA(const GLint*){}
+static void null_glTexCoordP4ui(GLenum,GLuint){}
+static void null_glMultiTexSubImage1DEXT(GLenum,GLenum,GLint,GLint,GLsizei,GLenum,GLenum,const void*){}
+static void null_glProgramUniformMatrix2x3fvEXT(GLuint,GLint,GLsizei,GLboolean,const GLfloat*){}
+static void null_glBufferDataARB(GLenum,GLsizeiptrARB,const void*,GLenum){}
+static void null_glVertexAttribIFormat(GLuint,GLint,GLenum,GLuint){}
+static void null_glCreateFramebuffers(GLsizei,GLuint*){}
+static void null_glNormalStream3dvATI(GLenum,const GLdouble*){}
+static void null_glClearAccum(GLfloat,GLfloat,GLfloat,GLfloat){}
+static void null_glUniform3i64vNV(GLint,GLsizei,const GLint64EXT*){}
+static void null_glNormal3fVertex3fSUN(GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat){}
+static void null_glUniform2uivEXT(GLint,GLsizei,const GLuint*){}
+static void null_glBeginQuery(GLenum,GLuint){}
+static void null_glStencilThenCoverStrokePathInstancedNV(GLsizei,GLenum,const void*,GLuint,GLint,GLuint,GLenum,GLenum,const GLfloat*){}
+static void null_glBindBuffer(GLenum,GLuint){}
+static void null_glMap2d(GLenum,GLdouble,GLdouble,GLint,GLint,GLdouble,GLdouble,GLint,GLint,const GLdouble*){}
+static void null_glMap2f(GLenum,GLfloat,GLfloat,GLint,GLint,GLfloat,GLfloat,GLint,GLint,const GLfloat*){}
+static void null_glMakeImageHandleResidentNV(GLuint64,GLenum){}
+static void null_glUniformMatrix2x4fv(GLint,GLsizei,GLboolean,const GLfloat*){}
+static void null_glGetMultiTexParameterfvEXT(GLenum,GLenum,GLenum,GLfloat*){}
+static void null_glDepthRangeIndexed(GLuint,GLdouble,GLdouble){}
+static void null_glMultiTexCoord1s(GLenum,GLshort){}
+static void null_glMatrixScalefEXT(GLenum,GLfloat,GLfloat,GLfloat){}
+static GLenum null_glGetError(){return (GLenum)0;}
+static void null_glGetTexEnviv(GLenum,GLenum,GLint*){}
+static GLuint null_glBindTextureUnitParameterEXT(GLenum,GLenum){return (GLuint)0;}
+static void null_glGetnUniformfvARB(GLuint,GLint,GLsizei,GLfloat*){}
+static void null_glReplacementCodeuiNormal3fVertex3fvSUN(const GLuint*,const GLfloat*,const GLfloat*){}
+static void null_glDeletePerfQueryINTEL(GLuint){}
+static void null_glActiveVaryingNV(GLuint,const GLchar*){}
+static void null_glGetActiveUniformARB(GLhandleARB,GLuint,GLsizei,GLsizei*,GLint*,GLenum*,GLcharARB*){}
+static void null_glVertexAttribI3ivEXT(GLuint,const GLint*){}
+static void null_glEvalCoord1d(GLdouble){}
+static void null_glNamedCopyBufferSubDataEXT(GLuint,GLuint,GLintptr,GLintptr,GLsizeiptr){}
+static void null_glEvalCoord1f(GLfloat){}
+static void null_glPixelMapfv(GLenum,GLsizei,const GLfloat*){}
+static void null_glVertexAttribI1ivEXT(GLuint,const GLint*){}
+static GLsync null_glCreateSyncFromCLeventARB(struct _cl_context*,struct _cl_event*,GLbitfield){return (GLsync)0;}
+static void null_glGetPixelMapusv(GLenum,GLushort*){}
+static void null_glGetnColorTableARB(GLenum,GLenum,GLenum,GLsizei,void*){}
+static void null_glAccum(GLenum,GLfloat){}
+static void null_glRasterPos3sv(const GLshort*){}
+static void null_glTexCoord2iv(const GLint*){}
+static void null_glBlendFunciARB(GLuint,GLenum,GLenum){}
+static void null_glProgramUniform3i64vARB(GLuint,GLint,GLsizei,const GLint64*){}
+static void null_glGetFramebufferAttachmentParameteriv(GLenum,GLenum,GLenum,GLint*){}
+static void null_glProgramUniform4ui(GLuint,GLint,GLuint,GLuint,GLuint,GLuint){}
+static void null_glStencilMask(GLuint){}
+static void null_glResetHistogramEXT(GLenum){}
+static void null_glLightxOES(GLenum,GLenum,GLfixed){}
+static void null_glNamedBufferData(GLuint,GLsizeiptr,const void*,GLenum){}
+static void null_glVertexStream3sATI(GLenum,GLshort,GLshort,GLshort){}
+static void null_glVertexAttrib3fvARB(GLuint,const GLfloat*){}
+static void null_glClearNamedBufferSubData(GLuint,GLenum,GLintptr,GLsizeiptr,GLenum,GLenum,const void*){}
+static void null_glProgramUniformHandleui64ARB(GLuint,GLint,GLuint64){}
+static void null_glUniform3iARB(GLint,GLint,GLint,GLint){}
+static GLhandleARB null_glCreateProgramObjectARB(){return (GLhandleARB)0;}
+static void null_glMultiTexCoord1dvARB(GLenum,const GLdouble*){}
+static void null_glGetObjectParameterfvARB(GLhandleARB,GLenum,GLfloat*){}
+static void null_glRectsv(const GLshort*,const GLshort*){}
+static void null_glMultiTexImage2DEXT(GLenum,GLenum,GLint,GLint,GLsizei,GLsizei,GLint,GLenum,GLenum,const void*){}
+static void null_glProgramUniform1i64NV(GLuint,GLint,GLint64EXT){}
+static void null_glGetObjectBufferivATI(GLuint,GLenum,GLint*){}
+static void null_glUniform4i64ARB(GLint,GLint64,GLint64,GLint64,GLint64){}
+static void null_glReplacementCodeuiColor4ubVertex3fvSUN(const GLuint*,const GLubyte*,const GLfloat*){}
+static void null_glBlendFuncSeparateINGR(GLenum,GLenum,GLenum,GLenum){}
+static void null_glGetVideoCaptureStreamfvNV(GLuint,GLuint,GLenum,GLfloat*){}
+static void null_glVertexAttrib2fARB(GLuint,GLfloat,GLfloat){}
+static void null_glGetTexGeniv(GLenum,GLenum,GLint*){}
+static void null_glPixelStorei(GLenum,GLint){}
+static void null_glGetCompressedTextureSubImage(GLuint,GLint,GLint,GLint,GLint,GLsizei,GLsizei,GLsizei,GLsizei,void*){}
+static void null_glCopyImageSubDataNV(GLuint,GLenum,GLint,GLint,GLint,GLint,GLuint,GLenum,GLint,GLint,GLint,GLint,GLsizei,GLsizei,GLsizei){}
+static void null_glActiveShaderProgram(GLuint,GLuint){}
+static void null_glVertexStream1iATI(GLenum,GLint){}
+static void null_glPatchParameterfv(GLenum,const GLfloat*){}
+static GLboolean null_glIsFramebufferEXT(GLuint){return (GLboolean)0;}
+static void null_glTextureStorage2D(GLuint,GLsizei,GLenum,GLsizei,GLsizei){}
+static void null_glProgramUniform1ui64ARB(GLuint,GLint,GLuint64){}
+static void null_glTexBufferRange(GLenum,GLenum,GLuint,GLintptr,GLsizeiptr){}
+static void null_glGetPixelTexGenParameterivSGIS(GLenum,GLint*){}
+static void null_glTextureSubImage3DEXT(GLuint,GLenum,GLint,GLint,GLint,GLint,GLsizei,GLsizei,GLsizei,GLenum,GLenum,const void*){}
+static void null_glClipControl(GLenum,GLenum){}
+static void null_glGetProgramResourceiv(GLuint,GLenum,GLuint,GLsizei,const GLenum*,GLsizei,GLsizei*,GLint*){}
+static void null_glMultiTexCoordP2uiv(GLenum,GLenum,const GLuint*){}
+static void null_glVertexAttribI3ui(GLuint,GLuint,GLuint,GLuint){}
+static void null_glSampleMaskSGIS(GLclampf,GLboolean){}
+static void null_glVertexAttrib4NivARB(GLuint,const GLint*){}
+static void null_glGlobalAlphaFactorfSUN(GLfloat){}
+static void null_glBlendEquationSeparateIndexedAMD(GLuint,GLenum,GLenum){}
+static void null_glGetPerfCounterInfoINTEL(GLuint,GLuint,GLuint,GLchar*,GLuint,GLchar*,GLuint*,GLuint*,GLuint*,GLuint*,GLuint64*){}
+static void null_glDeleteProgramsNV(GLsizei,const GLuint*){}
+static void null_glPixelZoomxOES(GLfixed,GLfixed){}
+static void null_glGetCombinerOutputParameterivNV(GLenum,GLenum,GLenum,GLint*){}
+static void null_glRasterPos2xvOES(const GLfixed*){}
+static void null_glGetTexImage(GLenum,GLint,GLenum,GLenum,GLvoid*){}
+static void null_glVertexArrayVertexBuffers(GLuint,GLuint,GLsizei,const GLuint*,const GLintptr*,const GLsizei*){}
+static void null_glUniform1ui64NV(GLint,GLuint64EXT){}
+static void null_glProgramParameteri(GLuint,GLenum,GLint){}
+static void null_glNormal3xOES(GLfixed,GLfixed,GLfixed){}
+static void null_glGetMapfv(GLenum,GLenum,GLfloat*){}
+static void null_glVertexStream2dvATI(GLenum,const GLdouble*){}
+static void null_glPathStencilDepthOffsetNV(GLfloat,GLfloat){}
+static GLboolean null_glIsStateNV(GLuint){return (GLboolean)0;}
+static void null_glGetIntegerui64vNV(GLenum,GLuint64EXT*){}
+static void null_glGetImageTransformParameterfvHP(GLenum,GLenum,GLfloat*){}
+static void null_glRasterPos2fv(const GLfloat*){}
+static void null_glVertex3xOES(GLfixed,GLfixed){}
+static void null_glProgramUniform2dvEXT(GLuint,GLint,GLsizei,const GLdouble*){}
+static void null_glWeightPointerARB(GLint,GLenum,GLsizei,const void*){}
+static void null_glFinishFenceNV(GLuint){}
+static void null_glDepthRangexOES(GLfixed,GLfixed){}
+static void null_glEnableVertexArrayAttribEXT(GLuint,GLuint){}
+static void null_glProgramUniform2uivEXT(GLuint,GLint,GLsizei,const GLuint*){}
+static void null_glGetDoubleIndexedvEXT(GLenum,GLuint,GLdouble*){}
+static void null_glWindowPos2fMESA(GLfloat,GLfloat){}
+static void null_glSecondaryColor3b(GLbyte,GLbyte,GLbyte){}
+static void null_glCopyConvolutionFilter1DEXT(GLenum,GLenum,GLint,GLint,GLsizei){}
+static void null_glWindowPos2sv(const GLshort*){}
+static void null_glBindFramebufferEXT(GLenum,GLuint){}
+static GLuint null_glCreateShader(GLenum){return (GLuint)0;}
+static GLuint null_glGenPathsNV(GLsizei){return (GLuint)0;}
+static void null_glGenRenderbuffers(GLsizei,GLuint*){}
+static void null_glCopyTexSubImage2D(GLenum,GLint,GLint,GLint,GLint,GLint,GLsizei,GLsizei){}
+static void null_glVertexAttrib4ubvARB(GLuint,const GLubyte*){}
+static void null_glDrawTextureNV(GLuint,GLuint,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat){}
+static void null_glVertexAttribs1svNV(GLuint,GLsizei,const GLshort*){}
+static void null_glClearNamedBufferSubDataEXT(GLuint,GLenum,GLsizeiptr,GLsizeiptr,GLenum,GLenum,const void*){}
+static void null_glBlendFuncSeparate(GLenum,GLenum,GLenum,GLenum){}
+static void null_glPointParameterfARB(GLenum,GLfloat){}
+static void null_glTexCoord2fv(const GLfloat*){}
+static void null_glGetVariantFloatvEXT(GLuint,GLenum,GLfloat*){}
+static void null_glVertexP2ui(GLenum,GLuint){}
+static void null_glWindowPos2dMESA(GLdouble,GLdouble){}
+static void null_glTexCoord4fv(const GLfloat*){}
+static void null_glBindFragDataLocationEXT(GLuint,GLuint,const GLchar*){}
+static void null_glCompressedTexSubImage1DARB(GLenum,GLint,GLint,GLsizei,GLenum,GLsizei,const void*){}
+static void null_glGetTextureImageEXT(GLuint,GLenum,GLint,GLenum,GLenum,void*){}
+static void null_glFogCoordd(GLdouble){}
+static void null_glPointSize(GLfloat){}
+static void null_glBindTextureUnit(GLuint,GLuint){}
+static void null_glProgramEnvParameterI4uiNV(GLenum,GLuint,GLuint,GLuint,GLuint,GLuint){}
+static void null_glGetProgramPipelineInfoLog(GLuint,GLsizei,GLsizei*,GLchar*){}
+static void null_glProgramUniform4i64vARB(GLuint,GLint,GLsizei,const GLint64*){}
+static void null_glVertexAttrib4Nuiv(GLuint,const GLuint*){}
+static void null_glGetUniformfvARB(GLhandleARB,GLint,GLfloat*){}
+static void null_glWaitSync(GLsync,GLbitfield,GLuint64){}
+static void null_glUniform3i(GLint,GLint,GLint,GLint){}
+static void null_glBlendEquationSeparatei(GLuint,GLenum,GLenum){}
+static void null_glVertexAttrib2hvNV(GLuint,const GLhalfNV*){}
+static void null_glTextureParameterivEXT(GLuint,GLenum,GLenum,const GLint*){}
+static void null_glUniform3d(GLint,GLdouble,GLdouble,GLdouble){}
+static void null_glUniform3f(GLint,GLfloat,GLfloat,GLfloat){}
+static void null_glActiveProgramEXT(GLuint){}
+static void null_glDeleteVertexArrays(GLsizei,const GLuint*){}
+static void null_glUniform3ui64vARB(GLint,GLsizei,const GLuint64*){}
+static void null_glProgramUniform1ui64vARB(GLuint,GLint,GLsizei,const GLuint64*){}
+static void null_glTextureParameterfEXT(GLuint,GLenum,GLenum,GLfloat){}
+static void null_glSetFragmentShaderConstantATI(GLuint,const GLfloat*){}
+static void null_glColorSubTable(GLenum,GLsizei,GLsizei,GLenum,GLenum,const GLvoid*){}
+static void null_glReplacementCodeuiSUN(GLuint){}
+static void null_glStateCaptureNV(GLuint,GLenum){}
+static void null_glBindAttribLocation(GLuint,GLuint,const GLchar*){}
+static void null_glWeightusvARB(GLint,const GLushort*){}
+static GLint null_glGetFragDataIndex(GLuint,const GLchar*){return (GLint)0;}
+static void null_glMultiTexCoord2xOES(GLenum,GLfixed,GLfixed){}
+static void null_glColor3sv(const GLshort*){}
+static void null_glTexCoord2fVertex3fSUN(GLfloat,GLfloat,GLfloat,GLfloat,GLfloat){}
+static void null_glPolygonOffsetEXT(GLfloat,GLfloat){}
+static void null_glWeightPathsNV(GLuint,GLsizei,const GLuint*,const GLfloat*){}
+static void null_glCombinerStageParameterfvNV(GLenum,GLenum,const GLfloat*){}
+static void null_glPointParameterfEXT(GLenum,GLfloat){}
+static void null_glCopyTexImage1DEXT(GLenum,GLint,GLenum,GLint,GLint,GLsizei,GLint){}
+static void null_glVertex4sv(const GLshort*){}
+static void null_glMatrixMultfEXT(GLenum,const GLfloat*){}
+static void null_glCompressedTextureSubImage3DEXT(GLuint,GLenum,GLint,GLint,GLint,GLint,GLsizei,GLsizei,GLsizei,GLenum,GLsizei,const void*){}
+static void null_glGetTexLevelParameterxvOES(GLenum,GLint,GLenum,GLfixed*){}
+static void null_glVertexAttribL3dvEXT(GLuint,const GLdouble*){}
+static void null_glMultiTexCoordP4ui(GLenum,GLenum,GLuint){}
+static void null_glGetTextureLevelParameterivEXT(GLuint,GLenum,GLint,GLenum,GLint*){}
+static void null_glAlphaFragmentOp2ATI(GLenum,GLuint,GLuint,GLuint,GLuint,GLuint,GLuint,GLuint,GLuint){}
+static void null_glDeleteFramebuffers(GLsizei,const GLuint*){}
+static void null_glDrawArrays(GLenum,GLint,GLsizei){}
+static void null_glGetTransformFeedbackiv(GLuint,GLenum,GLint*){}
+static void null_glGetnTexImageARB(GLenum,GLint,GLenum,GLenum,GLsizei,void*){}
+static void null_glClear(GLbitfield){}
+static void null_glVertexArrayParameteriAPPLE(GLenum,GLint){}
+static void null_glMultiTexCoord2dvARB(GLenum,const GLdouble*){}
+static void null_glGetVideoCaptureStreamdvNV(GLuint,GLuint,GLenum,GLdouble*){}
+static void null_glFragmentLightModelivSGIX(GLenum,const GLint*){}
+static void null_glVertexAttribP2ui(GLuint,GLenum,GLboolean,GLuint){}
+static void null_glMultiTexCoordPointerEXT(GLenum,GLint,GLenum,GLsizei,const void*){}
+static void null_glProgramUniform3iEXT(GLuint,GLint,GLint,GLint,GLint){}
+static void null_glTranslatef(GLfloat,GLfloat,GLfloat){}
+static void null_glVertexAttrib4Nub(GLuint,GLubyte,GLubyte,GLubyte,GLubyte){}
+static void null_glTranslated(GLdouble,GLdouble,GLdouble){}
+static void null_glSamplerParameterIiv(GLuint,GLenum,const GLint*){}
+static void null_glTexCoord4hNV(GLhalfNV,GLhalfNV,GLhalfNV,GLhalfNV){}
+static void null_glDrawElementsIndirect(GLenum,GLenum,const void*){}
+static void null_glDeletePerfMonitorsAMD(GLsizei,GLuint*){}
+static GLboolean null_glIsRenderbufferEXT(GLuint){return (GLboolean)0;}
+static void null_glDrawCommandsNV(GLenum,GLuint,const GLintptr*,const GLsizei*,GLuint){}
+static void null_glUniform3ivARB(GLint,GLsizei,const GLint*){}
+static void null_glBufferSubData(GLenum,GLintptr,GLsizeiptr,const void*){}
+static void null_glSecondaryColor3bv(const GLbyte*){}
+static void null_glMatrixMultTransposedEXT(GLenum,const GLdouble*){}
+static void null_glRequestResidentProgramsNV(GLsizei,const GLuint*){}
+static void null_glAlphaFragmentOp1ATI(GLenum,GLuint,GLuint,GLuint,GLuint,GLuint){}
+static void null_glGetQueryObjecti64v(GLuint,GLenum,GLint64*){}
+static void null_glMatrixMult3x3fNV(GLenum,const GLfloat*){}
+static void null_glColorTableParameteriv(GLenum,GLenum,const GLint*){}
+static void null_glPathSubCommandsNV(GLuint,GLsizei,GLsizei,GLsizei,const GLubyte*,GLsizei,GLenum,const void*){}
+static void null_glGetFinalCombinerInputParameterivNV(GLenum,GLenum,GLint*){}
+static GLboolean null_glIsRenderbuffer(GLuint){return (GLboolean)0;}
+static void null_glVertex3iv(const GLint*){}
+static void null_glTexGenfv(GLenum,GLenum,const GLfloat*){}
+static void null_glFrustumfOES(GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat){}
+static void null_glBindVertexBuffers(GLuint,GLsizei,const GLuint*,const GLintptr*,const GLsizei*){}
+static void null_glMateriali(GLenum,GLenum,GLint){}
+static void null_glMultiTexCoord2svARB(GLenum,const GLshort*){}
+static void null_glDisableVertexAttribArray(GLuint){}
+static void null_glWindowPos3ivARB(const GLint*){}
+static void null_glTexCoordFormatNV(GLint,GLenum,GLsizei){}
+static void null_glBlitNamedFramebuffer(GLuint,GLuint,GLint,GLint,GLint,GLint,GLint,GLint,GLint,GLint,GLbitfield,GLenum){}
+static void null_glMatrixLoadTransposefEXT(GLenum,const GLfloat*){}
+static void null_glMultiTexGenfEXT(GLenum,GLenum,GLenum,GLfloat){}
+static void null_glShaderStorageBlockBinding(GLuint,GLuint,GLuint){}
+static void null_glMaterialf(GLenum,GLenum,GLfloat){}
+static void null_glReplacementCodeuiColor4fNormal3fVertex3fSUN(GLuint,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat){}
+static GLenum null_glCheckNamedFramebufferStatusEXT(GLuint,GLenum){return (GLenum)0;}
+static void null_glVertexArrayVertexAttribFormatEXT(GLuint,GLuint,GLint,GLenum,GLboolean,GLuint){}
+static void null_glVertex2hNV(GLhalfNV,GLhalfNV){}
+static void null_glDeleteVertexShaderEXT(GLuint){}
+static void null_glTexImage3DEXT(GLenum,GLint,GLenum,GLsizei,GLsizei,GLsizei,GLint,GLenum,GLenum,const void*){}
+static void null_glProgramLocalParameterI4ivNV(GLenum,GLuint,const GLint*){}
+static void null_glGlobalAlphaFactoriSUN(GLint){}
+static void null_glTextureStorage1D(GLuint,GLsizei,GLenum,GLsizei){}
+static void null_glBinormal3sEXT(GLshort,GLshort,GLshort){}
+static void null_glGetProgramInterfaceiv(GLuint,GLenum,GLenum,GLint*){}
+static void null_glMatrixIndexPointerARB(GLint,GLenum,GLsizei,const void*){}
+static void null_glTexCoordPointerEXT(GLint,GLenum,GLsizei,GLsizei,const void*){}
+static void null_glMultiTexGeniEXT(GLenum,GLenum,GLenum,GLint){}
+static void null_glVertexAttrib2fNV(GLuint,GLfloat,GLfloat){}
+static void null_glNamedProgramStringEXT(GLuint,GLenum,GLenum,GLsizei,const void*){}
+static void* null_glMapNamedBuffer(GLuint,GLenum){return (void*)0;}
+static void null_glGetMinmaxParameteriv(GLenum,GLenum,GLint*){}
+static void null_glGetnUniformdv(GLuint,GLint,GLsizei,GLdouble*){}
+static void null_glEndConditionalRenderNVX(){}
+static void null_glBinormal3fEXT(GLfloat,GLfloat,GLfloat){}
+static void null_glNormalStream3iATI(GLenum,GLint,GLint,GLint){}
+static void null_glProgramBufferParametersIivNV(GLenum,GLuint,GLuint,GLsizei,const GLint*){}
+static void null_glMapGrid1xOES(GLint,GLfixed,GLfixed){}
+static void null_glGetVertexAttribPointervARB(GLuint,GLenum,void**){}
+static void null_glFlushMappedNamedBufferRangeEXT(GLuint,GLintptr,GLsizeiptr){}
+static void null_glGetVertexAttribIiv(GLuint,GLenum,GLint*){}
+static void null_glVertexP4uiv(GLenum,const GLuint*){}
+static void null_glUniformui64NV(GLint,GLuint64EXT){}
+static void null_glColor4fv(const GLfloat*){}
+static void null_glTexParameterxvOES(GLenum,GLenum,const GLfixed*){}
+static void null_glPatchParameteri(GLenum,GLint){}
+static void null_glMap1d(GLenum,GLdouble,GLdouble,GLint,GLint,const GLdouble*){}
+static void null_glGetTexFilterFuncSGIS(GLenum,GLenum,GLfloat*){}
+static void null_glGetTexParameteriv(GLenum,GLenum,GLint*){}
+static void null_glVertexArrayVertexBindingDivisorEXT(GLuint,GLuint,GLuint){}
+static void null_glMultiTexCoord3svARB(GLenum,const GLshort*){}
+static void null_glBindProgramNV(GLenum,GLuint){}
+static void null_glGetConvolutionParameteriv(GLenum,GLenum,GLint*){}
+static void null_glGetProgramLocalParameterfvARB(GLenum,GLuint,GLfloat*){}
+static GLuint null_glGenFragmentShadersATI(GLuint){return (GLuint)0;}
+static void null_glTexBumpParameterivATI(GLenum,const GLint*){}
+static void null_glGetNamedFramebufferAttachmentParameteriv(GLuint,GLenum,GLenum,GLint*){}
+static void null_glGetnSeparableFilter(GLenum,GLenum,GLenum,GLsizei,void*,GLsizei,void*,void*){}
+static void null_glNormal3xvOES(const GLfixed*){}
+static void null_glPassTexCoordATI(GLuint,GLuint,GLenum){}
+static void null_glFramebufferTextureFaceARB(GLenum,GLenum,GLuint,GLint,GLenum){}
+static void null_glProgramUniform1dv(GLuint,GLint,GLsizei,const GLdouble*){}
+static void null_glTextureStorage2DEXT(GLuint,GLenum,GLsizei,GLenum,GLsizei,GLsizei){}
+static void null_glVertexArrayFogCoordOffsetEXT(GLuint,GLuint,GLenum,GLsizei,GLintptr){}
+static void null_glDeleteNamedStringARB(GLint,const GLchar*){}
+static void null_glGenOcclusionQueriesNV(GLsizei,GLuint*){}
+static void null_glLighti(GLenum,GLenum,GLint){}
+static void null_glTexImage1D(GLenum,GLint,GLint,GLsizei,GLint,GLenum,GLenum,const GLvoid*){}
+static void null_glLightf(GLenum,GLenum,GLfloat){}
+static void null_glClientAttribDefaultEXT(GLbitfield){}
+static void null_glVertexAttrib4bvARB(GLuint,const GLbyte*){}
+static void null_glVertexAttribIFormatNV(GLuint,GLint,GLenum,GLsizei){}
+static void null_glStencilFuncSeparate(GLenum,GLenum,GLint,GLuint){}
+static void null_glGetVertexAttribfvARB(GLuint,GLenum,GLfloat*){}
+static void null_glVertexAttrib2dNV(GLuint,GLdouble,GLdouble){}
+static void null_glProgramUniform2iEXT(GLuint,GLint,GLint,GLint){}
+static void null_glClientActiveVertexStreamATI(GLenum){}
+static void null_glRasterPos3xOES(GLfixed,GLfixed,GLfixed){}
+static void null_glGetMapParameterivNV(GLenum,GLenum,GLint*){}
+static void null_glSampleCoverage(GLclampf,GLboolean){}
+static void null_glClearDepthxOES(GLfixed){}
+static void null_glTexCoord2fNormal3fVertex3fvSUN(const GLfloat*,const GLfloat*,const GLfloat*){}
+static void null_glGetFirstPerfQueryIdINTEL(GLuint*){}
+static GLboolean null_glUnmapNamedBufferEXT(GLuint){return (GLboolean)0;}
+static void null_glGetTransformFeedbacki_v(GLuint,GLenum,GLuint,GLint*){}
+static void null_glUniform4fvARB(GLint,GLsizei,const GLfloat*){}
+static void null_glRenderbufferStorageMultisampleCoverageNV(GLenum,GLsizei,GLsizei,GLenum,GLsizei,GLsizei){}
+static void null_glGetFloati_vEXT(GLenum,GLuint,GLfloat*){}
+static void null_glBindAttribLocationARB(GLhandleARB,GLuint,const GLcharARB*){}
+static void null_glBufferAddressRangeNV(GLenum,GLuint,GLuint64EXT,GLsizeiptr){}
+static void null_glGenProgramsARB(GLsizei,GLuint*){}
+static void null_glMultiTexEnvivEXT(GLenum,GLenum,GLenum,const GLint*){}
+static void null_glSecondaryColor3uiEXT(GLuint,GLuint,GLuint){}
+static void null_glCompressedTextureImage2DEXT(GLuint,GLenum,GLint,GLenum,GLsizei,GLsizei,GLint,GLsizei,const void*){}
+static void null_glUniform2i(GLint,GLint,GLint){}
+static void null_glCopyTexImage2DEXT(GLenum,GLint,GLenum,GLint,GLint,GLsizei,GLsizei,GLint){}
+static void null_glUniform2d(GLint,GLdouble,GLdouble){}
+static void null_glVertexAttribL1d(GLuint,GLdouble){}
+static void null_glFramebufferTextureFaceEXT(GLenum,GLenum,GLuint,GLint,GLenum){}
+static void null_glFramebufferTextureLayer(GLenum,GLenum,GLuint,GLint,GLint){}
+static void null_glMultiTexCoord4bvOES(GLenum,const GLbyte*){}
+static void null_glGetVertexArrayPointeri_vEXT(GLuint,GLuint,GLenum,void**){}
+static void null_glNamedProgramLocalParameter4dEXT(GLuint,GLenum,GLuint,GLdouble,GLdouble,GLdouble,GLdouble){}
+static void null_glBinormal3bEXT(GLbyte,GLbyte,GLbyte){}
+static void null_glConvolutionFilter2DEXT(GLenum,GLenum,GLsizei,GLsizei,GLenum,GLenum,const void*){}
+static void null_glProgramUniform2fv(GLuint,GLint,GLsizei,const GLfloat*){}
+static void null_glColor3fVertex3fSUN(GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat){}
+static void null_glNormal3fVertex3fvSUN(const GLfloat*,const GLfloat*){}
+static void null_glCopyMultiTexSubImage3DEXT(GLenum,GLenum,GLint,GLint,GLint,GLint,GLint,GLint,GLsizei,GLsizei){}
+static void null_glProgramLocalParameterI4iNV(GLenum,GLuint,GLint,GLint,GLint,GLint){}
+static void null_glProgramUniformMatrix2x4dv(GLuint,GLint,GLsizei,GLboolean,const GLdouble*){}
+static GLenum null_glPathMemoryGlyphIndexArrayNV(GLuint,GLenum,GLsizeiptr,const void*,GLsizei,GLuint,GLsizei,GLuint,GLfloat){return (GLenum)0;}
+static void null_glDrawArraysEXT(GLenum,GLint,GLsizei){}
+static void null_glBlendEquationEXT(GLenum){}
+static void null_glStencilOp(GLenum,GLenum,GLenum){}
+static void null_glCopyTextureSubImage2DEXT(GLuint,GLenum,GLint,GLint,GLint,GLint,GLint,GLsizei,GLsizei){}
+static void null_glTexEnvf(GLenum,GLenum,GLfloat){}
+static void null_glVertexAttrib2dvNV(GLuint,const GLdouble*){}
+static void null_glGenPerfMonitorsAMD(GLsizei,GLuint*){}
+static void null_glGetInteger64i_v(GLenum,GLuint,GLint64*){}
+static void null_glGetHistogramParameterfv(GLenum,GLenum,GLfloat*){}
+static void null_glVertexFormatNV(GLint,GLenum,GLsizei){}
+static void null_glBlendFuncIndexedAMD(GLuint,GLenum,GLenum){}
+static void null_glTexEnvi(GLenum,GLenum,GLint){}
+static void null_glMultiTexCoord1iv(GLenum,const GLint*){}
+static GLboolean null_glIsEnabledi(GLenum,GLuint){return (GLboolean)0;}
+static void null_glVertexAttribL2ui64vNV(GLuint,const GLuint64EXT*){}
+static void null_glVertexAttribL4i64NV(GLuint,GLint64EXT,GLint64EXT,GLint64EXT,GLint64EXT){}
+static void null_glMatrixTranslatedEXT(GLenum,GLdouble,GLdouble,GLdouble){}
+static void null_glMakeTextureHandleResidentARB(GLuint64){}
+static void null_glMatrixMultdEXT(GLenum,const GLdouble*){}
+static void null_glBinormal3dvEXT(const GLdouble*){}
+static GLsync null_glImportSyncEXT(GLenum,GLintptr,GLbitfield){return (GLsync)0;}
+static void null_glGetMapiv(GLenum,GLenum,GLint*){}
+static void null_glGetListParameterfvSGIX(GLuint,GLenum,GLfloat*){}
+static void null_glMultiTexCoord4sv(GLenum,const GLshort*){}
+static void null_glPNTrianglesiATI(GLenum,GLint){}
+static void null_glBindVertexArrayAPPLE(GLuint){}
+static void null_glObjectPtrLabel(const void*,GLsizei,const GLchar*){}
+static GLuint null_glGetDebugMessageLog(GLuint,GLsizei,GLenum*,GLenum*,GLuint*,GLenum*,GLsizei*,GLchar*){return (GLuint)0;}
+static void null_glTrackMatrixNV(GLenum,GLuint,GLenum,GLenum){}
+static void null_glBindFragDataLocation(GLuint,GLuint,const GLchar*){}
+static void null_glTangent3ivEXT(const GLint*){}
+static void null_glSecondaryColor3ubv(const GLubyte*){}
+static void null_glMakeTextureHandleNonResidentNV(GLuint64){}
+static void null_glVertexAttribs4ubvNV(GLuint,GLsizei,const GLubyte*){}
+static void null_glClipPlanexOES(GLenum,const GLfixed*){}
+static void null_glMultiTexCoord3iv(GLenum,const GLint*){}
+static void null_glGetnPolygonStippleARB(GLsizei,GLubyte*){}
+static void null_glUniform2i64vNV(GLint,GLsizei,const GLint64EXT*){}
+static void null_glLightModelf(GLenum,GLfloat){}
+static void null_glMultiTexSubImage2DEXT(GLenum,GLenum,GLint,GLint,GLint,GLsizei,GLsizei,GLenum,GLenum,const void*){}
+static void null_glReplacementCodeuiColor3fVertex3fSUN(GLuint,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat){}
+static void null_glTangent3dvEXT(const GLdouble*){}
+static void null_glLightModeli(GLenum,GLint){}
+static void null_glVertexWeighthvNV(const GLhalfNV*){}
+static void null_glWindowPos3iv(const GLint*){}
+static void null_glMultiTexCoordP1uiv(GLenum,GLenum,const GLuint*){}
+static void null_glTransformPathNV(GLuint,GLuint,GLenum,const GLfloat*){}
+static void null_glProgramNamedParameter4dNV(GLuint,GLsizei,const GLubyte*,GLdouble,GLdouble,GLdouble,GLdouble){}
+static void null_glMultiDrawElementsIndirect(GLenum,GLenum,const void*,GLsizei,GLsizei){}
+static void null_glProgramUniform1dEXT(GLuint,GLint,GLdouble){}
+static void null_glCallLists(GLsizei,GLenum,const GLvoid*){}
+static void null_glNormal3hvNV(const GLhalfNV*){}
+static void null_glGetCombinerOutputParameterfvNV(GLenum,GLenum,GLenum,GLfloat*){}
+static void null_glVertexAttrib4sARB(GLuint,GLshort,GLshort,GLshort,GLshort){}
+static void null_glTexCoord3i(GLint,GLint,GLint){}
+static void null_glVertexAttribI3uiv(GLuint,const GLuint*){}
+static void null_glPushDebugGroup(GLenum,GLuint,GLsizei,const GLchar*){}
+static void null_glTexCoord3f(GLfloat,GLfloat,GLfloat){}
+static void null_glTexCoord3d(GLdouble,GLdouble,GLdouble){}
+static void null_glTexCoord2xOES(GLfixed,GLfixed){}
+static GLushort null_glGetStageIndexNV(GLenum){return (GLushort)0;}
+static void null_glProgramUniform4i64vNV(GLuint,GLint,GLsizei,const GLint64EXT*){}
+static void null_glGetNamedBufferPointervEXT(GLuint,GLenum,void**){}
+static void null_glTextureBarrierNV(){}
+static void null_glColor4ubVertex3fvSUN(const GLubyte*,const GLfloat*){}
+static GLuint null_glGetCommandHeaderNV(GLenum,GLuint){return (GLuint)0;}
+static void null_glGetPerfMonitorCounterInfoAMD(GLuint,GLuint,GLenum,void*){}
+static void null_glVertexAttrib1svARB(GLuint,const GLshort*){}
+static void null_glCombinerParameteriNV(GLenum,GLint){}
+static void null_glMatrixMultTransposefEXT(GLenum,const GLfloat*){}
+static void null_glDetailTexFuncSGIS(GLenum,GLsizei,const GLfloat*){}
+static GLboolean null_glAreTexturesResident(GLsizei,const GLuint*,GLboolean*){return (GLboolean)0;}
+static void null_glProgramUniform2d(GLuint,GLint,GLdouble,GLdouble){}
+static void null_glGetConvolutionParameterfvEXT(GLenum,GLenum,GLfloat*){}
+static void null_glIndexPointerListIBM(GLenum,GLint,const void**,GLint){}
+static void null_glVertexAttribI4iEXT(GLuint,GLint,GLint,GLint,GLint){}
+static void null_glProgramUniform2f(GLuint,GLint,GLfloat,GLfloat){}
+static void null_glRasterPos4sv(const GLshort*){}
+static void null_glColor4s(GLshort,GLshort,GLshort,GLshort){}
+static void null_glColorFragmentOp3ATI(GLenum,GLuint,GLuint,GLuint,GLuint,GLuint,GLuint,GLuint,GLuint,GLuint,GLuint,GLuint,GLuint){}
+static void null_glResizeBuffersMESA(){}
+static void null_glGetMinmaxParameterfv(GLenum,GLenum,GLfloat*){}
+static void null_glClientActiveTextureARB(GLenum){}
+static void null_glBindVertexArray(GLuint){}
+static void null_glColor4b(GLbyte,GLbyte,GLbyte,GLbyte){}
+static void null_glColor4f(GLfloat,GLfloat,GLfloat,GLfloat){}
+static void null_glColor4d(GLdouble,GLdouble,GLdouble,GLdouble){}
+static void null_glColor4i(GLint,GLint,GLint,GLint){}
+static void null_glEdgeFlagFormatNV(GLsizei){}
+static void null_glNamedBufferSubData(GLuint,GLintptr,GLsizeiptr,const void*){}
+static void null_glDrawElementsInstanced(GLenum,GLsizei,GLenum,const void*,GLsizei){}
+static void null_glGetMultiTexParameterIivEXT(GLenum,GLenum,GLenum,GLint*){}
+static void null_glVertex2dv(const GLdouble*){}
+static void null_glDisableVertexArrayAttribEXT(GLuint,GLuint){}
+static GLenum null_glObjectUnpurgeableAPPLE(GLenum,GLuint,GLenum){return (GLenum)0;}
+static void null_glVertexAttribs2dvNV(GLuint,GLsizei,const GLdouble*){}
+static void null_glReplacementCodeuiTexCoord2fVertex3fSUN(GLuint,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat){}
+static void null_glGetMapParameterfvNV(GLenum,GLenum,GLfloat*){}
+static void null_glProgramUniform4ivEXT(GLuint,GLint,GLsizei,const GLint*){}
+static void null_glProgramUniform3ui64vNV(GLuint,GLint,GLsizei,const GLuint64EXT*){}
+static void null_glRectfv(const GLfloat*,const GLfloat*){}
+static void null_glTexFilterFuncSGIS(GLenum,GLenum,GLsizei,const GLfloat*){}
+static void null_glSpriteParameterfvSGIX(GLenum,const GLfloat*){}
+static void null_glCopyMultiTexImage1DEXT(GLenum,GLenum,GLint,GLenum,GLint,GLint,GLsizei,GLint){}
+static void null_glGetVertexAttribIuivEXT(GLuint,GLenum,GLuint*){}
+static void null_glUniformMatrix2x4dv(GLint,GLsizei,GLboolean,const GLdouble*){}
+static GLint null_glGetProgramResourceLocationIndex(GLuint,GLenum,const GLchar*){return (GLint)0;}
+static void null_glColor3hNV(GLhalfNV,GLhalfNV,GLhalfNV){}
+static void null_glViewport(GLint,GLint,GLsizei,GLsizei){}
+static void null_glProgramNamedParameter4fNV(GLuint,GLsizei,const GLubyte*,GLfloat,GLfloat,GLfloat,GLfloat){}
+static void null_glGetInvariantBooleanvEXT(GLuint,GLenum,GLboolean*){}
+static void null_glTexStorage2DMultisample(GLenum,GLsizei,GLenum,GLsizei,GLsizei,GLboolean){}
+static void null_glPixelStorex(GLenum,GLfixed){}
+static void null_glVertexAttribL1dvEXT(GLuint,const GLdouble*){}
+static void null_glGetActiveSubroutineUniformiv(GLuint,GLenum,GLuint,GLenum,GLint*){}
+static void null_glVertexAttribPointerARB(GLuint,GLint,GLenum,GLboolean,GLsizei,const void*){}
+static void null_glCompressedTexSubImage2DARB(GLenum,GLint,GLint,GLint,GLsizei,GLsizei,GLenum,GLsizei,const void*){}
+static void null_glVertex2hvNV(const GLhalfNV*){}
+static void null_glTexBuffer(GLenum,GLenum,GLuint){}
+static void null_glArrayElement(GLint){}
+static void null_glValidateProgram(GLuint){}
+static void null_glPixelStoref(GLenum,GLfloat){}
+static void null_glWindowPos3dARB(GLdouble,GLdouble,GLdouble){}
+static void null_glEvalCoord1dv(const GLdouble*){}
+static void null_glVertexAttribs2fvNV(GLuint,GLsizei,const GLfloat*){}
+static void null_glRecti(GLint,GLint,GLint,GLint){}
+static void null_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN(const GLuint*,const GLfloat*,const GLfloat*,const GLfloat*,const GLfloat*){}
+static void null_glTexCoord1bOES(GLbyte){}
+static void null_glProgramUniform2i64vARB(GLuint,GLint,GLsizei,const GLint64*){}
+static void null_glWindowPos2dARB(GLdouble,GLdouble){}
+static void null_glGetProgramParameterdvNV(GLenum,GLuint,GLenum,GLdouble*){}
+static void null_glRectf(GLfloat,GLfloat,GLfloat,GLfloat){}
+static void null_glRectd(GLdouble,GLdouble,GLdouble,GLdouble){}
+static void null_glMap1xOES(GLenum,GLfixed,GLfixed,GLint,GLint,GLfixed){}
+static void null_glVertexAttrib3fvNV(GLuint,const GLfloat*){}
+static void null_glReferencePlaneSGIX(const GLdouble*){}
+static void null_glGetMultiTexGendvEXT(GLenum,GLenum,GLenum,GLdouble*){}
+static void null_glGetCombinerInputParameterfvNV(GLenum,GLenum,GLenum,GLenum,GLfloat*){}
+static GLuint64 null_glGetTextureSamplerHandleARB(GLuint,GLuint){return (GLuint64)0;}
+static void null_glBindTexture(GLenum,GLuint){}
+static void null_glRects(GLshort,GLshort,GLshort,GLshort){}
+static void null_glGetActiveAttribARB(GLhandleARB,GLuint,GLsizei,GLsizei*,GLint*,GLenum*,GLcharARB*){}
+static void null_glHistogramEXT(GLenum,GLsizei,GLenum,GLboolean){}
+static GLuint64 null_glGetTextureSamplerHandleNV(GLuint,GLuint){return (GLuint64)0;}
+static void null_glDetachShader(GLuint,GLuint){}
+static void null_glFinishTextureSUNX(){}
+static void null_glUniformMatrix3x4dv(GLint,GLsizei,GLboolean,const GLdouble*){}
+static void null_glVertexAttrib4fARB(GLuint,GLfloat,GLfloat,GLfloat,GLfloat){}
+static void null_glGetPathColorGenivNV(GLenum,GLenum,GLint*){}
+static GLint null_glGetProgramResourceLocation(GLuint,GLenum,const GLchar*){return (GLint)0;}
+static void null_glVertexArrayAttribLFormat(GLuint,GLuint,GLint,GLenum,GLuint){}
+static void null_glGetTexLevelParameterfv(GLenum,GLint,GLenum,GLfloat*){}
+static void null_glVertexArrayVertexAttribOffsetEXT(GLuint,GLuint,GLuint,GLint,GLenum,GLboolean,GLsizei,GLintptr){}
+static void null_glIndexFormatNV(GLenum,GLsizei){}
+static void null_glMultiTexCoord3i(GLenum,GLint,GLint,GLint){}
+static void null_glReplacementCodeuiVertex3fvSUN(const GLuint*,const GLfloat*){}
+static void null_glViewportIndexedfv(GLuint,const GLfloat*){}
+static void null_glBindBuffersBase(GLenum,GLuint,GLsizei,const GLuint*){}
+static void null_glTexBumpParameterfvATI(GLenum,const GLfloat*){}
+static void null_glMatrixIndexuivARB(GLint,const GLuint*){}
+static void null_glVertexAttrib1hNV(GLuint,GLhalfNV){}
+static void null_glWindowPos3svMESA(const GLshort*){}
+static void null_glStencilOpSeparateATI(GLenum,GLenum,GLenum,GLenum){}
+static void null_glDrawElementsBaseVertex(GLenum,GLsizei,GLenum,const void*,GLint){}
+static void null_glBlendEquationSeparateiARB(GLuint,GLenum,GLenum){}
+static void null_glVertexAttrib1fNV(GLuint,GLfloat){}
+static void null_glMapVertexAttrib2fAPPLE(GLuint,GLuint,GLfloat,GLfloat,GLint,GLint,GLfloat,GLfloat,GLint,GLint,const GLfloat*){}
+static void null_glCompressedTextureSubImage1DEXT(GLuint,GLenum,GLint,GLint,GLsizei,GLenum,GLsizei,const void*){}
+static void null_glClearBufferSubData(GLenum,GLenum,GLintptr,GLsizeiptr,GLenum,GLenum,const void*){}
+static void null_glTexStorage1D(GLenum,GLsizei,GLenum,GLsizei){}
+static void null_glVertexAttribI3iEXT(GLuint,GLint,GLint,GLint){}
+static void null_glMakeTextureHandleNonResidentARB(GLuint64){}
+static void null_glMultiDrawElementArrayAPPLE(GLenum,const GLint*,const GLsizei*,GLsizei){}
+static void null_glVertexStream4dATI(GLenum,GLdouble,GLdouble,GLdouble,GLdouble){}
+static void null_glProgramUniformMatrix2dvEXT(GLuint,GLint,GLsizei,GLboolean,const GLdouble*){}
+static void null_glVertexAttribs2hvNV(GLuint,GLsizei,const GLhalfNV*){}
+static void null_glGetUniformiv(GLuint,GLint,GLint*){}
+static void null_glClipPlanefOES(GLenum,const GLfloat*){}
+static void null_glRenderbufferStorage(GLenum,GLenum,GLsizei,GLsizei){}
+static void null_glUniform4ui(GLint,GLuint,GLuint,GLuint,GLuint){}
+static void null_glBindFramebuffer(GLenum,GLuint){}
+static void null_glValidateProgramARB(GLhandleARB){}
+static void null_glTexGenf(GLenum,GLenum,GLfloat){}
+static void null_glTexGend(GLenum,GLenum,GLdouble){}
+static void null_glTexGeni(GLenum,GLenum,GLint){}
+static void null_glDeleteFramebuffersEXT(GLsizei,const GLuint*){}
+static void null_glResetMinmaxEXT(GLenum){}
+static void null_glVertexAttrib1fvNV(GLuint,const GLfloat*){}
+static GLboolean null_glIsQueryARB(GLuint){return (GLboolean)0;}
+static void null_glEnableVariantClientStateEXT(GLuint){}
+static void null_glScissorIndexed(GLuint,GLint,GLint,GLsizei,GLsizei){}
+static void null_glGetInvariantIntegervEXT(GLuint,GLenum,GLint*){}
+static void null_glProgramLocalParameterI4uiNV(GLenum,GLuint,GLuint,GLuint,GLuint,GLuint){}
+static void null_glConvolutionParameterxvOES(GLenum,GLenum,const GLfixed*){}
+static void null_glGenFramebuffersEXT(GLsizei,GLuint*){}
+static void null_glVertexArrayColorOffsetEXT(GLuint,GLuint,GLint,GLenum,GLsizei,GLintptr){}
+static void null_glMultiTexCoord3ivARB(GLenum,const GLint*){}
+static void null_glVertexWeightfEXT(GLfloat){}
+static void null_glRasterPos4dv(const GLdouble*){}
+static GLboolean null_glIsTextureHandleResidentARB(GLuint64){return (GLboolean)0;}
+static void null_glRasterPos2dv(const GLdouble*){}
+static void null_glWindowPos4ivMESA(const GLint*){}
+static void null_glGetVariantPointervEXT(GLuint,GLenum,void**){}
+static void* null_glMapNamedBufferRangeEXT(GLuint,GLintptr,GLsizeiptr,GLbitfield){return (void*)0;}
+static void null_glGetnUniformui64vARB(GLuint,GLint,GLsizei,GLuint64*){}
+static GLuint null_glCreateShaderProgramv(GLenum,GLsizei,const GLchar*const*){return (GLuint)0;}
+static void null_glGetQueryObjectiv(GLuint,GLenum,GLint*){}
+static void null_glPNTrianglesfATI(GLenum,GLfloat){}
+static void null_glGlobalAlphaFactorusSUN(GLushort){}
+static void null_glVertexAttrib3dvNV(GLuint,const GLdouble*){}
+static void null_glMultiTexCoord3sARB(GLenum,GLshort,GLshort,GLshort){}
+static void null_glGenerateMipmap(GLenum){}
+static void null_glCompressedTextureSubImage2D(GLuint,GLint,GLint,GLint,GLsizei,GLsizei,GLenum,GLsizei,const void*){}
+static void null_glNamedRenderbufferStorageMultisampleEXT(GLuint,GLsizei,GLenum,GLsizei,GLsizei){}
+static void null_glPolygonOffsetClampEXT(GLfloat,GLfloat,GLfloat){}
+static void null_glTextureRangeAPPLE(GLenum,GLsizei,const void*){}
+static void null_glBlendEquationIndexedAMD(GLuint,GLenum){}
+static void null_glTexCoord2d(GLdouble,GLdouble){}
+static void null_glPointParameteri(GLenum,GLint){}
+static void null_glTexCoord2f(GLfloat,GLfloat){}
+static void null_glColor4iv(const GLint*){}
+static void* null_glMapNamedBufferRange(GLuint,GLintptr,GLsizeiptr,GLbitfield){return (void*)0;}
+static GLboolean null_glUnmapBuffer(GLenum){return (GLboolean)0;}
+static void null_glSampleMaskEXT(GLclampf,GLboolean){}
+static void null_glTexCoord2i(GLint,GLint){}
+static void null_glTexCoord1xvOES(const GLfixed*){}
+static void null_glVertexAttrib1sARB(GLuint,GLshort){}
+static void null_glGetVertexArrayiv(GLuint,GLenum,GLint*){}
+static void null_glProgramParameter4dvNV(GLenum,GLuint,const GLdouble*){}
+static void null_glTexCoord2s(GLshort,GLshort){}
+static void null_glTextureParameterIuivEXT(GLuint,GLenum,GLenum,const GLuint*){}
+static void null_glGetColorTableParameterfvSGI(GLenum,GLenum,GLfloat*){}
+static void null_glTexCoord4dv(const GLdouble*){}
+static void null_glVertexAttrib1svNV(GLuint,const GLshort*){}
+static void null_glNamedFramebufferTextureFaceEXT(GLuint,GLenum,GLuint,GLint,GLenum){}
+static void null_glProgramUniform2ui64vNV(GLuint,GLint,GLsizei,const GLuint64EXT*){}
+static void null_glNormal3dv(const GLdouble*){}
+static void null_glReleaseShaderCompiler(){}
+static void null_glTexCoord3bvOES(const GLbyte*){}
+static GLboolean null_glIsVertexAttribEnabledAPPLE(GLuint,GLenum){return (GLboolean)0;}
+static void null_glTexCoord1dv(const GLdouble*){}
+static void null_glReadPixels(GLint,GLint,GLsizei,GLsizei,GLenum,GLenum,GLvoid*){}
+static void null_glVertexAttribI3iv(GLuint,const GLint*){}
+static void null_glSetFenceAPPLE(GLuint){}
+static void null_glWeightsvARB(GLint,const GLshort*){}
+static void null_glShadeModel(GLenum){}
+static void null_glMapGrid1d(GLint,GLdouble,GLdouble){}
+static void null_glGetHistogramParameterivEXT(GLenum,GLenum,GLint*){}
+static void null_glConservativeRasterParameteriNV(GLenum,GLint){}
+static void null_glClearNamedBufferData(GLuint,GLenum,GLenum,GLenum,const void*){}
+static void null_glClearDepthf(GLfloat){}
+static void null_glCreatePerfQueryINTEL(GLuint,GLuint*){}
+static void null_glFogCoordfEXT(GLfloat){}
+static void null_glVertexAttrib2dARB(GLuint,GLdouble,GLdouble){}
+static void null_glMultiTexCoord4dARB(GLenum,GLdouble,GLdouble,GLdouble,GLdouble){}
+static void null_glReadnPixelsARB(GLint,GLint,GLsizei,GLsizei,GLenum,GLenum,GLsizei,void*){}
+static void null_glMultiTexBufferEXT(GLenum,GLenum,GLenum,GLuint){}
+static void null_glWindowPos4dvMESA(const GLdouble*){}
+static void null_glInvalidateNamedFramebufferData(GLuint,GLsizei,const GLenum*){}
+static void null_glSecondaryColorPointerListIBM(GLint,GLenum,GLint,const void**,GLint){}
+static void null_glRectiv(const GLint*,const GLint*){}
+static void null_glColorP4ui(GLenum,GLuint){}
+static void null_glUseProgramStages(GLuint,GLbitfield,GLuint){}
+static void null_glRasterPos3dv(const GLdouble*){}
+static void null_glPathTexGenNV(GLenum,GLenum,GLint,const GLfloat*){}
+static void null_glVertexBlendEnviATI(GLenum,GLint){}
+static void null_glUniform3i64ARB(GLint,GLint64,GLint64,GLint64){}
+static void null_glLoadMatrixf(const GLfloat*){}
+static void null_glProgramUniform2dEXT(GLuint,GLint,GLdouble,GLdouble){}
+static void null_glVertexAttribI4iv(GLuint,const GLint*){}
+static void null_glNamedFramebufferDrawBuffer(GLuint,GLenum){}
+static void null_glColor4ubv(const GLubyte*){}
+static void null_glColor3hvNV(const GLhalfNV*){}
+static void null_glGetMapAttribParameterfvNV(GLenum,GLuint,GLenum,GLfloat*){}
+static void null_glGetBufferSubData(GLenum,GLintptr,GLsizeiptr,void*){}
+static void null_glGetVertexAttribLdv(GLuint,GLenum,GLdouble*){}
+static void null_glGetnUniformuiv(GLuint,GLint,GLsizei,GLuint*){}
+static void null_glGetUniformui64vNV(GLuint,GLint,GLuint64EXT*){}
+static void null_glNamedRenderbufferStorageEXT(GLuint,GLenum,GLsizei,GLsizei){}
+static void null_glVertexAttrib3dNV(GLuint,GLdouble,GLdouble,GLdouble){}
+static void null_glTextureStorage1DEXT(GLuint,GLenum,GLsizei,GLenum,GLsizei){}
+static void null_glPixelTexGenParameteriSGIS(GLenum,GLint){}
+static void null_glColorTableEXT(GLenum,GLenum,GLsizei,GLenum,GLenum,const void*){}
+static void null_glGenBuffers(GLsizei,GLuint*){}
+static void null_glMultiTexCoord3xvOES(GLenum,const GLfixed*){}
+static void null_glExecuteProgramNV(GLenum,GLuint,const GLfloat*){}
+static void null_glVariantArrayObjectATI(GLuint,GLenum,GLsizei,GLuint,GLuint){}
+static void null_glColor3xvOES(const GLfixed*){}
+static void null_glGetnConvolutionFilterARB(GLenum,GLenum,GLenum,GLsizei,void*){}
+static void null_glNormalFormatNV(GLenum,GLsizei){}
+static void null_glGetInvariantFloatvEXT(GLuint,GLenum,GLfloat*){}
+static void null_glClearNamedFramebufferiv(GLuint,GLenum,GLint,const GLint*){}
+static void null_glTexImage3D(GLenum,GLint,GLint,GLsizei,GLsizei,GLsizei,GLint,GLenum,GLenum,const GLvoid*){}
+static void null_glGenSamplers(GLsizei,GLuint*){}
+static GLboolean null_glIsFramebuffer(GLuint){return (GLboolean)0;}
+static void null_glProgramUniform3dvEXT(GLuint,GLint,GLsizei,const GLdouble*){}
+static void null_glGetVertexAttribfvNV(GLuint,GLenum,GLfloat*){}
+static void null_glDrawRangeElementArrayAPPLE(GLenum,GLuint,GLuint,GLint,GLsizei){}
+static void null_glUniform3i64NV(GLint,GLint64EXT,GLint64EXT,GLint64EXT){}
+static void null_glMatrixPopEXT(GLenum){}
+static void null_glVertexStream1sATI(GLenum,GLshort){}
+static void null_glGetnPixelMapuivARB(GLenum,GLsizei,GLuint*){}
+static void null_glMultiTexEnviEXT(GLenum,GLenum,GLenum,GLint){}
+static void null_glVertexAttribI2iEXT(GLuint,GLint,GLint){}
+static void null_glProgramParameter4fvNV(GLenum,GLuint,const GLfloat*){}
+static void null_glNamedFramebufferSampleLocationsfvNV(GLuint,GLuint,GLsizei,const GLfloat*){}
+static void null_glTexCoordP4uiv(GLenum,const GLuint*){}
+static void null_glRectxvOES(const GLfixed*,const GLfixed*){}
+static void null_glGetVariantIntegervEXT(GLuint,GLenum,GLint*){}
+static void null_glDeleteLists(GLuint,GLsizei){}
+static void null_glTexGendv(GLenum,GLenum,const GLdouble*){}
+static void null_glVertexP2uiv(GLenum,const GLuint*){}
+static void null_glGetPerfMonitorGroupsAMD(GLint*,GLsizei,GLuint*){}
+static void null_glMultTransposeMatrixfARB(const GLfloat*){}
+static void null_glVertexAttribI2ivEXT(GLuint,const GLint*){}
+static void null_glReplacementCodeuiColor4fNormal3fVertex3fvSUN(const GLuint*,const GLfloat*,const GLfloat*,const GLfloat*){}
+static void null_glDeleteStatesNV(GLsizei,const GLuint*){}
+static void null_glGetBufferParameteri64v(GLenum,GLenum,GLint64*){}
+static void null_glProgramUniform4dv(GLuint,GLint,GLsizei,const GLdouble*){}
+static void null_glEdgeFlagPointerEXT(GLsizei,GLsizei,const GLboolean*){}
+static void null_glVideoCaptureStreamParameterivNV(GLuint,GLuint,GLenum,const GLint*){}
+static void null_glVertexStream4iATI(GLenum,GLint,GLint,GLint,GLint){}
+static void null_glVDPAUFiniNV(){}
+static void null_glMakeBufferNonResidentNV(GLenum){}
+static void null_glUniform1ui64ARB(GLint,GLuint64){}
+static void null_glStencilStrokePathNV(GLuint,GLint,GLuint){}
+static void null_glProgramUniform3uiv(GLuint,GLint,GLsizei,const GLuint*){}
+static void null_glVariantuivEXT(GLuint,const GLuint*){}
+static void null_glCopyTexSubImage3DEXT(GLenum,GLint,GLint,GLint,GLint,GLint,GLint,GLsizei,GLsizei){}
+static void null_glSpriteParameteriSGIX(GLenum,GLint){}
+static void null_glMultiTexCoord1sARB(GLenum,GLshort){}
+static void null_glConvolutionParameterfv(GLenum,GLenum,const GLfloat*){}
+static void null_glMakeTextureHandleResidentNV(GLuint64){}
+static void null_glMultMatrixxOES(const GLfixed*){}
+static void null_glTextureNormalEXT(GLenum){}
+static void null_glGetQueryivARB(GLenum,GLenum,GLint*){}
+static void null_glCompressedMultiTexImage3DEXT(GLenum,GLenum,GLint,GLenum,GLsizei,GLsizei,GLsizei,GLint,GLsizei,const void*){}
+static GLint null_glGetInstrumentsSGIX(){return (GLint)0;}
+static void null_glProgramUniformMatrix4x3fvEXT(GLuint,GLint,GLsizei,GLboolean,const GLfloat*){}
+static void null_glPointParameterf(GLenum,GLfloat){}
+static void null_glProgramUniform3dEXT(GLuint,GLint,GLdouble,GLdouble,GLdouble){}
+static void null_glMultiTexCoord2hNV(GLenum,GLhalfNV,GLhalfNV){}
+static void null_glGetConvolutionFilterEXT(GLenum,GLenum,GLenum,void*){}
+static void null_glVertexAttrib2hNV(GLuint,GLhalfNV,GLhalfNV){}
+static void null_glCurrentPaletteMatrixARB(GLint){}
+static void null_glFogxvOES(GLenum,const GLfixed*){}
+static void null_glCreateRenderbuffers(GLsizei,GLuint*){}
+static void null_glVertexAttrib4Nusv(GLuint,const GLushort*){}
+static void null_glCombinerInputNV(GLenum,GLenum,GLenum,GLenum,GLenum,GLenum){}
+static void null_glDepthFunc(GLenum){}
+static void null_glWindowPos4fMESA(GLfloat,GLfloat,GLfloat,GLfloat){}
+static void null_glEnableClientStateIndexedEXT(GLenum,GLuint){}
+static void null_glTexCoord4iv(const GLint*){}
+static void null_glProgramUniform4i64ARB(GLuint,GLint,GLint64,GLint64,GLint64,GLint64){}
+static void null_glBlendFunci(GLuint,GLenum,GLenum){}
+static void null_glResolveDepthValuesNV(){}
+static void null_glTextureColorMaskSGIS(GLboolean,GLboolean,GLboolean,GLboolean){}
+static GLuint null_glCreateShaderProgramEXT(GLenum,const GLchar*){return (GLuint)0;}
+static void null_glBufferStorage(GLenum,GLsizeiptr,const void*,GLbitfield){}
+static void null_glMakeNamedBufferNonResidentNV(GLuint){}
+static void null_glRenderbufferStorageMultisampleEXT(GLenum,GLsizei,GLenum,GLsizei,GLsizei){}
+static void null_glGetFloati_v(GLenum,GLuint,GLfloat*){}
+static void null_glUniform2ui64ARB(GLint,GLuint64,GLuint64){}
+static void null_glVertex3fv(const GLfloat*){}
+static GLint null_glGetUniformLocation(GLuint,const GLchar*){return (GLint)0;}
+static void null_glVertexStream1svATI(GLenum,const GLshort*){}
+static void null_glVertexStream3fATI(GLenum,GLfloat,GLfloat,GLfloat){}
+static void null_glNamedFramebufferDrawBuffers(GLuint,GLsizei,const GLenum*){}
+static void null_glUniform2ui64vNV(GLint,GLsizei,const GLuint64EXT*){}
+static void null_glTexCoordPointervINTEL(GLint,GLenum,const void**){}
+static void null_glUniform4fv(GLint,GLsizei,const GLfloat*){}
+static void null_glNormalPointerEXT(GLenum,GLsizei,GLsizei,const void*){}
+static void null_glVertexAttrib4hNV(GLuint,GLhalfNV,GLhalfNV,GLhalfNV,GLhalfNV){}
+static void null_glNormal3f(GLfloat,GLfloat,GLfloat){}
+static void null_glVertexStream2iATI(GLenum,GLint,GLint){}
+static void null_glVertexAttribP4uiv(GLuint,GLenum,GLboolean,const GLuint*){}
+static void null_glCompressedTextureSubImage3D(GLuint,GLint,GLint,GLint,GLint,GLsizei,GLsizei,GLsizei,GLenum,GLsizei,const void*){}
+static void null_glAsyncMarkerSGIX(GLuint){}
+static void null_glTextureStorageSparseAMD(GLuint,GLenum,GLenum,GLsizei,GLsizei,GLsizei,GLsizei,GLbitfield){}
+static void null_glGetConvolutionParameterivEXT(GLenum,GLenum,GLint*){}
+static void null_glEndPerfQueryINTEL(GLuint){}
+static void null_glFragmentLightModeliSGIX(GLenum,GLint){}
+static void null_glPrioritizeTexturesEXT(GLsizei,const GLuint*,const GLclampf*){}
+static void null_glEndConditionalRender(){}
+static void null_glEnableClientState(GLenum){}
+static void null_glResetHistogram(GLenum){}
+static void null_glGetOcclusionQueryivNV(GLuint,GLenum,GLint*){}
+static void null_glUniform1uiEXT(GLint,GLuint){}
+static void null_glMultiTexCoord2sv(GLenum,const GLshort*){}
+static void null_glTexSubImage2DEXT(GLenum,GLint,GLint,GLint,GLsizei,GLsizei,GLenum,GLenum,const void*){}
+static void null_glProgramUniform2uiv(GLuint,GLint,GLsizei,const GLuint*){}
+static void null_glMultiTexCoord2iARB(GLenum,GLint,GLint){}
+static void null_glGetQueryObjectuiv(GLuint,GLenum,GLuint*){}
+static void null_glGenerateMultiTexMipmapEXT(GLenum,GLenum){}
+static void null_glVertexAttrib4iv(GLuint,const GLint*){}
+static void null_glWindowPos3dvMESA(const GLdouble*){}
+static void null_glLabelObjectEXT(GLenum,GLuint,GLsizei,const GLchar*){}
+static void null_glProgramUniform1uiv(GLuint,GLint,GLsizei,const GLuint*){}
+static void null_glFramebufferTexture(GLenum,GLenum,GLuint,GLint){}
+static void null_glMultiTexEnvfEXT(GLenum,GLenum,GLenum,GLfloat){}
+static void null_glGetTexGendv(GLenum,GLenum,GLdouble*){}
+static void null_glVertex4xOES(GLfixed,GLfixed,GLfixed){}
+static void null_glVertexAttribI2uivEXT(GLuint,const GLuint*){}
+static void null_glNamedProgramLocalParameter4fvEXT(GLuint,GLenum,GLuint,const GLfloat*){}
+static void null_glPointParameterfvSGIS(GLenum,const GLfloat*){}
+static void null_glGetPixelTransformParameterfvEXT(GLenum,GLenum,GLfloat*){}
+static void null_glIndexxvOES(const GLfixed*){}
+static void null_glDepthMask(GLboolean){}
+static void null_glProgramUniformMatrix2x4fv(GLuint,GLint,GLsizei,GLboolean,const GLfloat*){}
+static GLboolean null_glAreProgramsResidentNV(GLsizei,const GLuint*,GLboolean*){return (GLboolean)0;}
+static void null_glColorTable(GLenum,GLenum,GLsizei,GLenum,GLenum,const GLvoid*){}
+static void null_glBeginQueryIndexed(GLenum,GLuint,GLuint){}
+static void null_glVertexStream1dvATI(GLenum,const GLdouble*){}
+static void null_glGetMultiTexEnvfvEXT(GLenum,GLenum,GLenum,GLfloat*){}
+static void null_glDeleteFencesNV(GLsizei,const GLuint*){}
+static void null_glVertexAttribs1dvNV(GLuint,GLsizei,const GLdouble*){}
+static void null_glVertexStream2sATI(GLenum,GLshort,GLshort){}
+static void null_glGetnSeparableFilterARB(GLenum,GLenum,GLenum,GLsizei,void*,GLsizei,void*,void*){}
+static void null_glProgramUniform2dv(GLuint,GLint,GLsizei,const GLdouble*){}
+static void null_glActiveStencilFaceEXT(GLenum){}
+static void null_glProgramUniform4dEXT(GLuint,GLint,GLdouble,GLdouble,GLdouble,GLdouble){}
+static void null_glPointSizexOES(GLfixed){}
+static void null_glRasterPos2sv(const GLshort*){}
+static GLuint null_glBindParameterEXT(GLenum){return (GLuint)0;}
+static void null_glTexCoord1sv(const GLshort*){}
+static void null_glBlendParameteriNV(GLenum,GLint){}
+static void null_glNamedProgramLocalParameter4dvEXT(GLuint,GLenum,GLuint,const GLdouble*){}
+static void null_glProgramUniformHandleui64NV(GLuint,GLint,GLuint64){}
+static void null_glGetTextureParameterfvEXT(GLuint,GLenum,GLenum,GLfloat*){}
+static void null_glGetPathMetricsNV(GLbitfield,GLsizei,GLenum,const void*,GLuint,GLsizei,GLfloat*){}
+static void null_glVertex2i(GLint,GLint){}
+static void null_glNewList(GLuint,GLenum){}
+static void null_glMatrixLoad3x3fNV(GLenum,const GLfloat*){}
+static void null_glMultiTexCoord2fARB(GLenum,GLfloat,GLfloat){}
+static void null_glWeightdvARB(GLint,const GLdouble*){}
+static GLboolean null_glIsTransformFeedbackNV(GLuint){return (GLboolean)0;}
+static void null_glVertexAttribDivisorARB(GLuint,GLuint){}
+static void null_glSecondaryColorP3uiv(GLenum,const GLuint*){}
+static void null_glGetnCompressedTexImageARB(GLenum,GLint,GLsizei,void*){}
+static void null_glGetIntegerv(GLenum,GLint*){}
+static void null_glMatrixLoaddEXT(GLenum,const GLdouble*){}
+static GLfloat null_glGetPathLengthNV(GLuint,GLsizei,GLsizei){return (GLfloat)0;}
+static void null_glProgramUniformMatrix3dv(GLuint,GLint,GLsizei,GLboolean,const GLdouble*){}
+static void null_glUniform4i64NV(GLint,GLint64EXT,GLint64EXT,GLint64EXT,GLint64EXT){}
+static void null_glGetHistogramEXT(GLenum,GLboolean,GLenum,GLenum,void*){}
+static void null_glVertexAttrib4NuivARB(GLuint,const GLuint*){}
+static void null_glMapGrid2xOES(GLint,GLfixed,GLfixed,GLfixed,GLfixed){}
+static void null_glTexImage2D(GLenum,GLint,GLint,GLsizei,GLsizei,GLint,GLenum,GLenum,const GLvoid*){}
+static void null_glWindowPos2fvARB(const GLfloat*){}
+static void null_glEnableIndexedEXT(GLenum,GLuint){}
+static void null_glTexCoord1bvOES(const GLbyte*){}
+static void null_glDrawPixels(GLsizei,GLsizei,GLenum,GLenum,const GLvoid*){}
+static void null_glMultMatrixd(const GLdouble*){}
+static void null_glMultMatrixf(const GLfloat*){}
+static void null_glReplacementCodePointerSUN(GLenum,GLsizei,const void**){}
+static void null_glLoadTransposeMatrixdARB(const GLdouble*){}
+static void null_glVertexAttrib4Nubv(GLuint,const GLubyte*){}
+static void null_glVertexArrayVertexAttribIOffsetEXT(GLuint,GLuint,GLuint,GLint,GLenum,GLsizei,GLintptr){}
+static void null_glCompileShaderARB(GLhandleARB){}
+static void null_glWindowPos3dMESA(GLdouble,GLdouble,GLdouble){}
+static void null_glNormalStream3fvATI(GLenum,const GLfloat*){}
+static void null_glColor4usv(const GLushort*){}
+static void null_glMapGrid1f(GLint,GLfloat,GLfloat){}
+static void null_glPolygonStipple(const GLubyte*){}
+static void null_glUniform4ui64ARB(GLint,GLuint64,GLuint64,GLuint64,GLuint64){}
+static void null_glTextureRenderbufferEXT(GLuint,GLenum,GLuint){}
+static GLint null_glGetSubroutineUniformLocation(GLuint,GLenum,const GLchar*){return (GLint)0;}
+static void null_glGetFramebufferParameteriv(GLenum,GLenum,GLint*){}
+static void null_glPixelMapusv(GLenum,GLsizei,const GLushort*){}
+static void null_glGetSamplerParameteriv(GLuint,GLenum,GLint*){}
+static void null_glVertexStream2fvATI(GLenum,const GLfloat*){}
+static void null_glProgramStringARB(GLenum,GLenum,GLsizei,const void*){}
+static void null_glProgramUniformMatrix3dvEXT(GLuint,GLint,GLsizei,GLboolean,const GLdouble*){}
+static void null_glSeparableFilter2D(GLenum,GLenum,GLsizei,GLsizei,GLenum,GLenum,const GLvoid*,const GLvoid*){}
+static void null_glVertexAttribI1uiv(GLuint,const GLuint*){}
+static void null_glTexStorage2D(GLenum,GLsizei,GLenum,GLsizei,GLsizei){}
+static void null_glColor3fv(const GLfloat*){}
+static void null_glVertexAttribL4dvEXT(GLuint,const GLdouble*){}
+static void null_glGetActiveUniform(GLuint,GLuint,GLsizei,GLsizei*,GLint*,GLenum*,GLchar*){}
+static void null_glUniform2ui64vARB(GLint,GLsizei,const GLuint64*){}
+static void null_glMakeNamedBufferResidentNV(GLuint,GLenum){}
+static GLenum null_glPathGlyphIndexRangeNV(GLenum,const void*,GLbitfield,GLuint,GLfloat,GLuint*){return (GLenum)0;}
+static void null_glColorPointer(GLint,GLenum,GLsizei,const GLvoid*){}
+static void null_glProgramEnvParameterI4ivNV(GLenum,GLuint,const GLint*){}
+static void null_glMultiTexParameterfEXT(GLenum,GLenum,GLenum,GLfloat){}
+static void null_glNamedFramebufferTextureLayer(GLuint,GLenum,GLuint,GLint,GLint){}
+static void null_glGetVertexArrayIntegervEXT(GLuint,GLenum,GLint*){}
+static void null_glVertexAttrib3dARB(GLuint,GLdouble,GLdouble,GLdouble){}
+static GLboolean null_glVDPAUIsSurfaceNV(GLvdpauSurfaceNV){return (GLboolean)0;}
+static void null_glMultiTexImage1DEXT(GLenum,GLenum,GLint,GLint,GLsizei,GLint,GLenum,GLenum,const void*){}
+static GLboolean null_glIsAsyncMarkerSGIX(GLuint){return (GLboolean)0;}
+static void null_glGetDoublei_vEXT(GLenum,GLuint,GLdouble*){}
+static void null_glUniform2i64NV(GLint,GLint64EXT,GLint64EXT){}
+static GLboolean null_glIsCommandListNV(GLuint){return (GLboolean)0;}
+static void null_glUniform3uiEXT(GLint,GLuint,GLuint,GLuint){}
+static void null_glTexParameterIuivEXT(GLenum,GLenum,const GLuint*){}
+static void null_glProgramUniformMatrix4fv(GLuint,GLint,GLsizei,GLboolean,const GLfloat*){}
+static void null_glVertex2fv(const GLfloat*){}
+static void null_glVertexAttribL3dEXT(GLuint,GLdouble,GLdouble,GLdouble){}
+static void null_glFramebufferRenderbuffer(GLenum,GLenum,GLenum,GLuint){}
+static GLint null_glGetUniformLocationARB(GLhandleARB,const GLcharARB*){return (GLint)0;}
+static void null_glPathParameterfvNV(GLuint,GLenum,const GLfloat*){}
+static void null_glVertexAttrib3sNV(GLuint,GLshort,GLshort,GLshort){}
+static void null_glGetDoublei_v(GLenum,GLuint,GLdouble*){}
+static void null_glVertexAttrib1sv(GLuint,const GLshort*){}
+static void null_glBindSampler(GLuint,GLuint){}
+static void null_glLineWidth(GLfloat){}
+static void null_glVertexArrayRangeAPPLE(GLsizei,void*){}
+static void null_glBindBufferOffsetEXT(GLenum,GLuint,GLuint,GLintptr){}
+static void null_glWeightfvARB(GLint,const GLfloat*){}
+static void null_glGetIntegeri_v(GLenum,GLuint,GLint*){}
+static void null_glGetTransformFeedbackVarying(GLuint,GLuint,GLsizei,GLsizei*,GLsizei*,GLenum*,GLchar*){}
+static void null_glProgramLocalParameter4fvARB(GLenum,GLuint,const GLfloat*){}
+static void null_glGetTransformFeedbackVaryingNV(GLuint,GLuint,GLint*){}
+static void null_glWindowPos2iv(const GLint*){}
+static void null_glVertexStream1dATI(GLenum,GLdouble){}
+static void null_glColorFragmentOp2ATI(GLenum,GLuint,GLuint,GLuint,GLuint,GLuint,GLuint,GLuint,GLuint,GLuint){}
+static void null_glFogiv(GLenum,const GLint*){}
+static GLuint64 null_glGetTextureHandleNV(GLuint){return (GLuint64)0;}
+static void null_glLightModeliv(GLenum,const GLint*){}
+static void null_glDepthRangef(GLfloat,GLfloat){}
+static void null_glGetFragmentMaterialivSGIX(GLenum,GLenum,GLint*){}
+static void null_glVideoCaptureStreamParameterfvNV(GLuint,GLuint,GLenum,const GLfloat*){}
+static void null_glDeleteProgramsARB(GLsizei,const GLuint*){}
+static void null_glWindowPos3fvARB(const GLfloat*){}
+static void null_glFeedbackBufferxOES(GLsizei,GLenum,const GLfixed*){}
+static void null_glGetTexBumpParameterfvATI(GLenum,GLfloat*){}
+static void null_glEnablei(GLenum,GLuint){}
+static void null_glGetActiveSubroutineName(GLuint,GLenum,GLuint,GLsizei,GLsizei*,GLchar*){}
+static void null_glDrawBuffersARB(GLsizei,const GLenum*){}
+static void null_glBindProgramARB(GLenum,GLuint){}
+static void null_glEvalCoord1fv(const GLfloat*){}
+static void null_glProgramUniform3ui64vARB(GLuint,GLint,GLsizei,const GLuint64*){}
+static void null_glProgramUniformMatrix2dv(GLuint,GLint,GLsizei,GLboolean,const GLdouble*){}
+static void null_glMultiTexCoord2hvNV(GLenum,const GLhalfNV*){}
+static void null_glGetFloatIndexedvEXT(GLenum,GLuint,GLfloat*){}
+static void null_glSampleCoverageARB(GLfloat,GLboolean){}
+static void null_glProgramUniform2ui64vARB(GLuint,GLint,GLsizei,const GLuint64*){}
+static void null_glPixelDataRangeNV(GLenum,GLsizei,const void*){}
+static void null_glVertexStream3svATI(GLenum,const GLshort*){}
+static void null_glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN(const GLuint*,const GLfloat*,const GLfloat*,const GLfloat*){}
+static void null_glTexCoord3hvNV(const GLhalfNV*){}
+static void null_glSampleMaski(GLuint,GLbitfield){}
+static void null_glIndexFuncEXT(GLenum,GLclampf){}
+static void null_glPointParameteriNV(GLenum,GLint){}
+static void null_glUniformMatrix3x2fv(GLint,GLsizei,GLboolean,const GLfloat*){}
+static void null_glGetFramebufferParameterivEXT(GLuint,GLenum,GLint*){}
+static void null_glUniform2i64ARB(GLint,GLint64,GLint64){}
+static void null_glNamedBufferStorageEXT(GLuint,GLsizeiptr,const void*,GLbitfield){}
+static void null_glNamedFramebufferTexture3DEXT(GLuint,GLenum,GLenum,GLuint,GLint,GLint){}
+static void null_glVertexAttrib2dv(GLuint,const GLdouble*){}
+static void null_glGetVertexArrayPointervEXT(GLuint,GLenum,void**){}
+static void null_glGetVertexAttribArrayObjectivATI(GLuint,GLenum,GLint*){}
+static void null_glProgramUniformMatrix3fvEXT(GLuint,GLint,GLsizei,GLboolean,const GLfloat*){}
+static void null_glEnableVertexArrayEXT(GLuint,GLenum){}
+static void null_glColorTableParameterfvSGI(GLenum,GLenum,const GLfloat*){}
+static void null_glEdgeFlag(GLboolean){}
+static void null_glFogCoordf(GLfloat){}
+static void null_glVertex3d(GLdouble,GLdouble,GLdouble){}
+static void null_glVertex3f(GLfloat,GLfloat,GLfloat){}
+static void null_glSpriteParameterivSGIX(GLenum,const GLint*){}
+static void null_glPathGlyphRangeNV(GLuint,GLenum,const void*,GLbitfield,GLuint,GLsizei,GLenum,GLuint,GLfloat){}
+static void null_glPrimitiveBoundingBoxARB(GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat){}
+static void null_glVertexAttribL3ui64vNV(GLuint,const GLuint64EXT*){}
+static void null_glVertex3s(GLshort,GLshort,GLshort){}
+static void null_glTexCoordP2ui(GLenum,GLuint){}
+static void null_glProgramUniform2fvEXT(GLuint,GLint,GLsizei,const GLfloat*){}
+static void null_glDeletePathsNV(GLuint,GLsizei){}
+static void null_glPrimitiveRestartIndexNV(GLuint){}
+static void null_glTexCoord2fColor3fVertex3fvSUN(const GLfloat*,const GLfloat*,const GLfloat*){}
+static void null_glTexCoordPointerListIBM(GLint,GLenum,GLint,const void**,GLint){}
+static void null_glRectxOES(GLfixed,GLfixed,GLfixed,GLfixed){}
+static void null_glCopyNamedBufferSubData(GLuint,GLuint,GLintptr,GLintptr,GLsizeiptr){}
+static void null_glGenProgramsNV(GLsizei,GLuint*){}
+static void null_glFragmentLightfSGIX(GLenum,GLenum,GLfloat){}
+static void null_glTexStorage3D(GLenum,GLsizei,GLenum,GLsizei,GLsizei,GLsizei){}
+static void null_glTextureParameteriv(GLuint,GLenum,const GLint*){}
+static void null_glNamedBufferDataEXT(GLuint,GLsizeiptr,const void*,GLenum){}
+static void null_glMultiTexCoord3fvARB(GLenum,const GLfloat*){}
+static void null_glUniformMatrix3x4fv(GLint,GLsizei,GLboolean,const GLfloat*){}
+static void null_glSubpixelPrecisionBiasNV(GLuint,GLuint){}
+static void null_glNormalPointer(GLenum,GLsizei,const GLvoid*){}
+static void null_glNamedFramebufferTexture(GLuint,GLenum,GLuint,GLint){}
+static void null_glVertexAttrib4NsvARB(GLuint,const GLshort*){}
+static void null_glPassThrough(GLfloat){}
+static void null_glSecondaryColorP3ui(GLenum,GLuint){}
+static void null_glInvalidateTexSubImage(GLuint,GLint,GLint,GLint,GLint,GLsizei,GLsizei,GLsizei){}
+static GLboolean null_glIsImageHandleResidentARB(GLuint64){return (GLboolean)0;}
+static void null_glTangent3fvEXT(const GLfloat*){}
+static void null_glProgramUniformMatrix4x3fv(GLuint,GLint,GLsizei,GLboolean,const GLfloat*){}
+static void null_glBegin(GLenum){}
+static void null_glEvalCoord2dv(const GLdouble*){}
+static void null_glColor3ubv(const GLubyte*){}
+static void null_glFogCoordfvEXT(const GLfloat*){}
+static void null_glVertexP3ui(GLenum,GLuint){}
+static void null_glLightfv(GLenum,GLenum,const GLfloat*){}
+static void null_glVertexAttribL3i64NV(GLuint,GLint64EXT,GLint64EXT,GLint64EXT){}
+static void null_glStencilClearTagEXT(GLsizei,GLuint){}
+static void null_glGetActiveUniformName(GLuint,GLuint,GLsizei,GLsizei*,GLchar*){}
+static void null_glTangentPointerEXT(GLenum,GLsizei,const void*){}
+static void null_glUniform4ui64vNV(GLint,GLsizei,const GLuint64EXT*){}
+static void null_glDebugMessageEnableAMD(GLenum,GLenum,GLsizei,const GLuint*,GLboolean){}
+static void null_glProgramUniform2ui(GLuint,GLint,GLuint,GLuint){}
+static void null_glCopyTexSubImage2DEXT(GLenum,GLint,GLint,GLint,GLint,GLint,GLsizei,GLsizei){}
+static void null_glGenRenderbuffersEXT(GLsizei,GLuint*){}
+static void null_glNamedProgramLocalParameterI4ivEXT(GLuint,GLenum,GLuint,const GLint*){}
+static void null_glMultiTexCoord2f(GLenum,GLfloat,GLfloat){}
+static void null_glMapGrid2d(GLint,GLdouble,GLdouble,GLint,GLdouble,GLdouble){}
+static void null_glGetMultiTexParameterIuivEXT(GLenum,GLenum,GLenum,GLuint*){}
+static void null_glBlendEquationiARB(GLuint,GLenum){}
+static void null_glTexParameteriv(GLenum,GLenum,const GLint*){}
+static void null_glUniform4ivARB(GLint,GLsizei,const GLint*){}
+static void null_glMatrixOrthoEXT(GLenum,GLdouble,GLdouble,GLdouble,GLdouble,GLdouble,GLdouble){}
+static void null_glVertexArrayVertexBuffer(GLuint,GLuint,GLuint,GLintptr,GLsizei){}
+static void null_glProgramLocalParametersI4ivNV(GLenum,GLuint,GLsizei,const GLint*){}
+static void null_glProgramUniform4ui64vNV(GLuint,GLint,GLsizei,const GLuint64EXT*){}
+static void null_glGetNamedStringivARB(GLint,const GLchar*,GLenum,GLint*){}
+static void null_glVertexAttribL1i64vNV(GLuint,const GLint64EXT*){}
+static void null_glTransformFeedbackBufferBase(GLuint,GLuint,GLuint){}
+static void null_glIndexsv(const GLshort*){}
+static void null_glPointParameterivNV(GLenum,const GLint*){}
+static void null_glGetDetailTexFuncSGIS(GLenum,GLfloat*){}
+static void null_glReplacementCodeuiColor3fVertex3fvSUN(const GLuint*,const GLfloat*,const GLfloat*){}
+static void null_glProgramLocalParameter4fARB(GLenum,GLuint,GLfloat,GLfloat,GLfloat,GLfloat){}
+static void null_glBitmap(GLsizei,GLsizei,GLfloat,GLfloat,GLfloat,GLfloat,const GLubyte*){}
+static void null_glNamedFramebufferTextureLayerEXT(GLuint,GLenum,GLuint,GLint,GLint){}
+static void null_glMultiTexGenfvEXT(GLenum,GLenum,GLenum,const GLfloat*){}
+static void null_glGetNamedBufferSubData(GLuint,GLintptr,GLsizeiptr,void*){}
+static void null_glStencilFuncSeparateATI(GLenum,GLenum,GLint,GLuint){}
+static void null_glProgramUniform2iv(GLuint,GLint,GLsizei,const GLint*){}
+static void null_glGetQueryiv(GLenum,GLenum,GLint*){}
+static void null_glTexCoord4f(GLfloat,GLfloat,GLfloat,GLfloat){}
+static void null_glMapGrid2f(GLint,GLfloat,GLfloat,GLint,GLfloat,GLfloat){}
+static void null_glListParameterivSGIX(GLuint,GLenum,const GLint*){}
+static void null_glCreateQueries(GLenum,GLsizei,GLuint*){}
+static void null_glGetSamplerParameterfv(GLuint,GLenum,GLfloat*){}
+static void null_glTexCoord4i(GLint,GLint,GLint,GLint){}
+static void null_glObjectLabel(GLenum,GLuint,GLsizei,const GLchar*){}
+static void null_glProgramUniform3i64NV(GLuint,GLint,GLint64EXT,GLint64EXT,GLint64EXT){}
+static GLuint64 null_glGetTextureHandleARB(GLuint){return (GLuint64)0;}
+static void null_glTexCoord4s(GLshort,GLshort,GLshort,GLshort){}
+static void null_glUniform4iARB(GLint,GLint,GLint,GLint,GLint){}
+static void null_glGetUniformIndices(GLuint,GLsizei,const GLchar*const*,GLuint*){}
+static void null_glMultiTexImage3DEXT(GLenum,GLenum,GLint,GLint,GLsizei,GLsizei,GLsizei,GLint,GLenum,GLenum,const void*){}
+static void null_glCoverageModulationTableNV(GLsizei,const GLfloat*){}
+static void null_glPointParameteriv(GLenum,const GLint*){}
+static void null_glMultiTexCoord4svARB(GLenum,const GLshort*){}
+static void null_glNormal3fv(const GLfloat*){}
+static void null_glProgramUniformMatrix3x4dvEXT(GLuint,GLint,GLsizei,GLboolean,const GLdouble*){}
+static void null_glTexCoord1fv(const GLfloat*){}
+static void null_glProgramUniformMatrix4x3dvEXT(GLuint,GLint,GLsizei,GLboolean,const GLdouble*){}
+static void null_glGetActiveVaryingNV(GLuint,GLuint,GLsizei,GLsizei*,GLsizei*,GLenum*,GLchar*){}
+static void null_glUniform1i64vARB(GLint,GLsizei,const GLint64*){}
+static void null_glMultiTexCoord1dv(GLenum,const GLdouble*){}
+static void null_glTexCoord3fv(const GLfloat*){}
+static void null_glMatrixTranslatefEXT(GLenum,GLfloat,GLfloat,GLfloat){}
+static void null_glProgramUniform1ui64vNV(GLuint,GLint,GLsizei,const GLuint64EXT*){}
+static void null_glTextureMaterialEXT(GLenum,GLenum){}
+static void null_glMultiTexCoordP3uiv(GLenum,GLenum,const GLuint*){}
+static void null_glVertexAttribP3ui(GLuint,GLenum,GLboolean,GLuint){}
+static void null_glInterpolatePathsNV(GLuint,GLuint,GLuint,GLfloat){}
+static void null_glTextureBufferRange(GLuint,GLenum,GLuint,GLintptr,GLsizeiptr){}
+static void null_glVertexAttribL2dEXT(GLuint,GLdouble,GLdouble){}
+static void null_glGetPixelTransformParameterivEXT(GLenum,GLenum,GLint*){}
+static void null_glTexCoord4xvOES(const GLfixed*){}
+static void null_glGetVariantBooleanvEXT(GLuint,GLenum,GLboolean*){}
+static void null_glDepthRange(GLclampd,GLclampd){}
+static void null_glGetVertexAttribdvARB(GLuint,GLenum,GLdouble*){}
+static void null_glGetColorTableParameterfv(GLenum,GLenum,GLfloat*){}
+static void null_glDrawArraysInstancedEXT(GLenum,GLint,GLsizei,GLsizei){}
+static void null_glDisableClientStateIndexedEXT(GLenum,GLuint){}
+static void null_glDrawBuffer(GLenum){}
+static void null_glMultiDrawArraysIndirectBindlessNV(GLenum,const void*,GLsizei,GLsizei,GLint){}
+static void null_glGetnPixelMapusv(GLenum,GLsizei,GLushort*){}
+static void null_glRasterPos3fv(const GLfloat*){}
+static void null_glClearBufferuiv(GLenum,GLint,const GLuint*){}
+static void null_glGetInternalformati64v(GLenum,GLenum,GLenum,GLsizei,GLint64*){}
+static void null_glShaderSourceARB(GLhandleARB,GLsizei,const GLcharARB**,const GLint*){}
+static void null_glShaderOp3EXT(GLenum,GLuint,GLuint,GLuint,GLuint){}
+static void null_glWindowPos2dvMESA(const GLdouble*){}
+static void null_glClearIndex(GLfloat){}
+static void null_glProvokingVertexEXT(GLenum){}
+static void null_glVariantubvEXT(GLuint,const GLubyte*){}
+static void null_glFlush(){}
+static void null_glGetColorTableParameterivEXT(GLenum,GLenum,GLint*){}
+static void null_glPresentFrameDualFillNV(GLuint,GLuint64EXT,GLuint,GLuint,GLenum,GLenum,GLuint,GLenum,GLuint,GLenum,GLuint,GLenum,GLuint){}
+static GLuint null_glGenVertexShadersEXT(GLuint){return (GLuint)0;}
+static void null_glProgramUniformHandleui64vARB(GLuint,GLint,GLsizei,const GLuint64*){}
+static void null_glDepthRangefOES(GLclampf,GLclampf){}
+static void null_glDrawElementsInstancedBaseVertexBaseInstance(GLenum,GLsizei,GLenum,const void*,GLsizei,GLint,GLuint){}
+static void null_glGetTexLevelParameteriv(GLenum,GLint,GLenum,GLint*){}
+static void null_glStencilFillPathNV(GLuint,GLenum,GLuint){}
+static void null_glWindowPos3iARB(GLint,GLint,GLint){}
+static void null_glPrioritizeTextures(GLsizei,const GLuint*,const GLclampf*){}
+static void null_glWindowPos3fvMESA(const GLfloat*){}
+static void null_glProgramUniformMatrix3x2dvEXT(GLuint,GLint,GLsizei,GLboolean,const GLdouble*){}
+static void null_glVertex4xvOES(const GLfixed*){}
+static void null_glTexStorage3DMultisample(GLenum,GLsizei,GLenum,GLsizei,GLsizei,GLsizei,GLboolean){}
+static void null_glWindowPos2sARB(GLshort,GLshort){}
+static void null_glStencilOpValueAMD(GLenum,GLuint){}
+static void null_glProgramVertexLimitNV(GLenum,GLint){}
+static void null_glGetTexParameterPointervAPPLE(GLenum,GLenum,void**){}
+static void null_glProgramUniform3uivEXT(GLuint,GLint,GLsizei,const GLuint*){}
+static void null_glClampColor(GLenum,GLenum){}
+static void null_glClearStencil(GLint){}
+static void null_glTexCoordP1uiv(GLenum,const GLuint*){}
+static void null_glVertexAttribs3svNV(GLuint,GLsizei,const GLshort*){}
+static void null_glMultiTexCoord3fv(GLenum,const GLfloat*){}
+static void null_glVertexBlendEnvfATI(GLenum,GLfloat){}
+static GLboolean null_glIsFenceAPPLE(GLuint){return (GLboolean)0;}
+static void null_glGetBufferParameterui64vNV(GLenum,GLenum,GLuint64EXT*){}
+static void null_glVertexAttribI4bvEXT(GLuint,const GLbyte*){}
+static void null_glUniform2fARB(GLint,GLfloat,GLfloat){}
+static void null_glStopInstrumentsSGIX(GLint){}
+static void null_glVertexAttrib3fNV(GLuint,GLfloat,GLfloat,GLfloat){}
+static void null_glMapVertexAttrib2dAPPLE(GLuint,GLuint,GLdouble,GLdouble,GLint,GLint,GLdouble,GLdouble,GLint,GLint,const GLdouble*){}
+static void null_glVertex2f(GLfloat,GLfloat){}
+static void null_glCopyTextureImage2DEXT(GLuint,GLenum,GLint,GLenum,GLint,GLint,GLsizei,GLsizei,GLint){}
+static void null_glVertex2d(GLdouble,GLdouble){}
+static void null_glSecondaryColor3bvEXT(const GLbyte*){}
+static void null_glMultiTexCoord4fARB(GLenum,GLfloat,GLfloat,GLfloat,GLfloat){}
+static void null_glPolygonOffset(GLfloat,GLfloat){}
+static void null_glTangent3bvEXT(const GLbyte*){}
+static void null_glHistogram(GLenum,GLsizei,GLenum,GLboolean){}
+static void null_glGetProgramiv(GLuint,GLenum,GLint*){}
+static void null_glMatrixIndexubvARB(GLint,const GLubyte*){}
+static void null_glVertex2s(GLshort,GLshort){}
+static void null_glGetVertexAttribLui64vNV(GLuint,GLenum,GLuint64EXT*){}
+static void null_glGetProgramStringARB(GLenum,GLenum,void*){}
+static void null_glFlushMappedBufferRange(GLenum,GLintptr,GLsizeiptr){}
+static void null_glVertexAttribI3uiEXT(GLuint,GLuint,GLuint,GLuint){}
+static void null_glLineWidthxOES(GLfixed){}
+static void null_glProgramUniformMatrix2fvEXT(GLuint,GLint,GLsizei,GLboolean,const GLfloat*){}
+static void null_glGetTextureParameterIuivEXT(GLuint,GLenum,GLenum,GLuint*){}
+static void null_glGetMultiTexEnvivEXT(GLenum,GLenum,GLenum,GLint*){}
+static void null_glPixelTexGenParameterivSGIS(GLenum,const GLint*){}
+static void null_glGenQueries(GLsizei,GLuint*){}
+static void null_glGetPixelMapfv(GLenum,GLfloat*){}
+static void null_glBlendColorEXT(GLfloat,GLfloat,GLfloat,GLfloat){}
+static void null_glResetMinmax(GLenum){}
+static void null_glGetnUniformivARB(GLuint,GLint,GLsizei,GLint*){}
+static void null_glVertexBlendARB(GLint){}
+static void null_glVertexAttrib4d(GLuint,GLdouble,GLdouble,GLdouble,GLdouble){}
+static GLint null_glGetVaryingLocationNV(GLuint,const GLchar*){return (GLint)0;}
+static void null_glGetMapAttribParameterivNV(GLenum,GLuint,GLenum,GLint*){}
+static void null_glTexSubImage3D(GLenum,GLint,GLint,GLint,GLint,GLsizei,GLsizei,GLsizei,GLenum,GLenum,const GLvoid*){}
+static void null_glDeleteSamplers(GLsizei,const GLuint*){}
+static void null_glGetLightxOES(GLenum,GLenum,GLfixed*){}
+static void null_glGetVertexAttribArrayObjectfvATI(GLuint,GLenum,GLfloat*){}
+static void null_glVertexArrayNormalOffsetEXT(GLuint,GLuint,GLenum,GLsizei,GLintptr){}
+static void null_glGetBufferParameterivARB(GLenum,GLenum,GLint*){}
+static void null_glGetTextureParameterfv(GLuint,GLenum,GLfloat*){}
+static void null_glDrawMeshArraysSUN(GLenum,GLint,GLsizei,GLsizei){}
+static void null_glVertexAttrib4dNV(GLuint,GLdouble,GLdouble,GLdouble,GLdouble){}
+static void null_glGetMultisamplefvNV(GLenum,GLuint,GLfloat*){}
+static void* null_glMapObjectBufferATI(GLuint){return (void*)0;}
+static void null_glGetPathCommandsNV(GLuint,GLubyte*){}
+static void null_glVertexArrayTexCoordOffsetEXT(GLuint,GLuint,GLint,GLenum,GLsizei,GLintptr){}
+static void null_glGetHistogram(GLenum,GLboolean,GLenum,GLenum,GLvoid*){}
+static void null_glMatrixMode(GLenum){}
+static void null_glColorFormatNV(GLint,GLenum,GLsizei){}
+static void null_glProgramUniformui64NV(GLuint,GLint,GLuint64EXT){}
+static void null_glProgramUniformMatrix4x2fvEXT(GLuint,GLint,GLsizei,GLboolean,const GLfloat*){}
+static void null_glLoadMatrixxOES(const GLfixed*){}
+static void null_glGetColorTableParameterfvEXT(GLenum,GLenum,GLfloat*){}
+static void null_glRasterPos4i(GLint,GLint,GLint,GLint){}
+static void null_glVertexAttribL2i64NV(GLuint,GLint64EXT,GLint64EXT){}
+static void null_glBindTextures(GLuint,GLsizei,const GLuint*){}
+static void null_glMatrixRotatefEXT(GLenum,GLfloat,GLfloat,GLfloat,GLfloat){}
+static void null_glGetClipPlanexOES(GLenum,GLfixed*){}
+static void null_glSecondaryColor3uivEXT(const GLuint*){}
+static void null_glGetPerfQueryInfoINTEL(GLuint,GLuint,GLchar*,GLuint*,GLuint*,GLuint*,GLuint*){}
+static void null_glGetDoublev(GLenum,GLdouble*){}
+static void null_glBindBufferRangeEXT(GLenum,GLuint,GLuint,GLintptr,GLsizeiptr){}
+static void null_glCompressedTexImage2D(GLenum,GLint,GLenum,GLsizei,GLsizei,GLint,GLsizei,const GLvoid*){}
+static void* null_glMapBufferARB(GLenum,GLenum){return (void*)0;}
+static void null_glGetPathSpacingNV(GLenum,GLsizei,GLenum,const void*,GLuint,GLfloat,GLfloat,GLenum,GLfloat*){}
+static void null_glUniform4dv(GLint,GLsizei,const GLdouble*){}
+static void null_glGlobalAlphaFactordSUN(GLdouble){}
+static void null_glProgramUniform3dv(GLuint,GLint,GLsizei,const GLdouble*){}
+static void null_glGetShaderSourceARB(GLhandleARB,GLsizei,GLsizei*,GLcharARB*){}
+static void null_glVertexAttrib3dvARB(GLuint,const GLdouble*){}
+static void null_glInvalidateBufferData(GLuint){}
+static void null_glMatrixLoad3x2fNV(GLenum,const GLfloat*){}
+static void null_glCompressedTextureSubImage1D(GLuint,GLint,GLint,GLsizei,GLenum,GLsizei,const void*){}
+static void null_glTexCoord3xvOES(const GLfixed*){}
+static void null_glGenTexturesEXT(GLsizei,GLuint*){}
+static void null_glTangent3iEXT(GLint,GLint,GLint){}
+static void null_glClearTexImage(GLuint,GLint,GLenum,GLenum,const void*){}
+static void null_glBinormal3bvEXT(const GLbyte*){}
+static void null_glUniform3fv(GLint,GLsizei,const GLfloat*){}
+static void null_glGetnPixelMapusvARB(GLenum,GLsizei,GLushort*){}
+static void null_glMultiTexCoordP1ui(GLenum,GLenum,GLuint){}
+static void null_glClearNamedBufferDataEXT(GLuint,GLenum,GLenum,GLenum,const void*){}
+static void null_glUniformMatrix4dv(GLint,GLsizei,GLboolean,const GLdouble*){}
+static void null_glWindowPos3fMESA(GLfloat,GLfloat,GLfloat){}
+static void null_glDeleteRenderbuffers(GLsizei,const GLuint*){}
+static void null_glGetTextureLevelParameterfvEXT(GLuint,GLenum,GLint,GLenum,GLfloat*){}
+static void null_glGetHistogramParameterxvOES(GLenum,GLenum,GLfixed*){}
+static void null_glMultiDrawElements(GLenum,const GLsizei*,GLenum,const void*const*,GLsizei){}
+static void null_glMakeImageHandleNonResidentNV(GLuint64){}
+static void null_glTexSubImage1DEXT(GLenum,GLint,GLint,GLsizei,GLenum,GLenum,const void*){}
+static void null_glNormalStream3dATI(GLenum,GLdouble,GLdouble,GLdouble){}
+static void null_glVertexAttribL4i64vNV(GLuint,const GLint64EXT*){}
+static void null_glDrawBuffers(GLsizei,const GLenum*){}
+static void null_glCopyTextureSubImage1DEXT(GLuint,GLenum,GLint,GLint,GLint,GLint,GLsizei){}
+static void null_glWindowRectanglesEXT(GLenum,GLsizei,const GLint*){}
+static void null_glNamedFramebufferReadBuffer(GLuint,GLenum){}
+static void null_glUniform2i64vARB(GLint,GLsizei,const GLint64*){}
+static void null_glVertexAttribI1uivEXT(GLuint,const GLuint*){}
+static void null_glGetTexGenfv(GLenum,GLenum,GLfloat*){}
+static void null_glBeginQueryARB(GLenum,GLuint){}
+static void null_glUniform1iARB(GLint,GLint){}
+static void null_glVertex4bvOES(const GLbyte*){}
+static void null_glInvalidateSubFramebuffer(GLenum,GLsizei,const GLenum*,GLint,GLint,GLsizei,GLsizei){}
+static void null_glUniform1fvARB(GLint,GLsizei,const GLfloat*){}
+static GLboolean null_glTestFenceNV(GLuint){return (GLboolean)0;}
+static void null_glBindTransformFeedback(GLenum,GLuint){}
+static void null_glMultiTexCoord2iv(GLenum,const GLint*){}
+static void null_glCopyMultiTexSubImage1DEXT(GLenum,GLenum,GLint,GLint,GLint,GLint,GLsizei){}
+static void null_glVariantbvEXT(GLuint,const GLbyte*){}
+static void null_glTexCoord1hNV(GLhalfNV){}
+static void null_glGenFencesNV(GLsizei,GLuint*){}
+static void null_glRasterPos3iv(const GLint*){}
+static void null_glVertexAttribL2ui64NV(GLuint,GLuint64EXT,GLuint64EXT){}
+static void null_glMultiTexCoord1hvNV(GLenum,const GLhalfNV*){}
+static void null_glGetnConvolutionFilter(GLenum,GLenum,GLenum,GLsizei,void*){}
+static void null_glNormal3bv(const GLbyte*){}
+static void null_glWeightbvARB(GLint,const GLbyte*){}
+static void null_glTexCoord4sv(const GLshort*){}
+static void null_glUniform2uiv(GLint,GLsizei,const GLuint*){}
+static void null_glBeginConditionalRenderNVX(GLuint){}
+static void null_glFinish(){}
+static void null_glColorTableParameterfv(GLenum,GLenum,const GLfloat*){}
+static void null_glFragmentCoverageColorNV(GLuint){}
+static void null_glProgramUniform3ivEXT(GLuint,GLint,GLsizei,const GLint*){}
+static void null_glVertexArrayVertexOffsetEXT(GLuint,GLuint,GLint,GLenum,GLsizei,GLintptr){}
+static void null_glViewportPositionWScaleNV(GLuint,GLfloat,GLfloat){}
+static void null_glGetProgramLocalParameterIuivNV(GLenum,GLuint,GLuint*){}
+static void null_glReplacementCodeuiTexCoord2fVertex3fvSUN(const GLuint*,const GLfloat*,const GLfloat*){}
+static void null_glUniform1uiv(GLint,GLsizei,const GLuint*){}
+static void null_glUniformMatrix2dv(GLint,GLsizei,GLboolean,const GLdouble*){}
+static void null_glIndexdv(const GLdouble*){}
+static void null_glSecondaryColor3ivEXT(const GLint*){}
+static void null_glTexCoord3iv(const GLint*){}
+static void null_glVertexStream4fvATI(GLenum,const GLfloat*){}
+static void null_glDeformationMap3fSGIX(GLenum,GLfloat,GLfloat,GLint,GLint,GLfloat,GLfloat,GLint,GLint,GLfloat,GLfloat,GLint,GLint,const GLfloat*){}
+static void null_glClearDepth(GLclampd){}
+static GLuint null_glGenAsyncMarkersSGIX(GLsizei){return (GLuint)0;}
+static void null_glDisableIndexedEXT(GLenum,GLuint){}
+static void null_glVertexWeightfvEXT(const GLfloat*){}
+static void null_glGetProgramLocalParameterIivNV(GLenum,GLuint,GLint*){}
+static void null_glCompressedTexImage3DARB(GLenum,GLint,GLenum,GLsizei,GLsizei,GLsizei,GLint,GLsizei,const void*){}
+static void null_glProgramParameter4fNV(GLenum,GLuint,GLfloat,GLfloat,GLfloat,GLfloat){}
+static void null_glConvolutionParameterxOES(GLenum,GLenum,GLfixed){}
+static void null_glInsertComponentEXT(GLuint,GLuint,GLuint){}
+static void null_glCreateTextures(GLenum,GLsizei,GLuint*){}
+static void null_glSecondaryColor3iv(const GLint*){}
+static void null_glCreateBuffers(GLsizei,GLuint*){}
+static void null_glMultiTexCoord2xvOES(GLenum,const GLfixed*){}
+static void null_glTexGenxvOES(GLenum,GLenum,const GLfixed*){}
+static void null_glMultTransposeMatrixf(const GLfloat*){}
+static void null_glBeginTransformFeedbackEXT(GLenum){}
+static void null_glTexCoord2fColor3fVertex3fSUN(GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat){}
+static void null_glNormal3sv(const GLshort*){}
+static void null_glFreeObjectBufferATI(GLuint){}
+static void null_glBlendBarrierNV(){}
+static void null_glUniform4i64vNV(GLint,GLsizei,const GLint64EXT*){}
+static void null_glGetnUniformuivARB(GLuint,GLint,GLsizei,GLuint*){}
+static void null_glAlphaFragmentOp3ATI(GLenum,GLuint,GLuint,GLuint,GLuint,GLuint,GLuint,GLuint,GLuint,GLuint,GLuint,GLuint){}
+static void null_glProgramEnvParameters4fvEXT(GLenum,GLuint,GLsizei,const GLfloat*){}
+static void null_glBlendFuncSeparateEXT(GLenum,GLenum,GLenum,GLenum){}
+static void null_glConvolutionParameterivEXT(GLenum,GLenum,const GLint*){}
+static void null_glPixelTexGenSGIX(GLenum){}
+static void null_glDeleteProgram(GLuint){}
+static void null_glUniformMatrix4x3dv(GLint,GLsizei,GLboolean,const GLdouble*){}
+static void null_glGetVideoCaptureStreamivNV(GLuint,GLuint,GLenum,GLint*){}
+static void null_glProgramUniform4uiEXT(GLuint,GLint,GLuint,GLuint,GLuint,GLuint){}
+static void null_glMakeImageHandleNonResidentARB(GLuint64){}
+static void null_glSecondaryColor3dEXT(GLdouble,GLdouble,GLdouble){}
+static void null_glDeleteQueries(GLsizei,const GLuint*){}
+static void null_glNormalP3uiv(GLenum,const GLuint*){}
+static void null_glRasterPos2d(GLdouble,GLdouble){}
+static void null_glInitNames(){}
+static void null_glBinormal3fvEXT(const GLfloat*){}
+static void null_glColor3dv(const GLdouble*){}
+static void null_glVertexArrayVertexAttribDivisorEXT(GLuint,GLuint,GLuint){}
+static void null_glArrayElementEXT(GLint){}
+static void null_glProgramParameter4dNV(GLenum,GLuint,GLdouble,GLdouble,GLdouble,GLdouble){}
+static void null_glIndexxOES(GLfixed){}
+static void null_glUniform3uivEXT(GLint,GLsizei,const GLuint*){}
+static void null_glPopGroupMarkerEXT(){}
+static void null_glClearNamedFramebufferuiv(GLuint,GLenum,GLint,const GLuint*){}
+static void null_glSetLocalConstantEXT(GLuint,GLenum,const void*){}
+static void null_glProgramUniform1ui64NV(GLuint,GLint,GLuint64EXT){}
+static void null_glColor4hvNV(const GLhalfNV*){}
+static void null_glGetVertexAttribfv(GLuint,GLenum,GLfloat*){}
+static void null_glDispatchCompute(GLuint,GLuint,GLuint){}
+static void null_glGetActiveAttrib(GLuint,GLuint,GLsizei,GLsizei*,GLint*,GLenum*,GLchar*){}
+static void null_glFragmentColorMaterialSGIX(GLenum,GLenum){}
+static void null_glTexSubImage2D(GLenum,GLint,GLint,GLint,GLsizei,GLsizei,GLenum,GLenum,const GLvoid*){}
+static void null_glGetnMinmaxARB(GLenum,GLboolean,GLenum,GLenum,GLsizei,void*){}
+static void null_glLogicOp(GLenum){}
+static void null_glProgramUniformMatrix3x4fv(GLuint,GLint,GLsizei,GLboolean,const GLfloat*){}
+static void null_glWindowPos4iMESA(GLint,GLint,GLint,GLint){}
+static void null_glPixelTransferf(GLenum,GLfloat){}
+static void null_glGetTextureParameterIuiv(GLuint,GLenum,GLuint*){}
+static void null_glMultiTexCoord1xOES(GLenum,GLfixed){}
+static void null_glProgramUniformMatrix4dv(GLuint,GLint,GLsizei,GLboolean,const GLdouble*){}
+static void null_glGetnUniformiv(GLuint,GLint,GLsizei,GLint*){}
+static void null_glFramebufferTexture1DEXT(GLenum,GLenum,GLenum,GLuint,GLint){}
+static void null_glVertexPointervINTEL(GLint,GLenum,const void**){}
+static void null_glTextureParameterIiv(GLuint,GLenum,const GLint*){}
+static void null_glGetSeparableFilterEXT(GLenum,GLenum,GLenum,void*,void*,void*){}
+static void null_glMultiTexCoord3iARB(GLenum,GLint,GLint,GLint){}
+static void null_glRasterPos4xvOES(const GLfixed*){}
+static void null_glDrawTransformFeedbackStream(GLenum,GLuint,GLuint){}
+static void null_glVertex3hvNV(const GLhalfNV*){}
+static void null_glVertexArrayMultiTexCoordOffsetEXT(GLuint,GLuint,GLenum,GLint,GLenum,GLsizei,GLintptr){}
+static void null_glProvokingVertex(GLenum){}
+static void null_glAccumxOES(GLenum,GLfixed){}
+static void null_glShaderBinary(GLsizei,const GLuint*,GLenum,const void*,GLsizei){}
+static void null_glGetMultiTexGenivEXT(GLenum,GLenum,GLenum,GLint*){}
+static void null_glPointParameterxvOES(GLenum,const GLfixed*){}
+static void null_glCreateStatesNV(GLsizei,GLuint*){}
+static void null_glClearDepthdNV(GLdouble){}
+static void null_glClearColorIuiEXT(GLuint,GLuint,GLuint,GLuint){}
+static void null_glBindMultiTextureEXT(GLenum,GLenum,GLuint){}
+static void null_glTexGeniv(GLenum,GLenum,const GLint*){}
+static void null_glDrawElements(GLenum,GLsizei,GLenum,const GLvoid*){}
+static void null_glProgramUniform4iv(GLuint,GLint,GLsizei,const GLint*){}
+static void null_glDisableVertexArrayEXT(GLuint,GLenum){}
+static void null_glProgramUniform3ui64NV(GLuint,GLint,GLuint64EXT,GLuint64EXT,GLuint64EXT){}
+static void null_glClientActiveTexture(GLenum){}
+static void null_glMultiTexParameterIivEXT(GLenum,GLenum,GLenum,const GLint*){}
+static void null_glUniform1i64ARB(GLint,GLint64){}
+static void null_glUniform1iv(GLint,GLsizei,const GLint*){}
+static void null_glVertexAttribArrayObjectATI(GLuint,GLint,GLenum,GLboolean,GLsizei,GLuint,GLuint){}
+static void null_glUniform2iARB(GLint,GLint,GLint){}
+static void null_glDrawArraysInstanced(GLenum,GLint,GLsizei,GLsizei){}
+static void null_glVertexAttrib2sNV(GLuint,GLshort,GLshort){}
+static void null_glTexBufferEXT(GLenum,GLenum,GLuint){}
+static void null_glVertexStream2fATI(GLenum,GLfloat,GLfloat){}
+static void null_glDebugMessageCallbackAMD(GLDEBUGPROCAMD,void*){}
+static void null_glSamplerParameteriv(GLuint,GLenum,const GLint*){}
+static void null_glVertexAttrib4uiv(GLuint,const GLuint*){}
+static void null_glEndQueryIndexed(GLenum,GLuint){}
+static void null_glNormalStream3sATI(GLenum,GLshort,GLshort,GLshort){}
+static void null_glProgramParameteriARB(GLuint,GLenum,GLint){}
+static void null_glTexEnvxOES(GLenum,GLenum,GLfixed){}
+static void null_glProgramUniform1iv(GLuint,GLint,GLsizei,const GLint*){}
+static void null_glDisableVertexAttribAPPLE(GLuint,GLenum){}
+static void null_glBindRenderbuffer(GLenum,GLuint){}
+static void null_glMultiTexSubImage3DEXT(GLenum,GLenum,GLint,GLint,GLint,GLint,GLsizei,GLsizei,GLsizei,GLenum,GLenum,const void*){}
+static GLboolean null_glIsProgram(GLuint){return (GLboolean)0;}
+static void null_glMultiDrawElementsIndirectAMD(GLenum,GLenum,const void*,GLsizei,GLsizei){}
+static void null_glGetProgramInfoLog(GLuint,GLsizei,GLsizei*,GLchar*){}
+static void null_glGetLocalConstantBooleanvEXT(GLuint,GLenum,GLboolean*){}
+static void null_glPixelTransformParameteriEXT(GLenum,GLenum,GLint){}
+static void null_glTexCoord4bOES(GLbyte,GLbyte,GLbyte,GLbyte){}
+static void null_glVertexAttrib4fv(GLuint,const GLfloat*){}
+static void null_glProgramUniformMatrix2x3dv(GLuint,GLint,GLsizei,GLboolean,const GLdouble*){}
+static void null_glProgramEnvParametersI4uivNV(GLenum,GLuint,GLsizei,const GLuint*){}
+static void null_glTexCoord3xOES(GLfixed,GLfixed,GLfixed){}
+static void null_glLoadTransposeMatrixfARB(const GLfloat*){}
+static void null_glImageTransformParameteriHP(GLenum,GLenum,GLint){}
+static void null_glMultiTexCoord4xOES(GLenum,GLfixed,GLfixed,GLfixed,GLfixed){}
+static void null_glVertexAttribs3fvNV(GLuint,GLsizei,const GLfloat*){}
+static void null_glVertexAttrib2fv(GLuint,const GLfloat*){}
+static void null_glUniform3ui64NV(GLint,GLuint64EXT,GLuint64EXT,GLuint64EXT){}
+static void null_glCombinerParameterfvNV(GLenum,const GLfloat*){}
+static void null_glFragmentMaterialiSGIX(GLenum,GLenum,GLint){}
+static void null_glGetBooleani_v(GLenum,GLuint,GLboolean*){}
+static GLuint null_glGetProgramResourceIndex(GLuint,GLenum,const GLchar*){return (GLuint)0;}
+static void null_glBeginConditionalRenderNV(GLuint,GLenum){}
+static void null_glDisableClientState(GLenum){}
+static void null_glPathFogGenNV(GLenum){}
+static void null_glStencilThenCoverFillPathNV(GLuint,GLenum,GLuint,GLenum){}
+static void null_glVertexArrayIndexOffsetEXT(GLuint,GLuint,GLenum,GLsizei,GLintptr){}
+static void null_glProgramBufferParametersIuivNV(GLenum,GLuint,GLuint,GLsizei,const GLuint*){}
+static void null_glPixelTransformParameterivEXT(GLenum,GLenum,const GLint*){}
+static void null_glDisableClientStateiEXT(GLenum,GLuint){}
+static void null_glTexBufferARB(GLenum,GLenum,GLuint){}
+static void null_glGetLocalConstantIntegervEXT(GLuint,GLenum,GLint*){}
+static void null_glColor4uiv(const GLuint*){}
+static void null_glProgramUniform3i(GLuint,GLint,GLint,GLint,GLint){}
+static void null_glMultiDrawElementsIndirectBindlessCountNV(GLenum,GLenum,const void*,GLsizei,GLsizei,GLsizei,GLint){}
+static void null_glGetBufferPointervARB(GLenum,GLenum,void**){}
+static void null_glMultiTexParameterIuivEXT(GLenum,GLenum,GLenum,const GLuint*){}
+static void null_glEvalMesh2(GLenum,GLint,GLint,GLint,GLint){}
+static void null_glEvalMesh1(GLenum,GLint,GLint){}
+static void null_glProgramUniform3f(GLuint,GLint,GLfloat,GLfloat,GLfloat){}
+static void null_glStencilThenCoverFillPathInstancedNV(GLsizei,GLenum,const void*,GLuint,GLenum,GLuint,GLenum,GLenum,const GLfloat*){}
+static void null_glProgramUniform3d(GLuint,GLint,GLdouble,GLdouble,GLdouble){}
+static void null_glMapVertexAttrib1dAPPLE(GLuint,GLuint,GLdouble,GLdouble,GLint,GLint,const GLdouble*){}
+static void null_glEvalCoord2fv(const GLfloat*){}
+static void null_glGetUniformivARB(GLhandleARB,GLint,GLint*){}
+static void null_glLoadTransposeMatrixd(const GLdouble*){}
+static void null_glLoadTransposeMatrixf(const GLfloat*){}
+static void null_glGetPointervEXT(GLenum,void**){}
+static void null_glEndConditionalRenderNV(){}
+static void null_glTexCoord2fNormal3fVertex3fSUN(GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat){}
+static void null_glUniform3i64vARB(GLint,GLsizei,const GLint64*){}
+static void null_glProgramUniform2uiEXT(GLuint,GLint,GLuint,GLuint){}
+static void null_glVertexAttribI1ui(GLuint,GLuint){}
+static void null_glProgramNamedParameter4dvNV(GLuint,GLsizei,const GLubyte*,const GLdouble*){}
+static void null_glCompileCommandListNV(GLuint){}
+static void null_glGetRenderbufferParameterivEXT(GLenum,GLenum,GLint*){}
+static void null_glGetnPolygonStipple(GLsizei,GLubyte*){}
+static GLboolean null_glIsBufferResidentNV(GLenum){return (GLboolean)0;}
+static void null_glSecondaryColor3ubvEXT(const GLubyte*){}
+static void null_glGetNamedRenderbufferParameterivEXT(GLuint,GLenum,GLint*){}
+static void null_glNamedFramebufferSampleLocationsfvARB(GLuint,GLuint,GLsizei,const GLfloat*){}
+static void null_glMultiTexGendvEXT(GLenum,GLenum,GLenum,const GLdouble*){}
+static void null_glVertexArrayRangeNV(GLsizei,const void*){}
+static GLboolean null_glIsTextureHandleResidentNV(GLuint64){return (GLboolean)0;}
+static void null_glGetProgramEnvParameterdvARB(GLenum,GLuint,GLdouble*){}
+static GLboolean null_glIsNamedStringARB(GLint,const GLchar*){return (GLboolean)0;}
+static void null_glSecondaryColorFormatNV(GLint,GLenum,GLsizei){}
+static void null_glVertexAttrib4ubvNV(GLuint,const GLubyte*){}
+static void null_glTagSampleBufferSGIX(){}
+static void null_glVDPAUUnregisterSurfaceNV(GLvdpauSurfaceNV){}
+static void null_glGetPerfQueryIdByNameINTEL(GLchar*,GLuint*){}
+static void null_glGetInteger64v(GLenum,GLint64*){}
+static void null_glClipPlane(GLenum,const GLdouble*){}
+static void null_glColor4ubVertex3fSUN(GLubyte,GLubyte,GLubyte,GLubyte,GLfloat,GLfloat,GLfloat){}
+static void null_glIndexub(GLubyte){}
+static void null_glGetProgramEnvParameterfvARB(GLenum,GLuint,GLfloat*){}
+static void null_glVertexAttrib4usvARB(GLuint,const GLushort*){}
+static void null_glNamedFramebufferRenderbuffer(GLuint,GLenum,GLenum,GLuint){}
+static void null_glProgramUniformMatrix3x4dv(GLuint,GLint,GLsizei,GLboolean,const GLdouble*){}
+static GLboolean null_glTestFenceAPPLE(GLuint){return (GLboolean)0;}
+static void null_glVertexAttrib4Niv(GLuint,const GLint*){}
+static void null_glVertexAttribL2i64vNV(GLuint,const GLint64EXT*){}
+static void null_glColorP4uiv(GLenum,const GLuint*){}
+static void null_glUniformMatrix2x3fv(GLint,GLsizei,GLboolean,const GLfloat*){}
+static void null_glCallCommandListNV(GLuint){}
+static void null_glClearBufferiv(GLenum,GLint,const GLint*){}
+static void null_glNamedStringARB(GLenum,GLint,const GLchar*,GLint,const GLchar*){}
+static void null_glMatrixMult3x2fNV(GLenum,const GLfloat*){}
+static void null_glGetNamedProgramStringEXT(GLuint,GLenum,GLenum,void*){}
+static void null_glGetnHistogramARB(GLenum,GLboolean,GLenum,GLenum,GLsizei,void*){}
+static void null_glGetTextureLevelParameterfv(GLuint,GLint,GLenum,GLfloat*){}
+static void null_glMultiTexCoord1fv(GLenum,const GLfloat*){}
+static void null_glBitmapxOES(GLsizei,GLsizei,GLfixed,GLfixed,GLfixed,GLfixed,const GLubyte*){}
+static void null_glGetSamplerParameterIuiv(GLuint,GLenum,GLuint*){}
+static void null_glTexCoordP3ui(GLenum,GLuint){}
+static void null_glTextureSubImage1D(GLuint,GLint,GLint,GLsizei,GLenum,GLenum,const void*){}
+static void null_glVertexAttribLPointerEXT(GLuint,GLint,GLenum,GLsizei,const void*){}
+static void null_glFogCoordPointerEXT(GLenum,GLsizei,const void*){}
+static void null_glWindowPos3s(GLshort,GLshort,GLshort){}
+static void null_glVertexAttribs2svNV(GLuint,GLsizei,const GLshort*){}
+static void null_glTextureImage3DEXT(GLuint,GLenum,GLint,GLint,GLsizei,GLsizei,GLsizei,GLint,GLenum,GLenum,const void*){}
+static void null_glWindowPos3i(GLint,GLint,GLint){}
+static void null_glWindowPos3d(GLdouble,GLdouble,GLdouble){}
+static void null_glWindowPos3f(GLfloat,GLfloat,GLfloat){}
+static GLboolean null_glIsEnabledIndexedEXT(GLenum,GLuint){return (GLboolean)0;}
+static void null_glGetNamedProgramivEXT(GLuint,GLenum,GLenum,GLint*){}
+static void null_glVertex3xvOES(const GLfixed*){}
+static void null_glColor3us(GLushort,GLushort,GLushort){}
+static void null_glBeginPerfMonitorAMD(GLuint){}
+static void null_glProgramUniformMatrix4x3dv(GLuint,GLint,GLsizei,GLboolean,const GLdouble*){}
+static void null_glGetNamedProgramLocalParameterIuivEXT(GLuint,GLenum,GLuint,GLuint*){}
+static void null_glReadnPixels(GLint,GLint,GLsizei,GLsizei,GLenum,GLenum,GLsizei,void*){}
+static void null_glMultiTexCoord4f(GLenum,GLfloat,GLfloat,GLfloat,GLfloat){}
+static void null_glColor3ub(GLubyte,GLubyte,GLubyte){}
+static void null_glMultiTexCoord4d(GLenum,GLdouble,GLdouble,GLdouble,GLdouble){}
+static void null_glVertexAttribL3ui64NV(GLuint,GLuint64EXT,GLuint64EXT,GLuint64EXT){}
+static void null_glColor3ui(GLuint,GLuint,GLuint){}
+static void null_glProgramUniform4fvEXT(GLuint,GLint,GLsizei,const GLfloat*){}
+static void null_glVertexAttrib2sARB(GLuint,GLshort,GLshort){}
+static void null_glMultiTexCoord4i(GLenum,GLint,GLint,GLint,GLint){}
+static GLenum null_glCheckFramebufferStatusEXT(GLenum){return (GLenum)0;}
+static void null_glGetnMapivARB(GLenum,GLenum,GLsizei,GLint*){}
+static void null_glMultiTexCoord1ivARB(GLenum,const GLint*){}
+static void null_glDisableVertexAttribArrayARB(GLuint){}
+static void null_glGetPolygonStipple(GLubyte*){}
+static void null_glVertexAttribI4ui(GLuint,GLuint,GLuint,GLuint,GLuint){}
+static void null_glGetPathDashArrayNV(GLuint,GLfloat*){}
+static void null_glMultiTexRenderbufferEXT(GLenum,GLenum,GLuint){}
+static void null_glCopyTextureSubImage1D(GLuint,GLint,GLint,GLint,GLint,GLsizei){}
+static void null_glDeleteOcclusionQueriesNV(GLsizei,const GLuint*){}
+static void null_glVertex4hvNV(const GLhalfNV*){}
+static void null_glGetnTexImage(GLenum,GLint,GLenum,GLenum,GLsizei,void*){}
+static void null_glProgramLocalParameter4dARB(GLenum,GLuint,GLdouble,GLdouble,GLdouble,GLdouble){}
+static void null_glBlendEquation(GLenum){}
+static void null_glUnlockArraysEXT(){}
+static void null_glGetQueryObjectui64vEXT(GLuint,GLenum,GLuint64*){}
+static void null_glVertexAttribI4uivEXT(GLuint,const GLuint*){}
+static void null_glUniform1i64vNV(GLint,GLsizei,const GLint64EXT*){}
+static void null_glMultiTexCoord3dv(GLenum,const GLdouble*){}
+static void null_glColor4sv(const GLshort*){}
+static void null_glVertexStream4ivATI(GLenum,const GLint*){}
+static void null_glPopClientAttrib(){}
+static void null_glClearBufferData(GLenum,GLenum,GLenum,GLenum,const void*){}
+static void null_glGetProgramivNV(GLuint,GLenum,GLint*){}
+static void null_glBeginTransformFeedback(GLenum){}
+static void null_glFinishObjectAPPLE(GLenum,GLint){}
+static void null_glGetMinmaxParameterivEXT(GLenum,GLenum,GLint*){}
+static void null_glColor3iv(const GLint*){}
+static void null_glVertexAttrib3sv(GLuint,const GLshort*){}
+static void null_glCompressedTexImage1D(GLenum,GLint,GLenum,GLsizei,GLint,GLsizei,const GLvoid*){}
+static void null_glDeleteTransformFeedbacks(GLsizei,const GLuint*){}
+static void null_glGetVideoi64vNV(GLuint,GLenum,GLint64EXT*){}
+static void null_glDrawRangeElementsBaseVertex(GLenum,GLuint,GLuint,GLsizei,GLenum,const void*,GLint){}
+static void null_glUniform4i64vARB(GLint,GLsizei,const GLint64*){}
+static void null_glTextureStorage3DMultisampleEXT(GLuint,GLenum,GLsizei,GLenum,GLsizei,GLsizei,GLsizei,GLboolean){}
+static void null_glGetTexParameterfv(GLenum,GLenum,GLfloat*){}
+static void null_glProgramUniformui64vNV(GLuint,GLint,GLsizei,const GLuint64EXT*){}
+static void null_glCompressedMultiTexImage1DEXT(GLenum,GLenum,GLint,GLenum,GLsizei,GLint,GLsizei,const void*){}
+static void null_glProgramUniform2ivEXT(GLuint,GLint,GLsizei,const GLint*){}
+static void null_glPushGroupMarkerEXT(GLsizei,const GLchar*){}
+static void null_glVertexAttrib1dv(GLuint,const GLdouble*){}
+static void null_glMatrixLoadIdentityEXT(GLenum){}
+static void null_glMultTransposeMatrixxOES(const GLfixed*){}
+static void null_glGetPixelMapxv(GLenum,GLint,GLfixed*){}
+static void null_glFramebufferSampleLocationsfvARB(GLenum,GLuint,GLsizei,const GLfloat*){}
+static void null_glGetLightiv(GLenum,GLenum,GLint*){}
+static void null_glBlendFuncSeparatei(GLuint,GLenum,GLenum,GLenum,GLenum){}
+static void null_glGetBooleanIndexedvEXT(GLenum,GLuint,GLboolean*){}
+static void null_glGetProgramSubroutineParameteruivNV(GLenum,GLuint,GLuint*){}
+static void null_glUniform2ui(GLint,GLuint,GLuint){}
+static void null_glApplyFramebufferAttachmentCMAAINTEL(){}
+static void null_glWindowPos2fv(const GLfloat*){}
+static void null_glDisablei(GLenum,GLuint){}
+static void null_glSelectPerfMonitorCountersAMD(GLuint,GLboolean,GLuint,GLint,GLuint*){}
+static void null_glGetVertexAttribLi64vNV(GLuint,GLenum,GLint64EXT*){}
+static void null_glBlendFuncSeparateiARB(GLuint,GLenum,GLenum,GLenum,GLenum){}
+static void null_glWeightuivARB(GLint,const GLuint*){}
+static void null_glWindowPos2iARB(GLint,GLint){}
+static void null_glGetProgramLocalParameterdvARB(GLenum,GLuint,GLdouble*){}
+static void null_glGetUniformui64vARB(GLuint,GLint,GLuint64*){}
+static void null_glGetSynciv(GLsync,GLenum,GLsizei,GLsizei*,GLint*){}
+static void null_glMakeImageHandleResidentARB(GLuint64,GLenum){}
+static void null_glGetProgramNamedParameterfvNV(GLuint,GLsizei,const GLubyte*,GLfloat*){}
+static void null_glTextureStorage3D(GLuint,GLsizei,GLenum,GLsizei,GLsizei,GLsizei){}
+static void null_glVertexAttrib4svNV(GLuint,const GLshort*){}
+static void null_glProgramUniform2i(GLuint,GLint,GLint,GLint){}
+static void null_glListDrawCommandsStatesClientNV(GLuint,GLuint,const void**,const GLsizei*,const GLuint*,const GLuint*,GLuint){}
+static void null_glProgramLocalParametersI4uivNV(GLenum,GLuint,GLsizei,const GLuint*){}
+static void null_glBeginTransformFeedbackNV(GLenum){}
+static void null_glGetProgramBinary(GLuint,GLsizei,GLsizei*,GLenum*,void*){}
+static void null_glBinormal3iEXT(GLint,GLint,GLint){}
+static void null_glEvalPoint1(GLint){}
+static void null_glEvalPoint2(GLint,GLint){}
+static void null_glPauseTransformFeedback(){}
+static void null_glWindowPos2sMESA(GLshort,GLshort){}
+static void null_glGlobalAlphaFactorbSUN(GLbyte){}
+static void null_glCreateTransformFeedbacks(GLsizei,GLuint*){}
+static void null_glTexturePageCommitmentEXT(GLuint,GLint,GLint,GLint,GLint,GLsizei,GLsizei,GLsizei,GLboolean){}
+static void null_glTransformFeedbackVaryingsNV(GLuint,GLsizei,const GLint*,GLenum){}
+static void null_glTexSubImage1D(GLenum,GLint,GLint,GLsizei,GLenum,GLenum,const GLvoid*){}
+static void null_glConvolutionParameterfvEXT(GLenum,GLenum,const GLfloat*){}
+static void null_glBlitFramebufferEXT(GLint,GLint,GLint,GLint,GLint,GLint,GLint,GLint,GLbitfield,GLenum){}
+static void null_glUniformMatrix4fvARB(GLint,GLsizei,GLboolean,const GLfloat*){}
+static void null_glProgramEnvParameter4dvARB(GLenum,GLuint,const GLdouble*){}
+static void null_glSecondaryColor3hNV(GLhalfNV,GLhalfNV,GLhalfNV){}
+static void null_glVertexAttribP3uiv(GLuint,GLenum,GLboolean,const GLuint*){}
+static void null_glFogCoordFormatNV(GLenum,GLsizei){}
+static void null_glGetMultiTexLevelParameterivEXT(GLenum,GLenum,GLint,GLenum,GLint*){}
+static GLboolean null_glIsOcclusionQueryNV(GLuint){return (GLboolean)0;}
+static void null_glCompressedTexImage2DARB(GLenum,GLint,GLenum,GLsizei,GLsizei,GLint,GLsizei,const void*){}
+static void null_glGetProgramEnvParameterIuivNV(GLenum,GLuint,GLuint*){}
+static void null_glVertexAttrib4sv(GLuint,const GLshort*){}
+static void null_glVertexAttrib4fvARB(GLuint,const GLfloat*){}
+static void null_glLoadName(GLuint){}
+static void null_glBindVertexShaderEXT(GLuint){}
+static void null_glGetNamedProgramLocalParameterIivEXT(GLuint,GLenum,GLuint,GLint*){}
+static void null_glProgramUniform3uiEXT(GLuint,GLint,GLuint,GLuint,GLuint){}
+static void null_glProgramUniformMatrix4x2dvEXT(GLuint,GLint,GLsizei,GLboolean,const GLdouble*){}
+static void null_glTexCoord1hvNV(const GLhalfNV*){}
+static void null_glLoadMatrixd(const GLdouble*){}
+static void null_glTexParameterfv(GLenum,GLenum,const GLfloat*){}
+static void null_glVariantdvEXT(GLuint,const GLdouble*){}
+static void null_glCullParameterfvEXT(GLenum,GLfloat*){}
+static void null_glUniform3dv(GLint,GLsizei,const GLdouble*){}
+static void null_glProgramUniform3fv(GLuint,GLint,GLsizei,const GLfloat*){}
+static GLboolean null_glIsBufferARB(GLuint){return (GLboolean)0;}
+static void null_glMultiTexCoord1bOES(GLenum,GLbyte){}
+static void null_glFogCoordhNV(GLhalfNV){}
+static void null_glFramebufferSampleLocationsfvNV(GLenum,GLuint,GLsizei,const GLfloat*){}
+static GLuint null_glGenSymbolsEXT(GLenum,GLenum,GLenum,GLuint){return (GLuint)0;}
+static void null_glGetConvolutionFilter(GLenum,GLenum,GLenum,GLvoid*){}
+static void null_glProgramUniform1fvEXT(GLuint,GLint,GLsizei,const GLfloat*){}
+static void null_glGetNextPerfQueryIdINTEL(GLuint,GLuint*){}
+static void null_glCompressedTexImage1DARB(GLenum,GLint,GLenum,GLsizei,GLint,GLsizei,const void*){}
+static void null_glBindSamplers(GLuint,GLsizei,const GLuint*){}
+static void null_glGetProgramEnvParameterIivNV(GLenum,GLuint,GLint*){}
+static void null_glGetQueryObjectui64v(GLuint,GLenum,GLuint64*){}
+static void null_glVertexAttribL4ui64vNV(GLuint,const GLuint64EXT*){}
+static void null_glGetVideoivNV(GLuint,GLenum,GLint*){}
+static void null_glGetTextureImage(GLuint,GLint,GLenum,GLenum,GLsizei,void*){}
+static void null_glProgramUniform1fv(GLuint,GLint,GLsizei,const GLfloat*){}
+static void null_glUniformMatrix4fv(GLint,GLsizei,GLboolean,const GLfloat*){}
+static void null_glColorMask(GLboolean,GLboolean,GLboolean,GLboolean){}
+static void null_glBeginFragmentShaderATI(){}
+static void null_glMultiDrawArraysEXT(GLenum,const GLint*,const GLsizei*,GLsizei){}
+static void null_glGenNamesAMD(GLenum,GLuint,GLuint*){}
+static void null_glPathParameteriNV(GLuint,GLenum,GLint){}
+static void null_glCreateCommandListsNV(GLsizei,GLuint*){}
+static void null_glDeleteProgramPipelines(GLsizei,const GLuint*){}
+static void null_glCopyColorSubTableEXT(GLenum,GLsizei,GLint,GLint,GLsizei){}
+static void null_glVariantsvEXT(GLuint,const GLshort*){}
+static void null_glGenProgramPipelines(GLsizei,GLuint*){}
+static void null_glVertexArrayEdgeFlagOffsetEXT(GLuint,GLuint,GLsizei,GLintptr){}
+static void null_glWindowPos2s(GLshort,GLshort){}
+static void null_glSecondaryColor3iEXT(GLint,GLint,GLint){}
+static void null_glWindowPos2i(GLint,GLint){}
+static void null_glWindowPos2f(GLfloat,GLfloat){}
+static void null_glWindowPos2d(GLdouble,GLdouble){}
+static void null_glUniform4uivEXT(GLint,GLsizei,const GLuint*){}
+static void null_glOrthoxOES(GLfixed,GLfixed,GLfixed,GLfixed,GLfixed,GLfixed){}
+static void null_glUniformSubroutinesuiv(GLenum,GLsizei,const GLuint*){}
+static void null_glRectdv(const GLdouble*,const GLdouble*){}
+static void null_glProgramUniform1i64vNV(GLuint,GLint,GLsizei,const GLint64EXT*){}
+static void null_glVertexAttribI4uiEXT(GLuint,GLuint,GLuint,GLuint,GLuint){}
+static void null_glSecondaryColor3ubEXT(GLubyte,GLubyte,GLubyte){}
+static void null_glCompressedMultiTexSubImage1DEXT(GLenum,GLenum,GLint,GLint,GLsizei,GLenum,GLsizei,const void*){}
+static void null_glMultiTexGendEXT(GLenum,GLenum,GLenum,GLdouble){}
+static void null_glColorP3uiv(GLenum,const GLuint*){}
+static void null_glFogCoordfv(const GLfloat*){}
+static void null_glCompileShader(GLuint){}
+static void null_glTexCoord2hNV(GLhalfNV,GLhalfNV){}
+static void null_glUniform1uivEXT(GLint,GLsizei,const GLuint*){}
+static void null_glMatrixLoadTransposedEXT(GLenum,const GLdouble*){}
+static void null_glIndexfv(const GLfloat*){}
+static void null_glGetCompressedTextureImage(GLuint,GLint,GLsizei,void*){}
+static void null_glGetUniformuivEXT(GLuint,GLint,GLuint*){}
+static void null_glGetnPixelMapfvARB(GLenum,GLsizei,GLfloat*){}
+static void null_glFramebufferTextureEXT(GLenum,GLenum,GLuint,GLint){}
+static void null_glVertexAttribIPointer(GLuint,GLint,GLenum,GLsizei,const void*){}
+static void null_glMultiTexCoordP3ui(GLenum,GLenum,GLuint){}
+static void null_glEvaluateDepthValuesARB(){}
+static void null_glGetNamedBufferParameteriv(GLuint,GLenum,GLint*){}
+static void null_glGetNamedProgramLocalParameterfvEXT(GLuint,GLenum,GLuint,GLfloat*){}
+static void null_glColor4fNormal3fVertex3fvSUN(const GLfloat*,const GLfloat*,const GLfloat*){}
+static void null_glSeparableFilter2DEXT(GLenum,GLenum,GLsizei,GLsizei,GLenum,GLenum,const void*,const void*){}
+static void null_glTexParameterxOES(GLenum,GLenum,GLfixed){}
+static void null_glClearAccumxOES(GLfixed,GLfixed,GLfixed,GLfixed){}
+static void null_glInvalidateFramebuffer(GLenum,GLsizei,const GLenum*){}
+static void null_glWeightubvARB(GLint,const GLubyte*){}
+static void null_glVertexAttrib1d(GLuint,GLdouble){}
+static void null_glVertexAttrib1f(GLuint,GLfloat){}
+static void null_glVertex4fv(const GLfloat*){}
+static void null_glClearNamedFramebufferfi(GLuint,GLenum,GLint,GLfloat,GLint){}
+static void null_glGetQueryBufferObjectuiv(GLuint,GLuint,GLenum,GLintptr){}
+static void null_glClearNamedFramebufferfv(GLuint,GLenum,GLint,const GLfloat*){}
+static void null_glEndVertexShaderEXT(){}
+static void null_glVertexAttrib1s(GLuint,GLshort){}
+static void null_glMultiTexCoord4dvARB(GLenum,const GLdouble*){}
+static void null_glMultiTexCoord1sv(GLenum,const GLshort*){}
+static void null_glUniform1ui64vNV(GLint,GLsizei,const GLuint64EXT*){}
+static void null_glGetClipPlanefOES(GLenum,GLfloat*){}
+static void null_glRasterPos2s(GLshort,GLshort){}
+static void null_glWeightivARB(GLint,const GLint*){}
+static void null_glMultiTexCoord4hvNV(GLenum,const GLhalfNV*){}
+static void null_glNormal3hNV(GLhalfNV,GLhalfNV,GLhalfNV){}
+static void null_glGetSeparableFilter(GLenum,GLenum,GLenum,GLvoid*,GLvoid*,GLvoid*){}
+static void null_glGetPathTexGenivNV(GLenum,GLenum,GLint*){}
+static void null_glColor4bv(const GLbyte*){}
+static void null_glRasterPos2f(GLfloat,GLfloat){}
+static void null_glNamedBufferPageCommitmentARB(GLuint,GLintptr,GLsizeiptr,GLboolean){}
+static void null_glLoadIdentity(){}
+static void null_glRasterPos2i(GLint,GLint){}
+static void null_glRasterPos4iv(const GLint*){}
+static void null_glMultiTexCoord2fvARB(GLenum,const GLfloat*){}
+static void null_glUniformMatrix4x3fv(GLint,GLsizei,GLboolean,const GLfloat*){}
+static void null_glClearBufferfv(GLenum,GLint,const GLfloat*){}
+static void null_glMultiTexCoord4hNV(GLenum,GLhalfNV,GLhalfNV,GLhalfNV,GLhalfNV){}
+static void null_glTextureBarrier(){}
+static void null_glReplacementCodeuivSUN(const GLuint*){}
+static void null_glDeleteAsyncMarkersSGIX(GLuint,GLsizei){}
+static void null_glTexCoord2bvOES(const GLbyte*){}
+static void null_glEvalCoord2xOES(GLfixed,GLfixed){}
+static void null_glGetSharpenTexFuncSGIS(GLenum,GLfloat*){}
+static void null_glProgramUniformHandleui64vNV(GLuint,GLint,GLsizei,const GLuint64*){}
+static void null_glIglooInterfaceSGIX(GLenum,const void*){}
+static void null_glWindowPos2dvARB(const GLdouble*){}
+static void null_glClearBufferfi(GLenum,GLint,GLfloat,GLint){}
+static void null_glDrawArraysIndirect(GLenum,const void*){}
+static void null_glGenVertexArrays(GLsizei,GLuint*){}
+static void null_glGetTransformFeedbacki64_v(GLuint,GLenum,GLuint,GLint64*){}
+static void null_glEnableVertexArrayAttrib(GLuint,GLuint){}
+static void null_glProgramUniformMatrix3x2dv(GLuint,GLint,GLsizei,GLboolean,const GLdouble*){}
+static void null_glVertexStream4fATI(GLenum,GLfloat,GLfloat,GLfloat,GLfloat){}
+static void null_glVertexBindingDivisor(GLuint,GLuint){}
+static void null_glGetSamplerParameterIiv(GLuint,GLenum,GLint*){}
+static void null_glGetCoverageModulationTableNV(GLsizei,GLfloat*){}
+static void null_glDepthRangedNV(GLdouble,GLdouble){}
+static void null_glVertexAttrib3f(GLuint,GLfloat,GLfloat,GLfloat){}
+static void null_glMultiDrawRangeElementArrayAPPLE(GLenum,GLuint,GLuint,const GLint*,const GLsizei*,GLsizei){}
+static void null_glVertexAttribFormatNV(GLuint,GLint,GLenum,GLboolean,GLsizei){}
+static void null_glGetQueryBufferObjecti64v(GLuint,GLuint,GLenum,GLintptr){}
+static void null_glGetVertexAttribdv(GLuint,GLenum,GLdouble*){}
+static void null_glGetUniformi64vARB(GLuint,GLint,GLint64*){}
+static GLboolean null_glAreTexturesResidentEXT(GLsizei,const GLuint*,GLboolean*){return (GLboolean)0;}
+static GLhandleARB null_glGetHandleARB(GLenum){return (GLhandleARB)0;}
+static void null_glVideoCaptureStreamParameterdvNV(GLuint,GLuint,GLenum,const GLdouble*){}
+static void null_glMapParameterivNV(GLenum,GLenum,const GLint*){}
+static GLboolean null_glIsVertexArray(GLuint){return (GLboolean)0;}
+static void null_glSecondaryColor3sEXT(GLshort,GLshort,GLshort){}
+static void null_glGetTexParameterIivEXT(GLenum,GLenum,GLint*){}
+static void null_glFrameTerminatorGREMEDY(){}
+static void null_glBlendBarrierKHR(){}
+static void null_glVertexAttrib4NubARB(GLuint,GLubyte,GLubyte,GLubyte,GLubyte){}
+static void null_glPrimitiveRestartNV(){}
+static void null_glVertexAttribL1ui64vARB(GLuint,const GLuint64EXT*){}
+static void null_glVertexAttribI4ivEXT(GLuint,const GLint*){}
+static void null_glVertexAttribs4svNV(GLuint,GLsizei,const GLshort*){}
+static void null_glUniform1ui(GLint,GLuint){}
+static void null_glVertexAttrib2fvARB(GLuint,const GLfloat*){}
+static void null_glVertexAttribI4svEXT(GLuint,const GLshort*){}
+static void null_glTextureImage3DMultisampleCoverageNV(GLuint,GLenum,GLsizei,GLsizei,GLint,GLsizei,GLsizei,GLsizei,GLboolean){}
+static void null_glMemoryBarrier(GLbitfield){}
+static void null_glGetVariantArrayObjectfvATI(GLuint,GLenum,GLfloat*){}
+static void null_glTexCoord4fColor4fNormal3fVertex4fvSUN(const GLfloat*,const GLfloat*,const GLfloat*,const GLfloat*){}
+static GLboolean null_glIsProgramARB(GLuint){return (GLboolean)0;}
+static void null_glBindImageTextureEXT(GLuint,GLuint,GLint,GLboolean,GLint,GLenum,GLint){}
+static GLint null_glGetFragDataLocation(GLuint,const GLchar*){return (GLint)0;}
+static void null_glMultiTexCoord1svARB(GLenum,const GLshort*){}
+static void null_glGetMapxvOES(GLenum,GLenum,GLfixed*){}
+static void null_glTextureStorage2DMultisampleEXT(GLuint,GLenum,GLsizei,GLenum,GLsizei,GLsizei,GLboolean){}
+static void null_glGetMaterialfv(GLenum,GLenum,GLfloat*){}
+static void null_glVertexAttrib4NbvARB(GLuint,const GLbyte*){}
+static void null_glPixelMapuiv(GLenum,GLsizei,const GLuint*){}
+static void null_glColorPointerEXT(GLint,GLenum,GLsizei,GLsizei,const void*){}
+static void null_glEnableClientStateiEXT(GLenum,GLuint){}
+static void null_glClearTexSubImage(GLuint,GLint,GLint,GLint,GLint,GLsizei,GLsizei,GLsizei,GLenum,GLenum,const void*){}
+static void null_glEvalCoord1xvOES(const GLfixed*){}
+static void null_glDetachObjectARB(GLhandleARB,GLhandleARB){}
+static void null_glGetTextureParameterIiv(GLuint,GLenum,GLint*){}
+static void null_glVariantusvEXT(GLuint,const GLushort*){}
+static void null_glCompressedTextureImage3DEXT(GLuint,GLenum,GLint,GLenum,GLsizei,GLsizei,GLsizei,GLint,GLsizei,const void*){}
+static void null_glMultiTexCoord1dARB(GLenum,GLdouble){}
+static void null_glGetVertexArrayIntegeri_vEXT(GLuint,GLuint,GLenum,GLint*){}
+static void null_glVertexAttribI4ubv(GLuint,const GLubyte*){}
+static void null_glPixelTexGenParameterfSGIS(GLenum,GLfloat){}
+static void null_glProgramUniformMatrix4x2dv(GLuint,GLint,GLsizei,GLboolean,const GLdouble*){}
+static void null_glUniform3fARB(GLint,GLfloat,GLfloat,GLfloat){}
+static GLboolean null_glIsShader(GLuint){return (GLboolean)0;}
+static void null_glConvolutionParameteriv(GLenum,GLenum,const GLint*){}
+static void null_glCopyMultiTexSubImage2DEXT(GLenum,GLenum,GLint,GLint,GLint,GLint,GLint,GLsizei,GLsizei){}
+static void null_glEnableVertexAttribArrayARB(GLuint){}
+static void null_glEnable(GLenum){}
+static void null_glGetActiveUniformsiv(GLuint,GLsizei,const GLuint*,GLenum,GLint*){}
+static void null_glGetVertexAttribivARB(GLuint,GLenum,GLint*){}
+static void null_glTexCoord4hvNV(const GLhalfNV*){}
+static void null_glUseProgramObjectARB(GLhandleARB){}
+static GLint null_glGetAttribLocation(GLuint,const GLchar*){return (GLint)0;}
+static void null_glVertexAttrib4dv(GLuint,const GLdouble*){}
+static void null_glGetTextureParameteriv(GLuint,GLenum,GLint*){}
+static void null_glPathSubCoordsNV(GLuint,GLsizei,GLsizei,GLenum,const void*){}
+static void null_glMatrixIndexusvARB(GLint,const GLushort*){}
+static void null_glGetVideouivNV(GLuint,GLenum,GLuint*){}
+static void null_glGetVideoCaptureivNV(GLuint,GLenum,GLint*){}
+static void null_glProgramUniform3ui(GLuint,GLint,GLuint,GLuint,GLuint){}
+static void null_glVertexAttrib3svARB(GLuint,const GLshort*){}
+static void null_glGetNamedBufferParameterivEXT(GLuint,GLenum,GLint*){}
+static void null_glMatrixScaledEXT(GLenum,GLdouble,GLdouble,GLdouble){}
+static void null_glProgramUniformMatrix2x3fv(GLuint,GLint,GLsizei,GLboolean,const GLfloat*){}
+static void null_glGetFragmentLightivSGIX(GLenum,GLenum,GLint*){}
+static void null_glWindowPos2svARB(const GLshort*){}
+static void null_glVertexAttrib2svNV(GLuint,const GLshort*){}
+static void null_glWindowPos2ivARB(const GLint*){}
+static void null_glGetVertexAttribPointervNV(GLuint,GLenum,void**){}
+static void null_glPushMatrix(){}
+static void null_glEdgeFlagPointerListIBM(GLint,const GLboolean**,GLint){}
+static void null_glGenerateMipmapEXT(GLenum){}
+static void null_glWindowPos3sv(const GLshort*){}
+static void null_glPathCoordsNV(GLuint,GLsizei,GLenum,const void*){}
+static void null_glProgramUniform1i(GLuint,GLint,GLint){}
+static void null_glProgramUniform1d(GLuint,GLint,GLdouble){}
+static void null_glProgramUniform1f(GLuint,GLint,GLfloat){}
+static void null_glProgramParameteriEXT(GLuint,GLenum,GLint){}
+static void null_glCompressedMultiTexImage2DEXT(GLenum,GLenum,GLint,GLenum,GLsizei,GLsizei,GLint,GLsizei,const void*){}
+static void null_glProgramUniform3iv(GLuint,GLint,GLsizei,const GLint*){}
+static void null_glIndexiv(const GLint*){}
+static void null_glMultiTexCoord4xvOES(GLenum,const GLfixed*){}
+static void null_glEGLImageTargetTexture2DOES(GLenum,GLeglImageOES){}
+static void null_glPixelZoom(GLfloat,GLfloat){}
+static void null_glVertex3bvOES(const GLbyte*){}
+static void null_glFramebufferReadBufferEXT(GLuint,GLenum){}
+static void null_glExtractComponentEXT(GLuint,GLuint,GLuint){}
+static void null_glCombinerParameterivNV(GLenum,const GLint*){}
+static void null_glMinmax(GLenum,GLenum,GLboolean){}
+static void null_glGenBuffersARB(GLsizei,GLuint*){}
+static void null_glColor3usv(const GLushort*){}
+static void null_glBlendEquationi(GLuint,GLenum){}
+static void null_glGetFogFuncSGIS(GLfloat*){}
+static void null_glVertexAttrib4fvNV(GLuint,const GLfloat*){}
+static void null_glGetnMinmax(GLenum,GLboolean,GLenum,GLenum,GLsizei,void*){}
+static void null_glFragmentLightiSGIX(GLenum,GLenum,GLint){}
+static void null_glMultiTexCoord1bvOES(GLenum,const GLbyte*){}
+static void null_glSecondaryColorPointerEXT(GLint,GLenum,GLsizei,const void*){}
+static void null_glMultiTexCoordP4uiv(GLenum,GLenum,const GLuint*){}
+static void null_glGetBufferSubDataARB(GLenum,GLintptrARB,GLsizeiptrARB,void*){}
+static void null_glGetPathParameterivNV(GLuint,GLenum,GLint*){}
+static void null_glFlushRasterSGIX(){}
+static void null_glElementPointerATI(GLenum,const void*){}
+static void null_glGetAttachedObjectsARB(GLhandleARB,GLsizei,GLsizei*,GLhandleARB*){}
+static void null_glUniform4iv(GLint,GLsizei,const GLint*){}
+static void null_glFogxOES(GLenum,GLfixed){}
+static void null_glSharpenTexFuncSGIS(GLenum,GLsizei,const GLfloat*){}
+static void null_glClearDepthfOES(GLclampf){}
+static void null_glDeleteCommandListsNV(GLsizei,const GLuint*){}
+static void null_glVertex4hNV(GLhalfNV,GLhalfNV,GLhalfNV,GLhalfNV){}
+static void null_glSecondaryColor3dvEXT(const GLdouble*){}
+static void null_glGenTextures(GLsizei,GLuint*){}
+static void null_glTextureStorage2DMultisample(GLuint,GLsizei,GLenum,GLsizei,GLsizei,GLboolean){}
+static void null_glUniform3ui64vNV(GLint,GLsizei,const GLuint64EXT*){}
+static void null_glBlendFuncSeparateIndexedAMD(GLuint,GLenum,GLenum,GLenum,GLenum){}
+static void null_glMakeBufferResidentNV(GLenum,GLenum){}
+static void null_glShaderOp2EXT(GLenum,GLuint,GLuint,GLuint){}
+static void null_glGetVertexAttribivNV(GLuint,GLenum,GLint*){}
+static void null_glTexParameterIivEXT(GLenum,GLenum,const GLint*){}
+static void null_glGetPerfQueryDataINTEL(GLuint,GLuint,GLsizei,GLvoid*,GLuint*){}
+static void null_glVertexAttrib4dvARB(GLuint,const GLdouble*){}
+static void null_glTextureSubImage1DEXT(GLuint,GLenum,GLint,GLint,GLsizei,GLenum,GLenum,const void*){}
+static void null_glGetActiveUniformBlockName(GLuint,GLuint,GLsizei,GLsizei*,GLchar*){}
+static void null_glVertexAttrib2dvARB(GLuint,const GLdouble*){}
+static void null_glVertexAttribPointer(GLuint,GLint,GLenum,GLboolean,GLsizei,const void*){}
+static void null_glDepthBoundsdNV(GLdouble,GLdouble){}
+static void null_glDeleteTexturesEXT(GLsizei,const GLuint*){}
+static void null_glDrawBuffersATI(GLsizei,const GLenum*){}
+static void null_glLightModelxvOES(GLenum,const GLfixed*){}
+static void null_glApplyTextureEXT(GLenum){}
+static GLuint64 null_glGetImageHandleNV(GLuint,GLint,GLboolean,GLint,GLenum){return (GLuint64)0;}
+static void null_glGetMinmax(GLenum,GLboolean,GLenum,GLenum,GLvoid*){}
+static void null_glGetFixedvOES(GLenum,GLfixed*){}
+static void null_glSamplePatternEXT(GLenum){}
+static void null_glUniform1f(GLint,GLfloat){}
+static void null_glColor4fNormal3fVertex3fSUN(GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat){}
+static void null_glFogCoorddvEXT(const GLdouble*){}
+static void null_glCopyTextureImage1DEXT(GLuint,GLenum,GLint,GLenum,GLint,GLint,GLsizei,GLint){}
+static void null_glFlushMappedBufferRangeAPPLE(GLenum,GLintptr,GLsizeiptr){}
+static void null_glVertex3sv(const GLshort*){}
+static void null_glFlushStaticDataIBM(GLenum){}
+static void null_glProgramUniform4ui64NV(GLuint,GLint,GLuint64EXT,GLuint64EXT,GLuint64EXT,GLuint64EXT){}
+static void null_glRasterPos4xOES(GLfixed,GLfixed,GLfixed,GLfixed){}
+static void null_glVertexAttribP1ui(GLuint,GLenum,GLboolean,GLuint){}
+static void null_glProgramUniform4dvEXT(GLuint,GLint,GLsizei,const GLdouble*){}
+static void null_glEndTransformFeedbackEXT(){}
+static void null_glBinormal3dEXT(GLdouble,GLdouble,GLdouble){}
+static void null_glGetTextureSubImage(GLuint,GLint,GLint,GLint,GLint,GLsizei,GLsizei,GLsizei,GLenum,GLenum,GLsizei,void*){}
+static void null_glGetNamedRenderbufferParameteriv(GLuint,GLenum,GLint*){}
+static void null_glBindBuffersRange(GLenum,GLuint,GLsizei,const GLuint*,const GLintptr*,const GLsizeiptr*){}
+static GLint null_glFinishAsyncSGIX(GLuint*){return (GLint)0;}
+static void null_glBindFragDataLocationIndexed(GLuint,GLuint,GLuint,const GLchar*){}
+static void null_glMultiTexCoord2dv(GLenum,const GLdouble*){}
+static void null_glUniform2iv(GLint,GLsizei,const GLint*){}
+static void null_glProgramUniform2i64vNV(GLuint,GLint,GLsizei,const GLint64EXT*){}
+static void null_glFlushVertexArrayRangeAPPLE(GLsizei,void*){}
+static void null_glTextureParameterf(GLuint,GLenum,GLfloat){}
+static void null_glMultiTexCoord3dvARB(GLenum,const GLdouble*){}
+static void null_glFeedbackBuffer(GLsizei,GLenum,GLfloat*){}
+static void null_glDebugMessageInsertARB(GLenum,GLenum,GLuint,GLenum,GLsizei,const GLchar*){}
+static void null_glMultiTexCoord2i(GLenum,GLint,GLint){}
+static void null_glTextureSubImage3D(GLuint,GLint,GLint,GLint,GLint,GLsizei,GLsizei,GLsizei,GLenum,GLenum,const void*){}
+static void null_glFramebufferTexture1D(GLenum,GLenum,GLenum,GLuint,GLint){}
+static void null_glGetShaderiv(GLuint,GLenum,GLint*){}
+static void null_glMultiTexCoord2d(GLenum,GLdouble,GLdouble){}
+static void null_glArrayObjectATI(GLenum,GLint,GLenum,GLsizei,GLuint,GLuint){}
+static void null_glGetPointeri_vEXT(GLenum,GLuint,void**){}
+static void null_glGetPerfMonitorCountersAMD(GLuint,GLint*,GLint*,GLsizei,GLuint*){}
+static void null_glNamedBufferStorage(GLuint,GLsizeiptr,const void*,GLbitfield){}
+static void null_glTexEnvxvOES(GLenum,GLenum,const GLfixed*){}
+static void null_glProgramUniform2ui64NV(GLuint,GLint,GLuint64EXT,GLuint64EXT){}
+static void null_glMultiTexCoord3bOES(GLenum,GLbyte,GLbyte,GLbyte){}
+static void null_glUniform1dv(GLint,GLsizei,const GLdouble*){}
+static void null_glPixelTransferi(GLenum,GLint){}
+static void null_glSecondaryColor3usvEXT(const GLushort*){}
+static void null_glProgramEnvParameterI4uivNV(GLenum,GLuint,const GLuint*){}
+static void null_glVertex2sv(const GLshort*){}
+static void null_glWindowPos4dMESA(GLdouble,GLdouble,GLdouble,GLdouble){}
+static void null_glDebugMessageControlARB(GLenum,GLenum,GLenum,GLsizei,const GLuint*,GLboolean){}
+static GLboolean null_glIsTextureEXT(GLuint){return (GLboolean)0;}
+static void null_glFragmentMaterialivSGIX(GLenum,GLenum,const GLint*){}
+static void null_glLinkProgramARB(GLhandleARB){}
+static void null_glFinishFenceAPPLE(GLuint){}
+static void null_glVertexArrayVertexAttribBindingEXT(GLuint,GLuint,GLuint){}
+static void null_glMultiTexCoord4fv(GLenum,const GLfloat*){}
+static void null_glRasterPos3i(GLint,GLint,GLint){}
+static void null_glRasterPos3d(GLdouble,GLdouble,GLdouble){}
+static GLint null_glPollAsyncSGIX(GLuint*){return (GLint)0;}
+static void null_glRasterPos3f(GLfloat,GLfloat,GLfloat){}
+static void null_glCompressedTexImage3D(GLenum,GLint,GLenum,GLsizei,GLsizei,GLsizei,GLint,GLsizei,const GLvoid*){}
+static void null_glVariantivEXT(GLuint,const GLint*){}
+static void null_glUnmapTexture2DINTEL(GLuint,GLint){}
+static void null_glGetVertexAttribiv(GLuint,GLenum,GLint*){}
+static void null_glGetPathCoordsNV(GLuint,GLfloat*){}
+static void null_glColor4xvOES(const GLfixed*){}
+static void null_glVertexAttrib3fv(GLuint,const GLfloat*){}
+static void null_glRasterPos3s(GLshort,GLshort,GLshort){}
+static void null_glVertex4bOES(GLbyte,GLbyte,GLbyte,GLbyte){}
+static void null_glTransformFeedbackVaryingsEXT(GLuint,GLsizei,const GLchar*const*,GLenum){}
+static void null_glCombinerOutputNV(GLenum,GLenum,GLenum,GLenum,GLenum,GLenum,GLenum,GLboolean,GLboolean,GLboolean){}
+static void null_glWindowPos4sMESA(GLshort,GLshort,GLshort,GLshort){}
+static void null_glVertexAttrib4svARB(GLuint,const GLshort*){}
+static GLboolean null_glIsList(GLuint){return (GLboolean)0;}
+static void null_glGetInfoLogARB(GLhandleARB,GLsizei,GLsizei*,GLcharARB*){}
+static void null_glUniformMatrix2fv(GLint,GLsizei,GLboolean,const GLfloat*){}
+static void null_glVertexAttribs3dvNV(GLuint,GLsizei,const GLdouble*){}
+static void null_glGlobalAlphaFactorsSUN(GLshort){}
+static void null_glGetTrackMatrixivNV(GLenum,GLuint,GLenum,GLint*){}
+static void null_glTextureParameterfvEXT(GLuint,GLenum,GLenum,const GLfloat*){}
+static GLboolean null_glIsNamedBufferResidentNV(GLuint){return (GLboolean)0;}
+static void null_glProgramUniform4ui64vARB(GLuint,GLint,GLsizei,const GLuint64*){}
+static void null_glTbufferMask3DFX(GLuint){}
+static void null_glCoverFillPathNV(GLuint,GLenum){}
+static void null_glVertexAttrib1fvARB(GLuint,const GLfloat*){}
+static void null_glGenerateTextureMipmap(GLuint){}
+static void null_glNamedProgramLocalParameterI4uivEXT(GLuint,GLenum,GLuint,const GLuint*){}
+static void null_glMultiDrawElementsBaseVertex(GLenum,const GLsizei*,GLenum,const void*const*,GLsizei,const GLint*){}
+static void null_glProgramSubroutineParametersuivNV(GLenum,GLsizei,const GLuint*){}
+static void null_glProgramUniformMatrix2x4dvEXT(GLuint,GLint,GLsizei,GLboolean,const GLdouble*){}
+static void null_glRotatexOES(GLfixed,GLfixed,GLfixed,GLfixed){}
+static void null_glMemoryBarrierEXT(GLbitfield){}
+static void null_glVertexAttrib3svNV(GLuint,const GLshort*){}
+static void null_glVertexStream3iATI(GLenum,GLint,GLint,GLint){}
+static void null_glCompressedTexSubImage1D(GLenum,GLint,GLint,GLsizei,GLenum,GLsizei,const GLvoid*){}
+static void null_glSetFenceNV(GLuint,GLenum){}
+static void null_glAttachObjectARB(GLhandleARB,GLhandleARB){}
+static void null_glCopyConvolutionFilter1D(GLenum,GLenum,GLint,GLint,GLsizei){}
+static void null_glProgramParameters4fvNV(GLenum,GLuint,GLsizei,const GLfloat*){}
+static void null_glNamedFramebufferParameteriEXT(GLuint,GLenum,GLint){}
+static void null_glVertexAttrib4Nsv(GLuint,const GLshort*){}
+static void null_glVertexAttribI4usvEXT(GLuint,const GLushort*){}
+static void null_glTextureBufferRangeEXT(GLuint,GLenum,GLenum,GLuint,GLintptr,GLsizeiptr){}
+static void null_glVertexP3uiv(GLenum,const GLuint*){}
+static GLboolean null_glIsPathNV(GLuint){return (GLboolean)0;}
+static void null_glGetnUniformi64vARB(GLuint,GLint,GLsizei,GLint64*){}
+static void null_glFramebufferTextureMultiviewOVR(GLenum,GLenum,GLuint,GLint,GLint,GLsizei){}
+static void null_glCompressedMultiTexSubImage2DEXT(GLenum,GLenum,GLint,GLint,GLint,GLsizei,GLsizei,GLenum,GLsizei,const void*){}
+static void null_glGetnMapdv(GLenum,GLenum,GLsizei,GLdouble*){}
+static void null_glDebugMessageCallback(GLDEBUGPROC,const void*){}
+static void null_glTangent3svEXT(const GLshort*){}
+static void null_glVertexAttribParameteriAMD(GLuint,GLenum,GLint){}
+static void null_glBufferSubDataARB(GLenum,GLintptrARB,GLsizeiptrARB,const void*){}
+static void null_glGetVertexAttribLui64vARB(GLuint,GLenum,GLuint64EXT*){}
+static void null_glVertexAttribL4ui64NV(GLuint,GLuint64EXT,GLuint64EXT,GLuint64EXT,GLuint64EXT){}
+static void null_glReplacementCodeuiColor4ubVertex3fSUN(GLuint,GLubyte,GLubyte,GLubyte,GLubyte,GLfloat,GLfloat,GLfloat){}
+static void null_glImageTransformParameterfHP(GLenum,GLenum,GLfloat){}
+static void null_glMap1f(GLenum,GLfloat,GLfloat,GLint,GLint,const GLfloat*){}
+static void null_glRasterPos4fv(const GLfloat*){}
+static void null_glVertex2bvOES(const GLbyte*){}
+static void null_glGetMapControlPointsNV(GLenum,GLuint,GLenum,GLsizei,GLsizei,GLboolean,void*){}
+static void null_glNamedProgramLocalParametersI4ivEXT(GLuint,GLenum,GLuint,GLsizei,const GLint*){}
+static void null_glBindBufferRangeNV(GLenum,GLuint,GLuint,GLintptr,GLsizeiptr){}
+static void null_glVertexStream3dvATI(GLenum,const GLdouble*){}
+static void null_glNormalPointerListIBM(GLenum,GLint,const void**,GLint){}
+static void null_glFogFuncSGIS(GLsizei,const GLfloat*){}
+static void null_glMultiModeDrawArraysIBM(const GLenum*,const GLint*,const GLsizei*,GLsizei,GLint){}
+static void null_glGetNamedFramebufferAttachmentParameterivEXT(GLuint,GLenum,GLenum,GLint*){}
+static void null_glGetFloatv(GLenum,GLfloat*){}
+static void null_glVertexArrayVertexAttribIFormatEXT(GLuint,GLuint,GLint,GLenum,GLuint){}
+static void null_glHint(GLenum,GLenum){}
+static GLboolean null_glPointAlongPathNV(GLuint,GLsizei,GLsizei,GLfloat,GLfloat*,GLfloat*,GLfloat*,GLfloat*){return (GLboolean)0;}
+static void null_glVertexStream2svATI(GLenum,const GLshort*){}
+static void null_glMultiDrawArraysIndirect(GLenum,const void*,GLsizei,GLsizei){}
+static void null_glVertexAttribP2uiv(GLuint,GLenum,GLboolean,const GLuint*){}
+static void null_glProgramUniform1i64vARB(GLuint,GLint,GLsizei,const GLint64*){}
+static void null_glFramebufferTextureARB(GLenum,GLenum,GLuint,GLint){}
+static void null_glPushClientAttribDefaultEXT(GLbitfield){}
+static void null_glScalef(GLfloat,GLfloat,GLfloat){}
+static void null_glScaled(GLdouble,GLdouble,GLdouble){}
+static void null_glGetConvolutionParameterxvOES(GLenum,GLenum,GLfixed*){}
+static void null_glGetProgramResourceName(GLuint,GLenum,GLuint,GLsizei,GLsizei*,GLchar*){}
+static void null_glCopyColorTable(GLenum,GLenum,GLint,GLint,GLsizei){}
+static void null_glDepthRangeArrayv(GLuint,GLsizei,const GLdouble*){}
+static void null_glCoverFillPathInstancedNV(GLsizei,GLenum,const void*,GLuint,GLenum,GLenum,const GLfloat*){}
+static void null_glMultiTexParameterivEXT(GLenum,GLenum,GLenum,const GLint*){}
+static void null_glGetActiveAtomicCounterBufferiv(GLuint,GLuint,GLenum,GLint*){}
+static void null_glStencilOpSeparate(GLenum,GLenum,GLenum,GLenum){}
+static void null_glVertexAttrib4fNV(GLuint,GLfloat,GLfloat,GLfloat,GLfloat){}
+static void null_glGetColorTableParameterivSGI(GLenum,GLenum,GLint*){}
+static void null_glVertexArrayAttribBinding(GLuint,GLuint,GLuint){}
+static void null_glProgramParameters4dvNV(GLenum,GLuint,GLsizei,const GLdouble*){}
+static void null_glVertexAttribL4dv(GLuint,const GLdouble*){}
+static void null_glVertexStream3dATI(GLenum,GLdouble,GLdouble,GLdouble){}
+static GLintptr null_glGetUniformOffsetEXT(GLuint,GLint){return (GLintptr)0;}
+static void null_glGetVertexAttribPointerv(GLuint,GLenum,void**){}
+static void null_glProgramUniform3i64vNV(GLuint,GLint,GLsizei,const GLint64EXT*){}
+static void null_glTangent3fEXT(GLfloat,GLfloat,GLfloat){}
+static void null_glGetPathMetricRangeNV(GLbitfield,GLuint,GLsizei,GLsizei,GLfloat*){}
+static void null_glWindowPos2iMESA(GLint,GLint){}
+static void null_glVertex2xvOES(const GLfixed*){}
+static void null_glGetnCompressedTexImage(GLenum,GLint,GLsizei,void*){}
+static void null_glWindowPos2dv(const GLdouble*){}
+static void null_glReplacementCodeuiVertex3fSUN(GLuint,GLfloat,GLfloat,GLfloat){}
+static void null_glGetTransformFeedbackVaryingEXT(GLuint,GLuint,GLsizei,GLsizei*,GLsizei*,GLenum*,GLchar*){}
+static void null_glWindowPos3fARB(GLfloat,GLfloat,GLfloat){}
+static void* null_glMapNamedBufferEXT(GLuint,GLenum){return (void*)0;}
+static void null_glDisable(GLenum){}
+static GLboolean null_glIsPointInFillPathNV(GLuint,GLuint,GLfloat,GLfloat){return (GLboolean)0;}
+static void null_glVertexAttribI2uiEXT(GLuint,GLuint,GLuint){}
+static void null_glProgramUniform4uiv(GLuint,GLint,GLsizei,const GLuint*){}
+static void null_glQueryCounter(GLuint,GLenum){}
+static void null_glFramebufferRenderbufferEXT(GLenum,GLenum,GLenum,GLuint){}
+static void null_glBinormal3svEXT(const GLshort*){}
+static void null_glBindBufferOffsetNV(GLenum,GLuint,GLuint,GLintptr){}
+static void null_glCopyTextureSubImage2D(GLuint,GLint,GLint,GLint,GLint,GLint,GLsizei,GLsizei){}
+static void null_glGetProgramResourcefvNV(GLuint,GLenum,GLuint,GLsizei,const GLenum*,GLsizei,GLsizei*,GLfloat*){}
+static void null_glBinormalPointerEXT(GLenum,GLsizei,const void*){}
+static void null_glGetLightfv(GLenum,GLenum,GLfloat*){}
+static void null_glVertex2bOES(GLbyte,GLbyte){}
+static void null_glUniform2ivARB(GLint,GLsizei,const GLint*){}
+static void null_glMultiTexCoord3s(GLenum,GLshort,GLshort,GLshort){}
+static void null_glGetHistogramParameterfvEXT(GLenum,GLenum,GLfloat*){}
+static void null_glGetProgramStringNV(GLuint,GLenum,GLubyte*){}
+static void null_glGetTexGenxvOES(GLenum,GLenum,GLfixed*){}
+static void null_glTextureSubImage2D(GLuint,GLint,GLint,GLint,GLsizei,GLsizei,GLenum,GLenum,const void*){}
+static GLenum null_glObjectPurgeableAPPLE(GLenum,GLuint,GLenum){return (GLenum)0;}
+static void null_glColorTableSGI(GLenum,GLenum,GLsizei,GLenum,GLenum,const void*){}
+static void null_glCopyConvolutionFilter2DEXT(GLenum,GLenum,GLint,GLint,GLsizei,GLsizei){}
+static void null_glMultiTexCoord3f(GLenum,GLfloat,GLfloat,GLfloat){}
+static void null_glMultiTexCoord3d(GLenum,GLdouble,GLdouble,GLdouble){}
+static void null_glFogCoorddv(const GLdouble*){}
+static void null_glGetBufferPointerv(GLenum,GLenum,void**){}
+static void null_glProgramUniform1fEXT(GLuint,GLint,GLfloat){}
+static void null_glWindowPos2fvMESA(const GLfloat*){}
+static void null_glPolygonOffsetxOES(GLfixed,GLfixed){}
+static void null_glVertexAttrib4dARB(GLuint,GLdouble,GLdouble,GLdouble,GLdouble){}
+static void null_glUniformHandleui64vARB(GLint,GLsizei,const GLuint64*){}
+static void null_glFragmentLightModelfvSGIX(GLenum,const GLfloat*){}
+static void null_glSwizzleEXT(GLuint,GLuint,GLenum,GLenum,GLenum,GLenum){}
+static void null_glBindFragmentShaderATI(GLuint){}
+static void null_glVertexAttribs3hvNV(GLuint,GLsizei,const GLhalfNV*){}
+static void null_glColorP3ui(GLenum,GLuint){}
+static void null_glListParameterfvSGIX(GLuint,GLenum,const GLfloat*){}
+static void null_glNamedRenderbufferStorageMultisample(GLuint,GLsizei,GLenum,GLsizei,GLsizei){}
+static void null_glVertexAttribI1iEXT(GLuint,GLint){}
+static void null_glMultiTexCoord2ivARB(GLenum,const GLint*){}
+static void null_glLightModelxOES(GLenum,GLfixed){}
+static void null_glColor3xOES(GLfixed,GLfixed,GLfixed){}
+static void null_glReadBuffer(GLenum){}
+static void null_glStencilFillPathInstancedNV(GLsizei,GLenum,const void*,GLuint,GLenum,GLuint,GLenum,const GLfloat*){}
+static void null_glVDPAUUnmapSurfacesNV(GLsizei,const GLvdpauSurfaceNV*){}
+static void null_glProgramUniform4i64NV(GLuint,GLint,GLint64EXT,GLint64EXT,GLint64EXT,GLint64EXT){}
+static void null_glVertexStream4dvATI(GLenum,const GLdouble*){}
+static GLboolean null_glIsQuery(GLuint){return (GLboolean)0;}
+static void null_glProgramUniformMatrix4fvEXT(GLuint,GLint,GLsizei,GLboolean,const GLfloat*){}
+static void null_glVertexAttrib3hNV(GLuint,GLhalfNV,GLhalfNV,GLhalfNV){}
+static void null_glFlushMappedNamedBufferRange(GLuint,GLintptr,GLsizeiptr){}
+static void null_glPushName(GLuint){}
+static void null_glGetClipPlane(GLenum,GLdouble*){}
+static void null_glVertex4dv(const GLdouble*){}
+static void null_glVertexAttrib3d(GLuint,GLdouble,GLdouble,GLdouble){}
+static void null_glBlendColor(GLfloat,GLfloat,GLfloat,GLfloat){}
+static void null_glBindTransformFeedbackNV(GLenum,GLuint){}
+static void null_glSamplerParameterIuiv(GLuint,GLenum,const GLuint*){}
+static void null_glIndexubv(const GLubyte*){}
+static void null_glNamedBufferPageCommitmentEXT(GLuint,GLintptr,GLsizeiptr,GLboolean){}
+static GLenum null_glCheckNamedFramebufferStatus(GLuint,GLenum){return (GLenum)0;}
+static void null_glGetObjectBufferfvATI(GLuint,GLenum,GLfloat*){}
+static void null_glRasterPos4d(GLdouble,GLdouble,GLdouble,GLdouble){}
+static void null_glRasterPos4f(GLfloat,GLfloat,GLfloat,GLfloat){}
+static void null_glGetPerfMonitorCounterStringAMD(GLuint,GLuint,GLsizei,GLsizei*,GLchar*){}
+static void null_glVertexAttrib3s(GLuint,GLshort,GLshort,GLshort){}
+static void null_glDrawElementsInstancedEXT(GLenum,GLsizei,GLenum,const void*,GLsizei){}
+static void null_glNamedProgramLocalParameterI4iEXT(GLuint,GLenum,GLuint,GLint,GLint,GLint,GLint){}
+static void null_glRasterPos4s(GLshort,GLshort,GLshort,GLshort){}
+static void null_glGetProgramStageiv(GLuint,GLenum,GLenum,GLint*){}
+static void null_glGetMaterialxOES(GLenum,GLenum,GLfixed){}
+static void null_glPopMatrix(){}
+static void null_glGetVideoui64vNV(GLuint,GLenum,GLuint64EXT*){}
+static void null_glTangent3bEXT(GLbyte,GLbyte,GLbyte){}
+static GLenum null_glGetGraphicsResetStatusARB(){return (GLenum)0;}
+static void null_glUniform4i(GLint,GLint,GLint,GLint,GLint){}
+static void null_glActiveTexture(GLenum){}
+static void null_glEnableVertexAttribArray(GLuint){}
+static void null_glTexCoord4fVertex4fvSUN(const GLfloat*,const GLfloat*){}
+static void null_glUniform4d(GLint,GLdouble,GLdouble,GLdouble,GLdouble){}
+static void null_glUniform4f(GLint,GLfloat,GLfloat,GLfloat,GLfloat){}
+static void null_glRenderbufferStorageMultisample(GLenum,GLsizei,GLenum,GLsizei,GLsizei){}
+static void null_glCreateProgramPipelines(GLsizei,GLuint*){}
+static void null_glVertexAttribLPointer(GLuint,GLint,GLenum,GLsizei,const void*){}
+static void null_glUniform2uiEXT(GLint,GLuint,GLuint){}
+static void null_glMultiTexCoord3sv(GLenum,const GLshort*){}
+static void null_glDrawElementsInstancedBaseVertex(GLenum,GLsizei,GLenum,const void*,GLsizei,GLint){}
+static void null_glPixelTransformParameterfvEXT(GLenum,GLenum,const GLfloat*){}
+static void null_glDrawTransformFeedbackNV(GLenum,GLuint){}
+static void null_glTextureImage2DMultisampleCoverageNV(GLuint,GLenum,GLsizei,GLsizei,GLint,GLsizei,GLsizei,GLboolean){}
+static void null_glNamedRenderbufferStorageMultisampleCoverageEXT(GLuint,GLsizei,GLsizei,GLenum,GLsizei,GLsizei){}
+static GLboolean null_glIsTexture(GLuint){return (GLboolean)0;}
+static void null_glMultiTexCoord4iv(GLenum,const GLint*){}
+static void null_glTexEnvfv(GLenum,GLenum,const GLfloat*){}
+static void null_glPopDebugGroup(){}
+static void null_glUniformBlockBinding(GLuint,GLuint,GLuint){}
+static void null_glWindowPos2svMESA(const GLshort*){}
+static void null_glGenerateTextureMipmapEXT(GLuint,GLenum){}
+static GLuint null_glBindLightParameterEXT(GLenum,GLenum){return (GLuint)0;}
+static void null_glTexCoord3bOES(GLbyte,GLbyte,GLbyte){}
+static void null_glTexCoordPointer(GLint,GLenum,GLsizei,const GLvoid*){}
+static void null_glProgramUniformMatrix3x2fv(GLuint,GLint,GLsizei,GLboolean,const GLfloat*){}
+static void null_glUniform2fvARB(GLint,GLsizei,const GLfloat*){}
+static void null_glProgramLocalParameterI4uivNV(GLenum,GLuint,const GLuint*){}
+static void null_glFlushVertexArrayRangeNV(){}
+static void null_glSecondaryColor3svEXT(const GLshort*){}
+static void null_glGetBufferParameteriv(GLenum,GLenum,GLint*){}
+static void null_glGetQueryIndexediv(GLenum,GLuint,GLenum,GLint*){}
+static void null_glFramebufferTexture3DEXT(GLenum,GLenum,GLenum,GLuint,GLint,GLint){}
+static void null_glLoadTransposeMatrixxOES(const GLfixed*){}
+static void null_glDeleteTransformFeedbacksNV(GLsizei,const GLuint*){}
+static void null_glGetCompressedTextureImageEXT(GLuint,GLenum,GLint,void*){}
+static void null_glIndexMaterialEXT(GLenum,GLenum){}
+static void null_glFogCoorddEXT(GLdouble){}
+static void null_glTexCoord2hvNV(const GLhalfNV*){}
+static void null_glFramebufferTexture2DEXT(GLenum,GLenum,GLenum,GLuint,GLint){}
+static void null_glTexEnviv(GLenum,GLenum,const GLint*){}
+static void null_glEndTransformFeedbackNV(){}
+static void null_glGlobalAlphaFactoruiSUN(GLuint){}
+static void null_glSelectBuffer(GLsizei,GLuint*){}
+static void null_glNamedBufferSubDataEXT(GLuint,GLintptr,GLsizeiptr,const void*){}
+static void null_glDisableVertexArrayAttrib(GLuint,GLuint){}
+static void null_glBlendFunc(GLenum,GLenum){}
+static GLuint null_glCreateProgram(){return (GLuint)0;}
+static void null_glVertexStream2dATI(GLenum,GLdouble,GLdouble){}
+static void null_glUniform4ui64vARB(GLint,GLsizei,const GLuint64*){}
+static void null_glPrimitiveRestartIndex(GLuint){}
+static void null_glNormalStream3fATI(GLenum,GLfloat,GLfloat,GLfloat){}
+static void null_glProgramUniformMatrix2fv(GLuint,GLint,GLsizei,GLboolean,const GLfloat*){}
+static void null_glVertexAttribs1hvNV(GLuint,GLsizei,const GLhalfNV*){}
+static void null_glWindowPos4svMESA(const GLshort*){}
+static void null_glDeleteFragmentShaderATI(GLuint){}
+static void null_glBindImageTextures(GLuint,GLsizei,const GLuint*){}
+static void null_glMap2xOES(GLenum,GLfixed,GLfixed,GLint,GLint,GLfixed,GLfixed,GLint,GLint,GLfixed){}
+static void null_glEnd(){}
+static void null_glMultiTexCoord2dARB(GLenum,GLdouble,GLdouble){}
+static void null_glUniform1i64NV(GLint,GLint64EXT){}
+static void null_glPathStringNV(GLuint,GLenum,GLsizei,const void*){}
+static void null_glGetNamedFramebufferParameterivEXT(GLuint,GLenum,GLint*){}
+static void null_glGetProgramNamedParameterdvNV(GLuint,GLsizei,const GLubyte*,GLdouble*){}
+static void null_glPathDashArrayNV(GLuint,GLsizei,const GLfloat*){}
+static void null_glUniform3uiv(GLint,GLsizei,const GLuint*){}
+static void null_glColor3fVertex3fvSUN(const GLfloat*,const GLfloat*){}
+static void null_glMultTransposeMatrixd(const GLdouble*){}
+static void null_glClearColor(GLclampf,GLclampf,GLclampf,GLclampf){}
+static GLuint64 null_glGetImageHandleARB(GLuint,GLint,GLboolean,GLint,GLenum){return (GLuint64)0;}
+static void null_glTangent3dEXT(GLdouble,GLdouble,GLdouble){}
+static void null_glGetQueryObjectivARB(GLuint,GLenum,GLint*){}
+static void null_glGetLocalConstantFloatvEXT(GLuint,GLenum,GLfloat*){}
+static void null_glUseShaderProgramEXT(GLenum,GLuint){}
+static void null_glBindRenderbufferEXT(GLenum,GLuint){}
+static void null_glInterleavedArrays(GLenum,GLsizei,const GLvoid*){}
+static void null_glGetPerfMonitorGroupStringAMD(GLuint,GLsizei,GLsizei*,GLchar*){}
+static void null_glUniform3ui(GLint,GLuint,GLuint,GLuint){}
+static void null_glGetNamedProgramLocalParameterdvEXT(GLuint,GLenum,GLuint,GLdouble*){}
+static void null_glSecondaryColor3us(GLushort,GLushort,GLushort){}
+static void null_glVertexAttribI4uiv(GLuint,const GLuint*){}
+static void null_glVertexAttrib4bv(GLuint,const GLbyte*){}
+static void null_glMultiTexCoord3xOES(GLenum,GLfixed,GLfixed,GLfixed){}
+static void null_glSecondaryColor3ub(GLubyte,GLubyte,GLubyte){}
+static void null_glFragmentMaterialfSGIX(GLenum,GLenum,GLfloat){}
+static void null_glGetVariantArrayObjectivATI(GLuint,GLenum,GLint*){}
+static void null_glSecondaryColor3ui(GLuint,GLuint,GLuint){}
+static void null_glVertexAttrib1dARB(GLuint,GLdouble){}
+static void null_glGetNamedBufferPointerv(GLuint,GLenum,void**){}
+static void null_glLockArraysEXT(GLint,GLsizei){}
+static void null_glVertexAttribPointerNV(GLuint,GLint,GLenum,GLsizei,const void*){}
+static void null_glConvolutionParameterf(GLenum,GLenum,GLfloat){}
+static void null_glBindBufferBaseEXT(GLenum,GLuint,GLuint){}
+static void null_glTexCoord2xvOES(const GLfixed*){}
+static void null_glGetQueryBufferObjectui64v(GLuint,GLuint,GLenum,GLintptr){}
+static void null_glSetMultisamplefvAMD(GLenum,GLuint,const GLfloat*){}
+static void null_glPathColorGenNV(GLenum,GLenum,GLenum,const GLfloat*){}
+static void null_glVertexAttrib3sARB(GLuint,GLshort,GLshort,GLshort){}
+static void null_glVertexAttrib4ivARB(GLuint,const GLint*){}
+static void null_glGenTransformFeedbacks(GLsizei,GLuint*){}
+static void null_glGetVertexAttribIuiv(GLuint,GLenum,GLuint*){}
+static void null_glPixelTransformParameterfEXT(GLenum,GLenum,GLfloat){}
+static void null_glGetTexParameterIuivEXT(GLenum,GLenum,GLuint*){}
+static void null_glGetObjectParameterivARB(GLhandleARB,GLenum,GLint*){}
+static void null_glVertexArraySecondaryColorOffsetEXT(GLuint,GLuint,GLint,GLenum,GLsizei,GLintptr){}
+static void null_glWindowPos2fARB(GLfloat,GLfloat){}
+static void null_glCompressedTexSubImage2D(GLenum,GLint,GLint,GLint,GLsizei,GLsizei,GLenum,GLsizei,const GLvoid*){}
+static void null_glCompressedTexSubImage3DARB(GLenum,GLint,GLint,GLint,GLint,GLsizei,GLsizei,GLsizei,GLenum,GLsizei,const void*){}
+static void null_glProgramBinary(GLuint,GLenum,const void*,GLsizei){}
+static void null_glPresentFrameKeyedNV(GLuint,GLuint64EXT,GLuint,GLuint,GLenum,GLenum,GLuint,GLuint,GLenum,GLuint,GLuint){}
+static void null_glVertexAttribI4bv(GLuint,const GLbyte*){}
+static void null_glPathCoverDepthFuncNV(GLenum){}
+static void null_glTransformFeedbackStreamAttribsNV(GLsizei,const GLint*,GLsizei,const GLint*,GLenum){}
+static void null_glSecondaryColor3usEXT(GLushort,GLushort,GLushort){}
+static void null_glCopyColorTableSGI(GLenum,GLenum,GLint,GLint,GLsizei){}
+static void null_glProgramEnvParameter4fvARB(GLenum,GLuint,const GLfloat*){}
+static void null_glMultiTexCoord4sARB(GLenum,GLshort,GLshort,GLshort,GLshort){}
+static void null_glGetVertexArrayIndexed64iv(GLuint,GLuint,GLenum,GLint64*){}
+static void null_glMatrixMultTranspose3x3fNV(GLenum,const GLfloat*){}
+static void null_glTexParameterIiv(GLenum,GLenum,const GLint*){}
+static void null_glVertexArrayAttribFormat(GLuint,GLuint,GLint,GLenum,GLboolean,GLuint){}
+static void null_glEndTransformFeedback(){}
+static void null_glDrawCommandsStatesAddressNV(const GLuint64*,const GLsizei*,const GLuint*,const GLuint*,GLuint){}
+static void null_glUniform4ui64NV(GLint,GLuint64EXT,GLuint64EXT,GLuint64EXT,GLuint64EXT){}
+static void null_glMaterialiv(GLenum,GLenum,const GLint*){}
+static void null_glTexImage2DMultisample(GLenum,GLsizei,GLenum,GLsizei,GLsizei,GLboolean){}
+static void null_glBindTextureEXT(GLenum,GLuint){}
+static GLboolean null_glIsBuffer(GLuint){return (GLboolean)0;}
+static void null_glVertexAttribI1iv(GLuint,const GLint*){}
+static void null_glGetFinalCombinerInputParameterfvNV(GLenum,GLenum,GLfloat*){}
+static void null_glMultiTexCoord3bvOES(GLenum,const GLbyte*){}
+static void null_glVertexAttribDivisor(GLuint,GLuint){}
+static void null_glCopyBufferSubData(GLenum,GLenum,GLintptr,GLintptr,GLsizeiptr){}
+static GLuint null_glBindTexGenParameterEXT(GLenum,GLenum,GLenum){return (GLuint)0;}
+static void null_glNormalStream3bATI(GLenum,GLbyte,GLbyte,GLbyte){}
+static void null_glTextureImage2DEXT(GLuint,GLenum,GLint,GLint,GLsizei,GLsizei,GLint,GLenum,GLenum,const void*){}
+static void null_glGetColorTableParameteriv(GLenum,GLenum,GLint*){}
+static void null_glActiveTextureARB(GLenum){}
+static void null_glTexCoord4xOES(GLfixed,GLfixed,GLfixed,GLfixed){}
+static void null_glSecondaryColor3fvEXT(const GLfloat*){}
+static void null_glUniformMatrix4x2fv(GLint,GLsizei,GLboolean,const GLfloat*){}
+static void null_glStartInstrumentsSGIX(){}
+static void null_glProgramNamedParameter4fvNV(GLuint,GLsizei,const GLubyte*,const GLfloat*){}
+static void null_glEndVideoCaptureNV(GLuint){}
+static GLuint null_glGenLists(GLsizei){return (GLuint)0;}
+static void null_glUniform1fARB(GLint,GLfloat){}
+static void null_glNamedFramebufferTexture1DEXT(GLuint,GLenum,GLenum,GLuint,GLint){}
+static void* null_glMapBufferRange(GLenum,GLintptr,GLsizeiptr,GLbitfield){return (void*)0;}
+static void null_glMultiDrawElementsIndirectCountARB(GLenum,GLenum,GLintptr,GLintptr,GLsizei,GLsizei){}
+static void null_glProgramUniformMatrix4x2fv(GLuint,GLint,GLsizei,GLboolean,const GLfloat*){}
+static void null_glGetTextureParameterIivEXT(GLuint,GLenum,GLenum,GLint*){}
+static void null_glMultiTexCoord3hNV(GLenum,GLhalfNV,GLhalfNV,GLhalfNV){}
+static void null_glNamedProgramLocalParametersI4uivEXT(GLuint,GLenum,GLuint,GLsizei,const GLuint*){}
+static void null_glEndList(){}
+static void null_glTexCoord2fColor4fNormal3fVertex3fSUN(GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat){}
+static void null_glGenTransformFeedbacksNV(GLsizei,GLuint*){}
+static void null_glEdgeFlagv(const GLboolean*){}
+static void null_glVertexAttribI2iv(GLuint,const GLint*){}
+static void null_glCopyMultiTexImage2DEXT(GLenum,GLenum,GLint,GLenum,GLint,GLint,GLsizei,GLsizei,GLint){}
+static void null_glUniformMatrix3x2dv(GLint,GLsizei,GLboolean,const GLdouble*){}
+static void null_glTexImage3DMultisampleCoverageNV(GLenum,GLsizei,GLsizei,GLint,GLsizei,GLsizei,GLsizei,GLboolean){}
+static void null_glGetShaderPrecisionFormat(GLenum,GLenum,GLint*,GLint*){}
+static void null_glTexSubImage4DSGIS(GLenum,GLint,GLint,GLint,GLint,GLint,GLsizei,GLsizei,GLsizei,GLsizei,GLenum,GLenum,const void*){}
+static void null_glRasterSamplesEXT(GLuint,GLboolean){}
+static void null_glTextureView(GLuint,GLenum,GLuint,GLenum,GLuint,GLuint,GLuint,GLuint){}
+static void null_glEvalMapsNV(GLenum,GLenum){}
+static GLint null_glGetFragDataLocationEXT(GLuint,const GLchar*){return (GLint)0;}
+static void null_glGetCompressedMultiTexImageEXT(GLenum,GLenum,GLint,void*){}
+static void null_glIndexMask(GLuint){}
+static void null_glPushClientAttrib(GLbitfield){}
+static void null_glShaderSource(GLuint,GLsizei,const GLchar*const*,const GLint*){}
+static void null_glDispatchComputeGroupSizeARB(GLuint,GLuint,GLuint,GLuint,GLuint,GLuint){}
+static void null_glGetnPixelMapfv(GLenum,GLsizei,GLfloat*){}
+static void null_glTexCoordP2uiv(GLenum,const GLuint*){}
+static void null_glUniform2f(GLint,GLfloat,GLfloat){}
+static void null_glGetNamedBufferParameteri64v(GLuint,GLenum,GLint64*){}
+static void null_glCommandListSegmentsNV(GLuint,GLuint){}
+static void null_glTextureParameterIivEXT(GLuint,GLenum,GLenum,const GLint*){}
+static void null_glMultiTexParameterfvEXT(GLenum,GLenum,GLenum,const GLfloat*){}
+static void null_glProgramUniform2ui64ARB(GLuint,GLint,GLuint64,GLuint64){}
+static void null_glVertex4d(GLdouble,GLdouble,GLdouble,GLdouble){}
+static GLuint null_glNewObjectBufferATI(GLsizei,const void*,GLenum){return (GLuint)0;}
+static void null_glViewportSwizzleNV(GLuint,GLenum,GLenum,GLenum,GLenum){}
+static void null_glBufferData(GLenum,GLsizeiptr,const void*,GLenum){}
+static void null_glTextureImage1DEXT(GLuint,GLenum,GLint,GLint,GLsizei,GLint,GLenum,GLenum,const void*){}
+static void null_glGetTexParameterIiv(GLenum,GLenum,GLint*){}
+static void null_glCopyTexSubImage1DEXT(GLenum,GLint,GLint,GLint,GLint,GLsizei){}
+static void null_glVertex4f(GLfloat,GLfloat,GLfloat,GLfloat){}
+static void null_glUniformMatrix3fvARB(GLint,GLsizei,GLboolean,const GLfloat*){}
+static void null_glTexCoordP1ui(GLenum,GLuint){}
+static void null_glPointParameterfvEXT(GLenum,const GLfloat*){}
+static void null_glUniform4fARB(GLint,GLfloat,GLfloat,GLfloat,GLfloat){}
+static void null_glCopyTextureSubImage3D(GLuint,GLint,GLint,GLint,GLint,GLint,GLint,GLsizei,GLsizei){}
+static void null_glMultiTexCoord2fv(GLenum,const GLfloat*){}
+static void null_glMultiTexEnvfvEXT(GLenum,GLenum,GLenum,const GLfloat*){}
+static void null_glNormalP3ui(GLenum,GLuint){}
+static void null_glDrawRangeElementArrayATI(GLenum,GLuint,GLuint,GLsizei){}
+static void null_glVertexAttribI1i(GLuint,GLint){}
+static void null_glDrawArraysInstancedARB(GLenum,GLint,GLsizei,GLsizei){}
+static void null_glEnableVertexAttribAPPLE(GLuint,GLenum){}
+static GLuint null_glGetDebugMessageLogARB(GLuint,GLsizei,GLenum*,GLenum*,GLuint*,GLenum*,GLsizei*,GLchar*){return (GLuint)0;}
+static void null_glGetPathTexGenfvNV(GLenum,GLenum,GLfloat*){}
+static void null_glNamedProgramLocalParameters4fvEXT(GLuint,GLenum,GLuint,GLsizei,const GLfloat*){}
+static void null_glVertexStream3fvATI(GLenum,const GLfloat*){}
+static void null_glFramebufferTexture3D(GLenum,GLenum,GLenum,GLuint,GLint,GLint){}
+static void null_glCompressedTextureSubImage2DEXT(GLuint,GLenum,GLint,GLint,GLint,GLsizei,GLsizei,GLenum,GLsizei,const void*){}
+static void null_glWindowPos3dv(const GLdouble*){}
+static void null_glCopyConvolutionFilter2D(GLenum,GLenum,GLint,GLint,GLsizei,GLsizei){}
+static void null_glReadInstrumentsSGIX(GLint){}
+static void null_glSamplerParameterfv(GLuint,GLenum,const GLfloat*){}
+static void null_glBindBufferARB(GLenum,GLuint){}
+static void null_glVertexAttrib1sNV(GLuint,GLshort){}
+static void null_glGetMaterialiv(GLenum,GLenum,GLint*){}
+static void null_glUniform1fv(GLint,GLsizei,const GLfloat*){}
+static void null_glBeginOcclusionQueryNV(GLuint){}
+static void null_glGenFencesAPPLE(GLsizei,GLuint*){}
+static void null_glScissorIndexedv(GLuint,const GLint*){}
+static void null_glDisableVariantClientStateEXT(GLuint){}
+static void null_glMinmaxEXT(GLenum,GLenum,GLboolean){}
+static void null_glNormalPointervINTEL(GLenum,const void**){}
+static void null_glNormal3s(GLshort,GLshort,GLshort){}
+static void null_glGetnPixelMapuiv(GLenum,GLsizei,GLuint*){}
+static void null_glNormalStream3bvATI(GLenum,const GLbyte*){}
+static void null_glGetObjectParameterivAPPLE(GLenum,GLuint,GLenum,GLint*){}
+static void null_glNormal3i(GLint,GLint,GLint){}
+static void null_glUniform1ivARB(GLint,GLsizei,const GLint*){}
+static void null_glNormal3d(GLdouble,GLdouble,GLdouble){}
+static void null_glUpdateObjectBufferATI(GLuint,GLuint,GLsizei,const void*,GLenum){}
+static void null_glNormal3b(GLbyte,GLbyte,GLbyte){}
+static GLint null_glGetUniformBufferSizeEXT(GLuint,GLint){return (GLint)0;}
+static void null_glMultiTexCoord4dv(GLenum,const GLdouble*){}
+static void null_glProgramUniform3i64ARB(GLuint,GLint,GLint64,GLint64,GLint64){}
+static void null_glVertexAttrib2d(GLuint,GLdouble,GLdouble){}
+static void null_glVertexAttrib2f(GLuint,GLfloat,GLfloat){}
+static void null_glMultiDrawElementsEXT(GLenum,const GLsizei*,GLenum,const void*const*,GLsizei){}
+static void null_glVertexAttrib3dv(GLuint,const GLdouble*){}
+static void null_glMultiTexCoord2bOES(GLenum,GLbyte,GLbyte){}
+static void null_glVertexAttrib2s(GLuint,GLshort,GLshort){}
+static void null_glTexImage3DMultisample(GLenum,GLsizei,GLenum,GLsizei,GLsizei,GLsizei,GLboolean){}
+static GLuint null_glGetUniformBlockIndex(GLuint,const GLchar*){return (GLuint)0;}
+static void null_glFrontFace(GLenum){}
+static void null_glEvalCoord1xOES(GLfixed){}
+static void null_glDrawArraysInstancedBaseInstance(GLenum,GLint,GLsizei,GLsizei,GLuint){}
+static GLboolean null_glIsPointInStrokePathNV(GLuint,GLfloat,GLfloat){return (GLboolean)0;}
+std::pair<char const*,FUNCTION_POINTER> const nullFunctions[] = {
+  {"glMultiDrawArraysIndirectBindlessCountNV",reinterpret_cast<FUNCTION_POINTER>(null_glMultiDrawArraysIndirectBindlessCountNV)},
+  {"glTextureParameterfv",reinterpret_cast<FUNCTION_POINTER>(null_glTextureParameterfv)},
+  {"glGetListParameterivSGIX",reinterpret_cast<FUNCTION_POINTER>(null_glGetListParameterivSGIX)},
+  {"glProgramUniform1i64ARB",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform1i64ARB)},
+  {"glVertexArrayElementBuffer",reinterpret_cast<FUNCTION_POINTER>(null_glVertexArrayElementBuffer)},
+  {"glHintPGI",reinterpret_cast<FUNCTION_POINTER>(null_glHintPGI)},
+  {"glStencilMaskSeparate",reinterpret_cast<FUNCTION_POINTER>(null_glStencilMaskSeparate)},
+  {"glGetFramebufferAttachmentParameterivEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetFramebufferAttachmentParameterivEXT)},
+  {"glTextureStorage3DMultisample",reinterpret_cast<FUNCTION_POINTER>(null_glTextureStorage3DMultisample)},
+  {"glGetIntegerIndexedvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetIntegerIndexedvEXT)},
+  {"glCopyTexImage1D",reinterpret_cast<FUNCTION_POINTER>(null_glCopyTexImage1D)},
+  {"glVertexAttrib4usv",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib4usv)},
+  {"glTexRenderbufferNV",reinterpret_cast<FUNCTION_POINTER>(null_glTexRenderbufferNV)},
+  {"glVertexAttrib3hvNV",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib3hvNV)},
+  {"glProgramUniform4ui64ARB",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform4ui64ARB)},
+  {"glInstrumentsBufferSGIX",reinterpret_cast<FUNCTION_POINTER>(null_glInstrumentsBufferSGIX)},
+  {"glIndexi",reinterpret_cast<FUNCTION_POINTER>(null_glIndexi)},
+  {"glMultiTexCoord2sARB",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord2sARB)},
+  {"glProgramEnvParameter4fARB",reinterpret_cast<FUNCTION_POINTER>(null_glProgramEnvParameter4fARB)},
+  {"glCompressedTexSubImage3D",reinterpret_cast<FUNCTION_POINTER>(null_glCompressedTexSubImage3D)},
+  {"glEvalCoord2d",reinterpret_cast<FUNCTION_POINTER>(null_glEvalCoord2d)},
+  {"glEvalCoord2f",reinterpret_cast<FUNCTION_POINTER>(null_glEvalCoord2f)},
+  {"glIndexd",reinterpret_cast<FUNCTION_POINTER>(null_glIndexd)},
+  {"glSecondaryColor3hvNV",reinterpret_cast<FUNCTION_POINTER>(null_glSecondaryColor3hvNV)},
+  {"glIndexf",reinterpret_cast<FUNCTION_POINTER>(null_glIndexf)},
+  {"glFrustumxOES",reinterpret_cast<FUNCTION_POINTER>(null_glFrustumxOES)},
+  {"glTextureStorage3DEXT",reinterpret_cast<FUNCTION_POINTER>(null_glTextureStorage3DEXT)},
+  {"glDrawCommandsStatesNV",reinterpret_cast<FUNCTION_POINTER>(null_glDrawCommandsStatesNV)},
+  {"glUniform4uiEXT",reinterpret_cast<FUNCTION_POINTER>(null_glUniform4uiEXT)},
+  {"glProgramUniform3ui64ARB",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform3ui64ARB)},
+  {"glIndexs",reinterpret_cast<FUNCTION_POINTER>(null_glIndexs)},
+  {"glVertexArrayBindVertexBufferEXT",reinterpret_cast<FUNCTION_POINTER>(null_glVertexArrayBindVertexBufferEXT)},
+  {"glConvolutionParameteriEXT",reinterpret_cast<FUNCTION_POINTER>(null_glConvolutionParameteriEXT)},
+  {"glColor4ubVertex2fSUN",reinterpret_cast<FUNCTION_POINTER>(null_glColor4ubVertex2fSUN)},
+  {"glProgramUniform1ivEXT",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform1ivEXT)},
+  {"glGetnMapfv",reinterpret_cast<FUNCTION_POINTER>(null_glGetnMapfv)},
+  {"glTransformFeedbackBufferRange",reinterpret_cast<FUNCTION_POINTER>(null_glTransformFeedbackBufferRange)},
+  {"glPathGlyphsNV",reinterpret_cast<FUNCTION_POINTER>(null_glPathGlyphsNV)},
+  {"glSecondaryColor3fv",reinterpret_cast<FUNCTION_POINTER>(null_glSecondaryColor3fv)},
+  {"glGetCombinerInputParameterivNV",reinterpret_cast<FUNCTION_POINTER>(null_glGetCombinerInputParameterivNV)},
+  {"glEndPerfMonitorAMD",reinterpret_cast<FUNCTION_POINTER>(null_glEndPerfMonitorAMD)},
+  {"glPointParameterfvARB",reinterpret_cast<FUNCTION_POINTER>(null_glPointParameterfvARB)},
+  {"glVertex2xOES",reinterpret_cast<FUNCTION_POINTER>(null_glVertex2xOES)},
+  {"glDrawElementsInstancedBaseInstance",reinterpret_cast<FUNCTION_POINTER>(null_glDrawElementsInstancedBaseInstance)},
+  {"glMultTransposeMatrixdARB",reinterpret_cast<FUNCTION_POINTER>(null_glMultTransposeMatrixdARB)},
+  {"glVertexAttribL4dEXT",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribL4dEXT)},
+  {"glVertex4iv",reinterpret_cast<FUNCTION_POINTER>(null_glVertex4iv)},
+  {"glCoverStrokePathInstancedNV",reinterpret_cast<FUNCTION_POINTER>(null_glCoverStrokePathInstancedNV)},
+  {"glDeformSGIX",reinterpret_cast<FUNCTION_POINTER>(null_glDeformSGIX)},
+  {"glUniform2ui64NV",reinterpret_cast<FUNCTION_POINTER>(null_glUniform2ui64NV)},
+  {"glCopyPathNV",reinterpret_cast<FUNCTION_POINTER>(null_glCopyPathNV)},
+  {"glVertexAttribP4ui",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribP4ui)},
+  {"glVertexAttribL2d",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribL2d)},
+  {"glGetMultisamplefv",reinterpret_cast<FUNCTION_POINTER>(null_glGetMultisamplefv)},
+  {"glCompressedMultiTexSubImage3DEXT",reinterpret_cast<FUNCTION_POINTER>(null_glCompressedMultiTexSubImage3DEXT)},
+  {"glVDPAURegisterOutputSurfaceNV",reinterpret_cast<FUNCTION_POINTER>(null_glVDPAURegisterOutputSurfaceNV)},
+  {"glMinSampleShading",reinterpret_cast<FUNCTION_POINTER>(null_glMinSampleShading)},
+  {"glProgramUniform4fEXT",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform4fEXT)},
+  {"glCoverStrokePathNV",reinterpret_cast<FUNCTION_POINTER>(null_glCoverStrokePathNV)},
+  {"glTextureImage2DMultisampleNV",reinterpret_cast<FUNCTION_POINTER>(null_glTextureImage2DMultisampleNV)},
+  {"glVertex3bOES",reinterpret_cast<FUNCTION_POINTER>(null_glVertex3bOES)},
+  {"glTessellationFactorAMD",reinterpret_cast<FUNCTION_POINTER>(null_glTessellationFactorAMD)},
+  {"glDebugMessageControl",reinterpret_cast<FUNCTION_POINTER>(null_glDebugMessageControl)},
+  {"glIsObjectBufferATI",reinterpret_cast<FUNCTION_POINTER>(null_glIsObjectBufferATI)},
+  {"glPopAttrib",reinterpret_cast<FUNCTION_POINTER>(null_glPopAttrib)},
+  {"glProgramUniform4iEXT",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform4iEXT)},
+  {"glVertexAttrib4ubNV",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib4ubNV)},
+  {"glColorMaterial",reinterpret_cast<FUNCTION_POINTER>(null_glColorMaterial)},
+  {"glVertexAttrib2svARB",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib2svARB)},
+  {"glMinSampleShadingARB",reinterpret_cast<FUNCTION_POINTER>(null_glMinSampleShadingARB)},
+  {"glColor3b",reinterpret_cast<FUNCTION_POINTER>(null_glColor3b)},
+  {"glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN",reinterpret_cast<FUNCTION_POINTER>(null_glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN)},
+  {"glColor3f",reinterpret_cast<FUNCTION_POINTER>(null_glColor3f)},
+  {"glVDPAUGetSurfaceivNV",reinterpret_cast<FUNCTION_POINTER>(null_glVDPAUGetSurfaceivNV)},
+  {"glColor3d",reinterpret_cast<FUNCTION_POINTER>(null_glColor3d)},
+  {"glGetnMapiv",reinterpret_cast<FUNCTION_POINTER>(null_glGetnMapiv)},
+  {"glColor3i",reinterpret_cast<FUNCTION_POINTER>(null_glColor3i)},
+  {"glGetInternalformatSampleivNV",reinterpret_cast<FUNCTION_POINTER>(null_glGetInternalformatSampleivNV)},
+  {"glVertexAttrib4ubv",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib4ubv)},
+  {"glColor3s",reinterpret_cast<FUNCTION_POINTER>(null_glColor3s)},
+  {"glVertexAttribs4hvNV",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribs4hvNV)},
+  {"glVertexAttrib4NubvARB",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib4NubvARB)},
+  {"glMultiTexCoord3hvNV",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord3hvNV)},
+  {"glMatrixPushEXT",reinterpret_cast<FUNCTION_POINTER>(null_glMatrixPushEXT)},
+  {"glProgramUniform2fEXT",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform2fEXT)},
+  {"glGetVertexArrayIndexediv",reinterpret_cast<FUNCTION_POINTER>(null_glGetVertexArrayIndexediv)},
+  {"glBlitFramebuffer",reinterpret_cast<FUNCTION_POINTER>(null_glBlitFramebuffer)},
+  {"glMultiTexCoordP2ui",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoordP2ui)},
+  {"glColorPointerListIBM",reinterpret_cast<FUNCTION_POINTER>(null_glColorPointerListIBM)},
+  {"glVertexAttribL4d",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribL4d)},
+  {"glGetFragmentMaterialfvSGIX",reinterpret_cast<FUNCTION_POINTER>(null_glGetFragmentMaterialfvSGIX)},
+  {"glVertex2iv",reinterpret_cast<FUNCTION_POINTER>(null_glVertex2iv)},
+  {"glGetTexEnvxvOES",reinterpret_cast<FUNCTION_POINTER>(null_glGetTexEnvxvOES)},
+  {"glUniformMatrix3dv",reinterpret_cast<FUNCTION_POINTER>(null_glUniformMatrix3dv)},
+  {"glGetVertexAttribLdvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetVertexAttribLdvEXT)},
+  {"glTexCoordP3uiv",reinterpret_cast<FUNCTION_POINTER>(null_glTexCoordP3uiv)},
+  {"glDeformationMap3dSGIX",reinterpret_cast<FUNCTION_POINTER>(null_glDeformationMap3dSGIX)},
+  {"glResumeTransformFeedback",reinterpret_cast<FUNCTION_POINTER>(null_glResumeTransformFeedback)},
+  {"glInsertEventMarkerEXT",reinterpret_cast<FUNCTION_POINTER>(null_glInsertEventMarkerEXT)},
+  {"glTessellationModeAMD",reinterpret_cast<FUNCTION_POINTER>(null_glTessellationModeAMD)},
+  {"glDrawCommandsAddressNV",reinterpret_cast<FUNCTION_POINTER>(null_glDrawCommandsAddressNV)},
+  {"glFogi",reinterpret_cast<FUNCTION_POINTER>(null_glFogi)},
+  {"glGetTexParameterxvOES",reinterpret_cast<FUNCTION_POINTER>(null_glGetTexParameterxvOES)},
+  {"glVertexPointer",reinterpret_cast<FUNCTION_POINTER>(null_glVertexPointer)},
+  {"glGetPerfMonitorCounterDataAMD",reinterpret_cast<FUNCTION_POINTER>(null_glGetPerfMonitorCounterDataAMD)},
+  {"glFogf",reinterpret_cast<FUNCTION_POINTER>(null_glFogf)},
+  {"glMultiTexCoord1d",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord1d)},
+  {"glMultiTexCoord1f",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord1f)},
+  {"glGetMultiTexParameterivEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetMultiTexParameterivEXT)},
+  {"glProgramUniformMatrix3x4fvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniformMatrix3x4fvEXT)},
+  {"glVertexAttribI2i",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribI2i)},
+  {"glMultiTexCoord1i",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord1i)},
+  {"glUniform1ui64vARB",reinterpret_cast<FUNCTION_POINTER>(null_glUniform1ui64vARB)},
+  {"glLoadProgramNV",reinterpret_cast<FUNCTION_POINTER>(null_glLoadProgramNV)},
+  {"glWriteMaskEXT",reinterpret_cast<FUNCTION_POINTER>(null_glWriteMaskEXT)},
+  {"glGetGraphicsResetStatus",reinterpret_cast<FUNCTION_POINTER>(null_glGetGraphicsResetStatus)},
+  {"glVertexAttrib1fv",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib1fv)},
+  {"glIsEnabled",reinterpret_cast<FUNCTION_POINTER>(null_glIsEnabled)},
+  {"glImageTransformParameterfvHP",reinterpret_cast<FUNCTION_POINTER>(null_glImageTransformParameterfvHP)},
+  {"glFramebufferTexture2D",reinterpret_cast<FUNCTION_POINTER>(null_glFramebufferTexture2D)},
+  {"glGetFragmentLightfvSGIX",reinterpret_cast<FUNCTION_POINTER>(null_glGetFragmentLightfvSGIX)},
+  {"glListParameterfSGIX",reinterpret_cast<FUNCTION_POINTER>(null_glListParameterfSGIX)},
+  {"glTexCoord3sv",reinterpret_cast<FUNCTION_POINTER>(null_glTexCoord3sv)},
+  {"glNamedFramebufferRenderbufferEXT",reinterpret_cast<FUNCTION_POINTER>(null_glNamedFramebufferRenderbufferEXT)},
+  {"glFragmentLightModelfSGIX",reinterpret_cast<FUNCTION_POINTER>(null_glFragmentLightModelfSGIX)},
+  {"glIndexPointerEXT",reinterpret_cast<FUNCTION_POINTER>(null_glIndexPointerEXT)},
+  {"glBlendEquationSeparateATI",reinterpret_cast<FUNCTION_POINTER>(null_glBlendEquationSeparateATI)},
+  {"glVertexArrayAttribIFormat",reinterpret_cast<FUNCTION_POINTER>(null_glVertexArrayAttribIFormat)},
+  {"glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN",reinterpret_cast<FUNCTION_POINTER>(null_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN)},
+  {"glReplacementCodeubvSUN",reinterpret_cast<FUNCTION_POINTER>(null_glReplacementCodeubvSUN)},
+  {"glGenFramebuffers",reinterpret_cast<FUNCTION_POINTER>(null_glGenFramebuffers)},
+  {"glPixelMapx",reinterpret_cast<FUNCTION_POINTER>(null_glPixelMapx)},
+  {"glTexSubImage3DEXT",reinterpret_cast<FUNCTION_POINTER>(null_glTexSubImage3DEXT)},
+  {"glGetAttachedShaders",reinterpret_cast<FUNCTION_POINTER>(null_glGetAttachedShaders)},
+  {"glGetPixelTexGenParameterfvSGIS",reinterpret_cast<FUNCTION_POINTER>(null_glGetPixelTexGenParameterfvSGIS)},
+  {"glReplacementCodeuiNormal3fVertex3fSUN",reinterpret_cast<FUNCTION_POINTER>(null_glReplacementCodeuiNormal3fVertex3fSUN)},
+  {"glGetDebugMessageLogAMD",reinterpret_cast<FUNCTION_POINTER>(null_glGetDebugMessageLogAMD)},
+  {"glVertexStream4sATI",reinterpret_cast<FUNCTION_POINTER>(null_glVertexStream4sATI)},
+  {"glVertexAttribs4dvNV",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribs4dvNV)},
+  {"glGetnMapdvARB",reinterpret_cast<FUNCTION_POINTER>(null_glGetnMapdvARB)},
+  {"glOrthofOES",reinterpret_cast<FUNCTION_POINTER>(null_glOrthofOES)},
+  {"glViewportArrayv",reinterpret_cast<FUNCTION_POINTER>(null_glViewportArrayv)},
+  {"glDrawElementArrayATI",reinterpret_cast<FUNCTION_POINTER>(null_glDrawElementArrayATI)},
+  {"glGetPathColorGenfvNV",reinterpret_cast<FUNCTION_POINTER>(null_glGetPathColorGenfvNV)},
+  {"glWindowPos3iMESA",reinterpret_cast<FUNCTION_POINTER>(null_glWindowPos3iMESA)},
+  {"glMultiTexCoord2s",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord2s)},
+  {"glVertex3dv",reinterpret_cast<FUNCTION_POINTER>(null_glVertex3dv)},
+  {"glVertexAttribI3uivEXT",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribI3uivEXT)},
+  {"glUniform3ui64ARB",reinterpret_cast<FUNCTION_POINTER>(null_glUniform3ui64ARB)},
+  {"glVertexAttrib2fvNV",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib2fvNV)},
+  {"glGetNamedBufferSubDataEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetNamedBufferSubDataEXT)},
+  {"glConvolutionFilter2D",reinterpret_cast<FUNCTION_POINTER>(null_glConvolutionFilter2D)},
+  {"glMemoryBarrierByRegion",reinterpret_cast<FUNCTION_POINTER>(null_glMemoryBarrierByRegion)},
+  {"glVertexArrayBindingDivisor",reinterpret_cast<FUNCTION_POINTER>(null_glVertexArrayBindingDivisor)},
+  {"glMatrixRotatedEXT",reinterpret_cast<FUNCTION_POINTER>(null_glMatrixRotatedEXT)},
+  {"glTexCoord2sv",reinterpret_cast<FUNCTION_POINTER>(null_glTexCoord2sv)},
+  {"glIsProgramNV",reinterpret_cast<FUNCTION_POINTER>(null_glIsProgramNV)},
+  {"glUniform2dv",reinterpret_cast<FUNCTION_POINTER>(null_glUniform2dv)},
+  {"glGetPixelMapuiv",reinterpret_cast<FUNCTION_POINTER>(null_glGetPixelMapuiv)},
+  {"glDepthBoundsEXT",reinterpret_cast<FUNCTION_POINTER>(null_glDepthBoundsEXT)},
+  {"glVertexAttrib4hvNV",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib4hvNV)},
+  {"glMultiTexParameteriEXT",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexParameteriEXT)},
+  {"glGetPointerv",reinterpret_cast<FUNCTION_POINTER>(null_glGetPointerv)},
+  {"glPathCommandsNV",reinterpret_cast<FUNCTION_POINTER>(null_glPathCommandsNV)},
+  {"glGetUniformfv",reinterpret_cast<FUNCTION_POINTER>(null_glGetUniformfv)},
+  {"glGetUniformuiv",reinterpret_cast<FUNCTION_POINTER>(null_glGetUniformuiv)},
+  {"glDebugMessageInsertAMD",reinterpret_cast<FUNCTION_POINTER>(null_glDebugMessageInsertAMD)},
+  {"glFrustum",reinterpret_cast<FUNCTION_POINTER>(null_glFrustum)},
+  {"glVertexAttribL1ui64vNV",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribL1ui64vNV)},
+  {"glClearColorxOES",reinterpret_cast<FUNCTION_POINTER>(null_glClearColorxOES)},
+  {"glProgramUniformMatrix3fv",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniformMatrix3fv)},
+  {"glSampleMaskIndexedNV",reinterpret_cast<FUNCTION_POINTER>(null_glSampleMaskIndexedNV)},
+  {"glCompileShaderIncludeARB",reinterpret_cast<FUNCTION_POINTER>(null_glCompileShaderIncludeARB)},
+  {"glGetArrayObjectfvATI",reinterpret_cast<FUNCTION_POINTER>(null_glGetArrayObjectfvATI)},
+  {"glVertexStream4svATI",reinterpret_cast<FUNCTION_POINTER>(null_glVertexStream4svATI)},
+  {"glMultiTexCoord4iARB",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord4iARB)},
+  {"glVariantfvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glVariantfvEXT)},
+  {"glMatrixLoadfEXT",reinterpret_cast<FUNCTION_POINTER>(null_glMatrixLoadfEXT)},
+  {"glLoadIdentityDeformationMapSGIX",reinterpret_cast<FUNCTION_POINTER>(null_glLoadIdentityDeformationMapSGIX)},
+  {"glGetRenderbufferParameteriv",reinterpret_cast<FUNCTION_POINTER>(null_glGetRenderbufferParameteriv)},
+  {"glProgramUniform3fEXT",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform3fEXT)},
+  {"glNamedRenderbufferStorage",reinterpret_cast<FUNCTION_POINTER>(null_glNamedRenderbufferStorage)},
+  {"glProgramPathFragmentInputGenNV",reinterpret_cast<FUNCTION_POINTER>(null_glProgramPathFragmentInputGenNV)},
+  {"glFogCoordPointerListIBM",reinterpret_cast<FUNCTION_POINTER>(null_glFogCoordPointerListIBM)},
+  {"glFenceSync",reinterpret_cast<FUNCTION_POINTER>(null_glFenceSync)},
+  {"glGetVertexAttribIivEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetVertexAttribIivEXT)},
+  {"glFramebufferDrawBuffersEXT",reinterpret_cast<FUNCTION_POINTER>(null_glFramebufferDrawBuffersEXT)},
+  {"glVertexAttribs4fvNV",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribs4fvNV)},
+  {"glPauseTransformFeedbackNV",reinterpret_cast<FUNCTION_POINTER>(null_glPauseTransformFeedbackNV)},
+  {"glGetQueryObjecti64vEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetQueryObjecti64vEXT)},
+  {"glVDPAUSurfaceAccessNV",reinterpret_cast<FUNCTION_POINTER>(null_glVDPAUSurfaceAccessNV)},
+  {"glValidateProgramPipeline",reinterpret_cast<FUNCTION_POINTER>(null_glValidateProgramPipeline)},
+  {"glTexPageCommitmentARB",reinterpret_cast<FUNCTION_POINTER>(null_glTexPageCommitmentARB)},
+  {"glWindowPos3dvARB",reinterpret_cast<FUNCTION_POINTER>(null_glWindowPos3dvARB)},
+  {"glStencilStrokePathInstancedNV",reinterpret_cast<FUNCTION_POINTER>(null_glStencilStrokePathInstancedNV)},
+  {"glFogfv",reinterpret_cast<FUNCTION_POINTER>(null_glFogfv)},
+  {"glGenQueriesARB",reinterpret_cast<FUNCTION_POINTER>(null_glGenQueriesARB)},
+  {"glProgramUniform2i64NV",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform2i64NV)},
+  {"glVertexP4ui",reinterpret_cast<FUNCTION_POINTER>(null_glVertexP4ui)},
+  {"glVertexStream1ivATI",reinterpret_cast<FUNCTION_POINTER>(null_glVertexStream1ivATI)},
+  {"glProgramEnvParameterI4iNV",reinterpret_cast<FUNCTION_POINTER>(null_glProgramEnvParameterI4iNV)},
+  {"glGenVertexArraysAPPLE",reinterpret_cast<FUNCTION_POINTER>(null_glGenVertexArraysAPPLE)},
+  {"glDrawTransformFeedbackInstanced",reinterpret_cast<FUNCTION_POINTER>(null_glDrawTransformFeedbackInstanced)},
+  {"glStencilThenCoverStrokePathNV",reinterpret_cast<FUNCTION_POINTER>(null_glStencilThenCoverStrokePathNV)},
+  {"glDeleteVertexArraysAPPLE",reinterpret_cast<FUNCTION_POINTER>(null_glDeleteVertexArraysAPPLE)},
+  {"glGetNamedBufferParameterui64vNV",reinterpret_cast<FUNCTION_POINTER>(null_glGetNamedBufferParameterui64vNV)},
+  {"glQueryMatrixxOES",reinterpret_cast<FUNCTION_POINTER>(null_glQueryMatrixxOES)},
+  {"glSecondaryColor3usv",reinterpret_cast<FUNCTION_POINTER>(null_glSecondaryColor3usv)},
+  {"glTranslatexOES",reinterpret_cast<FUNCTION_POINTER>(null_glTranslatexOES)},
+  {"glDrawTransformFeedback",reinterpret_cast<FUNCTION_POINTER>(null_glDrawTransformFeedback)},
+  {"glTexCoord2fColor4fNormal3fVertex3fvSUN",reinterpret_cast<FUNCTION_POINTER>(null_glTexCoord2fColor4fNormal3fVertex3fvSUN)},
+  {"glVDPAURegisterVideoSurfaceNV",reinterpret_cast<FUNCTION_POINTER>(null_glVDPAURegisterVideoSurfaceNV)},
+  {"glGetTexParameterIuiv",reinterpret_cast<FUNCTION_POINTER>(null_glGetTexParameterIuiv)},
+  {"glBindBufferBaseNV",reinterpret_cast<FUNCTION_POINTER>(null_glBindBufferBaseNV)},
+  {"glIndexPointer",reinterpret_cast<FUNCTION_POINTER>(null_glIndexPointer)},
+  {"glVertexAttrib4Nbv",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib4Nbv)},
+  {"glListParameteriSGIX",reinterpret_cast<FUNCTION_POINTER>(null_glListParameteriSGIX)},
+  {"glBlendColorxOES",reinterpret_cast<FUNCTION_POINTER>(null_glBlendColorxOES)},
+  {"glUniformui64vNV",reinterpret_cast<FUNCTION_POINTER>(null_glUniformui64vNV)},
+  {"glIsSync",reinterpret_cast<FUNCTION_POINTER>(null_glIsSync)},
+  {"glGetTextureParameterivEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetTextureParameterivEXT)},
+  {"glFogCoordhvNV",reinterpret_cast<FUNCTION_POINTER>(null_glFogCoordhvNV)},
+  {"glFramebufferTextureLayerEXT",reinterpret_cast<FUNCTION_POINTER>(null_glFramebufferTextureLayerEXT)},
+  {"glGetObjectPtrLabel",reinterpret_cast<FUNCTION_POINTER>(null_glGetObjectPtrLabel)},
+  {"glTextureParameteri",reinterpret_cast<FUNCTION_POINTER>(null_glTextureParameteri)},
+  {"glMultiTexCoord1fARB",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord1fARB)},
+  {"glUniformMatrix2x3dv",reinterpret_cast<FUNCTION_POINTER>(null_glUniformMatrix2x3dv)},
+  {"glFramebufferDrawBufferEXT",reinterpret_cast<FUNCTION_POINTER>(null_glFramebufferDrawBufferEXT)},
+  {"glCopyColorSubTable",reinterpret_cast<FUNCTION_POINTER>(null_glCopyColorSubTable)},
+  {"glVertexAttribL3d",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribL3d)},
+  {"glFragmentMaterialfvSGIX",reinterpret_cast<FUNCTION_POINTER>(null_glFragmentMaterialfvSGIX)},
+  {"glMatrixLoadTranspose3x3fNV",reinterpret_cast<FUNCTION_POINTER>(null_glMatrixLoadTranspose3x3fNV)},
+  {"glDeleteNamesAMD",reinterpret_cast<FUNCTION_POINTER>(null_glDeleteNamesAMD)},
+  {"glDrawRangeElementsEXT",reinterpret_cast<FUNCTION_POINTER>(null_glDrawRangeElementsEXT)},
+  {"glOrtho",reinterpret_cast<FUNCTION_POINTER>(null_glOrtho)},
+  {"glProgramUniform1dvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform1dvEXT)},
+  {"glColor4xOES",reinterpret_cast<FUNCTION_POINTER>(null_glColor4xOES)},
+  {"glTexImage4DSGIS",reinterpret_cast<FUNCTION_POINTER>(null_glTexImage4DSGIS)},
+  {"glProgramUniform1ui",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform1ui)},
+  {"glDeleteBuffersARB",reinterpret_cast<FUNCTION_POINTER>(null_glDeleteBuffersARB)},
+  {"glUnmapBufferARB",reinterpret_cast<FUNCTION_POINTER>(null_glUnmapBufferARB)},
+  {"glCopyTexImage2D",reinterpret_cast<FUNCTION_POINTER>(null_glCopyTexImage2D)},
+  {"glMaterialxOES",reinterpret_cast<FUNCTION_POINTER>(null_glMaterialxOES)},
+  {"glProgramUniformMatrix2x4fvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniformMatrix2x4fvEXT)},
+  {"glTestObjectAPPLE",reinterpret_cast<FUNCTION_POINTER>(null_glTestObjectAPPLE)},
+  {"glRenderbufferStorageEXT",reinterpret_cast<FUNCTION_POINTER>(null_glRenderbufferStorageEXT)},
+  {"glVertexAttribL1ui64ARB",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribL1ui64ARB)},
+  {"glEndFragmentShaderATI",reinterpret_cast<FUNCTION_POINTER>(null_glEndFragmentShaderATI)},
+  {"glPathParameterivNV",reinterpret_cast<FUNCTION_POINTER>(null_glPathParameterivNV)},
+  {"glUniform4uiv",reinterpret_cast<FUNCTION_POINTER>(null_glUniform4uiv)},
+  {"glFrameZoomSGIX",reinterpret_cast<FUNCTION_POINTER>(null_glFrameZoomSGIX)},
+  {"glSecondaryColor3fEXT",reinterpret_cast<FUNCTION_POINTER>(null_glSecondaryColor3fEXT)},
+  {"glVertexAttribL1dv",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribL1dv)},
+  {"glNormalStream3svATI",reinterpret_cast<FUNCTION_POINTER>(null_glNormalStream3svATI)},
+  {"glPathStencilFuncNV",reinterpret_cast<FUNCTION_POINTER>(null_glPathStencilFuncNV)},
+  {"glSetInvariantEXT",reinterpret_cast<FUNCTION_POINTER>(null_glSetInvariantEXT)},
+  {"glGetTexBumpParameterivATI",reinterpret_cast<FUNCTION_POINTER>(null_glGetTexBumpParameterivATI)},
+  {"glBlendEquationSeparateEXT",reinterpret_cast<FUNCTION_POINTER>(null_glBlendEquationSeparateEXT)},
+  {"glEndOcclusionQueryNV",reinterpret_cast<FUNCTION_POINTER>(null_glEndOcclusionQueryNV)},
+  {"glScissorArrayv",reinterpret_cast<FUNCTION_POINTER>(null_glScissorArrayv)},
+  {"glCallList",reinterpret_cast<FUNCTION_POINTER>(null_glCallList)},
+  {"glMapTexture2DINTEL",reinterpret_cast<FUNCTION_POINTER>(null_glMapTexture2DINTEL)},
+  {"glPixelTransferxOES",reinterpret_cast<FUNCTION_POINTER>(null_glPixelTransferxOES)},
+  {"glDeleteRenderbuffersEXT",reinterpret_cast<FUNCTION_POINTER>(null_glDeleteRenderbuffersEXT)},
+  {"glTexCoord4fColor4fNormal3fVertex4fSUN",reinterpret_cast<FUNCTION_POINTER>(null_glTexCoord4fColor4fNormal3fVertex4fSUN)},
+  {"glProgramUniformMatrix4dvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniformMatrix4dvEXT)},
+  {"glGetnColorTable",reinterpret_cast<FUNCTION_POINTER>(null_glGetnColorTable)},
+  {"glFramebufferTextureLayerARB",reinterpret_cast<FUNCTION_POINTER>(null_glFramebufferTextureLayerARB)},
+  {"glVertexAttribL2dvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribL2dvEXT)},
+  {"glGetCombinerStageParameterfvNV",reinterpret_cast<FUNCTION_POINTER>(null_glGetCombinerStageParameterfvNV)},
+  {"glMultiTexCoord1xvOES",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord1xvOES)},
+  {"glMapBuffer",reinterpret_cast<FUNCTION_POINTER>(null_glMapBuffer)},
+  {"glSecondaryColor3d",reinterpret_cast<FUNCTION_POINTER>(null_glSecondaryColor3d)},
+  {"glSecondaryColor3f",reinterpret_cast<FUNCTION_POINTER>(null_glSecondaryColor3f)},
+  {"glVertexAttribLFormat",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribLFormat)},
+  {"glElementPointerAPPLE",reinterpret_cast<FUNCTION_POINTER>(null_glElementPointerAPPLE)},
+  {"glVertexStream1fATI",reinterpret_cast<FUNCTION_POINTER>(null_glVertexStream1fATI)},
+  {"glCoverageModulationNV",reinterpret_cast<FUNCTION_POINTER>(null_glCoverageModulationNV)},
+  {"glSecondaryColor3i",reinterpret_cast<FUNCTION_POINTER>(null_glSecondaryColor3i)},
+  {"glDeleteSync",reinterpret_cast<FUNCTION_POINTER>(null_glDeleteSync)},
+  {"glGetProgramParameterfvNV",reinterpret_cast<FUNCTION_POINTER>(null_glGetProgramParameterfvNV)},
+  {"glMaxShaderCompilerThreadsARB",reinterpret_cast<FUNCTION_POINTER>(null_glMaxShaderCompilerThreadsARB)},
+  {"glUniformMatrix4x2dv",reinterpret_cast<FUNCTION_POINTER>(null_glUniformMatrix4x2dv)},
+  {"glVertexArrayVertexAttribLOffsetEXT",reinterpret_cast<FUNCTION_POINTER>(null_glVertexArrayVertexAttribLOffsetEXT)},
+  {"glSecondaryColor3s",reinterpret_cast<FUNCTION_POINTER>(null_glSecondaryColor3s)},
+  {"glIsImageHandleResidentNV",reinterpret_cast<FUNCTION_POINTER>(null_glIsImageHandleResidentNV)},
+  {"glUniform3iv",reinterpret_cast<FUNCTION_POINTER>(null_glUniform3iv)},
+  {"glVertexAttribL3i64vNV",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribL3i64vNV)},
+  {"glPolygonMode",reinterpret_cast<FUNCTION_POINTER>(null_glPolygonMode)},
+  {"glConvolutionFilter1DEXT",reinterpret_cast<FUNCTION_POINTER>(null_glConvolutionFilter1DEXT)},
+  {"glVertexAttrib1dvARB",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib1dvARB)},
+  {"glTextureSubImage2DEXT",reinterpret_cast<FUNCTION_POINTER>(null_glTextureSubImage2DEXT)},
+  {"glIsVertexArrayAPPLE",reinterpret_cast<FUNCTION_POINTER>(null_glIsVertexArrayAPPLE)},
+  {"glUseProgram",reinterpret_cast<FUNCTION_POINTER>(null_glUseProgram)},
+  {"glLineStipple",reinterpret_cast<FUNCTION_POINTER>(null_glLineStipple)},
+  {"glMultiTexCoord4fvARB",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord4fvARB)},
+  {"glVideoCaptureNV",reinterpret_cast<FUNCTION_POINTER>(null_glVideoCaptureNV)},
+  {"glVertexArrayVertexAttribLFormatEXT",reinterpret_cast<FUNCTION_POINTER>(null_glVertexArrayVertexAttribLFormatEXT)},
+  {"glUniform3fvARB",reinterpret_cast<FUNCTION_POINTER>(null_glUniform3fvARB)},
+  {"glProgramUniformMatrix3x2fvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniformMatrix3x2fvEXT)},
+  {"glCopyTextureSubImage3DEXT",reinterpret_cast<FUNCTION_POINTER>(null_glCopyTextureSubImage3DEXT)},
+  {"glMultiTexCoord2bvOES",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord2bvOES)},
+  {"glDeleteObjectARB",reinterpret_cast<FUNCTION_POINTER>(null_glDeleteObjectARB)},
+  {"glTextureLightEXT",reinterpret_cast<FUNCTION_POINTER>(null_glTextureLightEXT)},
+  {"glMultiTexCoord3dARB",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord3dARB)},
+  {"glNamedFramebufferTextureEXT",reinterpret_cast<FUNCTION_POINTER>(null_glNamedFramebufferTextureEXT)},
+  {"glTextureParameteriEXT",reinterpret_cast<FUNCTION_POINTER>(null_glTextureParameteriEXT)},
+  {"glEvalCoord2xvOES",reinterpret_cast<FUNCTION_POINTER>(null_glEvalCoord2xvOES)},
+  {"glBindVideoCaptureStreamBufferNV",reinterpret_cast<FUNCTION_POINTER>(null_glBindVideoCaptureStreamBufferNV)},
+  {"glTexImage2DMultisampleCoverageNV",reinterpret_cast<FUNCTION_POINTER>(null_glTexImage2DMultisampleCoverageNV)},
+  {"glGetAttribLocationARB",reinterpret_cast<FUNCTION_POINTER>(null_glGetAttribLocationARB)},
+  {"glDeleteShader",reinterpret_cast<FUNCTION_POINTER>(null_glDeleteShader)},
+  {"glVertexAttrib1fARB",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib1fARB)},
+  {"glTexCoord2fColor4ubVertex3fSUN",reinterpret_cast<FUNCTION_POINTER>(null_glTexCoord2fColor4ubVertex3fSUN)},
+  {"glTexCoord4fVertex4fSUN",reinterpret_cast<FUNCTION_POINTER>(null_glTexCoord4fVertex4fSUN)},
+  {"glGetMapdv",reinterpret_cast<FUNCTION_POINTER>(null_glGetMapdv)},
+  {"glMapParameterfvNV",reinterpret_cast<FUNCTION_POINTER>(null_glMapParameterfvNV)},
+  {"glTextureParameterIuiv",reinterpret_cast<FUNCTION_POINTER>(null_glTextureParameterIuiv)},
+  {"glTransformFeedbackAttribsNV",reinterpret_cast<FUNCTION_POINTER>(null_glTransformFeedbackAttribsNV)},
+  {"glFragmentLightfvSGIX",reinterpret_cast<FUNCTION_POINTER>(null_glFragmentLightfvSGIX)},
+  {"glWindowPos3sARB",reinterpret_cast<FUNCTION_POINTER>(null_glWindowPos3sARB)},
+  {"glGetConvolutionParameterfv",reinterpret_cast<FUNCTION_POINTER>(null_glGetConvolutionParameterfv)},
+  {"glCopyTexSubImage3D",reinterpret_cast<FUNCTION_POINTER>(null_glCopyTexSubImage3D)},
+  {"glVertexAttribI3i",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribI3i)},
+  {"glCreateShaderObjectARB",reinterpret_cast<FUNCTION_POINTER>(null_glCreateShaderObjectARB)},
+  {"glVertexAttribFormat",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribFormat)},
+  {"glGetProgramivARB",reinterpret_cast<FUNCTION_POINTER>(null_glGetProgramivARB)},
+  {"glVertexAttribI4usv",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribI4usv)},
+  {"glTexParameterf",reinterpret_cast<FUNCTION_POINTER>(null_glTexParameterf)},
+  {"glVertexAttribBinding",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribBinding)},
+  {"glGetHistogramParameteriv",reinterpret_cast<FUNCTION_POINTER>(null_glGetHistogramParameteriv)},
+  {"glTexParameteri",reinterpret_cast<FUNCTION_POINTER>(null_glTexParameteri)},
+  {"glGetShaderSource",reinterpret_cast<FUNCTION_POINTER>(null_glGetShaderSource)},
+  {"glVertexAttrib4s",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib4s)},
+  {"glVertexAttrib4dvNV",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib4dvNV)},
+  {"glVertexAttrib1dvNV",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib1dvNV)},
+  {"glPopName",reinterpret_cast<FUNCTION_POINTER>(null_glPopName)},
+  {"glTextureBufferEXT",reinterpret_cast<FUNCTION_POINTER>(null_glTextureBufferEXT)},
+  {"glGetMultiTexImageEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetMultiTexImageEXT)},
+  {"glGetPointerIndexedvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetPointerIndexedvEXT)},
+  {"glIsNameAMD",reinterpret_cast<FUNCTION_POINTER>(null_glIsNameAMD)},
+  {"glColor4ub",reinterpret_cast<FUNCTION_POINTER>(null_glColor4ub)},
+  {"glBufferParameteriAPPLE",reinterpret_cast<FUNCTION_POINTER>(null_glBufferParameteriAPPLE)},
+  {"glColor4ui",reinterpret_cast<FUNCTION_POINTER>(null_glColor4ui)},
+  {"glGetInternalformativ",reinterpret_cast<FUNCTION_POINTER>(null_glGetInternalformativ)},
+  {"glColor4us",reinterpret_cast<FUNCTION_POINTER>(null_glColor4us)},
+  {"glVertexAttribP1uiv",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribP1uiv)},
+  {"glLinkProgram",reinterpret_cast<FUNCTION_POINTER>(null_glLinkProgram)},
+  {"glTexCoord3s",reinterpret_cast<FUNCTION_POINTER>(null_glTexCoord3s)},
+  {"glTexCoord2dv",reinterpret_cast<FUNCTION_POINTER>(null_glTexCoord2dv)},
+  {"glGetObjectLabel",reinterpret_cast<FUNCTION_POINTER>(null_glGetObjectLabel)},
+  {"glVertexPointerEXT",reinterpret_cast<FUNCTION_POINTER>(null_glVertexPointerEXT)},
+  {"glDebugMessageCallbackARB",reinterpret_cast<FUNCTION_POINTER>(null_glDebugMessageCallbackARB)},
+  {"glGetString",reinterpret_cast<FUNCTION_POINTER>(null_glGetString)},
+  {"glGetPathParameterfvNV",reinterpret_cast<FUNCTION_POINTER>(null_glGetPathParameterfvNV)},
+  {"glLightxvOES",reinterpret_cast<FUNCTION_POINTER>(null_glLightxvOES)},
+  {"glEndQuery",reinterpret_cast<FUNCTION_POINTER>(null_glEndQuery)},
+  {"glSecondaryColor3uiv",reinterpret_cast<FUNCTION_POINTER>(null_glSecondaryColor3uiv)},
+  {"glPrioritizeTexturesxOES",reinterpret_cast<FUNCTION_POINTER>(null_glPrioritizeTexturesxOES)},
+  {"glEdgeFlagPointer",reinterpret_cast<FUNCTION_POINTER>(null_glEdgeFlagPointer)},
+  {"glFramebufferParameteri",reinterpret_cast<FUNCTION_POINTER>(null_glFramebufferParameteri)},
+  {"glTexCoord3hNV",reinterpret_cast<FUNCTION_POINTER>(null_glTexCoord3hNV)},
+  {"glMultiModeDrawElementsIBM",reinterpret_cast<FUNCTION_POINTER>(null_glMultiModeDrawElementsIBM)},
+  {"glCopyPixels",reinterpret_cast<FUNCTION_POINTER>(null_glCopyPixels)},
+  {"glVertexAttribI2ui",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribI2ui)},
+  {"glClampColorARB",reinterpret_cast<FUNCTION_POINTER>(null_glClampColorARB)},
+  {"glColorPointervINTEL",reinterpret_cast<FUNCTION_POINTER>(null_glColorPointervINTEL)},
+  {"glDeleteTextures",reinterpret_cast<FUNCTION_POINTER>(null_glDeleteTextures)},
+  {"glGetMinmaxParameterfvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetMinmaxParameterfvEXT)},
+  {"glWindowPos3sMESA",reinterpret_cast<FUNCTION_POINTER>(null_glWindowPos3sMESA)},
+  {"glVertexAttrib4f",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib4f)},
+  {"glNamedFramebufferParameteri",reinterpret_cast<FUNCTION_POINTER>(null_glNamedFramebufferParameteri)},
+  {"glTexCoord2fVertex3fvSUN",reinterpret_cast<FUNCTION_POINTER>(null_glTexCoord2fVertex3fvSUN)},
+  {"glReplacementCodeusSUN",reinterpret_cast<FUNCTION_POINTER>(null_glReplacementCodeusSUN)},
+  {"glGetNamedFramebufferParameteriv",reinterpret_cast<FUNCTION_POINTER>(null_glGetNamedFramebufferParameteriv)},
+  {"glVertexStream1fvATI",reinterpret_cast<FUNCTION_POINTER>(null_glVertexStream1fvATI)},
+  {"glCreateVertexArrays",reinterpret_cast<FUNCTION_POINTER>(null_glCreateVertexArrays)},
+  {"glBeginConditionalRender",reinterpret_cast<FUNCTION_POINTER>(null_glBeginConditionalRender)},
+  {"glConvolutionFilter1D",reinterpret_cast<FUNCTION_POINTER>(null_glConvolutionFilter1D)},
+  {"glMultiTexCoord3fARB",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord3fARB)},
+  {"glGetQueryObjectuivARB",reinterpret_cast<FUNCTION_POINTER>(null_glGetQueryObjectuivARB)},
+  {"glScalexOES",reinterpret_cast<FUNCTION_POINTER>(null_glScalexOES)},
+  {"glSamplerParameteri",reinterpret_cast<FUNCTION_POINTER>(null_glSamplerParameteri)},
+  {"glSamplerParameterf",reinterpret_cast<FUNCTION_POINTER>(null_glSamplerParameterf)},
+  {"glShaderOp1EXT",reinterpret_cast<FUNCTION_POINTER>(null_glShaderOp1EXT)},
+  {"glBeginVideoCaptureNV",reinterpret_cast<FUNCTION_POINTER>(null_glBeginVideoCaptureNV)},
+  {"glGetnHistogram",reinterpret_cast<FUNCTION_POINTER>(null_glGetnHistogram)},
+  {"glUniform1d",reinterpret_cast<FUNCTION_POINTER>(null_glUniform1d)},
+  {"glRenderMode",reinterpret_cast<FUNCTION_POINTER>(null_glRenderMode)},
+  {"glClearColorIiEXT",reinterpret_cast<FUNCTION_POINTER>(null_glClearColorIiEXT)},
+  {"glGetCompressedTexImage",reinterpret_cast<FUNCTION_POINTER>(null_glGetCompressedTexImage)},
+  {"glCompressedTextureImage1DEXT",reinterpret_cast<FUNCTION_POINTER>(null_glCompressedTextureImage1DEXT)},
+  {"glGetActiveUniformBlockiv",reinterpret_cast<FUNCTION_POINTER>(null_glGetActiveUniformBlockiv)},
+  {"glUniform1i",reinterpret_cast<FUNCTION_POINTER>(null_glUniform1i)},
+  {"glGetTexEnvfv",reinterpret_cast<FUNCTION_POINTER>(null_glGetTexEnvfv)},
+  {"glColorTableParameterivSGI",reinterpret_cast<FUNCTION_POINTER>(null_glColorTableParameterivSGI)},
+  {"glCullFace",reinterpret_cast<FUNCTION_POINTER>(null_glCullFace)},
+  {"glDeleteFencesAPPLE",reinterpret_cast<FUNCTION_POINTER>(null_glDeleteFencesAPPLE)},
+  {"glProgramUniform4i",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform4i)},
+  {"glUniformHandleui64ARB",reinterpret_cast<FUNCTION_POINTER>(null_glUniformHandleui64ARB)},
+  {"glProgramUniform4f",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform4f)},
+  {"glViewportIndexedf",reinterpret_cast<FUNCTION_POINTER>(null_glViewportIndexedf)},
+  {"glProgramUniform4d",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform4d)},
+  {"glTexCoord1xOES",reinterpret_cast<FUNCTION_POINTER>(null_glTexCoord1xOES)},
+  {"glVertexStream3ivATI",reinterpret_cast<FUNCTION_POINTER>(null_glVertexStream3ivATI)},
+  {"glGetStringi",reinterpret_cast<FUNCTION_POINTER>(null_glGetStringi)},
+  {"glEndQueryARB",reinterpret_cast<FUNCTION_POINTER>(null_glEndQueryARB)},
+  {"glVDPAUMapSurfacesNV",reinterpret_cast<FUNCTION_POINTER>(null_glVDPAUMapSurfacesNV)},
+  {"glVertex3i",reinterpret_cast<FUNCTION_POINTER>(null_glVertex3i)},
+  {"glVertexAttrib4uivARB",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib4uivARB)},
+  {"glResumeTransformFeedbackNV",reinterpret_cast<FUNCTION_POINTER>(null_glResumeTransformFeedbackNV)},
+  {"glAttachShader",reinterpret_cast<FUNCTION_POINTER>(null_glAttachShader)},
+  {"glColor4hNV",reinterpret_cast<FUNCTION_POINTER>(null_glColor4hNV)},
+  {"glGetFenceivNV",reinterpret_cast<FUNCTION_POINTER>(null_glGetFenceivNV)},
+  {"glTexCoord2fColor4ubVertex3fvSUN",reinterpret_cast<FUNCTION_POINTER>(null_glTexCoord2fColor4ubVertex3fvSUN)},
+  {"glGetColorTable",reinterpret_cast<FUNCTION_POINTER>(null_glGetColorTable)},
+  {"glFogCoordPointer",reinterpret_cast<FUNCTION_POINTER>(null_glFogCoordPointer)},
+  {"glTexStorageSparseAMD",reinterpret_cast<FUNCTION_POINTER>(null_glTexStorageSparseAMD)},
+  {"glUnmapNamedBuffer",reinterpret_cast<FUNCTION_POINTER>(null_glUnmapNamedBuffer)},
+  {"glTexCoord4bvOES",reinterpret_cast<FUNCTION_POINTER>(null_glTexCoord4bvOES)},
+  {"glVertexAttrib3fARB",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib3fARB)},
+  {"glRasterPos2xOES",reinterpret_cast<FUNCTION_POINTER>(null_glRasterPos2xOES)},
+  {"glColor4ubVertex2fvSUN",reinterpret_cast<FUNCTION_POINTER>(null_glColor4ubVertex2fvSUN)},
+  {"glSecondaryColor3dv",reinterpret_cast<FUNCTION_POINTER>(null_glSecondaryColor3dv)},
+  {"glVertexAttribI4sv",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribI4sv)},
+  {"glDrawTransformFeedbackStreamInstanced",reinterpret_cast<FUNCTION_POINTER>(null_glDrawTransformFeedbackStreamInstanced)},
+  {"glMultiTexCoord4ivARB",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord4ivARB)},
+  {"glSpriteParameterfSGIX",reinterpret_cast<FUNCTION_POINTER>(null_glSpriteParameterfSGIX)},
+  {"glSecondaryColor3sv",reinterpret_cast<FUNCTION_POINTER>(null_glSecondaryColor3sv)},
+  {"glBindVideoCaptureStreamTextureNV",reinterpret_cast<FUNCTION_POINTER>(null_glBindVideoCaptureStreamTextureNV)},
+  {"glTexParameterIuiv",reinterpret_cast<FUNCTION_POINTER>(null_glTexParameterIuiv)},
+  {"glFlushPixelDataRangeNV",reinterpret_cast<FUNCTION_POINTER>(null_glFlushPixelDataRangeNV)},
+  {"glWindowPos3fv",reinterpret_cast<FUNCTION_POINTER>(null_glWindowPos3fv)},
+  {"glVertexAttribLFormatNV",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribLFormatNV)},
+  {"glLightModelfv",reinterpret_cast<FUNCTION_POINTER>(null_glLightModelfv)},
+  {"glGetColorTableSGI",reinterpret_cast<FUNCTION_POINTER>(null_glGetColorTableSGI)},
+  {"glGetCompressedTexImageARB",reinterpret_cast<FUNCTION_POINTER>(null_glGetCompressedTexImageARB)},
+  {"glConvolutionParameteri",reinterpret_cast<FUNCTION_POINTER>(null_glConvolutionParameteri)},
+  {"glVertexWeighthNV",reinterpret_cast<FUNCTION_POINTER>(null_glVertexWeighthNV)},
+  {"glColorMaskIndexedEXT",reinterpret_cast<FUNCTION_POINTER>(null_glColorMaskIndexedEXT)},
+  {"glColorMaski",reinterpret_cast<FUNCTION_POINTER>(null_glColorMaski)},
+  {"glColorFragmentOp1ATI",reinterpret_cast<FUNCTION_POINTER>(null_glColorFragmentOp1ATI)},
+  {"glVertexAttribI4ubvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribI4ubvEXT)},
+  {"glVertexAttrib1dNV",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib1dNV)},
+  {"glUnmapObjectBufferATI",reinterpret_cast<FUNCTION_POINTER>(null_glUnmapObjectBufferATI)},
+  {"glNamedProgramLocalParameterI4uiEXT",reinterpret_cast<FUNCTION_POINTER>(null_glNamedProgramLocalParameterI4uiEXT)},
+  {"glProgramUniform1iEXT",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform1iEXT)},
+  {"glDeleteQueriesARB",reinterpret_cast<FUNCTION_POINTER>(null_glDeleteQueriesARB)},
+  {"glWindowPos3svARB",reinterpret_cast<FUNCTION_POINTER>(null_glWindowPos3svARB)},
+  {"glVertex4s",reinterpret_cast<FUNCTION_POINTER>(null_glVertex4s)},
+  {"glStringMarkerGREMEDY",reinterpret_cast<FUNCTION_POINTER>(null_glStringMarkerGREMEDY)},
+  {"glIsTransformFeedback",reinterpret_cast<FUNCTION_POINTER>(null_glIsTransformFeedback)},
+  {"glProgramUniformMatrix2x3dvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniformMatrix2x3dvEXT)},
+  {"glGetObjectLabelEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetObjectLabelEXT)},
+  {"glUniformHandleui64vNV",reinterpret_cast<FUNCTION_POINTER>(null_glUniformHandleui64vNV)},
+  {"glRotated",reinterpret_cast<FUNCTION_POINTER>(null_glRotated)},
+  {"glIsProgramPipeline",reinterpret_cast<FUNCTION_POINTER>(null_glIsProgramPipeline)},
+  {"glRotatef",reinterpret_cast<FUNCTION_POINTER>(null_glRotatef)},
+  {"glVertex4i",reinterpret_cast<FUNCTION_POINTER>(null_glVertex4i)},
+  {"glGetActiveSubroutineUniformName",reinterpret_cast<FUNCTION_POINTER>(null_glGetActiveSubroutineUniformName)},
+  {"glVertexAttrib4sNV",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib4sNV)},
+  {"glProgramLocalParameter4dvARB",reinterpret_cast<FUNCTION_POINTER>(null_glProgramLocalParameter4dvARB)},
+  {"glReplacementCodeubSUN",reinterpret_cast<FUNCTION_POINTER>(null_glReplacementCodeubSUN)},
+  {"glMultiDrawElementsIndirectBindlessNV",reinterpret_cast<FUNCTION_POINTER>(null_glMultiDrawElementsIndirectBindlessNV)},
+  {"glUniformMatrix3fv",reinterpret_cast<FUNCTION_POINTER>(null_glUniformMatrix3fv)},
+  {"glGetnMapfvARB",reinterpret_cast<FUNCTION_POINTER>(null_glGetnMapfvARB)},
+  {"glGetnUniformfv",reinterpret_cast<FUNCTION_POINTER>(null_glGetnUniformfv)},
+  {"glVertexAttribL2dv",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribL2dv)},
+  {"glVertexWeightPointerEXT",reinterpret_cast<FUNCTION_POINTER>(null_glVertexWeightPointerEXT)},
+  {"glTangent3sEXT",reinterpret_cast<FUNCTION_POINTER>(null_glTangent3sEXT)},
+  {"glSecondaryColorPointer",reinterpret_cast<FUNCTION_POINTER>(null_glSecondaryColorPointer)},
+  {"glAlphaFunc",reinterpret_cast<FUNCTION_POINTER>(null_glAlphaFunc)},
+  {"glGetNamedStringARB",reinterpret_cast<FUNCTION_POINTER>(null_glGetNamedStringARB)},
+  {"glTexCoord4d",reinterpret_cast<FUNCTION_POINTER>(null_glTexCoord4d)},
+  {"glBufferPageCommitmentARB",reinterpret_cast<FUNCTION_POINTER>(null_glBufferPageCommitmentARB)},
+  {"glProgramLocalParameters4fvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glProgramLocalParameters4fvEXT)},
+  {"glStencilFunc",reinterpret_cast<FUNCTION_POINTER>(null_glStencilFunc)},
+  {"glGetVertexAttribdvNV",reinterpret_cast<FUNCTION_POINTER>(null_glGetVertexAttribdvNV)},
+  {"glTexCoord3dv",reinterpret_cast<FUNCTION_POINTER>(null_glTexCoord3dv)},
+  {"glGetQueryBufferObjectiv",reinterpret_cast<FUNCTION_POINTER>(null_glGetQueryBufferObjectiv)},
+  {"glTexGenxOES",reinterpret_cast<FUNCTION_POINTER>(null_glTexGenxOES)},
+  {"glMultiTexCoord1fvARB",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord1fvARB)},
+  {"glLightEnviSGIX",reinterpret_cast<FUNCTION_POINTER>(null_glLightEnviSGIX)},
+  {"glGetProgramPipelineiv",reinterpret_cast<FUNCTION_POINTER>(null_glGetProgramPipelineiv)},
+  {"glVertexStream2ivATI",reinterpret_cast<FUNCTION_POINTER>(null_glVertexStream2ivATI)},
+  {"glGetColorTableEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetColorTableEXT)},
+  {"glGetShaderInfoLog",reinterpret_cast<FUNCTION_POINTER>(null_glGetShaderInfoLog)},
+  {"glGetOcclusionQueryuivNV",reinterpret_cast<FUNCTION_POINTER>(null_glGetOcclusionQueryuivNV)},
+  {"glInvalidateNamedFramebufferSubData",reinterpret_cast<FUNCTION_POINTER>(null_glInvalidateNamedFramebufferSubData)},
+  {"glVertexAttribL1i64NV",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribL1i64NV)},
+  {"glVDPAUInitNV",reinterpret_cast<FUNCTION_POINTER>(null_glVDPAUInitNV)},
+  {"glVertexAttrib1hvNV",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib1hvNV)},
+  {"glVertexAttribI4i",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribI4i)},
+  {"glRasterPos2iv",reinterpret_cast<FUNCTION_POINTER>(null_glRasterPos2iv)},
+  {"glGetIntegerui64i_vNV",reinterpret_cast<FUNCTION_POINTER>(null_glGetIntegerui64i_vNV)},
+  {"glUniformHandleui64NV",reinterpret_cast<FUNCTION_POINTER>(null_glUniformHandleui64NV)},
+  {"glWindowPos3ivMESA",reinterpret_cast<FUNCTION_POINTER>(null_glWindowPos3ivMESA)},
+  {"glBlendEquationSeparate",reinterpret_cast<FUNCTION_POINTER>(null_glBlendEquationSeparate)},
+  {"glDrawElementsInstancedARB",reinterpret_cast<FUNCTION_POINTER>(null_glDrawElementsInstancedARB)},
+  {"glGetSubroutineIndex",reinterpret_cast<FUNCTION_POINTER>(null_glGetSubroutineIndex)},
+  {"glVertexAttrib2sv",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib2sv)},
+  {"glSamplePatternSGIS",reinterpret_cast<FUNCTION_POINTER>(null_glSamplePatternSGIS)},
+  {"glEGLImageTargetRenderbufferStorageOES",reinterpret_cast<FUNCTION_POINTER>(null_glEGLImageTargetRenderbufferStorageOES)},
+  {"glPushAttrib",reinterpret_cast<FUNCTION_POINTER>(null_glPushAttrib)},
+  {"glVertex3hNV",reinterpret_cast<FUNCTION_POINTER>(null_glVertex3hNV)},
+  {"glRasterPos3xvOES",reinterpret_cast<FUNCTION_POINTER>(null_glRasterPos3xvOES)},
+  {"glPathParameterfNV",reinterpret_cast<FUNCTION_POINTER>(null_glPathParameterfNV)},
+  {"glGetUniformi64vNV",reinterpret_cast<FUNCTION_POINTER>(null_glGetUniformi64vNV)},
+  {"glLightiv",reinterpret_cast<FUNCTION_POINTER>(null_glLightiv)},
+  {"glMaterialxvOES",reinterpret_cast<FUNCTION_POINTER>(null_glMaterialxvOES)},
+  {"glNamedProgramLocalParameter4fEXT",reinterpret_cast<FUNCTION_POINTER>(null_glNamedProgramLocalParameter4fEXT)},
+  {"glVertexAttribL1dEXT",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribL1dEXT)},
+  {"glGetnUniformdvARB",reinterpret_cast<FUNCTION_POINTER>(null_glGetnUniformdvARB)},
+  {"glSecondaryColor3bEXT",reinterpret_cast<FUNCTION_POINTER>(null_glSecondaryColor3bEXT)},
+  {"glBeginPerfQueryINTEL",reinterpret_cast<FUNCTION_POINTER>(null_glBeginPerfQueryINTEL)},
+  {"glProgramUniform1uivEXT",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform1uivEXT)},
+  {"glImageTransformParameterivHP",reinterpret_cast<FUNCTION_POINTER>(null_glImageTransformParameterivHP)},
+  {"glDeleteBuffers",reinterpret_cast<FUNCTION_POINTER>(null_glDeleteBuffers)},
+  {"glBindProgramPipeline",reinterpret_cast<FUNCTION_POINTER>(null_glBindProgramPipeline)},
+  {"glScissor",reinterpret_cast<FUNCTION_POINTER>(null_glScissor)},
+  {"glProgramUniform4fv",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform4fv)},
+  {"glGetBooleanv",reinterpret_cast<FUNCTION_POINTER>(null_glGetBooleanv)},
+  {"glMaterialfv",reinterpret_cast<FUNCTION_POINTER>(null_glMaterialfv)},
+  {"glWindowPos4fvMESA",reinterpret_cast<FUNCTION_POINTER>(null_glWindowPos4fvMESA)},
+  {"glVertexAttribIPointerEXT",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribIPointerEXT)},
+  {"glProgramBufferParametersfvNV",reinterpret_cast<FUNCTION_POINTER>(null_glProgramBufferParametersfvNV)},
+  {"glAlphaFuncxOES",reinterpret_cast<FUNCTION_POINTER>(null_glAlphaFuncxOES)},
+  {"glMultiDrawArraysIndirectAMD",reinterpret_cast<FUNCTION_POINTER>(null_glMultiDrawArraysIndirectAMD)},
+  {"glNormalStream3ivATI",reinterpret_cast<FUNCTION_POINTER>(null_glNormalStream3ivATI)},
+  {"glTextureImage3DMultisampleNV",reinterpret_cast<FUNCTION_POINTER>(null_glTextureImage3DMultisampleNV)},
+  {"glProgramUniform4uivEXT",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform4uivEXT)},
+  {"glReplacementCodeusvSUN",reinterpret_cast<FUNCTION_POINTER>(null_glReplacementCodeusvSUN)},
+  {"glPollInstrumentsSGIX",reinterpret_cast<FUNCTION_POINTER>(null_glPollInstrumentsSGIX)},
+  {"glGetTextureLevelParameteriv",reinterpret_cast<FUNCTION_POINTER>(null_glGetTextureLevelParameteriv)},
+  {"glVertexAttribI2uiv",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribI2uiv)},
+  {"glMapControlPointsNV",reinterpret_cast<FUNCTION_POINTER>(null_glMapControlPointsNV)},
+  {"glColor4dv",reinterpret_cast<FUNCTION_POINTER>(null_glColor4dv)},
+  {"glInvalidateBufferSubData",reinterpret_cast<FUNCTION_POINTER>(null_glInvalidateBufferSubData)},
+  {"glMultiTexCoord1hNV",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord1hNV)},
+  {"glPointParameterfv",reinterpret_cast<FUNCTION_POINTER>(null_glPointParameterfv)},
+  {"glUniformMatrix2fvARB",reinterpret_cast<FUNCTION_POINTER>(null_glUniformMatrix2fvARB)},
+  {"glUniform2fv",reinterpret_cast<FUNCTION_POINTER>(null_glUniform2fv)},
+  {"glVertexPointerListIBM",reinterpret_cast<FUNCTION_POINTER>(null_glVertexPointerListIBM)},
+  {"glGetMultiTexGenfvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetMultiTexGenfvEXT)},
+  {"glGetMinmaxEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetMinmaxEXT)},
+  {"glIsFenceNV",reinterpret_cast<FUNCTION_POINTER>(null_glIsFenceNV)},
+  {"glMatrixFrustumEXT",reinterpret_cast<FUNCTION_POINTER>(null_glMatrixFrustumEXT)},
+  {"glDispatchComputeIndirect",reinterpret_cast<FUNCTION_POINTER>(null_glDispatchComputeIndirect)},
+  {"glMultiTexCoord4bOES",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord4bOES)},
+  {"glProgramEnvParameter4dARB",reinterpret_cast<FUNCTION_POINTER>(null_glProgramEnvParameter4dARB)},
+  {"glProgramUniform1uiEXT",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform1uiEXT)},
+  {"glBindBufferRange",reinterpret_cast<FUNCTION_POINTER>(null_glBindBufferRange)},
+  {"glNormal3iv",reinterpret_cast<FUNCTION_POINTER>(null_glNormal3iv)},
+  {"glVertexAttribL3dv",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribL3dv)},
+  {"glGetUniformdv",reinterpret_cast<FUNCTION_POINTER>(null_glGetUniformdv)},
+  {"glGetMultiTexLevelParameterfvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetMultiTexLevelParameterfvEXT)},
+  {"glFinalCombinerInputNV",reinterpret_cast<FUNCTION_POINTER>(null_glFinalCombinerInputNV)},
+  {"glCullParameterdvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glCullParameterdvEXT)},
+  {"glMultiTexCoord4s",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord4s)},
+  {"glMapVertexAttrib1fAPPLE",reinterpret_cast<FUNCTION_POINTER>(null_glMapVertexAttrib1fAPPLE)},
+  {"glConvolutionParameterfEXT",reinterpret_cast<FUNCTION_POINTER>(null_glConvolutionParameterfEXT)},
+  {"glTexCoord1iv",reinterpret_cast<FUNCTION_POINTER>(null_glTexCoord1iv)},
+  {"glProgramUniform3fvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform3fvEXT)},
+  {"glColor3uiv",reinterpret_cast<FUNCTION_POINTER>(null_glColor3uiv)},
+  {"glListBase",reinterpret_cast<FUNCTION_POINTER>(null_glListBase)},
+  {"glTexCoord2bOES",reinterpret_cast<FUNCTION_POINTER>(null_glTexCoord2bOES)},
+  {"glBindMaterialParameterEXT",reinterpret_cast<FUNCTION_POINTER>(null_glBindMaterialParameterEXT)},
+  {"glGlobalAlphaFactorubSUN",reinterpret_cast<FUNCTION_POINTER>(null_glGlobalAlphaFactorubSUN)},
+  {"glVertexAttribL1ui64NV",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribL1ui64NV)},
+  {"glPointParameterfSGIS",reinterpret_cast<FUNCTION_POINTER>(null_glPointParameterfSGIS)},
+  {"glGetImageTransformParameterivHP",reinterpret_cast<FUNCTION_POINTER>(null_glGetImageTransformParameterivHP)},
+  {"glColorSubTableEXT",reinterpret_cast<FUNCTION_POINTER>(null_glColorSubTableEXT)},
+  {"glPixelTexGenParameterfvSGIS",reinterpret_cast<FUNCTION_POINTER>(null_glPixelTexGenParameterfvSGIS)},
+  {"glClientWaitSync",reinterpret_cast<FUNCTION_POINTER>(null_glClientWaitSync)},
+  {"glQueryObjectParameteruiAMD",reinterpret_cast<FUNCTION_POINTER>(null_glQueryObjectParameteruiAMD)},
+  {"glVertexAttribs1fvNV",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribs1fvNV)},
+  {"glVertexAttrib4NusvARB",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib4NusvARB)},
+  {"glVariantPointerEXT",reinterpret_cast<FUNCTION_POINTER>(null_glVariantPointerEXT)},
+  {"glTextureBuffer",reinterpret_cast<FUNCTION_POINTER>(null_glTextureBuffer)},
+  {"glVertexAttribI1uiEXT",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribI1uiEXT)},
+  {"glInvalidateTexImage",reinterpret_cast<FUNCTION_POINTER>(null_glInvalidateTexImage)},
+  {"glProgramEnvParametersI4ivNV",reinterpret_cast<FUNCTION_POINTER>(null_glProgramEnvParametersI4ivNV)},
+  {"glPathGlyphIndexArrayNV",reinterpret_cast<FUNCTION_POINTER>(null_glPathGlyphIndexArrayNV)},
+  {"glCopyImageSubData",reinterpret_cast<FUNCTION_POINTER>(null_glCopyImageSubData)},
+  {"glGetUniformSubroutineuiv",reinterpret_cast<FUNCTION_POINTER>(null_glGetUniformSubroutineuiv)},
+  {"glBindVertexBuffer",reinterpret_cast<FUNCTION_POINTER>(null_glBindVertexBuffer)},
+  {"glMultiTexCoord1iARB",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord1iARB)},
+  {"glDebugMessageInsert",reinterpret_cast<FUNCTION_POINTER>(null_glDebugMessageInsert)},
+  {"glBeginVertexShaderEXT",reinterpret_cast<FUNCTION_POINTER>(null_glBeginVertexShaderEXT)},
+  {"glIsVariantEnabledEXT",reinterpret_cast<FUNCTION_POINTER>(null_glIsVariantEnabledEXT)},
+  {"glPassThroughxOES",reinterpret_cast<FUNCTION_POINTER>(null_glPassThroughxOES)},
+  {"glIsSampler",reinterpret_cast<FUNCTION_POINTER>(null_glIsSampler)},
+  {"glConservativeRasterParameterfNV",reinterpret_cast<FUNCTION_POINTER>(null_glConservativeRasterParameterfNV)},
+  {"glMultiTexGenivEXT",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexGenivEXT)},
+  {"glNamedFramebufferTexture2DEXT",reinterpret_cast<FUNCTION_POINTER>(null_glNamedFramebufferTexture2DEXT)},
+  {"glCopyTexSubImage1D",reinterpret_cast<FUNCTION_POINTER>(null_glCopyTexSubImage1D)},
+  {"glTexCoord1i",reinterpret_cast<FUNCTION_POINTER>(null_glTexCoord1i)},
+  {"glCheckFramebufferStatus",reinterpret_cast<FUNCTION_POINTER>(null_glCheckFramebufferStatus)},
+  {"glDrawElementArrayAPPLE",reinterpret_cast<FUNCTION_POINTER>(null_glDrawElementArrayAPPLE)},
+  {"glTexCoord1d",reinterpret_cast<FUNCTION_POINTER>(null_glTexCoord1d)},
+  {"glTexCoord1f",reinterpret_cast<FUNCTION_POINTER>(null_glTexCoord1f)},
+  {"glFragmentLightivSGIX",reinterpret_cast<FUNCTION_POINTER>(null_glFragmentLightivSGIX)},
+  {"glBindImageTexture",reinterpret_cast<FUNCTION_POINTER>(null_glBindImageTexture)},
+  {"glTransformFeedbackVaryings",reinterpret_cast<FUNCTION_POINTER>(null_glTransformFeedbackVaryings)},
+  {"glDrawRangeElements",reinterpret_cast<FUNCTION_POINTER>(null_glDrawRangeElements)},
+  {"glTexCoord1s",reinterpret_cast<FUNCTION_POINTER>(null_glTexCoord1s)},
+  {"glBindBufferBase",reinterpret_cast<FUNCTION_POINTER>(null_glBindBufferBase)},
+  {"glColor3bv",reinterpret_cast<FUNCTION_POINTER>(null_glColor3bv)},
+  {"glSyncTextureINTEL",reinterpret_cast<FUNCTION_POINTER>(null_glSyncTextureINTEL)},
+  {"glCreateSamplers",reinterpret_cast<FUNCTION_POINTER>(null_glCreateSamplers)},
+  {"glCombinerParameterfNV",reinterpret_cast<FUNCTION_POINTER>(null_glCombinerParameterfNV)},
+  {"glGetArrayObjectivATI",reinterpret_cast<FUNCTION_POINTER>(null_glGetArrayObjectivATI)},
+  {"glMultiDrawArrays",reinterpret_cast<FUNCTION_POINTER>(null_glMultiDrawArrays)},
+  {"glSampleMapATI",reinterpret_cast<FUNCTION_POINTER>(null_glSampleMapATI)},
+  {"glProgramUniform2i64ARB",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform2i64ARB)},
+  {"glBinormal3ivEXT",reinterpret_cast<FUNCTION_POINTER>(null_glBinormal3ivEXT)},
+  {"glMultiDrawArraysIndirectCountARB",reinterpret_cast<FUNCTION_POINTER>(null_glMultiDrawArraysIndirectCountARB)},
+  {"glUniformBufferEXT",reinterpret_cast<FUNCTION_POINTER>(null_glUniformBufferEXT)},
+  {"glWindowPos2ivMESA",reinterpret_cast<FUNCTION_POINTER>(null_glWindowPos2ivMESA)},
+  {"glTexCoordP4ui",reinterpret_cast<FUNCTION_POINTER>(null_glTexCoordP4ui)},
+  {"glMultiTexSubImage1DEXT",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexSubImage1DEXT)},
+  {"glProgramUniformMatrix2x3fvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniformMatrix2x3fvEXT)},
+  {"glBufferDataARB",reinterpret_cast<FUNCTION_POINTER>(null_glBufferDataARB)},
+  {"glVertexAttribIFormat",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribIFormat)},
+  {"glCreateFramebuffers",reinterpret_cast<FUNCTION_POINTER>(null_glCreateFramebuffers)},
+  {"glNormalStream3dvATI",reinterpret_cast<FUNCTION_POINTER>(null_glNormalStream3dvATI)},
+  {"glClearAccum",reinterpret_cast<FUNCTION_POINTER>(null_glClearAccum)},
+  {"glUniform3i64vNV",reinterpret_cast<FUNCTION_POINTER>(null_glUniform3i64vNV)},
+  {"glNormal3fVertex3fSUN",reinterpret_cast<FUNCTION_POINTER>(null_glNormal3fVertex3fSUN)},
+  {"glUniform2uivEXT",reinterpret_cast<FUNCTION_POINTER>(null_glUniform2uivEXT)},
+  {"glBeginQuery",reinterpret_cast<FUNCTION_POINTER>(null_glBeginQuery)},
+  {"glStencilThenCoverStrokePathInstancedNV",reinterpret_cast<FUNCTION_POINTER>(null_glStencilThenCoverStrokePathInstancedNV)},
+  {"glBindBuffer",reinterpret_cast<FUNCTION_POINTER>(null_glBindBuffer)},
+  {"glMap2d",reinterpret_cast<FUNCTION_POINTER>(null_glMap2d)},
+  {"glMap2f",reinterpret_cast<FUNCTION_POINTER>(null_glMap2f)},
+  {"glMakeImageHandleResidentNV",reinterpret_cast<FUNCTION_POINTER>(null_glMakeImageHandleResidentNV)},
+  {"glUniformMatrix2x4fv",reinterpret_cast<FUNCTION_POINTER>(null_glUniformMatrix2x4fv)},
+  {"glGetMultiTexParameterfvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetMultiTexParameterfvEXT)},
+  {"glDepthRangeIndexed",reinterpret_cast<FUNCTION_POINTER>(null_glDepthRangeIndexed)},
+  {"glMultiTexCoord1s",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord1s)},
+  {"glMatrixScalefEXT",reinterpret_cast<FUNCTION_POINTER>(null_glMatrixScalefEXT)},
+  {"glGetError",reinterpret_cast<FUNCTION_POINTER>(null_glGetError)},
+  {"glGetTexEnviv",reinterpret_cast<FUNCTION_POINTER>(null_glGetTexEnviv)},
+  {"glBindTextureUnitParameterEXT",reinterpret_cast<FUNCTION_POINTER>(null_glBindTextureUnitParameterEXT)},
+  {"glGetnUniformfvARB",reinterpret_cast<FUNCTION_POINTER>(null_glGetnUniformfvARB)},
+  {"glReplacementCodeuiNormal3fVertex3fvSUN",reinterpret_cast<FUNCTION_POINTER>(null_glReplacementCodeuiNormal3fVertex3fvSUN)},
+  {"glDeletePerfQueryINTEL",reinterpret_cast<FUNCTION_POINTER>(null_glDeletePerfQueryINTEL)},
+  {"glActiveVaryingNV",reinterpret_cast<FUNCTION_POINTER>(null_glActiveVaryingNV)},
+  {"glGetActiveUniformARB",reinterpret_cast<FUNCTION_POINTER>(null_glGetActiveUniformARB)},
+  {"glVertexAttribI3ivEXT",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribI3ivEXT)},
+  {"glEvalCoord1d",reinterpret_cast<FUNCTION_POINTER>(null_glEvalCoord1d)},
+  {"glNamedCopyBufferSubDataEXT",reinterpret_cast<FUNCTION_POINTER>(null_glNamedCopyBufferSubDataEXT)},
+  {"glEvalCoord1f",reinterpret_cast<FUNCTION_POINTER>(null_glEvalCoord1f)},
+  {"glPixelMapfv",reinterpret_cast<FUNCTION_POINTER>(null_glPixelMapfv)},
+  {"glVertexAttribI1ivEXT",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribI1ivEXT)},
+  {"glCreateSyncFromCLeventARB",reinterpret_cast<FUNCTION_POINTER>(null_glCreateSyncFromCLeventARB)},
+  {"glGetPixelMapusv",reinterpret_cast<FUNCTION_POINTER>(null_glGetPixelMapusv)},
+  {"glGetnColorTableARB",reinterpret_cast<FUNCTION_POINTER>(null_glGetnColorTableARB)},
+  {"glAccum",reinterpret_cast<FUNCTION_POINTER>(null_glAccum)},
+  {"glRasterPos3sv",reinterpret_cast<FUNCTION_POINTER>(null_glRasterPos3sv)},
+  {"glTexCoord2iv",reinterpret_cast<FUNCTION_POINTER>(null_glTexCoord2iv)},
+  {"glBlendFunciARB",reinterpret_cast<FUNCTION_POINTER>(null_glBlendFunciARB)},
+  {"glProgramUniform3i64vARB",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform3i64vARB)},
+  {"glGetFramebufferAttachmentParameteriv",reinterpret_cast<FUNCTION_POINTER>(null_glGetFramebufferAttachmentParameteriv)},
+  {"glProgramUniform4ui",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform4ui)},
+  {"glStencilMask",reinterpret_cast<FUNCTION_POINTER>(null_glStencilMask)},
+  {"glResetHistogramEXT",reinterpret_cast<FUNCTION_POINTER>(null_glResetHistogramEXT)},
+  {"glLightxOES",reinterpret_cast<FUNCTION_POINTER>(null_glLightxOES)},
+  {"glNamedBufferData",reinterpret_cast<FUNCTION_POINTER>(null_glNamedBufferData)},
+  {"glVertexStream3sATI",reinterpret_cast<FUNCTION_POINTER>(null_glVertexStream3sATI)},
+  {"glVertexAttrib3fvARB",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib3fvARB)},
+  {"glClearNamedBufferSubData",reinterpret_cast<FUNCTION_POINTER>(null_glClearNamedBufferSubData)},
+  {"glProgramUniformHandleui64ARB",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniformHandleui64ARB)},
+  {"glUniform3iARB",reinterpret_cast<FUNCTION_POINTER>(null_glUniform3iARB)},
+  {"glCreateProgramObjectARB",reinterpret_cast<FUNCTION_POINTER>(null_glCreateProgramObjectARB)},
+  {"glMultiTexCoord1dvARB",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord1dvARB)},
+  {"glGetObjectParameterfvARB",reinterpret_cast<FUNCTION_POINTER>(null_glGetObjectParameterfvARB)},
+  {"glRectsv",reinterpret_cast<FUNCTION_POINTER>(null_glRectsv)},
+  {"glMultiTexImage2DEXT",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexImage2DEXT)},
+  {"glProgramUniform1i64NV",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform1i64NV)},
+  {"glGetObjectBufferivATI",reinterpret_cast<FUNCTION_POINTER>(null_glGetObjectBufferivATI)},
+  {"glUniform4i64ARB",reinterpret_cast<FUNCTION_POINTER>(null_glUniform4i64ARB)},
+  {"glReplacementCodeuiColor4ubVertex3fvSUN",reinterpret_cast<FUNCTION_POINTER>(null_glReplacementCodeuiColor4ubVertex3fvSUN)},
+  {"glBlendFuncSeparateINGR",reinterpret_cast<FUNCTION_POINTER>(null_glBlendFuncSeparateINGR)},
+  {"glGetVideoCaptureStreamfvNV",reinterpret_cast<FUNCTION_POINTER>(null_glGetVideoCaptureStreamfvNV)},
+  {"glVertexAttrib2fARB",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib2fARB)},
+  {"glGetTexGeniv",reinterpret_cast<FUNCTION_POINTER>(null_glGetTexGeniv)},
+  {"glPixelStorei",reinterpret_cast<FUNCTION_POINTER>(null_glPixelStorei)},
+  {"glGetCompressedTextureSubImage",reinterpret_cast<FUNCTION_POINTER>(null_glGetCompressedTextureSubImage)},
+  {"glCopyImageSubDataNV",reinterpret_cast<FUNCTION_POINTER>(null_glCopyImageSubDataNV)},
+  {"glActiveShaderProgram",reinterpret_cast<FUNCTION_POINTER>(null_glActiveShaderProgram)},
+  {"glVertexStream1iATI",reinterpret_cast<FUNCTION_POINTER>(null_glVertexStream1iATI)},
+  {"glPatchParameterfv",reinterpret_cast<FUNCTION_POINTER>(null_glPatchParameterfv)},
+  {"glIsFramebufferEXT",reinterpret_cast<FUNCTION_POINTER>(null_glIsFramebufferEXT)},
+  {"glTextureStorage2D",reinterpret_cast<FUNCTION_POINTER>(null_glTextureStorage2D)},
+  {"glProgramUniform1ui64ARB",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform1ui64ARB)},
+  {"glTexBufferRange",reinterpret_cast<FUNCTION_POINTER>(null_glTexBufferRange)},
+  {"glGetPixelTexGenParameterivSGIS",reinterpret_cast<FUNCTION_POINTER>(null_glGetPixelTexGenParameterivSGIS)},
+  {"glTextureSubImage3DEXT",reinterpret_cast<FUNCTION_POINTER>(null_glTextureSubImage3DEXT)},
+  {"glClipControl",reinterpret_cast<FUNCTION_POINTER>(null_glClipControl)},
+  {"glGetProgramResourceiv",reinterpret_cast<FUNCTION_POINTER>(null_glGetProgramResourceiv)},
+  {"glMultiTexCoordP2uiv",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoordP2uiv)},
+  {"glVertexAttribI3ui",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribI3ui)},
+  {"glSampleMaskSGIS",reinterpret_cast<FUNCTION_POINTER>(null_glSampleMaskSGIS)},
+  {"glVertexAttrib4NivARB",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib4NivARB)},
+  {"glGlobalAlphaFactorfSUN",reinterpret_cast<FUNCTION_POINTER>(null_glGlobalAlphaFactorfSUN)},
+  {"glBlendEquationSeparateIndexedAMD",reinterpret_cast<FUNCTION_POINTER>(null_glBlendEquationSeparateIndexedAMD)},
+  {"glGetPerfCounterInfoINTEL",reinterpret_cast<FUNCTION_POINTER>(null_glGetPerfCounterInfoINTEL)},
+  {"glDeleteProgramsNV",reinterpret_cast<FUNCTION_POINTER>(null_glDeleteProgramsNV)},
+  {"glPixelZoomxOES",reinterpret_cast<FUNCTION_POINTER>(null_glPixelZoomxOES)},
+  {"glGetCombinerOutputParameterivNV",reinterpret_cast<FUNCTION_POINTER>(null_glGetCombinerOutputParameterivNV)},
+  {"glRasterPos2xvOES",reinterpret_cast<FUNCTION_POINTER>(null_glRasterPos2xvOES)},
+  {"glGetTexImage",reinterpret_cast<FUNCTION_POINTER>(null_glGetTexImage)},
+  {"glVertexArrayVertexBuffers",reinterpret_cast<FUNCTION_POINTER>(null_glVertexArrayVertexBuffers)},
+  {"glUniform1ui64NV",reinterpret_cast<FUNCTION_POINTER>(null_glUniform1ui64NV)},
+  {"glProgramParameteri",reinterpret_cast<FUNCTION_POINTER>(null_glProgramParameteri)},
+  {"glNormal3xOES",reinterpret_cast<FUNCTION_POINTER>(null_glNormal3xOES)},
+  {"glGetMapfv",reinterpret_cast<FUNCTION_POINTER>(null_glGetMapfv)},
+  {"glVertexStream2dvATI",reinterpret_cast<FUNCTION_POINTER>(null_glVertexStream2dvATI)},
+  {"glPathStencilDepthOffsetNV",reinterpret_cast<FUNCTION_POINTER>(null_glPathStencilDepthOffsetNV)},
+  {"glIsStateNV",reinterpret_cast<FUNCTION_POINTER>(null_glIsStateNV)},
+  {"glGetIntegerui64vNV",reinterpret_cast<FUNCTION_POINTER>(null_glGetIntegerui64vNV)},
+  {"glGetImageTransformParameterfvHP",reinterpret_cast<FUNCTION_POINTER>(null_glGetImageTransformParameterfvHP)},
+  {"glRasterPos2fv",reinterpret_cast<FUNCTION_POINTER>(null_glRasterPos2fv)},
+  {"glVertex3xOES",reinterpret_cast<FUNCTION_POINTER>(null_glVertex3xOES)},
+  {"glProgramUniform2dvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform2dvEXT)},
+  {"glWeightPointerARB",reinterpret_cast<FUNCTION_POINTER>(null_glWeightPointerARB)},
+  {"glFinishFenceNV",reinterpret_cast<FUNCTION_POINTER>(null_glFinishFenceNV)},
+  {"glDepthRangexOES",reinterpret_cast<FUNCTION_POINTER>(null_glDepthRangexOES)},
+  {"glEnableVertexArrayAttribEXT",reinterpret_cast<FUNCTION_POINTER>(null_glEnableVertexArrayAttribEXT)},
+  {"glProgramUniform2uivEXT",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform2uivEXT)},
+  {"glGetDoubleIndexedvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetDoubleIndexedvEXT)},
+  {"glWindowPos2fMESA",reinterpret_cast<FUNCTION_POINTER>(null_glWindowPos2fMESA)},
+  {"glSecondaryColor3b",reinterpret_cast<FUNCTION_POINTER>(null_glSecondaryColor3b)},
+  {"glCopyConvolutionFilter1DEXT",reinterpret_cast<FUNCTION_POINTER>(null_glCopyConvolutionFilter1DEXT)},
+  {"glWindowPos2sv",reinterpret_cast<FUNCTION_POINTER>(null_glWindowPos2sv)},
+  {"glBindFramebufferEXT",reinterpret_cast<FUNCTION_POINTER>(null_glBindFramebufferEXT)},
+  {"glCreateShader",reinterpret_cast<FUNCTION_POINTER>(null_glCreateShader)},
+  {"glGenPathsNV",reinterpret_cast<FUNCTION_POINTER>(null_glGenPathsNV)},
+  {"glGenRenderbuffers",reinterpret_cast<FUNCTION_POINTER>(null_glGenRenderbuffers)},
+  {"glCopyTexSubImage2D",reinterpret_cast<FUNCTION_POINTER>(null_glCopyTexSubImage2D)},
+  {"glVertexAttrib4ubvARB",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib4ubvARB)},
+  {"glDrawTextureNV",reinterpret_cast<FUNCTION_POINTER>(null_glDrawTextureNV)},
+  {"glVertexAttribs1svNV",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribs1svNV)},
+  {"glClearNamedBufferSubDataEXT",reinterpret_cast<FUNCTION_POINTER>(null_glClearNamedBufferSubDataEXT)},
+  {"glBlendFuncSeparate",reinterpret_cast<FUNCTION_POINTER>(null_glBlendFuncSeparate)},
+  {"glPointParameterfARB",reinterpret_cast<FUNCTION_POINTER>(null_glPointParameterfARB)},
+  {"glTexCoord2fv",reinterpret_cast<FUNCTION_POINTER>(null_glTexCoord2fv)},
+  {"glGetVariantFloatvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetVariantFloatvEXT)},
+  {"glVertexP2ui",reinterpret_cast<FUNCTION_POINTER>(null_glVertexP2ui)},
+  {"glWindowPos2dMESA",reinterpret_cast<FUNCTION_POINTER>(null_glWindowPos2dMESA)},
+  {"glTexCoord4fv",reinterpret_cast<FUNCTION_POINTER>(null_glTexCoord4fv)},
+  {"glBindFragDataLocationEXT",reinterpret_cast<FUNCTION_POINTER>(null_glBindFragDataLocationEXT)},
+  {"glCompressedTexSubImage1DARB",reinterpret_cast<FUNCTION_POINTER>(null_glCompressedTexSubImage1DARB)},
+  {"glGetTextureImageEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetTextureImageEXT)},
+  {"glFogCoordd",reinterpret_cast<FUNCTION_POINTER>(null_glFogCoordd)},
+  {"glPointSize",reinterpret_cast<FUNCTION_POINTER>(null_glPointSize)},
+  {"glBindTextureUnit",reinterpret_cast<FUNCTION_POINTER>(null_glBindTextureUnit)},
+  {"glProgramEnvParameterI4uiNV",reinterpret_cast<FUNCTION_POINTER>(null_glProgramEnvParameterI4uiNV)},
+  {"glGetProgramPipelineInfoLog",reinterpret_cast<FUNCTION_POINTER>(null_glGetProgramPipelineInfoLog)},
+  {"glProgramUniform4i64vARB",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform4i64vARB)},
+  {"glVertexAttrib4Nuiv",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib4Nuiv)},
+  {"glGetUniformfvARB",reinterpret_cast<FUNCTION_POINTER>(null_glGetUniformfvARB)},
+  {"glWaitSync",reinterpret_cast<FUNCTION_POINTER>(null_glWaitSync)},
+  {"glUniform3i",reinterpret_cast<FUNCTION_POINTER>(null_glUniform3i)},
+  {"glBlendEquationSeparatei",reinterpret_cast<FUNCTION_POINTER>(null_glBlendEquationSeparatei)},
+  {"glVertexAttrib2hvNV",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib2hvNV)},
+  {"glTextureParameterivEXT",reinterpret_cast<FUNCTION_POINTER>(null_glTextureParameterivEXT)},
+  {"glUniform3d",reinterpret_cast<FUNCTION_POINTER>(null_glUniform3d)},
+  {"glUniform3f",reinterpret_cast<FUNCTION_POINTER>(null_glUniform3f)},
+  {"glActiveProgramEXT",reinterpret_cast<FUNCTION_POINTER>(null_glActiveProgramEXT)},
+  {"glDeleteVertexArrays",reinterpret_cast<FUNCTION_POINTER>(null_glDeleteVertexArrays)},
+  {"glUniform3ui64vARB",reinterpret_cast<FUNCTION_POINTER>(null_glUniform3ui64vARB)},
+  {"glProgramUniform1ui64vARB",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform1ui64vARB)},
+  {"glTextureParameterfEXT",reinterpret_cast<FUNCTION_POINTER>(null_glTextureParameterfEXT)},
+  {"glSetFragmentShaderConstantATI",reinterpret_cast<FUNCTION_POINTER>(null_glSetFragmentShaderConstantATI)},
+  {"glColorSubTable",reinterpret_cast<FUNCTION_POINTER>(null_glColorSubTable)},
+  {"glReplacementCodeuiSUN",reinterpret_cast<FUNCTION_POINTER>(null_glReplacementCodeuiSUN)},
+  {"glStateCaptureNV",reinterpret_cast<FUNCTION_POINTER>(null_glStateCaptureNV)},
+  {"glBindAttribLocation",reinterpret_cast<FUNCTION_POINTER>(null_glBindAttribLocation)},
+  {"glWeightusvARB",reinterpret_cast<FUNCTION_POINTER>(null_glWeightusvARB)},
+  {"glGetFragDataIndex",reinterpret_cast<FUNCTION_POINTER>(null_glGetFragDataIndex)},
+  {"glMultiTexCoord2xOES",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord2xOES)},
+  {"glColor3sv",reinterpret_cast<FUNCTION_POINTER>(null_glColor3sv)},
+  {"glTexCoord2fVertex3fSUN",reinterpret_cast<FUNCTION_POINTER>(null_glTexCoord2fVertex3fSUN)},
+  {"glPolygonOffsetEXT",reinterpret_cast<FUNCTION_POINTER>(null_glPolygonOffsetEXT)},
+  {"glWeightPathsNV",reinterpret_cast<FUNCTION_POINTER>(null_glWeightPathsNV)},
+  {"glCombinerStageParameterfvNV",reinterpret_cast<FUNCTION_POINTER>(null_glCombinerStageParameterfvNV)},
+  {"glPointParameterfEXT",reinterpret_cast<FUNCTION_POINTER>(null_glPointParameterfEXT)},
+  {"glCopyTexImage1DEXT",reinterpret_cast<FUNCTION_POINTER>(null_glCopyTexImage1DEXT)},
+  {"glVertex4sv",reinterpret_cast<FUNCTION_POINTER>(null_glVertex4sv)},
+  {"glMatrixMultfEXT",reinterpret_cast<FUNCTION_POINTER>(null_glMatrixMultfEXT)},
+  {"glCompressedTextureSubImage3DEXT",reinterpret_cast<FUNCTION_POINTER>(null_glCompressedTextureSubImage3DEXT)},
+  {"glGetTexLevelParameterxvOES",reinterpret_cast<FUNCTION_POINTER>(null_glGetTexLevelParameterxvOES)},
+  {"glVertexAttribL3dvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribL3dvEXT)},
+  {"glMultiTexCoordP4ui",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoordP4ui)},
+  {"glGetTextureLevelParameterivEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetTextureLevelParameterivEXT)},
+  {"glAlphaFragmentOp2ATI",reinterpret_cast<FUNCTION_POINTER>(null_glAlphaFragmentOp2ATI)},
+  {"glDeleteFramebuffers",reinterpret_cast<FUNCTION_POINTER>(null_glDeleteFramebuffers)},
+  {"glDrawArrays",reinterpret_cast<FUNCTION_POINTER>(null_glDrawArrays)},
+  {"glGetTransformFeedbackiv",reinterpret_cast<FUNCTION_POINTER>(null_glGetTransformFeedbackiv)},
+  {"glGetnTexImageARB",reinterpret_cast<FUNCTION_POINTER>(null_glGetnTexImageARB)},
+  {"glClear",reinterpret_cast<FUNCTION_POINTER>(null_glClear)},
+  {"glVertexArrayParameteriAPPLE",reinterpret_cast<FUNCTION_POINTER>(null_glVertexArrayParameteriAPPLE)},
+  {"glMultiTexCoord2dvARB",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord2dvARB)},
+  {"glGetVideoCaptureStreamdvNV",reinterpret_cast<FUNCTION_POINTER>(null_glGetVideoCaptureStreamdvNV)},
+  {"glFragmentLightModelivSGIX",reinterpret_cast<FUNCTION_POINTER>(null_glFragmentLightModelivSGIX)},
+  {"glVertexAttribP2ui",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribP2ui)},
+  {"glMultiTexCoordPointerEXT",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoordPointerEXT)},
+  {"glProgramUniform3iEXT",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform3iEXT)},
+  {"glTranslatef",reinterpret_cast<FUNCTION_POINTER>(null_glTranslatef)},
+  {"glVertexAttrib4Nub",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib4Nub)},
+  {"glTranslated",reinterpret_cast<FUNCTION_POINTER>(null_glTranslated)},
+  {"glSamplerParameterIiv",reinterpret_cast<FUNCTION_POINTER>(null_glSamplerParameterIiv)},
+  {"glTexCoord4hNV",reinterpret_cast<FUNCTION_POINTER>(null_glTexCoord4hNV)},
+  {"glDrawElementsIndirect",reinterpret_cast<FUNCTION_POINTER>(null_glDrawElementsIndirect)},
+  {"glDeletePerfMonitorsAMD",reinterpret_cast<FUNCTION_POINTER>(null_glDeletePerfMonitorsAMD)},
+  {"glIsRenderbufferEXT",reinterpret_cast<FUNCTION_POINTER>(null_glIsRenderbufferEXT)},
+  {"glDrawCommandsNV",reinterpret_cast<FUNCTION_POINTER>(null_glDrawCommandsNV)},
+  {"glUniform3ivARB",reinterpret_cast<FUNCTION_POINTER>(null_glUniform3ivARB)},
+  {"glBufferSubData",reinterpret_cast<FUNCTION_POINTER>(null_glBufferSubData)},
+  {"glSecondaryColor3bv",reinterpret_cast<FUNCTION_POINTER>(null_glSecondaryColor3bv)},
+  {"glMatrixMultTransposedEXT",reinterpret_cast<FUNCTION_POINTER>(null_glMatrixMultTransposedEXT)},
+  {"glRequestResidentProgramsNV",reinterpret_cast<FUNCTION_POINTER>(null_glRequestResidentProgramsNV)},
+  {"glAlphaFragmentOp1ATI",reinterpret_cast<FUNCTION_POINTER>(null_glAlphaFragmentOp1ATI)},
+  {"glGetQueryObjecti64v",reinterpret_cast<FUNCTION_POINTER>(null_glGetQueryObjecti64v)},
+  {"glMatrixMult3x3fNV",reinterpret_cast<FUNCTION_POINTER>(null_glMatrixMult3x3fNV)},
+  {"glColorTableParameteriv",reinterpret_cast<FUNCTION_POINTER>(null_glColorTableParameteriv)},
+  {"glPathSubCommandsNV",reinterpret_cast<FUNCTION_POINTER>(null_glPathSubCommandsNV)},
+  {"glGetFinalCombinerInputParameterivNV",reinterpret_cast<FUNCTION_POINTER>(null_glGetFinalCombinerInputParameterivNV)},
+  {"glIsRenderbuffer",reinterpret_cast<FUNCTION_POINTER>(null_glIsRenderbuffer)},
+  {"glVertex3iv",reinterpret_cast<FUNCTION_POINTER>(null_glVertex3iv)},
+  {"glTexGenfv",reinterpret_cast<FUNCTION_POINTER>(null_glTexGenfv)},
+  {"glFrustumfOES",reinterpret_cast<FUNCTION_POINTER>(null_glFrustumfOES)},
+  {"glBindVertexBuffers",reinterpret_cast<FUNCTION_POINTER>(null_glBindVertexBuffers)},
+  {"glMateriali",reinterpret_cast<FUNCTION_POINTER>(null_glMateriali)},
+  {"glMultiTexCoord2svARB",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord2svARB)},
+  {"glDisableVertexAttribArray",reinterpret_cast<FUNCTION_POINTER>(null_glDisableVertexAttribArray)},
+  {"glWindowPos3ivARB",reinterpret_cast<FUNCTION_POINTER>(null_glWindowPos3ivARB)},
+  {"glTexCoordFormatNV",reinterpret_cast<FUNCTION_POINTER>(null_glTexCoordFormatNV)},
+  {"glBlitNamedFramebuffer",reinterpret_cast<FUNCTION_POINTER>(null_glBlitNamedFramebuffer)},
+  {"glMatrixLoadTransposefEXT",reinterpret_cast<FUNCTION_POINTER>(null_glMatrixLoadTransposefEXT)},
+  {"glMultiTexGenfEXT",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexGenfEXT)},
+  {"glShaderStorageBlockBinding",reinterpret_cast<FUNCTION_POINTER>(null_glShaderStorageBlockBinding)},
+  {"glMaterialf",reinterpret_cast<FUNCTION_POINTER>(null_glMaterialf)},
+  {"glReplacementCodeuiColor4fNormal3fVertex3fSUN",reinterpret_cast<FUNCTION_POINTER>(null_glReplacementCodeuiColor4fNormal3fVertex3fSUN)},
+  {"glCheckNamedFramebufferStatusEXT",reinterpret_cast<FUNCTION_POINTER>(null_glCheckNamedFramebufferStatusEXT)},
+  {"glVertexArrayVertexAttribFormatEXT",reinterpret_cast<FUNCTION_POINTER>(null_glVertexArrayVertexAttribFormatEXT)},
+  {"glVertex2hNV",reinterpret_cast<FUNCTION_POINTER>(null_glVertex2hNV)},
+  {"glDeleteVertexShaderEXT",reinterpret_cast<FUNCTION_POINTER>(null_glDeleteVertexShaderEXT)},
+  {"glTexImage3DEXT",reinterpret_cast<FUNCTION_POINTER>(null_glTexImage3DEXT)},
+  {"glProgramLocalParameterI4ivNV",reinterpret_cast<FUNCTION_POINTER>(null_glProgramLocalParameterI4ivNV)},
+  {"glGlobalAlphaFactoriSUN",reinterpret_cast<FUNCTION_POINTER>(null_glGlobalAlphaFactoriSUN)},
+  {"glTextureStorage1D",reinterpret_cast<FUNCTION_POINTER>(null_glTextureStorage1D)},
+  {"glBinormal3sEXT",reinterpret_cast<FUNCTION_POINTER>(null_glBinormal3sEXT)},
+  {"glGetProgramInterfaceiv",reinterpret_cast<FUNCTION_POINTER>(null_glGetProgramInterfaceiv)},
+  {"glMatrixIndexPointerARB",reinterpret_cast<FUNCTION_POINTER>(null_glMatrixIndexPointerARB)},
+  {"glTexCoordPointerEXT",reinterpret_cast<FUNCTION_POINTER>(null_glTexCoordPointerEXT)},
+  {"glMultiTexGeniEXT",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexGeniEXT)},
+  {"glVertexAttrib2fNV",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib2fNV)},
+  {"glNamedProgramStringEXT",reinterpret_cast<FUNCTION_POINTER>(null_glNamedProgramStringEXT)},
+  {"glMapNamedBuffer",reinterpret_cast<FUNCTION_POINTER>(null_glMapNamedBuffer)},
+  {"glGetMinmaxParameteriv",reinterpret_cast<FUNCTION_POINTER>(null_glGetMinmaxParameteriv)},
+  {"glGetnUniformdv",reinterpret_cast<FUNCTION_POINTER>(null_glGetnUniformdv)},
+  {"glEndConditionalRenderNVX",reinterpret_cast<FUNCTION_POINTER>(null_glEndConditionalRenderNVX)},
+  {"glBinormal3fEXT",reinterpret_cast<FUNCTION_POINTER>(null_glBinormal3fEXT)},
+  {"glNormalStream3iATI",reinterpret_cast<FUNCTION_POINTER>(null_glNormalStream3iATI)},
+  {"glProgramBufferParametersIivNV",reinterpret_cast<FUNCTION_POINTER>(null_glProgramBufferParametersIivNV)},
+  {"glMapGrid1xOES",reinterpret_cast<FUNCTION_POINTER>(null_glMapGrid1xOES)},
+  {"glGetVertexAttribPointervARB",reinterpret_cast<FUNCTION_POINTER>(null_glGetVertexAttribPointervARB)},
+  {"glFlushMappedNamedBufferRangeEXT",reinterpret_cast<FUNCTION_POINTER>(null_glFlushMappedNamedBufferRangeEXT)},
+  {"glGetVertexAttribIiv",reinterpret_cast<FUNCTION_POINTER>(null_glGetVertexAttribIiv)},
+  {"glVertexP4uiv",reinterpret_cast<FUNCTION_POINTER>(null_glVertexP4uiv)},
+  {"glUniformui64NV",reinterpret_cast<FUNCTION_POINTER>(null_glUniformui64NV)},
+  {"glColor4fv",reinterpret_cast<FUNCTION_POINTER>(null_glColor4fv)},
+  {"glTexParameterxvOES",reinterpret_cast<FUNCTION_POINTER>(null_glTexParameterxvOES)},
+  {"glPatchParameteri",reinterpret_cast<FUNCTION_POINTER>(null_glPatchParameteri)},
+  {"glMap1d",reinterpret_cast<FUNCTION_POINTER>(null_glMap1d)},
+  {"glGetTexFilterFuncSGIS",reinterpret_cast<FUNCTION_POINTER>(null_glGetTexFilterFuncSGIS)},
+  {"glGetTexParameteriv",reinterpret_cast<FUNCTION_POINTER>(null_glGetTexParameteriv)},
+  {"glVertexArrayVertexBindingDivisorEXT",reinterpret_cast<FUNCTION_POINTER>(null_glVertexArrayVertexBindingDivisorEXT)},
+  {"glMultiTexCoord3svARB",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord3svARB)},
+  {"glBindProgramNV",reinterpret_cast<FUNCTION_POINTER>(null_glBindProgramNV)},
+  {"glGetConvolutionParameteriv",reinterpret_cast<FUNCTION_POINTER>(null_glGetConvolutionParameteriv)},
+  {"glGetProgramLocalParameterfvARB",reinterpret_cast<FUNCTION_POINTER>(null_glGetProgramLocalParameterfvARB)},
+  {"glGenFragmentShadersATI",reinterpret_cast<FUNCTION_POINTER>(null_glGenFragmentShadersATI)},
+  {"glTexBumpParameterivATI",reinterpret_cast<FUNCTION_POINTER>(null_glTexBumpParameterivATI)},
+  {"glGetNamedFramebufferAttachmentParameteriv",reinterpret_cast<FUNCTION_POINTER>(null_glGetNamedFramebufferAttachmentParameteriv)},
+  {"glGetnSeparableFilter",reinterpret_cast<FUNCTION_POINTER>(null_glGetnSeparableFilter)},
+  {"glNormal3xvOES",reinterpret_cast<FUNCTION_POINTER>(null_glNormal3xvOES)},
+  {"glPassTexCoordATI",reinterpret_cast<FUNCTION_POINTER>(null_glPassTexCoordATI)},
+  {"glFramebufferTextureFaceARB",reinterpret_cast<FUNCTION_POINTER>(null_glFramebufferTextureFaceARB)},
+  {"glProgramUniform1dv",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform1dv)},
+  {"glTextureStorage2DEXT",reinterpret_cast<FUNCTION_POINTER>(null_glTextureStorage2DEXT)},
+  {"glVertexArrayFogCoordOffsetEXT",reinterpret_cast<FUNCTION_POINTER>(null_glVertexArrayFogCoordOffsetEXT)},
+  {"glDeleteNamedStringARB",reinterpret_cast<FUNCTION_POINTER>(null_glDeleteNamedStringARB)},
+  {"glGenOcclusionQueriesNV",reinterpret_cast<FUNCTION_POINTER>(null_glGenOcclusionQueriesNV)},
+  {"glLighti",reinterpret_cast<FUNCTION_POINTER>(null_glLighti)},
+  {"glTexImage1D",reinterpret_cast<FUNCTION_POINTER>(null_glTexImage1D)},
+  {"glLightf",reinterpret_cast<FUNCTION_POINTER>(null_glLightf)},
+  {"glClientAttribDefaultEXT",reinterpret_cast<FUNCTION_POINTER>(null_glClientAttribDefaultEXT)},
+  {"glVertexAttrib4bvARB",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib4bvARB)},
+  {"glVertexAttribIFormatNV",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribIFormatNV)},
+  {"glStencilFuncSeparate",reinterpret_cast<FUNCTION_POINTER>(null_glStencilFuncSeparate)},
+  {"glGetVertexAttribfvARB",reinterpret_cast<FUNCTION_POINTER>(null_glGetVertexAttribfvARB)},
+  {"glVertexAttrib2dNV",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib2dNV)},
+  {"glProgramUniform2iEXT",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform2iEXT)},
+  {"glClientActiveVertexStreamATI",reinterpret_cast<FUNCTION_POINTER>(null_glClientActiveVertexStreamATI)},
+  {"glRasterPos3xOES",reinterpret_cast<FUNCTION_POINTER>(null_glRasterPos3xOES)},
+  {"glGetMapParameterivNV",reinterpret_cast<FUNCTION_POINTER>(null_glGetMapParameterivNV)},
+  {"glSampleCoverage",reinterpret_cast<FUNCTION_POINTER>(null_glSampleCoverage)},
+  {"glClearDepthxOES",reinterpret_cast<FUNCTION_POINTER>(null_glClearDepthxOES)},
+  {"glTexCoord2fNormal3fVertex3fvSUN",reinterpret_cast<FUNCTION_POINTER>(null_glTexCoord2fNormal3fVertex3fvSUN)},
+  {"glGetFirstPerfQueryIdINTEL",reinterpret_cast<FUNCTION_POINTER>(null_glGetFirstPerfQueryIdINTEL)},
+  {"glUnmapNamedBufferEXT",reinterpret_cast<FUNCTION_POINTER>(null_glUnmapNamedBufferEXT)},
+  {"glGetTransformFeedbacki_v",reinterpret_cast<FUNCTION_POINTER>(null_glGetTransformFeedbacki_v)},
+  {"glUniform4fvARB",reinterpret_cast<FUNCTION_POINTER>(null_glUniform4fvARB)},
+  {"glRenderbufferStorageMultisampleCoverageNV",reinterpret_cast<FUNCTION_POINTER>(null_glRenderbufferStorageMultisampleCoverageNV)},
+  {"glGetFloati_vEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetFloati_vEXT)},
+  {"glBindAttribLocationARB",reinterpret_cast<FUNCTION_POINTER>(null_glBindAttribLocationARB)},
+  {"glBufferAddressRangeNV",reinterpret_cast<FUNCTION_POINTER>(null_glBufferAddressRangeNV)},
+  {"glGenProgramsARB",reinterpret_cast<FUNCTION_POINTER>(null_glGenProgramsARB)},
+  {"glMultiTexEnvivEXT",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexEnvivEXT)},
+  {"glSecondaryColor3uiEXT",reinterpret_cast<FUNCTION_POINTER>(null_glSecondaryColor3uiEXT)},
+  {"glCompressedTextureImage2DEXT",reinterpret_cast<FUNCTION_POINTER>(null_glCompressedTextureImage2DEXT)},
+  {"glUniform2i",reinterpret_cast<FUNCTION_POINTER>(null_glUniform2i)},
+  {"glCopyTexImage2DEXT",reinterpret_cast<FUNCTION_POINTER>(null_glCopyTexImage2DEXT)},
+  {"glUniform2d",reinterpret_cast<FUNCTION_POINTER>(null_glUniform2d)},
+  {"glVertexAttribL1d",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribL1d)},
+  {"glFramebufferTextureFaceEXT",reinterpret_cast<FUNCTION_POINTER>(null_glFramebufferTextureFaceEXT)},
+  {"glFramebufferTextureLayer",reinterpret_cast<FUNCTION_POINTER>(null_glFramebufferTextureLayer)},
+  {"glMultiTexCoord4bvOES",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord4bvOES)},
+  {"glGetVertexArrayPointeri_vEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetVertexArrayPointeri_vEXT)},
+  {"glNamedProgramLocalParameter4dEXT",reinterpret_cast<FUNCTION_POINTER>(null_glNamedProgramLocalParameter4dEXT)},
+  {"glBinormal3bEXT",reinterpret_cast<FUNCTION_POINTER>(null_glBinormal3bEXT)},
+  {"glConvolutionFilter2DEXT",reinterpret_cast<FUNCTION_POINTER>(null_glConvolutionFilter2DEXT)},
+  {"glProgramUniform2fv",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform2fv)},
+  {"glColor3fVertex3fSUN",reinterpret_cast<FUNCTION_POINTER>(null_glColor3fVertex3fSUN)},
+  {"glNormal3fVertex3fvSUN",reinterpret_cast<FUNCTION_POINTER>(null_glNormal3fVertex3fvSUN)},
+  {"glCopyMultiTexSubImage3DEXT",reinterpret_cast<FUNCTION_POINTER>(null_glCopyMultiTexSubImage3DEXT)},
+  {"glProgramLocalParameterI4iNV",reinterpret_cast<FUNCTION_POINTER>(null_glProgramLocalParameterI4iNV)},
+  {"glProgramUniformMatrix2x4dv",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniformMatrix2x4dv)},
+  {"glPathMemoryGlyphIndexArrayNV",reinterpret_cast<FUNCTION_POINTER>(null_glPathMemoryGlyphIndexArrayNV)},
+  {"glDrawArraysEXT",reinterpret_cast<FUNCTION_POINTER>(null_glDrawArraysEXT)},
+  {"glBlendEquationEXT",reinterpret_cast<FUNCTION_POINTER>(null_glBlendEquationEXT)},
+  {"glStencilOp",reinterpret_cast<FUNCTION_POINTER>(null_glStencilOp)},
+  {"glCopyTextureSubImage2DEXT",reinterpret_cast<FUNCTION_POINTER>(null_glCopyTextureSubImage2DEXT)},
+  {"glTexEnvf",reinterpret_cast<FUNCTION_POINTER>(null_glTexEnvf)},
+  {"glVertexAttrib2dvNV",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib2dvNV)},
+  {"glGenPerfMonitorsAMD",reinterpret_cast<FUNCTION_POINTER>(null_glGenPerfMonitorsAMD)},
+  {"glGetInteger64i_v",reinterpret_cast<FUNCTION_POINTER>(null_glGetInteger64i_v)},
+  {"glGetHistogramParameterfv",reinterpret_cast<FUNCTION_POINTER>(null_glGetHistogramParameterfv)},
+  {"glVertexFormatNV",reinterpret_cast<FUNCTION_POINTER>(null_glVertexFormatNV)},
+  {"glBlendFuncIndexedAMD",reinterpret_cast<FUNCTION_POINTER>(null_glBlendFuncIndexedAMD)},
+  {"glTexEnvi",reinterpret_cast<FUNCTION_POINTER>(null_glTexEnvi)},
+  {"glMultiTexCoord1iv",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord1iv)},
+  {"glIsEnabledi",reinterpret_cast<FUNCTION_POINTER>(null_glIsEnabledi)},
+  {"glVertexAttribL2ui64vNV",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribL2ui64vNV)},
+  {"glVertexAttribL4i64NV",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribL4i64NV)},
+  {"glMatrixTranslatedEXT",reinterpret_cast<FUNCTION_POINTER>(null_glMatrixTranslatedEXT)},
+  {"glMakeTextureHandleResidentARB",reinterpret_cast<FUNCTION_POINTER>(null_glMakeTextureHandleResidentARB)},
+  {"glMatrixMultdEXT",reinterpret_cast<FUNCTION_POINTER>(null_glMatrixMultdEXT)},
+  {"glBinormal3dvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glBinormal3dvEXT)},
+  {"glImportSyncEXT",reinterpret_cast<FUNCTION_POINTER>(null_glImportSyncEXT)},
+  {"glGetMapiv",reinterpret_cast<FUNCTION_POINTER>(null_glGetMapiv)},
+  {"glGetListParameterfvSGIX",reinterpret_cast<FUNCTION_POINTER>(null_glGetListParameterfvSGIX)},
+  {"glMultiTexCoord4sv",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord4sv)},
+  {"glPNTrianglesiATI",reinterpret_cast<FUNCTION_POINTER>(null_glPNTrianglesiATI)},
+  {"glBindVertexArrayAPPLE",reinterpret_cast<FUNCTION_POINTER>(null_glBindVertexArrayAPPLE)},
+  {"glObjectPtrLabel",reinterpret_cast<FUNCTION_POINTER>(null_glObjectPtrLabel)},
+  {"glGetDebugMessageLog",reinterpret_cast<FUNCTION_POINTER>(null_glGetDebugMessageLog)},
+  {"glTrackMatrixNV",reinterpret_cast<FUNCTION_POINTER>(null_glTrackMatrixNV)},
+  {"glBindFragDataLocation",reinterpret_cast<FUNCTION_POINTER>(null_glBindFragDataLocation)},
+  {"glTangent3ivEXT",reinterpret_cast<FUNCTION_POINTER>(null_glTangent3ivEXT)},
+  {"glSecondaryColor3ubv",reinterpret_cast<FUNCTION_POINTER>(null_glSecondaryColor3ubv)},
+  {"glMakeTextureHandleNonResidentNV",reinterpret_cast<FUNCTION_POINTER>(null_glMakeTextureHandleNonResidentNV)},
+  {"glVertexAttribs4ubvNV",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribs4ubvNV)},
+  {"glClipPlanexOES",reinterpret_cast<FUNCTION_POINTER>(null_glClipPlanexOES)},
+  {"glMultiTexCoord3iv",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord3iv)},
+  {"glGetnPolygonStippleARB",reinterpret_cast<FUNCTION_POINTER>(null_glGetnPolygonStippleARB)},
+  {"glUniform2i64vNV",reinterpret_cast<FUNCTION_POINTER>(null_glUniform2i64vNV)},
+  {"glLightModelf",reinterpret_cast<FUNCTION_POINTER>(null_glLightModelf)},
+  {"glMultiTexSubImage2DEXT",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexSubImage2DEXT)},
+  {"glReplacementCodeuiColor3fVertex3fSUN",reinterpret_cast<FUNCTION_POINTER>(null_glReplacementCodeuiColor3fVertex3fSUN)},
+  {"glTangent3dvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glTangent3dvEXT)},
+  {"glLightModeli",reinterpret_cast<FUNCTION_POINTER>(null_glLightModeli)},
+  {"glVertexWeighthvNV",reinterpret_cast<FUNCTION_POINTER>(null_glVertexWeighthvNV)},
+  {"glWindowPos3iv",reinterpret_cast<FUNCTION_POINTER>(null_glWindowPos3iv)},
+  {"glMultiTexCoordP1uiv",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoordP1uiv)},
+  {"glTransformPathNV",reinterpret_cast<FUNCTION_POINTER>(null_glTransformPathNV)},
+  {"glProgramNamedParameter4dNV",reinterpret_cast<FUNCTION_POINTER>(null_glProgramNamedParameter4dNV)},
+  {"glMultiDrawElementsIndirect",reinterpret_cast<FUNCTION_POINTER>(null_glMultiDrawElementsIndirect)},
+  {"glProgramUniform1dEXT",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform1dEXT)},
+  {"glCallLists",reinterpret_cast<FUNCTION_POINTER>(null_glCallLists)},
+  {"glNormal3hvNV",reinterpret_cast<FUNCTION_POINTER>(null_glNormal3hvNV)},
+  {"glGetCombinerOutputParameterfvNV",reinterpret_cast<FUNCTION_POINTER>(null_glGetCombinerOutputParameterfvNV)},
+  {"glVertexAttrib4sARB",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib4sARB)},
+  {"glTexCoord3i",reinterpret_cast<FUNCTION_POINTER>(null_glTexCoord3i)},
+  {"glVertexAttribI3uiv",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribI3uiv)},
+  {"glPushDebugGroup",reinterpret_cast<FUNCTION_POINTER>(null_glPushDebugGroup)},
+  {"glTexCoord3f",reinterpret_cast<FUNCTION_POINTER>(null_glTexCoord3f)},
+  {"glTexCoord3d",reinterpret_cast<FUNCTION_POINTER>(null_glTexCoord3d)},
+  {"glTexCoord2xOES",reinterpret_cast<FUNCTION_POINTER>(null_glTexCoord2xOES)},
+  {"glGetStageIndexNV",reinterpret_cast<FUNCTION_POINTER>(null_glGetStageIndexNV)},
+  {"glProgramUniform4i64vNV",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform4i64vNV)},
+  {"glGetNamedBufferPointervEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetNamedBufferPointervEXT)},
+  {"glTextureBarrierNV",reinterpret_cast<FUNCTION_POINTER>(null_glTextureBarrierNV)},
+  {"glColor4ubVertex3fvSUN",reinterpret_cast<FUNCTION_POINTER>(null_glColor4ubVertex3fvSUN)},
+  {"glGetCommandHeaderNV",reinterpret_cast<FUNCTION_POINTER>(null_glGetCommandHeaderNV)},
+  {"glGetPerfMonitorCounterInfoAMD",reinterpret_cast<FUNCTION_POINTER>(null_glGetPerfMonitorCounterInfoAMD)},
+  {"glVertexAttrib1svARB",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib1svARB)},
+  {"glCombinerParameteriNV",reinterpret_cast<FUNCTION_POINTER>(null_glCombinerParameteriNV)},
+  {"glMatrixMultTransposefEXT",reinterpret_cast<FUNCTION_POINTER>(null_glMatrixMultTransposefEXT)},
+  {"glDetailTexFuncSGIS",reinterpret_cast<FUNCTION_POINTER>(null_glDetailTexFuncSGIS)},
+  {"glAreTexturesResident",reinterpret_cast<FUNCTION_POINTER>(null_glAreTexturesResident)},
+  {"glProgramUniform2d",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform2d)},
+  {"glGetConvolutionParameterfvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetConvolutionParameterfvEXT)},
+  {"glIndexPointerListIBM",reinterpret_cast<FUNCTION_POINTER>(null_glIndexPointerListIBM)},
+  {"glVertexAttribI4iEXT",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribI4iEXT)},
+  {"glProgramUniform2f",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform2f)},
+  {"glRasterPos4sv",reinterpret_cast<FUNCTION_POINTER>(null_glRasterPos4sv)},
+  {"glColor4s",reinterpret_cast<FUNCTION_POINTER>(null_glColor4s)},
+  {"glColorFragmentOp3ATI",reinterpret_cast<FUNCTION_POINTER>(null_glColorFragmentOp3ATI)},
+  {"glResizeBuffersMESA",reinterpret_cast<FUNCTION_POINTER>(null_glResizeBuffersMESA)},
+  {"glGetMinmaxParameterfv",reinterpret_cast<FUNCTION_POINTER>(null_glGetMinmaxParameterfv)},
+  {"glClientActiveTextureARB",reinterpret_cast<FUNCTION_POINTER>(null_glClientActiveTextureARB)},
+  {"glBindVertexArray",reinterpret_cast<FUNCTION_POINTER>(null_glBindVertexArray)},
+  {"glColor4b",reinterpret_cast<FUNCTION_POINTER>(null_glColor4b)},
+  {"glColor4f",reinterpret_cast<FUNCTION_POINTER>(null_glColor4f)},
+  {"glColor4d",reinterpret_cast<FUNCTION_POINTER>(null_glColor4d)},
+  {"glColor4i",reinterpret_cast<FUNCTION_POINTER>(null_glColor4i)},
+  {"glEdgeFlagFormatNV",reinterpret_cast<FUNCTION_POINTER>(null_glEdgeFlagFormatNV)},
+  {"glNamedBufferSubData",reinterpret_cast<FUNCTION_POINTER>(null_glNamedBufferSubData)},
+  {"glDrawElementsInstanced",reinterpret_cast<FUNCTION_POINTER>(null_glDrawElementsInstanced)},
+  {"glGetMultiTexParameterIivEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetMultiTexParameterIivEXT)},
+  {"glVertex2dv",reinterpret_cast<FUNCTION_POINTER>(null_glVertex2dv)},
+  {"glDisableVertexArrayAttribEXT",reinterpret_cast<FUNCTION_POINTER>(null_glDisableVertexArrayAttribEXT)},
+  {"glObjectUnpurgeableAPPLE",reinterpret_cast<FUNCTION_POINTER>(null_glObjectUnpurgeableAPPLE)},
+  {"glVertexAttribs2dvNV",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribs2dvNV)},
+  {"glReplacementCodeuiTexCoord2fVertex3fSUN",reinterpret_cast<FUNCTION_POINTER>(null_glReplacementCodeuiTexCoord2fVertex3fSUN)},
+  {"glGetMapParameterfvNV",reinterpret_cast<FUNCTION_POINTER>(null_glGetMapParameterfvNV)},
+  {"glProgramUniform4ivEXT",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform4ivEXT)},
+  {"glProgramUniform3ui64vNV",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform3ui64vNV)},
+  {"glRectfv",reinterpret_cast<FUNCTION_POINTER>(null_glRectfv)},
+  {"glTexFilterFuncSGIS",reinterpret_cast<FUNCTION_POINTER>(null_glTexFilterFuncSGIS)},
+  {"glSpriteParameterfvSGIX",reinterpret_cast<FUNCTION_POINTER>(null_glSpriteParameterfvSGIX)},
+  {"glCopyMultiTexImage1DEXT",reinterpret_cast<FUNCTION_POINTER>(null_glCopyMultiTexImage1DEXT)},
+  {"glGetVertexAttribIuivEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetVertexAttribIuivEXT)},
+  {"glUniformMatrix2x4dv",reinterpret_cast<FUNCTION_POINTER>(null_glUniformMatrix2x4dv)},
+  {"glGetProgramResourceLocationIndex",reinterpret_cast<FUNCTION_POINTER>(null_glGetProgramResourceLocationIndex)},
+  {"glColor3hNV",reinterpret_cast<FUNCTION_POINTER>(null_glColor3hNV)},
+  {"glViewport",reinterpret_cast<FUNCTION_POINTER>(null_glViewport)},
+  {"glProgramNamedParameter4fNV",reinterpret_cast<FUNCTION_POINTER>(null_glProgramNamedParameter4fNV)},
+  {"glGetInvariantBooleanvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetInvariantBooleanvEXT)},
+  {"glTexStorage2DMultisample",reinterpret_cast<FUNCTION_POINTER>(null_glTexStorage2DMultisample)},
+  {"glPixelStorex",reinterpret_cast<FUNCTION_POINTER>(null_glPixelStorex)},
+  {"glVertexAttribL1dvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribL1dvEXT)},
+  {"glGetActiveSubroutineUniformiv",reinterpret_cast<FUNCTION_POINTER>(null_glGetActiveSubroutineUniformiv)},
+  {"glVertexAttribPointerARB",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribPointerARB)},
+  {"glCompressedTexSubImage2DARB",reinterpret_cast<FUNCTION_POINTER>(null_glCompressedTexSubImage2DARB)},
+  {"glVertex2hvNV",reinterpret_cast<FUNCTION_POINTER>(null_glVertex2hvNV)},
+  {"glTexBuffer",reinterpret_cast<FUNCTION_POINTER>(null_glTexBuffer)},
+  {"glArrayElement",reinterpret_cast<FUNCTION_POINTER>(null_glArrayElement)},
+  {"glValidateProgram",reinterpret_cast<FUNCTION_POINTER>(null_glValidateProgram)},
+  {"glPixelStoref",reinterpret_cast<FUNCTION_POINTER>(null_glPixelStoref)},
+  {"glWindowPos3dARB",reinterpret_cast<FUNCTION_POINTER>(null_glWindowPos3dARB)},
+  {"glEvalCoord1dv",reinterpret_cast<FUNCTION_POINTER>(null_glEvalCoord1dv)},
+  {"glVertexAttribs2fvNV",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribs2fvNV)},
+  {"glRecti",reinterpret_cast<FUNCTION_POINTER>(null_glRecti)},
+  {"glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN",reinterpret_cast<FUNCTION_POINTER>(null_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN)},
+  {"glTexCoord1bOES",reinterpret_cast<FUNCTION_POINTER>(null_glTexCoord1bOES)},
+  {"glProgramUniform2i64vARB",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform2i64vARB)},
+  {"glWindowPos2dARB",reinterpret_cast<FUNCTION_POINTER>(null_glWindowPos2dARB)},
+  {"glGetProgramParameterdvNV",reinterpret_cast<FUNCTION_POINTER>(null_glGetProgramParameterdvNV)},
+  {"glRectf",reinterpret_cast<FUNCTION_POINTER>(null_glRectf)},
+  {"glRectd",reinterpret_cast<FUNCTION_POINTER>(null_glRectd)},
+  {"glMap1xOES",reinterpret_cast<FUNCTION_POINTER>(null_glMap1xOES)},
+  {"glVertexAttrib3fvNV",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib3fvNV)},
+  {"glReferencePlaneSGIX",reinterpret_cast<FUNCTION_POINTER>(null_glReferencePlaneSGIX)},
+  {"glGetMultiTexGendvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetMultiTexGendvEXT)},
+  {"glGetCombinerInputParameterfvNV",reinterpret_cast<FUNCTION_POINTER>(null_glGetCombinerInputParameterfvNV)},
+  {"glGetTextureSamplerHandleARB",reinterpret_cast<FUNCTION_POINTER>(null_glGetTextureSamplerHandleARB)},
+  {"glBindTexture",reinterpret_cast<FUNCTION_POINTER>(null_glBindTexture)},
+  {"glRects",reinterpret_cast<FUNCTION_POINTER>(null_glRects)},
+  {"glGetActiveAttribARB",reinterpret_cast<FUNCTION_POINTER>(null_glGetActiveAttribARB)},
+  {"glHistogramEXT",reinterpret_cast<FUNCTION_POINTER>(null_glHistogramEXT)},
+  {"glGetTextureSamplerHandleNV",reinterpret_cast<FUNCTION_POINTER>(null_glGetTextureSamplerHandleNV)},
+  {"glDetachShader",reinterpret_cast<FUNCTION_POINTER>(null_glDetachShader)},
+  {"glFinishTextureSUNX",reinterpret_cast<FUNCTION_POINTER>(null_glFinishTextureSUNX)},
+  {"glUniformMatrix3x4dv",reinterpret_cast<FUNCTION_POINTER>(null_glUniformMatrix3x4dv)},
+  {"glVertexAttrib4fARB",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib4fARB)},
+  {"glGetPathColorGenivNV",reinterpret_cast<FUNCTION_POINTER>(null_glGetPathColorGenivNV)},
+  {"glGetProgramResourceLocation",reinterpret_cast<FUNCTION_POINTER>(null_glGetProgramResourceLocation)},
+  {"glVertexArrayAttribLFormat",reinterpret_cast<FUNCTION_POINTER>(null_glVertexArrayAttribLFormat)},
+  {"glGetTexLevelParameterfv",reinterpret_cast<FUNCTION_POINTER>(null_glGetTexLevelParameterfv)},
+  {"glVertexArrayVertexAttribOffsetEXT",reinterpret_cast<FUNCTION_POINTER>(null_glVertexArrayVertexAttribOffsetEXT)},
+  {"glIndexFormatNV",reinterpret_cast<FUNCTION_POINTER>(null_glIndexFormatNV)},
+  {"glMultiTexCoord3i",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord3i)},
+  {"glReplacementCodeuiVertex3fvSUN",reinterpret_cast<FUNCTION_POINTER>(null_glReplacementCodeuiVertex3fvSUN)},
+  {"glViewportIndexedfv",reinterpret_cast<FUNCTION_POINTER>(null_glViewportIndexedfv)},
+  {"glBindBuffersBase",reinterpret_cast<FUNCTION_POINTER>(null_glBindBuffersBase)},
+  {"glTexBumpParameterfvATI",reinterpret_cast<FUNCTION_POINTER>(null_glTexBumpParameterfvATI)},
+  {"glMatrixIndexuivARB",reinterpret_cast<FUNCTION_POINTER>(null_glMatrixIndexuivARB)},
+  {"glVertexAttrib1hNV",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib1hNV)},
+  {"glWindowPos3svMESA",reinterpret_cast<FUNCTION_POINTER>(null_glWindowPos3svMESA)},
+  {"glStencilOpSeparateATI",reinterpret_cast<FUNCTION_POINTER>(null_glStencilOpSeparateATI)},
+  {"glDrawElementsBaseVertex",reinterpret_cast<FUNCTION_POINTER>(null_glDrawElementsBaseVertex)},
+  {"glBlendEquationSeparateiARB",reinterpret_cast<FUNCTION_POINTER>(null_glBlendEquationSeparateiARB)},
+  {"glVertexAttrib1fNV",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib1fNV)},
+  {"glMapVertexAttrib2fAPPLE",reinterpret_cast<FUNCTION_POINTER>(null_glMapVertexAttrib2fAPPLE)},
+  {"glCompressedTextureSubImage1DEXT",reinterpret_cast<FUNCTION_POINTER>(null_glCompressedTextureSubImage1DEXT)},
+  {"glClearBufferSubData",reinterpret_cast<FUNCTION_POINTER>(null_glClearBufferSubData)},
+  {"glTexStorage1D",reinterpret_cast<FUNCTION_POINTER>(null_glTexStorage1D)},
+  {"glVertexAttribI3iEXT",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribI3iEXT)},
+  {"glMakeTextureHandleNonResidentARB",reinterpret_cast<FUNCTION_POINTER>(null_glMakeTextureHandleNonResidentARB)},
+  {"glMultiDrawElementArrayAPPLE",reinterpret_cast<FUNCTION_POINTER>(null_glMultiDrawElementArrayAPPLE)},
+  {"glVertexStream4dATI",reinterpret_cast<FUNCTION_POINTER>(null_glVertexStream4dATI)},
+  {"glProgramUniformMatrix2dvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniformMatrix2dvEXT)},
+  {"glVertexAttribs2hvNV",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribs2hvNV)},
+  {"glGetUniformiv",reinterpret_cast<FUNCTION_POINTER>(null_glGetUniformiv)},
+  {"glClipPlanefOES",reinterpret_cast<FUNCTION_POINTER>(null_glClipPlanefOES)},
+  {"glRenderbufferStorage",reinterpret_cast<FUNCTION_POINTER>(null_glRenderbufferStorage)},
+  {"glUniform4ui",reinterpret_cast<FUNCTION_POINTER>(null_glUniform4ui)},
+  {"glBindFramebuffer",reinterpret_cast<FUNCTION_POINTER>(null_glBindFramebuffer)},
+  {"glValidateProgramARB",reinterpret_cast<FUNCTION_POINTER>(null_glValidateProgramARB)},
+  {"glTexGenf",reinterpret_cast<FUNCTION_POINTER>(null_glTexGenf)},
+  {"glTexGend",reinterpret_cast<FUNCTION_POINTER>(null_glTexGend)},
+  {"glTexGeni",reinterpret_cast<FUNCTION_POINTER>(null_glTexGeni)},
+  {"glDeleteFramebuffersEXT",reinterpret_cast<FUNCTION_POINTER>(null_glDeleteFramebuffersEXT)},
+  {"glResetMinmaxEXT",reinterpret_cast<FUNCTION_POINTER>(null_glResetMinmaxEXT)},
+  {"glVertexAttrib1fvNV",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib1fvNV)},
+  {"glIsQueryARB",reinterpret_cast<FUNCTION_POINTER>(null_glIsQueryARB)},
+  {"glEnableVariantClientStateEXT",reinterpret_cast<FUNCTION_POINTER>(null_glEnableVariantClientStateEXT)},
+  {"glScissorIndexed",reinterpret_cast<FUNCTION_POINTER>(null_glScissorIndexed)},
+  {"glGetInvariantIntegervEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetInvariantIntegervEXT)},
+  {"glProgramLocalParameterI4uiNV",reinterpret_cast<FUNCTION_POINTER>(null_glProgramLocalParameterI4uiNV)},
+  {"glConvolutionParameterxvOES",reinterpret_cast<FUNCTION_POINTER>(null_glConvolutionParameterxvOES)},
+  {"glGenFramebuffersEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGenFramebuffersEXT)},
+  {"glVertexArrayColorOffsetEXT",reinterpret_cast<FUNCTION_POINTER>(null_glVertexArrayColorOffsetEXT)},
+  {"glMultiTexCoord3ivARB",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord3ivARB)},
+  {"glVertexWeightfEXT",reinterpret_cast<FUNCTION_POINTER>(null_glVertexWeightfEXT)},
+  {"glRasterPos4dv",reinterpret_cast<FUNCTION_POINTER>(null_glRasterPos4dv)},
+  {"glIsTextureHandleResidentARB",reinterpret_cast<FUNCTION_POINTER>(null_glIsTextureHandleResidentARB)},
+  {"glRasterPos2dv",reinterpret_cast<FUNCTION_POINTER>(null_glRasterPos2dv)},
+  {"glWindowPos4ivMESA",reinterpret_cast<FUNCTION_POINTER>(null_glWindowPos4ivMESA)},
+  {"glGetVariantPointervEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetVariantPointervEXT)},
+  {"glMapNamedBufferRangeEXT",reinterpret_cast<FUNCTION_POINTER>(null_glMapNamedBufferRangeEXT)},
+  {"glGetnUniformui64vARB",reinterpret_cast<FUNCTION_POINTER>(null_glGetnUniformui64vARB)},
+  {"glCreateShaderProgramv",reinterpret_cast<FUNCTION_POINTER>(null_glCreateShaderProgramv)},
+  {"glGetQueryObjectiv",reinterpret_cast<FUNCTION_POINTER>(null_glGetQueryObjectiv)},
+  {"glPNTrianglesfATI",reinterpret_cast<FUNCTION_POINTER>(null_glPNTrianglesfATI)},
+  {"glGlobalAlphaFactorusSUN",reinterpret_cast<FUNCTION_POINTER>(null_glGlobalAlphaFactorusSUN)},
+  {"glVertexAttrib3dvNV",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib3dvNV)},
+  {"glMultiTexCoord3sARB",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord3sARB)},
+  {"glGenerateMipmap",reinterpret_cast<FUNCTION_POINTER>(null_glGenerateMipmap)},
+  {"glCompressedTextureSubImage2D",reinterpret_cast<FUNCTION_POINTER>(null_glCompressedTextureSubImage2D)},
+  {"glNamedRenderbufferStorageMultisampleEXT",reinterpret_cast<FUNCTION_POINTER>(null_glNamedRenderbufferStorageMultisampleEXT)},
+  {"glPolygonOffsetClampEXT",reinterpret_cast<FUNCTION_POINTER>(null_glPolygonOffsetClampEXT)},
+  {"glTextureRangeAPPLE",reinterpret_cast<FUNCTION_POINTER>(null_glTextureRangeAPPLE)},
+  {"glBlendEquationIndexedAMD",reinterpret_cast<FUNCTION_POINTER>(null_glBlendEquationIndexedAMD)},
+  {"glTexCoord2d",reinterpret_cast<FUNCTION_POINTER>(null_glTexCoord2d)},
+  {"glPointParameteri",reinterpret_cast<FUNCTION_POINTER>(null_glPointParameteri)},
+  {"glTexCoord2f",reinterpret_cast<FUNCTION_POINTER>(null_glTexCoord2f)},
+  {"glColor4iv",reinterpret_cast<FUNCTION_POINTER>(null_glColor4iv)},
+  {"glMapNamedBufferRange",reinterpret_cast<FUNCTION_POINTER>(null_glMapNamedBufferRange)},
+  {"glUnmapBuffer",reinterpret_cast<FUNCTION_POINTER>(null_glUnmapBuffer)},
+  {"glSampleMaskEXT",reinterpret_cast<FUNCTION_POINTER>(null_glSampleMaskEXT)},
+  {"glTexCoord2i",reinterpret_cast<FUNCTION_POINTER>(null_glTexCoord2i)},
+  {"glTexCoord1xvOES",reinterpret_cast<FUNCTION_POINTER>(null_glTexCoord1xvOES)},
+  {"glVertexAttrib1sARB",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib1sARB)},
+  {"glGetVertexArrayiv",reinterpret_cast<FUNCTION_POINTER>(null_glGetVertexArrayiv)},
+  {"glProgramParameter4dvNV",reinterpret_cast<FUNCTION_POINTER>(null_glProgramParameter4dvNV)},
+  {"glTexCoord2s",reinterpret_cast<FUNCTION_POINTER>(null_glTexCoord2s)},
+  {"glTextureParameterIuivEXT",reinterpret_cast<FUNCTION_POINTER>(null_glTextureParameterIuivEXT)},
+  {"glGetColorTableParameterfvSGI",reinterpret_cast<FUNCTION_POINTER>(null_glGetColorTableParameterfvSGI)},
+  {"glTexCoord4dv",reinterpret_cast<FUNCTION_POINTER>(null_glTexCoord4dv)},
+  {"glVertexAttrib1svNV",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib1svNV)},
+  {"glNamedFramebufferTextureFaceEXT",reinterpret_cast<FUNCTION_POINTER>(null_glNamedFramebufferTextureFaceEXT)},
+  {"glProgramUniform2ui64vNV",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform2ui64vNV)},
+  {"glNormal3dv",reinterpret_cast<FUNCTION_POINTER>(null_glNormal3dv)},
+  {"glReleaseShaderCompiler",reinterpret_cast<FUNCTION_POINTER>(null_glReleaseShaderCompiler)},
+  {"glTexCoord3bvOES",reinterpret_cast<FUNCTION_POINTER>(null_glTexCoord3bvOES)},
+  {"glIsVertexAttribEnabledAPPLE",reinterpret_cast<FUNCTION_POINTER>(null_glIsVertexAttribEnabledAPPLE)},
+  {"glTexCoord1dv",reinterpret_cast<FUNCTION_POINTER>(null_glTexCoord1dv)},
+  {"glReadPixels",reinterpret_cast<FUNCTION_POINTER>(null_glReadPixels)},
+  {"glVertexAttribI3iv",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribI3iv)},
+  {"glSetFenceAPPLE",reinterpret_cast<FUNCTION_POINTER>(null_glSetFenceAPPLE)},
+  {"glWeightsvARB",reinterpret_cast<FUNCTION_POINTER>(null_glWeightsvARB)},
+  {"glShadeModel",reinterpret_cast<FUNCTION_POINTER>(null_glShadeModel)},
+  {"glMapGrid1d",reinterpret_cast<FUNCTION_POINTER>(null_glMapGrid1d)},
+  {"glGetHistogramParameterivEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetHistogramParameterivEXT)},
+  {"glConservativeRasterParameteriNV",reinterpret_cast<FUNCTION_POINTER>(null_glConservativeRasterParameteriNV)},
+  {"glClearNamedBufferData",reinterpret_cast<FUNCTION_POINTER>(null_glClearNamedBufferData)},
+  {"glClearDepthf",reinterpret_cast<FUNCTION_POINTER>(null_glClearDepthf)},
+  {"glCreatePerfQueryINTEL",reinterpret_cast<FUNCTION_POINTER>(null_glCreatePerfQueryINTEL)},
+  {"glFogCoordfEXT",reinterpret_cast<FUNCTION_POINTER>(null_glFogCoordfEXT)},
+  {"glVertexAttrib2dARB",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib2dARB)},
+  {"glMultiTexCoord4dARB",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord4dARB)},
+  {"glReadnPixelsARB",reinterpret_cast<FUNCTION_POINTER>(null_glReadnPixelsARB)},
+  {"glMultiTexBufferEXT",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexBufferEXT)},
+  {"glWindowPos4dvMESA",reinterpret_cast<FUNCTION_POINTER>(null_glWindowPos4dvMESA)},
+  {"glInvalidateNamedFramebufferData",reinterpret_cast<FUNCTION_POINTER>(null_glInvalidateNamedFramebufferData)},
+  {"glSecondaryColorPointerListIBM",reinterpret_cast<FUNCTION_POINTER>(null_glSecondaryColorPointerListIBM)},
+  {"glRectiv",reinterpret_cast<FUNCTION_POINTER>(null_glRectiv)},
+  {"glColorP4ui",reinterpret_cast<FUNCTION_POINTER>(null_glColorP4ui)},
+  {"glUseProgramStages",reinterpret_cast<FUNCTION_POINTER>(null_glUseProgramStages)},
+  {"glRasterPos3dv",reinterpret_cast<FUNCTION_POINTER>(null_glRasterPos3dv)},
+  {"glPathTexGenNV",reinterpret_cast<FUNCTION_POINTER>(null_glPathTexGenNV)},
+  {"glVertexBlendEnviATI",reinterpret_cast<FUNCTION_POINTER>(null_glVertexBlendEnviATI)},
+  {"glUniform3i64ARB",reinterpret_cast<FUNCTION_POINTER>(null_glUniform3i64ARB)},
+  {"glLoadMatrixf",reinterpret_cast<FUNCTION_POINTER>(null_glLoadMatrixf)},
+  {"glProgramUniform2dEXT",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform2dEXT)},
+  {"glVertexAttribI4iv",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribI4iv)},
+  {"glNamedFramebufferDrawBuffer",reinterpret_cast<FUNCTION_POINTER>(null_glNamedFramebufferDrawBuffer)},
+  {"glColor4ubv",reinterpret_cast<FUNCTION_POINTER>(null_glColor4ubv)},
+  {"glColor3hvNV",reinterpret_cast<FUNCTION_POINTER>(null_glColor3hvNV)},
+  {"glGetMapAttribParameterfvNV",reinterpret_cast<FUNCTION_POINTER>(null_glGetMapAttribParameterfvNV)},
+  {"glGetBufferSubData",reinterpret_cast<FUNCTION_POINTER>(null_glGetBufferSubData)},
+  {"glGetVertexAttribLdv",reinterpret_cast<FUNCTION_POINTER>(null_glGetVertexAttribLdv)},
+  {"glGetnUniformuiv",reinterpret_cast<FUNCTION_POINTER>(null_glGetnUniformuiv)},
+  {"glGetUniformui64vNV",reinterpret_cast<FUNCTION_POINTER>(null_glGetUniformui64vNV)},
+  {"glNamedRenderbufferStorageEXT",reinterpret_cast<FUNCTION_POINTER>(null_glNamedRenderbufferStorageEXT)},
+  {"glVertexAttrib3dNV",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib3dNV)},
+  {"glTextureStorage1DEXT",reinterpret_cast<FUNCTION_POINTER>(null_glTextureStorage1DEXT)},
+  {"glPixelTexGenParameteriSGIS",reinterpret_cast<FUNCTION_POINTER>(null_glPixelTexGenParameteriSGIS)},
+  {"glColorTableEXT",reinterpret_cast<FUNCTION_POINTER>(null_glColorTableEXT)},
+  {"glGenBuffers",reinterpret_cast<FUNCTION_POINTER>(null_glGenBuffers)},
+  {"glMultiTexCoord3xvOES",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord3xvOES)},
+  {"glExecuteProgramNV",reinterpret_cast<FUNCTION_POINTER>(null_glExecuteProgramNV)},
+  {"glVariantArrayObjectATI",reinterpret_cast<FUNCTION_POINTER>(null_glVariantArrayObjectATI)},
+  {"glColor3xvOES",reinterpret_cast<FUNCTION_POINTER>(null_glColor3xvOES)},
+  {"glGetnConvolutionFilterARB",reinterpret_cast<FUNCTION_POINTER>(null_glGetnConvolutionFilterARB)},
+  {"glNormalFormatNV",reinterpret_cast<FUNCTION_POINTER>(null_glNormalFormatNV)},
+  {"glGetInvariantFloatvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetInvariantFloatvEXT)},
+  {"glClearNamedFramebufferiv",reinterpret_cast<FUNCTION_POINTER>(null_glClearNamedFramebufferiv)},
+  {"glTexImage3D",reinterpret_cast<FUNCTION_POINTER>(null_glTexImage3D)},
+  {"glGenSamplers",reinterpret_cast<FUNCTION_POINTER>(null_glGenSamplers)},
+  {"glIsFramebuffer",reinterpret_cast<FUNCTION_POINTER>(null_glIsFramebuffer)},
+  {"glProgramUniform3dvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform3dvEXT)},
+  {"glGetVertexAttribfvNV",reinterpret_cast<FUNCTION_POINTER>(null_glGetVertexAttribfvNV)},
+  {"glDrawRangeElementArrayAPPLE",reinterpret_cast<FUNCTION_POINTER>(null_glDrawRangeElementArrayAPPLE)},
+  {"glUniform3i64NV",reinterpret_cast<FUNCTION_POINTER>(null_glUniform3i64NV)},
+  {"glMatrixPopEXT",reinterpret_cast<FUNCTION_POINTER>(null_glMatrixPopEXT)},
+  {"glVertexStream1sATI",reinterpret_cast<FUNCTION_POINTER>(null_glVertexStream1sATI)},
+  {"glGetnPixelMapuivARB",reinterpret_cast<FUNCTION_POINTER>(null_glGetnPixelMapuivARB)},
+  {"glMultiTexEnviEXT",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexEnviEXT)},
+  {"glVertexAttribI2iEXT",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribI2iEXT)},
+  {"glProgramParameter4fvNV",reinterpret_cast<FUNCTION_POINTER>(null_glProgramParameter4fvNV)},
+  {"glNamedFramebufferSampleLocationsfvNV",reinterpret_cast<FUNCTION_POINTER>(null_glNamedFramebufferSampleLocationsfvNV)},
+  {"glTexCoordP4uiv",reinterpret_cast<FUNCTION_POINTER>(null_glTexCoordP4uiv)},
+  {"glRectxvOES",reinterpret_cast<FUNCTION_POINTER>(null_glRectxvOES)},
+  {"glGetVariantIntegervEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetVariantIntegervEXT)},
+  {"glDeleteLists",reinterpret_cast<FUNCTION_POINTER>(null_glDeleteLists)},
+  {"glTexGendv",reinterpret_cast<FUNCTION_POINTER>(null_glTexGendv)},
+  {"glVertexP2uiv",reinterpret_cast<FUNCTION_POINTER>(null_glVertexP2uiv)},
+  {"glGetPerfMonitorGroupsAMD",reinterpret_cast<FUNCTION_POINTER>(null_glGetPerfMonitorGroupsAMD)},
+  {"glMultTransposeMatrixfARB",reinterpret_cast<FUNCTION_POINTER>(null_glMultTransposeMatrixfARB)},
+  {"glVertexAttribI2ivEXT",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribI2ivEXT)},
+  {"glReplacementCodeuiColor4fNormal3fVertex3fvSUN",reinterpret_cast<FUNCTION_POINTER>(null_glReplacementCodeuiColor4fNormal3fVertex3fvSUN)},
+  {"glDeleteStatesNV",reinterpret_cast<FUNCTION_POINTER>(null_glDeleteStatesNV)},
+  {"glGetBufferParameteri64v",reinterpret_cast<FUNCTION_POINTER>(null_glGetBufferParameteri64v)},
+  {"glProgramUniform4dv",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform4dv)},
+  {"glEdgeFlagPointerEXT",reinterpret_cast<FUNCTION_POINTER>(null_glEdgeFlagPointerEXT)},
+  {"glVideoCaptureStreamParameterivNV",reinterpret_cast<FUNCTION_POINTER>(null_glVideoCaptureStreamParameterivNV)},
+  {"glVertexStream4iATI",reinterpret_cast<FUNCTION_POINTER>(null_glVertexStream4iATI)},
+  {"glVDPAUFiniNV",reinterpret_cast<FUNCTION_POINTER>(null_glVDPAUFiniNV)},
+  {"glMakeBufferNonResidentNV",reinterpret_cast<FUNCTION_POINTER>(null_glMakeBufferNonResidentNV)},
+  {"glUniform1ui64ARB",reinterpret_cast<FUNCTION_POINTER>(null_glUniform1ui64ARB)},
+  {"glStencilStrokePathNV",reinterpret_cast<FUNCTION_POINTER>(null_glStencilStrokePathNV)},
+  {"glProgramUniform3uiv",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform3uiv)},
+  {"glVariantuivEXT",reinterpret_cast<FUNCTION_POINTER>(null_glVariantuivEXT)},
+  {"glCopyTexSubImage3DEXT",reinterpret_cast<FUNCTION_POINTER>(null_glCopyTexSubImage3DEXT)},
+  {"glSpriteParameteriSGIX",reinterpret_cast<FUNCTION_POINTER>(null_glSpriteParameteriSGIX)},
+  {"glMultiTexCoord1sARB",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord1sARB)},
+  {"glConvolutionParameterfv",reinterpret_cast<FUNCTION_POINTER>(null_glConvolutionParameterfv)},
+  {"glMakeTextureHandleResidentNV",reinterpret_cast<FUNCTION_POINTER>(null_glMakeTextureHandleResidentNV)},
+  {"glMultMatrixxOES",reinterpret_cast<FUNCTION_POINTER>(null_glMultMatrixxOES)},
+  {"glTextureNormalEXT",reinterpret_cast<FUNCTION_POINTER>(null_glTextureNormalEXT)},
+  {"glGetQueryivARB",reinterpret_cast<FUNCTION_POINTER>(null_glGetQueryivARB)},
+  {"glCompressedMultiTexImage3DEXT",reinterpret_cast<FUNCTION_POINTER>(null_glCompressedMultiTexImage3DEXT)},
+  {"glGetInstrumentsSGIX",reinterpret_cast<FUNCTION_POINTER>(null_glGetInstrumentsSGIX)},
+  {"glProgramUniformMatrix4x3fvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniformMatrix4x3fvEXT)},
+  {"glPointParameterf",reinterpret_cast<FUNCTION_POINTER>(null_glPointParameterf)},
+  {"glProgramUniform3dEXT",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform3dEXT)},
+  {"glMultiTexCoord2hNV",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord2hNV)},
+  {"glGetConvolutionFilterEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetConvolutionFilterEXT)},
+  {"glVertexAttrib2hNV",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib2hNV)},
+  {"glCurrentPaletteMatrixARB",reinterpret_cast<FUNCTION_POINTER>(null_glCurrentPaletteMatrixARB)},
+  {"glFogxvOES",reinterpret_cast<FUNCTION_POINTER>(null_glFogxvOES)},
+  {"glCreateRenderbuffers",reinterpret_cast<FUNCTION_POINTER>(null_glCreateRenderbuffers)},
+  {"glVertexAttrib4Nusv",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib4Nusv)},
+  {"glCombinerInputNV",reinterpret_cast<FUNCTION_POINTER>(null_glCombinerInputNV)},
+  {"glDepthFunc",reinterpret_cast<FUNCTION_POINTER>(null_glDepthFunc)},
+  {"glWindowPos4fMESA",reinterpret_cast<FUNCTION_POINTER>(null_glWindowPos4fMESA)},
+  {"glEnableClientStateIndexedEXT",reinterpret_cast<FUNCTION_POINTER>(null_glEnableClientStateIndexedEXT)},
+  {"glTexCoord4iv",reinterpret_cast<FUNCTION_POINTER>(null_glTexCoord4iv)},
+  {"glProgramUniform4i64ARB",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform4i64ARB)},
+  {"glBlendFunci",reinterpret_cast<FUNCTION_POINTER>(null_glBlendFunci)},
+  {"glResolveDepthValuesNV",reinterpret_cast<FUNCTION_POINTER>(null_glResolveDepthValuesNV)},
+  {"glTextureColorMaskSGIS",reinterpret_cast<FUNCTION_POINTER>(null_glTextureColorMaskSGIS)},
+  {"glCreateShaderProgramEXT",reinterpret_cast<FUNCTION_POINTER>(null_glCreateShaderProgramEXT)},
+  {"glBufferStorage",reinterpret_cast<FUNCTION_POINTER>(null_glBufferStorage)},
+  {"glMakeNamedBufferNonResidentNV",reinterpret_cast<FUNCTION_POINTER>(null_glMakeNamedBufferNonResidentNV)},
+  {"glRenderbufferStorageMultisampleEXT",reinterpret_cast<FUNCTION_POINTER>(null_glRenderbufferStorageMultisampleEXT)},
+  {"glGetFloati_v",reinterpret_cast<FUNCTION_POINTER>(null_glGetFloati_v)},
+  {"glUniform2ui64ARB",reinterpret_cast<FUNCTION_POINTER>(null_glUniform2ui64ARB)},
+  {"glVertex3fv",reinterpret_cast<FUNCTION_POINTER>(null_glVertex3fv)},
+  {"glGetUniformLocation",reinterpret_cast<FUNCTION_POINTER>(null_glGetUniformLocation)},
+  {"glVertexStream1svATI",reinterpret_cast<FUNCTION_POINTER>(null_glVertexStream1svATI)},
+  {"glVertexStream3fATI",reinterpret_cast<FUNCTION_POINTER>(null_glVertexStream3fATI)},
+  {"glNamedFramebufferDrawBuffers",reinterpret_cast<FUNCTION_POINTER>(null_glNamedFramebufferDrawBuffers)},
+  {"glUniform2ui64vNV",reinterpret_cast<FUNCTION_POINTER>(null_glUniform2ui64vNV)},
+  {"glTexCoordPointervINTEL",reinterpret_cast<FUNCTION_POINTER>(null_glTexCoordPointervINTEL)},
+  {"glUniform4fv",reinterpret_cast<FUNCTION_POINTER>(null_glUniform4fv)},
+  {"glNormalPointerEXT",reinterpret_cast<FUNCTION_POINTER>(null_glNormalPointerEXT)},
+  {"glVertexAttrib4hNV",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib4hNV)},
+  {"glNormal3f",reinterpret_cast<FUNCTION_POINTER>(null_glNormal3f)},
+  {"glVertexStream2iATI",reinterpret_cast<FUNCTION_POINTER>(null_glVertexStream2iATI)},
+  {"glVertexAttribP4uiv",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribP4uiv)},
+  {"glCompressedTextureSubImage3D",reinterpret_cast<FUNCTION_POINTER>(null_glCompressedTextureSubImage3D)},
+  {"glAsyncMarkerSGIX",reinterpret_cast<FUNCTION_POINTER>(null_glAsyncMarkerSGIX)},
+  {"glTextureStorageSparseAMD",reinterpret_cast<FUNCTION_POINTER>(null_glTextureStorageSparseAMD)},
+  {"glGetConvolutionParameterivEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetConvolutionParameterivEXT)},
+  {"glEndPerfQueryINTEL",reinterpret_cast<FUNCTION_POINTER>(null_glEndPerfQueryINTEL)},
+  {"glFragmentLightModeliSGIX",reinterpret_cast<FUNCTION_POINTER>(null_glFragmentLightModeliSGIX)},
+  {"glPrioritizeTexturesEXT",reinterpret_cast<FUNCTION_POINTER>(null_glPrioritizeTexturesEXT)},
+  {"glEndConditionalRender",reinterpret_cast<FUNCTION_POINTER>(null_glEndConditionalRender)},
+  {"glEnableClientState",reinterpret_cast<FUNCTION_POINTER>(null_glEnableClientState)},
+  {"glResetHistogram",reinterpret_cast<FUNCTION_POINTER>(null_glResetHistogram)},
+  {"glGetOcclusionQueryivNV",reinterpret_cast<FUNCTION_POINTER>(null_glGetOcclusionQueryivNV)},
+  {"glUniform1uiEXT",reinterpret_cast<FUNCTION_POINTER>(null_glUniform1uiEXT)},
+  {"glMultiTexCoord2sv",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord2sv)},
+  {"glTexSubImage2DEXT",reinterpret_cast<FUNCTION_POINTER>(null_glTexSubImage2DEXT)},
+  {"glProgramUniform2uiv",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform2uiv)},
+  {"glMultiTexCoord2iARB",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord2iARB)},
+  {"glGetQueryObjectuiv",reinterpret_cast<FUNCTION_POINTER>(null_glGetQueryObjectuiv)},
+  {"glGenerateMultiTexMipmapEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGenerateMultiTexMipmapEXT)},
+  {"glVertexAttrib4iv",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib4iv)},
+  {"glWindowPos3dvMESA",reinterpret_cast<FUNCTION_POINTER>(null_glWindowPos3dvMESA)},
+  {"glLabelObjectEXT",reinterpret_cast<FUNCTION_POINTER>(null_glLabelObjectEXT)},
+  {"glProgramUniform1uiv",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform1uiv)},
+  {"glFramebufferTexture",reinterpret_cast<FUNCTION_POINTER>(null_glFramebufferTexture)},
+  {"glMultiTexEnvfEXT",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexEnvfEXT)},
+  {"glGetTexGendv",reinterpret_cast<FUNCTION_POINTER>(null_glGetTexGendv)},
+  {"glVertex4xOES",reinterpret_cast<FUNCTION_POINTER>(null_glVertex4xOES)},
+  {"glVertexAttribI2uivEXT",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribI2uivEXT)},
+  {"glNamedProgramLocalParameter4fvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glNamedProgramLocalParameter4fvEXT)},
+  {"glPointParameterfvSGIS",reinterpret_cast<FUNCTION_POINTER>(null_glPointParameterfvSGIS)},
+  {"glGetPixelTransformParameterfvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetPixelTransformParameterfvEXT)},
+  {"glIndexxvOES",reinterpret_cast<FUNCTION_POINTER>(null_glIndexxvOES)},
+  {"glDepthMask",reinterpret_cast<FUNCTION_POINTER>(null_glDepthMask)},
+  {"glProgramUniformMatrix2x4fv",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniformMatrix2x4fv)},
+  {"glAreProgramsResidentNV",reinterpret_cast<FUNCTION_POINTER>(null_glAreProgramsResidentNV)},
+  {"glColorTable",reinterpret_cast<FUNCTION_POINTER>(null_glColorTable)},
+  {"glBeginQueryIndexed",reinterpret_cast<FUNCTION_POINTER>(null_glBeginQueryIndexed)},
+  {"glVertexStream1dvATI",reinterpret_cast<FUNCTION_POINTER>(null_glVertexStream1dvATI)},
+  {"glGetMultiTexEnvfvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetMultiTexEnvfvEXT)},
+  {"glDeleteFencesNV",reinterpret_cast<FUNCTION_POINTER>(null_glDeleteFencesNV)},
+  {"glVertexAttribs1dvNV",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribs1dvNV)},
+  {"glVertexStream2sATI",reinterpret_cast<FUNCTION_POINTER>(null_glVertexStream2sATI)},
+  {"glGetnSeparableFilterARB",reinterpret_cast<FUNCTION_POINTER>(null_glGetnSeparableFilterARB)},
+  {"glProgramUniform2dv",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform2dv)},
+  {"glActiveStencilFaceEXT",reinterpret_cast<FUNCTION_POINTER>(null_glActiveStencilFaceEXT)},
+  {"glProgramUniform4dEXT",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform4dEXT)},
+  {"glPointSizexOES",reinterpret_cast<FUNCTION_POINTER>(null_glPointSizexOES)},
+  {"glRasterPos2sv",reinterpret_cast<FUNCTION_POINTER>(null_glRasterPos2sv)},
+  {"glBindParameterEXT",reinterpret_cast<FUNCTION_POINTER>(null_glBindParameterEXT)},
+  {"glTexCoord1sv",reinterpret_cast<FUNCTION_POINTER>(null_glTexCoord1sv)},
+  {"glBlendParameteriNV",reinterpret_cast<FUNCTION_POINTER>(null_glBlendParameteriNV)},
+  {"glNamedProgramLocalParameter4dvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glNamedProgramLocalParameter4dvEXT)},
+  {"glProgramUniformHandleui64NV",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniformHandleui64NV)},
+  {"glGetTextureParameterfvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetTextureParameterfvEXT)},
+  {"glGetPathMetricsNV",reinterpret_cast<FUNCTION_POINTER>(null_glGetPathMetricsNV)},
+  {"glVertex2i",reinterpret_cast<FUNCTION_POINTER>(null_glVertex2i)},
+  {"glNewList",reinterpret_cast<FUNCTION_POINTER>(null_glNewList)},
+  {"glMatrixLoad3x3fNV",reinterpret_cast<FUNCTION_POINTER>(null_glMatrixLoad3x3fNV)},
+  {"glMultiTexCoord2fARB",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord2fARB)},
+  {"glWeightdvARB",reinterpret_cast<FUNCTION_POINTER>(null_glWeightdvARB)},
+  {"glIsTransformFeedbackNV",reinterpret_cast<FUNCTION_POINTER>(null_glIsTransformFeedbackNV)},
+  {"glVertexAttribDivisorARB",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribDivisorARB)},
+  {"glSecondaryColorP3uiv",reinterpret_cast<FUNCTION_POINTER>(null_glSecondaryColorP3uiv)},
+  {"glGetnCompressedTexImageARB",reinterpret_cast<FUNCTION_POINTER>(null_glGetnCompressedTexImageARB)},
+  {"glGetIntegerv",reinterpret_cast<FUNCTION_POINTER>(null_glGetIntegerv)},
+  {"glMatrixLoaddEXT",reinterpret_cast<FUNCTION_POINTER>(null_glMatrixLoaddEXT)},
+  {"glGetPathLengthNV",reinterpret_cast<FUNCTION_POINTER>(null_glGetPathLengthNV)},
+  {"glProgramUniformMatrix3dv",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniformMatrix3dv)},
+  {"glUniform4i64NV",reinterpret_cast<FUNCTION_POINTER>(null_glUniform4i64NV)},
+  {"glGetHistogramEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetHistogramEXT)},
+  {"glVertexAttrib4NuivARB",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib4NuivARB)},
+  {"glMapGrid2xOES",reinterpret_cast<FUNCTION_POINTER>(null_glMapGrid2xOES)},
+  {"glTexImage2D",reinterpret_cast<FUNCTION_POINTER>(null_glTexImage2D)},
+  {"glWindowPos2fvARB",reinterpret_cast<FUNCTION_POINTER>(null_glWindowPos2fvARB)},
+  {"glEnableIndexedEXT",reinterpret_cast<FUNCTION_POINTER>(null_glEnableIndexedEXT)},
+  {"glTexCoord1bvOES",reinterpret_cast<FUNCTION_POINTER>(null_glTexCoord1bvOES)},
+  {"glDrawPixels",reinterpret_cast<FUNCTION_POINTER>(null_glDrawPixels)},
+  {"glMultMatrixd",reinterpret_cast<FUNCTION_POINTER>(null_glMultMatrixd)},
+  {"glMultMatrixf",reinterpret_cast<FUNCTION_POINTER>(null_glMultMatrixf)},
+  {"glReplacementCodePointerSUN",reinterpret_cast<FUNCTION_POINTER>(null_glReplacementCodePointerSUN)},
+  {"glLoadTransposeMatrixdARB",reinterpret_cast<FUNCTION_POINTER>(null_glLoadTransposeMatrixdARB)},
+  {"glVertexAttrib4Nubv",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib4Nubv)},
+  {"glVertexArrayVertexAttribIOffsetEXT",reinterpret_cast<FUNCTION_POINTER>(null_glVertexArrayVertexAttribIOffsetEXT)},
+  {"glCompileShaderARB",reinterpret_cast<FUNCTION_POINTER>(null_glCompileShaderARB)},
+  {"glWindowPos3dMESA",reinterpret_cast<FUNCTION_POINTER>(null_glWindowPos3dMESA)},
+  {"glNormalStream3fvATI",reinterpret_cast<FUNCTION_POINTER>(null_glNormalStream3fvATI)},
+  {"glColor4usv",reinterpret_cast<FUNCTION_POINTER>(null_glColor4usv)},
+  {"glMapGrid1f",reinterpret_cast<FUNCTION_POINTER>(null_glMapGrid1f)},
+  {"glPolygonStipple",reinterpret_cast<FUNCTION_POINTER>(null_glPolygonStipple)},
+  {"glUniform4ui64ARB",reinterpret_cast<FUNCTION_POINTER>(null_glUniform4ui64ARB)},
+  {"glTextureRenderbufferEXT",reinterpret_cast<FUNCTION_POINTER>(null_glTextureRenderbufferEXT)},
+  {"glGetSubroutineUniformLocation",reinterpret_cast<FUNCTION_POINTER>(null_glGetSubroutineUniformLocation)},
+  {"glGetFramebufferParameteriv",reinterpret_cast<FUNCTION_POINTER>(null_glGetFramebufferParameteriv)},
+  {"glPixelMapusv",reinterpret_cast<FUNCTION_POINTER>(null_glPixelMapusv)},
+  {"glGetSamplerParameteriv",reinterpret_cast<FUNCTION_POINTER>(null_glGetSamplerParameteriv)},
+  {"glVertexStream2fvATI",reinterpret_cast<FUNCTION_POINTER>(null_glVertexStream2fvATI)},
+  {"glProgramStringARB",reinterpret_cast<FUNCTION_POINTER>(null_glProgramStringARB)},
+  {"glProgramUniformMatrix3dvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniformMatrix3dvEXT)},
+  {"glSeparableFilter2D",reinterpret_cast<FUNCTION_POINTER>(null_glSeparableFilter2D)},
+  {"glVertexAttribI1uiv",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribI1uiv)},
+  {"glTexStorage2D",reinterpret_cast<FUNCTION_POINTER>(null_glTexStorage2D)},
+  {"glColor3fv",reinterpret_cast<FUNCTION_POINTER>(null_glColor3fv)},
+  {"glVertexAttribL4dvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribL4dvEXT)},
+  {"glGetActiveUniform",reinterpret_cast<FUNCTION_POINTER>(null_glGetActiveUniform)},
+  {"glUniform2ui64vARB",reinterpret_cast<FUNCTION_POINTER>(null_glUniform2ui64vARB)},
+  {"glMakeNamedBufferResidentNV",reinterpret_cast<FUNCTION_POINTER>(null_glMakeNamedBufferResidentNV)},
+  {"glPathGlyphIndexRangeNV",reinterpret_cast<FUNCTION_POINTER>(null_glPathGlyphIndexRangeNV)},
+  {"glColorPointer",reinterpret_cast<FUNCTION_POINTER>(null_glColorPointer)},
+  {"glProgramEnvParameterI4ivNV",reinterpret_cast<FUNCTION_POINTER>(null_glProgramEnvParameterI4ivNV)},
+  {"glMultiTexParameterfEXT",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexParameterfEXT)},
+  {"glNamedFramebufferTextureLayer",reinterpret_cast<FUNCTION_POINTER>(null_glNamedFramebufferTextureLayer)},
+  {"glGetVertexArrayIntegervEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetVertexArrayIntegervEXT)},
+  {"glVertexAttrib3dARB",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib3dARB)},
+  {"glVDPAUIsSurfaceNV",reinterpret_cast<FUNCTION_POINTER>(null_glVDPAUIsSurfaceNV)},
+  {"glMultiTexImage1DEXT",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexImage1DEXT)},
+  {"glIsAsyncMarkerSGIX",reinterpret_cast<FUNCTION_POINTER>(null_glIsAsyncMarkerSGIX)},
+  {"glGetDoublei_vEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetDoublei_vEXT)},
+  {"glUniform2i64NV",reinterpret_cast<FUNCTION_POINTER>(null_glUniform2i64NV)},
+  {"glIsCommandListNV",reinterpret_cast<FUNCTION_POINTER>(null_glIsCommandListNV)},
+  {"glUniform3uiEXT",reinterpret_cast<FUNCTION_POINTER>(null_glUniform3uiEXT)},
+  {"glTexParameterIuivEXT",reinterpret_cast<FUNCTION_POINTER>(null_glTexParameterIuivEXT)},
+  {"glProgramUniformMatrix4fv",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniformMatrix4fv)},
+  {"glVertex2fv",reinterpret_cast<FUNCTION_POINTER>(null_glVertex2fv)},
+  {"glVertexAttribL3dEXT",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribL3dEXT)},
+  {"glFramebufferRenderbuffer",reinterpret_cast<FUNCTION_POINTER>(null_glFramebufferRenderbuffer)},
+  {"glGetUniformLocationARB",reinterpret_cast<FUNCTION_POINTER>(null_glGetUniformLocationARB)},
+  {"glPathParameterfvNV",reinterpret_cast<FUNCTION_POINTER>(null_glPathParameterfvNV)},
+  {"glVertexAttrib3sNV",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib3sNV)},
+  {"glGetDoublei_v",reinterpret_cast<FUNCTION_POINTER>(null_glGetDoublei_v)},
+  {"glVertexAttrib1sv",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib1sv)},
+  {"glBindSampler",reinterpret_cast<FUNCTION_POINTER>(null_glBindSampler)},
+  {"glLineWidth",reinterpret_cast<FUNCTION_POINTER>(null_glLineWidth)},
+  {"glVertexArrayRangeAPPLE",reinterpret_cast<FUNCTION_POINTER>(null_glVertexArrayRangeAPPLE)},
+  {"glBindBufferOffsetEXT",reinterpret_cast<FUNCTION_POINTER>(null_glBindBufferOffsetEXT)},
+  {"glWeightfvARB",reinterpret_cast<FUNCTION_POINTER>(null_glWeightfvARB)},
+  {"glGetIntegeri_v",reinterpret_cast<FUNCTION_POINTER>(null_glGetIntegeri_v)},
+  {"glGetTransformFeedbackVarying",reinterpret_cast<FUNCTION_POINTER>(null_glGetTransformFeedbackVarying)},
+  {"glProgramLocalParameter4fvARB",reinterpret_cast<FUNCTION_POINTER>(null_glProgramLocalParameter4fvARB)},
+  {"glGetTransformFeedbackVaryingNV",reinterpret_cast<FUNCTION_POINTER>(null_glGetTransformFeedbackVaryingNV)},
+  {"glWindowPos2iv",reinterpret_cast<FUNCTION_POINTER>(null_glWindowPos2iv)},
+  {"glVertexStream1dATI",reinterpret_cast<FUNCTION_POINTER>(null_glVertexStream1dATI)},
+  {"glColorFragmentOp2ATI",reinterpret_cast<FUNCTION_POINTER>(null_glColorFragmentOp2ATI)},
+  {"glFogiv",reinterpret_cast<FUNCTION_POINTER>(null_glFogiv)},
+  {"glGetTextureHandleNV",reinterpret_cast<FUNCTION_POINTER>(null_glGetTextureHandleNV)},
+  {"glLightModeliv",reinterpret_cast<FUNCTION_POINTER>(null_glLightModeliv)},
+  {"glDepthRangef",reinterpret_cast<FUNCTION_POINTER>(null_glDepthRangef)},
+  {"glGetFragmentMaterialivSGIX",reinterpret_cast<FUNCTION_POINTER>(null_glGetFragmentMaterialivSGIX)},
+  {"glVideoCaptureStreamParameterfvNV",reinterpret_cast<FUNCTION_POINTER>(null_glVideoCaptureStreamParameterfvNV)},
+  {"glDeleteProgramsARB",reinterpret_cast<FUNCTION_POINTER>(null_glDeleteProgramsARB)},
+  {"glWindowPos3fvARB",reinterpret_cast<FUNCTION_POINTER>(null_glWindowPos3fvARB)},
+  {"glFeedbackBufferxOES",reinterpret_cast<FUNCTION_POINTER>(null_glFeedbackBufferxOES)},
+  {"glGetTexBumpParameterfvATI",reinterpret_cast<FUNCTION_POINTER>(null_glGetTexBumpParameterfvATI)},
+  {"glEnablei",reinterpret_cast<FUNCTION_POINTER>(null_glEnablei)},
+  {"glGetActiveSubroutineName",reinterpret_cast<FUNCTION_POINTER>(null_glGetActiveSubroutineName)},
+  {"glDrawBuffersARB",reinterpret_cast<FUNCTION_POINTER>(null_glDrawBuffersARB)},
+  {"glBindProgramARB",reinterpret_cast<FUNCTION_POINTER>(null_glBindProgramARB)},
+  {"glEvalCoord1fv",reinterpret_cast<FUNCTION_POINTER>(null_glEvalCoord1fv)},
+  {"glProgramUniform3ui64vARB",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform3ui64vARB)},
+  {"glProgramUniformMatrix2dv",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniformMatrix2dv)},
+  {"glMultiTexCoord2hvNV",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord2hvNV)},
+  {"glGetFloatIndexedvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetFloatIndexedvEXT)},
+  {"glSampleCoverageARB",reinterpret_cast<FUNCTION_POINTER>(null_glSampleCoverageARB)},
+  {"glProgramUniform2ui64vARB",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform2ui64vARB)},
+  {"glPixelDataRangeNV",reinterpret_cast<FUNCTION_POINTER>(null_glPixelDataRangeNV)},
+  {"glVertexStream3svATI",reinterpret_cast<FUNCTION_POINTER>(null_glVertexStream3svATI)},
+  {"glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN",reinterpret_cast<FUNCTION_POINTER>(null_glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN)},
+  {"glTexCoord3hvNV",reinterpret_cast<FUNCTION_POINTER>(null_glTexCoord3hvNV)},
+  {"glSampleMaski",reinterpret_cast<FUNCTION_POINTER>(null_glSampleMaski)},
+  {"glIndexFuncEXT",reinterpret_cast<FUNCTION_POINTER>(null_glIndexFuncEXT)},
+  {"glPointParameteriNV",reinterpret_cast<FUNCTION_POINTER>(null_glPointParameteriNV)},
+  {"glUniformMatrix3x2fv",reinterpret_cast<FUNCTION_POINTER>(null_glUniformMatrix3x2fv)},
+  {"glGetFramebufferParameterivEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetFramebufferParameterivEXT)},
+  {"glUniform2i64ARB",reinterpret_cast<FUNCTION_POINTER>(null_glUniform2i64ARB)},
+  {"glNamedBufferStorageEXT",reinterpret_cast<FUNCTION_POINTER>(null_glNamedBufferStorageEXT)},
+  {"glNamedFramebufferTexture3DEXT",reinterpret_cast<FUNCTION_POINTER>(null_glNamedFramebufferTexture3DEXT)},
+  {"glVertexAttrib2dv",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib2dv)},
+  {"glGetVertexArrayPointervEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetVertexArrayPointervEXT)},
+  {"glGetVertexAttribArrayObjectivATI",reinterpret_cast<FUNCTION_POINTER>(null_glGetVertexAttribArrayObjectivATI)},
+  {"glProgramUniformMatrix3fvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniformMatrix3fvEXT)},
+  {"glEnableVertexArrayEXT",reinterpret_cast<FUNCTION_POINTER>(null_glEnableVertexArrayEXT)},
+  {"glColorTableParameterfvSGI",reinterpret_cast<FUNCTION_POINTER>(null_glColorTableParameterfvSGI)},
+  {"glEdgeFlag",reinterpret_cast<FUNCTION_POINTER>(null_glEdgeFlag)},
+  {"glFogCoordf",reinterpret_cast<FUNCTION_POINTER>(null_glFogCoordf)},
+  {"glVertex3d",reinterpret_cast<FUNCTION_POINTER>(null_glVertex3d)},
+  {"glVertex3f",reinterpret_cast<FUNCTION_POINTER>(null_glVertex3f)},
+  {"glSpriteParameterivSGIX",reinterpret_cast<FUNCTION_POINTER>(null_glSpriteParameterivSGIX)},
+  {"glPathGlyphRangeNV",reinterpret_cast<FUNCTION_POINTER>(null_glPathGlyphRangeNV)},
+  {"glPrimitiveBoundingBoxARB",reinterpret_cast<FUNCTION_POINTER>(null_glPrimitiveBoundingBoxARB)},
+  {"glVertexAttribL3ui64vNV",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribL3ui64vNV)},
+  {"glVertex3s",reinterpret_cast<FUNCTION_POINTER>(null_glVertex3s)},
+  {"glTexCoordP2ui",reinterpret_cast<FUNCTION_POINTER>(null_glTexCoordP2ui)},
+  {"glProgramUniform2fvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform2fvEXT)},
+  {"glDeletePathsNV",reinterpret_cast<FUNCTION_POINTER>(null_glDeletePathsNV)},
+  {"glPrimitiveRestartIndexNV",reinterpret_cast<FUNCTION_POINTER>(null_glPrimitiveRestartIndexNV)},
+  {"glTexCoord2fColor3fVertex3fvSUN",reinterpret_cast<FUNCTION_POINTER>(null_glTexCoord2fColor3fVertex3fvSUN)},
+  {"glTexCoordPointerListIBM",reinterpret_cast<FUNCTION_POINTER>(null_glTexCoordPointerListIBM)},
+  {"glRectxOES",reinterpret_cast<FUNCTION_POINTER>(null_glRectxOES)},
+  {"glCopyNamedBufferSubData",reinterpret_cast<FUNCTION_POINTER>(null_glCopyNamedBufferSubData)},
+  {"glGenProgramsNV",reinterpret_cast<FUNCTION_POINTER>(null_glGenProgramsNV)},
+  {"glFragmentLightfSGIX",reinterpret_cast<FUNCTION_POINTER>(null_glFragmentLightfSGIX)},
+  {"glTexStorage3D",reinterpret_cast<FUNCTION_POINTER>(null_glTexStorage3D)},
+  {"glTextureParameteriv",reinterpret_cast<FUNCTION_POINTER>(null_glTextureParameteriv)},
+  {"glNamedBufferDataEXT",reinterpret_cast<FUNCTION_POINTER>(null_glNamedBufferDataEXT)},
+  {"glMultiTexCoord3fvARB",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord3fvARB)},
+  {"glUniformMatrix3x4fv",reinterpret_cast<FUNCTION_POINTER>(null_glUniformMatrix3x4fv)},
+  {"glSubpixelPrecisionBiasNV",reinterpret_cast<FUNCTION_POINTER>(null_glSubpixelPrecisionBiasNV)},
+  {"glNormalPointer",reinterpret_cast<FUNCTION_POINTER>(null_glNormalPointer)},
+  {"glNamedFramebufferTexture",reinterpret_cast<FUNCTION_POINTER>(null_glNamedFramebufferTexture)},
+  {"glVertexAttrib4NsvARB",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib4NsvARB)},
+  {"glPassThrough",reinterpret_cast<FUNCTION_POINTER>(null_glPassThrough)},
+  {"glSecondaryColorP3ui",reinterpret_cast<FUNCTION_POINTER>(null_glSecondaryColorP3ui)},
+  {"glInvalidateTexSubImage",reinterpret_cast<FUNCTION_POINTER>(null_glInvalidateTexSubImage)},
+  {"glIsImageHandleResidentARB",reinterpret_cast<FUNCTION_POINTER>(null_glIsImageHandleResidentARB)},
+  {"glTangent3fvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glTangent3fvEXT)},
+  {"glProgramUniformMatrix4x3fv",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniformMatrix4x3fv)},
+  {"glBegin",reinterpret_cast<FUNCTION_POINTER>(null_glBegin)},
+  {"glEvalCoord2dv",reinterpret_cast<FUNCTION_POINTER>(null_glEvalCoord2dv)},
+  {"glColor3ubv",reinterpret_cast<FUNCTION_POINTER>(null_glColor3ubv)},
+  {"glFogCoordfvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glFogCoordfvEXT)},
+  {"glVertexP3ui",reinterpret_cast<FUNCTION_POINTER>(null_glVertexP3ui)},
+  {"glLightfv",reinterpret_cast<FUNCTION_POINTER>(null_glLightfv)},
+  {"glVertexAttribL3i64NV",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribL3i64NV)},
+  {"glStencilClearTagEXT",reinterpret_cast<FUNCTION_POINTER>(null_glStencilClearTagEXT)},
+  {"glGetActiveUniformName",reinterpret_cast<FUNCTION_POINTER>(null_glGetActiveUniformName)},
+  {"glTangentPointerEXT",reinterpret_cast<FUNCTION_POINTER>(null_glTangentPointerEXT)},
+  {"glUniform4ui64vNV",reinterpret_cast<FUNCTION_POINTER>(null_glUniform4ui64vNV)},
+  {"glDebugMessageEnableAMD",reinterpret_cast<FUNCTION_POINTER>(null_glDebugMessageEnableAMD)},
+  {"glProgramUniform2ui",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform2ui)},
+  {"glCopyTexSubImage2DEXT",reinterpret_cast<FUNCTION_POINTER>(null_glCopyTexSubImage2DEXT)},
+  {"glGenRenderbuffersEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGenRenderbuffersEXT)},
+  {"glNamedProgramLocalParameterI4ivEXT",reinterpret_cast<FUNCTION_POINTER>(null_glNamedProgramLocalParameterI4ivEXT)},
+  {"glMultiTexCoord2f",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord2f)},
+  {"glMapGrid2d",reinterpret_cast<FUNCTION_POINTER>(null_glMapGrid2d)},
+  {"glGetMultiTexParameterIuivEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetMultiTexParameterIuivEXT)},
+  {"glBlendEquationiARB",reinterpret_cast<FUNCTION_POINTER>(null_glBlendEquationiARB)},
+  {"glTexParameteriv",reinterpret_cast<FUNCTION_POINTER>(null_glTexParameteriv)},
+  {"glUniform4ivARB",reinterpret_cast<FUNCTION_POINTER>(null_glUniform4ivARB)},
+  {"glMatrixOrthoEXT",reinterpret_cast<FUNCTION_POINTER>(null_glMatrixOrthoEXT)},
+  {"glVertexArrayVertexBuffer",reinterpret_cast<FUNCTION_POINTER>(null_glVertexArrayVertexBuffer)},
+  {"glProgramLocalParametersI4ivNV",reinterpret_cast<FUNCTION_POINTER>(null_glProgramLocalParametersI4ivNV)},
+  {"glProgramUniform4ui64vNV",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform4ui64vNV)},
+  {"glGetNamedStringivARB",reinterpret_cast<FUNCTION_POINTER>(null_glGetNamedStringivARB)},
+  {"glVertexAttribL1i64vNV",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribL1i64vNV)},
+  {"glTransformFeedbackBufferBase",reinterpret_cast<FUNCTION_POINTER>(null_glTransformFeedbackBufferBase)},
+  {"glIndexsv",reinterpret_cast<FUNCTION_POINTER>(null_glIndexsv)},
+  {"glPointParameterivNV",reinterpret_cast<FUNCTION_POINTER>(null_glPointParameterivNV)},
+  {"glGetDetailTexFuncSGIS",reinterpret_cast<FUNCTION_POINTER>(null_glGetDetailTexFuncSGIS)},
+  {"glReplacementCodeuiColor3fVertex3fvSUN",reinterpret_cast<FUNCTION_POINTER>(null_glReplacementCodeuiColor3fVertex3fvSUN)},
+  {"glProgramLocalParameter4fARB",reinterpret_cast<FUNCTION_POINTER>(null_glProgramLocalParameter4fARB)},
+  {"glBitmap",reinterpret_cast<FUNCTION_POINTER>(null_glBitmap)},
+  {"glNamedFramebufferTextureLayerEXT",reinterpret_cast<FUNCTION_POINTER>(null_glNamedFramebufferTextureLayerEXT)},
+  {"glMultiTexGenfvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexGenfvEXT)},
+  {"glGetNamedBufferSubData",reinterpret_cast<FUNCTION_POINTER>(null_glGetNamedBufferSubData)},
+  {"glStencilFuncSeparateATI",reinterpret_cast<FUNCTION_POINTER>(null_glStencilFuncSeparateATI)},
+  {"glProgramUniform2iv",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform2iv)},
+  {"glGetQueryiv",reinterpret_cast<FUNCTION_POINTER>(null_glGetQueryiv)},
+  {"glTexCoord4f",reinterpret_cast<FUNCTION_POINTER>(null_glTexCoord4f)},
+  {"glMapGrid2f",reinterpret_cast<FUNCTION_POINTER>(null_glMapGrid2f)},
+  {"glListParameterivSGIX",reinterpret_cast<FUNCTION_POINTER>(null_glListParameterivSGIX)},
+  {"glCreateQueries",reinterpret_cast<FUNCTION_POINTER>(null_glCreateQueries)},
+  {"glGetSamplerParameterfv",reinterpret_cast<FUNCTION_POINTER>(null_glGetSamplerParameterfv)},
+  {"glTexCoord4i",reinterpret_cast<FUNCTION_POINTER>(null_glTexCoord4i)},
+  {"glObjectLabel",reinterpret_cast<FUNCTION_POINTER>(null_glObjectLabel)},
+  {"glProgramUniform3i64NV",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform3i64NV)},
+  {"glGetTextureHandleARB",reinterpret_cast<FUNCTION_POINTER>(null_glGetTextureHandleARB)},
+  {"glTexCoord4s",reinterpret_cast<FUNCTION_POINTER>(null_glTexCoord4s)},
+  {"glUniform4iARB",reinterpret_cast<FUNCTION_POINTER>(null_glUniform4iARB)},
+  {"glGetUniformIndices",reinterpret_cast<FUNCTION_POINTER>(null_glGetUniformIndices)},
+  {"glMultiTexImage3DEXT",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexImage3DEXT)},
+  {"glCoverageModulationTableNV",reinterpret_cast<FUNCTION_POINTER>(null_glCoverageModulationTableNV)},
+  {"glPointParameteriv",reinterpret_cast<FUNCTION_POINTER>(null_glPointParameteriv)},
+  {"glMultiTexCoord4svARB",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord4svARB)},
+  {"glNormal3fv",reinterpret_cast<FUNCTION_POINTER>(null_glNormal3fv)},
+  {"glProgramUniformMatrix3x4dvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniformMatrix3x4dvEXT)},
+  {"glTexCoord1fv",reinterpret_cast<FUNCTION_POINTER>(null_glTexCoord1fv)},
+  {"glProgramUniformMatrix4x3dvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniformMatrix4x3dvEXT)},
+  {"glGetActiveVaryingNV",reinterpret_cast<FUNCTION_POINTER>(null_glGetActiveVaryingNV)},
+  {"glUniform1i64vARB",reinterpret_cast<FUNCTION_POINTER>(null_glUniform1i64vARB)},
+  {"glMultiTexCoord1dv",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord1dv)},
+  {"glTexCoord3fv",reinterpret_cast<FUNCTION_POINTER>(null_glTexCoord3fv)},
+  {"glMatrixTranslatefEXT",reinterpret_cast<FUNCTION_POINTER>(null_glMatrixTranslatefEXT)},
+  {"glProgramUniform1ui64vNV",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform1ui64vNV)},
+  {"glTextureMaterialEXT",reinterpret_cast<FUNCTION_POINTER>(null_glTextureMaterialEXT)},
+  {"glMultiTexCoordP3uiv",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoordP3uiv)},
+  {"glVertexAttribP3ui",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribP3ui)},
+  {"glInterpolatePathsNV",reinterpret_cast<FUNCTION_POINTER>(null_glInterpolatePathsNV)},
+  {"glTextureBufferRange",reinterpret_cast<FUNCTION_POINTER>(null_glTextureBufferRange)},
+  {"glVertexAttribL2dEXT",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribL2dEXT)},
+  {"glGetPixelTransformParameterivEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetPixelTransformParameterivEXT)},
+  {"glTexCoord4xvOES",reinterpret_cast<FUNCTION_POINTER>(null_glTexCoord4xvOES)},
+  {"glGetVariantBooleanvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetVariantBooleanvEXT)},
+  {"glDepthRange",reinterpret_cast<FUNCTION_POINTER>(null_glDepthRange)},
+  {"glGetVertexAttribdvARB",reinterpret_cast<FUNCTION_POINTER>(null_glGetVertexAttribdvARB)},
+  {"glGetColorTableParameterfv",reinterpret_cast<FUNCTION_POINTER>(null_glGetColorTableParameterfv)},
+  {"glDrawArraysInstancedEXT",reinterpret_cast<FUNCTION_POINTER>(null_glDrawArraysInstancedEXT)},
+  {"glDisableClientStateIndexedEXT",reinterpret_cast<FUNCTION_POINTER>(null_glDisableClientStateIndexedEXT)},
+  {"glDrawBuffer",reinterpret_cast<FUNCTION_POINTER>(null_glDrawBuffer)},
+  {"glMultiDrawArraysIndirectBindlessNV",reinterpret_cast<FUNCTION_POINTER>(null_glMultiDrawArraysIndirectBindlessNV)},
+  {"glGetnPixelMapusv",reinterpret_cast<FUNCTION_POINTER>(null_glGetnPixelMapusv)},
+  {"glRasterPos3fv",reinterpret_cast<FUNCTION_POINTER>(null_glRasterPos3fv)},
+  {"glClearBufferuiv",reinterpret_cast<FUNCTION_POINTER>(null_glClearBufferuiv)},
+  {"glGetInternalformati64v",reinterpret_cast<FUNCTION_POINTER>(null_glGetInternalformati64v)},
+  {"glShaderSourceARB",reinterpret_cast<FUNCTION_POINTER>(null_glShaderSourceARB)},
+  {"glShaderOp3EXT",reinterpret_cast<FUNCTION_POINTER>(null_glShaderOp3EXT)},
+  {"glWindowPos2dvMESA",reinterpret_cast<FUNCTION_POINTER>(null_glWindowPos2dvMESA)},
+  {"glClearIndex",reinterpret_cast<FUNCTION_POINTER>(null_glClearIndex)},
+  {"glProvokingVertexEXT",reinterpret_cast<FUNCTION_POINTER>(null_glProvokingVertexEXT)},
+  {"glVariantubvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glVariantubvEXT)},
+  {"glFlush",reinterpret_cast<FUNCTION_POINTER>(null_glFlush)},
+  {"glGetColorTableParameterivEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetColorTableParameterivEXT)},
+  {"glPresentFrameDualFillNV",reinterpret_cast<FUNCTION_POINTER>(null_glPresentFrameDualFillNV)},
+  {"glGenVertexShadersEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGenVertexShadersEXT)},
+  {"glProgramUniformHandleui64vARB",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniformHandleui64vARB)},
+  {"glDepthRangefOES",reinterpret_cast<FUNCTION_POINTER>(null_glDepthRangefOES)},
+  {"glDrawElementsInstancedBaseVertexBaseInstance",reinterpret_cast<FUNCTION_POINTER>(null_glDrawElementsInstancedBaseVertexBaseInstance)},
+  {"glGetTexLevelParameteriv",reinterpret_cast<FUNCTION_POINTER>(null_glGetTexLevelParameteriv)},
+  {"glStencilFillPathNV",reinterpret_cast<FUNCTION_POINTER>(null_glStencilFillPathNV)},
+  {"glWindowPos3iARB",reinterpret_cast<FUNCTION_POINTER>(null_glWindowPos3iARB)},
+  {"glPrioritizeTextures",reinterpret_cast<FUNCTION_POINTER>(null_glPrioritizeTextures)},
+  {"glWindowPos3fvMESA",reinterpret_cast<FUNCTION_POINTER>(null_glWindowPos3fvMESA)},
+  {"glProgramUniformMatrix3x2dvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniformMatrix3x2dvEXT)},
+  {"glVertex4xvOES",reinterpret_cast<FUNCTION_POINTER>(null_glVertex4xvOES)},
+  {"glTexStorage3DMultisample",reinterpret_cast<FUNCTION_POINTER>(null_glTexStorage3DMultisample)},
+  {"glWindowPos2sARB",reinterpret_cast<FUNCTION_POINTER>(null_glWindowPos2sARB)},
+  {"glStencilOpValueAMD",reinterpret_cast<FUNCTION_POINTER>(null_glStencilOpValueAMD)},
+  {"glProgramVertexLimitNV",reinterpret_cast<FUNCTION_POINTER>(null_glProgramVertexLimitNV)},
+  {"glGetTexParameterPointervAPPLE",reinterpret_cast<FUNCTION_POINTER>(null_glGetTexParameterPointervAPPLE)},
+  {"glProgramUniform3uivEXT",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform3uivEXT)},
+  {"glClampColor",reinterpret_cast<FUNCTION_POINTER>(null_glClampColor)},
+  {"glClearStencil",reinterpret_cast<FUNCTION_POINTER>(null_glClearStencil)},
+  {"glTexCoordP1uiv",reinterpret_cast<FUNCTION_POINTER>(null_glTexCoordP1uiv)},
+  {"glVertexAttribs3svNV",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribs3svNV)},
+  {"glMultiTexCoord3fv",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord3fv)},
+  {"glVertexBlendEnvfATI",reinterpret_cast<FUNCTION_POINTER>(null_glVertexBlendEnvfATI)},
+  {"glIsFenceAPPLE",reinterpret_cast<FUNCTION_POINTER>(null_glIsFenceAPPLE)},
+  {"glGetBufferParameterui64vNV",reinterpret_cast<FUNCTION_POINTER>(null_glGetBufferParameterui64vNV)},
+  {"glVertexAttribI4bvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribI4bvEXT)},
+  {"glUniform2fARB",reinterpret_cast<FUNCTION_POINTER>(null_glUniform2fARB)},
+  {"glStopInstrumentsSGIX",reinterpret_cast<FUNCTION_POINTER>(null_glStopInstrumentsSGIX)},
+  {"glVertexAttrib3fNV",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib3fNV)},
+  {"glMapVertexAttrib2dAPPLE",reinterpret_cast<FUNCTION_POINTER>(null_glMapVertexAttrib2dAPPLE)},
+  {"glVertex2f",reinterpret_cast<FUNCTION_POINTER>(null_glVertex2f)},
+  {"glCopyTextureImage2DEXT",reinterpret_cast<FUNCTION_POINTER>(null_glCopyTextureImage2DEXT)},
+  {"glVertex2d",reinterpret_cast<FUNCTION_POINTER>(null_glVertex2d)},
+  {"glSecondaryColor3bvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glSecondaryColor3bvEXT)},
+  {"glMultiTexCoord4fARB",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord4fARB)},
+  {"glPolygonOffset",reinterpret_cast<FUNCTION_POINTER>(null_glPolygonOffset)},
+  {"glTangent3bvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glTangent3bvEXT)},
+  {"glHistogram",reinterpret_cast<FUNCTION_POINTER>(null_glHistogram)},
+  {"glGetProgramiv",reinterpret_cast<FUNCTION_POINTER>(null_glGetProgramiv)},
+  {"glMatrixIndexubvARB",reinterpret_cast<FUNCTION_POINTER>(null_glMatrixIndexubvARB)},
+  {"glVertex2s",reinterpret_cast<FUNCTION_POINTER>(null_glVertex2s)},
+  {"glGetVertexAttribLui64vNV",reinterpret_cast<FUNCTION_POINTER>(null_glGetVertexAttribLui64vNV)},
+  {"glGetProgramStringARB",reinterpret_cast<FUNCTION_POINTER>(null_glGetProgramStringARB)},
+  {"glFlushMappedBufferRange",reinterpret_cast<FUNCTION_POINTER>(null_glFlushMappedBufferRange)},
+  {"glVertexAttribI3uiEXT",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribI3uiEXT)},
+  {"glLineWidthxOES",reinterpret_cast<FUNCTION_POINTER>(null_glLineWidthxOES)},
+  {"glProgramUniformMatrix2fvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniformMatrix2fvEXT)},
+  {"glGetTextureParameterIuivEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetTextureParameterIuivEXT)},
+  {"glGetMultiTexEnvivEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetMultiTexEnvivEXT)},
+  {"glPixelTexGenParameterivSGIS",reinterpret_cast<FUNCTION_POINTER>(null_glPixelTexGenParameterivSGIS)},
+  {"glGenQueries",reinterpret_cast<FUNCTION_POINTER>(null_glGenQueries)},
+  {"glGetPixelMapfv",reinterpret_cast<FUNCTION_POINTER>(null_glGetPixelMapfv)},
+  {"glBlendColorEXT",reinterpret_cast<FUNCTION_POINTER>(null_glBlendColorEXT)},
+  {"glResetMinmax",reinterpret_cast<FUNCTION_POINTER>(null_glResetMinmax)},
+  {"glGetnUniformivARB",reinterpret_cast<FUNCTION_POINTER>(null_glGetnUniformivARB)},
+  {"glVertexBlendARB",reinterpret_cast<FUNCTION_POINTER>(null_glVertexBlendARB)},
+  {"glVertexAttrib4d",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib4d)},
+  {"glGetVaryingLocationNV",reinterpret_cast<FUNCTION_POINTER>(null_glGetVaryingLocationNV)},
+  {"glGetMapAttribParameterivNV",reinterpret_cast<FUNCTION_POINTER>(null_glGetMapAttribParameterivNV)},
+  {"glTexSubImage3D",reinterpret_cast<FUNCTION_POINTER>(null_glTexSubImage3D)},
+  {"glDeleteSamplers",reinterpret_cast<FUNCTION_POINTER>(null_glDeleteSamplers)},
+  {"glGetLightxOES",reinterpret_cast<FUNCTION_POINTER>(null_glGetLightxOES)},
+  {"glGetVertexAttribArrayObjectfvATI",reinterpret_cast<FUNCTION_POINTER>(null_glGetVertexAttribArrayObjectfvATI)},
+  {"glVertexArrayNormalOffsetEXT",reinterpret_cast<FUNCTION_POINTER>(null_glVertexArrayNormalOffsetEXT)},
+  {"glGetBufferParameterivARB",reinterpret_cast<FUNCTION_POINTER>(null_glGetBufferParameterivARB)},
+  {"glGetTextureParameterfv",reinterpret_cast<FUNCTION_POINTER>(null_glGetTextureParameterfv)},
+  {"glDrawMeshArraysSUN",reinterpret_cast<FUNCTION_POINTER>(null_glDrawMeshArraysSUN)},
+  {"glVertexAttrib4dNV",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib4dNV)},
+  {"glGetMultisamplefvNV",reinterpret_cast<FUNCTION_POINTER>(null_glGetMultisamplefvNV)},
+  {"glMapObjectBufferATI",reinterpret_cast<FUNCTION_POINTER>(null_glMapObjectBufferATI)},
+  {"glGetPathCommandsNV",reinterpret_cast<FUNCTION_POINTER>(null_glGetPathCommandsNV)},
+  {"glVertexArrayTexCoordOffsetEXT",reinterpret_cast<FUNCTION_POINTER>(null_glVertexArrayTexCoordOffsetEXT)},
+  {"glGetHistogram",reinterpret_cast<FUNCTION_POINTER>(null_glGetHistogram)},
+  {"glMatrixMode",reinterpret_cast<FUNCTION_POINTER>(null_glMatrixMode)},
+  {"glColorFormatNV",reinterpret_cast<FUNCTION_POINTER>(null_glColorFormatNV)},
+  {"glProgramUniformui64NV",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniformui64NV)},
+  {"glProgramUniformMatrix4x2fvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniformMatrix4x2fvEXT)},
+  {"glLoadMatrixxOES",reinterpret_cast<FUNCTION_POINTER>(null_glLoadMatrixxOES)},
+  {"glGetColorTableParameterfvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetColorTableParameterfvEXT)},
+  {"glRasterPos4i",reinterpret_cast<FUNCTION_POINTER>(null_glRasterPos4i)},
+  {"glVertexAttribL2i64NV",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribL2i64NV)},
+  {"glBindTextures",reinterpret_cast<FUNCTION_POINTER>(null_glBindTextures)},
+  {"glMatrixRotatefEXT",reinterpret_cast<FUNCTION_POINTER>(null_glMatrixRotatefEXT)},
+  {"glGetClipPlanexOES",reinterpret_cast<FUNCTION_POINTER>(null_glGetClipPlanexOES)},
+  {"glSecondaryColor3uivEXT",reinterpret_cast<FUNCTION_POINTER>(null_glSecondaryColor3uivEXT)},
+  {"glGetPerfQueryInfoINTEL",reinterpret_cast<FUNCTION_POINTER>(null_glGetPerfQueryInfoINTEL)},
+  {"glGetDoublev",reinterpret_cast<FUNCTION_POINTER>(null_glGetDoublev)},
+  {"glBindBufferRangeEXT",reinterpret_cast<FUNCTION_POINTER>(null_glBindBufferRangeEXT)},
+  {"glCompressedTexImage2D",reinterpret_cast<FUNCTION_POINTER>(null_glCompressedTexImage2D)},
+  {"glMapBufferARB",reinterpret_cast<FUNCTION_POINTER>(null_glMapBufferARB)},
+  {"glGetPathSpacingNV",reinterpret_cast<FUNCTION_POINTER>(null_glGetPathSpacingNV)},
+  {"glUniform4dv",reinterpret_cast<FUNCTION_POINTER>(null_glUniform4dv)},
+  {"glGlobalAlphaFactordSUN",reinterpret_cast<FUNCTION_POINTER>(null_glGlobalAlphaFactordSUN)},
+  {"glProgramUniform3dv",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform3dv)},
+  {"glGetShaderSourceARB",reinterpret_cast<FUNCTION_POINTER>(null_glGetShaderSourceARB)},
+  {"glVertexAttrib3dvARB",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib3dvARB)},
+  {"glInvalidateBufferData",reinterpret_cast<FUNCTION_POINTER>(null_glInvalidateBufferData)},
+  {"glMatrixLoad3x2fNV",reinterpret_cast<FUNCTION_POINTER>(null_glMatrixLoad3x2fNV)},
+  {"glCompressedTextureSubImage1D",reinterpret_cast<FUNCTION_POINTER>(null_glCompressedTextureSubImage1D)},
+  {"glTexCoord3xvOES",reinterpret_cast<FUNCTION_POINTER>(null_glTexCoord3xvOES)},
+  {"glGenTexturesEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGenTexturesEXT)},
+  {"glTangent3iEXT",reinterpret_cast<FUNCTION_POINTER>(null_glTangent3iEXT)},
+  {"glClearTexImage",reinterpret_cast<FUNCTION_POINTER>(null_glClearTexImage)},
+  {"glBinormal3bvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glBinormal3bvEXT)},
+  {"glUniform3fv",reinterpret_cast<FUNCTION_POINTER>(null_glUniform3fv)},
+  {"glGetnPixelMapusvARB",reinterpret_cast<FUNCTION_POINTER>(null_glGetnPixelMapusvARB)},
+  {"glMultiTexCoordP1ui",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoordP1ui)},
+  {"glClearNamedBufferDataEXT",reinterpret_cast<FUNCTION_POINTER>(null_glClearNamedBufferDataEXT)},
+  {"glUniformMatrix4dv",reinterpret_cast<FUNCTION_POINTER>(null_glUniformMatrix4dv)},
+  {"glWindowPos3fMESA",reinterpret_cast<FUNCTION_POINTER>(null_glWindowPos3fMESA)},
+  {"glDeleteRenderbuffers",reinterpret_cast<FUNCTION_POINTER>(null_glDeleteRenderbuffers)},
+  {"glGetTextureLevelParameterfvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetTextureLevelParameterfvEXT)},
+  {"glGetHistogramParameterxvOES",reinterpret_cast<FUNCTION_POINTER>(null_glGetHistogramParameterxvOES)},
+  {"glMultiDrawElements",reinterpret_cast<FUNCTION_POINTER>(null_glMultiDrawElements)},
+  {"glMakeImageHandleNonResidentNV",reinterpret_cast<FUNCTION_POINTER>(null_glMakeImageHandleNonResidentNV)},
+  {"glTexSubImage1DEXT",reinterpret_cast<FUNCTION_POINTER>(null_glTexSubImage1DEXT)},
+  {"glNormalStream3dATI",reinterpret_cast<FUNCTION_POINTER>(null_glNormalStream3dATI)},
+  {"glVertexAttribL4i64vNV",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribL4i64vNV)},
+  {"glDrawBuffers",reinterpret_cast<FUNCTION_POINTER>(null_glDrawBuffers)},
+  {"glCopyTextureSubImage1DEXT",reinterpret_cast<FUNCTION_POINTER>(null_glCopyTextureSubImage1DEXT)},
+  {"glWindowRectanglesEXT",reinterpret_cast<FUNCTION_POINTER>(null_glWindowRectanglesEXT)},
+  {"glNamedFramebufferReadBuffer",reinterpret_cast<FUNCTION_POINTER>(null_glNamedFramebufferReadBuffer)},
+  {"glUniform2i64vARB",reinterpret_cast<FUNCTION_POINTER>(null_glUniform2i64vARB)},
+  {"glVertexAttribI1uivEXT",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribI1uivEXT)},
+  {"glGetTexGenfv",reinterpret_cast<FUNCTION_POINTER>(null_glGetTexGenfv)},
+  {"glBeginQueryARB",reinterpret_cast<FUNCTION_POINTER>(null_glBeginQueryARB)},
+  {"glUniform1iARB",reinterpret_cast<FUNCTION_POINTER>(null_glUniform1iARB)},
+  {"glVertex4bvOES",reinterpret_cast<FUNCTION_POINTER>(null_glVertex4bvOES)},
+  {"glInvalidateSubFramebuffer",reinterpret_cast<FUNCTION_POINTER>(null_glInvalidateSubFramebuffer)},
+  {"glUniform1fvARB",reinterpret_cast<FUNCTION_POINTER>(null_glUniform1fvARB)},
+  {"glTestFenceNV",reinterpret_cast<FUNCTION_POINTER>(null_glTestFenceNV)},
+  {"glBindTransformFeedback",reinterpret_cast<FUNCTION_POINTER>(null_glBindTransformFeedback)},
+  {"glMultiTexCoord2iv",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord2iv)},
+  {"glCopyMultiTexSubImage1DEXT",reinterpret_cast<FUNCTION_POINTER>(null_glCopyMultiTexSubImage1DEXT)},
+  {"glVariantbvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glVariantbvEXT)},
+  {"glTexCoord1hNV",reinterpret_cast<FUNCTION_POINTER>(null_glTexCoord1hNV)},
+  {"glGenFencesNV",reinterpret_cast<FUNCTION_POINTER>(null_glGenFencesNV)},
+  {"glRasterPos3iv",reinterpret_cast<FUNCTION_POINTER>(null_glRasterPos3iv)},
+  {"glVertexAttribL2ui64NV",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribL2ui64NV)},
+  {"glMultiTexCoord1hvNV",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord1hvNV)},
+  {"glGetnConvolutionFilter",reinterpret_cast<FUNCTION_POINTER>(null_glGetnConvolutionFilter)},
+  {"glNormal3bv",reinterpret_cast<FUNCTION_POINTER>(null_glNormal3bv)},
+  {"glWeightbvARB",reinterpret_cast<FUNCTION_POINTER>(null_glWeightbvARB)},
+  {"glTexCoord4sv",reinterpret_cast<FUNCTION_POINTER>(null_glTexCoord4sv)},
+  {"glUniform2uiv",reinterpret_cast<FUNCTION_POINTER>(null_glUniform2uiv)},
+  {"glBeginConditionalRenderNVX",reinterpret_cast<FUNCTION_POINTER>(null_glBeginConditionalRenderNVX)},
+  {"glFinish",reinterpret_cast<FUNCTION_POINTER>(null_glFinish)},
+  {"glColorTableParameterfv",reinterpret_cast<FUNCTION_POINTER>(null_glColorTableParameterfv)},
+  {"glFragmentCoverageColorNV",reinterpret_cast<FUNCTION_POINTER>(null_glFragmentCoverageColorNV)},
+  {"glProgramUniform3ivEXT",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform3ivEXT)},
+  {"glVertexArrayVertexOffsetEXT",reinterpret_cast<FUNCTION_POINTER>(null_glVertexArrayVertexOffsetEXT)},
+  {"glViewportPositionWScaleNV",reinterpret_cast<FUNCTION_POINTER>(null_glViewportPositionWScaleNV)},
+  {"glGetProgramLocalParameterIuivNV",reinterpret_cast<FUNCTION_POINTER>(null_glGetProgramLocalParameterIuivNV)},
+  {"glReplacementCodeuiTexCoord2fVertex3fvSUN",reinterpret_cast<FUNCTION_POINTER>(null_glReplacementCodeuiTexCoord2fVertex3fvSUN)},
+  {"glUniform1uiv",reinterpret_cast<FUNCTION_POINTER>(null_glUniform1uiv)},
+  {"glUniformMatrix2dv",reinterpret_cast<FUNCTION_POINTER>(null_glUniformMatrix2dv)},
+  {"glIndexdv",reinterpret_cast<FUNCTION_POINTER>(null_glIndexdv)},
+  {"glSecondaryColor3ivEXT",reinterpret_cast<FUNCTION_POINTER>(null_glSecondaryColor3ivEXT)},
+  {"glTexCoord3iv",reinterpret_cast<FUNCTION_POINTER>(null_glTexCoord3iv)},
+  {"glVertexStream4fvATI",reinterpret_cast<FUNCTION_POINTER>(null_glVertexStream4fvATI)},
+  {"glDeformationMap3fSGIX",reinterpret_cast<FUNCTION_POINTER>(null_glDeformationMap3fSGIX)},
+  {"glClearDepth",reinterpret_cast<FUNCTION_POINTER>(null_glClearDepth)},
+  {"glGenAsyncMarkersSGIX",reinterpret_cast<FUNCTION_POINTER>(null_glGenAsyncMarkersSGIX)},
+  {"glDisableIndexedEXT",reinterpret_cast<FUNCTION_POINTER>(null_glDisableIndexedEXT)},
+  {"glVertexWeightfvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glVertexWeightfvEXT)},
+  {"glGetProgramLocalParameterIivNV",reinterpret_cast<FUNCTION_POINTER>(null_glGetProgramLocalParameterIivNV)},
+  {"glCompressedTexImage3DARB",reinterpret_cast<FUNCTION_POINTER>(null_glCompressedTexImage3DARB)},
+  {"glProgramParameter4fNV",reinterpret_cast<FUNCTION_POINTER>(null_glProgramParameter4fNV)},
+  {"glConvolutionParameterxOES",reinterpret_cast<FUNCTION_POINTER>(null_glConvolutionParameterxOES)},
+  {"glInsertComponentEXT",reinterpret_cast<FUNCTION_POINTER>(null_glInsertComponentEXT)},
+  {"glCreateTextures",reinterpret_cast<FUNCTION_POINTER>(null_glCreateTextures)},
+  {"glSecondaryColor3iv",reinterpret_cast<FUNCTION_POINTER>(null_glSecondaryColor3iv)},
+  {"glCreateBuffers",reinterpret_cast<FUNCTION_POINTER>(null_glCreateBuffers)},
+  {"glMultiTexCoord2xvOES",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord2xvOES)},
+  {"glTexGenxvOES",reinterpret_cast<FUNCTION_POINTER>(null_glTexGenxvOES)},
+  {"glMultTransposeMatrixf",reinterpret_cast<FUNCTION_POINTER>(null_glMultTransposeMatrixf)},
+  {"glBeginTransformFeedbackEXT",reinterpret_cast<FUNCTION_POINTER>(null_glBeginTransformFeedbackEXT)},
+  {"glTexCoord2fColor3fVertex3fSUN",reinterpret_cast<FUNCTION_POINTER>(null_glTexCoord2fColor3fVertex3fSUN)},
+  {"glNormal3sv",reinterpret_cast<FUNCTION_POINTER>(null_glNormal3sv)},
+  {"glFreeObjectBufferATI",reinterpret_cast<FUNCTION_POINTER>(null_glFreeObjectBufferATI)},
+  {"glBlendBarrierNV",reinterpret_cast<FUNCTION_POINTER>(null_glBlendBarrierNV)},
+  {"glUniform4i64vNV",reinterpret_cast<FUNCTION_POINTER>(null_glUniform4i64vNV)},
+  {"glGetnUniformuivARB",reinterpret_cast<FUNCTION_POINTER>(null_glGetnUniformuivARB)},
+  {"glAlphaFragmentOp3ATI",reinterpret_cast<FUNCTION_POINTER>(null_glAlphaFragmentOp3ATI)},
+  {"glProgramEnvParameters4fvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glProgramEnvParameters4fvEXT)},
+  {"glBlendFuncSeparateEXT",reinterpret_cast<FUNCTION_POINTER>(null_glBlendFuncSeparateEXT)},
+  {"glConvolutionParameterivEXT",reinterpret_cast<FUNCTION_POINTER>(null_glConvolutionParameterivEXT)},
+  {"glPixelTexGenSGIX",reinterpret_cast<FUNCTION_POINTER>(null_glPixelTexGenSGIX)},
+  {"glDeleteProgram",reinterpret_cast<FUNCTION_POINTER>(null_glDeleteProgram)},
+  {"glUniformMatrix4x3dv",reinterpret_cast<FUNCTION_POINTER>(null_glUniformMatrix4x3dv)},
+  {"glGetVideoCaptureStreamivNV",reinterpret_cast<FUNCTION_POINTER>(null_glGetVideoCaptureStreamivNV)},
+  {"glProgramUniform4uiEXT",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform4uiEXT)},
+  {"glMakeImageHandleNonResidentARB",reinterpret_cast<FUNCTION_POINTER>(null_glMakeImageHandleNonResidentARB)},
+  {"glSecondaryColor3dEXT",reinterpret_cast<FUNCTION_POINTER>(null_glSecondaryColor3dEXT)},
+  {"glDeleteQueries",reinterpret_cast<FUNCTION_POINTER>(null_glDeleteQueries)},
+  {"glNormalP3uiv",reinterpret_cast<FUNCTION_POINTER>(null_glNormalP3uiv)},
+  {"glRasterPos2d",reinterpret_cast<FUNCTION_POINTER>(null_glRasterPos2d)},
+  {"glInitNames",reinterpret_cast<FUNCTION_POINTER>(null_glInitNames)},
+  {"glBinormal3fvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glBinormal3fvEXT)},
+  {"glColor3dv",reinterpret_cast<FUNCTION_POINTER>(null_glColor3dv)},
+  {"glVertexArrayVertexAttribDivisorEXT",reinterpret_cast<FUNCTION_POINTER>(null_glVertexArrayVertexAttribDivisorEXT)},
+  {"glArrayElementEXT",reinterpret_cast<FUNCTION_POINTER>(null_glArrayElementEXT)},
+  {"glProgramParameter4dNV",reinterpret_cast<FUNCTION_POINTER>(null_glProgramParameter4dNV)},
+  {"glIndexxOES",reinterpret_cast<FUNCTION_POINTER>(null_glIndexxOES)},
+  {"glUniform3uivEXT",reinterpret_cast<FUNCTION_POINTER>(null_glUniform3uivEXT)},
+  {"glPopGroupMarkerEXT",reinterpret_cast<FUNCTION_POINTER>(null_glPopGroupMarkerEXT)},
+  {"glClearNamedFramebufferuiv",reinterpret_cast<FUNCTION_POINTER>(null_glClearNamedFramebufferuiv)},
+  {"glSetLocalConstantEXT",reinterpret_cast<FUNCTION_POINTER>(null_glSetLocalConstantEXT)},
+  {"glProgramUniform1ui64NV",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform1ui64NV)},
+  {"glColor4hvNV",reinterpret_cast<FUNCTION_POINTER>(null_glColor4hvNV)},
+  {"glGetVertexAttribfv",reinterpret_cast<FUNCTION_POINTER>(null_glGetVertexAttribfv)},
+  {"glDispatchCompute",reinterpret_cast<FUNCTION_POINTER>(null_glDispatchCompute)},
+  {"glGetActiveAttrib",reinterpret_cast<FUNCTION_POINTER>(null_glGetActiveAttrib)},
+  {"glFragmentColorMaterialSGIX",reinterpret_cast<FUNCTION_POINTER>(null_glFragmentColorMaterialSGIX)},
+  {"glTexSubImage2D",reinterpret_cast<FUNCTION_POINTER>(null_glTexSubImage2D)},
+  {"glGetnMinmaxARB",reinterpret_cast<FUNCTION_POINTER>(null_glGetnMinmaxARB)},
+  {"glLogicOp",reinterpret_cast<FUNCTION_POINTER>(null_glLogicOp)},
+  {"glProgramUniformMatrix3x4fv",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniformMatrix3x4fv)},
+  {"glWindowPos4iMESA",reinterpret_cast<FUNCTION_POINTER>(null_glWindowPos4iMESA)},
+  {"glPixelTransferf",reinterpret_cast<FUNCTION_POINTER>(null_glPixelTransferf)},
+  {"glGetTextureParameterIuiv",reinterpret_cast<FUNCTION_POINTER>(null_glGetTextureParameterIuiv)},
+  {"glMultiTexCoord1xOES",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord1xOES)},
+  {"glProgramUniformMatrix4dv",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniformMatrix4dv)},
+  {"glGetnUniformiv",reinterpret_cast<FUNCTION_POINTER>(null_glGetnUniformiv)},
+  {"glFramebufferTexture1DEXT",reinterpret_cast<FUNCTION_POINTER>(null_glFramebufferTexture1DEXT)},
+  {"glVertexPointervINTEL",reinterpret_cast<FUNCTION_POINTER>(null_glVertexPointervINTEL)},
+  {"glTextureParameterIiv",reinterpret_cast<FUNCTION_POINTER>(null_glTextureParameterIiv)},
+  {"glGetSeparableFilterEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetSeparableFilterEXT)},
+  {"glMultiTexCoord3iARB",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord3iARB)},
+  {"glRasterPos4xvOES",reinterpret_cast<FUNCTION_POINTER>(null_glRasterPos4xvOES)},
+  {"glDrawTransformFeedbackStream",reinterpret_cast<FUNCTION_POINTER>(null_glDrawTransformFeedbackStream)},
+  {"glVertex3hvNV",reinterpret_cast<FUNCTION_POINTER>(null_glVertex3hvNV)},
+  {"glVertexArrayMultiTexCoordOffsetEXT",reinterpret_cast<FUNCTION_POINTER>(null_glVertexArrayMultiTexCoordOffsetEXT)},
+  {"glProvokingVertex",reinterpret_cast<FUNCTION_POINTER>(null_glProvokingVertex)},
+  {"glAccumxOES",reinterpret_cast<FUNCTION_POINTER>(null_glAccumxOES)},
+  {"glShaderBinary",reinterpret_cast<FUNCTION_POINTER>(null_glShaderBinary)},
+  {"glGetMultiTexGenivEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetMultiTexGenivEXT)},
+  {"glPointParameterxvOES",reinterpret_cast<FUNCTION_POINTER>(null_glPointParameterxvOES)},
+  {"glCreateStatesNV",reinterpret_cast<FUNCTION_POINTER>(null_glCreateStatesNV)},
+  {"glClearDepthdNV",reinterpret_cast<FUNCTION_POINTER>(null_glClearDepthdNV)},
+  {"glClearColorIuiEXT",reinterpret_cast<FUNCTION_POINTER>(null_glClearColorIuiEXT)},
+  {"glBindMultiTextureEXT",reinterpret_cast<FUNCTION_POINTER>(null_glBindMultiTextureEXT)},
+  {"glTexGeniv",reinterpret_cast<FUNCTION_POINTER>(null_glTexGeniv)},
+  {"glDrawElements",reinterpret_cast<FUNCTION_POINTER>(null_glDrawElements)},
+  {"glProgramUniform4iv",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform4iv)},
+  {"glDisableVertexArrayEXT",reinterpret_cast<FUNCTION_POINTER>(null_glDisableVertexArrayEXT)},
+  {"glProgramUniform3ui64NV",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform3ui64NV)},
+  {"glClientActiveTexture",reinterpret_cast<FUNCTION_POINTER>(null_glClientActiveTexture)},
+  {"glMultiTexParameterIivEXT",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexParameterIivEXT)},
+  {"glUniform1i64ARB",reinterpret_cast<FUNCTION_POINTER>(null_glUniform1i64ARB)},
+  {"glUniform1iv",reinterpret_cast<FUNCTION_POINTER>(null_glUniform1iv)},
+  {"glVertexAttribArrayObjectATI",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribArrayObjectATI)},
+  {"glUniform2iARB",reinterpret_cast<FUNCTION_POINTER>(null_glUniform2iARB)},
+  {"glDrawArraysInstanced",reinterpret_cast<FUNCTION_POINTER>(null_glDrawArraysInstanced)},
+  {"glVertexAttrib2sNV",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib2sNV)},
+  {"glTexBufferEXT",reinterpret_cast<FUNCTION_POINTER>(null_glTexBufferEXT)},
+  {"glVertexStream2fATI",reinterpret_cast<FUNCTION_POINTER>(null_glVertexStream2fATI)},
+  {"glDebugMessageCallbackAMD",reinterpret_cast<FUNCTION_POINTER>(null_glDebugMessageCallbackAMD)},
+  {"glSamplerParameteriv",reinterpret_cast<FUNCTION_POINTER>(null_glSamplerParameteriv)},
+  {"glVertexAttrib4uiv",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib4uiv)},
+  {"glEndQueryIndexed",reinterpret_cast<FUNCTION_POINTER>(null_glEndQueryIndexed)},
+  {"glNormalStream3sATI",reinterpret_cast<FUNCTION_POINTER>(null_glNormalStream3sATI)},
+  {"glProgramParameteriARB",reinterpret_cast<FUNCTION_POINTER>(null_glProgramParameteriARB)},
+  {"glTexEnvxOES",reinterpret_cast<FUNCTION_POINTER>(null_glTexEnvxOES)},
+  {"glProgramUniform1iv",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform1iv)},
+  {"glDisableVertexAttribAPPLE",reinterpret_cast<FUNCTION_POINTER>(null_glDisableVertexAttribAPPLE)},
+  {"glBindRenderbuffer",reinterpret_cast<FUNCTION_POINTER>(null_glBindRenderbuffer)},
+  {"glMultiTexSubImage3DEXT",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexSubImage3DEXT)},
+  {"glIsProgram",reinterpret_cast<FUNCTION_POINTER>(null_glIsProgram)},
+  {"glMultiDrawElementsIndirectAMD",reinterpret_cast<FUNCTION_POINTER>(null_glMultiDrawElementsIndirectAMD)},
+  {"glGetProgramInfoLog",reinterpret_cast<FUNCTION_POINTER>(null_glGetProgramInfoLog)},
+  {"glGetLocalConstantBooleanvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetLocalConstantBooleanvEXT)},
+  {"glPixelTransformParameteriEXT",reinterpret_cast<FUNCTION_POINTER>(null_glPixelTransformParameteriEXT)},
+  {"glTexCoord4bOES",reinterpret_cast<FUNCTION_POINTER>(null_glTexCoord4bOES)},
+  {"glVertexAttrib4fv",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib4fv)},
+  {"glProgramUniformMatrix2x3dv",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniformMatrix2x3dv)},
+  {"glProgramEnvParametersI4uivNV",reinterpret_cast<FUNCTION_POINTER>(null_glProgramEnvParametersI4uivNV)},
+  {"glTexCoord3xOES",reinterpret_cast<FUNCTION_POINTER>(null_glTexCoord3xOES)},
+  {"glLoadTransposeMatrixfARB",reinterpret_cast<FUNCTION_POINTER>(null_glLoadTransposeMatrixfARB)},
+  {"glImageTransformParameteriHP",reinterpret_cast<FUNCTION_POINTER>(null_glImageTransformParameteriHP)},
+  {"glMultiTexCoord4xOES",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord4xOES)},
+  {"glVertexAttribs3fvNV",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribs3fvNV)},
+  {"glVertexAttrib2fv",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib2fv)},
+  {"glUniform3ui64NV",reinterpret_cast<FUNCTION_POINTER>(null_glUniform3ui64NV)},
+  {"glCombinerParameterfvNV",reinterpret_cast<FUNCTION_POINTER>(null_glCombinerParameterfvNV)},
+  {"glFragmentMaterialiSGIX",reinterpret_cast<FUNCTION_POINTER>(null_glFragmentMaterialiSGIX)},
+  {"glGetBooleani_v",reinterpret_cast<FUNCTION_POINTER>(null_glGetBooleani_v)},
+  {"glGetProgramResourceIndex",reinterpret_cast<FUNCTION_POINTER>(null_glGetProgramResourceIndex)},
+  {"glBeginConditionalRenderNV",reinterpret_cast<FUNCTION_POINTER>(null_glBeginConditionalRenderNV)},
+  {"glDisableClientState",reinterpret_cast<FUNCTION_POINTER>(null_glDisableClientState)},
+  {"glPathFogGenNV",reinterpret_cast<FUNCTION_POINTER>(null_glPathFogGenNV)},
+  {"glStencilThenCoverFillPathNV",reinterpret_cast<FUNCTION_POINTER>(null_glStencilThenCoverFillPathNV)},
+  {"glVertexArrayIndexOffsetEXT",reinterpret_cast<FUNCTION_POINTER>(null_glVertexArrayIndexOffsetEXT)},
+  {"glProgramBufferParametersIuivNV",reinterpret_cast<FUNCTION_POINTER>(null_glProgramBufferParametersIuivNV)},
+  {"glPixelTransformParameterivEXT",reinterpret_cast<FUNCTION_POINTER>(null_glPixelTransformParameterivEXT)},
+  {"glDisableClientStateiEXT",reinterpret_cast<FUNCTION_POINTER>(null_glDisableClientStateiEXT)},
+  {"glTexBufferARB",reinterpret_cast<FUNCTION_POINTER>(null_glTexBufferARB)},
+  {"glGetLocalConstantIntegervEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetLocalConstantIntegervEXT)},
+  {"glColor4uiv",reinterpret_cast<FUNCTION_POINTER>(null_glColor4uiv)},
+  {"glProgramUniform3i",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform3i)},
+  {"glMultiDrawElementsIndirectBindlessCountNV",reinterpret_cast<FUNCTION_POINTER>(null_glMultiDrawElementsIndirectBindlessCountNV)},
+  {"glGetBufferPointervARB",reinterpret_cast<FUNCTION_POINTER>(null_glGetBufferPointervARB)},
+  {"glMultiTexParameterIuivEXT",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexParameterIuivEXT)},
+  {"glEvalMesh2",reinterpret_cast<FUNCTION_POINTER>(null_glEvalMesh2)},
+  {"glEvalMesh1",reinterpret_cast<FUNCTION_POINTER>(null_glEvalMesh1)},
+  {"glProgramUniform3f",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform3f)},
+  {"glStencilThenCoverFillPathInstancedNV",reinterpret_cast<FUNCTION_POINTER>(null_glStencilThenCoverFillPathInstancedNV)},
+  {"glProgramUniform3d",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform3d)},
+  {"glMapVertexAttrib1dAPPLE",reinterpret_cast<FUNCTION_POINTER>(null_glMapVertexAttrib1dAPPLE)},
+  {"glEvalCoord2fv",reinterpret_cast<FUNCTION_POINTER>(null_glEvalCoord2fv)},
+  {"glGetUniformivARB",reinterpret_cast<FUNCTION_POINTER>(null_glGetUniformivARB)},
+  {"glLoadTransposeMatrixd",reinterpret_cast<FUNCTION_POINTER>(null_glLoadTransposeMatrixd)},
+  {"glLoadTransposeMatrixf",reinterpret_cast<FUNCTION_POINTER>(null_glLoadTransposeMatrixf)},
+  {"glGetPointervEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetPointervEXT)},
+  {"glEndConditionalRenderNV",reinterpret_cast<FUNCTION_POINTER>(null_glEndConditionalRenderNV)},
+  {"glTexCoord2fNormal3fVertex3fSUN",reinterpret_cast<FUNCTION_POINTER>(null_glTexCoord2fNormal3fVertex3fSUN)},
+  {"glUniform3i64vARB",reinterpret_cast<FUNCTION_POINTER>(null_glUniform3i64vARB)},
+  {"glProgramUniform2uiEXT",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform2uiEXT)},
+  {"glVertexAttribI1ui",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribI1ui)},
+  {"glProgramNamedParameter4dvNV",reinterpret_cast<FUNCTION_POINTER>(null_glProgramNamedParameter4dvNV)},
+  {"glCompileCommandListNV",reinterpret_cast<FUNCTION_POINTER>(null_glCompileCommandListNV)},
+  {"glGetRenderbufferParameterivEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetRenderbufferParameterivEXT)},
+  {"glGetnPolygonStipple",reinterpret_cast<FUNCTION_POINTER>(null_glGetnPolygonStipple)},
+  {"glIsBufferResidentNV",reinterpret_cast<FUNCTION_POINTER>(null_glIsBufferResidentNV)},
+  {"glSecondaryColor3ubvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glSecondaryColor3ubvEXT)},
+  {"glGetNamedRenderbufferParameterivEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetNamedRenderbufferParameterivEXT)},
+  {"glNamedFramebufferSampleLocationsfvARB",reinterpret_cast<FUNCTION_POINTER>(null_glNamedFramebufferSampleLocationsfvARB)},
+  {"glMultiTexGendvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexGendvEXT)},
+  {"glVertexArrayRangeNV",reinterpret_cast<FUNCTION_POINTER>(null_glVertexArrayRangeNV)},
+  {"glIsTextureHandleResidentNV",reinterpret_cast<FUNCTION_POINTER>(null_glIsTextureHandleResidentNV)},
+  {"glGetProgramEnvParameterdvARB",reinterpret_cast<FUNCTION_POINTER>(null_glGetProgramEnvParameterdvARB)},
+  {"glIsNamedStringARB",reinterpret_cast<FUNCTION_POINTER>(null_glIsNamedStringARB)},
+  {"glSecondaryColorFormatNV",reinterpret_cast<FUNCTION_POINTER>(null_glSecondaryColorFormatNV)},
+  {"glVertexAttrib4ubvNV",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib4ubvNV)},
+  {"glTagSampleBufferSGIX",reinterpret_cast<FUNCTION_POINTER>(null_glTagSampleBufferSGIX)},
+  {"glVDPAUUnregisterSurfaceNV",reinterpret_cast<FUNCTION_POINTER>(null_glVDPAUUnregisterSurfaceNV)},
+  {"glGetPerfQueryIdByNameINTEL",reinterpret_cast<FUNCTION_POINTER>(null_glGetPerfQueryIdByNameINTEL)},
+  {"glGetInteger64v",reinterpret_cast<FUNCTION_POINTER>(null_glGetInteger64v)},
+  {"glClipPlane",reinterpret_cast<FUNCTION_POINTER>(null_glClipPlane)},
+  {"glColor4ubVertex3fSUN",reinterpret_cast<FUNCTION_POINTER>(null_glColor4ubVertex3fSUN)},
+  {"glIndexub",reinterpret_cast<FUNCTION_POINTER>(null_glIndexub)},
+  {"glGetProgramEnvParameterfvARB",reinterpret_cast<FUNCTION_POINTER>(null_glGetProgramEnvParameterfvARB)},
+  {"glVertexAttrib4usvARB",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib4usvARB)},
+  {"glNamedFramebufferRenderbuffer",reinterpret_cast<FUNCTION_POINTER>(null_glNamedFramebufferRenderbuffer)},
+  {"glProgramUniformMatrix3x4dv",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniformMatrix3x4dv)},
+  {"glTestFenceAPPLE",reinterpret_cast<FUNCTION_POINTER>(null_glTestFenceAPPLE)},
+  {"glVertexAttrib4Niv",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib4Niv)},
+  {"glVertexAttribL2i64vNV",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribL2i64vNV)},
+  {"glColorP4uiv",reinterpret_cast<FUNCTION_POINTER>(null_glColorP4uiv)},
+  {"glUniformMatrix2x3fv",reinterpret_cast<FUNCTION_POINTER>(null_glUniformMatrix2x3fv)},
+  {"glCallCommandListNV",reinterpret_cast<FUNCTION_POINTER>(null_glCallCommandListNV)},
+  {"glClearBufferiv",reinterpret_cast<FUNCTION_POINTER>(null_glClearBufferiv)},
+  {"glNamedStringARB",reinterpret_cast<FUNCTION_POINTER>(null_glNamedStringARB)},
+  {"glMatrixMult3x2fNV",reinterpret_cast<FUNCTION_POINTER>(null_glMatrixMult3x2fNV)},
+  {"glGetNamedProgramStringEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetNamedProgramStringEXT)},
+  {"glGetnHistogramARB",reinterpret_cast<FUNCTION_POINTER>(null_glGetnHistogramARB)},
+  {"glGetTextureLevelParameterfv",reinterpret_cast<FUNCTION_POINTER>(null_glGetTextureLevelParameterfv)},
+  {"glMultiTexCoord1fv",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord1fv)},
+  {"glBitmapxOES",reinterpret_cast<FUNCTION_POINTER>(null_glBitmapxOES)},
+  {"glGetSamplerParameterIuiv",reinterpret_cast<FUNCTION_POINTER>(null_glGetSamplerParameterIuiv)},
+  {"glTexCoordP3ui",reinterpret_cast<FUNCTION_POINTER>(null_glTexCoordP3ui)},
+  {"glTextureSubImage1D",reinterpret_cast<FUNCTION_POINTER>(null_glTextureSubImage1D)},
+  {"glVertexAttribLPointerEXT",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribLPointerEXT)},
+  {"glFogCoordPointerEXT",reinterpret_cast<FUNCTION_POINTER>(null_glFogCoordPointerEXT)},
+  {"glWindowPos3s",reinterpret_cast<FUNCTION_POINTER>(null_glWindowPos3s)},
+  {"glVertexAttribs2svNV",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribs2svNV)},
+  {"glTextureImage3DEXT",reinterpret_cast<FUNCTION_POINTER>(null_glTextureImage3DEXT)},
+  {"glWindowPos3i",reinterpret_cast<FUNCTION_POINTER>(null_glWindowPos3i)},
+  {"glWindowPos3d",reinterpret_cast<FUNCTION_POINTER>(null_glWindowPos3d)},
+  {"glWindowPos3f",reinterpret_cast<FUNCTION_POINTER>(null_glWindowPos3f)},
+  {"glIsEnabledIndexedEXT",reinterpret_cast<FUNCTION_POINTER>(null_glIsEnabledIndexedEXT)},
+  {"glGetNamedProgramivEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetNamedProgramivEXT)},
+  {"glVertex3xvOES",reinterpret_cast<FUNCTION_POINTER>(null_glVertex3xvOES)},
+  {"glColor3us",reinterpret_cast<FUNCTION_POINTER>(null_glColor3us)},
+  {"glBeginPerfMonitorAMD",reinterpret_cast<FUNCTION_POINTER>(null_glBeginPerfMonitorAMD)},
+  {"glProgramUniformMatrix4x3dv",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniformMatrix4x3dv)},
+  {"glGetNamedProgramLocalParameterIuivEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetNamedProgramLocalParameterIuivEXT)},
+  {"glReadnPixels",reinterpret_cast<FUNCTION_POINTER>(null_glReadnPixels)},
+  {"glMultiTexCoord4f",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord4f)},
+  {"glColor3ub",reinterpret_cast<FUNCTION_POINTER>(null_glColor3ub)},
+  {"glMultiTexCoord4d",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord4d)},
+  {"glVertexAttribL3ui64NV",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribL3ui64NV)},
+  {"glColor3ui",reinterpret_cast<FUNCTION_POINTER>(null_glColor3ui)},
+  {"glProgramUniform4fvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform4fvEXT)},
+  {"glVertexAttrib2sARB",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib2sARB)},
+  {"glMultiTexCoord4i",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord4i)},
+  {"glCheckFramebufferStatusEXT",reinterpret_cast<FUNCTION_POINTER>(null_glCheckFramebufferStatusEXT)},
+  {"glGetnMapivARB",reinterpret_cast<FUNCTION_POINTER>(null_glGetnMapivARB)},
+  {"glMultiTexCoord1ivARB",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord1ivARB)},
+  {"glDisableVertexAttribArrayARB",reinterpret_cast<FUNCTION_POINTER>(null_glDisableVertexAttribArrayARB)},
+  {"glGetPolygonStipple",reinterpret_cast<FUNCTION_POINTER>(null_glGetPolygonStipple)},
+  {"glVertexAttribI4ui",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribI4ui)},
+  {"glGetPathDashArrayNV",reinterpret_cast<FUNCTION_POINTER>(null_glGetPathDashArrayNV)},
+  {"glMultiTexRenderbufferEXT",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexRenderbufferEXT)},
+  {"glCopyTextureSubImage1D",reinterpret_cast<FUNCTION_POINTER>(null_glCopyTextureSubImage1D)},
+  {"glDeleteOcclusionQueriesNV",reinterpret_cast<FUNCTION_POINTER>(null_glDeleteOcclusionQueriesNV)},
+  {"glVertex4hvNV",reinterpret_cast<FUNCTION_POINTER>(null_glVertex4hvNV)},
+  {"glGetnTexImage",reinterpret_cast<FUNCTION_POINTER>(null_glGetnTexImage)},
+  {"glProgramLocalParameter4dARB",reinterpret_cast<FUNCTION_POINTER>(null_glProgramLocalParameter4dARB)},
+  {"glBlendEquation",reinterpret_cast<FUNCTION_POINTER>(null_glBlendEquation)},
+  {"glUnlockArraysEXT",reinterpret_cast<FUNCTION_POINTER>(null_glUnlockArraysEXT)},
+  {"glGetQueryObjectui64vEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetQueryObjectui64vEXT)},
+  {"glVertexAttribI4uivEXT",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribI4uivEXT)},
+  {"glUniform1i64vNV",reinterpret_cast<FUNCTION_POINTER>(null_glUniform1i64vNV)},
+  {"glMultiTexCoord3dv",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord3dv)},
+  {"glColor4sv",reinterpret_cast<FUNCTION_POINTER>(null_glColor4sv)},
+  {"glVertexStream4ivATI",reinterpret_cast<FUNCTION_POINTER>(null_glVertexStream4ivATI)},
+  {"glPopClientAttrib",reinterpret_cast<FUNCTION_POINTER>(null_glPopClientAttrib)},
+  {"glClearBufferData",reinterpret_cast<FUNCTION_POINTER>(null_glClearBufferData)},
+  {"glGetProgramivNV",reinterpret_cast<FUNCTION_POINTER>(null_glGetProgramivNV)},
+  {"glBeginTransformFeedback",reinterpret_cast<FUNCTION_POINTER>(null_glBeginTransformFeedback)},
+  {"glFinishObjectAPPLE",reinterpret_cast<FUNCTION_POINTER>(null_glFinishObjectAPPLE)},
+  {"glGetMinmaxParameterivEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetMinmaxParameterivEXT)},
+  {"glColor3iv",reinterpret_cast<FUNCTION_POINTER>(null_glColor3iv)},
+  {"glVertexAttrib3sv",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib3sv)},
+  {"glCompressedTexImage1D",reinterpret_cast<FUNCTION_POINTER>(null_glCompressedTexImage1D)},
+  {"glDeleteTransformFeedbacks",reinterpret_cast<FUNCTION_POINTER>(null_glDeleteTransformFeedbacks)},
+  {"glGetVideoi64vNV",reinterpret_cast<FUNCTION_POINTER>(null_glGetVideoi64vNV)},
+  {"glDrawRangeElementsBaseVertex",reinterpret_cast<FUNCTION_POINTER>(null_glDrawRangeElementsBaseVertex)},
+  {"glUniform4i64vARB",reinterpret_cast<FUNCTION_POINTER>(null_glUniform4i64vARB)},
+  {"glTextureStorage3DMultisampleEXT",reinterpret_cast<FUNCTION_POINTER>(null_glTextureStorage3DMultisampleEXT)},
+  {"glGetTexParameterfv",reinterpret_cast<FUNCTION_POINTER>(null_glGetTexParameterfv)},
+  {"glProgramUniformui64vNV",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniformui64vNV)},
+  {"glCompressedMultiTexImage1DEXT",reinterpret_cast<FUNCTION_POINTER>(null_glCompressedMultiTexImage1DEXT)},
+  {"glProgramUniform2ivEXT",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform2ivEXT)},
+  {"glPushGroupMarkerEXT",reinterpret_cast<FUNCTION_POINTER>(null_glPushGroupMarkerEXT)},
+  {"glVertexAttrib1dv",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib1dv)},
+  {"glMatrixLoadIdentityEXT",reinterpret_cast<FUNCTION_POINTER>(null_glMatrixLoadIdentityEXT)},
+  {"glMultTransposeMatrixxOES",reinterpret_cast<FUNCTION_POINTER>(null_glMultTransposeMatrixxOES)},
+  {"glGetPixelMapxv",reinterpret_cast<FUNCTION_POINTER>(null_glGetPixelMapxv)},
+  {"glFramebufferSampleLocationsfvARB",reinterpret_cast<FUNCTION_POINTER>(null_glFramebufferSampleLocationsfvARB)},
+  {"glGetLightiv",reinterpret_cast<FUNCTION_POINTER>(null_glGetLightiv)},
+  {"glBlendFuncSeparatei",reinterpret_cast<FUNCTION_POINTER>(null_glBlendFuncSeparatei)},
+  {"glGetBooleanIndexedvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetBooleanIndexedvEXT)},
+  {"glGetProgramSubroutineParameteruivNV",reinterpret_cast<FUNCTION_POINTER>(null_glGetProgramSubroutineParameteruivNV)},
+  {"glUniform2ui",reinterpret_cast<FUNCTION_POINTER>(null_glUniform2ui)},
+  {"glApplyFramebufferAttachmentCMAAINTEL",reinterpret_cast<FUNCTION_POINTER>(null_glApplyFramebufferAttachmentCMAAINTEL)},
+  {"glWindowPos2fv",reinterpret_cast<FUNCTION_POINTER>(null_glWindowPos2fv)},
+  {"glDisablei",reinterpret_cast<FUNCTION_POINTER>(null_glDisablei)},
+  {"glSelectPerfMonitorCountersAMD",reinterpret_cast<FUNCTION_POINTER>(null_glSelectPerfMonitorCountersAMD)},
+  {"glGetVertexAttribLi64vNV",reinterpret_cast<FUNCTION_POINTER>(null_glGetVertexAttribLi64vNV)},
+  {"glBlendFuncSeparateiARB",reinterpret_cast<FUNCTION_POINTER>(null_glBlendFuncSeparateiARB)},
+  {"glWeightuivARB",reinterpret_cast<FUNCTION_POINTER>(null_glWeightuivARB)},
+  {"glWindowPos2iARB",reinterpret_cast<FUNCTION_POINTER>(null_glWindowPos2iARB)},
+  {"glGetProgramLocalParameterdvARB",reinterpret_cast<FUNCTION_POINTER>(null_glGetProgramLocalParameterdvARB)},
+  {"glGetUniformui64vARB",reinterpret_cast<FUNCTION_POINTER>(null_glGetUniformui64vARB)},
+  {"glGetSynciv",reinterpret_cast<FUNCTION_POINTER>(null_glGetSynciv)},
+  {"glMakeImageHandleResidentARB",reinterpret_cast<FUNCTION_POINTER>(null_glMakeImageHandleResidentARB)},
+  {"glGetProgramNamedParameterfvNV",reinterpret_cast<FUNCTION_POINTER>(null_glGetProgramNamedParameterfvNV)},
+  {"glTextureStorage3D",reinterpret_cast<FUNCTION_POINTER>(null_glTextureStorage3D)},
+  {"glVertexAttrib4svNV",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib4svNV)},
+  {"glProgramUniform2i",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform2i)},
+  {"glListDrawCommandsStatesClientNV",reinterpret_cast<FUNCTION_POINTER>(null_glListDrawCommandsStatesClientNV)},
+  {"glProgramLocalParametersI4uivNV",reinterpret_cast<FUNCTION_POINTER>(null_glProgramLocalParametersI4uivNV)},
+  {"glBeginTransformFeedbackNV",reinterpret_cast<FUNCTION_POINTER>(null_glBeginTransformFeedbackNV)},
+  {"glGetProgramBinary",reinterpret_cast<FUNCTION_POINTER>(null_glGetProgramBinary)},
+  {"glBinormal3iEXT",reinterpret_cast<FUNCTION_POINTER>(null_glBinormal3iEXT)},
+  {"glEvalPoint1",reinterpret_cast<FUNCTION_POINTER>(null_glEvalPoint1)},
+  {"glEvalPoint2",reinterpret_cast<FUNCTION_POINTER>(null_glEvalPoint2)},
+  {"glPauseTransformFeedback",reinterpret_cast<FUNCTION_POINTER>(null_glPauseTransformFeedback)},
+  {"glWindowPos2sMESA",reinterpret_cast<FUNCTION_POINTER>(null_glWindowPos2sMESA)},
+  {"glGlobalAlphaFactorbSUN",reinterpret_cast<FUNCTION_POINTER>(null_glGlobalAlphaFactorbSUN)},
+  {"glCreateTransformFeedbacks",reinterpret_cast<FUNCTION_POINTER>(null_glCreateTransformFeedbacks)},
+  {"glTexturePageCommitmentEXT",reinterpret_cast<FUNCTION_POINTER>(null_glTexturePageCommitmentEXT)},
+  {"glTransformFeedbackVaryingsNV",reinterpret_cast<FUNCTION_POINTER>(null_glTransformFeedbackVaryingsNV)},
+  {"glTexSubImage1D",reinterpret_cast<FUNCTION_POINTER>(null_glTexSubImage1D)},
+  {"glConvolutionParameterfvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glConvolutionParameterfvEXT)},
+  {"glBlitFramebufferEXT",reinterpret_cast<FUNCTION_POINTER>(null_glBlitFramebufferEXT)},
+  {"glUniformMatrix4fvARB",reinterpret_cast<FUNCTION_POINTER>(null_glUniformMatrix4fvARB)},
+  {"glProgramEnvParameter4dvARB",reinterpret_cast<FUNCTION_POINTER>(null_glProgramEnvParameter4dvARB)},
+  {"glSecondaryColor3hNV",reinterpret_cast<FUNCTION_POINTER>(null_glSecondaryColor3hNV)},
+  {"glVertexAttribP3uiv",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribP3uiv)},
+  {"glFogCoordFormatNV",reinterpret_cast<FUNCTION_POINTER>(null_glFogCoordFormatNV)},
+  {"glGetMultiTexLevelParameterivEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetMultiTexLevelParameterivEXT)},
+  {"glIsOcclusionQueryNV",reinterpret_cast<FUNCTION_POINTER>(null_glIsOcclusionQueryNV)},
+  {"glCompressedTexImage2DARB",reinterpret_cast<FUNCTION_POINTER>(null_glCompressedTexImage2DARB)},
+  {"glGetProgramEnvParameterIuivNV",reinterpret_cast<FUNCTION_POINTER>(null_glGetProgramEnvParameterIuivNV)},
+  {"glVertexAttrib4sv",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib4sv)},
+  {"glVertexAttrib4fvARB",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib4fvARB)},
+  {"glLoadName",reinterpret_cast<FUNCTION_POINTER>(null_glLoadName)},
+  {"glBindVertexShaderEXT",reinterpret_cast<FUNCTION_POINTER>(null_glBindVertexShaderEXT)},
+  {"glGetNamedProgramLocalParameterIivEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetNamedProgramLocalParameterIivEXT)},
+  {"glProgramUniform3uiEXT",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform3uiEXT)},
+  {"glProgramUniformMatrix4x2dvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniformMatrix4x2dvEXT)},
+  {"glTexCoord1hvNV",reinterpret_cast<FUNCTION_POINTER>(null_glTexCoord1hvNV)},
+  {"glLoadMatrixd",reinterpret_cast<FUNCTION_POINTER>(null_glLoadMatrixd)},
+  {"glTexParameterfv",reinterpret_cast<FUNCTION_POINTER>(null_glTexParameterfv)},
+  {"glVariantdvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glVariantdvEXT)},
+  {"glCullParameterfvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glCullParameterfvEXT)},
+  {"glUniform3dv",reinterpret_cast<FUNCTION_POINTER>(null_glUniform3dv)},
+  {"glProgramUniform3fv",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform3fv)},
+  {"glIsBufferARB",reinterpret_cast<FUNCTION_POINTER>(null_glIsBufferARB)},
+  {"glMultiTexCoord1bOES",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord1bOES)},
+  {"glFogCoordhNV",reinterpret_cast<FUNCTION_POINTER>(null_glFogCoordhNV)},
+  {"glFramebufferSampleLocationsfvNV",reinterpret_cast<FUNCTION_POINTER>(null_glFramebufferSampleLocationsfvNV)},
+  {"glGenSymbolsEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGenSymbolsEXT)},
+  {"glGetConvolutionFilter",reinterpret_cast<FUNCTION_POINTER>(null_glGetConvolutionFilter)},
+  {"glProgramUniform1fvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform1fvEXT)},
+  {"glGetNextPerfQueryIdINTEL",reinterpret_cast<FUNCTION_POINTER>(null_glGetNextPerfQueryIdINTEL)},
+  {"glCompressedTexImage1DARB",reinterpret_cast<FUNCTION_POINTER>(null_glCompressedTexImage1DARB)},
+  {"glBindSamplers",reinterpret_cast<FUNCTION_POINTER>(null_glBindSamplers)},
+  {"glGetProgramEnvParameterIivNV",reinterpret_cast<FUNCTION_POINTER>(null_glGetProgramEnvParameterIivNV)},
+  {"glGetQueryObjectui64v",reinterpret_cast<FUNCTION_POINTER>(null_glGetQueryObjectui64v)},
+  {"glVertexAttribL4ui64vNV",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribL4ui64vNV)},
+  {"glGetVideoivNV",reinterpret_cast<FUNCTION_POINTER>(null_glGetVideoivNV)},
+  {"glGetTextureImage",reinterpret_cast<FUNCTION_POINTER>(null_glGetTextureImage)},
+  {"glProgramUniform1fv",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform1fv)},
+  {"glUniformMatrix4fv",reinterpret_cast<FUNCTION_POINTER>(null_glUniformMatrix4fv)},
+  {"glColorMask",reinterpret_cast<FUNCTION_POINTER>(null_glColorMask)},
+  {"glBeginFragmentShaderATI",reinterpret_cast<FUNCTION_POINTER>(null_glBeginFragmentShaderATI)},
+  {"glMultiDrawArraysEXT",reinterpret_cast<FUNCTION_POINTER>(null_glMultiDrawArraysEXT)},
+  {"glGenNamesAMD",reinterpret_cast<FUNCTION_POINTER>(null_glGenNamesAMD)},
+  {"glPathParameteriNV",reinterpret_cast<FUNCTION_POINTER>(null_glPathParameteriNV)},
+  {"glCreateCommandListsNV",reinterpret_cast<FUNCTION_POINTER>(null_glCreateCommandListsNV)},
+  {"glDeleteProgramPipelines",reinterpret_cast<FUNCTION_POINTER>(null_glDeleteProgramPipelines)},
+  {"glCopyColorSubTableEXT",reinterpret_cast<FUNCTION_POINTER>(null_glCopyColorSubTableEXT)},
+  {"glVariantsvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glVariantsvEXT)},
+  {"glGenProgramPipelines",reinterpret_cast<FUNCTION_POINTER>(null_glGenProgramPipelines)},
+  {"glVertexArrayEdgeFlagOffsetEXT",reinterpret_cast<FUNCTION_POINTER>(null_glVertexArrayEdgeFlagOffsetEXT)},
+  {"glWindowPos2s",reinterpret_cast<FUNCTION_POINTER>(null_glWindowPos2s)},
+  {"glSecondaryColor3iEXT",reinterpret_cast<FUNCTION_POINTER>(null_glSecondaryColor3iEXT)},
+  {"glWindowPos2i",reinterpret_cast<FUNCTION_POINTER>(null_glWindowPos2i)},
+  {"glWindowPos2f",reinterpret_cast<FUNCTION_POINTER>(null_glWindowPos2f)},
+  {"glWindowPos2d",reinterpret_cast<FUNCTION_POINTER>(null_glWindowPos2d)},
+  {"glUniform4uivEXT",reinterpret_cast<FUNCTION_POINTER>(null_glUniform4uivEXT)},
+  {"glOrthoxOES",reinterpret_cast<FUNCTION_POINTER>(null_glOrthoxOES)},
+  {"glUniformSubroutinesuiv",reinterpret_cast<FUNCTION_POINTER>(null_glUniformSubroutinesuiv)},
+  {"glRectdv",reinterpret_cast<FUNCTION_POINTER>(null_glRectdv)},
+  {"glProgramUniform1i64vNV",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform1i64vNV)},
+  {"glVertexAttribI4uiEXT",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribI4uiEXT)},
+  {"glSecondaryColor3ubEXT",reinterpret_cast<FUNCTION_POINTER>(null_glSecondaryColor3ubEXT)},
+  {"glCompressedMultiTexSubImage1DEXT",reinterpret_cast<FUNCTION_POINTER>(null_glCompressedMultiTexSubImage1DEXT)},
+  {"glMultiTexGendEXT",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexGendEXT)},
+  {"glColorP3uiv",reinterpret_cast<FUNCTION_POINTER>(null_glColorP3uiv)},
+  {"glFogCoordfv",reinterpret_cast<FUNCTION_POINTER>(null_glFogCoordfv)},
+  {"glCompileShader",reinterpret_cast<FUNCTION_POINTER>(null_glCompileShader)},
+  {"glTexCoord2hNV",reinterpret_cast<FUNCTION_POINTER>(null_glTexCoord2hNV)},
+  {"glUniform1uivEXT",reinterpret_cast<FUNCTION_POINTER>(null_glUniform1uivEXT)},
+  {"glMatrixLoadTransposedEXT",reinterpret_cast<FUNCTION_POINTER>(null_glMatrixLoadTransposedEXT)},
+  {"glIndexfv",reinterpret_cast<FUNCTION_POINTER>(null_glIndexfv)},
+  {"glGetCompressedTextureImage",reinterpret_cast<FUNCTION_POINTER>(null_glGetCompressedTextureImage)},
+  {"glGetUniformuivEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetUniformuivEXT)},
+  {"glGetnPixelMapfvARB",reinterpret_cast<FUNCTION_POINTER>(null_glGetnPixelMapfvARB)},
+  {"glFramebufferTextureEXT",reinterpret_cast<FUNCTION_POINTER>(null_glFramebufferTextureEXT)},
+  {"glVertexAttribIPointer",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribIPointer)},
+  {"glMultiTexCoordP3ui",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoordP3ui)},
+  {"glEvaluateDepthValuesARB",reinterpret_cast<FUNCTION_POINTER>(null_glEvaluateDepthValuesARB)},
+  {"glGetNamedBufferParameteriv",reinterpret_cast<FUNCTION_POINTER>(null_glGetNamedBufferParameteriv)},
+  {"glGetNamedProgramLocalParameterfvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetNamedProgramLocalParameterfvEXT)},
+  {"glColor4fNormal3fVertex3fvSUN",reinterpret_cast<FUNCTION_POINTER>(null_glColor4fNormal3fVertex3fvSUN)},
+  {"glSeparableFilter2DEXT",reinterpret_cast<FUNCTION_POINTER>(null_glSeparableFilter2DEXT)},
+  {"glTexParameterxOES",reinterpret_cast<FUNCTION_POINTER>(null_glTexParameterxOES)},
+  {"glClearAccumxOES",reinterpret_cast<FUNCTION_POINTER>(null_glClearAccumxOES)},
+  {"glInvalidateFramebuffer",reinterpret_cast<FUNCTION_POINTER>(null_glInvalidateFramebuffer)},
+  {"glWeightubvARB",reinterpret_cast<FUNCTION_POINTER>(null_glWeightubvARB)},
+  {"glVertexAttrib1d",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib1d)},
+  {"glVertexAttrib1f",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib1f)},
+  {"glVertex4fv",reinterpret_cast<FUNCTION_POINTER>(null_glVertex4fv)},
+  {"glClearNamedFramebufferfi",reinterpret_cast<FUNCTION_POINTER>(null_glClearNamedFramebufferfi)},
+  {"glGetQueryBufferObjectuiv",reinterpret_cast<FUNCTION_POINTER>(null_glGetQueryBufferObjectuiv)},
+  {"glClearNamedFramebufferfv",reinterpret_cast<FUNCTION_POINTER>(null_glClearNamedFramebufferfv)},
+  {"glEndVertexShaderEXT",reinterpret_cast<FUNCTION_POINTER>(null_glEndVertexShaderEXT)},
+  {"glVertexAttrib1s",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib1s)},
+  {"glMultiTexCoord4dvARB",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord4dvARB)},
+  {"glMultiTexCoord1sv",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord1sv)},
+  {"glUniform1ui64vNV",reinterpret_cast<FUNCTION_POINTER>(null_glUniform1ui64vNV)},
+  {"glGetClipPlanefOES",reinterpret_cast<FUNCTION_POINTER>(null_glGetClipPlanefOES)},
+  {"glRasterPos2s",reinterpret_cast<FUNCTION_POINTER>(null_glRasterPos2s)},
+  {"glWeightivARB",reinterpret_cast<FUNCTION_POINTER>(null_glWeightivARB)},
+  {"glMultiTexCoord4hvNV",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord4hvNV)},
+  {"glNormal3hNV",reinterpret_cast<FUNCTION_POINTER>(null_glNormal3hNV)},
+  {"glGetSeparableFilter",reinterpret_cast<FUNCTION_POINTER>(null_glGetSeparableFilter)},
+  {"glGetPathTexGenivNV",reinterpret_cast<FUNCTION_POINTER>(null_glGetPathTexGenivNV)},
+  {"glColor4bv",reinterpret_cast<FUNCTION_POINTER>(null_glColor4bv)},
+  {"glRasterPos2f",reinterpret_cast<FUNCTION_POINTER>(null_glRasterPos2f)},
+  {"glNamedBufferPageCommitmentARB",reinterpret_cast<FUNCTION_POINTER>(null_glNamedBufferPageCommitmentARB)},
+  {"glLoadIdentity",reinterpret_cast<FUNCTION_POINTER>(null_glLoadIdentity)},
+  {"glRasterPos2i",reinterpret_cast<FUNCTION_POINTER>(null_glRasterPos2i)},
+  {"glRasterPos4iv",reinterpret_cast<FUNCTION_POINTER>(null_glRasterPos4iv)},
+  {"glMultiTexCoord2fvARB",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord2fvARB)},
+  {"glUniformMatrix4x3fv",reinterpret_cast<FUNCTION_POINTER>(null_glUniformMatrix4x3fv)},
+  {"glClearBufferfv",reinterpret_cast<FUNCTION_POINTER>(null_glClearBufferfv)},
+  {"glMultiTexCoord4hNV",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord4hNV)},
+  {"glTextureBarrier",reinterpret_cast<FUNCTION_POINTER>(null_glTextureBarrier)},
+  {"glReplacementCodeuivSUN",reinterpret_cast<FUNCTION_POINTER>(null_glReplacementCodeuivSUN)},
+  {"glDeleteAsyncMarkersSGIX",reinterpret_cast<FUNCTION_POINTER>(null_glDeleteAsyncMarkersSGIX)},
+  {"glTexCoord2bvOES",reinterpret_cast<FUNCTION_POINTER>(null_glTexCoord2bvOES)},
+  {"glEvalCoord2xOES",reinterpret_cast<FUNCTION_POINTER>(null_glEvalCoord2xOES)},
+  {"glGetSharpenTexFuncSGIS",reinterpret_cast<FUNCTION_POINTER>(null_glGetSharpenTexFuncSGIS)},
+  {"glProgramUniformHandleui64vNV",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniformHandleui64vNV)},
+  {"glIglooInterfaceSGIX",reinterpret_cast<FUNCTION_POINTER>(null_glIglooInterfaceSGIX)},
+  {"glWindowPos2dvARB",reinterpret_cast<FUNCTION_POINTER>(null_glWindowPos2dvARB)},
+  {"glClearBufferfi",reinterpret_cast<FUNCTION_POINTER>(null_glClearBufferfi)},
+  {"glDrawArraysIndirect",reinterpret_cast<FUNCTION_POINTER>(null_glDrawArraysIndirect)},
+  {"glGenVertexArrays",reinterpret_cast<FUNCTION_POINTER>(null_glGenVertexArrays)},
+  {"glGetTransformFeedbacki64_v",reinterpret_cast<FUNCTION_POINTER>(null_glGetTransformFeedbacki64_v)},
+  {"glEnableVertexArrayAttrib",reinterpret_cast<FUNCTION_POINTER>(null_glEnableVertexArrayAttrib)},
+  {"glProgramUniformMatrix3x2dv",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniformMatrix3x2dv)},
+  {"glVertexStream4fATI",reinterpret_cast<FUNCTION_POINTER>(null_glVertexStream4fATI)},
+  {"glVertexBindingDivisor",reinterpret_cast<FUNCTION_POINTER>(null_glVertexBindingDivisor)},
+  {"glGetSamplerParameterIiv",reinterpret_cast<FUNCTION_POINTER>(null_glGetSamplerParameterIiv)},
+  {"glGetCoverageModulationTableNV",reinterpret_cast<FUNCTION_POINTER>(null_glGetCoverageModulationTableNV)},
+  {"glDepthRangedNV",reinterpret_cast<FUNCTION_POINTER>(null_glDepthRangedNV)},
+  {"glVertexAttrib3f",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib3f)},
+  {"glMultiDrawRangeElementArrayAPPLE",reinterpret_cast<FUNCTION_POINTER>(null_glMultiDrawRangeElementArrayAPPLE)},
+  {"glVertexAttribFormatNV",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribFormatNV)},
+  {"glGetQueryBufferObjecti64v",reinterpret_cast<FUNCTION_POINTER>(null_glGetQueryBufferObjecti64v)},
+  {"glGetVertexAttribdv",reinterpret_cast<FUNCTION_POINTER>(null_glGetVertexAttribdv)},
+  {"glGetUniformi64vARB",reinterpret_cast<FUNCTION_POINTER>(null_glGetUniformi64vARB)},
+  {"glAreTexturesResidentEXT",reinterpret_cast<FUNCTION_POINTER>(null_glAreTexturesResidentEXT)},
+  {"glGetHandleARB",reinterpret_cast<FUNCTION_POINTER>(null_glGetHandleARB)},
+  {"glVideoCaptureStreamParameterdvNV",reinterpret_cast<FUNCTION_POINTER>(null_glVideoCaptureStreamParameterdvNV)},
+  {"glMapParameterivNV",reinterpret_cast<FUNCTION_POINTER>(null_glMapParameterivNV)},
+  {"glIsVertexArray",reinterpret_cast<FUNCTION_POINTER>(null_glIsVertexArray)},
+  {"glSecondaryColor3sEXT",reinterpret_cast<FUNCTION_POINTER>(null_glSecondaryColor3sEXT)},
+  {"glGetTexParameterIivEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetTexParameterIivEXT)},
+  {"glFrameTerminatorGREMEDY",reinterpret_cast<FUNCTION_POINTER>(null_glFrameTerminatorGREMEDY)},
+  {"glBlendBarrierKHR",reinterpret_cast<FUNCTION_POINTER>(null_glBlendBarrierKHR)},
+  {"glVertexAttrib4NubARB",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib4NubARB)},
+  {"glPrimitiveRestartNV",reinterpret_cast<FUNCTION_POINTER>(null_glPrimitiveRestartNV)},
+  {"glVertexAttribL1ui64vARB",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribL1ui64vARB)},
+  {"glVertexAttribI4ivEXT",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribI4ivEXT)},
+  {"glVertexAttribs4svNV",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribs4svNV)},
+  {"glUniform1ui",reinterpret_cast<FUNCTION_POINTER>(null_glUniform1ui)},
+  {"glVertexAttrib2fvARB",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib2fvARB)},
+  {"glVertexAttribI4svEXT",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribI4svEXT)},
+  {"glTextureImage3DMultisampleCoverageNV",reinterpret_cast<FUNCTION_POINTER>(null_glTextureImage3DMultisampleCoverageNV)},
+  {"glMemoryBarrier",reinterpret_cast<FUNCTION_POINTER>(null_glMemoryBarrier)},
+  {"glGetVariantArrayObjectfvATI",reinterpret_cast<FUNCTION_POINTER>(null_glGetVariantArrayObjectfvATI)},
+  {"glTexCoord4fColor4fNormal3fVertex4fvSUN",reinterpret_cast<FUNCTION_POINTER>(null_glTexCoord4fColor4fNormal3fVertex4fvSUN)},
+  {"glIsProgramARB",reinterpret_cast<FUNCTION_POINTER>(null_glIsProgramARB)},
+  {"glBindImageTextureEXT",reinterpret_cast<FUNCTION_POINTER>(null_glBindImageTextureEXT)},
+  {"glGetFragDataLocation",reinterpret_cast<FUNCTION_POINTER>(null_glGetFragDataLocation)},
+  {"glMultiTexCoord1svARB",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord1svARB)},
+  {"glGetMapxvOES",reinterpret_cast<FUNCTION_POINTER>(null_glGetMapxvOES)},
+  {"glTextureStorage2DMultisampleEXT",reinterpret_cast<FUNCTION_POINTER>(null_glTextureStorage2DMultisampleEXT)},
+  {"glGetMaterialfv",reinterpret_cast<FUNCTION_POINTER>(null_glGetMaterialfv)},
+  {"glVertexAttrib4NbvARB",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib4NbvARB)},
+  {"glPixelMapuiv",reinterpret_cast<FUNCTION_POINTER>(null_glPixelMapuiv)},
+  {"glColorPointerEXT",reinterpret_cast<FUNCTION_POINTER>(null_glColorPointerEXT)},
+  {"glEnableClientStateiEXT",reinterpret_cast<FUNCTION_POINTER>(null_glEnableClientStateiEXT)},
+  {"glClearTexSubImage",reinterpret_cast<FUNCTION_POINTER>(null_glClearTexSubImage)},
+  {"glEvalCoord1xvOES",reinterpret_cast<FUNCTION_POINTER>(null_glEvalCoord1xvOES)},
+  {"glDetachObjectARB",reinterpret_cast<FUNCTION_POINTER>(null_glDetachObjectARB)},
+  {"glGetTextureParameterIiv",reinterpret_cast<FUNCTION_POINTER>(null_glGetTextureParameterIiv)},
+  {"glVariantusvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glVariantusvEXT)},
+  {"glCompressedTextureImage3DEXT",reinterpret_cast<FUNCTION_POINTER>(null_glCompressedTextureImage3DEXT)},
+  {"glMultiTexCoord1dARB",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord1dARB)},
+  {"glGetVertexArrayIntegeri_vEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetVertexArrayIntegeri_vEXT)},
+  {"glVertexAttribI4ubv",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribI4ubv)},
+  {"glPixelTexGenParameterfSGIS",reinterpret_cast<FUNCTION_POINTER>(null_glPixelTexGenParameterfSGIS)},
+  {"glProgramUniformMatrix4x2dv",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniformMatrix4x2dv)},
+  {"glUniform3fARB",reinterpret_cast<FUNCTION_POINTER>(null_glUniform3fARB)},
+  {"glIsShader",reinterpret_cast<FUNCTION_POINTER>(null_glIsShader)},
+  {"glConvolutionParameteriv",reinterpret_cast<FUNCTION_POINTER>(null_glConvolutionParameteriv)},
+  {"glCopyMultiTexSubImage2DEXT",reinterpret_cast<FUNCTION_POINTER>(null_glCopyMultiTexSubImage2DEXT)},
+  {"glEnableVertexAttribArrayARB",reinterpret_cast<FUNCTION_POINTER>(null_glEnableVertexAttribArrayARB)},
+  {"glEnable",reinterpret_cast<FUNCTION_POINTER>(null_glEnable)},
+  {"glGetActiveUniformsiv",reinterpret_cast<FUNCTION_POINTER>(null_glGetActiveUniformsiv)},
+  {"glGetVertexAttribivARB",reinterpret_cast<FUNCTION_POINTER>(null_glGetVertexAttribivARB)},
+  {"glTexCoord4hvNV",reinterpret_cast<FUNCTION_POINTER>(null_glTexCoord4hvNV)},
+  {"glUseProgramObjectARB",reinterpret_cast<FUNCTION_POINTER>(null_glUseProgramObjectARB)},
+  {"glGetAttribLocation",reinterpret_cast<FUNCTION_POINTER>(null_glGetAttribLocation)},
+  {"glVertexAttrib4dv",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib4dv)},
+  {"glGetTextureParameteriv",reinterpret_cast<FUNCTION_POINTER>(null_glGetTextureParameteriv)},
+  {"glPathSubCoordsNV",reinterpret_cast<FUNCTION_POINTER>(null_glPathSubCoordsNV)},
+  {"glMatrixIndexusvARB",reinterpret_cast<FUNCTION_POINTER>(null_glMatrixIndexusvARB)},
+  {"glGetVideouivNV",reinterpret_cast<FUNCTION_POINTER>(null_glGetVideouivNV)},
+  {"glGetVideoCaptureivNV",reinterpret_cast<FUNCTION_POINTER>(null_glGetVideoCaptureivNV)},
+  {"glProgramUniform3ui",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform3ui)},
+  {"glVertexAttrib3svARB",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib3svARB)},
+  {"glGetNamedBufferParameterivEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetNamedBufferParameterivEXT)},
+  {"glMatrixScaledEXT",reinterpret_cast<FUNCTION_POINTER>(null_glMatrixScaledEXT)},
+  {"glProgramUniformMatrix2x3fv",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniformMatrix2x3fv)},
+  {"glGetFragmentLightivSGIX",reinterpret_cast<FUNCTION_POINTER>(null_glGetFragmentLightivSGIX)},
+  {"glWindowPos2svARB",reinterpret_cast<FUNCTION_POINTER>(null_glWindowPos2svARB)},
+  {"glVertexAttrib2svNV",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib2svNV)},
+  {"glWindowPos2ivARB",reinterpret_cast<FUNCTION_POINTER>(null_glWindowPos2ivARB)},
+  {"glGetVertexAttribPointervNV",reinterpret_cast<FUNCTION_POINTER>(null_glGetVertexAttribPointervNV)},
+  {"glPushMatrix",reinterpret_cast<FUNCTION_POINTER>(null_glPushMatrix)},
+  {"glEdgeFlagPointerListIBM",reinterpret_cast<FUNCTION_POINTER>(null_glEdgeFlagPointerListIBM)},
+  {"glGenerateMipmapEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGenerateMipmapEXT)},
+  {"glWindowPos3sv",reinterpret_cast<FUNCTION_POINTER>(null_glWindowPos3sv)},
+  {"glPathCoordsNV",reinterpret_cast<FUNCTION_POINTER>(null_glPathCoordsNV)},
+  {"glProgramUniform1i",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform1i)},
+  {"glProgramUniform1d",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform1d)},
+  {"glProgramUniform1f",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform1f)},
+  {"glProgramParameteriEXT",reinterpret_cast<FUNCTION_POINTER>(null_glProgramParameteriEXT)},
+  {"glCompressedMultiTexImage2DEXT",reinterpret_cast<FUNCTION_POINTER>(null_glCompressedMultiTexImage2DEXT)},
+  {"glProgramUniform3iv",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform3iv)},
+  {"glIndexiv",reinterpret_cast<FUNCTION_POINTER>(null_glIndexiv)},
+  {"glMultiTexCoord4xvOES",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord4xvOES)},
+  {"glEGLImageTargetTexture2DOES",reinterpret_cast<FUNCTION_POINTER>(null_glEGLImageTargetTexture2DOES)},
+  {"glPixelZoom",reinterpret_cast<FUNCTION_POINTER>(null_glPixelZoom)},
+  {"glVertex3bvOES",reinterpret_cast<FUNCTION_POINTER>(null_glVertex3bvOES)},
+  {"glFramebufferReadBufferEXT",reinterpret_cast<FUNCTION_POINTER>(null_glFramebufferReadBufferEXT)},
+  {"glExtractComponentEXT",reinterpret_cast<FUNCTION_POINTER>(null_glExtractComponentEXT)},
+  {"glCombinerParameterivNV",reinterpret_cast<FUNCTION_POINTER>(null_glCombinerParameterivNV)},
+  {"glMinmax",reinterpret_cast<FUNCTION_POINTER>(null_glMinmax)},
+  {"glGenBuffersARB",reinterpret_cast<FUNCTION_POINTER>(null_glGenBuffersARB)},
+  {"glColor3usv",reinterpret_cast<FUNCTION_POINTER>(null_glColor3usv)},
+  {"glBlendEquationi",reinterpret_cast<FUNCTION_POINTER>(null_glBlendEquationi)},
+  {"glGetFogFuncSGIS",reinterpret_cast<FUNCTION_POINTER>(null_glGetFogFuncSGIS)},
+  {"glVertexAttrib4fvNV",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib4fvNV)},
+  {"glGetnMinmax",reinterpret_cast<FUNCTION_POINTER>(null_glGetnMinmax)},
+  {"glFragmentLightiSGIX",reinterpret_cast<FUNCTION_POINTER>(null_glFragmentLightiSGIX)},
+  {"glMultiTexCoord1bvOES",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord1bvOES)},
+  {"glSecondaryColorPointerEXT",reinterpret_cast<FUNCTION_POINTER>(null_glSecondaryColorPointerEXT)},
+  {"glMultiTexCoordP4uiv",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoordP4uiv)},
+  {"glGetBufferSubDataARB",reinterpret_cast<FUNCTION_POINTER>(null_glGetBufferSubDataARB)},
+  {"glGetPathParameterivNV",reinterpret_cast<FUNCTION_POINTER>(null_glGetPathParameterivNV)},
+  {"glFlushRasterSGIX",reinterpret_cast<FUNCTION_POINTER>(null_glFlushRasterSGIX)},
+  {"glElementPointerATI",reinterpret_cast<FUNCTION_POINTER>(null_glElementPointerATI)},
+  {"glGetAttachedObjectsARB",reinterpret_cast<FUNCTION_POINTER>(null_glGetAttachedObjectsARB)},
+  {"glUniform4iv",reinterpret_cast<FUNCTION_POINTER>(null_glUniform4iv)},
+  {"glFogxOES",reinterpret_cast<FUNCTION_POINTER>(null_glFogxOES)},
+  {"glSharpenTexFuncSGIS",reinterpret_cast<FUNCTION_POINTER>(null_glSharpenTexFuncSGIS)},
+  {"glClearDepthfOES",reinterpret_cast<FUNCTION_POINTER>(null_glClearDepthfOES)},
+  {"glDeleteCommandListsNV",reinterpret_cast<FUNCTION_POINTER>(null_glDeleteCommandListsNV)},
+  {"glVertex4hNV",reinterpret_cast<FUNCTION_POINTER>(null_glVertex4hNV)},
+  {"glSecondaryColor3dvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glSecondaryColor3dvEXT)},
+  {"glGenTextures",reinterpret_cast<FUNCTION_POINTER>(null_glGenTextures)},
+  {"glTextureStorage2DMultisample",reinterpret_cast<FUNCTION_POINTER>(null_glTextureStorage2DMultisample)},
+  {"glUniform3ui64vNV",reinterpret_cast<FUNCTION_POINTER>(null_glUniform3ui64vNV)},
+  {"glBlendFuncSeparateIndexedAMD",reinterpret_cast<FUNCTION_POINTER>(null_glBlendFuncSeparateIndexedAMD)},
+  {"glMakeBufferResidentNV",reinterpret_cast<FUNCTION_POINTER>(null_glMakeBufferResidentNV)},
+  {"glShaderOp2EXT",reinterpret_cast<FUNCTION_POINTER>(null_glShaderOp2EXT)},
+  {"glGetVertexAttribivNV",reinterpret_cast<FUNCTION_POINTER>(null_glGetVertexAttribivNV)},
+  {"glTexParameterIivEXT",reinterpret_cast<FUNCTION_POINTER>(null_glTexParameterIivEXT)},
+  {"glGetPerfQueryDataINTEL",reinterpret_cast<FUNCTION_POINTER>(null_glGetPerfQueryDataINTEL)},
+  {"glVertexAttrib4dvARB",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib4dvARB)},
+  {"glTextureSubImage1DEXT",reinterpret_cast<FUNCTION_POINTER>(null_glTextureSubImage1DEXT)},
+  {"glGetActiveUniformBlockName",reinterpret_cast<FUNCTION_POINTER>(null_glGetActiveUniformBlockName)},
+  {"glVertexAttrib2dvARB",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib2dvARB)},
+  {"glVertexAttribPointer",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribPointer)},
+  {"glDepthBoundsdNV",reinterpret_cast<FUNCTION_POINTER>(null_glDepthBoundsdNV)},
+  {"glDeleteTexturesEXT",reinterpret_cast<FUNCTION_POINTER>(null_glDeleteTexturesEXT)},
+  {"glDrawBuffersATI",reinterpret_cast<FUNCTION_POINTER>(null_glDrawBuffersATI)},
+  {"glLightModelxvOES",reinterpret_cast<FUNCTION_POINTER>(null_glLightModelxvOES)},
+  {"glApplyTextureEXT",reinterpret_cast<FUNCTION_POINTER>(null_glApplyTextureEXT)},
+  {"glGetImageHandleNV",reinterpret_cast<FUNCTION_POINTER>(null_glGetImageHandleNV)},
+  {"glGetMinmax",reinterpret_cast<FUNCTION_POINTER>(null_glGetMinmax)},
+  {"glGetFixedvOES",reinterpret_cast<FUNCTION_POINTER>(null_glGetFixedvOES)},
+  {"glSamplePatternEXT",reinterpret_cast<FUNCTION_POINTER>(null_glSamplePatternEXT)},
+  {"glUniform1f",reinterpret_cast<FUNCTION_POINTER>(null_glUniform1f)},
+  {"glColor4fNormal3fVertex3fSUN",reinterpret_cast<FUNCTION_POINTER>(null_glColor4fNormal3fVertex3fSUN)},
+  {"glFogCoorddvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glFogCoorddvEXT)},
+  {"glCopyTextureImage1DEXT",reinterpret_cast<FUNCTION_POINTER>(null_glCopyTextureImage1DEXT)},
+  {"glFlushMappedBufferRangeAPPLE",reinterpret_cast<FUNCTION_POINTER>(null_glFlushMappedBufferRangeAPPLE)},
+  {"glVertex3sv",reinterpret_cast<FUNCTION_POINTER>(null_glVertex3sv)},
+  {"glFlushStaticDataIBM",reinterpret_cast<FUNCTION_POINTER>(null_glFlushStaticDataIBM)},
+  {"glProgramUniform4ui64NV",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform4ui64NV)},
+  {"glRasterPos4xOES",reinterpret_cast<FUNCTION_POINTER>(null_glRasterPos4xOES)},
+  {"glVertexAttribP1ui",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribP1ui)},
+  {"glProgramUniform4dvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform4dvEXT)},
+  {"glEndTransformFeedbackEXT",reinterpret_cast<FUNCTION_POINTER>(null_glEndTransformFeedbackEXT)},
+  {"glBinormal3dEXT",reinterpret_cast<FUNCTION_POINTER>(null_glBinormal3dEXT)},
+  {"glGetTextureSubImage",reinterpret_cast<FUNCTION_POINTER>(null_glGetTextureSubImage)},
+  {"glGetNamedRenderbufferParameteriv",reinterpret_cast<FUNCTION_POINTER>(null_glGetNamedRenderbufferParameteriv)},
+  {"glBindBuffersRange",reinterpret_cast<FUNCTION_POINTER>(null_glBindBuffersRange)},
+  {"glFinishAsyncSGIX",reinterpret_cast<FUNCTION_POINTER>(null_glFinishAsyncSGIX)},
+  {"glBindFragDataLocationIndexed",reinterpret_cast<FUNCTION_POINTER>(null_glBindFragDataLocationIndexed)},
+  {"glMultiTexCoord2dv",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord2dv)},
+  {"glUniform2iv",reinterpret_cast<FUNCTION_POINTER>(null_glUniform2iv)},
+  {"glProgramUniform2i64vNV",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform2i64vNV)},
+  {"glFlushVertexArrayRangeAPPLE",reinterpret_cast<FUNCTION_POINTER>(null_glFlushVertexArrayRangeAPPLE)},
+  {"glTextureParameterf",reinterpret_cast<FUNCTION_POINTER>(null_glTextureParameterf)},
+  {"glMultiTexCoord3dvARB",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord3dvARB)},
+  {"glFeedbackBuffer",reinterpret_cast<FUNCTION_POINTER>(null_glFeedbackBuffer)},
+  {"glDebugMessageInsertARB",reinterpret_cast<FUNCTION_POINTER>(null_glDebugMessageInsertARB)},
+  {"glMultiTexCoord2i",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord2i)},
+  {"glTextureSubImage3D",reinterpret_cast<FUNCTION_POINTER>(null_glTextureSubImage3D)},
+  {"glFramebufferTexture1D",reinterpret_cast<FUNCTION_POINTER>(null_glFramebufferTexture1D)},
+  {"glGetShaderiv",reinterpret_cast<FUNCTION_POINTER>(null_glGetShaderiv)},
+  {"glMultiTexCoord2d",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord2d)},
+  {"glArrayObjectATI",reinterpret_cast<FUNCTION_POINTER>(null_glArrayObjectATI)},
+  {"glGetPointeri_vEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetPointeri_vEXT)},
+  {"glGetPerfMonitorCountersAMD",reinterpret_cast<FUNCTION_POINTER>(null_glGetPerfMonitorCountersAMD)},
+  {"glNamedBufferStorage",reinterpret_cast<FUNCTION_POINTER>(null_glNamedBufferStorage)},
+  {"glTexEnvxvOES",reinterpret_cast<FUNCTION_POINTER>(null_glTexEnvxvOES)},
+  {"glProgramUniform2ui64NV",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform2ui64NV)},
+  {"glMultiTexCoord3bOES",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord3bOES)},
+  {"glUniform1dv",reinterpret_cast<FUNCTION_POINTER>(null_glUniform1dv)},
+  {"glPixelTransferi",reinterpret_cast<FUNCTION_POINTER>(null_glPixelTransferi)},
+  {"glSecondaryColor3usvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glSecondaryColor3usvEXT)},
+  {"glProgramEnvParameterI4uivNV",reinterpret_cast<FUNCTION_POINTER>(null_glProgramEnvParameterI4uivNV)},
+  {"glVertex2sv",reinterpret_cast<FUNCTION_POINTER>(null_glVertex2sv)},
+  {"glWindowPos4dMESA",reinterpret_cast<FUNCTION_POINTER>(null_glWindowPos4dMESA)},
+  {"glDebugMessageControlARB",reinterpret_cast<FUNCTION_POINTER>(null_glDebugMessageControlARB)},
+  {"glIsTextureEXT",reinterpret_cast<FUNCTION_POINTER>(null_glIsTextureEXT)},
+  {"glFragmentMaterialivSGIX",reinterpret_cast<FUNCTION_POINTER>(null_glFragmentMaterialivSGIX)},
+  {"glLinkProgramARB",reinterpret_cast<FUNCTION_POINTER>(null_glLinkProgramARB)},
+  {"glFinishFenceAPPLE",reinterpret_cast<FUNCTION_POINTER>(null_glFinishFenceAPPLE)},
+  {"glVertexArrayVertexAttribBindingEXT",reinterpret_cast<FUNCTION_POINTER>(null_glVertexArrayVertexAttribBindingEXT)},
+  {"glMultiTexCoord4fv",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord4fv)},
+  {"glRasterPos3i",reinterpret_cast<FUNCTION_POINTER>(null_glRasterPos3i)},
+  {"glRasterPos3d",reinterpret_cast<FUNCTION_POINTER>(null_glRasterPos3d)},
+  {"glPollAsyncSGIX",reinterpret_cast<FUNCTION_POINTER>(null_glPollAsyncSGIX)},
+  {"glRasterPos3f",reinterpret_cast<FUNCTION_POINTER>(null_glRasterPos3f)},
+  {"glCompressedTexImage3D",reinterpret_cast<FUNCTION_POINTER>(null_glCompressedTexImage3D)},
+  {"glVariantivEXT",reinterpret_cast<FUNCTION_POINTER>(null_glVariantivEXT)},
+  {"glUnmapTexture2DINTEL",reinterpret_cast<FUNCTION_POINTER>(null_glUnmapTexture2DINTEL)},
+  {"glGetVertexAttribiv",reinterpret_cast<FUNCTION_POINTER>(null_glGetVertexAttribiv)},
+  {"glGetPathCoordsNV",reinterpret_cast<FUNCTION_POINTER>(null_glGetPathCoordsNV)},
+  {"glColor4xvOES",reinterpret_cast<FUNCTION_POINTER>(null_glColor4xvOES)},
+  {"glVertexAttrib3fv",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib3fv)},
+  {"glRasterPos3s",reinterpret_cast<FUNCTION_POINTER>(null_glRasterPos3s)},
+  {"glVertex4bOES",reinterpret_cast<FUNCTION_POINTER>(null_glVertex4bOES)},
+  {"glTransformFeedbackVaryingsEXT",reinterpret_cast<FUNCTION_POINTER>(null_glTransformFeedbackVaryingsEXT)},
+  {"glCombinerOutputNV",reinterpret_cast<FUNCTION_POINTER>(null_glCombinerOutputNV)},
+  {"glWindowPos4sMESA",reinterpret_cast<FUNCTION_POINTER>(null_glWindowPos4sMESA)},
+  {"glVertexAttrib4svARB",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib4svARB)},
+  {"glIsList",reinterpret_cast<FUNCTION_POINTER>(null_glIsList)},
+  {"glGetInfoLogARB",reinterpret_cast<FUNCTION_POINTER>(null_glGetInfoLogARB)},
+  {"glUniformMatrix2fv",reinterpret_cast<FUNCTION_POINTER>(null_glUniformMatrix2fv)},
+  {"glVertexAttribs3dvNV",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribs3dvNV)},
+  {"glGlobalAlphaFactorsSUN",reinterpret_cast<FUNCTION_POINTER>(null_glGlobalAlphaFactorsSUN)},
+  {"glGetTrackMatrixivNV",reinterpret_cast<FUNCTION_POINTER>(null_glGetTrackMatrixivNV)},
+  {"glTextureParameterfvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glTextureParameterfvEXT)},
+  {"glIsNamedBufferResidentNV",reinterpret_cast<FUNCTION_POINTER>(null_glIsNamedBufferResidentNV)},
+  {"glProgramUniform4ui64vARB",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform4ui64vARB)},
+  {"glTbufferMask3DFX",reinterpret_cast<FUNCTION_POINTER>(null_glTbufferMask3DFX)},
+  {"glCoverFillPathNV",reinterpret_cast<FUNCTION_POINTER>(null_glCoverFillPathNV)},
+  {"glVertexAttrib1fvARB",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib1fvARB)},
+  {"glGenerateTextureMipmap",reinterpret_cast<FUNCTION_POINTER>(null_glGenerateTextureMipmap)},
+  {"glNamedProgramLocalParameterI4uivEXT",reinterpret_cast<FUNCTION_POINTER>(null_glNamedProgramLocalParameterI4uivEXT)},
+  {"glMultiDrawElementsBaseVertex",reinterpret_cast<FUNCTION_POINTER>(null_glMultiDrawElementsBaseVertex)},
+  {"glProgramSubroutineParametersuivNV",reinterpret_cast<FUNCTION_POINTER>(null_glProgramSubroutineParametersuivNV)},
+  {"glProgramUniformMatrix2x4dvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniformMatrix2x4dvEXT)},
+  {"glRotatexOES",reinterpret_cast<FUNCTION_POINTER>(null_glRotatexOES)},
+  {"glMemoryBarrierEXT",reinterpret_cast<FUNCTION_POINTER>(null_glMemoryBarrierEXT)},
+  {"glVertexAttrib3svNV",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib3svNV)},
+  {"glVertexStream3iATI",reinterpret_cast<FUNCTION_POINTER>(null_glVertexStream3iATI)},
+  {"glCompressedTexSubImage1D",reinterpret_cast<FUNCTION_POINTER>(null_glCompressedTexSubImage1D)},
+  {"glSetFenceNV",reinterpret_cast<FUNCTION_POINTER>(null_glSetFenceNV)},
+  {"glAttachObjectARB",reinterpret_cast<FUNCTION_POINTER>(null_glAttachObjectARB)},
+  {"glCopyConvolutionFilter1D",reinterpret_cast<FUNCTION_POINTER>(null_glCopyConvolutionFilter1D)},
+  {"glProgramParameters4fvNV",reinterpret_cast<FUNCTION_POINTER>(null_glProgramParameters4fvNV)},
+  {"glNamedFramebufferParameteriEXT",reinterpret_cast<FUNCTION_POINTER>(null_glNamedFramebufferParameteriEXT)},
+  {"glVertexAttrib4Nsv",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib4Nsv)},
+  {"glVertexAttribI4usvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribI4usvEXT)},
+  {"glTextureBufferRangeEXT",reinterpret_cast<FUNCTION_POINTER>(null_glTextureBufferRangeEXT)},
+  {"glVertexP3uiv",reinterpret_cast<FUNCTION_POINTER>(null_glVertexP3uiv)},
+  {"glIsPathNV",reinterpret_cast<FUNCTION_POINTER>(null_glIsPathNV)},
+  {"glGetnUniformi64vARB",reinterpret_cast<FUNCTION_POINTER>(null_glGetnUniformi64vARB)},
+  {"glFramebufferTextureMultiviewOVR",reinterpret_cast<FUNCTION_POINTER>(null_glFramebufferTextureMultiviewOVR)},
+  {"glCompressedMultiTexSubImage2DEXT",reinterpret_cast<FUNCTION_POINTER>(null_glCompressedMultiTexSubImage2DEXT)},
+  {"glGetnMapdv",reinterpret_cast<FUNCTION_POINTER>(null_glGetnMapdv)},
+  {"glDebugMessageCallback",reinterpret_cast<FUNCTION_POINTER>(null_glDebugMessageCallback)},
+  {"glTangent3svEXT",reinterpret_cast<FUNCTION_POINTER>(null_glTangent3svEXT)},
+  {"glVertexAttribParameteriAMD",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribParameteriAMD)},
+  {"glBufferSubDataARB",reinterpret_cast<FUNCTION_POINTER>(null_glBufferSubDataARB)},
+  {"glGetVertexAttribLui64vARB",reinterpret_cast<FUNCTION_POINTER>(null_glGetVertexAttribLui64vARB)},
+  {"glVertexAttribL4ui64NV",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribL4ui64NV)},
+  {"glReplacementCodeuiColor4ubVertex3fSUN",reinterpret_cast<FUNCTION_POINTER>(null_glReplacementCodeuiColor4ubVertex3fSUN)},
+  {"glImageTransformParameterfHP",reinterpret_cast<FUNCTION_POINTER>(null_glImageTransformParameterfHP)},
+  {"glMap1f",reinterpret_cast<FUNCTION_POINTER>(null_glMap1f)},
+  {"glRasterPos4fv",reinterpret_cast<FUNCTION_POINTER>(null_glRasterPos4fv)},
+  {"glVertex2bvOES",reinterpret_cast<FUNCTION_POINTER>(null_glVertex2bvOES)},
+  {"glGetMapControlPointsNV",reinterpret_cast<FUNCTION_POINTER>(null_glGetMapControlPointsNV)},
+  {"glNamedProgramLocalParametersI4ivEXT",reinterpret_cast<FUNCTION_POINTER>(null_glNamedProgramLocalParametersI4ivEXT)},
+  {"glBindBufferRangeNV",reinterpret_cast<FUNCTION_POINTER>(null_glBindBufferRangeNV)},
+  {"glVertexStream3dvATI",reinterpret_cast<FUNCTION_POINTER>(null_glVertexStream3dvATI)},
+  {"glNormalPointerListIBM",reinterpret_cast<FUNCTION_POINTER>(null_glNormalPointerListIBM)},
+  {"glFogFuncSGIS",reinterpret_cast<FUNCTION_POINTER>(null_glFogFuncSGIS)},
+  {"glMultiModeDrawArraysIBM",reinterpret_cast<FUNCTION_POINTER>(null_glMultiModeDrawArraysIBM)},
+  {"glGetNamedFramebufferAttachmentParameterivEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetNamedFramebufferAttachmentParameterivEXT)},
+  {"glGetFloatv",reinterpret_cast<FUNCTION_POINTER>(null_glGetFloatv)},
+  {"glVertexArrayVertexAttribIFormatEXT",reinterpret_cast<FUNCTION_POINTER>(null_glVertexArrayVertexAttribIFormatEXT)},
+  {"glHint",reinterpret_cast<FUNCTION_POINTER>(null_glHint)},
+  {"glPointAlongPathNV",reinterpret_cast<FUNCTION_POINTER>(null_glPointAlongPathNV)},
+  {"glVertexStream2svATI",reinterpret_cast<FUNCTION_POINTER>(null_glVertexStream2svATI)},
+  {"glMultiDrawArraysIndirect",reinterpret_cast<FUNCTION_POINTER>(null_glMultiDrawArraysIndirect)},
+  {"glVertexAttribP2uiv",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribP2uiv)},
+  {"glProgramUniform1i64vARB",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform1i64vARB)},
+  {"glFramebufferTextureARB",reinterpret_cast<FUNCTION_POINTER>(null_glFramebufferTextureARB)},
+  {"glPushClientAttribDefaultEXT",reinterpret_cast<FUNCTION_POINTER>(null_glPushClientAttribDefaultEXT)},
+  {"glScalef",reinterpret_cast<FUNCTION_POINTER>(null_glScalef)},
+  {"glScaled",reinterpret_cast<FUNCTION_POINTER>(null_glScaled)},
+  {"glGetConvolutionParameterxvOES",reinterpret_cast<FUNCTION_POINTER>(null_glGetConvolutionParameterxvOES)},
+  {"glGetProgramResourceName",reinterpret_cast<FUNCTION_POINTER>(null_glGetProgramResourceName)},
+  {"glCopyColorTable",reinterpret_cast<FUNCTION_POINTER>(null_glCopyColorTable)},
+  {"glDepthRangeArrayv",reinterpret_cast<FUNCTION_POINTER>(null_glDepthRangeArrayv)},
+  {"glCoverFillPathInstancedNV",reinterpret_cast<FUNCTION_POINTER>(null_glCoverFillPathInstancedNV)},
+  {"glMultiTexParameterivEXT",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexParameterivEXT)},
+  {"glGetActiveAtomicCounterBufferiv",reinterpret_cast<FUNCTION_POINTER>(null_glGetActiveAtomicCounterBufferiv)},
+  {"glStencilOpSeparate",reinterpret_cast<FUNCTION_POINTER>(null_glStencilOpSeparate)},
+  {"glVertexAttrib4fNV",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib4fNV)},
+  {"glGetColorTableParameterivSGI",reinterpret_cast<FUNCTION_POINTER>(null_glGetColorTableParameterivSGI)},
+  {"glVertexArrayAttribBinding",reinterpret_cast<FUNCTION_POINTER>(null_glVertexArrayAttribBinding)},
+  {"glProgramParameters4dvNV",reinterpret_cast<FUNCTION_POINTER>(null_glProgramParameters4dvNV)},
+  {"glVertexAttribL4dv",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribL4dv)},
+  {"glVertexStream3dATI",reinterpret_cast<FUNCTION_POINTER>(null_glVertexStream3dATI)},
+  {"glGetUniformOffsetEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetUniformOffsetEXT)},
+  {"glGetVertexAttribPointerv",reinterpret_cast<FUNCTION_POINTER>(null_glGetVertexAttribPointerv)},
+  {"glProgramUniform3i64vNV",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform3i64vNV)},
+  {"glTangent3fEXT",reinterpret_cast<FUNCTION_POINTER>(null_glTangent3fEXT)},
+  {"glGetPathMetricRangeNV",reinterpret_cast<FUNCTION_POINTER>(null_glGetPathMetricRangeNV)},
+  {"glWindowPos2iMESA",reinterpret_cast<FUNCTION_POINTER>(null_glWindowPos2iMESA)},
+  {"glVertex2xvOES",reinterpret_cast<FUNCTION_POINTER>(null_glVertex2xvOES)},
+  {"glGetnCompressedTexImage",reinterpret_cast<FUNCTION_POINTER>(null_glGetnCompressedTexImage)},
+  {"glWindowPos2dv",reinterpret_cast<FUNCTION_POINTER>(null_glWindowPos2dv)},
+  {"glReplacementCodeuiVertex3fSUN",reinterpret_cast<FUNCTION_POINTER>(null_glReplacementCodeuiVertex3fSUN)},
+  {"glGetTransformFeedbackVaryingEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetTransformFeedbackVaryingEXT)},
+  {"glWindowPos3fARB",reinterpret_cast<FUNCTION_POINTER>(null_glWindowPos3fARB)},
+  {"glMapNamedBufferEXT",reinterpret_cast<FUNCTION_POINTER>(null_glMapNamedBufferEXT)},
+  {"glDisable",reinterpret_cast<FUNCTION_POINTER>(null_glDisable)},
+  {"glIsPointInFillPathNV",reinterpret_cast<FUNCTION_POINTER>(null_glIsPointInFillPathNV)},
+  {"glVertexAttribI2uiEXT",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribI2uiEXT)},
+  {"glProgramUniform4uiv",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform4uiv)},
+  {"glQueryCounter",reinterpret_cast<FUNCTION_POINTER>(null_glQueryCounter)},
+  {"glFramebufferRenderbufferEXT",reinterpret_cast<FUNCTION_POINTER>(null_glFramebufferRenderbufferEXT)},
+  {"glBinormal3svEXT",reinterpret_cast<FUNCTION_POINTER>(null_glBinormal3svEXT)},
+  {"glBindBufferOffsetNV",reinterpret_cast<FUNCTION_POINTER>(null_glBindBufferOffsetNV)},
+  {"glCopyTextureSubImage2D",reinterpret_cast<FUNCTION_POINTER>(null_glCopyTextureSubImage2D)},
+  {"glGetProgramResourcefvNV",reinterpret_cast<FUNCTION_POINTER>(null_glGetProgramResourcefvNV)},
+  {"glBinormalPointerEXT",reinterpret_cast<FUNCTION_POINTER>(null_glBinormalPointerEXT)},
+  {"glGetLightfv",reinterpret_cast<FUNCTION_POINTER>(null_glGetLightfv)},
+  {"glVertex2bOES",reinterpret_cast<FUNCTION_POINTER>(null_glVertex2bOES)},
+  {"glUniform2ivARB",reinterpret_cast<FUNCTION_POINTER>(null_glUniform2ivARB)},
+  {"glMultiTexCoord3s",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord3s)},
+  {"glGetHistogramParameterfvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetHistogramParameterfvEXT)},
+  {"glGetProgramStringNV",reinterpret_cast<FUNCTION_POINTER>(null_glGetProgramStringNV)},
+  {"glGetTexGenxvOES",reinterpret_cast<FUNCTION_POINTER>(null_glGetTexGenxvOES)},
+  {"glTextureSubImage2D",reinterpret_cast<FUNCTION_POINTER>(null_glTextureSubImage2D)},
+  {"glObjectPurgeableAPPLE",reinterpret_cast<FUNCTION_POINTER>(null_glObjectPurgeableAPPLE)},
+  {"glColorTableSGI",reinterpret_cast<FUNCTION_POINTER>(null_glColorTableSGI)},
+  {"glCopyConvolutionFilter2DEXT",reinterpret_cast<FUNCTION_POINTER>(null_glCopyConvolutionFilter2DEXT)},
+  {"glMultiTexCoord3f",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord3f)},
+  {"glMultiTexCoord3d",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord3d)},
+  {"glFogCoorddv",reinterpret_cast<FUNCTION_POINTER>(null_glFogCoorddv)},
+  {"glGetBufferPointerv",reinterpret_cast<FUNCTION_POINTER>(null_glGetBufferPointerv)},
+  {"glProgramUniform1fEXT",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform1fEXT)},
+  {"glWindowPos2fvMESA",reinterpret_cast<FUNCTION_POINTER>(null_glWindowPos2fvMESA)},
+  {"glPolygonOffsetxOES",reinterpret_cast<FUNCTION_POINTER>(null_glPolygonOffsetxOES)},
+  {"glVertexAttrib4dARB",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib4dARB)},
+  {"glUniformHandleui64vARB",reinterpret_cast<FUNCTION_POINTER>(null_glUniformHandleui64vARB)},
+  {"glFragmentLightModelfvSGIX",reinterpret_cast<FUNCTION_POINTER>(null_glFragmentLightModelfvSGIX)},
+  {"glSwizzleEXT",reinterpret_cast<FUNCTION_POINTER>(null_glSwizzleEXT)},
+  {"glBindFragmentShaderATI",reinterpret_cast<FUNCTION_POINTER>(null_glBindFragmentShaderATI)},
+  {"glVertexAttribs3hvNV",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribs3hvNV)},
+  {"glColorP3ui",reinterpret_cast<FUNCTION_POINTER>(null_glColorP3ui)},
+  {"glListParameterfvSGIX",reinterpret_cast<FUNCTION_POINTER>(null_glListParameterfvSGIX)},
+  {"glNamedRenderbufferStorageMultisample",reinterpret_cast<FUNCTION_POINTER>(null_glNamedRenderbufferStorageMultisample)},
+  {"glVertexAttribI1iEXT",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribI1iEXT)},
+  {"glMultiTexCoord2ivARB",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord2ivARB)},
+  {"glLightModelxOES",reinterpret_cast<FUNCTION_POINTER>(null_glLightModelxOES)},
+  {"glColor3xOES",reinterpret_cast<FUNCTION_POINTER>(null_glColor3xOES)},
+  {"glReadBuffer",reinterpret_cast<FUNCTION_POINTER>(null_glReadBuffer)},
+  {"glStencilFillPathInstancedNV",reinterpret_cast<FUNCTION_POINTER>(null_glStencilFillPathInstancedNV)},
+  {"glVDPAUUnmapSurfacesNV",reinterpret_cast<FUNCTION_POINTER>(null_glVDPAUUnmapSurfacesNV)},
+  {"glProgramUniform4i64NV",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform4i64NV)},
+  {"glVertexStream4dvATI",reinterpret_cast<FUNCTION_POINTER>(null_glVertexStream4dvATI)},
+  {"glIsQuery",reinterpret_cast<FUNCTION_POINTER>(null_glIsQuery)},
+  {"glProgramUniformMatrix4fvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniformMatrix4fvEXT)},
+  {"glVertexAttrib3hNV",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib3hNV)},
+  {"glFlushMappedNamedBufferRange",reinterpret_cast<FUNCTION_POINTER>(null_glFlushMappedNamedBufferRange)},
+  {"glPushName",reinterpret_cast<FUNCTION_POINTER>(null_glPushName)},
+  {"glGetClipPlane",reinterpret_cast<FUNCTION_POINTER>(null_glGetClipPlane)},
+  {"glVertex4dv",reinterpret_cast<FUNCTION_POINTER>(null_glVertex4dv)},
+  {"glVertexAttrib3d",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib3d)},
+  {"glBlendColor",reinterpret_cast<FUNCTION_POINTER>(null_glBlendColor)},
+  {"glBindTransformFeedbackNV",reinterpret_cast<FUNCTION_POINTER>(null_glBindTransformFeedbackNV)},
+  {"glSamplerParameterIuiv",reinterpret_cast<FUNCTION_POINTER>(null_glSamplerParameterIuiv)},
+  {"glIndexubv",reinterpret_cast<FUNCTION_POINTER>(null_glIndexubv)},
+  {"glNamedBufferPageCommitmentEXT",reinterpret_cast<FUNCTION_POINTER>(null_glNamedBufferPageCommitmentEXT)},
+  {"glCheckNamedFramebufferStatus",reinterpret_cast<FUNCTION_POINTER>(null_glCheckNamedFramebufferStatus)},
+  {"glGetObjectBufferfvATI",reinterpret_cast<FUNCTION_POINTER>(null_glGetObjectBufferfvATI)},
+  {"glRasterPos4d",reinterpret_cast<FUNCTION_POINTER>(null_glRasterPos4d)},
+  {"glRasterPos4f",reinterpret_cast<FUNCTION_POINTER>(null_glRasterPos4f)},
+  {"glGetPerfMonitorCounterStringAMD",reinterpret_cast<FUNCTION_POINTER>(null_glGetPerfMonitorCounterStringAMD)},
+  {"glVertexAttrib3s",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib3s)},
+  {"glDrawElementsInstancedEXT",reinterpret_cast<FUNCTION_POINTER>(null_glDrawElementsInstancedEXT)},
+  {"glNamedProgramLocalParameterI4iEXT",reinterpret_cast<FUNCTION_POINTER>(null_glNamedProgramLocalParameterI4iEXT)},
+  {"glRasterPos4s",reinterpret_cast<FUNCTION_POINTER>(null_glRasterPos4s)},
+  {"glGetProgramStageiv",reinterpret_cast<FUNCTION_POINTER>(null_glGetProgramStageiv)},
+  {"glGetMaterialxOES",reinterpret_cast<FUNCTION_POINTER>(null_glGetMaterialxOES)},
+  {"glPopMatrix",reinterpret_cast<FUNCTION_POINTER>(null_glPopMatrix)},
+  {"glGetVideoui64vNV",reinterpret_cast<FUNCTION_POINTER>(null_glGetVideoui64vNV)},
+  {"glTangent3bEXT",reinterpret_cast<FUNCTION_POINTER>(null_glTangent3bEXT)},
+  {"glGetGraphicsResetStatusARB",reinterpret_cast<FUNCTION_POINTER>(null_glGetGraphicsResetStatusARB)},
+  {"glUniform4i",reinterpret_cast<FUNCTION_POINTER>(null_glUniform4i)},
+  {"glActiveTexture",reinterpret_cast<FUNCTION_POINTER>(null_glActiveTexture)},
+  {"glEnableVertexAttribArray",reinterpret_cast<FUNCTION_POINTER>(null_glEnableVertexAttribArray)},
+  {"glTexCoord4fVertex4fvSUN",reinterpret_cast<FUNCTION_POINTER>(null_glTexCoord4fVertex4fvSUN)},
+  {"glUniform4d",reinterpret_cast<FUNCTION_POINTER>(null_glUniform4d)},
+  {"glUniform4f",reinterpret_cast<FUNCTION_POINTER>(null_glUniform4f)},
+  {"glRenderbufferStorageMultisample",reinterpret_cast<FUNCTION_POINTER>(null_glRenderbufferStorageMultisample)},
+  {"glCreateProgramPipelines",reinterpret_cast<FUNCTION_POINTER>(null_glCreateProgramPipelines)},
+  {"glVertexAttribLPointer",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribLPointer)},
+  {"glUniform2uiEXT",reinterpret_cast<FUNCTION_POINTER>(null_glUniform2uiEXT)},
+  {"glMultiTexCoord3sv",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord3sv)},
+  {"glDrawElementsInstancedBaseVertex",reinterpret_cast<FUNCTION_POINTER>(null_glDrawElementsInstancedBaseVertex)},
+  {"glPixelTransformParameterfvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glPixelTransformParameterfvEXT)},
+  {"glDrawTransformFeedbackNV",reinterpret_cast<FUNCTION_POINTER>(null_glDrawTransformFeedbackNV)},
+  {"glTextureImage2DMultisampleCoverageNV",reinterpret_cast<FUNCTION_POINTER>(null_glTextureImage2DMultisampleCoverageNV)},
+  {"glNamedRenderbufferStorageMultisampleCoverageEXT",reinterpret_cast<FUNCTION_POINTER>(null_glNamedRenderbufferStorageMultisampleCoverageEXT)},
+  {"glIsTexture",reinterpret_cast<FUNCTION_POINTER>(null_glIsTexture)},
+  {"glMultiTexCoord4iv",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord4iv)},
+  {"glTexEnvfv",reinterpret_cast<FUNCTION_POINTER>(null_glTexEnvfv)},
+  {"glPopDebugGroup",reinterpret_cast<FUNCTION_POINTER>(null_glPopDebugGroup)},
+  {"glUniformBlockBinding",reinterpret_cast<FUNCTION_POINTER>(null_glUniformBlockBinding)},
+  {"glWindowPos2svMESA",reinterpret_cast<FUNCTION_POINTER>(null_glWindowPos2svMESA)},
+  {"glGenerateTextureMipmapEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGenerateTextureMipmapEXT)},
+  {"glBindLightParameterEXT",reinterpret_cast<FUNCTION_POINTER>(null_glBindLightParameterEXT)},
+  {"glTexCoord3bOES",reinterpret_cast<FUNCTION_POINTER>(null_glTexCoord3bOES)},
+  {"glTexCoordPointer",reinterpret_cast<FUNCTION_POINTER>(null_glTexCoordPointer)},
+  {"glProgramUniformMatrix3x2fv",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniformMatrix3x2fv)},
+  {"glUniform2fvARB",reinterpret_cast<FUNCTION_POINTER>(null_glUniform2fvARB)},
+  {"glProgramLocalParameterI4uivNV",reinterpret_cast<FUNCTION_POINTER>(null_glProgramLocalParameterI4uivNV)},
+  {"glFlushVertexArrayRangeNV",reinterpret_cast<FUNCTION_POINTER>(null_glFlushVertexArrayRangeNV)},
+  {"glSecondaryColor3svEXT",reinterpret_cast<FUNCTION_POINTER>(null_glSecondaryColor3svEXT)},
+  {"glGetBufferParameteriv",reinterpret_cast<FUNCTION_POINTER>(null_glGetBufferParameteriv)},
+  {"glGetQueryIndexediv",reinterpret_cast<FUNCTION_POINTER>(null_glGetQueryIndexediv)},
+  {"glFramebufferTexture3DEXT",reinterpret_cast<FUNCTION_POINTER>(null_glFramebufferTexture3DEXT)},
+  {"glLoadTransposeMatrixxOES",reinterpret_cast<FUNCTION_POINTER>(null_glLoadTransposeMatrixxOES)},
+  {"glDeleteTransformFeedbacksNV",reinterpret_cast<FUNCTION_POINTER>(null_glDeleteTransformFeedbacksNV)},
+  {"glGetCompressedTextureImageEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetCompressedTextureImageEXT)},
+  {"glIndexMaterialEXT",reinterpret_cast<FUNCTION_POINTER>(null_glIndexMaterialEXT)},
+  {"glFogCoorddEXT",reinterpret_cast<FUNCTION_POINTER>(null_glFogCoorddEXT)},
+  {"glTexCoord2hvNV",reinterpret_cast<FUNCTION_POINTER>(null_glTexCoord2hvNV)},
+  {"glFramebufferTexture2DEXT",reinterpret_cast<FUNCTION_POINTER>(null_glFramebufferTexture2DEXT)},
+  {"glTexEnviv",reinterpret_cast<FUNCTION_POINTER>(null_glTexEnviv)},
+  {"glEndTransformFeedbackNV",reinterpret_cast<FUNCTION_POINTER>(null_glEndTransformFeedbackNV)},
+  {"glGlobalAlphaFactoruiSUN",reinterpret_cast<FUNCTION_POINTER>(null_glGlobalAlphaFactoruiSUN)},
+  {"glSelectBuffer",reinterpret_cast<FUNCTION_POINTER>(null_glSelectBuffer)},
+  {"glNamedBufferSubDataEXT",reinterpret_cast<FUNCTION_POINTER>(null_glNamedBufferSubDataEXT)},
+  {"glDisableVertexArrayAttrib",reinterpret_cast<FUNCTION_POINTER>(null_glDisableVertexArrayAttrib)},
+  {"glBlendFunc",reinterpret_cast<FUNCTION_POINTER>(null_glBlendFunc)},
+  {"glCreateProgram",reinterpret_cast<FUNCTION_POINTER>(null_glCreateProgram)},
+  {"glVertexStream2dATI",reinterpret_cast<FUNCTION_POINTER>(null_glVertexStream2dATI)},
+  {"glUniform4ui64vARB",reinterpret_cast<FUNCTION_POINTER>(null_glUniform4ui64vARB)},
+  {"glPrimitiveRestartIndex",reinterpret_cast<FUNCTION_POINTER>(null_glPrimitiveRestartIndex)},
+  {"glNormalStream3fATI",reinterpret_cast<FUNCTION_POINTER>(null_glNormalStream3fATI)},
+  {"glProgramUniformMatrix2fv",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniformMatrix2fv)},
+  {"glVertexAttribs1hvNV",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribs1hvNV)},
+  {"glWindowPos4svMESA",reinterpret_cast<FUNCTION_POINTER>(null_glWindowPos4svMESA)},
+  {"glDeleteFragmentShaderATI",reinterpret_cast<FUNCTION_POINTER>(null_glDeleteFragmentShaderATI)},
+  {"glBindImageTextures",reinterpret_cast<FUNCTION_POINTER>(null_glBindImageTextures)},
+  {"glMap2xOES",reinterpret_cast<FUNCTION_POINTER>(null_glMap2xOES)},
+  {"glEnd",reinterpret_cast<FUNCTION_POINTER>(null_glEnd)},
+  {"glMultiTexCoord2dARB",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord2dARB)},
+  {"glUniform1i64NV",reinterpret_cast<FUNCTION_POINTER>(null_glUniform1i64NV)},
+  {"glPathStringNV",reinterpret_cast<FUNCTION_POINTER>(null_glPathStringNV)},
+  {"glGetNamedFramebufferParameterivEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetNamedFramebufferParameterivEXT)},
+  {"glGetProgramNamedParameterdvNV",reinterpret_cast<FUNCTION_POINTER>(null_glGetProgramNamedParameterdvNV)},
+  {"glPathDashArrayNV",reinterpret_cast<FUNCTION_POINTER>(null_glPathDashArrayNV)},
+  {"glUniform3uiv",reinterpret_cast<FUNCTION_POINTER>(null_glUniform3uiv)},
+  {"glColor3fVertex3fvSUN",reinterpret_cast<FUNCTION_POINTER>(null_glColor3fVertex3fvSUN)},
+  {"glMultTransposeMatrixd",reinterpret_cast<FUNCTION_POINTER>(null_glMultTransposeMatrixd)},
+  {"glClearColor",reinterpret_cast<FUNCTION_POINTER>(null_glClearColor)},
+  {"glGetImageHandleARB",reinterpret_cast<FUNCTION_POINTER>(null_glGetImageHandleARB)},
+  {"glTangent3dEXT",reinterpret_cast<FUNCTION_POINTER>(null_glTangent3dEXT)},
+  {"glGetQueryObjectivARB",reinterpret_cast<FUNCTION_POINTER>(null_glGetQueryObjectivARB)},
+  {"glGetLocalConstantFloatvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetLocalConstantFloatvEXT)},
+  {"glUseShaderProgramEXT",reinterpret_cast<FUNCTION_POINTER>(null_glUseShaderProgramEXT)},
+  {"glBindRenderbufferEXT",reinterpret_cast<FUNCTION_POINTER>(null_glBindRenderbufferEXT)},
+  {"glInterleavedArrays",reinterpret_cast<FUNCTION_POINTER>(null_glInterleavedArrays)},
+  {"glGetPerfMonitorGroupStringAMD",reinterpret_cast<FUNCTION_POINTER>(null_glGetPerfMonitorGroupStringAMD)},
+  {"glUniform3ui",reinterpret_cast<FUNCTION_POINTER>(null_glUniform3ui)},
+  {"glGetNamedProgramLocalParameterdvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetNamedProgramLocalParameterdvEXT)},
+  {"glSecondaryColor3us",reinterpret_cast<FUNCTION_POINTER>(null_glSecondaryColor3us)},
+  {"glVertexAttribI4uiv",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribI4uiv)},
+  {"glVertexAttrib4bv",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib4bv)},
+  {"glMultiTexCoord3xOES",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord3xOES)},
+  {"glSecondaryColor3ub",reinterpret_cast<FUNCTION_POINTER>(null_glSecondaryColor3ub)},
+  {"glFragmentMaterialfSGIX",reinterpret_cast<FUNCTION_POINTER>(null_glFragmentMaterialfSGIX)},
+  {"glGetVariantArrayObjectivATI",reinterpret_cast<FUNCTION_POINTER>(null_glGetVariantArrayObjectivATI)},
+  {"glSecondaryColor3ui",reinterpret_cast<FUNCTION_POINTER>(null_glSecondaryColor3ui)},
+  {"glVertexAttrib1dARB",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib1dARB)},
+  {"glGetNamedBufferPointerv",reinterpret_cast<FUNCTION_POINTER>(null_glGetNamedBufferPointerv)},
+  {"glLockArraysEXT",reinterpret_cast<FUNCTION_POINTER>(null_glLockArraysEXT)},
+  {"glVertexAttribPointerNV",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribPointerNV)},
+  {"glConvolutionParameterf",reinterpret_cast<FUNCTION_POINTER>(null_glConvolutionParameterf)},
+  {"glBindBufferBaseEXT",reinterpret_cast<FUNCTION_POINTER>(null_glBindBufferBaseEXT)},
+  {"glTexCoord2xvOES",reinterpret_cast<FUNCTION_POINTER>(null_glTexCoord2xvOES)},
+  {"glGetQueryBufferObjectui64v",reinterpret_cast<FUNCTION_POINTER>(null_glGetQueryBufferObjectui64v)},
+  {"glSetMultisamplefvAMD",reinterpret_cast<FUNCTION_POINTER>(null_glSetMultisamplefvAMD)},
+  {"glPathColorGenNV",reinterpret_cast<FUNCTION_POINTER>(null_glPathColorGenNV)},
+  {"glVertexAttrib3sARB",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib3sARB)},
+  {"glVertexAttrib4ivARB",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib4ivARB)},
+  {"glGenTransformFeedbacks",reinterpret_cast<FUNCTION_POINTER>(null_glGenTransformFeedbacks)},
+  {"glGetVertexAttribIuiv",reinterpret_cast<FUNCTION_POINTER>(null_glGetVertexAttribIuiv)},
+  {"glPixelTransformParameterfEXT",reinterpret_cast<FUNCTION_POINTER>(null_glPixelTransformParameterfEXT)},
+  {"glGetTexParameterIuivEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetTexParameterIuivEXT)},
+  {"glGetObjectParameterivARB",reinterpret_cast<FUNCTION_POINTER>(null_glGetObjectParameterivARB)},
+  {"glVertexArraySecondaryColorOffsetEXT",reinterpret_cast<FUNCTION_POINTER>(null_glVertexArraySecondaryColorOffsetEXT)},
+  {"glWindowPos2fARB",reinterpret_cast<FUNCTION_POINTER>(null_glWindowPos2fARB)},
+  {"glCompressedTexSubImage2D",reinterpret_cast<FUNCTION_POINTER>(null_glCompressedTexSubImage2D)},
+  {"glCompressedTexSubImage3DARB",reinterpret_cast<FUNCTION_POINTER>(null_glCompressedTexSubImage3DARB)},
+  {"glProgramBinary",reinterpret_cast<FUNCTION_POINTER>(null_glProgramBinary)},
+  {"glPresentFrameKeyedNV",reinterpret_cast<FUNCTION_POINTER>(null_glPresentFrameKeyedNV)},
+  {"glVertexAttribI4bv",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribI4bv)},
+  {"glPathCoverDepthFuncNV",reinterpret_cast<FUNCTION_POINTER>(null_glPathCoverDepthFuncNV)},
+  {"glTransformFeedbackStreamAttribsNV",reinterpret_cast<FUNCTION_POINTER>(null_glTransformFeedbackStreamAttribsNV)},
+  {"glSecondaryColor3usEXT",reinterpret_cast<FUNCTION_POINTER>(null_glSecondaryColor3usEXT)},
+  {"glCopyColorTableSGI",reinterpret_cast<FUNCTION_POINTER>(null_glCopyColorTableSGI)},
+  {"glProgramEnvParameter4fvARB",reinterpret_cast<FUNCTION_POINTER>(null_glProgramEnvParameter4fvARB)},
+  {"glMultiTexCoord4sARB",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord4sARB)},
+  {"glGetVertexArrayIndexed64iv",reinterpret_cast<FUNCTION_POINTER>(null_glGetVertexArrayIndexed64iv)},
+  {"glMatrixMultTranspose3x3fNV",reinterpret_cast<FUNCTION_POINTER>(null_glMatrixMultTranspose3x3fNV)},
+  {"glTexParameterIiv",reinterpret_cast<FUNCTION_POINTER>(null_glTexParameterIiv)},
+  {"glVertexArrayAttribFormat",reinterpret_cast<FUNCTION_POINTER>(null_glVertexArrayAttribFormat)},
+  {"glEndTransformFeedback",reinterpret_cast<FUNCTION_POINTER>(null_glEndTransformFeedback)},
+  {"glDrawCommandsStatesAddressNV",reinterpret_cast<FUNCTION_POINTER>(null_glDrawCommandsStatesAddressNV)},
+  {"glUniform4ui64NV",reinterpret_cast<FUNCTION_POINTER>(null_glUniform4ui64NV)},
+  {"glMaterialiv",reinterpret_cast<FUNCTION_POINTER>(null_glMaterialiv)},
+  {"glTexImage2DMultisample",reinterpret_cast<FUNCTION_POINTER>(null_glTexImage2DMultisample)},
+  {"glBindTextureEXT",reinterpret_cast<FUNCTION_POINTER>(null_glBindTextureEXT)},
+  {"glIsBuffer",reinterpret_cast<FUNCTION_POINTER>(null_glIsBuffer)},
+  {"glVertexAttribI1iv",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribI1iv)},
+  {"glGetFinalCombinerInputParameterfvNV",reinterpret_cast<FUNCTION_POINTER>(null_glGetFinalCombinerInputParameterfvNV)},
+  {"glMultiTexCoord3bvOES",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord3bvOES)},
+  {"glVertexAttribDivisor",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribDivisor)},
+  {"glCopyBufferSubData",reinterpret_cast<FUNCTION_POINTER>(null_glCopyBufferSubData)},
+  {"glBindTexGenParameterEXT",reinterpret_cast<FUNCTION_POINTER>(null_glBindTexGenParameterEXT)},
+  {"glNormalStream3bATI",reinterpret_cast<FUNCTION_POINTER>(null_glNormalStream3bATI)},
+  {"glTextureImage2DEXT",reinterpret_cast<FUNCTION_POINTER>(null_glTextureImage2DEXT)},
+  {"glGetColorTableParameteriv",reinterpret_cast<FUNCTION_POINTER>(null_glGetColorTableParameteriv)},
+  {"glActiveTextureARB",reinterpret_cast<FUNCTION_POINTER>(null_glActiveTextureARB)},
+  {"glTexCoord4xOES",reinterpret_cast<FUNCTION_POINTER>(null_glTexCoord4xOES)},
+  {"glSecondaryColor3fvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glSecondaryColor3fvEXT)},
+  {"glUniformMatrix4x2fv",reinterpret_cast<FUNCTION_POINTER>(null_glUniformMatrix4x2fv)},
+  {"glStartInstrumentsSGIX",reinterpret_cast<FUNCTION_POINTER>(null_glStartInstrumentsSGIX)},
+  {"glProgramNamedParameter4fvNV",reinterpret_cast<FUNCTION_POINTER>(null_glProgramNamedParameter4fvNV)},
+  {"glEndVideoCaptureNV",reinterpret_cast<FUNCTION_POINTER>(null_glEndVideoCaptureNV)},
+  {"glGenLists",reinterpret_cast<FUNCTION_POINTER>(null_glGenLists)},
+  {"glUniform1fARB",reinterpret_cast<FUNCTION_POINTER>(null_glUniform1fARB)},
+  {"glNamedFramebufferTexture1DEXT",reinterpret_cast<FUNCTION_POINTER>(null_glNamedFramebufferTexture1DEXT)},
+  {"glMapBufferRange",reinterpret_cast<FUNCTION_POINTER>(null_glMapBufferRange)},
+  {"glMultiDrawElementsIndirectCountARB",reinterpret_cast<FUNCTION_POINTER>(null_glMultiDrawElementsIndirectCountARB)},
+  {"glProgramUniformMatrix4x2fv",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniformMatrix4x2fv)},
+  {"glGetTextureParameterIivEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetTextureParameterIivEXT)},
+  {"glMultiTexCoord3hNV",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord3hNV)},
+  {"glNamedProgramLocalParametersI4uivEXT",reinterpret_cast<FUNCTION_POINTER>(null_glNamedProgramLocalParametersI4uivEXT)},
+  {"glEndList",reinterpret_cast<FUNCTION_POINTER>(null_glEndList)},
+  {"glTexCoord2fColor4fNormal3fVertex3fSUN",reinterpret_cast<FUNCTION_POINTER>(null_glTexCoord2fColor4fNormal3fVertex3fSUN)},
+  {"glGenTransformFeedbacksNV",reinterpret_cast<FUNCTION_POINTER>(null_glGenTransformFeedbacksNV)},
+  {"glEdgeFlagv",reinterpret_cast<FUNCTION_POINTER>(null_glEdgeFlagv)},
+  {"glVertexAttribI2iv",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribI2iv)},
+  {"glCopyMultiTexImage2DEXT",reinterpret_cast<FUNCTION_POINTER>(null_glCopyMultiTexImage2DEXT)},
+  {"glUniformMatrix3x2dv",reinterpret_cast<FUNCTION_POINTER>(null_glUniformMatrix3x2dv)},
+  {"glTexImage3DMultisampleCoverageNV",reinterpret_cast<FUNCTION_POINTER>(null_glTexImage3DMultisampleCoverageNV)},
+  {"glGetShaderPrecisionFormat",reinterpret_cast<FUNCTION_POINTER>(null_glGetShaderPrecisionFormat)},
+  {"glTexSubImage4DSGIS",reinterpret_cast<FUNCTION_POINTER>(null_glTexSubImage4DSGIS)},
+  {"glRasterSamplesEXT",reinterpret_cast<FUNCTION_POINTER>(null_glRasterSamplesEXT)},
+  {"glTextureView",reinterpret_cast<FUNCTION_POINTER>(null_glTextureView)},
+  {"glEvalMapsNV",reinterpret_cast<FUNCTION_POINTER>(null_glEvalMapsNV)},
+  {"glGetFragDataLocationEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetFragDataLocationEXT)},
+  {"glGetCompressedMultiTexImageEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetCompressedMultiTexImageEXT)},
+  {"glIndexMask",reinterpret_cast<FUNCTION_POINTER>(null_glIndexMask)},
+  {"glPushClientAttrib",reinterpret_cast<FUNCTION_POINTER>(null_glPushClientAttrib)},
+  {"glShaderSource",reinterpret_cast<FUNCTION_POINTER>(null_glShaderSource)},
+  {"glDispatchComputeGroupSizeARB",reinterpret_cast<FUNCTION_POINTER>(null_glDispatchComputeGroupSizeARB)},
+  {"glGetnPixelMapfv",reinterpret_cast<FUNCTION_POINTER>(null_glGetnPixelMapfv)},
+  {"glTexCoordP2uiv",reinterpret_cast<FUNCTION_POINTER>(null_glTexCoordP2uiv)},
+  {"glUniform2f",reinterpret_cast<FUNCTION_POINTER>(null_glUniform2f)},
+  {"glGetNamedBufferParameteri64v",reinterpret_cast<FUNCTION_POINTER>(null_glGetNamedBufferParameteri64v)},
+  {"glCommandListSegmentsNV",reinterpret_cast<FUNCTION_POINTER>(null_glCommandListSegmentsNV)},
+  {"glTextureParameterIivEXT",reinterpret_cast<FUNCTION_POINTER>(null_glTextureParameterIivEXT)},
+  {"glMultiTexParameterfvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexParameterfvEXT)},
+  {"glProgramUniform2ui64ARB",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform2ui64ARB)},
+  {"glVertex4d",reinterpret_cast<FUNCTION_POINTER>(null_glVertex4d)},
+  {"glNewObjectBufferATI",reinterpret_cast<FUNCTION_POINTER>(null_glNewObjectBufferATI)},
+  {"glViewportSwizzleNV",reinterpret_cast<FUNCTION_POINTER>(null_glViewportSwizzleNV)},
+  {"glBufferData",reinterpret_cast<FUNCTION_POINTER>(null_glBufferData)},
+  {"glTextureImage1DEXT",reinterpret_cast<FUNCTION_POINTER>(null_glTextureImage1DEXT)},
+  {"glGetTexParameterIiv",reinterpret_cast<FUNCTION_POINTER>(null_glGetTexParameterIiv)},
+  {"glCopyTexSubImage1DEXT",reinterpret_cast<FUNCTION_POINTER>(null_glCopyTexSubImage1DEXT)},
+  {"glVertex4f",reinterpret_cast<FUNCTION_POINTER>(null_glVertex4f)},
+  {"glUniformMatrix3fvARB",reinterpret_cast<FUNCTION_POINTER>(null_glUniformMatrix3fvARB)},
+  {"glTexCoordP1ui",reinterpret_cast<FUNCTION_POINTER>(null_glTexCoordP1ui)},
+  {"glPointParameterfvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glPointParameterfvEXT)},
+  {"glUniform4fARB",reinterpret_cast<FUNCTION_POINTER>(null_glUniform4fARB)},
+  {"glCopyTextureSubImage3D",reinterpret_cast<FUNCTION_POINTER>(null_glCopyTextureSubImage3D)},
+  {"glMultiTexCoord2fv",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord2fv)},
+  {"glMultiTexEnvfvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexEnvfvEXT)},
+  {"glNormalP3ui",reinterpret_cast<FUNCTION_POINTER>(null_glNormalP3ui)},
+  {"glDrawRangeElementArrayATI",reinterpret_cast<FUNCTION_POINTER>(null_glDrawRangeElementArrayATI)},
+  {"glVertexAttribI1i",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttribI1i)},
+  {"glDrawArraysInstancedARB",reinterpret_cast<FUNCTION_POINTER>(null_glDrawArraysInstancedARB)},
+  {"glEnableVertexAttribAPPLE",reinterpret_cast<FUNCTION_POINTER>(null_glEnableVertexAttribAPPLE)},
+  {"glGetDebugMessageLogARB",reinterpret_cast<FUNCTION_POINTER>(null_glGetDebugMessageLogARB)},
+  {"glGetPathTexGenfvNV",reinterpret_cast<FUNCTION_POINTER>(null_glGetPathTexGenfvNV)},
+  {"glNamedProgramLocalParameters4fvEXT",reinterpret_cast<FUNCTION_POINTER>(null_glNamedProgramLocalParameters4fvEXT)},
+  {"glVertexStream3fvATI",reinterpret_cast<FUNCTION_POINTER>(null_glVertexStream3fvATI)},
+  {"glFramebufferTexture3D",reinterpret_cast<FUNCTION_POINTER>(null_glFramebufferTexture3D)},
+  {"glCompressedTextureSubImage2DEXT",reinterpret_cast<FUNCTION_POINTER>(null_glCompressedTextureSubImage2DEXT)},
+  {"glWindowPos3dv",reinterpret_cast<FUNCTION_POINTER>(null_glWindowPos3dv)},
+  {"glCopyConvolutionFilter2D",reinterpret_cast<FUNCTION_POINTER>(null_glCopyConvolutionFilter2D)},
+  {"glReadInstrumentsSGIX",reinterpret_cast<FUNCTION_POINTER>(null_glReadInstrumentsSGIX)},
+  {"glSamplerParameterfv",reinterpret_cast<FUNCTION_POINTER>(null_glSamplerParameterfv)},
+  {"glBindBufferARB",reinterpret_cast<FUNCTION_POINTER>(null_glBindBufferARB)},
+  {"glVertexAttrib1sNV",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib1sNV)},
+  {"glGetMaterialiv",reinterpret_cast<FUNCTION_POINTER>(null_glGetMaterialiv)},
+  {"glUniform1fv",reinterpret_cast<FUNCTION_POINTER>(null_glUniform1fv)},
+  {"glBeginOcclusionQueryNV",reinterpret_cast<FUNCTION_POINTER>(null_glBeginOcclusionQueryNV)},
+  {"glGenFencesAPPLE",reinterpret_cast<FUNCTION_POINTER>(null_glGenFencesAPPLE)},
+  {"glScissorIndexedv",reinterpret_cast<FUNCTION_POINTER>(null_glScissorIndexedv)},
+  {"glDisableVariantClientStateEXT",reinterpret_cast<FUNCTION_POINTER>(null_glDisableVariantClientStateEXT)},
+  {"glMinmaxEXT",reinterpret_cast<FUNCTION_POINTER>(null_glMinmaxEXT)},
+  {"glNormalPointervINTEL",reinterpret_cast<FUNCTION_POINTER>(null_glNormalPointervINTEL)},
+  {"glNormal3s",reinterpret_cast<FUNCTION_POINTER>(null_glNormal3s)},
+  {"glGetnPixelMapuiv",reinterpret_cast<FUNCTION_POINTER>(null_glGetnPixelMapuiv)},
+  {"glNormalStream3bvATI",reinterpret_cast<FUNCTION_POINTER>(null_glNormalStream3bvATI)},
+  {"glGetObjectParameterivAPPLE",reinterpret_cast<FUNCTION_POINTER>(null_glGetObjectParameterivAPPLE)},
+  {"glNormal3i",reinterpret_cast<FUNCTION_POINTER>(null_glNormal3i)},
+  {"glUniform1ivARB",reinterpret_cast<FUNCTION_POINTER>(null_glUniform1ivARB)},
+  {"glNormal3d",reinterpret_cast<FUNCTION_POINTER>(null_glNormal3d)},
+  {"glUpdateObjectBufferATI",reinterpret_cast<FUNCTION_POINTER>(null_glUpdateObjectBufferATI)},
+  {"glNormal3b",reinterpret_cast<FUNCTION_POINTER>(null_glNormal3b)},
+  {"glGetUniformBufferSizeEXT",reinterpret_cast<FUNCTION_POINTER>(null_glGetUniformBufferSizeEXT)},
+  {"glMultiTexCoord4dv",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord4dv)},
+  {"glProgramUniform3i64ARB",reinterpret_cast<FUNCTION_POINTER>(null_glProgramUniform3i64ARB)},
+  {"glVertexAttrib2d",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib2d)},
+  {"glVertexAttrib2f",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib2f)},
+  {"glMultiDrawElementsEXT",reinterpret_cast<FUNCTION_POINTER>(null_glMultiDrawElementsEXT)},
+  {"glVertexAttrib3dv",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib3dv)},
+  {"glMultiTexCoord2bOES",reinterpret_cast<FUNCTION_POINTER>(null_glMultiTexCoord2bOES)},
+  {"glVertexAttrib2s",reinterpret_cast<FUNCTION_POINTER>(null_glVertexAttrib2s)},
+  {"glTexImage3DMultisample",reinterpret_cast<FUNCTION_POINTER>(null_glTexImage3DMultisample)},
+  {"glGetUniformBlockIndex",reinterpret_cast<FUNCTION_POINTER>(null_glGetUniformBlockIndex)},
+  {"glFrontFace",reinterpret_cast<FUNCTION_POINTER>(null_glFrontFace)},
+  {"glEvalCoord1xOES",reinterpret_cast<FUNCTION_POINTER>(null_glEvalCoord1xOES)},
+  {"glDrawArraysInstancedBaseInstance",reinterpret_cast<FUNCTION_POINTER>(null_glDrawArraysInstancedBaseInstance)},
+  {"glIsPointInStrokePathNV",reinterpret_cast<FUNCTION_POINTER>(null_glIsPointInStrokePathNV)},
+};
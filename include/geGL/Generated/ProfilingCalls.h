@@ -0,0 +1,2858 @@
+FunctionTable::MEMBER_FUNCTION_POINTER const*profiledFunctions = (FunctionTable::MEMBER_FUNCTION_POINTER const*)&this->FunctionTable::m_ptr_glMultiDrawArraysIndirectBindlessCountNV;
+for(size_t i=0;i<GE_GL_NOF_OPENGL_FUNCTIONS;++i)
+  this->m_profiledFunctions[i] = profiledFunctions[i];
+if(this->m_ptr_glMultiDrawArraysIndirectBindlessCountNV)this->m_ptr_glMultiDrawArraysIndirectBindlessCountNV = (FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSINDIRECTBINDLESSCOUNTNVPROC)&ProfilingTableDecorator::m_glMultiDrawArraysIndirectBindlessCountNV_profiling;
+if(this->m_ptr_glTextureParameterfv)this->m_ptr_glTextureParameterfv = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERFVPROC)&ProfilingTableDecorator::m_glTextureParameterfv_profiling;
+if(this->m_ptr_glGetListParameterivSGIX)this->m_ptr_glGetListParameterivSGIX = (FunctionTable::MEMBERPFNGLGETLISTPARAMETERIVSGIXPROC)&ProfilingTableDecorator::m_glGetListParameterivSGIX_profiling;
+if(this->m_ptr_glProgramUniform1i64ARB)this->m_ptr_glProgramUniform1i64ARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1I64ARBPROC)&ProfilingTableDecorator::m_glProgramUniform1i64ARB_profiling;
+if(this->m_ptr_glVertexArrayElementBuffer)this->m_ptr_glVertexArrayElementBuffer = (FunctionTable::MEMBERPFNGLVERTEXARRAYELEMENTBUFFERPROC)&ProfilingTableDecorator::m_glVertexArrayElementBuffer_profiling;
+if(this->m_ptr_glHintPGI)this->m_ptr_glHintPGI = (FunctionTable::MEMBERPFNGLHINTPGIPROC)&ProfilingTableDecorator::m_glHintPGI_profiling;
+if(this->m_ptr_glStencilMaskSeparate)this->m_ptr_glStencilMaskSeparate = (FunctionTable::MEMBERPFNGLSTENCILMASKSEPARATEPROC)&ProfilingTableDecorator::m_glStencilMaskSeparate_profiling;
+if(this->m_ptr_glGetFramebufferAttachmentParameterivEXT)this->m_ptr_glGetFramebufferAttachmentParameterivEXT = (FunctionTable::MEMBERPFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVEXTPROC)&ProfilingTableDecorator::m_glGetFramebufferAttachmentParameterivEXT_profiling;
+if(this->m_ptr_glTextureStorage3DMultisample)this->m_ptr_glTextureStorage3DMultisample = (FunctionTable::MEMBERPFNGLTEXTURESTORAGE3DMULTISAMPLEPROC)&ProfilingTableDecorator::m_glTextureStorage3DMultisample_profiling;
+if(this->m_ptr_glGetIntegerIndexedvEXT)this->m_ptr_glGetIntegerIndexedvEXT = (FunctionTable::MEMBERPFNGLGETINTEGERINDEXEDVEXTPROC)&ProfilingTableDecorator::m_glGetIntegerIndexedvEXT_profiling;
+if(this->m_ptr_glCopyTexImage1D)this->m_ptr_glCopyTexImage1D = (FunctionTable::MEMBERPFNGLCOPYTEXIMAGE1DPROC)&ProfilingTableDecorator::m_glCopyTexImage1D_profiling;
+if(this->m_ptr_glVertexAttrib4usv)this->m_ptr_glVertexAttrib4usv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4USVPROC)&ProfilingTableDecorator::m_glVertexAttrib4usv_profiling;
+if(this->m_ptr_glTexRenderbufferNV)this->m_ptr_glTexRenderbufferNV = (FunctionTable::MEMBERPFNGLTEXRENDERBUFFERNVPROC)&ProfilingTableDecorator::m_glTexRenderbufferNV_profiling;
+if(this->m_ptr_glVertexAttrib3hvNV)this->m_ptr_glVertexAttrib3hvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3HVNVPROC)&ProfilingTableDecorator::m_glVertexAttrib3hvNV_profiling;
+if(this->m_ptr_glProgramUniform4ui64ARB)this->m_ptr_glProgramUniform4ui64ARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UI64ARBPROC)&ProfilingTableDecorator::m_glProgramUniform4ui64ARB_profiling;
+if(this->m_ptr_glInstrumentsBufferSGIX)this->m_ptr_glInstrumentsBufferSGIX = (FunctionTable::MEMBERPFNGLINSTRUMENTSBUFFERSGIXPROC)&ProfilingTableDecorator::m_glInstrumentsBufferSGIX_profiling;
+if(this->m_ptr_glIndexi)this->m_ptr_glIndexi = (FunctionTable::MEMBERPFNGLINDEXIPROC)&ProfilingTableDecorator::m_glIndexi_profiling;
+if(this->m_ptr_glMultiTexCoord2sARB)this->m_ptr_glMultiTexCoord2sARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2SARBPROC)&ProfilingTableDecorator::m_glMultiTexCoord2sARB_profiling;
+if(this->m_ptr_glProgramEnvParameter4fARB)this->m_ptr_glProgramEnvParameter4fARB = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETER4FARBPROC)&ProfilingTableDecorator::m_glProgramEnvParameter4fARB_profiling;
+if(this->m_ptr_glCompressedTexSubImage3D)this->m_ptr_glCompressedTexSubImage3D = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXSUBIMAGE3DPROC)&ProfilingTableDecorator::m_glCompressedTexSubImage3D_profiling;
+if(this->m_ptr_glEvalCoord2d)this->m_ptr_glEvalCoord2d = (FunctionTable::MEMBERPFNGLEVALCOORD2DPROC)&ProfilingTableDecorator::m_glEvalCoord2d_profiling;
+if(this->m_ptr_glEvalCoord2f)this->m_ptr_glEvalCoord2f = (FunctionTable::MEMBERPFNGLEVALCOORD2FPROC)&ProfilingTableDecorator::m_glEvalCoord2f_profiling;
+if(this->m_ptr_glIndexd)this->m_ptr_glIndexd = (FunctionTable::MEMBERPFNGLINDEXDPROC)&ProfilingTableDecorator::m_glIndexd_profiling;
+if(this->m_ptr_glSecondaryColor3hvNV)this->m_ptr_glSecondaryColor3hvNV = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3HVNVPROC)&ProfilingTableDecorator::m_glSecondaryColor3hvNV_profiling;
+if(this->m_ptr_glIndexf)this->m_ptr_glIndexf = (FunctionTable::MEMBERPFNGLINDEXFPROC)&ProfilingTableDecorator::m_glIndexf_profiling;
+if(this->m_ptr_glFrustumxOES)this->m_ptr_glFrustumxOES = (FunctionTable::MEMBERPFNGLFRUSTUMXOESPROC)&ProfilingTableDecorator::m_glFrustumxOES_profiling;
+if(this->m_ptr_glTextureStorage3DEXT)this->m_ptr_glTextureStorage3DEXT = (FunctionTable::MEMBERPFNGLTEXTURESTORAGE3DEXTPROC)&ProfilingTableDecorator::m_glTextureStorage3DEXT_profiling;
+if(this->m_ptr_glDrawCommandsStatesNV)this->m_ptr_glDrawCommandsStatesNV = (FunctionTable::MEMBERPFNGLDRAWCOMMANDSSTATESNVPROC)&ProfilingTableDecorator::m_glDrawCommandsStatesNV_profiling;
+if(this->m_ptr_glUniform4uiEXT)this->m_ptr_glUniform4uiEXT = (FunctionTable::MEMBERPFNGLUNIFORM4UIEXTPROC)&ProfilingTableDecorator::m_glUniform4uiEXT_profiling;
+if(this->m_ptr_glProgramUniform3ui64ARB)this->m_ptr_glProgramUniform3ui64ARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UI64ARBPROC)&ProfilingTableDecorator::m_glProgramUniform3ui64ARB_profiling;
+if(this->m_ptr_glIndexs)this->m_ptr_glIndexs = (FunctionTable::MEMBERPFNGLINDEXSPROC)&ProfilingTableDecorator::m_glIndexs_profiling;
+if(this->m_ptr_glVertexArrayBindVertexBufferEXT)this->m_ptr_glVertexArrayBindVertexBufferEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYBINDVERTEXBUFFEREXTPROC)&ProfilingTableDecorator::m_glVertexArrayBindVertexBufferEXT_profiling;
+if(this->m_ptr_glConvolutionParameteriEXT)this->m_ptr_glConvolutionParameteriEXT = (FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERIEXTPROC)&ProfilingTableDecorator::m_glConvolutionParameteriEXT_profiling;
+if(this->m_ptr_glColor4ubVertex2fSUN)this->m_ptr_glColor4ubVertex2fSUN = (FunctionTable::MEMBERPFNGLCOLOR4UBVERTEX2FSUNPROC)&ProfilingTableDecorator::m_glColor4ubVertex2fSUN_profiling;
+if(this->m_ptr_glProgramUniform1ivEXT)this->m_ptr_glProgramUniform1ivEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1IVEXTPROC)&ProfilingTableDecorator::m_glProgramUniform1ivEXT_profiling;
+if(this->m_ptr_glGetnMapfv)this->m_ptr_glGetnMapfv = (FunctionTable::MEMBERPFNGLGETNMAPFVPROC)&ProfilingTableDecorator::m_glGetnMapfv_profiling;
+if(this->m_ptr_glTransformFeedbackBufferRange)this->m_ptr_glTransformFeedbackBufferRange = (FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC)&ProfilingTableDecorator::m_glTransformFeedbackBufferRange_profiling;
+if(this->m_ptr_glPathGlyphsNV)this->m_ptr_glPathGlyphsNV = (FunctionTable::MEMBERPFNGLPATHGLYPHSNVPROC)&ProfilingTableDecorator::m_glPathGlyphsNV_profiling;
+if(this->m_ptr_glSecondaryColor3fv)this->m_ptr_glSecondaryColor3fv = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3FVPROC)&ProfilingTableDecorator::m_glSecondaryColor3fv_profiling;
+if(this->m_ptr_glGetCombinerInputParameterivNV)this->m_ptr_glGetCombinerInputParameterivNV = (FunctionTable::MEMBERPFNGLGETCOMBINERINPUTPARAMETERIVNVPROC)&ProfilingTableDecorator::m_glGetCombinerInputParameterivNV_profiling;
+if(this->m_ptr_glEndPerfMonitorAMD)this->m_ptr_glEndPerfMonitorAMD = (FunctionTable::MEMBERPFNGLENDPERFMONITORAMDPROC)&ProfilingTableDecorator::m_glEndPerfMonitorAMD_profiling;
+if(this->m_ptr_glPointParameterfvARB)this->m_ptr_glPointParameterfvARB = (FunctionTable::MEMBERPFNGLPOINTPARAMETERFVARBPROC)&ProfilingTableDecorator::m_glPointParameterfvARB_profiling;
+if(this->m_ptr_glVertex2xOES)this->m_ptr_glVertex2xOES = (FunctionTable::MEMBERPFNGLVERTEX2XOESPROC)&ProfilingTableDecorator::m_glVertex2xOES_profiling;
+if(this->m_ptr_glDrawElementsInstancedBaseInstance)this->m_ptr_glDrawElementsInstancedBaseInstance = (FunctionTable::MEMBERPFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC)&ProfilingTableDecorator::m_glDrawElementsInstancedBaseInstance_profiling;
+if(this->m_ptr_glMultTransposeMatrixdARB)this->m_ptr_glMultTransposeMatrixdARB = (FunctionTable::MEMBERPFNGLMULTTRANSPOSEMATRIXDARBPROC)&ProfilingTableDecorator::m_glMultTransposeMatrixdARB_profiling;
+if(this->m_ptr_glVertexAttribL4dEXT)this->m_ptr_glVertexAttribL4dEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL4DEXTPROC)&ProfilingTableDecorator::m_glVertexAttribL4dEXT_profiling;
+if(this->m_ptr_glVertex4iv)this->m_ptr_glVertex4iv = (FunctionTable::MEMBERPFNGLVERTEX4IVPROC)&ProfilingTableDecorator::m_glVertex4iv_profiling;
+if(this->m_ptr_glCoverStrokePathInstancedNV)this->m_ptr_glCoverStrokePathInstancedNV = (FunctionTable::MEMBERPFNGLCOVERSTROKEPATHINSTANCEDNVPROC)&ProfilingTableDecorator::m_glCoverStrokePathInstancedNV_profiling;
+if(this->m_ptr_glDeformSGIX)this->m_ptr_glDeformSGIX = (FunctionTable::MEMBERPFNGLDEFORMSGIXPROC)&ProfilingTableDecorator::m_glDeformSGIX_profiling;
+if(this->m_ptr_glUniform2ui64NV)this->m_ptr_glUniform2ui64NV = (FunctionTable::MEMBERPFNGLUNIFORM2UI64NVPROC)&ProfilingTableDecorator::m_glUniform2ui64NV_profiling;
+if(this->m_ptr_glCopyPathNV)this->m_ptr_glCopyPathNV = (FunctionTable::MEMBERPFNGLCOPYPATHNVPROC)&ProfilingTableDecorator::m_glCopyPathNV_profiling;
+if(this->m_ptr_glVertexAttribP4ui)this->m_ptr_glVertexAttribP4ui = (FunctionTable::MEMBERPFNGLVERTEXATTRIBP4UIPROC)&ProfilingTableDecorator::m_glVertexAttribP4ui_profiling;
+if(this->m_ptr_glVertexAttribL2d)this->m_ptr_glVertexAttribL2d = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL2DPROC)&ProfilingTableDecorator::m_glVertexAttribL2d_profiling;
+if(this->m_ptr_glGetMultisamplefv)this->m_ptr_glGetMultisamplefv = (FunctionTable::MEMBERPFNGLGETMULTISAMPLEFVPROC)&ProfilingTableDecorator::m_glGetMultisamplefv_profiling;
+if(this->m_ptr_glCompressedMultiTexSubImage3DEXT)this->m_ptr_glCompressedMultiTexSubImage3DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDMULTITEXSUBIMAGE3DEXTPROC)&ProfilingTableDecorator::m_glCompressedMultiTexSubImage3DEXT_profiling;
+if(this->m_ptr_glVDPAURegisterOutputSurfaceNV)this->m_ptr_glVDPAURegisterOutputSurfaceNV = (FunctionTable::MEMBERPFNGLVDPAUREGISTEROUTPUTSURFACENVPROC)&ProfilingTableDecorator::m_glVDPAURegisterOutputSurfaceNV_profiling;
+if(this->m_ptr_glMinSampleShading)this->m_ptr_glMinSampleShading = (FunctionTable::MEMBERPFNGLMINSAMPLESHADINGPROC)&ProfilingTableDecorator::m_glMinSampleShading_profiling;
+if(this->m_ptr_glProgramUniform4fEXT)this->m_ptr_glProgramUniform4fEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4FEXTPROC)&ProfilingTableDecorator::m_glProgramUniform4fEXT_profiling;
+if(this->m_ptr_glCoverStrokePathNV)this->m_ptr_glCoverStrokePathNV = (FunctionTable::MEMBERPFNGLCOVERSTROKEPATHNVPROC)&ProfilingTableDecorator::m_glCoverStrokePathNV_profiling;
+if(this->m_ptr_glTextureImage2DMultisampleNV)this->m_ptr_glTextureImage2DMultisampleNV = (FunctionTable::MEMBERPFNGLTEXTUREIMAGE2DMULTISAMPLENVPROC)&ProfilingTableDecorator::m_glTextureImage2DMultisampleNV_profiling;
+if(this->m_ptr_glVertex3bOES)this->m_ptr_glVertex3bOES = (FunctionTable::MEMBERPFNGLVERTEX3BOESPROC)&ProfilingTableDecorator::m_glVertex3bOES_profiling;
+if(this->m_ptr_glTessellationFactorAMD)this->m_ptr_glTessellationFactorAMD = (FunctionTable::MEMBERPFNGLTESSELLATIONFACTORAMDPROC)&ProfilingTableDecorator::m_glTessellationFactorAMD_profiling;
+if(this->m_ptr_glDebugMessageControl)this->m_ptr_glDebugMessageControl = (FunctionTable::MEMBERPFNGLDEBUGMESSAGECONTROLPROC)&ProfilingTableDecorator::m_glDebugMessageControl_profiling;
+if(this->m_ptr_glIsObjectBufferATI)this->m_ptr_glIsObjectBufferATI = (FunctionTable::MEMBERPFNGLISOBJECTBUFFERATIPROC)&ProfilingTableDecorator::m_glIsObjectBufferATI_profiling;
+if(this->m_ptr_glPopAttrib)this->m_ptr_glPopAttrib = (FunctionTable::MEMBERPFNGLPOPATTRIBPROC)&ProfilingTableDecorator::m_glPopAttrib_profiling;
+if(this->m_ptr_glProgramUniform4iEXT)this->m_ptr_glProgramUniform4iEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4IEXTPROC)&ProfilingTableDecorator::m_glProgramUniform4iEXT_profiling;
+if(this->m_ptr_glVertexAttrib4ubNV)this->m_ptr_glVertexAttrib4ubNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4UBNVPROC)&ProfilingTableDecorator::m_glVertexAttrib4ubNV_profiling;
+if(this->m_ptr_glColorMaterial)this->m_ptr_glColorMaterial = (FunctionTable::MEMBERPFNGLCOLORMATERIALPROC)&ProfilingTableDecorator::m_glColorMaterial_profiling;
+if(this->m_ptr_glVertexAttrib2svARB)this->m_ptr_glVertexAttrib2svARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2SVARBPROC)&ProfilingTableDecorator::m_glVertexAttrib2svARB_profiling;
+if(this->m_ptr_glMinSampleShadingARB)this->m_ptr_glMinSampleShadingARB = (FunctionTable::MEMBERPFNGLMINSAMPLESHADINGARBPROC)&ProfilingTableDecorator::m_glMinSampleShadingARB_profiling;
+if(this->m_ptr_glColor3b)this->m_ptr_glColor3b = (FunctionTable::MEMBERPFNGLCOLOR3BPROC)&ProfilingTableDecorator::m_glColor3b_profiling;
+if(this->m_ptr_glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN)this->m_ptr_glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUITEXCOORD2FNORMAL3FVERTEX3FSUNPROC)&ProfilingTableDecorator::m_glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN_profiling;
+if(this->m_ptr_glColor3f)this->m_ptr_glColor3f = (FunctionTable::MEMBERPFNGLCOLOR3FPROC)&ProfilingTableDecorator::m_glColor3f_profiling;
+if(this->m_ptr_glVDPAUGetSurfaceivNV)this->m_ptr_glVDPAUGetSurfaceivNV = (FunctionTable::MEMBERPFNGLVDPAUGETSURFACEIVNVPROC)&ProfilingTableDecorator::m_glVDPAUGetSurfaceivNV_profiling;
+if(this->m_ptr_glColor3d)this->m_ptr_glColor3d = (FunctionTable::MEMBERPFNGLCOLOR3DPROC)&ProfilingTableDecorator::m_glColor3d_profiling;
+if(this->m_ptr_glGetnMapiv)this->m_ptr_glGetnMapiv = (FunctionTable::MEMBERPFNGLGETNMAPIVPROC)&ProfilingTableDecorator::m_glGetnMapiv_profiling;
+if(this->m_ptr_glColor3i)this->m_ptr_glColor3i = (FunctionTable::MEMBERPFNGLCOLOR3IPROC)&ProfilingTableDecorator::m_glColor3i_profiling;
+if(this->m_ptr_glGetInternalformatSampleivNV)this->m_ptr_glGetInternalformatSampleivNV = (FunctionTable::MEMBERPFNGLGETINTERNALFORMATSAMPLEIVNVPROC)&ProfilingTableDecorator::m_glGetInternalformatSampleivNV_profiling;
+if(this->m_ptr_glVertexAttrib4ubv)this->m_ptr_glVertexAttrib4ubv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4UBVPROC)&ProfilingTableDecorator::m_glVertexAttrib4ubv_profiling;
+if(this->m_ptr_glColor3s)this->m_ptr_glColor3s = (FunctionTable::MEMBERPFNGLCOLOR3SPROC)&ProfilingTableDecorator::m_glColor3s_profiling;
+if(this->m_ptr_glVertexAttribs4hvNV)this->m_ptr_glVertexAttribs4hvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS4HVNVPROC)&ProfilingTableDecorator::m_glVertexAttribs4hvNV_profiling;
+if(this->m_ptr_glVertexAttrib4NubvARB)this->m_ptr_glVertexAttrib4NubvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUBVARBPROC)&ProfilingTableDecorator::m_glVertexAttrib4NubvARB_profiling;
+if(this->m_ptr_glMultiTexCoord3hvNV)this->m_ptr_glMultiTexCoord3hvNV = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3HVNVPROC)&ProfilingTableDecorator::m_glMultiTexCoord3hvNV_profiling;
+if(this->m_ptr_glMatrixPushEXT)this->m_ptr_glMatrixPushEXT = (FunctionTable::MEMBERPFNGLMATRIXPUSHEXTPROC)&ProfilingTableDecorator::m_glMatrixPushEXT_profiling;
+if(this->m_ptr_glProgramUniform2fEXT)this->m_ptr_glProgramUniform2fEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2FEXTPROC)&ProfilingTableDecorator::m_glProgramUniform2fEXT_profiling;
+if(this->m_ptr_glGetVertexArrayIndexediv)this->m_ptr_glGetVertexArrayIndexediv = (FunctionTable::MEMBERPFNGLGETVERTEXARRAYINDEXEDIVPROC)&ProfilingTableDecorator::m_glGetVertexArrayIndexediv_profiling;
+if(this->m_ptr_glBlitFramebuffer)this->m_ptr_glBlitFramebuffer = (FunctionTable::MEMBERPFNGLBLITFRAMEBUFFERPROC)&ProfilingTableDecorator::m_glBlitFramebuffer_profiling;
+if(this->m_ptr_glMultiTexCoordP2ui)this->m_ptr_glMultiTexCoordP2ui = (FunctionTable::MEMBERPFNGLMULTITEXCOORDP2UIPROC)&ProfilingTableDecorator::m_glMultiTexCoordP2ui_profiling;
+if(this->m_ptr_glColorPointerListIBM)this->m_ptr_glColorPointerListIBM = (FunctionTable::MEMBERPFNGLCOLORPOINTERLISTIBMPROC)&ProfilingTableDecorator::m_glColorPointerListIBM_profiling;
+if(this->m_ptr_glVertexAttribL4d)this->m_ptr_glVertexAttribL4d = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL4DPROC)&ProfilingTableDecorator::m_glVertexAttribL4d_profiling;
+if(this->m_ptr_glGetFragmentMaterialfvSGIX)this->m_ptr_glGetFragmentMaterialfvSGIX = (FunctionTable::MEMBERPFNGLGETFRAGMENTMATERIALFVSGIXPROC)&ProfilingTableDecorator::m_glGetFragmentMaterialfvSGIX_profiling;
+if(this->m_ptr_glVertex2iv)this->m_ptr_glVertex2iv = (FunctionTable::MEMBERPFNGLVERTEX2IVPROC)&ProfilingTableDecorator::m_glVertex2iv_profiling;
+if(this->m_ptr_glGetTexEnvxvOES)this->m_ptr_glGetTexEnvxvOES = (FunctionTable::MEMBERPFNGLGETTEXENVXVOESPROC)&ProfilingTableDecorator::m_glGetTexEnvxvOES_profiling;
+if(this->m_ptr_glUniformMatrix3dv)this->m_ptr_glUniformMatrix3dv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX3DVPROC)&ProfilingTableDecorator::m_glUniformMatrix3dv_profiling;
+if(this->m_ptr_glGetVertexAttribLdvEXT)this->m_ptr_glGetVertexAttribLdvEXT = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBLDVEXTPROC)&ProfilingTableDecorator::m_glGetVertexAttribLdvEXT_profiling;
+if(this->m_ptr_glTexCoordP3uiv)this->m_ptr_glTexCoordP3uiv = (FunctionTable::MEMBERPFNGLTEXCOORDP3UIVPROC)&ProfilingTableDecorator::m_glTexCoordP3uiv_profiling;
+if(this->m_ptr_glDeformationMap3dSGIX)this->m_ptr_glDeformationMap3dSGIX = (FunctionTable::MEMBERPFNGLDEFORMATIONMAP3DSGIXPROC)&ProfilingTableDecorator::m_glDeformationMap3dSGIX_profiling;
+if(this->m_ptr_glResumeTransformFeedback)this->m_ptr_glResumeTransformFeedback = (FunctionTable::MEMBERPFNGLRESUMETRANSFORMFEEDBACKPROC)&ProfilingTableDecorator::m_glResumeTransformFeedback_profiling;
+if(this->m_ptr_glInsertEventMarkerEXT)this->m_ptr_glInsertEventMarkerEXT = (FunctionTable::MEMBERPFNGLINSERTEVENTMARKEREXTPROC)&ProfilingTableDecorator::m_glInsertEventMarkerEXT_profiling;
+if(this->m_ptr_glTessellationModeAMD)this->m_ptr_glTessellationModeAMD = (FunctionTable::MEMBERPFNGLTESSELLATIONMODEAMDPROC)&ProfilingTableDecorator::m_glTessellationModeAMD_profiling;
+if(this->m_ptr_glDrawCommandsAddressNV)this->m_ptr_glDrawCommandsAddressNV = (FunctionTable::MEMBERPFNGLDRAWCOMMANDSADDRESSNVPROC)&ProfilingTableDecorator::m_glDrawCommandsAddressNV_profiling;
+if(this->m_ptr_glFogi)this->m_ptr_glFogi = (FunctionTable::MEMBERPFNGLFOGIPROC)&ProfilingTableDecorator::m_glFogi_profiling;
+if(this->m_ptr_glGetTexParameterxvOES)this->m_ptr_glGetTexParameterxvOES = (FunctionTable::MEMBERPFNGLGETTEXPARAMETERXVOESPROC)&ProfilingTableDecorator::m_glGetTexParameterxvOES_profiling;
+if(this->m_ptr_glVertexPointer)this->m_ptr_glVertexPointer = (FunctionTable::MEMBERPFNGLVERTEXPOINTERPROC)&ProfilingTableDecorator::m_glVertexPointer_profiling;
+if(this->m_ptr_glGetPerfMonitorCounterDataAMD)this->m_ptr_glGetPerfMonitorCounterDataAMD = (FunctionTable::MEMBERPFNGLGETPERFMONITORCOUNTERDATAAMDPROC)&ProfilingTableDecorator::m_glGetPerfMonitorCounterDataAMD_profiling;
+if(this->m_ptr_glFogf)this->m_ptr_glFogf = (FunctionTable::MEMBERPFNGLFOGFPROC)&ProfilingTableDecorator::m_glFogf_profiling;
+if(this->m_ptr_glMultiTexCoord1d)this->m_ptr_glMultiTexCoord1d = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1DPROC)&ProfilingTableDecorator::m_glMultiTexCoord1d_profiling;
+if(this->m_ptr_glMultiTexCoord1f)this->m_ptr_glMultiTexCoord1f = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1FPROC)&ProfilingTableDecorator::m_glMultiTexCoord1f_profiling;
+if(this->m_ptr_glGetMultiTexParameterivEXT)this->m_ptr_glGetMultiTexParameterivEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXPARAMETERIVEXTPROC)&ProfilingTableDecorator::m_glGetMultiTexParameterivEXT_profiling;
+if(this->m_ptr_glProgramUniformMatrix3x4fvEXT)this->m_ptr_glProgramUniformMatrix3x4fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X4FVEXTPROC)&ProfilingTableDecorator::m_glProgramUniformMatrix3x4fvEXT_profiling;
+if(this->m_ptr_glVertexAttribI2i)this->m_ptr_glVertexAttribI2i = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI2IPROC)&ProfilingTableDecorator::m_glVertexAttribI2i_profiling;
+if(this->m_ptr_glMultiTexCoord1i)this->m_ptr_glMultiTexCoord1i = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1IPROC)&ProfilingTableDecorator::m_glMultiTexCoord1i_profiling;
+if(this->m_ptr_glUniform1ui64vARB)this->m_ptr_glUniform1ui64vARB = (FunctionTable::MEMBERPFNGLUNIFORM1UI64VARBPROC)&ProfilingTableDecorator::m_glUniform1ui64vARB_profiling;
+if(this->m_ptr_glLoadProgramNV)this->m_ptr_glLoadProgramNV = (FunctionTable::MEMBERPFNGLLOADPROGRAMNVPROC)&ProfilingTableDecorator::m_glLoadProgramNV_profiling;
+if(this->m_ptr_glWriteMaskEXT)this->m_ptr_glWriteMaskEXT = (FunctionTable::MEMBERPFNGLWRITEMASKEXTPROC)&ProfilingTableDecorator::m_glWriteMaskEXT_profiling;
+if(this->m_ptr_glGetGraphicsResetStatus)this->m_ptr_glGetGraphicsResetStatus = (FunctionTable::MEMBERPFNGLGETGRAPHICSRESETSTATUSPROC)&ProfilingTableDecorator::m_glGetGraphicsResetStatus_profiling;
+if(this->m_ptr_glVertexAttrib1fv)this->m_ptr_glVertexAttrib1fv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1FVPROC)&ProfilingTableDecorator::m_glVertexAttrib1fv_profiling;
+if(this->m_ptr_glIsEnabled)this->m_ptr_glIsEnabled = (FunctionTable::MEMBERPFNGLISENABLEDPROC)&ProfilingTableDecorator::m_glIsEnabled_profiling;
+if(this->m_ptr_glImageTransformParameterfvHP)this->m_ptr_glImageTransformParameterfvHP = (FunctionTable::MEMBERPFNGLIMAGETRANSFORMPARAMETERFVHPPROC)&ProfilingTableDecorator::m_glImageTransformParameterfvHP_profiling;
+if(this->m_ptr_glFramebufferTexture2D)this->m_ptr_glFramebufferTexture2D = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURE2DPROC)&ProfilingTableDecorator::m_glFramebufferTexture2D_profiling;
+if(this->m_ptr_glGetFragmentLightfvSGIX)this->m_ptr_glGetFragmentLightfvSGIX = (FunctionTable::MEMBERPFNGLGETFRAGMENTLIGHTFVSGIXPROC)&ProfilingTableDecorator::m_glGetFragmentLightfvSGIX_profiling;
+if(this->m_ptr_glListParameterfSGIX)this->m_ptr_glListParameterfSGIX = (FunctionTable::MEMBERPFNGLLISTPARAMETERFSGIXPROC)&ProfilingTableDecorator::m_glListParameterfSGIX_profiling;
+if(this->m_ptr_glTexCoord3sv)this->m_ptr_glTexCoord3sv = (FunctionTable::MEMBERPFNGLTEXCOORD3SVPROC)&ProfilingTableDecorator::m_glTexCoord3sv_profiling;
+if(this->m_ptr_glNamedFramebufferRenderbufferEXT)this->m_ptr_glNamedFramebufferRenderbufferEXT = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERRENDERBUFFEREXTPROC)&ProfilingTableDecorator::m_glNamedFramebufferRenderbufferEXT_profiling;
+if(this->m_ptr_glFragmentLightModelfSGIX)this->m_ptr_glFragmentLightModelfSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTLIGHTMODELFSGIXPROC)&ProfilingTableDecorator::m_glFragmentLightModelfSGIX_profiling;
+if(this->m_ptr_glIndexPointerEXT)this->m_ptr_glIndexPointerEXT = (FunctionTable::MEMBERPFNGLINDEXPOINTEREXTPROC)&ProfilingTableDecorator::m_glIndexPointerEXT_profiling;
+if(this->m_ptr_glBlendEquationSeparateATI)this->m_ptr_glBlendEquationSeparateATI = (FunctionTable::MEMBERPFNGLBLENDEQUATIONSEPARATEATIPROC)&ProfilingTableDecorator::m_glBlendEquationSeparateATI_profiling;
+if(this->m_ptr_glVertexArrayAttribIFormat)this->m_ptr_glVertexArrayAttribIFormat = (FunctionTable::MEMBERPFNGLVERTEXARRAYATTRIBIFORMATPROC)&ProfilingTableDecorator::m_glVertexArrayAttribIFormat_profiling;
+if(this->m_ptr_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN)this->m_ptr_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUITEXCOORD2FCOLOR4FNORMAL3FVERTEX3FSUNPROC)&ProfilingTableDecorator::m_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN_profiling;
+if(this->m_ptr_glReplacementCodeubvSUN)this->m_ptr_glReplacementCodeubvSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUBVSUNPROC)&ProfilingTableDecorator::m_glReplacementCodeubvSUN_profiling;
+if(this->m_ptr_glGenFramebuffers)this->m_ptr_glGenFramebuffers = (FunctionTable::MEMBERPFNGLGENFRAMEBUFFERSPROC)&ProfilingTableDecorator::m_glGenFramebuffers_profiling;
+if(this->m_ptr_glPixelMapx)this->m_ptr_glPixelMapx = (FunctionTable::MEMBERPFNGLPIXELMAPXPROC)&ProfilingTableDecorator::m_glPixelMapx_profiling;
+if(this->m_ptr_glTexSubImage3DEXT)this->m_ptr_glTexSubImage3DEXT = (FunctionTable::MEMBERPFNGLTEXSUBIMAGE3DEXTPROC)&ProfilingTableDecorator::m_glTexSubImage3DEXT_profiling;
+if(this->m_ptr_glGetAttachedShaders)this->m_ptr_glGetAttachedShaders = (FunctionTable::MEMBERPFNGLGETATTACHEDSHADERSPROC)&ProfilingTableDecorator::m_glGetAttachedShaders_profiling;
+if(this->m_ptr_glGetPixelTexGenParameterfvSGIS)this->m_ptr_glGetPixelTexGenParameterfvSGIS = (FunctionTable::MEMBERPFNGLGETPIXELTEXGENPARAMETERFVSGISPROC)&ProfilingTableDecorator::m_glGetPixelTexGenParameterfvSGIS_profiling;
+if(this->m_ptr_glReplacementCodeuiNormal3fVertex3fSUN)this->m_ptr_glReplacementCodeuiNormal3fVertex3fSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUINORMAL3FVERTEX3FSUNPROC)&ProfilingTableDecorator::m_glReplacementCodeuiNormal3fVertex3fSUN_profiling;
+if(this->m_ptr_glGetDebugMessageLogAMD)this->m_ptr_glGetDebugMessageLogAMD = (FunctionTable::MEMBERPFNGLGETDEBUGMESSAGELOGAMDPROC)&ProfilingTableDecorator::m_glGetDebugMessageLogAMD_profiling;
+if(this->m_ptr_glVertexStream4sATI)this->m_ptr_glVertexStream4sATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM4SATIPROC)&ProfilingTableDecorator::m_glVertexStream4sATI_profiling;
+if(this->m_ptr_glVertexAttribs4dvNV)this->m_ptr_glVertexAttribs4dvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS4DVNVPROC)&ProfilingTableDecorator::m_glVertexAttribs4dvNV_profiling;
+if(this->m_ptr_glGetnMapdvARB)this->m_ptr_glGetnMapdvARB = (FunctionTable::MEMBERPFNGLGETNMAPDVARBPROC)&ProfilingTableDecorator::m_glGetnMapdvARB_profiling;
+if(this->m_ptr_glOrthofOES)this->m_ptr_glOrthofOES = (FunctionTable::MEMBERPFNGLORTHOFOESPROC)&ProfilingTableDecorator::m_glOrthofOES_profiling;
+if(this->m_ptr_glViewportArrayv)this->m_ptr_glViewportArrayv = (FunctionTable::MEMBERPFNGLVIEWPORTARRAYVPROC)&ProfilingTableDecorator::m_glViewportArrayv_profiling;
+if(this->m_ptr_glDrawElementArrayATI)this->m_ptr_glDrawElementArrayATI = (FunctionTable::MEMBERPFNGLDRAWELEMENTARRAYATIPROC)&ProfilingTableDecorator::m_glDrawElementArrayATI_profiling;
+if(this->m_ptr_glGetPathColorGenfvNV)this->m_ptr_glGetPathColorGenfvNV = (FunctionTable::MEMBERPFNGLGETPATHCOLORGENFVNVPROC)&ProfilingTableDecorator::m_glGetPathColorGenfvNV_profiling;
+if(this->m_ptr_glWindowPos3iMESA)this->m_ptr_glWindowPos3iMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS3IMESAPROC)&ProfilingTableDecorator::m_glWindowPos3iMESA_profiling;
+if(this->m_ptr_glMultiTexCoord2s)this->m_ptr_glMultiTexCoord2s = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2SPROC)&ProfilingTableDecorator::m_glMultiTexCoord2s_profiling;
+if(this->m_ptr_glVertex3dv)this->m_ptr_glVertex3dv = (FunctionTable::MEMBERPFNGLVERTEX3DVPROC)&ProfilingTableDecorator::m_glVertex3dv_profiling;
+if(this->m_ptr_glVertexAttribI3uivEXT)this->m_ptr_glVertexAttribI3uivEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI3UIVEXTPROC)&ProfilingTableDecorator::m_glVertexAttribI3uivEXT_profiling;
+if(this->m_ptr_glUniform3ui64ARB)this->m_ptr_glUniform3ui64ARB = (FunctionTable::MEMBERPFNGLUNIFORM3UI64ARBPROC)&ProfilingTableDecorator::m_glUniform3ui64ARB_profiling;
+if(this->m_ptr_glVertexAttrib2fvNV)this->m_ptr_glVertexAttrib2fvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2FVNVPROC)&ProfilingTableDecorator::m_glVertexAttrib2fvNV_profiling;
+if(this->m_ptr_glGetNamedBufferSubDataEXT)this->m_ptr_glGetNamedBufferSubDataEXT = (FunctionTable::MEMBERPFNGLGETNAMEDBUFFERSUBDATAEXTPROC)&ProfilingTableDecorator::m_glGetNamedBufferSubDataEXT_profiling;
+if(this->m_ptr_glConvolutionFilter2D)this->m_ptr_glConvolutionFilter2D = (FunctionTable::MEMBERPFNGLCONVOLUTIONFILTER2DPROC)&ProfilingTableDecorator::m_glConvolutionFilter2D_profiling;
+if(this->m_ptr_glMemoryBarrierByRegion)this->m_ptr_glMemoryBarrierByRegion = (FunctionTable::MEMBERPFNGLMEMORYBARRIERBYREGIONPROC)&ProfilingTableDecorator::m_glMemoryBarrierByRegion_profiling;
+if(this->m_ptr_glVertexArrayBindingDivisor)this->m_ptr_glVertexArrayBindingDivisor = (FunctionTable::MEMBERPFNGLVERTEXARRAYBINDINGDIVISORPROC)&ProfilingTableDecorator::m_glVertexArrayBindingDivisor_profiling;
+if(this->m_ptr_glMatrixRotatedEXT)this->m_ptr_glMatrixRotatedEXT = (FunctionTable::MEMBERPFNGLMATRIXROTATEDEXTPROC)&ProfilingTableDecorator::m_glMatrixRotatedEXT_profiling;
+if(this->m_ptr_glTexCoord2sv)this->m_ptr_glTexCoord2sv = (FunctionTable::MEMBERPFNGLTEXCOORD2SVPROC)&ProfilingTableDecorator::m_glTexCoord2sv_profiling;
+if(this->m_ptr_glIsProgramNV)this->m_ptr_glIsProgramNV = (FunctionTable::MEMBERPFNGLISPROGRAMNVPROC)&ProfilingTableDecorator::m_glIsProgramNV_profiling;
+if(this->m_ptr_glUniform2dv)this->m_ptr_glUniform2dv = (FunctionTable::MEMBERPFNGLUNIFORM2DVPROC)&ProfilingTableDecorator::m_glUniform2dv_profiling;
+if(this->m_ptr_glGetPixelMapuiv)this->m_ptr_glGetPixelMapuiv = (FunctionTable::MEMBERPFNGLGETPIXELMAPUIVPROC)&ProfilingTableDecorator::m_glGetPixelMapuiv_profiling;
+if(this->m_ptr_glDepthBoundsEXT)this->m_ptr_glDepthBoundsEXT = (FunctionTable::MEMBERPFNGLDEPTHBOUNDSEXTPROC)&ProfilingTableDecorator::m_glDepthBoundsEXT_profiling;
+if(this->m_ptr_glVertexAttrib4hvNV)this->m_ptr_glVertexAttrib4hvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4HVNVPROC)&ProfilingTableDecorator::m_glVertexAttrib4hvNV_profiling;
+if(this->m_ptr_glMultiTexParameteriEXT)this->m_ptr_glMultiTexParameteriEXT = (FunctionTable::MEMBERPFNGLMULTITEXPARAMETERIEXTPROC)&ProfilingTableDecorator::m_glMultiTexParameteriEXT_profiling;
+if(this->m_ptr_glGetPointerv)this->m_ptr_glGetPointerv = (FunctionTable::MEMBERPFNGLGETPOINTERVPROC)&ProfilingTableDecorator::m_glGetPointerv_profiling;
+if(this->m_ptr_glPathCommandsNV)this->m_ptr_glPathCommandsNV = (FunctionTable::MEMBERPFNGLPATHCOMMANDSNVPROC)&ProfilingTableDecorator::m_glPathCommandsNV_profiling;
+if(this->m_ptr_glGetUniformfv)this->m_ptr_glGetUniformfv = (FunctionTable::MEMBERPFNGLGETUNIFORMFVPROC)&ProfilingTableDecorator::m_glGetUniformfv_profiling;
+if(this->m_ptr_glGetUniformuiv)this->m_ptr_glGetUniformuiv = (FunctionTable::MEMBERPFNGLGETUNIFORMUIVPROC)&ProfilingTableDecorator::m_glGetUniformuiv_profiling;
+if(this->m_ptr_glDebugMessageInsertAMD)this->m_ptr_glDebugMessageInsertAMD = (FunctionTable::MEMBERPFNGLDEBUGMESSAGEINSERTAMDPROC)&ProfilingTableDecorator::m_glDebugMessageInsertAMD_profiling;
+if(this->m_ptr_glFrustum)this->m_ptr_glFrustum = (FunctionTable::MEMBERPFNGLFRUSTUMPROC)&ProfilingTableDecorator::m_glFrustum_profiling;
+if(this->m_ptr_glVertexAttribL1ui64vNV)this->m_ptr_glVertexAttribL1ui64vNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL1UI64VNVPROC)&ProfilingTableDecorator::m_glVertexAttribL1ui64vNV_profiling;
+if(this->m_ptr_glClearColorxOES)this->m_ptr_glClearColorxOES = (FunctionTable::MEMBERPFNGLCLEARCOLORXOESPROC)&ProfilingTableDecorator::m_glClearColorxOES_profiling;
+if(this->m_ptr_glProgramUniformMatrix3fv)this->m_ptr_glProgramUniformMatrix3fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3FVPROC)&ProfilingTableDecorator::m_glProgramUniformMatrix3fv_profiling;
+if(this->m_ptr_glSampleMaskIndexedNV)this->m_ptr_glSampleMaskIndexedNV = (FunctionTable::MEMBERPFNGLSAMPLEMASKINDEXEDNVPROC)&ProfilingTableDecorator::m_glSampleMaskIndexedNV_profiling;
+if(this->m_ptr_glCompileShaderIncludeARB)this->m_ptr_glCompileShaderIncludeARB = (FunctionTable::MEMBERPFNGLCOMPILESHADERINCLUDEARBPROC)&ProfilingTableDecorator::m_glCompileShaderIncludeARB_profiling;
+if(this->m_ptr_glGetArrayObjectfvATI)this->m_ptr_glGetArrayObjectfvATI = (FunctionTable::MEMBERPFNGLGETARRAYOBJECTFVATIPROC)&ProfilingTableDecorator::m_glGetArrayObjectfvATI_profiling;
+if(this->m_ptr_glVertexStream4svATI)this->m_ptr_glVertexStream4svATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM4SVATIPROC)&ProfilingTableDecorator::m_glVertexStream4svATI_profiling;
+if(this->m_ptr_glMultiTexCoord4iARB)this->m_ptr_glMultiTexCoord4iARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4IARBPROC)&ProfilingTableDecorator::m_glMultiTexCoord4iARB_profiling;
+if(this->m_ptr_glVariantfvEXT)this->m_ptr_glVariantfvEXT = (FunctionTable::MEMBERPFNGLVARIANTFVEXTPROC)&ProfilingTableDecorator::m_glVariantfvEXT_profiling;
+if(this->m_ptr_glMatrixLoadfEXT)this->m_ptr_glMatrixLoadfEXT = (FunctionTable::MEMBERPFNGLMATRIXLOADFEXTPROC)&ProfilingTableDecorator::m_glMatrixLoadfEXT_profiling;
+if(this->m_ptr_glLoadIdentityDeformationMapSGIX)this->m_ptr_glLoadIdentityDeformationMapSGIX = (FunctionTable::MEMBERPFNGLLOADIDENTITYDEFORMATIONMAPSGIXPROC)&ProfilingTableDecorator::m_glLoadIdentityDeformationMapSGIX_profiling;
+if(this->m_ptr_glGetRenderbufferParameteriv)this->m_ptr_glGetRenderbufferParameteriv = (FunctionTable::MEMBERPFNGLGETRENDERBUFFERPARAMETERIVPROC)&ProfilingTableDecorator::m_glGetRenderbufferParameteriv_profiling;
+if(this->m_ptr_glProgramUniform3fEXT)this->m_ptr_glProgramUniform3fEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3FEXTPROC)&ProfilingTableDecorator::m_glProgramUniform3fEXT_profiling;
+if(this->m_ptr_glNamedRenderbufferStorage)this->m_ptr_glNamedRenderbufferStorage = (FunctionTable::MEMBERPFNGLNAMEDRENDERBUFFERSTORAGEPROC)&ProfilingTableDecorator::m_glNamedRenderbufferStorage_profiling;
+if(this->m_ptr_glProgramPathFragmentInputGenNV)this->m_ptr_glProgramPathFragmentInputGenNV = (FunctionTable::MEMBERPFNGLPROGRAMPATHFRAGMENTINPUTGENNVPROC)&ProfilingTableDecorator::m_glProgramPathFragmentInputGenNV_profiling;
+if(this->m_ptr_glFogCoordPointerListIBM)this->m_ptr_glFogCoordPointerListIBM = (FunctionTable::MEMBERPFNGLFOGCOORDPOINTERLISTIBMPROC)&ProfilingTableDecorator::m_glFogCoordPointerListIBM_profiling;
+if(this->m_ptr_glFenceSync)this->m_ptr_glFenceSync = (FunctionTable::MEMBERPFNGLFENCESYNCPROC)&ProfilingTableDecorator::m_glFenceSync_profiling;
+if(this->m_ptr_glGetVertexAttribIivEXT)this->m_ptr_glGetVertexAttribIivEXT = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBIIVEXTPROC)&ProfilingTableDecorator::m_glGetVertexAttribIivEXT_profiling;
+if(this->m_ptr_glFramebufferDrawBuffersEXT)this->m_ptr_glFramebufferDrawBuffersEXT = (FunctionTable::MEMBERPFNGLFRAMEBUFFERDRAWBUFFERSEXTPROC)&ProfilingTableDecorator::m_glFramebufferDrawBuffersEXT_profiling;
+if(this->m_ptr_glVertexAttribs4fvNV)this->m_ptr_glVertexAttribs4fvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS4FVNVPROC)&ProfilingTableDecorator::m_glVertexAttribs4fvNV_profiling;
+if(this->m_ptr_glPauseTransformFeedbackNV)this->m_ptr_glPauseTransformFeedbackNV = (FunctionTable::MEMBERPFNGLPAUSETRANSFORMFEEDBACKNVPROC)&ProfilingTableDecorator::m_glPauseTransformFeedbackNV_profiling;
+if(this->m_ptr_glGetQueryObjecti64vEXT)this->m_ptr_glGetQueryObjecti64vEXT = (FunctionTable::MEMBERPFNGLGETQUERYOBJECTI64VEXTPROC)&ProfilingTableDecorator::m_glGetQueryObjecti64vEXT_profiling;
+if(this->m_ptr_glVDPAUSurfaceAccessNV)this->m_ptr_glVDPAUSurfaceAccessNV = (FunctionTable::MEMBERPFNGLVDPAUSURFACEACCESSNVPROC)&ProfilingTableDecorator::m_glVDPAUSurfaceAccessNV_profiling;
+if(this->m_ptr_glValidateProgramPipeline)this->m_ptr_glValidateProgramPipeline = (FunctionTable::MEMBERPFNGLVALIDATEPROGRAMPIPELINEPROC)&ProfilingTableDecorator::m_glValidateProgramPipeline_profiling;
+if(this->m_ptr_glTexPageCommitmentARB)this->m_ptr_glTexPageCommitmentARB = (FunctionTable::MEMBERPFNGLTEXPAGECOMMITMENTARBPROC)&ProfilingTableDecorator::m_glTexPageCommitmentARB_profiling;
+if(this->m_ptr_glWindowPos3dvARB)this->m_ptr_glWindowPos3dvARB = (FunctionTable::MEMBERPFNGLWINDOWPOS3DVARBPROC)&ProfilingTableDecorator::m_glWindowPos3dvARB_profiling;
+if(this->m_ptr_glStencilStrokePathInstancedNV)this->m_ptr_glStencilStrokePathInstancedNV = (FunctionTable::MEMBERPFNGLSTENCILSTROKEPATHINSTANCEDNVPROC)&ProfilingTableDecorator::m_glStencilStrokePathInstancedNV_profiling;
+if(this->m_ptr_glFogfv)this->m_ptr_glFogfv = (FunctionTable::MEMBERPFNGLFOGFVPROC)&ProfilingTableDecorator::m_glFogfv_profiling;
+if(this->m_ptr_glGenQueriesARB)this->m_ptr_glGenQueriesARB = (FunctionTable::MEMBERPFNGLGENQUERIESARBPROC)&ProfilingTableDecorator::m_glGenQueriesARB_profiling;
+if(this->m_ptr_glProgramUniform2i64NV)this->m_ptr_glProgramUniform2i64NV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2I64NVPROC)&ProfilingTableDecorator::m_glProgramUniform2i64NV_profiling;
+if(this->m_ptr_glVertexP4ui)this->m_ptr_glVertexP4ui = (FunctionTable::MEMBERPFNGLVERTEXP4UIPROC)&ProfilingTableDecorator::m_glVertexP4ui_profiling;
+if(this->m_ptr_glVertexStream1ivATI)this->m_ptr_glVertexStream1ivATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM1IVATIPROC)&ProfilingTableDecorator::m_glVertexStream1ivATI_profiling;
+if(this->m_ptr_glProgramEnvParameterI4iNV)this->m_ptr_glProgramEnvParameterI4iNV = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERI4INVPROC)&ProfilingTableDecorator::m_glProgramEnvParameterI4iNV_profiling;
+if(this->m_ptr_glGenVertexArraysAPPLE)this->m_ptr_glGenVertexArraysAPPLE = (FunctionTable::MEMBERPFNGLGENVERTEXARRAYSAPPLEPROC)&ProfilingTableDecorator::m_glGenVertexArraysAPPLE_profiling;
+if(this->m_ptr_glDrawTransformFeedbackInstanced)this->m_ptr_glDrawTransformFeedbackInstanced = (FunctionTable::MEMBERPFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC)&ProfilingTableDecorator::m_glDrawTransformFeedbackInstanced_profiling;
+if(this->m_ptr_glStencilThenCoverStrokePathNV)this->m_ptr_glStencilThenCoverStrokePathNV = (FunctionTable::MEMBERPFNGLSTENCILTHENCOVERSTROKEPATHNVPROC)&ProfilingTableDecorator::m_glStencilThenCoverStrokePathNV_profiling;
+if(this->m_ptr_glDeleteVertexArraysAPPLE)this->m_ptr_glDeleteVertexArraysAPPLE = (FunctionTable::MEMBERPFNGLDELETEVERTEXARRAYSAPPLEPROC)&ProfilingTableDecorator::m_glDeleteVertexArraysAPPLE_profiling;
+if(this->m_ptr_glGetNamedBufferParameterui64vNV)this->m_ptr_glGetNamedBufferParameterui64vNV = (FunctionTable::MEMBERPFNGLGETNAMEDBUFFERPARAMETERUI64VNVPROC)&ProfilingTableDecorator::m_glGetNamedBufferParameterui64vNV_profiling;
+if(this->m_ptr_glQueryMatrixxOES)this->m_ptr_glQueryMatrixxOES = (FunctionTable::MEMBERPFNGLQUERYMATRIXXOESPROC)&ProfilingTableDecorator::m_glQueryMatrixxOES_profiling;
+if(this->m_ptr_glSecondaryColor3usv)this->m_ptr_glSecondaryColor3usv = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3USVPROC)&ProfilingTableDecorator::m_glSecondaryColor3usv_profiling;
+if(this->m_ptr_glTranslatexOES)this->m_ptr_glTranslatexOES = (FunctionTable::MEMBERPFNGLTRANSLATEXOESPROC)&ProfilingTableDecorator::m_glTranslatexOES_profiling;
+if(this->m_ptr_glDrawTransformFeedback)this->m_ptr_glDrawTransformFeedback = (FunctionTable::MEMBERPFNGLDRAWTRANSFORMFEEDBACKPROC)&ProfilingTableDecorator::m_glDrawTransformFeedback_profiling;
+if(this->m_ptr_glTexCoord2fColor4fNormal3fVertex3fvSUN)this->m_ptr_glTexCoord2fColor4fNormal3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLTEXCOORD2FCOLOR4FNORMAL3FVERTEX3FVSUNPROC)&ProfilingTableDecorator::m_glTexCoord2fColor4fNormal3fVertex3fvSUN_profiling;
+if(this->m_ptr_glVDPAURegisterVideoSurfaceNV)this->m_ptr_glVDPAURegisterVideoSurfaceNV = (FunctionTable::MEMBERPFNGLVDPAUREGISTERVIDEOSURFACENVPROC)&ProfilingTableDecorator::m_glVDPAURegisterVideoSurfaceNV_profiling;
+if(this->m_ptr_glGetTexParameterIuiv)this->m_ptr_glGetTexParameterIuiv = (FunctionTable::MEMBERPFNGLGETTEXPARAMETERIUIVPROC)&ProfilingTableDecorator::m_glGetTexParameterIuiv_profiling;
+if(this->m_ptr_glBindBufferBaseNV)this->m_ptr_glBindBufferBaseNV = (FunctionTable::MEMBERPFNGLBINDBUFFERBASENVPROC)&ProfilingTableDecorator::m_glBindBufferBaseNV_profiling;
+if(this->m_ptr_glIndexPointer)this->m_ptr_glIndexPointer = (FunctionTable::MEMBERPFNGLINDEXPOINTERPROC)&ProfilingTableDecorator::m_glIndexPointer_profiling;
+if(this->m_ptr_glVertexAttrib4Nbv)this->m_ptr_glVertexAttrib4Nbv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NBVPROC)&ProfilingTableDecorator::m_glVertexAttrib4Nbv_profiling;
+if(this->m_ptr_glListParameteriSGIX)this->m_ptr_glListParameteriSGIX = (FunctionTable::MEMBERPFNGLLISTPARAMETERISGIXPROC)&ProfilingTableDecorator::m_glListParameteriSGIX_profiling;
+if(this->m_ptr_glBlendColorxOES)this->m_ptr_glBlendColorxOES = (FunctionTable::MEMBERPFNGLBLENDCOLORXOESPROC)&ProfilingTableDecorator::m_glBlendColorxOES_profiling;
+if(this->m_ptr_glUniformui64vNV)this->m_ptr_glUniformui64vNV = (FunctionTable::MEMBERPFNGLUNIFORMUI64VNVPROC)&ProfilingTableDecorator::m_glUniformui64vNV_profiling;
+if(this->m_ptr_glIsSync)this->m_ptr_glIsSync = (FunctionTable::MEMBERPFNGLISSYNCPROC)&ProfilingTableDecorator::m_glIsSync_profiling;
+if(this->m_ptr_glGetTextureParameterivEXT)this->m_ptr_glGetTextureParameterivEXT = (FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERIVEXTPROC)&ProfilingTableDecorator::m_glGetTextureParameterivEXT_profiling;
+if(this->m_ptr_glFogCoordhvNV)this->m_ptr_glFogCoordhvNV = (FunctionTable::MEMBERPFNGLFOGCOORDHVNVPROC)&ProfilingTableDecorator::m_glFogCoordhvNV_profiling;
+if(this->m_ptr_glFramebufferTextureLayerEXT)this->m_ptr_glFramebufferTextureLayerEXT = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURELAYEREXTPROC)&ProfilingTableDecorator::m_glFramebufferTextureLayerEXT_profiling;
+if(this->m_ptr_glGetObjectPtrLabel)this->m_ptr_glGetObjectPtrLabel = (FunctionTable::MEMBERPFNGLGETOBJECTPTRLABELPROC)&ProfilingTableDecorator::m_glGetObjectPtrLabel_profiling;
+if(this->m_ptr_glTextureParameteri)this->m_ptr_glTextureParameteri = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIPROC)&ProfilingTableDecorator::m_glTextureParameteri_profiling;
+if(this->m_ptr_glMultiTexCoord1fARB)this->m_ptr_glMultiTexCoord1fARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1FARBPROC)&ProfilingTableDecorator::m_glMultiTexCoord1fARB_profiling;
+if(this->m_ptr_glUniformMatrix2x3dv)this->m_ptr_glUniformMatrix2x3dv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX2X3DVPROC)&ProfilingTableDecorator::m_glUniformMatrix2x3dv_profiling;
+if(this->m_ptr_glFramebufferDrawBufferEXT)this->m_ptr_glFramebufferDrawBufferEXT = (FunctionTable::MEMBERPFNGLFRAMEBUFFERDRAWBUFFEREXTPROC)&ProfilingTableDecorator::m_glFramebufferDrawBufferEXT_profiling;
+if(this->m_ptr_glCopyColorSubTable)this->m_ptr_glCopyColorSubTable = (FunctionTable::MEMBERPFNGLCOPYCOLORSUBTABLEPROC)&ProfilingTableDecorator::m_glCopyColorSubTable_profiling;
+if(this->m_ptr_glVertexAttribL3d)this->m_ptr_glVertexAttribL3d = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL3DPROC)&ProfilingTableDecorator::m_glVertexAttribL3d_profiling;
+if(this->m_ptr_glFragmentMaterialfvSGIX)this->m_ptr_glFragmentMaterialfvSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTMATERIALFVSGIXPROC)&ProfilingTableDecorator::m_glFragmentMaterialfvSGIX_profiling;
+if(this->m_ptr_glMatrixLoadTranspose3x3fNV)this->m_ptr_glMatrixLoadTranspose3x3fNV = (FunctionTable::MEMBERPFNGLMATRIXLOADTRANSPOSE3X3FNVPROC)&ProfilingTableDecorator::m_glMatrixLoadTranspose3x3fNV_profiling;
+if(this->m_ptr_glDeleteNamesAMD)this->m_ptr_glDeleteNamesAMD = (FunctionTable::MEMBERPFNGLDELETENAMESAMDPROC)&ProfilingTableDecorator::m_glDeleteNamesAMD_profiling;
+if(this->m_ptr_glDrawRangeElementsEXT)this->m_ptr_glDrawRangeElementsEXT = (FunctionTable::MEMBERPFNGLDRAWRANGEELEMENTSEXTPROC)&ProfilingTableDecorator::m_glDrawRangeElementsEXT_profiling;
+if(this->m_ptr_glOrtho)this->m_ptr_glOrtho = (FunctionTable::MEMBERPFNGLORTHOPROC)&ProfilingTableDecorator::m_glOrtho_profiling;
+if(this->m_ptr_glProgramUniform1dvEXT)this->m_ptr_glProgramUniform1dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1DVEXTPROC)&ProfilingTableDecorator::m_glProgramUniform1dvEXT_profiling;
+if(this->m_ptr_glColor4xOES)this->m_ptr_glColor4xOES = (FunctionTable::MEMBERPFNGLCOLOR4XOESPROC)&ProfilingTableDecorator::m_glColor4xOES_profiling;
+if(this->m_ptr_glTexImage4DSGIS)this->m_ptr_glTexImage4DSGIS = (FunctionTable::MEMBERPFNGLTEXIMAGE4DSGISPROC)&ProfilingTableDecorator::m_glTexImage4DSGIS_profiling;
+if(this->m_ptr_glProgramUniform1ui)this->m_ptr_glProgramUniform1ui = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UIPROC)&ProfilingTableDecorator::m_glProgramUniform1ui_profiling;
+if(this->m_ptr_glDeleteBuffersARB)this->m_ptr_glDeleteBuffersARB = (FunctionTable::MEMBERPFNGLDELETEBUFFERSARBPROC)&ProfilingTableDecorator::m_glDeleteBuffersARB_profiling;
+if(this->m_ptr_glUnmapBufferARB)this->m_ptr_glUnmapBufferARB = (FunctionTable::MEMBERPFNGLUNMAPBUFFERARBPROC)&ProfilingTableDecorator::m_glUnmapBufferARB_profiling;
+if(this->m_ptr_glCopyTexImage2D)this->m_ptr_glCopyTexImage2D = (FunctionTable::MEMBERPFNGLCOPYTEXIMAGE2DPROC)&ProfilingTableDecorator::m_glCopyTexImage2D_profiling;
+if(this->m_ptr_glMaterialxOES)this->m_ptr_glMaterialxOES = (FunctionTable::MEMBERPFNGLMATERIALXOESPROC)&ProfilingTableDecorator::m_glMaterialxOES_profiling;
+if(this->m_ptr_glProgramUniformMatrix2x4fvEXT)this->m_ptr_glProgramUniformMatrix2x4fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X4FVEXTPROC)&ProfilingTableDecorator::m_glProgramUniformMatrix2x4fvEXT_profiling;
+if(this->m_ptr_glTestObjectAPPLE)this->m_ptr_glTestObjectAPPLE = (FunctionTable::MEMBERPFNGLTESTOBJECTAPPLEPROC)&ProfilingTableDecorator::m_glTestObjectAPPLE_profiling;
+if(this->m_ptr_glRenderbufferStorageEXT)this->m_ptr_glRenderbufferStorageEXT = (FunctionTable::MEMBERPFNGLRENDERBUFFERSTORAGEEXTPROC)&ProfilingTableDecorator::m_glRenderbufferStorageEXT_profiling;
+if(this->m_ptr_glVertexAttribL1ui64ARB)this->m_ptr_glVertexAttribL1ui64ARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL1UI64ARBPROC)&ProfilingTableDecorator::m_glVertexAttribL1ui64ARB_profiling;
+if(this->m_ptr_glEndFragmentShaderATI)this->m_ptr_glEndFragmentShaderATI = (FunctionTable::MEMBERPFNGLENDFRAGMENTSHADERATIPROC)&ProfilingTableDecorator::m_glEndFragmentShaderATI_profiling;
+if(this->m_ptr_glPathParameterivNV)this->m_ptr_glPathParameterivNV = (FunctionTable::MEMBERPFNGLPATHPARAMETERIVNVPROC)&ProfilingTableDecorator::m_glPathParameterivNV_profiling;
+if(this->m_ptr_glUniform4uiv)this->m_ptr_glUniform4uiv = (FunctionTable::MEMBERPFNGLUNIFORM4UIVPROC)&ProfilingTableDecorator::m_glUniform4uiv_profiling;
+if(this->m_ptr_glFrameZoomSGIX)this->m_ptr_glFrameZoomSGIX = (FunctionTable::MEMBERPFNGLFRAMEZOOMSGIXPROC)&ProfilingTableDecorator::m_glFrameZoomSGIX_profiling;
+if(this->m_ptr_glSecondaryColor3fEXT)this->m_ptr_glSecondaryColor3fEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3FEXTPROC)&ProfilingTableDecorator::m_glSecondaryColor3fEXT_profiling;
+if(this->m_ptr_glVertexAttribL1dv)this->m_ptr_glVertexAttribL1dv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL1DVPROC)&ProfilingTableDecorator::m_glVertexAttribL1dv_profiling;
+if(this->m_ptr_glNormalStream3svATI)this->m_ptr_glNormalStream3svATI = (FunctionTable::MEMBERPFNGLNORMALSTREAM3SVATIPROC)&ProfilingTableDecorator::m_glNormalStream3svATI_profiling;
+if(this->m_ptr_glPathStencilFuncNV)this->m_ptr_glPathStencilFuncNV = (FunctionTable::MEMBERPFNGLPATHSTENCILFUNCNVPROC)&ProfilingTableDecorator::m_glPathStencilFuncNV_profiling;
+if(this->m_ptr_glSetInvariantEXT)this->m_ptr_glSetInvariantEXT = (FunctionTable::MEMBERPFNGLSETINVARIANTEXTPROC)&ProfilingTableDecorator::m_glSetInvariantEXT_profiling;
+if(this->m_ptr_glGetTexBumpParameterivATI)this->m_ptr_glGetTexBumpParameterivATI = (FunctionTable::MEMBERPFNGLGETTEXBUMPPARAMETERIVATIPROC)&ProfilingTableDecorator::m_glGetTexBumpParameterivATI_profiling;
+if(this->m_ptr_glBlendEquationSeparateEXT)this->m_ptr_glBlendEquationSeparateEXT = (FunctionTable::MEMBERPFNGLBLENDEQUATIONSEPARATEEXTPROC)&ProfilingTableDecorator::m_glBlendEquationSeparateEXT_profiling;
+if(this->m_ptr_glEndOcclusionQueryNV)this->m_ptr_glEndOcclusionQueryNV = (FunctionTable::MEMBERPFNGLENDOCCLUSIONQUERYNVPROC)&ProfilingTableDecorator::m_glEndOcclusionQueryNV_profiling;
+if(this->m_ptr_glScissorArrayv)this->m_ptr_glScissorArrayv = (FunctionTable::MEMBERPFNGLSCISSORARRAYVPROC)&ProfilingTableDecorator::m_glScissorArrayv_profiling;
+if(this->m_ptr_glCallList)this->m_ptr_glCallList = (FunctionTable::MEMBERPFNGLCALLLISTPROC)&ProfilingTableDecorator::m_glCallList_profiling;
+if(this->m_ptr_glMapTexture2DINTEL)this->m_ptr_glMapTexture2DINTEL = (FunctionTable::MEMBERPFNGLMAPTEXTURE2DINTELPROC)&ProfilingTableDecorator::m_glMapTexture2DINTEL_profiling;
+if(this->m_ptr_glPixelTransferxOES)this->m_ptr_glPixelTransferxOES = (FunctionTable::MEMBERPFNGLPIXELTRANSFERXOESPROC)&ProfilingTableDecorator::m_glPixelTransferxOES_profiling;
+if(this->m_ptr_glDeleteRenderbuffersEXT)this->m_ptr_glDeleteRenderbuffersEXT = (FunctionTable::MEMBERPFNGLDELETERENDERBUFFERSEXTPROC)&ProfilingTableDecorator::m_glDeleteRenderbuffersEXT_profiling;
+if(this->m_ptr_glTexCoord4fColor4fNormal3fVertex4fSUN)this->m_ptr_glTexCoord4fColor4fNormal3fVertex4fSUN = (FunctionTable::MEMBERPFNGLTEXCOORD4FCOLOR4FNORMAL3FVERTEX4FSUNPROC)&ProfilingTableDecorator::m_glTexCoord4fColor4fNormal3fVertex4fSUN_profiling;
+if(this->m_ptr_glProgramUniformMatrix4dvEXT)this->m_ptr_glProgramUniformMatrix4dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4DVEXTPROC)&ProfilingTableDecorator::m_glProgramUniformMatrix4dvEXT_profiling;
+if(this->m_ptr_glGetnColorTable)this->m_ptr_glGetnColorTable = (FunctionTable::MEMBERPFNGLGETNCOLORTABLEPROC)&ProfilingTableDecorator::m_glGetnColorTable_profiling;
+if(this->m_ptr_glFramebufferTextureLayerARB)this->m_ptr_glFramebufferTextureLayerARB = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURELAYERARBPROC)&ProfilingTableDecorator::m_glFramebufferTextureLayerARB_profiling;
+if(this->m_ptr_glVertexAttribL2dvEXT)this->m_ptr_glVertexAttribL2dvEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL2DVEXTPROC)&ProfilingTableDecorator::m_glVertexAttribL2dvEXT_profiling;
+if(this->m_ptr_glGetCombinerStageParameterfvNV)this->m_ptr_glGetCombinerStageParameterfvNV = (FunctionTable::MEMBERPFNGLGETCOMBINERSTAGEPARAMETERFVNVPROC)&ProfilingTableDecorator::m_glGetCombinerStageParameterfvNV_profiling;
+if(this->m_ptr_glMultiTexCoord1xvOES)this->m_ptr_glMultiTexCoord1xvOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1XVOESPROC)&ProfilingTableDecorator::m_glMultiTexCoord1xvOES_profiling;
+if(this->m_ptr_glMapBuffer)this->m_ptr_glMapBuffer = (FunctionTable::MEMBERPFNGLMAPBUFFERPROC)&ProfilingTableDecorator::m_glMapBuffer_profiling;
+if(this->m_ptr_glSecondaryColor3d)this->m_ptr_glSecondaryColor3d = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3DPROC)&ProfilingTableDecorator::m_glSecondaryColor3d_profiling;
+if(this->m_ptr_glSecondaryColor3f)this->m_ptr_glSecondaryColor3f = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3FPROC)&ProfilingTableDecorator::m_glSecondaryColor3f_profiling;
+if(this->m_ptr_glVertexAttribLFormat)this->m_ptr_glVertexAttribLFormat = (FunctionTable::MEMBERPFNGLVERTEXATTRIBLFORMATPROC)&ProfilingTableDecorator::m_glVertexAttribLFormat_profiling;
+if(this->m_ptr_glElementPointerAPPLE)this->m_ptr_glElementPointerAPPLE = (FunctionTable::MEMBERPFNGLELEMENTPOINTERAPPLEPROC)&ProfilingTableDecorator::m_glElementPointerAPPLE_profiling;
+if(this->m_ptr_glVertexStream1fATI)this->m_ptr_glVertexStream1fATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM1FATIPROC)&ProfilingTableDecorator::m_glVertexStream1fATI_profiling;
+if(this->m_ptr_glCoverageModulationNV)this->m_ptr_glCoverageModulationNV = (FunctionTable::MEMBERPFNGLCOVERAGEMODULATIONNVPROC)&ProfilingTableDecorator::m_glCoverageModulationNV_profiling;
+if(this->m_ptr_glSecondaryColor3i)this->m_ptr_glSecondaryColor3i = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3IPROC)&ProfilingTableDecorator::m_glSecondaryColor3i_profiling;
+if(this->m_ptr_glDeleteSync)this->m_ptr_glDeleteSync = (FunctionTable::MEMBERPFNGLDELETESYNCPROC)&ProfilingTableDecorator::m_glDeleteSync_profiling;
+if(this->m_ptr_glGetProgramParameterfvNV)this->m_ptr_glGetProgramParameterfvNV = (FunctionTable::MEMBERPFNGLGETPROGRAMPARAMETERFVNVPROC)&ProfilingTableDecorator::m_glGetProgramParameterfvNV_profiling;
+if(this->m_ptr_glMaxShaderCompilerThreadsARB)this->m_ptr_glMaxShaderCompilerThreadsARB = (FunctionTable::MEMBERPFNGLMAXSHADERCOMPILERTHREADSARBPROC)&ProfilingTableDecorator::m_glMaxShaderCompilerThreadsARB_profiling;
+if(this->m_ptr_glUniformMatrix4x2dv)this->m_ptr_glUniformMatrix4x2dv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX4X2DVPROC)&ProfilingTableDecorator::m_glUniformMatrix4x2dv_profiling;
+if(this->m_ptr_glVertexArrayVertexAttribLOffsetEXT)this->m_ptr_glVertexArrayVertexAttribLOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBLOFFSETEXTPROC)&ProfilingTableDecorator::m_glVertexArrayVertexAttribLOffsetEXT_profiling;
+if(this->m_ptr_glSecondaryColor3s)this->m_ptr_glSecondaryColor3s = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3SPROC)&ProfilingTableDecorator::m_glSecondaryColor3s_profiling;
+if(this->m_ptr_glIsImageHandleResidentNV)this->m_ptr_glIsImageHandleResidentNV = (FunctionTable::MEMBERPFNGLISIMAGEHANDLERESIDENTNVPROC)&ProfilingTableDecorator::m_glIsImageHandleResidentNV_profiling;
+if(this->m_ptr_glUniform3iv)this->m_ptr_glUniform3iv = (FunctionTable::MEMBERPFNGLUNIFORM3IVPROC)&ProfilingTableDecorator::m_glUniform3iv_profiling;
+if(this->m_ptr_glVertexAttribL3i64vNV)this->m_ptr_glVertexAttribL3i64vNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL3I64VNVPROC)&ProfilingTableDecorator::m_glVertexAttribL3i64vNV_profiling;
+if(this->m_ptr_glPolygonMode)this->m_ptr_glPolygonMode = (FunctionTable::MEMBERPFNGLPOLYGONMODEPROC)&ProfilingTableDecorator::m_glPolygonMode_profiling;
+if(this->m_ptr_glConvolutionFilter1DEXT)this->m_ptr_glConvolutionFilter1DEXT = (FunctionTable::MEMBERPFNGLCONVOLUTIONFILTER1DEXTPROC)&ProfilingTableDecorator::m_glConvolutionFilter1DEXT_profiling;
+if(this->m_ptr_glVertexAttrib1dvARB)this->m_ptr_glVertexAttrib1dvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1DVARBPROC)&ProfilingTableDecorator::m_glVertexAttrib1dvARB_profiling;
+if(this->m_ptr_glTextureSubImage2DEXT)this->m_ptr_glTextureSubImage2DEXT = (FunctionTable::MEMBERPFNGLTEXTURESUBIMAGE2DEXTPROC)&ProfilingTableDecorator::m_glTextureSubImage2DEXT_profiling;
+if(this->m_ptr_glIsVertexArrayAPPLE)this->m_ptr_glIsVertexArrayAPPLE = (FunctionTable::MEMBERPFNGLISVERTEXARRAYAPPLEPROC)&ProfilingTableDecorator::m_glIsVertexArrayAPPLE_profiling;
+if(this->m_ptr_glUseProgram)this->m_ptr_glUseProgram = (FunctionTable::MEMBERPFNGLUSEPROGRAMPROC)&ProfilingTableDecorator::m_glUseProgram_profiling;
+if(this->m_ptr_glLineStipple)this->m_ptr_glLineStipple = (FunctionTable::MEMBERPFNGLLINESTIPPLEPROC)&ProfilingTableDecorator::m_glLineStipple_profiling;
+if(this->m_ptr_glMultiTexCoord4fvARB)this->m_ptr_glMultiTexCoord4fvARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4FVARBPROC)&ProfilingTableDecorator::m_glMultiTexCoord4fvARB_profiling;
+if(this->m_ptr_glVideoCaptureNV)this->m_ptr_glVideoCaptureNV = (FunctionTable::MEMBERPFNGLVIDEOCAPTURENVPROC)&ProfilingTableDecorator::m_glVideoCaptureNV_profiling;
+if(this->m_ptr_glVertexArrayVertexAttribLFormatEXT)this->m_ptr_glVertexArrayVertexAttribLFormatEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBLFORMATEXTPROC)&ProfilingTableDecorator::m_glVertexArrayVertexAttribLFormatEXT_profiling;
+if(this->m_ptr_glUniform3fvARB)this->m_ptr_glUniform3fvARB = (FunctionTable::MEMBERPFNGLUNIFORM3FVARBPROC)&ProfilingTableDecorator::m_glUniform3fvARB_profiling;
+if(this->m_ptr_glProgramUniformMatrix3x2fvEXT)this->m_ptr_glProgramUniformMatrix3x2fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X2FVEXTPROC)&ProfilingTableDecorator::m_glProgramUniformMatrix3x2fvEXT_profiling;
+if(this->m_ptr_glCopyTextureSubImage3DEXT)this->m_ptr_glCopyTextureSubImage3DEXT = (FunctionTable::MEMBERPFNGLCOPYTEXTURESUBIMAGE3DEXTPROC)&ProfilingTableDecorator::m_glCopyTextureSubImage3DEXT_profiling;
+if(this->m_ptr_glMultiTexCoord2bvOES)this->m_ptr_glMultiTexCoord2bvOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2BVOESPROC)&ProfilingTableDecorator::m_glMultiTexCoord2bvOES_profiling;
+if(this->m_ptr_glDeleteObjectARB)this->m_ptr_glDeleteObjectARB = (FunctionTable::MEMBERPFNGLDELETEOBJECTARBPROC)&ProfilingTableDecorator::m_glDeleteObjectARB_profiling;
+if(this->m_ptr_glTextureLightEXT)this->m_ptr_glTextureLightEXT = (FunctionTable::MEMBERPFNGLTEXTURELIGHTEXTPROC)&ProfilingTableDecorator::m_glTextureLightEXT_profiling;
+if(this->m_ptr_glMultiTexCoord3dARB)this->m_ptr_glMultiTexCoord3dARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3DARBPROC)&ProfilingTableDecorator::m_glMultiTexCoord3dARB_profiling;
+if(this->m_ptr_glNamedFramebufferTextureEXT)this->m_ptr_glNamedFramebufferTextureEXT = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTUREEXTPROC)&ProfilingTableDecorator::m_glNamedFramebufferTextureEXT_profiling;
+if(this->m_ptr_glTextureParameteriEXT)this->m_ptr_glTextureParameteriEXT = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIEXTPROC)&ProfilingTableDecorator::m_glTextureParameteriEXT_profiling;
+if(this->m_ptr_glEvalCoord2xvOES)this->m_ptr_glEvalCoord2xvOES = (FunctionTable::MEMBERPFNGLEVALCOORD2XVOESPROC)&ProfilingTableDecorator::m_glEvalCoord2xvOES_profiling;
+if(this->m_ptr_glBindVideoCaptureStreamBufferNV)this->m_ptr_glBindVideoCaptureStreamBufferNV = (FunctionTable::MEMBERPFNGLBINDVIDEOCAPTURESTREAMBUFFERNVPROC)&ProfilingTableDecorator::m_glBindVideoCaptureStreamBufferNV_profiling;
+if(this->m_ptr_glTexImage2DMultisampleCoverageNV)this->m_ptr_glTexImage2DMultisampleCoverageNV = (FunctionTable::MEMBERPFNGLTEXIMAGE2DMULTISAMPLECOVERAGENVPROC)&ProfilingTableDecorator::m_glTexImage2DMultisampleCoverageNV_profiling;
+if(this->m_ptr_glGetAttribLocationARB)this->m_ptr_glGetAttribLocationARB = (FunctionTable::MEMBERPFNGLGETATTRIBLOCATIONARBPROC)&ProfilingTableDecorator::m_glGetAttribLocationARB_profiling;
+if(this->m_ptr_glDeleteShader)this->m_ptr_glDeleteShader = (FunctionTable::MEMBERPFNGLDELETESHADERPROC)&ProfilingTableDecorator::m_glDeleteShader_profiling;
+if(this->m_ptr_glVertexAttrib1fARB)this->m_ptr_glVertexAttrib1fARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1FARBPROC)&ProfilingTableDecorator::m_glVertexAttrib1fARB_profiling;
+if(this->m_ptr_glTexCoord2fColor4ubVertex3fSUN)this->m_ptr_glTexCoord2fColor4ubVertex3fSUN = (FunctionTable::MEMBERPFNGLTEXCOORD2FCOLOR4UBVERTEX3FSUNPROC)&ProfilingTableDecorator::m_glTexCoord2fColor4ubVertex3fSUN_profiling;
+if(this->m_ptr_glTexCoord4fVertex4fSUN)this->m_ptr_glTexCoord4fVertex4fSUN = (FunctionTable::MEMBERPFNGLTEXCOORD4FVERTEX4FSUNPROC)&ProfilingTableDecorator::m_glTexCoord4fVertex4fSUN_profiling;
+if(this->m_ptr_glGetMapdv)this->m_ptr_glGetMapdv = (FunctionTable::MEMBERPFNGLGETMAPDVPROC)&ProfilingTableDecorator::m_glGetMapdv_profiling;
+if(this->m_ptr_glMapParameterfvNV)this->m_ptr_glMapParameterfvNV = (FunctionTable::MEMBERPFNGLMAPPARAMETERFVNVPROC)&ProfilingTableDecorator::m_glMapParameterfvNV_profiling;
+if(this->m_ptr_glTextureParameterIuiv)this->m_ptr_glTextureParameterIuiv = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIUIVPROC)&ProfilingTableDecorator::m_glTextureParameterIuiv_profiling;
+if(this->m_ptr_glTransformFeedbackAttribsNV)this->m_ptr_glTransformFeedbackAttribsNV = (FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKATTRIBSNVPROC)&ProfilingTableDecorator::m_glTransformFeedbackAttribsNV_profiling;
+if(this->m_ptr_glFragmentLightfvSGIX)this->m_ptr_glFragmentLightfvSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTLIGHTFVSGIXPROC)&ProfilingTableDecorator::m_glFragmentLightfvSGIX_profiling;
+if(this->m_ptr_glWindowPos3sARB)this->m_ptr_glWindowPos3sARB = (FunctionTable::MEMBERPFNGLWINDOWPOS3SARBPROC)&ProfilingTableDecorator::m_glWindowPos3sARB_profiling;
+if(this->m_ptr_glGetConvolutionParameterfv)this->m_ptr_glGetConvolutionParameterfv = (FunctionTable::MEMBERPFNGLGETCONVOLUTIONPARAMETERFVPROC)&ProfilingTableDecorator::m_glGetConvolutionParameterfv_profiling;
+if(this->m_ptr_glCopyTexSubImage3D)this->m_ptr_glCopyTexSubImage3D = (FunctionTable::MEMBERPFNGLCOPYTEXSUBIMAGE3DPROC)&ProfilingTableDecorator::m_glCopyTexSubImage3D_profiling;
+if(this->m_ptr_glVertexAttribI3i)this->m_ptr_glVertexAttribI3i = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI3IPROC)&ProfilingTableDecorator::m_glVertexAttribI3i_profiling;
+if(this->m_ptr_glCreateShaderObjectARB)this->m_ptr_glCreateShaderObjectARB = (FunctionTable::MEMBERPFNGLCREATESHADEROBJECTARBPROC)&ProfilingTableDecorator::m_glCreateShaderObjectARB_profiling;
+if(this->m_ptr_glVertexAttribFormat)this->m_ptr_glVertexAttribFormat = (FunctionTable::MEMBERPFNGLVERTEXATTRIBFORMATPROC)&ProfilingTableDecorator::m_glVertexAttribFormat_profiling;
+if(this->m_ptr_glGetProgramivARB)this->m_ptr_glGetProgramivARB = (FunctionTable::MEMBERPFNGLGETPROGRAMIVARBPROC)&ProfilingTableDecorator::m_glGetProgramivARB_profiling;
+if(this->m_ptr_glVertexAttribI4usv)this->m_ptr_glVertexAttribI4usv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4USVPROC)&ProfilingTableDecorator::m_glVertexAttribI4usv_profiling;
+if(this->m_ptr_glTexParameterf)this->m_ptr_glTexParameterf = (FunctionTable::MEMBERPFNGLTEXPARAMETERFPROC)&ProfilingTableDecorator::m_glTexParameterf_profiling;
+if(this->m_ptr_glVertexAttribBinding)this->m_ptr_glVertexAttribBinding = (FunctionTable::MEMBERPFNGLVERTEXATTRIBBINDINGPROC)&ProfilingTableDecorator::m_glVertexAttribBinding_profiling;
+if(this->m_ptr_glGetHistogramParameteriv)this->m_ptr_glGetHistogramParameteriv = (FunctionTable::MEMBERPFNGLGETHISTOGRAMPARAMETERIVPROC)&ProfilingTableDecorator::m_glGetHistogramParameteriv_profiling;
+if(this->m_ptr_glTexParameteri)this->m_ptr_glTexParameteri = (FunctionTable::MEMBERPFNGLTEXPARAMETERIPROC)&ProfilingTableDecorator::m_glTexParameteri_profiling;
+if(this->m_ptr_glGetShaderSource)this->m_ptr_glGetShaderSource = (FunctionTable::MEMBERPFNGLGETSHADERSOURCEPROC)&ProfilingTableDecorator::m_glGetShaderSource_profiling;
+if(this->m_ptr_glVertexAttrib4s)this->m_ptr_glVertexAttrib4s = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4SPROC)&ProfilingTableDecorator::m_glVertexAttrib4s_profiling;
+if(this->m_ptr_glVertexAttrib4dvNV)this->m_ptr_glVertexAttrib4dvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4DVNVPROC)&ProfilingTableDecorator::m_glVertexAttrib4dvNV_profiling;
+if(this->m_ptr_glVertexAttrib1dvNV)this->m_ptr_glVertexAttrib1dvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1DVNVPROC)&ProfilingTableDecorator::m_glVertexAttrib1dvNV_profiling;
+if(this->m_ptr_glPopName)this->m_ptr_glPopName = (FunctionTable::MEMBERPFNGLPOPNAMEPROC)&ProfilingTableDecorator::m_glPopName_profiling;
+if(this->m_ptr_glTextureBufferEXT)this->m_ptr_glTextureBufferEXT = (FunctionTable::MEMBERPFNGLTEXTUREBUFFEREXTPROC)&ProfilingTableDecorator::m_glTextureBufferEXT_profiling;
+if(this->m_ptr_glGetMultiTexImageEXT)this->m_ptr_glGetMultiTexImageEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXIMAGEEXTPROC)&ProfilingTableDecorator::m_glGetMultiTexImageEXT_profiling;
+if(this->m_ptr_glGetPointerIndexedvEXT)this->m_ptr_glGetPointerIndexedvEXT = (FunctionTable::MEMBERPFNGLGETPOINTERINDEXEDVEXTPROC)&ProfilingTableDecorator::m_glGetPointerIndexedvEXT_profiling;
+if(this->m_ptr_glIsNameAMD)this->m_ptr_glIsNameAMD = (FunctionTable::MEMBERPFNGLISNAMEAMDPROC)&ProfilingTableDecorator::m_glIsNameAMD_profiling;
+if(this->m_ptr_glColor4ub)this->m_ptr_glColor4ub = (FunctionTable::MEMBERPFNGLCOLOR4UBPROC)&ProfilingTableDecorator::m_glColor4ub_profiling;
+if(this->m_ptr_glBufferParameteriAPPLE)this->m_ptr_glBufferParameteriAPPLE = (FunctionTable::MEMBERPFNGLBUFFERPARAMETERIAPPLEPROC)&ProfilingTableDecorator::m_glBufferParameteriAPPLE_profiling;
+if(this->m_ptr_glColor4ui)this->m_ptr_glColor4ui = (FunctionTable::MEMBERPFNGLCOLOR4UIPROC)&ProfilingTableDecorator::m_glColor4ui_profiling;
+if(this->m_ptr_glGetInternalformativ)this->m_ptr_glGetInternalformativ = (FunctionTable::MEMBERPFNGLGETINTERNALFORMATIVPROC)&ProfilingTableDecorator::m_glGetInternalformativ_profiling;
+if(this->m_ptr_glColor4us)this->m_ptr_glColor4us = (FunctionTable::MEMBERPFNGLCOLOR4USPROC)&ProfilingTableDecorator::m_glColor4us_profiling;
+if(this->m_ptr_glVertexAttribP1uiv)this->m_ptr_glVertexAttribP1uiv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBP1UIVPROC)&ProfilingTableDecorator::m_glVertexAttribP1uiv_profiling;
+if(this->m_ptr_glLinkProgram)this->m_ptr_glLinkProgram = (FunctionTable::MEMBERPFNGLLINKPROGRAMPROC)&ProfilingTableDecorator::m_glLinkProgram_profiling;
+if(this->m_ptr_glTexCoord3s)this->m_ptr_glTexCoord3s = (FunctionTable::MEMBERPFNGLTEXCOORD3SPROC)&ProfilingTableDecorator::m_glTexCoord3s_profiling;
+if(this->m_ptr_glTexCoord2dv)this->m_ptr_glTexCoord2dv = (FunctionTable::MEMBERPFNGLTEXCOORD2DVPROC)&ProfilingTableDecorator::m_glTexCoord2dv_profiling;
+if(this->m_ptr_glGetObjectLabel)this->m_ptr_glGetObjectLabel = (FunctionTable::MEMBERPFNGLGETOBJECTLABELPROC)&ProfilingTableDecorator::m_glGetObjectLabel_profiling;
+if(this->m_ptr_glVertexPointerEXT)this->m_ptr_glVertexPointerEXT = (FunctionTable::MEMBERPFNGLVERTEXPOINTEREXTPROC)&ProfilingTableDecorator::m_glVertexPointerEXT_profiling;
+if(this->m_ptr_glDebugMessageCallbackARB)this->m_ptr_glDebugMessageCallbackARB = (FunctionTable::MEMBERPFNGLDEBUGMESSAGECALLBACKARBPROC)&ProfilingTableDecorator::m_glDebugMessageCallbackARB_profiling;
+if(this->m_ptr_glGetString)this->m_ptr_glGetString = (FunctionTable::MEMBERPFNGLGETSTRINGPROC)&ProfilingTableDecorator::m_glGetString_profiling;
+if(this->m_ptr_glGetPathParameterfvNV)this->m_ptr_glGetPathParameterfvNV = (FunctionTable::MEMBERPFNGLGETPATHPARAMETERFVNVPROC)&ProfilingTableDecorator::m_glGetPathParameterfvNV_profiling;
+if(this->m_ptr_glLightxvOES)this->m_ptr_glLightxvOES = (FunctionTable::MEMBERPFNGLLIGHTXVOESPROC)&ProfilingTableDecorator::m_glLightxvOES_profiling;
+if(this->m_ptr_glEndQuery)this->m_ptr_glEndQuery = (FunctionTable::MEMBERPFNGLENDQUERYPROC)&ProfilingTableDecorator::m_glEndQuery_profiling;
+if(this->m_ptr_glSecondaryColor3uiv)this->m_ptr_glSecondaryColor3uiv = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UIVPROC)&ProfilingTableDecorator::m_glSecondaryColor3uiv_profiling;
+if(this->m_ptr_glPrioritizeTexturesxOES)this->m_ptr_glPrioritizeTexturesxOES = (FunctionTable::MEMBERPFNGLPRIORITIZETEXTURESXOESPROC)&ProfilingTableDecorator::m_glPrioritizeTexturesxOES_profiling;
+if(this->m_ptr_glEdgeFlagPointer)this->m_ptr_glEdgeFlagPointer = (FunctionTable::MEMBERPFNGLEDGEFLAGPOINTERPROC)&ProfilingTableDecorator::m_glEdgeFlagPointer_profiling;
+if(this->m_ptr_glFramebufferParameteri)this->m_ptr_glFramebufferParameteri = (FunctionTable::MEMBERPFNGLFRAMEBUFFERPARAMETERIPROC)&ProfilingTableDecorator::m_glFramebufferParameteri_profiling;
+if(this->m_ptr_glTexCoord3hNV)this->m_ptr_glTexCoord3hNV = (FunctionTable::MEMBERPFNGLTEXCOORD3HNVPROC)&ProfilingTableDecorator::m_glTexCoord3hNV_profiling;
+if(this->m_ptr_glMultiModeDrawElementsIBM)this->m_ptr_glMultiModeDrawElementsIBM = (FunctionTable::MEMBERPFNGLMULTIMODEDRAWELEMENTSIBMPROC)&ProfilingTableDecorator::m_glMultiModeDrawElementsIBM_profiling;
+if(this->m_ptr_glCopyPixels)this->m_ptr_glCopyPixels = (FunctionTable::MEMBERPFNGLCOPYPIXELSPROC)&ProfilingTableDecorator::m_glCopyPixels_profiling;
+if(this->m_ptr_glVertexAttribI2ui)this->m_ptr_glVertexAttribI2ui = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI2UIPROC)&ProfilingTableDecorator::m_glVertexAttribI2ui_profiling;
+if(this->m_ptr_glClampColorARB)this->m_ptr_glClampColorARB = (FunctionTable::MEMBERPFNGLCLAMPCOLORARBPROC)&ProfilingTableDecorator::m_glClampColorARB_profiling;
+if(this->m_ptr_glColorPointervINTEL)this->m_ptr_glColorPointervINTEL = (FunctionTable::MEMBERPFNGLCOLORPOINTERVINTELPROC)&ProfilingTableDecorator::m_glColorPointervINTEL_profiling;
+if(this->m_ptr_glDeleteTextures)this->m_ptr_glDeleteTextures = (FunctionTable::MEMBERPFNGLDELETETEXTURESPROC)&ProfilingTableDecorator::m_glDeleteTextures_profiling;
+if(this->m_ptr_glGetMinmaxParameterfvEXT)this->m_ptr_glGetMinmaxParameterfvEXT = (FunctionTable::MEMBERPFNGLGETMINMAXPARAMETERFVEXTPROC)&ProfilingTableDecorator::m_glGetMinmaxParameterfvEXT_profiling;
+if(this->m_ptr_glWindowPos3sMESA)this->m_ptr_glWindowPos3sMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS3SMESAPROC)&ProfilingTableDecorator::m_glWindowPos3sMESA_profiling;
+if(this->m_ptr_glVertexAttrib4f)this->m_ptr_glVertexAttrib4f = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4FPROC)&ProfilingTableDecorator::m_glVertexAttrib4f_profiling;
+if(this->m_ptr_glNamedFramebufferParameteri)this->m_ptr_glNamedFramebufferParameteri = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERPARAMETERIPROC)&ProfilingTableDecorator::m_glNamedFramebufferParameteri_profiling;
+if(this->m_ptr_glTexCoord2fVertex3fvSUN)this->m_ptr_glTexCoord2fVertex3fvSUN = (FunctionTable::MEMBERPFNGLTEXCOORD2FVERTEX3FVSUNPROC)&ProfilingTableDecorator::m_glTexCoord2fVertex3fvSUN_profiling;
+if(this->m_ptr_glReplacementCodeusSUN)this->m_ptr_glReplacementCodeusSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUSSUNPROC)&ProfilingTableDecorator::m_glReplacementCodeusSUN_profiling;
+if(this->m_ptr_glGetNamedFramebufferParameteriv)this->m_ptr_glGetNamedFramebufferParameteriv = (FunctionTable::MEMBERPFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC)&ProfilingTableDecorator::m_glGetNamedFramebufferParameteriv_profiling;
+if(this->m_ptr_glVertexStream1fvATI)this->m_ptr_glVertexStream1fvATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM1FVATIPROC)&ProfilingTableDecorator::m_glVertexStream1fvATI_profiling;
+if(this->m_ptr_glCreateVertexArrays)this->m_ptr_glCreateVertexArrays = (FunctionTable::MEMBERPFNGLCREATEVERTEXARRAYSPROC)&ProfilingTableDecorator::m_glCreateVertexArrays_profiling;
+if(this->m_ptr_glBeginConditionalRender)this->m_ptr_glBeginConditionalRender = (FunctionTable::MEMBERPFNGLBEGINCONDITIONALRENDERPROC)&ProfilingTableDecorator::m_glBeginConditionalRender_profiling;
+if(this->m_ptr_glConvolutionFilter1D)this->m_ptr_glConvolutionFilter1D = (FunctionTable::MEMBERPFNGLCONVOLUTIONFILTER1DPROC)&ProfilingTableDecorator::m_glConvolutionFilter1D_profiling;
+if(this->m_ptr_glMultiTexCoord3fARB)this->m_ptr_glMultiTexCoord3fARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3FARBPROC)&ProfilingTableDecorator::m_glMultiTexCoord3fARB_profiling;
+if(this->m_ptr_glGetQueryObjectuivARB)this->m_ptr_glGetQueryObjectuivARB = (FunctionTable::MEMBERPFNGLGETQUERYOBJECTUIVARBPROC)&ProfilingTableDecorator::m_glGetQueryObjectuivARB_profiling;
+if(this->m_ptr_glScalexOES)this->m_ptr_glScalexOES = (FunctionTable::MEMBERPFNGLSCALEXOESPROC)&ProfilingTableDecorator::m_glScalexOES_profiling;
+if(this->m_ptr_glSamplerParameteri)this->m_ptr_glSamplerParameteri = (FunctionTable::MEMBERPFNGLSAMPLERPARAMETERIPROC)&ProfilingTableDecorator::m_glSamplerParameteri_profiling;
+if(this->m_ptr_glSamplerParameterf)this->m_ptr_glSamplerParameterf = (FunctionTable::MEMBERPFNGLSAMPLERPARAMETERFPROC)&ProfilingTableDecorator::m_glSamplerParameterf_profiling;
+if(this->m_ptr_glShaderOp1EXT)this->m_ptr_glShaderOp1EXT = (FunctionTable::MEMBERPFNGLSHADEROP1EXTPROC)&ProfilingTableDecorator::m_glShaderOp1EXT_profiling;
+if(this->m_ptr_glBeginVideoCaptureNV)this->m_ptr_glBeginVideoCaptureNV = (FunctionTable::MEMBERPFNGLBEGINVIDEOCAPTURENVPROC)&ProfilingTableDecorator::m_glBeginVideoCaptureNV_profiling;
+if(this->m_ptr_glGetnHistogram)this->m_ptr_glGetnHistogram = (FunctionTable::MEMBERPFNGLGETNHISTOGRAMPROC)&ProfilingTableDecorator::m_glGetnHistogram_profiling;
+if(this->m_ptr_glUniform1d)this->m_ptr_glUniform1d = (FunctionTable::MEMBERPFNGLUNIFORM1DPROC)&ProfilingTableDecorator::m_glUniform1d_profiling;
+if(this->m_ptr_glRenderMode)this->m_ptr_glRenderMode = (FunctionTable::MEMBERPFNGLRENDERMODEPROC)&ProfilingTableDecorator::m_glRenderMode_profiling;
+if(this->m_ptr_glClearColorIiEXT)this->m_ptr_glClearColorIiEXT = (FunctionTable::MEMBERPFNGLCLEARCOLORIIEXTPROC)&ProfilingTableDecorator::m_glClearColorIiEXT_profiling;
+if(this->m_ptr_glGetCompressedTexImage)this->m_ptr_glGetCompressedTexImage = (FunctionTable::MEMBERPFNGLGETCOMPRESSEDTEXIMAGEPROC)&ProfilingTableDecorator::m_glGetCompressedTexImage_profiling;
+if(this->m_ptr_glCompressedTextureImage1DEXT)this->m_ptr_glCompressedTextureImage1DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTUREIMAGE1DEXTPROC)&ProfilingTableDecorator::m_glCompressedTextureImage1DEXT_profiling;
+if(this->m_ptr_glGetActiveUniformBlockiv)this->m_ptr_glGetActiveUniformBlockiv = (FunctionTable::MEMBERPFNGLGETACTIVEUNIFORMBLOCKIVPROC)&ProfilingTableDecorator::m_glGetActiveUniformBlockiv_profiling;
+if(this->m_ptr_glUniform1i)this->m_ptr_glUniform1i = (FunctionTable::MEMBERPFNGLUNIFORM1IPROC)&ProfilingTableDecorator::m_glUniform1i_profiling;
+if(this->m_ptr_glGetTexEnvfv)this->m_ptr_glGetTexEnvfv = (FunctionTable::MEMBERPFNGLGETTEXENVFVPROC)&ProfilingTableDecorator::m_glGetTexEnvfv_profiling;
+if(this->m_ptr_glColorTableParameterivSGI)this->m_ptr_glColorTableParameterivSGI = (FunctionTable::MEMBERPFNGLCOLORTABLEPARAMETERIVSGIPROC)&ProfilingTableDecorator::m_glColorTableParameterivSGI_profiling;
+if(this->m_ptr_glCullFace)this->m_ptr_glCullFace = (FunctionTable::MEMBERPFNGLCULLFACEPROC)&ProfilingTableDecorator::m_glCullFace_profiling;
+if(this->m_ptr_glDeleteFencesAPPLE)this->m_ptr_glDeleteFencesAPPLE = (FunctionTable::MEMBERPFNGLDELETEFENCESAPPLEPROC)&ProfilingTableDecorator::m_glDeleteFencesAPPLE_profiling;
+if(this->m_ptr_glProgramUniform4i)this->m_ptr_glProgramUniform4i = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4IPROC)&ProfilingTableDecorator::m_glProgramUniform4i_profiling;
+if(this->m_ptr_glUniformHandleui64ARB)this->m_ptr_glUniformHandleui64ARB = (FunctionTable::MEMBERPFNGLUNIFORMHANDLEUI64ARBPROC)&ProfilingTableDecorator::m_glUniformHandleui64ARB_profiling;
+if(this->m_ptr_glProgramUniform4f)this->m_ptr_glProgramUniform4f = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4FPROC)&ProfilingTableDecorator::m_glProgramUniform4f_profiling;
+if(this->m_ptr_glViewportIndexedf)this->m_ptr_glViewportIndexedf = (FunctionTable::MEMBERPFNGLVIEWPORTINDEXEDFPROC)&ProfilingTableDecorator::m_glViewportIndexedf_profiling;
+if(this->m_ptr_glProgramUniform4d)this->m_ptr_glProgramUniform4d = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4DPROC)&ProfilingTableDecorator::m_glProgramUniform4d_profiling;
+if(this->m_ptr_glTexCoord1xOES)this->m_ptr_glTexCoord1xOES = (FunctionTable::MEMBERPFNGLTEXCOORD1XOESPROC)&ProfilingTableDecorator::m_glTexCoord1xOES_profiling;
+if(this->m_ptr_glVertexStream3ivATI)this->m_ptr_glVertexStream3ivATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM3IVATIPROC)&ProfilingTableDecorator::m_glVertexStream3ivATI_profiling;
+if(this->m_ptr_glGetStringi)this->m_ptr_glGetStringi = (FunctionTable::MEMBERPFNGLGETSTRINGIPROC)&ProfilingTableDecorator::m_glGetStringi_profiling;
+if(this->m_ptr_glEndQueryARB)this->m_ptr_glEndQueryARB = (FunctionTable::MEMBERPFNGLENDQUERYARBPROC)&ProfilingTableDecorator::m_glEndQueryARB_profiling;
+if(this->m_ptr_glVDPAUMapSurfacesNV)this->m_ptr_glVDPAUMapSurfacesNV = (FunctionTable::MEMBERPFNGLVDPAUMAPSURFACESNVPROC)&ProfilingTableDecorator::m_glVDPAUMapSurfacesNV_profiling;
+if(this->m_ptr_glVertex3i)this->m_ptr_glVertex3i = (FunctionTable::MEMBERPFNGLVERTEX3IPROC)&ProfilingTableDecorator::m_glVertex3i_profiling;
+if(this->m_ptr_glVertexAttrib4uivARB)this->m_ptr_glVertexAttrib4uivARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4UIVARBPROC)&ProfilingTableDecorator::m_glVertexAttrib4uivARB_profiling;
+if(this->m_ptr_glResumeTransformFeedbackNV)this->m_ptr_glResumeTransformFeedbackNV = (FunctionTable::MEMBERPFNGLRESUMETRANSFORMFEEDBACKNVPROC)&ProfilingTableDecorator::m_glResumeTransformFeedbackNV_profiling;
+if(this->m_ptr_glAttachShader)this->m_ptr_glAttachShader = (FunctionTable::MEMBERPFNGLATTACHSHADERPROC)&ProfilingTableDecorator::m_glAttachShader_profiling;
+if(this->m_ptr_glColor4hNV)this->m_ptr_glColor4hNV = (FunctionTable::MEMBERPFNGLCOLOR4HNVPROC)&ProfilingTableDecorator::m_glColor4hNV_profiling;
+if(this->m_ptr_glGetFenceivNV)this->m_ptr_glGetFenceivNV = (FunctionTable::MEMBERPFNGLGETFENCEIVNVPROC)&ProfilingTableDecorator::m_glGetFenceivNV_profiling;
+if(this->m_ptr_glTexCoord2fColor4ubVertex3fvSUN)this->m_ptr_glTexCoord2fColor4ubVertex3fvSUN = (FunctionTable::MEMBERPFNGLTEXCOORD2FCOLOR4UBVERTEX3FVSUNPROC)&ProfilingTableDecorator::m_glTexCoord2fColor4ubVertex3fvSUN_profiling;
+if(this->m_ptr_glGetColorTable)this->m_ptr_glGetColorTable = (FunctionTable::MEMBERPFNGLGETCOLORTABLEPROC)&ProfilingTableDecorator::m_glGetColorTable_profiling;
+if(this->m_ptr_glFogCoordPointer)this->m_ptr_glFogCoordPointer = (FunctionTable::MEMBERPFNGLFOGCOORDPOINTERPROC)&ProfilingTableDecorator::m_glFogCoordPointer_profiling;
+if(this->m_ptr_glTexStorageSparseAMD)this->m_ptr_glTexStorageSparseAMD = (FunctionTable::MEMBERPFNGLTEXSTORAGESPARSEAMDPROC)&ProfilingTableDecorator::m_glTexStorageSparseAMD_profiling;
+if(this->m_ptr_glUnmapNamedBuffer)this->m_ptr_glUnmapNamedBuffer = (FunctionTable::MEMBERPFNGLUNMAPNAMEDBUFFERPROC)&ProfilingTableDecorator::m_glUnmapNamedBuffer_profiling;
+if(this->m_ptr_glTexCoord4bvOES)this->m_ptr_glTexCoord4bvOES = (FunctionTable::MEMBERPFNGLTEXCOORD4BVOESPROC)&ProfilingTableDecorator::m_glTexCoord4bvOES_profiling;
+if(this->m_ptr_glVertexAttrib3fARB)this->m_ptr_glVertexAttrib3fARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3FARBPROC)&ProfilingTableDecorator::m_glVertexAttrib3fARB_profiling;
+if(this->m_ptr_glRasterPos2xOES)this->m_ptr_glRasterPos2xOES = (FunctionTable::MEMBERPFNGLRASTERPOS2XOESPROC)&ProfilingTableDecorator::m_glRasterPos2xOES_profiling;
+if(this->m_ptr_glColor4ubVertex2fvSUN)this->m_ptr_glColor4ubVertex2fvSUN = (FunctionTable::MEMBERPFNGLCOLOR4UBVERTEX2FVSUNPROC)&ProfilingTableDecorator::m_glColor4ubVertex2fvSUN_profiling;
+if(this->m_ptr_glSecondaryColor3dv)this->m_ptr_glSecondaryColor3dv = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3DVPROC)&ProfilingTableDecorator::m_glSecondaryColor3dv_profiling;
+if(this->m_ptr_glVertexAttribI4sv)this->m_ptr_glVertexAttribI4sv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4SVPROC)&ProfilingTableDecorator::m_glVertexAttribI4sv_profiling;
+if(this->m_ptr_glDrawTransformFeedbackStreamInstanced)this->m_ptr_glDrawTransformFeedbackStreamInstanced = (FunctionTable::MEMBERPFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC)&ProfilingTableDecorator::m_glDrawTransformFeedbackStreamInstanced_profiling;
+if(this->m_ptr_glMultiTexCoord4ivARB)this->m_ptr_glMultiTexCoord4ivARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4IVARBPROC)&ProfilingTableDecorator::m_glMultiTexCoord4ivARB_profiling;
+if(this->m_ptr_glSpriteParameterfSGIX)this->m_ptr_glSpriteParameterfSGIX = (FunctionTable::MEMBERPFNGLSPRITEPARAMETERFSGIXPROC)&ProfilingTableDecorator::m_glSpriteParameterfSGIX_profiling;
+if(this->m_ptr_glSecondaryColor3sv)this->m_ptr_glSecondaryColor3sv = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3SVPROC)&ProfilingTableDecorator::m_glSecondaryColor3sv_profiling;
+if(this->m_ptr_glBindVideoCaptureStreamTextureNV)this->m_ptr_glBindVideoCaptureStreamTextureNV = (FunctionTable::MEMBERPFNGLBINDVIDEOCAPTURESTREAMTEXTURENVPROC)&ProfilingTableDecorator::m_glBindVideoCaptureStreamTextureNV_profiling;
+if(this->m_ptr_glTexParameterIuiv)this->m_ptr_glTexParameterIuiv = (FunctionTable::MEMBERPFNGLTEXPARAMETERIUIVPROC)&ProfilingTableDecorator::m_glTexParameterIuiv_profiling;
+if(this->m_ptr_glFlushPixelDataRangeNV)this->m_ptr_glFlushPixelDataRangeNV = (FunctionTable::MEMBERPFNGLFLUSHPIXELDATARANGENVPROC)&ProfilingTableDecorator::m_glFlushPixelDataRangeNV_profiling;
+if(this->m_ptr_glWindowPos3fv)this->m_ptr_glWindowPos3fv = (FunctionTable::MEMBERPFNGLWINDOWPOS3FVPROC)&ProfilingTableDecorator::m_glWindowPos3fv_profiling;
+if(this->m_ptr_glVertexAttribLFormatNV)this->m_ptr_glVertexAttribLFormatNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBLFORMATNVPROC)&ProfilingTableDecorator::m_glVertexAttribLFormatNV_profiling;
+if(this->m_ptr_glLightModelfv)this->m_ptr_glLightModelfv = (FunctionTable::MEMBERPFNGLLIGHTMODELFVPROC)&ProfilingTableDecorator::m_glLightModelfv_profiling;
+if(this->m_ptr_glGetColorTableSGI)this->m_ptr_glGetColorTableSGI = (FunctionTable::MEMBERPFNGLGETCOLORTABLESGIPROC)&ProfilingTableDecorator::m_glGetColorTableSGI_profiling;
+if(this->m_ptr_glGetCompressedTexImageARB)this->m_ptr_glGetCompressedTexImageARB = (FunctionTable::MEMBERPFNGLGETCOMPRESSEDTEXIMAGEARBPROC)&ProfilingTableDecorator::m_glGetCompressedTexImageARB_profiling;
+if(this->m_ptr_glConvolutionParameteri)this->m_ptr_glConvolutionParameteri = (FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERIPROC)&ProfilingTableDecorator::m_glConvolutionParameteri_profiling;
+if(this->m_ptr_glVertexWeighthNV)this->m_ptr_glVertexWeighthNV = (FunctionTable::MEMBERPFNGLVERTEXWEIGHTHNVPROC)&ProfilingTableDecorator::m_glVertexWeighthNV_profiling;
+if(this->m_ptr_glColorMaskIndexedEXT)this->m_ptr_glColorMaskIndexedEXT = (FunctionTable::MEMBERPFNGLCOLORMASKINDEXEDEXTPROC)&ProfilingTableDecorator::m_glColorMaskIndexedEXT_profiling;
+if(this->m_ptr_glColorMaski)this->m_ptr_glColorMaski = (FunctionTable::MEMBERPFNGLCOLORMASKIPROC)&ProfilingTableDecorator::m_glColorMaski_profiling;
+if(this->m_ptr_glColorFragmentOp1ATI)this->m_ptr_glColorFragmentOp1ATI = (FunctionTable::MEMBERPFNGLCOLORFRAGMENTOP1ATIPROC)&ProfilingTableDecorator::m_glColorFragmentOp1ATI_profiling;
+if(this->m_ptr_glVertexAttribI4ubvEXT)this->m_ptr_glVertexAttribI4ubvEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4UBVEXTPROC)&ProfilingTableDecorator::m_glVertexAttribI4ubvEXT_profiling;
+if(this->m_ptr_glVertexAttrib1dNV)this->m_ptr_glVertexAttrib1dNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1DNVPROC)&ProfilingTableDecorator::m_glVertexAttrib1dNV_profiling;
+if(this->m_ptr_glUnmapObjectBufferATI)this->m_ptr_glUnmapObjectBufferATI = (FunctionTable::MEMBERPFNGLUNMAPOBJECTBUFFERATIPROC)&ProfilingTableDecorator::m_glUnmapObjectBufferATI_profiling;
+if(this->m_ptr_glNamedProgramLocalParameterI4uiEXT)this->m_ptr_glNamedProgramLocalParameterI4uiEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERI4UIEXTPROC)&ProfilingTableDecorator::m_glNamedProgramLocalParameterI4uiEXT_profiling;
+if(this->m_ptr_glProgramUniform1iEXT)this->m_ptr_glProgramUniform1iEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1IEXTPROC)&ProfilingTableDecorator::m_glProgramUniform1iEXT_profiling;
+if(this->m_ptr_glDeleteQueriesARB)this->m_ptr_glDeleteQueriesARB = (FunctionTable::MEMBERPFNGLDELETEQUERIESARBPROC)&ProfilingTableDecorator::m_glDeleteQueriesARB_profiling;
+if(this->m_ptr_glWindowPos3svARB)this->m_ptr_glWindowPos3svARB = (FunctionTable::MEMBERPFNGLWINDOWPOS3SVARBPROC)&ProfilingTableDecorator::m_glWindowPos3svARB_profiling;
+if(this->m_ptr_glVertex4s)this->m_ptr_glVertex4s = (FunctionTable::MEMBERPFNGLVERTEX4SPROC)&ProfilingTableDecorator::m_glVertex4s_profiling;
+if(this->m_ptr_glStringMarkerGREMEDY)this->m_ptr_glStringMarkerGREMEDY = (FunctionTable::MEMBERPFNGLSTRINGMARKERGREMEDYPROC)&ProfilingTableDecorator::m_glStringMarkerGREMEDY_profiling;
+if(this->m_ptr_glIsTransformFeedback)this->m_ptr_glIsTransformFeedback = (FunctionTable::MEMBERPFNGLISTRANSFORMFEEDBACKPROC)&ProfilingTableDecorator::m_glIsTransformFeedback_profiling;
+if(this->m_ptr_glProgramUniformMatrix2x3dvEXT)this->m_ptr_glProgramUniformMatrix2x3dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X3DVEXTPROC)&ProfilingTableDecorator::m_glProgramUniformMatrix2x3dvEXT_profiling;
+if(this->m_ptr_glGetObjectLabelEXT)this->m_ptr_glGetObjectLabelEXT = (FunctionTable::MEMBERPFNGLGETOBJECTLABELEXTPROC)&ProfilingTableDecorator::m_glGetObjectLabelEXT_profiling;
+if(this->m_ptr_glUniformHandleui64vNV)this->m_ptr_glUniformHandleui64vNV = (FunctionTable::MEMBERPFNGLUNIFORMHANDLEUI64VNVPROC)&ProfilingTableDecorator::m_glUniformHandleui64vNV_profiling;
+if(this->m_ptr_glRotated)this->m_ptr_glRotated = (FunctionTable::MEMBERPFNGLROTATEDPROC)&ProfilingTableDecorator::m_glRotated_profiling;
+if(this->m_ptr_glIsProgramPipeline)this->m_ptr_glIsProgramPipeline = (FunctionTable::MEMBERPFNGLISPROGRAMPIPELINEPROC)&ProfilingTableDecorator::m_glIsProgramPipeline_profiling;
+if(this->m_ptr_glRotatef)this->m_ptr_glRotatef = (FunctionTable::MEMBERPFNGLROTATEFPROC)&ProfilingTableDecorator::m_glRotatef_profiling;
+if(this->m_ptr_glVertex4i)this->m_ptr_glVertex4i = (FunctionTable::MEMBERPFNGLVERTEX4IPROC)&ProfilingTableDecorator::m_glVertex4i_profiling;
+if(this->m_ptr_glGetActiveSubroutineUniformName)this->m_ptr_glGetActiveSubroutineUniformName = (FunctionTable::MEMBERPFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC)&ProfilingTableDecorator::m_glGetActiveSubroutineUniformName_profiling;
+if(this->m_ptr_glVertexAttrib4sNV)this->m_ptr_glVertexAttrib4sNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4SNVPROC)&ProfilingTableDecorator::m_glVertexAttrib4sNV_profiling;
+if(this->m_ptr_glProgramLocalParameter4dvARB)this->m_ptr_glProgramLocalParameter4dvARB = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETER4DVARBPROC)&ProfilingTableDecorator::m_glProgramLocalParameter4dvARB_profiling;
+if(this->m_ptr_glReplacementCodeubSUN)this->m_ptr_glReplacementCodeubSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUBSUNPROC)&ProfilingTableDecorator::m_glReplacementCodeubSUN_profiling;
+if(this->m_ptr_glMultiDrawElementsIndirectBindlessNV)this->m_ptr_glMultiDrawElementsIndirectBindlessNV = (FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSINDIRECTBINDLESSNVPROC)&ProfilingTableDecorator::m_glMultiDrawElementsIndirectBindlessNV_profiling;
+if(this->m_ptr_glUniformMatrix3fv)this->m_ptr_glUniformMatrix3fv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX3FVPROC)&ProfilingTableDecorator::m_glUniformMatrix3fv_profiling;
+if(this->m_ptr_glGetnMapfvARB)this->m_ptr_glGetnMapfvARB = (FunctionTable::MEMBERPFNGLGETNMAPFVARBPROC)&ProfilingTableDecorator::m_glGetnMapfvARB_profiling;
+if(this->m_ptr_glGetnUniformfv)this->m_ptr_glGetnUniformfv = (FunctionTable::MEMBERPFNGLGETNUNIFORMFVPROC)&ProfilingTableDecorator::m_glGetnUniformfv_profiling;
+if(this->m_ptr_glVertexAttribL2dv)this->m_ptr_glVertexAttribL2dv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL2DVPROC)&ProfilingTableDecorator::m_glVertexAttribL2dv_profiling;
+if(this->m_ptr_glVertexWeightPointerEXT)this->m_ptr_glVertexWeightPointerEXT = (FunctionTable::MEMBERPFNGLVERTEXWEIGHTPOINTEREXTPROC)&ProfilingTableDecorator::m_glVertexWeightPointerEXT_profiling;
+if(this->m_ptr_glTangent3sEXT)this->m_ptr_glTangent3sEXT = (FunctionTable::MEMBERPFNGLTANGENT3SEXTPROC)&ProfilingTableDecorator::m_glTangent3sEXT_profiling;
+if(this->m_ptr_glSecondaryColorPointer)this->m_ptr_glSecondaryColorPointer = (FunctionTable::MEMBERPFNGLSECONDARYCOLORPOINTERPROC)&ProfilingTableDecorator::m_glSecondaryColorPointer_profiling;
+if(this->m_ptr_glAlphaFunc)this->m_ptr_glAlphaFunc = (FunctionTable::MEMBERPFNGLALPHAFUNCPROC)&ProfilingTableDecorator::m_glAlphaFunc_profiling;
+if(this->m_ptr_glGetNamedStringARB)this->m_ptr_glGetNamedStringARB = (FunctionTable::MEMBERPFNGLGETNAMEDSTRINGARBPROC)&ProfilingTableDecorator::m_glGetNamedStringARB_profiling;
+if(this->m_ptr_glTexCoord4d)this->m_ptr_glTexCoord4d = (FunctionTable::MEMBERPFNGLTEXCOORD4DPROC)&ProfilingTableDecorator::m_glTexCoord4d_profiling;
+if(this->m_ptr_glBufferPageCommitmentARB)this->m_ptr_glBufferPageCommitmentARB = (FunctionTable::MEMBERPFNGLBUFFERPAGECOMMITMENTARBPROC)&ProfilingTableDecorator::m_glBufferPageCommitmentARB_profiling;
+if(this->m_ptr_glProgramLocalParameters4fvEXT)this->m_ptr_glProgramLocalParameters4fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERS4FVEXTPROC)&ProfilingTableDecorator::m_glProgramLocalParameters4fvEXT_profiling;
+if(this->m_ptr_glStencilFunc)this->m_ptr_glStencilFunc = (FunctionTable::MEMBERPFNGLSTENCILFUNCPROC)&ProfilingTableDecorator::m_glStencilFunc_profiling;
+if(this->m_ptr_glGetVertexAttribdvNV)this->m_ptr_glGetVertexAttribdvNV = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBDVNVPROC)&ProfilingTableDecorator::m_glGetVertexAttribdvNV_profiling;
+if(this->m_ptr_glTexCoord3dv)this->m_ptr_glTexCoord3dv = (FunctionTable::MEMBERPFNGLTEXCOORD3DVPROC)&ProfilingTableDecorator::m_glTexCoord3dv_profiling;
+if(this->m_ptr_glGetQueryBufferObjectiv)this->m_ptr_glGetQueryBufferObjectiv = (FunctionTable::MEMBERPFNGLGETQUERYBUFFEROBJECTIVPROC)&ProfilingTableDecorator::m_glGetQueryBufferObjectiv_profiling;
+if(this->m_ptr_glTexGenxOES)this->m_ptr_glTexGenxOES = (FunctionTable::MEMBERPFNGLTEXGENXOESPROC)&ProfilingTableDecorator::m_glTexGenxOES_profiling;
+if(this->m_ptr_glMultiTexCoord1fvARB)this->m_ptr_glMultiTexCoord1fvARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1FVARBPROC)&ProfilingTableDecorator::m_glMultiTexCoord1fvARB_profiling;
+if(this->m_ptr_glLightEnviSGIX)this->m_ptr_glLightEnviSGIX = (FunctionTable::MEMBERPFNGLLIGHTENVISGIXPROC)&ProfilingTableDecorator::m_glLightEnviSGIX_profiling;
+if(this->m_ptr_glGetProgramPipelineiv)this->m_ptr_glGetProgramPipelineiv = (FunctionTable::MEMBERPFNGLGETPROGRAMPIPELINEIVPROC)&ProfilingTableDecorator::m_glGetProgramPipelineiv_profiling;
+if(this->m_ptr_glVertexStream2ivATI)this->m_ptr_glVertexStream2ivATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM2IVATIPROC)&ProfilingTableDecorator::m_glVertexStream2ivATI_profiling;
+if(this->m_ptr_glGetColorTableEXT)this->m_ptr_glGetColorTableEXT = (FunctionTable::MEMBERPFNGLGETCOLORTABLEEXTPROC)&ProfilingTableDecorator::m_glGetColorTableEXT_profiling;
+if(this->m_ptr_glGetShaderInfoLog)this->m_ptr_glGetShaderInfoLog = (FunctionTable::MEMBERPFNGLGETSHADERINFOLOGPROC)&ProfilingTableDecorator::m_glGetShaderInfoLog_profiling;
+if(this->m_ptr_glGetOcclusionQueryuivNV)this->m_ptr_glGetOcclusionQueryuivNV = (FunctionTable::MEMBERPFNGLGETOCCLUSIONQUERYUIVNVPROC)&ProfilingTableDecorator::m_glGetOcclusionQueryuivNV_profiling;
+if(this->m_ptr_glInvalidateNamedFramebufferSubData)this->m_ptr_glInvalidateNamedFramebufferSubData = (FunctionTable::MEMBERPFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC)&ProfilingTableDecorator::m_glInvalidateNamedFramebufferSubData_profiling;
+if(this->m_ptr_glVertexAttribL1i64NV)this->m_ptr_glVertexAttribL1i64NV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL1I64NVPROC)&ProfilingTableDecorator::m_glVertexAttribL1i64NV_profiling;
+if(this->m_ptr_glVDPAUInitNV)this->m_ptr_glVDPAUInitNV = (FunctionTable::MEMBERPFNGLVDPAUINITNVPROC)&ProfilingTableDecorator::m_glVDPAUInitNV_profiling;
+if(this->m_ptr_glVertexAttrib1hvNV)this->m_ptr_glVertexAttrib1hvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1HVNVPROC)&ProfilingTableDecorator::m_glVertexAttrib1hvNV_profiling;
+if(this->m_ptr_glVertexAttribI4i)this->m_ptr_glVertexAttribI4i = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4IPROC)&ProfilingTableDecorator::m_glVertexAttribI4i_profiling;
+if(this->m_ptr_glRasterPos2iv)this->m_ptr_glRasterPos2iv = (FunctionTable::MEMBERPFNGLRASTERPOS2IVPROC)&ProfilingTableDecorator::m_glRasterPos2iv_profiling;
+if(this->m_ptr_glGetIntegerui64i_vNV)this->m_ptr_glGetIntegerui64i_vNV = (FunctionTable::MEMBERPFNGLGETINTEGERUI64I_VNVPROC)&ProfilingTableDecorator::m_glGetIntegerui64i_vNV_profiling;
+if(this->m_ptr_glUniformHandleui64NV)this->m_ptr_glUniformHandleui64NV = (FunctionTable::MEMBERPFNGLUNIFORMHANDLEUI64NVPROC)&ProfilingTableDecorator::m_glUniformHandleui64NV_profiling;
+if(this->m_ptr_glWindowPos3ivMESA)this->m_ptr_glWindowPos3ivMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS3IVMESAPROC)&ProfilingTableDecorator::m_glWindowPos3ivMESA_profiling;
+if(this->m_ptr_glBlendEquationSeparate)this->m_ptr_glBlendEquationSeparate = (FunctionTable::MEMBERPFNGLBLENDEQUATIONSEPARATEPROC)&ProfilingTableDecorator::m_glBlendEquationSeparate_profiling;
+if(this->m_ptr_glDrawElementsInstancedARB)this->m_ptr_glDrawElementsInstancedARB = (FunctionTable::MEMBERPFNGLDRAWELEMENTSINSTANCEDARBPROC)&ProfilingTableDecorator::m_glDrawElementsInstancedARB_profiling;
+if(this->m_ptr_glGetSubroutineIndex)this->m_ptr_glGetSubroutineIndex = (FunctionTable::MEMBERPFNGLGETSUBROUTINEINDEXPROC)&ProfilingTableDecorator::m_glGetSubroutineIndex_profiling;
+if(this->m_ptr_glVertexAttrib2sv)this->m_ptr_glVertexAttrib2sv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2SVPROC)&ProfilingTableDecorator::m_glVertexAttrib2sv_profiling;
+if(this->m_ptr_glSamplePatternSGIS)this->m_ptr_glSamplePatternSGIS = (FunctionTable::MEMBERPFNGLSAMPLEPATTERNSGISPROC)&ProfilingTableDecorator::m_glSamplePatternSGIS_profiling;
+if(this->m_ptr_glEGLImageTargetRenderbufferStorageOES)this->m_ptr_glEGLImageTargetRenderbufferStorageOES = (FunctionTable::MEMBERPFNGLEGLIMAGETARGETRENDERBUFFERSTORAGEOESPROC)&ProfilingTableDecorator::m_glEGLImageTargetRenderbufferStorageOES_profiling;
+if(this->m_ptr_glPushAttrib)this->m_ptr_glPushAttrib = (FunctionTable::MEMBERPFNGLPUSHATTRIBPROC)&ProfilingTableDecorator::m_glPushAttrib_profiling;
+if(this->m_ptr_glVertex3hNV)this->m_ptr_glVertex3hNV = (FunctionTable::MEMBERPFNGLVERTEX3HNVPROC)&ProfilingTableDecorator::m_glVertex3hNV_profiling;
+if(this->m_ptr_glRasterPos3xvOES)this->m_ptr_glRasterPos3xvOES = (FunctionTable::MEMBERPFNGLRASTERPOS3XVOESPROC)&ProfilingTableDecorator::m_glRasterPos3xvOES_profiling;
+if(this->m_ptr_glPathParameterfNV)this->m_ptr_glPathParameterfNV = (FunctionTable::MEMBERPFNGLPATHPARAMETERFNVPROC)&ProfilingTableDecorator::m_glPathParameterfNV_profiling;
+if(this->m_ptr_glGetUniformi64vNV)this->m_ptr_glGetUniformi64vNV = (FunctionTable::MEMBERPFNGLGETUNIFORMI64VNVPROC)&ProfilingTableDecorator::m_glGetUniformi64vNV_profiling;
+if(this->m_ptr_glLightiv)this->m_ptr_glLightiv = (FunctionTable::MEMBERPFNGLLIGHTIVPROC)&ProfilingTableDecorator::m_glLightiv_profiling;
+if(this->m_ptr_glMaterialxvOES)this->m_ptr_glMaterialxvOES = (FunctionTable::MEMBERPFNGLMATERIALXVOESPROC)&ProfilingTableDecorator::m_glMaterialxvOES_profiling;
+if(this->m_ptr_glNamedProgramLocalParameter4fEXT)this->m_ptr_glNamedProgramLocalParameter4fEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETER4FEXTPROC)&ProfilingTableDecorator::m_glNamedProgramLocalParameter4fEXT_profiling;
+if(this->m_ptr_glVertexAttribL1dEXT)this->m_ptr_glVertexAttribL1dEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL1DEXTPROC)&ProfilingTableDecorator::m_glVertexAttribL1dEXT_profiling;
+if(this->m_ptr_glGetnUniformdvARB)this->m_ptr_glGetnUniformdvARB = (FunctionTable::MEMBERPFNGLGETNUNIFORMDVARBPROC)&ProfilingTableDecorator::m_glGetnUniformdvARB_profiling;
+if(this->m_ptr_glSecondaryColor3bEXT)this->m_ptr_glSecondaryColor3bEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3BEXTPROC)&ProfilingTableDecorator::m_glSecondaryColor3bEXT_profiling;
+if(this->m_ptr_glBeginPerfQueryINTEL)this->m_ptr_glBeginPerfQueryINTEL = (FunctionTable::MEMBERPFNGLBEGINPERFQUERYINTELPROC)&ProfilingTableDecorator::m_glBeginPerfQueryINTEL_profiling;
+if(this->m_ptr_glProgramUniform1uivEXT)this->m_ptr_glProgramUniform1uivEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UIVEXTPROC)&ProfilingTableDecorator::m_glProgramUniform1uivEXT_profiling;
+if(this->m_ptr_glImageTransformParameterivHP)this->m_ptr_glImageTransformParameterivHP = (FunctionTable::MEMBERPFNGLIMAGETRANSFORMPARAMETERIVHPPROC)&ProfilingTableDecorator::m_glImageTransformParameterivHP_profiling;
+if(this->m_ptr_glDeleteBuffers)this->m_ptr_glDeleteBuffers = (FunctionTable::MEMBERPFNGLDELETEBUFFERSPROC)&ProfilingTableDecorator::m_glDeleteBuffers_profiling;
+if(this->m_ptr_glBindProgramPipeline)this->m_ptr_glBindProgramPipeline = (FunctionTable::MEMBERPFNGLBINDPROGRAMPIPELINEPROC)&ProfilingTableDecorator::m_glBindProgramPipeline_profiling;
+if(this->m_ptr_glScissor)this->m_ptr_glScissor = (FunctionTable::MEMBERPFNGLSCISSORPROC)&ProfilingTableDecorator::m_glScissor_profiling;
+if(this->m_ptr_glProgramUniform4fv)this->m_ptr_glProgramUniform4fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4FVPROC)&ProfilingTableDecorator::m_glProgramUniform4fv_profiling;
+if(this->m_ptr_glGetBooleanv)this->m_ptr_glGetBooleanv = (FunctionTable::MEMBERPFNGLGETBOOLEANVPROC)&ProfilingTableDecorator::m_glGetBooleanv_profiling;
+if(this->m_ptr_glMaterialfv)this->m_ptr_glMaterialfv = (FunctionTable::MEMBERPFNGLMATERIALFVPROC)&ProfilingTableDecorator::m_glMaterialfv_profiling;
+if(this->m_ptr_glWindowPos4fvMESA)this->m_ptr_glWindowPos4fvMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS4FVMESAPROC)&ProfilingTableDecorator::m_glWindowPos4fvMESA_profiling;
+if(this->m_ptr_glVertexAttribIPointerEXT)this->m_ptr_glVertexAttribIPointerEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBIPOINTEREXTPROC)&ProfilingTableDecorator::m_glVertexAttribIPointerEXT_profiling;
+if(this->m_ptr_glProgramBufferParametersfvNV)this->m_ptr_glProgramBufferParametersfvNV = (FunctionTable::MEMBERPFNGLPROGRAMBUFFERPARAMETERSFVNVPROC)&ProfilingTableDecorator::m_glProgramBufferParametersfvNV_profiling;
+if(this->m_ptr_glAlphaFuncxOES)this->m_ptr_glAlphaFuncxOES = (FunctionTable::MEMBERPFNGLALPHAFUNCXOESPROC)&ProfilingTableDecorator::m_glAlphaFuncxOES_profiling;
+if(this->m_ptr_glMultiDrawArraysIndirectAMD)this->m_ptr_glMultiDrawArraysIndirectAMD = (FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSINDIRECTAMDPROC)&ProfilingTableDecorator::m_glMultiDrawArraysIndirectAMD_profiling;
+if(this->m_ptr_glNormalStream3ivATI)this->m_ptr_glNormalStream3ivATI = (FunctionTable::MEMBERPFNGLNORMALSTREAM3IVATIPROC)&ProfilingTableDecorator::m_glNormalStream3ivATI_profiling;
+if(this->m_ptr_glTextureImage3DMultisampleNV)this->m_ptr_glTextureImage3DMultisampleNV = (FunctionTable::MEMBERPFNGLTEXTUREIMAGE3DMULTISAMPLENVPROC)&ProfilingTableDecorator::m_glTextureImage3DMultisampleNV_profiling;
+if(this->m_ptr_glProgramUniform4uivEXT)this->m_ptr_glProgramUniform4uivEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UIVEXTPROC)&ProfilingTableDecorator::m_glProgramUniform4uivEXT_profiling;
+if(this->m_ptr_glReplacementCodeusvSUN)this->m_ptr_glReplacementCodeusvSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUSVSUNPROC)&ProfilingTableDecorator::m_glReplacementCodeusvSUN_profiling;
+if(this->m_ptr_glPollInstrumentsSGIX)this->m_ptr_glPollInstrumentsSGIX = (FunctionTable::MEMBERPFNGLPOLLINSTRUMENTSSGIXPROC)&ProfilingTableDecorator::m_glPollInstrumentsSGIX_profiling;
+if(this->m_ptr_glGetTextureLevelParameteriv)this->m_ptr_glGetTextureLevelParameteriv = (FunctionTable::MEMBERPFNGLGETTEXTURELEVELPARAMETERIVPROC)&ProfilingTableDecorator::m_glGetTextureLevelParameteriv_profiling;
+if(this->m_ptr_glVertexAttribI2uiv)this->m_ptr_glVertexAttribI2uiv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI2UIVPROC)&ProfilingTableDecorator::m_glVertexAttribI2uiv_profiling;
+if(this->m_ptr_glMapControlPointsNV)this->m_ptr_glMapControlPointsNV = (FunctionTable::MEMBERPFNGLMAPCONTROLPOINTSNVPROC)&ProfilingTableDecorator::m_glMapControlPointsNV_profiling;
+if(this->m_ptr_glColor4dv)this->m_ptr_glColor4dv = (FunctionTable::MEMBERPFNGLCOLOR4DVPROC)&ProfilingTableDecorator::m_glColor4dv_profiling;
+if(this->m_ptr_glInvalidateBufferSubData)this->m_ptr_glInvalidateBufferSubData = (FunctionTable::MEMBERPFNGLINVALIDATEBUFFERSUBDATAPROC)&ProfilingTableDecorator::m_glInvalidateBufferSubData_profiling;
+if(this->m_ptr_glMultiTexCoord1hNV)this->m_ptr_glMultiTexCoord1hNV = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1HNVPROC)&ProfilingTableDecorator::m_glMultiTexCoord1hNV_profiling;
+if(this->m_ptr_glPointParameterfv)this->m_ptr_glPointParameterfv = (FunctionTable::MEMBERPFNGLPOINTPARAMETERFVPROC)&ProfilingTableDecorator::m_glPointParameterfv_profiling;
+if(this->m_ptr_glUniformMatrix2fvARB)this->m_ptr_glUniformMatrix2fvARB = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX2FVARBPROC)&ProfilingTableDecorator::m_glUniformMatrix2fvARB_profiling;
+if(this->m_ptr_glUniform2fv)this->m_ptr_glUniform2fv = (FunctionTable::MEMBERPFNGLUNIFORM2FVPROC)&ProfilingTableDecorator::m_glUniform2fv_profiling;
+if(this->m_ptr_glVertexPointerListIBM)this->m_ptr_glVertexPointerListIBM = (FunctionTable::MEMBERPFNGLVERTEXPOINTERLISTIBMPROC)&ProfilingTableDecorator::m_glVertexPointerListIBM_profiling;
+if(this->m_ptr_glGetMultiTexGenfvEXT)this->m_ptr_glGetMultiTexGenfvEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXGENFVEXTPROC)&ProfilingTableDecorator::m_glGetMultiTexGenfvEXT_profiling;
+if(this->m_ptr_glGetMinmaxEXT)this->m_ptr_glGetMinmaxEXT = (FunctionTable::MEMBERPFNGLGETMINMAXEXTPROC)&ProfilingTableDecorator::m_glGetMinmaxEXT_profiling;
+if(this->m_ptr_glIsFenceNV)this->m_ptr_glIsFenceNV = (FunctionTable::MEMBERPFNGLISFENCENVPROC)&ProfilingTableDecorator::m_glIsFenceNV_profiling;
+if(this->m_ptr_glMatrixFrustumEXT)this->m_ptr_glMatrixFrustumEXT = (FunctionTable::MEMBERPFNGLMATRIXFRUSTUMEXTPROC)&ProfilingTableDecorator::m_glMatrixFrustumEXT_profiling;
+if(this->m_ptr_glDispatchComputeIndirect)this->m_ptr_glDispatchComputeIndirect = (FunctionTable::MEMBERPFNGLDISPATCHCOMPUTEINDIRECTPROC)&ProfilingTableDecorator::m_glDispatchComputeIndirect_profiling;
+if(this->m_ptr_glMultiTexCoord4bOES)this->m_ptr_glMultiTexCoord4bOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4BOESPROC)&ProfilingTableDecorator::m_glMultiTexCoord4bOES_profiling;
+if(this->m_ptr_glProgramEnvParameter4dARB)this->m_ptr_glProgramEnvParameter4dARB = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETER4DARBPROC)&ProfilingTableDecorator::m_glProgramEnvParameter4dARB_profiling;
+if(this->m_ptr_glProgramUniform1uiEXT)this->m_ptr_glProgramUniform1uiEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UIEXTPROC)&ProfilingTableDecorator::m_glProgramUniform1uiEXT_profiling;
+if(this->m_ptr_glBindBufferRange)this->m_ptr_glBindBufferRange = (FunctionTable::MEMBERPFNGLBINDBUFFERRANGEPROC)&ProfilingTableDecorator::m_glBindBufferRange_profiling;
+if(this->m_ptr_glNormal3iv)this->m_ptr_glNormal3iv = (FunctionTable::MEMBERPFNGLNORMAL3IVPROC)&ProfilingTableDecorator::m_glNormal3iv_profiling;
+if(this->m_ptr_glVertexAttribL3dv)this->m_ptr_glVertexAttribL3dv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL3DVPROC)&ProfilingTableDecorator::m_glVertexAttribL3dv_profiling;
+if(this->m_ptr_glGetUniformdv)this->m_ptr_glGetUniformdv = (FunctionTable::MEMBERPFNGLGETUNIFORMDVPROC)&ProfilingTableDecorator::m_glGetUniformdv_profiling;
+if(this->m_ptr_glGetMultiTexLevelParameterfvEXT)this->m_ptr_glGetMultiTexLevelParameterfvEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXLEVELPARAMETERFVEXTPROC)&ProfilingTableDecorator::m_glGetMultiTexLevelParameterfvEXT_profiling;
+if(this->m_ptr_glFinalCombinerInputNV)this->m_ptr_glFinalCombinerInputNV = (FunctionTable::MEMBERPFNGLFINALCOMBINERINPUTNVPROC)&ProfilingTableDecorator::m_glFinalCombinerInputNV_profiling;
+if(this->m_ptr_glCullParameterdvEXT)this->m_ptr_glCullParameterdvEXT = (FunctionTable::MEMBERPFNGLCULLPARAMETERDVEXTPROC)&ProfilingTableDecorator::m_glCullParameterdvEXT_profiling;
+if(this->m_ptr_glMultiTexCoord4s)this->m_ptr_glMultiTexCoord4s = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4SPROC)&ProfilingTableDecorator::m_glMultiTexCoord4s_profiling;
+if(this->m_ptr_glMapVertexAttrib1fAPPLE)this->m_ptr_glMapVertexAttrib1fAPPLE = (FunctionTable::MEMBERPFNGLMAPVERTEXATTRIB1FAPPLEPROC)&ProfilingTableDecorator::m_glMapVertexAttrib1fAPPLE_profiling;
+if(this->m_ptr_glConvolutionParameterfEXT)this->m_ptr_glConvolutionParameterfEXT = (FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERFEXTPROC)&ProfilingTableDecorator::m_glConvolutionParameterfEXT_profiling;
+if(this->m_ptr_glTexCoord1iv)this->m_ptr_glTexCoord1iv = (FunctionTable::MEMBERPFNGLTEXCOORD1IVPROC)&ProfilingTableDecorator::m_glTexCoord1iv_profiling;
+if(this->m_ptr_glProgramUniform3fvEXT)this->m_ptr_glProgramUniform3fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3FVEXTPROC)&ProfilingTableDecorator::m_glProgramUniform3fvEXT_profiling;
+if(this->m_ptr_glColor3uiv)this->m_ptr_glColor3uiv = (FunctionTable::MEMBERPFNGLCOLOR3UIVPROC)&ProfilingTableDecorator::m_glColor3uiv_profiling;
+if(this->m_ptr_glListBase)this->m_ptr_glListBase = (FunctionTable::MEMBERPFNGLLISTBASEPROC)&ProfilingTableDecorator::m_glListBase_profiling;
+if(this->m_ptr_glTexCoord2bOES)this->m_ptr_glTexCoord2bOES = (FunctionTable::MEMBERPFNGLTEXCOORD2BOESPROC)&ProfilingTableDecorator::m_glTexCoord2bOES_profiling;
+if(this->m_ptr_glBindMaterialParameterEXT)this->m_ptr_glBindMaterialParameterEXT = (FunctionTable::MEMBERPFNGLBINDMATERIALPARAMETEREXTPROC)&ProfilingTableDecorator::m_glBindMaterialParameterEXT_profiling;
+if(this->m_ptr_glGlobalAlphaFactorubSUN)this->m_ptr_glGlobalAlphaFactorubSUN = (FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORUBSUNPROC)&ProfilingTableDecorator::m_glGlobalAlphaFactorubSUN_profiling;
+if(this->m_ptr_glVertexAttribL1ui64NV)this->m_ptr_glVertexAttribL1ui64NV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL1UI64NVPROC)&ProfilingTableDecorator::m_glVertexAttribL1ui64NV_profiling;
+if(this->m_ptr_glPointParameterfSGIS)this->m_ptr_glPointParameterfSGIS = (FunctionTable::MEMBERPFNGLPOINTPARAMETERFSGISPROC)&ProfilingTableDecorator::m_glPointParameterfSGIS_profiling;
+if(this->m_ptr_glGetImageTransformParameterivHP)this->m_ptr_glGetImageTransformParameterivHP = (FunctionTable::MEMBERPFNGLGETIMAGETRANSFORMPARAMETERIVHPPROC)&ProfilingTableDecorator::m_glGetImageTransformParameterivHP_profiling;
+if(this->m_ptr_glColorSubTableEXT)this->m_ptr_glColorSubTableEXT = (FunctionTable::MEMBERPFNGLCOLORSUBTABLEEXTPROC)&ProfilingTableDecorator::m_glColorSubTableEXT_profiling;
+if(this->m_ptr_glPixelTexGenParameterfvSGIS)this->m_ptr_glPixelTexGenParameterfvSGIS = (FunctionTable::MEMBERPFNGLPIXELTEXGENPARAMETERFVSGISPROC)&ProfilingTableDecorator::m_glPixelTexGenParameterfvSGIS_profiling;
+if(this->m_ptr_glClientWaitSync)this->m_ptr_glClientWaitSync = (FunctionTable::MEMBERPFNGLCLIENTWAITSYNCPROC)&ProfilingTableDecorator::m_glClientWaitSync_profiling;
+if(this->m_ptr_glQueryObjectParameteruiAMD)this->m_ptr_glQueryObjectParameteruiAMD = (FunctionTable::MEMBERPFNGLQUERYOBJECTPARAMETERUIAMDPROC)&ProfilingTableDecorator::m_glQueryObjectParameteruiAMD_profiling;
+if(this->m_ptr_glVertexAttribs1fvNV)this->m_ptr_glVertexAttribs1fvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS1FVNVPROC)&ProfilingTableDecorator::m_glVertexAttribs1fvNV_profiling;
+if(this->m_ptr_glVertexAttrib4NusvARB)this->m_ptr_glVertexAttrib4NusvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUSVARBPROC)&ProfilingTableDecorator::m_glVertexAttrib4NusvARB_profiling;
+if(this->m_ptr_glVariantPointerEXT)this->m_ptr_glVariantPointerEXT = (FunctionTable::MEMBERPFNGLVARIANTPOINTEREXTPROC)&ProfilingTableDecorator::m_glVariantPointerEXT_profiling;
+if(this->m_ptr_glTextureBuffer)this->m_ptr_glTextureBuffer = (FunctionTable::MEMBERPFNGLTEXTUREBUFFERPROC)&ProfilingTableDecorator::m_glTextureBuffer_profiling;
+if(this->m_ptr_glVertexAttribI1uiEXT)this->m_ptr_glVertexAttribI1uiEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI1UIEXTPROC)&ProfilingTableDecorator::m_glVertexAttribI1uiEXT_profiling;
+if(this->m_ptr_glInvalidateTexImage)this->m_ptr_glInvalidateTexImage = (FunctionTable::MEMBERPFNGLINVALIDATETEXIMAGEPROC)&ProfilingTableDecorator::m_glInvalidateTexImage_profiling;
+if(this->m_ptr_glProgramEnvParametersI4ivNV)this->m_ptr_glProgramEnvParametersI4ivNV = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERSI4IVNVPROC)&ProfilingTableDecorator::m_glProgramEnvParametersI4ivNV_profiling;
+if(this->m_ptr_glPathGlyphIndexArrayNV)this->m_ptr_glPathGlyphIndexArrayNV = (FunctionTable::MEMBERPFNGLPATHGLYPHINDEXARRAYNVPROC)&ProfilingTableDecorator::m_glPathGlyphIndexArrayNV_profiling;
+if(this->m_ptr_glCopyImageSubData)this->m_ptr_glCopyImageSubData = (FunctionTable::MEMBERPFNGLCOPYIMAGESUBDATAPROC)&ProfilingTableDecorator::m_glCopyImageSubData_profiling;
+if(this->m_ptr_glGetUniformSubroutineuiv)this->m_ptr_glGetUniformSubroutineuiv = (FunctionTable::MEMBERPFNGLGETUNIFORMSUBROUTINEUIVPROC)&ProfilingTableDecorator::m_glGetUniformSubroutineuiv_profiling;
+if(this->m_ptr_glBindVertexBuffer)this->m_ptr_glBindVertexBuffer = (FunctionTable::MEMBERPFNGLBINDVERTEXBUFFERPROC)&ProfilingTableDecorator::m_glBindVertexBuffer_profiling;
+if(this->m_ptr_glMultiTexCoord1iARB)this->m_ptr_glMultiTexCoord1iARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1IARBPROC)&ProfilingTableDecorator::m_glMultiTexCoord1iARB_profiling;
+if(this->m_ptr_glDebugMessageInsert)this->m_ptr_glDebugMessageInsert = (FunctionTable::MEMBERPFNGLDEBUGMESSAGEINSERTPROC)&ProfilingTableDecorator::m_glDebugMessageInsert_profiling;
+if(this->m_ptr_glBeginVertexShaderEXT)this->m_ptr_glBeginVertexShaderEXT = (FunctionTable::MEMBERPFNGLBEGINVERTEXSHADEREXTPROC)&ProfilingTableDecorator::m_glBeginVertexShaderEXT_profiling;
+if(this->m_ptr_glIsVariantEnabledEXT)this->m_ptr_glIsVariantEnabledEXT = (FunctionTable::MEMBERPFNGLISVARIANTENABLEDEXTPROC)&ProfilingTableDecorator::m_glIsVariantEnabledEXT_profiling;
+if(this->m_ptr_glPassThroughxOES)this->m_ptr_glPassThroughxOES = (FunctionTable::MEMBERPFNGLPASSTHROUGHXOESPROC)&ProfilingTableDecorator::m_glPassThroughxOES_profiling;
+if(this->m_ptr_glIsSampler)this->m_ptr_glIsSampler = (FunctionTable::MEMBERPFNGLISSAMPLERPROC)&ProfilingTableDecorator::m_glIsSampler_profiling;
+if(this->m_ptr_glConservativeRasterParameterfNV)this->m_ptr_glConservativeRasterParameterfNV = (FunctionTable::MEMBERPFNGLCONSERVATIVERASTERPARAMETERFNVPROC)&ProfilingTableDecorator::m_glConservativeRasterParameterfNV_profiling;
+if(this->m_ptr_glMultiTexGenivEXT)this->m_ptr_glMultiTexGenivEXT = (FunctionTable::MEMBERPFNGLMULTITEXGENIVEXTPROC)&ProfilingTableDecorator::m_glMultiTexGenivEXT_profiling;
+if(this->m_ptr_glNamedFramebufferTexture2DEXT)this->m_ptr_glNamedFramebufferTexture2DEXT = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTURE2DEXTPROC)&ProfilingTableDecorator::m_glNamedFramebufferTexture2DEXT_profiling;
+if(this->m_ptr_glCopyTexSubImage1D)this->m_ptr_glCopyTexSubImage1D = (FunctionTable::MEMBERPFNGLCOPYTEXSUBIMAGE1DPROC)&ProfilingTableDecorator::m_glCopyTexSubImage1D_profiling;
+if(this->m_ptr_glTexCoord1i)this->m_ptr_glTexCoord1i = (FunctionTable::MEMBERPFNGLTEXCOORD1IPROC)&ProfilingTableDecorator::m_glTexCoord1i_profiling;
+if(this->m_ptr_glCheckFramebufferStatus)this->m_ptr_glCheckFramebufferStatus = (FunctionTable::MEMBERPFNGLCHECKFRAMEBUFFERSTATUSPROC)&ProfilingTableDecorator::m_glCheckFramebufferStatus_profiling;
+if(this->m_ptr_glDrawElementArrayAPPLE)this->m_ptr_glDrawElementArrayAPPLE = (FunctionTable::MEMBERPFNGLDRAWELEMENTARRAYAPPLEPROC)&ProfilingTableDecorator::m_glDrawElementArrayAPPLE_profiling;
+if(this->m_ptr_glTexCoord1d)this->m_ptr_glTexCoord1d = (FunctionTable::MEMBERPFNGLTEXCOORD1DPROC)&ProfilingTableDecorator::m_glTexCoord1d_profiling;
+if(this->m_ptr_glTexCoord1f)this->m_ptr_glTexCoord1f = (FunctionTable::MEMBERPFNGLTEXCOORD1FPROC)&ProfilingTableDecorator::m_glTexCoord1f_profiling;
+if(this->m_ptr_glFragmentLightivSGIX)this->m_ptr_glFragmentLightivSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTLIGHTIVSGIXPROC)&ProfilingTableDecorator::m_glFragmentLightivSGIX_profiling;
+if(this->m_ptr_glBindImageTexture)this->m_ptr_glBindImageTexture = (FunctionTable::MEMBERPFNGLBINDIMAGETEXTUREPROC)&ProfilingTableDecorator::m_glBindImageTexture_profiling;
+if(this->m_ptr_glTransformFeedbackVaryings)this->m_ptr_glTransformFeedbackVaryings = (FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKVARYINGSPROC)&ProfilingTableDecorator::m_glTransformFeedbackVaryings_profiling;
+if(this->m_ptr_glDrawRangeElements)this->m_ptr_glDrawRangeElements = (FunctionTable::MEMBERPFNGLDRAWRANGEELEMENTSPROC)&ProfilingTableDecorator::m_glDrawRangeElements_profiling;
+if(this->m_ptr_glTexCoord1s)this->m_ptr_glTexCoord1s = (FunctionTable::MEMBERPFNGLTEXCOORD1SPROC)&ProfilingTableDecorator::m_glTexCoord1s_profiling;
+if(this->m_ptr_glBindBufferBase)this->m_ptr_glBindBufferBase = (FunctionTable::MEMBERPFNGLBINDBUFFERBASEPROC)&ProfilingTableDecorator::m_glBindBufferBase_profiling;
+if(this->m_ptr_glColor3bv)this->m_ptr_glColor3bv = (FunctionTable::MEMBERPFNGLCOLOR3BVPROC)&ProfilingTableDecorator::m_glColor3bv_profiling;
+if(this->m_ptr_glSyncTextureINTEL)this->m_ptr_glSyncTextureINTEL = (FunctionTable::MEMBERPFNGLSYNCTEXTUREINTELPROC)&ProfilingTableDecorator::m_glSyncTextureINTEL_profiling;
+if(this->m_ptr_glCreateSamplers)this->m_ptr_glCreateSamplers = (FunctionTable::MEMBERPFNGLCREATESAMPLERSPROC)&ProfilingTableDecorator::m_glCreateSamplers_profiling;
+if(this->m_ptr_glCombinerParameterfNV)this->m_ptr_glCombinerParameterfNV = (FunctionTable::MEMBERPFNGLCOMBINERPARAMETERFNVPROC)&ProfilingTableDecorator::m_glCombinerParameterfNV_profiling;
+if(this->m_ptr_glGetArrayObjectivATI)this->m_ptr_glGetArrayObjectivATI = (FunctionTable::MEMBERPFNGLGETARRAYOBJECTIVATIPROC)&ProfilingTableDecorator::m_glGetArrayObjectivATI_profiling;
+if(this->m_ptr_glMultiDrawArrays)this->m_ptr_glMultiDrawArrays = (FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSPROC)&ProfilingTableDecorator::m_glMultiDrawArrays_profiling;
+if(this->m_ptr_glSampleMapATI)this->m_ptr_glSampleMapATI = (FunctionTable::MEMBERPFNGLSAMPLEMAPATIPROC)&ProfilingTableDecorator::m_glSampleMapATI_profiling;
+if(this->m_ptr_glProgramUniform2i64ARB)this->m_ptr_glProgramUniform2i64ARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2I64ARBPROC)&ProfilingTableDecorator::m_glProgramUniform2i64ARB_profiling;
+if(this->m_ptr_glBinormal3ivEXT)this->m_ptr_glBinormal3ivEXT = (FunctionTable::MEMBERPFNGLBINORMAL3IVEXTPROC)&ProfilingTableDecorator::m_glBinormal3ivEXT_profiling;
+if(this->m_ptr_glMultiDrawArraysIndirectCountARB)this->m_ptr_glMultiDrawArraysIndirectCountARB = (FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSINDIRECTCOUNTARBPROC)&ProfilingTableDecorator::m_glMultiDrawArraysIndirectCountARB_profiling;
+if(this->m_ptr_glUniformBufferEXT)this->m_ptr_glUniformBufferEXT = (FunctionTable::MEMBERPFNGLUNIFORMBUFFEREXTPROC)&ProfilingTableDecorator::m_glUniformBufferEXT_profiling;
+if(this->m_ptr_glWindowPos2ivMESA)this->m_ptr_glWindowPos2ivMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS2IVMESAPROC)&ProfilingTableDecorator::m_glWindowPos2ivMESA_profiling;
+if(this->m_ptr_glTexCoordP4ui)this->m_ptr_glTexCoordP4ui = (FunctionTable::MEMBERPFNGLTEXCOORDP4UIPROC)&ProfilingTableDecorator::m_glTexCoordP4ui_profiling;
+if(this->m_ptr_glMultiTexSubImage1DEXT)this->m_ptr_glMultiTexSubImage1DEXT = (FunctionTable::MEMBERPFNGLMULTITEXSUBIMAGE1DEXTPROC)&ProfilingTableDecorator::m_glMultiTexSubImage1DEXT_profiling;
+if(this->m_ptr_glProgramUniformMatrix2x3fvEXT)this->m_ptr_glProgramUniformMatrix2x3fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X3FVEXTPROC)&ProfilingTableDecorator::m_glProgramUniformMatrix2x3fvEXT_profiling;
+if(this->m_ptr_glBufferDataARB)this->m_ptr_glBufferDataARB = (FunctionTable::MEMBERPFNGLBUFFERDATAARBPROC)&ProfilingTableDecorator::m_glBufferDataARB_profiling;
+if(this->m_ptr_glVertexAttribIFormat)this->m_ptr_glVertexAttribIFormat = (FunctionTable::MEMBERPFNGLVERTEXATTRIBIFORMATPROC)&ProfilingTableDecorator::m_glVertexAttribIFormat_profiling;
+if(this->m_ptr_glCreateFramebuffers)this->m_ptr_glCreateFramebuffers = (FunctionTable::MEMBERPFNGLCREATEFRAMEBUFFERSPROC)&ProfilingTableDecorator::m_glCreateFramebuffers_profiling;
+if(this->m_ptr_glNormalStream3dvATI)this->m_ptr_glNormalStream3dvATI = (FunctionTable::MEMBERPFNGLNORMALSTREAM3DVATIPROC)&ProfilingTableDecorator::m_glNormalStream3dvATI_profiling;
+if(this->m_ptr_glClearAccum)this->m_ptr_glClearAccum = (FunctionTable::MEMBERPFNGLCLEARACCUMPROC)&ProfilingTableDecorator::m_glClearAccum_profiling;
+if(this->m_ptr_glUniform3i64vNV)this->m_ptr_glUniform3i64vNV = (FunctionTable::MEMBERPFNGLUNIFORM3I64VNVPROC)&ProfilingTableDecorator::m_glUniform3i64vNV_profiling;
+if(this->m_ptr_glNormal3fVertex3fSUN)this->m_ptr_glNormal3fVertex3fSUN = (FunctionTable::MEMBERPFNGLNORMAL3FVERTEX3FSUNPROC)&ProfilingTableDecorator::m_glNormal3fVertex3fSUN_profiling;
+if(this->m_ptr_glUniform2uivEXT)this->m_ptr_glUniform2uivEXT = (FunctionTable::MEMBERPFNGLUNIFORM2UIVEXTPROC)&ProfilingTableDecorator::m_glUniform2uivEXT_profiling;
+if(this->m_ptr_glBeginQuery)this->m_ptr_glBeginQuery = (FunctionTable::MEMBERPFNGLBEGINQUERYPROC)&ProfilingTableDecorator::m_glBeginQuery_profiling;
+if(this->m_ptr_glStencilThenCoverStrokePathInstancedNV)this->m_ptr_glStencilThenCoverStrokePathInstancedNV = (FunctionTable::MEMBERPFNGLSTENCILTHENCOVERSTROKEPATHINSTANCEDNVPROC)&ProfilingTableDecorator::m_glStencilThenCoverStrokePathInstancedNV_profiling;
+if(this->m_ptr_glBindBuffer)this->m_ptr_glBindBuffer = (FunctionTable::MEMBERPFNGLBINDBUFFERPROC)&ProfilingTableDecorator::m_glBindBuffer_profiling;
+if(this->m_ptr_glMap2d)this->m_ptr_glMap2d = (FunctionTable::MEMBERPFNGLMAP2DPROC)&ProfilingTableDecorator::m_glMap2d_profiling;
+if(this->m_ptr_glMap2f)this->m_ptr_glMap2f = (FunctionTable::MEMBERPFNGLMAP2FPROC)&ProfilingTableDecorator::m_glMap2f_profiling;
+if(this->m_ptr_glMakeImageHandleResidentNV)this->m_ptr_glMakeImageHandleResidentNV = (FunctionTable::MEMBERPFNGLMAKEIMAGEHANDLERESIDENTNVPROC)&ProfilingTableDecorator::m_glMakeImageHandleResidentNV_profiling;
+if(this->m_ptr_glUniformMatrix2x4fv)this->m_ptr_glUniformMatrix2x4fv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX2X4FVPROC)&ProfilingTableDecorator::m_glUniformMatrix2x4fv_profiling;
+if(this->m_ptr_glGetMultiTexParameterfvEXT)this->m_ptr_glGetMultiTexParameterfvEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXPARAMETERFVEXTPROC)&ProfilingTableDecorator::m_glGetMultiTexParameterfvEXT_profiling;
+if(this->m_ptr_glDepthRangeIndexed)this->m_ptr_glDepthRangeIndexed = (FunctionTable::MEMBERPFNGLDEPTHRANGEINDEXEDPROC)&ProfilingTableDecorator::m_glDepthRangeIndexed_profiling;
+if(this->m_ptr_glMultiTexCoord1s)this->m_ptr_glMultiTexCoord1s = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1SPROC)&ProfilingTableDecorator::m_glMultiTexCoord1s_profiling;
+if(this->m_ptr_glMatrixScalefEXT)this->m_ptr_glMatrixScalefEXT = (FunctionTable::MEMBERPFNGLMATRIXSCALEFEXTPROC)&ProfilingTableDecorator::m_glMatrixScalefEXT_profiling;
+if(this->m_ptr_glGetError)this->m_ptr_glGetError = (FunctionTable::MEMBERPFNGLGETERRORPROC)&ProfilingTableDecorator::m_glGetError_profiling;
+if(this->m_ptr_glGetTexEnviv)this->m_ptr_glGetTexEnviv = (FunctionTable::MEMBERPFNGLGETTEXENVIVPROC)&ProfilingTableDecorator::m_glGetTexEnviv_profiling;
+if(this->m_ptr_glBindTextureUnitParameterEXT)this->m_ptr_glBindTextureUnitParameterEXT = (FunctionTable::MEMBERPFNGLBINDTEXTUREUNITPARAMETEREXTPROC)&ProfilingTableDecorator::m_glBindTextureUnitParameterEXT_profiling;
+if(this->m_ptr_glGetnUniformfvARB)this->m_ptr_glGetnUniformfvARB = (FunctionTable::MEMBERPFNGLGETNUNIFORMFVARBPROC)&ProfilingTableDecorator::m_glGetnUniformfvARB_profiling;
+if(this->m_ptr_glReplacementCodeuiNormal3fVertex3fvSUN)this->m_ptr_glReplacementCodeuiNormal3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUINORMAL3FVERTEX3FVSUNPROC)&ProfilingTableDecorator::m_glReplacementCodeuiNormal3fVertex3fvSUN_profiling;
+if(this->m_ptr_glDeletePerfQueryINTEL)this->m_ptr_glDeletePerfQueryINTEL = (FunctionTable::MEMBERPFNGLDELETEPERFQUERYINTELPROC)&ProfilingTableDecorator::m_glDeletePerfQueryINTEL_profiling;
+if(this->m_ptr_glActiveVaryingNV)this->m_ptr_glActiveVaryingNV = (FunctionTable::MEMBERPFNGLACTIVEVARYINGNVPROC)&ProfilingTableDecorator::m_glActiveVaryingNV_profiling;
+if(this->m_ptr_glGetActiveUniformARB)this->m_ptr_glGetActiveUniformARB = (FunctionTable::MEMBERPFNGLGETACTIVEUNIFORMARBPROC)&ProfilingTableDecorator::m_glGetActiveUniformARB_profiling;
+if(this->m_ptr_glVertexAttribI3ivEXT)this->m_ptr_glVertexAttribI3ivEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI3IVEXTPROC)&ProfilingTableDecorator::m_glVertexAttribI3ivEXT_profiling;
+if(this->m_ptr_glEvalCoord1d)this->m_ptr_glEvalCoord1d = (FunctionTable::MEMBERPFNGLEVALCOORD1DPROC)&ProfilingTableDecorator::m_glEvalCoord1d_profiling;
+if(this->m_ptr_glNamedCopyBufferSubDataEXT)this->m_ptr_glNamedCopyBufferSubDataEXT = (FunctionTable::MEMBERPFNGLNAMEDCOPYBUFFERSUBDATAEXTPROC)&ProfilingTableDecorator::m_glNamedCopyBufferSubDataEXT_profiling;
+if(this->m_ptr_glEvalCoord1f)this->m_ptr_glEvalCoord1f = (FunctionTable::MEMBERPFNGLEVALCOORD1FPROC)&ProfilingTableDecorator::m_glEvalCoord1f_profiling;
+if(this->m_ptr_glPixelMapfv)this->m_ptr_glPixelMapfv = (FunctionTable::MEMBERPFNGLPIXELMAPFVPROC)&ProfilingTableDecorator::m_glPixelMapfv_profiling;
+if(this->m_ptr_glVertexAttribI1ivEXT)this->m_ptr_glVertexAttribI1ivEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI1IVEXTPROC)&ProfilingTableDecorator::m_glVertexAttribI1ivEXT_profiling;
+if(this->m_ptr_glCreateSyncFromCLeventARB)this->m_ptr_glCreateSyncFromCLeventARB = (FunctionTable::MEMBERPFNGLCREATESYNCFROMCLEVENTARBPROC)&ProfilingTableDecorator::m_glCreateSyncFromCLeventARB_profiling;
+if(this->m_ptr_glGetPixelMapusv)this->m_ptr_glGetPixelMapusv = (FunctionTable::MEMBERPFNGLGETPIXELMAPUSVPROC)&ProfilingTableDecorator::m_glGetPixelMapusv_profiling;
+if(this->m_ptr_glGetnColorTableARB)this->m_ptr_glGetnColorTableARB = (FunctionTable::MEMBERPFNGLGETNCOLORTABLEARBPROC)&ProfilingTableDecorator::m_glGetnColorTableARB_profiling;
+if(this->m_ptr_glAccum)this->m_ptr_glAccum = (FunctionTable::MEMBERPFNGLACCUMPROC)&ProfilingTableDecorator::m_glAccum_profiling;
+if(this->m_ptr_glRasterPos3sv)this->m_ptr_glRasterPos3sv = (FunctionTable::MEMBERPFNGLRASTERPOS3SVPROC)&ProfilingTableDecorator::m_glRasterPos3sv_profiling;
+if(this->m_ptr_glTexCoord2iv)this->m_ptr_glTexCoord2iv = (FunctionTable::MEMBERPFNGLTEXCOORD2IVPROC)&ProfilingTableDecorator::m_glTexCoord2iv_profiling;
+if(this->m_ptr_glBlendFunciARB)this->m_ptr_glBlendFunciARB = (FunctionTable::MEMBERPFNGLBLENDFUNCIARBPROC)&ProfilingTableDecorator::m_glBlendFunciARB_profiling;
+if(this->m_ptr_glProgramUniform3i64vARB)this->m_ptr_glProgramUniform3i64vARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3I64VARBPROC)&ProfilingTableDecorator::m_glProgramUniform3i64vARB_profiling;
+if(this->m_ptr_glGetFramebufferAttachmentParameteriv)this->m_ptr_glGetFramebufferAttachmentParameteriv = (FunctionTable::MEMBERPFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC)&ProfilingTableDecorator::m_glGetFramebufferAttachmentParameteriv_profiling;
+if(this->m_ptr_glProgramUniform4ui)this->m_ptr_glProgramUniform4ui = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UIPROC)&ProfilingTableDecorator::m_glProgramUniform4ui_profiling;
+if(this->m_ptr_glStencilMask)this->m_ptr_glStencilMask = (FunctionTable::MEMBERPFNGLSTENCILMASKPROC)&ProfilingTableDecorator::m_glStencilMask_profiling;
+if(this->m_ptr_glResetHistogramEXT)this->m_ptr_glResetHistogramEXT = (FunctionTable::MEMBERPFNGLRESETHISTOGRAMEXTPROC)&ProfilingTableDecorator::m_glResetHistogramEXT_profiling;
+if(this->m_ptr_glLightxOES)this->m_ptr_glLightxOES = (FunctionTable::MEMBERPFNGLLIGHTXOESPROC)&ProfilingTableDecorator::m_glLightxOES_profiling;
+if(this->m_ptr_glNamedBufferData)this->m_ptr_glNamedBufferData = (FunctionTable::MEMBERPFNGLNAMEDBUFFERDATAPROC)&ProfilingTableDecorator::m_glNamedBufferData_profiling;
+if(this->m_ptr_glVertexStream3sATI)this->m_ptr_glVertexStream3sATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM3SATIPROC)&ProfilingTableDecorator::m_glVertexStream3sATI_profiling;
+if(this->m_ptr_glVertexAttrib3fvARB)this->m_ptr_glVertexAttrib3fvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3FVARBPROC)&ProfilingTableDecorator::m_glVertexAttrib3fvARB_profiling;
+if(this->m_ptr_glClearNamedBufferSubData)this->m_ptr_glClearNamedBufferSubData = (FunctionTable::MEMBERPFNGLCLEARNAMEDBUFFERSUBDATAPROC)&ProfilingTableDecorator::m_glClearNamedBufferSubData_profiling;
+if(this->m_ptr_glProgramUniformHandleui64ARB)this->m_ptr_glProgramUniformHandleui64ARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMHANDLEUI64ARBPROC)&ProfilingTableDecorator::m_glProgramUniformHandleui64ARB_profiling;
+if(this->m_ptr_glUniform3iARB)this->m_ptr_glUniform3iARB = (FunctionTable::MEMBERPFNGLUNIFORM3IARBPROC)&ProfilingTableDecorator::m_glUniform3iARB_profiling;
+if(this->m_ptr_glCreateProgramObjectARB)this->m_ptr_glCreateProgramObjectARB = (FunctionTable::MEMBERPFNGLCREATEPROGRAMOBJECTARBPROC)&ProfilingTableDecorator::m_glCreateProgramObjectARB_profiling;
+if(this->m_ptr_glMultiTexCoord1dvARB)this->m_ptr_glMultiTexCoord1dvARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1DVARBPROC)&ProfilingTableDecorator::m_glMultiTexCoord1dvARB_profiling;
+if(this->m_ptr_glGetObjectParameterfvARB)this->m_ptr_glGetObjectParameterfvARB = (FunctionTable::MEMBERPFNGLGETOBJECTPARAMETERFVARBPROC)&ProfilingTableDecorator::m_glGetObjectParameterfvARB_profiling;
+if(this->m_ptr_glRectsv)this->m_ptr_glRectsv = (FunctionTable::MEMBERPFNGLRECTSVPROC)&ProfilingTableDecorator::m_glRectsv_profiling;
+if(this->m_ptr_glMultiTexImage2DEXT)this->m_ptr_glMultiTexImage2DEXT = (FunctionTable::MEMBERPFNGLMULTITEXIMAGE2DEXTPROC)&ProfilingTableDecorator::m_glMultiTexImage2DEXT_profiling;
+if(this->m_ptr_glProgramUniform1i64NV)this->m_ptr_glProgramUniform1i64NV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1I64NVPROC)&ProfilingTableDecorator::m_glProgramUniform1i64NV_profiling;
+if(this->m_ptr_glGetObjectBufferivATI)this->m_ptr_glGetObjectBufferivATI = (FunctionTable::MEMBERPFNGLGETOBJECTBUFFERIVATIPROC)&ProfilingTableDecorator::m_glGetObjectBufferivATI_profiling;
+if(this->m_ptr_glUniform4i64ARB)this->m_ptr_glUniform4i64ARB = (FunctionTable::MEMBERPFNGLUNIFORM4I64ARBPROC)&ProfilingTableDecorator::m_glUniform4i64ARB_profiling;
+if(this->m_ptr_glReplacementCodeuiColor4ubVertex3fvSUN)this->m_ptr_glReplacementCodeuiColor4ubVertex3fvSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUICOLOR4UBVERTEX3FVSUNPROC)&ProfilingTableDecorator::m_glReplacementCodeuiColor4ubVertex3fvSUN_profiling;
+if(this->m_ptr_glBlendFuncSeparateINGR)this->m_ptr_glBlendFuncSeparateINGR = (FunctionTable::MEMBERPFNGLBLENDFUNCSEPARATEINGRPROC)&ProfilingTableDecorator::m_glBlendFuncSeparateINGR_profiling;
+if(this->m_ptr_glGetVideoCaptureStreamfvNV)this->m_ptr_glGetVideoCaptureStreamfvNV = (FunctionTable::MEMBERPFNGLGETVIDEOCAPTURESTREAMFVNVPROC)&ProfilingTableDecorator::m_glGetVideoCaptureStreamfvNV_profiling;
+if(this->m_ptr_glVertexAttrib2fARB)this->m_ptr_glVertexAttrib2fARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2FARBPROC)&ProfilingTableDecorator::m_glVertexAttrib2fARB_profiling;
+if(this->m_ptr_glGetTexGeniv)this->m_ptr_glGetTexGeniv = (FunctionTable::MEMBERPFNGLGETTEXGENIVPROC)&ProfilingTableDecorator::m_glGetTexGeniv_profiling;
+if(this->m_ptr_glPixelStorei)this->m_ptr_glPixelStorei = (FunctionTable::MEMBERPFNGLPIXELSTOREIPROC)&ProfilingTableDecorator::m_glPixelStorei_profiling;
+if(this->m_ptr_glGetCompressedTextureSubImage)this->m_ptr_glGetCompressedTextureSubImage = (FunctionTable::MEMBERPFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC)&ProfilingTableDecorator::m_glGetCompressedTextureSubImage_profiling;
+if(this->m_ptr_glCopyImageSubDataNV)this->m_ptr_glCopyImageSubDataNV = (FunctionTable::MEMBERPFNGLCOPYIMAGESUBDATANVPROC)&ProfilingTableDecorator::m_glCopyImageSubDataNV_profiling;
+if(this->m_ptr_glActiveShaderProgram)this->m_ptr_glActiveShaderProgram = (FunctionTable::MEMBERPFNGLACTIVESHADERPROGRAMPROC)&ProfilingTableDecorator::m_glActiveShaderProgram_profiling;
+if(this->m_ptr_glVertexStream1iATI)this->m_ptr_glVertexStream1iATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM1IATIPROC)&ProfilingTableDecorator::m_glVertexStream1iATI_profiling;
+if(this->m_ptr_glPatchParameterfv)this->m_ptr_glPatchParameterfv = (FunctionTable::MEMBERPFNGLPATCHPARAMETERFVPROC)&ProfilingTableDecorator::m_glPatchParameterfv_profiling;
+if(this->m_ptr_glIsFramebufferEXT)this->m_ptr_glIsFramebufferEXT = (FunctionTable::MEMBERPFNGLISFRAMEBUFFEREXTPROC)&ProfilingTableDecorator::m_glIsFramebufferEXT_profiling;
+if(this->m_ptr_glTextureStorage2D)this->m_ptr_glTextureStorage2D = (FunctionTable::MEMBERPFNGLTEXTURESTORAGE2DPROC)&ProfilingTableDecorator::m_glTextureStorage2D_profiling;
+if(this->m_ptr_glProgramUniform1ui64ARB)this->m_ptr_glProgramUniform1ui64ARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UI64ARBPROC)&ProfilingTableDecorator::m_glProgramUniform1ui64ARB_profiling;
+if(this->m_ptr_glTexBufferRange)this->m_ptr_glTexBufferRange = (FunctionTable::MEMBERPFNGLTEXBUFFERRANGEPROC)&ProfilingTableDecorator::m_glTexBufferRange_profiling;
+if(this->m_ptr_glGetPixelTexGenParameterivSGIS)this->m_ptr_glGetPixelTexGenParameterivSGIS = (FunctionTable::MEMBERPFNGLGETPIXELTEXGENPARAMETERIVSGISPROC)&ProfilingTableDecorator::m_glGetPixelTexGenParameterivSGIS_profiling;
+if(this->m_ptr_glTextureSubImage3DEXT)this->m_ptr_glTextureSubImage3DEXT = (FunctionTable::MEMBERPFNGLTEXTURESUBIMAGE3DEXTPROC)&ProfilingTableDecorator::m_glTextureSubImage3DEXT_profiling;
+if(this->m_ptr_glClipControl)this->m_ptr_glClipControl = (FunctionTable::MEMBERPFNGLCLIPCONTROLPROC)&ProfilingTableDecorator::m_glClipControl_profiling;
+if(this->m_ptr_glGetProgramResourceiv)this->m_ptr_glGetProgramResourceiv = (FunctionTable::MEMBERPFNGLGETPROGRAMRESOURCEIVPROC)&ProfilingTableDecorator::m_glGetProgramResourceiv_profiling;
+if(this->m_ptr_glMultiTexCoordP2uiv)this->m_ptr_glMultiTexCoordP2uiv = (FunctionTable::MEMBERPFNGLMULTITEXCOORDP2UIVPROC)&ProfilingTableDecorator::m_glMultiTexCoordP2uiv_profiling;
+if(this->m_ptr_glVertexAttribI3ui)this->m_ptr_glVertexAttribI3ui = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI3UIPROC)&ProfilingTableDecorator::m_glVertexAttribI3ui_profiling;
+if(this->m_ptr_glSampleMaskSGIS)this->m_ptr_glSampleMaskSGIS = (FunctionTable::MEMBERPFNGLSAMPLEMASKSGISPROC)&ProfilingTableDecorator::m_glSampleMaskSGIS_profiling;
+if(this->m_ptr_glVertexAttrib4NivARB)this->m_ptr_glVertexAttrib4NivARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NIVARBPROC)&ProfilingTableDecorator::m_glVertexAttrib4NivARB_profiling;
+if(this->m_ptr_glGlobalAlphaFactorfSUN)this->m_ptr_glGlobalAlphaFactorfSUN = (FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORFSUNPROC)&ProfilingTableDecorator::m_glGlobalAlphaFactorfSUN_profiling;
+if(this->m_ptr_glBlendEquationSeparateIndexedAMD)this->m_ptr_glBlendEquationSeparateIndexedAMD = (FunctionTable::MEMBERPFNGLBLENDEQUATIONSEPARATEINDEXEDAMDPROC)&ProfilingTableDecorator::m_glBlendEquationSeparateIndexedAMD_profiling;
+if(this->m_ptr_glGetPerfCounterInfoINTEL)this->m_ptr_glGetPerfCounterInfoINTEL = (FunctionTable::MEMBERPFNGLGETPERFCOUNTERINFOINTELPROC)&ProfilingTableDecorator::m_glGetPerfCounterInfoINTEL_profiling;
+if(this->m_ptr_glDeleteProgramsNV)this->m_ptr_glDeleteProgramsNV = (FunctionTable::MEMBERPFNGLDELETEPROGRAMSNVPROC)&ProfilingTableDecorator::m_glDeleteProgramsNV_profiling;
+if(this->m_ptr_glPixelZoomxOES)this->m_ptr_glPixelZoomxOES = (FunctionTable::MEMBERPFNGLPIXELZOOMXOESPROC)&ProfilingTableDecorator::m_glPixelZoomxOES_profiling;
+if(this->m_ptr_glGetCombinerOutputParameterivNV)this->m_ptr_glGetCombinerOutputParameterivNV = (FunctionTable::MEMBERPFNGLGETCOMBINEROUTPUTPARAMETERIVNVPROC)&ProfilingTableDecorator::m_glGetCombinerOutputParameterivNV_profiling;
+if(this->m_ptr_glRasterPos2xvOES)this->m_ptr_glRasterPos2xvOES = (FunctionTable::MEMBERPFNGLRASTERPOS2XVOESPROC)&ProfilingTableDecorator::m_glRasterPos2xvOES_profiling;
+if(this->m_ptr_glGetTexImage)this->m_ptr_glGetTexImage = (FunctionTable::MEMBERPFNGLGETTEXIMAGEPROC)&ProfilingTableDecorator::m_glGetTexImage_profiling;
+if(this->m_ptr_glVertexArrayVertexBuffers)this->m_ptr_glVertexArrayVertexBuffers = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXBUFFERSPROC)&ProfilingTableDecorator::m_glVertexArrayVertexBuffers_profiling;
+if(this->m_ptr_glUniform1ui64NV)this->m_ptr_glUniform1ui64NV = (FunctionTable::MEMBERPFNGLUNIFORM1UI64NVPROC)&ProfilingTableDecorator::m_glUniform1ui64NV_profiling;
+if(this->m_ptr_glProgramParameteri)this->m_ptr_glProgramParameteri = (FunctionTable::MEMBERPFNGLPROGRAMPARAMETERIPROC)&ProfilingTableDecorator::m_glProgramParameteri_profiling;
+if(this->m_ptr_glNormal3xOES)this->m_ptr_glNormal3xOES = (FunctionTable::MEMBERPFNGLNORMAL3XOESPROC)&ProfilingTableDecorator::m_glNormal3xOES_profiling;
+if(this->m_ptr_glGetMapfv)this->m_ptr_glGetMapfv = (FunctionTable::MEMBERPFNGLGETMAPFVPROC)&ProfilingTableDecorator::m_glGetMapfv_profiling;
+if(this->m_ptr_glVertexStream2dvATI)this->m_ptr_glVertexStream2dvATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM2DVATIPROC)&ProfilingTableDecorator::m_glVertexStream2dvATI_profiling;
+if(this->m_ptr_glPathStencilDepthOffsetNV)this->m_ptr_glPathStencilDepthOffsetNV = (FunctionTable::MEMBERPFNGLPATHSTENCILDEPTHOFFSETNVPROC)&ProfilingTableDecorator::m_glPathStencilDepthOffsetNV_profiling;
+if(this->m_ptr_glIsStateNV)this->m_ptr_glIsStateNV = (FunctionTable::MEMBERPFNGLISSTATENVPROC)&ProfilingTableDecorator::m_glIsStateNV_profiling;
+if(this->m_ptr_glGetIntegerui64vNV)this->m_ptr_glGetIntegerui64vNV = (FunctionTable::MEMBERPFNGLGETINTEGERUI64VNVPROC)&ProfilingTableDecorator::m_glGetIntegerui64vNV_profiling;
+if(this->m_ptr_glGetImageTransformParameterfvHP)this->m_ptr_glGetImageTransformParameterfvHP = (FunctionTable::MEMBERPFNGLGETIMAGETRANSFORMPARAMETERFVHPPROC)&ProfilingTableDecorator::m_glGetImageTransformParameterfvHP_profiling;
+if(this->m_ptr_glRasterPos2fv)this->m_ptr_glRasterPos2fv = (FunctionTable::MEMBERPFNGLRASTERPOS2FVPROC)&ProfilingTableDecorator::m_glRasterPos2fv_profiling;
+if(this->m_ptr_glVertex3xOES)this->m_ptr_glVertex3xOES = (FunctionTable::MEMBERPFNGLVERTEX3XOESPROC)&ProfilingTableDecorator::m_glVertex3xOES_profiling;
+if(this->m_ptr_glProgramUniform2dvEXT)this->m_ptr_glProgramUniform2dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2DVEXTPROC)&ProfilingTableDecorator::m_glProgramUniform2dvEXT_profiling;
+if(this->m_ptr_glWeightPointerARB)this->m_ptr_glWeightPointerARB = (FunctionTable::MEMBERPFNGLWEIGHTPOINTERARBPROC)&ProfilingTableDecorator::m_glWeightPointerARB_profiling;
+if(this->m_ptr_glFinishFenceNV)this->m_ptr_glFinishFenceNV = (FunctionTable::MEMBERPFNGLFINISHFENCENVPROC)&ProfilingTableDecorator::m_glFinishFenceNV_profiling;
+if(this->m_ptr_glDepthRangexOES)this->m_ptr_glDepthRangexOES = (FunctionTable::MEMBERPFNGLDEPTHRANGEXOESPROC)&ProfilingTableDecorator::m_glDepthRangexOES_profiling;
+if(this->m_ptr_glEnableVertexArrayAttribEXT)this->m_ptr_glEnableVertexArrayAttribEXT = (FunctionTable::MEMBERPFNGLENABLEVERTEXARRAYATTRIBEXTPROC)&ProfilingTableDecorator::m_glEnableVertexArrayAttribEXT_profiling;
+if(this->m_ptr_glProgramUniform2uivEXT)this->m_ptr_glProgramUniform2uivEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UIVEXTPROC)&ProfilingTableDecorator::m_glProgramUniform2uivEXT_profiling;
+if(this->m_ptr_glGetDoubleIndexedvEXT)this->m_ptr_glGetDoubleIndexedvEXT = (FunctionTable::MEMBERPFNGLGETDOUBLEINDEXEDVEXTPROC)&ProfilingTableDecorator::m_glGetDoubleIndexedvEXT_profiling;
+if(this->m_ptr_glWindowPos2fMESA)this->m_ptr_glWindowPos2fMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS2FMESAPROC)&ProfilingTableDecorator::m_glWindowPos2fMESA_profiling;
+if(this->m_ptr_glSecondaryColor3b)this->m_ptr_glSecondaryColor3b = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3BPROC)&ProfilingTableDecorator::m_glSecondaryColor3b_profiling;
+if(this->m_ptr_glCopyConvolutionFilter1DEXT)this->m_ptr_glCopyConvolutionFilter1DEXT = (FunctionTable::MEMBERPFNGLCOPYCONVOLUTIONFILTER1DEXTPROC)&ProfilingTableDecorator::m_glCopyConvolutionFilter1DEXT_profiling;
+if(this->m_ptr_glWindowPos2sv)this->m_ptr_glWindowPos2sv = (FunctionTable::MEMBERPFNGLWINDOWPOS2SVPROC)&ProfilingTableDecorator::m_glWindowPos2sv_profiling;
+if(this->m_ptr_glBindFramebufferEXT)this->m_ptr_glBindFramebufferEXT = (FunctionTable::MEMBERPFNGLBINDFRAMEBUFFEREXTPROC)&ProfilingTableDecorator::m_glBindFramebufferEXT_profiling;
+if(this->m_ptr_glCreateShader)this->m_ptr_glCreateShader = (FunctionTable::MEMBERPFNGLCREATESHADERPROC)&ProfilingTableDecorator::m_glCreateShader_profiling;
+if(this->m_ptr_glGenPathsNV)this->m_ptr_glGenPathsNV = (FunctionTable::MEMBERPFNGLGENPATHSNVPROC)&ProfilingTableDecorator::m_glGenPathsNV_profiling;
+if(this->m_ptr_glGenRenderbuffers)this->m_ptr_glGenRenderbuffers = (FunctionTable::MEMBERPFNGLGENRENDERBUFFERSPROC)&ProfilingTableDecorator::m_glGenRenderbuffers_profiling;
+if(this->m_ptr_glCopyTexSubImage2D)this->m_ptr_glCopyTexSubImage2D = (FunctionTable::MEMBERPFNGLCOPYTEXSUBIMAGE2DPROC)&ProfilingTableDecorator::m_glCopyTexSubImage2D_profiling;
+if(this->m_ptr_glVertexAttrib4ubvARB)this->m_ptr_glVertexAttrib4ubvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4UBVARBPROC)&ProfilingTableDecorator::m_glVertexAttrib4ubvARB_profiling;
+if(this->m_ptr_glDrawTextureNV)this->m_ptr_glDrawTextureNV = (FunctionTable::MEMBERPFNGLDRAWTEXTURENVPROC)&ProfilingTableDecorator::m_glDrawTextureNV_profiling;
+if(this->m_ptr_glVertexAttribs1svNV)this->m_ptr_glVertexAttribs1svNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS1SVNVPROC)&ProfilingTableDecorator::m_glVertexAttribs1svNV_profiling;
+if(this->m_ptr_glClearNamedBufferSubDataEXT)this->m_ptr_glClearNamedBufferSubDataEXT = (FunctionTable::MEMBERPFNGLCLEARNAMEDBUFFERSUBDATAEXTPROC)&ProfilingTableDecorator::m_glClearNamedBufferSubDataEXT_profiling;
+if(this->m_ptr_glBlendFuncSeparate)this->m_ptr_glBlendFuncSeparate = (FunctionTable::MEMBERPFNGLBLENDFUNCSEPARATEPROC)&ProfilingTableDecorator::m_glBlendFuncSeparate_profiling;
+if(this->m_ptr_glPointParameterfARB)this->m_ptr_glPointParameterfARB = (FunctionTable::MEMBERPFNGLPOINTPARAMETERFARBPROC)&ProfilingTableDecorator::m_glPointParameterfARB_profiling;
+if(this->m_ptr_glTexCoord2fv)this->m_ptr_glTexCoord2fv = (FunctionTable::MEMBERPFNGLTEXCOORD2FVPROC)&ProfilingTableDecorator::m_glTexCoord2fv_profiling;
+if(this->m_ptr_glGetVariantFloatvEXT)this->m_ptr_glGetVariantFloatvEXT = (FunctionTable::MEMBERPFNGLGETVARIANTFLOATVEXTPROC)&ProfilingTableDecorator::m_glGetVariantFloatvEXT_profiling;
+if(this->m_ptr_glVertexP2ui)this->m_ptr_glVertexP2ui = (FunctionTable::MEMBERPFNGLVERTEXP2UIPROC)&ProfilingTableDecorator::m_glVertexP2ui_profiling;
+if(this->m_ptr_glWindowPos2dMESA)this->m_ptr_glWindowPos2dMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS2DMESAPROC)&ProfilingTableDecorator::m_glWindowPos2dMESA_profiling;
+if(this->m_ptr_glTexCoord4fv)this->m_ptr_glTexCoord4fv = (FunctionTable::MEMBERPFNGLTEXCOORD4FVPROC)&ProfilingTableDecorator::m_glTexCoord4fv_profiling;
+if(this->m_ptr_glBindFragDataLocationEXT)this->m_ptr_glBindFragDataLocationEXT = (FunctionTable::MEMBERPFNGLBINDFRAGDATALOCATIONEXTPROC)&ProfilingTableDecorator::m_glBindFragDataLocationEXT_profiling;
+if(this->m_ptr_glCompressedTexSubImage1DARB)this->m_ptr_glCompressedTexSubImage1DARB = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXSUBIMAGE1DARBPROC)&ProfilingTableDecorator::m_glCompressedTexSubImage1DARB_profiling;
+if(this->m_ptr_glGetTextureImageEXT)this->m_ptr_glGetTextureImageEXT = (FunctionTable::MEMBERPFNGLGETTEXTUREIMAGEEXTPROC)&ProfilingTableDecorator::m_glGetTextureImageEXT_profiling;
+if(this->m_ptr_glFogCoordd)this->m_ptr_glFogCoordd = (FunctionTable::MEMBERPFNGLFOGCOORDDPROC)&ProfilingTableDecorator::m_glFogCoordd_profiling;
+if(this->m_ptr_glPointSize)this->m_ptr_glPointSize = (FunctionTable::MEMBERPFNGLPOINTSIZEPROC)&ProfilingTableDecorator::m_glPointSize_profiling;
+if(this->m_ptr_glBindTextureUnit)this->m_ptr_glBindTextureUnit = (FunctionTable::MEMBERPFNGLBINDTEXTUREUNITPROC)&ProfilingTableDecorator::m_glBindTextureUnit_profiling;
+if(this->m_ptr_glProgramEnvParameterI4uiNV)this->m_ptr_glProgramEnvParameterI4uiNV = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERI4UINVPROC)&ProfilingTableDecorator::m_glProgramEnvParameterI4uiNV_profiling;
+if(this->m_ptr_glGetProgramPipelineInfoLog)this->m_ptr_glGetProgramPipelineInfoLog = (FunctionTable::MEMBERPFNGLGETPROGRAMPIPELINEINFOLOGPROC)&ProfilingTableDecorator::m_glGetProgramPipelineInfoLog_profiling;
+if(this->m_ptr_glProgramUniform4i64vARB)this->m_ptr_glProgramUniform4i64vARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4I64VARBPROC)&ProfilingTableDecorator::m_glProgramUniform4i64vARB_profiling;
+if(this->m_ptr_glVertexAttrib4Nuiv)this->m_ptr_glVertexAttrib4Nuiv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUIVPROC)&ProfilingTableDecorator::m_glVertexAttrib4Nuiv_profiling;
+if(this->m_ptr_glGetUniformfvARB)this->m_ptr_glGetUniformfvARB = (FunctionTable::MEMBERPFNGLGETUNIFORMFVARBPROC)&ProfilingTableDecorator::m_glGetUniformfvARB_profiling;
+if(this->m_ptr_glWaitSync)this->m_ptr_glWaitSync = (FunctionTable::MEMBERPFNGLWAITSYNCPROC)&ProfilingTableDecorator::m_glWaitSync_profiling;
+if(this->m_ptr_glUniform3i)this->m_ptr_glUniform3i = (FunctionTable::MEMBERPFNGLUNIFORM3IPROC)&ProfilingTableDecorator::m_glUniform3i_profiling;
+if(this->m_ptr_glBlendEquationSeparatei)this->m_ptr_glBlendEquationSeparatei = (FunctionTable::MEMBERPFNGLBLENDEQUATIONSEPARATEIPROC)&ProfilingTableDecorator::m_glBlendEquationSeparatei_profiling;
+if(this->m_ptr_glVertexAttrib2hvNV)this->m_ptr_glVertexAttrib2hvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2HVNVPROC)&ProfilingTableDecorator::m_glVertexAttrib2hvNV_profiling;
+if(this->m_ptr_glTextureParameterivEXT)this->m_ptr_glTextureParameterivEXT = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIVEXTPROC)&ProfilingTableDecorator::m_glTextureParameterivEXT_profiling;
+if(this->m_ptr_glUniform3d)this->m_ptr_glUniform3d = (FunctionTable::MEMBERPFNGLUNIFORM3DPROC)&ProfilingTableDecorator::m_glUniform3d_profiling;
+if(this->m_ptr_glUniform3f)this->m_ptr_glUniform3f = (FunctionTable::MEMBERPFNGLUNIFORM3FPROC)&ProfilingTableDecorator::m_glUniform3f_profiling;
+if(this->m_ptr_glActiveProgramEXT)this->m_ptr_glActiveProgramEXT = (FunctionTable::MEMBERPFNGLACTIVEPROGRAMEXTPROC)&ProfilingTableDecorator::m_glActiveProgramEXT_profiling;
+if(this->m_ptr_glDeleteVertexArrays)this->m_ptr_glDeleteVertexArrays = (FunctionTable::MEMBERPFNGLDELETEVERTEXARRAYSPROC)&ProfilingTableDecorator::m_glDeleteVertexArrays_profiling;
+if(this->m_ptr_glUniform3ui64vARB)this->m_ptr_glUniform3ui64vARB = (FunctionTable::MEMBERPFNGLUNIFORM3UI64VARBPROC)&ProfilingTableDecorator::m_glUniform3ui64vARB_profiling;
+if(this->m_ptr_glProgramUniform1ui64vARB)this->m_ptr_glProgramUniform1ui64vARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UI64VARBPROC)&ProfilingTableDecorator::m_glProgramUniform1ui64vARB_profiling;
+if(this->m_ptr_glTextureParameterfEXT)this->m_ptr_glTextureParameterfEXT = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERFEXTPROC)&ProfilingTableDecorator::m_glTextureParameterfEXT_profiling;
+if(this->m_ptr_glSetFragmentShaderConstantATI)this->m_ptr_glSetFragmentShaderConstantATI = (FunctionTable::MEMBERPFNGLSETFRAGMENTSHADERCONSTANTATIPROC)&ProfilingTableDecorator::m_glSetFragmentShaderConstantATI_profiling;
+if(this->m_ptr_glColorSubTable)this->m_ptr_glColorSubTable = (FunctionTable::MEMBERPFNGLCOLORSUBTABLEPROC)&ProfilingTableDecorator::m_glColorSubTable_profiling;
+if(this->m_ptr_glReplacementCodeuiSUN)this->m_ptr_glReplacementCodeuiSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUISUNPROC)&ProfilingTableDecorator::m_glReplacementCodeuiSUN_profiling;
+if(this->m_ptr_glStateCaptureNV)this->m_ptr_glStateCaptureNV = (FunctionTable::MEMBERPFNGLSTATECAPTURENVPROC)&ProfilingTableDecorator::m_glStateCaptureNV_profiling;
+if(this->m_ptr_glBindAttribLocation)this->m_ptr_glBindAttribLocation = (FunctionTable::MEMBERPFNGLBINDATTRIBLOCATIONPROC)&ProfilingTableDecorator::m_glBindAttribLocation_profiling;
+if(this->m_ptr_glWeightusvARB)this->m_ptr_glWeightusvARB = (FunctionTable::MEMBERPFNGLWEIGHTUSVARBPROC)&ProfilingTableDecorator::m_glWeightusvARB_profiling;
+if(this->m_ptr_glGetFragDataIndex)this->m_ptr_glGetFragDataIndex = (FunctionTable::MEMBERPFNGLGETFRAGDATAINDEXPROC)&ProfilingTableDecorator::m_glGetFragDataIndex_profiling;
+if(this->m_ptr_glMultiTexCoord2xOES)this->m_ptr_glMultiTexCoord2xOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2XOESPROC)&ProfilingTableDecorator::m_glMultiTexCoord2xOES_profiling;
+if(this->m_ptr_glColor3sv)this->m_ptr_glColor3sv = (FunctionTable::MEMBERPFNGLCOLOR3SVPROC)&ProfilingTableDecorator::m_glColor3sv_profiling;
+if(this->m_ptr_glTexCoord2fVertex3fSUN)this->m_ptr_glTexCoord2fVertex3fSUN = (FunctionTable::MEMBERPFNGLTEXCOORD2FVERTEX3FSUNPROC)&ProfilingTableDecorator::m_glTexCoord2fVertex3fSUN_profiling;
+if(this->m_ptr_glPolygonOffsetEXT)this->m_ptr_glPolygonOffsetEXT = (FunctionTable::MEMBERPFNGLPOLYGONOFFSETEXTPROC)&ProfilingTableDecorator::m_glPolygonOffsetEXT_profiling;
+if(this->m_ptr_glWeightPathsNV)this->m_ptr_glWeightPathsNV = (FunctionTable::MEMBERPFNGLWEIGHTPATHSNVPROC)&ProfilingTableDecorator::m_glWeightPathsNV_profiling;
+if(this->m_ptr_glCombinerStageParameterfvNV)this->m_ptr_glCombinerStageParameterfvNV = (FunctionTable::MEMBERPFNGLCOMBINERSTAGEPARAMETERFVNVPROC)&ProfilingTableDecorator::m_glCombinerStageParameterfvNV_profiling;
+if(this->m_ptr_glPointParameterfEXT)this->m_ptr_glPointParameterfEXT = (FunctionTable::MEMBERPFNGLPOINTPARAMETERFEXTPROC)&ProfilingTableDecorator::m_glPointParameterfEXT_profiling;
+if(this->m_ptr_glCopyTexImage1DEXT)this->m_ptr_glCopyTexImage1DEXT = (FunctionTable::MEMBERPFNGLCOPYTEXIMAGE1DEXTPROC)&ProfilingTableDecorator::m_glCopyTexImage1DEXT_profiling;
+if(this->m_ptr_glVertex4sv)this->m_ptr_glVertex4sv = (FunctionTable::MEMBERPFNGLVERTEX4SVPROC)&ProfilingTableDecorator::m_glVertex4sv_profiling;
+if(this->m_ptr_glMatrixMultfEXT)this->m_ptr_glMatrixMultfEXT = (FunctionTable::MEMBERPFNGLMATRIXMULTFEXTPROC)&ProfilingTableDecorator::m_glMatrixMultfEXT_profiling;
+if(this->m_ptr_glCompressedTextureSubImage3DEXT)this->m_ptr_glCompressedTextureSubImage3DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTURESUBIMAGE3DEXTPROC)&ProfilingTableDecorator::m_glCompressedTextureSubImage3DEXT_profiling;
+if(this->m_ptr_glGetTexLevelParameterxvOES)this->m_ptr_glGetTexLevelParameterxvOES = (FunctionTable::MEMBERPFNGLGETTEXLEVELPARAMETERXVOESPROC)&ProfilingTableDecorator::m_glGetTexLevelParameterxvOES_profiling;
+if(this->m_ptr_glVertexAttribL3dvEXT)this->m_ptr_glVertexAttribL3dvEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL3DVEXTPROC)&ProfilingTableDecorator::m_glVertexAttribL3dvEXT_profiling;
+if(this->m_ptr_glMultiTexCoordP4ui)this->m_ptr_glMultiTexCoordP4ui = (FunctionTable::MEMBERPFNGLMULTITEXCOORDP4UIPROC)&ProfilingTableDecorator::m_glMultiTexCoordP4ui_profiling;
+if(this->m_ptr_glGetTextureLevelParameterivEXT)this->m_ptr_glGetTextureLevelParameterivEXT = (FunctionTable::MEMBERPFNGLGETTEXTURELEVELPARAMETERIVEXTPROC)&ProfilingTableDecorator::m_glGetTextureLevelParameterivEXT_profiling;
+if(this->m_ptr_glAlphaFragmentOp2ATI)this->m_ptr_glAlphaFragmentOp2ATI = (FunctionTable::MEMBERPFNGLALPHAFRAGMENTOP2ATIPROC)&ProfilingTableDecorator::m_glAlphaFragmentOp2ATI_profiling;
+if(this->m_ptr_glDeleteFramebuffers)this->m_ptr_glDeleteFramebuffers = (FunctionTable::MEMBERPFNGLDELETEFRAMEBUFFERSPROC)&ProfilingTableDecorator::m_glDeleteFramebuffers_profiling;
+if(this->m_ptr_glDrawArrays)this->m_ptr_glDrawArrays = (FunctionTable::MEMBERPFNGLDRAWARRAYSPROC)&ProfilingTableDecorator::m_glDrawArrays_profiling;
+if(this->m_ptr_glGetTransformFeedbackiv)this->m_ptr_glGetTransformFeedbackiv = (FunctionTable::MEMBERPFNGLGETTRANSFORMFEEDBACKIVPROC)&ProfilingTableDecorator::m_glGetTransformFeedbackiv_profiling;
+if(this->m_ptr_glGetnTexImageARB)this->m_ptr_glGetnTexImageARB = (FunctionTable::MEMBERPFNGLGETNTEXIMAGEARBPROC)&ProfilingTableDecorator::m_glGetnTexImageARB_profiling;
+if(this->m_ptr_glClear)this->m_ptr_glClear = (FunctionTable::MEMBERPFNGLCLEARPROC)&ProfilingTableDecorator::m_glClear_profiling;
+if(this->m_ptr_glVertexArrayParameteriAPPLE)this->m_ptr_glVertexArrayParameteriAPPLE = (FunctionTable::MEMBERPFNGLVERTEXARRAYPARAMETERIAPPLEPROC)&ProfilingTableDecorator::m_glVertexArrayParameteriAPPLE_profiling;
+if(this->m_ptr_glMultiTexCoord2dvARB)this->m_ptr_glMultiTexCoord2dvARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2DVARBPROC)&ProfilingTableDecorator::m_glMultiTexCoord2dvARB_profiling;
+if(this->m_ptr_glGetVideoCaptureStreamdvNV)this->m_ptr_glGetVideoCaptureStreamdvNV = (FunctionTable::MEMBERPFNGLGETVIDEOCAPTURESTREAMDVNVPROC)&ProfilingTableDecorator::m_glGetVideoCaptureStreamdvNV_profiling;
+if(this->m_ptr_glFragmentLightModelivSGIX)this->m_ptr_glFragmentLightModelivSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTLIGHTMODELIVSGIXPROC)&ProfilingTableDecorator::m_glFragmentLightModelivSGIX_profiling;
+if(this->m_ptr_glVertexAttribP2ui)this->m_ptr_glVertexAttribP2ui = (FunctionTable::MEMBERPFNGLVERTEXATTRIBP2UIPROC)&ProfilingTableDecorator::m_glVertexAttribP2ui_profiling;
+if(this->m_ptr_glMultiTexCoordPointerEXT)this->m_ptr_glMultiTexCoordPointerEXT = (FunctionTable::MEMBERPFNGLMULTITEXCOORDPOINTEREXTPROC)&ProfilingTableDecorator::m_glMultiTexCoordPointerEXT_profiling;
+if(this->m_ptr_glProgramUniform3iEXT)this->m_ptr_glProgramUniform3iEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3IEXTPROC)&ProfilingTableDecorator::m_glProgramUniform3iEXT_profiling;
+if(this->m_ptr_glTranslatef)this->m_ptr_glTranslatef = (FunctionTable::MEMBERPFNGLTRANSLATEFPROC)&ProfilingTableDecorator::m_glTranslatef_profiling;
+if(this->m_ptr_glVertexAttrib4Nub)this->m_ptr_glVertexAttrib4Nub = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUBPROC)&ProfilingTableDecorator::m_glVertexAttrib4Nub_profiling;
+if(this->m_ptr_glTranslated)this->m_ptr_glTranslated = (FunctionTable::MEMBERPFNGLTRANSLATEDPROC)&ProfilingTableDecorator::m_glTranslated_profiling;
+if(this->m_ptr_glSamplerParameterIiv)this->m_ptr_glSamplerParameterIiv = (FunctionTable::MEMBERPFNGLSAMPLERPARAMETERIIVPROC)&ProfilingTableDecorator::m_glSamplerParameterIiv_profiling;
+if(this->m_ptr_glTexCoord4hNV)this->m_ptr_glTexCoord4hNV = (FunctionTable::MEMBERPFNGLTEXCOORD4HNVPROC)&ProfilingTableDecorator::m_glTexCoord4hNV_profiling;
+if(this->m_ptr_glDrawElementsIndirect)this->m_ptr_glDrawElementsIndirect = (FunctionTable::MEMBERPFNGLDRAWELEMENTSINDIRECTPROC)&ProfilingTableDecorator::m_glDrawElementsIndirect_profiling;
+if(this->m_ptr_glDeletePerfMonitorsAMD)this->m_ptr_glDeletePerfMonitorsAMD = (FunctionTable::MEMBERPFNGLDELETEPERFMONITORSAMDPROC)&ProfilingTableDecorator::m_glDeletePerfMonitorsAMD_profiling;
+if(this->m_ptr_glIsRenderbufferEXT)this->m_ptr_glIsRenderbufferEXT = (FunctionTable::MEMBERPFNGLISRENDERBUFFEREXTPROC)&ProfilingTableDecorator::m_glIsRenderbufferEXT_profiling;
+if(this->m_ptr_glDrawCommandsNV)this->m_ptr_glDrawCommandsNV = (FunctionTable::MEMBERPFNGLDRAWCOMMANDSNVPROC)&ProfilingTableDecorator::m_glDrawCommandsNV_profiling;
+if(this->m_ptr_glUniform3ivARB)this->m_ptr_glUniform3ivARB = (FunctionTable::MEMBERPFNGLUNIFORM3IVARBPROC)&ProfilingTableDecorator::m_glUniform3ivARB_profiling;
+if(this->m_ptr_glBufferSubData)this->m_ptr_glBufferSubData = (FunctionTable::MEMBERPFNGLBUFFERSUBDATAPROC)&ProfilingTableDecorator::m_glBufferSubData_profiling;
+if(this->m_ptr_glSecondaryColor3bv)this->m_ptr_glSecondaryColor3bv = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3BVPROC)&ProfilingTableDecorator::m_glSecondaryColor3bv_profiling;
+if(this->m_ptr_glMatrixMultTransposedEXT)this->m_ptr_glMatrixMultTransposedEXT = (FunctionTable::MEMBERPFNGLMATRIXMULTTRANSPOSEDEXTPROC)&ProfilingTableDecorator::m_glMatrixMultTransposedEXT_profiling;
+if(this->m_ptr_glRequestResidentProgramsNV)this->m_ptr_glRequestResidentProgramsNV = (FunctionTable::MEMBERPFNGLREQUESTRESIDENTPROGRAMSNVPROC)&ProfilingTableDecorator::m_glRequestResidentProgramsNV_profiling;
+if(this->m_ptr_glAlphaFragmentOp1ATI)this->m_ptr_glAlphaFragmentOp1ATI = (FunctionTable::MEMBERPFNGLALPHAFRAGMENTOP1ATIPROC)&ProfilingTableDecorator::m_glAlphaFragmentOp1ATI_profiling;
+if(this->m_ptr_glGetQueryObjecti64v)this->m_ptr_glGetQueryObjecti64v = (FunctionTable::MEMBERPFNGLGETQUERYOBJECTI64VPROC)&ProfilingTableDecorator::m_glGetQueryObjecti64v_profiling;
+if(this->m_ptr_glMatrixMult3x3fNV)this->m_ptr_glMatrixMult3x3fNV = (FunctionTable::MEMBERPFNGLMATRIXMULT3X3FNVPROC)&ProfilingTableDecorator::m_glMatrixMult3x3fNV_profiling;
+if(this->m_ptr_glColorTableParameteriv)this->m_ptr_glColorTableParameteriv = (FunctionTable::MEMBERPFNGLCOLORTABLEPARAMETERIVPROC)&ProfilingTableDecorator::m_glColorTableParameteriv_profiling;
+if(this->m_ptr_glPathSubCommandsNV)this->m_ptr_glPathSubCommandsNV = (FunctionTable::MEMBERPFNGLPATHSUBCOMMANDSNVPROC)&ProfilingTableDecorator::m_glPathSubCommandsNV_profiling;
+if(this->m_ptr_glGetFinalCombinerInputParameterivNV)this->m_ptr_glGetFinalCombinerInputParameterivNV = (FunctionTable::MEMBERPFNGLGETFINALCOMBINERINPUTPARAMETERIVNVPROC)&ProfilingTableDecorator::m_glGetFinalCombinerInputParameterivNV_profiling;
+if(this->m_ptr_glIsRenderbuffer)this->m_ptr_glIsRenderbuffer = (FunctionTable::MEMBERPFNGLISRENDERBUFFERPROC)&ProfilingTableDecorator::m_glIsRenderbuffer_profiling;
+if(this->m_ptr_glVertex3iv)this->m_ptr_glVertex3iv = (FunctionTable::MEMBERPFNGLVERTEX3IVPROC)&ProfilingTableDecorator::m_glVertex3iv_profiling;
+if(this->m_ptr_glTexGenfv)this->m_ptr_glTexGenfv = (FunctionTable::MEMBERPFNGLTEXGENFVPROC)&ProfilingTableDecorator::m_glTexGenfv_profiling;
+if(this->m_ptr_glFrustumfOES)this->m_ptr_glFrustumfOES = (FunctionTable::MEMBERPFNGLFRUSTUMFOESPROC)&ProfilingTableDecorator::m_glFrustumfOES_profiling;
+if(this->m_ptr_glBindVertexBuffers)this->m_ptr_glBindVertexBuffers = (FunctionTable::MEMBERPFNGLBINDVERTEXBUFFERSPROC)&ProfilingTableDecorator::m_glBindVertexBuffers_profiling;
+if(this->m_ptr_glMateriali)this->m_ptr_glMateriali = (FunctionTable::MEMBERPFNGLMATERIALIPROC)&ProfilingTableDecorator::m_glMateriali_profiling;
+if(this->m_ptr_glMultiTexCoord2svARB)this->m_ptr_glMultiTexCoord2svARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2SVARBPROC)&ProfilingTableDecorator::m_glMultiTexCoord2svARB_profiling;
+if(this->m_ptr_glDisableVertexAttribArray)this->m_ptr_glDisableVertexAttribArray = (FunctionTable::MEMBERPFNGLDISABLEVERTEXATTRIBARRAYPROC)&ProfilingTableDecorator::m_glDisableVertexAttribArray_profiling;
+if(this->m_ptr_glWindowPos3ivARB)this->m_ptr_glWindowPos3ivARB = (FunctionTable::MEMBERPFNGLWINDOWPOS3IVARBPROC)&ProfilingTableDecorator::m_glWindowPos3ivARB_profiling;
+if(this->m_ptr_glTexCoordFormatNV)this->m_ptr_glTexCoordFormatNV = (FunctionTable::MEMBERPFNGLTEXCOORDFORMATNVPROC)&ProfilingTableDecorator::m_glTexCoordFormatNV_profiling;
+if(this->m_ptr_glBlitNamedFramebuffer)this->m_ptr_glBlitNamedFramebuffer = (FunctionTable::MEMBERPFNGLBLITNAMEDFRAMEBUFFERPROC)&ProfilingTableDecorator::m_glBlitNamedFramebuffer_profiling;
+if(this->m_ptr_glMatrixLoadTransposefEXT)this->m_ptr_glMatrixLoadTransposefEXT = (FunctionTable::MEMBERPFNGLMATRIXLOADTRANSPOSEFEXTPROC)&ProfilingTableDecorator::m_glMatrixLoadTransposefEXT_profiling;
+if(this->m_ptr_glMultiTexGenfEXT)this->m_ptr_glMultiTexGenfEXT = (FunctionTable::MEMBERPFNGLMULTITEXGENFEXTPROC)&ProfilingTableDecorator::m_glMultiTexGenfEXT_profiling;
+if(this->m_ptr_glShaderStorageBlockBinding)this->m_ptr_glShaderStorageBlockBinding = (FunctionTable::MEMBERPFNGLSHADERSTORAGEBLOCKBINDINGPROC)&ProfilingTableDecorator::m_glShaderStorageBlockBinding_profiling;
+if(this->m_ptr_glMaterialf)this->m_ptr_glMaterialf = (FunctionTable::MEMBERPFNGLMATERIALFPROC)&ProfilingTableDecorator::m_glMaterialf_profiling;
+if(this->m_ptr_glReplacementCodeuiColor4fNormal3fVertex3fSUN)this->m_ptr_glReplacementCodeuiColor4fNormal3fVertex3fSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUICOLOR4FNORMAL3FVERTEX3FSUNPROC)&ProfilingTableDecorator::m_glReplacementCodeuiColor4fNormal3fVertex3fSUN_profiling;
+if(this->m_ptr_glCheckNamedFramebufferStatusEXT)this->m_ptr_glCheckNamedFramebufferStatusEXT = (FunctionTable::MEMBERPFNGLCHECKNAMEDFRAMEBUFFERSTATUSEXTPROC)&ProfilingTableDecorator::m_glCheckNamedFramebufferStatusEXT_profiling;
+if(this->m_ptr_glVertexArrayVertexAttribFormatEXT)this->m_ptr_glVertexArrayVertexAttribFormatEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBFORMATEXTPROC)&ProfilingTableDecorator::m_glVertexArrayVertexAttribFormatEXT_profiling;
+if(this->m_ptr_glVertex2hNV)this->m_ptr_glVertex2hNV = (FunctionTable::MEMBERPFNGLVERTEX2HNVPROC)&ProfilingTableDecorator::m_glVertex2hNV_profiling;
+if(this->m_ptr_glDeleteVertexShaderEXT)this->m_ptr_glDeleteVertexShaderEXT = (FunctionTable::MEMBERPFNGLDELETEVERTEXSHADEREXTPROC)&ProfilingTableDecorator::m_glDeleteVertexShaderEXT_profiling;
+if(this->m_ptr_glTexImage3DEXT)this->m_ptr_glTexImage3DEXT = (FunctionTable::MEMBERPFNGLTEXIMAGE3DEXTPROC)&ProfilingTableDecorator::m_glTexImage3DEXT_profiling;
+if(this->m_ptr_glProgramLocalParameterI4ivNV)this->m_ptr_glProgramLocalParameterI4ivNV = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERI4IVNVPROC)&ProfilingTableDecorator::m_glProgramLocalParameterI4ivNV_profiling;
+if(this->m_ptr_glGlobalAlphaFactoriSUN)this->m_ptr_glGlobalAlphaFactoriSUN = (FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORISUNPROC)&ProfilingTableDecorator::m_glGlobalAlphaFactoriSUN_profiling;
+if(this->m_ptr_glTextureStorage1D)this->m_ptr_glTextureStorage1D = (FunctionTable::MEMBERPFNGLTEXTURESTORAGE1DPROC)&ProfilingTableDecorator::m_glTextureStorage1D_profiling;
+if(this->m_ptr_glBinormal3sEXT)this->m_ptr_glBinormal3sEXT = (FunctionTable::MEMBERPFNGLBINORMAL3SEXTPROC)&ProfilingTableDecorator::m_glBinormal3sEXT_profiling;
+if(this->m_ptr_glGetProgramInterfaceiv)this->m_ptr_glGetProgramInterfaceiv = (FunctionTable::MEMBERPFNGLGETPROGRAMINTERFACEIVPROC)&ProfilingTableDecorator::m_glGetProgramInterfaceiv_profiling;
+if(this->m_ptr_glMatrixIndexPointerARB)this->m_ptr_glMatrixIndexPointerARB = (FunctionTable::MEMBERPFNGLMATRIXINDEXPOINTERARBPROC)&ProfilingTableDecorator::m_glMatrixIndexPointerARB_profiling;
+if(this->m_ptr_glTexCoordPointerEXT)this->m_ptr_glTexCoordPointerEXT = (FunctionTable::MEMBERPFNGLTEXCOORDPOINTEREXTPROC)&ProfilingTableDecorator::m_glTexCoordPointerEXT_profiling;
+if(this->m_ptr_glMultiTexGeniEXT)this->m_ptr_glMultiTexGeniEXT = (FunctionTable::MEMBERPFNGLMULTITEXGENIEXTPROC)&ProfilingTableDecorator::m_glMultiTexGeniEXT_profiling;
+if(this->m_ptr_glVertexAttrib2fNV)this->m_ptr_glVertexAttrib2fNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2FNVPROC)&ProfilingTableDecorator::m_glVertexAttrib2fNV_profiling;
+if(this->m_ptr_glNamedProgramStringEXT)this->m_ptr_glNamedProgramStringEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMSTRINGEXTPROC)&ProfilingTableDecorator::m_glNamedProgramStringEXT_profiling;
+if(this->m_ptr_glMapNamedBuffer)this->m_ptr_glMapNamedBuffer = (FunctionTable::MEMBERPFNGLMAPNAMEDBUFFERPROC)&ProfilingTableDecorator::m_glMapNamedBuffer_profiling;
+if(this->m_ptr_glGetMinmaxParameteriv)this->m_ptr_glGetMinmaxParameteriv = (FunctionTable::MEMBERPFNGLGETMINMAXPARAMETERIVPROC)&ProfilingTableDecorator::m_glGetMinmaxParameteriv_profiling;
+if(this->m_ptr_glGetnUniformdv)this->m_ptr_glGetnUniformdv = (FunctionTable::MEMBERPFNGLGETNUNIFORMDVPROC)&ProfilingTableDecorator::m_glGetnUniformdv_profiling;
+if(this->m_ptr_glEndConditionalRenderNVX)this->m_ptr_glEndConditionalRenderNVX = (FunctionTable::MEMBERPFNGLENDCONDITIONALRENDERNVXPROC)&ProfilingTableDecorator::m_glEndConditionalRenderNVX_profiling;
+if(this->m_ptr_glBinormal3fEXT)this->m_ptr_glBinormal3fEXT = (FunctionTable::MEMBERPFNGLBINORMAL3FEXTPROC)&ProfilingTableDecorator::m_glBinormal3fEXT_profiling;
+if(this->m_ptr_glNormalStream3iATI)this->m_ptr_glNormalStream3iATI = (FunctionTable::MEMBERPFNGLNORMALSTREAM3IATIPROC)&ProfilingTableDecorator::m_glNormalStream3iATI_profiling;
+if(this->m_ptr_glProgramBufferParametersIivNV)this->m_ptr_glProgramBufferParametersIivNV = (FunctionTable::MEMBERPFNGLPROGRAMBUFFERPARAMETERSIIVNVPROC)&ProfilingTableDecorator::m_glProgramBufferParametersIivNV_profiling;
+if(this->m_ptr_glMapGrid1xOES)this->m_ptr_glMapGrid1xOES = (FunctionTable::MEMBERPFNGLMAPGRID1XOESPROC)&ProfilingTableDecorator::m_glMapGrid1xOES_profiling;
+if(this->m_ptr_glGetVertexAttribPointervARB)this->m_ptr_glGetVertexAttribPointervARB = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBPOINTERVARBPROC)&ProfilingTableDecorator::m_glGetVertexAttribPointervARB_profiling;
+if(this->m_ptr_glFlushMappedNamedBufferRangeEXT)this->m_ptr_glFlushMappedNamedBufferRangeEXT = (FunctionTable::MEMBERPFNGLFLUSHMAPPEDNAMEDBUFFERRANGEEXTPROC)&ProfilingTableDecorator::m_glFlushMappedNamedBufferRangeEXT_profiling;
+if(this->m_ptr_glGetVertexAttribIiv)this->m_ptr_glGetVertexAttribIiv = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBIIVPROC)&ProfilingTableDecorator::m_glGetVertexAttribIiv_profiling;
+if(this->m_ptr_glVertexP4uiv)this->m_ptr_glVertexP4uiv = (FunctionTable::MEMBERPFNGLVERTEXP4UIVPROC)&ProfilingTableDecorator::m_glVertexP4uiv_profiling;
+if(this->m_ptr_glUniformui64NV)this->m_ptr_glUniformui64NV = (FunctionTable::MEMBERPFNGLUNIFORMUI64NVPROC)&ProfilingTableDecorator::m_glUniformui64NV_profiling;
+if(this->m_ptr_glColor4fv)this->m_ptr_glColor4fv = (FunctionTable::MEMBERPFNGLCOLOR4FVPROC)&ProfilingTableDecorator::m_glColor4fv_profiling;
+if(this->m_ptr_glTexParameterxvOES)this->m_ptr_glTexParameterxvOES = (FunctionTable::MEMBERPFNGLTEXPARAMETERXVOESPROC)&ProfilingTableDecorator::m_glTexParameterxvOES_profiling;
+if(this->m_ptr_glPatchParameteri)this->m_ptr_glPatchParameteri = (FunctionTable::MEMBERPFNGLPATCHPARAMETERIPROC)&ProfilingTableDecorator::m_glPatchParameteri_profiling;
+if(this->m_ptr_glMap1d)this->m_ptr_glMap1d = (FunctionTable::MEMBERPFNGLMAP1DPROC)&ProfilingTableDecorator::m_glMap1d_profiling;
+if(this->m_ptr_glGetTexFilterFuncSGIS)this->m_ptr_glGetTexFilterFuncSGIS = (FunctionTable::MEMBERPFNGLGETTEXFILTERFUNCSGISPROC)&ProfilingTableDecorator::m_glGetTexFilterFuncSGIS_profiling;
+if(this->m_ptr_glGetTexParameteriv)this->m_ptr_glGetTexParameteriv = (FunctionTable::MEMBERPFNGLGETTEXPARAMETERIVPROC)&ProfilingTableDecorator::m_glGetTexParameteriv_profiling;
+if(this->m_ptr_glVertexArrayVertexBindingDivisorEXT)this->m_ptr_glVertexArrayVertexBindingDivisorEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXBINDINGDIVISOREXTPROC)&ProfilingTableDecorator::m_glVertexArrayVertexBindingDivisorEXT_profiling;
+if(this->m_ptr_glMultiTexCoord3svARB)this->m_ptr_glMultiTexCoord3svARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3SVARBPROC)&ProfilingTableDecorator::m_glMultiTexCoord3svARB_profiling;
+if(this->m_ptr_glBindProgramNV)this->m_ptr_glBindProgramNV = (FunctionTable::MEMBERPFNGLBINDPROGRAMNVPROC)&ProfilingTableDecorator::m_glBindProgramNV_profiling;
+if(this->m_ptr_glGetConvolutionParameteriv)this->m_ptr_glGetConvolutionParameteriv = (FunctionTable::MEMBERPFNGLGETCONVOLUTIONPARAMETERIVPROC)&ProfilingTableDecorator::m_glGetConvolutionParameteriv_profiling;
+if(this->m_ptr_glGetProgramLocalParameterfvARB)this->m_ptr_glGetProgramLocalParameterfvARB = (FunctionTable::MEMBERPFNGLGETPROGRAMLOCALPARAMETERFVARBPROC)&ProfilingTableDecorator::m_glGetProgramLocalParameterfvARB_profiling;
+if(this->m_ptr_glGenFragmentShadersATI)this->m_ptr_glGenFragmentShadersATI = (FunctionTable::MEMBERPFNGLGENFRAGMENTSHADERSATIPROC)&ProfilingTableDecorator::m_glGenFragmentShadersATI_profiling;
+if(this->m_ptr_glTexBumpParameterivATI)this->m_ptr_glTexBumpParameterivATI = (FunctionTable::MEMBERPFNGLTEXBUMPPARAMETERIVATIPROC)&ProfilingTableDecorator::m_glTexBumpParameterivATI_profiling;
+if(this->m_ptr_glGetNamedFramebufferAttachmentParameteriv)this->m_ptr_glGetNamedFramebufferAttachmentParameteriv = (FunctionTable::MEMBERPFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC)&ProfilingTableDecorator::m_glGetNamedFramebufferAttachmentParameteriv_profiling;
+if(this->m_ptr_glGetnSeparableFilter)this->m_ptr_glGetnSeparableFilter = (FunctionTable::MEMBERPFNGLGETNSEPARABLEFILTERPROC)&ProfilingTableDecorator::m_glGetnSeparableFilter_profiling;
+if(this->m_ptr_glNormal3xvOES)this->m_ptr_glNormal3xvOES = (FunctionTable::MEMBERPFNGLNORMAL3XVOESPROC)&ProfilingTableDecorator::m_glNormal3xvOES_profiling;
+if(this->m_ptr_glPassTexCoordATI)this->m_ptr_glPassTexCoordATI = (FunctionTable::MEMBERPFNGLPASSTEXCOORDATIPROC)&ProfilingTableDecorator::m_glPassTexCoordATI_profiling;
+if(this->m_ptr_glFramebufferTextureFaceARB)this->m_ptr_glFramebufferTextureFaceARB = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTUREFACEARBPROC)&ProfilingTableDecorator::m_glFramebufferTextureFaceARB_profiling;
+if(this->m_ptr_glProgramUniform1dv)this->m_ptr_glProgramUniform1dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1DVPROC)&ProfilingTableDecorator::m_glProgramUniform1dv_profiling;
+if(this->m_ptr_glTextureStorage2DEXT)this->m_ptr_glTextureStorage2DEXT = (FunctionTable::MEMBERPFNGLTEXTURESTORAGE2DEXTPROC)&ProfilingTableDecorator::m_glTextureStorage2DEXT_profiling;
+if(this->m_ptr_glVertexArrayFogCoordOffsetEXT)this->m_ptr_glVertexArrayFogCoordOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYFOGCOORDOFFSETEXTPROC)&ProfilingTableDecorator::m_glVertexArrayFogCoordOffsetEXT_profiling;
+if(this->m_ptr_glDeleteNamedStringARB)this->m_ptr_glDeleteNamedStringARB = (FunctionTable::MEMBERPFNGLDELETENAMEDSTRINGARBPROC)&ProfilingTableDecorator::m_glDeleteNamedStringARB_profiling;
+if(this->m_ptr_glGenOcclusionQueriesNV)this->m_ptr_glGenOcclusionQueriesNV = (FunctionTable::MEMBERPFNGLGENOCCLUSIONQUERIESNVPROC)&ProfilingTableDecorator::m_glGenOcclusionQueriesNV_profiling;
+if(this->m_ptr_glLighti)this->m_ptr_glLighti = (FunctionTable::MEMBERPFNGLLIGHTIPROC)&ProfilingTableDecorator::m_glLighti_profiling;
+if(this->m_ptr_glTexImage1D)this->m_ptr_glTexImage1D = (FunctionTable::MEMBERPFNGLTEXIMAGE1DPROC)&ProfilingTableDecorator::m_glTexImage1D_profiling;
+if(this->m_ptr_glLightf)this->m_ptr_glLightf = (FunctionTable::MEMBERPFNGLLIGHTFPROC)&ProfilingTableDecorator::m_glLightf_profiling;
+if(this->m_ptr_glClientAttribDefaultEXT)this->m_ptr_glClientAttribDefaultEXT = (FunctionTable::MEMBERPFNGLCLIENTATTRIBDEFAULTEXTPROC)&ProfilingTableDecorator::m_glClientAttribDefaultEXT_profiling;
+if(this->m_ptr_glVertexAttrib4bvARB)this->m_ptr_glVertexAttrib4bvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4BVARBPROC)&ProfilingTableDecorator::m_glVertexAttrib4bvARB_profiling;
+if(this->m_ptr_glVertexAttribIFormatNV)this->m_ptr_glVertexAttribIFormatNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBIFORMATNVPROC)&ProfilingTableDecorator::m_glVertexAttribIFormatNV_profiling;
+if(this->m_ptr_glStencilFuncSeparate)this->m_ptr_glStencilFuncSeparate = (FunctionTable::MEMBERPFNGLSTENCILFUNCSEPARATEPROC)&ProfilingTableDecorator::m_glStencilFuncSeparate_profiling;
+if(this->m_ptr_glGetVertexAttribfvARB)this->m_ptr_glGetVertexAttribfvARB = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBFVARBPROC)&ProfilingTableDecorator::m_glGetVertexAttribfvARB_profiling;
+if(this->m_ptr_glVertexAttrib2dNV)this->m_ptr_glVertexAttrib2dNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2DNVPROC)&ProfilingTableDecorator::m_glVertexAttrib2dNV_profiling;
+if(this->m_ptr_glProgramUniform2iEXT)this->m_ptr_glProgramUniform2iEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2IEXTPROC)&ProfilingTableDecorator::m_glProgramUniform2iEXT_profiling;
+if(this->m_ptr_glClientActiveVertexStreamATI)this->m_ptr_glClientActiveVertexStreamATI = (FunctionTable::MEMBERPFNGLCLIENTACTIVEVERTEXSTREAMATIPROC)&ProfilingTableDecorator::m_glClientActiveVertexStreamATI_profiling;
+if(this->m_ptr_glRasterPos3xOES)this->m_ptr_glRasterPos3xOES = (FunctionTable::MEMBERPFNGLRASTERPOS3XOESPROC)&ProfilingTableDecorator::m_glRasterPos3xOES_profiling;
+if(this->m_ptr_glGetMapParameterivNV)this->m_ptr_glGetMapParameterivNV = (FunctionTable::MEMBERPFNGLGETMAPPARAMETERIVNVPROC)&ProfilingTableDecorator::m_glGetMapParameterivNV_profiling;
+if(this->m_ptr_glSampleCoverage)this->m_ptr_glSampleCoverage = (FunctionTable::MEMBERPFNGLSAMPLECOVERAGEPROC)&ProfilingTableDecorator::m_glSampleCoverage_profiling;
+if(this->m_ptr_glClearDepthxOES)this->m_ptr_glClearDepthxOES = (FunctionTable::MEMBERPFNGLCLEARDEPTHXOESPROC)&ProfilingTableDecorator::m_glClearDepthxOES_profiling;
+if(this->m_ptr_glTexCoord2fNormal3fVertex3fvSUN)this->m_ptr_glTexCoord2fNormal3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLTEXCOORD2FNORMAL3FVERTEX3FVSUNPROC)&ProfilingTableDecorator::m_glTexCoord2fNormal3fVertex3fvSUN_profiling;
+if(this->m_ptr_glGetFirstPerfQueryIdINTEL)this->m_ptr_glGetFirstPerfQueryIdINTEL = (FunctionTable::MEMBERPFNGLGETFIRSTPERFQUERYIDINTELPROC)&ProfilingTableDecorator::m_glGetFirstPerfQueryIdINTEL_profiling;
+if(this->m_ptr_glUnmapNamedBufferEXT)this->m_ptr_glUnmapNamedBufferEXT = (FunctionTable::MEMBERPFNGLUNMAPNAMEDBUFFEREXTPROC)&ProfilingTableDecorator::m_glUnmapNamedBufferEXT_profiling;
+if(this->m_ptr_glGetTransformFeedbacki_v)this->m_ptr_glGetTransformFeedbacki_v = (FunctionTable::MEMBERPFNGLGETTRANSFORMFEEDBACKI_VPROC)&ProfilingTableDecorator::m_glGetTransformFeedbacki_v_profiling;
+if(this->m_ptr_glUniform4fvARB)this->m_ptr_glUniform4fvARB = (FunctionTable::MEMBERPFNGLUNIFORM4FVARBPROC)&ProfilingTableDecorator::m_glUniform4fvARB_profiling;
+if(this->m_ptr_glRenderbufferStorageMultisampleCoverageNV)this->m_ptr_glRenderbufferStorageMultisampleCoverageNV = (FunctionTable::MEMBERPFNGLRENDERBUFFERSTORAGEMULTISAMPLECOVERAGENVPROC)&ProfilingTableDecorator::m_glRenderbufferStorageMultisampleCoverageNV_profiling;
+if(this->m_ptr_glGetFloati_vEXT)this->m_ptr_glGetFloati_vEXT = (FunctionTable::MEMBERPFNGLGETFLOATI_VEXTPROC)&ProfilingTableDecorator::m_glGetFloati_vEXT_profiling;
+if(this->m_ptr_glBindAttribLocationARB)this->m_ptr_glBindAttribLocationARB = (FunctionTable::MEMBERPFNGLBINDATTRIBLOCATIONARBPROC)&ProfilingTableDecorator::m_glBindAttribLocationARB_profiling;
+if(this->m_ptr_glBufferAddressRangeNV)this->m_ptr_glBufferAddressRangeNV = (FunctionTable::MEMBERPFNGLBUFFERADDRESSRANGENVPROC)&ProfilingTableDecorator::m_glBufferAddressRangeNV_profiling;
+if(this->m_ptr_glGenProgramsARB)this->m_ptr_glGenProgramsARB = (FunctionTable::MEMBERPFNGLGENPROGRAMSARBPROC)&ProfilingTableDecorator::m_glGenProgramsARB_profiling;
+if(this->m_ptr_glMultiTexEnvivEXT)this->m_ptr_glMultiTexEnvivEXT = (FunctionTable::MEMBERPFNGLMULTITEXENVIVEXTPROC)&ProfilingTableDecorator::m_glMultiTexEnvivEXT_profiling;
+if(this->m_ptr_glSecondaryColor3uiEXT)this->m_ptr_glSecondaryColor3uiEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UIEXTPROC)&ProfilingTableDecorator::m_glSecondaryColor3uiEXT_profiling;
+if(this->m_ptr_glCompressedTextureImage2DEXT)this->m_ptr_glCompressedTextureImage2DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTUREIMAGE2DEXTPROC)&ProfilingTableDecorator::m_glCompressedTextureImage2DEXT_profiling;
+if(this->m_ptr_glUniform2i)this->m_ptr_glUniform2i = (FunctionTable::MEMBERPFNGLUNIFORM2IPROC)&ProfilingTableDecorator::m_glUniform2i_profiling;
+if(this->m_ptr_glCopyTexImage2DEXT)this->m_ptr_glCopyTexImage2DEXT = (FunctionTable::MEMBERPFNGLCOPYTEXIMAGE2DEXTPROC)&ProfilingTableDecorator::m_glCopyTexImage2DEXT_profiling;
+if(this->m_ptr_glUniform2d)this->m_ptr_glUniform2d = (FunctionTable::MEMBERPFNGLUNIFORM2DPROC)&ProfilingTableDecorator::m_glUniform2d_profiling;
+if(this->m_ptr_glVertexAttribL1d)this->m_ptr_glVertexAttribL1d = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL1DPROC)&ProfilingTableDecorator::m_glVertexAttribL1d_profiling;
+if(this->m_ptr_glFramebufferTextureFaceEXT)this->m_ptr_glFramebufferTextureFaceEXT = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTUREFACEEXTPROC)&ProfilingTableDecorator::m_glFramebufferTextureFaceEXT_profiling;
+if(this->m_ptr_glFramebufferTextureLayer)this->m_ptr_glFramebufferTextureLayer = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURELAYERPROC)&ProfilingTableDecorator::m_glFramebufferTextureLayer_profiling;
+if(this->m_ptr_glMultiTexCoord4bvOES)this->m_ptr_glMultiTexCoord4bvOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4BVOESPROC)&ProfilingTableDecorator::m_glMultiTexCoord4bvOES_profiling;
+if(this->m_ptr_glGetVertexArrayPointeri_vEXT)this->m_ptr_glGetVertexArrayPointeri_vEXT = (FunctionTable::MEMBERPFNGLGETVERTEXARRAYPOINTERI_VEXTPROC)&ProfilingTableDecorator::m_glGetVertexArrayPointeri_vEXT_profiling;
+if(this->m_ptr_glNamedProgramLocalParameter4dEXT)this->m_ptr_glNamedProgramLocalParameter4dEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETER4DEXTPROC)&ProfilingTableDecorator::m_glNamedProgramLocalParameter4dEXT_profiling;
+if(this->m_ptr_glBinormal3bEXT)this->m_ptr_glBinormal3bEXT = (FunctionTable::MEMBERPFNGLBINORMAL3BEXTPROC)&ProfilingTableDecorator::m_glBinormal3bEXT_profiling;
+if(this->m_ptr_glConvolutionFilter2DEXT)this->m_ptr_glConvolutionFilter2DEXT = (FunctionTable::MEMBERPFNGLCONVOLUTIONFILTER2DEXTPROC)&ProfilingTableDecorator::m_glConvolutionFilter2DEXT_profiling;
+if(this->m_ptr_glProgramUniform2fv)this->m_ptr_glProgramUniform2fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2FVPROC)&ProfilingTableDecorator::m_glProgramUniform2fv_profiling;
+if(this->m_ptr_glColor3fVertex3fSUN)this->m_ptr_glColor3fVertex3fSUN = (FunctionTable::MEMBERPFNGLCOLOR3FVERTEX3FSUNPROC)&ProfilingTableDecorator::m_glColor3fVertex3fSUN_profiling;
+if(this->m_ptr_glNormal3fVertex3fvSUN)this->m_ptr_glNormal3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLNORMAL3FVERTEX3FVSUNPROC)&ProfilingTableDecorator::m_glNormal3fVertex3fvSUN_profiling;
+if(this->m_ptr_glCopyMultiTexSubImage3DEXT)this->m_ptr_glCopyMultiTexSubImage3DEXT = (FunctionTable::MEMBERPFNGLCOPYMULTITEXSUBIMAGE3DEXTPROC)&ProfilingTableDecorator::m_glCopyMultiTexSubImage3DEXT_profiling;
+if(this->m_ptr_glProgramLocalParameterI4iNV)this->m_ptr_glProgramLocalParameterI4iNV = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERI4INVPROC)&ProfilingTableDecorator::m_glProgramLocalParameterI4iNV_profiling;
+if(this->m_ptr_glProgramUniformMatrix2x4dv)this->m_ptr_glProgramUniformMatrix2x4dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X4DVPROC)&ProfilingTableDecorator::m_glProgramUniformMatrix2x4dv_profiling;
+if(this->m_ptr_glPathMemoryGlyphIndexArrayNV)this->m_ptr_glPathMemoryGlyphIndexArrayNV = (FunctionTable::MEMBERPFNGLPATHMEMORYGLYPHINDEXARRAYNVPROC)&ProfilingTableDecorator::m_glPathMemoryGlyphIndexArrayNV_profiling;
+if(this->m_ptr_glDrawArraysEXT)this->m_ptr_glDrawArraysEXT = (FunctionTable::MEMBERPFNGLDRAWARRAYSEXTPROC)&ProfilingTableDecorator::m_glDrawArraysEXT_profiling;
+if(this->m_ptr_glBlendEquationEXT)this->m_ptr_glBlendEquationEXT = (FunctionTable::MEMBERPFNGLBLENDEQUATIONEXTPROC)&ProfilingTableDecorator::m_glBlendEquationEXT_profiling;
+if(this->m_ptr_glStencilOp)this->m_ptr_glStencilOp = (FunctionTable::MEMBERPFNGLSTENCILOPPROC)&ProfilingTableDecorator::m_glStencilOp_profiling;
+if(this->m_ptr_glCopyTextureSubImage2DEXT)this->m_ptr_glCopyTextureSubImage2DEXT = (FunctionTable::MEMBERPFNGLCOPYTEXTURESUBIMAGE2DEXTPROC)&ProfilingTableDecorator::m_glCopyTextureSubImage2DEXT_profiling;
+if(this->m_ptr_glTexEnvf)this->m_ptr_glTexEnvf = (FunctionTable::MEMBERPFNGLTEXENVFPROC)&ProfilingTableDecorator::m_glTexEnvf_profiling;
+if(this->m_ptr_glVertexAttrib2dvNV)this->m_ptr_glVertexAttrib2dvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2DVNVPROC)&ProfilingTableDecorator::m_glVertexAttrib2dvNV_profiling;
+if(this->m_ptr_glGenPerfMonitorsAMD)this->m_ptr_glGenPerfMonitorsAMD = (FunctionTable::MEMBERPFNGLGENPERFMONITORSAMDPROC)&ProfilingTableDecorator::m_glGenPerfMonitorsAMD_profiling;
+if(this->m_ptr_glGetInteger64i_v)this->m_ptr_glGetInteger64i_v = (FunctionTable::MEMBERPFNGLGETINTEGER64I_VPROC)&ProfilingTableDecorator::m_glGetInteger64i_v_profiling;
+if(this->m_ptr_glGetHistogramParameterfv)this->m_ptr_glGetHistogramParameterfv = (FunctionTable::MEMBERPFNGLGETHISTOGRAMPARAMETERFVPROC)&ProfilingTableDecorator::m_glGetHistogramParameterfv_profiling;
+if(this->m_ptr_glVertexFormatNV)this->m_ptr_glVertexFormatNV = (FunctionTable::MEMBERPFNGLVERTEXFORMATNVPROC)&ProfilingTableDecorator::m_glVertexFormatNV_profiling;
+if(this->m_ptr_glBlendFuncIndexedAMD)this->m_ptr_glBlendFuncIndexedAMD = (FunctionTable::MEMBERPFNGLBLENDFUNCINDEXEDAMDPROC)&ProfilingTableDecorator::m_glBlendFuncIndexedAMD_profiling;
+if(this->m_ptr_glTexEnvi)this->m_ptr_glTexEnvi = (FunctionTable::MEMBERPFNGLTEXENVIPROC)&ProfilingTableDecorator::m_glTexEnvi_profiling;
+if(this->m_ptr_glMultiTexCoord1iv)this->m_ptr_glMultiTexCoord1iv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1IVPROC)&ProfilingTableDecorator::m_glMultiTexCoord1iv_profiling;
+if(this->m_ptr_glIsEnabledi)this->m_ptr_glIsEnabledi = (FunctionTable::MEMBERPFNGLISENABLEDIPROC)&ProfilingTableDecorator::m_glIsEnabledi_profiling;
+if(this->m_ptr_glVertexAttribL2ui64vNV)this->m_ptr_glVertexAttribL2ui64vNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL2UI64VNVPROC)&ProfilingTableDecorator::m_glVertexAttribL2ui64vNV_profiling;
+if(this->m_ptr_glVertexAttribL4i64NV)this->m_ptr_glVertexAttribL4i64NV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL4I64NVPROC)&ProfilingTableDecorator::m_glVertexAttribL4i64NV_profiling;
+if(this->m_ptr_glMatrixTranslatedEXT)this->m_ptr_glMatrixTranslatedEXT = (FunctionTable::MEMBERPFNGLMATRIXTRANSLATEDEXTPROC)&ProfilingTableDecorator::m_glMatrixTranslatedEXT_profiling;
+if(this->m_ptr_glMakeTextureHandleResidentARB)this->m_ptr_glMakeTextureHandleResidentARB = (FunctionTable::MEMBERPFNGLMAKETEXTUREHANDLERESIDENTARBPROC)&ProfilingTableDecorator::m_glMakeTextureHandleResidentARB_profiling;
+if(this->m_ptr_glMatrixMultdEXT)this->m_ptr_glMatrixMultdEXT = (FunctionTable::MEMBERPFNGLMATRIXMULTDEXTPROC)&ProfilingTableDecorator::m_glMatrixMultdEXT_profiling;
+if(this->m_ptr_glBinormal3dvEXT)this->m_ptr_glBinormal3dvEXT = (FunctionTable::MEMBERPFNGLBINORMAL3DVEXTPROC)&ProfilingTableDecorator::m_glBinormal3dvEXT_profiling;
+if(this->m_ptr_glImportSyncEXT)this->m_ptr_glImportSyncEXT = (FunctionTable::MEMBERPFNGLIMPORTSYNCEXTPROC)&ProfilingTableDecorator::m_glImportSyncEXT_profiling;
+if(this->m_ptr_glGetMapiv)this->m_ptr_glGetMapiv = (FunctionTable::MEMBERPFNGLGETMAPIVPROC)&ProfilingTableDecorator::m_glGetMapiv_profiling;
+if(this->m_ptr_glGetListParameterfvSGIX)this->m_ptr_glGetListParameterfvSGIX = (FunctionTable::MEMBERPFNGLGETLISTPARAMETERFVSGIXPROC)&ProfilingTableDecorator::m_glGetListParameterfvSGIX_profiling;
+if(this->m_ptr_glMultiTexCoord4sv)this->m_ptr_glMultiTexCoord4sv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4SVPROC)&ProfilingTableDecorator::m_glMultiTexCoord4sv_profiling;
+if(this->m_ptr_glPNTrianglesiATI)this->m_ptr_glPNTrianglesiATI = (FunctionTable::MEMBERPFNGLPNTRIANGLESIATIPROC)&ProfilingTableDecorator::m_glPNTrianglesiATI_profiling;
+if(this->m_ptr_glBindVertexArrayAPPLE)this->m_ptr_glBindVertexArrayAPPLE = (FunctionTable::MEMBERPFNGLBINDVERTEXARRAYAPPLEPROC)&ProfilingTableDecorator::m_glBindVertexArrayAPPLE_profiling;
+if(this->m_ptr_glObjectPtrLabel)this->m_ptr_glObjectPtrLabel = (FunctionTable::MEMBERPFNGLOBJECTPTRLABELPROC)&ProfilingTableDecorator::m_glObjectPtrLabel_profiling;
+if(this->m_ptr_glGetDebugMessageLog)this->m_ptr_glGetDebugMessageLog = (FunctionTable::MEMBERPFNGLGETDEBUGMESSAGELOGPROC)&ProfilingTableDecorator::m_glGetDebugMessageLog_profiling;
+if(this->m_ptr_glTrackMatrixNV)this->m_ptr_glTrackMatrixNV = (FunctionTable::MEMBERPFNGLTRACKMATRIXNVPROC)&ProfilingTableDecorator::m_glTrackMatrixNV_profiling;
+if(this->m_ptr_glBindFragDataLocation)this->m_ptr_glBindFragDataLocation = (FunctionTable::MEMBERPFNGLBINDFRAGDATALOCATIONPROC)&ProfilingTableDecorator::m_glBindFragDataLocation_profiling;
+if(this->m_ptr_glTangent3ivEXT)this->m_ptr_glTangent3ivEXT = (FunctionTable::MEMBERPFNGLTANGENT3IVEXTPROC)&ProfilingTableDecorator::m_glTangent3ivEXT_profiling;
+if(this->m_ptr_glSecondaryColor3ubv)this->m_ptr_glSecondaryColor3ubv = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UBVPROC)&ProfilingTableDecorator::m_glSecondaryColor3ubv_profiling;
+if(this->m_ptr_glMakeTextureHandleNonResidentNV)this->m_ptr_glMakeTextureHandleNonResidentNV = (FunctionTable::MEMBERPFNGLMAKETEXTUREHANDLENONRESIDENTNVPROC)&ProfilingTableDecorator::m_glMakeTextureHandleNonResidentNV_profiling;
+if(this->m_ptr_glVertexAttribs4ubvNV)this->m_ptr_glVertexAttribs4ubvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS4UBVNVPROC)&ProfilingTableDecorator::m_glVertexAttribs4ubvNV_profiling;
+if(this->m_ptr_glClipPlanexOES)this->m_ptr_glClipPlanexOES = (FunctionTable::MEMBERPFNGLCLIPPLANEXOESPROC)&ProfilingTableDecorator::m_glClipPlanexOES_profiling;
+if(this->m_ptr_glMultiTexCoord3iv)this->m_ptr_glMultiTexCoord3iv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3IVPROC)&ProfilingTableDecorator::m_glMultiTexCoord3iv_profiling;
+if(this->m_ptr_glGetnPolygonStippleARB)this->m_ptr_glGetnPolygonStippleARB = (FunctionTable::MEMBERPFNGLGETNPOLYGONSTIPPLEARBPROC)&ProfilingTableDecorator::m_glGetnPolygonStippleARB_profiling;
+if(this->m_ptr_glUniform2i64vNV)this->m_ptr_glUniform2i64vNV = (FunctionTable::MEMBERPFNGLUNIFORM2I64VNVPROC)&ProfilingTableDecorator::m_glUniform2i64vNV_profiling;
+if(this->m_ptr_glLightModelf)this->m_ptr_glLightModelf = (FunctionTable::MEMBERPFNGLLIGHTMODELFPROC)&ProfilingTableDecorator::m_glLightModelf_profiling;
+if(this->m_ptr_glMultiTexSubImage2DEXT)this->m_ptr_glMultiTexSubImage2DEXT = (FunctionTable::MEMBERPFNGLMULTITEXSUBIMAGE2DEXTPROC)&ProfilingTableDecorator::m_glMultiTexSubImage2DEXT_profiling;
+if(this->m_ptr_glReplacementCodeuiColor3fVertex3fSUN)this->m_ptr_glReplacementCodeuiColor3fVertex3fSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUICOLOR3FVERTEX3FSUNPROC)&ProfilingTableDecorator::m_glReplacementCodeuiColor3fVertex3fSUN_profiling;
+if(this->m_ptr_glTangent3dvEXT)this->m_ptr_glTangent3dvEXT = (FunctionTable::MEMBERPFNGLTANGENT3DVEXTPROC)&ProfilingTableDecorator::m_glTangent3dvEXT_profiling;
+if(this->m_ptr_glLightModeli)this->m_ptr_glLightModeli = (FunctionTable::MEMBERPFNGLLIGHTMODELIPROC)&ProfilingTableDecorator::m_glLightModeli_profiling;
+if(this->m_ptr_glVertexWeighthvNV)this->m_ptr_glVertexWeighthvNV = (FunctionTable::MEMBERPFNGLVERTEXWEIGHTHVNVPROC)&ProfilingTableDecorator::m_glVertexWeighthvNV_profiling;
+if(this->m_ptr_glWindowPos3iv)this->m_ptr_glWindowPos3iv = (FunctionTable::MEMBERPFNGLWINDOWPOS3IVPROC)&ProfilingTableDecorator::m_glWindowPos3iv_profiling;
+if(this->m_ptr_glMultiTexCoordP1uiv)this->m_ptr_glMultiTexCoordP1uiv = (FunctionTable::MEMBERPFNGLMULTITEXCOORDP1UIVPROC)&ProfilingTableDecorator::m_glMultiTexCoordP1uiv_profiling;
+if(this->m_ptr_glTransformPathNV)this->m_ptr_glTransformPathNV = (FunctionTable::MEMBERPFNGLTRANSFORMPATHNVPROC)&ProfilingTableDecorator::m_glTransformPathNV_profiling;
+if(this->m_ptr_glProgramNamedParameter4dNV)this->m_ptr_glProgramNamedParameter4dNV = (FunctionTable::MEMBERPFNGLPROGRAMNAMEDPARAMETER4DNVPROC)&ProfilingTableDecorator::m_glProgramNamedParameter4dNV_profiling;
+if(this->m_ptr_glMultiDrawElementsIndirect)this->m_ptr_glMultiDrawElementsIndirect = (FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSINDIRECTPROC)&ProfilingTableDecorator::m_glMultiDrawElementsIndirect_profiling;
+if(this->m_ptr_glProgramUniform1dEXT)this->m_ptr_glProgramUniform1dEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1DEXTPROC)&ProfilingTableDecorator::m_glProgramUniform1dEXT_profiling;
+if(this->m_ptr_glCallLists)this->m_ptr_glCallLists = (FunctionTable::MEMBERPFNGLCALLLISTSPROC)&ProfilingTableDecorator::m_glCallLists_profiling;
+if(this->m_ptr_glNormal3hvNV)this->m_ptr_glNormal3hvNV = (FunctionTable::MEMBERPFNGLNORMAL3HVNVPROC)&ProfilingTableDecorator::m_glNormal3hvNV_profiling;
+if(this->m_ptr_glGetCombinerOutputParameterfvNV)this->m_ptr_glGetCombinerOutputParameterfvNV = (FunctionTable::MEMBERPFNGLGETCOMBINEROUTPUTPARAMETERFVNVPROC)&ProfilingTableDecorator::m_glGetCombinerOutputParameterfvNV_profiling;
+if(this->m_ptr_glVertexAttrib4sARB)this->m_ptr_glVertexAttrib4sARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4SARBPROC)&ProfilingTableDecorator::m_glVertexAttrib4sARB_profiling;
+if(this->m_ptr_glTexCoord3i)this->m_ptr_glTexCoord3i = (FunctionTable::MEMBERPFNGLTEXCOORD3IPROC)&ProfilingTableDecorator::m_glTexCoord3i_profiling;
+if(this->m_ptr_glVertexAttribI3uiv)this->m_ptr_glVertexAttribI3uiv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI3UIVPROC)&ProfilingTableDecorator::m_glVertexAttribI3uiv_profiling;
+if(this->m_ptr_glPushDebugGroup)this->m_ptr_glPushDebugGroup = (FunctionTable::MEMBERPFNGLPUSHDEBUGGROUPPROC)&ProfilingTableDecorator::m_glPushDebugGroup_profiling;
+if(this->m_ptr_glTexCoord3f)this->m_ptr_glTexCoord3f = (FunctionTable::MEMBERPFNGLTEXCOORD3FPROC)&ProfilingTableDecorator::m_glTexCoord3f_profiling;
+if(this->m_ptr_glTexCoord3d)this->m_ptr_glTexCoord3d = (FunctionTable::MEMBERPFNGLTEXCOORD3DPROC)&ProfilingTableDecorator::m_glTexCoord3d_profiling;
+if(this->m_ptr_glTexCoord2xOES)this->m_ptr_glTexCoord2xOES = (FunctionTable::MEMBERPFNGLTEXCOORD2XOESPROC)&ProfilingTableDecorator::m_glTexCoord2xOES_profiling;
+if(this->m_ptr_glGetStageIndexNV)this->m_ptr_glGetStageIndexNV = (FunctionTable::MEMBERPFNGLGETSTAGEINDEXNVPROC)&ProfilingTableDecorator::m_glGetStageIndexNV_profiling;
+if(this->m_ptr_glProgramUniform4i64vNV)this->m_ptr_glProgramUniform4i64vNV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4I64VNVPROC)&ProfilingTableDecorator::m_glProgramUniform4i64vNV_profiling;
+if(this->m_ptr_glGetNamedBufferPointervEXT)this->m_ptr_glGetNamedBufferPointervEXT = (FunctionTable::MEMBERPFNGLGETNAMEDBUFFERPOINTERVEXTPROC)&ProfilingTableDecorator::m_glGetNamedBufferPointervEXT_profiling;
+if(this->m_ptr_glTextureBarrierNV)this->m_ptr_glTextureBarrierNV = (FunctionTable::MEMBERPFNGLTEXTUREBARRIERNVPROC)&ProfilingTableDecorator::m_glTextureBarrierNV_profiling;
+if(this->m_ptr_glColor4ubVertex3fvSUN)this->m_ptr_glColor4ubVertex3fvSUN = (FunctionTable::MEMBERPFNGLCOLOR4UBVERTEX3FVSUNPROC)&ProfilingTableDecorator::m_glColor4ubVertex3fvSUN_profiling;
+if(this->m_ptr_glGetCommandHeaderNV)this->m_ptr_glGetCommandHeaderNV = (FunctionTable::MEMBERPFNGLGETCOMMANDHEADERNVPROC)&ProfilingTableDecorator::m_glGetCommandHeaderNV_profiling;
+if(this->m_ptr_glGetPerfMonitorCounterInfoAMD)this->m_ptr_glGetPerfMonitorCounterInfoAMD = (FunctionTable::MEMBERPFNGLGETPERFMONITORCOUNTERINFOAMDPROC)&ProfilingTableDecorator::m_glGetPerfMonitorCounterInfoAMD_profiling;
+if(this->m_ptr_glVertexAttrib1svARB)this->m_ptr_glVertexAttrib1svARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1SVARBPROC)&ProfilingTableDecorator::m_glVertexAttrib1svARB_profiling;
+if(this->m_ptr_glCombinerParameteriNV)this->m_ptr_glCombinerParameteriNV = (FunctionTable::MEMBERPFNGLCOMBINERPARAMETERINVPROC)&ProfilingTableDecorator::m_glCombinerParameteriNV_profiling;
+if(this->m_ptr_glMatrixMultTransposefEXT)this->m_ptr_glMatrixMultTransposefEXT = (FunctionTable::MEMBERPFNGLMATRIXMULTTRANSPOSEFEXTPROC)&ProfilingTableDecorator::m_glMatrixMultTransposefEXT_profiling;
+if(this->m_ptr_glDetailTexFuncSGIS)this->m_ptr_glDetailTexFuncSGIS = (FunctionTable::MEMBERPFNGLDETAILTEXFUNCSGISPROC)&ProfilingTableDecorator::m_glDetailTexFuncSGIS_profiling;
+if(this->m_ptr_glAreTexturesResident)this->m_ptr_glAreTexturesResident = (FunctionTable::MEMBERPFNGLARETEXTURESRESIDENTPROC)&ProfilingTableDecorator::m_glAreTexturesResident_profiling;
+if(this->m_ptr_glProgramUniform2d)this->m_ptr_glProgramUniform2d = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2DPROC)&ProfilingTableDecorator::m_glProgramUniform2d_profiling;
+if(this->m_ptr_glGetConvolutionParameterfvEXT)this->m_ptr_glGetConvolutionParameterfvEXT = (FunctionTable::MEMBERPFNGLGETCONVOLUTIONPARAMETERFVEXTPROC)&ProfilingTableDecorator::m_glGetConvolutionParameterfvEXT_profiling;
+if(this->m_ptr_glIndexPointerListIBM)this->m_ptr_glIndexPointerListIBM = (FunctionTable::MEMBERPFNGLINDEXPOINTERLISTIBMPROC)&ProfilingTableDecorator::m_glIndexPointerListIBM_profiling;
+if(this->m_ptr_glVertexAttribI4iEXT)this->m_ptr_glVertexAttribI4iEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4IEXTPROC)&ProfilingTableDecorator::m_glVertexAttribI4iEXT_profiling;
+if(this->m_ptr_glProgramUniform2f)this->m_ptr_glProgramUniform2f = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2FPROC)&ProfilingTableDecorator::m_glProgramUniform2f_profiling;
+if(this->m_ptr_glRasterPos4sv)this->m_ptr_glRasterPos4sv = (FunctionTable::MEMBERPFNGLRASTERPOS4SVPROC)&ProfilingTableDecorator::m_glRasterPos4sv_profiling;
+if(this->m_ptr_glColor4s)this->m_ptr_glColor4s = (FunctionTable::MEMBERPFNGLCOLOR4SPROC)&ProfilingTableDecorator::m_glColor4s_profiling;
+if(this->m_ptr_glColorFragmentOp3ATI)this->m_ptr_glColorFragmentOp3ATI = (FunctionTable::MEMBERPFNGLCOLORFRAGMENTOP3ATIPROC)&ProfilingTableDecorator::m_glColorFragmentOp3ATI_profiling;
+if(this->m_ptr_glResizeBuffersMESA)this->m_ptr_glResizeBuffersMESA = (FunctionTable::MEMBERPFNGLRESIZEBUFFERSMESAPROC)&ProfilingTableDecorator::m_glResizeBuffersMESA_profiling;
+if(this->m_ptr_glGetMinmaxParameterfv)this->m_ptr_glGetMinmaxParameterfv = (FunctionTable::MEMBERPFNGLGETMINMAXPARAMETERFVPROC)&ProfilingTableDecorator::m_glGetMinmaxParameterfv_profiling;
+if(this->m_ptr_glClientActiveTextureARB)this->m_ptr_glClientActiveTextureARB = (FunctionTable::MEMBERPFNGLCLIENTACTIVETEXTUREARBPROC)&ProfilingTableDecorator::m_glClientActiveTextureARB_profiling;
+if(this->m_ptr_glBindVertexArray)this->m_ptr_glBindVertexArray = (FunctionTable::MEMBERPFNGLBINDVERTEXARRAYPROC)&ProfilingTableDecorator::m_glBindVertexArray_profiling;
+if(this->m_ptr_glColor4b)this->m_ptr_glColor4b = (FunctionTable::MEMBERPFNGLCOLOR4BPROC)&ProfilingTableDecorator::m_glColor4b_profiling;
+if(this->m_ptr_glColor4f)this->m_ptr_glColor4f = (FunctionTable::MEMBERPFNGLCOLOR4FPROC)&ProfilingTableDecorator::m_glColor4f_profiling;
+if(this->m_ptr_glColor4d)this->m_ptr_glColor4d = (FunctionTable::MEMBERPFNGLCOLOR4DPROC)&ProfilingTableDecorator::m_glColor4d_profiling;
+if(this->m_ptr_glColor4i)this->m_ptr_glColor4i = (FunctionTable::MEMBERPFNGLCOLOR4IPROC)&ProfilingTableDecorator::m_glColor4i_profiling;
+if(this->m_ptr_glEdgeFlagFormatNV)this->m_ptr_glEdgeFlagFormatNV = (FunctionTable::MEMBERPFNGLEDGEFLAGFORMATNVPROC)&ProfilingTableDecorator::m_glEdgeFlagFormatNV_profiling;
+if(this->m_ptr_glNamedBufferSubData)this->m_ptr_glNamedBufferSubData = (FunctionTable::MEMBERPFNGLNAMEDBUFFERSUBDATAPROC)&ProfilingTableDecorator::m_glNamedBufferSubData_profiling;
+if(this->m_ptr_glDrawElementsInstanced)this->m_ptr_glDrawElementsInstanced = (FunctionTable::MEMBERPFNGLDRAWELEMENTSINSTANCEDPROC)&ProfilingTableDecorator::m_glDrawElementsInstanced_profiling;
+if(this->m_ptr_glGetMultiTexParameterIivEXT)this->m_ptr_glGetMultiTexParameterIivEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXPARAMETERIIVEXTPROC)&ProfilingTableDecorator::m_glGetMultiTexParameterIivEXT_profiling;
+if(this->m_ptr_glVertex2dv)this->m_ptr_glVertex2dv = (FunctionTable::MEMBERPFNGLVERTEX2DVPROC)&ProfilingTableDecorator::m_glVertex2dv_profiling;
+if(this->m_ptr_glDisableVertexArrayAttribEXT)this->m_ptr_glDisableVertexArrayAttribEXT = (FunctionTable::MEMBERPFNGLDISABLEVERTEXARRAYATTRIBEXTPROC)&ProfilingTableDecorator::m_glDisableVertexArrayAttribEXT_profiling;
+if(this->m_ptr_glObjectUnpurgeableAPPLE)this->m_ptr_glObjectUnpurgeableAPPLE = (FunctionTable::MEMBERPFNGLOBJECTUNPURGEABLEAPPLEPROC)&ProfilingTableDecorator::m_glObjectUnpurgeableAPPLE_profiling;
+if(this->m_ptr_glVertexAttribs2dvNV)this->m_ptr_glVertexAttribs2dvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS2DVNVPROC)&ProfilingTableDecorator::m_glVertexAttribs2dvNV_profiling;
+if(this->m_ptr_glReplacementCodeuiTexCoord2fVertex3fSUN)this->m_ptr_glReplacementCodeuiTexCoord2fVertex3fSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUITEXCOORD2FVERTEX3FSUNPROC)&ProfilingTableDecorator::m_glReplacementCodeuiTexCoord2fVertex3fSUN_profiling;
+if(this->m_ptr_glGetMapParameterfvNV)this->m_ptr_glGetMapParameterfvNV = (FunctionTable::MEMBERPFNGLGETMAPPARAMETERFVNVPROC)&ProfilingTableDecorator::m_glGetMapParameterfvNV_profiling;
+if(this->m_ptr_glProgramUniform4ivEXT)this->m_ptr_glProgramUniform4ivEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4IVEXTPROC)&ProfilingTableDecorator::m_glProgramUniform4ivEXT_profiling;
+if(this->m_ptr_glProgramUniform3ui64vNV)this->m_ptr_glProgramUniform3ui64vNV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UI64VNVPROC)&ProfilingTableDecorator::m_glProgramUniform3ui64vNV_profiling;
+if(this->m_ptr_glRectfv)this->m_ptr_glRectfv = (FunctionTable::MEMBERPFNGLRECTFVPROC)&ProfilingTableDecorator::m_glRectfv_profiling;
+if(this->m_ptr_glTexFilterFuncSGIS)this->m_ptr_glTexFilterFuncSGIS = (FunctionTable::MEMBERPFNGLTEXFILTERFUNCSGISPROC)&ProfilingTableDecorator::m_glTexFilterFuncSGIS_profiling;
+if(this->m_ptr_glSpriteParameterfvSGIX)this->m_ptr_glSpriteParameterfvSGIX = (FunctionTable::MEMBERPFNGLSPRITEPARAMETERFVSGIXPROC)&ProfilingTableDecorator::m_glSpriteParameterfvSGIX_profiling;
+if(this->m_ptr_glCopyMultiTexImage1DEXT)this->m_ptr_glCopyMultiTexImage1DEXT = (FunctionTable::MEMBERPFNGLCOPYMULTITEXIMAGE1DEXTPROC)&ProfilingTableDecorator::m_glCopyMultiTexImage1DEXT_profiling;
+if(this->m_ptr_glGetVertexAttribIuivEXT)this->m_ptr_glGetVertexAttribIuivEXT = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBIUIVEXTPROC)&ProfilingTableDecorator::m_glGetVertexAttribIuivEXT_profiling;
+if(this->m_ptr_glUniformMatrix2x4dv)this->m_ptr_glUniformMatrix2x4dv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX2X4DVPROC)&ProfilingTableDecorator::m_glUniformMatrix2x4dv_profiling;
+if(this->m_ptr_glGetProgramResourceLocationIndex)this->m_ptr_glGetProgramResourceLocationIndex = (FunctionTable::MEMBERPFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC)&ProfilingTableDecorator::m_glGetProgramResourceLocationIndex_profiling;
+if(this->m_ptr_glColor3hNV)this->m_ptr_glColor3hNV = (FunctionTable::MEMBERPFNGLCOLOR3HNVPROC)&ProfilingTableDecorator::m_glColor3hNV_profiling;
+if(this->m_ptr_glViewport)this->m_ptr_glViewport = (FunctionTable::MEMBERPFNGLVIEWPORTPROC)&ProfilingTableDecorator::m_glViewport_profiling;
+if(this->m_ptr_glProgramNamedParameter4fNV)this->m_ptr_glProgramNamedParameter4fNV = (FunctionTable::MEMBERPFNGLPROGRAMNAMEDPARAMETER4FNVPROC)&ProfilingTableDecorator::m_glProgramNamedParameter4fNV_profiling;
+if(this->m_ptr_glGetInvariantBooleanvEXT)this->m_ptr_glGetInvariantBooleanvEXT = (FunctionTable::MEMBERPFNGLGETINVARIANTBOOLEANVEXTPROC)&ProfilingTableDecorator::m_glGetInvariantBooleanvEXT_profiling;
+if(this->m_ptr_glTexStorage2DMultisample)this->m_ptr_glTexStorage2DMultisample = (FunctionTable::MEMBERPFNGLTEXSTORAGE2DMULTISAMPLEPROC)&ProfilingTableDecorator::m_glTexStorage2DMultisample_profiling;
+if(this->m_ptr_glPixelStorex)this->m_ptr_glPixelStorex = (FunctionTable::MEMBERPFNGLPIXELSTOREXPROC)&ProfilingTableDecorator::m_glPixelStorex_profiling;
+if(this->m_ptr_glVertexAttribL1dvEXT)this->m_ptr_glVertexAttribL1dvEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL1DVEXTPROC)&ProfilingTableDecorator::m_glVertexAttribL1dvEXT_profiling;
+if(this->m_ptr_glGetActiveSubroutineUniformiv)this->m_ptr_glGetActiveSubroutineUniformiv = (FunctionTable::MEMBERPFNGLGETACTIVESUBROUTINEUNIFORMIVPROC)&ProfilingTableDecorator::m_glGetActiveSubroutineUniformiv_profiling;
+if(this->m_ptr_glVertexAttribPointerARB)this->m_ptr_glVertexAttribPointerARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIBPOINTERARBPROC)&ProfilingTableDecorator::m_glVertexAttribPointerARB_profiling;
+if(this->m_ptr_glCompressedTexSubImage2DARB)this->m_ptr_glCompressedTexSubImage2DARB = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXSUBIMAGE2DARBPROC)&ProfilingTableDecorator::m_glCompressedTexSubImage2DARB_profiling;
+if(this->m_ptr_glVertex2hvNV)this->m_ptr_glVertex2hvNV = (FunctionTable::MEMBERPFNGLVERTEX2HVNVPROC)&ProfilingTableDecorator::m_glVertex2hvNV_profiling;
+if(this->m_ptr_glTexBuffer)this->m_ptr_glTexBuffer = (FunctionTable::MEMBERPFNGLTEXBUFFERPROC)&ProfilingTableDecorator::m_glTexBuffer_profiling;
+if(this->m_ptr_glArrayElement)this->m_ptr_glArrayElement = (FunctionTable::MEMBERPFNGLARRAYELEMENTPROC)&ProfilingTableDecorator::m_glArrayElement_profiling;
+if(this->m_ptr_glValidateProgram)this->m_ptr_glValidateProgram = (FunctionTable::MEMBERPFNGLVALIDATEPROGRAMPROC)&ProfilingTableDecorator::m_glValidateProgram_profiling;
+if(this->m_ptr_glPixelStoref)this->m_ptr_glPixelStoref = (FunctionTable::MEMBERPFNGLPIXELSTOREFPROC)&ProfilingTableDecorator::m_glPixelStoref_profiling;
+if(this->m_ptr_glWindowPos3dARB)this->m_ptr_glWindowPos3dARB = (FunctionTable::MEMBERPFNGLWINDOWPOS3DARBPROC)&ProfilingTableDecorator::m_glWindowPos3dARB_profiling;
+if(this->m_ptr_glEvalCoord1dv)this->m_ptr_glEvalCoord1dv = (FunctionTable::MEMBERPFNGLEVALCOORD1DVPROC)&ProfilingTableDecorator::m_glEvalCoord1dv_profiling;
+if(this->m_ptr_glVertexAttribs2fvNV)this->m_ptr_glVertexAttribs2fvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS2FVNVPROC)&ProfilingTableDecorator::m_glVertexAttribs2fvNV_profiling;
+if(this->m_ptr_glRecti)this->m_ptr_glRecti = (FunctionTable::MEMBERPFNGLRECTIPROC)&ProfilingTableDecorator::m_glRecti_profiling;
+if(this->m_ptr_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN)this->m_ptr_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUITEXCOORD2FCOLOR4FNORMAL3FVERTEX3FVSUNPROC)&ProfilingTableDecorator::m_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN_profiling;
+if(this->m_ptr_glTexCoord1bOES)this->m_ptr_glTexCoord1bOES = (FunctionTable::MEMBERPFNGLTEXCOORD1BOESPROC)&ProfilingTableDecorator::m_glTexCoord1bOES_profiling;
+if(this->m_ptr_glProgramUniform2i64vARB)this->m_ptr_glProgramUniform2i64vARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2I64VARBPROC)&ProfilingTableDecorator::m_glProgramUniform2i64vARB_profiling;
+if(this->m_ptr_glWindowPos2dARB)this->m_ptr_glWindowPos2dARB = (FunctionTable::MEMBERPFNGLWINDOWPOS2DARBPROC)&ProfilingTableDecorator::m_glWindowPos2dARB_profiling;
+if(this->m_ptr_glGetProgramParameterdvNV)this->m_ptr_glGetProgramParameterdvNV = (FunctionTable::MEMBERPFNGLGETPROGRAMPARAMETERDVNVPROC)&ProfilingTableDecorator::m_glGetProgramParameterdvNV_profiling;
+if(this->m_ptr_glRectf)this->m_ptr_glRectf = (FunctionTable::MEMBERPFNGLRECTFPROC)&ProfilingTableDecorator::m_glRectf_profiling;
+if(this->m_ptr_glRectd)this->m_ptr_glRectd = (FunctionTable::MEMBERPFNGLRECTDPROC)&ProfilingTableDecorator::m_glRectd_profiling;
+if(this->m_ptr_glMap1xOES)this->m_ptr_glMap1xOES = (FunctionTable::MEMBERPFNGLMAP1XOESPROC)&ProfilingTableDecorator::m_glMap1xOES_profiling;
+if(this->m_ptr_glVertexAttrib3fvNV)this->m_ptr_glVertexAttrib3fvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3FVNVPROC)&ProfilingTableDecorator::m_glVertexAttrib3fvNV_profiling;
+if(this->m_ptr_glReferencePlaneSGIX)this->m_ptr_glReferencePlaneSGIX = (FunctionTable::MEMBERPFNGLREFERENCEPLANESGIXPROC)&ProfilingTableDecorator::m_glReferencePlaneSGIX_profiling;
+if(this->m_ptr_glGetMultiTexGendvEXT)this->m_ptr_glGetMultiTexGendvEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXGENDVEXTPROC)&ProfilingTableDecorator::m_glGetMultiTexGendvEXT_profiling;
+if(this->m_ptr_glGetCombinerInputParameterfvNV)this->m_ptr_glGetCombinerInputParameterfvNV = (FunctionTable::MEMBERPFNGLGETCOMBINERINPUTPARAMETERFVNVPROC)&ProfilingTableDecorator::m_glGetCombinerInputParameterfvNV_profiling;
+if(this->m_ptr_glGetTextureSamplerHandleARB)this->m_ptr_glGetTextureSamplerHandleARB = (FunctionTable::MEMBERPFNGLGETTEXTURESAMPLERHANDLEARBPROC)&ProfilingTableDecorator::m_glGetTextureSamplerHandleARB_profiling;
+if(this->m_ptr_glBindTexture)this->m_ptr_glBindTexture = (FunctionTable::MEMBERPFNGLBINDTEXTUREPROC)&ProfilingTableDecorator::m_glBindTexture_profiling;
+if(this->m_ptr_glRects)this->m_ptr_glRects = (FunctionTable::MEMBERPFNGLRECTSPROC)&ProfilingTableDecorator::m_glRects_profiling;
+if(this->m_ptr_glGetActiveAttribARB)this->m_ptr_glGetActiveAttribARB = (FunctionTable::MEMBERPFNGLGETACTIVEATTRIBARBPROC)&ProfilingTableDecorator::m_glGetActiveAttribARB_profiling;
+if(this->m_ptr_glHistogramEXT)this->m_ptr_glHistogramEXT = (FunctionTable::MEMBERPFNGLHISTOGRAMEXTPROC)&ProfilingTableDecorator::m_glHistogramEXT_profiling;
+if(this->m_ptr_glGetTextureSamplerHandleNV)this->m_ptr_glGetTextureSamplerHandleNV = (FunctionTable::MEMBERPFNGLGETTEXTURESAMPLERHANDLENVPROC)&ProfilingTableDecorator::m_glGetTextureSamplerHandleNV_profiling;
+if(this->m_ptr_glDetachShader)this->m_ptr_glDetachShader = (FunctionTable::MEMBERPFNGLDETACHSHADERPROC)&ProfilingTableDecorator::m_glDetachShader_profiling;
+if(this->m_ptr_glFinishTextureSUNX)this->m_ptr_glFinishTextureSUNX = (FunctionTable::MEMBERPFNGLFINISHTEXTURESUNXPROC)&ProfilingTableDecorator::m_glFinishTextureSUNX_profiling;
+if(this->m_ptr_glUniformMatrix3x4dv)this->m_ptr_glUniformMatrix3x4dv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX3X4DVPROC)&ProfilingTableDecorator::m_glUniformMatrix3x4dv_profiling;
+if(this->m_ptr_glVertexAttrib4fARB)this->m_ptr_glVertexAttrib4fARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4FARBPROC)&ProfilingTableDecorator::m_glVertexAttrib4fARB_profiling;
+if(this->m_ptr_glGetPathColorGenivNV)this->m_ptr_glGetPathColorGenivNV = (FunctionTable::MEMBERPFNGLGETPATHCOLORGENIVNVPROC)&ProfilingTableDecorator::m_glGetPathColorGenivNV_profiling;
+if(this->m_ptr_glGetProgramResourceLocation)this->m_ptr_glGetProgramResourceLocation = (FunctionTable::MEMBERPFNGLGETPROGRAMRESOURCELOCATIONPROC)&ProfilingTableDecorator::m_glGetProgramResourceLocation_profiling;
+if(this->m_ptr_glVertexArrayAttribLFormat)this->m_ptr_glVertexArrayAttribLFormat = (FunctionTable::MEMBERPFNGLVERTEXARRAYATTRIBLFORMATPROC)&ProfilingTableDecorator::m_glVertexArrayAttribLFormat_profiling;
+if(this->m_ptr_glGetTexLevelParameterfv)this->m_ptr_glGetTexLevelParameterfv = (FunctionTable::MEMBERPFNGLGETTEXLEVELPARAMETERFVPROC)&ProfilingTableDecorator::m_glGetTexLevelParameterfv_profiling;
+if(this->m_ptr_glVertexArrayVertexAttribOffsetEXT)this->m_ptr_glVertexArrayVertexAttribOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBOFFSETEXTPROC)&ProfilingTableDecorator::m_glVertexArrayVertexAttribOffsetEXT_profiling;
+if(this->m_ptr_glIndexFormatNV)this->m_ptr_glIndexFormatNV = (FunctionTable::MEMBERPFNGLINDEXFORMATNVPROC)&ProfilingTableDecorator::m_glIndexFormatNV_profiling;
+if(this->m_ptr_glMultiTexCoord3i)this->m_ptr_glMultiTexCoord3i = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3IPROC)&ProfilingTableDecorator::m_glMultiTexCoord3i_profiling;
+if(this->m_ptr_glReplacementCodeuiVertex3fvSUN)this->m_ptr_glReplacementCodeuiVertex3fvSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUIVERTEX3FVSUNPROC)&ProfilingTableDecorator::m_glReplacementCodeuiVertex3fvSUN_profiling;
+if(this->m_ptr_glViewportIndexedfv)this->m_ptr_glViewportIndexedfv = (FunctionTable::MEMBERPFNGLVIEWPORTINDEXEDFVPROC)&ProfilingTableDecorator::m_glViewportIndexedfv_profiling;
+if(this->m_ptr_glBindBuffersBase)this->m_ptr_glBindBuffersBase = (FunctionTable::MEMBERPFNGLBINDBUFFERSBASEPROC)&ProfilingTableDecorator::m_glBindBuffersBase_profiling;
+if(this->m_ptr_glTexBumpParameterfvATI)this->m_ptr_glTexBumpParameterfvATI = (FunctionTable::MEMBERPFNGLTEXBUMPPARAMETERFVATIPROC)&ProfilingTableDecorator::m_glTexBumpParameterfvATI_profiling;
+if(this->m_ptr_glMatrixIndexuivARB)this->m_ptr_glMatrixIndexuivARB = (FunctionTable::MEMBERPFNGLMATRIXINDEXUIVARBPROC)&ProfilingTableDecorator::m_glMatrixIndexuivARB_profiling;
+if(this->m_ptr_glVertexAttrib1hNV)this->m_ptr_glVertexAttrib1hNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1HNVPROC)&ProfilingTableDecorator::m_glVertexAttrib1hNV_profiling;
+if(this->m_ptr_glWindowPos3svMESA)this->m_ptr_glWindowPos3svMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS3SVMESAPROC)&ProfilingTableDecorator::m_glWindowPos3svMESA_profiling;
+if(this->m_ptr_glStencilOpSeparateATI)this->m_ptr_glStencilOpSeparateATI = (FunctionTable::MEMBERPFNGLSTENCILOPSEPARATEATIPROC)&ProfilingTableDecorator::m_glStencilOpSeparateATI_profiling;
+if(this->m_ptr_glDrawElementsBaseVertex)this->m_ptr_glDrawElementsBaseVertex = (FunctionTable::MEMBERPFNGLDRAWELEMENTSBASEVERTEXPROC)&ProfilingTableDecorator::m_glDrawElementsBaseVertex_profiling;
+if(this->m_ptr_glBlendEquationSeparateiARB)this->m_ptr_glBlendEquationSeparateiARB = (FunctionTable::MEMBERPFNGLBLENDEQUATIONSEPARATEIARBPROC)&ProfilingTableDecorator::m_glBlendEquationSeparateiARB_profiling;
+if(this->m_ptr_glVertexAttrib1fNV)this->m_ptr_glVertexAttrib1fNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1FNVPROC)&ProfilingTableDecorator::m_glVertexAttrib1fNV_profiling;
+if(this->m_ptr_glMapVertexAttrib2fAPPLE)this->m_ptr_glMapVertexAttrib2fAPPLE = (FunctionTable::MEMBERPFNGLMAPVERTEXATTRIB2FAPPLEPROC)&ProfilingTableDecorator::m_glMapVertexAttrib2fAPPLE_profiling;
+if(this->m_ptr_glCompressedTextureSubImage1DEXT)this->m_ptr_glCompressedTextureSubImage1DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTURESUBIMAGE1DEXTPROC)&ProfilingTableDecorator::m_glCompressedTextureSubImage1DEXT_profiling;
+if(this->m_ptr_glClearBufferSubData)this->m_ptr_glClearBufferSubData = (FunctionTable::MEMBERPFNGLCLEARBUFFERSUBDATAPROC)&ProfilingTableDecorator::m_glClearBufferSubData_profiling;
+if(this->m_ptr_glTexStorage1D)this->m_ptr_glTexStorage1D = (FunctionTable::MEMBERPFNGLTEXSTORAGE1DPROC)&ProfilingTableDecorator::m_glTexStorage1D_profiling;
+if(this->m_ptr_glVertexAttribI3iEXT)this->m_ptr_glVertexAttribI3iEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI3IEXTPROC)&ProfilingTableDecorator::m_glVertexAttribI3iEXT_profiling;
+if(this->m_ptr_glMakeTextureHandleNonResidentARB)this->m_ptr_glMakeTextureHandleNonResidentARB = (FunctionTable::MEMBERPFNGLMAKETEXTUREHANDLENONRESIDENTARBPROC)&ProfilingTableDecorator::m_glMakeTextureHandleNonResidentARB_profiling;
+if(this->m_ptr_glMultiDrawElementArrayAPPLE)this->m_ptr_glMultiDrawElementArrayAPPLE = (FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTARRAYAPPLEPROC)&ProfilingTableDecorator::m_glMultiDrawElementArrayAPPLE_profiling;
+if(this->m_ptr_glVertexStream4dATI)this->m_ptr_glVertexStream4dATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM4DATIPROC)&ProfilingTableDecorator::m_glVertexStream4dATI_profiling;
+if(this->m_ptr_glProgramUniformMatrix2dvEXT)this->m_ptr_glProgramUniformMatrix2dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2DVEXTPROC)&ProfilingTableDecorator::m_glProgramUniformMatrix2dvEXT_profiling;
+if(this->m_ptr_glVertexAttribs2hvNV)this->m_ptr_glVertexAttribs2hvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS2HVNVPROC)&ProfilingTableDecorator::m_glVertexAttribs2hvNV_profiling;
+if(this->m_ptr_glGetUniformiv)this->m_ptr_glGetUniformiv = (FunctionTable::MEMBERPFNGLGETUNIFORMIVPROC)&ProfilingTableDecorator::m_glGetUniformiv_profiling;
+if(this->m_ptr_glClipPlanefOES)this->m_ptr_glClipPlanefOES = (FunctionTable::MEMBERPFNGLCLIPPLANEFOESPROC)&ProfilingTableDecorator::m_glClipPlanefOES_profiling;
+if(this->m_ptr_glRenderbufferStorage)this->m_ptr_glRenderbufferStorage = (FunctionTable::MEMBERPFNGLRENDERBUFFERSTORAGEPROC)&ProfilingTableDecorator::m_glRenderbufferStorage_profiling;
+if(this->m_ptr_glUniform4ui)this->m_ptr_glUniform4ui = (FunctionTable::MEMBERPFNGLUNIFORM4UIPROC)&ProfilingTableDecorator::m_glUniform4ui_profiling;
+if(this->m_ptr_glBindFramebuffer)this->m_ptr_glBindFramebuffer = (FunctionTable::MEMBERPFNGLBINDFRAMEBUFFERPROC)&ProfilingTableDecorator::m_glBindFramebuffer_profiling;
+if(this->m_ptr_glValidateProgramARB)this->m_ptr_glValidateProgramARB = (FunctionTable::MEMBERPFNGLVALIDATEPROGRAMARBPROC)&ProfilingTableDecorator::m_glValidateProgramARB_profiling;
+if(this->m_ptr_glTexGenf)this->m_ptr_glTexGenf = (FunctionTable::MEMBERPFNGLTEXGENFPROC)&ProfilingTableDecorator::m_glTexGenf_profiling;
+if(this->m_ptr_glTexGend)this->m_ptr_glTexGend = (FunctionTable::MEMBERPFNGLTEXGENDPROC)&ProfilingTableDecorator::m_glTexGend_profiling;
+if(this->m_ptr_glTexGeni)this->m_ptr_glTexGeni = (FunctionTable::MEMBERPFNGLTEXGENIPROC)&ProfilingTableDecorator::m_glTexGeni_profiling;
+if(this->m_ptr_glDeleteFramebuffersEXT)this->m_ptr_glDeleteFramebuffersEXT = (FunctionTable::MEMBERPFNGLDELETEFRAMEBUFFERSEXTPROC)&ProfilingTableDecorator::m_glDeleteFramebuffersEXT_profiling;
+if(this->m_ptr_glResetMinmaxEXT)this->m_ptr_glResetMinmaxEXT = (FunctionTable::MEMBERPFNGLRESETMINMAXEXTPROC)&ProfilingTableDecorator::m_glResetMinmaxEXT_profiling;
+if(this->m_ptr_glVertexAttrib1fvNV)this->m_ptr_glVertexAttrib1fvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1FVNVPROC)&ProfilingTableDecorator::m_glVertexAttrib1fvNV_profiling;
+if(this->m_ptr_glIsQueryARB)this->m_ptr_glIsQueryARB = (FunctionTable::MEMBERPFNGLISQUERYARBPROC)&ProfilingTableDecorator::m_glIsQueryARB_profiling;
+if(this->m_ptr_glEnableVariantClientStateEXT)this->m_ptr_glEnableVariantClientStateEXT = (FunctionTable::MEMBERPFNGLENABLEVARIANTCLIENTSTATEEXTPROC)&ProfilingTableDecorator::m_glEnableVariantClientStateEXT_profiling;
+if(this->m_ptr_glScissorIndexed)this->m_ptr_glScissorIndexed = (FunctionTable::MEMBERPFNGLSCISSORINDEXEDPROC)&ProfilingTableDecorator::m_glScissorIndexed_profiling;
+if(this->m_ptr_glGetInvariantIntegervEXT)this->m_ptr_glGetInvariantIntegervEXT = (FunctionTable::MEMBERPFNGLGETINVARIANTINTEGERVEXTPROC)&ProfilingTableDecorator::m_glGetInvariantIntegervEXT_profiling;
+if(this->m_ptr_glProgramLocalParameterI4uiNV)this->m_ptr_glProgramLocalParameterI4uiNV = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERI4UINVPROC)&ProfilingTableDecorator::m_glProgramLocalParameterI4uiNV_profiling;
+if(this->m_ptr_glConvolutionParameterxvOES)this->m_ptr_glConvolutionParameterxvOES = (FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERXVOESPROC)&ProfilingTableDecorator::m_glConvolutionParameterxvOES_profiling;
+if(this->m_ptr_glGenFramebuffersEXT)this->m_ptr_glGenFramebuffersEXT = (FunctionTable::MEMBERPFNGLGENFRAMEBUFFERSEXTPROC)&ProfilingTableDecorator::m_glGenFramebuffersEXT_profiling;
+if(this->m_ptr_glVertexArrayColorOffsetEXT)this->m_ptr_glVertexArrayColorOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYCOLOROFFSETEXTPROC)&ProfilingTableDecorator::m_glVertexArrayColorOffsetEXT_profiling;
+if(this->m_ptr_glMultiTexCoord3ivARB)this->m_ptr_glMultiTexCoord3ivARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3IVARBPROC)&ProfilingTableDecorator::m_glMultiTexCoord3ivARB_profiling;
+if(this->m_ptr_glVertexWeightfEXT)this->m_ptr_glVertexWeightfEXT = (FunctionTable::MEMBERPFNGLVERTEXWEIGHTFEXTPROC)&ProfilingTableDecorator::m_glVertexWeightfEXT_profiling;
+if(this->m_ptr_glRasterPos4dv)this->m_ptr_glRasterPos4dv = (FunctionTable::MEMBERPFNGLRASTERPOS4DVPROC)&ProfilingTableDecorator::m_glRasterPos4dv_profiling;
+if(this->m_ptr_glIsTextureHandleResidentARB)this->m_ptr_glIsTextureHandleResidentARB = (FunctionTable::MEMBERPFNGLISTEXTUREHANDLERESIDENTARBPROC)&ProfilingTableDecorator::m_glIsTextureHandleResidentARB_profiling;
+if(this->m_ptr_glRasterPos2dv)this->m_ptr_glRasterPos2dv = (FunctionTable::MEMBERPFNGLRASTERPOS2DVPROC)&ProfilingTableDecorator::m_glRasterPos2dv_profiling;
+if(this->m_ptr_glWindowPos4ivMESA)this->m_ptr_glWindowPos4ivMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS4IVMESAPROC)&ProfilingTableDecorator::m_glWindowPos4ivMESA_profiling;
+if(this->m_ptr_glGetVariantPointervEXT)this->m_ptr_glGetVariantPointervEXT = (FunctionTable::MEMBERPFNGLGETVARIANTPOINTERVEXTPROC)&ProfilingTableDecorator::m_glGetVariantPointervEXT_profiling;
+if(this->m_ptr_glMapNamedBufferRangeEXT)this->m_ptr_glMapNamedBufferRangeEXT = (FunctionTable::MEMBERPFNGLMAPNAMEDBUFFERRANGEEXTPROC)&ProfilingTableDecorator::m_glMapNamedBufferRangeEXT_profiling;
+if(this->m_ptr_glGetnUniformui64vARB)this->m_ptr_glGetnUniformui64vARB = (FunctionTable::MEMBERPFNGLGETNUNIFORMUI64VARBPROC)&ProfilingTableDecorator::m_glGetnUniformui64vARB_profiling;
+if(this->m_ptr_glCreateShaderProgramv)this->m_ptr_glCreateShaderProgramv = (FunctionTable::MEMBERPFNGLCREATESHADERPROGRAMVPROC)&ProfilingTableDecorator::m_glCreateShaderProgramv_profiling;
+if(this->m_ptr_glGetQueryObjectiv)this->m_ptr_glGetQueryObjectiv = (FunctionTable::MEMBERPFNGLGETQUERYOBJECTIVPROC)&ProfilingTableDecorator::m_glGetQueryObjectiv_profiling;
+if(this->m_ptr_glPNTrianglesfATI)this->m_ptr_glPNTrianglesfATI = (FunctionTable::MEMBERPFNGLPNTRIANGLESFATIPROC)&ProfilingTableDecorator::m_glPNTrianglesfATI_profiling;
+if(this->m_ptr_glGlobalAlphaFactorusSUN)this->m_ptr_glGlobalAlphaFactorusSUN = (FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORUSSUNPROC)&ProfilingTableDecorator::m_glGlobalAlphaFactorusSUN_profiling;
+if(this->m_ptr_glVertexAttrib3dvNV)this->m_ptr_glVertexAttrib3dvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3DVNVPROC)&ProfilingTableDecorator::m_glVertexAttrib3dvNV_profiling;
+if(this->m_ptr_glMultiTexCoord3sARB)this->m_ptr_glMultiTexCoord3sARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3SARBPROC)&ProfilingTableDecorator::m_glMultiTexCoord3sARB_profiling;
+if(this->m_ptr_glGenerateMipmap)this->m_ptr_glGenerateMipmap = (FunctionTable::MEMBERPFNGLGENERATEMIPMAPPROC)&ProfilingTableDecorator::m_glGenerateMipmap_profiling;
+if(this->m_ptr_glCompressedTextureSubImage2D)this->m_ptr_glCompressedTextureSubImage2D = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC)&ProfilingTableDecorator::m_glCompressedTextureSubImage2D_profiling;
+if(this->m_ptr_glNamedRenderbufferStorageMultisampleEXT)this->m_ptr_glNamedRenderbufferStorageMultisampleEXT = (FunctionTable::MEMBERPFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEEXTPROC)&ProfilingTableDecorator::m_glNamedRenderbufferStorageMultisampleEXT_profiling;
+if(this->m_ptr_glPolygonOffsetClampEXT)this->m_ptr_glPolygonOffsetClampEXT = (FunctionTable::MEMBERPFNGLPOLYGONOFFSETCLAMPEXTPROC)&ProfilingTableDecorator::m_glPolygonOffsetClampEXT_profiling;
+if(this->m_ptr_glTextureRangeAPPLE)this->m_ptr_glTextureRangeAPPLE = (FunctionTable::MEMBERPFNGLTEXTURERANGEAPPLEPROC)&ProfilingTableDecorator::m_glTextureRangeAPPLE_profiling;
+if(this->m_ptr_glBlendEquationIndexedAMD)this->m_ptr_glBlendEquationIndexedAMD = (FunctionTable::MEMBERPFNGLBLENDEQUATIONINDEXEDAMDPROC)&ProfilingTableDecorator::m_glBlendEquationIndexedAMD_profiling;
+if(this->m_ptr_glTexCoord2d)this->m_ptr_glTexCoord2d = (FunctionTable::MEMBERPFNGLTEXCOORD2DPROC)&ProfilingTableDecorator::m_glTexCoord2d_profiling;
+if(this->m_ptr_glPointParameteri)this->m_ptr_glPointParameteri = (FunctionTable::MEMBERPFNGLPOINTPARAMETERIPROC)&ProfilingTableDecorator::m_glPointParameteri_profiling;
+if(this->m_ptr_glTexCoord2f)this->m_ptr_glTexCoord2f = (FunctionTable::MEMBERPFNGLTEXCOORD2FPROC)&ProfilingTableDecorator::m_glTexCoord2f_profiling;
+if(this->m_ptr_glColor4iv)this->m_ptr_glColor4iv = (FunctionTable::MEMBERPFNGLCOLOR4IVPROC)&ProfilingTableDecorator::m_glColor4iv_profiling;
+if(this->m_ptr_glMapNamedBufferRange)this->m_ptr_glMapNamedBufferRange = (FunctionTable::MEMBERPFNGLMAPNAMEDBUFFERRANGEPROC)&ProfilingTableDecorator::m_glMapNamedBufferRange_profiling;
+if(this->m_ptr_glUnmapBuffer)this->m_ptr_glUnmapBuffer = (FunctionTable::MEMBERPFNGLUNMAPBUFFERPROC)&ProfilingTableDecorator::m_glUnmapBuffer_profiling;
+if(this->m_ptr_glSampleMaskEXT)this->m_ptr_glSampleMaskEXT = (FunctionTable::MEMBERPFNGLSAMPLEMASKEXTPROC)&ProfilingTableDecorator::m_glSampleMaskEXT_profiling;
+if(this->m_ptr_glTexCoord2i)this->m_ptr_glTexCoord2i = (FunctionTable::MEMBERPFNGLTEXCOORD2IPROC)&ProfilingTableDecorator::m_glTexCoord2i_profiling;
+if(this->m_ptr_glTexCoord1xvOES)this->m_ptr_glTexCoord1xvOES = (FunctionTable::MEMBERPFNGLTEXCOORD1XVOESPROC)&ProfilingTableDecorator::m_glTexCoord1xvOES_profiling;
+if(this->m_ptr_glVertexAttrib1sARB)this->m_ptr_glVertexAttrib1sARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1SARBPROC)&ProfilingTableDecorator::m_glVertexAttrib1sARB_profiling;
+if(this->m_ptr_glGetVertexArrayiv)this->m_ptr_glGetVertexArrayiv = (FunctionTable::MEMBERPFNGLGETVERTEXARRAYIVPROC)&ProfilingTableDecorator::m_glGetVertexArrayiv_profiling;
+if(this->m_ptr_glProgramParameter4dvNV)this->m_ptr_glProgramParameter4dvNV = (FunctionTable::MEMBERPFNGLPROGRAMPARAMETER4DVNVPROC)&ProfilingTableDecorator::m_glProgramParameter4dvNV_profiling;
+if(this->m_ptr_glTexCoord2s)this->m_ptr_glTexCoord2s = (FunctionTable::MEMBERPFNGLTEXCOORD2SPROC)&ProfilingTableDecorator::m_glTexCoord2s_profiling;
+if(this->m_ptr_glTextureParameterIuivEXT)this->m_ptr_glTextureParameterIuivEXT = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIUIVEXTPROC)&ProfilingTableDecorator::m_glTextureParameterIuivEXT_profiling;
+if(this->m_ptr_glGetColorTableParameterfvSGI)this->m_ptr_glGetColorTableParameterfvSGI = (FunctionTable::MEMBERPFNGLGETCOLORTABLEPARAMETERFVSGIPROC)&ProfilingTableDecorator::m_glGetColorTableParameterfvSGI_profiling;
+if(this->m_ptr_glTexCoord4dv)this->m_ptr_glTexCoord4dv = (FunctionTable::MEMBERPFNGLTEXCOORD4DVPROC)&ProfilingTableDecorator::m_glTexCoord4dv_profiling;
+if(this->m_ptr_glVertexAttrib1svNV)this->m_ptr_glVertexAttrib1svNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1SVNVPROC)&ProfilingTableDecorator::m_glVertexAttrib1svNV_profiling;
+if(this->m_ptr_glNamedFramebufferTextureFaceEXT)this->m_ptr_glNamedFramebufferTextureFaceEXT = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTUREFACEEXTPROC)&ProfilingTableDecorator::m_glNamedFramebufferTextureFaceEXT_profiling;
+if(this->m_ptr_glProgramUniform2ui64vNV)this->m_ptr_glProgramUniform2ui64vNV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UI64VNVPROC)&ProfilingTableDecorator::m_glProgramUniform2ui64vNV_profiling;
+if(this->m_ptr_glNormal3dv)this->m_ptr_glNormal3dv = (FunctionTable::MEMBERPFNGLNORMAL3DVPROC)&ProfilingTableDecorator::m_glNormal3dv_profiling;
+if(this->m_ptr_glReleaseShaderCompiler)this->m_ptr_glReleaseShaderCompiler = (FunctionTable::MEMBERPFNGLRELEASESHADERCOMPILERPROC)&ProfilingTableDecorator::m_glReleaseShaderCompiler_profiling;
+if(this->m_ptr_glTexCoord3bvOES)this->m_ptr_glTexCoord3bvOES = (FunctionTable::MEMBERPFNGLTEXCOORD3BVOESPROC)&ProfilingTableDecorator::m_glTexCoord3bvOES_profiling;
+if(this->m_ptr_glIsVertexAttribEnabledAPPLE)this->m_ptr_glIsVertexAttribEnabledAPPLE = (FunctionTable::MEMBERPFNGLISVERTEXATTRIBENABLEDAPPLEPROC)&ProfilingTableDecorator::m_glIsVertexAttribEnabledAPPLE_profiling;
+if(this->m_ptr_glTexCoord1dv)this->m_ptr_glTexCoord1dv = (FunctionTable::MEMBERPFNGLTEXCOORD1DVPROC)&ProfilingTableDecorator::m_glTexCoord1dv_profiling;
+if(this->m_ptr_glReadPixels)this->m_ptr_glReadPixels = (FunctionTable::MEMBERPFNGLREADPIXELSPROC)&ProfilingTableDecorator::m_glReadPixels_profiling;
+if(this->m_ptr_glVertexAttribI3iv)this->m_ptr_glVertexAttribI3iv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI3IVPROC)&ProfilingTableDecorator::m_glVertexAttribI3iv_profiling;
+if(this->m_ptr_glSetFenceAPPLE)this->m_ptr_glSetFenceAPPLE = (FunctionTable::MEMBERPFNGLSETFENCEAPPLEPROC)&ProfilingTableDecorator::m_glSetFenceAPPLE_profiling;
+if(this->m_ptr_glWeightsvARB)this->m_ptr_glWeightsvARB = (FunctionTable::MEMBERPFNGLWEIGHTSVARBPROC)&ProfilingTableDecorator::m_glWeightsvARB_profiling;
+if(this->m_ptr_glShadeModel)this->m_ptr_glShadeModel = (FunctionTable::MEMBERPFNGLSHADEMODELPROC)&ProfilingTableDecorator::m_glShadeModel_profiling;
+if(this->m_ptr_glMapGrid1d)this->m_ptr_glMapGrid1d = (FunctionTable::MEMBERPFNGLMAPGRID1DPROC)&ProfilingTableDecorator::m_glMapGrid1d_profiling;
+if(this->m_ptr_glGetHistogramParameterivEXT)this->m_ptr_glGetHistogramParameterivEXT = (FunctionTable::MEMBERPFNGLGETHISTOGRAMPARAMETERIVEXTPROC)&ProfilingTableDecorator::m_glGetHistogramParameterivEXT_profiling;
+if(this->m_ptr_glConservativeRasterParameteriNV)this->m_ptr_glConservativeRasterParameteriNV = (FunctionTable::MEMBERPFNGLCONSERVATIVERASTERPARAMETERINVPROC)&ProfilingTableDecorator::m_glConservativeRasterParameteriNV_profiling;
+if(this->m_ptr_glClearNamedBufferData)this->m_ptr_glClearNamedBufferData = (FunctionTable::MEMBERPFNGLCLEARNAMEDBUFFERDATAPROC)&ProfilingTableDecorator::m_glClearNamedBufferData_profiling;
+if(this->m_ptr_glClearDepthf)this->m_ptr_glClearDepthf = (FunctionTable::MEMBERPFNGLCLEARDEPTHFPROC)&ProfilingTableDecorator::m_glClearDepthf_profiling;
+if(this->m_ptr_glCreatePerfQueryINTEL)this->m_ptr_glCreatePerfQueryINTEL = (FunctionTable::MEMBERPFNGLCREATEPERFQUERYINTELPROC)&ProfilingTableDecorator::m_glCreatePerfQueryINTEL_profiling;
+if(this->m_ptr_glFogCoordfEXT)this->m_ptr_glFogCoordfEXT = (FunctionTable::MEMBERPFNGLFOGCOORDFEXTPROC)&ProfilingTableDecorator::m_glFogCoordfEXT_profiling;
+if(this->m_ptr_glVertexAttrib2dARB)this->m_ptr_glVertexAttrib2dARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2DARBPROC)&ProfilingTableDecorator::m_glVertexAttrib2dARB_profiling;
+if(this->m_ptr_glMultiTexCoord4dARB)this->m_ptr_glMultiTexCoord4dARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4DARBPROC)&ProfilingTableDecorator::m_glMultiTexCoord4dARB_profiling;
+if(this->m_ptr_glReadnPixelsARB)this->m_ptr_glReadnPixelsARB = (FunctionTable::MEMBERPFNGLREADNPIXELSARBPROC)&ProfilingTableDecorator::m_glReadnPixelsARB_profiling;
+if(this->m_ptr_glMultiTexBufferEXT)this->m_ptr_glMultiTexBufferEXT = (FunctionTable::MEMBERPFNGLMULTITEXBUFFEREXTPROC)&ProfilingTableDecorator::m_glMultiTexBufferEXT_profiling;
+if(this->m_ptr_glWindowPos4dvMESA)this->m_ptr_glWindowPos4dvMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS4DVMESAPROC)&ProfilingTableDecorator::m_glWindowPos4dvMESA_profiling;
+if(this->m_ptr_glInvalidateNamedFramebufferData)this->m_ptr_glInvalidateNamedFramebufferData = (FunctionTable::MEMBERPFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC)&ProfilingTableDecorator::m_glInvalidateNamedFramebufferData_profiling;
+if(this->m_ptr_glSecondaryColorPointerListIBM)this->m_ptr_glSecondaryColorPointerListIBM = (FunctionTable::MEMBERPFNGLSECONDARYCOLORPOINTERLISTIBMPROC)&ProfilingTableDecorator::m_glSecondaryColorPointerListIBM_profiling;
+if(this->m_ptr_glRectiv)this->m_ptr_glRectiv = (FunctionTable::MEMBERPFNGLRECTIVPROC)&ProfilingTableDecorator::m_glRectiv_profiling;
+if(this->m_ptr_glColorP4ui)this->m_ptr_glColorP4ui = (FunctionTable::MEMBERPFNGLCOLORP4UIPROC)&ProfilingTableDecorator::m_glColorP4ui_profiling;
+if(this->m_ptr_glUseProgramStages)this->m_ptr_glUseProgramStages = (FunctionTable::MEMBERPFNGLUSEPROGRAMSTAGESPROC)&ProfilingTableDecorator::m_glUseProgramStages_profiling;
+if(this->m_ptr_glRasterPos3dv)this->m_ptr_glRasterPos3dv = (FunctionTable::MEMBERPFNGLRASTERPOS3DVPROC)&ProfilingTableDecorator::m_glRasterPos3dv_profiling;
+if(this->m_ptr_glPathTexGenNV)this->m_ptr_glPathTexGenNV = (FunctionTable::MEMBERPFNGLPATHTEXGENNVPROC)&ProfilingTableDecorator::m_glPathTexGenNV_profiling;
+if(this->m_ptr_glVertexBlendEnviATI)this->m_ptr_glVertexBlendEnviATI = (FunctionTable::MEMBERPFNGLVERTEXBLENDENVIATIPROC)&ProfilingTableDecorator::m_glVertexBlendEnviATI_profiling;
+if(this->m_ptr_glUniform3i64ARB)this->m_ptr_glUniform3i64ARB = (FunctionTable::MEMBERPFNGLUNIFORM3I64ARBPROC)&ProfilingTableDecorator::m_glUniform3i64ARB_profiling;
+if(this->m_ptr_glLoadMatrixf)this->m_ptr_glLoadMatrixf = (FunctionTable::MEMBERPFNGLLOADMATRIXFPROC)&ProfilingTableDecorator::m_glLoadMatrixf_profiling;
+if(this->m_ptr_glProgramUniform2dEXT)this->m_ptr_glProgramUniform2dEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2DEXTPROC)&ProfilingTableDecorator::m_glProgramUniform2dEXT_profiling;
+if(this->m_ptr_glVertexAttribI4iv)this->m_ptr_glVertexAttribI4iv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4IVPROC)&ProfilingTableDecorator::m_glVertexAttribI4iv_profiling;
+if(this->m_ptr_glNamedFramebufferDrawBuffer)this->m_ptr_glNamedFramebufferDrawBuffer = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC)&ProfilingTableDecorator::m_glNamedFramebufferDrawBuffer_profiling;
+if(this->m_ptr_glColor4ubv)this->m_ptr_glColor4ubv = (FunctionTable::MEMBERPFNGLCOLOR4UBVPROC)&ProfilingTableDecorator::m_glColor4ubv_profiling;
+if(this->m_ptr_glColor3hvNV)this->m_ptr_glColor3hvNV = (FunctionTable::MEMBERPFNGLCOLOR3HVNVPROC)&ProfilingTableDecorator::m_glColor3hvNV_profiling;
+if(this->m_ptr_glGetMapAttribParameterfvNV)this->m_ptr_glGetMapAttribParameterfvNV = (FunctionTable::MEMBERPFNGLGETMAPATTRIBPARAMETERFVNVPROC)&ProfilingTableDecorator::m_glGetMapAttribParameterfvNV_profiling;
+if(this->m_ptr_glGetBufferSubData)this->m_ptr_glGetBufferSubData = (FunctionTable::MEMBERPFNGLGETBUFFERSUBDATAPROC)&ProfilingTableDecorator::m_glGetBufferSubData_profiling;
+if(this->m_ptr_glGetVertexAttribLdv)this->m_ptr_glGetVertexAttribLdv = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBLDVPROC)&ProfilingTableDecorator::m_glGetVertexAttribLdv_profiling;
+if(this->m_ptr_glGetnUniformuiv)this->m_ptr_glGetnUniformuiv = (FunctionTable::MEMBERPFNGLGETNUNIFORMUIVPROC)&ProfilingTableDecorator::m_glGetnUniformuiv_profiling;
+if(this->m_ptr_glGetUniformui64vNV)this->m_ptr_glGetUniformui64vNV = (FunctionTable::MEMBERPFNGLGETUNIFORMUI64VNVPROC)&ProfilingTableDecorator::m_glGetUniformui64vNV_profiling;
+if(this->m_ptr_glNamedRenderbufferStorageEXT)this->m_ptr_glNamedRenderbufferStorageEXT = (FunctionTable::MEMBERPFNGLNAMEDRENDERBUFFERSTORAGEEXTPROC)&ProfilingTableDecorator::m_glNamedRenderbufferStorageEXT_profiling;
+if(this->m_ptr_glVertexAttrib3dNV)this->m_ptr_glVertexAttrib3dNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3DNVPROC)&ProfilingTableDecorator::m_glVertexAttrib3dNV_profiling;
+if(this->m_ptr_glTextureStorage1DEXT)this->m_ptr_glTextureStorage1DEXT = (FunctionTable::MEMBERPFNGLTEXTURESTORAGE1DEXTPROC)&ProfilingTableDecorator::m_glTextureStorage1DEXT_profiling;
+if(this->m_ptr_glPixelTexGenParameteriSGIS)this->m_ptr_glPixelTexGenParameteriSGIS = (FunctionTable::MEMBERPFNGLPIXELTEXGENPARAMETERISGISPROC)&ProfilingTableDecorator::m_glPixelTexGenParameteriSGIS_profiling;
+if(this->m_ptr_glColorTableEXT)this->m_ptr_glColorTableEXT = (FunctionTable::MEMBERPFNGLCOLORTABLEEXTPROC)&ProfilingTableDecorator::m_glColorTableEXT_profiling;
+if(this->m_ptr_glGenBuffers)this->m_ptr_glGenBuffers = (FunctionTable::MEMBERPFNGLGENBUFFERSPROC)&ProfilingTableDecorator::m_glGenBuffers_profiling;
+if(this->m_ptr_glMultiTexCoord3xvOES)this->m_ptr_glMultiTexCoord3xvOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3XVOESPROC)&ProfilingTableDecorator::m_glMultiTexCoord3xvOES_profiling;
+if(this->m_ptr_glExecuteProgramNV)this->m_ptr_glExecuteProgramNV = (FunctionTable::MEMBERPFNGLEXECUTEPROGRAMNVPROC)&ProfilingTableDecorator::m_glExecuteProgramNV_profiling;
+if(this->m_ptr_glVariantArrayObjectATI)this->m_ptr_glVariantArrayObjectATI = (FunctionTable::MEMBERPFNGLVARIANTARRAYOBJECTATIPROC)&ProfilingTableDecorator::m_glVariantArrayObjectATI_profiling;
+if(this->m_ptr_glColor3xvOES)this->m_ptr_glColor3xvOES = (FunctionTable::MEMBERPFNGLCOLOR3XVOESPROC)&ProfilingTableDecorator::m_glColor3xvOES_profiling;
+if(this->m_ptr_glGetnConvolutionFilterARB)this->m_ptr_glGetnConvolutionFilterARB = (FunctionTable::MEMBERPFNGLGETNCONVOLUTIONFILTERARBPROC)&ProfilingTableDecorator::m_glGetnConvolutionFilterARB_profiling;
+if(this->m_ptr_glNormalFormatNV)this->m_ptr_glNormalFormatNV = (FunctionTable::MEMBERPFNGLNORMALFORMATNVPROC)&ProfilingTableDecorator::m_glNormalFormatNV_profiling;
+if(this->m_ptr_glGetInvariantFloatvEXT)this->m_ptr_glGetInvariantFloatvEXT = (FunctionTable::MEMBERPFNGLGETINVARIANTFLOATVEXTPROC)&ProfilingTableDecorator::m_glGetInvariantFloatvEXT_profiling;
+if(this->m_ptr_glClearNamedFramebufferiv)this->m_ptr_glClearNamedFramebufferiv = (FunctionTable::MEMBERPFNGLCLEARNAMEDFRAMEBUFFERIVPROC)&ProfilingTableDecorator::m_glClearNamedFramebufferiv_profiling;
+if(this->m_ptr_glTexImage3D)this->m_ptr_glTexImage3D = (FunctionTable::MEMBERPFNGLTEXIMAGE3DPROC)&ProfilingTableDecorator::m_glTexImage3D_profiling;
+if(this->m_ptr_glGenSamplers)this->m_ptr_glGenSamplers = (FunctionTable::MEMBERPFNGLGENSAMPLERSPROC)&ProfilingTableDecorator::m_glGenSamplers_profiling;
+if(this->m_ptr_glIsFramebuffer)this->m_ptr_glIsFramebuffer = (FunctionTable::MEMBERPFNGLISFRAMEBUFFERPROC)&ProfilingTableDecorator::m_glIsFramebuffer_profiling;
+if(this->m_ptr_glProgramUniform3dvEXT)this->m_ptr_glProgramUniform3dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3DVEXTPROC)&ProfilingTableDecorator::m_glProgramUniform3dvEXT_profiling;
+if(this->m_ptr_glGetVertexAttribfvNV)this->m_ptr_glGetVertexAttribfvNV = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBFVNVPROC)&ProfilingTableDecorator::m_glGetVertexAttribfvNV_profiling;
+if(this->m_ptr_glDrawRangeElementArrayAPPLE)this->m_ptr_glDrawRangeElementArrayAPPLE = (FunctionTable::MEMBERPFNGLDRAWRANGEELEMENTARRAYAPPLEPROC)&ProfilingTableDecorator::m_glDrawRangeElementArrayAPPLE_profiling;
+if(this->m_ptr_glUniform3i64NV)this->m_ptr_glUniform3i64NV = (FunctionTable::MEMBERPFNGLUNIFORM3I64NVPROC)&ProfilingTableDecorator::m_glUniform3i64NV_profiling;
+if(this->m_ptr_glMatrixPopEXT)this->m_ptr_glMatrixPopEXT = (FunctionTable::MEMBERPFNGLMATRIXPOPEXTPROC)&ProfilingTableDecorator::m_glMatrixPopEXT_profiling;
+if(this->m_ptr_glVertexStream1sATI)this->m_ptr_glVertexStream1sATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM1SATIPROC)&ProfilingTableDecorator::m_glVertexStream1sATI_profiling;
+if(this->m_ptr_glGetnPixelMapuivARB)this->m_ptr_glGetnPixelMapuivARB = (FunctionTable::MEMBERPFNGLGETNPIXELMAPUIVARBPROC)&ProfilingTableDecorator::m_glGetnPixelMapuivARB_profiling;
+if(this->m_ptr_glMultiTexEnviEXT)this->m_ptr_glMultiTexEnviEXT = (FunctionTable::MEMBERPFNGLMULTITEXENVIEXTPROC)&ProfilingTableDecorator::m_glMultiTexEnviEXT_profiling;
+if(this->m_ptr_glVertexAttribI2iEXT)this->m_ptr_glVertexAttribI2iEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI2IEXTPROC)&ProfilingTableDecorator::m_glVertexAttribI2iEXT_profiling;
+if(this->m_ptr_glProgramParameter4fvNV)this->m_ptr_glProgramParameter4fvNV = (FunctionTable::MEMBERPFNGLPROGRAMPARAMETER4FVNVPROC)&ProfilingTableDecorator::m_glProgramParameter4fvNV_profiling;
+if(this->m_ptr_glNamedFramebufferSampleLocationsfvNV)this->m_ptr_glNamedFramebufferSampleLocationsfvNV = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERSAMPLELOCATIONSFVNVPROC)&ProfilingTableDecorator::m_glNamedFramebufferSampleLocationsfvNV_profiling;
+if(this->m_ptr_glTexCoordP4uiv)this->m_ptr_glTexCoordP4uiv = (FunctionTable::MEMBERPFNGLTEXCOORDP4UIVPROC)&ProfilingTableDecorator::m_glTexCoordP4uiv_profiling;
+if(this->m_ptr_glRectxvOES)this->m_ptr_glRectxvOES = (FunctionTable::MEMBERPFNGLRECTXVOESPROC)&ProfilingTableDecorator::m_glRectxvOES_profiling;
+if(this->m_ptr_glGetVariantIntegervEXT)this->m_ptr_glGetVariantIntegervEXT = (FunctionTable::MEMBERPFNGLGETVARIANTINTEGERVEXTPROC)&ProfilingTableDecorator::m_glGetVariantIntegervEXT_profiling;
+if(this->m_ptr_glDeleteLists)this->m_ptr_glDeleteLists = (FunctionTable::MEMBERPFNGLDELETELISTSPROC)&ProfilingTableDecorator::m_glDeleteLists_profiling;
+if(this->m_ptr_glTexGendv)this->m_ptr_glTexGendv = (FunctionTable::MEMBERPFNGLTEXGENDVPROC)&ProfilingTableDecorator::m_glTexGendv_profiling;
+if(this->m_ptr_glVertexP2uiv)this->m_ptr_glVertexP2uiv = (FunctionTable::MEMBERPFNGLVERTEXP2UIVPROC)&ProfilingTableDecorator::m_glVertexP2uiv_profiling;
+if(this->m_ptr_glGetPerfMonitorGroupsAMD)this->m_ptr_glGetPerfMonitorGroupsAMD = (FunctionTable::MEMBERPFNGLGETPERFMONITORGROUPSAMDPROC)&ProfilingTableDecorator::m_glGetPerfMonitorGroupsAMD_profiling;
+if(this->m_ptr_glMultTransposeMatrixfARB)this->m_ptr_glMultTransposeMatrixfARB = (FunctionTable::MEMBERPFNGLMULTTRANSPOSEMATRIXFARBPROC)&ProfilingTableDecorator::m_glMultTransposeMatrixfARB_profiling;
+if(this->m_ptr_glVertexAttribI2ivEXT)this->m_ptr_glVertexAttribI2ivEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI2IVEXTPROC)&ProfilingTableDecorator::m_glVertexAttribI2ivEXT_profiling;
+if(this->m_ptr_glReplacementCodeuiColor4fNormal3fVertex3fvSUN)this->m_ptr_glReplacementCodeuiColor4fNormal3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUICOLOR4FNORMAL3FVERTEX3FVSUNPROC)&ProfilingTableDecorator::m_glReplacementCodeuiColor4fNormal3fVertex3fvSUN_profiling;
+if(this->m_ptr_glDeleteStatesNV)this->m_ptr_glDeleteStatesNV = (FunctionTable::MEMBERPFNGLDELETESTATESNVPROC)&ProfilingTableDecorator::m_glDeleteStatesNV_profiling;
+if(this->m_ptr_glGetBufferParameteri64v)this->m_ptr_glGetBufferParameteri64v = (FunctionTable::MEMBERPFNGLGETBUFFERPARAMETERI64VPROC)&ProfilingTableDecorator::m_glGetBufferParameteri64v_profiling;
+if(this->m_ptr_glProgramUniform4dv)this->m_ptr_glProgramUniform4dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4DVPROC)&ProfilingTableDecorator::m_glProgramUniform4dv_profiling;
+if(this->m_ptr_glEdgeFlagPointerEXT)this->m_ptr_glEdgeFlagPointerEXT = (FunctionTable::MEMBERPFNGLEDGEFLAGPOINTEREXTPROC)&ProfilingTableDecorator::m_glEdgeFlagPointerEXT_profiling;
+if(this->m_ptr_glVideoCaptureStreamParameterivNV)this->m_ptr_glVideoCaptureStreamParameterivNV = (FunctionTable::MEMBERPFNGLVIDEOCAPTURESTREAMPARAMETERIVNVPROC)&ProfilingTableDecorator::m_glVideoCaptureStreamParameterivNV_profiling;
+if(this->m_ptr_glVertexStream4iATI)this->m_ptr_glVertexStream4iATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM4IATIPROC)&ProfilingTableDecorator::m_glVertexStream4iATI_profiling;
+if(this->m_ptr_glVDPAUFiniNV)this->m_ptr_glVDPAUFiniNV = (FunctionTable::MEMBERPFNGLVDPAUFININVPROC)&ProfilingTableDecorator::m_glVDPAUFiniNV_profiling;
+if(this->m_ptr_glMakeBufferNonResidentNV)this->m_ptr_glMakeBufferNonResidentNV = (FunctionTable::MEMBERPFNGLMAKEBUFFERNONRESIDENTNVPROC)&ProfilingTableDecorator::m_glMakeBufferNonResidentNV_profiling;
+if(this->m_ptr_glUniform1ui64ARB)this->m_ptr_glUniform1ui64ARB = (FunctionTable::MEMBERPFNGLUNIFORM1UI64ARBPROC)&ProfilingTableDecorator::m_glUniform1ui64ARB_profiling;
+if(this->m_ptr_glStencilStrokePathNV)this->m_ptr_glStencilStrokePathNV = (FunctionTable::MEMBERPFNGLSTENCILSTROKEPATHNVPROC)&ProfilingTableDecorator::m_glStencilStrokePathNV_profiling;
+if(this->m_ptr_glProgramUniform3uiv)this->m_ptr_glProgramUniform3uiv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UIVPROC)&ProfilingTableDecorator::m_glProgramUniform3uiv_profiling;
+if(this->m_ptr_glVariantuivEXT)this->m_ptr_glVariantuivEXT = (FunctionTable::MEMBERPFNGLVARIANTUIVEXTPROC)&ProfilingTableDecorator::m_glVariantuivEXT_profiling;
+if(this->m_ptr_glCopyTexSubImage3DEXT)this->m_ptr_glCopyTexSubImage3DEXT = (FunctionTable::MEMBERPFNGLCOPYTEXSUBIMAGE3DEXTPROC)&ProfilingTableDecorator::m_glCopyTexSubImage3DEXT_profiling;
+if(this->m_ptr_glSpriteParameteriSGIX)this->m_ptr_glSpriteParameteriSGIX = (FunctionTable::MEMBERPFNGLSPRITEPARAMETERISGIXPROC)&ProfilingTableDecorator::m_glSpriteParameteriSGIX_profiling;
+if(this->m_ptr_glMultiTexCoord1sARB)this->m_ptr_glMultiTexCoord1sARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1SARBPROC)&ProfilingTableDecorator::m_glMultiTexCoord1sARB_profiling;
+if(this->m_ptr_glConvolutionParameterfv)this->m_ptr_glConvolutionParameterfv = (FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERFVPROC)&ProfilingTableDecorator::m_glConvolutionParameterfv_profiling;
+if(this->m_ptr_glMakeTextureHandleResidentNV)this->m_ptr_glMakeTextureHandleResidentNV = (FunctionTable::MEMBERPFNGLMAKETEXTUREHANDLERESIDENTNVPROC)&ProfilingTableDecorator::m_glMakeTextureHandleResidentNV_profiling;
+if(this->m_ptr_glMultMatrixxOES)this->m_ptr_glMultMatrixxOES = (FunctionTable::MEMBERPFNGLMULTMATRIXXOESPROC)&ProfilingTableDecorator::m_glMultMatrixxOES_profiling;
+if(this->m_ptr_glTextureNormalEXT)this->m_ptr_glTextureNormalEXT = (FunctionTable::MEMBERPFNGLTEXTURENORMALEXTPROC)&ProfilingTableDecorator::m_glTextureNormalEXT_profiling;
+if(this->m_ptr_glGetQueryivARB)this->m_ptr_glGetQueryivARB = (FunctionTable::MEMBERPFNGLGETQUERYIVARBPROC)&ProfilingTableDecorator::m_glGetQueryivARB_profiling;
+if(this->m_ptr_glCompressedMultiTexImage3DEXT)this->m_ptr_glCompressedMultiTexImage3DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDMULTITEXIMAGE3DEXTPROC)&ProfilingTableDecorator::m_glCompressedMultiTexImage3DEXT_profiling;
+if(this->m_ptr_glGetInstrumentsSGIX)this->m_ptr_glGetInstrumentsSGIX = (FunctionTable::MEMBERPFNGLGETINSTRUMENTSSGIXPROC)&ProfilingTableDecorator::m_glGetInstrumentsSGIX_profiling;
+if(this->m_ptr_glProgramUniformMatrix4x3fvEXT)this->m_ptr_glProgramUniformMatrix4x3fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X3FVEXTPROC)&ProfilingTableDecorator::m_glProgramUniformMatrix4x3fvEXT_profiling;
+if(this->m_ptr_glPointParameterf)this->m_ptr_glPointParameterf = (FunctionTable::MEMBERPFNGLPOINTPARAMETERFPROC)&ProfilingTableDecorator::m_glPointParameterf_profiling;
+if(this->m_ptr_glProgramUniform3dEXT)this->m_ptr_glProgramUniform3dEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3DEXTPROC)&ProfilingTableDecorator::m_glProgramUniform3dEXT_profiling;
+if(this->m_ptr_glMultiTexCoord2hNV)this->m_ptr_glMultiTexCoord2hNV = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2HNVPROC)&ProfilingTableDecorator::m_glMultiTexCoord2hNV_profiling;
+if(this->m_ptr_glGetConvolutionFilterEXT)this->m_ptr_glGetConvolutionFilterEXT = (FunctionTable::MEMBERPFNGLGETCONVOLUTIONFILTEREXTPROC)&ProfilingTableDecorator::m_glGetConvolutionFilterEXT_profiling;
+if(this->m_ptr_glVertexAttrib2hNV)this->m_ptr_glVertexAttrib2hNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2HNVPROC)&ProfilingTableDecorator::m_glVertexAttrib2hNV_profiling;
+if(this->m_ptr_glCurrentPaletteMatrixARB)this->m_ptr_glCurrentPaletteMatrixARB = (FunctionTable::MEMBERPFNGLCURRENTPALETTEMATRIXARBPROC)&ProfilingTableDecorator::m_glCurrentPaletteMatrixARB_profiling;
+if(this->m_ptr_glFogxvOES)this->m_ptr_glFogxvOES = (FunctionTable::MEMBERPFNGLFOGXVOESPROC)&ProfilingTableDecorator::m_glFogxvOES_profiling;
+if(this->m_ptr_glCreateRenderbuffers)this->m_ptr_glCreateRenderbuffers = (FunctionTable::MEMBERPFNGLCREATERENDERBUFFERSPROC)&ProfilingTableDecorator::m_glCreateRenderbuffers_profiling;
+if(this->m_ptr_glVertexAttrib4Nusv)this->m_ptr_glVertexAttrib4Nusv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUSVPROC)&ProfilingTableDecorator::m_glVertexAttrib4Nusv_profiling;
+if(this->m_ptr_glCombinerInputNV)this->m_ptr_glCombinerInputNV = (FunctionTable::MEMBERPFNGLCOMBINERINPUTNVPROC)&ProfilingTableDecorator::m_glCombinerInputNV_profiling;
+if(this->m_ptr_glDepthFunc)this->m_ptr_glDepthFunc = (FunctionTable::MEMBERPFNGLDEPTHFUNCPROC)&ProfilingTableDecorator::m_glDepthFunc_profiling;
+if(this->m_ptr_glWindowPos4fMESA)this->m_ptr_glWindowPos4fMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS4FMESAPROC)&ProfilingTableDecorator::m_glWindowPos4fMESA_profiling;
+if(this->m_ptr_glEnableClientStateIndexedEXT)this->m_ptr_glEnableClientStateIndexedEXT = (FunctionTable::MEMBERPFNGLENABLECLIENTSTATEINDEXEDEXTPROC)&ProfilingTableDecorator::m_glEnableClientStateIndexedEXT_profiling;
+if(this->m_ptr_glTexCoord4iv)this->m_ptr_glTexCoord4iv = (FunctionTable::MEMBERPFNGLTEXCOORD4IVPROC)&ProfilingTableDecorator::m_glTexCoord4iv_profiling;
+if(this->m_ptr_glProgramUniform4i64ARB)this->m_ptr_glProgramUniform4i64ARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4I64ARBPROC)&ProfilingTableDecorator::m_glProgramUniform4i64ARB_profiling;
+if(this->m_ptr_glBlendFunci)this->m_ptr_glBlendFunci = (FunctionTable::MEMBERPFNGLBLENDFUNCIPROC)&ProfilingTableDecorator::m_glBlendFunci_profiling;
+if(this->m_ptr_glResolveDepthValuesNV)this->m_ptr_glResolveDepthValuesNV = (FunctionTable::MEMBERPFNGLRESOLVEDEPTHVALUESNVPROC)&ProfilingTableDecorator::m_glResolveDepthValuesNV_profiling;
+if(this->m_ptr_glTextureColorMaskSGIS)this->m_ptr_glTextureColorMaskSGIS = (FunctionTable::MEMBERPFNGLTEXTURECOLORMASKSGISPROC)&ProfilingTableDecorator::m_glTextureColorMaskSGIS_profiling;
+if(this->m_ptr_glCreateShaderProgramEXT)this->m_ptr_glCreateShaderProgramEXT = (FunctionTable::MEMBERPFNGLCREATESHADERPROGRAMEXTPROC)&ProfilingTableDecorator::m_glCreateShaderProgramEXT_profiling;
+if(this->m_ptr_glBufferStorage)this->m_ptr_glBufferStorage = (FunctionTable::MEMBERPFNGLBUFFERSTORAGEPROC)&ProfilingTableDecorator::m_glBufferStorage_profiling;
+if(this->m_ptr_glMakeNamedBufferNonResidentNV)this->m_ptr_glMakeNamedBufferNonResidentNV = (FunctionTable::MEMBERPFNGLMAKENAMEDBUFFERNONRESIDENTNVPROC)&ProfilingTableDecorator::m_glMakeNamedBufferNonResidentNV_profiling;
+if(this->m_ptr_glRenderbufferStorageMultisampleEXT)this->m_ptr_glRenderbufferStorageMultisampleEXT = (FunctionTable::MEMBERPFNGLRENDERBUFFERSTORAGEMULTISAMPLEEXTPROC)&ProfilingTableDecorator::m_glRenderbufferStorageMultisampleEXT_profiling;
+if(this->m_ptr_glGetFloati_v)this->m_ptr_glGetFloati_v = (FunctionTable::MEMBERPFNGLGETFLOATI_VPROC)&ProfilingTableDecorator::m_glGetFloati_v_profiling;
+if(this->m_ptr_glUniform2ui64ARB)this->m_ptr_glUniform2ui64ARB = (FunctionTable::MEMBERPFNGLUNIFORM2UI64ARBPROC)&ProfilingTableDecorator::m_glUniform2ui64ARB_profiling;
+if(this->m_ptr_glVertex3fv)this->m_ptr_glVertex3fv = (FunctionTable::MEMBERPFNGLVERTEX3FVPROC)&ProfilingTableDecorator::m_glVertex3fv_profiling;
+if(this->m_ptr_glGetUniformLocation)this->m_ptr_glGetUniformLocation = (FunctionTable::MEMBERPFNGLGETUNIFORMLOCATIONPROC)&ProfilingTableDecorator::m_glGetUniformLocation_profiling;
+if(this->m_ptr_glVertexStream1svATI)this->m_ptr_glVertexStream1svATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM1SVATIPROC)&ProfilingTableDecorator::m_glVertexStream1svATI_profiling;
+if(this->m_ptr_glVertexStream3fATI)this->m_ptr_glVertexStream3fATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM3FATIPROC)&ProfilingTableDecorator::m_glVertexStream3fATI_profiling;
+if(this->m_ptr_glNamedFramebufferDrawBuffers)this->m_ptr_glNamedFramebufferDrawBuffers = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC)&ProfilingTableDecorator::m_glNamedFramebufferDrawBuffers_profiling;
+if(this->m_ptr_glUniform2ui64vNV)this->m_ptr_glUniform2ui64vNV = (FunctionTable::MEMBERPFNGLUNIFORM2UI64VNVPROC)&ProfilingTableDecorator::m_glUniform2ui64vNV_profiling;
+if(this->m_ptr_glTexCoordPointervINTEL)this->m_ptr_glTexCoordPointervINTEL = (FunctionTable::MEMBERPFNGLTEXCOORDPOINTERVINTELPROC)&ProfilingTableDecorator::m_glTexCoordPointervINTEL_profiling;
+if(this->m_ptr_glUniform4fv)this->m_ptr_glUniform4fv = (FunctionTable::MEMBERPFNGLUNIFORM4FVPROC)&ProfilingTableDecorator::m_glUniform4fv_profiling;
+if(this->m_ptr_glNormalPointerEXT)this->m_ptr_glNormalPointerEXT = (FunctionTable::MEMBERPFNGLNORMALPOINTEREXTPROC)&ProfilingTableDecorator::m_glNormalPointerEXT_profiling;
+if(this->m_ptr_glVertexAttrib4hNV)this->m_ptr_glVertexAttrib4hNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4HNVPROC)&ProfilingTableDecorator::m_glVertexAttrib4hNV_profiling;
+if(this->m_ptr_glNormal3f)this->m_ptr_glNormal3f = (FunctionTable::MEMBERPFNGLNORMAL3FPROC)&ProfilingTableDecorator::m_glNormal3f_profiling;
+if(this->m_ptr_glVertexStream2iATI)this->m_ptr_glVertexStream2iATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM2IATIPROC)&ProfilingTableDecorator::m_glVertexStream2iATI_profiling;
+if(this->m_ptr_glVertexAttribP4uiv)this->m_ptr_glVertexAttribP4uiv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBP4UIVPROC)&ProfilingTableDecorator::m_glVertexAttribP4uiv_profiling;
+if(this->m_ptr_glCompressedTextureSubImage3D)this->m_ptr_glCompressedTextureSubImage3D = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC)&ProfilingTableDecorator::m_glCompressedTextureSubImage3D_profiling;
+if(this->m_ptr_glAsyncMarkerSGIX)this->m_ptr_glAsyncMarkerSGIX = (FunctionTable::MEMBERPFNGLASYNCMARKERSGIXPROC)&ProfilingTableDecorator::m_glAsyncMarkerSGIX_profiling;
+if(this->m_ptr_glTextureStorageSparseAMD)this->m_ptr_glTextureStorageSparseAMD = (FunctionTable::MEMBERPFNGLTEXTURESTORAGESPARSEAMDPROC)&ProfilingTableDecorator::m_glTextureStorageSparseAMD_profiling;
+if(this->m_ptr_glGetConvolutionParameterivEXT)this->m_ptr_glGetConvolutionParameterivEXT = (FunctionTable::MEMBERPFNGLGETCONVOLUTIONPARAMETERIVEXTPROC)&ProfilingTableDecorator::m_glGetConvolutionParameterivEXT_profiling;
+if(this->m_ptr_glEndPerfQueryINTEL)this->m_ptr_glEndPerfQueryINTEL = (FunctionTable::MEMBERPFNGLENDPERFQUERYINTELPROC)&ProfilingTableDecorator::m_glEndPerfQueryINTEL_profiling;
+if(this->m_ptr_glFragmentLightModeliSGIX)this->m_ptr_glFragmentLightModeliSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTLIGHTMODELISGIXPROC)&ProfilingTableDecorator::m_glFragmentLightModeliSGIX_profiling;
+if(this->m_ptr_glPrioritizeTexturesEXT)this->m_ptr_glPrioritizeTexturesEXT = (FunctionTable::MEMBERPFNGLPRIORITIZETEXTURESEXTPROC)&ProfilingTableDecorator::m_glPrioritizeTexturesEXT_profiling;
+if(this->m_ptr_glEndConditionalRender)this->m_ptr_glEndConditionalRender = (FunctionTable::MEMBERPFNGLENDCONDITIONALRENDERPROC)&ProfilingTableDecorator::m_glEndConditionalRender_profiling;
+if(this->m_ptr_glEnableClientState)this->m_ptr_glEnableClientState = (FunctionTable::MEMBERPFNGLENABLECLIENTSTATEPROC)&ProfilingTableDecorator::m_glEnableClientState_profiling;
+if(this->m_ptr_glResetHistogram)this->m_ptr_glResetHistogram = (FunctionTable::MEMBERPFNGLRESETHISTOGRAMPROC)&ProfilingTableDecorator::m_glResetHistogram_profiling;
+if(this->m_ptr_glGetOcclusionQueryivNV)this->m_ptr_glGetOcclusionQueryivNV = (FunctionTable::MEMBERPFNGLGETOCCLUSIONQUERYIVNVPROC)&ProfilingTableDecorator::m_glGetOcclusionQueryivNV_profiling;
+if(this->m_ptr_glUniform1uiEXT)this->m_ptr_glUniform1uiEXT = (FunctionTable::MEMBERPFNGLUNIFORM1UIEXTPROC)&ProfilingTableDecorator::m_glUniform1uiEXT_profiling;
+if(this->m_ptr_glMultiTexCoord2sv)this->m_ptr_glMultiTexCoord2sv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2SVPROC)&ProfilingTableDecorator::m_glMultiTexCoord2sv_profiling;
+if(this->m_ptr_glTexSubImage2DEXT)this->m_ptr_glTexSubImage2DEXT = (FunctionTable::MEMBERPFNGLTEXSUBIMAGE2DEXTPROC)&ProfilingTableDecorator::m_glTexSubImage2DEXT_profiling;
+if(this->m_ptr_glProgramUniform2uiv)this->m_ptr_glProgramUniform2uiv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UIVPROC)&ProfilingTableDecorator::m_glProgramUniform2uiv_profiling;
+if(this->m_ptr_glMultiTexCoord2iARB)this->m_ptr_glMultiTexCoord2iARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2IARBPROC)&ProfilingTableDecorator::m_glMultiTexCoord2iARB_profiling;
+if(this->m_ptr_glGetQueryObjectuiv)this->m_ptr_glGetQueryObjectuiv = (FunctionTable::MEMBERPFNGLGETQUERYOBJECTUIVPROC)&ProfilingTableDecorator::m_glGetQueryObjectuiv_profiling;
+if(this->m_ptr_glGenerateMultiTexMipmapEXT)this->m_ptr_glGenerateMultiTexMipmapEXT = (FunctionTable::MEMBERPFNGLGENERATEMULTITEXMIPMAPEXTPROC)&ProfilingTableDecorator::m_glGenerateMultiTexMipmapEXT_profiling;
+if(this->m_ptr_glVertexAttrib4iv)this->m_ptr_glVertexAttrib4iv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4IVPROC)&ProfilingTableDecorator::m_glVertexAttrib4iv_profiling;
+if(this->m_ptr_glWindowPos3dvMESA)this->m_ptr_glWindowPos3dvMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS3DVMESAPROC)&ProfilingTableDecorator::m_glWindowPos3dvMESA_profiling;
+if(this->m_ptr_glLabelObjectEXT)this->m_ptr_glLabelObjectEXT = (FunctionTable::MEMBERPFNGLLABELOBJECTEXTPROC)&ProfilingTableDecorator::m_glLabelObjectEXT_profiling;
+if(this->m_ptr_glProgramUniform1uiv)this->m_ptr_glProgramUniform1uiv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UIVPROC)&ProfilingTableDecorator::m_glProgramUniform1uiv_profiling;
+if(this->m_ptr_glFramebufferTexture)this->m_ptr_glFramebufferTexture = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTUREPROC)&ProfilingTableDecorator::m_glFramebufferTexture_profiling;
+if(this->m_ptr_glMultiTexEnvfEXT)this->m_ptr_glMultiTexEnvfEXT = (FunctionTable::MEMBERPFNGLMULTITEXENVFEXTPROC)&ProfilingTableDecorator::m_glMultiTexEnvfEXT_profiling;
+if(this->m_ptr_glGetTexGendv)this->m_ptr_glGetTexGendv = (FunctionTable::MEMBERPFNGLGETTEXGENDVPROC)&ProfilingTableDecorator::m_glGetTexGendv_profiling;
+if(this->m_ptr_glVertex4xOES)this->m_ptr_glVertex4xOES = (FunctionTable::MEMBERPFNGLVERTEX4XOESPROC)&ProfilingTableDecorator::m_glVertex4xOES_profiling;
+if(this->m_ptr_glVertexAttribI2uivEXT)this->m_ptr_glVertexAttribI2uivEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI2UIVEXTPROC)&ProfilingTableDecorator::m_glVertexAttribI2uivEXT_profiling;
+if(this->m_ptr_glNamedProgramLocalParameter4fvEXT)this->m_ptr_glNamedProgramLocalParameter4fvEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETER4FVEXTPROC)&ProfilingTableDecorator::m_glNamedProgramLocalParameter4fvEXT_profiling;
+if(this->m_ptr_glPointParameterfvSGIS)this->m_ptr_glPointParameterfvSGIS = (FunctionTable::MEMBERPFNGLPOINTPARAMETERFVSGISPROC)&ProfilingTableDecorator::m_glPointParameterfvSGIS_profiling;
+if(this->m_ptr_glGetPixelTransformParameterfvEXT)this->m_ptr_glGetPixelTransformParameterfvEXT = (FunctionTable::MEMBERPFNGLGETPIXELTRANSFORMPARAMETERFVEXTPROC)&ProfilingTableDecorator::m_glGetPixelTransformParameterfvEXT_profiling;
+if(this->m_ptr_glIndexxvOES)this->m_ptr_glIndexxvOES = (FunctionTable::MEMBERPFNGLINDEXXVOESPROC)&ProfilingTableDecorator::m_glIndexxvOES_profiling;
+if(this->m_ptr_glDepthMask)this->m_ptr_glDepthMask = (FunctionTable::MEMBERPFNGLDEPTHMASKPROC)&ProfilingTableDecorator::m_glDepthMask_profiling;
+if(this->m_ptr_glProgramUniformMatrix2x4fv)this->m_ptr_glProgramUniformMatrix2x4fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X4FVPROC)&ProfilingTableDecorator::m_glProgramUniformMatrix2x4fv_profiling;
+if(this->m_ptr_glAreProgramsResidentNV)this->m_ptr_glAreProgramsResidentNV = (FunctionTable::MEMBERPFNGLAREPROGRAMSRESIDENTNVPROC)&ProfilingTableDecorator::m_glAreProgramsResidentNV_profiling;
+if(this->m_ptr_glColorTable)this->m_ptr_glColorTable = (FunctionTable::MEMBERPFNGLCOLORTABLEPROC)&ProfilingTableDecorator::m_glColorTable_profiling;
+if(this->m_ptr_glBeginQueryIndexed)this->m_ptr_glBeginQueryIndexed = (FunctionTable::MEMBERPFNGLBEGINQUERYINDEXEDPROC)&ProfilingTableDecorator::m_glBeginQueryIndexed_profiling;
+if(this->m_ptr_glVertexStream1dvATI)this->m_ptr_glVertexStream1dvATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM1DVATIPROC)&ProfilingTableDecorator::m_glVertexStream1dvATI_profiling;
+if(this->m_ptr_glGetMultiTexEnvfvEXT)this->m_ptr_glGetMultiTexEnvfvEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXENVFVEXTPROC)&ProfilingTableDecorator::m_glGetMultiTexEnvfvEXT_profiling;
+if(this->m_ptr_glDeleteFencesNV)this->m_ptr_glDeleteFencesNV = (FunctionTable::MEMBERPFNGLDELETEFENCESNVPROC)&ProfilingTableDecorator::m_glDeleteFencesNV_profiling;
+if(this->m_ptr_glVertexAttribs1dvNV)this->m_ptr_glVertexAttribs1dvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS1DVNVPROC)&ProfilingTableDecorator::m_glVertexAttribs1dvNV_profiling;
+if(this->m_ptr_glVertexStream2sATI)this->m_ptr_glVertexStream2sATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM2SATIPROC)&ProfilingTableDecorator::m_glVertexStream2sATI_profiling;
+if(this->m_ptr_glGetnSeparableFilterARB)this->m_ptr_glGetnSeparableFilterARB = (FunctionTable::MEMBERPFNGLGETNSEPARABLEFILTERARBPROC)&ProfilingTableDecorator::m_glGetnSeparableFilterARB_profiling;
+if(this->m_ptr_glProgramUniform2dv)this->m_ptr_glProgramUniform2dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2DVPROC)&ProfilingTableDecorator::m_glProgramUniform2dv_profiling;
+if(this->m_ptr_glActiveStencilFaceEXT)this->m_ptr_glActiveStencilFaceEXT = (FunctionTable::MEMBERPFNGLACTIVESTENCILFACEEXTPROC)&ProfilingTableDecorator::m_glActiveStencilFaceEXT_profiling;
+if(this->m_ptr_glProgramUniform4dEXT)this->m_ptr_glProgramUniform4dEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4DEXTPROC)&ProfilingTableDecorator::m_glProgramUniform4dEXT_profiling;
+if(this->m_ptr_glPointSizexOES)this->m_ptr_glPointSizexOES = (FunctionTable::MEMBERPFNGLPOINTSIZEXOESPROC)&ProfilingTableDecorator::m_glPointSizexOES_profiling;
+if(this->m_ptr_glRasterPos2sv)this->m_ptr_glRasterPos2sv = (FunctionTable::MEMBERPFNGLRASTERPOS2SVPROC)&ProfilingTableDecorator::m_glRasterPos2sv_profiling;
+if(this->m_ptr_glBindParameterEXT)this->m_ptr_glBindParameterEXT = (FunctionTable::MEMBERPFNGLBINDPARAMETEREXTPROC)&ProfilingTableDecorator::m_glBindParameterEXT_profiling;
+if(this->m_ptr_glTexCoord1sv)this->m_ptr_glTexCoord1sv = (FunctionTable::MEMBERPFNGLTEXCOORD1SVPROC)&ProfilingTableDecorator::m_glTexCoord1sv_profiling;
+if(this->m_ptr_glBlendParameteriNV)this->m_ptr_glBlendParameteriNV = (FunctionTable::MEMBERPFNGLBLENDPARAMETERINVPROC)&ProfilingTableDecorator::m_glBlendParameteriNV_profiling;
+if(this->m_ptr_glNamedProgramLocalParameter4dvEXT)this->m_ptr_glNamedProgramLocalParameter4dvEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETER4DVEXTPROC)&ProfilingTableDecorator::m_glNamedProgramLocalParameter4dvEXT_profiling;
+if(this->m_ptr_glProgramUniformHandleui64NV)this->m_ptr_glProgramUniformHandleui64NV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMHANDLEUI64NVPROC)&ProfilingTableDecorator::m_glProgramUniformHandleui64NV_profiling;
+if(this->m_ptr_glGetTextureParameterfvEXT)this->m_ptr_glGetTextureParameterfvEXT = (FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERFVEXTPROC)&ProfilingTableDecorator::m_glGetTextureParameterfvEXT_profiling;
+if(this->m_ptr_glGetPathMetricsNV)this->m_ptr_glGetPathMetricsNV = (FunctionTable::MEMBERPFNGLGETPATHMETRICSNVPROC)&ProfilingTableDecorator::m_glGetPathMetricsNV_profiling;
+if(this->m_ptr_glVertex2i)this->m_ptr_glVertex2i = (FunctionTable::MEMBERPFNGLVERTEX2IPROC)&ProfilingTableDecorator::m_glVertex2i_profiling;
+if(this->m_ptr_glNewList)this->m_ptr_glNewList = (FunctionTable::MEMBERPFNGLNEWLISTPROC)&ProfilingTableDecorator::m_glNewList_profiling;
+if(this->m_ptr_glMatrixLoad3x3fNV)this->m_ptr_glMatrixLoad3x3fNV = (FunctionTable::MEMBERPFNGLMATRIXLOAD3X3FNVPROC)&ProfilingTableDecorator::m_glMatrixLoad3x3fNV_profiling;
+if(this->m_ptr_glMultiTexCoord2fARB)this->m_ptr_glMultiTexCoord2fARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2FARBPROC)&ProfilingTableDecorator::m_glMultiTexCoord2fARB_profiling;
+if(this->m_ptr_glWeightdvARB)this->m_ptr_glWeightdvARB = (FunctionTable::MEMBERPFNGLWEIGHTDVARBPROC)&ProfilingTableDecorator::m_glWeightdvARB_profiling;
+if(this->m_ptr_glIsTransformFeedbackNV)this->m_ptr_glIsTransformFeedbackNV = (FunctionTable::MEMBERPFNGLISTRANSFORMFEEDBACKNVPROC)&ProfilingTableDecorator::m_glIsTransformFeedbackNV_profiling;
+if(this->m_ptr_glVertexAttribDivisorARB)this->m_ptr_glVertexAttribDivisorARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIBDIVISORARBPROC)&ProfilingTableDecorator::m_glVertexAttribDivisorARB_profiling;
+if(this->m_ptr_glSecondaryColorP3uiv)this->m_ptr_glSecondaryColorP3uiv = (FunctionTable::MEMBERPFNGLSECONDARYCOLORP3UIVPROC)&ProfilingTableDecorator::m_glSecondaryColorP3uiv_profiling;
+if(this->m_ptr_glGetnCompressedTexImageARB)this->m_ptr_glGetnCompressedTexImageARB = (FunctionTable::MEMBERPFNGLGETNCOMPRESSEDTEXIMAGEARBPROC)&ProfilingTableDecorator::m_glGetnCompressedTexImageARB_profiling;
+if(this->m_ptr_glGetIntegerv)this->m_ptr_glGetIntegerv = (FunctionTable::MEMBERPFNGLGETINTEGERVPROC)&ProfilingTableDecorator::m_glGetIntegerv_profiling;
+if(this->m_ptr_glMatrixLoaddEXT)this->m_ptr_glMatrixLoaddEXT = (FunctionTable::MEMBERPFNGLMATRIXLOADDEXTPROC)&ProfilingTableDecorator::m_glMatrixLoaddEXT_profiling;
+if(this->m_ptr_glGetPathLengthNV)this->m_ptr_glGetPathLengthNV = (FunctionTable::MEMBERPFNGLGETPATHLENGTHNVPROC)&ProfilingTableDecorator::m_glGetPathLengthNV_profiling;
+if(this->m_ptr_glProgramUniformMatrix3dv)this->m_ptr_glProgramUniformMatrix3dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3DVPROC)&ProfilingTableDecorator::m_glProgramUniformMatrix3dv_profiling;
+if(this->m_ptr_glUniform4i64NV)this->m_ptr_glUniform4i64NV = (FunctionTable::MEMBERPFNGLUNIFORM4I64NVPROC)&ProfilingTableDecorator::m_glUniform4i64NV_profiling;
+if(this->m_ptr_glGetHistogramEXT)this->m_ptr_glGetHistogramEXT = (FunctionTable::MEMBERPFNGLGETHISTOGRAMEXTPROC)&ProfilingTableDecorator::m_glGetHistogramEXT_profiling;
+if(this->m_ptr_glVertexAttrib4NuivARB)this->m_ptr_glVertexAttrib4NuivARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUIVARBPROC)&ProfilingTableDecorator::m_glVertexAttrib4NuivARB_profiling;
+if(this->m_ptr_glMapGrid2xOES)this->m_ptr_glMapGrid2xOES = (FunctionTable::MEMBERPFNGLMAPGRID2XOESPROC)&ProfilingTableDecorator::m_glMapGrid2xOES_profiling;
+if(this->m_ptr_glTexImage2D)this->m_ptr_glTexImage2D = (FunctionTable::MEMBERPFNGLTEXIMAGE2DPROC)&ProfilingTableDecorator::m_glTexImage2D_profiling;
+if(this->m_ptr_glWindowPos2fvARB)this->m_ptr_glWindowPos2fvARB = (FunctionTable::MEMBERPFNGLWINDOWPOS2FVARBPROC)&ProfilingTableDecorator::m_glWindowPos2fvARB_profiling;
+if(this->m_ptr_glEnableIndexedEXT)this->m_ptr_glEnableIndexedEXT = (FunctionTable::MEMBERPFNGLENABLEINDEXEDEXTPROC)&ProfilingTableDecorator::m_glEnableIndexedEXT_profiling;
+if(this->m_ptr_glTexCoord1bvOES)this->m_ptr_glTexCoord1bvOES = (FunctionTable::MEMBERPFNGLTEXCOORD1BVOESPROC)&ProfilingTableDecorator::m_glTexCoord1bvOES_profiling;
+if(this->m_ptr_glDrawPixels)this->m_ptr_glDrawPixels = (FunctionTable::MEMBERPFNGLDRAWPIXELSPROC)&ProfilingTableDecorator::m_glDrawPixels_profiling;
+if(this->m_ptr_glMultMatrixd)this->m_ptr_glMultMatrixd = (FunctionTable::MEMBERPFNGLMULTMATRIXDPROC)&ProfilingTableDecorator::m_glMultMatrixd_profiling;
+if(this->m_ptr_glMultMatrixf)this->m_ptr_glMultMatrixf = (FunctionTable::MEMBERPFNGLMULTMATRIXFPROC)&ProfilingTableDecorator::m_glMultMatrixf_profiling;
+if(this->m_ptr_glReplacementCodePointerSUN)this->m_ptr_glReplacementCodePointerSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEPOINTERSUNPROC)&ProfilingTableDecorator::m_glReplacementCodePointerSUN_profiling;
+if(this->m_ptr_glLoadTransposeMatrixdARB)this->m_ptr_glLoadTransposeMatrixdARB = (FunctionTable::MEMBERPFNGLLOADTRANSPOSEMATRIXDARBPROC)&ProfilingTableDecorator::m_glLoadTransposeMatrixdARB_profiling;
+if(this->m_ptr_glVertexAttrib4Nubv)this->m_ptr_glVertexAttrib4Nubv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUBVPROC)&ProfilingTableDecorator::m_glVertexAttrib4Nubv_profiling;
+if(this->m_ptr_glVertexArrayVertexAttribIOffsetEXT)this->m_ptr_glVertexArrayVertexAttribIOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBIOFFSETEXTPROC)&ProfilingTableDecorator::m_glVertexArrayVertexAttribIOffsetEXT_profiling;
+if(this->m_ptr_glCompileShaderARB)this->m_ptr_glCompileShaderARB = (FunctionTable::MEMBERPFNGLCOMPILESHADERARBPROC)&ProfilingTableDecorator::m_glCompileShaderARB_profiling;
+if(this->m_ptr_glWindowPos3dMESA)this->m_ptr_glWindowPos3dMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS3DMESAPROC)&ProfilingTableDecorator::m_glWindowPos3dMESA_profiling;
+if(this->m_ptr_glNormalStream3fvATI)this->m_ptr_glNormalStream3fvATI = (FunctionTable::MEMBERPFNGLNORMALSTREAM3FVATIPROC)&ProfilingTableDecorator::m_glNormalStream3fvATI_profiling;
+if(this->m_ptr_glColor4usv)this->m_ptr_glColor4usv = (FunctionTable::MEMBERPFNGLCOLOR4USVPROC)&ProfilingTableDecorator::m_glColor4usv_profiling;
+if(this->m_ptr_glMapGrid1f)this->m_ptr_glMapGrid1f = (FunctionTable::MEMBERPFNGLMAPGRID1FPROC)&ProfilingTableDecorator::m_glMapGrid1f_profiling;
+if(this->m_ptr_glPolygonStipple)this->m_ptr_glPolygonStipple = (FunctionTable::MEMBERPFNGLPOLYGONSTIPPLEPROC)&ProfilingTableDecorator::m_glPolygonStipple_profiling;
+if(this->m_ptr_glUniform4ui64ARB)this->m_ptr_glUniform4ui64ARB = (FunctionTable::MEMBERPFNGLUNIFORM4UI64ARBPROC)&ProfilingTableDecorator::m_glUniform4ui64ARB_profiling;
+if(this->m_ptr_glTextureRenderbufferEXT)this->m_ptr_glTextureRenderbufferEXT = (FunctionTable::MEMBERPFNGLTEXTURERENDERBUFFEREXTPROC)&ProfilingTableDecorator::m_glTextureRenderbufferEXT_profiling;
+if(this->m_ptr_glGetSubroutineUniformLocation)this->m_ptr_glGetSubroutineUniformLocation = (FunctionTable::MEMBERPFNGLGETSUBROUTINEUNIFORMLOCATIONPROC)&ProfilingTableDecorator::m_glGetSubroutineUniformLocation_profiling;
+if(this->m_ptr_glGetFramebufferParameteriv)this->m_ptr_glGetFramebufferParameteriv = (FunctionTable::MEMBERPFNGLGETFRAMEBUFFERPARAMETERIVPROC)&ProfilingTableDecorator::m_glGetFramebufferParameteriv_profiling;
+if(this->m_ptr_glPixelMapusv)this->m_ptr_glPixelMapusv = (FunctionTable::MEMBERPFNGLPIXELMAPUSVPROC)&ProfilingTableDecorator::m_glPixelMapusv_profiling;
+if(this->m_ptr_glGetSamplerParameteriv)this->m_ptr_glGetSamplerParameteriv = (FunctionTable::MEMBERPFNGLGETSAMPLERPARAMETERIVPROC)&ProfilingTableDecorator::m_glGetSamplerParameteriv_profiling;
+if(this->m_ptr_glVertexStream2fvATI)this->m_ptr_glVertexStream2fvATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM2FVATIPROC)&ProfilingTableDecorator::m_glVertexStream2fvATI_profiling;
+if(this->m_ptr_glProgramStringARB)this->m_ptr_glProgramStringARB = (FunctionTable::MEMBERPFNGLPROGRAMSTRINGARBPROC)&ProfilingTableDecorator::m_glProgramStringARB_profiling;
+if(this->m_ptr_glProgramUniformMatrix3dvEXT)this->m_ptr_glProgramUniformMatrix3dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3DVEXTPROC)&ProfilingTableDecorator::m_glProgramUniformMatrix3dvEXT_profiling;
+if(this->m_ptr_glSeparableFilter2D)this->m_ptr_glSeparableFilter2D = (FunctionTable::MEMBERPFNGLSEPARABLEFILTER2DPROC)&ProfilingTableDecorator::m_glSeparableFilter2D_profiling;
+if(this->m_ptr_glVertexAttribI1uiv)this->m_ptr_glVertexAttribI1uiv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI1UIVPROC)&ProfilingTableDecorator::m_glVertexAttribI1uiv_profiling;
+if(this->m_ptr_glTexStorage2D)this->m_ptr_glTexStorage2D = (FunctionTable::MEMBERPFNGLTEXSTORAGE2DPROC)&ProfilingTableDecorator::m_glTexStorage2D_profiling;
+if(this->m_ptr_glColor3fv)this->m_ptr_glColor3fv = (FunctionTable::MEMBERPFNGLCOLOR3FVPROC)&ProfilingTableDecorator::m_glColor3fv_profiling;
+if(this->m_ptr_glVertexAttribL4dvEXT)this->m_ptr_glVertexAttribL4dvEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL4DVEXTPROC)&ProfilingTableDecorator::m_glVertexAttribL4dvEXT_profiling;
+if(this->m_ptr_glGetActiveUniform)this->m_ptr_glGetActiveUniform = (FunctionTable::MEMBERPFNGLGETACTIVEUNIFORMPROC)&ProfilingTableDecorator::m_glGetActiveUniform_profiling;
+if(this->m_ptr_glUniform2ui64vARB)this->m_ptr_glUniform2ui64vARB = (FunctionTable::MEMBERPFNGLUNIFORM2UI64VARBPROC)&ProfilingTableDecorator::m_glUniform2ui64vARB_profiling;
+if(this->m_ptr_glMakeNamedBufferResidentNV)this->m_ptr_glMakeNamedBufferResidentNV = (FunctionTable::MEMBERPFNGLMAKENAMEDBUFFERRESIDENTNVPROC)&ProfilingTableDecorator::m_glMakeNamedBufferResidentNV_profiling;
+if(this->m_ptr_glPathGlyphIndexRangeNV)this->m_ptr_glPathGlyphIndexRangeNV = (FunctionTable::MEMBERPFNGLPATHGLYPHINDEXRANGENVPROC)&ProfilingTableDecorator::m_glPathGlyphIndexRangeNV_profiling;
+if(this->m_ptr_glColorPointer)this->m_ptr_glColorPointer = (FunctionTable::MEMBERPFNGLCOLORPOINTERPROC)&ProfilingTableDecorator::m_glColorPointer_profiling;
+if(this->m_ptr_glProgramEnvParameterI4ivNV)this->m_ptr_glProgramEnvParameterI4ivNV = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERI4IVNVPROC)&ProfilingTableDecorator::m_glProgramEnvParameterI4ivNV_profiling;
+if(this->m_ptr_glMultiTexParameterfEXT)this->m_ptr_glMultiTexParameterfEXT = (FunctionTable::MEMBERPFNGLMULTITEXPARAMETERFEXTPROC)&ProfilingTableDecorator::m_glMultiTexParameterfEXT_profiling;
+if(this->m_ptr_glNamedFramebufferTextureLayer)this->m_ptr_glNamedFramebufferTextureLayer = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC)&ProfilingTableDecorator::m_glNamedFramebufferTextureLayer_profiling;
+if(this->m_ptr_glGetVertexArrayIntegervEXT)this->m_ptr_glGetVertexArrayIntegervEXT = (FunctionTable::MEMBERPFNGLGETVERTEXARRAYINTEGERVEXTPROC)&ProfilingTableDecorator::m_glGetVertexArrayIntegervEXT_profiling;
+if(this->m_ptr_glVertexAttrib3dARB)this->m_ptr_glVertexAttrib3dARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3DARBPROC)&ProfilingTableDecorator::m_glVertexAttrib3dARB_profiling;
+if(this->m_ptr_glVDPAUIsSurfaceNV)this->m_ptr_glVDPAUIsSurfaceNV = (FunctionTable::MEMBERPFNGLVDPAUISSURFACENVPROC)&ProfilingTableDecorator::m_glVDPAUIsSurfaceNV_profiling;
+if(this->m_ptr_glMultiTexImage1DEXT)this->m_ptr_glMultiTexImage1DEXT = (FunctionTable::MEMBERPFNGLMULTITEXIMAGE1DEXTPROC)&ProfilingTableDecorator::m_glMultiTexImage1DEXT_profiling;
+if(this->m_ptr_glIsAsyncMarkerSGIX)this->m_ptr_glIsAsyncMarkerSGIX = (FunctionTable::MEMBERPFNGLISASYNCMARKERSGIXPROC)&ProfilingTableDecorator::m_glIsAsyncMarkerSGIX_profiling;
+if(this->m_ptr_glGetDoublei_vEXT)this->m_ptr_glGetDoublei_vEXT = (FunctionTable::MEMBERPFNGLGETDOUBLEI_VEXTPROC)&ProfilingTableDecorator::m_glGetDoublei_vEXT_profiling;
+if(this->m_ptr_glUniform2i64NV)this->m_ptr_glUniform2i64NV = (FunctionTable::MEMBERPFNGLUNIFORM2I64NVPROC)&ProfilingTableDecorator::m_glUniform2i64NV_profiling;
+if(this->m_ptr_glIsCommandListNV)this->m_ptr_glIsCommandListNV = (FunctionTable::MEMBERPFNGLISCOMMANDLISTNVPROC)&ProfilingTableDecorator::m_glIsCommandListNV_profiling;
+if(this->m_ptr_glUniform3uiEXT)this->m_ptr_glUniform3uiEXT = (FunctionTable::MEMBERPFNGLUNIFORM3UIEXTPROC)&ProfilingTableDecorator::m_glUniform3uiEXT_profiling;
+if(this->m_ptr_glTexParameterIuivEXT)this->m_ptr_glTexParameterIuivEXT = (FunctionTable::MEMBERPFNGLTEXPARAMETERIUIVEXTPROC)&ProfilingTableDecorator::m_glTexParameterIuivEXT_profiling;
+if(this->m_ptr_glProgramUniformMatrix4fv)this->m_ptr_glProgramUniformMatrix4fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4FVPROC)&ProfilingTableDecorator::m_glProgramUniformMatrix4fv_profiling;
+if(this->m_ptr_glVertex2fv)this->m_ptr_glVertex2fv = (FunctionTable::MEMBERPFNGLVERTEX2FVPROC)&ProfilingTableDecorator::m_glVertex2fv_profiling;
+if(this->m_ptr_glVertexAttribL3dEXT)this->m_ptr_glVertexAttribL3dEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL3DEXTPROC)&ProfilingTableDecorator::m_glVertexAttribL3dEXT_profiling;
+if(this->m_ptr_glFramebufferRenderbuffer)this->m_ptr_glFramebufferRenderbuffer = (FunctionTable::MEMBERPFNGLFRAMEBUFFERRENDERBUFFERPROC)&ProfilingTableDecorator::m_glFramebufferRenderbuffer_profiling;
+if(this->m_ptr_glGetUniformLocationARB)this->m_ptr_glGetUniformLocationARB = (FunctionTable::MEMBERPFNGLGETUNIFORMLOCATIONARBPROC)&ProfilingTableDecorator::m_glGetUniformLocationARB_profiling;
+if(this->m_ptr_glPathParameterfvNV)this->m_ptr_glPathParameterfvNV = (FunctionTable::MEMBERPFNGLPATHPARAMETERFVNVPROC)&ProfilingTableDecorator::m_glPathParameterfvNV_profiling;
+if(this->m_ptr_glVertexAttrib3sNV)this->m_ptr_glVertexAttrib3sNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3SNVPROC)&ProfilingTableDecorator::m_glVertexAttrib3sNV_profiling;
+if(this->m_ptr_glGetDoublei_v)this->m_ptr_glGetDoublei_v = (FunctionTable::MEMBERPFNGLGETDOUBLEI_VPROC)&ProfilingTableDecorator::m_glGetDoublei_v_profiling;
+if(this->m_ptr_glVertexAttrib1sv)this->m_ptr_glVertexAttrib1sv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1SVPROC)&ProfilingTableDecorator::m_glVertexAttrib1sv_profiling;
+if(this->m_ptr_glBindSampler)this->m_ptr_glBindSampler = (FunctionTable::MEMBERPFNGLBINDSAMPLERPROC)&ProfilingTableDecorator::m_glBindSampler_profiling;
+if(this->m_ptr_glLineWidth)this->m_ptr_glLineWidth = (FunctionTable::MEMBERPFNGLLINEWIDTHPROC)&ProfilingTableDecorator::m_glLineWidth_profiling;
+if(this->m_ptr_glVertexArrayRangeAPPLE)this->m_ptr_glVertexArrayRangeAPPLE = (FunctionTable::MEMBERPFNGLVERTEXARRAYRANGEAPPLEPROC)&ProfilingTableDecorator::m_glVertexArrayRangeAPPLE_profiling;
+if(this->m_ptr_glBindBufferOffsetEXT)this->m_ptr_glBindBufferOffsetEXT = (FunctionTable::MEMBERPFNGLBINDBUFFEROFFSETEXTPROC)&ProfilingTableDecorator::m_glBindBufferOffsetEXT_profiling;
+if(this->m_ptr_glWeightfvARB)this->m_ptr_glWeightfvARB = (FunctionTable::MEMBERPFNGLWEIGHTFVARBPROC)&ProfilingTableDecorator::m_glWeightfvARB_profiling;
+if(this->m_ptr_glGetIntegeri_v)this->m_ptr_glGetIntegeri_v = (FunctionTable::MEMBERPFNGLGETINTEGERI_VPROC)&ProfilingTableDecorator::m_glGetIntegeri_v_profiling;
+if(this->m_ptr_glGetTransformFeedbackVarying)this->m_ptr_glGetTransformFeedbackVarying = (FunctionTable::MEMBERPFNGLGETTRANSFORMFEEDBACKVARYINGPROC)&ProfilingTableDecorator::m_glGetTransformFeedbackVarying_profiling;
+if(this->m_ptr_glProgramLocalParameter4fvARB)this->m_ptr_glProgramLocalParameter4fvARB = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETER4FVARBPROC)&ProfilingTableDecorator::m_glProgramLocalParameter4fvARB_profiling;
+if(this->m_ptr_glGetTransformFeedbackVaryingNV)this->m_ptr_glGetTransformFeedbackVaryingNV = (FunctionTable::MEMBERPFNGLGETTRANSFORMFEEDBACKVARYINGNVPROC)&ProfilingTableDecorator::m_glGetTransformFeedbackVaryingNV_profiling;
+if(this->m_ptr_glWindowPos2iv)this->m_ptr_glWindowPos2iv = (FunctionTable::MEMBERPFNGLWINDOWPOS2IVPROC)&ProfilingTableDecorator::m_glWindowPos2iv_profiling;
+if(this->m_ptr_glVertexStream1dATI)this->m_ptr_glVertexStream1dATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM1DATIPROC)&ProfilingTableDecorator::m_glVertexStream1dATI_profiling;
+if(this->m_ptr_glColorFragmentOp2ATI)this->m_ptr_glColorFragmentOp2ATI = (FunctionTable::MEMBERPFNGLCOLORFRAGMENTOP2ATIPROC)&ProfilingTableDecorator::m_glColorFragmentOp2ATI_profiling;
+if(this->m_ptr_glFogiv)this->m_ptr_glFogiv = (FunctionTable::MEMBERPFNGLFOGIVPROC)&ProfilingTableDecorator::m_glFogiv_profiling;
+if(this->m_ptr_glGetTextureHandleNV)this->m_ptr_glGetTextureHandleNV = (FunctionTable::MEMBERPFNGLGETTEXTUREHANDLENVPROC)&ProfilingTableDecorator::m_glGetTextureHandleNV_profiling;
+if(this->m_ptr_glLightModeliv)this->m_ptr_glLightModeliv = (FunctionTable::MEMBERPFNGLLIGHTMODELIVPROC)&ProfilingTableDecorator::m_glLightModeliv_profiling;
+if(this->m_ptr_glDepthRangef)this->m_ptr_glDepthRangef = (FunctionTable::MEMBERPFNGLDEPTHRANGEFPROC)&ProfilingTableDecorator::m_glDepthRangef_profiling;
+if(this->m_ptr_glGetFragmentMaterialivSGIX)this->m_ptr_glGetFragmentMaterialivSGIX = (FunctionTable::MEMBERPFNGLGETFRAGMENTMATERIALIVSGIXPROC)&ProfilingTableDecorator::m_glGetFragmentMaterialivSGIX_profiling;
+if(this->m_ptr_glVideoCaptureStreamParameterfvNV)this->m_ptr_glVideoCaptureStreamParameterfvNV = (FunctionTable::MEMBERPFNGLVIDEOCAPTURESTREAMPARAMETERFVNVPROC)&ProfilingTableDecorator::m_glVideoCaptureStreamParameterfvNV_profiling;
+if(this->m_ptr_glDeleteProgramsARB)this->m_ptr_glDeleteProgramsARB = (FunctionTable::MEMBERPFNGLDELETEPROGRAMSARBPROC)&ProfilingTableDecorator::m_glDeleteProgramsARB_profiling;
+if(this->m_ptr_glWindowPos3fvARB)this->m_ptr_glWindowPos3fvARB = (FunctionTable::MEMBERPFNGLWINDOWPOS3FVARBPROC)&ProfilingTableDecorator::m_glWindowPos3fvARB_profiling;
+if(this->m_ptr_glFeedbackBufferxOES)this->m_ptr_glFeedbackBufferxOES = (FunctionTable::MEMBERPFNGLFEEDBACKBUFFERXOESPROC)&ProfilingTableDecorator::m_glFeedbackBufferxOES_profiling;
+if(this->m_ptr_glGetTexBumpParameterfvATI)this->m_ptr_glGetTexBumpParameterfvATI = (FunctionTable::MEMBERPFNGLGETTEXBUMPPARAMETERFVATIPROC)&ProfilingTableDecorator::m_glGetTexBumpParameterfvATI_profiling;
+if(this->m_ptr_glEnablei)this->m_ptr_glEnablei = (FunctionTable::MEMBERPFNGLENABLEIPROC)&ProfilingTableDecorator::m_glEnablei_profiling;
+if(this->m_ptr_glGetActiveSubroutineName)this->m_ptr_glGetActiveSubroutineName = (FunctionTable::MEMBERPFNGLGETACTIVESUBROUTINENAMEPROC)&ProfilingTableDecorator::m_glGetActiveSubroutineName_profiling;
+if(this->m_ptr_glDrawBuffersARB)this->m_ptr_glDrawBuffersARB = (FunctionTable::MEMBERPFNGLDRAWBUFFERSARBPROC)&ProfilingTableDecorator::m_glDrawBuffersARB_profiling;
+if(this->m_ptr_glBindProgramARB)this->m_ptr_glBindProgramARB = (FunctionTable::MEMBERPFNGLBINDPROGRAMARBPROC)&ProfilingTableDecorator::m_glBindProgramARB_profiling;
+if(this->m_ptr_glEvalCoord1fv)this->m_ptr_glEvalCoord1fv = (FunctionTable::MEMBERPFNGLEVALCOORD1FVPROC)&ProfilingTableDecorator::m_glEvalCoord1fv_profiling;
+if(this->m_ptr_glProgramUniform3ui64vARB)this->m_ptr_glProgramUniform3ui64vARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UI64VARBPROC)&ProfilingTableDecorator::m_glProgramUniform3ui64vARB_profiling;
+if(this->m_ptr_glProgramUniformMatrix2dv)this->m_ptr_glProgramUniformMatrix2dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2DVPROC)&ProfilingTableDecorator::m_glProgramUniformMatrix2dv_profiling;
+if(this->m_ptr_glMultiTexCoord2hvNV)this->m_ptr_glMultiTexCoord2hvNV = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2HVNVPROC)&ProfilingTableDecorator::m_glMultiTexCoord2hvNV_profiling;
+if(this->m_ptr_glGetFloatIndexedvEXT)this->m_ptr_glGetFloatIndexedvEXT = (FunctionTable::MEMBERPFNGLGETFLOATINDEXEDVEXTPROC)&ProfilingTableDecorator::m_glGetFloatIndexedvEXT_profiling;
+if(this->m_ptr_glSampleCoverageARB)this->m_ptr_glSampleCoverageARB = (FunctionTable::MEMBERPFNGLSAMPLECOVERAGEARBPROC)&ProfilingTableDecorator::m_glSampleCoverageARB_profiling;
+if(this->m_ptr_glProgramUniform2ui64vARB)this->m_ptr_glProgramUniform2ui64vARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UI64VARBPROC)&ProfilingTableDecorator::m_glProgramUniform2ui64vARB_profiling;
+if(this->m_ptr_glPixelDataRangeNV)this->m_ptr_glPixelDataRangeNV = (FunctionTable::MEMBERPFNGLPIXELDATARANGENVPROC)&ProfilingTableDecorator::m_glPixelDataRangeNV_profiling;
+if(this->m_ptr_glVertexStream3svATI)this->m_ptr_glVertexStream3svATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM3SVATIPROC)&ProfilingTableDecorator::m_glVertexStream3svATI_profiling;
+if(this->m_ptr_glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN)this->m_ptr_glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUITEXCOORD2FNORMAL3FVERTEX3FVSUNPROC)&ProfilingTableDecorator::m_glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN_profiling;
+if(this->m_ptr_glTexCoord3hvNV)this->m_ptr_glTexCoord3hvNV = (FunctionTable::MEMBERPFNGLTEXCOORD3HVNVPROC)&ProfilingTableDecorator::m_glTexCoord3hvNV_profiling;
+if(this->m_ptr_glSampleMaski)this->m_ptr_glSampleMaski = (FunctionTable::MEMBERPFNGLSAMPLEMASKIPROC)&ProfilingTableDecorator::m_glSampleMaski_profiling;
+if(this->m_ptr_glIndexFuncEXT)this->m_ptr_glIndexFuncEXT = (FunctionTable::MEMBERPFNGLINDEXFUNCEXTPROC)&ProfilingTableDecorator::m_glIndexFuncEXT_profiling;
+if(this->m_ptr_glPointParameteriNV)this->m_ptr_glPointParameteriNV = (FunctionTable::MEMBERPFNGLPOINTPARAMETERINVPROC)&ProfilingTableDecorator::m_glPointParameteriNV_profiling;
+if(this->m_ptr_glUniformMatrix3x2fv)this->m_ptr_glUniformMatrix3x2fv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX3X2FVPROC)&ProfilingTableDecorator::m_glUniformMatrix3x2fv_profiling;
+if(this->m_ptr_glGetFramebufferParameterivEXT)this->m_ptr_glGetFramebufferParameterivEXT = (FunctionTable::MEMBERPFNGLGETFRAMEBUFFERPARAMETERIVEXTPROC)&ProfilingTableDecorator::m_glGetFramebufferParameterivEXT_profiling;
+if(this->m_ptr_glUniform2i64ARB)this->m_ptr_glUniform2i64ARB = (FunctionTable::MEMBERPFNGLUNIFORM2I64ARBPROC)&ProfilingTableDecorator::m_glUniform2i64ARB_profiling;
+if(this->m_ptr_glNamedBufferStorageEXT)this->m_ptr_glNamedBufferStorageEXT = (FunctionTable::MEMBERPFNGLNAMEDBUFFERSTORAGEEXTPROC)&ProfilingTableDecorator::m_glNamedBufferStorageEXT_profiling;
+if(this->m_ptr_glNamedFramebufferTexture3DEXT)this->m_ptr_glNamedFramebufferTexture3DEXT = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTURE3DEXTPROC)&ProfilingTableDecorator::m_glNamedFramebufferTexture3DEXT_profiling;
+if(this->m_ptr_glVertexAttrib2dv)this->m_ptr_glVertexAttrib2dv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2DVPROC)&ProfilingTableDecorator::m_glVertexAttrib2dv_profiling;
+if(this->m_ptr_glGetVertexArrayPointervEXT)this->m_ptr_glGetVertexArrayPointervEXT = (FunctionTable::MEMBERPFNGLGETVERTEXARRAYPOINTERVEXTPROC)&ProfilingTableDecorator::m_glGetVertexArrayPointervEXT_profiling;
+if(this->m_ptr_glGetVertexAttribArrayObjectivATI)this->m_ptr_glGetVertexAttribArrayObjectivATI = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBARRAYOBJECTIVATIPROC)&ProfilingTableDecorator::m_glGetVertexAttribArrayObjectivATI_profiling;
+if(this->m_ptr_glProgramUniformMatrix3fvEXT)this->m_ptr_glProgramUniformMatrix3fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3FVEXTPROC)&ProfilingTableDecorator::m_glProgramUniformMatrix3fvEXT_profiling;
+if(this->m_ptr_glEnableVertexArrayEXT)this->m_ptr_glEnableVertexArrayEXT = (FunctionTable::MEMBERPFNGLENABLEVERTEXARRAYEXTPROC)&ProfilingTableDecorator::m_glEnableVertexArrayEXT_profiling;
+if(this->m_ptr_glColorTableParameterfvSGI)this->m_ptr_glColorTableParameterfvSGI = (FunctionTable::MEMBERPFNGLCOLORTABLEPARAMETERFVSGIPROC)&ProfilingTableDecorator::m_glColorTableParameterfvSGI_profiling;
+if(this->m_ptr_glEdgeFlag)this->m_ptr_glEdgeFlag = (FunctionTable::MEMBERPFNGLEDGEFLAGPROC)&ProfilingTableDecorator::m_glEdgeFlag_profiling;
+if(this->m_ptr_glFogCoordf)this->m_ptr_glFogCoordf = (FunctionTable::MEMBERPFNGLFOGCOORDFPROC)&ProfilingTableDecorator::m_glFogCoordf_profiling;
+if(this->m_ptr_glVertex3d)this->m_ptr_glVertex3d = (FunctionTable::MEMBERPFNGLVERTEX3DPROC)&ProfilingTableDecorator::m_glVertex3d_profiling;
+if(this->m_ptr_glVertex3f)this->m_ptr_glVertex3f = (FunctionTable::MEMBERPFNGLVERTEX3FPROC)&ProfilingTableDecorator::m_glVertex3f_profiling;
+if(this->m_ptr_glSpriteParameterivSGIX)this->m_ptr_glSpriteParameterivSGIX = (FunctionTable::MEMBERPFNGLSPRITEPARAMETERIVSGIXPROC)&ProfilingTableDecorator::m_glSpriteParameterivSGIX_profiling;
+if(this->m_ptr_glPathGlyphRangeNV)this->m_ptr_glPathGlyphRangeNV = (FunctionTable::MEMBERPFNGLPATHGLYPHRANGENVPROC)&ProfilingTableDecorator::m_glPathGlyphRangeNV_profiling;
+if(this->m_ptr_glPrimitiveBoundingBoxARB)this->m_ptr_glPrimitiveBoundingBoxARB = (FunctionTable::MEMBERPFNGLPRIMITIVEBOUNDINGBOXARBPROC)&ProfilingTableDecorator::m_glPrimitiveBoundingBoxARB_profiling;
+if(this->m_ptr_glVertexAttribL3ui64vNV)this->m_ptr_glVertexAttribL3ui64vNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL3UI64VNVPROC)&ProfilingTableDecorator::m_glVertexAttribL3ui64vNV_profiling;
+if(this->m_ptr_glVertex3s)this->m_ptr_glVertex3s = (FunctionTable::MEMBERPFNGLVERTEX3SPROC)&ProfilingTableDecorator::m_glVertex3s_profiling;
+if(this->m_ptr_glTexCoordP2ui)this->m_ptr_glTexCoordP2ui = (FunctionTable::MEMBERPFNGLTEXCOORDP2UIPROC)&ProfilingTableDecorator::m_glTexCoordP2ui_profiling;
+if(this->m_ptr_glProgramUniform2fvEXT)this->m_ptr_glProgramUniform2fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2FVEXTPROC)&ProfilingTableDecorator::m_glProgramUniform2fvEXT_profiling;
+if(this->m_ptr_glDeletePathsNV)this->m_ptr_glDeletePathsNV = (FunctionTable::MEMBERPFNGLDELETEPATHSNVPROC)&ProfilingTableDecorator::m_glDeletePathsNV_profiling;
+if(this->m_ptr_glPrimitiveRestartIndexNV)this->m_ptr_glPrimitiveRestartIndexNV = (FunctionTable::MEMBERPFNGLPRIMITIVERESTARTINDEXNVPROC)&ProfilingTableDecorator::m_glPrimitiveRestartIndexNV_profiling;
+if(this->m_ptr_glTexCoord2fColor3fVertex3fvSUN)this->m_ptr_glTexCoord2fColor3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLTEXCOORD2FCOLOR3FVERTEX3FVSUNPROC)&ProfilingTableDecorator::m_glTexCoord2fColor3fVertex3fvSUN_profiling;
+if(this->m_ptr_glTexCoordPointerListIBM)this->m_ptr_glTexCoordPointerListIBM = (FunctionTable::MEMBERPFNGLTEXCOORDPOINTERLISTIBMPROC)&ProfilingTableDecorator::m_glTexCoordPointerListIBM_profiling;
+if(this->m_ptr_glRectxOES)this->m_ptr_glRectxOES = (FunctionTable::MEMBERPFNGLRECTXOESPROC)&ProfilingTableDecorator::m_glRectxOES_profiling;
+if(this->m_ptr_glCopyNamedBufferSubData)this->m_ptr_glCopyNamedBufferSubData = (FunctionTable::MEMBERPFNGLCOPYNAMEDBUFFERSUBDATAPROC)&ProfilingTableDecorator::m_glCopyNamedBufferSubData_profiling;
+if(this->m_ptr_glGenProgramsNV)this->m_ptr_glGenProgramsNV = (FunctionTable::MEMBERPFNGLGENPROGRAMSNVPROC)&ProfilingTableDecorator::m_glGenProgramsNV_profiling;
+if(this->m_ptr_glFragmentLightfSGIX)this->m_ptr_glFragmentLightfSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTLIGHTFSGIXPROC)&ProfilingTableDecorator::m_glFragmentLightfSGIX_profiling;
+if(this->m_ptr_glTexStorage3D)this->m_ptr_glTexStorage3D = (FunctionTable::MEMBERPFNGLTEXSTORAGE3DPROC)&ProfilingTableDecorator::m_glTexStorage3D_profiling;
+if(this->m_ptr_glTextureParameteriv)this->m_ptr_glTextureParameteriv = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIVPROC)&ProfilingTableDecorator::m_glTextureParameteriv_profiling;
+if(this->m_ptr_glNamedBufferDataEXT)this->m_ptr_glNamedBufferDataEXT = (FunctionTable::MEMBERPFNGLNAMEDBUFFERDATAEXTPROC)&ProfilingTableDecorator::m_glNamedBufferDataEXT_profiling;
+if(this->m_ptr_glMultiTexCoord3fvARB)this->m_ptr_glMultiTexCoord3fvARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3FVARBPROC)&ProfilingTableDecorator::m_glMultiTexCoord3fvARB_profiling;
+if(this->m_ptr_glUniformMatrix3x4fv)this->m_ptr_glUniformMatrix3x4fv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX3X4FVPROC)&ProfilingTableDecorator::m_glUniformMatrix3x4fv_profiling;
+if(this->m_ptr_glSubpixelPrecisionBiasNV)this->m_ptr_glSubpixelPrecisionBiasNV = (FunctionTable::MEMBERPFNGLSUBPIXELPRECISIONBIASNVPROC)&ProfilingTableDecorator::m_glSubpixelPrecisionBiasNV_profiling;
+if(this->m_ptr_glNormalPointer)this->m_ptr_glNormalPointer = (FunctionTable::MEMBERPFNGLNORMALPOINTERPROC)&ProfilingTableDecorator::m_glNormalPointer_profiling;
+if(this->m_ptr_glNamedFramebufferTexture)this->m_ptr_glNamedFramebufferTexture = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTUREPROC)&ProfilingTableDecorator::m_glNamedFramebufferTexture_profiling;
+if(this->m_ptr_glVertexAttrib4NsvARB)this->m_ptr_glVertexAttrib4NsvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NSVARBPROC)&ProfilingTableDecorator::m_glVertexAttrib4NsvARB_profiling;
+if(this->m_ptr_glPassThrough)this->m_ptr_glPassThrough = (FunctionTable::MEMBERPFNGLPASSTHROUGHPROC)&ProfilingTableDecorator::m_glPassThrough_profiling;
+if(this->m_ptr_glSecondaryColorP3ui)this->m_ptr_glSecondaryColorP3ui = (FunctionTable::MEMBERPFNGLSECONDARYCOLORP3UIPROC)&ProfilingTableDecorator::m_glSecondaryColorP3ui_profiling;
+if(this->m_ptr_glInvalidateTexSubImage)this->m_ptr_glInvalidateTexSubImage = (FunctionTable::MEMBERPFNGLINVALIDATETEXSUBIMAGEPROC)&ProfilingTableDecorator::m_glInvalidateTexSubImage_profiling;
+if(this->m_ptr_glIsImageHandleResidentARB)this->m_ptr_glIsImageHandleResidentARB = (FunctionTable::MEMBERPFNGLISIMAGEHANDLERESIDENTARBPROC)&ProfilingTableDecorator::m_glIsImageHandleResidentARB_profiling;
+if(this->m_ptr_glTangent3fvEXT)this->m_ptr_glTangent3fvEXT = (FunctionTable::MEMBERPFNGLTANGENT3FVEXTPROC)&ProfilingTableDecorator::m_glTangent3fvEXT_profiling;
+if(this->m_ptr_glProgramUniformMatrix4x3fv)this->m_ptr_glProgramUniformMatrix4x3fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X3FVPROC)&ProfilingTableDecorator::m_glProgramUniformMatrix4x3fv_profiling;
+if(this->m_ptr_glBegin)this->m_ptr_glBegin = (FunctionTable::MEMBERPFNGLBEGINPROC)&ProfilingTableDecorator::m_glBegin_profiling;
+if(this->m_ptr_glEvalCoord2dv)this->m_ptr_glEvalCoord2dv = (FunctionTable::MEMBERPFNGLEVALCOORD2DVPROC)&ProfilingTableDecorator::m_glEvalCoord2dv_profiling;
+if(this->m_ptr_glColor3ubv)this->m_ptr_glColor3ubv = (FunctionTable::MEMBERPFNGLCOLOR3UBVPROC)&ProfilingTableDecorator::m_glColor3ubv_profiling;
+if(this->m_ptr_glFogCoordfvEXT)this->m_ptr_glFogCoordfvEXT = (FunctionTable::MEMBERPFNGLFOGCOORDFVEXTPROC)&ProfilingTableDecorator::m_glFogCoordfvEXT_profiling;
+if(this->m_ptr_glVertexP3ui)this->m_ptr_glVertexP3ui = (FunctionTable::MEMBERPFNGLVERTEXP3UIPROC)&ProfilingTableDecorator::m_glVertexP3ui_profiling;
+if(this->m_ptr_glLightfv)this->m_ptr_glLightfv = (FunctionTable::MEMBERPFNGLLIGHTFVPROC)&ProfilingTableDecorator::m_glLightfv_profiling;
+if(this->m_ptr_glVertexAttribL3i64NV)this->m_ptr_glVertexAttribL3i64NV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL3I64NVPROC)&ProfilingTableDecorator::m_glVertexAttribL3i64NV_profiling;
+if(this->m_ptr_glStencilClearTagEXT)this->m_ptr_glStencilClearTagEXT = (FunctionTable::MEMBERPFNGLSTENCILCLEARTAGEXTPROC)&ProfilingTableDecorator::m_glStencilClearTagEXT_profiling;
+if(this->m_ptr_glGetActiveUniformName)this->m_ptr_glGetActiveUniformName = (FunctionTable::MEMBERPFNGLGETACTIVEUNIFORMNAMEPROC)&ProfilingTableDecorator::m_glGetActiveUniformName_profiling;
+if(this->m_ptr_glTangentPointerEXT)this->m_ptr_glTangentPointerEXT = (FunctionTable::MEMBERPFNGLTANGENTPOINTEREXTPROC)&ProfilingTableDecorator::m_glTangentPointerEXT_profiling;
+if(this->m_ptr_glUniform4ui64vNV)this->m_ptr_glUniform4ui64vNV = (FunctionTable::MEMBERPFNGLUNIFORM4UI64VNVPROC)&ProfilingTableDecorator::m_glUniform4ui64vNV_profiling;
+if(this->m_ptr_glDebugMessageEnableAMD)this->m_ptr_glDebugMessageEnableAMD = (FunctionTable::MEMBERPFNGLDEBUGMESSAGEENABLEAMDPROC)&ProfilingTableDecorator::m_glDebugMessageEnableAMD_profiling;
+if(this->m_ptr_glProgramUniform2ui)this->m_ptr_glProgramUniform2ui = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UIPROC)&ProfilingTableDecorator::m_glProgramUniform2ui_profiling;
+if(this->m_ptr_glCopyTexSubImage2DEXT)this->m_ptr_glCopyTexSubImage2DEXT = (FunctionTable::MEMBERPFNGLCOPYTEXSUBIMAGE2DEXTPROC)&ProfilingTableDecorator::m_glCopyTexSubImage2DEXT_profiling;
+if(this->m_ptr_glGenRenderbuffersEXT)this->m_ptr_glGenRenderbuffersEXT = (FunctionTable::MEMBERPFNGLGENRENDERBUFFERSEXTPROC)&ProfilingTableDecorator::m_glGenRenderbuffersEXT_profiling;
+if(this->m_ptr_glNamedProgramLocalParameterI4ivEXT)this->m_ptr_glNamedProgramLocalParameterI4ivEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERI4IVEXTPROC)&ProfilingTableDecorator::m_glNamedProgramLocalParameterI4ivEXT_profiling;
+if(this->m_ptr_glMultiTexCoord2f)this->m_ptr_glMultiTexCoord2f = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2FPROC)&ProfilingTableDecorator::m_glMultiTexCoord2f_profiling;
+if(this->m_ptr_glMapGrid2d)this->m_ptr_glMapGrid2d = (FunctionTable::MEMBERPFNGLMAPGRID2DPROC)&ProfilingTableDecorator::m_glMapGrid2d_profiling;
+if(this->m_ptr_glGetMultiTexParameterIuivEXT)this->m_ptr_glGetMultiTexParameterIuivEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXPARAMETERIUIVEXTPROC)&ProfilingTableDecorator::m_glGetMultiTexParameterIuivEXT_profiling;
+if(this->m_ptr_glBlendEquationiARB)this->m_ptr_glBlendEquationiARB = (FunctionTable::MEMBERPFNGLBLENDEQUATIONIARBPROC)&ProfilingTableDecorator::m_glBlendEquationiARB_profiling;
+if(this->m_ptr_glTexParameteriv)this->m_ptr_glTexParameteriv = (FunctionTable::MEMBERPFNGLTEXPARAMETERIVPROC)&ProfilingTableDecorator::m_glTexParameteriv_profiling;
+if(this->m_ptr_glUniform4ivARB)this->m_ptr_glUniform4ivARB = (FunctionTable::MEMBERPFNGLUNIFORM4IVARBPROC)&ProfilingTableDecorator::m_glUniform4ivARB_profiling;
+if(this->m_ptr_glMatrixOrthoEXT)this->m_ptr_glMatrixOrthoEXT = (FunctionTable::MEMBERPFNGLMATRIXORTHOEXTPROC)&ProfilingTableDecorator::m_glMatrixOrthoEXT_profiling;
+if(this->m_ptr_glVertexArrayVertexBuffer)this->m_ptr_glVertexArrayVertexBuffer = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXBUFFERPROC)&ProfilingTableDecorator::m_glVertexArrayVertexBuffer_profiling;
+if(this->m_ptr_glProgramLocalParametersI4ivNV)this->m_ptr_glProgramLocalParametersI4ivNV = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERSI4IVNVPROC)&ProfilingTableDecorator::m_glProgramLocalParametersI4ivNV_profiling;
+if(this->m_ptr_glProgramUniform4ui64vNV)this->m_ptr_glProgramUniform4ui64vNV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UI64VNVPROC)&ProfilingTableDecorator::m_glProgramUniform4ui64vNV_profiling;
+if(this->m_ptr_glGetNamedStringivARB)this->m_ptr_glGetNamedStringivARB = (FunctionTable::MEMBERPFNGLGETNAMEDSTRINGIVARBPROC)&ProfilingTableDecorator::m_glGetNamedStringivARB_profiling;
+if(this->m_ptr_glVertexAttribL1i64vNV)this->m_ptr_glVertexAttribL1i64vNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL1I64VNVPROC)&ProfilingTableDecorator::m_glVertexAttribL1i64vNV_profiling;
+if(this->m_ptr_glTransformFeedbackBufferBase)this->m_ptr_glTransformFeedbackBufferBase = (FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKBUFFERBASEPROC)&ProfilingTableDecorator::m_glTransformFeedbackBufferBase_profiling;
+if(this->m_ptr_glIndexsv)this->m_ptr_glIndexsv = (FunctionTable::MEMBERPFNGLINDEXSVPROC)&ProfilingTableDecorator::m_glIndexsv_profiling;
+if(this->m_ptr_glPointParameterivNV)this->m_ptr_glPointParameterivNV = (FunctionTable::MEMBERPFNGLPOINTPARAMETERIVNVPROC)&ProfilingTableDecorator::m_glPointParameterivNV_profiling;
+if(this->m_ptr_glGetDetailTexFuncSGIS)this->m_ptr_glGetDetailTexFuncSGIS = (FunctionTable::MEMBERPFNGLGETDETAILTEXFUNCSGISPROC)&ProfilingTableDecorator::m_glGetDetailTexFuncSGIS_profiling;
+if(this->m_ptr_glReplacementCodeuiColor3fVertex3fvSUN)this->m_ptr_glReplacementCodeuiColor3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUICOLOR3FVERTEX3FVSUNPROC)&ProfilingTableDecorator::m_glReplacementCodeuiColor3fVertex3fvSUN_profiling;
+if(this->m_ptr_glProgramLocalParameter4fARB)this->m_ptr_glProgramLocalParameter4fARB = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETER4FARBPROC)&ProfilingTableDecorator::m_glProgramLocalParameter4fARB_profiling;
+if(this->m_ptr_glBitmap)this->m_ptr_glBitmap = (FunctionTable::MEMBERPFNGLBITMAPPROC)&ProfilingTableDecorator::m_glBitmap_profiling;
+if(this->m_ptr_glNamedFramebufferTextureLayerEXT)this->m_ptr_glNamedFramebufferTextureLayerEXT = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTURELAYEREXTPROC)&ProfilingTableDecorator::m_glNamedFramebufferTextureLayerEXT_profiling;
+if(this->m_ptr_glMultiTexGenfvEXT)this->m_ptr_glMultiTexGenfvEXT = (FunctionTable::MEMBERPFNGLMULTITEXGENFVEXTPROC)&ProfilingTableDecorator::m_glMultiTexGenfvEXT_profiling;
+if(this->m_ptr_glGetNamedBufferSubData)this->m_ptr_glGetNamedBufferSubData = (FunctionTable::MEMBERPFNGLGETNAMEDBUFFERSUBDATAPROC)&ProfilingTableDecorator::m_glGetNamedBufferSubData_profiling;
+if(this->m_ptr_glStencilFuncSeparateATI)this->m_ptr_glStencilFuncSeparateATI = (FunctionTable::MEMBERPFNGLSTENCILFUNCSEPARATEATIPROC)&ProfilingTableDecorator::m_glStencilFuncSeparateATI_profiling;
+if(this->m_ptr_glProgramUniform2iv)this->m_ptr_glProgramUniform2iv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2IVPROC)&ProfilingTableDecorator::m_glProgramUniform2iv_profiling;
+if(this->m_ptr_glGetQueryiv)this->m_ptr_glGetQueryiv = (FunctionTable::MEMBERPFNGLGETQUERYIVPROC)&ProfilingTableDecorator::m_glGetQueryiv_profiling;
+if(this->m_ptr_glTexCoord4f)this->m_ptr_glTexCoord4f = (FunctionTable::MEMBERPFNGLTEXCOORD4FPROC)&ProfilingTableDecorator::m_glTexCoord4f_profiling;
+if(this->m_ptr_glMapGrid2f)this->m_ptr_glMapGrid2f = (FunctionTable::MEMBERPFNGLMAPGRID2FPROC)&ProfilingTableDecorator::m_glMapGrid2f_profiling;
+if(this->m_ptr_glListParameterivSGIX)this->m_ptr_glListParameterivSGIX = (FunctionTable::MEMBERPFNGLLISTPARAMETERIVSGIXPROC)&ProfilingTableDecorator::m_glListParameterivSGIX_profiling;
+if(this->m_ptr_glCreateQueries)this->m_ptr_glCreateQueries = (FunctionTable::MEMBERPFNGLCREATEQUERIESPROC)&ProfilingTableDecorator::m_glCreateQueries_profiling;
+if(this->m_ptr_glGetSamplerParameterfv)this->m_ptr_glGetSamplerParameterfv = (FunctionTable::MEMBERPFNGLGETSAMPLERPARAMETERFVPROC)&ProfilingTableDecorator::m_glGetSamplerParameterfv_profiling;
+if(this->m_ptr_glTexCoord4i)this->m_ptr_glTexCoord4i = (FunctionTable::MEMBERPFNGLTEXCOORD4IPROC)&ProfilingTableDecorator::m_glTexCoord4i_profiling;
+if(this->m_ptr_glObjectLabel)this->m_ptr_glObjectLabel = (FunctionTable::MEMBERPFNGLOBJECTLABELPROC)&ProfilingTableDecorator::m_glObjectLabel_profiling;
+if(this->m_ptr_glProgramUniform3i64NV)this->m_ptr_glProgramUniform3i64NV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3I64NVPROC)&ProfilingTableDecorator::m_glProgramUniform3i64NV_profiling;
+if(this->m_ptr_glGetTextureHandleARB)this->m_ptr_glGetTextureHandleARB = (FunctionTable::MEMBERPFNGLGETTEXTUREHANDLEARBPROC)&ProfilingTableDecorator::m_glGetTextureHandleARB_profiling;
+if(this->m_ptr_glTexCoord4s)this->m_ptr_glTexCoord4s = (FunctionTable::MEMBERPFNGLTEXCOORD4SPROC)&ProfilingTableDecorator::m_glTexCoord4s_profiling;
+if(this->m_ptr_glUniform4iARB)this->m_ptr_glUniform4iARB = (FunctionTable::MEMBERPFNGLUNIFORM4IARBPROC)&ProfilingTableDecorator::m_glUniform4iARB_profiling;
+if(this->m_ptr_glGetUniformIndices)this->m_ptr_glGetUniformIndices = (FunctionTable::MEMBERPFNGLGETUNIFORMINDICESPROC)&ProfilingTableDecorator::m_glGetUniformIndices_profiling;
+if(this->m_ptr_glMultiTexImage3DEXT)this->m_ptr_glMultiTexImage3DEXT = (FunctionTable::MEMBERPFNGLMULTITEXIMAGE3DEXTPROC)&ProfilingTableDecorator::m_glMultiTexImage3DEXT_profiling;
+if(this->m_ptr_glCoverageModulationTableNV)this->m_ptr_glCoverageModulationTableNV = (FunctionTable::MEMBERPFNGLCOVERAGEMODULATIONTABLENVPROC)&ProfilingTableDecorator::m_glCoverageModulationTableNV_profiling;
+if(this->m_ptr_glPointParameteriv)this->m_ptr_glPointParameteriv = (FunctionTable::MEMBERPFNGLPOINTPARAMETERIVPROC)&ProfilingTableDecorator::m_glPointParameteriv_profiling;
+if(this->m_ptr_glMultiTexCoord4svARB)this->m_ptr_glMultiTexCoord4svARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4SVARBPROC)&ProfilingTableDecorator::m_glMultiTexCoord4svARB_profiling;
+if(this->m_ptr_glNormal3fv)this->m_ptr_glNormal3fv = (FunctionTable::MEMBERPFNGLNORMAL3FVPROC)&ProfilingTableDecorator::m_glNormal3fv_profiling;
+if(this->m_ptr_glProgramUniformMatrix3x4dvEXT)this->m_ptr_glProgramUniformMatrix3x4dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X4DVEXTPROC)&ProfilingTableDecorator::m_glProgramUniformMatrix3x4dvEXT_profiling;
+if(this->m_ptr_glTexCoord1fv)this->m_ptr_glTexCoord1fv = (FunctionTable::MEMBERPFNGLTEXCOORD1FVPROC)&ProfilingTableDecorator::m_glTexCoord1fv_profiling;
+if(this->m_ptr_glProgramUniformMatrix4x3dvEXT)this->m_ptr_glProgramUniformMatrix4x3dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X3DVEXTPROC)&ProfilingTableDecorator::m_glProgramUniformMatrix4x3dvEXT_profiling;
+if(this->m_ptr_glGetActiveVaryingNV)this->m_ptr_glGetActiveVaryingNV = (FunctionTable::MEMBERPFNGLGETACTIVEVARYINGNVPROC)&ProfilingTableDecorator::m_glGetActiveVaryingNV_profiling;
+if(this->m_ptr_glUniform1i64vARB)this->m_ptr_glUniform1i64vARB = (FunctionTable::MEMBERPFNGLUNIFORM1I64VARBPROC)&ProfilingTableDecorator::m_glUniform1i64vARB_profiling;
+if(this->m_ptr_glMultiTexCoord1dv)this->m_ptr_glMultiTexCoord1dv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1DVPROC)&ProfilingTableDecorator::m_glMultiTexCoord1dv_profiling;
+if(this->m_ptr_glTexCoord3fv)this->m_ptr_glTexCoord3fv = (FunctionTable::MEMBERPFNGLTEXCOORD3FVPROC)&ProfilingTableDecorator::m_glTexCoord3fv_profiling;
+if(this->m_ptr_glMatrixTranslatefEXT)this->m_ptr_glMatrixTranslatefEXT = (FunctionTable::MEMBERPFNGLMATRIXTRANSLATEFEXTPROC)&ProfilingTableDecorator::m_glMatrixTranslatefEXT_profiling;
+if(this->m_ptr_glProgramUniform1ui64vNV)this->m_ptr_glProgramUniform1ui64vNV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UI64VNVPROC)&ProfilingTableDecorator::m_glProgramUniform1ui64vNV_profiling;
+if(this->m_ptr_glTextureMaterialEXT)this->m_ptr_glTextureMaterialEXT = (FunctionTable::MEMBERPFNGLTEXTUREMATERIALEXTPROC)&ProfilingTableDecorator::m_glTextureMaterialEXT_profiling;
+if(this->m_ptr_glMultiTexCoordP3uiv)this->m_ptr_glMultiTexCoordP3uiv = (FunctionTable::MEMBERPFNGLMULTITEXCOORDP3UIVPROC)&ProfilingTableDecorator::m_glMultiTexCoordP3uiv_profiling;
+if(this->m_ptr_glVertexAttribP3ui)this->m_ptr_glVertexAttribP3ui = (FunctionTable::MEMBERPFNGLVERTEXATTRIBP3UIPROC)&ProfilingTableDecorator::m_glVertexAttribP3ui_profiling;
+if(this->m_ptr_glInterpolatePathsNV)this->m_ptr_glInterpolatePathsNV = (FunctionTable::MEMBERPFNGLINTERPOLATEPATHSNVPROC)&ProfilingTableDecorator::m_glInterpolatePathsNV_profiling;
+if(this->m_ptr_glTextureBufferRange)this->m_ptr_glTextureBufferRange = (FunctionTable::MEMBERPFNGLTEXTUREBUFFERRANGEPROC)&ProfilingTableDecorator::m_glTextureBufferRange_profiling;
+if(this->m_ptr_glVertexAttribL2dEXT)this->m_ptr_glVertexAttribL2dEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL2DEXTPROC)&ProfilingTableDecorator::m_glVertexAttribL2dEXT_profiling;
+if(this->m_ptr_glGetPixelTransformParameterivEXT)this->m_ptr_glGetPixelTransformParameterivEXT = (FunctionTable::MEMBERPFNGLGETPIXELTRANSFORMPARAMETERIVEXTPROC)&ProfilingTableDecorator::m_glGetPixelTransformParameterivEXT_profiling;
+if(this->m_ptr_glTexCoord4xvOES)this->m_ptr_glTexCoord4xvOES = (FunctionTable::MEMBERPFNGLTEXCOORD4XVOESPROC)&ProfilingTableDecorator::m_glTexCoord4xvOES_profiling;
+if(this->m_ptr_glGetVariantBooleanvEXT)this->m_ptr_glGetVariantBooleanvEXT = (FunctionTable::MEMBERPFNGLGETVARIANTBOOLEANVEXTPROC)&ProfilingTableDecorator::m_glGetVariantBooleanvEXT_profiling;
+if(this->m_ptr_glDepthRange)this->m_ptr_glDepthRange = (FunctionTable::MEMBERPFNGLDEPTHRANGEPROC)&ProfilingTableDecorator::m_glDepthRange_profiling;
+if(this->m_ptr_glGetVertexAttribdvARB)this->m_ptr_glGetVertexAttribdvARB = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBDVARBPROC)&ProfilingTableDecorator::m_glGetVertexAttribdvARB_profiling;
+if(this->m_ptr_glGetColorTableParameterfv)this->m_ptr_glGetColorTableParameterfv = (FunctionTable::MEMBERPFNGLGETCOLORTABLEPARAMETERFVPROC)&ProfilingTableDecorator::m_glGetColorTableParameterfv_profiling;
+if(this->m_ptr_glDrawArraysInstancedEXT)this->m_ptr_glDrawArraysInstancedEXT = (FunctionTable::MEMBERPFNGLDRAWARRAYSINSTANCEDEXTPROC)&ProfilingTableDecorator::m_glDrawArraysInstancedEXT_profiling;
+if(this->m_ptr_glDisableClientStateIndexedEXT)this->m_ptr_glDisableClientStateIndexedEXT = (FunctionTable::MEMBERPFNGLDISABLECLIENTSTATEINDEXEDEXTPROC)&ProfilingTableDecorator::m_glDisableClientStateIndexedEXT_profiling;
+if(this->m_ptr_glDrawBuffer)this->m_ptr_glDrawBuffer = (FunctionTable::MEMBERPFNGLDRAWBUFFERPROC)&ProfilingTableDecorator::m_glDrawBuffer_profiling;
+if(this->m_ptr_glMultiDrawArraysIndirectBindlessNV)this->m_ptr_glMultiDrawArraysIndirectBindlessNV = (FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSINDIRECTBINDLESSNVPROC)&ProfilingTableDecorator::m_glMultiDrawArraysIndirectBindlessNV_profiling;
+if(this->m_ptr_glGetnPixelMapusv)this->m_ptr_glGetnPixelMapusv = (FunctionTable::MEMBERPFNGLGETNPIXELMAPUSVPROC)&ProfilingTableDecorator::m_glGetnPixelMapusv_profiling;
+if(this->m_ptr_glRasterPos3fv)this->m_ptr_glRasterPos3fv = (FunctionTable::MEMBERPFNGLRASTERPOS3FVPROC)&ProfilingTableDecorator::m_glRasterPos3fv_profiling;
+if(this->m_ptr_glClearBufferuiv)this->m_ptr_glClearBufferuiv = (FunctionTable::MEMBERPFNGLCLEARBUFFERUIVPROC)&ProfilingTableDecorator::m_glClearBufferuiv_profiling;
+if(this->m_ptr_glGetInternalformati64v)this->m_ptr_glGetInternalformati64v = (FunctionTable::MEMBERPFNGLGETINTERNALFORMATI64VPROC)&ProfilingTableDecorator::m_glGetInternalformati64v_profiling;
+if(this->m_ptr_glShaderSourceARB)this->m_ptr_glShaderSourceARB = (FunctionTable::MEMBERPFNGLSHADERSOURCEARBPROC)&ProfilingTableDecorator::m_glShaderSourceARB_profiling;
+if(this->m_ptr_glShaderOp3EXT)this->m_ptr_glShaderOp3EXT = (FunctionTable::MEMBERPFNGLSHADEROP3EXTPROC)&ProfilingTableDecorator::m_glShaderOp3EXT_profiling;
+if(this->m_ptr_glWindowPos2dvMESA)this->m_ptr_glWindowPos2dvMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS2DVMESAPROC)&ProfilingTableDecorator::m_glWindowPos2dvMESA_profiling;
+if(this->m_ptr_glClearIndex)this->m_ptr_glClearIndex = (FunctionTable::MEMBERPFNGLCLEARINDEXPROC)&ProfilingTableDecorator::m_glClearIndex_profiling;
+if(this->m_ptr_glProvokingVertexEXT)this->m_ptr_glProvokingVertexEXT = (FunctionTable::MEMBERPFNGLPROVOKINGVERTEXEXTPROC)&ProfilingTableDecorator::m_glProvokingVertexEXT_profiling;
+if(this->m_ptr_glVariantubvEXT)this->m_ptr_glVariantubvEXT = (FunctionTable::MEMBERPFNGLVARIANTUBVEXTPROC)&ProfilingTableDecorator::m_glVariantubvEXT_profiling;
+if(this->m_ptr_glFlush)this->m_ptr_glFlush = (FunctionTable::MEMBERPFNGLFLUSHPROC)&ProfilingTableDecorator::m_glFlush_profiling;
+if(this->m_ptr_glGetColorTableParameterivEXT)this->m_ptr_glGetColorTableParameterivEXT = (FunctionTable::MEMBERPFNGLGETCOLORTABLEPARAMETERIVEXTPROC)&ProfilingTableDecorator::m_glGetColorTableParameterivEXT_profiling;
+if(this->m_ptr_glPresentFrameDualFillNV)this->m_ptr_glPresentFrameDualFillNV = (FunctionTable::MEMBERPFNGLPRESENTFRAMEDUALFILLNVPROC)&ProfilingTableDecorator::m_glPresentFrameDualFillNV_profiling;
+if(this->m_ptr_glGenVertexShadersEXT)this->m_ptr_glGenVertexShadersEXT = (FunctionTable::MEMBERPFNGLGENVERTEXSHADERSEXTPROC)&ProfilingTableDecorator::m_glGenVertexShadersEXT_profiling;
+if(this->m_ptr_glProgramUniformHandleui64vARB)this->m_ptr_glProgramUniformHandleui64vARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMHANDLEUI64VARBPROC)&ProfilingTableDecorator::m_glProgramUniformHandleui64vARB_profiling;
+if(this->m_ptr_glDepthRangefOES)this->m_ptr_glDepthRangefOES = (FunctionTable::MEMBERPFNGLDEPTHRANGEFOESPROC)&ProfilingTableDecorator::m_glDepthRangefOES_profiling;
+if(this->m_ptr_glDrawElementsInstancedBaseVertexBaseInstance)this->m_ptr_glDrawElementsInstancedBaseVertexBaseInstance = (FunctionTable::MEMBERPFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC)&ProfilingTableDecorator::m_glDrawElementsInstancedBaseVertexBaseInstance_profiling;
+if(this->m_ptr_glGetTexLevelParameteriv)this->m_ptr_glGetTexLevelParameteriv = (FunctionTable::MEMBERPFNGLGETTEXLEVELPARAMETERIVPROC)&ProfilingTableDecorator::m_glGetTexLevelParameteriv_profiling;
+if(this->m_ptr_glStencilFillPathNV)this->m_ptr_glStencilFillPathNV = (FunctionTable::MEMBERPFNGLSTENCILFILLPATHNVPROC)&ProfilingTableDecorator::m_glStencilFillPathNV_profiling;
+if(this->m_ptr_glWindowPos3iARB)this->m_ptr_glWindowPos3iARB = (FunctionTable::MEMBERPFNGLWINDOWPOS3IARBPROC)&ProfilingTableDecorator::m_glWindowPos3iARB_profiling;
+if(this->m_ptr_glPrioritizeTextures)this->m_ptr_glPrioritizeTextures = (FunctionTable::MEMBERPFNGLPRIORITIZETEXTURESPROC)&ProfilingTableDecorator::m_glPrioritizeTextures_profiling;
+if(this->m_ptr_glWindowPos3fvMESA)this->m_ptr_glWindowPos3fvMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS3FVMESAPROC)&ProfilingTableDecorator::m_glWindowPos3fvMESA_profiling;
+if(this->m_ptr_glProgramUniformMatrix3x2dvEXT)this->m_ptr_glProgramUniformMatrix3x2dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X2DVEXTPROC)&ProfilingTableDecorator::m_glProgramUniformMatrix3x2dvEXT_profiling;
+if(this->m_ptr_glVertex4xvOES)this->m_ptr_glVertex4xvOES = (FunctionTable::MEMBERPFNGLVERTEX4XVOESPROC)&ProfilingTableDecorator::m_glVertex4xvOES_profiling;
+if(this->m_ptr_glTexStorage3DMultisample)this->m_ptr_glTexStorage3DMultisample = (FunctionTable::MEMBERPFNGLTEXSTORAGE3DMULTISAMPLEPROC)&ProfilingTableDecorator::m_glTexStorage3DMultisample_profiling;
+if(this->m_ptr_glWindowPos2sARB)this->m_ptr_glWindowPos2sARB = (FunctionTable::MEMBERPFNGLWINDOWPOS2SARBPROC)&ProfilingTableDecorator::m_glWindowPos2sARB_profiling;
+if(this->m_ptr_glStencilOpValueAMD)this->m_ptr_glStencilOpValueAMD = (FunctionTable::MEMBERPFNGLSTENCILOPVALUEAMDPROC)&ProfilingTableDecorator::m_glStencilOpValueAMD_profiling;
+if(this->m_ptr_glProgramVertexLimitNV)this->m_ptr_glProgramVertexLimitNV = (FunctionTable::MEMBERPFNGLPROGRAMVERTEXLIMITNVPROC)&ProfilingTableDecorator::m_glProgramVertexLimitNV_profiling;
+if(this->m_ptr_glGetTexParameterPointervAPPLE)this->m_ptr_glGetTexParameterPointervAPPLE = (FunctionTable::MEMBERPFNGLGETTEXPARAMETERPOINTERVAPPLEPROC)&ProfilingTableDecorator::m_glGetTexParameterPointervAPPLE_profiling;
+if(this->m_ptr_glProgramUniform3uivEXT)this->m_ptr_glProgramUniform3uivEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UIVEXTPROC)&ProfilingTableDecorator::m_glProgramUniform3uivEXT_profiling;
+if(this->m_ptr_glClampColor)this->m_ptr_glClampColor = (FunctionTable::MEMBERPFNGLCLAMPCOLORPROC)&ProfilingTableDecorator::m_glClampColor_profiling;
+if(this->m_ptr_glClearStencil)this->m_ptr_glClearStencil = (FunctionTable::MEMBERPFNGLCLEARSTENCILPROC)&ProfilingTableDecorator::m_glClearStencil_profiling;
+if(this->m_ptr_glTexCoordP1uiv)this->m_ptr_glTexCoordP1uiv = (FunctionTable::MEMBERPFNGLTEXCOORDP1UIVPROC)&ProfilingTableDecorator::m_glTexCoordP1uiv_profiling;
+if(this->m_ptr_glVertexAttribs3svNV)this->m_ptr_glVertexAttribs3svNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS3SVNVPROC)&ProfilingTableDecorator::m_glVertexAttribs3svNV_profiling;
+if(this->m_ptr_glMultiTexCoord3fv)this->m_ptr_glMultiTexCoord3fv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3FVPROC)&ProfilingTableDecorator::m_glMultiTexCoord3fv_profiling;
+if(this->m_ptr_glVertexBlendEnvfATI)this->m_ptr_glVertexBlendEnvfATI = (FunctionTable::MEMBERPFNGLVERTEXBLENDENVFATIPROC)&ProfilingTableDecorator::m_glVertexBlendEnvfATI_profiling;
+if(this->m_ptr_glIsFenceAPPLE)this->m_ptr_glIsFenceAPPLE = (FunctionTable::MEMBERPFNGLISFENCEAPPLEPROC)&ProfilingTableDecorator::m_glIsFenceAPPLE_profiling;
+if(this->m_ptr_glGetBufferParameterui64vNV)this->m_ptr_glGetBufferParameterui64vNV = (FunctionTable::MEMBERPFNGLGETBUFFERPARAMETERUI64VNVPROC)&ProfilingTableDecorator::m_glGetBufferParameterui64vNV_profiling;
+if(this->m_ptr_glVertexAttribI4bvEXT)this->m_ptr_glVertexAttribI4bvEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4BVEXTPROC)&ProfilingTableDecorator::m_glVertexAttribI4bvEXT_profiling;
+if(this->m_ptr_glUniform2fARB)this->m_ptr_glUniform2fARB = (FunctionTable::MEMBERPFNGLUNIFORM2FARBPROC)&ProfilingTableDecorator::m_glUniform2fARB_profiling;
+if(this->m_ptr_glStopInstrumentsSGIX)this->m_ptr_glStopInstrumentsSGIX = (FunctionTable::MEMBERPFNGLSTOPINSTRUMENTSSGIXPROC)&ProfilingTableDecorator::m_glStopInstrumentsSGIX_profiling;
+if(this->m_ptr_glVertexAttrib3fNV)this->m_ptr_glVertexAttrib3fNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3FNVPROC)&ProfilingTableDecorator::m_glVertexAttrib3fNV_profiling;
+if(this->m_ptr_glMapVertexAttrib2dAPPLE)this->m_ptr_glMapVertexAttrib2dAPPLE = (FunctionTable::MEMBERPFNGLMAPVERTEXATTRIB2DAPPLEPROC)&ProfilingTableDecorator::m_glMapVertexAttrib2dAPPLE_profiling;
+if(this->m_ptr_glVertex2f)this->m_ptr_glVertex2f = (FunctionTable::MEMBERPFNGLVERTEX2FPROC)&ProfilingTableDecorator::m_glVertex2f_profiling;
+if(this->m_ptr_glCopyTextureImage2DEXT)this->m_ptr_glCopyTextureImage2DEXT = (FunctionTable::MEMBERPFNGLCOPYTEXTUREIMAGE2DEXTPROC)&ProfilingTableDecorator::m_glCopyTextureImage2DEXT_profiling;
+if(this->m_ptr_glVertex2d)this->m_ptr_glVertex2d = (FunctionTable::MEMBERPFNGLVERTEX2DPROC)&ProfilingTableDecorator::m_glVertex2d_profiling;
+if(this->m_ptr_glSecondaryColor3bvEXT)this->m_ptr_glSecondaryColor3bvEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3BVEXTPROC)&ProfilingTableDecorator::m_glSecondaryColor3bvEXT_profiling;
+if(this->m_ptr_glMultiTexCoord4fARB)this->m_ptr_glMultiTexCoord4fARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4FARBPROC)&ProfilingTableDecorator::m_glMultiTexCoord4fARB_profiling;
+if(this->m_ptr_glPolygonOffset)this->m_ptr_glPolygonOffset = (FunctionTable::MEMBERPFNGLPOLYGONOFFSETPROC)&ProfilingTableDecorator::m_glPolygonOffset_profiling;
+if(this->m_ptr_glTangent3bvEXT)this->m_ptr_glTangent3bvEXT = (FunctionTable::MEMBERPFNGLTANGENT3BVEXTPROC)&ProfilingTableDecorator::m_glTangent3bvEXT_profiling;
+if(this->m_ptr_glHistogram)this->m_ptr_glHistogram = (FunctionTable::MEMBERPFNGLHISTOGRAMPROC)&ProfilingTableDecorator::m_glHistogram_profiling;
+if(this->m_ptr_glGetProgramiv)this->m_ptr_glGetProgramiv = (FunctionTable::MEMBERPFNGLGETPROGRAMIVPROC)&ProfilingTableDecorator::m_glGetProgramiv_profiling;
+if(this->m_ptr_glMatrixIndexubvARB)this->m_ptr_glMatrixIndexubvARB = (FunctionTable::MEMBERPFNGLMATRIXINDEXUBVARBPROC)&ProfilingTableDecorator::m_glMatrixIndexubvARB_profiling;
+if(this->m_ptr_glVertex2s)this->m_ptr_glVertex2s = (FunctionTable::MEMBERPFNGLVERTEX2SPROC)&ProfilingTableDecorator::m_glVertex2s_profiling;
+if(this->m_ptr_glGetVertexAttribLui64vNV)this->m_ptr_glGetVertexAttribLui64vNV = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBLUI64VNVPROC)&ProfilingTableDecorator::m_glGetVertexAttribLui64vNV_profiling;
+if(this->m_ptr_glGetProgramStringARB)this->m_ptr_glGetProgramStringARB = (FunctionTable::MEMBERPFNGLGETPROGRAMSTRINGARBPROC)&ProfilingTableDecorator::m_glGetProgramStringARB_profiling;
+if(this->m_ptr_glFlushMappedBufferRange)this->m_ptr_glFlushMappedBufferRange = (FunctionTable::MEMBERPFNGLFLUSHMAPPEDBUFFERRANGEPROC)&ProfilingTableDecorator::m_glFlushMappedBufferRange_profiling;
+if(this->m_ptr_glVertexAttribI3uiEXT)this->m_ptr_glVertexAttribI3uiEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI3UIEXTPROC)&ProfilingTableDecorator::m_glVertexAttribI3uiEXT_profiling;
+if(this->m_ptr_glLineWidthxOES)this->m_ptr_glLineWidthxOES = (FunctionTable::MEMBERPFNGLLINEWIDTHXOESPROC)&ProfilingTableDecorator::m_glLineWidthxOES_profiling;
+if(this->m_ptr_glProgramUniformMatrix2fvEXT)this->m_ptr_glProgramUniformMatrix2fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2FVEXTPROC)&ProfilingTableDecorator::m_glProgramUniformMatrix2fvEXT_profiling;
+if(this->m_ptr_glGetTextureParameterIuivEXT)this->m_ptr_glGetTextureParameterIuivEXT = (FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERIUIVEXTPROC)&ProfilingTableDecorator::m_glGetTextureParameterIuivEXT_profiling;
+if(this->m_ptr_glGetMultiTexEnvivEXT)this->m_ptr_glGetMultiTexEnvivEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXENVIVEXTPROC)&ProfilingTableDecorator::m_glGetMultiTexEnvivEXT_profiling;
+if(this->m_ptr_glPixelTexGenParameterivSGIS)this->m_ptr_glPixelTexGenParameterivSGIS = (FunctionTable::MEMBERPFNGLPIXELTEXGENPARAMETERIVSGISPROC)&ProfilingTableDecorator::m_glPixelTexGenParameterivSGIS_profiling;
+if(this->m_ptr_glGenQueries)this->m_ptr_glGenQueries = (FunctionTable::MEMBERPFNGLGENQUERIESPROC)&ProfilingTableDecorator::m_glGenQueries_profiling;
+if(this->m_ptr_glGetPixelMapfv)this->m_ptr_glGetPixelMapfv = (FunctionTable::MEMBERPFNGLGETPIXELMAPFVPROC)&ProfilingTableDecorator::m_glGetPixelMapfv_profiling;
+if(this->m_ptr_glBlendColorEXT)this->m_ptr_glBlendColorEXT = (FunctionTable::MEMBERPFNGLBLENDCOLOREXTPROC)&ProfilingTableDecorator::m_glBlendColorEXT_profiling;
+if(this->m_ptr_glResetMinmax)this->m_ptr_glResetMinmax = (FunctionTable::MEMBERPFNGLRESETMINMAXPROC)&ProfilingTableDecorator::m_glResetMinmax_profiling;
+if(this->m_ptr_glGetnUniformivARB)this->m_ptr_glGetnUniformivARB = (FunctionTable::MEMBERPFNGLGETNUNIFORMIVARBPROC)&ProfilingTableDecorator::m_glGetnUniformivARB_profiling;
+if(this->m_ptr_glVertexBlendARB)this->m_ptr_glVertexBlendARB = (FunctionTable::MEMBERPFNGLVERTEXBLENDARBPROC)&ProfilingTableDecorator::m_glVertexBlendARB_profiling;
+if(this->m_ptr_glVertexAttrib4d)this->m_ptr_glVertexAttrib4d = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4DPROC)&ProfilingTableDecorator::m_glVertexAttrib4d_profiling;
+if(this->m_ptr_glGetVaryingLocationNV)this->m_ptr_glGetVaryingLocationNV = (FunctionTable::MEMBERPFNGLGETVARYINGLOCATIONNVPROC)&ProfilingTableDecorator::m_glGetVaryingLocationNV_profiling;
+if(this->m_ptr_glGetMapAttribParameterivNV)this->m_ptr_glGetMapAttribParameterivNV = (FunctionTable::MEMBERPFNGLGETMAPATTRIBPARAMETERIVNVPROC)&ProfilingTableDecorator::m_glGetMapAttribParameterivNV_profiling;
+if(this->m_ptr_glTexSubImage3D)this->m_ptr_glTexSubImage3D = (FunctionTable::MEMBERPFNGLTEXSUBIMAGE3DPROC)&ProfilingTableDecorator::m_glTexSubImage3D_profiling;
+if(this->m_ptr_glDeleteSamplers)this->m_ptr_glDeleteSamplers = (FunctionTable::MEMBERPFNGLDELETESAMPLERSPROC)&ProfilingTableDecorator::m_glDeleteSamplers_profiling;
+if(this->m_ptr_glGetLightxOES)this->m_ptr_glGetLightxOES = (FunctionTable::MEMBERPFNGLGETLIGHTXOESPROC)&ProfilingTableDecorator::m_glGetLightxOES_profiling;
+if(this->m_ptr_glGetVertexAttribArrayObjectfvATI)this->m_ptr_glGetVertexAttribArrayObjectfvATI = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBARRAYOBJECTFVATIPROC)&ProfilingTableDecorator::m_glGetVertexAttribArrayObjectfvATI_profiling;
+if(this->m_ptr_glVertexArrayNormalOffsetEXT)this->m_ptr_glVertexArrayNormalOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYNORMALOFFSETEXTPROC)&ProfilingTableDecorator::m_glVertexArrayNormalOffsetEXT_profiling;
+if(this->m_ptr_glGetBufferParameterivARB)this->m_ptr_glGetBufferParameterivARB = (FunctionTable::MEMBERPFNGLGETBUFFERPARAMETERIVARBPROC)&ProfilingTableDecorator::m_glGetBufferParameterivARB_profiling;
+if(this->m_ptr_glGetTextureParameterfv)this->m_ptr_glGetTextureParameterfv = (FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERFVPROC)&ProfilingTableDecorator::m_glGetTextureParameterfv_profiling;
+if(this->m_ptr_glDrawMeshArraysSUN)this->m_ptr_glDrawMeshArraysSUN = (FunctionTable::MEMBERPFNGLDRAWMESHARRAYSSUNPROC)&ProfilingTableDecorator::m_glDrawMeshArraysSUN_profiling;
+if(this->m_ptr_glVertexAttrib4dNV)this->m_ptr_glVertexAttrib4dNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4DNVPROC)&ProfilingTableDecorator::m_glVertexAttrib4dNV_profiling;
+if(this->m_ptr_glGetMultisamplefvNV)this->m_ptr_glGetMultisamplefvNV = (FunctionTable::MEMBERPFNGLGETMULTISAMPLEFVNVPROC)&ProfilingTableDecorator::m_glGetMultisamplefvNV_profiling;
+if(this->m_ptr_glMapObjectBufferATI)this->m_ptr_glMapObjectBufferATI = (FunctionTable::MEMBERPFNGLMAPOBJECTBUFFERATIPROC)&ProfilingTableDecorator::m_glMapObjectBufferATI_profiling;
+if(this->m_ptr_glGetPathCommandsNV)this->m_ptr_glGetPathCommandsNV = (FunctionTable::MEMBERPFNGLGETPATHCOMMANDSNVPROC)&ProfilingTableDecorator::m_glGetPathCommandsNV_profiling;
+if(this->m_ptr_glVertexArrayTexCoordOffsetEXT)this->m_ptr_glVertexArrayTexCoordOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYTEXCOORDOFFSETEXTPROC)&ProfilingTableDecorator::m_glVertexArrayTexCoordOffsetEXT_profiling;
+if(this->m_ptr_glGetHistogram)this->m_ptr_glGetHistogram = (FunctionTable::MEMBERPFNGLGETHISTOGRAMPROC)&ProfilingTableDecorator::m_glGetHistogram_profiling;
+if(this->m_ptr_glMatrixMode)this->m_ptr_glMatrixMode = (FunctionTable::MEMBERPFNGLMATRIXMODEPROC)&ProfilingTableDecorator::m_glMatrixMode_profiling;
+if(this->m_ptr_glColorFormatNV)this->m_ptr_glColorFormatNV = (FunctionTable::MEMBERPFNGLCOLORFORMATNVPROC)&ProfilingTableDecorator::m_glColorFormatNV_profiling;
+if(this->m_ptr_glProgramUniformui64NV)this->m_ptr_glProgramUniformui64NV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMUI64NVPROC)&ProfilingTableDecorator::m_glProgramUniformui64NV_profiling;
+if(this->m_ptr_glProgramUniformMatrix4x2fvEXT)this->m_ptr_glProgramUniformMatrix4x2fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X2FVEXTPROC)&ProfilingTableDecorator::m_glProgramUniformMatrix4x2fvEXT_profiling;
+if(this->m_ptr_glLoadMatrixxOES)this->m_ptr_glLoadMatrixxOES = (FunctionTable::MEMBERPFNGLLOADMATRIXXOESPROC)&ProfilingTableDecorator::m_glLoadMatrixxOES_profiling;
+if(this->m_ptr_glGetColorTableParameterfvEXT)this->m_ptr_glGetColorTableParameterfvEXT = (FunctionTable::MEMBERPFNGLGETCOLORTABLEPARAMETERFVEXTPROC)&ProfilingTableDecorator::m_glGetColorTableParameterfvEXT_profiling;
+if(this->m_ptr_glRasterPos4i)this->m_ptr_glRasterPos4i = (FunctionTable::MEMBERPFNGLRASTERPOS4IPROC)&ProfilingTableDecorator::m_glRasterPos4i_profiling;
+if(this->m_ptr_glVertexAttribL2i64NV)this->m_ptr_glVertexAttribL2i64NV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL2I64NVPROC)&ProfilingTableDecorator::m_glVertexAttribL2i64NV_profiling;
+if(this->m_ptr_glBindTextures)this->m_ptr_glBindTextures = (FunctionTable::MEMBERPFNGLBINDTEXTURESPROC)&ProfilingTableDecorator::m_glBindTextures_profiling;
+if(this->m_ptr_glMatrixRotatefEXT)this->m_ptr_glMatrixRotatefEXT = (FunctionTable::MEMBERPFNGLMATRIXROTATEFEXTPROC)&ProfilingTableDecorator::m_glMatrixRotatefEXT_profiling;
+if(this->m_ptr_glGetClipPlanexOES)this->m_ptr_glGetClipPlanexOES = (FunctionTable::MEMBERPFNGLGETCLIPPLANEXOESPROC)&ProfilingTableDecorator::m_glGetClipPlanexOES_profiling;
+if(this->m_ptr_glSecondaryColor3uivEXT)this->m_ptr_glSecondaryColor3uivEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UIVEXTPROC)&ProfilingTableDecorator::m_glSecondaryColor3uivEXT_profiling;
+if(this->m_ptr_glGetPerfQueryInfoINTEL)this->m_ptr_glGetPerfQueryInfoINTEL = (FunctionTable::MEMBERPFNGLGETPERFQUERYINFOINTELPROC)&ProfilingTableDecorator::m_glGetPerfQueryInfoINTEL_profiling;
+if(this->m_ptr_glGetDoublev)this->m_ptr_glGetDoublev = (FunctionTable::MEMBERPFNGLGETDOUBLEVPROC)&ProfilingTableDecorator::m_glGetDoublev_profiling;
+if(this->m_ptr_glBindBufferRangeEXT)this->m_ptr_glBindBufferRangeEXT = (FunctionTable::MEMBERPFNGLBINDBUFFERRANGEEXTPROC)&ProfilingTableDecorator::m_glBindBufferRangeEXT_profiling;
+if(this->m_ptr_glCompressedTexImage2D)this->m_ptr_glCompressedTexImage2D = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXIMAGE2DPROC)&ProfilingTableDecorator::m_glCompressedTexImage2D_profiling;
+if(this->m_ptr_glMapBufferARB)this->m_ptr_glMapBufferARB = (FunctionTable::MEMBERPFNGLMAPBUFFERARBPROC)&ProfilingTableDecorator::m_glMapBufferARB_profiling;
+if(this->m_ptr_glGetPathSpacingNV)this->m_ptr_glGetPathSpacingNV = (FunctionTable::MEMBERPFNGLGETPATHSPACINGNVPROC)&ProfilingTableDecorator::m_glGetPathSpacingNV_profiling;
+if(this->m_ptr_glUniform4dv)this->m_ptr_glUniform4dv = (FunctionTable::MEMBERPFNGLUNIFORM4DVPROC)&ProfilingTableDecorator::m_glUniform4dv_profiling;
+if(this->m_ptr_glGlobalAlphaFactordSUN)this->m_ptr_glGlobalAlphaFactordSUN = (FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORDSUNPROC)&ProfilingTableDecorator::m_glGlobalAlphaFactordSUN_profiling;
+if(this->m_ptr_glProgramUniform3dv)this->m_ptr_glProgramUniform3dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3DVPROC)&ProfilingTableDecorator::m_glProgramUniform3dv_profiling;
+if(this->m_ptr_glGetShaderSourceARB)this->m_ptr_glGetShaderSourceARB = (FunctionTable::MEMBERPFNGLGETSHADERSOURCEARBPROC)&ProfilingTableDecorator::m_glGetShaderSourceARB_profiling;
+if(this->m_ptr_glVertexAttrib3dvARB)this->m_ptr_glVertexAttrib3dvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3DVARBPROC)&ProfilingTableDecorator::m_glVertexAttrib3dvARB_profiling;
+if(this->m_ptr_glInvalidateBufferData)this->m_ptr_glInvalidateBufferData = (FunctionTable::MEMBERPFNGLINVALIDATEBUFFERDATAPROC)&ProfilingTableDecorator::m_glInvalidateBufferData_profiling;
+if(this->m_ptr_glMatrixLoad3x2fNV)this->m_ptr_glMatrixLoad3x2fNV = (FunctionTable::MEMBERPFNGLMATRIXLOAD3X2FNVPROC)&ProfilingTableDecorator::m_glMatrixLoad3x2fNV_profiling;
+if(this->m_ptr_glCompressedTextureSubImage1D)this->m_ptr_glCompressedTextureSubImage1D = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC)&ProfilingTableDecorator::m_glCompressedTextureSubImage1D_profiling;
+if(this->m_ptr_glTexCoord3xvOES)this->m_ptr_glTexCoord3xvOES = (FunctionTable::MEMBERPFNGLTEXCOORD3XVOESPROC)&ProfilingTableDecorator::m_glTexCoord3xvOES_profiling;
+if(this->m_ptr_glGenTexturesEXT)this->m_ptr_glGenTexturesEXT = (FunctionTable::MEMBERPFNGLGENTEXTURESEXTPROC)&ProfilingTableDecorator::m_glGenTexturesEXT_profiling;
+if(this->m_ptr_glTangent3iEXT)this->m_ptr_glTangent3iEXT = (FunctionTable::MEMBERPFNGLTANGENT3IEXTPROC)&ProfilingTableDecorator::m_glTangent3iEXT_profiling;
+if(this->m_ptr_glClearTexImage)this->m_ptr_glClearTexImage = (FunctionTable::MEMBERPFNGLCLEARTEXIMAGEPROC)&ProfilingTableDecorator::m_glClearTexImage_profiling;
+if(this->m_ptr_glBinormal3bvEXT)this->m_ptr_glBinormal3bvEXT = (FunctionTable::MEMBERPFNGLBINORMAL3BVEXTPROC)&ProfilingTableDecorator::m_glBinormal3bvEXT_profiling;
+if(this->m_ptr_glUniform3fv)this->m_ptr_glUniform3fv = (FunctionTable::MEMBERPFNGLUNIFORM3FVPROC)&ProfilingTableDecorator::m_glUniform3fv_profiling;
+if(this->m_ptr_glGetnPixelMapusvARB)this->m_ptr_glGetnPixelMapusvARB = (FunctionTable::MEMBERPFNGLGETNPIXELMAPUSVARBPROC)&ProfilingTableDecorator::m_glGetnPixelMapusvARB_profiling;
+if(this->m_ptr_glMultiTexCoordP1ui)this->m_ptr_glMultiTexCoordP1ui = (FunctionTable::MEMBERPFNGLMULTITEXCOORDP1UIPROC)&ProfilingTableDecorator::m_glMultiTexCoordP1ui_profiling;
+if(this->m_ptr_glClearNamedBufferDataEXT)this->m_ptr_glClearNamedBufferDataEXT = (FunctionTable::MEMBERPFNGLCLEARNAMEDBUFFERDATAEXTPROC)&ProfilingTableDecorator::m_glClearNamedBufferDataEXT_profiling;
+if(this->m_ptr_glUniformMatrix4dv)this->m_ptr_glUniformMatrix4dv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX4DVPROC)&ProfilingTableDecorator::m_glUniformMatrix4dv_profiling;
+if(this->m_ptr_glWindowPos3fMESA)this->m_ptr_glWindowPos3fMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS3FMESAPROC)&ProfilingTableDecorator::m_glWindowPos3fMESA_profiling;
+if(this->m_ptr_glDeleteRenderbuffers)this->m_ptr_glDeleteRenderbuffers = (FunctionTable::MEMBERPFNGLDELETERENDERBUFFERSPROC)&ProfilingTableDecorator::m_glDeleteRenderbuffers_profiling;
+if(this->m_ptr_glGetTextureLevelParameterfvEXT)this->m_ptr_glGetTextureLevelParameterfvEXT = (FunctionTable::MEMBERPFNGLGETTEXTURELEVELPARAMETERFVEXTPROC)&ProfilingTableDecorator::m_glGetTextureLevelParameterfvEXT_profiling;
+if(this->m_ptr_glGetHistogramParameterxvOES)this->m_ptr_glGetHistogramParameterxvOES = (FunctionTable::MEMBERPFNGLGETHISTOGRAMPARAMETERXVOESPROC)&ProfilingTableDecorator::m_glGetHistogramParameterxvOES_profiling;
+if(this->m_ptr_glMultiDrawElements)this->m_ptr_glMultiDrawElements = (FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSPROC)&ProfilingTableDecorator::m_glMultiDrawElements_profiling;
+if(this->m_ptr_glMakeImageHandleNonResidentNV)this->m_ptr_glMakeImageHandleNonResidentNV = (FunctionTable::MEMBERPFNGLMAKEIMAGEHANDLENONRESIDENTNVPROC)&ProfilingTableDecorator::m_glMakeImageHandleNonResidentNV_profiling;
+if(this->m_ptr_glTexSubImage1DEXT)this->m_ptr_glTexSubImage1DEXT = (FunctionTable::MEMBERPFNGLTEXSUBIMAGE1DEXTPROC)&ProfilingTableDecorator::m_glTexSubImage1DEXT_profiling;
+if(this->m_ptr_glNormalStream3dATI)this->m_ptr_glNormalStream3dATI = (FunctionTable::MEMBERPFNGLNORMALSTREAM3DATIPROC)&ProfilingTableDecorator::m_glNormalStream3dATI_profiling;
+if(this->m_ptr_glVertexAttribL4i64vNV)this->m_ptr_glVertexAttribL4i64vNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL4I64VNVPROC)&ProfilingTableDecorator::m_glVertexAttribL4i64vNV_profiling;
+if(this->m_ptr_glDrawBuffers)this->m_ptr_glDrawBuffers = (FunctionTable::MEMBERPFNGLDRAWBUFFERSPROC)&ProfilingTableDecorator::m_glDrawBuffers_profiling;
+if(this->m_ptr_glCopyTextureSubImage1DEXT)this->m_ptr_glCopyTextureSubImage1DEXT = (FunctionTable::MEMBERPFNGLCOPYTEXTURESUBIMAGE1DEXTPROC)&ProfilingTableDecorator::m_glCopyTextureSubImage1DEXT_profiling;
+if(this->m_ptr_glWindowRectanglesEXT)this->m_ptr_glWindowRectanglesEXT = (FunctionTable::MEMBERPFNGLWINDOWRECTANGLESEXTPROC)&ProfilingTableDecorator::m_glWindowRectanglesEXT_profiling;
+if(this->m_ptr_glNamedFramebufferReadBuffer)this->m_ptr_glNamedFramebufferReadBuffer = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERREADBUFFERPROC)&ProfilingTableDecorator::m_glNamedFramebufferReadBuffer_profiling;
+if(this->m_ptr_glUniform2i64vARB)this->m_ptr_glUniform2i64vARB = (FunctionTable::MEMBERPFNGLUNIFORM2I64VARBPROC)&ProfilingTableDecorator::m_glUniform2i64vARB_profiling;
+if(this->m_ptr_glVertexAttribI1uivEXT)this->m_ptr_glVertexAttribI1uivEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI1UIVEXTPROC)&ProfilingTableDecorator::m_glVertexAttribI1uivEXT_profiling;
+if(this->m_ptr_glGetTexGenfv)this->m_ptr_glGetTexGenfv = (FunctionTable::MEMBERPFNGLGETTEXGENFVPROC)&ProfilingTableDecorator::m_glGetTexGenfv_profiling;
+if(this->m_ptr_glBeginQueryARB)this->m_ptr_glBeginQueryARB = (FunctionTable::MEMBERPFNGLBEGINQUERYARBPROC)&ProfilingTableDecorator::m_glBeginQueryARB_profiling;
+if(this->m_ptr_glUniform1iARB)this->m_ptr_glUniform1iARB = (FunctionTable::MEMBERPFNGLUNIFORM1IARBPROC)&ProfilingTableDecorator::m_glUniform1iARB_profiling;
+if(this->m_ptr_glVertex4bvOES)this->m_ptr_glVertex4bvOES = (FunctionTable::MEMBERPFNGLVERTEX4BVOESPROC)&ProfilingTableDecorator::m_glVertex4bvOES_profiling;
+if(this->m_ptr_glInvalidateSubFramebuffer)this->m_ptr_glInvalidateSubFramebuffer = (FunctionTable::MEMBERPFNGLINVALIDATESUBFRAMEBUFFERPROC)&ProfilingTableDecorator::m_glInvalidateSubFramebuffer_profiling;
+if(this->m_ptr_glUniform1fvARB)this->m_ptr_glUniform1fvARB = (FunctionTable::MEMBERPFNGLUNIFORM1FVARBPROC)&ProfilingTableDecorator::m_glUniform1fvARB_profiling;
+if(this->m_ptr_glTestFenceNV)this->m_ptr_glTestFenceNV = (FunctionTable::MEMBERPFNGLTESTFENCENVPROC)&ProfilingTableDecorator::m_glTestFenceNV_profiling;
+if(this->m_ptr_glBindTransformFeedback)this->m_ptr_glBindTransformFeedback = (FunctionTable::MEMBERPFNGLBINDTRANSFORMFEEDBACKPROC)&ProfilingTableDecorator::m_glBindTransformFeedback_profiling;
+if(this->m_ptr_glMultiTexCoord2iv)this->m_ptr_glMultiTexCoord2iv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2IVPROC)&ProfilingTableDecorator::m_glMultiTexCoord2iv_profiling;
+if(this->m_ptr_glCopyMultiTexSubImage1DEXT)this->m_ptr_glCopyMultiTexSubImage1DEXT = (FunctionTable::MEMBERPFNGLCOPYMULTITEXSUBIMAGE1DEXTPROC)&ProfilingTableDecorator::m_glCopyMultiTexSubImage1DEXT_profiling;
+if(this->m_ptr_glVariantbvEXT)this->m_ptr_glVariantbvEXT = (FunctionTable::MEMBERPFNGLVARIANTBVEXTPROC)&ProfilingTableDecorator::m_glVariantbvEXT_profiling;
+if(this->m_ptr_glTexCoord1hNV)this->m_ptr_glTexCoord1hNV = (FunctionTable::MEMBERPFNGLTEXCOORD1HNVPROC)&ProfilingTableDecorator::m_glTexCoord1hNV_profiling;
+if(this->m_ptr_glGenFencesNV)this->m_ptr_glGenFencesNV = (FunctionTable::MEMBERPFNGLGENFENCESNVPROC)&ProfilingTableDecorator::m_glGenFencesNV_profiling;
+if(this->m_ptr_glRasterPos3iv)this->m_ptr_glRasterPos3iv = (FunctionTable::MEMBERPFNGLRASTERPOS3IVPROC)&ProfilingTableDecorator::m_glRasterPos3iv_profiling;
+if(this->m_ptr_glVertexAttribL2ui64NV)this->m_ptr_glVertexAttribL2ui64NV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL2UI64NVPROC)&ProfilingTableDecorator::m_glVertexAttribL2ui64NV_profiling;
+if(this->m_ptr_glMultiTexCoord1hvNV)this->m_ptr_glMultiTexCoord1hvNV = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1HVNVPROC)&ProfilingTableDecorator::m_glMultiTexCoord1hvNV_profiling;
+if(this->m_ptr_glGetnConvolutionFilter)this->m_ptr_glGetnConvolutionFilter = (FunctionTable::MEMBERPFNGLGETNCONVOLUTIONFILTERPROC)&ProfilingTableDecorator::m_glGetnConvolutionFilter_profiling;
+if(this->m_ptr_glNormal3bv)this->m_ptr_glNormal3bv = (FunctionTable::MEMBERPFNGLNORMAL3BVPROC)&ProfilingTableDecorator::m_glNormal3bv_profiling;
+if(this->m_ptr_glWeightbvARB)this->m_ptr_glWeightbvARB = (FunctionTable::MEMBERPFNGLWEIGHTBVARBPROC)&ProfilingTableDecorator::m_glWeightbvARB_profiling;
+if(this->m_ptr_glTexCoord4sv)this->m_ptr_glTexCoord4sv = (FunctionTable::MEMBERPFNGLTEXCOORD4SVPROC)&ProfilingTableDecorator::m_glTexCoord4sv_profiling;
+if(this->m_ptr_glUniform2uiv)this->m_ptr_glUniform2uiv = (FunctionTable::MEMBERPFNGLUNIFORM2UIVPROC)&ProfilingTableDecorator::m_glUniform2uiv_profiling;
+if(this->m_ptr_glBeginConditionalRenderNVX)this->m_ptr_glBeginConditionalRenderNVX = (FunctionTable::MEMBERPFNGLBEGINCONDITIONALRENDERNVXPROC)&ProfilingTableDecorator::m_glBeginConditionalRenderNVX_profiling;
+if(this->m_ptr_glFinish)this->m_ptr_glFinish = (FunctionTable::MEMBERPFNGLFINISHPROC)&ProfilingTableDecorator::m_glFinish_profiling;
+if(this->m_ptr_glColorTableParameterfv)this->m_ptr_glColorTableParameterfv = (FunctionTable::MEMBERPFNGLCOLORTABLEPARAMETERFVPROC)&ProfilingTableDecorator::m_glColorTableParameterfv_profiling;
+if(this->m_ptr_glFragmentCoverageColorNV)this->m_ptr_glFragmentCoverageColorNV = (FunctionTable::MEMBERPFNGLFRAGMENTCOVERAGECOLORNVPROC)&ProfilingTableDecorator::m_glFragmentCoverageColorNV_profiling;
+if(this->m_ptr_glProgramUniform3ivEXT)this->m_ptr_glProgramUniform3ivEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3IVEXTPROC)&ProfilingTableDecorator::m_glProgramUniform3ivEXT_profiling;
+if(this->m_ptr_glVertexArrayVertexOffsetEXT)this->m_ptr_glVertexArrayVertexOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXOFFSETEXTPROC)&ProfilingTableDecorator::m_glVertexArrayVertexOffsetEXT_profiling;
+if(this->m_ptr_glViewportPositionWScaleNV)this->m_ptr_glViewportPositionWScaleNV = (FunctionTable::MEMBERPFNGLVIEWPORTPOSITIONWSCALENVPROC)&ProfilingTableDecorator::m_glViewportPositionWScaleNV_profiling;
+if(this->m_ptr_glGetProgramLocalParameterIuivNV)this->m_ptr_glGetProgramLocalParameterIuivNV = (FunctionTable::MEMBERPFNGLGETPROGRAMLOCALPARAMETERIUIVNVPROC)&ProfilingTableDecorator::m_glGetProgramLocalParameterIuivNV_profiling;
+if(this->m_ptr_glReplacementCodeuiTexCoord2fVertex3fvSUN)this->m_ptr_glReplacementCodeuiTexCoord2fVertex3fvSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUITEXCOORD2FVERTEX3FVSUNPROC)&ProfilingTableDecorator::m_glReplacementCodeuiTexCoord2fVertex3fvSUN_profiling;
+if(this->m_ptr_glUniform1uiv)this->m_ptr_glUniform1uiv = (FunctionTable::MEMBERPFNGLUNIFORM1UIVPROC)&ProfilingTableDecorator::m_glUniform1uiv_profiling;
+if(this->m_ptr_glUniformMatrix2dv)this->m_ptr_glUniformMatrix2dv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX2DVPROC)&ProfilingTableDecorator::m_glUniformMatrix2dv_profiling;
+if(this->m_ptr_glIndexdv)this->m_ptr_glIndexdv = (FunctionTable::MEMBERPFNGLINDEXDVPROC)&ProfilingTableDecorator::m_glIndexdv_profiling;
+if(this->m_ptr_glSecondaryColor3ivEXT)this->m_ptr_glSecondaryColor3ivEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3IVEXTPROC)&ProfilingTableDecorator::m_glSecondaryColor3ivEXT_profiling;
+if(this->m_ptr_glTexCoord3iv)this->m_ptr_glTexCoord3iv = (FunctionTable::MEMBERPFNGLTEXCOORD3IVPROC)&ProfilingTableDecorator::m_glTexCoord3iv_profiling;
+if(this->m_ptr_glVertexStream4fvATI)this->m_ptr_glVertexStream4fvATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM4FVATIPROC)&ProfilingTableDecorator::m_glVertexStream4fvATI_profiling;
+if(this->m_ptr_glDeformationMap3fSGIX)this->m_ptr_glDeformationMap3fSGIX = (FunctionTable::MEMBERPFNGLDEFORMATIONMAP3FSGIXPROC)&ProfilingTableDecorator::m_glDeformationMap3fSGIX_profiling;
+if(this->m_ptr_glClearDepth)this->m_ptr_glClearDepth = (FunctionTable::MEMBERPFNGLCLEARDEPTHPROC)&ProfilingTableDecorator::m_glClearDepth_profiling;
+if(this->m_ptr_glGenAsyncMarkersSGIX)this->m_ptr_glGenAsyncMarkersSGIX = (FunctionTable::MEMBERPFNGLGENASYNCMARKERSSGIXPROC)&ProfilingTableDecorator::m_glGenAsyncMarkersSGIX_profiling;
+if(this->m_ptr_glDisableIndexedEXT)this->m_ptr_glDisableIndexedEXT = (FunctionTable::MEMBERPFNGLDISABLEINDEXEDEXTPROC)&ProfilingTableDecorator::m_glDisableIndexedEXT_profiling;
+if(this->m_ptr_glVertexWeightfvEXT)this->m_ptr_glVertexWeightfvEXT = (FunctionTable::MEMBERPFNGLVERTEXWEIGHTFVEXTPROC)&ProfilingTableDecorator::m_glVertexWeightfvEXT_profiling;
+if(this->m_ptr_glGetProgramLocalParameterIivNV)this->m_ptr_glGetProgramLocalParameterIivNV = (FunctionTable::MEMBERPFNGLGETPROGRAMLOCALPARAMETERIIVNVPROC)&ProfilingTableDecorator::m_glGetProgramLocalParameterIivNV_profiling;
+if(this->m_ptr_glCompressedTexImage3DARB)this->m_ptr_glCompressedTexImage3DARB = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXIMAGE3DARBPROC)&ProfilingTableDecorator::m_glCompressedTexImage3DARB_profiling;
+if(this->m_ptr_glProgramParameter4fNV)this->m_ptr_glProgramParameter4fNV = (FunctionTable::MEMBERPFNGLPROGRAMPARAMETER4FNVPROC)&ProfilingTableDecorator::m_glProgramParameter4fNV_profiling;
+if(this->m_ptr_glConvolutionParameterxOES)this->m_ptr_glConvolutionParameterxOES = (FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERXOESPROC)&ProfilingTableDecorator::m_glConvolutionParameterxOES_profiling;
+if(this->m_ptr_glInsertComponentEXT)this->m_ptr_glInsertComponentEXT = (FunctionTable::MEMBERPFNGLINSERTCOMPONENTEXTPROC)&ProfilingTableDecorator::m_glInsertComponentEXT_profiling;
+if(this->m_ptr_glCreateTextures)this->m_ptr_glCreateTextures = (FunctionTable::MEMBERPFNGLCREATETEXTURESPROC)&ProfilingTableDecorator::m_glCreateTextures_profiling;
+if(this->m_ptr_glSecondaryColor3iv)this->m_ptr_glSecondaryColor3iv = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3IVPROC)&ProfilingTableDecorator::m_glSecondaryColor3iv_profiling;
+if(this->m_ptr_glCreateBuffers)this->m_ptr_glCreateBuffers = (FunctionTable::MEMBERPFNGLCREATEBUFFERSPROC)&ProfilingTableDecorator::m_glCreateBuffers_profiling;
+if(this->m_ptr_glMultiTexCoord2xvOES)this->m_ptr_glMultiTexCoord2xvOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2XVOESPROC)&ProfilingTableDecorator::m_glMultiTexCoord2xvOES_profiling;
+if(this->m_ptr_glTexGenxvOES)this->m_ptr_glTexGenxvOES = (FunctionTable::MEMBERPFNGLTEXGENXVOESPROC)&ProfilingTableDecorator::m_glTexGenxvOES_profiling;
+if(this->m_ptr_glMultTransposeMatrixf)this->m_ptr_glMultTransposeMatrixf = (FunctionTable::MEMBERPFNGLMULTTRANSPOSEMATRIXFPROC)&ProfilingTableDecorator::m_glMultTransposeMatrixf_profiling;
+if(this->m_ptr_glBeginTransformFeedbackEXT)this->m_ptr_glBeginTransformFeedbackEXT = (FunctionTable::MEMBERPFNGLBEGINTRANSFORMFEEDBACKEXTPROC)&ProfilingTableDecorator::m_glBeginTransformFeedbackEXT_profiling;
+if(this->m_ptr_glTexCoord2fColor3fVertex3fSUN)this->m_ptr_glTexCoord2fColor3fVertex3fSUN = (FunctionTable::MEMBERPFNGLTEXCOORD2FCOLOR3FVERTEX3FSUNPROC)&ProfilingTableDecorator::m_glTexCoord2fColor3fVertex3fSUN_profiling;
+if(this->m_ptr_glNormal3sv)this->m_ptr_glNormal3sv = (FunctionTable::MEMBERPFNGLNORMAL3SVPROC)&ProfilingTableDecorator::m_glNormal3sv_profiling;
+if(this->m_ptr_glFreeObjectBufferATI)this->m_ptr_glFreeObjectBufferATI = (FunctionTable::MEMBERPFNGLFREEOBJECTBUFFERATIPROC)&ProfilingTableDecorator::m_glFreeObjectBufferATI_profiling;
+if(this->m_ptr_glBlendBarrierNV)this->m_ptr_glBlendBarrierNV = (FunctionTable::MEMBERPFNGLBLENDBARRIERNVPROC)&ProfilingTableDecorator::m_glBlendBarrierNV_profiling;
+if(this->m_ptr_glUniform4i64vNV)this->m_ptr_glUniform4i64vNV = (FunctionTable::MEMBERPFNGLUNIFORM4I64VNVPROC)&ProfilingTableDecorator::m_glUniform4i64vNV_profiling;
+if(this->m_ptr_glGetnUniformuivARB)this->m_ptr_glGetnUniformuivARB = (FunctionTable::MEMBERPFNGLGETNUNIFORMUIVARBPROC)&ProfilingTableDecorator::m_glGetnUniformuivARB_profiling;
+if(this->m_ptr_glAlphaFragmentOp3ATI)this->m_ptr_glAlphaFragmentOp3ATI = (FunctionTable::MEMBERPFNGLALPHAFRAGMENTOP3ATIPROC)&ProfilingTableDecorator::m_glAlphaFragmentOp3ATI_profiling;
+if(this->m_ptr_glProgramEnvParameters4fvEXT)this->m_ptr_glProgramEnvParameters4fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERS4FVEXTPROC)&ProfilingTableDecorator::m_glProgramEnvParameters4fvEXT_profiling;
+if(this->m_ptr_glBlendFuncSeparateEXT)this->m_ptr_glBlendFuncSeparateEXT = (FunctionTable::MEMBERPFNGLBLENDFUNCSEPARATEEXTPROC)&ProfilingTableDecorator::m_glBlendFuncSeparateEXT_profiling;
+if(this->m_ptr_glConvolutionParameterivEXT)this->m_ptr_glConvolutionParameterivEXT = (FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERIVEXTPROC)&ProfilingTableDecorator::m_glConvolutionParameterivEXT_profiling;
+if(this->m_ptr_glPixelTexGenSGIX)this->m_ptr_glPixelTexGenSGIX = (FunctionTable::MEMBERPFNGLPIXELTEXGENSGIXPROC)&ProfilingTableDecorator::m_glPixelTexGenSGIX_profiling;
+if(this->m_ptr_glDeleteProgram)this->m_ptr_glDeleteProgram = (FunctionTable::MEMBERPFNGLDELETEPROGRAMPROC)&ProfilingTableDecorator::m_glDeleteProgram_profiling;
+if(this->m_ptr_glUniformMatrix4x3dv)this->m_ptr_glUniformMatrix4x3dv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX4X3DVPROC)&ProfilingTableDecorator::m_glUniformMatrix4x3dv_profiling;
+if(this->m_ptr_glGetVideoCaptureStreamivNV)this->m_ptr_glGetVideoCaptureStreamivNV = (FunctionTable::MEMBERPFNGLGETVIDEOCAPTURESTREAMIVNVPROC)&ProfilingTableDecorator::m_glGetVideoCaptureStreamivNV_profiling;
+if(this->m_ptr_glProgramUniform4uiEXT)this->m_ptr_glProgramUniform4uiEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UIEXTPROC)&ProfilingTableDecorator::m_glProgramUniform4uiEXT_profiling;
+if(this->m_ptr_glMakeImageHandleNonResidentARB)this->m_ptr_glMakeImageHandleNonResidentARB = (FunctionTable::MEMBERPFNGLMAKEIMAGEHANDLENONRESIDENTARBPROC)&ProfilingTableDecorator::m_glMakeImageHandleNonResidentARB_profiling;
+if(this->m_ptr_glSecondaryColor3dEXT)this->m_ptr_glSecondaryColor3dEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3DEXTPROC)&ProfilingTableDecorator::m_glSecondaryColor3dEXT_profiling;
+if(this->m_ptr_glDeleteQueries)this->m_ptr_glDeleteQueries = (FunctionTable::MEMBERPFNGLDELETEQUERIESPROC)&ProfilingTableDecorator::m_glDeleteQueries_profiling;
+if(this->m_ptr_glNormalP3uiv)this->m_ptr_glNormalP3uiv = (FunctionTable::MEMBERPFNGLNORMALP3UIVPROC)&ProfilingTableDecorator::m_glNormalP3uiv_profiling;
+if(this->m_ptr_glRasterPos2d)this->m_ptr_glRasterPos2d = (FunctionTable::MEMBERPFNGLRASTERPOS2DPROC)&ProfilingTableDecorator::m_glRasterPos2d_profiling;
+if(this->m_ptr_glInitNames)this->m_ptr_glInitNames = (FunctionTable::MEMBERPFNGLINITNAMESPROC)&ProfilingTableDecorator::m_glInitNames_profiling;
+if(this->m_ptr_glBinormal3fvEXT)this->m_ptr_glBinormal3fvEXT = (FunctionTable::MEMBERPFNGLBINORMAL3FVEXTPROC)&ProfilingTableDecorator::m_glBinormal3fvEXT_profiling;
+if(this->m_ptr_glColor3dv)this->m_ptr_glColor3dv = (FunctionTable::MEMBERPFNGLCOLOR3DVPROC)&ProfilingTableDecorator::m_glColor3dv_profiling;
+if(this->m_ptr_glVertexArrayVertexAttribDivisorEXT)this->m_ptr_glVertexArrayVertexAttribDivisorEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBDIVISOREXTPROC)&ProfilingTableDecorator::m_glVertexArrayVertexAttribDivisorEXT_profiling;
+if(this->m_ptr_glArrayElementEXT)this->m_ptr_glArrayElementEXT = (FunctionTable::MEMBERPFNGLARRAYELEMENTEXTPROC)&ProfilingTableDecorator::m_glArrayElementEXT_profiling;
+if(this->m_ptr_glProgramParameter4dNV)this->m_ptr_glProgramParameter4dNV = (FunctionTable::MEMBERPFNGLPROGRAMPARAMETER4DNVPROC)&ProfilingTableDecorator::m_glProgramParameter4dNV_profiling;
+if(this->m_ptr_glIndexxOES)this->m_ptr_glIndexxOES = (FunctionTable::MEMBERPFNGLINDEXXOESPROC)&ProfilingTableDecorator::m_glIndexxOES_profiling;
+if(this->m_ptr_glUniform3uivEXT)this->m_ptr_glUniform3uivEXT = (FunctionTable::MEMBERPFNGLUNIFORM3UIVEXTPROC)&ProfilingTableDecorator::m_glUniform3uivEXT_profiling;
+if(this->m_ptr_glPopGroupMarkerEXT)this->m_ptr_glPopGroupMarkerEXT = (FunctionTable::MEMBERPFNGLPOPGROUPMARKEREXTPROC)&ProfilingTableDecorator::m_glPopGroupMarkerEXT_profiling;
+if(this->m_ptr_glClearNamedFramebufferuiv)this->m_ptr_glClearNamedFramebufferuiv = (FunctionTable::MEMBERPFNGLCLEARNAMEDFRAMEBUFFERUIVPROC)&ProfilingTableDecorator::m_glClearNamedFramebufferuiv_profiling;
+if(this->m_ptr_glSetLocalConstantEXT)this->m_ptr_glSetLocalConstantEXT = (FunctionTable::MEMBERPFNGLSETLOCALCONSTANTEXTPROC)&ProfilingTableDecorator::m_glSetLocalConstantEXT_profiling;
+if(this->m_ptr_glProgramUniform1ui64NV)this->m_ptr_glProgramUniform1ui64NV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UI64NVPROC)&ProfilingTableDecorator::m_glProgramUniform1ui64NV_profiling;
+if(this->m_ptr_glColor4hvNV)this->m_ptr_glColor4hvNV = (FunctionTable::MEMBERPFNGLCOLOR4HVNVPROC)&ProfilingTableDecorator::m_glColor4hvNV_profiling;
+if(this->m_ptr_glGetVertexAttribfv)this->m_ptr_glGetVertexAttribfv = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBFVPROC)&ProfilingTableDecorator::m_glGetVertexAttribfv_profiling;
+if(this->m_ptr_glDispatchCompute)this->m_ptr_glDispatchCompute = (FunctionTable::MEMBERPFNGLDISPATCHCOMPUTEPROC)&ProfilingTableDecorator::m_glDispatchCompute_profiling;
+if(this->m_ptr_glGetActiveAttrib)this->m_ptr_glGetActiveAttrib = (FunctionTable::MEMBERPFNGLGETACTIVEATTRIBPROC)&ProfilingTableDecorator::m_glGetActiveAttrib_profiling;
+if(this->m_ptr_glFragmentColorMaterialSGIX)this->m_ptr_glFragmentColorMaterialSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTCOLORMATERIALSGIXPROC)&ProfilingTableDecorator::m_glFragmentColorMaterialSGIX_profiling;
+if(this->m_ptr_glTexSubImage2D)this->m_ptr_glTexSubImage2D = (FunctionTable::MEMBERPFNGLTEXSUBIMAGE2DPROC)&ProfilingTableDecorator::m_glTexSubImage2D_profiling;
+if(this->m_ptr_glGetnMinmaxARB)this->m_ptr_glGetnMinmaxARB = (FunctionTable::MEMBERPFNGLGETNMINMAXARBPROC)&ProfilingTableDecorator::m_glGetnMinmaxARB_profiling;
+if(this->m_ptr_glLogicOp)this->m_ptr_glLogicOp = (FunctionTable::MEMBERPFNGLLOGICOPPROC)&ProfilingTableDecorator::m_glLogicOp_profiling;
+if(this->m_ptr_glProgramUniformMatrix3x4fv)this->m_ptr_glProgramUniformMatrix3x4fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X4FVPROC)&ProfilingTableDecorator::m_glProgramUniformMatrix3x4fv_profiling;
+if(this->m_ptr_glWindowPos4iMESA)this->m_ptr_glWindowPos4iMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS4IMESAPROC)&ProfilingTableDecorator::m_glWindowPos4iMESA_profiling;
+if(this->m_ptr_glPixelTransferf)this->m_ptr_glPixelTransferf = (FunctionTable::MEMBERPFNGLPIXELTRANSFERFPROC)&ProfilingTableDecorator::m_glPixelTransferf_profiling;
+if(this->m_ptr_glGetTextureParameterIuiv)this->m_ptr_glGetTextureParameterIuiv = (FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERIUIVPROC)&ProfilingTableDecorator::m_glGetTextureParameterIuiv_profiling;
+if(this->m_ptr_glMultiTexCoord1xOES)this->m_ptr_glMultiTexCoord1xOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1XOESPROC)&ProfilingTableDecorator::m_glMultiTexCoord1xOES_profiling;
+if(this->m_ptr_glProgramUniformMatrix4dv)this->m_ptr_glProgramUniformMatrix4dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4DVPROC)&ProfilingTableDecorator::m_glProgramUniformMatrix4dv_profiling;
+if(this->m_ptr_glGetnUniformiv)this->m_ptr_glGetnUniformiv = (FunctionTable::MEMBERPFNGLGETNUNIFORMIVPROC)&ProfilingTableDecorator::m_glGetnUniformiv_profiling;
+if(this->m_ptr_glFramebufferTexture1DEXT)this->m_ptr_glFramebufferTexture1DEXT = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURE1DEXTPROC)&ProfilingTableDecorator::m_glFramebufferTexture1DEXT_profiling;
+if(this->m_ptr_glVertexPointervINTEL)this->m_ptr_glVertexPointervINTEL = (FunctionTable::MEMBERPFNGLVERTEXPOINTERVINTELPROC)&ProfilingTableDecorator::m_glVertexPointervINTEL_profiling;
+if(this->m_ptr_glTextureParameterIiv)this->m_ptr_glTextureParameterIiv = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIIVPROC)&ProfilingTableDecorator::m_glTextureParameterIiv_profiling;
+if(this->m_ptr_glGetSeparableFilterEXT)this->m_ptr_glGetSeparableFilterEXT = (FunctionTable::MEMBERPFNGLGETSEPARABLEFILTEREXTPROC)&ProfilingTableDecorator::m_glGetSeparableFilterEXT_profiling;
+if(this->m_ptr_glMultiTexCoord3iARB)this->m_ptr_glMultiTexCoord3iARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3IARBPROC)&ProfilingTableDecorator::m_glMultiTexCoord3iARB_profiling;
+if(this->m_ptr_glRasterPos4xvOES)this->m_ptr_glRasterPos4xvOES = (FunctionTable::MEMBERPFNGLRASTERPOS4XVOESPROC)&ProfilingTableDecorator::m_glRasterPos4xvOES_profiling;
+if(this->m_ptr_glDrawTransformFeedbackStream)this->m_ptr_glDrawTransformFeedbackStream = (FunctionTable::MEMBERPFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC)&ProfilingTableDecorator::m_glDrawTransformFeedbackStream_profiling;
+if(this->m_ptr_glVertex3hvNV)this->m_ptr_glVertex3hvNV = (FunctionTable::MEMBERPFNGLVERTEX3HVNVPROC)&ProfilingTableDecorator::m_glVertex3hvNV_profiling;
+if(this->m_ptr_glVertexArrayMultiTexCoordOffsetEXT)this->m_ptr_glVertexArrayMultiTexCoordOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYMULTITEXCOORDOFFSETEXTPROC)&ProfilingTableDecorator::m_glVertexArrayMultiTexCoordOffsetEXT_profiling;
+if(this->m_ptr_glProvokingVertex)this->m_ptr_glProvokingVertex = (FunctionTable::MEMBERPFNGLPROVOKINGVERTEXPROC)&ProfilingTableDecorator::m_glProvokingVertex_profiling;
+if(this->m_ptr_glAccumxOES)this->m_ptr_glAccumxOES = (FunctionTable::MEMBERPFNGLACCUMXOESPROC)&ProfilingTableDecorator::m_glAccumxOES_profiling;
+if(this->m_ptr_glShaderBinary)this->m_ptr_glShaderBinary = (FunctionTable::MEMBERPFNGLSHADERBINARYPROC)&ProfilingTableDecorator::m_glShaderBinary_profiling;
+if(this->m_ptr_glGetMultiTexGenivEXT)this->m_ptr_glGetMultiTexGenivEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXGENIVEXTPROC)&ProfilingTableDecorator::m_glGetMultiTexGenivEXT_profiling;
+if(this->m_ptr_glPointParameterxvOES)this->m_ptr_glPointParameterxvOES = (FunctionTable::MEMBERPFNGLPOINTPARAMETERXVOESPROC)&ProfilingTableDecorator::m_glPointParameterxvOES_profiling;
+if(this->m_ptr_glCreateStatesNV)this->m_ptr_glCreateStatesNV = (FunctionTable::MEMBERPFNGLCREATESTATESNVPROC)&ProfilingTableDecorator::m_glCreateStatesNV_profiling;
+if(this->m_ptr_glClearDepthdNV)this->m_ptr_glClearDepthdNV = (FunctionTable::MEMBERPFNGLCLEARDEPTHDNVPROC)&ProfilingTableDecorator::m_glClearDepthdNV_profiling;
+if(this->m_ptr_glClearColorIuiEXT)this->m_ptr_glClearColorIuiEXT = (FunctionTable::MEMBERPFNGLCLEARCOLORIUIEXTPROC)&ProfilingTableDecorator::m_glClearColorIuiEXT_profiling;
+if(this->m_ptr_glBindMultiTextureEXT)this->m_ptr_glBindMultiTextureEXT = (FunctionTable::MEMBERPFNGLBINDMULTITEXTUREEXTPROC)&ProfilingTableDecorator::m_glBindMultiTextureEXT_profiling;
+if(this->m_ptr_glTexGeniv)this->m_ptr_glTexGeniv = (FunctionTable::MEMBERPFNGLTEXGENIVPROC)&ProfilingTableDecorator::m_glTexGeniv_profiling;
+if(this->m_ptr_glDrawElements)this->m_ptr_glDrawElements = (FunctionTable::MEMBERPFNGLDRAWELEMENTSPROC)&ProfilingTableDecorator::m_glDrawElements_profiling;
+if(this->m_ptr_glProgramUniform4iv)this->m_ptr_glProgramUniform4iv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4IVPROC)&ProfilingTableDecorator::m_glProgramUniform4iv_profiling;
+if(this->m_ptr_glDisableVertexArrayEXT)this->m_ptr_glDisableVertexArrayEXT = (FunctionTable::MEMBERPFNGLDISABLEVERTEXARRAYEXTPROC)&ProfilingTableDecorator::m_glDisableVertexArrayEXT_profiling;
+if(this->m_ptr_glProgramUniform3ui64NV)this->m_ptr_glProgramUniform3ui64NV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UI64NVPROC)&ProfilingTableDecorator::m_glProgramUniform3ui64NV_profiling;
+if(this->m_ptr_glClientActiveTexture)this->m_ptr_glClientActiveTexture = (FunctionTable::MEMBERPFNGLCLIENTACTIVETEXTUREPROC)&ProfilingTableDecorator::m_glClientActiveTexture_profiling;
+if(this->m_ptr_glMultiTexParameterIivEXT)this->m_ptr_glMultiTexParameterIivEXT = (FunctionTable::MEMBERPFNGLMULTITEXPARAMETERIIVEXTPROC)&ProfilingTableDecorator::m_glMultiTexParameterIivEXT_profiling;
+if(this->m_ptr_glUniform1i64ARB)this->m_ptr_glUniform1i64ARB = (FunctionTable::MEMBERPFNGLUNIFORM1I64ARBPROC)&ProfilingTableDecorator::m_glUniform1i64ARB_profiling;
+if(this->m_ptr_glUniform1iv)this->m_ptr_glUniform1iv = (FunctionTable::MEMBERPFNGLUNIFORM1IVPROC)&ProfilingTableDecorator::m_glUniform1iv_profiling;
+if(this->m_ptr_glVertexAttribArrayObjectATI)this->m_ptr_glVertexAttribArrayObjectATI = (FunctionTable::MEMBERPFNGLVERTEXATTRIBARRAYOBJECTATIPROC)&ProfilingTableDecorator::m_glVertexAttribArrayObjectATI_profiling;
+if(this->m_ptr_glUniform2iARB)this->m_ptr_glUniform2iARB = (FunctionTable::MEMBERPFNGLUNIFORM2IARBPROC)&ProfilingTableDecorator::m_glUniform2iARB_profiling;
+if(this->m_ptr_glDrawArraysInstanced)this->m_ptr_glDrawArraysInstanced = (FunctionTable::MEMBERPFNGLDRAWARRAYSINSTANCEDPROC)&ProfilingTableDecorator::m_glDrawArraysInstanced_profiling;
+if(this->m_ptr_glVertexAttrib2sNV)this->m_ptr_glVertexAttrib2sNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2SNVPROC)&ProfilingTableDecorator::m_glVertexAttrib2sNV_profiling;
+if(this->m_ptr_glTexBufferEXT)this->m_ptr_glTexBufferEXT = (FunctionTable::MEMBERPFNGLTEXBUFFEREXTPROC)&ProfilingTableDecorator::m_glTexBufferEXT_profiling;
+if(this->m_ptr_glVertexStream2fATI)this->m_ptr_glVertexStream2fATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM2FATIPROC)&ProfilingTableDecorator::m_glVertexStream2fATI_profiling;
+if(this->m_ptr_glDebugMessageCallbackAMD)this->m_ptr_glDebugMessageCallbackAMD = (FunctionTable::MEMBERPFNGLDEBUGMESSAGECALLBACKAMDPROC)&ProfilingTableDecorator::m_glDebugMessageCallbackAMD_profiling;
+if(this->m_ptr_glSamplerParameteriv)this->m_ptr_glSamplerParameteriv = (FunctionTable::MEMBERPFNGLSAMPLERPARAMETERIVPROC)&ProfilingTableDecorator::m_glSamplerParameteriv_profiling;
+if(this->m_ptr_glVertexAttrib4uiv)this->m_ptr_glVertexAttrib4uiv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4UIVPROC)&ProfilingTableDecorator::m_glVertexAttrib4uiv_profiling;
+if(this->m_ptr_glEndQueryIndexed)this->m_ptr_glEndQueryIndexed = (FunctionTable::MEMBERPFNGLENDQUERYINDEXEDPROC)&ProfilingTableDecorator::m_glEndQueryIndexed_profiling;
+if(this->m_ptr_glNormalStream3sATI)this->m_ptr_glNormalStream3sATI = (FunctionTable::MEMBERPFNGLNORMALSTREAM3SATIPROC)&ProfilingTableDecorator::m_glNormalStream3sATI_profiling;
+if(this->m_ptr_glProgramParameteriARB)this->m_ptr_glProgramParameteriARB = (FunctionTable::MEMBERPFNGLPROGRAMPARAMETERIARBPROC)&ProfilingTableDecorator::m_glProgramParameteriARB_profiling;
+if(this->m_ptr_glTexEnvxOES)this->m_ptr_glTexEnvxOES = (FunctionTable::MEMBERPFNGLTEXENVXOESPROC)&ProfilingTableDecorator::m_glTexEnvxOES_profiling;
+if(this->m_ptr_glProgramUniform1iv)this->m_ptr_glProgramUniform1iv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1IVPROC)&ProfilingTableDecorator::m_glProgramUniform1iv_profiling;
+if(this->m_ptr_glDisableVertexAttribAPPLE)this->m_ptr_glDisableVertexAttribAPPLE = (FunctionTable::MEMBERPFNGLDISABLEVERTEXATTRIBAPPLEPROC)&ProfilingTableDecorator::m_glDisableVertexAttribAPPLE_profiling;
+if(this->m_ptr_glBindRenderbuffer)this->m_ptr_glBindRenderbuffer = (FunctionTable::MEMBERPFNGLBINDRENDERBUFFERPROC)&ProfilingTableDecorator::m_glBindRenderbuffer_profiling;
+if(this->m_ptr_glMultiTexSubImage3DEXT)this->m_ptr_glMultiTexSubImage3DEXT = (FunctionTable::MEMBERPFNGLMULTITEXSUBIMAGE3DEXTPROC)&ProfilingTableDecorator::m_glMultiTexSubImage3DEXT_profiling;
+if(this->m_ptr_glIsProgram)this->m_ptr_glIsProgram = (FunctionTable::MEMBERPFNGLISPROGRAMPROC)&ProfilingTableDecorator::m_glIsProgram_profiling;
+if(this->m_ptr_glMultiDrawElementsIndirectAMD)this->m_ptr_glMultiDrawElementsIndirectAMD = (FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSINDIRECTAMDPROC)&ProfilingTableDecorator::m_glMultiDrawElementsIndirectAMD_profiling;
+if(this->m_ptr_glGetProgramInfoLog)this->m_ptr_glGetProgramInfoLog = (FunctionTable::MEMBERPFNGLGETPROGRAMINFOLOGPROC)&ProfilingTableDecorator::m_glGetProgramInfoLog_profiling;
+if(this->m_ptr_glGetLocalConstantBooleanvEXT)this->m_ptr_glGetLocalConstantBooleanvEXT = (FunctionTable::MEMBERPFNGLGETLOCALCONSTANTBOOLEANVEXTPROC)&ProfilingTableDecorator::m_glGetLocalConstantBooleanvEXT_profiling;
+if(this->m_ptr_glPixelTransformParameteriEXT)this->m_ptr_glPixelTransformParameteriEXT = (FunctionTable::MEMBERPFNGLPIXELTRANSFORMPARAMETERIEXTPROC)&ProfilingTableDecorator::m_glPixelTransformParameteriEXT_profiling;
+if(this->m_ptr_glTexCoord4bOES)this->m_ptr_glTexCoord4bOES = (FunctionTable::MEMBERPFNGLTEXCOORD4BOESPROC)&ProfilingTableDecorator::m_glTexCoord4bOES_profiling;
+if(this->m_ptr_glVertexAttrib4fv)this->m_ptr_glVertexAttrib4fv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4FVPROC)&ProfilingTableDecorator::m_glVertexAttrib4fv_profiling;
+if(this->m_ptr_glProgramUniformMatrix2x3dv)this->m_ptr_glProgramUniformMatrix2x3dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X3DVPROC)&ProfilingTableDecorator::m_glProgramUniformMatrix2x3dv_profiling;
+if(this->m_ptr_glProgramEnvParametersI4uivNV)this->m_ptr_glProgramEnvParametersI4uivNV = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERSI4UIVNVPROC)&ProfilingTableDecorator::m_glProgramEnvParametersI4uivNV_profiling;
+if(this->m_ptr_glTexCoord3xOES)this->m_ptr_glTexCoord3xOES = (FunctionTable::MEMBERPFNGLTEXCOORD3XOESPROC)&ProfilingTableDecorator::m_glTexCoord3xOES_profiling;
+if(this->m_ptr_glLoadTransposeMatrixfARB)this->m_ptr_glLoadTransposeMatrixfARB = (FunctionTable::MEMBERPFNGLLOADTRANSPOSEMATRIXFARBPROC)&ProfilingTableDecorator::m_glLoadTransposeMatrixfARB_profiling;
+if(this->m_ptr_glImageTransformParameteriHP)this->m_ptr_glImageTransformParameteriHP = (FunctionTable::MEMBERPFNGLIMAGETRANSFORMPARAMETERIHPPROC)&ProfilingTableDecorator::m_glImageTransformParameteriHP_profiling;
+if(this->m_ptr_glMultiTexCoord4xOES)this->m_ptr_glMultiTexCoord4xOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4XOESPROC)&ProfilingTableDecorator::m_glMultiTexCoord4xOES_profiling;
+if(this->m_ptr_glVertexAttribs3fvNV)this->m_ptr_glVertexAttribs3fvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS3FVNVPROC)&ProfilingTableDecorator::m_glVertexAttribs3fvNV_profiling;
+if(this->m_ptr_glVertexAttrib2fv)this->m_ptr_glVertexAttrib2fv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2FVPROC)&ProfilingTableDecorator::m_glVertexAttrib2fv_profiling;
+if(this->m_ptr_glUniform3ui64NV)this->m_ptr_glUniform3ui64NV = (FunctionTable::MEMBERPFNGLUNIFORM3UI64NVPROC)&ProfilingTableDecorator::m_glUniform3ui64NV_profiling;
+if(this->m_ptr_glCombinerParameterfvNV)this->m_ptr_glCombinerParameterfvNV = (FunctionTable::MEMBERPFNGLCOMBINERPARAMETERFVNVPROC)&ProfilingTableDecorator::m_glCombinerParameterfvNV_profiling;
+if(this->m_ptr_glFragmentMaterialiSGIX)this->m_ptr_glFragmentMaterialiSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTMATERIALISGIXPROC)&ProfilingTableDecorator::m_glFragmentMaterialiSGIX_profiling;
+if(this->m_ptr_glGetBooleani_v)this->m_ptr_glGetBooleani_v = (FunctionTable::MEMBERPFNGLGETBOOLEANI_VPROC)&ProfilingTableDecorator::m_glGetBooleani_v_profiling;
+if(this->m_ptr_glGetProgramResourceIndex)this->m_ptr_glGetProgramResourceIndex = (FunctionTable::MEMBERPFNGLGETPROGRAMRESOURCEINDEXPROC)&ProfilingTableDecorator::m_glGetProgramResourceIndex_profiling;
+if(this->m_ptr_glBeginConditionalRenderNV)this->m_ptr_glBeginConditionalRenderNV = (FunctionTable::MEMBERPFNGLBEGINCONDITIONALRENDERNVPROC)&ProfilingTableDecorator::m_glBeginConditionalRenderNV_profiling;
+if(this->m_ptr_glDisableClientState)this->m_ptr_glDisableClientState = (FunctionTable::MEMBERPFNGLDISABLECLIENTSTATEPROC)&ProfilingTableDecorator::m_glDisableClientState_profiling;
+if(this->m_ptr_glPathFogGenNV)this->m_ptr_glPathFogGenNV = (FunctionTable::MEMBERPFNGLPATHFOGGENNVPROC)&ProfilingTableDecorator::m_glPathFogGenNV_profiling;
+if(this->m_ptr_glStencilThenCoverFillPathNV)this->m_ptr_glStencilThenCoverFillPathNV = (FunctionTable::MEMBERPFNGLSTENCILTHENCOVERFILLPATHNVPROC)&ProfilingTableDecorator::m_glStencilThenCoverFillPathNV_profiling;
+if(this->m_ptr_glVertexArrayIndexOffsetEXT)this->m_ptr_glVertexArrayIndexOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYINDEXOFFSETEXTPROC)&ProfilingTableDecorator::m_glVertexArrayIndexOffsetEXT_profiling;
+if(this->m_ptr_glProgramBufferParametersIuivNV)this->m_ptr_glProgramBufferParametersIuivNV = (FunctionTable::MEMBERPFNGLPROGRAMBUFFERPARAMETERSIUIVNVPROC)&ProfilingTableDecorator::m_glProgramBufferParametersIuivNV_profiling;
+if(this->m_ptr_glPixelTransformParameterivEXT)this->m_ptr_glPixelTransformParameterivEXT = (FunctionTable::MEMBERPFNGLPIXELTRANSFORMPARAMETERIVEXTPROC)&ProfilingTableDecorator::m_glPixelTransformParameterivEXT_profiling;
+if(this->m_ptr_glDisableClientStateiEXT)this->m_ptr_glDisableClientStateiEXT = (FunctionTable::MEMBERPFNGLDISABLECLIENTSTATEIEXTPROC)&ProfilingTableDecorator::m_glDisableClientStateiEXT_profiling;
+if(this->m_ptr_glTexBufferARB)this->m_ptr_glTexBufferARB = (FunctionTable::MEMBERPFNGLTEXBUFFERARBPROC)&ProfilingTableDecorator::m_glTexBufferARB_profiling;
+if(this->m_ptr_glGetLocalConstantIntegervEXT)this->m_ptr_glGetLocalConstantIntegervEXT = (FunctionTable::MEMBERPFNGLGETLOCALCONSTANTINTEGERVEXTPROC)&ProfilingTableDecorator::m_glGetLocalConstantIntegervEXT_profiling;
+if(this->m_ptr_glColor4uiv)this->m_ptr_glColor4uiv = (FunctionTable::MEMBERPFNGLCOLOR4UIVPROC)&ProfilingTableDecorator::m_glColor4uiv_profiling;
+if(this->m_ptr_glProgramUniform3i)this->m_ptr_glProgramUniform3i = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3IPROC)&ProfilingTableDecorator::m_glProgramUniform3i_profiling;
+if(this->m_ptr_glMultiDrawElementsIndirectBindlessCountNV)this->m_ptr_glMultiDrawElementsIndirectBindlessCountNV = (FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSINDIRECTBINDLESSCOUNTNVPROC)&ProfilingTableDecorator::m_glMultiDrawElementsIndirectBindlessCountNV_profiling;
+if(this->m_ptr_glGetBufferPointervARB)this->m_ptr_glGetBufferPointervARB = (FunctionTable::MEMBERPFNGLGETBUFFERPOINTERVARBPROC)&ProfilingTableDecorator::m_glGetBufferPointervARB_profiling;
+if(this->m_ptr_glMultiTexParameterIuivEXT)this->m_ptr_glMultiTexParameterIuivEXT = (FunctionTable::MEMBERPFNGLMULTITEXPARAMETERIUIVEXTPROC)&ProfilingTableDecorator::m_glMultiTexParameterIuivEXT_profiling;
+if(this->m_ptr_glEvalMesh2)this->m_ptr_glEvalMesh2 = (FunctionTable::MEMBERPFNGLEVALMESH2PROC)&ProfilingTableDecorator::m_glEvalMesh2_profiling;
+if(this->m_ptr_glEvalMesh1)this->m_ptr_glEvalMesh1 = (FunctionTable::MEMBERPFNGLEVALMESH1PROC)&ProfilingTableDecorator::m_glEvalMesh1_profiling;
+if(this->m_ptr_glProgramUniform3f)this->m_ptr_glProgramUniform3f = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3FPROC)&ProfilingTableDecorator::m_glProgramUniform3f_profiling;
+if(this->m_ptr_glStencilThenCoverFillPathInstancedNV)this->m_ptr_glStencilThenCoverFillPathInstancedNV = (FunctionTable::MEMBERPFNGLSTENCILTHENCOVERFILLPATHINSTANCEDNVPROC)&ProfilingTableDecorator::m_glStencilThenCoverFillPathInstancedNV_profiling;
+if(this->m_ptr_glProgramUniform3d)this->m_ptr_glProgramUniform3d = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3DPROC)&ProfilingTableDecorator::m_glProgramUniform3d_profiling;
+if(this->m_ptr_glMapVertexAttrib1dAPPLE)this->m_ptr_glMapVertexAttrib1dAPPLE = (FunctionTable::MEMBERPFNGLMAPVERTEXATTRIB1DAPPLEPROC)&ProfilingTableDecorator::m_glMapVertexAttrib1dAPPLE_profiling;
+if(this->m_ptr_glEvalCoord2fv)this->m_ptr_glEvalCoord2fv = (FunctionTable::MEMBERPFNGLEVALCOORD2FVPROC)&ProfilingTableDecorator::m_glEvalCoord2fv_profiling;
+if(this->m_ptr_glGetUniformivARB)this->m_ptr_glGetUniformivARB = (FunctionTable::MEMBERPFNGLGETUNIFORMIVARBPROC)&ProfilingTableDecorator::m_glGetUniformivARB_profiling;
+if(this->m_ptr_glLoadTransposeMatrixd)this->m_ptr_glLoadTransposeMatrixd = (FunctionTable::MEMBERPFNGLLOADTRANSPOSEMATRIXDPROC)&ProfilingTableDecorator::m_glLoadTransposeMatrixd_profiling;
+if(this->m_ptr_glLoadTransposeMatrixf)this->m_ptr_glLoadTransposeMatrixf = (FunctionTable::MEMBERPFNGLLOADTRANSPOSEMATRIXFPROC)&ProfilingTableDecorator::m_glLoadTransposeMatrixf_profiling;
+if(this->m_ptr_glGetPointervEXT)this->m_ptr_glGetPointervEXT = (FunctionTable::MEMBERPFNGLGETPOINTERVEXTPROC)&ProfilingTableDecorator::m_glGetPointervEXT_profiling;
+if(this->m_ptr_glEndConditionalRenderNV)this->m_ptr_glEndConditionalRenderNV = (FunctionTable::MEMBERPFNGLENDCONDITIONALRENDERNVPROC)&ProfilingTableDecorator::m_glEndConditionalRenderNV_profiling;
+if(this->m_ptr_glTexCoord2fNormal3fVertex3fSUN)this->m_ptr_glTexCoord2fNormal3fVertex3fSUN = (FunctionTable::MEMBERPFNGLTEXCOORD2FNORMAL3FVERTEX3FSUNPROC)&ProfilingTableDecorator::m_glTexCoord2fNormal3fVertex3fSUN_profiling;
+if(this->m_ptr_glUniform3i64vARB)this->m_ptr_glUniform3i64vARB = (FunctionTable::MEMBERPFNGLUNIFORM3I64VARBPROC)&ProfilingTableDecorator::m_glUniform3i64vARB_profiling;
+if(this->m_ptr_glProgramUniform2uiEXT)this->m_ptr_glProgramUniform2uiEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UIEXTPROC)&ProfilingTableDecorator::m_glProgramUniform2uiEXT_profiling;
+if(this->m_ptr_glVertexAttribI1ui)this->m_ptr_glVertexAttribI1ui = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI1UIPROC)&ProfilingTableDecorator::m_glVertexAttribI1ui_profiling;
+if(this->m_ptr_glProgramNamedParameter4dvNV)this->m_ptr_glProgramNamedParameter4dvNV = (FunctionTable::MEMBERPFNGLPROGRAMNAMEDPARAMETER4DVNVPROC)&ProfilingTableDecorator::m_glProgramNamedParameter4dvNV_profiling;
+if(this->m_ptr_glCompileCommandListNV)this->m_ptr_glCompileCommandListNV = (FunctionTable::MEMBERPFNGLCOMPILECOMMANDLISTNVPROC)&ProfilingTableDecorator::m_glCompileCommandListNV_profiling;
+if(this->m_ptr_glGetRenderbufferParameterivEXT)this->m_ptr_glGetRenderbufferParameterivEXT = (FunctionTable::MEMBERPFNGLGETRENDERBUFFERPARAMETERIVEXTPROC)&ProfilingTableDecorator::m_glGetRenderbufferParameterivEXT_profiling;
+if(this->m_ptr_glGetnPolygonStipple)this->m_ptr_glGetnPolygonStipple = (FunctionTable::MEMBERPFNGLGETNPOLYGONSTIPPLEPROC)&ProfilingTableDecorator::m_glGetnPolygonStipple_profiling;
+if(this->m_ptr_glIsBufferResidentNV)this->m_ptr_glIsBufferResidentNV = (FunctionTable::MEMBERPFNGLISBUFFERRESIDENTNVPROC)&ProfilingTableDecorator::m_glIsBufferResidentNV_profiling;
+if(this->m_ptr_glSecondaryColor3ubvEXT)this->m_ptr_glSecondaryColor3ubvEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UBVEXTPROC)&ProfilingTableDecorator::m_glSecondaryColor3ubvEXT_profiling;
+if(this->m_ptr_glGetNamedRenderbufferParameterivEXT)this->m_ptr_glGetNamedRenderbufferParameterivEXT = (FunctionTable::MEMBERPFNGLGETNAMEDRENDERBUFFERPARAMETERIVEXTPROC)&ProfilingTableDecorator::m_glGetNamedRenderbufferParameterivEXT_profiling;
+if(this->m_ptr_glNamedFramebufferSampleLocationsfvARB)this->m_ptr_glNamedFramebufferSampleLocationsfvARB = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERSAMPLELOCATIONSFVARBPROC)&ProfilingTableDecorator::m_glNamedFramebufferSampleLocationsfvARB_profiling;
+if(this->m_ptr_glMultiTexGendvEXT)this->m_ptr_glMultiTexGendvEXT = (FunctionTable::MEMBERPFNGLMULTITEXGENDVEXTPROC)&ProfilingTableDecorator::m_glMultiTexGendvEXT_profiling;
+if(this->m_ptr_glVertexArrayRangeNV)this->m_ptr_glVertexArrayRangeNV = (FunctionTable::MEMBERPFNGLVERTEXARRAYRANGENVPROC)&ProfilingTableDecorator::m_glVertexArrayRangeNV_profiling;
+if(this->m_ptr_glIsTextureHandleResidentNV)this->m_ptr_glIsTextureHandleResidentNV = (FunctionTable::MEMBERPFNGLISTEXTUREHANDLERESIDENTNVPROC)&ProfilingTableDecorator::m_glIsTextureHandleResidentNV_profiling;
+if(this->m_ptr_glGetProgramEnvParameterdvARB)this->m_ptr_glGetProgramEnvParameterdvARB = (FunctionTable::MEMBERPFNGLGETPROGRAMENVPARAMETERDVARBPROC)&ProfilingTableDecorator::m_glGetProgramEnvParameterdvARB_profiling;
+if(this->m_ptr_glIsNamedStringARB)this->m_ptr_glIsNamedStringARB = (FunctionTable::MEMBERPFNGLISNAMEDSTRINGARBPROC)&ProfilingTableDecorator::m_glIsNamedStringARB_profiling;
+if(this->m_ptr_glSecondaryColorFormatNV)this->m_ptr_glSecondaryColorFormatNV = (FunctionTable::MEMBERPFNGLSECONDARYCOLORFORMATNVPROC)&ProfilingTableDecorator::m_glSecondaryColorFormatNV_profiling;
+if(this->m_ptr_glVertexAttrib4ubvNV)this->m_ptr_glVertexAttrib4ubvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4UBVNVPROC)&ProfilingTableDecorator::m_glVertexAttrib4ubvNV_profiling;
+if(this->m_ptr_glTagSampleBufferSGIX)this->m_ptr_glTagSampleBufferSGIX = (FunctionTable::MEMBERPFNGLTAGSAMPLEBUFFERSGIXPROC)&ProfilingTableDecorator::m_glTagSampleBufferSGIX_profiling;
+if(this->m_ptr_glVDPAUUnregisterSurfaceNV)this->m_ptr_glVDPAUUnregisterSurfaceNV = (FunctionTable::MEMBERPFNGLVDPAUUNREGISTERSURFACENVPROC)&ProfilingTableDecorator::m_glVDPAUUnregisterSurfaceNV_profiling;
+if(this->m_ptr_glGetPerfQueryIdByNameINTEL)this->m_ptr_glGetPerfQueryIdByNameINTEL = (FunctionTable::MEMBERPFNGLGETPERFQUERYIDBYNAMEINTELPROC)&ProfilingTableDecorator::m_glGetPerfQueryIdByNameINTEL_profiling;
+if(this->m_ptr_glGetInteger64v)this->m_ptr_glGetInteger64v = (FunctionTable::MEMBERPFNGLGETINTEGER64VPROC)&ProfilingTableDecorator::m_glGetInteger64v_profiling;
+if(this->m_ptr_glClipPlane)this->m_ptr_glClipPlane = (FunctionTable::MEMBERPFNGLCLIPPLANEPROC)&ProfilingTableDecorator::m_glClipPlane_profiling;
+if(this->m_ptr_glColor4ubVertex3fSUN)this->m_ptr_glColor4ubVertex3fSUN = (FunctionTable::MEMBERPFNGLCOLOR4UBVERTEX3FSUNPROC)&ProfilingTableDecorator::m_glColor4ubVertex3fSUN_profiling;
+if(this->m_ptr_glIndexub)this->m_ptr_glIndexub = (FunctionTable::MEMBERPFNGLINDEXUBPROC)&ProfilingTableDecorator::m_glIndexub_profiling;
+if(this->m_ptr_glGetProgramEnvParameterfvARB)this->m_ptr_glGetProgramEnvParameterfvARB = (FunctionTable::MEMBERPFNGLGETPROGRAMENVPARAMETERFVARBPROC)&ProfilingTableDecorator::m_glGetProgramEnvParameterfvARB_profiling;
+if(this->m_ptr_glVertexAttrib4usvARB)this->m_ptr_glVertexAttrib4usvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4USVARBPROC)&ProfilingTableDecorator::m_glVertexAttrib4usvARB_profiling;
+if(this->m_ptr_glNamedFramebufferRenderbuffer)this->m_ptr_glNamedFramebufferRenderbuffer = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC)&ProfilingTableDecorator::m_glNamedFramebufferRenderbuffer_profiling;
+if(this->m_ptr_glProgramUniformMatrix3x4dv)this->m_ptr_glProgramUniformMatrix3x4dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X4DVPROC)&ProfilingTableDecorator::m_glProgramUniformMatrix3x4dv_profiling;
+if(this->m_ptr_glTestFenceAPPLE)this->m_ptr_glTestFenceAPPLE = (FunctionTable::MEMBERPFNGLTESTFENCEAPPLEPROC)&ProfilingTableDecorator::m_glTestFenceAPPLE_profiling;
+if(this->m_ptr_glVertexAttrib4Niv)this->m_ptr_glVertexAttrib4Niv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NIVPROC)&ProfilingTableDecorator::m_glVertexAttrib4Niv_profiling;
+if(this->m_ptr_glVertexAttribL2i64vNV)this->m_ptr_glVertexAttribL2i64vNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL2I64VNVPROC)&ProfilingTableDecorator::m_glVertexAttribL2i64vNV_profiling;
+if(this->m_ptr_glColorP4uiv)this->m_ptr_glColorP4uiv = (FunctionTable::MEMBERPFNGLCOLORP4UIVPROC)&ProfilingTableDecorator::m_glColorP4uiv_profiling;
+if(this->m_ptr_glUniformMatrix2x3fv)this->m_ptr_glUniformMatrix2x3fv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX2X3FVPROC)&ProfilingTableDecorator::m_glUniformMatrix2x3fv_profiling;
+if(this->m_ptr_glCallCommandListNV)this->m_ptr_glCallCommandListNV = (FunctionTable::MEMBERPFNGLCALLCOMMANDLISTNVPROC)&ProfilingTableDecorator::m_glCallCommandListNV_profiling;
+if(this->m_ptr_glClearBufferiv)this->m_ptr_glClearBufferiv = (FunctionTable::MEMBERPFNGLCLEARBUFFERIVPROC)&ProfilingTableDecorator::m_glClearBufferiv_profiling;
+if(this->m_ptr_glNamedStringARB)this->m_ptr_glNamedStringARB = (FunctionTable::MEMBERPFNGLNAMEDSTRINGARBPROC)&ProfilingTableDecorator::m_glNamedStringARB_profiling;
+if(this->m_ptr_glMatrixMult3x2fNV)this->m_ptr_glMatrixMult3x2fNV = (FunctionTable::MEMBERPFNGLMATRIXMULT3X2FNVPROC)&ProfilingTableDecorator::m_glMatrixMult3x2fNV_profiling;
+if(this->m_ptr_glGetNamedProgramStringEXT)this->m_ptr_glGetNamedProgramStringEXT = (FunctionTable::MEMBERPFNGLGETNAMEDPROGRAMSTRINGEXTPROC)&ProfilingTableDecorator::m_glGetNamedProgramStringEXT_profiling;
+if(this->m_ptr_glGetnHistogramARB)this->m_ptr_glGetnHistogramARB = (FunctionTable::MEMBERPFNGLGETNHISTOGRAMARBPROC)&ProfilingTableDecorator::m_glGetnHistogramARB_profiling;
+if(this->m_ptr_glGetTextureLevelParameterfv)this->m_ptr_glGetTextureLevelParameterfv = (FunctionTable::MEMBERPFNGLGETTEXTURELEVELPARAMETERFVPROC)&ProfilingTableDecorator::m_glGetTextureLevelParameterfv_profiling;
+if(this->m_ptr_glMultiTexCoord1fv)this->m_ptr_glMultiTexCoord1fv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1FVPROC)&ProfilingTableDecorator::m_glMultiTexCoord1fv_profiling;
+if(this->m_ptr_glBitmapxOES)this->m_ptr_glBitmapxOES = (FunctionTable::MEMBERPFNGLBITMAPXOESPROC)&ProfilingTableDecorator::m_glBitmapxOES_profiling;
+if(this->m_ptr_glGetSamplerParameterIuiv)this->m_ptr_glGetSamplerParameterIuiv = (FunctionTable::MEMBERPFNGLGETSAMPLERPARAMETERIUIVPROC)&ProfilingTableDecorator::m_glGetSamplerParameterIuiv_profiling;
+if(this->m_ptr_glTexCoordP3ui)this->m_ptr_glTexCoordP3ui = (FunctionTable::MEMBERPFNGLTEXCOORDP3UIPROC)&ProfilingTableDecorator::m_glTexCoordP3ui_profiling;
+if(this->m_ptr_glTextureSubImage1D)this->m_ptr_glTextureSubImage1D = (FunctionTable::MEMBERPFNGLTEXTURESUBIMAGE1DPROC)&ProfilingTableDecorator::m_glTextureSubImage1D_profiling;
+if(this->m_ptr_glVertexAttribLPointerEXT)this->m_ptr_glVertexAttribLPointerEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBLPOINTEREXTPROC)&ProfilingTableDecorator::m_glVertexAttribLPointerEXT_profiling;
+if(this->m_ptr_glFogCoordPointerEXT)this->m_ptr_glFogCoordPointerEXT = (FunctionTable::MEMBERPFNGLFOGCOORDPOINTEREXTPROC)&ProfilingTableDecorator::m_glFogCoordPointerEXT_profiling;
+if(this->m_ptr_glWindowPos3s)this->m_ptr_glWindowPos3s = (FunctionTable::MEMBERPFNGLWINDOWPOS3SPROC)&ProfilingTableDecorator::m_glWindowPos3s_profiling;
+if(this->m_ptr_glVertexAttribs2svNV)this->m_ptr_glVertexAttribs2svNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS2SVNVPROC)&ProfilingTableDecorator::m_glVertexAttribs2svNV_profiling;
+if(this->m_ptr_glTextureImage3DEXT)this->m_ptr_glTextureImage3DEXT = (FunctionTable::MEMBERPFNGLTEXTUREIMAGE3DEXTPROC)&ProfilingTableDecorator::m_glTextureImage3DEXT_profiling;
+if(this->m_ptr_glWindowPos3i)this->m_ptr_glWindowPos3i = (FunctionTable::MEMBERPFNGLWINDOWPOS3IPROC)&ProfilingTableDecorator::m_glWindowPos3i_profiling;
+if(this->m_ptr_glWindowPos3d)this->m_ptr_glWindowPos3d = (FunctionTable::MEMBERPFNGLWINDOWPOS3DPROC)&ProfilingTableDecorator::m_glWindowPos3d_profiling;
+if(this->m_ptr_glWindowPos3f)this->m_ptr_glWindowPos3f = (FunctionTable::MEMBERPFNGLWINDOWPOS3FPROC)&ProfilingTableDecorator::m_glWindowPos3f_profiling;
+if(this->m_ptr_glIsEnabledIndexedEXT)this->m_ptr_glIsEnabledIndexedEXT = (FunctionTable::MEMBERPFNGLISENABLEDINDEXEDEXTPROC)&ProfilingTableDecorator::m_glIsEnabledIndexedEXT_profiling;
+if(this->m_ptr_glGetNamedProgramivEXT)this->m_ptr_glGetNamedProgramivEXT = (FunctionTable::MEMBERPFNGLGETNAMEDPROGRAMIVEXTPROC)&ProfilingTableDecorator::m_glGetNamedProgramivEXT_profiling;
+if(this->m_ptr_glVertex3xvOES)this->m_ptr_glVertex3xvOES = (FunctionTable::MEMBERPFNGLVERTEX3XVOESPROC)&ProfilingTableDecorator::m_glVertex3xvOES_profiling;
+if(this->m_ptr_glColor3us)this->m_ptr_glColor3us = (FunctionTable::MEMBERPFNGLCOLOR3USPROC)&ProfilingTableDecorator::m_glColor3us_profiling;
+if(this->m_ptr_glBeginPerfMonitorAMD)this->m_ptr_glBeginPerfMonitorAMD = (FunctionTable::MEMBERPFNGLBEGINPERFMONITORAMDPROC)&ProfilingTableDecorator::m_glBeginPerfMonitorAMD_profiling;
+if(this->m_ptr_glProgramUniformMatrix4x3dv)this->m_ptr_glProgramUniformMatrix4x3dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X3DVPROC)&ProfilingTableDecorator::m_glProgramUniformMatrix4x3dv_profiling;
+if(this->m_ptr_glGetNamedProgramLocalParameterIuivEXT)this->m_ptr_glGetNamedProgramLocalParameterIuivEXT = (FunctionTable::MEMBERPFNGLGETNAMEDPROGRAMLOCALPARAMETERIUIVEXTPROC)&ProfilingTableDecorator::m_glGetNamedProgramLocalParameterIuivEXT_profiling;
+if(this->m_ptr_glReadnPixels)this->m_ptr_glReadnPixels = (FunctionTable::MEMBERPFNGLREADNPIXELSPROC)&ProfilingTableDecorator::m_glReadnPixels_profiling;
+if(this->m_ptr_glMultiTexCoord4f)this->m_ptr_glMultiTexCoord4f = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4FPROC)&ProfilingTableDecorator::m_glMultiTexCoord4f_profiling;
+if(this->m_ptr_glColor3ub)this->m_ptr_glColor3ub = (FunctionTable::MEMBERPFNGLCOLOR3UBPROC)&ProfilingTableDecorator::m_glColor3ub_profiling;
+if(this->m_ptr_glMultiTexCoord4d)this->m_ptr_glMultiTexCoord4d = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4DPROC)&ProfilingTableDecorator::m_glMultiTexCoord4d_profiling;
+if(this->m_ptr_glVertexAttribL3ui64NV)this->m_ptr_glVertexAttribL3ui64NV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL3UI64NVPROC)&ProfilingTableDecorator::m_glVertexAttribL3ui64NV_profiling;
+if(this->m_ptr_glColor3ui)this->m_ptr_glColor3ui = (FunctionTable::MEMBERPFNGLCOLOR3UIPROC)&ProfilingTableDecorator::m_glColor3ui_profiling;
+if(this->m_ptr_glProgramUniform4fvEXT)this->m_ptr_glProgramUniform4fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4FVEXTPROC)&ProfilingTableDecorator::m_glProgramUniform4fvEXT_profiling;
+if(this->m_ptr_glVertexAttrib2sARB)this->m_ptr_glVertexAttrib2sARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2SARBPROC)&ProfilingTableDecorator::m_glVertexAttrib2sARB_profiling;
+if(this->m_ptr_glMultiTexCoord4i)this->m_ptr_glMultiTexCoord4i = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4IPROC)&ProfilingTableDecorator::m_glMultiTexCoord4i_profiling;
+if(this->m_ptr_glCheckFramebufferStatusEXT)this->m_ptr_glCheckFramebufferStatusEXT = (FunctionTable::MEMBERPFNGLCHECKFRAMEBUFFERSTATUSEXTPROC)&ProfilingTableDecorator::m_glCheckFramebufferStatusEXT_profiling;
+if(this->m_ptr_glGetnMapivARB)this->m_ptr_glGetnMapivARB = (FunctionTable::MEMBERPFNGLGETNMAPIVARBPROC)&ProfilingTableDecorator::m_glGetnMapivARB_profiling;
+if(this->m_ptr_glMultiTexCoord1ivARB)this->m_ptr_glMultiTexCoord1ivARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1IVARBPROC)&ProfilingTableDecorator::m_glMultiTexCoord1ivARB_profiling;
+if(this->m_ptr_glDisableVertexAttribArrayARB)this->m_ptr_glDisableVertexAttribArrayARB = (FunctionTable::MEMBERPFNGLDISABLEVERTEXATTRIBARRAYARBPROC)&ProfilingTableDecorator::m_glDisableVertexAttribArrayARB_profiling;
+if(this->m_ptr_glGetPolygonStipple)this->m_ptr_glGetPolygonStipple = (FunctionTable::MEMBERPFNGLGETPOLYGONSTIPPLEPROC)&ProfilingTableDecorator::m_glGetPolygonStipple_profiling;
+if(this->m_ptr_glVertexAttribI4ui)this->m_ptr_glVertexAttribI4ui = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4UIPROC)&ProfilingTableDecorator::m_glVertexAttribI4ui_profiling;
+if(this->m_ptr_glGetPathDashArrayNV)this->m_ptr_glGetPathDashArrayNV = (FunctionTable::MEMBERPFNGLGETPATHDASHARRAYNVPROC)&ProfilingTableDecorator::m_glGetPathDashArrayNV_profiling;
+if(this->m_ptr_glMultiTexRenderbufferEXT)this->m_ptr_glMultiTexRenderbufferEXT = (FunctionTable::MEMBERPFNGLMULTITEXRENDERBUFFEREXTPROC)&ProfilingTableDecorator::m_glMultiTexRenderbufferEXT_profiling;
+if(this->m_ptr_glCopyTextureSubImage1D)this->m_ptr_glCopyTextureSubImage1D = (FunctionTable::MEMBERPFNGLCOPYTEXTURESUBIMAGE1DPROC)&ProfilingTableDecorator::m_glCopyTextureSubImage1D_profiling;
+if(this->m_ptr_glDeleteOcclusionQueriesNV)this->m_ptr_glDeleteOcclusionQueriesNV = (FunctionTable::MEMBERPFNGLDELETEOCCLUSIONQUERIESNVPROC)&ProfilingTableDecorator::m_glDeleteOcclusionQueriesNV_profiling;
+if(this->m_ptr_glVertex4hvNV)this->m_ptr_glVertex4hvNV = (FunctionTable::MEMBERPFNGLVERTEX4HVNVPROC)&ProfilingTableDecorator::m_glVertex4hvNV_profiling;
+if(this->m_ptr_glGetnTexImage)this->m_ptr_glGetnTexImage = (FunctionTable::MEMBERPFNGLGETNTEXIMAGEPROC)&ProfilingTableDecorator::m_glGetnTexImage_profiling;
+if(this->m_ptr_glProgramLocalParameter4dARB)this->m_ptr_glProgramLocalParameter4dARB = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETER4DARBPROC)&ProfilingTableDecorator::m_glProgramLocalParameter4dARB_profiling;
+if(this->m_ptr_glBlendEquation)this->m_ptr_glBlendEquation = (FunctionTable::MEMBERPFNGLBLENDEQUATIONPROC)&ProfilingTableDecorator::m_glBlendEquation_profiling;
+if(this->m_ptr_glUnlockArraysEXT)this->m_ptr_glUnlockArraysEXT = (FunctionTable::MEMBERPFNGLUNLOCKARRAYSEXTPROC)&ProfilingTableDecorator::m_glUnlockArraysEXT_profiling;
+if(this->m_ptr_glGetQueryObjectui64vEXT)this->m_ptr_glGetQueryObjectui64vEXT = (FunctionTable::MEMBERPFNGLGETQUERYOBJECTUI64VEXTPROC)&ProfilingTableDecorator::m_glGetQueryObjectui64vEXT_profiling;
+if(this->m_ptr_glVertexAttribI4uivEXT)this->m_ptr_glVertexAttribI4uivEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4UIVEXTPROC)&ProfilingTableDecorator::m_glVertexAttribI4uivEXT_profiling;
+if(this->m_ptr_glUniform1i64vNV)this->m_ptr_glUniform1i64vNV = (FunctionTable::MEMBERPFNGLUNIFORM1I64VNVPROC)&ProfilingTableDecorator::m_glUniform1i64vNV_profiling;
+if(this->m_ptr_glMultiTexCoord3dv)this->m_ptr_glMultiTexCoord3dv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3DVPROC)&ProfilingTableDecorator::m_glMultiTexCoord3dv_profiling;
+if(this->m_ptr_glColor4sv)this->m_ptr_glColor4sv = (FunctionTable::MEMBERPFNGLCOLOR4SVPROC)&ProfilingTableDecorator::m_glColor4sv_profiling;
+if(this->m_ptr_glVertexStream4ivATI)this->m_ptr_glVertexStream4ivATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM4IVATIPROC)&ProfilingTableDecorator::m_glVertexStream4ivATI_profiling;
+if(this->m_ptr_glPopClientAttrib)this->m_ptr_glPopClientAttrib = (FunctionTable::MEMBERPFNGLPOPCLIENTATTRIBPROC)&ProfilingTableDecorator::m_glPopClientAttrib_profiling;
+if(this->m_ptr_glClearBufferData)this->m_ptr_glClearBufferData = (FunctionTable::MEMBERPFNGLCLEARBUFFERDATAPROC)&ProfilingTableDecorator::m_glClearBufferData_profiling;
+if(this->m_ptr_glGetProgramivNV)this->m_ptr_glGetProgramivNV = (FunctionTable::MEMBERPFNGLGETPROGRAMIVNVPROC)&ProfilingTableDecorator::m_glGetProgramivNV_profiling;
+if(this->m_ptr_glBeginTransformFeedback)this->m_ptr_glBeginTransformFeedback = (FunctionTable::MEMBERPFNGLBEGINTRANSFORMFEEDBACKPROC)&ProfilingTableDecorator::m_glBeginTransformFeedback_profiling;
+if(this->m_ptr_glFinishObjectAPPLE)this->m_ptr_glFinishObjectAPPLE = (FunctionTable::MEMBERPFNGLFINISHOBJECTAPPLEPROC)&ProfilingTableDecorator::m_glFinishObjectAPPLE_profiling;
+if(this->m_ptr_glGetMinmaxParameterivEXT)this->m_ptr_glGetMinmaxParameterivEXT = (FunctionTable::MEMBERPFNGLGETMINMAXPARAMETERIVEXTPROC)&ProfilingTableDecorator::m_glGetMinmaxParameterivEXT_profiling;
+if(this->m_ptr_glColor3iv)this->m_ptr_glColor3iv = (FunctionTable::MEMBERPFNGLCOLOR3IVPROC)&ProfilingTableDecorator::m_glColor3iv_profiling;
+if(this->m_ptr_glVertexAttrib3sv)this->m_ptr_glVertexAttrib3sv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3SVPROC)&ProfilingTableDecorator::m_glVertexAttrib3sv_profiling;
+if(this->m_ptr_glCompressedTexImage1D)this->m_ptr_glCompressedTexImage1D = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXIMAGE1DPROC)&ProfilingTableDecorator::m_glCompressedTexImage1D_profiling;
+if(this->m_ptr_glDeleteTransformFeedbacks)this->m_ptr_glDeleteTransformFeedbacks = (FunctionTable::MEMBERPFNGLDELETETRANSFORMFEEDBACKSPROC)&ProfilingTableDecorator::m_glDeleteTransformFeedbacks_profiling;
+if(this->m_ptr_glGetVideoi64vNV)this->m_ptr_glGetVideoi64vNV = (FunctionTable::MEMBERPFNGLGETVIDEOI64VNVPROC)&ProfilingTableDecorator::m_glGetVideoi64vNV_profiling;
+if(this->m_ptr_glDrawRangeElementsBaseVertex)this->m_ptr_glDrawRangeElementsBaseVertex = (FunctionTable::MEMBERPFNGLDRAWRANGEELEMENTSBASEVERTEXPROC)&ProfilingTableDecorator::m_glDrawRangeElementsBaseVertex_profiling;
+if(this->m_ptr_glUniform4i64vARB)this->m_ptr_glUniform4i64vARB = (FunctionTable::MEMBERPFNGLUNIFORM4I64VARBPROC)&ProfilingTableDecorator::m_glUniform4i64vARB_profiling;
+if(this->m_ptr_glTextureStorage3DMultisampleEXT)this->m_ptr_glTextureStorage3DMultisampleEXT = (FunctionTable::MEMBERPFNGLTEXTURESTORAGE3DMULTISAMPLEEXTPROC)&ProfilingTableDecorator::m_glTextureStorage3DMultisampleEXT_profiling;
+if(this->m_ptr_glGetTexParameterfv)this->m_ptr_glGetTexParameterfv = (FunctionTable::MEMBERPFNGLGETTEXPARAMETERFVPROC)&ProfilingTableDecorator::m_glGetTexParameterfv_profiling;
+if(this->m_ptr_glProgramUniformui64vNV)this->m_ptr_glProgramUniformui64vNV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMUI64VNVPROC)&ProfilingTableDecorator::m_glProgramUniformui64vNV_profiling;
+if(this->m_ptr_glCompressedMultiTexImage1DEXT)this->m_ptr_glCompressedMultiTexImage1DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDMULTITEXIMAGE1DEXTPROC)&ProfilingTableDecorator::m_glCompressedMultiTexImage1DEXT_profiling;
+if(this->m_ptr_glProgramUniform2ivEXT)this->m_ptr_glProgramUniform2ivEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2IVEXTPROC)&ProfilingTableDecorator::m_glProgramUniform2ivEXT_profiling;
+if(this->m_ptr_glPushGroupMarkerEXT)this->m_ptr_glPushGroupMarkerEXT = (FunctionTable::MEMBERPFNGLPUSHGROUPMARKEREXTPROC)&ProfilingTableDecorator::m_glPushGroupMarkerEXT_profiling;
+if(this->m_ptr_glVertexAttrib1dv)this->m_ptr_glVertexAttrib1dv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1DVPROC)&ProfilingTableDecorator::m_glVertexAttrib1dv_profiling;
+if(this->m_ptr_glMatrixLoadIdentityEXT)this->m_ptr_glMatrixLoadIdentityEXT = (FunctionTable::MEMBERPFNGLMATRIXLOADIDENTITYEXTPROC)&ProfilingTableDecorator::m_glMatrixLoadIdentityEXT_profiling;
+if(this->m_ptr_glMultTransposeMatrixxOES)this->m_ptr_glMultTransposeMatrixxOES = (FunctionTable::MEMBERPFNGLMULTTRANSPOSEMATRIXXOESPROC)&ProfilingTableDecorator::m_glMultTransposeMatrixxOES_profiling;
+if(this->m_ptr_glGetPixelMapxv)this->m_ptr_glGetPixelMapxv = (FunctionTable::MEMBERPFNGLGETPIXELMAPXVPROC)&ProfilingTableDecorator::m_glGetPixelMapxv_profiling;
+if(this->m_ptr_glFramebufferSampleLocationsfvARB)this->m_ptr_glFramebufferSampleLocationsfvARB = (FunctionTable::MEMBERPFNGLFRAMEBUFFERSAMPLELOCATIONSFVARBPROC)&ProfilingTableDecorator::m_glFramebufferSampleLocationsfvARB_profiling;
+if(this->m_ptr_glGetLightiv)this->m_ptr_glGetLightiv = (FunctionTable::MEMBERPFNGLGETLIGHTIVPROC)&ProfilingTableDecorator::m_glGetLightiv_profiling;
+if(this->m_ptr_glBlendFuncSeparatei)this->m_ptr_glBlendFuncSeparatei = (FunctionTable::MEMBERPFNGLBLENDFUNCSEPARATEIPROC)&ProfilingTableDecorator::m_glBlendFuncSeparatei_profiling;
+if(this->m_ptr_glGetBooleanIndexedvEXT)this->m_ptr_glGetBooleanIndexedvEXT = (FunctionTable::MEMBERPFNGLGETBOOLEANINDEXEDVEXTPROC)&ProfilingTableDecorator::m_glGetBooleanIndexedvEXT_profiling;
+if(this->m_ptr_glGetProgramSubroutineParameteruivNV)this->m_ptr_glGetProgramSubroutineParameteruivNV = (FunctionTable::MEMBERPFNGLGETPROGRAMSUBROUTINEPARAMETERUIVNVPROC)&ProfilingTableDecorator::m_glGetProgramSubroutineParameteruivNV_profiling;
+if(this->m_ptr_glUniform2ui)this->m_ptr_glUniform2ui = (FunctionTable::MEMBERPFNGLUNIFORM2UIPROC)&ProfilingTableDecorator::m_glUniform2ui_profiling;
+if(this->m_ptr_glApplyFramebufferAttachmentCMAAINTEL)this->m_ptr_glApplyFramebufferAttachmentCMAAINTEL = (FunctionTable::MEMBERPFNGLAPPLYFRAMEBUFFERATTACHMENTCMAAINTELPROC)&ProfilingTableDecorator::m_glApplyFramebufferAttachmentCMAAINTEL_profiling;
+if(this->m_ptr_glWindowPos2fv)this->m_ptr_glWindowPos2fv = (FunctionTable::MEMBERPFNGLWINDOWPOS2FVPROC)&ProfilingTableDecorator::m_glWindowPos2fv_profiling;
+if(this->m_ptr_glDisablei)this->m_ptr_glDisablei = (FunctionTable::MEMBERPFNGLDISABLEIPROC)&ProfilingTableDecorator::m_glDisablei_profiling;
+if(this->m_ptr_glSelectPerfMonitorCountersAMD)this->m_ptr_glSelectPerfMonitorCountersAMD = (FunctionTable::MEMBERPFNGLSELECTPERFMONITORCOUNTERSAMDPROC)&ProfilingTableDecorator::m_glSelectPerfMonitorCountersAMD_profiling;
+if(this->m_ptr_glGetVertexAttribLi64vNV)this->m_ptr_glGetVertexAttribLi64vNV = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBLI64VNVPROC)&ProfilingTableDecorator::m_glGetVertexAttribLi64vNV_profiling;
+if(this->m_ptr_glBlendFuncSeparateiARB)this->m_ptr_glBlendFuncSeparateiARB = (FunctionTable::MEMBERPFNGLBLENDFUNCSEPARATEIARBPROC)&ProfilingTableDecorator::m_glBlendFuncSeparateiARB_profiling;
+if(this->m_ptr_glWeightuivARB)this->m_ptr_glWeightuivARB = (FunctionTable::MEMBERPFNGLWEIGHTUIVARBPROC)&ProfilingTableDecorator::m_glWeightuivARB_profiling;
+if(this->m_ptr_glWindowPos2iARB)this->m_ptr_glWindowPos2iARB = (FunctionTable::MEMBERPFNGLWINDOWPOS2IARBPROC)&ProfilingTableDecorator::m_glWindowPos2iARB_profiling;
+if(this->m_ptr_glGetProgramLocalParameterdvARB)this->m_ptr_glGetProgramLocalParameterdvARB = (FunctionTable::MEMBERPFNGLGETPROGRAMLOCALPARAMETERDVARBPROC)&ProfilingTableDecorator::m_glGetProgramLocalParameterdvARB_profiling;
+if(this->m_ptr_glGetUniformui64vARB)this->m_ptr_glGetUniformui64vARB = (FunctionTable::MEMBERPFNGLGETUNIFORMUI64VARBPROC)&ProfilingTableDecorator::m_glGetUniformui64vARB_profiling;
+if(this->m_ptr_glGetSynciv)this->m_ptr_glGetSynciv = (FunctionTable::MEMBERPFNGLGETSYNCIVPROC)&ProfilingTableDecorator::m_glGetSynciv_profiling;
+if(this->m_ptr_glMakeImageHandleResidentARB)this->m_ptr_glMakeImageHandleResidentARB = (FunctionTable::MEMBERPFNGLMAKEIMAGEHANDLERESIDENTARBPROC)&ProfilingTableDecorator::m_glMakeImageHandleResidentARB_profiling;
+if(this->m_ptr_glGetProgramNamedParameterfvNV)this->m_ptr_glGetProgramNamedParameterfvNV = (FunctionTable::MEMBERPFNGLGETPROGRAMNAMEDPARAMETERFVNVPROC)&ProfilingTableDecorator::m_glGetProgramNamedParameterfvNV_profiling;
+if(this->m_ptr_glTextureStorage3D)this->m_ptr_glTextureStorage3D = (FunctionTable::MEMBERPFNGLTEXTURESTORAGE3DPROC)&ProfilingTableDecorator::m_glTextureStorage3D_profiling;
+if(this->m_ptr_glVertexAttrib4svNV)this->m_ptr_glVertexAttrib4svNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4SVNVPROC)&ProfilingTableDecorator::m_glVertexAttrib4svNV_profiling;
+if(this->m_ptr_glProgramUniform2i)this->m_ptr_glProgramUniform2i = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2IPROC)&ProfilingTableDecorator::m_glProgramUniform2i_profiling;
+if(this->m_ptr_glListDrawCommandsStatesClientNV)this->m_ptr_glListDrawCommandsStatesClientNV = (FunctionTable::MEMBERPFNGLLISTDRAWCOMMANDSSTATESCLIENTNVPROC)&ProfilingTableDecorator::m_glListDrawCommandsStatesClientNV_profiling;
+if(this->m_ptr_glProgramLocalParametersI4uivNV)this->m_ptr_glProgramLocalParametersI4uivNV = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERSI4UIVNVPROC)&ProfilingTableDecorator::m_glProgramLocalParametersI4uivNV_profiling;
+if(this->m_ptr_glBeginTransformFeedbackNV)this->m_ptr_glBeginTransformFeedbackNV = (FunctionTable::MEMBERPFNGLBEGINTRANSFORMFEEDBACKNVPROC)&ProfilingTableDecorator::m_glBeginTransformFeedbackNV_profiling;
+if(this->m_ptr_glGetProgramBinary)this->m_ptr_glGetProgramBinary = (FunctionTable::MEMBERPFNGLGETPROGRAMBINARYPROC)&ProfilingTableDecorator::m_glGetProgramBinary_profiling;
+if(this->m_ptr_glBinormal3iEXT)this->m_ptr_glBinormal3iEXT = (FunctionTable::MEMBERPFNGLBINORMAL3IEXTPROC)&ProfilingTableDecorator::m_glBinormal3iEXT_profiling;
+if(this->m_ptr_glEvalPoint1)this->m_ptr_glEvalPoint1 = (FunctionTable::MEMBERPFNGLEVALPOINT1PROC)&ProfilingTableDecorator::m_glEvalPoint1_profiling;
+if(this->m_ptr_glEvalPoint2)this->m_ptr_glEvalPoint2 = (FunctionTable::MEMBERPFNGLEVALPOINT2PROC)&ProfilingTableDecorator::m_glEvalPoint2_profiling;
+if(this->m_ptr_glPauseTransformFeedback)this->m_ptr_glPauseTransformFeedback = (FunctionTable::MEMBERPFNGLPAUSETRANSFORMFEEDBACKPROC)&ProfilingTableDecorator::m_glPauseTransformFeedback_profiling;
+if(this->m_ptr_glWindowPos2sMESA)this->m_ptr_glWindowPos2sMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS2SMESAPROC)&ProfilingTableDecorator::m_glWindowPos2sMESA_profiling;
+if(this->m_ptr_glGlobalAlphaFactorbSUN)this->m_ptr_glGlobalAlphaFactorbSUN = (FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORBSUNPROC)&ProfilingTableDecorator::m_glGlobalAlphaFactorbSUN_profiling;
+if(this->m_ptr_glCreateTransformFeedbacks)this->m_ptr_glCreateTransformFeedbacks = (FunctionTable::MEMBERPFNGLCREATETRANSFORMFEEDBACKSPROC)&ProfilingTableDecorator::m_glCreateTransformFeedbacks_profiling;
+if(this->m_ptr_glTexturePageCommitmentEXT)this->m_ptr_glTexturePageCommitmentEXT = (FunctionTable::MEMBERPFNGLTEXTUREPAGECOMMITMENTEXTPROC)&ProfilingTableDecorator::m_glTexturePageCommitmentEXT_profiling;
+if(this->m_ptr_glTransformFeedbackVaryingsNV)this->m_ptr_glTransformFeedbackVaryingsNV = (FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKVARYINGSNVPROC)&ProfilingTableDecorator::m_glTransformFeedbackVaryingsNV_profiling;
+if(this->m_ptr_glTexSubImage1D)this->m_ptr_glTexSubImage1D = (FunctionTable::MEMBERPFNGLTEXSUBIMAGE1DPROC)&ProfilingTableDecorator::m_glTexSubImage1D_profiling;
+if(this->m_ptr_glConvolutionParameterfvEXT)this->m_ptr_glConvolutionParameterfvEXT = (FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERFVEXTPROC)&ProfilingTableDecorator::m_glConvolutionParameterfvEXT_profiling;
+if(this->m_ptr_glBlitFramebufferEXT)this->m_ptr_glBlitFramebufferEXT = (FunctionTable::MEMBERPFNGLBLITFRAMEBUFFEREXTPROC)&ProfilingTableDecorator::m_glBlitFramebufferEXT_profiling;
+if(this->m_ptr_glUniformMatrix4fvARB)this->m_ptr_glUniformMatrix4fvARB = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX4FVARBPROC)&ProfilingTableDecorator::m_glUniformMatrix4fvARB_profiling;
+if(this->m_ptr_glProgramEnvParameter4dvARB)this->m_ptr_glProgramEnvParameter4dvARB = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETER4DVARBPROC)&ProfilingTableDecorator::m_glProgramEnvParameter4dvARB_profiling;
+if(this->m_ptr_glSecondaryColor3hNV)this->m_ptr_glSecondaryColor3hNV = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3HNVPROC)&ProfilingTableDecorator::m_glSecondaryColor3hNV_profiling;
+if(this->m_ptr_glVertexAttribP3uiv)this->m_ptr_glVertexAttribP3uiv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBP3UIVPROC)&ProfilingTableDecorator::m_glVertexAttribP3uiv_profiling;
+if(this->m_ptr_glFogCoordFormatNV)this->m_ptr_glFogCoordFormatNV = (FunctionTable::MEMBERPFNGLFOGCOORDFORMATNVPROC)&ProfilingTableDecorator::m_glFogCoordFormatNV_profiling;
+if(this->m_ptr_glGetMultiTexLevelParameterivEXT)this->m_ptr_glGetMultiTexLevelParameterivEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXLEVELPARAMETERIVEXTPROC)&ProfilingTableDecorator::m_glGetMultiTexLevelParameterivEXT_profiling;
+if(this->m_ptr_glIsOcclusionQueryNV)this->m_ptr_glIsOcclusionQueryNV = (FunctionTable::MEMBERPFNGLISOCCLUSIONQUERYNVPROC)&ProfilingTableDecorator::m_glIsOcclusionQueryNV_profiling;
+if(this->m_ptr_glCompressedTexImage2DARB)this->m_ptr_glCompressedTexImage2DARB = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXIMAGE2DARBPROC)&ProfilingTableDecorator::m_glCompressedTexImage2DARB_profiling;
+if(this->m_ptr_glGetProgramEnvParameterIuivNV)this->m_ptr_glGetProgramEnvParameterIuivNV = (FunctionTable::MEMBERPFNGLGETPROGRAMENVPARAMETERIUIVNVPROC)&ProfilingTableDecorator::m_glGetProgramEnvParameterIuivNV_profiling;
+if(this->m_ptr_glVertexAttrib4sv)this->m_ptr_glVertexAttrib4sv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4SVPROC)&ProfilingTableDecorator::m_glVertexAttrib4sv_profiling;
+if(this->m_ptr_glVertexAttrib4fvARB)this->m_ptr_glVertexAttrib4fvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4FVARBPROC)&ProfilingTableDecorator::m_glVertexAttrib4fvARB_profiling;
+if(this->m_ptr_glLoadName)this->m_ptr_glLoadName = (FunctionTable::MEMBERPFNGLLOADNAMEPROC)&ProfilingTableDecorator::m_glLoadName_profiling;
+if(this->m_ptr_glBindVertexShaderEXT)this->m_ptr_glBindVertexShaderEXT = (FunctionTable::MEMBERPFNGLBINDVERTEXSHADEREXTPROC)&ProfilingTableDecorator::m_glBindVertexShaderEXT_profiling;
+if(this->m_ptr_glGetNamedProgramLocalParameterIivEXT)this->m_ptr_glGetNamedProgramLocalParameterIivEXT = (FunctionTable::MEMBERPFNGLGETNAMEDPROGRAMLOCALPARAMETERIIVEXTPROC)&ProfilingTableDecorator::m_glGetNamedProgramLocalParameterIivEXT_profiling;
+if(this->m_ptr_glProgramUniform3uiEXT)this->m_ptr_glProgramUniform3uiEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UIEXTPROC)&ProfilingTableDecorator::m_glProgramUniform3uiEXT_profiling;
+if(this->m_ptr_glProgramUniformMatrix4x2dvEXT)this->m_ptr_glProgramUniformMatrix4x2dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X2DVEXTPROC)&ProfilingTableDecorator::m_glProgramUniformMatrix4x2dvEXT_profiling;
+if(this->m_ptr_glTexCoord1hvNV)this->m_ptr_glTexCoord1hvNV = (FunctionTable::MEMBERPFNGLTEXCOORD1HVNVPROC)&ProfilingTableDecorator::m_glTexCoord1hvNV_profiling;
+if(this->m_ptr_glLoadMatrixd)this->m_ptr_glLoadMatrixd = (FunctionTable::MEMBERPFNGLLOADMATRIXDPROC)&ProfilingTableDecorator::m_glLoadMatrixd_profiling;
+if(this->m_ptr_glTexParameterfv)this->m_ptr_glTexParameterfv = (FunctionTable::MEMBERPFNGLTEXPARAMETERFVPROC)&ProfilingTableDecorator::m_glTexParameterfv_profiling;
+if(this->m_ptr_glVariantdvEXT)this->m_ptr_glVariantdvEXT = (FunctionTable::MEMBERPFNGLVARIANTDVEXTPROC)&ProfilingTableDecorator::m_glVariantdvEXT_profiling;
+if(this->m_ptr_glCullParameterfvEXT)this->m_ptr_glCullParameterfvEXT = (FunctionTable::MEMBERPFNGLCULLPARAMETERFVEXTPROC)&ProfilingTableDecorator::m_glCullParameterfvEXT_profiling;
+if(this->m_ptr_glUniform3dv)this->m_ptr_glUniform3dv = (FunctionTable::MEMBERPFNGLUNIFORM3DVPROC)&ProfilingTableDecorator::m_glUniform3dv_profiling;
+if(this->m_ptr_glProgramUniform3fv)this->m_ptr_glProgramUniform3fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3FVPROC)&ProfilingTableDecorator::m_glProgramUniform3fv_profiling;
+if(this->m_ptr_glIsBufferARB)this->m_ptr_glIsBufferARB = (FunctionTable::MEMBERPFNGLISBUFFERARBPROC)&ProfilingTableDecorator::m_glIsBufferARB_profiling;
+if(this->m_ptr_glMultiTexCoord1bOES)this->m_ptr_glMultiTexCoord1bOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1BOESPROC)&ProfilingTableDecorator::m_glMultiTexCoord1bOES_profiling;
+if(this->m_ptr_glFogCoordhNV)this->m_ptr_glFogCoordhNV = (FunctionTable::MEMBERPFNGLFOGCOORDHNVPROC)&ProfilingTableDecorator::m_glFogCoordhNV_profiling;
+if(this->m_ptr_glFramebufferSampleLocationsfvNV)this->m_ptr_glFramebufferSampleLocationsfvNV = (FunctionTable::MEMBERPFNGLFRAMEBUFFERSAMPLELOCATIONSFVNVPROC)&ProfilingTableDecorator::m_glFramebufferSampleLocationsfvNV_profiling;
+if(this->m_ptr_glGenSymbolsEXT)this->m_ptr_glGenSymbolsEXT = (FunctionTable::MEMBERPFNGLGENSYMBOLSEXTPROC)&ProfilingTableDecorator::m_glGenSymbolsEXT_profiling;
+if(this->m_ptr_glGetConvolutionFilter)this->m_ptr_glGetConvolutionFilter = (FunctionTable::MEMBERPFNGLGETCONVOLUTIONFILTERPROC)&ProfilingTableDecorator::m_glGetConvolutionFilter_profiling;
+if(this->m_ptr_glProgramUniform1fvEXT)this->m_ptr_glProgramUniform1fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1FVEXTPROC)&ProfilingTableDecorator::m_glProgramUniform1fvEXT_profiling;
+if(this->m_ptr_glGetNextPerfQueryIdINTEL)this->m_ptr_glGetNextPerfQueryIdINTEL = (FunctionTable::MEMBERPFNGLGETNEXTPERFQUERYIDINTELPROC)&ProfilingTableDecorator::m_glGetNextPerfQueryIdINTEL_profiling;
+if(this->m_ptr_glCompressedTexImage1DARB)this->m_ptr_glCompressedTexImage1DARB = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXIMAGE1DARBPROC)&ProfilingTableDecorator::m_glCompressedTexImage1DARB_profiling;
+if(this->m_ptr_glBindSamplers)this->m_ptr_glBindSamplers = (FunctionTable::MEMBERPFNGLBINDSAMPLERSPROC)&ProfilingTableDecorator::m_glBindSamplers_profiling;
+if(this->m_ptr_glGetProgramEnvParameterIivNV)this->m_ptr_glGetProgramEnvParameterIivNV = (FunctionTable::MEMBERPFNGLGETPROGRAMENVPARAMETERIIVNVPROC)&ProfilingTableDecorator::m_glGetProgramEnvParameterIivNV_profiling;
+if(this->m_ptr_glGetQueryObjectui64v)this->m_ptr_glGetQueryObjectui64v = (FunctionTable::MEMBERPFNGLGETQUERYOBJECTUI64VPROC)&ProfilingTableDecorator::m_glGetQueryObjectui64v_profiling;
+if(this->m_ptr_glVertexAttribL4ui64vNV)this->m_ptr_glVertexAttribL4ui64vNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL4UI64VNVPROC)&ProfilingTableDecorator::m_glVertexAttribL4ui64vNV_profiling;
+if(this->m_ptr_glGetVideoivNV)this->m_ptr_glGetVideoivNV = (FunctionTable::MEMBERPFNGLGETVIDEOIVNVPROC)&ProfilingTableDecorator::m_glGetVideoivNV_profiling;
+if(this->m_ptr_glGetTextureImage)this->m_ptr_glGetTextureImage = (FunctionTable::MEMBERPFNGLGETTEXTUREIMAGEPROC)&ProfilingTableDecorator::m_glGetTextureImage_profiling;
+if(this->m_ptr_glProgramUniform1fv)this->m_ptr_glProgramUniform1fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1FVPROC)&ProfilingTableDecorator::m_glProgramUniform1fv_profiling;
+if(this->m_ptr_glUniformMatrix4fv)this->m_ptr_glUniformMatrix4fv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX4FVPROC)&ProfilingTableDecorator::m_glUniformMatrix4fv_profiling;
+if(this->m_ptr_glColorMask)this->m_ptr_glColorMask = (FunctionTable::MEMBERPFNGLCOLORMASKPROC)&ProfilingTableDecorator::m_glColorMask_profiling;
+if(this->m_ptr_glBeginFragmentShaderATI)this->m_ptr_glBeginFragmentShaderATI = (FunctionTable::MEMBERPFNGLBEGINFRAGMENTSHADERATIPROC)&ProfilingTableDecorator::m_glBeginFragmentShaderATI_profiling;
+if(this->m_ptr_glMultiDrawArraysEXT)this->m_ptr_glMultiDrawArraysEXT = (FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSEXTPROC)&ProfilingTableDecorator::m_glMultiDrawArraysEXT_profiling;
+if(this->m_ptr_glGenNamesAMD)this->m_ptr_glGenNamesAMD = (FunctionTable::MEMBERPFNGLGENNAMESAMDPROC)&ProfilingTableDecorator::m_glGenNamesAMD_profiling;
+if(this->m_ptr_glPathParameteriNV)this->m_ptr_glPathParameteriNV = (FunctionTable::MEMBERPFNGLPATHPARAMETERINVPROC)&ProfilingTableDecorator::m_glPathParameteriNV_profiling;
+if(this->m_ptr_glCreateCommandListsNV)this->m_ptr_glCreateCommandListsNV = (FunctionTable::MEMBERPFNGLCREATECOMMANDLISTSNVPROC)&ProfilingTableDecorator::m_glCreateCommandListsNV_profiling;
+if(this->m_ptr_glDeleteProgramPipelines)this->m_ptr_glDeleteProgramPipelines = (FunctionTable::MEMBERPFNGLDELETEPROGRAMPIPELINESPROC)&ProfilingTableDecorator::m_glDeleteProgramPipelines_profiling;
+if(this->m_ptr_glCopyColorSubTableEXT)this->m_ptr_glCopyColorSubTableEXT = (FunctionTable::MEMBERPFNGLCOPYCOLORSUBTABLEEXTPROC)&ProfilingTableDecorator::m_glCopyColorSubTableEXT_profiling;
+if(this->m_ptr_glVariantsvEXT)this->m_ptr_glVariantsvEXT = (FunctionTable::MEMBERPFNGLVARIANTSVEXTPROC)&ProfilingTableDecorator::m_glVariantsvEXT_profiling;
+if(this->m_ptr_glGenProgramPipelines)this->m_ptr_glGenProgramPipelines = (FunctionTable::MEMBERPFNGLGENPROGRAMPIPELINESPROC)&ProfilingTableDecorator::m_glGenProgramPipelines_profiling;
+if(this->m_ptr_glVertexArrayEdgeFlagOffsetEXT)this->m_ptr_glVertexArrayEdgeFlagOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYEDGEFLAGOFFSETEXTPROC)&ProfilingTableDecorator::m_glVertexArrayEdgeFlagOffsetEXT_profiling;
+if(this->m_ptr_glWindowPos2s)this->m_ptr_glWindowPos2s = (FunctionTable::MEMBERPFNGLWINDOWPOS2SPROC)&ProfilingTableDecorator::m_glWindowPos2s_profiling;
+if(this->m_ptr_glSecondaryColor3iEXT)this->m_ptr_glSecondaryColor3iEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3IEXTPROC)&ProfilingTableDecorator::m_glSecondaryColor3iEXT_profiling;
+if(this->m_ptr_glWindowPos2i)this->m_ptr_glWindowPos2i = (FunctionTable::MEMBERPFNGLWINDOWPOS2IPROC)&ProfilingTableDecorator::m_glWindowPos2i_profiling;
+if(this->m_ptr_glWindowPos2f)this->m_ptr_glWindowPos2f = (FunctionTable::MEMBERPFNGLWINDOWPOS2FPROC)&ProfilingTableDecorator::m_glWindowPos2f_profiling;
+if(this->m_ptr_glWindowPos2d)this->m_ptr_glWindowPos2d = (FunctionTable::MEMBERPFNGLWINDOWPOS2DPROC)&ProfilingTableDecorator::m_glWindowPos2d_profiling;
+if(this->m_ptr_glUniform4uivEXT)this->m_ptr_glUniform4uivEXT = (FunctionTable::MEMBERPFNGLUNIFORM4UIVEXTPROC)&ProfilingTableDecorator::m_glUniform4uivEXT_profiling;
+if(this->m_ptr_glOrthoxOES)this->m_ptr_glOrthoxOES = (FunctionTable::MEMBERPFNGLORTHOXOESPROC)&ProfilingTableDecorator::m_glOrthoxOES_profiling;
+if(this->m_ptr_glUniformSubroutinesuiv)this->m_ptr_glUniformSubroutinesuiv = (FunctionTable::MEMBERPFNGLUNIFORMSUBROUTINESUIVPROC)&ProfilingTableDecorator::m_glUniformSubroutinesuiv_profiling;
+if(this->m_ptr_glRectdv)this->m_ptr_glRectdv = (FunctionTable::MEMBERPFNGLRECTDVPROC)&ProfilingTableDecorator::m_glRectdv_profiling;
+if(this->m_ptr_glProgramUniform1i64vNV)this->m_ptr_glProgramUniform1i64vNV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1I64VNVPROC)&ProfilingTableDecorator::m_glProgramUniform1i64vNV_profiling;
+if(this->m_ptr_glVertexAttribI4uiEXT)this->m_ptr_glVertexAttribI4uiEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4UIEXTPROC)&ProfilingTableDecorator::m_glVertexAttribI4uiEXT_profiling;
+if(this->m_ptr_glSecondaryColor3ubEXT)this->m_ptr_glSecondaryColor3ubEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UBEXTPROC)&ProfilingTableDecorator::m_glSecondaryColor3ubEXT_profiling;
+if(this->m_ptr_glCompressedMultiTexSubImage1DEXT)this->m_ptr_glCompressedMultiTexSubImage1DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDMULTITEXSUBIMAGE1DEXTPROC)&ProfilingTableDecorator::m_glCompressedMultiTexSubImage1DEXT_profiling;
+if(this->m_ptr_glMultiTexGendEXT)this->m_ptr_glMultiTexGendEXT = (FunctionTable::MEMBERPFNGLMULTITEXGENDEXTPROC)&ProfilingTableDecorator::m_glMultiTexGendEXT_profiling;
+if(this->m_ptr_glColorP3uiv)this->m_ptr_glColorP3uiv = (FunctionTable::MEMBERPFNGLCOLORP3UIVPROC)&ProfilingTableDecorator::m_glColorP3uiv_profiling;
+if(this->m_ptr_glFogCoordfv)this->m_ptr_glFogCoordfv = (FunctionTable::MEMBERPFNGLFOGCOORDFVPROC)&ProfilingTableDecorator::m_glFogCoordfv_profiling;
+if(this->m_ptr_glCompileShader)this->m_ptr_glCompileShader = (FunctionTable::MEMBERPFNGLCOMPILESHADERPROC)&ProfilingTableDecorator::m_glCompileShader_profiling;
+if(this->m_ptr_glTexCoord2hNV)this->m_ptr_glTexCoord2hNV = (FunctionTable::MEMBERPFNGLTEXCOORD2HNVPROC)&ProfilingTableDecorator::m_glTexCoord2hNV_profiling;
+if(this->m_ptr_glUniform1uivEXT)this->m_ptr_glUniform1uivEXT = (FunctionTable::MEMBERPFNGLUNIFORM1UIVEXTPROC)&ProfilingTableDecorator::m_glUniform1uivEXT_profiling;
+if(this->m_ptr_glMatrixLoadTransposedEXT)this->m_ptr_glMatrixLoadTransposedEXT = (FunctionTable::MEMBERPFNGLMATRIXLOADTRANSPOSEDEXTPROC)&ProfilingTableDecorator::m_glMatrixLoadTransposedEXT_profiling;
+if(this->m_ptr_glIndexfv)this->m_ptr_glIndexfv = (FunctionTable::MEMBERPFNGLINDEXFVPROC)&ProfilingTableDecorator::m_glIndexfv_profiling;
+if(this->m_ptr_glGetCompressedTextureImage)this->m_ptr_glGetCompressedTextureImage = (FunctionTable::MEMBERPFNGLGETCOMPRESSEDTEXTUREIMAGEPROC)&ProfilingTableDecorator::m_glGetCompressedTextureImage_profiling;
+if(this->m_ptr_glGetUniformuivEXT)this->m_ptr_glGetUniformuivEXT = (FunctionTable::MEMBERPFNGLGETUNIFORMUIVEXTPROC)&ProfilingTableDecorator::m_glGetUniformuivEXT_profiling;
+if(this->m_ptr_glGetnPixelMapfvARB)this->m_ptr_glGetnPixelMapfvARB = (FunctionTable::MEMBERPFNGLGETNPIXELMAPFVARBPROC)&ProfilingTableDecorator::m_glGetnPixelMapfvARB_profiling;
+if(this->m_ptr_glFramebufferTextureEXT)this->m_ptr_glFramebufferTextureEXT = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTUREEXTPROC)&ProfilingTableDecorator::m_glFramebufferTextureEXT_profiling;
+if(this->m_ptr_glVertexAttribIPointer)this->m_ptr_glVertexAttribIPointer = (FunctionTable::MEMBERPFNGLVERTEXATTRIBIPOINTERPROC)&ProfilingTableDecorator::m_glVertexAttribIPointer_profiling;
+if(this->m_ptr_glMultiTexCoordP3ui)this->m_ptr_glMultiTexCoordP3ui = (FunctionTable::MEMBERPFNGLMULTITEXCOORDP3UIPROC)&ProfilingTableDecorator::m_glMultiTexCoordP3ui_profiling;
+if(this->m_ptr_glEvaluateDepthValuesARB)this->m_ptr_glEvaluateDepthValuesARB = (FunctionTable::MEMBERPFNGLEVALUATEDEPTHVALUESARBPROC)&ProfilingTableDecorator::m_glEvaluateDepthValuesARB_profiling;
+if(this->m_ptr_glGetNamedBufferParameteriv)this->m_ptr_glGetNamedBufferParameteriv = (FunctionTable::MEMBERPFNGLGETNAMEDBUFFERPARAMETERIVPROC)&ProfilingTableDecorator::m_glGetNamedBufferParameteriv_profiling;
+if(this->m_ptr_glGetNamedProgramLocalParameterfvEXT)this->m_ptr_glGetNamedProgramLocalParameterfvEXT = (FunctionTable::MEMBERPFNGLGETNAMEDPROGRAMLOCALPARAMETERFVEXTPROC)&ProfilingTableDecorator::m_glGetNamedProgramLocalParameterfvEXT_profiling;
+if(this->m_ptr_glColor4fNormal3fVertex3fvSUN)this->m_ptr_glColor4fNormal3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLCOLOR4FNORMAL3FVERTEX3FVSUNPROC)&ProfilingTableDecorator::m_glColor4fNormal3fVertex3fvSUN_profiling;
+if(this->m_ptr_glSeparableFilter2DEXT)this->m_ptr_glSeparableFilter2DEXT = (FunctionTable::MEMBERPFNGLSEPARABLEFILTER2DEXTPROC)&ProfilingTableDecorator::m_glSeparableFilter2DEXT_profiling;
+if(this->m_ptr_glTexParameterxOES)this->m_ptr_glTexParameterxOES = (FunctionTable::MEMBERPFNGLTEXPARAMETERXOESPROC)&ProfilingTableDecorator::m_glTexParameterxOES_profiling;
+if(this->m_ptr_glClearAccumxOES)this->m_ptr_glClearAccumxOES = (FunctionTable::MEMBERPFNGLCLEARACCUMXOESPROC)&ProfilingTableDecorator::m_glClearAccumxOES_profiling;
+if(this->m_ptr_glInvalidateFramebuffer)this->m_ptr_glInvalidateFramebuffer = (FunctionTable::MEMBERPFNGLINVALIDATEFRAMEBUFFERPROC)&ProfilingTableDecorator::m_glInvalidateFramebuffer_profiling;
+if(this->m_ptr_glWeightubvARB)this->m_ptr_glWeightubvARB = (FunctionTable::MEMBERPFNGLWEIGHTUBVARBPROC)&ProfilingTableDecorator::m_glWeightubvARB_profiling;
+if(this->m_ptr_glVertexAttrib1d)this->m_ptr_glVertexAttrib1d = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1DPROC)&ProfilingTableDecorator::m_glVertexAttrib1d_profiling;
+if(this->m_ptr_glVertexAttrib1f)this->m_ptr_glVertexAttrib1f = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1FPROC)&ProfilingTableDecorator::m_glVertexAttrib1f_profiling;
+if(this->m_ptr_glVertex4fv)this->m_ptr_glVertex4fv = (FunctionTable::MEMBERPFNGLVERTEX4FVPROC)&ProfilingTableDecorator::m_glVertex4fv_profiling;
+if(this->m_ptr_glClearNamedFramebufferfi)this->m_ptr_glClearNamedFramebufferfi = (FunctionTable::MEMBERPFNGLCLEARNAMEDFRAMEBUFFERFIPROC)&ProfilingTableDecorator::m_glClearNamedFramebufferfi_profiling;
+if(this->m_ptr_glGetQueryBufferObjectuiv)this->m_ptr_glGetQueryBufferObjectuiv = (FunctionTable::MEMBERPFNGLGETQUERYBUFFEROBJECTUIVPROC)&ProfilingTableDecorator::m_glGetQueryBufferObjectuiv_profiling;
+if(this->m_ptr_glClearNamedFramebufferfv)this->m_ptr_glClearNamedFramebufferfv = (FunctionTable::MEMBERPFNGLCLEARNAMEDFRAMEBUFFERFVPROC)&ProfilingTableDecorator::m_glClearNamedFramebufferfv_profiling;
+if(this->m_ptr_glEndVertexShaderEXT)this->m_ptr_glEndVertexShaderEXT = (FunctionTable::MEMBERPFNGLENDVERTEXSHADEREXTPROC)&ProfilingTableDecorator::m_glEndVertexShaderEXT_profiling;
+if(this->m_ptr_glVertexAttrib1s)this->m_ptr_glVertexAttrib1s = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1SPROC)&ProfilingTableDecorator::m_glVertexAttrib1s_profiling;
+if(this->m_ptr_glMultiTexCoord4dvARB)this->m_ptr_glMultiTexCoord4dvARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4DVARBPROC)&ProfilingTableDecorator::m_glMultiTexCoord4dvARB_profiling;
+if(this->m_ptr_glMultiTexCoord1sv)this->m_ptr_glMultiTexCoord1sv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1SVPROC)&ProfilingTableDecorator::m_glMultiTexCoord1sv_profiling;
+if(this->m_ptr_glUniform1ui64vNV)this->m_ptr_glUniform1ui64vNV = (FunctionTable::MEMBERPFNGLUNIFORM1UI64VNVPROC)&ProfilingTableDecorator::m_glUniform1ui64vNV_profiling;
+if(this->m_ptr_glGetClipPlanefOES)this->m_ptr_glGetClipPlanefOES = (FunctionTable::MEMBERPFNGLGETCLIPPLANEFOESPROC)&ProfilingTableDecorator::m_glGetClipPlanefOES_profiling;
+if(this->m_ptr_glRasterPos2s)this->m_ptr_glRasterPos2s = (FunctionTable::MEMBERPFNGLRASTERPOS2SPROC)&ProfilingTableDecorator::m_glRasterPos2s_profiling;
+if(this->m_ptr_glWeightivARB)this->m_ptr_glWeightivARB = (FunctionTable::MEMBERPFNGLWEIGHTIVARBPROC)&ProfilingTableDecorator::m_glWeightivARB_profiling;
+if(this->m_ptr_glMultiTexCoord4hvNV)this->m_ptr_glMultiTexCoord4hvNV = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4HVNVPROC)&ProfilingTableDecorator::m_glMultiTexCoord4hvNV_profiling;
+if(this->m_ptr_glNormal3hNV)this->m_ptr_glNormal3hNV = (FunctionTable::MEMBERPFNGLNORMAL3HNVPROC)&ProfilingTableDecorator::m_glNormal3hNV_profiling;
+if(this->m_ptr_glGetSeparableFilter)this->m_ptr_glGetSeparableFilter = (FunctionTable::MEMBERPFNGLGETSEPARABLEFILTERPROC)&ProfilingTableDecorator::m_glGetSeparableFilter_profiling;
+if(this->m_ptr_glGetPathTexGenivNV)this->m_ptr_glGetPathTexGenivNV = (FunctionTable::MEMBERPFNGLGETPATHTEXGENIVNVPROC)&ProfilingTableDecorator::m_glGetPathTexGenivNV_profiling;
+if(this->m_ptr_glColor4bv)this->m_ptr_glColor4bv = (FunctionTable::MEMBERPFNGLCOLOR4BVPROC)&ProfilingTableDecorator::m_glColor4bv_profiling;
+if(this->m_ptr_glRasterPos2f)this->m_ptr_glRasterPos2f = (FunctionTable::MEMBERPFNGLRASTERPOS2FPROC)&ProfilingTableDecorator::m_glRasterPos2f_profiling;
+if(this->m_ptr_glNamedBufferPageCommitmentARB)this->m_ptr_glNamedBufferPageCommitmentARB = (FunctionTable::MEMBERPFNGLNAMEDBUFFERPAGECOMMITMENTARBPROC)&ProfilingTableDecorator::m_glNamedBufferPageCommitmentARB_profiling;
+if(this->m_ptr_glLoadIdentity)this->m_ptr_glLoadIdentity = (FunctionTable::MEMBERPFNGLLOADIDENTITYPROC)&ProfilingTableDecorator::m_glLoadIdentity_profiling;
+if(this->m_ptr_glRasterPos2i)this->m_ptr_glRasterPos2i = (FunctionTable::MEMBERPFNGLRASTERPOS2IPROC)&ProfilingTableDecorator::m_glRasterPos2i_profiling;
+if(this->m_ptr_glRasterPos4iv)this->m_ptr_glRasterPos4iv = (FunctionTable::MEMBERPFNGLRASTERPOS4IVPROC)&ProfilingTableDecorator::m_glRasterPos4iv_profiling;
+if(this->m_ptr_glMultiTexCoord2fvARB)this->m_ptr_glMultiTexCoord2fvARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2FVARBPROC)&ProfilingTableDecorator::m_glMultiTexCoord2fvARB_profiling;
+if(this->m_ptr_glUniformMatrix4x3fv)this->m_ptr_glUniformMatrix4x3fv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX4X3FVPROC)&ProfilingTableDecorator::m_glUniformMatrix4x3fv_profiling;
+if(this->m_ptr_glClearBufferfv)this->m_ptr_glClearBufferfv = (FunctionTable::MEMBERPFNGLCLEARBUFFERFVPROC)&ProfilingTableDecorator::m_glClearBufferfv_profiling;
+if(this->m_ptr_glMultiTexCoord4hNV)this->m_ptr_glMultiTexCoord4hNV = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4HNVPROC)&ProfilingTableDecorator::m_glMultiTexCoord4hNV_profiling;
+if(this->m_ptr_glTextureBarrier)this->m_ptr_glTextureBarrier = (FunctionTable::MEMBERPFNGLTEXTUREBARRIERPROC)&ProfilingTableDecorator::m_glTextureBarrier_profiling;
+if(this->m_ptr_glReplacementCodeuivSUN)this->m_ptr_glReplacementCodeuivSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUIVSUNPROC)&ProfilingTableDecorator::m_glReplacementCodeuivSUN_profiling;
+if(this->m_ptr_glDeleteAsyncMarkersSGIX)this->m_ptr_glDeleteAsyncMarkersSGIX = (FunctionTable::MEMBERPFNGLDELETEASYNCMARKERSSGIXPROC)&ProfilingTableDecorator::m_glDeleteAsyncMarkersSGIX_profiling;
+if(this->m_ptr_glTexCoord2bvOES)this->m_ptr_glTexCoord2bvOES = (FunctionTable::MEMBERPFNGLTEXCOORD2BVOESPROC)&ProfilingTableDecorator::m_glTexCoord2bvOES_profiling;
+if(this->m_ptr_glEvalCoord2xOES)this->m_ptr_glEvalCoord2xOES = (FunctionTable::MEMBERPFNGLEVALCOORD2XOESPROC)&ProfilingTableDecorator::m_glEvalCoord2xOES_profiling;
+if(this->m_ptr_glGetSharpenTexFuncSGIS)this->m_ptr_glGetSharpenTexFuncSGIS = (FunctionTable::MEMBERPFNGLGETSHARPENTEXFUNCSGISPROC)&ProfilingTableDecorator::m_glGetSharpenTexFuncSGIS_profiling;
+if(this->m_ptr_glProgramUniformHandleui64vNV)this->m_ptr_glProgramUniformHandleui64vNV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMHANDLEUI64VNVPROC)&ProfilingTableDecorator::m_glProgramUniformHandleui64vNV_profiling;
+if(this->m_ptr_glIglooInterfaceSGIX)this->m_ptr_glIglooInterfaceSGIX = (FunctionTable::MEMBERPFNGLIGLOOINTERFACESGIXPROC)&ProfilingTableDecorator::m_glIglooInterfaceSGIX_profiling;
+if(this->m_ptr_glWindowPos2dvARB)this->m_ptr_glWindowPos2dvARB = (FunctionTable::MEMBERPFNGLWINDOWPOS2DVARBPROC)&ProfilingTableDecorator::m_glWindowPos2dvARB_profiling;
+if(this->m_ptr_glClearBufferfi)this->m_ptr_glClearBufferfi = (FunctionTable::MEMBERPFNGLCLEARBUFFERFIPROC)&ProfilingTableDecorator::m_glClearBufferfi_profiling;
+if(this->m_ptr_glDrawArraysIndirect)this->m_ptr_glDrawArraysIndirect = (FunctionTable::MEMBERPFNGLDRAWARRAYSINDIRECTPROC)&ProfilingTableDecorator::m_glDrawArraysIndirect_profiling;
+if(this->m_ptr_glGenVertexArrays)this->m_ptr_glGenVertexArrays = (FunctionTable::MEMBERPFNGLGENVERTEXARRAYSPROC)&ProfilingTableDecorator::m_glGenVertexArrays_profiling;
+if(this->m_ptr_glGetTransformFeedbacki64_v)this->m_ptr_glGetTransformFeedbacki64_v = (FunctionTable::MEMBERPFNGLGETTRANSFORMFEEDBACKI64_VPROC)&ProfilingTableDecorator::m_glGetTransformFeedbacki64_v_profiling;
+if(this->m_ptr_glEnableVertexArrayAttrib)this->m_ptr_glEnableVertexArrayAttrib = (FunctionTable::MEMBERPFNGLENABLEVERTEXARRAYATTRIBPROC)&ProfilingTableDecorator::m_glEnableVertexArrayAttrib_profiling;
+if(this->m_ptr_glProgramUniformMatrix3x2dv)this->m_ptr_glProgramUniformMatrix3x2dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X2DVPROC)&ProfilingTableDecorator::m_glProgramUniformMatrix3x2dv_profiling;
+if(this->m_ptr_glVertexStream4fATI)this->m_ptr_glVertexStream4fATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM4FATIPROC)&ProfilingTableDecorator::m_glVertexStream4fATI_profiling;
+if(this->m_ptr_glVertexBindingDivisor)this->m_ptr_glVertexBindingDivisor = (FunctionTable::MEMBERPFNGLVERTEXBINDINGDIVISORPROC)&ProfilingTableDecorator::m_glVertexBindingDivisor_profiling;
+if(this->m_ptr_glGetSamplerParameterIiv)this->m_ptr_glGetSamplerParameterIiv = (FunctionTable::MEMBERPFNGLGETSAMPLERPARAMETERIIVPROC)&ProfilingTableDecorator::m_glGetSamplerParameterIiv_profiling;
+if(this->m_ptr_glGetCoverageModulationTableNV)this->m_ptr_glGetCoverageModulationTableNV = (FunctionTable::MEMBERPFNGLGETCOVERAGEMODULATIONTABLENVPROC)&ProfilingTableDecorator::m_glGetCoverageModulationTableNV_profiling;
+if(this->m_ptr_glDepthRangedNV)this->m_ptr_glDepthRangedNV = (FunctionTable::MEMBERPFNGLDEPTHRANGEDNVPROC)&ProfilingTableDecorator::m_glDepthRangedNV_profiling;
+if(this->m_ptr_glVertexAttrib3f)this->m_ptr_glVertexAttrib3f = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3FPROC)&ProfilingTableDecorator::m_glVertexAttrib3f_profiling;
+if(this->m_ptr_glMultiDrawRangeElementArrayAPPLE)this->m_ptr_glMultiDrawRangeElementArrayAPPLE = (FunctionTable::MEMBERPFNGLMULTIDRAWRANGEELEMENTARRAYAPPLEPROC)&ProfilingTableDecorator::m_glMultiDrawRangeElementArrayAPPLE_profiling;
+if(this->m_ptr_glVertexAttribFormatNV)this->m_ptr_glVertexAttribFormatNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBFORMATNVPROC)&ProfilingTableDecorator::m_glVertexAttribFormatNV_profiling;
+if(this->m_ptr_glGetQueryBufferObjecti64v)this->m_ptr_glGetQueryBufferObjecti64v = (FunctionTable::MEMBERPFNGLGETQUERYBUFFEROBJECTI64VPROC)&ProfilingTableDecorator::m_glGetQueryBufferObjecti64v_profiling;
+if(this->m_ptr_glGetVertexAttribdv)this->m_ptr_glGetVertexAttribdv = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBDVPROC)&ProfilingTableDecorator::m_glGetVertexAttribdv_profiling;
+if(this->m_ptr_glGetUniformi64vARB)this->m_ptr_glGetUniformi64vARB = (FunctionTable::MEMBERPFNGLGETUNIFORMI64VARBPROC)&ProfilingTableDecorator::m_glGetUniformi64vARB_profiling;
+if(this->m_ptr_glAreTexturesResidentEXT)this->m_ptr_glAreTexturesResidentEXT = (FunctionTable::MEMBERPFNGLARETEXTURESRESIDENTEXTPROC)&ProfilingTableDecorator::m_glAreTexturesResidentEXT_profiling;
+if(this->m_ptr_glGetHandleARB)this->m_ptr_glGetHandleARB = (FunctionTable::MEMBERPFNGLGETHANDLEARBPROC)&ProfilingTableDecorator::m_glGetHandleARB_profiling;
+if(this->m_ptr_glVideoCaptureStreamParameterdvNV)this->m_ptr_glVideoCaptureStreamParameterdvNV = (FunctionTable::MEMBERPFNGLVIDEOCAPTURESTREAMPARAMETERDVNVPROC)&ProfilingTableDecorator::m_glVideoCaptureStreamParameterdvNV_profiling;
+if(this->m_ptr_glMapParameterivNV)this->m_ptr_glMapParameterivNV = (FunctionTable::MEMBERPFNGLMAPPARAMETERIVNVPROC)&ProfilingTableDecorator::m_glMapParameterivNV_profiling;
+if(this->m_ptr_glIsVertexArray)this->m_ptr_glIsVertexArray = (FunctionTable::MEMBERPFNGLISVERTEXARRAYPROC)&ProfilingTableDecorator::m_glIsVertexArray_profiling;
+if(this->m_ptr_glSecondaryColor3sEXT)this->m_ptr_glSecondaryColor3sEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3SEXTPROC)&ProfilingTableDecorator::m_glSecondaryColor3sEXT_profiling;
+if(this->m_ptr_glGetTexParameterIivEXT)this->m_ptr_glGetTexParameterIivEXT = (FunctionTable::MEMBERPFNGLGETTEXPARAMETERIIVEXTPROC)&ProfilingTableDecorator::m_glGetTexParameterIivEXT_profiling;
+if(this->m_ptr_glFrameTerminatorGREMEDY)this->m_ptr_glFrameTerminatorGREMEDY = (FunctionTable::MEMBERPFNGLFRAMETERMINATORGREMEDYPROC)&ProfilingTableDecorator::m_glFrameTerminatorGREMEDY_profiling;
+if(this->m_ptr_glBlendBarrierKHR)this->m_ptr_glBlendBarrierKHR = (FunctionTable::MEMBERPFNGLBLENDBARRIERKHRPROC)&ProfilingTableDecorator::m_glBlendBarrierKHR_profiling;
+if(this->m_ptr_glVertexAttrib4NubARB)this->m_ptr_glVertexAttrib4NubARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUBARBPROC)&ProfilingTableDecorator::m_glVertexAttrib4NubARB_profiling;
+if(this->m_ptr_glPrimitiveRestartNV)this->m_ptr_glPrimitiveRestartNV = (FunctionTable::MEMBERPFNGLPRIMITIVERESTARTNVPROC)&ProfilingTableDecorator::m_glPrimitiveRestartNV_profiling;
+if(this->m_ptr_glVertexAttribL1ui64vARB)this->m_ptr_glVertexAttribL1ui64vARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL1UI64VARBPROC)&ProfilingTableDecorator::m_glVertexAttribL1ui64vARB_profiling;
+if(this->m_ptr_glVertexAttribI4ivEXT)this->m_ptr_glVertexAttribI4ivEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4IVEXTPROC)&ProfilingTableDecorator::m_glVertexAttribI4ivEXT_profiling;
+if(this->m_ptr_glVertexAttribs4svNV)this->m_ptr_glVertexAttribs4svNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS4SVNVPROC)&ProfilingTableDecorator::m_glVertexAttribs4svNV_profiling;
+if(this->m_ptr_glUniform1ui)this->m_ptr_glUniform1ui = (FunctionTable::MEMBERPFNGLUNIFORM1UIPROC)&ProfilingTableDecorator::m_glUniform1ui_profiling;
+if(this->m_ptr_glVertexAttrib2fvARB)this->m_ptr_glVertexAttrib2fvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2FVARBPROC)&ProfilingTableDecorator::m_glVertexAttrib2fvARB_profiling;
+if(this->m_ptr_glVertexAttribI4svEXT)this->m_ptr_glVertexAttribI4svEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4SVEXTPROC)&ProfilingTableDecorator::m_glVertexAttribI4svEXT_profiling;
+if(this->m_ptr_glTextureImage3DMultisampleCoverageNV)this->m_ptr_glTextureImage3DMultisampleCoverageNV = (FunctionTable::MEMBERPFNGLTEXTUREIMAGE3DMULTISAMPLECOVERAGENVPROC)&ProfilingTableDecorator::m_glTextureImage3DMultisampleCoverageNV_profiling;
+if(this->m_ptr_glMemoryBarrier)this->m_ptr_glMemoryBarrier = (FunctionTable::MEMBERPFNGLMEMORYBARRIERPROC)&ProfilingTableDecorator::m_glMemoryBarrier_profiling;
+if(this->m_ptr_glGetVariantArrayObjectfvATI)this->m_ptr_glGetVariantArrayObjectfvATI = (FunctionTable::MEMBERPFNGLGETVARIANTARRAYOBJECTFVATIPROC)&ProfilingTableDecorator::m_glGetVariantArrayObjectfvATI_profiling;
+if(this->m_ptr_glTexCoord4fColor4fNormal3fVertex4fvSUN)this->m_ptr_glTexCoord4fColor4fNormal3fVertex4fvSUN = (FunctionTable::MEMBERPFNGLTEXCOORD4FCOLOR4FNORMAL3FVERTEX4FVSUNPROC)&ProfilingTableDecorator::m_glTexCoord4fColor4fNormal3fVertex4fvSUN_profiling;
+if(this->m_ptr_glIsProgramARB)this->m_ptr_glIsProgramARB = (FunctionTable::MEMBERPFNGLISPROGRAMARBPROC)&ProfilingTableDecorator::m_glIsProgramARB_profiling;
+if(this->m_ptr_glBindImageTextureEXT)this->m_ptr_glBindImageTextureEXT = (FunctionTable::MEMBERPFNGLBINDIMAGETEXTUREEXTPROC)&ProfilingTableDecorator::m_glBindImageTextureEXT_profiling;
+if(this->m_ptr_glGetFragDataLocation)this->m_ptr_glGetFragDataLocation = (FunctionTable::MEMBERPFNGLGETFRAGDATALOCATIONPROC)&ProfilingTableDecorator::m_glGetFragDataLocation_profiling;
+if(this->m_ptr_glMultiTexCoord1svARB)this->m_ptr_glMultiTexCoord1svARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1SVARBPROC)&ProfilingTableDecorator::m_glMultiTexCoord1svARB_profiling;
+if(this->m_ptr_glGetMapxvOES)this->m_ptr_glGetMapxvOES = (FunctionTable::MEMBERPFNGLGETMAPXVOESPROC)&ProfilingTableDecorator::m_glGetMapxvOES_profiling;
+if(this->m_ptr_glTextureStorage2DMultisampleEXT)this->m_ptr_glTextureStorage2DMultisampleEXT = (FunctionTable::MEMBERPFNGLTEXTURESTORAGE2DMULTISAMPLEEXTPROC)&ProfilingTableDecorator::m_glTextureStorage2DMultisampleEXT_profiling;
+if(this->m_ptr_glGetMaterialfv)this->m_ptr_glGetMaterialfv = (FunctionTable::MEMBERPFNGLGETMATERIALFVPROC)&ProfilingTableDecorator::m_glGetMaterialfv_profiling;
+if(this->m_ptr_glVertexAttrib4NbvARB)this->m_ptr_glVertexAttrib4NbvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NBVARBPROC)&ProfilingTableDecorator::m_glVertexAttrib4NbvARB_profiling;
+if(this->m_ptr_glPixelMapuiv)this->m_ptr_glPixelMapuiv = (FunctionTable::MEMBERPFNGLPIXELMAPUIVPROC)&ProfilingTableDecorator::m_glPixelMapuiv_profiling;
+if(this->m_ptr_glColorPointerEXT)this->m_ptr_glColorPointerEXT = (FunctionTable::MEMBERPFNGLCOLORPOINTEREXTPROC)&ProfilingTableDecorator::m_glColorPointerEXT_profiling;
+if(this->m_ptr_glEnableClientStateiEXT)this->m_ptr_glEnableClientStateiEXT = (FunctionTable::MEMBERPFNGLENABLECLIENTSTATEIEXTPROC)&ProfilingTableDecorator::m_glEnableClientStateiEXT_profiling;
+if(this->m_ptr_glClearTexSubImage)this->m_ptr_glClearTexSubImage = (FunctionTable::MEMBERPFNGLCLEARTEXSUBIMAGEPROC)&ProfilingTableDecorator::m_glClearTexSubImage_profiling;
+if(this->m_ptr_glEvalCoord1xvOES)this->m_ptr_glEvalCoord1xvOES = (FunctionTable::MEMBERPFNGLEVALCOORD1XVOESPROC)&ProfilingTableDecorator::m_glEvalCoord1xvOES_profiling;
+if(this->m_ptr_glDetachObjectARB)this->m_ptr_glDetachObjectARB = (FunctionTable::MEMBERPFNGLDETACHOBJECTARBPROC)&ProfilingTableDecorator::m_glDetachObjectARB_profiling;
+if(this->m_ptr_glGetTextureParameterIiv)this->m_ptr_glGetTextureParameterIiv = (FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERIIVPROC)&ProfilingTableDecorator::m_glGetTextureParameterIiv_profiling;
+if(this->m_ptr_glVariantusvEXT)this->m_ptr_glVariantusvEXT = (FunctionTable::MEMBERPFNGLVARIANTUSVEXTPROC)&ProfilingTableDecorator::m_glVariantusvEXT_profiling;
+if(this->m_ptr_glCompressedTextureImage3DEXT)this->m_ptr_glCompressedTextureImage3DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTUREIMAGE3DEXTPROC)&ProfilingTableDecorator::m_glCompressedTextureImage3DEXT_profiling;
+if(this->m_ptr_glMultiTexCoord1dARB)this->m_ptr_glMultiTexCoord1dARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1DARBPROC)&ProfilingTableDecorator::m_glMultiTexCoord1dARB_profiling;
+if(this->m_ptr_glGetVertexArrayIntegeri_vEXT)this->m_ptr_glGetVertexArrayIntegeri_vEXT = (FunctionTable::MEMBERPFNGLGETVERTEXARRAYINTEGERI_VEXTPROC)&ProfilingTableDecorator::m_glGetVertexArrayIntegeri_vEXT_profiling;
+if(this->m_ptr_glVertexAttribI4ubv)this->m_ptr_glVertexAttribI4ubv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4UBVPROC)&ProfilingTableDecorator::m_glVertexAttribI4ubv_profiling;
+if(this->m_ptr_glPixelTexGenParameterfSGIS)this->m_ptr_glPixelTexGenParameterfSGIS = (FunctionTable::MEMBERPFNGLPIXELTEXGENPARAMETERFSGISPROC)&ProfilingTableDecorator::m_glPixelTexGenParameterfSGIS_profiling;
+if(this->m_ptr_glProgramUniformMatrix4x2dv)this->m_ptr_glProgramUniformMatrix4x2dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X2DVPROC)&ProfilingTableDecorator::m_glProgramUniformMatrix4x2dv_profiling;
+if(this->m_ptr_glUniform3fARB)this->m_ptr_glUniform3fARB = (FunctionTable::MEMBERPFNGLUNIFORM3FARBPROC)&ProfilingTableDecorator::m_glUniform3fARB_profiling;
+if(this->m_ptr_glIsShader)this->m_ptr_glIsShader = (FunctionTable::MEMBERPFNGLISSHADERPROC)&ProfilingTableDecorator::m_glIsShader_profiling;
+if(this->m_ptr_glConvolutionParameteriv)this->m_ptr_glConvolutionParameteriv = (FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERIVPROC)&ProfilingTableDecorator::m_glConvolutionParameteriv_profiling;
+if(this->m_ptr_glCopyMultiTexSubImage2DEXT)this->m_ptr_glCopyMultiTexSubImage2DEXT = (FunctionTable::MEMBERPFNGLCOPYMULTITEXSUBIMAGE2DEXTPROC)&ProfilingTableDecorator::m_glCopyMultiTexSubImage2DEXT_profiling;
+if(this->m_ptr_glEnableVertexAttribArrayARB)this->m_ptr_glEnableVertexAttribArrayARB = (FunctionTable::MEMBERPFNGLENABLEVERTEXATTRIBARRAYARBPROC)&ProfilingTableDecorator::m_glEnableVertexAttribArrayARB_profiling;
+if(this->m_ptr_glEnable)this->m_ptr_glEnable = (FunctionTable::MEMBERPFNGLENABLEPROC)&ProfilingTableDecorator::m_glEnable_profiling;
+if(this->m_ptr_glGetActiveUniformsiv)this->m_ptr_glGetActiveUniformsiv = (FunctionTable::MEMBERPFNGLGETACTIVEUNIFORMSIVPROC)&ProfilingTableDecorator::m_glGetActiveUniformsiv_profiling;
+if(this->m_ptr_glGetVertexAttribivARB)this->m_ptr_glGetVertexAttribivARB = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBIVARBPROC)&ProfilingTableDecorator::m_glGetVertexAttribivARB_profiling;
+if(this->m_ptr_glTexCoord4hvNV)this->m_ptr_glTexCoord4hvNV = (FunctionTable::MEMBERPFNGLTEXCOORD4HVNVPROC)&ProfilingTableDecorator::m_glTexCoord4hvNV_profiling;
+if(this->m_ptr_glUseProgramObjectARB)this->m_ptr_glUseProgramObjectARB = (FunctionTable::MEMBERPFNGLUSEPROGRAMOBJECTARBPROC)&ProfilingTableDecorator::m_glUseProgramObjectARB_profiling;
+if(this->m_ptr_glGetAttribLocation)this->m_ptr_glGetAttribLocation = (FunctionTable::MEMBERPFNGLGETATTRIBLOCATIONPROC)&ProfilingTableDecorator::m_glGetAttribLocation_profiling;
+if(this->m_ptr_glVertexAttrib4dv)this->m_ptr_glVertexAttrib4dv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4DVPROC)&ProfilingTableDecorator::m_glVertexAttrib4dv_profiling;
+if(this->m_ptr_glGetTextureParameteriv)this->m_ptr_glGetTextureParameteriv = (FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERIVPROC)&ProfilingTableDecorator::m_glGetTextureParameteriv_profiling;
+if(this->m_ptr_glPathSubCoordsNV)this->m_ptr_glPathSubCoordsNV = (FunctionTable::MEMBERPFNGLPATHSUBCOORDSNVPROC)&ProfilingTableDecorator::m_glPathSubCoordsNV_profiling;
+if(this->m_ptr_glMatrixIndexusvARB)this->m_ptr_glMatrixIndexusvARB = (FunctionTable::MEMBERPFNGLMATRIXINDEXUSVARBPROC)&ProfilingTableDecorator::m_glMatrixIndexusvARB_profiling;
+if(this->m_ptr_glGetVideouivNV)this->m_ptr_glGetVideouivNV = (FunctionTable::MEMBERPFNGLGETVIDEOUIVNVPROC)&ProfilingTableDecorator::m_glGetVideouivNV_profiling;
+if(this->m_ptr_glGetVideoCaptureivNV)this->m_ptr_glGetVideoCaptureivNV = (FunctionTable::MEMBERPFNGLGETVIDEOCAPTUREIVNVPROC)&ProfilingTableDecorator::m_glGetVideoCaptureivNV_profiling;
+if(this->m_ptr_glProgramUniform3ui)this->m_ptr_glProgramUniform3ui = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UIPROC)&ProfilingTableDecorator::m_glProgramUniform3ui_profiling;
+if(this->m_ptr_glVertexAttrib3svARB)this->m_ptr_glVertexAttrib3svARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3SVARBPROC)&ProfilingTableDecorator::m_glVertexAttrib3svARB_profiling;
+if(this->m_ptr_glGetNamedBufferParameterivEXT)this->m_ptr_glGetNamedBufferParameterivEXT = (FunctionTable::MEMBERPFNGLGETNAMEDBUFFERPARAMETERIVEXTPROC)&ProfilingTableDecorator::m_glGetNamedBufferParameterivEXT_profiling;
+if(this->m_ptr_glMatrixScaledEXT)this->m_ptr_glMatrixScaledEXT = (FunctionTable::MEMBERPFNGLMATRIXSCALEDEXTPROC)&ProfilingTableDecorator::m_glMatrixScaledEXT_profiling;
+if(this->m_ptr_glProgramUniformMatrix2x3fv)this->m_ptr_glProgramUniformMatrix2x3fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X3FVPROC)&ProfilingTableDecorator::m_glProgramUniformMatrix2x3fv_profiling;
+if(this->m_ptr_glGetFragmentLightivSGIX)this->m_ptr_glGetFragmentLightivSGIX = (FunctionTable::MEMBERPFNGLGETFRAGMENTLIGHTIVSGIXPROC)&ProfilingTableDecorator::m_glGetFragmentLightivSGIX_profiling;
+if(this->m_ptr_glWindowPos2svARB)this->m_ptr_glWindowPos2svARB = (FunctionTable::MEMBERPFNGLWINDOWPOS2SVARBPROC)&ProfilingTableDecorator::m_glWindowPos2svARB_profiling;
+if(this->m_ptr_glVertexAttrib2svNV)this->m_ptr_glVertexAttrib2svNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2SVNVPROC)&ProfilingTableDecorator::m_glVertexAttrib2svNV_profiling;
+if(this->m_ptr_glWindowPos2ivARB)this->m_ptr_glWindowPos2ivARB = (FunctionTable::MEMBERPFNGLWINDOWPOS2IVARBPROC)&ProfilingTableDecorator::m_glWindowPos2ivARB_profiling;
+if(this->m_ptr_glGetVertexAttribPointervNV)this->m_ptr_glGetVertexAttribPointervNV = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBPOINTERVNVPROC)&ProfilingTableDecorator::m_glGetVertexAttribPointervNV_profiling;
+if(this->m_ptr_glPushMatrix)this->m_ptr_glPushMatrix = (FunctionTable::MEMBERPFNGLPUSHMATRIXPROC)&ProfilingTableDecorator::m_glPushMatrix_profiling;
+if(this->m_ptr_glEdgeFlagPointerListIBM)this->m_ptr_glEdgeFlagPointerListIBM = (FunctionTable::MEMBERPFNGLEDGEFLAGPOINTERLISTIBMPROC)&ProfilingTableDecorator::m_glEdgeFlagPointerListIBM_profiling;
+if(this->m_ptr_glGenerateMipmapEXT)this->m_ptr_glGenerateMipmapEXT = (FunctionTable::MEMBERPFNGLGENERATEMIPMAPEXTPROC)&ProfilingTableDecorator::m_glGenerateMipmapEXT_profiling;
+if(this->m_ptr_glWindowPos3sv)this->m_ptr_glWindowPos3sv = (FunctionTable::MEMBERPFNGLWINDOWPOS3SVPROC)&ProfilingTableDecorator::m_glWindowPos3sv_profiling;
+if(this->m_ptr_glPathCoordsNV)this->m_ptr_glPathCoordsNV = (FunctionTable::MEMBERPFNGLPATHCOORDSNVPROC)&ProfilingTableDecorator::m_glPathCoordsNV_profiling;
+if(this->m_ptr_glProgramUniform1i)this->m_ptr_glProgramUniform1i = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1IPROC)&ProfilingTableDecorator::m_glProgramUniform1i_profiling;
+if(this->m_ptr_glProgramUniform1d)this->m_ptr_glProgramUniform1d = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1DPROC)&ProfilingTableDecorator::m_glProgramUniform1d_profiling;
+if(this->m_ptr_glProgramUniform1f)this->m_ptr_glProgramUniform1f = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1FPROC)&ProfilingTableDecorator::m_glProgramUniform1f_profiling;
+if(this->m_ptr_glProgramParameteriEXT)this->m_ptr_glProgramParameteriEXT = (FunctionTable::MEMBERPFNGLPROGRAMPARAMETERIEXTPROC)&ProfilingTableDecorator::m_glProgramParameteriEXT_profiling;
+if(this->m_ptr_glCompressedMultiTexImage2DEXT)this->m_ptr_glCompressedMultiTexImage2DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDMULTITEXIMAGE2DEXTPROC)&ProfilingTableDecorator::m_glCompressedMultiTexImage2DEXT_profiling;
+if(this->m_ptr_glProgramUniform3iv)this->m_ptr_glProgramUniform3iv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3IVPROC)&ProfilingTableDecorator::m_glProgramUniform3iv_profiling;
+if(this->m_ptr_glIndexiv)this->m_ptr_glIndexiv = (FunctionTable::MEMBERPFNGLINDEXIVPROC)&ProfilingTableDecorator::m_glIndexiv_profiling;
+if(this->m_ptr_glMultiTexCoord4xvOES)this->m_ptr_glMultiTexCoord4xvOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4XVOESPROC)&ProfilingTableDecorator::m_glMultiTexCoord4xvOES_profiling;
+if(this->m_ptr_glEGLImageTargetTexture2DOES)this->m_ptr_glEGLImageTargetTexture2DOES = (FunctionTable::MEMBERPFNGLEGLIMAGETARGETTEXTURE2DOESPROC)&ProfilingTableDecorator::m_glEGLImageTargetTexture2DOES_profiling;
+if(this->m_ptr_glPixelZoom)this->m_ptr_glPixelZoom = (FunctionTable::MEMBERPFNGLPIXELZOOMPROC)&ProfilingTableDecorator::m_glPixelZoom_profiling;
+if(this->m_ptr_glVertex3bvOES)this->m_ptr_glVertex3bvOES = (FunctionTable::MEMBERPFNGLVERTEX3BVOESPROC)&ProfilingTableDecorator::m_glVertex3bvOES_profiling;
+if(this->m_ptr_glFramebufferReadBufferEXT)this->m_ptr_glFramebufferReadBufferEXT = (FunctionTable::MEMBERPFNGLFRAMEBUFFERREADBUFFEREXTPROC)&ProfilingTableDecorator::m_glFramebufferReadBufferEXT_profiling;
+if(this->m_ptr_glExtractComponentEXT)this->m_ptr_glExtractComponentEXT = (FunctionTable::MEMBERPFNGLEXTRACTCOMPONENTEXTPROC)&ProfilingTableDecorator::m_glExtractComponentEXT_profiling;
+if(this->m_ptr_glCombinerParameterivNV)this->m_ptr_glCombinerParameterivNV = (FunctionTable::MEMBERPFNGLCOMBINERPARAMETERIVNVPROC)&ProfilingTableDecorator::m_glCombinerParameterivNV_profiling;
+if(this->m_ptr_glMinmax)this->m_ptr_glMinmax = (FunctionTable::MEMBERPFNGLMINMAXPROC)&ProfilingTableDecorator::m_glMinmax_profiling;
+if(this->m_ptr_glGenBuffersARB)this->m_ptr_glGenBuffersARB = (FunctionTable::MEMBERPFNGLGENBUFFERSARBPROC)&ProfilingTableDecorator::m_glGenBuffersARB_profiling;
+if(this->m_ptr_glColor3usv)this->m_ptr_glColor3usv = (FunctionTable::MEMBERPFNGLCOLOR3USVPROC)&ProfilingTableDecorator::m_glColor3usv_profiling;
+if(this->m_ptr_glBlendEquationi)this->m_ptr_glBlendEquationi = (FunctionTable::MEMBERPFNGLBLENDEQUATIONIPROC)&ProfilingTableDecorator::m_glBlendEquationi_profiling;
+if(this->m_ptr_glGetFogFuncSGIS)this->m_ptr_glGetFogFuncSGIS = (FunctionTable::MEMBERPFNGLGETFOGFUNCSGISPROC)&ProfilingTableDecorator::m_glGetFogFuncSGIS_profiling;
+if(this->m_ptr_glVertexAttrib4fvNV)this->m_ptr_glVertexAttrib4fvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4FVNVPROC)&ProfilingTableDecorator::m_glVertexAttrib4fvNV_profiling;
+if(this->m_ptr_glGetnMinmax)this->m_ptr_glGetnMinmax = (FunctionTable::MEMBERPFNGLGETNMINMAXPROC)&ProfilingTableDecorator::m_glGetnMinmax_profiling;
+if(this->m_ptr_glFragmentLightiSGIX)this->m_ptr_glFragmentLightiSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTLIGHTISGIXPROC)&ProfilingTableDecorator::m_glFragmentLightiSGIX_profiling;
+if(this->m_ptr_glMultiTexCoord1bvOES)this->m_ptr_glMultiTexCoord1bvOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1BVOESPROC)&ProfilingTableDecorator::m_glMultiTexCoord1bvOES_profiling;
+if(this->m_ptr_glSecondaryColorPointerEXT)this->m_ptr_glSecondaryColorPointerEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLORPOINTEREXTPROC)&ProfilingTableDecorator::m_glSecondaryColorPointerEXT_profiling;
+if(this->m_ptr_glMultiTexCoordP4uiv)this->m_ptr_glMultiTexCoordP4uiv = (FunctionTable::MEMBERPFNGLMULTITEXCOORDP4UIVPROC)&ProfilingTableDecorator::m_glMultiTexCoordP4uiv_profiling;
+if(this->m_ptr_glGetBufferSubDataARB)this->m_ptr_glGetBufferSubDataARB = (FunctionTable::MEMBERPFNGLGETBUFFERSUBDATAARBPROC)&ProfilingTableDecorator::m_glGetBufferSubDataARB_profiling;
+if(this->m_ptr_glGetPathParameterivNV)this->m_ptr_glGetPathParameterivNV = (FunctionTable::MEMBERPFNGLGETPATHPARAMETERIVNVPROC)&ProfilingTableDecorator::m_glGetPathParameterivNV_profiling;
+if(this->m_ptr_glFlushRasterSGIX)this->m_ptr_glFlushRasterSGIX = (FunctionTable::MEMBERPFNGLFLUSHRASTERSGIXPROC)&ProfilingTableDecorator::m_glFlushRasterSGIX_profiling;
+if(this->m_ptr_glElementPointerATI)this->m_ptr_glElementPointerATI = (FunctionTable::MEMBERPFNGLELEMENTPOINTERATIPROC)&ProfilingTableDecorator::m_glElementPointerATI_profiling;
+if(this->m_ptr_glGetAttachedObjectsARB)this->m_ptr_glGetAttachedObjectsARB = (FunctionTable::MEMBERPFNGLGETATTACHEDOBJECTSARBPROC)&ProfilingTableDecorator::m_glGetAttachedObjectsARB_profiling;
+if(this->m_ptr_glUniform4iv)this->m_ptr_glUniform4iv = (FunctionTable::MEMBERPFNGLUNIFORM4IVPROC)&ProfilingTableDecorator::m_glUniform4iv_profiling;
+if(this->m_ptr_glFogxOES)this->m_ptr_glFogxOES = (FunctionTable::MEMBERPFNGLFOGXOESPROC)&ProfilingTableDecorator::m_glFogxOES_profiling;
+if(this->m_ptr_glSharpenTexFuncSGIS)this->m_ptr_glSharpenTexFuncSGIS = (FunctionTable::MEMBERPFNGLSHARPENTEXFUNCSGISPROC)&ProfilingTableDecorator::m_glSharpenTexFuncSGIS_profiling;
+if(this->m_ptr_glClearDepthfOES)this->m_ptr_glClearDepthfOES = (FunctionTable::MEMBERPFNGLCLEARDEPTHFOESPROC)&ProfilingTableDecorator::m_glClearDepthfOES_profiling;
+if(this->m_ptr_glDeleteCommandListsNV)this->m_ptr_glDeleteCommandListsNV = (FunctionTable::MEMBERPFNGLDELETECOMMANDLISTSNVPROC)&ProfilingTableDecorator::m_glDeleteCommandListsNV_profiling;
+if(this->m_ptr_glVertex4hNV)this->m_ptr_glVertex4hNV = (FunctionTable::MEMBERPFNGLVERTEX4HNVPROC)&ProfilingTableDecorator::m_glVertex4hNV_profiling;
+if(this->m_ptr_glSecondaryColor3dvEXT)this->m_ptr_glSecondaryColor3dvEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3DVEXTPROC)&ProfilingTableDecorator::m_glSecondaryColor3dvEXT_profiling;
+if(this->m_ptr_glGenTextures)this->m_ptr_glGenTextures = (FunctionTable::MEMBERPFNGLGENTEXTURESPROC)&ProfilingTableDecorator::m_glGenTextures_profiling;
+if(this->m_ptr_glTextureStorage2DMultisample)this->m_ptr_glTextureStorage2DMultisample = (FunctionTable::MEMBERPFNGLTEXTURESTORAGE2DMULTISAMPLEPROC)&ProfilingTableDecorator::m_glTextureStorage2DMultisample_profiling;
+if(this->m_ptr_glUniform3ui64vNV)this->m_ptr_glUniform3ui64vNV = (FunctionTable::MEMBERPFNGLUNIFORM3UI64VNVPROC)&ProfilingTableDecorator::m_glUniform3ui64vNV_profiling;
+if(this->m_ptr_glBlendFuncSeparateIndexedAMD)this->m_ptr_glBlendFuncSeparateIndexedAMD = (FunctionTable::MEMBERPFNGLBLENDFUNCSEPARATEINDEXEDAMDPROC)&ProfilingTableDecorator::m_glBlendFuncSeparateIndexedAMD_profiling;
+if(this->m_ptr_glMakeBufferResidentNV)this->m_ptr_glMakeBufferResidentNV = (FunctionTable::MEMBERPFNGLMAKEBUFFERRESIDENTNVPROC)&ProfilingTableDecorator::m_glMakeBufferResidentNV_profiling;
+if(this->m_ptr_glShaderOp2EXT)this->m_ptr_glShaderOp2EXT = (FunctionTable::MEMBERPFNGLSHADEROP2EXTPROC)&ProfilingTableDecorator::m_glShaderOp2EXT_profiling;
+if(this->m_ptr_glGetVertexAttribivNV)this->m_ptr_glGetVertexAttribivNV = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBIVNVPROC)&ProfilingTableDecorator::m_glGetVertexAttribivNV_profiling;
+if(this->m_ptr_glTexParameterIivEXT)this->m_ptr_glTexParameterIivEXT = (FunctionTable::MEMBERPFNGLTEXPARAMETERIIVEXTPROC)&ProfilingTableDecorator::m_glTexParameterIivEXT_profiling;
+if(this->m_ptr_glGetPerfQueryDataINTEL)this->m_ptr_glGetPerfQueryDataINTEL = (FunctionTable::MEMBERPFNGLGETPERFQUERYDATAINTELPROC)&ProfilingTableDecorator::m_glGetPerfQueryDataINTEL_profiling;
+if(this->m_ptr_glVertexAttrib4dvARB)this->m_ptr_glVertexAttrib4dvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4DVARBPROC)&ProfilingTableDecorator::m_glVertexAttrib4dvARB_profiling;
+if(this->m_ptr_glTextureSubImage1DEXT)this->m_ptr_glTextureSubImage1DEXT = (FunctionTable::MEMBERPFNGLTEXTURESUBIMAGE1DEXTPROC)&ProfilingTableDecorator::m_glTextureSubImage1DEXT_profiling;
+if(this->m_ptr_glGetActiveUniformBlockName)this->m_ptr_glGetActiveUniformBlockName = (FunctionTable::MEMBERPFNGLGETACTIVEUNIFORMBLOCKNAMEPROC)&ProfilingTableDecorator::m_glGetActiveUniformBlockName_profiling;
+if(this->m_ptr_glVertexAttrib2dvARB)this->m_ptr_glVertexAttrib2dvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2DVARBPROC)&ProfilingTableDecorator::m_glVertexAttrib2dvARB_profiling;
+if(this->m_ptr_glVertexAttribPointer)this->m_ptr_glVertexAttribPointer = (FunctionTable::MEMBERPFNGLVERTEXATTRIBPOINTERPROC)&ProfilingTableDecorator::m_glVertexAttribPointer_profiling;
+if(this->m_ptr_glDepthBoundsdNV)this->m_ptr_glDepthBoundsdNV = (FunctionTable::MEMBERPFNGLDEPTHBOUNDSDNVPROC)&ProfilingTableDecorator::m_glDepthBoundsdNV_profiling;
+if(this->m_ptr_glDeleteTexturesEXT)this->m_ptr_glDeleteTexturesEXT = (FunctionTable::MEMBERPFNGLDELETETEXTURESEXTPROC)&ProfilingTableDecorator::m_glDeleteTexturesEXT_profiling;
+if(this->m_ptr_glDrawBuffersATI)this->m_ptr_glDrawBuffersATI = (FunctionTable::MEMBERPFNGLDRAWBUFFERSATIPROC)&ProfilingTableDecorator::m_glDrawBuffersATI_profiling;
+if(this->m_ptr_glLightModelxvOES)this->m_ptr_glLightModelxvOES = (FunctionTable::MEMBERPFNGLLIGHTMODELXVOESPROC)&ProfilingTableDecorator::m_glLightModelxvOES_profiling;
+if(this->m_ptr_glApplyTextureEXT)this->m_ptr_glApplyTextureEXT = (FunctionTable::MEMBERPFNGLAPPLYTEXTUREEXTPROC)&ProfilingTableDecorator::m_glApplyTextureEXT_profiling;
+if(this->m_ptr_glGetImageHandleNV)this->m_ptr_glGetImageHandleNV = (FunctionTable::MEMBERPFNGLGETIMAGEHANDLENVPROC)&ProfilingTableDecorator::m_glGetImageHandleNV_profiling;
+if(this->m_ptr_glGetMinmax)this->m_ptr_glGetMinmax = (FunctionTable::MEMBERPFNGLGETMINMAXPROC)&ProfilingTableDecorator::m_glGetMinmax_profiling;
+if(this->m_ptr_glGetFixedvOES)this->m_ptr_glGetFixedvOES = (FunctionTable::MEMBERPFNGLGETFIXEDVOESPROC)&ProfilingTableDecorator::m_glGetFixedvOES_profiling;
+if(this->m_ptr_glSamplePatternEXT)this->m_ptr_glSamplePatternEXT = (FunctionTable::MEMBERPFNGLSAMPLEPATTERNEXTPROC)&ProfilingTableDecorator::m_glSamplePatternEXT_profiling;
+if(this->m_ptr_glUniform1f)this->m_ptr_glUniform1f = (FunctionTable::MEMBERPFNGLUNIFORM1FPROC)&ProfilingTableDecorator::m_glUniform1f_profiling;
+if(this->m_ptr_glColor4fNormal3fVertex3fSUN)this->m_ptr_glColor4fNormal3fVertex3fSUN = (FunctionTable::MEMBERPFNGLCOLOR4FNORMAL3FVERTEX3FSUNPROC)&ProfilingTableDecorator::m_glColor4fNormal3fVertex3fSUN_profiling;
+if(this->m_ptr_glFogCoorddvEXT)this->m_ptr_glFogCoorddvEXT = (FunctionTable::MEMBERPFNGLFOGCOORDDVEXTPROC)&ProfilingTableDecorator::m_glFogCoorddvEXT_profiling;
+if(this->m_ptr_glCopyTextureImage1DEXT)this->m_ptr_glCopyTextureImage1DEXT = (FunctionTable::MEMBERPFNGLCOPYTEXTUREIMAGE1DEXTPROC)&ProfilingTableDecorator::m_glCopyTextureImage1DEXT_profiling;
+if(this->m_ptr_glFlushMappedBufferRangeAPPLE)this->m_ptr_glFlushMappedBufferRangeAPPLE = (FunctionTable::MEMBERPFNGLFLUSHMAPPEDBUFFERRANGEAPPLEPROC)&ProfilingTableDecorator::m_glFlushMappedBufferRangeAPPLE_profiling;
+if(this->m_ptr_glVertex3sv)this->m_ptr_glVertex3sv = (FunctionTable::MEMBERPFNGLVERTEX3SVPROC)&ProfilingTableDecorator::m_glVertex3sv_profiling;
+if(this->m_ptr_glFlushStaticDataIBM)this->m_ptr_glFlushStaticDataIBM = (FunctionTable::MEMBERPFNGLFLUSHSTATICDATAIBMPROC)&ProfilingTableDecorator::m_glFlushStaticDataIBM_profiling;
+if(this->m_ptr_glProgramUniform4ui64NV)this->m_ptr_glProgramUniform4ui64NV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UI64NVPROC)&ProfilingTableDecorator::m_glProgramUniform4ui64NV_profiling;
+if(this->m_ptr_glRasterPos4xOES)this->m_ptr_glRasterPos4xOES = (FunctionTable::MEMBERPFNGLRASTERPOS4XOESPROC)&ProfilingTableDecorator::m_glRasterPos4xOES_profiling;
+if(this->m_ptr_glVertexAttribP1ui)this->m_ptr_glVertexAttribP1ui = (FunctionTable::MEMBERPFNGLVERTEXATTRIBP1UIPROC)&ProfilingTableDecorator::m_glVertexAttribP1ui_profiling;
+if(this->m_ptr_glProgramUniform4dvEXT)this->m_ptr_glProgramUniform4dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4DVEXTPROC)&ProfilingTableDecorator::m_glProgramUniform4dvEXT_profiling;
+if(this->m_ptr_glEndTransformFeedbackEXT)this->m_ptr_glEndTransformFeedbackEXT = (FunctionTable::MEMBERPFNGLENDTRANSFORMFEEDBACKEXTPROC)&ProfilingTableDecorator::m_glEndTransformFeedbackEXT_profiling;
+if(this->m_ptr_glBinormal3dEXT)this->m_ptr_glBinormal3dEXT = (FunctionTable::MEMBERPFNGLBINORMAL3DEXTPROC)&ProfilingTableDecorator::m_glBinormal3dEXT_profiling;
+if(this->m_ptr_glGetTextureSubImage)this->m_ptr_glGetTextureSubImage = (FunctionTable::MEMBERPFNGLGETTEXTURESUBIMAGEPROC)&ProfilingTableDecorator::m_glGetTextureSubImage_profiling;
+if(this->m_ptr_glGetNamedRenderbufferParameteriv)this->m_ptr_glGetNamedRenderbufferParameteriv = (FunctionTable::MEMBERPFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC)&ProfilingTableDecorator::m_glGetNamedRenderbufferParameteriv_profiling;
+if(this->m_ptr_glBindBuffersRange)this->m_ptr_glBindBuffersRange = (FunctionTable::MEMBERPFNGLBINDBUFFERSRANGEPROC)&ProfilingTableDecorator::m_glBindBuffersRange_profiling;
+if(this->m_ptr_glFinishAsyncSGIX)this->m_ptr_glFinishAsyncSGIX = (FunctionTable::MEMBERPFNGLFINISHASYNCSGIXPROC)&ProfilingTableDecorator::m_glFinishAsyncSGIX_profiling;
+if(this->m_ptr_glBindFragDataLocationIndexed)this->m_ptr_glBindFragDataLocationIndexed = (FunctionTable::MEMBERPFNGLBINDFRAGDATALOCATIONINDEXEDPROC)&ProfilingTableDecorator::m_glBindFragDataLocationIndexed_profiling;
+if(this->m_ptr_glMultiTexCoord2dv)this->m_ptr_glMultiTexCoord2dv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2DVPROC)&ProfilingTableDecorator::m_glMultiTexCoord2dv_profiling;
+if(this->m_ptr_glUniform2iv)this->m_ptr_glUniform2iv = (FunctionTable::MEMBERPFNGLUNIFORM2IVPROC)&ProfilingTableDecorator::m_glUniform2iv_profiling;
+if(this->m_ptr_glProgramUniform2i64vNV)this->m_ptr_glProgramUniform2i64vNV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2I64VNVPROC)&ProfilingTableDecorator::m_glProgramUniform2i64vNV_profiling;
+if(this->m_ptr_glFlushVertexArrayRangeAPPLE)this->m_ptr_glFlushVertexArrayRangeAPPLE = (FunctionTable::MEMBERPFNGLFLUSHVERTEXARRAYRANGEAPPLEPROC)&ProfilingTableDecorator::m_glFlushVertexArrayRangeAPPLE_profiling;
+if(this->m_ptr_glTextureParameterf)this->m_ptr_glTextureParameterf = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERFPROC)&ProfilingTableDecorator::m_glTextureParameterf_profiling;
+if(this->m_ptr_glMultiTexCoord3dvARB)this->m_ptr_glMultiTexCoord3dvARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3DVARBPROC)&ProfilingTableDecorator::m_glMultiTexCoord3dvARB_profiling;
+if(this->m_ptr_glFeedbackBuffer)this->m_ptr_glFeedbackBuffer = (FunctionTable::MEMBERPFNGLFEEDBACKBUFFERPROC)&ProfilingTableDecorator::m_glFeedbackBuffer_profiling;
+if(this->m_ptr_glDebugMessageInsertARB)this->m_ptr_glDebugMessageInsertARB = (FunctionTable::MEMBERPFNGLDEBUGMESSAGEINSERTARBPROC)&ProfilingTableDecorator::m_glDebugMessageInsertARB_profiling;
+if(this->m_ptr_glMultiTexCoord2i)this->m_ptr_glMultiTexCoord2i = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2IPROC)&ProfilingTableDecorator::m_glMultiTexCoord2i_profiling;
+if(this->m_ptr_glTextureSubImage3D)this->m_ptr_glTextureSubImage3D = (FunctionTable::MEMBERPFNGLTEXTURESUBIMAGE3DPROC)&ProfilingTableDecorator::m_glTextureSubImage3D_profiling;
+if(this->m_ptr_glFramebufferTexture1D)this->m_ptr_glFramebufferTexture1D = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURE1DPROC)&ProfilingTableDecorator::m_glFramebufferTexture1D_profiling;
+if(this->m_ptr_glGetShaderiv)this->m_ptr_glGetShaderiv = (FunctionTable::MEMBERPFNGLGETSHADERIVPROC)&ProfilingTableDecorator::m_glGetShaderiv_profiling;
+if(this->m_ptr_glMultiTexCoord2d)this->m_ptr_glMultiTexCoord2d = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2DPROC)&ProfilingTableDecorator::m_glMultiTexCoord2d_profiling;
+if(this->m_ptr_glArrayObjectATI)this->m_ptr_glArrayObjectATI = (FunctionTable::MEMBERPFNGLARRAYOBJECTATIPROC)&ProfilingTableDecorator::m_glArrayObjectATI_profiling;
+if(this->m_ptr_glGetPointeri_vEXT)this->m_ptr_glGetPointeri_vEXT = (FunctionTable::MEMBERPFNGLGETPOINTERI_VEXTPROC)&ProfilingTableDecorator::m_glGetPointeri_vEXT_profiling;
+if(this->m_ptr_glGetPerfMonitorCountersAMD)this->m_ptr_glGetPerfMonitorCountersAMD = (FunctionTable::MEMBERPFNGLGETPERFMONITORCOUNTERSAMDPROC)&ProfilingTableDecorator::m_glGetPerfMonitorCountersAMD_profiling;
+if(this->m_ptr_glNamedBufferStorage)this->m_ptr_glNamedBufferStorage = (FunctionTable::MEMBERPFNGLNAMEDBUFFERSTORAGEPROC)&ProfilingTableDecorator::m_glNamedBufferStorage_profiling;
+if(this->m_ptr_glTexEnvxvOES)this->m_ptr_glTexEnvxvOES = (FunctionTable::MEMBERPFNGLTEXENVXVOESPROC)&ProfilingTableDecorator::m_glTexEnvxvOES_profiling;
+if(this->m_ptr_glProgramUniform2ui64NV)this->m_ptr_glProgramUniform2ui64NV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UI64NVPROC)&ProfilingTableDecorator::m_glProgramUniform2ui64NV_profiling;
+if(this->m_ptr_glMultiTexCoord3bOES)this->m_ptr_glMultiTexCoord3bOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3BOESPROC)&ProfilingTableDecorator::m_glMultiTexCoord3bOES_profiling;
+if(this->m_ptr_glUniform1dv)this->m_ptr_glUniform1dv = (FunctionTable::MEMBERPFNGLUNIFORM1DVPROC)&ProfilingTableDecorator::m_glUniform1dv_profiling;
+if(this->m_ptr_glPixelTransferi)this->m_ptr_glPixelTransferi = (FunctionTable::MEMBERPFNGLPIXELTRANSFERIPROC)&ProfilingTableDecorator::m_glPixelTransferi_profiling;
+if(this->m_ptr_glSecondaryColor3usvEXT)this->m_ptr_glSecondaryColor3usvEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3USVEXTPROC)&ProfilingTableDecorator::m_glSecondaryColor3usvEXT_profiling;
+if(this->m_ptr_glProgramEnvParameterI4uivNV)this->m_ptr_glProgramEnvParameterI4uivNV = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERI4UIVNVPROC)&ProfilingTableDecorator::m_glProgramEnvParameterI4uivNV_profiling;
+if(this->m_ptr_glVertex2sv)this->m_ptr_glVertex2sv = (FunctionTable::MEMBERPFNGLVERTEX2SVPROC)&ProfilingTableDecorator::m_glVertex2sv_profiling;
+if(this->m_ptr_glWindowPos4dMESA)this->m_ptr_glWindowPos4dMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS4DMESAPROC)&ProfilingTableDecorator::m_glWindowPos4dMESA_profiling;
+if(this->m_ptr_glDebugMessageControlARB)this->m_ptr_glDebugMessageControlARB = (FunctionTable::MEMBERPFNGLDEBUGMESSAGECONTROLARBPROC)&ProfilingTableDecorator::m_glDebugMessageControlARB_profiling;
+if(this->m_ptr_glIsTextureEXT)this->m_ptr_glIsTextureEXT = (FunctionTable::MEMBERPFNGLISTEXTUREEXTPROC)&ProfilingTableDecorator::m_glIsTextureEXT_profiling;
+if(this->m_ptr_glFragmentMaterialivSGIX)this->m_ptr_glFragmentMaterialivSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTMATERIALIVSGIXPROC)&ProfilingTableDecorator::m_glFragmentMaterialivSGIX_profiling;
+if(this->m_ptr_glLinkProgramARB)this->m_ptr_glLinkProgramARB = (FunctionTable::MEMBERPFNGLLINKPROGRAMARBPROC)&ProfilingTableDecorator::m_glLinkProgramARB_profiling;
+if(this->m_ptr_glFinishFenceAPPLE)this->m_ptr_glFinishFenceAPPLE = (FunctionTable::MEMBERPFNGLFINISHFENCEAPPLEPROC)&ProfilingTableDecorator::m_glFinishFenceAPPLE_profiling;
+if(this->m_ptr_glVertexArrayVertexAttribBindingEXT)this->m_ptr_glVertexArrayVertexAttribBindingEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBBINDINGEXTPROC)&ProfilingTableDecorator::m_glVertexArrayVertexAttribBindingEXT_profiling;
+if(this->m_ptr_glMultiTexCoord4fv)this->m_ptr_glMultiTexCoord4fv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4FVPROC)&ProfilingTableDecorator::m_glMultiTexCoord4fv_profiling;
+if(this->m_ptr_glRasterPos3i)this->m_ptr_glRasterPos3i = (FunctionTable::MEMBERPFNGLRASTERPOS3IPROC)&ProfilingTableDecorator::m_glRasterPos3i_profiling;
+if(this->m_ptr_glRasterPos3d)this->m_ptr_glRasterPos3d = (FunctionTable::MEMBERPFNGLRASTERPOS3DPROC)&ProfilingTableDecorator::m_glRasterPos3d_profiling;
+if(this->m_ptr_glPollAsyncSGIX)this->m_ptr_glPollAsyncSGIX = (FunctionTable::MEMBERPFNGLPOLLASYNCSGIXPROC)&ProfilingTableDecorator::m_glPollAsyncSGIX_profiling;
+if(this->m_ptr_glRasterPos3f)this->m_ptr_glRasterPos3f = (FunctionTable::MEMBERPFNGLRASTERPOS3FPROC)&ProfilingTableDecorator::m_glRasterPos3f_profiling;
+if(this->m_ptr_glCompressedTexImage3D)this->m_ptr_glCompressedTexImage3D = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXIMAGE3DPROC)&ProfilingTableDecorator::m_glCompressedTexImage3D_profiling;
+if(this->m_ptr_glVariantivEXT)this->m_ptr_glVariantivEXT = (FunctionTable::MEMBERPFNGLVARIANTIVEXTPROC)&ProfilingTableDecorator::m_glVariantivEXT_profiling;
+if(this->m_ptr_glUnmapTexture2DINTEL)this->m_ptr_glUnmapTexture2DINTEL = (FunctionTable::MEMBERPFNGLUNMAPTEXTURE2DINTELPROC)&ProfilingTableDecorator::m_glUnmapTexture2DINTEL_profiling;
+if(this->m_ptr_glGetVertexAttribiv)this->m_ptr_glGetVertexAttribiv = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBIVPROC)&ProfilingTableDecorator::m_glGetVertexAttribiv_profiling;
+if(this->m_ptr_glGetPathCoordsNV)this->m_ptr_glGetPathCoordsNV = (FunctionTable::MEMBERPFNGLGETPATHCOORDSNVPROC)&ProfilingTableDecorator::m_glGetPathCoordsNV_profiling;
+if(this->m_ptr_glColor4xvOES)this->m_ptr_glColor4xvOES = (FunctionTable::MEMBERPFNGLCOLOR4XVOESPROC)&ProfilingTableDecorator::m_glColor4xvOES_profiling;
+if(this->m_ptr_glVertexAttrib3fv)this->m_ptr_glVertexAttrib3fv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3FVPROC)&ProfilingTableDecorator::m_glVertexAttrib3fv_profiling;
+if(this->m_ptr_glRasterPos3s)this->m_ptr_glRasterPos3s = (FunctionTable::MEMBERPFNGLRASTERPOS3SPROC)&ProfilingTableDecorator::m_glRasterPos3s_profiling;
+if(this->m_ptr_glVertex4bOES)this->m_ptr_glVertex4bOES = (FunctionTable::MEMBERPFNGLVERTEX4BOESPROC)&ProfilingTableDecorator::m_glVertex4bOES_profiling;
+if(this->m_ptr_glTransformFeedbackVaryingsEXT)this->m_ptr_glTransformFeedbackVaryingsEXT = (FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKVARYINGSEXTPROC)&ProfilingTableDecorator::m_glTransformFeedbackVaryingsEXT_profiling;
+if(this->m_ptr_glCombinerOutputNV)this->m_ptr_glCombinerOutputNV = (FunctionTable::MEMBERPFNGLCOMBINEROUTPUTNVPROC)&ProfilingTableDecorator::m_glCombinerOutputNV_profiling;
+if(this->m_ptr_glWindowPos4sMESA)this->m_ptr_glWindowPos4sMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS4SMESAPROC)&ProfilingTableDecorator::m_glWindowPos4sMESA_profiling;
+if(this->m_ptr_glVertexAttrib4svARB)this->m_ptr_glVertexAttrib4svARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4SVARBPROC)&ProfilingTableDecorator::m_glVertexAttrib4svARB_profiling;
+if(this->m_ptr_glIsList)this->m_ptr_glIsList = (FunctionTable::MEMBERPFNGLISLISTPROC)&ProfilingTableDecorator::m_glIsList_profiling;
+if(this->m_ptr_glGetInfoLogARB)this->m_ptr_glGetInfoLogARB = (FunctionTable::MEMBERPFNGLGETINFOLOGARBPROC)&ProfilingTableDecorator::m_glGetInfoLogARB_profiling;
+if(this->m_ptr_glUniformMatrix2fv)this->m_ptr_glUniformMatrix2fv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX2FVPROC)&ProfilingTableDecorator::m_glUniformMatrix2fv_profiling;
+if(this->m_ptr_glVertexAttribs3dvNV)this->m_ptr_glVertexAttribs3dvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS3DVNVPROC)&ProfilingTableDecorator::m_glVertexAttribs3dvNV_profiling;
+if(this->m_ptr_glGlobalAlphaFactorsSUN)this->m_ptr_glGlobalAlphaFactorsSUN = (FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORSSUNPROC)&ProfilingTableDecorator::m_glGlobalAlphaFactorsSUN_profiling;
+if(this->m_ptr_glGetTrackMatrixivNV)this->m_ptr_glGetTrackMatrixivNV = (FunctionTable::MEMBERPFNGLGETTRACKMATRIXIVNVPROC)&ProfilingTableDecorator::m_glGetTrackMatrixivNV_profiling;
+if(this->m_ptr_glTextureParameterfvEXT)this->m_ptr_glTextureParameterfvEXT = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERFVEXTPROC)&ProfilingTableDecorator::m_glTextureParameterfvEXT_profiling;
+if(this->m_ptr_glIsNamedBufferResidentNV)this->m_ptr_glIsNamedBufferResidentNV = (FunctionTable::MEMBERPFNGLISNAMEDBUFFERRESIDENTNVPROC)&ProfilingTableDecorator::m_glIsNamedBufferResidentNV_profiling;
+if(this->m_ptr_glProgramUniform4ui64vARB)this->m_ptr_glProgramUniform4ui64vARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UI64VARBPROC)&ProfilingTableDecorator::m_glProgramUniform4ui64vARB_profiling;
+if(this->m_ptr_glTbufferMask3DFX)this->m_ptr_glTbufferMask3DFX = (FunctionTable::MEMBERPFNGLTBUFFERMASK3DFXPROC)&ProfilingTableDecorator::m_glTbufferMask3DFX_profiling;
+if(this->m_ptr_glCoverFillPathNV)this->m_ptr_glCoverFillPathNV = (FunctionTable::MEMBERPFNGLCOVERFILLPATHNVPROC)&ProfilingTableDecorator::m_glCoverFillPathNV_profiling;
+if(this->m_ptr_glVertexAttrib1fvARB)this->m_ptr_glVertexAttrib1fvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1FVARBPROC)&ProfilingTableDecorator::m_glVertexAttrib1fvARB_profiling;
+if(this->m_ptr_glGenerateTextureMipmap)this->m_ptr_glGenerateTextureMipmap = (FunctionTable::MEMBERPFNGLGENERATETEXTUREMIPMAPPROC)&ProfilingTableDecorator::m_glGenerateTextureMipmap_profiling;
+if(this->m_ptr_glNamedProgramLocalParameterI4uivEXT)this->m_ptr_glNamedProgramLocalParameterI4uivEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERI4UIVEXTPROC)&ProfilingTableDecorator::m_glNamedProgramLocalParameterI4uivEXT_profiling;
+if(this->m_ptr_glMultiDrawElementsBaseVertex)this->m_ptr_glMultiDrawElementsBaseVertex = (FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSBASEVERTEXPROC)&ProfilingTableDecorator::m_glMultiDrawElementsBaseVertex_profiling;
+if(this->m_ptr_glProgramSubroutineParametersuivNV)this->m_ptr_glProgramSubroutineParametersuivNV = (FunctionTable::MEMBERPFNGLPROGRAMSUBROUTINEPARAMETERSUIVNVPROC)&ProfilingTableDecorator::m_glProgramSubroutineParametersuivNV_profiling;
+if(this->m_ptr_glProgramUniformMatrix2x4dvEXT)this->m_ptr_glProgramUniformMatrix2x4dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X4DVEXTPROC)&ProfilingTableDecorator::m_glProgramUniformMatrix2x4dvEXT_profiling;
+if(this->m_ptr_glRotatexOES)this->m_ptr_glRotatexOES = (FunctionTable::MEMBERPFNGLROTATEXOESPROC)&ProfilingTableDecorator::m_glRotatexOES_profiling;
+if(this->m_ptr_glMemoryBarrierEXT)this->m_ptr_glMemoryBarrierEXT = (FunctionTable::MEMBERPFNGLMEMORYBARRIEREXTPROC)&ProfilingTableDecorator::m_glMemoryBarrierEXT_profiling;
+if(this->m_ptr_glVertexAttrib3svNV)this->m_ptr_glVertexAttrib3svNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3SVNVPROC)&ProfilingTableDecorator::m_glVertexAttrib3svNV_profiling;
+if(this->m_ptr_glVertexStream3iATI)this->m_ptr_glVertexStream3iATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM3IATIPROC)&ProfilingTableDecorator::m_glVertexStream3iATI_profiling;
+if(this->m_ptr_glCompressedTexSubImage1D)this->m_ptr_glCompressedTexSubImage1D = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXSUBIMAGE1DPROC)&ProfilingTableDecorator::m_glCompressedTexSubImage1D_profiling;
+if(this->m_ptr_glSetFenceNV)this->m_ptr_glSetFenceNV = (FunctionTable::MEMBERPFNGLSETFENCENVPROC)&ProfilingTableDecorator::m_glSetFenceNV_profiling;
+if(this->m_ptr_glAttachObjectARB)this->m_ptr_glAttachObjectARB = (FunctionTable::MEMBERPFNGLATTACHOBJECTARBPROC)&ProfilingTableDecorator::m_glAttachObjectARB_profiling;
+if(this->m_ptr_glCopyConvolutionFilter1D)this->m_ptr_glCopyConvolutionFilter1D = (FunctionTable::MEMBERPFNGLCOPYCONVOLUTIONFILTER1DPROC)&ProfilingTableDecorator::m_glCopyConvolutionFilter1D_profiling;
+if(this->m_ptr_glProgramParameters4fvNV)this->m_ptr_glProgramParameters4fvNV = (FunctionTable::MEMBERPFNGLPROGRAMPARAMETERS4FVNVPROC)&ProfilingTableDecorator::m_glProgramParameters4fvNV_profiling;
+if(this->m_ptr_glNamedFramebufferParameteriEXT)this->m_ptr_glNamedFramebufferParameteriEXT = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERPARAMETERIEXTPROC)&ProfilingTableDecorator::m_glNamedFramebufferParameteriEXT_profiling;
+if(this->m_ptr_glVertexAttrib4Nsv)this->m_ptr_glVertexAttrib4Nsv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NSVPROC)&ProfilingTableDecorator::m_glVertexAttrib4Nsv_profiling;
+if(this->m_ptr_glVertexAttribI4usvEXT)this->m_ptr_glVertexAttribI4usvEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4USVEXTPROC)&ProfilingTableDecorator::m_glVertexAttribI4usvEXT_profiling;
+if(this->m_ptr_glTextureBufferRangeEXT)this->m_ptr_glTextureBufferRangeEXT = (FunctionTable::MEMBERPFNGLTEXTUREBUFFERRANGEEXTPROC)&ProfilingTableDecorator::m_glTextureBufferRangeEXT_profiling;
+if(this->m_ptr_glVertexP3uiv)this->m_ptr_glVertexP3uiv = (FunctionTable::MEMBERPFNGLVERTEXP3UIVPROC)&ProfilingTableDecorator::m_glVertexP3uiv_profiling;
+if(this->m_ptr_glIsPathNV)this->m_ptr_glIsPathNV = (FunctionTable::MEMBERPFNGLISPATHNVPROC)&ProfilingTableDecorator::m_glIsPathNV_profiling;
+if(this->m_ptr_glGetnUniformi64vARB)this->m_ptr_glGetnUniformi64vARB = (FunctionTable::MEMBERPFNGLGETNUNIFORMI64VARBPROC)&ProfilingTableDecorator::m_glGetnUniformi64vARB_profiling;
+if(this->m_ptr_glFramebufferTextureMultiviewOVR)this->m_ptr_glFramebufferTextureMultiviewOVR = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTUREMULTIVIEWOVRPROC)&ProfilingTableDecorator::m_glFramebufferTextureMultiviewOVR_profiling;
+if(this->m_ptr_glCompressedMultiTexSubImage2DEXT)this->m_ptr_glCompressedMultiTexSubImage2DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDMULTITEXSUBIMAGE2DEXTPROC)&ProfilingTableDecorator::m_glCompressedMultiTexSubImage2DEXT_profiling;
+if(this->m_ptr_glGetnMapdv)this->m_ptr_glGetnMapdv = (FunctionTable::MEMBERPFNGLGETNMAPDVPROC)&ProfilingTableDecorator::m_glGetnMapdv_profiling;
+if(this->m_ptr_glDebugMessageCallback)this->m_ptr_glDebugMessageCallback = (FunctionTable::MEMBERPFNGLDEBUGMESSAGECALLBACKPROC)&ProfilingTableDecorator::m_glDebugMessageCallback_profiling;
+if(this->m_ptr_glTangent3svEXT)this->m_ptr_glTangent3svEXT = (FunctionTable::MEMBERPFNGLTANGENT3SVEXTPROC)&ProfilingTableDecorator::m_glTangent3svEXT_profiling;
+if(this->m_ptr_glVertexAttribParameteriAMD)this->m_ptr_glVertexAttribParameteriAMD = (FunctionTable::MEMBERPFNGLVERTEXATTRIBPARAMETERIAMDPROC)&ProfilingTableDecorator::m_glVertexAttribParameteriAMD_profiling;
+if(this->m_ptr_glBufferSubDataARB)this->m_ptr_glBufferSubDataARB = (FunctionTable::MEMBERPFNGLBUFFERSUBDATAARBPROC)&ProfilingTableDecorator::m_glBufferSubDataARB_profiling;
+if(this->m_ptr_glGetVertexAttribLui64vARB)this->m_ptr_glGetVertexAttribLui64vARB = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBLUI64VARBPROC)&ProfilingTableDecorator::m_glGetVertexAttribLui64vARB_profiling;
+if(this->m_ptr_glVertexAttribL4ui64NV)this->m_ptr_glVertexAttribL4ui64NV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL4UI64NVPROC)&ProfilingTableDecorator::m_glVertexAttribL4ui64NV_profiling;
+if(this->m_ptr_glReplacementCodeuiColor4ubVertex3fSUN)this->m_ptr_glReplacementCodeuiColor4ubVertex3fSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUICOLOR4UBVERTEX3FSUNPROC)&ProfilingTableDecorator::m_glReplacementCodeuiColor4ubVertex3fSUN_profiling;
+if(this->m_ptr_glImageTransformParameterfHP)this->m_ptr_glImageTransformParameterfHP = (FunctionTable::MEMBERPFNGLIMAGETRANSFORMPARAMETERFHPPROC)&ProfilingTableDecorator::m_glImageTransformParameterfHP_profiling;
+if(this->m_ptr_glMap1f)this->m_ptr_glMap1f = (FunctionTable::MEMBERPFNGLMAP1FPROC)&ProfilingTableDecorator::m_glMap1f_profiling;
+if(this->m_ptr_glRasterPos4fv)this->m_ptr_glRasterPos4fv = (FunctionTable::MEMBERPFNGLRASTERPOS4FVPROC)&ProfilingTableDecorator::m_glRasterPos4fv_profiling;
+if(this->m_ptr_glVertex2bvOES)this->m_ptr_glVertex2bvOES = (FunctionTable::MEMBERPFNGLVERTEX2BVOESPROC)&ProfilingTableDecorator::m_glVertex2bvOES_profiling;
+if(this->m_ptr_glGetMapControlPointsNV)this->m_ptr_glGetMapControlPointsNV = (FunctionTable::MEMBERPFNGLGETMAPCONTROLPOINTSNVPROC)&ProfilingTableDecorator::m_glGetMapControlPointsNV_profiling;
+if(this->m_ptr_glNamedProgramLocalParametersI4ivEXT)this->m_ptr_glNamedProgramLocalParametersI4ivEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERSI4IVEXTPROC)&ProfilingTableDecorator::m_glNamedProgramLocalParametersI4ivEXT_profiling;
+if(this->m_ptr_glBindBufferRangeNV)this->m_ptr_glBindBufferRangeNV = (FunctionTable::MEMBERPFNGLBINDBUFFERRANGENVPROC)&ProfilingTableDecorator::m_glBindBufferRangeNV_profiling;
+if(this->m_ptr_glVertexStream3dvATI)this->m_ptr_glVertexStream3dvATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM3DVATIPROC)&ProfilingTableDecorator::m_glVertexStream3dvATI_profiling;
+if(this->m_ptr_glNormalPointerListIBM)this->m_ptr_glNormalPointerListIBM = (FunctionTable::MEMBERPFNGLNORMALPOINTERLISTIBMPROC)&ProfilingTableDecorator::m_glNormalPointerListIBM_profiling;
+if(this->m_ptr_glFogFuncSGIS)this->m_ptr_glFogFuncSGIS = (FunctionTable::MEMBERPFNGLFOGFUNCSGISPROC)&ProfilingTableDecorator::m_glFogFuncSGIS_profiling;
+if(this->m_ptr_glMultiModeDrawArraysIBM)this->m_ptr_glMultiModeDrawArraysIBM = (FunctionTable::MEMBERPFNGLMULTIMODEDRAWARRAYSIBMPROC)&ProfilingTableDecorator::m_glMultiModeDrawArraysIBM_profiling;
+if(this->m_ptr_glGetNamedFramebufferAttachmentParameterivEXT)this->m_ptr_glGetNamedFramebufferAttachmentParameterivEXT = (FunctionTable::MEMBERPFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVEXTPROC)&ProfilingTableDecorator::m_glGetNamedFramebufferAttachmentParameterivEXT_profiling;
+if(this->m_ptr_glGetFloatv)this->m_ptr_glGetFloatv = (FunctionTable::MEMBERPFNGLGETFLOATVPROC)&ProfilingTableDecorator::m_glGetFloatv_profiling;
+if(this->m_ptr_glVertexArrayVertexAttribIFormatEXT)this->m_ptr_glVertexArrayVertexAttribIFormatEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBIFORMATEXTPROC)&ProfilingTableDecorator::m_glVertexArrayVertexAttribIFormatEXT_profiling;
+if(this->m_ptr_glHint)this->m_ptr_glHint = (FunctionTable::MEMBERPFNGLHINTPROC)&ProfilingTableDecorator::m_glHint_profiling;
+if(this->m_ptr_glPointAlongPathNV)this->m_ptr_glPointAlongPathNV = (FunctionTable::MEMBERPFNGLPOINTALONGPATHNVPROC)&ProfilingTableDecorator::m_glPointAlongPathNV_profiling;
+if(this->m_ptr_glVertexStream2svATI)this->m_ptr_glVertexStream2svATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM2SVATIPROC)&ProfilingTableDecorator::m_glVertexStream2svATI_profiling;
+if(this->m_ptr_glMultiDrawArraysIndirect)this->m_ptr_glMultiDrawArraysIndirect = (FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSINDIRECTPROC)&ProfilingTableDecorator::m_glMultiDrawArraysIndirect_profiling;
+if(this->m_ptr_glVertexAttribP2uiv)this->m_ptr_glVertexAttribP2uiv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBP2UIVPROC)&ProfilingTableDecorator::m_glVertexAttribP2uiv_profiling;
+if(this->m_ptr_glProgramUniform1i64vARB)this->m_ptr_glProgramUniform1i64vARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1I64VARBPROC)&ProfilingTableDecorator::m_glProgramUniform1i64vARB_profiling;
+if(this->m_ptr_glFramebufferTextureARB)this->m_ptr_glFramebufferTextureARB = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTUREARBPROC)&ProfilingTableDecorator::m_glFramebufferTextureARB_profiling;
+if(this->m_ptr_glPushClientAttribDefaultEXT)this->m_ptr_glPushClientAttribDefaultEXT = (FunctionTable::MEMBERPFNGLPUSHCLIENTATTRIBDEFAULTEXTPROC)&ProfilingTableDecorator::m_glPushClientAttribDefaultEXT_profiling;
+if(this->m_ptr_glScalef)this->m_ptr_glScalef = (FunctionTable::MEMBERPFNGLSCALEFPROC)&ProfilingTableDecorator::m_glScalef_profiling;
+if(this->m_ptr_glScaled)this->m_ptr_glScaled = (FunctionTable::MEMBERPFNGLSCALEDPROC)&ProfilingTableDecorator::m_glScaled_profiling;
+if(this->m_ptr_glGetConvolutionParameterxvOES)this->m_ptr_glGetConvolutionParameterxvOES = (FunctionTable::MEMBERPFNGLGETCONVOLUTIONPARAMETERXVOESPROC)&ProfilingTableDecorator::m_glGetConvolutionParameterxvOES_profiling;
+if(this->m_ptr_glGetProgramResourceName)this->m_ptr_glGetProgramResourceName = (FunctionTable::MEMBERPFNGLGETPROGRAMRESOURCENAMEPROC)&ProfilingTableDecorator::m_glGetProgramResourceName_profiling;
+if(this->m_ptr_glCopyColorTable)this->m_ptr_glCopyColorTable = (FunctionTable::MEMBERPFNGLCOPYCOLORTABLEPROC)&ProfilingTableDecorator::m_glCopyColorTable_profiling;
+if(this->m_ptr_glDepthRangeArrayv)this->m_ptr_glDepthRangeArrayv = (FunctionTable::MEMBERPFNGLDEPTHRANGEARRAYVPROC)&ProfilingTableDecorator::m_glDepthRangeArrayv_profiling;
+if(this->m_ptr_glCoverFillPathInstancedNV)this->m_ptr_glCoverFillPathInstancedNV = (FunctionTable::MEMBERPFNGLCOVERFILLPATHINSTANCEDNVPROC)&ProfilingTableDecorator::m_glCoverFillPathInstancedNV_profiling;
+if(this->m_ptr_glMultiTexParameterivEXT)this->m_ptr_glMultiTexParameterivEXT = (FunctionTable::MEMBERPFNGLMULTITEXPARAMETERIVEXTPROC)&ProfilingTableDecorator::m_glMultiTexParameterivEXT_profiling;
+if(this->m_ptr_glGetActiveAtomicCounterBufferiv)this->m_ptr_glGetActiveAtomicCounterBufferiv = (FunctionTable::MEMBERPFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC)&ProfilingTableDecorator::m_glGetActiveAtomicCounterBufferiv_profiling;
+if(this->m_ptr_glStencilOpSeparate)this->m_ptr_glStencilOpSeparate = (FunctionTable::MEMBERPFNGLSTENCILOPSEPARATEPROC)&ProfilingTableDecorator::m_glStencilOpSeparate_profiling;
+if(this->m_ptr_glVertexAttrib4fNV)this->m_ptr_glVertexAttrib4fNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4FNVPROC)&ProfilingTableDecorator::m_glVertexAttrib4fNV_profiling;
+if(this->m_ptr_glGetColorTableParameterivSGI)this->m_ptr_glGetColorTableParameterivSGI = (FunctionTable::MEMBERPFNGLGETCOLORTABLEPARAMETERIVSGIPROC)&ProfilingTableDecorator::m_glGetColorTableParameterivSGI_profiling;
+if(this->m_ptr_glVertexArrayAttribBinding)this->m_ptr_glVertexArrayAttribBinding = (FunctionTable::MEMBERPFNGLVERTEXARRAYATTRIBBINDINGPROC)&ProfilingTableDecorator::m_glVertexArrayAttribBinding_profiling;
+if(this->m_ptr_glProgramParameters4dvNV)this->m_ptr_glProgramParameters4dvNV = (FunctionTable::MEMBERPFNGLPROGRAMPARAMETERS4DVNVPROC)&ProfilingTableDecorator::m_glProgramParameters4dvNV_profiling;
+if(this->m_ptr_glVertexAttribL4dv)this->m_ptr_glVertexAttribL4dv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL4DVPROC)&ProfilingTableDecorator::m_glVertexAttribL4dv_profiling;
+if(this->m_ptr_glVertexStream3dATI)this->m_ptr_glVertexStream3dATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM3DATIPROC)&ProfilingTableDecorator::m_glVertexStream3dATI_profiling;
+if(this->m_ptr_glGetUniformOffsetEXT)this->m_ptr_glGetUniformOffsetEXT = (FunctionTable::MEMBERPFNGLGETUNIFORMOFFSETEXTPROC)&ProfilingTableDecorator::m_glGetUniformOffsetEXT_profiling;
+if(this->m_ptr_glGetVertexAttribPointerv)this->m_ptr_glGetVertexAttribPointerv = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBPOINTERVPROC)&ProfilingTableDecorator::m_glGetVertexAttribPointerv_profiling;
+if(this->m_ptr_glProgramUniform3i64vNV)this->m_ptr_glProgramUniform3i64vNV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3I64VNVPROC)&ProfilingTableDecorator::m_glProgramUniform3i64vNV_profiling;
+if(this->m_ptr_glTangent3fEXT)this->m_ptr_glTangent3fEXT = (FunctionTable::MEMBERPFNGLTANGENT3FEXTPROC)&ProfilingTableDecorator::m_glTangent3fEXT_profiling;
+if(this->m_ptr_glGetPathMetricRangeNV)this->m_ptr_glGetPathMetricRangeNV = (FunctionTable::MEMBERPFNGLGETPATHMETRICRANGENVPROC)&ProfilingTableDecorator::m_glGetPathMetricRangeNV_profiling;
+if(this->m_ptr_glWindowPos2iMESA)this->m_ptr_glWindowPos2iMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS2IMESAPROC)&ProfilingTableDecorator::m_glWindowPos2iMESA_profiling;
+if(this->m_ptr_glVertex2xvOES)this->m_ptr_glVertex2xvOES = (FunctionTable::MEMBERPFNGLVERTEX2XVOESPROC)&ProfilingTableDecorator::m_glVertex2xvOES_profiling;
+if(this->m_ptr_glGetnCompressedTexImage)this->m_ptr_glGetnCompressedTexImage = (FunctionTable::MEMBERPFNGLGETNCOMPRESSEDTEXIMAGEPROC)&ProfilingTableDecorator::m_glGetnCompressedTexImage_profiling;
+if(this->m_ptr_glWindowPos2dv)this->m_ptr_glWindowPos2dv = (FunctionTable::MEMBERPFNGLWINDOWPOS2DVPROC)&ProfilingTableDecorator::m_glWindowPos2dv_profiling;
+if(this->m_ptr_glReplacementCodeuiVertex3fSUN)this->m_ptr_glReplacementCodeuiVertex3fSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUIVERTEX3FSUNPROC)&ProfilingTableDecorator::m_glReplacementCodeuiVertex3fSUN_profiling;
+if(this->m_ptr_glGetTransformFeedbackVaryingEXT)this->m_ptr_glGetTransformFeedbackVaryingEXT = (FunctionTable::MEMBERPFNGLGETTRANSFORMFEEDBACKVARYINGEXTPROC)&ProfilingTableDecorator::m_glGetTransformFeedbackVaryingEXT_profiling;
+if(this->m_ptr_glWindowPos3fARB)this->m_ptr_glWindowPos3fARB = (FunctionTable::MEMBERPFNGLWINDOWPOS3FARBPROC)&ProfilingTableDecorator::m_glWindowPos3fARB_profiling;
+if(this->m_ptr_glMapNamedBufferEXT)this->m_ptr_glMapNamedBufferEXT = (FunctionTable::MEMBERPFNGLMAPNAMEDBUFFEREXTPROC)&ProfilingTableDecorator::m_glMapNamedBufferEXT_profiling;
+if(this->m_ptr_glDisable)this->m_ptr_glDisable = (FunctionTable::MEMBERPFNGLDISABLEPROC)&ProfilingTableDecorator::m_glDisable_profiling;
+if(this->m_ptr_glIsPointInFillPathNV)this->m_ptr_glIsPointInFillPathNV = (FunctionTable::MEMBERPFNGLISPOINTINFILLPATHNVPROC)&ProfilingTableDecorator::m_glIsPointInFillPathNV_profiling;
+if(this->m_ptr_glVertexAttribI2uiEXT)this->m_ptr_glVertexAttribI2uiEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI2UIEXTPROC)&ProfilingTableDecorator::m_glVertexAttribI2uiEXT_profiling;
+if(this->m_ptr_glProgramUniform4uiv)this->m_ptr_glProgramUniform4uiv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UIVPROC)&ProfilingTableDecorator::m_glProgramUniform4uiv_profiling;
+if(this->m_ptr_glQueryCounter)this->m_ptr_glQueryCounter = (FunctionTable::MEMBERPFNGLQUERYCOUNTERPROC)&ProfilingTableDecorator::m_glQueryCounter_profiling;
+if(this->m_ptr_glFramebufferRenderbufferEXT)this->m_ptr_glFramebufferRenderbufferEXT = (FunctionTable::MEMBERPFNGLFRAMEBUFFERRENDERBUFFEREXTPROC)&ProfilingTableDecorator::m_glFramebufferRenderbufferEXT_profiling;
+if(this->m_ptr_glBinormal3svEXT)this->m_ptr_glBinormal3svEXT = (FunctionTable::MEMBERPFNGLBINORMAL3SVEXTPROC)&ProfilingTableDecorator::m_glBinormal3svEXT_profiling;
+if(this->m_ptr_glBindBufferOffsetNV)this->m_ptr_glBindBufferOffsetNV = (FunctionTable::MEMBERPFNGLBINDBUFFEROFFSETNVPROC)&ProfilingTableDecorator::m_glBindBufferOffsetNV_profiling;
+if(this->m_ptr_glCopyTextureSubImage2D)this->m_ptr_glCopyTextureSubImage2D = (FunctionTable::MEMBERPFNGLCOPYTEXTURESUBIMAGE2DPROC)&ProfilingTableDecorator::m_glCopyTextureSubImage2D_profiling;
+if(this->m_ptr_glGetProgramResourcefvNV)this->m_ptr_glGetProgramResourcefvNV = (FunctionTable::MEMBERPFNGLGETPROGRAMRESOURCEFVNVPROC)&ProfilingTableDecorator::m_glGetProgramResourcefvNV_profiling;
+if(this->m_ptr_glBinormalPointerEXT)this->m_ptr_glBinormalPointerEXT = (FunctionTable::MEMBERPFNGLBINORMALPOINTEREXTPROC)&ProfilingTableDecorator::m_glBinormalPointerEXT_profiling;
+if(this->m_ptr_glGetLightfv)this->m_ptr_glGetLightfv = (FunctionTable::MEMBERPFNGLGETLIGHTFVPROC)&ProfilingTableDecorator::m_glGetLightfv_profiling;
+if(this->m_ptr_glVertex2bOES)this->m_ptr_glVertex2bOES = (FunctionTable::MEMBERPFNGLVERTEX2BOESPROC)&ProfilingTableDecorator::m_glVertex2bOES_profiling;
+if(this->m_ptr_glUniform2ivARB)this->m_ptr_glUniform2ivARB = (FunctionTable::MEMBERPFNGLUNIFORM2IVARBPROC)&ProfilingTableDecorator::m_glUniform2ivARB_profiling;
+if(this->m_ptr_glMultiTexCoord3s)this->m_ptr_glMultiTexCoord3s = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3SPROC)&ProfilingTableDecorator::m_glMultiTexCoord3s_profiling;
+if(this->m_ptr_glGetHistogramParameterfvEXT)this->m_ptr_glGetHistogramParameterfvEXT = (FunctionTable::MEMBERPFNGLGETHISTOGRAMPARAMETERFVEXTPROC)&ProfilingTableDecorator::m_glGetHistogramParameterfvEXT_profiling;
+if(this->m_ptr_glGetProgramStringNV)this->m_ptr_glGetProgramStringNV = (FunctionTable::MEMBERPFNGLGETPROGRAMSTRINGNVPROC)&ProfilingTableDecorator::m_glGetProgramStringNV_profiling;
+if(this->m_ptr_glGetTexGenxvOES)this->m_ptr_glGetTexGenxvOES = (FunctionTable::MEMBERPFNGLGETTEXGENXVOESPROC)&ProfilingTableDecorator::m_glGetTexGenxvOES_profiling;
+if(this->m_ptr_glTextureSubImage2D)this->m_ptr_glTextureSubImage2D = (FunctionTable::MEMBERPFNGLTEXTURESUBIMAGE2DPROC)&ProfilingTableDecorator::m_glTextureSubImage2D_profiling;
+if(this->m_ptr_glObjectPurgeableAPPLE)this->m_ptr_glObjectPurgeableAPPLE = (FunctionTable::MEMBERPFNGLOBJECTPURGEABLEAPPLEPROC)&ProfilingTableDecorator::m_glObjectPurgeableAPPLE_profiling;
+if(this->m_ptr_glColorTableSGI)this->m_ptr_glColorTableSGI = (FunctionTable::MEMBERPFNGLCOLORTABLESGIPROC)&ProfilingTableDecorator::m_glColorTableSGI_profiling;
+if(this->m_ptr_glCopyConvolutionFilter2DEXT)this->m_ptr_glCopyConvolutionFilter2DEXT = (FunctionTable::MEMBERPFNGLCOPYCONVOLUTIONFILTER2DEXTPROC)&ProfilingTableDecorator::m_glCopyConvolutionFilter2DEXT_profiling;
+if(this->m_ptr_glMultiTexCoord3f)this->m_ptr_glMultiTexCoord3f = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3FPROC)&ProfilingTableDecorator::m_glMultiTexCoord3f_profiling;
+if(this->m_ptr_glMultiTexCoord3d)this->m_ptr_glMultiTexCoord3d = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3DPROC)&ProfilingTableDecorator::m_glMultiTexCoord3d_profiling;
+if(this->m_ptr_glFogCoorddv)this->m_ptr_glFogCoorddv = (FunctionTable::MEMBERPFNGLFOGCOORDDVPROC)&ProfilingTableDecorator::m_glFogCoorddv_profiling;
+if(this->m_ptr_glGetBufferPointerv)this->m_ptr_glGetBufferPointerv = (FunctionTable::MEMBERPFNGLGETBUFFERPOINTERVPROC)&ProfilingTableDecorator::m_glGetBufferPointerv_profiling;
+if(this->m_ptr_glProgramUniform1fEXT)this->m_ptr_glProgramUniform1fEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1FEXTPROC)&ProfilingTableDecorator::m_glProgramUniform1fEXT_profiling;
+if(this->m_ptr_glWindowPos2fvMESA)this->m_ptr_glWindowPos2fvMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS2FVMESAPROC)&ProfilingTableDecorator::m_glWindowPos2fvMESA_profiling;
+if(this->m_ptr_glPolygonOffsetxOES)this->m_ptr_glPolygonOffsetxOES = (FunctionTable::MEMBERPFNGLPOLYGONOFFSETXOESPROC)&ProfilingTableDecorator::m_glPolygonOffsetxOES_profiling;
+if(this->m_ptr_glVertexAttrib4dARB)this->m_ptr_glVertexAttrib4dARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4DARBPROC)&ProfilingTableDecorator::m_glVertexAttrib4dARB_profiling;
+if(this->m_ptr_glUniformHandleui64vARB)this->m_ptr_glUniformHandleui64vARB = (FunctionTable::MEMBERPFNGLUNIFORMHANDLEUI64VARBPROC)&ProfilingTableDecorator::m_glUniformHandleui64vARB_profiling;
+if(this->m_ptr_glFragmentLightModelfvSGIX)this->m_ptr_glFragmentLightModelfvSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTLIGHTMODELFVSGIXPROC)&ProfilingTableDecorator::m_glFragmentLightModelfvSGIX_profiling;
+if(this->m_ptr_glSwizzleEXT)this->m_ptr_glSwizzleEXT = (FunctionTable::MEMBERPFNGLSWIZZLEEXTPROC)&ProfilingTableDecorator::m_glSwizzleEXT_profiling;
+if(this->m_ptr_glBindFragmentShaderATI)this->m_ptr_glBindFragmentShaderATI = (FunctionTable::MEMBERPFNGLBINDFRAGMENTSHADERATIPROC)&ProfilingTableDecorator::m_glBindFragmentShaderATI_profiling;
+if(this->m_ptr_glVertexAttribs3hvNV)this->m_ptr_glVertexAttribs3hvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS3HVNVPROC)&ProfilingTableDecorator::m_glVertexAttribs3hvNV_profiling;
+if(this->m_ptr_glColorP3ui)this->m_ptr_glColorP3ui = (FunctionTable::MEMBERPFNGLCOLORP3UIPROC)&ProfilingTableDecorator::m_glColorP3ui_profiling;
+if(this->m_ptr_glListParameterfvSGIX)this->m_ptr_glListParameterfvSGIX = (FunctionTable::MEMBERPFNGLLISTPARAMETERFVSGIXPROC)&ProfilingTableDecorator::m_glListParameterfvSGIX_profiling;
+if(this->m_ptr_glNamedRenderbufferStorageMultisample)this->m_ptr_glNamedRenderbufferStorageMultisample = (FunctionTable::MEMBERPFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC)&ProfilingTableDecorator::m_glNamedRenderbufferStorageMultisample_profiling;
+if(this->m_ptr_glVertexAttribI1iEXT)this->m_ptr_glVertexAttribI1iEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI1IEXTPROC)&ProfilingTableDecorator::m_glVertexAttribI1iEXT_profiling;
+if(this->m_ptr_glMultiTexCoord2ivARB)this->m_ptr_glMultiTexCoord2ivARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2IVARBPROC)&ProfilingTableDecorator::m_glMultiTexCoord2ivARB_profiling;
+if(this->m_ptr_glLightModelxOES)this->m_ptr_glLightModelxOES = (FunctionTable::MEMBERPFNGLLIGHTMODELXOESPROC)&ProfilingTableDecorator::m_glLightModelxOES_profiling;
+if(this->m_ptr_glColor3xOES)this->m_ptr_glColor3xOES = (FunctionTable::MEMBERPFNGLCOLOR3XOESPROC)&ProfilingTableDecorator::m_glColor3xOES_profiling;
+if(this->m_ptr_glReadBuffer)this->m_ptr_glReadBuffer = (FunctionTable::MEMBERPFNGLREADBUFFERPROC)&ProfilingTableDecorator::m_glReadBuffer_profiling;
+if(this->m_ptr_glStencilFillPathInstancedNV)this->m_ptr_glStencilFillPathInstancedNV = (FunctionTable::MEMBERPFNGLSTENCILFILLPATHINSTANCEDNVPROC)&ProfilingTableDecorator::m_glStencilFillPathInstancedNV_profiling;
+if(this->m_ptr_glVDPAUUnmapSurfacesNV)this->m_ptr_glVDPAUUnmapSurfacesNV = (FunctionTable::MEMBERPFNGLVDPAUUNMAPSURFACESNVPROC)&ProfilingTableDecorator::m_glVDPAUUnmapSurfacesNV_profiling;
+if(this->m_ptr_glProgramUniform4i64NV)this->m_ptr_glProgramUniform4i64NV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4I64NVPROC)&ProfilingTableDecorator::m_glProgramUniform4i64NV_profiling;
+if(this->m_ptr_glVertexStream4dvATI)this->m_ptr_glVertexStream4dvATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM4DVATIPROC)&ProfilingTableDecorator::m_glVertexStream4dvATI_profiling;
+if(this->m_ptr_glIsQuery)this->m_ptr_glIsQuery = (FunctionTable::MEMBERPFNGLISQUERYPROC)&ProfilingTableDecorator::m_glIsQuery_profiling;
+if(this->m_ptr_glProgramUniformMatrix4fvEXT)this->m_ptr_glProgramUniformMatrix4fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4FVEXTPROC)&ProfilingTableDecorator::m_glProgramUniformMatrix4fvEXT_profiling;
+if(this->m_ptr_glVertexAttrib3hNV)this->m_ptr_glVertexAttrib3hNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3HNVPROC)&ProfilingTableDecorator::m_glVertexAttrib3hNV_profiling;
+if(this->m_ptr_glFlushMappedNamedBufferRange)this->m_ptr_glFlushMappedNamedBufferRange = (FunctionTable::MEMBERPFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC)&ProfilingTableDecorator::m_glFlushMappedNamedBufferRange_profiling;
+if(this->m_ptr_glPushName)this->m_ptr_glPushName = (FunctionTable::MEMBERPFNGLPUSHNAMEPROC)&ProfilingTableDecorator::m_glPushName_profiling;
+if(this->m_ptr_glGetClipPlane)this->m_ptr_glGetClipPlane = (FunctionTable::MEMBERPFNGLGETCLIPPLANEPROC)&ProfilingTableDecorator::m_glGetClipPlane_profiling;
+if(this->m_ptr_glVertex4dv)this->m_ptr_glVertex4dv = (FunctionTable::MEMBERPFNGLVERTEX4DVPROC)&ProfilingTableDecorator::m_glVertex4dv_profiling;
+if(this->m_ptr_glVertexAttrib3d)this->m_ptr_glVertexAttrib3d = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3DPROC)&ProfilingTableDecorator::m_glVertexAttrib3d_profiling;
+if(this->m_ptr_glBlendColor)this->m_ptr_glBlendColor = (FunctionTable::MEMBERPFNGLBLENDCOLORPROC)&ProfilingTableDecorator::m_glBlendColor_profiling;
+if(this->m_ptr_glBindTransformFeedbackNV)this->m_ptr_glBindTransformFeedbackNV = (FunctionTable::MEMBERPFNGLBINDTRANSFORMFEEDBACKNVPROC)&ProfilingTableDecorator::m_glBindTransformFeedbackNV_profiling;
+if(this->m_ptr_glSamplerParameterIuiv)this->m_ptr_glSamplerParameterIuiv = (FunctionTable::MEMBERPFNGLSAMPLERPARAMETERIUIVPROC)&ProfilingTableDecorator::m_glSamplerParameterIuiv_profiling;
+if(this->m_ptr_glIndexubv)this->m_ptr_glIndexubv = (FunctionTable::MEMBERPFNGLINDEXUBVPROC)&ProfilingTableDecorator::m_glIndexubv_profiling;
+if(this->m_ptr_glNamedBufferPageCommitmentEXT)this->m_ptr_glNamedBufferPageCommitmentEXT = (FunctionTable::MEMBERPFNGLNAMEDBUFFERPAGECOMMITMENTEXTPROC)&ProfilingTableDecorator::m_glNamedBufferPageCommitmentEXT_profiling;
+if(this->m_ptr_glCheckNamedFramebufferStatus)this->m_ptr_glCheckNamedFramebufferStatus = (FunctionTable::MEMBERPFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC)&ProfilingTableDecorator::m_glCheckNamedFramebufferStatus_profiling;
+if(this->m_ptr_glGetObjectBufferfvATI)this->m_ptr_glGetObjectBufferfvATI = (FunctionTable::MEMBERPFNGLGETOBJECTBUFFERFVATIPROC)&ProfilingTableDecorator::m_glGetObjectBufferfvATI_profiling;
+if(this->m_ptr_glRasterPos4d)this->m_ptr_glRasterPos4d = (FunctionTable::MEMBERPFNGLRASTERPOS4DPROC)&ProfilingTableDecorator::m_glRasterPos4d_profiling;
+if(this->m_ptr_glRasterPos4f)this->m_ptr_glRasterPos4f = (FunctionTable::MEMBERPFNGLRASTERPOS4FPROC)&ProfilingTableDecorator::m_glRasterPos4f_profiling;
+if(this->m_ptr_glGetPerfMonitorCounterStringAMD)this->m_ptr_glGetPerfMonitorCounterStringAMD = (FunctionTable::MEMBERPFNGLGETPERFMONITORCOUNTERSTRINGAMDPROC)&ProfilingTableDecorator::m_glGetPerfMonitorCounterStringAMD_profiling;
+if(this->m_ptr_glVertexAttrib3s)this->m_ptr_glVertexAttrib3s = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3SPROC)&ProfilingTableDecorator::m_glVertexAttrib3s_profiling;
+if(this->m_ptr_glDrawElementsInstancedEXT)this->m_ptr_glDrawElementsInstancedEXT = (FunctionTable::MEMBERPFNGLDRAWELEMENTSINSTANCEDEXTPROC)&ProfilingTableDecorator::m_glDrawElementsInstancedEXT_profiling;
+if(this->m_ptr_glNamedProgramLocalParameterI4iEXT)this->m_ptr_glNamedProgramLocalParameterI4iEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERI4IEXTPROC)&ProfilingTableDecorator::m_glNamedProgramLocalParameterI4iEXT_profiling;
+if(this->m_ptr_glRasterPos4s)this->m_ptr_glRasterPos4s = (FunctionTable::MEMBERPFNGLRASTERPOS4SPROC)&ProfilingTableDecorator::m_glRasterPos4s_profiling;
+if(this->m_ptr_glGetProgramStageiv)this->m_ptr_glGetProgramStageiv = (FunctionTable::MEMBERPFNGLGETPROGRAMSTAGEIVPROC)&ProfilingTableDecorator::m_glGetProgramStageiv_profiling;
+if(this->m_ptr_glGetMaterialxOES)this->m_ptr_glGetMaterialxOES = (FunctionTable::MEMBERPFNGLGETMATERIALXOESPROC)&ProfilingTableDecorator::m_glGetMaterialxOES_profiling;
+if(this->m_ptr_glPopMatrix)this->m_ptr_glPopMatrix = (FunctionTable::MEMBERPFNGLPOPMATRIXPROC)&ProfilingTableDecorator::m_glPopMatrix_profiling;
+if(this->m_ptr_glGetVideoui64vNV)this->m_ptr_glGetVideoui64vNV = (FunctionTable::MEMBERPFNGLGETVIDEOUI64VNVPROC)&ProfilingTableDecorator::m_glGetVideoui64vNV_profiling;
+if(this->m_ptr_glTangent3bEXT)this->m_ptr_glTangent3bEXT = (FunctionTable::MEMBERPFNGLTANGENT3BEXTPROC)&ProfilingTableDecorator::m_glTangent3bEXT_profiling;
+if(this->m_ptr_glGetGraphicsResetStatusARB)this->m_ptr_glGetGraphicsResetStatusARB = (FunctionTable::MEMBERPFNGLGETGRAPHICSRESETSTATUSARBPROC)&ProfilingTableDecorator::m_glGetGraphicsResetStatusARB_profiling;
+if(this->m_ptr_glUniform4i)this->m_ptr_glUniform4i = (FunctionTable::MEMBERPFNGLUNIFORM4IPROC)&ProfilingTableDecorator::m_glUniform4i_profiling;
+if(this->m_ptr_glActiveTexture)this->m_ptr_glActiveTexture = (FunctionTable::MEMBERPFNGLACTIVETEXTUREPROC)&ProfilingTableDecorator::m_glActiveTexture_profiling;
+if(this->m_ptr_glEnableVertexAttribArray)this->m_ptr_glEnableVertexAttribArray = (FunctionTable::MEMBERPFNGLENABLEVERTEXATTRIBARRAYPROC)&ProfilingTableDecorator::m_glEnableVertexAttribArray_profiling;
+if(this->m_ptr_glTexCoord4fVertex4fvSUN)this->m_ptr_glTexCoord4fVertex4fvSUN = (FunctionTable::MEMBERPFNGLTEXCOORD4FVERTEX4FVSUNPROC)&ProfilingTableDecorator::m_glTexCoord4fVertex4fvSUN_profiling;
+if(this->m_ptr_glUniform4d)this->m_ptr_glUniform4d = (FunctionTable::MEMBERPFNGLUNIFORM4DPROC)&ProfilingTableDecorator::m_glUniform4d_profiling;
+if(this->m_ptr_glUniform4f)this->m_ptr_glUniform4f = (FunctionTable::MEMBERPFNGLUNIFORM4FPROC)&ProfilingTableDecorator::m_glUniform4f_profiling;
+if(this->m_ptr_glRenderbufferStorageMultisample)this->m_ptr_glRenderbufferStorageMultisample = (FunctionTable::MEMBERPFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC)&ProfilingTableDecorator::m_glRenderbufferStorageMultisample_profiling;
+if(this->m_ptr_glCreateProgramPipelines)this->m_ptr_glCreateProgramPipelines = (FunctionTable::MEMBERPFNGLCREATEPROGRAMPIPELINESPROC)&ProfilingTableDecorator::m_glCreateProgramPipelines_profiling;
+if(this->m_ptr_glVertexAttribLPointer)this->m_ptr_glVertexAttribLPointer = (FunctionTable::MEMBERPFNGLVERTEXATTRIBLPOINTERPROC)&ProfilingTableDecorator::m_glVertexAttribLPointer_profiling;
+if(this->m_ptr_glUniform2uiEXT)this->m_ptr_glUniform2uiEXT = (FunctionTable::MEMBERPFNGLUNIFORM2UIEXTPROC)&ProfilingTableDecorator::m_glUniform2uiEXT_profiling;
+if(this->m_ptr_glMultiTexCoord3sv)this->m_ptr_glMultiTexCoord3sv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3SVPROC)&ProfilingTableDecorator::m_glMultiTexCoord3sv_profiling;
+if(this->m_ptr_glDrawElementsInstancedBaseVertex)this->m_ptr_glDrawElementsInstancedBaseVertex = (FunctionTable::MEMBERPFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC)&ProfilingTableDecorator::m_glDrawElementsInstancedBaseVertex_profiling;
+if(this->m_ptr_glPixelTransformParameterfvEXT)this->m_ptr_glPixelTransformParameterfvEXT = (FunctionTable::MEMBERPFNGLPIXELTRANSFORMPARAMETERFVEXTPROC)&ProfilingTableDecorator::m_glPixelTransformParameterfvEXT_profiling;
+if(this->m_ptr_glDrawTransformFeedbackNV)this->m_ptr_glDrawTransformFeedbackNV = (FunctionTable::MEMBERPFNGLDRAWTRANSFORMFEEDBACKNVPROC)&ProfilingTableDecorator::m_glDrawTransformFeedbackNV_profiling;
+if(this->m_ptr_glTextureImage2DMultisampleCoverageNV)this->m_ptr_glTextureImage2DMultisampleCoverageNV = (FunctionTable::MEMBERPFNGLTEXTUREIMAGE2DMULTISAMPLECOVERAGENVPROC)&ProfilingTableDecorator::m_glTextureImage2DMultisampleCoverageNV_profiling;
+if(this->m_ptr_glNamedRenderbufferStorageMultisampleCoverageEXT)this->m_ptr_glNamedRenderbufferStorageMultisampleCoverageEXT = (FunctionTable::MEMBERPFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLECOVERAGEEXTPROC)&ProfilingTableDecorator::m_glNamedRenderbufferStorageMultisampleCoverageEXT_profiling;
+if(this->m_ptr_glIsTexture)this->m_ptr_glIsTexture = (FunctionTable::MEMBERPFNGLISTEXTUREPROC)&ProfilingTableDecorator::m_glIsTexture_profiling;
+if(this->m_ptr_glMultiTexCoord4iv)this->m_ptr_glMultiTexCoord4iv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4IVPROC)&ProfilingTableDecorator::m_glMultiTexCoord4iv_profiling;
+if(this->m_ptr_glTexEnvfv)this->m_ptr_glTexEnvfv = (FunctionTable::MEMBERPFNGLTEXENVFVPROC)&ProfilingTableDecorator::m_glTexEnvfv_profiling;
+if(this->m_ptr_glPopDebugGroup)this->m_ptr_glPopDebugGroup = (FunctionTable::MEMBERPFNGLPOPDEBUGGROUPPROC)&ProfilingTableDecorator::m_glPopDebugGroup_profiling;
+if(this->m_ptr_glUniformBlockBinding)this->m_ptr_glUniformBlockBinding = (FunctionTable::MEMBERPFNGLUNIFORMBLOCKBINDINGPROC)&ProfilingTableDecorator::m_glUniformBlockBinding_profiling;
+if(this->m_ptr_glWindowPos2svMESA)this->m_ptr_glWindowPos2svMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS2SVMESAPROC)&ProfilingTableDecorator::m_glWindowPos2svMESA_profiling;
+if(this->m_ptr_glGenerateTextureMipmapEXT)this->m_ptr_glGenerateTextureMipmapEXT = (FunctionTable::MEMBERPFNGLGENERATETEXTUREMIPMAPEXTPROC)&ProfilingTableDecorator::m_glGenerateTextureMipmapEXT_profiling;
+if(this->m_ptr_glBindLightParameterEXT)this->m_ptr_glBindLightParameterEXT = (FunctionTable::MEMBERPFNGLBINDLIGHTPARAMETEREXTPROC)&ProfilingTableDecorator::m_glBindLightParameterEXT_profiling;
+if(this->m_ptr_glTexCoord3bOES)this->m_ptr_glTexCoord3bOES = (FunctionTable::MEMBERPFNGLTEXCOORD3BOESPROC)&ProfilingTableDecorator::m_glTexCoord3bOES_profiling;
+if(this->m_ptr_glTexCoordPointer)this->m_ptr_glTexCoordPointer = (FunctionTable::MEMBERPFNGLTEXCOORDPOINTERPROC)&ProfilingTableDecorator::m_glTexCoordPointer_profiling;
+if(this->m_ptr_glProgramUniformMatrix3x2fv)this->m_ptr_glProgramUniformMatrix3x2fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X2FVPROC)&ProfilingTableDecorator::m_glProgramUniformMatrix3x2fv_profiling;
+if(this->m_ptr_glUniform2fvARB)this->m_ptr_glUniform2fvARB = (FunctionTable::MEMBERPFNGLUNIFORM2FVARBPROC)&ProfilingTableDecorator::m_glUniform2fvARB_profiling;
+if(this->m_ptr_glProgramLocalParameterI4uivNV)this->m_ptr_glProgramLocalParameterI4uivNV = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERI4UIVNVPROC)&ProfilingTableDecorator::m_glProgramLocalParameterI4uivNV_profiling;
+if(this->m_ptr_glFlushVertexArrayRangeNV)this->m_ptr_glFlushVertexArrayRangeNV = (FunctionTable::MEMBERPFNGLFLUSHVERTEXARRAYRANGENVPROC)&ProfilingTableDecorator::m_glFlushVertexArrayRangeNV_profiling;
+if(this->m_ptr_glSecondaryColor3svEXT)this->m_ptr_glSecondaryColor3svEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3SVEXTPROC)&ProfilingTableDecorator::m_glSecondaryColor3svEXT_profiling;
+if(this->m_ptr_glGetBufferParameteriv)this->m_ptr_glGetBufferParameteriv = (FunctionTable::MEMBERPFNGLGETBUFFERPARAMETERIVPROC)&ProfilingTableDecorator::m_glGetBufferParameteriv_profiling;
+if(this->m_ptr_glGetQueryIndexediv)this->m_ptr_glGetQueryIndexediv = (FunctionTable::MEMBERPFNGLGETQUERYINDEXEDIVPROC)&ProfilingTableDecorator::m_glGetQueryIndexediv_profiling;
+if(this->m_ptr_glFramebufferTexture3DEXT)this->m_ptr_glFramebufferTexture3DEXT = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURE3DEXTPROC)&ProfilingTableDecorator::m_glFramebufferTexture3DEXT_profiling;
+if(this->m_ptr_glLoadTransposeMatrixxOES)this->m_ptr_glLoadTransposeMatrixxOES = (FunctionTable::MEMBERPFNGLLOADTRANSPOSEMATRIXXOESPROC)&ProfilingTableDecorator::m_glLoadTransposeMatrixxOES_profiling;
+if(this->m_ptr_glDeleteTransformFeedbacksNV)this->m_ptr_glDeleteTransformFeedbacksNV = (FunctionTable::MEMBERPFNGLDELETETRANSFORMFEEDBACKSNVPROC)&ProfilingTableDecorator::m_glDeleteTransformFeedbacksNV_profiling;
+if(this->m_ptr_glGetCompressedTextureImageEXT)this->m_ptr_glGetCompressedTextureImageEXT = (FunctionTable::MEMBERPFNGLGETCOMPRESSEDTEXTUREIMAGEEXTPROC)&ProfilingTableDecorator::m_glGetCompressedTextureImageEXT_profiling;
+if(this->m_ptr_glIndexMaterialEXT)this->m_ptr_glIndexMaterialEXT = (FunctionTable::MEMBERPFNGLINDEXMATERIALEXTPROC)&ProfilingTableDecorator::m_glIndexMaterialEXT_profiling;
+if(this->m_ptr_glFogCoorddEXT)this->m_ptr_glFogCoorddEXT = (FunctionTable::MEMBERPFNGLFOGCOORDDEXTPROC)&ProfilingTableDecorator::m_glFogCoorddEXT_profiling;
+if(this->m_ptr_glTexCoord2hvNV)this->m_ptr_glTexCoord2hvNV = (FunctionTable::MEMBERPFNGLTEXCOORD2HVNVPROC)&ProfilingTableDecorator::m_glTexCoord2hvNV_profiling;
+if(this->m_ptr_glFramebufferTexture2DEXT)this->m_ptr_glFramebufferTexture2DEXT = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURE2DEXTPROC)&ProfilingTableDecorator::m_glFramebufferTexture2DEXT_profiling;
+if(this->m_ptr_glTexEnviv)this->m_ptr_glTexEnviv = (FunctionTable::MEMBERPFNGLTEXENVIVPROC)&ProfilingTableDecorator::m_glTexEnviv_profiling;
+if(this->m_ptr_glEndTransformFeedbackNV)this->m_ptr_glEndTransformFeedbackNV = (FunctionTable::MEMBERPFNGLENDTRANSFORMFEEDBACKNVPROC)&ProfilingTableDecorator::m_glEndTransformFeedbackNV_profiling;
+if(this->m_ptr_glGlobalAlphaFactoruiSUN)this->m_ptr_glGlobalAlphaFactoruiSUN = (FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORUISUNPROC)&ProfilingTableDecorator::m_glGlobalAlphaFactoruiSUN_profiling;
+if(this->m_ptr_glSelectBuffer)this->m_ptr_glSelectBuffer = (FunctionTable::MEMBERPFNGLSELECTBUFFERPROC)&ProfilingTableDecorator::m_glSelectBuffer_profiling;
+if(this->m_ptr_glNamedBufferSubDataEXT)this->m_ptr_glNamedBufferSubDataEXT = (FunctionTable::MEMBERPFNGLNAMEDBUFFERSUBDATAEXTPROC)&ProfilingTableDecorator::m_glNamedBufferSubDataEXT_profiling;
+if(this->m_ptr_glDisableVertexArrayAttrib)this->m_ptr_glDisableVertexArrayAttrib = (FunctionTable::MEMBERPFNGLDISABLEVERTEXARRAYATTRIBPROC)&ProfilingTableDecorator::m_glDisableVertexArrayAttrib_profiling;
+if(this->m_ptr_glBlendFunc)this->m_ptr_glBlendFunc = (FunctionTable::MEMBERPFNGLBLENDFUNCPROC)&ProfilingTableDecorator::m_glBlendFunc_profiling;
+if(this->m_ptr_glCreateProgram)this->m_ptr_glCreateProgram = (FunctionTable::MEMBERPFNGLCREATEPROGRAMPROC)&ProfilingTableDecorator::m_glCreateProgram_profiling;
+if(this->m_ptr_glVertexStream2dATI)this->m_ptr_glVertexStream2dATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM2DATIPROC)&ProfilingTableDecorator::m_glVertexStream2dATI_profiling;
+if(this->m_ptr_glUniform4ui64vARB)this->m_ptr_glUniform4ui64vARB = (FunctionTable::MEMBERPFNGLUNIFORM4UI64VARBPROC)&ProfilingTableDecorator::m_glUniform4ui64vARB_profiling;
+if(this->m_ptr_glPrimitiveRestartIndex)this->m_ptr_glPrimitiveRestartIndex = (FunctionTable::MEMBERPFNGLPRIMITIVERESTARTINDEXPROC)&ProfilingTableDecorator::m_glPrimitiveRestartIndex_profiling;
+if(this->m_ptr_glNormalStream3fATI)this->m_ptr_glNormalStream3fATI = (FunctionTable::MEMBERPFNGLNORMALSTREAM3FATIPROC)&ProfilingTableDecorator::m_glNormalStream3fATI_profiling;
+if(this->m_ptr_glProgramUniformMatrix2fv)this->m_ptr_glProgramUniformMatrix2fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2FVPROC)&ProfilingTableDecorator::m_glProgramUniformMatrix2fv_profiling;
+if(this->m_ptr_glVertexAttribs1hvNV)this->m_ptr_glVertexAttribs1hvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS1HVNVPROC)&ProfilingTableDecorator::m_glVertexAttribs1hvNV_profiling;
+if(this->m_ptr_glWindowPos4svMESA)this->m_ptr_glWindowPos4svMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS4SVMESAPROC)&ProfilingTableDecorator::m_glWindowPos4svMESA_profiling;
+if(this->m_ptr_glDeleteFragmentShaderATI)this->m_ptr_glDeleteFragmentShaderATI = (FunctionTable::MEMBERPFNGLDELETEFRAGMENTSHADERATIPROC)&ProfilingTableDecorator::m_glDeleteFragmentShaderATI_profiling;
+if(this->m_ptr_glBindImageTextures)this->m_ptr_glBindImageTextures = (FunctionTable::MEMBERPFNGLBINDIMAGETEXTURESPROC)&ProfilingTableDecorator::m_glBindImageTextures_profiling;
+if(this->m_ptr_glMap2xOES)this->m_ptr_glMap2xOES = (FunctionTable::MEMBERPFNGLMAP2XOESPROC)&ProfilingTableDecorator::m_glMap2xOES_profiling;
+if(this->m_ptr_glEnd)this->m_ptr_glEnd = (FunctionTable::MEMBERPFNGLENDPROC)&ProfilingTableDecorator::m_glEnd_profiling;
+if(this->m_ptr_glMultiTexCoord2dARB)this->m_ptr_glMultiTexCoord2dARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2DARBPROC)&ProfilingTableDecorator::m_glMultiTexCoord2dARB_profiling;
+if(this->m_ptr_glUniform1i64NV)this->m_ptr_glUniform1i64NV = (FunctionTable::MEMBERPFNGLUNIFORM1I64NVPROC)&ProfilingTableDecorator::m_glUniform1i64NV_profiling;
+if(this->m_ptr_glPathStringNV)this->m_ptr_glPathStringNV = (FunctionTable::MEMBERPFNGLPATHSTRINGNVPROC)&ProfilingTableDecorator::m_glPathStringNV_profiling;
+if(this->m_ptr_glGetNamedFramebufferParameterivEXT)this->m_ptr_glGetNamedFramebufferParameterivEXT = (FunctionTable::MEMBERPFNGLGETNAMEDFRAMEBUFFERPARAMETERIVEXTPROC)&ProfilingTableDecorator::m_glGetNamedFramebufferParameterivEXT_profiling;
+if(this->m_ptr_glGetProgramNamedParameterdvNV)this->m_ptr_glGetProgramNamedParameterdvNV = (FunctionTable::MEMBERPFNGLGETPROGRAMNAMEDPARAMETERDVNVPROC)&ProfilingTableDecorator::m_glGetProgramNamedParameterdvNV_profiling;
+if(this->m_ptr_glPathDashArrayNV)this->m_ptr_glPathDashArrayNV = (FunctionTable::MEMBERPFNGLPATHDASHARRAYNVPROC)&ProfilingTableDecorator::m_glPathDashArrayNV_profiling;
+if(this->m_ptr_glUniform3uiv)this->m_ptr_glUniform3uiv = (FunctionTable::MEMBERPFNGLUNIFORM3UIVPROC)&ProfilingTableDecorator::m_glUniform3uiv_profiling;
+if(this->m_ptr_glColor3fVertex3fvSUN)this->m_ptr_glColor3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLCOLOR3FVERTEX3FVSUNPROC)&ProfilingTableDecorator::m_glColor3fVertex3fvSUN_profiling;
+if(this->m_ptr_glMultTransposeMatrixd)this->m_ptr_glMultTransposeMatrixd = (FunctionTable::MEMBERPFNGLMULTTRANSPOSEMATRIXDPROC)&ProfilingTableDecorator::m_glMultTransposeMatrixd_profiling;
+if(this->m_ptr_glClearColor)this->m_ptr_glClearColor = (FunctionTable::MEMBERPFNGLCLEARCOLORPROC)&ProfilingTableDecorator::m_glClearColor_profiling;
+if(this->m_ptr_glGetImageHandleARB)this->m_ptr_glGetImageHandleARB = (FunctionTable::MEMBERPFNGLGETIMAGEHANDLEARBPROC)&ProfilingTableDecorator::m_glGetImageHandleARB_profiling;
+if(this->m_ptr_glTangent3dEXT)this->m_ptr_glTangent3dEXT = (FunctionTable::MEMBERPFNGLTANGENT3DEXTPROC)&ProfilingTableDecorator::m_glTangent3dEXT_profiling;
+if(this->m_ptr_glGetQueryObjectivARB)this->m_ptr_glGetQueryObjectivARB = (FunctionTable::MEMBERPFNGLGETQUERYOBJECTIVARBPROC)&ProfilingTableDecorator::m_glGetQueryObjectivARB_profiling;
+if(this->m_ptr_glGetLocalConstantFloatvEXT)this->m_ptr_glGetLocalConstantFloatvEXT = (FunctionTable::MEMBERPFNGLGETLOCALCONSTANTFLOATVEXTPROC)&ProfilingTableDecorator::m_glGetLocalConstantFloatvEXT_profiling;
+if(this->m_ptr_glUseShaderProgramEXT)this->m_ptr_glUseShaderProgramEXT = (FunctionTable::MEMBERPFNGLUSESHADERPROGRAMEXTPROC)&ProfilingTableDecorator::m_glUseShaderProgramEXT_profiling;
+if(this->m_ptr_glBindRenderbufferEXT)this->m_ptr_glBindRenderbufferEXT = (FunctionTable::MEMBERPFNGLBINDRENDERBUFFEREXTPROC)&ProfilingTableDecorator::m_glBindRenderbufferEXT_profiling;
+if(this->m_ptr_glInterleavedArrays)this->m_ptr_glInterleavedArrays = (FunctionTable::MEMBERPFNGLINTERLEAVEDARRAYSPROC)&ProfilingTableDecorator::m_glInterleavedArrays_profiling;
+if(this->m_ptr_glGetPerfMonitorGroupStringAMD)this->m_ptr_glGetPerfMonitorGroupStringAMD = (FunctionTable::MEMBERPFNGLGETPERFMONITORGROUPSTRINGAMDPROC)&ProfilingTableDecorator::m_glGetPerfMonitorGroupStringAMD_profiling;
+if(this->m_ptr_glUniform3ui)this->m_ptr_glUniform3ui = (FunctionTable::MEMBERPFNGLUNIFORM3UIPROC)&ProfilingTableDecorator::m_glUniform3ui_profiling;
+if(this->m_ptr_glGetNamedProgramLocalParameterdvEXT)this->m_ptr_glGetNamedProgramLocalParameterdvEXT = (FunctionTable::MEMBERPFNGLGETNAMEDPROGRAMLOCALPARAMETERDVEXTPROC)&ProfilingTableDecorator::m_glGetNamedProgramLocalParameterdvEXT_profiling;
+if(this->m_ptr_glSecondaryColor3us)this->m_ptr_glSecondaryColor3us = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3USPROC)&ProfilingTableDecorator::m_glSecondaryColor3us_profiling;
+if(this->m_ptr_glVertexAttribI4uiv)this->m_ptr_glVertexAttribI4uiv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4UIVPROC)&ProfilingTableDecorator::m_glVertexAttribI4uiv_profiling;
+if(this->m_ptr_glVertexAttrib4bv)this->m_ptr_glVertexAttrib4bv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4BVPROC)&ProfilingTableDecorator::m_glVertexAttrib4bv_profiling;
+if(this->m_ptr_glMultiTexCoord3xOES)this->m_ptr_glMultiTexCoord3xOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3XOESPROC)&ProfilingTableDecorator::m_glMultiTexCoord3xOES_profiling;
+if(this->m_ptr_glSecondaryColor3ub)this->m_ptr_glSecondaryColor3ub = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UBPROC)&ProfilingTableDecorator::m_glSecondaryColor3ub_profiling;
+if(this->m_ptr_glFragmentMaterialfSGIX)this->m_ptr_glFragmentMaterialfSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTMATERIALFSGIXPROC)&ProfilingTableDecorator::m_glFragmentMaterialfSGIX_profiling;
+if(this->m_ptr_glGetVariantArrayObjectivATI)this->m_ptr_glGetVariantArrayObjectivATI = (FunctionTable::MEMBERPFNGLGETVARIANTARRAYOBJECTIVATIPROC)&ProfilingTableDecorator::m_glGetVariantArrayObjectivATI_profiling;
+if(this->m_ptr_glSecondaryColor3ui)this->m_ptr_glSecondaryColor3ui = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UIPROC)&ProfilingTableDecorator::m_glSecondaryColor3ui_profiling;
+if(this->m_ptr_glVertexAttrib1dARB)this->m_ptr_glVertexAttrib1dARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1DARBPROC)&ProfilingTableDecorator::m_glVertexAttrib1dARB_profiling;
+if(this->m_ptr_glGetNamedBufferPointerv)this->m_ptr_glGetNamedBufferPointerv = (FunctionTable::MEMBERPFNGLGETNAMEDBUFFERPOINTERVPROC)&ProfilingTableDecorator::m_glGetNamedBufferPointerv_profiling;
+if(this->m_ptr_glLockArraysEXT)this->m_ptr_glLockArraysEXT = (FunctionTable::MEMBERPFNGLLOCKARRAYSEXTPROC)&ProfilingTableDecorator::m_glLockArraysEXT_profiling;
+if(this->m_ptr_glVertexAttribPointerNV)this->m_ptr_glVertexAttribPointerNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBPOINTERNVPROC)&ProfilingTableDecorator::m_glVertexAttribPointerNV_profiling;
+if(this->m_ptr_glConvolutionParameterf)this->m_ptr_glConvolutionParameterf = (FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERFPROC)&ProfilingTableDecorator::m_glConvolutionParameterf_profiling;
+if(this->m_ptr_glBindBufferBaseEXT)this->m_ptr_glBindBufferBaseEXT = (FunctionTable::MEMBERPFNGLBINDBUFFERBASEEXTPROC)&ProfilingTableDecorator::m_glBindBufferBaseEXT_profiling;
+if(this->m_ptr_glTexCoord2xvOES)this->m_ptr_glTexCoord2xvOES = (FunctionTable::MEMBERPFNGLTEXCOORD2XVOESPROC)&ProfilingTableDecorator::m_glTexCoord2xvOES_profiling;
+if(this->m_ptr_glGetQueryBufferObjectui64v)this->m_ptr_glGetQueryBufferObjectui64v = (FunctionTable::MEMBERPFNGLGETQUERYBUFFEROBJECTUI64VPROC)&ProfilingTableDecorator::m_glGetQueryBufferObjectui64v_profiling;
+if(this->m_ptr_glSetMultisamplefvAMD)this->m_ptr_glSetMultisamplefvAMD = (FunctionTable::MEMBERPFNGLSETMULTISAMPLEFVAMDPROC)&ProfilingTableDecorator::m_glSetMultisamplefvAMD_profiling;
+if(this->m_ptr_glPathColorGenNV)this->m_ptr_glPathColorGenNV = (FunctionTable::MEMBERPFNGLPATHCOLORGENNVPROC)&ProfilingTableDecorator::m_glPathColorGenNV_profiling;
+if(this->m_ptr_glVertexAttrib3sARB)this->m_ptr_glVertexAttrib3sARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3SARBPROC)&ProfilingTableDecorator::m_glVertexAttrib3sARB_profiling;
+if(this->m_ptr_glVertexAttrib4ivARB)this->m_ptr_glVertexAttrib4ivARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4IVARBPROC)&ProfilingTableDecorator::m_glVertexAttrib4ivARB_profiling;
+if(this->m_ptr_glGenTransformFeedbacks)this->m_ptr_glGenTransformFeedbacks = (FunctionTable::MEMBERPFNGLGENTRANSFORMFEEDBACKSPROC)&ProfilingTableDecorator::m_glGenTransformFeedbacks_profiling;
+if(this->m_ptr_glGetVertexAttribIuiv)this->m_ptr_glGetVertexAttribIuiv = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBIUIVPROC)&ProfilingTableDecorator::m_glGetVertexAttribIuiv_profiling;
+if(this->m_ptr_glPixelTransformParameterfEXT)this->m_ptr_glPixelTransformParameterfEXT = (FunctionTable::MEMBERPFNGLPIXELTRANSFORMPARAMETERFEXTPROC)&ProfilingTableDecorator::m_glPixelTransformParameterfEXT_profiling;
+if(this->m_ptr_glGetTexParameterIuivEXT)this->m_ptr_glGetTexParameterIuivEXT = (FunctionTable::MEMBERPFNGLGETTEXPARAMETERIUIVEXTPROC)&ProfilingTableDecorator::m_glGetTexParameterIuivEXT_profiling;
+if(this->m_ptr_glGetObjectParameterivARB)this->m_ptr_glGetObjectParameterivARB = (FunctionTable::MEMBERPFNGLGETOBJECTPARAMETERIVARBPROC)&ProfilingTableDecorator::m_glGetObjectParameterivARB_profiling;
+if(this->m_ptr_glVertexArraySecondaryColorOffsetEXT)this->m_ptr_glVertexArraySecondaryColorOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYSECONDARYCOLOROFFSETEXTPROC)&ProfilingTableDecorator::m_glVertexArraySecondaryColorOffsetEXT_profiling;
+if(this->m_ptr_glWindowPos2fARB)this->m_ptr_glWindowPos2fARB = (FunctionTable::MEMBERPFNGLWINDOWPOS2FARBPROC)&ProfilingTableDecorator::m_glWindowPos2fARB_profiling;
+if(this->m_ptr_glCompressedTexSubImage2D)this->m_ptr_glCompressedTexSubImage2D = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXSUBIMAGE2DPROC)&ProfilingTableDecorator::m_glCompressedTexSubImage2D_profiling;
+if(this->m_ptr_glCompressedTexSubImage3DARB)this->m_ptr_glCompressedTexSubImage3DARB = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXSUBIMAGE3DARBPROC)&ProfilingTableDecorator::m_glCompressedTexSubImage3DARB_profiling;
+if(this->m_ptr_glProgramBinary)this->m_ptr_glProgramBinary = (FunctionTable::MEMBERPFNGLPROGRAMBINARYPROC)&ProfilingTableDecorator::m_glProgramBinary_profiling;
+if(this->m_ptr_glPresentFrameKeyedNV)this->m_ptr_glPresentFrameKeyedNV = (FunctionTable::MEMBERPFNGLPRESENTFRAMEKEYEDNVPROC)&ProfilingTableDecorator::m_glPresentFrameKeyedNV_profiling;
+if(this->m_ptr_glVertexAttribI4bv)this->m_ptr_glVertexAttribI4bv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4BVPROC)&ProfilingTableDecorator::m_glVertexAttribI4bv_profiling;
+if(this->m_ptr_glPathCoverDepthFuncNV)this->m_ptr_glPathCoverDepthFuncNV = (FunctionTable::MEMBERPFNGLPATHCOVERDEPTHFUNCNVPROC)&ProfilingTableDecorator::m_glPathCoverDepthFuncNV_profiling;
+if(this->m_ptr_glTransformFeedbackStreamAttribsNV)this->m_ptr_glTransformFeedbackStreamAttribsNV = (FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKSTREAMATTRIBSNVPROC)&ProfilingTableDecorator::m_glTransformFeedbackStreamAttribsNV_profiling;
+if(this->m_ptr_glSecondaryColor3usEXT)this->m_ptr_glSecondaryColor3usEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3USEXTPROC)&ProfilingTableDecorator::m_glSecondaryColor3usEXT_profiling;
+if(this->m_ptr_glCopyColorTableSGI)this->m_ptr_glCopyColorTableSGI = (FunctionTable::MEMBERPFNGLCOPYCOLORTABLESGIPROC)&ProfilingTableDecorator::m_glCopyColorTableSGI_profiling;
+if(this->m_ptr_glProgramEnvParameter4fvARB)this->m_ptr_glProgramEnvParameter4fvARB = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETER4FVARBPROC)&ProfilingTableDecorator::m_glProgramEnvParameter4fvARB_profiling;
+if(this->m_ptr_glMultiTexCoord4sARB)this->m_ptr_glMultiTexCoord4sARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4SARBPROC)&ProfilingTableDecorator::m_glMultiTexCoord4sARB_profiling;
+if(this->m_ptr_glGetVertexArrayIndexed64iv)this->m_ptr_glGetVertexArrayIndexed64iv = (FunctionTable::MEMBERPFNGLGETVERTEXARRAYINDEXED64IVPROC)&ProfilingTableDecorator::m_glGetVertexArrayIndexed64iv_profiling;
+if(this->m_ptr_glMatrixMultTranspose3x3fNV)this->m_ptr_glMatrixMultTranspose3x3fNV = (FunctionTable::MEMBERPFNGLMATRIXMULTTRANSPOSE3X3FNVPROC)&ProfilingTableDecorator::m_glMatrixMultTranspose3x3fNV_profiling;
+if(this->m_ptr_glTexParameterIiv)this->m_ptr_glTexParameterIiv = (FunctionTable::MEMBERPFNGLTEXPARAMETERIIVPROC)&ProfilingTableDecorator::m_glTexParameterIiv_profiling;
+if(this->m_ptr_glVertexArrayAttribFormat)this->m_ptr_glVertexArrayAttribFormat = (FunctionTable::MEMBERPFNGLVERTEXARRAYATTRIBFORMATPROC)&ProfilingTableDecorator::m_glVertexArrayAttribFormat_profiling;
+if(this->m_ptr_glEndTransformFeedback)this->m_ptr_glEndTransformFeedback = (FunctionTable::MEMBERPFNGLENDTRANSFORMFEEDBACKPROC)&ProfilingTableDecorator::m_glEndTransformFeedback_profiling;
+if(this->m_ptr_glDrawCommandsStatesAddressNV)this->m_ptr_glDrawCommandsStatesAddressNV = (FunctionTable::MEMBERPFNGLDRAWCOMMANDSSTATESADDRESSNVPROC)&ProfilingTableDecorator::m_glDrawCommandsStatesAddressNV_profiling;
+if(this->m_ptr_glUniform4ui64NV)this->m_ptr_glUniform4ui64NV = (FunctionTable::MEMBERPFNGLUNIFORM4UI64NVPROC)&ProfilingTableDecorator::m_glUniform4ui64NV_profiling;
+if(this->m_ptr_glMaterialiv)this->m_ptr_glMaterialiv = (FunctionTable::MEMBERPFNGLMATERIALIVPROC)&ProfilingTableDecorator::m_glMaterialiv_profiling;
+if(this->m_ptr_glTexImage2DMultisample)this->m_ptr_glTexImage2DMultisample = (FunctionTable::MEMBERPFNGLTEXIMAGE2DMULTISAMPLEPROC)&ProfilingTableDecorator::m_glTexImage2DMultisample_profiling;
+if(this->m_ptr_glBindTextureEXT)this->m_ptr_glBindTextureEXT = (FunctionTable::MEMBERPFNGLBINDTEXTUREEXTPROC)&ProfilingTableDecorator::m_glBindTextureEXT_profiling;
+if(this->m_ptr_glIsBuffer)this->m_ptr_glIsBuffer = (FunctionTable::MEMBERPFNGLISBUFFERPROC)&ProfilingTableDecorator::m_glIsBuffer_profiling;
+if(this->m_ptr_glVertexAttribI1iv)this->m_ptr_glVertexAttribI1iv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI1IVPROC)&ProfilingTableDecorator::m_glVertexAttribI1iv_profiling;
+if(this->m_ptr_glGetFinalCombinerInputParameterfvNV)this->m_ptr_glGetFinalCombinerInputParameterfvNV = (FunctionTable::MEMBERPFNGLGETFINALCOMBINERINPUTPARAMETERFVNVPROC)&ProfilingTableDecorator::m_glGetFinalCombinerInputParameterfvNV_profiling;
+if(this->m_ptr_glMultiTexCoord3bvOES)this->m_ptr_glMultiTexCoord3bvOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3BVOESPROC)&ProfilingTableDecorator::m_glMultiTexCoord3bvOES_profiling;
+if(this->m_ptr_glVertexAttribDivisor)this->m_ptr_glVertexAttribDivisor = (FunctionTable::MEMBERPFNGLVERTEXATTRIBDIVISORPROC)&ProfilingTableDecorator::m_glVertexAttribDivisor_profiling;
+if(this->m_ptr_glCopyBufferSubData)this->m_ptr_glCopyBufferSubData = (FunctionTable::MEMBERPFNGLCOPYBUFFERSUBDATAPROC)&ProfilingTableDecorator::m_glCopyBufferSubData_profiling;
+if(this->m_ptr_glBindTexGenParameterEXT)this->m_ptr_glBindTexGenParameterEXT = (FunctionTable::MEMBERPFNGLBINDTEXGENPARAMETEREXTPROC)&ProfilingTableDecorator::m_glBindTexGenParameterEXT_profiling;
+if(this->m_ptr_glNormalStream3bATI)this->m_ptr_glNormalStream3bATI = (FunctionTable::MEMBERPFNGLNORMALSTREAM3BATIPROC)&ProfilingTableDecorator::m_glNormalStream3bATI_profiling;
+if(this->m_ptr_glTextureImage2DEXT)this->m_ptr_glTextureImage2DEXT = (FunctionTable::MEMBERPFNGLTEXTUREIMAGE2DEXTPROC)&ProfilingTableDecorator::m_glTextureImage2DEXT_profiling;
+if(this->m_ptr_glGetColorTableParameteriv)this->m_ptr_glGetColorTableParameteriv = (FunctionTable::MEMBERPFNGLGETCOLORTABLEPARAMETERIVPROC)&ProfilingTableDecorator::m_glGetColorTableParameteriv_profiling;
+if(this->m_ptr_glActiveTextureARB)this->m_ptr_glActiveTextureARB = (FunctionTable::MEMBERPFNGLACTIVETEXTUREARBPROC)&ProfilingTableDecorator::m_glActiveTextureARB_profiling;
+if(this->m_ptr_glTexCoord4xOES)this->m_ptr_glTexCoord4xOES = (FunctionTable::MEMBERPFNGLTEXCOORD4XOESPROC)&ProfilingTableDecorator::m_glTexCoord4xOES_profiling;
+if(this->m_ptr_glSecondaryColor3fvEXT)this->m_ptr_glSecondaryColor3fvEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3FVEXTPROC)&ProfilingTableDecorator::m_glSecondaryColor3fvEXT_profiling;
+if(this->m_ptr_glUniformMatrix4x2fv)this->m_ptr_glUniformMatrix4x2fv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX4X2FVPROC)&ProfilingTableDecorator::m_glUniformMatrix4x2fv_profiling;
+if(this->m_ptr_glStartInstrumentsSGIX)this->m_ptr_glStartInstrumentsSGIX = (FunctionTable::MEMBERPFNGLSTARTINSTRUMENTSSGIXPROC)&ProfilingTableDecorator::m_glStartInstrumentsSGIX_profiling;
+if(this->m_ptr_glProgramNamedParameter4fvNV)this->m_ptr_glProgramNamedParameter4fvNV = (FunctionTable::MEMBERPFNGLPROGRAMNAMEDPARAMETER4FVNVPROC)&ProfilingTableDecorator::m_glProgramNamedParameter4fvNV_profiling;
+if(this->m_ptr_glEndVideoCaptureNV)this->m_ptr_glEndVideoCaptureNV = (FunctionTable::MEMBERPFNGLENDVIDEOCAPTURENVPROC)&ProfilingTableDecorator::m_glEndVideoCaptureNV_profiling;
+if(this->m_ptr_glGenLists)this->m_ptr_glGenLists = (FunctionTable::MEMBERPFNGLGENLISTSPROC)&ProfilingTableDecorator::m_glGenLists_profiling;
+if(this->m_ptr_glUniform1fARB)this->m_ptr_glUniform1fARB = (FunctionTable::MEMBERPFNGLUNIFORM1FARBPROC)&ProfilingTableDecorator::m_glUniform1fARB_profiling;
+if(this->m_ptr_glNamedFramebufferTexture1DEXT)this->m_ptr_glNamedFramebufferTexture1DEXT = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTURE1DEXTPROC)&ProfilingTableDecorator::m_glNamedFramebufferTexture1DEXT_profiling;
+if(this->m_ptr_glMapBufferRange)this->m_ptr_glMapBufferRange = (FunctionTable::MEMBERPFNGLMAPBUFFERRANGEPROC)&ProfilingTableDecorator::m_glMapBufferRange_profiling;
+if(this->m_ptr_glMultiDrawElementsIndirectCountARB)this->m_ptr_glMultiDrawElementsIndirectCountARB = (FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSINDIRECTCOUNTARBPROC)&ProfilingTableDecorator::m_glMultiDrawElementsIndirectCountARB_profiling;
+if(this->m_ptr_glProgramUniformMatrix4x2fv)this->m_ptr_glProgramUniformMatrix4x2fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X2FVPROC)&ProfilingTableDecorator::m_glProgramUniformMatrix4x2fv_profiling;
+if(this->m_ptr_glGetTextureParameterIivEXT)this->m_ptr_glGetTextureParameterIivEXT = (FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERIIVEXTPROC)&ProfilingTableDecorator::m_glGetTextureParameterIivEXT_profiling;
+if(this->m_ptr_glMultiTexCoord3hNV)this->m_ptr_glMultiTexCoord3hNV = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3HNVPROC)&ProfilingTableDecorator::m_glMultiTexCoord3hNV_profiling;
+if(this->m_ptr_glNamedProgramLocalParametersI4uivEXT)this->m_ptr_glNamedProgramLocalParametersI4uivEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERSI4UIVEXTPROC)&ProfilingTableDecorator::m_glNamedProgramLocalParametersI4uivEXT_profiling;
+if(this->m_ptr_glEndList)this->m_ptr_glEndList = (FunctionTable::MEMBERPFNGLENDLISTPROC)&ProfilingTableDecorator::m_glEndList_profiling;
+if(this->m_ptr_glTexCoord2fColor4fNormal3fVertex3fSUN)this->m_ptr_glTexCoord2fColor4fNormal3fVertex3fSUN = (FunctionTable::MEMBERPFNGLTEXCOORD2FCOLOR4FNORMAL3FVERTEX3FSUNPROC)&ProfilingTableDecorator::m_glTexCoord2fColor4fNormal3fVertex3fSUN_profiling;
+if(this->m_ptr_glGenTransformFeedbacksNV)this->m_ptr_glGenTransformFeedbacksNV = (FunctionTable::MEMBERPFNGLGENTRANSFORMFEEDBACKSNVPROC)&ProfilingTableDecorator::m_glGenTransformFeedbacksNV_profiling;
+if(this->m_ptr_glEdgeFlagv)this->m_ptr_glEdgeFlagv = (FunctionTable::MEMBERPFNGLEDGEFLAGVPROC)&ProfilingTableDecorator::m_glEdgeFlagv_profiling;
+if(this->m_ptr_glVertexAttribI2iv)this->m_ptr_glVertexAttribI2iv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI2IVPROC)&ProfilingTableDecorator::m_glVertexAttribI2iv_profiling;
+if(this->m_ptr_glCopyMultiTexImage2DEXT)this->m_ptr_glCopyMultiTexImage2DEXT = (FunctionTable::MEMBERPFNGLCOPYMULTITEXIMAGE2DEXTPROC)&ProfilingTableDecorator::m_glCopyMultiTexImage2DEXT_profiling;
+if(this->m_ptr_glUniformMatrix3x2dv)this->m_ptr_glUniformMatrix3x2dv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX3X2DVPROC)&ProfilingTableDecorator::m_glUniformMatrix3x2dv_profiling;
+if(this->m_ptr_glTexImage3DMultisampleCoverageNV)this->m_ptr_glTexImage3DMultisampleCoverageNV = (FunctionTable::MEMBERPFNGLTEXIMAGE3DMULTISAMPLECOVERAGENVPROC)&ProfilingTableDecorator::m_glTexImage3DMultisampleCoverageNV_profiling;
+if(this->m_ptr_glGetShaderPrecisionFormat)this->m_ptr_glGetShaderPrecisionFormat = (FunctionTable::MEMBERPFNGLGETSHADERPRECISIONFORMATPROC)&ProfilingTableDecorator::m_glGetShaderPrecisionFormat_profiling;
+if(this->m_ptr_glTexSubImage4DSGIS)this->m_ptr_glTexSubImage4DSGIS = (FunctionTable::MEMBERPFNGLTEXSUBIMAGE4DSGISPROC)&ProfilingTableDecorator::m_glTexSubImage4DSGIS_profiling;
+if(this->m_ptr_glRasterSamplesEXT)this->m_ptr_glRasterSamplesEXT = (FunctionTable::MEMBERPFNGLRASTERSAMPLESEXTPROC)&ProfilingTableDecorator::m_glRasterSamplesEXT_profiling;
+if(this->m_ptr_glTextureView)this->m_ptr_glTextureView = (FunctionTable::MEMBERPFNGLTEXTUREVIEWPROC)&ProfilingTableDecorator::m_glTextureView_profiling;
+if(this->m_ptr_glEvalMapsNV)this->m_ptr_glEvalMapsNV = (FunctionTable::MEMBERPFNGLEVALMAPSNVPROC)&ProfilingTableDecorator::m_glEvalMapsNV_profiling;
+if(this->m_ptr_glGetFragDataLocationEXT)this->m_ptr_glGetFragDataLocationEXT = (FunctionTable::MEMBERPFNGLGETFRAGDATALOCATIONEXTPROC)&ProfilingTableDecorator::m_glGetFragDataLocationEXT_profiling;
+if(this->m_ptr_glGetCompressedMultiTexImageEXT)this->m_ptr_glGetCompressedMultiTexImageEXT = (FunctionTable::MEMBERPFNGLGETCOMPRESSEDMULTITEXIMAGEEXTPROC)&ProfilingTableDecorator::m_glGetCompressedMultiTexImageEXT_profiling;
+if(this->m_ptr_glIndexMask)this->m_ptr_glIndexMask = (FunctionTable::MEMBERPFNGLINDEXMASKPROC)&ProfilingTableDecorator::m_glIndexMask_profiling;
+if(this->m_ptr_glPushClientAttrib)this->m_ptr_glPushClientAttrib = (FunctionTable::MEMBERPFNGLPUSHCLIENTATTRIBPROC)&ProfilingTableDecorator::m_glPushClientAttrib_profiling;
+if(this->m_ptr_glShaderSource)this->m_ptr_glShaderSource = (FunctionTable::MEMBERPFNGLSHADERSOURCEPROC)&ProfilingTableDecorator::m_glShaderSource_profiling;
+if(this->m_ptr_glDispatchComputeGroupSizeARB)this->m_ptr_glDispatchComputeGroupSizeARB = (FunctionTable::MEMBERPFNGLDISPATCHCOMPUTEGROUPSIZEARBPROC)&ProfilingTableDecorator::m_glDispatchComputeGroupSizeARB_profiling;
+if(this->m_ptr_glGetnPixelMapfv)this->m_ptr_glGetnPixelMapfv = (FunctionTable::MEMBERPFNGLGETNPIXELMAPFVPROC)&ProfilingTableDecorator::m_glGetnPixelMapfv_profiling;
+if(this->m_ptr_glTexCoordP2uiv)this->m_ptr_glTexCoordP2uiv = (FunctionTable::MEMBERPFNGLTEXCOORDP2UIVPROC)&ProfilingTableDecorator::m_glTexCoordP2uiv_profiling;
+if(this->m_ptr_glUniform2f)this->m_ptr_glUniform2f = (FunctionTable::MEMBERPFNGLUNIFORM2FPROC)&ProfilingTableDecorator::m_glUniform2f_profiling;
+if(this->m_ptr_glGetNamedBufferParameteri64v)this->m_ptr_glGetNamedBufferParameteri64v = (FunctionTable::MEMBERPFNGLGETNAMEDBUFFERPARAMETERI64VPROC)&ProfilingTableDecorator::m_glGetNamedBufferParameteri64v_profiling;
+if(this->m_ptr_glCommandListSegmentsNV)this->m_ptr_glCommandListSegmentsNV = (FunctionTable::MEMBERPFNGLCOMMANDLISTSEGMENTSNVPROC)&ProfilingTableDecorator::m_glCommandListSegmentsNV_profiling;
+if(this->m_ptr_glTextureParameterIivEXT)this->m_ptr_glTextureParameterIivEXT = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIIVEXTPROC)&ProfilingTableDecorator::m_glTextureParameterIivEXT_profiling;
+if(this->m_ptr_glMultiTexParameterfvEXT)this->m_ptr_glMultiTexParameterfvEXT = (FunctionTable::MEMBERPFNGLMULTITEXPARAMETERFVEXTPROC)&ProfilingTableDecorator::m_glMultiTexParameterfvEXT_profiling;
+if(this->m_ptr_glProgramUniform2ui64ARB)this->m_ptr_glProgramUniform2ui64ARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UI64ARBPROC)&ProfilingTableDecorator::m_glProgramUniform2ui64ARB_profiling;
+if(this->m_ptr_glVertex4d)this->m_ptr_glVertex4d = (FunctionTable::MEMBERPFNGLVERTEX4DPROC)&ProfilingTableDecorator::m_glVertex4d_profiling;
+if(this->m_ptr_glNewObjectBufferATI)this->m_ptr_glNewObjectBufferATI = (FunctionTable::MEMBERPFNGLNEWOBJECTBUFFERATIPROC)&ProfilingTableDecorator::m_glNewObjectBufferATI_profiling;
+if(this->m_ptr_glViewportSwizzleNV)this->m_ptr_glViewportSwizzleNV = (FunctionTable::MEMBERPFNGLVIEWPORTSWIZZLENVPROC)&ProfilingTableDecorator::m_glViewportSwizzleNV_profiling;
+if(this->m_ptr_glBufferData)this->m_ptr_glBufferData = (FunctionTable::MEMBERPFNGLBUFFERDATAPROC)&ProfilingTableDecorator::m_glBufferData_profiling;
+if(this->m_ptr_glTextureImage1DEXT)this->m_ptr_glTextureImage1DEXT = (FunctionTable::MEMBERPFNGLTEXTUREIMAGE1DEXTPROC)&ProfilingTableDecorator::m_glTextureImage1DEXT_profiling;
+if(this->m_ptr_glGetTexParameterIiv)this->m_ptr_glGetTexParameterIiv = (FunctionTable::MEMBERPFNGLGETTEXPARAMETERIIVPROC)&ProfilingTableDecorator::m_glGetTexParameterIiv_profiling;
+if(this->m_ptr_glCopyTexSubImage1DEXT)this->m_ptr_glCopyTexSubImage1DEXT = (FunctionTable::MEMBERPFNGLCOPYTEXSUBIMAGE1DEXTPROC)&ProfilingTableDecorator::m_glCopyTexSubImage1DEXT_profiling;
+if(this->m_ptr_glVertex4f)this->m_ptr_glVertex4f = (FunctionTable::MEMBERPFNGLVERTEX4FPROC)&ProfilingTableDecorator::m_glVertex4f_profiling;
+if(this->m_ptr_glUniformMatrix3fvARB)this->m_ptr_glUniformMatrix3fvARB = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX3FVARBPROC)&ProfilingTableDecorator::m_glUniformMatrix3fvARB_profiling;
+if(this->m_ptr_glTexCoordP1ui)this->m_ptr_glTexCoordP1ui = (FunctionTable::MEMBERPFNGLTEXCOORDP1UIPROC)&ProfilingTableDecorator::m_glTexCoordP1ui_profiling;
+if(this->m_ptr_glPointParameterfvEXT)this->m_ptr_glPointParameterfvEXT = (FunctionTable::MEMBERPFNGLPOINTPARAMETERFVEXTPROC)&ProfilingTableDecorator::m_glPointParameterfvEXT_profiling;
+if(this->m_ptr_glUniform4fARB)this->m_ptr_glUniform4fARB = (FunctionTable::MEMBERPFNGLUNIFORM4FARBPROC)&ProfilingTableDecorator::m_glUniform4fARB_profiling;
+if(this->m_ptr_glCopyTextureSubImage3D)this->m_ptr_glCopyTextureSubImage3D = (FunctionTable::MEMBERPFNGLCOPYTEXTURESUBIMAGE3DPROC)&ProfilingTableDecorator::m_glCopyTextureSubImage3D_profiling;
+if(this->m_ptr_glMultiTexCoord2fv)this->m_ptr_glMultiTexCoord2fv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2FVPROC)&ProfilingTableDecorator::m_glMultiTexCoord2fv_profiling;
+if(this->m_ptr_glMultiTexEnvfvEXT)this->m_ptr_glMultiTexEnvfvEXT = (FunctionTable::MEMBERPFNGLMULTITEXENVFVEXTPROC)&ProfilingTableDecorator::m_glMultiTexEnvfvEXT_profiling;
+if(this->m_ptr_glNormalP3ui)this->m_ptr_glNormalP3ui = (FunctionTable::MEMBERPFNGLNORMALP3UIPROC)&ProfilingTableDecorator::m_glNormalP3ui_profiling;
+if(this->m_ptr_glDrawRangeElementArrayATI)this->m_ptr_glDrawRangeElementArrayATI = (FunctionTable::MEMBERPFNGLDRAWRANGEELEMENTARRAYATIPROC)&ProfilingTableDecorator::m_glDrawRangeElementArrayATI_profiling;
+if(this->m_ptr_glVertexAttribI1i)this->m_ptr_glVertexAttribI1i = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI1IPROC)&ProfilingTableDecorator::m_glVertexAttribI1i_profiling;
+if(this->m_ptr_glDrawArraysInstancedARB)this->m_ptr_glDrawArraysInstancedARB = (FunctionTable::MEMBERPFNGLDRAWARRAYSINSTANCEDARBPROC)&ProfilingTableDecorator::m_glDrawArraysInstancedARB_profiling;
+if(this->m_ptr_glEnableVertexAttribAPPLE)this->m_ptr_glEnableVertexAttribAPPLE = (FunctionTable::MEMBERPFNGLENABLEVERTEXATTRIBAPPLEPROC)&ProfilingTableDecorator::m_glEnableVertexAttribAPPLE_profiling;
+if(this->m_ptr_glGetDebugMessageLogARB)this->m_ptr_glGetDebugMessageLogARB = (FunctionTable::MEMBERPFNGLGETDEBUGMESSAGELOGARBPROC)&ProfilingTableDecorator::m_glGetDebugMessageLogARB_profiling;
+if(this->m_ptr_glGetPathTexGenfvNV)this->m_ptr_glGetPathTexGenfvNV = (FunctionTable::MEMBERPFNGLGETPATHTEXGENFVNVPROC)&ProfilingTableDecorator::m_glGetPathTexGenfvNV_profiling;
+if(this->m_ptr_glNamedProgramLocalParameters4fvEXT)this->m_ptr_glNamedProgramLocalParameters4fvEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERS4FVEXTPROC)&ProfilingTableDecorator::m_glNamedProgramLocalParameters4fvEXT_profiling;
+if(this->m_ptr_glVertexStream3fvATI)this->m_ptr_glVertexStream3fvATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM3FVATIPROC)&ProfilingTableDecorator::m_glVertexStream3fvATI_profiling;
+if(this->m_ptr_glFramebufferTexture3D)this->m_ptr_glFramebufferTexture3D = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURE3DPROC)&ProfilingTableDecorator::m_glFramebufferTexture3D_profiling;
+if(this->m_ptr_glCompressedTextureSubImage2DEXT)this->m_ptr_glCompressedTextureSubImage2DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTURESUBIMAGE2DEXTPROC)&ProfilingTableDecorator::m_glCompressedTextureSubImage2DEXT_profiling;
+if(this->m_ptr_glWindowPos3dv)this->m_ptr_glWindowPos3dv = (FunctionTable::MEMBERPFNGLWINDOWPOS3DVPROC)&ProfilingTableDecorator::m_glWindowPos3dv_profiling;
+if(this->m_ptr_glCopyConvolutionFilter2D)this->m_ptr_glCopyConvolutionFilter2D = (FunctionTable::MEMBERPFNGLCOPYCONVOLUTIONFILTER2DPROC)&ProfilingTableDecorator::m_glCopyConvolutionFilter2D_profiling;
+if(this->m_ptr_glReadInstrumentsSGIX)this->m_ptr_glReadInstrumentsSGIX = (FunctionTable::MEMBERPFNGLREADINSTRUMENTSSGIXPROC)&ProfilingTableDecorator::m_glReadInstrumentsSGIX_profiling;
+if(this->m_ptr_glSamplerParameterfv)this->m_ptr_glSamplerParameterfv = (FunctionTable::MEMBERPFNGLSAMPLERPARAMETERFVPROC)&ProfilingTableDecorator::m_glSamplerParameterfv_profiling;
+if(this->m_ptr_glBindBufferARB)this->m_ptr_glBindBufferARB = (FunctionTable::MEMBERPFNGLBINDBUFFERARBPROC)&ProfilingTableDecorator::m_glBindBufferARB_profiling;
+if(this->m_ptr_glVertexAttrib1sNV)this->m_ptr_glVertexAttrib1sNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1SNVPROC)&ProfilingTableDecorator::m_glVertexAttrib1sNV_profiling;
+if(this->m_ptr_glGetMaterialiv)this->m_ptr_glGetMaterialiv = (FunctionTable::MEMBERPFNGLGETMATERIALIVPROC)&ProfilingTableDecorator::m_glGetMaterialiv_profiling;
+if(this->m_ptr_glUniform1fv)this->m_ptr_glUniform1fv = (FunctionTable::MEMBERPFNGLUNIFORM1FVPROC)&ProfilingTableDecorator::m_glUniform1fv_profiling;
+if(this->m_ptr_glBeginOcclusionQueryNV)this->m_ptr_glBeginOcclusionQueryNV = (FunctionTable::MEMBERPFNGLBEGINOCCLUSIONQUERYNVPROC)&ProfilingTableDecorator::m_glBeginOcclusionQueryNV_profiling;
+if(this->m_ptr_glGenFencesAPPLE)this->m_ptr_glGenFencesAPPLE = (FunctionTable::MEMBERPFNGLGENFENCESAPPLEPROC)&ProfilingTableDecorator::m_glGenFencesAPPLE_profiling;
+if(this->m_ptr_glScissorIndexedv)this->m_ptr_glScissorIndexedv = (FunctionTable::MEMBERPFNGLSCISSORINDEXEDVPROC)&ProfilingTableDecorator::m_glScissorIndexedv_profiling;
+if(this->m_ptr_glDisableVariantClientStateEXT)this->m_ptr_glDisableVariantClientStateEXT = (FunctionTable::MEMBERPFNGLDISABLEVARIANTCLIENTSTATEEXTPROC)&ProfilingTableDecorator::m_glDisableVariantClientStateEXT_profiling;
+if(this->m_ptr_glMinmaxEXT)this->m_ptr_glMinmaxEXT = (FunctionTable::MEMBERPFNGLMINMAXEXTPROC)&ProfilingTableDecorator::m_glMinmaxEXT_profiling;
+if(this->m_ptr_glNormalPointervINTEL)this->m_ptr_glNormalPointervINTEL = (FunctionTable::MEMBERPFNGLNORMALPOINTERVINTELPROC)&ProfilingTableDecorator::m_glNormalPointervINTEL_profiling;
+if(this->m_ptr_glNormal3s)this->m_ptr_glNormal3s = (FunctionTable::MEMBERPFNGLNORMAL3SPROC)&ProfilingTableDecorator::m_glNormal3s_profiling;
+if(this->m_ptr_glGetnPixelMapuiv)this->m_ptr_glGetnPixelMapuiv = (FunctionTable::MEMBERPFNGLGETNPIXELMAPUIVPROC)&ProfilingTableDecorator::m_glGetnPixelMapuiv_profiling;
+if(this->m_ptr_glNormalStream3bvATI)this->m_ptr_glNormalStream3bvATI = (FunctionTable::MEMBERPFNGLNORMALSTREAM3BVATIPROC)&ProfilingTableDecorator::m_glNormalStream3bvATI_profiling;
+if(this->m_ptr_glGetObjectParameterivAPPLE)this->m_ptr_glGetObjectParameterivAPPLE = (FunctionTable::MEMBERPFNGLGETOBJECTPARAMETERIVAPPLEPROC)&ProfilingTableDecorator::m_glGetObjectParameterivAPPLE_profiling;
+if(this->m_ptr_glNormal3i)this->m_ptr_glNormal3i = (FunctionTable::MEMBERPFNGLNORMAL3IPROC)&ProfilingTableDecorator::m_glNormal3i_profiling;
+if(this->m_ptr_glUniform1ivARB)this->m_ptr_glUniform1ivARB = (FunctionTable::MEMBERPFNGLUNIFORM1IVARBPROC)&ProfilingTableDecorator::m_glUniform1ivARB_profiling;
+if(this->m_ptr_glNormal3d)this->m_ptr_glNormal3d = (FunctionTable::MEMBERPFNGLNORMAL3DPROC)&ProfilingTableDecorator::m_glNormal3d_profiling;
+if(this->m_ptr_glUpdateObjectBufferATI)this->m_ptr_glUpdateObjectBufferATI = (FunctionTable::MEMBERPFNGLUPDATEOBJECTBUFFERATIPROC)&ProfilingTableDecorator::m_glUpdateObjectBufferATI_profiling;
+if(this->m_ptr_glNormal3b)this->m_ptr_glNormal3b = (FunctionTable::MEMBERPFNGLNORMAL3BPROC)&ProfilingTableDecorator::m_glNormal3b_profiling;
+if(this->m_ptr_glGetUniformBufferSizeEXT)this->m_ptr_glGetUniformBufferSizeEXT = (FunctionTable::MEMBERPFNGLGETUNIFORMBUFFERSIZEEXTPROC)&ProfilingTableDecorator::m_glGetUniformBufferSizeEXT_profiling;
+if(this->m_ptr_glMultiTexCoord4dv)this->m_ptr_glMultiTexCoord4dv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4DVPROC)&ProfilingTableDecorator::m_glMultiTexCoord4dv_profiling;
+if(this->m_ptr_glProgramUniform3i64ARB)this->m_ptr_glProgramUniform3i64ARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3I64ARBPROC)&ProfilingTableDecorator::m_glProgramUniform3i64ARB_profiling;
+if(this->m_ptr_glVertexAttrib2d)this->m_ptr_glVertexAttrib2d = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2DPROC)&ProfilingTableDecorator::m_glVertexAttrib2d_profiling;
+if(this->m_ptr_glVertexAttrib2f)this->m_ptr_glVertexAttrib2f = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2FPROC)&ProfilingTableDecorator::m_glVertexAttrib2f_profiling;
+if(this->m_ptr_glMultiDrawElementsEXT)this->m_ptr_glMultiDrawElementsEXT = (FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSEXTPROC)&ProfilingTableDecorator::m_glMultiDrawElementsEXT_profiling;
+if(this->m_ptr_glVertexAttrib3dv)this->m_ptr_glVertexAttrib3dv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3DVPROC)&ProfilingTableDecorator::m_glVertexAttrib3dv_profiling;
+if(this->m_ptr_glMultiTexCoord2bOES)this->m_ptr_glMultiTexCoord2bOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2BOESPROC)&ProfilingTableDecorator::m_glMultiTexCoord2bOES_profiling;
+if(this->m_ptr_glVertexAttrib2s)this->m_ptr_glVertexAttrib2s = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2SPROC)&ProfilingTableDecorator::m_glVertexAttrib2s_profiling;
+if(this->m_ptr_glTexImage3DMultisample)this->m_ptr_glTexImage3DMultisample = (FunctionTable::MEMBERPFNGLTEXIMAGE3DMULTISAMPLEPROC)&ProfilingTableDecorator::m_glTexImage3DMultisample_profiling;
+if(this->m_ptr_glGetUniformBlockIndex)this->m_ptr_glGetUniformBlockIndex = (FunctionTable::MEMBERPFNGLGETUNIFORMBLOCKINDEXPROC)&ProfilingTableDecorator::m_glGetUniformBlockIndex_profiling;
+if(this->m_ptr_glFrontFace)this->m_ptr_glFrontFace = (FunctionTable::MEMBERPFNGLFRONTFACEPROC)&ProfilingTableDecorator::m_glFrontFace_profiling;
+if(this->m_ptr_glEvalCoord1xOES)this->m_ptr_glEvalCoord1xOES = (FunctionTable::MEMBERPFNGLEVALCOORD1XOESPROC)&ProfilingTableDecorator::m_glEvalCoord1xOES_profiling;
+if(this->m_ptr_glDrawArraysInstancedBaseInstance)this->m_ptr_glDrawArraysInstancedBaseInstance = (FunctionTable::MEMBERPFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC)&ProfilingTableDecorator::m_glDrawArraysInstancedBaseInstance_profiling;
+if(this->m_ptr_glIsPointInStrokePathNV)this->m_ptr_glIsPointInStrokePathNV = (FunctionTable::MEMBERPFNGLISPOINTINSTROKEPATHNVPROC)&ProfilingTableDecorator::m_glIsPointInStrokePathNV_profiling;
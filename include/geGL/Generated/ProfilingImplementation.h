@@ -0,0 +1,5715 @@
+static char const*m_profilingFunctionName(size_t id){
+  static char const*const names[] = {
+    "glMultiDrawArraysIndirectBindlessCountNV",
+    "glTextureParameterfv",
+    "glGetListParameterivSGIX",
+    "glProgramUniform1i64ARB",
+    "glVertexArrayElementBuffer",
+    "glHintPGI",
+    "glStencilMaskSeparate",
+    "glGetFramebufferAttachmentParameterivEXT",
+    "glTextureStorage3DMultisample",
+    "glGetIntegerIndexedvEXT",
+    "glCopyTexImage1D",
+    "glVertexAttrib4usv",
+    "glTexRenderbufferNV",
+    "glVertexAttrib3hvNV",
+    "glProgramUniform4ui64ARB",
+    "glInstrumentsBufferSGIX",
+    "glIndexi",
+    "glMultiTexCoord2sARB",
+    "glProgramEnvParameter4fARB",
+    "glCompressedTexSubImage3D",
+    "glEvalCoord2d",
+    "glEvalCoord2f",
+    "glIndexd",
+    "glSecondaryColor3hvNV",
+    "glIndexf",
+    "glFrustumxOES",
+    "glTextureStorage3DEXT",
+    "glDrawCommandsStatesNV",
+    "glUniform4uiEXT",
+    "glProgramUniform3ui64ARB",
+    "glIndexs",
+    "glVertexArrayBindVertexBufferEXT",
+    "glConvolutionParameteriEXT",
+    "glColor4ubVertex2fSUN",
+    "glProgramUniform1ivEXT",
+    "glGetnMapfv",
+    "glTransformFeedbackBufferRange",
+    "glPathGlyphsNV",
+    "glSecondaryColor3fv",
+    "glGetCombinerInputParameterivNV",
+    "glEndPerfMonitorAMD",
+    "glPointParameterfvARB",
+    "glVertex2xOES",
+    "glDrawElementsInstancedBaseInstance",
+    "glMultTransposeMatrixdARB",
+    "glVertexAttribL4dEXT",
+    "glVertex4iv",
+    "glCoverStrokePathInstancedNV",
+    "glDeformSGIX",
+    "glUniform2ui64NV",
+    "glCopyPathNV",
+    "glVertexAttribP4ui",
+    "glVertexAttribL2d",
+    "glGetMultisamplefv",
+    "glCompressedMultiTexSubImage3DEXT",
+    "glVDPAURegisterOutputSurfaceNV",
+    "glMinSampleShading",
+    "glProgramUniform4fEXT",
+    "glCoverStrokePathNV",
+    "glTextureImage2DMultisampleNV",
+    "glVertex3bOES",
+    "glTessellationFactorAMD",
+    "glDebugMessageControl",
+    "glIsObjectBufferATI",
+    "glPopAttrib",
+    "glProgramUniform4iEXT",
+    "glVertexAttrib4ubNV",
+    "glColorMaterial",
+    "glVertexAttrib2svARB",
+    "glMinSampleShadingARB",
+    "glColor3b",
+    "glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN",
+    "glColor3f",
+    "glVDPAUGetSurfaceivNV",
+    "glColor3d",
+    "glGetnMapiv",
+    "glColor3i",
+    "glGetInternalformatSampleivNV",
+    "glVertexAttrib4ubv",
+    "glColor3s",
+    "glVertexAttribs4hvNV",
+    "glVertexAttrib4NubvARB",
+    "glMultiTexCoord3hvNV",
+    "glMatrixPushEXT",
+    "glProgramUniform2fEXT",
+    "glGetVertexArrayIndexediv",
+    "glBlitFramebuffer",
+    "glMultiTexCoordP2ui",
+    "glColorPointerListIBM",
+    "glVertexAttribL4d",
+    "glGetFragmentMaterialfvSGIX",
+    "glVertex2iv",
+    "glGetTexEnvxvOES",
+    "glUniformMatrix3dv",
+    "glGetVertexAttribLdvEXT",
+    "glTexCoordP3uiv",
+    "glDeformationMap3dSGIX",
+    "glResumeTransformFeedback",
+    "glInsertEventMarkerEXT",
+    "glTessellationModeAMD",
+    "glDrawCommandsAddressNV",
+    "glFogi",
+    "glGetTexParameterxvOES",
+    "glVertexPointer",
+    "glGetPerfMonitorCounterDataAMD",
+    "glFogf",
+    "glMultiTexCoord1d",
+    "glMultiTexCoord1f",
+    "glGetMultiTexParameterivEXT",
+    "glProgramUniformMatrix3x4fvEXT",
+    "glVertexAttribI2i",
+    "glMultiTexCoord1i",
+    "glUniform1ui64vARB",
+    "glLoadProgramNV",
+    "glWriteMaskEXT",
+    "glGetGraphicsResetStatus",
+    "glVertexAttrib1fv",
+    "glIsEnabled",
+    "glImageTransformParameterfvHP",
+    "glFramebufferTexture2D",
+    "glGetFragmentLightfvSGIX",
+    "glListParameterfSGIX",
+    "glTexCoord3sv",
+    "glNamedFramebufferRenderbufferEXT",
+    "glFragmentLightModelfSGIX",
+    "glIndexPointerEXT",
+    "glBlendEquationSeparateATI",
+    "glVertexArrayAttribIFormat",
+    "glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN",
+    "glReplacementCodeubvSUN",
+    "glGenFramebuffers",
+    "glPixelMapx",
+    "glTexSubImage3DEXT",
+    "glGetAttachedShaders",
+    "glGetPixelTexGenParameterfvSGIS",
+    "glReplacementCodeuiNormal3fVertex3fSUN",
+    "glGetDebugMessageLogAMD",
+    "glVertexStream4sATI",
+    "glVertexAttribs4dvNV",
+    "glGetnMapdvARB",
+    "glOrthofOES",
+    "glViewportArrayv",
+    "glDrawElementArrayATI",
+    "glGetPathColorGenfvNV",
+    "glWindowPos3iMESA",
+    "glMultiTexCoord2s",
+    "glVertex3dv",
+    "glVertexAttribI3uivEXT",
+    "glUniform3ui64ARB",
+    "glVertexAttrib2fvNV",
+    "glGetNamedBufferSubDataEXT",
+    "glConvolutionFilter2D",
+    "glMemoryBarrierByRegion",
+    "glVertexArrayBindingDivisor",
+    "glMatrixRotatedEXT",
+    "glTexCoord2sv",
+    "glIsProgramNV",
+    "glUniform2dv",
+    "glGetPixelMapuiv",
+    "glDepthBoundsEXT",
+    "glVertexAttrib4hvNV",
+    "glMultiTexParameteriEXT",
+    "glGetPointerv",
+    "glPathCommandsNV",
+    "glGetUniformfv",
+    "glGetUniformuiv",
+    "glDebugMessageInsertAMD",
+    "glFrustum",
+    "glVertexAttribL1ui64vNV",
+    "glClearColorxOES",
+    "glProgramUniformMatrix3fv",
+    "glSampleMaskIndexedNV",
+    "glCompileShaderIncludeARB",
+    "glGetArrayObjectfvATI",
+    "glVertexStream4svATI",
+    "glMultiTexCoord4iARB",
+    "glVariantfvEXT",
+    "glMatrixLoadfEXT",
+    "glLoadIdentityDeformationMapSGIX",
+    "glGetRenderbufferParameteriv",
+    "glProgramUniform3fEXT",
+    "glNamedRenderbufferStorage",
+    "glProgramPathFragmentInputGenNV",
+    "glFogCoordPointerListIBM",
+    "glFenceSync",
+    "glGetVertexAttribIivEXT",
+    "glFramebufferDrawBuffersEXT",
+    "glVertexAttribs4fvNV",
+    "glPauseTransformFeedbackNV",
+    "glGetQueryObjecti64vEXT",
+    "glVDPAUSurfaceAccessNV",
+    "glValidateProgramPipeline",
+    "glTexPageCommitmentARB",
+    "glWindowPos3dvARB",
+    "glStencilStrokePathInstancedNV",
+    "glFogfv",
+    "glGenQueriesARB",
+    "glProgramUniform2i64NV",
+    "glVertexP4ui",
+    "glVertexStream1ivATI",
+    "glProgramEnvParameterI4iNV",
+    "glGenVertexArraysAPPLE",
+    "glDrawTransformFeedbackInstanced",
+    "glStencilThenCoverStrokePathNV",
+    "glDeleteVertexArraysAPPLE",
+    "glGetNamedBufferParameterui64vNV",
+    "glQueryMatrixxOES",
+    "glSecondaryColor3usv",
+    "glTranslatexOES",
+    "glDrawTransformFeedback",
+    "glTexCoord2fColor4fNormal3fVertex3fvSUN",
+    "glVDPAURegisterVideoSurfaceNV",
+    "glGetTexParameterIuiv",
+    "glBindBufferBaseNV",
+    "glIndexPointer",
+    "glVertexAttrib4Nbv",
+    "glListParameteriSGIX",
+    "glBlendColorxOES",
+    "glUniformui64vNV",
+    "glIsSync",
+    "glGetTextureParameterivEXT",
+    "glFogCoordhvNV",
+    "glFramebufferTextureLayerEXT",
+    "glGetObjectPtrLabel",
+    "glTextureParameteri",
+    "glMultiTexCoord1fARB",
+    "glUniformMatrix2x3dv",
+    "glFramebufferDrawBufferEXT",
+    "glCopyColorSubTable",
+    "glVertexAttribL3d",
+    "glFragmentMaterialfvSGIX",
+    "glMatrixLoadTranspose3x3fNV",
+    "glDeleteNamesAMD",
+    "glDrawRangeElementsEXT",
+    "glOrtho",
+    "glProgramUniform1dvEXT",
+    "glColor4xOES",
+    "glTexImage4DSGIS",
+    "glProgramUniform1ui",
+    "glDeleteBuffersARB",
+    "glUnmapBufferARB",
+    "glCopyTexImage2D",
+    "glMaterialxOES",
+    "glProgramUniformMatrix2x4fvEXT",
+    "glTestObjectAPPLE",
+    "glRenderbufferStorageEXT",
+    "glVertexAttribL1ui64ARB",
+    "glEndFragmentShaderATI",
+    "glPathParameterivNV",
+    "glUniform4uiv",
+    "glFrameZoomSGIX",
+    "glSecondaryColor3fEXT",
+    "glVertexAttribL1dv",
+    "glNormalStream3svATI",
+    "glPathStencilFuncNV",
+    "glSetInvariantEXT",
+    "glGetTexBumpParameterivATI",
+    "glBlendEquationSeparateEXT",
+    "glEndOcclusionQueryNV",
+    "glScissorArrayv",
+    "glCallList",
+    "glMapTexture2DINTEL",
+    "glPixelTransferxOES",
+    "glDeleteRenderbuffersEXT",
+    "glTexCoord4fColor4fNormal3fVertex4fSUN",
+    "glProgramUniformMatrix4dvEXT",
+    "glGetnColorTable",
+    "glFramebufferTextureLayerARB",
+    "glVertexAttribL2dvEXT",
+    "glGetCombinerStageParameterfvNV",
+    "glMultiTexCoord1xvOES",
+    "glMapBuffer",
+    "glSecondaryColor3d",
+    "glSecondaryColor3f",
+    "glVertexAttribLFormat",
+    "glElementPointerAPPLE",
+    "glVertexStream1fATI",
+    "glCoverageModulationNV",
+    "glSecondaryColor3i",
+    "glDeleteSync",
+    "glGetProgramParameterfvNV",
+    "glMaxShaderCompilerThreadsARB",
+    "glUniformMatrix4x2dv",
+    "glVertexArrayVertexAttribLOffsetEXT",
+    "glSecondaryColor3s",
+    "glIsImageHandleResidentNV",
+    "glUniform3iv",
+    "glVertexAttribL3i64vNV",
+    "glPolygonMode",
+    "glConvolutionFilter1DEXT",
+    "glVertexAttrib1dvARB",
+    "glTextureSubImage2DEXT",
+    "glIsVertexArrayAPPLE",
+    "glUseProgram",
+    "glLineStipple",
+    "glMultiTexCoord4fvARB",
+    "glVideoCaptureNV",
+    "glVertexArrayVertexAttribLFormatEXT",
+    "glUniform3fvARB",
+    "glProgramUniformMatrix3x2fvEXT",
+    "glCopyTextureSubImage3DEXT",
+    "glMultiTexCoord2bvOES",
+    "glDeleteObjectARB",
+    "glTextureLightEXT",
+    "glMultiTexCoord3dARB",
+    "glNamedFramebufferTextureEXT",
+    "glTextureParameteriEXT",
+    "glEvalCoord2xvOES",
+    "glBindVideoCaptureStreamBufferNV",
+    "glTexImage2DMultisampleCoverageNV",
+    "glGetAttribLocationARB",
+    "glDeleteShader",
+    "glVertexAttrib1fARB",
+    "glTexCoord2fColor4ubVertex3fSUN",
+    "glTexCoord4fVertex4fSUN",
+    "glGetMapdv",
+    "glMapParameterfvNV",
+    "glTextureParameterIuiv",
+    "glTransformFeedbackAttribsNV",
+    "glFragmentLightfvSGIX",
+    "glWindowPos3sARB",
+    "glGetConvolutionParameterfv",
+    "glCopyTexSubImage3D",
+    "glVertexAttribI3i",
+    "glCreateShaderObjectARB",
+    "glVertexAttribFormat",
+    "glGetProgramivARB",
+    "glVertexAttribI4usv",
+    "glTexParameterf",
+    "glVertexAttribBinding",
+    "glGetHistogramParameteriv",
+    "glTexParameteri",
+    "glGetShaderSource",
+    "glVertexAttrib4s",
+    "glVertexAttrib4dvNV",
+    "glVertexAttrib1dvNV",
+    "glPopName",
+    "glTextureBufferEXT",
+    "glGetMultiTexImageEXT",
+    "glGetPointerIndexedvEXT",
+    "glIsNameAMD",
+    "glColor4ub",
+    "glBufferParameteriAPPLE",
+    "glColor4ui",
+    "glGetInternalformativ",
+    "glColor4us",
+    "glVertexAttribP1uiv",
+    "glLinkProgram",
+    "glTexCoord3s",
+    "glTexCoord2dv",
+    "glGetObjectLabel",
+    "glVertexPointerEXT",
+    "glDebugMessageCallbackARB",
+    "glGetString",
+    "glGetPathParameterfvNV",
+    "glLightxvOES",
+    "glEndQuery",
+    "glSecondaryColor3uiv",
+    "glPrioritizeTexturesxOES",
+    "glEdgeFlagPointer",
+    "glFramebufferParameteri",
+    "glTexCoord3hNV",
+    "glMultiModeDrawElementsIBM",
+    "glCopyPixels",
+    "glVertexAttribI2ui",
+    "glClampColorARB",
+    "glColorPointervINTEL",
+    "glDeleteTextures",
+    "glGetMinmaxParameterfvEXT",
+    "glWindowPos3sMESA",
+    "glVertexAttrib4f",
+    "glNamedFramebufferParameteri",
+    "glTexCoord2fVertex3fvSUN",
+    "glReplacementCodeusSUN",
+    "glGetNamedFramebufferParameteriv",
+    "glVertexStream1fvATI",
+    "glCreateVertexArrays",
+    "glBeginConditionalRender",
+    "glConvolutionFilter1D",
+    "glMultiTexCoord3fARB",
+    "glGetQueryObjectuivARB",
+    "glScalexOES",
+    "glSamplerParameteri",
+    "glSamplerParameterf",
+    "glShaderOp1EXT",
+    "glBeginVideoCaptureNV",
+    "glGetnHistogram",
+    "glUniform1d",
+    "glRenderMode",
+    "glClearColorIiEXT",
+    "glGetCompressedTexImage",
+    "glCompressedTextureImage1DEXT",
+    "glGetActiveUniformBlockiv",
+    "glUniform1i",
+    "glGetTexEnvfv",
+    "glColorTableParameterivSGI",
+    "glCullFace",
+    "glDeleteFencesAPPLE",
+    "glProgramUniform4i",
+    "glUniformHandleui64ARB",
+    "glProgramUniform4f",
+    "glViewportIndexedf",
+    "glProgramUniform4d",
+    "glTexCoord1xOES",
+    "glVertexStream3ivATI",
+    "glGetStringi",
+    "glEndQueryARB",
+    "glVDPAUMapSurfacesNV",
+    "glVertex3i",
+    "glVertexAttrib4uivARB",
+    "glResumeTransformFeedbackNV",
+    "glAttachShader",
+    "glColor4hNV",
+    "glGetFenceivNV",
+    "glTexCoord2fColor4ubVertex3fvSUN",
+    "glGetColorTable",
+    "glFogCoordPointer",
+    "glTexStorageSparseAMD",
+    "glUnmapNamedBuffer",
+    "glTexCoord4bvOES",
+    "glVertexAttrib3fARB",
+    "glRasterPos2xOES",
+    "glColor4ubVertex2fvSUN",
+    "glSecondaryColor3dv",
+    "glVertexAttribI4sv",
+    "glDrawTransformFeedbackStreamInstanced",
+    "glMultiTexCoord4ivARB",
+    "glSpriteParameterfSGIX",
+    "glSecondaryColor3sv",
+    "glBindVideoCaptureStreamTextureNV",
+    "glTexParameterIuiv",
+    "glFlushPixelDataRangeNV",
+    "glWindowPos3fv",
+    "glVertexAttribLFormatNV",
+    "glLightModelfv",
+    "glGetColorTableSGI",
+    "glGetCompressedTexImageARB",
+    "glConvolutionParameteri",
+    "glVertexWeighthNV",
+    "glColorMaskIndexedEXT",
+    "glColorMaski",
+    "glColorFragmentOp1ATI",
+    "glVertexAttribI4ubvEXT",
+    "glVertexAttrib1dNV",
+    "glUnmapObjectBufferATI",
+    "glNamedProgramLocalParameterI4uiEXT",
+    "glProgramUniform1iEXT",
+    "glDeleteQueriesARB",
+    "glWindowPos3svARB",
+    "glVertex4s",
+    "glStringMarkerGREMEDY",
+    "glIsTransformFeedback",
+    "glProgramUniformMatrix2x3dvEXT",
+    "glGetObjectLabelEXT",
+    "glUniformHandleui64vNV",
+    "glRotated",
+    "glIsProgramPipeline",
+    "glRotatef",
+    "glVertex4i",
+    "glGetActiveSubroutineUniformName",
+    "glVertexAttrib4sNV",
+    "glProgramLocalParameter4dvARB",
+    "glReplacementCodeubSUN",
+    "glMultiDrawElementsIndirectBindlessNV",
+    "glUniformMatrix3fv",
+    "glGetnMapfvARB",
+    "glGetnUniformfv",
+    "glVertexAttribL2dv",
+    "glVertexWeightPointerEXT",
+    "glTangent3sEXT",
+    "glSecondaryColorPointer",
+    "glAlphaFunc",
+    "glGetNamedStringARB",
+    "glTexCoord4d",
+    "glBufferPageCommitmentARB",
+    "glProgramLocalParameters4fvEXT",
+    "glStencilFunc",
+    "glGetVertexAttribdvNV",
+    "glTexCoord3dv",
+    "glGetQueryBufferObjectiv",
+    "glTexGenxOES",
+    "glMultiTexCoord1fvARB",
+    "glLightEnviSGIX",
+    "glGetProgramPipelineiv",
+    "glVertexStream2ivATI",
+    "glGetColorTableEXT",
+    "glGetShaderInfoLog",
+    "glGetOcclusionQueryuivNV",
+    "glInvalidateNamedFramebufferSubData",
+    "glVertexAttribL1i64NV",
+    "glVDPAUInitNV",
+    "glVertexAttrib1hvNV",
+    "glVertexAttribI4i",
+    "glRasterPos2iv",
+    "glGetIntegerui64i_vNV",
+    "glUniformHandleui64NV",
+    "glWindowPos3ivMESA",
+    "glBlendEquationSeparate",
+    "glDrawElementsInstancedARB",
+    "glGetSubroutineIndex",
+    "glVertexAttrib2sv",
+    "glSamplePatternSGIS",
+    "glEGLImageTargetRenderbufferStorageOES",
+    "glPushAttrib",
+    "glVertex3hNV",
+    "glRasterPos3xvOES",
+    "glPathParameterfNV",
+    "glGetUniformi64vNV",
+    "glLightiv",
+    "glMaterialxvOES",
+    "glNamedProgramLocalParameter4fEXT",
+    "glVertexAttribL1dEXT",
+    "glGetnUniformdvARB",
+    "glSecondaryColor3bEXT",
+    "glBeginPerfQueryINTEL",
+    "glProgramUniform1uivEXT",
+    "glImageTransformParameterivHP",
+    "glDeleteBuffers",
+    "glBindProgramPipeline",
+    "glScissor",
+    "glProgramUniform4fv",
+    "glGetBooleanv",
+    "glMaterialfv",
+    "glWindowPos4fvMESA",
+    "glVertexAttribIPointerEXT",
+    "glProgramBufferParametersfvNV",
+    "glAlphaFuncxOES",
+    "glMultiDrawArraysIndirectAMD",
+    "glNormalStream3ivATI",
+    "glTextureImage3DMultisampleNV",
+    "glProgramUniform4uivEXT",
+    "glReplacementCodeusvSUN",
+    "glPollInstrumentsSGIX",
+    "glGetTextureLevelParameteriv",
+    "glVertexAttribI2uiv",
+    "glMapControlPointsNV",
+    "glColor4dv",
+    "glInvalidateBufferSubData",
+    "glMultiTexCoord1hNV",
+    "glPointParameterfv",
+    "glUniformMatrix2fvARB",
+    "glUniform2fv",
+    "glVertexPointerListIBM",
+    "glGetMultiTexGenfvEXT",
+    "glGetMinmaxEXT",
+    "glIsFenceNV",
+    "glMatrixFrustumEXT",
+    "glDispatchComputeIndirect",
+    "glMultiTexCoord4bOES",
+    "glProgramEnvParameter4dARB",
+    "glProgramUniform1uiEXT",
+    "glBindBufferRange",
+    "glNormal3iv",
+    "glVertexAttribL3dv",
+    "glGetUniformdv",
+    "glGetMultiTexLevelParameterfvEXT",
+    "glFinalCombinerInputNV",
+    "glCullParameterdvEXT",
+    "glMultiTexCoord4s",
+    "glMapVertexAttrib1fAPPLE",
+    "glConvolutionParameterfEXT",
+    "glTexCoord1iv",
+    "glProgramUniform3fvEXT",
+    "glColor3uiv",
+    "glListBase",
+    "glTexCoord2bOES",
+    "glBindMaterialParameterEXT",
+    "glGlobalAlphaFactorubSUN",
+    "glVertexAttribL1ui64NV",
+    "glPointParameterfSGIS",
+    "glGetImageTransformParameterivHP",
+    "glColorSubTableEXT",
+    "glPixelTexGenParameterfvSGIS",
+    "glClientWaitSync",
+    "glQueryObjectParameteruiAMD",
+    "glVertexAttribs1fvNV",
+    "glVertexAttrib4NusvARB",
+    "glVariantPointerEXT",
+    "glTextureBuffer",
+    "glVertexAttribI1uiEXT",
+    "glInvalidateTexImage",
+    "glProgramEnvParametersI4ivNV",
+    "glPathGlyphIndexArrayNV",
+    "glCopyImageSubData",
+    "glGetUniformSubroutineuiv",
+    "glBindVertexBuffer",
+    "glMultiTexCoord1iARB",
+    "glDebugMessageInsert",
+    "glBeginVertexShaderEXT",
+    "glIsVariantEnabledEXT",
+    "glPassThroughxOES",
+    "glIsSampler",
+    "glConservativeRasterParameterfNV",
+    "glMultiTexGenivEXT",
+    "glNamedFramebufferTexture2DEXT",
+    "glCopyTexSubImage1D",
+    "glTexCoord1i",
+    "glCheckFramebufferStatus",
+    "glDrawElementArrayAPPLE",
+    "glTexCoord1d",
+    "glTexCoord1f",
+    "glFragmentLightivSGIX",
+    "glBindImageTexture",
+    "glTransformFeedbackVaryings",
+    "glDrawRangeElements",
+    "glTexCoord1s",
+    "glBindBufferBase",
+    "glColor3bv",
+    "glSyncTextureINTEL",
+    "glCreateSamplers",
+    "glCombinerParameterfNV",
+    "glGetArrayObjectivATI",
+    "glMultiDrawArrays",
+    "glSampleMapATI",
+    "glProgramUniform2i64ARB",
+    "glBinormal3ivEXT",
+    "glMultiDrawArraysIndirectCountARB",
+    "glUniformBufferEXT",
+    "glWindowPos2ivMESA",
+    "glTexCoordP4ui",
+    "glMultiTexSubImage1DEXT",
+    "glProgramUniformMatrix2x3fvEXT",
+    "glBufferDataARB",
+    "glVertexAttribIFormat",
+    "glCreateFramebuffers",
+    "glNormalStream3dvATI",
+    "glClearAccum",
+    "glUniform3i64vNV",
+    "glNormal3fVertex3fSUN",
+    "glUniform2uivEXT",
+    "glBeginQuery",
+    "glStencilThenCoverStrokePathInstancedNV",
+    "glBindBuffer",
+    "glMap2d",
+    "glMap2f",
+    "glMakeImageHandleResidentNV",
+    "glUniformMatrix2x4fv",
+    "glGetMultiTexParameterfvEXT",
+    "glDepthRangeIndexed",
+    "glMultiTexCoord1s",
+    "glMatrixScalefEXT",
+    "glGetError",
+    "glGetTexEnviv",
+    "glBindTextureUnitParameterEXT",
+    "glGetnUniformfvARB",
+    "glReplacementCodeuiNormal3fVertex3fvSUN",
+    "glDeletePerfQueryINTEL",
+    "glActiveVaryingNV",
+    "glGetActiveUniformARB",
+    "glVertexAttribI3ivEXT",
+    "glEvalCoord1d",
+    "glNamedCopyBufferSubDataEXT",
+    "glEvalCoord1f",
+    "glPixelMapfv",
+    "glVertexAttribI1ivEXT",
+    "glCreateSyncFromCLeventARB",
+    "glGetPixelMapusv",
+    "glGetnColorTableARB",
+    "glAccum",
+    "glRasterPos3sv",
+    "glTexCoord2iv",
+    "glBlendFunciARB",
+    "glProgramUniform3i64vARB",
+    "glGetFramebufferAttachmentParameteriv",
+    "glProgramUniform4ui",
+    "glStencilMask",
+    "glResetHistogramEXT",
+    "glLightxOES",
+    "glNamedBufferData",
+    "glVertexStream3sATI",
+    "glVertexAttrib3fvARB",
+    "glClearNamedBufferSubData",
+    "glProgramUniformHandleui64ARB",
+    "glUniform3iARB",
+    "glCreateProgramObjectARB",
+    "glMultiTexCoord1dvARB",
+    "glGetObjectParameterfvARB",
+    "glRectsv",
+    "glMultiTexImage2DEXT",
+    "glProgramUniform1i64NV",
+    "glGetObjectBufferivATI",
+    "glUniform4i64ARB",
+    "glReplacementCodeuiColor4ubVertex3fvSUN",
+    "glBlendFuncSeparateINGR",
+    "glGetVideoCaptureStreamfvNV",
+    "glVertexAttrib2fARB",
+    "glGetTexGeniv",
+    "glPixelStorei",
+    "glGetCompressedTextureSubImage",
+    "glCopyImageSubDataNV",
+    "glActiveShaderProgram",
+    "glVertexStream1iATI",
+    "glPatchParameterfv",
+    "glIsFramebufferEXT",
+    "glTextureStorage2D",
+    "glProgramUniform1ui64ARB",
+    "glTexBufferRange",
+    "glGetPixelTexGenParameterivSGIS",
+    "glTextureSubImage3DEXT",
+    "glClipControl",
+    "glGetProgramResourceiv",
+    "glMultiTexCoordP2uiv",
+    "glVertexAttribI3ui",
+    "glSampleMaskSGIS",
+    "glVertexAttrib4NivARB",
+    "glGlobalAlphaFactorfSUN",
+    "glBlendEquationSeparateIndexedAMD",
+    "glGetPerfCounterInfoINTEL",
+    "glDeleteProgramsNV",
+    "glPixelZoomxOES",
+    "glGetCombinerOutputParameterivNV",
+    "glRasterPos2xvOES",
+    "glGetTexImage",
+    "glVertexArrayVertexBuffers",
+    "glUniform1ui64NV",
+    "glProgramParameteri",
+    "glNormal3xOES",
+    "glGetMapfv",
+    "glVertexStream2dvATI",
+    "glPathStencilDepthOffsetNV",
+    "glIsStateNV",
+    "glGetIntegerui64vNV",
+    "glGetImageTransformParameterfvHP",
+    "glRasterPos2fv",
+    "glVertex3xOES",
+    "glProgramUniform2dvEXT",
+    "glWeightPointerARB",
+    "glFinishFenceNV",
+    "glDepthRangexOES",
+    "glEnableVertexArrayAttribEXT",
+    "glProgramUniform2uivEXT",
+    "glGetDoubleIndexedvEXT",
+    "glWindowPos2fMESA",
+    "glSecondaryColor3b",
+    "glCopyConvolutionFilter1DEXT",
+    "glWindowPos2sv",
+    "glBindFramebufferEXT",
+    "glCreateShader",
+    "glGenPathsNV",
+    "glGenRenderbuffers",
+    "glCopyTexSubImage2D",
+    "glVertexAttrib4ubvARB",
+    "glDrawTextureNV",
+    "glVertexAttribs1svNV",
+    "glClearNamedBufferSubDataEXT",
+    "glBlendFuncSeparate",
+    "glPointParameterfARB",
+    "glTexCoord2fv",
+    "glGetVariantFloatvEXT",
+    "glVertexP2ui",
+    "glWindowPos2dMESA",
+    "glTexCoord4fv",
+    "glBindFragDataLocationEXT",
+    "glCompressedTexSubImage1DARB",
+    "glGetTextureImageEXT",
+    "glFogCoordd",
+    "glPointSize",
+    "glBindTextureUnit",
+    "glProgramEnvParameterI4uiNV",
+    "glGetProgramPipelineInfoLog",
+    "glProgramUniform4i64vARB",
+    "glVertexAttrib4Nuiv",
+    "glGetUniformfvARB",
+    "glWaitSync",
+    "glUniform3i",
+    "glBlendEquationSeparatei",
+    "glVertexAttrib2hvNV",
+    "glTextureParameterivEXT",
+    "glUniform3d",
+    "glUniform3f",
+    "glActiveProgramEXT",
+    "glDeleteVertexArrays",
+    "glUniform3ui64vARB",
+    "glProgramUniform1ui64vARB",
+    "glTextureParameterfEXT",
+    "glSetFragmentShaderConstantATI",
+    "glColorSubTable",
+    "glReplacementCodeuiSUN",
+    "glStateCaptureNV",
+    "glBindAttribLocation",
+    "glWeightusvARB",
+    "glGetFragDataIndex",
+    "glMultiTexCoord2xOES",
+    "glColor3sv",
+    "glTexCoord2fVertex3fSUN",
+    "glPolygonOffsetEXT",
+    "glWeightPathsNV",
+    "glCombinerStageParameterfvNV",
+    "glPointParameterfEXT",
+    "glCopyTexImage1DEXT",
+    "glVertex4sv",
+    "glMatrixMultfEXT",
+    "glCompressedTextureSubImage3DEXT",
+    "glGetTexLevelParameterxvOES",
+    "glVertexAttribL3dvEXT",
+    "glMultiTexCoordP4ui",
+    "glGetTextureLevelParameterivEXT",
+    "glAlphaFragmentOp2ATI",
+    "glDeleteFramebuffers",
+    "glDrawArrays",
+    "glGetTransformFeedbackiv",
+    "glGetnTexImageARB",
+    "glClear",
+    "glVertexArrayParameteriAPPLE",
+    "glMultiTexCoord2dvARB",
+    "glGetVideoCaptureStreamdvNV",
+    "glFragmentLightModelivSGIX",
+    "glVertexAttribP2ui",
+    "glMultiTexCoordPointerEXT",
+    "glProgramUniform3iEXT",
+    "glTranslatef",
+    "glVertexAttrib4Nub",
+    "glTranslated",
+    "glSamplerParameterIiv",
+    "glTexCoord4hNV",
+    "glDrawElementsIndirect",
+    "glDeletePerfMonitorsAMD",
+    "glIsRenderbufferEXT",
+    "glDrawCommandsNV",
+    "glUniform3ivARB",
+    "glBufferSubData",
+    "glSecondaryColor3bv",
+    "glMatrixMultTransposedEXT",
+    "glRequestResidentProgramsNV",
+    "glAlphaFragmentOp1ATI",
+    "glGetQueryObjecti64v",
+    "glMatrixMult3x3fNV",
+    "glColorTableParameteriv",
+    "glPathSubCommandsNV",
+    "glGetFinalCombinerInputParameterivNV",
+    "glIsRenderbuffer",
+    "glVertex3iv",
+    "glTexGenfv",
+    "glFrustumfOES",
+    "glBindVertexBuffers",
+    "glMateriali",
+    "glMultiTexCoord2svARB",
+    "glDisableVertexAttribArray",
+    "glWindowPos3ivARB",
+    "glTexCoordFormatNV",
+    "glBlitNamedFramebuffer",
+    "glMatrixLoadTransposefEXT",
+    "glMultiTexGenfEXT",
+    "glShaderStorageBlockBinding",
+    "glMaterialf",
+    "glReplacementCodeuiColor4fNormal3fVertex3fSUN",
+    "glCheckNamedFramebufferStatusEXT",
+    "glVertexArrayVertexAttribFormatEXT",
+    "glVertex2hNV",
+    "glDeleteVertexShaderEXT",
+    "glTexImage3DEXT",
+    "glProgramLocalParameterI4ivNV",
+    "glGlobalAlphaFactoriSUN",
+    "glTextureStorage1D",
+    "glBinormal3sEXT",
+    "glGetProgramInterfaceiv",
+    "glMatrixIndexPointerARB",
+    "glTexCoordPointerEXT",
+    "glMultiTexGeniEXT",
+    "glVertexAttrib2fNV",
+    "glNamedProgramStringEXT",
+    "glMapNamedBuffer",
+    "glGetMinmaxParameteriv",
+    "glGetnUniformdv",
+    "glEndConditionalRenderNVX",
+    "glBinormal3fEXT",
+    "glNormalStream3iATI",
+    "glProgramBufferParametersIivNV",
+    "glMapGrid1xOES",
+    "glGetVertexAttribPointervARB",
+    "glFlushMappedNamedBufferRangeEXT",
+    "glGetVertexAttribIiv",
+    "glVertexP4uiv",
+    "glUniformui64NV",
+    "glColor4fv",
+    "glTexParameterxvOES",
+    "glPatchParameteri",
+    "glMap1d",
+    "glGetTexFilterFuncSGIS",
+    "glGetTexParameteriv",
+    "glVertexArrayVertexBindingDivisorEXT",
+    "glMultiTexCoord3svARB",
+    "glBindProgramNV",
+    "glGetConvolutionParameteriv",
+    "glGetProgramLocalParameterfvARB",
+    "glGenFragmentShadersATI",
+    "glTexBumpParameterivATI",
+    "glGetNamedFramebufferAttachmentParameteriv",
+    "glGetnSeparableFilter",
+    "glNormal3xvOES",
+    "glPassTexCoordATI",
+    "glFramebufferTextureFaceARB",
+    "glProgramUniform1dv",
+    "glTextureStorage2DEXT",
+    "glVertexArrayFogCoordOffsetEXT",
+    "glDeleteNamedStringARB",
+    "glGenOcclusionQueriesNV",
+    "glLighti",
+    "glTexImage1D",
+    "glLightf",
+    "glClientAttribDefaultEXT",
+    "glVertexAttrib4bvARB",
+    "glVertexAttribIFormatNV",
+    "glStencilFuncSeparate",
+    "glGetVertexAttribfvARB",
+    "glVertexAttrib2dNV",
+    "glProgramUniform2iEXT",
+    "glClientActiveVertexStreamATI",
+    "glRasterPos3xOES",
+    "glGetMapParameterivNV",
+    "glSampleCoverage",
+    "glClearDepthxOES",
+    "glTexCoord2fNormal3fVertex3fvSUN",
+    "glGetFirstPerfQueryIdINTEL",
+    "glUnmapNamedBufferEXT",
+    "glGetTransformFeedbacki_v",
+    "glUniform4fvARB",
+    "glRenderbufferStorageMultisampleCoverageNV",
+    "glGetFloati_vEXT",
+    "glBindAttribLocationARB",
+    "glBufferAddressRangeNV",
+    "glGenProgramsARB",
+    "glMultiTexEnvivEXT",
+    "glSecondaryColor3uiEXT",
+    "glCompressedTextureImage2DEXT",
+    "glUniform2i",
+    "glCopyTexImage2DEXT",
+    "glUniform2d",
+    "glVertexAttribL1d",
+    "glFramebufferTextureFaceEXT",
+    "glFramebufferTextureLayer",
+    "glMultiTexCoord4bvOES",
+    "glGetVertexArrayPointeri_vEXT",
+    "glNamedProgramLocalParameter4dEXT",
+    "glBinormal3bEXT",
+    "glConvolutionFilter2DEXT",
+    "glProgramUniform2fv",
+    "glColor3fVertex3fSUN",
+    "glNormal3fVertex3fvSUN",
+    "glCopyMultiTexSubImage3DEXT",
+    "glProgramLocalParameterI4iNV",
+    "glProgramUniformMatrix2x4dv",
+    "glPathMemoryGlyphIndexArrayNV",
+    "glDrawArraysEXT",
+    "glBlendEquationEXT",
+    "glStencilOp",
+    "glCopyTextureSubImage2DEXT",
+    "glTexEnvf",
+    "glVertexAttrib2dvNV",
+    "glGenPerfMonitorsAMD",
+    "glGetInteger64i_v",
+    "glGetHistogramParameterfv",
+    "glVertexFormatNV",
+    "glBlendFuncIndexedAMD",
+    "glTexEnvi",
+    "glMultiTexCoord1iv",
+    "glIsEnabledi",
+    "glVertexAttribL2ui64vNV",
+    "glVertexAttribL4i64NV",
+    "glMatrixTranslatedEXT",
+    "glMakeTextureHandleResidentARB",
+    "glMatrixMultdEXT",
+    "glBinormal3dvEXT",
+    "glImportSyncEXT",
+    "glGetMapiv",
+    "glGetListParameterfvSGIX",
+    "glMultiTexCoord4sv",
+    "glPNTrianglesiATI",
+    "glBindVertexArrayAPPLE",
+    "glObjectPtrLabel",
+    "glGetDebugMessageLog",
+    "glTrackMatrixNV",
+    "glBindFragDataLocation",
+    "glTangent3ivEXT",
+    "glSecondaryColor3ubv",
+    "glMakeTextureHandleNonResidentNV",
+    "glVertexAttribs4ubvNV",
+    "glClipPlanexOES",
+    "glMultiTexCoord3iv",
+    "glGetnPolygonStippleARB",
+    "glUniform2i64vNV",
+    "glLightModelf",
+    "glMultiTexSubImage2DEXT",
+    "glReplacementCodeuiColor3fVertex3fSUN",
+    "glTangent3dvEXT",
+    "glLightModeli",
+    "glVertexWeighthvNV",
+    "glWindowPos3iv",
+    "glMultiTexCoordP1uiv",
+    "glTransformPathNV",
+    "glProgramNamedParameter4dNV",
+    "glMultiDrawElementsIndirect",
+    "glProgramUniform1dEXT",
+    "glCallLists",
+    "glNormal3hvNV",
+    "glGetCombinerOutputParameterfvNV",
+    "glVertexAttrib4sARB",
+    "glTexCoord3i",
+    "glVertexAttribI3uiv",
+    "glPushDebugGroup",
+    "glTexCoord3f",
+    "glTexCoord3d",
+    "glTexCoord2xOES",
+    "glGetStageIndexNV",
+    "glProgramUniform4i64vNV",
+    "glGetNamedBufferPointervEXT",
+    "glTextureBarrierNV",
+    "glColor4ubVertex3fvSUN",
+    "glGetCommandHeaderNV",
+    "glGetPerfMonitorCounterInfoAMD",
+    "glVertexAttrib1svARB",
+    "glCombinerParameteriNV",
+    "glMatrixMultTransposefEXT",
+    "glDetailTexFuncSGIS",
+    "glAreTexturesResident",
+    "glProgramUniform2d",
+    "glGetConvolutionParameterfvEXT",
+    "glIndexPointerListIBM",
+    "glVertexAttribI4iEXT",
+    "glProgramUniform2f",
+    "glRasterPos4sv",
+    "glColor4s",
+    "glColorFragmentOp3ATI",
+    "glResizeBuffersMESA",
+    "glGetMinmaxParameterfv",
+    "glClientActiveTextureARB",
+    "glBindVertexArray",
+    "glColor4b",
+    "glColor4f",
+    "glColor4d",
+    "glColor4i",
+    "glEdgeFlagFormatNV",
+    "glNamedBufferSubData",
+    "glDrawElementsInstanced",
+    "glGetMultiTexParameterIivEXT",
+    "glVertex2dv",
+    "glDisableVertexArrayAttribEXT",
+    "glObjectUnpurgeableAPPLE",
+    "glVertexAttribs2dvNV",
+    "glReplacementCodeuiTexCoord2fVertex3fSUN",
+    "glGetMapParameterfvNV",
+    "glProgramUniform4ivEXT",
+    "glProgramUniform3ui64vNV",
+    "glRectfv",
+    "glTexFilterFuncSGIS",
+    "glSpriteParameterfvSGIX",
+    "glCopyMultiTexImage1DEXT",
+    "glGetVertexAttribIuivEXT",
+    "glUniformMatrix2x4dv",
+    "glGetProgramResourceLocationIndex",
+    "glColor3hNV",
+    "glViewport",
+    "glProgramNamedParameter4fNV",
+    "glGetInvariantBooleanvEXT",
+    "glTexStorage2DMultisample",
+    "glPixelStorex",
+    "glVertexAttribL1dvEXT",
+    "glGetActiveSubroutineUniformiv",
+    "glVertexAttribPointerARB",
+    "glCompressedTexSubImage2DARB",
+    "glVertex2hvNV",
+    "glTexBuffer",
+    "glArrayElement",
+    "glValidateProgram",
+    "glPixelStoref",
+    "glWindowPos3dARB",
+    "glEvalCoord1dv",
+    "glVertexAttribs2fvNV",
+    "glRecti",
+    "glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN",
+    "glTexCoord1bOES",
+    "glProgramUniform2i64vARB",
+    "glWindowPos2dARB",
+    "glGetProgramParameterdvNV",
+    "glRectf",
+    "glRectd",
+    "glMap1xOES",
+    "glVertexAttrib3fvNV",
+    "glReferencePlaneSGIX",
+    "glGetMultiTexGendvEXT",
+    "glGetCombinerInputParameterfvNV",
+    "glGetTextureSamplerHandleARB",
+    "glBindTexture",
+    "glRects",
+    "glGetActiveAttribARB",
+    "glHistogramEXT",
+    "glGetTextureSamplerHandleNV",
+    "glDetachShader",
+    "glFinishTextureSUNX",
+    "glUniformMatrix3x4dv",
+    "glVertexAttrib4fARB",
+    "glGetPathColorGenivNV",
+    "glGetProgramResourceLocation",
+    "glVertexArrayAttribLFormat",
+    "glGetTexLevelParameterfv",
+    "glVertexArrayVertexAttribOffsetEXT",
+    "glIndexFormatNV",
+    "glMultiTexCoord3i",
+    "glReplacementCodeuiVertex3fvSUN",
+    "glViewportIndexedfv",
+    "glBindBuffersBase",
+    "glTexBumpParameterfvATI",
+    "glMatrixIndexuivARB",
+    "glVertexAttrib1hNV",
+    "glWindowPos3svMESA",
+    "glStencilOpSeparateATI",
+    "glDrawElementsBaseVertex",
+    "glBlendEquationSeparateiARB",
+    "glVertexAttrib1fNV",
+    "glMapVertexAttrib2fAPPLE",
+    "glCompressedTextureSubImage1DEXT",
+    "glClearBufferSubData",
+    "glTexStorage1D",
+    "glVertexAttribI3iEXT",
+    "glMakeTextureHandleNonResidentARB",
+    "glMultiDrawElementArrayAPPLE",
+    "glVertexStream4dATI",
+    "glProgramUniformMatrix2dvEXT",
+    "glVertexAttribs2hvNV",
+    "glGetUniformiv",
+    "glClipPlanefOES",
+    "glRenderbufferStorage",
+    "glUniform4ui",
+    "glBindFramebuffer",
+    "glValidateProgramARB",
+    "glTexGenf",
+    "glTexGend",
+    "glTexGeni",
+    "glDeleteFramebuffersEXT",
+    "glResetMinmaxEXT",
+    "glVertexAttrib1fvNV",
+    "glIsQueryARB",
+    "glEnableVariantClientStateEXT",
+    "glScissorIndexed",
+    "glGetInvariantIntegervEXT",
+    "glProgramLocalParameterI4uiNV",
+    "glConvolutionParameterxvOES",
+    "glGenFramebuffersEXT",
+    "glVertexArrayColorOffsetEXT",
+    "glMultiTexCoord3ivARB",
+    "glVertexWeightfEXT",
+    "glRasterPos4dv",
+    "glIsTextureHandleResidentARB",
+    "glRasterPos2dv",
+    "glWindowPos4ivMESA",
+    "glGetVariantPointervEXT",
+    "glMapNamedBufferRangeEXT",
+    "glGetnUniformui64vARB",
+    "glCreateShaderProgramv",
+    "glGetQueryObjectiv",
+    "glPNTrianglesfATI",
+    "glGlobalAlphaFactorusSUN",
+    "glVertexAttrib3dvNV",
+    "glMultiTexCoord3sARB",
+    "glGenerateMipmap",
+    "glCompressedTextureSubImage2D",
+    "glNamedRenderbufferStorageMultisampleEXT",
+    "glPolygonOffsetClampEXT",
+    "glTextureRangeAPPLE",
+    "glBlendEquationIndexedAMD",
+    "glTexCoord2d",
+    "glPointParameteri",
+    "glTexCoord2f",
+    "glColor4iv",
+    "glMapNamedBufferRange",
+    "glUnmapBuffer",
+    "glSampleMaskEXT",
+    "glTexCoord2i",
+    "glTexCoord1xvOES",
+    "glVertexAttrib1sARB",
+    "glGetVertexArrayiv",
+    "glProgramParameter4dvNV",
+    "glTexCoord2s",
+    "glTextureParameterIuivEXT",
+    "glGetColorTableParameterfvSGI",
+    "glTexCoord4dv",
+    "glVertexAttrib1svNV",
+    "glNamedFramebufferTextureFaceEXT",
+    "glProgramUniform2ui64vNV",
+    "glNormal3dv",
+    "glReleaseShaderCompiler",
+    "glTexCoord3bvOES",
+    "glIsVertexAttribEnabledAPPLE",
+    "glTexCoord1dv",
+    "glReadPixels",
+    "glVertexAttribI3iv",
+    "glSetFenceAPPLE",
+    "glWeightsvARB",
+    "glShadeModel",
+    "glMapGrid1d",
+    "glGetHistogramParameterivEXT",
+    "glConservativeRasterParameteriNV",
+    "glClearNamedBufferData",
+    "glClearDepthf",
+    "glCreatePerfQueryINTEL",
+    "glFogCoordfEXT",
+    "glVertexAttrib2dARB",
+    "glMultiTexCoord4dARB",
+    "glReadnPixelsARB",
+    "glMultiTexBufferEXT",
+    "glWindowPos4dvMESA",
+    "glInvalidateNamedFramebufferData",
+    "glSecondaryColorPointerListIBM",
+    "glRectiv",
+    "glColorP4ui",
+    "glUseProgramStages",
+    "glRasterPos3dv",
+    "glPathTexGenNV",
+    "glVertexBlendEnviATI",
+    "glUniform3i64ARB",
+    "glLoadMatrixf",
+    "glProgramUniform2dEXT",
+    "glVertexAttribI4iv",
+    "glNamedFramebufferDrawBuffer",
+    "glColor4ubv",
+    "glColor3hvNV",
+    "glGetMapAttribParameterfvNV",
+    "glGetBufferSubData",
+    "glGetVertexAttribLdv",
+    "glGetnUniformuiv",
+    "glGetUniformui64vNV",
+    "glNamedRenderbufferStorageEXT",
+    "glVertexAttrib3dNV",
+    "glTextureStorage1DEXT",
+    "glPixelTexGenParameteriSGIS",
+    "glColorTableEXT",
+    "glGenBuffers",
+    "glMultiTexCoord3xvOES",
+    "glExecuteProgramNV",
+    "glVariantArrayObjectATI",
+    "glColor3xvOES",
+    "glGetnConvolutionFilterARB",
+    "glNormalFormatNV",
+    "glGetInvariantFloatvEXT",
+    "glClearNamedFramebufferiv",
+    "glTexImage3D",
+    "glGenSamplers",
+    "glIsFramebuffer",
+    "glProgramUniform3dvEXT",
+    "glGetVertexAttribfvNV",
+    "glDrawRangeElementArrayAPPLE",
+    "glUniform3i64NV",
+    "glMatrixPopEXT",
+    "glVertexStream1sATI",
+    "glGetnPixelMapuivARB",
+    "glMultiTexEnviEXT",
+    "glVertexAttribI2iEXT",
+    "glProgramParameter4fvNV",
+    "glNamedFramebufferSampleLocationsfvNV",
+    "glTexCoordP4uiv",
+    "glRectxvOES",
+    "glGetVariantIntegervEXT",
+    "glDeleteLists",
+    "glTexGendv",
+    "glVertexP2uiv",
+    "glGetPerfMonitorGroupsAMD",
+    "glMultTransposeMatrixfARB",
+    "glVertexAttribI2ivEXT",
+    "glReplacementCodeuiColor4fNormal3fVertex3fvSUN",
+    "glDeleteStatesNV",
+    "glGetBufferParameteri64v",
+    "glProgramUniform4dv",
+    "glEdgeFlagPointerEXT",
+    "glVideoCaptureStreamParameterivNV",
+    "glVertexStream4iATI",
+    "glVDPAUFiniNV",
+    "glMakeBufferNonResidentNV",
+    "glUniform1ui64ARB",
+    "glStencilStrokePathNV",
+    "glProgramUniform3uiv",
+    "glVariantuivEXT",
+    "glCopyTexSubImage3DEXT",
+    "glSpriteParameteriSGIX",
+    "glMultiTexCoord1sARB",
+    "glConvolutionParameterfv",
+    "glMakeTextureHandleResidentNV",
+    "glMultMatrixxOES",
+    "glTextureNormalEXT",
+    "glGetQueryivARB",
+    "glCompressedMultiTexImage3DEXT",
+    "glGetInstrumentsSGIX",
+    "glProgramUniformMatrix4x3fvEXT",
+    "glPointParameterf",
+    "glProgramUniform3dEXT",
+    "glMultiTexCoord2hNV",
+    "glGetConvolutionFilterEXT",
+    "glVertexAttrib2hNV",
+    "glCurrentPaletteMatrixARB",
+    "glFogxvOES",
+    "glCreateRenderbuffers",
+    "glVertexAttrib4Nusv",
+    "glCombinerInputNV",
+    "glDepthFunc",
+    "glWindowPos4fMESA",
+    "glEnableClientStateIndexedEXT",
+    "glTexCoord4iv",
+    "glProgramUniform4i64ARB",
+    "glBlendFunci",
+    "glResolveDepthValuesNV",
+    "glTextureColorMaskSGIS",
+    "glCreateShaderProgramEXT",
+    "glBufferStorage",
+    "glMakeNamedBufferNonResidentNV",
+    "glRenderbufferStorageMultisampleEXT",
+    "glGetFloati_v",
+    "glUniform2ui64ARB",
+    "glVertex3fv",
+    "glGetUniformLocation",
+    "glVertexStream1svATI",
+    "glVertexStream3fATI",
+    "glNamedFramebufferDrawBuffers",
+    "glUniform2ui64vNV",
+    "glTexCoordPointervINTEL",
+    "glUniform4fv",
+    "glNormalPointerEXT",
+    "glVertexAttrib4hNV",
+    "glNormal3f",
+    "glVertexStream2iATI",
+    "glVertexAttribP4uiv",
+    "glCompressedTextureSubImage3D",
+    "glAsyncMarkerSGIX",
+    "glTextureStorageSparseAMD",
+    "glGetConvolutionParameterivEXT",
+    "glEndPerfQueryINTEL",
+    "glFragmentLightModeliSGIX",
+    "glPrioritizeTexturesEXT",
+    "glEndConditionalRender",
+    "glEnableClientState",
+    "glResetHistogram",
+    "glGetOcclusionQueryivNV",
+    "glUniform1uiEXT",
+    "glMultiTexCoord2sv",
+    "glTexSubImage2DEXT",
+    "glProgramUniform2uiv",
+    "glMultiTexCoord2iARB",
+    "glGetQueryObjectuiv",
+    "glGenerateMultiTexMipmapEXT",
+    "glVertexAttrib4iv",
+    "glWindowPos3dvMESA",
+    "glLabelObjectEXT",
+    "glProgramUniform1uiv",
+    "glFramebufferTexture",
+    "glMultiTexEnvfEXT",
+    "glGetTexGendv",
+    "glVertex4xOES",
+    "glVertexAttribI2uivEXT",
+    "glNamedProgramLocalParameter4fvEXT",
+    "glPointParameterfvSGIS",
+    "glGetPixelTransformParameterfvEXT",
+    "glIndexxvOES",
+    "glDepthMask",
+    "glProgramUniformMatrix2x4fv",
+    "glAreProgramsResidentNV",
+    "glColorTable",
+    "glBeginQueryIndexed",
+    "glVertexStream1dvATI",
+    "glGetMultiTexEnvfvEXT",
+    "glDeleteFencesNV",
+    "glVertexAttribs1dvNV",
+    "glVertexStream2sATI",
+    "glGetnSeparableFilterARB",
+    "glProgramUniform2dv",
+    "glActiveStencilFaceEXT",
+    "glProgramUniform4dEXT",
+    "glPointSizexOES",
+    "glRasterPos2sv",
+    "glBindParameterEXT",
+    "glTexCoord1sv",
+    "glBlendParameteriNV",
+    "glNamedProgramLocalParameter4dvEXT",
+    "glProgramUniformHandleui64NV",
+    "glGetTextureParameterfvEXT",
+    "glGetPathMetricsNV",
+    "glVertex2i",
+    "glNewList",
+    "glMatrixLoad3x3fNV",
+    "glMultiTexCoord2fARB",
+    "glWeightdvARB",
+    "glIsTransformFeedbackNV",
+    "glVertexAttribDivisorARB",
+    "glSecondaryColorP3uiv",
+    "glGetnCompressedTexImageARB",
+    "glGetIntegerv",
+    "glMatrixLoaddEXT",
+    "glGetPathLengthNV",
+    "glProgramUniformMatrix3dv",
+    "glUniform4i64NV",
+    "glGetHistogramEXT",
+    "glVertexAttrib4NuivARB",
+    "glMapGrid2xOES",
+    "glTexImage2D",
+    "glWindowPos2fvARB",
+    "glEnableIndexedEXT",
+    "glTexCoord1bvOES",
+    "glDrawPixels",
+    "glMultMatrixd",
+    "glMultMatrixf",
+    "glReplacementCodePointerSUN",
+    "glLoadTransposeMatrixdARB",
+    "glVertexAttrib4Nubv",
+    "glVertexArrayVertexAttribIOffsetEXT",
+    "glCompileShaderARB",
+    "glWindowPos3dMESA",
+    "glNormalStream3fvATI",
+    "glColor4usv",
+    "glMapGrid1f",
+    "glPolygonStipple",
+    "glUniform4ui64ARB",
+    "glTextureRenderbufferEXT",
+    "glGetSubroutineUniformLocation",
+    "glGetFramebufferParameteriv",
+    "glPixelMapusv",
+    "glGetSamplerParameteriv",
+    "glVertexStream2fvATI",
+    "glProgramStringARB",
+    "glProgramUniformMatrix3dvEXT",
+    "glSeparableFilter2D",
+    "glVertexAttribI1uiv",
+    "glTexStorage2D",
+    "glColor3fv",
+    "glVertexAttribL4dvEXT",
+    "glGetActiveUniform",
+    "glUniform2ui64vARB",
+    "glMakeNamedBufferResidentNV",
+    "glPathGlyphIndexRangeNV",
+    "glColorPointer",
+    "glProgramEnvParameterI4ivNV",
+    "glMultiTexParameterfEXT",
+    "glNamedFramebufferTextureLayer",
+    "glGetVertexArrayIntegervEXT",
+    "glVertexAttrib3dARB",
+    "glVDPAUIsSurfaceNV",
+    "glMultiTexImage1DEXT",
+    "glIsAsyncMarkerSGIX",
+    "glGetDoublei_vEXT",
+    "glUniform2i64NV",
+    "glIsCommandListNV",
+    "glUniform3uiEXT",
+    "glTexParameterIuivEXT",
+    "glProgramUniformMatrix4fv",
+    "glVertex2fv",
+    "glVertexAttribL3dEXT",
+    "glFramebufferRenderbuffer",
+    "glGetUniformLocationARB",
+    "glPathParameterfvNV",
+    "glVertexAttrib3sNV",
+    "glGetDoublei_v",
+    "glVertexAttrib1sv",
+    "glBindSampler",
+    "glLineWidth",
+    "glVertexArrayRangeAPPLE",
+    "glBindBufferOffsetEXT",
+    "glWeightfvARB",
+    "glGetIntegeri_v",
+    "glGetTransformFeedbackVarying",
+    "glProgramLocalParameter4fvARB",
+    "glGetTransformFeedbackVaryingNV",
+    "glWindowPos2iv",
+    "glVertexStream1dATI",
+    "glColorFragmentOp2ATI",
+    "glFogiv",
+    "glGetTextureHandleNV",
+    "glLightModeliv",
+    "glDepthRangef",
+    "glGetFragmentMaterialivSGIX",
+    "glVideoCaptureStreamParameterfvNV",
+    "glDeleteProgramsARB",
+    "glWindowPos3fvARB",
+    "glFeedbackBufferxOES",
+    "glGetTexBumpParameterfvATI",
+    "glEnablei",
+    "glGetActiveSubroutineName",
+    "glDrawBuffersARB",
+    "glBindProgramARB",
+    "glEvalCoord1fv",
+    "glProgramUniform3ui64vARB",
+    "glProgramUniformMatrix2dv",
+    "glMultiTexCoord2hvNV",
+    "glGetFloatIndexedvEXT",
+    "glSampleCoverageARB",
+    "glProgramUniform2ui64vARB",
+    "glPixelDataRangeNV",
+    "glVertexStream3svATI",
+    "glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN",
+    "glTexCoord3hvNV",
+    "glSampleMaski",
+    "glIndexFuncEXT",
+    "glPointParameteriNV",
+    "glUniformMatrix3x2fv",
+    "glGetFramebufferParameterivEXT",
+    "glUniform2i64ARB",
+    "glNamedBufferStorageEXT",
+    "glNamedFramebufferTexture3DEXT",
+    "glVertexAttrib2dv",
+    "glGetVertexArrayPointervEXT",
+    "glGetVertexAttribArrayObjectivATI",
+    "glProgramUniformMatrix3fvEXT",
+    "glEnableVertexArrayEXT",
+    "glColorTableParameterfvSGI",
+    "glEdgeFlag",
+    "glFogCoordf",
+    "glVertex3d",
+    "glVertex3f",
+    "glSpriteParameterivSGIX",
+    "glPathGlyphRangeNV",
+    "glPrimitiveBoundingBoxARB",
+    "glVertexAttribL3ui64vNV",
+    "glVertex3s",
+    "glTexCoordP2ui",
+    "glProgramUniform2fvEXT",
+    "glDeletePathsNV",
+    "glPrimitiveRestartIndexNV",
+    "glTexCoord2fColor3fVertex3fvSUN",
+    "glTexCoordPointerListIBM",
+    "glRectxOES",
+    "glCopyNamedBufferSubData",
+    "glGenProgramsNV",
+    "glFragmentLightfSGIX",
+    "glTexStorage3D",
+    "glTextureParameteriv",
+    "glNamedBufferDataEXT",
+    "glMultiTexCoord3fvARB",
+    "glUniformMatrix3x4fv",
+    "glSubpixelPrecisionBiasNV",
+    "glNormalPointer",
+    "glNamedFramebufferTexture",
+    "glVertexAttrib4NsvARB",
+    "glPassThrough",
+    "glSecondaryColorP3ui",
+    "glInvalidateTexSubImage",
+    "glIsImageHandleResidentARB",
+    "glTangent3fvEXT",
+    "glProgramUniformMatrix4x3fv",
+    "glBegin",
+    "glEvalCoord2dv",
+    "glColor3ubv",
+    "glFogCoordfvEXT",
+    "glVertexP3ui",
+    "glLightfv",
+    "glVertexAttribL3i64NV",
+    "glStencilClearTagEXT",
+    "glGetActiveUniformName",
+    "glTangentPointerEXT",
+    "glUniform4ui64vNV",
+    "glDebugMessageEnableAMD",
+    "glProgramUniform2ui",
+    "glCopyTexSubImage2DEXT",
+    "glGenRenderbuffersEXT",
+    "glNamedProgramLocalParameterI4ivEXT",
+    "glMultiTexCoord2f",
+    "glMapGrid2d",
+    "glGetMultiTexParameterIuivEXT",
+    "glBlendEquationiARB",
+    "glTexParameteriv",
+    "glUniform4ivARB",
+    "glMatrixOrthoEXT",
+    "glVertexArrayVertexBuffer",
+    "glProgramLocalParametersI4ivNV",
+    "glProgramUniform4ui64vNV",
+    "glGetNamedStringivARB",
+    "glVertexAttribL1i64vNV",
+    "glTransformFeedbackBufferBase",
+    "glIndexsv",
+    "glPointParameterivNV",
+    "glGetDetailTexFuncSGIS",
+    "glReplacementCodeuiColor3fVertex3fvSUN",
+    "glProgramLocalParameter4fARB",
+    "glBitmap",
+    "glNamedFramebufferTextureLayerEXT",
+    "glMultiTexGenfvEXT",
+    "glGetNamedBufferSubData",
+    "glStencilFuncSeparateATI",
+    "glProgramUniform2iv",
+    "glGetQueryiv",
+    "glTexCoord4f",
+    "glMapGrid2f",
+    "glListParameterivSGIX",
+    "glCreateQueries",
+    "glGetSamplerParameterfv",
+    "glTexCoord4i",
+    "glObjectLabel",
+    "glProgramUniform3i64NV",
+    "glGetTextureHandleARB",
+    "glTexCoord4s",
+    "glUniform4iARB",
+    "glGetUniformIndices",
+    "glMultiTexImage3DEXT",
+    "glCoverageModulationTableNV",
+    "glPointParameteriv",
+    "glMultiTexCoord4svARB",
+    "glNormal3fv",
+    "glProgramUniformMatrix3x4dvEXT",
+    "glTexCoord1fv",
+    "glProgramUniformMatrix4x3dvEXT",
+    "glGetActiveVaryingNV",
+    "glUniform1i64vARB",
+    "glMultiTexCoord1dv",
+    "glTexCoord3fv",
+    "glMatrixTranslatefEXT",
+    "glProgramUniform1ui64vNV",
+    "glTextureMaterialEXT",
+    "glMultiTexCoordP3uiv",
+    "glVertexAttribP3ui",
+    "glInterpolatePathsNV",
+    "glTextureBufferRange",
+    "glVertexAttribL2dEXT",
+    "glGetPixelTransformParameterivEXT",
+    "glTexCoord4xvOES",
+    "glGetVariantBooleanvEXT",
+    "glDepthRange",
+    "glGetVertexAttribdvARB",
+    "glGetColorTableParameterfv",
+    "glDrawArraysInstancedEXT",
+    "glDisableClientStateIndexedEXT",
+    "glDrawBuffer",
+    "glMultiDrawArraysIndirectBindlessNV",
+    "glGetnPixelMapusv",
+    "glRasterPos3fv",
+    "glClearBufferuiv",
+    "glGetInternalformati64v",
+    "glShaderSourceARB",
+    "glShaderOp3EXT",
+    "glWindowPos2dvMESA",
+    "glClearIndex",
+    "glProvokingVertexEXT",
+    "glVariantubvEXT",
+    "glFlush",
+    "glGetColorTableParameterivEXT",
+    "glPresentFrameDualFillNV",
+    "glGenVertexShadersEXT",
+    "glProgramUniformHandleui64vARB",
+    "glDepthRangefOES",
+    "glDrawElementsInstancedBaseVertexBaseInstance",
+    "glGetTexLevelParameteriv",
+    "glStencilFillPathNV",
+    "glWindowPos3iARB",
+    "glPrioritizeTextures",
+    "glWindowPos3fvMESA",
+    "glProgramUniformMatrix3x2dvEXT",
+    "glVertex4xvOES",
+    "glTexStorage3DMultisample",
+    "glWindowPos2sARB",
+    "glStencilOpValueAMD",
+    "glProgramVertexLimitNV",
+    "glGetTexParameterPointervAPPLE",
+    "glProgramUniform3uivEXT",
+    "glClampColor",
+    "glClearStencil",
+    "glTexCoordP1uiv",
+    "glVertexAttribs3svNV",
+    "glMultiTexCoord3fv",
+    "glVertexBlendEnvfATI",
+    "glIsFenceAPPLE",
+    "glGetBufferParameterui64vNV",
+    "glVertexAttribI4bvEXT",
+    "glUniform2fARB",
+    "glStopInstrumentsSGIX",
+    "glVertexAttrib3fNV",
+    "glMapVertexAttrib2dAPPLE",
+    "glVertex2f",
+    "glCopyTextureImage2DEXT",
+    "glVertex2d",
+    "glSecondaryColor3bvEXT",
+    "glMultiTexCoord4fARB",
+    "glPolygonOffset",
+    "glTangent3bvEXT",
+    "glHistogram",
+    "glGetProgramiv",
+    "glMatrixIndexubvARB",
+    "glVertex2s",
+    "glGetVertexAttribLui64vNV",
+    "glGetProgramStringARB",
+    "glFlushMappedBufferRange",
+    "glVertexAttribI3uiEXT",
+    "glLineWidthxOES",
+    "glProgramUniformMatrix2fvEXT",
+    "glGetTextureParameterIuivEXT",
+    "glGetMultiTexEnvivEXT",
+    "glPixelTexGenParameterivSGIS",
+    "glGenQueries",
+    "glGetPixelMapfv",
+    "glBlendColorEXT",
+    "glResetMinmax",
+    "glGetnUniformivARB",
+    "glVertexBlendARB",
+    "glVertexAttrib4d",
+    "glGetVaryingLocationNV",
+    "glGetMapAttribParameterivNV",
+    "glTexSubImage3D",
+    "glDeleteSamplers",
+    "glGetLightxOES",
+    "glGetVertexAttribArrayObjectfvATI",
+    "glVertexArrayNormalOffsetEXT",
+    "glGetBufferParameterivARB",
+    "glGetTextureParameterfv",
+    "glDrawMeshArraysSUN",
+    "glVertexAttrib4dNV",
+    "glGetMultisamplefvNV",
+    "glMapObjectBufferATI",
+    "glGetPathCommandsNV",
+    "glVertexArrayTexCoordOffsetEXT",
+    "glGetHistogram",
+    "glMatrixMode",
+    "glColorFormatNV",
+    "glProgramUniformui64NV",
+    "glProgramUniformMatrix4x2fvEXT",
+    "glLoadMatrixxOES",
+    "glGetColorTableParameterfvEXT",
+    "glRasterPos4i",
+    "glVertexAttribL2i64NV",
+    "glBindTextures",
+    "glMatrixRotatefEXT",
+    "glGetClipPlanexOES",
+    "glSecondaryColor3uivEXT",
+    "glGetPerfQueryInfoINTEL",
+    "glGetDoublev",
+    "glBindBufferRangeEXT",
+    "glCompressedTexImage2D",
+    "glMapBufferARB",
+    "glGetPathSpacingNV",
+    "glUniform4dv",
+    "glGlobalAlphaFactordSUN",
+    "glProgramUniform3dv",
+    "glGetShaderSourceARB",
+    "glVertexAttrib3dvARB",
+    "glInvalidateBufferData",
+    "glMatrixLoad3x2fNV",
+    "glCompressedTextureSubImage1D",
+    "glTexCoord3xvOES",
+    "glGenTexturesEXT",
+    "glTangent3iEXT",
+    "glClearTexImage",
+    "glBinormal3bvEXT",
+    "glUniform3fv",
+    "glGetnPixelMapusvARB",
+    "glMultiTexCoordP1ui",
+    "glClearNamedBufferDataEXT",
+    "glUniformMatrix4dv",
+    "glWindowPos3fMESA",
+    "glDeleteRenderbuffers",
+    "glGetTextureLevelParameterfvEXT",
+    "glGetHistogramParameterxvOES",
+    "glMultiDrawElements",
+    "glMakeImageHandleNonResidentNV",
+    "glTexSubImage1DEXT",
+    "glNormalStream3dATI",
+    "glVertexAttribL4i64vNV",
+    "glDrawBuffers",
+    "glCopyTextureSubImage1DEXT",
+    "glWindowRectanglesEXT",
+    "glNamedFramebufferReadBuffer",
+    "glUniform2i64vARB",
+    "glVertexAttribI1uivEXT",
+    "glGetTexGenfv",
+    "glBeginQueryARB",
+    "glUniform1iARB",
+    "glVertex4bvOES",
+    "glInvalidateSubFramebuffer",
+    "glUniform1fvARB",
+    "glTestFenceNV",
+    "glBindTransformFeedback",
+    "glMultiTexCoord2iv",
+    "glCopyMultiTexSubImage1DEXT",
+    "glVariantbvEXT",
+    "glTexCoord1hNV",
+    "glGenFencesNV",
+    "glRasterPos3iv",
+    "glVertexAttribL2ui64NV",
+    "glMultiTexCoord1hvNV",
+    "glGetnConvolutionFilter",
+    "glNormal3bv",
+    "glWeightbvARB",
+    "glTexCoord4sv",
+    "glUniform2uiv",
+    "glBeginConditionalRenderNVX",
+    "glFinish",
+    "glColorTableParameterfv",
+    "glFragmentCoverageColorNV",
+    "glProgramUniform3ivEXT",
+    "glVertexArrayVertexOffsetEXT",
+    "glViewportPositionWScaleNV",
+    "glGetProgramLocalParameterIuivNV",
+    "glReplacementCodeuiTexCoord2fVertex3fvSUN",
+    "glUniform1uiv",
+    "glUniformMatrix2dv",
+    "glIndexdv",
+    "glSecondaryColor3ivEXT",
+    "glTexCoord3iv",
+    "glVertexStream4fvATI",
+    "glDeformationMap3fSGIX",
+    "glClearDepth",
+    "glGenAsyncMarkersSGIX",
+    "glDisableIndexedEXT",
+    "glVertexWeightfvEXT",
+    "glGetProgramLocalParameterIivNV",
+    "glCompressedTexImage3DARB",
+    "glProgramParameter4fNV",
+    "glConvolutionParameterxOES",
+    "glInsertComponentEXT",
+    "glCreateTextures",
+    "glSecondaryColor3iv",
+    "glCreateBuffers",
+    "glMultiTexCoord2xvOES",
+    "glTexGenxvOES",
+    "glMultTransposeMatrixf",
+    "glBeginTransformFeedbackEXT",
+    "glTexCoord2fColor3fVertex3fSUN",
+    "glNormal3sv",
+    "glFreeObjectBufferATI",
+    "glBlendBarrierNV",
+    "glUniform4i64vNV",
+    "glGetnUniformuivARB",
+    "glAlphaFragmentOp3ATI",
+    "glProgramEnvParameters4fvEXT",
+    "glBlendFuncSeparateEXT",
+    "glConvolutionParameterivEXT",
+    "glPixelTexGenSGIX",
+    "glDeleteProgram",
+    "glUniformMatrix4x3dv",
+    "glGetVideoCaptureStreamivNV",
+    "glProgramUniform4uiEXT",
+    "glMakeImageHandleNonResidentARB",
+    "glSecondaryColor3dEXT",
+    "glDeleteQueries",
+    "glNormalP3uiv",
+    "glRasterPos2d",
+    "glInitNames",
+    "glBinormal3fvEXT",
+    "glColor3dv",
+    "glVertexArrayVertexAttribDivisorEXT",
+    "glArrayElementEXT",
+    "glProgramParameter4dNV",
+    "glIndexxOES",
+    "glUniform3uivEXT",
+    "glPopGroupMarkerEXT",
+    "glClearNamedFramebufferuiv",
+    "glSetLocalConstantEXT",
+    "glProgramUniform1ui64NV",
+    "glColor4hvNV",
+    "glGetVertexAttribfv",
+    "glDispatchCompute",
+    "glGetActiveAttrib",
+    "glFragmentColorMaterialSGIX",
+    "glTexSubImage2D",
+    "glGetnMinmaxARB",
+    "glLogicOp",
+    "glProgramUniformMatrix3x4fv",
+    "glWindowPos4iMESA",
+    "glPixelTransferf",
+    "glGetTextureParameterIuiv",
+    "glMultiTexCoord1xOES",
+    "glProgramUniformMatrix4dv",
+    "glGetnUniformiv",
+    "glFramebufferTexture1DEXT",
+    "glVertexPointervINTEL",
+    "glTextureParameterIiv",
+    "glGetSeparableFilterEXT",
+    "glMultiTexCoord3iARB",
+    "glRasterPos4xvOES",
+    "glDrawTransformFeedbackStream",
+    "glVertex3hvNV",
+    "glVertexArrayMultiTexCoordOffsetEXT",
+    "glProvokingVertex",
+    "glAccumxOES",
+    "glShaderBinary",
+    "glGetMultiTexGenivEXT",
+    "glPointParameterxvOES",
+    "glCreateStatesNV",
+    "glClearDepthdNV",
+    "glClearColorIuiEXT",
+    "glBindMultiTextureEXT",
+    "glTexGeniv",
+    "glDrawElements",
+    "glProgramUniform4iv",
+    "glDisableVertexArrayEXT",
+    "glProgramUniform3ui64NV",
+    "glClientActiveTexture",
+    "glMultiTexParameterIivEXT",
+    "glUniform1i64ARB",
+    "glUniform1iv",
+    "glVertexAttribArrayObjectATI",
+    "glUniform2iARB",
+    "glDrawArraysInstanced",
+    "glVertexAttrib2sNV",
+    "glTexBufferEXT",
+    "glVertexStream2fATI",
+    "glDebugMessageCallbackAMD",
+    "glSamplerParameteriv",
+    "glVertexAttrib4uiv",
+    "glEndQueryIndexed",
+    "glNormalStream3sATI",
+    "glProgramParameteriARB",
+    "glTexEnvxOES",
+    "glProgramUniform1iv",
+    "glDisableVertexAttribAPPLE",
+    "glBindRenderbuffer",
+    "glMultiTexSubImage3DEXT",
+    "glIsProgram",
+    "glMultiDrawElementsIndirectAMD",
+    "glGetProgramInfoLog",
+    "glGetLocalConstantBooleanvEXT",
+    "glPixelTransformParameteriEXT",
+    "glTexCoord4bOES",
+    "glVertexAttrib4fv",
+    "glProgramUniformMatrix2x3dv",
+    "glProgramEnvParametersI4uivNV",
+    "glTexCoord3xOES",
+    "glLoadTransposeMatrixfARB",
+    "glImageTransformParameteriHP",
+    "glMultiTexCoord4xOES",
+    "glVertexAttribs3fvNV",
+    "glVertexAttrib2fv",
+    "glUniform3ui64NV",
+    "glCombinerParameterfvNV",
+    "glFragmentMaterialiSGIX",
+    "glGetBooleani_v",
+    "glGetProgramResourceIndex",
+    "glBeginConditionalRenderNV",
+    "glDisableClientState",
+    "glPathFogGenNV",
+    "glStencilThenCoverFillPathNV",
+    "glVertexArrayIndexOffsetEXT",
+    "glProgramBufferParametersIuivNV",
+    "glPixelTransformParameterivEXT",
+    "glDisableClientStateiEXT",
+    "glTexBufferARB",
+    "glGetLocalConstantIntegervEXT",
+    "glColor4uiv",
+    "glProgramUniform3i",
+    "glMultiDrawElementsIndirectBindlessCountNV",
+    "glGetBufferPointervARB",
+    "glMultiTexParameterIuivEXT",
+    "glEvalMesh2",
+    "glEvalMesh1",
+    "glProgramUniform3f",
+    "glStencilThenCoverFillPathInstancedNV",
+    "glProgramUniform3d",
+    "glMapVertexAttrib1dAPPLE",
+    "glEvalCoord2fv",
+    "glGetUniformivARB",
+    "glLoadTransposeMatrixd",
+    "glLoadTransposeMatrixf",
+    "glGetPointervEXT",
+    "glEndConditionalRenderNV",
+    "glTexCoord2fNormal3fVertex3fSUN",
+    "glUniform3i64vARB",
+    "glProgramUniform2uiEXT",
+    "glVertexAttribI1ui",
+    "glProgramNamedParameter4dvNV",
+    "glCompileCommandListNV",
+    "glGetRenderbufferParameterivEXT",
+    "glGetnPolygonStipple",
+    "glIsBufferResidentNV",
+    "glSecondaryColor3ubvEXT",
+    "glGetNamedRenderbufferParameterivEXT",
+    "glNamedFramebufferSampleLocationsfvARB",
+    "glMultiTexGendvEXT",
+    "glVertexArrayRangeNV",
+    "glIsTextureHandleResidentNV",
+    "glGetProgramEnvParameterdvARB",
+    "glIsNamedStringARB",
+    "glSecondaryColorFormatNV",
+    "glVertexAttrib4ubvNV",
+    "glTagSampleBufferSGIX",
+    "glVDPAUUnregisterSurfaceNV",
+    "glGetPerfQueryIdByNameINTEL",
+    "glGetInteger64v",
+    "glClipPlane",
+    "glColor4ubVertex3fSUN",
+    "glIndexub",
+    "glGetProgramEnvParameterfvARB",
+    "glVertexAttrib4usvARB",
+    "glNamedFramebufferRenderbuffer",
+    "glProgramUniformMatrix3x4dv",
+    "glTestFenceAPPLE",
+    "glVertexAttrib4Niv",
+    "glVertexAttribL2i64vNV",
+    "glColorP4uiv",
+    "glUniformMatrix2x3fv",
+    "glCallCommandListNV",
+    "glClearBufferiv",
+    "glNamedStringARB",
+    "glMatrixMult3x2fNV",
+    "glGetNamedProgramStringEXT",
+    "glGetnHistogramARB",
+    "glGetTextureLevelParameterfv",
+    "glMultiTexCoord1fv",
+    "glBitmapxOES",
+    "glGetSamplerParameterIuiv",
+    "glTexCoordP3ui",
+    "glTextureSubImage1D",
+    "glVertexAttribLPointerEXT",
+    "glFogCoordPointerEXT",
+    "glWindowPos3s",
+    "glVertexAttribs2svNV",
+    "glTextureImage3DEXT",
+    "glWindowPos3i",
+    "glWindowPos3d",
+    "glWindowPos3f",
+    "glIsEnabledIndexedEXT",
+    "glGetNamedProgramivEXT",
+    "glVertex3xvOES",
+    "glColor3us",
+    "glBeginPerfMonitorAMD",
+    "glProgramUniformMatrix4x3dv",
+    "glGetNamedProgramLocalParameterIuivEXT",
+    "glReadnPixels",
+    "glMultiTexCoord4f",
+    "glColor3ub",
+    "glMultiTexCoord4d",
+    "glVertexAttribL3ui64NV",
+    "glColor3ui",
+    "glProgramUniform4fvEXT",
+    "glVertexAttrib2sARB",
+    "glMultiTexCoord4i",
+    "glCheckFramebufferStatusEXT",
+    "glGetnMapivARB",
+    "glMultiTexCoord1ivARB",
+    "glDisableVertexAttribArrayARB",
+    "glGetPolygonStipple",
+    "glVertexAttribI4ui",
+    "glGetPathDashArrayNV",
+    "glMultiTexRenderbufferEXT",
+    "glCopyTextureSubImage1D",
+    "glDeleteOcclusionQueriesNV",
+    "glVertex4hvNV",
+    "glGetnTexImage",
+    "glProgramLocalParameter4dARB",
+    "glBlendEquation",
+    "glUnlockArraysEXT",
+    "glGetQueryObjectui64vEXT",
+    "glVertexAttribI4uivEXT",
+    "glUniform1i64vNV",
+    "glMultiTexCoord3dv",
+    "glColor4sv",
+    "glVertexStream4ivATI",
+    "glPopClientAttrib",
+    "glClearBufferData",
+    "glGetProgramivNV",
+    "glBeginTransformFeedback",
+    "glFinishObjectAPPLE",
+    "glGetMinmaxParameterivEXT",
+    "glColor3iv",
+    "glVertexAttrib3sv",
+    "glCompressedTexImage1D",
+    "glDeleteTransformFeedbacks",
+    "glGetVideoi64vNV",
+    "glDrawRangeElementsBaseVertex",
+    "glUniform4i64vARB",
+    "glTextureStorage3DMultisampleEXT",
+    "glGetTexParameterfv",
+    "glProgramUniformui64vNV",
+    "glCompressedMultiTexImage1DEXT",
+    "glProgramUniform2ivEXT",
+    "glPushGroupMarkerEXT",
+    "glVertexAttrib1dv",
+    "glMatrixLoadIdentityEXT",
+    "glMultTransposeMatrixxOES",
+    "glGetPixelMapxv",
+    "glFramebufferSampleLocationsfvARB",
+    "glGetLightiv",
+    "glBlendFuncSeparatei",
+    "glGetBooleanIndexedvEXT",
+    "glGetProgramSubroutineParameteruivNV",
+    "glUniform2ui",
+    "glApplyFramebufferAttachmentCMAAINTEL",
+    "glWindowPos2fv",
+    "glDisablei",
+    "glSelectPerfMonitorCountersAMD",
+    "glGetVertexAttribLi64vNV",
+    "glBlendFuncSeparateiARB",
+    "glWeightuivARB",
+    "glWindowPos2iARB",
+    "glGetProgramLocalParameterdvARB",
+    "glGetUniformui64vARB",
+    "glGetSynciv",
+    "glMakeImageHandleResidentARB",
+    "glGetProgramNamedParameterfvNV",
+    "glTextureStorage3D",
+    "glVertexAttrib4svNV",
+    "glProgramUniform2i",
+    "glListDrawCommandsStatesClientNV",
+    "glProgramLocalParametersI4uivNV",
+    "glBeginTransformFeedbackNV",
+    "glGetProgramBinary",
+    "glBinormal3iEXT",
+    "glEvalPoint1",
+    "glEvalPoint2",
+    "glPauseTransformFeedback",
+    "glWindowPos2sMESA",
+    "glGlobalAlphaFactorbSUN",
+    "glCreateTransformFeedbacks",
+    "glTexturePageCommitmentEXT",
+    "glTransformFeedbackVaryingsNV",
+    "glTexSubImage1D",
+    "glConvolutionParameterfvEXT",
+    "glBlitFramebufferEXT",
+    "glUniformMatrix4fvARB",
+    "glProgramEnvParameter4dvARB",
+    "glSecondaryColor3hNV",
+    "glVertexAttribP3uiv",
+    "glFogCoordFormatNV",
+    "glGetMultiTexLevelParameterivEXT",
+    "glIsOcclusionQueryNV",
+    "glCompressedTexImage2DARB",
+    "glGetProgramEnvParameterIuivNV",
+    "glVertexAttrib4sv",
+    "glVertexAttrib4fvARB",
+    "glLoadName",
+    "glBindVertexShaderEXT",
+    "glGetNamedProgramLocalParameterIivEXT",
+    "glProgramUniform3uiEXT",
+    "glProgramUniformMatrix4x2dvEXT",
+    "glTexCoord1hvNV",
+    "glLoadMatrixd",
+    "glTexParameterfv",
+    "glVariantdvEXT",
+    "glCullParameterfvEXT",
+    "glUniform3dv",
+    "glProgramUniform3fv",
+    "glIsBufferARB",
+    "glMultiTexCoord1bOES",
+    "glFogCoordhNV",
+    "glFramebufferSampleLocationsfvNV",
+    "glGenSymbolsEXT",
+    "glGetConvolutionFilter",
+    "glProgramUniform1fvEXT",
+    "glGetNextPerfQueryIdINTEL",
+    "glCompressedTexImage1DARB",
+    "glBindSamplers",
+    "glGetProgramEnvParameterIivNV",
+    "glGetQueryObjectui64v",
+    "glVertexAttribL4ui64vNV",
+    "glGetVideoivNV",
+    "glGetTextureImage",
+    "glProgramUniform1fv",
+    "glUniformMatrix4fv",
+    "glColorMask",
+    "glBeginFragmentShaderATI",
+    "glMultiDrawArraysEXT",
+    "glGenNamesAMD",
+    "glPathParameteriNV",
+    "glCreateCommandListsNV",
+    "glDeleteProgramPipelines",
+    "glCopyColorSubTableEXT",
+    "glVariantsvEXT",
+    "glGenProgramPipelines",
+    "glVertexArrayEdgeFlagOffsetEXT",
+    "glWindowPos2s",
+    "glSecondaryColor3iEXT",
+    "glWindowPos2i",
+    "glWindowPos2f",
+    "glWindowPos2d",
+    "glUniform4uivEXT",
+    "glOrthoxOES",
+    "glUniformSubroutinesuiv",
+    "glRectdv",
+    "glProgramUniform1i64vNV",
+    "glVertexAttribI4uiEXT",
+    "glSecondaryColor3ubEXT",
+    "glCompressedMultiTexSubImage1DEXT",
+    "glMultiTexGendEXT",
+    "glColorP3uiv",
+    "glFogCoordfv",
+    "glCompileShader",
+    "glTexCoord2hNV",
+    "glUniform1uivEXT",
+    "glMatrixLoadTransposedEXT",
+    "glIndexfv",
+    "glGetCompressedTextureImage",
+    "glGetUniformuivEXT",
+    "glGetnPixelMapfvARB",
+    "glFramebufferTextureEXT",
+    "glVertexAttribIPointer",
+    "glMultiTexCoordP3ui",
+    "glEvaluateDepthValuesARB",
+    "glGetNamedBufferParameteriv",
+    "glGetNamedProgramLocalParameterfvEXT",
+    "glColor4fNormal3fVertex3fvSUN",
+    "glSeparableFilter2DEXT",
+    "glTexParameterxOES",
+    "glClearAccumxOES",
+    "glInvalidateFramebuffer",
+    "glWeightubvARB",
+    "glVertexAttrib1d",
+    "glVertexAttrib1f",
+    "glVertex4fv",
+    "glClearNamedFramebufferfi",
+    "glGetQueryBufferObjectuiv",
+    "glClearNamedFramebufferfv",
+    "glEndVertexShaderEXT",
+    "glVertexAttrib1s",
+    "glMultiTexCoord4dvARB",
+    "glMultiTexCoord1sv",
+    "glUniform1ui64vNV",
+    "glGetClipPlanefOES",
+    "glRasterPos2s",
+    "glWeightivARB",
+    "glMultiTexCoord4hvNV",
+    "glNormal3hNV",
+    "glGetSeparableFilter",
+    "glGetPathTexGenivNV",
+    "glColor4bv",
+    "glRasterPos2f",
+    "glNamedBufferPageCommitmentARB",
+    "glLoadIdentity",
+    "glRasterPos2i",
+    "glRasterPos4iv",
+    "glMultiTexCoord2fvARB",
+    "glUniformMatrix4x3fv",
+    "glClearBufferfv",
+    "glMultiTexCoord4hNV",
+    "glTextureBarrier",
+    "glReplacementCodeuivSUN",
+    "glDeleteAsyncMarkersSGIX",
+    "glTexCoord2bvOES",
+    "glEvalCoord2xOES",
+    "glGetSharpenTexFuncSGIS",
+    "glProgramUniformHandleui64vNV",
+    "glIglooInterfaceSGIX",
+    "glWindowPos2dvARB",
+    "glClearBufferfi",
+    "glDrawArraysIndirect",
+    "glGenVertexArrays",
+    "glGetTransformFeedbacki64_v",
+    "glEnableVertexArrayAttrib",
+    "glProgramUniformMatrix3x2dv",
+    "glVertexStream4fATI",
+    "glVertexBindingDivisor",
+    "glGetSamplerParameterIiv",
+    "glGetCoverageModulationTableNV",
+    "glDepthRangedNV",
+    "glVertexAttrib3f",
+    "glMultiDrawRangeElementArrayAPPLE",
+    "glVertexAttribFormatNV",
+    "glGetQueryBufferObjecti64v",
+    "glGetVertexAttribdv",
+    "glGetUniformi64vARB",
+    "glAreTexturesResidentEXT",
+    "glGetHandleARB",
+    "glVideoCaptureStreamParameterdvNV",
+    "glMapParameterivNV",
+    "glIsVertexArray",
+    "glSecondaryColor3sEXT",
+    "glGetTexParameterIivEXT",
+    "glFrameTerminatorGREMEDY",
+    "glBlendBarrierKHR",
+    "glVertexAttrib4NubARB",
+    "glPrimitiveRestartNV",
+    "glVertexAttribL1ui64vARB",
+    "glVertexAttribI4ivEXT",
+    "glVertexAttribs4svNV",
+    "glUniform1ui",
+    "glVertexAttrib2fvARB",
+    "glVertexAttribI4svEXT",
+    "glTextureImage3DMultisampleCoverageNV",
+    "glMemoryBarrier",
+    "glGetVariantArrayObjectfvATI",
+    "glTexCoord4fColor4fNormal3fVertex4fvSUN",
+    "glIsProgramARB",
+    "glBindImageTextureEXT",
+    "glGetFragDataLocation",
+    "glMultiTexCoord1svARB",
+    "glGetMapxvOES",
+    "glTextureStorage2DMultisampleEXT",
+    "glGetMaterialfv",
+    "glVertexAttrib4NbvARB",
+    "glPixelMapuiv",
+    "glColorPointerEXT",
+    "glEnableClientStateiEXT",
+    "glClearTexSubImage",
+    "glEvalCoord1xvOES",
+    "glDetachObjectARB",
+    "glGetTextureParameterIiv",
+    "glVariantusvEXT",
+    "glCompressedTextureImage3DEXT",
+    "glMultiTexCoord1dARB",
+    "glGetVertexArrayIntegeri_vEXT",
+    "glVertexAttribI4ubv",
+    "glPixelTexGenParameterfSGIS",
+    "glProgramUniformMatrix4x2dv",
+    "glUniform3fARB",
+    "glIsShader",
+    "glConvolutionParameteriv",
+    "glCopyMultiTexSubImage2DEXT",
+    "glEnableVertexAttribArrayARB",
+    "glEnable",
+    "glGetActiveUniformsiv",
+    "glGetVertexAttribivARB",
+    "glTexCoord4hvNV",
+    "glUseProgramObjectARB",
+    "glGetAttribLocation",
+    "glVertexAttrib4dv",
+    "glGetTextureParameteriv",
+    "glPathSubCoordsNV",
+    "glMatrixIndexusvARB",
+    "glGetVideouivNV",
+    "glGetVideoCaptureivNV",
+    "glProgramUniform3ui",
+    "glVertexAttrib3svARB",
+    "glGetNamedBufferParameterivEXT",
+    "glMatrixScaledEXT",
+    "glProgramUniformMatrix2x3fv",
+    "glGetFragmentLightivSGIX",
+    "glWindowPos2svARB",
+    "glVertexAttrib2svNV",
+    "glWindowPos2ivARB",
+    "glGetVertexAttribPointervNV",
+    "glPushMatrix",
+    "glEdgeFlagPointerListIBM",
+    "glGenerateMipmapEXT",
+    "glWindowPos3sv",
+    "glPathCoordsNV",
+    "glProgramUniform1i",
+    "glProgramUniform1d",
+    "glProgramUniform1f",
+    "glProgramParameteriEXT",
+    "glCompressedMultiTexImage2DEXT",
+    "glProgramUniform3iv",
+    "glIndexiv",
+    "glMultiTexCoord4xvOES",
+    "glEGLImageTargetTexture2DOES",
+    "glPixelZoom",
+    "glVertex3bvOES",
+    "glFramebufferReadBufferEXT",
+    "glExtractComponentEXT",
+    "glCombinerParameterivNV",
+    "glMinmax",
+    "glGenBuffersARB",
+    "glColor3usv",
+    "glBlendEquationi",
+    "glGetFogFuncSGIS",
+    "glVertexAttrib4fvNV",
+    "glGetnMinmax",
+    "glFragmentLightiSGIX",
+    "glMultiTexCoord1bvOES",
+    "glSecondaryColorPointerEXT",
+    "glMultiTexCoordP4uiv",
+    "glGetBufferSubDataARB",
+    "glGetPathParameterivNV",
+    "glFlushRasterSGIX",
+    "glElementPointerATI",
+    "glGetAttachedObjectsARB",
+    "glUniform4iv",
+    "glFogxOES",
+    "glSharpenTexFuncSGIS",
+    "glClearDepthfOES",
+    "glDeleteCommandListsNV",
+    "glVertex4hNV",
+    "glSecondaryColor3dvEXT",
+    "glGenTextures",
+    "glTextureStorage2DMultisample",
+    "glUniform3ui64vNV",
+    "glBlendFuncSeparateIndexedAMD",
+    "glMakeBufferResidentNV",
+    "glShaderOp2EXT",
+    "glGetVertexAttribivNV",
+    "glTexParameterIivEXT",
+    "glGetPerfQueryDataINTEL",
+    "glVertexAttrib4dvARB",
+    "glTextureSubImage1DEXT",
+    "glGetActiveUniformBlockName",
+    "glVertexAttrib2dvARB",
+    "glVertexAttribPointer",
+    "glDepthBoundsdNV",
+    "glDeleteTexturesEXT",
+    "glDrawBuffersATI",
+    "glLightModelxvOES",
+    "glApplyTextureEXT",
+    "glGetImageHandleNV",
+    "glGetMinmax",
+    "glGetFixedvOES",
+    "glSamplePatternEXT",
+    "glUniform1f",
+    "glColor4fNormal3fVertex3fSUN",
+    "glFogCoorddvEXT",
+    "glCopyTextureImage1DEXT",
+    "glFlushMappedBufferRangeAPPLE",
+    "glVertex3sv",
+    "glFlushStaticDataIBM",
+    "glProgramUniform4ui64NV",
+    "glRasterPos4xOES",
+    "glVertexAttribP1ui",
+    "glProgramUniform4dvEXT",
+    "glEndTransformFeedbackEXT",
+    "glBinormal3dEXT",
+    "glGetTextureSubImage",
+    "glGetNamedRenderbufferParameteriv",
+    "glBindBuffersRange",
+    "glFinishAsyncSGIX",
+    "glBindFragDataLocationIndexed",
+    "glMultiTexCoord2dv",
+    "glUniform2iv",
+    "glProgramUniform2i64vNV",
+    "glFlushVertexArrayRangeAPPLE",
+    "glTextureParameterf",
+    "glMultiTexCoord3dvARB",
+    "glFeedbackBuffer",
+    "glDebugMessageInsertARB",
+    "glMultiTexCoord2i",
+    "glTextureSubImage3D",
+    "glFramebufferTexture1D",
+    "glGetShaderiv",
+    "glMultiTexCoord2d",
+    "glArrayObjectATI",
+    "glGetPointeri_vEXT",
+    "glGetPerfMonitorCountersAMD",
+    "glNamedBufferStorage",
+    "glTexEnvxvOES",
+    "glProgramUniform2ui64NV",
+    "glMultiTexCoord3bOES",
+    "glUniform1dv",
+    "glPixelTransferi",
+    "glSecondaryColor3usvEXT",
+    "glProgramEnvParameterI4uivNV",
+    "glVertex2sv",
+    "glWindowPos4dMESA",
+    "glDebugMessageControlARB",
+    "glIsTextureEXT",
+    "glFragmentMaterialivSGIX",
+    "glLinkProgramARB",
+    "glFinishFenceAPPLE",
+    "glVertexArrayVertexAttribBindingEXT",
+    "glMultiTexCoord4fv",
+    "glRasterPos3i",
+    "glRasterPos3d",
+    "glPollAsyncSGIX",
+    "glRasterPos3f",
+    "glCompressedTexImage3D",
+    "glVariantivEXT",
+    "glUnmapTexture2DINTEL",
+    "glGetVertexAttribiv",
+    "glGetPathCoordsNV",
+    "glColor4xvOES",
+    "glVertexAttrib3fv",
+    "glRasterPos3s",
+    "glVertex4bOES",
+    "glTransformFeedbackVaryingsEXT",
+    "glCombinerOutputNV",
+    "glWindowPos4sMESA",
+    "glVertexAttrib4svARB",
+    "glIsList",
+    "glGetInfoLogARB",
+    "glUniformMatrix2fv",
+    "glVertexAttribs3dvNV",
+    "glGlobalAlphaFactorsSUN",
+    "glGetTrackMatrixivNV",
+    "glTextureParameterfvEXT",
+    "glIsNamedBufferResidentNV",
+    "glProgramUniform4ui64vARB",
+    "glTbufferMask3DFX",
+    "glCoverFillPathNV",
+    "glVertexAttrib1fvARB",
+    "glGenerateTextureMipmap",
+    "glNamedProgramLocalParameterI4uivEXT",
+    "glMultiDrawElementsBaseVertex",
+    "glProgramSubroutineParametersuivNV",
+    "glProgramUniformMatrix2x4dvEXT",
+    "glRotatexOES",
+    "glMemoryBarrierEXT",
+    "glVertexAttrib3svNV",
+    "glVertexStream3iATI",
+    "glCompressedTexSubImage1D",
+    "glSetFenceNV",
+    "glAttachObjectARB",
+    "glCopyConvolutionFilter1D",
+    "glProgramParameters4fvNV",
+    "glNamedFramebufferParameteriEXT",
+    "glVertexAttrib4Nsv",
+    "glVertexAttribI4usvEXT",
+    "glTextureBufferRangeEXT",
+    "glVertexP3uiv",
+    "glIsPathNV",
+    "glGetnUniformi64vARB",
+    "glFramebufferTextureMultiviewOVR",
+    "glCompressedMultiTexSubImage2DEXT",
+    "glGetnMapdv",
+    "glDebugMessageCallback",
+    "glTangent3svEXT",
+    "glVertexAttribParameteriAMD",
+    "glBufferSubDataARB",
+    "glGetVertexAttribLui64vARB",
+    "glVertexAttribL4ui64NV",
+    "glReplacementCodeuiColor4ubVertex3fSUN",
+    "glImageTransformParameterfHP",
+    "glMap1f",
+    "glRasterPos4fv",
+    "glVertex2bvOES",
+    "glGetMapControlPointsNV",
+    "glNamedProgramLocalParametersI4ivEXT",
+    "glBindBufferRangeNV",
+    "glVertexStream3dvATI",
+    "glNormalPointerListIBM",
+    "glFogFuncSGIS",
+    "glMultiModeDrawArraysIBM",
+    "glGetNamedFramebufferAttachmentParameterivEXT",
+    "glGetFloatv",
+    "glVertexArrayVertexAttribIFormatEXT",
+    "glHint",
+    "glPointAlongPathNV",
+    "glVertexStream2svATI",
+    "glMultiDrawArraysIndirect",
+    "glVertexAttribP2uiv",
+    "glProgramUniform1i64vARB",
+    "glFramebufferTextureARB",
+    "glPushClientAttribDefaultEXT",
+    "glScalef",
+    "glScaled",
+    "glGetConvolutionParameterxvOES",
+    "glGetProgramResourceName",
+    "glCopyColorTable",
+    "glDepthRangeArrayv",
+    "glCoverFillPathInstancedNV",
+    "glMultiTexParameterivEXT",
+    "glGetActiveAtomicCounterBufferiv",
+    "glStencilOpSeparate",
+    "glVertexAttrib4fNV",
+    "glGetColorTableParameterivSGI",
+    "glVertexArrayAttribBinding",
+    "glProgramParameters4dvNV",
+    "glVertexAttribL4dv",
+    "glVertexStream3dATI",
+    "glGetUniformOffsetEXT",
+    "glGetVertexAttribPointerv",
+    "glProgramUniform3i64vNV",
+    "glTangent3fEXT",
+    "glGetPathMetricRangeNV",
+    "glWindowPos2iMESA",
+    "glVertex2xvOES",
+    "glGetnCompressedTexImage",
+    "glWindowPos2dv",
+    "glReplacementCodeuiVertex3fSUN",
+    "glGetTransformFeedbackVaryingEXT",
+    "glWindowPos3fARB",
+    "glMapNamedBufferEXT",
+    "glDisable",
+    "glIsPointInFillPathNV",
+    "glVertexAttribI2uiEXT",
+    "glProgramUniform4uiv",
+    "glQueryCounter",
+    "glFramebufferRenderbufferEXT",
+    "glBinormal3svEXT",
+    "glBindBufferOffsetNV",
+    "glCopyTextureSubImage2D",
+    "glGetProgramResourcefvNV",
+    "glBinormalPointerEXT",
+    "glGetLightfv",
+    "glVertex2bOES",
+    "glUniform2ivARB",
+    "glMultiTexCoord3s",
+    "glGetHistogramParameterfvEXT",
+    "glGetProgramStringNV",
+    "glGetTexGenxvOES",
+    "glTextureSubImage2D",
+    "glObjectPurgeableAPPLE",
+    "glColorTableSGI",
+    "glCopyConvolutionFilter2DEXT",
+    "glMultiTexCoord3f",
+    "glMultiTexCoord3d",
+    "glFogCoorddv",
+    "glGetBufferPointerv",
+    "glProgramUniform1fEXT",
+    "glWindowPos2fvMESA",
+    "glPolygonOffsetxOES",
+    "glVertexAttrib4dARB",
+    "glUniformHandleui64vARB",
+    "glFragmentLightModelfvSGIX",
+    "glSwizzleEXT",
+    "glBindFragmentShaderATI",
+    "glVertexAttribs3hvNV",
+    "glColorP3ui",
+    "glListParameterfvSGIX",
+    "glNamedRenderbufferStorageMultisample",
+    "glVertexAttribI1iEXT",
+    "glMultiTexCoord2ivARB",
+    "glLightModelxOES",
+    "glColor3xOES",
+    "glReadBuffer",
+    "glStencilFillPathInstancedNV",
+    "glVDPAUUnmapSurfacesNV",
+    "glProgramUniform4i64NV",
+    "glVertexStream4dvATI",
+    "glIsQuery",
+    "glProgramUniformMatrix4fvEXT",
+    "glVertexAttrib3hNV",
+    "glFlushMappedNamedBufferRange",
+    "glPushName",
+    "glGetClipPlane",
+    "glVertex4dv",
+    "glVertexAttrib3d",
+    "glBlendColor",
+    "glBindTransformFeedbackNV",
+    "glSamplerParameterIuiv",
+    "glIndexubv",
+    "glNamedBufferPageCommitmentEXT",
+    "glCheckNamedFramebufferStatus",
+    "glGetObjectBufferfvATI",
+    "glRasterPos4d",
+    "glRasterPos4f",
+    "glGetPerfMonitorCounterStringAMD",
+    "glVertexAttrib3s",
+    "glDrawElementsInstancedEXT",
+    "glNamedProgramLocalParameterI4iEXT",
+    "glRasterPos4s",
+    "glGetProgramStageiv",
+    "glGetMaterialxOES",
+    "glPopMatrix",
+    "glGetVideoui64vNV",
+    "glTangent3bEXT",
+    "glGetGraphicsResetStatusARB",
+    "glUniform4i",
+    "glActiveTexture",
+    "glEnableVertexAttribArray",
+    "glTexCoord4fVertex4fvSUN",
+    "glUniform4d",
+    "glUniform4f",
+    "glRenderbufferStorageMultisample",
+    "glCreateProgramPipelines",
+    "glVertexAttribLPointer",
+    "glUniform2uiEXT",
+    "glMultiTexCoord3sv",
+    "glDrawElementsInstancedBaseVertex",
+    "glPixelTransformParameterfvEXT",
+    "glDrawTransformFeedbackNV",
+    "glTextureImage2DMultisampleCoverageNV",
+    "glNamedRenderbufferStorageMultisampleCoverageEXT",
+    "glIsTexture",
+    "glMultiTexCoord4iv",
+    "glTexEnvfv",
+    "glPopDebugGroup",
+    "glUniformBlockBinding",
+    "glWindowPos2svMESA",
+    "glGenerateTextureMipmapEXT",
+    "glBindLightParameterEXT",
+    "glTexCoord3bOES",
+    "glTexCoordPointer",
+    "glProgramUniformMatrix3x2fv",
+    "glUniform2fvARB",
+    "glProgramLocalParameterI4uivNV",
+    "glFlushVertexArrayRangeNV",
+    "glSecondaryColor3svEXT",
+    "glGetBufferParameteriv",
+    "glGetQueryIndexediv",
+    "glFramebufferTexture3DEXT",
+    "glLoadTransposeMatrixxOES",
+    "glDeleteTransformFeedbacksNV",
+    "glGetCompressedTextureImageEXT",
+    "glIndexMaterialEXT",
+    "glFogCoorddEXT",
+    "glTexCoord2hvNV",
+    "glFramebufferTexture2DEXT",
+    "glTexEnviv",
+    "glEndTransformFeedbackNV",
+    "glGlobalAlphaFactoruiSUN",
+    "glSelectBuffer",
+    "glNamedBufferSubDataEXT",
+    "glDisableVertexArrayAttrib",
+    "glBlendFunc",
+    "glCreateProgram",
+    "glVertexStream2dATI",
+    "glUniform4ui64vARB",
+    "glPrimitiveRestartIndex",
+    "glNormalStream3fATI",
+    "glProgramUniformMatrix2fv",
+    "glVertexAttribs1hvNV",
+    "glWindowPos4svMESA",
+    "glDeleteFragmentShaderATI",
+    "glBindImageTextures",
+    "glMap2xOES",
+    "glEnd",
+    "glMultiTexCoord2dARB",
+    "glUniform1i64NV",
+    "glPathStringNV",
+    "glGetNamedFramebufferParameterivEXT",
+    "glGetProgramNamedParameterdvNV",
+    "glPathDashArrayNV",
+    "glUniform3uiv",
+    "glColor3fVertex3fvSUN",
+    "glMultTransposeMatrixd",
+    "glClearColor",
+    "glGetImageHandleARB",
+    "glTangent3dEXT",
+    "glGetQueryObjectivARB",
+    "glGetLocalConstantFloatvEXT",
+    "glUseShaderProgramEXT",
+    "glBindRenderbufferEXT",
+    "glInterleavedArrays",
+    "glGetPerfMonitorGroupStringAMD",
+    "glUniform3ui",
+    "glGetNamedProgramLocalParameterdvEXT",
+    "glSecondaryColor3us",
+    "glVertexAttribI4uiv",
+    "glVertexAttrib4bv",
+    "glMultiTexCoord3xOES",
+    "glSecondaryColor3ub",
+    "glFragmentMaterialfSGIX",
+    "glGetVariantArrayObjectivATI",
+    "glSecondaryColor3ui",
+    "glVertexAttrib1dARB",
+    "glGetNamedBufferPointerv",
+    "glLockArraysEXT",
+    "glVertexAttribPointerNV",
+    "glConvolutionParameterf",
+    "glBindBufferBaseEXT",
+    "glTexCoord2xvOES",
+    "glGetQueryBufferObjectui64v",
+    "glSetMultisamplefvAMD",
+    "glPathColorGenNV",
+    "glVertexAttrib3sARB",
+    "glVertexAttrib4ivARB",
+    "glGenTransformFeedbacks",
+    "glGetVertexAttribIuiv",
+    "glPixelTransformParameterfEXT",
+    "glGetTexParameterIuivEXT",
+    "glGetObjectParameterivARB",
+    "glVertexArraySecondaryColorOffsetEXT",
+    "glWindowPos2fARB",
+    "glCompressedTexSubImage2D",
+    "glCompressedTexSubImage3DARB",
+    "glProgramBinary",
+    "glPresentFrameKeyedNV",
+    "glVertexAttribI4bv",
+    "glPathCoverDepthFuncNV",
+    "glTransformFeedbackStreamAttribsNV",
+    "glSecondaryColor3usEXT",
+    "glCopyColorTableSGI",
+    "glProgramEnvParameter4fvARB",
+    "glMultiTexCoord4sARB",
+    "glGetVertexArrayIndexed64iv",
+    "glMatrixMultTranspose3x3fNV",
+    "glTexParameterIiv",
+    "glVertexArrayAttribFormat",
+    "glEndTransformFeedback",
+    "glDrawCommandsStatesAddressNV",
+    "glUniform4ui64NV",
+    "glMaterialiv",
+    "glTexImage2DMultisample",
+    "glBindTextureEXT",
+    "glIsBuffer",
+    "glVertexAttribI1iv",
+    "glGetFinalCombinerInputParameterfvNV",
+    "glMultiTexCoord3bvOES",
+    "glVertexAttribDivisor",
+    "glCopyBufferSubData",
+    "glBindTexGenParameterEXT",
+    "glNormalStream3bATI",
+    "glTextureImage2DEXT",
+    "glGetColorTableParameteriv",
+    "glActiveTextureARB",
+    "glTexCoord4xOES",
+    "glSecondaryColor3fvEXT",
+    "glUniformMatrix4x2fv",
+    "glStartInstrumentsSGIX",
+    "glProgramNamedParameter4fvNV",
+    "glEndVideoCaptureNV",
+    "glGenLists",
+    "glUniform1fARB",
+    "glNamedFramebufferTexture1DEXT",
+    "glMapBufferRange",
+    "glMultiDrawElementsIndirectCountARB",
+    "glProgramUniformMatrix4x2fv",
+    "glGetTextureParameterIivEXT",
+    "glMultiTexCoord3hNV",
+    "glNamedProgramLocalParametersI4uivEXT",
+    "glEndList",
+    "glTexCoord2fColor4fNormal3fVertex3fSUN",
+    "glGenTransformFeedbacksNV",
+    "glEdgeFlagv",
+    "glVertexAttribI2iv",
+    "glCopyMultiTexImage2DEXT",
+    "glUniformMatrix3x2dv",
+    "glTexImage3DMultisampleCoverageNV",
+    "glGetShaderPrecisionFormat",
+    "glTexSubImage4DSGIS",
+    "glRasterSamplesEXT",
+    "glTextureView",
+    "glEvalMapsNV",
+    "glGetFragDataLocationEXT",
+    "glGetCompressedMultiTexImageEXT",
+    "glIndexMask",
+    "glPushClientAttrib",
+    "glShaderSource",
+    "glDispatchComputeGroupSizeARB",
+    "glGetnPixelMapfv",
+    "glTexCoordP2uiv",
+    "glUniform2f",
+    "glGetNamedBufferParameteri64v",
+    "glCommandListSegmentsNV",
+    "glTextureParameterIivEXT",
+    "glMultiTexParameterfvEXT",
+    "glProgramUniform2ui64ARB",
+    "glVertex4d",
+    "glNewObjectBufferATI",
+    "glViewportSwizzleNV",
+    "glBufferData",
+    "glTextureImage1DEXT",
+    "glGetTexParameterIiv",
+    "glCopyTexSubImage1DEXT",
+    "glVertex4f",
+    "glUniformMatrix3fvARB",
+    "glTexCoordP1ui",
+    "glPointParameterfvEXT",
+    "glUniform4fARB",
+    "glCopyTextureSubImage3D",
+    "glMultiTexCoord2fv",
+    "glMultiTexEnvfvEXT",
+    "glNormalP3ui",
+    "glDrawRangeElementArrayATI",
+    "glVertexAttribI1i",
+    "glDrawArraysInstancedARB",
+    "glEnableVertexAttribAPPLE",
+    "glGetDebugMessageLogARB",
+    "glGetPathTexGenfvNV",
+    "glNamedProgramLocalParameters4fvEXT",
+    "glVertexStream3fvATI",
+    "glFramebufferTexture3D",
+    "glCompressedTextureSubImage2DEXT",
+    "glWindowPos3dv",
+    "glCopyConvolutionFilter2D",
+    "glReadInstrumentsSGIX",
+    "glSamplerParameterfv",
+    "glBindBufferARB",
+    "glVertexAttrib1sNV",
+    "glGetMaterialiv",
+    "glUniform1fv",
+    "glBeginOcclusionQueryNV",
+    "glGenFencesAPPLE",
+    "glScissorIndexedv",
+    "glDisableVariantClientStateEXT",
+    "glMinmaxEXT",
+    "glNormalPointervINTEL",
+    "glNormal3s",
+    "glGetnPixelMapuiv",
+    "glNormalStream3bvATI",
+    "glGetObjectParameterivAPPLE",
+    "glNormal3i",
+    "glUniform1ivARB",
+    "glNormal3d",
+    "glUpdateObjectBufferATI",
+    "glNormal3b",
+    "glGetUniformBufferSizeEXT",
+    "glMultiTexCoord4dv",
+    "glProgramUniform3i64ARB",
+    "glVertexAttrib2d",
+    "glVertexAttrib2f",
+    "glMultiDrawElementsEXT",
+    "glVertexAttrib3dv",
+    "glMultiTexCoord2bOES",
+    "glVertexAttrib2s",
+    "glTexImage3DMultisample",
+    "glGetUniformBlockIndex",
+    "glFrontFace",
+    "glEvalCoord1xOES",
+    "glDrawArraysInstancedBaseInstance",
+    "glIsPointInStrokePathNV",
+  };
+  return names[id];
+}
+void m_glMultiDrawArraysIndirectBindlessCountNV_profiling(GLenum mode,const void* indirect,GLsizei drawCount,GLsizei maxDrawCount,GLsizei stride,GLint vertexBufferCount)const{auto const profilingStart=this->profiler.begin(0);(this->*((FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSINDIRECTBINDLESSCOUNTNVPROC)this->m_profiledFunctions[0]))(mode,indirect,drawCount,maxDrawCount,stride,vertexBufferCount);this->profiler.end(0,profilingStart);}
+void m_glTextureParameterfv_profiling(GLuint texture,GLenum pname,const GLfloat* param)const{auto const profilingStart=this->profiler.begin(1);(this->*((FunctionTable::MEMBERPFNGLTEXTUREPARAMETERFVPROC)this->m_profiledFunctions[1]))(texture,pname,param);this->profiler.end(1,profilingStart);}
+void m_glGetListParameterivSGIX_profiling(GLuint list,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(2);(this->*((FunctionTable::MEMBERPFNGLGETLISTPARAMETERIVSGIXPROC)this->m_profiledFunctions[2]))(list,pname,params);this->profiler.end(2,profilingStart);}
+void m_glProgramUniform1i64ARB_profiling(GLuint program,GLint location,GLint64 x)const{auto const profilingStart=this->profiler.begin(3);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1I64ARBPROC)this->m_profiledFunctions[3]))(program,location,x);this->profiler.end(3,profilingStart);}
+void m_glVertexArrayElementBuffer_profiling(GLuint vaobj,GLuint buffer)const{auto const profilingStart=this->profiler.begin(4);(this->*((FunctionTable::MEMBERPFNGLVERTEXARRAYELEMENTBUFFERPROC)this->m_profiledFunctions[4]))(vaobj,buffer);this->profiler.end(4,profilingStart);}
+void m_glHintPGI_profiling(GLenum target,GLint mode)const{auto const profilingStart=this->profiler.begin(5);(this->*((FunctionTable::MEMBERPFNGLHINTPGIPROC)this->m_profiledFunctions[5]))(target,mode);this->profiler.end(5,profilingStart);}
+void m_glStencilMaskSeparate_profiling(GLenum face,GLuint mask)const{auto const profilingStart=this->profiler.begin(6);(this->*((FunctionTable::MEMBERPFNGLSTENCILMASKSEPARATEPROC)this->m_profiledFunctions[6]))(face,mask);this->profiler.end(6,profilingStart);}
+void m_glGetFramebufferAttachmentParameterivEXT_profiling(GLenum target,GLenum attachment,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(7);(this->*((FunctionTable::MEMBERPFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVEXTPROC)this->m_profiledFunctions[7]))(target,attachment,pname,params);this->profiler.end(7,profilingStart);}
+void m_glTextureStorage3DMultisample_profiling(GLuint texture,GLsizei samples,GLenum internalformat,GLsizei width,GLsizei height,GLsizei depth,GLboolean fixedsamplelocations)const{auto const profilingStart=this->profiler.begin(8);(this->*((FunctionTable::MEMBERPFNGLTEXTURESTORAGE3DMULTISAMPLEPROC)this->m_profiledFunctions[8]))(texture,samples,internalformat,width,height,depth,fixedsamplelocations);this->profiler.end(8,profilingStart);}
+void m_glGetIntegerIndexedvEXT_profiling(GLenum target,GLuint index,GLint* data)const{auto const profilingStart=this->profiler.begin(9);(this->*((FunctionTable::MEMBERPFNGLGETINTEGERINDEXEDVEXTPROC)this->m_profiledFunctions[9]))(target,index,data);this->profiler.end(9,profilingStart);}
+void m_glCopyTexImage1D_profiling(GLenum target,GLint level,GLenum internalformat,GLint x,GLint y,GLsizei width,GLint border)const{auto const profilingStart=this->profiler.begin(10);(this->*((FunctionTable::MEMBERPFNGLCOPYTEXIMAGE1DPROC)this->m_profiledFunctions[10]))(target,level,internalformat,x,y,width,border);this->profiler.end(10,profilingStart);}
+void m_glVertexAttrib4usv_profiling(GLuint index,const GLushort* v)const{auto const profilingStart=this->profiler.begin(11);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB4USVPROC)this->m_profiledFunctions[11]))(index,v);this->profiler.end(11,profilingStart);}
+void m_glTexRenderbufferNV_profiling(GLenum target,GLuint renderbuffer)const{auto const profilingStart=this->profiler.begin(12);(this->*((FunctionTable::MEMBERPFNGLTEXRENDERBUFFERNVPROC)this->m_profiledFunctions[12]))(target,renderbuffer);this->profiler.end(12,profilingStart);}
+void m_glVertexAttrib3hvNV_profiling(GLuint index,const GLhalfNV* v)const{auto const profilingStart=this->profiler.begin(13);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB3HVNVPROC)this->m_profiledFunctions[13]))(index,v);this->profiler.end(13,profilingStart);}
+void m_glProgramUniform4ui64ARB_profiling(GLuint program,GLint location,GLuint64 x,GLuint64 y,GLuint64 z,GLuint64 w)const{auto const profilingStart=this->profiler.begin(14);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UI64ARBPROC)this->m_profiledFunctions[14]))(program,location,x,y,z,w);this->profiler.end(14,profilingStart);}
+void m_glInstrumentsBufferSGIX_profiling(GLsizei size,GLint* buffer)const{auto const profilingStart=this->profiler.begin(15);(this->*((FunctionTable::MEMBERPFNGLINSTRUMENTSBUFFERSGIXPROC)this->m_profiledFunctions[15]))(size,buffer);this->profiler.end(15,profilingStart);}
+void m_glIndexi_profiling(GLint c)const{auto const profilingStart=this->profiler.begin(16);(this->*((FunctionTable::MEMBERPFNGLINDEXIPROC)this->m_profiledFunctions[16]))(c);this->profiler.end(16,profilingStart);}
+void m_glMultiTexCoord2sARB_profiling(GLenum target,GLshort s,GLshort t)const{auto const profilingStart=this->profiler.begin(17);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD2SARBPROC)this->m_profiledFunctions[17]))(target,s,t);this->profiler.end(17,profilingStart);}
+void m_glProgramEnvParameter4fARB_profiling(GLenum target,GLuint index,GLfloat x,GLfloat y,GLfloat z,GLfloat w)const{auto const profilingStart=this->profiler.begin(18);(this->*((FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETER4FARBPROC)this->m_profiledFunctions[18]))(target,index,x,y,z,w);this->profiler.end(18,profilingStart);}
+void m_glCompressedTexSubImage3D_profiling(GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLenum format,GLsizei imageSize,const GLvoid* data)const{auto const profilingStart=this->profiler.begin(19);(this->*((FunctionTable::MEMBERPFNGLCOMPRESSEDTEXSUBIMAGE3DPROC)this->m_profiledFunctions[19]))(target,level,xoffset,yoffset,zoffset,width,height,depth,format,imageSize,data);this->profiler.end(19,profilingStart);}
+void m_glEvalCoord2d_profiling(GLdouble u,GLdouble v)const{auto const profilingStart=this->profiler.begin(20);(this->*((FunctionTable::MEMBERPFNGLEVALCOORD2DPROC)this->m_profiledFunctions[20]))(u,v);this->profiler.end(20,profilingStart);}
+void m_glEvalCoord2f_profiling(GLfloat u,GLfloat v)const{auto const profilingStart=this->profiler.begin(21);(this->*((FunctionTable::MEMBERPFNGLEVALCOORD2FPROC)this->m_profiledFunctions[21]))(u,v);this->profiler.end(21,profilingStart);}
+void m_glIndexd_profiling(GLdouble c)const{auto const profilingStart=this->profiler.begin(22);(this->*((FunctionTable::MEMBERPFNGLINDEXDPROC)this->m_profiledFunctions[22]))(c);this->profiler.end(22,profilingStart);}
+void m_glSecondaryColor3hvNV_profiling(const GLhalfNV* v)const{auto const profilingStart=this->profiler.begin(23);(this->*((FunctionTable::MEMBERPFNGLSECONDARYCOLOR3HVNVPROC)this->m_profiledFunctions[23]))(v);this->profiler.end(23,profilingStart);}
+void m_glIndexf_profiling(GLfloat c)const{auto const profilingStart=this->profiler.begin(24);(this->*((FunctionTable::MEMBERPFNGLINDEXFPROC)this->m_profiledFunctions[24]))(c);this->profiler.end(24,profilingStart);}
+void m_glFrustumxOES_profiling(GLfixed l,GLfixed r,GLfixed b,GLfixed t,GLfixed n,GLfixed f)const{auto const profilingStart=this->profiler.begin(25);(this->*((FunctionTable::MEMBERPFNGLFRUSTUMXOESPROC)this->m_profiledFunctions[25]))(l,r,b,t,n,f);this->profiler.end(25,profilingStart);}
+void m_glTextureStorage3DEXT_profiling(GLuint texture,GLenum target,GLsizei levels,GLenum internalformat,GLsizei width,GLsizei height,GLsizei depth)const{auto const profilingStart=this->profiler.begin(26);(this->*((FunctionTable::MEMBERPFNGLTEXTURESTORAGE3DEXTPROC)this->m_profiledFunctions[26]))(texture,target,levels,internalformat,width,height,depth);this->profiler.end(26,profilingStart);}
+void m_glDrawCommandsStatesNV_profiling(GLuint buffer,const GLintptr* indirects,const GLsizei* sizes,const GLuint* states,const GLuint* fbos,GLuint count)const{auto const profilingStart=this->profiler.begin(27);(this->*((FunctionTable::MEMBERPFNGLDRAWCOMMANDSSTATESNVPROC)this->m_profiledFunctions[27]))(buffer,indirects,sizes,states,fbos,count);this->profiler.end(27,profilingStart);}
+void m_glUniform4uiEXT_profiling(GLint location,GLuint v0,GLuint v1,GLuint v2,GLuint v3)const{auto const profilingStart=this->profiler.begin(28);(this->*((FunctionTable::MEMBERPFNGLUNIFORM4UIEXTPROC)this->m_profiledFunctions[28]))(location,v0,v1,v2,v3);this->profiler.end(28,profilingStart);}
+void m_glProgramUniform3ui64ARB_profiling(GLuint program,GLint location,GLuint64 x,GLuint64 y,GLuint64 z)const{auto const profilingStart=this->profiler.begin(29);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UI64ARBPROC)this->m_profiledFunctions[29]))(program,location,x,y,z);this->profiler.end(29,profilingStart);}
+void m_glIndexs_profiling(GLshort c)const{auto const profilingStart=this->profiler.begin(30);(this->*((FunctionTable::MEMBERPFNGLINDEXSPROC)this->m_profiledFunctions[30]))(c);this->profiler.end(30,profilingStart);}
+void m_glVertexArrayBindVertexBufferEXT_profiling(GLuint vaobj,GLuint bindingindex,GLuint buffer,GLintptr offset,GLsizei stride)const{auto const profilingStart=this->profiler.begin(31);(this->*((FunctionTable::MEMBERPFNGLVERTEXARRAYBINDVERTEXBUFFEREXTPROC)this->m_profiledFunctions[31]))(vaobj,bindingindex,buffer,offset,stride);this->profiler.end(31,profilingStart);}
+void m_glConvolutionParameteriEXT_profiling(GLenum target,GLenum pname,GLint params)const{auto const profilingStart=this->profiler.begin(32);(this->*((FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERIEXTPROC)this->m_profiledFunctions[32]))(target,pname,params);this->profiler.end(32,profilingStart);}
+void m_glColor4ubVertex2fSUN_profiling(GLubyte r,GLubyte g,GLubyte b,GLubyte a,GLfloat x,GLfloat y)const{auto const profilingStart=this->profiler.begin(33);(this->*((FunctionTable::MEMBERPFNGLCOLOR4UBVERTEX2FSUNPROC)this->m_profiledFunctions[33]))(r,g,b,a,x,y);this->profiler.end(33,profilingStart);}
+void m_glProgramUniform1ivEXT_profiling(GLuint program,GLint location,GLsizei count,const GLint* value)const{auto const profilingStart=this->profiler.begin(34);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1IVEXTPROC)this->m_profiledFunctions[34]))(program,location,count,value);this->profiler.end(34,profilingStart);}
+void m_glGetnMapfv_profiling(GLenum target,GLenum query,GLsizei bufSize,GLfloat* v)const{auto const profilingStart=this->profiler.begin(35);(this->*((FunctionTable::MEMBERPFNGLGETNMAPFVPROC)this->m_profiledFunctions[35]))(target,query,bufSize,v);this->profiler.end(35,profilingStart);}
+void m_glTransformFeedbackBufferRange_profiling(GLuint xfb,GLuint index,GLuint buffer,GLintptr offset,GLsizeiptr size)const{auto const profilingStart=this->profiler.begin(36);(this->*((FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC)this->m_profiledFunctions[36]))(xfb,index,buffer,offset,size);this->profiler.end(36,profilingStart);}
+void m_glPathGlyphsNV_profiling(GLuint firstPathName,GLenum fontTarget,const void* fontName,GLbitfield fontStyle,GLsizei numGlyphs,GLenum type,const void* charcodes,GLenum handleMissingGlyphs,GLuint pathParameterTemplate,GLfloat emScale)const{auto const profilingStart=this->profiler.begin(37);(this->*((FunctionTable::MEMBERPFNGLPATHGLYPHSNVPROC)this->m_profiledFunctions[37]))(firstPathName,fontTarget,fontName,fontStyle,numGlyphs,type,charcodes,handleMissingGlyphs,pathParameterTemplate,emScale);this->profiler.end(37,profilingStart);}
+void m_glSecondaryColor3fv_profiling(const GLfloat* v)const{auto const profilingStart=this->profiler.begin(38);(this->*((FunctionTable::MEMBERPFNGLSECONDARYCOLOR3FVPROC)this->m_profiledFunctions[38]))(v);this->profiler.end(38,profilingStart);}
+void m_glGetCombinerInputParameterivNV_profiling(GLenum stage,GLenum portion,GLenum variable,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(39);(this->*((FunctionTable::MEMBERPFNGLGETCOMBINERINPUTPARAMETERIVNVPROC)this->m_profiledFunctions[39]))(stage,portion,variable,pname,params);this->profiler.end(39,profilingStart);}
+void m_glEndPerfMonitorAMD_profiling(GLuint monitor)const{auto const profilingStart=this->profiler.begin(40);(this->*((FunctionTable::MEMBERPFNGLENDPERFMONITORAMDPROC)this->m_profiledFunctions[40]))(monitor);this->profiler.end(40,profilingStart);}
+void m_glPointParameterfvARB_profiling(GLenum pname,const GLfloat* params)const{auto const profilingStart=this->profiler.begin(41);(this->*((FunctionTable::MEMBERPFNGLPOINTPARAMETERFVARBPROC)this->m_profiledFunctions[41]))(pname,params);this->profiler.end(41,profilingStart);}
+void m_glVertex2xOES_profiling(GLfixed x)const{auto const profilingStart=this->profiler.begin(42);(this->*((FunctionTable::MEMBERPFNGLVERTEX2XOESPROC)this->m_profiledFunctions[42]))(x);this->profiler.end(42,profilingStart);}
+void m_glDrawElementsInstancedBaseInstance_profiling(GLenum mode,GLsizei count,GLenum type,const void* indices,GLsizei instancecount,GLuint baseinstance)const{auto const profilingStart=this->profiler.begin(43);(this->*((FunctionTable::MEMBERPFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC)this->m_profiledFunctions[43]))(mode,count,type,indices,instancecount,baseinstance);this->profiler.end(43,profilingStart);}
+void m_glMultTransposeMatrixdARB_profiling(const GLdouble* m)const{auto const profilingStart=this->profiler.begin(44);(this->*((FunctionTable::MEMBERPFNGLMULTTRANSPOSEMATRIXDARBPROC)this->m_profiledFunctions[44]))(m);this->profiler.end(44,profilingStart);}
+void m_glVertexAttribL4dEXT_profiling(GLuint index,GLdouble x,GLdouble y,GLdouble z,GLdouble w)const{auto const profilingStart=this->profiler.begin(45);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBL4DEXTPROC)this->m_profiledFunctions[45]))(index,x,y,z,w);this->profiler.end(45,profilingStart);}
+void m_glVertex4iv_profiling(const GLint* v)const{auto const profilingStart=this->profiler.begin(46);(this->*((FunctionTable::MEMBERPFNGLVERTEX4IVPROC)this->m_profiledFunctions[46]))(v);this->profiler.end(46,profilingStart);}
+void m_glCoverStrokePathInstancedNV_profiling(GLsizei numPaths,GLenum pathNameType,const void* paths,GLuint pathBase,GLenum coverMode,GLenum transformType,const GLfloat* transformValues)const{auto const profilingStart=this->profiler.begin(47);(this->*((FunctionTable::MEMBERPFNGLCOVERSTROKEPATHINSTANCEDNVPROC)this->m_profiledFunctions[47]))(numPaths,pathNameType,paths,pathBase,coverMode,transformType,transformValues);this->profiler.end(47,profilingStart);}
+void m_glDeformSGIX_profiling(GLbitfield mask)const{auto const profilingStart=this->profiler.begin(48);(this->*((FunctionTable::MEMBERPFNGLDEFORMSGIXPROC)this->m_profiledFunctions[48]))(mask);this->profiler.end(48,profilingStart);}
+void m_glUniform2ui64NV_profiling(GLint location,GLuint64EXT x,GLuint64EXT y)const{auto const profilingStart=this->profiler.begin(49);(this->*((FunctionTable::MEMBERPFNGLUNIFORM2UI64NVPROC)this->m_profiledFunctions[49]))(location,x,y);this->profiler.end(49,profilingStart);}
+void m_glCopyPathNV_profiling(GLuint resultPath,GLuint srcPath)const{auto const profilingStart=this->profiler.begin(50);(this->*((FunctionTable::MEMBERPFNGLCOPYPATHNVPROC)this->m_profiledFunctions[50]))(resultPath,srcPath);this->profiler.end(50,profilingStart);}
+void m_glVertexAttribP4ui_profiling(GLuint index,GLenum type,GLboolean normalized,GLuint value)const{auto const profilingStart=this->profiler.begin(51);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBP4UIPROC)this->m_profiledFunctions[51]))(index,type,normalized,value);this->profiler.end(51,profilingStart);}
+void m_glVertexAttribL2d_profiling(GLuint index,GLdouble x,GLdouble y)const{auto const profilingStart=this->profiler.begin(52);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBL2DPROC)this->m_profiledFunctions[52]))(index,x,y);this->profiler.end(52,profilingStart);}
+void m_glGetMultisamplefv_profiling(GLenum pname,GLuint index,GLfloat* val)const{auto const profilingStart=this->profiler.begin(53);(this->*((FunctionTable::MEMBERPFNGLGETMULTISAMPLEFVPROC)this->m_profiledFunctions[53]))(pname,index,val);this->profiler.end(53,profilingStart);}
+void m_glCompressedMultiTexSubImage3DEXT_profiling(GLenum texunit,GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLenum format,GLsizei imageSize,const void* bits)const{auto const profilingStart=this->profiler.begin(54);(this->*((FunctionTable::MEMBERPFNGLCOMPRESSEDMULTITEXSUBIMAGE3DEXTPROC)this->m_profiledFunctions[54]))(texunit,target,level,xoffset,yoffset,zoffset,width,height,depth,format,imageSize,bits);this->profiler.end(54,profilingStart);}
+GLvdpauSurfaceNV m_glVDPAURegisterOutputSurfaceNV_profiling(const void* vdpSurface,GLenum target,GLsizei numTextureNames,const GLuint* textureNames)const{auto const profilingStart=this->profiler.begin(55);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLVDPAUREGISTEROUTPUTSURFACENVPROC)this->m_profiledFunctions[55]))(vdpSurface,target,numTextureNames,textureNames);this->profiler.end(55,profilingStart);return profilingResult;}
+void m_glMinSampleShading_profiling(GLfloat value)const{auto const profilingStart=this->profiler.begin(56);(this->*((FunctionTable::MEMBERPFNGLMINSAMPLESHADINGPROC)this->m_profiledFunctions[56]))(value);this->profiler.end(56,profilingStart);}
+void m_glProgramUniform4fEXT_profiling(GLuint program,GLint location,GLfloat v0,GLfloat v1,GLfloat v2,GLfloat v3)const{auto const profilingStart=this->profiler.begin(57);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4FEXTPROC)this->m_profiledFunctions[57]))(program,location,v0,v1,v2,v3);this->profiler.end(57,profilingStart);}
+void m_glCoverStrokePathNV_profiling(GLuint path,GLenum coverMode)const{auto const profilingStart=this->profiler.begin(58);(this->*((FunctionTable::MEMBERPFNGLCOVERSTROKEPATHNVPROC)this->m_profiledFunctions[58]))(path,coverMode);this->profiler.end(58,profilingStart);}
+void m_glTextureImage2DMultisampleNV_profiling(GLuint texture,GLenum target,GLsizei samples,GLint internalFormat,GLsizei width,GLsizei height,GLboolean fixedSampleLocations)const{auto const profilingStart=this->profiler.begin(59);(this->*((FunctionTable::MEMBERPFNGLTEXTUREIMAGE2DMULTISAMPLENVPROC)this->m_profiledFunctions[59]))(texture,target,samples,internalFormat,width,height,fixedSampleLocations);this->profiler.end(59,profilingStart);}
+void m_glVertex3bOES_profiling(GLbyte x,GLbyte y,GLbyte z)const{auto const profilingStart=this->profiler.begin(60);(this->*((FunctionTable::MEMBERPFNGLVERTEX3BOESPROC)this->m_profiledFunctions[60]))(x,y,z);this->profiler.end(60,profilingStart);}
+void m_glTessellationFactorAMD_profiling(GLfloat factor)const{auto const profilingStart=this->profiler.begin(61);(this->*((FunctionTable::MEMBERPFNGLTESSELLATIONFACTORAMDPROC)this->m_profiledFunctions[61]))(factor);this->profiler.end(61,profilingStart);}
+void m_glDebugMessageControl_profiling(GLenum source,GLenum type,GLenum severity,GLsizei count,const GLuint* ids,GLboolean enabled)const{auto const profilingStart=this->profiler.begin(62);(this->*((FunctionTable::MEMBERPFNGLDEBUGMESSAGECONTROLPROC)this->m_profiledFunctions[62]))(source,type,severity,count,ids,enabled);this->profiler.end(62,profilingStart);}
+GLboolean m_glIsObjectBufferATI_profiling(GLuint buffer)const{auto const profilingStart=this->profiler.begin(63);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLISOBJECTBUFFERATIPROC)this->m_profiledFunctions[63]))(buffer);this->profiler.end(63,profilingStart);return profilingResult;}
+void m_glPopAttrib_profiling()const{auto const profilingStart=this->profiler.begin(64);(this->*((FunctionTable::MEMBERPFNGLPOPATTRIBPROC)this->m_profiledFunctions[64]))();this->profiler.end(64,profilingStart);}
+void m_glProgramUniform4iEXT_profiling(GLuint program,GLint location,GLint v0,GLint v1,GLint v2,GLint v3)const{auto const profilingStart=this->profiler.begin(65);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4IEXTPROC)this->m_profiledFunctions[65]))(program,location,v0,v1,v2,v3);this->profiler.end(65,profilingStart);}
+void m_glVertexAttrib4ubNV_profiling(GLuint index,GLubyte x,GLubyte y,GLubyte z,GLubyte w)const{auto const profilingStart=this->profiler.begin(66);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB4UBNVPROC)this->m_profiledFunctions[66]))(index,x,y,z,w);this->profiler.end(66,profilingStart);}
+void m_glColorMaterial_profiling(GLenum face,GLenum mode)const{auto const profilingStart=this->profiler.begin(67);(this->*((FunctionTable::MEMBERPFNGLCOLORMATERIALPROC)this->m_profiledFunctions[67]))(face,mode);this->profiler.end(67,profilingStart);}
+void m_glVertexAttrib2svARB_profiling(GLuint index,const GLshort* v)const{auto const profilingStart=this->profiler.begin(68);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB2SVARBPROC)this->m_profiledFunctions[68]))(index,v);this->profiler.end(68,profilingStart);}
+void m_glMinSampleShadingARB_profiling(GLfloat value)const{auto const profilingStart=this->profiler.begin(69);(this->*((FunctionTable::MEMBERPFNGLMINSAMPLESHADINGARBPROC)this->m_profiledFunctions[69]))(value);this->profiler.end(69,profilingStart);}
+void m_glColor3b_profiling(GLbyte red,GLbyte green,GLbyte blue)const{auto const profilingStart=this->profiler.begin(70);(this->*((FunctionTable::MEMBERPFNGLCOLOR3BPROC)this->m_profiledFunctions[70]))(red,green,blue);this->profiler.end(70,profilingStart);}
+void m_glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN_profiling(GLuint rc,GLfloat s,GLfloat t,GLfloat nx,GLfloat ny,GLfloat nz,GLfloat x,GLfloat y,GLfloat z)const{auto const profilingStart=this->profiler.begin(71);(this->*((FunctionTable::MEMBERPFNGLREPLACEMENTCODEUITEXCOORD2FNORMAL3FVERTEX3FSUNPROC)this->m_profiledFunctions[71]))(rc,s,t,nx,ny,nz,x,y,z);this->profiler.end(71,profilingStart);}
+void m_glColor3f_profiling(GLfloat red,GLfloat green,GLfloat blue)const{auto const profilingStart=this->profiler.begin(72);(this->*((FunctionTable::MEMBERPFNGLCOLOR3FPROC)this->m_profiledFunctions[72]))(red,green,blue);this->profiler.end(72,profilingStart);}
+void m_glVDPAUGetSurfaceivNV_profiling(GLvdpauSurfaceNV surface,GLenum pname,GLsizei bufSize,GLsizei* length,GLint* values)const{auto const profilingStart=this->profiler.begin(73);(this->*((FunctionTable::MEMBERPFNGLVDPAUGETSURFACEIVNVPROC)this->m_profiledFunctions[73]))(surface,pname,bufSize,length,values);this->profiler.end(73,profilingStart);}
+void m_glColor3d_profiling(GLdouble red,GLdouble green,GLdouble blue)const{auto const profilingStart=this->profiler.begin(74);(this->*((FunctionTable::MEMBERPFNGLCOLOR3DPROC)this->m_profiledFunctions[74]))(red,green,blue);this->profiler.end(74,profilingStart);}
+void m_glGetnMapiv_profiling(GLenum target,GLenum query,GLsizei bufSize,GLint* v)const{auto const profilingStart=this->profiler.begin(75);(this->*((FunctionTable::MEMBERPFNGLGETNMAPIVPROC)this->m_profiledFunctions[75]))(target,query,bufSize,v);this->profiler.end(75,profilingStart);}
+void m_glColor3i_profiling(GLint red,GLint green,GLint blue)const{auto const profilingStart=this->profiler.begin(76);(this->*((FunctionTable::MEMBERPFNGLCOLOR3IPROC)this->m_profiledFunctions[76]))(red,green,blue);this->profiler.end(76,profilingStart);}
+void m_glGetInternalformatSampleivNV_profiling(GLenum target,GLenum internalformat,GLsizei samples,GLenum pname,GLsizei bufSize,GLint* params)const{auto const profilingStart=this->profiler.begin(77);(this->*((FunctionTable::MEMBERPFNGLGETINTERNALFORMATSAMPLEIVNVPROC)this->m_profiledFunctions[77]))(target,internalformat,samples,pname,bufSize,params);this->profiler.end(77,profilingStart);}
+void m_glVertexAttrib4ubv_profiling(GLuint index,const GLubyte* v)const{auto const profilingStart=this->profiler.begin(78);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB4UBVPROC)this->m_profiledFunctions[78]))(index,v);this->profiler.end(78,profilingStart);}
+void m_glColor3s_profiling(GLshort red,GLshort green,GLshort blue)const{auto const profilingStart=this->profiler.begin(79);(this->*((FunctionTable::MEMBERPFNGLCOLOR3SPROC)this->m_profiledFunctions[79]))(red,green,blue);this->profiler.end(79,profilingStart);}
+void m_glVertexAttribs4hvNV_profiling(GLuint index,GLsizei n,const GLhalfNV* v)const{auto const profilingStart=this->profiler.begin(80);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBS4HVNVPROC)this->m_profiledFunctions[80]))(index,n,v);this->profiler.end(80,profilingStart);}
+void m_glVertexAttrib4NubvARB_profiling(GLuint index,const GLubyte* v)const{auto const profilingStart=this->profiler.begin(81);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUBVARBPROC)this->m_profiledFunctions[81]))(index,v);this->profiler.end(81,profilingStart);}
+void m_glMultiTexCoord3hvNV_profiling(GLenum target,const GLhalfNV* v)const{auto const profilingStart=this->profiler.begin(82);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD3HVNVPROC)this->m_profiledFunctions[82]))(target,v);this->profiler.end(82,profilingStart);}
+void m_glMatrixPushEXT_profiling(GLenum mode)const{auto const profilingStart=this->profiler.begin(83);(this->*((FunctionTable::MEMBERPFNGLMATRIXPUSHEXTPROC)this->m_profiledFunctions[83]))(mode);this->profiler.end(83,profilingStart);}
+void m_glProgramUniform2fEXT_profiling(GLuint program,GLint location,GLfloat v0,GLfloat v1)const{auto const profilingStart=this->profiler.begin(84);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2FEXTPROC)this->m_profiledFunctions[84]))(program,location,v0,v1);this->profiler.end(84,profilingStart);}
+void m_glGetVertexArrayIndexediv_profiling(GLuint vaobj,GLuint index,GLenum pname,GLint* param)const{auto const profilingStart=this->profiler.begin(85);(this->*((FunctionTable::MEMBERPFNGLGETVERTEXARRAYINDEXEDIVPROC)this->m_profiledFunctions[85]))(vaobj,index,pname,param);this->profiler.end(85,profilingStart);}
+void m_glBlitFramebuffer_profiling(GLint srcX0,GLint srcY0,GLint srcX1,GLint srcY1,GLint dstX0,GLint dstY0,GLint dstX1,GLint dstY1,GLbitfield mask,GLenum filter)const{auto const profilingStart=this->profiler.begin(86);(this->*((FunctionTable::MEMBERPFNGLBLITFRAMEBUFFERPROC)this->m_profiledFunctions[86]))(srcX0,srcY0,srcX1,srcY1,dstX0,dstY0,dstX1,dstY1,mask,filter);this->profiler.end(86,profilingStart);}
+void m_glMultiTexCoordP2ui_profiling(GLenum texture,GLenum type,GLuint coords)const{auto const profilingStart=this->profiler.begin(87);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORDP2UIPROC)this->m_profiledFunctions[87]))(texture,type,coords);this->profiler.end(87,profilingStart);}
+void m_glColorPointerListIBM_profiling(GLint size,GLenum type,GLint stride,const void** pointer,GLint ptrstride)const{auto const profilingStart=this->profiler.begin(88);(this->*((FunctionTable::MEMBERPFNGLCOLORPOINTERLISTIBMPROC)this->m_profiledFunctions[88]))(size,type,stride,pointer,ptrstride);this->profiler.end(88,profilingStart);}
+void m_glVertexAttribL4d_profiling(GLuint index,GLdouble x,GLdouble y,GLdouble z,GLdouble w)const{auto const profilingStart=this->profiler.begin(89);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBL4DPROC)this->m_profiledFunctions[89]))(index,x,y,z,w);this->profiler.end(89,profilingStart);}
+void m_glGetFragmentMaterialfvSGIX_profiling(GLenum face,GLenum pname,GLfloat* params)const{auto const profilingStart=this->profiler.begin(90);(this->*((FunctionTable::MEMBERPFNGLGETFRAGMENTMATERIALFVSGIXPROC)this->m_profiledFunctions[90]))(face,pname,params);this->profiler.end(90,profilingStart);}
+void m_glVertex2iv_profiling(const GLint* v)const{auto const profilingStart=this->profiler.begin(91);(this->*((FunctionTable::MEMBERPFNGLVERTEX2IVPROC)this->m_profiledFunctions[91]))(v);this->profiler.end(91,profilingStart);}
+void m_glGetTexEnvxvOES_profiling(GLenum target,GLenum pname,GLfixed* params)const{auto const profilingStart=this->profiler.begin(92);(this->*((FunctionTable::MEMBERPFNGLGETTEXENVXVOESPROC)this->m_profiledFunctions[92]))(target,pname,params);this->profiler.end(92,profilingStart);}
+void m_glUniformMatrix3dv_profiling(GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{auto const profilingStart=this->profiler.begin(93);(this->*((FunctionTable::MEMBERPFNGLUNIFORMMATRIX3DVPROC)this->m_profiledFunctions[93]))(location,count,transpose,value);this->profiler.end(93,profilingStart);}
+void m_glGetVertexAttribLdvEXT_profiling(GLuint index,GLenum pname,GLdouble* params)const{auto const profilingStart=this->profiler.begin(94);(this->*((FunctionTable::MEMBERPFNGLGETVERTEXATTRIBLDVEXTPROC)this->m_profiledFunctions[94]))(index,pname,params);this->profiler.end(94,profilingStart);}
+void m_glTexCoordP3uiv_profiling(GLenum type,const GLuint* coords)const{auto const profilingStart=this->profiler.begin(95);(this->*((FunctionTable::MEMBERPFNGLTEXCOORDP3UIVPROC)this->m_profiledFunctions[95]))(type,coords);this->profiler.end(95,profilingStart);}
+void m_glDeformationMap3dSGIX_profiling(GLenum target,GLdouble u1,GLdouble u2,GLint ustride,GLint uorder,GLdouble v1,GLdouble v2,GLint vstride,GLint vorder,GLdouble w1,GLdouble w2,GLint wstride,GLint worder,const GLdouble* points)const{auto const profilingStart=this->profiler.begin(96);(this->*((FunctionTable::MEMBERPFNGLDEFORMATIONMAP3DSGIXPROC)this->m_profiledFunctions[96]))(target,u1,u2,ustride,uorder,v1,v2,vstride,vorder,w1,w2,wstride,worder,points);this->profiler.end(96,profilingStart);}
+void m_glResumeTransformFeedback_profiling()const{auto const profilingStart=this->profiler.begin(97);(this->*((FunctionTable::MEMBERPFNGLRESUMETRANSFORMFEEDBACKPROC)this->m_profiledFunctions[97]))();this->profiler.end(97,profilingStart);}
+void m_glInsertEventMarkerEXT_profiling(GLsizei length,const GLchar* marker)const{auto const profilingStart=this->profiler.begin(98);(this->*((FunctionTable::MEMBERPFNGLINSERTEVENTMARKEREXTPROC)this->m_profiledFunctions[98]))(length,marker);this->profiler.end(98,profilingStart);}
+void m_glTessellationModeAMD_profiling(GLenum mode)const{auto const profilingStart=this->profiler.begin(99);(this->*((FunctionTable::MEMBERPFNGLTESSELLATIONMODEAMDPROC)this->m_profiledFunctions[99]))(mode);this->profiler.end(99,profilingStart);}
+void m_glDrawCommandsAddressNV_profiling(GLenum primitiveMode,const GLuint64* indirects,const GLsizei* sizes,GLuint count)const{auto const profilingStart=this->profiler.begin(100);(this->*((FunctionTable::MEMBERPFNGLDRAWCOMMANDSADDRESSNVPROC)this->m_profiledFunctions[100]))(primitiveMode,indirects,sizes,count);this->profiler.end(100,profilingStart);}
+void m_glFogi_profiling(GLenum pname,GLint param)const{auto const profilingStart=this->profiler.begin(101);(this->*((FunctionTable::MEMBERPFNGLFOGIPROC)this->m_profiledFunctions[101]))(pname,param);this->profiler.end(101,profilingStart);}
+void m_glGetTexParameterxvOES_profiling(GLenum target,GLenum pname,GLfixed* params)const{auto const profilingStart=this->profiler.begin(102);(this->*((FunctionTable::MEMBERPFNGLGETTEXPARAMETERXVOESPROC)this->m_profiledFunctions[102]))(target,pname,params);this->profiler.end(102,profilingStart);}
+void m_glVertexPointer_profiling(GLint size,GLenum type,GLsizei stride,const GLvoid* ptr)const{auto const profilingStart=this->profiler.begin(103);(this->*((FunctionTable::MEMBERPFNGLVERTEXPOINTERPROC)this->m_profiledFunctions[103]))(size,type,stride,ptr);this->profiler.end(103,profilingStart);}
+void m_glGetPerfMonitorCounterDataAMD_profiling(GLuint monitor,GLenum pname,GLsizei dataSize,GLuint* data,GLint* bytesWritten)const{auto const profilingStart=this->profiler.begin(104);(this->*((FunctionTable::MEMBERPFNGLGETPERFMONITORCOUNTERDATAAMDPROC)this->m_profiledFunctions[104]))(monitor,pname,dataSize,data,bytesWritten);this->profiler.end(104,profilingStart);}
+void m_glFogf_profiling(GLenum pname,GLfloat param)const{auto const profilingStart=this->profiler.begin(105);(this->*((FunctionTable::MEMBERPFNGLFOGFPROC)this->m_profiledFunctions[105]))(pname,param);this->profiler.end(105,profilingStart);}
+void m_glMultiTexCoord1d_profiling(GLenum target,GLdouble s)const{auto const profilingStart=this->profiler.begin(106);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD1DPROC)this->m_profiledFunctions[106]))(target,s);this->profiler.end(106,profilingStart);}
+void m_glMultiTexCoord1f_profiling(GLenum target,GLfloat s)const{auto const profilingStart=this->profiler.begin(107);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD1FPROC)this->m_profiledFunctions[107]))(target,s);this->profiler.end(107,profilingStart);}
+void m_glGetMultiTexParameterivEXT_profiling(GLenum texunit,GLenum target,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(108);(this->*((FunctionTable::MEMBERPFNGLGETMULTITEXPARAMETERIVEXTPROC)this->m_profiledFunctions[108]))(texunit,target,pname,params);this->profiler.end(108,profilingStart);}
+void m_glProgramUniformMatrix3x4fvEXT_profiling(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{auto const profilingStart=this->profiler.begin(109);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X4FVEXTPROC)this->m_profiledFunctions[109]))(program,location,count,transpose,value);this->profiler.end(109,profilingStart);}
+void m_glVertexAttribI2i_profiling(GLuint index,GLint x,GLint y)const{auto const profilingStart=this->profiler.begin(110);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBI2IPROC)this->m_profiledFunctions[110]))(index,x,y);this->profiler.end(110,profilingStart);}
+void m_glMultiTexCoord1i_profiling(GLenum target,GLint s)const{auto const profilingStart=this->profiler.begin(111);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD1IPROC)this->m_profiledFunctions[111]))(target,s);this->profiler.end(111,profilingStart);}
+void m_glUniform1ui64vARB_profiling(GLint location,GLsizei count,const GLuint64* value)const{auto const profilingStart=this->profiler.begin(112);(this->*((FunctionTable::MEMBERPFNGLUNIFORM1UI64VARBPROC)this->m_profiledFunctions[112]))(location,count,value);this->profiler.end(112,profilingStart);}
+void m_glLoadProgramNV_profiling(GLenum target,GLuint id,GLsizei len,const GLubyte* program)const{auto const profilingStart=this->profiler.begin(113);(this->*((FunctionTable::MEMBERPFNGLLOADPROGRAMNVPROC)this->m_profiledFunctions[113]))(target,id,len,program);this->profiler.end(113,profilingStart);}
+void m_glWriteMaskEXT_profiling(GLuint res,GLuint in,GLenum outX,GLenum outY,GLenum outZ,GLenum outW)const{auto const profilingStart=this->profiler.begin(114);(this->*((FunctionTable::MEMBERPFNGLWRITEMASKEXTPROC)this->m_profiledFunctions[114]))(res,in,outX,outY,outZ,outW);this->profiler.end(114,profilingStart);}
+GLenum m_glGetGraphicsResetStatus_profiling()const{auto const profilingStart=this->profiler.begin(115);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLGETGRAPHICSRESETSTATUSPROC)this->m_profiledFunctions[115]))();this->profiler.end(115,profilingStart);return profilingResult;}
+void m_glVertexAttrib1fv_profiling(GLuint index,const GLfloat* v)const{auto const profilingStart=this->profiler.begin(116);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB1FVPROC)this->m_profiledFunctions[116]))(index,v);this->profiler.end(116,profilingStart);}
+GLboolean m_glIsEnabled_profiling(GLenum cap)const{auto const profilingStart=this->profiler.begin(117);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLISENABLEDPROC)this->m_profiledFunctions[117]))(cap);this->profiler.end(117,profilingStart);return profilingResult;}
+void m_glImageTransformParameterfvHP_profiling(GLenum target,GLenum pname,const GLfloat* params)const{auto const profilingStart=this->profiler.begin(118);(this->*((FunctionTable::MEMBERPFNGLIMAGETRANSFORMPARAMETERFVHPPROC)this->m_profiledFunctions[118]))(target,pname,params);this->profiler.end(118,profilingStart);}
+void m_glFramebufferTexture2D_profiling(GLenum target,GLenum attachment,GLenum textarget,GLuint texture,GLint level)const{auto const profilingStart=this->profiler.begin(119);(this->*((FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURE2DPROC)this->m_profiledFunctions[119]))(target,attachment,textarget,texture,level);this->profiler.end(119,profilingStart);}
+void m_glGetFragmentLightfvSGIX_profiling(GLenum light,GLenum pname,GLfloat* params)const{auto const profilingStart=this->profiler.begin(120);(this->*((FunctionTable::MEMBERPFNGLGETFRAGMENTLIGHTFVSGIXPROC)this->m_profiledFunctions[120]))(light,pname,params);this->profiler.end(120,profilingStart);}
+void m_glListParameterfSGIX_profiling(GLuint list,GLenum pname,GLfloat param)const{auto const profilingStart=this->profiler.begin(121);(this->*((FunctionTable::MEMBERPFNGLLISTPARAMETERFSGIXPROC)this->m_profiledFunctions[121]))(list,pname,param);this->profiler.end(121,profilingStart);}
+void m_glTexCoord3sv_profiling(const GLshort* v)const{auto const profilingStart=this->profiler.begin(122);(this->*((FunctionTable::MEMBERPFNGLTEXCOORD3SVPROC)this->m_profiledFunctions[122]))(v);this->profiler.end(122,profilingStart);}
+void m_glNamedFramebufferRenderbufferEXT_profiling(GLuint framebuffer,GLenum attachment,GLenum renderbuffertarget,GLuint renderbuffer)const{auto const profilingStart=this->profiler.begin(123);(this->*((FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERRENDERBUFFEREXTPROC)this->m_profiledFunctions[123]))(framebuffer,attachment,renderbuffertarget,renderbuffer);this->profiler.end(123,profilingStart);}
+void m_glFragmentLightModelfSGIX_profiling(GLenum pname,GLfloat param)const{auto const profilingStart=this->profiler.begin(124);(this->*((FunctionTable::MEMBERPFNGLFRAGMENTLIGHTMODELFSGIXPROC)this->m_profiledFunctions[124]))(pname,param);this->profiler.end(124,profilingStart);}
+void m_glIndexPointerEXT_profiling(GLenum type,GLsizei stride,GLsizei count,const void* pointer)const{auto const profilingStart=this->profiler.begin(125);(this->*((FunctionTable::MEMBERPFNGLINDEXPOINTEREXTPROC)this->m_profiledFunctions[125]))(type,stride,count,pointer);this->profiler.end(125,profilingStart);}
+void m_glBlendEquationSeparateATI_profiling(GLenum modeRGB,GLenum modeA)const{auto const profilingStart=this->profiler.begin(126);(this->*((FunctionTable::MEMBERPFNGLBLENDEQUATIONSEPARATEATIPROC)this->m_profiledFunctions[126]))(modeRGB,modeA);this->profiler.end(126,profilingStart);}
+void m_glVertexArrayAttribIFormat_profiling(GLuint vaobj,GLuint attribindex,GLint size,GLenum type,GLuint relativeoffset)const{auto const profilingStart=this->profiler.begin(127);(this->*((FunctionTable::MEMBERPFNGLVERTEXARRAYATTRIBIFORMATPROC)this->m_profiledFunctions[127]))(vaobj,attribindex,size,type,relativeoffset);this->profiler.end(127,profilingStart);}
+void m_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN_profiling(GLuint rc,GLfloat s,GLfloat t,GLfloat r,GLfloat g,GLfloat b,GLfloat a,GLfloat nx,GLfloat ny,GLfloat nz,GLfloat x,GLfloat y,GLfloat z)const{auto const profilingStart=this->profiler.begin(128);(this->*((FunctionTable::MEMBERPFNGLREPLACEMENTCODEUITEXCOORD2FCOLOR4FNORMAL3FVERTEX3FSUNPROC)this->m_profiledFunctions[128]))(rc,s,t,r,g,b,a,nx,ny,nz,x,y,z);this->profiler.end(128,profilingStart);}
+void m_glReplacementCodeubvSUN_profiling(const GLubyte* code)const{auto const profilingStart=this->profiler.begin(129);(this->*((FunctionTable::MEMBERPFNGLREPLACEMENTCODEUBVSUNPROC)this->m_profiledFunctions[129]))(code);this->profiler.end(129,profilingStart);}
+void m_glGenFramebuffers_profiling(GLsizei n,GLuint* framebuffers)const{auto const profilingStart=this->profiler.begin(130);(this->*((FunctionTable::MEMBERPFNGLGENFRAMEBUFFERSPROC)this->m_profiledFunctions[130]))(n,framebuffers);this->profiler.end(130,profilingStart);}
+void m_glPixelMapx_profiling(GLenum map,GLint size,const GLfixed* values)const{auto const profilingStart=this->profiler.begin(131);(this->*((FunctionTable::MEMBERPFNGLPIXELMAPXPROC)this->m_profiledFunctions[131]))(map,size,values);this->profiler.end(131,profilingStart);}
+void m_glTexSubImage3DEXT_profiling(GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLenum format,GLenum type,const void* pixels)const{auto const profilingStart=this->profiler.begin(132);(this->*((FunctionTable::MEMBERPFNGLTEXSUBIMAGE3DEXTPROC)this->m_profiledFunctions[132]))(target,level,xoffset,yoffset,zoffset,width,height,depth,format,type,pixels);this->profiler.end(132,profilingStart);}
+void m_glGetAttachedShaders_profiling(GLuint program,GLsizei maxCount,GLsizei* count,GLuint* shaders)const{auto const profilingStart=this->profiler.begin(133);(this->*((FunctionTable::MEMBERPFNGLGETATTACHEDSHADERSPROC)this->m_profiledFunctions[133]))(program,maxCount,count,shaders);this->profiler.end(133,profilingStart);}
+void m_glGetPixelTexGenParameterfvSGIS_profiling(GLenum pname,GLfloat* params)const{auto const profilingStart=this->profiler.begin(134);(this->*((FunctionTable::MEMBERPFNGLGETPIXELTEXGENPARAMETERFVSGISPROC)this->m_profiledFunctions[134]))(pname,params);this->profiler.end(134,profilingStart);}
+void m_glReplacementCodeuiNormal3fVertex3fSUN_profiling(GLuint rc,GLfloat nx,GLfloat ny,GLfloat nz,GLfloat x,GLfloat y,GLfloat z)const{auto const profilingStart=this->profiler.begin(135);(this->*((FunctionTable::MEMBERPFNGLREPLACEMENTCODEUINORMAL3FVERTEX3FSUNPROC)this->m_profiledFunctions[135]))(rc,nx,ny,nz,x,y,z);this->profiler.end(135,profilingStart);}
+GLuint m_glGetDebugMessageLogAMD_profiling(GLuint count,GLsizei bufsize,GLenum* categories,GLuint* severities,GLuint* ids,GLsizei* lengths,GLchar* message)const{auto const profilingStart=this->profiler.begin(136);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLGETDEBUGMESSAGELOGAMDPROC)this->m_profiledFunctions[136]))(count,bufsize,categories,severities,ids,lengths,message);this->profiler.end(136,profilingStart);return profilingResult;}
+void m_glVertexStream4sATI_profiling(GLenum stream,GLshort x,GLshort y,GLshort z,GLshort w)const{auto const profilingStart=this->profiler.begin(137);(this->*((FunctionTable::MEMBERPFNGLVERTEXSTREAM4SATIPROC)this->m_profiledFunctions[137]))(stream,x,y,z,w);this->profiler.end(137,profilingStart);}
+void m_glVertexAttribs4dvNV_profiling(GLuint index,GLsizei count,const GLdouble* v)const{auto const profilingStart=this->profiler.begin(138);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBS4DVNVPROC)this->m_profiledFunctions[138]))(index,count,v);this->profiler.end(138,profilingStart);}
+void m_glGetnMapdvARB_profiling(GLenum target,GLenum query,GLsizei bufSize,GLdouble* v)const{auto const profilingStart=this->profiler.begin(139);(this->*((FunctionTable::MEMBERPFNGLGETNMAPDVARBPROC)this->m_profiledFunctions[139]))(target,query,bufSize,v);this->profiler.end(139,profilingStart);}
+void m_glOrthofOES_profiling(GLfloat l,GLfloat r,GLfloat b,GLfloat t,GLfloat n,GLfloat f)const{auto const profilingStart=this->profiler.begin(140);(this->*((FunctionTable::MEMBERPFNGLORTHOFOESPROC)this->m_profiledFunctions[140]))(l,r,b,t,n,f);this->profiler.end(140,profilingStart);}
+void m_glViewportArrayv_profiling(GLuint first,GLsizei count,const GLfloat* v)const{auto const profilingStart=this->profiler.begin(141);(this->*((FunctionTable::MEMBERPFNGLVIEWPORTARRAYVPROC)this->m_profiledFunctions[141]))(first,count,v);this->profiler.end(141,profilingStart);}
+void m_glDrawElementArrayATI_profiling(GLenum mode,GLsizei count)const{auto const profilingStart=this->profiler.begin(142);(this->*((FunctionTable::MEMBERPFNGLDRAWELEMENTARRAYATIPROC)this->m_profiledFunctions[142]))(mode,count);this->profiler.end(142,profilingStart);}
+void m_glGetPathColorGenfvNV_profiling(GLenum color,GLenum pname,GLfloat* value)const{auto const profilingStart=this->profiler.begin(143);(this->*((FunctionTable::MEMBERPFNGLGETPATHCOLORGENFVNVPROC)this->m_profiledFunctions[143]))(color,pname,value);this->profiler.end(143,profilingStart);}
+void m_glWindowPos3iMESA_profiling(GLint x,GLint y,GLint z)const{auto const profilingStart=this->profiler.begin(144);(this->*((FunctionTable::MEMBERPFNGLWINDOWPOS3IMESAPROC)this->m_profiledFunctions[144]))(x,y,z);this->profiler.end(144,profilingStart);}
+void m_glMultiTexCoord2s_profiling(GLenum target,GLshort s,GLshort t)const{auto const profilingStart=this->profiler.begin(145);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD2SPROC)this->m_profiledFunctions[145]))(target,s,t);this->profiler.end(145,profilingStart);}
+void m_glVertex3dv_profiling(const GLdouble* v)const{auto const profilingStart=this->profiler.begin(146);(this->*((FunctionTable::MEMBERPFNGLVERTEX3DVPROC)this->m_profiledFunctions[146]))(v);this->profiler.end(146,profilingStart);}
+void m_glVertexAttribI3uivEXT_profiling(GLuint index,const GLuint* v)const{auto const profilingStart=this->profiler.begin(147);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBI3UIVEXTPROC)this->m_profiledFunctions[147]))(index,v);this->profiler.end(147,profilingStart);}
+void m_glUniform3ui64ARB_profiling(GLint location,GLuint64 x,GLuint64 y,GLuint64 z)const{auto const profilingStart=this->profiler.begin(148);(this->*((FunctionTable::MEMBERPFNGLUNIFORM3UI64ARBPROC)this->m_profiledFunctions[148]))(location,x,y,z);this->profiler.end(148,profilingStart);}
+void m_glVertexAttrib2fvNV_profiling(GLuint index,const GLfloat* v)const{auto const profilingStart=this->profiler.begin(149);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB2FVNVPROC)this->m_profiledFunctions[149]))(index,v);this->profiler.end(149,profilingStart);}
+void m_glGetNamedBufferSubDataEXT_profiling(GLuint buffer,GLintptr offset,GLsizeiptr size,void* data)const{auto const profilingStart=this->profiler.begin(150);(this->*((FunctionTable::MEMBERPFNGLGETNAMEDBUFFERSUBDATAEXTPROC)this->m_profiledFunctions[150]))(buffer,offset,size,data);this->profiler.end(150,profilingStart);}
+void m_glConvolutionFilter2D_profiling(GLenum target,GLenum internalformat,GLsizei width,GLsizei height,GLenum format,GLenum type,const GLvoid* image)const{auto const profilingStart=this->profiler.begin(151);(this->*((FunctionTable::MEMBERPFNGLCONVOLUTIONFILTER2DPROC)this->m_profiledFunctions[151]))(target,internalformat,width,height,format,type,image);this->profiler.end(151,profilingStart);}
+void m_glMemoryBarrierByRegion_profiling(GLbitfield barriers)const{auto const profilingStart=this->profiler.begin(152);(this->*((FunctionTable::MEMBERPFNGLMEMORYBARRIERBYREGIONPROC)this->m_profiledFunctions[152]))(barriers);this->profiler.end(152,profilingStart);}
+void m_glVertexArrayBindingDivisor_profiling(GLuint vaobj,GLuint bindingindex,GLuint divisor)const{auto const profilingStart=this->profiler.begin(153);(this->*((FunctionTable::MEMBERPFNGLVERTEXARRAYBINDINGDIVISORPROC)this->m_profiledFunctions[153]))(vaobj,bindingindex,divisor);this->profiler.end(153,profilingStart);}
+void m_glMatrixRotatedEXT_profiling(GLenum mode,GLdouble angle,GLdouble x,GLdouble y,GLdouble z)const{auto const profilingStart=this->profiler.begin(154);(this->*((FunctionTable::MEMBERPFNGLMATRIXROTATEDEXTPROC)this->m_profiledFunctions[154]))(mode,angle,x,y,z);this->profiler.end(154,profilingStart);}
+void m_glTexCoord2sv_profiling(const GLshort* v)const{auto const profilingStart=this->profiler.begin(155);(this->*((FunctionTable::MEMBERPFNGLTEXCOORD2SVPROC)this->m_profiledFunctions[155]))(v);this->profiler.end(155,profilingStart);}
+GLboolean m_glIsProgramNV_profiling(GLuint id)const{auto const profilingStart=this->profiler.begin(156);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLISPROGRAMNVPROC)this->m_profiledFunctions[156]))(id);this->profiler.end(156,profilingStart);return profilingResult;}
+void m_glUniform2dv_profiling(GLint location,GLsizei count,const GLdouble* value)const{auto const profilingStart=this->profiler.begin(157);(this->*((FunctionTable::MEMBERPFNGLUNIFORM2DVPROC)this->m_profiledFunctions[157]))(location,count,value);this->profiler.end(157,profilingStart);}
+void m_glGetPixelMapuiv_profiling(GLenum map,GLuint* values)const{auto const profilingStart=this->profiler.begin(158);(this->*((FunctionTable::MEMBERPFNGLGETPIXELMAPUIVPROC)this->m_profiledFunctions[158]))(map,values);this->profiler.end(158,profilingStart);}
+void m_glDepthBoundsEXT_profiling(GLclampd zmin,GLclampd zmax)const{auto const profilingStart=this->profiler.begin(159);(this->*((FunctionTable::MEMBERPFNGLDEPTHBOUNDSEXTPROC)this->m_profiledFunctions[159]))(zmin,zmax);this->profiler.end(159,profilingStart);}
+void m_glVertexAttrib4hvNV_profiling(GLuint index,const GLhalfNV* v)const{auto const profilingStart=this->profiler.begin(160);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB4HVNVPROC)this->m_profiledFunctions[160]))(index,v);this->profiler.end(160,profilingStart);}
+void m_glMultiTexParameteriEXT_profiling(GLenum texunit,GLenum target,GLenum pname,GLint param)const{auto const profilingStart=this->profiler.begin(161);(this->*((FunctionTable::MEMBERPFNGLMULTITEXPARAMETERIEXTPROC)this->m_profiledFunctions[161]))(texunit,target,pname,param);this->profiler.end(161,profilingStart);}
+void m_glGetPointerv_profiling(GLenum pname,GLvoid** params)const{auto const profilingStart=this->profiler.begin(162);(this->*((FunctionTable::MEMBERPFNGLGETPOINTERVPROC)this->m_profiledFunctions[162]))(pname,params);this->profiler.end(162,profilingStart);}
+void m_glPathCommandsNV_profiling(GLuint path,GLsizei numCommands,const GLubyte* commands,GLsizei numCoords,GLenum coordType,const void* coords)const{auto const profilingStart=this->profiler.begin(163);(this->*((FunctionTable::MEMBERPFNGLPATHCOMMANDSNVPROC)this->m_profiledFunctions[163]))(path,numCommands,commands,numCoords,coordType,coords);this->profiler.end(163,profilingStart);}
+void m_glGetUniformfv_profiling(GLuint program,GLint location,GLfloat* params)const{auto const profilingStart=this->profiler.begin(164);(this->*((FunctionTable::MEMBERPFNGLGETUNIFORMFVPROC)this->m_profiledFunctions[164]))(program,location,params);this->profiler.end(164,profilingStart);}
+void m_glGetUniformuiv_profiling(GLuint program,GLint location,GLuint* params)const{auto const profilingStart=this->profiler.begin(165);(this->*((FunctionTable::MEMBERPFNGLGETUNIFORMUIVPROC)this->m_profiledFunctions[165]))(program,location,params);this->profiler.end(165,profilingStart);}
+void m_glDebugMessageInsertAMD_profiling(GLenum category,GLenum severity,GLuint id,GLsizei length,const GLchar* buf)const{auto const profilingStart=this->profiler.begin(166);(this->*((FunctionTable::MEMBERPFNGLDEBUGMESSAGEINSERTAMDPROC)this->m_profiledFunctions[166]))(category,severity,id,length,buf);this->profiler.end(166,profilingStart);}
+void m_glFrustum_profiling(GLdouble left,GLdouble right,GLdouble bottom,GLdouble top,GLdouble near_val,GLdouble far_val)const{auto const profilingStart=this->profiler.begin(167);(this->*((FunctionTable::MEMBERPFNGLFRUSTUMPROC)this->m_profiledFunctions[167]))(left,right,bottom,top,near_val,far_val);this->profiler.end(167,profilingStart);}
+void m_glVertexAttribL1ui64vNV_profiling(GLuint index,const GLuint64EXT* v)const{auto const profilingStart=this->profiler.begin(168);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBL1UI64VNVPROC)this->m_profiledFunctions[168]))(index,v);this->profiler.end(168,profilingStart);}
+void m_glClearColorxOES_profiling(GLfixed red,GLfixed green,GLfixed blue,GLfixed alpha)const{auto const profilingStart=this->profiler.begin(169);(this->*((FunctionTable::MEMBERPFNGLCLEARCOLORXOESPROC)this->m_profiledFunctions[169]))(red,green,blue,alpha);this->profiler.end(169,profilingStart);}
+void m_glProgramUniformMatrix3fv_profiling(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{auto const profilingStart=this->profiler.begin(170);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3FVPROC)this->m_profiledFunctions[170]))(program,location,count,transpose,value);this->profiler.end(170,profilingStart);}
+void m_glSampleMaskIndexedNV_profiling(GLuint index,GLbitfield mask)const{auto const profilingStart=this->profiler.begin(171);(this->*((FunctionTable::MEMBERPFNGLSAMPLEMASKINDEXEDNVPROC)this->m_profiledFunctions[171]))(index,mask);this->profiler.end(171,profilingStart);}
+void m_glCompileShaderIncludeARB_profiling(GLuint shader,GLsizei count,const GLchar*const* path,const GLint* length)const{auto const profilingStart=this->profiler.begin(172);(this->*((FunctionTable::MEMBERPFNGLCOMPILESHADERINCLUDEARBPROC)this->m_profiledFunctions[172]))(shader,count,path,length);this->profiler.end(172,profilingStart);}
+void m_glGetArrayObjectfvATI_profiling(GLenum array,GLenum pname,GLfloat* params)const{auto const profilingStart=this->profiler.begin(173);(this->*((FunctionTable::MEMBERPFNGLGETARRAYOBJECTFVATIPROC)this->m_profiledFunctions[173]))(array,pname,params);this->profiler.end(173,profilingStart);}
+void m_glVertexStream4svATI_profiling(GLenum stream,const GLshort* coords)const{auto const profilingStart=this->profiler.begin(174);(this->*((FunctionTable::MEMBERPFNGLVERTEXSTREAM4SVATIPROC)this->m_profiledFunctions[174]))(stream,coords);this->profiler.end(174,profilingStart);}
+void m_glMultiTexCoord4iARB_profiling(GLenum target,GLint s,GLint t,GLint r,GLint q)const{auto const profilingStart=this->profiler.begin(175);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD4IARBPROC)this->m_profiledFunctions[175]))(target,s,t,r,q);this->profiler.end(175,profilingStart);}
+void m_glVariantfvEXT_profiling(GLuint id,const GLfloat* addr)const{auto const profilingStart=this->profiler.begin(176);(this->*((FunctionTable::MEMBERPFNGLVARIANTFVEXTPROC)this->m_profiledFunctions[176]))(id,addr);this->profiler.end(176,profilingStart);}
+void m_glMatrixLoadfEXT_profiling(GLenum mode,const GLfloat* m)const{auto const profilingStart=this->profiler.begin(177);(this->*((FunctionTable::MEMBERPFNGLMATRIXLOADFEXTPROC)this->m_profiledFunctions[177]))(mode,m);this->profiler.end(177,profilingStart);}
+void m_glLoadIdentityDeformationMapSGIX_profiling(GLbitfield mask)const{auto const profilingStart=this->profiler.begin(178);(this->*((FunctionTable::MEMBERPFNGLLOADIDENTITYDEFORMATIONMAPSGIXPROC)this->m_profiledFunctions[178]))(mask);this->profiler.end(178,profilingStart);}
+void m_glGetRenderbufferParameteriv_profiling(GLenum target,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(179);(this->*((FunctionTable::MEMBERPFNGLGETRENDERBUFFERPARAMETERIVPROC)this->m_profiledFunctions[179]))(target,pname,params);this->profiler.end(179,profilingStart);}
+void m_glProgramUniform3fEXT_profiling(GLuint program,GLint location,GLfloat v0,GLfloat v1,GLfloat v2)const{auto const profilingStart=this->profiler.begin(180);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3FEXTPROC)this->m_profiledFunctions[180]))(program,location,v0,v1,v2);this->profiler.end(180,profilingStart);}
+void m_glNamedRenderbufferStorage_profiling(GLuint renderbuffer,GLenum internalformat,GLsizei width,GLsizei height)const{auto const profilingStart=this->profiler.begin(181);(this->*((FunctionTable::MEMBERPFNGLNAMEDRENDERBUFFERSTORAGEPROC)this->m_profiledFunctions[181]))(renderbuffer,internalformat,width,height);this->profiler.end(181,profilingStart);}
+void m_glProgramPathFragmentInputGenNV_profiling(GLuint program,GLint location,GLenum genMode,GLint components,const GLfloat* coeffs)const{auto const profilingStart=this->profiler.begin(182);(this->*((FunctionTable::MEMBERPFNGLPROGRAMPATHFRAGMENTINPUTGENNVPROC)this->m_profiledFunctions[182]))(program,location,genMode,components,coeffs);this->profiler.end(182,profilingStart);}
+void m_glFogCoordPointerListIBM_profiling(GLenum type,GLint stride,const void** pointer,GLint ptrstride)const{auto const profilingStart=this->profiler.begin(183);(this->*((FunctionTable::MEMBERPFNGLFOGCOORDPOINTERLISTIBMPROC)this->m_profiledFunctions[183]))(type,stride,pointer,ptrstride);this->profiler.end(183,profilingStart);}
+GLsync m_glFenceSync_profiling(GLenum condition,GLbitfield flags)const{auto const profilingStart=this->profiler.begin(184);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLFENCESYNCPROC)this->m_profiledFunctions[184]))(condition,flags);this->profiler.end(184,profilingStart);return profilingResult;}
+void m_glGetVertexAttribIivEXT_profiling(GLuint index,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(185);(this->*((FunctionTable::MEMBERPFNGLGETVERTEXATTRIBIIVEXTPROC)this->m_profiledFunctions[185]))(index,pname,params);this->profiler.end(185,profilingStart);}
+void m_glFramebufferDrawBuffersEXT_profiling(GLuint framebuffer,GLsizei n,const GLenum* bufs)const{auto const profilingStart=this->profiler.begin(186);(this->*((FunctionTable::MEMBERPFNGLFRAMEBUFFERDRAWBUFFERSEXTPROC)this->m_profiledFunctions[186]))(framebuffer,n,bufs);this->profiler.end(186,profilingStart);}
+void m_glVertexAttribs4fvNV_profiling(GLuint index,GLsizei count,const GLfloat* v)const{auto const profilingStart=this->profiler.begin(187);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBS4FVNVPROC)this->m_profiledFunctions[187]))(index,count,v);this->profiler.end(187,profilingStart);}
+void m_glPauseTransformFeedbackNV_profiling()const{auto const profilingStart=this->profiler.begin(188);(this->*((FunctionTable::MEMBERPFNGLPAUSETRANSFORMFEEDBACKNVPROC)this->m_profiledFunctions[188]))();this->profiler.end(188,profilingStart);}
+void m_glGetQueryObjecti64vEXT_profiling(GLuint id,GLenum pname,GLint64* params)const{auto const profilingStart=this->profiler.begin(189);(this->*((FunctionTable::MEMBERPFNGLGETQUERYOBJECTI64VEXTPROC)this->m_profiledFunctions[189]))(id,pname,params);this->profiler.end(189,profilingStart);}
+void m_glVDPAUSurfaceAccessNV_profiling(GLvdpauSurfaceNV surface,GLenum access)const{auto const profilingStart=this->profiler.begin(190);(this->*((FunctionTable::MEMBERPFNGLVDPAUSURFACEACCESSNVPROC)this->m_profiledFunctions[190]))(surface,access);this->profiler.end(190,profilingStart);}
+void m_glValidateProgramPipeline_profiling(GLuint pipeline)const{auto const profilingStart=this->profiler.begin(191);(this->*((FunctionTable::MEMBERPFNGLVALIDATEPROGRAMPIPELINEPROC)this->m_profiledFunctions[191]))(pipeline);this->profiler.end(191,profilingStart);}
+void m_glTexPageCommitmentARB_profiling(GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLboolean commit)const{auto const profilingStart=this->profiler.begin(192);(this->*((FunctionTable::MEMBERPFNGLTEXPAGECOMMITMENTARBPROC)this->m_profiledFunctions[192]))(target,level,xoffset,yoffset,zoffset,width,height,depth,commit);this->profiler.end(192,profilingStart);}
+void m_glWindowPos3dvARB_profiling(const GLdouble* v)const{auto const profilingStart=this->profiler.begin(193);(this->*((FunctionTable::MEMBERPFNGLWINDOWPOS3DVARBPROC)this->m_profiledFunctions[193]))(v);this->profiler.end(193,profilingStart);}
+void m_glStencilStrokePathInstancedNV_profiling(GLsizei numPaths,GLenum pathNameType,const void* paths,GLuint pathBase,GLint reference,GLuint mask,GLenum transformType,const GLfloat* transformValues)const{auto const profilingStart=this->profiler.begin(194);(this->*((FunctionTable::MEMBERPFNGLSTENCILSTROKEPATHINSTANCEDNVPROC)this->m_profiledFunctions[194]))(numPaths,pathNameType,paths,pathBase,reference,mask,transformType,transformValues);this->profiler.end(194,profilingStart);}
+void m_glFogfv_profiling(GLenum pname,const GLfloat* params)const{auto const profilingStart=this->profiler.begin(195);(this->*((FunctionTable::MEMBERPFNGLFOGFVPROC)this->m_profiledFunctions[195]))(pname,params);this->profiler.end(195,profilingStart);}
+void m_glGenQueriesARB_profiling(GLsizei n,GLuint* ids)const{auto const profilingStart=this->profiler.begin(196);(this->*((FunctionTable::MEMBERPFNGLGENQUERIESARBPROC)this->m_profiledFunctions[196]))(n,ids);this->profiler.end(196,profilingStart);}
+void m_glProgramUniform2i64NV_profiling(GLuint program,GLint location,GLint64EXT x,GLint64EXT y)const{auto const profilingStart=this->profiler.begin(197);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2I64NVPROC)this->m_profiledFunctions[197]))(program,location,x,y);this->profiler.end(197,profilingStart);}
+void m_glVertexP4ui_profiling(GLenum type,GLuint value)const{auto const profilingStart=this->profiler.begin(198);(this->*((FunctionTable::MEMBERPFNGLVERTEXP4UIPROC)this->m_profiledFunctions[198]))(type,value);this->profiler.end(198,profilingStart);}
+void m_glVertexStream1ivATI_profiling(GLenum stream,const GLint* coords)const{auto const profilingStart=this->profiler.begin(199);(this->*((FunctionTable::MEMBERPFNGLVERTEXSTREAM1IVATIPROC)this->m_profiledFunctions[199]))(stream,coords);this->profiler.end(199,profilingStart);}
+void m_glProgramEnvParameterI4iNV_profiling(GLenum target,GLuint index,GLint x,GLint y,GLint z,GLint w)const{auto const profilingStart=this->profiler.begin(200);(this->*((FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERI4INVPROC)this->m_profiledFunctions[200]))(target,index,x,y,z,w);this->profiler.end(200,profilingStart);}
+void m_glGenVertexArraysAPPLE_profiling(GLsizei n,GLuint* arrays)const{auto const profilingStart=this->profiler.begin(201);(this->*((FunctionTable::MEMBERPFNGLGENVERTEXARRAYSAPPLEPROC)this->m_profiledFunctions[201]))(n,arrays);this->profiler.end(201,profilingStart);}
+void m_glDrawTransformFeedbackInstanced_profiling(GLenum mode,GLuint id,GLsizei instancecount)const{auto const profilingStart=this->profiler.begin(202);(this->*((FunctionTable::MEMBERPFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC)this->m_profiledFunctions[202]))(mode,id,instancecount);this->profiler.end(202,profilingStart);}
+void m_glStencilThenCoverStrokePathNV_profiling(GLuint path,GLint reference,GLuint mask,GLenum coverMode)const{auto const profilingStart=this->profiler.begin(203);(this->*((FunctionTable::MEMBERPFNGLSTENCILTHENCOVERSTROKEPATHNVPROC)this->m_profiledFunctions[203]))(path,reference,mask,coverMode);this->profiler.end(203,profilingStart);}
+void m_glDeleteVertexArraysAPPLE_profiling(GLsizei n,const GLuint* arrays)const{auto const profilingStart=this->profiler.begin(204);(this->*((FunctionTable::MEMBERPFNGLDELETEVERTEXARRAYSAPPLEPROC)this->m_profiledFunctions[204]))(n,arrays);this->profiler.end(204,profilingStart);}
+void m_glGetNamedBufferParameterui64vNV_profiling(GLuint buffer,GLenum pname,GLuint64EXT* params)const{auto const profilingStart=this->profiler.begin(205);(this->*((FunctionTable::MEMBERPFNGLGETNAMEDBUFFERPARAMETERUI64VNVPROC)this->m_profiledFunctions[205]))(buffer,pname,params);this->profiler.end(205,profilingStart);}
+GLbitfield m_glQueryMatrixxOES_profiling(GLfixed* mantissa,GLint* exponent)const{auto const profilingStart=this->profiler.begin(206);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLQUERYMATRIXXOESPROC)this->m_profiledFunctions[206]))(mantissa,exponent);this->profiler.end(206,profilingStart);return profilingResult;}
+void m_glSecondaryColor3usv_profiling(const GLushort* v)const{auto const profilingStart=this->profiler.begin(207);(this->*((FunctionTable::MEMBERPFNGLSECONDARYCOLOR3USVPROC)this->m_profiledFunctions[207]))(v);this->profiler.end(207,profilingStart);}
+void m_glTranslatexOES_profiling(GLfixed x,GLfixed y,GLfixed z)const{auto const profilingStart=this->profiler.begin(208);(this->*((FunctionTable::MEMBERPFNGLTRANSLATEXOESPROC)this->m_profiledFunctions[208]))(x,y,z);this->profiler.end(208,profilingStart);}
+void m_glDrawTransformFeedback_profiling(GLenum mode,GLuint id)const{auto const profilingStart=this->profiler.begin(209);(this->*((FunctionTable::MEMBERPFNGLDRAWTRANSFORMFEEDBACKPROC)this->m_profiledFunctions[209]))(mode,id);this->profiler.end(209,profilingStart);}
+void m_glTexCoord2fColor4fNormal3fVertex3fvSUN_profiling(const GLfloat* tc,const GLfloat* c,const GLfloat* n,const GLfloat* v)const{auto const profilingStart=this->profiler.begin(210);(this->*((FunctionTable::MEMBERPFNGLTEXCOORD2FCOLOR4FNORMAL3FVERTEX3FVSUNPROC)this->m_profiledFunctions[210]))(tc,c,n,v);this->profiler.end(210,profilingStart);}
+GLvdpauSurfaceNV m_glVDPAURegisterVideoSurfaceNV_profiling(const void* vdpSurface,GLenum target,GLsizei numTextureNames,const GLuint* textureNames)const{auto const profilingStart=this->profiler.begin(211);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLVDPAUREGISTERVIDEOSURFACENVPROC)this->m_profiledFunctions[211]))(vdpSurface,target,numTextureNames,textureNames);this->profiler.end(211,profilingStart);return profilingResult;}
+void m_glGetTexParameterIuiv_profiling(GLenum target,GLenum pname,GLuint* params)const{auto const profilingStart=this->profiler.begin(212);(this->*((FunctionTable::MEMBERPFNGLGETTEXPARAMETERIUIVPROC)this->m_profiledFunctions[212]))(target,pname,params);this->profiler.end(212,profilingStart);}
+void m_glBindBufferBaseNV_profiling(GLenum target,GLuint index,GLuint buffer)const{auto const profilingStart=this->profiler.begin(213);(this->*((FunctionTable::MEMBERPFNGLBINDBUFFERBASENVPROC)this->m_profiledFunctions[213]))(target,index,buffer);this->profiler.end(213,profilingStart);}
+void m_glIndexPointer_profiling(GLenum type,GLsizei stride,const GLvoid* ptr)const{auto const profilingStart=this->profiler.begin(214);(this->*((FunctionTable::MEMBERPFNGLINDEXPOINTERPROC)this->m_profiledFunctions[214]))(type,stride,ptr);this->profiler.end(214,profilingStart);}
+void m_glVertexAttrib4Nbv_profiling(GLuint index,const GLbyte* v)const{auto const profilingStart=this->profiler.begin(215);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB4NBVPROC)this->m_profiledFunctions[215]))(index,v);this->profiler.end(215,profilingStart);}
+void m_glListParameteriSGIX_profiling(GLuint list,GLenum pname,GLint param)const{auto const profilingStart=this->profiler.begin(216);(this->*((FunctionTable::MEMBERPFNGLLISTPARAMETERISGIXPROC)this->m_profiledFunctions[216]))(list,pname,param);this->profiler.end(216,profilingStart);}
+void m_glBlendColorxOES_profiling(GLfixed red,GLfixed green,GLfixed blue,GLfixed alpha)const{auto const profilingStart=this->profiler.begin(217);(this->*((FunctionTable::MEMBERPFNGLBLENDCOLORXOESPROC)this->m_profiledFunctions[217]))(red,green,blue,alpha);this->profiler.end(217,profilingStart);}
+void m_glUniformui64vNV_profiling(GLint location,GLsizei count,const GLuint64EXT* value)const{auto const profilingStart=this->profiler.begin(218);(this->*((FunctionTable::MEMBERPFNGLUNIFORMUI64VNVPROC)this->m_profiledFunctions[218]))(location,count,value);this->profiler.end(218,profilingStart);}
+GLboolean m_glIsSync_profiling(GLsync sync)const{auto const profilingStart=this->profiler.begin(219);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLISSYNCPROC)this->m_profiledFunctions[219]))(sync);this->profiler.end(219,profilingStart);return profilingResult;}
+void m_glGetTextureParameterivEXT_profiling(GLuint texture,GLenum target,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(220);(this->*((FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERIVEXTPROC)this->m_profiledFunctions[220]))(texture,target,pname,params);this->profiler.end(220,profilingStart);}
+void m_glFogCoordhvNV_profiling(const GLhalfNV* fog)const{auto const profilingStart=this->profiler.begin(221);(this->*((FunctionTable::MEMBERPFNGLFOGCOORDHVNVPROC)this->m_profiledFunctions[221]))(fog);this->profiler.end(221,profilingStart);}
+void m_glFramebufferTextureLayerEXT_profiling(GLenum target,GLenum attachment,GLuint texture,GLint level,GLint layer)const{auto const profilingStart=this->profiler.begin(222);(this->*((FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURELAYEREXTPROC)this->m_profiledFunctions[222]))(target,attachment,texture,level,layer);this->profiler.end(222,profilingStart);}
+void m_glGetObjectPtrLabel_profiling(const void* ptr,GLsizei bufSize,GLsizei* length,GLchar* label)const{auto const profilingStart=this->profiler.begin(223);(this->*((FunctionTable::MEMBERPFNGLGETOBJECTPTRLABELPROC)this->m_profiledFunctions[223]))(ptr,bufSize,length,label);this->profiler.end(223,profilingStart);}
+void m_glTextureParameteri_profiling(GLuint texture,GLenum pname,GLint param)const{auto const profilingStart=this->profiler.begin(224);(this->*((FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIPROC)this->m_profiledFunctions[224]))(texture,pname,param);this->profiler.end(224,profilingStart);}
+void m_glMultiTexCoord1fARB_profiling(GLenum target,GLfloat s)const{auto const profilingStart=this->profiler.begin(225);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD1FARBPROC)this->m_profiledFunctions[225]))(target,s);this->profiler.end(225,profilingStart);}
+void m_glUniformMatrix2x3dv_profiling(GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{auto const profilingStart=this->profiler.begin(226);(this->*((FunctionTable::MEMBERPFNGLUNIFORMMATRIX2X3DVPROC)this->m_profiledFunctions[226]))(location,count,transpose,value);this->profiler.end(226,profilingStart);}
+void m_glFramebufferDrawBufferEXT_profiling(GLuint framebuffer,GLenum mode)const{auto const profilingStart=this->profiler.begin(227);(this->*((FunctionTable::MEMBERPFNGLFRAMEBUFFERDRAWBUFFEREXTPROC)this->m_profiledFunctions[227]))(framebuffer,mode);this->profiler.end(227,profilingStart);}
+void m_glCopyColorSubTable_profiling(GLenum target,GLsizei start,GLint x,GLint y,GLsizei width)const{auto const profilingStart=this->profiler.begin(228);(this->*((FunctionTable::MEMBERPFNGLCOPYCOLORSUBTABLEPROC)this->m_profiledFunctions[228]))(target,start,x,y,width);this->profiler.end(228,profilingStart);}
+void m_glVertexAttribL3d_profiling(GLuint index,GLdouble x,GLdouble y,GLdouble z)const{auto const profilingStart=this->profiler.begin(229);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBL3DPROC)this->m_profiledFunctions[229]))(index,x,y,z);this->profiler.end(229,profilingStart);}
+void m_glFragmentMaterialfvSGIX_profiling(GLenum face,GLenum pname,const GLfloat* params)const{auto const profilingStart=this->profiler.begin(230);(this->*((FunctionTable::MEMBERPFNGLFRAGMENTMATERIALFVSGIXPROC)this->m_profiledFunctions[230]))(face,pname,params);this->profiler.end(230,profilingStart);}
+void m_glMatrixLoadTranspose3x3fNV_profiling(GLenum matrixMode,const GLfloat* m)const{auto const profilingStart=this->profiler.begin(231);(this->*((FunctionTable::MEMBERPFNGLMATRIXLOADTRANSPOSE3X3FNVPROC)this->m_profiledFunctions[231]))(matrixMode,m);this->profiler.end(231,profilingStart);}
+void m_glDeleteNamesAMD_profiling(GLenum identifier,GLuint num,const GLuint* names)const{auto const profilingStart=this->profiler.begin(232);(this->*((FunctionTable::MEMBERPFNGLDELETENAMESAMDPROC)this->m_profiledFunctions[232]))(identifier,num,names);this->profiler.end(232,profilingStart);}
+void m_glDrawRangeElementsEXT_profiling(GLenum mode,GLuint start,GLuint end,GLsizei count,GLenum type,const void* indices)const{auto const profilingStart=this->profiler.begin(233);(this->*((FunctionTable::MEMBERPFNGLDRAWRANGEELEMENTSEXTPROC)this->m_profiledFunctions[233]))(mode,start,end,count,type,indices);this->profiler.end(233,profilingStart);}
+void m_glOrtho_profiling(GLdouble left,GLdouble right,GLdouble bottom,GLdouble top,GLdouble near_val,GLdouble far_val)const{auto const profilingStart=this->profiler.begin(234);(this->*((FunctionTable::MEMBERPFNGLORTHOPROC)this->m_profiledFunctions[234]))(left,right,bottom,top,near_val,far_val);this->profiler.end(234,profilingStart);}
+void m_glProgramUniform1dvEXT_profiling(GLuint program,GLint location,GLsizei count,const GLdouble* value)const{auto const profilingStart=this->profiler.begin(235);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1DVEXTPROC)this->m_profiledFunctions[235]))(program,location,count,value);this->profiler.end(235,profilingStart);}
+void m_glColor4xOES_profiling(GLfixed red,GLfixed green,GLfixed blue,GLfixed alpha)const{auto const profilingStart=this->profiler.begin(236);(this->*((FunctionTable::MEMBERPFNGLCOLOR4XOESPROC)this->m_profiledFunctions[236]))(red,green,blue,alpha);this->profiler.end(236,profilingStart);}
+void m_glTexImage4DSGIS_profiling(GLenum target,GLint level,GLenum internalformat,GLsizei width,GLsizei height,GLsizei depth,GLsizei size4d,GLint border,GLenum format,GLenum type,const void* pixels)const{auto const profilingStart=this->profiler.begin(237);(this->*((FunctionTable::MEMBERPFNGLTEXIMAGE4DSGISPROC)this->m_profiledFunctions[237]))(target,level,internalformat,width,height,depth,size4d,border,format,type,pixels);this->profiler.end(237,profilingStart);}
+void m_glProgramUniform1ui_profiling(GLuint program,GLint location,GLuint v0)const{auto const profilingStart=this->profiler.begin(238);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UIPROC)this->m_profiledFunctions[238]))(program,location,v0);this->profiler.end(238,profilingStart);}
+void m_glDeleteBuffersARB_profiling(GLsizei n,const GLuint* buffers)const{auto const profilingStart=this->profiler.begin(239);(this->*((FunctionTable::MEMBERPFNGLDELETEBUFFERSARBPROC)this->m_profiledFunctions[239]))(n,buffers);this->profiler.end(239,profilingStart);}
+GLboolean m_glUnmapBufferARB_profiling(GLenum target)const{auto const profilingStart=this->profiler.begin(240);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLUNMAPBUFFERARBPROC)this->m_profiledFunctions[240]))(target);this->profiler.end(240,profilingStart);return profilingResult;}
+void m_glCopyTexImage2D_profiling(GLenum target,GLint level,GLenum internalformat,GLint x,GLint y,GLsizei width,GLsizei height,GLint border)const{auto const profilingStart=this->profiler.begin(241);(this->*((FunctionTable::MEMBERPFNGLCOPYTEXIMAGE2DPROC)this->m_profiledFunctions[241]))(target,level,internalformat,x,y,width,height,border);this->profiler.end(241,profilingStart);}
+void m_glMaterialxOES_profiling(GLenum face,GLenum pname,GLfixed param)const{auto const profilingStart=this->profiler.begin(242);(this->*((FunctionTable::MEMBERPFNGLMATERIALXOESPROC)this->m_profiledFunctions[242]))(face,pname,param);this->profiler.end(242,profilingStart);}
+void m_glProgramUniformMatrix2x4fvEXT_profiling(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{auto const profilingStart=this->profiler.begin(243);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X4FVEXTPROC)this->m_profiledFunctions[243]))(program,location,count,transpose,value);this->profiler.end(243,profilingStart);}
+GLboolean m_glTestObjectAPPLE_profiling(GLenum object,GLuint name)const{auto const profilingStart=this->profiler.begin(244);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLTESTOBJECTAPPLEPROC)this->m_profiledFunctions[244]))(object,name);this->profiler.end(244,profilingStart);return profilingResult;}
+void m_glRenderbufferStorageEXT_profiling(GLenum target,GLenum internalformat,GLsizei width,GLsizei height)const{auto const profilingStart=this->profiler.begin(245);(this->*((FunctionTable::MEMBERPFNGLRENDERBUFFERSTORAGEEXTPROC)this->m_profiledFunctions[245]))(target,internalformat,width,height);this->profiler.end(245,profilingStart);}
+void m_glVertexAttribL1ui64ARB_profiling(GLuint index,GLuint64EXT x)const{auto const profilingStart=this->profiler.begin(246);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBL1UI64ARBPROC)this->m_profiledFunctions[246]))(index,x);this->profiler.end(246,profilingStart);}
+void m_glEndFragmentShaderATI_profiling()const{auto const profilingStart=this->profiler.begin(247);(this->*((FunctionTable::MEMBERPFNGLENDFRAGMENTSHADERATIPROC)this->m_profiledFunctions[247]))();this->profiler.end(247,profilingStart);}
+void m_glPathParameterivNV_profiling(GLuint path,GLenum pname,const GLint* value)const{auto const profilingStart=this->profiler.begin(248);(this->*((FunctionTable::MEMBERPFNGLPATHPARAMETERIVNVPROC)this->m_profiledFunctions[248]))(path,pname,value);this->profiler.end(248,profilingStart);}
+void m_glUniform4uiv_profiling(GLint location,GLsizei count,const GLuint* value)const{auto const profilingStart=this->profiler.begin(249);(this->*((FunctionTable::MEMBERPFNGLUNIFORM4UIVPROC)this->m_profiledFunctions[249]))(location,count,value);this->profiler.end(249,profilingStart);}
+void m_glFrameZoomSGIX_profiling(GLint factor)const{auto const profilingStart=this->profiler.begin(250);(this->*((FunctionTable::MEMBERPFNGLFRAMEZOOMSGIXPROC)this->m_profiledFunctions[250]))(factor);this->profiler.end(250,profilingStart);}
+void m_glSecondaryColor3fEXT_profiling(GLfloat red,GLfloat green,GLfloat blue)const{auto const profilingStart=this->profiler.begin(251);(this->*((FunctionTable::MEMBERPFNGLSECONDARYCOLOR3FEXTPROC)this->m_profiledFunctions[251]))(red,green,blue);this->profiler.end(251,profilingStart);}
+void m_glVertexAttribL1dv_profiling(GLuint index,const GLdouble* v)const{auto const profilingStart=this->profiler.begin(252);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBL1DVPROC)this->m_profiledFunctions[252]))(index,v);this->profiler.end(252,profilingStart);}
+void m_glNormalStream3svATI_profiling(GLenum stream,const GLshort* coords)const{auto const profilingStart=this->profiler.begin(253);(this->*((FunctionTable::MEMBERPFNGLNORMALSTREAM3SVATIPROC)this->m_profiledFunctions[253]))(stream,coords);this->profiler.end(253,profilingStart);}
+void m_glPathStencilFuncNV_profiling(GLenum func,GLint ref,GLuint mask)const{auto const profilingStart=this->profiler.begin(254);(this->*((FunctionTable::MEMBERPFNGLPATHSTENCILFUNCNVPROC)this->m_profiledFunctions[254]))(func,ref,mask);this->profiler.end(254,profilingStart);}
+void m_glSetInvariantEXT_profiling(GLuint id,GLenum type,const void* addr)const{auto const profilingStart=this->profiler.begin(255);(this->*((FunctionTable::MEMBERPFNGLSETINVARIANTEXTPROC)this->m_profiledFunctions[255]))(id,type,addr);this->profiler.end(255,profilingStart);}
+void m_glGetTexBumpParameterivATI_profiling(GLenum pname,GLint* param)const{auto const profilingStart=this->profiler.begin(256);(this->*((FunctionTable::MEMBERPFNGLGETTEXBUMPPARAMETERIVATIPROC)this->m_profiledFunctions[256]))(pname,param);this->profiler.end(256,profilingStart);}
+void m_glBlendEquationSeparateEXT_profiling(GLenum modeRGB,GLenum modeAlpha)const{auto const profilingStart=this->profiler.begin(257);(this->*((FunctionTable::MEMBERPFNGLBLENDEQUATIONSEPARATEEXTPROC)this->m_profiledFunctions[257]))(modeRGB,modeAlpha);this->profiler.end(257,profilingStart);}
+void m_glEndOcclusionQueryNV_profiling()const{auto const profilingStart=this->profiler.begin(258);(this->*((FunctionTable::MEMBERPFNGLENDOCCLUSIONQUERYNVPROC)this->m_profiledFunctions[258]))();this->profiler.end(258,profilingStart);}
+void m_glScissorArrayv_profiling(GLuint first,GLsizei count,const GLint* v)const{auto const profilingStart=this->profiler.begin(259);(this->*((FunctionTable::MEMBERPFNGLSCISSORARRAYVPROC)this->m_profiledFunctions[259]))(first,count,v);this->profiler.end(259,profilingStart);}
+void m_glCallList_profiling(GLuint list)const{auto const profilingStart=this->profiler.begin(260);(this->*((FunctionTable::MEMBERPFNGLCALLLISTPROC)this->m_profiledFunctions[260]))(list);this->profiler.end(260,profilingStart);}
+void* m_glMapTexture2DINTEL_profiling(GLuint texture,GLint level,GLbitfield access,GLint* stride,GLenum* layout)const{auto const profilingStart=this->profiler.begin(261);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLMAPTEXTURE2DINTELPROC)this->m_profiledFunctions[261]))(texture,level,access,stride,layout);this->profiler.end(261,profilingStart);return profilingResult;}
+void m_glPixelTransferxOES_profiling(GLenum pname,GLfixed param)const{auto const profilingStart=this->profiler.begin(262);(this->*((FunctionTable::MEMBERPFNGLPIXELTRANSFERXOESPROC)this->m_profiledFunctions[262]))(pname,param);this->profiler.end(262,profilingStart);}
+void m_glDeleteRenderbuffersEXT_profiling(GLsizei n,const GLuint* renderbuffers)const{auto const profilingStart=this->profiler.begin(263);(this->*((FunctionTable::MEMBERPFNGLDELETERENDERBUFFERSEXTPROC)this->m_profiledFunctions[263]))(n,renderbuffers);this->profiler.end(263,profilingStart);}
+void m_glTexCoord4fColor4fNormal3fVertex4fSUN_profiling(GLfloat s,GLfloat t,GLfloat p,GLfloat q,GLfloat r,GLfloat g,GLfloat b,GLfloat a,GLfloat nx,GLfloat ny,GLfloat nz,GLfloat x,GLfloat y,GLfloat z,GLfloat w)const{auto const profilingStart=this->profiler.begin(264);(this->*((FunctionTable::MEMBERPFNGLTEXCOORD4FCOLOR4FNORMAL3FVERTEX4FSUNPROC)this->m_profiledFunctions[264]))(s,t,p,q,r,g,b,a,nx,ny,nz,x,y,z,w);this->profiler.end(264,profilingStart);}
+void m_glProgramUniformMatrix4dvEXT_profiling(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{auto const profilingStart=this->profiler.begin(265);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4DVEXTPROC)this->m_profiledFunctions[265]))(program,location,count,transpose,value);this->profiler.end(265,profilingStart);}
+void m_glGetnColorTable_profiling(GLenum target,GLenum format,GLenum type,GLsizei bufSize,void* table)const{auto const profilingStart=this->profiler.begin(266);(this->*((FunctionTable::MEMBERPFNGLGETNCOLORTABLEPROC)this->m_profiledFunctions[266]))(target,format,type,bufSize,table);this->profiler.end(266,profilingStart);}
+void m_glFramebufferTextureLayerARB_profiling(GLenum target,GLenum attachment,GLuint texture,GLint level,GLint layer)const{auto const profilingStart=this->profiler.begin(267);(this->*((FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURELAYERARBPROC)this->m_profiledFunctions[267]))(target,attachment,texture,level,layer);this->profiler.end(267,profilingStart);}
+void m_glVertexAttribL2dvEXT_profiling(GLuint index,const GLdouble* v)const{auto const profilingStart=this->profiler.begin(268);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBL2DVEXTPROC)this->m_profiledFunctions[268]))(index,v);this->profiler.end(268,profilingStart);}
+void m_glGetCombinerStageParameterfvNV_profiling(GLenum stage,GLenum pname,GLfloat* params)const{auto const profilingStart=this->profiler.begin(269);(this->*((FunctionTable::MEMBERPFNGLGETCOMBINERSTAGEPARAMETERFVNVPROC)this->m_profiledFunctions[269]))(stage,pname,params);this->profiler.end(269,profilingStart);}
+void m_glMultiTexCoord1xvOES_profiling(GLenum texture,const GLfixed* coords)const{auto const profilingStart=this->profiler.begin(270);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD1XVOESPROC)this->m_profiledFunctions[270]))(texture,coords);this->profiler.end(270,profilingStart);}
+void* m_glMapBuffer_profiling(GLenum target,GLenum access)const{auto const profilingStart=this->profiler.begin(271);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLMAPBUFFERPROC)this->m_profiledFunctions[271]))(target,access);this->profiler.end(271,profilingStart);return profilingResult;}
+void m_glSecondaryColor3d_profiling(GLdouble red,GLdouble green,GLdouble blue)const{auto const profilingStart=this->profiler.begin(272);(this->*((FunctionTable::MEMBERPFNGLSECONDARYCOLOR3DPROC)this->m_profiledFunctions[272]))(red,green,blue);this->profiler.end(272,profilingStart);}
+void m_glSecondaryColor3f_profiling(GLfloat red,GLfloat green,GLfloat blue)const{auto const profilingStart=this->profiler.begin(273);(this->*((FunctionTable::MEMBERPFNGLSECONDARYCOLOR3FPROC)this->m_profiledFunctions[273]))(red,green,blue);this->profiler.end(273,profilingStart);}
+void m_glVertexAttribLFormat_profiling(GLuint attribindex,GLint size,GLenum type,GLuint relativeoffset)const{auto const profilingStart=this->profiler.begin(274);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBLFORMATPROC)this->m_profiledFunctions[274]))(attribindex,size,type,relativeoffset);this->profiler.end(274,profilingStart);}
+void m_glElementPointerAPPLE_profiling(GLenum type,const void* pointer)const{auto const profilingStart=this->profiler.begin(275);(this->*((FunctionTable::MEMBERPFNGLELEMENTPOINTERAPPLEPROC)this->m_profiledFunctions[275]))(type,pointer);this->profiler.end(275,profilingStart);}
+void m_glVertexStream1fATI_profiling(GLenum stream,GLfloat x)const{auto const profilingStart=this->profiler.begin(276);(this->*((FunctionTable::MEMBERPFNGLVERTEXSTREAM1FATIPROC)this->m_profiledFunctions[276]))(stream,x);this->profiler.end(276,profilingStart);}
+void m_glCoverageModulationNV_profiling(GLenum components)const{auto const profilingStart=this->profiler.begin(277);(this->*((FunctionTable::MEMBERPFNGLCOVERAGEMODULATIONNVPROC)this->m_profiledFunctions[277]))(components);this->profiler.end(277,profilingStart);}
+void m_glSecondaryColor3i_profiling(GLint red,GLint green,GLint blue)const{auto const profilingStart=this->profiler.begin(278);(this->*((FunctionTable::MEMBERPFNGLSECONDARYCOLOR3IPROC)this->m_profiledFunctions[278]))(red,green,blue);this->profiler.end(278,profilingStart);}
+void m_glDeleteSync_profiling(GLsync sync)const{auto const profilingStart=this->profiler.begin(279);(this->*((FunctionTable::MEMBERPFNGLDELETESYNCPROC)this->m_profiledFunctions[279]))(sync);this->profiler.end(279,profilingStart);}
+void m_glGetProgramParameterfvNV_profiling(GLenum target,GLuint index,GLenum pname,GLfloat* params)const{auto const profilingStart=this->profiler.begin(280);(this->*((FunctionTable::MEMBERPFNGLGETPROGRAMPARAMETERFVNVPROC)this->m_profiledFunctions[280]))(target,index,pname,params);this->profiler.end(280,profilingStart);}
+void m_glMaxShaderCompilerThreadsARB_profiling(GLuint count)const{auto const profilingStart=this->profiler.begin(281);(this->*((FunctionTable::MEMBERPFNGLMAXSHADERCOMPILERTHREADSARBPROC)this->m_profiledFunctions[281]))(count);this->profiler.end(281,profilingStart);}
+void m_glUniformMatrix4x2dv_profiling(GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{auto const profilingStart=this->profiler.begin(282);(this->*((FunctionTable::MEMBERPFNGLUNIFORMMATRIX4X2DVPROC)this->m_profiledFunctions[282]))(location,count,transpose,value);this->profiler.end(282,profilingStart);}
+void m_glVertexArrayVertexAttribLOffsetEXT_profiling(GLuint vaobj,GLuint buffer,GLuint index,GLint size,GLenum type,GLsizei stride,GLintptr offset)const{auto const profilingStart=this->profiler.begin(283);(this->*((FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBLOFFSETEXTPROC)this->m_profiledFunctions[283]))(vaobj,buffer,index,size,type,stride,offset);this->profiler.end(283,profilingStart);}
+void m_glSecondaryColor3s_profiling(GLshort red,GLshort green,GLshort blue)const{auto const profilingStart=this->profiler.begin(284);(this->*((FunctionTable::MEMBERPFNGLSECONDARYCOLOR3SPROC)this->m_profiledFunctions[284]))(red,green,blue);this->profiler.end(284,profilingStart);}
+GLboolean m_glIsImageHandleResidentNV_profiling(GLuint64 handle)const{auto const profilingStart=this->profiler.begin(285);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLISIMAGEHANDLERESIDENTNVPROC)this->m_profiledFunctions[285]))(handle);this->profiler.end(285,profilingStart);return profilingResult;}
+void m_glUniform3iv_profiling(GLint location,GLsizei count,const GLint* value)const{auto const profilingStart=this->profiler.begin(286);(this->*((FunctionTable::MEMBERPFNGLUNIFORM3IVPROC)this->m_profiledFunctions[286]))(location,count,value);this->profiler.end(286,profilingStart);}
+void m_glVertexAttribL3i64vNV_profiling(GLuint index,const GLint64EXT* v)const{auto const profilingStart=this->profiler.begin(287);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBL3I64VNVPROC)this->m_profiledFunctions[287]))(index,v);this->profiler.end(287,profilingStart);}
+void m_glPolygonMode_profiling(GLenum face,GLenum mode)const{auto const profilingStart=this->profiler.begin(288);(this->*((FunctionTable::MEMBERPFNGLPOLYGONMODEPROC)this->m_profiledFunctions[288]))(face,mode);this->profiler.end(288,profilingStart);}
+void m_glConvolutionFilter1DEXT_profiling(GLenum target,GLenum internalformat,GLsizei width,GLenum format,GLenum type,const void* image)const{auto const profilingStart=this->profiler.begin(289);(this->*((FunctionTable::MEMBERPFNGLCONVOLUTIONFILTER1DEXTPROC)this->m_profiledFunctions[289]))(target,internalformat,width,format,type,image);this->profiler.end(289,profilingStart);}
+void m_glVertexAttrib1dvARB_profiling(GLuint index,const GLdouble* v)const{auto const profilingStart=this->profiler.begin(290);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB1DVARBPROC)this->m_profiledFunctions[290]))(index,v);this->profiler.end(290,profilingStart);}
+void m_glTextureSubImage2DEXT_profiling(GLuint texture,GLenum target,GLint level,GLint xoffset,GLint yoffset,GLsizei width,GLsizei height,GLenum format,GLenum type,const void* pixels)const{auto const profilingStart=this->profiler.begin(291);(this->*((FunctionTable::MEMBERPFNGLTEXTURESUBIMAGE2DEXTPROC)this->m_profiledFunctions[291]))(texture,target,level,xoffset,yoffset,width,height,format,type,pixels);this->profiler.end(291,profilingStart);}
+GLboolean m_glIsVertexArrayAPPLE_profiling(GLuint array)const{auto const profilingStart=this->profiler.begin(292);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLISVERTEXARRAYAPPLEPROC)this->m_profiledFunctions[292]))(array);this->profiler.end(292,profilingStart);return profilingResult;}
+void m_glUseProgram_profiling(GLuint program)const{auto const profilingStart=this->profiler.begin(293);(this->*((FunctionTable::MEMBERPFNGLUSEPROGRAMPROC)this->m_profiledFunctions[293]))(program);this->profiler.end(293,profilingStart);}
+void m_glLineStipple_profiling(GLint factor,GLushort pattern)const{auto const profilingStart=this->profiler.begin(294);(this->*((FunctionTable::MEMBERPFNGLLINESTIPPLEPROC)this->m_profiledFunctions[294]))(factor,pattern);this->profiler.end(294,profilingStart);}
+void m_glMultiTexCoord4fvARB_profiling(GLenum target,const GLfloat* v)const{auto const profilingStart=this->profiler.begin(295);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD4FVARBPROC)this->m_profiledFunctions[295]))(target,v);this->profiler.end(295,profilingStart);}
+GLenum m_glVideoCaptureNV_profiling(GLuint video_capture_slot,GLuint* sequence_num,GLuint64EXT* capture_time)const{auto const profilingStart=this->profiler.begin(296);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLVIDEOCAPTURENVPROC)this->m_profiledFunctions[296]))(video_capture_slot,sequence_num,capture_time);this->profiler.end(296,profilingStart);return profilingResult;}
+void m_glVertexArrayVertexAttribLFormatEXT_profiling(GLuint vaobj,GLuint attribindex,GLint size,GLenum type,GLuint relativeoffset)const{auto const profilingStart=this->profiler.begin(297);(this->*((FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBLFORMATEXTPROC)this->m_profiledFunctions[297]))(vaobj,attribindex,size,type,relativeoffset);this->profiler.end(297,profilingStart);}
+void m_glUniform3fvARB_profiling(GLint location,GLsizei count,const GLfloat* value)const{auto const profilingStart=this->profiler.begin(298);(this->*((FunctionTable::MEMBERPFNGLUNIFORM3FVARBPROC)this->m_profiledFunctions[298]))(location,count,value);this->profiler.end(298,profilingStart);}
+void m_glProgramUniformMatrix3x2fvEXT_profiling(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{auto const profilingStart=this->profiler.begin(299);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X2FVEXTPROC)this->m_profiledFunctions[299]))(program,location,count,transpose,value);this->profiler.end(299,profilingStart);}
+void m_glCopyTextureSubImage3DEXT_profiling(GLuint texture,GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLint x,GLint y,GLsizei width,GLsizei height)const{auto const profilingStart=this->profiler.begin(300);(this->*((FunctionTable::MEMBERPFNGLCOPYTEXTURESUBIMAGE3DEXTPROC)this->m_profiledFunctions[300]))(texture,target,level,xoffset,yoffset,zoffset,x,y,width,height);this->profiler.end(300,profilingStart);}
+void m_glMultiTexCoord2bvOES_profiling(GLenum texture,const GLbyte* coords)const{auto const profilingStart=this->profiler.begin(301);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD2BVOESPROC)this->m_profiledFunctions[301]))(texture,coords);this->profiler.end(301,profilingStart);}
+void m_glDeleteObjectARB_profiling(GLhandleARB obj)const{auto const profilingStart=this->profiler.begin(302);(this->*((FunctionTable::MEMBERPFNGLDELETEOBJECTARBPROC)this->m_profiledFunctions[302]))(obj);this->profiler.end(302,profilingStart);}
+void m_glTextureLightEXT_profiling(GLenum pname)const{auto const profilingStart=this->profiler.begin(303);(this->*((FunctionTable::MEMBERPFNGLTEXTURELIGHTEXTPROC)this->m_profiledFunctions[303]))(pname);this->profiler.end(303,profilingStart);}
+void m_glMultiTexCoord3dARB_profiling(GLenum target,GLdouble s,GLdouble t,GLdouble r)const{auto const profilingStart=this->profiler.begin(304);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD3DARBPROC)this->m_profiledFunctions[304]))(target,s,t,r);this->profiler.end(304,profilingStart);}
+void m_glNamedFramebufferTextureEXT_profiling(GLuint framebuffer,GLenum attachment,GLuint texture,GLint level)const{auto const profilingStart=this->profiler.begin(305);(this->*((FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTUREEXTPROC)this->m_profiledFunctions[305]))(framebuffer,attachment,texture,level);this->profiler.end(305,profilingStart);}
+void m_glTextureParameteriEXT_profiling(GLuint texture,GLenum target,GLenum pname,GLint param)const{auto const profilingStart=this->profiler.begin(306);(this->*((FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIEXTPROC)this->m_profiledFunctions[306]))(texture,target,pname,param);this->profiler.end(306,profilingStart);}
+void m_glEvalCoord2xvOES_profiling(const GLfixed* coords)const{auto const profilingStart=this->profiler.begin(307);(this->*((FunctionTable::MEMBERPFNGLEVALCOORD2XVOESPROC)this->m_profiledFunctions[307]))(coords);this->profiler.end(307,profilingStart);}
+void m_glBindVideoCaptureStreamBufferNV_profiling(GLuint video_capture_slot,GLuint stream,GLenum frame_region,GLintptrARB offset)const{auto const profilingStart=this->profiler.begin(308);(this->*((FunctionTable::MEMBERPFNGLBINDVIDEOCAPTURESTREAMBUFFERNVPROC)this->m_profiledFunctions[308]))(video_capture_slot,stream,frame_region,offset);this->profiler.end(308,profilingStart);}
+void m_glTexImage2DMultisampleCoverageNV_profiling(GLenum target,GLsizei coverageSamples,GLsizei colorSamples,GLint internalFormat,GLsizei width,GLsizei height,GLboolean fixedSampleLocations)const{auto const profilingStart=this->profiler.begin(309);(this->*((FunctionTable::MEMBERPFNGLTEXIMAGE2DMULTISAMPLECOVERAGENVPROC)this->m_profiledFunctions[309]))(target,coverageSamples,colorSamples,internalFormat,width,height,fixedSampleLocations);this->profiler.end(309,profilingStart);}
+GLint m_glGetAttribLocationARB_profiling(GLhandleARB programObj,const GLcharARB* name)const{auto const profilingStart=this->profiler.begin(310);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLGETATTRIBLOCATIONARBPROC)this->m_profiledFunctions[310]))(programObj,name);this->profiler.end(310,profilingStart);return profilingResult;}
+void m_glDeleteShader_profiling(GLuint shader)const{auto const profilingStart=this->profiler.begin(311);(this->*((FunctionTable::MEMBERPFNGLDELETESHADERPROC)this->m_profiledFunctions[311]))(shader);this->profiler.end(311,profilingStart);}
+void m_glVertexAttrib1fARB_profiling(GLuint index,GLfloat x)const{auto const profilingStart=this->profiler.begin(312);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB1FARBPROC)this->m_profiledFunctions[312]))(index,x);this->profiler.end(312,profilingStart);}
+void m_glTexCoord2fColor4ubVertex3fSUN_profiling(GLfloat s,GLfloat t,GLubyte r,GLubyte g,GLubyte b,GLubyte a,GLfloat x,GLfloat y,GLfloat z)const{auto const profilingStart=this->profiler.begin(313);(this->*((FunctionTable::MEMBERPFNGLTEXCOORD2FCOLOR4UBVERTEX3FSUNPROC)this->m_profiledFunctions[313]))(s,t,r,g,b,a,x,y,z);this->profiler.end(313,profilingStart);}
+void m_glTexCoord4fVertex4fSUN_profiling(GLfloat s,GLfloat t,GLfloat p,GLfloat q,GLfloat x,GLfloat y,GLfloat z,GLfloat w)const{auto const profilingStart=this->profiler.begin(314);(this->*((FunctionTable::MEMBERPFNGLTEXCOORD4FVERTEX4FSUNPROC)this->m_profiledFunctions[314]))(s,t,p,q,x,y,z,w);this->profiler.end(314,profilingStart);}
+void m_glGetMapdv_profiling(GLenum target,GLenum query,GLdouble* v)const{auto const profilingStart=this->profiler.begin(315);(this->*((FunctionTable::MEMBERPFNGLGETMAPDVPROC)this->m_profiledFunctions[315]))(target,query,v);this->profiler.end(315,profilingStart);}
+void m_glMapParameterfvNV_profiling(GLenum target,GLenum pname,const GLfloat* params)const{auto const profilingStart=this->profiler.begin(316);(this->*((FunctionTable::MEMBERPFNGLMAPPARAMETERFVNVPROC)this->m_profiledFunctions[316]))(target,pname,params);this->profiler.end(316,profilingStart);}
+void m_glTextureParameterIuiv_profiling(GLuint texture,GLenum pname,const GLuint* params)const{auto const profilingStart=this->profiler.begin(317);(this->*((FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIUIVPROC)this->m_profiledFunctions[317]))(texture,pname,params);this->profiler.end(317,profilingStart);}
+void m_glTransformFeedbackAttribsNV_profiling(GLsizei count,const GLint* attribs,GLenum bufferMode)const{auto const profilingStart=this->profiler.begin(318);(this->*((FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKATTRIBSNVPROC)this->m_profiledFunctions[318]))(count,attribs,bufferMode);this->profiler.end(318,profilingStart);}
+void m_glFragmentLightfvSGIX_profiling(GLenum light,GLenum pname,const GLfloat* params)const{auto const profilingStart=this->profiler.begin(319);(this->*((FunctionTable::MEMBERPFNGLFRAGMENTLIGHTFVSGIXPROC)this->m_profiledFunctions[319]))(light,pname,params);this->profiler.end(319,profilingStart);}
+void m_glWindowPos3sARB_profiling(GLshort x,GLshort y,GLshort z)const{auto const profilingStart=this->profiler.begin(320);(this->*((FunctionTable::MEMBERPFNGLWINDOWPOS3SARBPROC)this->m_profiledFunctions[320]))(x,y,z);this->profiler.end(320,profilingStart);}
+void m_glGetConvolutionParameterfv_profiling(GLenum target,GLenum pname,GLfloat* params)const{auto const profilingStart=this->profiler.begin(321);(this->*((FunctionTable::MEMBERPFNGLGETCONVOLUTIONPARAMETERFVPROC)this->m_profiledFunctions[321]))(target,pname,params);this->profiler.end(321,profilingStart);}
+void m_glCopyTexSubImage3D_profiling(GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLint x,GLint y,GLsizei width,GLsizei height)const{auto const profilingStart=this->profiler.begin(322);(this->*((FunctionTable::MEMBERPFNGLCOPYTEXSUBIMAGE3DPROC)this->m_profiledFunctions[322]))(target,level,xoffset,yoffset,zoffset,x,y,width,height);this->profiler.end(322,profilingStart);}
+void m_glVertexAttribI3i_profiling(GLuint index,GLint x,GLint y,GLint z)const{auto const profilingStart=this->profiler.begin(323);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBI3IPROC)this->m_profiledFunctions[323]))(index,x,y,z);this->profiler.end(323,profilingStart);}
+GLhandleARB m_glCreateShaderObjectARB_profiling(GLenum shaderType)const{auto const profilingStart=this->profiler.begin(324);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLCREATESHADEROBJECTARBPROC)this->m_profiledFunctions[324]))(shaderType);this->profiler.end(324,profilingStart);return profilingResult;}
+void m_glVertexAttribFormat_profiling(GLuint attribindex,GLint size,GLenum type,GLboolean normalized,GLuint relativeoffset)const{auto const profilingStart=this->profiler.begin(325);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBFORMATPROC)this->m_profiledFunctions[325]))(attribindex,size,type,normalized,relativeoffset);this->profiler.end(325,profilingStart);}
+void m_glGetProgramivARB_profiling(GLenum target,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(326);(this->*((FunctionTable::MEMBERPFNGLGETPROGRAMIVARBPROC)this->m_profiledFunctions[326]))(target,pname,params);this->profiler.end(326,profilingStart);}
+void m_glVertexAttribI4usv_profiling(GLuint index,const GLushort* v)const{auto const profilingStart=this->profiler.begin(327);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBI4USVPROC)this->m_profiledFunctions[327]))(index,v);this->profiler.end(327,profilingStart);}
+void m_glTexParameterf_profiling(GLenum target,GLenum pname,GLfloat param)const{auto const profilingStart=this->profiler.begin(328);(this->*((FunctionTable::MEMBERPFNGLTEXPARAMETERFPROC)this->m_profiledFunctions[328]))(target,pname,param);this->profiler.end(328,profilingStart);}
+void m_glVertexAttribBinding_profiling(GLuint attribindex,GLuint bindingindex)const{auto const profilingStart=this->profiler.begin(329);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBBINDINGPROC)this->m_profiledFunctions[329]))(attribindex,bindingindex);this->profiler.end(329,profilingStart);}
+void m_glGetHistogramParameteriv_profiling(GLenum target,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(330);(this->*((FunctionTable::MEMBERPFNGLGETHISTOGRAMPARAMETERIVPROC)this->m_profiledFunctions[330]))(target,pname,params);this->profiler.end(330,profilingStart);}
+void m_glTexParameteri_profiling(GLenum target,GLenum pname,GLint param)const{auto const profilingStart=this->profiler.begin(331);(this->*((FunctionTable::MEMBERPFNGLTEXPARAMETERIPROC)this->m_profiledFunctions[331]))(target,pname,param);this->profiler.end(331,profilingStart);}
+void m_glGetShaderSource_profiling(GLuint shader,GLsizei bufSize,GLsizei* length,GLchar* source)const{auto const profilingStart=this->profiler.begin(332);(this->*((FunctionTable::MEMBERPFNGLGETSHADERSOURCEPROC)this->m_profiledFunctions[332]))(shader,bufSize,length,source);this->profiler.end(332,profilingStart);}
+void m_glVertexAttrib4s_profiling(GLuint index,GLshort x,GLshort y,GLshort z,GLshort w)const{auto const profilingStart=this->profiler.begin(333);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB4SPROC)this->m_profiledFunctions[333]))(index,x,y,z,w);this->profiler.end(333,profilingStart);}
+void m_glVertexAttrib4dvNV_profiling(GLuint index,const GLdouble* v)const{auto const profilingStart=this->profiler.begin(334);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB4DVNVPROC)this->m_profiledFunctions[334]))(index,v);this->profiler.end(334,profilingStart);}
+void m_glVertexAttrib1dvNV_profiling(GLuint index,const GLdouble* v)const{auto const profilingStart=this->profiler.begin(335);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB1DVNVPROC)this->m_profiledFunctions[335]))(index,v);this->profiler.end(335,profilingStart);}
+void m_glPopName_profiling()const{auto const profilingStart=this->profiler.begin(336);(this->*((FunctionTable::MEMBERPFNGLPOPNAMEPROC)this->m_profiledFunctions[336]))();this->profiler.end(336,profilingStart);}
+void m_glTextureBufferEXT_profiling(GLuint texture,GLenum target,GLenum internalformat,GLuint buffer)const{auto const profilingStart=this->profiler.begin(337);(this->*((FunctionTable::MEMBERPFNGLTEXTUREBUFFEREXTPROC)this->m_profiledFunctions[337]))(texture,target,internalformat,buffer);this->profiler.end(337,profilingStart);}
+void m_glGetMultiTexImageEXT_profiling(GLenum texunit,GLenum target,GLint level,GLenum format,GLenum type,void* pixels)const{auto const profilingStart=this->profiler.begin(338);(this->*((FunctionTable::MEMBERPFNGLGETMULTITEXIMAGEEXTPROC)this->m_profiledFunctions[338]))(texunit,target,level,format,type,pixels);this->profiler.end(338,profilingStart);}
+void m_glGetPointerIndexedvEXT_profiling(GLenum target,GLuint index,void** data)const{auto const profilingStart=this->profiler.begin(339);(this->*((FunctionTable::MEMBERPFNGLGETPOINTERINDEXEDVEXTPROC)this->m_profiledFunctions[339]))(target,index,data);this->profiler.end(339,profilingStart);}
+GLboolean m_glIsNameAMD_profiling(GLenum identifier,GLuint name)const{auto const profilingStart=this->profiler.begin(340);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLISNAMEAMDPROC)this->m_profiledFunctions[340]))(identifier,name);this->profiler.end(340,profilingStart);return profilingResult;}
+void m_glColor4ub_profiling(GLubyte red,GLubyte green,GLubyte blue,GLubyte alpha)const{auto const profilingStart=this->profiler.begin(341);(this->*((FunctionTable::MEMBERPFNGLCOLOR4UBPROC)this->m_profiledFunctions[341]))(red,green,blue,alpha);this->profiler.end(341,profilingStart);}
+void m_glBufferParameteriAPPLE_profiling(GLenum target,GLenum pname,GLint param)const{auto const profilingStart=this->profiler.begin(342);(this->*((FunctionTable::MEMBERPFNGLBUFFERPARAMETERIAPPLEPROC)this->m_profiledFunctions[342]))(target,pname,param);this->profiler.end(342,profilingStart);}
+void m_glColor4ui_profiling(GLuint red,GLuint green,GLuint blue,GLuint alpha)const{auto const profilingStart=this->profiler.begin(343);(this->*((FunctionTable::MEMBERPFNGLCOLOR4UIPROC)this->m_profiledFunctions[343]))(red,green,blue,alpha);this->profiler.end(343,profilingStart);}
+void m_glGetInternalformativ_profiling(GLenum target,GLenum internalformat,GLenum pname,GLsizei bufSize,GLint* params)const{auto const profilingStart=this->profiler.begin(344);(this->*((FunctionTable::MEMBERPFNGLGETINTERNALFORMATIVPROC)this->m_profiledFunctions[344]))(target,internalformat,pname,bufSize,params);this->profiler.end(344,profilingStart);}
+void m_glColor4us_profiling(GLushort red,GLushort green,GLushort blue,GLushort alpha)const{auto const profilingStart=this->profiler.begin(345);(this->*((FunctionTable::MEMBERPFNGLCOLOR4USPROC)this->m_profiledFunctions[345]))(red,green,blue,alpha);this->profiler.end(345,profilingStart);}
+void m_glVertexAttribP1uiv_profiling(GLuint index,GLenum type,GLboolean normalized,const GLuint* value)const{auto const profilingStart=this->profiler.begin(346);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBP1UIVPROC)this->m_profiledFunctions[346]))(index,type,normalized,value);this->profiler.end(346,profilingStart);}
+void m_glLinkProgram_profiling(GLuint program)const{auto const profilingStart=this->profiler.begin(347);(this->*((FunctionTable::MEMBERPFNGLLINKPROGRAMPROC)this->m_profiledFunctions[347]))(program);this->profiler.end(347,profilingStart);}
+void m_glTexCoord3s_profiling(GLshort s,GLshort t,GLshort r)const{auto const profilingStart=this->profiler.begin(348);(this->*((FunctionTable::MEMBERPFNGLTEXCOORD3SPROC)this->m_profiledFunctions[348]))(s,t,r);this->profiler.end(348,profilingStart);}
+void m_glTexCoord2dv_profiling(const GLdouble* v)const{auto const profilingStart=this->profiler.begin(349);(this->*((FunctionTable::MEMBERPFNGLTEXCOORD2DVPROC)this->m_profiledFunctions[349]))(v);this->profiler.end(349,profilingStart);}
+void m_glGetObjectLabel_profiling(GLenum identifier,GLuint name,GLsizei bufSize,GLsizei* length,GLchar* label)const{auto const profilingStart=this->profiler.begin(350);(this->*((FunctionTable::MEMBERPFNGLGETOBJECTLABELPROC)this->m_profiledFunctions[350]))(identifier,name,bufSize,length,label);this->profiler.end(350,profilingStart);}
+void m_glVertexPointerEXT_profiling(GLint size,GLenum type,GLsizei stride,GLsizei count,const void* pointer)const{auto const profilingStart=this->profiler.begin(351);(this->*((FunctionTable::MEMBERPFNGLVERTEXPOINTEREXTPROC)this->m_profiledFunctions[351]))(size,type,stride,count,pointer);this->profiler.end(351,profilingStart);}
+void m_glDebugMessageCallbackARB_profiling(GLDEBUGPROCARB callback,const void* userParam)const{auto const profilingStart=this->profiler.begin(352);(this->*((FunctionTable::MEMBERPFNGLDEBUGMESSAGECALLBACKARBPROC)this->m_profiledFunctions[352]))(callback,userParam);this->profiler.end(352,profilingStart);}
+const GLubyte* m_glGetString_profiling(GLenum name)const{auto const profilingStart=this->profiler.begin(353);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLGETSTRINGPROC)this->m_profiledFunctions[353]))(name);this->profiler.end(353,profilingStart);return profilingResult;}
+void m_glGetPathParameterfvNV_profiling(GLuint path,GLenum pname,GLfloat* value)const{auto const profilingStart=this->profiler.begin(354);(this->*((FunctionTable::MEMBERPFNGLGETPATHPARAMETERFVNVPROC)this->m_profiledFunctions[354]))(path,pname,value);this->profiler.end(354,profilingStart);}
+void m_glLightxvOES_profiling(GLenum light,GLenum pname,const GLfixed* params)const{auto const profilingStart=this->profiler.begin(355);(this->*((FunctionTable::MEMBERPFNGLLIGHTXVOESPROC)this->m_profiledFunctions[355]))(light,pname,params);this->profiler.end(355,profilingStart);}
+void m_glEndQuery_profiling(GLenum target)const{auto const profilingStart=this->profiler.begin(356);(this->*((FunctionTable::MEMBERPFNGLENDQUERYPROC)this->m_profiledFunctions[356]))(target);this->profiler.end(356,profilingStart);}
+void m_glSecondaryColor3uiv_profiling(const GLuint* v)const{auto const profilingStart=this->profiler.begin(357);(this->*((FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UIVPROC)this->m_profiledFunctions[357]))(v);this->profiler.end(357,profilingStart);}
+void m_glPrioritizeTexturesxOES_profiling(GLsizei n,const GLuint* textures,const GLfixed* priorities)const{auto const profilingStart=this->profiler.begin(358);(this->*((FunctionTable::MEMBERPFNGLPRIORITIZETEXTURESXOESPROC)this->m_profiledFunctions[358]))(n,textures,priorities);this->profiler.end(358,profilingStart);}
+void m_glEdgeFlagPointer_profiling(GLsizei stride,const GLvoid* ptr)const{auto const profilingStart=this->profiler.begin(359);(this->*((FunctionTable::MEMBERPFNGLEDGEFLAGPOINTERPROC)this->m_profiledFunctions[359]))(stride,ptr);this->profiler.end(359,profilingStart);}
+void m_glFramebufferParameteri_profiling(GLenum target,GLenum pname,GLint param)const{auto const profilingStart=this->profiler.begin(360);(this->*((FunctionTable::MEMBERPFNGLFRAMEBUFFERPARAMETERIPROC)this->m_profiledFunctions[360]))(target,pname,param);this->profiler.end(360,profilingStart);}
+void m_glTexCoord3hNV_profiling(GLhalfNV s,GLhalfNV t,GLhalfNV r)const{auto const profilingStart=this->profiler.begin(361);(this->*((FunctionTable::MEMBERPFNGLTEXCOORD3HNVPROC)this->m_profiledFunctions[361]))(s,t,r);this->profiler.end(361,profilingStart);}
+void m_glMultiModeDrawElementsIBM_profiling(const GLenum* mode,const GLsizei* count,GLenum type,const void*const* indices,GLsizei primcount,GLint modestride)const{auto const profilingStart=this->profiler.begin(362);(this->*((FunctionTable::MEMBERPFNGLMULTIMODEDRAWELEMENTSIBMPROC)this->m_profiledFunctions[362]))(mode,count,type,indices,primcount,modestride);this->profiler.end(362,profilingStart);}
+void m_glCopyPixels_profiling(GLint x,GLint y,GLsizei width,GLsizei height,GLenum type)const{auto const profilingStart=this->profiler.begin(363);(this->*((FunctionTable::MEMBERPFNGLCOPYPIXELSPROC)this->m_profiledFunctions[363]))(x,y,width,height,type);this->profiler.end(363,profilingStart);}
+void m_glVertexAttribI2ui_profiling(GLuint index,GLuint x,GLuint y)const{auto const profilingStart=this->profiler.begin(364);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBI2UIPROC)this->m_profiledFunctions[364]))(index,x,y);this->profiler.end(364,profilingStart);}
+void m_glClampColorARB_profiling(GLenum target,GLenum clamp)const{auto const profilingStart=this->profiler.begin(365);(this->*((FunctionTable::MEMBERPFNGLCLAMPCOLORARBPROC)this->m_profiledFunctions[365]))(target,clamp);this->profiler.end(365,profilingStart);}
+void m_glColorPointervINTEL_profiling(GLint size,GLenum type,const void** pointer)const{auto const profilingStart=this->profiler.begin(366);(this->*((FunctionTable::MEMBERPFNGLCOLORPOINTERVINTELPROC)this->m_profiledFunctions[366]))(size,type,pointer);this->profiler.end(366,profilingStart);}
+void m_glDeleteTextures_profiling(GLsizei n,const GLuint* textures)const{auto const profilingStart=this->profiler.begin(367);(this->*((FunctionTable::MEMBERPFNGLDELETETEXTURESPROC)this->m_profiledFunctions[367]))(n,textures);this->profiler.end(367,profilingStart);}
+void m_glGetMinmaxParameterfvEXT_profiling(GLenum target,GLenum pname,GLfloat* params)const{auto const profilingStart=this->profiler.begin(368);(this->*((FunctionTable::MEMBERPFNGLGETMINMAXPARAMETERFVEXTPROC)this->m_profiledFunctions[368]))(target,pname,params);this->profiler.end(368,profilingStart);}
+void m_glWindowPos3sMESA_profiling(GLshort x,GLshort y,GLshort z)const{auto const profilingStart=this->profiler.begin(369);(this->*((FunctionTable::MEMBERPFNGLWINDOWPOS3SMESAPROC)this->m_profiledFunctions[369]))(x,y,z);this->profiler.end(369,profilingStart);}
+void m_glVertexAttrib4f_profiling(GLuint index,GLfloat x,GLfloat y,GLfloat z,GLfloat w)const{auto const profilingStart=this->profiler.begin(370);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB4FPROC)this->m_profiledFunctions[370]))(index,x,y,z,w);this->profiler.end(370,profilingStart);}
+void m_glNamedFramebufferParameteri_profiling(GLuint framebuffer,GLenum pname,GLint param)const{auto const profilingStart=this->profiler.begin(371);(this->*((FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERPARAMETERIPROC)this->m_profiledFunctions[371]))(framebuffer,pname,param);this->profiler.end(371,profilingStart);}
+void m_glTexCoord2fVertex3fvSUN_profiling(const GLfloat* tc,const GLfloat* v)const{auto const profilingStart=this->profiler.begin(372);(this->*((FunctionTable::MEMBERPFNGLTEXCOORD2FVERTEX3FVSUNPROC)this->m_profiledFunctions[372]))(tc,v);this->profiler.end(372,profilingStart);}
+void m_glReplacementCodeusSUN_profiling(GLushort code)const{auto const profilingStart=this->profiler.begin(373);(this->*((FunctionTable::MEMBERPFNGLREPLACEMENTCODEUSSUNPROC)this->m_profiledFunctions[373]))(code);this->profiler.end(373,profilingStart);}
+void m_glGetNamedFramebufferParameteriv_profiling(GLuint framebuffer,GLenum pname,GLint* param)const{auto const profilingStart=this->profiler.begin(374);(this->*((FunctionTable::MEMBERPFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC)this->m_profiledFunctions[374]))(framebuffer,pname,param);this->profiler.end(374,profilingStart);}
+void m_glVertexStream1fvATI_profiling(GLenum stream,const GLfloat* coords)const{auto const profilingStart=this->profiler.begin(375);(this->*((FunctionTable::MEMBERPFNGLVERTEXSTREAM1FVATIPROC)this->m_profiledFunctions[375]))(stream,coords);this->profiler.end(375,profilingStart);}
+void m_glCreateVertexArrays_profiling(GLsizei n,GLuint* arrays)const{auto const profilingStart=this->profiler.begin(376);(this->*((FunctionTable::MEMBERPFNGLCREATEVERTEXARRAYSPROC)this->m_profiledFunctions[376]))(n,arrays);this->profiler.end(376,profilingStart);}
+void m_glBeginConditionalRender_profiling(GLuint id,GLenum mode)const{auto const profilingStart=this->profiler.begin(377);(this->*((FunctionTable::MEMBERPFNGLBEGINCONDITIONALRENDERPROC)this->m_profiledFunctions[377]))(id,mode);this->profiler.end(377,profilingStart);}
+void m_glConvolutionFilter1D_profiling(GLenum target,GLenum internalformat,GLsizei width,GLenum format,GLenum type,const GLvoid* image)const{auto const profilingStart=this->profiler.begin(378);(this->*((FunctionTable::MEMBERPFNGLCONVOLUTIONFILTER1DPROC)this->m_profiledFunctions[378]))(target,internalformat,width,format,type,image);this->profiler.end(378,profilingStart);}
+void m_glMultiTexCoord3fARB_profiling(GLenum target,GLfloat s,GLfloat t,GLfloat r)const{auto const profilingStart=this->profiler.begin(379);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD3FARBPROC)this->m_profiledFunctions[379]))(target,s,t,r);this->profiler.end(379,profilingStart);}
+void m_glGetQueryObjectuivARB_profiling(GLuint id,GLenum pname,GLuint* params)const{auto const profilingStart=this->profiler.begin(380);(this->*((FunctionTable::MEMBERPFNGLGETQUERYOBJECTUIVARBPROC)this->m_profiledFunctions[380]))(id,pname,params);this->profiler.end(380,profilingStart);}
+void m_glScalexOES_profiling(GLfixed x,GLfixed y,GLfixed z)const{auto const profilingStart=this->profiler.begin(381);(this->*((FunctionTable::MEMBERPFNGLSCALEXOESPROC)this->m_profiledFunctions[381]))(x,y,z);this->profiler.end(381,profilingStart);}
+void m_glSamplerParameteri_profiling(GLuint sampler,GLenum pname,GLint param)const{auto const profilingStart=this->profiler.begin(382);(this->*((FunctionTable::MEMBERPFNGLSAMPLERPARAMETERIPROC)this->m_profiledFunctions[382]))(sampler,pname,param);this->profiler.end(382,profilingStart);}
+void m_glSamplerParameterf_profiling(GLuint sampler,GLenum pname,GLfloat param)const{auto const profilingStart=this->profiler.begin(383);(this->*((FunctionTable::MEMBERPFNGLSAMPLERPARAMETERFPROC)this->m_profiledFunctions[383]))(sampler,pname,param);this->profiler.end(383,profilingStart);}
+void m_glShaderOp1EXT_profiling(GLenum op,GLuint res,GLuint arg1)const{auto const profilingStart=this->profiler.begin(384);(this->*((FunctionTable::MEMBERPFNGLSHADEROP1EXTPROC)this->m_profiledFunctions[384]))(op,res,arg1);this->profiler.end(384,profilingStart);}
+void m_glBeginVideoCaptureNV_profiling(GLuint video_capture_slot)const{auto const profilingStart=this->profiler.begin(385);(this->*((FunctionTable::MEMBERPFNGLBEGINVIDEOCAPTURENVPROC)this->m_profiledFunctions[385]))(video_capture_slot);this->profiler.end(385,profilingStart);}
+void m_glGetnHistogram_profiling(GLenum target,GLboolean reset,GLenum format,GLenum type,GLsizei bufSize,void* values)const{auto const profilingStart=this->profiler.begin(386);(this->*((FunctionTable::MEMBERPFNGLGETNHISTOGRAMPROC)this->m_profiledFunctions[386]))(target,reset,format,type,bufSize,values);this->profiler.end(386,profilingStart);}
+void m_glUniform1d_profiling(GLint location,GLdouble x)const{auto const profilingStart=this->profiler.begin(387);(this->*((FunctionTable::MEMBERPFNGLUNIFORM1DPROC)this->m_profiledFunctions[387]))(location,x);this->profiler.end(387,profilingStart);}
+GLint m_glRenderMode_profiling(GLenum mode)const{auto const profilingStart=this->profiler.begin(388);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLRENDERMODEPROC)this->m_profiledFunctions[388]))(mode);this->profiler.end(388,profilingStart);return profilingResult;}
+void m_glClearColorIiEXT_profiling(GLint red,GLint green,GLint blue,GLint alpha)const{auto const profilingStart=this->profiler.begin(389);(this->*((FunctionTable::MEMBERPFNGLCLEARCOLORIIEXTPROC)this->m_profiledFunctions[389]))(red,green,blue,alpha);this->profiler.end(389,profilingStart);}
+void m_glGetCompressedTexImage_profiling(GLenum target,GLint lod,GLvoid* img)const{auto const profilingStart=this->profiler.begin(390);(this->*((FunctionTable::MEMBERPFNGLGETCOMPRESSEDTEXIMAGEPROC)this->m_profiledFunctions[390]))(target,lod,img);this->profiler.end(390,profilingStart);}
+void m_glCompressedTextureImage1DEXT_profiling(GLuint texture,GLenum target,GLint level,GLenum internalformat,GLsizei width,GLint border,GLsizei imageSize,const void* bits)const{auto const profilingStart=this->profiler.begin(391);(this->*((FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTUREIMAGE1DEXTPROC)this->m_profiledFunctions[391]))(texture,target,level,internalformat,width,border,imageSize,bits);this->profiler.end(391,profilingStart);}
+void m_glGetActiveUniformBlockiv_profiling(GLuint program,GLuint uniformBlockIndex,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(392);(this->*((FunctionTable::MEMBERPFNGLGETACTIVEUNIFORMBLOCKIVPROC)this->m_profiledFunctions[392]))(program,uniformBlockIndex,pname,params);this->profiler.end(392,profilingStart);}
+void m_glUniform1i_profiling(GLint location,GLint v0)const{auto const profilingStart=this->profiler.begin(393);(this->*((FunctionTable::MEMBERPFNGLUNIFORM1IPROC)this->m_profiledFunctions[393]))(location,v0);this->profiler.end(393,profilingStart);}
+void m_glGetTexEnvfv_profiling(GLenum target,GLenum pname,GLfloat* params)const{auto const profilingStart=this->profiler.begin(394);(this->*((FunctionTable::MEMBERPFNGLGETTEXENVFVPROC)this->m_profiledFunctions[394]))(target,pname,params);this->profiler.end(394,profilingStart);}
+void m_glColorTableParameterivSGI_profiling(GLenum target,GLenum pname,const GLint* params)const{auto const profilingStart=this->profiler.begin(395);(this->*((FunctionTable::MEMBERPFNGLCOLORTABLEPARAMETERIVSGIPROC)this->m_profiledFunctions[395]))(target,pname,params);this->profiler.end(395,profilingStart);}
+void m_glCullFace_profiling(GLenum mode)const{auto const profilingStart=this->profiler.begin(396);(this->*((FunctionTable::MEMBERPFNGLCULLFACEPROC)this->m_profiledFunctions[396]))(mode);this->profiler.end(396,profilingStart);}
+void m_glDeleteFencesAPPLE_profiling(GLsizei n,const GLuint* fences)const{auto const profilingStart=this->profiler.begin(397);(this->*((FunctionTable::MEMBERPFNGLDELETEFENCESAPPLEPROC)this->m_profiledFunctions[397]))(n,fences);this->profiler.end(397,profilingStart);}
+void m_glProgramUniform4i_profiling(GLuint program,GLint location,GLint v0,GLint v1,GLint v2,GLint v3)const{auto const profilingStart=this->profiler.begin(398);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4IPROC)this->m_profiledFunctions[398]))(program,location,v0,v1,v2,v3);this->profiler.end(398,profilingStart);}
+void m_glUniformHandleui64ARB_profiling(GLint location,GLuint64 value)const{auto const profilingStart=this->profiler.begin(399);(this->*((FunctionTable::MEMBERPFNGLUNIFORMHANDLEUI64ARBPROC)this->m_profiledFunctions[399]))(location,value);this->profiler.end(399,profilingStart);}
+void m_glProgramUniform4f_profiling(GLuint program,GLint location,GLfloat v0,GLfloat v1,GLfloat v2,GLfloat v3)const{auto const profilingStart=this->profiler.begin(400);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4FPROC)this->m_profiledFunctions[400]))(program,location,v0,v1,v2,v3);this->profiler.end(400,profilingStart);}
+void m_glViewportIndexedf_profiling(GLuint index,GLfloat x,GLfloat y,GLfloat w,GLfloat h)const{auto const profilingStart=this->profiler.begin(401);(this->*((FunctionTable::MEMBERPFNGLVIEWPORTINDEXEDFPROC)this->m_profiledFunctions[401]))(index,x,y,w,h);this->profiler.end(401,profilingStart);}
+void m_glProgramUniform4d_profiling(GLuint program,GLint location,GLdouble v0,GLdouble v1,GLdouble v2,GLdouble v3)const{auto const profilingStart=this->profiler.begin(402);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4DPROC)this->m_profiledFunctions[402]))(program,location,v0,v1,v2,v3);this->profiler.end(402,profilingStart);}
+void m_glTexCoord1xOES_profiling(GLfixed s)const{auto const profilingStart=this->profiler.begin(403);(this->*((FunctionTable::MEMBERPFNGLTEXCOORD1XOESPROC)this->m_profiledFunctions[403]))(s);this->profiler.end(403,profilingStart);}
+void m_glVertexStream3ivATI_profiling(GLenum stream,const GLint* coords)const{auto const profilingStart=this->profiler.begin(404);(this->*((FunctionTable::MEMBERPFNGLVERTEXSTREAM3IVATIPROC)this->m_profiledFunctions[404]))(stream,coords);this->profiler.end(404,profilingStart);}
+const GLubyte* m_glGetStringi_profiling(GLenum name,GLuint index)const{auto const profilingStart=this->profiler.begin(405);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLGETSTRINGIPROC)this->m_profiledFunctions[405]))(name,index);this->profiler.end(405,profilingStart);return profilingResult;}
+void m_glEndQueryARB_profiling(GLenum target)const{auto const profilingStart=this->profiler.begin(406);(this->*((FunctionTable::MEMBERPFNGLENDQUERYARBPROC)this->m_profiledFunctions[406]))(target);this->profiler.end(406,profilingStart);}
+void m_glVDPAUMapSurfacesNV_profiling(GLsizei numSurfaces,const GLvdpauSurfaceNV* surfaces)const{auto const profilingStart=this->profiler.begin(407);(this->*((FunctionTable::MEMBERPFNGLVDPAUMAPSURFACESNVPROC)this->m_profiledFunctions[407]))(numSurfaces,surfaces);this->profiler.end(407,profilingStart);}
+void m_glVertex3i_profiling(GLint x,GLint y,GLint z)const{auto const profilingStart=this->profiler.begin(408);(this->*((FunctionTable::MEMBERPFNGLVERTEX3IPROC)this->m_profiledFunctions[408]))(x,y,z);this->profiler.end(408,profilingStart);}
+void m_glVertexAttrib4uivARB_profiling(GLuint index,const GLuint* v)const{auto const profilingStart=this->profiler.begin(409);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB4UIVARBPROC)this->m_profiledFunctions[409]))(index,v);this->profiler.end(409,profilingStart);}
+void m_glResumeTransformFeedbackNV_profiling()const{auto const profilingStart=this->profiler.begin(410);(this->*((FunctionTable::MEMBERPFNGLRESUMETRANSFORMFEEDBACKNVPROC)this->m_profiledFunctions[410]))();this->profiler.end(410,profilingStart);}
+void m_glAttachShader_profiling(GLuint program,GLuint shader)const{auto const profilingStart=this->profiler.begin(411);(this->*((FunctionTable::MEMBERPFNGLATTACHSHADERPROC)this->m_profiledFunctions[411]))(program,shader);this->profiler.end(411,profilingStart);}
+void m_glColor4hNV_profiling(GLhalfNV red,GLhalfNV green,GLhalfNV blue,GLhalfNV alpha)const{auto const profilingStart=this->profiler.begin(412);(this->*((FunctionTable::MEMBERPFNGLCOLOR4HNVPROC)this->m_profiledFunctions[412]))(red,green,blue,alpha);this->profiler.end(412,profilingStart);}
+void m_glGetFenceivNV_profiling(GLuint fence,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(413);(this->*((FunctionTable::MEMBERPFNGLGETFENCEIVNVPROC)this->m_profiledFunctions[413]))(fence,pname,params);this->profiler.end(413,profilingStart);}
+void m_glTexCoord2fColor4ubVertex3fvSUN_profiling(const GLfloat* tc,const GLubyte* c,const GLfloat* v)const{auto const profilingStart=this->profiler.begin(414);(this->*((FunctionTable::MEMBERPFNGLTEXCOORD2FCOLOR4UBVERTEX3FVSUNPROC)this->m_profiledFunctions[414]))(tc,c,v);this->profiler.end(414,profilingStart);}
+void m_glGetColorTable_profiling(GLenum target,GLenum format,GLenum type,GLvoid* table)const{auto const profilingStart=this->profiler.begin(415);(this->*((FunctionTable::MEMBERPFNGLGETCOLORTABLEPROC)this->m_profiledFunctions[415]))(target,format,type,table);this->profiler.end(415,profilingStart);}
+void m_glFogCoordPointer_profiling(GLenum type,GLsizei stride,const void* pointer)const{auto const profilingStart=this->profiler.begin(416);(this->*((FunctionTable::MEMBERPFNGLFOGCOORDPOINTERPROC)this->m_profiledFunctions[416]))(type,stride,pointer);this->profiler.end(416,profilingStart);}
+void m_glTexStorageSparseAMD_profiling(GLenum target,GLenum internalFormat,GLsizei width,GLsizei height,GLsizei depth,GLsizei layers,GLbitfield flags)const{auto const profilingStart=this->profiler.begin(417);(this->*((FunctionTable::MEMBERPFNGLTEXSTORAGESPARSEAMDPROC)this->m_profiledFunctions[417]))(target,internalFormat,width,height,depth,layers,flags);this->profiler.end(417,profilingStart);}
+GLboolean m_glUnmapNamedBuffer_profiling(GLuint buffer)const{auto const profilingStart=this->profiler.begin(418);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLUNMAPNAMEDBUFFERPROC)this->m_profiledFunctions[418]))(buffer);this->profiler.end(418,profilingStart);return profilingResult;}
+void m_glTexCoord4bvOES_profiling(const GLbyte* coords)const{auto const profilingStart=this->profiler.begin(419);(this->*((FunctionTable::MEMBERPFNGLTEXCOORD4BVOESPROC)this->m_profiledFunctions[419]))(coords);this->profiler.end(419,profilingStart);}
+void m_glVertexAttrib3fARB_profiling(GLuint index,GLfloat x,GLfloat y,GLfloat z)const{auto const profilingStart=this->profiler.begin(420);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB3FARBPROC)this->m_profiledFunctions[420]))(index,x,y,z);this->profiler.end(420,profilingStart);}
+void m_glRasterPos2xOES_profiling(GLfixed x,GLfixed y)const{auto const profilingStart=this->profiler.begin(421);(this->*((FunctionTable::MEMBERPFNGLRASTERPOS2XOESPROC)this->m_profiledFunctions[421]))(x,y);this->profiler.end(421,profilingStart);}
+void m_glColor4ubVertex2fvSUN_profiling(const GLubyte* c,const GLfloat* v)const{auto const profilingStart=this->profiler.begin(422);(this->*((FunctionTable::MEMBERPFNGLCOLOR4UBVERTEX2FVSUNPROC)this->m_profiledFunctions[422]))(c,v);this->profiler.end(422,profilingStart);}
+void m_glSecondaryColor3dv_profiling(const GLdouble* v)const{auto const profilingStart=this->profiler.begin(423);(this->*((FunctionTable::MEMBERPFNGLSECONDARYCOLOR3DVPROC)this->m_profiledFunctions[423]))(v);this->profiler.end(423,profilingStart);}
+void m_glVertexAttribI4sv_profiling(GLuint index,const GLshort* v)const{auto const profilingStart=this->profiler.begin(424);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBI4SVPROC)this->m_profiledFunctions[424]))(index,v);this->profiler.end(424,profilingStart);}
+void m_glDrawTransformFeedbackStreamInstanced_profiling(GLenum mode,GLuint id,GLuint stream,GLsizei instancecount)const{auto const profilingStart=this->profiler.begin(425);(this->*((FunctionTable::MEMBERPFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC)this->m_profiledFunctions[425]))(mode,id,stream,instancecount);this->profiler.end(425,profilingStart);}
+void m_glMultiTexCoord4ivARB_profiling(GLenum target,const GLint* v)const{auto const profilingStart=this->profiler.begin(426);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD4IVARBPROC)this->m_profiledFunctions[426]))(target,v);this->profiler.end(426,profilingStart);}
+void m_glSpriteParameterfSGIX_profiling(GLenum pname,GLfloat param)const{auto const profilingStart=this->profiler.begin(427);(this->*((FunctionTable::MEMBERPFNGLSPRITEPARAMETERFSGIXPROC)this->m_profiledFunctions[427]))(pname,param);this->profiler.end(427,profilingStart);}
+void m_glSecondaryColor3sv_profiling(const GLshort* v)const{auto const profilingStart=this->profiler.begin(428);(this->*((FunctionTable::MEMBERPFNGLSECONDARYCOLOR3SVPROC)this->m_profiledFunctions[428]))(v);this->profiler.end(428,profilingStart);}
+void m_glBindVideoCaptureStreamTextureNV_profiling(GLuint video_capture_slot,GLuint stream,GLenum frame_region,GLenum target,GLuint texture)const{auto const profilingStart=this->profiler.begin(429);(this->*((FunctionTable::MEMBERPFNGLBINDVIDEOCAPTURESTREAMTEXTURENVPROC)this->m_profiledFunctions[429]))(video_capture_slot,stream,frame_region,target,texture);this->profiler.end(429,profilingStart);}
+void m_glTexParameterIuiv_profiling(GLenum target,GLenum pname,const GLuint* params)const{auto const profilingStart=this->profiler.begin(430);(this->*((FunctionTable::MEMBERPFNGLTEXPARAMETERIUIVPROC)this->m_profiledFunctions[430]))(target,pname,params);this->profiler.end(430,profilingStart);}
+void m_glFlushPixelDataRangeNV_profiling(GLenum target)const{auto const profilingStart=this->profiler.begin(431);(this->*((FunctionTable::MEMBERPFNGLFLUSHPIXELDATARANGENVPROC)this->m_profiledFunctions[431]))(target);this->profiler.end(431,profilingStart);}
+void m_glWindowPos3fv_profiling(const GLfloat* v)const{auto const profilingStart=this->profiler.begin(432);(this->*((FunctionTable::MEMBERPFNGLWINDOWPOS3FVPROC)this->m_profiledFunctions[432]))(v);this->profiler.end(432,profilingStart);}
+void m_glVertexAttribLFormatNV_profiling(GLuint index,GLint size,GLenum type,GLsizei stride)const{auto const profilingStart=this->profiler.begin(433);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBLFORMATNVPROC)this->m_profiledFunctions[433]))(index,size,type,stride);this->profiler.end(433,profilingStart);}
+void m_glLightModelfv_profiling(GLenum pname,const GLfloat* params)const{auto const profilingStart=this->profiler.begin(434);(this->*((FunctionTable::MEMBERPFNGLLIGHTMODELFVPROC)this->m_profiledFunctions[434]))(pname,params);this->profiler.end(434,profilingStart);}
+void m_glGetColorTableSGI_profiling(GLenum target,GLenum format,GLenum type,void* table)const{auto const profilingStart=this->profiler.begin(435);(this->*((FunctionTable::MEMBERPFNGLGETCOLORTABLESGIPROC)this->m_profiledFunctions[435]))(target,format,type,table);this->profiler.end(435,profilingStart);}
+void m_glGetCompressedTexImageARB_profiling(GLenum target,GLint level,void* img)const{auto const profilingStart=this->profiler.begin(436);(this->*((FunctionTable::MEMBERPFNGLGETCOMPRESSEDTEXIMAGEARBPROC)this->m_profiledFunctions[436]))(target,level,img);this->profiler.end(436,profilingStart);}
+void m_glConvolutionParameteri_profiling(GLenum target,GLenum pname,GLint params)const{auto const profilingStart=this->profiler.begin(437);(this->*((FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERIPROC)this->m_profiledFunctions[437]))(target,pname,params);this->profiler.end(437,profilingStart);}
+void m_glVertexWeighthNV_profiling(GLhalfNV weight)const{auto const profilingStart=this->profiler.begin(438);(this->*((FunctionTable::MEMBERPFNGLVERTEXWEIGHTHNVPROC)this->m_profiledFunctions[438]))(weight);this->profiler.end(438,profilingStart);}
+void m_glColorMaskIndexedEXT_profiling(GLuint index,GLboolean r,GLboolean g,GLboolean b,GLboolean a)const{auto const profilingStart=this->profiler.begin(439);(this->*((FunctionTable::MEMBERPFNGLCOLORMASKINDEXEDEXTPROC)this->m_profiledFunctions[439]))(index,r,g,b,a);this->profiler.end(439,profilingStart);}
+void m_glColorMaski_profiling(GLuint index,GLboolean r,GLboolean g,GLboolean b,GLboolean a)const{auto const profilingStart=this->profiler.begin(440);(this->*((FunctionTable::MEMBERPFNGLCOLORMASKIPROC)this->m_profiledFunctions[440]))(index,r,g,b,a);this->profiler.end(440,profilingStart);}
+void m_glColorFragmentOp1ATI_profiling(GLenum op,GLuint dst,GLuint dstMask,GLuint dstMod,GLuint arg1,GLuint arg1Rep,GLuint arg1Mod)const{auto const profilingStart=this->profiler.begin(441);(this->*((FunctionTable::MEMBERPFNGLCOLORFRAGMENTOP1ATIPROC)this->m_profiledFunctions[441]))(op,dst,dstMask,dstMod,arg1,arg1Rep,arg1Mod);this->profiler.end(441,profilingStart);}
+void m_glVertexAttribI4ubvEXT_profiling(GLuint index,const GLubyte* v)const{auto const profilingStart=this->profiler.begin(442);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBI4UBVEXTPROC)this->m_profiledFunctions[442]))(index,v);this->profiler.end(442,profilingStart);}
+void m_glVertexAttrib1dNV_profiling(GLuint index,GLdouble x)const{auto const profilingStart=this->profiler.begin(443);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB1DNVPROC)this->m_profiledFunctions[443]))(index,x);this->profiler.end(443,profilingStart);}
+void m_glUnmapObjectBufferATI_profiling(GLuint buffer)const{auto const profilingStart=this->profiler.begin(444);(this->*((FunctionTable::MEMBERPFNGLUNMAPOBJECTBUFFERATIPROC)this->m_profiledFunctions[444]))(buffer);this->profiler.end(444,profilingStart);}
+void m_glNamedProgramLocalParameterI4uiEXT_profiling(GLuint program,GLenum target,GLuint index,GLuint x,GLuint y,GLuint z,GLuint w)const{auto const profilingStart=this->profiler.begin(445);(this->*((FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERI4UIEXTPROC)this->m_profiledFunctions[445]))(program,target,index,x,y,z,w);this->profiler.end(445,profilingStart);}
+void m_glProgramUniform1iEXT_profiling(GLuint program,GLint location,GLint v0)const{auto const profilingStart=this->profiler.begin(446);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1IEXTPROC)this->m_profiledFunctions[446]))(program,location,v0);this->profiler.end(446,profilingStart);}
+void m_glDeleteQueriesARB_profiling(GLsizei n,const GLuint* ids)const{auto const profilingStart=this->profiler.begin(447);(this->*((FunctionTable::MEMBERPFNGLDELETEQUERIESARBPROC)this->m_profiledFunctions[447]))(n,ids);this->profiler.end(447,profilingStart);}
+void m_glWindowPos3svARB_profiling(const GLshort* v)const{auto const profilingStart=this->profiler.begin(448);(this->*((FunctionTable::MEMBERPFNGLWINDOWPOS3SVARBPROC)this->m_profiledFunctions[448]))(v);this->profiler.end(448,profilingStart);}
+void m_glVertex4s_profiling(GLshort x,GLshort y,GLshort z,GLshort w)const{auto const profilingStart=this->profiler.begin(449);(this->*((FunctionTable::MEMBERPFNGLVERTEX4SPROC)this->m_profiledFunctions[449]))(x,y,z,w);this->profiler.end(449,profilingStart);}
+void m_glStringMarkerGREMEDY_profiling(GLsizei len,const void* string)const{auto const profilingStart=this->profiler.begin(450);(this->*((FunctionTable::MEMBERPFNGLSTRINGMARKERGREMEDYPROC)this->m_profiledFunctions[450]))(len,string);this->profiler.end(450,profilingStart);}
+GLboolean m_glIsTransformFeedback_profiling(GLuint id)const{auto const profilingStart=this->profiler.begin(451);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLISTRANSFORMFEEDBACKPROC)this->m_profiledFunctions[451]))(id);this->profiler.end(451,profilingStart);return profilingResult;}
+void m_glProgramUniformMatrix2x3dvEXT_profiling(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{auto const profilingStart=this->profiler.begin(452);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X3DVEXTPROC)this->m_profiledFunctions[452]))(program,location,count,transpose,value);this->profiler.end(452,profilingStart);}
+void m_glGetObjectLabelEXT_profiling(GLenum type,GLuint object,GLsizei bufSize,GLsizei* length,GLchar* label)const{auto const profilingStart=this->profiler.begin(453);(this->*((FunctionTable::MEMBERPFNGLGETOBJECTLABELEXTPROC)this->m_profiledFunctions[453]))(type,object,bufSize,length,label);this->profiler.end(453,profilingStart);}
+void m_glUniformHandleui64vNV_profiling(GLint location,GLsizei count,const GLuint64* value)const{auto const profilingStart=this->profiler.begin(454);(this->*((FunctionTable::MEMBERPFNGLUNIFORMHANDLEUI64VNVPROC)this->m_profiledFunctions[454]))(location,count,value);this->profiler.end(454,profilingStart);}
+void m_glRotated_profiling(GLdouble angle,GLdouble x,GLdouble y,GLdouble z)const{auto const profilingStart=this->profiler.begin(455);(this->*((FunctionTable::MEMBERPFNGLROTATEDPROC)this->m_profiledFunctions[455]))(angle,x,y,z);this->profiler.end(455,profilingStart);}
+GLboolean m_glIsProgramPipeline_profiling(GLuint pipeline)const{auto const profilingStart=this->profiler.begin(456);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLISPROGRAMPIPELINEPROC)this->m_profiledFunctions[456]))(pipeline);this->profiler.end(456,profilingStart);return profilingResult;}
+void m_glRotatef_profiling(GLfloat angle,GLfloat x,GLfloat y,GLfloat z)const{auto const profilingStart=this->profiler.begin(457);(this->*((FunctionTable::MEMBERPFNGLROTATEFPROC)this->m_profiledFunctions[457]))(angle,x,y,z);this->profiler.end(457,profilingStart);}
+void m_glVertex4i_profiling(GLint x,GLint y,GLint z,GLint w)const{auto const profilingStart=this->profiler.begin(458);(this->*((FunctionTable::MEMBERPFNGLVERTEX4IPROC)this->m_profiledFunctions[458]))(x,y,z,w);this->profiler.end(458,profilingStart);}
+void m_glGetActiveSubroutineUniformName_profiling(GLuint program,GLenum shadertype,GLuint index,GLsizei bufsize,GLsizei* length,GLchar* name)const{auto const profilingStart=this->profiler.begin(459);(this->*((FunctionTable::MEMBERPFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC)this->m_profiledFunctions[459]))(program,shadertype,index,bufsize,length,name);this->profiler.end(459,profilingStart);}
+void m_glVertexAttrib4sNV_profiling(GLuint index,GLshort x,GLshort y,GLshort z,GLshort w)const{auto const profilingStart=this->profiler.begin(460);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB4SNVPROC)this->m_profiledFunctions[460]))(index,x,y,z,w);this->profiler.end(460,profilingStart);}
+void m_glProgramLocalParameter4dvARB_profiling(GLenum target,GLuint index,const GLdouble* params)const{auto const profilingStart=this->profiler.begin(461);(this->*((FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETER4DVARBPROC)this->m_profiledFunctions[461]))(target,index,params);this->profiler.end(461,profilingStart);}
+void m_glReplacementCodeubSUN_profiling(GLubyte code)const{auto const profilingStart=this->profiler.begin(462);(this->*((FunctionTable::MEMBERPFNGLREPLACEMENTCODEUBSUNPROC)this->m_profiledFunctions[462]))(code);this->profiler.end(462,profilingStart);}
+void m_glMultiDrawElementsIndirectBindlessNV_profiling(GLenum mode,GLenum type,const void* indirect,GLsizei drawCount,GLsizei stride,GLint vertexBufferCount)const{auto const profilingStart=this->profiler.begin(463);(this->*((FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSINDIRECTBINDLESSNVPROC)this->m_profiledFunctions[463]))(mode,type,indirect,drawCount,stride,vertexBufferCount);this->profiler.end(463,profilingStart);}
+void m_glUniformMatrix3fv_profiling(GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{auto const profilingStart=this->profiler.begin(464);(this->*((FunctionTable::MEMBERPFNGLUNIFORMMATRIX3FVPROC)this->m_profiledFunctions[464]))(location,count,transpose,value);this->profiler.end(464,profilingStart);}
+void m_glGetnMapfvARB_profiling(GLenum target,GLenum query,GLsizei bufSize,GLfloat* v)const{auto const profilingStart=this->profiler.begin(465);(this->*((FunctionTable::MEMBERPFNGLGETNMAPFVARBPROC)this->m_profiledFunctions[465]))(target,query,bufSize,v);this->profiler.end(465,profilingStart);}
+void m_glGetnUniformfv_profiling(GLuint program,GLint location,GLsizei bufSize,GLfloat* params)const{auto const profilingStart=this->profiler.begin(466);(this->*((FunctionTable::MEMBERPFNGLGETNUNIFORMFVPROC)this->m_profiledFunctions[466]))(program,location,bufSize,params);this->profiler.end(466,profilingStart);}
+void m_glVertexAttribL2dv_profiling(GLuint index,const GLdouble* v)const{auto const profilingStart=this->profiler.begin(467);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBL2DVPROC)this->m_profiledFunctions[467]))(index,v);this->profiler.end(467,profilingStart);}
+void m_glVertexWeightPointerEXT_profiling(GLint size,GLenum type,GLsizei stride,const void* pointer)const{auto const profilingStart=this->profiler.begin(468);(this->*((FunctionTable::MEMBERPFNGLVERTEXWEIGHTPOINTEREXTPROC)this->m_profiledFunctions[468]))(size,type,stride,pointer);this->profiler.end(468,profilingStart);}
+void m_glTangent3sEXT_profiling(GLshort tx,GLshort ty,GLshort tz)const{auto const profilingStart=this->profiler.begin(469);(this->*((FunctionTable::MEMBERPFNGLTANGENT3SEXTPROC)this->m_profiledFunctions[469]))(tx,ty,tz);this->profiler.end(469,profilingStart);}
+void m_glSecondaryColorPointer_profiling(GLint size,GLenum type,GLsizei stride,const void* pointer)const{auto const profilingStart=this->profiler.begin(470);(this->*((FunctionTable::MEMBERPFNGLSECONDARYCOLORPOINTERPROC)this->m_profiledFunctions[470]))(size,type,stride,pointer);this->profiler.end(470,profilingStart);}
+void m_glAlphaFunc_profiling(GLenum func,GLclampf ref)const{auto const profilingStart=this->profiler.begin(471);(this->*((FunctionTable::MEMBERPFNGLALPHAFUNCPROC)this->m_profiledFunctions[471]))(func,ref);this->profiler.end(471,profilingStart);}
+void m_glGetNamedStringARB_profiling(GLint namelen,const GLchar* name,GLsizei bufSize,GLint* stringlen,GLchar* string)const{auto const profilingStart=this->profiler.begin(472);(this->*((FunctionTable::MEMBERPFNGLGETNAMEDSTRINGARBPROC)this->m_profiledFunctions[472]))(namelen,name,bufSize,stringlen,string);this->profiler.end(472,profilingStart);}
+void m_glTexCoord4d_profiling(GLdouble s,GLdouble t,GLdouble r,GLdouble q)const{auto const profilingStart=this->profiler.begin(473);(this->*((FunctionTable::MEMBERPFNGLTEXCOORD4DPROC)this->m_profiledFunctions[473]))(s,t,r,q);this->profiler.end(473,profilingStart);}
+void m_glBufferPageCommitmentARB_profiling(GLenum target,GLintptr offset,GLsizeiptr size,GLboolean commit)const{auto const profilingStart=this->profiler.begin(474);(this->*((FunctionTable::MEMBERPFNGLBUFFERPAGECOMMITMENTARBPROC)this->m_profiledFunctions[474]))(target,offset,size,commit);this->profiler.end(474,profilingStart);}
+void m_glProgramLocalParameters4fvEXT_profiling(GLenum target,GLuint index,GLsizei count,const GLfloat* params)const{auto const profilingStart=this->profiler.begin(475);(this->*((FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERS4FVEXTPROC)this->m_profiledFunctions[475]))(target,index,count,params);this->profiler.end(475,profilingStart);}
+void m_glStencilFunc_profiling(GLenum func,GLint ref,GLuint mask)const{auto const profilingStart=this->profiler.begin(476);(this->*((FunctionTable::MEMBERPFNGLSTENCILFUNCPROC)this->m_profiledFunctions[476]))(func,ref,mask);this->profiler.end(476,profilingStart);}
+void m_glGetVertexAttribdvNV_profiling(GLuint index,GLenum pname,GLdouble* params)const{auto const profilingStart=this->profiler.begin(477);(this->*((FunctionTable::MEMBERPFNGLGETVERTEXATTRIBDVNVPROC)this->m_profiledFunctions[477]))(index,pname,params);this->profiler.end(477,profilingStart);}
+void m_glTexCoord3dv_profiling(const GLdouble* v)const{auto const profilingStart=this->profiler.begin(478);(this->*((FunctionTable::MEMBERPFNGLTEXCOORD3DVPROC)this->m_profiledFunctions[478]))(v);this->profiler.end(478,profilingStart);}
+void m_glGetQueryBufferObjectiv_profiling(GLuint id,GLuint buffer,GLenum pname,GLintptr offset)const{auto const profilingStart=this->profiler.begin(479);(this->*((FunctionTable::MEMBERPFNGLGETQUERYBUFFEROBJECTIVPROC)this->m_profiledFunctions[479]))(id,buffer,pname,offset);this->profiler.end(479,profilingStart);}
+void m_glTexGenxOES_profiling(GLenum coord,GLenum pname,GLfixed param)const{auto const profilingStart=this->profiler.begin(480);(this->*((FunctionTable::MEMBERPFNGLTEXGENXOESPROC)this->m_profiledFunctions[480]))(coord,pname,param);this->profiler.end(480,profilingStart);}
+void m_glMultiTexCoord1fvARB_profiling(GLenum target,const GLfloat* v)const{auto const profilingStart=this->profiler.begin(481);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD1FVARBPROC)this->m_profiledFunctions[481]))(target,v);this->profiler.end(481,profilingStart);}
+void m_glLightEnviSGIX_profiling(GLenum pname,GLint param)const{auto const profilingStart=this->profiler.begin(482);(this->*((FunctionTable::MEMBERPFNGLLIGHTENVISGIXPROC)this->m_profiledFunctions[482]))(pname,param);this->profiler.end(482,profilingStart);}
+void m_glGetProgramPipelineiv_profiling(GLuint pipeline,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(483);(this->*((FunctionTable::MEMBERPFNGLGETPROGRAMPIPELINEIVPROC)this->m_profiledFunctions[483]))(pipeline,pname,params);this->profiler.end(483,profilingStart);}
+void m_glVertexStream2ivATI_profiling(GLenum stream,const GLint* coords)const{auto const profilingStart=this->profiler.begin(484);(this->*((FunctionTable::MEMBERPFNGLVERTEXSTREAM2IVATIPROC)this->m_profiledFunctions[484]))(stream,coords);this->profiler.end(484,profilingStart);}
+void m_glGetColorTableEXT_profiling(GLenum target,GLenum format,GLenum type,void* data)const{auto const profilingStart=this->profiler.begin(485);(this->*((FunctionTable::MEMBERPFNGLGETCOLORTABLEEXTPROC)this->m_profiledFunctions[485]))(target,format,type,data);this->profiler.end(485,profilingStart);}
+void m_glGetShaderInfoLog_profiling(GLuint shader,GLsizei bufSize,GLsizei* length,GLchar* infoLog)const{auto const profilingStart=this->profiler.begin(486);(this->*((FunctionTable::MEMBERPFNGLGETSHADERINFOLOGPROC)this->m_profiledFunctions[486]))(shader,bufSize,length,infoLog);this->profiler.end(486,profilingStart);}
+void m_glGetOcclusionQueryuivNV_profiling(GLuint id,GLenum pname,GLuint* params)const{auto const profilingStart=this->profiler.begin(487);(this->*((FunctionTable::MEMBERPFNGLGETOCCLUSIONQUERYUIVNVPROC)this->m_profiledFunctions[487]))(id,pname,params);this->profiler.end(487,profilingStart);}
+void m_glInvalidateNamedFramebufferSubData_profiling(GLuint framebuffer,GLsizei numAttachments,const GLenum* attachments,GLint x,GLint y,GLsizei width,GLsizei height)const{auto const profilingStart=this->profiler.begin(488);(this->*((FunctionTable::MEMBERPFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC)this->m_profiledFunctions[488]))(framebuffer,numAttachments,attachments,x,y,width,height);this->profiler.end(488,profilingStart);}
+void m_glVertexAttribL1i64NV_profiling(GLuint index,GLint64EXT x)const{auto const profilingStart=this->profiler.begin(489);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBL1I64NVPROC)this->m_profiledFunctions[489]))(index,x);this->profiler.end(489,profilingStart);}
+void m_glVDPAUInitNV_profiling(const void* vdpDevice,const void* getProcAddress)const{auto const profilingStart=this->profiler.begin(490);(this->*((FunctionTable::MEMBERPFNGLVDPAUINITNVPROC)this->m_profiledFunctions[490]))(vdpDevice,getProcAddress);this->profiler.end(490,profilingStart);}
+void m_glVertexAttrib1hvNV_profiling(GLuint index,const GLhalfNV* v)const{auto const profilingStart=this->profiler.begin(491);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB1HVNVPROC)this->m_profiledFunctions[491]))(index,v);this->profiler.end(491,profilingStart);}
+void m_glVertexAttribI4i_profiling(GLuint index,GLint x,GLint y,GLint z,GLint w)const{auto const profilingStart=this->profiler.begin(492);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBI4IPROC)this->m_profiledFunctions[492]))(index,x,y,z,w);this->profiler.end(492,profilingStart);}
+void m_glRasterPos2iv_profiling(const GLint* v)const{auto const profilingStart=this->profiler.begin(493);(this->*((FunctionTable::MEMBERPFNGLRASTERPOS2IVPROC)this->m_profiledFunctions[493]))(v);this->profiler.end(493,profilingStart);}
+void m_glGetIntegerui64i_vNV_profiling(GLenum value,GLuint index,GLuint64EXT* result)const{auto const profilingStart=this->profiler.begin(494);(this->*((FunctionTable::MEMBERPFNGLGETINTEGERUI64I_VNVPROC)this->m_profiledFunctions[494]))(value,index,result);this->profiler.end(494,profilingStart);}
+void m_glUniformHandleui64NV_profiling(GLint location,GLuint64 value)const{auto const profilingStart=this->profiler.begin(495);(this->*((FunctionTable::MEMBERPFNGLUNIFORMHANDLEUI64NVPROC)this->m_profiledFunctions[495]))(location,value);this->profiler.end(495,profilingStart);}
+void m_glWindowPos3ivMESA_profiling(const GLint* v)const{auto const profilingStart=this->profiler.begin(496);(this->*((FunctionTable::MEMBERPFNGLWINDOWPOS3IVMESAPROC)this->m_profiledFunctions[496]))(v);this->profiler.end(496,profilingStart);}
+void m_glBlendEquationSeparate_profiling(GLenum modeRGB,GLenum modeAlpha)const{auto const profilingStart=this->profiler.begin(497);(this->*((FunctionTable::MEMBERPFNGLBLENDEQUATIONSEPARATEPROC)this->m_profiledFunctions[497]))(modeRGB,modeAlpha);this->profiler.end(497,profilingStart);}
+void m_glDrawElementsInstancedARB_profiling(GLenum mode,GLsizei count,GLenum type,const void* indices,GLsizei primcount)const{auto const profilingStart=this->profiler.begin(498);(this->*((FunctionTable::MEMBERPFNGLDRAWELEMENTSINSTANCEDARBPROC)this->m_profiledFunctions[498]))(mode,count,type,indices,primcount);this->profiler.end(498,profilingStart);}
+GLuint m_glGetSubroutineIndex_profiling(GLuint program,GLenum shadertype,const GLchar* name)const{auto const profilingStart=this->profiler.begin(499);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLGETSUBROUTINEINDEXPROC)this->m_profiledFunctions[499]))(program,shadertype,name);this->profiler.end(499,profilingStart);return profilingResult;}
+void m_glVertexAttrib2sv_profiling(GLuint index,const GLshort* v)const{auto const profilingStart=this->profiler.begin(500);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB2SVPROC)this->m_profiledFunctions[500]))(index,v);this->profiler.end(500,profilingStart);}
+void m_glSamplePatternSGIS_profiling(GLenum pattern)const{auto const profilingStart=this->profiler.begin(501);(this->*((FunctionTable::MEMBERPFNGLSAMPLEPATTERNSGISPROC)this->m_profiledFunctions[501]))(pattern);this->profiler.end(501,profilingStart);}
+void m_glEGLImageTargetRenderbufferStorageOES_profiling(GLenum target,GLeglImageOES image)const{auto const profilingStart=this->profiler.begin(502);(this->*((FunctionTable::MEMBERPFNGLEGLIMAGETARGETRENDERBUFFERSTORAGEOESPROC)this->m_profiledFunctions[502]))(target,image);this->profiler.end(502,profilingStart);}
+void m_glPushAttrib_profiling(GLbitfield mask)const{auto const profilingStart=this->profiler.begin(503);(this->*((FunctionTable::MEMBERPFNGLPUSHATTRIBPROC)this->m_profiledFunctions[503]))(mask);this->profiler.end(503,profilingStart);}
+void m_glVertex3hNV_profiling(GLhalfNV x,GLhalfNV y,GLhalfNV z)const{auto const profilingStart=this->profiler.begin(504);(this->*((FunctionTable::MEMBERPFNGLVERTEX3HNVPROC)this->m_profiledFunctions[504]))(x,y,z);this->profiler.end(504,profilingStart);}
+void m_glRasterPos3xvOES_profiling(const GLfixed* coords)const{auto const profilingStart=this->profiler.begin(505);(this->*((FunctionTable::MEMBERPFNGLRASTERPOS3XVOESPROC)this->m_profiledFunctions[505]))(coords);this->profiler.end(505,profilingStart);}
+void m_glPathParameterfNV_profiling(GLuint path,GLenum pname,GLfloat value)const{auto const profilingStart=this->profiler.begin(506);(this->*((FunctionTable::MEMBERPFNGLPATHPARAMETERFNVPROC)this->m_profiledFunctions[506]))(path,pname,value);this->profiler.end(506,profilingStart);}
+void m_glGetUniformi64vNV_profiling(GLuint program,GLint location,GLint64EXT* params)const{auto const profilingStart=this->profiler.begin(507);(this->*((FunctionTable::MEMBERPFNGLGETUNIFORMI64VNVPROC)this->m_profiledFunctions[507]))(program,location,params);this->profiler.end(507,profilingStart);}
+void m_glLightiv_profiling(GLenum light,GLenum pname,const GLint* params)const{auto const profilingStart=this->profiler.begin(508);(this->*((FunctionTable::MEMBERPFNGLLIGHTIVPROC)this->m_profiledFunctions[508]))(light,pname,params);this->profiler.end(508,profilingStart);}
+void m_glMaterialxvOES_profiling(GLenum face,GLenum pname,const GLfixed* param)const{auto const profilingStart=this->profiler.begin(509);(this->*((FunctionTable::MEMBERPFNGLMATERIALXVOESPROC)this->m_profiledFunctions[509]))(face,pname,param);this->profiler.end(509,profilingStart);}
+void m_glNamedProgramLocalParameter4fEXT_profiling(GLuint program,GLenum target,GLuint index,GLfloat x,GLfloat y,GLfloat z,GLfloat w)const{auto const profilingStart=this->profiler.begin(510);(this->*((FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETER4FEXTPROC)this->m_profiledFunctions[510]))(program,target,index,x,y,z,w);this->profiler.end(510,profilingStart);}
+void m_glVertexAttribL1dEXT_profiling(GLuint index,GLdouble x)const{auto const profilingStart=this->profiler.begin(511);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBL1DEXTPROC)this->m_profiledFunctions[511]))(index,x);this->profiler.end(511,profilingStart);}
+void m_glGetnUniformdvARB_profiling(GLuint program,GLint location,GLsizei bufSize,GLdouble* params)const{auto const profilingStart=this->profiler.begin(512);(this->*((FunctionTable::MEMBERPFNGLGETNUNIFORMDVARBPROC)this->m_profiledFunctions[512]))(program,location,bufSize,params);this->profiler.end(512,profilingStart);}
+void m_glSecondaryColor3bEXT_profiling(GLbyte red,GLbyte green,GLbyte blue)const{auto const profilingStart=this->profiler.begin(513);(this->*((FunctionTable::MEMBERPFNGLSECONDARYCOLOR3BEXTPROC)this->m_profiledFunctions[513]))(red,green,blue);this->profiler.end(513,profilingStart);}
+void m_glBeginPerfQueryINTEL_profiling(GLuint queryHandle)const{auto const profilingStart=this->profiler.begin(514);(this->*((FunctionTable::MEMBERPFNGLBEGINPERFQUERYINTELPROC)this->m_profiledFunctions[514]))(queryHandle);this->profiler.end(514,profilingStart);}
+void m_glProgramUniform1uivEXT_profiling(GLuint program,GLint location,GLsizei count,const GLuint* value)const{auto const profilingStart=this->profiler.begin(515);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UIVEXTPROC)this->m_profiledFunctions[515]))(program,location,count,value);this->profiler.end(515,profilingStart);}
+void m_glImageTransformParameterivHP_profiling(GLenum target,GLenum pname,const GLint* params)const{auto const profilingStart=this->profiler.begin(516);(this->*((FunctionTable::MEMBERPFNGLIMAGETRANSFORMPARAMETERIVHPPROC)this->m_profiledFunctions[516]))(target,pname,params);this->profiler.end(516,profilingStart);}
+void m_glDeleteBuffers_profiling(GLsizei n,const GLuint* buffers)const{auto const profilingStart=this->profiler.begin(517);(this->*((FunctionTable::MEMBERPFNGLDELETEBUFFERSPROC)this->m_profiledFunctions[517]))(n,buffers);this->profiler.end(517,profilingStart);}
+void m_glBindProgramPipeline_profiling(GLuint pipeline)const{auto const profilingStart=this->profiler.begin(518);(this->*((FunctionTable::MEMBERPFNGLBINDPROGRAMPIPELINEPROC)this->m_profiledFunctions[518]))(pipeline);this->profiler.end(518,profilingStart);}
+void m_glScissor_profiling(GLint x,GLint y,GLsizei width,GLsizei height)const{auto const profilingStart=this->profiler.begin(519);(this->*((FunctionTable::MEMBERPFNGLSCISSORPROC)this->m_profiledFunctions[519]))(x,y,width,height);this->profiler.end(519,profilingStart);}
+void m_glProgramUniform4fv_profiling(GLuint program,GLint location,GLsizei count,const GLfloat* value)const{auto const profilingStart=this->profiler.begin(520);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4FVPROC)this->m_profiledFunctions[520]))(program,location,count,value);this->profiler.end(520,profilingStart);}
+void m_glGetBooleanv_profiling(GLenum pname,GLboolean* params)const{auto const profilingStart=this->profiler.begin(521);(this->*((FunctionTable::MEMBERPFNGLGETBOOLEANVPROC)this->m_profiledFunctions[521]))(pname,params);this->profiler.end(521,profilingStart);}
+void m_glMaterialfv_profiling(GLenum face,GLenum pname,const GLfloat* params)const{auto const profilingStart=this->profiler.begin(522);(this->*((FunctionTable::MEMBERPFNGLMATERIALFVPROC)this->m_profiledFunctions[522]))(face,pname,params);this->profiler.end(522,profilingStart);}
+void m_glWindowPos4fvMESA_profiling(const GLfloat* v)const{auto const profilingStart=this->profiler.begin(523);(this->*((FunctionTable::MEMBERPFNGLWINDOWPOS4FVMESAPROC)this->m_profiledFunctions[523]))(v);this->profiler.end(523,profilingStart);}
+void m_glVertexAttribIPointerEXT_profiling(GLuint index,GLint size,GLenum type,GLsizei stride,const void* pointer)const{auto const profilingStart=this->profiler.begin(524);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBIPOINTEREXTPROC)this->m_profiledFunctions[524]))(index,size,type,stride,pointer);this->profiler.end(524,profilingStart);}
+void m_glProgramBufferParametersfvNV_profiling(GLenum target,GLuint bindingIndex,GLuint wordIndex,GLsizei count,const GLfloat* params)const{auto const profilingStart=this->profiler.begin(525);(this->*((FunctionTable::MEMBERPFNGLPROGRAMBUFFERPARAMETERSFVNVPROC)this->m_profiledFunctions[525]))(target,bindingIndex,wordIndex,count,params);this->profiler.end(525,profilingStart);}
+void m_glAlphaFuncxOES_profiling(GLenum func,GLfixed ref)const{auto const profilingStart=this->profiler.begin(526);(this->*((FunctionTable::MEMBERPFNGLALPHAFUNCXOESPROC)this->m_profiledFunctions[526]))(func,ref);this->profiler.end(526,profilingStart);}
+void m_glMultiDrawArraysIndirectAMD_profiling(GLenum mode,const void* indirect,GLsizei primcount,GLsizei stride)const{auto const profilingStart=this->profiler.begin(527);(this->*((FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSINDIRECTAMDPROC)this->m_profiledFunctions[527]))(mode,indirect,primcount,stride);this->profiler.end(527,profilingStart);}
+void m_glNormalStream3ivATI_profiling(GLenum stream,const GLint* coords)const{auto const profilingStart=this->profiler.begin(528);(this->*((FunctionTable::MEMBERPFNGLNORMALSTREAM3IVATIPROC)this->m_profiledFunctions[528]))(stream,coords);this->profiler.end(528,profilingStart);}
+void m_glTextureImage3DMultisampleNV_profiling(GLuint texture,GLenum target,GLsizei samples,GLint internalFormat,GLsizei width,GLsizei height,GLsizei depth,GLboolean fixedSampleLocations)const{auto const profilingStart=this->profiler.begin(529);(this->*((FunctionTable::MEMBERPFNGLTEXTUREIMAGE3DMULTISAMPLENVPROC)this->m_profiledFunctions[529]))(texture,target,samples,internalFormat,width,height,depth,fixedSampleLocations);this->profiler.end(529,profilingStart);}
+void m_glProgramUniform4uivEXT_profiling(GLuint program,GLint location,GLsizei count,const GLuint* value)const{auto const profilingStart=this->profiler.begin(530);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UIVEXTPROC)this->m_profiledFunctions[530]))(program,location,count,value);this->profiler.end(530,profilingStart);}
+void m_glReplacementCodeusvSUN_profiling(const GLushort* code)const{auto const profilingStart=this->profiler.begin(531);(this->*((FunctionTable::MEMBERPFNGLREPLACEMENTCODEUSVSUNPROC)this->m_profiledFunctions[531]))(code);this->profiler.end(531,profilingStart);}
+GLint m_glPollInstrumentsSGIX_profiling(GLint* marker_p)const{auto const profilingStart=this->profiler.begin(532);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLPOLLINSTRUMENTSSGIXPROC)this->m_profiledFunctions[532]))(marker_p);this->profiler.end(532,profilingStart);return profilingResult;}
+void m_glGetTextureLevelParameteriv_profiling(GLuint texture,GLint level,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(533);(this->*((FunctionTable::MEMBERPFNGLGETTEXTURELEVELPARAMETERIVPROC)this->m_profiledFunctions[533]))(texture,level,pname,params);this->profiler.end(533,profilingStart);}
+void m_glVertexAttribI2uiv_profiling(GLuint index,const GLuint* v)const{auto const profilingStart=this->profiler.begin(534);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBI2UIVPROC)this->m_profiledFunctions[534]))(index,v);this->profiler.end(534,profilingStart);}
+void m_glMapControlPointsNV_profiling(GLenum target,GLuint index,GLenum type,GLsizei ustride,GLsizei vstride,GLint uorder,GLint vorder,GLboolean packed,const void* points)const{auto const profilingStart=this->profiler.begin(535);(this->*((FunctionTable::MEMBERPFNGLMAPCONTROLPOINTSNVPROC)this->m_profiledFunctions[535]))(target,index,type,ustride,vstride,uorder,vorder,packed,points);this->profiler.end(535,profilingStart);}
+void m_glColor4dv_profiling(const GLdouble* v)const{auto const profilingStart=this->profiler.begin(536);(this->*((FunctionTable::MEMBERPFNGLCOLOR4DVPROC)this->m_profiledFunctions[536]))(v);this->profiler.end(536,profilingStart);}
+void m_glInvalidateBufferSubData_profiling(GLuint buffer,GLintptr offset,GLsizeiptr length)const{auto const profilingStart=this->profiler.begin(537);(this->*((FunctionTable::MEMBERPFNGLINVALIDATEBUFFERSUBDATAPROC)this->m_profiledFunctions[537]))(buffer,offset,length);this->profiler.end(537,profilingStart);}
+void m_glMultiTexCoord1hNV_profiling(GLenum target,GLhalfNV s)const{auto const profilingStart=this->profiler.begin(538);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD1HNVPROC)this->m_profiledFunctions[538]))(target,s);this->profiler.end(538,profilingStart);}
+void m_glPointParameterfv_profiling(GLenum pname,const GLfloat* params)const{auto const profilingStart=this->profiler.begin(539);(this->*((FunctionTable::MEMBERPFNGLPOINTPARAMETERFVPROC)this->m_profiledFunctions[539]))(pname,params);this->profiler.end(539,profilingStart);}
+void m_glUniformMatrix2fvARB_profiling(GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{auto const profilingStart=this->profiler.begin(540);(this->*((FunctionTable::MEMBERPFNGLUNIFORMMATRIX2FVARBPROC)this->m_profiledFunctions[540]))(location,count,transpose,value);this->profiler.end(540,profilingStart);}
+void m_glUniform2fv_profiling(GLint location,GLsizei count,const GLfloat* value)const{auto const profilingStart=this->profiler.begin(541);(this->*((FunctionTable::MEMBERPFNGLUNIFORM2FVPROC)this->m_profiledFunctions[541]))(location,count,value);this->profiler.end(541,profilingStart);}
+void m_glVertexPointerListIBM_profiling(GLint size,GLenum type,GLint stride,const void** pointer,GLint ptrstride)const{auto const profilingStart=this->profiler.begin(542);(this->*((FunctionTable::MEMBERPFNGLVERTEXPOINTERLISTIBMPROC)this->m_profiledFunctions[542]))(size,type,stride,pointer,ptrstride);this->profiler.end(542,profilingStart);}
+void m_glGetMultiTexGenfvEXT_profiling(GLenum texunit,GLenum coord,GLenum pname,GLfloat* params)const{auto const profilingStart=this->profiler.begin(543);(this->*((FunctionTable::MEMBERPFNGLGETMULTITEXGENFVEXTPROC)this->m_profiledFunctions[543]))(texunit,coord,pname,params);this->profiler.end(543,profilingStart);}
+void m_glGetMinmaxEXT_profiling(GLenum target,GLboolean reset,GLenum format,GLenum type,void* values)const{auto const profilingStart=this->profiler.begin(544);(this->*((FunctionTable::MEMBERPFNGLGETMINMAXEXTPROC)this->m_profiledFunctions[544]))(target,reset,format,type,values);this->profiler.end(544,profilingStart);}
+GLboolean m_glIsFenceNV_profiling(GLuint fence)const{auto const profilingStart=this->profiler.begin(545);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLISFENCENVPROC)this->m_profiledFunctions[545]))(fence);this->profiler.end(545,profilingStart);return profilingResult;}
+void m_glMatrixFrustumEXT_profiling(GLenum mode,GLdouble left,GLdouble right,GLdouble bottom,GLdouble top,GLdouble zNear,GLdouble zFar)const{auto const profilingStart=this->profiler.begin(546);(this->*((FunctionTable::MEMBERPFNGLMATRIXFRUSTUMEXTPROC)this->m_profiledFunctions[546]))(mode,left,right,bottom,top,zNear,zFar);this->profiler.end(546,profilingStart);}
+void m_glDispatchComputeIndirect_profiling(GLintptr indirect)const{auto const profilingStart=this->profiler.begin(547);(this->*((FunctionTable::MEMBERPFNGLDISPATCHCOMPUTEINDIRECTPROC)this->m_profiledFunctions[547]))(indirect);this->profiler.end(547,profilingStart);}
+void m_glMultiTexCoord4bOES_profiling(GLenum texture,GLbyte s,GLbyte t,GLbyte r,GLbyte q)const{auto const profilingStart=this->profiler.begin(548);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD4BOESPROC)this->m_profiledFunctions[548]))(texture,s,t,r,q);this->profiler.end(548,profilingStart);}
+void m_glProgramEnvParameter4dARB_profiling(GLenum target,GLuint index,GLdouble x,GLdouble y,GLdouble z,GLdouble w)const{auto const profilingStart=this->profiler.begin(549);(this->*((FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETER4DARBPROC)this->m_profiledFunctions[549]))(target,index,x,y,z,w);this->profiler.end(549,profilingStart);}
+void m_glProgramUniform1uiEXT_profiling(GLuint program,GLint location,GLuint v0)const{auto const profilingStart=this->profiler.begin(550);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UIEXTPROC)this->m_profiledFunctions[550]))(program,location,v0);this->profiler.end(550,profilingStart);}
+void m_glBindBufferRange_profiling(GLenum target,GLuint index,GLuint buffer,GLintptr offset,GLsizeiptr size)const{auto const profilingStart=this->profiler.begin(551);(this->*((FunctionTable::MEMBERPFNGLBINDBUFFERRANGEPROC)this->m_profiledFunctions[551]))(target,index,buffer,offset,size);this->profiler.end(551,profilingStart);}
+void m_glNormal3iv_profiling(const GLint* v)const{auto const profilingStart=this->profiler.begin(552);(this->*((FunctionTable::MEMBERPFNGLNORMAL3IVPROC)this->m_profiledFunctions[552]))(v);this->profiler.end(552,profilingStart);}
+void m_glVertexAttribL3dv_profiling(GLuint index,const GLdouble* v)const{auto const profilingStart=this->profiler.begin(553);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBL3DVPROC)this->m_profiledFunctions[553]))(index,v);this->profiler.end(553,profilingStart);}
+void m_glGetUniformdv_profiling(GLuint program,GLint location,GLdouble* params)const{auto const profilingStart=this->profiler.begin(554);(this->*((FunctionTable::MEMBERPFNGLGETUNIFORMDVPROC)this->m_profiledFunctions[554]))(program,location,params);this->profiler.end(554,profilingStart);}
+void m_glGetMultiTexLevelParameterfvEXT_profiling(GLenum texunit,GLenum target,GLint level,GLenum pname,GLfloat* params)const{auto const profilingStart=this->profiler.begin(555);(this->*((FunctionTable::MEMBERPFNGLGETMULTITEXLEVELPARAMETERFVEXTPROC)this->m_profiledFunctions[555]))(texunit,target,level,pname,params);this->profiler.end(555,profilingStart);}
+void m_glFinalCombinerInputNV_profiling(GLenum variable,GLenum input,GLenum mapping,GLenum componentUsage)const{auto const profilingStart=this->profiler.begin(556);(this->*((FunctionTable::MEMBERPFNGLFINALCOMBINERINPUTNVPROC)this->m_profiledFunctions[556]))(variable,input,mapping,componentUsage);this->profiler.end(556,profilingStart);}
+void m_glCullParameterdvEXT_profiling(GLenum pname,GLdouble* params)const{auto const profilingStart=this->profiler.begin(557);(this->*((FunctionTable::MEMBERPFNGLCULLPARAMETERDVEXTPROC)this->m_profiledFunctions[557]))(pname,params);this->profiler.end(557,profilingStart);}
+void m_glMultiTexCoord4s_profiling(GLenum target,GLshort s,GLshort t,GLshort r,GLshort q)const{auto const profilingStart=this->profiler.begin(558);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD4SPROC)this->m_profiledFunctions[558]))(target,s,t,r,q);this->profiler.end(558,profilingStart);}
+void m_glMapVertexAttrib1fAPPLE_profiling(GLuint index,GLuint size,GLfloat u1,GLfloat u2,GLint stride,GLint order,const GLfloat* points)const{auto const profilingStart=this->profiler.begin(559);(this->*((FunctionTable::MEMBERPFNGLMAPVERTEXATTRIB1FAPPLEPROC)this->m_profiledFunctions[559]))(index,size,u1,u2,stride,order,points);this->profiler.end(559,profilingStart);}
+void m_glConvolutionParameterfEXT_profiling(GLenum target,GLenum pname,GLfloat params)const{auto const profilingStart=this->profiler.begin(560);(this->*((FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERFEXTPROC)this->m_profiledFunctions[560]))(target,pname,params);this->profiler.end(560,profilingStart);}
+void m_glTexCoord1iv_profiling(const GLint* v)const{auto const profilingStart=this->profiler.begin(561);(this->*((FunctionTable::MEMBERPFNGLTEXCOORD1IVPROC)this->m_profiledFunctions[561]))(v);this->profiler.end(561,profilingStart);}
+void m_glProgramUniform3fvEXT_profiling(GLuint program,GLint location,GLsizei count,const GLfloat* value)const{auto const profilingStart=this->profiler.begin(562);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3FVEXTPROC)this->m_profiledFunctions[562]))(program,location,count,value);this->profiler.end(562,profilingStart);}
+void m_glColor3uiv_profiling(const GLuint* v)const{auto const profilingStart=this->profiler.begin(563);(this->*((FunctionTable::MEMBERPFNGLCOLOR3UIVPROC)this->m_profiledFunctions[563]))(v);this->profiler.end(563,profilingStart);}
+void m_glListBase_profiling(GLuint base)const{auto const profilingStart=this->profiler.begin(564);(this->*((FunctionTable::MEMBERPFNGLLISTBASEPROC)this->m_profiledFunctions[564]))(base);this->profiler.end(564,profilingStart);}
+void m_glTexCoord2bOES_profiling(GLbyte s,GLbyte t)const{auto const profilingStart=this->profiler.begin(565);(this->*((FunctionTable::MEMBERPFNGLTEXCOORD2BOESPROC)this->m_profiledFunctions[565]))(s,t);this->profiler.end(565,profilingStart);}
+GLuint m_glBindMaterialParameterEXT_profiling(GLenum face,GLenum value)const{auto const profilingStart=this->profiler.begin(566);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLBINDMATERIALPARAMETEREXTPROC)this->m_profiledFunctions[566]))(face,value);this->profiler.end(566,profilingStart);return profilingResult;}
+void m_glGlobalAlphaFactorubSUN_profiling(GLubyte factor)const{auto const profilingStart=this->profiler.begin(567);(this->*((FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORUBSUNPROC)this->m_profiledFunctions[567]))(factor);this->profiler.end(567,profilingStart);}
+void m_glVertexAttribL1ui64NV_profiling(GLuint index,GLuint64EXT x)const{auto const profilingStart=this->profiler.begin(568);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBL1UI64NVPROC)this->m_profiledFunctions[568]))(index,x);this->profiler.end(568,profilingStart);}
+void m_glPointParameterfSGIS_profiling(GLenum pname,GLfloat param)const{auto const profilingStart=this->profiler.begin(569);(this->*((FunctionTable::MEMBERPFNGLPOINTPARAMETERFSGISPROC)this->m_profiledFunctions[569]))(pname,param);this->profiler.end(569,profilingStart);}
+void m_glGetImageTransformParameterivHP_profiling(GLenum target,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(570);(this->*((FunctionTable::MEMBERPFNGLGETIMAGETRANSFORMPARAMETERIVHPPROC)this->m_profiledFunctions[570]))(target,pname,params);this->profiler.end(570,profilingStart);}
+void m_glColorSubTableEXT_profiling(GLenum target,GLsizei start,GLsizei count,GLenum format,GLenum type,const void* data)const{auto const profilingStart=this->profiler.begin(571);(this->*((FunctionTable::MEMBERPFNGLCOLORSUBTABLEEXTPROC)this->m_profiledFunctions[571]))(target,start,count,format,type,data);this->profiler.end(571,profilingStart);}
+void m_glPixelTexGenParameterfvSGIS_profiling(GLenum pname,const GLfloat* params)const{auto const profilingStart=this->profiler.begin(572);(this->*((FunctionTable::MEMBERPFNGLPIXELTEXGENPARAMETERFVSGISPROC)this->m_profiledFunctions[572]))(pname,params);this->profiler.end(572,profilingStart);}
+GLenum m_glClientWaitSync_profiling(GLsync sync,GLbitfield flags,GLuint64 timeout)const{auto const profilingStart=this->profiler.begin(573);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLCLIENTWAITSYNCPROC)this->m_profiledFunctions[573]))(sync,flags,timeout);this->profiler.end(573,profilingStart);return profilingResult;}
+void m_glQueryObjectParameteruiAMD_profiling(GLenum target,GLuint id,GLenum pname,GLuint param)const{auto const profilingStart=this->profiler.begin(574);(this->*((FunctionTable::MEMBERPFNGLQUERYOBJECTPARAMETERUIAMDPROC)this->m_profiledFunctions[574]))(target,id,pname,param);this->profiler.end(574,profilingStart);}
+void m_glVertexAttribs1fvNV_profiling(GLuint index,GLsizei count,const GLfloat* v)const{auto const profilingStart=this->profiler.begin(575);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBS1FVNVPROC)this->m_profiledFunctions[575]))(index,count,v);this->profiler.end(575,profilingStart);}
+void m_glVertexAttrib4NusvARB_profiling(GLuint index,const GLushort* v)const{auto const profilingStart=this->profiler.begin(576);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUSVARBPROC)this->m_profiledFunctions[576]))(index,v);this->profiler.end(576,profilingStart);}
+void m_glVariantPointerEXT_profiling(GLuint id,GLenum type,GLuint stride,const void* addr)const{auto const profilingStart=this->profiler.begin(577);(this->*((FunctionTable::MEMBERPFNGLVARIANTPOINTEREXTPROC)this->m_profiledFunctions[577]))(id,type,stride,addr);this->profiler.end(577,profilingStart);}
+void m_glTextureBuffer_profiling(GLuint texture,GLenum internalformat,GLuint buffer)const{auto const profilingStart=this->profiler.begin(578);(this->*((FunctionTable::MEMBERPFNGLTEXTUREBUFFERPROC)this->m_profiledFunctions[578]))(texture,internalformat,buffer);this->profiler.end(578,profilingStart);}
+void m_glVertexAttribI1uiEXT_profiling(GLuint index,GLuint x)const{auto const profilingStart=this->profiler.begin(579);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBI1UIEXTPROC)this->m_profiledFunctions[579]))(index,x);this->profiler.end(579,profilingStart);}
+void m_glInvalidateTexImage_profiling(GLuint texture,GLint level)const{auto const profilingStart=this->profiler.begin(580);(this->*((FunctionTable::MEMBERPFNGLINVALIDATETEXIMAGEPROC)this->m_profiledFunctions[580]))(texture,level);this->profiler.end(580,profilingStart);}
+void m_glProgramEnvParametersI4ivNV_profiling(GLenum target,GLuint index,GLsizei count,const GLint* params)const{auto const profilingStart=this->profiler.begin(581);(this->*((FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERSI4IVNVPROC)this->m_profiledFunctions[581]))(target,index,count,params);this->profiler.end(581,profilingStart);}
+GLenum m_glPathGlyphIndexArrayNV_profiling(GLuint firstPathName,GLenum fontTarget,const void* fontName,GLbitfield fontStyle,GLuint firstGlyphIndex,GLsizei numGlyphs,GLuint pathParameterTemplate,GLfloat emScale)const{auto const profilingStart=this->profiler.begin(582);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLPATHGLYPHINDEXARRAYNVPROC)this->m_profiledFunctions[582]))(firstPathName,fontTarget,fontName,fontStyle,firstGlyphIndex,numGlyphs,pathParameterTemplate,emScale);this->profiler.end(582,profilingStart);return profilingResult;}
+void m_glCopyImageSubData_profiling(GLuint srcName,GLenum srcTarget,GLint srcLevel,GLint srcX,GLint srcY,GLint srcZ,GLuint dstName,GLenum dstTarget,GLint dstLevel,GLint dstX,GLint dstY,GLint dstZ,GLsizei srcWidth,GLsizei srcHeight,GLsizei srcDepth)const{auto const profilingStart=this->profiler.begin(583);(this->*((FunctionTable::MEMBERPFNGLCOPYIMAGESUBDATAPROC)this->m_profiledFunctions[583]))(srcName,srcTarget,srcLevel,srcX,srcY,srcZ,dstName,dstTarget,dstLevel,dstX,dstY,dstZ,srcWidth,srcHeight,srcDepth);this->profiler.end(583,profilingStart);}
+void m_glGetUniformSubroutineuiv_profiling(GLenum shadertype,GLint location,GLuint* params)const{auto const profilingStart=this->profiler.begin(584);(this->*((FunctionTable::MEMBERPFNGLGETUNIFORMSUBROUTINEUIVPROC)this->m_profiledFunctions[584]))(shadertype,location,params);this->profiler.end(584,profilingStart);}
+void m_glBindVertexBuffer_profiling(GLuint bindingindex,GLuint buffer,GLintptr offset,GLsizei stride)const{auto const profilingStart=this->profiler.begin(585);(this->*((FunctionTable::MEMBERPFNGLBINDVERTEXBUFFERPROC)this->m_profiledFunctions[585]))(bindingindex,buffer,offset,stride);this->profiler.end(585,profilingStart);}
+void m_glMultiTexCoord1iARB_profiling(GLenum target,GLint s)const{auto const profilingStart=this->profiler.begin(586);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD1IARBPROC)this->m_profiledFunctions[586]))(target,s);this->profiler.end(586,profilingStart);}
+void m_glDebugMessageInsert_profiling(GLenum source,GLenum type,GLuint id,GLenum severity,GLsizei length,const GLchar* buf)const{auto const profilingStart=this->profiler.begin(587);(this->*((FunctionTable::MEMBERPFNGLDEBUGMESSAGEINSERTPROC)this->m_profiledFunctions[587]))(source,type,id,severity,length,buf);this->profiler.end(587,profilingStart);}
+void m_glBeginVertexShaderEXT_profiling()const{auto const profilingStart=this->profiler.begin(588);(this->*((FunctionTable::MEMBERPFNGLBEGINVERTEXSHADEREXTPROC)this->m_profiledFunctions[588]))();this->profiler.end(588,profilingStart);}
+GLboolean m_glIsVariantEnabledEXT_profiling(GLuint id,GLenum cap)const{auto const profilingStart=this->profiler.begin(589);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLISVARIANTENABLEDEXTPROC)this->m_profiledFunctions[589]))(id,cap);this->profiler.end(589,profilingStart);return profilingResult;}
+void m_glPassThroughxOES_profiling(GLfixed token)const{auto const profilingStart=this->profiler.begin(590);(this->*((FunctionTable::MEMBERPFNGLPASSTHROUGHXOESPROC)this->m_profiledFunctions[590]))(token);this->profiler.end(590,profilingStart);}
+GLboolean m_glIsSampler_profiling(GLuint sampler)const{auto const profilingStart=this->profiler.begin(591);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLISSAMPLERPROC)this->m_profiledFunctions[591]))(sampler);this->profiler.end(591,profilingStart);return profilingResult;}
+void m_glConservativeRasterParameterfNV_profiling(GLenum pname,GLfloat value)const{auto const profilingStart=this->profiler.begin(592);(this->*((FunctionTable::MEMBERPFNGLCONSERVATIVERASTERPARAMETERFNVPROC)this->m_profiledFunctions[592]))(pname,value);this->profiler.end(592,profilingStart);}
+void m_glMultiTexGenivEXT_profiling(GLenum texunit,GLenum coord,GLenum pname,const GLint* params)const{auto const profilingStart=this->profiler.begin(593);(this->*((FunctionTable::MEMBERPFNGLMULTITEXGENIVEXTPROC)this->m_profiledFunctions[593]))(texunit,coord,pname,params);this->profiler.end(593,profilingStart);}
+void m_glNamedFramebufferTexture2DEXT_profiling(GLuint framebuffer,GLenum attachment,GLenum textarget,GLuint texture,GLint level)const{auto const profilingStart=this->profiler.begin(594);(this->*((FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTURE2DEXTPROC)this->m_profiledFunctions[594]))(framebuffer,attachment,textarget,texture,level);this->profiler.end(594,profilingStart);}
+void m_glCopyTexSubImage1D_profiling(GLenum target,GLint level,GLint xoffset,GLint x,GLint y,GLsizei width)const{auto const profilingStart=this->profiler.begin(595);(this->*((FunctionTable::MEMBERPFNGLCOPYTEXSUBIMAGE1DPROC)this->m_profiledFunctions[595]))(target,level,xoffset,x,y,width);this->profiler.end(595,profilingStart);}
+void m_glTexCoord1i_profiling(GLint s)const{auto const profilingStart=this->profiler.begin(596);(this->*((FunctionTable::MEMBERPFNGLTEXCOORD1IPROC)this->m_profiledFunctions[596]))(s);this->profiler.end(596,profilingStart);}
+GLenum m_glCheckFramebufferStatus_profiling(GLenum target)const{auto const profilingStart=this->profiler.begin(597);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLCHECKFRAMEBUFFERSTATUSPROC)this->m_profiledFunctions[597]))(target);this->profiler.end(597,profilingStart);return profilingResult;}
+void m_glDrawElementArrayAPPLE_profiling(GLenum mode,GLint first,GLsizei count)const{auto const profilingStart=this->profiler.begin(598);(this->*((FunctionTable::MEMBERPFNGLDRAWELEMENTARRAYAPPLEPROC)this->m_profiledFunctions[598]))(mode,first,count);this->profiler.end(598,profilingStart);}
+void m_glTexCoord1d_profiling(GLdouble s)const{auto const profilingStart=this->profiler.begin(599);(this->*((FunctionTable::MEMBERPFNGLTEXCOORD1DPROC)this->m_profiledFunctions[599]))(s);this->profiler.end(599,profilingStart);}
+void m_glTexCoord1f_profiling(GLfloat s)const{auto const profilingStart=this->profiler.begin(600);(this->*((FunctionTable::MEMBERPFNGLTEXCOORD1FPROC)this->m_profiledFunctions[600]))(s);this->profiler.end(600,profilingStart);}
+void m_glFragmentLightivSGIX_profiling(GLenum light,GLenum pname,const GLint* params)const{auto const profilingStart=this->profiler.begin(601);(this->*((FunctionTable::MEMBERPFNGLFRAGMENTLIGHTIVSGIXPROC)this->m_profiledFunctions[601]))(light,pname,params);this->profiler.end(601,profilingStart);}
+void m_glBindImageTexture_profiling(GLuint unit,GLuint texture,GLint level,GLboolean layered,GLint layer,GLenum access,GLenum format)const{auto const profilingStart=this->profiler.begin(602);(this->*((FunctionTable::MEMBERPFNGLBINDIMAGETEXTUREPROC)this->m_profiledFunctions[602]))(unit,texture,level,layered,layer,access,format);this->profiler.end(602,profilingStart);}
+void m_glTransformFeedbackVaryings_profiling(GLuint program,GLsizei count,const GLchar*const* varyings,GLenum bufferMode)const{auto const profilingStart=this->profiler.begin(603);(this->*((FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKVARYINGSPROC)this->m_profiledFunctions[603]))(program,count,varyings,bufferMode);this->profiler.end(603,profilingStart);}
+void m_glDrawRangeElements_profiling(GLenum mode,GLuint start,GLuint end,GLsizei count,GLenum type,const GLvoid* indices)const{auto const profilingStart=this->profiler.begin(604);(this->*((FunctionTable::MEMBERPFNGLDRAWRANGEELEMENTSPROC)this->m_profiledFunctions[604]))(mode,start,end,count,type,indices);this->profiler.end(604,profilingStart);}
+void m_glTexCoord1s_profiling(GLshort s)const{auto const profilingStart=this->profiler.begin(605);(this->*((FunctionTable::MEMBERPFNGLTEXCOORD1SPROC)this->m_profiledFunctions[605]))(s);this->profiler.end(605,profilingStart);}
+void m_glBindBufferBase_profiling(GLenum target,GLuint index,GLuint buffer)const{auto const profilingStart=this->profiler.begin(606);(this->*((FunctionTable::MEMBERPFNGLBINDBUFFERBASEPROC)this->m_profiledFunctions[606]))(target,index,buffer);this->profiler.end(606,profilingStart);}
+void m_glColor3bv_profiling(const GLbyte* v)const{auto const profilingStart=this->profiler.begin(607);(this->*((FunctionTable::MEMBERPFNGLCOLOR3BVPROC)this->m_profiledFunctions[607]))(v);this->profiler.end(607,profilingStart);}
+void m_glSyncTextureINTEL_profiling(GLuint texture)const{auto const profilingStart=this->profiler.begin(608);(this->*((FunctionTable::MEMBERPFNGLSYNCTEXTUREINTELPROC)this->m_profiledFunctions[608]))(texture);this->profiler.end(608,profilingStart);}
+void m_glCreateSamplers_profiling(GLsizei n,GLuint* samplers)const{auto const profilingStart=this->profiler.begin(609);(this->*((FunctionTable::MEMBERPFNGLCREATESAMPLERSPROC)this->m_profiledFunctions[609]))(n,samplers);this->profiler.end(609,profilingStart);}
+void m_glCombinerParameterfNV_profiling(GLenum pname,GLfloat param)const{auto const profilingStart=this->profiler.begin(610);(this->*((FunctionTable::MEMBERPFNGLCOMBINERPARAMETERFNVPROC)this->m_profiledFunctions[610]))(pname,param);this->profiler.end(610,profilingStart);}
+void m_glGetArrayObjectivATI_profiling(GLenum array,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(611);(this->*((FunctionTable::MEMBERPFNGLGETARRAYOBJECTIVATIPROC)this->m_profiledFunctions[611]))(array,pname,params);this->profiler.end(611,profilingStart);}
+void m_glMultiDrawArrays_profiling(GLenum mode,const GLint* first,const GLsizei* count,GLsizei drawcount)const{auto const profilingStart=this->profiler.begin(612);(this->*((FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSPROC)this->m_profiledFunctions[612]))(mode,first,count,drawcount);this->profiler.end(612,profilingStart);}
+void m_glSampleMapATI_profiling(GLuint dst,GLuint interp,GLenum swizzle)const{auto const profilingStart=this->profiler.begin(613);(this->*((FunctionTable::MEMBERPFNGLSAMPLEMAPATIPROC)this->m_profiledFunctions[613]))(dst,interp,swizzle);this->profiler.end(613,profilingStart);}
+void m_glProgramUniform2i64ARB_profiling(GLuint program,GLint location,GLint64 x,GLint64 y)const{auto const profilingStart=this->profiler.begin(614);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2I64ARBPROC)this->m_profiledFunctions[614]))(program,location,x,y);this->profiler.end(614,profilingStart);}
+void m_glBinormal3ivEXT_profiling(const GLint* v)const{auto const profilingStart=this->profiler.begin(615);(this->*((FunctionTable::MEMBERPFNGLBINORMAL3IVEXTPROC)this->m_profiledFunctions[615]))(v);this->profiler.end(615,profilingStart);}
+void m_glMultiDrawArraysIndirectCountARB_profiling(GLenum mode,GLintptr indirect,GLintptr drawcount,GLsizei maxdrawcount,GLsizei stride)const{auto const profilingStart=this->profiler.begin(616);(this->*((FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSINDIRECTCOUNTARBPROC)this->m_profiledFunctions[616]))(mode,indirect,drawcount,maxdrawcount,stride);this->profiler.end(616,profilingStart);}
+void m_glUniformBufferEXT_profiling(GLuint program,GLint location,GLuint buffer)const{auto const profilingStart=this->profiler.begin(617);(this->*((FunctionTable::MEMBERPFNGLUNIFORMBUFFEREXTPROC)this->m_profiledFunctions[617]))(program,location,buffer);this->profiler.end(617,profilingStart);}
+void m_glWindowPos2ivMESA_profiling(const GLint* v)const{auto const profilingStart=this->profiler.begin(618);(this->*((FunctionTable::MEMBERPFNGLWINDOWPOS2IVMESAPROC)this->m_profiledFunctions[618]))(v);this->profiler.end(618,profilingStart);}
+void m_glTexCoordP4ui_profiling(GLenum type,GLuint coords)const{auto const profilingStart=this->profiler.begin(619);(this->*((FunctionTable::MEMBERPFNGLTEXCOORDP4UIPROC)this->m_profiledFunctions[619]))(type,coords);this->profiler.end(619,profilingStart);}
+void m_glMultiTexSubImage1DEXT_profiling(GLenum texunit,GLenum target,GLint level,GLint xoffset,GLsizei width,GLenum format,GLenum type,const void* pixels)const{auto const profilingStart=this->profiler.begin(620);(this->*((FunctionTable::MEMBERPFNGLMULTITEXSUBIMAGE1DEXTPROC)this->m_profiledFunctions[620]))(texunit,target,level,xoffset,width,format,type,pixels);this->profiler.end(620,profilingStart);}
+void m_glProgramUniformMatrix2x3fvEXT_profiling(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{auto const profilingStart=this->profiler.begin(621);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X3FVEXTPROC)this->m_profiledFunctions[621]))(program,location,count,transpose,value);this->profiler.end(621,profilingStart);}
+void m_glBufferDataARB_profiling(GLenum target,GLsizeiptrARB size,const void* data,GLenum usage)const{auto const profilingStart=this->profiler.begin(622);(this->*((FunctionTable::MEMBERPFNGLBUFFERDATAARBPROC)this->m_profiledFunctions[622]))(target,size,data,usage);this->profiler.end(622,profilingStart);}
+void m_glVertexAttribIFormat_profiling(GLuint attribindex,GLint size,GLenum type,GLuint relativeoffset)const{auto const profilingStart=this->profiler.begin(623);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBIFORMATPROC)this->m_profiledFunctions[623]))(attribindex,size,type,relativeoffset);this->profiler.end(623,profilingStart);}
+void m_glCreateFramebuffers_profiling(GLsizei n,GLuint* framebuffers)const{auto const profilingStart=this->profiler.begin(624);(this->*((FunctionTable::MEMBERPFNGLCREATEFRAMEBUFFERSPROC)this->m_profiledFunctions[624]))(n,framebuffers);this->profiler.end(624,profilingStart);}
+void m_glNormalStream3dvATI_profiling(GLenum stream,const GLdouble* coords)const{auto const profilingStart=this->profiler.begin(625);(this->*((FunctionTable::MEMBERPFNGLNORMALSTREAM3DVATIPROC)this->m_profiledFunctions[625]))(stream,coords);this->profiler.end(625,profilingStart);}
+void m_glClearAccum_profiling(GLfloat red,GLfloat green,GLfloat blue,GLfloat alpha)const{auto const profilingStart=this->profiler.begin(626);(this->*((FunctionTable::MEMBERPFNGLCLEARACCUMPROC)this->m_profiledFunctions[626]))(red,green,blue,alpha);this->profiler.end(626,profilingStart);}
+void m_glUniform3i64vNV_profiling(GLint location,GLsizei count,const GLint64EXT* value)const{auto const profilingStart=this->profiler.begin(627);(this->*((FunctionTable::MEMBERPFNGLUNIFORM3I64VNVPROC)this->m_profiledFunctions[627]))(location,count,value);this->profiler.end(627,profilingStart);}
+void m_glNormal3fVertex3fSUN_profiling(GLfloat nx,GLfloat ny,GLfloat nz,GLfloat x,GLfloat y,GLfloat z)const{auto const profilingStart=this->profiler.begin(628);(this->*((FunctionTable::MEMBERPFNGLNORMAL3FVERTEX3FSUNPROC)this->m_profiledFunctions[628]))(nx,ny,nz,x,y,z);this->profiler.end(628,profilingStart);}
+void m_glUniform2uivEXT_profiling(GLint location,GLsizei count,const GLuint* value)const{auto const profilingStart=this->profiler.begin(629);(this->*((FunctionTable::MEMBERPFNGLUNIFORM2UIVEXTPROC)this->m_profiledFunctions[629]))(location,count,value);this->profiler.end(629,profilingStart);}
+void m_glBeginQuery_profiling(GLenum target,GLuint id)const{auto const profilingStart=this->profiler.begin(630);(this->*((FunctionTable::MEMBERPFNGLBEGINQUERYPROC)this->m_profiledFunctions[630]))(target,id);this->profiler.end(630,profilingStart);}
+void m_glStencilThenCoverStrokePathInstancedNV_profiling(GLsizei numPaths,GLenum pathNameType,const void* paths,GLuint pathBase,GLint reference,GLuint mask,GLenum coverMode,GLenum transformType,const GLfloat* transformValues)const{auto const profilingStart=this->profiler.begin(631);(this->*((FunctionTable::MEMBERPFNGLSTENCILTHENCOVERSTROKEPATHINSTANCEDNVPROC)this->m_profiledFunctions[631]))(numPaths,pathNameType,paths,pathBase,reference,mask,coverMode,transformType,transformValues);this->profiler.end(631,profilingStart);}
+void m_glBindBuffer_profiling(GLenum target,GLuint buffer)const{auto const profilingStart=this->profiler.begin(632);(this->*((FunctionTable::MEMBERPFNGLBINDBUFFERPROC)this->m_profiledFunctions[632]))(target,buffer);this->profiler.end(632,profilingStart);}
+void m_glMap2d_profiling(GLenum target,GLdouble u1,GLdouble u2,GLint ustride,GLint uorder,GLdouble v1,GLdouble v2,GLint vstride,GLint vorder,const GLdouble* points)const{auto const profilingStart=this->profiler.begin(633);(this->*((FunctionTable::MEMBERPFNGLMAP2DPROC)this->m_profiledFunctions[633]))(target,u1,u2,ustride,uorder,v1,v2,vstride,vorder,points);this->profiler.end(633,profilingStart);}
+void m_glMap2f_profiling(GLenum target,GLfloat u1,GLfloat u2,GLint ustride,GLint uorder,GLfloat v1,GLfloat v2,GLint vstride,GLint vorder,const GLfloat* points)const{auto const profilingStart=this->profiler.begin(634);(this->*((FunctionTable::MEMBERPFNGLMAP2FPROC)this->m_profiledFunctions[634]))(target,u1,u2,ustride,uorder,v1,v2,vstride,vorder,points);this->profiler.end(634,profilingStart);}
+void m_glMakeImageHandleResidentNV_profiling(GLuint64 handle,GLenum access)const{auto const profilingStart=this->profiler.begin(635);(this->*((FunctionTable::MEMBERPFNGLMAKEIMAGEHANDLERESIDENTNVPROC)this->m_profiledFunctions[635]))(handle,access);this->profiler.end(635,profilingStart);}
+void m_glUniformMatrix2x4fv_profiling(GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{auto const profilingStart=this->profiler.begin(636);(this->*((FunctionTable::MEMBERPFNGLUNIFORMMATRIX2X4FVPROC)this->m_profiledFunctions[636]))(location,count,transpose,value);this->profiler.end(636,profilingStart);}
+void m_glGetMultiTexParameterfvEXT_profiling(GLenum texunit,GLenum target,GLenum pname,GLfloat* params)const{auto const profilingStart=this->profiler.begin(637);(this->*((FunctionTable::MEMBERPFNGLGETMULTITEXPARAMETERFVEXTPROC)this->m_profiledFunctions[637]))(texunit,target,pname,params);this->profiler.end(637,profilingStart);}
+void m_glDepthRangeIndexed_profiling(GLuint index,GLdouble n,GLdouble f)const{auto const profilingStart=this->profiler.begin(638);(this->*((FunctionTable::MEMBERPFNGLDEPTHRANGEINDEXEDPROC)this->m_profiledFunctions[638]))(index,n,f);this->profiler.end(638,profilingStart);}
+void m_glMultiTexCoord1s_profiling(GLenum target,GLshort s)const{auto const profilingStart=this->profiler.begin(639);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD1SPROC)this->m_profiledFunctions[639]))(target,s);this->profiler.end(639,profilingStart);}
+void m_glMatrixScalefEXT_profiling(GLenum mode,GLfloat x,GLfloat y,GLfloat z)const{auto const profilingStart=this->profiler.begin(640);(this->*((FunctionTable::MEMBERPFNGLMATRIXSCALEFEXTPROC)this->m_profiledFunctions[640]))(mode,x,y,z);this->profiler.end(640,profilingStart);}
+GLenum m_glGetError_profiling()const{auto const profilingStart=this->profiler.begin(641);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLGETERRORPROC)this->m_profiledFunctions[641]))();this->profiler.end(641,profilingStart);return profilingResult;}
+void m_glGetTexEnviv_profiling(GLenum target,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(642);(this->*((FunctionTable::MEMBERPFNGLGETTEXENVIVPROC)this->m_profiledFunctions[642]))(target,pname,params);this->profiler.end(642,profilingStart);}
+GLuint m_glBindTextureUnitParameterEXT_profiling(GLenum unit,GLenum value)const{auto const profilingStart=this->profiler.begin(643);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLBINDTEXTUREUNITPARAMETEREXTPROC)this->m_profiledFunctions[643]))(unit,value);this->profiler.end(643,profilingStart);return profilingResult;}
+void m_glGetnUniformfvARB_profiling(GLuint program,GLint location,GLsizei bufSize,GLfloat* params)const{auto const profilingStart=this->profiler.begin(644);(this->*((FunctionTable::MEMBERPFNGLGETNUNIFORMFVARBPROC)this->m_profiledFunctions[644]))(program,location,bufSize,params);this->profiler.end(644,profilingStart);}
+void m_glReplacementCodeuiNormal3fVertex3fvSUN_profiling(const GLuint* rc,const GLfloat* n,const GLfloat* v)const{auto const profilingStart=this->profiler.begin(645);(this->*((FunctionTable::MEMBERPFNGLREPLACEMENTCODEUINORMAL3FVERTEX3FVSUNPROC)this->m_profiledFunctions[645]))(rc,n,v);this->profiler.end(645,profilingStart);}
+void m_glDeletePerfQueryINTEL_profiling(GLuint queryHandle)const{auto const profilingStart=this->profiler.begin(646);(this->*((FunctionTable::MEMBERPFNGLDELETEPERFQUERYINTELPROC)this->m_profiledFunctions[646]))(queryHandle);this->profiler.end(646,profilingStart);}
+void m_glActiveVaryingNV_profiling(GLuint program,const GLchar* name)const{auto const profilingStart=this->profiler.begin(647);(this->*((FunctionTable::MEMBERPFNGLACTIVEVARYINGNVPROC)this->m_profiledFunctions[647]))(program,name);this->profiler.end(647,profilingStart);}
+void m_glGetActiveUniformARB_profiling(GLhandleARB programObj,GLuint index,GLsizei maxLength,GLsizei* length,GLint* size,GLenum* type,GLcharARB* name)const{auto const profilingStart=this->profiler.begin(648);(this->*((FunctionTable::MEMBERPFNGLGETACTIVEUNIFORMARBPROC)this->m_profiledFunctions[648]))(programObj,index,maxLength,length,size,type,name);this->profiler.end(648,profilingStart);}
+void m_glVertexAttribI3ivEXT_profiling(GLuint index,const GLint* v)const{auto const profilingStart=this->profiler.begin(649);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBI3IVEXTPROC)this->m_profiledFunctions[649]))(index,v);this->profiler.end(649,profilingStart);}
+void m_glEvalCoord1d_profiling(GLdouble u)const{auto const profilingStart=this->profiler.begin(650);(this->*((FunctionTable::MEMBERPFNGLEVALCOORD1DPROC)this->m_profiledFunctions[650]))(u);this->profiler.end(650,profilingStart);}
+void m_glNamedCopyBufferSubDataEXT_profiling(GLuint readBuffer,GLuint writeBuffer,GLintptr readOffset,GLintptr writeOffset,GLsizeiptr size)const{auto const profilingStart=this->profiler.begin(651);(this->*((FunctionTable::MEMBERPFNGLNAMEDCOPYBUFFERSUBDATAEXTPROC)this->m_profiledFunctions[651]))(readBuffer,writeBuffer,readOffset,writeOffset,size);this->profiler.end(651,profilingStart);}
+void m_glEvalCoord1f_profiling(GLfloat u)const{auto const profilingStart=this->profiler.begin(652);(this->*((FunctionTable::MEMBERPFNGLEVALCOORD1FPROC)this->m_profiledFunctions[652]))(u);this->profiler.end(652,profilingStart);}
+void m_glPixelMapfv_profiling(GLenum map,GLsizei mapsize,const GLfloat* values)const{auto const profilingStart=this->profiler.begin(653);(this->*((FunctionTable::MEMBERPFNGLPIXELMAPFVPROC)this->m_profiledFunctions[653]))(map,mapsize,values);this->profiler.end(653,profilingStart);}
+void m_glVertexAttribI1ivEXT_profiling(GLuint index,const GLint* v)const{auto const profilingStart=this->profiler.begin(654);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBI1IVEXTPROC)this->m_profiledFunctions[654]))(index,v);this->profiler.end(654,profilingStart);}
+GLsync m_glCreateSyncFromCLeventARB_profiling(struct _cl_context* context,struct _cl_event* event,GLbitfield flags)const{auto const profilingStart=this->profiler.begin(655);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLCREATESYNCFROMCLEVENTARBPROC)this->m_profiledFunctions[655]))(context,event,flags);this->profiler.end(655,profilingStart);return profilingResult;}
+void m_glGetPixelMapusv_profiling(GLenum map,GLushort* values)const{auto const profilingStart=this->profiler.begin(656);(this->*((FunctionTable::MEMBERPFNGLGETPIXELMAPUSVPROC)this->m_profiledFunctions[656]))(map,values);this->profiler.end(656,profilingStart);}
+void m_glGetnColorTableARB_profiling(GLenum target,GLenum format,GLenum type,GLsizei bufSize,void* table)const{auto const profilingStart=this->profiler.begin(657);(this->*((FunctionTable::MEMBERPFNGLGETNCOLORTABLEARBPROC)this->m_profiledFunctions[657]))(target,format,type,bufSize,table);this->profiler.end(657,profilingStart);}
+void m_glAccum_profiling(GLenum op,GLfloat value)const{auto const profilingStart=this->profiler.begin(658);(this->*((FunctionTable::MEMBERPFNGLACCUMPROC)this->m_profiledFunctions[658]))(op,value);this->profiler.end(658,profilingStart);}
+void m_glRasterPos3sv_profiling(const GLshort* v)const{auto const profilingStart=this->profiler.begin(659);(this->*((FunctionTable::MEMBERPFNGLRASTERPOS3SVPROC)this->m_profiledFunctions[659]))(v);this->profiler.end(659,profilingStart);}
+void m_glTexCoord2iv_profiling(const GLint* v)const{auto const profilingStart=this->profiler.begin(660);(this->*((FunctionTable::MEMBERPFNGLTEXCOORD2IVPROC)this->m_profiledFunctions[660]))(v);this->profiler.end(660,profilingStart);}
+void m_glBlendFunciARB_profiling(GLuint buf,GLenum src,GLenum dst)const{auto const profilingStart=this->profiler.begin(661);(this->*((FunctionTable::MEMBERPFNGLBLENDFUNCIARBPROC)this->m_profiledFunctions[661]))(buf,src,dst);this->profiler.end(661,profilingStart);}
+void m_glProgramUniform3i64vARB_profiling(GLuint program,GLint location,GLsizei count,const GLint64* value)const{auto const profilingStart=this->profiler.begin(662);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3I64VARBPROC)this->m_profiledFunctions[662]))(program,location,count,value);this->profiler.end(662,profilingStart);}
+void m_glGetFramebufferAttachmentParameteriv_profiling(GLenum target,GLenum attachment,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(663);(this->*((FunctionTable::MEMBERPFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC)this->m_profiledFunctions[663]))(target,attachment,pname,params);this->profiler.end(663,profilingStart);}
+void m_glProgramUniform4ui_profiling(GLuint program,GLint location,GLuint v0,GLuint v1,GLuint v2,GLuint v3)const{auto const profilingStart=this->profiler.begin(664);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UIPROC)this->m_profiledFunctions[664]))(program,location,v0,v1,v2,v3);this->profiler.end(664,profilingStart);}
+void m_glStencilMask_profiling(GLuint mask)const{auto const profilingStart=this->profiler.begin(665);(this->*((FunctionTable::MEMBERPFNGLSTENCILMASKPROC)this->m_profiledFunctions[665]))(mask);this->profiler.end(665,profilingStart);}
+void m_glResetHistogramEXT_profiling(GLenum target)const{auto const profilingStart=this->profiler.begin(666);(this->*((FunctionTable::MEMBERPFNGLRESETHISTOGRAMEXTPROC)this->m_profiledFunctions[666]))(target);this->profiler.end(666,profilingStart);}
+void m_glLightxOES_profiling(GLenum light,GLenum pname,GLfixed param)const{auto const profilingStart=this->profiler.begin(667);(this->*((FunctionTable::MEMBERPFNGLLIGHTXOESPROC)this->m_profiledFunctions[667]))(light,pname,param);this->profiler.end(667,profilingStart);}
+void m_glNamedBufferData_profiling(GLuint buffer,GLsizeiptr size,const void* data,GLenum usage)const{auto const profilingStart=this->profiler.begin(668);(this->*((FunctionTable::MEMBERPFNGLNAMEDBUFFERDATAPROC)this->m_profiledFunctions[668]))(buffer,size,data,usage);this->profiler.end(668,profilingStart);}
+void m_glVertexStream3sATI_profiling(GLenum stream,GLshort x,GLshort y,GLshort z)const{auto const profilingStart=this->profiler.begin(669);(this->*((FunctionTable::MEMBERPFNGLVERTEXSTREAM3SATIPROC)this->m_profiledFunctions[669]))(stream,x,y,z);this->profiler.end(669,profilingStart);}
+void m_glVertexAttrib3fvARB_profiling(GLuint index,const GLfloat* v)const{auto const profilingStart=this->profiler.begin(670);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB3FVARBPROC)this->m_profiledFunctions[670]))(index,v);this->profiler.end(670,profilingStart);}
+void m_glClearNamedBufferSubData_profiling(GLuint buffer,GLenum internalformat,GLintptr offset,GLsizeiptr size,GLenum format,GLenum type,const void* data)const{auto const profilingStart=this->profiler.begin(671);(this->*((FunctionTable::MEMBERPFNGLCLEARNAMEDBUFFERSUBDATAPROC)this->m_profiledFunctions[671]))(buffer,internalformat,offset,size,format,type,data);this->profiler.end(671,profilingStart);}
+void m_glProgramUniformHandleui64ARB_profiling(GLuint program,GLint location,GLuint64 value)const{auto const profilingStart=this->profiler.begin(672);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORMHANDLEUI64ARBPROC)this->m_profiledFunctions[672]))(program,location,value);this->profiler.end(672,profilingStart);}
+void m_glUniform3iARB_profiling(GLint location,GLint v0,GLint v1,GLint v2)const{auto const profilingStart=this->profiler.begin(673);(this->*((FunctionTable::MEMBERPFNGLUNIFORM3IARBPROC)this->m_profiledFunctions[673]))(location,v0,v1,v2);this->profiler.end(673,profilingStart);}
+GLhandleARB m_glCreateProgramObjectARB_profiling()const{auto const profilingStart=this->profiler.begin(674);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLCREATEPROGRAMOBJECTARBPROC)this->m_profiledFunctions[674]))();this->profiler.end(674,profilingStart);return profilingResult;}
+void m_glMultiTexCoord1dvARB_profiling(GLenum target,const GLdouble* v)const{auto const profilingStart=this->profiler.begin(675);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD1DVARBPROC)this->m_profiledFunctions[675]))(target,v);this->profiler.end(675,profilingStart);}
+void m_glGetObjectParameterfvARB_profiling(GLhandleARB obj,GLenum pname,GLfloat* params)const{auto const profilingStart=this->profiler.begin(676);(this->*((FunctionTable::MEMBERPFNGLGETOBJECTPARAMETERFVARBPROC)this->m_profiledFunctions[676]))(obj,pname,params);this->profiler.end(676,profilingStart);}
+void m_glRectsv_profiling(const GLshort* v1,const GLshort* v2)const{auto const profilingStart=this->profiler.begin(677);(this->*((FunctionTable::MEMBERPFNGLRECTSVPROC)this->m_profiledFunctions[677]))(v1,v2);this->profiler.end(677,profilingStart);}
+void m_glMultiTexImage2DEXT_profiling(GLenum texunit,GLenum target,GLint level,GLint internalformat,GLsizei width,GLsizei height,GLint border,GLenum format,GLenum type,const void* pixels)const{auto const profilingStart=this->profiler.begin(678);(this->*((FunctionTable::MEMBERPFNGLMULTITEXIMAGE2DEXTPROC)this->m_profiledFunctions[678]))(texunit,target,level,internalformat,width,height,border,format,type,pixels);this->profiler.end(678,profilingStart);}
+void m_glProgramUniform1i64NV_profiling(GLuint program,GLint location,GLint64EXT x)const{auto const profilingStart=this->profiler.begin(679);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1I64NVPROC)this->m_profiledFunctions[679]))(program,location,x);this->profiler.end(679,profilingStart);}
+void m_glGetObjectBufferivATI_profiling(GLuint buffer,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(680);(this->*((FunctionTable::MEMBERPFNGLGETOBJECTBUFFERIVATIPROC)this->m_profiledFunctions[680]))(buffer,pname,params);this->profiler.end(680,profilingStart);}
+void m_glUniform4i64ARB_profiling(GLint location,GLint64 x,GLint64 y,GLint64 z,GLint64 w)const{auto const profilingStart=this->profiler.begin(681);(this->*((FunctionTable::MEMBERPFNGLUNIFORM4I64ARBPROC)this->m_profiledFunctions[681]))(location,x,y,z,w);this->profiler.end(681,profilingStart);}
+void m_glReplacementCodeuiColor4ubVertex3fvSUN_profiling(const GLuint* rc,const GLubyte* c,const GLfloat* v)const{auto const profilingStart=this->profiler.begin(682);(this->*((FunctionTable::MEMBERPFNGLREPLACEMENTCODEUICOLOR4UBVERTEX3FVSUNPROC)this->m_profiledFunctions[682]))(rc,c,v);this->profiler.end(682,profilingStart);}
+void m_glBlendFuncSeparateINGR_profiling(GLenum sfactorRGB,GLenum dfactorRGB,GLenum sfactorAlpha,GLenum dfactorAlpha)const{auto const profilingStart=this->profiler.begin(683);(this->*((FunctionTable::MEMBERPFNGLBLENDFUNCSEPARATEINGRPROC)this->m_profiledFunctions[683]))(sfactorRGB,dfactorRGB,sfactorAlpha,dfactorAlpha);this->profiler.end(683,profilingStart);}
+void m_glGetVideoCaptureStreamfvNV_profiling(GLuint video_capture_slot,GLuint stream,GLenum pname,GLfloat* params)const{auto const profilingStart=this->profiler.begin(684);(this->*((FunctionTable::MEMBERPFNGLGETVIDEOCAPTURESTREAMFVNVPROC)this->m_profiledFunctions[684]))(video_capture_slot,stream,pname,params);this->profiler.end(684,profilingStart);}
+void m_glVertexAttrib2fARB_profiling(GLuint index,GLfloat x,GLfloat y)const{auto const profilingStart=this->profiler.begin(685);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB2FARBPROC)this->m_profiledFunctions[685]))(index,x,y);this->profiler.end(685,profilingStart);}
+void m_glGetTexGeniv_profiling(GLenum coord,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(686);(this->*((FunctionTable::MEMBERPFNGLGETTEXGENIVPROC)this->m_profiledFunctions[686]))(coord,pname,params);this->profiler.end(686,profilingStart);}
+void m_glPixelStorei_profiling(GLenum pname,GLint param)const{auto const profilingStart=this->profiler.begin(687);(this->*((FunctionTable::MEMBERPFNGLPIXELSTOREIPROC)this->m_profiledFunctions[687]))(pname,param);this->profiler.end(687,profilingStart);}
+void m_glGetCompressedTextureSubImage_profiling(GLuint texture,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLsizei bufSize,void* pixels)const{auto const profilingStart=this->profiler.begin(688);(this->*((FunctionTable::MEMBERPFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC)this->m_profiledFunctions[688]))(texture,level,xoffset,yoffset,zoffset,width,height,depth,bufSize,pixels);this->profiler.end(688,profilingStart);}
+void m_glCopyImageSubDataNV_profiling(GLuint srcName,GLenum srcTarget,GLint srcLevel,GLint srcX,GLint srcY,GLint srcZ,GLuint dstName,GLenum dstTarget,GLint dstLevel,GLint dstX,GLint dstY,GLint dstZ,GLsizei width,GLsizei height,GLsizei depth)const{auto const profilingStart=this->profiler.begin(689);(this->*((FunctionTable::MEMBERPFNGLCOPYIMAGESUBDATANVPROC)this->m_profiledFunctions[689]))(srcName,srcTarget,srcLevel,srcX,srcY,srcZ,dstName,dstTarget,dstLevel,dstX,dstY,dstZ,width,height,depth);this->profiler.end(689,profilingStart);}
+void m_glActiveShaderProgram_profiling(GLuint pipeline,GLuint program)const{auto const profilingStart=this->profiler.begin(690);(this->*((FunctionTable::MEMBERPFNGLACTIVESHADERPROGRAMPROC)this->m_profiledFunctions[690]))(pipeline,program);this->profiler.end(690,profilingStart);}
+void m_glVertexStream1iATI_profiling(GLenum stream,GLint x)const{auto const profilingStart=this->profiler.begin(691);(this->*((FunctionTable::MEMBERPFNGLVERTEXSTREAM1IATIPROC)this->m_profiledFunctions[691]))(stream,x);this->profiler.end(691,profilingStart);}
+void m_glPatchParameterfv_profiling(GLenum pname,const GLfloat* values)const{auto const profilingStart=this->profiler.begin(692);(this->*((FunctionTable::MEMBERPFNGLPATCHPARAMETERFVPROC)this->m_profiledFunctions[692]))(pname,values);this->profiler.end(692,profilingStart);}
+GLboolean m_glIsFramebufferEXT_profiling(GLuint framebuffer)const{auto const profilingStart=this->profiler.begin(693);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLISFRAMEBUFFEREXTPROC)this->m_profiledFunctions[693]))(framebuffer);this->profiler.end(693,profilingStart);return profilingResult;}
+void m_glTextureStorage2D_profiling(GLuint texture,GLsizei levels,GLenum internalformat,GLsizei width,GLsizei height)const{auto const profilingStart=this->profiler.begin(694);(this->*((FunctionTable::MEMBERPFNGLTEXTURESTORAGE2DPROC)this->m_profiledFunctions[694]))(texture,levels,internalformat,width,height);this->profiler.end(694,profilingStart);}
+void m_glProgramUniform1ui64ARB_profiling(GLuint program,GLint location,GLuint64 x)const{auto const profilingStart=this->profiler.begin(695);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UI64ARBPROC)this->m_profiledFunctions[695]))(program,location,x);this->profiler.end(695,profilingStart);}
+void m_glTexBufferRange_profiling(GLenum target,GLenum internalformat,GLuint buffer,GLintptr offset,GLsizeiptr size)const{auto const profilingStart=this->profiler.begin(696);(this->*((FunctionTable::MEMBERPFNGLTEXBUFFERRANGEPROC)this->m_profiledFunctions[696]))(target,internalformat,buffer,offset,size);this->profiler.end(696,profilingStart);}
+void m_glGetPixelTexGenParameterivSGIS_profiling(GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(697);(this->*((FunctionTable::MEMBERPFNGLGETPIXELTEXGENPARAMETERIVSGISPROC)this->m_profiledFunctions[697]))(pname,params);this->profiler.end(697,profilingStart);}
+void m_glTextureSubImage3DEXT_profiling(GLuint texture,GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLenum format,GLenum type,const void* pixels)const{auto const profilingStart=this->profiler.begin(698);(this->*((FunctionTable::MEMBERPFNGLTEXTURESUBIMAGE3DEXTPROC)this->m_profiledFunctions[698]))(texture,target,level,xoffset,yoffset,zoffset,width,height,depth,format,type,pixels);this->profiler.end(698,profilingStart);}
+void m_glClipControl_profiling(GLenum origin,GLenum depth)const{auto const profilingStart=this->profiler.begin(699);(this->*((FunctionTable::MEMBERPFNGLCLIPCONTROLPROC)this->m_profiledFunctions[699]))(origin,depth);this->profiler.end(699,profilingStart);}
+void m_glGetProgramResourceiv_profiling(GLuint program,GLenum programInterface,GLuint index,GLsizei propCount,const GLenum* props,GLsizei bufSize,GLsizei* length,GLint* params)const{auto const profilingStart=this->profiler.begin(700);(this->*((FunctionTable::MEMBERPFNGLGETPROGRAMRESOURCEIVPROC)this->m_profiledFunctions[700]))(program,programInterface,index,propCount,props,bufSize,length,params);this->profiler.end(700,profilingStart);}
+void m_glMultiTexCoordP2uiv_profiling(GLenum texture,GLenum type,const GLuint* coords)const{auto const profilingStart=this->profiler.begin(701);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORDP2UIVPROC)this->m_profiledFunctions[701]))(texture,type,coords);this->profiler.end(701,profilingStart);}
+void m_glVertexAttribI3ui_profiling(GLuint index,GLuint x,GLuint y,GLuint z)const{auto const profilingStart=this->profiler.begin(702);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBI3UIPROC)this->m_profiledFunctions[702]))(index,x,y,z);this->profiler.end(702,profilingStart);}
+void m_glSampleMaskSGIS_profiling(GLclampf value,GLboolean invert)const{auto const profilingStart=this->profiler.begin(703);(this->*((FunctionTable::MEMBERPFNGLSAMPLEMASKSGISPROC)this->m_profiledFunctions[703]))(value,invert);this->profiler.end(703,profilingStart);}
+void m_glVertexAttrib4NivARB_profiling(GLuint index,const GLint* v)const{auto const profilingStart=this->profiler.begin(704);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB4NIVARBPROC)this->m_profiledFunctions[704]))(index,v);this->profiler.end(704,profilingStart);}
+void m_glGlobalAlphaFactorfSUN_profiling(GLfloat factor)const{auto const profilingStart=this->profiler.begin(705);(this->*((FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORFSUNPROC)this->m_profiledFunctions[705]))(factor);this->profiler.end(705,profilingStart);}
+void m_glBlendEquationSeparateIndexedAMD_profiling(GLuint buf,GLenum modeRGB,GLenum modeAlpha)const{auto const profilingStart=this->profiler.begin(706);(this->*((FunctionTable::MEMBERPFNGLBLENDEQUATIONSEPARATEINDEXEDAMDPROC)this->m_profiledFunctions[706]))(buf,modeRGB,modeAlpha);this->profiler.end(706,profilingStart);}
+void m_glGetPerfCounterInfoINTEL_profiling(GLuint queryId,GLuint counterId,GLuint counterNameLength,GLchar* counterName,GLuint counterDescLength,GLchar* counterDesc,GLuint* counterOffset,GLuint* counterDataSize,GLuint* counterTypeEnum,GLuint* counterDataTypeEnum,GLuint64* rawCounterMaxValue)const{auto const profilingStart=this->profiler.begin(707);(this->*((FunctionTable::MEMBERPFNGLGETPERFCOUNTERINFOINTELPROC)this->m_profiledFunctions[707]))(queryId,counterId,counterNameLength,counterName,counterDescLength,counterDesc,counterOffset,counterDataSize,counterTypeEnum,counterDataTypeEnum,rawCounterMaxValue);this->profiler.end(707,profilingStart);}
+void m_glDeleteProgramsNV_profiling(GLsizei n,const GLuint* programs)const{auto const profilingStart=this->profiler.begin(708);(this->*((FunctionTable::MEMBERPFNGLDELETEPROGRAMSNVPROC)this->m_profiledFunctions[708]))(n,programs);this->profiler.end(708,profilingStart);}
+void m_glPixelZoomxOES_profiling(GLfixed xfactor,GLfixed yfactor)const{auto const profilingStart=this->profiler.begin(709);(this->*((FunctionTable::MEMBERPFNGLPIXELZOOMXOESPROC)this->m_profiledFunctions[709]))(xfactor,yfactor);this->profiler.end(709,profilingStart);}
+void m_glGetCombinerOutputParameterivNV_profiling(GLenum stage,GLenum portion,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(710);(this->*((FunctionTable::MEMBERPFNGLGETCOMBINEROUTPUTPARAMETERIVNVPROC)this->m_profiledFunctions[710]))(stage,portion,pname,params);this->profiler.end(710,profilingStart);}
+void m_glRasterPos2xvOES_profiling(const GLfixed* coords)const{auto const profilingStart=this->profiler.begin(711);(this->*((FunctionTable::MEMBERPFNGLRASTERPOS2XVOESPROC)this->m_profiledFunctions[711]))(coords);this->profiler.end(711,profilingStart);}
+void m_glGetTexImage_profiling(GLenum target,GLint level,GLenum format,GLenum type,GLvoid* pixels)const{auto const profilingStart=this->profiler.begin(712);(this->*((FunctionTable::MEMBERPFNGLGETTEXIMAGEPROC)this->m_profiledFunctions[712]))(target,level,format,type,pixels);this->profiler.end(712,profilingStart);}
+void m_glVertexArrayVertexBuffers_profiling(GLuint vaobj,GLuint first,GLsizei count,const GLuint* buffers,const GLintptr* offsets,const GLsizei* strides)const{auto const profilingStart=this->profiler.begin(713);(this->*((FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXBUFFERSPROC)this->m_profiledFunctions[713]))(vaobj,first,count,buffers,offsets,strides);this->profiler.end(713,profilingStart);}
+void m_glUniform1ui64NV_profiling(GLint location,GLuint64EXT x)const{auto const profilingStart=this->profiler.begin(714);(this->*((FunctionTable::MEMBERPFNGLUNIFORM1UI64NVPROC)this->m_profiledFunctions[714]))(location,x);this->profiler.end(714,profilingStart);}
+void m_glProgramParameteri_profiling(GLuint program,GLenum pname,GLint value)const{auto const profilingStart=this->profiler.begin(715);(this->*((FunctionTable::MEMBERPFNGLPROGRAMPARAMETERIPROC)this->m_profiledFunctions[715]))(program,pname,value);this->profiler.end(715,profilingStart);}
+void m_glNormal3xOES_profiling(GLfixed nx,GLfixed ny,GLfixed nz)const{auto const profilingStart=this->profiler.begin(716);(this->*((FunctionTable::MEMBERPFNGLNORMAL3XOESPROC)this->m_profiledFunctions[716]))(nx,ny,nz);this->profiler.end(716,profilingStart);}
+void m_glGetMapfv_profiling(GLenum target,GLenum query,GLfloat* v)const{auto const profilingStart=this->profiler.begin(717);(this->*((FunctionTable::MEMBERPFNGLGETMAPFVPROC)this->m_profiledFunctions[717]))(target,query,v);this->profiler.end(717,profilingStart);}
+void m_glVertexStream2dvATI_profiling(GLenum stream,const GLdouble* coords)const{auto const profilingStart=this->profiler.begin(718);(this->*((FunctionTable::MEMBERPFNGLVERTEXSTREAM2DVATIPROC)this->m_profiledFunctions[718]))(stream,coords);this->profiler.end(718,profilingStart);}
+void m_glPathStencilDepthOffsetNV_profiling(GLfloat factor,GLfloat units)const{auto const profilingStart=this->profiler.begin(719);(this->*((FunctionTable::MEMBERPFNGLPATHSTENCILDEPTHOFFSETNVPROC)this->m_profiledFunctions[719]))(factor,units);this->profiler.end(719,profilingStart);}
+GLboolean m_glIsStateNV_profiling(GLuint state)const{auto const profilingStart=this->profiler.begin(720);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLISSTATENVPROC)this->m_profiledFunctions[720]))(state);this->profiler.end(720,profilingStart);return profilingResult;}
+void m_glGetIntegerui64vNV_profiling(GLenum value,GLuint64EXT* result)const{auto const profilingStart=this->profiler.begin(721);(this->*((FunctionTable::MEMBERPFNGLGETINTEGERUI64VNVPROC)this->m_profiledFunctions[721]))(value,result);this->profiler.end(721,profilingStart);}
+void m_glGetImageTransformParameterfvHP_profiling(GLenum target,GLenum pname,GLfloat* params)const{auto const profilingStart=this->profiler.begin(722);(this->*((FunctionTable::MEMBERPFNGLGETIMAGETRANSFORMPARAMETERFVHPPROC)this->m_profiledFunctions[722]))(target,pname,params);this->profiler.end(722,profilingStart);}
+void m_glRasterPos2fv_profiling(const GLfloat* v)const{auto const profilingStart=this->profiler.begin(723);(this->*((FunctionTable::MEMBERPFNGLRASTERPOS2FVPROC)this->m_profiledFunctions[723]))(v);this->profiler.end(723,profilingStart);}
+void m_glVertex3xOES_profiling(GLfixed x,GLfixed y)const{auto const profilingStart=this->profiler.begin(724);(this->*((FunctionTable::MEMBERPFNGLVERTEX3XOESPROC)this->m_profiledFunctions[724]))(x,y);this->profiler.end(724,profilingStart);}
+void m_glProgramUniform2dvEXT_profiling(GLuint program,GLint location,GLsizei count,const GLdouble* value)const{auto const profilingStart=this->profiler.begin(725);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2DVEXTPROC)this->m_profiledFunctions[725]))(program,location,count,value);this->profiler.end(725,profilingStart);}
+void m_glWeightPointerARB_profiling(GLint size,GLenum type,GLsizei stride,const void* pointer)const{auto const profilingStart=this->profiler.begin(726);(this->*((FunctionTable::MEMBERPFNGLWEIGHTPOINTERARBPROC)this->m_profiledFunctions[726]))(size,type,stride,pointer);this->profiler.end(726,profilingStart);}
+void m_glFinishFenceNV_profiling(GLuint fence)const{auto const profilingStart=this->profiler.begin(727);(this->*((FunctionTable::MEMBERPFNGLFINISHFENCENVPROC)this->m_profiledFunctions[727]))(fence);this->profiler.end(727,profilingStart);}
+void m_glDepthRangexOES_profiling(GLfixed n,GLfixed f)const{auto const profilingStart=this->profiler.begin(728);(this->*((FunctionTable::MEMBERPFNGLDEPTHRANGEXOESPROC)this->m_profiledFunctions[728]))(n,f);this->profiler.end(728,profilingStart);}
+void m_glEnableVertexArrayAttribEXT_profiling(GLuint vaobj,GLuint index)const{auto const profilingStart=this->profiler.begin(729);(this->*((FunctionTable::MEMBERPFNGLENABLEVERTEXARRAYATTRIBEXTPROC)this->m_profiledFunctions[729]))(vaobj,index);this->profiler.end(729,profilingStart);}
+void m_glProgramUniform2uivEXT_profiling(GLuint program,GLint location,GLsizei count,const GLuint* value)const{auto const profilingStart=this->profiler.begin(730);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UIVEXTPROC)this->m_profiledFunctions[730]))(program,location,count,value);this->profiler.end(730,profilingStart);}
+void m_glGetDoubleIndexedvEXT_profiling(GLenum target,GLuint index,GLdouble* data)const{auto const profilingStart=this->profiler.begin(731);(this->*((FunctionTable::MEMBERPFNGLGETDOUBLEINDEXEDVEXTPROC)this->m_profiledFunctions[731]))(target,index,data);this->profiler.end(731,profilingStart);}
+void m_glWindowPos2fMESA_profiling(GLfloat x,GLfloat y)const{auto const profilingStart=this->profiler.begin(732);(this->*((FunctionTable::MEMBERPFNGLWINDOWPOS2FMESAPROC)this->m_profiledFunctions[732]))(x,y);this->profiler.end(732,profilingStart);}
+void m_glSecondaryColor3b_profiling(GLbyte red,GLbyte green,GLbyte blue)const{auto const profilingStart=this->profiler.begin(733);(this->*((FunctionTable::MEMBERPFNGLSECONDARYCOLOR3BPROC)this->m_profiledFunctions[733]))(red,green,blue);this->profiler.end(733,profilingStart);}
+void m_glCopyConvolutionFilter1DEXT_profiling(GLenum target,GLenum internalformat,GLint x,GLint y,GLsizei width)const{auto const profilingStart=this->profiler.begin(734);(this->*((FunctionTable::MEMBERPFNGLCOPYCONVOLUTIONFILTER1DEXTPROC)this->m_profiledFunctions[734]))(target,internalformat,x,y,width);this->profiler.end(734,profilingStart);}
+void m_glWindowPos2sv_profiling(const GLshort* v)const{auto const profilingStart=this->profiler.begin(735);(this->*((FunctionTable::MEMBERPFNGLWINDOWPOS2SVPROC)this->m_profiledFunctions[735]))(v);this->profiler.end(735,profilingStart);}
+void m_glBindFramebufferEXT_profiling(GLenum target,GLuint framebuffer)const{auto const profilingStart=this->profiler.begin(736);(this->*((FunctionTable::MEMBERPFNGLBINDFRAMEBUFFEREXTPROC)this->m_profiledFunctions[736]))(target,framebuffer);this->profiler.end(736,profilingStart);}
+GLuint m_glCreateShader_profiling(GLenum type)const{auto const profilingStart=this->profiler.begin(737);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLCREATESHADERPROC)this->m_profiledFunctions[737]))(type);this->profiler.end(737,profilingStart);return profilingResult;}
+GLuint m_glGenPathsNV_profiling(GLsizei range)const{auto const profilingStart=this->profiler.begin(738);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLGENPATHSNVPROC)this->m_profiledFunctions[738]))(range);this->profiler.end(738,profilingStart);return profilingResult;}
+void m_glGenRenderbuffers_profiling(GLsizei n,GLuint* renderbuffers)const{auto const profilingStart=this->profiler.begin(739);(this->*((FunctionTable::MEMBERPFNGLGENRENDERBUFFERSPROC)this->m_profiledFunctions[739]))(n,renderbuffers);this->profiler.end(739,profilingStart);}
+void m_glCopyTexSubImage2D_profiling(GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint x,GLint y,GLsizei width,GLsizei height)const{auto const profilingStart=this->profiler.begin(740);(this->*((FunctionTable::MEMBERPFNGLCOPYTEXSUBIMAGE2DPROC)this->m_profiledFunctions[740]))(target,level,xoffset,yoffset,x,y,width,height);this->profiler.end(740,profilingStart);}
+void m_glVertexAttrib4ubvARB_profiling(GLuint index,const GLubyte* v)const{auto const profilingStart=this->profiler.begin(741);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB4UBVARBPROC)this->m_profiledFunctions[741]))(index,v);this->profiler.end(741,profilingStart);}
+void m_glDrawTextureNV_profiling(GLuint texture,GLuint sampler,GLfloat x0,GLfloat y0,GLfloat x1,GLfloat y1,GLfloat z,GLfloat s0,GLfloat t0,GLfloat s1,GLfloat t1)const{auto const profilingStart=this->profiler.begin(742);(this->*((FunctionTable::MEMBERPFNGLDRAWTEXTURENVPROC)this->m_profiledFunctions[742]))(texture,sampler,x0,y0,x1,y1,z,s0,t0,s1,t1);this->profiler.end(742,profilingStart);}
+void m_glVertexAttribs1svNV_profiling(GLuint index,GLsizei count,const GLshort* v)const{auto const profilingStart=this->profiler.begin(743);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBS1SVNVPROC)this->m_profiledFunctions[743]))(index,count,v);this->profiler.end(743,profilingStart);}
+void m_glClearNamedBufferSubDataEXT_profiling(GLuint buffer,GLenum internalformat,GLsizeiptr offset,GLsizeiptr size,GLenum format,GLenum type,const void* data)const{auto const profilingStart=this->profiler.begin(744);(this->*((FunctionTable::MEMBERPFNGLCLEARNAMEDBUFFERSUBDATAEXTPROC)this->m_profiledFunctions[744]))(buffer,internalformat,offset,size,format,type,data);this->profiler.end(744,profilingStart);}
+void m_glBlendFuncSeparate_profiling(GLenum sfactorRGB,GLenum dfactorRGB,GLenum sfactorAlpha,GLenum dfactorAlpha)const{auto const profilingStart=this->profiler.begin(745);(this->*((FunctionTable::MEMBERPFNGLBLENDFUNCSEPARATEPROC)this->m_profiledFunctions[745]))(sfactorRGB,dfactorRGB,sfactorAlpha,dfactorAlpha);this->profiler.end(745,profilingStart);}
+void m_glPointParameterfARB_profiling(GLenum pname,GLfloat param)const{auto const profilingStart=this->profiler.begin(746);(this->*((FunctionTable::MEMBERPFNGLPOINTPARAMETERFARBPROC)this->m_profiledFunctions[746]))(pname,param);this->profiler.end(746,profilingStart);}
+void m_glTexCoord2fv_profiling(const GLfloat* v)const{auto const profilingStart=this->profiler.begin(747);(this->*((FunctionTable::MEMBERPFNGLTEXCOORD2FVPROC)this->m_profiledFunctions[747]))(v);this->profiler.end(747,profilingStart);}
+void m_glGetVariantFloatvEXT_profiling(GLuint id,GLenum value,GLfloat* data)const{auto const profilingStart=this->profiler.begin(748);(this->*((FunctionTable::MEMBERPFNGLGETVARIANTFLOATVEXTPROC)this->m_profiledFunctions[748]))(id,value,data);this->profiler.end(748,profilingStart);}
+void m_glVertexP2ui_profiling(GLenum type,GLuint value)const{auto const profilingStart=this->profiler.begin(749);(this->*((FunctionTable::MEMBERPFNGLVERTEXP2UIPROC)this->m_profiledFunctions[749]))(type,value);this->profiler.end(749,profilingStart);}
+void m_glWindowPos2dMESA_profiling(GLdouble x,GLdouble y)const{auto const profilingStart=this->profiler.begin(750);(this->*((FunctionTable::MEMBERPFNGLWINDOWPOS2DMESAPROC)this->m_profiledFunctions[750]))(x,y);this->profiler.end(750,profilingStart);}
+void m_glTexCoord4fv_profiling(const GLfloat* v)const{auto const profilingStart=this->profiler.begin(751);(this->*((FunctionTable::MEMBERPFNGLTEXCOORD4FVPROC)this->m_profiledFunctions[751]))(v);this->profiler.end(751,profilingStart);}
+void m_glBindFragDataLocationEXT_profiling(GLuint program,GLuint color,const GLchar* name)const{auto const profilingStart=this->profiler.begin(752);(this->*((FunctionTable::MEMBERPFNGLBINDFRAGDATALOCATIONEXTPROC)this->m_profiledFunctions[752]))(program,color,name);this->profiler.end(752,profilingStart);}
+void m_glCompressedTexSubImage1DARB_profiling(GLenum target,GLint level,GLint xoffset,GLsizei width,GLenum format,GLsizei imageSize,const void* data)const{auto const profilingStart=this->profiler.begin(753);(this->*((FunctionTable::MEMBERPFNGLCOMPRESSEDTEXSUBIMAGE1DARBPROC)this->m_profiledFunctions[753]))(target,level,xoffset,width,format,imageSize,data);this->profiler.end(753,profilingStart);}
+void m_glGetTextureImageEXT_profiling(GLuint texture,GLenum target,GLint level,GLenum format,GLenum type,void* pixels)const{auto const profilingStart=this->profiler.begin(754);(this->*((FunctionTable::MEMBERPFNGLGETTEXTUREIMAGEEXTPROC)this->m_profiledFunctions[754]))(texture,target,level,format,type,pixels);this->profiler.end(754,profilingStart);}
+void m_glFogCoordd_profiling(GLdouble coord)const{auto const profilingStart=this->profiler.begin(755);(this->*((FunctionTable::MEMBERPFNGLFOGCOORDDPROC)this->m_profiledFunctions[755]))(coord);this->profiler.end(755,profilingStart);}
+void m_glPointSize_profiling(GLfloat size)const{auto const profilingStart=this->profiler.begin(756);(this->*((FunctionTable::MEMBERPFNGLPOINTSIZEPROC)this->m_profiledFunctions[756]))(size);this->profiler.end(756,profilingStart);}
+void m_glBindTextureUnit_profiling(GLuint unit,GLuint texture)const{auto const profilingStart=this->profiler.begin(757);(this->*((FunctionTable::MEMBERPFNGLBINDTEXTUREUNITPROC)this->m_profiledFunctions[757]))(unit,texture);this->profiler.end(757,profilingStart);}
+void m_glProgramEnvParameterI4uiNV_profiling(GLenum target,GLuint index,GLuint x,GLuint y,GLuint z,GLuint w)const{auto const profilingStart=this->profiler.begin(758);(this->*((FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERI4UINVPROC)this->m_profiledFunctions[758]))(target,index,x,y,z,w);this->profiler.end(758,profilingStart);}
+void m_glGetProgramPipelineInfoLog_profiling(GLuint pipeline,GLsizei bufSize,GLsizei* length,GLchar* infoLog)const{auto const profilingStart=this->profiler.begin(759);(this->*((FunctionTable::MEMBERPFNGLGETPROGRAMPIPELINEINFOLOGPROC)this->m_profiledFunctions[759]))(pipeline,bufSize,length,infoLog);this->profiler.end(759,profilingStart);}
+void m_glProgramUniform4i64vARB_profiling(GLuint program,GLint location,GLsizei count,const GLint64* value)const{auto const profilingStart=this->profiler.begin(760);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4I64VARBPROC)this->m_profiledFunctions[760]))(program,location,count,value);this->profiler.end(760,profilingStart);}
+void m_glVertexAttrib4Nuiv_profiling(GLuint index,const GLuint* v)const{auto const profilingStart=this->profiler.begin(761);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUIVPROC)this->m_profiledFunctions[761]))(index,v);this->profiler.end(761,profilingStart);}
+void m_glGetUniformfvARB_profiling(GLhandleARB programObj,GLint location,GLfloat* params)const{auto const profilingStart=this->profiler.begin(762);(this->*((FunctionTable::MEMBERPFNGLGETUNIFORMFVARBPROC)this->m_profiledFunctions[762]))(programObj,location,params);this->profiler.end(762,profilingStart);}
+void m_glWaitSync_profiling(GLsync sync,GLbitfield flags,GLuint64 timeout)const{auto const profilingStart=this->profiler.begin(763);(this->*((FunctionTable::MEMBERPFNGLWAITSYNCPROC)this->m_profiledFunctions[763]))(sync,flags,timeout);this->profiler.end(763,profilingStart);}
+void m_glUniform3i_profiling(GLint location,GLint v0,GLint v1,GLint v2)const{auto const profilingStart=this->profiler.begin(764);(this->*((FunctionTable::MEMBERPFNGLUNIFORM3IPROC)this->m_profiledFunctions[764]))(location,v0,v1,v2);this->profiler.end(764,profilingStart);}
+void m_glBlendEquationSeparatei_profiling(GLuint buf,GLenum modeRGB,GLenum modeAlpha)const{auto const profilingStart=this->profiler.begin(765);(this->*((FunctionTable::MEMBERPFNGLBLENDEQUATIONSEPARATEIPROC)this->m_profiledFunctions[765]))(buf,modeRGB,modeAlpha);this->profiler.end(765,profilingStart);}
+void m_glVertexAttrib2hvNV_profiling(GLuint index,const GLhalfNV* v)const{auto const profilingStart=this->profiler.begin(766);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB2HVNVPROC)this->m_profiledFunctions[766]))(index,v);this->profiler.end(766,profilingStart);}
+void m_glTextureParameterivEXT_profiling(GLuint texture,GLenum target,GLenum pname,const GLint* params)const{auto const profilingStart=this->profiler.begin(767);(this->*((FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIVEXTPROC)this->m_profiledFunctions[767]))(texture,target,pname,params);this->profiler.end(767,profilingStart);}
+void m_glUniform3d_profiling(GLint location,GLdouble x,GLdouble y,GLdouble z)const{auto const profilingStart=this->profiler.begin(768);(this->*((FunctionTable::MEMBERPFNGLUNIFORM3DPROC)this->m_profiledFunctions[768]))(location,x,y,z);this->profiler.end(768,profilingStart);}
+void m_glUniform3f_profiling(GLint location,GLfloat v0,GLfloat v1,GLfloat v2)const{auto const profilingStart=this->profiler.begin(769);(this->*((FunctionTable::MEMBERPFNGLUNIFORM3FPROC)this->m_profiledFunctions[769]))(location,v0,v1,v2);this->profiler.end(769,profilingStart);}
+void m_glActiveProgramEXT_profiling(GLuint program)const{auto const profilingStart=this->profiler.begin(770);(this->*((FunctionTable::MEMBERPFNGLACTIVEPROGRAMEXTPROC)this->m_profiledFunctions[770]))(program);this->profiler.end(770,profilingStart);}
+void m_glDeleteVertexArrays_profiling(GLsizei n,const GLuint* arrays)const{auto const profilingStart=this->profiler.begin(771);(this->*((FunctionTable::MEMBERPFNGLDELETEVERTEXARRAYSPROC)this->m_profiledFunctions[771]))(n,arrays);this->profiler.end(771,profilingStart);}
+void m_glUniform3ui64vARB_profiling(GLint location,GLsizei count,const GLuint64* value)const{auto const profilingStart=this->profiler.begin(772);(this->*((FunctionTable::MEMBERPFNGLUNIFORM3UI64VARBPROC)this->m_profiledFunctions[772]))(location,count,value);this->profiler.end(772,profilingStart);}
+void m_glProgramUniform1ui64vARB_profiling(GLuint program,GLint location,GLsizei count,const GLuint64* value)const{auto const profilingStart=this->profiler.begin(773);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UI64VARBPROC)this->m_profiledFunctions[773]))(program,location,count,value);this->profiler.end(773,profilingStart);}
+void m_glTextureParameterfEXT_profiling(GLuint texture,GLenum target,GLenum pname,GLfloat param)const{auto const profilingStart=this->profiler.begin(774);(this->*((FunctionTable::MEMBERPFNGLTEXTUREPARAMETERFEXTPROC)this->m_profiledFunctions[774]))(texture,target,pname,param);this->profiler.end(774,profilingStart);}
+void m_glSetFragmentShaderConstantATI_profiling(GLuint dst,const GLfloat* value)const{auto const profilingStart=this->profiler.begin(775);(this->*((FunctionTable::MEMBERPFNGLSETFRAGMENTSHADERCONSTANTATIPROC)this->m_profiledFunctions[775]))(dst,value);this->profiler.end(775,profilingStart);}
+void m_glColorSubTable_profiling(GLenum target,GLsizei start,GLsizei count,GLenum format,GLenum type,const GLvoid* data)const{auto const profilingStart=this->profiler.begin(776);(this->*((FunctionTable::MEMBERPFNGLCOLORSUBTABLEPROC)this->m_profiledFunctions[776]))(target,start,count,format,type,data);this->profiler.end(776,profilingStart);}
+void m_glReplacementCodeuiSUN_profiling(GLuint code)const{auto const profilingStart=this->profiler.begin(777);(this->*((FunctionTable::MEMBERPFNGLREPLACEMENTCODEUISUNPROC)this->m_profiledFunctions[777]))(code);this->profiler.end(777,profilingStart);}
+void m_glStateCaptureNV_profiling(GLuint state,GLenum mode)const{auto const profilingStart=this->profiler.begin(778);(this->*((FunctionTable::MEMBERPFNGLSTATECAPTURENVPROC)this->m_profiledFunctions[778]))(state,mode);this->profiler.end(778,profilingStart);}
+void m_glBindAttribLocation_profiling(GLuint program,GLuint index,const GLchar* name)const{auto const profilingStart=this->profiler.begin(779);(this->*((FunctionTable::MEMBERPFNGLBINDATTRIBLOCATIONPROC)this->m_profiledFunctions[779]))(program,index,name);this->profiler.end(779,profilingStart);}
+void m_glWeightusvARB_profiling(GLint size,const GLushort* weights)const{auto const profilingStart=this->profiler.begin(780);(this->*((FunctionTable::MEMBERPFNGLWEIGHTUSVARBPROC)this->m_profiledFunctions[780]))(size,weights);this->profiler.end(780,profilingStart);}
+GLint m_glGetFragDataIndex_profiling(GLuint program,const GLchar* name)const{auto const profilingStart=this->profiler.begin(781);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLGETFRAGDATAINDEXPROC)this->m_profiledFunctions[781]))(program,name);this->profiler.end(781,profilingStart);return profilingResult;}
+void m_glMultiTexCoord2xOES_profiling(GLenum texture,GLfixed s,GLfixed t)const{auto const profilingStart=this->profiler.begin(782);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD2XOESPROC)this->m_profiledFunctions[782]))(texture,s,t);this->profiler.end(782,profilingStart);}
+void m_glColor3sv_profiling(const GLshort* v)const{auto const profilingStart=this->profiler.begin(783);(this->*((FunctionTable::MEMBERPFNGLCOLOR3SVPROC)this->m_profiledFunctions[783]))(v);this->profiler.end(783,profilingStart);}
+void m_glTexCoord2fVertex3fSUN_profiling(GLfloat s,GLfloat t,GLfloat x,GLfloat y,GLfloat z)const{auto const profilingStart=this->profiler.begin(784);(this->*((FunctionTable::MEMBERPFNGLTEXCOORD2FVERTEX3FSUNPROC)this->m_profiledFunctions[784]))(s,t,x,y,z);this->profiler.end(784,profilingStart);}
+void m_glPolygonOffsetEXT_profiling(GLfloat factor,GLfloat bias)const{auto const profilingStart=this->profiler.begin(785);(this->*((FunctionTable::MEMBERPFNGLPOLYGONOFFSETEXTPROC)this->m_profiledFunctions[785]))(factor,bias);this->profiler.end(785,profilingStart);}
+void m_glWeightPathsNV_profiling(GLuint resultPath,GLsizei numPaths,const GLuint* paths,const GLfloat* weights)const{auto const profilingStart=this->profiler.begin(786);(this->*((FunctionTable::MEMBERPFNGLWEIGHTPATHSNVPROC)this->m_profiledFunctions[786]))(resultPath,numPaths,paths,weights);this->profiler.end(786,profilingStart);}
+void m_glCombinerStageParameterfvNV_profiling(GLenum stage,GLenum pname,const GLfloat* params)const{auto const profilingStart=this->profiler.begin(787);(this->*((FunctionTable::MEMBERPFNGLCOMBINERSTAGEPARAMETERFVNVPROC)this->m_profiledFunctions[787]))(stage,pname,params);this->profiler.end(787,profilingStart);}
+void m_glPointParameterfEXT_profiling(GLenum pname,GLfloat param)const{auto const profilingStart=this->profiler.begin(788);(this->*((FunctionTable::MEMBERPFNGLPOINTPARAMETERFEXTPROC)this->m_profiledFunctions[788]))(pname,param);this->profiler.end(788,profilingStart);}
+void m_glCopyTexImage1DEXT_profiling(GLenum target,GLint level,GLenum internalformat,GLint x,GLint y,GLsizei width,GLint border)const{auto const profilingStart=this->profiler.begin(789);(this->*((FunctionTable::MEMBERPFNGLCOPYTEXIMAGE1DEXTPROC)this->m_profiledFunctions[789]))(target,level,internalformat,x,y,width,border);this->profiler.end(789,profilingStart);}
+void m_glVertex4sv_profiling(const GLshort* v)const{auto const profilingStart=this->profiler.begin(790);(this->*((FunctionTable::MEMBERPFNGLVERTEX4SVPROC)this->m_profiledFunctions[790]))(v);this->profiler.end(790,profilingStart);}
+void m_glMatrixMultfEXT_profiling(GLenum mode,const GLfloat* m)const{auto const profilingStart=this->profiler.begin(791);(this->*((FunctionTable::MEMBERPFNGLMATRIXMULTFEXTPROC)this->m_profiledFunctions[791]))(mode,m);this->profiler.end(791,profilingStart);}
+void m_glCompressedTextureSubImage3DEXT_profiling(GLuint texture,GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLenum format,GLsizei imageSize,const void* bits)const{auto const profilingStart=this->profiler.begin(792);(this->*((FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTURESUBIMAGE3DEXTPROC)this->m_profiledFunctions[792]))(texture,target,level,xoffset,yoffset,zoffset,width,height,depth,format,imageSize,bits);this->profiler.end(792,profilingStart);}
+void m_glGetTexLevelParameterxvOES_profiling(GLenum target,GLint level,GLenum pname,GLfixed* params)const{auto const profilingStart=this->profiler.begin(793);(this->*((FunctionTable::MEMBERPFNGLGETTEXLEVELPARAMETERXVOESPROC)this->m_profiledFunctions[793]))(target,level,pname,params);this->profiler.end(793,profilingStart);}
+void m_glVertexAttribL3dvEXT_profiling(GLuint index,const GLdouble* v)const{auto const profilingStart=this->profiler.begin(794);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBL3DVEXTPROC)this->m_profiledFunctions[794]))(index,v);this->profiler.end(794,profilingStart);}
+void m_glMultiTexCoordP4ui_profiling(GLenum texture,GLenum type,GLuint coords)const{auto const profilingStart=this->profiler.begin(795);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORDP4UIPROC)this->m_profiledFunctions[795]))(texture,type,coords);this->profiler.end(795,profilingStart);}
+void m_glGetTextureLevelParameterivEXT_profiling(GLuint texture,GLenum target,GLint level,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(796);(this->*((FunctionTable::MEMBERPFNGLGETTEXTURELEVELPARAMETERIVEXTPROC)this->m_profiledFunctions[796]))(texture,target,level,pname,params);this->profiler.end(796,profilingStart);}
+void m_glAlphaFragmentOp2ATI_profiling(GLenum op,GLuint dst,GLuint dstMod,GLuint arg1,GLuint arg1Rep,GLuint arg1Mod,GLuint arg2,GLuint arg2Rep,GLuint arg2Mod)const{auto const profilingStart=this->profiler.begin(797);(this->*((FunctionTable::MEMBERPFNGLALPHAFRAGMENTOP2ATIPROC)this->m_profiledFunctions[797]))(op,dst,dstMod,arg1,arg1Rep,arg1Mod,arg2,arg2Rep,arg2Mod);this->profiler.end(797,profilingStart);}
+void m_glDeleteFramebuffers_profiling(GLsizei n,const GLuint* framebuffers)const{auto const profilingStart=this->profiler.begin(798);(this->*((FunctionTable::MEMBERPFNGLDELETEFRAMEBUFFERSPROC)this->m_profiledFunctions[798]))(n,framebuffers);this->profiler.end(798,profilingStart);}
+void m_glDrawArrays_profiling(GLenum mode,GLint first,GLsizei count)const{auto const profilingStart=this->profiler.begin(799);(this->*((FunctionTable::MEMBERPFNGLDRAWARRAYSPROC)this->m_profiledFunctions[799]))(mode,first,count);this->profiler.end(799,profilingStart);}
+void m_glGetTransformFeedbackiv_profiling(GLuint xfb,GLenum pname,GLint* param)const{auto const profilingStart=this->profiler.begin(800);(this->*((FunctionTable::MEMBERPFNGLGETTRANSFORMFEEDBACKIVPROC)this->m_profiledFunctions[800]))(xfb,pname,param);this->profiler.end(800,profilingStart);}
+void m_glGetnTexImageARB_profiling(GLenum target,GLint level,GLenum format,GLenum type,GLsizei bufSize,void* img)const{auto const profilingStart=this->profiler.begin(801);(this->*((FunctionTable::MEMBERPFNGLGETNTEXIMAGEARBPROC)this->m_profiledFunctions[801]))(target,level,format,type,bufSize,img);this->profiler.end(801,profilingStart);}
+void m_glClear_profiling(GLbitfield mask)const{auto const profilingStart=this->profiler.begin(802);(this->*((FunctionTable::MEMBERPFNGLCLEARPROC)this->m_profiledFunctions[802]))(mask);this->profiler.end(802,profilingStart);}
+void m_glVertexArrayParameteriAPPLE_profiling(GLenum pname,GLint param)const{auto const profilingStart=this->profiler.begin(803);(this->*((FunctionTable::MEMBERPFNGLVERTEXARRAYPARAMETERIAPPLEPROC)this->m_profiledFunctions[803]))(pname,param);this->profiler.end(803,profilingStart);}
+void m_glMultiTexCoord2dvARB_profiling(GLenum target,const GLdouble* v)const{auto const profilingStart=this->profiler.begin(804);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD2DVARBPROC)this->m_profiledFunctions[804]))(target,v);this->profiler.end(804,profilingStart);}
+void m_glGetVideoCaptureStreamdvNV_profiling(GLuint video_capture_slot,GLuint stream,GLenum pname,GLdouble* params)const{auto const profilingStart=this->profiler.begin(805);(this->*((FunctionTable::MEMBERPFNGLGETVIDEOCAPTURESTREAMDVNVPROC)this->m_profiledFunctions[805]))(video_capture_slot,stream,pname,params);this->profiler.end(805,profilingStart);}
+void m_glFragmentLightModelivSGIX_profiling(GLenum pname,const GLint* params)const{auto const profilingStart=this->profiler.begin(806);(this->*((FunctionTable::MEMBERPFNGLFRAGMENTLIGHTMODELIVSGIXPROC)this->m_profiledFunctions[806]))(pname,params);this->profiler.end(806,profilingStart);}
+void m_glVertexAttribP2ui_profiling(GLuint index,GLenum type,GLboolean normalized,GLuint value)const{auto const profilingStart=this->profiler.begin(807);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBP2UIPROC)this->m_profiledFunctions[807]))(index,type,normalized,value);this->profiler.end(807,profilingStart);}
+void m_glMultiTexCoordPointerEXT_profiling(GLenum texunit,GLint size,GLenum type,GLsizei stride,const void* pointer)const{auto const profilingStart=this->profiler.begin(808);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORDPOINTEREXTPROC)this->m_profiledFunctions[808]))(texunit,size,type,stride,pointer);this->profiler.end(808,profilingStart);}
+void m_glProgramUniform3iEXT_profiling(GLuint program,GLint location,GLint v0,GLint v1,GLint v2)const{auto const profilingStart=this->profiler.begin(809);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3IEXTPROC)this->m_profiledFunctions[809]))(program,location,v0,v1,v2);this->profiler.end(809,profilingStart);}
+void m_glTranslatef_profiling(GLfloat x,GLfloat y,GLfloat z)const{auto const profilingStart=this->profiler.begin(810);(this->*((FunctionTable::MEMBERPFNGLTRANSLATEFPROC)this->m_profiledFunctions[810]))(x,y,z);this->profiler.end(810,profilingStart);}
+void m_glVertexAttrib4Nub_profiling(GLuint index,GLubyte x,GLubyte y,GLubyte z,GLubyte w)const{auto const profilingStart=this->profiler.begin(811);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUBPROC)this->m_profiledFunctions[811]))(index,x,y,z,w);this->profiler.end(811,profilingStart);}
+void m_glTranslated_profiling(GLdouble x,GLdouble y,GLdouble z)const{auto const profilingStart=this->profiler.begin(812);(this->*((FunctionTable::MEMBERPFNGLTRANSLATEDPROC)this->m_profiledFunctions[812]))(x,y,z);this->profiler.end(812,profilingStart);}
+void m_glSamplerParameterIiv_profiling(GLuint sampler,GLenum pname,const GLint* param)const{auto const profilingStart=this->profiler.begin(813);(this->*((FunctionTable::MEMBERPFNGLSAMPLERPARAMETERIIVPROC)this->m_profiledFunctions[813]))(sampler,pname,param);this->profiler.end(813,profilingStart);}
+void m_glTexCoord4hNV_profiling(GLhalfNV s,GLhalfNV t,GLhalfNV r,GLhalfNV q)const{auto const profilingStart=this->profiler.begin(814);(this->*((FunctionTable::MEMBERPFNGLTEXCOORD4HNVPROC)this->m_profiledFunctions[814]))(s,t,r,q);this->profiler.end(814,profilingStart);}
+void m_glDrawElementsIndirect_profiling(GLenum mode,GLenum type,const void* indirect)const{auto const profilingStart=this->profiler.begin(815);(this->*((FunctionTable::MEMBERPFNGLDRAWELEMENTSINDIRECTPROC)this->m_profiledFunctions[815]))(mode,type,indirect);this->profiler.end(815,profilingStart);}
+void m_glDeletePerfMonitorsAMD_profiling(GLsizei n,GLuint* monitors)const{auto const profilingStart=this->profiler.begin(816);(this->*((FunctionTable::MEMBERPFNGLDELETEPERFMONITORSAMDPROC)this->m_profiledFunctions[816]))(n,monitors);this->profiler.end(816,profilingStart);}
+GLboolean m_glIsRenderbufferEXT_profiling(GLuint renderbuffer)const{auto const profilingStart=this->profiler.begin(817);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLISRENDERBUFFEREXTPROC)this->m_profiledFunctions[817]))(renderbuffer);this->profiler.end(817,profilingStart);return profilingResult;}
+void m_glDrawCommandsNV_profiling(GLenum primitiveMode,GLuint buffer,const GLintptr* indirects,const GLsizei* sizes,GLuint count)const{auto const profilingStart=this->profiler.begin(818);(this->*((FunctionTable::MEMBERPFNGLDRAWCOMMANDSNVPROC)this->m_profiledFunctions[818]))(primitiveMode,buffer,indirects,sizes,count);this->profiler.end(818,profilingStart);}
+void m_glUniform3ivARB_profiling(GLint location,GLsizei count,const GLint* value)const{auto const profilingStart=this->profiler.begin(819);(this->*((FunctionTable::MEMBERPFNGLUNIFORM3IVARBPROC)this->m_profiledFunctions[819]))(location,count,value);this->profiler.end(819,profilingStart);}
+void m_glBufferSubData_profiling(GLenum target,GLintptr offset,GLsizeiptr size,const void* data)const{auto const profilingStart=this->profiler.begin(820);(this->*((FunctionTable::MEMBERPFNGLBUFFERSUBDATAPROC)this->m_profiledFunctions[820]))(target,offset,size,data);this->profiler.end(820,profilingStart);}
+void m_glSecondaryColor3bv_profiling(const GLbyte* v)const{auto const profilingStart=this->profiler.begin(821);(this->*((FunctionTable::MEMBERPFNGLSECONDARYCOLOR3BVPROC)this->m_profiledFunctions[821]))(v);this->profiler.end(821,profilingStart);}
+void m_glMatrixMultTransposedEXT_profiling(GLenum mode,const GLdouble* m)const{auto const profilingStart=this->profiler.begin(822);(this->*((FunctionTable::MEMBERPFNGLMATRIXMULTTRANSPOSEDEXTPROC)this->m_profiledFunctions[822]))(mode,m);this->profiler.end(822,profilingStart);}
+void m_glRequestResidentProgramsNV_profiling(GLsizei n,const GLuint* programs)const{auto const profilingStart=this->profiler.begin(823);(this->*((FunctionTable::MEMBERPFNGLREQUESTRESIDENTPROGRAMSNVPROC)this->m_profiledFunctions[823]))(n,programs);this->profiler.end(823,profilingStart);}
+void m_glAlphaFragmentOp1ATI_profiling(GLenum op,GLuint dst,GLuint dstMod,GLuint arg1,GLuint arg1Rep,GLuint arg1Mod)const{auto const profilingStart=this->profiler.begin(824);(this->*((FunctionTable::MEMBERPFNGLALPHAFRAGMENTOP1ATIPROC)this->m_profiledFunctions[824]))(op,dst,dstMod,arg1,arg1Rep,arg1Mod);this->profiler.end(824,profilingStart);}
+void m_glGetQueryObjecti64v_profiling(GLuint id,GLenum pname,GLint64* params)const{auto const profilingStart=this->profiler.begin(825);(this->*((FunctionTable::MEMBERPFNGLGETQUERYOBJECTI64VPROC)this->m_profiledFunctions[825]))(id,pname,params);this->profiler.end(825,profilingStart);}
+void m_glMatrixMult3x3fNV_profiling(GLenum matrixMode,const GLfloat* m)const{auto const profilingStart=this->profiler.begin(826);(this->*((FunctionTable::MEMBERPFNGLMATRIXMULT3X3FNVPROC)this->m_profiledFunctions[826]))(matrixMode,m);this->profiler.end(826,profilingStart);}
+void m_glColorTableParameteriv_profiling(GLenum target,GLenum pname,const GLint* params)const{auto const profilingStart=this->profiler.begin(827);(this->*((FunctionTable::MEMBERPFNGLCOLORTABLEPARAMETERIVPROC)this->m_profiledFunctions[827]))(target,pname,params);this->profiler.end(827,profilingStart);}
+void m_glPathSubCommandsNV_profiling(GLuint path,GLsizei commandStart,GLsizei commandsToDelete,GLsizei numCommands,const GLubyte* commands,GLsizei numCoords,GLenum coordType,const void* coords)const{auto const profilingStart=this->profiler.begin(828);(this->*((FunctionTable::MEMBERPFNGLPATHSUBCOMMANDSNVPROC)this->m_profiledFunctions[828]))(path,commandStart,commandsToDelete,numCommands,commands,numCoords,coordType,coords);this->profiler.end(828,profilingStart);}
+void m_glGetFinalCombinerInputParameterivNV_profiling(GLenum variable,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(829);(this->*((FunctionTable::MEMBERPFNGLGETFINALCOMBINERINPUTPARAMETERIVNVPROC)this->m_profiledFunctions[829]))(variable,pname,params);this->profiler.end(829,profilingStart);}
+GLboolean m_glIsRenderbuffer_profiling(GLuint renderbuffer)const{auto const profilingStart=this->profiler.begin(830);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLISRENDERBUFFERPROC)this->m_profiledFunctions[830]))(renderbuffer);this->profiler.end(830,profilingStart);return profilingResult;}
+void m_glVertex3iv_profiling(const GLint* v)const{auto const profilingStart=this->profiler.begin(831);(this->*((FunctionTable::MEMBERPFNGLVERTEX3IVPROC)this->m_profiledFunctions[831]))(v);this->profiler.end(831,profilingStart);}
+void m_glTexGenfv_profiling(GLenum coord,GLenum pname,const GLfloat* params)const{auto const profilingStart=this->profiler.begin(832);(this->*((FunctionTable::MEMBERPFNGLTEXGENFVPROC)this->m_profiledFunctions[832]))(coord,pname,params);this->profiler.end(832,profilingStart);}
+void m_glFrustumfOES_profiling(GLfloat l,GLfloat r,GLfloat b,GLfloat t,GLfloat n,GLfloat f)const{auto const profilingStart=this->profiler.begin(833);(this->*((FunctionTable::MEMBERPFNGLFRUSTUMFOESPROC)this->m_profiledFunctions[833]))(l,r,b,t,n,f);this->profiler.end(833,profilingStart);}
+void m_glBindVertexBuffers_profiling(GLuint first,GLsizei count,const GLuint* buffers,const GLintptr* offsets,const GLsizei* strides)const{auto const profilingStart=this->profiler.begin(834);(this->*((FunctionTable::MEMBERPFNGLBINDVERTEXBUFFERSPROC)this->m_profiledFunctions[834]))(first,count,buffers,offsets,strides);this->profiler.end(834,profilingStart);}
+void m_glMateriali_profiling(GLenum face,GLenum pname,GLint param)const{auto const profilingStart=this->profiler.begin(835);(this->*((FunctionTable::MEMBERPFNGLMATERIALIPROC)this->m_profiledFunctions[835]))(face,pname,param);this->profiler.end(835,profilingStart);}
+void m_glMultiTexCoord2svARB_profiling(GLenum target,const GLshort* v)const{auto const profilingStart=this->profiler.begin(836);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD2SVARBPROC)this->m_profiledFunctions[836]))(target,v);this->profiler.end(836,profilingStart);}
+void m_glDisableVertexAttribArray_profiling(GLuint index)const{auto const profilingStart=this->profiler.begin(837);(this->*((FunctionTable::MEMBERPFNGLDISABLEVERTEXATTRIBARRAYPROC)this->m_profiledFunctions[837]))(index);this->profiler.end(837,profilingStart);}
+void m_glWindowPos3ivARB_profiling(const GLint* v)const{auto const profilingStart=this->profiler.begin(838);(this->*((FunctionTable::MEMBERPFNGLWINDOWPOS3IVARBPROC)this->m_profiledFunctions[838]))(v);this->profiler.end(838,profilingStart);}
+void m_glTexCoordFormatNV_profiling(GLint size,GLenum type,GLsizei stride)const{auto const profilingStart=this->profiler.begin(839);(this->*((FunctionTable::MEMBERPFNGLTEXCOORDFORMATNVPROC)this->m_profiledFunctions[839]))(size,type,stride);this->profiler.end(839,profilingStart);}
+void m_glBlitNamedFramebuffer_profiling(GLuint readFramebuffer,GLuint drawFramebuffer,GLint srcX0,GLint srcY0,GLint srcX1,GLint srcY1,GLint dstX0,GLint dstY0,GLint dstX1,GLint dstY1,GLbitfield mask,GLenum filter)const{auto const profilingStart=this->profiler.begin(840);(this->*((FunctionTable::MEMBERPFNGLBLITNAMEDFRAMEBUFFERPROC)this->m_profiledFunctions[840]))(readFramebuffer,drawFramebuffer,srcX0,srcY0,srcX1,srcY1,dstX0,dstY0,dstX1,dstY1,mask,filter);this->profiler.end(840,profilingStart);}
+void m_glMatrixLoadTransposefEXT_profiling(GLenum mode,const GLfloat* m)const{auto const profilingStart=this->profiler.begin(841);(this->*((FunctionTable::MEMBERPFNGLMATRIXLOADTRANSPOSEFEXTPROC)this->m_profiledFunctions[841]))(mode,m);this->profiler.end(841,profilingStart);}
+void m_glMultiTexGenfEXT_profiling(GLenum texunit,GLenum coord,GLenum pname,GLfloat param)const{auto const profilingStart=this->profiler.begin(842);(this->*((FunctionTable::MEMBERPFNGLMULTITEXGENFEXTPROC)this->m_profiledFunctions[842]))(texunit,coord,pname,param);this->profiler.end(842,profilingStart);}
+void m_glShaderStorageBlockBinding_profiling(GLuint program,GLuint storageBlockIndex,GLuint storageBlockBinding)const{auto const profilingStart=this->profiler.begin(843);(this->*((FunctionTable::MEMBERPFNGLSHADERSTORAGEBLOCKBINDINGPROC)this->m_profiledFunctions[843]))(program,storageBlockIndex,storageBlockBinding);this->profiler.end(843,profilingStart);}
+void m_glMaterialf_profiling(GLenum face,GLenum pname,GLfloat param)const{auto const profilingStart=this->profiler.begin(844);(this->*((FunctionTable::MEMBERPFNGLMATERIALFPROC)this->m_profiledFunctions[844]))(face,pname,param);this->profiler.end(844,profilingStart);}
+void m_glReplacementCodeuiColor4fNormal3fVertex3fSUN_profiling(GLuint rc,GLfloat r,GLfloat g,GLfloat b,GLfloat a,GLfloat nx,GLfloat ny,GLfloat nz,GLfloat x,GLfloat y,GLfloat z)const{auto const profilingStart=this->profiler.begin(845);(this->*((FunctionTable::MEMBERPFNGLREPLACEMENTCODEUICOLOR4FNORMAL3FVERTEX3FSUNPROC)this->m_profiledFunctions[845]))(rc,r,g,b,a,nx,ny,nz,x,y,z);this->profiler.end(845,profilingStart);}
+GLenum m_glCheckNamedFramebufferStatusEXT_profiling(GLuint framebuffer,GLenum target)const{auto const profilingStart=this->profiler.begin(846);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLCHECKNAMEDFRAMEBUFFERSTATUSEXTPROC)this->m_profiledFunctions[846]))(framebuffer,target);this->profiler.end(846,profilingStart);return profilingResult;}
+void m_glVertexArrayVertexAttribFormatEXT_profiling(GLuint vaobj,GLuint attribindex,GLint size,GLenum type,GLboolean normalized,GLuint relativeoffset)const{auto const profilingStart=this->profiler.begin(847);(this->*((FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBFORMATEXTPROC)this->m_profiledFunctions[847]))(vaobj,attribindex,size,type,normalized,relativeoffset);this->profiler.end(847,profilingStart);}
+void m_glVertex2hNV_profiling(GLhalfNV x,GLhalfNV y)const{auto const profilingStart=this->profiler.begin(848);(this->*((FunctionTable::MEMBERPFNGLVERTEX2HNVPROC)this->m_profiledFunctions[848]))(x,y);this->profiler.end(848,profilingStart);}
+void m_glDeleteVertexShaderEXT_profiling(GLuint id)const{auto const profilingStart=this->profiler.begin(849);(this->*((FunctionTable::MEMBERPFNGLDELETEVERTEXSHADEREXTPROC)this->m_profiledFunctions[849]))(id);this->profiler.end(849,profilingStart);}
+void m_glTexImage3DEXT_profiling(GLenum target,GLint level,GLenum internalformat,GLsizei width,GLsizei height,GLsizei depth,GLint border,GLenum format,GLenum type,const void* pixels)const{auto const profilingStart=this->profiler.begin(850);(this->*((FunctionTable::MEMBERPFNGLTEXIMAGE3DEXTPROC)this->m_profiledFunctions[850]))(target,level,internalformat,width,height,depth,border,format,type,pixels);this->profiler.end(850,profilingStart);}
+void m_glProgramLocalParameterI4ivNV_profiling(GLenum target,GLuint index,const GLint* params)const{auto const profilingStart=this->profiler.begin(851);(this->*((FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERI4IVNVPROC)this->m_profiledFunctions[851]))(target,index,params);this->profiler.end(851,profilingStart);}
+void m_glGlobalAlphaFactoriSUN_profiling(GLint factor)const{auto const profilingStart=this->profiler.begin(852);(this->*((FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORISUNPROC)this->m_profiledFunctions[852]))(factor);this->profiler.end(852,profilingStart);}
+void m_glTextureStorage1D_profiling(GLuint texture,GLsizei levels,GLenum internalformat,GLsizei width)const{auto const profilingStart=this->profiler.begin(853);(this->*((FunctionTable::MEMBERPFNGLTEXTURESTORAGE1DPROC)this->m_profiledFunctions[853]))(texture,levels,internalformat,width);this->profiler.end(853,profilingStart);}
+void m_glBinormal3sEXT_profiling(GLshort bx,GLshort by,GLshort bz)const{auto const profilingStart=this->profiler.begin(854);(this->*((FunctionTable::MEMBERPFNGLBINORMAL3SEXTPROC)this->m_profiledFunctions[854]))(bx,by,bz);this->profiler.end(854,profilingStart);}
+void m_glGetProgramInterfaceiv_profiling(GLuint program,GLenum programInterface,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(855);(this->*((FunctionTable::MEMBERPFNGLGETPROGRAMINTERFACEIVPROC)this->m_profiledFunctions[855]))(program,programInterface,pname,params);this->profiler.end(855,profilingStart);}
+void m_glMatrixIndexPointerARB_profiling(GLint size,GLenum type,GLsizei stride,const void* pointer)const{auto const profilingStart=this->profiler.begin(856);(this->*((FunctionTable::MEMBERPFNGLMATRIXINDEXPOINTERARBPROC)this->m_profiledFunctions[856]))(size,type,stride,pointer);this->profiler.end(856,profilingStart);}
+void m_glTexCoordPointerEXT_profiling(GLint size,GLenum type,GLsizei stride,GLsizei count,const void* pointer)const{auto const profilingStart=this->profiler.begin(857);(this->*((FunctionTable::MEMBERPFNGLTEXCOORDPOINTEREXTPROC)this->m_profiledFunctions[857]))(size,type,stride,count,pointer);this->profiler.end(857,profilingStart);}
+void m_glMultiTexGeniEXT_profiling(GLenum texunit,GLenum coord,GLenum pname,GLint param)const{auto const profilingStart=this->profiler.begin(858);(this->*((FunctionTable::MEMBERPFNGLMULTITEXGENIEXTPROC)this->m_profiledFunctions[858]))(texunit,coord,pname,param);this->profiler.end(858,profilingStart);}
+void m_glVertexAttrib2fNV_profiling(GLuint index,GLfloat x,GLfloat y)const{auto const profilingStart=this->profiler.begin(859);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB2FNVPROC)this->m_profiledFunctions[859]))(index,x,y);this->profiler.end(859,profilingStart);}
+void m_glNamedProgramStringEXT_profiling(GLuint program,GLenum target,GLenum format,GLsizei len,const void* string)const{auto const profilingStart=this->profiler.begin(860);(this->*((FunctionTable::MEMBERPFNGLNAMEDPROGRAMSTRINGEXTPROC)this->m_profiledFunctions[860]))(program,target,format,len,string);this->profiler.end(860,profilingStart);}
+void* m_glMapNamedBuffer_profiling(GLuint buffer,GLenum access)const{auto const profilingStart=this->profiler.begin(861);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLMAPNAMEDBUFFERPROC)this->m_profiledFunctions[861]))(buffer,access);this->profiler.end(861,profilingStart);return profilingResult;}
+void m_glGetMinmaxParameteriv_profiling(GLenum target,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(862);(this->*((FunctionTable::MEMBERPFNGLGETMINMAXPARAMETERIVPROC)this->m_profiledFunctions[862]))(target,pname,params);this->profiler.end(862,profilingStart);}
+void m_glGetnUniformdv_profiling(GLuint program,GLint location,GLsizei bufSize,GLdouble* params)const{auto const profilingStart=this->profiler.begin(863);(this->*((FunctionTable::MEMBERPFNGLGETNUNIFORMDVPROC)this->m_profiledFunctions[863]))(program,location,bufSize,params);this->profiler.end(863,profilingStart);}
+void m_glEndConditionalRenderNVX_profiling()const{auto const profilingStart=this->profiler.begin(864);(this->*((FunctionTable::MEMBERPFNGLENDCONDITIONALRENDERNVXPROC)this->m_profiledFunctions[864]))();this->profiler.end(864,profilingStart);}
+void m_glBinormal3fEXT_profiling(GLfloat bx,GLfloat by,GLfloat bz)const{auto const profilingStart=this->profiler.begin(865);(this->*((FunctionTable::MEMBERPFNGLBINORMAL3FEXTPROC)this->m_profiledFunctions[865]))(bx,by,bz);this->profiler.end(865,profilingStart);}
+void m_glNormalStream3iATI_profiling(GLenum stream,GLint nx,GLint ny,GLint nz)const{auto const profilingStart=this->profiler.begin(866);(this->*((FunctionTable::MEMBERPFNGLNORMALSTREAM3IATIPROC)this->m_profiledFunctions[866]))(stream,nx,ny,nz);this->profiler.end(866,profilingStart);}
+void m_glProgramBufferParametersIivNV_profiling(GLenum target,GLuint bindingIndex,GLuint wordIndex,GLsizei count,const GLint* params)const{auto const profilingStart=this->profiler.begin(867);(this->*((FunctionTable::MEMBERPFNGLPROGRAMBUFFERPARAMETERSIIVNVPROC)this->m_profiledFunctions[867]))(target,bindingIndex,wordIndex,count,params);this->profiler.end(867,profilingStart);}
+void m_glMapGrid1xOES_profiling(GLint n,GLfixed u1,GLfixed u2)const{auto const profilingStart=this->profiler.begin(868);(this->*((FunctionTable::MEMBERPFNGLMAPGRID1XOESPROC)this->m_profiledFunctions[868]))(n,u1,u2);this->profiler.end(868,profilingStart);}
+void m_glGetVertexAttribPointervARB_profiling(GLuint index,GLenum pname,void** pointer)const{auto const profilingStart=this->profiler.begin(869);(this->*((FunctionTable::MEMBERPFNGLGETVERTEXATTRIBPOINTERVARBPROC)this->m_profiledFunctions[869]))(index,pname,pointer);this->profiler.end(869,profilingStart);}
+void m_glFlushMappedNamedBufferRangeEXT_profiling(GLuint buffer,GLintptr offset,GLsizeiptr length)const{auto const profilingStart=this->profiler.begin(870);(this->*((FunctionTable::MEMBERPFNGLFLUSHMAPPEDNAMEDBUFFERRANGEEXTPROC)this->m_profiledFunctions[870]))(buffer,offset,length);this->profiler.end(870,profilingStart);}
+void m_glGetVertexAttribIiv_profiling(GLuint index,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(871);(this->*((FunctionTable::MEMBERPFNGLGETVERTEXATTRIBIIVPROC)this->m_profiledFunctions[871]))(index,pname,params);this->profiler.end(871,profilingStart);}
+void m_glVertexP4uiv_profiling(GLenum type,const GLuint* value)const{auto const profilingStart=this->profiler.begin(872);(this->*((FunctionTable::MEMBERPFNGLVERTEXP4UIVPROC)this->m_profiledFunctions[872]))(type,value);this->profiler.end(872,profilingStart);}
+void m_glUniformui64NV_profiling(GLint location,GLuint64EXT value)const{auto const profilingStart=this->profiler.begin(873);(this->*((FunctionTable::MEMBERPFNGLUNIFORMUI64NVPROC)this->m_profiledFunctions[873]))(location,value);this->profiler.end(873,profilingStart);}
+void m_glColor4fv_profiling(const GLfloat* v)const{auto const profilingStart=this->profiler.begin(874);(this->*((FunctionTable::MEMBERPFNGLCOLOR4FVPROC)this->m_profiledFunctions[874]))(v);this->profiler.end(874,profilingStart);}
+void m_glTexParameterxvOES_profiling(GLenum target,GLenum pname,const GLfixed* params)const{auto const profilingStart=this->profiler.begin(875);(this->*((FunctionTable::MEMBERPFNGLTEXPARAMETERXVOESPROC)this->m_profiledFunctions[875]))(target,pname,params);this->profiler.end(875,profilingStart);}
+void m_glPatchParameteri_profiling(GLenum pname,GLint value)const{auto const profilingStart=this->profiler.begin(876);(this->*((FunctionTable::MEMBERPFNGLPATCHPARAMETERIPROC)this->m_profiledFunctions[876]))(pname,value);this->profiler.end(876,profilingStart);}
+void m_glMap1d_profiling(GLenum target,GLdouble u1,GLdouble u2,GLint stride,GLint order,const GLdouble* points)const{auto const profilingStart=this->profiler.begin(877);(this->*((FunctionTable::MEMBERPFNGLMAP1DPROC)this->m_profiledFunctions[877]))(target,u1,u2,stride,order,points);this->profiler.end(877,profilingStart);}
+void m_glGetTexFilterFuncSGIS_profiling(GLenum target,GLenum filter,GLfloat* weights)const{auto const profilingStart=this->profiler.begin(878);(this->*((FunctionTable::MEMBERPFNGLGETTEXFILTERFUNCSGISPROC)this->m_profiledFunctions[878]))(target,filter,weights);this->profiler.end(878,profilingStart);}
+void m_glGetTexParameteriv_profiling(GLenum target,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(879);(this->*((FunctionTable::MEMBERPFNGLGETTEXPARAMETERIVPROC)this->m_profiledFunctions[879]))(target,pname,params);this->profiler.end(879,profilingStart);}
+void m_glVertexArrayVertexBindingDivisorEXT_profiling(GLuint vaobj,GLuint bindingindex,GLuint divisor)const{auto const profilingStart=this->profiler.begin(880);(this->*((FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXBINDINGDIVISOREXTPROC)this->m_profiledFunctions[880]))(vaobj,bindingindex,divisor);this->profiler.end(880,profilingStart);}
+void m_glMultiTexCoord3svARB_profiling(GLenum target,const GLshort* v)const{auto const profilingStart=this->profiler.begin(881);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD3SVARBPROC)this->m_profiledFunctions[881]))(target,v);this->profiler.end(881,profilingStart);}
+void m_glBindProgramNV_profiling(GLenum target,GLuint id)const{auto const profilingStart=this->profiler.begin(882);(this->*((FunctionTable::MEMBERPFNGLBINDPROGRAMNVPROC)this->m_profiledFunctions[882]))(target,id);this->profiler.end(882,profilingStart);}
+void m_glGetConvolutionParameteriv_profiling(GLenum target,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(883);(this->*((FunctionTable::MEMBERPFNGLGETCONVOLUTIONPARAMETERIVPROC)this->m_profiledFunctions[883]))(target,pname,params);this->profiler.end(883,profilingStart);}
+void m_glGetProgramLocalParameterfvARB_profiling(GLenum target,GLuint index,GLfloat* params)const{auto const profilingStart=this->profiler.begin(884);(this->*((FunctionTable::MEMBERPFNGLGETPROGRAMLOCALPARAMETERFVARBPROC)this->m_profiledFunctions[884]))(target,index,params);this->profiler.end(884,profilingStart);}
+GLuint m_glGenFragmentShadersATI_profiling(GLuint range)const{auto const profilingStart=this->profiler.begin(885);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLGENFRAGMENTSHADERSATIPROC)this->m_profiledFunctions[885]))(range);this->profiler.end(885,profilingStart);return profilingResult;}
+void m_glTexBumpParameterivATI_profiling(GLenum pname,const GLint* param)const{auto const profilingStart=this->profiler.begin(886);(this->*((FunctionTable::MEMBERPFNGLTEXBUMPPARAMETERIVATIPROC)this->m_profiledFunctions[886]))(pname,param);this->profiler.end(886,profilingStart);}
+void m_glGetNamedFramebufferAttachmentParameteriv_profiling(GLuint framebuffer,GLenum attachment,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(887);(this->*((FunctionTable::MEMBERPFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC)this->m_profiledFunctions[887]))(framebuffer,attachment,pname,params);this->profiler.end(887,profilingStart);}
+void m_glGetnSeparableFilter_profiling(GLenum target,GLenum format,GLenum type,GLsizei rowBufSize,void* row,GLsizei columnBufSize,void* column,void* span)const{auto const profilingStart=this->profiler.begin(888);(this->*((FunctionTable::MEMBERPFNGLGETNSEPARABLEFILTERPROC)this->m_profiledFunctions[888]))(target,format,type,rowBufSize,row,columnBufSize,column,span);this->profiler.end(888,profilingStart);}
+void m_glNormal3xvOES_profiling(const GLfixed* coords)const{auto const profilingStart=this->profiler.begin(889);(this->*((FunctionTable::MEMBERPFNGLNORMAL3XVOESPROC)this->m_profiledFunctions[889]))(coords);this->profiler.end(889,profilingStart);}
+void m_glPassTexCoordATI_profiling(GLuint dst,GLuint coord,GLenum swizzle)const{auto const profilingStart=this->profiler.begin(890);(this->*((FunctionTable::MEMBERPFNGLPASSTEXCOORDATIPROC)this->m_profiledFunctions[890]))(dst,coord,swizzle);this->profiler.end(890,profilingStart);}
+void m_glFramebufferTextureFaceARB_profiling(GLenum target,GLenum attachment,GLuint texture,GLint level,GLenum face)const{auto const profilingStart=this->profiler.begin(891);(this->*((FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTUREFACEARBPROC)this->m_profiledFunctions[891]))(target,attachment,texture,level,face);this->profiler.end(891,profilingStart);}
+void m_glProgramUniform1dv_profiling(GLuint program,GLint location,GLsizei count,const GLdouble* value)const{auto const profilingStart=this->profiler.begin(892);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1DVPROC)this->m_profiledFunctions[892]))(program,location,count,value);this->profiler.end(892,profilingStart);}
+void m_glTextureStorage2DEXT_profiling(GLuint texture,GLenum target,GLsizei levels,GLenum internalformat,GLsizei width,GLsizei height)const{auto const profilingStart=this->profiler.begin(893);(this->*((FunctionTable::MEMBERPFNGLTEXTURESTORAGE2DEXTPROC)this->m_profiledFunctions[893]))(texture,target,levels,internalformat,width,height);this->profiler.end(893,profilingStart);}
+void m_glVertexArrayFogCoordOffsetEXT_profiling(GLuint vaobj,GLuint buffer,GLenum type,GLsizei stride,GLintptr offset)const{auto const profilingStart=this->profiler.begin(894);(this->*((FunctionTable::MEMBERPFNGLVERTEXARRAYFOGCOORDOFFSETEXTPROC)this->m_profiledFunctions[894]))(vaobj,buffer,type,stride,offset);this->profiler.end(894,profilingStart);}
+void m_glDeleteNamedStringARB_profiling(GLint namelen,const GLchar* name)const{auto const profilingStart=this->profiler.begin(895);(this->*((FunctionTable::MEMBERPFNGLDELETENAMEDSTRINGARBPROC)this->m_profiledFunctions[895]))(namelen,name);this->profiler.end(895,profilingStart);}
+void m_glGenOcclusionQueriesNV_profiling(GLsizei n,GLuint* ids)const{auto const profilingStart=this->profiler.begin(896);(this->*((FunctionTable::MEMBERPFNGLGENOCCLUSIONQUERIESNVPROC)this->m_profiledFunctions[896]))(n,ids);this->profiler.end(896,profilingStart);}
+void m_glLighti_profiling(GLenum light,GLenum pname,GLint param)const{auto const profilingStart=this->profiler.begin(897);(this->*((FunctionTable::MEMBERPFNGLLIGHTIPROC)this->m_profiledFunctions[897]))(light,pname,param);this->profiler.end(897,profilingStart);}
+void m_glTexImage1D_profiling(GLenum target,GLint level,GLint internalFormat,GLsizei width,GLint border,GLenum format,GLenum type,const GLvoid* pixels)const{auto const profilingStart=this->profiler.begin(898);(this->*((FunctionTable::MEMBERPFNGLTEXIMAGE1DPROC)this->m_profiledFunctions[898]))(target,level,internalFormat,width,border,format,type,pixels);this->profiler.end(898,profilingStart);}
+void m_glLightf_profiling(GLenum light,GLenum pname,GLfloat param)const{auto const profilingStart=this->profiler.begin(899);(this->*((FunctionTable::MEMBERPFNGLLIGHTFPROC)this->m_profiledFunctions[899]))(light,pname,param);this->profiler.end(899,profilingStart);}
+void m_glClientAttribDefaultEXT_profiling(GLbitfield mask)const{auto const profilingStart=this->profiler.begin(900);(this->*((FunctionTable::MEMBERPFNGLCLIENTATTRIBDEFAULTEXTPROC)this->m_profiledFunctions[900]))(mask);this->profiler.end(900,profilingStart);}
+void m_glVertexAttrib4bvARB_profiling(GLuint index,const GLbyte* v)const{auto const profilingStart=this->profiler.begin(901);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB4BVARBPROC)this->m_profiledFunctions[901]))(index,v);this->profiler.end(901,profilingStart);}
+void m_glVertexAttribIFormatNV_profiling(GLuint index,GLint size,GLenum type,GLsizei stride)const{auto const profilingStart=this->profiler.begin(902);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBIFORMATNVPROC)this->m_profiledFunctions[902]))(index,size,type,stride);this->profiler.end(902,profilingStart);}
+void m_glStencilFuncSeparate_profiling(GLenum face,GLenum func,GLint ref,GLuint mask)const{auto const profilingStart=this->profiler.begin(903);(this->*((FunctionTable::MEMBERPFNGLSTENCILFUNCSEPARATEPROC)this->m_profiledFunctions[903]))(face,func,ref,mask);this->profiler.end(903,profilingStart);}
+void m_glGetVertexAttribfvARB_profiling(GLuint index,GLenum pname,GLfloat* params)const{auto const profilingStart=this->profiler.begin(904);(this->*((FunctionTable::MEMBERPFNGLGETVERTEXATTRIBFVARBPROC)this->m_profiledFunctions[904]))(index,pname,params);this->profiler.end(904,profilingStart);}
+void m_glVertexAttrib2dNV_profiling(GLuint index,GLdouble x,GLdouble y)const{auto const profilingStart=this->profiler.begin(905);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB2DNVPROC)this->m_profiledFunctions[905]))(index,x,y);this->profiler.end(905,profilingStart);}
+void m_glProgramUniform2iEXT_profiling(GLuint program,GLint location,GLint v0,GLint v1)const{auto const profilingStart=this->profiler.begin(906);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2IEXTPROC)this->m_profiledFunctions[906]))(program,location,v0,v1);this->profiler.end(906,profilingStart);}
+void m_glClientActiveVertexStreamATI_profiling(GLenum stream)const{auto const profilingStart=this->profiler.begin(907);(this->*((FunctionTable::MEMBERPFNGLCLIENTACTIVEVERTEXSTREAMATIPROC)this->m_profiledFunctions[907]))(stream);this->profiler.end(907,profilingStart);}
+void m_glRasterPos3xOES_profiling(GLfixed x,GLfixed y,GLfixed z)const{auto const profilingStart=this->profiler.begin(908);(this->*((FunctionTable::MEMBERPFNGLRASTERPOS3XOESPROC)this->m_profiledFunctions[908]))(x,y,z);this->profiler.end(908,profilingStart);}
+void m_glGetMapParameterivNV_profiling(GLenum target,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(909);(this->*((FunctionTable::MEMBERPFNGLGETMAPPARAMETERIVNVPROC)this->m_profiledFunctions[909]))(target,pname,params);this->profiler.end(909,profilingStart);}
+void m_glSampleCoverage_profiling(GLclampf value,GLboolean invert)const{auto const profilingStart=this->profiler.begin(910);(this->*((FunctionTable::MEMBERPFNGLSAMPLECOVERAGEPROC)this->m_profiledFunctions[910]))(value,invert);this->profiler.end(910,profilingStart);}
+void m_glClearDepthxOES_profiling(GLfixed depth)const{auto const profilingStart=this->profiler.begin(911);(this->*((FunctionTable::MEMBERPFNGLCLEARDEPTHXOESPROC)this->m_profiledFunctions[911]))(depth);this->profiler.end(911,profilingStart);}
+void m_glTexCoord2fNormal3fVertex3fvSUN_profiling(const GLfloat* tc,const GLfloat* n,const GLfloat* v)const{auto const profilingStart=this->profiler.begin(912);(this->*((FunctionTable::MEMBERPFNGLTEXCOORD2FNORMAL3FVERTEX3FVSUNPROC)this->m_profiledFunctions[912]))(tc,n,v);this->profiler.end(912,profilingStart);}
+void m_glGetFirstPerfQueryIdINTEL_profiling(GLuint* queryId)const{auto const profilingStart=this->profiler.begin(913);(this->*((FunctionTable::MEMBERPFNGLGETFIRSTPERFQUERYIDINTELPROC)this->m_profiledFunctions[913]))(queryId);this->profiler.end(913,profilingStart);}
+GLboolean m_glUnmapNamedBufferEXT_profiling(GLuint buffer)const{auto const profilingStart=this->profiler.begin(914);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLUNMAPNAMEDBUFFEREXTPROC)this->m_profiledFunctions[914]))(buffer);this->profiler.end(914,profilingStart);return profilingResult;}
+void m_glGetTransformFeedbacki_v_profiling(GLuint xfb,GLenum pname,GLuint index,GLint* param)const{auto const profilingStart=this->profiler.begin(915);(this->*((FunctionTable::MEMBERPFNGLGETTRANSFORMFEEDBACKI_VPROC)this->m_profiledFunctions[915]))(xfb,pname,index,param);this->profiler.end(915,profilingStart);}
+void m_glUniform4fvARB_profiling(GLint location,GLsizei count,const GLfloat* value)const{auto const profilingStart=this->profiler.begin(916);(this->*((FunctionTable::MEMBERPFNGLUNIFORM4FVARBPROC)this->m_profiledFunctions[916]))(location,count,value);this->profiler.end(916,profilingStart);}
+void m_glRenderbufferStorageMultisampleCoverageNV_profiling(GLenum target,GLsizei coverageSamples,GLsizei colorSamples,GLenum internalformat,GLsizei width,GLsizei height)const{auto const profilingStart=this->profiler.begin(917);(this->*((FunctionTable::MEMBERPFNGLRENDERBUFFERSTORAGEMULTISAMPLECOVERAGENVPROC)this->m_profiledFunctions[917]))(target,coverageSamples,colorSamples,internalformat,width,height);this->profiler.end(917,profilingStart);}
+void m_glGetFloati_vEXT_profiling(GLenum pname,GLuint index,GLfloat* params)const{auto const profilingStart=this->profiler.begin(918);(this->*((FunctionTable::MEMBERPFNGLGETFLOATI_VEXTPROC)this->m_profiledFunctions[918]))(pname,index,params);this->profiler.end(918,profilingStart);}
+void m_glBindAttribLocationARB_profiling(GLhandleARB programObj,GLuint index,const GLcharARB* name)const{auto const profilingStart=this->profiler.begin(919);(this->*((FunctionTable::MEMBERPFNGLBINDATTRIBLOCATIONARBPROC)this->m_profiledFunctions[919]))(programObj,index,name);this->profiler.end(919,profilingStart);}
+void m_glBufferAddressRangeNV_profiling(GLenum pname,GLuint index,GLuint64EXT address,GLsizeiptr length)const{auto const profilingStart=this->profiler.begin(920);(this->*((FunctionTable::MEMBERPFNGLBUFFERADDRESSRANGENVPROC)this->m_profiledFunctions[920]))(pname,index,address,length);this->profiler.end(920,profilingStart);}
+void m_glGenProgramsARB_profiling(GLsizei n,GLuint* programs)const{auto const profilingStart=this->profiler.begin(921);(this->*((FunctionTable::MEMBERPFNGLGENPROGRAMSARBPROC)this->m_profiledFunctions[921]))(n,programs);this->profiler.end(921,profilingStart);}
+void m_glMultiTexEnvivEXT_profiling(GLenum texunit,GLenum target,GLenum pname,const GLint* params)const{auto const profilingStart=this->profiler.begin(922);(this->*((FunctionTable::MEMBERPFNGLMULTITEXENVIVEXTPROC)this->m_profiledFunctions[922]))(texunit,target,pname,params);this->profiler.end(922,profilingStart);}
+void m_glSecondaryColor3uiEXT_profiling(GLuint red,GLuint green,GLuint blue)const{auto const profilingStart=this->profiler.begin(923);(this->*((FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UIEXTPROC)this->m_profiledFunctions[923]))(red,green,blue);this->profiler.end(923,profilingStart);}
+void m_glCompressedTextureImage2DEXT_profiling(GLuint texture,GLenum target,GLint level,GLenum internalformat,GLsizei width,GLsizei height,GLint border,GLsizei imageSize,const void* bits)const{auto const profilingStart=this->profiler.begin(924);(this->*((FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTUREIMAGE2DEXTPROC)this->m_profiledFunctions[924]))(texture,target,level,internalformat,width,height,border,imageSize,bits);this->profiler.end(924,profilingStart);}
+void m_glUniform2i_profiling(GLint location,GLint v0,GLint v1)const{auto const profilingStart=this->profiler.begin(925);(this->*((FunctionTable::MEMBERPFNGLUNIFORM2IPROC)this->m_profiledFunctions[925]))(location,v0,v1);this->profiler.end(925,profilingStart);}
+void m_glCopyTexImage2DEXT_profiling(GLenum target,GLint level,GLenum internalformat,GLint x,GLint y,GLsizei width,GLsizei height,GLint border)const{auto const profilingStart=this->profiler.begin(926);(this->*((FunctionTable::MEMBERPFNGLCOPYTEXIMAGE2DEXTPROC)this->m_profiledFunctions[926]))(target,level,internalformat,x,y,width,height,border);this->profiler.end(926,profilingStart);}
+void m_glUniform2d_profiling(GLint location,GLdouble x,GLdouble y)const{auto const profilingStart=this->profiler.begin(927);(this->*((FunctionTable::MEMBERPFNGLUNIFORM2DPROC)this->m_profiledFunctions[927]))(location,x,y);this->profiler.end(927,profilingStart);}
+void m_glVertexAttribL1d_profiling(GLuint index,GLdouble x)const{auto const profilingStart=this->profiler.begin(928);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBL1DPROC)this->m_profiledFunctions[928]))(index,x);this->profiler.end(928,profilingStart);}
+void m_glFramebufferTextureFaceEXT_profiling(GLenum target,GLenum attachment,GLuint texture,GLint level,GLenum face)const{auto const profilingStart=this->profiler.begin(929);(this->*((FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTUREFACEEXTPROC)this->m_profiledFunctions[929]))(target,attachment,texture,level,face);this->profiler.end(929,profilingStart);}
+void m_glFramebufferTextureLayer_profiling(GLenum target,GLenum attachment,GLuint texture,GLint level,GLint layer)const{auto const profilingStart=this->profiler.begin(930);(this->*((FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURELAYERPROC)this->m_profiledFunctions[930]))(target,attachment,texture,level,layer);this->profiler.end(930,profilingStart);}
+void m_glMultiTexCoord4bvOES_profiling(GLenum texture,const GLbyte* coords)const{auto const profilingStart=this->profiler.begin(931);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD4BVOESPROC)this->m_profiledFunctions[931]))(texture,coords);this->profiler.end(931,profilingStart);}
+void m_glGetVertexArrayPointeri_vEXT_profiling(GLuint vaobj,GLuint index,GLenum pname,void** param)const{auto const profilingStart=this->profiler.begin(932);(this->*((FunctionTable::MEMBERPFNGLGETVERTEXARRAYPOINTERI_VEXTPROC)this->m_profiledFunctions[932]))(vaobj,index,pname,param);this->profiler.end(932,profilingStart);}
+void m_glNamedProgramLocalParameter4dEXT_profiling(GLuint program,GLenum target,GLuint index,GLdouble x,GLdouble y,GLdouble z,GLdouble w)const{auto const profilingStart=this->profiler.begin(933);(this->*((FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETER4DEXTPROC)this->m_profiledFunctions[933]))(program,target,index,x,y,z,w);this->profiler.end(933,profilingStart);}
+void m_glBinormal3bEXT_profiling(GLbyte bx,GLbyte by,GLbyte bz)const{auto const profilingStart=this->profiler.begin(934);(this->*((FunctionTable::MEMBERPFNGLBINORMAL3BEXTPROC)this->m_profiledFunctions[934]))(bx,by,bz);this->profiler.end(934,profilingStart);}
+void m_glConvolutionFilter2DEXT_profiling(GLenum target,GLenum internalformat,GLsizei width,GLsizei height,GLenum format,GLenum type,const void* image)const{auto const profilingStart=this->profiler.begin(935);(this->*((FunctionTable::MEMBERPFNGLCONVOLUTIONFILTER2DEXTPROC)this->m_profiledFunctions[935]))(target,internalformat,width,height,format,type,image);this->profiler.end(935,profilingStart);}
+void m_glProgramUniform2fv_profiling(GLuint program,GLint location,GLsizei count,const GLfloat* value)const{auto const profilingStart=this->profiler.begin(936);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2FVPROC)this->m_profiledFunctions[936]))(program,location,count,value);this->profiler.end(936,profilingStart);}
+void m_glColor3fVertex3fSUN_profiling(GLfloat r,GLfloat g,GLfloat b,GLfloat x,GLfloat y,GLfloat z)const{auto const profilingStart=this->profiler.begin(937);(this->*((FunctionTable::MEMBERPFNGLCOLOR3FVERTEX3FSUNPROC)this->m_profiledFunctions[937]))(r,g,b,x,y,z);this->profiler.end(937,profilingStart);}
+void m_glNormal3fVertex3fvSUN_profiling(const GLfloat* n,const GLfloat* v)const{auto const profilingStart=this->profiler.begin(938);(this->*((FunctionTable::MEMBERPFNGLNORMAL3FVERTEX3FVSUNPROC)this->m_profiledFunctions[938]))(n,v);this->profiler.end(938,profilingStart);}
+void m_glCopyMultiTexSubImage3DEXT_profiling(GLenum texunit,GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLint x,GLint y,GLsizei width,GLsizei height)const{auto const profilingStart=this->profiler.begin(939);(this->*((FunctionTable::MEMBERPFNGLCOPYMULTITEXSUBIMAGE3DEXTPROC)this->m_profiledFunctions[939]))(texunit,target,level,xoffset,yoffset,zoffset,x,y,width,height);this->profiler.end(939,profilingStart);}
+void m_glProgramLocalParameterI4iNV_profiling(GLenum target,GLuint index,GLint x,GLint y,GLint z,GLint w)const{auto const profilingStart=this->profiler.begin(940);(this->*((FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERI4INVPROC)this->m_profiledFunctions[940]))(target,index,x,y,z,w);this->profiler.end(940,profilingStart);}
+void m_glProgramUniformMatrix2x4dv_profiling(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{auto const profilingStart=this->profiler.begin(941);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X4DVPROC)this->m_profiledFunctions[941]))(program,location,count,transpose,value);this->profiler.end(941,profilingStart);}
+GLenum m_glPathMemoryGlyphIndexArrayNV_profiling(GLuint firstPathName,GLenum fontTarget,GLsizeiptr fontSize,const void* fontData,GLsizei faceIndex,GLuint firstGlyphIndex,GLsizei numGlyphs,GLuint pathParameterTemplate,GLfloat emScale)const{auto const profilingStart=this->profiler.begin(942);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLPATHMEMORYGLYPHINDEXARRAYNVPROC)this->m_profiledFunctions[942]))(firstPathName,fontTarget,fontSize,fontData,faceIndex,firstGlyphIndex,numGlyphs,pathParameterTemplate,emScale);this->profiler.end(942,profilingStart);return profilingResult;}
+void m_glDrawArraysEXT_profiling(GLenum mode,GLint first,GLsizei count)const{auto const profilingStart=this->profiler.begin(943);(this->*((FunctionTable::MEMBERPFNGLDRAWARRAYSEXTPROC)this->m_profiledFunctions[943]))(mode,first,count);this->profiler.end(943,profilingStart);}
+void m_glBlendEquationEXT_profiling(GLenum mode)const{auto const profilingStart=this->profiler.begin(944);(this->*((FunctionTable::MEMBERPFNGLBLENDEQUATIONEXTPROC)this->m_profiledFunctions[944]))(mode);this->profiler.end(944,profilingStart);}
+void m_glStencilOp_profiling(GLenum fail,GLenum zfail,GLenum zpass)const{auto const profilingStart=this->profiler.begin(945);(this->*((FunctionTable::MEMBERPFNGLSTENCILOPPROC)this->m_profiledFunctions[945]))(fail,zfail,zpass);this->profiler.end(945,profilingStart);}
+void m_glCopyTextureSubImage2DEXT_profiling(GLuint texture,GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint x,GLint y,GLsizei width,GLsizei height)const{auto const profilingStart=this->profiler.begin(946);(this->*((FunctionTable::MEMBERPFNGLCOPYTEXTURESUBIMAGE2DEXTPROC)this->m_profiledFunctions[946]))(texture,target,level,xoffset,yoffset,x,y,width,height);this->profiler.end(946,profilingStart);}
+void m_glTexEnvf_profiling(GLenum target,GLenum pname,GLfloat param)const{auto const profilingStart=this->profiler.begin(947);(this->*((FunctionTable::MEMBERPFNGLTEXENVFPROC)this->m_profiledFunctions[947]))(target,pname,param);this->profiler.end(947,profilingStart);}
+void m_glVertexAttrib2dvNV_profiling(GLuint index,const GLdouble* v)const{auto const profilingStart=this->profiler.begin(948);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB2DVNVPROC)this->m_profiledFunctions[948]))(index,v);this->profiler.end(948,profilingStart);}
+void m_glGenPerfMonitorsAMD_profiling(GLsizei n,GLuint* monitors)const{auto const profilingStart=this->profiler.begin(949);(this->*((FunctionTable::MEMBERPFNGLGENPERFMONITORSAMDPROC)this->m_profiledFunctions[949]))(n,monitors);this->profiler.end(949,profilingStart);}
+void m_glGetInteger64i_v_profiling(GLenum target,GLuint index,GLint64* data)const{auto const profilingStart=this->profiler.begin(950);(this->*((FunctionTable::MEMBERPFNGLGETINTEGER64I_VPROC)this->m_profiledFunctions[950]))(target,index,data);this->profiler.end(950,profilingStart);}
+void m_glGetHistogramParameterfv_profiling(GLenum target,GLenum pname,GLfloat* params)const{auto const profilingStart=this->profiler.begin(951);(this->*((FunctionTable::MEMBERPFNGLGETHISTOGRAMPARAMETERFVPROC)this->m_profiledFunctions[951]))(target,pname,params);this->profiler.end(951,profilingStart);}
+void m_glVertexFormatNV_profiling(GLint size,GLenum type,GLsizei stride)const{auto const profilingStart=this->profiler.begin(952);(this->*((FunctionTable::MEMBERPFNGLVERTEXFORMATNVPROC)this->m_profiledFunctions[952]))(size,type,stride);this->profiler.end(952,profilingStart);}
+void m_glBlendFuncIndexedAMD_profiling(GLuint buf,GLenum src,GLenum dst)const{auto const profilingStart=this->profiler.begin(953);(this->*((FunctionTable::MEMBERPFNGLBLENDFUNCINDEXEDAMDPROC)this->m_profiledFunctions[953]))(buf,src,dst);this->profiler.end(953,profilingStart);}
+void m_glTexEnvi_profiling(GLenum target,GLenum pname,GLint param)const{auto const profilingStart=this->profiler.begin(954);(this->*((FunctionTable::MEMBERPFNGLTEXENVIPROC)this->m_profiledFunctions[954]))(target,pname,param);this->profiler.end(954,profilingStart);}
+void m_glMultiTexCoord1iv_profiling(GLenum target,const GLint* v)const{auto const profilingStart=this->profiler.begin(955);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD1IVPROC)this->m_profiledFunctions[955]))(target,v);this->profiler.end(955,profilingStart);}
+GLboolean m_glIsEnabledi_profiling(GLenum target,GLuint index)const{auto const profilingStart=this->profiler.begin(956);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLISENABLEDIPROC)this->m_profiledFunctions[956]))(target,index);this->profiler.end(956,profilingStart);return profilingResult;}
+void m_glVertexAttribL2ui64vNV_profiling(GLuint index,const GLuint64EXT* v)const{auto const profilingStart=this->profiler.begin(957);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBL2UI64VNVPROC)this->m_profiledFunctions[957]))(index,v);this->profiler.end(957,profilingStart);}
+void m_glVertexAttribL4i64NV_profiling(GLuint index,GLint64EXT x,GLint64EXT y,GLint64EXT z,GLint64EXT w)const{auto const profilingStart=this->profiler.begin(958);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBL4I64NVPROC)this->m_profiledFunctions[958]))(index,x,y,z,w);this->profiler.end(958,profilingStart);}
+void m_glMatrixTranslatedEXT_profiling(GLenum mode,GLdouble x,GLdouble y,GLdouble z)const{auto const profilingStart=this->profiler.begin(959);(this->*((FunctionTable::MEMBERPFNGLMATRIXTRANSLATEDEXTPROC)this->m_profiledFunctions[959]))(mode,x,y,z);this->profiler.end(959,profilingStart);}
+void m_glMakeTextureHandleResidentARB_profiling(GLuint64 handle)const{auto const profilingStart=this->profiler.begin(960);(this->*((FunctionTable::MEMBERPFNGLMAKETEXTUREHANDLERESIDENTARBPROC)this->m_profiledFunctions[960]))(handle);this->profiler.end(960,profilingStart);}
+void m_glMatrixMultdEXT_profiling(GLenum mode,const GLdouble* m)const{auto const profilingStart=this->profiler.begin(961);(this->*((FunctionTable::MEMBERPFNGLMATRIXMULTDEXTPROC)this->m_profiledFunctions[961]))(mode,m);this->profiler.end(961,profilingStart);}
+void m_glBinormal3dvEXT_profiling(const GLdouble* v)const{auto const profilingStart=this->profiler.begin(962);(this->*((FunctionTable::MEMBERPFNGLBINORMAL3DVEXTPROC)this->m_profiledFunctions[962]))(v);this->profiler.end(962,profilingStart);}
+GLsync m_glImportSyncEXT_profiling(GLenum external_sync_type,GLintptr external_sync,GLbitfield flags)const{auto const profilingStart=this->profiler.begin(963);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLIMPORTSYNCEXTPROC)this->m_profiledFunctions[963]))(external_sync_type,external_sync,flags);this->profiler.end(963,profilingStart);return profilingResult;}
+void m_glGetMapiv_profiling(GLenum target,GLenum query,GLint* v)const{auto const profilingStart=this->profiler.begin(964);(this->*((FunctionTable::MEMBERPFNGLGETMAPIVPROC)this->m_profiledFunctions[964]))(target,query,v);this->profiler.end(964,profilingStart);}
+void m_glGetListParameterfvSGIX_profiling(GLuint list,GLenum pname,GLfloat* params)const{auto const profilingStart=this->profiler.begin(965);(this->*((FunctionTable::MEMBERPFNGLGETLISTPARAMETERFVSGIXPROC)this->m_profiledFunctions[965]))(list,pname,params);this->profiler.end(965,profilingStart);}
+void m_glMultiTexCoord4sv_profiling(GLenum target,const GLshort* v)const{auto const profilingStart=this->profiler.begin(966);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD4SVPROC)this->m_profiledFunctions[966]))(target,v);this->profiler.end(966,profilingStart);}
+void m_glPNTrianglesiATI_profiling(GLenum pname,GLint param)const{auto const profilingStart=this->profiler.begin(967);(this->*((FunctionTable::MEMBERPFNGLPNTRIANGLESIATIPROC)this->m_profiledFunctions[967]))(pname,param);this->profiler.end(967,profilingStart);}
+void m_glBindVertexArrayAPPLE_profiling(GLuint array)const{auto const profilingStart=this->profiler.begin(968);(this->*((FunctionTable::MEMBERPFNGLBINDVERTEXARRAYAPPLEPROC)this->m_profiledFunctions[968]))(array);this->profiler.end(968,profilingStart);}
+void m_glObjectPtrLabel_profiling(const void* ptr,GLsizei length,const GLchar* label)const{auto const profilingStart=this->profiler.begin(969);(this->*((FunctionTable::MEMBERPFNGLOBJECTPTRLABELPROC)this->m_profiledFunctions[969]))(ptr,length,label);this->profiler.end(969,profilingStart);}
+GLuint m_glGetDebugMessageLog_profiling(GLuint count,GLsizei bufSize,GLenum* sources,GLenum* types,GLuint* ids,GLenum* severities,GLsizei* lengths,GLchar* messageLog)const{auto const profilingStart=this->profiler.begin(970);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLGETDEBUGMESSAGELOGPROC)this->m_profiledFunctions[970]))(count,bufSize,sources,types,ids,severities,lengths,messageLog);this->profiler.end(970,profilingStart);return profilingResult;}
+void m_glTrackMatrixNV_profiling(GLenum target,GLuint address,GLenum matrix,GLenum transform)const{auto const profilingStart=this->profiler.begin(971);(this->*((FunctionTable::MEMBERPFNGLTRACKMATRIXNVPROC)this->m_profiledFunctions[971]))(target,address,matrix,transform);this->profiler.end(971,profilingStart);}
+void m_glBindFragDataLocation_profiling(GLuint program,GLuint color,const GLchar* name)const{auto const profilingStart=this->profiler.begin(972);(this->*((FunctionTable::MEMBERPFNGLBINDFRAGDATALOCATIONPROC)this->m_profiledFunctions[972]))(program,color,name);this->profiler.end(972,profilingStart);}
+void m_glTangent3ivEXT_profiling(const GLint* v)const{auto const profilingStart=this->profiler.begin(973);(this->*((FunctionTable::MEMBERPFNGLTANGENT3IVEXTPROC)this->m_profiledFunctions[973]))(v);this->profiler.end(973,profilingStart);}
+void m_glSecondaryColor3ubv_profiling(const GLubyte* v)const{auto const profilingStart=this->profiler.begin(974);(this->*((FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UBVPROC)this->m_profiledFunctions[974]))(v);this->profiler.end(974,profilingStart);}
+void m_glMakeTextureHandleNonResidentNV_profiling(GLuint64 handle)const{auto const profilingStart=this->profiler.begin(975);(this->*((FunctionTable::MEMBERPFNGLMAKETEXTUREHANDLENONRESIDENTNVPROC)this->m_profiledFunctions[975]))(handle);this->profiler.end(975,profilingStart);}
+void m_glVertexAttribs4ubvNV_profiling(GLuint index,GLsizei count,const GLubyte* v)const{auto const profilingStart=this->profiler.begin(976);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBS4UBVNVPROC)this->m_profiledFunctions[976]))(index,count,v);this->profiler.end(976,profilingStart);}
+void m_glClipPlanexOES_profiling(GLenum plane,const GLfixed* equation)const{auto const profilingStart=this->profiler.begin(977);(this->*((FunctionTable::MEMBERPFNGLCLIPPLANEXOESPROC)this->m_profiledFunctions[977]))(plane,equation);this->profiler.end(977,profilingStart);}
+void m_glMultiTexCoord3iv_profiling(GLenum target,const GLint* v)const{auto const profilingStart=this->profiler.begin(978);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD3IVPROC)this->m_profiledFunctions[978]))(target,v);this->profiler.end(978,profilingStart);}
+void m_glGetnPolygonStippleARB_profiling(GLsizei bufSize,GLubyte* pattern)const{auto const profilingStart=this->profiler.begin(979);(this->*((FunctionTable::MEMBERPFNGLGETNPOLYGONSTIPPLEARBPROC)this->m_profiledFunctions[979]))(bufSize,pattern);this->profiler.end(979,profilingStart);}
+void m_glUniform2i64vNV_profiling(GLint location,GLsizei count,const GLint64EXT* value)const{auto const profilingStart=this->profiler.begin(980);(this->*((FunctionTable::MEMBERPFNGLUNIFORM2I64VNVPROC)this->m_profiledFunctions[980]))(location,count,value);this->profiler.end(980,profilingStart);}
+void m_glLightModelf_profiling(GLenum pname,GLfloat param)const{auto const profilingStart=this->profiler.begin(981);(this->*((FunctionTable::MEMBERPFNGLLIGHTMODELFPROC)this->m_profiledFunctions[981]))(pname,param);this->profiler.end(981,profilingStart);}
+void m_glMultiTexSubImage2DEXT_profiling(GLenum texunit,GLenum target,GLint level,GLint xoffset,GLint yoffset,GLsizei width,GLsizei height,GLenum format,GLenum type,const void* pixels)const{auto const profilingStart=this->profiler.begin(982);(this->*((FunctionTable::MEMBERPFNGLMULTITEXSUBIMAGE2DEXTPROC)this->m_profiledFunctions[982]))(texunit,target,level,xoffset,yoffset,width,height,format,type,pixels);this->profiler.end(982,profilingStart);}
+void m_glReplacementCodeuiColor3fVertex3fSUN_profiling(GLuint rc,GLfloat r,GLfloat g,GLfloat b,GLfloat x,GLfloat y,GLfloat z)const{auto const profilingStart=this->profiler.begin(983);(this->*((FunctionTable::MEMBERPFNGLREPLACEMENTCODEUICOLOR3FVERTEX3FSUNPROC)this->m_profiledFunctions[983]))(rc,r,g,b,x,y,z);this->profiler.end(983,profilingStart);}
+void m_glTangent3dvEXT_profiling(const GLdouble* v)const{auto const profilingStart=this->profiler.begin(984);(this->*((FunctionTable::MEMBERPFNGLTANGENT3DVEXTPROC)this->m_profiledFunctions[984]))(v);this->profiler.end(984,profilingStart);}
+void m_glLightModeli_profiling(GLenum pname,GLint param)const{auto const profilingStart=this->profiler.begin(985);(this->*((FunctionTable::MEMBERPFNGLLIGHTMODELIPROC)this->m_profiledFunctions[985]))(pname,param);this->profiler.end(985,profilingStart);}
+void m_glVertexWeighthvNV_profiling(const GLhalfNV* weight)const{auto const profilingStart=this->profiler.begin(986);(this->*((FunctionTable::MEMBERPFNGLVERTEXWEIGHTHVNVPROC)this->m_profiledFunctions[986]))(weight);this->profiler.end(986,profilingStart);}
+void m_glWindowPos3iv_profiling(const GLint* v)const{auto const profilingStart=this->profiler.begin(987);(this->*((FunctionTable::MEMBERPFNGLWINDOWPOS3IVPROC)this->m_profiledFunctions[987]))(v);this->profiler.end(987,profilingStart);}
+void m_glMultiTexCoordP1uiv_profiling(GLenum texture,GLenum type,const GLuint* coords)const{auto const profilingStart=this->profiler.begin(988);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORDP1UIVPROC)this->m_profiledFunctions[988]))(texture,type,coords);this->profiler.end(988,profilingStart);}
+void m_glTransformPathNV_profiling(GLuint resultPath,GLuint srcPath,GLenum transformType,const GLfloat* transformValues)const{auto const profilingStart=this->profiler.begin(989);(this->*((FunctionTable::MEMBERPFNGLTRANSFORMPATHNVPROC)this->m_profiledFunctions[989]))(resultPath,srcPath,transformType,transformValues);this->profiler.end(989,profilingStart);}
+void m_glProgramNamedParameter4dNV_profiling(GLuint id,GLsizei len,const GLubyte* name,GLdouble x,GLdouble y,GLdouble z,GLdouble w)const{auto const profilingStart=this->profiler.begin(990);(this->*((FunctionTable::MEMBERPFNGLPROGRAMNAMEDPARAMETER4DNVPROC)this->m_profiledFunctions[990]))(id,len,name,x,y,z,w);this->profiler.end(990,profilingStart);}
+void m_glMultiDrawElementsIndirect_profiling(GLenum mode,GLenum type,const void* indirect,GLsizei drawcount,GLsizei stride)const{auto const profilingStart=this->profiler.begin(991);(this->*((FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSINDIRECTPROC)this->m_profiledFunctions[991]))(mode,type,indirect,drawcount,stride);this->profiler.end(991,profilingStart);}
+void m_glProgramUniform1dEXT_profiling(GLuint program,GLint location,GLdouble x)const{auto const profilingStart=this->profiler.begin(992);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1DEXTPROC)this->m_profiledFunctions[992]))(program,location,x);this->profiler.end(992,profilingStart);}
+void m_glCallLists_profiling(GLsizei n,GLenum type,const GLvoid* lists)const{auto const profilingStart=this->profiler.begin(993);(this->*((FunctionTable::MEMBERPFNGLCALLLISTSPROC)this->m_profiledFunctions[993]))(n,type,lists);this->profiler.end(993,profilingStart);}
+void m_glNormal3hvNV_profiling(const GLhalfNV* v)const{auto const profilingStart=this->profiler.begin(994);(this->*((FunctionTable::MEMBERPFNGLNORMAL3HVNVPROC)this->m_profiledFunctions[994]))(v);this->profiler.end(994,profilingStart);}
+void m_glGetCombinerOutputParameterfvNV_profiling(GLenum stage,GLenum portion,GLenum pname,GLfloat* params)const{auto const profilingStart=this->profiler.begin(995);(this->*((FunctionTable::MEMBERPFNGLGETCOMBINEROUTPUTPARAMETERFVNVPROC)this->m_profiledFunctions[995]))(stage,portion,pname,params);this->profiler.end(995,profilingStart);}
+void m_glVertexAttrib4sARB_profiling(GLuint index,GLshort x,GLshort y,GLshort z,GLshort w)const{auto const profilingStart=this->profiler.begin(996);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB4SARBPROC)this->m_profiledFunctions[996]))(index,x,y,z,w);this->profiler.end(996,profilingStart);}
+void m_glTexCoord3i_profiling(GLint s,GLint t,GLint r)const{auto const profilingStart=this->profiler.begin(997);(this->*((FunctionTable::MEMBERPFNGLTEXCOORD3IPROC)this->m_profiledFunctions[997]))(s,t,r);this->profiler.end(997,profilingStart);}
+void m_glVertexAttribI3uiv_profiling(GLuint index,const GLuint* v)const{auto const profilingStart=this->profiler.begin(998);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBI3UIVPROC)this->m_profiledFunctions[998]))(index,v);this->profiler.end(998,profilingStart);}
+void m_glPushDebugGroup_profiling(GLenum source,GLuint id,GLsizei length,const GLchar* message)const{auto const profilingStart=this->profiler.begin(999);(this->*((FunctionTable::MEMBERPFNGLPUSHDEBUGGROUPPROC)this->m_profiledFunctions[999]))(source,id,length,message);this->profiler.end(999,profilingStart);}
+void m_glTexCoord3f_profiling(GLfloat s,GLfloat t,GLfloat r)const{auto const profilingStart=this->profiler.begin(1000);(this->*((FunctionTable::MEMBERPFNGLTEXCOORD3FPROC)this->m_profiledFunctions[1000]))(s,t,r);this->profiler.end(1000,profilingStart);}
+void m_glTexCoord3d_profiling(GLdouble s,GLdouble t,GLdouble r)const{auto const profilingStart=this->profiler.begin(1001);(this->*((FunctionTable::MEMBERPFNGLTEXCOORD3DPROC)this->m_profiledFunctions[1001]))(s,t,r);this->profiler.end(1001,profilingStart);}
+void m_glTexCoord2xOES_profiling(GLfixed s,GLfixed t)const{auto const profilingStart=this->profiler.begin(1002);(this->*((FunctionTable::MEMBERPFNGLTEXCOORD2XOESPROC)this->m_profiledFunctions[1002]))(s,t);this->profiler.end(1002,profilingStart);}
+GLushort m_glGetStageIndexNV_profiling(GLenum shadertype)const{auto const profilingStart=this->profiler.begin(1003);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLGETSTAGEINDEXNVPROC)this->m_profiledFunctions[1003]))(shadertype);this->profiler.end(1003,profilingStart);return profilingResult;}
+void m_glProgramUniform4i64vNV_profiling(GLuint program,GLint location,GLsizei count,const GLint64EXT* value)const{auto const profilingStart=this->profiler.begin(1004);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4I64VNVPROC)this->m_profiledFunctions[1004]))(program,location,count,value);this->profiler.end(1004,profilingStart);}
+void m_glGetNamedBufferPointervEXT_profiling(GLuint buffer,GLenum pname,void** params)const{auto const profilingStart=this->profiler.begin(1005);(this->*((FunctionTable::MEMBERPFNGLGETNAMEDBUFFERPOINTERVEXTPROC)this->m_profiledFunctions[1005]))(buffer,pname,params);this->profiler.end(1005,profilingStart);}
+void m_glTextureBarrierNV_profiling()const{auto const profilingStart=this->profiler.begin(1006);(this->*((FunctionTable::MEMBERPFNGLTEXTUREBARRIERNVPROC)this->m_profiledFunctions[1006]))();this->profiler.end(1006,profilingStart);}
+void m_glColor4ubVertex3fvSUN_profiling(const GLubyte* c,const GLfloat* v)const{auto const profilingStart=this->profiler.begin(1007);(this->*((FunctionTable::MEMBERPFNGLCOLOR4UBVERTEX3FVSUNPROC)this->m_profiledFunctions[1007]))(c,v);this->profiler.end(1007,profilingStart);}
+GLuint m_glGetCommandHeaderNV_profiling(GLenum tokenID,GLuint size)const{auto const profilingStart=this->profiler.begin(1008);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLGETCOMMANDHEADERNVPROC)this->m_profiledFunctions[1008]))(tokenID,size);this->profiler.end(1008,profilingStart);return profilingResult;}
+void m_glGetPerfMonitorCounterInfoAMD_profiling(GLuint group,GLuint counter,GLenum pname,void* data)const{auto const profilingStart=this->profiler.begin(1009);(this->*((FunctionTable::MEMBERPFNGLGETPERFMONITORCOUNTERINFOAMDPROC)this->m_profiledFunctions[1009]))(group,counter,pname,data);this->profiler.end(1009,profilingStart);}
+void m_glVertexAttrib1svARB_profiling(GLuint index,const GLshort* v)const{auto const profilingStart=this->profiler.begin(1010);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB1SVARBPROC)this->m_profiledFunctions[1010]))(index,v);this->profiler.end(1010,profilingStart);}
+void m_glCombinerParameteriNV_profiling(GLenum pname,GLint param)const{auto const profilingStart=this->profiler.begin(1011);(this->*((FunctionTable::MEMBERPFNGLCOMBINERPARAMETERINVPROC)this->m_profiledFunctions[1011]))(pname,param);this->profiler.end(1011,profilingStart);}
+void m_glMatrixMultTransposefEXT_profiling(GLenum mode,const GLfloat* m)const{auto const profilingStart=this->profiler.begin(1012);(this->*((FunctionTable::MEMBERPFNGLMATRIXMULTTRANSPOSEFEXTPROC)this->m_profiledFunctions[1012]))(mode,m);this->profiler.end(1012,profilingStart);}
+void m_glDetailTexFuncSGIS_profiling(GLenum target,GLsizei n,const GLfloat* points)const{auto const profilingStart=this->profiler.begin(1013);(this->*((FunctionTable::MEMBERPFNGLDETAILTEXFUNCSGISPROC)this->m_profiledFunctions[1013]))(target,n,points);this->profiler.end(1013,profilingStart);}
+GLboolean m_glAreTexturesResident_profiling(GLsizei n,const GLuint* textures,GLboolean* residences)const{auto const profilingStart=this->profiler.begin(1014);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLARETEXTURESRESIDENTPROC)this->m_profiledFunctions[1014]))(n,textures,residences);this->profiler.end(1014,profilingStart);return profilingResult;}
+void m_glProgramUniform2d_profiling(GLuint program,GLint location,GLdouble v0,GLdouble v1)const{auto const profilingStart=this->profiler.begin(1015);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2DPROC)this->m_profiledFunctions[1015]))(program,location,v0,v1);this->profiler.end(1015,profilingStart);}
+void m_glGetConvolutionParameterfvEXT_profiling(GLenum target,GLenum pname,GLfloat* params)const{auto const profilingStart=this->profiler.begin(1016);(this->*((FunctionTable::MEMBERPFNGLGETCONVOLUTIONPARAMETERFVEXTPROC)this->m_profiledFunctions[1016]))(target,pname,params);this->profiler.end(1016,profilingStart);}
+void m_glIndexPointerListIBM_profiling(GLenum type,GLint stride,const void** pointer,GLint ptrstride)const{auto const profilingStart=this->profiler.begin(1017);(this->*((FunctionTable::MEMBERPFNGLINDEXPOINTERLISTIBMPROC)this->m_profiledFunctions[1017]))(type,stride,pointer,ptrstride);this->profiler.end(1017,profilingStart);}
+void m_glVertexAttribI4iEXT_profiling(GLuint index,GLint x,GLint y,GLint z,GLint w)const{auto const profilingStart=this->profiler.begin(1018);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBI4IEXTPROC)this->m_profiledFunctions[1018]))(index,x,y,z,w);this->profiler.end(1018,profilingStart);}
+void m_glProgramUniform2f_profiling(GLuint program,GLint location,GLfloat v0,GLfloat v1)const{auto const profilingStart=this->profiler.begin(1019);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2FPROC)this->m_profiledFunctions[1019]))(program,location,v0,v1);this->profiler.end(1019,profilingStart);}
+void m_glRasterPos4sv_profiling(const GLshort* v)const{auto const profilingStart=this->profiler.begin(1020);(this->*((FunctionTable::MEMBERPFNGLRASTERPOS4SVPROC)this->m_profiledFunctions[1020]))(v);this->profiler.end(1020,profilingStart);}
+void m_glColor4s_profiling(GLshort red,GLshort green,GLshort blue,GLshort alpha)const{auto const profilingStart=this->profiler.begin(1021);(this->*((FunctionTable::MEMBERPFNGLCOLOR4SPROC)this->m_profiledFunctions[1021]))(red,green,blue,alpha);this->profiler.end(1021,profilingStart);}
+void m_glColorFragmentOp3ATI_profiling(GLenum op,GLuint dst,GLuint dstMask,GLuint dstMod,GLuint arg1,GLuint arg1Rep,GLuint arg1Mod,GLuint arg2,GLuint arg2Rep,GLuint arg2Mod,GLuint arg3,GLuint arg3Rep,GLuint arg3Mod)const{auto const profilingStart=this->profiler.begin(1022);(this->*((FunctionTable::MEMBERPFNGLCOLORFRAGMENTOP3ATIPROC)this->m_profiledFunctions[1022]))(op,dst,dstMask,dstMod,arg1,arg1Rep,arg1Mod,arg2,arg2Rep,arg2Mod,arg3,arg3Rep,arg3Mod);this->profiler.end(1022,profilingStart);}
+void m_glResizeBuffersMESA_profiling()const{auto const profilingStart=this->profiler.begin(1023);(this->*((FunctionTable::MEMBERPFNGLRESIZEBUFFERSMESAPROC)this->m_profiledFunctions[1023]))();this->profiler.end(1023,profilingStart);}
+void m_glGetMinmaxParameterfv_profiling(GLenum target,GLenum pname,GLfloat* params)const{auto const profilingStart=this->profiler.begin(1024);(this->*((FunctionTable::MEMBERPFNGLGETMINMAXPARAMETERFVPROC)this->m_profiledFunctions[1024]))(target,pname,params);this->profiler.end(1024,profilingStart);}
+void m_glClientActiveTextureARB_profiling(GLenum texture)const{auto const profilingStart=this->profiler.begin(1025);(this->*((FunctionTable::MEMBERPFNGLCLIENTACTIVETEXTUREARBPROC)this->m_profiledFunctions[1025]))(texture);this->profiler.end(1025,profilingStart);}
+void m_glBindVertexArray_profiling(GLuint array)const{auto const profilingStart=this->profiler.begin(1026);(this->*((FunctionTable::MEMBERPFNGLBINDVERTEXARRAYPROC)this->m_profiledFunctions[1026]))(array);this->profiler.end(1026,profilingStart);}
+void m_glColor4b_profiling(GLbyte red,GLbyte green,GLbyte blue,GLbyte alpha)const{auto const profilingStart=this->profiler.begin(1027);(this->*((FunctionTable::MEMBERPFNGLCOLOR4BPROC)this->m_profiledFunctions[1027]))(red,green,blue,alpha);this->profiler.end(1027,profilingStart);}
+void m_glColor4f_profiling(GLfloat red,GLfloat green,GLfloat blue,GLfloat alpha)const{auto const profilingStart=this->profiler.begin(1028);(this->*((FunctionTable::MEMBERPFNGLCOLOR4FPROC)this->m_profiledFunctions[1028]))(red,green,blue,alpha);this->profiler.end(1028,profilingStart);}
+void m_glColor4d_profiling(GLdouble red,GLdouble green,GLdouble blue,GLdouble alpha)const{auto const profilingStart=this->profiler.begin(1029);(this->*((FunctionTable::MEMBERPFNGLCOLOR4DPROC)this->m_profiledFunctions[1029]))(red,green,blue,alpha);this->profiler.end(1029,profilingStart);}
+void m_glColor4i_profiling(GLint red,GLint green,GLint blue,GLint alpha)const{auto const profilingStart=this->profiler.begin(1030);(this->*((FunctionTable::MEMBERPFNGLCOLOR4IPROC)this->m_profiledFunctions[1030]))(red,green,blue,alpha);this->profiler.end(1030,profilingStart);}
+void m_glEdgeFlagFormatNV_profiling(GLsizei stride)const{auto const profilingStart=this->profiler.begin(1031);(this->*((FunctionTable::MEMBERPFNGLEDGEFLAGFORMATNVPROC)this->m_profiledFunctions[1031]))(stride);this->profiler.end(1031,profilingStart);}
+void m_glNamedBufferSubData_profiling(GLuint buffer,GLintptr offset,GLsizeiptr size,const void* data)const{auto const profilingStart=this->profiler.begin(1032);(this->*((FunctionTable::MEMBERPFNGLNAMEDBUFFERSUBDATAPROC)this->m_profiledFunctions[1032]))(buffer,offset,size,data);this->profiler.end(1032,profilingStart);}
+void m_glDrawElementsInstanced_profiling(GLenum mode,GLsizei count,GLenum type,const void* indices,GLsizei instancecount)const{auto const profilingStart=this->profiler.begin(1033);(this->*((FunctionTable::MEMBERPFNGLDRAWELEMENTSINSTANCEDPROC)this->m_profiledFunctions[1033]))(mode,count,type,indices,instancecount);this->profiler.end(1033,profilingStart);}
+void m_glGetMultiTexParameterIivEXT_profiling(GLenum texunit,GLenum target,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(1034);(this->*((FunctionTable::MEMBERPFNGLGETMULTITEXPARAMETERIIVEXTPROC)this->m_profiledFunctions[1034]))(texunit,target,pname,params);this->profiler.end(1034,profilingStart);}
+void m_glVertex2dv_profiling(const GLdouble* v)const{auto const profilingStart=this->profiler.begin(1035);(this->*((FunctionTable::MEMBERPFNGLVERTEX2DVPROC)this->m_profiledFunctions[1035]))(v);this->profiler.end(1035,profilingStart);}
+void m_glDisableVertexArrayAttribEXT_profiling(GLuint vaobj,GLuint index)const{auto const profilingStart=this->profiler.begin(1036);(this->*((FunctionTable::MEMBERPFNGLDISABLEVERTEXARRAYATTRIBEXTPROC)this->m_profiledFunctions[1036]))(vaobj,index);this->profiler.end(1036,profilingStart);}
+GLenum m_glObjectUnpurgeableAPPLE_profiling(GLenum objectType,GLuint name,GLenum option)const{auto const profilingStart=this->profiler.begin(1037);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLOBJECTUNPURGEABLEAPPLEPROC)this->m_profiledFunctions[1037]))(objectType,name,option);this->profiler.end(1037,profilingStart);return profilingResult;}
+void m_glVertexAttribs2dvNV_profiling(GLuint index,GLsizei count,const GLdouble* v)const{auto const profilingStart=this->profiler.begin(1038);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBS2DVNVPROC)this->m_profiledFunctions[1038]))(index,count,v);this->profiler.end(1038,profilingStart);}
+void m_glReplacementCodeuiTexCoord2fVertex3fSUN_profiling(GLuint rc,GLfloat s,GLfloat t,GLfloat x,GLfloat y,GLfloat z)const{auto const profilingStart=this->profiler.begin(1039);(this->*((FunctionTable::MEMBERPFNGLREPLACEMENTCODEUITEXCOORD2FVERTEX3FSUNPROC)this->m_profiledFunctions[1039]))(rc,s,t,x,y,z);this->profiler.end(1039,profilingStart);}
+void m_glGetMapParameterfvNV_profiling(GLenum target,GLenum pname,GLfloat* params)const{auto const profilingStart=this->profiler.begin(1040);(this->*((FunctionTable::MEMBERPFNGLGETMAPPARAMETERFVNVPROC)this->m_profiledFunctions[1040]))(target,pname,params);this->profiler.end(1040,profilingStart);}
+void m_glProgramUniform4ivEXT_profiling(GLuint program,GLint location,GLsizei count,const GLint* value)const{auto const profilingStart=this->profiler.begin(1041);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4IVEXTPROC)this->m_profiledFunctions[1041]))(program,location,count,value);this->profiler.end(1041,profilingStart);}
+void m_glProgramUniform3ui64vNV_profiling(GLuint program,GLint location,GLsizei count,const GLuint64EXT* value)const{auto const profilingStart=this->profiler.begin(1042);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UI64VNVPROC)this->m_profiledFunctions[1042]))(program,location,count,value);this->profiler.end(1042,profilingStart);}
+void m_glRectfv_profiling(const GLfloat* v1,const GLfloat* v2)const{auto const profilingStart=this->profiler.begin(1043);(this->*((FunctionTable::MEMBERPFNGLRECTFVPROC)this->m_profiledFunctions[1043]))(v1,v2);this->profiler.end(1043,profilingStart);}
+void m_glTexFilterFuncSGIS_profiling(GLenum target,GLenum filter,GLsizei n,const GLfloat* weights)const{auto const profilingStart=this->profiler.begin(1044);(this->*((FunctionTable::MEMBERPFNGLTEXFILTERFUNCSGISPROC)this->m_profiledFunctions[1044]))(target,filter,n,weights);this->profiler.end(1044,profilingStart);}
+void m_glSpriteParameterfvSGIX_profiling(GLenum pname,const GLfloat* params)const{auto const profilingStart=this->profiler.begin(1045);(this->*((FunctionTable::MEMBERPFNGLSPRITEPARAMETERFVSGIXPROC)this->m_profiledFunctions[1045]))(pname,params);this->profiler.end(1045,profilingStart);}
+void m_glCopyMultiTexImage1DEXT_profiling(GLenum texunit,GLenum target,GLint level,GLenum internalformat,GLint x,GLint y,GLsizei width,GLint border)const{auto const profilingStart=this->profiler.begin(1046);(this->*((FunctionTable::MEMBERPFNGLCOPYMULTITEXIMAGE1DEXTPROC)this->m_profiledFunctions[1046]))(texunit,target,level,internalformat,x,y,width,border);this->profiler.end(1046,profilingStart);}
+void m_glGetVertexAttribIuivEXT_profiling(GLuint index,GLenum pname,GLuint* params)const{auto const profilingStart=this->profiler.begin(1047);(this->*((FunctionTable::MEMBERPFNGLGETVERTEXATTRIBIUIVEXTPROC)this->m_profiledFunctions[1047]))(index,pname,params);this->profiler.end(1047,profilingStart);}
+void m_glUniformMatrix2x4dv_profiling(GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{auto const profilingStart=this->profiler.begin(1048);(this->*((FunctionTable::MEMBERPFNGLUNIFORMMATRIX2X4DVPROC)this->m_profiledFunctions[1048]))(location,count,transpose,value);this->profiler.end(1048,profilingStart);}
+GLint m_glGetProgramResourceLocationIndex_profiling(GLuint program,GLenum programInterface,const GLchar* name)const{auto const profilingStart=this->profiler.begin(1049);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC)this->m_profiledFunctions[1049]))(program,programInterface,name);this->profiler.end(1049,profilingStart);return profilingResult;}
+void m_glColor3hNV_profiling(GLhalfNV red,GLhalfNV green,GLhalfNV blue)const{auto const profilingStart=this->profiler.begin(1050);(this->*((FunctionTable::MEMBERPFNGLCOLOR3HNVPROC)this->m_profiledFunctions[1050]))(red,green,blue);this->profiler.end(1050,profilingStart);}
+void m_glViewport_profiling(GLint x,GLint y,GLsizei width,GLsizei height)const{auto const profilingStart=this->profiler.begin(1051);(this->*((FunctionTable::MEMBERPFNGLVIEWPORTPROC)this->m_profiledFunctions[1051]))(x,y,width,height);this->profiler.end(1051,profilingStart);}
+void m_glProgramNamedParameter4fNV_profiling(GLuint id,GLsizei len,const GLubyte* name,GLfloat x,GLfloat y,GLfloat z,GLfloat w)const{auto const profilingStart=this->profiler.begin(1052);(this->*((FunctionTable::MEMBERPFNGLPROGRAMNAMEDPARAMETER4FNVPROC)this->m_profiledFunctions[1052]))(id,len,name,x,y,z,w);this->profiler.end(1052,profilingStart);}
+void m_glGetInvariantBooleanvEXT_profiling(GLuint id,GLenum value,GLboolean* data)const{auto const profilingStart=this->profiler.begin(1053);(this->*((FunctionTable::MEMBERPFNGLGETINVARIANTBOOLEANVEXTPROC)this->m_profiledFunctions[1053]))(id,value,data);this->profiler.end(1053,profilingStart);}
+void m_glTexStorage2DMultisample_profiling(GLenum target,GLsizei samples,GLenum internalformat,GLsizei width,GLsizei height,GLboolean fixedsamplelocations)const{auto const profilingStart=this->profiler.begin(1054);(this->*((FunctionTable::MEMBERPFNGLTEXSTORAGE2DMULTISAMPLEPROC)this->m_profiledFunctions[1054]))(target,samples,internalformat,width,height,fixedsamplelocations);this->profiler.end(1054,profilingStart);}
+void m_glPixelStorex_profiling(GLenum pname,GLfixed param)const{auto const profilingStart=this->profiler.begin(1055);(this->*((FunctionTable::MEMBERPFNGLPIXELSTOREXPROC)this->m_profiledFunctions[1055]))(pname,param);this->profiler.end(1055,profilingStart);}
+void m_glVertexAttribL1dvEXT_profiling(GLuint index,const GLdouble* v)const{auto const profilingStart=this->profiler.begin(1056);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBL1DVEXTPROC)this->m_profiledFunctions[1056]))(index,v);this->profiler.end(1056,profilingStart);}
+void m_glGetActiveSubroutineUniformiv_profiling(GLuint program,GLenum shadertype,GLuint index,GLenum pname,GLint* values)const{auto const profilingStart=this->profiler.begin(1057);(this->*((FunctionTable::MEMBERPFNGLGETACTIVESUBROUTINEUNIFORMIVPROC)this->m_profiledFunctions[1057]))(program,shadertype,index,pname,values);this->profiler.end(1057,profilingStart);}
+void m_glVertexAttribPointerARB_profiling(GLuint index,GLint size,GLenum type,GLboolean normalized,GLsizei stride,const void* pointer)const{auto const profilingStart=this->profiler.begin(1058);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBPOINTERARBPROC)this->m_profiledFunctions[1058]))(index,size,type,normalized,stride,pointer);this->profiler.end(1058,profilingStart);}
+void m_glCompressedTexSubImage2DARB_profiling(GLenum target,GLint level,GLint xoffset,GLint yoffset,GLsizei width,GLsizei height,GLenum format,GLsizei imageSize,const void* data)const{auto const profilingStart=this->profiler.begin(1059);(this->*((FunctionTable::MEMBERPFNGLCOMPRESSEDTEXSUBIMAGE2DARBPROC)this->m_profiledFunctions[1059]))(target,level,xoffset,yoffset,width,height,format,imageSize,data);this->profiler.end(1059,profilingStart);}
+void m_glVertex2hvNV_profiling(const GLhalfNV* v)const{auto const profilingStart=this->profiler.begin(1060);(this->*((FunctionTable::MEMBERPFNGLVERTEX2HVNVPROC)this->m_profiledFunctions[1060]))(v);this->profiler.end(1060,profilingStart);}
+void m_glTexBuffer_profiling(GLenum target,GLenum internalformat,GLuint buffer)const{auto const profilingStart=this->profiler.begin(1061);(this->*((FunctionTable::MEMBERPFNGLTEXBUFFERPROC)this->m_profiledFunctions[1061]))(target,internalformat,buffer);this->profiler.end(1061,profilingStart);}
+void m_glArrayElement_profiling(GLint i)const{auto const profilingStart=this->profiler.begin(1062);(this->*((FunctionTable::MEMBERPFNGLARRAYELEMENTPROC)this->m_profiledFunctions[1062]))(i);this->profiler.end(1062,profilingStart);}
+void m_glValidateProgram_profiling(GLuint program)const{auto const profilingStart=this->profiler.begin(1063);(this->*((FunctionTable::MEMBERPFNGLVALIDATEPROGRAMPROC)this->m_profiledFunctions[1063]))(program);this->profiler.end(1063,profilingStart);}
+void m_glPixelStoref_profiling(GLenum pname,GLfloat param)const{auto const profilingStart=this->profiler.begin(1064);(this->*((FunctionTable::MEMBERPFNGLPIXELSTOREFPROC)this->m_profiledFunctions[1064]))(pname,param);this->profiler.end(1064,profilingStart);}
+void m_glWindowPos3dARB_profiling(GLdouble x,GLdouble y,GLdouble z)const{auto const profilingStart=this->profiler.begin(1065);(this->*((FunctionTable::MEMBERPFNGLWINDOWPOS3DARBPROC)this->m_profiledFunctions[1065]))(x,y,z);this->profiler.end(1065,profilingStart);}
+void m_glEvalCoord1dv_profiling(const GLdouble* u)const{auto const profilingStart=this->profiler.begin(1066);(this->*((FunctionTable::MEMBERPFNGLEVALCOORD1DVPROC)this->m_profiledFunctions[1066]))(u);this->profiler.end(1066,profilingStart);}
+void m_glVertexAttribs2fvNV_profiling(GLuint index,GLsizei count,const GLfloat* v)const{auto const profilingStart=this->profiler.begin(1067);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBS2FVNVPROC)this->m_profiledFunctions[1067]))(index,count,v);this->profiler.end(1067,profilingStart);}
+void m_glRecti_profiling(GLint x1,GLint y1,GLint x2,GLint y2)const{auto const profilingStart=this->profiler.begin(1068);(this->*((FunctionTable::MEMBERPFNGLRECTIPROC)this->m_profiledFunctions[1068]))(x1,y1,x2,y2);this->profiler.end(1068,profilingStart);}
+void m_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN_profiling(const GLuint* rc,const GLfloat* tc,const GLfloat* c,const GLfloat* n,const GLfloat* v)const{auto const profilingStart=this->profiler.begin(1069);(this->*((FunctionTable::MEMBERPFNGLREPLACEMENTCODEUITEXCOORD2FCOLOR4FNORMAL3FVERTEX3FVSUNPROC)this->m_profiledFunctions[1069]))(rc,tc,c,n,v);this->profiler.end(1069,profilingStart);}
+void m_glTexCoord1bOES_profiling(GLbyte s)const{auto const profilingStart=this->profiler.begin(1070);(this->*((FunctionTable::MEMBERPFNGLTEXCOORD1BOESPROC)this->m_profiledFunctions[1070]))(s);this->profiler.end(1070,profilingStart);}
+void m_glProgramUniform2i64vARB_profiling(GLuint program,GLint location,GLsizei count,const GLint64* value)const{auto const profilingStart=this->profiler.begin(1071);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2I64VARBPROC)this->m_profiledFunctions[1071]))(program,location,count,value);this->profiler.end(1071,profilingStart);}
+void m_glWindowPos2dARB_profiling(GLdouble x,GLdouble y)const{auto const profilingStart=this->profiler.begin(1072);(this->*((FunctionTable::MEMBERPFNGLWINDOWPOS2DARBPROC)this->m_profiledFunctions[1072]))(x,y);this->profiler.end(1072,profilingStart);}
+void m_glGetProgramParameterdvNV_profiling(GLenum target,GLuint index,GLenum pname,GLdouble* params)const{auto const profilingStart=this->profiler.begin(1073);(this->*((FunctionTable::MEMBERPFNGLGETPROGRAMPARAMETERDVNVPROC)this->m_profiledFunctions[1073]))(target,index,pname,params);this->profiler.end(1073,profilingStart);}
+void m_glRectf_profiling(GLfloat x1,GLfloat y1,GLfloat x2,GLfloat y2)const{auto const profilingStart=this->profiler.begin(1074);(this->*((FunctionTable::MEMBERPFNGLRECTFPROC)this->m_profiledFunctions[1074]))(x1,y1,x2,y2);this->profiler.end(1074,profilingStart);}
+void m_glRectd_profiling(GLdouble x1,GLdouble y1,GLdouble x2,GLdouble y2)const{auto const profilingStart=this->profiler.begin(1075);(this->*((FunctionTable::MEMBERPFNGLRECTDPROC)this->m_profiledFunctions[1075]))(x1,y1,x2,y2);this->profiler.end(1075,profilingStart);}
+void m_glMap1xOES_profiling(GLenum target,GLfixed u1,GLfixed u2,GLint stride,GLint order,GLfixed points)const{auto const profilingStart=this->profiler.begin(1076);(this->*((FunctionTable::MEMBERPFNGLMAP1XOESPROC)this->m_profiledFunctions[1076]))(target,u1,u2,stride,order,points);this->profiler.end(1076,profilingStart);}
+void m_glVertexAttrib3fvNV_profiling(GLuint index,const GLfloat* v)const{auto const profilingStart=this->profiler.begin(1077);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB3FVNVPROC)this->m_profiledFunctions[1077]))(index,v);this->profiler.end(1077,profilingStart);}
+void m_glReferencePlaneSGIX_profiling(const GLdouble* equation)const{auto const profilingStart=this->profiler.begin(1078);(this->*((FunctionTable::MEMBERPFNGLREFERENCEPLANESGIXPROC)this->m_profiledFunctions[1078]))(equation);this->profiler.end(1078,profilingStart);}
+void m_glGetMultiTexGendvEXT_profiling(GLenum texunit,GLenum coord,GLenum pname,GLdouble* params)const{auto const profilingStart=this->profiler.begin(1079);(this->*((FunctionTable::MEMBERPFNGLGETMULTITEXGENDVEXTPROC)this->m_profiledFunctions[1079]))(texunit,coord,pname,params);this->profiler.end(1079,profilingStart);}
+void m_glGetCombinerInputParameterfvNV_profiling(GLenum stage,GLenum portion,GLenum variable,GLenum pname,GLfloat* params)const{auto const profilingStart=this->profiler.begin(1080);(this->*((FunctionTable::MEMBERPFNGLGETCOMBINERINPUTPARAMETERFVNVPROC)this->m_profiledFunctions[1080]))(stage,portion,variable,pname,params);this->profiler.end(1080,profilingStart);}
+GLuint64 m_glGetTextureSamplerHandleARB_profiling(GLuint texture,GLuint sampler)const{auto const profilingStart=this->profiler.begin(1081);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLGETTEXTURESAMPLERHANDLEARBPROC)this->m_profiledFunctions[1081]))(texture,sampler);this->profiler.end(1081,profilingStart);return profilingResult;}
+void m_glBindTexture_profiling(GLenum target,GLuint texture)const{auto const profilingStart=this->profiler.begin(1082);(this->*((FunctionTable::MEMBERPFNGLBINDTEXTUREPROC)this->m_profiledFunctions[1082]))(target,texture);this->profiler.end(1082,profilingStart);}
+void m_glRects_profiling(GLshort x1,GLshort y1,GLshort x2,GLshort y2)const{auto const profilingStart=this->profiler.begin(1083);(this->*((FunctionTable::MEMBERPFNGLRECTSPROC)this->m_profiledFunctions[1083]))(x1,y1,x2,y2);this->profiler.end(1083,profilingStart);}
+void m_glGetActiveAttribARB_profiling(GLhandleARB programObj,GLuint index,GLsizei maxLength,GLsizei* length,GLint* size,GLenum* type,GLcharARB* name)const{auto const profilingStart=this->profiler.begin(1084);(this->*((FunctionTable::MEMBERPFNGLGETACTIVEATTRIBARBPROC)this->m_profiledFunctions[1084]))(programObj,index,maxLength,length,size,type,name);this->profiler.end(1084,profilingStart);}
+void m_glHistogramEXT_profiling(GLenum target,GLsizei width,GLenum internalformat,GLboolean sink)const{auto const profilingStart=this->profiler.begin(1085);(this->*((FunctionTable::MEMBERPFNGLHISTOGRAMEXTPROC)this->m_profiledFunctions[1085]))(target,width,internalformat,sink);this->profiler.end(1085,profilingStart);}
+GLuint64 m_glGetTextureSamplerHandleNV_profiling(GLuint texture,GLuint sampler)const{auto const profilingStart=this->profiler.begin(1086);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLGETTEXTURESAMPLERHANDLENVPROC)this->m_profiledFunctions[1086]))(texture,sampler);this->profiler.end(1086,profilingStart);return profilingResult;}
+void m_glDetachShader_profiling(GLuint program,GLuint shader)const{auto const profilingStart=this->profiler.begin(1087);(this->*((FunctionTable::MEMBERPFNGLDETACHSHADERPROC)this->m_profiledFunctions[1087]))(program,shader);this->profiler.end(1087,profilingStart);}
+void m_glFinishTextureSUNX_profiling()const{auto const profilingStart=this->profiler.begin(1088);(this->*((FunctionTable::MEMBERPFNGLFINISHTEXTURESUNXPROC)this->m_profiledFunctions[1088]))();this->profiler.end(1088,profilingStart);}
+void m_glUniformMatrix3x4dv_profiling(GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{auto const profilingStart=this->profiler.begin(1089);(this->*((FunctionTable::MEMBERPFNGLUNIFORMMATRIX3X4DVPROC)this->m_profiledFunctions[1089]))(location,count,transpose,value);this->profiler.end(1089,profilingStart);}
+void m_glVertexAttrib4fARB_profiling(GLuint index,GLfloat x,GLfloat y,GLfloat z,GLfloat w)const{auto const profilingStart=this->profiler.begin(1090);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB4FARBPROC)this->m_profiledFunctions[1090]))(index,x,y,z,w);this->profiler.end(1090,profilingStart);}
+void m_glGetPathColorGenivNV_profiling(GLenum color,GLenum pname,GLint* value)const{auto const profilingStart=this->profiler.begin(1091);(this->*((FunctionTable::MEMBERPFNGLGETPATHCOLORGENIVNVPROC)this->m_profiledFunctions[1091]))(color,pname,value);this->profiler.end(1091,profilingStart);}
+GLint m_glGetProgramResourceLocation_profiling(GLuint program,GLenum programInterface,const GLchar* name)const{auto const profilingStart=this->profiler.begin(1092);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLGETPROGRAMRESOURCELOCATIONPROC)this->m_profiledFunctions[1092]))(program,programInterface,name);this->profiler.end(1092,profilingStart);return profilingResult;}
+void m_glVertexArrayAttribLFormat_profiling(GLuint vaobj,GLuint attribindex,GLint size,GLenum type,GLuint relativeoffset)const{auto const profilingStart=this->profiler.begin(1093);(this->*((FunctionTable::MEMBERPFNGLVERTEXARRAYATTRIBLFORMATPROC)this->m_profiledFunctions[1093]))(vaobj,attribindex,size,type,relativeoffset);this->profiler.end(1093,profilingStart);}
+void m_glGetTexLevelParameterfv_profiling(GLenum target,GLint level,GLenum pname,GLfloat* params)const{auto const profilingStart=this->profiler.begin(1094);(this->*((FunctionTable::MEMBERPFNGLGETTEXLEVELPARAMETERFVPROC)this->m_profiledFunctions[1094]))(target,level,pname,params);this->profiler.end(1094,profilingStart);}
+void m_glVertexArrayVertexAttribOffsetEXT_profiling(GLuint vaobj,GLuint buffer,GLuint index,GLint size,GLenum type,GLboolean normalized,GLsizei stride,GLintptr offset)const{auto const profilingStart=this->profiler.begin(1095);(this->*((FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBOFFSETEXTPROC)this->m_profiledFunctions[1095]))(vaobj,buffer,index,size,type,normalized,stride,offset);this->profiler.end(1095,profilingStart);}
+void m_glIndexFormatNV_profiling(GLenum type,GLsizei stride)const{auto const profilingStart=this->profiler.begin(1096);(this->*((FunctionTable::MEMBERPFNGLINDEXFORMATNVPROC)this->m_profiledFunctions[1096]))(type,stride);this->profiler.end(1096,profilingStart);}
+void m_glMultiTexCoord3i_profiling(GLenum target,GLint s,GLint t,GLint r)const{auto const profilingStart=this->profiler.begin(1097);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD3IPROC)this->m_profiledFunctions[1097]))(target,s,t,r);this->profiler.end(1097,profilingStart);}
+void m_glReplacementCodeuiVertex3fvSUN_profiling(const GLuint* rc,const GLfloat* v)const{auto const profilingStart=this->profiler.begin(1098);(this->*((FunctionTable::MEMBERPFNGLREPLACEMENTCODEUIVERTEX3FVSUNPROC)this->m_profiledFunctions[1098]))(rc,v);this->profiler.end(1098,profilingStart);}
+void m_glViewportIndexedfv_profiling(GLuint index,const GLfloat* v)const{auto const profilingStart=this->profiler.begin(1099);(this->*((FunctionTable::MEMBERPFNGLVIEWPORTINDEXEDFVPROC)this->m_profiledFunctions[1099]))(index,v);this->profiler.end(1099,profilingStart);}
+void m_glBindBuffersBase_profiling(GLenum target,GLuint first,GLsizei count,const GLuint* buffers)const{auto const profilingStart=this->profiler.begin(1100);(this->*((FunctionTable::MEMBERPFNGLBINDBUFFERSBASEPROC)this->m_profiledFunctions[1100]))(target,first,count,buffers);this->profiler.end(1100,profilingStart);}
+void m_glTexBumpParameterfvATI_profiling(GLenum pname,const GLfloat* param)const{auto const profilingStart=this->profiler.begin(1101);(this->*((FunctionTable::MEMBERPFNGLTEXBUMPPARAMETERFVATIPROC)this->m_profiledFunctions[1101]))(pname,param);this->profiler.end(1101,profilingStart);}
+void m_glMatrixIndexuivARB_profiling(GLint size,const GLuint* indices)const{auto const profilingStart=this->profiler.begin(1102);(this->*((FunctionTable::MEMBERPFNGLMATRIXINDEXUIVARBPROC)this->m_profiledFunctions[1102]))(size,indices);this->profiler.end(1102,profilingStart);}
+void m_glVertexAttrib1hNV_profiling(GLuint index,GLhalfNV x)const{auto const profilingStart=this->profiler.begin(1103);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB1HNVPROC)this->m_profiledFunctions[1103]))(index,x);this->profiler.end(1103,profilingStart);}
+void m_glWindowPos3svMESA_profiling(const GLshort* v)const{auto const profilingStart=this->profiler.begin(1104);(this->*((FunctionTable::MEMBERPFNGLWINDOWPOS3SVMESAPROC)this->m_profiledFunctions[1104]))(v);this->profiler.end(1104,profilingStart);}
+void m_glStencilOpSeparateATI_profiling(GLenum face,GLenum sfail,GLenum dpfail,GLenum dppass)const{auto const profilingStart=this->profiler.begin(1105);(this->*((FunctionTable::MEMBERPFNGLSTENCILOPSEPARATEATIPROC)this->m_profiledFunctions[1105]))(face,sfail,dpfail,dppass);this->profiler.end(1105,profilingStart);}
+void m_glDrawElementsBaseVertex_profiling(GLenum mode,GLsizei count,GLenum type,const void* indices,GLint basevertex)const{auto const profilingStart=this->profiler.begin(1106);(this->*((FunctionTable::MEMBERPFNGLDRAWELEMENTSBASEVERTEXPROC)this->m_profiledFunctions[1106]))(mode,count,type,indices,basevertex);this->profiler.end(1106,profilingStart);}
+void m_glBlendEquationSeparateiARB_profiling(GLuint buf,GLenum modeRGB,GLenum modeAlpha)const{auto const profilingStart=this->profiler.begin(1107);(this->*((FunctionTable::MEMBERPFNGLBLENDEQUATIONSEPARATEIARBPROC)this->m_profiledFunctions[1107]))(buf,modeRGB,modeAlpha);this->profiler.end(1107,profilingStart);}
+void m_glVertexAttrib1fNV_profiling(GLuint index,GLfloat x)const{auto const profilingStart=this->profiler.begin(1108);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB1FNVPROC)this->m_profiledFunctions[1108]))(index,x);this->profiler.end(1108,profilingStart);}
+void m_glMapVertexAttrib2fAPPLE_profiling(GLuint index,GLuint size,GLfloat u1,GLfloat u2,GLint ustride,GLint uorder,GLfloat v1,GLfloat v2,GLint vstride,GLint vorder,const GLfloat* points)const{auto const profilingStart=this->profiler.begin(1109);(this->*((FunctionTable::MEMBERPFNGLMAPVERTEXATTRIB2FAPPLEPROC)this->m_profiledFunctions[1109]))(index,size,u1,u2,ustride,uorder,v1,v2,vstride,vorder,points);this->profiler.end(1109,profilingStart);}
+void m_glCompressedTextureSubImage1DEXT_profiling(GLuint texture,GLenum target,GLint level,GLint xoffset,GLsizei width,GLenum format,GLsizei imageSize,const void* bits)const{auto const profilingStart=this->profiler.begin(1110);(this->*((FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTURESUBIMAGE1DEXTPROC)this->m_profiledFunctions[1110]))(texture,target,level,xoffset,width,format,imageSize,bits);this->profiler.end(1110,profilingStart);}
+void m_glClearBufferSubData_profiling(GLenum target,GLenum internalformat,GLintptr offset,GLsizeiptr size,GLenum format,GLenum type,const void* data)const{auto const profilingStart=this->profiler.begin(1111);(this->*((FunctionTable::MEMBERPFNGLCLEARBUFFERSUBDATAPROC)this->m_profiledFunctions[1111]))(target,internalformat,offset,size,format,type,data);this->profiler.end(1111,profilingStart);}
+void m_glTexStorage1D_profiling(GLenum target,GLsizei levels,GLenum internalformat,GLsizei width)const{auto const profilingStart=this->profiler.begin(1112);(this->*((FunctionTable::MEMBERPFNGLTEXSTORAGE1DPROC)this->m_profiledFunctions[1112]))(target,levels,internalformat,width);this->profiler.end(1112,profilingStart);}
+void m_glVertexAttribI3iEXT_profiling(GLuint index,GLint x,GLint y,GLint z)const{auto const profilingStart=this->profiler.begin(1113);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBI3IEXTPROC)this->m_profiledFunctions[1113]))(index,x,y,z);this->profiler.end(1113,profilingStart);}
+void m_glMakeTextureHandleNonResidentARB_profiling(GLuint64 handle)const{auto const profilingStart=this->profiler.begin(1114);(this->*((FunctionTable::MEMBERPFNGLMAKETEXTUREHANDLENONRESIDENTARBPROC)this->m_profiledFunctions[1114]))(handle);this->profiler.end(1114,profilingStart);}
+void m_glMultiDrawElementArrayAPPLE_profiling(GLenum mode,const GLint* first,const GLsizei* count,GLsizei primcount)const{auto const profilingStart=this->profiler.begin(1115);(this->*((FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTARRAYAPPLEPROC)this->m_profiledFunctions[1115]))(mode,first,count,primcount);this->profiler.end(1115,profilingStart);}
+void m_glVertexStream4dATI_profiling(GLenum stream,GLdouble x,GLdouble y,GLdouble z,GLdouble w)const{auto const profilingStart=this->profiler.begin(1116);(this->*((FunctionTable::MEMBERPFNGLVERTEXSTREAM4DATIPROC)this->m_profiledFunctions[1116]))(stream,x,y,z,w);this->profiler.end(1116,profilingStart);}
+void m_glProgramUniformMatrix2dvEXT_profiling(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{auto const profilingStart=this->profiler.begin(1117);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2DVEXTPROC)this->m_profiledFunctions[1117]))(program,location,count,transpose,value);this->profiler.end(1117,profilingStart);}
+void m_glVertexAttribs2hvNV_profiling(GLuint index,GLsizei n,const GLhalfNV* v)const{auto const profilingStart=this->profiler.begin(1118);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBS2HVNVPROC)this->m_profiledFunctions[1118]))(index,n,v);this->profiler.end(1118,profilingStart);}
+void m_glGetUniformiv_profiling(GLuint program,GLint location,GLint* params)const{auto const profilingStart=this->profiler.begin(1119);(this->*((FunctionTable::MEMBERPFNGLGETUNIFORMIVPROC)this->m_profiledFunctions[1119]))(program,location,params);this->profiler.end(1119,profilingStart);}
+void m_glClipPlanefOES_profiling(GLenum plane,const GLfloat* equation)const{auto const profilingStart=this->profiler.begin(1120);(this->*((FunctionTable::MEMBERPFNGLCLIPPLANEFOESPROC)this->m_profiledFunctions[1120]))(plane,equation);this->profiler.end(1120,profilingStart);}
+void m_glRenderbufferStorage_profiling(GLenum target,GLenum internalformat,GLsizei width,GLsizei height)const{auto const profilingStart=this->profiler.begin(1121);(this->*((FunctionTable::MEMBERPFNGLRENDERBUFFERSTORAGEPROC)this->m_profiledFunctions[1121]))(target,internalformat,width,height);this->profiler.end(1121,profilingStart);}
+void m_glUniform4ui_profiling(GLint location,GLuint v0,GLuint v1,GLuint v2,GLuint v3)const{auto const profilingStart=this->profiler.begin(1122);(this->*((FunctionTable::MEMBERPFNGLUNIFORM4UIPROC)this->m_profiledFunctions[1122]))(location,v0,v1,v2,v3);this->profiler.end(1122,profilingStart);}
+void m_glBindFramebuffer_profiling(GLenum target,GLuint framebuffer)const{auto const profilingStart=this->profiler.begin(1123);(this->*((FunctionTable::MEMBERPFNGLBINDFRAMEBUFFERPROC)this->m_profiledFunctions[1123]))(target,framebuffer);this->profiler.end(1123,profilingStart);}
+void m_glValidateProgramARB_profiling(GLhandleARB programObj)const{auto const profilingStart=this->profiler.begin(1124);(this->*((FunctionTable::MEMBERPFNGLVALIDATEPROGRAMARBPROC)this->m_profiledFunctions[1124]))(programObj);this->profiler.end(1124,profilingStart);}
+void m_glTexGenf_profiling(GLenum coord,GLenum pname,GLfloat param)const{auto const profilingStart=this->profiler.begin(1125);(this->*((FunctionTable::MEMBERPFNGLTEXGENFPROC)this->m_profiledFunctions[1125]))(coord,pname,param);this->profiler.end(1125,profilingStart);}
+void m_glTexGend_profiling(GLenum coord,GLenum pname,GLdouble param)const{auto const profilingStart=this->profiler.begin(1126);(this->*((FunctionTable::MEMBERPFNGLTEXGENDPROC)this->m_profiledFunctions[1126]))(coord,pname,param);this->profiler.end(1126,profilingStart);}
+void m_glTexGeni_profiling(GLenum coord,GLenum pname,GLint param)const{auto const profilingStart=this->profiler.begin(1127);(this->*((FunctionTable::MEMBERPFNGLTEXGENIPROC)this->m_profiledFunctions[1127]))(coord,pname,param);this->profiler.end(1127,profilingStart);}
+void m_glDeleteFramebuffersEXT_profiling(GLsizei n,const GLuint* framebuffers)const{auto const profilingStart=this->profiler.begin(1128);(this->*((FunctionTable::MEMBERPFNGLDELETEFRAMEBUFFERSEXTPROC)this->m_profiledFunctions[1128]))(n,framebuffers);this->profiler.end(1128,profilingStart);}
+void m_glResetMinmaxEXT_profiling(GLenum target)const{auto const profilingStart=this->profiler.begin(1129);(this->*((FunctionTable::MEMBERPFNGLRESETMINMAXEXTPROC)this->m_profiledFunctions[1129]))(target);this->profiler.end(1129,profilingStart);}
+void m_glVertexAttrib1fvNV_profiling(GLuint index,const GLfloat* v)const{auto const profilingStart=this->profiler.begin(1130);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB1FVNVPROC)this->m_profiledFunctions[1130]))(index,v);this->profiler.end(1130,profilingStart);}
+GLboolean m_glIsQueryARB_profiling(GLuint id)const{auto const profilingStart=this->profiler.begin(1131);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLISQUERYARBPROC)this->m_profiledFunctions[1131]))(id);this->profiler.end(1131,profilingStart);return profilingResult;}
+void m_glEnableVariantClientStateEXT_profiling(GLuint id)const{auto const profilingStart=this->profiler.begin(1132);(this->*((FunctionTable::MEMBERPFNGLENABLEVARIANTCLIENTSTATEEXTPROC)this->m_profiledFunctions[1132]))(id);this->profiler.end(1132,profilingStart);}
+void m_glScissorIndexed_profiling(GLuint index,GLint left,GLint bottom,GLsizei width,GLsizei height)const{auto const profilingStart=this->profiler.begin(1133);(this->*((FunctionTable::MEMBERPFNGLSCISSORINDEXEDPROC)this->m_profiledFunctions[1133]))(index,left,bottom,width,height);this->profiler.end(1133,profilingStart);}
+void m_glGetInvariantIntegervEXT_profiling(GLuint id,GLenum value,GLint* data)const{auto const profilingStart=this->profiler.begin(1134);(this->*((FunctionTable::MEMBERPFNGLGETINVARIANTINTEGERVEXTPROC)this->m_profiledFunctions[1134]))(id,value,data);this->profiler.end(1134,profilingStart);}
+void m_glProgramLocalParameterI4uiNV_profiling(GLenum target,GLuint index,GLuint x,GLuint y,GLuint z,GLuint w)const{auto const profilingStart=this->profiler.begin(1135);(this->*((FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERI4UINVPROC)this->m_profiledFunctions[1135]))(target,index,x,y,z,w);this->profiler.end(1135,profilingStart);}
+void m_glConvolutionParameterxvOES_profiling(GLenum target,GLenum pname,const GLfixed* params)const{auto const profilingStart=this->profiler.begin(1136);(this->*((FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERXVOESPROC)this->m_profiledFunctions[1136]))(target,pname,params);this->profiler.end(1136,profilingStart);}
+void m_glGenFramebuffersEXT_profiling(GLsizei n,GLuint* framebuffers)const{auto const profilingStart=this->profiler.begin(1137);(this->*((FunctionTable::MEMBERPFNGLGENFRAMEBUFFERSEXTPROC)this->m_profiledFunctions[1137]))(n,framebuffers);this->profiler.end(1137,profilingStart);}
+void m_glVertexArrayColorOffsetEXT_profiling(GLuint vaobj,GLuint buffer,GLint size,GLenum type,GLsizei stride,GLintptr offset)const{auto const profilingStart=this->profiler.begin(1138);(this->*((FunctionTable::MEMBERPFNGLVERTEXARRAYCOLOROFFSETEXTPROC)this->m_profiledFunctions[1138]))(vaobj,buffer,size,type,stride,offset);this->profiler.end(1138,profilingStart);}
+void m_glMultiTexCoord3ivARB_profiling(GLenum target,const GLint* v)const{auto const profilingStart=this->profiler.begin(1139);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD3IVARBPROC)this->m_profiledFunctions[1139]))(target,v);this->profiler.end(1139,profilingStart);}
+void m_glVertexWeightfEXT_profiling(GLfloat weight)const{auto const profilingStart=this->profiler.begin(1140);(this->*((FunctionTable::MEMBERPFNGLVERTEXWEIGHTFEXTPROC)this->m_profiledFunctions[1140]))(weight);this->profiler.end(1140,profilingStart);}
+void m_glRasterPos4dv_profiling(const GLdouble* v)const{auto const profilingStart=this->profiler.begin(1141);(this->*((FunctionTable::MEMBERPFNGLRASTERPOS4DVPROC)this->m_profiledFunctions[1141]))(v);this->profiler.end(1141,profilingStart);}
+GLboolean m_glIsTextureHandleResidentARB_profiling(GLuint64 handle)const{auto const profilingStart=this->profiler.begin(1142);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLISTEXTUREHANDLERESIDENTARBPROC)this->m_profiledFunctions[1142]))(handle);this->profiler.end(1142,profilingStart);return profilingResult;}
+void m_glRasterPos2dv_profiling(const GLdouble* v)const{auto const profilingStart=this->profiler.begin(1143);(this->*((FunctionTable::MEMBERPFNGLRASTERPOS2DVPROC)this->m_profiledFunctions[1143]))(v);this->profiler.end(1143,profilingStart);}
+void m_glWindowPos4ivMESA_profiling(const GLint* v)const{auto const profilingStart=this->profiler.begin(1144);(this->*((FunctionTable::MEMBERPFNGLWINDOWPOS4IVMESAPROC)this->m_profiledFunctions[1144]))(v);this->profiler.end(1144,profilingStart);}
+void m_glGetVariantPointervEXT_profiling(GLuint id,GLenum value,void** data)const{auto const profilingStart=this->profiler.begin(1145);(this->*((FunctionTable::MEMBERPFNGLGETVARIANTPOINTERVEXTPROC)this->m_profiledFunctions[1145]))(id,value,data);this->profiler.end(1145,profilingStart);}
+void* m_glMapNamedBufferRangeEXT_profiling(GLuint buffer,GLintptr offset,GLsizeiptr length,GLbitfield access)const{auto const profilingStart=this->profiler.begin(1146);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLMAPNAMEDBUFFERRANGEEXTPROC)this->m_profiledFunctions[1146]))(buffer,offset,length,access);this->profiler.end(1146,profilingStart);return profilingResult;}
+void m_glGetnUniformui64vARB_profiling(GLuint program,GLint location,GLsizei bufSize,GLuint64* params)const{auto const profilingStart=this->profiler.begin(1147);(this->*((FunctionTable::MEMBERPFNGLGETNUNIFORMUI64VARBPROC)this->m_profiledFunctions[1147]))(program,location,bufSize,params);this->profiler.end(1147,profilingStart);}
+GLuint m_glCreateShaderProgramv_profiling(GLenum type,GLsizei count,const GLchar*const* strings)const{auto const profilingStart=this->profiler.begin(1148);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLCREATESHADERPROGRAMVPROC)this->m_profiledFunctions[1148]))(type,count,strings);this->profiler.end(1148,profilingStart);return profilingResult;}
+void m_glGetQueryObjectiv_profiling(GLuint id,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(1149);(this->*((FunctionTable::MEMBERPFNGLGETQUERYOBJECTIVPROC)this->m_profiledFunctions[1149]))(id,pname,params);this->profiler.end(1149,profilingStart);}
+void m_glPNTrianglesfATI_profiling(GLenum pname,GLfloat param)const{auto const profilingStart=this->profiler.begin(1150);(this->*((FunctionTable::MEMBERPFNGLPNTRIANGLESFATIPROC)this->m_profiledFunctions[1150]))(pname,param);this->profiler.end(1150,profilingStart);}
+void m_glGlobalAlphaFactorusSUN_profiling(GLushort factor)const{auto const profilingStart=this->profiler.begin(1151);(this->*((FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORUSSUNPROC)this->m_profiledFunctions[1151]))(factor);this->profiler.end(1151,profilingStart);}
+void m_glVertexAttrib3dvNV_profiling(GLuint index,const GLdouble* v)const{auto const profilingStart=this->profiler.begin(1152);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB3DVNVPROC)this->m_profiledFunctions[1152]))(index,v);this->profiler.end(1152,profilingStart);}
+void m_glMultiTexCoord3sARB_profiling(GLenum target,GLshort s,GLshort t,GLshort r)const{auto const profilingStart=this->profiler.begin(1153);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD3SARBPROC)this->m_profiledFunctions[1153]))(target,s,t,r);this->profiler.end(1153,profilingStart);}
+void m_glGenerateMipmap_profiling(GLenum target)const{auto const profilingStart=this->profiler.begin(1154);(this->*((FunctionTable::MEMBERPFNGLGENERATEMIPMAPPROC)this->m_profiledFunctions[1154]))(target);this->profiler.end(1154,profilingStart);}
+void m_glCompressedTextureSubImage2D_profiling(GLuint texture,GLint level,GLint xoffset,GLint yoffset,GLsizei width,GLsizei height,GLenum format,GLsizei imageSize,const void* data)const{auto const profilingStart=this->profiler.begin(1155);(this->*((FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC)this->m_profiledFunctions[1155]))(texture,level,xoffset,yoffset,width,height,format,imageSize,data);this->profiler.end(1155,profilingStart);}
+void m_glNamedRenderbufferStorageMultisampleEXT_profiling(GLuint renderbuffer,GLsizei samples,GLenum internalformat,GLsizei width,GLsizei height)const{auto const profilingStart=this->profiler.begin(1156);(this->*((FunctionTable::MEMBERPFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEEXTPROC)this->m_profiledFunctions[1156]))(renderbuffer,samples,internalformat,width,height);this->profiler.end(1156,profilingStart);}
+void m_glPolygonOffsetClampEXT_profiling(GLfloat factor,GLfloat units,GLfloat clamp)const{auto const profilingStart=this->profiler.begin(1157);(this->*((FunctionTable::MEMBERPFNGLPOLYGONOFFSETCLAMPEXTPROC)this->m_profiledFunctions[1157]))(factor,units,clamp);this->profiler.end(1157,profilingStart);}
+void m_glTextureRangeAPPLE_profiling(GLenum target,GLsizei length,const void* pointer)const{auto const profilingStart=this->profiler.begin(1158);(this->*((FunctionTable::MEMBERPFNGLTEXTURERANGEAPPLEPROC)this->m_profiledFunctions[1158]))(target,length,pointer);this->profiler.end(1158,profilingStart);}
+void m_glBlendEquationIndexedAMD_profiling(GLuint buf,GLenum mode)const{auto const profilingStart=this->profiler.begin(1159);(this->*((FunctionTable::MEMBERPFNGLBLENDEQUATIONINDEXEDAMDPROC)this->m_profiledFunctions[1159]))(buf,mode);this->profiler.end(1159,profilingStart);}
+void m_glTexCoord2d_profiling(GLdouble s,GLdouble t)const{auto const profilingStart=this->profiler.begin(1160);(this->*((FunctionTable::MEMBERPFNGLTEXCOORD2DPROC)this->m_profiledFunctions[1160]))(s,t);this->profiler.end(1160,profilingStart);}
+void m_glPointParameteri_profiling(GLenum pname,GLint param)const{auto const profilingStart=this->profiler.begin(1161);(this->*((FunctionTable::MEMBERPFNGLPOINTPARAMETERIPROC)this->m_profiledFunctions[1161]))(pname,param);this->profiler.end(1161,profilingStart);}
+void m_glTexCoord2f_profiling(GLfloat s,GLfloat t)const{auto const profilingStart=this->profiler.begin(1162);(this->*((FunctionTable::MEMBERPFNGLTEXCOORD2FPROC)this->m_profiledFunctions[1162]))(s,t);this->profiler.end(1162,profilingStart);}
+void m_glColor4iv_profiling(const GLint* v)const{auto const profilingStart=this->profiler.begin(1163);(this->*((FunctionTable::MEMBERPFNGLCOLOR4IVPROC)this->m_profiledFunctions[1163]))(v);this->profiler.end(1163,profilingStart);}
+void* m_glMapNamedBufferRange_profiling(GLuint buffer,GLintptr offset,GLsizeiptr length,GLbitfield access)const{auto const profilingStart=this->profiler.begin(1164);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLMAPNAMEDBUFFERRANGEPROC)this->m_profiledFunctions[1164]))(buffer,offset,length,access);this->profiler.end(1164,profilingStart);return profilingResult;}
+GLboolean m_glUnmapBuffer_profiling(GLenum target)const{auto const profilingStart=this->profiler.begin(1165);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLUNMAPBUFFERPROC)this->m_profiledFunctions[1165]))(target);this->profiler.end(1165,profilingStart);return profilingResult;}
+void m_glSampleMaskEXT_profiling(GLclampf value,GLboolean invert)const{auto const profilingStart=this->profiler.begin(1166);(this->*((FunctionTable::MEMBERPFNGLSAMPLEMASKEXTPROC)this->m_profiledFunctions[1166]))(value,invert);this->profiler.end(1166,profilingStart);}
+void m_glTexCoord2i_profiling(GLint s,GLint t)const{auto const profilingStart=this->profiler.begin(1167);(this->*((FunctionTable::MEMBERPFNGLTEXCOORD2IPROC)this->m_profiledFunctions[1167]))(s,t);this->profiler.end(1167,profilingStart);}
+void m_glTexCoord1xvOES_profiling(const GLfixed* coords)const{auto const profilingStart=this->profiler.begin(1168);(this->*((FunctionTable::MEMBERPFNGLTEXCOORD1XVOESPROC)this->m_profiledFunctions[1168]))(coords);this->profiler.end(1168,profilingStart);}
+void m_glVertexAttrib1sARB_profiling(GLuint index,GLshort x)const{auto const profilingStart=this->profiler.begin(1169);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB1SARBPROC)this->m_profiledFunctions[1169]))(index,x);this->profiler.end(1169,profilingStart);}
+void m_glGetVertexArrayiv_profiling(GLuint vaobj,GLenum pname,GLint* param)const{auto const profilingStart=this->profiler.begin(1170);(this->*((FunctionTable::MEMBERPFNGLGETVERTEXARRAYIVPROC)this->m_profiledFunctions[1170]))(vaobj,pname,param);this->profiler.end(1170,profilingStart);}
+void m_glProgramParameter4dvNV_profiling(GLenum target,GLuint index,const GLdouble* v)const{auto const profilingStart=this->profiler.begin(1171);(this->*((FunctionTable::MEMBERPFNGLPROGRAMPARAMETER4DVNVPROC)this->m_profiledFunctions[1171]))(target,index,v);this->profiler.end(1171,profilingStart);}
+void m_glTexCoord2s_profiling(GLshort s,GLshort t)const{auto const profilingStart=this->profiler.begin(1172);(this->*((FunctionTable::MEMBERPFNGLTEXCOORD2SPROC)this->m_profiledFunctions[1172]))(s,t);this->profiler.end(1172,profilingStart);}
+void m_glTextureParameterIuivEXT_profiling(GLuint texture,GLenum target,GLenum pname,const GLuint* params)const{auto const profilingStart=this->profiler.begin(1173);(this->*((FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIUIVEXTPROC)this->m_profiledFunctions[1173]))(texture,target,pname,params);this->profiler.end(1173,profilingStart);}
+void m_glGetColorTableParameterfvSGI_profiling(GLenum target,GLenum pname,GLfloat* params)const{auto const profilingStart=this->profiler.begin(1174);(this->*((FunctionTable::MEMBERPFNGLGETCOLORTABLEPARAMETERFVSGIPROC)this->m_profiledFunctions[1174]))(target,pname,params);this->profiler.end(1174,profilingStart);}
+void m_glTexCoord4dv_profiling(const GLdouble* v)const{auto const profilingStart=this->profiler.begin(1175);(this->*((FunctionTable::MEMBERPFNGLTEXCOORD4DVPROC)this->m_profiledFunctions[1175]))(v);this->profiler.end(1175,profilingStart);}
+void m_glVertexAttrib1svNV_profiling(GLuint index,const GLshort* v)const{auto const profilingStart=this->profiler.begin(1176);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB1SVNVPROC)this->m_profiledFunctions[1176]))(index,v);this->profiler.end(1176,profilingStart);}
+void m_glNamedFramebufferTextureFaceEXT_profiling(GLuint framebuffer,GLenum attachment,GLuint texture,GLint level,GLenum face)const{auto const profilingStart=this->profiler.begin(1177);(this->*((FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTUREFACEEXTPROC)this->m_profiledFunctions[1177]))(framebuffer,attachment,texture,level,face);this->profiler.end(1177,profilingStart);}
+void m_glProgramUniform2ui64vNV_profiling(GLuint program,GLint location,GLsizei count,const GLuint64EXT* value)const{auto const profilingStart=this->profiler.begin(1178);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UI64VNVPROC)this->m_profiledFunctions[1178]))(program,location,count,value);this->profiler.end(1178,profilingStart);}
+void m_glNormal3dv_profiling(const GLdouble* v)const{auto const profilingStart=this->profiler.begin(1179);(this->*((FunctionTable::MEMBERPFNGLNORMAL3DVPROC)this->m_profiledFunctions[1179]))(v);this->profiler.end(1179,profilingStart);}
+void m_glReleaseShaderCompiler_profiling()const{auto const profilingStart=this->profiler.begin(1180);(this->*((FunctionTable::MEMBERPFNGLRELEASESHADERCOMPILERPROC)this->m_profiledFunctions[1180]))();this->profiler.end(1180,profilingStart);}
+void m_glTexCoord3bvOES_profiling(const GLbyte* coords)const{auto const profilingStart=this->profiler.begin(1181);(this->*((FunctionTable::MEMBERPFNGLTEXCOORD3BVOESPROC)this->m_profiledFunctions[1181]))(coords);this->profiler.end(1181,profilingStart);}
+GLboolean m_glIsVertexAttribEnabledAPPLE_profiling(GLuint index,GLenum pname)const{auto const profilingStart=this->profiler.begin(1182);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLISVERTEXATTRIBENABLEDAPPLEPROC)this->m_profiledFunctions[1182]))(index,pname);this->profiler.end(1182,profilingStart);return profilingResult;}
+void m_glTexCoord1dv_profiling(const GLdouble* v)const{auto const profilingStart=this->profiler.begin(1183);(this->*((FunctionTable::MEMBERPFNGLTEXCOORD1DVPROC)this->m_profiledFunctions[1183]))(v);this->profiler.end(1183,profilingStart);}
+void m_glReadPixels_profiling(GLint x,GLint y,GLsizei width,GLsizei height,GLenum format,GLenum type,GLvoid* pixels)const{auto const profilingStart=this->profiler.begin(1184);(this->*((FunctionTable::MEMBERPFNGLREADPIXELSPROC)this->m_profiledFunctions[1184]))(x,y,width,height,format,type,pixels);this->profiler.end(1184,profilingStart);}
+void m_glVertexAttribI3iv_profiling(GLuint index,const GLint* v)const{auto const profilingStart=this->profiler.begin(1185);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBI3IVPROC)this->m_profiledFunctions[1185]))(index,v);this->profiler.end(1185,profilingStart);}
+void m_glSetFenceAPPLE_profiling(GLuint fence)const{auto const profilingStart=this->profiler.begin(1186);(this->*((FunctionTable::MEMBERPFNGLSETFENCEAPPLEPROC)this->m_profiledFunctions[1186]))(fence);this->profiler.end(1186,profilingStart);}
+void m_glWeightsvARB_profiling(GLint size,const GLshort* weights)const{auto const profilingStart=this->profiler.begin(1187);(this->*((FunctionTable::MEMBERPFNGLWEIGHTSVARBPROC)this->m_profiledFunctions[1187]))(size,weights);this->profiler.end(1187,profilingStart);}
+void m_glShadeModel_profiling(GLenum mode)const{auto const profilingStart=this->profiler.begin(1188);(this->*((FunctionTable::MEMBERPFNGLSHADEMODELPROC)this->m_profiledFunctions[1188]))(mode);this->profiler.end(1188,profilingStart);}
+void m_glMapGrid1d_profiling(GLint un,GLdouble u1,GLdouble u2)const{auto const profilingStart=this->profiler.begin(1189);(this->*((FunctionTable::MEMBERPFNGLMAPGRID1DPROC)this->m_profiledFunctions[1189]))(un,u1,u2);this->profiler.end(1189,profilingStart);}
+void m_glGetHistogramParameterivEXT_profiling(GLenum target,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(1190);(this->*((FunctionTable::MEMBERPFNGLGETHISTOGRAMPARAMETERIVEXTPROC)this->m_profiledFunctions[1190]))(target,pname,params);this->profiler.end(1190,profilingStart);}
+void m_glConservativeRasterParameteriNV_profiling(GLenum pname,GLint param)const{auto const profilingStart=this->profiler.begin(1191);(this->*((FunctionTable::MEMBERPFNGLCONSERVATIVERASTERPARAMETERINVPROC)this->m_profiledFunctions[1191]))(pname,param);this->profiler.end(1191,profilingStart);}
+void m_glClearNamedBufferData_profiling(GLuint buffer,GLenum internalformat,GLenum format,GLenum type,const void* data)const{auto const profilingStart=this->profiler.begin(1192);(this->*((FunctionTable::MEMBERPFNGLCLEARNAMEDBUFFERDATAPROC)this->m_profiledFunctions[1192]))(buffer,internalformat,format,type,data);this->profiler.end(1192,profilingStart);}
+void m_glClearDepthf_profiling(GLfloat d)const{auto const profilingStart=this->profiler.begin(1193);(this->*((FunctionTable::MEMBERPFNGLCLEARDEPTHFPROC)this->m_profiledFunctions[1193]))(d);this->profiler.end(1193,profilingStart);}
+void m_glCreatePerfQueryINTEL_profiling(GLuint queryId,GLuint* queryHandle)const{auto const profilingStart=this->profiler.begin(1194);(this->*((FunctionTable::MEMBERPFNGLCREATEPERFQUERYINTELPROC)this->m_profiledFunctions[1194]))(queryId,queryHandle);this->profiler.end(1194,profilingStart);}
+void m_glFogCoordfEXT_profiling(GLfloat coord)const{auto const profilingStart=this->profiler.begin(1195);(this->*((FunctionTable::MEMBERPFNGLFOGCOORDFEXTPROC)this->m_profiledFunctions[1195]))(coord);this->profiler.end(1195,profilingStart);}
+void m_glVertexAttrib2dARB_profiling(GLuint index,GLdouble x,GLdouble y)const{auto const profilingStart=this->profiler.begin(1196);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB2DARBPROC)this->m_profiledFunctions[1196]))(index,x,y);this->profiler.end(1196,profilingStart);}
+void m_glMultiTexCoord4dARB_profiling(GLenum target,GLdouble s,GLdouble t,GLdouble r,GLdouble q)const{auto const profilingStart=this->profiler.begin(1197);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD4DARBPROC)this->m_profiledFunctions[1197]))(target,s,t,r,q);this->profiler.end(1197,profilingStart);}
+void m_glReadnPixelsARB_profiling(GLint x,GLint y,GLsizei width,GLsizei height,GLenum format,GLenum type,GLsizei bufSize,void* data)const{auto const profilingStart=this->profiler.begin(1198);(this->*((FunctionTable::MEMBERPFNGLREADNPIXELSARBPROC)this->m_profiledFunctions[1198]))(x,y,width,height,format,type,bufSize,data);this->profiler.end(1198,profilingStart);}
+void m_glMultiTexBufferEXT_profiling(GLenum texunit,GLenum target,GLenum internalformat,GLuint buffer)const{auto const profilingStart=this->profiler.begin(1199);(this->*((FunctionTable::MEMBERPFNGLMULTITEXBUFFEREXTPROC)this->m_profiledFunctions[1199]))(texunit,target,internalformat,buffer);this->profiler.end(1199,profilingStart);}
+void m_glWindowPos4dvMESA_profiling(const GLdouble* v)const{auto const profilingStart=this->profiler.begin(1200);(this->*((FunctionTable::MEMBERPFNGLWINDOWPOS4DVMESAPROC)this->m_profiledFunctions[1200]))(v);this->profiler.end(1200,profilingStart);}
+void m_glInvalidateNamedFramebufferData_profiling(GLuint framebuffer,GLsizei numAttachments,const GLenum* attachments)const{auto const profilingStart=this->profiler.begin(1201);(this->*((FunctionTable::MEMBERPFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC)this->m_profiledFunctions[1201]))(framebuffer,numAttachments,attachments);this->profiler.end(1201,profilingStart);}
+void m_glSecondaryColorPointerListIBM_profiling(GLint size,GLenum type,GLint stride,const void** pointer,GLint ptrstride)const{auto const profilingStart=this->profiler.begin(1202);(this->*((FunctionTable::MEMBERPFNGLSECONDARYCOLORPOINTERLISTIBMPROC)this->m_profiledFunctions[1202]))(size,type,stride,pointer,ptrstride);this->profiler.end(1202,profilingStart);}
+void m_glRectiv_profiling(const GLint* v1,const GLint* v2)const{auto const profilingStart=this->profiler.begin(1203);(this->*((FunctionTable::MEMBERPFNGLRECTIVPROC)this->m_profiledFunctions[1203]))(v1,v2);this->profiler.end(1203,profilingStart);}
+void m_glColorP4ui_profiling(GLenum type,GLuint color)const{auto const profilingStart=this->profiler.begin(1204);(this->*((FunctionTable::MEMBERPFNGLCOLORP4UIPROC)this->m_profiledFunctions[1204]))(type,color);this->profiler.end(1204,profilingStart);}
+void m_glUseProgramStages_profiling(GLuint pipeline,GLbitfield stages,GLuint program)const{auto const profilingStart=this->profiler.begin(1205);(this->*((FunctionTable::MEMBERPFNGLUSEPROGRAMSTAGESPROC)this->m_profiledFunctions[1205]))(pipeline,stages,program);this->profiler.end(1205,profilingStart);}
+void m_glRasterPos3dv_profiling(const GLdouble* v)const{auto const profilingStart=this->profiler.begin(1206);(this->*((FunctionTable::MEMBERPFNGLRASTERPOS3DVPROC)this->m_profiledFunctions[1206]))(v);this->profiler.end(1206,profilingStart);}
+void m_glPathTexGenNV_profiling(GLenum texCoordSet,GLenum genMode,GLint components,const GLfloat* coeffs)const{auto const profilingStart=this->profiler.begin(1207);(this->*((FunctionTable::MEMBERPFNGLPATHTEXGENNVPROC)this->m_profiledFunctions[1207]))(texCoordSet,genMode,components,coeffs);this->profiler.end(1207,profilingStart);}
+void m_glVertexBlendEnviATI_profiling(GLenum pname,GLint param)const{auto const profilingStart=this->profiler.begin(1208);(this->*((FunctionTable::MEMBERPFNGLVERTEXBLENDENVIATIPROC)this->m_profiledFunctions[1208]))(pname,param);this->profiler.end(1208,profilingStart);}
+void m_glUniform3i64ARB_profiling(GLint location,GLint64 x,GLint64 y,GLint64 z)const{auto const profilingStart=this->profiler.begin(1209);(this->*((FunctionTable::MEMBERPFNGLUNIFORM3I64ARBPROC)this->m_profiledFunctions[1209]))(location,x,y,z);this->profiler.end(1209,profilingStart);}
+void m_glLoadMatrixf_profiling(const GLfloat* m)const{auto const profilingStart=this->profiler.begin(1210);(this->*((FunctionTable::MEMBERPFNGLLOADMATRIXFPROC)this->m_profiledFunctions[1210]))(m);this->profiler.end(1210,profilingStart);}
+void m_glProgramUniform2dEXT_profiling(GLuint program,GLint location,GLdouble x,GLdouble y)const{auto const profilingStart=this->profiler.begin(1211);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2DEXTPROC)this->m_profiledFunctions[1211]))(program,location,x,y);this->profiler.end(1211,profilingStart);}
+void m_glVertexAttribI4iv_profiling(GLuint index,const GLint* v)const{auto const profilingStart=this->profiler.begin(1212);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBI4IVPROC)this->m_profiledFunctions[1212]))(index,v);this->profiler.end(1212,profilingStart);}
+void m_glNamedFramebufferDrawBuffer_profiling(GLuint framebuffer,GLenum buf)const{auto const profilingStart=this->profiler.begin(1213);(this->*((FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC)this->m_profiledFunctions[1213]))(framebuffer,buf);this->profiler.end(1213,profilingStart);}
+void m_glColor4ubv_profiling(const GLubyte* v)const{auto const profilingStart=this->profiler.begin(1214);(this->*((FunctionTable::MEMBERPFNGLCOLOR4UBVPROC)this->m_profiledFunctions[1214]))(v);this->profiler.end(1214,profilingStart);}
+void m_glColor3hvNV_profiling(const GLhalfNV* v)const{auto const profilingStart=this->profiler.begin(1215);(this->*((FunctionTable::MEMBERPFNGLCOLOR3HVNVPROC)this->m_profiledFunctions[1215]))(v);this->profiler.end(1215,profilingStart);}
+void m_glGetMapAttribParameterfvNV_profiling(GLenum target,GLuint index,GLenum pname,GLfloat* params)const{auto const profilingStart=this->profiler.begin(1216);(this->*((FunctionTable::MEMBERPFNGLGETMAPATTRIBPARAMETERFVNVPROC)this->m_profiledFunctions[1216]))(target,index,pname,params);this->profiler.end(1216,profilingStart);}
+void m_glGetBufferSubData_profiling(GLenum target,GLintptr offset,GLsizeiptr size,void* data)const{auto const profilingStart=this->profiler.begin(1217);(this->*((FunctionTable::MEMBERPFNGLGETBUFFERSUBDATAPROC)this->m_profiledFunctions[1217]))(target,offset,size,data);this->profiler.end(1217,profilingStart);}
+void m_glGetVertexAttribLdv_profiling(GLuint index,GLenum pname,GLdouble* params)const{auto const profilingStart=this->profiler.begin(1218);(this->*((FunctionTable::MEMBERPFNGLGETVERTEXATTRIBLDVPROC)this->m_profiledFunctions[1218]))(index,pname,params);this->profiler.end(1218,profilingStart);}
+void m_glGetnUniformuiv_profiling(GLuint program,GLint location,GLsizei bufSize,GLuint* params)const{auto const profilingStart=this->profiler.begin(1219);(this->*((FunctionTable::MEMBERPFNGLGETNUNIFORMUIVPROC)this->m_profiledFunctions[1219]))(program,location,bufSize,params);this->profiler.end(1219,profilingStart);}
+void m_glGetUniformui64vNV_profiling(GLuint program,GLint location,GLuint64EXT* params)const{auto const profilingStart=this->profiler.begin(1220);(this->*((FunctionTable::MEMBERPFNGLGETUNIFORMUI64VNVPROC)this->m_profiledFunctions[1220]))(program,location,params);this->profiler.end(1220,profilingStart);}
+void m_glNamedRenderbufferStorageEXT_profiling(GLuint renderbuffer,GLenum internalformat,GLsizei width,GLsizei height)const{auto const profilingStart=this->profiler.begin(1221);(this->*((FunctionTable::MEMBERPFNGLNAMEDRENDERBUFFERSTORAGEEXTPROC)this->m_profiledFunctions[1221]))(renderbuffer,internalformat,width,height);this->profiler.end(1221,profilingStart);}
+void m_glVertexAttrib3dNV_profiling(GLuint index,GLdouble x,GLdouble y,GLdouble z)const{auto const profilingStart=this->profiler.begin(1222);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB3DNVPROC)this->m_profiledFunctions[1222]))(index,x,y,z);this->profiler.end(1222,profilingStart);}
+void m_glTextureStorage1DEXT_profiling(GLuint texture,GLenum target,GLsizei levels,GLenum internalformat,GLsizei width)const{auto const profilingStart=this->profiler.begin(1223);(this->*((FunctionTable::MEMBERPFNGLTEXTURESTORAGE1DEXTPROC)this->m_profiledFunctions[1223]))(texture,target,levels,internalformat,width);this->profiler.end(1223,profilingStart);}
+void m_glPixelTexGenParameteriSGIS_profiling(GLenum pname,GLint param)const{auto const profilingStart=this->profiler.begin(1224);(this->*((FunctionTable::MEMBERPFNGLPIXELTEXGENPARAMETERISGISPROC)this->m_profiledFunctions[1224]))(pname,param);this->profiler.end(1224,profilingStart);}
+void m_glColorTableEXT_profiling(GLenum target,GLenum internalFormat,GLsizei width,GLenum format,GLenum type,const void* table)const{auto const profilingStart=this->profiler.begin(1225);(this->*((FunctionTable::MEMBERPFNGLCOLORTABLEEXTPROC)this->m_profiledFunctions[1225]))(target,internalFormat,width,format,type,table);this->profiler.end(1225,profilingStart);}
+void m_glGenBuffers_profiling(GLsizei n,GLuint* buffers)const{auto const profilingStart=this->profiler.begin(1226);(this->*((FunctionTable::MEMBERPFNGLGENBUFFERSPROC)this->m_profiledFunctions[1226]))(n,buffers);this->profiler.end(1226,profilingStart);}
+void m_glMultiTexCoord3xvOES_profiling(GLenum texture,const GLfixed* coords)const{auto const profilingStart=this->profiler.begin(1227);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD3XVOESPROC)this->m_profiledFunctions[1227]))(texture,coords);this->profiler.end(1227,profilingStart);}
+void m_glExecuteProgramNV_profiling(GLenum target,GLuint id,const GLfloat* params)const{auto const profilingStart=this->profiler.begin(1228);(this->*((FunctionTable::MEMBERPFNGLEXECUTEPROGRAMNVPROC)this->m_profiledFunctions[1228]))(target,id,params);this->profiler.end(1228,profilingStart);}
+void m_glVariantArrayObjectATI_profiling(GLuint id,GLenum type,GLsizei stride,GLuint buffer,GLuint offset)const{auto const profilingStart=this->profiler.begin(1229);(this->*((FunctionTable::MEMBERPFNGLVARIANTARRAYOBJECTATIPROC)this->m_profiledFunctions[1229]))(id,type,stride,buffer,offset);this->profiler.end(1229,profilingStart);}
+void m_glColor3xvOES_profiling(const GLfixed* components)const{auto const profilingStart=this->profiler.begin(1230);(this->*((FunctionTable::MEMBERPFNGLCOLOR3XVOESPROC)this->m_profiledFunctions[1230]))(components);this->profiler.end(1230,profilingStart);}
+void m_glGetnConvolutionFilterARB_profiling(GLenum target,GLenum format,GLenum type,GLsizei bufSize,void* image)const{auto const profilingStart=this->profiler.begin(1231);(this->*((FunctionTable::MEMBERPFNGLGETNCONVOLUTIONFILTERARBPROC)this->m_profiledFunctions[1231]))(target,format,type,bufSize,image);this->profiler.end(1231,profilingStart);}
+void m_glNormalFormatNV_profiling(GLenum type,GLsizei stride)const{auto const profilingStart=this->profiler.begin(1232);(this->*((FunctionTable::MEMBERPFNGLNORMALFORMATNVPROC)this->m_profiledFunctions[1232]))(type,stride);this->profiler.end(1232,profilingStart);}
+void m_glGetInvariantFloatvEXT_profiling(GLuint id,GLenum value,GLfloat* data)const{auto const profilingStart=this->profiler.begin(1233);(this->*((FunctionTable::MEMBERPFNGLGETINVARIANTFLOATVEXTPROC)this->m_profiledFunctions[1233]))(id,value,data);this->profiler.end(1233,profilingStart);}
+void m_glClearNamedFramebufferiv_profiling(GLuint framebuffer,GLenum buffer,GLint drawbuffer,const GLint* value)const{auto const profilingStart=this->profiler.begin(1234);(this->*((FunctionTable::MEMBERPFNGLCLEARNAMEDFRAMEBUFFERIVPROC)this->m_profiledFunctions[1234]))(framebuffer,buffer,drawbuffer,value);this->profiler.end(1234,profilingStart);}
+void m_glTexImage3D_profiling(GLenum target,GLint level,GLint internalFormat,GLsizei width,GLsizei height,GLsizei depth,GLint border,GLenum format,GLenum type,const GLvoid* pixels)const{auto const profilingStart=this->profiler.begin(1235);(this->*((FunctionTable::MEMBERPFNGLTEXIMAGE3DPROC)this->m_profiledFunctions[1235]))(target,level,internalFormat,width,height,depth,border,format,type,pixels);this->profiler.end(1235,profilingStart);}
+void m_glGenSamplers_profiling(GLsizei count,GLuint* samplers)const{auto const profilingStart=this->profiler.begin(1236);(this->*((FunctionTable::MEMBERPFNGLGENSAMPLERSPROC)this->m_profiledFunctions[1236]))(count,samplers);this->profiler.end(1236,profilingStart);}
+GLboolean m_glIsFramebuffer_profiling(GLuint framebuffer)const{auto const profilingStart=this->profiler.begin(1237);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLISFRAMEBUFFERPROC)this->m_profiledFunctions[1237]))(framebuffer);this->profiler.end(1237,profilingStart);return profilingResult;}
+void m_glProgramUniform3dvEXT_profiling(GLuint program,GLint location,GLsizei count,const GLdouble* value)const{auto const profilingStart=this->profiler.begin(1238);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3DVEXTPROC)this->m_profiledFunctions[1238]))(program,location,count,value);this->profiler.end(1238,profilingStart);}
+void m_glGetVertexAttribfvNV_profiling(GLuint index,GLenum pname,GLfloat* params)const{auto const profilingStart=this->profiler.begin(1239);(this->*((FunctionTable::MEMBERPFNGLGETVERTEXATTRIBFVNVPROC)this->m_profiledFunctions[1239]))(index,pname,params);this->profiler.end(1239,profilingStart);}
+void m_glDrawRangeElementArrayAPPLE_profiling(GLenum mode,GLuint start,GLuint end,GLint first,GLsizei count)const{auto const profilingStart=this->profiler.begin(1240);(this->*((FunctionTable::MEMBERPFNGLDRAWRANGEELEMENTARRAYAPPLEPROC)this->m_profiledFunctions[1240]))(mode,start,end,first,count);this->profiler.end(1240,profilingStart);}
+void m_glUniform3i64NV_profiling(GLint location,GLint64EXT x,GLint64EXT y,GLint64EXT z)const{auto const profilingStart=this->profiler.begin(1241);(this->*((FunctionTable::MEMBERPFNGLUNIFORM3I64NVPROC)this->m_profiledFunctions[1241]))(location,x,y,z);this->profiler.end(1241,profilingStart);}
+void m_glMatrixPopEXT_profiling(GLenum mode)const{auto const profilingStart=this->profiler.begin(1242);(this->*((FunctionTable::MEMBERPFNGLMATRIXPOPEXTPROC)this->m_profiledFunctions[1242]))(mode);this->profiler.end(1242,profilingStart);}
+void m_glVertexStream1sATI_profiling(GLenum stream,GLshort x)const{auto const profilingStart=this->profiler.begin(1243);(this->*((FunctionTable::MEMBERPFNGLVERTEXSTREAM1SATIPROC)this->m_profiledFunctions[1243]))(stream,x);this->profiler.end(1243,profilingStart);}
+void m_glGetnPixelMapuivARB_profiling(GLenum map,GLsizei bufSize,GLuint* values)const{auto const profilingStart=this->profiler.begin(1244);(this->*((FunctionTable::MEMBERPFNGLGETNPIXELMAPUIVARBPROC)this->m_profiledFunctions[1244]))(map,bufSize,values);this->profiler.end(1244,profilingStart);}
+void m_glMultiTexEnviEXT_profiling(GLenum texunit,GLenum target,GLenum pname,GLint param)const{auto const profilingStart=this->profiler.begin(1245);(this->*((FunctionTable::MEMBERPFNGLMULTITEXENVIEXTPROC)this->m_profiledFunctions[1245]))(texunit,target,pname,param);this->profiler.end(1245,profilingStart);}
+void m_glVertexAttribI2iEXT_profiling(GLuint index,GLint x,GLint y)const{auto const profilingStart=this->profiler.begin(1246);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBI2IEXTPROC)this->m_profiledFunctions[1246]))(index,x,y);this->profiler.end(1246,profilingStart);}
+void m_glProgramParameter4fvNV_profiling(GLenum target,GLuint index,const GLfloat* v)const{auto const profilingStart=this->profiler.begin(1247);(this->*((FunctionTable::MEMBERPFNGLPROGRAMPARAMETER4FVNVPROC)this->m_profiledFunctions[1247]))(target,index,v);this->profiler.end(1247,profilingStart);}
+void m_glNamedFramebufferSampleLocationsfvNV_profiling(GLuint framebuffer,GLuint start,GLsizei count,const GLfloat* v)const{auto const profilingStart=this->profiler.begin(1248);(this->*((FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERSAMPLELOCATIONSFVNVPROC)this->m_profiledFunctions[1248]))(framebuffer,start,count,v);this->profiler.end(1248,profilingStart);}
+void m_glTexCoordP4uiv_profiling(GLenum type,const GLuint* coords)const{auto const profilingStart=this->profiler.begin(1249);(this->*((FunctionTable::MEMBERPFNGLTEXCOORDP4UIVPROC)this->m_profiledFunctions[1249]))(type,coords);this->profiler.end(1249,profilingStart);}
+void m_glRectxvOES_profiling(const GLfixed* v1,const GLfixed* v2)const{auto const profilingStart=this->profiler.begin(1250);(this->*((FunctionTable::MEMBERPFNGLRECTXVOESPROC)this->m_profiledFunctions[1250]))(v1,v2);this->profiler.end(1250,profilingStart);}
+void m_glGetVariantIntegervEXT_profiling(GLuint id,GLenum value,GLint* data)const{auto const profilingStart=this->profiler.begin(1251);(this->*((FunctionTable::MEMBERPFNGLGETVARIANTINTEGERVEXTPROC)this->m_profiledFunctions[1251]))(id,value,data);this->profiler.end(1251,profilingStart);}
+void m_glDeleteLists_profiling(GLuint list,GLsizei range)const{auto const profilingStart=this->profiler.begin(1252);(this->*((FunctionTable::MEMBERPFNGLDELETELISTSPROC)this->m_profiledFunctions[1252]))(list,range);this->profiler.end(1252,profilingStart);}
+void m_glTexGendv_profiling(GLenum coord,GLenum pname,const GLdouble* params)const{auto const profilingStart=this->profiler.begin(1253);(this->*((FunctionTable::MEMBERPFNGLTEXGENDVPROC)this->m_profiledFunctions[1253]))(coord,pname,params);this->profiler.end(1253,profilingStart);}
+void m_glVertexP2uiv_profiling(GLenum type,const GLuint* value)const{auto const profilingStart=this->profiler.begin(1254);(this->*((FunctionTable::MEMBERPFNGLVERTEXP2UIVPROC)this->m_profiledFunctions[1254]))(type,value);this->profiler.end(1254,profilingStart);}
+void m_glGetPerfMonitorGroupsAMD_profiling(GLint* numGroups,GLsizei groupsSize,GLuint* groups)const{auto const profilingStart=this->profiler.begin(1255);(this->*((FunctionTable::MEMBERPFNGLGETPERFMONITORGROUPSAMDPROC)this->m_profiledFunctions[1255]))(numGroups,groupsSize,groups);this->profiler.end(1255,profilingStart);}
+void m_glMultTransposeMatrixfARB_profiling(const GLfloat* m)const{auto const profilingStart=this->profiler.begin(1256);(this->*((FunctionTable::MEMBERPFNGLMULTTRANSPOSEMATRIXFARBPROC)this->m_profiledFunctions[1256]))(m);this->profiler.end(1256,profilingStart);}
+void m_glVertexAttribI2ivEXT_profiling(GLuint index,const GLint* v)const{auto const profilingStart=this->profiler.begin(1257);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBI2IVEXTPROC)this->m_profiledFunctions[1257]))(index,v);this->profiler.end(1257,profilingStart);}
+void m_glReplacementCodeuiColor4fNormal3fVertex3fvSUN_profiling(const GLuint* rc,const GLfloat* c,const GLfloat* n,const GLfloat* v)const{auto const profilingStart=this->profiler.begin(1258);(this->*((FunctionTable::MEMBERPFNGLREPLACEMENTCODEUICOLOR4FNORMAL3FVERTEX3FVSUNPROC)this->m_profiledFunctions[1258]))(rc,c,n,v);this->profiler.end(1258,profilingStart);}
+void m_glDeleteStatesNV_profiling(GLsizei n,const GLuint* states)const{auto const profilingStart=this->profiler.begin(1259);(this->*((FunctionTable::MEMBERPFNGLDELETESTATESNVPROC)this->m_profiledFunctions[1259]))(n,states);this->profiler.end(1259,profilingStart);}
+void m_glGetBufferParameteri64v_profiling(GLenum target,GLenum pname,GLint64* params)const{auto const profilingStart=this->profiler.begin(1260);(this->*((FunctionTable::MEMBERPFNGLGETBUFFERPARAMETERI64VPROC)this->m_profiledFunctions[1260]))(target,pname,params);this->profiler.end(1260,profilingStart);}
+void m_glProgramUniform4dv_profiling(GLuint program,GLint location,GLsizei count,const GLdouble* value)const{auto const profilingStart=this->profiler.begin(1261);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4DVPROC)this->m_profiledFunctions[1261]))(program,location,count,value);this->profiler.end(1261,profilingStart);}
+void m_glEdgeFlagPointerEXT_profiling(GLsizei stride,GLsizei count,const GLboolean* pointer)const{auto const profilingStart=this->profiler.begin(1262);(this->*((FunctionTable::MEMBERPFNGLEDGEFLAGPOINTEREXTPROC)this->m_profiledFunctions[1262]))(stride,count,pointer);this->profiler.end(1262,profilingStart);}
+void m_glVideoCaptureStreamParameterivNV_profiling(GLuint video_capture_slot,GLuint stream,GLenum pname,const GLint* params)const{auto const profilingStart=this->profiler.begin(1263);(this->*((FunctionTable::MEMBERPFNGLVIDEOCAPTURESTREAMPARAMETERIVNVPROC)this->m_profiledFunctions[1263]))(video_capture_slot,stream,pname,params);this->profiler.end(1263,profilingStart);}
+void m_glVertexStream4iATI_profiling(GLenum stream,GLint x,GLint y,GLint z,GLint w)const{auto const profilingStart=this->profiler.begin(1264);(this->*((FunctionTable::MEMBERPFNGLVERTEXSTREAM4IATIPROC)this->m_profiledFunctions[1264]))(stream,x,y,z,w);this->profiler.end(1264,profilingStart);}
+void m_glVDPAUFiniNV_profiling()const{auto const profilingStart=this->profiler.begin(1265);(this->*((FunctionTable::MEMBERPFNGLVDPAUFININVPROC)this->m_profiledFunctions[1265]))();this->profiler.end(1265,profilingStart);}
+void m_glMakeBufferNonResidentNV_profiling(GLenum target)const{auto const profilingStart=this->profiler.begin(1266);(this->*((FunctionTable::MEMBERPFNGLMAKEBUFFERNONRESIDENTNVPROC)this->m_profiledFunctions[1266]))(target);this->profiler.end(1266,profilingStart);}
+void m_glUniform1ui64ARB_profiling(GLint location,GLuint64 x)const{auto const profilingStart=this->profiler.begin(1267);(this->*((FunctionTable::MEMBERPFNGLUNIFORM1UI64ARBPROC)this->m_profiledFunctions[1267]))(location,x);this->profiler.end(1267,profilingStart);}
+void m_glStencilStrokePathNV_profiling(GLuint path,GLint reference,GLuint mask)const{auto const profilingStart=this->profiler.begin(1268);(this->*((FunctionTable::MEMBERPFNGLSTENCILSTROKEPATHNVPROC)this->m_profiledFunctions[1268]))(path,reference,mask);this->profiler.end(1268,profilingStart);}
+void m_glProgramUniform3uiv_profiling(GLuint program,GLint location,GLsizei count,const GLuint* value)const{auto const profilingStart=this->profiler.begin(1269);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UIVPROC)this->m_profiledFunctions[1269]))(program,location,count,value);this->profiler.end(1269,profilingStart);}
+void m_glVariantuivEXT_profiling(GLuint id,const GLuint* addr)const{auto const profilingStart=this->profiler.begin(1270);(this->*((FunctionTable::MEMBERPFNGLVARIANTUIVEXTPROC)this->m_profiledFunctions[1270]))(id,addr);this->profiler.end(1270,profilingStart);}
+void m_glCopyTexSubImage3DEXT_profiling(GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLint x,GLint y,GLsizei width,GLsizei height)const{auto const profilingStart=this->profiler.begin(1271);(this->*((FunctionTable::MEMBERPFNGLCOPYTEXSUBIMAGE3DEXTPROC)this->m_profiledFunctions[1271]))(target,level,xoffset,yoffset,zoffset,x,y,width,height);this->profiler.end(1271,profilingStart);}
+void m_glSpriteParameteriSGIX_profiling(GLenum pname,GLint param)const{auto const profilingStart=this->profiler.begin(1272);(this->*((FunctionTable::MEMBERPFNGLSPRITEPARAMETERISGIXPROC)this->m_profiledFunctions[1272]))(pname,param);this->profiler.end(1272,profilingStart);}
+void m_glMultiTexCoord1sARB_profiling(GLenum target,GLshort s)const{auto const profilingStart=this->profiler.begin(1273);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD1SARBPROC)this->m_profiledFunctions[1273]))(target,s);this->profiler.end(1273,profilingStart);}
+void m_glConvolutionParameterfv_profiling(GLenum target,GLenum pname,const GLfloat* params)const{auto const profilingStart=this->profiler.begin(1274);(this->*((FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERFVPROC)this->m_profiledFunctions[1274]))(target,pname,params);this->profiler.end(1274,profilingStart);}
+void m_glMakeTextureHandleResidentNV_profiling(GLuint64 handle)const{auto const profilingStart=this->profiler.begin(1275);(this->*((FunctionTable::MEMBERPFNGLMAKETEXTUREHANDLERESIDENTNVPROC)this->m_profiledFunctions[1275]))(handle);this->profiler.end(1275,profilingStart);}
+void m_glMultMatrixxOES_profiling(const GLfixed* m)const{auto const profilingStart=this->profiler.begin(1276);(this->*((FunctionTable::MEMBERPFNGLMULTMATRIXXOESPROC)this->m_profiledFunctions[1276]))(m);this->profiler.end(1276,profilingStart);}
+void m_glTextureNormalEXT_profiling(GLenum mode)const{auto const profilingStart=this->profiler.begin(1277);(this->*((FunctionTable::MEMBERPFNGLTEXTURENORMALEXTPROC)this->m_profiledFunctions[1277]))(mode);this->profiler.end(1277,profilingStart);}
+void m_glGetQueryivARB_profiling(GLenum target,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(1278);(this->*((FunctionTable::MEMBERPFNGLGETQUERYIVARBPROC)this->m_profiledFunctions[1278]))(target,pname,params);this->profiler.end(1278,profilingStart);}
+void m_glCompressedMultiTexImage3DEXT_profiling(GLenum texunit,GLenum target,GLint level,GLenum internalformat,GLsizei width,GLsizei height,GLsizei depth,GLint border,GLsizei imageSize,const void* bits)const{auto const profilingStart=this->profiler.begin(1279);(this->*((FunctionTable::MEMBERPFNGLCOMPRESSEDMULTITEXIMAGE3DEXTPROC)this->m_profiledFunctions[1279]))(texunit,target,level,internalformat,width,height,depth,border,imageSize,bits);this->profiler.end(1279,profilingStart);}
+GLint m_glGetInstrumentsSGIX_profiling()const{auto const profilingStart=this->profiler.begin(1280);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLGETINSTRUMENTSSGIXPROC)this->m_profiledFunctions[1280]))();this->profiler.end(1280,profilingStart);return profilingResult;}
+void m_glProgramUniformMatrix4x3fvEXT_profiling(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{auto const profilingStart=this->profiler.begin(1281);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X3FVEXTPROC)this->m_profiledFunctions[1281]))(program,location,count,transpose,value);this->profiler.end(1281,profilingStart);}
+void m_glPointParameterf_profiling(GLenum pname,GLfloat param)const{auto const profilingStart=this->profiler.begin(1282);(this->*((FunctionTable::MEMBERPFNGLPOINTPARAMETERFPROC)this->m_profiledFunctions[1282]))(pname,param);this->profiler.end(1282,profilingStart);}
+void m_glProgramUniform3dEXT_profiling(GLuint program,GLint location,GLdouble x,GLdouble y,GLdouble z)const{auto const profilingStart=this->profiler.begin(1283);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3DEXTPROC)this->m_profiledFunctions[1283]))(program,location,x,y,z);this->profiler.end(1283,profilingStart);}
+void m_glMultiTexCoord2hNV_profiling(GLenum target,GLhalfNV s,GLhalfNV t)const{auto const profilingStart=this->profiler.begin(1284);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD2HNVPROC)this->m_profiledFunctions[1284]))(target,s,t);this->profiler.end(1284,profilingStart);}
+void m_glGetConvolutionFilterEXT_profiling(GLenum target,GLenum format,GLenum type,void* image)const{auto const profilingStart=this->profiler.begin(1285);(this->*((FunctionTable::MEMBERPFNGLGETCONVOLUTIONFILTEREXTPROC)this->m_profiledFunctions[1285]))(target,format,type,image);this->profiler.end(1285,profilingStart);}
+void m_glVertexAttrib2hNV_profiling(GLuint index,GLhalfNV x,GLhalfNV y)const{auto const profilingStart=this->profiler.begin(1286);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB2HNVPROC)this->m_profiledFunctions[1286]))(index,x,y);this->profiler.end(1286,profilingStart);}
+void m_glCurrentPaletteMatrixARB_profiling(GLint index)const{auto const profilingStart=this->profiler.begin(1287);(this->*((FunctionTable::MEMBERPFNGLCURRENTPALETTEMATRIXARBPROC)this->m_profiledFunctions[1287]))(index);this->profiler.end(1287,profilingStart);}
+void m_glFogxvOES_profiling(GLenum pname,const GLfixed* param)const{auto const profilingStart=this->profiler.begin(1288);(this->*((FunctionTable::MEMBERPFNGLFOGXVOESPROC)this->m_profiledFunctions[1288]))(pname,param);this->profiler.end(1288,profilingStart);}
+void m_glCreateRenderbuffers_profiling(GLsizei n,GLuint* renderbuffers)const{auto const profilingStart=this->profiler.begin(1289);(this->*((FunctionTable::MEMBERPFNGLCREATERENDERBUFFERSPROC)this->m_profiledFunctions[1289]))(n,renderbuffers);this->profiler.end(1289,profilingStart);}
+void m_glVertexAttrib4Nusv_profiling(GLuint index,const GLushort* v)const{auto const profilingStart=this->profiler.begin(1290);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUSVPROC)this->m_profiledFunctions[1290]))(index,v);this->profiler.end(1290,profilingStart);}
+void m_glCombinerInputNV_profiling(GLenum stage,GLenum portion,GLenum variable,GLenum input,GLenum mapping,GLenum componentUsage)const{auto const profilingStart=this->profiler.begin(1291);(this->*((FunctionTable::MEMBERPFNGLCOMBINERINPUTNVPROC)this->m_profiledFunctions[1291]))(stage,portion,variable,input,mapping,componentUsage);this->profiler.end(1291,profilingStart);}
+void m_glDepthFunc_profiling(GLenum func)const{auto const profilingStart=this->profiler.begin(1292);(this->*((FunctionTable::MEMBERPFNGLDEPTHFUNCPROC)this->m_profiledFunctions[1292]))(func);this->profiler.end(1292,profilingStart);}
+void m_glWindowPos4fMESA_profiling(GLfloat x,GLfloat y,GLfloat z,GLfloat w)const{auto const profilingStart=this->profiler.begin(1293);(this->*((FunctionTable::MEMBERPFNGLWINDOWPOS4FMESAPROC)this->m_profiledFunctions[1293]))(x,y,z,w);this->profiler.end(1293,profilingStart);}
+void m_glEnableClientStateIndexedEXT_profiling(GLenum array,GLuint index)const{auto const profilingStart=this->profiler.begin(1294);(this->*((FunctionTable::MEMBERPFNGLENABLECLIENTSTATEINDEXEDEXTPROC)this->m_profiledFunctions[1294]))(array,index);this->profiler.end(1294,profilingStart);}
+void m_glTexCoord4iv_profiling(const GLint* v)const{auto const profilingStart=this->profiler.begin(1295);(this->*((FunctionTable::MEMBERPFNGLTEXCOORD4IVPROC)this->m_profiledFunctions[1295]))(v);this->profiler.end(1295,profilingStart);}
+void m_glProgramUniform4i64ARB_profiling(GLuint program,GLint location,GLint64 x,GLint64 y,GLint64 z,GLint64 w)const{auto const profilingStart=this->profiler.begin(1296);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4I64ARBPROC)this->m_profiledFunctions[1296]))(program,location,x,y,z,w);this->profiler.end(1296,profilingStart);}
+void m_glBlendFunci_profiling(GLuint buf,GLenum src,GLenum dst)const{auto const profilingStart=this->profiler.begin(1297);(this->*((FunctionTable::MEMBERPFNGLBLENDFUNCIPROC)this->m_profiledFunctions[1297]))(buf,src,dst);this->profiler.end(1297,profilingStart);}
+void m_glResolveDepthValuesNV_profiling()const{auto const profilingStart=this->profiler.begin(1298);(this->*((FunctionTable::MEMBERPFNGLRESOLVEDEPTHVALUESNVPROC)this->m_profiledFunctions[1298]))();this->profiler.end(1298,profilingStart);}
+void m_glTextureColorMaskSGIS_profiling(GLboolean red,GLboolean green,GLboolean blue,GLboolean alpha)const{auto const profilingStart=this->profiler.begin(1299);(this->*((FunctionTable::MEMBERPFNGLTEXTURECOLORMASKSGISPROC)this->m_profiledFunctions[1299]))(red,green,blue,alpha);this->profiler.end(1299,profilingStart);}
+GLuint m_glCreateShaderProgramEXT_profiling(GLenum type,const GLchar* string)const{auto const profilingStart=this->profiler.begin(1300);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLCREATESHADERPROGRAMEXTPROC)this->m_profiledFunctions[1300]))(type,string);this->profiler.end(1300,profilingStart);return profilingResult;}
+void m_glBufferStorage_profiling(GLenum target,GLsizeiptr size,const void* data,GLbitfield flags)const{auto const profilingStart=this->profiler.begin(1301);(this->*((FunctionTable::MEMBERPFNGLBUFFERSTORAGEPROC)this->m_profiledFunctions[1301]))(target,size,data,flags);this->profiler.end(1301,profilingStart);}
+void m_glMakeNamedBufferNonResidentNV_profiling(GLuint buffer)const{auto const profilingStart=this->profiler.begin(1302);(this->*((FunctionTable::MEMBERPFNGLMAKENAMEDBUFFERNONRESIDENTNVPROC)this->m_profiledFunctions[1302]))(buffer);this->profiler.end(1302,profilingStart);}
+void m_glRenderbufferStorageMultisampleEXT_profiling(GLenum target,GLsizei samples,GLenum internalformat,GLsizei width,GLsizei height)const{auto const profilingStart=this->profiler.begin(1303);(this->*((FunctionTable::MEMBERPFNGLRENDERBUFFERSTORAGEMULTISAMPLEEXTPROC)this->m_profiledFunctions[1303]))(target,samples,internalformat,width,height);this->profiler.end(1303,profilingStart);}
+void m_glGetFloati_v_profiling(GLenum target,GLuint index,GLfloat* data)const{auto const profilingStart=this->profiler.begin(1304);(this->*((FunctionTable::MEMBERPFNGLGETFLOATI_VPROC)this->m_profiledFunctions[1304]))(target,index,data);this->profiler.end(1304,profilingStart);}
+void m_glUniform2ui64ARB_profiling(GLint location,GLuint64 x,GLuint64 y)const{auto const profilingStart=this->profiler.begin(1305);(this->*((FunctionTable::MEMBERPFNGLUNIFORM2UI64ARBPROC)this->m_profiledFunctions[1305]))(location,x,y);this->profiler.end(1305,profilingStart);}
+void m_glVertex3fv_profiling(const GLfloat* v)const{auto const profilingStart=this->profiler.begin(1306);(this->*((FunctionTable::MEMBERPFNGLVERTEX3FVPROC)this->m_profiledFunctions[1306]))(v);this->profiler.end(1306,profilingStart);}
+GLint m_glGetUniformLocation_profiling(GLuint program,const GLchar* name)const{auto const profilingStart=this->profiler.begin(1307);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLGETUNIFORMLOCATIONPROC)this->m_profiledFunctions[1307]))(program,name);this->profiler.end(1307,profilingStart);return profilingResult;}
+void m_glVertexStream1svATI_profiling(GLenum stream,const GLshort* coords)const{auto const profilingStart=this->profiler.begin(1308);(this->*((FunctionTable::MEMBERPFNGLVERTEXSTREAM1SVATIPROC)this->m_profiledFunctions[1308]))(stream,coords);this->profiler.end(1308,profilingStart);}
+void m_glVertexStream3fATI_profiling(GLenum stream,GLfloat x,GLfloat y,GLfloat z)const{auto const profilingStart=this->profiler.begin(1309);(this->*((FunctionTable::MEMBERPFNGLVERTEXSTREAM3FATIPROC)this->m_profiledFunctions[1309]))(stream,x,y,z);this->profiler.end(1309,profilingStart);}
+void m_glNamedFramebufferDrawBuffers_profiling(GLuint framebuffer,GLsizei n,const GLenum* bufs)const{auto const profilingStart=this->profiler.begin(1310);(this->*((FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC)this->m_profiledFunctions[1310]))(framebuffer,n,bufs);this->profiler.end(1310,profilingStart);}
+void m_glUniform2ui64vNV_profiling(GLint location,GLsizei count,const GLuint64EXT* value)const{auto const profilingStart=this->profiler.begin(1311);(this->*((FunctionTable::MEMBERPFNGLUNIFORM2UI64VNVPROC)this->m_profiledFunctions[1311]))(location,count,value);this->profiler.end(1311,profilingStart);}
+void m_glTexCoordPointervINTEL_profiling(GLint size,GLenum type,const void** pointer)const{auto const profilingStart=this->profiler.begin(1312);(this->*((FunctionTable::MEMBERPFNGLTEXCOORDPOINTERVINTELPROC)this->m_profiledFunctions[1312]))(size,type,pointer);this->profiler.end(1312,profilingStart);}
+void m_glUniform4fv_profiling(GLint location,GLsizei count,const GLfloat* value)const{auto const profilingStart=this->profiler.begin(1313);(this->*((FunctionTable::MEMBERPFNGLUNIFORM4FVPROC)this->m_profiledFunctions[1313]))(location,count,value);this->profiler.end(1313,profilingStart);}
+void m_glNormalPointerEXT_profiling(GLenum type,GLsizei stride,GLsizei count,const void* pointer)const{auto const profilingStart=this->profiler.begin(1314);(this->*((FunctionTable::MEMBERPFNGLNORMALPOINTEREXTPROC)this->m_profiledFunctions[1314]))(type,stride,count,pointer);this->profiler.end(1314,profilingStart);}
+void m_glVertexAttrib4hNV_profiling(GLuint index,GLhalfNV x,GLhalfNV y,GLhalfNV z,GLhalfNV w)const{auto const profilingStart=this->profiler.begin(1315);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB4HNVPROC)this->m_profiledFunctions[1315]))(index,x,y,z,w);this->profiler.end(1315,profilingStart);}
+void m_glNormal3f_profiling(GLfloat nx,GLfloat ny,GLfloat nz)const{auto const profilingStart=this->profiler.begin(1316);(this->*((FunctionTable::MEMBERPFNGLNORMAL3FPROC)this->m_profiledFunctions[1316]))(nx,ny,nz);this->profiler.end(1316,profilingStart);}
+void m_glVertexStream2iATI_profiling(GLenum stream,GLint x,GLint y)const{auto const profilingStart=this->profiler.begin(1317);(this->*((FunctionTable::MEMBERPFNGLVERTEXSTREAM2IATIPROC)this->m_profiledFunctions[1317]))(stream,x,y);this->profiler.end(1317,profilingStart);}
+void m_glVertexAttribP4uiv_profiling(GLuint index,GLenum type,GLboolean normalized,const GLuint* value)const{auto const profilingStart=this->profiler.begin(1318);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBP4UIVPROC)this->m_profiledFunctions[1318]))(index,type,normalized,value);this->profiler.end(1318,profilingStart);}
+void m_glCompressedTextureSubImage3D_profiling(GLuint texture,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLenum format,GLsizei imageSize,const void* data)const{auto const profilingStart=this->profiler.begin(1319);(this->*((FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC)this->m_profiledFunctions[1319]))(texture,level,xoffset,yoffset,zoffset,width,height,depth,format,imageSize,data);this->profiler.end(1319,profilingStart);}
+void m_glAsyncMarkerSGIX_profiling(GLuint marker)const{auto const profilingStart=this->profiler.begin(1320);(this->*((FunctionTable::MEMBERPFNGLASYNCMARKERSGIXPROC)this->m_profiledFunctions[1320]))(marker);this->profiler.end(1320,profilingStart);}
+void m_glTextureStorageSparseAMD_profiling(GLuint texture,GLenum target,GLenum internalFormat,GLsizei width,GLsizei height,GLsizei depth,GLsizei layers,GLbitfield flags)const{auto const profilingStart=this->profiler.begin(1321);(this->*((FunctionTable::MEMBERPFNGLTEXTURESTORAGESPARSEAMDPROC)this->m_profiledFunctions[1321]))(texture,target,internalFormat,width,height,depth,layers,flags);this->profiler.end(1321,profilingStart);}
+void m_glGetConvolutionParameterivEXT_profiling(GLenum target,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(1322);(this->*((FunctionTable::MEMBERPFNGLGETCONVOLUTIONPARAMETERIVEXTPROC)this->m_profiledFunctions[1322]))(target,pname,params);this->profiler.end(1322,profilingStart);}
+void m_glEndPerfQueryINTEL_profiling(GLuint queryHandle)const{auto const profilingStart=this->profiler.begin(1323);(this->*((FunctionTable::MEMBERPFNGLENDPERFQUERYINTELPROC)this->m_profiledFunctions[1323]))(queryHandle);this->profiler.end(1323,profilingStart);}
+void m_glFragmentLightModeliSGIX_profiling(GLenum pname,GLint param)const{auto const profilingStart=this->profiler.begin(1324);(this->*((FunctionTable::MEMBERPFNGLFRAGMENTLIGHTMODELISGIXPROC)this->m_profiledFunctions[1324]))(pname,param);this->profiler.end(1324,profilingStart);}
+void m_glPrioritizeTexturesEXT_profiling(GLsizei n,const GLuint* textures,const GLclampf* priorities)const{auto const profilingStart=this->profiler.begin(1325);(this->*((FunctionTable::MEMBERPFNGLPRIORITIZETEXTURESEXTPROC)this->m_profiledFunctions[1325]))(n,textures,priorities);this->profiler.end(1325,profilingStart);}
+void m_glEndConditionalRender_profiling()const{auto const profilingStart=this->profiler.begin(1326);(this->*((FunctionTable::MEMBERPFNGLENDCONDITIONALRENDERPROC)this->m_profiledFunctions[1326]))();this->profiler.end(1326,profilingStart);}
+void m_glEnableClientState_profiling(GLenum cap)const{auto const profilingStart=this->profiler.begin(1327);(this->*((FunctionTable::MEMBERPFNGLENABLECLIENTSTATEPROC)this->m_profiledFunctions[1327]))(cap);this->profiler.end(1327,profilingStart);}
+void m_glResetHistogram_profiling(GLenum target)const{auto const profilingStart=this->profiler.begin(1328);(this->*((FunctionTable::MEMBERPFNGLRESETHISTOGRAMPROC)this->m_profiledFunctions[1328]))(target);this->profiler.end(1328,profilingStart);}
+void m_glGetOcclusionQueryivNV_profiling(GLuint id,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(1329);(this->*((FunctionTable::MEMBERPFNGLGETOCCLUSIONQUERYIVNVPROC)this->m_profiledFunctions[1329]))(id,pname,params);this->profiler.end(1329,profilingStart);}
+void m_glUniform1uiEXT_profiling(GLint location,GLuint v0)const{auto const profilingStart=this->profiler.begin(1330);(this->*((FunctionTable::MEMBERPFNGLUNIFORM1UIEXTPROC)this->m_profiledFunctions[1330]))(location,v0);this->profiler.end(1330,profilingStart);}
+void m_glMultiTexCoord2sv_profiling(GLenum target,const GLshort* v)const{auto const profilingStart=this->profiler.begin(1331);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD2SVPROC)this->m_profiledFunctions[1331]))(target,v);this->profiler.end(1331,profilingStart);}
+void m_glTexSubImage2DEXT_profiling(GLenum target,GLint level,GLint xoffset,GLint yoffset,GLsizei width,GLsizei height,GLenum format,GLenum type,const void* pixels)const{auto const profilingStart=this->profiler.begin(1332);(this->*((FunctionTable::MEMBERPFNGLTEXSUBIMAGE2DEXTPROC)this->m_profiledFunctions[1332]))(target,level,xoffset,yoffset,width,height,format,type,pixels);this->profiler.end(1332,profilingStart);}
+void m_glProgramUniform2uiv_profiling(GLuint program,GLint location,GLsizei count,const GLuint* value)const{auto const profilingStart=this->profiler.begin(1333);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UIVPROC)this->m_profiledFunctions[1333]))(program,location,count,value);this->profiler.end(1333,profilingStart);}
+void m_glMultiTexCoord2iARB_profiling(GLenum target,GLint s,GLint t)const{auto const profilingStart=this->profiler.begin(1334);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD2IARBPROC)this->m_profiledFunctions[1334]))(target,s,t);this->profiler.end(1334,profilingStart);}
+void m_glGetQueryObjectuiv_profiling(GLuint id,GLenum pname,GLuint* params)const{auto const profilingStart=this->profiler.begin(1335);(this->*((FunctionTable::MEMBERPFNGLGETQUERYOBJECTUIVPROC)this->m_profiledFunctions[1335]))(id,pname,params);this->profiler.end(1335,profilingStart);}
+void m_glGenerateMultiTexMipmapEXT_profiling(GLenum texunit,GLenum target)const{auto const profilingStart=this->profiler.begin(1336);(this->*((FunctionTable::MEMBERPFNGLGENERATEMULTITEXMIPMAPEXTPROC)this->m_profiledFunctions[1336]))(texunit,target);this->profiler.end(1336,profilingStart);}
+void m_glVertexAttrib4iv_profiling(GLuint index,const GLint* v)const{auto const profilingStart=this->profiler.begin(1337);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB4IVPROC)this->m_profiledFunctions[1337]))(index,v);this->profiler.end(1337,profilingStart);}
+void m_glWindowPos3dvMESA_profiling(const GLdouble* v)const{auto const profilingStart=this->profiler.begin(1338);(this->*((FunctionTable::MEMBERPFNGLWINDOWPOS3DVMESAPROC)this->m_profiledFunctions[1338]))(v);this->profiler.end(1338,profilingStart);}
+void m_glLabelObjectEXT_profiling(GLenum type,GLuint object,GLsizei length,const GLchar* label)const{auto const profilingStart=this->profiler.begin(1339);(this->*((FunctionTable::MEMBERPFNGLLABELOBJECTEXTPROC)this->m_profiledFunctions[1339]))(type,object,length,label);this->profiler.end(1339,profilingStart);}
+void m_glProgramUniform1uiv_profiling(GLuint program,GLint location,GLsizei count,const GLuint* value)const{auto const profilingStart=this->profiler.begin(1340);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UIVPROC)this->m_profiledFunctions[1340]))(program,location,count,value);this->profiler.end(1340,profilingStart);}
+void m_glFramebufferTexture_profiling(GLenum target,GLenum attachment,GLuint texture,GLint level)const{auto const profilingStart=this->profiler.begin(1341);(this->*((FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTUREPROC)this->m_profiledFunctions[1341]))(target,attachment,texture,level);this->profiler.end(1341,profilingStart);}
+void m_glMultiTexEnvfEXT_profiling(GLenum texunit,GLenum target,GLenum pname,GLfloat param)const{auto const profilingStart=this->profiler.begin(1342);(this->*((FunctionTable::MEMBERPFNGLMULTITEXENVFEXTPROC)this->m_profiledFunctions[1342]))(texunit,target,pname,param);this->profiler.end(1342,profilingStart);}
+void m_glGetTexGendv_profiling(GLenum coord,GLenum pname,GLdouble* params)const{auto const profilingStart=this->profiler.begin(1343);(this->*((FunctionTable::MEMBERPFNGLGETTEXGENDVPROC)this->m_profiledFunctions[1343]))(coord,pname,params);this->profiler.end(1343,profilingStart);}
+void m_glVertex4xOES_profiling(GLfixed x,GLfixed y,GLfixed z)const{auto const profilingStart=this->profiler.begin(1344);(this->*((FunctionTable::MEMBERPFNGLVERTEX4XOESPROC)this->m_profiledFunctions[1344]))(x,y,z);this->profiler.end(1344,profilingStart);}
+void m_glVertexAttribI2uivEXT_profiling(GLuint index,const GLuint* v)const{auto const profilingStart=this->profiler.begin(1345);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBI2UIVEXTPROC)this->m_profiledFunctions[1345]))(index,v);this->profiler.end(1345,profilingStart);}
+void m_glNamedProgramLocalParameter4fvEXT_profiling(GLuint program,GLenum target,GLuint index,const GLfloat* params)const{auto const profilingStart=this->profiler.begin(1346);(this->*((FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETER4FVEXTPROC)this->m_profiledFunctions[1346]))(program,target,index,params);this->profiler.end(1346,profilingStart);}
+void m_glPointParameterfvSGIS_profiling(GLenum pname,const GLfloat* params)const{auto const profilingStart=this->profiler.begin(1347);(this->*((FunctionTable::MEMBERPFNGLPOINTPARAMETERFVSGISPROC)this->m_profiledFunctions[1347]))(pname,params);this->profiler.end(1347,profilingStart);}
+void m_glGetPixelTransformParameterfvEXT_profiling(GLenum target,GLenum pname,GLfloat* params)const{auto const profilingStart=this->profiler.begin(1348);(this->*((FunctionTable::MEMBERPFNGLGETPIXELTRANSFORMPARAMETERFVEXTPROC)this->m_profiledFunctions[1348]))(target,pname,params);this->profiler.end(1348,profilingStart);}
+void m_glIndexxvOES_profiling(const GLfixed* component)const{auto const profilingStart=this->profiler.begin(1349);(this->*((FunctionTable::MEMBERPFNGLINDEXXVOESPROC)this->m_profiledFunctions[1349]))(component);this->profiler.end(1349,profilingStart);}
+void m_glDepthMask_profiling(GLboolean flag)const{auto const profilingStart=this->profiler.begin(1350);(this->*((FunctionTable::MEMBERPFNGLDEPTHMASKPROC)this->m_profiledFunctions[1350]))(flag);this->profiler.end(1350,profilingStart);}
+void m_glProgramUniformMatrix2x4fv_profiling(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{auto const profilingStart=this->profiler.begin(1351);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X4FVPROC)this->m_profiledFunctions[1351]))(program,location,count,transpose,value);this->profiler.end(1351,profilingStart);}
+GLboolean m_glAreProgramsResidentNV_profiling(GLsizei n,const GLuint* programs,GLboolean* residences)const{auto const profilingStart=this->profiler.begin(1352);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLAREPROGRAMSRESIDENTNVPROC)this->m_profiledFunctions[1352]))(n,programs,residences);this->profiler.end(1352,profilingStart);return profilingResult;}
+void m_glColorTable_profiling(GLenum target,GLenum internalformat,GLsizei width,GLenum format,GLenum type,const GLvoid* table)const{auto const profilingStart=this->profiler.begin(1353);(this->*((FunctionTable::MEMBERPFNGLCOLORTABLEPROC)this->m_profiledFunctions[1353]))(target,internalformat,width,format,type,table);this->profiler.end(1353,profilingStart);}
+void m_glBeginQueryIndexed_profiling(GLenum target,GLuint index,GLuint id)const{auto const profilingStart=this->profiler.begin(1354);(this->*((FunctionTable::MEMBERPFNGLBEGINQUERYINDEXEDPROC)this->m_profiledFunctions[1354]))(target,index,id);this->profiler.end(1354,profilingStart);}
+void m_glVertexStream1dvATI_profiling(GLenum stream,const GLdouble* coords)const{auto const profilingStart=this->profiler.begin(1355);(this->*((FunctionTable::MEMBERPFNGLVERTEXSTREAM1DVATIPROC)this->m_profiledFunctions[1355]))(stream,coords);this->profiler.end(1355,profilingStart);}
+void m_glGetMultiTexEnvfvEXT_profiling(GLenum texunit,GLenum target,GLenum pname,GLfloat* params)const{auto const profilingStart=this->profiler.begin(1356);(this->*((FunctionTable::MEMBERPFNGLGETMULTITEXENVFVEXTPROC)this->m_profiledFunctions[1356]))(texunit,target,pname,params);this->profiler.end(1356,profilingStart);}
+void m_glDeleteFencesNV_profiling(GLsizei n,const GLuint* fences)const{auto const profilingStart=this->profiler.begin(1357);(this->*((FunctionTable::MEMBERPFNGLDELETEFENCESNVPROC)this->m_profiledFunctions[1357]))(n,fences);this->profiler.end(1357,profilingStart);}
+void m_glVertexAttribs1dvNV_profiling(GLuint index,GLsizei count,const GLdouble* v)const{auto const profilingStart=this->profiler.begin(1358);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBS1DVNVPROC)this->m_profiledFunctions[1358]))(index,count,v);this->profiler.end(1358,profilingStart);}
+void m_glVertexStream2sATI_profiling(GLenum stream,GLshort x,GLshort y)const{auto const profilingStart=this->profiler.begin(1359);(this->*((FunctionTable::MEMBERPFNGLVERTEXSTREAM2SATIPROC)this->m_profiledFunctions[1359]))(stream,x,y);this->profiler.end(1359,profilingStart);}
+void m_glGetnSeparableFilterARB_profiling(GLenum target,GLenum format,GLenum type,GLsizei rowBufSize,void* row,GLsizei columnBufSize,void* column,void* span)const{auto const profilingStart=this->profiler.begin(1360);(this->*((FunctionTable::MEMBERPFNGLGETNSEPARABLEFILTERARBPROC)this->m_profiledFunctions[1360]))(target,format,type,rowBufSize,row,columnBufSize,column,span);this->profiler.end(1360,profilingStart);}
+void m_glProgramUniform2dv_profiling(GLuint program,GLint location,GLsizei count,const GLdouble* value)const{auto const profilingStart=this->profiler.begin(1361);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2DVPROC)this->m_profiledFunctions[1361]))(program,location,count,value);this->profiler.end(1361,profilingStart);}
+void m_glActiveStencilFaceEXT_profiling(GLenum face)const{auto const profilingStart=this->profiler.begin(1362);(this->*((FunctionTable::MEMBERPFNGLACTIVESTENCILFACEEXTPROC)this->m_profiledFunctions[1362]))(face);this->profiler.end(1362,profilingStart);}
+void m_glProgramUniform4dEXT_profiling(GLuint program,GLint location,GLdouble x,GLdouble y,GLdouble z,GLdouble w)const{auto const profilingStart=this->profiler.begin(1363);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4DEXTPROC)this->m_profiledFunctions[1363]))(program,location,x,y,z,w);this->profiler.end(1363,profilingStart);}
+void m_glPointSizexOES_profiling(GLfixed size)const{auto const profilingStart=this->profiler.begin(1364);(this->*((FunctionTable::MEMBERPFNGLPOINTSIZEXOESPROC)this->m_profiledFunctions[1364]))(size);this->profiler.end(1364,profilingStart);}
+void m_glRasterPos2sv_profiling(const GLshort* v)const{auto const profilingStart=this->profiler.begin(1365);(this->*((FunctionTable::MEMBERPFNGLRASTERPOS2SVPROC)this->m_profiledFunctions[1365]))(v);this->profiler.end(1365,profilingStart);}
+GLuint m_glBindParameterEXT_profiling(GLenum value)const{auto const profilingStart=this->profiler.begin(1366);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLBINDPARAMETEREXTPROC)this->m_profiledFunctions[1366]))(value);this->profiler.end(1366,profilingStart);return profilingResult;}
+void m_glTexCoord1sv_profiling(const GLshort* v)const{auto const profilingStart=this->profiler.begin(1367);(this->*((FunctionTable::MEMBERPFNGLTEXCOORD1SVPROC)this->m_profiledFunctions[1367]))(v);this->profiler.end(1367,profilingStart);}
+void m_glBlendParameteriNV_profiling(GLenum pname,GLint value)const{auto const profilingStart=this->profiler.begin(1368);(this->*((FunctionTable::MEMBERPFNGLBLENDPARAMETERINVPROC)this->m_profiledFunctions[1368]))(pname,value);this->profiler.end(1368,profilingStart);}
+void m_glNamedProgramLocalParameter4dvEXT_profiling(GLuint program,GLenum target,GLuint index,const GLdouble* params)const{auto const profilingStart=this->profiler.begin(1369);(this->*((FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETER4DVEXTPROC)this->m_profiledFunctions[1369]))(program,target,index,params);this->profiler.end(1369,profilingStart);}
+void m_glProgramUniformHandleui64NV_profiling(GLuint program,GLint location,GLuint64 value)const{auto const profilingStart=this->profiler.begin(1370);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORMHANDLEUI64NVPROC)this->m_profiledFunctions[1370]))(program,location,value);this->profiler.end(1370,profilingStart);}
+void m_glGetTextureParameterfvEXT_profiling(GLuint texture,GLenum target,GLenum pname,GLfloat* params)const{auto const profilingStart=this->profiler.begin(1371);(this->*((FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERFVEXTPROC)this->m_profiledFunctions[1371]))(texture,target,pname,params);this->profiler.end(1371,profilingStart);}
+void m_glGetPathMetricsNV_profiling(GLbitfield metricQueryMask,GLsizei numPaths,GLenum pathNameType,const void* paths,GLuint pathBase,GLsizei stride,GLfloat* metrics)const{auto const profilingStart=this->profiler.begin(1372);(this->*((FunctionTable::MEMBERPFNGLGETPATHMETRICSNVPROC)this->m_profiledFunctions[1372]))(metricQueryMask,numPaths,pathNameType,paths,pathBase,stride,metrics);this->profiler.end(1372,profilingStart);}
+void m_glVertex2i_profiling(GLint x,GLint y)const{auto const profilingStart=this->profiler.begin(1373);(this->*((FunctionTable::MEMBERPFNGLVERTEX2IPROC)this->m_profiledFunctions[1373]))(x,y);this->profiler.end(1373,profilingStart);}
+void m_glNewList_profiling(GLuint list,GLenum mode)const{auto const profilingStart=this->profiler.begin(1374);(this->*((FunctionTable::MEMBERPFNGLNEWLISTPROC)this->m_profiledFunctions[1374]))(list,mode);this->profiler.end(1374,profilingStart);}
+void m_glMatrixLoad3x3fNV_profiling(GLenum matrixMode,const GLfloat* m)const{auto const profilingStart=this->profiler.begin(1375);(this->*((FunctionTable::MEMBERPFNGLMATRIXLOAD3X3FNVPROC)this->m_profiledFunctions[1375]))(matrixMode,m);this->profiler.end(1375,profilingStart);}
+void m_glMultiTexCoord2fARB_profiling(GLenum target,GLfloat s,GLfloat t)const{auto const profilingStart=this->profiler.begin(1376);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD2FARBPROC)this->m_profiledFunctions[1376]))(target,s,t);this->profiler.end(1376,profilingStart);}
+void m_glWeightdvARB_profiling(GLint size,const GLdouble* weights)const{auto const profilingStart=this->profiler.begin(1377);(this->*((FunctionTable::MEMBERPFNGLWEIGHTDVARBPROC)this->m_profiledFunctions[1377]))(size,weights);this->profiler.end(1377,profilingStart);}
+GLboolean m_glIsTransformFeedbackNV_profiling(GLuint id)const{auto const profilingStart=this->profiler.begin(1378);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLISTRANSFORMFEEDBACKNVPROC)this->m_profiledFunctions[1378]))(id);this->profiler.end(1378,profilingStart);return profilingResult;}
+void m_glVertexAttribDivisorARB_profiling(GLuint index,GLuint divisor)const{auto const profilingStart=this->profiler.begin(1379);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBDIVISORARBPROC)this->m_profiledFunctions[1379]))(index,divisor);this->profiler.end(1379,profilingStart);}
+void m_glSecondaryColorP3uiv_profiling(GLenum type,const GLuint* color)const{auto const profilingStart=this->profiler.begin(1380);(this->*((FunctionTable::MEMBERPFNGLSECONDARYCOLORP3UIVPROC)this->m_profiledFunctions[1380]))(type,color);this->profiler.end(1380,profilingStart);}
+void m_glGetnCompressedTexImageARB_profiling(GLenum target,GLint lod,GLsizei bufSize,void* img)const{auto const profilingStart=this->profiler.begin(1381);(this->*((FunctionTable::MEMBERPFNGLGETNCOMPRESSEDTEXIMAGEARBPROC)this->m_profiledFunctions[1381]))(target,lod,bufSize,img);this->profiler.end(1381,profilingStart);}
+void m_glGetIntegerv_profiling(GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(1382);(this->*((FunctionTable::MEMBERPFNGLGETINTEGERVPROC)this->m_profiledFunctions[1382]))(pname,params);this->profiler.end(1382,profilingStart);}
+void m_glMatrixLoaddEXT_profiling(GLenum mode,const GLdouble* m)const{auto const profilingStart=this->profiler.begin(1383);(this->*((FunctionTable::MEMBERPFNGLMATRIXLOADDEXTPROC)this->m_profiledFunctions[1383]))(mode,m);this->profiler.end(1383,profilingStart);}
+GLfloat m_glGetPathLengthNV_profiling(GLuint path,GLsizei startSegment,GLsizei numSegments)const{auto const profilingStart=this->profiler.begin(1384);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLGETPATHLENGTHNVPROC)this->m_profiledFunctions[1384]))(path,startSegment,numSegments);this->profiler.end(1384,profilingStart);return profilingResult;}
+void m_glProgramUniformMatrix3dv_profiling(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{auto const profilingStart=this->profiler.begin(1385);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3DVPROC)this->m_profiledFunctions[1385]))(program,location,count,transpose,value);this->profiler.end(1385,profilingStart);}
+void m_glUniform4i64NV_profiling(GLint location,GLint64EXT x,GLint64EXT y,GLint64EXT z,GLint64EXT w)const{auto const profilingStart=this->profiler.begin(1386);(this->*((FunctionTable::MEMBERPFNGLUNIFORM4I64NVPROC)this->m_profiledFunctions[1386]))(location,x,y,z,w);this->profiler.end(1386,profilingStart);}
+void m_glGetHistogramEXT_profiling(GLenum target,GLboolean reset,GLenum format,GLenum type,void* values)const{auto const profilingStart=this->profiler.begin(1387);(this->*((FunctionTable::MEMBERPFNGLGETHISTOGRAMEXTPROC)this->m_profiledFunctions[1387]))(target,reset,format,type,values);this->profiler.end(1387,profilingStart);}
+void m_glVertexAttrib4NuivARB_profiling(GLuint index,const GLuint* v)const{auto const profilingStart=this->profiler.begin(1388);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUIVARBPROC)this->m_profiledFunctions[1388]))(index,v);this->profiler.end(1388,profilingStart);}
+void m_glMapGrid2xOES_profiling(GLint n,GLfixed u1,GLfixed u2,GLfixed v1,GLfixed v2)const{auto const profilingStart=this->profiler.begin(1389);(this->*((FunctionTable::MEMBERPFNGLMAPGRID2XOESPROC)this->m_profiledFunctions[1389]))(n,u1,u2,v1,v2);this->profiler.end(1389,profilingStart);}
+void m_glTexImage2D_profiling(GLenum target,GLint level,GLint internalFormat,GLsizei width,GLsizei height,GLint border,GLenum format,GLenum type,const GLvoid* pixels)const{auto const profilingStart=this->profiler.begin(1390);(this->*((FunctionTable::MEMBERPFNGLTEXIMAGE2DPROC)this->m_profiledFunctions[1390]))(target,level,internalFormat,width,height,border,format,type,pixels);this->profiler.end(1390,profilingStart);}
+void m_glWindowPos2fvARB_profiling(const GLfloat* v)const{auto const profilingStart=this->profiler.begin(1391);(this->*((FunctionTable::MEMBERPFNGLWINDOWPOS2FVARBPROC)this->m_profiledFunctions[1391]))(v);this->profiler.end(1391,profilingStart);}
+void m_glEnableIndexedEXT_profiling(GLenum target,GLuint index)const{auto const profilingStart=this->profiler.begin(1392);(this->*((FunctionTable::MEMBERPFNGLENABLEINDEXEDEXTPROC)this->m_profiledFunctions[1392]))(target,index);this->profiler.end(1392,profilingStart);}
+void m_glTexCoord1bvOES_profiling(const GLbyte* coords)const{auto const profilingStart=this->profiler.begin(1393);(this->*((FunctionTable::MEMBERPFNGLTEXCOORD1BVOESPROC)this->m_profiledFunctions[1393]))(coords);this->profiler.end(1393,profilingStart);}
+void m_glDrawPixels_profiling(GLsizei width,GLsizei height,GLenum format,GLenum type,const GLvoid* pixels)const{auto const profilingStart=this->profiler.begin(1394);(this->*((FunctionTable::MEMBERPFNGLDRAWPIXELSPROC)this->m_profiledFunctions[1394]))(width,height,format,type,pixels);this->profiler.end(1394,profilingStart);}
+void m_glMultMatrixd_profiling(const GLdouble* m)const{auto const profilingStart=this->profiler.begin(1395);(this->*((FunctionTable::MEMBERPFNGLMULTMATRIXDPROC)this->m_profiledFunctions[1395]))(m);this->profiler.end(1395,profilingStart);}
+void m_glMultMatrixf_profiling(const GLfloat* m)const{auto const profilingStart=this->profiler.begin(1396);(this->*((FunctionTable::MEMBERPFNGLMULTMATRIXFPROC)this->m_profiledFunctions[1396]))(m);this->profiler.end(1396,profilingStart);}
+void m_glReplacementCodePointerSUN_profiling(GLenum type,GLsizei stride,const void** pointer)const{auto const profilingStart=this->profiler.begin(1397);(this->*((FunctionTable::MEMBERPFNGLREPLACEMENTCODEPOINTERSUNPROC)this->m_profiledFunctions[1397]))(type,stride,pointer);this->profiler.end(1397,profilingStart);}
+void m_glLoadTransposeMatrixdARB_profiling(const GLdouble* m)const{auto const profilingStart=this->profiler.begin(1398);(this->*((FunctionTable::MEMBERPFNGLLOADTRANSPOSEMATRIXDARBPROC)this->m_profiledFunctions[1398]))(m);this->profiler.end(1398,profilingStart);}
+void m_glVertexAttrib4Nubv_profiling(GLuint index,const GLubyte* v)const{auto const profilingStart=this->profiler.begin(1399);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUBVPROC)this->m_profiledFunctions[1399]))(index,v);this->profiler.end(1399,profilingStart);}
+void m_glVertexArrayVertexAttribIOffsetEXT_profiling(GLuint vaobj,GLuint buffer,GLuint index,GLint size,GLenum type,GLsizei stride,GLintptr offset)const{auto const profilingStart=this->profiler.begin(1400);(this->*((FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBIOFFSETEXTPROC)this->m_profiledFunctions[1400]))(vaobj,buffer,index,size,type,stride,offset);this->profiler.end(1400,profilingStart);}
+void m_glCompileShaderARB_profiling(GLhandleARB shaderObj)const{auto const profilingStart=this->profiler.begin(1401);(this->*((FunctionTable::MEMBERPFNGLCOMPILESHADERARBPROC)this->m_profiledFunctions[1401]))(shaderObj);this->profiler.end(1401,profilingStart);}
+void m_glWindowPos3dMESA_profiling(GLdouble x,GLdouble y,GLdouble z)const{auto const profilingStart=this->profiler.begin(1402);(this->*((FunctionTable::MEMBERPFNGLWINDOWPOS3DMESAPROC)this->m_profiledFunctions[1402]))(x,y,z);this->profiler.end(1402,profilingStart);}
+void m_glNormalStream3fvATI_profiling(GLenum stream,const GLfloat* coords)const{auto const profilingStart=this->profiler.begin(1403);(this->*((FunctionTable::MEMBERPFNGLNORMALSTREAM3FVATIPROC)this->m_profiledFunctions[1403]))(stream,coords);this->profiler.end(1403,profilingStart);}
+void m_glColor4usv_profiling(const GLushort* v)const{auto const profilingStart=this->profiler.begin(1404);(this->*((FunctionTable::MEMBERPFNGLCOLOR4USVPROC)this->m_profiledFunctions[1404]))(v);this->profiler.end(1404,profilingStart);}
+void m_glMapGrid1f_profiling(GLint un,GLfloat u1,GLfloat u2)const{auto const profilingStart=this->profiler.begin(1405);(this->*((FunctionTable::MEMBERPFNGLMAPGRID1FPROC)this->m_profiledFunctions[1405]))(un,u1,u2);this->profiler.end(1405,profilingStart);}
+void m_glPolygonStipple_profiling(const GLubyte* mask)const{auto const profilingStart=this->profiler.begin(1406);(this->*((FunctionTable::MEMBERPFNGLPOLYGONSTIPPLEPROC)this->m_profiledFunctions[1406]))(mask);this->profiler.end(1406,profilingStart);}
+void m_glUniform4ui64ARB_profiling(GLint location,GLuint64 x,GLuint64 y,GLuint64 z,GLuint64 w)const{auto const profilingStart=this->profiler.begin(1407);(this->*((FunctionTable::MEMBERPFNGLUNIFORM4UI64ARBPROC)this->m_profiledFunctions[1407]))(location,x,y,z,w);this->profiler.end(1407,profilingStart);}
+void m_glTextureRenderbufferEXT_profiling(GLuint texture,GLenum target,GLuint renderbuffer)const{auto const profilingStart=this->profiler.begin(1408);(this->*((FunctionTable::MEMBERPFNGLTEXTURERENDERBUFFEREXTPROC)this->m_profiledFunctions[1408]))(texture,target,renderbuffer);this->profiler.end(1408,profilingStart);}
+GLint m_glGetSubroutineUniformLocation_profiling(GLuint program,GLenum shadertype,const GLchar* name)const{auto const profilingStart=this->profiler.begin(1409);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLGETSUBROUTINEUNIFORMLOCATIONPROC)this->m_profiledFunctions[1409]))(program,shadertype,name);this->profiler.end(1409,profilingStart);return profilingResult;}
+void m_glGetFramebufferParameteriv_profiling(GLenum target,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(1410);(this->*((FunctionTable::MEMBERPFNGLGETFRAMEBUFFERPARAMETERIVPROC)this->m_profiledFunctions[1410]))(target,pname,params);this->profiler.end(1410,profilingStart);}
+void m_glPixelMapusv_profiling(GLenum map,GLsizei mapsize,const GLushort* values)const{auto const profilingStart=this->profiler.begin(1411);(this->*((FunctionTable::MEMBERPFNGLPIXELMAPUSVPROC)this->m_profiledFunctions[1411]))(map,mapsize,values);this->profiler.end(1411,profilingStart);}
+void m_glGetSamplerParameteriv_profiling(GLuint sampler,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(1412);(this->*((FunctionTable::MEMBERPFNGLGETSAMPLERPARAMETERIVPROC)this->m_profiledFunctions[1412]))(sampler,pname,params);this->profiler.end(1412,profilingStart);}
+void m_glVertexStream2fvATI_profiling(GLenum stream,const GLfloat* coords)const{auto const profilingStart=this->profiler.begin(1413);(this->*((FunctionTable::MEMBERPFNGLVERTEXSTREAM2FVATIPROC)this->m_profiledFunctions[1413]))(stream,coords);this->profiler.end(1413,profilingStart);}
+void m_glProgramStringARB_profiling(GLenum target,GLenum format,GLsizei len,const void* string)const{auto const profilingStart=this->profiler.begin(1414);(this->*((FunctionTable::MEMBERPFNGLPROGRAMSTRINGARBPROC)this->m_profiledFunctions[1414]))(target,format,len,string);this->profiler.end(1414,profilingStart);}
+void m_glProgramUniformMatrix3dvEXT_profiling(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{auto const profilingStart=this->profiler.begin(1415);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3DVEXTPROC)this->m_profiledFunctions[1415]))(program,location,count,transpose,value);this->profiler.end(1415,profilingStart);}
+void m_glSeparableFilter2D_profiling(GLenum target,GLenum internalformat,GLsizei width,GLsizei height,GLenum format,GLenum type,const GLvoid* row,const GLvoid* column)const{auto const profilingStart=this->profiler.begin(1416);(this->*((FunctionTable::MEMBERPFNGLSEPARABLEFILTER2DPROC)this->m_profiledFunctions[1416]))(target,internalformat,width,height,format,type,row,column);this->profiler.end(1416,profilingStart);}
+void m_glVertexAttribI1uiv_profiling(GLuint index,const GLuint* v)const{auto const profilingStart=this->profiler.begin(1417);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBI1UIVPROC)this->m_profiledFunctions[1417]))(index,v);this->profiler.end(1417,profilingStart);}
+void m_glTexStorage2D_profiling(GLenum target,GLsizei levels,GLenum internalformat,GLsizei width,GLsizei height)const{auto const profilingStart=this->profiler.begin(1418);(this->*((FunctionTable::MEMBERPFNGLTEXSTORAGE2DPROC)this->m_profiledFunctions[1418]))(target,levels,internalformat,width,height);this->profiler.end(1418,profilingStart);}
+void m_glColor3fv_profiling(const GLfloat* v)const{auto const profilingStart=this->profiler.begin(1419);(this->*((FunctionTable::MEMBERPFNGLCOLOR3FVPROC)this->m_profiledFunctions[1419]))(v);this->profiler.end(1419,profilingStart);}
+void m_glVertexAttribL4dvEXT_profiling(GLuint index,const GLdouble* v)const{auto const profilingStart=this->profiler.begin(1420);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBL4DVEXTPROC)this->m_profiledFunctions[1420]))(index,v);this->profiler.end(1420,profilingStart);}
+void m_glGetActiveUniform_profiling(GLuint program,GLuint index,GLsizei bufSize,GLsizei* length,GLint* size,GLenum* type,GLchar* name)const{auto const profilingStart=this->profiler.begin(1421);(this->*((FunctionTable::MEMBERPFNGLGETACTIVEUNIFORMPROC)this->m_profiledFunctions[1421]))(program,index,bufSize,length,size,type,name);this->profiler.end(1421,profilingStart);}
+void m_glUniform2ui64vARB_profiling(GLint location,GLsizei count,const GLuint64* value)const{auto const profilingStart=this->profiler.begin(1422);(this->*((FunctionTable::MEMBERPFNGLUNIFORM2UI64VARBPROC)this->m_profiledFunctions[1422]))(location,count,value);this->profiler.end(1422,profilingStart);}
+void m_glMakeNamedBufferResidentNV_profiling(GLuint buffer,GLenum access)const{auto const profilingStart=this->profiler.begin(1423);(this->*((FunctionTable::MEMBERPFNGLMAKENAMEDBUFFERRESIDENTNVPROC)this->m_profiledFunctions[1423]))(buffer,access);this->profiler.end(1423,profilingStart);}
+GLenum m_glPathGlyphIndexRangeNV_profiling(GLenum fontTarget,const void* fontName,GLbitfield fontStyle,GLuint pathParameterTemplate,GLfloat emScale,GLuint baseAndCount[2])const{auto const profilingStart=this->profiler.begin(1424);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLPATHGLYPHINDEXRANGENVPROC)this->m_profiledFunctions[1424]))(fontTarget,fontName,fontStyle,pathParameterTemplate,emScale,baseAndCount);this->profiler.end(1424,profilingStart);return profilingResult;}
+void m_glColorPointer_profiling(GLint size,GLenum type,GLsizei stride,const GLvoid* ptr)const{auto const profilingStart=this->profiler.begin(1425);(this->*((FunctionTable::MEMBERPFNGLCOLORPOINTERPROC)this->m_profiledFunctions[1425]))(size,type,stride,ptr);this->profiler.end(1425,profilingStart);}
+void m_glProgramEnvParameterI4ivNV_profiling(GLenum target,GLuint index,const GLint* params)const{auto const profilingStart=this->profiler.begin(1426);(this->*((FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERI4IVNVPROC)this->m_profiledFunctions[1426]))(target,index,params);this->profiler.end(1426,profilingStart);}
+void m_glMultiTexParameterfEXT_profiling(GLenum texunit,GLenum target,GLenum pname,GLfloat param)const{auto const profilingStart=this->profiler.begin(1427);(this->*((FunctionTable::MEMBERPFNGLMULTITEXPARAMETERFEXTPROC)this->m_profiledFunctions[1427]))(texunit,target,pname,param);this->profiler.end(1427,profilingStart);}
+void m_glNamedFramebufferTextureLayer_profiling(GLuint framebuffer,GLenum attachment,GLuint texture,GLint level,GLint layer)const{auto const profilingStart=this->profiler.begin(1428);(this->*((FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC)this->m_profiledFunctions[1428]))(framebuffer,attachment,texture,level,layer);this->profiler.end(1428,profilingStart);}
+void m_glGetVertexArrayIntegervEXT_profiling(GLuint vaobj,GLenum pname,GLint* param)const{auto const profilingStart=this->profiler.begin(1429);(this->*((FunctionTable::MEMBERPFNGLGETVERTEXARRAYINTEGERVEXTPROC)this->m_profiledFunctions[1429]))(vaobj,pname,param);this->profiler.end(1429,profilingStart);}
+void m_glVertexAttrib3dARB_profiling(GLuint index,GLdouble x,GLdouble y,GLdouble z)const{auto const profilingStart=this->profiler.begin(1430);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB3DARBPROC)this->m_profiledFunctions[1430]))(index,x,y,z);this->profiler.end(1430,profilingStart);}
+GLboolean m_glVDPAUIsSurfaceNV_profiling(GLvdpauSurfaceNV surface)const{auto const profilingStart=this->profiler.begin(1431);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLVDPAUISSURFACENVPROC)this->m_profiledFunctions[1431]))(surface);this->profiler.end(1431,profilingStart);return profilingResult;}
+void m_glMultiTexImage1DEXT_profiling(GLenum texunit,GLenum target,GLint level,GLint internalformat,GLsizei width,GLint border,GLenum format,GLenum type,const void* pixels)const{auto const profilingStart=this->profiler.begin(1432);(this->*((FunctionTable::MEMBERPFNGLMULTITEXIMAGE1DEXTPROC)this->m_profiledFunctions[1432]))(texunit,target,level,internalformat,width,border,format,type,pixels);this->profiler.end(1432,profilingStart);}
+GLboolean m_glIsAsyncMarkerSGIX_profiling(GLuint marker)const{auto const profilingStart=this->profiler.begin(1433);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLISASYNCMARKERSGIXPROC)this->m_profiledFunctions[1433]))(marker);this->profiler.end(1433,profilingStart);return profilingResult;}
+void m_glGetDoublei_vEXT_profiling(GLenum pname,GLuint index,GLdouble* params)const{auto const profilingStart=this->profiler.begin(1434);(this->*((FunctionTable::MEMBERPFNGLGETDOUBLEI_VEXTPROC)this->m_profiledFunctions[1434]))(pname,index,params);this->profiler.end(1434,profilingStart);}
+void m_glUniform2i64NV_profiling(GLint location,GLint64EXT x,GLint64EXT y)const{auto const profilingStart=this->profiler.begin(1435);(this->*((FunctionTable::MEMBERPFNGLUNIFORM2I64NVPROC)this->m_profiledFunctions[1435]))(location,x,y);this->profiler.end(1435,profilingStart);}
+GLboolean m_glIsCommandListNV_profiling(GLuint list)const{auto const profilingStart=this->profiler.begin(1436);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLISCOMMANDLISTNVPROC)this->m_profiledFunctions[1436]))(list);this->profiler.end(1436,profilingStart);return profilingResult;}
+void m_glUniform3uiEXT_profiling(GLint location,GLuint v0,GLuint v1,GLuint v2)const{auto const profilingStart=this->profiler.begin(1437);(this->*((FunctionTable::MEMBERPFNGLUNIFORM3UIEXTPROC)this->m_profiledFunctions[1437]))(location,v0,v1,v2);this->profiler.end(1437,profilingStart);}
+void m_glTexParameterIuivEXT_profiling(GLenum target,GLenum pname,const GLuint* params)const{auto const profilingStart=this->profiler.begin(1438);(this->*((FunctionTable::MEMBERPFNGLTEXPARAMETERIUIVEXTPROC)this->m_profiledFunctions[1438]))(target,pname,params);this->profiler.end(1438,profilingStart);}
+void m_glProgramUniformMatrix4fv_profiling(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{auto const profilingStart=this->profiler.begin(1439);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4FVPROC)this->m_profiledFunctions[1439]))(program,location,count,transpose,value);this->profiler.end(1439,profilingStart);}
+void m_glVertex2fv_profiling(const GLfloat* v)const{auto const profilingStart=this->profiler.begin(1440);(this->*((FunctionTable::MEMBERPFNGLVERTEX2FVPROC)this->m_profiledFunctions[1440]))(v);this->profiler.end(1440,profilingStart);}
+void m_glVertexAttribL3dEXT_profiling(GLuint index,GLdouble x,GLdouble y,GLdouble z)const{auto const profilingStart=this->profiler.begin(1441);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBL3DEXTPROC)this->m_profiledFunctions[1441]))(index,x,y,z);this->profiler.end(1441,profilingStart);}
+void m_glFramebufferRenderbuffer_profiling(GLenum target,GLenum attachment,GLenum renderbuffertarget,GLuint renderbuffer)const{auto const profilingStart=this->profiler.begin(1442);(this->*((FunctionTable::MEMBERPFNGLFRAMEBUFFERRENDERBUFFERPROC)this->m_profiledFunctions[1442]))(target,attachment,renderbuffertarget,renderbuffer);this->profiler.end(1442,profilingStart);}
+GLint m_glGetUniformLocationARB_profiling(GLhandleARB programObj,const GLcharARB* name)const{auto const profilingStart=this->profiler.begin(1443);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLGETUNIFORMLOCATIONARBPROC)this->m_profiledFunctions[1443]))(programObj,name);this->profiler.end(1443,profilingStart);return profilingResult;}
+void m_glPathParameterfvNV_profiling(GLuint path,GLenum pname,const GLfloat* value)const{auto const profilingStart=this->profiler.begin(1444);(this->*((FunctionTable::MEMBERPFNGLPATHPARAMETERFVNVPROC)this->m_profiledFunctions[1444]))(path,pname,value);this->profiler.end(1444,profilingStart);}
+void m_glVertexAttrib3sNV_profiling(GLuint index,GLshort x,GLshort y,GLshort z)const{auto const profilingStart=this->profiler.begin(1445);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB3SNVPROC)this->m_profiledFunctions[1445]))(index,x,y,z);this->profiler.end(1445,profilingStart);}
+void m_glGetDoublei_v_profiling(GLenum target,GLuint index,GLdouble* data)const{auto const profilingStart=this->profiler.begin(1446);(this->*((FunctionTable::MEMBERPFNGLGETDOUBLEI_VPROC)this->m_profiledFunctions[1446]))(target,index,data);this->profiler.end(1446,profilingStart);}
+void m_glVertexAttrib1sv_profiling(GLuint index,const GLshort* v)const{auto const profilingStart=this->profiler.begin(1447);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB1SVPROC)this->m_profiledFunctions[1447]))(index,v);this->profiler.end(1447,profilingStart);}
+void m_glBindSampler_profiling(GLuint unit,GLuint sampler)const{auto const profilingStart=this->profiler.begin(1448);(this->*((FunctionTable::MEMBERPFNGLBINDSAMPLERPROC)this->m_profiledFunctions[1448]))(unit,sampler);this->profiler.end(1448,profilingStart);}
+void m_glLineWidth_profiling(GLfloat width)const{auto const profilingStart=this->profiler.begin(1449);(this->*((FunctionTable::MEMBERPFNGLLINEWIDTHPROC)this->m_profiledFunctions[1449]))(width);this->profiler.end(1449,profilingStart);}
+void m_glVertexArrayRangeAPPLE_profiling(GLsizei length,void* pointer)const{auto const profilingStart=this->profiler.begin(1450);(this->*((FunctionTable::MEMBERPFNGLVERTEXARRAYRANGEAPPLEPROC)this->m_profiledFunctions[1450]))(length,pointer);this->profiler.end(1450,profilingStart);}
+void m_glBindBufferOffsetEXT_profiling(GLenum target,GLuint index,GLuint buffer,GLintptr offset)const{auto const profilingStart=this->profiler.begin(1451);(this->*((FunctionTable::MEMBERPFNGLBINDBUFFEROFFSETEXTPROC)this->m_profiledFunctions[1451]))(target,index,buffer,offset);this->profiler.end(1451,profilingStart);}
+void m_glWeightfvARB_profiling(GLint size,const GLfloat* weights)const{auto const profilingStart=this->profiler.begin(1452);(this->*((FunctionTable::MEMBERPFNGLWEIGHTFVARBPROC)this->m_profiledFunctions[1452]))(size,weights);this->profiler.end(1452,profilingStart);}
+void m_glGetIntegeri_v_profiling(GLenum target,GLuint index,GLint* data)const{auto const profilingStart=this->profiler.begin(1453);(this->*((FunctionTable::MEMBERPFNGLGETINTEGERI_VPROC)this->m_profiledFunctions[1453]))(target,index,data);this->profiler.end(1453,profilingStart);}
+void m_glGetTransformFeedbackVarying_profiling(GLuint program,GLuint index,GLsizei bufSize,GLsizei* length,GLsizei* size,GLenum* type,GLchar* name)const{auto const profilingStart=this->profiler.begin(1454);(this->*((FunctionTable::MEMBERPFNGLGETTRANSFORMFEEDBACKVARYINGPROC)this->m_profiledFunctions[1454]))(program,index,bufSize,length,size,type,name);this->profiler.end(1454,profilingStart);}
+void m_glProgramLocalParameter4fvARB_profiling(GLenum target,GLuint index,const GLfloat* params)const{auto const profilingStart=this->profiler.begin(1455);(this->*((FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETER4FVARBPROC)this->m_profiledFunctions[1455]))(target,index,params);this->profiler.end(1455,profilingStart);}
+void m_glGetTransformFeedbackVaryingNV_profiling(GLuint program,GLuint index,GLint* location)const{auto const profilingStart=this->profiler.begin(1456);(this->*((FunctionTable::MEMBERPFNGLGETTRANSFORMFEEDBACKVARYINGNVPROC)this->m_profiledFunctions[1456]))(program,index,location);this->profiler.end(1456,profilingStart);}
+void m_glWindowPos2iv_profiling(const GLint* v)const{auto const profilingStart=this->profiler.begin(1457);(this->*((FunctionTable::MEMBERPFNGLWINDOWPOS2IVPROC)this->m_profiledFunctions[1457]))(v);this->profiler.end(1457,profilingStart);}
+void m_glVertexStream1dATI_profiling(GLenum stream,GLdouble x)const{auto const profilingStart=this->profiler.begin(1458);(this->*((FunctionTable::MEMBERPFNGLVERTEXSTREAM1DATIPROC)this->m_profiledFunctions[1458]))(stream,x);this->profiler.end(1458,profilingStart);}
+void m_glColorFragmentOp2ATI_profiling(GLenum op,GLuint dst,GLuint dstMask,GLuint dstMod,GLuint arg1,GLuint arg1Rep,GLuint arg1Mod,GLuint arg2,GLuint arg2Rep,GLuint arg2Mod)const{auto const profilingStart=this->profiler.begin(1459);(this->*((FunctionTable::MEMBERPFNGLCOLORFRAGMENTOP2ATIPROC)this->m_profiledFunctions[1459]))(op,dst,dstMask,dstMod,arg1,arg1Rep,arg1Mod,arg2,arg2Rep,arg2Mod);this->profiler.end(1459,profilingStart);}
+void m_glFogiv_profiling(GLenum pname,const GLint* params)const{auto const profilingStart=this->profiler.begin(1460);(this->*((FunctionTable::MEMBERPFNGLFOGIVPROC)this->m_profiledFunctions[1460]))(pname,params);this->profiler.end(1460,profilingStart);}
+GLuint64 m_glGetTextureHandleNV_profiling(GLuint texture)const{auto const profilingStart=this->profiler.begin(1461);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLGETTEXTUREHANDLENVPROC)this->m_profiledFunctions[1461]))(texture);this->profiler.end(1461,profilingStart);return profilingResult;}
+void m_glLightModeliv_profiling(GLenum pname,const GLint* params)const{auto const profilingStart=this->profiler.begin(1462);(this->*((FunctionTable::MEMBERPFNGLLIGHTMODELIVPROC)this->m_profiledFunctions[1462]))(pname,params);this->profiler.end(1462,profilingStart);}
+void m_glDepthRangef_profiling(GLfloat n,GLfloat f)const{auto const profilingStart=this->profiler.begin(1463);(this->*((FunctionTable::MEMBERPFNGLDEPTHRANGEFPROC)this->m_profiledFunctions[1463]))(n,f);this->profiler.end(1463,profilingStart);}
+void m_glGetFragmentMaterialivSGIX_profiling(GLenum face,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(1464);(this->*((FunctionTable::MEMBERPFNGLGETFRAGMENTMATERIALIVSGIXPROC)this->m_profiledFunctions[1464]))(face,pname,params);this->profiler.end(1464,profilingStart);}
+void m_glVideoCaptureStreamParameterfvNV_profiling(GLuint video_capture_slot,GLuint stream,GLenum pname,const GLfloat* params)const{auto const profilingStart=this->profiler.begin(1465);(this->*((FunctionTable::MEMBERPFNGLVIDEOCAPTURESTREAMPARAMETERFVNVPROC)this->m_profiledFunctions[1465]))(video_capture_slot,stream,pname,params);this->profiler.end(1465,profilingStart);}
+void m_glDeleteProgramsARB_profiling(GLsizei n,const GLuint* programs)const{auto const profilingStart=this->profiler.begin(1466);(this->*((FunctionTable::MEMBERPFNGLDELETEPROGRAMSARBPROC)this->m_profiledFunctions[1466]))(n,programs);this->profiler.end(1466,profilingStart);}
+void m_glWindowPos3fvARB_profiling(const GLfloat* v)const{auto const profilingStart=this->profiler.begin(1467);(this->*((FunctionTable::MEMBERPFNGLWINDOWPOS3FVARBPROC)this->m_profiledFunctions[1467]))(v);this->profiler.end(1467,profilingStart);}
+void m_glFeedbackBufferxOES_profiling(GLsizei n,GLenum type,const GLfixed* buffer)const{auto const profilingStart=this->profiler.begin(1468);(this->*((FunctionTable::MEMBERPFNGLFEEDBACKBUFFERXOESPROC)this->m_profiledFunctions[1468]))(n,type,buffer);this->profiler.end(1468,profilingStart);}
+void m_glGetTexBumpParameterfvATI_profiling(GLenum pname,GLfloat* param)const{auto const profilingStart=this->profiler.begin(1469);(this->*((FunctionTable::MEMBERPFNGLGETTEXBUMPPARAMETERFVATIPROC)this->m_profiledFunctions[1469]))(pname,param);this->profiler.end(1469,profilingStart);}
+void m_glEnablei_profiling(GLenum target,GLuint index)const{auto const profilingStart=this->profiler.begin(1470);(this->*((FunctionTable::MEMBERPFNGLENABLEIPROC)this->m_profiledFunctions[1470]))(target,index);this->profiler.end(1470,profilingStart);}
+void m_glGetActiveSubroutineName_profiling(GLuint program,GLenum shadertype,GLuint index,GLsizei bufsize,GLsizei* length,GLchar* name)const{auto const profilingStart=this->profiler.begin(1471);(this->*((FunctionTable::MEMBERPFNGLGETACTIVESUBROUTINENAMEPROC)this->m_profiledFunctions[1471]))(program,shadertype,index,bufsize,length,name);this->profiler.end(1471,profilingStart);}
+void m_glDrawBuffersARB_profiling(GLsizei n,const GLenum* bufs)const{auto const profilingStart=this->profiler.begin(1472);(this->*((FunctionTable::MEMBERPFNGLDRAWBUFFERSARBPROC)this->m_profiledFunctions[1472]))(n,bufs);this->profiler.end(1472,profilingStart);}
+void m_glBindProgramARB_profiling(GLenum target,GLuint program)const{auto const profilingStart=this->profiler.begin(1473);(this->*((FunctionTable::MEMBERPFNGLBINDPROGRAMARBPROC)this->m_profiledFunctions[1473]))(target,program);this->profiler.end(1473,profilingStart);}
+void m_glEvalCoord1fv_profiling(const GLfloat* u)const{auto const profilingStart=this->profiler.begin(1474);(this->*((FunctionTable::MEMBERPFNGLEVALCOORD1FVPROC)this->m_profiledFunctions[1474]))(u);this->profiler.end(1474,profilingStart);}
+void m_glProgramUniform3ui64vARB_profiling(GLuint program,GLint location,GLsizei count,const GLuint64* value)const{auto const profilingStart=this->profiler.begin(1475);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UI64VARBPROC)this->m_profiledFunctions[1475]))(program,location,count,value);this->profiler.end(1475,profilingStart);}
+void m_glProgramUniformMatrix2dv_profiling(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{auto const profilingStart=this->profiler.begin(1476);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2DVPROC)this->m_profiledFunctions[1476]))(program,location,count,transpose,value);this->profiler.end(1476,profilingStart);}
+void m_glMultiTexCoord2hvNV_profiling(GLenum target,const GLhalfNV* v)const{auto const profilingStart=this->profiler.begin(1477);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD2HVNVPROC)this->m_profiledFunctions[1477]))(target,v);this->profiler.end(1477,profilingStart);}
+void m_glGetFloatIndexedvEXT_profiling(GLenum target,GLuint index,GLfloat* data)const{auto const profilingStart=this->profiler.begin(1478);(this->*((FunctionTable::MEMBERPFNGLGETFLOATINDEXEDVEXTPROC)this->m_profiledFunctions[1478]))(target,index,data);this->profiler.end(1478,profilingStart);}
+void m_glSampleCoverageARB_profiling(GLfloat value,GLboolean invert)const{auto const profilingStart=this->profiler.begin(1479);(this->*((FunctionTable::MEMBERPFNGLSAMPLECOVERAGEARBPROC)this->m_profiledFunctions[1479]))(value,invert);this->profiler.end(1479,profilingStart);}
+void m_glProgramUniform2ui64vARB_profiling(GLuint program,GLint location,GLsizei count,const GLuint64* value)const{auto const profilingStart=this->profiler.begin(1480);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UI64VARBPROC)this->m_profiledFunctions[1480]))(program,location,count,value);this->profiler.end(1480,profilingStart);}
+void m_glPixelDataRangeNV_profiling(GLenum target,GLsizei length,const void* pointer)const{auto const profilingStart=this->profiler.begin(1481);(this->*((FunctionTable::MEMBERPFNGLPIXELDATARANGENVPROC)this->m_profiledFunctions[1481]))(target,length,pointer);this->profiler.end(1481,profilingStart);}
+void m_glVertexStream3svATI_profiling(GLenum stream,const GLshort* coords)const{auto const profilingStart=this->profiler.begin(1482);(this->*((FunctionTable::MEMBERPFNGLVERTEXSTREAM3SVATIPROC)this->m_profiledFunctions[1482]))(stream,coords);this->profiler.end(1482,profilingStart);}
+void m_glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN_profiling(const GLuint* rc,const GLfloat* tc,const GLfloat* n,const GLfloat* v)const{auto const profilingStart=this->profiler.begin(1483);(this->*((FunctionTable::MEMBERPFNGLREPLACEMENTCODEUITEXCOORD2FNORMAL3FVERTEX3FVSUNPROC)this->m_profiledFunctions[1483]))(rc,tc,n,v);this->profiler.end(1483,profilingStart);}
+void m_glTexCoord3hvNV_profiling(const GLhalfNV* v)const{auto const profilingStart=this->profiler.begin(1484);(this->*((FunctionTable::MEMBERPFNGLTEXCOORD3HVNVPROC)this->m_profiledFunctions[1484]))(v);this->profiler.end(1484,profilingStart);}
+void m_glSampleMaski_profiling(GLuint maskNumber,GLbitfield mask)const{auto const profilingStart=this->profiler.begin(1485);(this->*((FunctionTable::MEMBERPFNGLSAMPLEMASKIPROC)this->m_profiledFunctions[1485]))(maskNumber,mask);this->profiler.end(1485,profilingStart);}
+void m_glIndexFuncEXT_profiling(GLenum func,GLclampf ref)const{auto const profilingStart=this->profiler.begin(1486);(this->*((FunctionTable::MEMBERPFNGLINDEXFUNCEXTPROC)this->m_profiledFunctions[1486]))(func,ref);this->profiler.end(1486,profilingStart);}
+void m_glPointParameteriNV_profiling(GLenum pname,GLint param)const{auto const profilingStart=this->profiler.begin(1487);(this->*((FunctionTable::MEMBERPFNGLPOINTPARAMETERINVPROC)this->m_profiledFunctions[1487]))(pname,param);this->profiler.end(1487,profilingStart);}
+void m_glUniformMatrix3x2fv_profiling(GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{auto const profilingStart=this->profiler.begin(1488);(this->*((FunctionTable::MEMBERPFNGLUNIFORMMATRIX3X2FVPROC)this->m_profiledFunctions[1488]))(location,count,transpose,value);this->profiler.end(1488,profilingStart);}
+void m_glGetFramebufferParameterivEXT_profiling(GLuint framebuffer,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(1489);(this->*((FunctionTable::MEMBERPFNGLGETFRAMEBUFFERPARAMETERIVEXTPROC)this->m_profiledFunctions[1489]))(framebuffer,pname,params);this->profiler.end(1489,profilingStart);}
+void m_glUniform2i64ARB_profiling(GLint location,GLint64 x,GLint64 y)const{auto const profilingStart=this->profiler.begin(1490);(this->*((FunctionTable::MEMBERPFNGLUNIFORM2I64ARBPROC)this->m_profiledFunctions[1490]))(location,x,y);this->profiler.end(1490,profilingStart);}
+void m_glNamedBufferStorageEXT_profiling(GLuint buffer,GLsizeiptr size,const void* data,GLbitfield flags)const{auto const profilingStart=this->profiler.begin(1491);(this->*((FunctionTable::MEMBERPFNGLNAMEDBUFFERSTORAGEEXTPROC)this->m_profiledFunctions[1491]))(buffer,size,data,flags);this->profiler.end(1491,profilingStart);}
+void m_glNamedFramebufferTexture3DEXT_profiling(GLuint framebuffer,GLenum attachment,GLenum textarget,GLuint texture,GLint level,GLint zoffset)const{auto const profilingStart=this->profiler.begin(1492);(this->*((FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTURE3DEXTPROC)this->m_profiledFunctions[1492]))(framebuffer,attachment,textarget,texture,level,zoffset);this->profiler.end(1492,profilingStart);}
+void m_glVertexAttrib2dv_profiling(GLuint index,const GLdouble* v)const{auto const profilingStart=this->profiler.begin(1493);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB2DVPROC)this->m_profiledFunctions[1493]))(index,v);this->profiler.end(1493,profilingStart);}
+void m_glGetVertexArrayPointervEXT_profiling(GLuint vaobj,GLenum pname,void** param)const{auto const profilingStart=this->profiler.begin(1494);(this->*((FunctionTable::MEMBERPFNGLGETVERTEXARRAYPOINTERVEXTPROC)this->m_profiledFunctions[1494]))(vaobj,pname,param);this->profiler.end(1494,profilingStart);}
+void m_glGetVertexAttribArrayObjectivATI_profiling(GLuint index,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(1495);(this->*((FunctionTable::MEMBERPFNGLGETVERTEXATTRIBARRAYOBJECTIVATIPROC)this->m_profiledFunctions[1495]))(index,pname,params);this->profiler.end(1495,profilingStart);}
+void m_glProgramUniformMatrix3fvEXT_profiling(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{auto const profilingStart=this->profiler.begin(1496);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3FVEXTPROC)this->m_profiledFunctions[1496]))(program,location,count,transpose,value);this->profiler.end(1496,profilingStart);}
+void m_glEnableVertexArrayEXT_profiling(GLuint vaobj,GLenum array)const{auto const profilingStart=this->profiler.begin(1497);(this->*((FunctionTable::MEMBERPFNGLENABLEVERTEXARRAYEXTPROC)this->m_profiledFunctions[1497]))(vaobj,array);this->profiler.end(1497,profilingStart);}
+void m_glColorTableParameterfvSGI_profiling(GLenum target,GLenum pname,const GLfloat* params)const{auto const profilingStart=this->profiler.begin(1498);(this->*((FunctionTable::MEMBERPFNGLCOLORTABLEPARAMETERFVSGIPROC)this->m_profiledFunctions[1498]))(target,pname,params);this->profiler.end(1498,profilingStart);}
+void m_glEdgeFlag_profiling(GLboolean flag)const{auto const profilingStart=this->profiler.begin(1499);(this->*((FunctionTable::MEMBERPFNGLEDGEFLAGPROC)this->m_profiledFunctions[1499]))(flag);this->profiler.end(1499,profilingStart);}
+void m_glFogCoordf_profiling(GLfloat coord)const{auto const profilingStart=this->profiler.begin(1500);(this->*((FunctionTable::MEMBERPFNGLFOGCOORDFPROC)this->m_profiledFunctions[1500]))(coord);this->profiler.end(1500,profilingStart);}
+void m_glVertex3d_profiling(GLdouble x,GLdouble y,GLdouble z)const{auto const profilingStart=this->profiler.begin(1501);(this->*((FunctionTable::MEMBERPFNGLVERTEX3DPROC)this->m_profiledFunctions[1501]))(x,y,z);this->profiler.end(1501,profilingStart);}
+void m_glVertex3f_profiling(GLfloat x,GLfloat y,GLfloat z)const{auto const profilingStart=this->profiler.begin(1502);(this->*((FunctionTable::MEMBERPFNGLVERTEX3FPROC)this->m_profiledFunctions[1502]))(x,y,z);this->profiler.end(1502,profilingStart);}
+void m_glSpriteParameterivSGIX_profiling(GLenum pname,const GLint* params)const{auto const profilingStart=this->profiler.begin(1503);(this->*((FunctionTable::MEMBERPFNGLSPRITEPARAMETERIVSGIXPROC)this->m_profiledFunctions[1503]))(pname,params);this->profiler.end(1503,profilingStart);}
+void m_glPathGlyphRangeNV_profiling(GLuint firstPathName,GLenum fontTarget,const void* fontName,GLbitfield fontStyle,GLuint firstGlyph,GLsizei numGlyphs,GLenum handleMissingGlyphs,GLuint pathParameterTemplate,GLfloat emScale)const{auto const profilingStart=this->profiler.begin(1504);(this->*((FunctionTable::MEMBERPFNGLPATHGLYPHRANGENVPROC)this->m_profiledFunctions[1504]))(firstPathName,fontTarget,fontName,fontStyle,firstGlyph,numGlyphs,handleMissingGlyphs,pathParameterTemplate,emScale);this->profiler.end(1504,profilingStart);}
+void m_glPrimitiveBoundingBoxARB_profiling(GLfloat minX,GLfloat minY,GLfloat minZ,GLfloat minW,GLfloat maxX,GLfloat maxY,GLfloat maxZ,GLfloat maxW)const{auto const profilingStart=this->profiler.begin(1505);(this->*((FunctionTable::MEMBERPFNGLPRIMITIVEBOUNDINGBOXARBPROC)this->m_profiledFunctions[1505]))(minX,minY,minZ,minW,maxX,maxY,maxZ,maxW);this->profiler.end(1505,profilingStart);}
+void m_glVertexAttribL3ui64vNV_profiling(GLuint index,const GLuint64EXT* v)const{auto const profilingStart=this->profiler.begin(1506);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBL3UI64VNVPROC)this->m_profiledFunctions[1506]))(index,v);this->profiler.end(1506,profilingStart);}
+void m_glVertex3s_profiling(GLshort x,GLshort y,GLshort z)const{auto const profilingStart=this->profiler.begin(1507);(this->*((FunctionTable::MEMBERPFNGLVERTEX3SPROC)this->m_profiledFunctions[1507]))(x,y,z);this->profiler.end(1507,profilingStart);}
+void m_glTexCoordP2ui_profiling(GLenum type,GLuint coords)const{auto const profilingStart=this->profiler.begin(1508);(this->*((FunctionTable::MEMBERPFNGLTEXCOORDP2UIPROC)this->m_profiledFunctions[1508]))(type,coords);this->profiler.end(1508,profilingStart);}
+void m_glProgramUniform2fvEXT_profiling(GLuint program,GLint location,GLsizei count,const GLfloat* value)const{auto const profilingStart=this->profiler.begin(1509);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2FVEXTPROC)this->m_profiledFunctions[1509]))(program,location,count,value);this->profiler.end(1509,profilingStart);}
+void m_glDeletePathsNV_profiling(GLuint path,GLsizei range)const{auto const profilingStart=this->profiler.begin(1510);(this->*((FunctionTable::MEMBERPFNGLDELETEPATHSNVPROC)this->m_profiledFunctions[1510]))(path,range);this->profiler.end(1510,profilingStart);}
+void m_glPrimitiveRestartIndexNV_profiling(GLuint index)const{auto const profilingStart=this->profiler.begin(1511);(this->*((FunctionTable::MEMBERPFNGLPRIMITIVERESTARTINDEXNVPROC)this->m_profiledFunctions[1511]))(index);this->profiler.end(1511,profilingStart);}
+void m_glTexCoord2fColor3fVertex3fvSUN_profiling(const GLfloat* tc,const GLfloat* c,const GLfloat* v)const{auto const profilingStart=this->profiler.begin(1512);(this->*((FunctionTable::MEMBERPFNGLTEXCOORD2FCOLOR3FVERTEX3FVSUNPROC)this->m_profiledFunctions[1512]))(tc,c,v);this->profiler.end(1512,profilingStart);}
+void m_glTexCoordPointerListIBM_profiling(GLint size,GLenum type,GLint stride,const void** pointer,GLint ptrstride)const{auto const profilingStart=this->profiler.begin(1513);(this->*((FunctionTable::MEMBERPFNGLTEXCOORDPOINTERLISTIBMPROC)this->m_profiledFunctions[1513]))(size,type,stride,pointer,ptrstride);this->profiler.end(1513,profilingStart);}
+void m_glRectxOES_profiling(GLfixed x1,GLfixed y1,GLfixed x2,GLfixed y2)const{auto const profilingStart=this->profiler.begin(1514);(this->*((FunctionTable::MEMBERPFNGLRECTXOESPROC)this->m_profiledFunctions[1514]))(x1,y1,x2,y2);this->profiler.end(1514,profilingStart);}
+void m_glCopyNamedBufferSubData_profiling(GLuint readBuffer,GLuint writeBuffer,GLintptr readOffset,GLintptr writeOffset,GLsizeiptr size)const{auto const profilingStart=this->profiler.begin(1515);(this->*((FunctionTable::MEMBERPFNGLCOPYNAMEDBUFFERSUBDATAPROC)this->m_profiledFunctions[1515]))(readBuffer,writeBuffer,readOffset,writeOffset,size);this->profiler.end(1515,profilingStart);}
+void m_glGenProgramsNV_profiling(GLsizei n,GLuint* programs)const{auto const profilingStart=this->profiler.begin(1516);(this->*((FunctionTable::MEMBERPFNGLGENPROGRAMSNVPROC)this->m_profiledFunctions[1516]))(n,programs);this->profiler.end(1516,profilingStart);}
+void m_glFragmentLightfSGIX_profiling(GLenum light,GLenum pname,GLfloat param)const{auto const profilingStart=this->profiler.begin(1517);(this->*((FunctionTable::MEMBERPFNGLFRAGMENTLIGHTFSGIXPROC)this->m_profiledFunctions[1517]))(light,pname,param);this->profiler.end(1517,profilingStart);}
+void m_glTexStorage3D_profiling(GLenum target,GLsizei levels,GLenum internalformat,GLsizei width,GLsizei height,GLsizei depth)const{auto const profilingStart=this->profiler.begin(1518);(this->*((FunctionTable::MEMBERPFNGLTEXSTORAGE3DPROC)this->m_profiledFunctions[1518]))(target,levels,internalformat,width,height,depth);this->profiler.end(1518,profilingStart);}
+void m_glTextureParameteriv_profiling(GLuint texture,GLenum pname,const GLint* param)const{auto const profilingStart=this->profiler.begin(1519);(this->*((FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIVPROC)this->m_profiledFunctions[1519]))(texture,pname,param);this->profiler.end(1519,profilingStart);}
+void m_glNamedBufferDataEXT_profiling(GLuint buffer,GLsizeiptr size,const void* data,GLenum usage)const{auto const profilingStart=this->profiler.begin(1520);(this->*((FunctionTable::MEMBERPFNGLNAMEDBUFFERDATAEXTPROC)this->m_profiledFunctions[1520]))(buffer,size,data,usage);this->profiler.end(1520,profilingStart);}
+void m_glMultiTexCoord3fvARB_profiling(GLenum target,const GLfloat* v)const{auto const profilingStart=this->profiler.begin(1521);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD3FVARBPROC)this->m_profiledFunctions[1521]))(target,v);this->profiler.end(1521,profilingStart);}
+void m_glUniformMatrix3x4fv_profiling(GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{auto const profilingStart=this->profiler.begin(1522);(this->*((FunctionTable::MEMBERPFNGLUNIFORMMATRIX3X4FVPROC)this->m_profiledFunctions[1522]))(location,count,transpose,value);this->profiler.end(1522,profilingStart);}
+void m_glSubpixelPrecisionBiasNV_profiling(GLuint xbits,GLuint ybits)const{auto const profilingStart=this->profiler.begin(1523);(this->*((FunctionTable::MEMBERPFNGLSUBPIXELPRECISIONBIASNVPROC)this->m_profiledFunctions[1523]))(xbits,ybits);this->profiler.end(1523,profilingStart);}
+void m_glNormalPointer_profiling(GLenum type,GLsizei stride,const GLvoid* ptr)const{auto const profilingStart=this->profiler.begin(1524);(this->*((FunctionTable::MEMBERPFNGLNORMALPOINTERPROC)this->m_profiledFunctions[1524]))(type,stride,ptr);this->profiler.end(1524,profilingStart);}
+void m_glNamedFramebufferTexture_profiling(GLuint framebuffer,GLenum attachment,GLuint texture,GLint level)const{auto const profilingStart=this->profiler.begin(1525);(this->*((FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTUREPROC)this->m_profiledFunctions[1525]))(framebuffer,attachment,texture,level);this->profiler.end(1525,profilingStart);}
+void m_glVertexAttrib4NsvARB_profiling(GLuint index,const GLshort* v)const{auto const profilingStart=this->profiler.begin(1526);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB4NSVARBPROC)this->m_profiledFunctions[1526]))(index,v);this->profiler.end(1526,profilingStart);}
+void m_glPassThrough_profiling(GLfloat token)const{auto const profilingStart=this->profiler.begin(1527);(this->*((FunctionTable::MEMBERPFNGLPASSTHROUGHPROC)this->m_profiledFunctions[1527]))(token);this->profiler.end(1527,profilingStart);}
+void m_glSecondaryColorP3ui_profiling(GLenum type,GLuint color)const{auto const profilingStart=this->profiler.begin(1528);(this->*((FunctionTable::MEMBERPFNGLSECONDARYCOLORP3UIPROC)this->m_profiledFunctions[1528]))(type,color);this->profiler.end(1528,profilingStart);}
+void m_glInvalidateTexSubImage_profiling(GLuint texture,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth)const{auto const profilingStart=this->profiler.begin(1529);(this->*((FunctionTable::MEMBERPFNGLINVALIDATETEXSUBIMAGEPROC)this->m_profiledFunctions[1529]))(texture,level,xoffset,yoffset,zoffset,width,height,depth);this->profiler.end(1529,profilingStart);}
+GLboolean m_glIsImageHandleResidentARB_profiling(GLuint64 handle)const{auto const profilingStart=this->profiler.begin(1530);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLISIMAGEHANDLERESIDENTARBPROC)this->m_profiledFunctions[1530]))(handle);this->profiler.end(1530,profilingStart);return profilingResult;}
+void m_glTangent3fvEXT_profiling(const GLfloat* v)const{auto const profilingStart=this->profiler.begin(1531);(this->*((FunctionTable::MEMBERPFNGLTANGENT3FVEXTPROC)this->m_profiledFunctions[1531]))(v);this->profiler.end(1531,profilingStart);}
+void m_glProgramUniformMatrix4x3fv_profiling(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{auto const profilingStart=this->profiler.begin(1532);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X3FVPROC)this->m_profiledFunctions[1532]))(program,location,count,transpose,value);this->profiler.end(1532,profilingStart);}
+void m_glBegin_profiling(GLenum mode)const{auto const profilingStart=this->profiler.begin(1533);(this->*((FunctionTable::MEMBERPFNGLBEGINPROC)this->m_profiledFunctions[1533]))(mode);this->profiler.end(1533,profilingStart);}
+void m_glEvalCoord2dv_profiling(const GLdouble* u)const{auto const profilingStart=this->profiler.begin(1534);(this->*((FunctionTable::MEMBERPFNGLEVALCOORD2DVPROC)this->m_profiledFunctions[1534]))(u);this->profiler.end(1534,profilingStart);}
+void m_glColor3ubv_profiling(const GLubyte* v)const{auto const profilingStart=this->profiler.begin(1535);(this->*((FunctionTable::MEMBERPFNGLCOLOR3UBVPROC)this->m_profiledFunctions[1535]))(v);this->profiler.end(1535,profilingStart);}
+void m_glFogCoordfvEXT_profiling(const GLfloat* coord)const{auto const profilingStart=this->profiler.begin(1536);(this->*((FunctionTable::MEMBERPFNGLFOGCOORDFVEXTPROC)this->m_profiledFunctions[1536]))(coord);this->profiler.end(1536,profilingStart);}
+void m_glVertexP3ui_profiling(GLenum type,GLuint value)const{auto const profilingStart=this->profiler.begin(1537);(this->*((FunctionTable::MEMBERPFNGLVERTEXP3UIPROC)this->m_profiledFunctions[1537]))(type,value);this->profiler.end(1537,profilingStart);}
+void m_glLightfv_profiling(GLenum light,GLenum pname,const GLfloat* params)const{auto const profilingStart=this->profiler.begin(1538);(this->*((FunctionTable::MEMBERPFNGLLIGHTFVPROC)this->m_profiledFunctions[1538]))(light,pname,params);this->profiler.end(1538,profilingStart);}
+void m_glVertexAttribL3i64NV_profiling(GLuint index,GLint64EXT x,GLint64EXT y,GLint64EXT z)const{auto const profilingStart=this->profiler.begin(1539);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBL3I64NVPROC)this->m_profiledFunctions[1539]))(index,x,y,z);this->profiler.end(1539,profilingStart);}
+void m_glStencilClearTagEXT_profiling(GLsizei stencilTagBits,GLuint stencilClearTag)const{auto const profilingStart=this->profiler.begin(1540);(this->*((FunctionTable::MEMBERPFNGLSTENCILCLEARTAGEXTPROC)this->m_profiledFunctions[1540]))(stencilTagBits,stencilClearTag);this->profiler.end(1540,profilingStart);}
+void m_glGetActiveUniformName_profiling(GLuint program,GLuint uniformIndex,GLsizei bufSize,GLsizei* length,GLchar* uniformName)const{auto const profilingStart=this->profiler.begin(1541);(this->*((FunctionTable::MEMBERPFNGLGETACTIVEUNIFORMNAMEPROC)this->m_profiledFunctions[1541]))(program,uniformIndex,bufSize,length,uniformName);this->profiler.end(1541,profilingStart);}
+void m_glTangentPointerEXT_profiling(GLenum type,GLsizei stride,const void* pointer)const{auto const profilingStart=this->profiler.begin(1542);(this->*((FunctionTable::MEMBERPFNGLTANGENTPOINTEREXTPROC)this->m_profiledFunctions[1542]))(type,stride,pointer);this->profiler.end(1542,profilingStart);}
+void m_glUniform4ui64vNV_profiling(GLint location,GLsizei count,const GLuint64EXT* value)const{auto const profilingStart=this->profiler.begin(1543);(this->*((FunctionTable::MEMBERPFNGLUNIFORM4UI64VNVPROC)this->m_profiledFunctions[1543]))(location,count,value);this->profiler.end(1543,profilingStart);}
+void m_glDebugMessageEnableAMD_profiling(GLenum category,GLenum severity,GLsizei count,const GLuint* ids,GLboolean enabled)const{auto const profilingStart=this->profiler.begin(1544);(this->*((FunctionTable::MEMBERPFNGLDEBUGMESSAGEENABLEAMDPROC)this->m_profiledFunctions[1544]))(category,severity,count,ids,enabled);this->profiler.end(1544,profilingStart);}
+void m_glProgramUniform2ui_profiling(GLuint program,GLint location,GLuint v0,GLuint v1)const{auto const profilingStart=this->profiler.begin(1545);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UIPROC)this->m_profiledFunctions[1545]))(program,location,v0,v1);this->profiler.end(1545,profilingStart);}
+void m_glCopyTexSubImage2DEXT_profiling(GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint x,GLint y,GLsizei width,GLsizei height)const{auto const profilingStart=this->profiler.begin(1546);(this->*((FunctionTable::MEMBERPFNGLCOPYTEXSUBIMAGE2DEXTPROC)this->m_profiledFunctions[1546]))(target,level,xoffset,yoffset,x,y,width,height);this->profiler.end(1546,profilingStart);}
+void m_glGenRenderbuffersEXT_profiling(GLsizei n,GLuint* renderbuffers)const{auto const profilingStart=this->profiler.begin(1547);(this->*((FunctionTable::MEMBERPFNGLGENRENDERBUFFERSEXTPROC)this->m_profiledFunctions[1547]))(n,renderbuffers);this->profiler.end(1547,profilingStart);}
+void m_glNamedProgramLocalParameterI4ivEXT_profiling(GLuint program,GLenum target,GLuint index,const GLint* params)const{auto const profilingStart=this->profiler.begin(1548);(this->*((FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERI4IVEXTPROC)this->m_profiledFunctions[1548]))(program,target,index,params);this->profiler.end(1548,profilingStart);}
+void m_glMultiTexCoord2f_profiling(GLenum target,GLfloat s,GLfloat t)const{auto const profilingStart=this->profiler.begin(1549);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD2FPROC)this->m_profiledFunctions[1549]))(target,s,t);this->profiler.end(1549,profilingStart);}
+void m_glMapGrid2d_profiling(GLint un,GLdouble u1,GLdouble u2,GLint vn,GLdouble v1,GLdouble v2)const{auto const profilingStart=this->profiler.begin(1550);(this->*((FunctionTable::MEMBERPFNGLMAPGRID2DPROC)this->m_profiledFunctions[1550]))(un,u1,u2,vn,v1,v2);this->profiler.end(1550,profilingStart);}
+void m_glGetMultiTexParameterIuivEXT_profiling(GLenum texunit,GLenum target,GLenum pname,GLuint* params)const{auto const profilingStart=this->profiler.begin(1551);(this->*((FunctionTable::MEMBERPFNGLGETMULTITEXPARAMETERIUIVEXTPROC)this->m_profiledFunctions[1551]))(texunit,target,pname,params);this->profiler.end(1551,profilingStart);}
+void m_glBlendEquationiARB_profiling(GLuint buf,GLenum mode)const{auto const profilingStart=this->profiler.begin(1552);(this->*((FunctionTable::MEMBERPFNGLBLENDEQUATIONIARBPROC)this->m_profiledFunctions[1552]))(buf,mode);this->profiler.end(1552,profilingStart);}
+void m_glTexParameteriv_profiling(GLenum target,GLenum pname,const GLint* params)const{auto const profilingStart=this->profiler.begin(1553);(this->*((FunctionTable::MEMBERPFNGLTEXPARAMETERIVPROC)this->m_profiledFunctions[1553]))(target,pname,params);this->profiler.end(1553,profilingStart);}
+void m_glUniform4ivARB_profiling(GLint location,GLsizei count,const GLint* value)const{auto const profilingStart=this->profiler.begin(1554);(this->*((FunctionTable::MEMBERPFNGLUNIFORM4IVARBPROC)this->m_profiledFunctions[1554]))(location,count,value);this->profiler.end(1554,profilingStart);}
+void m_glMatrixOrthoEXT_profiling(GLenum mode,GLdouble left,GLdouble right,GLdouble bottom,GLdouble top,GLdouble zNear,GLdouble zFar)const{auto const profilingStart=this->profiler.begin(1555);(this->*((FunctionTable::MEMBERPFNGLMATRIXORTHOEXTPROC)this->m_profiledFunctions[1555]))(mode,left,right,bottom,top,zNear,zFar);this->profiler.end(1555,profilingStart);}
+void m_glVertexArrayVertexBuffer_profiling(GLuint vaobj,GLuint bindingindex,GLuint buffer,GLintptr offset,GLsizei stride)const{auto const profilingStart=this->profiler.begin(1556);(this->*((FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXBUFFERPROC)this->m_profiledFunctions[1556]))(vaobj,bindingindex,buffer,offset,stride);this->profiler.end(1556,profilingStart);}
+void m_glProgramLocalParametersI4ivNV_profiling(GLenum target,GLuint index,GLsizei count,const GLint* params)const{auto const profilingStart=this->profiler.begin(1557);(this->*((FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERSI4IVNVPROC)this->m_profiledFunctions[1557]))(target,index,count,params);this->profiler.end(1557,profilingStart);}
+void m_glProgramUniform4ui64vNV_profiling(GLuint program,GLint location,GLsizei count,const GLuint64EXT* value)const{auto const profilingStart=this->profiler.begin(1558);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UI64VNVPROC)this->m_profiledFunctions[1558]))(program,location,count,value);this->profiler.end(1558,profilingStart);}
+void m_glGetNamedStringivARB_profiling(GLint namelen,const GLchar* name,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(1559);(this->*((FunctionTable::MEMBERPFNGLGETNAMEDSTRINGIVARBPROC)this->m_profiledFunctions[1559]))(namelen,name,pname,params);this->profiler.end(1559,profilingStart);}
+void m_glVertexAttribL1i64vNV_profiling(GLuint index,const GLint64EXT* v)const{auto const profilingStart=this->profiler.begin(1560);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBL1I64VNVPROC)this->m_profiledFunctions[1560]))(index,v);this->profiler.end(1560,profilingStart);}
+void m_glTransformFeedbackBufferBase_profiling(GLuint xfb,GLuint index,GLuint buffer)const{auto const profilingStart=this->profiler.begin(1561);(this->*((FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKBUFFERBASEPROC)this->m_profiledFunctions[1561]))(xfb,index,buffer);this->profiler.end(1561,profilingStart);}
+void m_glIndexsv_profiling(const GLshort* c)const{auto const profilingStart=this->profiler.begin(1562);(this->*((FunctionTable::MEMBERPFNGLINDEXSVPROC)this->m_profiledFunctions[1562]))(c);this->profiler.end(1562,profilingStart);}
+void m_glPointParameterivNV_profiling(GLenum pname,const GLint* params)const{auto const profilingStart=this->profiler.begin(1563);(this->*((FunctionTable::MEMBERPFNGLPOINTPARAMETERIVNVPROC)this->m_profiledFunctions[1563]))(pname,params);this->profiler.end(1563,profilingStart);}
+void m_glGetDetailTexFuncSGIS_profiling(GLenum target,GLfloat* points)const{auto const profilingStart=this->profiler.begin(1564);(this->*((FunctionTable::MEMBERPFNGLGETDETAILTEXFUNCSGISPROC)this->m_profiledFunctions[1564]))(target,points);this->profiler.end(1564,profilingStart);}
+void m_glReplacementCodeuiColor3fVertex3fvSUN_profiling(const GLuint* rc,const GLfloat* c,const GLfloat* v)const{auto const profilingStart=this->profiler.begin(1565);(this->*((FunctionTable::MEMBERPFNGLREPLACEMENTCODEUICOLOR3FVERTEX3FVSUNPROC)this->m_profiledFunctions[1565]))(rc,c,v);this->profiler.end(1565,profilingStart);}
+void m_glProgramLocalParameter4fARB_profiling(GLenum target,GLuint index,GLfloat x,GLfloat y,GLfloat z,GLfloat w)const{auto const profilingStart=this->profiler.begin(1566);(this->*((FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETER4FARBPROC)this->m_profiledFunctions[1566]))(target,index,x,y,z,w);this->profiler.end(1566,profilingStart);}
+void m_glBitmap_profiling(GLsizei width,GLsizei height,GLfloat xorig,GLfloat yorig,GLfloat xmove,GLfloat ymove,const GLubyte* bitmap)const{auto const profilingStart=this->profiler.begin(1567);(this->*((FunctionTable::MEMBERPFNGLBITMAPPROC)this->m_profiledFunctions[1567]))(width,height,xorig,yorig,xmove,ymove,bitmap);this->profiler.end(1567,profilingStart);}
+void m_glNamedFramebufferTextureLayerEXT_profiling(GLuint framebuffer,GLenum attachment,GLuint texture,GLint level,GLint layer)const{auto const profilingStart=this->profiler.begin(1568);(this->*((FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTURELAYEREXTPROC)this->m_profiledFunctions[1568]))(framebuffer,attachment,texture,level,layer);this->profiler.end(1568,profilingStart);}
+void m_glMultiTexGenfvEXT_profiling(GLenum texunit,GLenum coord,GLenum pname,const GLfloat* params)const{auto const profilingStart=this->profiler.begin(1569);(this->*((FunctionTable::MEMBERPFNGLMULTITEXGENFVEXTPROC)this->m_profiledFunctions[1569]))(texunit,coord,pname,params);this->profiler.end(1569,profilingStart);}
+void m_glGetNamedBufferSubData_profiling(GLuint buffer,GLintptr offset,GLsizeiptr size,void* data)const{auto const profilingStart=this->profiler.begin(1570);(this->*((FunctionTable::MEMBERPFNGLGETNAMEDBUFFERSUBDATAPROC)this->m_profiledFunctions[1570]))(buffer,offset,size,data);this->profiler.end(1570,profilingStart);}
+void m_glStencilFuncSeparateATI_profiling(GLenum frontfunc,GLenum backfunc,GLint ref,GLuint mask)const{auto const profilingStart=this->profiler.begin(1571);(this->*((FunctionTable::MEMBERPFNGLSTENCILFUNCSEPARATEATIPROC)this->m_profiledFunctions[1571]))(frontfunc,backfunc,ref,mask);this->profiler.end(1571,profilingStart);}
+void m_glProgramUniform2iv_profiling(GLuint program,GLint location,GLsizei count,const GLint* value)const{auto const profilingStart=this->profiler.begin(1572);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2IVPROC)this->m_profiledFunctions[1572]))(program,location,count,value);this->profiler.end(1572,profilingStart);}
+void m_glGetQueryiv_profiling(GLenum target,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(1573);(this->*((FunctionTable::MEMBERPFNGLGETQUERYIVPROC)this->m_profiledFunctions[1573]))(target,pname,params);this->profiler.end(1573,profilingStart);}
+void m_glTexCoord4f_profiling(GLfloat s,GLfloat t,GLfloat r,GLfloat q)const{auto const profilingStart=this->profiler.begin(1574);(this->*((FunctionTable::MEMBERPFNGLTEXCOORD4FPROC)this->m_profiledFunctions[1574]))(s,t,r,q);this->profiler.end(1574,profilingStart);}
+void m_glMapGrid2f_profiling(GLint un,GLfloat u1,GLfloat u2,GLint vn,GLfloat v1,GLfloat v2)const{auto const profilingStart=this->profiler.begin(1575);(this->*((FunctionTable::MEMBERPFNGLMAPGRID2FPROC)this->m_profiledFunctions[1575]))(un,u1,u2,vn,v1,v2);this->profiler.end(1575,profilingStart);}
+void m_glListParameterivSGIX_profiling(GLuint list,GLenum pname,const GLint* params)const{auto const profilingStart=this->profiler.begin(1576);(this->*((FunctionTable::MEMBERPFNGLLISTPARAMETERIVSGIXPROC)this->m_profiledFunctions[1576]))(list,pname,params);this->profiler.end(1576,profilingStart);}
+void m_glCreateQueries_profiling(GLenum target,GLsizei n,GLuint* ids)const{auto const profilingStart=this->profiler.begin(1577);(this->*((FunctionTable::MEMBERPFNGLCREATEQUERIESPROC)this->m_profiledFunctions[1577]))(target,n,ids);this->profiler.end(1577,profilingStart);}
+void m_glGetSamplerParameterfv_profiling(GLuint sampler,GLenum pname,GLfloat* params)const{auto const profilingStart=this->profiler.begin(1578);(this->*((FunctionTable::MEMBERPFNGLGETSAMPLERPARAMETERFVPROC)this->m_profiledFunctions[1578]))(sampler,pname,params);this->profiler.end(1578,profilingStart);}
+void m_glTexCoord4i_profiling(GLint s,GLint t,GLint r,GLint q)const{auto const profilingStart=this->profiler.begin(1579);(this->*((FunctionTable::MEMBERPFNGLTEXCOORD4IPROC)this->m_profiledFunctions[1579]))(s,t,r,q);this->profiler.end(1579,profilingStart);}
+void m_glObjectLabel_profiling(GLenum identifier,GLuint name,GLsizei length,const GLchar* label)const{auto const profilingStart=this->profiler.begin(1580);(this->*((FunctionTable::MEMBERPFNGLOBJECTLABELPROC)this->m_profiledFunctions[1580]))(identifier,name,length,label);this->profiler.end(1580,profilingStart);}
+void m_glProgramUniform3i64NV_profiling(GLuint program,GLint location,GLint64EXT x,GLint64EXT y,GLint64EXT z)const{auto const profilingStart=this->profiler.begin(1581);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3I64NVPROC)this->m_profiledFunctions[1581]))(program,location,x,y,z);this->profiler.end(1581,profilingStart);}
+GLuint64 m_glGetTextureHandleARB_profiling(GLuint texture)const{auto const profilingStart=this->profiler.begin(1582);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLGETTEXTUREHANDLEARBPROC)this->m_profiledFunctions[1582]))(texture);this->profiler.end(1582,profilingStart);return profilingResult;}
+void m_glTexCoord4s_profiling(GLshort s,GLshort t,GLshort r,GLshort q)const{auto const profilingStart=this->profiler.begin(1583);(this->*((FunctionTable::MEMBERPFNGLTEXCOORD4SPROC)this->m_profiledFunctions[1583]))(s,t,r,q);this->profiler.end(1583,profilingStart);}
+void m_glUniform4iARB_profiling(GLint location,GLint v0,GLint v1,GLint v2,GLint v3)const{auto const profilingStart=this->profiler.begin(1584);(this->*((FunctionTable::MEMBERPFNGLUNIFORM4IARBPROC)this->m_profiledFunctions[1584]))(location,v0,v1,v2,v3);this->profiler.end(1584,profilingStart);}
+void m_glGetUniformIndices_profiling(GLuint program,GLsizei uniformCount,const GLchar*const* uniformNames,GLuint* uniformIndices)const{auto const profilingStart=this->profiler.begin(1585);(this->*((FunctionTable::MEMBERPFNGLGETUNIFORMINDICESPROC)this->m_profiledFunctions[1585]))(program,uniformCount,uniformNames,uniformIndices);this->profiler.end(1585,profilingStart);}
+void m_glMultiTexImage3DEXT_profiling(GLenum texunit,GLenum target,GLint level,GLint internalformat,GLsizei width,GLsizei height,GLsizei depth,GLint border,GLenum format,GLenum type,const void* pixels)const{auto const profilingStart=this->profiler.begin(1586);(this->*((FunctionTable::MEMBERPFNGLMULTITEXIMAGE3DEXTPROC)this->m_profiledFunctions[1586]))(texunit,target,level,internalformat,width,height,depth,border,format,type,pixels);this->profiler.end(1586,profilingStart);}
+void m_glCoverageModulationTableNV_profiling(GLsizei n,const GLfloat* v)const{auto const profilingStart=this->profiler.begin(1587);(this->*((FunctionTable::MEMBERPFNGLCOVERAGEMODULATIONTABLENVPROC)this->m_profiledFunctions[1587]))(n,v);this->profiler.end(1587,profilingStart);}
+void m_glPointParameteriv_profiling(GLenum pname,const GLint* params)const{auto const profilingStart=this->profiler.begin(1588);(this->*((FunctionTable::MEMBERPFNGLPOINTPARAMETERIVPROC)this->m_profiledFunctions[1588]))(pname,params);this->profiler.end(1588,profilingStart);}
+void m_glMultiTexCoord4svARB_profiling(GLenum target,const GLshort* v)const{auto const profilingStart=this->profiler.begin(1589);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD4SVARBPROC)this->m_profiledFunctions[1589]))(target,v);this->profiler.end(1589,profilingStart);}
+void m_glNormal3fv_profiling(const GLfloat* v)const{auto const profilingStart=this->profiler.begin(1590);(this->*((FunctionTable::MEMBERPFNGLNORMAL3FVPROC)this->m_profiledFunctions[1590]))(v);this->profiler.end(1590,profilingStart);}
+void m_glProgramUniformMatrix3x4dvEXT_profiling(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{auto const profilingStart=this->profiler.begin(1591);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X4DVEXTPROC)this->m_profiledFunctions[1591]))(program,location,count,transpose,value);this->profiler.end(1591,profilingStart);}
+void m_glTexCoord1fv_profiling(const GLfloat* v)const{auto const profilingStart=this->profiler.begin(1592);(this->*((FunctionTable::MEMBERPFNGLTEXCOORD1FVPROC)this->m_profiledFunctions[1592]))(v);this->profiler.end(1592,profilingStart);}
+void m_glProgramUniformMatrix4x3dvEXT_profiling(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{auto const profilingStart=this->profiler.begin(1593);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X3DVEXTPROC)this->m_profiledFunctions[1593]))(program,location,count,transpose,value);this->profiler.end(1593,profilingStart);}
+void m_glGetActiveVaryingNV_profiling(GLuint program,GLuint index,GLsizei bufSize,GLsizei* length,GLsizei* size,GLenum* type,GLchar* name)const{auto const profilingStart=this->profiler.begin(1594);(this->*((FunctionTable::MEMBERPFNGLGETACTIVEVARYINGNVPROC)this->m_profiledFunctions[1594]))(program,index,bufSize,length,size,type,name);this->profiler.end(1594,profilingStart);}
+void m_glUniform1i64vARB_profiling(GLint location,GLsizei count,const GLint64* value)const{auto const profilingStart=this->profiler.begin(1595);(this->*((FunctionTable::MEMBERPFNGLUNIFORM1I64VARBPROC)this->m_profiledFunctions[1595]))(location,count,value);this->profiler.end(1595,profilingStart);}
+void m_glMultiTexCoord1dv_profiling(GLenum target,const GLdouble* v)const{auto const profilingStart=this->profiler.begin(1596);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD1DVPROC)this->m_profiledFunctions[1596]))(target,v);this->profiler.end(1596,profilingStart);}
+void m_glTexCoord3fv_profiling(const GLfloat* v)const{auto const profilingStart=this->profiler.begin(1597);(this->*((FunctionTable::MEMBERPFNGLTEXCOORD3FVPROC)this->m_profiledFunctions[1597]))(v);this->profiler.end(1597,profilingStart);}
+void m_glMatrixTranslatefEXT_profiling(GLenum mode,GLfloat x,GLfloat y,GLfloat z)const{auto const profilingStart=this->profiler.begin(1598);(this->*((FunctionTable::MEMBERPFNGLMATRIXTRANSLATEFEXTPROC)this->m_profiledFunctions[1598]))(mode,x,y,z);this->profiler.end(1598,profilingStart);}
+void m_glProgramUniform1ui64vNV_profiling(GLuint program,GLint location,GLsizei count,const GLuint64EXT* value)const{auto const profilingStart=this->profiler.begin(1599);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UI64VNVPROC)this->m_profiledFunctions[1599]))(program,location,count,value);this->profiler.end(1599,profilingStart);}
+void m_glTextureMaterialEXT_profiling(GLenum face,GLenum mode)const{auto const profilingStart=this->profiler.begin(1600);(this->*((FunctionTable::MEMBERPFNGLTEXTUREMATERIALEXTPROC)this->m_profiledFunctions[1600]))(face,mode);this->profiler.end(1600,profilingStart);}
+void m_glMultiTexCoordP3uiv_profiling(GLenum texture,GLenum type,const GLuint* coords)const{auto const profilingStart=this->profiler.begin(1601);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORDP3UIVPROC)this->m_profiledFunctions[1601]))(texture,type,coords);this->profiler.end(1601,profilingStart);}
+void m_glVertexAttribP3ui_profiling(GLuint index,GLenum type,GLboolean normalized,GLuint value)const{auto const profilingStart=this->profiler.begin(1602);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBP3UIPROC)this->m_profiledFunctions[1602]))(index,type,normalized,value);this->profiler.end(1602,profilingStart);}
+void m_glInterpolatePathsNV_profiling(GLuint resultPath,GLuint pathA,GLuint pathB,GLfloat weight)const{auto const profilingStart=this->profiler.begin(1603);(this->*((FunctionTable::MEMBERPFNGLINTERPOLATEPATHSNVPROC)this->m_profiledFunctions[1603]))(resultPath,pathA,pathB,weight);this->profiler.end(1603,profilingStart);}
+void m_glTextureBufferRange_profiling(GLuint texture,GLenum internalformat,GLuint buffer,GLintptr offset,GLsizeiptr size)const{auto const profilingStart=this->profiler.begin(1604);(this->*((FunctionTable::MEMBERPFNGLTEXTUREBUFFERRANGEPROC)this->m_profiledFunctions[1604]))(texture,internalformat,buffer,offset,size);this->profiler.end(1604,profilingStart);}
+void m_glVertexAttribL2dEXT_profiling(GLuint index,GLdouble x,GLdouble y)const{auto const profilingStart=this->profiler.begin(1605);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBL2DEXTPROC)this->m_profiledFunctions[1605]))(index,x,y);this->profiler.end(1605,profilingStart);}
+void m_glGetPixelTransformParameterivEXT_profiling(GLenum target,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(1606);(this->*((FunctionTable::MEMBERPFNGLGETPIXELTRANSFORMPARAMETERIVEXTPROC)this->m_profiledFunctions[1606]))(target,pname,params);this->profiler.end(1606,profilingStart);}
+void m_glTexCoord4xvOES_profiling(const GLfixed* coords)const{auto const profilingStart=this->profiler.begin(1607);(this->*((FunctionTable::MEMBERPFNGLTEXCOORD4XVOESPROC)this->m_profiledFunctions[1607]))(coords);this->profiler.end(1607,profilingStart);}
+void m_glGetVariantBooleanvEXT_profiling(GLuint id,GLenum value,GLboolean* data)const{auto const profilingStart=this->profiler.begin(1608);(this->*((FunctionTable::MEMBERPFNGLGETVARIANTBOOLEANVEXTPROC)this->m_profiledFunctions[1608]))(id,value,data);this->profiler.end(1608,profilingStart);}
+void m_glDepthRange_profiling(GLclampd near_val,GLclampd far_val)const{auto const profilingStart=this->profiler.begin(1609);(this->*((FunctionTable::MEMBERPFNGLDEPTHRANGEPROC)this->m_profiledFunctions[1609]))(near_val,far_val);this->profiler.end(1609,profilingStart);}
+void m_glGetVertexAttribdvARB_profiling(GLuint index,GLenum pname,GLdouble* params)const{auto const profilingStart=this->profiler.begin(1610);(this->*((FunctionTable::MEMBERPFNGLGETVERTEXATTRIBDVARBPROC)this->m_profiledFunctions[1610]))(index,pname,params);this->profiler.end(1610,profilingStart);}
+void m_glGetColorTableParameterfv_profiling(GLenum target,GLenum pname,GLfloat* params)const{auto const profilingStart=this->profiler.begin(1611);(this->*((FunctionTable::MEMBERPFNGLGETCOLORTABLEPARAMETERFVPROC)this->m_profiledFunctions[1611]))(target,pname,params);this->profiler.end(1611,profilingStart);}
+void m_glDrawArraysInstancedEXT_profiling(GLenum mode,GLint start,GLsizei count,GLsizei primcount)const{auto const profilingStart=this->profiler.begin(1612);(this->*((FunctionTable::MEMBERPFNGLDRAWARRAYSINSTANCEDEXTPROC)this->m_profiledFunctions[1612]))(mode,start,count,primcount);this->profiler.end(1612,profilingStart);}
+void m_glDisableClientStateIndexedEXT_profiling(GLenum array,GLuint index)const{auto const profilingStart=this->profiler.begin(1613);(this->*((FunctionTable::MEMBERPFNGLDISABLECLIENTSTATEINDEXEDEXTPROC)this->m_profiledFunctions[1613]))(array,index);this->profiler.end(1613,profilingStart);}
+void m_glDrawBuffer_profiling(GLenum mode)const{auto const profilingStart=this->profiler.begin(1614);(this->*((FunctionTable::MEMBERPFNGLDRAWBUFFERPROC)this->m_profiledFunctions[1614]))(mode);this->profiler.end(1614,profilingStart);}
+void m_glMultiDrawArraysIndirectBindlessNV_profiling(GLenum mode,const void* indirect,GLsizei drawCount,GLsizei stride,GLint vertexBufferCount)const{auto const profilingStart=this->profiler.begin(1615);(this->*((FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSINDIRECTBINDLESSNVPROC)this->m_profiledFunctions[1615]))(mode,indirect,drawCount,stride,vertexBufferCount);this->profiler.end(1615,profilingStart);}
+void m_glGetnPixelMapusv_profiling(GLenum map,GLsizei bufSize,GLushort* values)const{auto const profilingStart=this->profiler.begin(1616);(this->*((FunctionTable::MEMBERPFNGLGETNPIXELMAPUSVPROC)this->m_profiledFunctions[1616]))(map,bufSize,values);this->profiler.end(1616,profilingStart);}
+void m_glRasterPos3fv_profiling(const GLfloat* v)const{auto const profilingStart=this->profiler.begin(1617);(this->*((FunctionTable::MEMBERPFNGLRASTERPOS3FVPROC)this->m_profiledFunctions[1617]))(v);this->profiler.end(1617,profilingStart);}
+void m_glClearBufferuiv_profiling(GLenum buffer,GLint drawbuffer,const GLuint* value)const{auto const profilingStart=this->profiler.begin(1618);(this->*((FunctionTable::MEMBERPFNGLCLEARBUFFERUIVPROC)this->m_profiledFunctions[1618]))(buffer,drawbuffer,value);this->profiler.end(1618,profilingStart);}
+void m_glGetInternalformati64v_profiling(GLenum target,GLenum internalformat,GLenum pname,GLsizei bufSize,GLint64* params)const{auto const profilingStart=this->profiler.begin(1619);(this->*((FunctionTable::MEMBERPFNGLGETINTERNALFORMATI64VPROC)this->m_profiledFunctions[1619]))(target,internalformat,pname,bufSize,params);this->profiler.end(1619,profilingStart);}
+void m_glShaderSourceARB_profiling(GLhandleARB shaderObj,GLsizei count,const GLcharARB** string,const GLint* length)const{auto const profilingStart=this->profiler.begin(1620);(this->*((FunctionTable::MEMBERPFNGLSHADERSOURCEARBPROC)this->m_profiledFunctions[1620]))(shaderObj,count,string,length);this->profiler.end(1620,profilingStart);}
+void m_glShaderOp3EXT_profiling(GLenum op,GLuint res,GLuint arg1,GLuint arg2,GLuint arg3)const{auto const profilingStart=this->profiler.begin(1621);(this->*((FunctionTable::MEMBERPFNGLSHADEROP3EXTPROC)this->m_profiledFunctions[1621]))(op,res,arg1,arg2,arg3);this->profiler.end(1621,profilingStart);}
+void m_glWindowPos2dvMESA_profiling(const GLdouble* v)const{auto const profilingStart=this->profiler.begin(1622);(this->*((FunctionTable::MEMBERPFNGLWINDOWPOS2DVMESAPROC)this->m_profiledFunctions[1622]))(v);this->profiler.end(1622,profilingStart);}
+void m_glClearIndex_profiling(GLfloat c)const{auto const profilingStart=this->profiler.begin(1623);(this->*((FunctionTable::MEMBERPFNGLCLEARINDEXPROC)this->m_profiledFunctions[1623]))(c);this->profiler.end(1623,profilingStart);}
+void m_glProvokingVertexEXT_profiling(GLenum mode)const{auto const profilingStart=this->profiler.begin(1624);(this->*((FunctionTable::MEMBERPFNGLPROVOKINGVERTEXEXTPROC)this->m_profiledFunctions[1624]))(mode);this->profiler.end(1624,profilingStart);}
+void m_glVariantubvEXT_profiling(GLuint id,const GLubyte* addr)const{auto const profilingStart=this->profiler.begin(1625);(this->*((FunctionTable::MEMBERPFNGLVARIANTUBVEXTPROC)this->m_profiledFunctions[1625]))(id,addr);this->profiler.end(1625,profilingStart);}
+void m_glFlush_profiling()const{auto const profilingStart=this->profiler.begin(1626);(this->*((FunctionTable::MEMBERPFNGLFLUSHPROC)this->m_profiledFunctions[1626]))();this->profiler.end(1626,profilingStart);}
+void m_glGetColorTableParameterivEXT_profiling(GLenum target,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(1627);(this->*((FunctionTable::MEMBERPFNGLGETCOLORTABLEPARAMETERIVEXTPROC)this->m_profiledFunctions[1627]))(target,pname,params);this->profiler.end(1627,profilingStart);}
+void m_glPresentFrameDualFillNV_profiling(GLuint video_slot,GLuint64EXT minPresentTime,GLuint beginPresentTimeId,GLuint presentDurationId,GLenum type,GLenum target0,GLuint fill0,GLenum target1,GLuint fill1,GLenum target2,GLuint fill2,GLenum target3,GLuint fill3)const{auto const profilingStart=this->profiler.begin(1628);(this->*((FunctionTable::MEMBERPFNGLPRESENTFRAMEDUALFILLNVPROC)this->m_profiledFunctions[1628]))(video_slot,minPresentTime,beginPresentTimeId,presentDurationId,type,target0,fill0,target1,fill1,target2,fill2,target3,fill3);this->profiler.end(1628,profilingStart);}
+GLuint m_glGenVertexShadersEXT_profiling(GLuint range)const{auto const profilingStart=this->profiler.begin(1629);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLGENVERTEXSHADERSEXTPROC)this->m_profiledFunctions[1629]))(range);this->profiler.end(1629,profilingStart);return profilingResult;}
+void m_glProgramUniformHandleui64vARB_profiling(GLuint program,GLint location,GLsizei count,const GLuint64* values)const{auto const profilingStart=this->profiler.begin(1630);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORMHANDLEUI64VARBPROC)this->m_profiledFunctions[1630]))(program,location,count,values);this->profiler.end(1630,profilingStart);}
+void m_glDepthRangefOES_profiling(GLclampf n,GLclampf f)const{auto const profilingStart=this->profiler.begin(1631);(this->*((FunctionTable::MEMBERPFNGLDEPTHRANGEFOESPROC)this->m_profiledFunctions[1631]))(n,f);this->profiler.end(1631,profilingStart);}
+void m_glDrawElementsInstancedBaseVertexBaseInstance_profiling(GLenum mode,GLsizei count,GLenum type,const void* indices,GLsizei instancecount,GLint basevertex,GLuint baseinstance)const{auto const profilingStart=this->profiler.begin(1632);(this->*((FunctionTable::MEMBERPFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC)this->m_profiledFunctions[1632]))(mode,count,type,indices,instancecount,basevertex,baseinstance);this->profiler.end(1632,profilingStart);}
+void m_glGetTexLevelParameteriv_profiling(GLenum target,GLint level,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(1633);(this->*((FunctionTable::MEMBERPFNGLGETTEXLEVELPARAMETERIVPROC)this->m_profiledFunctions[1633]))(target,level,pname,params);this->profiler.end(1633,profilingStart);}
+void m_glStencilFillPathNV_profiling(GLuint path,GLenum fillMode,GLuint mask)const{auto const profilingStart=this->profiler.begin(1634);(this->*((FunctionTable::MEMBERPFNGLSTENCILFILLPATHNVPROC)this->m_profiledFunctions[1634]))(path,fillMode,mask);this->profiler.end(1634,profilingStart);}
+void m_glWindowPos3iARB_profiling(GLint x,GLint y,GLint z)const{auto const profilingStart=this->profiler.begin(1635);(this->*((FunctionTable::MEMBERPFNGLWINDOWPOS3IARBPROC)this->m_profiledFunctions[1635]))(x,y,z);this->profiler.end(1635,profilingStart);}
+void m_glPrioritizeTextures_profiling(GLsizei n,const GLuint* textures,const GLclampf* priorities)const{auto const profilingStart=this->profiler.begin(1636);(this->*((FunctionTable::MEMBERPFNGLPRIORITIZETEXTURESPROC)this->m_profiledFunctions[1636]))(n,textures,priorities);this->profiler.end(1636,profilingStart);}
+void m_glWindowPos3fvMESA_profiling(const GLfloat* v)const{auto const profilingStart=this->profiler.begin(1637);(this->*((FunctionTable::MEMBERPFNGLWINDOWPOS3FVMESAPROC)this->m_profiledFunctions[1637]))(v);this->profiler.end(1637,profilingStart);}
+void m_glProgramUniformMatrix3x2dvEXT_profiling(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{auto const profilingStart=this->profiler.begin(1638);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X2DVEXTPROC)this->m_profiledFunctions[1638]))(program,location,count,transpose,value);this->profiler.end(1638,profilingStart);}
+void m_glVertex4xvOES_profiling(const GLfixed* coords)const{auto const profilingStart=this->profiler.begin(1639);(this->*((FunctionTable::MEMBERPFNGLVERTEX4XVOESPROC)this->m_profiledFunctions[1639]))(coords);this->profiler.end(1639,profilingStart);}
+void m_glTexStorage3DMultisample_profiling(GLenum target,GLsizei samples,GLenum internalformat,GLsizei width,GLsizei height,GLsizei depth,GLboolean fixedsamplelocations)const{auto const profilingStart=this->profiler.begin(1640);(this->*((FunctionTable::MEMBERPFNGLTEXSTORAGE3DMULTISAMPLEPROC)this->m_profiledFunctions[1640]))(target,samples,internalformat,width,height,depth,fixedsamplelocations);this->profiler.end(1640,profilingStart);}
+void m_glWindowPos2sARB_profiling(GLshort x,GLshort y)const{auto const profilingStart=this->profiler.begin(1641);(this->*((FunctionTable::MEMBERPFNGLWINDOWPOS2SARBPROC)this->m_profiledFunctions[1641]))(x,y);this->profiler.end(1641,profilingStart);}
+void m_glStencilOpValueAMD_profiling(GLenum face,GLuint value)const{auto const profilingStart=this->profiler.begin(1642);(this->*((FunctionTable::MEMBERPFNGLSTENCILOPVALUEAMDPROC)this->m_profiledFunctions[1642]))(face,value);this->profiler.end(1642,profilingStart);}
+void m_glProgramVertexLimitNV_profiling(GLenum target,GLint limit)const{auto const profilingStart=this->profiler.begin(1643);(this->*((FunctionTable::MEMBERPFNGLPROGRAMVERTEXLIMITNVPROC)this->m_profiledFunctions[1643]))(target,limit);this->profiler.end(1643,profilingStart);}
+void m_glGetTexParameterPointervAPPLE_profiling(GLenum target,GLenum pname,void** params)const{auto const profilingStart=this->profiler.begin(1644);(this->*((FunctionTable::MEMBERPFNGLGETTEXPARAMETERPOINTERVAPPLEPROC)this->m_profiledFunctions[1644]))(target,pname,params);this->profiler.end(1644,profilingStart);}
+void m_glProgramUniform3uivEXT_profiling(GLuint program,GLint location,GLsizei count,const GLuint* value)const{auto const profilingStart=this->profiler.begin(1645);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UIVEXTPROC)this->m_profiledFunctions[1645]))(program,location,count,value);this->profiler.end(1645,profilingStart);}
+void m_glClampColor_profiling(GLenum target,GLenum clamp)const{auto const profilingStart=this->profiler.begin(1646);(this->*((FunctionTable::MEMBERPFNGLCLAMPCOLORPROC)this->m_profiledFunctions[1646]))(target,clamp);this->profiler.end(1646,profilingStart);}
+void m_glClearStencil_profiling(GLint s)const{auto const profilingStart=this->profiler.begin(1647);(this->*((FunctionTable::MEMBERPFNGLCLEARSTENCILPROC)this->m_profiledFunctions[1647]))(s);this->profiler.end(1647,profilingStart);}
+void m_glTexCoordP1uiv_profiling(GLenum type,const GLuint* coords)const{auto const profilingStart=this->profiler.begin(1648);(this->*((FunctionTable::MEMBERPFNGLTEXCOORDP1UIVPROC)this->m_profiledFunctions[1648]))(type,coords);this->profiler.end(1648,profilingStart);}
+void m_glVertexAttribs3svNV_profiling(GLuint index,GLsizei count,const GLshort* v)const{auto const profilingStart=this->profiler.begin(1649);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBS3SVNVPROC)this->m_profiledFunctions[1649]))(index,count,v);this->profiler.end(1649,profilingStart);}
+void m_glMultiTexCoord3fv_profiling(GLenum target,const GLfloat* v)const{auto const profilingStart=this->profiler.begin(1650);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD3FVPROC)this->m_profiledFunctions[1650]))(target,v);this->profiler.end(1650,profilingStart);}
+void m_glVertexBlendEnvfATI_profiling(GLenum pname,GLfloat param)const{auto const profilingStart=this->profiler.begin(1651);(this->*((FunctionTable::MEMBERPFNGLVERTEXBLENDENVFATIPROC)this->m_profiledFunctions[1651]))(pname,param);this->profiler.end(1651,profilingStart);}
+GLboolean m_glIsFenceAPPLE_profiling(GLuint fence)const{auto const profilingStart=this->profiler.begin(1652);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLISFENCEAPPLEPROC)this->m_profiledFunctions[1652]))(fence);this->profiler.end(1652,profilingStart);return profilingResult;}
+void m_glGetBufferParameterui64vNV_profiling(GLenum target,GLenum pname,GLuint64EXT* params)const{auto const profilingStart=this->profiler.begin(1653);(this->*((FunctionTable::MEMBERPFNGLGETBUFFERPARAMETERUI64VNVPROC)this->m_profiledFunctions[1653]))(target,pname,params);this->profiler.end(1653,profilingStart);}
+void m_glVertexAttribI4bvEXT_profiling(GLuint index,const GLbyte* v)const{auto const profilingStart=this->profiler.begin(1654);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBI4BVEXTPROC)this->m_profiledFunctions[1654]))(index,v);this->profiler.end(1654,profilingStart);}
+void m_glUniform2fARB_profiling(GLint location,GLfloat v0,GLfloat v1)const{auto const profilingStart=this->profiler.begin(1655);(this->*((FunctionTable::MEMBERPFNGLUNIFORM2FARBPROC)this->m_profiledFunctions[1655]))(location,v0,v1);this->profiler.end(1655,profilingStart);}
+void m_glStopInstrumentsSGIX_profiling(GLint marker)const{auto const profilingStart=this->profiler.begin(1656);(this->*((FunctionTable::MEMBERPFNGLSTOPINSTRUMENTSSGIXPROC)this->m_profiledFunctions[1656]))(marker);this->profiler.end(1656,profilingStart);}
+void m_glVertexAttrib3fNV_profiling(GLuint index,GLfloat x,GLfloat y,GLfloat z)const{auto const profilingStart=this->profiler.begin(1657);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB3FNVPROC)this->m_profiledFunctions[1657]))(index,x,y,z);this->profiler.end(1657,profilingStart);}
+void m_glMapVertexAttrib2dAPPLE_profiling(GLuint index,GLuint size,GLdouble u1,GLdouble u2,GLint ustride,GLint uorder,GLdouble v1,GLdouble v2,GLint vstride,GLint vorder,const GLdouble* points)const{auto const profilingStart=this->profiler.begin(1658);(this->*((FunctionTable::MEMBERPFNGLMAPVERTEXATTRIB2DAPPLEPROC)this->m_profiledFunctions[1658]))(index,size,u1,u2,ustride,uorder,v1,v2,vstride,vorder,points);this->profiler.end(1658,profilingStart);}
+void m_glVertex2f_profiling(GLfloat x,GLfloat y)const{auto const profilingStart=this->profiler.begin(1659);(this->*((FunctionTable::MEMBERPFNGLVERTEX2FPROC)this->m_profiledFunctions[1659]))(x,y);this->profiler.end(1659,profilingStart);}
+void m_glCopyTextureImage2DEXT_profiling(GLuint texture,GLenum target,GLint level,GLenum internalformat,GLint x,GLint y,GLsizei width,GLsizei height,GLint border)const{auto const profilingStart=this->profiler.begin(1660);(this->*((FunctionTable::MEMBERPFNGLCOPYTEXTUREIMAGE2DEXTPROC)this->m_profiledFunctions[1660]))(texture,target,level,internalformat,x,y,width,height,border);this->profiler.end(1660,profilingStart);}
+void m_glVertex2d_profiling(GLdouble x,GLdouble y)const{auto const profilingStart=this->profiler.begin(1661);(this->*((FunctionTable::MEMBERPFNGLVERTEX2DPROC)this->m_profiledFunctions[1661]))(x,y);this->profiler.end(1661,profilingStart);}
+void m_glSecondaryColor3bvEXT_profiling(const GLbyte* v)const{auto const profilingStart=this->profiler.begin(1662);(this->*((FunctionTable::MEMBERPFNGLSECONDARYCOLOR3BVEXTPROC)this->m_profiledFunctions[1662]))(v);this->profiler.end(1662,profilingStart);}
+void m_glMultiTexCoord4fARB_profiling(GLenum target,GLfloat s,GLfloat t,GLfloat r,GLfloat q)const{auto const profilingStart=this->profiler.begin(1663);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD4FARBPROC)this->m_profiledFunctions[1663]))(target,s,t,r,q);this->profiler.end(1663,profilingStart);}
+void m_glPolygonOffset_profiling(GLfloat factor,GLfloat units)const{auto const profilingStart=this->profiler.begin(1664);(this->*((FunctionTable::MEMBERPFNGLPOLYGONOFFSETPROC)this->m_profiledFunctions[1664]))(factor,units);this->profiler.end(1664,profilingStart);}
+void m_glTangent3bvEXT_profiling(const GLbyte* v)const{auto const profilingStart=this->profiler.begin(1665);(this->*((FunctionTable::MEMBERPFNGLTANGENT3BVEXTPROC)this->m_profiledFunctions[1665]))(v);this->profiler.end(1665,profilingStart);}
+void m_glHistogram_profiling(GLenum target,GLsizei width,GLenum internalformat,GLboolean sink)const{auto const profilingStart=this->profiler.begin(1666);(this->*((FunctionTable::MEMBERPFNGLHISTOGRAMPROC)this->m_profiledFunctions[1666]))(target,width,internalformat,sink);this->profiler.end(1666,profilingStart);}
+void m_glGetProgramiv_profiling(GLuint program,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(1667);(this->*((FunctionTable::MEMBERPFNGLGETPROGRAMIVPROC)this->m_profiledFunctions[1667]))(program,pname,params);this->profiler.end(1667,profilingStart);}
+void m_glMatrixIndexubvARB_profiling(GLint size,const GLubyte* indices)const{auto const profilingStart=this->profiler.begin(1668);(this->*((FunctionTable::MEMBERPFNGLMATRIXINDEXUBVARBPROC)this->m_profiledFunctions[1668]))(size,indices);this->profiler.end(1668,profilingStart);}
+void m_glVertex2s_profiling(GLshort x,GLshort y)const{auto const profilingStart=this->profiler.begin(1669);(this->*((FunctionTable::MEMBERPFNGLVERTEX2SPROC)this->m_profiledFunctions[1669]))(x,y);this->profiler.end(1669,profilingStart);}
+void m_glGetVertexAttribLui64vNV_profiling(GLuint index,GLenum pname,GLuint64EXT* params)const{auto const profilingStart=this->profiler.begin(1670);(this->*((FunctionTable::MEMBERPFNGLGETVERTEXATTRIBLUI64VNVPROC)this->m_profiledFunctions[1670]))(index,pname,params);this->profiler.end(1670,profilingStart);}
+void m_glGetProgramStringARB_profiling(GLenum target,GLenum pname,void* string)const{auto const profilingStart=this->profiler.begin(1671);(this->*((FunctionTable::MEMBERPFNGLGETPROGRAMSTRINGARBPROC)this->m_profiledFunctions[1671]))(target,pname,string);this->profiler.end(1671,profilingStart);}
+void m_glFlushMappedBufferRange_profiling(GLenum target,GLintptr offset,GLsizeiptr length)const{auto const profilingStart=this->profiler.begin(1672);(this->*((FunctionTable::MEMBERPFNGLFLUSHMAPPEDBUFFERRANGEPROC)this->m_profiledFunctions[1672]))(target,offset,length);this->profiler.end(1672,profilingStart);}
+void m_glVertexAttribI3uiEXT_profiling(GLuint index,GLuint x,GLuint y,GLuint z)const{auto const profilingStart=this->profiler.begin(1673);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBI3UIEXTPROC)this->m_profiledFunctions[1673]))(index,x,y,z);this->profiler.end(1673,profilingStart);}
+void m_glLineWidthxOES_profiling(GLfixed width)const{auto const profilingStart=this->profiler.begin(1674);(this->*((FunctionTable::MEMBERPFNGLLINEWIDTHXOESPROC)this->m_profiledFunctions[1674]))(width);this->profiler.end(1674,profilingStart);}
+void m_glProgramUniformMatrix2fvEXT_profiling(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{auto const profilingStart=this->profiler.begin(1675);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2FVEXTPROC)this->m_profiledFunctions[1675]))(program,location,count,transpose,value);this->profiler.end(1675,profilingStart);}
+void m_glGetTextureParameterIuivEXT_profiling(GLuint texture,GLenum target,GLenum pname,GLuint* params)const{auto const profilingStart=this->profiler.begin(1676);(this->*((FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERIUIVEXTPROC)this->m_profiledFunctions[1676]))(texture,target,pname,params);this->profiler.end(1676,profilingStart);}
+void m_glGetMultiTexEnvivEXT_profiling(GLenum texunit,GLenum target,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(1677);(this->*((FunctionTable::MEMBERPFNGLGETMULTITEXENVIVEXTPROC)this->m_profiledFunctions[1677]))(texunit,target,pname,params);this->profiler.end(1677,profilingStart);}
+void m_glPixelTexGenParameterivSGIS_profiling(GLenum pname,const GLint* params)const{auto const profilingStart=this->profiler.begin(1678);(this->*((FunctionTable::MEMBERPFNGLPIXELTEXGENPARAMETERIVSGISPROC)this->m_profiledFunctions[1678]))(pname,params);this->profiler.end(1678,profilingStart);}
+void m_glGenQueries_profiling(GLsizei n,GLuint* ids)const{auto const profilingStart=this->profiler.begin(1679);(this->*((FunctionTable::MEMBERPFNGLGENQUERIESPROC)this->m_profiledFunctions[1679]))(n,ids);this->profiler.end(1679,profilingStart);}
+void m_glGetPixelMapfv_profiling(GLenum map,GLfloat* values)const{auto const profilingStart=this->profiler.begin(1680);(this->*((FunctionTable::MEMBERPFNGLGETPIXELMAPFVPROC)this->m_profiledFunctions[1680]))(map,values);this->profiler.end(1680,profilingStart);}
+void m_glBlendColorEXT_profiling(GLfloat red,GLfloat green,GLfloat blue,GLfloat alpha)const{auto const profilingStart=this->profiler.begin(1681);(this->*((FunctionTable::MEMBERPFNGLBLENDCOLOREXTPROC)this->m_profiledFunctions[1681]))(red,green,blue,alpha);this->profiler.end(1681,profilingStart);}
+void m_glResetMinmax_profiling(GLenum target)const{auto const profilingStart=this->profiler.begin(1682);(this->*((FunctionTable::MEMBERPFNGLRESETMINMAXPROC)this->m_profiledFunctions[1682]))(target);this->profiler.end(1682,profilingStart);}
+void m_glGetnUniformivARB_profiling(GLuint program,GLint location,GLsizei bufSize,GLint* params)const{auto const profilingStart=this->profiler.begin(1683);(this->*((FunctionTable::MEMBERPFNGLGETNUNIFORMIVARBPROC)this->m_profiledFunctions[1683]))(program,location,bufSize,params);this->profiler.end(1683,profilingStart);}
+void m_glVertexBlendARB_profiling(GLint count)const{auto const profilingStart=this->profiler.begin(1684);(this->*((FunctionTable::MEMBERPFNGLVERTEXBLENDARBPROC)this->m_profiledFunctions[1684]))(count);this->profiler.end(1684,profilingStart);}
+void m_glVertexAttrib4d_profiling(GLuint index,GLdouble x,GLdouble y,GLdouble z,GLdouble w)const{auto const profilingStart=this->profiler.begin(1685);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB4DPROC)this->m_profiledFunctions[1685]))(index,x,y,z,w);this->profiler.end(1685,profilingStart);}
+GLint m_glGetVaryingLocationNV_profiling(GLuint program,const GLchar* name)const{auto const profilingStart=this->profiler.begin(1686);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLGETVARYINGLOCATIONNVPROC)this->m_profiledFunctions[1686]))(program,name);this->profiler.end(1686,profilingStart);return profilingResult;}
+void m_glGetMapAttribParameterivNV_profiling(GLenum target,GLuint index,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(1687);(this->*((FunctionTable::MEMBERPFNGLGETMAPATTRIBPARAMETERIVNVPROC)this->m_profiledFunctions[1687]))(target,index,pname,params);this->profiler.end(1687,profilingStart);}
+void m_glTexSubImage3D_profiling(GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLenum format,GLenum type,const GLvoid* pixels)const{auto const profilingStart=this->profiler.begin(1688);(this->*((FunctionTable::MEMBERPFNGLTEXSUBIMAGE3DPROC)this->m_profiledFunctions[1688]))(target,level,xoffset,yoffset,zoffset,width,height,depth,format,type,pixels);this->profiler.end(1688,profilingStart);}
+void m_glDeleteSamplers_profiling(GLsizei count,const GLuint* samplers)const{auto const profilingStart=this->profiler.begin(1689);(this->*((FunctionTable::MEMBERPFNGLDELETESAMPLERSPROC)this->m_profiledFunctions[1689]))(count,samplers);this->profiler.end(1689,profilingStart);}
+void m_glGetLightxOES_profiling(GLenum light,GLenum pname,GLfixed* params)const{auto const profilingStart=this->profiler.begin(1690);(this->*((FunctionTable::MEMBERPFNGLGETLIGHTXOESPROC)this->m_profiledFunctions[1690]))(light,pname,params);this->profiler.end(1690,profilingStart);}
+void m_glGetVertexAttribArrayObjectfvATI_profiling(GLuint index,GLenum pname,GLfloat* params)const{auto const profilingStart=this->profiler.begin(1691);(this->*((FunctionTable::MEMBERPFNGLGETVERTEXATTRIBARRAYOBJECTFVATIPROC)this->m_profiledFunctions[1691]))(index,pname,params);this->profiler.end(1691,profilingStart);}
+void m_glVertexArrayNormalOffsetEXT_profiling(GLuint vaobj,GLuint buffer,GLenum type,GLsizei stride,GLintptr offset)const{auto const profilingStart=this->profiler.begin(1692);(this->*((FunctionTable::MEMBERPFNGLVERTEXARRAYNORMALOFFSETEXTPROC)this->m_profiledFunctions[1692]))(vaobj,buffer,type,stride,offset);this->profiler.end(1692,profilingStart);}
+void m_glGetBufferParameterivARB_profiling(GLenum target,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(1693);(this->*((FunctionTable::MEMBERPFNGLGETBUFFERPARAMETERIVARBPROC)this->m_profiledFunctions[1693]))(target,pname,params);this->profiler.end(1693,profilingStart);}
+void m_glGetTextureParameterfv_profiling(GLuint texture,GLenum pname,GLfloat* params)const{auto const profilingStart=this->profiler.begin(1694);(this->*((FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERFVPROC)this->m_profiledFunctions[1694]))(texture,pname,params);this->profiler.end(1694,profilingStart);}
+void m_glDrawMeshArraysSUN_profiling(GLenum mode,GLint first,GLsizei count,GLsizei width)const{auto const profilingStart=this->profiler.begin(1695);(this->*((FunctionTable::MEMBERPFNGLDRAWMESHARRAYSSUNPROC)this->m_profiledFunctions[1695]))(mode,first,count,width);this->profiler.end(1695,profilingStart);}
+void m_glVertexAttrib4dNV_profiling(GLuint index,GLdouble x,GLdouble y,GLdouble z,GLdouble w)const{auto const profilingStart=this->profiler.begin(1696);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB4DNVPROC)this->m_profiledFunctions[1696]))(index,x,y,z,w);this->profiler.end(1696,profilingStart);}
+void m_glGetMultisamplefvNV_profiling(GLenum pname,GLuint index,GLfloat* val)const{auto const profilingStart=this->profiler.begin(1697);(this->*((FunctionTable::MEMBERPFNGLGETMULTISAMPLEFVNVPROC)this->m_profiledFunctions[1697]))(pname,index,val);this->profiler.end(1697,profilingStart);}
+void* m_glMapObjectBufferATI_profiling(GLuint buffer)const{auto const profilingStart=this->profiler.begin(1698);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLMAPOBJECTBUFFERATIPROC)this->m_profiledFunctions[1698]))(buffer);this->profiler.end(1698,profilingStart);return profilingResult;}
+void m_glGetPathCommandsNV_profiling(GLuint path,GLubyte* commands)const{auto const profilingStart=this->profiler.begin(1699);(this->*((FunctionTable::MEMBERPFNGLGETPATHCOMMANDSNVPROC)this->m_profiledFunctions[1699]))(path,commands);this->profiler.end(1699,profilingStart);}
+void m_glVertexArrayTexCoordOffsetEXT_profiling(GLuint vaobj,GLuint buffer,GLint size,GLenum type,GLsizei stride,GLintptr offset)const{auto const profilingStart=this->profiler.begin(1700);(this->*((FunctionTable::MEMBERPFNGLVERTEXARRAYTEXCOORDOFFSETEXTPROC)this->m_profiledFunctions[1700]))(vaobj,buffer,size,type,stride,offset);this->profiler.end(1700,profilingStart);}
+void m_glGetHistogram_profiling(GLenum target,GLboolean reset,GLenum format,GLenum type,GLvoid* values)const{auto const profilingStart=this->profiler.begin(1701);(this->*((FunctionTable::MEMBERPFNGLGETHISTOGRAMPROC)this->m_profiledFunctions[1701]))(target,reset,format,type,values);this->profiler.end(1701,profilingStart);}
+void m_glMatrixMode_profiling(GLenum mode)const{auto const profilingStart=this->profiler.begin(1702);(this->*((FunctionTable::MEMBERPFNGLMATRIXMODEPROC)this->m_profiledFunctions[1702]))(mode);this->profiler.end(1702,profilingStart);}
+void m_glColorFormatNV_profiling(GLint size,GLenum type,GLsizei stride)const{auto const profilingStart=this->profiler.begin(1703);(this->*((FunctionTable::MEMBERPFNGLCOLORFORMATNVPROC)this->m_profiledFunctions[1703]))(size,type,stride);this->profiler.end(1703,profilingStart);}
+void m_glProgramUniformui64NV_profiling(GLuint program,GLint location,GLuint64EXT value)const{auto const profilingStart=this->profiler.begin(1704);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORMUI64NVPROC)this->m_profiledFunctions[1704]))(program,location,value);this->profiler.end(1704,profilingStart);}
+void m_glProgramUniformMatrix4x2fvEXT_profiling(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{auto const profilingStart=this->profiler.begin(1705);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X2FVEXTPROC)this->m_profiledFunctions[1705]))(program,location,count,transpose,value);this->profiler.end(1705,profilingStart);}
+void m_glLoadMatrixxOES_profiling(const GLfixed* m)const{auto const profilingStart=this->profiler.begin(1706);(this->*((FunctionTable::MEMBERPFNGLLOADMATRIXXOESPROC)this->m_profiledFunctions[1706]))(m);this->profiler.end(1706,profilingStart);}
+void m_glGetColorTableParameterfvEXT_profiling(GLenum target,GLenum pname,GLfloat* params)const{auto const profilingStart=this->profiler.begin(1707);(this->*((FunctionTable::MEMBERPFNGLGETCOLORTABLEPARAMETERFVEXTPROC)this->m_profiledFunctions[1707]))(target,pname,params);this->profiler.end(1707,profilingStart);}
+void m_glRasterPos4i_profiling(GLint x,GLint y,GLint z,GLint w)const{auto const profilingStart=this->profiler.begin(1708);(this->*((FunctionTable::MEMBERPFNGLRASTERPOS4IPROC)this->m_profiledFunctions[1708]))(x,y,z,w);this->profiler.end(1708,profilingStart);}
+void m_glVertexAttribL2i64NV_profiling(GLuint index,GLint64EXT x,GLint64EXT y)const{auto const profilingStart=this->profiler.begin(1709);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBL2I64NVPROC)this->m_profiledFunctions[1709]))(index,x,y);this->profiler.end(1709,profilingStart);}
+void m_glBindTextures_profiling(GLuint first,GLsizei count,const GLuint* textures)const{auto const profilingStart=this->profiler.begin(1710);(this->*((FunctionTable::MEMBERPFNGLBINDTEXTURESPROC)this->m_profiledFunctions[1710]))(first,count,textures);this->profiler.end(1710,profilingStart);}
+void m_glMatrixRotatefEXT_profiling(GLenum mode,GLfloat angle,GLfloat x,GLfloat y,GLfloat z)const{auto const profilingStart=this->profiler.begin(1711);(this->*((FunctionTable::MEMBERPFNGLMATRIXROTATEFEXTPROC)this->m_profiledFunctions[1711]))(mode,angle,x,y,z);this->profiler.end(1711,profilingStart);}
+void m_glGetClipPlanexOES_profiling(GLenum plane,GLfixed* equation)const{auto const profilingStart=this->profiler.begin(1712);(this->*((FunctionTable::MEMBERPFNGLGETCLIPPLANEXOESPROC)this->m_profiledFunctions[1712]))(plane,equation);this->profiler.end(1712,profilingStart);}
+void m_glSecondaryColor3uivEXT_profiling(const GLuint* v)const{auto const profilingStart=this->profiler.begin(1713);(this->*((FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UIVEXTPROC)this->m_profiledFunctions[1713]))(v);this->profiler.end(1713,profilingStart);}
+void m_glGetPerfQueryInfoINTEL_profiling(GLuint queryId,GLuint queryNameLength,GLchar* queryName,GLuint* dataSize,GLuint* noCounters,GLuint* noInstances,GLuint* capsMask)const{auto const profilingStart=this->profiler.begin(1714);(this->*((FunctionTable::MEMBERPFNGLGETPERFQUERYINFOINTELPROC)this->m_profiledFunctions[1714]))(queryId,queryNameLength,queryName,dataSize,noCounters,noInstances,capsMask);this->profiler.end(1714,profilingStart);}
+void m_glGetDoublev_profiling(GLenum pname,GLdouble* params)const{auto const profilingStart=this->profiler.begin(1715);(this->*((FunctionTable::MEMBERPFNGLGETDOUBLEVPROC)this->m_profiledFunctions[1715]))(pname,params);this->profiler.end(1715,profilingStart);}
+void m_glBindBufferRangeEXT_profiling(GLenum target,GLuint index,GLuint buffer,GLintptr offset,GLsizeiptr size)const{auto const profilingStart=this->profiler.begin(1716);(this->*((FunctionTable::MEMBERPFNGLBINDBUFFERRANGEEXTPROC)this->m_profiledFunctions[1716]))(target,index,buffer,offset,size);this->profiler.end(1716,profilingStart);}
+void m_glCompressedTexImage2D_profiling(GLenum target,GLint level,GLenum internalformat,GLsizei width,GLsizei height,GLint border,GLsizei imageSize,const GLvoid* data)const{auto const profilingStart=this->profiler.begin(1717);(this->*((FunctionTable::MEMBERPFNGLCOMPRESSEDTEXIMAGE2DPROC)this->m_profiledFunctions[1717]))(target,level,internalformat,width,height,border,imageSize,data);this->profiler.end(1717,profilingStart);}
+void* m_glMapBufferARB_profiling(GLenum target,GLenum access)const{auto const profilingStart=this->profiler.begin(1718);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLMAPBUFFERARBPROC)this->m_profiledFunctions[1718]))(target,access);this->profiler.end(1718,profilingStart);return profilingResult;}
+void m_glGetPathSpacingNV_profiling(GLenum pathListMode,GLsizei numPaths,GLenum pathNameType,const void* paths,GLuint pathBase,GLfloat advanceScale,GLfloat kerningScale,GLenum transformType,GLfloat* returnedSpacing)const{auto const profilingStart=this->profiler.begin(1719);(this->*((FunctionTable::MEMBERPFNGLGETPATHSPACINGNVPROC)this->m_profiledFunctions[1719]))(pathListMode,numPaths,pathNameType,paths,pathBase,advanceScale,kerningScale,transformType,returnedSpacing);this->profiler.end(1719,profilingStart);}
+void m_glUniform4dv_profiling(GLint location,GLsizei count,const GLdouble* value)const{auto const profilingStart=this->profiler.begin(1720);(this->*((FunctionTable::MEMBERPFNGLUNIFORM4DVPROC)this->m_profiledFunctions[1720]))(location,count,value);this->profiler.end(1720,profilingStart);}
+void m_glGlobalAlphaFactordSUN_profiling(GLdouble factor)const{auto const profilingStart=this->profiler.begin(1721);(this->*((FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORDSUNPROC)this->m_profiledFunctions[1721]))(factor);this->profiler.end(1721,profilingStart);}
+void m_glProgramUniform3dv_profiling(GLuint program,GLint location,GLsizei count,const GLdouble* value)const{auto const profilingStart=this->profiler.begin(1722);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3DVPROC)this->m_profiledFunctions[1722]))(program,location,count,value);this->profiler.end(1722,profilingStart);}
+void m_glGetShaderSourceARB_profiling(GLhandleARB obj,GLsizei maxLength,GLsizei* length,GLcharARB* source)const{auto const profilingStart=this->profiler.begin(1723);(this->*((FunctionTable::MEMBERPFNGLGETSHADERSOURCEARBPROC)this->m_profiledFunctions[1723]))(obj,maxLength,length,source);this->profiler.end(1723,profilingStart);}
+void m_glVertexAttrib3dvARB_profiling(GLuint index,const GLdouble* v)const{auto const profilingStart=this->profiler.begin(1724);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB3DVARBPROC)this->m_profiledFunctions[1724]))(index,v);this->profiler.end(1724,profilingStart);}
+void m_glInvalidateBufferData_profiling(GLuint buffer)const{auto const profilingStart=this->profiler.begin(1725);(this->*((FunctionTable::MEMBERPFNGLINVALIDATEBUFFERDATAPROC)this->m_profiledFunctions[1725]))(buffer);this->profiler.end(1725,profilingStart);}
+void m_glMatrixLoad3x2fNV_profiling(GLenum matrixMode,const GLfloat* m)const{auto const profilingStart=this->profiler.begin(1726);(this->*((FunctionTable::MEMBERPFNGLMATRIXLOAD3X2FNVPROC)this->m_profiledFunctions[1726]))(matrixMode,m);this->profiler.end(1726,profilingStart);}
+void m_glCompressedTextureSubImage1D_profiling(GLuint texture,GLint level,GLint xoffset,GLsizei width,GLenum format,GLsizei imageSize,const void* data)const{auto const profilingStart=this->profiler.begin(1727);(this->*((FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC)this->m_profiledFunctions[1727]))(texture,level,xoffset,width,format,imageSize,data);this->profiler.end(1727,profilingStart);}
+void m_glTexCoord3xvOES_profiling(const GLfixed* coords)const{auto const profilingStart=this->profiler.begin(1728);(this->*((FunctionTable::MEMBERPFNGLTEXCOORD3XVOESPROC)this->m_profiledFunctions[1728]))(coords);this->profiler.end(1728,profilingStart);}
+void m_glGenTexturesEXT_profiling(GLsizei n,GLuint* textures)const{auto const profilingStart=this->profiler.begin(1729);(this->*((FunctionTable::MEMBERPFNGLGENTEXTURESEXTPROC)this->m_profiledFunctions[1729]))(n,textures);this->profiler.end(1729,profilingStart);}
+void m_glTangent3iEXT_profiling(GLint tx,GLint ty,GLint tz)const{auto const profilingStart=this->profiler.begin(1730);(this->*((FunctionTable::MEMBERPFNGLTANGENT3IEXTPROC)this->m_profiledFunctions[1730]))(tx,ty,tz);this->profiler.end(1730,profilingStart);}
+void m_glClearTexImage_profiling(GLuint texture,GLint level,GLenum format,GLenum type,const void* data)const{auto const profilingStart=this->profiler.begin(1731);(this->*((FunctionTable::MEMBERPFNGLCLEARTEXIMAGEPROC)this->m_profiledFunctions[1731]))(texture,level,format,type,data);this->profiler.end(1731,profilingStart);}
+void m_glBinormal3bvEXT_profiling(const GLbyte* v)const{auto const profilingStart=this->profiler.begin(1732);(this->*((FunctionTable::MEMBERPFNGLBINORMAL3BVEXTPROC)this->m_profiledFunctions[1732]))(v);this->profiler.end(1732,profilingStart);}
+void m_glUniform3fv_profiling(GLint location,GLsizei count,const GLfloat* value)const{auto const profilingStart=this->profiler.begin(1733);(this->*((FunctionTable::MEMBERPFNGLUNIFORM3FVPROC)this->m_profiledFunctions[1733]))(location,count,value);this->profiler.end(1733,profilingStart);}
+void m_glGetnPixelMapusvARB_profiling(GLenum map,GLsizei bufSize,GLushort* values)const{auto const profilingStart=this->profiler.begin(1734);(this->*((FunctionTable::MEMBERPFNGLGETNPIXELMAPUSVARBPROC)this->m_profiledFunctions[1734]))(map,bufSize,values);this->profiler.end(1734,profilingStart);}
+void m_glMultiTexCoordP1ui_profiling(GLenum texture,GLenum type,GLuint coords)const{auto const profilingStart=this->profiler.begin(1735);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORDP1UIPROC)this->m_profiledFunctions[1735]))(texture,type,coords);this->profiler.end(1735,profilingStart);}
+void m_glClearNamedBufferDataEXT_profiling(GLuint buffer,GLenum internalformat,GLenum format,GLenum type,const void* data)const{auto const profilingStart=this->profiler.begin(1736);(this->*((FunctionTable::MEMBERPFNGLCLEARNAMEDBUFFERDATAEXTPROC)this->m_profiledFunctions[1736]))(buffer,internalformat,format,type,data);this->profiler.end(1736,profilingStart);}
+void m_glUniformMatrix4dv_profiling(GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{auto const profilingStart=this->profiler.begin(1737);(this->*((FunctionTable::MEMBERPFNGLUNIFORMMATRIX4DVPROC)this->m_profiledFunctions[1737]))(location,count,transpose,value);this->profiler.end(1737,profilingStart);}
+void m_glWindowPos3fMESA_profiling(GLfloat x,GLfloat y,GLfloat z)const{auto const profilingStart=this->profiler.begin(1738);(this->*((FunctionTable::MEMBERPFNGLWINDOWPOS3FMESAPROC)this->m_profiledFunctions[1738]))(x,y,z);this->profiler.end(1738,profilingStart);}
+void m_glDeleteRenderbuffers_profiling(GLsizei n,const GLuint* renderbuffers)const{auto const profilingStart=this->profiler.begin(1739);(this->*((FunctionTable::MEMBERPFNGLDELETERENDERBUFFERSPROC)this->m_profiledFunctions[1739]))(n,renderbuffers);this->profiler.end(1739,profilingStart);}
+void m_glGetTextureLevelParameterfvEXT_profiling(GLuint texture,GLenum target,GLint level,GLenum pname,GLfloat* params)const{auto const profilingStart=this->profiler.begin(1740);(this->*((FunctionTable::MEMBERPFNGLGETTEXTURELEVELPARAMETERFVEXTPROC)this->m_profiledFunctions[1740]))(texture,target,level,pname,params);this->profiler.end(1740,profilingStart);}
+void m_glGetHistogramParameterxvOES_profiling(GLenum target,GLenum pname,GLfixed* params)const{auto const profilingStart=this->profiler.begin(1741);(this->*((FunctionTable::MEMBERPFNGLGETHISTOGRAMPARAMETERXVOESPROC)this->m_profiledFunctions[1741]))(target,pname,params);this->profiler.end(1741,profilingStart);}
+void m_glMultiDrawElements_profiling(GLenum mode,const GLsizei* count,GLenum type,const void*const* indices,GLsizei drawcount)const{auto const profilingStart=this->profiler.begin(1742);(this->*((FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSPROC)this->m_profiledFunctions[1742]))(mode,count,type,indices,drawcount);this->profiler.end(1742,profilingStart);}
+void m_glMakeImageHandleNonResidentNV_profiling(GLuint64 handle)const{auto const profilingStart=this->profiler.begin(1743);(this->*((FunctionTable::MEMBERPFNGLMAKEIMAGEHANDLENONRESIDENTNVPROC)this->m_profiledFunctions[1743]))(handle);this->profiler.end(1743,profilingStart);}
+void m_glTexSubImage1DEXT_profiling(GLenum target,GLint level,GLint xoffset,GLsizei width,GLenum format,GLenum type,const void* pixels)const{auto const profilingStart=this->profiler.begin(1744);(this->*((FunctionTable::MEMBERPFNGLTEXSUBIMAGE1DEXTPROC)this->m_profiledFunctions[1744]))(target,level,xoffset,width,format,type,pixels);this->profiler.end(1744,profilingStart);}
+void m_glNormalStream3dATI_profiling(GLenum stream,GLdouble nx,GLdouble ny,GLdouble nz)const{auto const profilingStart=this->profiler.begin(1745);(this->*((FunctionTable::MEMBERPFNGLNORMALSTREAM3DATIPROC)this->m_profiledFunctions[1745]))(stream,nx,ny,nz);this->profiler.end(1745,profilingStart);}
+void m_glVertexAttribL4i64vNV_profiling(GLuint index,const GLint64EXT* v)const{auto const profilingStart=this->profiler.begin(1746);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBL4I64VNVPROC)this->m_profiledFunctions[1746]))(index,v);this->profiler.end(1746,profilingStart);}
+void m_glDrawBuffers_profiling(GLsizei n,const GLenum* bufs)const{auto const profilingStart=this->profiler.begin(1747);(this->*((FunctionTable::MEMBERPFNGLDRAWBUFFERSPROC)this->m_profiledFunctions[1747]))(n,bufs);this->profiler.end(1747,profilingStart);}
+void m_glCopyTextureSubImage1DEXT_profiling(GLuint texture,GLenum target,GLint level,GLint xoffset,GLint x,GLint y,GLsizei width)const{auto const profilingStart=this->profiler.begin(1748);(this->*((FunctionTable::MEMBERPFNGLCOPYTEXTURESUBIMAGE1DEXTPROC)this->m_profiledFunctions[1748]))(texture,target,level,xoffset,x,y,width);this->profiler.end(1748,profilingStart);}
+void m_glWindowRectanglesEXT_profiling(GLenum mode,GLsizei count,const GLint* box)const{auto const profilingStart=this->profiler.begin(1749);(this->*((FunctionTable::MEMBERPFNGLWINDOWRECTANGLESEXTPROC)this->m_profiledFunctions[1749]))(mode,count,box);this->profiler.end(1749,profilingStart);}
+void m_glNamedFramebufferReadBuffer_profiling(GLuint framebuffer,GLenum src)const{auto const profilingStart=this->profiler.begin(1750);(this->*((FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERREADBUFFERPROC)this->m_profiledFunctions[1750]))(framebuffer,src);this->profiler.end(1750,profilingStart);}
+void m_glUniform2i64vARB_profiling(GLint location,GLsizei count,const GLint64* value)const{auto const profilingStart=this->profiler.begin(1751);(this->*((FunctionTable::MEMBERPFNGLUNIFORM2I64VARBPROC)this->m_profiledFunctions[1751]))(location,count,value);this->profiler.end(1751,profilingStart);}
+void m_glVertexAttribI1uivEXT_profiling(GLuint index,const GLuint* v)const{auto const profilingStart=this->profiler.begin(1752);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBI1UIVEXTPROC)this->m_profiledFunctions[1752]))(index,v);this->profiler.end(1752,profilingStart);}
+void m_glGetTexGenfv_profiling(GLenum coord,GLenum pname,GLfloat* params)const{auto const profilingStart=this->profiler.begin(1753);(this->*((FunctionTable::MEMBERPFNGLGETTEXGENFVPROC)this->m_profiledFunctions[1753]))(coord,pname,params);this->profiler.end(1753,profilingStart);}
+void m_glBeginQueryARB_profiling(GLenum target,GLuint id)const{auto const profilingStart=this->profiler.begin(1754);(this->*((FunctionTable::MEMBERPFNGLBEGINQUERYARBPROC)this->m_profiledFunctions[1754]))(target,id);this->profiler.end(1754,profilingStart);}
+void m_glUniform1iARB_profiling(GLint location,GLint v0)const{auto const profilingStart=this->profiler.begin(1755);(this->*((FunctionTable::MEMBERPFNGLUNIFORM1IARBPROC)this->m_profiledFunctions[1755]))(location,v0);this->profiler.end(1755,profilingStart);}
+void m_glVertex4bvOES_profiling(const GLbyte* coords)const{auto const profilingStart=this->profiler.begin(1756);(this->*((FunctionTable::MEMBERPFNGLVERTEX4BVOESPROC)this->m_profiledFunctions[1756]))(coords);this->profiler.end(1756,profilingStart);}
+void m_glInvalidateSubFramebuffer_profiling(GLenum target,GLsizei numAttachments,const GLenum* attachments,GLint x,GLint y,GLsizei width,GLsizei height)const{auto const profilingStart=this->profiler.begin(1757);(this->*((FunctionTable::MEMBERPFNGLINVALIDATESUBFRAMEBUFFERPROC)this->m_profiledFunctions[1757]))(target,numAttachments,attachments,x,y,width,height);this->profiler.end(1757,profilingStart);}
+void m_glUniform1fvARB_profiling(GLint location,GLsizei count,const GLfloat* value)const{auto const profilingStart=this->profiler.begin(1758);(this->*((FunctionTable::MEMBERPFNGLUNIFORM1FVARBPROC)this->m_profiledFunctions[1758]))(location,count,value);this->profiler.end(1758,profilingStart);}
+GLboolean m_glTestFenceNV_profiling(GLuint fence)const{auto const profilingStart=this->profiler.begin(1759);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLTESTFENCENVPROC)this->m_profiledFunctions[1759]))(fence);this->profiler.end(1759,profilingStart);return profilingResult;}
+void m_glBindTransformFeedback_profiling(GLenum target,GLuint id)const{auto const profilingStart=this->profiler.begin(1760);(this->*((FunctionTable::MEMBERPFNGLBINDTRANSFORMFEEDBACKPROC)this->m_profiledFunctions[1760]))(target,id);this->profiler.end(1760,profilingStart);}
+void m_glMultiTexCoord2iv_profiling(GLenum target,const GLint* v)const{auto const profilingStart=this->profiler.begin(1761);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD2IVPROC)this->m_profiledFunctions[1761]))(target,v);this->profiler.end(1761,profilingStart);}
+void m_glCopyMultiTexSubImage1DEXT_profiling(GLenum texunit,GLenum target,GLint level,GLint xoffset,GLint x,GLint y,GLsizei width)const{auto const profilingStart=this->profiler.begin(1762);(this->*((FunctionTable::MEMBERPFNGLCOPYMULTITEXSUBIMAGE1DEXTPROC)this->m_profiledFunctions[1762]))(texunit,target,level,xoffset,x,y,width);this->profiler.end(1762,profilingStart);}
+void m_glVariantbvEXT_profiling(GLuint id,const GLbyte* addr)const{auto const profilingStart=this->profiler.begin(1763);(this->*((FunctionTable::MEMBERPFNGLVARIANTBVEXTPROC)this->m_profiledFunctions[1763]))(id,addr);this->profiler.end(1763,profilingStart);}
+void m_glTexCoord1hNV_profiling(GLhalfNV s)const{auto const profilingStart=this->profiler.begin(1764);(this->*((FunctionTable::MEMBERPFNGLTEXCOORD1HNVPROC)this->m_profiledFunctions[1764]))(s);this->profiler.end(1764,profilingStart);}
+void m_glGenFencesNV_profiling(GLsizei n,GLuint* fences)const{auto const profilingStart=this->profiler.begin(1765);(this->*((FunctionTable::MEMBERPFNGLGENFENCESNVPROC)this->m_profiledFunctions[1765]))(n,fences);this->profiler.end(1765,profilingStart);}
+void m_glRasterPos3iv_profiling(const GLint* v)const{auto const profilingStart=this->profiler.begin(1766);(this->*((FunctionTable::MEMBERPFNGLRASTERPOS3IVPROC)this->m_profiledFunctions[1766]))(v);this->profiler.end(1766,profilingStart);}
+void m_glVertexAttribL2ui64NV_profiling(GLuint index,GLuint64EXT x,GLuint64EXT y)const{auto const profilingStart=this->profiler.begin(1767);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBL2UI64NVPROC)this->m_profiledFunctions[1767]))(index,x,y);this->profiler.end(1767,profilingStart);}
+void m_glMultiTexCoord1hvNV_profiling(GLenum target,const GLhalfNV* v)const{auto const profilingStart=this->profiler.begin(1768);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD1HVNVPROC)this->m_profiledFunctions[1768]))(target,v);this->profiler.end(1768,profilingStart);}
+void m_glGetnConvolutionFilter_profiling(GLenum target,GLenum format,GLenum type,GLsizei bufSize,void* image)const{auto const profilingStart=this->profiler.begin(1769);(this->*((FunctionTable::MEMBERPFNGLGETNCONVOLUTIONFILTERPROC)this->m_profiledFunctions[1769]))(target,format,type,bufSize,image);this->profiler.end(1769,profilingStart);}
+void m_glNormal3bv_profiling(const GLbyte* v)const{auto const profilingStart=this->profiler.begin(1770);(this->*((FunctionTable::MEMBERPFNGLNORMAL3BVPROC)this->m_profiledFunctions[1770]))(v);this->profiler.end(1770,profilingStart);}
+void m_glWeightbvARB_profiling(GLint size,const GLbyte* weights)const{auto const profilingStart=this->profiler.begin(1771);(this->*((FunctionTable::MEMBERPFNGLWEIGHTBVARBPROC)this->m_profiledFunctions[1771]))(size,weights);this->profiler.end(1771,profilingStart);}
+void m_glTexCoord4sv_profiling(const GLshort* v)const{auto const profilingStart=this->profiler.begin(1772);(this->*((FunctionTable::MEMBERPFNGLTEXCOORD4SVPROC)this->m_profiledFunctions[1772]))(v);this->profiler.end(1772,profilingStart);}
+void m_glUniform2uiv_profiling(GLint location,GLsizei count,const GLuint* value)const{auto const profilingStart=this->profiler.begin(1773);(this->*((FunctionTable::MEMBERPFNGLUNIFORM2UIVPROC)this->m_profiledFunctions[1773]))(location,count,value);this->profiler.end(1773,profilingStart);}
+void m_glBeginConditionalRenderNVX_profiling(GLuint id)const{auto const profilingStart=this->profiler.begin(1774);(this->*((FunctionTable::MEMBERPFNGLBEGINCONDITIONALRENDERNVXPROC)this->m_profiledFunctions[1774]))(id);this->profiler.end(1774,profilingStart);}
+void m_glFinish_profiling()const{auto const profilingStart=this->profiler.begin(1775);(this->*((FunctionTable::MEMBERPFNGLFINISHPROC)this->m_profiledFunctions[1775]))();this->profiler.end(1775,profilingStart);}
+void m_glColorTableParameterfv_profiling(GLenum target,GLenum pname,const GLfloat* params)const{auto const profilingStart=this->profiler.begin(1776);(this->*((FunctionTable::MEMBERPFNGLCOLORTABLEPARAMETERFVPROC)this->m_profiledFunctions[1776]))(target,pname,params);this->profiler.end(1776,profilingStart);}
+void m_glFragmentCoverageColorNV_profiling(GLuint color)const{auto const profilingStart=this->profiler.begin(1777);(this->*((FunctionTable::MEMBERPFNGLFRAGMENTCOVERAGECOLORNVPROC)this->m_profiledFunctions[1777]))(color);this->profiler.end(1777,profilingStart);}
+void m_glProgramUniform3ivEXT_profiling(GLuint program,GLint location,GLsizei count,const GLint* value)const{auto const profilingStart=this->profiler.begin(1778);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3IVEXTPROC)this->m_profiledFunctions[1778]))(program,location,count,value);this->profiler.end(1778,profilingStart);}
+void m_glVertexArrayVertexOffsetEXT_profiling(GLuint vaobj,GLuint buffer,GLint size,GLenum type,GLsizei stride,GLintptr offset)const{auto const profilingStart=this->profiler.begin(1779);(this->*((FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXOFFSETEXTPROC)this->m_profiledFunctions[1779]))(vaobj,buffer,size,type,stride,offset);this->profiler.end(1779,profilingStart);}
+void m_glViewportPositionWScaleNV_profiling(GLuint index,GLfloat xcoeff,GLfloat ycoeff)const{auto const profilingStart=this->profiler.begin(1780);(this->*((FunctionTable::MEMBERPFNGLVIEWPORTPOSITIONWSCALENVPROC)this->m_profiledFunctions[1780]))(index,xcoeff,ycoeff);this->profiler.end(1780,profilingStart);}
+void m_glGetProgramLocalParameterIuivNV_profiling(GLenum target,GLuint index,GLuint* params)const{auto const profilingStart=this->profiler.begin(1781);(this->*((FunctionTable::MEMBERPFNGLGETPROGRAMLOCALPARAMETERIUIVNVPROC)this->m_profiledFunctions[1781]))(target,index,params);this->profiler.end(1781,profilingStart);}
+void m_glReplacementCodeuiTexCoord2fVertex3fvSUN_profiling(const GLuint* rc,const GLfloat* tc,const GLfloat* v)const{auto const profilingStart=this->profiler.begin(1782);(this->*((FunctionTable::MEMBERPFNGLREPLACEMENTCODEUITEXCOORD2FVERTEX3FVSUNPROC)this->m_profiledFunctions[1782]))(rc,tc,v);this->profiler.end(1782,profilingStart);}
+void m_glUniform1uiv_profiling(GLint location,GLsizei count,const GLuint* value)const{auto const profilingStart=this->profiler.begin(1783);(this->*((FunctionTable::MEMBERPFNGLUNIFORM1UIVPROC)this->m_profiledFunctions[1783]))(location,count,value);this->profiler.end(1783,profilingStart);}
+void m_glUniformMatrix2dv_profiling(GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{auto const profilingStart=this->profiler.begin(1784);(this->*((FunctionTable::MEMBERPFNGLUNIFORMMATRIX2DVPROC)this->m_profiledFunctions[1784]))(location,count,transpose,value);this->profiler.end(1784,profilingStart);}
+void m_glIndexdv_profiling(const GLdouble* c)const{auto const profilingStart=this->profiler.begin(1785);(this->*((FunctionTable::MEMBERPFNGLINDEXDVPROC)this->m_profiledFunctions[1785]))(c);this->profiler.end(1785,profilingStart);}
+void m_glSecondaryColor3ivEXT_profiling(const GLint* v)const{auto const profilingStart=this->profiler.begin(1786);(this->*((FunctionTable::MEMBERPFNGLSECONDARYCOLOR3IVEXTPROC)this->m_profiledFunctions[1786]))(v);this->profiler.end(1786,profilingStart);}
+void m_glTexCoord3iv_profiling(const GLint* v)const{auto const profilingStart=this->profiler.begin(1787);(this->*((FunctionTable::MEMBERPFNGLTEXCOORD3IVPROC)this->m_profiledFunctions[1787]))(v);this->profiler.end(1787,profilingStart);}
+void m_glVertexStream4fvATI_profiling(GLenum stream,const GLfloat* coords)const{auto const profilingStart=this->profiler.begin(1788);(this->*((FunctionTable::MEMBERPFNGLVERTEXSTREAM4FVATIPROC)this->m_profiledFunctions[1788]))(stream,coords);this->profiler.end(1788,profilingStart);}
+void m_glDeformationMap3fSGIX_profiling(GLenum target,GLfloat u1,GLfloat u2,GLint ustride,GLint uorder,GLfloat v1,GLfloat v2,GLint vstride,GLint vorder,GLfloat w1,GLfloat w2,GLint wstride,GLint worder,const GLfloat* points)const{auto const profilingStart=this->profiler.begin(1789);(this->*((FunctionTable::MEMBERPFNGLDEFORMATIONMAP3FSGIXPROC)this->m_profiledFunctions[1789]))(target,u1,u2,ustride,uorder,v1,v2,vstride,vorder,w1,w2,wstride,worder,points);this->profiler.end(1789,profilingStart);}
+void m_glClearDepth_profiling(GLclampd depth)const{auto const profilingStart=this->profiler.begin(1790);(this->*((FunctionTable::MEMBERPFNGLCLEARDEPTHPROC)this->m_profiledFunctions[1790]))(depth);this->profiler.end(1790,profilingStart);}
+GLuint m_glGenAsyncMarkersSGIX_profiling(GLsizei range)const{auto const profilingStart=this->profiler.begin(1791);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLGENASYNCMARKERSSGIXPROC)this->m_profiledFunctions[1791]))(range);this->profiler.end(1791,profilingStart);return profilingResult;}
+void m_glDisableIndexedEXT_profiling(GLenum target,GLuint index)const{auto const profilingStart=this->profiler.begin(1792);(this->*((FunctionTable::MEMBERPFNGLDISABLEINDEXEDEXTPROC)this->m_profiledFunctions[1792]))(target,index);this->profiler.end(1792,profilingStart);}
+void m_glVertexWeightfvEXT_profiling(const GLfloat* weight)const{auto const profilingStart=this->profiler.begin(1793);(this->*((FunctionTable::MEMBERPFNGLVERTEXWEIGHTFVEXTPROC)this->m_profiledFunctions[1793]))(weight);this->profiler.end(1793,profilingStart);}
+void m_glGetProgramLocalParameterIivNV_profiling(GLenum target,GLuint index,GLint* params)const{auto const profilingStart=this->profiler.begin(1794);(this->*((FunctionTable::MEMBERPFNGLGETPROGRAMLOCALPARAMETERIIVNVPROC)this->m_profiledFunctions[1794]))(target,index,params);this->profiler.end(1794,profilingStart);}
+void m_glCompressedTexImage3DARB_profiling(GLenum target,GLint level,GLenum internalformat,GLsizei width,GLsizei height,GLsizei depth,GLint border,GLsizei imageSize,const void* data)const{auto const profilingStart=this->profiler.begin(1795);(this->*((FunctionTable::MEMBERPFNGLCOMPRESSEDTEXIMAGE3DARBPROC)this->m_profiledFunctions[1795]))(target,level,internalformat,width,height,depth,border,imageSize,data);this->profiler.end(1795,profilingStart);}
+void m_glProgramParameter4fNV_profiling(GLenum target,GLuint index,GLfloat x,GLfloat y,GLfloat z,GLfloat w)const{auto const profilingStart=this->profiler.begin(1796);(this->*((FunctionTable::MEMBERPFNGLPROGRAMPARAMETER4FNVPROC)this->m_profiledFunctions[1796]))(target,index,x,y,z,w);this->profiler.end(1796,profilingStart);}
+void m_glConvolutionParameterxOES_profiling(GLenum target,GLenum pname,GLfixed param)const{auto const profilingStart=this->profiler.begin(1797);(this->*((FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERXOESPROC)this->m_profiledFunctions[1797]))(target,pname,param);this->profiler.end(1797,profilingStart);}
+void m_glInsertComponentEXT_profiling(GLuint res,GLuint src,GLuint num)const{auto const profilingStart=this->profiler.begin(1798);(this->*((FunctionTable::MEMBERPFNGLINSERTCOMPONENTEXTPROC)this->m_profiledFunctions[1798]))(res,src,num);this->profiler.end(1798,profilingStart);}
+void m_glCreateTextures_profiling(GLenum target,GLsizei n,GLuint* textures)const{auto const profilingStart=this->profiler.begin(1799);(this->*((FunctionTable::MEMBERPFNGLCREATETEXTURESPROC)this->m_profiledFunctions[1799]))(target,n,textures);this->profiler.end(1799,profilingStart);}
+void m_glSecondaryColor3iv_profiling(const GLint* v)const{auto const profilingStart=this->profiler.begin(1800);(this->*((FunctionTable::MEMBERPFNGLSECONDARYCOLOR3IVPROC)this->m_profiledFunctions[1800]))(v);this->profiler.end(1800,profilingStart);}
+void m_glCreateBuffers_profiling(GLsizei n,GLuint* buffers)const{auto const profilingStart=this->profiler.begin(1801);(this->*((FunctionTable::MEMBERPFNGLCREATEBUFFERSPROC)this->m_profiledFunctions[1801]))(n,buffers);this->profiler.end(1801,profilingStart);}
+void m_glMultiTexCoord2xvOES_profiling(GLenum texture,const GLfixed* coords)const{auto const profilingStart=this->profiler.begin(1802);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD2XVOESPROC)this->m_profiledFunctions[1802]))(texture,coords);this->profiler.end(1802,profilingStart);}
+void m_glTexGenxvOES_profiling(GLenum coord,GLenum pname,const GLfixed* params)const{auto const profilingStart=this->profiler.begin(1803);(this->*((FunctionTable::MEMBERPFNGLTEXGENXVOESPROC)this->m_profiledFunctions[1803]))(coord,pname,params);this->profiler.end(1803,profilingStart);}
+void m_glMultTransposeMatrixf_profiling(const GLfloat m[16])const{auto const profilingStart=this->profiler.begin(1804);(this->*((FunctionTable::MEMBERPFNGLMULTTRANSPOSEMATRIXFPROC)this->m_profiledFunctions[1804]))(m);this->profiler.end(1804,profilingStart);}
+void m_glBeginTransformFeedbackEXT_profiling(GLenum primitiveMode)const{auto const profilingStart=this->profiler.begin(1805);(this->*((FunctionTable::MEMBERPFNGLBEGINTRANSFORMFEEDBACKEXTPROC)this->m_profiledFunctions[1805]))(primitiveMode);this->profiler.end(1805,profilingStart);}
+void m_glTexCoord2fColor3fVertex3fSUN_profiling(GLfloat s,GLfloat t,GLfloat r,GLfloat g,GLfloat b,GLfloat x,GLfloat y,GLfloat z)const{auto const profilingStart=this->profiler.begin(1806);(this->*((FunctionTable::MEMBERPFNGLTEXCOORD2FCOLOR3FVERTEX3FSUNPROC)this->m_profiledFunctions[1806]))(s,t,r,g,b,x,y,z);this->profiler.end(1806,profilingStart);}
+void m_glNormal3sv_profiling(const GLshort* v)const{auto const profilingStart=this->profiler.begin(1807);(this->*((FunctionTable::MEMBERPFNGLNORMAL3SVPROC)this->m_profiledFunctions[1807]))(v);this->profiler.end(1807,profilingStart);}
+void m_glFreeObjectBufferATI_profiling(GLuint buffer)const{auto const profilingStart=this->profiler.begin(1808);(this->*((FunctionTable::MEMBERPFNGLFREEOBJECTBUFFERATIPROC)this->m_profiledFunctions[1808]))(buffer);this->profiler.end(1808,profilingStart);}
+void m_glBlendBarrierNV_profiling()const{auto const profilingStart=this->profiler.begin(1809);(this->*((FunctionTable::MEMBERPFNGLBLENDBARRIERNVPROC)this->m_profiledFunctions[1809]))();this->profiler.end(1809,profilingStart);}
+void m_glUniform4i64vNV_profiling(GLint location,GLsizei count,const GLint64EXT* value)const{auto const profilingStart=this->profiler.begin(1810);(this->*((FunctionTable::MEMBERPFNGLUNIFORM4I64VNVPROC)this->m_profiledFunctions[1810]))(location,count,value);this->profiler.end(1810,profilingStart);}
+void m_glGetnUniformuivARB_profiling(GLuint program,GLint location,GLsizei bufSize,GLuint* params)const{auto const profilingStart=this->profiler.begin(1811);(this->*((FunctionTable::MEMBERPFNGLGETNUNIFORMUIVARBPROC)this->m_profiledFunctions[1811]))(program,location,bufSize,params);this->profiler.end(1811,profilingStart);}
+void m_glAlphaFragmentOp3ATI_profiling(GLenum op,GLuint dst,GLuint dstMod,GLuint arg1,GLuint arg1Rep,GLuint arg1Mod,GLuint arg2,GLuint arg2Rep,GLuint arg2Mod,GLuint arg3,GLuint arg3Rep,GLuint arg3Mod)const{auto const profilingStart=this->profiler.begin(1812);(this->*((FunctionTable::MEMBERPFNGLALPHAFRAGMENTOP3ATIPROC)this->m_profiledFunctions[1812]))(op,dst,dstMod,arg1,arg1Rep,arg1Mod,arg2,arg2Rep,arg2Mod,arg3,arg3Rep,arg3Mod);this->profiler.end(1812,profilingStart);}
+void m_glProgramEnvParameters4fvEXT_profiling(GLenum target,GLuint index,GLsizei count,const GLfloat* params)const{auto const profilingStart=this->profiler.begin(1813);(this->*((FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERS4FVEXTPROC)this->m_profiledFunctions[1813]))(target,index,count,params);this->profiler.end(1813,profilingStart);}
+void m_glBlendFuncSeparateEXT_profiling(GLenum sfactorRGB,GLenum dfactorRGB,GLenum sfactorAlpha,GLenum dfactorAlpha)const{auto const profilingStart=this->profiler.begin(1814);(this->*((FunctionTable::MEMBERPFNGLBLENDFUNCSEPARATEEXTPROC)this->m_profiledFunctions[1814]))(sfactorRGB,dfactorRGB,sfactorAlpha,dfactorAlpha);this->profiler.end(1814,profilingStart);}
+void m_glConvolutionParameterivEXT_profiling(GLenum target,GLenum pname,const GLint* params)const{auto const profilingStart=this->profiler.begin(1815);(this->*((FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERIVEXTPROC)this->m_profiledFunctions[1815]))(target,pname,params);this->profiler.end(1815,profilingStart);}
+void m_glPixelTexGenSGIX_profiling(GLenum mode)const{auto const profilingStart=this->profiler.begin(1816);(this->*((FunctionTable::MEMBERPFNGLPIXELTEXGENSGIXPROC)this->m_profiledFunctions[1816]))(mode);this->profiler.end(1816,profilingStart);}
+void m_glDeleteProgram_profiling(GLuint program)const{auto const profilingStart=this->profiler.begin(1817);(this->*((FunctionTable::MEMBERPFNGLDELETEPROGRAMPROC)this->m_profiledFunctions[1817]))(program);this->profiler.end(1817,profilingStart);}
+void m_glUniformMatrix4x3dv_profiling(GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{auto const profilingStart=this->profiler.begin(1818);(this->*((FunctionTable::MEMBERPFNGLUNIFORMMATRIX4X3DVPROC)this->m_profiledFunctions[1818]))(location,count,transpose,value);this->profiler.end(1818,profilingStart);}
+void m_glGetVideoCaptureStreamivNV_profiling(GLuint video_capture_slot,GLuint stream,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(1819);(this->*((FunctionTable::MEMBERPFNGLGETVIDEOCAPTURESTREAMIVNVPROC)this->m_profiledFunctions[1819]))(video_capture_slot,stream,pname,params);this->profiler.end(1819,profilingStart);}
+void m_glProgramUniform4uiEXT_profiling(GLuint program,GLint location,GLuint v0,GLuint v1,GLuint v2,GLuint v3)const{auto const profilingStart=this->profiler.begin(1820);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UIEXTPROC)this->m_profiledFunctions[1820]))(program,location,v0,v1,v2,v3);this->profiler.end(1820,profilingStart);}
+void m_glMakeImageHandleNonResidentARB_profiling(GLuint64 handle)const{auto const profilingStart=this->profiler.begin(1821);(this->*((FunctionTable::MEMBERPFNGLMAKEIMAGEHANDLENONRESIDENTARBPROC)this->m_profiledFunctions[1821]))(handle);this->profiler.end(1821,profilingStart);}
+void m_glSecondaryColor3dEXT_profiling(GLdouble red,GLdouble green,GLdouble blue)const{auto const profilingStart=this->profiler.begin(1822);(this->*((FunctionTable::MEMBERPFNGLSECONDARYCOLOR3DEXTPROC)this->m_profiledFunctions[1822]))(red,green,blue);this->profiler.end(1822,profilingStart);}
+void m_glDeleteQueries_profiling(GLsizei n,const GLuint* ids)const{auto const profilingStart=this->profiler.begin(1823);(this->*((FunctionTable::MEMBERPFNGLDELETEQUERIESPROC)this->m_profiledFunctions[1823]))(n,ids);this->profiler.end(1823,profilingStart);}
+void m_glNormalP3uiv_profiling(GLenum type,const GLuint* coords)const{auto const profilingStart=this->profiler.begin(1824);(this->*((FunctionTable::MEMBERPFNGLNORMALP3UIVPROC)this->m_profiledFunctions[1824]))(type,coords);this->profiler.end(1824,profilingStart);}
+void m_glRasterPos2d_profiling(GLdouble x,GLdouble y)const{auto const profilingStart=this->profiler.begin(1825);(this->*((FunctionTable::MEMBERPFNGLRASTERPOS2DPROC)this->m_profiledFunctions[1825]))(x,y);this->profiler.end(1825,profilingStart);}
+void m_glInitNames_profiling()const{auto const profilingStart=this->profiler.begin(1826);(this->*((FunctionTable::MEMBERPFNGLINITNAMESPROC)this->m_profiledFunctions[1826]))();this->profiler.end(1826,profilingStart);}
+void m_glBinormal3fvEXT_profiling(const GLfloat* v)const{auto const profilingStart=this->profiler.begin(1827);(this->*((FunctionTable::MEMBERPFNGLBINORMAL3FVEXTPROC)this->m_profiledFunctions[1827]))(v);this->profiler.end(1827,profilingStart);}
+void m_glColor3dv_profiling(const GLdouble* v)const{auto const profilingStart=this->profiler.begin(1828);(this->*((FunctionTable::MEMBERPFNGLCOLOR3DVPROC)this->m_profiledFunctions[1828]))(v);this->profiler.end(1828,profilingStart);}
+void m_glVertexArrayVertexAttribDivisorEXT_profiling(GLuint vaobj,GLuint index,GLuint divisor)const{auto const profilingStart=this->profiler.begin(1829);(this->*((FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBDIVISOREXTPROC)this->m_profiledFunctions[1829]))(vaobj,index,divisor);this->profiler.end(1829,profilingStart);}
+void m_glArrayElementEXT_profiling(GLint i)const{auto const profilingStart=this->profiler.begin(1830);(this->*((FunctionTable::MEMBERPFNGLARRAYELEMENTEXTPROC)this->m_profiledFunctions[1830]))(i);this->profiler.end(1830,profilingStart);}
+void m_glProgramParameter4dNV_profiling(GLenum target,GLuint index,GLdouble x,GLdouble y,GLdouble z,GLdouble w)const{auto const profilingStart=this->profiler.begin(1831);(this->*((FunctionTable::MEMBERPFNGLPROGRAMPARAMETER4DNVPROC)this->m_profiledFunctions[1831]))(target,index,x,y,z,w);this->profiler.end(1831,profilingStart);}
+void m_glIndexxOES_profiling(GLfixed component)const{auto const profilingStart=this->profiler.begin(1832);(this->*((FunctionTable::MEMBERPFNGLINDEXXOESPROC)this->m_profiledFunctions[1832]))(component);this->profiler.end(1832,profilingStart);}
+void m_glUniform3uivEXT_profiling(GLint location,GLsizei count,const GLuint* value)const{auto const profilingStart=this->profiler.begin(1833);(this->*((FunctionTable::MEMBERPFNGLUNIFORM3UIVEXTPROC)this->m_profiledFunctions[1833]))(location,count,value);this->profiler.end(1833,profilingStart);}
+void m_glPopGroupMarkerEXT_profiling()const{auto const profilingStart=this->profiler.begin(1834);(this->*((FunctionTable::MEMBERPFNGLPOPGROUPMARKEREXTPROC)this->m_profiledFunctions[1834]))();this->profiler.end(1834,profilingStart);}
+void m_glClearNamedFramebufferuiv_profiling(GLuint framebuffer,GLenum buffer,GLint drawbuffer,const GLuint* value)const{auto const profilingStart=this->profiler.begin(1835);(this->*((FunctionTable::MEMBERPFNGLCLEARNAMEDFRAMEBUFFERUIVPROC)this->m_profiledFunctions[1835]))(framebuffer,buffer,drawbuffer,value);this->profiler.end(1835,profilingStart);}
+void m_glSetLocalConstantEXT_profiling(GLuint id,GLenum type,const void* addr)const{auto const profilingStart=this->profiler.begin(1836);(this->*((FunctionTable::MEMBERPFNGLSETLOCALCONSTANTEXTPROC)this->m_profiledFunctions[1836]))(id,type,addr);this->profiler.end(1836,profilingStart);}
+void m_glProgramUniform1ui64NV_profiling(GLuint program,GLint location,GLuint64EXT x)const{auto const profilingStart=this->profiler.begin(1837);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UI64NVPROC)this->m_profiledFunctions[1837]))(program,location,x);this->profiler.end(1837,profilingStart);}
+void m_glColor4hvNV_profiling(const GLhalfNV* v)const{auto const profilingStart=this->profiler.begin(1838);(this->*((FunctionTable::MEMBERPFNGLCOLOR4HVNVPROC)this->m_profiledFunctions[1838]))(v);this->profiler.end(1838,profilingStart);}
+void m_glGetVertexAttribfv_profiling(GLuint index,GLenum pname,GLfloat* params)const{auto const profilingStart=this->profiler.begin(1839);(this->*((FunctionTable::MEMBERPFNGLGETVERTEXATTRIBFVPROC)this->m_profiledFunctions[1839]))(index,pname,params);this->profiler.end(1839,profilingStart);}
+void m_glDispatchCompute_profiling(GLuint num_groups_x,GLuint num_groups_y,GLuint num_groups_z)const{auto const profilingStart=this->profiler.begin(1840);(this->*((FunctionTable::MEMBERPFNGLDISPATCHCOMPUTEPROC)this->m_profiledFunctions[1840]))(num_groups_x,num_groups_y,num_groups_z);this->profiler.end(1840,profilingStart);}
+void m_glGetActiveAttrib_profiling(GLuint program,GLuint index,GLsizei bufSize,GLsizei* length,GLint* size,GLenum* type,GLchar* name)const{auto const profilingStart=this->profiler.begin(1841);(this->*((FunctionTable::MEMBERPFNGLGETACTIVEATTRIBPROC)this->m_profiledFunctions[1841]))(program,index,bufSize,length,size,type,name);this->profiler.end(1841,profilingStart);}
+void m_glFragmentColorMaterialSGIX_profiling(GLenum face,GLenum mode)const{auto const profilingStart=this->profiler.begin(1842);(this->*((FunctionTable::MEMBERPFNGLFRAGMENTCOLORMATERIALSGIXPROC)this->m_profiledFunctions[1842]))(face,mode);this->profiler.end(1842,profilingStart);}
+void m_glTexSubImage2D_profiling(GLenum target,GLint level,GLint xoffset,GLint yoffset,GLsizei width,GLsizei height,GLenum format,GLenum type,const GLvoid* pixels)const{auto const profilingStart=this->profiler.begin(1843);(this->*((FunctionTable::MEMBERPFNGLTEXSUBIMAGE2DPROC)this->m_profiledFunctions[1843]))(target,level,xoffset,yoffset,width,height,format,type,pixels);this->profiler.end(1843,profilingStart);}
+void m_glGetnMinmaxARB_profiling(GLenum target,GLboolean reset,GLenum format,GLenum type,GLsizei bufSize,void* values)const{auto const profilingStart=this->profiler.begin(1844);(this->*((FunctionTable::MEMBERPFNGLGETNMINMAXARBPROC)this->m_profiledFunctions[1844]))(target,reset,format,type,bufSize,values);this->profiler.end(1844,profilingStart);}
+void m_glLogicOp_profiling(GLenum opcode)const{auto const profilingStart=this->profiler.begin(1845);(this->*((FunctionTable::MEMBERPFNGLLOGICOPPROC)this->m_profiledFunctions[1845]))(opcode);this->profiler.end(1845,profilingStart);}
+void m_glProgramUniformMatrix3x4fv_profiling(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{auto const profilingStart=this->profiler.begin(1846);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X4FVPROC)this->m_profiledFunctions[1846]))(program,location,count,transpose,value);this->profiler.end(1846,profilingStart);}
+void m_glWindowPos4iMESA_profiling(GLint x,GLint y,GLint z,GLint w)const{auto const profilingStart=this->profiler.begin(1847);(this->*((FunctionTable::MEMBERPFNGLWINDOWPOS4IMESAPROC)this->m_profiledFunctions[1847]))(x,y,z,w);this->profiler.end(1847,profilingStart);}
+void m_glPixelTransferf_profiling(GLenum pname,GLfloat param)const{auto const profilingStart=this->profiler.begin(1848);(this->*((FunctionTable::MEMBERPFNGLPIXELTRANSFERFPROC)this->m_profiledFunctions[1848]))(pname,param);this->profiler.end(1848,profilingStart);}
+void m_glGetTextureParameterIuiv_profiling(GLuint texture,GLenum pname,GLuint* params)const{auto const profilingStart=this->profiler.begin(1849);(this->*((FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERIUIVPROC)this->m_profiledFunctions[1849]))(texture,pname,params);this->profiler.end(1849,profilingStart);}
+void m_glMultiTexCoord1xOES_profiling(GLenum texture,GLfixed s)const{auto const profilingStart=this->profiler.begin(1850);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD1XOESPROC)this->m_profiledFunctions[1850]))(texture,s);this->profiler.end(1850,profilingStart);}
+void m_glProgramUniformMatrix4dv_profiling(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{auto const profilingStart=this->profiler.begin(1851);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4DVPROC)this->m_profiledFunctions[1851]))(program,location,count,transpose,value);this->profiler.end(1851,profilingStart);}
+void m_glGetnUniformiv_profiling(GLuint program,GLint location,GLsizei bufSize,GLint* params)const{auto const profilingStart=this->profiler.begin(1852);(this->*((FunctionTable::MEMBERPFNGLGETNUNIFORMIVPROC)this->m_profiledFunctions[1852]))(program,location,bufSize,params);this->profiler.end(1852,profilingStart);}
+void m_glFramebufferTexture1DEXT_profiling(GLenum target,GLenum attachment,GLenum textarget,GLuint texture,GLint level)const{auto const profilingStart=this->profiler.begin(1853);(this->*((FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURE1DEXTPROC)this->m_profiledFunctions[1853]))(target,attachment,textarget,texture,level);this->profiler.end(1853,profilingStart);}
+void m_glVertexPointervINTEL_profiling(GLint size,GLenum type,const void** pointer)const{auto const profilingStart=this->profiler.begin(1854);(this->*((FunctionTable::MEMBERPFNGLVERTEXPOINTERVINTELPROC)this->m_profiledFunctions[1854]))(size,type,pointer);this->profiler.end(1854,profilingStart);}
+void m_glTextureParameterIiv_profiling(GLuint texture,GLenum pname,const GLint* params)const{auto const profilingStart=this->profiler.begin(1855);(this->*((FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIIVPROC)this->m_profiledFunctions[1855]))(texture,pname,params);this->profiler.end(1855,profilingStart);}
+void m_glGetSeparableFilterEXT_profiling(GLenum target,GLenum format,GLenum type,void* row,void* column,void* span)const{auto const profilingStart=this->profiler.begin(1856);(this->*((FunctionTable::MEMBERPFNGLGETSEPARABLEFILTEREXTPROC)this->m_profiledFunctions[1856]))(target,format,type,row,column,span);this->profiler.end(1856,profilingStart);}
+void m_glMultiTexCoord3iARB_profiling(GLenum target,GLint s,GLint t,GLint r)const{auto const profilingStart=this->profiler.begin(1857);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD3IARBPROC)this->m_profiledFunctions[1857]))(target,s,t,r);this->profiler.end(1857,profilingStart);}
+void m_glRasterPos4xvOES_profiling(const GLfixed* coords)const{auto const profilingStart=this->profiler.begin(1858);(this->*((FunctionTable::MEMBERPFNGLRASTERPOS4XVOESPROC)this->m_profiledFunctions[1858]))(coords);this->profiler.end(1858,profilingStart);}
+void m_glDrawTransformFeedbackStream_profiling(GLenum mode,GLuint id,GLuint stream)const{auto const profilingStart=this->profiler.begin(1859);(this->*((FunctionTable::MEMBERPFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC)this->m_profiledFunctions[1859]))(mode,id,stream);this->profiler.end(1859,profilingStart);}
+void m_glVertex3hvNV_profiling(const GLhalfNV* v)const{auto const profilingStart=this->profiler.begin(1860);(this->*((FunctionTable::MEMBERPFNGLVERTEX3HVNVPROC)this->m_profiledFunctions[1860]))(v);this->profiler.end(1860,profilingStart);}
+void m_glVertexArrayMultiTexCoordOffsetEXT_profiling(GLuint vaobj,GLuint buffer,GLenum texunit,GLint size,GLenum type,GLsizei stride,GLintptr offset)const{auto const profilingStart=this->profiler.begin(1861);(this->*((FunctionTable::MEMBERPFNGLVERTEXARRAYMULTITEXCOORDOFFSETEXTPROC)this->m_profiledFunctions[1861]))(vaobj,buffer,texunit,size,type,stride,offset);this->profiler.end(1861,profilingStart);}
+void m_glProvokingVertex_profiling(GLenum mode)const{auto const profilingStart=this->profiler.begin(1862);(this->*((FunctionTable::MEMBERPFNGLPROVOKINGVERTEXPROC)this->m_profiledFunctions[1862]))(mode);this->profiler.end(1862,profilingStart);}
+void m_glAccumxOES_profiling(GLenum op,GLfixed value)const{auto const profilingStart=this->profiler.begin(1863);(this->*((FunctionTable::MEMBERPFNGLACCUMXOESPROC)this->m_profiledFunctions[1863]))(op,value);this->profiler.end(1863,profilingStart);}
+void m_glShaderBinary_profiling(GLsizei count,const GLuint* shaders,GLenum binaryformat,const void* binary,GLsizei length)const{auto const profilingStart=this->profiler.begin(1864);(this->*((FunctionTable::MEMBERPFNGLSHADERBINARYPROC)this->m_profiledFunctions[1864]))(count,shaders,binaryformat,binary,length);this->profiler.end(1864,profilingStart);}
+void m_glGetMultiTexGenivEXT_profiling(GLenum texunit,GLenum coord,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(1865);(this->*((FunctionTable::MEMBERPFNGLGETMULTITEXGENIVEXTPROC)this->m_profiledFunctions[1865]))(texunit,coord,pname,params);this->profiler.end(1865,profilingStart);}
+void m_glPointParameterxvOES_profiling(GLenum pname,const GLfixed* params)const{auto const profilingStart=this->profiler.begin(1866);(this->*((FunctionTable::MEMBERPFNGLPOINTPARAMETERXVOESPROC)this->m_profiledFunctions[1866]))(pname,params);this->profiler.end(1866,profilingStart);}
+void m_glCreateStatesNV_profiling(GLsizei n,GLuint* states)const{auto const profilingStart=this->profiler.begin(1867);(this->*((FunctionTable::MEMBERPFNGLCREATESTATESNVPROC)this->m_profiledFunctions[1867]))(n,states);this->profiler.end(1867,profilingStart);}
+void m_glClearDepthdNV_profiling(GLdouble depth)const{auto const profilingStart=this->profiler.begin(1868);(this->*((FunctionTable::MEMBERPFNGLCLEARDEPTHDNVPROC)this->m_profiledFunctions[1868]))(depth);this->profiler.end(1868,profilingStart);}
+void m_glClearColorIuiEXT_profiling(GLuint red,GLuint green,GLuint blue,GLuint alpha)const{auto const profilingStart=this->profiler.begin(1869);(this->*((FunctionTable::MEMBERPFNGLCLEARCOLORIUIEXTPROC)this->m_profiledFunctions[1869]))(red,green,blue,alpha);this->profiler.end(1869,profilingStart);}
+void m_glBindMultiTextureEXT_profiling(GLenum texunit,GLenum target,GLuint texture)const{auto const profilingStart=this->profiler.begin(1870);(this->*((FunctionTable::MEMBERPFNGLBINDMULTITEXTUREEXTPROC)this->m_profiledFunctions[1870]))(texunit,target,texture);this->profiler.end(1870,profilingStart);}
+void m_glTexGeniv_profiling(GLenum coord,GLenum pname,const GLint* params)const{auto const profilingStart=this->profiler.begin(1871);(this->*((FunctionTable::MEMBERPFNGLTEXGENIVPROC)this->m_profiledFunctions[1871]))(coord,pname,params);this->profiler.end(1871,profilingStart);}
+void m_glDrawElements_profiling(GLenum mode,GLsizei count,GLenum type,const GLvoid* indices)const{auto const profilingStart=this->profiler.begin(1872);(this->*((FunctionTable::MEMBERPFNGLDRAWELEMENTSPROC)this->m_profiledFunctions[1872]))(mode,count,type,indices);this->profiler.end(1872,profilingStart);}
+void m_glProgramUniform4iv_profiling(GLuint program,GLint location,GLsizei count,const GLint* value)const{auto const profilingStart=this->profiler.begin(1873);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4IVPROC)this->m_profiledFunctions[1873]))(program,location,count,value);this->profiler.end(1873,profilingStart);}
+void m_glDisableVertexArrayEXT_profiling(GLuint vaobj,GLenum array)const{auto const profilingStart=this->profiler.begin(1874);(this->*((FunctionTable::MEMBERPFNGLDISABLEVERTEXARRAYEXTPROC)this->m_profiledFunctions[1874]))(vaobj,array);this->profiler.end(1874,profilingStart);}
+void m_glProgramUniform3ui64NV_profiling(GLuint program,GLint location,GLuint64EXT x,GLuint64EXT y,GLuint64EXT z)const{auto const profilingStart=this->profiler.begin(1875);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UI64NVPROC)this->m_profiledFunctions[1875]))(program,location,x,y,z);this->profiler.end(1875,profilingStart);}
+void m_glClientActiveTexture_profiling(GLenum texture)const{auto const profilingStart=this->profiler.begin(1876);(this->*((FunctionTable::MEMBERPFNGLCLIENTACTIVETEXTUREPROC)this->m_profiledFunctions[1876]))(texture);this->profiler.end(1876,profilingStart);}
+void m_glMultiTexParameterIivEXT_profiling(GLenum texunit,GLenum target,GLenum pname,const GLint* params)const{auto const profilingStart=this->profiler.begin(1877);(this->*((FunctionTable::MEMBERPFNGLMULTITEXPARAMETERIIVEXTPROC)this->m_profiledFunctions[1877]))(texunit,target,pname,params);this->profiler.end(1877,profilingStart);}
+void m_glUniform1i64ARB_profiling(GLint location,GLint64 x)const{auto const profilingStart=this->profiler.begin(1878);(this->*((FunctionTable::MEMBERPFNGLUNIFORM1I64ARBPROC)this->m_profiledFunctions[1878]))(location,x);this->profiler.end(1878,profilingStart);}
+void m_glUniform1iv_profiling(GLint location,GLsizei count,const GLint* value)const{auto const profilingStart=this->profiler.begin(1879);(this->*((FunctionTable::MEMBERPFNGLUNIFORM1IVPROC)this->m_profiledFunctions[1879]))(location,count,value);this->profiler.end(1879,profilingStart);}
+void m_glVertexAttribArrayObjectATI_profiling(GLuint index,GLint size,GLenum type,GLboolean normalized,GLsizei stride,GLuint buffer,GLuint offset)const{auto const profilingStart=this->profiler.begin(1880);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBARRAYOBJECTATIPROC)this->m_profiledFunctions[1880]))(index,size,type,normalized,stride,buffer,offset);this->profiler.end(1880,profilingStart);}
+void m_glUniform2iARB_profiling(GLint location,GLint v0,GLint v1)const{auto const profilingStart=this->profiler.begin(1881);(this->*((FunctionTable::MEMBERPFNGLUNIFORM2IARBPROC)this->m_profiledFunctions[1881]))(location,v0,v1);this->profiler.end(1881,profilingStart);}
+void m_glDrawArraysInstanced_profiling(GLenum mode,GLint first,GLsizei count,GLsizei instancecount)const{auto const profilingStart=this->profiler.begin(1882);(this->*((FunctionTable::MEMBERPFNGLDRAWARRAYSINSTANCEDPROC)this->m_profiledFunctions[1882]))(mode,first,count,instancecount);this->profiler.end(1882,profilingStart);}
+void m_glVertexAttrib2sNV_profiling(GLuint index,GLshort x,GLshort y)const{auto const profilingStart=this->profiler.begin(1883);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB2SNVPROC)this->m_profiledFunctions[1883]))(index,x,y);this->profiler.end(1883,profilingStart);}
+void m_glTexBufferEXT_profiling(GLenum target,GLenum internalformat,GLuint buffer)const{auto const profilingStart=this->profiler.begin(1884);(this->*((FunctionTable::MEMBERPFNGLTEXBUFFEREXTPROC)this->m_profiledFunctions[1884]))(target,internalformat,buffer);this->profiler.end(1884,profilingStart);}
+void m_glVertexStream2fATI_profiling(GLenum stream,GLfloat x,GLfloat y)const{auto const profilingStart=this->profiler.begin(1885);(this->*((FunctionTable::MEMBERPFNGLVERTEXSTREAM2FATIPROC)this->m_profiledFunctions[1885]))(stream,x,y);this->profiler.end(1885,profilingStart);}
+void m_glDebugMessageCallbackAMD_profiling(GLDEBUGPROCAMD callback,void* userParam)const{auto const profilingStart=this->profiler.begin(1886);(this->*((FunctionTable::MEMBERPFNGLDEBUGMESSAGECALLBACKAMDPROC)this->m_profiledFunctions[1886]))(callback,userParam);this->profiler.end(1886,profilingStart);}
+void m_glSamplerParameteriv_profiling(GLuint sampler,GLenum pname,const GLint* param)const{auto const profilingStart=this->profiler.begin(1887);(this->*((FunctionTable::MEMBERPFNGLSAMPLERPARAMETERIVPROC)this->m_profiledFunctions[1887]))(sampler,pname,param);this->profiler.end(1887,profilingStart);}
+void m_glVertexAttrib4uiv_profiling(GLuint index,const GLuint* v)const{auto const profilingStart=this->profiler.begin(1888);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB4UIVPROC)this->m_profiledFunctions[1888]))(index,v);this->profiler.end(1888,profilingStart);}
+void m_glEndQueryIndexed_profiling(GLenum target,GLuint index)const{auto const profilingStart=this->profiler.begin(1889);(this->*((FunctionTable::MEMBERPFNGLENDQUERYINDEXEDPROC)this->m_profiledFunctions[1889]))(target,index);this->profiler.end(1889,profilingStart);}
+void m_glNormalStream3sATI_profiling(GLenum stream,GLshort nx,GLshort ny,GLshort nz)const{auto const profilingStart=this->profiler.begin(1890);(this->*((FunctionTable::MEMBERPFNGLNORMALSTREAM3SATIPROC)this->m_profiledFunctions[1890]))(stream,nx,ny,nz);this->profiler.end(1890,profilingStart);}
+void m_glProgramParameteriARB_profiling(GLuint program,GLenum pname,GLint value)const{auto const profilingStart=this->profiler.begin(1891);(this->*((FunctionTable::MEMBERPFNGLPROGRAMPARAMETERIARBPROC)this->m_profiledFunctions[1891]))(program,pname,value);this->profiler.end(1891,profilingStart);}
+void m_glTexEnvxOES_profiling(GLenum target,GLenum pname,GLfixed param)const{auto const profilingStart=this->profiler.begin(1892);(this->*((FunctionTable::MEMBERPFNGLTEXENVXOESPROC)this->m_profiledFunctions[1892]))(target,pname,param);this->profiler.end(1892,profilingStart);}
+void m_glProgramUniform1iv_profiling(GLuint program,GLint location,GLsizei count,const GLint* value)const{auto const profilingStart=this->profiler.begin(1893);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1IVPROC)this->m_profiledFunctions[1893]))(program,location,count,value);this->profiler.end(1893,profilingStart);}
+void m_glDisableVertexAttribAPPLE_profiling(GLuint index,GLenum pname)const{auto const profilingStart=this->profiler.begin(1894);(this->*((FunctionTable::MEMBERPFNGLDISABLEVERTEXATTRIBAPPLEPROC)this->m_profiledFunctions[1894]))(index,pname);this->profiler.end(1894,profilingStart);}
+void m_glBindRenderbuffer_profiling(GLenum target,GLuint renderbuffer)const{auto const profilingStart=this->profiler.begin(1895);(this->*((FunctionTable::MEMBERPFNGLBINDRENDERBUFFERPROC)this->m_profiledFunctions[1895]))(target,renderbuffer);this->profiler.end(1895,profilingStart);}
+void m_glMultiTexSubImage3DEXT_profiling(GLenum texunit,GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLenum format,GLenum type,const void* pixels)const{auto const profilingStart=this->profiler.begin(1896);(this->*((FunctionTable::MEMBERPFNGLMULTITEXSUBIMAGE3DEXTPROC)this->m_profiledFunctions[1896]))(texunit,target,level,xoffset,yoffset,zoffset,width,height,depth,format,type,pixels);this->profiler.end(1896,profilingStart);}
+GLboolean m_glIsProgram_profiling(GLuint program)const{auto const profilingStart=this->profiler.begin(1897);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLISPROGRAMPROC)this->m_profiledFunctions[1897]))(program);this->profiler.end(1897,profilingStart);return profilingResult;}
+void m_glMultiDrawElementsIndirectAMD_profiling(GLenum mode,GLenum type,const void* indirect,GLsizei primcount,GLsizei stride)const{auto const profilingStart=this->profiler.begin(1898);(this->*((FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSINDIRECTAMDPROC)this->m_profiledFunctions[1898]))(mode,type,indirect,primcount,stride);this->profiler.end(1898,profilingStart);}
+void m_glGetProgramInfoLog_profiling(GLuint program,GLsizei bufSize,GLsizei* length,GLchar* infoLog)const{auto const profilingStart=this->profiler.begin(1899);(this->*((FunctionTable::MEMBERPFNGLGETPROGRAMINFOLOGPROC)this->m_profiledFunctions[1899]))(program,bufSize,length,infoLog);this->profiler.end(1899,profilingStart);}
+void m_glGetLocalConstantBooleanvEXT_profiling(GLuint id,GLenum value,GLboolean* data)const{auto const profilingStart=this->profiler.begin(1900);(this->*((FunctionTable::MEMBERPFNGLGETLOCALCONSTANTBOOLEANVEXTPROC)this->m_profiledFunctions[1900]))(id,value,data);this->profiler.end(1900,profilingStart);}
+void m_glPixelTransformParameteriEXT_profiling(GLenum target,GLenum pname,GLint param)const{auto const profilingStart=this->profiler.begin(1901);(this->*((FunctionTable::MEMBERPFNGLPIXELTRANSFORMPARAMETERIEXTPROC)this->m_profiledFunctions[1901]))(target,pname,param);this->profiler.end(1901,profilingStart);}
+void m_glTexCoord4bOES_profiling(GLbyte s,GLbyte t,GLbyte r,GLbyte q)const{auto const profilingStart=this->profiler.begin(1902);(this->*((FunctionTable::MEMBERPFNGLTEXCOORD4BOESPROC)this->m_profiledFunctions[1902]))(s,t,r,q);this->profiler.end(1902,profilingStart);}
+void m_glVertexAttrib4fv_profiling(GLuint index,const GLfloat* v)const{auto const profilingStart=this->profiler.begin(1903);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB4FVPROC)this->m_profiledFunctions[1903]))(index,v);this->profiler.end(1903,profilingStart);}
+void m_glProgramUniformMatrix2x3dv_profiling(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{auto const profilingStart=this->profiler.begin(1904);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X3DVPROC)this->m_profiledFunctions[1904]))(program,location,count,transpose,value);this->profiler.end(1904,profilingStart);}
+void m_glProgramEnvParametersI4uivNV_profiling(GLenum target,GLuint index,GLsizei count,const GLuint* params)const{auto const profilingStart=this->profiler.begin(1905);(this->*((FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERSI4UIVNVPROC)this->m_profiledFunctions[1905]))(target,index,count,params);this->profiler.end(1905,profilingStart);}
+void m_glTexCoord3xOES_profiling(GLfixed s,GLfixed t,GLfixed r)const{auto const profilingStart=this->profiler.begin(1906);(this->*((FunctionTable::MEMBERPFNGLTEXCOORD3XOESPROC)this->m_profiledFunctions[1906]))(s,t,r);this->profiler.end(1906,profilingStart);}
+void m_glLoadTransposeMatrixfARB_profiling(const GLfloat* m)const{auto const profilingStart=this->profiler.begin(1907);(this->*((FunctionTable::MEMBERPFNGLLOADTRANSPOSEMATRIXFARBPROC)this->m_profiledFunctions[1907]))(m);this->profiler.end(1907,profilingStart);}
+void m_glImageTransformParameteriHP_profiling(GLenum target,GLenum pname,GLint param)const{auto const profilingStart=this->profiler.begin(1908);(this->*((FunctionTable::MEMBERPFNGLIMAGETRANSFORMPARAMETERIHPPROC)this->m_profiledFunctions[1908]))(target,pname,param);this->profiler.end(1908,profilingStart);}
+void m_glMultiTexCoord4xOES_profiling(GLenum texture,GLfixed s,GLfixed t,GLfixed r,GLfixed q)const{auto const profilingStart=this->profiler.begin(1909);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD4XOESPROC)this->m_profiledFunctions[1909]))(texture,s,t,r,q);this->profiler.end(1909,profilingStart);}
+void m_glVertexAttribs3fvNV_profiling(GLuint index,GLsizei count,const GLfloat* v)const{auto const profilingStart=this->profiler.begin(1910);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBS3FVNVPROC)this->m_profiledFunctions[1910]))(index,count,v);this->profiler.end(1910,profilingStart);}
+void m_glVertexAttrib2fv_profiling(GLuint index,const GLfloat* v)const{auto const profilingStart=this->profiler.begin(1911);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB2FVPROC)this->m_profiledFunctions[1911]))(index,v);this->profiler.end(1911,profilingStart);}
+void m_glUniform3ui64NV_profiling(GLint location,GLuint64EXT x,GLuint64EXT y,GLuint64EXT z)const{auto const profilingStart=this->profiler.begin(1912);(this->*((FunctionTable::MEMBERPFNGLUNIFORM3UI64NVPROC)this->m_profiledFunctions[1912]))(location,x,y,z);this->profiler.end(1912,profilingStart);}
+void m_glCombinerParameterfvNV_profiling(GLenum pname,const GLfloat* params)const{auto const profilingStart=this->profiler.begin(1913);(this->*((FunctionTable::MEMBERPFNGLCOMBINERPARAMETERFVNVPROC)this->m_profiledFunctions[1913]))(pname,params);this->profiler.end(1913,profilingStart);}
+void m_glFragmentMaterialiSGIX_profiling(GLenum face,GLenum pname,GLint param)const{auto const profilingStart=this->profiler.begin(1914);(this->*((FunctionTable::MEMBERPFNGLFRAGMENTMATERIALISGIXPROC)this->m_profiledFunctions[1914]))(face,pname,param);this->profiler.end(1914,profilingStart);}
+void m_glGetBooleani_v_profiling(GLenum target,GLuint index,GLboolean* data)const{auto const profilingStart=this->profiler.begin(1915);(this->*((FunctionTable::MEMBERPFNGLGETBOOLEANI_VPROC)this->m_profiledFunctions[1915]))(target,index,data);this->profiler.end(1915,profilingStart);}
+GLuint m_glGetProgramResourceIndex_profiling(GLuint program,GLenum programInterface,const GLchar* name)const{auto const profilingStart=this->profiler.begin(1916);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLGETPROGRAMRESOURCEINDEXPROC)this->m_profiledFunctions[1916]))(program,programInterface,name);this->profiler.end(1916,profilingStart);return profilingResult;}
+void m_glBeginConditionalRenderNV_profiling(GLuint id,GLenum mode)const{auto const profilingStart=this->profiler.begin(1917);(this->*((FunctionTable::MEMBERPFNGLBEGINCONDITIONALRENDERNVPROC)this->m_profiledFunctions[1917]))(id,mode);this->profiler.end(1917,profilingStart);}
+void m_glDisableClientState_profiling(GLenum cap)const{auto const profilingStart=this->profiler.begin(1918);(this->*((FunctionTable::MEMBERPFNGLDISABLECLIENTSTATEPROC)this->m_profiledFunctions[1918]))(cap);this->profiler.end(1918,profilingStart);}
+void m_glPathFogGenNV_profiling(GLenum genMode)const{auto const profilingStart=this->profiler.begin(1919);(this->*((FunctionTable::MEMBERPFNGLPATHFOGGENNVPROC)this->m_profiledFunctions[1919]))(genMode);this->profiler.end(1919,profilingStart);}
+void m_glStencilThenCoverFillPathNV_profiling(GLuint path,GLenum fillMode,GLuint mask,GLenum coverMode)const{auto const profilingStart=this->profiler.begin(1920);(this->*((FunctionTable::MEMBERPFNGLSTENCILTHENCOVERFILLPATHNVPROC)this->m_profiledFunctions[1920]))(path,fillMode,mask,coverMode);this->profiler.end(1920,profilingStart);}
+void m_glVertexArrayIndexOffsetEXT_profiling(GLuint vaobj,GLuint buffer,GLenum type,GLsizei stride,GLintptr offset)const{auto const profilingStart=this->profiler.begin(1921);(this->*((FunctionTable::MEMBERPFNGLVERTEXARRAYINDEXOFFSETEXTPROC)this->m_profiledFunctions[1921]))(vaobj,buffer,type,stride,offset);this->profiler.end(1921,profilingStart);}
+void m_glProgramBufferParametersIuivNV_profiling(GLenum target,GLuint bindingIndex,GLuint wordIndex,GLsizei count,const GLuint* params)const{auto const profilingStart=this->profiler.begin(1922);(this->*((FunctionTable::MEMBERPFNGLPROGRAMBUFFERPARAMETERSIUIVNVPROC)this->m_profiledFunctions[1922]))(target,bindingIndex,wordIndex,count,params);this->profiler.end(1922,profilingStart);}
+void m_glPixelTransformParameterivEXT_profiling(GLenum target,GLenum pname,const GLint* params)const{auto const profilingStart=this->profiler.begin(1923);(this->*((FunctionTable::MEMBERPFNGLPIXELTRANSFORMPARAMETERIVEXTPROC)this->m_profiledFunctions[1923]))(target,pname,params);this->profiler.end(1923,profilingStart);}
+void m_glDisableClientStateiEXT_profiling(GLenum array,GLuint index)const{auto const profilingStart=this->profiler.begin(1924);(this->*((FunctionTable::MEMBERPFNGLDISABLECLIENTSTATEIEXTPROC)this->m_profiledFunctions[1924]))(array,index);this->profiler.end(1924,profilingStart);}
+void m_glTexBufferARB_profiling(GLenum target,GLenum internalformat,GLuint buffer)const{auto const profilingStart=this->profiler.begin(1925);(this->*((FunctionTable::MEMBERPFNGLTEXBUFFERARBPROC)this->m_profiledFunctions[1925]))(target,internalformat,buffer);this->profiler.end(1925,profilingStart);}
+void m_glGetLocalConstantIntegervEXT_profiling(GLuint id,GLenum value,GLint* data)const{auto const profilingStart=this->profiler.begin(1926);(this->*((FunctionTable::MEMBERPFNGLGETLOCALCONSTANTINTEGERVEXTPROC)this->m_profiledFunctions[1926]))(id,value,data);this->profiler.end(1926,profilingStart);}
+void m_glColor4uiv_profiling(const GLuint* v)const{auto const profilingStart=this->profiler.begin(1927);(this->*((FunctionTable::MEMBERPFNGLCOLOR4UIVPROC)this->m_profiledFunctions[1927]))(v);this->profiler.end(1927,profilingStart);}
+void m_glProgramUniform3i_profiling(GLuint program,GLint location,GLint v0,GLint v1,GLint v2)const{auto const profilingStart=this->profiler.begin(1928);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3IPROC)this->m_profiledFunctions[1928]))(program,location,v0,v1,v2);this->profiler.end(1928,profilingStart);}
+void m_glMultiDrawElementsIndirectBindlessCountNV_profiling(GLenum mode,GLenum type,const void* indirect,GLsizei drawCount,GLsizei maxDrawCount,GLsizei stride,GLint vertexBufferCount)const{auto const profilingStart=this->profiler.begin(1929);(this->*((FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSINDIRECTBINDLESSCOUNTNVPROC)this->m_profiledFunctions[1929]))(mode,type,indirect,drawCount,maxDrawCount,stride,vertexBufferCount);this->profiler.end(1929,profilingStart);}
+void m_glGetBufferPointervARB_profiling(GLenum target,GLenum pname,void** params)const{auto const profilingStart=this->profiler.begin(1930);(this->*((FunctionTable::MEMBERPFNGLGETBUFFERPOINTERVARBPROC)this->m_profiledFunctions[1930]))(target,pname,params);this->profiler.end(1930,profilingStart);}
+void m_glMultiTexParameterIuivEXT_profiling(GLenum texunit,GLenum target,GLenum pname,const GLuint* params)const{auto const profilingStart=this->profiler.begin(1931);(this->*((FunctionTable::MEMBERPFNGLMULTITEXPARAMETERIUIVEXTPROC)this->m_profiledFunctions[1931]))(texunit,target,pname,params);this->profiler.end(1931,profilingStart);}
+void m_glEvalMesh2_profiling(GLenum mode,GLint i1,GLint i2,GLint j1,GLint j2)const{auto const profilingStart=this->profiler.begin(1932);(this->*((FunctionTable::MEMBERPFNGLEVALMESH2PROC)this->m_profiledFunctions[1932]))(mode,i1,i2,j1,j2);this->profiler.end(1932,profilingStart);}
+void m_glEvalMesh1_profiling(GLenum mode,GLint i1,GLint i2)const{auto const profilingStart=this->profiler.begin(1933);(this->*((FunctionTable::MEMBERPFNGLEVALMESH1PROC)this->m_profiledFunctions[1933]))(mode,i1,i2);this->profiler.end(1933,profilingStart);}
+void m_glProgramUniform3f_profiling(GLuint program,GLint location,GLfloat v0,GLfloat v1,GLfloat v2)const{auto const profilingStart=this->profiler.begin(1934);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3FPROC)this->m_profiledFunctions[1934]))(program,location,v0,v1,v2);this->profiler.end(1934,profilingStart);}
+void m_glStencilThenCoverFillPathInstancedNV_profiling(GLsizei numPaths,GLenum pathNameType,const void* paths,GLuint pathBase,GLenum fillMode,GLuint mask,GLenum coverMode,GLenum transformType,const GLfloat* transformValues)const{auto const profilingStart=this->profiler.begin(1935);(this->*((FunctionTable::MEMBERPFNGLSTENCILTHENCOVERFILLPATHINSTANCEDNVPROC)this->m_profiledFunctions[1935]))(numPaths,pathNameType,paths,pathBase,fillMode,mask,coverMode,transformType,transformValues);this->profiler.end(1935,profilingStart);}
+void m_glProgramUniform3d_profiling(GLuint program,GLint location,GLdouble v0,GLdouble v1,GLdouble v2)const{auto const profilingStart=this->profiler.begin(1936);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3DPROC)this->m_profiledFunctions[1936]))(program,location,v0,v1,v2);this->profiler.end(1936,profilingStart);}
+void m_glMapVertexAttrib1dAPPLE_profiling(GLuint index,GLuint size,GLdouble u1,GLdouble u2,GLint stride,GLint order,const GLdouble* points)const{auto const profilingStart=this->profiler.begin(1937);(this->*((FunctionTable::MEMBERPFNGLMAPVERTEXATTRIB1DAPPLEPROC)this->m_profiledFunctions[1937]))(index,size,u1,u2,stride,order,points);this->profiler.end(1937,profilingStart);}
+void m_glEvalCoord2fv_profiling(const GLfloat* u)const{auto const profilingStart=this->profiler.begin(1938);(this->*((FunctionTable::MEMBERPFNGLEVALCOORD2FVPROC)this->m_profiledFunctions[1938]))(u);this->profiler.end(1938,profilingStart);}
+void m_glGetUniformivARB_profiling(GLhandleARB programObj,GLint location,GLint* params)const{auto const profilingStart=this->profiler.begin(1939);(this->*((FunctionTable::MEMBERPFNGLGETUNIFORMIVARBPROC)this->m_profiledFunctions[1939]))(programObj,location,params);this->profiler.end(1939,profilingStart);}
+void m_glLoadTransposeMatrixd_profiling(const GLdouble m[16])const{auto const profilingStart=this->profiler.begin(1940);(this->*((FunctionTable::MEMBERPFNGLLOADTRANSPOSEMATRIXDPROC)this->m_profiledFunctions[1940]))(m);this->profiler.end(1940,profilingStart);}
+void m_glLoadTransposeMatrixf_profiling(const GLfloat m[16])const{auto const profilingStart=this->profiler.begin(1941);(this->*((FunctionTable::MEMBERPFNGLLOADTRANSPOSEMATRIXFPROC)this->m_profiledFunctions[1941]))(m);this->profiler.end(1941,profilingStart);}
+void m_glGetPointervEXT_profiling(GLenum pname,void** params)const{auto const profilingStart=this->profiler.begin(1942);(this->*((FunctionTable::MEMBERPFNGLGETPOINTERVEXTPROC)this->m_profiledFunctions[1942]))(pname,params);this->profiler.end(1942,profilingStart);}
+void m_glEndConditionalRenderNV_profiling()const{auto const profilingStart=this->profiler.begin(1943);(this->*((FunctionTable::MEMBERPFNGLENDCONDITIONALRENDERNVPROC)this->m_profiledFunctions[1943]))();this->profiler.end(1943,profilingStart);}
+void m_glTexCoord2fNormal3fVertex3fSUN_profiling(GLfloat s,GLfloat t,GLfloat nx,GLfloat ny,GLfloat nz,GLfloat x,GLfloat y,GLfloat z)const{auto const profilingStart=this->profiler.begin(1944);(this->*((FunctionTable::MEMBERPFNGLTEXCOORD2FNORMAL3FVERTEX3FSUNPROC)this->m_profiledFunctions[1944]))(s,t,nx,ny,nz,x,y,z);this->profiler.end(1944,profilingStart);}
+void m_glUniform3i64vARB_profiling(GLint location,GLsizei count,const GLint64* value)const{auto const profilingStart=this->profiler.begin(1945);(this->*((FunctionTable::MEMBERPFNGLUNIFORM3I64VARBPROC)this->m_profiledFunctions[1945]))(location,count,value);this->profiler.end(1945,profilingStart);}
+void m_glProgramUniform2uiEXT_profiling(GLuint program,GLint location,GLuint v0,GLuint v1)const{auto const profilingStart=this->profiler.begin(1946);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UIEXTPROC)this->m_profiledFunctions[1946]))(program,location,v0,v1);this->profiler.end(1946,profilingStart);}
+void m_glVertexAttribI1ui_profiling(GLuint index,GLuint x)const{auto const profilingStart=this->profiler.begin(1947);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBI1UIPROC)this->m_profiledFunctions[1947]))(index,x);this->profiler.end(1947,profilingStart);}
+void m_glProgramNamedParameter4dvNV_profiling(GLuint id,GLsizei len,const GLubyte* name,const GLdouble* v)const{auto const profilingStart=this->profiler.begin(1948);(this->*((FunctionTable::MEMBERPFNGLPROGRAMNAMEDPARAMETER4DVNVPROC)this->m_profiledFunctions[1948]))(id,len,name,v);this->profiler.end(1948,profilingStart);}
+void m_glCompileCommandListNV_profiling(GLuint list)const{auto const profilingStart=this->profiler.begin(1949);(this->*((FunctionTable::MEMBERPFNGLCOMPILECOMMANDLISTNVPROC)this->m_profiledFunctions[1949]))(list);this->profiler.end(1949,profilingStart);}
+void m_glGetRenderbufferParameterivEXT_profiling(GLenum target,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(1950);(this->*((FunctionTable::MEMBERPFNGLGETRENDERBUFFERPARAMETERIVEXTPROC)this->m_profiledFunctions[1950]))(target,pname,params);this->profiler.end(1950,profilingStart);}
+void m_glGetnPolygonStipple_profiling(GLsizei bufSize,GLubyte* pattern)const{auto const profilingStart=this->profiler.begin(1951);(this->*((FunctionTable::MEMBERPFNGLGETNPOLYGONSTIPPLEPROC)this->m_profiledFunctions[1951]))(bufSize,pattern);this->profiler.end(1951,profilingStart);}
+GLboolean m_glIsBufferResidentNV_profiling(GLenum target)const{auto const profilingStart=this->profiler.begin(1952);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLISBUFFERRESIDENTNVPROC)this->m_profiledFunctions[1952]))(target);this->profiler.end(1952,profilingStart);return profilingResult;}
+void m_glSecondaryColor3ubvEXT_profiling(const GLubyte* v)const{auto const profilingStart=this->profiler.begin(1953);(this->*((FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UBVEXTPROC)this->m_profiledFunctions[1953]))(v);this->profiler.end(1953,profilingStart);}
+void m_glGetNamedRenderbufferParameterivEXT_profiling(GLuint renderbuffer,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(1954);(this->*((FunctionTable::MEMBERPFNGLGETNAMEDRENDERBUFFERPARAMETERIVEXTPROC)this->m_profiledFunctions[1954]))(renderbuffer,pname,params);this->profiler.end(1954,profilingStart);}
+void m_glNamedFramebufferSampleLocationsfvARB_profiling(GLuint framebuffer,GLuint start,GLsizei count,const GLfloat* v)const{auto const profilingStart=this->profiler.begin(1955);(this->*((FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERSAMPLELOCATIONSFVARBPROC)this->m_profiledFunctions[1955]))(framebuffer,start,count,v);this->profiler.end(1955,profilingStart);}
+void m_glMultiTexGendvEXT_profiling(GLenum texunit,GLenum coord,GLenum pname,const GLdouble* params)const{auto const profilingStart=this->profiler.begin(1956);(this->*((FunctionTable::MEMBERPFNGLMULTITEXGENDVEXTPROC)this->m_profiledFunctions[1956]))(texunit,coord,pname,params);this->profiler.end(1956,profilingStart);}
+void m_glVertexArrayRangeNV_profiling(GLsizei length,const void* pointer)const{auto const profilingStart=this->profiler.begin(1957);(this->*((FunctionTable::MEMBERPFNGLVERTEXARRAYRANGENVPROC)this->m_profiledFunctions[1957]))(length,pointer);this->profiler.end(1957,profilingStart);}
+GLboolean m_glIsTextureHandleResidentNV_profiling(GLuint64 handle)const{auto const profilingStart=this->profiler.begin(1958);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLISTEXTUREHANDLERESIDENTNVPROC)this->m_profiledFunctions[1958]))(handle);this->profiler.end(1958,profilingStart);return profilingResult;}
+void m_glGetProgramEnvParameterdvARB_profiling(GLenum target,GLuint index,GLdouble* params)const{auto const profilingStart=this->profiler.begin(1959);(this->*((FunctionTable::MEMBERPFNGLGETPROGRAMENVPARAMETERDVARBPROC)this->m_profiledFunctions[1959]))(target,index,params);this->profiler.end(1959,profilingStart);}
+GLboolean m_glIsNamedStringARB_profiling(GLint namelen,const GLchar* name)const{auto const profilingStart=this->profiler.begin(1960);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLISNAMEDSTRINGARBPROC)this->m_profiledFunctions[1960]))(namelen,name);this->profiler.end(1960,profilingStart);return profilingResult;}
+void m_glSecondaryColorFormatNV_profiling(GLint size,GLenum type,GLsizei stride)const{auto const profilingStart=this->profiler.begin(1961);(this->*((FunctionTable::MEMBERPFNGLSECONDARYCOLORFORMATNVPROC)this->m_profiledFunctions[1961]))(size,type,stride);this->profiler.end(1961,profilingStart);}
+void m_glVertexAttrib4ubvNV_profiling(GLuint index,const GLubyte* v)const{auto const profilingStart=this->profiler.begin(1962);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB4UBVNVPROC)this->m_profiledFunctions[1962]))(index,v);this->profiler.end(1962,profilingStart);}
+void m_glTagSampleBufferSGIX_profiling()const{auto const profilingStart=this->profiler.begin(1963);(this->*((FunctionTable::MEMBERPFNGLTAGSAMPLEBUFFERSGIXPROC)this->m_profiledFunctions[1963]))();this->profiler.end(1963,profilingStart);}
+void m_glVDPAUUnregisterSurfaceNV_profiling(GLvdpauSurfaceNV surface)const{auto const profilingStart=this->profiler.begin(1964);(this->*((FunctionTable::MEMBERPFNGLVDPAUUNREGISTERSURFACENVPROC)this->m_profiledFunctions[1964]))(surface);this->profiler.end(1964,profilingStart);}
+void m_glGetPerfQueryIdByNameINTEL_profiling(GLchar* queryName,GLuint* queryId)const{auto const profilingStart=this->profiler.begin(1965);(this->*((FunctionTable::MEMBERPFNGLGETPERFQUERYIDBYNAMEINTELPROC)this->m_profiledFunctions[1965]))(queryName,queryId);this->profiler.end(1965,profilingStart);}
+void m_glGetInteger64v_profiling(GLenum pname,GLint64* data)const{auto const profilingStart=this->profiler.begin(1966);(this->*((FunctionTable::MEMBERPFNGLGETINTEGER64VPROC)this->m_profiledFunctions[1966]))(pname,data);this->profiler.end(1966,profilingStart);}
+void m_glClipPlane_profiling(GLenum plane,const GLdouble* equation)const{auto const profilingStart=this->profiler.begin(1967);(this->*((FunctionTable::MEMBERPFNGLCLIPPLANEPROC)this->m_profiledFunctions[1967]))(plane,equation);this->profiler.end(1967,profilingStart);}
+void m_glColor4ubVertex3fSUN_profiling(GLubyte r,GLubyte g,GLubyte b,GLubyte a,GLfloat x,GLfloat y,GLfloat z)const{auto const profilingStart=this->profiler.begin(1968);(this->*((FunctionTable::MEMBERPFNGLCOLOR4UBVERTEX3FSUNPROC)this->m_profiledFunctions[1968]))(r,g,b,a,x,y,z);this->profiler.end(1968,profilingStart);}
+void m_glIndexub_profiling(GLubyte c)const{auto const profilingStart=this->profiler.begin(1969);(this->*((FunctionTable::MEMBERPFNGLINDEXUBPROC)this->m_profiledFunctions[1969]))(c);this->profiler.end(1969,profilingStart);}
+void m_glGetProgramEnvParameterfvARB_profiling(GLenum target,GLuint index,GLfloat* params)const{auto const profilingStart=this->profiler.begin(1970);(this->*((FunctionTable::MEMBERPFNGLGETPROGRAMENVPARAMETERFVARBPROC)this->m_profiledFunctions[1970]))(target,index,params);this->profiler.end(1970,profilingStart);}
+void m_glVertexAttrib4usvARB_profiling(GLuint index,const GLushort* v)const{auto const profilingStart=this->profiler.begin(1971);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB4USVARBPROC)this->m_profiledFunctions[1971]))(index,v);this->profiler.end(1971,profilingStart);}
+void m_glNamedFramebufferRenderbuffer_profiling(GLuint framebuffer,GLenum attachment,GLenum renderbuffertarget,GLuint renderbuffer)const{auto const profilingStart=this->profiler.begin(1972);(this->*((FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC)this->m_profiledFunctions[1972]))(framebuffer,attachment,renderbuffertarget,renderbuffer);this->profiler.end(1972,profilingStart);}
+void m_glProgramUniformMatrix3x4dv_profiling(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{auto const profilingStart=this->profiler.begin(1973);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X4DVPROC)this->m_profiledFunctions[1973]))(program,location,count,transpose,value);this->profiler.end(1973,profilingStart);}
+GLboolean m_glTestFenceAPPLE_profiling(GLuint fence)const{auto const profilingStart=this->profiler.begin(1974);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLTESTFENCEAPPLEPROC)this->m_profiledFunctions[1974]))(fence);this->profiler.end(1974,profilingStart);return profilingResult;}
+void m_glVertexAttrib4Niv_profiling(GLuint index,const GLint* v)const{auto const profilingStart=this->profiler.begin(1975);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB4NIVPROC)this->m_profiledFunctions[1975]))(index,v);this->profiler.end(1975,profilingStart);}
+void m_glVertexAttribL2i64vNV_profiling(GLuint index,const GLint64EXT* v)const{auto const profilingStart=this->profiler.begin(1976);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBL2I64VNVPROC)this->m_profiledFunctions[1976]))(index,v);this->profiler.end(1976,profilingStart);}
+void m_glColorP4uiv_profiling(GLenum type,const GLuint* color)const{auto const profilingStart=this->profiler.begin(1977);(this->*((FunctionTable::MEMBERPFNGLCOLORP4UIVPROC)this->m_profiledFunctions[1977]))(type,color);this->profiler.end(1977,profilingStart);}
+void m_glUniformMatrix2x3fv_profiling(GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{auto const profilingStart=this->profiler.begin(1978);(this->*((FunctionTable::MEMBERPFNGLUNIFORMMATRIX2X3FVPROC)this->m_profiledFunctions[1978]))(location,count,transpose,value);this->profiler.end(1978,profilingStart);}
+void m_glCallCommandListNV_profiling(GLuint list)const{auto const profilingStart=this->profiler.begin(1979);(this->*((FunctionTable::MEMBERPFNGLCALLCOMMANDLISTNVPROC)this->m_profiledFunctions[1979]))(list);this->profiler.end(1979,profilingStart);}
+void m_glClearBufferiv_profiling(GLenum buffer,GLint drawbuffer,const GLint* value)const{auto const profilingStart=this->profiler.begin(1980);(this->*((FunctionTable::MEMBERPFNGLCLEARBUFFERIVPROC)this->m_profiledFunctions[1980]))(buffer,drawbuffer,value);this->profiler.end(1980,profilingStart);}
+void m_glNamedStringARB_profiling(GLenum type,GLint namelen,const GLchar* name,GLint stringlen,const GLchar* string)const{auto const profilingStart=this->profiler.begin(1981);(this->*((FunctionTable::MEMBERPFNGLNAMEDSTRINGARBPROC)this->m_profiledFunctions[1981]))(type,namelen,name,stringlen,string);this->profiler.end(1981,profilingStart);}
+void m_glMatrixMult3x2fNV_profiling(GLenum matrixMode,const GLfloat* m)const{auto const profilingStart=this->profiler.begin(1982);(this->*((FunctionTable::MEMBERPFNGLMATRIXMULT3X2FNVPROC)this->m_profiledFunctions[1982]))(matrixMode,m);this->profiler.end(1982,profilingStart);}
+void m_glGetNamedProgramStringEXT_profiling(GLuint program,GLenum target,GLenum pname,void* string)const{auto const profilingStart=this->profiler.begin(1983);(this->*((FunctionTable::MEMBERPFNGLGETNAMEDPROGRAMSTRINGEXTPROC)this->m_profiledFunctions[1983]))(program,target,pname,string);this->profiler.end(1983,profilingStart);}
+void m_glGetnHistogramARB_profiling(GLenum target,GLboolean reset,GLenum format,GLenum type,GLsizei bufSize,void* values)const{auto const profilingStart=this->profiler.begin(1984);(this->*((FunctionTable::MEMBERPFNGLGETNHISTOGRAMARBPROC)this->m_profiledFunctions[1984]))(target,reset,format,type,bufSize,values);this->profiler.end(1984,profilingStart);}
+void m_glGetTextureLevelParameterfv_profiling(GLuint texture,GLint level,GLenum pname,GLfloat* params)const{auto const profilingStart=this->profiler.begin(1985);(this->*((FunctionTable::MEMBERPFNGLGETTEXTURELEVELPARAMETERFVPROC)this->m_profiledFunctions[1985]))(texture,level,pname,params);this->profiler.end(1985,profilingStart);}
+void m_glMultiTexCoord1fv_profiling(GLenum target,const GLfloat* v)const{auto const profilingStart=this->profiler.begin(1986);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD1FVPROC)this->m_profiledFunctions[1986]))(target,v);this->profiler.end(1986,profilingStart);}
+void m_glBitmapxOES_profiling(GLsizei width,GLsizei height,GLfixed xorig,GLfixed yorig,GLfixed xmove,GLfixed ymove,const GLubyte* bitmap)const{auto const profilingStart=this->profiler.begin(1987);(this->*((FunctionTable::MEMBERPFNGLBITMAPXOESPROC)this->m_profiledFunctions[1987]))(width,height,xorig,yorig,xmove,ymove,bitmap);this->profiler.end(1987,profilingStart);}
+void m_glGetSamplerParameterIuiv_profiling(GLuint sampler,GLenum pname,GLuint* params)const{auto const profilingStart=this->profiler.begin(1988);(this->*((FunctionTable::MEMBERPFNGLGETSAMPLERPARAMETERIUIVPROC)this->m_profiledFunctions[1988]))(sampler,pname,params);this->profiler.end(1988,profilingStart);}
+void m_glTexCoordP3ui_profiling(GLenum type,GLuint coords)const{auto const profilingStart=this->profiler.begin(1989);(this->*((FunctionTable::MEMBERPFNGLTEXCOORDP3UIPROC)this->m_profiledFunctions[1989]))(type,coords);this->profiler.end(1989,profilingStart);}
+void m_glTextureSubImage1D_profiling(GLuint texture,GLint level,GLint xoffset,GLsizei width,GLenum format,GLenum type,const void* pixels)const{auto const profilingStart=this->profiler.begin(1990);(this->*((FunctionTable::MEMBERPFNGLTEXTURESUBIMAGE1DPROC)this->m_profiledFunctions[1990]))(texture,level,xoffset,width,format,type,pixels);this->profiler.end(1990,profilingStart);}
+void m_glVertexAttribLPointerEXT_profiling(GLuint index,GLint size,GLenum type,GLsizei stride,const void* pointer)const{auto const profilingStart=this->profiler.begin(1991);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBLPOINTEREXTPROC)this->m_profiledFunctions[1991]))(index,size,type,stride,pointer);this->profiler.end(1991,profilingStart);}
+void m_glFogCoordPointerEXT_profiling(GLenum type,GLsizei stride,const void* pointer)const{auto const profilingStart=this->profiler.begin(1992);(this->*((FunctionTable::MEMBERPFNGLFOGCOORDPOINTEREXTPROC)this->m_profiledFunctions[1992]))(type,stride,pointer);this->profiler.end(1992,profilingStart);}
+void m_glWindowPos3s_profiling(GLshort x,GLshort y,GLshort z)const{auto const profilingStart=this->profiler.begin(1993);(this->*((FunctionTable::MEMBERPFNGLWINDOWPOS3SPROC)this->m_profiledFunctions[1993]))(x,y,z);this->profiler.end(1993,profilingStart);}
+void m_glVertexAttribs2svNV_profiling(GLuint index,GLsizei count,const GLshort* v)const{auto const profilingStart=this->profiler.begin(1994);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBS2SVNVPROC)this->m_profiledFunctions[1994]))(index,count,v);this->profiler.end(1994,profilingStart);}
+void m_glTextureImage3DEXT_profiling(GLuint texture,GLenum target,GLint level,GLint internalformat,GLsizei width,GLsizei height,GLsizei depth,GLint border,GLenum format,GLenum type,const void* pixels)const{auto const profilingStart=this->profiler.begin(1995);(this->*((FunctionTable::MEMBERPFNGLTEXTUREIMAGE3DEXTPROC)this->m_profiledFunctions[1995]))(texture,target,level,internalformat,width,height,depth,border,format,type,pixels);this->profiler.end(1995,profilingStart);}
+void m_glWindowPos3i_profiling(GLint x,GLint y,GLint z)const{auto const profilingStart=this->profiler.begin(1996);(this->*((FunctionTable::MEMBERPFNGLWINDOWPOS3IPROC)this->m_profiledFunctions[1996]))(x,y,z);this->profiler.end(1996,profilingStart);}
+void m_glWindowPos3d_profiling(GLdouble x,GLdouble y,GLdouble z)const{auto const profilingStart=this->profiler.begin(1997);(this->*((FunctionTable::MEMBERPFNGLWINDOWPOS3DPROC)this->m_profiledFunctions[1997]))(x,y,z);this->profiler.end(1997,profilingStart);}
+void m_glWindowPos3f_profiling(GLfloat x,GLfloat y,GLfloat z)const{auto const profilingStart=this->profiler.begin(1998);(this->*((FunctionTable::MEMBERPFNGLWINDOWPOS3FPROC)this->m_profiledFunctions[1998]))(x,y,z);this->profiler.end(1998,profilingStart);}
+GLboolean m_glIsEnabledIndexedEXT_profiling(GLenum target,GLuint index)const{auto const profilingStart=this->profiler.begin(1999);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLISENABLEDINDEXEDEXTPROC)this->m_profiledFunctions[1999]))(target,index);this->profiler.end(1999,profilingStart);return profilingResult;}
+void m_glGetNamedProgramivEXT_profiling(GLuint program,GLenum target,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(2000);(this->*((FunctionTable::MEMBERPFNGLGETNAMEDPROGRAMIVEXTPROC)this->m_profiledFunctions[2000]))(program,target,pname,params);this->profiler.end(2000,profilingStart);}
+void m_glVertex3xvOES_profiling(const GLfixed* coords)const{auto const profilingStart=this->profiler.begin(2001);(this->*((FunctionTable::MEMBERPFNGLVERTEX3XVOESPROC)this->m_profiledFunctions[2001]))(coords);this->profiler.end(2001,profilingStart);}
+void m_glColor3us_profiling(GLushort red,GLushort green,GLushort blue)const{auto const profilingStart=this->profiler.begin(2002);(this->*((FunctionTable::MEMBERPFNGLCOLOR3USPROC)this->m_profiledFunctions[2002]))(red,green,blue);this->profiler.end(2002,profilingStart);}
+void m_glBeginPerfMonitorAMD_profiling(GLuint monitor)const{auto const profilingStart=this->profiler.begin(2003);(this->*((FunctionTable::MEMBERPFNGLBEGINPERFMONITORAMDPROC)this->m_profiledFunctions[2003]))(monitor);this->profiler.end(2003,profilingStart);}
+void m_glProgramUniformMatrix4x3dv_profiling(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{auto const profilingStart=this->profiler.begin(2004);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X3DVPROC)this->m_profiledFunctions[2004]))(program,location,count,transpose,value);this->profiler.end(2004,profilingStart);}
+void m_glGetNamedProgramLocalParameterIuivEXT_profiling(GLuint program,GLenum target,GLuint index,GLuint* params)const{auto const profilingStart=this->profiler.begin(2005);(this->*((FunctionTable::MEMBERPFNGLGETNAMEDPROGRAMLOCALPARAMETERIUIVEXTPROC)this->m_profiledFunctions[2005]))(program,target,index,params);this->profiler.end(2005,profilingStart);}
+void m_glReadnPixels_profiling(GLint x,GLint y,GLsizei width,GLsizei height,GLenum format,GLenum type,GLsizei bufSize,void* data)const{auto const profilingStart=this->profiler.begin(2006);(this->*((FunctionTable::MEMBERPFNGLREADNPIXELSPROC)this->m_profiledFunctions[2006]))(x,y,width,height,format,type,bufSize,data);this->profiler.end(2006,profilingStart);}
+void m_glMultiTexCoord4f_profiling(GLenum target,GLfloat s,GLfloat t,GLfloat r,GLfloat q)const{auto const profilingStart=this->profiler.begin(2007);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD4FPROC)this->m_profiledFunctions[2007]))(target,s,t,r,q);this->profiler.end(2007,profilingStart);}
+void m_glColor3ub_profiling(GLubyte red,GLubyte green,GLubyte blue)const{auto const profilingStart=this->profiler.begin(2008);(this->*((FunctionTable::MEMBERPFNGLCOLOR3UBPROC)this->m_profiledFunctions[2008]))(red,green,blue);this->profiler.end(2008,profilingStart);}
+void m_glMultiTexCoord4d_profiling(GLenum target,GLdouble s,GLdouble t,GLdouble r,GLdouble q)const{auto const profilingStart=this->profiler.begin(2009);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD4DPROC)this->m_profiledFunctions[2009]))(target,s,t,r,q);this->profiler.end(2009,profilingStart);}
+void m_glVertexAttribL3ui64NV_profiling(GLuint index,GLuint64EXT x,GLuint64EXT y,GLuint64EXT z)const{auto const profilingStart=this->profiler.begin(2010);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBL3UI64NVPROC)this->m_profiledFunctions[2010]))(index,x,y,z);this->profiler.end(2010,profilingStart);}
+void m_glColor3ui_profiling(GLuint red,GLuint green,GLuint blue)const{auto const profilingStart=this->profiler.begin(2011);(this->*((FunctionTable::MEMBERPFNGLCOLOR3UIPROC)this->m_profiledFunctions[2011]))(red,green,blue);this->profiler.end(2011,profilingStart);}
+void m_glProgramUniform4fvEXT_profiling(GLuint program,GLint location,GLsizei count,const GLfloat* value)const{auto const profilingStart=this->profiler.begin(2012);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4FVEXTPROC)this->m_profiledFunctions[2012]))(program,location,count,value);this->profiler.end(2012,profilingStart);}
+void m_glVertexAttrib2sARB_profiling(GLuint index,GLshort x,GLshort y)const{auto const profilingStart=this->profiler.begin(2013);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB2SARBPROC)this->m_profiledFunctions[2013]))(index,x,y);this->profiler.end(2013,profilingStart);}
+void m_glMultiTexCoord4i_profiling(GLenum target,GLint s,GLint t,GLint r,GLint q)const{auto const profilingStart=this->profiler.begin(2014);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD4IPROC)this->m_profiledFunctions[2014]))(target,s,t,r,q);this->profiler.end(2014,profilingStart);}
+GLenum m_glCheckFramebufferStatusEXT_profiling(GLenum target)const{auto const profilingStart=this->profiler.begin(2015);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLCHECKFRAMEBUFFERSTATUSEXTPROC)this->m_profiledFunctions[2015]))(target);this->profiler.end(2015,profilingStart);return profilingResult;}
+void m_glGetnMapivARB_profiling(GLenum target,GLenum query,GLsizei bufSize,GLint* v)const{auto const profilingStart=this->profiler.begin(2016);(this->*((FunctionTable::MEMBERPFNGLGETNMAPIVARBPROC)this->m_profiledFunctions[2016]))(target,query,bufSize,v);this->profiler.end(2016,profilingStart);}
+void m_glMultiTexCoord1ivARB_profiling(GLenum target,const GLint* v)const{auto const profilingStart=this->profiler.begin(2017);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD1IVARBPROC)this->m_profiledFunctions[2017]))(target,v);this->profiler.end(2017,profilingStart);}
+void m_glDisableVertexAttribArrayARB_profiling(GLuint index)const{auto const profilingStart=this->profiler.begin(2018);(this->*((FunctionTable::MEMBERPFNGLDISABLEVERTEXATTRIBARRAYARBPROC)this->m_profiledFunctions[2018]))(index);this->profiler.end(2018,profilingStart);}
+void m_glGetPolygonStipple_profiling(GLubyte* mask)const{auto const profilingStart=this->profiler.begin(2019);(this->*((FunctionTable::MEMBERPFNGLGETPOLYGONSTIPPLEPROC)this->m_profiledFunctions[2019]))(mask);this->profiler.end(2019,profilingStart);}
+void m_glVertexAttribI4ui_profiling(GLuint index,GLuint x,GLuint y,GLuint z,GLuint w)const{auto const profilingStart=this->profiler.begin(2020);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBI4UIPROC)this->m_profiledFunctions[2020]))(index,x,y,z,w);this->profiler.end(2020,profilingStart);}
+void m_glGetPathDashArrayNV_profiling(GLuint path,GLfloat* dashArray)const{auto const profilingStart=this->profiler.begin(2021);(this->*((FunctionTable::MEMBERPFNGLGETPATHDASHARRAYNVPROC)this->m_profiledFunctions[2021]))(path,dashArray);this->profiler.end(2021,profilingStart);}
+void m_glMultiTexRenderbufferEXT_profiling(GLenum texunit,GLenum target,GLuint renderbuffer)const{auto const profilingStart=this->profiler.begin(2022);(this->*((FunctionTable::MEMBERPFNGLMULTITEXRENDERBUFFEREXTPROC)this->m_profiledFunctions[2022]))(texunit,target,renderbuffer);this->profiler.end(2022,profilingStart);}
+void m_glCopyTextureSubImage1D_profiling(GLuint texture,GLint level,GLint xoffset,GLint x,GLint y,GLsizei width)const{auto const profilingStart=this->profiler.begin(2023);(this->*((FunctionTable::MEMBERPFNGLCOPYTEXTURESUBIMAGE1DPROC)this->m_profiledFunctions[2023]))(texture,level,xoffset,x,y,width);this->profiler.end(2023,profilingStart);}
+void m_glDeleteOcclusionQueriesNV_profiling(GLsizei n,const GLuint* ids)const{auto const profilingStart=this->profiler.begin(2024);(this->*((FunctionTable::MEMBERPFNGLDELETEOCCLUSIONQUERIESNVPROC)this->m_profiledFunctions[2024]))(n,ids);this->profiler.end(2024,profilingStart);}
+void m_glVertex4hvNV_profiling(const GLhalfNV* v)const{auto const profilingStart=this->profiler.begin(2025);(this->*((FunctionTable::MEMBERPFNGLVERTEX4HVNVPROC)this->m_profiledFunctions[2025]))(v);this->profiler.end(2025,profilingStart);}
+void m_glGetnTexImage_profiling(GLenum target,GLint level,GLenum format,GLenum type,GLsizei bufSize,void* pixels)const{auto const profilingStart=this->profiler.begin(2026);(this->*((FunctionTable::MEMBERPFNGLGETNTEXIMAGEPROC)this->m_profiledFunctions[2026]))(target,level,format,type,bufSize,pixels);this->profiler.end(2026,profilingStart);}
+void m_glProgramLocalParameter4dARB_profiling(GLenum target,GLuint index,GLdouble x,GLdouble y,GLdouble z,GLdouble w)const{auto const profilingStart=this->profiler.begin(2027);(this->*((FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETER4DARBPROC)this->m_profiledFunctions[2027]))(target,index,x,y,z,w);this->profiler.end(2027,profilingStart);}
+void m_glBlendEquation_profiling(GLenum mode)const{auto const profilingStart=this->profiler.begin(2028);(this->*((FunctionTable::MEMBERPFNGLBLENDEQUATIONPROC)this->m_profiledFunctions[2028]))(mode);this->profiler.end(2028,profilingStart);}
+void m_glUnlockArraysEXT_profiling()const{auto const profilingStart=this->profiler.begin(2029);(this->*((FunctionTable::MEMBERPFNGLUNLOCKARRAYSEXTPROC)this->m_profiledFunctions[2029]))();this->profiler.end(2029,profilingStart);}
+void m_glGetQueryObjectui64vEXT_profiling(GLuint id,GLenum pname,GLuint64* params)const{auto const profilingStart=this->profiler.begin(2030);(this->*((FunctionTable::MEMBERPFNGLGETQUERYOBJECTUI64VEXTPROC)this->m_profiledFunctions[2030]))(id,pname,params);this->profiler.end(2030,profilingStart);}
+void m_glVertexAttribI4uivEXT_profiling(GLuint index,const GLuint* v)const{auto const profilingStart=this->profiler.begin(2031);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBI4UIVEXTPROC)this->m_profiledFunctions[2031]))(index,v);this->profiler.end(2031,profilingStart);}
+void m_glUniform1i64vNV_profiling(GLint location,GLsizei count,const GLint64EXT* value)const{auto const profilingStart=this->profiler.begin(2032);(this->*((FunctionTable::MEMBERPFNGLUNIFORM1I64VNVPROC)this->m_profiledFunctions[2032]))(location,count,value);this->profiler.end(2032,profilingStart);}
+void m_glMultiTexCoord3dv_profiling(GLenum target,const GLdouble* v)const{auto const profilingStart=this->profiler.begin(2033);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD3DVPROC)this->m_profiledFunctions[2033]))(target,v);this->profiler.end(2033,profilingStart);}
+void m_glColor4sv_profiling(const GLshort* v)const{auto const profilingStart=this->profiler.begin(2034);(this->*((FunctionTable::MEMBERPFNGLCOLOR4SVPROC)this->m_profiledFunctions[2034]))(v);this->profiler.end(2034,profilingStart);}
+void m_glVertexStream4ivATI_profiling(GLenum stream,const GLint* coords)const{auto const profilingStart=this->profiler.begin(2035);(this->*((FunctionTable::MEMBERPFNGLVERTEXSTREAM4IVATIPROC)this->m_profiledFunctions[2035]))(stream,coords);this->profiler.end(2035,profilingStart);}
+void m_glPopClientAttrib_profiling()const{auto const profilingStart=this->profiler.begin(2036);(this->*((FunctionTable::MEMBERPFNGLPOPCLIENTATTRIBPROC)this->m_profiledFunctions[2036]))();this->profiler.end(2036,profilingStart);}
+void m_glClearBufferData_profiling(GLenum target,GLenum internalformat,GLenum format,GLenum type,const void* data)const{auto const profilingStart=this->profiler.begin(2037);(this->*((FunctionTable::MEMBERPFNGLCLEARBUFFERDATAPROC)this->m_profiledFunctions[2037]))(target,internalformat,format,type,data);this->profiler.end(2037,profilingStart);}
+void m_glGetProgramivNV_profiling(GLuint id,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(2038);(this->*((FunctionTable::MEMBERPFNGLGETPROGRAMIVNVPROC)this->m_profiledFunctions[2038]))(id,pname,params);this->profiler.end(2038,profilingStart);}
+void m_glBeginTransformFeedback_profiling(GLenum primitiveMode)const{auto const profilingStart=this->profiler.begin(2039);(this->*((FunctionTable::MEMBERPFNGLBEGINTRANSFORMFEEDBACKPROC)this->m_profiledFunctions[2039]))(primitiveMode);this->profiler.end(2039,profilingStart);}
+void m_glFinishObjectAPPLE_profiling(GLenum object,GLint name)const{auto const profilingStart=this->profiler.begin(2040);(this->*((FunctionTable::MEMBERPFNGLFINISHOBJECTAPPLEPROC)this->m_profiledFunctions[2040]))(object,name);this->profiler.end(2040,profilingStart);}
+void m_glGetMinmaxParameterivEXT_profiling(GLenum target,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(2041);(this->*((FunctionTable::MEMBERPFNGLGETMINMAXPARAMETERIVEXTPROC)this->m_profiledFunctions[2041]))(target,pname,params);this->profiler.end(2041,profilingStart);}
+void m_glColor3iv_profiling(const GLint* v)const{auto const profilingStart=this->profiler.begin(2042);(this->*((FunctionTable::MEMBERPFNGLCOLOR3IVPROC)this->m_profiledFunctions[2042]))(v);this->profiler.end(2042,profilingStart);}
+void m_glVertexAttrib3sv_profiling(GLuint index,const GLshort* v)const{auto const profilingStart=this->profiler.begin(2043);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB3SVPROC)this->m_profiledFunctions[2043]))(index,v);this->profiler.end(2043,profilingStart);}
+void m_glCompressedTexImage1D_profiling(GLenum target,GLint level,GLenum internalformat,GLsizei width,GLint border,GLsizei imageSize,const GLvoid* data)const{auto const profilingStart=this->profiler.begin(2044);(this->*((FunctionTable::MEMBERPFNGLCOMPRESSEDTEXIMAGE1DPROC)this->m_profiledFunctions[2044]))(target,level,internalformat,width,border,imageSize,data);this->profiler.end(2044,profilingStart);}
+void m_glDeleteTransformFeedbacks_profiling(GLsizei n,const GLuint* ids)const{auto const profilingStart=this->profiler.begin(2045);(this->*((FunctionTable::MEMBERPFNGLDELETETRANSFORMFEEDBACKSPROC)this->m_profiledFunctions[2045]))(n,ids);this->profiler.end(2045,profilingStart);}
+void m_glGetVideoi64vNV_profiling(GLuint video_slot,GLenum pname,GLint64EXT* params)const{auto const profilingStart=this->profiler.begin(2046);(this->*((FunctionTable::MEMBERPFNGLGETVIDEOI64VNVPROC)this->m_profiledFunctions[2046]))(video_slot,pname,params);this->profiler.end(2046,profilingStart);}
+void m_glDrawRangeElementsBaseVertex_profiling(GLenum mode,GLuint start,GLuint end,GLsizei count,GLenum type,const void* indices,GLint basevertex)const{auto const profilingStart=this->profiler.begin(2047);(this->*((FunctionTable::MEMBERPFNGLDRAWRANGEELEMENTSBASEVERTEXPROC)this->m_profiledFunctions[2047]))(mode,start,end,count,type,indices,basevertex);this->profiler.end(2047,profilingStart);}
+void m_glUniform4i64vARB_profiling(GLint location,GLsizei count,const GLint64* value)const{auto const profilingStart=this->profiler.begin(2048);(this->*((FunctionTable::MEMBERPFNGLUNIFORM4I64VARBPROC)this->m_profiledFunctions[2048]))(location,count,value);this->profiler.end(2048,profilingStart);}
+void m_glTextureStorage3DMultisampleEXT_profiling(GLuint texture,GLenum target,GLsizei samples,GLenum internalformat,GLsizei width,GLsizei height,GLsizei depth,GLboolean fixedsamplelocations)const{auto const profilingStart=this->profiler.begin(2049);(this->*((FunctionTable::MEMBERPFNGLTEXTURESTORAGE3DMULTISAMPLEEXTPROC)this->m_profiledFunctions[2049]))(texture,target,samples,internalformat,width,height,depth,fixedsamplelocations);this->profiler.end(2049,profilingStart);}
+void m_glGetTexParameterfv_profiling(GLenum target,GLenum pname,GLfloat* params)const{auto const profilingStart=this->profiler.begin(2050);(this->*((FunctionTable::MEMBERPFNGLGETTEXPARAMETERFVPROC)this->m_profiledFunctions[2050]))(target,pname,params);this->profiler.end(2050,profilingStart);}
+void m_glProgramUniformui64vNV_profiling(GLuint program,GLint location,GLsizei count,const GLuint64EXT* value)const{auto const profilingStart=this->profiler.begin(2051);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORMUI64VNVPROC)this->m_profiledFunctions[2051]))(program,location,count,value);this->profiler.end(2051,profilingStart);}
+void m_glCompressedMultiTexImage1DEXT_profiling(GLenum texunit,GLenum target,GLint level,GLenum internalformat,GLsizei width,GLint border,GLsizei imageSize,const void* bits)const{auto const profilingStart=this->profiler.begin(2052);(this->*((FunctionTable::MEMBERPFNGLCOMPRESSEDMULTITEXIMAGE1DEXTPROC)this->m_profiledFunctions[2052]))(texunit,target,level,internalformat,width,border,imageSize,bits);this->profiler.end(2052,profilingStart);}
+void m_glProgramUniform2ivEXT_profiling(GLuint program,GLint location,GLsizei count,const GLint* value)const{auto const profilingStart=this->profiler.begin(2053);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2IVEXTPROC)this->m_profiledFunctions[2053]))(program,location,count,value);this->profiler.end(2053,profilingStart);}
+void m_glPushGroupMarkerEXT_profiling(GLsizei length,const GLchar* marker)const{auto const profilingStart=this->profiler.begin(2054);(this->*((FunctionTable::MEMBERPFNGLPUSHGROUPMARKEREXTPROC)this->m_profiledFunctions[2054]))(length,marker);this->profiler.end(2054,profilingStart);}
+void m_glVertexAttrib1dv_profiling(GLuint index,const GLdouble* v)const{auto const profilingStart=this->profiler.begin(2055);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB1DVPROC)this->m_profiledFunctions[2055]))(index,v);this->profiler.end(2055,profilingStart);}
+void m_glMatrixLoadIdentityEXT_profiling(GLenum mode)const{auto const profilingStart=this->profiler.begin(2056);(this->*((FunctionTable::MEMBERPFNGLMATRIXLOADIDENTITYEXTPROC)this->m_profiledFunctions[2056]))(mode);this->profiler.end(2056,profilingStart);}
+void m_glMultTransposeMatrixxOES_profiling(const GLfixed* m)const{auto const profilingStart=this->profiler.begin(2057);(this->*((FunctionTable::MEMBERPFNGLMULTTRANSPOSEMATRIXXOESPROC)this->m_profiledFunctions[2057]))(m);this->profiler.end(2057,profilingStart);}
+void m_glGetPixelMapxv_profiling(GLenum map,GLint size,GLfixed* values)const{auto const profilingStart=this->profiler.begin(2058);(this->*((FunctionTable::MEMBERPFNGLGETPIXELMAPXVPROC)this->m_profiledFunctions[2058]))(map,size,values);this->profiler.end(2058,profilingStart);}
+void m_glFramebufferSampleLocationsfvARB_profiling(GLenum target,GLuint start,GLsizei count,const GLfloat* v)const{auto const profilingStart=this->profiler.begin(2059);(this->*((FunctionTable::MEMBERPFNGLFRAMEBUFFERSAMPLELOCATIONSFVARBPROC)this->m_profiledFunctions[2059]))(target,start,count,v);this->profiler.end(2059,profilingStart);}
+void m_glGetLightiv_profiling(GLenum light,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(2060);(this->*((FunctionTable::MEMBERPFNGLGETLIGHTIVPROC)this->m_profiledFunctions[2060]))(light,pname,params);this->profiler.end(2060,profilingStart);}
+void m_glBlendFuncSeparatei_profiling(GLuint buf,GLenum srcRGB,GLenum dstRGB,GLenum srcAlpha,GLenum dstAlpha)const{auto const profilingStart=this->profiler.begin(2061);(this->*((FunctionTable::MEMBERPFNGLBLENDFUNCSEPARATEIPROC)this->m_profiledFunctions[2061]))(buf,srcRGB,dstRGB,srcAlpha,dstAlpha);this->profiler.end(2061,profilingStart);}
+void m_glGetBooleanIndexedvEXT_profiling(GLenum target,GLuint index,GLboolean* data)const{auto const profilingStart=this->profiler.begin(2062);(this->*((FunctionTable::MEMBERPFNGLGETBOOLEANINDEXEDVEXTPROC)this->m_profiledFunctions[2062]))(target,index,data);this->profiler.end(2062,profilingStart);}
+void m_glGetProgramSubroutineParameteruivNV_profiling(GLenum target,GLuint index,GLuint* param)const{auto const profilingStart=this->profiler.begin(2063);(this->*((FunctionTable::MEMBERPFNGLGETPROGRAMSUBROUTINEPARAMETERUIVNVPROC)this->m_profiledFunctions[2063]))(target,index,param);this->profiler.end(2063,profilingStart);}
+void m_glUniform2ui_profiling(GLint location,GLuint v0,GLuint v1)const{auto const profilingStart=this->profiler.begin(2064);(this->*((FunctionTable::MEMBERPFNGLUNIFORM2UIPROC)this->m_profiledFunctions[2064]))(location,v0,v1);this->profiler.end(2064,profilingStart);}
+void m_glApplyFramebufferAttachmentCMAAINTEL_profiling()const{auto const profilingStart=this->profiler.begin(2065);(this->*((FunctionTable::MEMBERPFNGLAPPLYFRAMEBUFFERATTACHMENTCMAAINTELPROC)this->m_profiledFunctions[2065]))();this->profiler.end(2065,profilingStart);}
+void m_glWindowPos2fv_profiling(const GLfloat* v)const{auto const profilingStart=this->profiler.begin(2066);(this->*((FunctionTable::MEMBERPFNGLWINDOWPOS2FVPROC)this->m_profiledFunctions[2066]))(v);this->profiler.end(2066,profilingStart);}
+void m_glDisablei_profiling(GLenum target,GLuint index)const{auto const profilingStart=this->profiler.begin(2067);(this->*((FunctionTable::MEMBERPFNGLDISABLEIPROC)this->m_profiledFunctions[2067]))(target,index);this->profiler.end(2067,profilingStart);}
+void m_glSelectPerfMonitorCountersAMD_profiling(GLuint monitor,GLboolean enable,GLuint group,GLint numCounters,GLuint* counterList)const{auto const profilingStart=this->profiler.begin(2068);(this->*((FunctionTable::MEMBERPFNGLSELECTPERFMONITORCOUNTERSAMDPROC)this->m_profiledFunctions[2068]))(monitor,enable,group,numCounters,counterList);this->profiler.end(2068,profilingStart);}
+void m_glGetVertexAttribLi64vNV_profiling(GLuint index,GLenum pname,GLint64EXT* params)const{auto const profilingStart=this->profiler.begin(2069);(this->*((FunctionTable::MEMBERPFNGLGETVERTEXATTRIBLI64VNVPROC)this->m_profiledFunctions[2069]))(index,pname,params);this->profiler.end(2069,profilingStart);}
+void m_glBlendFuncSeparateiARB_profiling(GLuint buf,GLenum srcRGB,GLenum dstRGB,GLenum srcAlpha,GLenum dstAlpha)const{auto const profilingStart=this->profiler.begin(2070);(this->*((FunctionTable::MEMBERPFNGLBLENDFUNCSEPARATEIARBPROC)this->m_profiledFunctions[2070]))(buf,srcRGB,dstRGB,srcAlpha,dstAlpha);this->profiler.end(2070,profilingStart);}
+void m_glWeightuivARB_profiling(GLint size,const GLuint* weights)const{auto const profilingStart=this->profiler.begin(2071);(this->*((FunctionTable::MEMBERPFNGLWEIGHTUIVARBPROC)this->m_profiledFunctions[2071]))(size,weights);this->profiler.end(2071,profilingStart);}
+void m_glWindowPos2iARB_profiling(GLint x,GLint y)const{auto const profilingStart=this->profiler.begin(2072);(this->*((FunctionTable::MEMBERPFNGLWINDOWPOS2IARBPROC)this->m_profiledFunctions[2072]))(x,y);this->profiler.end(2072,profilingStart);}
+void m_glGetProgramLocalParameterdvARB_profiling(GLenum target,GLuint index,GLdouble* params)const{auto const profilingStart=this->profiler.begin(2073);(this->*((FunctionTable::MEMBERPFNGLGETPROGRAMLOCALPARAMETERDVARBPROC)this->m_profiledFunctions[2073]))(target,index,params);this->profiler.end(2073,profilingStart);}
+void m_glGetUniformui64vARB_profiling(GLuint program,GLint location,GLuint64* params)const{auto const profilingStart=this->profiler.begin(2074);(this->*((FunctionTable::MEMBERPFNGLGETUNIFORMUI64VARBPROC)this->m_profiledFunctions[2074]))(program,location,params);this->profiler.end(2074,profilingStart);}
+void m_glGetSynciv_profiling(GLsync sync,GLenum pname,GLsizei bufSize,GLsizei* length,GLint* values)const{auto const profilingStart=this->profiler.begin(2075);(this->*((FunctionTable::MEMBERPFNGLGETSYNCIVPROC)this->m_profiledFunctions[2075]))(sync,pname,bufSize,length,values);this->profiler.end(2075,profilingStart);}
+void m_glMakeImageHandleResidentARB_profiling(GLuint64 handle,GLenum access)const{auto const profilingStart=this->profiler.begin(2076);(this->*((FunctionTable::MEMBERPFNGLMAKEIMAGEHANDLERESIDENTARBPROC)this->m_profiledFunctions[2076]))(handle,access);this->profiler.end(2076,profilingStart);}
+void m_glGetProgramNamedParameterfvNV_profiling(GLuint id,GLsizei len,const GLubyte* name,GLfloat* params)const{auto const profilingStart=this->profiler.begin(2077);(this->*((FunctionTable::MEMBERPFNGLGETPROGRAMNAMEDPARAMETERFVNVPROC)this->m_profiledFunctions[2077]))(id,len,name,params);this->profiler.end(2077,profilingStart);}
+void m_glTextureStorage3D_profiling(GLuint texture,GLsizei levels,GLenum internalformat,GLsizei width,GLsizei height,GLsizei depth)const{auto const profilingStart=this->profiler.begin(2078);(this->*((FunctionTable::MEMBERPFNGLTEXTURESTORAGE3DPROC)this->m_profiledFunctions[2078]))(texture,levels,internalformat,width,height,depth);this->profiler.end(2078,profilingStart);}
+void m_glVertexAttrib4svNV_profiling(GLuint index,const GLshort* v)const{auto const profilingStart=this->profiler.begin(2079);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB4SVNVPROC)this->m_profiledFunctions[2079]))(index,v);this->profiler.end(2079,profilingStart);}
+void m_glProgramUniform2i_profiling(GLuint program,GLint location,GLint v0,GLint v1)const{auto const profilingStart=this->profiler.begin(2080);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2IPROC)this->m_profiledFunctions[2080]))(program,location,v0,v1);this->profiler.end(2080,profilingStart);}
+void m_glListDrawCommandsStatesClientNV_profiling(GLuint list,GLuint segment,const void** indirects,const GLsizei* sizes,const GLuint* states,const GLuint* fbos,GLuint count)const{auto const profilingStart=this->profiler.begin(2081);(this->*((FunctionTable::MEMBERPFNGLLISTDRAWCOMMANDSSTATESCLIENTNVPROC)this->m_profiledFunctions[2081]))(list,segment,indirects,sizes,states,fbos,count);this->profiler.end(2081,profilingStart);}
+void m_glProgramLocalParametersI4uivNV_profiling(GLenum target,GLuint index,GLsizei count,const GLuint* params)const{auto const profilingStart=this->profiler.begin(2082);(this->*((FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERSI4UIVNVPROC)this->m_profiledFunctions[2082]))(target,index,count,params);this->profiler.end(2082,profilingStart);}
+void m_glBeginTransformFeedbackNV_profiling(GLenum primitiveMode)const{auto const profilingStart=this->profiler.begin(2083);(this->*((FunctionTable::MEMBERPFNGLBEGINTRANSFORMFEEDBACKNVPROC)this->m_profiledFunctions[2083]))(primitiveMode);this->profiler.end(2083,profilingStart);}
+void m_glGetProgramBinary_profiling(GLuint program,GLsizei bufSize,GLsizei* length,GLenum* binaryFormat,void* binary)const{auto const profilingStart=this->profiler.begin(2084);(this->*((FunctionTable::MEMBERPFNGLGETPROGRAMBINARYPROC)this->m_profiledFunctions[2084]))(program,bufSize,length,binaryFormat,binary);this->profiler.end(2084,profilingStart);}
+void m_glBinormal3iEXT_profiling(GLint bx,GLint by,GLint bz)const{auto const profilingStart=this->profiler.begin(2085);(this->*((FunctionTable::MEMBERPFNGLBINORMAL3IEXTPROC)this->m_profiledFunctions[2085]))(bx,by,bz);this->profiler.end(2085,profilingStart);}
+void m_glEvalPoint1_profiling(GLint i)const{auto const profilingStart=this->profiler.begin(2086);(this->*((FunctionTable::MEMBERPFNGLEVALPOINT1PROC)this->m_profiledFunctions[2086]))(i);this->profiler.end(2086,profilingStart);}
+void m_glEvalPoint2_profiling(GLint i,GLint j)const{auto const profilingStart=this->profiler.begin(2087);(this->*((FunctionTable::MEMBERPFNGLEVALPOINT2PROC)this->m_profiledFunctions[2087]))(i,j);this->profiler.end(2087,profilingStart);}
+void m_glPauseTransformFeedback_profiling()const{auto const profilingStart=this->profiler.begin(2088);(this->*((FunctionTable::MEMBERPFNGLPAUSETRANSFORMFEEDBACKPROC)this->m_profiledFunctions[2088]))();this->profiler.end(2088,profilingStart);}
+void m_glWindowPos2sMESA_profiling(GLshort x,GLshort y)const{auto const profilingStart=this->profiler.begin(2089);(this->*((FunctionTable::MEMBERPFNGLWINDOWPOS2SMESAPROC)this->m_profiledFunctions[2089]))(x,y);this->profiler.end(2089,profilingStart);}
+void m_glGlobalAlphaFactorbSUN_profiling(GLbyte factor)const{auto const profilingStart=this->profiler.begin(2090);(this->*((FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORBSUNPROC)this->m_profiledFunctions[2090]))(factor);this->profiler.end(2090,profilingStart);}
+void m_glCreateTransformFeedbacks_profiling(GLsizei n,GLuint* ids)const{auto const profilingStart=this->profiler.begin(2091);(this->*((FunctionTable::MEMBERPFNGLCREATETRANSFORMFEEDBACKSPROC)this->m_profiledFunctions[2091]))(n,ids);this->profiler.end(2091,profilingStart);}
+void m_glTexturePageCommitmentEXT_profiling(GLuint texture,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLboolean commit)const{auto const profilingStart=this->profiler.begin(2092);(this->*((FunctionTable::MEMBERPFNGLTEXTUREPAGECOMMITMENTEXTPROC)this->m_profiledFunctions[2092]))(texture,level,xoffset,yoffset,zoffset,width,height,depth,commit);this->profiler.end(2092,profilingStart);}
+void m_glTransformFeedbackVaryingsNV_profiling(GLuint program,GLsizei count,const GLint* locations,GLenum bufferMode)const{auto const profilingStart=this->profiler.begin(2093);(this->*((FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKVARYINGSNVPROC)this->m_profiledFunctions[2093]))(program,count,locations,bufferMode);this->profiler.end(2093,profilingStart);}
+void m_glTexSubImage1D_profiling(GLenum target,GLint level,GLint xoffset,GLsizei width,GLenum format,GLenum type,const GLvoid* pixels)const{auto const profilingStart=this->profiler.begin(2094);(this->*((FunctionTable::MEMBERPFNGLTEXSUBIMAGE1DPROC)this->m_profiledFunctions[2094]))(target,level,xoffset,width,format,type,pixels);this->profiler.end(2094,profilingStart);}
+void m_glConvolutionParameterfvEXT_profiling(GLenum target,GLenum pname,const GLfloat* params)const{auto const profilingStart=this->profiler.begin(2095);(this->*((FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERFVEXTPROC)this->m_profiledFunctions[2095]))(target,pname,params);this->profiler.end(2095,profilingStart);}
+void m_glBlitFramebufferEXT_profiling(GLint srcX0,GLint srcY0,GLint srcX1,GLint srcY1,GLint dstX0,GLint dstY0,GLint dstX1,GLint dstY1,GLbitfield mask,GLenum filter)const{auto const profilingStart=this->profiler.begin(2096);(this->*((FunctionTable::MEMBERPFNGLBLITFRAMEBUFFEREXTPROC)this->m_profiledFunctions[2096]))(srcX0,srcY0,srcX1,srcY1,dstX0,dstY0,dstX1,dstY1,mask,filter);this->profiler.end(2096,profilingStart);}
+void m_glUniformMatrix4fvARB_profiling(GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{auto const profilingStart=this->profiler.begin(2097);(this->*((FunctionTable::MEMBERPFNGLUNIFORMMATRIX4FVARBPROC)this->m_profiledFunctions[2097]))(location,count,transpose,value);this->profiler.end(2097,profilingStart);}
+void m_glProgramEnvParameter4dvARB_profiling(GLenum target,GLuint index,const GLdouble* params)const{auto const profilingStart=this->profiler.begin(2098);(this->*((FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETER4DVARBPROC)this->m_profiledFunctions[2098]))(target,index,params);this->profiler.end(2098,profilingStart);}
+void m_glSecondaryColor3hNV_profiling(GLhalfNV red,GLhalfNV green,GLhalfNV blue)const{auto const profilingStart=this->profiler.begin(2099);(this->*((FunctionTable::MEMBERPFNGLSECONDARYCOLOR3HNVPROC)this->m_profiledFunctions[2099]))(red,green,blue);this->profiler.end(2099,profilingStart);}
+void m_glVertexAttribP3uiv_profiling(GLuint index,GLenum type,GLboolean normalized,const GLuint* value)const{auto const profilingStart=this->profiler.begin(2100);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBP3UIVPROC)this->m_profiledFunctions[2100]))(index,type,normalized,value);this->profiler.end(2100,profilingStart);}
+void m_glFogCoordFormatNV_profiling(GLenum type,GLsizei stride)const{auto const profilingStart=this->profiler.begin(2101);(this->*((FunctionTable::MEMBERPFNGLFOGCOORDFORMATNVPROC)this->m_profiledFunctions[2101]))(type,stride);this->profiler.end(2101,profilingStart);}
+void m_glGetMultiTexLevelParameterivEXT_profiling(GLenum texunit,GLenum target,GLint level,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(2102);(this->*((FunctionTable::MEMBERPFNGLGETMULTITEXLEVELPARAMETERIVEXTPROC)this->m_profiledFunctions[2102]))(texunit,target,level,pname,params);this->profiler.end(2102,profilingStart);}
+GLboolean m_glIsOcclusionQueryNV_profiling(GLuint id)const{auto const profilingStart=this->profiler.begin(2103);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLISOCCLUSIONQUERYNVPROC)this->m_profiledFunctions[2103]))(id);this->profiler.end(2103,profilingStart);return profilingResult;}
+void m_glCompressedTexImage2DARB_profiling(GLenum target,GLint level,GLenum internalformat,GLsizei width,GLsizei height,GLint border,GLsizei imageSize,const void* data)const{auto const profilingStart=this->profiler.begin(2104);(this->*((FunctionTable::MEMBERPFNGLCOMPRESSEDTEXIMAGE2DARBPROC)this->m_profiledFunctions[2104]))(target,level,internalformat,width,height,border,imageSize,data);this->profiler.end(2104,profilingStart);}
+void m_glGetProgramEnvParameterIuivNV_profiling(GLenum target,GLuint index,GLuint* params)const{auto const profilingStart=this->profiler.begin(2105);(this->*((FunctionTable::MEMBERPFNGLGETPROGRAMENVPARAMETERIUIVNVPROC)this->m_profiledFunctions[2105]))(target,index,params);this->profiler.end(2105,profilingStart);}
+void m_glVertexAttrib4sv_profiling(GLuint index,const GLshort* v)const{auto const profilingStart=this->profiler.begin(2106);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB4SVPROC)this->m_profiledFunctions[2106]))(index,v);this->profiler.end(2106,profilingStart);}
+void m_glVertexAttrib4fvARB_profiling(GLuint index,const GLfloat* v)const{auto const profilingStart=this->profiler.begin(2107);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB4FVARBPROC)this->m_profiledFunctions[2107]))(index,v);this->profiler.end(2107,profilingStart);}
+void m_glLoadName_profiling(GLuint name)const{auto const profilingStart=this->profiler.begin(2108);(this->*((FunctionTable::MEMBERPFNGLLOADNAMEPROC)this->m_profiledFunctions[2108]))(name);this->profiler.end(2108,profilingStart);}
+void m_glBindVertexShaderEXT_profiling(GLuint id)const{auto const profilingStart=this->profiler.begin(2109);(this->*((FunctionTable::MEMBERPFNGLBINDVERTEXSHADEREXTPROC)this->m_profiledFunctions[2109]))(id);this->profiler.end(2109,profilingStart);}
+void m_glGetNamedProgramLocalParameterIivEXT_profiling(GLuint program,GLenum target,GLuint index,GLint* params)const{auto const profilingStart=this->profiler.begin(2110);(this->*((FunctionTable::MEMBERPFNGLGETNAMEDPROGRAMLOCALPARAMETERIIVEXTPROC)this->m_profiledFunctions[2110]))(program,target,index,params);this->profiler.end(2110,profilingStart);}
+void m_glProgramUniform3uiEXT_profiling(GLuint program,GLint location,GLuint v0,GLuint v1,GLuint v2)const{auto const profilingStart=this->profiler.begin(2111);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UIEXTPROC)this->m_profiledFunctions[2111]))(program,location,v0,v1,v2);this->profiler.end(2111,profilingStart);}
+void m_glProgramUniformMatrix4x2dvEXT_profiling(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{auto const profilingStart=this->profiler.begin(2112);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X2DVEXTPROC)this->m_profiledFunctions[2112]))(program,location,count,transpose,value);this->profiler.end(2112,profilingStart);}
+void m_glTexCoord1hvNV_profiling(const GLhalfNV* v)const{auto const profilingStart=this->profiler.begin(2113);(this->*((FunctionTable::MEMBERPFNGLTEXCOORD1HVNVPROC)this->m_profiledFunctions[2113]))(v);this->profiler.end(2113,profilingStart);}
+void m_glLoadMatrixd_profiling(const GLdouble* m)const{auto const profilingStart=this->profiler.begin(2114);(this->*((FunctionTable::MEMBERPFNGLLOADMATRIXDPROC)this->m_profiledFunctions[2114]))(m);this->profiler.end(2114,profilingStart);}
+void m_glTexParameterfv_profiling(GLenum target,GLenum pname,const GLfloat* params)const{auto const profilingStart=this->profiler.begin(2115);(this->*((FunctionTable::MEMBERPFNGLTEXPARAMETERFVPROC)this->m_profiledFunctions[2115]))(target,pname,params);this->profiler.end(2115,profilingStart);}
+void m_glVariantdvEXT_profiling(GLuint id,const GLdouble* addr)const{auto const profilingStart=this->profiler.begin(2116);(this->*((FunctionTable::MEMBERPFNGLVARIANTDVEXTPROC)this->m_profiledFunctions[2116]))(id,addr);this->profiler.end(2116,profilingStart);}
+void m_glCullParameterfvEXT_profiling(GLenum pname,GLfloat* params)const{auto const profilingStart=this->profiler.begin(2117);(this->*((FunctionTable::MEMBERPFNGLCULLPARAMETERFVEXTPROC)this->m_profiledFunctions[2117]))(pname,params);this->profiler.end(2117,profilingStart);}
+void m_glUniform3dv_profiling(GLint location,GLsizei count,const GLdouble* value)const{auto const profilingStart=this->profiler.begin(2118);(this->*((FunctionTable::MEMBERPFNGLUNIFORM3DVPROC)this->m_profiledFunctions[2118]))(location,count,value);this->profiler.end(2118,profilingStart);}
+void m_glProgramUniform3fv_profiling(GLuint program,GLint location,GLsizei count,const GLfloat* value)const{auto const profilingStart=this->profiler.begin(2119);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3FVPROC)this->m_profiledFunctions[2119]))(program,location,count,value);this->profiler.end(2119,profilingStart);}
+GLboolean m_glIsBufferARB_profiling(GLuint buffer)const{auto const profilingStart=this->profiler.begin(2120);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLISBUFFERARBPROC)this->m_profiledFunctions[2120]))(buffer);this->profiler.end(2120,profilingStart);return profilingResult;}
+void m_glMultiTexCoord1bOES_profiling(GLenum texture,GLbyte s)const{auto const profilingStart=this->profiler.begin(2121);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD1BOESPROC)this->m_profiledFunctions[2121]))(texture,s);this->profiler.end(2121,profilingStart);}
+void m_glFogCoordhNV_profiling(GLhalfNV fog)const{auto const profilingStart=this->profiler.begin(2122);(this->*((FunctionTable::MEMBERPFNGLFOGCOORDHNVPROC)this->m_profiledFunctions[2122]))(fog);this->profiler.end(2122,profilingStart);}
+void m_glFramebufferSampleLocationsfvNV_profiling(GLenum target,GLuint start,GLsizei count,const GLfloat* v)const{auto const profilingStart=this->profiler.begin(2123);(this->*((FunctionTable::MEMBERPFNGLFRAMEBUFFERSAMPLELOCATIONSFVNVPROC)this->m_profiledFunctions[2123]))(target,start,count,v);this->profiler.end(2123,profilingStart);}
+GLuint m_glGenSymbolsEXT_profiling(GLenum datatype,GLenum storagetype,GLenum range,GLuint components)const{auto const profilingStart=this->profiler.begin(2124);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLGENSYMBOLSEXTPROC)this->m_profiledFunctions[2124]))(datatype,storagetype,range,components);this->profiler.end(2124,profilingStart);return profilingResult;}
+void m_glGetConvolutionFilter_profiling(GLenum target,GLenum format,GLenum type,GLvoid* image)const{auto const profilingStart=this->profiler.begin(2125);(this->*((FunctionTable::MEMBERPFNGLGETCONVOLUTIONFILTERPROC)this->m_profiledFunctions[2125]))(target,format,type,image);this->profiler.end(2125,profilingStart);}
+void m_glProgramUniform1fvEXT_profiling(GLuint program,GLint location,GLsizei count,const GLfloat* value)const{auto const profilingStart=this->profiler.begin(2126);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1FVEXTPROC)this->m_profiledFunctions[2126]))(program,location,count,value);this->profiler.end(2126,profilingStart);}
+void m_glGetNextPerfQueryIdINTEL_profiling(GLuint queryId,GLuint* nextQueryId)const{auto const profilingStart=this->profiler.begin(2127);(this->*((FunctionTable::MEMBERPFNGLGETNEXTPERFQUERYIDINTELPROC)this->m_profiledFunctions[2127]))(queryId,nextQueryId);this->profiler.end(2127,profilingStart);}
+void m_glCompressedTexImage1DARB_profiling(GLenum target,GLint level,GLenum internalformat,GLsizei width,GLint border,GLsizei imageSize,const void* data)const{auto const profilingStart=this->profiler.begin(2128);(this->*((FunctionTable::MEMBERPFNGLCOMPRESSEDTEXIMAGE1DARBPROC)this->m_profiledFunctions[2128]))(target,level,internalformat,width,border,imageSize,data);this->profiler.end(2128,profilingStart);}
+void m_glBindSamplers_profiling(GLuint first,GLsizei count,const GLuint* samplers)const{auto const profilingStart=this->profiler.begin(2129);(this->*((FunctionTable::MEMBERPFNGLBINDSAMPLERSPROC)this->m_profiledFunctions[2129]))(first,count,samplers);this->profiler.end(2129,profilingStart);}
+void m_glGetProgramEnvParameterIivNV_profiling(GLenum target,GLuint index,GLint* params)const{auto const profilingStart=this->profiler.begin(2130);(this->*((FunctionTable::MEMBERPFNGLGETPROGRAMENVPARAMETERIIVNVPROC)this->m_profiledFunctions[2130]))(target,index,params);this->profiler.end(2130,profilingStart);}
+void m_glGetQueryObjectui64v_profiling(GLuint id,GLenum pname,GLuint64* params)const{auto const profilingStart=this->profiler.begin(2131);(this->*((FunctionTable::MEMBERPFNGLGETQUERYOBJECTUI64VPROC)this->m_profiledFunctions[2131]))(id,pname,params);this->profiler.end(2131,profilingStart);}
+void m_glVertexAttribL4ui64vNV_profiling(GLuint index,const GLuint64EXT* v)const{auto const profilingStart=this->profiler.begin(2132);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBL4UI64VNVPROC)this->m_profiledFunctions[2132]))(index,v);this->profiler.end(2132,profilingStart);}
+void m_glGetVideoivNV_profiling(GLuint video_slot,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(2133);(this->*((FunctionTable::MEMBERPFNGLGETVIDEOIVNVPROC)this->m_profiledFunctions[2133]))(video_slot,pname,params);this->profiler.end(2133,profilingStart);}
+void m_glGetTextureImage_profiling(GLuint texture,GLint level,GLenum format,GLenum type,GLsizei bufSize,void* pixels)const{auto const profilingStart=this->profiler.begin(2134);(this->*((FunctionTable::MEMBERPFNGLGETTEXTUREIMAGEPROC)this->m_profiledFunctions[2134]))(texture,level,format,type,bufSize,pixels);this->profiler.end(2134,profilingStart);}
+void m_glProgramUniform1fv_profiling(GLuint program,GLint location,GLsizei count,const GLfloat* value)const{auto const profilingStart=this->profiler.begin(2135);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1FVPROC)this->m_profiledFunctions[2135]))(program,location,count,value);this->profiler.end(2135,profilingStart);}
+void m_glUniformMatrix4fv_profiling(GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{auto const profilingStart=this->profiler.begin(2136);(this->*((FunctionTable::MEMBERPFNGLUNIFORMMATRIX4FVPROC)this->m_profiledFunctions[2136]))(location,count,transpose,value);this->profiler.end(2136,profilingStart);}
+void m_glColorMask_profiling(GLboolean red,GLboolean green,GLboolean blue,GLboolean alpha)const{auto const profilingStart=this->profiler.begin(2137);(this->*((FunctionTable::MEMBERPFNGLCOLORMASKPROC)this->m_profiledFunctions[2137]))(red,green,blue,alpha);this->profiler.end(2137,profilingStart);}
+void m_glBeginFragmentShaderATI_profiling()const{auto const profilingStart=this->profiler.begin(2138);(this->*((FunctionTable::MEMBERPFNGLBEGINFRAGMENTSHADERATIPROC)this->m_profiledFunctions[2138]))();this->profiler.end(2138,profilingStart);}
+void m_glMultiDrawArraysEXT_profiling(GLenum mode,const GLint* first,const GLsizei* count,GLsizei primcount)const{auto const profilingStart=this->profiler.begin(2139);(this->*((FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSEXTPROC)this->m_profiledFunctions[2139]))(mode,first,count,primcount);this->profiler.end(2139,profilingStart);}
+void m_glGenNamesAMD_profiling(GLenum identifier,GLuint num,GLuint* names)const{auto const profilingStart=this->profiler.begin(2140);(this->*((FunctionTable::MEMBERPFNGLGENNAMESAMDPROC)this->m_profiledFunctions[2140]))(identifier,num,names);this->profiler.end(2140,profilingStart);}
+void m_glPathParameteriNV_profiling(GLuint path,GLenum pname,GLint value)const{auto const profilingStart=this->profiler.begin(2141);(this->*((FunctionTable::MEMBERPFNGLPATHPARAMETERINVPROC)this->m_profiledFunctions[2141]))(path,pname,value);this->profiler.end(2141,profilingStart);}
+void m_glCreateCommandListsNV_profiling(GLsizei n,GLuint* lists)const{auto const profilingStart=this->profiler.begin(2142);(this->*((FunctionTable::MEMBERPFNGLCREATECOMMANDLISTSNVPROC)this->m_profiledFunctions[2142]))(n,lists);this->profiler.end(2142,profilingStart);}
+void m_glDeleteProgramPipelines_profiling(GLsizei n,const GLuint* pipelines)const{auto const profilingStart=this->profiler.begin(2143);(this->*((FunctionTable::MEMBERPFNGLDELETEPROGRAMPIPELINESPROC)this->m_profiledFunctions[2143]))(n,pipelines);this->profiler.end(2143,profilingStart);}
+void m_glCopyColorSubTableEXT_profiling(GLenum target,GLsizei start,GLint x,GLint y,GLsizei width)const{auto const profilingStart=this->profiler.begin(2144);(this->*((FunctionTable::MEMBERPFNGLCOPYCOLORSUBTABLEEXTPROC)this->m_profiledFunctions[2144]))(target,start,x,y,width);this->profiler.end(2144,profilingStart);}
+void m_glVariantsvEXT_profiling(GLuint id,const GLshort* addr)const{auto const profilingStart=this->profiler.begin(2145);(this->*((FunctionTable::MEMBERPFNGLVARIANTSVEXTPROC)this->m_profiledFunctions[2145]))(id,addr);this->profiler.end(2145,profilingStart);}
+void m_glGenProgramPipelines_profiling(GLsizei n,GLuint* pipelines)const{auto const profilingStart=this->profiler.begin(2146);(this->*((FunctionTable::MEMBERPFNGLGENPROGRAMPIPELINESPROC)this->m_profiledFunctions[2146]))(n,pipelines);this->profiler.end(2146,profilingStart);}
+void m_glVertexArrayEdgeFlagOffsetEXT_profiling(GLuint vaobj,GLuint buffer,GLsizei stride,GLintptr offset)const{auto const profilingStart=this->profiler.begin(2147);(this->*((FunctionTable::MEMBERPFNGLVERTEXARRAYEDGEFLAGOFFSETEXTPROC)this->m_profiledFunctions[2147]))(vaobj,buffer,stride,offset);this->profiler.end(2147,profilingStart);}
+void m_glWindowPos2s_profiling(GLshort x,GLshort y)const{auto const profilingStart=this->profiler.begin(2148);(this->*((FunctionTable::MEMBERPFNGLWINDOWPOS2SPROC)this->m_profiledFunctions[2148]))(x,y);this->profiler.end(2148,profilingStart);}
+void m_glSecondaryColor3iEXT_profiling(GLint red,GLint green,GLint blue)const{auto const profilingStart=this->profiler.begin(2149);(this->*((FunctionTable::MEMBERPFNGLSECONDARYCOLOR3IEXTPROC)this->m_profiledFunctions[2149]))(red,green,blue);this->profiler.end(2149,profilingStart);}
+void m_glWindowPos2i_profiling(GLint x,GLint y)const{auto const profilingStart=this->profiler.begin(2150);(this->*((FunctionTable::MEMBERPFNGLWINDOWPOS2IPROC)this->m_profiledFunctions[2150]))(x,y);this->profiler.end(2150,profilingStart);}
+void m_glWindowPos2f_profiling(GLfloat x,GLfloat y)const{auto const profilingStart=this->profiler.begin(2151);(this->*((FunctionTable::MEMBERPFNGLWINDOWPOS2FPROC)this->m_profiledFunctions[2151]))(x,y);this->profiler.end(2151,profilingStart);}
+void m_glWindowPos2d_profiling(GLdouble x,GLdouble y)const{auto const profilingStart=this->profiler.begin(2152);(this->*((FunctionTable::MEMBERPFNGLWINDOWPOS2DPROC)this->m_profiledFunctions[2152]))(x,y);this->profiler.end(2152,profilingStart);}
+void m_glUniform4uivEXT_profiling(GLint location,GLsizei count,const GLuint* value)const{auto const profilingStart=this->profiler.begin(2153);(this->*((FunctionTable::MEMBERPFNGLUNIFORM4UIVEXTPROC)this->m_profiledFunctions[2153]))(location,count,value);this->profiler.end(2153,profilingStart);}
+void m_glOrthoxOES_profiling(GLfixed l,GLfixed r,GLfixed b,GLfixed t,GLfixed n,GLfixed f)const{auto const profilingStart=this->profiler.begin(2154);(this->*((FunctionTable::MEMBERPFNGLORTHOXOESPROC)this->m_profiledFunctions[2154]))(l,r,b,t,n,f);this->profiler.end(2154,profilingStart);}
+void m_glUniformSubroutinesuiv_profiling(GLenum shadertype,GLsizei count,const GLuint* indices)const{auto const profilingStart=this->profiler.begin(2155);(this->*((FunctionTable::MEMBERPFNGLUNIFORMSUBROUTINESUIVPROC)this->m_profiledFunctions[2155]))(shadertype,count,indices);this->profiler.end(2155,profilingStart);}
+void m_glRectdv_profiling(const GLdouble* v1,const GLdouble* v2)const{auto const profilingStart=this->profiler.begin(2156);(this->*((FunctionTable::MEMBERPFNGLRECTDVPROC)this->m_profiledFunctions[2156]))(v1,v2);this->profiler.end(2156,profilingStart);}
+void m_glProgramUniform1i64vNV_profiling(GLuint program,GLint location,GLsizei count,const GLint64EXT* value)const{auto const profilingStart=this->profiler.begin(2157);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1I64VNVPROC)this->m_profiledFunctions[2157]))(program,location,count,value);this->profiler.end(2157,profilingStart);}
+void m_glVertexAttribI4uiEXT_profiling(GLuint index,GLuint x,GLuint y,GLuint z,GLuint w)const{auto const profilingStart=this->profiler.begin(2158);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBI4UIEXTPROC)this->m_profiledFunctions[2158]))(index,x,y,z,w);this->profiler.end(2158,profilingStart);}
+void m_glSecondaryColor3ubEXT_profiling(GLubyte red,GLubyte green,GLubyte blue)const{auto const profilingStart=this->profiler.begin(2159);(this->*((FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UBEXTPROC)this->m_profiledFunctions[2159]))(red,green,blue);this->profiler.end(2159,profilingStart);}
+void m_glCompressedMultiTexSubImage1DEXT_profiling(GLenum texunit,GLenum target,GLint level,GLint xoffset,GLsizei width,GLenum format,GLsizei imageSize,const void* bits)const{auto const profilingStart=this->profiler.begin(2160);(this->*((FunctionTable::MEMBERPFNGLCOMPRESSEDMULTITEXSUBIMAGE1DEXTPROC)this->m_profiledFunctions[2160]))(texunit,target,level,xoffset,width,format,imageSize,bits);this->profiler.end(2160,profilingStart);}
+void m_glMultiTexGendEXT_profiling(GLenum texunit,GLenum coord,GLenum pname,GLdouble param)const{auto const profilingStart=this->profiler.begin(2161);(this->*((FunctionTable::MEMBERPFNGLMULTITEXGENDEXTPROC)this->m_profiledFunctions[2161]))(texunit,coord,pname,param);this->profiler.end(2161,profilingStart);}
+void m_glColorP3uiv_profiling(GLenum type,const GLuint* color)const{auto const profilingStart=this->profiler.begin(2162);(this->*((FunctionTable::MEMBERPFNGLCOLORP3UIVPROC)this->m_profiledFunctions[2162]))(type,color);this->profiler.end(2162,profilingStart);}
+void m_glFogCoordfv_profiling(const GLfloat* coord)const{auto const profilingStart=this->profiler.begin(2163);(this->*((FunctionTable::MEMBERPFNGLFOGCOORDFVPROC)this->m_profiledFunctions[2163]))(coord);this->profiler.end(2163,profilingStart);}
+void m_glCompileShader_profiling(GLuint shader)const{auto const profilingStart=this->profiler.begin(2164);(this->*((FunctionTable::MEMBERPFNGLCOMPILESHADERPROC)this->m_profiledFunctions[2164]))(shader);this->profiler.end(2164,profilingStart);}
+void m_glTexCoord2hNV_profiling(GLhalfNV s,GLhalfNV t)const{auto const profilingStart=this->profiler.begin(2165);(this->*((FunctionTable::MEMBERPFNGLTEXCOORD2HNVPROC)this->m_profiledFunctions[2165]))(s,t);this->profiler.end(2165,profilingStart);}
+void m_glUniform1uivEXT_profiling(GLint location,GLsizei count,const GLuint* value)const{auto const profilingStart=this->profiler.begin(2166);(this->*((FunctionTable::MEMBERPFNGLUNIFORM1UIVEXTPROC)this->m_profiledFunctions[2166]))(location,count,value);this->profiler.end(2166,profilingStart);}
+void m_glMatrixLoadTransposedEXT_profiling(GLenum mode,const GLdouble* m)const{auto const profilingStart=this->profiler.begin(2167);(this->*((FunctionTable::MEMBERPFNGLMATRIXLOADTRANSPOSEDEXTPROC)this->m_profiledFunctions[2167]))(mode,m);this->profiler.end(2167,profilingStart);}
+void m_glIndexfv_profiling(const GLfloat* c)const{auto const profilingStart=this->profiler.begin(2168);(this->*((FunctionTable::MEMBERPFNGLINDEXFVPROC)this->m_profiledFunctions[2168]))(c);this->profiler.end(2168,profilingStart);}
+void m_glGetCompressedTextureImage_profiling(GLuint texture,GLint level,GLsizei bufSize,void* pixels)const{auto const profilingStart=this->profiler.begin(2169);(this->*((FunctionTable::MEMBERPFNGLGETCOMPRESSEDTEXTUREIMAGEPROC)this->m_profiledFunctions[2169]))(texture,level,bufSize,pixels);this->profiler.end(2169,profilingStart);}
+void m_glGetUniformuivEXT_profiling(GLuint program,GLint location,GLuint* params)const{auto const profilingStart=this->profiler.begin(2170);(this->*((FunctionTable::MEMBERPFNGLGETUNIFORMUIVEXTPROC)this->m_profiledFunctions[2170]))(program,location,params);this->profiler.end(2170,profilingStart);}
+void m_glGetnPixelMapfvARB_profiling(GLenum map,GLsizei bufSize,GLfloat* values)const{auto const profilingStart=this->profiler.begin(2171);(this->*((FunctionTable::MEMBERPFNGLGETNPIXELMAPFVARBPROC)this->m_profiledFunctions[2171]))(map,bufSize,values);this->profiler.end(2171,profilingStart);}
+void m_glFramebufferTextureEXT_profiling(GLenum target,GLenum attachment,GLuint texture,GLint level)const{auto const profilingStart=this->profiler.begin(2172);(this->*((FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTUREEXTPROC)this->m_profiledFunctions[2172]))(target,attachment,texture,level);this->profiler.end(2172,profilingStart);}
+void m_glVertexAttribIPointer_profiling(GLuint index,GLint size,GLenum type,GLsizei stride,const void* pointer)const{auto const profilingStart=this->profiler.begin(2173);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBIPOINTERPROC)this->m_profiledFunctions[2173]))(index,size,type,stride,pointer);this->profiler.end(2173,profilingStart);}
+void m_glMultiTexCoordP3ui_profiling(GLenum texture,GLenum type,GLuint coords)const{auto const profilingStart=this->profiler.begin(2174);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORDP3UIPROC)this->m_profiledFunctions[2174]))(texture,type,coords);this->profiler.end(2174,profilingStart);}
+void m_glEvaluateDepthValuesARB_profiling()const{auto const profilingStart=this->profiler.begin(2175);(this->*((FunctionTable::MEMBERPFNGLEVALUATEDEPTHVALUESARBPROC)this->m_profiledFunctions[2175]))();this->profiler.end(2175,profilingStart);}
+void m_glGetNamedBufferParameteriv_profiling(GLuint buffer,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(2176);(this->*((FunctionTable::MEMBERPFNGLGETNAMEDBUFFERPARAMETERIVPROC)this->m_profiledFunctions[2176]))(buffer,pname,params);this->profiler.end(2176,profilingStart);}
+void m_glGetNamedProgramLocalParameterfvEXT_profiling(GLuint program,GLenum target,GLuint index,GLfloat* params)const{auto const profilingStart=this->profiler.begin(2177);(this->*((FunctionTable::MEMBERPFNGLGETNAMEDPROGRAMLOCALPARAMETERFVEXTPROC)this->m_profiledFunctions[2177]))(program,target,index,params);this->profiler.end(2177,profilingStart);}
+void m_glColor4fNormal3fVertex3fvSUN_profiling(const GLfloat* c,const GLfloat* n,const GLfloat* v)const{auto const profilingStart=this->profiler.begin(2178);(this->*((FunctionTable::MEMBERPFNGLCOLOR4FNORMAL3FVERTEX3FVSUNPROC)this->m_profiledFunctions[2178]))(c,n,v);this->profiler.end(2178,profilingStart);}
+void m_glSeparableFilter2DEXT_profiling(GLenum target,GLenum internalformat,GLsizei width,GLsizei height,GLenum format,GLenum type,const void* row,const void* column)const{auto const profilingStart=this->profiler.begin(2179);(this->*((FunctionTable::MEMBERPFNGLSEPARABLEFILTER2DEXTPROC)this->m_profiledFunctions[2179]))(target,internalformat,width,height,format,type,row,column);this->profiler.end(2179,profilingStart);}
+void m_glTexParameterxOES_profiling(GLenum target,GLenum pname,GLfixed param)const{auto const profilingStart=this->profiler.begin(2180);(this->*((FunctionTable::MEMBERPFNGLTEXPARAMETERXOESPROC)this->m_profiledFunctions[2180]))(target,pname,param);this->profiler.end(2180,profilingStart);}
+void m_glClearAccumxOES_profiling(GLfixed red,GLfixed green,GLfixed blue,GLfixed alpha)const{auto const profilingStart=this->profiler.begin(2181);(this->*((FunctionTable::MEMBERPFNGLCLEARACCUMXOESPROC)this->m_profiledFunctions[2181]))(red,green,blue,alpha);this->profiler.end(2181,profilingStart);}
+void m_glInvalidateFramebuffer_profiling(GLenum target,GLsizei numAttachments,const GLenum* attachments)const{auto const profilingStart=this->profiler.begin(2182);(this->*((FunctionTable::MEMBERPFNGLINVALIDATEFRAMEBUFFERPROC)this->m_profiledFunctions[2182]))(target,numAttachments,attachments);this->profiler.end(2182,profilingStart);}
+void m_glWeightubvARB_profiling(GLint size,const GLubyte* weights)const{auto const profilingStart=this->profiler.begin(2183);(this->*((FunctionTable::MEMBERPFNGLWEIGHTUBVARBPROC)this->m_profiledFunctions[2183]))(size,weights);this->profiler.end(2183,profilingStart);}
+void m_glVertexAttrib1d_profiling(GLuint index,GLdouble x)const{auto const profilingStart=this->profiler.begin(2184);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB1DPROC)this->m_profiledFunctions[2184]))(index,x);this->profiler.end(2184,profilingStart);}
+void m_glVertexAttrib1f_profiling(GLuint index,GLfloat x)const{auto const profilingStart=this->profiler.begin(2185);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB1FPROC)this->m_profiledFunctions[2185]))(index,x);this->profiler.end(2185,profilingStart);}
+void m_glVertex4fv_profiling(const GLfloat* v)const{auto const profilingStart=this->profiler.begin(2186);(this->*((FunctionTable::MEMBERPFNGLVERTEX4FVPROC)this->m_profiledFunctions[2186]))(v);this->profiler.end(2186,profilingStart);}
+void m_glClearNamedFramebufferfi_profiling(GLuint framebuffer,GLenum buffer,GLint drawbuffer,GLfloat depth,GLint stencil)const{auto const profilingStart=this->profiler.begin(2187);(this->*((FunctionTable::MEMBERPFNGLCLEARNAMEDFRAMEBUFFERFIPROC)this->m_profiledFunctions[2187]))(framebuffer,buffer,drawbuffer,depth,stencil);this->profiler.end(2187,profilingStart);}
+void m_glGetQueryBufferObjectuiv_profiling(GLuint id,GLuint buffer,GLenum pname,GLintptr offset)const{auto const profilingStart=this->profiler.begin(2188);(this->*((FunctionTable::MEMBERPFNGLGETQUERYBUFFEROBJECTUIVPROC)this->m_profiledFunctions[2188]))(id,buffer,pname,offset);this->profiler.end(2188,profilingStart);}
+void m_glClearNamedFramebufferfv_profiling(GLuint framebuffer,GLenum buffer,GLint drawbuffer,const GLfloat* value)const{auto const profilingStart=this->profiler.begin(2189);(this->*((FunctionTable::MEMBERPFNGLCLEARNAMEDFRAMEBUFFERFVPROC)this->m_profiledFunctions[2189]))(framebuffer,buffer,drawbuffer,value);this->profiler.end(2189,profilingStart);}
+void m_glEndVertexShaderEXT_profiling()const{auto const profilingStart=this->profiler.begin(2190);(this->*((FunctionTable::MEMBERPFNGLENDVERTEXSHADEREXTPROC)this->m_profiledFunctions[2190]))();this->profiler.end(2190,profilingStart);}
+void m_glVertexAttrib1s_profiling(GLuint index,GLshort x)const{auto const profilingStart=this->profiler.begin(2191);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB1SPROC)this->m_profiledFunctions[2191]))(index,x);this->profiler.end(2191,profilingStart);}
+void m_glMultiTexCoord4dvARB_profiling(GLenum target,const GLdouble* v)const{auto const profilingStart=this->profiler.begin(2192);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD4DVARBPROC)this->m_profiledFunctions[2192]))(target,v);this->profiler.end(2192,profilingStart);}
+void m_glMultiTexCoord1sv_profiling(GLenum target,const GLshort* v)const{auto const profilingStart=this->profiler.begin(2193);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD1SVPROC)this->m_profiledFunctions[2193]))(target,v);this->profiler.end(2193,profilingStart);}
+void m_glUniform1ui64vNV_profiling(GLint location,GLsizei count,const GLuint64EXT* value)const{auto const profilingStart=this->profiler.begin(2194);(this->*((FunctionTable::MEMBERPFNGLUNIFORM1UI64VNVPROC)this->m_profiledFunctions[2194]))(location,count,value);this->profiler.end(2194,profilingStart);}
+void m_glGetClipPlanefOES_profiling(GLenum plane,GLfloat* equation)const{auto const profilingStart=this->profiler.begin(2195);(this->*((FunctionTable::MEMBERPFNGLGETCLIPPLANEFOESPROC)this->m_profiledFunctions[2195]))(plane,equation);this->profiler.end(2195,profilingStart);}
+void m_glRasterPos2s_profiling(GLshort x,GLshort y)const{auto const profilingStart=this->profiler.begin(2196);(this->*((FunctionTable::MEMBERPFNGLRASTERPOS2SPROC)this->m_profiledFunctions[2196]))(x,y);this->profiler.end(2196,profilingStart);}
+void m_glWeightivARB_profiling(GLint size,const GLint* weights)const{auto const profilingStart=this->profiler.begin(2197);(this->*((FunctionTable::MEMBERPFNGLWEIGHTIVARBPROC)this->m_profiledFunctions[2197]))(size,weights);this->profiler.end(2197,profilingStart);}
+void m_glMultiTexCoord4hvNV_profiling(GLenum target,const GLhalfNV* v)const{auto const profilingStart=this->profiler.begin(2198);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD4HVNVPROC)this->m_profiledFunctions[2198]))(target,v);this->profiler.end(2198,profilingStart);}
+void m_glNormal3hNV_profiling(GLhalfNV nx,GLhalfNV ny,GLhalfNV nz)const{auto const profilingStart=this->profiler.begin(2199);(this->*((FunctionTable::MEMBERPFNGLNORMAL3HNVPROC)this->m_profiledFunctions[2199]))(nx,ny,nz);this->profiler.end(2199,profilingStart);}
+void m_glGetSeparableFilter_profiling(GLenum target,GLenum format,GLenum type,GLvoid* row,GLvoid* column,GLvoid* span)const{auto const profilingStart=this->profiler.begin(2200);(this->*((FunctionTable::MEMBERPFNGLGETSEPARABLEFILTERPROC)this->m_profiledFunctions[2200]))(target,format,type,row,column,span);this->profiler.end(2200,profilingStart);}
+void m_glGetPathTexGenivNV_profiling(GLenum texCoordSet,GLenum pname,GLint* value)const{auto const profilingStart=this->profiler.begin(2201);(this->*((FunctionTable::MEMBERPFNGLGETPATHTEXGENIVNVPROC)this->m_profiledFunctions[2201]))(texCoordSet,pname,value);this->profiler.end(2201,profilingStart);}
+void m_glColor4bv_profiling(const GLbyte* v)const{auto const profilingStart=this->profiler.begin(2202);(this->*((FunctionTable::MEMBERPFNGLCOLOR4BVPROC)this->m_profiledFunctions[2202]))(v);this->profiler.end(2202,profilingStart);}
+void m_glRasterPos2f_profiling(GLfloat x,GLfloat y)const{auto const profilingStart=this->profiler.begin(2203);(this->*((FunctionTable::MEMBERPFNGLRASTERPOS2FPROC)this->m_profiledFunctions[2203]))(x,y);this->profiler.end(2203,profilingStart);}
+void m_glNamedBufferPageCommitmentARB_profiling(GLuint buffer,GLintptr offset,GLsizeiptr size,GLboolean commit)const{auto const profilingStart=this->profiler.begin(2204);(this->*((FunctionTable::MEMBERPFNGLNAMEDBUFFERPAGECOMMITMENTARBPROC)this->m_profiledFunctions[2204]))(buffer,offset,size,commit);this->profiler.end(2204,profilingStart);}
+void m_glLoadIdentity_profiling()const{auto const profilingStart=this->profiler.begin(2205);(this->*((FunctionTable::MEMBERPFNGLLOADIDENTITYPROC)this->m_profiledFunctions[2205]))();this->profiler.end(2205,profilingStart);}
+void m_glRasterPos2i_profiling(GLint x,GLint y)const{auto const profilingStart=this->profiler.begin(2206);(this->*((FunctionTable::MEMBERPFNGLRASTERPOS2IPROC)this->m_profiledFunctions[2206]))(x,y);this->profiler.end(2206,profilingStart);}
+void m_glRasterPos4iv_profiling(const GLint* v)const{auto const profilingStart=this->profiler.begin(2207);(this->*((FunctionTable::MEMBERPFNGLRASTERPOS4IVPROC)this->m_profiledFunctions[2207]))(v);this->profiler.end(2207,profilingStart);}
+void m_glMultiTexCoord2fvARB_profiling(GLenum target,const GLfloat* v)const{auto const profilingStart=this->profiler.begin(2208);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD2FVARBPROC)this->m_profiledFunctions[2208]))(target,v);this->profiler.end(2208,profilingStart);}
+void m_glUniformMatrix4x3fv_profiling(GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{auto const profilingStart=this->profiler.begin(2209);(this->*((FunctionTable::MEMBERPFNGLUNIFORMMATRIX4X3FVPROC)this->m_profiledFunctions[2209]))(location,count,transpose,value);this->profiler.end(2209,profilingStart);}
+void m_glClearBufferfv_profiling(GLenum buffer,GLint drawbuffer,const GLfloat* value)const{auto const profilingStart=this->profiler.begin(2210);(this->*((FunctionTable::MEMBERPFNGLCLEARBUFFERFVPROC)this->m_profiledFunctions[2210]))(buffer,drawbuffer,value);this->profiler.end(2210,profilingStart);}
+void m_glMultiTexCoord4hNV_profiling(GLenum target,GLhalfNV s,GLhalfNV t,GLhalfNV r,GLhalfNV q)const{auto const profilingStart=this->profiler.begin(2211);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD4HNVPROC)this->m_profiledFunctions[2211]))(target,s,t,r,q);this->profiler.end(2211,profilingStart);}
+void m_glTextureBarrier_profiling()const{auto const profilingStart=this->profiler.begin(2212);(this->*((FunctionTable::MEMBERPFNGLTEXTUREBARRIERPROC)this->m_profiledFunctions[2212]))();this->profiler.end(2212,profilingStart);}
+void m_glReplacementCodeuivSUN_profiling(const GLuint* code)const{auto const profilingStart=this->profiler.begin(2213);(this->*((FunctionTable::MEMBERPFNGLREPLACEMENTCODEUIVSUNPROC)this->m_profiledFunctions[2213]))(code);this->profiler.end(2213,profilingStart);}
+void m_glDeleteAsyncMarkersSGIX_profiling(GLuint marker,GLsizei range)const{auto const profilingStart=this->profiler.begin(2214);(this->*((FunctionTable::MEMBERPFNGLDELETEASYNCMARKERSSGIXPROC)this->m_profiledFunctions[2214]))(marker,range);this->profiler.end(2214,profilingStart);}
+void m_glTexCoord2bvOES_profiling(const GLbyte* coords)const{auto const profilingStart=this->profiler.begin(2215);(this->*((FunctionTable::MEMBERPFNGLTEXCOORD2BVOESPROC)this->m_profiledFunctions[2215]))(coords);this->profiler.end(2215,profilingStart);}
+void m_glEvalCoord2xOES_profiling(GLfixed u,GLfixed v)const{auto const profilingStart=this->profiler.begin(2216);(this->*((FunctionTable::MEMBERPFNGLEVALCOORD2XOESPROC)this->m_profiledFunctions[2216]))(u,v);this->profiler.end(2216,profilingStart);}
+void m_glGetSharpenTexFuncSGIS_profiling(GLenum target,GLfloat* points)const{auto const profilingStart=this->profiler.begin(2217);(this->*((FunctionTable::MEMBERPFNGLGETSHARPENTEXFUNCSGISPROC)this->m_profiledFunctions[2217]))(target,points);this->profiler.end(2217,profilingStart);}
+void m_glProgramUniformHandleui64vNV_profiling(GLuint program,GLint location,GLsizei count,const GLuint64* values)const{auto const profilingStart=this->profiler.begin(2218);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORMHANDLEUI64VNVPROC)this->m_profiledFunctions[2218]))(program,location,count,values);this->profiler.end(2218,profilingStart);}
+void m_glIglooInterfaceSGIX_profiling(GLenum pname,const void* params)const{auto const profilingStart=this->profiler.begin(2219);(this->*((FunctionTable::MEMBERPFNGLIGLOOINTERFACESGIXPROC)this->m_profiledFunctions[2219]))(pname,params);this->profiler.end(2219,profilingStart);}
+void m_glWindowPos2dvARB_profiling(const GLdouble* v)const{auto const profilingStart=this->profiler.begin(2220);(this->*((FunctionTable::MEMBERPFNGLWINDOWPOS2DVARBPROC)this->m_profiledFunctions[2220]))(v);this->profiler.end(2220,profilingStart);}
+void m_glClearBufferfi_profiling(GLenum buffer,GLint drawbuffer,GLfloat depth,GLint stencil)const{auto const profilingStart=this->profiler.begin(2221);(this->*((FunctionTable::MEMBERPFNGLCLEARBUFFERFIPROC)this->m_profiledFunctions[2221]))(buffer,drawbuffer,depth,stencil);this->profiler.end(2221,profilingStart);}
+void m_glDrawArraysIndirect_profiling(GLenum mode,const void* indirect)const{auto const profilingStart=this->profiler.begin(2222);(this->*((FunctionTable::MEMBERPFNGLDRAWARRAYSINDIRECTPROC)this->m_profiledFunctions[2222]))(mode,indirect);this->profiler.end(2222,profilingStart);}
+void m_glGenVertexArrays_profiling(GLsizei n,GLuint* arrays)const{auto const profilingStart=this->profiler.begin(2223);(this->*((FunctionTable::MEMBERPFNGLGENVERTEXARRAYSPROC)this->m_profiledFunctions[2223]))(n,arrays);this->profiler.end(2223,profilingStart);}
+void m_glGetTransformFeedbacki64_v_profiling(GLuint xfb,GLenum pname,GLuint index,GLint64* param)const{auto const profilingStart=this->profiler.begin(2224);(this->*((FunctionTable::MEMBERPFNGLGETTRANSFORMFEEDBACKI64_VPROC)this->m_profiledFunctions[2224]))(xfb,pname,index,param);this->profiler.end(2224,profilingStart);}
+void m_glEnableVertexArrayAttrib_profiling(GLuint vaobj,GLuint index)const{auto const profilingStart=this->profiler.begin(2225);(this->*((FunctionTable::MEMBERPFNGLENABLEVERTEXARRAYATTRIBPROC)this->m_profiledFunctions[2225]))(vaobj,index);this->profiler.end(2225,profilingStart);}
+void m_glProgramUniformMatrix3x2dv_profiling(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{auto const profilingStart=this->profiler.begin(2226);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X2DVPROC)this->m_profiledFunctions[2226]))(program,location,count,transpose,value);this->profiler.end(2226,profilingStart);}
+void m_glVertexStream4fATI_profiling(GLenum stream,GLfloat x,GLfloat y,GLfloat z,GLfloat w)const{auto const profilingStart=this->profiler.begin(2227);(this->*((FunctionTable::MEMBERPFNGLVERTEXSTREAM4FATIPROC)this->m_profiledFunctions[2227]))(stream,x,y,z,w);this->profiler.end(2227,profilingStart);}
+void m_glVertexBindingDivisor_profiling(GLuint bindingindex,GLuint divisor)const{auto const profilingStart=this->profiler.begin(2228);(this->*((FunctionTable::MEMBERPFNGLVERTEXBINDINGDIVISORPROC)this->m_profiledFunctions[2228]))(bindingindex,divisor);this->profiler.end(2228,profilingStart);}
+void m_glGetSamplerParameterIiv_profiling(GLuint sampler,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(2229);(this->*((FunctionTable::MEMBERPFNGLGETSAMPLERPARAMETERIIVPROC)this->m_profiledFunctions[2229]))(sampler,pname,params);this->profiler.end(2229,profilingStart);}
+void m_glGetCoverageModulationTableNV_profiling(GLsizei bufsize,GLfloat* v)const{auto const profilingStart=this->profiler.begin(2230);(this->*((FunctionTable::MEMBERPFNGLGETCOVERAGEMODULATIONTABLENVPROC)this->m_profiledFunctions[2230]))(bufsize,v);this->profiler.end(2230,profilingStart);}
+void m_glDepthRangedNV_profiling(GLdouble zNear,GLdouble zFar)const{auto const profilingStart=this->profiler.begin(2231);(this->*((FunctionTable::MEMBERPFNGLDEPTHRANGEDNVPROC)this->m_profiledFunctions[2231]))(zNear,zFar);this->profiler.end(2231,profilingStart);}
+void m_glVertexAttrib3f_profiling(GLuint index,GLfloat x,GLfloat y,GLfloat z)const{auto const profilingStart=this->profiler.begin(2232);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB3FPROC)this->m_profiledFunctions[2232]))(index,x,y,z);this->profiler.end(2232,profilingStart);}
+void m_glMultiDrawRangeElementArrayAPPLE_profiling(GLenum mode,GLuint start,GLuint end,const GLint* first,const GLsizei* count,GLsizei primcount)const{auto const profilingStart=this->profiler.begin(2233);(this->*((FunctionTable::MEMBERPFNGLMULTIDRAWRANGEELEMENTARRAYAPPLEPROC)this->m_profiledFunctions[2233]))(mode,start,end,first,count,primcount);this->profiler.end(2233,profilingStart);}
+void m_glVertexAttribFormatNV_profiling(GLuint index,GLint size,GLenum type,GLboolean normalized,GLsizei stride)const{auto const profilingStart=this->profiler.begin(2234);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBFORMATNVPROC)this->m_profiledFunctions[2234]))(index,size,type,normalized,stride);this->profiler.end(2234,profilingStart);}
+void m_glGetQueryBufferObjecti64v_profiling(GLuint id,GLuint buffer,GLenum pname,GLintptr offset)const{auto const profilingStart=this->profiler.begin(2235);(this->*((FunctionTable::MEMBERPFNGLGETQUERYBUFFEROBJECTI64VPROC)this->m_profiledFunctions[2235]))(id,buffer,pname,offset);this->profiler.end(2235,profilingStart);}
+void m_glGetVertexAttribdv_profiling(GLuint index,GLenum pname,GLdouble* params)const{auto const profilingStart=this->profiler.begin(2236);(this->*((FunctionTable::MEMBERPFNGLGETVERTEXATTRIBDVPROC)this->m_profiledFunctions[2236]))(index,pname,params);this->profiler.end(2236,profilingStart);}
+void m_glGetUniformi64vARB_profiling(GLuint program,GLint location,GLint64* params)const{auto const profilingStart=this->profiler.begin(2237);(this->*((FunctionTable::MEMBERPFNGLGETUNIFORMI64VARBPROC)this->m_profiledFunctions[2237]))(program,location,params);this->profiler.end(2237,profilingStart);}
+GLboolean m_glAreTexturesResidentEXT_profiling(GLsizei n,const GLuint* textures,GLboolean* residences)const{auto const profilingStart=this->profiler.begin(2238);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLARETEXTURESRESIDENTEXTPROC)this->m_profiledFunctions[2238]))(n,textures,residences);this->profiler.end(2238,profilingStart);return profilingResult;}
+GLhandleARB m_glGetHandleARB_profiling(GLenum pname)const{auto const profilingStart=this->profiler.begin(2239);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLGETHANDLEARBPROC)this->m_profiledFunctions[2239]))(pname);this->profiler.end(2239,profilingStart);return profilingResult;}
+void m_glVideoCaptureStreamParameterdvNV_profiling(GLuint video_capture_slot,GLuint stream,GLenum pname,const GLdouble* params)const{auto const profilingStart=this->profiler.begin(2240);(this->*((FunctionTable::MEMBERPFNGLVIDEOCAPTURESTREAMPARAMETERDVNVPROC)this->m_profiledFunctions[2240]))(video_capture_slot,stream,pname,params);this->profiler.end(2240,profilingStart);}
+void m_glMapParameterivNV_profiling(GLenum target,GLenum pname,const GLint* params)const{auto const profilingStart=this->profiler.begin(2241);(this->*((FunctionTable::MEMBERPFNGLMAPPARAMETERIVNVPROC)this->m_profiledFunctions[2241]))(target,pname,params);this->profiler.end(2241,profilingStart);}
+GLboolean m_glIsVertexArray_profiling(GLuint array)const{auto const profilingStart=this->profiler.begin(2242);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLISVERTEXARRAYPROC)this->m_profiledFunctions[2242]))(array);this->profiler.end(2242,profilingStart);return profilingResult;}
+void m_glSecondaryColor3sEXT_profiling(GLshort red,GLshort green,GLshort blue)const{auto const profilingStart=this->profiler.begin(2243);(this->*((FunctionTable::MEMBERPFNGLSECONDARYCOLOR3SEXTPROC)this->m_profiledFunctions[2243]))(red,green,blue);this->profiler.end(2243,profilingStart);}
+void m_glGetTexParameterIivEXT_profiling(GLenum target,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(2244);(this->*((FunctionTable::MEMBERPFNGLGETTEXPARAMETERIIVEXTPROC)this->m_profiledFunctions[2244]))(target,pname,params);this->profiler.end(2244,profilingStart);}
+void m_glFrameTerminatorGREMEDY_profiling()const{auto const profilingStart=this->profiler.begin(2245);(this->*((FunctionTable::MEMBERPFNGLFRAMETERMINATORGREMEDYPROC)this->m_profiledFunctions[2245]))();this->profiler.end(2245,profilingStart);}
+void m_glBlendBarrierKHR_profiling()const{auto const profilingStart=this->profiler.begin(2246);(this->*((FunctionTable::MEMBERPFNGLBLENDBARRIERKHRPROC)this->m_profiledFunctions[2246]))();this->profiler.end(2246,profilingStart);}
+void m_glVertexAttrib4NubARB_profiling(GLuint index,GLubyte x,GLubyte y,GLubyte z,GLubyte w)const{auto const profilingStart=this->profiler.begin(2247);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUBARBPROC)this->m_profiledFunctions[2247]))(index,x,y,z,w);this->profiler.end(2247,profilingStart);}
+void m_glPrimitiveRestartNV_profiling()const{auto const profilingStart=this->profiler.begin(2248);(this->*((FunctionTable::MEMBERPFNGLPRIMITIVERESTARTNVPROC)this->m_profiledFunctions[2248]))();this->profiler.end(2248,profilingStart);}
+void m_glVertexAttribL1ui64vARB_profiling(GLuint index,const GLuint64EXT* v)const{auto const profilingStart=this->profiler.begin(2249);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBL1UI64VARBPROC)this->m_profiledFunctions[2249]))(index,v);this->profiler.end(2249,profilingStart);}
+void m_glVertexAttribI4ivEXT_profiling(GLuint index,const GLint* v)const{auto const profilingStart=this->profiler.begin(2250);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBI4IVEXTPROC)this->m_profiledFunctions[2250]))(index,v);this->profiler.end(2250,profilingStart);}
+void m_glVertexAttribs4svNV_profiling(GLuint index,GLsizei count,const GLshort* v)const{auto const profilingStart=this->profiler.begin(2251);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBS4SVNVPROC)this->m_profiledFunctions[2251]))(index,count,v);this->profiler.end(2251,profilingStart);}
+void m_glUniform1ui_profiling(GLint location,GLuint v0)const{auto const profilingStart=this->profiler.begin(2252);(this->*((FunctionTable::MEMBERPFNGLUNIFORM1UIPROC)this->m_profiledFunctions[2252]))(location,v0);this->profiler.end(2252,profilingStart);}
+void m_glVertexAttrib2fvARB_profiling(GLuint index,const GLfloat* v)const{auto const profilingStart=this->profiler.begin(2253);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB2FVARBPROC)this->m_profiledFunctions[2253]))(index,v);this->profiler.end(2253,profilingStart);}
+void m_glVertexAttribI4svEXT_profiling(GLuint index,const GLshort* v)const{auto const profilingStart=this->profiler.begin(2254);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBI4SVEXTPROC)this->m_profiledFunctions[2254]))(index,v);this->profiler.end(2254,profilingStart);}
+void m_glTextureImage3DMultisampleCoverageNV_profiling(GLuint texture,GLenum target,GLsizei coverageSamples,GLsizei colorSamples,GLint internalFormat,GLsizei width,GLsizei height,GLsizei depth,GLboolean fixedSampleLocations)const{auto const profilingStart=this->profiler.begin(2255);(this->*((FunctionTable::MEMBERPFNGLTEXTUREIMAGE3DMULTISAMPLECOVERAGENVPROC)this->m_profiledFunctions[2255]))(texture,target,coverageSamples,colorSamples,internalFormat,width,height,depth,fixedSampleLocations);this->profiler.end(2255,profilingStart);}
+void m_glMemoryBarrier_profiling(GLbitfield barriers)const{auto const profilingStart=this->profiler.begin(2256);(this->*((FunctionTable::MEMBERPFNGLMEMORYBARRIERPROC)this->m_profiledFunctions[2256]))(barriers);this->profiler.end(2256,profilingStart);}
+void m_glGetVariantArrayObjectfvATI_profiling(GLuint id,GLenum pname,GLfloat* params)const{auto const profilingStart=this->profiler.begin(2257);(this->*((FunctionTable::MEMBERPFNGLGETVARIANTARRAYOBJECTFVATIPROC)this->m_profiledFunctions[2257]))(id,pname,params);this->profiler.end(2257,profilingStart);}
+void m_glTexCoord4fColor4fNormal3fVertex4fvSUN_profiling(const GLfloat* tc,const GLfloat* c,const GLfloat* n,const GLfloat* v)const{auto const profilingStart=this->profiler.begin(2258);(this->*((FunctionTable::MEMBERPFNGLTEXCOORD4FCOLOR4FNORMAL3FVERTEX4FVSUNPROC)this->m_profiledFunctions[2258]))(tc,c,n,v);this->profiler.end(2258,profilingStart);}
+GLboolean m_glIsProgramARB_profiling(GLuint program)const{auto const profilingStart=this->profiler.begin(2259);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLISPROGRAMARBPROC)this->m_profiledFunctions[2259]))(program);this->profiler.end(2259,profilingStart);return profilingResult;}
+void m_glBindImageTextureEXT_profiling(GLuint index,GLuint texture,GLint level,GLboolean layered,GLint layer,GLenum access,GLint format)const{auto const profilingStart=this->profiler.begin(2260);(this->*((FunctionTable::MEMBERPFNGLBINDIMAGETEXTUREEXTPROC)this->m_profiledFunctions[2260]))(index,texture,level,layered,layer,access,format);this->profiler.end(2260,profilingStart);}
+GLint m_glGetFragDataLocation_profiling(GLuint program,const GLchar* name)const{auto const profilingStart=this->profiler.begin(2261);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLGETFRAGDATALOCATIONPROC)this->m_profiledFunctions[2261]))(program,name);this->profiler.end(2261,profilingStart);return profilingResult;}
+void m_glMultiTexCoord1svARB_profiling(GLenum target,const GLshort* v)const{auto const profilingStart=this->profiler.begin(2262);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD1SVARBPROC)this->m_profiledFunctions[2262]))(target,v);this->profiler.end(2262,profilingStart);}
+void m_glGetMapxvOES_profiling(GLenum target,GLenum query,GLfixed* v)const{auto const profilingStart=this->profiler.begin(2263);(this->*((FunctionTable::MEMBERPFNGLGETMAPXVOESPROC)this->m_profiledFunctions[2263]))(target,query,v);this->profiler.end(2263,profilingStart);}
+void m_glTextureStorage2DMultisampleEXT_profiling(GLuint texture,GLenum target,GLsizei samples,GLenum internalformat,GLsizei width,GLsizei height,GLboolean fixedsamplelocations)const{auto const profilingStart=this->profiler.begin(2264);(this->*((FunctionTable::MEMBERPFNGLTEXTURESTORAGE2DMULTISAMPLEEXTPROC)this->m_profiledFunctions[2264]))(texture,target,samples,internalformat,width,height,fixedsamplelocations);this->profiler.end(2264,profilingStart);}
+void m_glGetMaterialfv_profiling(GLenum face,GLenum pname,GLfloat* params)const{auto const profilingStart=this->profiler.begin(2265);(this->*((FunctionTable::MEMBERPFNGLGETMATERIALFVPROC)this->m_profiledFunctions[2265]))(face,pname,params);this->profiler.end(2265,profilingStart);}
+void m_glVertexAttrib4NbvARB_profiling(GLuint index,const GLbyte* v)const{auto const profilingStart=this->profiler.begin(2266);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB4NBVARBPROC)this->m_profiledFunctions[2266]))(index,v);this->profiler.end(2266,profilingStart);}
+void m_glPixelMapuiv_profiling(GLenum map,GLsizei mapsize,const GLuint* values)const{auto const profilingStart=this->profiler.begin(2267);(this->*((FunctionTable::MEMBERPFNGLPIXELMAPUIVPROC)this->m_profiledFunctions[2267]))(map,mapsize,values);this->profiler.end(2267,profilingStart);}
+void m_glColorPointerEXT_profiling(GLint size,GLenum type,GLsizei stride,GLsizei count,const void* pointer)const{auto const profilingStart=this->profiler.begin(2268);(this->*((FunctionTable::MEMBERPFNGLCOLORPOINTEREXTPROC)this->m_profiledFunctions[2268]))(size,type,stride,count,pointer);this->profiler.end(2268,profilingStart);}
+void m_glEnableClientStateiEXT_profiling(GLenum array,GLuint index)const{auto const profilingStart=this->profiler.begin(2269);(this->*((FunctionTable::MEMBERPFNGLENABLECLIENTSTATEIEXTPROC)this->m_profiledFunctions[2269]))(array,index);this->profiler.end(2269,profilingStart);}
+void m_glClearTexSubImage_profiling(GLuint texture,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLenum format,GLenum type,const void* data)const{auto const profilingStart=this->profiler.begin(2270);(this->*((FunctionTable::MEMBERPFNGLCLEARTEXSUBIMAGEPROC)this->m_profiledFunctions[2270]))(texture,level,xoffset,yoffset,zoffset,width,height,depth,format,type,data);this->profiler.end(2270,profilingStart);}
+void m_glEvalCoord1xvOES_profiling(const GLfixed* coords)const{auto const profilingStart=this->profiler.begin(2271);(this->*((FunctionTable::MEMBERPFNGLEVALCOORD1XVOESPROC)this->m_profiledFunctions[2271]))(coords);this->profiler.end(2271,profilingStart);}
+void m_glDetachObjectARB_profiling(GLhandleARB containerObj,GLhandleARB attachedObj)const{auto const profilingStart=this->profiler.begin(2272);(this->*((FunctionTable::MEMBERPFNGLDETACHOBJECTARBPROC)this->m_profiledFunctions[2272]))(containerObj,attachedObj);this->profiler.end(2272,profilingStart);}
+void m_glGetTextureParameterIiv_profiling(GLuint texture,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(2273);(this->*((FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERIIVPROC)this->m_profiledFunctions[2273]))(texture,pname,params);this->profiler.end(2273,profilingStart);}
+void m_glVariantusvEXT_profiling(GLuint id,const GLushort* addr)const{auto const profilingStart=this->profiler.begin(2274);(this->*((FunctionTable::MEMBERPFNGLVARIANTUSVEXTPROC)this->m_profiledFunctions[2274]))(id,addr);this->profiler.end(2274,profilingStart);}
+void m_glCompressedTextureImage3DEXT_profiling(GLuint texture,GLenum target,GLint level,GLenum internalformat,GLsizei width,GLsizei height,GLsizei depth,GLint border,GLsizei imageSize,const void* bits)const{auto const profilingStart=this->profiler.begin(2275);(this->*((FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTUREIMAGE3DEXTPROC)this->m_profiledFunctions[2275]))(texture,target,level,internalformat,width,height,depth,border,imageSize,bits);this->profiler.end(2275,profilingStart);}
+void m_glMultiTexCoord1dARB_profiling(GLenum target,GLdouble s)const{auto const profilingStart=this->profiler.begin(2276);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD1DARBPROC)this->m_profiledFunctions[2276]))(target,s);this->profiler.end(2276,profilingStart);}
+void m_glGetVertexArrayIntegeri_vEXT_profiling(GLuint vaobj,GLuint index,GLenum pname,GLint* param)const{auto const profilingStart=this->profiler.begin(2277);(this->*((FunctionTable::MEMBERPFNGLGETVERTEXARRAYINTEGERI_VEXTPROC)this->m_profiledFunctions[2277]))(vaobj,index,pname,param);this->profiler.end(2277,profilingStart);}
+void m_glVertexAttribI4ubv_profiling(GLuint index,const GLubyte* v)const{auto const profilingStart=this->profiler.begin(2278);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBI4UBVPROC)this->m_profiledFunctions[2278]))(index,v);this->profiler.end(2278,profilingStart);}
+void m_glPixelTexGenParameterfSGIS_profiling(GLenum pname,GLfloat param)const{auto const profilingStart=this->profiler.begin(2279);(this->*((FunctionTable::MEMBERPFNGLPIXELTEXGENPARAMETERFSGISPROC)this->m_profiledFunctions[2279]))(pname,param);this->profiler.end(2279,profilingStart);}
+void m_glProgramUniformMatrix4x2dv_profiling(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{auto const profilingStart=this->profiler.begin(2280);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X2DVPROC)this->m_profiledFunctions[2280]))(program,location,count,transpose,value);this->profiler.end(2280,profilingStart);}
+void m_glUniform3fARB_profiling(GLint location,GLfloat v0,GLfloat v1,GLfloat v2)const{auto const profilingStart=this->profiler.begin(2281);(this->*((FunctionTable::MEMBERPFNGLUNIFORM3FARBPROC)this->m_profiledFunctions[2281]))(location,v0,v1,v2);this->profiler.end(2281,profilingStart);}
+GLboolean m_glIsShader_profiling(GLuint shader)const{auto const profilingStart=this->profiler.begin(2282);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLISSHADERPROC)this->m_profiledFunctions[2282]))(shader);this->profiler.end(2282,profilingStart);return profilingResult;}
+void m_glConvolutionParameteriv_profiling(GLenum target,GLenum pname,const GLint* params)const{auto const profilingStart=this->profiler.begin(2283);(this->*((FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERIVPROC)this->m_profiledFunctions[2283]))(target,pname,params);this->profiler.end(2283,profilingStart);}
+void m_glCopyMultiTexSubImage2DEXT_profiling(GLenum texunit,GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint x,GLint y,GLsizei width,GLsizei height)const{auto const profilingStart=this->profiler.begin(2284);(this->*((FunctionTable::MEMBERPFNGLCOPYMULTITEXSUBIMAGE2DEXTPROC)this->m_profiledFunctions[2284]))(texunit,target,level,xoffset,yoffset,x,y,width,height);this->profiler.end(2284,profilingStart);}
+void m_glEnableVertexAttribArrayARB_profiling(GLuint index)const{auto const profilingStart=this->profiler.begin(2285);(this->*((FunctionTable::MEMBERPFNGLENABLEVERTEXATTRIBARRAYARBPROC)this->m_profiledFunctions[2285]))(index);this->profiler.end(2285,profilingStart);}
+void m_glEnable_profiling(GLenum cap)const{auto const profilingStart=this->profiler.begin(2286);(this->*((FunctionTable::MEMBERPFNGLENABLEPROC)this->m_profiledFunctions[2286]))(cap);this->profiler.end(2286,profilingStart);}
+void m_glGetActiveUniformsiv_profiling(GLuint program,GLsizei uniformCount,const GLuint* uniformIndices,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(2287);(this->*((FunctionTable::MEMBERPFNGLGETACTIVEUNIFORMSIVPROC)this->m_profiledFunctions[2287]))(program,uniformCount,uniformIndices,pname,params);this->profiler.end(2287,profilingStart);}
+void m_glGetVertexAttribivARB_profiling(GLuint index,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(2288);(this->*((FunctionTable::MEMBERPFNGLGETVERTEXATTRIBIVARBPROC)this->m_profiledFunctions[2288]))(index,pname,params);this->profiler.end(2288,profilingStart);}
+void m_glTexCoord4hvNV_profiling(const GLhalfNV* v)const{auto const profilingStart=this->profiler.begin(2289);(this->*((FunctionTable::MEMBERPFNGLTEXCOORD4HVNVPROC)this->m_profiledFunctions[2289]))(v);this->profiler.end(2289,profilingStart);}
+void m_glUseProgramObjectARB_profiling(GLhandleARB programObj)const{auto const profilingStart=this->profiler.begin(2290);(this->*((FunctionTable::MEMBERPFNGLUSEPROGRAMOBJECTARBPROC)this->m_profiledFunctions[2290]))(programObj);this->profiler.end(2290,profilingStart);}
+GLint m_glGetAttribLocation_profiling(GLuint program,const GLchar* name)const{auto const profilingStart=this->profiler.begin(2291);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLGETATTRIBLOCATIONPROC)this->m_profiledFunctions[2291]))(program,name);this->profiler.end(2291,profilingStart);return profilingResult;}
+void m_glVertexAttrib4dv_profiling(GLuint index,const GLdouble* v)const{auto const profilingStart=this->profiler.begin(2292);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB4DVPROC)this->m_profiledFunctions[2292]))(index,v);this->profiler.end(2292,profilingStart);}
+void m_glGetTextureParameteriv_profiling(GLuint texture,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(2293);(this->*((FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERIVPROC)this->m_profiledFunctions[2293]))(texture,pname,params);this->profiler.end(2293,profilingStart);}
+void m_glPathSubCoordsNV_profiling(GLuint path,GLsizei coordStart,GLsizei numCoords,GLenum coordType,const void* coords)const{auto const profilingStart=this->profiler.begin(2294);(this->*((FunctionTable::MEMBERPFNGLPATHSUBCOORDSNVPROC)this->m_profiledFunctions[2294]))(path,coordStart,numCoords,coordType,coords);this->profiler.end(2294,profilingStart);}
+void m_glMatrixIndexusvARB_profiling(GLint size,const GLushort* indices)const{auto const profilingStart=this->profiler.begin(2295);(this->*((FunctionTable::MEMBERPFNGLMATRIXINDEXUSVARBPROC)this->m_profiledFunctions[2295]))(size,indices);this->profiler.end(2295,profilingStart);}
+void m_glGetVideouivNV_profiling(GLuint video_slot,GLenum pname,GLuint* params)const{auto const profilingStart=this->profiler.begin(2296);(this->*((FunctionTable::MEMBERPFNGLGETVIDEOUIVNVPROC)this->m_profiledFunctions[2296]))(video_slot,pname,params);this->profiler.end(2296,profilingStart);}
+void m_glGetVideoCaptureivNV_profiling(GLuint video_capture_slot,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(2297);(this->*((FunctionTable::MEMBERPFNGLGETVIDEOCAPTUREIVNVPROC)this->m_profiledFunctions[2297]))(video_capture_slot,pname,params);this->profiler.end(2297,profilingStart);}
+void m_glProgramUniform3ui_profiling(GLuint program,GLint location,GLuint v0,GLuint v1,GLuint v2)const{auto const profilingStart=this->profiler.begin(2298);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UIPROC)this->m_profiledFunctions[2298]))(program,location,v0,v1,v2);this->profiler.end(2298,profilingStart);}
+void m_glVertexAttrib3svARB_profiling(GLuint index,const GLshort* v)const{auto const profilingStart=this->profiler.begin(2299);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB3SVARBPROC)this->m_profiledFunctions[2299]))(index,v);this->profiler.end(2299,profilingStart);}
+void m_glGetNamedBufferParameterivEXT_profiling(GLuint buffer,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(2300);(this->*((FunctionTable::MEMBERPFNGLGETNAMEDBUFFERPARAMETERIVEXTPROC)this->m_profiledFunctions[2300]))(buffer,pname,params);this->profiler.end(2300,profilingStart);}
+void m_glMatrixScaledEXT_profiling(GLenum mode,GLdouble x,GLdouble y,GLdouble z)const{auto const profilingStart=this->profiler.begin(2301);(this->*((FunctionTable::MEMBERPFNGLMATRIXSCALEDEXTPROC)this->m_profiledFunctions[2301]))(mode,x,y,z);this->profiler.end(2301,profilingStart);}
+void m_glProgramUniformMatrix2x3fv_profiling(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{auto const profilingStart=this->profiler.begin(2302);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X3FVPROC)this->m_profiledFunctions[2302]))(program,location,count,transpose,value);this->profiler.end(2302,profilingStart);}
+void m_glGetFragmentLightivSGIX_profiling(GLenum light,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(2303);(this->*((FunctionTable::MEMBERPFNGLGETFRAGMENTLIGHTIVSGIXPROC)this->m_profiledFunctions[2303]))(light,pname,params);this->profiler.end(2303,profilingStart);}
+void m_glWindowPos2svARB_profiling(const GLshort* v)const{auto const profilingStart=this->profiler.begin(2304);(this->*((FunctionTable::MEMBERPFNGLWINDOWPOS2SVARBPROC)this->m_profiledFunctions[2304]))(v);this->profiler.end(2304,profilingStart);}
+void m_glVertexAttrib2svNV_profiling(GLuint index,const GLshort* v)const{auto const profilingStart=this->profiler.begin(2305);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB2SVNVPROC)this->m_profiledFunctions[2305]))(index,v);this->profiler.end(2305,profilingStart);}
+void m_glWindowPos2ivARB_profiling(const GLint* v)const{auto const profilingStart=this->profiler.begin(2306);(this->*((FunctionTable::MEMBERPFNGLWINDOWPOS2IVARBPROC)this->m_profiledFunctions[2306]))(v);this->profiler.end(2306,profilingStart);}
+void m_glGetVertexAttribPointervNV_profiling(GLuint index,GLenum pname,void** pointer)const{auto const profilingStart=this->profiler.begin(2307);(this->*((FunctionTable::MEMBERPFNGLGETVERTEXATTRIBPOINTERVNVPROC)this->m_profiledFunctions[2307]))(index,pname,pointer);this->profiler.end(2307,profilingStart);}
+void m_glPushMatrix_profiling()const{auto const profilingStart=this->profiler.begin(2308);(this->*((FunctionTable::MEMBERPFNGLPUSHMATRIXPROC)this->m_profiledFunctions[2308]))();this->profiler.end(2308,profilingStart);}
+void m_glEdgeFlagPointerListIBM_profiling(GLint stride,const GLboolean** pointer,GLint ptrstride)const{auto const profilingStart=this->profiler.begin(2309);(this->*((FunctionTable::MEMBERPFNGLEDGEFLAGPOINTERLISTIBMPROC)this->m_profiledFunctions[2309]))(stride,pointer,ptrstride);this->profiler.end(2309,profilingStart);}
+void m_glGenerateMipmapEXT_profiling(GLenum target)const{auto const profilingStart=this->profiler.begin(2310);(this->*((FunctionTable::MEMBERPFNGLGENERATEMIPMAPEXTPROC)this->m_profiledFunctions[2310]))(target);this->profiler.end(2310,profilingStart);}
+void m_glWindowPos3sv_profiling(const GLshort* v)const{auto const profilingStart=this->profiler.begin(2311);(this->*((FunctionTable::MEMBERPFNGLWINDOWPOS3SVPROC)this->m_profiledFunctions[2311]))(v);this->profiler.end(2311,profilingStart);}
+void m_glPathCoordsNV_profiling(GLuint path,GLsizei numCoords,GLenum coordType,const void* coords)const{auto const profilingStart=this->profiler.begin(2312);(this->*((FunctionTable::MEMBERPFNGLPATHCOORDSNVPROC)this->m_profiledFunctions[2312]))(path,numCoords,coordType,coords);this->profiler.end(2312,profilingStart);}
+void m_glProgramUniform1i_profiling(GLuint program,GLint location,GLint v0)const{auto const profilingStart=this->profiler.begin(2313);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1IPROC)this->m_profiledFunctions[2313]))(program,location,v0);this->profiler.end(2313,profilingStart);}
+void m_glProgramUniform1d_profiling(GLuint program,GLint location,GLdouble v0)const{auto const profilingStart=this->profiler.begin(2314);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1DPROC)this->m_profiledFunctions[2314]))(program,location,v0);this->profiler.end(2314,profilingStart);}
+void m_glProgramUniform1f_profiling(GLuint program,GLint location,GLfloat v0)const{auto const profilingStart=this->profiler.begin(2315);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1FPROC)this->m_profiledFunctions[2315]))(program,location,v0);this->profiler.end(2315,profilingStart);}
+void m_glProgramParameteriEXT_profiling(GLuint program,GLenum pname,GLint value)const{auto const profilingStart=this->profiler.begin(2316);(this->*((FunctionTable::MEMBERPFNGLPROGRAMPARAMETERIEXTPROC)this->m_profiledFunctions[2316]))(program,pname,value);this->profiler.end(2316,profilingStart);}
+void m_glCompressedMultiTexImage2DEXT_profiling(GLenum texunit,GLenum target,GLint level,GLenum internalformat,GLsizei width,GLsizei height,GLint border,GLsizei imageSize,const void* bits)const{auto const profilingStart=this->profiler.begin(2317);(this->*((FunctionTable::MEMBERPFNGLCOMPRESSEDMULTITEXIMAGE2DEXTPROC)this->m_profiledFunctions[2317]))(texunit,target,level,internalformat,width,height,border,imageSize,bits);this->profiler.end(2317,profilingStart);}
+void m_glProgramUniform3iv_profiling(GLuint program,GLint location,GLsizei count,const GLint* value)const{auto const profilingStart=this->profiler.begin(2318);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3IVPROC)this->m_profiledFunctions[2318]))(program,location,count,value);this->profiler.end(2318,profilingStart);}
+void m_glIndexiv_profiling(const GLint* c)const{auto const profilingStart=this->profiler.begin(2319);(this->*((FunctionTable::MEMBERPFNGLINDEXIVPROC)this->m_profiledFunctions[2319]))(c);this->profiler.end(2319,profilingStart);}
+void m_glMultiTexCoord4xvOES_profiling(GLenum texture,const GLfixed* coords)const{auto const profilingStart=this->profiler.begin(2320);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD4XVOESPROC)this->m_profiledFunctions[2320]))(texture,coords);this->profiler.end(2320,profilingStart);}
+void m_glEGLImageTargetTexture2DOES_profiling(GLenum target,GLeglImageOES image)const{auto const profilingStart=this->profiler.begin(2321);(this->*((FunctionTable::MEMBERPFNGLEGLIMAGETARGETTEXTURE2DOESPROC)this->m_profiledFunctions[2321]))(target,image);this->profiler.end(2321,profilingStart);}
+void m_glPixelZoom_profiling(GLfloat xfactor,GLfloat yfactor)const{auto const profilingStart=this->profiler.begin(2322);(this->*((FunctionTable::MEMBERPFNGLPIXELZOOMPROC)this->m_profiledFunctions[2322]))(xfactor,yfactor);this->profiler.end(2322,profilingStart);}
+void m_glVertex3bvOES_profiling(const GLbyte* coords)const{auto const profilingStart=this->profiler.begin(2323);(this->*((FunctionTable::MEMBERPFNGLVERTEX3BVOESPROC)this->m_profiledFunctions[2323]))(coords);this->profiler.end(2323,profilingStart);}
+void m_glFramebufferReadBufferEXT_profiling(GLuint framebuffer,GLenum mode)const{auto const profilingStart=this->profiler.begin(2324);(this->*((FunctionTable::MEMBERPFNGLFRAMEBUFFERREADBUFFEREXTPROC)this->m_profiledFunctions[2324]))(framebuffer,mode);this->profiler.end(2324,profilingStart);}
+void m_glExtractComponentEXT_profiling(GLuint res,GLuint src,GLuint num)const{auto const profilingStart=this->profiler.begin(2325);(this->*((FunctionTable::MEMBERPFNGLEXTRACTCOMPONENTEXTPROC)this->m_profiledFunctions[2325]))(res,src,num);this->profiler.end(2325,profilingStart);}
+void m_glCombinerParameterivNV_profiling(GLenum pname,const GLint* params)const{auto const profilingStart=this->profiler.begin(2326);(this->*((FunctionTable::MEMBERPFNGLCOMBINERPARAMETERIVNVPROC)this->m_profiledFunctions[2326]))(pname,params);this->profiler.end(2326,profilingStart);}
+void m_glMinmax_profiling(GLenum target,GLenum internalformat,GLboolean sink)const{auto const profilingStart=this->profiler.begin(2327);(this->*((FunctionTable::MEMBERPFNGLMINMAXPROC)this->m_profiledFunctions[2327]))(target,internalformat,sink);this->profiler.end(2327,profilingStart);}
+void m_glGenBuffersARB_profiling(GLsizei n,GLuint* buffers)const{auto const profilingStart=this->profiler.begin(2328);(this->*((FunctionTable::MEMBERPFNGLGENBUFFERSARBPROC)this->m_profiledFunctions[2328]))(n,buffers);this->profiler.end(2328,profilingStart);}
+void m_glColor3usv_profiling(const GLushort* v)const{auto const profilingStart=this->profiler.begin(2329);(this->*((FunctionTable::MEMBERPFNGLCOLOR3USVPROC)this->m_profiledFunctions[2329]))(v);this->profiler.end(2329,profilingStart);}
+void m_glBlendEquationi_profiling(GLuint buf,GLenum mode)const{auto const profilingStart=this->profiler.begin(2330);(this->*((FunctionTable::MEMBERPFNGLBLENDEQUATIONIPROC)this->m_profiledFunctions[2330]))(buf,mode);this->profiler.end(2330,profilingStart);}
+void m_glGetFogFuncSGIS_profiling(GLfloat* points)const{auto const profilingStart=this->profiler.begin(2331);(this->*((FunctionTable::MEMBERPFNGLGETFOGFUNCSGISPROC)this->m_profiledFunctions[2331]))(points);this->profiler.end(2331,profilingStart);}
+void m_glVertexAttrib4fvNV_profiling(GLuint index,const GLfloat* v)const{auto const profilingStart=this->profiler.begin(2332);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB4FVNVPROC)this->m_profiledFunctions[2332]))(index,v);this->profiler.end(2332,profilingStart);}
+void m_glGetnMinmax_profiling(GLenum target,GLboolean reset,GLenum format,GLenum type,GLsizei bufSize,void* values)const{auto const profilingStart=this->profiler.begin(2333);(this->*((FunctionTable::MEMBERPFNGLGETNMINMAXPROC)this->m_profiledFunctions[2333]))(target,reset,format,type,bufSize,values);this->profiler.end(2333,profilingStart);}
+void m_glFragmentLightiSGIX_profiling(GLenum light,GLenum pname,GLint param)const{auto const profilingStart=this->profiler.begin(2334);(this->*((FunctionTable::MEMBERPFNGLFRAGMENTLIGHTISGIXPROC)this->m_profiledFunctions[2334]))(light,pname,param);this->profiler.end(2334,profilingStart);}
+void m_glMultiTexCoord1bvOES_profiling(GLenum texture,const GLbyte* coords)const{auto const profilingStart=this->profiler.begin(2335);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD1BVOESPROC)this->m_profiledFunctions[2335]))(texture,coords);this->profiler.end(2335,profilingStart);}
+void m_glSecondaryColorPointerEXT_profiling(GLint size,GLenum type,GLsizei stride,const void* pointer)const{auto const profilingStart=this->profiler.begin(2336);(this->*((FunctionTable::MEMBERPFNGLSECONDARYCOLORPOINTEREXTPROC)this->m_profiledFunctions[2336]))(size,type,stride,pointer);this->profiler.end(2336,profilingStart);}
+void m_glMultiTexCoordP4uiv_profiling(GLenum texture,GLenum type,const GLuint* coords)const{auto const profilingStart=this->profiler.begin(2337);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORDP4UIVPROC)this->m_profiledFunctions[2337]))(texture,type,coords);this->profiler.end(2337,profilingStart);}
+void m_glGetBufferSubDataARB_profiling(GLenum target,GLintptrARB offset,GLsizeiptrARB size,void* data)const{auto const profilingStart=this->profiler.begin(2338);(this->*((FunctionTable::MEMBERPFNGLGETBUFFERSUBDATAARBPROC)this->m_profiledFunctions[2338]))(target,offset,size,data);this->profiler.end(2338,profilingStart);}
+void m_glGetPathParameterivNV_profiling(GLuint path,GLenum pname,GLint* value)const{auto const profilingStart=this->profiler.begin(2339);(this->*((FunctionTable::MEMBERPFNGLGETPATHPARAMETERIVNVPROC)this->m_profiledFunctions[2339]))(path,pname,value);this->profiler.end(2339,profilingStart);}
+void m_glFlushRasterSGIX_profiling()const{auto const profilingStart=this->profiler.begin(2340);(this->*((FunctionTable::MEMBERPFNGLFLUSHRASTERSGIXPROC)this->m_profiledFunctions[2340]))();this->profiler.end(2340,profilingStart);}
+void m_glElementPointerATI_profiling(GLenum type,const void* pointer)const{auto const profilingStart=this->profiler.begin(2341);(this->*((FunctionTable::MEMBERPFNGLELEMENTPOINTERATIPROC)this->m_profiledFunctions[2341]))(type,pointer);this->profiler.end(2341,profilingStart);}
+void m_glGetAttachedObjectsARB_profiling(GLhandleARB containerObj,GLsizei maxCount,GLsizei* count,GLhandleARB* obj)const{auto const profilingStart=this->profiler.begin(2342);(this->*((FunctionTable::MEMBERPFNGLGETATTACHEDOBJECTSARBPROC)this->m_profiledFunctions[2342]))(containerObj,maxCount,count,obj);this->profiler.end(2342,profilingStart);}
+void m_glUniform4iv_profiling(GLint location,GLsizei count,const GLint* value)const{auto const profilingStart=this->profiler.begin(2343);(this->*((FunctionTable::MEMBERPFNGLUNIFORM4IVPROC)this->m_profiledFunctions[2343]))(location,count,value);this->profiler.end(2343,profilingStart);}
+void m_glFogxOES_profiling(GLenum pname,GLfixed param)const{auto const profilingStart=this->profiler.begin(2344);(this->*((FunctionTable::MEMBERPFNGLFOGXOESPROC)this->m_profiledFunctions[2344]))(pname,param);this->profiler.end(2344,profilingStart);}
+void m_glSharpenTexFuncSGIS_profiling(GLenum target,GLsizei n,const GLfloat* points)const{auto const profilingStart=this->profiler.begin(2345);(this->*((FunctionTable::MEMBERPFNGLSHARPENTEXFUNCSGISPROC)this->m_profiledFunctions[2345]))(target,n,points);this->profiler.end(2345,profilingStart);}
+void m_glClearDepthfOES_profiling(GLclampf depth)const{auto const profilingStart=this->profiler.begin(2346);(this->*((FunctionTable::MEMBERPFNGLCLEARDEPTHFOESPROC)this->m_profiledFunctions[2346]))(depth);this->profiler.end(2346,profilingStart);}
+void m_glDeleteCommandListsNV_profiling(GLsizei n,const GLuint* lists)const{auto const profilingStart=this->profiler.begin(2347);(this->*((FunctionTable::MEMBERPFNGLDELETECOMMANDLISTSNVPROC)this->m_profiledFunctions[2347]))(n,lists);this->profiler.end(2347,profilingStart);}
+void m_glVertex4hNV_profiling(GLhalfNV x,GLhalfNV y,GLhalfNV z,GLhalfNV w)const{auto const profilingStart=this->profiler.begin(2348);(this->*((FunctionTable::MEMBERPFNGLVERTEX4HNVPROC)this->m_profiledFunctions[2348]))(x,y,z,w);this->profiler.end(2348,profilingStart);}
+void m_glSecondaryColor3dvEXT_profiling(const GLdouble* v)const{auto const profilingStart=this->profiler.begin(2349);(this->*((FunctionTable::MEMBERPFNGLSECONDARYCOLOR3DVEXTPROC)this->m_profiledFunctions[2349]))(v);this->profiler.end(2349,profilingStart);}
+void m_glGenTextures_profiling(GLsizei n,GLuint* textures)const{auto const profilingStart=this->profiler.begin(2350);(this->*((FunctionTable::MEMBERPFNGLGENTEXTURESPROC)this->m_profiledFunctions[2350]))(n,textures);this->profiler.end(2350,profilingStart);}
+void m_glTextureStorage2DMultisample_profiling(GLuint texture,GLsizei samples,GLenum internalformat,GLsizei width,GLsizei height,GLboolean fixedsamplelocations)const{auto const profilingStart=this->profiler.begin(2351);(this->*((FunctionTable::MEMBERPFNGLTEXTURESTORAGE2DMULTISAMPLEPROC)this->m_profiledFunctions[2351]))(texture,samples,internalformat,width,height,fixedsamplelocations);this->profiler.end(2351,profilingStart);}
+void m_glUniform3ui64vNV_profiling(GLint location,GLsizei count,const GLuint64EXT* value)const{auto const profilingStart=this->profiler.begin(2352);(this->*((FunctionTable::MEMBERPFNGLUNIFORM3UI64VNVPROC)this->m_profiledFunctions[2352]))(location,count,value);this->profiler.end(2352,profilingStart);}
+void m_glBlendFuncSeparateIndexedAMD_profiling(GLuint buf,GLenum srcRGB,GLenum dstRGB,GLenum srcAlpha,GLenum dstAlpha)const{auto const profilingStart=this->profiler.begin(2353);(this->*((FunctionTable::MEMBERPFNGLBLENDFUNCSEPARATEINDEXEDAMDPROC)this->m_profiledFunctions[2353]))(buf,srcRGB,dstRGB,srcAlpha,dstAlpha);this->profiler.end(2353,profilingStart);}
+void m_glMakeBufferResidentNV_profiling(GLenum target,GLenum access)const{auto const profilingStart=this->profiler.begin(2354);(this->*((FunctionTable::MEMBERPFNGLMAKEBUFFERRESIDENTNVPROC)this->m_profiledFunctions[2354]))(target,access);this->profiler.end(2354,profilingStart);}
+void m_glShaderOp2EXT_profiling(GLenum op,GLuint res,GLuint arg1,GLuint arg2)const{auto const profilingStart=this->profiler.begin(2355);(this->*((FunctionTable::MEMBERPFNGLSHADEROP2EXTPROC)this->m_profiledFunctions[2355]))(op,res,arg1,arg2);this->profiler.end(2355,profilingStart);}
+void m_glGetVertexAttribivNV_profiling(GLuint index,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(2356);(this->*((FunctionTable::MEMBERPFNGLGETVERTEXATTRIBIVNVPROC)this->m_profiledFunctions[2356]))(index,pname,params);this->profiler.end(2356,profilingStart);}
+void m_glTexParameterIivEXT_profiling(GLenum target,GLenum pname,const GLint* params)const{auto const profilingStart=this->profiler.begin(2357);(this->*((FunctionTable::MEMBERPFNGLTEXPARAMETERIIVEXTPROC)this->m_profiledFunctions[2357]))(target,pname,params);this->profiler.end(2357,profilingStart);}
+void m_glGetPerfQueryDataINTEL_profiling(GLuint queryHandle,GLuint flags,GLsizei dataSize,GLvoid* data,GLuint* bytesWritten)const{auto const profilingStart=this->profiler.begin(2358);(this->*((FunctionTable::MEMBERPFNGLGETPERFQUERYDATAINTELPROC)this->m_profiledFunctions[2358]))(queryHandle,flags,dataSize,data,bytesWritten);this->profiler.end(2358,profilingStart);}
+void m_glVertexAttrib4dvARB_profiling(GLuint index,const GLdouble* v)const{auto const profilingStart=this->profiler.begin(2359);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB4DVARBPROC)this->m_profiledFunctions[2359]))(index,v);this->profiler.end(2359,profilingStart);}
+void m_glTextureSubImage1DEXT_profiling(GLuint texture,GLenum target,GLint level,GLint xoffset,GLsizei width,GLenum format,GLenum type,const void* pixels)const{auto const profilingStart=this->profiler.begin(2360);(this->*((FunctionTable::MEMBERPFNGLTEXTURESUBIMAGE1DEXTPROC)this->m_profiledFunctions[2360]))(texture,target,level,xoffset,width,format,type,pixels);this->profiler.end(2360,profilingStart);}
+void m_glGetActiveUniformBlockName_profiling(GLuint program,GLuint uniformBlockIndex,GLsizei bufSize,GLsizei* length,GLchar* uniformBlockName)const{auto const profilingStart=this->profiler.begin(2361);(this->*((FunctionTable::MEMBERPFNGLGETACTIVEUNIFORMBLOCKNAMEPROC)this->m_profiledFunctions[2361]))(program,uniformBlockIndex,bufSize,length,uniformBlockName);this->profiler.end(2361,profilingStart);}
+void m_glVertexAttrib2dvARB_profiling(GLuint index,const GLdouble* v)const{auto const profilingStart=this->profiler.begin(2362);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB2DVARBPROC)this->m_profiledFunctions[2362]))(index,v);this->profiler.end(2362,profilingStart);}
+void m_glVertexAttribPointer_profiling(GLuint index,GLint size,GLenum type,GLboolean normalized,GLsizei stride,const void* pointer)const{auto const profilingStart=this->profiler.begin(2363);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBPOINTERPROC)this->m_profiledFunctions[2363]))(index,size,type,normalized,stride,pointer);this->profiler.end(2363,profilingStart);}
+void m_glDepthBoundsdNV_profiling(GLdouble zmin,GLdouble zmax)const{auto const profilingStart=this->profiler.begin(2364);(this->*((FunctionTable::MEMBERPFNGLDEPTHBOUNDSDNVPROC)this->m_profiledFunctions[2364]))(zmin,zmax);this->profiler.end(2364,profilingStart);}
+void m_glDeleteTexturesEXT_profiling(GLsizei n,const GLuint* textures)const{auto const profilingStart=this->profiler.begin(2365);(this->*((FunctionTable::MEMBERPFNGLDELETETEXTURESEXTPROC)this->m_profiledFunctions[2365]))(n,textures);this->profiler.end(2365,profilingStart);}
+void m_glDrawBuffersATI_profiling(GLsizei n,const GLenum* bufs)const{auto const profilingStart=this->profiler.begin(2366);(this->*((FunctionTable::MEMBERPFNGLDRAWBUFFERSATIPROC)this->m_profiledFunctions[2366]))(n,bufs);this->profiler.end(2366,profilingStart);}
+void m_glLightModelxvOES_profiling(GLenum pname,const GLfixed* param)const{auto const profilingStart=this->profiler.begin(2367);(this->*((FunctionTable::MEMBERPFNGLLIGHTMODELXVOESPROC)this->m_profiledFunctions[2367]))(pname,param);this->profiler.end(2367,profilingStart);}
+void m_glApplyTextureEXT_profiling(GLenum mode)const{auto const profilingStart=this->profiler.begin(2368);(this->*((FunctionTable::MEMBERPFNGLAPPLYTEXTUREEXTPROC)this->m_profiledFunctions[2368]))(mode);this->profiler.end(2368,profilingStart);}
+GLuint64 m_glGetImageHandleNV_profiling(GLuint texture,GLint level,GLboolean layered,GLint layer,GLenum format)const{auto const profilingStart=this->profiler.begin(2369);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLGETIMAGEHANDLENVPROC)this->m_profiledFunctions[2369]))(texture,level,layered,layer,format);this->profiler.end(2369,profilingStart);return profilingResult;}
+void m_glGetMinmax_profiling(GLenum target,GLboolean reset,GLenum format,GLenum types,GLvoid* values)const{auto const profilingStart=this->profiler.begin(2370);(this->*((FunctionTable::MEMBERPFNGLGETMINMAXPROC)this->m_profiledFunctions[2370]))(target,reset,format,types,values);this->profiler.end(2370,profilingStart);}
+void m_glGetFixedvOES_profiling(GLenum pname,GLfixed* params)const{auto const profilingStart=this->profiler.begin(2371);(this->*((FunctionTable::MEMBERPFNGLGETFIXEDVOESPROC)this->m_profiledFunctions[2371]))(pname,params);this->profiler.end(2371,profilingStart);}
+void m_glSamplePatternEXT_profiling(GLenum pattern)const{auto const profilingStart=this->profiler.begin(2372);(this->*((FunctionTable::MEMBERPFNGLSAMPLEPATTERNEXTPROC)this->m_profiledFunctions[2372]))(pattern);this->profiler.end(2372,profilingStart);}
+void m_glUniform1f_profiling(GLint location,GLfloat v0)const{auto const profilingStart=this->profiler.begin(2373);(this->*((FunctionTable::MEMBERPFNGLUNIFORM1FPROC)this->m_profiledFunctions[2373]))(location,v0);this->profiler.end(2373,profilingStart);}
+void m_glColor4fNormal3fVertex3fSUN_profiling(GLfloat r,GLfloat g,GLfloat b,GLfloat a,GLfloat nx,GLfloat ny,GLfloat nz,GLfloat x,GLfloat y,GLfloat z)const{auto const profilingStart=this->profiler.begin(2374);(this->*((FunctionTable::MEMBERPFNGLCOLOR4FNORMAL3FVERTEX3FSUNPROC)this->m_profiledFunctions[2374]))(r,g,b,a,nx,ny,nz,x,y,z);this->profiler.end(2374,profilingStart);}
+void m_glFogCoorddvEXT_profiling(const GLdouble* coord)const{auto const profilingStart=this->profiler.begin(2375);(this->*((FunctionTable::MEMBERPFNGLFOGCOORDDVEXTPROC)this->m_profiledFunctions[2375]))(coord);this->profiler.end(2375,profilingStart);}
+void m_glCopyTextureImage1DEXT_profiling(GLuint texture,GLenum target,GLint level,GLenum internalformat,GLint x,GLint y,GLsizei width,GLint border)const{auto const profilingStart=this->profiler.begin(2376);(this->*((FunctionTable::MEMBERPFNGLCOPYTEXTUREIMAGE1DEXTPROC)this->m_profiledFunctions[2376]))(texture,target,level,internalformat,x,y,width,border);this->profiler.end(2376,profilingStart);}
+void m_glFlushMappedBufferRangeAPPLE_profiling(GLenum target,GLintptr offset,GLsizeiptr size)const{auto const profilingStart=this->profiler.begin(2377);(this->*((FunctionTable::MEMBERPFNGLFLUSHMAPPEDBUFFERRANGEAPPLEPROC)this->m_profiledFunctions[2377]))(target,offset,size);this->profiler.end(2377,profilingStart);}
+void m_glVertex3sv_profiling(const GLshort* v)const{auto const profilingStart=this->profiler.begin(2378);(this->*((FunctionTable::MEMBERPFNGLVERTEX3SVPROC)this->m_profiledFunctions[2378]))(v);this->profiler.end(2378,profilingStart);}
+void m_glFlushStaticDataIBM_profiling(GLenum target)const{auto const profilingStart=this->profiler.begin(2379);(this->*((FunctionTable::MEMBERPFNGLFLUSHSTATICDATAIBMPROC)this->m_profiledFunctions[2379]))(target);this->profiler.end(2379,profilingStart);}
+void m_glProgramUniform4ui64NV_profiling(GLuint program,GLint location,GLuint64EXT x,GLuint64EXT y,GLuint64EXT z,GLuint64EXT w)const{auto const profilingStart=this->profiler.begin(2380);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UI64NVPROC)this->m_profiledFunctions[2380]))(program,location,x,y,z,w);this->profiler.end(2380,profilingStart);}
+void m_glRasterPos4xOES_profiling(GLfixed x,GLfixed y,GLfixed z,GLfixed w)const{auto const profilingStart=this->profiler.begin(2381);(this->*((FunctionTable::MEMBERPFNGLRASTERPOS4XOESPROC)this->m_profiledFunctions[2381]))(x,y,z,w);this->profiler.end(2381,profilingStart);}
+void m_glVertexAttribP1ui_profiling(GLuint index,GLenum type,GLboolean normalized,GLuint value)const{auto const profilingStart=this->profiler.begin(2382);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBP1UIPROC)this->m_profiledFunctions[2382]))(index,type,normalized,value);this->profiler.end(2382,profilingStart);}
+void m_glProgramUniform4dvEXT_profiling(GLuint program,GLint location,GLsizei count,const GLdouble* value)const{auto const profilingStart=this->profiler.begin(2383);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4DVEXTPROC)this->m_profiledFunctions[2383]))(program,location,count,value);this->profiler.end(2383,profilingStart);}
+void m_glEndTransformFeedbackEXT_profiling()const{auto const profilingStart=this->profiler.begin(2384);(this->*((FunctionTable::MEMBERPFNGLENDTRANSFORMFEEDBACKEXTPROC)this->m_profiledFunctions[2384]))();this->profiler.end(2384,profilingStart);}
+void m_glBinormal3dEXT_profiling(GLdouble bx,GLdouble by,GLdouble bz)const{auto const profilingStart=this->profiler.begin(2385);(this->*((FunctionTable::MEMBERPFNGLBINORMAL3DEXTPROC)this->m_profiledFunctions[2385]))(bx,by,bz);this->profiler.end(2385,profilingStart);}
+void m_glGetTextureSubImage_profiling(GLuint texture,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLenum format,GLenum type,GLsizei bufSize,void* pixels)const{auto const profilingStart=this->profiler.begin(2386);(this->*((FunctionTable::MEMBERPFNGLGETTEXTURESUBIMAGEPROC)this->m_profiledFunctions[2386]))(texture,level,xoffset,yoffset,zoffset,width,height,depth,format,type,bufSize,pixels);this->profiler.end(2386,profilingStart);}
+void m_glGetNamedRenderbufferParameteriv_profiling(GLuint renderbuffer,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(2387);(this->*((FunctionTable::MEMBERPFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC)this->m_profiledFunctions[2387]))(renderbuffer,pname,params);this->profiler.end(2387,profilingStart);}
+void m_glBindBuffersRange_profiling(GLenum target,GLuint first,GLsizei count,const GLuint* buffers,const GLintptr* offsets,const GLsizeiptr* sizes)const{auto const profilingStart=this->profiler.begin(2388);(this->*((FunctionTable::MEMBERPFNGLBINDBUFFERSRANGEPROC)this->m_profiledFunctions[2388]))(target,first,count,buffers,offsets,sizes);this->profiler.end(2388,profilingStart);}
+GLint m_glFinishAsyncSGIX_profiling(GLuint* markerp)const{auto const profilingStart=this->profiler.begin(2389);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLFINISHASYNCSGIXPROC)this->m_profiledFunctions[2389]))(markerp);this->profiler.end(2389,profilingStart);return profilingResult;}
+void m_glBindFragDataLocationIndexed_profiling(GLuint program,GLuint colorNumber,GLuint index,const GLchar* name)const{auto const profilingStart=this->profiler.begin(2390);(this->*((FunctionTable::MEMBERPFNGLBINDFRAGDATALOCATIONINDEXEDPROC)this->m_profiledFunctions[2390]))(program,colorNumber,index,name);this->profiler.end(2390,profilingStart);}
+void m_glMultiTexCoord2dv_profiling(GLenum target,const GLdouble* v)const{auto const profilingStart=this->profiler.begin(2391);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD2DVPROC)this->m_profiledFunctions[2391]))(target,v);this->profiler.end(2391,profilingStart);}
+void m_glUniform2iv_profiling(GLint location,GLsizei count,const GLint* value)const{auto const profilingStart=this->profiler.begin(2392);(this->*((FunctionTable::MEMBERPFNGLUNIFORM2IVPROC)this->m_profiledFunctions[2392]))(location,count,value);this->profiler.end(2392,profilingStart);}
+void m_glProgramUniform2i64vNV_profiling(GLuint program,GLint location,GLsizei count,const GLint64EXT* value)const{auto const profilingStart=this->profiler.begin(2393);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2I64VNVPROC)this->m_profiledFunctions[2393]))(program,location,count,value);this->profiler.end(2393,profilingStart);}
+void m_glFlushVertexArrayRangeAPPLE_profiling(GLsizei length,void* pointer)const{auto const profilingStart=this->profiler.begin(2394);(this->*((FunctionTable::MEMBERPFNGLFLUSHVERTEXARRAYRANGEAPPLEPROC)this->m_profiledFunctions[2394]))(length,pointer);this->profiler.end(2394,profilingStart);}
+void m_glTextureParameterf_profiling(GLuint texture,GLenum pname,GLfloat param)const{auto const profilingStart=this->profiler.begin(2395);(this->*((FunctionTable::MEMBERPFNGLTEXTUREPARAMETERFPROC)this->m_profiledFunctions[2395]))(texture,pname,param);this->profiler.end(2395,profilingStart);}
+void m_glMultiTexCoord3dvARB_profiling(GLenum target,const GLdouble* v)const{auto const profilingStart=this->profiler.begin(2396);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD3DVARBPROC)this->m_profiledFunctions[2396]))(target,v);this->profiler.end(2396,profilingStart);}
+void m_glFeedbackBuffer_profiling(GLsizei size,GLenum type,GLfloat* buffer)const{auto const profilingStart=this->profiler.begin(2397);(this->*((FunctionTable::MEMBERPFNGLFEEDBACKBUFFERPROC)this->m_profiledFunctions[2397]))(size,type,buffer);this->profiler.end(2397,profilingStart);}
+void m_glDebugMessageInsertARB_profiling(GLenum source,GLenum type,GLuint id,GLenum severity,GLsizei length,const GLchar* buf)const{auto const profilingStart=this->profiler.begin(2398);(this->*((FunctionTable::MEMBERPFNGLDEBUGMESSAGEINSERTARBPROC)this->m_profiledFunctions[2398]))(source,type,id,severity,length,buf);this->profiler.end(2398,profilingStart);}
+void m_glMultiTexCoord2i_profiling(GLenum target,GLint s,GLint t)const{auto const profilingStart=this->profiler.begin(2399);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD2IPROC)this->m_profiledFunctions[2399]))(target,s,t);this->profiler.end(2399,profilingStart);}
+void m_glTextureSubImage3D_profiling(GLuint texture,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLenum format,GLenum type,const void* pixels)const{auto const profilingStart=this->profiler.begin(2400);(this->*((FunctionTable::MEMBERPFNGLTEXTURESUBIMAGE3DPROC)this->m_profiledFunctions[2400]))(texture,level,xoffset,yoffset,zoffset,width,height,depth,format,type,pixels);this->profiler.end(2400,profilingStart);}
+void m_glFramebufferTexture1D_profiling(GLenum target,GLenum attachment,GLenum textarget,GLuint texture,GLint level)const{auto const profilingStart=this->profiler.begin(2401);(this->*((FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURE1DPROC)this->m_profiledFunctions[2401]))(target,attachment,textarget,texture,level);this->profiler.end(2401,profilingStart);}
+void m_glGetShaderiv_profiling(GLuint shader,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(2402);(this->*((FunctionTable::MEMBERPFNGLGETSHADERIVPROC)this->m_profiledFunctions[2402]))(shader,pname,params);this->profiler.end(2402,profilingStart);}
+void m_glMultiTexCoord2d_profiling(GLenum target,GLdouble s,GLdouble t)const{auto const profilingStart=this->profiler.begin(2403);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD2DPROC)this->m_profiledFunctions[2403]))(target,s,t);this->profiler.end(2403,profilingStart);}
+void m_glArrayObjectATI_profiling(GLenum array,GLint size,GLenum type,GLsizei stride,GLuint buffer,GLuint offset)const{auto const profilingStart=this->profiler.begin(2404);(this->*((FunctionTable::MEMBERPFNGLARRAYOBJECTATIPROC)this->m_profiledFunctions[2404]))(array,size,type,stride,buffer,offset);this->profiler.end(2404,profilingStart);}
+void m_glGetPointeri_vEXT_profiling(GLenum pname,GLuint index,void** params)const{auto const profilingStart=this->profiler.begin(2405);(this->*((FunctionTable::MEMBERPFNGLGETPOINTERI_VEXTPROC)this->m_profiledFunctions[2405]))(pname,index,params);this->profiler.end(2405,profilingStart);}
+void m_glGetPerfMonitorCountersAMD_profiling(GLuint group,GLint* numCounters,GLint* maxActiveCounters,GLsizei counterSize,GLuint* counters)const{auto const profilingStart=this->profiler.begin(2406);(this->*((FunctionTable::MEMBERPFNGLGETPERFMONITORCOUNTERSAMDPROC)this->m_profiledFunctions[2406]))(group,numCounters,maxActiveCounters,counterSize,counters);this->profiler.end(2406,profilingStart);}
+void m_glNamedBufferStorage_profiling(GLuint buffer,GLsizeiptr size,const void* data,GLbitfield flags)const{auto const profilingStart=this->profiler.begin(2407);(this->*((FunctionTable::MEMBERPFNGLNAMEDBUFFERSTORAGEPROC)this->m_profiledFunctions[2407]))(buffer,size,data,flags);this->profiler.end(2407,profilingStart);}
+void m_glTexEnvxvOES_profiling(GLenum target,GLenum pname,const GLfixed* params)const{auto const profilingStart=this->profiler.begin(2408);(this->*((FunctionTable::MEMBERPFNGLTEXENVXVOESPROC)this->m_profiledFunctions[2408]))(target,pname,params);this->profiler.end(2408,profilingStart);}
+void m_glProgramUniform2ui64NV_profiling(GLuint program,GLint location,GLuint64EXT x,GLuint64EXT y)const{auto const profilingStart=this->profiler.begin(2409);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UI64NVPROC)this->m_profiledFunctions[2409]))(program,location,x,y);this->profiler.end(2409,profilingStart);}
+void m_glMultiTexCoord3bOES_profiling(GLenum texture,GLbyte s,GLbyte t,GLbyte r)const{auto const profilingStart=this->profiler.begin(2410);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD3BOESPROC)this->m_profiledFunctions[2410]))(texture,s,t,r);this->profiler.end(2410,profilingStart);}
+void m_glUniform1dv_profiling(GLint location,GLsizei count,const GLdouble* value)const{auto const profilingStart=this->profiler.begin(2411);(this->*((FunctionTable::MEMBERPFNGLUNIFORM1DVPROC)this->m_profiledFunctions[2411]))(location,count,value);this->profiler.end(2411,profilingStart);}
+void m_glPixelTransferi_profiling(GLenum pname,GLint param)const{auto const profilingStart=this->profiler.begin(2412);(this->*((FunctionTable::MEMBERPFNGLPIXELTRANSFERIPROC)this->m_profiledFunctions[2412]))(pname,param);this->profiler.end(2412,profilingStart);}
+void m_glSecondaryColor3usvEXT_profiling(const GLushort* v)const{auto const profilingStart=this->profiler.begin(2413);(this->*((FunctionTable::MEMBERPFNGLSECONDARYCOLOR3USVEXTPROC)this->m_profiledFunctions[2413]))(v);this->profiler.end(2413,profilingStart);}
+void m_glProgramEnvParameterI4uivNV_profiling(GLenum target,GLuint index,const GLuint* params)const{auto const profilingStart=this->profiler.begin(2414);(this->*((FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERI4UIVNVPROC)this->m_profiledFunctions[2414]))(target,index,params);this->profiler.end(2414,profilingStart);}
+void m_glVertex2sv_profiling(const GLshort* v)const{auto const profilingStart=this->profiler.begin(2415);(this->*((FunctionTable::MEMBERPFNGLVERTEX2SVPROC)this->m_profiledFunctions[2415]))(v);this->profiler.end(2415,profilingStart);}
+void m_glWindowPos4dMESA_profiling(GLdouble x,GLdouble y,GLdouble z,GLdouble w)const{auto const profilingStart=this->profiler.begin(2416);(this->*((FunctionTable::MEMBERPFNGLWINDOWPOS4DMESAPROC)this->m_profiledFunctions[2416]))(x,y,z,w);this->profiler.end(2416,profilingStart);}
+void m_glDebugMessageControlARB_profiling(GLenum source,GLenum type,GLenum severity,GLsizei count,const GLuint* ids,GLboolean enabled)const{auto const profilingStart=this->profiler.begin(2417);(this->*((FunctionTable::MEMBERPFNGLDEBUGMESSAGECONTROLARBPROC)this->m_profiledFunctions[2417]))(source,type,severity,count,ids,enabled);this->profiler.end(2417,profilingStart);}
+GLboolean m_glIsTextureEXT_profiling(GLuint texture)const{auto const profilingStart=this->profiler.begin(2418);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLISTEXTUREEXTPROC)this->m_profiledFunctions[2418]))(texture);this->profiler.end(2418,profilingStart);return profilingResult;}
+void m_glFragmentMaterialivSGIX_profiling(GLenum face,GLenum pname,const GLint* params)const{auto const profilingStart=this->profiler.begin(2419);(this->*((FunctionTable::MEMBERPFNGLFRAGMENTMATERIALIVSGIXPROC)this->m_profiledFunctions[2419]))(face,pname,params);this->profiler.end(2419,profilingStart);}
+void m_glLinkProgramARB_profiling(GLhandleARB programObj)const{auto const profilingStart=this->profiler.begin(2420);(this->*((FunctionTable::MEMBERPFNGLLINKPROGRAMARBPROC)this->m_profiledFunctions[2420]))(programObj);this->profiler.end(2420,profilingStart);}
+void m_glFinishFenceAPPLE_profiling(GLuint fence)const{auto const profilingStart=this->profiler.begin(2421);(this->*((FunctionTable::MEMBERPFNGLFINISHFENCEAPPLEPROC)this->m_profiledFunctions[2421]))(fence);this->profiler.end(2421,profilingStart);}
+void m_glVertexArrayVertexAttribBindingEXT_profiling(GLuint vaobj,GLuint attribindex,GLuint bindingindex)const{auto const profilingStart=this->profiler.begin(2422);(this->*((FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBBINDINGEXTPROC)this->m_profiledFunctions[2422]))(vaobj,attribindex,bindingindex);this->profiler.end(2422,profilingStart);}
+void m_glMultiTexCoord4fv_profiling(GLenum target,const GLfloat* v)const{auto const profilingStart=this->profiler.begin(2423);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD4FVPROC)this->m_profiledFunctions[2423]))(target,v);this->profiler.end(2423,profilingStart);}
+void m_glRasterPos3i_profiling(GLint x,GLint y,GLint z)const{auto const profilingStart=this->profiler.begin(2424);(this->*((FunctionTable::MEMBERPFNGLRASTERPOS3IPROC)this->m_profiledFunctions[2424]))(x,y,z);this->profiler.end(2424,profilingStart);}
+void m_glRasterPos3d_profiling(GLdouble x,GLdouble y,GLdouble z)const{auto const profilingStart=this->profiler.begin(2425);(this->*((FunctionTable::MEMBERPFNGLRASTERPOS3DPROC)this->m_profiledFunctions[2425]))(x,y,z);this->profiler.end(2425,profilingStart);}
+GLint m_glPollAsyncSGIX_profiling(GLuint* markerp)const{auto const profilingStart=this->profiler.begin(2426);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLPOLLASYNCSGIXPROC)this->m_profiledFunctions[2426]))(markerp);this->profiler.end(2426,profilingStart);return profilingResult;}
+void m_glRasterPos3f_profiling(GLfloat x,GLfloat y,GLfloat z)const{auto const profilingStart=this->profiler.begin(2427);(this->*((FunctionTable::MEMBERPFNGLRASTERPOS3FPROC)this->m_profiledFunctions[2427]))(x,y,z);this->profiler.end(2427,profilingStart);}
+void m_glCompressedTexImage3D_profiling(GLenum target,GLint level,GLenum internalformat,GLsizei width,GLsizei height,GLsizei depth,GLint border,GLsizei imageSize,const GLvoid* data)const{auto const profilingStart=this->profiler.begin(2428);(this->*((FunctionTable::MEMBERPFNGLCOMPRESSEDTEXIMAGE3DPROC)this->m_profiledFunctions[2428]))(target,level,internalformat,width,height,depth,border,imageSize,data);this->profiler.end(2428,profilingStart);}
+void m_glVariantivEXT_profiling(GLuint id,const GLint* addr)const{auto const profilingStart=this->profiler.begin(2429);(this->*((FunctionTable::MEMBERPFNGLVARIANTIVEXTPROC)this->m_profiledFunctions[2429]))(id,addr);this->profiler.end(2429,profilingStart);}
+void m_glUnmapTexture2DINTEL_profiling(GLuint texture,GLint level)const{auto const profilingStart=this->profiler.begin(2430);(this->*((FunctionTable::MEMBERPFNGLUNMAPTEXTURE2DINTELPROC)this->m_profiledFunctions[2430]))(texture,level);this->profiler.end(2430,profilingStart);}
+void m_glGetVertexAttribiv_profiling(GLuint index,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(2431);(this->*((FunctionTable::MEMBERPFNGLGETVERTEXATTRIBIVPROC)this->m_profiledFunctions[2431]))(index,pname,params);this->profiler.end(2431,profilingStart);}
+void m_glGetPathCoordsNV_profiling(GLuint path,GLfloat* coords)const{auto const profilingStart=this->profiler.begin(2432);(this->*((FunctionTable::MEMBERPFNGLGETPATHCOORDSNVPROC)this->m_profiledFunctions[2432]))(path,coords);this->profiler.end(2432,profilingStart);}
+void m_glColor4xvOES_profiling(const GLfixed* components)const{auto const profilingStart=this->profiler.begin(2433);(this->*((FunctionTable::MEMBERPFNGLCOLOR4XVOESPROC)this->m_profiledFunctions[2433]))(components);this->profiler.end(2433,profilingStart);}
+void m_glVertexAttrib3fv_profiling(GLuint index,const GLfloat* v)const{auto const profilingStart=this->profiler.begin(2434);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB3FVPROC)this->m_profiledFunctions[2434]))(index,v);this->profiler.end(2434,profilingStart);}
+void m_glRasterPos3s_profiling(GLshort x,GLshort y,GLshort z)const{auto const profilingStart=this->profiler.begin(2435);(this->*((FunctionTable::MEMBERPFNGLRASTERPOS3SPROC)this->m_profiledFunctions[2435]))(x,y,z);this->profiler.end(2435,profilingStart);}
+void m_glVertex4bOES_profiling(GLbyte x,GLbyte y,GLbyte z,GLbyte w)const{auto const profilingStart=this->profiler.begin(2436);(this->*((FunctionTable::MEMBERPFNGLVERTEX4BOESPROC)this->m_profiledFunctions[2436]))(x,y,z,w);this->profiler.end(2436,profilingStart);}
+void m_glTransformFeedbackVaryingsEXT_profiling(GLuint program,GLsizei count,const GLchar*const* varyings,GLenum bufferMode)const{auto const profilingStart=this->profiler.begin(2437);(this->*((FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKVARYINGSEXTPROC)this->m_profiledFunctions[2437]))(program,count,varyings,bufferMode);this->profiler.end(2437,profilingStart);}
+void m_glCombinerOutputNV_profiling(GLenum stage,GLenum portion,GLenum abOutput,GLenum cdOutput,GLenum sumOutput,GLenum scale,GLenum bias,GLboolean abDotProduct,GLboolean cdDotProduct,GLboolean muxSum)const{auto const profilingStart=this->profiler.begin(2438);(this->*((FunctionTable::MEMBERPFNGLCOMBINEROUTPUTNVPROC)this->m_profiledFunctions[2438]))(stage,portion,abOutput,cdOutput,sumOutput,scale,bias,abDotProduct,cdDotProduct,muxSum);this->profiler.end(2438,profilingStart);}
+void m_glWindowPos4sMESA_profiling(GLshort x,GLshort y,GLshort z,GLshort w)const{auto const profilingStart=this->profiler.begin(2439);(this->*((FunctionTable::MEMBERPFNGLWINDOWPOS4SMESAPROC)this->m_profiledFunctions[2439]))(x,y,z,w);this->profiler.end(2439,profilingStart);}
+void m_glVertexAttrib4svARB_profiling(GLuint index,const GLshort* v)const{auto const profilingStart=this->profiler.begin(2440);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB4SVARBPROC)this->m_profiledFunctions[2440]))(index,v);this->profiler.end(2440,profilingStart);}
+GLboolean m_glIsList_profiling(GLuint list)const{auto const profilingStart=this->profiler.begin(2441);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLISLISTPROC)this->m_profiledFunctions[2441]))(list);this->profiler.end(2441,profilingStart);return profilingResult;}
+void m_glGetInfoLogARB_profiling(GLhandleARB obj,GLsizei maxLength,GLsizei* length,GLcharARB* infoLog)const{auto const profilingStart=this->profiler.begin(2442);(this->*((FunctionTable::MEMBERPFNGLGETINFOLOGARBPROC)this->m_profiledFunctions[2442]))(obj,maxLength,length,infoLog);this->profiler.end(2442,profilingStart);}
+void m_glUniformMatrix2fv_profiling(GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{auto const profilingStart=this->profiler.begin(2443);(this->*((FunctionTable::MEMBERPFNGLUNIFORMMATRIX2FVPROC)this->m_profiledFunctions[2443]))(location,count,transpose,value);this->profiler.end(2443,profilingStart);}
+void m_glVertexAttribs3dvNV_profiling(GLuint index,GLsizei count,const GLdouble* v)const{auto const profilingStart=this->profiler.begin(2444);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBS3DVNVPROC)this->m_profiledFunctions[2444]))(index,count,v);this->profiler.end(2444,profilingStart);}
+void m_glGlobalAlphaFactorsSUN_profiling(GLshort factor)const{auto const profilingStart=this->profiler.begin(2445);(this->*((FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORSSUNPROC)this->m_profiledFunctions[2445]))(factor);this->profiler.end(2445,profilingStart);}
+void m_glGetTrackMatrixivNV_profiling(GLenum target,GLuint address,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(2446);(this->*((FunctionTable::MEMBERPFNGLGETTRACKMATRIXIVNVPROC)this->m_profiledFunctions[2446]))(target,address,pname,params);this->profiler.end(2446,profilingStart);}
+void m_glTextureParameterfvEXT_profiling(GLuint texture,GLenum target,GLenum pname,const GLfloat* params)const{auto const profilingStart=this->profiler.begin(2447);(this->*((FunctionTable::MEMBERPFNGLTEXTUREPARAMETERFVEXTPROC)this->m_profiledFunctions[2447]))(texture,target,pname,params);this->profiler.end(2447,profilingStart);}
+GLboolean m_glIsNamedBufferResidentNV_profiling(GLuint buffer)const{auto const profilingStart=this->profiler.begin(2448);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLISNAMEDBUFFERRESIDENTNVPROC)this->m_profiledFunctions[2448]))(buffer);this->profiler.end(2448,profilingStart);return profilingResult;}
+void m_glProgramUniform4ui64vARB_profiling(GLuint program,GLint location,GLsizei count,const GLuint64* value)const{auto const profilingStart=this->profiler.begin(2449);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UI64VARBPROC)this->m_profiledFunctions[2449]))(program,location,count,value);this->profiler.end(2449,profilingStart);}
+void m_glTbufferMask3DFX_profiling(GLuint mask)const{auto const profilingStart=this->profiler.begin(2450);(this->*((FunctionTable::MEMBERPFNGLTBUFFERMASK3DFXPROC)this->m_profiledFunctions[2450]))(mask);this->profiler.end(2450,profilingStart);}
+void m_glCoverFillPathNV_profiling(GLuint path,GLenum coverMode)const{auto const profilingStart=this->profiler.begin(2451);(this->*((FunctionTable::MEMBERPFNGLCOVERFILLPATHNVPROC)this->m_profiledFunctions[2451]))(path,coverMode);this->profiler.end(2451,profilingStart);}
+void m_glVertexAttrib1fvARB_profiling(GLuint index,const GLfloat* v)const{auto const profilingStart=this->profiler.begin(2452);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB1FVARBPROC)this->m_profiledFunctions[2452]))(index,v);this->profiler.end(2452,profilingStart);}
+void m_glGenerateTextureMipmap_profiling(GLuint texture)const{auto const profilingStart=this->profiler.begin(2453);(this->*((FunctionTable::MEMBERPFNGLGENERATETEXTUREMIPMAPPROC)this->m_profiledFunctions[2453]))(texture);this->profiler.end(2453,profilingStart);}
+void m_glNamedProgramLocalParameterI4uivEXT_profiling(GLuint program,GLenum target,GLuint index,const GLuint* params)const{auto const profilingStart=this->profiler.begin(2454);(this->*((FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERI4UIVEXTPROC)this->m_profiledFunctions[2454]))(program,target,index,params);this->profiler.end(2454,profilingStart);}
+void m_glMultiDrawElementsBaseVertex_profiling(GLenum mode,const GLsizei* count,GLenum type,const void*const* indices,GLsizei drawcount,const GLint* basevertex)const{auto const profilingStart=this->profiler.begin(2455);(this->*((FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSBASEVERTEXPROC)this->m_profiledFunctions[2455]))(mode,count,type,indices,drawcount,basevertex);this->profiler.end(2455,profilingStart);}
+void m_glProgramSubroutineParametersuivNV_profiling(GLenum target,GLsizei count,const GLuint* params)const{auto const profilingStart=this->profiler.begin(2456);(this->*((FunctionTable::MEMBERPFNGLPROGRAMSUBROUTINEPARAMETERSUIVNVPROC)this->m_profiledFunctions[2456]))(target,count,params);this->profiler.end(2456,profilingStart);}
+void m_glProgramUniformMatrix2x4dvEXT_profiling(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{auto const profilingStart=this->profiler.begin(2457);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X4DVEXTPROC)this->m_profiledFunctions[2457]))(program,location,count,transpose,value);this->profiler.end(2457,profilingStart);}
+void m_glRotatexOES_profiling(GLfixed angle,GLfixed x,GLfixed y,GLfixed z)const{auto const profilingStart=this->profiler.begin(2458);(this->*((FunctionTable::MEMBERPFNGLROTATEXOESPROC)this->m_profiledFunctions[2458]))(angle,x,y,z);this->profiler.end(2458,profilingStart);}
+void m_glMemoryBarrierEXT_profiling(GLbitfield barriers)const{auto const profilingStart=this->profiler.begin(2459);(this->*((FunctionTable::MEMBERPFNGLMEMORYBARRIEREXTPROC)this->m_profiledFunctions[2459]))(barriers);this->profiler.end(2459,profilingStart);}
+void m_glVertexAttrib3svNV_profiling(GLuint index,const GLshort* v)const{auto const profilingStart=this->profiler.begin(2460);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB3SVNVPROC)this->m_profiledFunctions[2460]))(index,v);this->profiler.end(2460,profilingStart);}
+void m_glVertexStream3iATI_profiling(GLenum stream,GLint x,GLint y,GLint z)const{auto const profilingStart=this->profiler.begin(2461);(this->*((FunctionTable::MEMBERPFNGLVERTEXSTREAM3IATIPROC)this->m_profiledFunctions[2461]))(stream,x,y,z);this->profiler.end(2461,profilingStart);}
+void m_glCompressedTexSubImage1D_profiling(GLenum target,GLint level,GLint xoffset,GLsizei width,GLenum format,GLsizei imageSize,const GLvoid* data)const{auto const profilingStart=this->profiler.begin(2462);(this->*((FunctionTable::MEMBERPFNGLCOMPRESSEDTEXSUBIMAGE1DPROC)this->m_profiledFunctions[2462]))(target,level,xoffset,width,format,imageSize,data);this->profiler.end(2462,profilingStart);}
+void m_glSetFenceNV_profiling(GLuint fence,GLenum condition)const{auto const profilingStart=this->profiler.begin(2463);(this->*((FunctionTable::MEMBERPFNGLSETFENCENVPROC)this->m_profiledFunctions[2463]))(fence,condition);this->profiler.end(2463,profilingStart);}
+void m_glAttachObjectARB_profiling(GLhandleARB containerObj,GLhandleARB obj)const{auto const profilingStart=this->profiler.begin(2464);(this->*((FunctionTable::MEMBERPFNGLATTACHOBJECTARBPROC)this->m_profiledFunctions[2464]))(containerObj,obj);this->profiler.end(2464,profilingStart);}
+void m_glCopyConvolutionFilter1D_profiling(GLenum target,GLenum internalformat,GLint x,GLint y,GLsizei width)const{auto const profilingStart=this->profiler.begin(2465);(this->*((FunctionTable::MEMBERPFNGLCOPYCONVOLUTIONFILTER1DPROC)this->m_profiledFunctions[2465]))(target,internalformat,x,y,width);this->profiler.end(2465,profilingStart);}
+void m_glProgramParameters4fvNV_profiling(GLenum target,GLuint index,GLsizei count,const GLfloat* v)const{auto const profilingStart=this->profiler.begin(2466);(this->*((FunctionTable::MEMBERPFNGLPROGRAMPARAMETERS4FVNVPROC)this->m_profiledFunctions[2466]))(target,index,count,v);this->profiler.end(2466,profilingStart);}
+void m_glNamedFramebufferParameteriEXT_profiling(GLuint framebuffer,GLenum pname,GLint param)const{auto const profilingStart=this->profiler.begin(2467);(this->*((FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERPARAMETERIEXTPROC)this->m_profiledFunctions[2467]))(framebuffer,pname,param);this->profiler.end(2467,profilingStart);}
+void m_glVertexAttrib4Nsv_profiling(GLuint index,const GLshort* v)const{auto const profilingStart=this->profiler.begin(2468);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB4NSVPROC)this->m_profiledFunctions[2468]))(index,v);this->profiler.end(2468,profilingStart);}
+void m_glVertexAttribI4usvEXT_profiling(GLuint index,const GLushort* v)const{auto const profilingStart=this->profiler.begin(2469);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBI4USVEXTPROC)this->m_profiledFunctions[2469]))(index,v);this->profiler.end(2469,profilingStart);}
+void m_glTextureBufferRangeEXT_profiling(GLuint texture,GLenum target,GLenum internalformat,GLuint buffer,GLintptr offset,GLsizeiptr size)const{auto const profilingStart=this->profiler.begin(2470);(this->*((FunctionTable::MEMBERPFNGLTEXTUREBUFFERRANGEEXTPROC)this->m_profiledFunctions[2470]))(texture,target,internalformat,buffer,offset,size);this->profiler.end(2470,profilingStart);}
+void m_glVertexP3uiv_profiling(GLenum type,const GLuint* value)const{auto const profilingStart=this->profiler.begin(2471);(this->*((FunctionTable::MEMBERPFNGLVERTEXP3UIVPROC)this->m_profiledFunctions[2471]))(type,value);this->profiler.end(2471,profilingStart);}
+GLboolean m_glIsPathNV_profiling(GLuint path)const{auto const profilingStart=this->profiler.begin(2472);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLISPATHNVPROC)this->m_profiledFunctions[2472]))(path);this->profiler.end(2472,profilingStart);return profilingResult;}
+void m_glGetnUniformi64vARB_profiling(GLuint program,GLint location,GLsizei bufSize,GLint64* params)const{auto const profilingStart=this->profiler.begin(2473);(this->*((FunctionTable::MEMBERPFNGLGETNUNIFORMI64VARBPROC)this->m_profiledFunctions[2473]))(program,location,bufSize,params);this->profiler.end(2473,profilingStart);}
+void m_glFramebufferTextureMultiviewOVR_profiling(GLenum target,GLenum attachment,GLuint texture,GLint level,GLint baseViewIndex,GLsizei numViews)const{auto const profilingStart=this->profiler.begin(2474);(this->*((FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTUREMULTIVIEWOVRPROC)this->m_profiledFunctions[2474]))(target,attachment,texture,level,baseViewIndex,numViews);this->profiler.end(2474,profilingStart);}
+void m_glCompressedMultiTexSubImage2DEXT_profiling(GLenum texunit,GLenum target,GLint level,GLint xoffset,GLint yoffset,GLsizei width,GLsizei height,GLenum format,GLsizei imageSize,const void* bits)const{auto const profilingStart=this->profiler.begin(2475);(this->*((FunctionTable::MEMBERPFNGLCOMPRESSEDMULTITEXSUBIMAGE2DEXTPROC)this->m_profiledFunctions[2475]))(texunit,target,level,xoffset,yoffset,width,height,format,imageSize,bits);this->profiler.end(2475,profilingStart);}
+void m_glGetnMapdv_profiling(GLenum target,GLenum query,GLsizei bufSize,GLdouble* v)const{auto const profilingStart=this->profiler.begin(2476);(this->*((FunctionTable::MEMBERPFNGLGETNMAPDVPROC)this->m_profiledFunctions[2476]))(target,query,bufSize,v);this->profiler.end(2476,profilingStart);}
+void m_glDebugMessageCallback_profiling(GLDEBUGPROC callback,const void* userParam)const{auto const profilingStart=this->profiler.begin(2477);(this->*((FunctionTable::MEMBERPFNGLDEBUGMESSAGECALLBACKPROC)this->m_profiledFunctions[2477]))(callback,userParam);this->profiler.end(2477,profilingStart);}
+void m_glTangent3svEXT_profiling(const GLshort* v)const{auto const profilingStart=this->profiler.begin(2478);(this->*((FunctionTable::MEMBERPFNGLTANGENT3SVEXTPROC)this->m_profiledFunctions[2478]))(v);this->profiler.end(2478,profilingStart);}
+void m_glVertexAttribParameteriAMD_profiling(GLuint index,GLenum pname,GLint param)const{auto const profilingStart=this->profiler.begin(2479);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBPARAMETERIAMDPROC)this->m_profiledFunctions[2479]))(index,pname,param);this->profiler.end(2479,profilingStart);}
+void m_glBufferSubDataARB_profiling(GLenum target,GLintptrARB offset,GLsizeiptrARB size,const void* data)const{auto const profilingStart=this->profiler.begin(2480);(this->*((FunctionTable::MEMBERPFNGLBUFFERSUBDATAARBPROC)this->m_profiledFunctions[2480]))(target,offset,size,data);this->profiler.end(2480,profilingStart);}
+void m_glGetVertexAttribLui64vARB_profiling(GLuint index,GLenum pname,GLuint64EXT* params)const{auto const profilingStart=this->profiler.begin(2481);(this->*((FunctionTable::MEMBERPFNGLGETVERTEXATTRIBLUI64VARBPROC)this->m_profiledFunctions[2481]))(index,pname,params);this->profiler.end(2481,profilingStart);}
+void m_glVertexAttribL4ui64NV_profiling(GLuint index,GLuint64EXT x,GLuint64EXT y,GLuint64EXT z,GLuint64EXT w)const{auto const profilingStart=this->profiler.begin(2482);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBL4UI64NVPROC)this->m_profiledFunctions[2482]))(index,x,y,z,w);this->profiler.end(2482,profilingStart);}
+void m_glReplacementCodeuiColor4ubVertex3fSUN_profiling(GLuint rc,GLubyte r,GLubyte g,GLubyte b,GLubyte a,GLfloat x,GLfloat y,GLfloat z)const{auto const profilingStart=this->profiler.begin(2483);(this->*((FunctionTable::MEMBERPFNGLREPLACEMENTCODEUICOLOR4UBVERTEX3FSUNPROC)this->m_profiledFunctions[2483]))(rc,r,g,b,a,x,y,z);this->profiler.end(2483,profilingStart);}
+void m_glImageTransformParameterfHP_profiling(GLenum target,GLenum pname,GLfloat param)const{auto const profilingStart=this->profiler.begin(2484);(this->*((FunctionTable::MEMBERPFNGLIMAGETRANSFORMPARAMETERFHPPROC)this->m_profiledFunctions[2484]))(target,pname,param);this->profiler.end(2484,profilingStart);}
+void m_glMap1f_profiling(GLenum target,GLfloat u1,GLfloat u2,GLint stride,GLint order,const GLfloat* points)const{auto const profilingStart=this->profiler.begin(2485);(this->*((FunctionTable::MEMBERPFNGLMAP1FPROC)this->m_profiledFunctions[2485]))(target,u1,u2,stride,order,points);this->profiler.end(2485,profilingStart);}
+void m_glRasterPos4fv_profiling(const GLfloat* v)const{auto const profilingStart=this->profiler.begin(2486);(this->*((FunctionTable::MEMBERPFNGLRASTERPOS4FVPROC)this->m_profiledFunctions[2486]))(v);this->profiler.end(2486,profilingStart);}
+void m_glVertex2bvOES_profiling(const GLbyte* coords)const{auto const profilingStart=this->profiler.begin(2487);(this->*((FunctionTable::MEMBERPFNGLVERTEX2BVOESPROC)this->m_profiledFunctions[2487]))(coords);this->profiler.end(2487,profilingStart);}
+void m_glGetMapControlPointsNV_profiling(GLenum target,GLuint index,GLenum type,GLsizei ustride,GLsizei vstride,GLboolean packed,void* points)const{auto const profilingStart=this->profiler.begin(2488);(this->*((FunctionTable::MEMBERPFNGLGETMAPCONTROLPOINTSNVPROC)this->m_profiledFunctions[2488]))(target,index,type,ustride,vstride,packed,points);this->profiler.end(2488,profilingStart);}
+void m_glNamedProgramLocalParametersI4ivEXT_profiling(GLuint program,GLenum target,GLuint index,GLsizei count,const GLint* params)const{auto const profilingStart=this->profiler.begin(2489);(this->*((FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERSI4IVEXTPROC)this->m_profiledFunctions[2489]))(program,target,index,count,params);this->profiler.end(2489,profilingStart);}
+void m_glBindBufferRangeNV_profiling(GLenum target,GLuint index,GLuint buffer,GLintptr offset,GLsizeiptr size)const{auto const profilingStart=this->profiler.begin(2490);(this->*((FunctionTable::MEMBERPFNGLBINDBUFFERRANGENVPROC)this->m_profiledFunctions[2490]))(target,index,buffer,offset,size);this->profiler.end(2490,profilingStart);}
+void m_glVertexStream3dvATI_profiling(GLenum stream,const GLdouble* coords)const{auto const profilingStart=this->profiler.begin(2491);(this->*((FunctionTable::MEMBERPFNGLVERTEXSTREAM3DVATIPROC)this->m_profiledFunctions[2491]))(stream,coords);this->profiler.end(2491,profilingStart);}
+void m_glNormalPointerListIBM_profiling(GLenum type,GLint stride,const void** pointer,GLint ptrstride)const{auto const profilingStart=this->profiler.begin(2492);(this->*((FunctionTable::MEMBERPFNGLNORMALPOINTERLISTIBMPROC)this->m_profiledFunctions[2492]))(type,stride,pointer,ptrstride);this->profiler.end(2492,profilingStart);}
+void m_glFogFuncSGIS_profiling(GLsizei n,const GLfloat* points)const{auto const profilingStart=this->profiler.begin(2493);(this->*((FunctionTable::MEMBERPFNGLFOGFUNCSGISPROC)this->m_profiledFunctions[2493]))(n,points);this->profiler.end(2493,profilingStart);}
+void m_glMultiModeDrawArraysIBM_profiling(const GLenum* mode,const GLint* first,const GLsizei* count,GLsizei primcount,GLint modestride)const{auto const profilingStart=this->profiler.begin(2494);(this->*((FunctionTable::MEMBERPFNGLMULTIMODEDRAWARRAYSIBMPROC)this->m_profiledFunctions[2494]))(mode,first,count,primcount,modestride);this->profiler.end(2494,profilingStart);}
+void m_glGetNamedFramebufferAttachmentParameterivEXT_profiling(GLuint framebuffer,GLenum attachment,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(2495);(this->*((FunctionTable::MEMBERPFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVEXTPROC)this->m_profiledFunctions[2495]))(framebuffer,attachment,pname,params);this->profiler.end(2495,profilingStart);}
+void m_glGetFloatv_profiling(GLenum pname,GLfloat* params)const{auto const profilingStart=this->profiler.begin(2496);(this->*((FunctionTable::MEMBERPFNGLGETFLOATVPROC)this->m_profiledFunctions[2496]))(pname,params);this->profiler.end(2496,profilingStart);}
+void m_glVertexArrayVertexAttribIFormatEXT_profiling(GLuint vaobj,GLuint attribindex,GLint size,GLenum type,GLuint relativeoffset)const{auto const profilingStart=this->profiler.begin(2497);(this->*((FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBIFORMATEXTPROC)this->m_profiledFunctions[2497]))(vaobj,attribindex,size,type,relativeoffset);this->profiler.end(2497,profilingStart);}
+void m_glHint_profiling(GLenum target,GLenum mode)const{auto const profilingStart=this->profiler.begin(2498);(this->*((FunctionTable::MEMBERPFNGLHINTPROC)this->m_profiledFunctions[2498]))(target,mode);this->profiler.end(2498,profilingStart);}
+GLboolean m_glPointAlongPathNV_profiling(GLuint path,GLsizei startSegment,GLsizei numSegments,GLfloat distance,GLfloat* x,GLfloat* y,GLfloat* tangentX,GLfloat* tangentY)const{auto const profilingStart=this->profiler.begin(2499);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLPOINTALONGPATHNVPROC)this->m_profiledFunctions[2499]))(path,startSegment,numSegments,distance,x,y,tangentX,tangentY);this->profiler.end(2499,profilingStart);return profilingResult;}
+void m_glVertexStream2svATI_profiling(GLenum stream,const GLshort* coords)const{auto const profilingStart=this->profiler.begin(2500);(this->*((FunctionTable::MEMBERPFNGLVERTEXSTREAM2SVATIPROC)this->m_profiledFunctions[2500]))(stream,coords);this->profiler.end(2500,profilingStart);}
+void m_glMultiDrawArraysIndirect_profiling(GLenum mode,const void* indirect,GLsizei drawcount,GLsizei stride)const{auto const profilingStart=this->profiler.begin(2501);(this->*((FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSINDIRECTPROC)this->m_profiledFunctions[2501]))(mode,indirect,drawcount,stride);this->profiler.end(2501,profilingStart);}
+void m_glVertexAttribP2uiv_profiling(GLuint index,GLenum type,GLboolean normalized,const GLuint* value)const{auto const profilingStart=this->profiler.begin(2502);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBP2UIVPROC)this->m_profiledFunctions[2502]))(index,type,normalized,value);this->profiler.end(2502,profilingStart);}
+void m_glProgramUniform1i64vARB_profiling(GLuint program,GLint location,GLsizei count,const GLint64* value)const{auto const profilingStart=this->profiler.begin(2503);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1I64VARBPROC)this->m_profiledFunctions[2503]))(program,location,count,value);this->profiler.end(2503,profilingStart);}
+void m_glFramebufferTextureARB_profiling(GLenum target,GLenum attachment,GLuint texture,GLint level)const{auto const profilingStart=this->profiler.begin(2504);(this->*((FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTUREARBPROC)this->m_profiledFunctions[2504]))(target,attachment,texture,level);this->profiler.end(2504,profilingStart);}
+void m_glPushClientAttribDefaultEXT_profiling(GLbitfield mask)const{auto const profilingStart=this->profiler.begin(2505);(this->*((FunctionTable::MEMBERPFNGLPUSHCLIENTATTRIBDEFAULTEXTPROC)this->m_profiledFunctions[2505]))(mask);this->profiler.end(2505,profilingStart);}
+void m_glScalef_profiling(GLfloat x,GLfloat y,GLfloat z)const{auto const profilingStart=this->profiler.begin(2506);(this->*((FunctionTable::MEMBERPFNGLSCALEFPROC)this->m_profiledFunctions[2506]))(x,y,z);this->profiler.end(2506,profilingStart);}
+void m_glScaled_profiling(GLdouble x,GLdouble y,GLdouble z)const{auto const profilingStart=this->profiler.begin(2507);(this->*((FunctionTable::MEMBERPFNGLSCALEDPROC)this->m_profiledFunctions[2507]))(x,y,z);this->profiler.end(2507,profilingStart);}
+void m_glGetConvolutionParameterxvOES_profiling(GLenum target,GLenum pname,GLfixed* params)const{auto const profilingStart=this->profiler.begin(2508);(this->*((FunctionTable::MEMBERPFNGLGETCONVOLUTIONPARAMETERXVOESPROC)this->m_profiledFunctions[2508]))(target,pname,params);this->profiler.end(2508,profilingStart);}
+void m_glGetProgramResourceName_profiling(GLuint program,GLenum programInterface,GLuint index,GLsizei bufSize,GLsizei* length,GLchar* name)const{auto const profilingStart=this->profiler.begin(2509);(this->*((FunctionTable::MEMBERPFNGLGETPROGRAMRESOURCENAMEPROC)this->m_profiledFunctions[2509]))(program,programInterface,index,bufSize,length,name);this->profiler.end(2509,profilingStart);}
+void m_glCopyColorTable_profiling(GLenum target,GLenum internalformat,GLint x,GLint y,GLsizei width)const{auto const profilingStart=this->profiler.begin(2510);(this->*((FunctionTable::MEMBERPFNGLCOPYCOLORTABLEPROC)this->m_profiledFunctions[2510]))(target,internalformat,x,y,width);this->profiler.end(2510,profilingStart);}
+void m_glDepthRangeArrayv_profiling(GLuint first,GLsizei count,const GLdouble* v)const{auto const profilingStart=this->profiler.begin(2511);(this->*((FunctionTable::MEMBERPFNGLDEPTHRANGEARRAYVPROC)this->m_profiledFunctions[2511]))(first,count,v);this->profiler.end(2511,profilingStart);}
+void m_glCoverFillPathInstancedNV_profiling(GLsizei numPaths,GLenum pathNameType,const void* paths,GLuint pathBase,GLenum coverMode,GLenum transformType,const GLfloat* transformValues)const{auto const profilingStart=this->profiler.begin(2512);(this->*((FunctionTable::MEMBERPFNGLCOVERFILLPATHINSTANCEDNVPROC)this->m_profiledFunctions[2512]))(numPaths,pathNameType,paths,pathBase,coverMode,transformType,transformValues);this->profiler.end(2512,profilingStart);}
+void m_glMultiTexParameterivEXT_profiling(GLenum texunit,GLenum target,GLenum pname,const GLint* params)const{auto const profilingStart=this->profiler.begin(2513);(this->*((FunctionTable::MEMBERPFNGLMULTITEXPARAMETERIVEXTPROC)this->m_profiledFunctions[2513]))(texunit,target,pname,params);this->profiler.end(2513,profilingStart);}
+void m_glGetActiveAtomicCounterBufferiv_profiling(GLuint program,GLuint bufferIndex,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(2514);(this->*((FunctionTable::MEMBERPFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC)this->m_profiledFunctions[2514]))(program,bufferIndex,pname,params);this->profiler.end(2514,profilingStart);}
+void m_glStencilOpSeparate_profiling(GLenum face,GLenum sfail,GLenum dpfail,GLenum dppass)const{auto const profilingStart=this->profiler.begin(2515);(this->*((FunctionTable::MEMBERPFNGLSTENCILOPSEPARATEPROC)this->m_profiledFunctions[2515]))(face,sfail,dpfail,dppass);this->profiler.end(2515,profilingStart);}
+void m_glVertexAttrib4fNV_profiling(GLuint index,GLfloat x,GLfloat y,GLfloat z,GLfloat w)const{auto const profilingStart=this->profiler.begin(2516);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB4FNVPROC)this->m_profiledFunctions[2516]))(index,x,y,z,w);this->profiler.end(2516,profilingStart);}
+void m_glGetColorTableParameterivSGI_profiling(GLenum target,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(2517);(this->*((FunctionTable::MEMBERPFNGLGETCOLORTABLEPARAMETERIVSGIPROC)this->m_profiledFunctions[2517]))(target,pname,params);this->profiler.end(2517,profilingStart);}
+void m_glVertexArrayAttribBinding_profiling(GLuint vaobj,GLuint attribindex,GLuint bindingindex)const{auto const profilingStart=this->profiler.begin(2518);(this->*((FunctionTable::MEMBERPFNGLVERTEXARRAYATTRIBBINDINGPROC)this->m_profiledFunctions[2518]))(vaobj,attribindex,bindingindex);this->profiler.end(2518,profilingStart);}
+void m_glProgramParameters4dvNV_profiling(GLenum target,GLuint index,GLsizei count,const GLdouble* v)const{auto const profilingStart=this->profiler.begin(2519);(this->*((FunctionTable::MEMBERPFNGLPROGRAMPARAMETERS4DVNVPROC)this->m_profiledFunctions[2519]))(target,index,count,v);this->profiler.end(2519,profilingStart);}
+void m_glVertexAttribL4dv_profiling(GLuint index,const GLdouble* v)const{auto const profilingStart=this->profiler.begin(2520);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBL4DVPROC)this->m_profiledFunctions[2520]))(index,v);this->profiler.end(2520,profilingStart);}
+void m_glVertexStream3dATI_profiling(GLenum stream,GLdouble x,GLdouble y,GLdouble z)const{auto const profilingStart=this->profiler.begin(2521);(this->*((FunctionTable::MEMBERPFNGLVERTEXSTREAM3DATIPROC)this->m_profiledFunctions[2521]))(stream,x,y,z);this->profiler.end(2521,profilingStart);}
+GLintptr m_glGetUniformOffsetEXT_profiling(GLuint program,GLint location)const{auto const profilingStart=this->profiler.begin(2522);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLGETUNIFORMOFFSETEXTPROC)this->m_profiledFunctions[2522]))(program,location);this->profiler.end(2522,profilingStart);return profilingResult;}
+void m_glGetVertexAttribPointerv_profiling(GLuint index,GLenum pname,void** pointer)const{auto const profilingStart=this->profiler.begin(2523);(this->*((FunctionTable::MEMBERPFNGLGETVERTEXATTRIBPOINTERVPROC)this->m_profiledFunctions[2523]))(index,pname,pointer);this->profiler.end(2523,profilingStart);}
+void m_glProgramUniform3i64vNV_profiling(GLuint program,GLint location,GLsizei count,const GLint64EXT* value)const{auto const profilingStart=this->profiler.begin(2524);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3I64VNVPROC)this->m_profiledFunctions[2524]))(program,location,count,value);this->profiler.end(2524,profilingStart);}
+void m_glTangent3fEXT_profiling(GLfloat tx,GLfloat ty,GLfloat tz)const{auto const profilingStart=this->profiler.begin(2525);(this->*((FunctionTable::MEMBERPFNGLTANGENT3FEXTPROC)this->m_profiledFunctions[2525]))(tx,ty,tz);this->profiler.end(2525,profilingStart);}
+void m_glGetPathMetricRangeNV_profiling(GLbitfield metricQueryMask,GLuint firstPathName,GLsizei numPaths,GLsizei stride,GLfloat* metrics)const{auto const profilingStart=this->profiler.begin(2526);(this->*((FunctionTable::MEMBERPFNGLGETPATHMETRICRANGENVPROC)this->m_profiledFunctions[2526]))(metricQueryMask,firstPathName,numPaths,stride,metrics);this->profiler.end(2526,profilingStart);}
+void m_glWindowPos2iMESA_profiling(GLint x,GLint y)const{auto const profilingStart=this->profiler.begin(2527);(this->*((FunctionTable::MEMBERPFNGLWINDOWPOS2IMESAPROC)this->m_profiledFunctions[2527]))(x,y);this->profiler.end(2527,profilingStart);}
+void m_glVertex2xvOES_profiling(const GLfixed* coords)const{auto const profilingStart=this->profiler.begin(2528);(this->*((FunctionTable::MEMBERPFNGLVERTEX2XVOESPROC)this->m_profiledFunctions[2528]))(coords);this->profiler.end(2528,profilingStart);}
+void m_glGetnCompressedTexImage_profiling(GLenum target,GLint lod,GLsizei bufSize,void* pixels)const{auto const profilingStart=this->profiler.begin(2529);(this->*((FunctionTable::MEMBERPFNGLGETNCOMPRESSEDTEXIMAGEPROC)this->m_profiledFunctions[2529]))(target,lod,bufSize,pixels);this->profiler.end(2529,profilingStart);}
+void m_glWindowPos2dv_profiling(const GLdouble* v)const{auto const profilingStart=this->profiler.begin(2530);(this->*((FunctionTable::MEMBERPFNGLWINDOWPOS2DVPROC)this->m_profiledFunctions[2530]))(v);this->profiler.end(2530,profilingStart);}
+void m_glReplacementCodeuiVertex3fSUN_profiling(GLuint rc,GLfloat x,GLfloat y,GLfloat z)const{auto const profilingStart=this->profiler.begin(2531);(this->*((FunctionTable::MEMBERPFNGLREPLACEMENTCODEUIVERTEX3FSUNPROC)this->m_profiledFunctions[2531]))(rc,x,y,z);this->profiler.end(2531,profilingStart);}
+void m_glGetTransformFeedbackVaryingEXT_profiling(GLuint program,GLuint index,GLsizei bufSize,GLsizei* length,GLsizei* size,GLenum* type,GLchar* name)const{auto const profilingStart=this->profiler.begin(2532);(this->*((FunctionTable::MEMBERPFNGLGETTRANSFORMFEEDBACKVARYINGEXTPROC)this->m_profiledFunctions[2532]))(program,index,bufSize,length,size,type,name);this->profiler.end(2532,profilingStart);}
+void m_glWindowPos3fARB_profiling(GLfloat x,GLfloat y,GLfloat z)const{auto const profilingStart=this->profiler.begin(2533);(this->*((FunctionTable::MEMBERPFNGLWINDOWPOS3FARBPROC)this->m_profiledFunctions[2533]))(x,y,z);this->profiler.end(2533,profilingStart);}
+void* m_glMapNamedBufferEXT_profiling(GLuint buffer,GLenum access)const{auto const profilingStart=this->profiler.begin(2534);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLMAPNAMEDBUFFEREXTPROC)this->m_profiledFunctions[2534]))(buffer,access);this->profiler.end(2534,profilingStart);return profilingResult;}
+void m_glDisable_profiling(GLenum cap)const{auto const profilingStart=this->profiler.begin(2535);(this->*((FunctionTable::MEMBERPFNGLDISABLEPROC)this->m_profiledFunctions[2535]))(cap);this->profiler.end(2535,profilingStart);}
+GLboolean m_glIsPointInFillPathNV_profiling(GLuint path,GLuint mask,GLfloat x,GLfloat y)const{auto const profilingStart=this->profiler.begin(2536);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLISPOINTINFILLPATHNVPROC)this->m_profiledFunctions[2536]))(path,mask,x,y);this->profiler.end(2536,profilingStart);return profilingResult;}
+void m_glVertexAttribI2uiEXT_profiling(GLuint index,GLuint x,GLuint y)const{auto const profilingStart=this->profiler.begin(2537);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBI2UIEXTPROC)this->m_profiledFunctions[2537]))(index,x,y);this->profiler.end(2537,profilingStart);}
+void m_glProgramUniform4uiv_profiling(GLuint program,GLint location,GLsizei count,const GLuint* value)const{auto const profilingStart=this->profiler.begin(2538);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UIVPROC)this->m_profiledFunctions[2538]))(program,location,count,value);this->profiler.end(2538,profilingStart);}
+void m_glQueryCounter_profiling(GLuint id,GLenum target)const{auto const profilingStart=this->profiler.begin(2539);(this->*((FunctionTable::MEMBERPFNGLQUERYCOUNTERPROC)this->m_profiledFunctions[2539]))(id,target);this->profiler.end(2539,profilingStart);}
+void m_glFramebufferRenderbufferEXT_profiling(GLenum target,GLenum attachment,GLenum renderbuffertarget,GLuint renderbuffer)const{auto const profilingStart=this->profiler.begin(2540);(this->*((FunctionTable::MEMBERPFNGLFRAMEBUFFERRENDERBUFFEREXTPROC)this->m_profiledFunctions[2540]))(target,attachment,renderbuffertarget,renderbuffer);this->profiler.end(2540,profilingStart);}
+void m_glBinormal3svEXT_profiling(const GLshort* v)const{auto const profilingStart=this->profiler.begin(2541);(this->*((FunctionTable::MEMBERPFNGLBINORMAL3SVEXTPROC)this->m_profiledFunctions[2541]))(v);this->profiler.end(2541,profilingStart);}
+void m_glBindBufferOffsetNV_profiling(GLenum target,GLuint index,GLuint buffer,GLintptr offset)const{auto const profilingStart=this->profiler.begin(2542);(this->*((FunctionTable::MEMBERPFNGLBINDBUFFEROFFSETNVPROC)this->m_profiledFunctions[2542]))(target,index,buffer,offset);this->profiler.end(2542,profilingStart);}
+void m_glCopyTextureSubImage2D_profiling(GLuint texture,GLint level,GLint xoffset,GLint yoffset,GLint x,GLint y,GLsizei width,GLsizei height)const{auto const profilingStart=this->profiler.begin(2543);(this->*((FunctionTable::MEMBERPFNGLCOPYTEXTURESUBIMAGE2DPROC)this->m_profiledFunctions[2543]))(texture,level,xoffset,yoffset,x,y,width,height);this->profiler.end(2543,profilingStart);}
+void m_glGetProgramResourcefvNV_profiling(GLuint program,GLenum programInterface,GLuint index,GLsizei propCount,const GLenum* props,GLsizei bufSize,GLsizei* length,GLfloat* params)const{auto const profilingStart=this->profiler.begin(2544);(this->*((FunctionTable::MEMBERPFNGLGETPROGRAMRESOURCEFVNVPROC)this->m_profiledFunctions[2544]))(program,programInterface,index,propCount,props,bufSize,length,params);this->profiler.end(2544,profilingStart);}
+void m_glBinormalPointerEXT_profiling(GLenum type,GLsizei stride,const void* pointer)const{auto const profilingStart=this->profiler.begin(2545);(this->*((FunctionTable::MEMBERPFNGLBINORMALPOINTEREXTPROC)this->m_profiledFunctions[2545]))(type,stride,pointer);this->profiler.end(2545,profilingStart);}
+void m_glGetLightfv_profiling(GLenum light,GLenum pname,GLfloat* params)const{auto const profilingStart=this->profiler.begin(2546);(this->*((FunctionTable::MEMBERPFNGLGETLIGHTFVPROC)this->m_profiledFunctions[2546]))(light,pname,params);this->profiler.end(2546,profilingStart);}
+void m_glVertex2bOES_profiling(GLbyte x,GLbyte y)const{auto const profilingStart=this->profiler.begin(2547);(this->*((FunctionTable::MEMBERPFNGLVERTEX2BOESPROC)this->m_profiledFunctions[2547]))(x,y);this->profiler.end(2547,profilingStart);}
+void m_glUniform2ivARB_profiling(GLint location,GLsizei count,const GLint* value)const{auto const profilingStart=this->profiler.begin(2548);(this->*((FunctionTable::MEMBERPFNGLUNIFORM2IVARBPROC)this->m_profiledFunctions[2548]))(location,count,value);this->profiler.end(2548,profilingStart);}
+void m_glMultiTexCoord3s_profiling(GLenum target,GLshort s,GLshort t,GLshort r)const{auto const profilingStart=this->profiler.begin(2549);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD3SPROC)this->m_profiledFunctions[2549]))(target,s,t,r);this->profiler.end(2549,profilingStart);}
+void m_glGetHistogramParameterfvEXT_profiling(GLenum target,GLenum pname,GLfloat* params)const{auto const profilingStart=this->profiler.begin(2550);(this->*((FunctionTable::MEMBERPFNGLGETHISTOGRAMPARAMETERFVEXTPROC)this->m_profiledFunctions[2550]))(target,pname,params);this->profiler.end(2550,profilingStart);}
+void m_glGetProgramStringNV_profiling(GLuint id,GLenum pname,GLubyte* program)const{auto const profilingStart=this->profiler.begin(2551);(this->*((FunctionTable::MEMBERPFNGLGETPROGRAMSTRINGNVPROC)this->m_profiledFunctions[2551]))(id,pname,program);this->profiler.end(2551,profilingStart);}
+void m_glGetTexGenxvOES_profiling(GLenum coord,GLenum pname,GLfixed* params)const{auto const profilingStart=this->profiler.begin(2552);(this->*((FunctionTable::MEMBERPFNGLGETTEXGENXVOESPROC)this->m_profiledFunctions[2552]))(coord,pname,params);this->profiler.end(2552,profilingStart);}
+void m_glTextureSubImage2D_profiling(GLuint texture,GLint level,GLint xoffset,GLint yoffset,GLsizei width,GLsizei height,GLenum format,GLenum type,const void* pixels)const{auto const profilingStart=this->profiler.begin(2553);(this->*((FunctionTable::MEMBERPFNGLTEXTURESUBIMAGE2DPROC)this->m_profiledFunctions[2553]))(texture,level,xoffset,yoffset,width,height,format,type,pixels);this->profiler.end(2553,profilingStart);}
+GLenum m_glObjectPurgeableAPPLE_profiling(GLenum objectType,GLuint name,GLenum option)const{auto const profilingStart=this->profiler.begin(2554);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLOBJECTPURGEABLEAPPLEPROC)this->m_profiledFunctions[2554]))(objectType,name,option);this->profiler.end(2554,profilingStart);return profilingResult;}
+void m_glColorTableSGI_profiling(GLenum target,GLenum internalformat,GLsizei width,GLenum format,GLenum type,const void* table)const{auto const profilingStart=this->profiler.begin(2555);(this->*((FunctionTable::MEMBERPFNGLCOLORTABLESGIPROC)this->m_profiledFunctions[2555]))(target,internalformat,width,format,type,table);this->profiler.end(2555,profilingStart);}
+void m_glCopyConvolutionFilter2DEXT_profiling(GLenum target,GLenum internalformat,GLint x,GLint y,GLsizei width,GLsizei height)const{auto const profilingStart=this->profiler.begin(2556);(this->*((FunctionTable::MEMBERPFNGLCOPYCONVOLUTIONFILTER2DEXTPROC)this->m_profiledFunctions[2556]))(target,internalformat,x,y,width,height);this->profiler.end(2556,profilingStart);}
+void m_glMultiTexCoord3f_profiling(GLenum target,GLfloat s,GLfloat t,GLfloat r)const{auto const profilingStart=this->profiler.begin(2557);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD3FPROC)this->m_profiledFunctions[2557]))(target,s,t,r);this->profiler.end(2557,profilingStart);}
+void m_glMultiTexCoord3d_profiling(GLenum target,GLdouble s,GLdouble t,GLdouble r)const{auto const profilingStart=this->profiler.begin(2558);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD3DPROC)this->m_profiledFunctions[2558]))(target,s,t,r);this->profiler.end(2558,profilingStart);}
+void m_glFogCoorddv_profiling(const GLdouble* coord)const{auto const profilingStart=this->profiler.begin(2559);(this->*((FunctionTable::MEMBERPFNGLFOGCOORDDVPROC)this->m_profiledFunctions[2559]))(coord);this->profiler.end(2559,profilingStart);}
+void m_glGetBufferPointerv_profiling(GLenum target,GLenum pname,void** params)const{auto const profilingStart=this->profiler.begin(2560);(this->*((FunctionTable::MEMBERPFNGLGETBUFFERPOINTERVPROC)this->m_profiledFunctions[2560]))(target,pname,params);this->profiler.end(2560,profilingStart);}
+void m_glProgramUniform1fEXT_profiling(GLuint program,GLint location,GLfloat v0)const{auto const profilingStart=this->profiler.begin(2561);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1FEXTPROC)this->m_profiledFunctions[2561]))(program,location,v0);this->profiler.end(2561,profilingStart);}
+void m_glWindowPos2fvMESA_profiling(const GLfloat* v)const{auto const profilingStart=this->profiler.begin(2562);(this->*((FunctionTable::MEMBERPFNGLWINDOWPOS2FVMESAPROC)this->m_profiledFunctions[2562]))(v);this->profiler.end(2562,profilingStart);}
+void m_glPolygonOffsetxOES_profiling(GLfixed factor,GLfixed units)const{auto const profilingStart=this->profiler.begin(2563);(this->*((FunctionTable::MEMBERPFNGLPOLYGONOFFSETXOESPROC)this->m_profiledFunctions[2563]))(factor,units);this->profiler.end(2563,profilingStart);}
+void m_glVertexAttrib4dARB_profiling(GLuint index,GLdouble x,GLdouble y,GLdouble z,GLdouble w)const{auto const profilingStart=this->profiler.begin(2564);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB4DARBPROC)this->m_profiledFunctions[2564]))(index,x,y,z,w);this->profiler.end(2564,profilingStart);}
+void m_glUniformHandleui64vARB_profiling(GLint location,GLsizei count,const GLuint64* value)const{auto const profilingStart=this->profiler.begin(2565);(this->*((FunctionTable::MEMBERPFNGLUNIFORMHANDLEUI64VARBPROC)this->m_profiledFunctions[2565]))(location,count,value);this->profiler.end(2565,profilingStart);}
+void m_glFragmentLightModelfvSGIX_profiling(GLenum pname,const GLfloat* params)const{auto const profilingStart=this->profiler.begin(2566);(this->*((FunctionTable::MEMBERPFNGLFRAGMENTLIGHTMODELFVSGIXPROC)this->m_profiledFunctions[2566]))(pname,params);this->profiler.end(2566,profilingStart);}
+void m_glSwizzleEXT_profiling(GLuint res,GLuint in,GLenum outX,GLenum outY,GLenum outZ,GLenum outW)const{auto const profilingStart=this->profiler.begin(2567);(this->*((FunctionTable::MEMBERPFNGLSWIZZLEEXTPROC)this->m_profiledFunctions[2567]))(res,in,outX,outY,outZ,outW);this->profiler.end(2567,profilingStart);}
+void m_glBindFragmentShaderATI_profiling(GLuint id)const{auto const profilingStart=this->profiler.begin(2568);(this->*((FunctionTable::MEMBERPFNGLBINDFRAGMENTSHADERATIPROC)this->m_profiledFunctions[2568]))(id);this->profiler.end(2568,profilingStart);}
+void m_glVertexAttribs3hvNV_profiling(GLuint index,GLsizei n,const GLhalfNV* v)const{auto const profilingStart=this->profiler.begin(2569);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBS3HVNVPROC)this->m_profiledFunctions[2569]))(index,n,v);this->profiler.end(2569,profilingStart);}
+void m_glColorP3ui_profiling(GLenum type,GLuint color)const{auto const profilingStart=this->profiler.begin(2570);(this->*((FunctionTable::MEMBERPFNGLCOLORP3UIPROC)this->m_profiledFunctions[2570]))(type,color);this->profiler.end(2570,profilingStart);}
+void m_glListParameterfvSGIX_profiling(GLuint list,GLenum pname,const GLfloat* params)const{auto const profilingStart=this->profiler.begin(2571);(this->*((FunctionTable::MEMBERPFNGLLISTPARAMETERFVSGIXPROC)this->m_profiledFunctions[2571]))(list,pname,params);this->profiler.end(2571,profilingStart);}
+void m_glNamedRenderbufferStorageMultisample_profiling(GLuint renderbuffer,GLsizei samples,GLenum internalformat,GLsizei width,GLsizei height)const{auto const profilingStart=this->profiler.begin(2572);(this->*((FunctionTable::MEMBERPFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC)this->m_profiledFunctions[2572]))(renderbuffer,samples,internalformat,width,height);this->profiler.end(2572,profilingStart);}
+void m_glVertexAttribI1iEXT_profiling(GLuint index,GLint x)const{auto const profilingStart=this->profiler.begin(2573);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBI1IEXTPROC)this->m_profiledFunctions[2573]))(index,x);this->profiler.end(2573,profilingStart);}
+void m_glMultiTexCoord2ivARB_profiling(GLenum target,const GLint* v)const{auto const profilingStart=this->profiler.begin(2574);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD2IVARBPROC)this->m_profiledFunctions[2574]))(target,v);this->profiler.end(2574,profilingStart);}
+void m_glLightModelxOES_profiling(GLenum pname,GLfixed param)const{auto const profilingStart=this->profiler.begin(2575);(this->*((FunctionTable::MEMBERPFNGLLIGHTMODELXOESPROC)this->m_profiledFunctions[2575]))(pname,param);this->profiler.end(2575,profilingStart);}
+void m_glColor3xOES_profiling(GLfixed red,GLfixed green,GLfixed blue)const{auto const profilingStart=this->profiler.begin(2576);(this->*((FunctionTable::MEMBERPFNGLCOLOR3XOESPROC)this->m_profiledFunctions[2576]))(red,green,blue);this->profiler.end(2576,profilingStart);}
+void m_glReadBuffer_profiling(GLenum mode)const{auto const profilingStart=this->profiler.begin(2577);(this->*((FunctionTable::MEMBERPFNGLREADBUFFERPROC)this->m_profiledFunctions[2577]))(mode);this->profiler.end(2577,profilingStart);}
+void m_glStencilFillPathInstancedNV_profiling(GLsizei numPaths,GLenum pathNameType,const void* paths,GLuint pathBase,GLenum fillMode,GLuint mask,GLenum transformType,const GLfloat* transformValues)const{auto const profilingStart=this->profiler.begin(2578);(this->*((FunctionTable::MEMBERPFNGLSTENCILFILLPATHINSTANCEDNVPROC)this->m_profiledFunctions[2578]))(numPaths,pathNameType,paths,pathBase,fillMode,mask,transformType,transformValues);this->profiler.end(2578,profilingStart);}
+void m_glVDPAUUnmapSurfacesNV_profiling(GLsizei numSurface,const GLvdpauSurfaceNV* surfaces)const{auto const profilingStart=this->profiler.begin(2579);(this->*((FunctionTable::MEMBERPFNGLVDPAUUNMAPSURFACESNVPROC)this->m_profiledFunctions[2579]))(numSurface,surfaces);this->profiler.end(2579,profilingStart);}
+void m_glProgramUniform4i64NV_profiling(GLuint program,GLint location,GLint64EXT x,GLint64EXT y,GLint64EXT z,GLint64EXT w)const{auto const profilingStart=this->profiler.begin(2580);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4I64NVPROC)this->m_profiledFunctions[2580]))(program,location,x,y,z,w);this->profiler.end(2580,profilingStart);}
+void m_glVertexStream4dvATI_profiling(GLenum stream,const GLdouble* coords)const{auto const profilingStart=this->profiler.begin(2581);(this->*((FunctionTable::MEMBERPFNGLVERTEXSTREAM4DVATIPROC)this->m_profiledFunctions[2581]))(stream,coords);this->profiler.end(2581,profilingStart);}
+GLboolean m_glIsQuery_profiling(GLuint id)const{auto const profilingStart=this->profiler.begin(2582);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLISQUERYPROC)this->m_profiledFunctions[2582]))(id);this->profiler.end(2582,profilingStart);return profilingResult;}
+void m_glProgramUniformMatrix4fvEXT_profiling(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{auto const profilingStart=this->profiler.begin(2583);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4FVEXTPROC)this->m_profiledFunctions[2583]))(program,location,count,transpose,value);this->profiler.end(2583,profilingStart);}
+void m_glVertexAttrib3hNV_profiling(GLuint index,GLhalfNV x,GLhalfNV y,GLhalfNV z)const{auto const profilingStart=this->profiler.begin(2584);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB3HNVPROC)this->m_profiledFunctions[2584]))(index,x,y,z);this->profiler.end(2584,profilingStart);}
+void m_glFlushMappedNamedBufferRange_profiling(GLuint buffer,GLintptr offset,GLsizeiptr length)const{auto const profilingStart=this->profiler.begin(2585);(this->*((FunctionTable::MEMBERPFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC)this->m_profiledFunctions[2585]))(buffer,offset,length);this->profiler.end(2585,profilingStart);}
+void m_glPushName_profiling(GLuint name)const{auto const profilingStart=this->profiler.begin(2586);(this->*((FunctionTable::MEMBERPFNGLPUSHNAMEPROC)this->m_profiledFunctions[2586]))(name);this->profiler.end(2586,profilingStart);}
+void m_glGetClipPlane_profiling(GLenum plane,GLdouble* equation)const{auto const profilingStart=this->profiler.begin(2587);(this->*((FunctionTable::MEMBERPFNGLGETCLIPPLANEPROC)this->m_profiledFunctions[2587]))(plane,equation);this->profiler.end(2587,profilingStart);}
+void m_glVertex4dv_profiling(const GLdouble* v)const{auto const profilingStart=this->profiler.begin(2588);(this->*((FunctionTable::MEMBERPFNGLVERTEX4DVPROC)this->m_profiledFunctions[2588]))(v);this->profiler.end(2588,profilingStart);}
+void m_glVertexAttrib3d_profiling(GLuint index,GLdouble x,GLdouble y,GLdouble z)const{auto const profilingStart=this->profiler.begin(2589);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB3DPROC)this->m_profiledFunctions[2589]))(index,x,y,z);this->profiler.end(2589,profilingStart);}
+void m_glBlendColor_profiling(GLfloat red,GLfloat green,GLfloat blue,GLfloat alpha)const{auto const profilingStart=this->profiler.begin(2590);(this->*((FunctionTable::MEMBERPFNGLBLENDCOLORPROC)this->m_profiledFunctions[2590]))(red,green,blue,alpha);this->profiler.end(2590,profilingStart);}
+void m_glBindTransformFeedbackNV_profiling(GLenum target,GLuint id)const{auto const profilingStart=this->profiler.begin(2591);(this->*((FunctionTable::MEMBERPFNGLBINDTRANSFORMFEEDBACKNVPROC)this->m_profiledFunctions[2591]))(target,id);this->profiler.end(2591,profilingStart);}
+void m_glSamplerParameterIuiv_profiling(GLuint sampler,GLenum pname,const GLuint* param)const{auto const profilingStart=this->profiler.begin(2592);(this->*((FunctionTable::MEMBERPFNGLSAMPLERPARAMETERIUIVPROC)this->m_profiledFunctions[2592]))(sampler,pname,param);this->profiler.end(2592,profilingStart);}
+void m_glIndexubv_profiling(const GLubyte* c)const{auto const profilingStart=this->profiler.begin(2593);(this->*((FunctionTable::MEMBERPFNGLINDEXUBVPROC)this->m_profiledFunctions[2593]))(c);this->profiler.end(2593,profilingStart);}
+void m_glNamedBufferPageCommitmentEXT_profiling(GLuint buffer,GLintptr offset,GLsizeiptr size,GLboolean commit)const{auto const profilingStart=this->profiler.begin(2594);(this->*((FunctionTable::MEMBERPFNGLNAMEDBUFFERPAGECOMMITMENTEXTPROC)this->m_profiledFunctions[2594]))(buffer,offset,size,commit);this->profiler.end(2594,profilingStart);}
+GLenum m_glCheckNamedFramebufferStatus_profiling(GLuint framebuffer,GLenum target)const{auto const profilingStart=this->profiler.begin(2595);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC)this->m_profiledFunctions[2595]))(framebuffer,target);this->profiler.end(2595,profilingStart);return profilingResult;}
+void m_glGetObjectBufferfvATI_profiling(GLuint buffer,GLenum pname,GLfloat* params)const{auto const profilingStart=this->profiler.begin(2596);(this->*((FunctionTable::MEMBERPFNGLGETOBJECTBUFFERFVATIPROC)this->m_profiledFunctions[2596]))(buffer,pname,params);this->profiler.end(2596,profilingStart);}
+void m_glRasterPos4d_profiling(GLdouble x,GLdouble y,GLdouble z,GLdouble w)const{auto const profilingStart=this->profiler.begin(2597);(this->*((FunctionTable::MEMBERPFNGLRASTERPOS4DPROC)this->m_profiledFunctions[2597]))(x,y,z,w);this->profiler.end(2597,profilingStart);}
+void m_glRasterPos4f_profiling(GLfloat x,GLfloat y,GLfloat z,GLfloat w)const{auto const profilingStart=this->profiler.begin(2598);(this->*((FunctionTable::MEMBERPFNGLRASTERPOS4FPROC)this->m_profiledFunctions[2598]))(x,y,z,w);this->profiler.end(2598,profilingStart);}
+void m_glGetPerfMonitorCounterStringAMD_profiling(GLuint group,GLuint counter,GLsizei bufSize,GLsizei* length,GLchar* counterString)const{auto const profilingStart=this->profiler.begin(2599);(this->*((FunctionTable::MEMBERPFNGLGETPERFMONITORCOUNTERSTRINGAMDPROC)this->m_profiledFunctions[2599]))(group,counter,bufSize,length,counterString);this->profiler.end(2599,profilingStart);}
+void m_glVertexAttrib3s_profiling(GLuint index,GLshort x,GLshort y,GLshort z)const{auto const profilingStart=this->profiler.begin(2600);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB3SPROC)this->m_profiledFunctions[2600]))(index,x,y,z);this->profiler.end(2600,profilingStart);}
+void m_glDrawElementsInstancedEXT_profiling(GLenum mode,GLsizei count,GLenum type,const void* indices,GLsizei primcount)const{auto const profilingStart=this->profiler.begin(2601);(this->*((FunctionTable::MEMBERPFNGLDRAWELEMENTSINSTANCEDEXTPROC)this->m_profiledFunctions[2601]))(mode,count,type,indices,primcount);this->profiler.end(2601,profilingStart);}
+void m_glNamedProgramLocalParameterI4iEXT_profiling(GLuint program,GLenum target,GLuint index,GLint x,GLint y,GLint z,GLint w)const{auto const profilingStart=this->profiler.begin(2602);(this->*((FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERI4IEXTPROC)this->m_profiledFunctions[2602]))(program,target,index,x,y,z,w);this->profiler.end(2602,profilingStart);}
+void m_glRasterPos4s_profiling(GLshort x,GLshort y,GLshort z,GLshort w)const{auto const profilingStart=this->profiler.begin(2603);(this->*((FunctionTable::MEMBERPFNGLRASTERPOS4SPROC)this->m_profiledFunctions[2603]))(x,y,z,w);this->profiler.end(2603,profilingStart);}
+void m_glGetProgramStageiv_profiling(GLuint program,GLenum shadertype,GLenum pname,GLint* values)const{auto const profilingStart=this->profiler.begin(2604);(this->*((FunctionTable::MEMBERPFNGLGETPROGRAMSTAGEIVPROC)this->m_profiledFunctions[2604]))(program,shadertype,pname,values);this->profiler.end(2604,profilingStart);}
+void m_glGetMaterialxOES_profiling(GLenum face,GLenum pname,GLfixed param)const{auto const profilingStart=this->profiler.begin(2605);(this->*((FunctionTable::MEMBERPFNGLGETMATERIALXOESPROC)this->m_profiledFunctions[2605]))(face,pname,param);this->profiler.end(2605,profilingStart);}
+void m_glPopMatrix_profiling()const{auto const profilingStart=this->profiler.begin(2606);(this->*((FunctionTable::MEMBERPFNGLPOPMATRIXPROC)this->m_profiledFunctions[2606]))();this->profiler.end(2606,profilingStart);}
+void m_glGetVideoui64vNV_profiling(GLuint video_slot,GLenum pname,GLuint64EXT* params)const{auto const profilingStart=this->profiler.begin(2607);(this->*((FunctionTable::MEMBERPFNGLGETVIDEOUI64VNVPROC)this->m_profiledFunctions[2607]))(video_slot,pname,params);this->profiler.end(2607,profilingStart);}
+void m_glTangent3bEXT_profiling(GLbyte tx,GLbyte ty,GLbyte tz)const{auto const profilingStart=this->profiler.begin(2608);(this->*((FunctionTable::MEMBERPFNGLTANGENT3BEXTPROC)this->m_profiledFunctions[2608]))(tx,ty,tz);this->profiler.end(2608,profilingStart);}
+GLenum m_glGetGraphicsResetStatusARB_profiling()const{auto const profilingStart=this->profiler.begin(2609);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLGETGRAPHICSRESETSTATUSARBPROC)this->m_profiledFunctions[2609]))();this->profiler.end(2609,profilingStart);return profilingResult;}
+void m_glUniform4i_profiling(GLint location,GLint v0,GLint v1,GLint v2,GLint v3)const{auto const profilingStart=this->profiler.begin(2610);(this->*((FunctionTable::MEMBERPFNGLUNIFORM4IPROC)this->m_profiledFunctions[2610]))(location,v0,v1,v2,v3);this->profiler.end(2610,profilingStart);}
+void m_glActiveTexture_profiling(GLenum texture)const{auto const profilingStart=this->profiler.begin(2611);(this->*((FunctionTable::MEMBERPFNGLACTIVETEXTUREPROC)this->m_profiledFunctions[2611]))(texture);this->profiler.end(2611,profilingStart);}
+void m_glEnableVertexAttribArray_profiling(GLuint index)const{auto const profilingStart=this->profiler.begin(2612);(this->*((FunctionTable::MEMBERPFNGLENABLEVERTEXATTRIBARRAYPROC)this->m_profiledFunctions[2612]))(index);this->profiler.end(2612,profilingStart);}
+void m_glTexCoord4fVertex4fvSUN_profiling(const GLfloat* tc,const GLfloat* v)const{auto const profilingStart=this->profiler.begin(2613);(this->*((FunctionTable::MEMBERPFNGLTEXCOORD4FVERTEX4FVSUNPROC)this->m_profiledFunctions[2613]))(tc,v);this->profiler.end(2613,profilingStart);}
+void m_glUniform4d_profiling(GLint location,GLdouble x,GLdouble y,GLdouble z,GLdouble w)const{auto const profilingStart=this->profiler.begin(2614);(this->*((FunctionTable::MEMBERPFNGLUNIFORM4DPROC)this->m_profiledFunctions[2614]))(location,x,y,z,w);this->profiler.end(2614,profilingStart);}
+void m_glUniform4f_profiling(GLint location,GLfloat v0,GLfloat v1,GLfloat v2,GLfloat v3)const{auto const profilingStart=this->profiler.begin(2615);(this->*((FunctionTable::MEMBERPFNGLUNIFORM4FPROC)this->m_profiledFunctions[2615]))(location,v0,v1,v2,v3);this->profiler.end(2615,profilingStart);}
+void m_glRenderbufferStorageMultisample_profiling(GLenum target,GLsizei samples,GLenum internalformat,GLsizei width,GLsizei height)const{auto const profilingStart=this->profiler.begin(2616);(this->*((FunctionTable::MEMBERPFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC)this->m_profiledFunctions[2616]))(target,samples,internalformat,width,height);this->profiler.end(2616,profilingStart);}
+void m_glCreateProgramPipelines_profiling(GLsizei n,GLuint* pipelines)const{auto const profilingStart=this->profiler.begin(2617);(this->*((FunctionTable::MEMBERPFNGLCREATEPROGRAMPIPELINESPROC)this->m_profiledFunctions[2617]))(n,pipelines);this->profiler.end(2617,profilingStart);}
+void m_glVertexAttribLPointer_profiling(GLuint index,GLint size,GLenum type,GLsizei stride,const void* pointer)const{auto const profilingStart=this->profiler.begin(2618);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBLPOINTERPROC)this->m_profiledFunctions[2618]))(index,size,type,stride,pointer);this->profiler.end(2618,profilingStart);}
+void m_glUniform2uiEXT_profiling(GLint location,GLuint v0,GLuint v1)const{auto const profilingStart=this->profiler.begin(2619);(this->*((FunctionTable::MEMBERPFNGLUNIFORM2UIEXTPROC)this->m_profiledFunctions[2619]))(location,v0,v1);this->profiler.end(2619,profilingStart);}
+void m_glMultiTexCoord3sv_profiling(GLenum target,const GLshort* v)const{auto const profilingStart=this->profiler.begin(2620);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD3SVPROC)this->m_profiledFunctions[2620]))(target,v);this->profiler.end(2620,profilingStart);}
+void m_glDrawElementsInstancedBaseVertex_profiling(GLenum mode,GLsizei count,GLenum type,const void* indices,GLsizei instancecount,GLint basevertex)const{auto const profilingStart=this->profiler.begin(2621);(this->*((FunctionTable::MEMBERPFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC)this->m_profiledFunctions[2621]))(mode,count,type,indices,instancecount,basevertex);this->profiler.end(2621,profilingStart);}
+void m_glPixelTransformParameterfvEXT_profiling(GLenum target,GLenum pname,const GLfloat* params)const{auto const profilingStart=this->profiler.begin(2622);(this->*((FunctionTable::MEMBERPFNGLPIXELTRANSFORMPARAMETERFVEXTPROC)this->m_profiledFunctions[2622]))(target,pname,params);this->profiler.end(2622,profilingStart);}
+void m_glDrawTransformFeedbackNV_profiling(GLenum mode,GLuint id)const{auto const profilingStart=this->profiler.begin(2623);(this->*((FunctionTable::MEMBERPFNGLDRAWTRANSFORMFEEDBACKNVPROC)this->m_profiledFunctions[2623]))(mode,id);this->profiler.end(2623,profilingStart);}
+void m_glTextureImage2DMultisampleCoverageNV_profiling(GLuint texture,GLenum target,GLsizei coverageSamples,GLsizei colorSamples,GLint internalFormat,GLsizei width,GLsizei height,GLboolean fixedSampleLocations)const{auto const profilingStart=this->profiler.begin(2624);(this->*((FunctionTable::MEMBERPFNGLTEXTUREIMAGE2DMULTISAMPLECOVERAGENVPROC)this->m_profiledFunctions[2624]))(texture,target,coverageSamples,colorSamples,internalFormat,width,height,fixedSampleLocations);this->profiler.end(2624,profilingStart);}
+void m_glNamedRenderbufferStorageMultisampleCoverageEXT_profiling(GLuint renderbuffer,GLsizei coverageSamples,GLsizei colorSamples,GLenum internalformat,GLsizei width,GLsizei height)const{auto const profilingStart=this->profiler.begin(2625);(this->*((FunctionTable::MEMBERPFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLECOVERAGEEXTPROC)this->m_profiledFunctions[2625]))(renderbuffer,coverageSamples,colorSamples,internalformat,width,height);this->profiler.end(2625,profilingStart);}
+GLboolean m_glIsTexture_profiling(GLuint texture)const{auto const profilingStart=this->profiler.begin(2626);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLISTEXTUREPROC)this->m_profiledFunctions[2626]))(texture);this->profiler.end(2626,profilingStart);return profilingResult;}
+void m_glMultiTexCoord4iv_profiling(GLenum target,const GLint* v)const{auto const profilingStart=this->profiler.begin(2627);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD4IVPROC)this->m_profiledFunctions[2627]))(target,v);this->profiler.end(2627,profilingStart);}
+void m_glTexEnvfv_profiling(GLenum target,GLenum pname,const GLfloat* params)const{auto const profilingStart=this->profiler.begin(2628);(this->*((FunctionTable::MEMBERPFNGLTEXENVFVPROC)this->m_profiledFunctions[2628]))(target,pname,params);this->profiler.end(2628,profilingStart);}
+void m_glPopDebugGroup_profiling()const{auto const profilingStart=this->profiler.begin(2629);(this->*((FunctionTable::MEMBERPFNGLPOPDEBUGGROUPPROC)this->m_profiledFunctions[2629]))();this->profiler.end(2629,profilingStart);}
+void m_glUniformBlockBinding_profiling(GLuint program,GLuint uniformBlockIndex,GLuint uniformBlockBinding)const{auto const profilingStart=this->profiler.begin(2630);(this->*((FunctionTable::MEMBERPFNGLUNIFORMBLOCKBINDINGPROC)this->m_profiledFunctions[2630]))(program,uniformBlockIndex,uniformBlockBinding);this->profiler.end(2630,profilingStart);}
+void m_glWindowPos2svMESA_profiling(const GLshort* v)const{auto const profilingStart=this->profiler.begin(2631);(this->*((FunctionTable::MEMBERPFNGLWINDOWPOS2SVMESAPROC)this->m_profiledFunctions[2631]))(v);this->profiler.end(2631,profilingStart);}
+void m_glGenerateTextureMipmapEXT_profiling(GLuint texture,GLenum target)const{auto const profilingStart=this->profiler.begin(2632);(this->*((FunctionTable::MEMBERPFNGLGENERATETEXTUREMIPMAPEXTPROC)this->m_profiledFunctions[2632]))(texture,target);this->profiler.end(2632,profilingStart);}
+GLuint m_glBindLightParameterEXT_profiling(GLenum light,GLenum value)const{auto const profilingStart=this->profiler.begin(2633);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLBINDLIGHTPARAMETEREXTPROC)this->m_profiledFunctions[2633]))(light,value);this->profiler.end(2633,profilingStart);return profilingResult;}
+void m_glTexCoord3bOES_profiling(GLbyte s,GLbyte t,GLbyte r)const{auto const profilingStart=this->profiler.begin(2634);(this->*((FunctionTable::MEMBERPFNGLTEXCOORD3BOESPROC)this->m_profiledFunctions[2634]))(s,t,r);this->profiler.end(2634,profilingStart);}
+void m_glTexCoordPointer_profiling(GLint size,GLenum type,GLsizei stride,const GLvoid* ptr)const{auto const profilingStart=this->profiler.begin(2635);(this->*((FunctionTable::MEMBERPFNGLTEXCOORDPOINTERPROC)this->m_profiledFunctions[2635]))(size,type,stride,ptr);this->profiler.end(2635,profilingStart);}
+void m_glProgramUniformMatrix3x2fv_profiling(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{auto const profilingStart=this->profiler.begin(2636);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X2FVPROC)this->m_profiledFunctions[2636]))(program,location,count,transpose,value);this->profiler.end(2636,profilingStart);}
+void m_glUniform2fvARB_profiling(GLint location,GLsizei count,const GLfloat* value)const{auto const profilingStart=this->profiler.begin(2637);(this->*((FunctionTable::MEMBERPFNGLUNIFORM2FVARBPROC)this->m_profiledFunctions[2637]))(location,count,value);this->profiler.end(2637,profilingStart);}
+void m_glProgramLocalParameterI4uivNV_profiling(GLenum target,GLuint index,const GLuint* params)const{auto const profilingStart=this->profiler.begin(2638);(this->*((FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERI4UIVNVPROC)this->m_profiledFunctions[2638]))(target,index,params);this->profiler.end(2638,profilingStart);}
+void m_glFlushVertexArrayRangeNV_profiling()const{auto const profilingStart=this->profiler.begin(2639);(this->*((FunctionTable::MEMBERPFNGLFLUSHVERTEXARRAYRANGENVPROC)this->m_profiledFunctions[2639]))();this->profiler.end(2639,profilingStart);}
+void m_glSecondaryColor3svEXT_profiling(const GLshort* v)const{auto const profilingStart=this->profiler.begin(2640);(this->*((FunctionTable::MEMBERPFNGLSECONDARYCOLOR3SVEXTPROC)this->m_profiledFunctions[2640]))(v);this->profiler.end(2640,profilingStart);}
+void m_glGetBufferParameteriv_profiling(GLenum target,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(2641);(this->*((FunctionTable::MEMBERPFNGLGETBUFFERPARAMETERIVPROC)this->m_profiledFunctions[2641]))(target,pname,params);this->profiler.end(2641,profilingStart);}
+void m_glGetQueryIndexediv_profiling(GLenum target,GLuint index,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(2642);(this->*((FunctionTable::MEMBERPFNGLGETQUERYINDEXEDIVPROC)this->m_profiledFunctions[2642]))(target,index,pname,params);this->profiler.end(2642,profilingStart);}
+void m_glFramebufferTexture3DEXT_profiling(GLenum target,GLenum attachment,GLenum textarget,GLuint texture,GLint level,GLint zoffset)const{auto const profilingStart=this->profiler.begin(2643);(this->*((FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURE3DEXTPROC)this->m_profiledFunctions[2643]))(target,attachment,textarget,texture,level,zoffset);this->profiler.end(2643,profilingStart);}
+void m_glLoadTransposeMatrixxOES_profiling(const GLfixed* m)const{auto const profilingStart=this->profiler.begin(2644);(this->*((FunctionTable::MEMBERPFNGLLOADTRANSPOSEMATRIXXOESPROC)this->m_profiledFunctions[2644]))(m);this->profiler.end(2644,profilingStart);}
+void m_glDeleteTransformFeedbacksNV_profiling(GLsizei n,const GLuint* ids)const{auto const profilingStart=this->profiler.begin(2645);(this->*((FunctionTable::MEMBERPFNGLDELETETRANSFORMFEEDBACKSNVPROC)this->m_profiledFunctions[2645]))(n,ids);this->profiler.end(2645,profilingStart);}
+void m_glGetCompressedTextureImageEXT_profiling(GLuint texture,GLenum target,GLint lod,void* img)const{auto const profilingStart=this->profiler.begin(2646);(this->*((FunctionTable::MEMBERPFNGLGETCOMPRESSEDTEXTUREIMAGEEXTPROC)this->m_profiledFunctions[2646]))(texture,target,lod,img);this->profiler.end(2646,profilingStart);}
+void m_glIndexMaterialEXT_profiling(GLenum face,GLenum mode)const{auto const profilingStart=this->profiler.begin(2647);(this->*((FunctionTable::MEMBERPFNGLINDEXMATERIALEXTPROC)this->m_profiledFunctions[2647]))(face,mode);this->profiler.end(2647,profilingStart);}
+void m_glFogCoorddEXT_profiling(GLdouble coord)const{auto const profilingStart=this->profiler.begin(2648);(this->*((FunctionTable::MEMBERPFNGLFOGCOORDDEXTPROC)this->m_profiledFunctions[2648]))(coord);this->profiler.end(2648,profilingStart);}
+void m_glTexCoord2hvNV_profiling(const GLhalfNV* v)const{auto const profilingStart=this->profiler.begin(2649);(this->*((FunctionTable::MEMBERPFNGLTEXCOORD2HVNVPROC)this->m_profiledFunctions[2649]))(v);this->profiler.end(2649,profilingStart);}
+void m_glFramebufferTexture2DEXT_profiling(GLenum target,GLenum attachment,GLenum textarget,GLuint texture,GLint level)const{auto const profilingStart=this->profiler.begin(2650);(this->*((FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURE2DEXTPROC)this->m_profiledFunctions[2650]))(target,attachment,textarget,texture,level);this->profiler.end(2650,profilingStart);}
+void m_glTexEnviv_profiling(GLenum target,GLenum pname,const GLint* params)const{auto const profilingStart=this->profiler.begin(2651);(this->*((FunctionTable::MEMBERPFNGLTEXENVIVPROC)this->m_profiledFunctions[2651]))(target,pname,params);this->profiler.end(2651,profilingStart);}
+void m_glEndTransformFeedbackNV_profiling()const{auto const profilingStart=this->profiler.begin(2652);(this->*((FunctionTable::MEMBERPFNGLENDTRANSFORMFEEDBACKNVPROC)this->m_profiledFunctions[2652]))();this->profiler.end(2652,profilingStart);}
+void m_glGlobalAlphaFactoruiSUN_profiling(GLuint factor)const{auto const profilingStart=this->profiler.begin(2653);(this->*((FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORUISUNPROC)this->m_profiledFunctions[2653]))(factor);this->profiler.end(2653,profilingStart);}
+void m_glSelectBuffer_profiling(GLsizei size,GLuint* buffer)const{auto const profilingStart=this->profiler.begin(2654);(this->*((FunctionTable::MEMBERPFNGLSELECTBUFFERPROC)this->m_profiledFunctions[2654]))(size,buffer);this->profiler.end(2654,profilingStart);}
+void m_glNamedBufferSubDataEXT_profiling(GLuint buffer,GLintptr offset,GLsizeiptr size,const void* data)const{auto const profilingStart=this->profiler.begin(2655);(this->*((FunctionTable::MEMBERPFNGLNAMEDBUFFERSUBDATAEXTPROC)this->m_profiledFunctions[2655]))(buffer,offset,size,data);this->profiler.end(2655,profilingStart);}
+void m_glDisableVertexArrayAttrib_profiling(GLuint vaobj,GLuint index)const{auto const profilingStart=this->profiler.begin(2656);(this->*((FunctionTable::MEMBERPFNGLDISABLEVERTEXARRAYATTRIBPROC)this->m_profiledFunctions[2656]))(vaobj,index);this->profiler.end(2656,profilingStart);}
+void m_glBlendFunc_profiling(GLenum sfactor,GLenum dfactor)const{auto const profilingStart=this->profiler.begin(2657);(this->*((FunctionTable::MEMBERPFNGLBLENDFUNCPROC)this->m_profiledFunctions[2657]))(sfactor,dfactor);this->profiler.end(2657,profilingStart);}
+GLuint m_glCreateProgram_profiling()const{auto const profilingStart=this->profiler.begin(2658);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLCREATEPROGRAMPROC)this->m_profiledFunctions[2658]))();this->profiler.end(2658,profilingStart);return profilingResult;}
+void m_glVertexStream2dATI_profiling(GLenum stream,GLdouble x,GLdouble y)const{auto const profilingStart=this->profiler.begin(2659);(this->*((FunctionTable::MEMBERPFNGLVERTEXSTREAM2DATIPROC)this->m_profiledFunctions[2659]))(stream,x,y);this->profiler.end(2659,profilingStart);}
+void m_glUniform4ui64vARB_profiling(GLint location,GLsizei count,const GLuint64* value)const{auto const profilingStart=this->profiler.begin(2660);(this->*((FunctionTable::MEMBERPFNGLUNIFORM4UI64VARBPROC)this->m_profiledFunctions[2660]))(location,count,value);this->profiler.end(2660,profilingStart);}
+void m_glPrimitiveRestartIndex_profiling(GLuint index)const{auto const profilingStart=this->profiler.begin(2661);(this->*((FunctionTable::MEMBERPFNGLPRIMITIVERESTARTINDEXPROC)this->m_profiledFunctions[2661]))(index);this->profiler.end(2661,profilingStart);}
+void m_glNormalStream3fATI_profiling(GLenum stream,GLfloat nx,GLfloat ny,GLfloat nz)const{auto const profilingStart=this->profiler.begin(2662);(this->*((FunctionTable::MEMBERPFNGLNORMALSTREAM3FATIPROC)this->m_profiledFunctions[2662]))(stream,nx,ny,nz);this->profiler.end(2662,profilingStart);}
+void m_glProgramUniformMatrix2fv_profiling(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{auto const profilingStart=this->profiler.begin(2663);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2FVPROC)this->m_profiledFunctions[2663]))(program,location,count,transpose,value);this->profiler.end(2663,profilingStart);}
+void m_glVertexAttribs1hvNV_profiling(GLuint index,GLsizei n,const GLhalfNV* v)const{auto const profilingStart=this->profiler.begin(2664);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBS1HVNVPROC)this->m_profiledFunctions[2664]))(index,n,v);this->profiler.end(2664,profilingStart);}
+void m_glWindowPos4svMESA_profiling(const GLshort* v)const{auto const profilingStart=this->profiler.begin(2665);(this->*((FunctionTable::MEMBERPFNGLWINDOWPOS4SVMESAPROC)this->m_profiledFunctions[2665]))(v);this->profiler.end(2665,profilingStart);}
+void m_glDeleteFragmentShaderATI_profiling(GLuint id)const{auto const profilingStart=this->profiler.begin(2666);(this->*((FunctionTable::MEMBERPFNGLDELETEFRAGMENTSHADERATIPROC)this->m_profiledFunctions[2666]))(id);this->profiler.end(2666,profilingStart);}
+void m_glBindImageTextures_profiling(GLuint first,GLsizei count,const GLuint* textures)const{auto const profilingStart=this->profiler.begin(2667);(this->*((FunctionTable::MEMBERPFNGLBINDIMAGETEXTURESPROC)this->m_profiledFunctions[2667]))(first,count,textures);this->profiler.end(2667,profilingStart);}
+void m_glMap2xOES_profiling(GLenum target,GLfixed u1,GLfixed u2,GLint ustride,GLint uorder,GLfixed v1,GLfixed v2,GLint vstride,GLint vorder,GLfixed points)const{auto const profilingStart=this->profiler.begin(2668);(this->*((FunctionTable::MEMBERPFNGLMAP2XOESPROC)this->m_profiledFunctions[2668]))(target,u1,u2,ustride,uorder,v1,v2,vstride,vorder,points);this->profiler.end(2668,profilingStart);}
+void m_glEnd_profiling()const{auto const profilingStart=this->profiler.begin(2669);(this->*((FunctionTable::MEMBERPFNGLENDPROC)this->m_profiledFunctions[2669]))();this->profiler.end(2669,profilingStart);}
+void m_glMultiTexCoord2dARB_profiling(GLenum target,GLdouble s,GLdouble t)const{auto const profilingStart=this->profiler.begin(2670);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD2DARBPROC)this->m_profiledFunctions[2670]))(target,s,t);this->profiler.end(2670,profilingStart);}
+void m_glUniform1i64NV_profiling(GLint location,GLint64EXT x)const{auto const profilingStart=this->profiler.begin(2671);(this->*((FunctionTable::MEMBERPFNGLUNIFORM1I64NVPROC)this->m_profiledFunctions[2671]))(location,x);this->profiler.end(2671,profilingStart);}
+void m_glPathStringNV_profiling(GLuint path,GLenum format,GLsizei length,const void* pathString)const{auto const profilingStart=this->profiler.begin(2672);(this->*((FunctionTable::MEMBERPFNGLPATHSTRINGNVPROC)this->m_profiledFunctions[2672]))(path,format,length,pathString);this->profiler.end(2672,profilingStart);}
+void m_glGetNamedFramebufferParameterivEXT_profiling(GLuint framebuffer,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(2673);(this->*((FunctionTable::MEMBERPFNGLGETNAMEDFRAMEBUFFERPARAMETERIVEXTPROC)this->m_profiledFunctions[2673]))(framebuffer,pname,params);this->profiler.end(2673,profilingStart);}
+void m_glGetProgramNamedParameterdvNV_profiling(GLuint id,GLsizei len,const GLubyte* name,GLdouble* params)const{auto const profilingStart=this->profiler.begin(2674);(this->*((FunctionTable::MEMBERPFNGLGETPROGRAMNAMEDPARAMETERDVNVPROC)this->m_profiledFunctions[2674]))(id,len,name,params);this->profiler.end(2674,profilingStart);}
+void m_glPathDashArrayNV_profiling(GLuint path,GLsizei dashCount,const GLfloat* dashArray)const{auto const profilingStart=this->profiler.begin(2675);(this->*((FunctionTable::MEMBERPFNGLPATHDASHARRAYNVPROC)this->m_profiledFunctions[2675]))(path,dashCount,dashArray);this->profiler.end(2675,profilingStart);}
+void m_glUniform3uiv_profiling(GLint location,GLsizei count,const GLuint* value)const{auto const profilingStart=this->profiler.begin(2676);(this->*((FunctionTable::MEMBERPFNGLUNIFORM3UIVPROC)this->m_profiledFunctions[2676]))(location,count,value);this->profiler.end(2676,profilingStart);}
+void m_glColor3fVertex3fvSUN_profiling(const GLfloat* c,const GLfloat* v)const{auto const profilingStart=this->profiler.begin(2677);(this->*((FunctionTable::MEMBERPFNGLCOLOR3FVERTEX3FVSUNPROC)this->m_profiledFunctions[2677]))(c,v);this->profiler.end(2677,profilingStart);}
+void m_glMultTransposeMatrixd_profiling(const GLdouble m[16])const{auto const profilingStart=this->profiler.begin(2678);(this->*((FunctionTable::MEMBERPFNGLMULTTRANSPOSEMATRIXDPROC)this->m_profiledFunctions[2678]))(m);this->profiler.end(2678,profilingStart);}
+void m_glClearColor_profiling(GLclampf red,GLclampf green,GLclampf blue,GLclampf alpha)const{auto const profilingStart=this->profiler.begin(2679);(this->*((FunctionTable::MEMBERPFNGLCLEARCOLORPROC)this->m_profiledFunctions[2679]))(red,green,blue,alpha);this->profiler.end(2679,profilingStart);}
+GLuint64 m_glGetImageHandleARB_profiling(GLuint texture,GLint level,GLboolean layered,GLint layer,GLenum format)const{auto const profilingStart=this->profiler.begin(2680);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLGETIMAGEHANDLEARBPROC)this->m_profiledFunctions[2680]))(texture,level,layered,layer,format);this->profiler.end(2680,profilingStart);return profilingResult;}
+void m_glTangent3dEXT_profiling(GLdouble tx,GLdouble ty,GLdouble tz)const{auto const profilingStart=this->profiler.begin(2681);(this->*((FunctionTable::MEMBERPFNGLTANGENT3DEXTPROC)this->m_profiledFunctions[2681]))(tx,ty,tz);this->profiler.end(2681,profilingStart);}
+void m_glGetQueryObjectivARB_profiling(GLuint id,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(2682);(this->*((FunctionTable::MEMBERPFNGLGETQUERYOBJECTIVARBPROC)this->m_profiledFunctions[2682]))(id,pname,params);this->profiler.end(2682,profilingStart);}
+void m_glGetLocalConstantFloatvEXT_profiling(GLuint id,GLenum value,GLfloat* data)const{auto const profilingStart=this->profiler.begin(2683);(this->*((FunctionTable::MEMBERPFNGLGETLOCALCONSTANTFLOATVEXTPROC)this->m_profiledFunctions[2683]))(id,value,data);this->profiler.end(2683,profilingStart);}
+void m_glUseShaderProgramEXT_profiling(GLenum type,GLuint program)const{auto const profilingStart=this->profiler.begin(2684);(this->*((FunctionTable::MEMBERPFNGLUSESHADERPROGRAMEXTPROC)this->m_profiledFunctions[2684]))(type,program);this->profiler.end(2684,profilingStart);}
+void m_glBindRenderbufferEXT_profiling(GLenum target,GLuint renderbuffer)const{auto const profilingStart=this->profiler.begin(2685);(this->*((FunctionTable::MEMBERPFNGLBINDRENDERBUFFEREXTPROC)this->m_profiledFunctions[2685]))(target,renderbuffer);this->profiler.end(2685,profilingStart);}
+void m_glInterleavedArrays_profiling(GLenum format,GLsizei stride,const GLvoid* pointer)const{auto const profilingStart=this->profiler.begin(2686);(this->*((FunctionTable::MEMBERPFNGLINTERLEAVEDARRAYSPROC)this->m_profiledFunctions[2686]))(format,stride,pointer);this->profiler.end(2686,profilingStart);}
+void m_glGetPerfMonitorGroupStringAMD_profiling(GLuint group,GLsizei bufSize,GLsizei* length,GLchar* groupString)const{auto const profilingStart=this->profiler.begin(2687);(this->*((FunctionTable::MEMBERPFNGLGETPERFMONITORGROUPSTRINGAMDPROC)this->m_profiledFunctions[2687]))(group,bufSize,length,groupString);this->profiler.end(2687,profilingStart);}
+void m_glUniform3ui_profiling(GLint location,GLuint v0,GLuint v1,GLuint v2)const{auto const profilingStart=this->profiler.begin(2688);(this->*((FunctionTable::MEMBERPFNGLUNIFORM3UIPROC)this->m_profiledFunctions[2688]))(location,v0,v1,v2);this->profiler.end(2688,profilingStart);}
+void m_glGetNamedProgramLocalParameterdvEXT_profiling(GLuint program,GLenum target,GLuint index,GLdouble* params)const{auto const profilingStart=this->profiler.begin(2689);(this->*((FunctionTable::MEMBERPFNGLGETNAMEDPROGRAMLOCALPARAMETERDVEXTPROC)this->m_profiledFunctions[2689]))(program,target,index,params);this->profiler.end(2689,profilingStart);}
+void m_glSecondaryColor3us_profiling(GLushort red,GLushort green,GLushort blue)const{auto const profilingStart=this->profiler.begin(2690);(this->*((FunctionTable::MEMBERPFNGLSECONDARYCOLOR3USPROC)this->m_profiledFunctions[2690]))(red,green,blue);this->profiler.end(2690,profilingStart);}
+void m_glVertexAttribI4uiv_profiling(GLuint index,const GLuint* v)const{auto const profilingStart=this->profiler.begin(2691);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBI4UIVPROC)this->m_profiledFunctions[2691]))(index,v);this->profiler.end(2691,profilingStart);}
+void m_glVertexAttrib4bv_profiling(GLuint index,const GLbyte* v)const{auto const profilingStart=this->profiler.begin(2692);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB4BVPROC)this->m_profiledFunctions[2692]))(index,v);this->profiler.end(2692,profilingStart);}
+void m_glMultiTexCoord3xOES_profiling(GLenum texture,GLfixed s,GLfixed t,GLfixed r)const{auto const profilingStart=this->profiler.begin(2693);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD3XOESPROC)this->m_profiledFunctions[2693]))(texture,s,t,r);this->profiler.end(2693,profilingStart);}
+void m_glSecondaryColor3ub_profiling(GLubyte red,GLubyte green,GLubyte blue)const{auto const profilingStart=this->profiler.begin(2694);(this->*((FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UBPROC)this->m_profiledFunctions[2694]))(red,green,blue);this->profiler.end(2694,profilingStart);}
+void m_glFragmentMaterialfSGIX_profiling(GLenum face,GLenum pname,GLfloat param)const{auto const profilingStart=this->profiler.begin(2695);(this->*((FunctionTable::MEMBERPFNGLFRAGMENTMATERIALFSGIXPROC)this->m_profiledFunctions[2695]))(face,pname,param);this->profiler.end(2695,profilingStart);}
+void m_glGetVariantArrayObjectivATI_profiling(GLuint id,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(2696);(this->*((FunctionTable::MEMBERPFNGLGETVARIANTARRAYOBJECTIVATIPROC)this->m_profiledFunctions[2696]))(id,pname,params);this->profiler.end(2696,profilingStart);}
+void m_glSecondaryColor3ui_profiling(GLuint red,GLuint green,GLuint blue)const{auto const profilingStart=this->profiler.begin(2697);(this->*((FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UIPROC)this->m_profiledFunctions[2697]))(red,green,blue);this->profiler.end(2697,profilingStart);}
+void m_glVertexAttrib1dARB_profiling(GLuint index,GLdouble x)const{auto const profilingStart=this->profiler.begin(2698);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB1DARBPROC)this->m_profiledFunctions[2698]))(index,x);this->profiler.end(2698,profilingStart);}
+void m_glGetNamedBufferPointerv_profiling(GLuint buffer,GLenum pname,void** params)const{auto const profilingStart=this->profiler.begin(2699);(this->*((FunctionTable::MEMBERPFNGLGETNAMEDBUFFERPOINTERVPROC)this->m_profiledFunctions[2699]))(buffer,pname,params);this->profiler.end(2699,profilingStart);}
+void m_glLockArraysEXT_profiling(GLint first,GLsizei count)const{auto const profilingStart=this->profiler.begin(2700);(this->*((FunctionTable::MEMBERPFNGLLOCKARRAYSEXTPROC)this->m_profiledFunctions[2700]))(first,count);this->profiler.end(2700,profilingStart);}
+void m_glVertexAttribPointerNV_profiling(GLuint index,GLint fsize,GLenum type,GLsizei stride,const void* pointer)const{auto const profilingStart=this->profiler.begin(2701);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBPOINTERNVPROC)this->m_profiledFunctions[2701]))(index,fsize,type,stride,pointer);this->profiler.end(2701,profilingStart);}
+void m_glConvolutionParameterf_profiling(GLenum target,GLenum pname,GLfloat params)const{auto const profilingStart=this->profiler.begin(2702);(this->*((FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERFPROC)this->m_profiledFunctions[2702]))(target,pname,params);this->profiler.end(2702,profilingStart);}
+void m_glBindBufferBaseEXT_profiling(GLenum target,GLuint index,GLuint buffer)const{auto const profilingStart=this->profiler.begin(2703);(this->*((FunctionTable::MEMBERPFNGLBINDBUFFERBASEEXTPROC)this->m_profiledFunctions[2703]))(target,index,buffer);this->profiler.end(2703,profilingStart);}
+void m_glTexCoord2xvOES_profiling(const GLfixed* coords)const{auto const profilingStart=this->profiler.begin(2704);(this->*((FunctionTable::MEMBERPFNGLTEXCOORD2XVOESPROC)this->m_profiledFunctions[2704]))(coords);this->profiler.end(2704,profilingStart);}
+void m_glGetQueryBufferObjectui64v_profiling(GLuint id,GLuint buffer,GLenum pname,GLintptr offset)const{auto const profilingStart=this->profiler.begin(2705);(this->*((FunctionTable::MEMBERPFNGLGETQUERYBUFFEROBJECTUI64VPROC)this->m_profiledFunctions[2705]))(id,buffer,pname,offset);this->profiler.end(2705,profilingStart);}
+void m_glSetMultisamplefvAMD_profiling(GLenum pname,GLuint index,const GLfloat* val)const{auto const profilingStart=this->profiler.begin(2706);(this->*((FunctionTable::MEMBERPFNGLSETMULTISAMPLEFVAMDPROC)this->m_profiledFunctions[2706]))(pname,index,val);this->profiler.end(2706,profilingStart);}
+void m_glPathColorGenNV_profiling(GLenum color,GLenum genMode,GLenum colorFormat,const GLfloat* coeffs)const{auto const profilingStart=this->profiler.begin(2707);(this->*((FunctionTable::MEMBERPFNGLPATHCOLORGENNVPROC)this->m_profiledFunctions[2707]))(color,genMode,colorFormat,coeffs);this->profiler.end(2707,profilingStart);}
+void m_glVertexAttrib3sARB_profiling(GLuint index,GLshort x,GLshort y,GLshort z)const{auto const profilingStart=this->profiler.begin(2708);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB3SARBPROC)this->m_profiledFunctions[2708]))(index,x,y,z);this->profiler.end(2708,profilingStart);}
+void m_glVertexAttrib4ivARB_profiling(GLuint index,const GLint* v)const{auto const profilingStart=this->profiler.begin(2709);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB4IVARBPROC)this->m_profiledFunctions[2709]))(index,v);this->profiler.end(2709,profilingStart);}
+void m_glGenTransformFeedbacks_profiling(GLsizei n,GLuint* ids)const{auto const profilingStart=this->profiler.begin(2710);(this->*((FunctionTable::MEMBERPFNGLGENTRANSFORMFEEDBACKSPROC)this->m_profiledFunctions[2710]))(n,ids);this->profiler.end(2710,profilingStart);}
+void m_glGetVertexAttribIuiv_profiling(GLuint index,GLenum pname,GLuint* params)const{auto const profilingStart=this->profiler.begin(2711);(this->*((FunctionTable::MEMBERPFNGLGETVERTEXATTRIBIUIVPROC)this->m_profiledFunctions[2711]))(index,pname,params);this->profiler.end(2711,profilingStart);}
+void m_glPixelTransformParameterfEXT_profiling(GLenum target,GLenum pname,GLfloat param)const{auto const profilingStart=this->profiler.begin(2712);(this->*((FunctionTable::MEMBERPFNGLPIXELTRANSFORMPARAMETERFEXTPROC)this->m_profiledFunctions[2712]))(target,pname,param);this->profiler.end(2712,profilingStart);}
+void m_glGetTexParameterIuivEXT_profiling(GLenum target,GLenum pname,GLuint* params)const{auto const profilingStart=this->profiler.begin(2713);(this->*((FunctionTable::MEMBERPFNGLGETTEXPARAMETERIUIVEXTPROC)this->m_profiledFunctions[2713]))(target,pname,params);this->profiler.end(2713,profilingStart);}
+void m_glGetObjectParameterivARB_profiling(GLhandleARB obj,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(2714);(this->*((FunctionTable::MEMBERPFNGLGETOBJECTPARAMETERIVARBPROC)this->m_profiledFunctions[2714]))(obj,pname,params);this->profiler.end(2714,profilingStart);}
+void m_glVertexArraySecondaryColorOffsetEXT_profiling(GLuint vaobj,GLuint buffer,GLint size,GLenum type,GLsizei stride,GLintptr offset)const{auto const profilingStart=this->profiler.begin(2715);(this->*((FunctionTable::MEMBERPFNGLVERTEXARRAYSECONDARYCOLOROFFSETEXTPROC)this->m_profiledFunctions[2715]))(vaobj,buffer,size,type,stride,offset);this->profiler.end(2715,profilingStart);}
+void m_glWindowPos2fARB_profiling(GLfloat x,GLfloat y)const{auto const profilingStart=this->profiler.begin(2716);(this->*((FunctionTable::MEMBERPFNGLWINDOWPOS2FARBPROC)this->m_profiledFunctions[2716]))(x,y);this->profiler.end(2716,profilingStart);}
+void m_glCompressedTexSubImage2D_profiling(GLenum target,GLint level,GLint xoffset,GLint yoffset,GLsizei width,GLsizei height,GLenum format,GLsizei imageSize,const GLvoid* data)const{auto const profilingStart=this->profiler.begin(2717);(this->*((FunctionTable::MEMBERPFNGLCOMPRESSEDTEXSUBIMAGE2DPROC)this->m_profiledFunctions[2717]))(target,level,xoffset,yoffset,width,height,format,imageSize,data);this->profiler.end(2717,profilingStart);}
+void m_glCompressedTexSubImage3DARB_profiling(GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLenum format,GLsizei imageSize,const void* data)const{auto const profilingStart=this->profiler.begin(2718);(this->*((FunctionTable::MEMBERPFNGLCOMPRESSEDTEXSUBIMAGE3DARBPROC)this->m_profiledFunctions[2718]))(target,level,xoffset,yoffset,zoffset,width,height,depth,format,imageSize,data);this->profiler.end(2718,profilingStart);}
+void m_glProgramBinary_profiling(GLuint program,GLenum binaryFormat,const void* binary,GLsizei length)const{auto const profilingStart=this->profiler.begin(2719);(this->*((FunctionTable::MEMBERPFNGLPROGRAMBINARYPROC)this->m_profiledFunctions[2719]))(program,binaryFormat,binary,length);this->profiler.end(2719,profilingStart);}
+void m_glPresentFrameKeyedNV_profiling(GLuint video_slot,GLuint64EXT minPresentTime,GLuint beginPresentTimeId,GLuint presentDurationId,GLenum type,GLenum target0,GLuint fill0,GLuint key0,GLenum target1,GLuint fill1,GLuint key1)const{auto const profilingStart=this->profiler.begin(2720);(this->*((FunctionTable::MEMBERPFNGLPRESENTFRAMEKEYEDNVPROC)this->m_profiledFunctions[2720]))(video_slot,minPresentTime,beginPresentTimeId,presentDurationId,type,target0,fill0,key0,target1,fill1,key1);this->profiler.end(2720,profilingStart);}
+void m_glVertexAttribI4bv_profiling(GLuint index,const GLbyte* v)const{auto const profilingStart=this->profiler.begin(2721);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBI4BVPROC)this->m_profiledFunctions[2721]))(index,v);this->profiler.end(2721,profilingStart);}
+void m_glPathCoverDepthFuncNV_profiling(GLenum func)const{auto const profilingStart=this->profiler.begin(2722);(this->*((FunctionTable::MEMBERPFNGLPATHCOVERDEPTHFUNCNVPROC)this->m_profiledFunctions[2722]))(func);this->profiler.end(2722,profilingStart);}
+void m_glTransformFeedbackStreamAttribsNV_profiling(GLsizei count,const GLint* attribs,GLsizei nbuffers,const GLint* bufstreams,GLenum bufferMode)const{auto const profilingStart=this->profiler.begin(2723);(this->*((FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKSTREAMATTRIBSNVPROC)this->m_profiledFunctions[2723]))(count,attribs,nbuffers,bufstreams,bufferMode);this->profiler.end(2723,profilingStart);}
+void m_glSecondaryColor3usEXT_profiling(GLushort red,GLushort green,GLushort blue)const{auto const profilingStart=this->profiler.begin(2724);(this->*((FunctionTable::MEMBERPFNGLSECONDARYCOLOR3USEXTPROC)this->m_profiledFunctions[2724]))(red,green,blue);this->profiler.end(2724,profilingStart);}
+void m_glCopyColorTableSGI_profiling(GLenum target,GLenum internalformat,GLint x,GLint y,GLsizei width)const{auto const profilingStart=this->profiler.begin(2725);(this->*((FunctionTable::MEMBERPFNGLCOPYCOLORTABLESGIPROC)this->m_profiledFunctions[2725]))(target,internalformat,x,y,width);this->profiler.end(2725,profilingStart);}
+void m_glProgramEnvParameter4fvARB_profiling(GLenum target,GLuint index,const GLfloat* params)const{auto const profilingStart=this->profiler.begin(2726);(this->*((FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETER4FVARBPROC)this->m_profiledFunctions[2726]))(target,index,params);this->profiler.end(2726,profilingStart);}
+void m_glMultiTexCoord4sARB_profiling(GLenum target,GLshort s,GLshort t,GLshort r,GLshort q)const{auto const profilingStart=this->profiler.begin(2727);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD4SARBPROC)this->m_profiledFunctions[2727]))(target,s,t,r,q);this->profiler.end(2727,profilingStart);}
+void m_glGetVertexArrayIndexed64iv_profiling(GLuint vaobj,GLuint index,GLenum pname,GLint64* param)const{auto const profilingStart=this->profiler.begin(2728);(this->*((FunctionTable::MEMBERPFNGLGETVERTEXARRAYINDEXED64IVPROC)this->m_profiledFunctions[2728]))(vaobj,index,pname,param);this->profiler.end(2728,profilingStart);}
+void m_glMatrixMultTranspose3x3fNV_profiling(GLenum matrixMode,const GLfloat* m)const{auto const profilingStart=this->profiler.begin(2729);(this->*((FunctionTable::MEMBERPFNGLMATRIXMULTTRANSPOSE3X3FNVPROC)this->m_profiledFunctions[2729]))(matrixMode,m);this->profiler.end(2729,profilingStart);}
+void m_glTexParameterIiv_profiling(GLenum target,GLenum pname,const GLint* params)const{auto const profilingStart=this->profiler.begin(2730);(this->*((FunctionTable::MEMBERPFNGLTEXPARAMETERIIVPROC)this->m_profiledFunctions[2730]))(target,pname,params);this->profiler.end(2730,profilingStart);}
+void m_glVertexArrayAttribFormat_profiling(GLuint vaobj,GLuint attribindex,GLint size,GLenum type,GLboolean normalized,GLuint relativeoffset)const{auto const profilingStart=this->profiler.begin(2731);(this->*((FunctionTable::MEMBERPFNGLVERTEXARRAYATTRIBFORMATPROC)this->m_profiledFunctions[2731]))(vaobj,attribindex,size,type,normalized,relativeoffset);this->profiler.end(2731,profilingStart);}
+void m_glEndTransformFeedback_profiling()const{auto const profilingStart=this->profiler.begin(2732);(this->*((FunctionTable::MEMBERPFNGLENDTRANSFORMFEEDBACKPROC)this->m_profiledFunctions[2732]))();this->profiler.end(2732,profilingStart);}
+void m_glDrawCommandsStatesAddressNV_profiling(const GLuint64* indirects,const GLsizei* sizes,const GLuint* states,const GLuint* fbos,GLuint count)const{auto const profilingStart=this->profiler.begin(2733);(this->*((FunctionTable::MEMBERPFNGLDRAWCOMMANDSSTATESADDRESSNVPROC)this->m_profiledFunctions[2733]))(indirects,sizes,states,fbos,count);this->profiler.end(2733,profilingStart);}
+void m_glUniform4ui64NV_profiling(GLint location,GLuint64EXT x,GLuint64EXT y,GLuint64EXT z,GLuint64EXT w)const{auto const profilingStart=this->profiler.begin(2734);(this->*((FunctionTable::MEMBERPFNGLUNIFORM4UI64NVPROC)this->m_profiledFunctions[2734]))(location,x,y,z,w);this->profiler.end(2734,profilingStart);}
+void m_glMaterialiv_profiling(GLenum face,GLenum pname,const GLint* params)const{auto const profilingStart=this->profiler.begin(2735);(this->*((FunctionTable::MEMBERPFNGLMATERIALIVPROC)this->m_profiledFunctions[2735]))(face,pname,params);this->profiler.end(2735,profilingStart);}
+void m_glTexImage2DMultisample_profiling(GLenum target,GLsizei samples,GLenum internalformat,GLsizei width,GLsizei height,GLboolean fixedsamplelocations)const{auto const profilingStart=this->profiler.begin(2736);(this->*((FunctionTable::MEMBERPFNGLTEXIMAGE2DMULTISAMPLEPROC)this->m_profiledFunctions[2736]))(target,samples,internalformat,width,height,fixedsamplelocations);this->profiler.end(2736,profilingStart);}
+void m_glBindTextureEXT_profiling(GLenum target,GLuint texture)const{auto const profilingStart=this->profiler.begin(2737);(this->*((FunctionTable::MEMBERPFNGLBINDTEXTUREEXTPROC)this->m_profiledFunctions[2737]))(target,texture);this->profiler.end(2737,profilingStart);}
+GLboolean m_glIsBuffer_profiling(GLuint buffer)const{auto const profilingStart=this->profiler.begin(2738);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLISBUFFERPROC)this->m_profiledFunctions[2738]))(buffer);this->profiler.end(2738,profilingStart);return profilingResult;}
+void m_glVertexAttribI1iv_profiling(GLuint index,const GLint* v)const{auto const profilingStart=this->profiler.begin(2739);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBI1IVPROC)this->m_profiledFunctions[2739]))(index,v);this->profiler.end(2739,profilingStart);}
+void m_glGetFinalCombinerInputParameterfvNV_profiling(GLenum variable,GLenum pname,GLfloat* params)const{auto const profilingStart=this->profiler.begin(2740);(this->*((FunctionTable::MEMBERPFNGLGETFINALCOMBINERINPUTPARAMETERFVNVPROC)this->m_profiledFunctions[2740]))(variable,pname,params);this->profiler.end(2740,profilingStart);}
+void m_glMultiTexCoord3bvOES_profiling(GLenum texture,const GLbyte* coords)const{auto const profilingStart=this->profiler.begin(2741);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD3BVOESPROC)this->m_profiledFunctions[2741]))(texture,coords);this->profiler.end(2741,profilingStart);}
+void m_glVertexAttribDivisor_profiling(GLuint index,GLuint divisor)const{auto const profilingStart=this->profiler.begin(2742);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBDIVISORPROC)this->m_profiledFunctions[2742]))(index,divisor);this->profiler.end(2742,profilingStart);}
+void m_glCopyBufferSubData_profiling(GLenum readTarget,GLenum writeTarget,GLintptr readOffset,GLintptr writeOffset,GLsizeiptr size)const{auto const profilingStart=this->profiler.begin(2743);(this->*((FunctionTable::MEMBERPFNGLCOPYBUFFERSUBDATAPROC)this->m_profiledFunctions[2743]))(readTarget,writeTarget,readOffset,writeOffset,size);this->profiler.end(2743,profilingStart);}
+GLuint m_glBindTexGenParameterEXT_profiling(GLenum unit,GLenum coord,GLenum value)const{auto const profilingStart=this->profiler.begin(2744);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLBINDTEXGENPARAMETEREXTPROC)this->m_profiledFunctions[2744]))(unit,coord,value);this->profiler.end(2744,profilingStart);return profilingResult;}
+void m_glNormalStream3bATI_profiling(GLenum stream,GLbyte nx,GLbyte ny,GLbyte nz)const{auto const profilingStart=this->profiler.begin(2745);(this->*((FunctionTable::MEMBERPFNGLNORMALSTREAM3BATIPROC)this->m_profiledFunctions[2745]))(stream,nx,ny,nz);this->profiler.end(2745,profilingStart);}
+void m_glTextureImage2DEXT_profiling(GLuint texture,GLenum target,GLint level,GLint internalformat,GLsizei width,GLsizei height,GLint border,GLenum format,GLenum type,const void* pixels)const{auto const profilingStart=this->profiler.begin(2746);(this->*((FunctionTable::MEMBERPFNGLTEXTUREIMAGE2DEXTPROC)this->m_profiledFunctions[2746]))(texture,target,level,internalformat,width,height,border,format,type,pixels);this->profiler.end(2746,profilingStart);}
+void m_glGetColorTableParameteriv_profiling(GLenum target,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(2747);(this->*((FunctionTable::MEMBERPFNGLGETCOLORTABLEPARAMETERIVPROC)this->m_profiledFunctions[2747]))(target,pname,params);this->profiler.end(2747,profilingStart);}
+void m_glActiveTextureARB_profiling(GLenum texture)const{auto const profilingStart=this->profiler.begin(2748);(this->*((FunctionTable::MEMBERPFNGLACTIVETEXTUREARBPROC)this->m_profiledFunctions[2748]))(texture);this->profiler.end(2748,profilingStart);}
+void m_glTexCoord4xOES_profiling(GLfixed s,GLfixed t,GLfixed r,GLfixed q)const{auto const profilingStart=this->profiler.begin(2749);(this->*((FunctionTable::MEMBERPFNGLTEXCOORD4XOESPROC)this->m_profiledFunctions[2749]))(s,t,r,q);this->profiler.end(2749,profilingStart);}
+void m_glSecondaryColor3fvEXT_profiling(const GLfloat* v)const{auto const profilingStart=this->profiler.begin(2750);(this->*((FunctionTable::MEMBERPFNGLSECONDARYCOLOR3FVEXTPROC)this->m_profiledFunctions[2750]))(v);this->profiler.end(2750,profilingStart);}
+void m_glUniformMatrix4x2fv_profiling(GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{auto const profilingStart=this->profiler.begin(2751);(this->*((FunctionTable::MEMBERPFNGLUNIFORMMATRIX4X2FVPROC)this->m_profiledFunctions[2751]))(location,count,transpose,value);this->profiler.end(2751,profilingStart);}
+void m_glStartInstrumentsSGIX_profiling()const{auto const profilingStart=this->profiler.begin(2752);(this->*((FunctionTable::MEMBERPFNGLSTARTINSTRUMENTSSGIXPROC)this->m_profiledFunctions[2752]))();this->profiler.end(2752,profilingStart);}
+void m_glProgramNamedParameter4fvNV_profiling(GLuint id,GLsizei len,const GLubyte* name,const GLfloat* v)const{auto const profilingStart=this->profiler.begin(2753);(this->*((FunctionTable::MEMBERPFNGLPROGRAMNAMEDPARAMETER4FVNVPROC)this->m_profiledFunctions[2753]))(id,len,name,v);this->profiler.end(2753,profilingStart);}
+void m_glEndVideoCaptureNV_profiling(GLuint video_capture_slot)const{auto const profilingStart=this->profiler.begin(2754);(this->*((FunctionTable::MEMBERPFNGLENDVIDEOCAPTURENVPROC)this->m_profiledFunctions[2754]))(video_capture_slot);this->profiler.end(2754,profilingStart);}
+GLuint m_glGenLists_profiling(GLsizei range)const{auto const profilingStart=this->profiler.begin(2755);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLGENLISTSPROC)this->m_profiledFunctions[2755]))(range);this->profiler.end(2755,profilingStart);return profilingResult;}
+void m_glUniform1fARB_profiling(GLint location,GLfloat v0)const{auto const profilingStart=this->profiler.begin(2756);(this->*((FunctionTable::MEMBERPFNGLUNIFORM1FARBPROC)this->m_profiledFunctions[2756]))(location,v0);this->profiler.end(2756,profilingStart);}
+void m_glNamedFramebufferTexture1DEXT_profiling(GLuint framebuffer,GLenum attachment,GLenum textarget,GLuint texture,GLint level)const{auto const profilingStart=this->profiler.begin(2757);(this->*((FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTURE1DEXTPROC)this->m_profiledFunctions[2757]))(framebuffer,attachment,textarget,texture,level);this->profiler.end(2757,profilingStart);}
+void* m_glMapBufferRange_profiling(GLenum target,GLintptr offset,GLsizeiptr length,GLbitfield access)const{auto const profilingStart=this->profiler.begin(2758);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLMAPBUFFERRANGEPROC)this->m_profiledFunctions[2758]))(target,offset,length,access);this->profiler.end(2758,profilingStart);return profilingResult;}
+void m_glMultiDrawElementsIndirectCountARB_profiling(GLenum mode,GLenum type,GLintptr indirect,GLintptr drawcount,GLsizei maxdrawcount,GLsizei stride)const{auto const profilingStart=this->profiler.begin(2759);(this->*((FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSINDIRECTCOUNTARBPROC)this->m_profiledFunctions[2759]))(mode,type,indirect,drawcount,maxdrawcount,stride);this->profiler.end(2759,profilingStart);}
+void m_glProgramUniformMatrix4x2fv_profiling(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{auto const profilingStart=this->profiler.begin(2760);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X2FVPROC)this->m_profiledFunctions[2760]))(program,location,count,transpose,value);this->profiler.end(2760,profilingStart);}
+void m_glGetTextureParameterIivEXT_profiling(GLuint texture,GLenum target,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(2761);(this->*((FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERIIVEXTPROC)this->m_profiledFunctions[2761]))(texture,target,pname,params);this->profiler.end(2761,profilingStart);}
+void m_glMultiTexCoord3hNV_profiling(GLenum target,GLhalfNV s,GLhalfNV t,GLhalfNV r)const{auto const profilingStart=this->profiler.begin(2762);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD3HNVPROC)this->m_profiledFunctions[2762]))(target,s,t,r);this->profiler.end(2762,profilingStart);}
+void m_glNamedProgramLocalParametersI4uivEXT_profiling(GLuint program,GLenum target,GLuint index,GLsizei count,const GLuint* params)const{auto const profilingStart=this->profiler.begin(2763);(this->*((FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERSI4UIVEXTPROC)this->m_profiledFunctions[2763]))(program,target,index,count,params);this->profiler.end(2763,profilingStart);}
+void m_glEndList_profiling()const{auto const profilingStart=this->profiler.begin(2764);(this->*((FunctionTable::MEMBERPFNGLENDLISTPROC)this->m_profiledFunctions[2764]))();this->profiler.end(2764,profilingStart);}
+void m_glTexCoord2fColor4fNormal3fVertex3fSUN_profiling(GLfloat s,GLfloat t,GLfloat r,GLfloat g,GLfloat b,GLfloat a,GLfloat nx,GLfloat ny,GLfloat nz,GLfloat x,GLfloat y,GLfloat z)const{auto const profilingStart=this->profiler.begin(2765);(this->*((FunctionTable::MEMBERPFNGLTEXCOORD2FCOLOR4FNORMAL3FVERTEX3FSUNPROC)this->m_profiledFunctions[2765]))(s,t,r,g,b,a,nx,ny,nz,x,y,z);this->profiler.end(2765,profilingStart);}
+void m_glGenTransformFeedbacksNV_profiling(GLsizei n,GLuint* ids)const{auto const profilingStart=this->profiler.begin(2766);(this->*((FunctionTable::MEMBERPFNGLGENTRANSFORMFEEDBACKSNVPROC)this->m_profiledFunctions[2766]))(n,ids);this->profiler.end(2766,profilingStart);}
+void m_glEdgeFlagv_profiling(const GLboolean* flag)const{auto const profilingStart=this->profiler.begin(2767);(this->*((FunctionTable::MEMBERPFNGLEDGEFLAGVPROC)this->m_profiledFunctions[2767]))(flag);this->profiler.end(2767,profilingStart);}
+void m_glVertexAttribI2iv_profiling(GLuint index,const GLint* v)const{auto const profilingStart=this->profiler.begin(2768);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBI2IVPROC)this->m_profiledFunctions[2768]))(index,v);this->profiler.end(2768,profilingStart);}
+void m_glCopyMultiTexImage2DEXT_profiling(GLenum texunit,GLenum target,GLint level,GLenum internalformat,GLint x,GLint y,GLsizei width,GLsizei height,GLint border)const{auto const profilingStart=this->profiler.begin(2769);(this->*((FunctionTable::MEMBERPFNGLCOPYMULTITEXIMAGE2DEXTPROC)this->m_profiledFunctions[2769]))(texunit,target,level,internalformat,x,y,width,height,border);this->profiler.end(2769,profilingStart);}
+void m_glUniformMatrix3x2dv_profiling(GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{auto const profilingStart=this->profiler.begin(2770);(this->*((FunctionTable::MEMBERPFNGLUNIFORMMATRIX3X2DVPROC)this->m_profiledFunctions[2770]))(location,count,transpose,value);this->profiler.end(2770,profilingStart);}
+void m_glTexImage3DMultisampleCoverageNV_profiling(GLenum target,GLsizei coverageSamples,GLsizei colorSamples,GLint internalFormat,GLsizei width,GLsizei height,GLsizei depth,GLboolean fixedSampleLocations)const{auto const profilingStart=this->profiler.begin(2771);(this->*((FunctionTable::MEMBERPFNGLTEXIMAGE3DMULTISAMPLECOVERAGENVPROC)this->m_profiledFunctions[2771]))(target,coverageSamples,colorSamples,internalFormat,width,height,depth,fixedSampleLocations);this->profiler.end(2771,profilingStart);}
+void m_glGetShaderPrecisionFormat_profiling(GLenum shadertype,GLenum precisiontype,GLint* range,GLint* precision)const{auto const profilingStart=this->profiler.begin(2772);(this->*((FunctionTable::MEMBERPFNGLGETSHADERPRECISIONFORMATPROC)this->m_profiledFunctions[2772]))(shadertype,precisiontype,range,precision);this->profiler.end(2772,profilingStart);}
+void m_glTexSubImage4DSGIS_profiling(GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLint woffset,GLsizei width,GLsizei height,GLsizei depth,GLsizei size4d,GLenum format,GLenum type,const void* pixels)const{auto const profilingStart=this->profiler.begin(2773);(this->*((FunctionTable::MEMBERPFNGLTEXSUBIMAGE4DSGISPROC)this->m_profiledFunctions[2773]))(target,level,xoffset,yoffset,zoffset,woffset,width,height,depth,size4d,format,type,pixels);this->profiler.end(2773,profilingStart);}
+void m_glRasterSamplesEXT_profiling(GLuint samples,GLboolean fixedsamplelocations)const{auto const profilingStart=this->profiler.begin(2774);(this->*((FunctionTable::MEMBERPFNGLRASTERSAMPLESEXTPROC)this->m_profiledFunctions[2774]))(samples,fixedsamplelocations);this->profiler.end(2774,profilingStart);}
+void m_glTextureView_profiling(GLuint texture,GLenum target,GLuint origtexture,GLenum internalformat,GLuint minlevel,GLuint numlevels,GLuint minlayer,GLuint numlayers)const{auto const profilingStart=this->profiler.begin(2775);(this->*((FunctionTable::MEMBERPFNGLTEXTUREVIEWPROC)this->m_profiledFunctions[2775]))(texture,target,origtexture,internalformat,minlevel,numlevels,minlayer,numlayers);this->profiler.end(2775,profilingStart);}
+void m_glEvalMapsNV_profiling(GLenum target,GLenum mode)const{auto const profilingStart=this->profiler.begin(2776);(this->*((FunctionTable::MEMBERPFNGLEVALMAPSNVPROC)this->m_profiledFunctions[2776]))(target,mode);this->profiler.end(2776,profilingStart);}
+GLint m_glGetFragDataLocationEXT_profiling(GLuint program,const GLchar* name)const{auto const profilingStart=this->profiler.begin(2777);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLGETFRAGDATALOCATIONEXTPROC)this->m_profiledFunctions[2777]))(program,name);this->profiler.end(2777,profilingStart);return profilingResult;}
+void m_glGetCompressedMultiTexImageEXT_profiling(GLenum texunit,GLenum target,GLint lod,void* img)const{auto const profilingStart=this->profiler.begin(2778);(this->*((FunctionTable::MEMBERPFNGLGETCOMPRESSEDMULTITEXIMAGEEXTPROC)this->m_profiledFunctions[2778]))(texunit,target,lod,img);this->profiler.end(2778,profilingStart);}
+void m_glIndexMask_profiling(GLuint mask)const{auto const profilingStart=this->profiler.begin(2779);(this->*((FunctionTable::MEMBERPFNGLINDEXMASKPROC)this->m_profiledFunctions[2779]))(mask);this->profiler.end(2779,profilingStart);}
+void m_glPushClientAttrib_profiling(GLbitfield mask)const{auto const profilingStart=this->profiler.begin(2780);(this->*((FunctionTable::MEMBERPFNGLPUSHCLIENTATTRIBPROC)this->m_profiledFunctions[2780]))(mask);this->profiler.end(2780,profilingStart);}
+void m_glShaderSource_profiling(GLuint shader,GLsizei count,const GLchar*const* string,const GLint* length)const{auto const profilingStart=this->profiler.begin(2781);(this->*((FunctionTable::MEMBERPFNGLSHADERSOURCEPROC)this->m_profiledFunctions[2781]))(shader,count,string,length);this->profiler.end(2781,profilingStart);}
+void m_glDispatchComputeGroupSizeARB_profiling(GLuint num_groups_x,GLuint num_groups_y,GLuint num_groups_z,GLuint group_size_x,GLuint group_size_y,GLuint group_size_z)const{auto const profilingStart=this->profiler.begin(2782);(this->*((FunctionTable::MEMBERPFNGLDISPATCHCOMPUTEGROUPSIZEARBPROC)this->m_profiledFunctions[2782]))(num_groups_x,num_groups_y,num_groups_z,group_size_x,group_size_y,group_size_z);this->profiler.end(2782,profilingStart);}
+void m_glGetnPixelMapfv_profiling(GLenum map,GLsizei bufSize,GLfloat* values)const{auto const profilingStart=this->profiler.begin(2783);(this->*((FunctionTable::MEMBERPFNGLGETNPIXELMAPFVPROC)this->m_profiledFunctions[2783]))(map,bufSize,values);this->profiler.end(2783,profilingStart);}
+void m_glTexCoordP2uiv_profiling(GLenum type,const GLuint* coords)const{auto const profilingStart=this->profiler.begin(2784);(this->*((FunctionTable::MEMBERPFNGLTEXCOORDP2UIVPROC)this->m_profiledFunctions[2784]))(type,coords);this->profiler.end(2784,profilingStart);}
+void m_glUniform2f_profiling(GLint location,GLfloat v0,GLfloat v1)const{auto const profilingStart=this->profiler.begin(2785);(this->*((FunctionTable::MEMBERPFNGLUNIFORM2FPROC)this->m_profiledFunctions[2785]))(location,v0,v1);this->profiler.end(2785,profilingStart);}
+void m_glGetNamedBufferParameteri64v_profiling(GLuint buffer,GLenum pname,GLint64* params)const{auto const profilingStart=this->profiler.begin(2786);(this->*((FunctionTable::MEMBERPFNGLGETNAMEDBUFFERPARAMETERI64VPROC)this->m_profiledFunctions[2786]))(buffer,pname,params);this->profiler.end(2786,profilingStart);}
+void m_glCommandListSegmentsNV_profiling(GLuint list,GLuint segments)const{auto const profilingStart=this->profiler.begin(2787);(this->*((FunctionTable::MEMBERPFNGLCOMMANDLISTSEGMENTSNVPROC)this->m_profiledFunctions[2787]))(list,segments);this->profiler.end(2787,profilingStart);}
+void m_glTextureParameterIivEXT_profiling(GLuint texture,GLenum target,GLenum pname,const GLint* params)const{auto const profilingStart=this->profiler.begin(2788);(this->*((FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIIVEXTPROC)this->m_profiledFunctions[2788]))(texture,target,pname,params);this->profiler.end(2788,profilingStart);}
+void m_glMultiTexParameterfvEXT_profiling(GLenum texunit,GLenum target,GLenum pname,const GLfloat* params)const{auto const profilingStart=this->profiler.begin(2789);(this->*((FunctionTable::MEMBERPFNGLMULTITEXPARAMETERFVEXTPROC)this->m_profiledFunctions[2789]))(texunit,target,pname,params);this->profiler.end(2789,profilingStart);}
+void m_glProgramUniform2ui64ARB_profiling(GLuint program,GLint location,GLuint64 x,GLuint64 y)const{auto const profilingStart=this->profiler.begin(2790);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UI64ARBPROC)this->m_profiledFunctions[2790]))(program,location,x,y);this->profiler.end(2790,profilingStart);}
+void m_glVertex4d_profiling(GLdouble x,GLdouble y,GLdouble z,GLdouble w)const{auto const profilingStart=this->profiler.begin(2791);(this->*((FunctionTable::MEMBERPFNGLVERTEX4DPROC)this->m_profiledFunctions[2791]))(x,y,z,w);this->profiler.end(2791,profilingStart);}
+GLuint m_glNewObjectBufferATI_profiling(GLsizei size,const void* pointer,GLenum usage)const{auto const profilingStart=this->profiler.begin(2792);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLNEWOBJECTBUFFERATIPROC)this->m_profiledFunctions[2792]))(size,pointer,usage);this->profiler.end(2792,profilingStart);return profilingResult;}
+void m_glViewportSwizzleNV_profiling(GLuint index,GLenum swizzlex,GLenum swizzley,GLenum swizzlez,GLenum swizzlew)const{auto const profilingStart=this->profiler.begin(2793);(this->*((FunctionTable::MEMBERPFNGLVIEWPORTSWIZZLENVPROC)this->m_profiledFunctions[2793]))(index,swizzlex,swizzley,swizzlez,swizzlew);this->profiler.end(2793,profilingStart);}
+void m_glBufferData_profiling(GLenum target,GLsizeiptr size,const void* data,GLenum usage)const{auto const profilingStart=this->profiler.begin(2794);(this->*((FunctionTable::MEMBERPFNGLBUFFERDATAPROC)this->m_profiledFunctions[2794]))(target,size,data,usage);this->profiler.end(2794,profilingStart);}
+void m_glTextureImage1DEXT_profiling(GLuint texture,GLenum target,GLint level,GLint internalformat,GLsizei width,GLint border,GLenum format,GLenum type,const void* pixels)const{auto const profilingStart=this->profiler.begin(2795);(this->*((FunctionTable::MEMBERPFNGLTEXTUREIMAGE1DEXTPROC)this->m_profiledFunctions[2795]))(texture,target,level,internalformat,width,border,format,type,pixels);this->profiler.end(2795,profilingStart);}
+void m_glGetTexParameterIiv_profiling(GLenum target,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(2796);(this->*((FunctionTable::MEMBERPFNGLGETTEXPARAMETERIIVPROC)this->m_profiledFunctions[2796]))(target,pname,params);this->profiler.end(2796,profilingStart);}
+void m_glCopyTexSubImage1DEXT_profiling(GLenum target,GLint level,GLint xoffset,GLint x,GLint y,GLsizei width)const{auto const profilingStart=this->profiler.begin(2797);(this->*((FunctionTable::MEMBERPFNGLCOPYTEXSUBIMAGE1DEXTPROC)this->m_profiledFunctions[2797]))(target,level,xoffset,x,y,width);this->profiler.end(2797,profilingStart);}
+void m_glVertex4f_profiling(GLfloat x,GLfloat y,GLfloat z,GLfloat w)const{auto const profilingStart=this->profiler.begin(2798);(this->*((FunctionTable::MEMBERPFNGLVERTEX4FPROC)this->m_profiledFunctions[2798]))(x,y,z,w);this->profiler.end(2798,profilingStart);}
+void m_glUniformMatrix3fvARB_profiling(GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{auto const profilingStart=this->profiler.begin(2799);(this->*((FunctionTable::MEMBERPFNGLUNIFORMMATRIX3FVARBPROC)this->m_profiledFunctions[2799]))(location,count,transpose,value);this->profiler.end(2799,profilingStart);}
+void m_glTexCoordP1ui_profiling(GLenum type,GLuint coords)const{auto const profilingStart=this->profiler.begin(2800);(this->*((FunctionTable::MEMBERPFNGLTEXCOORDP1UIPROC)this->m_profiledFunctions[2800]))(type,coords);this->profiler.end(2800,profilingStart);}
+void m_glPointParameterfvEXT_profiling(GLenum pname,const GLfloat* params)const{auto const profilingStart=this->profiler.begin(2801);(this->*((FunctionTable::MEMBERPFNGLPOINTPARAMETERFVEXTPROC)this->m_profiledFunctions[2801]))(pname,params);this->profiler.end(2801,profilingStart);}
+void m_glUniform4fARB_profiling(GLint location,GLfloat v0,GLfloat v1,GLfloat v2,GLfloat v3)const{auto const profilingStart=this->profiler.begin(2802);(this->*((FunctionTable::MEMBERPFNGLUNIFORM4FARBPROC)this->m_profiledFunctions[2802]))(location,v0,v1,v2,v3);this->profiler.end(2802,profilingStart);}
+void m_glCopyTextureSubImage3D_profiling(GLuint texture,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLint x,GLint y,GLsizei width,GLsizei height)const{auto const profilingStart=this->profiler.begin(2803);(this->*((FunctionTable::MEMBERPFNGLCOPYTEXTURESUBIMAGE3DPROC)this->m_profiledFunctions[2803]))(texture,level,xoffset,yoffset,zoffset,x,y,width,height);this->profiler.end(2803,profilingStart);}
+void m_glMultiTexCoord2fv_profiling(GLenum target,const GLfloat* v)const{auto const profilingStart=this->profiler.begin(2804);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD2FVPROC)this->m_profiledFunctions[2804]))(target,v);this->profiler.end(2804,profilingStart);}
+void m_glMultiTexEnvfvEXT_profiling(GLenum texunit,GLenum target,GLenum pname,const GLfloat* params)const{auto const profilingStart=this->profiler.begin(2805);(this->*((FunctionTable::MEMBERPFNGLMULTITEXENVFVEXTPROC)this->m_profiledFunctions[2805]))(texunit,target,pname,params);this->profiler.end(2805,profilingStart);}
+void m_glNormalP3ui_profiling(GLenum type,GLuint coords)const{auto const profilingStart=this->profiler.begin(2806);(this->*((FunctionTable::MEMBERPFNGLNORMALP3UIPROC)this->m_profiledFunctions[2806]))(type,coords);this->profiler.end(2806,profilingStart);}
+void m_glDrawRangeElementArrayATI_profiling(GLenum mode,GLuint start,GLuint end,GLsizei count)const{auto const profilingStart=this->profiler.begin(2807);(this->*((FunctionTable::MEMBERPFNGLDRAWRANGEELEMENTARRAYATIPROC)this->m_profiledFunctions[2807]))(mode,start,end,count);this->profiler.end(2807,profilingStart);}
+void m_glVertexAttribI1i_profiling(GLuint index,GLint x)const{auto const profilingStart=this->profiler.begin(2808);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIBI1IPROC)this->m_profiledFunctions[2808]))(index,x);this->profiler.end(2808,profilingStart);}
+void m_glDrawArraysInstancedARB_profiling(GLenum mode,GLint first,GLsizei count,GLsizei primcount)const{auto const profilingStart=this->profiler.begin(2809);(this->*((FunctionTable::MEMBERPFNGLDRAWARRAYSINSTANCEDARBPROC)this->m_profiledFunctions[2809]))(mode,first,count,primcount);this->profiler.end(2809,profilingStart);}
+void m_glEnableVertexAttribAPPLE_profiling(GLuint index,GLenum pname)const{auto const profilingStart=this->profiler.begin(2810);(this->*((FunctionTable::MEMBERPFNGLENABLEVERTEXATTRIBAPPLEPROC)this->m_profiledFunctions[2810]))(index,pname);this->profiler.end(2810,profilingStart);}
+GLuint m_glGetDebugMessageLogARB_profiling(GLuint count,GLsizei bufSize,GLenum* sources,GLenum* types,GLuint* ids,GLenum* severities,GLsizei* lengths,GLchar* messageLog)const{auto const profilingStart=this->profiler.begin(2811);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLGETDEBUGMESSAGELOGARBPROC)this->m_profiledFunctions[2811]))(count,bufSize,sources,types,ids,severities,lengths,messageLog);this->profiler.end(2811,profilingStart);return profilingResult;}
+void m_glGetPathTexGenfvNV_profiling(GLenum texCoordSet,GLenum pname,GLfloat* value)const{auto const profilingStart=this->profiler.begin(2812);(this->*((FunctionTable::MEMBERPFNGLGETPATHTEXGENFVNVPROC)this->m_profiledFunctions[2812]))(texCoordSet,pname,value);this->profiler.end(2812,profilingStart);}
+void m_glNamedProgramLocalParameters4fvEXT_profiling(GLuint program,GLenum target,GLuint index,GLsizei count,const GLfloat* params)const{auto const profilingStart=this->profiler.begin(2813);(this->*((FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERS4FVEXTPROC)this->m_profiledFunctions[2813]))(program,target,index,count,params);this->profiler.end(2813,profilingStart);}
+void m_glVertexStream3fvATI_profiling(GLenum stream,const GLfloat* coords)const{auto const profilingStart=this->profiler.begin(2814);(this->*((FunctionTable::MEMBERPFNGLVERTEXSTREAM3FVATIPROC)this->m_profiledFunctions[2814]))(stream,coords);this->profiler.end(2814,profilingStart);}
+void m_glFramebufferTexture3D_profiling(GLenum target,GLenum attachment,GLenum textarget,GLuint texture,GLint level,GLint zoffset)const{auto const profilingStart=this->profiler.begin(2815);(this->*((FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURE3DPROC)this->m_profiledFunctions[2815]))(target,attachment,textarget,texture,level,zoffset);this->profiler.end(2815,profilingStart);}
+void m_glCompressedTextureSubImage2DEXT_profiling(GLuint texture,GLenum target,GLint level,GLint xoffset,GLint yoffset,GLsizei width,GLsizei height,GLenum format,GLsizei imageSize,const void* bits)const{auto const profilingStart=this->profiler.begin(2816);(this->*((FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTURESUBIMAGE2DEXTPROC)this->m_profiledFunctions[2816]))(texture,target,level,xoffset,yoffset,width,height,format,imageSize,bits);this->profiler.end(2816,profilingStart);}
+void m_glWindowPos3dv_profiling(const GLdouble* v)const{auto const profilingStart=this->profiler.begin(2817);(this->*((FunctionTable::MEMBERPFNGLWINDOWPOS3DVPROC)this->m_profiledFunctions[2817]))(v);this->profiler.end(2817,profilingStart);}
+void m_glCopyConvolutionFilter2D_profiling(GLenum target,GLenum internalformat,GLint x,GLint y,GLsizei width,GLsizei height)const{auto const profilingStart=this->profiler.begin(2818);(this->*((FunctionTable::MEMBERPFNGLCOPYCONVOLUTIONFILTER2DPROC)this->m_profiledFunctions[2818]))(target,internalformat,x,y,width,height);this->profiler.end(2818,profilingStart);}
+void m_glReadInstrumentsSGIX_profiling(GLint marker)const{auto const profilingStart=this->profiler.begin(2819);(this->*((FunctionTable::MEMBERPFNGLREADINSTRUMENTSSGIXPROC)this->m_profiledFunctions[2819]))(marker);this->profiler.end(2819,profilingStart);}
+void m_glSamplerParameterfv_profiling(GLuint sampler,GLenum pname,const GLfloat* param)const{auto const profilingStart=this->profiler.begin(2820);(this->*((FunctionTable::MEMBERPFNGLSAMPLERPARAMETERFVPROC)this->m_profiledFunctions[2820]))(sampler,pname,param);this->profiler.end(2820,profilingStart);}
+void m_glBindBufferARB_profiling(GLenum target,GLuint buffer)const{auto const profilingStart=this->profiler.begin(2821);(this->*((FunctionTable::MEMBERPFNGLBINDBUFFERARBPROC)this->m_profiledFunctions[2821]))(target,buffer);this->profiler.end(2821,profilingStart);}
+void m_glVertexAttrib1sNV_profiling(GLuint index,GLshort x)const{auto const profilingStart=this->profiler.begin(2822);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB1SNVPROC)this->m_profiledFunctions[2822]))(index,x);this->profiler.end(2822,profilingStart);}
+void m_glGetMaterialiv_profiling(GLenum face,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(2823);(this->*((FunctionTable::MEMBERPFNGLGETMATERIALIVPROC)this->m_profiledFunctions[2823]))(face,pname,params);this->profiler.end(2823,profilingStart);}
+void m_glUniform1fv_profiling(GLint location,GLsizei count,const GLfloat* value)const{auto const profilingStart=this->profiler.begin(2824);(this->*((FunctionTable::MEMBERPFNGLUNIFORM1FVPROC)this->m_profiledFunctions[2824]))(location,count,value);this->profiler.end(2824,profilingStart);}
+void m_glBeginOcclusionQueryNV_profiling(GLuint id)const{auto const profilingStart=this->profiler.begin(2825);(this->*((FunctionTable::MEMBERPFNGLBEGINOCCLUSIONQUERYNVPROC)this->m_profiledFunctions[2825]))(id);this->profiler.end(2825,profilingStart);}
+void m_glGenFencesAPPLE_profiling(GLsizei n,GLuint* fences)const{auto const profilingStart=this->profiler.begin(2826);(this->*((FunctionTable::MEMBERPFNGLGENFENCESAPPLEPROC)this->m_profiledFunctions[2826]))(n,fences);this->profiler.end(2826,profilingStart);}
+void m_glScissorIndexedv_profiling(GLuint index,const GLint* v)const{auto const profilingStart=this->profiler.begin(2827);(this->*((FunctionTable::MEMBERPFNGLSCISSORINDEXEDVPROC)this->m_profiledFunctions[2827]))(index,v);this->profiler.end(2827,profilingStart);}
+void m_glDisableVariantClientStateEXT_profiling(GLuint id)const{auto const profilingStart=this->profiler.begin(2828);(this->*((FunctionTable::MEMBERPFNGLDISABLEVARIANTCLIENTSTATEEXTPROC)this->m_profiledFunctions[2828]))(id);this->profiler.end(2828,profilingStart);}
+void m_glMinmaxEXT_profiling(GLenum target,GLenum internalformat,GLboolean sink)const{auto const profilingStart=this->profiler.begin(2829);(this->*((FunctionTable::MEMBERPFNGLMINMAXEXTPROC)this->m_profiledFunctions[2829]))(target,internalformat,sink);this->profiler.end(2829,profilingStart);}
+void m_glNormalPointervINTEL_profiling(GLenum type,const void** pointer)const{auto const profilingStart=this->profiler.begin(2830);(this->*((FunctionTable::MEMBERPFNGLNORMALPOINTERVINTELPROC)this->m_profiledFunctions[2830]))(type,pointer);this->profiler.end(2830,profilingStart);}
+void m_glNormal3s_profiling(GLshort nx,GLshort ny,GLshort nz)const{auto const profilingStart=this->profiler.begin(2831);(this->*((FunctionTable::MEMBERPFNGLNORMAL3SPROC)this->m_profiledFunctions[2831]))(nx,ny,nz);this->profiler.end(2831,profilingStart);}
+void m_glGetnPixelMapuiv_profiling(GLenum map,GLsizei bufSize,GLuint* values)const{auto const profilingStart=this->profiler.begin(2832);(this->*((FunctionTable::MEMBERPFNGLGETNPIXELMAPUIVPROC)this->m_profiledFunctions[2832]))(map,bufSize,values);this->profiler.end(2832,profilingStart);}
+void m_glNormalStream3bvATI_profiling(GLenum stream,const GLbyte* coords)const{auto const profilingStart=this->profiler.begin(2833);(this->*((FunctionTable::MEMBERPFNGLNORMALSTREAM3BVATIPROC)this->m_profiledFunctions[2833]))(stream,coords);this->profiler.end(2833,profilingStart);}
+void m_glGetObjectParameterivAPPLE_profiling(GLenum objectType,GLuint name,GLenum pname,GLint* params)const{auto const profilingStart=this->profiler.begin(2834);(this->*((FunctionTable::MEMBERPFNGLGETOBJECTPARAMETERIVAPPLEPROC)this->m_profiledFunctions[2834]))(objectType,name,pname,params);this->profiler.end(2834,profilingStart);}
+void m_glNormal3i_profiling(GLint nx,GLint ny,GLint nz)const{auto const profilingStart=this->profiler.begin(2835);(this->*((FunctionTable::MEMBERPFNGLNORMAL3IPROC)this->m_profiledFunctions[2835]))(nx,ny,nz);this->profiler.end(2835,profilingStart);}
+void m_glUniform1ivARB_profiling(GLint location,GLsizei count,const GLint* value)const{auto const profilingStart=this->profiler.begin(2836);(this->*((FunctionTable::MEMBERPFNGLUNIFORM1IVARBPROC)this->m_profiledFunctions[2836]))(location,count,value);this->profiler.end(2836,profilingStart);}
+void m_glNormal3d_profiling(GLdouble nx,GLdouble ny,GLdouble nz)const{auto const profilingStart=this->profiler.begin(2837);(this->*((FunctionTable::MEMBERPFNGLNORMAL3DPROC)this->m_profiledFunctions[2837]))(nx,ny,nz);this->profiler.end(2837,profilingStart);}
+void m_glUpdateObjectBufferATI_profiling(GLuint buffer,GLuint offset,GLsizei size,const void* pointer,GLenum preserve)const{auto const profilingStart=this->profiler.begin(2838);(this->*((FunctionTable::MEMBERPFNGLUPDATEOBJECTBUFFERATIPROC)this->m_profiledFunctions[2838]))(buffer,offset,size,pointer,preserve);this->profiler.end(2838,profilingStart);}
+void m_glNormal3b_profiling(GLbyte nx,GLbyte ny,GLbyte nz)const{auto const profilingStart=this->profiler.begin(2839);(this->*((FunctionTable::MEMBERPFNGLNORMAL3BPROC)this->m_profiledFunctions[2839]))(nx,ny,nz);this->profiler.end(2839,profilingStart);}
+GLint m_glGetUniformBufferSizeEXT_profiling(GLuint program,GLint location)const{auto const profilingStart=this->profiler.begin(2840);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLGETUNIFORMBUFFERSIZEEXTPROC)this->m_profiledFunctions[2840]))(program,location);this->profiler.end(2840,profilingStart);return profilingResult;}
+void m_glMultiTexCoord4dv_profiling(GLenum target,const GLdouble* v)const{auto const profilingStart=this->profiler.begin(2841);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD4DVPROC)this->m_profiledFunctions[2841]))(target,v);this->profiler.end(2841,profilingStart);}
+void m_glProgramUniform3i64ARB_profiling(GLuint program,GLint location,GLint64 x,GLint64 y,GLint64 z)const{auto const profilingStart=this->profiler.begin(2842);(this->*((FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3I64ARBPROC)this->m_profiledFunctions[2842]))(program,location,x,y,z);this->profiler.end(2842,profilingStart);}
+void m_glVertexAttrib2d_profiling(GLuint index,GLdouble x,GLdouble y)const{auto const profilingStart=this->profiler.begin(2843);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB2DPROC)this->m_profiledFunctions[2843]))(index,x,y);this->profiler.end(2843,profilingStart);}
+void m_glVertexAttrib2f_profiling(GLuint index,GLfloat x,GLfloat y)const{auto const profilingStart=this->profiler.begin(2844);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB2FPROC)this->m_profiledFunctions[2844]))(index,x,y);this->profiler.end(2844,profilingStart);}
+void m_glMultiDrawElementsEXT_profiling(GLenum mode,const GLsizei* count,GLenum type,const void*const* indices,GLsizei primcount)const{auto const profilingStart=this->profiler.begin(2845);(this->*((FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSEXTPROC)this->m_profiledFunctions[2845]))(mode,count,type,indices,primcount);this->profiler.end(2845,profilingStart);}
+void m_glVertexAttrib3dv_profiling(GLuint index,const GLdouble* v)const{auto const profilingStart=this->profiler.begin(2846);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB3DVPROC)this->m_profiledFunctions[2846]))(index,v);this->profiler.end(2846,profilingStart);}
+void m_glMultiTexCoord2bOES_profiling(GLenum texture,GLbyte s,GLbyte t)const{auto const profilingStart=this->profiler.begin(2847);(this->*((FunctionTable::MEMBERPFNGLMULTITEXCOORD2BOESPROC)this->m_profiledFunctions[2847]))(texture,s,t);this->profiler.end(2847,profilingStart);}
+void m_glVertexAttrib2s_profiling(GLuint index,GLshort x,GLshort y)const{auto const profilingStart=this->profiler.begin(2848);(this->*((FunctionTable::MEMBERPFNGLVERTEXATTRIB2SPROC)this->m_profiledFunctions[2848]))(index,x,y);this->profiler.end(2848,profilingStart);}
+void m_glTexImage3DMultisample_profiling(GLenum target,GLsizei samples,GLenum internalformat,GLsizei width,GLsizei height,GLsizei depth,GLboolean fixedsamplelocations)const{auto const profilingStart=this->profiler.begin(2849);(this->*((FunctionTable::MEMBERPFNGLTEXIMAGE3DMULTISAMPLEPROC)this->m_profiledFunctions[2849]))(target,samples,internalformat,width,height,depth,fixedsamplelocations);this->profiler.end(2849,profilingStart);}
+GLuint m_glGetUniformBlockIndex_profiling(GLuint program,const GLchar* uniformBlockName)const{auto const profilingStart=this->profiler.begin(2850);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLGETUNIFORMBLOCKINDEXPROC)this->m_profiledFunctions[2850]))(program,uniformBlockName);this->profiler.end(2850,profilingStart);return profilingResult;}
+void m_glFrontFace_profiling(GLenum mode)const{auto const profilingStart=this->profiler.begin(2851);(this->*((FunctionTable::MEMBERPFNGLFRONTFACEPROC)this->m_profiledFunctions[2851]))(mode);this->profiler.end(2851,profilingStart);}
+void m_glEvalCoord1xOES_profiling(GLfixed u)const{auto const profilingStart=this->profiler.begin(2852);(this->*((FunctionTable::MEMBERPFNGLEVALCOORD1XOESPROC)this->m_profiledFunctions[2852]))(u);this->profiler.end(2852,profilingStart);}
+void m_glDrawArraysInstancedBaseInstance_profiling(GLenum mode,GLint first,GLsizei count,GLsizei instancecount,GLuint baseinstance)const{auto const profilingStart=this->profiler.begin(2853);(this->*((FunctionTable::MEMBERPFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC)this->m_profiledFunctions[2853]))(mode,first,count,instancecount,baseinstance);this->profiler.end(2853,profilingStart);}
+GLboolean m_glIsPointInStrokePathNV_profiling(GLuint path,GLfloat x,GLfloat y)const{auto const profilingStart=this->profiler.begin(2854);auto const profilingResult=(this->*((FunctionTable::MEMBERPFNGLISPOINTINSTROKEPATHNVPROC)this->m_profiledFunctions[2854]))(path,x,y);this->profiler.end(2854,profilingStart);return profilingResult;}
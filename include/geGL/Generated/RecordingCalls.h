@@ -0,0 +1,2858 @@
+FunctionTable::MEMBER_FUNCTION_POINTER const*recordedFunctions = (FunctionTable::MEMBER_FUNCTION_POINTER const*)&this->FunctionTable::m_ptr_glMultiDrawArraysIndirectBindlessCountNV;
+for(size_t i=0;i<GE_GL_NOF_OPENGL_FUNCTIONS;++i)
+  this->m_recordedFunctions[i] = recordedFunctions[i];
+if(this->m_ptr_glMultiDrawArraysIndirectBindlessCountNV)this->m_ptr_glMultiDrawArraysIndirectBindlessCountNV = (FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSINDIRECTBINDLESSCOUNTNVPROC)&RecordingTableDecorator::m_glMultiDrawArraysIndirectBindlessCountNV_recording;
+if(this->m_ptr_glTextureParameterfv)this->m_ptr_glTextureParameterfv = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERFVPROC)&RecordingTableDecorator::m_glTextureParameterfv_recording;
+if(this->m_ptr_glGetListParameterivSGIX)this->m_ptr_glGetListParameterivSGIX = (FunctionTable::MEMBERPFNGLGETLISTPARAMETERIVSGIXPROC)&RecordingTableDecorator::m_glGetListParameterivSGIX_recording;
+if(this->m_ptr_glProgramUniform1i64ARB)this->m_ptr_glProgramUniform1i64ARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1I64ARBPROC)&RecordingTableDecorator::m_glProgramUniform1i64ARB_recording;
+if(this->m_ptr_glVertexArrayElementBuffer)this->m_ptr_glVertexArrayElementBuffer = (FunctionTable::MEMBERPFNGLVERTEXARRAYELEMENTBUFFERPROC)&RecordingTableDecorator::m_glVertexArrayElementBuffer_recording;
+if(this->m_ptr_glHintPGI)this->m_ptr_glHintPGI = (FunctionTable::MEMBERPFNGLHINTPGIPROC)&RecordingTableDecorator::m_glHintPGI_recording;
+if(this->m_ptr_glStencilMaskSeparate)this->m_ptr_glStencilMaskSeparate = (FunctionTable::MEMBERPFNGLSTENCILMASKSEPARATEPROC)&RecordingTableDecorator::m_glStencilMaskSeparate_recording;
+if(this->m_ptr_glGetFramebufferAttachmentParameterivEXT)this->m_ptr_glGetFramebufferAttachmentParameterivEXT = (FunctionTable::MEMBERPFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVEXTPROC)&RecordingTableDecorator::m_glGetFramebufferAttachmentParameterivEXT_recording;
+if(this->m_ptr_glTextureStorage3DMultisample)this->m_ptr_glTextureStorage3DMultisample = (FunctionTable::MEMBERPFNGLTEXTURESTORAGE3DMULTISAMPLEPROC)&RecordingTableDecorator::m_glTextureStorage3DMultisample_recording;
+if(this->m_ptr_glGetIntegerIndexedvEXT)this->m_ptr_glGetIntegerIndexedvEXT = (FunctionTable::MEMBERPFNGLGETINTEGERINDEXEDVEXTPROC)&RecordingTableDecorator::m_glGetIntegerIndexedvEXT_recording;
+if(this->m_ptr_glCopyTexImage1D)this->m_ptr_glCopyTexImage1D = (FunctionTable::MEMBERPFNGLCOPYTEXIMAGE1DPROC)&RecordingTableDecorator::m_glCopyTexImage1D_recording;
+if(this->m_ptr_glVertexAttrib4usv)this->m_ptr_glVertexAttrib4usv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4USVPROC)&RecordingTableDecorator::m_glVertexAttrib4usv_recording;
+if(this->m_ptr_glTexRenderbufferNV)this->m_ptr_glTexRenderbufferNV = (FunctionTable::MEMBERPFNGLTEXRENDERBUFFERNVPROC)&RecordingTableDecorator::m_glTexRenderbufferNV_recording;
+if(this->m_ptr_glVertexAttrib3hvNV)this->m_ptr_glVertexAttrib3hvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3HVNVPROC)&RecordingTableDecorator::m_glVertexAttrib3hvNV_recording;
+if(this->m_ptr_glProgramUniform4ui64ARB)this->m_ptr_glProgramUniform4ui64ARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UI64ARBPROC)&RecordingTableDecorator::m_glProgramUniform4ui64ARB_recording;
+if(this->m_ptr_glInstrumentsBufferSGIX)this->m_ptr_glInstrumentsBufferSGIX = (FunctionTable::MEMBERPFNGLINSTRUMENTSBUFFERSGIXPROC)&RecordingTableDecorator::m_glInstrumentsBufferSGIX_recording;
+if(this->m_ptr_glIndexi)this->m_ptr_glIndexi = (FunctionTable::MEMBERPFNGLINDEXIPROC)&RecordingTableDecorator::m_glIndexi_recording;
+if(this->m_ptr_glMultiTexCoord2sARB)this->m_ptr_glMultiTexCoord2sARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2SARBPROC)&RecordingTableDecorator::m_glMultiTexCoord2sARB_recording;
+if(this->m_ptr_glProgramEnvParameter4fARB)this->m_ptr_glProgramEnvParameter4fARB = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETER4FARBPROC)&RecordingTableDecorator::m_glProgramEnvParameter4fARB_recording;
+if(this->m_ptr_glCompressedTexSubImage3D)this->m_ptr_glCompressedTexSubImage3D = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXSUBIMAGE3DPROC)&RecordingTableDecorator::m_glCompressedTexSubImage3D_recording;
+if(this->m_ptr_glEvalCoord2d)this->m_ptr_glEvalCoord2d = (FunctionTable::MEMBERPFNGLEVALCOORD2DPROC)&RecordingTableDecorator::m_glEvalCoord2d_recording;
+if(this->m_ptr_glEvalCoord2f)this->m_ptr_glEvalCoord2f = (FunctionTable::MEMBERPFNGLEVALCOORD2FPROC)&RecordingTableDecorator::m_glEvalCoord2f_recording;
+if(this->m_ptr_glIndexd)this->m_ptr_glIndexd = (FunctionTable::MEMBERPFNGLINDEXDPROC)&RecordingTableDecorator::m_glIndexd_recording;
+if(this->m_ptr_glSecondaryColor3hvNV)this->m_ptr_glSecondaryColor3hvNV = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3HVNVPROC)&RecordingTableDecorator::m_glSecondaryColor3hvNV_recording;
+if(this->m_ptr_glIndexf)this->m_ptr_glIndexf = (FunctionTable::MEMBERPFNGLINDEXFPROC)&RecordingTableDecorator::m_glIndexf_recording;
+if(this->m_ptr_glFrustumxOES)this->m_ptr_glFrustumxOES = (FunctionTable::MEMBERPFNGLFRUSTUMXOESPROC)&RecordingTableDecorator::m_glFrustumxOES_recording;
+if(this->m_ptr_glTextureStorage3DEXT)this->m_ptr_glTextureStorage3DEXT = (FunctionTable::MEMBERPFNGLTEXTURESTORAGE3DEXTPROC)&RecordingTableDecorator::m_glTextureStorage3DEXT_recording;
+if(this->m_ptr_glDrawCommandsStatesNV)this->m_ptr_glDrawCommandsStatesNV = (FunctionTable::MEMBERPFNGLDRAWCOMMANDSSTATESNVPROC)&RecordingTableDecorator::m_glDrawCommandsStatesNV_recording;
+if(this->m_ptr_glUniform4uiEXT)this->m_ptr_glUniform4uiEXT = (FunctionTable::MEMBERPFNGLUNIFORM4UIEXTPROC)&RecordingTableDecorator::m_glUniform4uiEXT_recording;
+if(this->m_ptr_glProgramUniform3ui64ARB)this->m_ptr_glProgramUniform3ui64ARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UI64ARBPROC)&RecordingTableDecorator::m_glProgramUniform3ui64ARB_recording;
+if(this->m_ptr_glIndexs)this->m_ptr_glIndexs = (FunctionTable::MEMBERPFNGLINDEXSPROC)&RecordingTableDecorator::m_glIndexs_recording;
+if(this->m_ptr_glVertexArrayBindVertexBufferEXT)this->m_ptr_glVertexArrayBindVertexBufferEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYBINDVERTEXBUFFEREXTPROC)&RecordingTableDecorator::m_glVertexArrayBindVertexBufferEXT_recording;
+if(this->m_ptr_glConvolutionParameteriEXT)this->m_ptr_glConvolutionParameteriEXT = (FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERIEXTPROC)&RecordingTableDecorator::m_glConvolutionParameteriEXT_recording;
+if(this->m_ptr_glColor4ubVertex2fSUN)this->m_ptr_glColor4ubVertex2fSUN = (FunctionTable::MEMBERPFNGLCOLOR4UBVERTEX2FSUNPROC)&RecordingTableDecorator::m_glColor4ubVertex2fSUN_recording;
+if(this->m_ptr_glProgramUniform1ivEXT)this->m_ptr_glProgramUniform1ivEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1IVEXTPROC)&RecordingTableDecorator::m_glProgramUniform1ivEXT_recording;
+if(this->m_ptr_glGetnMapfv)this->m_ptr_glGetnMapfv = (FunctionTable::MEMBERPFNGLGETNMAPFVPROC)&RecordingTableDecorator::m_glGetnMapfv_recording;
+if(this->m_ptr_glTransformFeedbackBufferRange)this->m_ptr_glTransformFeedbackBufferRange = (FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC)&RecordingTableDecorator::m_glTransformFeedbackBufferRange_recording;
+if(this->m_ptr_glPathGlyphsNV)this->m_ptr_glPathGlyphsNV = (FunctionTable::MEMBERPFNGLPATHGLYPHSNVPROC)&RecordingTableDecorator::m_glPathGlyphsNV_recording;
+if(this->m_ptr_glSecondaryColor3fv)this->m_ptr_glSecondaryColor3fv = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3FVPROC)&RecordingTableDecorator::m_glSecondaryColor3fv_recording;
+if(this->m_ptr_glGetCombinerInputParameterivNV)this->m_ptr_glGetCombinerInputParameterivNV = (FunctionTable::MEMBERPFNGLGETCOMBINERINPUTPARAMETERIVNVPROC)&RecordingTableDecorator::m_glGetCombinerInputParameterivNV_recording;
+if(this->m_ptr_glEndPerfMonitorAMD)this->m_ptr_glEndPerfMonitorAMD = (FunctionTable::MEMBERPFNGLENDPERFMONITORAMDPROC)&RecordingTableDecorator::m_glEndPerfMonitorAMD_recording;
+if(this->m_ptr_glPointParameterfvARB)this->m_ptr_glPointParameterfvARB = (FunctionTable::MEMBERPFNGLPOINTPARAMETERFVARBPROC)&RecordingTableDecorator::m_glPointParameterfvARB_recording;
+if(this->m_ptr_glVertex2xOES)this->m_ptr_glVertex2xOES = (FunctionTable::MEMBERPFNGLVERTEX2XOESPROC)&RecordingTableDecorator::m_glVertex2xOES_recording;
+if(this->m_ptr_glDrawElementsInstancedBaseInstance)this->m_ptr_glDrawElementsInstancedBaseInstance = (FunctionTable::MEMBERPFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC)&RecordingTableDecorator::m_glDrawElementsInstancedBaseInstance_recording;
+if(this->m_ptr_glMultTransposeMatrixdARB)this->m_ptr_glMultTransposeMatrixdARB = (FunctionTable::MEMBERPFNGLMULTTRANSPOSEMATRIXDARBPROC)&RecordingTableDecorator::m_glMultTransposeMatrixdARB_recording;
+if(this->m_ptr_glVertexAttribL4dEXT)this->m_ptr_glVertexAttribL4dEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL4DEXTPROC)&RecordingTableDecorator::m_glVertexAttribL4dEXT_recording;
+if(this->m_ptr_glVertex4iv)this->m_ptr_glVertex4iv = (FunctionTable::MEMBERPFNGLVERTEX4IVPROC)&RecordingTableDecorator::m_glVertex4iv_recording;
+if(this->m_ptr_glCoverStrokePathInstancedNV)this->m_ptr_glCoverStrokePathInstancedNV = (FunctionTable::MEMBERPFNGLCOVERSTROKEPATHINSTANCEDNVPROC)&RecordingTableDecorator::m_glCoverStrokePathInstancedNV_recording;
+if(this->m_ptr_glDeformSGIX)this->m_ptr_glDeformSGIX = (FunctionTable::MEMBERPFNGLDEFORMSGIXPROC)&RecordingTableDecorator::m_glDeformSGIX_recording;
+if(this->m_ptr_glUniform2ui64NV)this->m_ptr_glUniform2ui64NV = (FunctionTable::MEMBERPFNGLUNIFORM2UI64NVPROC)&RecordingTableDecorator::m_glUniform2ui64NV_recording;
+if(this->m_ptr_glCopyPathNV)this->m_ptr_glCopyPathNV = (FunctionTable::MEMBERPFNGLCOPYPATHNVPROC)&RecordingTableDecorator::m_glCopyPathNV_recording;
+if(this->m_ptr_glVertexAttribP4ui)this->m_ptr_glVertexAttribP4ui = (FunctionTable::MEMBERPFNGLVERTEXATTRIBP4UIPROC)&RecordingTableDecorator::m_glVertexAttribP4ui_recording;
+if(this->m_ptr_glVertexAttribL2d)this->m_ptr_glVertexAttribL2d = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL2DPROC)&RecordingTableDecorator::m_glVertexAttribL2d_recording;
+if(this->m_ptr_glGetMultisamplefv)this->m_ptr_glGetMultisamplefv = (FunctionTable::MEMBERPFNGLGETMULTISAMPLEFVPROC)&RecordingTableDecorator::m_glGetMultisamplefv_recording;
+if(this->m_ptr_glCompressedMultiTexSubImage3DEXT)this->m_ptr_glCompressedMultiTexSubImage3DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDMULTITEXSUBIMAGE3DEXTPROC)&RecordingTableDecorator::m_glCompressedMultiTexSubImage3DEXT_recording;
+if(this->m_ptr_glVDPAURegisterOutputSurfaceNV)this->m_ptr_glVDPAURegisterOutputSurfaceNV = (FunctionTable::MEMBERPFNGLVDPAUREGISTEROUTPUTSURFACENVPROC)&RecordingTableDecorator::m_glVDPAURegisterOutputSurfaceNV_recording;
+if(this->m_ptr_glMinSampleShading)this->m_ptr_glMinSampleShading = (FunctionTable::MEMBERPFNGLMINSAMPLESHADINGPROC)&RecordingTableDecorator::m_glMinSampleShading_recording;
+if(this->m_ptr_glProgramUniform4fEXT)this->m_ptr_glProgramUniform4fEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4FEXTPROC)&RecordingTableDecorator::m_glProgramUniform4fEXT_recording;
+if(this->m_ptr_glCoverStrokePathNV)this->m_ptr_glCoverStrokePathNV = (FunctionTable::MEMBERPFNGLCOVERSTROKEPATHNVPROC)&RecordingTableDecorator::m_glCoverStrokePathNV_recording;
+if(this->m_ptr_glTextureImage2DMultisampleNV)this->m_ptr_glTextureImage2DMultisampleNV = (FunctionTable::MEMBERPFNGLTEXTUREIMAGE2DMULTISAMPLENVPROC)&RecordingTableDecorator::m_glTextureImage2DMultisampleNV_recording;
+if(this->m_ptr_glVertex3bOES)this->m_ptr_glVertex3bOES = (FunctionTable::MEMBERPFNGLVERTEX3BOESPROC)&RecordingTableDecorator::m_glVertex3bOES_recording;
+if(this->m_ptr_glTessellationFactorAMD)this->m_ptr_glTessellationFactorAMD = (FunctionTable::MEMBERPFNGLTESSELLATIONFACTORAMDPROC)&RecordingTableDecorator::m_glTessellationFactorAMD_recording;
+if(this->m_ptr_glDebugMessageControl)this->m_ptr_glDebugMessageControl = (FunctionTable::MEMBERPFNGLDEBUGMESSAGECONTROLPROC)&RecordingTableDecorator::m_glDebugMessageControl_recording;
+if(this->m_ptr_glIsObjectBufferATI)this->m_ptr_glIsObjectBufferATI = (FunctionTable::MEMBERPFNGLISOBJECTBUFFERATIPROC)&RecordingTableDecorator::m_glIsObjectBufferATI_recording;
+if(this->m_ptr_glPopAttrib)this->m_ptr_glPopAttrib = (FunctionTable::MEMBERPFNGLPOPATTRIBPROC)&RecordingTableDecorator::m_glPopAttrib_recording;
+if(this->m_ptr_glProgramUniform4iEXT)this->m_ptr_glProgramUniform4iEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4IEXTPROC)&RecordingTableDecorator::m_glProgramUniform4iEXT_recording;
+if(this->m_ptr_glVertexAttrib4ubNV)this->m_ptr_glVertexAttrib4ubNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4UBNVPROC)&RecordingTableDecorator::m_glVertexAttrib4ubNV_recording;
+if(this->m_ptr_glColorMaterial)this->m_ptr_glColorMaterial = (FunctionTable::MEMBERPFNGLCOLORMATERIALPROC)&RecordingTableDecorator::m_glColorMaterial_recording;
+if(this->m_ptr_glVertexAttrib2svARB)this->m_ptr_glVertexAttrib2svARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2SVARBPROC)&RecordingTableDecorator::m_glVertexAttrib2svARB_recording;
+if(this->m_ptr_glMinSampleShadingARB)this->m_ptr_glMinSampleShadingARB = (FunctionTable::MEMBERPFNGLMINSAMPLESHADINGARBPROC)&RecordingTableDecorator::m_glMinSampleShadingARB_recording;
+if(this->m_ptr_glColor3b)this->m_ptr_glColor3b = (FunctionTable::MEMBERPFNGLCOLOR3BPROC)&RecordingTableDecorator::m_glColor3b_recording;
+if(this->m_ptr_glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN)this->m_ptr_glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUITEXCOORD2FNORMAL3FVERTEX3FSUNPROC)&RecordingTableDecorator::m_glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN_recording;
+if(this->m_ptr_glColor3f)this->m_ptr_glColor3f = (FunctionTable::MEMBERPFNGLCOLOR3FPROC)&RecordingTableDecorator::m_glColor3f_recording;
+if(this->m_ptr_glVDPAUGetSurfaceivNV)this->m_ptr_glVDPAUGetSurfaceivNV = (FunctionTable::MEMBERPFNGLVDPAUGETSURFACEIVNVPROC)&RecordingTableDecorator::m_glVDPAUGetSurfaceivNV_recording;
+if(this->m_ptr_glColor3d)this->m_ptr_glColor3d = (FunctionTable::MEMBERPFNGLCOLOR3DPROC)&RecordingTableDecorator::m_glColor3d_recording;
+if(this->m_ptr_glGetnMapiv)this->m_ptr_glGetnMapiv = (FunctionTable::MEMBERPFNGLGETNMAPIVPROC)&RecordingTableDecorator::m_glGetnMapiv_recording;
+if(this->m_ptr_glColor3i)this->m_ptr_glColor3i = (FunctionTable::MEMBERPFNGLCOLOR3IPROC)&RecordingTableDecorator::m_glColor3i_recording;
+if(this->m_ptr_glGetInternalformatSampleivNV)this->m_ptr_glGetInternalformatSampleivNV = (FunctionTable::MEMBERPFNGLGETINTERNALFORMATSAMPLEIVNVPROC)&RecordingTableDecorator::m_glGetInternalformatSampleivNV_recording;
+if(this->m_ptr_glVertexAttrib4ubv)this->m_ptr_glVertexAttrib4ubv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4UBVPROC)&RecordingTableDecorator::m_glVertexAttrib4ubv_recording;
+if(this->m_ptr_glColor3s)this->m_ptr_glColor3s = (FunctionTable::MEMBERPFNGLCOLOR3SPROC)&RecordingTableDecorator::m_glColor3s_recording;
+if(this->m_ptr_glVertexAttribs4hvNV)this->m_ptr_glVertexAttribs4hvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS4HVNVPROC)&RecordingTableDecorator::m_glVertexAttribs4hvNV_recording;
+if(this->m_ptr_glVertexAttrib4NubvARB)this->m_ptr_glVertexAttrib4NubvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUBVARBPROC)&RecordingTableDecorator::m_glVertexAttrib4NubvARB_recording;
+if(this->m_ptr_glMultiTexCoord3hvNV)this->m_ptr_glMultiTexCoord3hvNV = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3HVNVPROC)&RecordingTableDecorator::m_glMultiTexCoord3hvNV_recording;
+if(this->m_ptr_glMatrixPushEXT)this->m_ptr_glMatrixPushEXT = (FunctionTable::MEMBERPFNGLMATRIXPUSHEXTPROC)&RecordingTableDecorator::m_glMatrixPushEXT_recording;
+if(this->m_ptr_glProgramUniform2fEXT)this->m_ptr_glProgramUniform2fEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2FEXTPROC)&RecordingTableDecorator::m_glProgramUniform2fEXT_recording;
+if(this->m_ptr_glGetVertexArrayIndexediv)this->m_ptr_glGetVertexArrayIndexediv = (FunctionTable::MEMBERPFNGLGETVERTEXARRAYINDEXEDIVPROC)&RecordingTableDecorator::m_glGetVertexArrayIndexediv_recording;
+if(this->m_ptr_glBlitFramebuffer)this->m_ptr_glBlitFramebuffer = (FunctionTable::MEMBERPFNGLBLITFRAMEBUFFERPROC)&RecordingTableDecorator::m_glBlitFramebuffer_recording;
+if(this->m_ptr_glMultiTexCoordP2ui)this->m_ptr_glMultiTexCoordP2ui = (FunctionTable::MEMBERPFNGLMULTITEXCOORDP2UIPROC)&RecordingTableDecorator::m_glMultiTexCoordP2ui_recording;
+if(this->m_ptr_glColorPointerListIBM)this->m_ptr_glColorPointerListIBM = (FunctionTable::MEMBERPFNGLCOLORPOINTERLISTIBMPROC)&RecordingTableDecorator::m_glColorPointerListIBM_recording;
+if(this->m_ptr_glVertexAttribL4d)this->m_ptr_glVertexAttribL4d = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL4DPROC)&RecordingTableDecorator::m_glVertexAttribL4d_recording;
+if(this->m_ptr_glGetFragmentMaterialfvSGIX)this->m_ptr_glGetFragmentMaterialfvSGIX = (FunctionTable::MEMBERPFNGLGETFRAGMENTMATERIALFVSGIXPROC)&RecordingTableDecorator::m_glGetFragmentMaterialfvSGIX_recording;
+if(this->m_ptr_glVertex2iv)this->m_ptr_glVertex2iv = (FunctionTable::MEMBERPFNGLVERTEX2IVPROC)&RecordingTableDecorator::m_glVertex2iv_recording;
+if(this->m_ptr_glGetTexEnvxvOES)this->m_ptr_glGetTexEnvxvOES = (FunctionTable::MEMBERPFNGLGETTEXENVXVOESPROC)&RecordingTableDecorator::m_glGetTexEnvxvOES_recording;
+if(this->m_ptr_glUniformMatrix3dv)this->m_ptr_glUniformMatrix3dv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX3DVPROC)&RecordingTableDecorator::m_glUniformMatrix3dv_recording;
+if(this->m_ptr_glGetVertexAttribLdvEXT)this->m_ptr_glGetVertexAttribLdvEXT = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBLDVEXTPROC)&RecordingTableDecorator::m_glGetVertexAttribLdvEXT_recording;
+if(this->m_ptr_glTexCoordP3uiv)this->m_ptr_glTexCoordP3uiv = (FunctionTable::MEMBERPFNGLTEXCOORDP3UIVPROC)&RecordingTableDecorator::m_glTexCoordP3uiv_recording;
+if(this->m_ptr_glDeformationMap3dSGIX)this->m_ptr_glDeformationMap3dSGIX = (FunctionTable::MEMBERPFNGLDEFORMATIONMAP3DSGIXPROC)&RecordingTableDecorator::m_glDeformationMap3dSGIX_recording;
+if(this->m_ptr_glResumeTransformFeedback)this->m_ptr_glResumeTransformFeedback = (FunctionTable::MEMBERPFNGLRESUMETRANSFORMFEEDBACKPROC)&RecordingTableDecorator::m_glResumeTransformFeedback_recording;
+if(this->m_ptr_glInsertEventMarkerEXT)this->m_ptr_glInsertEventMarkerEXT = (FunctionTable::MEMBERPFNGLINSERTEVENTMARKEREXTPROC)&RecordingTableDecorator::m_glInsertEventMarkerEXT_recording;
+if(this->m_ptr_glTessellationModeAMD)this->m_ptr_glTessellationModeAMD = (FunctionTable::MEMBERPFNGLTESSELLATIONMODEAMDPROC)&RecordingTableDecorator::m_glTessellationModeAMD_recording;
+if(this->m_ptr_glDrawCommandsAddressNV)this->m_ptr_glDrawCommandsAddressNV = (FunctionTable::MEMBERPFNGLDRAWCOMMANDSADDRESSNVPROC)&RecordingTableDecorator::m_glDrawCommandsAddressNV_recording;
+if(this->m_ptr_glFogi)this->m_ptr_glFogi = (FunctionTable::MEMBERPFNGLFOGIPROC)&RecordingTableDecorator::m_glFogi_recording;
+if(this->m_ptr_glGetTexParameterxvOES)this->m_ptr_glGetTexParameterxvOES = (FunctionTable::MEMBERPFNGLGETTEXPARAMETERXVOESPROC)&RecordingTableDecorator::m_glGetTexParameterxvOES_recording;
+if(this->m_ptr_glVertexPointer)this->m_ptr_glVertexPointer = (FunctionTable::MEMBERPFNGLVERTEXPOINTERPROC)&RecordingTableDecorator::m_glVertexPointer_recording;
+if(this->m_ptr_glGetPerfMonitorCounterDataAMD)this->m_ptr_glGetPerfMonitorCounterDataAMD = (FunctionTable::MEMBERPFNGLGETPERFMONITORCOUNTERDATAAMDPROC)&RecordingTableDecorator::m_glGetPerfMonitorCounterDataAMD_recording;
+if(this->m_ptr_glFogf)this->m_ptr_glFogf = (FunctionTable::MEMBERPFNGLFOGFPROC)&RecordingTableDecorator::m_glFogf_recording;
+if(this->m_ptr_glMultiTexCoord1d)this->m_ptr_glMultiTexCoord1d = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1DPROC)&RecordingTableDecorator::m_glMultiTexCoord1d_recording;
+if(this->m_ptr_glMultiTexCoord1f)this->m_ptr_glMultiTexCoord1f = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1FPROC)&RecordingTableDecorator::m_glMultiTexCoord1f_recording;
+if(this->m_ptr_glGetMultiTexParameterivEXT)this->m_ptr_glGetMultiTexParameterivEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXPARAMETERIVEXTPROC)&RecordingTableDecorator::m_glGetMultiTexParameterivEXT_recording;
+if(this->m_ptr_glProgramUniformMatrix3x4fvEXT)this->m_ptr_glProgramUniformMatrix3x4fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X4FVEXTPROC)&RecordingTableDecorator::m_glProgramUniformMatrix3x4fvEXT_recording;
+if(this->m_ptr_glVertexAttribI2i)this->m_ptr_glVertexAttribI2i = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI2IPROC)&RecordingTableDecorator::m_glVertexAttribI2i_recording;
+if(this->m_ptr_glMultiTexCoord1i)this->m_ptr_glMultiTexCoord1i = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1IPROC)&RecordingTableDecorator::m_glMultiTexCoord1i_recording;
+if(this->m_ptr_glUniform1ui64vARB)this->m_ptr_glUniform1ui64vARB = (FunctionTable::MEMBERPFNGLUNIFORM1UI64VARBPROC)&RecordingTableDecorator::m_glUniform1ui64vARB_recording;
+if(this->m_ptr_glLoadProgramNV)this->m_ptr_glLoadProgramNV = (FunctionTable::MEMBERPFNGLLOADPROGRAMNVPROC)&RecordingTableDecorator::m_glLoadProgramNV_recording;
+if(this->m_ptr_glWriteMaskEXT)this->m_ptr_glWriteMaskEXT = (FunctionTable::MEMBERPFNGLWRITEMASKEXTPROC)&RecordingTableDecorator::m_glWriteMaskEXT_recording;
+if(this->m_ptr_glGetGraphicsResetStatus)this->m_ptr_glGetGraphicsResetStatus = (FunctionTable::MEMBERPFNGLGETGRAPHICSRESETSTATUSPROC)&RecordingTableDecorator::m_glGetGraphicsResetStatus_recording;
+if(this->m_ptr_glVertexAttrib1fv)this->m_ptr_glVertexAttrib1fv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1FVPROC)&RecordingTableDecorator::m_glVertexAttrib1fv_recording;
+if(this->m_ptr_glIsEnabled)this->m_ptr_glIsEnabled = (FunctionTable::MEMBERPFNGLISENABLEDPROC)&RecordingTableDecorator::m_glIsEnabled_recording;
+if(this->m_ptr_glImageTransformParameterfvHP)this->m_ptr_glImageTransformParameterfvHP = (FunctionTable::MEMBERPFNGLIMAGETRANSFORMPARAMETERFVHPPROC)&RecordingTableDecorator::m_glImageTransformParameterfvHP_recording;
+if(this->m_ptr_glFramebufferTexture2D)this->m_ptr_glFramebufferTexture2D = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURE2DPROC)&RecordingTableDecorator::m_glFramebufferTexture2D_recording;
+if(this->m_ptr_glGetFragmentLightfvSGIX)this->m_ptr_glGetFragmentLightfvSGIX = (FunctionTable::MEMBERPFNGLGETFRAGMENTLIGHTFVSGIXPROC)&RecordingTableDecorator::m_glGetFragmentLightfvSGIX_recording;
+if(this->m_ptr_glListParameterfSGIX)this->m_ptr_glListParameterfSGIX = (FunctionTable::MEMBERPFNGLLISTPARAMETERFSGIXPROC)&RecordingTableDecorator::m_glListParameterfSGIX_recording;
+if(this->m_ptr_glTexCoord3sv)this->m_ptr_glTexCoord3sv = (FunctionTable::MEMBERPFNGLTEXCOORD3SVPROC)&RecordingTableDecorator::m_glTexCoord3sv_recording;
+if(this->m_ptr_glNamedFramebufferRenderbufferEXT)this->m_ptr_glNamedFramebufferRenderbufferEXT = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERRENDERBUFFEREXTPROC)&RecordingTableDecorator::m_glNamedFramebufferRenderbufferEXT_recording;
+if(this->m_ptr_glFragmentLightModelfSGIX)this->m_ptr_glFragmentLightModelfSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTLIGHTMODELFSGIXPROC)&RecordingTableDecorator::m_glFragmentLightModelfSGIX_recording;
+if(this->m_ptr_glIndexPointerEXT)this->m_ptr_glIndexPointerEXT = (FunctionTable::MEMBERPFNGLINDEXPOINTEREXTPROC)&RecordingTableDecorator::m_glIndexPointerEXT_recording;
+if(this->m_ptr_glBlendEquationSeparateATI)this->m_ptr_glBlendEquationSeparateATI = (FunctionTable::MEMBERPFNGLBLENDEQUATIONSEPARATEATIPROC)&RecordingTableDecorator::m_glBlendEquationSeparateATI_recording;
+if(this->m_ptr_glVertexArrayAttribIFormat)this->m_ptr_glVertexArrayAttribIFormat = (FunctionTable::MEMBERPFNGLVERTEXARRAYATTRIBIFORMATPROC)&RecordingTableDecorator::m_glVertexArrayAttribIFormat_recording;
+if(this->m_ptr_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN)this->m_ptr_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUITEXCOORD2FCOLOR4FNORMAL3FVERTEX3FSUNPROC)&RecordingTableDecorator::m_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN_recording;
+if(this->m_ptr_glReplacementCodeubvSUN)this->m_ptr_glReplacementCodeubvSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUBVSUNPROC)&RecordingTableDecorator::m_glReplacementCodeubvSUN_recording;
+if(this->m_ptr_glGenFramebuffers)this->m_ptr_glGenFramebuffers = (FunctionTable::MEMBERPFNGLGENFRAMEBUFFERSPROC)&RecordingTableDecorator::m_glGenFramebuffers_recording;
+if(this->m_ptr_glPixelMapx)this->m_ptr_glPixelMapx = (FunctionTable::MEMBERPFNGLPIXELMAPXPROC)&RecordingTableDecorator::m_glPixelMapx_recording;
+if(this->m_ptr_glTexSubImage3DEXT)this->m_ptr_glTexSubImage3DEXT = (FunctionTable::MEMBERPFNGLTEXSUBIMAGE3DEXTPROC)&RecordingTableDecorator::m_glTexSubImage3DEXT_recording;
+if(this->m_ptr_glGetAttachedShaders)this->m_ptr_glGetAttachedShaders = (FunctionTable::MEMBERPFNGLGETATTACHEDSHADERSPROC)&RecordingTableDecorator::m_glGetAttachedShaders_recording;
+if(this->m_ptr_glGetPixelTexGenParameterfvSGIS)this->m_ptr_glGetPixelTexGenParameterfvSGIS = (FunctionTable::MEMBERPFNGLGETPIXELTEXGENPARAMETERFVSGISPROC)&RecordingTableDecorator::m_glGetPixelTexGenParameterfvSGIS_recording;
+if(this->m_ptr_glReplacementCodeuiNormal3fVertex3fSUN)this->m_ptr_glReplacementCodeuiNormal3fVertex3fSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUINORMAL3FVERTEX3FSUNPROC)&RecordingTableDecorator::m_glReplacementCodeuiNormal3fVertex3fSUN_recording;
+if(this->m_ptr_glGetDebugMessageLogAMD)this->m_ptr_glGetDebugMessageLogAMD = (FunctionTable::MEMBERPFNGLGETDEBUGMESSAGELOGAMDPROC)&RecordingTableDecorator::m_glGetDebugMessageLogAMD_recording;
+if(this->m_ptr_glVertexStream4sATI)this->m_ptr_glVertexStream4sATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM4SATIPROC)&RecordingTableDecorator::m_glVertexStream4sATI_recording;
+if(this->m_ptr_glVertexAttribs4dvNV)this->m_ptr_glVertexAttribs4dvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS4DVNVPROC)&RecordingTableDecorator::m_glVertexAttribs4dvNV_recording;
+if(this->m_ptr_glGetnMapdvARB)this->m_ptr_glGetnMapdvARB = (FunctionTable::MEMBERPFNGLGETNMAPDVARBPROC)&RecordingTableDecorator::m_glGetnMapdvARB_recording;
+if(this->m_ptr_glOrthofOES)this->m_ptr_glOrthofOES = (FunctionTable::MEMBERPFNGLORTHOFOESPROC)&RecordingTableDecorator::m_glOrthofOES_recording;
+if(this->m_ptr_glViewportArrayv)this->m_ptr_glViewportArrayv = (FunctionTable::MEMBERPFNGLVIEWPORTARRAYVPROC)&RecordingTableDecorator::m_glViewportArrayv_recording;
+if(this->m_ptr_glDrawElementArrayATI)this->m_ptr_glDrawElementArrayATI = (FunctionTable::MEMBERPFNGLDRAWELEMENTARRAYATIPROC)&RecordingTableDecorator::m_glDrawElementArrayATI_recording;
+if(this->m_ptr_glGetPathColorGenfvNV)this->m_ptr_glGetPathColorGenfvNV = (FunctionTable::MEMBERPFNGLGETPATHCOLORGENFVNVPROC)&RecordingTableDecorator::m_glGetPathColorGenfvNV_recording;
+if(this->m_ptr_glWindowPos3iMESA)this->m_ptr_glWindowPos3iMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS3IMESAPROC)&RecordingTableDecorator::m_glWindowPos3iMESA_recording;
+if(this->m_ptr_glMultiTexCoord2s)this->m_ptr_glMultiTexCoord2s = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2SPROC)&RecordingTableDecorator::m_glMultiTexCoord2s_recording;
+if(this->m_ptr_glVertex3dv)this->m_ptr_glVertex3dv = (FunctionTable::MEMBERPFNGLVERTEX3DVPROC)&RecordingTableDecorator::m_glVertex3dv_recording;
+if(this->m_ptr_glVertexAttribI3uivEXT)this->m_ptr_glVertexAttribI3uivEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI3UIVEXTPROC)&RecordingTableDecorator::m_glVertexAttribI3uivEXT_recording;
+if(this->m_ptr_glUniform3ui64ARB)this->m_ptr_glUniform3ui64ARB = (FunctionTable::MEMBERPFNGLUNIFORM3UI64ARBPROC)&RecordingTableDecorator::m_glUniform3ui64ARB_recording;
+if(this->m_ptr_glVertexAttrib2fvNV)this->m_ptr_glVertexAttrib2fvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2FVNVPROC)&RecordingTableDecorator::m_glVertexAttrib2fvNV_recording;
+if(this->m_ptr_glGetNamedBufferSubDataEXT)this->m_ptr_glGetNamedBufferSubDataEXT = (FunctionTable::MEMBERPFNGLGETNAMEDBUFFERSUBDATAEXTPROC)&RecordingTableDecorator::m_glGetNamedBufferSubDataEXT_recording;
+if(this->m_ptr_glConvolutionFilter2D)this->m_ptr_glConvolutionFilter2D = (FunctionTable::MEMBERPFNGLCONVOLUTIONFILTER2DPROC)&RecordingTableDecorator::m_glConvolutionFilter2D_recording;
+if(this->m_ptr_glMemoryBarrierByRegion)this->m_ptr_glMemoryBarrierByRegion = (FunctionTable::MEMBERPFNGLMEMORYBARRIERBYREGIONPROC)&RecordingTableDecorator::m_glMemoryBarrierByRegion_recording;
+if(this->m_ptr_glVertexArrayBindingDivisor)this->m_ptr_glVertexArrayBindingDivisor = (FunctionTable::MEMBERPFNGLVERTEXARRAYBINDINGDIVISORPROC)&RecordingTableDecorator::m_glVertexArrayBindingDivisor_recording;
+if(this->m_ptr_glMatrixRotatedEXT)this->m_ptr_glMatrixRotatedEXT = (FunctionTable::MEMBERPFNGLMATRIXROTATEDEXTPROC)&RecordingTableDecorator::m_glMatrixRotatedEXT_recording;
+if(this->m_ptr_glTexCoord2sv)this->m_ptr_glTexCoord2sv = (FunctionTable::MEMBERPFNGLTEXCOORD2SVPROC)&RecordingTableDecorator::m_glTexCoord2sv_recording;
+if(this->m_ptr_glIsProgramNV)this->m_ptr_glIsProgramNV = (FunctionTable::MEMBERPFNGLISPROGRAMNVPROC)&RecordingTableDecorator::m_glIsProgramNV_recording;
+if(this->m_ptr_glUniform2dv)this->m_ptr_glUniform2dv = (FunctionTable::MEMBERPFNGLUNIFORM2DVPROC)&RecordingTableDecorator::m_glUniform2dv_recording;
+if(this->m_ptr_glGetPixelMapuiv)this->m_ptr_glGetPixelMapuiv = (FunctionTable::MEMBERPFNGLGETPIXELMAPUIVPROC)&RecordingTableDecorator::m_glGetPixelMapuiv_recording;
+if(this->m_ptr_glDepthBoundsEXT)this->m_ptr_glDepthBoundsEXT = (FunctionTable::MEMBERPFNGLDEPTHBOUNDSEXTPROC)&RecordingTableDecorator::m_glDepthBoundsEXT_recording;
+if(this->m_ptr_glVertexAttrib4hvNV)this->m_ptr_glVertexAttrib4hvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4HVNVPROC)&RecordingTableDecorator::m_glVertexAttrib4hvNV_recording;
+if(this->m_ptr_glMultiTexParameteriEXT)this->m_ptr_glMultiTexParameteriEXT = (FunctionTable::MEMBERPFNGLMULTITEXPARAMETERIEXTPROC)&RecordingTableDecorator::m_glMultiTexParameteriEXT_recording;
+if(this->m_ptr_glGetPointerv)this->m_ptr_glGetPointerv = (FunctionTable::MEMBERPFNGLGETPOINTERVPROC)&RecordingTableDecorator::m_glGetPointerv_recording;
+if(this->m_ptr_glPathCommandsNV)this->m_ptr_glPathCommandsNV = (FunctionTable::MEMBERPFNGLPATHCOMMANDSNVPROC)&RecordingTableDecorator::m_glPathCommandsNV_recording;
+if(this->m_ptr_glGetUniformfv)this->m_ptr_glGetUniformfv = (FunctionTable::MEMBERPFNGLGETUNIFORMFVPROC)&RecordingTableDecorator::m_glGetUniformfv_recording;
+if(this->m_ptr_glGetUniformuiv)this->m_ptr_glGetUniformuiv = (FunctionTable::MEMBERPFNGLGETUNIFORMUIVPROC)&RecordingTableDecorator::m_glGetUniformuiv_recording;
+if(this->m_ptr_glDebugMessageInsertAMD)this->m_ptr_glDebugMessageInsertAMD = (FunctionTable::MEMBERPFNGLDEBUGMESSAGEINSERTAMDPROC)&RecordingTableDecorator::m_glDebugMessageInsertAMD_recording;
+if(this->m_ptr_glFrustum)this->m_ptr_glFrustum = (FunctionTable::MEMBERPFNGLFRUSTUMPROC)&RecordingTableDecorator::m_glFrustum_recording;
+if(this->m_ptr_glVertexAttribL1ui64vNV)this->m_ptr_glVertexAttribL1ui64vNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL1UI64VNVPROC)&RecordingTableDecorator::m_glVertexAttribL1ui64vNV_recording;
+if(this->m_ptr_glClearColorxOES)this->m_ptr_glClearColorxOES = (FunctionTable::MEMBERPFNGLCLEARCOLORXOESPROC)&RecordingTableDecorator::m_glClearColorxOES_recording;
+if(this->m_ptr_glProgramUniformMatrix3fv)this->m_ptr_glProgramUniformMatrix3fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3FVPROC)&RecordingTableDecorator::m_glProgramUniformMatrix3fv_recording;
+if(this->m_ptr_glSampleMaskIndexedNV)this->m_ptr_glSampleMaskIndexedNV = (FunctionTable::MEMBERPFNGLSAMPLEMASKINDEXEDNVPROC)&RecordingTableDecorator::m_glSampleMaskIndexedNV_recording;
+if(this->m_ptr_glCompileShaderIncludeARB)this->m_ptr_glCompileShaderIncludeARB = (FunctionTable::MEMBERPFNGLCOMPILESHADERINCLUDEARBPROC)&RecordingTableDecorator::m_glCompileShaderIncludeARB_recording;
+if(this->m_ptr_glGetArrayObjectfvATI)this->m_ptr_glGetArrayObjectfvATI = (FunctionTable::MEMBERPFNGLGETARRAYOBJECTFVATIPROC)&RecordingTableDecorator::m_glGetArrayObjectfvATI_recording;
+if(this->m_ptr_glVertexStream4svATI)this->m_ptr_glVertexStream4svATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM4SVATIPROC)&RecordingTableDecorator::m_glVertexStream4svATI_recording;
+if(this->m_ptr_glMultiTexCoord4iARB)this->m_ptr_glMultiTexCoord4iARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4IARBPROC)&RecordingTableDecorator::m_glMultiTexCoord4iARB_recording;
+if(this->m_ptr_glVariantfvEXT)this->m_ptr_glVariantfvEXT = (FunctionTable::MEMBERPFNGLVARIANTFVEXTPROC)&RecordingTableDecorator::m_glVariantfvEXT_recording;
+if(this->m_ptr_glMatrixLoadfEXT)this->m_ptr_glMatrixLoadfEXT = (FunctionTable::MEMBERPFNGLMATRIXLOADFEXTPROC)&RecordingTableDecorator::m_glMatrixLoadfEXT_recording;
+if(this->m_ptr_glLoadIdentityDeformationMapSGIX)this->m_ptr_glLoadIdentityDeformationMapSGIX = (FunctionTable::MEMBERPFNGLLOADIDENTITYDEFORMATIONMAPSGIXPROC)&RecordingTableDecorator::m_glLoadIdentityDeformationMapSGIX_recording;
+if(this->m_ptr_glGetRenderbufferParameteriv)this->m_ptr_glGetRenderbufferParameteriv = (FunctionTable::MEMBERPFNGLGETRENDERBUFFERPARAMETERIVPROC)&RecordingTableDecorator::m_glGetRenderbufferParameteriv_recording;
+if(this->m_ptr_glProgramUniform3fEXT)this->m_ptr_glProgramUniform3fEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3FEXTPROC)&RecordingTableDecorator::m_glProgramUniform3fEXT_recording;
+if(this->m_ptr_glNamedRenderbufferStorage)this->m_ptr_glNamedRenderbufferStorage = (FunctionTable::MEMBERPFNGLNAMEDRENDERBUFFERSTORAGEPROC)&RecordingTableDecorator::m_glNamedRenderbufferStorage_recording;
+if(this->m_ptr_glProgramPathFragmentInputGenNV)this->m_ptr_glProgramPathFragmentInputGenNV = (FunctionTable::MEMBERPFNGLPROGRAMPATHFRAGMENTINPUTGENNVPROC)&RecordingTableDecorator::m_glProgramPathFragmentInputGenNV_recording;
+if(this->m_ptr_glFogCoordPointerListIBM)this->m_ptr_glFogCoordPointerListIBM = (FunctionTable::MEMBERPFNGLFOGCOORDPOINTERLISTIBMPROC)&RecordingTableDecorator::m_glFogCoordPointerListIBM_recording;
+if(this->m_ptr_glFenceSync)this->m_ptr_glFenceSync = (FunctionTable::MEMBERPFNGLFENCESYNCPROC)&RecordingTableDecorator::m_glFenceSync_recording;
+if(this->m_ptr_glGetVertexAttribIivEXT)this->m_ptr_glGetVertexAttribIivEXT = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBIIVEXTPROC)&RecordingTableDecorator::m_glGetVertexAttribIivEXT_recording;
+if(this->m_ptr_glFramebufferDrawBuffersEXT)this->m_ptr_glFramebufferDrawBuffersEXT = (FunctionTable::MEMBERPFNGLFRAMEBUFFERDRAWBUFFERSEXTPROC)&RecordingTableDecorator::m_glFramebufferDrawBuffersEXT_recording;
+if(this->m_ptr_glVertexAttribs4fvNV)this->m_ptr_glVertexAttribs4fvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS4FVNVPROC)&RecordingTableDecorator::m_glVertexAttribs4fvNV_recording;
+if(this->m_ptr_glPauseTransformFeedbackNV)this->m_ptr_glPauseTransformFeedbackNV = (FunctionTable::MEMBERPFNGLPAUSETRANSFORMFEEDBACKNVPROC)&RecordingTableDecorator::m_glPauseTransformFeedbackNV_recording;
+if(this->m_ptr_glGetQueryObjecti64vEXT)this->m_ptr_glGetQueryObjecti64vEXT = (FunctionTable::MEMBERPFNGLGETQUERYOBJECTI64VEXTPROC)&RecordingTableDecorator::m_glGetQueryObjecti64vEXT_recording;
+if(this->m_ptr_glVDPAUSurfaceAccessNV)this->m_ptr_glVDPAUSurfaceAccessNV = (FunctionTable::MEMBERPFNGLVDPAUSURFACEACCESSNVPROC)&RecordingTableDecorator::m_glVDPAUSurfaceAccessNV_recording;
+if(this->m_ptr_glValidateProgramPipeline)this->m_ptr_glValidateProgramPipeline = (FunctionTable::MEMBERPFNGLVALIDATEPROGRAMPIPELINEPROC)&RecordingTableDecorator::m_glValidateProgramPipeline_recording;
+if(this->m_ptr_glTexPageCommitmentARB)this->m_ptr_glTexPageCommitmentARB = (FunctionTable::MEMBERPFNGLTEXPAGECOMMITMENTARBPROC)&RecordingTableDecorator::m_glTexPageCommitmentARB_recording;
+if(this->m_ptr_glWindowPos3dvARB)this->m_ptr_glWindowPos3dvARB = (FunctionTable::MEMBERPFNGLWINDOWPOS3DVARBPROC)&RecordingTableDecorator::m_glWindowPos3dvARB_recording;
+if(this->m_ptr_glStencilStrokePathInstancedNV)this->m_ptr_glStencilStrokePathInstancedNV = (FunctionTable::MEMBERPFNGLSTENCILSTROKEPATHINSTANCEDNVPROC)&RecordingTableDecorator::m_glStencilStrokePathInstancedNV_recording;
+if(this->m_ptr_glFogfv)this->m_ptr_glFogfv = (FunctionTable::MEMBERPFNGLFOGFVPROC)&RecordingTableDecorator::m_glFogfv_recording;
+if(this->m_ptr_glGenQueriesARB)this->m_ptr_glGenQueriesARB = (FunctionTable::MEMBERPFNGLGENQUERIESARBPROC)&RecordingTableDecorator::m_glGenQueriesARB_recording;
+if(this->m_ptr_glProgramUniform2i64NV)this->m_ptr_glProgramUniform2i64NV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2I64NVPROC)&RecordingTableDecorator::m_glProgramUniform2i64NV_recording;
+if(this->m_ptr_glVertexP4ui)this->m_ptr_glVertexP4ui = (FunctionTable::MEMBERPFNGLVERTEXP4UIPROC)&RecordingTableDecorator::m_glVertexP4ui_recording;
+if(this->m_ptr_glVertexStream1ivATI)this->m_ptr_glVertexStream1ivATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM1IVATIPROC)&RecordingTableDecorator::m_glVertexStream1ivATI_recording;
+if(this->m_ptr_glProgramEnvParameterI4iNV)this->m_ptr_glProgramEnvParameterI4iNV = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERI4INVPROC)&RecordingTableDecorator::m_glProgramEnvParameterI4iNV_recording;
+if(this->m_ptr_glGenVertexArraysAPPLE)this->m_ptr_glGenVertexArraysAPPLE = (FunctionTable::MEMBERPFNGLGENVERTEXARRAYSAPPLEPROC)&RecordingTableDecorator::m_glGenVertexArraysAPPLE_recording;
+if(this->m_ptr_glDrawTransformFeedbackInstanced)this->m_ptr_glDrawTransformFeedbackInstanced = (FunctionTable::MEMBERPFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC)&RecordingTableDecorator::m_glDrawTransformFeedbackInstanced_recording;
+if(this->m_ptr_glStencilThenCoverStrokePathNV)this->m_ptr_glStencilThenCoverStrokePathNV = (FunctionTable::MEMBERPFNGLSTENCILTHENCOVERSTROKEPATHNVPROC)&RecordingTableDecorator::m_glStencilThenCoverStrokePathNV_recording;
+if(this->m_ptr_glDeleteVertexArraysAPPLE)this->m_ptr_glDeleteVertexArraysAPPLE = (FunctionTable::MEMBERPFNGLDELETEVERTEXARRAYSAPPLEPROC)&RecordingTableDecorator::m_glDeleteVertexArraysAPPLE_recording;
+if(this->m_ptr_glGetNamedBufferParameterui64vNV)this->m_ptr_glGetNamedBufferParameterui64vNV = (FunctionTable::MEMBERPFNGLGETNAMEDBUFFERPARAMETERUI64VNVPROC)&RecordingTableDecorator::m_glGetNamedBufferParameterui64vNV_recording;
+if(this->m_ptr_glQueryMatrixxOES)this->m_ptr_glQueryMatrixxOES = (FunctionTable::MEMBERPFNGLQUERYMATRIXXOESPROC)&RecordingTableDecorator::m_glQueryMatrixxOES_recording;
+if(this->m_ptr_glSecondaryColor3usv)this->m_ptr_glSecondaryColor3usv = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3USVPROC)&RecordingTableDecorator::m_glSecondaryColor3usv_recording;
+if(this->m_ptr_glTranslatexOES)this->m_ptr_glTranslatexOES = (FunctionTable::MEMBERPFNGLTRANSLATEXOESPROC)&RecordingTableDecorator::m_glTranslatexOES_recording;
+if(this->m_ptr_glDrawTransformFeedback)this->m_ptr_glDrawTransformFeedback = (FunctionTable::MEMBERPFNGLDRAWTRANSFORMFEEDBACKPROC)&RecordingTableDecorator::m_glDrawTransformFeedback_recording;
+if(this->m_ptr_glTexCoord2fColor4fNormal3fVertex3fvSUN)this->m_ptr_glTexCoord2fColor4fNormal3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLTEXCOORD2FCOLOR4FNORMAL3FVERTEX3FVSUNPROC)&RecordingTableDecorator::m_glTexCoord2fColor4fNormal3fVertex3fvSUN_recording;
+if(this->m_ptr_glVDPAURegisterVideoSurfaceNV)this->m_ptr_glVDPAURegisterVideoSurfaceNV = (FunctionTable::MEMBERPFNGLVDPAUREGISTERVIDEOSURFACENVPROC)&RecordingTableDecorator::m_glVDPAURegisterVideoSurfaceNV_recording;
+if(this->m_ptr_glGetTexParameterIuiv)this->m_ptr_glGetTexParameterIuiv = (FunctionTable::MEMBERPFNGLGETTEXPARAMETERIUIVPROC)&RecordingTableDecorator::m_glGetTexParameterIuiv_recording;
+if(this->m_ptr_glBindBufferBaseNV)this->m_ptr_glBindBufferBaseNV = (FunctionTable::MEMBERPFNGLBINDBUFFERBASENVPROC)&RecordingTableDecorator::m_glBindBufferBaseNV_recording;
+if(this->m_ptr_glIndexPointer)this->m_ptr_glIndexPointer = (FunctionTable::MEMBERPFNGLINDEXPOINTERPROC)&RecordingTableDecorator::m_glIndexPointer_recording;
+if(this->m_ptr_glVertexAttrib4Nbv)this->m_ptr_glVertexAttrib4Nbv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NBVPROC)&RecordingTableDecorator::m_glVertexAttrib4Nbv_recording;
+if(this->m_ptr_glListParameteriSGIX)this->m_ptr_glListParameteriSGIX = (FunctionTable::MEMBERPFNGLLISTPARAMETERISGIXPROC)&RecordingTableDecorator::m_glListParameteriSGIX_recording;
+if(this->m_ptr_glBlendColorxOES)this->m_ptr_glBlendColorxOES = (FunctionTable::MEMBERPFNGLBLENDCOLORXOESPROC)&RecordingTableDecorator::m_glBlendColorxOES_recording;
+if(this->m_ptr_glUniformui64vNV)this->m_ptr_glUniformui64vNV = (FunctionTable::MEMBERPFNGLUNIFORMUI64VNVPROC)&RecordingTableDecorator::m_glUniformui64vNV_recording;
+if(this->m_ptr_glIsSync)this->m_ptr_glIsSync = (FunctionTable::MEMBERPFNGLISSYNCPROC)&RecordingTableDecorator::m_glIsSync_recording;
+if(this->m_ptr_glGetTextureParameterivEXT)this->m_ptr_glGetTextureParameterivEXT = (FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERIVEXTPROC)&RecordingTableDecorator::m_glGetTextureParameterivEXT_recording;
+if(this->m_ptr_glFogCoordhvNV)this->m_ptr_glFogCoordhvNV = (FunctionTable::MEMBERPFNGLFOGCOORDHVNVPROC)&RecordingTableDecorator::m_glFogCoordhvNV_recording;
+if(this->m_ptr_glFramebufferTextureLayerEXT)this->m_ptr_glFramebufferTextureLayerEXT = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURELAYEREXTPROC)&RecordingTableDecorator::m_glFramebufferTextureLayerEXT_recording;
+if(this->m_ptr_glGetObjectPtrLabel)this->m_ptr_glGetObjectPtrLabel = (FunctionTable::MEMBERPFNGLGETOBJECTPTRLABELPROC)&RecordingTableDecorator::m_glGetObjectPtrLabel_recording;
+if(this->m_ptr_glTextureParameteri)this->m_ptr_glTextureParameteri = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIPROC)&RecordingTableDecorator::m_glTextureParameteri_recording;
+if(this->m_ptr_glMultiTexCoord1fARB)this->m_ptr_glMultiTexCoord1fARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1FARBPROC)&RecordingTableDecorator::m_glMultiTexCoord1fARB_recording;
+if(this->m_ptr_glUniformMatrix2x3dv)this->m_ptr_glUniformMatrix2x3dv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX2X3DVPROC)&RecordingTableDecorator::m_glUniformMatrix2x3dv_recording;
+if(this->m_ptr_glFramebufferDrawBufferEXT)this->m_ptr_glFramebufferDrawBufferEXT = (FunctionTable::MEMBERPFNGLFRAMEBUFFERDRAWBUFFEREXTPROC)&RecordingTableDecorator::m_glFramebufferDrawBufferEXT_recording;
+if(this->m_ptr_glCopyColorSubTable)this->m_ptr_glCopyColorSubTable = (FunctionTable::MEMBERPFNGLCOPYCOLORSUBTABLEPROC)&RecordingTableDecorator::m_glCopyColorSubTable_recording;
+if(this->m_ptr_glVertexAttribL3d)this->m_ptr_glVertexAttribL3d = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL3DPROC)&RecordingTableDecorator::m_glVertexAttribL3d_recording;
+if(this->m_ptr_glFragmentMaterialfvSGIX)this->m_ptr_glFragmentMaterialfvSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTMATERIALFVSGIXPROC)&RecordingTableDecorator::m_glFragmentMaterialfvSGIX_recording;
+if(this->m_ptr_glMatrixLoadTranspose3x3fNV)this->m_ptr_glMatrixLoadTranspose3x3fNV = (FunctionTable::MEMBERPFNGLMATRIXLOADTRANSPOSE3X3FNVPROC)&RecordingTableDecorator::m_glMatrixLoadTranspose3x3fNV_recording;
+if(this->m_ptr_glDeleteNamesAMD)this->m_ptr_glDeleteNamesAMD = (FunctionTable::MEMBERPFNGLDELETENAMESAMDPROC)&RecordingTableDecorator::m_glDeleteNamesAMD_recording;
+if(this->m_ptr_glDrawRangeElementsEXT)this->m_ptr_glDrawRangeElementsEXT = (FunctionTable::MEMBERPFNGLDRAWRANGEELEMENTSEXTPROC)&RecordingTableDecorator::m_glDrawRangeElementsEXT_recording;
+if(this->m_ptr_glOrtho)this->m_ptr_glOrtho = (FunctionTable::MEMBERPFNGLORTHOPROC)&RecordingTableDecorator::m_glOrtho_recording;
+if(this->m_ptr_glProgramUniform1dvEXT)this->m_ptr_glProgramUniform1dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1DVEXTPROC)&RecordingTableDecorator::m_glProgramUniform1dvEXT_recording;
+if(this->m_ptr_glColor4xOES)this->m_ptr_glColor4xOES = (FunctionTable::MEMBERPFNGLCOLOR4XOESPROC)&RecordingTableDecorator::m_glColor4xOES_recording;
+if(this->m_ptr_glTexImage4DSGIS)this->m_ptr_glTexImage4DSGIS = (FunctionTable::MEMBERPFNGLTEXIMAGE4DSGISPROC)&RecordingTableDecorator::m_glTexImage4DSGIS_recording;
+if(this->m_ptr_glProgramUniform1ui)this->m_ptr_glProgramUniform1ui = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UIPROC)&RecordingTableDecorator::m_glProgramUniform1ui_recording;
+if(this->m_ptr_glDeleteBuffersARB)this->m_ptr_glDeleteBuffersARB = (FunctionTable::MEMBERPFNGLDELETEBUFFERSARBPROC)&RecordingTableDecorator::m_glDeleteBuffersARB_recording;
+if(this->m_ptr_glUnmapBufferARB)this->m_ptr_glUnmapBufferARB = (FunctionTable::MEMBERPFNGLUNMAPBUFFERARBPROC)&RecordingTableDecorator::m_glUnmapBufferARB_recording;
+if(this->m_ptr_glCopyTexImage2D)this->m_ptr_glCopyTexImage2D = (FunctionTable::MEMBERPFNGLCOPYTEXIMAGE2DPROC)&RecordingTableDecorator::m_glCopyTexImage2D_recording;
+if(this->m_ptr_glMaterialxOES)this->m_ptr_glMaterialxOES = (FunctionTable::MEMBERPFNGLMATERIALXOESPROC)&RecordingTableDecorator::m_glMaterialxOES_recording;
+if(this->m_ptr_glProgramUniformMatrix2x4fvEXT)this->m_ptr_glProgramUniformMatrix2x4fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X4FVEXTPROC)&RecordingTableDecorator::m_glProgramUniformMatrix2x4fvEXT_recording;
+if(this->m_ptr_glTestObjectAPPLE)this->m_ptr_glTestObjectAPPLE = (FunctionTable::MEMBERPFNGLTESTOBJECTAPPLEPROC)&RecordingTableDecorator::m_glTestObjectAPPLE_recording;
+if(this->m_ptr_glRenderbufferStorageEXT)this->m_ptr_glRenderbufferStorageEXT = (FunctionTable::MEMBERPFNGLRENDERBUFFERSTORAGEEXTPROC)&RecordingTableDecorator::m_glRenderbufferStorageEXT_recording;
+if(this->m_ptr_glVertexAttribL1ui64ARB)this->m_ptr_glVertexAttribL1ui64ARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL1UI64ARBPROC)&RecordingTableDecorator::m_glVertexAttribL1ui64ARB_recording;
+if(this->m_ptr_glEndFragmentShaderATI)this->m_ptr_glEndFragmentShaderATI = (FunctionTable::MEMBERPFNGLENDFRAGMENTSHADERATIPROC)&RecordingTableDecorator::m_glEndFragmentShaderATI_recording;
+if(this->m_ptr_glPathParameterivNV)this->m_ptr_glPathParameterivNV = (FunctionTable::MEMBERPFNGLPATHPARAMETERIVNVPROC)&RecordingTableDecorator::m_glPathParameterivNV_recording;
+if(this->m_ptr_glUniform4uiv)this->m_ptr_glUniform4uiv = (FunctionTable::MEMBERPFNGLUNIFORM4UIVPROC)&RecordingTableDecorator::m_glUniform4uiv_recording;
+if(this->m_ptr_glFrameZoomSGIX)this->m_ptr_glFrameZoomSGIX = (FunctionTable::MEMBERPFNGLFRAMEZOOMSGIXPROC)&RecordingTableDecorator::m_glFrameZoomSGIX_recording;
+if(this->m_ptr_glSecondaryColor3fEXT)this->m_ptr_glSecondaryColor3fEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3FEXTPROC)&RecordingTableDecorator::m_glSecondaryColor3fEXT_recording;
+if(this->m_ptr_glVertexAttribL1dv)this->m_ptr_glVertexAttribL1dv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL1DVPROC)&RecordingTableDecorator::m_glVertexAttribL1dv_recording;
+if(this->m_ptr_glNormalStream3svATI)this->m_ptr_glNormalStream3svATI = (FunctionTable::MEMBERPFNGLNORMALSTREAM3SVATIPROC)&RecordingTableDecorator::m_glNormalStream3svATI_recording;
+if(this->m_ptr_glPathStencilFuncNV)this->m_ptr_glPathStencilFuncNV = (FunctionTable::MEMBERPFNGLPATHSTENCILFUNCNVPROC)&RecordingTableDecorator::m_glPathStencilFuncNV_recording;
+if(this->m_ptr_glSetInvariantEXT)this->m_ptr_glSetInvariantEXT = (FunctionTable::MEMBERPFNGLSETINVARIANTEXTPROC)&RecordingTableDecorator::m_glSetInvariantEXT_recording;
+if(this->m_ptr_glGetTexBumpParameterivATI)this->m_ptr_glGetTexBumpParameterivATI = (FunctionTable::MEMBERPFNGLGETTEXBUMPPARAMETERIVATIPROC)&RecordingTableDecorator::m_glGetTexBumpParameterivATI_recording;
+if(this->m_ptr_glBlendEquationSeparateEXT)this->m_ptr_glBlendEquationSeparateEXT = (FunctionTable::MEMBERPFNGLBLENDEQUATIONSEPARATEEXTPROC)&RecordingTableDecorator::m_glBlendEquationSeparateEXT_recording;
+if(this->m_ptr_glEndOcclusionQueryNV)this->m_ptr_glEndOcclusionQueryNV = (FunctionTable::MEMBERPFNGLENDOCCLUSIONQUERYNVPROC)&RecordingTableDecorator::m_glEndOcclusionQueryNV_recording;
+if(this->m_ptr_glScissorArrayv)this->m_ptr_glScissorArrayv = (FunctionTable::MEMBERPFNGLSCISSORARRAYVPROC)&RecordingTableDecorator::m_glScissorArrayv_recording;
+if(this->m_ptr_glCallList)this->m_ptr_glCallList = (FunctionTable::MEMBERPFNGLCALLLISTPROC)&RecordingTableDecorator::m_glCallList_recording;
+if(this->m_ptr_glMapTexture2DINTEL)this->m_ptr_glMapTexture2DINTEL = (FunctionTable::MEMBERPFNGLMAPTEXTURE2DINTELPROC)&RecordingTableDecorator::m_glMapTexture2DINTEL_recording;
+if(this->m_ptr_glPixelTransferxOES)this->m_ptr_glPixelTransferxOES = (FunctionTable::MEMBERPFNGLPIXELTRANSFERXOESPROC)&RecordingTableDecorator::m_glPixelTransferxOES_recording;
+if(this->m_ptr_glDeleteRenderbuffersEXT)this->m_ptr_glDeleteRenderbuffersEXT = (FunctionTable::MEMBERPFNGLDELETERENDERBUFFERSEXTPROC)&RecordingTableDecorator::m_glDeleteRenderbuffersEXT_recording;
+if(this->m_ptr_glTexCoord4fColor4fNormal3fVertex4fSUN)this->m_ptr_glTexCoord4fColor4fNormal3fVertex4fSUN = (FunctionTable::MEMBERPFNGLTEXCOORD4FCOLOR4FNORMAL3FVERTEX4FSUNPROC)&RecordingTableDecorator::m_glTexCoord4fColor4fNormal3fVertex4fSUN_recording;
+if(this->m_ptr_glProgramUniformMatrix4dvEXT)this->m_ptr_glProgramUniformMatrix4dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4DVEXTPROC)&RecordingTableDecorator::m_glProgramUniformMatrix4dvEXT_recording;
+if(this->m_ptr_glGetnColorTable)this->m_ptr_glGetnColorTable = (FunctionTable::MEMBERPFNGLGETNCOLORTABLEPROC)&RecordingTableDecorator::m_glGetnColorTable_recording;
+if(this->m_ptr_glFramebufferTextureLayerARB)this->m_ptr_glFramebufferTextureLayerARB = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURELAYERARBPROC)&RecordingTableDecorator::m_glFramebufferTextureLayerARB_recording;
+if(this->m_ptr_glVertexAttribL2dvEXT)this->m_ptr_glVertexAttribL2dvEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL2DVEXTPROC)&RecordingTableDecorator::m_glVertexAttribL2dvEXT_recording;
+if(this->m_ptr_glGetCombinerStageParameterfvNV)this->m_ptr_glGetCombinerStageParameterfvNV = (FunctionTable::MEMBERPFNGLGETCOMBINERSTAGEPARAMETERFVNVPROC)&RecordingTableDecorator::m_glGetCombinerStageParameterfvNV_recording;
+if(this->m_ptr_glMultiTexCoord1xvOES)this->m_ptr_glMultiTexCoord1xvOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1XVOESPROC)&RecordingTableDecorator::m_glMultiTexCoord1xvOES_recording;
+if(this->m_ptr_glMapBuffer)this->m_ptr_glMapBuffer = (FunctionTable::MEMBERPFNGLMAPBUFFERPROC)&RecordingTableDecorator::m_glMapBuffer_recording;
+if(this->m_ptr_glSecondaryColor3d)this->m_ptr_glSecondaryColor3d = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3DPROC)&RecordingTableDecorator::m_glSecondaryColor3d_recording;
+if(this->m_ptr_glSecondaryColor3f)this->m_ptr_glSecondaryColor3f = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3FPROC)&RecordingTableDecorator::m_glSecondaryColor3f_recording;
+if(this->m_ptr_glVertexAttribLFormat)this->m_ptr_glVertexAttribLFormat = (FunctionTable::MEMBERPFNGLVERTEXATTRIBLFORMATPROC)&RecordingTableDecorator::m_glVertexAttribLFormat_recording;
+if(this->m_ptr_glElementPointerAPPLE)this->m_ptr_glElementPointerAPPLE = (FunctionTable::MEMBERPFNGLELEMENTPOINTERAPPLEPROC)&RecordingTableDecorator::m_glElementPointerAPPLE_recording;
+if(this->m_ptr_glVertexStream1fATI)this->m_ptr_glVertexStream1fATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM1FATIPROC)&RecordingTableDecorator::m_glVertexStream1fATI_recording;
+if(this->m_ptr_glCoverageModulationNV)this->m_ptr_glCoverageModulationNV = (FunctionTable::MEMBERPFNGLCOVERAGEMODULATIONNVPROC)&RecordingTableDecorator::m_glCoverageModulationNV_recording;
+if(this->m_ptr_glSecondaryColor3i)this->m_ptr_glSecondaryColor3i = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3IPROC)&RecordingTableDecorator::m_glSecondaryColor3i_recording;
+if(this->m_ptr_glDeleteSync)this->m_ptr_glDeleteSync = (FunctionTable::MEMBERPFNGLDELETESYNCPROC)&RecordingTableDecorator::m_glDeleteSync_recording;
+if(this->m_ptr_glGetProgramParameterfvNV)this->m_ptr_glGetProgramParameterfvNV = (FunctionTable::MEMBERPFNGLGETPROGRAMPARAMETERFVNVPROC)&RecordingTableDecorator::m_glGetProgramParameterfvNV_recording;
+if(this->m_ptr_glMaxShaderCompilerThreadsARB)this->m_ptr_glMaxShaderCompilerThreadsARB = (FunctionTable::MEMBERPFNGLMAXSHADERCOMPILERTHREADSARBPROC)&RecordingTableDecorator::m_glMaxShaderCompilerThreadsARB_recording;
+if(this->m_ptr_glUniformMatrix4x2dv)this->m_ptr_glUniformMatrix4x2dv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX4X2DVPROC)&RecordingTableDecorator::m_glUniformMatrix4x2dv_recording;
+if(this->m_ptr_glVertexArrayVertexAttribLOffsetEXT)this->m_ptr_glVertexArrayVertexAttribLOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBLOFFSETEXTPROC)&RecordingTableDecorator::m_glVertexArrayVertexAttribLOffsetEXT_recording;
+if(this->m_ptr_glSecondaryColor3s)this->m_ptr_glSecondaryColor3s = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3SPROC)&RecordingTableDecorator::m_glSecondaryColor3s_recording;
+if(this->m_ptr_glIsImageHandleResidentNV)this->m_ptr_glIsImageHandleResidentNV = (FunctionTable::MEMBERPFNGLISIMAGEHANDLERESIDENTNVPROC)&RecordingTableDecorator::m_glIsImageHandleResidentNV_recording;
+if(this->m_ptr_glUniform3iv)this->m_ptr_glUniform3iv = (FunctionTable::MEMBERPFNGLUNIFORM3IVPROC)&RecordingTableDecorator::m_glUniform3iv_recording;
+if(this->m_ptr_glVertexAttribL3i64vNV)this->m_ptr_glVertexAttribL3i64vNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL3I64VNVPROC)&RecordingTableDecorator::m_glVertexAttribL3i64vNV_recording;
+if(this->m_ptr_glPolygonMode)this->m_ptr_glPolygonMode = (FunctionTable::MEMBERPFNGLPOLYGONMODEPROC)&RecordingTableDecorator::m_glPolygonMode_recording;
+if(this->m_ptr_glConvolutionFilter1DEXT)this->m_ptr_glConvolutionFilter1DEXT = (FunctionTable::MEMBERPFNGLCONVOLUTIONFILTER1DEXTPROC)&RecordingTableDecorator::m_glConvolutionFilter1DEXT_recording;
+if(this->m_ptr_glVertexAttrib1dvARB)this->m_ptr_glVertexAttrib1dvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1DVARBPROC)&RecordingTableDecorator::m_glVertexAttrib1dvARB_recording;
+if(this->m_ptr_glTextureSubImage2DEXT)this->m_ptr_glTextureSubImage2DEXT = (FunctionTable::MEMBERPFNGLTEXTURESUBIMAGE2DEXTPROC)&RecordingTableDecorator::m_glTextureSubImage2DEXT_recording;
+if(this->m_ptr_glIsVertexArrayAPPLE)this->m_ptr_glIsVertexArrayAPPLE = (FunctionTable::MEMBERPFNGLISVERTEXARRAYAPPLEPROC)&RecordingTableDecorator::m_glIsVertexArrayAPPLE_recording;
+if(this->m_ptr_glUseProgram)this->m_ptr_glUseProgram = (FunctionTable::MEMBERPFNGLUSEPROGRAMPROC)&RecordingTableDecorator::m_glUseProgram_recording;
+if(this->m_ptr_glLineStipple)this->m_ptr_glLineStipple = (FunctionTable::MEMBERPFNGLLINESTIPPLEPROC)&RecordingTableDecorator::m_glLineStipple_recording;
+if(this->m_ptr_glMultiTexCoord4fvARB)this->m_ptr_glMultiTexCoord4fvARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4FVARBPROC)&RecordingTableDecorator::m_glMultiTexCoord4fvARB_recording;
+if(this->m_ptr_glVideoCaptureNV)this->m_ptr_glVideoCaptureNV = (FunctionTable::MEMBERPFNGLVIDEOCAPTURENVPROC)&RecordingTableDecorator::m_glVideoCaptureNV_recording;
+if(this->m_ptr_glVertexArrayVertexAttribLFormatEXT)this->m_ptr_glVertexArrayVertexAttribLFormatEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBLFORMATEXTPROC)&RecordingTableDecorator::m_glVertexArrayVertexAttribLFormatEXT_recording;
+if(this->m_ptr_glUniform3fvARB)this->m_ptr_glUniform3fvARB = (FunctionTable::MEMBERPFNGLUNIFORM3FVARBPROC)&RecordingTableDecorator::m_glUniform3fvARB_recording;
+if(this->m_ptr_glProgramUniformMatrix3x2fvEXT)this->m_ptr_glProgramUniformMatrix3x2fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X2FVEXTPROC)&RecordingTableDecorator::m_glProgramUniformMatrix3x2fvEXT_recording;
+if(this->m_ptr_glCopyTextureSubImage3DEXT)this->m_ptr_glCopyTextureSubImage3DEXT = (FunctionTable::MEMBERPFNGLCOPYTEXTURESUBIMAGE3DEXTPROC)&RecordingTableDecorator::m_glCopyTextureSubImage3DEXT_recording;
+if(this->m_ptr_glMultiTexCoord2bvOES)this->m_ptr_glMultiTexCoord2bvOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2BVOESPROC)&RecordingTableDecorator::m_glMultiTexCoord2bvOES_recording;
+if(this->m_ptr_glDeleteObjectARB)this->m_ptr_glDeleteObjectARB = (FunctionTable::MEMBERPFNGLDELETEOBJECTARBPROC)&RecordingTableDecorator::m_glDeleteObjectARB_recording;
+if(this->m_ptr_glTextureLightEXT)this->m_ptr_glTextureLightEXT = (FunctionTable::MEMBERPFNGLTEXTURELIGHTEXTPROC)&RecordingTableDecorator::m_glTextureLightEXT_recording;
+if(this->m_ptr_glMultiTexCoord3dARB)this->m_ptr_glMultiTexCoord3dARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3DARBPROC)&RecordingTableDecorator::m_glMultiTexCoord3dARB_recording;
+if(this->m_ptr_glNamedFramebufferTextureEXT)this->m_ptr_glNamedFramebufferTextureEXT = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTUREEXTPROC)&RecordingTableDecorator::m_glNamedFramebufferTextureEXT_recording;
+if(this->m_ptr_glTextureParameteriEXT)this->m_ptr_glTextureParameteriEXT = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIEXTPROC)&RecordingTableDecorator::m_glTextureParameteriEXT_recording;
+if(this->m_ptr_glEvalCoord2xvOES)this->m_ptr_glEvalCoord2xvOES = (FunctionTable::MEMBERPFNGLEVALCOORD2XVOESPROC)&RecordingTableDecorator::m_glEvalCoord2xvOES_recording;
+if(this->m_ptr_glBindVideoCaptureStreamBufferNV)this->m_ptr_glBindVideoCaptureStreamBufferNV = (FunctionTable::MEMBERPFNGLBINDVIDEOCAPTURESTREAMBUFFERNVPROC)&RecordingTableDecorator::m_glBindVideoCaptureStreamBufferNV_recording;
+if(this->m_ptr_glTexImage2DMultisampleCoverageNV)this->m_ptr_glTexImage2DMultisampleCoverageNV = (FunctionTable::MEMBERPFNGLTEXIMAGE2DMULTISAMPLECOVERAGENVPROC)&RecordingTableDecorator::m_glTexImage2DMultisampleCoverageNV_recording;
+if(this->m_ptr_glGetAttribLocationARB)this->m_ptr_glGetAttribLocationARB = (FunctionTable::MEMBERPFNGLGETATTRIBLOCATIONARBPROC)&RecordingTableDecorator::m_glGetAttribLocationARB_recording;
+if(this->m_ptr_glDeleteShader)this->m_ptr_glDeleteShader = (FunctionTable::MEMBERPFNGLDELETESHADERPROC)&RecordingTableDecorator::m_glDeleteShader_recording;
+if(this->m_ptr_glVertexAttrib1fARB)this->m_ptr_glVertexAttrib1fARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1FARBPROC)&RecordingTableDecorator::m_glVertexAttrib1fARB_recording;
+if(this->m_ptr_glTexCoord2fColor4ubVertex3fSUN)this->m_ptr_glTexCoord2fColor4ubVertex3fSUN = (FunctionTable::MEMBERPFNGLTEXCOORD2FCOLOR4UBVERTEX3FSUNPROC)&RecordingTableDecorator::m_glTexCoord2fColor4ubVertex3fSUN_recording;
+if(this->m_ptr_glTexCoord4fVertex4fSUN)this->m_ptr_glTexCoord4fVertex4fSUN = (FunctionTable::MEMBERPFNGLTEXCOORD4FVERTEX4FSUNPROC)&RecordingTableDecorator::m_glTexCoord4fVertex4fSUN_recording;
+if(this->m_ptr_glGetMapdv)this->m_ptr_glGetMapdv = (FunctionTable::MEMBERPFNGLGETMAPDVPROC)&RecordingTableDecorator::m_glGetMapdv_recording;
+if(this->m_ptr_glMapParameterfvNV)this->m_ptr_glMapParameterfvNV = (FunctionTable::MEMBERPFNGLMAPPARAMETERFVNVPROC)&RecordingTableDecorator::m_glMapParameterfvNV_recording;
+if(this->m_ptr_glTextureParameterIuiv)this->m_ptr_glTextureParameterIuiv = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIUIVPROC)&RecordingTableDecorator::m_glTextureParameterIuiv_recording;
+if(this->m_ptr_glTransformFeedbackAttribsNV)this->m_ptr_glTransformFeedbackAttribsNV = (FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKATTRIBSNVPROC)&RecordingTableDecorator::m_glTransformFeedbackAttribsNV_recording;
+if(this->m_ptr_glFragmentLightfvSGIX)this->m_ptr_glFragmentLightfvSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTLIGHTFVSGIXPROC)&RecordingTableDecorator::m_glFragmentLightfvSGIX_recording;
+if(this->m_ptr_glWindowPos3sARB)this->m_ptr_glWindowPos3sARB = (FunctionTable::MEMBERPFNGLWINDOWPOS3SARBPROC)&RecordingTableDecorator::m_glWindowPos3sARB_recording;
+if(this->m_ptr_glGetConvolutionParameterfv)this->m_ptr_glGetConvolutionParameterfv = (FunctionTable::MEMBERPFNGLGETCONVOLUTIONPARAMETERFVPROC)&RecordingTableDecorator::m_glGetConvolutionParameterfv_recording;
+if(this->m_ptr_glCopyTexSubImage3D)this->m_ptr_glCopyTexSubImage3D = (FunctionTable::MEMBERPFNGLCOPYTEXSUBIMAGE3DPROC)&RecordingTableDecorator::m_glCopyTexSubImage3D_recording;
+if(this->m_ptr_glVertexAttribI3i)this->m_ptr_glVertexAttribI3i = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI3IPROC)&RecordingTableDecorator::m_glVertexAttribI3i_recording;
+if(this->m_ptr_glCreateShaderObjectARB)this->m_ptr_glCreateShaderObjectARB = (FunctionTable::MEMBERPFNGLCREATESHADEROBJECTARBPROC)&RecordingTableDecorator::m_glCreateShaderObjectARB_recording;
+if(this->m_ptr_glVertexAttribFormat)this->m_ptr_glVertexAttribFormat = (FunctionTable::MEMBERPFNGLVERTEXATTRIBFORMATPROC)&RecordingTableDecorator::m_glVertexAttribFormat_recording;
+if(this->m_ptr_glGetProgramivARB)this->m_ptr_glGetProgramivARB = (FunctionTable::MEMBERPFNGLGETPROGRAMIVARBPROC)&RecordingTableDecorator::m_glGetProgramivARB_recording;
+if(this->m_ptr_glVertexAttribI4usv)this->m_ptr_glVertexAttribI4usv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4USVPROC)&RecordingTableDecorator::m_glVertexAttribI4usv_recording;
+if(this->m_ptr_glTexParameterf)this->m_ptr_glTexParameterf = (FunctionTable::MEMBERPFNGLTEXPARAMETERFPROC)&RecordingTableDecorator::m_glTexParameterf_recording;
+if(this->m_ptr_glVertexAttribBinding)this->m_ptr_glVertexAttribBinding = (FunctionTable::MEMBERPFNGLVERTEXATTRIBBINDINGPROC)&RecordingTableDecorator::m_glVertexAttribBinding_recording;
+if(this->m_ptr_glGetHistogramParameteriv)this->m_ptr_glGetHistogramParameteriv = (FunctionTable::MEMBERPFNGLGETHISTOGRAMPARAMETERIVPROC)&RecordingTableDecorator::m_glGetHistogramParameteriv_recording;
+if(this->m_ptr_glTexParameteri)this->m_ptr_glTexParameteri = (FunctionTable::MEMBERPFNGLTEXPARAMETERIPROC)&RecordingTableDecorator::m_glTexParameteri_recording;
+if(this->m_ptr_glGetShaderSource)this->m_ptr_glGetShaderSource = (FunctionTable::MEMBERPFNGLGETSHADERSOURCEPROC)&RecordingTableDecorator::m_glGetShaderSource_recording;
+if(this->m_ptr_glVertexAttrib4s)this->m_ptr_glVertexAttrib4s = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4SPROC)&RecordingTableDecorator::m_glVertexAttrib4s_recording;
+if(this->m_ptr_glVertexAttrib4dvNV)this->m_ptr_glVertexAttrib4dvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4DVNVPROC)&RecordingTableDecorator::m_glVertexAttrib4dvNV_recording;
+if(this->m_ptr_glVertexAttrib1dvNV)this->m_ptr_glVertexAttrib1dvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1DVNVPROC)&RecordingTableDecorator::m_glVertexAttrib1dvNV_recording;
+if(this->m_ptr_glPopName)this->m_ptr_glPopName = (FunctionTable::MEMBERPFNGLPOPNAMEPROC)&RecordingTableDecorator::m_glPopName_recording;
+if(this->m_ptr_glTextureBufferEXT)this->m_ptr_glTextureBufferEXT = (FunctionTable::MEMBERPFNGLTEXTUREBUFFEREXTPROC)&RecordingTableDecorator::m_glTextureBufferEXT_recording;
+if(this->m_ptr_glGetMultiTexImageEXT)this->m_ptr_glGetMultiTexImageEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXIMAGEEXTPROC)&RecordingTableDecorator::m_glGetMultiTexImageEXT_recording;
+if(this->m_ptr_glGetPointerIndexedvEXT)this->m_ptr_glGetPointerIndexedvEXT = (FunctionTable::MEMBERPFNGLGETPOINTERINDEXEDVEXTPROC)&RecordingTableDecorator::m_glGetPointerIndexedvEXT_recording;
+if(this->m_ptr_glIsNameAMD)this->m_ptr_glIsNameAMD = (FunctionTable::MEMBERPFNGLISNAMEAMDPROC)&RecordingTableDecorator::m_glIsNameAMD_recording;
+if(this->m_ptr_glColor4ub)this->m_ptr_glColor4ub = (FunctionTable::MEMBERPFNGLCOLOR4UBPROC)&RecordingTableDecorator::m_glColor4ub_recording;
+if(this->m_ptr_glBufferParameteriAPPLE)this->m_ptr_glBufferParameteriAPPLE = (FunctionTable::MEMBERPFNGLBUFFERPARAMETERIAPPLEPROC)&RecordingTableDecorator::m_glBufferParameteriAPPLE_recording;
+if(this->m_ptr_glColor4ui)this->m_ptr_glColor4ui = (FunctionTable::MEMBERPFNGLCOLOR4UIPROC)&RecordingTableDecorator::m_glColor4ui_recording;
+if(this->m_ptr_glGetInternalformativ)this->m_ptr_glGetInternalformativ = (FunctionTable::MEMBERPFNGLGETINTERNALFORMATIVPROC)&RecordingTableDecorator::m_glGetInternalformativ_recording;
+if(this->m_ptr_glColor4us)this->m_ptr_glColor4us = (FunctionTable::MEMBERPFNGLCOLOR4USPROC)&RecordingTableDecorator::m_glColor4us_recording;
+if(this->m_ptr_glVertexAttribP1uiv)this->m_ptr_glVertexAttribP1uiv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBP1UIVPROC)&RecordingTableDecorator::m_glVertexAttribP1uiv_recording;
+if(this->m_ptr_glLinkProgram)this->m_ptr_glLinkProgram = (FunctionTable::MEMBERPFNGLLINKPROGRAMPROC)&RecordingTableDecorator::m_glLinkProgram_recording;
+if(this->m_ptr_glTexCoord3s)this->m_ptr_glTexCoord3s = (FunctionTable::MEMBERPFNGLTEXCOORD3SPROC)&RecordingTableDecorator::m_glTexCoord3s_recording;
+if(this->m_ptr_glTexCoord2dv)this->m_ptr_glTexCoord2dv = (FunctionTable::MEMBERPFNGLTEXCOORD2DVPROC)&RecordingTableDecorator::m_glTexCoord2dv_recording;
+if(this->m_ptr_glGetObjectLabel)this->m_ptr_glGetObjectLabel = (FunctionTable::MEMBERPFNGLGETOBJECTLABELPROC)&RecordingTableDecorator::m_glGetObjectLabel_recording;
+if(this->m_ptr_glVertexPointerEXT)this->m_ptr_glVertexPointerEXT = (FunctionTable::MEMBERPFNGLVERTEXPOINTEREXTPROC)&RecordingTableDecorator::m_glVertexPointerEXT_recording;
+if(this->m_ptr_glDebugMessageCallbackARB)this->m_ptr_glDebugMessageCallbackARB = (FunctionTable::MEMBERPFNGLDEBUGMESSAGECALLBACKARBPROC)&RecordingTableDecorator::m_glDebugMessageCallbackARB_recording;
+if(this->m_ptr_glGetString)this->m_ptr_glGetString = (FunctionTable::MEMBERPFNGLGETSTRINGPROC)&RecordingTableDecorator::m_glGetString_recording;
+if(this->m_ptr_glGetPathParameterfvNV)this->m_ptr_glGetPathParameterfvNV = (FunctionTable::MEMBERPFNGLGETPATHPARAMETERFVNVPROC)&RecordingTableDecorator::m_glGetPathParameterfvNV_recording;
+if(this->m_ptr_glLightxvOES)this->m_ptr_glLightxvOES = (FunctionTable::MEMBERPFNGLLIGHTXVOESPROC)&RecordingTableDecorator::m_glLightxvOES_recording;
+if(this->m_ptr_glEndQuery)this->m_ptr_glEndQuery = (FunctionTable::MEMBERPFNGLENDQUERYPROC)&RecordingTableDecorator::m_glEndQuery_recording;
+if(this->m_ptr_glSecondaryColor3uiv)this->m_ptr_glSecondaryColor3uiv = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UIVPROC)&RecordingTableDecorator::m_glSecondaryColor3uiv_recording;
+if(this->m_ptr_glPrioritizeTexturesxOES)this->m_ptr_glPrioritizeTexturesxOES = (FunctionTable::MEMBERPFNGLPRIORITIZETEXTURESXOESPROC)&RecordingTableDecorator::m_glPrioritizeTexturesxOES_recording;
+if(this->m_ptr_glEdgeFlagPointer)this->m_ptr_glEdgeFlagPointer = (FunctionTable::MEMBERPFNGLEDGEFLAGPOINTERPROC)&RecordingTableDecorator::m_glEdgeFlagPointer_recording;
+if(this->m_ptr_glFramebufferParameteri)this->m_ptr_glFramebufferParameteri = (FunctionTable::MEMBERPFNGLFRAMEBUFFERPARAMETERIPROC)&RecordingTableDecorator::m_glFramebufferParameteri_recording;
+if(this->m_ptr_glTexCoord3hNV)this->m_ptr_glTexCoord3hNV = (FunctionTable::MEMBERPFNGLTEXCOORD3HNVPROC)&RecordingTableDecorator::m_glTexCoord3hNV_recording;
+if(this->m_ptr_glMultiModeDrawElementsIBM)this->m_ptr_glMultiModeDrawElementsIBM = (FunctionTable::MEMBERPFNGLMULTIMODEDRAWELEMENTSIBMPROC)&RecordingTableDecorator::m_glMultiModeDrawElementsIBM_recording;
+if(this->m_ptr_glCopyPixels)this->m_ptr_glCopyPixels = (FunctionTable::MEMBERPFNGLCOPYPIXELSPROC)&RecordingTableDecorator::m_glCopyPixels_recording;
+if(this->m_ptr_glVertexAttribI2ui)this->m_ptr_glVertexAttribI2ui = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI2UIPROC)&RecordingTableDecorator::m_glVertexAttribI2ui_recording;
+if(this->m_ptr_glClampColorARB)this->m_ptr_glClampColorARB = (FunctionTable::MEMBERPFNGLCLAMPCOLORARBPROC)&RecordingTableDecorator::m_glClampColorARB_recording;
+if(this->m_ptr_glColorPointervINTEL)this->m_ptr_glColorPointervINTEL = (FunctionTable::MEMBERPFNGLCOLORPOINTERVINTELPROC)&RecordingTableDecorator::m_glColorPointervINTEL_recording;
+if(this->m_ptr_glDeleteTextures)this->m_ptr_glDeleteTextures = (FunctionTable::MEMBERPFNGLDELETETEXTURESPROC)&RecordingTableDecorator::m_glDeleteTextures_recording;
+if(this->m_ptr_glGetMinmaxParameterfvEXT)this->m_ptr_glGetMinmaxParameterfvEXT = (FunctionTable::MEMBERPFNGLGETMINMAXPARAMETERFVEXTPROC)&RecordingTableDecorator::m_glGetMinmaxParameterfvEXT_recording;
+if(this->m_ptr_glWindowPos3sMESA)this->m_ptr_glWindowPos3sMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS3SMESAPROC)&RecordingTableDecorator::m_glWindowPos3sMESA_recording;
+if(this->m_ptr_glVertexAttrib4f)this->m_ptr_glVertexAttrib4f = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4FPROC)&RecordingTableDecorator::m_glVertexAttrib4f_recording;
+if(this->m_ptr_glNamedFramebufferParameteri)this->m_ptr_glNamedFramebufferParameteri = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERPARAMETERIPROC)&RecordingTableDecorator::m_glNamedFramebufferParameteri_recording;
+if(this->m_ptr_glTexCoord2fVertex3fvSUN)this->m_ptr_glTexCoord2fVertex3fvSUN = (FunctionTable::MEMBERPFNGLTEXCOORD2FVERTEX3FVSUNPROC)&RecordingTableDecorator::m_glTexCoord2fVertex3fvSUN_recording;
+if(this->m_ptr_glReplacementCodeusSUN)this->m_ptr_glReplacementCodeusSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUSSUNPROC)&RecordingTableDecorator::m_glReplacementCodeusSUN_recording;
+if(this->m_ptr_glGetNamedFramebufferParameteriv)this->m_ptr_glGetNamedFramebufferParameteriv = (FunctionTable::MEMBERPFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC)&RecordingTableDecorator::m_glGetNamedFramebufferParameteriv_recording;
+if(this->m_ptr_glVertexStream1fvATI)this->m_ptr_glVertexStream1fvATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM1FVATIPROC)&RecordingTableDecorator::m_glVertexStream1fvATI_recording;
+if(this->m_ptr_glCreateVertexArrays)this->m_ptr_glCreateVertexArrays = (FunctionTable::MEMBERPFNGLCREATEVERTEXARRAYSPROC)&RecordingTableDecorator::m_glCreateVertexArrays_recording;
+if(this->m_ptr_glBeginConditionalRender)this->m_ptr_glBeginConditionalRender = (FunctionTable::MEMBERPFNGLBEGINCONDITIONALRENDERPROC)&RecordingTableDecorator::m_glBeginConditionalRender_recording;
+if(this->m_ptr_glConvolutionFilter1D)this->m_ptr_glConvolutionFilter1D = (FunctionTable::MEMBERPFNGLCONVOLUTIONFILTER1DPROC)&RecordingTableDecorator::m_glConvolutionFilter1D_recording;
+if(this->m_ptr_glMultiTexCoord3fARB)this->m_ptr_glMultiTexCoord3fARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3FARBPROC)&RecordingTableDecorator::m_glMultiTexCoord3fARB_recording;
+if(this->m_ptr_glGetQueryObjectuivARB)this->m_ptr_glGetQueryObjectuivARB = (FunctionTable::MEMBERPFNGLGETQUERYOBJECTUIVARBPROC)&RecordingTableDecorator::m_glGetQueryObjectuivARB_recording;
+if(this->m_ptr_glScalexOES)this->m_ptr_glScalexOES = (FunctionTable::MEMBERPFNGLSCALEXOESPROC)&RecordingTableDecorator::m_glScalexOES_recording;
+if(this->m_ptr_glSamplerParameteri)this->m_ptr_glSamplerParameteri = (FunctionTable::MEMBERPFNGLSAMPLERPARAMETERIPROC)&RecordingTableDecorator::m_glSamplerParameteri_recording;
+if(this->m_ptr_glSamplerParameterf)this->m_ptr_glSamplerParameterf = (FunctionTable::MEMBERPFNGLSAMPLERPARAMETERFPROC)&RecordingTableDecorator::m_glSamplerParameterf_recording;
+if(this->m_ptr_glShaderOp1EXT)this->m_ptr_glShaderOp1EXT = (FunctionTable::MEMBERPFNGLSHADEROP1EXTPROC)&RecordingTableDecorator::m_glShaderOp1EXT_recording;
+if(this->m_ptr_glBeginVideoCaptureNV)this->m_ptr_glBeginVideoCaptureNV = (FunctionTable::MEMBERPFNGLBEGINVIDEOCAPTURENVPROC)&RecordingTableDecorator::m_glBeginVideoCaptureNV_recording;
+if(this->m_ptr_glGetnHistogram)this->m_ptr_glGetnHistogram = (FunctionTable::MEMBERPFNGLGETNHISTOGRAMPROC)&RecordingTableDecorator::m_glGetnHistogram_recording;
+if(this->m_ptr_glUniform1d)this->m_ptr_glUniform1d = (FunctionTable::MEMBERPFNGLUNIFORM1DPROC)&RecordingTableDecorator::m_glUniform1d_recording;
+if(this->m_ptr_glRenderMode)this->m_ptr_glRenderMode = (FunctionTable::MEMBERPFNGLRENDERMODEPROC)&RecordingTableDecorator::m_glRenderMode_recording;
+if(this->m_ptr_glClearColorIiEXT)this->m_ptr_glClearColorIiEXT = (FunctionTable::MEMBERPFNGLCLEARCOLORIIEXTPROC)&RecordingTableDecorator::m_glClearColorIiEXT_recording;
+if(this->m_ptr_glGetCompressedTexImage)this->m_ptr_glGetCompressedTexImage = (FunctionTable::MEMBERPFNGLGETCOMPRESSEDTEXIMAGEPROC)&RecordingTableDecorator::m_glGetCompressedTexImage_recording;
+if(this->m_ptr_glCompressedTextureImage1DEXT)this->m_ptr_glCompressedTextureImage1DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTUREIMAGE1DEXTPROC)&RecordingTableDecorator::m_glCompressedTextureImage1DEXT_recording;
+if(this->m_ptr_glGetActiveUniformBlockiv)this->m_ptr_glGetActiveUniformBlockiv = (FunctionTable::MEMBERPFNGLGETACTIVEUNIFORMBLOCKIVPROC)&RecordingTableDecorator::m_glGetActiveUniformBlockiv_recording;
+if(this->m_ptr_glUniform1i)this->m_ptr_glUniform1i = (FunctionTable::MEMBERPFNGLUNIFORM1IPROC)&RecordingTableDecorator::m_glUniform1i_recording;
+if(this->m_ptr_glGetTexEnvfv)this->m_ptr_glGetTexEnvfv = (FunctionTable::MEMBERPFNGLGETTEXENVFVPROC)&RecordingTableDecorator::m_glGetTexEnvfv_recording;
+if(this->m_ptr_glColorTableParameterivSGI)this->m_ptr_glColorTableParameterivSGI = (FunctionTable::MEMBERPFNGLCOLORTABLEPARAMETERIVSGIPROC)&RecordingTableDecorator::m_glColorTableParameterivSGI_recording;
+if(this->m_ptr_glCullFace)this->m_ptr_glCullFace = (FunctionTable::MEMBERPFNGLCULLFACEPROC)&RecordingTableDecorator::m_glCullFace_recording;
+if(this->m_ptr_glDeleteFencesAPPLE)this->m_ptr_glDeleteFencesAPPLE = (FunctionTable::MEMBERPFNGLDELETEFENCESAPPLEPROC)&RecordingTableDecorator::m_glDeleteFencesAPPLE_recording;
+if(this->m_ptr_glProgramUniform4i)this->m_ptr_glProgramUniform4i = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4IPROC)&RecordingTableDecorator::m_glProgramUniform4i_recording;
+if(this->m_ptr_glUniformHandleui64ARB)this->m_ptr_glUniformHandleui64ARB = (FunctionTable::MEMBERPFNGLUNIFORMHANDLEUI64ARBPROC)&RecordingTableDecorator::m_glUniformHandleui64ARB_recording;
+if(this->m_ptr_glProgramUniform4f)this->m_ptr_glProgramUniform4f = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4FPROC)&RecordingTableDecorator::m_glProgramUniform4f_recording;
+if(this->m_ptr_glViewportIndexedf)this->m_ptr_glViewportIndexedf = (FunctionTable::MEMBERPFNGLVIEWPORTINDEXEDFPROC)&RecordingTableDecorator::m_glViewportIndexedf_recording;
+if(this->m_ptr_glProgramUniform4d)this->m_ptr_glProgramUniform4d = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4DPROC)&RecordingTableDecorator::m_glProgramUniform4d_recording;
+if(this->m_ptr_glTexCoord1xOES)this->m_ptr_glTexCoord1xOES = (FunctionTable::MEMBERPFNGLTEXCOORD1XOESPROC)&RecordingTableDecorator::m_glTexCoord1xOES_recording;
+if(this->m_ptr_glVertexStream3ivATI)this->m_ptr_glVertexStream3ivATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM3IVATIPROC)&RecordingTableDecorator::m_glVertexStream3ivATI_recording;
+if(this->m_ptr_glGetStringi)this->m_ptr_glGetStringi = (FunctionTable::MEMBERPFNGLGETSTRINGIPROC)&RecordingTableDecorator::m_glGetStringi_recording;
+if(this->m_ptr_glEndQueryARB)this->m_ptr_glEndQueryARB = (FunctionTable::MEMBERPFNGLENDQUERYARBPROC)&RecordingTableDecorator::m_glEndQueryARB_recording;
+if(this->m_ptr_glVDPAUMapSurfacesNV)this->m_ptr_glVDPAUMapSurfacesNV = (FunctionTable::MEMBERPFNGLVDPAUMAPSURFACESNVPROC)&RecordingTableDecorator::m_glVDPAUMapSurfacesNV_recording;
+if(this->m_ptr_glVertex3i)this->m_ptr_glVertex3i = (FunctionTable::MEMBERPFNGLVERTEX3IPROC)&RecordingTableDecorator::m_glVertex3i_recording;
+if(this->m_ptr_glVertexAttrib4uivARB)this->m_ptr_glVertexAttrib4uivARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4UIVARBPROC)&RecordingTableDecorator::m_glVertexAttrib4uivARB_recording;
+if(this->m_ptr_glResumeTransformFeedbackNV)this->m_ptr_glResumeTransformFeedbackNV = (FunctionTable::MEMBERPFNGLRESUMETRANSFORMFEEDBACKNVPROC)&RecordingTableDecorator::m_glResumeTransformFeedbackNV_recording;
+if(this->m_ptr_glAttachShader)this->m_ptr_glAttachShader = (FunctionTable::MEMBERPFNGLATTACHSHADERPROC)&RecordingTableDecorator::m_glAttachShader_recording;
+if(this->m_ptr_glColor4hNV)this->m_ptr_glColor4hNV = (FunctionTable::MEMBERPFNGLCOLOR4HNVPROC)&RecordingTableDecorator::m_glColor4hNV_recording;
+if(this->m_ptr_glGetFenceivNV)this->m_ptr_glGetFenceivNV = (FunctionTable::MEMBERPFNGLGETFENCEIVNVPROC)&RecordingTableDecorator::m_glGetFenceivNV_recording;
+if(this->m_ptr_glTexCoord2fColor4ubVertex3fvSUN)this->m_ptr_glTexCoord2fColor4ubVertex3fvSUN = (FunctionTable::MEMBERPFNGLTEXCOORD2FCOLOR4UBVERTEX3FVSUNPROC)&RecordingTableDecorator::m_glTexCoord2fColor4ubVertex3fvSUN_recording;
+if(this->m_ptr_glGetColorTable)this->m_ptr_glGetColorTable = (FunctionTable::MEMBERPFNGLGETCOLORTABLEPROC)&RecordingTableDecorator::m_glGetColorTable_recording;
+if(this->m_ptr_glFogCoordPointer)this->m_ptr_glFogCoordPointer = (FunctionTable::MEMBERPFNGLFOGCOORDPOINTERPROC)&RecordingTableDecorator::m_glFogCoordPointer_recording;
+if(this->m_ptr_glTexStorageSparseAMD)this->m_ptr_glTexStorageSparseAMD = (FunctionTable::MEMBERPFNGLTEXSTORAGESPARSEAMDPROC)&RecordingTableDecorator::m_glTexStorageSparseAMD_recording;
+if(this->m_ptr_glUnmapNamedBuffer)this->m_ptr_glUnmapNamedBuffer = (FunctionTable::MEMBERPFNGLUNMAPNAMEDBUFFERPROC)&RecordingTableDecorator::m_glUnmapNamedBuffer_recording;
+if(this->m_ptr_glTexCoord4bvOES)this->m_ptr_glTexCoord4bvOES = (FunctionTable::MEMBERPFNGLTEXCOORD4BVOESPROC)&RecordingTableDecorator::m_glTexCoord4bvOES_recording;
+if(this->m_ptr_glVertexAttrib3fARB)this->m_ptr_glVertexAttrib3fARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3FARBPROC)&RecordingTableDecorator::m_glVertexAttrib3fARB_recording;
+if(this->m_ptr_glRasterPos2xOES)this->m_ptr_glRasterPos2xOES = (FunctionTable::MEMBERPFNGLRASTERPOS2XOESPROC)&RecordingTableDecorator::m_glRasterPos2xOES_recording;
+if(this->m_ptr_glColor4ubVertex2fvSUN)this->m_ptr_glColor4ubVertex2fvSUN = (FunctionTable::MEMBERPFNGLCOLOR4UBVERTEX2FVSUNPROC)&RecordingTableDecorator::m_glColor4ubVertex2fvSUN_recording;
+if(this->m_ptr_glSecondaryColor3dv)this->m_ptr_glSecondaryColor3dv = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3DVPROC)&RecordingTableDecorator::m_glSecondaryColor3dv_recording;
+if(this->m_ptr_glVertexAttribI4sv)this->m_ptr_glVertexAttribI4sv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4SVPROC)&RecordingTableDecorator::m_glVertexAttribI4sv_recording;
+if(this->m_ptr_glDrawTransformFeedbackStreamInstanced)this->m_ptr_glDrawTransformFeedbackStreamInstanced = (FunctionTable::MEMBERPFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC)&RecordingTableDecorator::m_glDrawTransformFeedbackStreamInstanced_recording;
+if(this->m_ptr_glMultiTexCoord4ivARB)this->m_ptr_glMultiTexCoord4ivARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4IVARBPROC)&RecordingTableDecorator::m_glMultiTexCoord4ivARB_recording;
+if(this->m_ptr_glSpriteParameterfSGIX)this->m_ptr_glSpriteParameterfSGIX = (FunctionTable::MEMBERPFNGLSPRITEPARAMETERFSGIXPROC)&RecordingTableDecorator::m_glSpriteParameterfSGIX_recording;
+if(this->m_ptr_glSecondaryColor3sv)this->m_ptr_glSecondaryColor3sv = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3SVPROC)&RecordingTableDecorator::m_glSecondaryColor3sv_recording;
+if(this->m_ptr_glBindVideoCaptureStreamTextureNV)this->m_ptr_glBindVideoCaptureStreamTextureNV = (FunctionTable::MEMBERPFNGLBINDVIDEOCAPTURESTREAMTEXTURENVPROC)&RecordingTableDecorator::m_glBindVideoCaptureStreamTextureNV_recording;
+if(this->m_ptr_glTexParameterIuiv)this->m_ptr_glTexParameterIuiv = (FunctionTable::MEMBERPFNGLTEXPARAMETERIUIVPROC)&RecordingTableDecorator::m_glTexParameterIuiv_recording;
+if(this->m_ptr_glFlushPixelDataRangeNV)this->m_ptr_glFlushPixelDataRangeNV = (FunctionTable::MEMBERPFNGLFLUSHPIXELDATARANGENVPROC)&RecordingTableDecorator::m_glFlushPixelDataRangeNV_recording;
+if(this->m_ptr_glWindowPos3fv)this->m_ptr_glWindowPos3fv = (FunctionTable::MEMBERPFNGLWINDOWPOS3FVPROC)&RecordingTableDecorator::m_glWindowPos3fv_recording;
+if(this->m_ptr_glVertexAttribLFormatNV)this->m_ptr_glVertexAttribLFormatNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBLFORMATNVPROC)&RecordingTableDecorator::m_glVertexAttribLFormatNV_recording;
+if(this->m_ptr_glLightModelfv)this->m_ptr_glLightModelfv = (FunctionTable::MEMBERPFNGLLIGHTMODELFVPROC)&RecordingTableDecorator::m_glLightModelfv_recording;
+if(this->m_ptr_glGetColorTableSGI)this->m_ptr_glGetColorTableSGI = (FunctionTable::MEMBERPFNGLGETCOLORTABLESGIPROC)&RecordingTableDecorator::m_glGetColorTableSGI_recording;
+if(this->m_ptr_glGetCompressedTexImageARB)this->m_ptr_glGetCompressedTexImageARB = (FunctionTable::MEMBERPFNGLGETCOMPRESSEDTEXIMAGEARBPROC)&RecordingTableDecorator::m_glGetCompressedTexImageARB_recording;
+if(this->m_ptr_glConvolutionParameteri)this->m_ptr_glConvolutionParameteri = (FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERIPROC)&RecordingTableDecorator::m_glConvolutionParameteri_recording;
+if(this->m_ptr_glVertexWeighthNV)this->m_ptr_glVertexWeighthNV = (FunctionTable::MEMBERPFNGLVERTEXWEIGHTHNVPROC)&RecordingTableDecorator::m_glVertexWeighthNV_recording;
+if(this->m_ptr_glColorMaskIndexedEXT)this->m_ptr_glColorMaskIndexedEXT = (FunctionTable::MEMBERPFNGLCOLORMASKINDEXEDEXTPROC)&RecordingTableDecorator::m_glColorMaskIndexedEXT_recording;
+if(this->m_ptr_glColorMaski)this->m_ptr_glColorMaski = (FunctionTable::MEMBERPFNGLCOLORMASKIPROC)&RecordingTableDecorator::m_glColorMaski_recording;
+if(this->m_ptr_glColorFragmentOp1ATI)this->m_ptr_glColorFragmentOp1ATI = (FunctionTable::MEMBERPFNGLCOLORFRAGMENTOP1ATIPROC)&RecordingTableDecorator::m_glColorFragmentOp1ATI_recording;
+if(this->m_ptr_glVertexAttribI4ubvEXT)this->m_ptr_glVertexAttribI4ubvEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4UBVEXTPROC)&RecordingTableDecorator::m_glVertexAttribI4ubvEXT_recording;
+if(this->m_ptr_glVertexAttrib1dNV)this->m_ptr_glVertexAttrib1dNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1DNVPROC)&RecordingTableDecorator::m_glVertexAttrib1dNV_recording;
+if(this->m_ptr_glUnmapObjectBufferATI)this->m_ptr_glUnmapObjectBufferATI = (FunctionTable::MEMBERPFNGLUNMAPOBJECTBUFFERATIPROC)&RecordingTableDecorator::m_glUnmapObjectBufferATI_recording;
+if(this->m_ptr_glNamedProgramLocalParameterI4uiEXT)this->m_ptr_glNamedProgramLocalParameterI4uiEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERI4UIEXTPROC)&RecordingTableDecorator::m_glNamedProgramLocalParameterI4uiEXT_recording;
+if(this->m_ptr_glProgramUniform1iEXT)this->m_ptr_glProgramUniform1iEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1IEXTPROC)&RecordingTableDecorator::m_glProgramUniform1iEXT_recording;
+if(this->m_ptr_glDeleteQueriesARB)this->m_ptr_glDeleteQueriesARB = (FunctionTable::MEMBERPFNGLDELETEQUERIESARBPROC)&RecordingTableDecorator::m_glDeleteQueriesARB_recording;
+if(this->m_ptr_glWindowPos3svARB)this->m_ptr_glWindowPos3svARB = (FunctionTable::MEMBERPFNGLWINDOWPOS3SVARBPROC)&RecordingTableDecorator::m_glWindowPos3svARB_recording;
+if(this->m_ptr_glVertex4s)this->m_ptr_glVertex4s = (FunctionTable::MEMBERPFNGLVERTEX4SPROC)&RecordingTableDecorator::m_glVertex4s_recording;
+if(this->m_ptr_glStringMarkerGREMEDY)this->m_ptr_glStringMarkerGREMEDY = (FunctionTable::MEMBERPFNGLSTRINGMARKERGREMEDYPROC)&RecordingTableDecorator::m_glStringMarkerGREMEDY_recording;
+if(this->m_ptr_glIsTransformFeedback)this->m_ptr_glIsTransformFeedback = (FunctionTable::MEMBERPFNGLISTRANSFORMFEEDBACKPROC)&RecordingTableDecorator::m_glIsTransformFeedback_recording;
+if(this->m_ptr_glProgramUniformMatrix2x3dvEXT)this->m_ptr_glProgramUniformMatrix2x3dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X3DVEXTPROC)&RecordingTableDecorator::m_glProgramUniformMatrix2x3dvEXT_recording;
+if(this->m_ptr_glGetObjectLabelEXT)this->m_ptr_glGetObjectLabelEXT = (FunctionTable::MEMBERPFNGLGETOBJECTLABELEXTPROC)&RecordingTableDecorator::m_glGetObjectLabelEXT_recording;
+if(this->m_ptr_glUniformHandleui64vNV)this->m_ptr_glUniformHandleui64vNV = (FunctionTable::MEMBERPFNGLUNIFORMHANDLEUI64VNVPROC)&RecordingTableDecorator::m_glUniformHandleui64vNV_recording;
+if(this->m_ptr_glRotated)this->m_ptr_glRotated = (FunctionTable::MEMBERPFNGLROTATEDPROC)&RecordingTableDecorator::m_glRotated_recording;
+if(this->m_ptr_glIsProgramPipeline)this->m_ptr_glIsProgramPipeline = (FunctionTable::MEMBERPFNGLISPROGRAMPIPELINEPROC)&RecordingTableDecorator::m_glIsProgramPipeline_recording;
+if(this->m_ptr_glRotatef)this->m_ptr_glRotatef = (FunctionTable::MEMBERPFNGLROTATEFPROC)&RecordingTableDecorator::m_glRotatef_recording;
+if(this->m_ptr_glVertex4i)this->m_ptr_glVertex4i = (FunctionTable::MEMBERPFNGLVERTEX4IPROC)&RecordingTableDecorator::m_glVertex4i_recording;
+if(this->m_ptr_glGetActiveSubroutineUniformName)this->m_ptr_glGetActiveSubroutineUniformName = (FunctionTable::MEMBERPFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC)&RecordingTableDecorator::m_glGetActiveSubroutineUniformName_recording;
+if(this->m_ptr_glVertexAttrib4sNV)this->m_ptr_glVertexAttrib4sNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4SNVPROC)&RecordingTableDecorator::m_glVertexAttrib4sNV_recording;
+if(this->m_ptr_glProgramLocalParameter4dvARB)this->m_ptr_glProgramLocalParameter4dvARB = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETER4DVARBPROC)&RecordingTableDecorator::m_glProgramLocalParameter4dvARB_recording;
+if(this->m_ptr_glReplacementCodeubSUN)this->m_ptr_glReplacementCodeubSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUBSUNPROC)&RecordingTableDecorator::m_glReplacementCodeubSUN_recording;
+if(this->m_ptr_glMultiDrawElementsIndirectBindlessNV)this->m_ptr_glMultiDrawElementsIndirectBindlessNV = (FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSINDIRECTBINDLESSNVPROC)&RecordingTableDecorator::m_glMultiDrawElementsIndirectBindlessNV_recording;
+if(this->m_ptr_glUniformMatrix3fv)this->m_ptr_glUniformMatrix3fv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX3FVPROC)&RecordingTableDecorator::m_glUniformMatrix3fv_recording;
+if(this->m_ptr_glGetnMapfvARB)this->m_ptr_glGetnMapfvARB = (FunctionTable::MEMBERPFNGLGETNMAPFVARBPROC)&RecordingTableDecorator::m_glGetnMapfvARB_recording;
+if(this->m_ptr_glGetnUniformfv)this->m_ptr_glGetnUniformfv = (FunctionTable::MEMBERPFNGLGETNUNIFORMFVPROC)&RecordingTableDecorator::m_glGetnUniformfv_recording;
+if(this->m_ptr_glVertexAttribL2dv)this->m_ptr_glVertexAttribL2dv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL2DVPROC)&RecordingTableDecorator::m_glVertexAttribL2dv_recording;
+if(this->m_ptr_glVertexWeightPointerEXT)this->m_ptr_glVertexWeightPointerEXT = (FunctionTable::MEMBERPFNGLVERTEXWEIGHTPOINTEREXTPROC)&RecordingTableDecorator::m_glVertexWeightPointerEXT_recording;
+if(this->m_ptr_glTangent3sEXT)this->m_ptr_glTangent3sEXT = (FunctionTable::MEMBERPFNGLTANGENT3SEXTPROC)&RecordingTableDecorator::m_glTangent3sEXT_recording;
+if(this->m_ptr_glSecondaryColorPointer)this->m_ptr_glSecondaryColorPointer = (FunctionTable::MEMBERPFNGLSECONDARYCOLORPOINTERPROC)&RecordingTableDecorator::m_glSecondaryColorPointer_recording;
+if(this->m_ptr_glAlphaFunc)this->m_ptr_glAlphaFunc = (FunctionTable::MEMBERPFNGLALPHAFUNCPROC)&RecordingTableDecorator::m_glAlphaFunc_recording;
+if(this->m_ptr_glGetNamedStringARB)this->m_ptr_glGetNamedStringARB = (FunctionTable::MEMBERPFNGLGETNAMEDSTRINGARBPROC)&RecordingTableDecorator::m_glGetNamedStringARB_recording;
+if(this->m_ptr_glTexCoord4d)this->m_ptr_glTexCoord4d = (FunctionTable::MEMBERPFNGLTEXCOORD4DPROC)&RecordingTableDecorator::m_glTexCoord4d_recording;
+if(this->m_ptr_glBufferPageCommitmentARB)this->m_ptr_glBufferPageCommitmentARB = (FunctionTable::MEMBERPFNGLBUFFERPAGECOMMITMENTARBPROC)&RecordingTableDecorator::m_glBufferPageCommitmentARB_recording;
+if(this->m_ptr_glProgramLocalParameters4fvEXT)this->m_ptr_glProgramLocalParameters4fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERS4FVEXTPROC)&RecordingTableDecorator::m_glProgramLocalParameters4fvEXT_recording;
+if(this->m_ptr_glStencilFunc)this->m_ptr_glStencilFunc = (FunctionTable::MEMBERPFNGLSTENCILFUNCPROC)&RecordingTableDecorator::m_glStencilFunc_recording;
+if(this->m_ptr_glGetVertexAttribdvNV)this->m_ptr_glGetVertexAttribdvNV = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBDVNVPROC)&RecordingTableDecorator::m_glGetVertexAttribdvNV_recording;
+if(this->m_ptr_glTexCoord3dv)this->m_ptr_glTexCoord3dv = (FunctionTable::MEMBERPFNGLTEXCOORD3DVPROC)&RecordingTableDecorator::m_glTexCoord3dv_recording;
+if(this->m_ptr_glGetQueryBufferObjectiv)this->m_ptr_glGetQueryBufferObjectiv = (FunctionTable::MEMBERPFNGLGETQUERYBUFFEROBJECTIVPROC)&RecordingTableDecorator::m_glGetQueryBufferObjectiv_recording;
+if(this->m_ptr_glTexGenxOES)this->m_ptr_glTexGenxOES = (FunctionTable::MEMBERPFNGLTEXGENXOESPROC)&RecordingTableDecorator::m_glTexGenxOES_recording;
+if(this->m_ptr_glMultiTexCoord1fvARB)this->m_ptr_glMultiTexCoord1fvARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1FVARBPROC)&RecordingTableDecorator::m_glMultiTexCoord1fvARB_recording;
+if(this->m_ptr_glLightEnviSGIX)this->m_ptr_glLightEnviSGIX = (FunctionTable::MEMBERPFNGLLIGHTENVISGIXPROC)&RecordingTableDecorator::m_glLightEnviSGIX_recording;
+if(this->m_ptr_glGetProgramPipelineiv)this->m_ptr_glGetProgramPipelineiv = (FunctionTable::MEMBERPFNGLGETPROGRAMPIPELINEIVPROC)&RecordingTableDecorator::m_glGetProgramPipelineiv_recording;
+if(this->m_ptr_glVertexStream2ivATI)this->m_ptr_glVertexStream2ivATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM2IVATIPROC)&RecordingTableDecorator::m_glVertexStream2ivATI_recording;
+if(this->m_ptr_glGetColorTableEXT)this->m_ptr_glGetColorTableEXT = (FunctionTable::MEMBERPFNGLGETCOLORTABLEEXTPROC)&RecordingTableDecorator::m_glGetColorTableEXT_recording;
+if(this->m_ptr_glGetShaderInfoLog)this->m_ptr_glGetShaderInfoLog = (FunctionTable::MEMBERPFNGLGETSHADERINFOLOGPROC)&RecordingTableDecorator::m_glGetShaderInfoLog_recording;
+if(this->m_ptr_glGetOcclusionQueryuivNV)this->m_ptr_glGetOcclusionQueryuivNV = (FunctionTable::MEMBERPFNGLGETOCCLUSIONQUERYUIVNVPROC)&RecordingTableDecorator::m_glGetOcclusionQueryuivNV_recording;
+if(this->m_ptr_glInvalidateNamedFramebufferSubData)this->m_ptr_glInvalidateNamedFramebufferSubData = (FunctionTable::MEMBERPFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC)&RecordingTableDecorator::m_glInvalidateNamedFramebufferSubData_recording;
+if(this->m_ptr_glVertexAttribL1i64NV)this->m_ptr_glVertexAttribL1i64NV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL1I64NVPROC)&RecordingTableDecorator::m_glVertexAttribL1i64NV_recording;
+if(this->m_ptr_glVDPAUInitNV)this->m_ptr_glVDPAUInitNV = (FunctionTable::MEMBERPFNGLVDPAUINITNVPROC)&RecordingTableDecorator::m_glVDPAUInitNV_recording;
+if(this->m_ptr_glVertexAttrib1hvNV)this->m_ptr_glVertexAttrib1hvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1HVNVPROC)&RecordingTableDecorator::m_glVertexAttrib1hvNV_recording;
+if(this->m_ptr_glVertexAttribI4i)this->m_ptr_glVertexAttribI4i = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4IPROC)&RecordingTableDecorator::m_glVertexAttribI4i_recording;
+if(this->m_ptr_glRasterPos2iv)this->m_ptr_glRasterPos2iv = (FunctionTable::MEMBERPFNGLRASTERPOS2IVPROC)&RecordingTableDecorator::m_glRasterPos2iv_recording;
+if(this->m_ptr_glGetIntegerui64i_vNV)this->m_ptr_glGetIntegerui64i_vNV = (FunctionTable::MEMBERPFNGLGETINTEGERUI64I_VNVPROC)&RecordingTableDecorator::m_glGetIntegerui64i_vNV_recording;
+if(this->m_ptr_glUniformHandleui64NV)this->m_ptr_glUniformHandleui64NV = (FunctionTable::MEMBERPFNGLUNIFORMHANDLEUI64NVPROC)&RecordingTableDecorator::m_glUniformHandleui64NV_recording;
+if(this->m_ptr_glWindowPos3ivMESA)this->m_ptr_glWindowPos3ivMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS3IVMESAPROC)&RecordingTableDecorator::m_glWindowPos3ivMESA_recording;
+if(this->m_ptr_glBlendEquationSeparate)this->m_ptr_glBlendEquationSeparate = (FunctionTable::MEMBERPFNGLBLENDEQUATIONSEPARATEPROC)&RecordingTableDecorator::m_glBlendEquationSeparate_recording;
+if(this->m_ptr_glDrawElementsInstancedARB)this->m_ptr_glDrawElementsInstancedARB = (FunctionTable::MEMBERPFNGLDRAWELEMENTSINSTANCEDARBPROC)&RecordingTableDecorator::m_glDrawElementsInstancedARB_recording;
+if(this->m_ptr_glGetSubroutineIndex)this->m_ptr_glGetSubroutineIndex = (FunctionTable::MEMBERPFNGLGETSUBROUTINEINDEXPROC)&RecordingTableDecorator::m_glGetSubroutineIndex_recording;
+if(this->m_ptr_glVertexAttrib2sv)this->m_ptr_glVertexAttrib2sv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2SVPROC)&RecordingTableDecorator::m_glVertexAttrib2sv_recording;
+if(this->m_ptr_glSamplePatternSGIS)this->m_ptr_glSamplePatternSGIS = (FunctionTable::MEMBERPFNGLSAMPLEPATTERNSGISPROC)&RecordingTableDecorator::m_glSamplePatternSGIS_recording;
+if(this->m_ptr_glEGLImageTargetRenderbufferStorageOES)this->m_ptr_glEGLImageTargetRenderbufferStorageOES = (FunctionTable::MEMBERPFNGLEGLIMAGETARGETRENDERBUFFERSTORAGEOESPROC)&RecordingTableDecorator::m_glEGLImageTargetRenderbufferStorageOES_recording;
+if(this->m_ptr_glPushAttrib)this->m_ptr_glPushAttrib = (FunctionTable::MEMBERPFNGLPUSHATTRIBPROC)&RecordingTableDecorator::m_glPushAttrib_recording;
+if(this->m_ptr_glVertex3hNV)this->m_ptr_glVertex3hNV = (FunctionTable::MEMBERPFNGLVERTEX3HNVPROC)&RecordingTableDecorator::m_glVertex3hNV_recording;
+if(this->m_ptr_glRasterPos3xvOES)this->m_ptr_glRasterPos3xvOES = (FunctionTable::MEMBERPFNGLRASTERPOS3XVOESPROC)&RecordingTableDecorator::m_glRasterPos3xvOES_recording;
+if(this->m_ptr_glPathParameterfNV)this->m_ptr_glPathParameterfNV = (FunctionTable::MEMBERPFNGLPATHPARAMETERFNVPROC)&RecordingTableDecorator::m_glPathParameterfNV_recording;
+if(this->m_ptr_glGetUniformi64vNV)this->m_ptr_glGetUniformi64vNV = (FunctionTable::MEMBERPFNGLGETUNIFORMI64VNVPROC)&RecordingTableDecorator::m_glGetUniformi64vNV_recording;
+if(this->m_ptr_glLightiv)this->m_ptr_glLightiv = (FunctionTable::MEMBERPFNGLLIGHTIVPROC)&RecordingTableDecorator::m_glLightiv_recording;
+if(this->m_ptr_glMaterialxvOES)this->m_ptr_glMaterialxvOES = (FunctionTable::MEMBERPFNGLMATERIALXVOESPROC)&RecordingTableDecorator::m_glMaterialxvOES_recording;
+if(this->m_ptr_glNamedProgramLocalParameter4fEXT)this->m_ptr_glNamedProgramLocalParameter4fEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETER4FEXTPROC)&RecordingTableDecorator::m_glNamedProgramLocalParameter4fEXT_recording;
+if(this->m_ptr_glVertexAttribL1dEXT)this->m_ptr_glVertexAttribL1dEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL1DEXTPROC)&RecordingTableDecorator::m_glVertexAttribL1dEXT_recording;
+if(this->m_ptr_glGetnUniformdvARB)this->m_ptr_glGetnUniformdvARB = (FunctionTable::MEMBERPFNGLGETNUNIFORMDVARBPROC)&RecordingTableDecorator::m_glGetnUniformdvARB_recording;
+if(this->m_ptr_glSecondaryColor3bEXT)this->m_ptr_glSecondaryColor3bEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3BEXTPROC)&RecordingTableDecorator::m_glSecondaryColor3bEXT_recording;
+if(this->m_ptr_glBeginPerfQueryINTEL)this->m_ptr_glBeginPerfQueryINTEL = (FunctionTable::MEMBERPFNGLBEGINPERFQUERYINTELPROC)&RecordingTableDecorator::m_glBeginPerfQueryINTEL_recording;
+if(this->m_ptr_glProgramUniform1uivEXT)this->m_ptr_glProgramUniform1uivEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UIVEXTPROC)&RecordingTableDecorator::m_glProgramUniform1uivEXT_recording;
+if(this->m_ptr_glImageTransformParameterivHP)this->m_ptr_glImageTransformParameterivHP = (FunctionTable::MEMBERPFNGLIMAGETRANSFORMPARAMETERIVHPPROC)&RecordingTableDecorator::m_glImageTransformParameterivHP_recording;
+if(this->m_ptr_glDeleteBuffers)this->m_ptr_glDeleteBuffers = (FunctionTable::MEMBERPFNGLDELETEBUFFERSPROC)&RecordingTableDecorator::m_glDeleteBuffers_recording;
+if(this->m_ptr_glBindProgramPipeline)this->m_ptr_glBindProgramPipeline = (FunctionTable::MEMBERPFNGLBINDPROGRAMPIPELINEPROC)&RecordingTableDecorator::m_glBindProgramPipeline_recording;
+if(this->m_ptr_glScissor)this->m_ptr_glScissor = (FunctionTable::MEMBERPFNGLSCISSORPROC)&RecordingTableDecorator::m_glScissor_recording;
+if(this->m_ptr_glProgramUniform4fv)this->m_ptr_glProgramUniform4fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4FVPROC)&RecordingTableDecorator::m_glProgramUniform4fv_recording;
+if(this->m_ptr_glGetBooleanv)this->m_ptr_glGetBooleanv = (FunctionTable::MEMBERPFNGLGETBOOLEANVPROC)&RecordingTableDecorator::m_glGetBooleanv_recording;
+if(this->m_ptr_glMaterialfv)this->m_ptr_glMaterialfv = (FunctionTable::MEMBERPFNGLMATERIALFVPROC)&RecordingTableDecorator::m_glMaterialfv_recording;
+if(this->m_ptr_glWindowPos4fvMESA)this->m_ptr_glWindowPos4fvMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS4FVMESAPROC)&RecordingTableDecorator::m_glWindowPos4fvMESA_recording;
+if(this->m_ptr_glVertexAttribIPointerEXT)this->m_ptr_glVertexAttribIPointerEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBIPOINTEREXTPROC)&RecordingTableDecorator::m_glVertexAttribIPointerEXT_recording;
+if(this->m_ptr_glProgramBufferParametersfvNV)this->m_ptr_glProgramBufferParametersfvNV = (FunctionTable::MEMBERPFNGLPROGRAMBUFFERPARAMETERSFVNVPROC)&RecordingTableDecorator::m_glProgramBufferParametersfvNV_recording;
+if(this->m_ptr_glAlphaFuncxOES)this->m_ptr_glAlphaFuncxOES = (FunctionTable::MEMBERPFNGLALPHAFUNCXOESPROC)&RecordingTableDecorator::m_glAlphaFuncxOES_recording;
+if(this->m_ptr_glMultiDrawArraysIndirectAMD)this->m_ptr_glMultiDrawArraysIndirectAMD = (FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSINDIRECTAMDPROC)&RecordingTableDecorator::m_glMultiDrawArraysIndirectAMD_recording;
+if(this->m_ptr_glNormalStream3ivATI)this->m_ptr_glNormalStream3ivATI = (FunctionTable::MEMBERPFNGLNORMALSTREAM3IVATIPROC)&RecordingTableDecorator::m_glNormalStream3ivATI_recording;
+if(this->m_ptr_glTextureImage3DMultisampleNV)this->m_ptr_glTextureImage3DMultisampleNV = (FunctionTable::MEMBERPFNGLTEXTUREIMAGE3DMULTISAMPLENVPROC)&RecordingTableDecorator::m_glTextureImage3DMultisampleNV_recording;
+if(this->m_ptr_glProgramUniform4uivEXT)this->m_ptr_glProgramUniform4uivEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UIVEXTPROC)&RecordingTableDecorator::m_glProgramUniform4uivEXT_recording;
+if(this->m_ptr_glReplacementCodeusvSUN)this->m_ptr_glReplacementCodeusvSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUSVSUNPROC)&RecordingTableDecorator::m_glReplacementCodeusvSUN_recording;
+if(this->m_ptr_glPollInstrumentsSGIX)this->m_ptr_glPollInstrumentsSGIX = (FunctionTable::MEMBERPFNGLPOLLINSTRUMENTSSGIXPROC)&RecordingTableDecorator::m_glPollInstrumentsSGIX_recording;
+if(this->m_ptr_glGetTextureLevelParameteriv)this->m_ptr_glGetTextureLevelParameteriv = (FunctionTable::MEMBERPFNGLGETTEXTURELEVELPARAMETERIVPROC)&RecordingTableDecorator::m_glGetTextureLevelParameteriv_recording;
+if(this->m_ptr_glVertexAttribI2uiv)this->m_ptr_glVertexAttribI2uiv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI2UIVPROC)&RecordingTableDecorator::m_glVertexAttribI2uiv_recording;
+if(this->m_ptr_glMapControlPointsNV)this->m_ptr_glMapControlPointsNV = (FunctionTable::MEMBERPFNGLMAPCONTROLPOINTSNVPROC)&RecordingTableDecorator::m_glMapControlPointsNV_recording;
+if(this->m_ptr_glColor4dv)this->m_ptr_glColor4dv = (FunctionTable::MEMBERPFNGLCOLOR4DVPROC)&RecordingTableDecorator::m_glColor4dv_recording;
+if(this->m_ptr_glInvalidateBufferSubData)this->m_ptr_glInvalidateBufferSubData = (FunctionTable::MEMBERPFNGLINVALIDATEBUFFERSUBDATAPROC)&RecordingTableDecorator::m_glInvalidateBufferSubData_recording;
+if(this->m_ptr_glMultiTexCoord1hNV)this->m_ptr_glMultiTexCoord1hNV = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1HNVPROC)&RecordingTableDecorator::m_glMultiTexCoord1hNV_recording;
+if(this->m_ptr_glPointParameterfv)this->m_ptr_glPointParameterfv = (FunctionTable::MEMBERPFNGLPOINTPARAMETERFVPROC)&RecordingTableDecorator::m_glPointParameterfv_recording;
+if(this->m_ptr_glUniformMatrix2fvARB)this->m_ptr_glUniformMatrix2fvARB = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX2FVARBPROC)&RecordingTableDecorator::m_glUniformMatrix2fvARB_recording;
+if(this->m_ptr_glUniform2fv)this->m_ptr_glUniform2fv = (FunctionTable::MEMBERPFNGLUNIFORM2FVPROC)&RecordingTableDecorator::m_glUniform2fv_recording;
+if(this->m_ptr_glVertexPointerListIBM)this->m_ptr_glVertexPointerListIBM = (FunctionTable::MEMBERPFNGLVERTEXPOINTERLISTIBMPROC)&RecordingTableDecorator::m_glVertexPointerListIBM_recording;
+if(this->m_ptr_glGetMultiTexGenfvEXT)this->m_ptr_glGetMultiTexGenfvEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXGENFVEXTPROC)&RecordingTableDecorator::m_glGetMultiTexGenfvEXT_recording;
+if(this->m_ptr_glGetMinmaxEXT)this->m_ptr_glGetMinmaxEXT = (FunctionTable::MEMBERPFNGLGETMINMAXEXTPROC)&RecordingTableDecorator::m_glGetMinmaxEXT_recording;
+if(this->m_ptr_glIsFenceNV)this->m_ptr_glIsFenceNV = (FunctionTable::MEMBERPFNGLISFENCENVPROC)&RecordingTableDecorator::m_glIsFenceNV_recording;
+if(this->m_ptr_glMatrixFrustumEXT)this->m_ptr_glMatrixFrustumEXT = (FunctionTable::MEMBERPFNGLMATRIXFRUSTUMEXTPROC)&RecordingTableDecorator::m_glMatrixFrustumEXT_recording;
+if(this->m_ptr_glDispatchComputeIndirect)this->m_ptr_glDispatchComputeIndirect = (FunctionTable::MEMBERPFNGLDISPATCHCOMPUTEINDIRECTPROC)&RecordingTableDecorator::m_glDispatchComputeIndirect_recording;
+if(this->m_ptr_glMultiTexCoord4bOES)this->m_ptr_glMultiTexCoord4bOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4BOESPROC)&RecordingTableDecorator::m_glMultiTexCoord4bOES_recording;
+if(this->m_ptr_glProgramEnvParameter4dARB)this->m_ptr_glProgramEnvParameter4dARB = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETER4DARBPROC)&RecordingTableDecorator::m_glProgramEnvParameter4dARB_recording;
+if(this->m_ptr_glProgramUniform1uiEXT)this->m_ptr_glProgramUniform1uiEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UIEXTPROC)&RecordingTableDecorator::m_glProgramUniform1uiEXT_recording;
+if(this->m_ptr_glBindBufferRange)this->m_ptr_glBindBufferRange = (FunctionTable::MEMBERPFNGLBINDBUFFERRANGEPROC)&RecordingTableDecorator::m_glBindBufferRange_recording;
+if(this->m_ptr_glNormal3iv)this->m_ptr_glNormal3iv = (FunctionTable::MEMBERPFNGLNORMAL3IVPROC)&RecordingTableDecorator::m_glNormal3iv_recording;
+if(this->m_ptr_glVertexAttribL3dv)this->m_ptr_glVertexAttribL3dv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL3DVPROC)&RecordingTableDecorator::m_glVertexAttribL3dv_recording;
+if(this->m_ptr_glGetUniformdv)this->m_ptr_glGetUniformdv = (FunctionTable::MEMBERPFNGLGETUNIFORMDVPROC)&RecordingTableDecorator::m_glGetUniformdv_recording;
+if(this->m_ptr_glGetMultiTexLevelParameterfvEXT)this->m_ptr_glGetMultiTexLevelParameterfvEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXLEVELPARAMETERFVEXTPROC)&RecordingTableDecorator::m_glGetMultiTexLevelParameterfvEXT_recording;
+if(this->m_ptr_glFinalCombinerInputNV)this->m_ptr_glFinalCombinerInputNV = (FunctionTable::MEMBERPFNGLFINALCOMBINERINPUTNVPROC)&RecordingTableDecorator::m_glFinalCombinerInputNV_recording;
+if(this->m_ptr_glCullParameterdvEXT)this->m_ptr_glCullParameterdvEXT = (FunctionTable::MEMBERPFNGLCULLPARAMETERDVEXTPROC)&RecordingTableDecorator::m_glCullParameterdvEXT_recording;
+if(this->m_ptr_glMultiTexCoord4s)this->m_ptr_glMultiTexCoord4s = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4SPROC)&RecordingTableDecorator::m_glMultiTexCoord4s_recording;
+if(this->m_ptr_glMapVertexAttrib1fAPPLE)this->m_ptr_glMapVertexAttrib1fAPPLE = (FunctionTable::MEMBERPFNGLMAPVERTEXATTRIB1FAPPLEPROC)&RecordingTableDecorator::m_glMapVertexAttrib1fAPPLE_recording;
+if(this->m_ptr_glConvolutionParameterfEXT)this->m_ptr_glConvolutionParameterfEXT = (FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERFEXTPROC)&RecordingTableDecorator::m_glConvolutionParameterfEXT_recording;
+if(this->m_ptr_glTexCoord1iv)this->m_ptr_glTexCoord1iv = (FunctionTable::MEMBERPFNGLTEXCOORD1IVPROC)&RecordingTableDecorator::m_glTexCoord1iv_recording;
+if(this->m_ptr_glProgramUniform3fvEXT)this->m_ptr_glProgramUniform3fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3FVEXTPROC)&RecordingTableDecorator::m_glProgramUniform3fvEXT_recording;
+if(this->m_ptr_glColor3uiv)this->m_ptr_glColor3uiv = (FunctionTable::MEMBERPFNGLCOLOR3UIVPROC)&RecordingTableDecorator::m_glColor3uiv_recording;
+if(this->m_ptr_glListBase)this->m_ptr_glListBase = (FunctionTable::MEMBERPFNGLLISTBASEPROC)&RecordingTableDecorator::m_glListBase_recording;
+if(this->m_ptr_glTexCoord2bOES)this->m_ptr_glTexCoord2bOES = (FunctionTable::MEMBERPFNGLTEXCOORD2BOESPROC)&RecordingTableDecorator::m_glTexCoord2bOES_recording;
+if(this->m_ptr_glBindMaterialParameterEXT)this->m_ptr_glBindMaterialParameterEXT = (FunctionTable::MEMBERPFNGLBINDMATERIALPARAMETEREXTPROC)&RecordingTableDecorator::m_glBindMaterialParameterEXT_recording;
+if(this->m_ptr_glGlobalAlphaFactorubSUN)this->m_ptr_glGlobalAlphaFactorubSUN = (FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORUBSUNPROC)&RecordingTableDecorator::m_glGlobalAlphaFactorubSUN_recording;
+if(this->m_ptr_glVertexAttribL1ui64NV)this->m_ptr_glVertexAttribL1ui64NV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL1UI64NVPROC)&RecordingTableDecorator::m_glVertexAttribL1ui64NV_recording;
+if(this->m_ptr_glPointParameterfSGIS)this->m_ptr_glPointParameterfSGIS = (FunctionTable::MEMBERPFNGLPOINTPARAMETERFSGISPROC)&RecordingTableDecorator::m_glPointParameterfSGIS_recording;
+if(this->m_ptr_glGetImageTransformParameterivHP)this->m_ptr_glGetImageTransformParameterivHP = (FunctionTable::MEMBERPFNGLGETIMAGETRANSFORMPARAMETERIVHPPROC)&RecordingTableDecorator::m_glGetImageTransformParameterivHP_recording;
+if(this->m_ptr_glColorSubTableEXT)this->m_ptr_glColorSubTableEXT = (FunctionTable::MEMBERPFNGLCOLORSUBTABLEEXTPROC)&RecordingTableDecorator::m_glColorSubTableEXT_recording;
+if(this->m_ptr_glPixelTexGenParameterfvSGIS)this->m_ptr_glPixelTexGenParameterfvSGIS = (FunctionTable::MEMBERPFNGLPIXELTEXGENPARAMETERFVSGISPROC)&RecordingTableDecorator::m_glPixelTexGenParameterfvSGIS_recording;
+if(this->m_ptr_glClientWaitSync)this->m_ptr_glClientWaitSync = (FunctionTable::MEMBERPFNGLCLIENTWAITSYNCPROC)&RecordingTableDecorator::m_glClientWaitSync_recording;
+if(this->m_ptr_glQueryObjectParameteruiAMD)this->m_ptr_glQueryObjectParameteruiAMD = (FunctionTable::MEMBERPFNGLQUERYOBJECTPARAMETERUIAMDPROC)&RecordingTableDecorator::m_glQueryObjectParameteruiAMD_recording;
+if(this->m_ptr_glVertexAttribs1fvNV)this->m_ptr_glVertexAttribs1fvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS1FVNVPROC)&RecordingTableDecorator::m_glVertexAttribs1fvNV_recording;
+if(this->m_ptr_glVertexAttrib4NusvARB)this->m_ptr_glVertexAttrib4NusvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUSVARBPROC)&RecordingTableDecorator::m_glVertexAttrib4NusvARB_recording;
+if(this->m_ptr_glVariantPointerEXT)this->m_ptr_glVariantPointerEXT = (FunctionTable::MEMBERPFNGLVARIANTPOINTEREXTPROC)&RecordingTableDecorator::m_glVariantPointerEXT_recording;
+if(this->m_ptr_glTextureBuffer)this->m_ptr_glTextureBuffer = (FunctionTable::MEMBERPFNGLTEXTUREBUFFERPROC)&RecordingTableDecorator::m_glTextureBuffer_recording;
+if(this->m_ptr_glVertexAttribI1uiEXT)this->m_ptr_glVertexAttribI1uiEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI1UIEXTPROC)&RecordingTableDecorator::m_glVertexAttribI1uiEXT_recording;
+if(this->m_ptr_glInvalidateTexImage)this->m_ptr_glInvalidateTexImage = (FunctionTable::MEMBERPFNGLINVALIDATETEXIMAGEPROC)&RecordingTableDecorator::m_glInvalidateTexImage_recording;
+if(this->m_ptr_glProgramEnvParametersI4ivNV)this->m_ptr_glProgramEnvParametersI4ivNV = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERSI4IVNVPROC)&RecordingTableDecorator::m_glProgramEnvParametersI4ivNV_recording;
+if(this->m_ptr_glPathGlyphIndexArrayNV)this->m_ptr_glPathGlyphIndexArrayNV = (FunctionTable::MEMBERPFNGLPATHGLYPHINDEXARRAYNVPROC)&RecordingTableDecorator::m_glPathGlyphIndexArrayNV_recording;
+if(this->m_ptr_glCopyImageSubData)this->m_ptr_glCopyImageSubData = (FunctionTable::MEMBERPFNGLCOPYIMAGESUBDATAPROC)&RecordingTableDecorator::m_glCopyImageSubData_recording;
+if(this->m_ptr_glGetUniformSubroutineuiv)this->m_ptr_glGetUniformSubroutineuiv = (FunctionTable::MEMBERPFNGLGETUNIFORMSUBROUTINEUIVPROC)&RecordingTableDecorator::m_glGetUniformSubroutineuiv_recording;
+if(this->m_ptr_glBindVertexBuffer)this->m_ptr_glBindVertexBuffer = (FunctionTable::MEMBERPFNGLBINDVERTEXBUFFERPROC)&RecordingTableDecorator::m_glBindVertexBuffer_recording;
+if(this->m_ptr_glMultiTexCoord1iARB)this->m_ptr_glMultiTexCoord1iARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1IARBPROC)&RecordingTableDecorator::m_glMultiTexCoord1iARB_recording;
+if(this->m_ptr_glDebugMessageInsert)this->m_ptr_glDebugMessageInsert = (FunctionTable::MEMBERPFNGLDEBUGMESSAGEINSERTPROC)&RecordingTableDecorator::m_glDebugMessageInsert_recording;
+if(this->m_ptr_glBeginVertexShaderEXT)this->m_ptr_glBeginVertexShaderEXT = (FunctionTable::MEMBERPFNGLBEGINVERTEXSHADEREXTPROC)&RecordingTableDecorator::m_glBeginVertexShaderEXT_recording;
+if(this->m_ptr_glIsVariantEnabledEXT)this->m_ptr_glIsVariantEnabledEXT = (FunctionTable::MEMBERPFNGLISVARIANTENABLEDEXTPROC)&RecordingTableDecorator::m_glIsVariantEnabledEXT_recording;
+if(this->m_ptr_glPassThroughxOES)this->m_ptr_glPassThroughxOES = (FunctionTable::MEMBERPFNGLPASSTHROUGHXOESPROC)&RecordingTableDecorator::m_glPassThroughxOES_recording;
+if(this->m_ptr_glIsSampler)this->m_ptr_glIsSampler = (FunctionTable::MEMBERPFNGLISSAMPLERPROC)&RecordingTableDecorator::m_glIsSampler_recording;
+if(this->m_ptr_glConservativeRasterParameterfNV)this->m_ptr_glConservativeRasterParameterfNV = (FunctionTable::MEMBERPFNGLCONSERVATIVERASTERPARAMETERFNVPROC)&RecordingTableDecorator::m_glConservativeRasterParameterfNV_recording;
+if(this->m_ptr_glMultiTexGenivEXT)this->m_ptr_glMultiTexGenivEXT = (FunctionTable::MEMBERPFNGLMULTITEXGENIVEXTPROC)&RecordingTableDecorator::m_glMultiTexGenivEXT_recording;
+if(this->m_ptr_glNamedFramebufferTexture2DEXT)this->m_ptr_glNamedFramebufferTexture2DEXT = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTURE2DEXTPROC)&RecordingTableDecorator::m_glNamedFramebufferTexture2DEXT_recording;
+if(this->m_ptr_glCopyTexSubImage1D)this->m_ptr_glCopyTexSubImage1D = (FunctionTable::MEMBERPFNGLCOPYTEXSUBIMAGE1DPROC)&RecordingTableDecorator::m_glCopyTexSubImage1D_recording;
+if(this->m_ptr_glTexCoord1i)this->m_ptr_glTexCoord1i = (FunctionTable::MEMBERPFNGLTEXCOORD1IPROC)&RecordingTableDecorator::m_glTexCoord1i_recording;
+if(this->m_ptr_glCheckFramebufferStatus)this->m_ptr_glCheckFramebufferStatus = (FunctionTable::MEMBERPFNGLCHECKFRAMEBUFFERSTATUSPROC)&RecordingTableDecorator::m_glCheckFramebufferStatus_recording;
+if(this->m_ptr_glDrawElementArrayAPPLE)this->m_ptr_glDrawElementArrayAPPLE = (FunctionTable::MEMBERPFNGLDRAWELEMENTARRAYAPPLEPROC)&RecordingTableDecorator::m_glDrawElementArrayAPPLE_recording;
+if(this->m_ptr_glTexCoord1d)this->m_ptr_glTexCoord1d = (FunctionTable::MEMBERPFNGLTEXCOORD1DPROC)&RecordingTableDecorator::m_glTexCoord1d_recording;
+if(this->m_ptr_glTexCoord1f)this->m_ptr_glTexCoord1f = (FunctionTable::MEMBERPFNGLTEXCOORD1FPROC)&RecordingTableDecorator::m_glTexCoord1f_recording;
+if(this->m_ptr_glFragmentLightivSGIX)this->m_ptr_glFragmentLightivSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTLIGHTIVSGIXPROC)&RecordingTableDecorator::m_glFragmentLightivSGIX_recording;
+if(this->m_ptr_glBindImageTexture)this->m_ptr_glBindImageTexture = (FunctionTable::MEMBERPFNGLBINDIMAGETEXTUREPROC)&RecordingTableDecorator::m_glBindImageTexture_recording;
+if(this->m_ptr_glTransformFeedbackVaryings)this->m_ptr_glTransformFeedbackVaryings = (FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKVARYINGSPROC)&RecordingTableDecorator::m_glTransformFeedbackVaryings_recording;
+if(this->m_ptr_glDrawRangeElements)this->m_ptr_glDrawRangeElements = (FunctionTable::MEMBERPFNGLDRAWRANGEELEMENTSPROC)&RecordingTableDecorator::m_glDrawRangeElements_recording;
+if(this->m_ptr_glTexCoord1s)this->m_ptr_glTexCoord1s = (FunctionTable::MEMBERPFNGLTEXCOORD1SPROC)&RecordingTableDecorator::m_glTexCoord1s_recording;
+if(this->m_ptr_glBindBufferBase)this->m_ptr_glBindBufferBase = (FunctionTable::MEMBERPFNGLBINDBUFFERBASEPROC)&RecordingTableDecorator::m_glBindBufferBase_recording;
+if(this->m_ptr_glColor3bv)this->m_ptr_glColor3bv = (FunctionTable::MEMBERPFNGLCOLOR3BVPROC)&RecordingTableDecorator::m_glColor3bv_recording;
+if(this->m_ptr_glSyncTextureINTEL)this->m_ptr_glSyncTextureINTEL = (FunctionTable::MEMBERPFNGLSYNCTEXTUREINTELPROC)&RecordingTableDecorator::m_glSyncTextureINTEL_recording;
+if(this->m_ptr_glCreateSamplers)this->m_ptr_glCreateSamplers = (FunctionTable::MEMBERPFNGLCREATESAMPLERSPROC)&RecordingTableDecorator::m_glCreateSamplers_recording;
+if(this->m_ptr_glCombinerParameterfNV)this->m_ptr_glCombinerParameterfNV = (FunctionTable::MEMBERPFNGLCOMBINERPARAMETERFNVPROC)&RecordingTableDecorator::m_glCombinerParameterfNV_recording;
+if(this->m_ptr_glGetArrayObjectivATI)this->m_ptr_glGetArrayObjectivATI = (FunctionTable::MEMBERPFNGLGETARRAYOBJECTIVATIPROC)&RecordingTableDecorator::m_glGetArrayObjectivATI_recording;
+if(this->m_ptr_glMultiDrawArrays)this->m_ptr_glMultiDrawArrays = (FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSPROC)&RecordingTableDecorator::m_glMultiDrawArrays_recording;
+if(this->m_ptr_glSampleMapATI)this->m_ptr_glSampleMapATI = (FunctionTable::MEMBERPFNGLSAMPLEMAPATIPROC)&RecordingTableDecorator::m_glSampleMapATI_recording;
+if(this->m_ptr_glProgramUniform2i64ARB)this->m_ptr_glProgramUniform2i64ARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2I64ARBPROC)&RecordingTableDecorator::m_glProgramUniform2i64ARB_recording;
+if(this->m_ptr_glBinormal3ivEXT)this->m_ptr_glBinormal3ivEXT = (FunctionTable::MEMBERPFNGLBINORMAL3IVEXTPROC)&RecordingTableDecorator::m_glBinormal3ivEXT_recording;
+if(this->m_ptr_glMultiDrawArraysIndirectCountARB)this->m_ptr_glMultiDrawArraysIndirectCountARB = (FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSINDIRECTCOUNTARBPROC)&RecordingTableDecorator::m_glMultiDrawArraysIndirectCountARB_recording;
+if(this->m_ptr_glUniformBufferEXT)this->m_ptr_glUniformBufferEXT = (FunctionTable::MEMBERPFNGLUNIFORMBUFFEREXTPROC)&RecordingTableDecorator::m_glUniformBufferEXT_recording;
+if(this->m_ptr_glWindowPos2ivMESA)this->m_ptr_glWindowPos2ivMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS2IVMESAPROC)&RecordingTableDecorator::m_glWindowPos2ivMESA_recording;
+if(this->m_ptr_glTexCoordP4ui)this->m_ptr_glTexCoordP4ui = (FunctionTable::MEMBERPFNGLTEXCOORDP4UIPROC)&RecordingTableDecorator::m_glTexCoordP4ui_recording;
+if(this->m_ptr_glMultiTexSubImage1DEXT)this->m_ptr_glMultiTexSubImage1DEXT = (FunctionTable::MEMBERPFNGLMULTITEXSUBIMAGE1DEXTPROC)&RecordingTableDecorator::m_glMultiTexSubImage1DEXT_recording;
+if(this->m_ptr_glProgramUniformMatrix2x3fvEXT)this->m_ptr_glProgramUniformMatrix2x3fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X3FVEXTPROC)&RecordingTableDecorator::m_glProgramUniformMatrix2x3fvEXT_recording;
+if(this->m_ptr_glBufferDataARB)this->m_ptr_glBufferDataARB = (FunctionTable::MEMBERPFNGLBUFFERDATAARBPROC)&RecordingTableDecorator::m_glBufferDataARB_recording;
+if(this->m_ptr_glVertexAttribIFormat)this->m_ptr_glVertexAttribIFormat = (FunctionTable::MEMBERPFNGLVERTEXATTRIBIFORMATPROC)&RecordingTableDecorator::m_glVertexAttribIFormat_recording;
+if(this->m_ptr_glCreateFramebuffers)this->m_ptr_glCreateFramebuffers = (FunctionTable::MEMBERPFNGLCREATEFRAMEBUFFERSPROC)&RecordingTableDecorator::m_glCreateFramebuffers_recording;
+if(this->m_ptr_glNormalStream3dvATI)this->m_ptr_glNormalStream3dvATI = (FunctionTable::MEMBERPFNGLNORMALSTREAM3DVATIPROC)&RecordingTableDecorator::m_glNormalStream3dvATI_recording;
+if(this->m_ptr_glClearAccum)this->m_ptr_glClearAccum = (FunctionTable::MEMBERPFNGLCLEARACCUMPROC)&RecordingTableDecorator::m_glClearAccum_recording;
+if(this->m_ptr_glUniform3i64vNV)this->m_ptr_glUniform3i64vNV = (FunctionTable::MEMBERPFNGLUNIFORM3I64VNVPROC)&RecordingTableDecorator::m_glUniform3i64vNV_recording;
+if(this->m_ptr_glNormal3fVertex3fSUN)this->m_ptr_glNormal3fVertex3fSUN = (FunctionTable::MEMBERPFNGLNORMAL3FVERTEX3FSUNPROC)&RecordingTableDecorator::m_glNormal3fVertex3fSUN_recording;
+if(this->m_ptr_glUniform2uivEXT)this->m_ptr_glUniform2uivEXT = (FunctionTable::MEMBERPFNGLUNIFORM2UIVEXTPROC)&RecordingTableDecorator::m_glUniform2uivEXT_recording;
+if(this->m_ptr_glBeginQuery)this->m_ptr_glBeginQuery = (FunctionTable::MEMBERPFNGLBEGINQUERYPROC)&RecordingTableDecorator::m_glBeginQuery_recording;
+if(this->m_ptr_glStencilThenCoverStrokePathInstancedNV)this->m_ptr_glStencilThenCoverStrokePathInstancedNV = (FunctionTable::MEMBERPFNGLSTENCILTHENCOVERSTROKEPATHINSTANCEDNVPROC)&RecordingTableDecorator::m_glStencilThenCoverStrokePathInstancedNV_recording;
+if(this->m_ptr_glBindBuffer)this->m_ptr_glBindBuffer = (FunctionTable::MEMBERPFNGLBINDBUFFERPROC)&RecordingTableDecorator::m_glBindBuffer_recording;
+if(this->m_ptr_glMap2d)this->m_ptr_glMap2d = (FunctionTable::MEMBERPFNGLMAP2DPROC)&RecordingTableDecorator::m_glMap2d_recording;
+if(this->m_ptr_glMap2f)this->m_ptr_glMap2f = (FunctionTable::MEMBERPFNGLMAP2FPROC)&RecordingTableDecorator::m_glMap2f_recording;
+if(this->m_ptr_glMakeImageHandleResidentNV)this->m_ptr_glMakeImageHandleResidentNV = (FunctionTable::MEMBERPFNGLMAKEIMAGEHANDLERESIDENTNVPROC)&RecordingTableDecorator::m_glMakeImageHandleResidentNV_recording;
+if(this->m_ptr_glUniformMatrix2x4fv)this->m_ptr_glUniformMatrix2x4fv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX2X4FVPROC)&RecordingTableDecorator::m_glUniformMatrix2x4fv_recording;
+if(this->m_ptr_glGetMultiTexParameterfvEXT)this->m_ptr_glGetMultiTexParameterfvEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXPARAMETERFVEXTPROC)&RecordingTableDecorator::m_glGetMultiTexParameterfvEXT_recording;
+if(this->m_ptr_glDepthRangeIndexed)this->m_ptr_glDepthRangeIndexed = (FunctionTable::MEMBERPFNGLDEPTHRANGEINDEXEDPROC)&RecordingTableDecorator::m_glDepthRangeIndexed_recording;
+if(this->m_ptr_glMultiTexCoord1s)this->m_ptr_glMultiTexCoord1s = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1SPROC)&RecordingTableDecorator::m_glMultiTexCoord1s_recording;
+if(this->m_ptr_glMatrixScalefEXT)this->m_ptr_glMatrixScalefEXT = (FunctionTable::MEMBERPFNGLMATRIXSCALEFEXTPROC)&RecordingTableDecorator::m_glMatrixScalefEXT_recording;
+if(this->m_ptr_glGetError)this->m_ptr_glGetError = (FunctionTable::MEMBERPFNGLGETERRORPROC)&RecordingTableDecorator::m_glGetError_recording;
+if(this->m_ptr_glGetTexEnviv)this->m_ptr_glGetTexEnviv = (FunctionTable::MEMBERPFNGLGETTEXENVIVPROC)&RecordingTableDecorator::m_glGetTexEnviv_recording;
+if(this->m_ptr_glBindTextureUnitParameterEXT)this->m_ptr_glBindTextureUnitParameterEXT = (FunctionTable::MEMBERPFNGLBINDTEXTUREUNITPARAMETEREXTPROC)&RecordingTableDecorator::m_glBindTextureUnitParameterEXT_recording;
+if(this->m_ptr_glGetnUniformfvARB)this->m_ptr_glGetnUniformfvARB = (FunctionTable::MEMBERPFNGLGETNUNIFORMFVARBPROC)&RecordingTableDecorator::m_glGetnUniformfvARB_recording;
+if(this->m_ptr_glReplacementCodeuiNormal3fVertex3fvSUN)this->m_ptr_glReplacementCodeuiNormal3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUINORMAL3FVERTEX3FVSUNPROC)&RecordingTableDecorator::m_glReplacementCodeuiNormal3fVertex3fvSUN_recording;
+if(this->m_ptr_glDeletePerfQueryINTEL)this->m_ptr_glDeletePerfQueryINTEL = (FunctionTable::MEMBERPFNGLDELETEPERFQUERYINTELPROC)&RecordingTableDecorator::m_glDeletePerfQueryINTEL_recording;
+if(this->m_ptr_glActiveVaryingNV)this->m_ptr_glActiveVaryingNV = (FunctionTable::MEMBERPFNGLACTIVEVARYINGNVPROC)&RecordingTableDecorator::m_glActiveVaryingNV_recording;
+if(this->m_ptr_glGetActiveUniformARB)this->m_ptr_glGetActiveUniformARB = (FunctionTable::MEMBERPFNGLGETACTIVEUNIFORMARBPROC)&RecordingTableDecorator::m_glGetActiveUniformARB_recording;
+if(this->m_ptr_glVertexAttribI3ivEXT)this->m_ptr_glVertexAttribI3ivEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI3IVEXTPROC)&RecordingTableDecorator::m_glVertexAttribI3ivEXT_recording;
+if(this->m_ptr_glEvalCoord1d)this->m_ptr_glEvalCoord1d = (FunctionTable::MEMBERPFNGLEVALCOORD1DPROC)&RecordingTableDecorator::m_glEvalCoord1d_recording;
+if(this->m_ptr_glNamedCopyBufferSubDataEXT)this->m_ptr_glNamedCopyBufferSubDataEXT = (FunctionTable::MEMBERPFNGLNAMEDCOPYBUFFERSUBDATAEXTPROC)&RecordingTableDecorator::m_glNamedCopyBufferSubDataEXT_recording;
+if(this->m_ptr_glEvalCoord1f)this->m_ptr_glEvalCoord1f = (FunctionTable::MEMBERPFNGLEVALCOORD1FPROC)&RecordingTableDecorator::m_glEvalCoord1f_recording;
+if(this->m_ptr_glPixelMapfv)this->m_ptr_glPixelMapfv = (FunctionTable::MEMBERPFNGLPIXELMAPFVPROC)&RecordingTableDecorator::m_glPixelMapfv_recording;
+if(this->m_ptr_glVertexAttribI1ivEXT)this->m_ptr_glVertexAttribI1ivEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI1IVEXTPROC)&RecordingTableDecorator::m_glVertexAttribI1ivEXT_recording;
+if(this->m_ptr_glCreateSyncFromCLeventARB)this->m_ptr_glCreateSyncFromCLeventARB = (FunctionTable::MEMBERPFNGLCREATESYNCFROMCLEVENTARBPROC)&RecordingTableDecorator::m_glCreateSyncFromCLeventARB_recording;
+if(this->m_ptr_glGetPixelMapusv)this->m_ptr_glGetPixelMapusv = (FunctionTable::MEMBERPFNGLGETPIXELMAPUSVPROC)&RecordingTableDecorator::m_glGetPixelMapusv_recording;
+if(this->m_ptr_glGetnColorTableARB)this->m_ptr_glGetnColorTableARB = (FunctionTable::MEMBERPFNGLGETNCOLORTABLEARBPROC)&RecordingTableDecorator::m_glGetnColorTableARB_recording;
+if(this->m_ptr_glAccum)this->m_ptr_glAccum = (FunctionTable::MEMBERPFNGLACCUMPROC)&RecordingTableDecorator::m_glAccum_recording;
+if(this->m_ptr_glRasterPos3sv)this->m_ptr_glRasterPos3sv = (FunctionTable::MEMBERPFNGLRASTERPOS3SVPROC)&RecordingTableDecorator::m_glRasterPos3sv_recording;
+if(this->m_ptr_glTexCoord2iv)this->m_ptr_glTexCoord2iv = (FunctionTable::MEMBERPFNGLTEXCOORD2IVPROC)&RecordingTableDecorator::m_glTexCoord2iv_recording;
+if(this->m_ptr_glBlendFunciARB)this->m_ptr_glBlendFunciARB = (FunctionTable::MEMBERPFNGLBLENDFUNCIARBPROC)&RecordingTableDecorator::m_glBlendFunciARB_recording;
+if(this->m_ptr_glProgramUniform3i64vARB)this->m_ptr_glProgramUniform3i64vARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3I64VARBPROC)&RecordingTableDecorator::m_glProgramUniform3i64vARB_recording;
+if(this->m_ptr_glGetFramebufferAttachmentParameteriv)this->m_ptr_glGetFramebufferAttachmentParameteriv = (FunctionTable::MEMBERPFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC)&RecordingTableDecorator::m_glGetFramebufferAttachmentParameteriv_recording;
+if(this->m_ptr_glProgramUniform4ui)this->m_ptr_glProgramUniform4ui = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UIPROC)&RecordingTableDecorator::m_glProgramUniform4ui_recording;
+if(this->m_ptr_glStencilMask)this->m_ptr_glStencilMask = (FunctionTable::MEMBERPFNGLSTENCILMASKPROC)&RecordingTableDecorator::m_glStencilMask_recording;
+if(this->m_ptr_glResetHistogramEXT)this->m_ptr_glResetHistogramEXT = (FunctionTable::MEMBERPFNGLRESETHISTOGRAMEXTPROC)&RecordingTableDecorator::m_glResetHistogramEXT_recording;
+if(this->m_ptr_glLightxOES)this->m_ptr_glLightxOES = (FunctionTable::MEMBERPFNGLLIGHTXOESPROC)&RecordingTableDecorator::m_glLightxOES_recording;
+if(this->m_ptr_glNamedBufferData)this->m_ptr_glNamedBufferData = (FunctionTable::MEMBERPFNGLNAMEDBUFFERDATAPROC)&RecordingTableDecorator::m_glNamedBufferData_recording;
+if(this->m_ptr_glVertexStream3sATI)this->m_ptr_glVertexStream3sATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM3SATIPROC)&RecordingTableDecorator::m_glVertexStream3sATI_recording;
+if(this->m_ptr_glVertexAttrib3fvARB)this->m_ptr_glVertexAttrib3fvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3FVARBPROC)&RecordingTableDecorator::m_glVertexAttrib3fvARB_recording;
+if(this->m_ptr_glClearNamedBufferSubData)this->m_ptr_glClearNamedBufferSubData = (FunctionTable::MEMBERPFNGLCLEARNAMEDBUFFERSUBDATAPROC)&RecordingTableDecorator::m_glClearNamedBufferSubData_recording;
+if(this->m_ptr_glProgramUniformHandleui64ARB)this->m_ptr_glProgramUniformHandleui64ARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMHANDLEUI64ARBPROC)&RecordingTableDecorator::m_glProgramUniformHandleui64ARB_recording;
+if(this->m_ptr_glUniform3iARB)this->m_ptr_glUniform3iARB = (FunctionTable::MEMBERPFNGLUNIFORM3IARBPROC)&RecordingTableDecorator::m_glUniform3iARB_recording;
+if(this->m_ptr_glCreateProgramObjectARB)this->m_ptr_glCreateProgramObjectARB = (FunctionTable::MEMBERPFNGLCREATEPROGRAMOBJECTARBPROC)&RecordingTableDecorator::m_glCreateProgramObjectARB_recording;
+if(this->m_ptr_glMultiTexCoord1dvARB)this->m_ptr_glMultiTexCoord1dvARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1DVARBPROC)&RecordingTableDecorator::m_glMultiTexCoord1dvARB_recording;
+if(this->m_ptr_glGetObjectParameterfvARB)this->m_ptr_glGetObjectParameterfvARB = (FunctionTable::MEMBERPFNGLGETOBJECTPARAMETERFVARBPROC)&RecordingTableDecorator::m_glGetObjectParameterfvARB_recording;
+if(this->m_ptr_glRectsv)this->m_ptr_glRectsv = (FunctionTable::MEMBERPFNGLRECTSVPROC)&RecordingTableDecorator::m_glRectsv_recording;
+if(this->m_ptr_glMultiTexImage2DEXT)this->m_ptr_glMultiTexImage2DEXT = (FunctionTable::MEMBERPFNGLMULTITEXIMAGE2DEXTPROC)&RecordingTableDecorator::m_glMultiTexImage2DEXT_recording;
+if(this->m_ptr_glProgramUniform1i64NV)this->m_ptr_glProgramUniform1i64NV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1I64NVPROC)&RecordingTableDecorator::m_glProgramUniform1i64NV_recording;
+if(this->m_ptr_glGetObjectBufferivATI)this->m_ptr_glGetObjectBufferivATI = (FunctionTable::MEMBERPFNGLGETOBJECTBUFFERIVATIPROC)&RecordingTableDecorator::m_glGetObjectBufferivATI_recording;
+if(this->m_ptr_glUniform4i64ARB)this->m_ptr_glUniform4i64ARB = (FunctionTable::MEMBERPFNGLUNIFORM4I64ARBPROC)&RecordingTableDecorator::m_glUniform4i64ARB_recording;
+if(this->m_ptr_glReplacementCodeuiColor4ubVertex3fvSUN)this->m_ptr_glReplacementCodeuiColor4ubVertex3fvSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUICOLOR4UBVERTEX3FVSUNPROC)&RecordingTableDecorator::m_glReplacementCodeuiColor4ubVertex3fvSUN_recording;
+if(this->m_ptr_glBlendFuncSeparateINGR)this->m_ptr_glBlendFuncSeparateINGR = (FunctionTable::MEMBERPFNGLBLENDFUNCSEPARATEINGRPROC)&RecordingTableDecorator::m_glBlendFuncSeparateINGR_recording;
+if(this->m_ptr_glGetVideoCaptureStreamfvNV)this->m_ptr_glGetVideoCaptureStreamfvNV = (FunctionTable::MEMBERPFNGLGETVIDEOCAPTURESTREAMFVNVPROC)&RecordingTableDecorator::m_glGetVideoCaptureStreamfvNV_recording;
+if(this->m_ptr_glVertexAttrib2fARB)this->m_ptr_glVertexAttrib2fARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2FARBPROC)&RecordingTableDecorator::m_glVertexAttrib2fARB_recording;
+if(this->m_ptr_glGetTexGeniv)this->m_ptr_glGetTexGeniv = (FunctionTable::MEMBERPFNGLGETTEXGENIVPROC)&RecordingTableDecorator::m_glGetTexGeniv_recording;
+if(this->m_ptr_glPixelStorei)this->m_ptr_glPixelStorei = (FunctionTable::MEMBERPFNGLPIXELSTOREIPROC)&RecordingTableDecorator::m_glPixelStorei_recording;
+if(this->m_ptr_glGetCompressedTextureSubImage)this->m_ptr_glGetCompressedTextureSubImage = (FunctionTable::MEMBERPFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC)&RecordingTableDecorator::m_glGetCompressedTextureSubImage_recording;
+if(this->m_ptr_glCopyImageSubDataNV)this->m_ptr_glCopyImageSubDataNV = (FunctionTable::MEMBERPFNGLCOPYIMAGESUBDATANVPROC)&RecordingTableDecorator::m_glCopyImageSubDataNV_recording;
+if(this->m_ptr_glActiveShaderProgram)this->m_ptr_glActiveShaderProgram = (FunctionTable::MEMBERPFNGLACTIVESHADERPROGRAMPROC)&RecordingTableDecorator::m_glActiveShaderProgram_recording;
+if(this->m_ptr_glVertexStream1iATI)this->m_ptr_glVertexStream1iATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM1IATIPROC)&RecordingTableDecorator::m_glVertexStream1iATI_recording;
+if(this->m_ptr_glPatchParameterfv)this->m_ptr_glPatchParameterfv = (FunctionTable::MEMBERPFNGLPATCHPARAMETERFVPROC)&RecordingTableDecorator::m_glPatchParameterfv_recording;
+if(this->m_ptr_glIsFramebufferEXT)this->m_ptr_glIsFramebufferEXT = (FunctionTable::MEMBERPFNGLISFRAMEBUFFEREXTPROC)&RecordingTableDecorator::m_glIsFramebufferEXT_recording;
+if(this->m_ptr_glTextureStorage2D)this->m_ptr_glTextureStorage2D = (FunctionTable::MEMBERPFNGLTEXTURESTORAGE2DPROC)&RecordingTableDecorator::m_glTextureStorage2D_recording;
+if(this->m_ptr_glProgramUniform1ui64ARB)this->m_ptr_glProgramUniform1ui64ARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UI64ARBPROC)&RecordingTableDecorator::m_glProgramUniform1ui64ARB_recording;
+if(this->m_ptr_glTexBufferRange)this->m_ptr_glTexBufferRange = (FunctionTable::MEMBERPFNGLTEXBUFFERRANGEPROC)&RecordingTableDecorator::m_glTexBufferRange_recording;
+if(this->m_ptr_glGetPixelTexGenParameterivSGIS)this->m_ptr_glGetPixelTexGenParameterivSGIS = (FunctionTable::MEMBERPFNGLGETPIXELTEXGENPARAMETERIVSGISPROC)&RecordingTableDecorator::m_glGetPixelTexGenParameterivSGIS_recording;
+if(this->m_ptr_glTextureSubImage3DEXT)this->m_ptr_glTextureSubImage3DEXT = (FunctionTable::MEMBERPFNGLTEXTURESUBIMAGE3DEXTPROC)&RecordingTableDecorator::m_glTextureSubImage3DEXT_recording;
+if(this->m_ptr_glClipControl)this->m_ptr_glClipControl = (FunctionTable::MEMBERPFNGLCLIPCONTROLPROC)&RecordingTableDecorator::m_glClipControl_recording;
+if(this->m_ptr_glGetProgramResourceiv)this->m_ptr_glGetProgramResourceiv = (FunctionTable::MEMBERPFNGLGETPROGRAMRESOURCEIVPROC)&RecordingTableDecorator::m_glGetProgramResourceiv_recording;
+if(this->m_ptr_glMultiTexCoordP2uiv)this->m_ptr_glMultiTexCoordP2uiv = (FunctionTable::MEMBERPFNGLMULTITEXCOORDP2UIVPROC)&RecordingTableDecorator::m_glMultiTexCoordP2uiv_recording;
+if(this->m_ptr_glVertexAttribI3ui)this->m_ptr_glVertexAttribI3ui = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI3UIPROC)&RecordingTableDecorator::m_glVertexAttribI3ui_recording;
+if(this->m_ptr_glSampleMaskSGIS)this->m_ptr_glSampleMaskSGIS = (FunctionTable::MEMBERPFNGLSAMPLEMASKSGISPROC)&RecordingTableDecorator::m_glSampleMaskSGIS_recording;
+if(this->m_ptr_glVertexAttrib4NivARB)this->m_ptr_glVertexAttrib4NivARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NIVARBPROC)&RecordingTableDecorator::m_glVertexAttrib4NivARB_recording;
+if(this->m_ptr_glGlobalAlphaFactorfSUN)this->m_ptr_glGlobalAlphaFactorfSUN = (FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORFSUNPROC)&RecordingTableDecorator::m_glGlobalAlphaFactorfSUN_recording;
+if(this->m_ptr_glBlendEquationSeparateIndexedAMD)this->m_ptr_glBlendEquationSeparateIndexedAMD = (FunctionTable::MEMBERPFNGLBLENDEQUATIONSEPARATEINDEXEDAMDPROC)&RecordingTableDecorator::m_glBlendEquationSeparateIndexedAMD_recording;
+if(this->m_ptr_glGetPerfCounterInfoINTEL)this->m_ptr_glGetPerfCounterInfoINTEL = (FunctionTable::MEMBERPFNGLGETPERFCOUNTERINFOINTELPROC)&RecordingTableDecorator::m_glGetPerfCounterInfoINTEL_recording;
+if(this->m_ptr_glDeleteProgramsNV)this->m_ptr_glDeleteProgramsNV = (FunctionTable::MEMBERPFNGLDELETEPROGRAMSNVPROC)&RecordingTableDecorator::m_glDeleteProgramsNV_recording;
+if(this->m_ptr_glPixelZoomxOES)this->m_ptr_glPixelZoomxOES = (FunctionTable::MEMBERPFNGLPIXELZOOMXOESPROC)&RecordingTableDecorator::m_glPixelZoomxOES_recording;
+if(this->m_ptr_glGetCombinerOutputParameterivNV)this->m_ptr_glGetCombinerOutputParameterivNV = (FunctionTable::MEMBERPFNGLGETCOMBINEROUTPUTPARAMETERIVNVPROC)&RecordingTableDecorator::m_glGetCombinerOutputParameterivNV_recording;
+if(this->m_ptr_glRasterPos2xvOES)this->m_ptr_glRasterPos2xvOES = (FunctionTable::MEMBERPFNGLRASTERPOS2XVOESPROC)&RecordingTableDecorator::m_glRasterPos2xvOES_recording;
+if(this->m_ptr_glGetTexImage)this->m_ptr_glGetTexImage = (FunctionTable::MEMBERPFNGLGETTEXIMAGEPROC)&RecordingTableDecorator::m_glGetTexImage_recording;
+if(this->m_ptr_glVertexArrayVertexBuffers)this->m_ptr_glVertexArrayVertexBuffers = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXBUFFERSPROC)&RecordingTableDecorator::m_glVertexArrayVertexBuffers_recording;
+if(this->m_ptr_glUniform1ui64NV)this->m_ptr_glUniform1ui64NV = (FunctionTable::MEMBERPFNGLUNIFORM1UI64NVPROC)&RecordingTableDecorator::m_glUniform1ui64NV_recording;
+if(this->m_ptr_glProgramParameteri)this->m_ptr_glProgramParameteri = (FunctionTable::MEMBERPFNGLPROGRAMPARAMETERIPROC)&RecordingTableDecorator::m_glProgramParameteri_recording;
+if(this->m_ptr_glNormal3xOES)this->m_ptr_glNormal3xOES = (FunctionTable::MEMBERPFNGLNORMAL3XOESPROC)&RecordingTableDecorator::m_glNormal3xOES_recording;
+if(this->m_ptr_glGetMapfv)this->m_ptr_glGetMapfv = (FunctionTable::MEMBERPFNGLGETMAPFVPROC)&RecordingTableDecorator::m_glGetMapfv_recording;
+if(this->m_ptr_glVertexStream2dvATI)this->m_ptr_glVertexStream2dvATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM2DVATIPROC)&RecordingTableDecorator::m_glVertexStream2dvATI_recording;
+if(this->m_ptr_glPathStencilDepthOffsetNV)this->m_ptr_glPathStencilDepthOffsetNV = (FunctionTable::MEMBERPFNGLPATHSTENCILDEPTHOFFSETNVPROC)&RecordingTableDecorator::m_glPathStencilDepthOffsetNV_recording;
+if(this->m_ptr_glIsStateNV)this->m_ptr_glIsStateNV = (FunctionTable::MEMBERPFNGLISSTATENVPROC)&RecordingTableDecorator::m_glIsStateNV_recording;
+if(this->m_ptr_glGetIntegerui64vNV)this->m_ptr_glGetIntegerui64vNV = (FunctionTable::MEMBERPFNGLGETINTEGERUI64VNVPROC)&RecordingTableDecorator::m_glGetIntegerui64vNV_recording;
+if(this->m_ptr_glGetImageTransformParameterfvHP)this->m_ptr_glGetImageTransformParameterfvHP = (FunctionTable::MEMBERPFNGLGETIMAGETRANSFORMPARAMETERFVHPPROC)&RecordingTableDecorator::m_glGetImageTransformParameterfvHP_recording;
+if(this->m_ptr_glRasterPos2fv)this->m_ptr_glRasterPos2fv = (FunctionTable::MEMBERPFNGLRASTERPOS2FVPROC)&RecordingTableDecorator::m_glRasterPos2fv_recording;
+if(this->m_ptr_glVertex3xOES)this->m_ptr_glVertex3xOES = (FunctionTable::MEMBERPFNGLVERTEX3XOESPROC)&RecordingTableDecorator::m_glVertex3xOES_recording;
+if(this->m_ptr_glProgramUniform2dvEXT)this->m_ptr_glProgramUniform2dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2DVEXTPROC)&RecordingTableDecorator::m_glProgramUniform2dvEXT_recording;
+if(this->m_ptr_glWeightPointerARB)this->m_ptr_glWeightPointerARB = (FunctionTable::MEMBERPFNGLWEIGHTPOINTERARBPROC)&RecordingTableDecorator::m_glWeightPointerARB_recording;
+if(this->m_ptr_glFinishFenceNV)this->m_ptr_glFinishFenceNV = (FunctionTable::MEMBERPFNGLFINISHFENCENVPROC)&RecordingTableDecorator::m_glFinishFenceNV_recording;
+if(this->m_ptr_glDepthRangexOES)this->m_ptr_glDepthRangexOES = (FunctionTable::MEMBERPFNGLDEPTHRANGEXOESPROC)&RecordingTableDecorator::m_glDepthRangexOES_recording;
+if(this->m_ptr_glEnableVertexArrayAttribEXT)this->m_ptr_glEnableVertexArrayAttribEXT = (FunctionTable::MEMBERPFNGLENABLEVERTEXARRAYATTRIBEXTPROC)&RecordingTableDecorator::m_glEnableVertexArrayAttribEXT_recording;
+if(this->m_ptr_glProgramUniform2uivEXT)this->m_ptr_glProgramUniform2uivEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UIVEXTPROC)&RecordingTableDecorator::m_glProgramUniform2uivEXT_recording;
+if(this->m_ptr_glGetDoubleIndexedvEXT)this->m_ptr_glGetDoubleIndexedvEXT = (FunctionTable::MEMBERPFNGLGETDOUBLEINDEXEDVEXTPROC)&RecordingTableDecorator::m_glGetDoubleIndexedvEXT_recording;
+if(this->m_ptr_glWindowPos2fMESA)this->m_ptr_glWindowPos2fMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS2FMESAPROC)&RecordingTableDecorator::m_glWindowPos2fMESA_recording;
+if(this->m_ptr_glSecondaryColor3b)this->m_ptr_glSecondaryColor3b = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3BPROC)&RecordingTableDecorator::m_glSecondaryColor3b_recording;
+if(this->m_ptr_glCopyConvolutionFilter1DEXT)this->m_ptr_glCopyConvolutionFilter1DEXT = (FunctionTable::MEMBERPFNGLCOPYCONVOLUTIONFILTER1DEXTPROC)&RecordingTableDecorator::m_glCopyConvolutionFilter1DEXT_recording;
+if(this->m_ptr_glWindowPos2sv)this->m_ptr_glWindowPos2sv = (FunctionTable::MEMBERPFNGLWINDOWPOS2SVPROC)&RecordingTableDecorator::m_glWindowPos2sv_recording;
+if(this->m_ptr_glBindFramebufferEXT)this->m_ptr_glBindFramebufferEXT = (FunctionTable::MEMBERPFNGLBINDFRAMEBUFFEREXTPROC)&RecordingTableDecorator::m_glBindFramebufferEXT_recording;
+if(this->m_ptr_glCreateShader)this->m_ptr_glCreateShader = (FunctionTable::MEMBERPFNGLCREATESHADERPROC)&RecordingTableDecorator::m_glCreateShader_recording;
+if(this->m_ptr_glGenPathsNV)this->m_ptr_glGenPathsNV = (FunctionTable::MEMBERPFNGLGENPATHSNVPROC)&RecordingTableDecorator::m_glGenPathsNV_recording;
+if(this->m_ptr_glGenRenderbuffers)this->m_ptr_glGenRenderbuffers = (FunctionTable::MEMBERPFNGLGENRENDERBUFFERSPROC)&RecordingTableDecorator::m_glGenRenderbuffers_recording;
+if(this->m_ptr_glCopyTexSubImage2D)this->m_ptr_glCopyTexSubImage2D = (FunctionTable::MEMBERPFNGLCOPYTEXSUBIMAGE2DPROC)&RecordingTableDecorator::m_glCopyTexSubImage2D_recording;
+if(this->m_ptr_glVertexAttrib4ubvARB)this->m_ptr_glVertexAttrib4ubvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4UBVARBPROC)&RecordingTableDecorator::m_glVertexAttrib4ubvARB_recording;
+if(this->m_ptr_glDrawTextureNV)this->m_ptr_glDrawTextureNV = (FunctionTable::MEMBERPFNGLDRAWTEXTURENVPROC)&RecordingTableDecorator::m_glDrawTextureNV_recording;
+if(this->m_ptr_glVertexAttribs1svNV)this->m_ptr_glVertexAttribs1svNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS1SVNVPROC)&RecordingTableDecorator::m_glVertexAttribs1svNV_recording;
+if(this->m_ptr_glClearNamedBufferSubDataEXT)this->m_ptr_glClearNamedBufferSubDataEXT = (FunctionTable::MEMBERPFNGLCLEARNAMEDBUFFERSUBDATAEXTPROC)&RecordingTableDecorator::m_glClearNamedBufferSubDataEXT_recording;
+if(this->m_ptr_glBlendFuncSeparate)this->m_ptr_glBlendFuncSeparate = (FunctionTable::MEMBERPFNGLBLENDFUNCSEPARATEPROC)&RecordingTableDecorator::m_glBlendFuncSeparate_recording;
+if(this->m_ptr_glPointParameterfARB)this->m_ptr_glPointParameterfARB = (FunctionTable::MEMBERPFNGLPOINTPARAMETERFARBPROC)&RecordingTableDecorator::m_glPointParameterfARB_recording;
+if(this->m_ptr_glTexCoord2fv)this->m_ptr_glTexCoord2fv = (FunctionTable::MEMBERPFNGLTEXCOORD2FVPROC)&RecordingTableDecorator::m_glTexCoord2fv_recording;
+if(this->m_ptr_glGetVariantFloatvEXT)this->m_ptr_glGetVariantFloatvEXT = (FunctionTable::MEMBERPFNGLGETVARIANTFLOATVEXTPROC)&RecordingTableDecorator::m_glGetVariantFloatvEXT_recording;
+if(this->m_ptr_glVertexP2ui)this->m_ptr_glVertexP2ui = (FunctionTable::MEMBERPFNGLVERTEXP2UIPROC)&RecordingTableDecorator::m_glVertexP2ui_recording;
+if(this->m_ptr_glWindowPos2dMESA)this->m_ptr_glWindowPos2dMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS2DMESAPROC)&RecordingTableDecorator::m_glWindowPos2dMESA_recording;
+if(this->m_ptr_glTexCoord4fv)this->m_ptr_glTexCoord4fv = (FunctionTable::MEMBERPFNGLTEXCOORD4FVPROC)&RecordingTableDecorator::m_glTexCoord4fv_recording;
+if(this->m_ptr_glBindFragDataLocationEXT)this->m_ptr_glBindFragDataLocationEXT = (FunctionTable::MEMBERPFNGLBINDFRAGDATALOCATIONEXTPROC)&RecordingTableDecorator::m_glBindFragDataLocationEXT_recording;
+if(this->m_ptr_glCompressedTexSubImage1DARB)this->m_ptr_glCompressedTexSubImage1DARB = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXSUBIMAGE1DARBPROC)&RecordingTableDecorator::m_glCompressedTexSubImage1DARB_recording;
+if(this->m_ptr_glGetTextureImageEXT)this->m_ptr_glGetTextureImageEXT = (FunctionTable::MEMBERPFNGLGETTEXTUREIMAGEEXTPROC)&RecordingTableDecorator::m_glGetTextureImageEXT_recording;
+if(this->m_ptr_glFogCoordd)this->m_ptr_glFogCoordd = (FunctionTable::MEMBERPFNGLFOGCOORDDPROC)&RecordingTableDecorator::m_glFogCoordd_recording;
+if(this->m_ptr_glPointSize)this->m_ptr_glPointSize = (FunctionTable::MEMBERPFNGLPOINTSIZEPROC)&RecordingTableDecorator::m_glPointSize_recording;
+if(this->m_ptr_glBindTextureUnit)this->m_ptr_glBindTextureUnit = (FunctionTable::MEMBERPFNGLBINDTEXTUREUNITPROC)&RecordingTableDecorator::m_glBindTextureUnit_recording;
+if(this->m_ptr_glProgramEnvParameterI4uiNV)this->m_ptr_glProgramEnvParameterI4uiNV = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERI4UINVPROC)&RecordingTableDecorator::m_glProgramEnvParameterI4uiNV_recording;
+if(this->m_ptr_glGetProgramPipelineInfoLog)this->m_ptr_glGetProgramPipelineInfoLog = (FunctionTable::MEMBERPFNGLGETPROGRAMPIPELINEINFOLOGPROC)&RecordingTableDecorator::m_glGetProgramPipelineInfoLog_recording;
+if(this->m_ptr_glProgramUniform4i64vARB)this->m_ptr_glProgramUniform4i64vARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4I64VARBPROC)&RecordingTableDecorator::m_glProgramUniform4i64vARB_recording;
+if(this->m_ptr_glVertexAttrib4Nuiv)this->m_ptr_glVertexAttrib4Nuiv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUIVPROC)&RecordingTableDecorator::m_glVertexAttrib4Nuiv_recording;
+if(this->m_ptr_glGetUniformfvARB)this->m_ptr_glGetUniformfvARB = (FunctionTable::MEMBERPFNGLGETUNIFORMFVARBPROC)&RecordingTableDecorator::m_glGetUniformfvARB_recording;
+if(this->m_ptr_glWaitSync)this->m_ptr_glWaitSync = (FunctionTable::MEMBERPFNGLWAITSYNCPROC)&RecordingTableDecorator::m_glWaitSync_recording;
+if(this->m_ptr_glUniform3i)this->m_ptr_glUniform3i = (FunctionTable::MEMBERPFNGLUNIFORM3IPROC)&RecordingTableDecorator::m_glUniform3i_recording;
+if(this->m_ptr_glBlendEquationSeparatei)this->m_ptr_glBlendEquationSeparatei = (FunctionTable::MEMBERPFNGLBLENDEQUATIONSEPARATEIPROC)&RecordingTableDecorator::m_glBlendEquationSeparatei_recording;
+if(this->m_ptr_glVertexAttrib2hvNV)this->m_ptr_glVertexAttrib2hvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2HVNVPROC)&RecordingTableDecorator::m_glVertexAttrib2hvNV_recording;
+if(this->m_ptr_glTextureParameterivEXT)this->m_ptr_glTextureParameterivEXT = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIVEXTPROC)&RecordingTableDecorator::m_glTextureParameterivEXT_recording;
+if(this->m_ptr_glUniform3d)this->m_ptr_glUniform3d = (FunctionTable::MEMBERPFNGLUNIFORM3DPROC)&RecordingTableDecorator::m_glUniform3d_recording;
+if(this->m_ptr_glUniform3f)this->m_ptr_glUniform3f = (FunctionTable::MEMBERPFNGLUNIFORM3FPROC)&RecordingTableDecorator::m_glUniform3f_recording;
+if(this->m_ptr_glActiveProgramEXT)this->m_ptr_glActiveProgramEXT = (FunctionTable::MEMBERPFNGLACTIVEPROGRAMEXTPROC)&RecordingTableDecorator::m_glActiveProgramEXT_recording;
+if(this->m_ptr_glDeleteVertexArrays)this->m_ptr_glDeleteVertexArrays = (FunctionTable::MEMBERPFNGLDELETEVERTEXARRAYSPROC)&RecordingTableDecorator::m_glDeleteVertexArrays_recording;
+if(this->m_ptr_glUniform3ui64vARB)this->m_ptr_glUniform3ui64vARB = (FunctionTable::MEMBERPFNGLUNIFORM3UI64VARBPROC)&RecordingTableDecorator::m_glUniform3ui64vARB_recording;
+if(this->m_ptr_glProgramUniform1ui64vARB)this->m_ptr_glProgramUniform1ui64vARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UI64VARBPROC)&RecordingTableDecorator::m_glProgramUniform1ui64vARB_recording;
+if(this->m_ptr_glTextureParameterfEXT)this->m_ptr_glTextureParameterfEXT = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERFEXTPROC)&RecordingTableDecorator::m_glTextureParameterfEXT_recording;
+if(this->m_ptr_glSetFragmentShaderConstantATI)this->m_ptr_glSetFragmentShaderConstantATI = (FunctionTable::MEMBERPFNGLSETFRAGMENTSHADERCONSTANTATIPROC)&RecordingTableDecorator::m_glSetFragmentShaderConstantATI_recording;
+if(this->m_ptr_glColorSubTable)this->m_ptr_glColorSubTable = (FunctionTable::MEMBERPFNGLCOLORSUBTABLEPROC)&RecordingTableDecorator::m_glColorSubTable_recording;
+if(this->m_ptr_glReplacementCodeuiSUN)this->m_ptr_glReplacementCodeuiSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUISUNPROC)&RecordingTableDecorator::m_glReplacementCodeuiSUN_recording;
+if(this->m_ptr_glStateCaptureNV)this->m_ptr_glStateCaptureNV = (FunctionTable::MEMBERPFNGLSTATECAPTURENVPROC)&RecordingTableDecorator::m_glStateCaptureNV_recording;
+if(this->m_ptr_glBindAttribLocation)this->m_ptr_glBindAttribLocation = (FunctionTable::MEMBERPFNGLBINDATTRIBLOCATIONPROC)&RecordingTableDecorator::m_glBindAttribLocation_recording;
+if(this->m_ptr_glWeightusvARB)this->m_ptr_glWeightusvARB = (FunctionTable::MEMBERPFNGLWEIGHTUSVARBPROC)&RecordingTableDecorator::m_glWeightusvARB_recording;
+if(this->m_ptr_glGetFragDataIndex)this->m_ptr_glGetFragDataIndex = (FunctionTable::MEMBERPFNGLGETFRAGDATAINDEXPROC)&RecordingTableDecorator::m_glGetFragDataIndex_recording;
+if(this->m_ptr_glMultiTexCoord2xOES)this->m_ptr_glMultiTexCoord2xOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2XOESPROC)&RecordingTableDecorator::m_glMultiTexCoord2xOES_recording;
+if(this->m_ptr_glColor3sv)this->m_ptr_glColor3sv = (FunctionTable::MEMBERPFNGLCOLOR3SVPROC)&RecordingTableDecorator::m_glColor3sv_recording;
+if(this->m_ptr_glTexCoord2fVertex3fSUN)this->m_ptr_glTexCoord2fVertex3fSUN = (FunctionTable::MEMBERPFNGLTEXCOORD2FVERTEX3FSUNPROC)&RecordingTableDecorator::m_glTexCoord2fVertex3fSUN_recording;
+if(this->m_ptr_glPolygonOffsetEXT)this->m_ptr_glPolygonOffsetEXT = (FunctionTable::MEMBERPFNGLPOLYGONOFFSETEXTPROC)&RecordingTableDecorator::m_glPolygonOffsetEXT_recording;
+if(this->m_ptr_glWeightPathsNV)this->m_ptr_glWeightPathsNV = (FunctionTable::MEMBERPFNGLWEIGHTPATHSNVPROC)&RecordingTableDecorator::m_glWeightPathsNV_recording;
+if(this->m_ptr_glCombinerStageParameterfvNV)this->m_ptr_glCombinerStageParameterfvNV = (FunctionTable::MEMBERPFNGLCOMBINERSTAGEPARAMETERFVNVPROC)&RecordingTableDecorator::m_glCombinerStageParameterfvNV_recording;
+if(this->m_ptr_glPointParameterfEXT)this->m_ptr_glPointParameterfEXT = (FunctionTable::MEMBERPFNGLPOINTPARAMETERFEXTPROC)&RecordingTableDecorator::m_glPointParameterfEXT_recording;
+if(this->m_ptr_glCopyTexImage1DEXT)this->m_ptr_glCopyTexImage1DEXT = (FunctionTable::MEMBERPFNGLCOPYTEXIMAGE1DEXTPROC)&RecordingTableDecorator::m_glCopyTexImage1DEXT_recording;
+if(this->m_ptr_glVertex4sv)this->m_ptr_glVertex4sv = (FunctionTable::MEMBERPFNGLVERTEX4SVPROC)&RecordingTableDecorator::m_glVertex4sv_recording;
+if(this->m_ptr_glMatrixMultfEXT)this->m_ptr_glMatrixMultfEXT = (FunctionTable::MEMBERPFNGLMATRIXMULTFEXTPROC)&RecordingTableDecorator::m_glMatrixMultfEXT_recording;
+if(this->m_ptr_glCompressedTextureSubImage3DEXT)this->m_ptr_glCompressedTextureSubImage3DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTURESUBIMAGE3DEXTPROC)&RecordingTableDecorator::m_glCompressedTextureSubImage3DEXT_recording;
+if(this->m_ptr_glGetTexLevelParameterxvOES)this->m_ptr_glGetTexLevelParameterxvOES = (FunctionTable::MEMBERPFNGLGETTEXLEVELPARAMETERXVOESPROC)&RecordingTableDecorator::m_glGetTexLevelParameterxvOES_recording;
+if(this->m_ptr_glVertexAttribL3dvEXT)this->m_ptr_glVertexAttribL3dvEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL3DVEXTPROC)&RecordingTableDecorator::m_glVertexAttribL3dvEXT_recording;
+if(this->m_ptr_glMultiTexCoordP4ui)this->m_ptr_glMultiTexCoordP4ui = (FunctionTable::MEMBERPFNGLMULTITEXCOORDP4UIPROC)&RecordingTableDecorator::m_glMultiTexCoordP4ui_recording;
+if(this->m_ptr_glGetTextureLevelParameterivEXT)this->m_ptr_glGetTextureLevelParameterivEXT = (FunctionTable::MEMBERPFNGLGETTEXTURELEVELPARAMETERIVEXTPROC)&RecordingTableDecorator::m_glGetTextureLevelParameterivEXT_recording;
+if(this->m_ptr_glAlphaFragmentOp2ATI)this->m_ptr_glAlphaFragmentOp2ATI = (FunctionTable::MEMBERPFNGLALPHAFRAGMENTOP2ATIPROC)&RecordingTableDecorator::m_glAlphaFragmentOp2ATI_recording;
+if(this->m_ptr_glDeleteFramebuffers)this->m_ptr_glDeleteFramebuffers = (FunctionTable::MEMBERPFNGLDELETEFRAMEBUFFERSPROC)&RecordingTableDecorator::m_glDeleteFramebuffers_recording;
+if(this->m_ptr_glDrawArrays)this->m_ptr_glDrawArrays = (FunctionTable::MEMBERPFNGLDRAWARRAYSPROC)&RecordingTableDecorator::m_glDrawArrays_recording;
+if(this->m_ptr_glGetTransformFeedbackiv)this->m_ptr_glGetTransformFeedbackiv = (FunctionTable::MEMBERPFNGLGETTRANSFORMFEEDBACKIVPROC)&RecordingTableDecorator::m_glGetTransformFeedbackiv_recording;
+if(this->m_ptr_glGetnTexImageARB)this->m_ptr_glGetnTexImageARB = (FunctionTable::MEMBERPFNGLGETNTEXIMAGEARBPROC)&RecordingTableDecorator::m_glGetnTexImageARB_recording;
+if(this->m_ptr_glClear)this->m_ptr_glClear = (FunctionTable::MEMBERPFNGLCLEARPROC)&RecordingTableDecorator::m_glClear_recording;
+if(this->m_ptr_glVertexArrayParameteriAPPLE)this->m_ptr_glVertexArrayParameteriAPPLE = (FunctionTable::MEMBERPFNGLVERTEXARRAYPARAMETERIAPPLEPROC)&RecordingTableDecorator::m_glVertexArrayParameteriAPPLE_recording;
+if(this->m_ptr_glMultiTexCoord2dvARB)this->m_ptr_glMultiTexCoord2dvARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2DVARBPROC)&RecordingTableDecorator::m_glMultiTexCoord2dvARB_recording;
+if(this->m_ptr_glGetVideoCaptureStreamdvNV)this->m_ptr_glGetVideoCaptureStreamdvNV = (FunctionTable::MEMBERPFNGLGETVIDEOCAPTURESTREAMDVNVPROC)&RecordingTableDecorator::m_glGetVideoCaptureStreamdvNV_recording;
+if(this->m_ptr_glFragmentLightModelivSGIX)this->m_ptr_glFragmentLightModelivSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTLIGHTMODELIVSGIXPROC)&RecordingTableDecorator::m_glFragmentLightModelivSGIX_recording;
+if(this->m_ptr_glVertexAttribP2ui)this->m_ptr_glVertexAttribP2ui = (FunctionTable::MEMBERPFNGLVERTEXATTRIBP2UIPROC)&RecordingTableDecorator::m_glVertexAttribP2ui_recording;
+if(this->m_ptr_glMultiTexCoordPointerEXT)this->m_ptr_glMultiTexCoordPointerEXT = (FunctionTable::MEMBERPFNGLMULTITEXCOORDPOINTEREXTPROC)&RecordingTableDecorator::m_glMultiTexCoordPointerEXT_recording;
+if(this->m_ptr_glProgramUniform3iEXT)this->m_ptr_glProgramUniform3iEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3IEXTPROC)&RecordingTableDecorator::m_glProgramUniform3iEXT_recording;
+if(this->m_ptr_glTranslatef)this->m_ptr_glTranslatef = (FunctionTable::MEMBERPFNGLTRANSLATEFPROC)&RecordingTableDecorator::m_glTranslatef_recording;
+if(this->m_ptr_glVertexAttrib4Nub)this->m_ptr_glVertexAttrib4Nub = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUBPROC)&RecordingTableDecorator::m_glVertexAttrib4Nub_recording;
+if(this->m_ptr_glTranslated)this->m_ptr_glTranslated = (FunctionTable::MEMBERPFNGLTRANSLATEDPROC)&RecordingTableDecorator::m_glTranslated_recording;
+if(this->m_ptr_glSamplerParameterIiv)this->m_ptr_glSamplerParameterIiv = (FunctionTable::MEMBERPFNGLSAMPLERPARAMETERIIVPROC)&RecordingTableDecorator::m_glSamplerParameterIiv_recording;
+if(this->m_ptr_glTexCoord4hNV)this->m_ptr_glTexCoord4hNV = (FunctionTable::MEMBERPFNGLTEXCOORD4HNVPROC)&RecordingTableDecorator::m_glTexCoord4hNV_recording;
+if(this->m_ptr_glDrawElementsIndirect)this->m_ptr_glDrawElementsIndirect = (FunctionTable::MEMBERPFNGLDRAWELEMENTSINDIRECTPROC)&RecordingTableDecorator::m_glDrawElementsIndirect_recording;
+if(this->m_ptr_glDeletePerfMonitorsAMD)this->m_ptr_glDeletePerfMonitorsAMD = (FunctionTable::MEMBERPFNGLDELETEPERFMONITORSAMDPROC)&RecordingTableDecorator::m_glDeletePerfMonitorsAMD_recording;
+if(this->m_ptr_glIsRenderbufferEXT)this->m_ptr_glIsRenderbufferEXT = (FunctionTable::MEMBERPFNGLISRENDERBUFFEREXTPROC)&RecordingTableDecorator::m_glIsRenderbufferEXT_recording;
+if(this->m_ptr_glDrawCommandsNV)this->m_ptr_glDrawCommandsNV = (FunctionTable::MEMBERPFNGLDRAWCOMMANDSNVPROC)&RecordingTableDecorator::m_glDrawCommandsNV_recording;
+if(this->m_ptr_glUniform3ivARB)this->m_ptr_glUniform3ivARB = (FunctionTable::MEMBERPFNGLUNIFORM3IVARBPROC)&RecordingTableDecorator::m_glUniform3ivARB_recording;
+if(this->m_ptr_glBufferSubData)this->m_ptr_glBufferSubData = (FunctionTable::MEMBERPFNGLBUFFERSUBDATAPROC)&RecordingTableDecorator::m_glBufferSubData_recording;
+if(this->m_ptr_glSecondaryColor3bv)this->m_ptr_glSecondaryColor3bv = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3BVPROC)&RecordingTableDecorator::m_glSecondaryColor3bv_recording;
+if(this->m_ptr_glMatrixMultTransposedEXT)this->m_ptr_glMatrixMultTransposedEXT = (FunctionTable::MEMBERPFNGLMATRIXMULTTRANSPOSEDEXTPROC)&RecordingTableDecorator::m_glMatrixMultTransposedEXT_recording;
+if(this->m_ptr_glRequestResidentProgramsNV)this->m_ptr_glRequestResidentProgramsNV = (FunctionTable::MEMBERPFNGLREQUESTRESIDENTPROGRAMSNVPROC)&RecordingTableDecorator::m_glRequestResidentProgramsNV_recording;
+if(this->m_ptr_glAlphaFragmentOp1ATI)this->m_ptr_glAlphaFragmentOp1ATI = (FunctionTable::MEMBERPFNGLALPHAFRAGMENTOP1ATIPROC)&RecordingTableDecorator::m_glAlphaFragmentOp1ATI_recording;
+if(this->m_ptr_glGetQueryObjecti64v)this->m_ptr_glGetQueryObjecti64v = (FunctionTable::MEMBERPFNGLGETQUERYOBJECTI64VPROC)&RecordingTableDecorator::m_glGetQueryObjecti64v_recording;
+if(this->m_ptr_glMatrixMult3x3fNV)this->m_ptr_glMatrixMult3x3fNV = (FunctionTable::MEMBERPFNGLMATRIXMULT3X3FNVPROC)&RecordingTableDecorator::m_glMatrixMult3x3fNV_recording;
+if(this->m_ptr_glColorTableParameteriv)this->m_ptr_glColorTableParameteriv = (FunctionTable::MEMBERPFNGLCOLORTABLEPARAMETERIVPROC)&RecordingTableDecorator::m_glColorTableParameteriv_recording;
+if(this->m_ptr_glPathSubCommandsNV)this->m_ptr_glPathSubCommandsNV = (FunctionTable::MEMBERPFNGLPATHSUBCOMMANDSNVPROC)&RecordingTableDecorator::m_glPathSubCommandsNV_recording;
+if(this->m_ptr_glGetFinalCombinerInputParameterivNV)this->m_ptr_glGetFinalCombinerInputParameterivNV = (FunctionTable::MEMBERPFNGLGETFINALCOMBINERINPUTPARAMETERIVNVPROC)&RecordingTableDecorator::m_glGetFinalCombinerInputParameterivNV_recording;
+if(this->m_ptr_glIsRenderbuffer)this->m_ptr_glIsRenderbuffer = (FunctionTable::MEMBERPFNGLISRENDERBUFFERPROC)&RecordingTableDecorator::m_glIsRenderbuffer_recording;
+if(this->m_ptr_glVertex3iv)this->m_ptr_glVertex3iv = (FunctionTable::MEMBERPFNGLVERTEX3IVPROC)&RecordingTableDecorator::m_glVertex3iv_recording;
+if(this->m_ptr_glTexGenfv)this->m_ptr_glTexGenfv = (FunctionTable::MEMBERPFNGLTEXGENFVPROC)&RecordingTableDecorator::m_glTexGenfv_recording;
+if(this->m_ptr_glFrustumfOES)this->m_ptr_glFrustumfOES = (FunctionTable::MEMBERPFNGLFRUSTUMFOESPROC)&RecordingTableDecorator::m_glFrustumfOES_recording;
+if(this->m_ptr_glBindVertexBuffers)this->m_ptr_glBindVertexBuffers = (FunctionTable::MEMBERPFNGLBINDVERTEXBUFFERSPROC)&RecordingTableDecorator::m_glBindVertexBuffers_recording;
+if(this->m_ptr_glMateriali)this->m_ptr_glMateriali = (FunctionTable::MEMBERPFNGLMATERIALIPROC)&RecordingTableDecorator::m_glMateriali_recording;
+if(this->m_ptr_glMultiTexCoord2svARB)this->m_ptr_glMultiTexCoord2svARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2SVARBPROC)&RecordingTableDecorator::m_glMultiTexCoord2svARB_recording;
+if(this->m_ptr_glDisableVertexAttribArray)this->m_ptr_glDisableVertexAttribArray = (FunctionTable::MEMBERPFNGLDISABLEVERTEXATTRIBARRAYPROC)&RecordingTableDecorator::m_glDisableVertexAttribArray_recording;
+if(this->m_ptr_glWindowPos3ivARB)this->m_ptr_glWindowPos3ivARB = (FunctionTable::MEMBERPFNGLWINDOWPOS3IVARBPROC)&RecordingTableDecorator::m_glWindowPos3ivARB_recording;
+if(this->m_ptr_glTexCoordFormatNV)this->m_ptr_glTexCoordFormatNV = (FunctionTable::MEMBERPFNGLTEXCOORDFORMATNVPROC)&RecordingTableDecorator::m_glTexCoordFormatNV_recording;
+if(this->m_ptr_glBlitNamedFramebuffer)this->m_ptr_glBlitNamedFramebuffer = (FunctionTable::MEMBERPFNGLBLITNAMEDFRAMEBUFFERPROC)&RecordingTableDecorator::m_glBlitNamedFramebuffer_recording;
+if(this->m_ptr_glMatrixLoadTransposefEXT)this->m_ptr_glMatrixLoadTransposefEXT = (FunctionTable::MEMBERPFNGLMATRIXLOADTRANSPOSEFEXTPROC)&RecordingTableDecorator::m_glMatrixLoadTransposefEXT_recording;
+if(this->m_ptr_glMultiTexGenfEXT)this->m_ptr_glMultiTexGenfEXT = (FunctionTable::MEMBERPFNGLMULTITEXGENFEXTPROC)&RecordingTableDecorator::m_glMultiTexGenfEXT_recording;
+if(this->m_ptr_glShaderStorageBlockBinding)this->m_ptr_glShaderStorageBlockBinding = (FunctionTable::MEMBERPFNGLSHADERSTORAGEBLOCKBINDINGPROC)&RecordingTableDecorator::m_glShaderStorageBlockBinding_recording;
+if(this->m_ptr_glMaterialf)this->m_ptr_glMaterialf = (FunctionTable::MEMBERPFNGLMATERIALFPROC)&RecordingTableDecorator::m_glMaterialf_recording;
+if(this->m_ptr_glReplacementCodeuiColor4fNormal3fVertex3fSUN)this->m_ptr_glReplacementCodeuiColor4fNormal3fVertex3fSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUICOLOR4FNORMAL3FVERTEX3FSUNPROC)&RecordingTableDecorator::m_glReplacementCodeuiColor4fNormal3fVertex3fSUN_recording;
+if(this->m_ptr_glCheckNamedFramebufferStatusEXT)this->m_ptr_glCheckNamedFramebufferStatusEXT = (FunctionTable::MEMBERPFNGLCHECKNAMEDFRAMEBUFFERSTATUSEXTPROC)&RecordingTableDecorator::m_glCheckNamedFramebufferStatusEXT_recording;
+if(this->m_ptr_glVertexArrayVertexAttribFormatEXT)this->m_ptr_glVertexArrayVertexAttribFormatEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBFORMATEXTPROC)&RecordingTableDecorator::m_glVertexArrayVertexAttribFormatEXT_recording;
+if(this->m_ptr_glVertex2hNV)this->m_ptr_glVertex2hNV = (FunctionTable::MEMBERPFNGLVERTEX2HNVPROC)&RecordingTableDecorator::m_glVertex2hNV_recording;
+if(this->m_ptr_glDeleteVertexShaderEXT)this->m_ptr_glDeleteVertexShaderEXT = (FunctionTable::MEMBERPFNGLDELETEVERTEXSHADEREXTPROC)&RecordingTableDecorator::m_glDeleteVertexShaderEXT_recording;
+if(this->m_ptr_glTexImage3DEXT)this->m_ptr_glTexImage3DEXT = (FunctionTable::MEMBERPFNGLTEXIMAGE3DEXTPROC)&RecordingTableDecorator::m_glTexImage3DEXT_recording;
+if(this->m_ptr_glProgramLocalParameterI4ivNV)this->m_ptr_glProgramLocalParameterI4ivNV = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERI4IVNVPROC)&RecordingTableDecorator::m_glProgramLocalParameterI4ivNV_recording;
+if(this->m_ptr_glGlobalAlphaFactoriSUN)this->m_ptr_glGlobalAlphaFactoriSUN = (FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORISUNPROC)&RecordingTableDecorator::m_glGlobalAlphaFactoriSUN_recording;
+if(this->m_ptr_glTextureStorage1D)this->m_ptr_glTextureStorage1D = (FunctionTable::MEMBERPFNGLTEXTURESTORAGE1DPROC)&RecordingTableDecorator::m_glTextureStorage1D_recording;
+if(this->m_ptr_glBinormal3sEXT)this->m_ptr_glBinormal3sEXT = (FunctionTable::MEMBERPFNGLBINORMAL3SEXTPROC)&RecordingTableDecorator::m_glBinormal3sEXT_recording;
+if(this->m_ptr_glGetProgramInterfaceiv)this->m_ptr_glGetProgramInterfaceiv = (FunctionTable::MEMBERPFNGLGETPROGRAMINTERFACEIVPROC)&RecordingTableDecorator::m_glGetProgramInterfaceiv_recording;
+if(this->m_ptr_glMatrixIndexPointerARB)this->m_ptr_glMatrixIndexPointerARB = (FunctionTable::MEMBERPFNGLMATRIXINDEXPOINTERARBPROC)&RecordingTableDecorator::m_glMatrixIndexPointerARB_recording;
+if(this->m_ptr_glTexCoordPointerEXT)this->m_ptr_glTexCoordPointerEXT = (FunctionTable::MEMBERPFNGLTEXCOORDPOINTEREXTPROC)&RecordingTableDecorator::m_glTexCoordPointerEXT_recording;
+if(this->m_ptr_glMultiTexGeniEXT)this->m_ptr_glMultiTexGeniEXT = (FunctionTable::MEMBERPFNGLMULTITEXGENIEXTPROC)&RecordingTableDecorator::m_glMultiTexGeniEXT_recording;
+if(this->m_ptr_glVertexAttrib2fNV)this->m_ptr_glVertexAttrib2fNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2FNVPROC)&RecordingTableDecorator::m_glVertexAttrib2fNV_recording;
+if(this->m_ptr_glNamedProgramStringEXT)this->m_ptr_glNamedProgramStringEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMSTRINGEXTPROC)&RecordingTableDecorator::m_glNamedProgramStringEXT_recording;
+if(this->m_ptr_glMapNamedBuffer)this->m_ptr_glMapNamedBuffer = (FunctionTable::MEMBERPFNGLMAPNAMEDBUFFERPROC)&RecordingTableDecorator::m_glMapNamedBuffer_recording;
+if(this->m_ptr_glGetMinmaxParameteriv)this->m_ptr_glGetMinmaxParameteriv = (FunctionTable::MEMBERPFNGLGETMINMAXPARAMETERIVPROC)&RecordingTableDecorator::m_glGetMinmaxParameteriv_recording;
+if(this->m_ptr_glGetnUniformdv)this->m_ptr_glGetnUniformdv = (FunctionTable::MEMBERPFNGLGETNUNIFORMDVPROC)&RecordingTableDecorator::m_glGetnUniformdv_recording;
+if(this->m_ptr_glEndConditionalRenderNVX)this->m_ptr_glEndConditionalRenderNVX = (FunctionTable::MEMBERPFNGLENDCONDITIONALRENDERNVXPROC)&RecordingTableDecorator::m_glEndConditionalRenderNVX_recording;
+if(this->m_ptr_glBinormal3fEXT)this->m_ptr_glBinormal3fEXT = (FunctionTable::MEMBERPFNGLBINORMAL3FEXTPROC)&RecordingTableDecorator::m_glBinormal3fEXT_recording;
+if(this->m_ptr_glNormalStream3iATI)this->m_ptr_glNormalStream3iATI = (FunctionTable::MEMBERPFNGLNORMALSTREAM3IATIPROC)&RecordingTableDecorator::m_glNormalStream3iATI_recording;
+if(this->m_ptr_glProgramBufferParametersIivNV)this->m_ptr_glProgramBufferParametersIivNV = (FunctionTable::MEMBERPFNGLPROGRAMBUFFERPARAMETERSIIVNVPROC)&RecordingTableDecorator::m_glProgramBufferParametersIivNV_recording;
+if(this->m_ptr_glMapGrid1xOES)this->m_ptr_glMapGrid1xOES = (FunctionTable::MEMBERPFNGLMAPGRID1XOESPROC)&RecordingTableDecorator::m_glMapGrid1xOES_recording;
+if(this->m_ptr_glGetVertexAttribPointervARB)this->m_ptr_glGetVertexAttribPointervARB = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBPOINTERVARBPROC)&RecordingTableDecorator::m_glGetVertexAttribPointervARB_recording;
+if(this->m_ptr_glFlushMappedNamedBufferRangeEXT)this->m_ptr_glFlushMappedNamedBufferRangeEXT = (FunctionTable::MEMBERPFNGLFLUSHMAPPEDNAMEDBUFFERRANGEEXTPROC)&RecordingTableDecorator::m_glFlushMappedNamedBufferRangeEXT_recording;
+if(this->m_ptr_glGetVertexAttribIiv)this->m_ptr_glGetVertexAttribIiv = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBIIVPROC)&RecordingTableDecorator::m_glGetVertexAttribIiv_recording;
+if(this->m_ptr_glVertexP4uiv)this->m_ptr_glVertexP4uiv = (FunctionTable::MEMBERPFNGLVERTEXP4UIVPROC)&RecordingTableDecorator::m_glVertexP4uiv_recording;
+if(this->m_ptr_glUniformui64NV)this->m_ptr_glUniformui64NV = (FunctionTable::MEMBERPFNGLUNIFORMUI64NVPROC)&RecordingTableDecorator::m_glUniformui64NV_recording;
+if(this->m_ptr_glColor4fv)this->m_ptr_glColor4fv = (FunctionTable::MEMBERPFNGLCOLOR4FVPROC)&RecordingTableDecorator::m_glColor4fv_recording;
+if(this->m_ptr_glTexParameterxvOES)this->m_ptr_glTexParameterxvOES = (FunctionTable::MEMBERPFNGLTEXPARAMETERXVOESPROC)&RecordingTableDecorator::m_glTexParameterxvOES_recording;
+if(this->m_ptr_glPatchParameteri)this->m_ptr_glPatchParameteri = (FunctionTable::MEMBERPFNGLPATCHPARAMETERIPROC)&RecordingTableDecorator::m_glPatchParameteri_recording;
+if(this->m_ptr_glMap1d)this->m_ptr_glMap1d = (FunctionTable::MEMBERPFNGLMAP1DPROC)&RecordingTableDecorator::m_glMap1d_recording;
+if(this->m_ptr_glGetTexFilterFuncSGIS)this->m_ptr_glGetTexFilterFuncSGIS = (FunctionTable::MEMBERPFNGLGETTEXFILTERFUNCSGISPROC)&RecordingTableDecorator::m_glGetTexFilterFuncSGIS_recording;
+if(this->m_ptr_glGetTexParameteriv)this->m_ptr_glGetTexParameteriv = (FunctionTable::MEMBERPFNGLGETTEXPARAMETERIVPROC)&RecordingTableDecorator::m_glGetTexParameteriv_recording;
+if(this->m_ptr_glVertexArrayVertexBindingDivisorEXT)this->m_ptr_glVertexArrayVertexBindingDivisorEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXBINDINGDIVISOREXTPROC)&RecordingTableDecorator::m_glVertexArrayVertexBindingDivisorEXT_recording;
+if(this->m_ptr_glMultiTexCoord3svARB)this->m_ptr_glMultiTexCoord3svARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3SVARBPROC)&RecordingTableDecorator::m_glMultiTexCoord3svARB_recording;
+if(this->m_ptr_glBindProgramNV)this->m_ptr_glBindProgramNV = (FunctionTable::MEMBERPFNGLBINDPROGRAMNVPROC)&RecordingTableDecorator::m_glBindProgramNV_recording;
+if(this->m_ptr_glGetConvolutionParameteriv)this->m_ptr_glGetConvolutionParameteriv = (FunctionTable::MEMBERPFNGLGETCONVOLUTIONPARAMETERIVPROC)&RecordingTableDecorator::m_glGetConvolutionParameteriv_recording;
+if(this->m_ptr_glGetProgramLocalParameterfvARB)this->m_ptr_glGetProgramLocalParameterfvARB = (FunctionTable::MEMBERPFNGLGETPROGRAMLOCALPARAMETERFVARBPROC)&RecordingTableDecorator::m_glGetProgramLocalParameterfvARB_recording;
+if(this->m_ptr_glGenFragmentShadersATI)this->m_ptr_glGenFragmentShadersATI = (FunctionTable::MEMBERPFNGLGENFRAGMENTSHADERSATIPROC)&RecordingTableDecorator::m_glGenFragmentShadersATI_recording;
+if(this->m_ptr_glTexBumpParameterivATI)this->m_ptr_glTexBumpParameterivATI = (FunctionTable::MEMBERPFNGLTEXBUMPPARAMETERIVATIPROC)&RecordingTableDecorator::m_glTexBumpParameterivATI_recording;
+if(this->m_ptr_glGetNamedFramebufferAttachmentParameteriv)this->m_ptr_glGetNamedFramebufferAttachmentParameteriv = (FunctionTable::MEMBERPFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC)&RecordingTableDecorator::m_glGetNamedFramebufferAttachmentParameteriv_recording;
+if(this->m_ptr_glGetnSeparableFilter)this->m_ptr_glGetnSeparableFilter = (FunctionTable::MEMBERPFNGLGETNSEPARABLEFILTERPROC)&RecordingTableDecorator::m_glGetnSeparableFilter_recording;
+if(this->m_ptr_glNormal3xvOES)this->m_ptr_glNormal3xvOES = (FunctionTable::MEMBERPFNGLNORMAL3XVOESPROC)&RecordingTableDecorator::m_glNormal3xvOES_recording;
+if(this->m_ptr_glPassTexCoordATI)this->m_ptr_glPassTexCoordATI = (FunctionTable::MEMBERPFNGLPASSTEXCOORDATIPROC)&RecordingTableDecorator::m_glPassTexCoordATI_recording;
+if(this->m_ptr_glFramebufferTextureFaceARB)this->m_ptr_glFramebufferTextureFaceARB = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTUREFACEARBPROC)&RecordingTableDecorator::m_glFramebufferTextureFaceARB_recording;
+if(this->m_ptr_glProgramUniform1dv)this->m_ptr_glProgramUniform1dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1DVPROC)&RecordingTableDecorator::m_glProgramUniform1dv_recording;
+if(this->m_ptr_glTextureStorage2DEXT)this->m_ptr_glTextureStorage2DEXT = (FunctionTable::MEMBERPFNGLTEXTURESTORAGE2DEXTPROC)&RecordingTableDecorator::m_glTextureStorage2DEXT_recording;
+if(this->m_ptr_glVertexArrayFogCoordOffsetEXT)this->m_ptr_glVertexArrayFogCoordOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYFOGCOORDOFFSETEXTPROC)&RecordingTableDecorator::m_glVertexArrayFogCoordOffsetEXT_recording;
+if(this->m_ptr_glDeleteNamedStringARB)this->m_ptr_glDeleteNamedStringARB = (FunctionTable::MEMBERPFNGLDELETENAMEDSTRINGARBPROC)&RecordingTableDecorator::m_glDeleteNamedStringARB_recording;
+if(this->m_ptr_glGenOcclusionQueriesNV)this->m_ptr_glGenOcclusionQueriesNV = (FunctionTable::MEMBERPFNGLGENOCCLUSIONQUERIESNVPROC)&RecordingTableDecorator::m_glGenOcclusionQueriesNV_recording;
+if(this->m_ptr_glLighti)this->m_ptr_glLighti = (FunctionTable::MEMBERPFNGLLIGHTIPROC)&RecordingTableDecorator::m_glLighti_recording;
+if(this->m_ptr_glTexImage1D)this->m_ptr_glTexImage1D = (FunctionTable::MEMBERPFNGLTEXIMAGE1DPROC)&RecordingTableDecorator::m_glTexImage1D_recording;
+if(this->m_ptr_glLightf)this->m_ptr_glLightf = (FunctionTable::MEMBERPFNGLLIGHTFPROC)&RecordingTableDecorator::m_glLightf_recording;
+if(this->m_ptr_glClientAttribDefaultEXT)this->m_ptr_glClientAttribDefaultEXT = (FunctionTable::MEMBERPFNGLCLIENTATTRIBDEFAULTEXTPROC)&RecordingTableDecorator::m_glClientAttribDefaultEXT_recording;
+if(this->m_ptr_glVertexAttrib4bvARB)this->m_ptr_glVertexAttrib4bvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4BVARBPROC)&RecordingTableDecorator::m_glVertexAttrib4bvARB_recording;
+if(this->m_ptr_glVertexAttribIFormatNV)this->m_ptr_glVertexAttribIFormatNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBIFORMATNVPROC)&RecordingTableDecorator::m_glVertexAttribIFormatNV_recording;
+if(this->m_ptr_glStencilFuncSeparate)this->m_ptr_glStencilFuncSeparate = (FunctionTable::MEMBERPFNGLSTENCILFUNCSEPARATEPROC)&RecordingTableDecorator::m_glStencilFuncSeparate_recording;
+if(this->m_ptr_glGetVertexAttribfvARB)this->m_ptr_glGetVertexAttribfvARB = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBFVARBPROC)&RecordingTableDecorator::m_glGetVertexAttribfvARB_recording;
+if(this->m_ptr_glVertexAttrib2dNV)this->m_ptr_glVertexAttrib2dNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2DNVPROC)&RecordingTableDecorator::m_glVertexAttrib2dNV_recording;
+if(this->m_ptr_glProgramUniform2iEXT)this->m_ptr_glProgramUniform2iEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2IEXTPROC)&RecordingTableDecorator::m_glProgramUniform2iEXT_recording;
+if(this->m_ptr_glClientActiveVertexStreamATI)this->m_ptr_glClientActiveVertexStreamATI = (FunctionTable::MEMBERPFNGLCLIENTACTIVEVERTEXSTREAMATIPROC)&RecordingTableDecorator::m_glClientActiveVertexStreamATI_recording;
+if(this->m_ptr_glRasterPos3xOES)this->m_ptr_glRasterPos3xOES = (FunctionTable::MEMBERPFNGLRASTERPOS3XOESPROC)&RecordingTableDecorator::m_glRasterPos3xOES_recording;
+if(this->m_ptr_glGetMapParameterivNV)this->m_ptr_glGetMapParameterivNV = (FunctionTable::MEMBERPFNGLGETMAPPARAMETERIVNVPROC)&RecordingTableDecorator::m_glGetMapParameterivNV_recording;
+if(this->m_ptr_glSampleCoverage)this->m_ptr_glSampleCoverage = (FunctionTable::MEMBERPFNGLSAMPLECOVERAGEPROC)&RecordingTableDecorator::m_glSampleCoverage_recording;
+if(this->m_ptr_glClearDepthxOES)this->m_ptr_glClearDepthxOES = (FunctionTable::MEMBERPFNGLCLEARDEPTHXOESPROC)&RecordingTableDecorator::m_glClearDepthxOES_recording;
+if(this->m_ptr_glTexCoord2fNormal3fVertex3fvSUN)this->m_ptr_glTexCoord2fNormal3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLTEXCOORD2FNORMAL3FVERTEX3FVSUNPROC)&RecordingTableDecorator::m_glTexCoord2fNormal3fVertex3fvSUN_recording;
+if(this->m_ptr_glGetFirstPerfQueryIdINTEL)this->m_ptr_glGetFirstPerfQueryIdINTEL = (FunctionTable::MEMBERPFNGLGETFIRSTPERFQUERYIDINTELPROC)&RecordingTableDecorator::m_glGetFirstPerfQueryIdINTEL_recording;
+if(this->m_ptr_glUnmapNamedBufferEXT)this->m_ptr_glUnmapNamedBufferEXT = (FunctionTable::MEMBERPFNGLUNMAPNAMEDBUFFEREXTPROC)&RecordingTableDecorator::m_glUnmapNamedBufferEXT_recording;
+if(this->m_ptr_glGetTransformFeedbacki_v)this->m_ptr_glGetTransformFeedbacki_v = (FunctionTable::MEMBERPFNGLGETTRANSFORMFEEDBACKI_VPROC)&RecordingTableDecorator::m_glGetTransformFeedbacki_v_recording;
+if(this->m_ptr_glUniform4fvARB)this->m_ptr_glUniform4fvARB = (FunctionTable::MEMBERPFNGLUNIFORM4FVARBPROC)&RecordingTableDecorator::m_glUniform4fvARB_recording;
+if(this->m_ptr_glRenderbufferStorageMultisampleCoverageNV)this->m_ptr_glRenderbufferStorageMultisampleCoverageNV = (FunctionTable::MEMBERPFNGLRENDERBUFFERSTORAGEMULTISAMPLECOVERAGENVPROC)&RecordingTableDecorator::m_glRenderbufferStorageMultisampleCoverageNV_recording;
+if(this->m_ptr_glGetFloati_vEXT)this->m_ptr_glGetFloati_vEXT = (FunctionTable::MEMBERPFNGLGETFLOATI_VEXTPROC)&RecordingTableDecorator::m_glGetFloati_vEXT_recording;
+if(this->m_ptr_glBindAttribLocationARB)this->m_ptr_glBindAttribLocationARB = (FunctionTable::MEMBERPFNGLBINDATTRIBLOCATIONARBPROC)&RecordingTableDecorator::m_glBindAttribLocationARB_recording;
+if(this->m_ptr_glBufferAddressRangeNV)this->m_ptr_glBufferAddressRangeNV = (FunctionTable::MEMBERPFNGLBUFFERADDRESSRANGENVPROC)&RecordingTableDecorator::m_glBufferAddressRangeNV_recording;
+if(this->m_ptr_glGenProgramsARB)this->m_ptr_glGenProgramsARB = (FunctionTable::MEMBERPFNGLGENPROGRAMSARBPROC)&RecordingTableDecorator::m_glGenProgramsARB_recording;
+if(this->m_ptr_glMultiTexEnvivEXT)this->m_ptr_glMultiTexEnvivEXT = (FunctionTable::MEMBERPFNGLMULTITEXENVIVEXTPROC)&RecordingTableDecorator::m_glMultiTexEnvivEXT_recording;
+if(this->m_ptr_glSecondaryColor3uiEXT)this->m_ptr_glSecondaryColor3uiEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UIEXTPROC)&RecordingTableDecorator::m_glSecondaryColor3uiEXT_recording;
+if(this->m_ptr_glCompressedTextureImage2DEXT)this->m_ptr_glCompressedTextureImage2DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTUREIMAGE2DEXTPROC)&RecordingTableDecorator::m_glCompressedTextureImage2DEXT_recording;
+if(this->m_ptr_glUniform2i)this->m_ptr_glUniform2i = (FunctionTable::MEMBERPFNGLUNIFORM2IPROC)&RecordingTableDecorator::m_glUniform2i_recording;
+if(this->m_ptr_glCopyTexImage2DEXT)this->m_ptr_glCopyTexImage2DEXT = (FunctionTable::MEMBERPFNGLCOPYTEXIMAGE2DEXTPROC)&RecordingTableDecorator::m_glCopyTexImage2DEXT_recording;
+if(this->m_ptr_glUniform2d)this->m_ptr_glUniform2d = (FunctionTable::MEMBERPFNGLUNIFORM2DPROC)&RecordingTableDecorator::m_glUniform2d_recording;
+if(this->m_ptr_glVertexAttribL1d)this->m_ptr_glVertexAttribL1d = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL1DPROC)&RecordingTableDecorator::m_glVertexAttribL1d_recording;
+if(this->m_ptr_glFramebufferTextureFaceEXT)this->m_ptr_glFramebufferTextureFaceEXT = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTUREFACEEXTPROC)&RecordingTableDecorator::m_glFramebufferTextureFaceEXT_recording;
+if(this->m_ptr_glFramebufferTextureLayer)this->m_ptr_glFramebufferTextureLayer = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURELAYERPROC)&RecordingTableDecorator::m_glFramebufferTextureLayer_recording;
+if(this->m_ptr_glMultiTexCoord4bvOES)this->m_ptr_glMultiTexCoord4bvOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4BVOESPROC)&RecordingTableDecorator::m_glMultiTexCoord4bvOES_recording;
+if(this->m_ptr_glGetVertexArrayPointeri_vEXT)this->m_ptr_glGetVertexArrayPointeri_vEXT = (FunctionTable::MEMBERPFNGLGETVERTEXARRAYPOINTERI_VEXTPROC)&RecordingTableDecorator::m_glGetVertexArrayPointeri_vEXT_recording;
+if(this->m_ptr_glNamedProgramLocalParameter4dEXT)this->m_ptr_glNamedProgramLocalParameter4dEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETER4DEXTPROC)&RecordingTableDecorator::m_glNamedProgramLocalParameter4dEXT_recording;
+if(this->m_ptr_glBinormal3bEXT)this->m_ptr_glBinormal3bEXT = (FunctionTable::MEMBERPFNGLBINORMAL3BEXTPROC)&RecordingTableDecorator::m_glBinormal3bEXT_recording;
+if(this->m_ptr_glConvolutionFilter2DEXT)this->m_ptr_glConvolutionFilter2DEXT = (FunctionTable::MEMBERPFNGLCONVOLUTIONFILTER2DEXTPROC)&RecordingTableDecorator::m_glConvolutionFilter2DEXT_recording;
+if(this->m_ptr_glProgramUniform2fv)this->m_ptr_glProgramUniform2fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2FVPROC)&RecordingTableDecorator::m_glProgramUniform2fv_recording;
+if(this->m_ptr_glColor3fVertex3fSUN)this->m_ptr_glColor3fVertex3fSUN = (FunctionTable::MEMBERPFNGLCOLOR3FVERTEX3FSUNPROC)&RecordingTableDecorator::m_glColor3fVertex3fSUN_recording;
+if(this->m_ptr_glNormal3fVertex3fvSUN)this->m_ptr_glNormal3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLNORMAL3FVERTEX3FVSUNPROC)&RecordingTableDecorator::m_glNormal3fVertex3fvSUN_recording;
+if(this->m_ptr_glCopyMultiTexSubImage3DEXT)this->m_ptr_glCopyMultiTexSubImage3DEXT = (FunctionTable::MEMBERPFNGLCOPYMULTITEXSUBIMAGE3DEXTPROC)&RecordingTableDecorator::m_glCopyMultiTexSubImage3DEXT_recording;
+if(this->m_ptr_glProgramLocalParameterI4iNV)this->m_ptr_glProgramLocalParameterI4iNV = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERI4INVPROC)&RecordingTableDecorator::m_glProgramLocalParameterI4iNV_recording;
+if(this->m_ptr_glProgramUniformMatrix2x4dv)this->m_ptr_glProgramUniformMatrix2x4dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X4DVPROC)&RecordingTableDecorator::m_glProgramUniformMatrix2x4dv_recording;
+if(this->m_ptr_glPathMemoryGlyphIndexArrayNV)this->m_ptr_glPathMemoryGlyphIndexArrayNV = (FunctionTable::MEMBERPFNGLPATHMEMORYGLYPHINDEXARRAYNVPROC)&RecordingTableDecorator::m_glPathMemoryGlyphIndexArrayNV_recording;
+if(this->m_ptr_glDrawArraysEXT)this->m_ptr_glDrawArraysEXT = (FunctionTable::MEMBERPFNGLDRAWARRAYSEXTPROC)&RecordingTableDecorator::m_glDrawArraysEXT_recording;
+if(this->m_ptr_glBlendEquationEXT)this->m_ptr_glBlendEquationEXT = (FunctionTable::MEMBERPFNGLBLENDEQUATIONEXTPROC)&RecordingTableDecorator::m_glBlendEquationEXT_recording;
+if(this->m_ptr_glStencilOp)this->m_ptr_glStencilOp = (FunctionTable::MEMBERPFNGLSTENCILOPPROC)&RecordingTableDecorator::m_glStencilOp_recording;
+if(this->m_ptr_glCopyTextureSubImage2DEXT)this->m_ptr_glCopyTextureSubImage2DEXT = (FunctionTable::MEMBERPFNGLCOPYTEXTURESUBIMAGE2DEXTPROC)&RecordingTableDecorator::m_glCopyTextureSubImage2DEXT_recording;
+if(this->m_ptr_glTexEnvf)this->m_ptr_glTexEnvf = (FunctionTable::MEMBERPFNGLTEXENVFPROC)&RecordingTableDecorator::m_glTexEnvf_recording;
+if(this->m_ptr_glVertexAttrib2dvNV)this->m_ptr_glVertexAttrib2dvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2DVNVPROC)&RecordingTableDecorator::m_glVertexAttrib2dvNV_recording;
+if(this->m_ptr_glGenPerfMonitorsAMD)this->m_ptr_glGenPerfMonitorsAMD = (FunctionTable::MEMBERPFNGLGENPERFMONITORSAMDPROC)&RecordingTableDecorator::m_glGenPerfMonitorsAMD_recording;
+if(this->m_ptr_glGetInteger64i_v)this->m_ptr_glGetInteger64i_v = (FunctionTable::MEMBERPFNGLGETINTEGER64I_VPROC)&RecordingTableDecorator::m_glGetInteger64i_v_recording;
+if(this->m_ptr_glGetHistogramParameterfv)this->m_ptr_glGetHistogramParameterfv = (FunctionTable::MEMBERPFNGLGETHISTOGRAMPARAMETERFVPROC)&RecordingTableDecorator::m_glGetHistogramParameterfv_recording;
+if(this->m_ptr_glVertexFormatNV)this->m_ptr_glVertexFormatNV = (FunctionTable::MEMBERPFNGLVERTEXFORMATNVPROC)&RecordingTableDecorator::m_glVertexFormatNV_recording;
+if(this->m_ptr_glBlendFuncIndexedAMD)this->m_ptr_glBlendFuncIndexedAMD = (FunctionTable::MEMBERPFNGLBLENDFUNCINDEXEDAMDPROC)&RecordingTableDecorator::m_glBlendFuncIndexedAMD_recording;
+if(this->m_ptr_glTexEnvi)this->m_ptr_glTexEnvi = (FunctionTable::MEMBERPFNGLTEXENVIPROC)&RecordingTableDecorator::m_glTexEnvi_recording;
+if(this->m_ptr_glMultiTexCoord1iv)this->m_ptr_glMultiTexCoord1iv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1IVPROC)&RecordingTableDecorator::m_glMultiTexCoord1iv_recording;
+if(this->m_ptr_glIsEnabledi)this->m_ptr_glIsEnabledi = (FunctionTable::MEMBERPFNGLISENABLEDIPROC)&RecordingTableDecorator::m_glIsEnabledi_recording;
+if(this->m_ptr_glVertexAttribL2ui64vNV)this->m_ptr_glVertexAttribL2ui64vNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL2UI64VNVPROC)&RecordingTableDecorator::m_glVertexAttribL2ui64vNV_recording;
+if(this->m_ptr_glVertexAttribL4i64NV)this->m_ptr_glVertexAttribL4i64NV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL4I64NVPROC)&RecordingTableDecorator::m_glVertexAttribL4i64NV_recording;
+if(this->m_ptr_glMatrixTranslatedEXT)this->m_ptr_glMatrixTranslatedEXT = (FunctionTable::MEMBERPFNGLMATRIXTRANSLATEDEXTPROC)&RecordingTableDecorator::m_glMatrixTranslatedEXT_recording;
+if(this->m_ptr_glMakeTextureHandleResidentARB)this->m_ptr_glMakeTextureHandleResidentARB = (FunctionTable::MEMBERPFNGLMAKETEXTUREHANDLERESIDENTARBPROC)&RecordingTableDecorator::m_glMakeTextureHandleResidentARB_recording;
+if(this->m_ptr_glMatrixMultdEXT)this->m_ptr_glMatrixMultdEXT = (FunctionTable::MEMBERPFNGLMATRIXMULTDEXTPROC)&RecordingTableDecorator::m_glMatrixMultdEXT_recording;
+if(this->m_ptr_glBinormal3dvEXT)this->m_ptr_glBinormal3dvEXT = (FunctionTable::MEMBERPFNGLBINORMAL3DVEXTPROC)&RecordingTableDecorator::m_glBinormal3dvEXT_recording;
+if(this->m_ptr_glImportSyncEXT)this->m_ptr_glImportSyncEXT = (FunctionTable::MEMBERPFNGLIMPORTSYNCEXTPROC)&RecordingTableDecorator::m_glImportSyncEXT_recording;
+if(this->m_ptr_glGetMapiv)this->m_ptr_glGetMapiv = (FunctionTable::MEMBERPFNGLGETMAPIVPROC)&RecordingTableDecorator::m_glGetMapiv_recording;
+if(this->m_ptr_glGetListParameterfvSGIX)this->m_ptr_glGetListParameterfvSGIX = (FunctionTable::MEMBERPFNGLGETLISTPARAMETERFVSGIXPROC)&RecordingTableDecorator::m_glGetListParameterfvSGIX_recording;
+if(this->m_ptr_glMultiTexCoord4sv)this->m_ptr_glMultiTexCoord4sv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4SVPROC)&RecordingTableDecorator::m_glMultiTexCoord4sv_recording;
+if(this->m_ptr_glPNTrianglesiATI)this->m_ptr_glPNTrianglesiATI = (FunctionTable::MEMBERPFNGLPNTRIANGLESIATIPROC)&RecordingTableDecorator::m_glPNTrianglesiATI_recording;
+if(this->m_ptr_glBindVertexArrayAPPLE)this->m_ptr_glBindVertexArrayAPPLE = (FunctionTable::MEMBERPFNGLBINDVERTEXARRAYAPPLEPROC)&RecordingTableDecorator::m_glBindVertexArrayAPPLE_recording;
+if(this->m_ptr_glObjectPtrLabel)this->m_ptr_glObjectPtrLabel = (FunctionTable::MEMBERPFNGLOBJECTPTRLABELPROC)&RecordingTableDecorator::m_glObjectPtrLabel_recording;
+if(this->m_ptr_glGetDebugMessageLog)this->m_ptr_glGetDebugMessageLog = (FunctionTable::MEMBERPFNGLGETDEBUGMESSAGELOGPROC)&RecordingTableDecorator::m_glGetDebugMessageLog_recording;
+if(this->m_ptr_glTrackMatrixNV)this->m_ptr_glTrackMatrixNV = (FunctionTable::MEMBERPFNGLTRACKMATRIXNVPROC)&RecordingTableDecorator::m_glTrackMatrixNV_recording;
+if(this->m_ptr_glBindFragDataLocation)this->m_ptr_glBindFragDataLocation = (FunctionTable::MEMBERPFNGLBINDFRAGDATALOCATIONPROC)&RecordingTableDecorator::m_glBindFragDataLocation_recording;
+if(this->m_ptr_glTangent3ivEXT)this->m_ptr_glTangent3ivEXT = (FunctionTable::MEMBERPFNGLTANGENT3IVEXTPROC)&RecordingTableDecorator::m_glTangent3ivEXT_recording;
+if(this->m_ptr_glSecondaryColor3ubv)this->m_ptr_glSecondaryColor3ubv = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UBVPROC)&RecordingTableDecorator::m_glSecondaryColor3ubv_recording;
+if(this->m_ptr_glMakeTextureHandleNonResidentNV)this->m_ptr_glMakeTextureHandleNonResidentNV = (FunctionTable::MEMBERPFNGLMAKETEXTUREHANDLENONRESIDENTNVPROC)&RecordingTableDecorator::m_glMakeTextureHandleNonResidentNV_recording;
+if(this->m_ptr_glVertexAttribs4ubvNV)this->m_ptr_glVertexAttribs4ubvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS4UBVNVPROC)&RecordingTableDecorator::m_glVertexAttribs4ubvNV_recording;
+if(this->m_ptr_glClipPlanexOES)this->m_ptr_glClipPlanexOES = (FunctionTable::MEMBERPFNGLCLIPPLANEXOESPROC)&RecordingTableDecorator::m_glClipPlanexOES_recording;
+if(this->m_ptr_glMultiTexCoord3iv)this->m_ptr_glMultiTexCoord3iv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3IVPROC)&RecordingTableDecorator::m_glMultiTexCoord3iv_recording;
+if(this->m_ptr_glGetnPolygonStippleARB)this->m_ptr_glGetnPolygonStippleARB = (FunctionTable::MEMBERPFNGLGETNPOLYGONSTIPPLEARBPROC)&RecordingTableDecorator::m_glGetnPolygonStippleARB_recording;
+if(this->m_ptr_glUniform2i64vNV)this->m_ptr_glUniform2i64vNV = (FunctionTable::MEMBERPFNGLUNIFORM2I64VNVPROC)&RecordingTableDecorator::m_glUniform2i64vNV_recording;
+if(this->m_ptr_glLightModelf)this->m_ptr_glLightModelf = (FunctionTable::MEMBERPFNGLLIGHTMODELFPROC)&RecordingTableDecorator::m_glLightModelf_recording;
+if(this->m_ptr_glMultiTexSubImage2DEXT)this->m_ptr_glMultiTexSubImage2DEXT = (FunctionTable::MEMBERPFNGLMULTITEXSUBIMAGE2DEXTPROC)&RecordingTableDecorator::m_glMultiTexSubImage2DEXT_recording;
+if(this->m_ptr_glReplacementCodeuiColor3fVertex3fSUN)this->m_ptr_glReplacementCodeuiColor3fVertex3fSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUICOLOR3FVERTEX3FSUNPROC)&RecordingTableDecorator::m_glReplacementCodeuiColor3fVertex3fSUN_recording;
+if(this->m_ptr_glTangent3dvEXT)this->m_ptr_glTangent3dvEXT = (FunctionTable::MEMBERPFNGLTANGENT3DVEXTPROC)&RecordingTableDecorator::m_glTangent3dvEXT_recording;
+if(this->m_ptr_glLightModeli)this->m_ptr_glLightModeli = (FunctionTable::MEMBERPFNGLLIGHTMODELIPROC)&RecordingTableDecorator::m_glLightModeli_recording;
+if(this->m_ptr_glVertexWeighthvNV)this->m_ptr_glVertexWeighthvNV = (FunctionTable::MEMBERPFNGLVERTEXWEIGHTHVNVPROC)&RecordingTableDecorator::m_glVertexWeighthvNV_recording;
+if(this->m_ptr_glWindowPos3iv)this->m_ptr_glWindowPos3iv = (FunctionTable::MEMBERPFNGLWINDOWPOS3IVPROC)&RecordingTableDecorator::m_glWindowPos3iv_recording;
+if(this->m_ptr_glMultiTexCoordP1uiv)this->m_ptr_glMultiTexCoordP1uiv = (FunctionTable::MEMBERPFNGLMULTITEXCOORDP1UIVPROC)&RecordingTableDecorator::m_glMultiTexCoordP1uiv_recording;
+if(this->m_ptr_glTransformPathNV)this->m_ptr_glTransformPathNV = (FunctionTable::MEMBERPFNGLTRANSFORMPATHNVPROC)&RecordingTableDecorator::m_glTransformPathNV_recording;
+if(this->m_ptr_glProgramNamedParameter4dNV)this->m_ptr_glProgramNamedParameter4dNV = (FunctionTable::MEMBERPFNGLPROGRAMNAMEDPARAMETER4DNVPROC)&RecordingTableDecorator::m_glProgramNamedParameter4dNV_recording;
+if(this->m_ptr_glMultiDrawElementsIndirect)this->m_ptr_glMultiDrawElementsIndirect = (FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSINDIRECTPROC)&RecordingTableDecorator::m_glMultiDrawElementsIndirect_recording;
+if(this->m_ptr_glProgramUniform1dEXT)this->m_ptr_glProgramUniform1dEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1DEXTPROC)&RecordingTableDecorator::m_glProgramUniform1dEXT_recording;
+if(this->m_ptr_glCallLists)this->m_ptr_glCallLists = (FunctionTable::MEMBERPFNGLCALLLISTSPROC)&RecordingTableDecorator::m_glCallLists_recording;
+if(this->m_ptr_glNormal3hvNV)this->m_ptr_glNormal3hvNV = (FunctionTable::MEMBERPFNGLNORMAL3HVNVPROC)&RecordingTableDecorator::m_glNormal3hvNV_recording;
+if(this->m_ptr_glGetCombinerOutputParameterfvNV)this->m_ptr_glGetCombinerOutputParameterfvNV = (FunctionTable::MEMBERPFNGLGETCOMBINEROUTPUTPARAMETERFVNVPROC)&RecordingTableDecorator::m_glGetCombinerOutputParameterfvNV_recording;
+if(this->m_ptr_glVertexAttrib4sARB)this->m_ptr_glVertexAttrib4sARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4SARBPROC)&RecordingTableDecorator::m_glVertexAttrib4sARB_recording;
+if(this->m_ptr_glTexCoord3i)this->m_ptr_glTexCoord3i = (FunctionTable::MEMBERPFNGLTEXCOORD3IPROC)&RecordingTableDecorator::m_glTexCoord3i_recording;
+if(this->m_ptr_glVertexAttribI3uiv)this->m_ptr_glVertexAttribI3uiv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI3UIVPROC)&RecordingTableDecorator::m_glVertexAttribI3uiv_recording;
+if(this->m_ptr_glPushDebugGroup)this->m_ptr_glPushDebugGroup = (FunctionTable::MEMBERPFNGLPUSHDEBUGGROUPPROC)&RecordingTableDecorator::m_glPushDebugGroup_recording;
+if(this->m_ptr_glTexCoord3f)this->m_ptr_glTexCoord3f = (FunctionTable::MEMBERPFNGLTEXCOORD3FPROC)&RecordingTableDecorator::m_glTexCoord3f_recording;
+if(this->m_ptr_glTexCoord3d)this->m_ptr_glTexCoord3d = (FunctionTable::MEMBERPFNGLTEXCOORD3DPROC)&RecordingTableDecorator::m_glTexCoord3d_recording;
+if(this->m_ptr_glTexCoord2xOES)this->m_ptr_glTexCoord2xOES = (FunctionTable::MEMBERPFNGLTEXCOORD2XOESPROC)&RecordingTableDecorator::m_glTexCoord2xOES_recording;
+if(this->m_ptr_glGetStageIndexNV)this->m_ptr_glGetStageIndexNV = (FunctionTable::MEMBERPFNGLGETSTAGEINDEXNVPROC)&RecordingTableDecorator::m_glGetStageIndexNV_recording;
+if(this->m_ptr_glProgramUniform4i64vNV)this->m_ptr_glProgramUniform4i64vNV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4I64VNVPROC)&RecordingTableDecorator::m_glProgramUniform4i64vNV_recording;
+if(this->m_ptr_glGetNamedBufferPointervEXT)this->m_ptr_glGetNamedBufferPointervEXT = (FunctionTable::MEMBERPFNGLGETNAMEDBUFFERPOINTERVEXTPROC)&RecordingTableDecorator::m_glGetNamedBufferPointervEXT_recording;
+if(this->m_ptr_glTextureBarrierNV)this->m_ptr_glTextureBarrierNV = (FunctionTable::MEMBERPFNGLTEXTUREBARRIERNVPROC)&RecordingTableDecorator::m_glTextureBarrierNV_recording;
+if(this->m_ptr_glColor4ubVertex3fvSUN)this->m_ptr_glColor4ubVertex3fvSUN = (FunctionTable::MEMBERPFNGLCOLOR4UBVERTEX3FVSUNPROC)&RecordingTableDecorator::m_glColor4ubVertex3fvSUN_recording;
+if(this->m_ptr_glGetCommandHeaderNV)this->m_ptr_glGetCommandHeaderNV = (FunctionTable::MEMBERPFNGLGETCOMMANDHEADERNVPROC)&RecordingTableDecorator::m_glGetCommandHeaderNV_recording;
+if(this->m_ptr_glGetPerfMonitorCounterInfoAMD)this->m_ptr_glGetPerfMonitorCounterInfoAMD = (FunctionTable::MEMBERPFNGLGETPERFMONITORCOUNTERINFOAMDPROC)&RecordingTableDecorator::m_glGetPerfMonitorCounterInfoAMD_recording;
+if(this->m_ptr_glVertexAttrib1svARB)this->m_ptr_glVertexAttrib1svARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1SVARBPROC)&RecordingTableDecorator::m_glVertexAttrib1svARB_recording;
+if(this->m_ptr_glCombinerParameteriNV)this->m_ptr_glCombinerParameteriNV = (FunctionTable::MEMBERPFNGLCOMBINERPARAMETERINVPROC)&RecordingTableDecorator::m_glCombinerParameteriNV_recording;
+if(this->m_ptr_glMatrixMultTransposefEXT)this->m_ptr_glMatrixMultTransposefEXT = (FunctionTable::MEMBERPFNGLMATRIXMULTTRANSPOSEFEXTPROC)&RecordingTableDecorator::m_glMatrixMultTransposefEXT_recording;
+if(this->m_ptr_glDetailTexFuncSGIS)this->m_ptr_glDetailTexFuncSGIS = (FunctionTable::MEMBERPFNGLDETAILTEXFUNCSGISPROC)&RecordingTableDecorator::m_glDetailTexFuncSGIS_recording;
+if(this->m_ptr_glAreTexturesResident)this->m_ptr_glAreTexturesResident = (FunctionTable::MEMBERPFNGLARETEXTURESRESIDENTPROC)&RecordingTableDecorator::m_glAreTexturesResident_recording;
+if(this->m_ptr_glProgramUniform2d)this->m_ptr_glProgramUniform2d = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2DPROC)&RecordingTableDecorator::m_glProgramUniform2d_recording;
+if(this->m_ptr_glGetConvolutionParameterfvEXT)this->m_ptr_glGetConvolutionParameterfvEXT = (FunctionTable::MEMBERPFNGLGETCONVOLUTIONPARAMETERFVEXTPROC)&RecordingTableDecorator::m_glGetConvolutionParameterfvEXT_recording;
+if(this->m_ptr_glIndexPointerListIBM)this->m_ptr_glIndexPointerListIBM = (FunctionTable::MEMBERPFNGLINDEXPOINTERLISTIBMPROC)&RecordingTableDecorator::m_glIndexPointerListIBM_recording;
+if(this->m_ptr_glVertexAttribI4iEXT)this->m_ptr_glVertexAttribI4iEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4IEXTPROC)&RecordingTableDecorator::m_glVertexAttribI4iEXT_recording;
+if(this->m_ptr_glProgramUniform2f)this->m_ptr_glProgramUniform2f = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2FPROC)&RecordingTableDecorator::m_glProgramUniform2f_recording;
+if(this->m_ptr_glRasterPos4sv)this->m_ptr_glRasterPos4sv = (FunctionTable::MEMBERPFNGLRASTERPOS4SVPROC)&RecordingTableDecorator::m_glRasterPos4sv_recording;
+if(this->m_ptr_glColor4s)this->m_ptr_glColor4s = (FunctionTable::MEMBERPFNGLCOLOR4SPROC)&RecordingTableDecorator::m_glColor4s_recording;
+if(this->m_ptr_glColorFragmentOp3ATI)this->m_ptr_glColorFragmentOp3ATI = (FunctionTable::MEMBERPFNGLCOLORFRAGMENTOP3ATIPROC)&RecordingTableDecorator::m_glColorFragmentOp3ATI_recording;
+if(this->m_ptr_glResizeBuffersMESA)this->m_ptr_glResizeBuffersMESA = (FunctionTable::MEMBERPFNGLRESIZEBUFFERSMESAPROC)&RecordingTableDecorator::m_glResizeBuffersMESA_recording;
+if(this->m_ptr_glGetMinmaxParameterfv)this->m_ptr_glGetMinmaxParameterfv = (FunctionTable::MEMBERPFNGLGETMINMAXPARAMETERFVPROC)&RecordingTableDecorator::m_glGetMinmaxParameterfv_recording;
+if(this->m_ptr_glClientActiveTextureARB)this->m_ptr_glClientActiveTextureARB = (FunctionTable::MEMBERPFNGLCLIENTACTIVETEXTUREARBPROC)&RecordingTableDecorator::m_glClientActiveTextureARB_recording;
+if(this->m_ptr_glBindVertexArray)this->m_ptr_glBindVertexArray = (FunctionTable::MEMBERPFNGLBINDVERTEXARRAYPROC)&RecordingTableDecorator::m_glBindVertexArray_recording;
+if(this->m_ptr_glColor4b)this->m_ptr_glColor4b = (FunctionTable::MEMBERPFNGLCOLOR4BPROC)&RecordingTableDecorator::m_glColor4b_recording;
+if(this->m_ptr_glColor4f)this->m_ptr_glColor4f = (FunctionTable::MEMBERPFNGLCOLOR4FPROC)&RecordingTableDecorator::m_glColor4f_recording;
+if(this->m_ptr_glColor4d)this->m_ptr_glColor4d = (FunctionTable::MEMBERPFNGLCOLOR4DPROC)&RecordingTableDecorator::m_glColor4d_recording;
+if(this->m_ptr_glColor4i)this->m_ptr_glColor4i = (FunctionTable::MEMBERPFNGLCOLOR4IPROC)&RecordingTableDecorator::m_glColor4i_recording;
+if(this->m_ptr_glEdgeFlagFormatNV)this->m_ptr_glEdgeFlagFormatNV = (FunctionTable::MEMBERPFNGLEDGEFLAGFORMATNVPROC)&RecordingTableDecorator::m_glEdgeFlagFormatNV_recording;
+if(this->m_ptr_glNamedBufferSubData)this->m_ptr_glNamedBufferSubData = (FunctionTable::MEMBERPFNGLNAMEDBUFFERSUBDATAPROC)&RecordingTableDecorator::m_glNamedBufferSubData_recording;
+if(this->m_ptr_glDrawElementsInstanced)this->m_ptr_glDrawElementsInstanced = (FunctionTable::MEMBERPFNGLDRAWELEMENTSINSTANCEDPROC)&RecordingTableDecorator::m_glDrawElementsInstanced_recording;
+if(this->m_ptr_glGetMultiTexParameterIivEXT)this->m_ptr_glGetMultiTexParameterIivEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXPARAMETERIIVEXTPROC)&RecordingTableDecorator::m_glGetMultiTexParameterIivEXT_recording;
+if(this->m_ptr_glVertex2dv)this->m_ptr_glVertex2dv = (FunctionTable::MEMBERPFNGLVERTEX2DVPROC)&RecordingTableDecorator::m_glVertex2dv_recording;
+if(this->m_ptr_glDisableVertexArrayAttribEXT)this->m_ptr_glDisableVertexArrayAttribEXT = (FunctionTable::MEMBERPFNGLDISABLEVERTEXARRAYATTRIBEXTPROC)&RecordingTableDecorator::m_glDisableVertexArrayAttribEXT_recording;
+if(this->m_ptr_glObjectUnpurgeableAPPLE)this->m_ptr_glObjectUnpurgeableAPPLE = (FunctionTable::MEMBERPFNGLOBJECTUNPURGEABLEAPPLEPROC)&RecordingTableDecorator::m_glObjectUnpurgeableAPPLE_recording;
+if(this->m_ptr_glVertexAttribs2dvNV)this->m_ptr_glVertexAttribs2dvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS2DVNVPROC)&RecordingTableDecorator::m_glVertexAttribs2dvNV_recording;
+if(this->m_ptr_glReplacementCodeuiTexCoord2fVertex3fSUN)this->m_ptr_glReplacementCodeuiTexCoord2fVertex3fSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUITEXCOORD2FVERTEX3FSUNPROC)&RecordingTableDecorator::m_glReplacementCodeuiTexCoord2fVertex3fSUN_recording;
+if(this->m_ptr_glGetMapParameterfvNV)this->m_ptr_glGetMapParameterfvNV = (FunctionTable::MEMBERPFNGLGETMAPPARAMETERFVNVPROC)&RecordingTableDecorator::m_glGetMapParameterfvNV_recording;
+if(this->m_ptr_glProgramUniform4ivEXT)this->m_ptr_glProgramUniform4ivEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4IVEXTPROC)&RecordingTableDecorator::m_glProgramUniform4ivEXT_recording;
+if(this->m_ptr_glProgramUniform3ui64vNV)this->m_ptr_glProgramUniform3ui64vNV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UI64VNVPROC)&RecordingTableDecorator::m_glProgramUniform3ui64vNV_recording;
+if(this->m_ptr_glRectfv)this->m_ptr_glRectfv = (FunctionTable::MEMBERPFNGLRECTFVPROC)&RecordingTableDecorator::m_glRectfv_recording;
+if(this->m_ptr_glTexFilterFuncSGIS)this->m_ptr_glTexFilterFuncSGIS = (FunctionTable::MEMBERPFNGLTEXFILTERFUNCSGISPROC)&RecordingTableDecorator::m_glTexFilterFuncSGIS_recording;
+if(this->m_ptr_glSpriteParameterfvSGIX)this->m_ptr_glSpriteParameterfvSGIX = (FunctionTable::MEMBERPFNGLSPRITEPARAMETERFVSGIXPROC)&RecordingTableDecorator::m_glSpriteParameterfvSGIX_recording;
+if(this->m_ptr_glCopyMultiTexImage1DEXT)this->m_ptr_glCopyMultiTexImage1DEXT = (FunctionTable::MEMBERPFNGLCOPYMULTITEXIMAGE1DEXTPROC)&RecordingTableDecorator::m_glCopyMultiTexImage1DEXT_recording;
+if(this->m_ptr_glGetVertexAttribIuivEXT)this->m_ptr_glGetVertexAttribIuivEXT = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBIUIVEXTPROC)&RecordingTableDecorator::m_glGetVertexAttribIuivEXT_recording;
+if(this->m_ptr_glUniformMatrix2x4dv)this->m_ptr_glUniformMatrix2x4dv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX2X4DVPROC)&RecordingTableDecorator::m_glUniformMatrix2x4dv_recording;
+if(this->m_ptr_glGetProgramResourceLocationIndex)this->m_ptr_glGetProgramResourceLocationIndex = (FunctionTable::MEMBERPFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC)&RecordingTableDecorator::m_glGetProgramResourceLocationIndex_recording;
+if(this->m_ptr_glColor3hNV)this->m_ptr_glColor3hNV = (FunctionTable::MEMBERPFNGLCOLOR3HNVPROC)&RecordingTableDecorator::m_glColor3hNV_recording;
+if(this->m_ptr_glViewport)this->m_ptr_glViewport = (FunctionTable::MEMBERPFNGLVIEWPORTPROC)&RecordingTableDecorator::m_glViewport_recording;
+if(this->m_ptr_glProgramNamedParameter4fNV)this->m_ptr_glProgramNamedParameter4fNV = (FunctionTable::MEMBERPFNGLPROGRAMNAMEDPARAMETER4FNVPROC)&RecordingTableDecorator::m_glProgramNamedParameter4fNV_recording;
+if(this->m_ptr_glGetInvariantBooleanvEXT)this->m_ptr_glGetInvariantBooleanvEXT = (FunctionTable::MEMBERPFNGLGETINVARIANTBOOLEANVEXTPROC)&RecordingTableDecorator::m_glGetInvariantBooleanvEXT_recording;
+if(this->m_ptr_glTexStorage2DMultisample)this->m_ptr_glTexStorage2DMultisample = (FunctionTable::MEMBERPFNGLTEXSTORAGE2DMULTISAMPLEPROC)&RecordingTableDecorator::m_glTexStorage2DMultisample_recording;
+if(this->m_ptr_glPixelStorex)this->m_ptr_glPixelStorex = (FunctionTable::MEMBERPFNGLPIXELSTOREXPROC)&RecordingTableDecorator::m_glPixelStorex_recording;
+if(this->m_ptr_glVertexAttribL1dvEXT)this->m_ptr_glVertexAttribL1dvEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL1DVEXTPROC)&RecordingTableDecorator::m_glVertexAttribL1dvEXT_recording;
+if(this->m_ptr_glGetActiveSubroutineUniformiv)this->m_ptr_glGetActiveSubroutineUniformiv = (FunctionTable::MEMBERPFNGLGETACTIVESUBROUTINEUNIFORMIVPROC)&RecordingTableDecorator::m_glGetActiveSubroutineUniformiv_recording;
+if(this->m_ptr_glVertexAttribPointerARB)this->m_ptr_glVertexAttribPointerARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIBPOINTERARBPROC)&RecordingTableDecorator::m_glVertexAttribPointerARB_recording;
+if(this->m_ptr_glCompressedTexSubImage2DARB)this->m_ptr_glCompressedTexSubImage2DARB = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXSUBIMAGE2DARBPROC)&RecordingTableDecorator::m_glCompressedTexSubImage2DARB_recording;
+if(this->m_ptr_glVertex2hvNV)this->m_ptr_glVertex2hvNV = (FunctionTable::MEMBERPFNGLVERTEX2HVNVPROC)&RecordingTableDecorator::m_glVertex2hvNV_recording;
+if(this->m_ptr_glTexBuffer)this->m_ptr_glTexBuffer = (FunctionTable::MEMBERPFNGLTEXBUFFERPROC)&RecordingTableDecorator::m_glTexBuffer_recording;
+if(this->m_ptr_glArrayElement)this->m_ptr_glArrayElement = (FunctionTable::MEMBERPFNGLARRAYELEMENTPROC)&RecordingTableDecorator::m_glArrayElement_recording;
+if(this->m_ptr_glValidateProgram)this->m_ptr_glValidateProgram = (FunctionTable::MEMBERPFNGLVALIDATEPROGRAMPROC)&RecordingTableDecorator::m_glValidateProgram_recording;
+if(this->m_ptr_glPixelStoref)this->m_ptr_glPixelStoref = (FunctionTable::MEMBERPFNGLPIXELSTOREFPROC)&RecordingTableDecorator::m_glPixelStoref_recording;
+if(this->m_ptr_glWindowPos3dARB)this->m_ptr_glWindowPos3dARB = (FunctionTable::MEMBERPFNGLWINDOWPOS3DARBPROC)&RecordingTableDecorator::m_glWindowPos3dARB_recording;
+if(this->m_ptr_glEvalCoord1dv)this->m_ptr_glEvalCoord1dv = (FunctionTable::MEMBERPFNGLEVALCOORD1DVPROC)&RecordingTableDecorator::m_glEvalCoord1dv_recording;
+if(this->m_ptr_glVertexAttribs2fvNV)this->m_ptr_glVertexAttribs2fvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS2FVNVPROC)&RecordingTableDecorator::m_glVertexAttribs2fvNV_recording;
+if(this->m_ptr_glRecti)this->m_ptr_glRecti = (FunctionTable::MEMBERPFNGLRECTIPROC)&RecordingTableDecorator::m_glRecti_recording;
+if(this->m_ptr_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN)this->m_ptr_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUITEXCOORD2FCOLOR4FNORMAL3FVERTEX3FVSUNPROC)&RecordingTableDecorator::m_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN_recording;
+if(this->m_ptr_glTexCoord1bOES)this->m_ptr_glTexCoord1bOES = (FunctionTable::MEMBERPFNGLTEXCOORD1BOESPROC)&RecordingTableDecorator::m_glTexCoord1bOES_recording;
+if(this->m_ptr_glProgramUniform2i64vARB)this->m_ptr_glProgramUniform2i64vARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2I64VARBPROC)&RecordingTableDecorator::m_glProgramUniform2i64vARB_recording;
+if(this->m_ptr_glWindowPos2dARB)this->m_ptr_glWindowPos2dARB = (FunctionTable::MEMBERPFNGLWINDOWPOS2DARBPROC)&RecordingTableDecorator::m_glWindowPos2dARB_recording;
+if(this->m_ptr_glGetProgramParameterdvNV)this->m_ptr_glGetProgramParameterdvNV = (FunctionTable::MEMBERPFNGLGETPROGRAMPARAMETERDVNVPROC)&RecordingTableDecorator::m_glGetProgramParameterdvNV_recording;
+if(this->m_ptr_glRectf)this->m_ptr_glRectf = (FunctionTable::MEMBERPFNGLRECTFPROC)&RecordingTableDecorator::m_glRectf_recording;
+if(this->m_ptr_glRectd)this->m_ptr_glRectd = (FunctionTable::MEMBERPFNGLRECTDPROC)&RecordingTableDecorator::m_glRectd_recording;
+if(this->m_ptr_glMap1xOES)this->m_ptr_glMap1xOES = (FunctionTable::MEMBERPFNGLMAP1XOESPROC)&RecordingTableDecorator::m_glMap1xOES_recording;
+if(this->m_ptr_glVertexAttrib3fvNV)this->m_ptr_glVertexAttrib3fvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3FVNVPROC)&RecordingTableDecorator::m_glVertexAttrib3fvNV_recording;
+if(this->m_ptr_glReferencePlaneSGIX)this->m_ptr_glReferencePlaneSGIX = (FunctionTable::MEMBERPFNGLREFERENCEPLANESGIXPROC)&RecordingTableDecorator::m_glReferencePlaneSGIX_recording;
+if(this->m_ptr_glGetMultiTexGendvEXT)this->m_ptr_glGetMultiTexGendvEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXGENDVEXTPROC)&RecordingTableDecorator::m_glGetMultiTexGendvEXT_recording;
+if(this->m_ptr_glGetCombinerInputParameterfvNV)this->m_ptr_glGetCombinerInputParameterfvNV = (FunctionTable::MEMBERPFNGLGETCOMBINERINPUTPARAMETERFVNVPROC)&RecordingTableDecorator::m_glGetCombinerInputParameterfvNV_recording;
+if(this->m_ptr_glGetTextureSamplerHandleARB)this->m_ptr_glGetTextureSamplerHandleARB = (FunctionTable::MEMBERPFNGLGETTEXTURESAMPLERHANDLEARBPROC)&RecordingTableDecorator::m_glGetTextureSamplerHandleARB_recording;
+if(this->m_ptr_glBindTexture)this->m_ptr_glBindTexture = (FunctionTable::MEMBERPFNGLBINDTEXTUREPROC)&RecordingTableDecorator::m_glBindTexture_recording;
+if(this->m_ptr_glRects)this->m_ptr_glRects = (FunctionTable::MEMBERPFNGLRECTSPROC)&RecordingTableDecorator::m_glRects_recording;
+if(this->m_ptr_glGetActiveAttribARB)this->m_ptr_glGetActiveAttribARB = (FunctionTable::MEMBERPFNGLGETACTIVEATTRIBARBPROC)&RecordingTableDecorator::m_glGetActiveAttribARB_recording;
+if(this->m_ptr_glHistogramEXT)this->m_ptr_glHistogramEXT = (FunctionTable::MEMBERPFNGLHISTOGRAMEXTPROC)&RecordingTableDecorator::m_glHistogramEXT_recording;
+if(this->m_ptr_glGetTextureSamplerHandleNV)this->m_ptr_glGetTextureSamplerHandleNV = (FunctionTable::MEMBERPFNGLGETTEXTURESAMPLERHANDLENVPROC)&RecordingTableDecorator::m_glGetTextureSamplerHandleNV_recording;
+if(this->m_ptr_glDetachShader)this->m_ptr_glDetachShader = (FunctionTable::MEMBERPFNGLDETACHSHADERPROC)&RecordingTableDecorator::m_glDetachShader_recording;
+if(this->m_ptr_glFinishTextureSUNX)this->m_ptr_glFinishTextureSUNX = (FunctionTable::MEMBERPFNGLFINISHTEXTURESUNXPROC)&RecordingTableDecorator::m_glFinishTextureSUNX_recording;
+if(this->m_ptr_glUniformMatrix3x4dv)this->m_ptr_glUniformMatrix3x4dv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX3X4DVPROC)&RecordingTableDecorator::m_glUniformMatrix3x4dv_recording;
+if(this->m_ptr_glVertexAttrib4fARB)this->m_ptr_glVertexAttrib4fARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4FARBPROC)&RecordingTableDecorator::m_glVertexAttrib4fARB_recording;
+if(this->m_ptr_glGetPathColorGenivNV)this->m_ptr_glGetPathColorGenivNV = (FunctionTable::MEMBERPFNGLGETPATHCOLORGENIVNVPROC)&RecordingTableDecorator::m_glGetPathColorGenivNV_recording;
+if(this->m_ptr_glGetProgramResourceLocation)this->m_ptr_glGetProgramResourceLocation = (FunctionTable::MEMBERPFNGLGETPROGRAMRESOURCELOCATIONPROC)&RecordingTableDecorator::m_glGetProgramResourceLocation_recording;
+if(this->m_ptr_glVertexArrayAttribLFormat)this->m_ptr_glVertexArrayAttribLFormat = (FunctionTable::MEMBERPFNGLVERTEXARRAYATTRIBLFORMATPROC)&RecordingTableDecorator::m_glVertexArrayAttribLFormat_recording;
+if(this->m_ptr_glGetTexLevelParameterfv)this->m_ptr_glGetTexLevelParameterfv = (FunctionTable::MEMBERPFNGLGETTEXLEVELPARAMETERFVPROC)&RecordingTableDecorator::m_glGetTexLevelParameterfv_recording;
+if(this->m_ptr_glVertexArrayVertexAttribOffsetEXT)this->m_ptr_glVertexArrayVertexAttribOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBOFFSETEXTPROC)&RecordingTableDecorator::m_glVertexArrayVertexAttribOffsetEXT_recording;
+if(this->m_ptr_glIndexFormatNV)this->m_ptr_glIndexFormatNV = (FunctionTable::MEMBERPFNGLINDEXFORMATNVPROC)&RecordingTableDecorator::m_glIndexFormatNV_recording;
+if(this->m_ptr_glMultiTexCoord3i)this->m_ptr_glMultiTexCoord3i = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3IPROC)&RecordingTableDecorator::m_glMultiTexCoord3i_recording;
+if(this->m_ptr_glReplacementCodeuiVertex3fvSUN)this->m_ptr_glReplacementCodeuiVertex3fvSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUIVERTEX3FVSUNPROC)&RecordingTableDecorator::m_glReplacementCodeuiVertex3fvSUN_recording;
+if(this->m_ptr_glViewportIndexedfv)this->m_ptr_glViewportIndexedfv = (FunctionTable::MEMBERPFNGLVIEWPORTINDEXEDFVPROC)&RecordingTableDecorator::m_glViewportIndexedfv_recording;
+if(this->m_ptr_glBindBuffersBase)this->m_ptr_glBindBuffersBase = (FunctionTable::MEMBERPFNGLBINDBUFFERSBASEPROC)&RecordingTableDecorator::m_glBindBuffersBase_recording;
+if(this->m_ptr_glTexBumpParameterfvATI)this->m_ptr_glTexBumpParameterfvATI = (FunctionTable::MEMBERPFNGLTEXBUMPPARAMETERFVATIPROC)&RecordingTableDecorator::m_glTexBumpParameterfvATI_recording;
+if(this->m_ptr_glMatrixIndexuivARB)this->m_ptr_glMatrixIndexuivARB = (FunctionTable::MEMBERPFNGLMATRIXINDEXUIVARBPROC)&RecordingTableDecorator::m_glMatrixIndexuivARB_recording;
+if(this->m_ptr_glVertexAttrib1hNV)this->m_ptr_glVertexAttrib1hNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1HNVPROC)&RecordingTableDecorator::m_glVertexAttrib1hNV_recording;
+if(this->m_ptr_glWindowPos3svMESA)this->m_ptr_glWindowPos3svMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS3SVMESAPROC)&RecordingTableDecorator::m_glWindowPos3svMESA_recording;
+if(this->m_ptr_glStencilOpSeparateATI)this->m_ptr_glStencilOpSeparateATI = (FunctionTable::MEMBERPFNGLSTENCILOPSEPARATEATIPROC)&RecordingTableDecorator::m_glStencilOpSeparateATI_recording;
+if(this->m_ptr_glDrawElementsBaseVertex)this->m_ptr_glDrawElementsBaseVertex = (FunctionTable::MEMBERPFNGLDRAWELEMENTSBASEVERTEXPROC)&RecordingTableDecorator::m_glDrawElementsBaseVertex_recording;
+if(this->m_ptr_glBlendEquationSeparateiARB)this->m_ptr_glBlendEquationSeparateiARB = (FunctionTable::MEMBERPFNGLBLENDEQUATIONSEPARATEIARBPROC)&RecordingTableDecorator::m_glBlendEquationSeparateiARB_recording;
+if(this->m_ptr_glVertexAttrib1fNV)this->m_ptr_glVertexAttrib1fNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1FNVPROC)&RecordingTableDecorator::m_glVertexAttrib1fNV_recording;
+if(this->m_ptr_glMapVertexAttrib2fAPPLE)this->m_ptr_glMapVertexAttrib2fAPPLE = (FunctionTable::MEMBERPFNGLMAPVERTEXATTRIB2FAPPLEPROC)&RecordingTableDecorator::m_glMapVertexAttrib2fAPPLE_recording;
+if(this->m_ptr_glCompressedTextureSubImage1DEXT)this->m_ptr_glCompressedTextureSubImage1DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTURESUBIMAGE1DEXTPROC)&RecordingTableDecorator::m_glCompressedTextureSubImage1DEXT_recording;
+if(this->m_ptr_glClearBufferSubData)this->m_ptr_glClearBufferSubData = (FunctionTable::MEMBERPFNGLCLEARBUFFERSUBDATAPROC)&RecordingTableDecorator::m_glClearBufferSubData_recording;
+if(this->m_ptr_glTexStorage1D)this->m_ptr_glTexStorage1D = (FunctionTable::MEMBERPFNGLTEXSTORAGE1DPROC)&RecordingTableDecorator::m_glTexStorage1D_recording;
+if(this->m_ptr_glVertexAttribI3iEXT)this->m_ptr_glVertexAttribI3iEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI3IEXTPROC)&RecordingTableDecorator::m_glVertexAttribI3iEXT_recording;
+if(this->m_ptr_glMakeTextureHandleNonResidentARB)this->m_ptr_glMakeTextureHandleNonResidentARB = (FunctionTable::MEMBERPFNGLMAKETEXTUREHANDLENONRESIDENTARBPROC)&RecordingTableDecorator::m_glMakeTextureHandleNonResidentARB_recording;
+if(this->m_ptr_glMultiDrawElementArrayAPPLE)this->m_ptr_glMultiDrawElementArrayAPPLE = (FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTARRAYAPPLEPROC)&RecordingTableDecorator::m_glMultiDrawElementArrayAPPLE_recording;
+if(this->m_ptr_glVertexStream4dATI)this->m_ptr_glVertexStream4dATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM4DATIPROC)&RecordingTableDecorator::m_glVertexStream4dATI_recording;
+if(this->m_ptr_glProgramUniformMatrix2dvEXT)this->m_ptr_glProgramUniformMatrix2dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2DVEXTPROC)&RecordingTableDecorator::m_glProgramUniformMatrix2dvEXT_recording;
+if(this->m_ptr_glVertexAttribs2hvNV)this->m_ptr_glVertexAttribs2hvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS2HVNVPROC)&RecordingTableDecorator::m_glVertexAttribs2hvNV_recording;
+if(this->m_ptr_glGetUniformiv)this->m_ptr_glGetUniformiv = (FunctionTable::MEMBERPFNGLGETUNIFORMIVPROC)&RecordingTableDecorator::m_glGetUniformiv_recording;
+if(this->m_ptr_glClipPlanefOES)this->m_ptr_glClipPlanefOES = (FunctionTable::MEMBERPFNGLCLIPPLANEFOESPROC)&RecordingTableDecorator::m_glClipPlanefOES_recording;
+if(this->m_ptr_glRenderbufferStorage)this->m_ptr_glRenderbufferStorage = (FunctionTable::MEMBERPFNGLRENDERBUFFERSTORAGEPROC)&RecordingTableDecorator::m_glRenderbufferStorage_recording;
+if(this->m_ptr_glUniform4ui)this->m_ptr_glUniform4ui = (FunctionTable::MEMBERPFNGLUNIFORM4UIPROC)&RecordingTableDecorator::m_glUniform4ui_recording;
+if(this->m_ptr_glBindFramebuffer)this->m_ptr_glBindFramebuffer = (FunctionTable::MEMBERPFNGLBINDFRAMEBUFFERPROC)&RecordingTableDecorator::m_glBindFramebuffer_recording;
+if(this->m_ptr_glValidateProgramARB)this->m_ptr_glValidateProgramARB = (FunctionTable::MEMBERPFNGLVALIDATEPROGRAMARBPROC)&RecordingTableDecorator::m_glValidateProgramARB_recording;
+if(this->m_ptr_glTexGenf)this->m_ptr_glTexGenf = (FunctionTable::MEMBERPFNGLTEXGENFPROC)&RecordingTableDecorator::m_glTexGenf_recording;
+if(this->m_ptr_glTexGend)this->m_ptr_glTexGend = (FunctionTable::MEMBERPFNGLTEXGENDPROC)&RecordingTableDecorator::m_glTexGend_recording;
+if(this->m_ptr_glTexGeni)this->m_ptr_glTexGeni = (FunctionTable::MEMBERPFNGLTEXGENIPROC)&RecordingTableDecorator::m_glTexGeni_recording;
+if(this->m_ptr_glDeleteFramebuffersEXT)this->m_ptr_glDeleteFramebuffersEXT = (FunctionTable::MEMBERPFNGLDELETEFRAMEBUFFERSEXTPROC)&RecordingTableDecorator::m_glDeleteFramebuffersEXT_recording;
+if(this->m_ptr_glResetMinmaxEXT)this->m_ptr_glResetMinmaxEXT = (FunctionTable::MEMBERPFNGLRESETMINMAXEXTPROC)&RecordingTableDecorator::m_glResetMinmaxEXT_recording;
+if(this->m_ptr_glVertexAttrib1fvNV)this->m_ptr_glVertexAttrib1fvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1FVNVPROC)&RecordingTableDecorator::m_glVertexAttrib1fvNV_recording;
+if(this->m_ptr_glIsQueryARB)this->m_ptr_glIsQueryARB = (FunctionTable::MEMBERPFNGLISQUERYARBPROC)&RecordingTableDecorator::m_glIsQueryARB_recording;
+if(this->m_ptr_glEnableVariantClientStateEXT)this->m_ptr_glEnableVariantClientStateEXT = (FunctionTable::MEMBERPFNGLENABLEVARIANTCLIENTSTATEEXTPROC)&RecordingTableDecorator::m_glEnableVariantClientStateEXT_recording;
+if(this->m_ptr_glScissorIndexed)this->m_ptr_glScissorIndexed = (FunctionTable::MEMBERPFNGLSCISSORINDEXEDPROC)&RecordingTableDecorator::m_glScissorIndexed_recording;
+if(this->m_ptr_glGetInvariantIntegervEXT)this->m_ptr_glGetInvariantIntegervEXT = (FunctionTable::MEMBERPFNGLGETINVARIANTINTEGERVEXTPROC)&RecordingTableDecorator::m_glGetInvariantIntegervEXT_recording;
+if(this->m_ptr_glProgramLocalParameterI4uiNV)this->m_ptr_glProgramLocalParameterI4uiNV = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERI4UINVPROC)&RecordingTableDecorator::m_glProgramLocalParameterI4uiNV_recording;
+if(this->m_ptr_glConvolutionParameterxvOES)this->m_ptr_glConvolutionParameterxvOES = (FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERXVOESPROC)&RecordingTableDecorator::m_glConvolutionParameterxvOES_recording;
+if(this->m_ptr_glGenFramebuffersEXT)this->m_ptr_glGenFramebuffersEXT = (FunctionTable::MEMBERPFNGLGENFRAMEBUFFERSEXTPROC)&RecordingTableDecorator::m_glGenFramebuffersEXT_recording;
+if(this->m_ptr_glVertexArrayColorOffsetEXT)this->m_ptr_glVertexArrayColorOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYCOLOROFFSETEXTPROC)&RecordingTableDecorator::m_glVertexArrayColorOffsetEXT_recording;
+if(this->m_ptr_glMultiTexCoord3ivARB)this->m_ptr_glMultiTexCoord3ivARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3IVARBPROC)&RecordingTableDecorator::m_glMultiTexCoord3ivARB_recording;
+if(this->m_ptr_glVertexWeightfEXT)this->m_ptr_glVertexWeightfEXT = (FunctionTable::MEMBERPFNGLVERTEXWEIGHTFEXTPROC)&RecordingTableDecorator::m_glVertexWeightfEXT_recording;
+if(this->m_ptr_glRasterPos4dv)this->m_ptr_glRasterPos4dv = (FunctionTable::MEMBERPFNGLRASTERPOS4DVPROC)&RecordingTableDecorator::m_glRasterPos4dv_recording;
+if(this->m_ptr_glIsTextureHandleResidentARB)this->m_ptr_glIsTextureHandleResidentARB = (FunctionTable::MEMBERPFNGLISTEXTUREHANDLERESIDENTARBPROC)&RecordingTableDecorator::m_glIsTextureHandleResidentARB_recording;
+if(this->m_ptr_glRasterPos2dv)this->m_ptr_glRasterPos2dv = (FunctionTable::MEMBERPFNGLRASTERPOS2DVPROC)&RecordingTableDecorator::m_glRasterPos2dv_recording;
+if(this->m_ptr_glWindowPos4ivMESA)this->m_ptr_glWindowPos4ivMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS4IVMESAPROC)&RecordingTableDecorator::m_glWindowPos4ivMESA_recording;
+if(this->m_ptr_glGetVariantPointervEXT)this->m_ptr_glGetVariantPointervEXT = (FunctionTable::MEMBERPFNGLGETVARIANTPOINTERVEXTPROC)&RecordingTableDecorator::m_glGetVariantPointervEXT_recording;
+if(this->m_ptr_glMapNamedBufferRangeEXT)this->m_ptr_glMapNamedBufferRangeEXT = (FunctionTable::MEMBERPFNGLMAPNAMEDBUFFERRANGEEXTPROC)&RecordingTableDecorator::m_glMapNamedBufferRangeEXT_recording;
+if(this->m_ptr_glGetnUniformui64vARB)this->m_ptr_glGetnUniformui64vARB = (FunctionTable::MEMBERPFNGLGETNUNIFORMUI64VARBPROC)&RecordingTableDecorator::m_glGetnUniformui64vARB_recording;
+if(this->m_ptr_glCreateShaderProgramv)this->m_ptr_glCreateShaderProgramv = (FunctionTable::MEMBERPFNGLCREATESHADERPROGRAMVPROC)&RecordingTableDecorator::m_glCreateShaderProgramv_recording;
+if(this->m_ptr_glGetQueryObjectiv)this->m_ptr_glGetQueryObjectiv = (FunctionTable::MEMBERPFNGLGETQUERYOBJECTIVPROC)&RecordingTableDecorator::m_glGetQueryObjectiv_recording;
+if(this->m_ptr_glPNTrianglesfATI)this->m_ptr_glPNTrianglesfATI = (FunctionTable::MEMBERPFNGLPNTRIANGLESFATIPROC)&RecordingTableDecorator::m_glPNTrianglesfATI_recording;
+if(this->m_ptr_glGlobalAlphaFactorusSUN)this->m_ptr_glGlobalAlphaFactorusSUN = (FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORUSSUNPROC)&RecordingTableDecorator::m_glGlobalAlphaFactorusSUN_recording;
+if(this->m_ptr_glVertexAttrib3dvNV)this->m_ptr_glVertexAttrib3dvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3DVNVPROC)&RecordingTableDecorator::m_glVertexAttrib3dvNV_recording;
+if(this->m_ptr_glMultiTexCoord3sARB)this->m_ptr_glMultiTexCoord3sARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3SARBPROC)&RecordingTableDecorator::m_glMultiTexCoord3sARB_recording;
+if(this->m_ptr_glGenerateMipmap)this->m_ptr_glGenerateMipmap = (FunctionTable::MEMBERPFNGLGENERATEMIPMAPPROC)&RecordingTableDecorator::m_glGenerateMipmap_recording;
+if(this->m_ptr_glCompressedTextureSubImage2D)this->m_ptr_glCompressedTextureSubImage2D = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC)&RecordingTableDecorator::m_glCompressedTextureSubImage2D_recording;
+if(this->m_ptr_glNamedRenderbufferStorageMultisampleEXT)this->m_ptr_glNamedRenderbufferStorageMultisampleEXT = (FunctionTable::MEMBERPFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEEXTPROC)&RecordingTableDecorator::m_glNamedRenderbufferStorageMultisampleEXT_recording;
+if(this->m_ptr_glPolygonOffsetClampEXT)this->m_ptr_glPolygonOffsetClampEXT = (FunctionTable::MEMBERPFNGLPOLYGONOFFSETCLAMPEXTPROC)&RecordingTableDecorator::m_glPolygonOffsetClampEXT_recording;
+if(this->m_ptr_glTextureRangeAPPLE)this->m_ptr_glTextureRangeAPPLE = (FunctionTable::MEMBERPFNGLTEXTURERANGEAPPLEPROC)&RecordingTableDecorator::m_glTextureRangeAPPLE_recording;
+if(this->m_ptr_glBlendEquationIndexedAMD)this->m_ptr_glBlendEquationIndexedAMD = (FunctionTable::MEMBERPFNGLBLENDEQUATIONINDEXEDAMDPROC)&RecordingTableDecorator::m_glBlendEquationIndexedAMD_recording;
+if(this->m_ptr_glTexCoord2d)this->m_ptr_glTexCoord2d = (FunctionTable::MEMBERPFNGLTEXCOORD2DPROC)&RecordingTableDecorator::m_glTexCoord2d_recording;
+if(this->m_ptr_glPointParameteri)this->m_ptr_glPointParameteri = (FunctionTable::MEMBERPFNGLPOINTPARAMETERIPROC)&RecordingTableDecorator::m_glPointParameteri_recording;
+if(this->m_ptr_glTexCoord2f)this->m_ptr_glTexCoord2f = (FunctionTable::MEMBERPFNGLTEXCOORD2FPROC)&RecordingTableDecorator::m_glTexCoord2f_recording;
+if(this->m_ptr_glColor4iv)this->m_ptr_glColor4iv = (FunctionTable::MEMBERPFNGLCOLOR4IVPROC)&RecordingTableDecorator::m_glColor4iv_recording;
+if(this->m_ptr_glMapNamedBufferRange)this->m_ptr_glMapNamedBufferRange = (FunctionTable::MEMBERPFNGLMAPNAMEDBUFFERRANGEPROC)&RecordingTableDecorator::m_glMapNamedBufferRange_recording;
+if(this->m_ptr_glUnmapBuffer)this->m_ptr_glUnmapBuffer = (FunctionTable::MEMBERPFNGLUNMAPBUFFERPROC)&RecordingTableDecorator::m_glUnmapBuffer_recording;
+if(this->m_ptr_glSampleMaskEXT)this->m_ptr_glSampleMaskEXT = (FunctionTable::MEMBERPFNGLSAMPLEMASKEXTPROC)&RecordingTableDecorator::m_glSampleMaskEXT_recording;
+if(this->m_ptr_glTexCoord2i)this->m_ptr_glTexCoord2i = (FunctionTable::MEMBERPFNGLTEXCOORD2IPROC)&RecordingTableDecorator::m_glTexCoord2i_recording;
+if(this->m_ptr_glTexCoord1xvOES)this->m_ptr_glTexCoord1xvOES = (FunctionTable::MEMBERPFNGLTEXCOORD1XVOESPROC)&RecordingTableDecorator::m_glTexCoord1xvOES_recording;
+if(this->m_ptr_glVertexAttrib1sARB)this->m_ptr_glVertexAttrib1sARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1SARBPROC)&RecordingTableDecorator::m_glVertexAttrib1sARB_recording;
+if(this->m_ptr_glGetVertexArrayiv)this->m_ptr_glGetVertexArrayiv = (FunctionTable::MEMBERPFNGLGETVERTEXARRAYIVPROC)&RecordingTableDecorator::m_glGetVertexArrayiv_recording;
+if(this->m_ptr_glProgramParameter4dvNV)this->m_ptr_glProgramParameter4dvNV = (FunctionTable::MEMBERPFNGLPROGRAMPARAMETER4DVNVPROC)&RecordingTableDecorator::m_glProgramParameter4dvNV_recording;
+if(this->m_ptr_glTexCoord2s)this->m_ptr_glTexCoord2s = (FunctionTable::MEMBERPFNGLTEXCOORD2SPROC)&RecordingTableDecorator::m_glTexCoord2s_recording;
+if(this->m_ptr_glTextureParameterIuivEXT)this->m_ptr_glTextureParameterIuivEXT = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIUIVEXTPROC)&RecordingTableDecorator::m_glTextureParameterIuivEXT_recording;
+if(this->m_ptr_glGetColorTableParameterfvSGI)this->m_ptr_glGetColorTableParameterfvSGI = (FunctionTable::MEMBERPFNGLGETCOLORTABLEPARAMETERFVSGIPROC)&RecordingTableDecorator::m_glGetColorTableParameterfvSGI_recording;
+if(this->m_ptr_glTexCoord4dv)this->m_ptr_glTexCoord4dv = (FunctionTable::MEMBERPFNGLTEXCOORD4DVPROC)&RecordingTableDecorator::m_glTexCoord4dv_recording;
+if(this->m_ptr_glVertexAttrib1svNV)this->m_ptr_glVertexAttrib1svNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1SVNVPROC)&RecordingTableDecorator::m_glVertexAttrib1svNV_recording;
+if(this->m_ptr_glNamedFramebufferTextureFaceEXT)this->m_ptr_glNamedFramebufferTextureFaceEXT = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTUREFACEEXTPROC)&RecordingTableDecorator::m_glNamedFramebufferTextureFaceEXT_recording;
+if(this->m_ptr_glProgramUniform2ui64vNV)this->m_ptr_glProgramUniform2ui64vNV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UI64VNVPROC)&RecordingTableDecorator::m_glProgramUniform2ui64vNV_recording;
+if(this->m_ptr_glNormal3dv)this->m_ptr_glNormal3dv = (FunctionTable::MEMBERPFNGLNORMAL3DVPROC)&RecordingTableDecorator::m_glNormal3dv_recording;
+if(this->m_ptr_glReleaseShaderCompiler)this->m_ptr_glReleaseShaderCompiler = (FunctionTable::MEMBERPFNGLRELEASESHADERCOMPILERPROC)&RecordingTableDecorator::m_glReleaseShaderCompiler_recording;
+if(this->m_ptr_glTexCoord3bvOES)this->m_ptr_glTexCoord3bvOES = (FunctionTable::MEMBERPFNGLTEXCOORD3BVOESPROC)&RecordingTableDecorator::m_glTexCoord3bvOES_recording;
+if(this->m_ptr_glIsVertexAttribEnabledAPPLE)this->m_ptr_glIsVertexAttribEnabledAPPLE = (FunctionTable::MEMBERPFNGLISVERTEXATTRIBENABLEDAPPLEPROC)&RecordingTableDecorator::m_glIsVertexAttribEnabledAPPLE_recording;
+if(this->m_ptr_glTexCoord1dv)this->m_ptr_glTexCoord1dv = (FunctionTable::MEMBERPFNGLTEXCOORD1DVPROC)&RecordingTableDecorator::m_glTexCoord1dv_recording;
+if(this->m_ptr_glReadPixels)this->m_ptr_glReadPixels = (FunctionTable::MEMBERPFNGLREADPIXELSPROC)&RecordingTableDecorator::m_glReadPixels_recording;
+if(this->m_ptr_glVertexAttribI3iv)this->m_ptr_glVertexAttribI3iv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI3IVPROC)&RecordingTableDecorator::m_glVertexAttribI3iv_recording;
+if(this->m_ptr_glSetFenceAPPLE)this->m_ptr_glSetFenceAPPLE = (FunctionTable::MEMBERPFNGLSETFENCEAPPLEPROC)&RecordingTableDecorator::m_glSetFenceAPPLE_recording;
+if(this->m_ptr_glWeightsvARB)this->m_ptr_glWeightsvARB = (FunctionTable::MEMBERPFNGLWEIGHTSVARBPROC)&RecordingTableDecorator::m_glWeightsvARB_recording;
+if(this->m_ptr_glShadeModel)this->m_ptr_glShadeModel = (FunctionTable::MEMBERPFNGLSHADEMODELPROC)&RecordingTableDecorator::m_glShadeModel_recording;
+if(this->m_ptr_glMapGrid1d)this->m_ptr_glMapGrid1d = (FunctionTable::MEMBERPFNGLMAPGRID1DPROC)&RecordingTableDecorator::m_glMapGrid1d_recording;
+if(this->m_ptr_glGetHistogramParameterivEXT)this->m_ptr_glGetHistogramParameterivEXT = (FunctionTable::MEMBERPFNGLGETHISTOGRAMPARAMETERIVEXTPROC)&RecordingTableDecorator::m_glGetHistogramParameterivEXT_recording;
+if(this->m_ptr_glConservativeRasterParameteriNV)this->m_ptr_glConservativeRasterParameteriNV = (FunctionTable::MEMBERPFNGLCONSERVATIVERASTERPARAMETERINVPROC)&RecordingTableDecorator::m_glConservativeRasterParameteriNV_recording;
+if(this->m_ptr_glClearNamedBufferData)this->m_ptr_glClearNamedBufferData = (FunctionTable::MEMBERPFNGLCLEARNAMEDBUFFERDATAPROC)&RecordingTableDecorator::m_glClearNamedBufferData_recording;
+if(this->m_ptr_glClearDepthf)this->m_ptr_glClearDepthf = (FunctionTable::MEMBERPFNGLCLEARDEPTHFPROC)&RecordingTableDecorator::m_glClearDepthf_recording;
+if(this->m_ptr_glCreatePerfQueryINTEL)this->m_ptr_glCreatePerfQueryINTEL = (FunctionTable::MEMBERPFNGLCREATEPERFQUERYINTELPROC)&RecordingTableDecorator::m_glCreatePerfQueryINTEL_recording;
+if(this->m_ptr_glFogCoordfEXT)this->m_ptr_glFogCoordfEXT = (FunctionTable::MEMBERPFNGLFOGCOORDFEXTPROC)&RecordingTableDecorator::m_glFogCoordfEXT_recording;
+if(this->m_ptr_glVertexAttrib2dARB)this->m_ptr_glVertexAttrib2dARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2DARBPROC)&RecordingTableDecorator::m_glVertexAttrib2dARB_recording;
+if(this->m_ptr_glMultiTexCoord4dARB)this->m_ptr_glMultiTexCoord4dARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4DARBPROC)&RecordingTableDecorator::m_glMultiTexCoord4dARB_recording;
+if(this->m_ptr_glReadnPixelsARB)this->m_ptr_glReadnPixelsARB = (FunctionTable::MEMBERPFNGLREADNPIXELSARBPROC)&RecordingTableDecorator::m_glReadnPixelsARB_recording;
+if(this->m_ptr_glMultiTexBufferEXT)this->m_ptr_glMultiTexBufferEXT = (FunctionTable::MEMBERPFNGLMULTITEXBUFFEREXTPROC)&RecordingTableDecorator::m_glMultiTexBufferEXT_recording;
+if(this->m_ptr_glWindowPos4dvMESA)this->m_ptr_glWindowPos4dvMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS4DVMESAPROC)&RecordingTableDecorator::m_glWindowPos4dvMESA_recording;
+if(this->m_ptr_glInvalidateNamedFramebufferData)this->m_ptr_glInvalidateNamedFramebufferData = (FunctionTable::MEMBERPFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC)&RecordingTableDecorator::m_glInvalidateNamedFramebufferData_recording;
+if(this->m_ptr_glSecondaryColorPointerListIBM)this->m_ptr_glSecondaryColorPointerListIBM = (FunctionTable::MEMBERPFNGLSECONDARYCOLORPOINTERLISTIBMPROC)&RecordingTableDecorator::m_glSecondaryColorPointerListIBM_recording;
+if(this->m_ptr_glRectiv)this->m_ptr_glRectiv = (FunctionTable::MEMBERPFNGLRECTIVPROC)&RecordingTableDecorator::m_glRectiv_recording;
+if(this->m_ptr_glColorP4ui)this->m_ptr_glColorP4ui = (FunctionTable::MEMBERPFNGLCOLORP4UIPROC)&RecordingTableDecorator::m_glColorP4ui_recording;
+if(this->m_ptr_glUseProgramStages)this->m_ptr_glUseProgramStages = (FunctionTable::MEMBERPFNGLUSEPROGRAMSTAGESPROC)&RecordingTableDecorator::m_glUseProgramStages_recording;
+if(this->m_ptr_glRasterPos3dv)this->m_ptr_glRasterPos3dv = (FunctionTable::MEMBERPFNGLRASTERPOS3DVPROC)&RecordingTableDecorator::m_glRasterPos3dv_recording;
+if(this->m_ptr_glPathTexGenNV)this->m_ptr_glPathTexGenNV = (FunctionTable::MEMBERPFNGLPATHTEXGENNVPROC)&RecordingTableDecorator::m_glPathTexGenNV_recording;
+if(this->m_ptr_glVertexBlendEnviATI)this->m_ptr_glVertexBlendEnviATI = (FunctionTable::MEMBERPFNGLVERTEXBLENDENVIATIPROC)&RecordingTableDecorator::m_glVertexBlendEnviATI_recording;
+if(this->m_ptr_glUniform3i64ARB)this->m_ptr_glUniform3i64ARB = (FunctionTable::MEMBERPFNGLUNIFORM3I64ARBPROC)&RecordingTableDecorator::m_glUniform3i64ARB_recording;
+if(this->m_ptr_glLoadMatrixf)this->m_ptr_glLoadMatrixf = (FunctionTable::MEMBERPFNGLLOADMATRIXFPROC)&RecordingTableDecorator::m_glLoadMatrixf_recording;
+if(this->m_ptr_glProgramUniform2dEXT)this->m_ptr_glProgramUniform2dEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2DEXTPROC)&RecordingTableDecorator::m_glProgramUniform2dEXT_recording;
+if(this->m_ptr_glVertexAttribI4iv)this->m_ptr_glVertexAttribI4iv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4IVPROC)&RecordingTableDecorator::m_glVertexAttribI4iv_recording;
+if(this->m_ptr_glNamedFramebufferDrawBuffer)this->m_ptr_glNamedFramebufferDrawBuffer = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC)&RecordingTableDecorator::m_glNamedFramebufferDrawBuffer_recording;
+if(this->m_ptr_glColor4ubv)this->m_ptr_glColor4ubv = (FunctionTable::MEMBERPFNGLCOLOR4UBVPROC)&RecordingTableDecorator::m_glColor4ubv_recording;
+if(this->m_ptr_glColor3hvNV)this->m_ptr_glColor3hvNV = (FunctionTable::MEMBERPFNGLCOLOR3HVNVPROC)&RecordingTableDecorator::m_glColor3hvNV_recording;
+if(this->m_ptr_glGetMapAttribParameterfvNV)this->m_ptr_glGetMapAttribParameterfvNV = (FunctionTable::MEMBERPFNGLGETMAPATTRIBPARAMETERFVNVPROC)&RecordingTableDecorator::m_glGetMapAttribParameterfvNV_recording;
+if(this->m_ptr_glGetBufferSubData)this->m_ptr_glGetBufferSubData = (FunctionTable::MEMBERPFNGLGETBUFFERSUBDATAPROC)&RecordingTableDecorator::m_glGetBufferSubData_recording;
+if(this->m_ptr_glGetVertexAttribLdv)this->m_ptr_glGetVertexAttribLdv = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBLDVPROC)&RecordingTableDecorator::m_glGetVertexAttribLdv_recording;
+if(this->m_ptr_glGetnUniformuiv)this->m_ptr_glGetnUniformuiv = (FunctionTable::MEMBERPFNGLGETNUNIFORMUIVPROC)&RecordingTableDecorator::m_glGetnUniformuiv_recording;
+if(this->m_ptr_glGetUniformui64vNV)this->m_ptr_glGetUniformui64vNV = (FunctionTable::MEMBERPFNGLGETUNIFORMUI64VNVPROC)&RecordingTableDecorator::m_glGetUniformui64vNV_recording;
+if(this->m_ptr_glNamedRenderbufferStorageEXT)this->m_ptr_glNamedRenderbufferStorageEXT = (FunctionTable::MEMBERPFNGLNAMEDRENDERBUFFERSTORAGEEXTPROC)&RecordingTableDecorator::m_glNamedRenderbufferStorageEXT_recording;
+if(this->m_ptr_glVertexAttrib3dNV)this->m_ptr_glVertexAttrib3dNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3DNVPROC)&RecordingTableDecorator::m_glVertexAttrib3dNV_recording;
+if(this->m_ptr_glTextureStorage1DEXT)this->m_ptr_glTextureStorage1DEXT = (FunctionTable::MEMBERPFNGLTEXTURESTORAGE1DEXTPROC)&RecordingTableDecorator::m_glTextureStorage1DEXT_recording;
+if(this->m_ptr_glPixelTexGenParameteriSGIS)this->m_ptr_glPixelTexGenParameteriSGIS = (FunctionTable::MEMBERPFNGLPIXELTEXGENPARAMETERISGISPROC)&RecordingTableDecorator::m_glPixelTexGenParameteriSGIS_recording;
+if(this->m_ptr_glColorTableEXT)this->m_ptr_glColorTableEXT = (FunctionTable::MEMBERPFNGLCOLORTABLEEXTPROC)&RecordingTableDecorator::m_glColorTableEXT_recording;
+if(this->m_ptr_glGenBuffers)this->m_ptr_glGenBuffers = (FunctionTable::MEMBERPFNGLGENBUFFERSPROC)&RecordingTableDecorator::m_glGenBuffers_recording;
+if(this->m_ptr_glMultiTexCoord3xvOES)this->m_ptr_glMultiTexCoord3xvOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3XVOESPROC)&RecordingTableDecorator::m_glMultiTexCoord3xvOES_recording;
+if(this->m_ptr_glExecuteProgramNV)this->m_ptr_glExecuteProgramNV = (FunctionTable::MEMBERPFNGLEXECUTEPROGRAMNVPROC)&RecordingTableDecorator::m_glExecuteProgramNV_recording;
+if(this->m_ptr_glVariantArrayObjectATI)this->m_ptr_glVariantArrayObjectATI = (FunctionTable::MEMBERPFNGLVARIANTARRAYOBJECTATIPROC)&RecordingTableDecorator::m_glVariantArrayObjectATI_recording;
+if(this->m_ptr_glColor3xvOES)this->m_ptr_glColor3xvOES = (FunctionTable::MEMBERPFNGLCOLOR3XVOESPROC)&RecordingTableDecorator::m_glColor3xvOES_recording;
+if(this->m_ptr_glGetnConvolutionFilterARB)this->m_ptr_glGetnConvolutionFilterARB = (FunctionTable::MEMBERPFNGLGETNCONVOLUTIONFILTERARBPROC)&RecordingTableDecorator::m_glGetnConvolutionFilterARB_recording;
+if(this->m_ptr_glNormalFormatNV)this->m_ptr_glNormalFormatNV = (FunctionTable::MEMBERPFNGLNORMALFORMATNVPROC)&RecordingTableDecorator::m_glNormalFormatNV_recording;
+if(this->m_ptr_glGetInvariantFloatvEXT)this->m_ptr_glGetInvariantFloatvEXT = (FunctionTable::MEMBERPFNGLGETINVARIANTFLOATVEXTPROC)&RecordingTableDecorator::m_glGetInvariantFloatvEXT_recording;
+if(this->m_ptr_glClearNamedFramebufferiv)this->m_ptr_glClearNamedFramebufferiv = (FunctionTable::MEMBERPFNGLCLEARNAMEDFRAMEBUFFERIVPROC)&RecordingTableDecorator::m_glClearNamedFramebufferiv_recording;
+if(this->m_ptr_glTexImage3D)this->m_ptr_glTexImage3D = (FunctionTable::MEMBERPFNGLTEXIMAGE3DPROC)&RecordingTableDecorator::m_glTexImage3D_recording;
+if(this->m_ptr_glGenSamplers)this->m_ptr_glGenSamplers = (FunctionTable::MEMBERPFNGLGENSAMPLERSPROC)&RecordingTableDecorator::m_glGenSamplers_recording;
+if(this->m_ptr_glIsFramebuffer)this->m_ptr_glIsFramebuffer = (FunctionTable::MEMBERPFNGLISFRAMEBUFFERPROC)&RecordingTableDecorator::m_glIsFramebuffer_recording;
+if(this->m_ptr_glProgramUniform3dvEXT)this->m_ptr_glProgramUniform3dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3DVEXTPROC)&RecordingTableDecorator::m_glProgramUniform3dvEXT_recording;
+if(this->m_ptr_glGetVertexAttribfvNV)this->m_ptr_glGetVertexAttribfvNV = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBFVNVPROC)&RecordingTableDecorator::m_glGetVertexAttribfvNV_recording;
+if(this->m_ptr_glDrawRangeElementArrayAPPLE)this->m_ptr_glDrawRangeElementArrayAPPLE = (FunctionTable::MEMBERPFNGLDRAWRANGEELEMENTARRAYAPPLEPROC)&RecordingTableDecorator::m_glDrawRangeElementArrayAPPLE_recording;
+if(this->m_ptr_glUniform3i64NV)this->m_ptr_glUniform3i64NV = (FunctionTable::MEMBERPFNGLUNIFORM3I64NVPROC)&RecordingTableDecorator::m_glUniform3i64NV_recording;
+if(this->m_ptr_glMatrixPopEXT)this->m_ptr_glMatrixPopEXT = (FunctionTable::MEMBERPFNGLMATRIXPOPEXTPROC)&RecordingTableDecorator::m_glMatrixPopEXT_recording;
+if(this->m_ptr_glVertexStream1sATI)this->m_ptr_glVertexStream1sATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM1SATIPROC)&RecordingTableDecorator::m_glVertexStream1sATI_recording;
+if(this->m_ptr_glGetnPixelMapuivARB)this->m_ptr_glGetnPixelMapuivARB = (FunctionTable::MEMBERPFNGLGETNPIXELMAPUIVARBPROC)&RecordingTableDecorator::m_glGetnPixelMapuivARB_recording;
+if(this->m_ptr_glMultiTexEnviEXT)this->m_ptr_glMultiTexEnviEXT = (FunctionTable::MEMBERPFNGLMULTITEXENVIEXTPROC)&RecordingTableDecorator::m_glMultiTexEnviEXT_recording;
+if(this->m_ptr_glVertexAttribI2iEXT)this->m_ptr_glVertexAttribI2iEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI2IEXTPROC)&RecordingTableDecorator::m_glVertexAttribI2iEXT_recording;
+if(this->m_ptr_glProgramParameter4fvNV)this->m_ptr_glProgramParameter4fvNV = (FunctionTable::MEMBERPFNGLPROGRAMPARAMETER4FVNVPROC)&RecordingTableDecorator::m_glProgramParameter4fvNV_recording;
+if(this->m_ptr_glNamedFramebufferSampleLocationsfvNV)this->m_ptr_glNamedFramebufferSampleLocationsfvNV = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERSAMPLELOCATIONSFVNVPROC)&RecordingTableDecorator::m_glNamedFramebufferSampleLocationsfvNV_recording;
+if(this->m_ptr_glTexCoordP4uiv)this->m_ptr_glTexCoordP4uiv = (FunctionTable::MEMBERPFNGLTEXCOORDP4UIVPROC)&RecordingTableDecorator::m_glTexCoordP4uiv_recording;
+if(this->m_ptr_glRectxvOES)this->m_ptr_glRectxvOES = (FunctionTable::MEMBERPFNGLRECTXVOESPROC)&RecordingTableDecorator::m_glRectxvOES_recording;
+if(this->m_ptr_glGetVariantIntegervEXT)this->m_ptr_glGetVariantIntegervEXT = (FunctionTable::MEMBERPFNGLGETVARIANTINTEGERVEXTPROC)&RecordingTableDecorator::m_glGetVariantIntegervEXT_recording;
+if(this->m_ptr_glDeleteLists)this->m_ptr_glDeleteLists = (FunctionTable::MEMBERPFNGLDELETELISTSPROC)&RecordingTableDecorator::m_glDeleteLists_recording;
+if(this->m_ptr_glTexGendv)this->m_ptr_glTexGendv = (FunctionTable::MEMBERPFNGLTEXGENDVPROC)&RecordingTableDecorator::m_glTexGendv_recording;
+if(this->m_ptr_glVertexP2uiv)this->m_ptr_glVertexP2uiv = (FunctionTable::MEMBERPFNGLVERTEXP2UIVPROC)&RecordingTableDecorator::m_glVertexP2uiv_recording;
+if(this->m_ptr_glGetPerfMonitorGroupsAMD)this->m_ptr_glGetPerfMonitorGroupsAMD = (FunctionTable::MEMBERPFNGLGETPERFMONITORGROUPSAMDPROC)&RecordingTableDecorator::m_glGetPerfMonitorGroupsAMD_recording;
+if(this->m_ptr_glMultTransposeMatrixfARB)this->m_ptr_glMultTransposeMatrixfARB = (FunctionTable::MEMBERPFNGLMULTTRANSPOSEMATRIXFARBPROC)&RecordingTableDecorator::m_glMultTransposeMatrixfARB_recording;
+if(this->m_ptr_glVertexAttribI2ivEXT)this->m_ptr_glVertexAttribI2ivEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI2IVEXTPROC)&RecordingTableDecorator::m_glVertexAttribI2ivEXT_recording;
+if(this->m_ptr_glReplacementCodeuiColor4fNormal3fVertex3fvSUN)this->m_ptr_glReplacementCodeuiColor4fNormal3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUICOLOR4FNORMAL3FVERTEX3FVSUNPROC)&RecordingTableDecorator::m_glReplacementCodeuiColor4fNormal3fVertex3fvSUN_recording;
+if(this->m_ptr_glDeleteStatesNV)this->m_ptr_glDeleteStatesNV = (FunctionTable::MEMBERPFNGLDELETESTATESNVPROC)&RecordingTableDecorator::m_glDeleteStatesNV_recording;
+if(this->m_ptr_glGetBufferParameteri64v)this->m_ptr_glGetBufferParameteri64v = (FunctionTable::MEMBERPFNGLGETBUFFERPARAMETERI64VPROC)&RecordingTableDecorator::m_glGetBufferParameteri64v_recording;
+if(this->m_ptr_glProgramUniform4dv)this->m_ptr_glProgramUniform4dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4DVPROC)&RecordingTableDecorator::m_glProgramUniform4dv_recording;
+if(this->m_ptr_glEdgeFlagPointerEXT)this->m_ptr_glEdgeFlagPointerEXT = (FunctionTable::MEMBERPFNGLEDGEFLAGPOINTEREXTPROC)&RecordingTableDecorator::m_glEdgeFlagPointerEXT_recording;
+if(this->m_ptr_glVideoCaptureStreamParameterivNV)this->m_ptr_glVideoCaptureStreamParameterivNV = (FunctionTable::MEMBERPFNGLVIDEOCAPTURESTREAMPARAMETERIVNVPROC)&RecordingTableDecorator::m_glVideoCaptureStreamParameterivNV_recording;
+if(this->m_ptr_glVertexStream4iATI)this->m_ptr_glVertexStream4iATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM4IATIPROC)&RecordingTableDecorator::m_glVertexStream4iATI_recording;
+if(this->m_ptr_glVDPAUFiniNV)this->m_ptr_glVDPAUFiniNV = (FunctionTable::MEMBERPFNGLVDPAUFININVPROC)&RecordingTableDecorator::m_glVDPAUFiniNV_recording;
+if(this->m_ptr_glMakeBufferNonResidentNV)this->m_ptr_glMakeBufferNonResidentNV = (FunctionTable::MEMBERPFNGLMAKEBUFFERNONRESIDENTNVPROC)&RecordingTableDecorator::m_glMakeBufferNonResidentNV_recording;
+if(this->m_ptr_glUniform1ui64ARB)this->m_ptr_glUniform1ui64ARB = (FunctionTable::MEMBERPFNGLUNIFORM1UI64ARBPROC)&RecordingTableDecorator::m_glUniform1ui64ARB_recording;
+if(this->m_ptr_glStencilStrokePathNV)this->m_ptr_glStencilStrokePathNV = (FunctionTable::MEMBERPFNGLSTENCILSTROKEPATHNVPROC)&RecordingTableDecorator::m_glStencilStrokePathNV_recording;
+if(this->m_ptr_glProgramUniform3uiv)this->m_ptr_glProgramUniform3uiv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UIVPROC)&RecordingTableDecorator::m_glProgramUniform3uiv_recording;
+if(this->m_ptr_glVariantuivEXT)this->m_ptr_glVariantuivEXT = (FunctionTable::MEMBERPFNGLVARIANTUIVEXTPROC)&RecordingTableDecorator::m_glVariantuivEXT_recording;
+if(this->m_ptr_glCopyTexSubImage3DEXT)this->m_ptr_glCopyTexSubImage3DEXT = (FunctionTable::MEMBERPFNGLCOPYTEXSUBIMAGE3DEXTPROC)&RecordingTableDecorator::m_glCopyTexSubImage3DEXT_recording;
+if(this->m_ptr_glSpriteParameteriSGIX)this->m_ptr_glSpriteParameteriSGIX = (FunctionTable::MEMBERPFNGLSPRITEPARAMETERISGIXPROC)&RecordingTableDecorator::m_glSpriteParameteriSGIX_recording;
+if(this->m_ptr_glMultiTexCoord1sARB)this->m_ptr_glMultiTexCoord1sARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1SARBPROC)&RecordingTableDecorator::m_glMultiTexCoord1sARB_recording;
+if(this->m_ptr_glConvolutionParameterfv)this->m_ptr_glConvolutionParameterfv = (FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERFVPROC)&RecordingTableDecorator::m_glConvolutionParameterfv_recording;
+if(this->m_ptr_glMakeTextureHandleResidentNV)this->m_ptr_glMakeTextureHandleResidentNV = (FunctionTable::MEMBERPFNGLMAKETEXTUREHANDLERESIDENTNVPROC)&RecordingTableDecorator::m_glMakeTextureHandleResidentNV_recording;
+if(this->m_ptr_glMultMatrixxOES)this->m_ptr_glMultMatrixxOES = (FunctionTable::MEMBERPFNGLMULTMATRIXXOESPROC)&RecordingTableDecorator::m_glMultMatrixxOES_recording;
+if(this->m_ptr_glTextureNormalEXT)this->m_ptr_glTextureNormalEXT = (FunctionTable::MEMBERPFNGLTEXTURENORMALEXTPROC)&RecordingTableDecorator::m_glTextureNormalEXT_recording;
+if(this->m_ptr_glGetQueryivARB)this->m_ptr_glGetQueryivARB = (FunctionTable::MEMBERPFNGLGETQUERYIVARBPROC)&RecordingTableDecorator::m_glGetQueryivARB_recording;
+if(this->m_ptr_glCompressedMultiTexImage3DEXT)this->m_ptr_glCompressedMultiTexImage3DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDMULTITEXIMAGE3DEXTPROC)&RecordingTableDecorator::m_glCompressedMultiTexImage3DEXT_recording;
+if(this->m_ptr_glGetInstrumentsSGIX)this->m_ptr_glGetInstrumentsSGIX = (FunctionTable::MEMBERPFNGLGETINSTRUMENTSSGIXPROC)&RecordingTableDecorator::m_glGetInstrumentsSGIX_recording;
+if(this->m_ptr_glProgramUniformMatrix4x3fvEXT)this->m_ptr_glProgramUniformMatrix4x3fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X3FVEXTPROC)&RecordingTableDecorator::m_glProgramUniformMatrix4x3fvEXT_recording;
+if(this->m_ptr_glPointParameterf)this->m_ptr_glPointParameterf = (FunctionTable::MEMBERPFNGLPOINTPARAMETERFPROC)&RecordingTableDecorator::m_glPointParameterf_recording;
+if(this->m_ptr_glProgramUniform3dEXT)this->m_ptr_glProgramUniform3dEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3DEXTPROC)&RecordingTableDecorator::m_glProgramUniform3dEXT_recording;
+if(this->m_ptr_glMultiTexCoord2hNV)this->m_ptr_glMultiTexCoord2hNV = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2HNVPROC)&RecordingTableDecorator::m_glMultiTexCoord2hNV_recording;
+if(this->m_ptr_glGetConvolutionFilterEXT)this->m_ptr_glGetConvolutionFilterEXT = (FunctionTable::MEMBERPFNGLGETCONVOLUTIONFILTEREXTPROC)&RecordingTableDecorator::m_glGetConvolutionFilterEXT_recording;
+if(this->m_ptr_glVertexAttrib2hNV)this->m_ptr_glVertexAttrib2hNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2HNVPROC)&RecordingTableDecorator::m_glVertexAttrib2hNV_recording;
+if(this->m_ptr_glCurrentPaletteMatrixARB)this->m_ptr_glCurrentPaletteMatrixARB = (FunctionTable::MEMBERPFNGLCURRENTPALETTEMATRIXARBPROC)&RecordingTableDecorator::m_glCurrentPaletteMatrixARB_recording;
+if(this->m_ptr_glFogxvOES)this->m_ptr_glFogxvOES = (FunctionTable::MEMBERPFNGLFOGXVOESPROC)&RecordingTableDecorator::m_glFogxvOES_recording;
+if(this->m_ptr_glCreateRenderbuffers)this->m_ptr_glCreateRenderbuffers = (FunctionTable::MEMBERPFNGLCREATERENDERBUFFERSPROC)&RecordingTableDecorator::m_glCreateRenderbuffers_recording;
+if(this->m_ptr_glVertexAttrib4Nusv)this->m_ptr_glVertexAttrib4Nusv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUSVPROC)&RecordingTableDecorator::m_glVertexAttrib4Nusv_recording;
+if(this->m_ptr_glCombinerInputNV)this->m_ptr_glCombinerInputNV = (FunctionTable::MEMBERPFNGLCOMBINERINPUTNVPROC)&RecordingTableDecorator::m_glCombinerInputNV_recording;
+if(this->m_ptr_glDepthFunc)this->m_ptr_glDepthFunc = (FunctionTable::MEMBERPFNGLDEPTHFUNCPROC)&RecordingTableDecorator::m_glDepthFunc_recording;
+if(this->m_ptr_glWindowPos4fMESA)this->m_ptr_glWindowPos4fMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS4FMESAPROC)&RecordingTableDecorator::m_glWindowPos4fMESA_recording;
+if(this->m_ptr_glEnableClientStateIndexedEXT)this->m_ptr_glEnableClientStateIndexedEXT = (FunctionTable::MEMBERPFNGLENABLECLIENTSTATEINDEXEDEXTPROC)&RecordingTableDecorator::m_glEnableClientStateIndexedEXT_recording;
+if(this->m_ptr_glTexCoord4iv)this->m_ptr_glTexCoord4iv = (FunctionTable::MEMBERPFNGLTEXCOORD4IVPROC)&RecordingTableDecorator::m_glTexCoord4iv_recording;
+if(this->m_ptr_glProgramUniform4i64ARB)this->m_ptr_glProgramUniform4i64ARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4I64ARBPROC)&RecordingTableDecorator::m_glProgramUniform4i64ARB_recording;
+if(this->m_ptr_glBlendFunci)this->m_ptr_glBlendFunci = (FunctionTable::MEMBERPFNGLBLENDFUNCIPROC)&RecordingTableDecorator::m_glBlendFunci_recording;
+if(this->m_ptr_glResolveDepthValuesNV)this->m_ptr_glResolveDepthValuesNV = (FunctionTable::MEMBERPFNGLRESOLVEDEPTHVALUESNVPROC)&RecordingTableDecorator::m_glResolveDepthValuesNV_recording;
+if(this->m_ptr_glTextureColorMaskSGIS)this->m_ptr_glTextureColorMaskSGIS = (FunctionTable::MEMBERPFNGLTEXTURECOLORMASKSGISPROC)&RecordingTableDecorator::m_glTextureColorMaskSGIS_recording;
+if(this->m_ptr_glCreateShaderProgramEXT)this->m_ptr_glCreateShaderProgramEXT = (FunctionTable::MEMBERPFNGLCREATESHADERPROGRAMEXTPROC)&RecordingTableDecorator::m_glCreateShaderProgramEXT_recording;
+if(this->m_ptr_glBufferStorage)this->m_ptr_glBufferStorage = (FunctionTable::MEMBERPFNGLBUFFERSTORAGEPROC)&RecordingTableDecorator::m_glBufferStorage_recording;
+if(this->m_ptr_glMakeNamedBufferNonResidentNV)this->m_ptr_glMakeNamedBufferNonResidentNV = (FunctionTable::MEMBERPFNGLMAKENAMEDBUFFERNONRESIDENTNVPROC)&RecordingTableDecorator::m_glMakeNamedBufferNonResidentNV_recording;
+if(this->m_ptr_glRenderbufferStorageMultisampleEXT)this->m_ptr_glRenderbufferStorageMultisampleEXT = (FunctionTable::MEMBERPFNGLRENDERBUFFERSTORAGEMULTISAMPLEEXTPROC)&RecordingTableDecorator::m_glRenderbufferStorageMultisampleEXT_recording;
+if(this->m_ptr_glGetFloati_v)this->m_ptr_glGetFloati_v = (FunctionTable::MEMBERPFNGLGETFLOATI_VPROC)&RecordingTableDecorator::m_glGetFloati_v_recording;
+if(this->m_ptr_glUniform2ui64ARB)this->m_ptr_glUniform2ui64ARB = (FunctionTable::MEMBERPFNGLUNIFORM2UI64ARBPROC)&RecordingTableDecorator::m_glUniform2ui64ARB_recording;
+if(this->m_ptr_glVertex3fv)this->m_ptr_glVertex3fv = (FunctionTable::MEMBERPFNGLVERTEX3FVPROC)&RecordingTableDecorator::m_glVertex3fv_recording;
+if(this->m_ptr_glGetUniformLocation)this->m_ptr_glGetUniformLocation = (FunctionTable::MEMBERPFNGLGETUNIFORMLOCATIONPROC)&RecordingTableDecorator::m_glGetUniformLocation_recording;
+if(this->m_ptr_glVertexStream1svATI)this->m_ptr_glVertexStream1svATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM1SVATIPROC)&RecordingTableDecorator::m_glVertexStream1svATI_recording;
+if(this->m_ptr_glVertexStream3fATI)this->m_ptr_glVertexStream3fATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM3FATIPROC)&RecordingTableDecorator::m_glVertexStream3fATI_recording;
+if(this->m_ptr_glNamedFramebufferDrawBuffers)this->m_ptr_glNamedFramebufferDrawBuffers = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC)&RecordingTableDecorator::m_glNamedFramebufferDrawBuffers_recording;
+if(this->m_ptr_glUniform2ui64vNV)this->m_ptr_glUniform2ui64vNV = (FunctionTable::MEMBERPFNGLUNIFORM2UI64VNVPROC)&RecordingTableDecorator::m_glUniform2ui64vNV_recording;
+if(this->m_ptr_glTexCoordPointervINTEL)this->m_ptr_glTexCoordPointervINTEL = (FunctionTable::MEMBERPFNGLTEXCOORDPOINTERVINTELPROC)&RecordingTableDecorator::m_glTexCoordPointervINTEL_recording;
+if(this->m_ptr_glUniform4fv)this->m_ptr_glUniform4fv = (FunctionTable::MEMBERPFNGLUNIFORM4FVPROC)&RecordingTableDecorator::m_glUniform4fv_recording;
+if(this->m_ptr_glNormalPointerEXT)this->m_ptr_glNormalPointerEXT = (FunctionTable::MEMBERPFNGLNORMALPOINTEREXTPROC)&RecordingTableDecorator::m_glNormalPointerEXT_recording;
+if(this->m_ptr_glVertexAttrib4hNV)this->m_ptr_glVertexAttrib4hNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4HNVPROC)&RecordingTableDecorator::m_glVertexAttrib4hNV_recording;
+if(this->m_ptr_glNormal3f)this->m_ptr_glNormal3f = (FunctionTable::MEMBERPFNGLNORMAL3FPROC)&RecordingTableDecorator::m_glNormal3f_recording;
+if(this->m_ptr_glVertexStream2iATI)this->m_ptr_glVertexStream2iATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM2IATIPROC)&RecordingTableDecorator::m_glVertexStream2iATI_recording;
+if(this->m_ptr_glVertexAttribP4uiv)this->m_ptr_glVertexAttribP4uiv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBP4UIVPROC)&RecordingTableDecorator::m_glVertexAttribP4uiv_recording;
+if(this->m_ptr_glCompressedTextureSubImage3D)this->m_ptr_glCompressedTextureSubImage3D = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC)&RecordingTableDecorator::m_glCompressedTextureSubImage3D_recording;
+if(this->m_ptr_glAsyncMarkerSGIX)this->m_ptr_glAsyncMarkerSGIX = (FunctionTable::MEMBERPFNGLASYNCMARKERSGIXPROC)&RecordingTableDecorator::m_glAsyncMarkerSGIX_recording;
+if(this->m_ptr_glTextureStorageSparseAMD)this->m_ptr_glTextureStorageSparseAMD = (FunctionTable::MEMBERPFNGLTEXTURESTORAGESPARSEAMDPROC)&RecordingTableDecorator::m_glTextureStorageSparseAMD_recording;
+if(this->m_ptr_glGetConvolutionParameterivEXT)this->m_ptr_glGetConvolutionParameterivEXT = (FunctionTable::MEMBERPFNGLGETCONVOLUTIONPARAMETERIVEXTPROC)&RecordingTableDecorator::m_glGetConvolutionParameterivEXT_recording;
+if(this->m_ptr_glEndPerfQueryINTEL)this->m_ptr_glEndPerfQueryINTEL = (FunctionTable::MEMBERPFNGLENDPERFQUERYINTELPROC)&RecordingTableDecorator::m_glEndPerfQueryINTEL_recording;
+if(this->m_ptr_glFragmentLightModeliSGIX)this->m_ptr_glFragmentLightModeliSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTLIGHTMODELISGIXPROC)&RecordingTableDecorator::m_glFragmentLightModeliSGIX_recording;
+if(this->m_ptr_glPrioritizeTexturesEXT)this->m_ptr_glPrioritizeTexturesEXT = (FunctionTable::MEMBERPFNGLPRIORITIZETEXTURESEXTPROC)&RecordingTableDecorator::m_glPrioritizeTexturesEXT_recording;
+if(this->m_ptr_glEndConditionalRender)this->m_ptr_glEndConditionalRender = (FunctionTable::MEMBERPFNGLENDCONDITIONALRENDERPROC)&RecordingTableDecorator::m_glEndConditionalRender_recording;
+if(this->m_ptr_glEnableClientState)this->m_ptr_glEnableClientState = (FunctionTable::MEMBERPFNGLENABLECLIENTSTATEPROC)&RecordingTableDecorator::m_glEnableClientState_recording;
+if(this->m_ptr_glResetHistogram)this->m_ptr_glResetHistogram = (FunctionTable::MEMBERPFNGLRESETHISTOGRAMPROC)&RecordingTableDecorator::m_glResetHistogram_recording;
+if(this->m_ptr_glGetOcclusionQueryivNV)this->m_ptr_glGetOcclusionQueryivNV = (FunctionTable::MEMBERPFNGLGETOCCLUSIONQUERYIVNVPROC)&RecordingTableDecorator::m_glGetOcclusionQueryivNV_recording;
+if(this->m_ptr_glUniform1uiEXT)this->m_ptr_glUniform1uiEXT = (FunctionTable::MEMBERPFNGLUNIFORM1UIEXTPROC)&RecordingTableDecorator::m_glUniform1uiEXT_recording;
+if(this->m_ptr_glMultiTexCoord2sv)this->m_ptr_glMultiTexCoord2sv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2SVPROC)&RecordingTableDecorator::m_glMultiTexCoord2sv_recording;
+if(this->m_ptr_glTexSubImage2DEXT)this->m_ptr_glTexSubImage2DEXT = (FunctionTable::MEMBERPFNGLTEXSUBIMAGE2DEXTPROC)&RecordingTableDecorator::m_glTexSubImage2DEXT_recording;
+if(this->m_ptr_glProgramUniform2uiv)this->m_ptr_glProgramUniform2uiv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UIVPROC)&RecordingTableDecorator::m_glProgramUniform2uiv_recording;
+if(this->m_ptr_glMultiTexCoord2iARB)this->m_ptr_glMultiTexCoord2iARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2IARBPROC)&RecordingTableDecorator::m_glMultiTexCoord2iARB_recording;
+if(this->m_ptr_glGetQueryObjectuiv)this->m_ptr_glGetQueryObjectuiv = (FunctionTable::MEMBERPFNGLGETQUERYOBJECTUIVPROC)&RecordingTableDecorator::m_glGetQueryObjectuiv_recording;
+if(this->m_ptr_glGenerateMultiTexMipmapEXT)this->m_ptr_glGenerateMultiTexMipmapEXT = (FunctionTable::MEMBERPFNGLGENERATEMULTITEXMIPMAPEXTPROC)&RecordingTableDecorator::m_glGenerateMultiTexMipmapEXT_recording;
+if(this->m_ptr_glVertexAttrib4iv)this->m_ptr_glVertexAttrib4iv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4IVPROC)&RecordingTableDecorator::m_glVertexAttrib4iv_recording;
+if(this->m_ptr_glWindowPos3dvMESA)this->m_ptr_glWindowPos3dvMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS3DVMESAPROC)&RecordingTableDecorator::m_glWindowPos3dvMESA_recording;
+if(this->m_ptr_glLabelObjectEXT)this->m_ptr_glLabelObjectEXT = (FunctionTable::MEMBERPFNGLLABELOBJECTEXTPROC)&RecordingTableDecorator::m_glLabelObjectEXT_recording;
+if(this->m_ptr_glProgramUniform1uiv)this->m_ptr_glProgramUniform1uiv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UIVPROC)&RecordingTableDecorator::m_glProgramUniform1uiv_recording;
+if(this->m_ptr_glFramebufferTexture)this->m_ptr_glFramebufferTexture = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTUREPROC)&RecordingTableDecorator::m_glFramebufferTexture_recording;
+if(this->m_ptr_glMultiTexEnvfEXT)this->m_ptr_glMultiTexEnvfEXT = (FunctionTable::MEMBERPFNGLMULTITEXENVFEXTPROC)&RecordingTableDecorator::m_glMultiTexEnvfEXT_recording;
+if(this->m_ptr_glGetTexGendv)this->m_ptr_glGetTexGendv = (FunctionTable::MEMBERPFNGLGETTEXGENDVPROC)&RecordingTableDecorator::m_glGetTexGendv_recording;
+if(this->m_ptr_glVertex4xOES)this->m_ptr_glVertex4xOES = (FunctionTable::MEMBERPFNGLVERTEX4XOESPROC)&RecordingTableDecorator::m_glVertex4xOES_recording;
+if(this->m_ptr_glVertexAttribI2uivEXT)this->m_ptr_glVertexAttribI2uivEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI2UIVEXTPROC)&RecordingTableDecorator::m_glVertexAttribI2uivEXT_recording;
+if(this->m_ptr_glNamedProgramLocalParameter4fvEXT)this->m_ptr_glNamedProgramLocalParameter4fvEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETER4FVEXTPROC)&RecordingTableDecorator::m_glNamedProgramLocalParameter4fvEXT_recording;
+if(this->m_ptr_glPointParameterfvSGIS)this->m_ptr_glPointParameterfvSGIS = (FunctionTable::MEMBERPFNGLPOINTPARAMETERFVSGISPROC)&RecordingTableDecorator::m_glPointParameterfvSGIS_recording;
+if(this->m_ptr_glGetPixelTransformParameterfvEXT)this->m_ptr_glGetPixelTransformParameterfvEXT = (FunctionTable::MEMBERPFNGLGETPIXELTRANSFORMPARAMETERFVEXTPROC)&RecordingTableDecorator::m_glGetPixelTransformParameterfvEXT_recording;
+if(this->m_ptr_glIndexxvOES)this->m_ptr_glIndexxvOES = (FunctionTable::MEMBERPFNGLINDEXXVOESPROC)&RecordingTableDecorator::m_glIndexxvOES_recording;
+if(this->m_ptr_glDepthMask)this->m_ptr_glDepthMask = (FunctionTable::MEMBERPFNGLDEPTHMASKPROC)&RecordingTableDecorator::m_glDepthMask_recording;
+if(this->m_ptr_glProgramUniformMatrix2x4fv)this->m_ptr_glProgramUniformMatrix2x4fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X4FVPROC)&RecordingTableDecorator::m_glProgramUniformMatrix2x4fv_recording;
+if(this->m_ptr_glAreProgramsResidentNV)this->m_ptr_glAreProgramsResidentNV = (FunctionTable::MEMBERPFNGLAREPROGRAMSRESIDENTNVPROC)&RecordingTableDecorator::m_glAreProgramsResidentNV_recording;
+if(this->m_ptr_glColorTable)this->m_ptr_glColorTable = (FunctionTable::MEMBERPFNGLCOLORTABLEPROC)&RecordingTableDecorator::m_glColorTable_recording;
+if(this->m_ptr_glBeginQueryIndexed)this->m_ptr_glBeginQueryIndexed = (FunctionTable::MEMBERPFNGLBEGINQUERYINDEXEDPROC)&RecordingTableDecorator::m_glBeginQueryIndexed_recording;
+if(this->m_ptr_glVertexStream1dvATI)this->m_ptr_glVertexStream1dvATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM1DVATIPROC)&RecordingTableDecorator::m_glVertexStream1dvATI_recording;
+if(this->m_ptr_glGetMultiTexEnvfvEXT)this->m_ptr_glGetMultiTexEnvfvEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXENVFVEXTPROC)&RecordingTableDecorator::m_glGetMultiTexEnvfvEXT_recording;
+if(this->m_ptr_glDeleteFencesNV)this->m_ptr_glDeleteFencesNV = (FunctionTable::MEMBERPFNGLDELETEFENCESNVPROC)&RecordingTableDecorator::m_glDeleteFencesNV_recording;
+if(this->m_ptr_glVertexAttribs1dvNV)this->m_ptr_glVertexAttribs1dvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS1DVNVPROC)&RecordingTableDecorator::m_glVertexAttribs1dvNV_recording;
+if(this->m_ptr_glVertexStream2sATI)this->m_ptr_glVertexStream2sATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM2SATIPROC)&RecordingTableDecorator::m_glVertexStream2sATI_recording;
+if(this->m_ptr_glGetnSeparableFilterARB)this->m_ptr_glGetnSeparableFilterARB = (FunctionTable::MEMBERPFNGLGETNSEPARABLEFILTERARBPROC)&RecordingTableDecorator::m_glGetnSeparableFilterARB_recording;
+if(this->m_ptr_glProgramUniform2dv)this->m_ptr_glProgramUniform2dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2DVPROC)&RecordingTableDecorator::m_glProgramUniform2dv_recording;
+if(this->m_ptr_glActiveStencilFaceEXT)this->m_ptr_glActiveStencilFaceEXT = (FunctionTable::MEMBERPFNGLACTIVESTENCILFACEEXTPROC)&RecordingTableDecorator::m_glActiveStencilFaceEXT_recording;
+if(this->m_ptr_glProgramUniform4dEXT)this->m_ptr_glProgramUniform4dEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4DEXTPROC)&RecordingTableDecorator::m_glProgramUniform4dEXT_recording;
+if(this->m_ptr_glPointSizexOES)this->m_ptr_glPointSizexOES = (FunctionTable::MEMBERPFNGLPOINTSIZEXOESPROC)&RecordingTableDecorator::m_glPointSizexOES_recording;
+if(this->m_ptr_glRasterPos2sv)this->m_ptr_glRasterPos2sv = (FunctionTable::MEMBERPFNGLRASTERPOS2SVPROC)&RecordingTableDecorator::m_glRasterPos2sv_recording;
+if(this->m_ptr_glBindParameterEXT)this->m_ptr_glBindParameterEXT = (FunctionTable::MEMBERPFNGLBINDPARAMETEREXTPROC)&RecordingTableDecorator::m_glBindParameterEXT_recording;
+if(this->m_ptr_glTexCoord1sv)this->m_ptr_glTexCoord1sv = (FunctionTable::MEMBERPFNGLTEXCOORD1SVPROC)&RecordingTableDecorator::m_glTexCoord1sv_recording;
+if(this->m_ptr_glBlendParameteriNV)this->m_ptr_glBlendParameteriNV = (FunctionTable::MEMBERPFNGLBLENDPARAMETERINVPROC)&RecordingTableDecorator::m_glBlendParameteriNV_recording;
+if(this->m_ptr_glNamedProgramLocalParameter4dvEXT)this->m_ptr_glNamedProgramLocalParameter4dvEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETER4DVEXTPROC)&RecordingTableDecorator::m_glNamedProgramLocalParameter4dvEXT_recording;
+if(this->m_ptr_glProgramUniformHandleui64NV)this->m_ptr_glProgramUniformHandleui64NV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMHANDLEUI64NVPROC)&RecordingTableDecorator::m_glProgramUniformHandleui64NV_recording;
+if(this->m_ptr_glGetTextureParameterfvEXT)this->m_ptr_glGetTextureParameterfvEXT = (FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERFVEXTPROC)&RecordingTableDecorator::m_glGetTextureParameterfvEXT_recording;
+if(this->m_ptr_glGetPathMetricsNV)this->m_ptr_glGetPathMetricsNV = (FunctionTable::MEMBERPFNGLGETPATHMETRICSNVPROC)&RecordingTableDecorator::m_glGetPathMetricsNV_recording;
+if(this->m_ptr_glVertex2i)this->m_ptr_glVertex2i = (FunctionTable::MEMBERPFNGLVERTEX2IPROC)&RecordingTableDecorator::m_glVertex2i_recording;
+if(this->m_ptr_glNewList)this->m_ptr_glNewList = (FunctionTable::MEMBERPFNGLNEWLISTPROC)&RecordingTableDecorator::m_glNewList_recording;
+if(this->m_ptr_glMatrixLoad3x3fNV)this->m_ptr_glMatrixLoad3x3fNV = (FunctionTable::MEMBERPFNGLMATRIXLOAD3X3FNVPROC)&RecordingTableDecorator::m_glMatrixLoad3x3fNV_recording;
+if(this->m_ptr_glMultiTexCoord2fARB)this->m_ptr_glMultiTexCoord2fARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2FARBPROC)&RecordingTableDecorator::m_glMultiTexCoord2fARB_recording;
+if(this->m_ptr_glWeightdvARB)this->m_ptr_glWeightdvARB = (FunctionTable::MEMBERPFNGLWEIGHTDVARBPROC)&RecordingTableDecorator::m_glWeightdvARB_recording;
+if(this->m_ptr_glIsTransformFeedbackNV)this->m_ptr_glIsTransformFeedbackNV = (FunctionTable::MEMBERPFNGLISTRANSFORMFEEDBACKNVPROC)&RecordingTableDecorator::m_glIsTransformFeedbackNV_recording;
+if(this->m_ptr_glVertexAttribDivisorARB)this->m_ptr_glVertexAttribDivisorARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIBDIVISORARBPROC)&RecordingTableDecorator::m_glVertexAttribDivisorARB_recording;
+if(this->m_ptr_glSecondaryColorP3uiv)this->m_ptr_glSecondaryColorP3uiv = (FunctionTable::MEMBERPFNGLSECONDARYCOLORP3UIVPROC)&RecordingTableDecorator::m_glSecondaryColorP3uiv_recording;
+if(this->m_ptr_glGetnCompressedTexImageARB)this->m_ptr_glGetnCompressedTexImageARB = (FunctionTable::MEMBERPFNGLGETNCOMPRESSEDTEXIMAGEARBPROC)&RecordingTableDecorator::m_glGetnCompressedTexImageARB_recording;
+if(this->m_ptr_glGetIntegerv)this->m_ptr_glGetIntegerv = (FunctionTable::MEMBERPFNGLGETINTEGERVPROC)&RecordingTableDecorator::m_glGetIntegerv_recording;
+if(this->m_ptr_glMatrixLoaddEXT)this->m_ptr_glMatrixLoaddEXT = (FunctionTable::MEMBERPFNGLMATRIXLOADDEXTPROC)&RecordingTableDecorator::m_glMatrixLoaddEXT_recording;
+if(this->m_ptr_glGetPathLengthNV)this->m_ptr_glGetPathLengthNV = (FunctionTable::MEMBERPFNGLGETPATHLENGTHNVPROC)&RecordingTableDecorator::m_glGetPathLengthNV_recording;
+if(this->m_ptr_glProgramUniformMatrix3dv)this->m_ptr_glProgramUniformMatrix3dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3DVPROC)&RecordingTableDecorator::m_glProgramUniformMatrix3dv_recording;
+if(this->m_ptr_glUniform4i64NV)this->m_ptr_glUniform4i64NV = (FunctionTable::MEMBERPFNGLUNIFORM4I64NVPROC)&RecordingTableDecorator::m_glUniform4i64NV_recording;
+if(this->m_ptr_glGetHistogramEXT)this->m_ptr_glGetHistogramEXT = (FunctionTable::MEMBERPFNGLGETHISTOGRAMEXTPROC)&RecordingTableDecorator::m_glGetHistogramEXT_recording;
+if(this->m_ptr_glVertexAttrib4NuivARB)this->m_ptr_glVertexAttrib4NuivARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUIVARBPROC)&RecordingTableDecorator::m_glVertexAttrib4NuivARB_recording;
+if(this->m_ptr_glMapGrid2xOES)this->m_ptr_glMapGrid2xOES = (FunctionTable::MEMBERPFNGLMAPGRID2XOESPROC)&RecordingTableDecorator::m_glMapGrid2xOES_recording;
+if(this->m_ptr_glTexImage2D)this->m_ptr_glTexImage2D = (FunctionTable::MEMBERPFNGLTEXIMAGE2DPROC)&RecordingTableDecorator::m_glTexImage2D_recording;
+if(this->m_ptr_glWindowPos2fvARB)this->m_ptr_glWindowPos2fvARB = (FunctionTable::MEMBERPFNGLWINDOWPOS2FVARBPROC)&RecordingTableDecorator::m_glWindowPos2fvARB_recording;
+if(this->m_ptr_glEnableIndexedEXT)this->m_ptr_glEnableIndexedEXT = (FunctionTable::MEMBERPFNGLENABLEINDEXEDEXTPROC)&RecordingTableDecorator::m_glEnableIndexedEXT_recording;
+if(this->m_ptr_glTexCoord1bvOES)this->m_ptr_glTexCoord1bvOES = (FunctionTable::MEMBERPFNGLTEXCOORD1BVOESPROC)&RecordingTableDecorator::m_glTexCoord1bvOES_recording;
+if(this->m_ptr_glDrawPixels)this->m_ptr_glDrawPixels = (FunctionTable::MEMBERPFNGLDRAWPIXELSPROC)&RecordingTableDecorator::m_glDrawPixels_recording;
+if(this->m_ptr_glMultMatrixd)this->m_ptr_glMultMatrixd = (FunctionTable::MEMBERPFNGLMULTMATRIXDPROC)&RecordingTableDecorator::m_glMultMatrixd_recording;
+if(this->m_ptr_glMultMatrixf)this->m_ptr_glMultMatrixf = (FunctionTable::MEMBERPFNGLMULTMATRIXFPROC)&RecordingTableDecorator::m_glMultMatrixf_recording;
+if(this->m_ptr_glReplacementCodePointerSUN)this->m_ptr_glReplacementCodePointerSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEPOINTERSUNPROC)&RecordingTableDecorator::m_glReplacementCodePointerSUN_recording;
+if(this->m_ptr_glLoadTransposeMatrixdARB)this->m_ptr_glLoadTransposeMatrixdARB = (FunctionTable::MEMBERPFNGLLOADTRANSPOSEMATRIXDARBPROC)&RecordingTableDecorator::m_glLoadTransposeMatrixdARB_recording;
+if(this->m_ptr_glVertexAttrib4Nubv)this->m_ptr_glVertexAttrib4Nubv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUBVPROC)&RecordingTableDecorator::m_glVertexAttrib4Nubv_recording;
+if(this->m_ptr_glVertexArrayVertexAttribIOffsetEXT)this->m_ptr_glVertexArrayVertexAttribIOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBIOFFSETEXTPROC)&RecordingTableDecorator::m_glVertexArrayVertexAttribIOffsetEXT_recording;
+if(this->m_ptr_glCompileShaderARB)this->m_ptr_glCompileShaderARB = (FunctionTable::MEMBERPFNGLCOMPILESHADERARBPROC)&RecordingTableDecorator::m_glCompileShaderARB_recording;
+if(this->m_ptr_glWindowPos3dMESA)this->m_ptr_glWindowPos3dMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS3DMESAPROC)&RecordingTableDecorator::m_glWindowPos3dMESA_recording;
+if(this->m_ptr_glNormalStream3fvATI)this->m_ptr_glNormalStream3fvATI = (FunctionTable::MEMBERPFNGLNORMALSTREAM3FVATIPROC)&RecordingTableDecorator::m_glNormalStream3fvATI_recording;
+if(this->m_ptr_glColor4usv)this->m_ptr_glColor4usv = (FunctionTable::MEMBERPFNGLCOLOR4USVPROC)&RecordingTableDecorator::m_glColor4usv_recording;
+if(this->m_ptr_glMapGrid1f)this->m_ptr_glMapGrid1f = (FunctionTable::MEMBERPFNGLMAPGRID1FPROC)&RecordingTableDecorator::m_glMapGrid1f_recording;
+if(this->m_ptr_glPolygonStipple)this->m_ptr_glPolygonStipple = (FunctionTable::MEMBERPFNGLPOLYGONSTIPPLEPROC)&RecordingTableDecorator::m_glPolygonStipple_recording;
+if(this->m_ptr_glUniform4ui64ARB)this->m_ptr_glUniform4ui64ARB = (FunctionTable::MEMBERPFNGLUNIFORM4UI64ARBPROC)&RecordingTableDecorator::m_glUniform4ui64ARB_recording;
+if(this->m_ptr_glTextureRenderbufferEXT)this->m_ptr_glTextureRenderbufferEXT = (FunctionTable::MEMBERPFNGLTEXTURERENDERBUFFEREXTPROC)&RecordingTableDecorator::m_glTextureRenderbufferEXT_recording;
+if(this->m_ptr_glGetSubroutineUniformLocation)this->m_ptr_glGetSubroutineUniformLocation = (FunctionTable::MEMBERPFNGLGETSUBROUTINEUNIFORMLOCATIONPROC)&RecordingTableDecorator::m_glGetSubroutineUniformLocation_recording;
+if(this->m_ptr_glGetFramebufferParameteriv)this->m_ptr_glGetFramebufferParameteriv = (FunctionTable::MEMBERPFNGLGETFRAMEBUFFERPARAMETERIVPROC)&RecordingTableDecorator::m_glGetFramebufferParameteriv_recording;
+if(this->m_ptr_glPixelMapusv)this->m_ptr_glPixelMapusv = (FunctionTable::MEMBERPFNGLPIXELMAPUSVPROC)&RecordingTableDecorator::m_glPixelMapusv_recording;
+if(this->m_ptr_glGetSamplerParameteriv)this->m_ptr_glGetSamplerParameteriv = (FunctionTable::MEMBERPFNGLGETSAMPLERPARAMETERIVPROC)&RecordingTableDecorator::m_glGetSamplerParameteriv_recording;
+if(this->m_ptr_glVertexStream2fvATI)this->m_ptr_glVertexStream2fvATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM2FVATIPROC)&RecordingTableDecorator::m_glVertexStream2fvATI_recording;
+if(this->m_ptr_glProgramStringARB)this->m_ptr_glProgramStringARB = (FunctionTable::MEMBERPFNGLPROGRAMSTRINGARBPROC)&RecordingTableDecorator::m_glProgramStringARB_recording;
+if(this->m_ptr_glProgramUniformMatrix3dvEXT)this->m_ptr_glProgramUniformMatrix3dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3DVEXTPROC)&RecordingTableDecorator::m_glProgramUniformMatrix3dvEXT_recording;
+if(this->m_ptr_glSeparableFilter2D)this->m_ptr_glSeparableFilter2D = (FunctionTable::MEMBERPFNGLSEPARABLEFILTER2DPROC)&RecordingTableDecorator::m_glSeparableFilter2D_recording;
+if(this->m_ptr_glVertexAttribI1uiv)this->m_ptr_glVertexAttribI1uiv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI1UIVPROC)&RecordingTableDecorator::m_glVertexAttribI1uiv_recording;
+if(this->m_ptr_glTexStorage2D)this->m_ptr_glTexStorage2D = (FunctionTable::MEMBERPFNGLTEXSTORAGE2DPROC)&RecordingTableDecorator::m_glTexStorage2D_recording;
+if(this->m_ptr_glColor3fv)this->m_ptr_glColor3fv = (FunctionTable::MEMBERPFNGLCOLOR3FVPROC)&RecordingTableDecorator::m_glColor3fv_recording;
+if(this->m_ptr_glVertexAttribL4dvEXT)this->m_ptr_glVertexAttribL4dvEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL4DVEXTPROC)&RecordingTableDecorator::m_glVertexAttribL4dvEXT_recording;
+if(this->m_ptr_glGetActiveUniform)this->m_ptr_glGetActiveUniform = (FunctionTable::MEMBERPFNGLGETACTIVEUNIFORMPROC)&RecordingTableDecorator::m_glGetActiveUniform_recording;
+if(this->m_ptr_glUniform2ui64vARB)this->m_ptr_glUniform2ui64vARB = (FunctionTable::MEMBERPFNGLUNIFORM2UI64VARBPROC)&RecordingTableDecorator::m_glUniform2ui64vARB_recording;
+if(this->m_ptr_glMakeNamedBufferResidentNV)this->m_ptr_glMakeNamedBufferResidentNV = (FunctionTable::MEMBERPFNGLMAKENAMEDBUFFERRESIDENTNVPROC)&RecordingTableDecorator::m_glMakeNamedBufferResidentNV_recording;
+if(this->m_ptr_glPathGlyphIndexRangeNV)this->m_ptr_glPathGlyphIndexRangeNV = (FunctionTable::MEMBERPFNGLPATHGLYPHINDEXRANGENVPROC)&RecordingTableDecorator::m_glPathGlyphIndexRangeNV_recording;
+if(this->m_ptr_glColorPointer)this->m_ptr_glColorPointer = (FunctionTable::MEMBERPFNGLCOLORPOINTERPROC)&RecordingTableDecorator::m_glColorPointer_recording;
+if(this->m_ptr_glProgramEnvParameterI4ivNV)this->m_ptr_glProgramEnvParameterI4ivNV = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERI4IVNVPROC)&RecordingTableDecorator::m_glProgramEnvParameterI4ivNV_recording;
+if(this->m_ptr_glMultiTexParameterfEXT)this->m_ptr_glMultiTexParameterfEXT = (FunctionTable::MEMBERPFNGLMULTITEXPARAMETERFEXTPROC)&RecordingTableDecorator::m_glMultiTexParameterfEXT_recording;
+if(this->m_ptr_glNamedFramebufferTextureLayer)this->m_ptr_glNamedFramebufferTextureLayer = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC)&RecordingTableDecorator::m_glNamedFramebufferTextureLayer_recording;
+if(this->m_ptr_glGetVertexArrayIntegervEXT)this->m_ptr_glGetVertexArrayIntegervEXT = (FunctionTable::MEMBERPFNGLGETVERTEXARRAYINTEGERVEXTPROC)&RecordingTableDecorator::m_glGetVertexArrayIntegervEXT_recording;
+if(this->m_ptr_glVertexAttrib3dARB)this->m_ptr_glVertexAttrib3dARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3DARBPROC)&RecordingTableDecorator::m_glVertexAttrib3dARB_recording;
+if(this->m_ptr_glVDPAUIsSurfaceNV)this->m_ptr_glVDPAUIsSurfaceNV = (FunctionTable::MEMBERPFNGLVDPAUISSURFACENVPROC)&RecordingTableDecorator::m_glVDPAUIsSurfaceNV_recording;
+if(this->m_ptr_glMultiTexImage1DEXT)this->m_ptr_glMultiTexImage1DEXT = (FunctionTable::MEMBERPFNGLMULTITEXIMAGE1DEXTPROC)&RecordingTableDecorator::m_glMultiTexImage1DEXT_recording;
+if(this->m_ptr_glIsAsyncMarkerSGIX)this->m_ptr_glIsAsyncMarkerSGIX = (FunctionTable::MEMBERPFNGLISASYNCMARKERSGIXPROC)&RecordingTableDecorator::m_glIsAsyncMarkerSGIX_recording;
+if(this->m_ptr_glGetDoublei_vEXT)this->m_ptr_glGetDoublei_vEXT = (FunctionTable::MEMBERPFNGLGETDOUBLEI_VEXTPROC)&RecordingTableDecorator::m_glGetDoublei_vEXT_recording;
+if(this->m_ptr_glUniform2i64NV)this->m_ptr_glUniform2i64NV = (FunctionTable::MEMBERPFNGLUNIFORM2I64NVPROC)&RecordingTableDecorator::m_glUniform2i64NV_recording;
+if(this->m_ptr_glIsCommandListNV)this->m_ptr_glIsCommandListNV = (FunctionTable::MEMBERPFNGLISCOMMANDLISTNVPROC)&RecordingTableDecorator::m_glIsCommandListNV_recording;
+if(this->m_ptr_glUniform3uiEXT)this->m_ptr_glUniform3uiEXT = (FunctionTable::MEMBERPFNGLUNIFORM3UIEXTPROC)&RecordingTableDecorator::m_glUniform3uiEXT_recording;
+if(this->m_ptr_glTexParameterIuivEXT)this->m_ptr_glTexParameterIuivEXT = (FunctionTable::MEMBERPFNGLTEXPARAMETERIUIVEXTPROC)&RecordingTableDecorator::m_glTexParameterIuivEXT_recording;
+if(this->m_ptr_glProgramUniformMatrix4fv)this->m_ptr_glProgramUniformMatrix4fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4FVPROC)&RecordingTableDecorator::m_glProgramUniformMatrix4fv_recording;
+if(this->m_ptr_glVertex2fv)this->m_ptr_glVertex2fv = (FunctionTable::MEMBERPFNGLVERTEX2FVPROC)&RecordingTableDecorator::m_glVertex2fv_recording;
+if(this->m_ptr_glVertexAttribL3dEXT)this->m_ptr_glVertexAttribL3dEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL3DEXTPROC)&RecordingTableDecorator::m_glVertexAttribL3dEXT_recording;
+if(this->m_ptr_glFramebufferRenderbuffer)this->m_ptr_glFramebufferRenderbuffer = (FunctionTable::MEMBERPFNGLFRAMEBUFFERRENDERBUFFERPROC)&RecordingTableDecorator::m_glFramebufferRenderbuffer_recording;
+if(this->m_ptr_glGetUniformLocationARB)this->m_ptr_glGetUniformLocationARB = (FunctionTable::MEMBERPFNGLGETUNIFORMLOCATIONARBPROC)&RecordingTableDecorator::m_glGetUniformLocationARB_recording;
+if(this->m_ptr_glPathParameterfvNV)this->m_ptr_glPathParameterfvNV = (FunctionTable::MEMBERPFNGLPATHPARAMETERFVNVPROC)&RecordingTableDecorator::m_glPathParameterfvNV_recording;
+if(this->m_ptr_glVertexAttrib3sNV)this->m_ptr_glVertexAttrib3sNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3SNVPROC)&RecordingTableDecorator::m_glVertexAttrib3sNV_recording;
+if(this->m_ptr_glGetDoublei_v)this->m_ptr_glGetDoublei_v = (FunctionTable::MEMBERPFNGLGETDOUBLEI_VPROC)&RecordingTableDecorator::m_glGetDoublei_v_recording;
+if(this->m_ptr_glVertexAttrib1sv)this->m_ptr_glVertexAttrib1sv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1SVPROC)&RecordingTableDecorator::m_glVertexAttrib1sv_recording;
+if(this->m_ptr_glBindSampler)this->m_ptr_glBindSampler = (FunctionTable::MEMBERPFNGLBINDSAMPLERPROC)&RecordingTableDecorator::m_glBindSampler_recording;
+if(this->m_ptr_glLineWidth)this->m_ptr_glLineWidth = (FunctionTable::MEMBERPFNGLLINEWIDTHPROC)&RecordingTableDecorator::m_glLineWidth_recording;
+if(this->m_ptr_glVertexArrayRangeAPPLE)this->m_ptr_glVertexArrayRangeAPPLE = (FunctionTable::MEMBERPFNGLVERTEXARRAYRANGEAPPLEPROC)&RecordingTableDecorator::m_glVertexArrayRangeAPPLE_recording;
+if(this->m_ptr_glBindBufferOffsetEXT)this->m_ptr_glBindBufferOffsetEXT = (FunctionTable::MEMBERPFNGLBINDBUFFEROFFSETEXTPROC)&RecordingTableDecorator::m_glBindBufferOffsetEXT_recording;
+if(this->m_ptr_glWeightfvARB)this->m_ptr_glWeightfvARB = (FunctionTable::MEMBERPFNGLWEIGHTFVARBPROC)&RecordingTableDecorator::m_glWeightfvARB_recording;
+if(this->m_ptr_glGetIntegeri_v)this->m_ptr_glGetIntegeri_v = (FunctionTable::MEMBERPFNGLGETINTEGERI_VPROC)&RecordingTableDecorator::m_glGetIntegeri_v_recording;
+if(this->m_ptr_glGetTransformFeedbackVarying)this->m_ptr_glGetTransformFeedbackVarying = (FunctionTable::MEMBERPFNGLGETTRANSFORMFEEDBACKVARYINGPROC)&RecordingTableDecorator::m_glGetTransformFeedbackVarying_recording;
+if(this->m_ptr_glProgramLocalParameter4fvARB)this->m_ptr_glProgramLocalParameter4fvARB = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETER4FVARBPROC)&RecordingTableDecorator::m_glProgramLocalParameter4fvARB_recording;
+if(this->m_ptr_glGetTransformFeedbackVaryingNV)this->m_ptr_glGetTransformFeedbackVaryingNV = (FunctionTable::MEMBERPFNGLGETTRANSFORMFEEDBACKVARYINGNVPROC)&RecordingTableDecorator::m_glGetTransformFeedbackVaryingNV_recording;
+if(this->m_ptr_glWindowPos2iv)this->m_ptr_glWindowPos2iv = (FunctionTable::MEMBERPFNGLWINDOWPOS2IVPROC)&RecordingTableDecorator::m_glWindowPos2iv_recording;
+if(this->m_ptr_glVertexStream1dATI)this->m_ptr_glVertexStream1dATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM1DATIPROC)&RecordingTableDecorator::m_glVertexStream1dATI_recording;
+if(this->m_ptr_glColorFragmentOp2ATI)this->m_ptr_glColorFragmentOp2ATI = (FunctionTable::MEMBERPFNGLCOLORFRAGMENTOP2ATIPROC)&RecordingTableDecorator::m_glColorFragmentOp2ATI_recording;
+if(this->m_ptr_glFogiv)this->m_ptr_glFogiv = (FunctionTable::MEMBERPFNGLFOGIVPROC)&RecordingTableDecorator::m_glFogiv_recording;
+if(this->m_ptr_glGetTextureHandleNV)this->m_ptr_glGetTextureHandleNV = (FunctionTable::MEMBERPFNGLGETTEXTUREHANDLENVPROC)&RecordingTableDecorator::m_glGetTextureHandleNV_recording;
+if(this->m_ptr_glLightModeliv)this->m_ptr_glLightModeliv = (FunctionTable::MEMBERPFNGLLIGHTMODELIVPROC)&RecordingTableDecorator::m_glLightModeliv_recording;
+if(this->m_ptr_glDepthRangef)this->m_ptr_glDepthRangef = (FunctionTable::MEMBERPFNGLDEPTHRANGEFPROC)&RecordingTableDecorator::m_glDepthRangef_recording;
+if(this->m_ptr_glGetFragmentMaterialivSGIX)this->m_ptr_glGetFragmentMaterialivSGIX = (FunctionTable::MEMBERPFNGLGETFRAGMENTMATERIALIVSGIXPROC)&RecordingTableDecorator::m_glGetFragmentMaterialivSGIX_recording;
+if(this->m_ptr_glVideoCaptureStreamParameterfvNV)this->m_ptr_glVideoCaptureStreamParameterfvNV = (FunctionTable::MEMBERPFNGLVIDEOCAPTURESTREAMPARAMETERFVNVPROC)&RecordingTableDecorator::m_glVideoCaptureStreamParameterfvNV_recording;
+if(this->m_ptr_glDeleteProgramsARB)this->m_ptr_glDeleteProgramsARB = (FunctionTable::MEMBERPFNGLDELETEPROGRAMSARBPROC)&RecordingTableDecorator::m_glDeleteProgramsARB_recording;
+if(this->m_ptr_glWindowPos3fvARB)this->m_ptr_glWindowPos3fvARB = (FunctionTable::MEMBERPFNGLWINDOWPOS3FVARBPROC)&RecordingTableDecorator::m_glWindowPos3fvARB_recording;
+if(this->m_ptr_glFeedbackBufferxOES)this->m_ptr_glFeedbackBufferxOES = (FunctionTable::MEMBERPFNGLFEEDBACKBUFFERXOESPROC)&RecordingTableDecorator::m_glFeedbackBufferxOES_recording;
+if(this->m_ptr_glGetTexBumpParameterfvATI)this->m_ptr_glGetTexBumpParameterfvATI = (FunctionTable::MEMBERPFNGLGETTEXBUMPPARAMETERFVATIPROC)&RecordingTableDecorator::m_glGetTexBumpParameterfvATI_recording;
+if(this->m_ptr_glEnablei)this->m_ptr_glEnablei = (FunctionTable::MEMBERPFNGLENABLEIPROC)&RecordingTableDecorator::m_glEnablei_recording;
+if(this->m_ptr_glGetActiveSubroutineName)this->m_ptr_glGetActiveSubroutineName = (FunctionTable::MEMBERPFNGLGETACTIVESUBROUTINENAMEPROC)&RecordingTableDecorator::m_glGetActiveSubroutineName_recording;
+if(this->m_ptr_glDrawBuffersARB)this->m_ptr_glDrawBuffersARB = (FunctionTable::MEMBERPFNGLDRAWBUFFERSARBPROC)&RecordingTableDecorator::m_glDrawBuffersARB_recording;
+if(this->m_ptr_glBindProgramARB)this->m_ptr_glBindProgramARB = (FunctionTable::MEMBERPFNGLBINDPROGRAMARBPROC)&RecordingTableDecorator::m_glBindProgramARB_recording;
+if(this->m_ptr_glEvalCoord1fv)this->m_ptr_glEvalCoord1fv = (FunctionTable::MEMBERPFNGLEVALCOORD1FVPROC)&RecordingTableDecorator::m_glEvalCoord1fv_recording;
+if(this->m_ptr_glProgramUniform3ui64vARB)this->m_ptr_glProgramUniform3ui64vARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UI64VARBPROC)&RecordingTableDecorator::m_glProgramUniform3ui64vARB_recording;
+if(this->m_ptr_glProgramUniformMatrix2dv)this->m_ptr_glProgramUniformMatrix2dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2DVPROC)&RecordingTableDecorator::m_glProgramUniformMatrix2dv_recording;
+if(this->m_ptr_glMultiTexCoord2hvNV)this->m_ptr_glMultiTexCoord2hvNV = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2HVNVPROC)&RecordingTableDecorator::m_glMultiTexCoord2hvNV_recording;
+if(this->m_ptr_glGetFloatIndexedvEXT)this->m_ptr_glGetFloatIndexedvEXT = (FunctionTable::MEMBERPFNGLGETFLOATINDEXEDVEXTPROC)&RecordingTableDecorator::m_glGetFloatIndexedvEXT_recording;
+if(this->m_ptr_glSampleCoverageARB)this->m_ptr_glSampleCoverageARB = (FunctionTable::MEMBERPFNGLSAMPLECOVERAGEARBPROC)&RecordingTableDecorator::m_glSampleCoverageARB_recording;
+if(this->m_ptr_glProgramUniform2ui64vARB)this->m_ptr_glProgramUniform2ui64vARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UI64VARBPROC)&RecordingTableDecorator::m_glProgramUniform2ui64vARB_recording;
+if(this->m_ptr_glPixelDataRangeNV)this->m_ptr_glPixelDataRangeNV = (FunctionTable::MEMBERPFNGLPIXELDATARANGENVPROC)&RecordingTableDecorator::m_glPixelDataRangeNV_recording;
+if(this->m_ptr_glVertexStream3svATI)this->m_ptr_glVertexStream3svATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM3SVATIPROC)&RecordingTableDecorator::m_glVertexStream3svATI_recording;
+if(this->m_ptr_glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN)this->m_ptr_glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUITEXCOORD2FNORMAL3FVERTEX3FVSUNPROC)&RecordingTableDecorator::m_glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN_recording;
+if(this->m_ptr_glTexCoord3hvNV)this->m_ptr_glTexCoord3hvNV = (FunctionTable::MEMBERPFNGLTEXCOORD3HVNVPROC)&RecordingTableDecorator::m_glTexCoord3hvNV_recording;
+if(this->m_ptr_glSampleMaski)this->m_ptr_glSampleMaski = (FunctionTable::MEMBERPFNGLSAMPLEMASKIPROC)&RecordingTableDecorator::m_glSampleMaski_recording;
+if(this->m_ptr_glIndexFuncEXT)this->m_ptr_glIndexFuncEXT = (FunctionTable::MEMBERPFNGLINDEXFUNCEXTPROC)&RecordingTableDecorator::m_glIndexFuncEXT_recording;
+if(this->m_ptr_glPointParameteriNV)this->m_ptr_glPointParameteriNV = (FunctionTable::MEMBERPFNGLPOINTPARAMETERINVPROC)&RecordingTableDecorator::m_glPointParameteriNV_recording;
+if(this->m_ptr_glUniformMatrix3x2fv)this->m_ptr_glUniformMatrix3x2fv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX3X2FVPROC)&RecordingTableDecorator::m_glUniformMatrix3x2fv_recording;
+if(this->m_ptr_glGetFramebufferParameterivEXT)this->m_ptr_glGetFramebufferParameterivEXT = (FunctionTable::MEMBERPFNGLGETFRAMEBUFFERPARAMETERIVEXTPROC)&RecordingTableDecorator::m_glGetFramebufferParameterivEXT_recording;
+if(this->m_ptr_glUniform2i64ARB)this->m_ptr_glUniform2i64ARB = (FunctionTable::MEMBERPFNGLUNIFORM2I64ARBPROC)&RecordingTableDecorator::m_glUniform2i64ARB_recording;
+if(this->m_ptr_glNamedBufferStorageEXT)this->m_ptr_glNamedBufferStorageEXT = (FunctionTable::MEMBERPFNGLNAMEDBUFFERSTORAGEEXTPROC)&RecordingTableDecorator::m_glNamedBufferStorageEXT_recording;
+if(this->m_ptr_glNamedFramebufferTexture3DEXT)this->m_ptr_glNamedFramebufferTexture3DEXT = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTURE3DEXTPROC)&RecordingTableDecorator::m_glNamedFramebufferTexture3DEXT_recording;
+if(this->m_ptr_glVertexAttrib2dv)this->m_ptr_glVertexAttrib2dv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2DVPROC)&RecordingTableDecorator::m_glVertexAttrib2dv_recording;
+if(this->m_ptr_glGetVertexArrayPointervEXT)this->m_ptr_glGetVertexArrayPointervEXT = (FunctionTable::MEMBERPFNGLGETVERTEXARRAYPOINTERVEXTPROC)&RecordingTableDecorator::m_glGetVertexArrayPointervEXT_recording;
+if(this->m_ptr_glGetVertexAttribArrayObjectivATI)this->m_ptr_glGetVertexAttribArrayObjectivATI = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBARRAYOBJECTIVATIPROC)&RecordingTableDecorator::m_glGetVertexAttribArrayObjectivATI_recording;
+if(this->m_ptr_glProgramUniformMatrix3fvEXT)this->m_ptr_glProgramUniformMatrix3fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3FVEXTPROC)&RecordingTableDecorator::m_glProgramUniformMatrix3fvEXT_recording;
+if(this->m_ptr_glEnableVertexArrayEXT)this->m_ptr_glEnableVertexArrayEXT = (FunctionTable::MEMBERPFNGLENABLEVERTEXARRAYEXTPROC)&RecordingTableDecorator::m_glEnableVertexArrayEXT_recording;
+if(this->m_ptr_glColorTableParameterfvSGI)this->m_ptr_glColorTableParameterfvSGI = (FunctionTable::MEMBERPFNGLCOLORTABLEPARAMETERFVSGIPROC)&RecordingTableDecorator::m_glColorTableParameterfvSGI_recording;
+if(this->m_ptr_glEdgeFlag)this->m_ptr_glEdgeFlag = (FunctionTable::MEMBERPFNGLEDGEFLAGPROC)&RecordingTableDecorator::m_glEdgeFlag_recording;
+if(this->m_ptr_glFogCoordf)this->m_ptr_glFogCoordf = (FunctionTable::MEMBERPFNGLFOGCOORDFPROC)&RecordingTableDecorator::m_glFogCoordf_recording;
+if(this->m_ptr_glVertex3d)this->m_ptr_glVertex3d = (FunctionTable::MEMBERPFNGLVERTEX3DPROC)&RecordingTableDecorator::m_glVertex3d_recording;
+if(this->m_ptr_glVertex3f)this->m_ptr_glVertex3f = (FunctionTable::MEMBERPFNGLVERTEX3FPROC)&RecordingTableDecorator::m_glVertex3f_recording;
+if(this->m_ptr_glSpriteParameterivSGIX)this->m_ptr_glSpriteParameterivSGIX = (FunctionTable::MEMBERPFNGLSPRITEPARAMETERIVSGIXPROC)&RecordingTableDecorator::m_glSpriteParameterivSGIX_recording;
+if(this->m_ptr_glPathGlyphRangeNV)this->m_ptr_glPathGlyphRangeNV = (FunctionTable::MEMBERPFNGLPATHGLYPHRANGENVPROC)&RecordingTableDecorator::m_glPathGlyphRangeNV_recording;
+if(this->m_ptr_glPrimitiveBoundingBoxARB)this->m_ptr_glPrimitiveBoundingBoxARB = (FunctionTable::MEMBERPFNGLPRIMITIVEBOUNDINGBOXARBPROC)&RecordingTableDecorator::m_glPrimitiveBoundingBoxARB_recording;
+if(this->m_ptr_glVertexAttribL3ui64vNV)this->m_ptr_glVertexAttribL3ui64vNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL3UI64VNVPROC)&RecordingTableDecorator::m_glVertexAttribL3ui64vNV_recording;
+if(this->m_ptr_glVertex3s)this->m_ptr_glVertex3s = (FunctionTable::MEMBERPFNGLVERTEX3SPROC)&RecordingTableDecorator::m_glVertex3s_recording;
+if(this->m_ptr_glTexCoordP2ui)this->m_ptr_glTexCoordP2ui = (FunctionTable::MEMBERPFNGLTEXCOORDP2UIPROC)&RecordingTableDecorator::m_glTexCoordP2ui_recording;
+if(this->m_ptr_glProgramUniform2fvEXT)this->m_ptr_glProgramUniform2fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2FVEXTPROC)&RecordingTableDecorator::m_glProgramUniform2fvEXT_recording;
+if(this->m_ptr_glDeletePathsNV)this->m_ptr_glDeletePathsNV = (FunctionTable::MEMBERPFNGLDELETEPATHSNVPROC)&RecordingTableDecorator::m_glDeletePathsNV_recording;
+if(this->m_ptr_glPrimitiveRestartIndexNV)this->m_ptr_glPrimitiveRestartIndexNV = (FunctionTable::MEMBERPFNGLPRIMITIVERESTARTINDEXNVPROC)&RecordingTableDecorator::m_glPrimitiveRestartIndexNV_recording;
+if(this->m_ptr_glTexCoord2fColor3fVertex3fvSUN)this->m_ptr_glTexCoord2fColor3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLTEXCOORD2FCOLOR3FVERTEX3FVSUNPROC)&RecordingTableDecorator::m_glTexCoord2fColor3fVertex3fvSUN_recording;
+if(this->m_ptr_glTexCoordPointerListIBM)this->m_ptr_glTexCoordPointerListIBM = (FunctionTable::MEMBERPFNGLTEXCOORDPOINTERLISTIBMPROC)&RecordingTableDecorator::m_glTexCoordPointerListIBM_recording;
+if(this->m_ptr_glRectxOES)this->m_ptr_glRectxOES = (FunctionTable::MEMBERPFNGLRECTXOESPROC)&RecordingTableDecorator::m_glRectxOES_recording;
+if(this->m_ptr_glCopyNamedBufferSubData)this->m_ptr_glCopyNamedBufferSubData = (FunctionTable::MEMBERPFNGLCOPYNAMEDBUFFERSUBDATAPROC)&RecordingTableDecorator::m_glCopyNamedBufferSubData_recording;
+if(this->m_ptr_glGenProgramsNV)this->m_ptr_glGenProgramsNV = (FunctionTable::MEMBERPFNGLGENPROGRAMSNVPROC)&RecordingTableDecorator::m_glGenProgramsNV_recording;
+if(this->m_ptr_glFragmentLightfSGIX)this->m_ptr_glFragmentLightfSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTLIGHTFSGIXPROC)&RecordingTableDecorator::m_glFragmentLightfSGIX_recording;
+if(this->m_ptr_glTexStorage3D)this->m_ptr_glTexStorage3D = (FunctionTable::MEMBERPFNGLTEXSTORAGE3DPROC)&RecordingTableDecorator::m_glTexStorage3D_recording;
+if(this->m_ptr_glTextureParameteriv)this->m_ptr_glTextureParameteriv = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIVPROC)&RecordingTableDecorator::m_glTextureParameteriv_recording;
+if(this->m_ptr_glNamedBufferDataEXT)this->m_ptr_glNamedBufferDataEXT = (FunctionTable::MEMBERPFNGLNAMEDBUFFERDATAEXTPROC)&RecordingTableDecorator::m_glNamedBufferDataEXT_recording;
+if(this->m_ptr_glMultiTexCoord3fvARB)this->m_ptr_glMultiTexCoord3fvARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3FVARBPROC)&RecordingTableDecorator::m_glMultiTexCoord3fvARB_recording;
+if(this->m_ptr_glUniformMatrix3x4fv)this->m_ptr_glUniformMatrix3x4fv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX3X4FVPROC)&RecordingTableDecorator::m_glUniformMatrix3x4fv_recording;
+if(this->m_ptr_glSubpixelPrecisionBiasNV)this->m_ptr_glSubpixelPrecisionBiasNV = (FunctionTable::MEMBERPFNGLSUBPIXELPRECISIONBIASNVPROC)&RecordingTableDecorator::m_glSubpixelPrecisionBiasNV_recording;
+if(this->m_ptr_glNormalPointer)this->m_ptr_glNormalPointer = (FunctionTable::MEMBERPFNGLNORMALPOINTERPROC)&RecordingTableDecorator::m_glNormalPointer_recording;
+if(this->m_ptr_glNamedFramebufferTexture)this->m_ptr_glNamedFramebufferTexture = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTUREPROC)&RecordingTableDecorator::m_glNamedFramebufferTexture_recording;
+if(this->m_ptr_glVertexAttrib4NsvARB)this->m_ptr_glVertexAttrib4NsvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NSVARBPROC)&RecordingTableDecorator::m_glVertexAttrib4NsvARB_recording;
+if(this->m_ptr_glPassThrough)this->m_ptr_glPassThrough = (FunctionTable::MEMBERPFNGLPASSTHROUGHPROC)&RecordingTableDecorator::m_glPassThrough_recording;
+if(this->m_ptr_glSecondaryColorP3ui)this->m_ptr_glSecondaryColorP3ui = (FunctionTable::MEMBERPFNGLSECONDARYCOLORP3UIPROC)&RecordingTableDecorator::m_glSecondaryColorP3ui_recording;
+if(this->m_ptr_glInvalidateTexSubImage)this->m_ptr_glInvalidateTexSubImage = (FunctionTable::MEMBERPFNGLINVALIDATETEXSUBIMAGEPROC)&RecordingTableDecorator::m_glInvalidateTexSubImage_recording;
+if(this->m_ptr_glIsImageHandleResidentARB)this->m_ptr_glIsImageHandleResidentARB = (FunctionTable::MEMBERPFNGLISIMAGEHANDLERESIDENTARBPROC)&RecordingTableDecorator::m_glIsImageHandleResidentARB_recording;
+if(this->m_ptr_glTangent3fvEXT)this->m_ptr_glTangent3fvEXT = (FunctionTable::MEMBERPFNGLTANGENT3FVEXTPROC)&RecordingTableDecorator::m_glTangent3fvEXT_recording;
+if(this->m_ptr_glProgramUniformMatrix4x3fv)this->m_ptr_glProgramUniformMatrix4x3fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X3FVPROC)&RecordingTableDecorator::m_glProgramUniformMatrix4x3fv_recording;
+if(this->m_ptr_glBegin)this->m_ptr_glBegin = (FunctionTable::MEMBERPFNGLBEGINPROC)&RecordingTableDecorator::m_glBegin_recording;
+if(this->m_ptr_glEvalCoord2dv)this->m_ptr_glEvalCoord2dv = (FunctionTable::MEMBERPFNGLEVALCOORD2DVPROC)&RecordingTableDecorator::m_glEvalCoord2dv_recording;
+if(this->m_ptr_glColor3ubv)this->m_ptr_glColor3ubv = (FunctionTable::MEMBERPFNGLCOLOR3UBVPROC)&RecordingTableDecorator::m_glColor3ubv_recording;
+if(this->m_ptr_glFogCoordfvEXT)this->m_ptr_glFogCoordfvEXT = (FunctionTable::MEMBERPFNGLFOGCOORDFVEXTPROC)&RecordingTableDecorator::m_glFogCoordfvEXT_recording;
+if(this->m_ptr_glVertexP3ui)this->m_ptr_glVertexP3ui = (FunctionTable::MEMBERPFNGLVERTEXP3UIPROC)&RecordingTableDecorator::m_glVertexP3ui_recording;
+if(this->m_ptr_glLightfv)this->m_ptr_glLightfv = (FunctionTable::MEMBERPFNGLLIGHTFVPROC)&RecordingTableDecorator::m_glLightfv_recording;
+if(this->m_ptr_glVertexAttribL3i64NV)this->m_ptr_glVertexAttribL3i64NV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL3I64NVPROC)&RecordingTableDecorator::m_glVertexAttribL3i64NV_recording;
+if(this->m_ptr_glStencilClearTagEXT)this->m_ptr_glStencilClearTagEXT = (FunctionTable::MEMBERPFNGLSTENCILCLEARTAGEXTPROC)&RecordingTableDecorator::m_glStencilClearTagEXT_recording;
+if(this->m_ptr_glGetActiveUniformName)this->m_ptr_glGetActiveUniformName = (FunctionTable::MEMBERPFNGLGETACTIVEUNIFORMNAMEPROC)&RecordingTableDecorator::m_glGetActiveUniformName_recording;
+if(this->m_ptr_glTangentPointerEXT)this->m_ptr_glTangentPointerEXT = (FunctionTable::MEMBERPFNGLTANGENTPOINTEREXTPROC)&RecordingTableDecorator::m_glTangentPointerEXT_recording;
+if(this->m_ptr_glUniform4ui64vNV)this->m_ptr_glUniform4ui64vNV = (FunctionTable::MEMBERPFNGLUNIFORM4UI64VNVPROC)&RecordingTableDecorator::m_glUniform4ui64vNV_recording;
+if(this->m_ptr_glDebugMessageEnableAMD)this->m_ptr_glDebugMessageEnableAMD = (FunctionTable::MEMBERPFNGLDEBUGMESSAGEENABLEAMDPROC)&RecordingTableDecorator::m_glDebugMessageEnableAMD_recording;
+if(this->m_ptr_glProgramUniform2ui)this->m_ptr_glProgramUniform2ui = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UIPROC)&RecordingTableDecorator::m_glProgramUniform2ui_recording;
+if(this->m_ptr_glCopyTexSubImage2DEXT)this->m_ptr_glCopyTexSubImage2DEXT = (FunctionTable::MEMBERPFNGLCOPYTEXSUBIMAGE2DEXTPROC)&RecordingTableDecorator::m_glCopyTexSubImage2DEXT_recording;
+if(this->m_ptr_glGenRenderbuffersEXT)this->m_ptr_glGenRenderbuffersEXT = (FunctionTable::MEMBERPFNGLGENRENDERBUFFERSEXTPROC)&RecordingTableDecorator::m_glGenRenderbuffersEXT_recording;
+if(this->m_ptr_glNamedProgramLocalParameterI4ivEXT)this->m_ptr_glNamedProgramLocalParameterI4ivEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERI4IVEXTPROC)&RecordingTableDecorator::m_glNamedProgramLocalParameterI4ivEXT_recording;
+if(this->m_ptr_glMultiTexCoord2f)this->m_ptr_glMultiTexCoord2f = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2FPROC)&RecordingTableDecorator::m_glMultiTexCoord2f_recording;
+if(this->m_ptr_glMapGrid2d)this->m_ptr_glMapGrid2d = (FunctionTable::MEMBERPFNGLMAPGRID2DPROC)&RecordingTableDecorator::m_glMapGrid2d_recording;
+if(this->m_ptr_glGetMultiTexParameterIuivEXT)this->m_ptr_glGetMultiTexParameterIuivEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXPARAMETERIUIVEXTPROC)&RecordingTableDecorator::m_glGetMultiTexParameterIuivEXT_recording;
+if(this->m_ptr_glBlendEquationiARB)this->m_ptr_glBlendEquationiARB = (FunctionTable::MEMBERPFNGLBLENDEQUATIONIARBPROC)&RecordingTableDecorator::m_glBlendEquationiARB_recording;
+if(this->m_ptr_glTexParameteriv)this->m_ptr_glTexParameteriv = (FunctionTable::MEMBERPFNGLTEXPARAMETERIVPROC)&RecordingTableDecorator::m_glTexParameteriv_recording;
+if(this->m_ptr_glUniform4ivARB)this->m_ptr_glUniform4ivARB = (FunctionTable::MEMBERPFNGLUNIFORM4IVARBPROC)&RecordingTableDecorator::m_glUniform4ivARB_recording;
+if(this->m_ptr_glMatrixOrthoEXT)this->m_ptr_glMatrixOrthoEXT = (FunctionTable::MEMBERPFNGLMATRIXORTHOEXTPROC)&RecordingTableDecorator::m_glMatrixOrthoEXT_recording;
+if(this->m_ptr_glVertexArrayVertexBuffer)this->m_ptr_glVertexArrayVertexBuffer = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXBUFFERPROC)&RecordingTableDecorator::m_glVertexArrayVertexBuffer_recording;
+if(this->m_ptr_glProgramLocalParametersI4ivNV)this->m_ptr_glProgramLocalParametersI4ivNV = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERSI4IVNVPROC)&RecordingTableDecorator::m_glProgramLocalParametersI4ivNV_recording;
+if(this->m_ptr_glProgramUniform4ui64vNV)this->m_ptr_glProgramUniform4ui64vNV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UI64VNVPROC)&RecordingTableDecorator::m_glProgramUniform4ui64vNV_recording;
+if(this->m_ptr_glGetNamedStringivARB)this->m_ptr_glGetNamedStringivARB = (FunctionTable::MEMBERPFNGLGETNAMEDSTRINGIVARBPROC)&RecordingTableDecorator::m_glGetNamedStringivARB_recording;
+if(this->m_ptr_glVertexAttribL1i64vNV)this->m_ptr_glVertexAttribL1i64vNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL1I64VNVPROC)&RecordingTableDecorator::m_glVertexAttribL1i64vNV_recording;
+if(this->m_ptr_glTransformFeedbackBufferBase)this->m_ptr_glTransformFeedbackBufferBase = (FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKBUFFERBASEPROC)&RecordingTableDecorator::m_glTransformFeedbackBufferBase_recording;
+if(this->m_ptr_glIndexsv)this->m_ptr_glIndexsv = (FunctionTable::MEMBERPFNGLINDEXSVPROC)&RecordingTableDecorator::m_glIndexsv_recording;
+if(this->m_ptr_glPointParameterivNV)this->m_ptr_glPointParameterivNV = (FunctionTable::MEMBERPFNGLPOINTPARAMETERIVNVPROC)&RecordingTableDecorator::m_glPointParameterivNV_recording;
+if(this->m_ptr_glGetDetailTexFuncSGIS)this->m_ptr_glGetDetailTexFuncSGIS = (FunctionTable::MEMBERPFNGLGETDETAILTEXFUNCSGISPROC)&RecordingTableDecorator::m_glGetDetailTexFuncSGIS_recording;
+if(this->m_ptr_glReplacementCodeuiColor3fVertex3fvSUN)this->m_ptr_glReplacementCodeuiColor3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUICOLOR3FVERTEX3FVSUNPROC)&RecordingTableDecorator::m_glReplacementCodeuiColor3fVertex3fvSUN_recording;
+if(this->m_ptr_glProgramLocalParameter4fARB)this->m_ptr_glProgramLocalParameter4fARB = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETER4FARBPROC)&RecordingTableDecorator::m_glProgramLocalParameter4fARB_recording;
+if(this->m_ptr_glBitmap)this->m_ptr_glBitmap = (FunctionTable::MEMBERPFNGLBITMAPPROC)&RecordingTableDecorator::m_glBitmap_recording;
+if(this->m_ptr_glNamedFramebufferTextureLayerEXT)this->m_ptr_glNamedFramebufferTextureLayerEXT = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTURELAYEREXTPROC)&RecordingTableDecorator::m_glNamedFramebufferTextureLayerEXT_recording;
+if(this->m_ptr_glMultiTexGenfvEXT)this->m_ptr_glMultiTexGenfvEXT = (FunctionTable::MEMBERPFNGLMULTITEXGENFVEXTPROC)&RecordingTableDecorator::m_glMultiTexGenfvEXT_recording;
+if(this->m_ptr_glGetNamedBufferSubData)this->m_ptr_glGetNamedBufferSubData = (FunctionTable::MEMBERPFNGLGETNAMEDBUFFERSUBDATAPROC)&RecordingTableDecorator::m_glGetNamedBufferSubData_recording;
+if(this->m_ptr_glStencilFuncSeparateATI)this->m_ptr_glStencilFuncSeparateATI = (FunctionTable::MEMBERPFNGLSTENCILFUNCSEPARATEATIPROC)&RecordingTableDecorator::m_glStencilFuncSeparateATI_recording;
+if(this->m_ptr_glProgramUniform2iv)this->m_ptr_glProgramUniform2iv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2IVPROC)&RecordingTableDecorator::m_glProgramUniform2iv_recording;
+if(this->m_ptr_glGetQueryiv)this->m_ptr_glGetQueryiv = (FunctionTable::MEMBERPFNGLGETQUERYIVPROC)&RecordingTableDecorator::m_glGetQueryiv_recording;
+if(this->m_ptr_glTexCoord4f)this->m_ptr_glTexCoord4f = (FunctionTable::MEMBERPFNGLTEXCOORD4FPROC)&RecordingTableDecorator::m_glTexCoord4f_recording;
+if(this->m_ptr_glMapGrid2f)this->m_ptr_glMapGrid2f = (FunctionTable::MEMBERPFNGLMAPGRID2FPROC)&RecordingTableDecorator::m_glMapGrid2f_recording;
+if(this->m_ptr_glListParameterivSGIX)this->m_ptr_glListParameterivSGIX = (FunctionTable::MEMBERPFNGLLISTPARAMETERIVSGIXPROC)&RecordingTableDecorator::m_glListParameterivSGIX_recording;
+if(this->m_ptr_glCreateQueries)this->m_ptr_glCreateQueries = (FunctionTable::MEMBERPFNGLCREATEQUERIESPROC)&RecordingTableDecorator::m_glCreateQueries_recording;
+if(this->m_ptr_glGetSamplerParameterfv)this->m_ptr_glGetSamplerParameterfv = (FunctionTable::MEMBERPFNGLGETSAMPLERPARAMETERFVPROC)&RecordingTableDecorator::m_glGetSamplerParameterfv_recording;
+if(this->m_ptr_glTexCoord4i)this->m_ptr_glTexCoord4i = (FunctionTable::MEMBERPFNGLTEXCOORD4IPROC)&RecordingTableDecorator::m_glTexCoord4i_recording;
+if(this->m_ptr_glObjectLabel)this->m_ptr_glObjectLabel = (FunctionTable::MEMBERPFNGLOBJECTLABELPROC)&RecordingTableDecorator::m_glObjectLabel_recording;
+if(this->m_ptr_glProgramUniform3i64NV)this->m_ptr_glProgramUniform3i64NV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3I64NVPROC)&RecordingTableDecorator::m_glProgramUniform3i64NV_recording;
+if(this->m_ptr_glGetTextureHandleARB)this->m_ptr_glGetTextureHandleARB = (FunctionTable::MEMBERPFNGLGETTEXTUREHANDLEARBPROC)&RecordingTableDecorator::m_glGetTextureHandleARB_recording;
+if(this->m_ptr_glTexCoord4s)this->m_ptr_glTexCoord4s = (FunctionTable::MEMBERPFNGLTEXCOORD4SPROC)&RecordingTableDecorator::m_glTexCoord4s_recording;
+if(this->m_ptr_glUniform4iARB)this->m_ptr_glUniform4iARB = (FunctionTable::MEMBERPFNGLUNIFORM4IARBPROC)&RecordingTableDecorator::m_glUniform4iARB_recording;
+if(this->m_ptr_glGetUniformIndices)this->m_ptr_glGetUniformIndices = (FunctionTable::MEMBERPFNGLGETUNIFORMINDICESPROC)&RecordingTableDecorator::m_glGetUniformIndices_recording;
+if(this->m_ptr_glMultiTexImage3DEXT)this->m_ptr_glMultiTexImage3DEXT = (FunctionTable::MEMBERPFNGLMULTITEXIMAGE3DEXTPROC)&RecordingTableDecorator::m_glMultiTexImage3DEXT_recording;
+if(this->m_ptr_glCoverageModulationTableNV)this->m_ptr_glCoverageModulationTableNV = (FunctionTable::MEMBERPFNGLCOVERAGEMODULATIONTABLENVPROC)&RecordingTableDecorator::m_glCoverageModulationTableNV_recording;
+if(this->m_ptr_glPointParameteriv)this->m_ptr_glPointParameteriv = (FunctionTable::MEMBERPFNGLPOINTPARAMETERIVPROC)&RecordingTableDecorator::m_glPointParameteriv_recording;
+if(this->m_ptr_glMultiTexCoord4svARB)this->m_ptr_glMultiTexCoord4svARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4SVARBPROC)&RecordingTableDecorator::m_glMultiTexCoord4svARB_recording;
+if(this->m_ptr_glNormal3fv)this->m_ptr_glNormal3fv = (FunctionTable::MEMBERPFNGLNORMAL3FVPROC)&RecordingTableDecorator::m_glNormal3fv_recording;
+if(this->m_ptr_glProgramUniformMatrix3x4dvEXT)this->m_ptr_glProgramUniformMatrix3x4dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X4DVEXTPROC)&RecordingTableDecorator::m_glProgramUniformMatrix3x4dvEXT_recording;
+if(this->m_ptr_glTexCoord1fv)this->m_ptr_glTexCoord1fv = (FunctionTable::MEMBERPFNGLTEXCOORD1FVPROC)&RecordingTableDecorator::m_glTexCoord1fv_recording;
+if(this->m_ptr_glProgramUniformMatrix4x3dvEXT)this->m_ptr_glProgramUniformMatrix4x3dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X3DVEXTPROC)&RecordingTableDecorator::m_glProgramUniformMatrix4x3dvEXT_recording;
+if(this->m_ptr_glGetActiveVaryingNV)this->m_ptr_glGetActiveVaryingNV = (FunctionTable::MEMBERPFNGLGETACTIVEVARYINGNVPROC)&RecordingTableDecorator::m_glGetActiveVaryingNV_recording;
+if(this->m_ptr_glUniform1i64vARB)this->m_ptr_glUniform1i64vARB = (FunctionTable::MEMBERPFNGLUNIFORM1I64VARBPROC)&RecordingTableDecorator::m_glUniform1i64vARB_recording;
+if(this->m_ptr_glMultiTexCoord1dv)this->m_ptr_glMultiTexCoord1dv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1DVPROC)&RecordingTableDecorator::m_glMultiTexCoord1dv_recording;
+if(this->m_ptr_glTexCoord3fv)this->m_ptr_glTexCoord3fv = (FunctionTable::MEMBERPFNGLTEXCOORD3FVPROC)&RecordingTableDecorator::m_glTexCoord3fv_recording;
+if(this->m_ptr_glMatrixTranslatefEXT)this->m_ptr_glMatrixTranslatefEXT = (FunctionTable::MEMBERPFNGLMATRIXTRANSLATEFEXTPROC)&RecordingTableDecorator::m_glMatrixTranslatefEXT_recording;
+if(this->m_ptr_glProgramUniform1ui64vNV)this->m_ptr_glProgramUniform1ui64vNV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UI64VNVPROC)&RecordingTableDecorator::m_glProgramUniform1ui64vNV_recording;
+if(this->m_ptr_glTextureMaterialEXT)this->m_ptr_glTextureMaterialEXT = (FunctionTable::MEMBERPFNGLTEXTUREMATERIALEXTPROC)&RecordingTableDecorator::m_glTextureMaterialEXT_recording;
+if(this->m_ptr_glMultiTexCoordP3uiv)this->m_ptr_glMultiTexCoordP3uiv = (FunctionTable::MEMBERPFNGLMULTITEXCOORDP3UIVPROC)&RecordingTableDecorator::m_glMultiTexCoordP3uiv_recording;
+if(this->m_ptr_glVertexAttribP3ui)this->m_ptr_glVertexAttribP3ui = (FunctionTable::MEMBERPFNGLVERTEXATTRIBP3UIPROC)&RecordingTableDecorator::m_glVertexAttribP3ui_recording;
+if(this->m_ptr_glInterpolatePathsNV)this->m_ptr_glInterpolatePathsNV = (FunctionTable::MEMBERPFNGLINTERPOLATEPATHSNVPROC)&RecordingTableDecorator::m_glInterpolatePathsNV_recording;
+if(this->m_ptr_glTextureBufferRange)this->m_ptr_glTextureBufferRange = (FunctionTable::MEMBERPFNGLTEXTUREBUFFERRANGEPROC)&RecordingTableDecorator::m_glTextureBufferRange_recording;
+if(this->m_ptr_glVertexAttribL2dEXT)this->m_ptr_glVertexAttribL2dEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL2DEXTPROC)&RecordingTableDecorator::m_glVertexAttribL2dEXT_recording;
+if(this->m_ptr_glGetPixelTransformParameterivEXT)this->m_ptr_glGetPixelTransformParameterivEXT = (FunctionTable::MEMBERPFNGLGETPIXELTRANSFORMPARAMETERIVEXTPROC)&RecordingTableDecorator::m_glGetPixelTransformParameterivEXT_recording;
+if(this->m_ptr_glTexCoord4xvOES)this->m_ptr_glTexCoord4xvOES = (FunctionTable::MEMBERPFNGLTEXCOORD4XVOESPROC)&RecordingTableDecorator::m_glTexCoord4xvOES_recording;
+if(this->m_ptr_glGetVariantBooleanvEXT)this->m_ptr_glGetVariantBooleanvEXT = (FunctionTable::MEMBERPFNGLGETVARIANTBOOLEANVEXTPROC)&RecordingTableDecorator::m_glGetVariantBooleanvEXT_recording;
+if(this->m_ptr_glDepthRange)this->m_ptr_glDepthRange = (FunctionTable::MEMBERPFNGLDEPTHRANGEPROC)&RecordingTableDecorator::m_glDepthRange_recording;
+if(this->m_ptr_glGetVertexAttribdvARB)this->m_ptr_glGetVertexAttribdvARB = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBDVARBPROC)&RecordingTableDecorator::m_glGetVertexAttribdvARB_recording;
+if(this->m_ptr_glGetColorTableParameterfv)this->m_ptr_glGetColorTableParameterfv = (FunctionTable::MEMBERPFNGLGETCOLORTABLEPARAMETERFVPROC)&RecordingTableDecorator::m_glGetColorTableParameterfv_recording;
+if(this->m_ptr_glDrawArraysInstancedEXT)this->m_ptr_glDrawArraysInstancedEXT = (FunctionTable::MEMBERPFNGLDRAWARRAYSINSTANCEDEXTPROC)&RecordingTableDecorator::m_glDrawArraysInstancedEXT_recording;
+if(this->m_ptr_glDisableClientStateIndexedEXT)this->m_ptr_glDisableClientStateIndexedEXT = (FunctionTable::MEMBERPFNGLDISABLECLIENTSTATEINDEXEDEXTPROC)&RecordingTableDecorator::m_glDisableClientStateIndexedEXT_recording;
+if(this->m_ptr_glDrawBuffer)this->m_ptr_glDrawBuffer = (FunctionTable::MEMBERPFNGLDRAWBUFFERPROC)&RecordingTableDecorator::m_glDrawBuffer_recording;
+if(this->m_ptr_glMultiDrawArraysIndirectBindlessNV)this->m_ptr_glMultiDrawArraysIndirectBindlessNV = (FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSINDIRECTBINDLESSNVPROC)&RecordingTableDecorator::m_glMultiDrawArraysIndirectBindlessNV_recording;
+if(this->m_ptr_glGetnPixelMapusv)this->m_ptr_glGetnPixelMapusv = (FunctionTable::MEMBERPFNGLGETNPIXELMAPUSVPROC)&RecordingTableDecorator::m_glGetnPixelMapusv_recording;
+if(this->m_ptr_glRasterPos3fv)this->m_ptr_glRasterPos3fv = (FunctionTable::MEMBERPFNGLRASTERPOS3FVPROC)&RecordingTableDecorator::m_glRasterPos3fv_recording;
+if(this->m_ptr_glClearBufferuiv)this->m_ptr_glClearBufferuiv = (FunctionTable::MEMBERPFNGLCLEARBUFFERUIVPROC)&RecordingTableDecorator::m_glClearBufferuiv_recording;
+if(this->m_ptr_glGetInternalformati64v)this->m_ptr_glGetInternalformati64v = (FunctionTable::MEMBERPFNGLGETINTERNALFORMATI64VPROC)&RecordingTableDecorator::m_glGetInternalformati64v_recording;
+if(this->m_ptr_glShaderSourceARB)this->m_ptr_glShaderSourceARB = (FunctionTable::MEMBERPFNGLSHADERSOURCEARBPROC)&RecordingTableDecorator::m_glShaderSourceARB_recording;
+if(this->m_ptr_glShaderOp3EXT)this->m_ptr_glShaderOp3EXT = (FunctionTable::MEMBERPFNGLSHADEROP3EXTPROC)&RecordingTableDecorator::m_glShaderOp3EXT_recording;
+if(this->m_ptr_glWindowPos2dvMESA)this->m_ptr_glWindowPos2dvMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS2DVMESAPROC)&RecordingTableDecorator::m_glWindowPos2dvMESA_recording;
+if(this->m_ptr_glClearIndex)this->m_ptr_glClearIndex = (FunctionTable::MEMBERPFNGLCLEARINDEXPROC)&RecordingTableDecorator::m_glClearIndex_recording;
+if(this->m_ptr_glProvokingVertexEXT)this->m_ptr_glProvokingVertexEXT = (FunctionTable::MEMBERPFNGLPROVOKINGVERTEXEXTPROC)&RecordingTableDecorator::m_glProvokingVertexEXT_recording;
+if(this->m_ptr_glVariantubvEXT)this->m_ptr_glVariantubvEXT = (FunctionTable::MEMBERPFNGLVARIANTUBVEXTPROC)&RecordingTableDecorator::m_glVariantubvEXT_recording;
+if(this->m_ptr_glFlush)this->m_ptr_glFlush = (FunctionTable::MEMBERPFNGLFLUSHPROC)&RecordingTableDecorator::m_glFlush_recording;
+if(this->m_ptr_glGetColorTableParameterivEXT)this->m_ptr_glGetColorTableParameterivEXT = (FunctionTable::MEMBERPFNGLGETCOLORTABLEPARAMETERIVEXTPROC)&RecordingTableDecorator::m_glGetColorTableParameterivEXT_recording;
+if(this->m_ptr_glPresentFrameDualFillNV)this->m_ptr_glPresentFrameDualFillNV = (FunctionTable::MEMBERPFNGLPRESENTFRAMEDUALFILLNVPROC)&RecordingTableDecorator::m_glPresentFrameDualFillNV_recording;
+if(this->m_ptr_glGenVertexShadersEXT)this->m_ptr_glGenVertexShadersEXT = (FunctionTable::MEMBERPFNGLGENVERTEXSHADERSEXTPROC)&RecordingTableDecorator::m_glGenVertexShadersEXT_recording;
+if(this->m_ptr_glProgramUniformHandleui64vARB)this->m_ptr_glProgramUniformHandleui64vARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMHANDLEUI64VARBPROC)&RecordingTableDecorator::m_glProgramUniformHandleui64vARB_recording;
+if(this->m_ptr_glDepthRangefOES)this->m_ptr_glDepthRangefOES = (FunctionTable::MEMBERPFNGLDEPTHRANGEFOESPROC)&RecordingTableDecorator::m_glDepthRangefOES_recording;
+if(this->m_ptr_glDrawElementsInstancedBaseVertexBaseInstance)this->m_ptr_glDrawElementsInstancedBaseVertexBaseInstance = (FunctionTable::MEMBERPFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC)&RecordingTableDecorator::m_glDrawElementsInstancedBaseVertexBaseInstance_recording;
+if(this->m_ptr_glGetTexLevelParameteriv)this->m_ptr_glGetTexLevelParameteriv = (FunctionTable::MEMBERPFNGLGETTEXLEVELPARAMETERIVPROC)&RecordingTableDecorator::m_glGetTexLevelParameteriv_recording;
+if(this->m_ptr_glStencilFillPathNV)this->m_ptr_glStencilFillPathNV = (FunctionTable::MEMBERPFNGLSTENCILFILLPATHNVPROC)&RecordingTableDecorator::m_glStencilFillPathNV_recording;
+if(this->m_ptr_glWindowPos3iARB)this->m_ptr_glWindowPos3iARB = (FunctionTable::MEMBERPFNGLWINDOWPOS3IARBPROC)&RecordingTableDecorator::m_glWindowPos3iARB_recording;
+if(this->m_ptr_glPrioritizeTextures)this->m_ptr_glPrioritizeTextures = (FunctionTable::MEMBERPFNGLPRIORITIZETEXTURESPROC)&RecordingTableDecorator::m_glPrioritizeTextures_recording;
+if(this->m_ptr_glWindowPos3fvMESA)this->m_ptr_glWindowPos3fvMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS3FVMESAPROC)&RecordingTableDecorator::m_glWindowPos3fvMESA_recording;
+if(this->m_ptr_glProgramUniformMatrix3x2dvEXT)this->m_ptr_glProgramUniformMatrix3x2dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X2DVEXTPROC)&RecordingTableDecorator::m_glProgramUniformMatrix3x2dvEXT_recording;
+if(this->m_ptr_glVertex4xvOES)this->m_ptr_glVertex4xvOES = (FunctionTable::MEMBERPFNGLVERTEX4XVOESPROC)&RecordingTableDecorator::m_glVertex4xvOES_recording;
+if(this->m_ptr_glTexStorage3DMultisample)this->m_ptr_glTexStorage3DMultisample = (FunctionTable::MEMBERPFNGLTEXSTORAGE3DMULTISAMPLEPROC)&RecordingTableDecorator::m_glTexStorage3DMultisample_recording;
+if(this->m_ptr_glWindowPos2sARB)this->m_ptr_glWindowPos2sARB = (FunctionTable::MEMBERPFNGLWINDOWPOS2SARBPROC)&RecordingTableDecorator::m_glWindowPos2sARB_recording;
+if(this->m_ptr_glStencilOpValueAMD)this->m_ptr_glStencilOpValueAMD = (FunctionTable::MEMBERPFNGLSTENCILOPVALUEAMDPROC)&RecordingTableDecorator::m_glStencilOpValueAMD_recording;
+if(this->m_ptr_glProgramVertexLimitNV)this->m_ptr_glProgramVertexLimitNV = (FunctionTable::MEMBERPFNGLPROGRAMVERTEXLIMITNVPROC)&RecordingTableDecorator::m_glProgramVertexLimitNV_recording;
+if(this->m_ptr_glGetTexParameterPointervAPPLE)this->m_ptr_glGetTexParameterPointervAPPLE = (FunctionTable::MEMBERPFNGLGETTEXPARAMETERPOINTERVAPPLEPROC)&RecordingTableDecorator::m_glGetTexParameterPointervAPPLE_recording;
+if(this->m_ptr_glProgramUniform3uivEXT)this->m_ptr_glProgramUniform3uivEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UIVEXTPROC)&RecordingTableDecorator::m_glProgramUniform3uivEXT_recording;
+if(this->m_ptr_glClampColor)this->m_ptr_glClampColor = (FunctionTable::MEMBERPFNGLCLAMPCOLORPROC)&RecordingTableDecorator::m_glClampColor_recording;
+if(this->m_ptr_glClearStencil)this->m_ptr_glClearStencil = (FunctionTable::MEMBERPFNGLCLEARSTENCILPROC)&RecordingTableDecorator::m_glClearStencil_recording;
+if(this->m_ptr_glTexCoordP1uiv)this->m_ptr_glTexCoordP1uiv = (FunctionTable::MEMBERPFNGLTEXCOORDP1UIVPROC)&RecordingTableDecorator::m_glTexCoordP1uiv_recording;
+if(this->m_ptr_glVertexAttribs3svNV)this->m_ptr_glVertexAttribs3svNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS3SVNVPROC)&RecordingTableDecorator::m_glVertexAttribs3svNV_recording;
+if(this->m_ptr_glMultiTexCoord3fv)this->m_ptr_glMultiTexCoord3fv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3FVPROC)&RecordingTableDecorator::m_glMultiTexCoord3fv_recording;
+if(this->m_ptr_glVertexBlendEnvfATI)this->m_ptr_glVertexBlendEnvfATI = (FunctionTable::MEMBERPFNGLVERTEXBLENDENVFATIPROC)&RecordingTableDecorator::m_glVertexBlendEnvfATI_recording;
+if(this->m_ptr_glIsFenceAPPLE)this->m_ptr_glIsFenceAPPLE = (FunctionTable::MEMBERPFNGLISFENCEAPPLEPROC)&RecordingTableDecorator::m_glIsFenceAPPLE_recording;
+if(this->m_ptr_glGetBufferParameterui64vNV)this->m_ptr_glGetBufferParameterui64vNV = (FunctionTable::MEMBERPFNGLGETBUFFERPARAMETERUI64VNVPROC)&RecordingTableDecorator::m_glGetBufferParameterui64vNV_recording;
+if(this->m_ptr_glVertexAttribI4bvEXT)this->m_ptr_glVertexAttribI4bvEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4BVEXTPROC)&RecordingTableDecorator::m_glVertexAttribI4bvEXT_recording;
+if(this->m_ptr_glUniform2fARB)this->m_ptr_glUniform2fARB = (FunctionTable::MEMBERPFNGLUNIFORM2FARBPROC)&RecordingTableDecorator::m_glUniform2fARB_recording;
+if(this->m_ptr_glStopInstrumentsSGIX)this->m_ptr_glStopInstrumentsSGIX = (FunctionTable::MEMBERPFNGLSTOPINSTRUMENTSSGIXPROC)&RecordingTableDecorator::m_glStopInstrumentsSGIX_recording;
+if(this->m_ptr_glVertexAttrib3fNV)this->m_ptr_glVertexAttrib3fNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3FNVPROC)&RecordingTableDecorator::m_glVertexAttrib3fNV_recording;
+if(this->m_ptr_glMapVertexAttrib2dAPPLE)this->m_ptr_glMapVertexAttrib2dAPPLE = (FunctionTable::MEMBERPFNGLMAPVERTEXATTRIB2DAPPLEPROC)&RecordingTableDecorator::m_glMapVertexAttrib2dAPPLE_recording;
+if(this->m_ptr_glVertex2f)this->m_ptr_glVertex2f = (FunctionTable::MEMBERPFNGLVERTEX2FPROC)&RecordingTableDecorator::m_glVertex2f_recording;
+if(this->m_ptr_glCopyTextureImage2DEXT)this->m_ptr_glCopyTextureImage2DEXT = (FunctionTable::MEMBERPFNGLCOPYTEXTUREIMAGE2DEXTPROC)&RecordingTableDecorator::m_glCopyTextureImage2DEXT_recording;
+if(this->m_ptr_glVertex2d)this->m_ptr_glVertex2d = (FunctionTable::MEMBERPFNGLVERTEX2DPROC)&RecordingTableDecorator::m_glVertex2d_recording;
+if(this->m_ptr_glSecondaryColor3bvEXT)this->m_ptr_glSecondaryColor3bvEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3BVEXTPROC)&RecordingTableDecorator::m_glSecondaryColor3bvEXT_recording;
+if(this->m_ptr_glMultiTexCoord4fARB)this->m_ptr_glMultiTexCoord4fARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4FARBPROC)&RecordingTableDecorator::m_glMultiTexCoord4fARB_recording;
+if(this->m_ptr_glPolygonOffset)this->m_ptr_glPolygonOffset = (FunctionTable::MEMBERPFNGLPOLYGONOFFSETPROC)&RecordingTableDecorator::m_glPolygonOffset_recording;
+if(this->m_ptr_glTangent3bvEXT)this->m_ptr_glTangent3bvEXT = (FunctionTable::MEMBERPFNGLTANGENT3BVEXTPROC)&RecordingTableDecorator::m_glTangent3bvEXT_recording;
+if(this->m_ptr_glHistogram)this->m_ptr_glHistogram = (FunctionTable::MEMBERPFNGLHISTOGRAMPROC)&RecordingTableDecorator::m_glHistogram_recording;
+if(this->m_ptr_glGetProgramiv)this->m_ptr_glGetProgramiv = (FunctionTable::MEMBERPFNGLGETPROGRAMIVPROC)&RecordingTableDecorator::m_glGetProgramiv_recording;
+if(this->m_ptr_glMatrixIndexubvARB)this->m_ptr_glMatrixIndexubvARB = (FunctionTable::MEMBERPFNGLMATRIXINDEXUBVARBPROC)&RecordingTableDecorator::m_glMatrixIndexubvARB_recording;
+if(this->m_ptr_glVertex2s)this->m_ptr_glVertex2s = (FunctionTable::MEMBERPFNGLVERTEX2SPROC)&RecordingTableDecorator::m_glVertex2s_recording;
+if(this->m_ptr_glGetVertexAttribLui64vNV)this->m_ptr_glGetVertexAttribLui64vNV = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBLUI64VNVPROC)&RecordingTableDecorator::m_glGetVertexAttribLui64vNV_recording;
+if(this->m_ptr_glGetProgramStringARB)this->m_ptr_glGetProgramStringARB = (FunctionTable::MEMBERPFNGLGETPROGRAMSTRINGARBPROC)&RecordingTableDecorator::m_glGetProgramStringARB_recording;
+if(this->m_ptr_glFlushMappedBufferRange)this->m_ptr_glFlushMappedBufferRange = (FunctionTable::MEMBERPFNGLFLUSHMAPPEDBUFFERRANGEPROC)&RecordingTableDecorator::m_glFlushMappedBufferRange_recording;
+if(this->m_ptr_glVertexAttribI3uiEXT)this->m_ptr_glVertexAttribI3uiEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI3UIEXTPROC)&RecordingTableDecorator::m_glVertexAttribI3uiEXT_recording;
+if(this->m_ptr_glLineWidthxOES)this->m_ptr_glLineWidthxOES = (FunctionTable::MEMBERPFNGLLINEWIDTHXOESPROC)&RecordingTableDecorator::m_glLineWidthxOES_recording;
+if(this->m_ptr_glProgramUniformMatrix2fvEXT)this->m_ptr_glProgramUniformMatrix2fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2FVEXTPROC)&RecordingTableDecorator::m_glProgramUniformMatrix2fvEXT_recording;
+if(this->m_ptr_glGetTextureParameterIuivEXT)this->m_ptr_glGetTextureParameterIuivEXT = (FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERIUIVEXTPROC)&RecordingTableDecorator::m_glGetTextureParameterIuivEXT_recording;
+if(this->m_ptr_glGetMultiTexEnvivEXT)this->m_ptr_glGetMultiTexEnvivEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXENVIVEXTPROC)&RecordingTableDecorator::m_glGetMultiTexEnvivEXT_recording;
+if(this->m_ptr_glPixelTexGenParameterivSGIS)this->m_ptr_glPixelTexGenParameterivSGIS = (FunctionTable::MEMBERPFNGLPIXELTEXGENPARAMETERIVSGISPROC)&RecordingTableDecorator::m_glPixelTexGenParameterivSGIS_recording;
+if(this->m_ptr_glGenQueries)this->m_ptr_glGenQueries = (FunctionTable::MEMBERPFNGLGENQUERIESPROC)&RecordingTableDecorator::m_glGenQueries_recording;
+if(this->m_ptr_glGetPixelMapfv)this->m_ptr_glGetPixelMapfv = (FunctionTable::MEMBERPFNGLGETPIXELMAPFVPROC)&RecordingTableDecorator::m_glGetPixelMapfv_recording;
+if(this->m_ptr_glBlendColorEXT)this->m_ptr_glBlendColorEXT = (FunctionTable::MEMBERPFNGLBLENDCOLOREXTPROC)&RecordingTableDecorator::m_glBlendColorEXT_recording;
+if(this->m_ptr_glResetMinmax)this->m_ptr_glResetMinmax = (FunctionTable::MEMBERPFNGLRESETMINMAXPROC)&RecordingTableDecorator::m_glResetMinmax_recording;
+if(this->m_ptr_glGetnUniformivARB)this->m_ptr_glGetnUniformivARB = (FunctionTable::MEMBERPFNGLGETNUNIFORMIVARBPROC)&RecordingTableDecorator::m_glGetnUniformivARB_recording;
+if(this->m_ptr_glVertexBlendARB)this->m_ptr_glVertexBlendARB = (FunctionTable::MEMBERPFNGLVERTEXBLENDARBPROC)&RecordingTableDecorator::m_glVertexBlendARB_recording;
+if(this->m_ptr_glVertexAttrib4d)this->m_ptr_glVertexAttrib4d = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4DPROC)&RecordingTableDecorator::m_glVertexAttrib4d_recording;
+if(this->m_ptr_glGetVaryingLocationNV)this->m_ptr_glGetVaryingLocationNV = (FunctionTable::MEMBERPFNGLGETVARYINGLOCATIONNVPROC)&RecordingTableDecorator::m_glGetVaryingLocationNV_recording;
+if(this->m_ptr_glGetMapAttribParameterivNV)this->m_ptr_glGetMapAttribParameterivNV = (FunctionTable::MEMBERPFNGLGETMAPATTRIBPARAMETERIVNVPROC)&RecordingTableDecorator::m_glGetMapAttribParameterivNV_recording;
+if(this->m_ptr_glTexSubImage3D)this->m_ptr_glTexSubImage3D = (FunctionTable::MEMBERPFNGLTEXSUBIMAGE3DPROC)&RecordingTableDecorator::m_glTexSubImage3D_recording;
+if(this->m_ptr_glDeleteSamplers)this->m_ptr_glDeleteSamplers = (FunctionTable::MEMBERPFNGLDELETESAMPLERSPROC)&RecordingTableDecorator::m_glDeleteSamplers_recording;
+if(this->m_ptr_glGetLightxOES)this->m_ptr_glGetLightxOES = (FunctionTable::MEMBERPFNGLGETLIGHTXOESPROC)&RecordingTableDecorator::m_glGetLightxOES_recording;
+if(this->m_ptr_glGetVertexAttribArrayObjectfvATI)this->m_ptr_glGetVertexAttribArrayObjectfvATI = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBARRAYOBJECTFVATIPROC)&RecordingTableDecorator::m_glGetVertexAttribArrayObjectfvATI_recording;
+if(this->m_ptr_glVertexArrayNormalOffsetEXT)this->m_ptr_glVertexArrayNormalOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYNORMALOFFSETEXTPROC)&RecordingTableDecorator::m_glVertexArrayNormalOffsetEXT_recording;
+if(this->m_ptr_glGetBufferParameterivARB)this->m_ptr_glGetBufferParameterivARB = (FunctionTable::MEMBERPFNGLGETBUFFERPARAMETERIVARBPROC)&RecordingTableDecorator::m_glGetBufferParameterivARB_recording;
+if(this->m_ptr_glGetTextureParameterfv)this->m_ptr_glGetTextureParameterfv = (FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERFVPROC)&RecordingTableDecorator::m_glGetTextureParameterfv_recording;
+if(this->m_ptr_glDrawMeshArraysSUN)this->m_ptr_glDrawMeshArraysSUN = (FunctionTable::MEMBERPFNGLDRAWMESHARRAYSSUNPROC)&RecordingTableDecorator::m_glDrawMeshArraysSUN_recording;
+if(this->m_ptr_glVertexAttrib4dNV)this->m_ptr_glVertexAttrib4dNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4DNVPROC)&RecordingTableDecorator::m_glVertexAttrib4dNV_recording;
+if(this->m_ptr_glGetMultisamplefvNV)this->m_ptr_glGetMultisamplefvNV = (FunctionTable::MEMBERPFNGLGETMULTISAMPLEFVNVPROC)&RecordingTableDecorator::m_glGetMultisamplefvNV_recording;
+if(this->m_ptr_glMapObjectBufferATI)this->m_ptr_glMapObjectBufferATI = (FunctionTable::MEMBERPFNGLMAPOBJECTBUFFERATIPROC)&RecordingTableDecorator::m_glMapObjectBufferATI_recording;
+if(this->m_ptr_glGetPathCommandsNV)this->m_ptr_glGetPathCommandsNV = (FunctionTable::MEMBERPFNGLGETPATHCOMMANDSNVPROC)&RecordingTableDecorator::m_glGetPathCommandsNV_recording;
+if(this->m_ptr_glVertexArrayTexCoordOffsetEXT)this->m_ptr_glVertexArrayTexCoordOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYTEXCOORDOFFSETEXTPROC)&RecordingTableDecorator::m_glVertexArrayTexCoordOffsetEXT_recording;
+if(this->m_ptr_glGetHistogram)this->m_ptr_glGetHistogram = (FunctionTable::MEMBERPFNGLGETHISTOGRAMPROC)&RecordingTableDecorator::m_glGetHistogram_recording;
+if(this->m_ptr_glMatrixMode)this->m_ptr_glMatrixMode = (FunctionTable::MEMBERPFNGLMATRIXMODEPROC)&RecordingTableDecorator::m_glMatrixMode_recording;
+if(this->m_ptr_glColorFormatNV)this->m_ptr_glColorFormatNV = (FunctionTable::MEMBERPFNGLCOLORFORMATNVPROC)&RecordingTableDecorator::m_glColorFormatNV_recording;
+if(this->m_ptr_glProgramUniformui64NV)this->m_ptr_glProgramUniformui64NV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMUI64NVPROC)&RecordingTableDecorator::m_glProgramUniformui64NV_recording;
+if(this->m_ptr_glProgramUniformMatrix4x2fvEXT)this->m_ptr_glProgramUniformMatrix4x2fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X2FVEXTPROC)&RecordingTableDecorator::m_glProgramUniformMatrix4x2fvEXT_recording;
+if(this->m_ptr_glLoadMatrixxOES)this->m_ptr_glLoadMatrixxOES = (FunctionTable::MEMBERPFNGLLOADMATRIXXOESPROC)&RecordingTableDecorator::m_glLoadMatrixxOES_recording;
+if(this->m_ptr_glGetColorTableParameterfvEXT)this->m_ptr_glGetColorTableParameterfvEXT = (FunctionTable::MEMBERPFNGLGETCOLORTABLEPARAMETERFVEXTPROC)&RecordingTableDecorator::m_glGetColorTableParameterfvEXT_recording;
+if(this->m_ptr_glRasterPos4i)this->m_ptr_glRasterPos4i = (FunctionTable::MEMBERPFNGLRASTERPOS4IPROC)&RecordingTableDecorator::m_glRasterPos4i_recording;
+if(this->m_ptr_glVertexAttribL2i64NV)this->m_ptr_glVertexAttribL2i64NV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL2I64NVPROC)&RecordingTableDecorator::m_glVertexAttribL2i64NV_recording;
+if(this->m_ptr_glBindTextures)this->m_ptr_glBindTextures = (FunctionTable::MEMBERPFNGLBINDTEXTURESPROC)&RecordingTableDecorator::m_glBindTextures_recording;
+if(this->m_ptr_glMatrixRotatefEXT)this->m_ptr_glMatrixRotatefEXT = (FunctionTable::MEMBERPFNGLMATRIXROTATEFEXTPROC)&RecordingTableDecorator::m_glMatrixRotatefEXT_recording;
+if(this->m_ptr_glGetClipPlanexOES)this->m_ptr_glGetClipPlanexOES = (FunctionTable::MEMBERPFNGLGETCLIPPLANEXOESPROC)&RecordingTableDecorator::m_glGetClipPlanexOES_recording;
+if(this->m_ptr_glSecondaryColor3uivEXT)this->m_ptr_glSecondaryColor3uivEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UIVEXTPROC)&RecordingTableDecorator::m_glSecondaryColor3uivEXT_recording;
+if(this->m_ptr_glGetPerfQueryInfoINTEL)this->m_ptr_glGetPerfQueryInfoINTEL = (FunctionTable::MEMBERPFNGLGETPERFQUERYINFOINTELPROC)&RecordingTableDecorator::m_glGetPerfQueryInfoINTEL_recording;
+if(this->m_ptr_glGetDoublev)this->m_ptr_glGetDoublev = (FunctionTable::MEMBERPFNGLGETDOUBLEVPROC)&RecordingTableDecorator::m_glGetDoublev_recording;
+if(this->m_ptr_glBindBufferRangeEXT)this->m_ptr_glBindBufferRangeEXT = (FunctionTable::MEMBERPFNGLBINDBUFFERRANGEEXTPROC)&RecordingTableDecorator::m_glBindBufferRangeEXT_recording;
+if(this->m_ptr_glCompressedTexImage2D)this->m_ptr_glCompressedTexImage2D = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXIMAGE2DPROC)&RecordingTableDecorator::m_glCompressedTexImage2D_recording;
+if(this->m_ptr_glMapBufferARB)this->m_ptr_glMapBufferARB = (FunctionTable::MEMBERPFNGLMAPBUFFERARBPROC)&RecordingTableDecorator::m_glMapBufferARB_recording;
+if(this->m_ptr_glGetPathSpacingNV)this->m_ptr_glGetPathSpacingNV = (FunctionTable::MEMBERPFNGLGETPATHSPACINGNVPROC)&RecordingTableDecorator::m_glGetPathSpacingNV_recording;
+if(this->m_ptr_glUniform4dv)this->m_ptr_glUniform4dv = (FunctionTable::MEMBERPFNGLUNIFORM4DVPROC)&RecordingTableDecorator::m_glUniform4dv_recording;
+if(this->m_ptr_glGlobalAlphaFactordSUN)this->m_ptr_glGlobalAlphaFactordSUN = (FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORDSUNPROC)&RecordingTableDecorator::m_glGlobalAlphaFactordSUN_recording;
+if(this->m_ptr_glProgramUniform3dv)this->m_ptr_glProgramUniform3dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3DVPROC)&RecordingTableDecorator::m_glProgramUniform3dv_recording;
+if(this->m_ptr_glGetShaderSourceARB)this->m_ptr_glGetShaderSourceARB = (FunctionTable::MEMBERPFNGLGETSHADERSOURCEARBPROC)&RecordingTableDecorator::m_glGetShaderSourceARB_recording;
+if(this->m_ptr_glVertexAttrib3dvARB)this->m_ptr_glVertexAttrib3dvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3DVARBPROC)&RecordingTableDecorator::m_glVertexAttrib3dvARB_recording;
+if(this->m_ptr_glInvalidateBufferData)this->m_ptr_glInvalidateBufferData = (FunctionTable::MEMBERPFNGLINVALIDATEBUFFERDATAPROC)&RecordingTableDecorator::m_glInvalidateBufferData_recording;
+if(this->m_ptr_glMatrixLoad3x2fNV)this->m_ptr_glMatrixLoad3x2fNV = (FunctionTable::MEMBERPFNGLMATRIXLOAD3X2FNVPROC)&RecordingTableDecorator::m_glMatrixLoad3x2fNV_recording;
+if(this->m_ptr_glCompressedTextureSubImage1D)this->m_ptr_glCompressedTextureSubImage1D = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC)&RecordingTableDecorator::m_glCompressedTextureSubImage1D_recording;
+if(this->m_ptr_glTexCoord3xvOES)this->m_ptr_glTexCoord3xvOES = (FunctionTable::MEMBERPFNGLTEXCOORD3XVOESPROC)&RecordingTableDecorator::m_glTexCoord3xvOES_recording;
+if(this->m_ptr_glGenTexturesEXT)this->m_ptr_glGenTexturesEXT = (FunctionTable::MEMBERPFNGLGENTEXTURESEXTPROC)&RecordingTableDecorator::m_glGenTexturesEXT_recording;
+if(this->m_ptr_glTangent3iEXT)this->m_ptr_glTangent3iEXT = (FunctionTable::MEMBERPFNGLTANGENT3IEXTPROC)&RecordingTableDecorator::m_glTangent3iEXT_recording;
+if(this->m_ptr_glClearTexImage)this->m_ptr_glClearTexImage = (FunctionTable::MEMBERPFNGLCLEARTEXIMAGEPROC)&RecordingTableDecorator::m_glClearTexImage_recording;
+if(this->m_ptr_glBinormal3bvEXT)this->m_ptr_glBinormal3bvEXT = (FunctionTable::MEMBERPFNGLBINORMAL3BVEXTPROC)&RecordingTableDecorator::m_glBinormal3bvEXT_recording;
+if(this->m_ptr_glUniform3fv)this->m_ptr_glUniform3fv = (FunctionTable::MEMBERPFNGLUNIFORM3FVPROC)&RecordingTableDecorator::m_glUniform3fv_recording;
+if(this->m_ptr_glGetnPixelMapusvARB)this->m_ptr_glGetnPixelMapusvARB = (FunctionTable::MEMBERPFNGLGETNPIXELMAPUSVARBPROC)&RecordingTableDecorator::m_glGetnPixelMapusvARB_recording;
+if(this->m_ptr_glMultiTexCoordP1ui)this->m_ptr_glMultiTexCoordP1ui = (FunctionTable::MEMBERPFNGLMULTITEXCOORDP1UIPROC)&RecordingTableDecorator::m_glMultiTexCoordP1ui_recording;
+if(this->m_ptr_glClearNamedBufferDataEXT)this->m_ptr_glClearNamedBufferDataEXT = (FunctionTable::MEMBERPFNGLCLEARNAMEDBUFFERDATAEXTPROC)&RecordingTableDecorator::m_glClearNamedBufferDataEXT_recording;
+if(this->m_ptr_glUniformMatrix4dv)this->m_ptr_glUniformMatrix4dv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX4DVPROC)&RecordingTableDecorator::m_glUniformMatrix4dv_recording;
+if(this->m_ptr_glWindowPos3fMESA)this->m_ptr_glWindowPos3fMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS3FMESAPROC)&RecordingTableDecorator::m_glWindowPos3fMESA_recording;
+if(this->m_ptr_glDeleteRenderbuffers)this->m_ptr_glDeleteRenderbuffers = (FunctionTable::MEMBERPFNGLDELETERENDERBUFFERSPROC)&RecordingTableDecorator::m_glDeleteRenderbuffers_recording;
+if(this->m_ptr_glGetTextureLevelParameterfvEXT)this->m_ptr_glGetTextureLevelParameterfvEXT = (FunctionTable::MEMBERPFNGLGETTEXTURELEVELPARAMETERFVEXTPROC)&RecordingTableDecorator::m_glGetTextureLevelParameterfvEXT_recording;
+if(this->m_ptr_glGetHistogramParameterxvOES)this->m_ptr_glGetHistogramParameterxvOES = (FunctionTable::MEMBERPFNGLGETHISTOGRAMPARAMETERXVOESPROC)&RecordingTableDecorator::m_glGetHistogramParameterxvOES_recording;
+if(this->m_ptr_glMultiDrawElements)this->m_ptr_glMultiDrawElements = (FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSPROC)&RecordingTableDecorator::m_glMultiDrawElements_recording;
+if(this->m_ptr_glMakeImageHandleNonResidentNV)this->m_ptr_glMakeImageHandleNonResidentNV = (FunctionTable::MEMBERPFNGLMAKEIMAGEHANDLENONRESIDENTNVPROC)&RecordingTableDecorator::m_glMakeImageHandleNonResidentNV_recording;
+if(this->m_ptr_glTexSubImage1DEXT)this->m_ptr_glTexSubImage1DEXT = (FunctionTable::MEMBERPFNGLTEXSUBIMAGE1DEXTPROC)&RecordingTableDecorator::m_glTexSubImage1DEXT_recording;
+if(this->m_ptr_glNormalStream3dATI)this->m_ptr_glNormalStream3dATI = (FunctionTable::MEMBERPFNGLNORMALSTREAM3DATIPROC)&RecordingTableDecorator::m_glNormalStream3dATI_recording;
+if(this->m_ptr_glVertexAttribL4i64vNV)this->m_ptr_glVertexAttribL4i64vNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL4I64VNVPROC)&RecordingTableDecorator::m_glVertexAttribL4i64vNV_recording;
+if(this->m_ptr_glDrawBuffers)this->m_ptr_glDrawBuffers = (FunctionTable::MEMBERPFNGLDRAWBUFFERSPROC)&RecordingTableDecorator::m_glDrawBuffers_recording;
+if(this->m_ptr_glCopyTextureSubImage1DEXT)this->m_ptr_glCopyTextureSubImage1DEXT = (FunctionTable::MEMBERPFNGLCOPYTEXTURESUBIMAGE1DEXTPROC)&RecordingTableDecorator::m_glCopyTextureSubImage1DEXT_recording;
+if(this->m_ptr_glWindowRectanglesEXT)this->m_ptr_glWindowRectanglesEXT = (FunctionTable::MEMBERPFNGLWINDOWRECTANGLESEXTPROC)&RecordingTableDecorator::m_glWindowRectanglesEXT_recording;
+if(this->m_ptr_glNamedFramebufferReadBuffer)this->m_ptr_glNamedFramebufferReadBuffer = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERREADBUFFERPROC)&RecordingTableDecorator::m_glNamedFramebufferReadBuffer_recording;
+if(this->m_ptr_glUniform2i64vARB)this->m_ptr_glUniform2i64vARB = (FunctionTable::MEMBERPFNGLUNIFORM2I64VARBPROC)&RecordingTableDecorator::m_glUniform2i64vARB_recording;
+if(this->m_ptr_glVertexAttribI1uivEXT)this->m_ptr_glVertexAttribI1uivEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI1UIVEXTPROC)&RecordingTableDecorator::m_glVertexAttribI1uivEXT_recording;
+if(this->m_ptr_glGetTexGenfv)this->m_ptr_glGetTexGenfv = (FunctionTable::MEMBERPFNGLGETTEXGENFVPROC)&RecordingTableDecorator::m_glGetTexGenfv_recording;
+if(this->m_ptr_glBeginQueryARB)this->m_ptr_glBeginQueryARB = (FunctionTable::MEMBERPFNGLBEGINQUERYARBPROC)&RecordingTableDecorator::m_glBeginQueryARB_recording;
+if(this->m_ptr_glUniform1iARB)this->m_ptr_glUniform1iARB = (FunctionTable::MEMBERPFNGLUNIFORM1IARBPROC)&RecordingTableDecorator::m_glUniform1iARB_recording;
+if(this->m_ptr_glVertex4bvOES)this->m_ptr_glVertex4bvOES = (FunctionTable::MEMBERPFNGLVERTEX4BVOESPROC)&RecordingTableDecorator::m_glVertex4bvOES_recording;
+if(this->m_ptr_glInvalidateSubFramebuffer)this->m_ptr_glInvalidateSubFramebuffer = (FunctionTable::MEMBERPFNGLINVALIDATESUBFRAMEBUFFERPROC)&RecordingTableDecorator::m_glInvalidateSubFramebuffer_recording;
+if(this->m_ptr_glUniform1fvARB)this->m_ptr_glUniform1fvARB = (FunctionTable::MEMBERPFNGLUNIFORM1FVARBPROC)&RecordingTableDecorator::m_glUniform1fvARB_recording;
+if(this->m_ptr_glTestFenceNV)this->m_ptr_glTestFenceNV = (FunctionTable::MEMBERPFNGLTESTFENCENVPROC)&RecordingTableDecorator::m_glTestFenceNV_recording;
+if(this->m_ptr_glBindTransformFeedback)this->m_ptr_glBindTransformFeedback = (FunctionTable::MEMBERPFNGLBINDTRANSFORMFEEDBACKPROC)&RecordingTableDecorator::m_glBindTransformFeedback_recording;
+if(this->m_ptr_glMultiTexCoord2iv)this->m_ptr_glMultiTexCoord2iv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2IVPROC)&RecordingTableDecorator::m_glMultiTexCoord2iv_recording;
+if(this->m_ptr_glCopyMultiTexSubImage1DEXT)this->m_ptr_glCopyMultiTexSubImage1DEXT = (FunctionTable::MEMBERPFNGLCOPYMULTITEXSUBIMAGE1DEXTPROC)&RecordingTableDecorator::m_glCopyMultiTexSubImage1DEXT_recording;
+if(this->m_ptr_glVariantbvEXT)this->m_ptr_glVariantbvEXT = (FunctionTable::MEMBERPFNGLVARIANTBVEXTPROC)&RecordingTableDecorator::m_glVariantbvEXT_recording;
+if(this->m_ptr_glTexCoord1hNV)this->m_ptr_glTexCoord1hNV = (FunctionTable::MEMBERPFNGLTEXCOORD1HNVPROC)&RecordingTableDecorator::m_glTexCoord1hNV_recording;
+if(this->m_ptr_glGenFencesNV)this->m_ptr_glGenFencesNV = (FunctionTable::MEMBERPFNGLGENFENCESNVPROC)&RecordingTableDecorator::m_glGenFencesNV_recording;
+if(this->m_ptr_glRasterPos3iv)this->m_ptr_glRasterPos3iv = (FunctionTable::MEMBERPFNGLRASTERPOS3IVPROC)&RecordingTableDecorator::m_glRasterPos3iv_recording;
+if(this->m_ptr_glVertexAttribL2ui64NV)this->m_ptr_glVertexAttribL2ui64NV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL2UI64NVPROC)&RecordingTableDecorator::m_glVertexAttribL2ui64NV_recording;
+if(this->m_ptr_glMultiTexCoord1hvNV)this->m_ptr_glMultiTexCoord1hvNV = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1HVNVPROC)&RecordingTableDecorator::m_glMultiTexCoord1hvNV_recording;
+if(this->m_ptr_glGetnConvolutionFilter)this->m_ptr_glGetnConvolutionFilter = (FunctionTable::MEMBERPFNGLGETNCONVOLUTIONFILTERPROC)&RecordingTableDecorator::m_glGetnConvolutionFilter_recording;
+if(this->m_ptr_glNormal3bv)this->m_ptr_glNormal3bv = (FunctionTable::MEMBERPFNGLNORMAL3BVPROC)&RecordingTableDecorator::m_glNormal3bv_recording;
+if(this->m_ptr_glWeightbvARB)this->m_ptr_glWeightbvARB = (FunctionTable::MEMBERPFNGLWEIGHTBVARBPROC)&RecordingTableDecorator::m_glWeightbvARB_recording;
+if(this->m_ptr_glTexCoord4sv)this->m_ptr_glTexCoord4sv = (FunctionTable::MEMBERPFNGLTEXCOORD4SVPROC)&RecordingTableDecorator::m_glTexCoord4sv_recording;
+if(this->m_ptr_glUniform2uiv)this->m_ptr_glUniform2uiv = (FunctionTable::MEMBERPFNGLUNIFORM2UIVPROC)&RecordingTableDecorator::m_glUniform2uiv_recording;
+if(this->m_ptr_glBeginConditionalRenderNVX)this->m_ptr_glBeginConditionalRenderNVX = (FunctionTable::MEMBERPFNGLBEGINCONDITIONALRENDERNVXPROC)&RecordingTableDecorator::m_glBeginConditionalRenderNVX_recording;
+if(this->m_ptr_glFinish)this->m_ptr_glFinish = (FunctionTable::MEMBERPFNGLFINISHPROC)&RecordingTableDecorator::m_glFinish_recording;
+if(this->m_ptr_glColorTableParameterfv)this->m_ptr_glColorTableParameterfv = (FunctionTable::MEMBERPFNGLCOLORTABLEPARAMETERFVPROC)&RecordingTableDecorator::m_glColorTableParameterfv_recording;
+if(this->m_ptr_glFragmentCoverageColorNV)this->m_ptr_glFragmentCoverageColorNV = (FunctionTable::MEMBERPFNGLFRAGMENTCOVERAGECOLORNVPROC)&RecordingTableDecorator::m_glFragmentCoverageColorNV_recording;
+if(this->m_ptr_glProgramUniform3ivEXT)this->m_ptr_glProgramUniform3ivEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3IVEXTPROC)&RecordingTableDecorator::m_glProgramUniform3ivEXT_recording;
+if(this->m_ptr_glVertexArrayVertexOffsetEXT)this->m_ptr_glVertexArrayVertexOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXOFFSETEXTPROC)&RecordingTableDecorator::m_glVertexArrayVertexOffsetEXT_recording;
+if(this->m_ptr_glViewportPositionWScaleNV)this->m_ptr_glViewportPositionWScaleNV = (FunctionTable::MEMBERPFNGLVIEWPORTPOSITIONWSCALENVPROC)&RecordingTableDecorator::m_glViewportPositionWScaleNV_recording;
+if(this->m_ptr_glGetProgramLocalParameterIuivNV)this->m_ptr_glGetProgramLocalParameterIuivNV = (FunctionTable::MEMBERPFNGLGETPROGRAMLOCALPARAMETERIUIVNVPROC)&RecordingTableDecorator::m_glGetProgramLocalParameterIuivNV_recording;
+if(this->m_ptr_glReplacementCodeuiTexCoord2fVertex3fvSUN)this->m_ptr_glReplacementCodeuiTexCoord2fVertex3fvSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUITEXCOORD2FVERTEX3FVSUNPROC)&RecordingTableDecorator::m_glReplacementCodeuiTexCoord2fVertex3fvSUN_recording;
+if(this->m_ptr_glUniform1uiv)this->m_ptr_glUniform1uiv = (FunctionTable::MEMBERPFNGLUNIFORM1UIVPROC)&RecordingTableDecorator::m_glUniform1uiv_recording;
+if(this->m_ptr_glUniformMatrix2dv)this->m_ptr_glUniformMatrix2dv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX2DVPROC)&RecordingTableDecorator::m_glUniformMatrix2dv_recording;
+if(this->m_ptr_glIndexdv)this->m_ptr_glIndexdv = (FunctionTable::MEMBERPFNGLINDEXDVPROC)&RecordingTableDecorator::m_glIndexdv_recording;
+if(this->m_ptr_glSecondaryColor3ivEXT)this->m_ptr_glSecondaryColor3ivEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3IVEXTPROC)&RecordingTableDecorator::m_glSecondaryColor3ivEXT_recording;
+if(this->m_ptr_glTexCoord3iv)this->m_ptr_glTexCoord3iv = (FunctionTable::MEMBERPFNGLTEXCOORD3IVPROC)&RecordingTableDecorator::m_glTexCoord3iv_recording;
+if(this->m_ptr_glVertexStream4fvATI)this->m_ptr_glVertexStream4fvATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM4FVATIPROC)&RecordingTableDecorator::m_glVertexStream4fvATI_recording;
+if(this->m_ptr_glDeformationMap3fSGIX)this->m_ptr_glDeformationMap3fSGIX = (FunctionTable::MEMBERPFNGLDEFORMATIONMAP3FSGIXPROC)&RecordingTableDecorator::m_glDeformationMap3fSGIX_recording;
+if(this->m_ptr_glClearDepth)this->m_ptr_glClearDepth = (FunctionTable::MEMBERPFNGLCLEARDEPTHPROC)&RecordingTableDecorator::m_glClearDepth_recording;
+if(this->m_ptr_glGenAsyncMarkersSGIX)this->m_ptr_glGenAsyncMarkersSGIX = (FunctionTable::MEMBERPFNGLGENASYNCMARKERSSGIXPROC)&RecordingTableDecorator::m_glGenAsyncMarkersSGIX_recording;
+if(this->m_ptr_glDisableIndexedEXT)this->m_ptr_glDisableIndexedEXT = (FunctionTable::MEMBERPFNGLDISABLEINDEXEDEXTPROC)&RecordingTableDecorator::m_glDisableIndexedEXT_recording;
+if(this->m_ptr_glVertexWeightfvEXT)this->m_ptr_glVertexWeightfvEXT = (FunctionTable::MEMBERPFNGLVERTEXWEIGHTFVEXTPROC)&RecordingTableDecorator::m_glVertexWeightfvEXT_recording;
+if(this->m_ptr_glGetProgramLocalParameterIivNV)this->m_ptr_glGetProgramLocalParameterIivNV = (FunctionTable::MEMBERPFNGLGETPROGRAMLOCALPARAMETERIIVNVPROC)&RecordingTableDecorator::m_glGetProgramLocalParameterIivNV_recording;
+if(this->m_ptr_glCompressedTexImage3DARB)this->m_ptr_glCompressedTexImage3DARB = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXIMAGE3DARBPROC)&RecordingTableDecorator::m_glCompressedTexImage3DARB_recording;
+if(this->m_ptr_glProgramParameter4fNV)this->m_ptr_glProgramParameter4fNV = (FunctionTable::MEMBERPFNGLPROGRAMPARAMETER4FNVPROC)&RecordingTableDecorator::m_glProgramParameter4fNV_recording;
+if(this->m_ptr_glConvolutionParameterxOES)this->m_ptr_glConvolutionParameterxOES = (FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERXOESPROC)&RecordingTableDecorator::m_glConvolutionParameterxOES_recording;
+if(this->m_ptr_glInsertComponentEXT)this->m_ptr_glInsertComponentEXT = (FunctionTable::MEMBERPFNGLINSERTCOMPONENTEXTPROC)&RecordingTableDecorator::m_glInsertComponentEXT_recording;
+if(this->m_ptr_glCreateTextures)this->m_ptr_glCreateTextures = (FunctionTable::MEMBERPFNGLCREATETEXTURESPROC)&RecordingTableDecorator::m_glCreateTextures_recording;
+if(this->m_ptr_glSecondaryColor3iv)this->m_ptr_glSecondaryColor3iv = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3IVPROC)&RecordingTableDecorator::m_glSecondaryColor3iv_recording;
+if(this->m_ptr_glCreateBuffers)this->m_ptr_glCreateBuffers = (FunctionTable::MEMBERPFNGLCREATEBUFFERSPROC)&RecordingTableDecorator::m_glCreateBuffers_recording;
+if(this->m_ptr_glMultiTexCoord2xvOES)this->m_ptr_glMultiTexCoord2xvOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2XVOESPROC)&RecordingTableDecorator::m_glMultiTexCoord2xvOES_recording;
+if(this->m_ptr_glTexGenxvOES)this->m_ptr_glTexGenxvOES = (FunctionTable::MEMBERPFNGLTEXGENXVOESPROC)&RecordingTableDecorator::m_glTexGenxvOES_recording;
+if(this->m_ptr_glMultTransposeMatrixf)this->m_ptr_glMultTransposeMatrixf = (FunctionTable::MEMBERPFNGLMULTTRANSPOSEMATRIXFPROC)&RecordingTableDecorator::m_glMultTransposeMatrixf_recording;
+if(this->m_ptr_glBeginTransformFeedbackEXT)this->m_ptr_glBeginTransformFeedbackEXT = (FunctionTable::MEMBERPFNGLBEGINTRANSFORMFEEDBACKEXTPROC)&RecordingTableDecorator::m_glBeginTransformFeedbackEXT_recording;
+if(this->m_ptr_glTexCoord2fColor3fVertex3fSUN)this->m_ptr_glTexCoord2fColor3fVertex3fSUN = (FunctionTable::MEMBERPFNGLTEXCOORD2FCOLOR3FVERTEX3FSUNPROC)&RecordingTableDecorator::m_glTexCoord2fColor3fVertex3fSUN_recording;
+if(this->m_ptr_glNormal3sv)this->m_ptr_glNormal3sv = (FunctionTable::MEMBERPFNGLNORMAL3SVPROC)&RecordingTableDecorator::m_glNormal3sv_recording;
+if(this->m_ptr_glFreeObjectBufferATI)this->m_ptr_glFreeObjectBufferATI = (FunctionTable::MEMBERPFNGLFREEOBJECTBUFFERATIPROC)&RecordingTableDecorator::m_glFreeObjectBufferATI_recording;
+if(this->m_ptr_glBlendBarrierNV)this->m_ptr_glBlendBarrierNV = (FunctionTable::MEMBERPFNGLBLENDBARRIERNVPROC)&RecordingTableDecorator::m_glBlendBarrierNV_recording;
+if(this->m_ptr_glUniform4i64vNV)this->m_ptr_glUniform4i64vNV = (FunctionTable::MEMBERPFNGLUNIFORM4I64VNVPROC)&RecordingTableDecorator::m_glUniform4i64vNV_recording;
+if(this->m_ptr_glGetnUniformuivARB)this->m_ptr_glGetnUniformuivARB = (FunctionTable::MEMBERPFNGLGETNUNIFORMUIVARBPROC)&RecordingTableDecorator::m_glGetnUniformuivARB_recording;
+if(this->m_ptr_glAlphaFragmentOp3ATI)this->m_ptr_glAlphaFragmentOp3ATI = (FunctionTable::MEMBERPFNGLALPHAFRAGMENTOP3ATIPROC)&RecordingTableDecorator::m_glAlphaFragmentOp3ATI_recording;
+if(this->m_ptr_glProgramEnvParameters4fvEXT)this->m_ptr_glProgramEnvParameters4fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERS4FVEXTPROC)&RecordingTableDecorator::m_glProgramEnvParameters4fvEXT_recording;
+if(this->m_ptr_glBlendFuncSeparateEXT)this->m_ptr_glBlendFuncSeparateEXT = (FunctionTable::MEMBERPFNGLBLENDFUNCSEPARATEEXTPROC)&RecordingTableDecorator::m_glBlendFuncSeparateEXT_recording;
+if(this->m_ptr_glConvolutionParameterivEXT)this->m_ptr_glConvolutionParameterivEXT = (FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERIVEXTPROC)&RecordingTableDecorator::m_glConvolutionParameterivEXT_recording;
+if(this->m_ptr_glPixelTexGenSGIX)this->m_ptr_glPixelTexGenSGIX = (FunctionTable::MEMBERPFNGLPIXELTEXGENSGIXPROC)&RecordingTableDecorator::m_glPixelTexGenSGIX_recording;
+if(this->m_ptr_glDeleteProgram)this->m_ptr_glDeleteProgram = (FunctionTable::MEMBERPFNGLDELETEPROGRAMPROC)&RecordingTableDecorator::m_glDeleteProgram_recording;
+if(this->m_ptr_glUniformMatrix4x3dv)this->m_ptr_glUniformMatrix4x3dv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX4X3DVPROC)&RecordingTableDecorator::m_glUniformMatrix4x3dv_recording;
+if(this->m_ptr_glGetVideoCaptureStreamivNV)this->m_ptr_glGetVideoCaptureStreamivNV = (FunctionTable::MEMBERPFNGLGETVIDEOCAPTURESTREAMIVNVPROC)&RecordingTableDecorator::m_glGetVideoCaptureStreamivNV_recording;
+if(this->m_ptr_glProgramUniform4uiEXT)this->m_ptr_glProgramUniform4uiEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UIEXTPROC)&RecordingTableDecorator::m_glProgramUniform4uiEXT_recording;
+if(this->m_ptr_glMakeImageHandleNonResidentARB)this->m_ptr_glMakeImageHandleNonResidentARB = (FunctionTable::MEMBERPFNGLMAKEIMAGEHANDLENONRESIDENTARBPROC)&RecordingTableDecorator::m_glMakeImageHandleNonResidentARB_recording;
+if(this->m_ptr_glSecondaryColor3dEXT)this->m_ptr_glSecondaryColor3dEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3DEXTPROC)&RecordingTableDecorator::m_glSecondaryColor3dEXT_recording;
+if(this->m_ptr_glDeleteQueries)this->m_ptr_glDeleteQueries = (FunctionTable::MEMBERPFNGLDELETEQUERIESPROC)&RecordingTableDecorator::m_glDeleteQueries_recording;
+if(this->m_ptr_glNormalP3uiv)this->m_ptr_glNormalP3uiv = (FunctionTable::MEMBERPFNGLNORMALP3UIVPROC)&RecordingTableDecorator::m_glNormalP3uiv_recording;
+if(this->m_ptr_glRasterPos2d)this->m_ptr_glRasterPos2d = (FunctionTable::MEMBERPFNGLRASTERPOS2DPROC)&RecordingTableDecorator::m_glRasterPos2d_recording;
+if(this->m_ptr_glInitNames)this->m_ptr_glInitNames = (FunctionTable::MEMBERPFNGLINITNAMESPROC)&RecordingTableDecorator::m_glInitNames_recording;
+if(this->m_ptr_glBinormal3fvEXT)this->m_ptr_glBinormal3fvEXT = (FunctionTable::MEMBERPFNGLBINORMAL3FVEXTPROC)&RecordingTableDecorator::m_glBinormal3fvEXT_recording;
+if(this->m_ptr_glColor3dv)this->m_ptr_glColor3dv = (FunctionTable::MEMBERPFNGLCOLOR3DVPROC)&RecordingTableDecorator::m_glColor3dv_recording;
+if(this->m_ptr_glVertexArrayVertexAttribDivisorEXT)this->m_ptr_glVertexArrayVertexAttribDivisorEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBDIVISOREXTPROC)&RecordingTableDecorator::m_glVertexArrayVertexAttribDivisorEXT_recording;
+if(this->m_ptr_glArrayElementEXT)this->m_ptr_glArrayElementEXT = (FunctionTable::MEMBERPFNGLARRAYELEMENTEXTPROC)&RecordingTableDecorator::m_glArrayElementEXT_recording;
+if(this->m_ptr_glProgramParameter4dNV)this->m_ptr_glProgramParameter4dNV = (FunctionTable::MEMBERPFNGLPROGRAMPARAMETER4DNVPROC)&RecordingTableDecorator::m_glProgramParameter4dNV_recording;
+if(this->m_ptr_glIndexxOES)this->m_ptr_glIndexxOES = (FunctionTable::MEMBERPFNGLINDEXXOESPROC)&RecordingTableDecorator::m_glIndexxOES_recording;
+if(this->m_ptr_glUniform3uivEXT)this->m_ptr_glUniform3uivEXT = (FunctionTable::MEMBERPFNGLUNIFORM3UIVEXTPROC)&RecordingTableDecorator::m_glUniform3uivEXT_recording;
+if(this->m_ptr_glPopGroupMarkerEXT)this->m_ptr_glPopGroupMarkerEXT = (FunctionTable::MEMBERPFNGLPOPGROUPMARKEREXTPROC)&RecordingTableDecorator::m_glPopGroupMarkerEXT_recording;
+if(this->m_ptr_glClearNamedFramebufferuiv)this->m_ptr_glClearNamedFramebufferuiv = (FunctionTable::MEMBERPFNGLCLEARNAMEDFRAMEBUFFERUIVPROC)&RecordingTableDecorator::m_glClearNamedFramebufferuiv_recording;
+if(this->m_ptr_glSetLocalConstantEXT)this->m_ptr_glSetLocalConstantEXT = (FunctionTable::MEMBERPFNGLSETLOCALCONSTANTEXTPROC)&RecordingTableDecorator::m_glSetLocalConstantEXT_recording;
+if(this->m_ptr_glProgramUniform1ui64NV)this->m_ptr_glProgramUniform1ui64NV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UI64NVPROC)&RecordingTableDecorator::m_glProgramUniform1ui64NV_recording;
+if(this->m_ptr_glColor4hvNV)this->m_ptr_glColor4hvNV = (FunctionTable::MEMBERPFNGLCOLOR4HVNVPROC)&RecordingTableDecorator::m_glColor4hvNV_recording;
+if(this->m_ptr_glGetVertexAttribfv)this->m_ptr_glGetVertexAttribfv = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBFVPROC)&RecordingTableDecorator::m_glGetVertexAttribfv_recording;
+if(this->m_ptr_glDispatchCompute)this->m_ptr_glDispatchCompute = (FunctionTable::MEMBERPFNGLDISPATCHCOMPUTEPROC)&RecordingTableDecorator::m_glDispatchCompute_recording;
+if(this->m_ptr_glGetActiveAttrib)this->m_ptr_glGetActiveAttrib = (FunctionTable::MEMBERPFNGLGETACTIVEATTRIBPROC)&RecordingTableDecorator::m_glGetActiveAttrib_recording;
+if(this->m_ptr_glFragmentColorMaterialSGIX)this->m_ptr_glFragmentColorMaterialSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTCOLORMATERIALSGIXPROC)&RecordingTableDecorator::m_glFragmentColorMaterialSGIX_recording;
+if(this->m_ptr_glTexSubImage2D)this->m_ptr_glTexSubImage2D = (FunctionTable::MEMBERPFNGLTEXSUBIMAGE2DPROC)&RecordingTableDecorator::m_glTexSubImage2D_recording;
+if(this->m_ptr_glGetnMinmaxARB)this->m_ptr_glGetnMinmaxARB = (FunctionTable::MEMBERPFNGLGETNMINMAXARBPROC)&RecordingTableDecorator::m_glGetnMinmaxARB_recording;
+if(this->m_ptr_glLogicOp)this->m_ptr_glLogicOp = (FunctionTable::MEMBERPFNGLLOGICOPPROC)&RecordingTableDecorator::m_glLogicOp_recording;
+if(this->m_ptr_glProgramUniformMatrix3x4fv)this->m_ptr_glProgramUniformMatrix3x4fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X4FVPROC)&RecordingTableDecorator::m_glProgramUniformMatrix3x4fv_recording;
+if(this->m_ptr_glWindowPos4iMESA)this->m_ptr_glWindowPos4iMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS4IMESAPROC)&RecordingTableDecorator::m_glWindowPos4iMESA_recording;
+if(this->m_ptr_glPixelTransferf)this->m_ptr_glPixelTransferf = (FunctionTable::MEMBERPFNGLPIXELTRANSFERFPROC)&RecordingTableDecorator::m_glPixelTransferf_recording;
+if(this->m_ptr_glGetTextureParameterIuiv)this->m_ptr_glGetTextureParameterIuiv = (FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERIUIVPROC)&RecordingTableDecorator::m_glGetTextureParameterIuiv_recording;
+if(this->m_ptr_glMultiTexCoord1xOES)this->m_ptr_glMultiTexCoord1xOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1XOESPROC)&RecordingTableDecorator::m_glMultiTexCoord1xOES_recording;
+if(this->m_ptr_glProgramUniformMatrix4dv)this->m_ptr_glProgramUniformMatrix4dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4DVPROC)&RecordingTableDecorator::m_glProgramUniformMatrix4dv_recording;
+if(this->m_ptr_glGetnUniformiv)this->m_ptr_glGetnUniformiv = (FunctionTable::MEMBERPFNGLGETNUNIFORMIVPROC)&RecordingTableDecorator::m_glGetnUniformiv_recording;
+if(this->m_ptr_glFramebufferTexture1DEXT)this->m_ptr_glFramebufferTexture1DEXT = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURE1DEXTPROC)&RecordingTableDecorator::m_glFramebufferTexture1DEXT_recording;
+if(this->m_ptr_glVertexPointervINTEL)this->m_ptr_glVertexPointervINTEL = (FunctionTable::MEMBERPFNGLVERTEXPOINTERVINTELPROC)&RecordingTableDecorator::m_glVertexPointervINTEL_recording;
+if(this->m_ptr_glTextureParameterIiv)this->m_ptr_glTextureParameterIiv = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIIVPROC)&RecordingTableDecorator::m_glTextureParameterIiv_recording;
+if(this->m_ptr_glGetSeparableFilterEXT)this->m_ptr_glGetSeparableFilterEXT = (FunctionTable::MEMBERPFNGLGETSEPARABLEFILTEREXTPROC)&RecordingTableDecorator::m_glGetSeparableFilterEXT_recording;
+if(this->m_ptr_glMultiTexCoord3iARB)this->m_ptr_glMultiTexCoord3iARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3IARBPROC)&RecordingTableDecorator::m_glMultiTexCoord3iARB_recording;
+if(this->m_ptr_glRasterPos4xvOES)this->m_ptr_glRasterPos4xvOES = (FunctionTable::MEMBERPFNGLRASTERPOS4XVOESPROC)&RecordingTableDecorator::m_glRasterPos4xvOES_recording;
+if(this->m_ptr_glDrawTransformFeedbackStream)this->m_ptr_glDrawTransformFeedbackStream = (FunctionTable::MEMBERPFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC)&RecordingTableDecorator::m_glDrawTransformFeedbackStream_recording;
+if(this->m_ptr_glVertex3hvNV)this->m_ptr_glVertex3hvNV = (FunctionTable::MEMBERPFNGLVERTEX3HVNVPROC)&RecordingTableDecorator::m_glVertex3hvNV_recording;
+if(this->m_ptr_glVertexArrayMultiTexCoordOffsetEXT)this->m_ptr_glVertexArrayMultiTexCoordOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYMULTITEXCOORDOFFSETEXTPROC)&RecordingTableDecorator::m_glVertexArrayMultiTexCoordOffsetEXT_recording;
+if(this->m_ptr_glProvokingVertex)this->m_ptr_glProvokingVertex = (FunctionTable::MEMBERPFNGLPROVOKINGVERTEXPROC)&RecordingTableDecorator::m_glProvokingVertex_recording;
+if(this->m_ptr_glAccumxOES)this->m_ptr_glAccumxOES = (FunctionTable::MEMBERPFNGLACCUMXOESPROC)&RecordingTableDecorator::m_glAccumxOES_recording;
+if(this->m_ptr_glShaderBinary)this->m_ptr_glShaderBinary = (FunctionTable::MEMBERPFNGLSHADERBINARYPROC)&RecordingTableDecorator::m_glShaderBinary_recording;
+if(this->m_ptr_glGetMultiTexGenivEXT)this->m_ptr_glGetMultiTexGenivEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXGENIVEXTPROC)&RecordingTableDecorator::m_glGetMultiTexGenivEXT_recording;
+if(this->m_ptr_glPointParameterxvOES)this->m_ptr_glPointParameterxvOES = (FunctionTable::MEMBERPFNGLPOINTPARAMETERXVOESPROC)&RecordingTableDecorator::m_glPointParameterxvOES_recording;
+if(this->m_ptr_glCreateStatesNV)this->m_ptr_glCreateStatesNV = (FunctionTable::MEMBERPFNGLCREATESTATESNVPROC)&RecordingTableDecorator::m_glCreateStatesNV_recording;
+if(this->m_ptr_glClearDepthdNV)this->m_ptr_glClearDepthdNV = (FunctionTable::MEMBERPFNGLCLEARDEPTHDNVPROC)&RecordingTableDecorator::m_glClearDepthdNV_recording;
+if(this->m_ptr_glClearColorIuiEXT)this->m_ptr_glClearColorIuiEXT = (FunctionTable::MEMBERPFNGLCLEARCOLORIUIEXTPROC)&RecordingTableDecorator::m_glClearColorIuiEXT_recording;
+if(this->m_ptr_glBindMultiTextureEXT)this->m_ptr_glBindMultiTextureEXT = (FunctionTable::MEMBERPFNGLBINDMULTITEXTUREEXTPROC)&RecordingTableDecorator::m_glBindMultiTextureEXT_recording;
+if(this->m_ptr_glTexGeniv)this->m_ptr_glTexGeniv = (FunctionTable::MEMBERPFNGLTEXGENIVPROC)&RecordingTableDecorator::m_glTexGeniv_recording;
+if(this->m_ptr_glDrawElements)this->m_ptr_glDrawElements = (FunctionTable::MEMBERPFNGLDRAWELEMENTSPROC)&RecordingTableDecorator::m_glDrawElements_recording;
+if(this->m_ptr_glProgramUniform4iv)this->m_ptr_glProgramUniform4iv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4IVPROC)&RecordingTableDecorator::m_glProgramUniform4iv_recording;
+if(this->m_ptr_glDisableVertexArrayEXT)this->m_ptr_glDisableVertexArrayEXT = (FunctionTable::MEMBERPFNGLDISABLEVERTEXARRAYEXTPROC)&RecordingTableDecorator::m_glDisableVertexArrayEXT_recording;
+if(this->m_ptr_glProgramUniform3ui64NV)this->m_ptr_glProgramUniform3ui64NV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UI64NVPROC)&RecordingTableDecorator::m_glProgramUniform3ui64NV_recording;
+if(this->m_ptr_glClientActiveTexture)this->m_ptr_glClientActiveTexture = (FunctionTable::MEMBERPFNGLCLIENTACTIVETEXTUREPROC)&RecordingTableDecorator::m_glClientActiveTexture_recording;
+if(this->m_ptr_glMultiTexParameterIivEXT)this->m_ptr_glMultiTexParameterIivEXT = (FunctionTable::MEMBERPFNGLMULTITEXPARAMETERIIVEXTPROC)&RecordingTableDecorator::m_glMultiTexParameterIivEXT_recording;
+if(this->m_ptr_glUniform1i64ARB)this->m_ptr_glUniform1i64ARB = (FunctionTable::MEMBERPFNGLUNIFORM1I64ARBPROC)&RecordingTableDecorator::m_glUniform1i64ARB_recording;
+if(this->m_ptr_glUniform1iv)this->m_ptr_glUniform1iv = (FunctionTable::MEMBERPFNGLUNIFORM1IVPROC)&RecordingTableDecorator::m_glUniform1iv_recording;
+if(this->m_ptr_glVertexAttribArrayObjectATI)this->m_ptr_glVertexAttribArrayObjectATI = (FunctionTable::MEMBERPFNGLVERTEXATTRIBARRAYOBJECTATIPROC)&RecordingTableDecorator::m_glVertexAttribArrayObjectATI_recording;
+if(this->m_ptr_glUniform2iARB)this->m_ptr_glUniform2iARB = (FunctionTable::MEMBERPFNGLUNIFORM2IARBPROC)&RecordingTableDecorator::m_glUniform2iARB_recording;
+if(this->m_ptr_glDrawArraysInstanced)this->m_ptr_glDrawArraysInstanced = (FunctionTable::MEMBERPFNGLDRAWARRAYSINSTANCEDPROC)&RecordingTableDecorator::m_glDrawArraysInstanced_recording;
+if(this->m_ptr_glVertexAttrib2sNV)this->m_ptr_glVertexAttrib2sNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2SNVPROC)&RecordingTableDecorator::m_glVertexAttrib2sNV_recording;
+if(this->m_ptr_glTexBufferEXT)this->m_ptr_glTexBufferEXT = (FunctionTable::MEMBERPFNGLTEXBUFFEREXTPROC)&RecordingTableDecorator::m_glTexBufferEXT_recording;
+if(this->m_ptr_glVertexStream2fATI)this->m_ptr_glVertexStream2fATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM2FATIPROC)&RecordingTableDecorator::m_glVertexStream2fATI_recording;
+if(this->m_ptr_glDebugMessageCallbackAMD)this->m_ptr_glDebugMessageCallbackAMD = (FunctionTable::MEMBERPFNGLDEBUGMESSAGECALLBACKAMDPROC)&RecordingTableDecorator::m_glDebugMessageCallbackAMD_recording;
+if(this->m_ptr_glSamplerParameteriv)this->m_ptr_glSamplerParameteriv = (FunctionTable::MEMBERPFNGLSAMPLERPARAMETERIVPROC)&RecordingTableDecorator::m_glSamplerParameteriv_recording;
+if(this->m_ptr_glVertexAttrib4uiv)this->m_ptr_glVertexAttrib4uiv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4UIVPROC)&RecordingTableDecorator::m_glVertexAttrib4uiv_recording;
+if(this->m_ptr_glEndQueryIndexed)this->m_ptr_glEndQueryIndexed = (FunctionTable::MEMBERPFNGLENDQUERYINDEXEDPROC)&RecordingTableDecorator::m_glEndQueryIndexed_recording;
+if(this->m_ptr_glNormalStream3sATI)this->m_ptr_glNormalStream3sATI = (FunctionTable::MEMBERPFNGLNORMALSTREAM3SATIPROC)&RecordingTableDecorator::m_glNormalStream3sATI_recording;
+if(this->m_ptr_glProgramParameteriARB)this->m_ptr_glProgramParameteriARB = (FunctionTable::MEMBERPFNGLPROGRAMPARAMETERIARBPROC)&RecordingTableDecorator::m_glProgramParameteriARB_recording;
+if(this->m_ptr_glTexEnvxOES)this->m_ptr_glTexEnvxOES = (FunctionTable::MEMBERPFNGLTEXENVXOESPROC)&RecordingTableDecorator::m_glTexEnvxOES_recording;
+if(this->m_ptr_glProgramUniform1iv)this->m_ptr_glProgramUniform1iv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1IVPROC)&RecordingTableDecorator::m_glProgramUniform1iv_recording;
+if(this->m_ptr_glDisableVertexAttribAPPLE)this->m_ptr_glDisableVertexAttribAPPLE = (FunctionTable::MEMBERPFNGLDISABLEVERTEXATTRIBAPPLEPROC)&RecordingTableDecorator::m_glDisableVertexAttribAPPLE_recording;
+if(this->m_ptr_glBindRenderbuffer)this->m_ptr_glBindRenderbuffer = (FunctionTable::MEMBERPFNGLBINDRENDERBUFFERPROC)&RecordingTableDecorator::m_glBindRenderbuffer_recording;
+if(this->m_ptr_glMultiTexSubImage3DEXT)this->m_ptr_glMultiTexSubImage3DEXT = (FunctionTable::MEMBERPFNGLMULTITEXSUBIMAGE3DEXTPROC)&RecordingTableDecorator::m_glMultiTexSubImage3DEXT_recording;
+if(this->m_ptr_glIsProgram)this->m_ptr_glIsProgram = (FunctionTable::MEMBERPFNGLISPROGRAMPROC)&RecordingTableDecorator::m_glIsProgram_recording;
+if(this->m_ptr_glMultiDrawElementsIndirectAMD)this->m_ptr_glMultiDrawElementsIndirectAMD = (FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSINDIRECTAMDPROC)&RecordingTableDecorator::m_glMultiDrawElementsIndirectAMD_recording;
+if(this->m_ptr_glGetProgramInfoLog)this->m_ptr_glGetProgramInfoLog = (FunctionTable::MEMBERPFNGLGETPROGRAMINFOLOGPROC)&RecordingTableDecorator::m_glGetProgramInfoLog_recording;
+if(this->m_ptr_glGetLocalConstantBooleanvEXT)this->m_ptr_glGetLocalConstantBooleanvEXT = (FunctionTable::MEMBERPFNGLGETLOCALCONSTANTBOOLEANVEXTPROC)&RecordingTableDecorator::m_glGetLocalConstantBooleanvEXT_recording;
+if(this->m_ptr_glPixelTransformParameteriEXT)this->m_ptr_glPixelTransformParameteriEXT = (FunctionTable::MEMBERPFNGLPIXELTRANSFORMPARAMETERIEXTPROC)&RecordingTableDecorator::m_glPixelTransformParameteriEXT_recording;
+if(this->m_ptr_glTexCoord4bOES)this->m_ptr_glTexCoord4bOES = (FunctionTable::MEMBERPFNGLTEXCOORD4BOESPROC)&RecordingTableDecorator::m_glTexCoord4bOES_recording;
+if(this->m_ptr_glVertexAttrib4fv)this->m_ptr_glVertexAttrib4fv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4FVPROC)&RecordingTableDecorator::m_glVertexAttrib4fv_recording;
+if(this->m_ptr_glProgramUniformMatrix2x3dv)this->m_ptr_glProgramUniformMatrix2x3dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X3DVPROC)&RecordingTableDecorator::m_glProgramUniformMatrix2x3dv_recording;
+if(this->m_ptr_glProgramEnvParametersI4uivNV)this->m_ptr_glProgramEnvParametersI4uivNV = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERSI4UIVNVPROC)&RecordingTableDecorator::m_glProgramEnvParametersI4uivNV_recording;
+if(this->m_ptr_glTexCoord3xOES)this->m_ptr_glTexCoord3xOES = (FunctionTable::MEMBERPFNGLTEXCOORD3XOESPROC)&RecordingTableDecorator::m_glTexCoord3xOES_recording;
+if(this->m_ptr_glLoadTransposeMatrixfARB)this->m_ptr_glLoadTransposeMatrixfARB = (FunctionTable::MEMBERPFNGLLOADTRANSPOSEMATRIXFARBPROC)&RecordingTableDecorator::m_glLoadTransposeMatrixfARB_recording;
+if(this->m_ptr_glImageTransformParameteriHP)this->m_ptr_glImageTransformParameteriHP = (FunctionTable::MEMBERPFNGLIMAGETRANSFORMPARAMETERIHPPROC)&RecordingTableDecorator::m_glImageTransformParameteriHP_recording;
+if(this->m_ptr_glMultiTexCoord4xOES)this->m_ptr_glMultiTexCoord4xOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4XOESPROC)&RecordingTableDecorator::m_glMultiTexCoord4xOES_recording;
+if(this->m_ptr_glVertexAttribs3fvNV)this->m_ptr_glVertexAttribs3fvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS3FVNVPROC)&RecordingTableDecorator::m_glVertexAttribs3fvNV_recording;
+if(this->m_ptr_glVertexAttrib2fv)this->m_ptr_glVertexAttrib2fv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2FVPROC)&RecordingTableDecorator::m_glVertexAttrib2fv_recording;
+if(this->m_ptr_glUniform3ui64NV)this->m_ptr_glUniform3ui64NV = (FunctionTable::MEMBERPFNGLUNIFORM3UI64NVPROC)&RecordingTableDecorator::m_glUniform3ui64NV_recording;
+if(this->m_ptr_glCombinerParameterfvNV)this->m_ptr_glCombinerParameterfvNV = (FunctionTable::MEMBERPFNGLCOMBINERPARAMETERFVNVPROC)&RecordingTableDecorator::m_glCombinerParameterfvNV_recording;
+if(this->m_ptr_glFragmentMaterialiSGIX)this->m_ptr_glFragmentMaterialiSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTMATERIALISGIXPROC)&RecordingTableDecorator::m_glFragmentMaterialiSGIX_recording;
+if(this->m_ptr_glGetBooleani_v)this->m_ptr_glGetBooleani_v = (FunctionTable::MEMBERPFNGLGETBOOLEANI_VPROC)&RecordingTableDecorator::m_glGetBooleani_v_recording;
+if(this->m_ptr_glGetProgramResourceIndex)this->m_ptr_glGetProgramResourceIndex = (FunctionTable::MEMBERPFNGLGETPROGRAMRESOURCEINDEXPROC)&RecordingTableDecorator::m_glGetProgramResourceIndex_recording;
+if(this->m_ptr_glBeginConditionalRenderNV)this->m_ptr_glBeginConditionalRenderNV = (FunctionTable::MEMBERPFNGLBEGINCONDITIONALRENDERNVPROC)&RecordingTableDecorator::m_glBeginConditionalRenderNV_recording;
+if(this->m_ptr_glDisableClientState)this->m_ptr_glDisableClientState = (FunctionTable::MEMBERPFNGLDISABLECLIENTSTATEPROC)&RecordingTableDecorator::m_glDisableClientState_recording;
+if(this->m_ptr_glPathFogGenNV)this->m_ptr_glPathFogGenNV = (FunctionTable::MEMBERPFNGLPATHFOGGENNVPROC)&RecordingTableDecorator::m_glPathFogGenNV_recording;
+if(this->m_ptr_glStencilThenCoverFillPathNV)this->m_ptr_glStencilThenCoverFillPathNV = (FunctionTable::MEMBERPFNGLSTENCILTHENCOVERFILLPATHNVPROC)&RecordingTableDecorator::m_glStencilThenCoverFillPathNV_recording;
+if(this->m_ptr_glVertexArrayIndexOffsetEXT)this->m_ptr_glVertexArrayIndexOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYINDEXOFFSETEXTPROC)&RecordingTableDecorator::m_glVertexArrayIndexOffsetEXT_recording;
+if(this->m_ptr_glProgramBufferParametersIuivNV)this->m_ptr_glProgramBufferParametersIuivNV = (FunctionTable::MEMBERPFNGLPROGRAMBUFFERPARAMETERSIUIVNVPROC)&RecordingTableDecorator::m_glProgramBufferParametersIuivNV_recording;
+if(this->m_ptr_glPixelTransformParameterivEXT)this->m_ptr_glPixelTransformParameterivEXT = (FunctionTable::MEMBERPFNGLPIXELTRANSFORMPARAMETERIVEXTPROC)&RecordingTableDecorator::m_glPixelTransformParameterivEXT_recording;
+if(this->m_ptr_glDisableClientStateiEXT)this->m_ptr_glDisableClientStateiEXT = (FunctionTable::MEMBERPFNGLDISABLECLIENTSTATEIEXTPROC)&RecordingTableDecorator::m_glDisableClientStateiEXT_recording;
+if(this->m_ptr_glTexBufferARB)this->m_ptr_glTexBufferARB = (FunctionTable::MEMBERPFNGLTEXBUFFERARBPROC)&RecordingTableDecorator::m_glTexBufferARB_recording;
+if(this->m_ptr_glGetLocalConstantIntegervEXT)this->m_ptr_glGetLocalConstantIntegervEXT = (FunctionTable::MEMBERPFNGLGETLOCALCONSTANTINTEGERVEXTPROC)&RecordingTableDecorator::m_glGetLocalConstantIntegervEXT_recording;
+if(this->m_ptr_glColor4uiv)this->m_ptr_glColor4uiv = (FunctionTable::MEMBERPFNGLCOLOR4UIVPROC)&RecordingTableDecorator::m_glColor4uiv_recording;
+if(this->m_ptr_glProgramUniform3i)this->m_ptr_glProgramUniform3i = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3IPROC)&RecordingTableDecorator::m_glProgramUniform3i_recording;
+if(this->m_ptr_glMultiDrawElementsIndirectBindlessCountNV)this->m_ptr_glMultiDrawElementsIndirectBindlessCountNV = (FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSINDIRECTBINDLESSCOUNTNVPROC)&RecordingTableDecorator::m_glMultiDrawElementsIndirectBindlessCountNV_recording;
+if(this->m_ptr_glGetBufferPointervARB)this->m_ptr_glGetBufferPointervARB = (FunctionTable::MEMBERPFNGLGETBUFFERPOINTERVARBPROC)&RecordingTableDecorator::m_glGetBufferPointervARB_recording;
+if(this->m_ptr_glMultiTexParameterIuivEXT)this->m_ptr_glMultiTexParameterIuivEXT = (FunctionTable::MEMBERPFNGLMULTITEXPARAMETERIUIVEXTPROC)&RecordingTableDecorator::m_glMultiTexParameterIuivEXT_recording;
+if(this->m_ptr_glEvalMesh2)this->m_ptr_glEvalMesh2 = (FunctionTable::MEMBERPFNGLEVALMESH2PROC)&RecordingTableDecorator::m_glEvalMesh2_recording;
+if(this->m_ptr_glEvalMesh1)this->m_ptr_glEvalMesh1 = (FunctionTable::MEMBERPFNGLEVALMESH1PROC)&RecordingTableDecorator::m_glEvalMesh1_recording;
+if(this->m_ptr_glProgramUniform3f)this->m_ptr_glProgramUniform3f = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3FPROC)&RecordingTableDecorator::m_glProgramUniform3f_recording;
+if(this->m_ptr_glStencilThenCoverFillPathInstancedNV)this->m_ptr_glStencilThenCoverFillPathInstancedNV = (FunctionTable::MEMBERPFNGLSTENCILTHENCOVERFILLPATHINSTANCEDNVPROC)&RecordingTableDecorator::m_glStencilThenCoverFillPathInstancedNV_recording;
+if(this->m_ptr_glProgramUniform3d)this->m_ptr_glProgramUniform3d = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3DPROC)&RecordingTableDecorator::m_glProgramUniform3d_recording;
+if(this->m_ptr_glMapVertexAttrib1dAPPLE)this->m_ptr_glMapVertexAttrib1dAPPLE = (FunctionTable::MEMBERPFNGLMAPVERTEXATTRIB1DAPPLEPROC)&RecordingTableDecorator::m_glMapVertexAttrib1dAPPLE_recording;
+if(this->m_ptr_glEvalCoord2fv)this->m_ptr_glEvalCoord2fv = (FunctionTable::MEMBERPFNGLEVALCOORD2FVPROC)&RecordingTableDecorator::m_glEvalCoord2fv_recording;
+if(this->m_ptr_glGetUniformivARB)this->m_ptr_glGetUniformivARB = (FunctionTable::MEMBERPFNGLGETUNIFORMIVARBPROC)&RecordingTableDecorator::m_glGetUniformivARB_recording;
+if(this->m_ptr_glLoadTransposeMatrixd)this->m_ptr_glLoadTransposeMatrixd = (FunctionTable::MEMBERPFNGLLOADTRANSPOSEMATRIXDPROC)&RecordingTableDecorator::m_glLoadTransposeMatrixd_recording;
+if(this->m_ptr_glLoadTransposeMatrixf)this->m_ptr_glLoadTransposeMatrixf = (FunctionTable::MEMBERPFNGLLOADTRANSPOSEMATRIXFPROC)&RecordingTableDecorator::m_glLoadTransposeMatrixf_recording;
+if(this->m_ptr_glGetPointervEXT)this->m_ptr_glGetPointervEXT = (FunctionTable::MEMBERPFNGLGETPOINTERVEXTPROC)&RecordingTableDecorator::m_glGetPointervEXT_recording;
+if(this->m_ptr_glEndConditionalRenderNV)this->m_ptr_glEndConditionalRenderNV = (FunctionTable::MEMBERPFNGLENDCONDITIONALRENDERNVPROC)&RecordingTableDecorator::m_glEndConditionalRenderNV_recording;
+if(this->m_ptr_glTexCoord2fNormal3fVertex3fSUN)this->m_ptr_glTexCoord2fNormal3fVertex3fSUN = (FunctionTable::MEMBERPFNGLTEXCOORD2FNORMAL3FVERTEX3FSUNPROC)&RecordingTableDecorator::m_glTexCoord2fNormal3fVertex3fSUN_recording;
+if(this->m_ptr_glUniform3i64vARB)this->m_ptr_glUniform3i64vARB = (FunctionTable::MEMBERPFNGLUNIFORM3I64VARBPROC)&RecordingTableDecorator::m_glUniform3i64vARB_recording;
+if(this->m_ptr_glProgramUniform2uiEXT)this->m_ptr_glProgramUniform2uiEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UIEXTPROC)&RecordingTableDecorator::m_glProgramUniform2uiEXT_recording;
+if(this->m_ptr_glVertexAttribI1ui)this->m_ptr_glVertexAttribI1ui = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI1UIPROC)&RecordingTableDecorator::m_glVertexAttribI1ui_recording;
+if(this->m_ptr_glProgramNamedParameter4dvNV)this->m_ptr_glProgramNamedParameter4dvNV = (FunctionTable::MEMBERPFNGLPROGRAMNAMEDPARAMETER4DVNVPROC)&RecordingTableDecorator::m_glProgramNamedParameter4dvNV_recording;
+if(this->m_ptr_glCompileCommandListNV)this->m_ptr_glCompileCommandListNV = (FunctionTable::MEMBERPFNGLCOMPILECOMMANDLISTNVPROC)&RecordingTableDecorator::m_glCompileCommandListNV_recording;
+if(this->m_ptr_glGetRenderbufferParameterivEXT)this->m_ptr_glGetRenderbufferParameterivEXT = (FunctionTable::MEMBERPFNGLGETRENDERBUFFERPARAMETERIVEXTPROC)&RecordingTableDecorator::m_glGetRenderbufferParameterivEXT_recording;
+if(this->m_ptr_glGetnPolygonStipple)this->m_ptr_glGetnPolygonStipple = (FunctionTable::MEMBERPFNGLGETNPOLYGONSTIPPLEPROC)&RecordingTableDecorator::m_glGetnPolygonStipple_recording;
+if(this->m_ptr_glIsBufferResidentNV)this->m_ptr_glIsBufferResidentNV = (FunctionTable::MEMBERPFNGLISBUFFERRESIDENTNVPROC)&RecordingTableDecorator::m_glIsBufferResidentNV_recording;
+if(this->m_ptr_glSecondaryColor3ubvEXT)this->m_ptr_glSecondaryColor3ubvEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UBVEXTPROC)&RecordingTableDecorator::m_glSecondaryColor3ubvEXT_recording;
+if(this->m_ptr_glGetNamedRenderbufferParameterivEXT)this->m_ptr_glGetNamedRenderbufferParameterivEXT = (FunctionTable::MEMBERPFNGLGETNAMEDRENDERBUFFERPARAMETERIVEXTPROC)&RecordingTableDecorator::m_glGetNamedRenderbufferParameterivEXT_recording;
+if(this->m_ptr_glNamedFramebufferSampleLocationsfvARB)this->m_ptr_glNamedFramebufferSampleLocationsfvARB = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERSAMPLELOCATIONSFVARBPROC)&RecordingTableDecorator::m_glNamedFramebufferSampleLocationsfvARB_recording;
+if(this->m_ptr_glMultiTexGendvEXT)this->m_ptr_glMultiTexGendvEXT = (FunctionTable::MEMBERPFNGLMULTITEXGENDVEXTPROC)&RecordingTableDecorator::m_glMultiTexGendvEXT_recording;
+if(this->m_ptr_glVertexArrayRangeNV)this->m_ptr_glVertexArrayRangeNV = (FunctionTable::MEMBERPFNGLVERTEXARRAYRANGENVPROC)&RecordingTableDecorator::m_glVertexArrayRangeNV_recording;
+if(this->m_ptr_glIsTextureHandleResidentNV)this->m_ptr_glIsTextureHandleResidentNV = (FunctionTable::MEMBERPFNGLISTEXTUREHANDLERESIDENTNVPROC)&RecordingTableDecorator::m_glIsTextureHandleResidentNV_recording;
+if(this->m_ptr_glGetProgramEnvParameterdvARB)this->m_ptr_glGetProgramEnvParameterdvARB = (FunctionTable::MEMBERPFNGLGETPROGRAMENVPARAMETERDVARBPROC)&RecordingTableDecorator::m_glGetProgramEnvParameterdvARB_recording;
+if(this->m_ptr_glIsNamedStringARB)this->m_ptr_glIsNamedStringARB = (FunctionTable::MEMBERPFNGLISNAMEDSTRINGARBPROC)&RecordingTableDecorator::m_glIsNamedStringARB_recording;
+if(this->m_ptr_glSecondaryColorFormatNV)this->m_ptr_glSecondaryColorFormatNV = (FunctionTable::MEMBERPFNGLSECONDARYCOLORFORMATNVPROC)&RecordingTableDecorator::m_glSecondaryColorFormatNV_recording;
+if(this->m_ptr_glVertexAttrib4ubvNV)this->m_ptr_glVertexAttrib4ubvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4UBVNVPROC)&RecordingTableDecorator::m_glVertexAttrib4ubvNV_recording;
+if(this->m_ptr_glTagSampleBufferSGIX)this->m_ptr_glTagSampleBufferSGIX = (FunctionTable::MEMBERPFNGLTAGSAMPLEBUFFERSGIXPROC)&RecordingTableDecorator::m_glTagSampleBufferSGIX_recording;
+if(this->m_ptr_glVDPAUUnregisterSurfaceNV)this->m_ptr_glVDPAUUnregisterSurfaceNV = (FunctionTable::MEMBERPFNGLVDPAUUNREGISTERSURFACENVPROC)&RecordingTableDecorator::m_glVDPAUUnregisterSurfaceNV_recording;
+if(this->m_ptr_glGetPerfQueryIdByNameINTEL)this->m_ptr_glGetPerfQueryIdByNameINTEL = (FunctionTable::MEMBERPFNGLGETPERFQUERYIDBYNAMEINTELPROC)&RecordingTableDecorator::m_glGetPerfQueryIdByNameINTEL_recording;
+if(this->m_ptr_glGetInteger64v)this->m_ptr_glGetInteger64v = (FunctionTable::MEMBERPFNGLGETINTEGER64VPROC)&RecordingTableDecorator::m_glGetInteger64v_recording;
+if(this->m_ptr_glClipPlane)this->m_ptr_glClipPlane = (FunctionTable::MEMBERPFNGLCLIPPLANEPROC)&RecordingTableDecorator::m_glClipPlane_recording;
+if(this->m_ptr_glColor4ubVertex3fSUN)this->m_ptr_glColor4ubVertex3fSUN = (FunctionTable::MEMBERPFNGLCOLOR4UBVERTEX3FSUNPROC)&RecordingTableDecorator::m_glColor4ubVertex3fSUN_recording;
+if(this->m_ptr_glIndexub)this->m_ptr_glIndexub = (FunctionTable::MEMBERPFNGLINDEXUBPROC)&RecordingTableDecorator::m_glIndexub_recording;
+if(this->m_ptr_glGetProgramEnvParameterfvARB)this->m_ptr_glGetProgramEnvParameterfvARB = (FunctionTable::MEMBERPFNGLGETPROGRAMENVPARAMETERFVARBPROC)&RecordingTableDecorator::m_glGetProgramEnvParameterfvARB_recording;
+if(this->m_ptr_glVertexAttrib4usvARB)this->m_ptr_glVertexAttrib4usvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4USVARBPROC)&RecordingTableDecorator::m_glVertexAttrib4usvARB_recording;
+if(this->m_ptr_glNamedFramebufferRenderbuffer)this->m_ptr_glNamedFramebufferRenderbuffer = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC)&RecordingTableDecorator::m_glNamedFramebufferRenderbuffer_recording;
+if(this->m_ptr_glProgramUniformMatrix3x4dv)this->m_ptr_glProgramUniformMatrix3x4dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X4DVPROC)&RecordingTableDecorator::m_glProgramUniformMatrix3x4dv_recording;
+if(this->m_ptr_glTestFenceAPPLE)this->m_ptr_glTestFenceAPPLE = (FunctionTable::MEMBERPFNGLTESTFENCEAPPLEPROC)&RecordingTableDecorator::m_glTestFenceAPPLE_recording;
+if(this->m_ptr_glVertexAttrib4Niv)this->m_ptr_glVertexAttrib4Niv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NIVPROC)&RecordingTableDecorator::m_glVertexAttrib4Niv_recording;
+if(this->m_ptr_glVertexAttribL2i64vNV)this->m_ptr_glVertexAttribL2i64vNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL2I64VNVPROC)&RecordingTableDecorator::m_glVertexAttribL2i64vNV_recording;
+if(this->m_ptr_glColorP4uiv)this->m_ptr_glColorP4uiv = (FunctionTable::MEMBERPFNGLCOLORP4UIVPROC)&RecordingTableDecorator::m_glColorP4uiv_recording;
+if(this->m_ptr_glUniformMatrix2x3fv)this->m_ptr_glUniformMatrix2x3fv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX2X3FVPROC)&RecordingTableDecorator::m_glUniformMatrix2x3fv_recording;
+if(this->m_ptr_glCallCommandListNV)this->m_ptr_glCallCommandListNV = (FunctionTable::MEMBERPFNGLCALLCOMMANDLISTNVPROC)&RecordingTableDecorator::m_glCallCommandListNV_recording;
+if(this->m_ptr_glClearBufferiv)this->m_ptr_glClearBufferiv = (FunctionTable::MEMBERPFNGLCLEARBUFFERIVPROC)&RecordingTableDecorator::m_glClearBufferiv_recording;
+if(this->m_ptr_glNamedStringARB)this->m_ptr_glNamedStringARB = (FunctionTable::MEMBERPFNGLNAMEDSTRINGARBPROC)&RecordingTableDecorator::m_glNamedStringARB_recording;
+if(this->m_ptr_glMatrixMult3x2fNV)this->m_ptr_glMatrixMult3x2fNV = (FunctionTable::MEMBERPFNGLMATRIXMULT3X2FNVPROC)&RecordingTableDecorator::m_glMatrixMult3x2fNV_recording;
+if(this->m_ptr_glGetNamedProgramStringEXT)this->m_ptr_glGetNamedProgramStringEXT = (FunctionTable::MEMBERPFNGLGETNAMEDPROGRAMSTRINGEXTPROC)&RecordingTableDecorator::m_glGetNamedProgramStringEXT_recording;
+if(this->m_ptr_glGetnHistogramARB)this->m_ptr_glGetnHistogramARB = (FunctionTable::MEMBERPFNGLGETNHISTOGRAMARBPROC)&RecordingTableDecorator::m_glGetnHistogramARB_recording;
+if(this->m_ptr_glGetTextureLevelParameterfv)this->m_ptr_glGetTextureLevelParameterfv = (FunctionTable::MEMBERPFNGLGETTEXTURELEVELPARAMETERFVPROC)&RecordingTableDecorator::m_glGetTextureLevelParameterfv_recording;
+if(this->m_ptr_glMultiTexCoord1fv)this->m_ptr_glMultiTexCoord1fv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1FVPROC)&RecordingTableDecorator::m_glMultiTexCoord1fv_recording;
+if(this->m_ptr_glBitmapxOES)this->m_ptr_glBitmapxOES = (FunctionTable::MEMBERPFNGLBITMAPXOESPROC)&RecordingTableDecorator::m_glBitmapxOES_recording;
+if(this->m_ptr_glGetSamplerParameterIuiv)this->m_ptr_glGetSamplerParameterIuiv = (FunctionTable::MEMBERPFNGLGETSAMPLERPARAMETERIUIVPROC)&RecordingTableDecorator::m_glGetSamplerParameterIuiv_recording;
+if(this->m_ptr_glTexCoordP3ui)this->m_ptr_glTexCoordP3ui = (FunctionTable::MEMBERPFNGLTEXCOORDP3UIPROC)&RecordingTableDecorator::m_glTexCoordP3ui_recording;
+if(this->m_ptr_glTextureSubImage1D)this->m_ptr_glTextureSubImage1D = (FunctionTable::MEMBERPFNGLTEXTURESUBIMAGE1DPROC)&RecordingTableDecorator::m_glTextureSubImage1D_recording;
+if(this->m_ptr_glVertexAttribLPointerEXT)this->m_ptr_glVertexAttribLPointerEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBLPOINTEREXTPROC)&RecordingTableDecorator::m_glVertexAttribLPointerEXT_recording;
+if(this->m_ptr_glFogCoordPointerEXT)this->m_ptr_glFogCoordPointerEXT = (FunctionTable::MEMBERPFNGLFOGCOORDPOINTEREXTPROC)&RecordingTableDecorator::m_glFogCoordPointerEXT_recording;
+if(this->m_ptr_glWindowPos3s)this->m_ptr_glWindowPos3s = (FunctionTable::MEMBERPFNGLWINDOWPOS3SPROC)&RecordingTableDecorator::m_glWindowPos3s_recording;
+if(this->m_ptr_glVertexAttribs2svNV)this->m_ptr_glVertexAttribs2svNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS2SVNVPROC)&RecordingTableDecorator::m_glVertexAttribs2svNV_recording;
+if(this->m_ptr_glTextureImage3DEXT)this->m_ptr_glTextureImage3DEXT = (FunctionTable::MEMBERPFNGLTEXTUREIMAGE3DEXTPROC)&RecordingTableDecorator::m_glTextureImage3DEXT_recording;
+if(this->m_ptr_glWindowPos3i)this->m_ptr_glWindowPos3i = (FunctionTable::MEMBERPFNGLWINDOWPOS3IPROC)&RecordingTableDecorator::m_glWindowPos3i_recording;
+if(this->m_ptr_glWindowPos3d)this->m_ptr_glWindowPos3d = (FunctionTable::MEMBERPFNGLWINDOWPOS3DPROC)&RecordingTableDecorator::m_glWindowPos3d_recording;
+if(this->m_ptr_glWindowPos3f)this->m_ptr_glWindowPos3f = (FunctionTable::MEMBERPFNGLWINDOWPOS3FPROC)&RecordingTableDecorator::m_glWindowPos3f_recording;
+if(this->m_ptr_glIsEnabledIndexedEXT)this->m_ptr_glIsEnabledIndexedEXT = (FunctionTable::MEMBERPFNGLISENABLEDINDEXEDEXTPROC)&RecordingTableDecorator::m_glIsEnabledIndexedEXT_recording;
+if(this->m_ptr_glGetNamedProgramivEXT)this->m_ptr_glGetNamedProgramivEXT = (FunctionTable::MEMBERPFNGLGETNAMEDPROGRAMIVEXTPROC)&RecordingTableDecorator::m_glGetNamedProgramivEXT_recording;
+if(this->m_ptr_glVertex3xvOES)this->m_ptr_glVertex3xvOES = (FunctionTable::MEMBERPFNGLVERTEX3XVOESPROC)&RecordingTableDecorator::m_glVertex3xvOES_recording;
+if(this->m_ptr_glColor3us)this->m_ptr_glColor3us = (FunctionTable::MEMBERPFNGLCOLOR3USPROC)&RecordingTableDecorator::m_glColor3us_recording;
+if(this->m_ptr_glBeginPerfMonitorAMD)this->m_ptr_glBeginPerfMonitorAMD = (FunctionTable::MEMBERPFNGLBEGINPERFMONITORAMDPROC)&RecordingTableDecorator::m_glBeginPerfMonitorAMD_recording;
+if(this->m_ptr_glProgramUniformMatrix4x3dv)this->m_ptr_glProgramUniformMatrix4x3dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X3DVPROC)&RecordingTableDecorator::m_glProgramUniformMatrix4x3dv_recording;
+if(this->m_ptr_glGetNamedProgramLocalParameterIuivEXT)this->m_ptr_glGetNamedProgramLocalParameterIuivEXT = (FunctionTable::MEMBERPFNGLGETNAMEDPROGRAMLOCALPARAMETERIUIVEXTPROC)&RecordingTableDecorator::m_glGetNamedProgramLocalParameterIuivEXT_recording;
+if(this->m_ptr_glReadnPixels)this->m_ptr_glReadnPixels = (FunctionTable::MEMBERPFNGLREADNPIXELSPROC)&RecordingTableDecorator::m_glReadnPixels_recording;
+if(this->m_ptr_glMultiTexCoord4f)this->m_ptr_glMultiTexCoord4f = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4FPROC)&RecordingTableDecorator::m_glMultiTexCoord4f_recording;
+if(this->m_ptr_glColor3ub)this->m_ptr_glColor3ub = (FunctionTable::MEMBERPFNGLCOLOR3UBPROC)&RecordingTableDecorator::m_glColor3ub_recording;
+if(this->m_ptr_glMultiTexCoord4d)this->m_ptr_glMultiTexCoord4d = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4DPROC)&RecordingTableDecorator::m_glMultiTexCoord4d_recording;
+if(this->m_ptr_glVertexAttribL3ui64NV)this->m_ptr_glVertexAttribL3ui64NV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL3UI64NVPROC)&RecordingTableDecorator::m_glVertexAttribL3ui64NV_recording;
+if(this->m_ptr_glColor3ui)this->m_ptr_glColor3ui = (FunctionTable::MEMBERPFNGLCOLOR3UIPROC)&RecordingTableDecorator::m_glColor3ui_recording;
+if(this->m_ptr_glProgramUniform4fvEXT)this->m_ptr_glProgramUniform4fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4FVEXTPROC)&RecordingTableDecorator::m_glProgramUniform4fvEXT_recording;
+if(this->m_ptr_glVertexAttrib2sARB)this->m_ptr_glVertexAttrib2sARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2SARBPROC)&RecordingTableDecorator::m_glVertexAttrib2sARB_recording;
+if(this->m_ptr_glMultiTexCoord4i)this->m_ptr_glMultiTexCoord4i = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4IPROC)&RecordingTableDecorator::m_glMultiTexCoord4i_recording;
+if(this->m_ptr_glCheckFramebufferStatusEXT)this->m_ptr_glCheckFramebufferStatusEXT = (FunctionTable::MEMBERPFNGLCHECKFRAMEBUFFERSTATUSEXTPROC)&RecordingTableDecorator::m_glCheckFramebufferStatusEXT_recording;
+if(this->m_ptr_glGetnMapivARB)this->m_ptr_glGetnMapivARB = (FunctionTable::MEMBERPFNGLGETNMAPIVARBPROC)&RecordingTableDecorator::m_glGetnMapivARB_recording;
+if(this->m_ptr_glMultiTexCoord1ivARB)this->m_ptr_glMultiTexCoord1ivARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1IVARBPROC)&RecordingTableDecorator::m_glMultiTexCoord1ivARB_recording;
+if(this->m_ptr_glDisableVertexAttribArrayARB)this->m_ptr_glDisableVertexAttribArrayARB = (FunctionTable::MEMBERPFNGLDISABLEVERTEXATTRIBARRAYARBPROC)&RecordingTableDecorator::m_glDisableVertexAttribArrayARB_recording;
+if(this->m_ptr_glGetPolygonStipple)this->m_ptr_glGetPolygonStipple = (FunctionTable::MEMBERPFNGLGETPOLYGONSTIPPLEPROC)&RecordingTableDecorator::m_glGetPolygonStipple_recording;
+if(this->m_ptr_glVertexAttribI4ui)this->m_ptr_glVertexAttribI4ui = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4UIPROC)&RecordingTableDecorator::m_glVertexAttribI4ui_recording;
+if(this->m_ptr_glGetPathDashArrayNV)this->m_ptr_glGetPathDashArrayNV = (FunctionTable::MEMBERPFNGLGETPATHDASHARRAYNVPROC)&RecordingTableDecorator::m_glGetPathDashArrayNV_recording;
+if(this->m_ptr_glMultiTexRenderbufferEXT)this->m_ptr_glMultiTexRenderbufferEXT = (FunctionTable::MEMBERPFNGLMULTITEXRENDERBUFFEREXTPROC)&RecordingTableDecorator::m_glMultiTexRenderbufferEXT_recording;
+if(this->m_ptr_glCopyTextureSubImage1D)this->m_ptr_glCopyTextureSubImage1D = (FunctionTable::MEMBERPFNGLCOPYTEXTURESUBIMAGE1DPROC)&RecordingTableDecorator::m_glCopyTextureSubImage1D_recording;
+if(this->m_ptr_glDeleteOcclusionQueriesNV)this->m_ptr_glDeleteOcclusionQueriesNV = (FunctionTable::MEMBERPFNGLDELETEOCCLUSIONQUERIESNVPROC)&RecordingTableDecorator::m_glDeleteOcclusionQueriesNV_recording;
+if(this->m_ptr_glVertex4hvNV)this->m_ptr_glVertex4hvNV = (FunctionTable::MEMBERPFNGLVERTEX4HVNVPROC)&RecordingTableDecorator::m_glVertex4hvNV_recording;
+if(this->m_ptr_glGetnTexImage)this->m_ptr_glGetnTexImage = (FunctionTable::MEMBERPFNGLGETNTEXIMAGEPROC)&RecordingTableDecorator::m_glGetnTexImage_recording;
+if(this->m_ptr_glProgramLocalParameter4dARB)this->m_ptr_glProgramLocalParameter4dARB = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETER4DARBPROC)&RecordingTableDecorator::m_glProgramLocalParameter4dARB_recording;
+if(this->m_ptr_glBlendEquation)this->m_ptr_glBlendEquation = (FunctionTable::MEMBERPFNGLBLENDEQUATIONPROC)&RecordingTableDecorator::m_glBlendEquation_recording;
+if(this->m_ptr_glUnlockArraysEXT)this->m_ptr_glUnlockArraysEXT = (FunctionTable::MEMBERPFNGLUNLOCKARRAYSEXTPROC)&RecordingTableDecorator::m_glUnlockArraysEXT_recording;
+if(this->m_ptr_glGetQueryObjectui64vEXT)this->m_ptr_glGetQueryObjectui64vEXT = (FunctionTable::MEMBERPFNGLGETQUERYOBJECTUI64VEXTPROC)&RecordingTableDecorator::m_glGetQueryObjectui64vEXT_recording;
+if(this->m_ptr_glVertexAttribI4uivEXT)this->m_ptr_glVertexAttribI4uivEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4UIVEXTPROC)&RecordingTableDecorator::m_glVertexAttribI4uivEXT_recording;
+if(this->m_ptr_glUniform1i64vNV)this->m_ptr_glUniform1i64vNV = (FunctionTable::MEMBERPFNGLUNIFORM1I64VNVPROC)&RecordingTableDecorator::m_glUniform1i64vNV_recording;
+if(this->m_ptr_glMultiTexCoord3dv)this->m_ptr_glMultiTexCoord3dv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3DVPROC)&RecordingTableDecorator::m_glMultiTexCoord3dv_recording;
+if(this->m_ptr_glColor4sv)this->m_ptr_glColor4sv = (FunctionTable::MEMBERPFNGLCOLOR4SVPROC)&RecordingTableDecorator::m_glColor4sv_recording;
+if(this->m_ptr_glVertexStream4ivATI)this->m_ptr_glVertexStream4ivATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM4IVATIPROC)&RecordingTableDecorator::m_glVertexStream4ivATI_recording;
+if(this->m_ptr_glPopClientAttrib)this->m_ptr_glPopClientAttrib = (FunctionTable::MEMBERPFNGLPOPCLIENTATTRIBPROC)&RecordingTableDecorator::m_glPopClientAttrib_recording;
+if(this->m_ptr_glClearBufferData)this->m_ptr_glClearBufferData = (FunctionTable::MEMBERPFNGLCLEARBUFFERDATAPROC)&RecordingTableDecorator::m_glClearBufferData_recording;
+if(this->m_ptr_glGetProgramivNV)this->m_ptr_glGetProgramivNV = (FunctionTable::MEMBERPFNGLGETPROGRAMIVNVPROC)&RecordingTableDecorator::m_glGetProgramivNV_recording;
+if(this->m_ptr_glBeginTransformFeedback)this->m_ptr_glBeginTransformFeedback = (FunctionTable::MEMBERPFNGLBEGINTRANSFORMFEEDBACKPROC)&RecordingTableDecorator::m_glBeginTransformFeedback_recording;
+if(this->m_ptr_glFinishObjectAPPLE)this->m_ptr_glFinishObjectAPPLE = (FunctionTable::MEMBERPFNGLFINISHOBJECTAPPLEPROC)&RecordingTableDecorator::m_glFinishObjectAPPLE_recording;
+if(this->m_ptr_glGetMinmaxParameterivEXT)this->m_ptr_glGetMinmaxParameterivEXT = (FunctionTable::MEMBERPFNGLGETMINMAXPARAMETERIVEXTPROC)&RecordingTableDecorator::m_glGetMinmaxParameterivEXT_recording;
+if(this->m_ptr_glColor3iv)this->m_ptr_glColor3iv = (FunctionTable::MEMBERPFNGLCOLOR3IVPROC)&RecordingTableDecorator::m_glColor3iv_recording;
+if(this->m_ptr_glVertexAttrib3sv)this->m_ptr_glVertexAttrib3sv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3SVPROC)&RecordingTableDecorator::m_glVertexAttrib3sv_recording;
+if(this->m_ptr_glCompressedTexImage1D)this->m_ptr_glCompressedTexImage1D = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXIMAGE1DPROC)&RecordingTableDecorator::m_glCompressedTexImage1D_recording;
+if(this->m_ptr_glDeleteTransformFeedbacks)this->m_ptr_glDeleteTransformFeedbacks = (FunctionTable::MEMBERPFNGLDELETETRANSFORMFEEDBACKSPROC)&RecordingTableDecorator::m_glDeleteTransformFeedbacks_recording;
+if(this->m_ptr_glGetVideoi64vNV)this->m_ptr_glGetVideoi64vNV = (FunctionTable::MEMBERPFNGLGETVIDEOI64VNVPROC)&RecordingTableDecorator::m_glGetVideoi64vNV_recording;
+if(this->m_ptr_glDrawRangeElementsBaseVertex)this->m_ptr_glDrawRangeElementsBaseVertex = (FunctionTable::MEMBERPFNGLDRAWRANGEELEMENTSBASEVERTEXPROC)&RecordingTableDecorator::m_glDrawRangeElementsBaseVertex_recording;
+if(this->m_ptr_glUniform4i64vARB)this->m_ptr_glUniform4i64vARB = (FunctionTable::MEMBERPFNGLUNIFORM4I64VARBPROC)&RecordingTableDecorator::m_glUniform4i64vARB_recording;
+if(this->m_ptr_glTextureStorage3DMultisampleEXT)this->m_ptr_glTextureStorage3DMultisampleEXT = (FunctionTable::MEMBERPFNGLTEXTURESTORAGE3DMULTISAMPLEEXTPROC)&RecordingTableDecorator::m_glTextureStorage3DMultisampleEXT_recording;
+if(this->m_ptr_glGetTexParameterfv)this->m_ptr_glGetTexParameterfv = (FunctionTable::MEMBERPFNGLGETTEXPARAMETERFVPROC)&RecordingTableDecorator::m_glGetTexParameterfv_recording;
+if(this->m_ptr_glProgramUniformui64vNV)this->m_ptr_glProgramUniformui64vNV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMUI64VNVPROC)&RecordingTableDecorator::m_glProgramUniformui64vNV_recording;
+if(this->m_ptr_glCompressedMultiTexImage1DEXT)this->m_ptr_glCompressedMultiTexImage1DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDMULTITEXIMAGE1DEXTPROC)&RecordingTableDecorator::m_glCompressedMultiTexImage1DEXT_recording;
+if(this->m_ptr_glProgramUniform2ivEXT)this->m_ptr_glProgramUniform2ivEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2IVEXTPROC)&RecordingTableDecorator::m_glProgramUniform2ivEXT_recording;
+if(this->m_ptr_glPushGroupMarkerEXT)this->m_ptr_glPushGroupMarkerEXT = (FunctionTable::MEMBERPFNGLPUSHGROUPMARKEREXTPROC)&RecordingTableDecorator::m_glPushGroupMarkerEXT_recording;
+if(this->m_ptr_glVertexAttrib1dv)this->m_ptr_glVertexAttrib1dv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1DVPROC)&RecordingTableDecorator::m_glVertexAttrib1dv_recording;
+if(this->m_ptr_glMatrixLoadIdentityEXT)this->m_ptr_glMatrixLoadIdentityEXT = (FunctionTable::MEMBERPFNGLMATRIXLOADIDENTITYEXTPROC)&RecordingTableDecorator::m_glMatrixLoadIdentityEXT_recording;
+if(this->m_ptr_glMultTransposeMatrixxOES)this->m_ptr_glMultTransposeMatrixxOES = (FunctionTable::MEMBERPFNGLMULTTRANSPOSEMATRIXXOESPROC)&RecordingTableDecorator::m_glMultTransposeMatrixxOES_recording;
+if(this->m_ptr_glGetPixelMapxv)this->m_ptr_glGetPixelMapxv = (FunctionTable::MEMBERPFNGLGETPIXELMAPXVPROC)&RecordingTableDecorator::m_glGetPixelMapxv_recording;
+if(this->m_ptr_glFramebufferSampleLocationsfvARB)this->m_ptr_glFramebufferSampleLocationsfvARB = (FunctionTable::MEMBERPFNGLFRAMEBUFFERSAMPLELOCATIONSFVARBPROC)&RecordingTableDecorator::m_glFramebufferSampleLocationsfvARB_recording;
+if(this->m_ptr_glGetLightiv)this->m_ptr_glGetLightiv = (FunctionTable::MEMBERPFNGLGETLIGHTIVPROC)&RecordingTableDecorator::m_glGetLightiv_recording;
+if(this->m_ptr_glBlendFuncSeparatei)this->m_ptr_glBlendFuncSeparatei = (FunctionTable::MEMBERPFNGLBLENDFUNCSEPARATEIPROC)&RecordingTableDecorator::m_glBlendFuncSeparatei_recording;
+if(this->m_ptr_glGetBooleanIndexedvEXT)this->m_ptr_glGetBooleanIndexedvEXT = (FunctionTable::MEMBERPFNGLGETBOOLEANINDEXEDVEXTPROC)&RecordingTableDecorator::m_glGetBooleanIndexedvEXT_recording;
+if(this->m_ptr_glGetProgramSubroutineParameteruivNV)this->m_ptr_glGetProgramSubroutineParameteruivNV = (FunctionTable::MEMBERPFNGLGETPROGRAMSUBROUTINEPARAMETERUIVNVPROC)&RecordingTableDecorator::m_glGetProgramSubroutineParameteruivNV_recording;
+if(this->m_ptr_glUniform2ui)this->m_ptr_glUniform2ui = (FunctionTable::MEMBERPFNGLUNIFORM2UIPROC)&RecordingTableDecorator::m_glUniform2ui_recording;
+if(this->m_ptr_glApplyFramebufferAttachmentCMAAINTEL)this->m_ptr_glApplyFramebufferAttachmentCMAAINTEL = (FunctionTable::MEMBERPFNGLAPPLYFRAMEBUFFERATTACHMENTCMAAINTELPROC)&RecordingTableDecorator::m_glApplyFramebufferAttachmentCMAAINTEL_recording;
+if(this->m_ptr_glWindowPos2fv)this->m_ptr_glWindowPos2fv = (FunctionTable::MEMBERPFNGLWINDOWPOS2FVPROC)&RecordingTableDecorator::m_glWindowPos2fv_recording;
+if(this->m_ptr_glDisablei)this->m_ptr_glDisablei = (FunctionTable::MEMBERPFNGLDISABLEIPROC)&RecordingTableDecorator::m_glDisablei_recording;
+if(this->m_ptr_glSelectPerfMonitorCountersAMD)this->m_ptr_glSelectPerfMonitorCountersAMD = (FunctionTable::MEMBERPFNGLSELECTPERFMONITORCOUNTERSAMDPROC)&RecordingTableDecorator::m_glSelectPerfMonitorCountersAMD_recording;
+if(this->m_ptr_glGetVertexAttribLi64vNV)this->m_ptr_glGetVertexAttribLi64vNV = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBLI64VNVPROC)&RecordingTableDecorator::m_glGetVertexAttribLi64vNV_recording;
+if(this->m_ptr_glBlendFuncSeparateiARB)this->m_ptr_glBlendFuncSeparateiARB = (FunctionTable::MEMBERPFNGLBLENDFUNCSEPARATEIARBPROC)&RecordingTableDecorator::m_glBlendFuncSeparateiARB_recording;
+if(this->m_ptr_glWeightuivARB)this->m_ptr_glWeightuivARB = (FunctionTable::MEMBERPFNGLWEIGHTUIVARBPROC)&RecordingTableDecorator::m_glWeightuivARB_recording;
+if(this->m_ptr_glWindowPos2iARB)this->m_ptr_glWindowPos2iARB = (FunctionTable::MEMBERPFNGLWINDOWPOS2IARBPROC)&RecordingTableDecorator::m_glWindowPos2iARB_recording;
+if(this->m_ptr_glGetProgramLocalParameterdvARB)this->m_ptr_glGetProgramLocalParameterdvARB = (FunctionTable::MEMBERPFNGLGETPROGRAMLOCALPARAMETERDVARBPROC)&RecordingTableDecorator::m_glGetProgramLocalParameterdvARB_recording;
+if(this->m_ptr_glGetUniformui64vARB)this->m_ptr_glGetUniformui64vARB = (FunctionTable::MEMBERPFNGLGETUNIFORMUI64VARBPROC)&RecordingTableDecorator::m_glGetUniformui64vARB_recording;
+if(this->m_ptr_glGetSynciv)this->m_ptr_glGetSynciv = (FunctionTable::MEMBERPFNGLGETSYNCIVPROC)&RecordingTableDecorator::m_glGetSynciv_recording;
+if(this->m_ptr_glMakeImageHandleResidentARB)this->m_ptr_glMakeImageHandleResidentARB = (FunctionTable::MEMBERPFNGLMAKEIMAGEHANDLERESIDENTARBPROC)&RecordingTableDecorator::m_glMakeImageHandleResidentARB_recording;
+if(this->m_ptr_glGetProgramNamedParameterfvNV)this->m_ptr_glGetProgramNamedParameterfvNV = (FunctionTable::MEMBERPFNGLGETPROGRAMNAMEDPARAMETERFVNVPROC)&RecordingTableDecorator::m_glGetProgramNamedParameterfvNV_recording;
+if(this->m_ptr_glTextureStorage3D)this->m_ptr_glTextureStorage3D = (FunctionTable::MEMBERPFNGLTEXTURESTORAGE3DPROC)&RecordingTableDecorator::m_glTextureStorage3D_recording;
+if(this->m_ptr_glVertexAttrib4svNV)this->m_ptr_glVertexAttrib4svNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4SVNVPROC)&RecordingTableDecorator::m_glVertexAttrib4svNV_recording;
+if(this->m_ptr_glProgramUniform2i)this->m_ptr_glProgramUniform2i = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2IPROC)&RecordingTableDecorator::m_glProgramUniform2i_recording;
+if(this->m_ptr_glListDrawCommandsStatesClientNV)this->m_ptr_glListDrawCommandsStatesClientNV = (FunctionTable::MEMBERPFNGLLISTDRAWCOMMANDSSTATESCLIENTNVPROC)&RecordingTableDecorator::m_glListDrawCommandsStatesClientNV_recording;
+if(this->m_ptr_glProgramLocalParametersI4uivNV)this->m_ptr_glProgramLocalParametersI4uivNV = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERSI4UIVNVPROC)&RecordingTableDecorator::m_glProgramLocalParametersI4uivNV_recording;
+if(this->m_ptr_glBeginTransformFeedbackNV)this->m_ptr_glBeginTransformFeedbackNV = (FunctionTable::MEMBERPFNGLBEGINTRANSFORMFEEDBACKNVPROC)&RecordingTableDecorator::m_glBeginTransformFeedbackNV_recording;
+if(this->m_ptr_glGetProgramBinary)this->m_ptr_glGetProgramBinary = (FunctionTable::MEMBERPFNGLGETPROGRAMBINARYPROC)&RecordingTableDecorator::m_glGetProgramBinary_recording;
+if(this->m_ptr_glBinormal3iEXT)this->m_ptr_glBinormal3iEXT = (FunctionTable::MEMBERPFNGLBINORMAL3IEXTPROC)&RecordingTableDecorator::m_glBinormal3iEXT_recording;
+if(this->m_ptr_glEvalPoint1)this->m_ptr_glEvalPoint1 = (FunctionTable::MEMBERPFNGLEVALPOINT1PROC)&RecordingTableDecorator::m_glEvalPoint1_recording;
+if(this->m_ptr_glEvalPoint2)this->m_ptr_glEvalPoint2 = (FunctionTable::MEMBERPFNGLEVALPOINT2PROC)&RecordingTableDecorator::m_glEvalPoint2_recording;
+if(this->m_ptr_glPauseTransformFeedback)this->m_ptr_glPauseTransformFeedback = (FunctionTable::MEMBERPFNGLPAUSETRANSFORMFEEDBACKPROC)&RecordingTableDecorator::m_glPauseTransformFeedback_recording;
+if(this->m_ptr_glWindowPos2sMESA)this->m_ptr_glWindowPos2sMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS2SMESAPROC)&RecordingTableDecorator::m_glWindowPos2sMESA_recording;
+if(this->m_ptr_glGlobalAlphaFactorbSUN)this->m_ptr_glGlobalAlphaFactorbSUN = (FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORBSUNPROC)&RecordingTableDecorator::m_glGlobalAlphaFactorbSUN_recording;
+if(this->m_ptr_glCreateTransformFeedbacks)this->m_ptr_glCreateTransformFeedbacks = (FunctionTable::MEMBERPFNGLCREATETRANSFORMFEEDBACKSPROC)&RecordingTableDecorator::m_glCreateTransformFeedbacks_recording;
+if(this->m_ptr_glTexturePageCommitmentEXT)this->m_ptr_glTexturePageCommitmentEXT = (FunctionTable::MEMBERPFNGLTEXTUREPAGECOMMITMENTEXTPROC)&RecordingTableDecorator::m_glTexturePageCommitmentEXT_recording;
+if(this->m_ptr_glTransformFeedbackVaryingsNV)this->m_ptr_glTransformFeedbackVaryingsNV = (FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKVARYINGSNVPROC)&RecordingTableDecorator::m_glTransformFeedbackVaryingsNV_recording;
+if(this->m_ptr_glTexSubImage1D)this->m_ptr_glTexSubImage1D = (FunctionTable::MEMBERPFNGLTEXSUBIMAGE1DPROC)&RecordingTableDecorator::m_glTexSubImage1D_recording;
+if(this->m_ptr_glConvolutionParameterfvEXT)this->m_ptr_glConvolutionParameterfvEXT = (FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERFVEXTPROC)&RecordingTableDecorator::m_glConvolutionParameterfvEXT_recording;
+if(this->m_ptr_glBlitFramebufferEXT)this->m_ptr_glBlitFramebufferEXT = (FunctionTable::MEMBERPFNGLBLITFRAMEBUFFEREXTPROC)&RecordingTableDecorator::m_glBlitFramebufferEXT_recording;
+if(this->m_ptr_glUniformMatrix4fvARB)this->m_ptr_glUniformMatrix4fvARB = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX4FVARBPROC)&RecordingTableDecorator::m_glUniformMatrix4fvARB_recording;
+if(this->m_ptr_glProgramEnvParameter4dvARB)this->m_ptr_glProgramEnvParameter4dvARB = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETER4DVARBPROC)&RecordingTableDecorator::m_glProgramEnvParameter4dvARB_recording;
+if(this->m_ptr_glSecondaryColor3hNV)this->m_ptr_glSecondaryColor3hNV = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3HNVPROC)&RecordingTableDecorator::m_glSecondaryColor3hNV_recording;
+if(this->m_ptr_glVertexAttribP3uiv)this->m_ptr_glVertexAttribP3uiv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBP3UIVPROC)&RecordingTableDecorator::m_glVertexAttribP3uiv_recording;
+if(this->m_ptr_glFogCoordFormatNV)this->m_ptr_glFogCoordFormatNV = (FunctionTable::MEMBERPFNGLFOGCOORDFORMATNVPROC)&RecordingTableDecorator::m_glFogCoordFormatNV_recording;
+if(this->m_ptr_glGetMultiTexLevelParameterivEXT)this->m_ptr_glGetMultiTexLevelParameterivEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXLEVELPARAMETERIVEXTPROC)&RecordingTableDecorator::m_glGetMultiTexLevelParameterivEXT_recording;
+if(this->m_ptr_glIsOcclusionQueryNV)this->m_ptr_glIsOcclusionQueryNV = (FunctionTable::MEMBERPFNGLISOCCLUSIONQUERYNVPROC)&RecordingTableDecorator::m_glIsOcclusionQueryNV_recording;
+if(this->m_ptr_glCompressedTexImage2DARB)this->m_ptr_glCompressedTexImage2DARB = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXIMAGE2DARBPROC)&RecordingTableDecorator::m_glCompressedTexImage2DARB_recording;
+if(this->m_ptr_glGetProgramEnvParameterIuivNV)this->m_ptr_glGetProgramEnvParameterIuivNV = (FunctionTable::MEMBERPFNGLGETPROGRAMENVPARAMETERIUIVNVPROC)&RecordingTableDecorator::m_glGetProgramEnvParameterIuivNV_recording;
+if(this->m_ptr_glVertexAttrib4sv)this->m_ptr_glVertexAttrib4sv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4SVPROC)&RecordingTableDecorator::m_glVertexAttrib4sv_recording;
+if(this->m_ptr_glVertexAttrib4fvARB)this->m_ptr_glVertexAttrib4fvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4FVARBPROC)&RecordingTableDecorator::m_glVertexAttrib4fvARB_recording;
+if(this->m_ptr_glLoadName)this->m_ptr_glLoadName = (FunctionTable::MEMBERPFNGLLOADNAMEPROC)&RecordingTableDecorator::m_glLoadName_recording;
+if(this->m_ptr_glBindVertexShaderEXT)this->m_ptr_glBindVertexShaderEXT = (FunctionTable::MEMBERPFNGLBINDVERTEXSHADEREXTPROC)&RecordingTableDecorator::m_glBindVertexShaderEXT_recording;
+if(this->m_ptr_glGetNamedProgramLocalParameterIivEXT)this->m_ptr_glGetNamedProgramLocalParameterIivEXT = (FunctionTable::MEMBERPFNGLGETNAMEDPROGRAMLOCALPARAMETERIIVEXTPROC)&RecordingTableDecorator::m_glGetNamedProgramLocalParameterIivEXT_recording;
+if(this->m_ptr_glProgramUniform3uiEXT)this->m_ptr_glProgramUniform3uiEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UIEXTPROC)&RecordingTableDecorator::m_glProgramUniform3uiEXT_recording;
+if(this->m_ptr_glProgramUniformMatrix4x2dvEXT)this->m_ptr_glProgramUniformMatrix4x2dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X2DVEXTPROC)&RecordingTableDecorator::m_glProgramUniformMatrix4x2dvEXT_recording;
+if(this->m_ptr_glTexCoord1hvNV)this->m_ptr_glTexCoord1hvNV = (FunctionTable::MEMBERPFNGLTEXCOORD1HVNVPROC)&RecordingTableDecorator::m_glTexCoord1hvNV_recording;
+if(this->m_ptr_glLoadMatrixd)this->m_ptr_glLoadMatrixd = (FunctionTable::MEMBERPFNGLLOADMATRIXDPROC)&RecordingTableDecorator::m_glLoadMatrixd_recording;
+if(this->m_ptr_glTexParameterfv)this->m_ptr_glTexParameterfv = (FunctionTable::MEMBERPFNGLTEXPARAMETERFVPROC)&RecordingTableDecorator::m_glTexParameterfv_recording;
+if(this->m_ptr_glVariantdvEXT)this->m_ptr_glVariantdvEXT = (FunctionTable::MEMBERPFNGLVARIANTDVEXTPROC)&RecordingTableDecorator::m_glVariantdvEXT_recording;
+if(this->m_ptr_glCullParameterfvEXT)this->m_ptr_glCullParameterfvEXT = (FunctionTable::MEMBERPFNGLCULLPARAMETERFVEXTPROC)&RecordingTableDecorator::m_glCullParameterfvEXT_recording;
+if(this->m_ptr_glUniform3dv)this->m_ptr_glUniform3dv = (FunctionTable::MEMBERPFNGLUNIFORM3DVPROC)&RecordingTableDecorator::m_glUniform3dv_recording;
+if(this->m_ptr_glProgramUniform3fv)this->m_ptr_glProgramUniform3fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3FVPROC)&RecordingTableDecorator::m_glProgramUniform3fv_recording;
+if(this->m_ptr_glIsBufferARB)this->m_ptr_glIsBufferARB = (FunctionTable::MEMBERPFNGLISBUFFERARBPROC)&RecordingTableDecorator::m_glIsBufferARB_recording;
+if(this->m_ptr_glMultiTexCoord1bOES)this->m_ptr_glMultiTexCoord1bOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1BOESPROC)&RecordingTableDecorator::m_glMultiTexCoord1bOES_recording;
+if(this->m_ptr_glFogCoordhNV)this->m_ptr_glFogCoordhNV = (FunctionTable::MEMBERPFNGLFOGCOORDHNVPROC)&RecordingTableDecorator::m_glFogCoordhNV_recording;
+if(this->m_ptr_glFramebufferSampleLocationsfvNV)this->m_ptr_glFramebufferSampleLocationsfvNV = (FunctionTable::MEMBERPFNGLFRAMEBUFFERSAMPLELOCATIONSFVNVPROC)&RecordingTableDecorator::m_glFramebufferSampleLocationsfvNV_recording;
+if(this->m_ptr_glGenSymbolsEXT)this->m_ptr_glGenSymbolsEXT = (FunctionTable::MEMBERPFNGLGENSYMBOLSEXTPROC)&RecordingTableDecorator::m_glGenSymbolsEXT_recording;
+if(this->m_ptr_glGetConvolutionFilter)this->m_ptr_glGetConvolutionFilter = (FunctionTable::MEMBERPFNGLGETCONVOLUTIONFILTERPROC)&RecordingTableDecorator::m_glGetConvolutionFilter_recording;
+if(this->m_ptr_glProgramUniform1fvEXT)this->m_ptr_glProgramUniform1fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1FVEXTPROC)&RecordingTableDecorator::m_glProgramUniform1fvEXT_recording;
+if(this->m_ptr_glGetNextPerfQueryIdINTEL)this->m_ptr_glGetNextPerfQueryIdINTEL = (FunctionTable::MEMBERPFNGLGETNEXTPERFQUERYIDINTELPROC)&RecordingTableDecorator::m_glGetNextPerfQueryIdINTEL_recording;
+if(this->m_ptr_glCompressedTexImage1DARB)this->m_ptr_glCompressedTexImage1DARB = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXIMAGE1DARBPROC)&RecordingTableDecorator::m_glCompressedTexImage1DARB_recording;
+if(this->m_ptr_glBindSamplers)this->m_ptr_glBindSamplers = (FunctionTable::MEMBERPFNGLBINDSAMPLERSPROC)&RecordingTableDecorator::m_glBindSamplers_recording;
+if(this->m_ptr_glGetProgramEnvParameterIivNV)this->m_ptr_glGetProgramEnvParameterIivNV = (FunctionTable::MEMBERPFNGLGETPROGRAMENVPARAMETERIIVNVPROC)&RecordingTableDecorator::m_glGetProgramEnvParameterIivNV_recording;
+if(this->m_ptr_glGetQueryObjectui64v)this->m_ptr_glGetQueryObjectui64v = (FunctionTable::MEMBERPFNGLGETQUERYOBJECTUI64VPROC)&RecordingTableDecorator::m_glGetQueryObjectui64v_recording;
+if(this->m_ptr_glVertexAttribL4ui64vNV)this->m_ptr_glVertexAttribL4ui64vNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL4UI64VNVPROC)&RecordingTableDecorator::m_glVertexAttribL4ui64vNV_recording;
+if(this->m_ptr_glGetVideoivNV)this->m_ptr_glGetVideoivNV = (FunctionTable::MEMBERPFNGLGETVIDEOIVNVPROC)&RecordingTableDecorator::m_glGetVideoivNV_recording;
+if(this->m_ptr_glGetTextureImage)this->m_ptr_glGetTextureImage = (FunctionTable::MEMBERPFNGLGETTEXTUREIMAGEPROC)&RecordingTableDecorator::m_glGetTextureImage_recording;
+if(this->m_ptr_glProgramUniform1fv)this->m_ptr_glProgramUniform1fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1FVPROC)&RecordingTableDecorator::m_glProgramUniform1fv_recording;
+if(this->m_ptr_glUniformMatrix4fv)this->m_ptr_glUniformMatrix4fv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX4FVPROC)&RecordingTableDecorator::m_glUniformMatrix4fv_recording;
+if(this->m_ptr_glColorMask)this->m_ptr_glColorMask = (FunctionTable::MEMBERPFNGLCOLORMASKPROC)&RecordingTableDecorator::m_glColorMask_recording;
+if(this->m_ptr_glBeginFragmentShaderATI)this->m_ptr_glBeginFragmentShaderATI = (FunctionTable::MEMBERPFNGLBEGINFRAGMENTSHADERATIPROC)&RecordingTableDecorator::m_glBeginFragmentShaderATI_recording;
+if(this->m_ptr_glMultiDrawArraysEXT)this->m_ptr_glMultiDrawArraysEXT = (FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSEXTPROC)&RecordingTableDecorator::m_glMultiDrawArraysEXT_recording;
+if(this->m_ptr_glGenNamesAMD)this->m_ptr_glGenNamesAMD = (FunctionTable::MEMBERPFNGLGENNAMESAMDPROC)&RecordingTableDecorator::m_glGenNamesAMD_recording;
+if(this->m_ptr_glPathParameteriNV)this->m_ptr_glPathParameteriNV = (FunctionTable::MEMBERPFNGLPATHPARAMETERINVPROC)&RecordingTableDecorator::m_glPathParameteriNV_recording;
+if(this->m_ptr_glCreateCommandListsNV)this->m_ptr_glCreateCommandListsNV = (FunctionTable::MEMBERPFNGLCREATECOMMANDLISTSNVPROC)&RecordingTableDecorator::m_glCreateCommandListsNV_recording;
+if(this->m_ptr_glDeleteProgramPipelines)this->m_ptr_glDeleteProgramPipelines = (FunctionTable::MEMBERPFNGLDELETEPROGRAMPIPELINESPROC)&RecordingTableDecorator::m_glDeleteProgramPipelines_recording;
+if(this->m_ptr_glCopyColorSubTableEXT)this->m_ptr_glCopyColorSubTableEXT = (FunctionTable::MEMBERPFNGLCOPYCOLORSUBTABLEEXTPROC)&RecordingTableDecorator::m_glCopyColorSubTableEXT_recording;
+if(this->m_ptr_glVariantsvEXT)this->m_ptr_glVariantsvEXT = (FunctionTable::MEMBERPFNGLVARIANTSVEXTPROC)&RecordingTableDecorator::m_glVariantsvEXT_recording;
+if(this->m_ptr_glGenProgramPipelines)this->m_ptr_glGenProgramPipelines = (FunctionTable::MEMBERPFNGLGENPROGRAMPIPELINESPROC)&RecordingTableDecorator::m_glGenProgramPipelines_recording;
+if(this->m_ptr_glVertexArrayEdgeFlagOffsetEXT)this->m_ptr_glVertexArrayEdgeFlagOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYEDGEFLAGOFFSETEXTPROC)&RecordingTableDecorator::m_glVertexArrayEdgeFlagOffsetEXT_recording;
+if(this->m_ptr_glWindowPos2s)this->m_ptr_glWindowPos2s = (FunctionTable::MEMBERPFNGLWINDOWPOS2SPROC)&RecordingTableDecorator::m_glWindowPos2s_recording;
+if(this->m_ptr_glSecondaryColor3iEXT)this->m_ptr_glSecondaryColor3iEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3IEXTPROC)&RecordingTableDecorator::m_glSecondaryColor3iEXT_recording;
+if(this->m_ptr_glWindowPos2i)this->m_ptr_glWindowPos2i = (FunctionTable::MEMBERPFNGLWINDOWPOS2IPROC)&RecordingTableDecorator::m_glWindowPos2i_recording;
+if(this->m_ptr_glWindowPos2f)this->m_ptr_glWindowPos2f = (FunctionTable::MEMBERPFNGLWINDOWPOS2FPROC)&RecordingTableDecorator::m_glWindowPos2f_recording;
+if(this->m_ptr_glWindowPos2d)this->m_ptr_glWindowPos2d = (FunctionTable::MEMBERPFNGLWINDOWPOS2DPROC)&RecordingTableDecorator::m_glWindowPos2d_recording;
+if(this->m_ptr_glUniform4uivEXT)this->m_ptr_glUniform4uivEXT = (FunctionTable::MEMBERPFNGLUNIFORM4UIVEXTPROC)&RecordingTableDecorator::m_glUniform4uivEXT_recording;
+if(this->m_ptr_glOrthoxOES)this->m_ptr_glOrthoxOES = (FunctionTable::MEMBERPFNGLORTHOXOESPROC)&RecordingTableDecorator::m_glOrthoxOES_recording;
+if(this->m_ptr_glUniformSubroutinesuiv)this->m_ptr_glUniformSubroutinesuiv = (FunctionTable::MEMBERPFNGLUNIFORMSUBROUTINESUIVPROC)&RecordingTableDecorator::m_glUniformSubroutinesuiv_recording;
+if(this->m_ptr_glRectdv)this->m_ptr_glRectdv = (FunctionTable::MEMBERPFNGLRECTDVPROC)&RecordingTableDecorator::m_glRectdv_recording;
+if(this->m_ptr_glProgramUniform1i64vNV)this->m_ptr_glProgramUniform1i64vNV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1I64VNVPROC)&RecordingTableDecorator::m_glProgramUniform1i64vNV_recording;
+if(this->m_ptr_glVertexAttribI4uiEXT)this->m_ptr_glVertexAttribI4uiEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4UIEXTPROC)&RecordingTableDecorator::m_glVertexAttribI4uiEXT_recording;
+if(this->m_ptr_glSecondaryColor3ubEXT)this->m_ptr_glSecondaryColor3ubEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UBEXTPROC)&RecordingTableDecorator::m_glSecondaryColor3ubEXT_recording;
+if(this->m_ptr_glCompressedMultiTexSubImage1DEXT)this->m_ptr_glCompressedMultiTexSubImage1DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDMULTITEXSUBIMAGE1DEXTPROC)&RecordingTableDecorator::m_glCompressedMultiTexSubImage1DEXT_recording;
+if(this->m_ptr_glMultiTexGendEXT)this->m_ptr_glMultiTexGendEXT = (FunctionTable::MEMBERPFNGLMULTITEXGENDEXTPROC)&RecordingTableDecorator::m_glMultiTexGendEXT_recording;
+if(this->m_ptr_glColorP3uiv)this->m_ptr_glColorP3uiv = (FunctionTable::MEMBERPFNGLCOLORP3UIVPROC)&RecordingTableDecorator::m_glColorP3uiv_recording;
+if(this->m_ptr_glFogCoordfv)this->m_ptr_glFogCoordfv = (FunctionTable::MEMBERPFNGLFOGCOORDFVPROC)&RecordingTableDecorator::m_glFogCoordfv_recording;
+if(this->m_ptr_glCompileShader)this->m_ptr_glCompileShader = (FunctionTable::MEMBERPFNGLCOMPILESHADERPROC)&RecordingTableDecorator::m_glCompileShader_recording;
+if(this->m_ptr_glTexCoord2hNV)this->m_ptr_glTexCoord2hNV = (FunctionTable::MEMBERPFNGLTEXCOORD2HNVPROC)&RecordingTableDecorator::m_glTexCoord2hNV_recording;
+if(this->m_ptr_glUniform1uivEXT)this->m_ptr_glUniform1uivEXT = (FunctionTable::MEMBERPFNGLUNIFORM1UIVEXTPROC)&RecordingTableDecorator::m_glUniform1uivEXT_recording;
+if(this->m_ptr_glMatrixLoadTransposedEXT)this->m_ptr_glMatrixLoadTransposedEXT = (FunctionTable::MEMBERPFNGLMATRIXLOADTRANSPOSEDEXTPROC)&RecordingTableDecorator::m_glMatrixLoadTransposedEXT_recording;
+if(this->m_ptr_glIndexfv)this->m_ptr_glIndexfv = (FunctionTable::MEMBERPFNGLINDEXFVPROC)&RecordingTableDecorator::m_glIndexfv_recording;
+if(this->m_ptr_glGetCompressedTextureImage)this->m_ptr_glGetCompressedTextureImage = (FunctionTable::MEMBERPFNGLGETCOMPRESSEDTEXTUREIMAGEPROC)&RecordingTableDecorator::m_glGetCompressedTextureImage_recording;
+if(this->m_ptr_glGetUniformuivEXT)this->m_ptr_glGetUniformuivEXT = (FunctionTable::MEMBERPFNGLGETUNIFORMUIVEXTPROC)&RecordingTableDecorator::m_glGetUniformuivEXT_recording;
+if(this->m_ptr_glGetnPixelMapfvARB)this->m_ptr_glGetnPixelMapfvARB = (FunctionTable::MEMBERPFNGLGETNPIXELMAPFVARBPROC)&RecordingTableDecorator::m_glGetnPixelMapfvARB_recording;
+if(this->m_ptr_glFramebufferTextureEXT)this->m_ptr_glFramebufferTextureEXT = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTUREEXTPROC)&RecordingTableDecorator::m_glFramebufferTextureEXT_recording;
+if(this->m_ptr_glVertexAttribIPointer)this->m_ptr_glVertexAttribIPointer = (FunctionTable::MEMBERPFNGLVERTEXATTRIBIPOINTERPROC)&RecordingTableDecorator::m_glVertexAttribIPointer_recording;
+if(this->m_ptr_glMultiTexCoordP3ui)this->m_ptr_glMultiTexCoordP3ui = (FunctionTable::MEMBERPFNGLMULTITEXCOORDP3UIPROC)&RecordingTableDecorator::m_glMultiTexCoordP3ui_recording;
+if(this->m_ptr_glEvaluateDepthValuesARB)this->m_ptr_glEvaluateDepthValuesARB = (FunctionTable::MEMBERPFNGLEVALUATEDEPTHVALUESARBPROC)&RecordingTableDecorator::m_glEvaluateDepthValuesARB_recording;
+if(this->m_ptr_glGetNamedBufferParameteriv)this->m_ptr_glGetNamedBufferParameteriv = (FunctionTable::MEMBERPFNGLGETNAMEDBUFFERPARAMETERIVPROC)&RecordingTableDecorator::m_glGetNamedBufferParameteriv_recording;
+if(this->m_ptr_glGetNamedProgramLocalParameterfvEXT)this->m_ptr_glGetNamedProgramLocalParameterfvEXT = (FunctionTable::MEMBERPFNGLGETNAMEDPROGRAMLOCALPARAMETERFVEXTPROC)&RecordingTableDecorator::m_glGetNamedProgramLocalParameterfvEXT_recording;
+if(this->m_ptr_glColor4fNormal3fVertex3fvSUN)this->m_ptr_glColor4fNormal3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLCOLOR4FNORMAL3FVERTEX3FVSUNPROC)&RecordingTableDecorator::m_glColor4fNormal3fVertex3fvSUN_recording;
+if(this->m_ptr_glSeparableFilter2DEXT)this->m_ptr_glSeparableFilter2DEXT = (FunctionTable::MEMBERPFNGLSEPARABLEFILTER2DEXTPROC)&RecordingTableDecorator::m_glSeparableFilter2DEXT_recording;
+if(this->m_ptr_glTexParameterxOES)this->m_ptr_glTexParameterxOES = (FunctionTable::MEMBERPFNGLTEXPARAMETERXOESPROC)&RecordingTableDecorator::m_glTexParameterxOES_recording;
+if(this->m_ptr_glClearAccumxOES)this->m_ptr_glClearAccumxOES = (FunctionTable::MEMBERPFNGLCLEARACCUMXOESPROC)&RecordingTableDecorator::m_glClearAccumxOES_recording;
+if(this->m_ptr_glInvalidateFramebuffer)this->m_ptr_glInvalidateFramebuffer = (FunctionTable::MEMBERPFNGLINVALIDATEFRAMEBUFFERPROC)&RecordingTableDecorator::m_glInvalidateFramebuffer_recording;
+if(this->m_ptr_glWeightubvARB)this->m_ptr_glWeightubvARB = (FunctionTable::MEMBERPFNGLWEIGHTUBVARBPROC)&RecordingTableDecorator::m_glWeightubvARB_recording;
+if(this->m_ptr_glVertexAttrib1d)this->m_ptr_glVertexAttrib1d = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1DPROC)&RecordingTableDecorator::m_glVertexAttrib1d_recording;
+if(this->m_ptr_glVertexAttrib1f)this->m_ptr_glVertexAttrib1f = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1FPROC)&RecordingTableDecorator::m_glVertexAttrib1f_recording;
+if(this->m_ptr_glVertex4fv)this->m_ptr_glVertex4fv = (FunctionTable::MEMBERPFNGLVERTEX4FVPROC)&RecordingTableDecorator::m_glVertex4fv_recording;
+if(this->m_ptr_glClearNamedFramebufferfi)this->m_ptr_glClearNamedFramebufferfi = (FunctionTable::MEMBERPFNGLCLEARNAMEDFRAMEBUFFERFIPROC)&RecordingTableDecorator::m_glClearNamedFramebufferfi_recording;
+if(this->m_ptr_glGetQueryBufferObjectuiv)this->m_ptr_glGetQueryBufferObjectuiv = (FunctionTable::MEMBERPFNGLGETQUERYBUFFEROBJECTUIVPROC)&RecordingTableDecorator::m_glGetQueryBufferObjectuiv_recording;
+if(this->m_ptr_glClearNamedFramebufferfv)this->m_ptr_glClearNamedFramebufferfv = (FunctionTable::MEMBERPFNGLCLEARNAMEDFRAMEBUFFERFVPROC)&RecordingTableDecorator::m_glClearNamedFramebufferfv_recording;
+if(this->m_ptr_glEndVertexShaderEXT)this->m_ptr_glEndVertexShaderEXT = (FunctionTable::MEMBERPFNGLENDVERTEXSHADEREXTPROC)&RecordingTableDecorator::m_glEndVertexShaderEXT_recording;
+if(this->m_ptr_glVertexAttrib1s)this->m_ptr_glVertexAttrib1s = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1SPROC)&RecordingTableDecorator::m_glVertexAttrib1s_recording;
+if(this->m_ptr_glMultiTexCoord4dvARB)this->m_ptr_glMultiTexCoord4dvARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4DVARBPROC)&RecordingTableDecorator::m_glMultiTexCoord4dvARB_recording;
+if(this->m_ptr_glMultiTexCoord1sv)this->m_ptr_glMultiTexCoord1sv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1SVPROC)&RecordingTableDecorator::m_glMultiTexCoord1sv_recording;
+if(this->m_ptr_glUniform1ui64vNV)this->m_ptr_glUniform1ui64vNV = (FunctionTable::MEMBERPFNGLUNIFORM1UI64VNVPROC)&RecordingTableDecorator::m_glUniform1ui64vNV_recording;
+if(this->m_ptr_glGetClipPlanefOES)this->m_ptr_glGetClipPlanefOES = (FunctionTable::MEMBERPFNGLGETCLIPPLANEFOESPROC)&RecordingTableDecorator::m_glGetClipPlanefOES_recording;
+if(this->m_ptr_glRasterPos2s)this->m_ptr_glRasterPos2s = (FunctionTable::MEMBERPFNGLRASTERPOS2SPROC)&RecordingTableDecorator::m_glRasterPos2s_recording;
+if(this->m_ptr_glWeightivARB)this->m_ptr_glWeightivARB = (FunctionTable::MEMBERPFNGLWEIGHTIVARBPROC)&RecordingTableDecorator::m_glWeightivARB_recording;
+if(this->m_ptr_glMultiTexCoord4hvNV)this->m_ptr_glMultiTexCoord4hvNV = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4HVNVPROC)&RecordingTableDecorator::m_glMultiTexCoord4hvNV_recording;
+if(this->m_ptr_glNormal3hNV)this->m_ptr_glNormal3hNV = (FunctionTable::MEMBERPFNGLNORMAL3HNVPROC)&RecordingTableDecorator::m_glNormal3hNV_recording;
+if(this->m_ptr_glGetSeparableFilter)this->m_ptr_glGetSeparableFilter = (FunctionTable::MEMBERPFNGLGETSEPARABLEFILTERPROC)&RecordingTableDecorator::m_glGetSeparableFilter_recording;
+if(this->m_ptr_glGetPathTexGenivNV)this->m_ptr_glGetPathTexGenivNV = (FunctionTable::MEMBERPFNGLGETPATHTEXGENIVNVPROC)&RecordingTableDecorator::m_glGetPathTexGenivNV_recording;
+if(this->m_ptr_glColor4bv)this->m_ptr_glColor4bv = (FunctionTable::MEMBERPFNGLCOLOR4BVPROC)&RecordingTableDecorator::m_glColor4bv_recording;
+if(this->m_ptr_glRasterPos2f)this->m_ptr_glRasterPos2f = (FunctionTable::MEMBERPFNGLRASTERPOS2FPROC)&RecordingTableDecorator::m_glRasterPos2f_recording;
+if(this->m_ptr_glNamedBufferPageCommitmentARB)this->m_ptr_glNamedBufferPageCommitmentARB = (FunctionTable::MEMBERPFNGLNAMEDBUFFERPAGECOMMITMENTARBPROC)&RecordingTableDecorator::m_glNamedBufferPageCommitmentARB_recording;
+if(this->m_ptr_glLoadIdentity)this->m_ptr_glLoadIdentity = (FunctionTable::MEMBERPFNGLLOADIDENTITYPROC)&RecordingTableDecorator::m_glLoadIdentity_recording;
+if(this->m_ptr_glRasterPos2i)this->m_ptr_glRasterPos2i = (FunctionTable::MEMBERPFNGLRASTERPOS2IPROC)&RecordingTableDecorator::m_glRasterPos2i_recording;
+if(this->m_ptr_glRasterPos4iv)this->m_ptr_glRasterPos4iv = (FunctionTable::MEMBERPFNGLRASTERPOS4IVPROC)&RecordingTableDecorator::m_glRasterPos4iv_recording;
+if(this->m_ptr_glMultiTexCoord2fvARB)this->m_ptr_glMultiTexCoord2fvARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2FVARBPROC)&RecordingTableDecorator::m_glMultiTexCoord2fvARB_recording;
+if(this->m_ptr_glUniformMatrix4x3fv)this->m_ptr_glUniformMatrix4x3fv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX4X3FVPROC)&RecordingTableDecorator::m_glUniformMatrix4x3fv_recording;
+if(this->m_ptr_glClearBufferfv)this->m_ptr_glClearBufferfv = (FunctionTable::MEMBERPFNGLCLEARBUFFERFVPROC)&RecordingTableDecorator::m_glClearBufferfv_recording;
+if(this->m_ptr_glMultiTexCoord4hNV)this->m_ptr_glMultiTexCoord4hNV = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4HNVPROC)&RecordingTableDecorator::m_glMultiTexCoord4hNV_recording;
+if(this->m_ptr_glTextureBarrier)this->m_ptr_glTextureBarrier = (FunctionTable::MEMBERPFNGLTEXTUREBARRIERPROC)&RecordingTableDecorator::m_glTextureBarrier_recording;
+if(this->m_ptr_glReplacementCodeuivSUN)this->m_ptr_glReplacementCodeuivSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUIVSUNPROC)&RecordingTableDecorator::m_glReplacementCodeuivSUN_recording;
+if(this->m_ptr_glDeleteAsyncMarkersSGIX)this->m_ptr_glDeleteAsyncMarkersSGIX = (FunctionTable::MEMBERPFNGLDELETEASYNCMARKERSSGIXPROC)&RecordingTableDecorator::m_glDeleteAsyncMarkersSGIX_recording;
+if(this->m_ptr_glTexCoord2bvOES)this->m_ptr_glTexCoord2bvOES = (FunctionTable::MEMBERPFNGLTEXCOORD2BVOESPROC)&RecordingTableDecorator::m_glTexCoord2bvOES_recording;
+if(this->m_ptr_glEvalCoord2xOES)this->m_ptr_glEvalCoord2xOES = (FunctionTable::MEMBERPFNGLEVALCOORD2XOESPROC)&RecordingTableDecorator::m_glEvalCoord2xOES_recording;
+if(this->m_ptr_glGetSharpenTexFuncSGIS)this->m_ptr_glGetSharpenTexFuncSGIS = (FunctionTable::MEMBERPFNGLGETSHARPENTEXFUNCSGISPROC)&RecordingTableDecorator::m_glGetSharpenTexFuncSGIS_recording;
+if(this->m_ptr_glProgramUniformHandleui64vNV)this->m_ptr_glProgramUniformHandleui64vNV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMHANDLEUI64VNVPROC)&RecordingTableDecorator::m_glProgramUniformHandleui64vNV_recording;
+if(this->m_ptr_glIglooInterfaceSGIX)this->m_ptr_glIglooInterfaceSGIX = (FunctionTable::MEMBERPFNGLIGLOOINTERFACESGIXPROC)&RecordingTableDecorator::m_glIglooInterfaceSGIX_recording;
+if(this->m_ptr_glWindowPos2dvARB)this->m_ptr_glWindowPos2dvARB = (FunctionTable::MEMBERPFNGLWINDOWPOS2DVARBPROC)&RecordingTableDecorator::m_glWindowPos2dvARB_recording;
+if(this->m_ptr_glClearBufferfi)this->m_ptr_glClearBufferfi = (FunctionTable::MEMBERPFNGLCLEARBUFFERFIPROC)&RecordingTableDecorator::m_glClearBufferfi_recording;
+if(this->m_ptr_glDrawArraysIndirect)this->m_ptr_glDrawArraysIndirect = (FunctionTable::MEMBERPFNGLDRAWARRAYSINDIRECTPROC)&RecordingTableDecorator::m_glDrawArraysIndirect_recording;
+if(this->m_ptr_glGenVertexArrays)this->m_ptr_glGenVertexArrays = (FunctionTable::MEMBERPFNGLGENVERTEXARRAYSPROC)&RecordingTableDecorator::m_glGenVertexArrays_recording;
+if(this->m_ptr_glGetTransformFeedbacki64_v)this->m_ptr_glGetTransformFeedbacki64_v = (FunctionTable::MEMBERPFNGLGETTRANSFORMFEEDBACKI64_VPROC)&RecordingTableDecorator::m_glGetTransformFeedbacki64_v_recording;
+if(this->m_ptr_glEnableVertexArrayAttrib)this->m_ptr_glEnableVertexArrayAttrib = (FunctionTable::MEMBERPFNGLENABLEVERTEXARRAYATTRIBPROC)&RecordingTableDecorator::m_glEnableVertexArrayAttrib_recording;
+if(this->m_ptr_glProgramUniformMatrix3x2dv)this->m_ptr_glProgramUniformMatrix3x2dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X2DVPROC)&RecordingTableDecorator::m_glProgramUniformMatrix3x2dv_recording;
+if(this->m_ptr_glVertexStream4fATI)this->m_ptr_glVertexStream4fATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM4FATIPROC)&RecordingTableDecorator::m_glVertexStream4fATI_recording;
+if(this->m_ptr_glVertexBindingDivisor)this->m_ptr_glVertexBindingDivisor = (FunctionTable::MEMBERPFNGLVERTEXBINDINGDIVISORPROC)&RecordingTableDecorator::m_glVertexBindingDivisor_recording;
+if(this->m_ptr_glGetSamplerParameterIiv)this->m_ptr_glGetSamplerParameterIiv = (FunctionTable::MEMBERPFNGLGETSAMPLERPARAMETERIIVPROC)&RecordingTableDecorator::m_glGetSamplerParameterIiv_recording;
+if(this->m_ptr_glGetCoverageModulationTableNV)this->m_ptr_glGetCoverageModulationTableNV = (FunctionTable::MEMBERPFNGLGETCOVERAGEMODULATIONTABLENVPROC)&RecordingTableDecorator::m_glGetCoverageModulationTableNV_recording;
+if(this->m_ptr_glDepthRangedNV)this->m_ptr_glDepthRangedNV = (FunctionTable::MEMBERPFNGLDEPTHRANGEDNVPROC)&RecordingTableDecorator::m_glDepthRangedNV_recording;
+if(this->m_ptr_glVertexAttrib3f)this->m_ptr_glVertexAttrib3f = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3FPROC)&RecordingTableDecorator::m_glVertexAttrib3f_recording;
+if(this->m_ptr_glMultiDrawRangeElementArrayAPPLE)this->m_ptr_glMultiDrawRangeElementArrayAPPLE = (FunctionTable::MEMBERPFNGLMULTIDRAWRANGEELEMENTARRAYAPPLEPROC)&RecordingTableDecorator::m_glMultiDrawRangeElementArrayAPPLE_recording;
+if(this->m_ptr_glVertexAttribFormatNV)this->m_ptr_glVertexAttribFormatNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBFORMATNVPROC)&RecordingTableDecorator::m_glVertexAttribFormatNV_recording;
+if(this->m_ptr_glGetQueryBufferObjecti64v)this->m_ptr_glGetQueryBufferObjecti64v = (FunctionTable::MEMBERPFNGLGETQUERYBUFFEROBJECTI64VPROC)&RecordingTableDecorator::m_glGetQueryBufferObjecti64v_recording;
+if(this->m_ptr_glGetVertexAttribdv)this->m_ptr_glGetVertexAttribdv = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBDVPROC)&RecordingTableDecorator::m_glGetVertexAttribdv_recording;
+if(this->m_ptr_glGetUniformi64vARB)this->m_ptr_glGetUniformi64vARB = (FunctionTable::MEMBERPFNGLGETUNIFORMI64VARBPROC)&RecordingTableDecorator::m_glGetUniformi64vARB_recording;
+if(this->m_ptr_glAreTexturesResidentEXT)this->m_ptr_glAreTexturesResidentEXT = (FunctionTable::MEMBERPFNGLARETEXTURESRESIDENTEXTPROC)&RecordingTableDecorator::m_glAreTexturesResidentEXT_recording;
+if(this->m_ptr_glGetHandleARB)this->m_ptr_glGetHandleARB = (FunctionTable::MEMBERPFNGLGETHANDLEARBPROC)&RecordingTableDecorator::m_glGetHandleARB_recording;
+if(this->m_ptr_glVideoCaptureStreamParameterdvNV)this->m_ptr_glVideoCaptureStreamParameterdvNV = (FunctionTable::MEMBERPFNGLVIDEOCAPTURESTREAMPARAMETERDVNVPROC)&RecordingTableDecorator::m_glVideoCaptureStreamParameterdvNV_recording;
+if(this->m_ptr_glMapParameterivNV)this->m_ptr_glMapParameterivNV = (FunctionTable::MEMBERPFNGLMAPPARAMETERIVNVPROC)&RecordingTableDecorator::m_glMapParameterivNV_recording;
+if(this->m_ptr_glIsVertexArray)this->m_ptr_glIsVertexArray = (FunctionTable::MEMBERPFNGLISVERTEXARRAYPROC)&RecordingTableDecorator::m_glIsVertexArray_recording;
+if(this->m_ptr_glSecondaryColor3sEXT)this->m_ptr_glSecondaryColor3sEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3SEXTPROC)&RecordingTableDecorator::m_glSecondaryColor3sEXT_recording;
+if(this->m_ptr_glGetTexParameterIivEXT)this->m_ptr_glGetTexParameterIivEXT = (FunctionTable::MEMBERPFNGLGETTEXPARAMETERIIVEXTPROC)&RecordingTableDecorator::m_glGetTexParameterIivEXT_recording;
+if(this->m_ptr_glFrameTerminatorGREMEDY)this->m_ptr_glFrameTerminatorGREMEDY = (FunctionTable::MEMBERPFNGLFRAMETERMINATORGREMEDYPROC)&RecordingTableDecorator::m_glFrameTerminatorGREMEDY_recording;
+if(this->m_ptr_glBlendBarrierKHR)this->m_ptr_glBlendBarrierKHR = (FunctionTable::MEMBERPFNGLBLENDBARRIERKHRPROC)&RecordingTableDecorator::m_glBlendBarrierKHR_recording;
+if(this->m_ptr_glVertexAttrib4NubARB)this->m_ptr_glVertexAttrib4NubARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUBARBPROC)&RecordingTableDecorator::m_glVertexAttrib4NubARB_recording;
+if(this->m_ptr_glPrimitiveRestartNV)this->m_ptr_glPrimitiveRestartNV = (FunctionTable::MEMBERPFNGLPRIMITIVERESTARTNVPROC)&RecordingTableDecorator::m_glPrimitiveRestartNV_recording;
+if(this->m_ptr_glVertexAttribL1ui64vARB)this->m_ptr_glVertexAttribL1ui64vARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL1UI64VARBPROC)&RecordingTableDecorator::m_glVertexAttribL1ui64vARB_recording;
+if(this->m_ptr_glVertexAttribI4ivEXT)this->m_ptr_glVertexAttribI4ivEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4IVEXTPROC)&RecordingTableDecorator::m_glVertexAttribI4ivEXT_recording;
+if(this->m_ptr_glVertexAttribs4svNV)this->m_ptr_glVertexAttribs4svNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS4SVNVPROC)&RecordingTableDecorator::m_glVertexAttribs4svNV_recording;
+if(this->m_ptr_glUniform1ui)this->m_ptr_glUniform1ui = (FunctionTable::MEMBERPFNGLUNIFORM1UIPROC)&RecordingTableDecorator::m_glUniform1ui_recording;
+if(this->m_ptr_glVertexAttrib2fvARB)this->m_ptr_glVertexAttrib2fvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2FVARBPROC)&RecordingTableDecorator::m_glVertexAttrib2fvARB_recording;
+if(this->m_ptr_glVertexAttribI4svEXT)this->m_ptr_glVertexAttribI4svEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4SVEXTPROC)&RecordingTableDecorator::m_glVertexAttribI4svEXT_recording;
+if(this->m_ptr_glTextureImage3DMultisampleCoverageNV)this->m_ptr_glTextureImage3DMultisampleCoverageNV = (FunctionTable::MEMBERPFNGLTEXTUREIMAGE3DMULTISAMPLECOVERAGENVPROC)&RecordingTableDecorator::m_glTextureImage3DMultisampleCoverageNV_recording;
+if(this->m_ptr_glMemoryBarrier)this->m_ptr_glMemoryBarrier = (FunctionTable::MEMBERPFNGLMEMORYBARRIERPROC)&RecordingTableDecorator::m_glMemoryBarrier_recording;
+if(this->m_ptr_glGetVariantArrayObjectfvATI)this->m_ptr_glGetVariantArrayObjectfvATI = (FunctionTable::MEMBERPFNGLGETVARIANTARRAYOBJECTFVATIPROC)&RecordingTableDecorator::m_glGetVariantArrayObjectfvATI_recording;
+if(this->m_ptr_glTexCoord4fColor4fNormal3fVertex4fvSUN)this->m_ptr_glTexCoord4fColor4fNormal3fVertex4fvSUN = (FunctionTable::MEMBERPFNGLTEXCOORD4FCOLOR4FNORMAL3FVERTEX4FVSUNPROC)&RecordingTableDecorator::m_glTexCoord4fColor4fNormal3fVertex4fvSUN_recording;
+if(this->m_ptr_glIsProgramARB)this->m_ptr_glIsProgramARB = (FunctionTable::MEMBERPFNGLISPROGRAMARBPROC)&RecordingTableDecorator::m_glIsProgramARB_recording;
+if(this->m_ptr_glBindImageTextureEXT)this->m_ptr_glBindImageTextureEXT = (FunctionTable::MEMBERPFNGLBINDIMAGETEXTUREEXTPROC)&RecordingTableDecorator::m_glBindImageTextureEXT_recording;
+if(this->m_ptr_glGetFragDataLocation)this->m_ptr_glGetFragDataLocation = (FunctionTable::MEMBERPFNGLGETFRAGDATALOCATIONPROC)&RecordingTableDecorator::m_glGetFragDataLocation_recording;
+if(this->m_ptr_glMultiTexCoord1svARB)this->m_ptr_glMultiTexCoord1svARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1SVARBPROC)&RecordingTableDecorator::m_glMultiTexCoord1svARB_recording;
+if(this->m_ptr_glGetMapxvOES)this->m_ptr_glGetMapxvOES = (FunctionTable::MEMBERPFNGLGETMAPXVOESPROC)&RecordingTableDecorator::m_glGetMapxvOES_recording;
+if(this->m_ptr_glTextureStorage2DMultisampleEXT)this->m_ptr_glTextureStorage2DMultisampleEXT = (FunctionTable::MEMBERPFNGLTEXTURESTORAGE2DMULTISAMPLEEXTPROC)&RecordingTableDecorator::m_glTextureStorage2DMultisampleEXT_recording;
+if(this->m_ptr_glGetMaterialfv)this->m_ptr_glGetMaterialfv = (FunctionTable::MEMBERPFNGLGETMATERIALFVPROC)&RecordingTableDecorator::m_glGetMaterialfv_recording;
+if(this->m_ptr_glVertexAttrib4NbvARB)this->m_ptr_glVertexAttrib4NbvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NBVARBPROC)&RecordingTableDecorator::m_glVertexAttrib4NbvARB_recording;
+if(this->m_ptr_glPixelMapuiv)this->m_ptr_glPixelMapuiv = (FunctionTable::MEMBERPFNGLPIXELMAPUIVPROC)&RecordingTableDecorator::m_glPixelMapuiv_recording;
+if(this->m_ptr_glColorPointerEXT)this->m_ptr_glColorPointerEXT = (FunctionTable::MEMBERPFNGLCOLORPOINTEREXTPROC)&RecordingTableDecorator::m_glColorPointerEXT_recording;
+if(this->m_ptr_glEnableClientStateiEXT)this->m_ptr_glEnableClientStateiEXT = (FunctionTable::MEMBERPFNGLENABLECLIENTSTATEIEXTPROC)&RecordingTableDecorator::m_glEnableClientStateiEXT_recording;
+if(this->m_ptr_glClearTexSubImage)this->m_ptr_glClearTexSubImage = (FunctionTable::MEMBERPFNGLCLEARTEXSUBIMAGEPROC)&RecordingTableDecorator::m_glClearTexSubImage_recording;
+if(this->m_ptr_glEvalCoord1xvOES)this->m_ptr_glEvalCoord1xvOES = (FunctionTable::MEMBERPFNGLEVALCOORD1XVOESPROC)&RecordingTableDecorator::m_glEvalCoord1xvOES_recording;
+if(this->m_ptr_glDetachObjectARB)this->m_ptr_glDetachObjectARB = (FunctionTable::MEMBERPFNGLDETACHOBJECTARBPROC)&RecordingTableDecorator::m_glDetachObjectARB_recording;
+if(this->m_ptr_glGetTextureParameterIiv)this->m_ptr_glGetTextureParameterIiv = (FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERIIVPROC)&RecordingTableDecorator::m_glGetTextureParameterIiv_recording;
+if(this->m_ptr_glVariantusvEXT)this->m_ptr_glVariantusvEXT = (FunctionTable::MEMBERPFNGLVARIANTUSVEXTPROC)&RecordingTableDecorator::m_glVariantusvEXT_recording;
+if(this->m_ptr_glCompressedTextureImage3DEXT)this->m_ptr_glCompressedTextureImage3DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTUREIMAGE3DEXTPROC)&RecordingTableDecorator::m_glCompressedTextureImage3DEXT_recording;
+if(this->m_ptr_glMultiTexCoord1dARB)this->m_ptr_glMultiTexCoord1dARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1DARBPROC)&RecordingTableDecorator::m_glMultiTexCoord1dARB_recording;
+if(this->m_ptr_glGetVertexArrayIntegeri_vEXT)this->m_ptr_glGetVertexArrayIntegeri_vEXT = (FunctionTable::MEMBERPFNGLGETVERTEXARRAYINTEGERI_VEXTPROC)&RecordingTableDecorator::m_glGetVertexArrayIntegeri_vEXT_recording;
+if(this->m_ptr_glVertexAttribI4ubv)this->m_ptr_glVertexAttribI4ubv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4UBVPROC)&RecordingTableDecorator::m_glVertexAttribI4ubv_recording;
+if(this->m_ptr_glPixelTexGenParameterfSGIS)this->m_ptr_glPixelTexGenParameterfSGIS = (FunctionTable::MEMBERPFNGLPIXELTEXGENPARAMETERFSGISPROC)&RecordingTableDecorator::m_glPixelTexGenParameterfSGIS_recording;
+if(this->m_ptr_glProgramUniformMatrix4x2dv)this->m_ptr_glProgramUniformMatrix4x2dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X2DVPROC)&RecordingTableDecorator::m_glProgramUniformMatrix4x2dv_recording;
+if(this->m_ptr_glUniform3fARB)this->m_ptr_glUniform3fARB = (FunctionTable::MEMBERPFNGLUNIFORM3FARBPROC)&RecordingTableDecorator::m_glUniform3fARB_recording;
+if(this->m_ptr_glIsShader)this->m_ptr_glIsShader = (FunctionTable::MEMBERPFNGLISSHADERPROC)&RecordingTableDecorator::m_glIsShader_recording;
+if(this->m_ptr_glConvolutionParameteriv)this->m_ptr_glConvolutionParameteriv = (FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERIVPROC)&RecordingTableDecorator::m_glConvolutionParameteriv_recording;
+if(this->m_ptr_glCopyMultiTexSubImage2DEXT)this->m_ptr_glCopyMultiTexSubImage2DEXT = (FunctionTable::MEMBERPFNGLCOPYMULTITEXSUBIMAGE2DEXTPROC)&RecordingTableDecorator::m_glCopyMultiTexSubImage2DEXT_recording;
+if(this->m_ptr_glEnableVertexAttribArrayARB)this->m_ptr_glEnableVertexAttribArrayARB = (FunctionTable::MEMBERPFNGLENABLEVERTEXATTRIBARRAYARBPROC)&RecordingTableDecorator::m_glEnableVertexAttribArrayARB_recording;
+if(this->m_ptr_glEnable)this->m_ptr_glEnable = (FunctionTable::MEMBERPFNGLENABLEPROC)&RecordingTableDecorator::m_glEnable_recording;
+if(this->m_ptr_glGetActiveUniformsiv)this->m_ptr_glGetActiveUniformsiv = (FunctionTable::MEMBERPFNGLGETACTIVEUNIFORMSIVPROC)&RecordingTableDecorator::m_glGetActiveUniformsiv_recording;
+if(this->m_ptr_glGetVertexAttribivARB)this->m_ptr_glGetVertexAttribivARB = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBIVARBPROC)&RecordingTableDecorator::m_glGetVertexAttribivARB_recording;
+if(this->m_ptr_glTexCoord4hvNV)this->m_ptr_glTexCoord4hvNV = (FunctionTable::MEMBERPFNGLTEXCOORD4HVNVPROC)&RecordingTableDecorator::m_glTexCoord4hvNV_recording;
+if(this->m_ptr_glUseProgramObjectARB)this->m_ptr_glUseProgramObjectARB = (FunctionTable::MEMBERPFNGLUSEPROGRAMOBJECTARBPROC)&RecordingTableDecorator::m_glUseProgramObjectARB_recording;
+if(this->m_ptr_glGetAttribLocation)this->m_ptr_glGetAttribLocation = (FunctionTable::MEMBERPFNGLGETATTRIBLOCATIONPROC)&RecordingTableDecorator::m_glGetAttribLocation_recording;
+if(this->m_ptr_glVertexAttrib4dv)this->m_ptr_glVertexAttrib4dv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4DVPROC)&RecordingTableDecorator::m_glVertexAttrib4dv_recording;
+if(this->m_ptr_glGetTextureParameteriv)this->m_ptr_glGetTextureParameteriv = (FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERIVPROC)&RecordingTableDecorator::m_glGetTextureParameteriv_recording;
+if(this->m_ptr_glPathSubCoordsNV)this->m_ptr_glPathSubCoordsNV = (FunctionTable::MEMBERPFNGLPATHSUBCOORDSNVPROC)&RecordingTableDecorator::m_glPathSubCoordsNV_recording;
+if(this->m_ptr_glMatrixIndexusvARB)this->m_ptr_glMatrixIndexusvARB = (FunctionTable::MEMBERPFNGLMATRIXINDEXUSVARBPROC)&RecordingTableDecorator::m_glMatrixIndexusvARB_recording;
+if(this->m_ptr_glGetVideouivNV)this->m_ptr_glGetVideouivNV = (FunctionTable::MEMBERPFNGLGETVIDEOUIVNVPROC)&RecordingTableDecorator::m_glGetVideouivNV_recording;
+if(this->m_ptr_glGetVideoCaptureivNV)this->m_ptr_glGetVideoCaptureivNV = (FunctionTable::MEMBERPFNGLGETVIDEOCAPTUREIVNVPROC)&RecordingTableDecorator::m_glGetVideoCaptureivNV_recording;
+if(this->m_ptr_glProgramUniform3ui)this->m_ptr_glProgramUniform3ui = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UIPROC)&RecordingTableDecorator::m_glProgramUniform3ui_recording;
+if(this->m_ptr_glVertexAttrib3svARB)this->m_ptr_glVertexAttrib3svARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3SVARBPROC)&RecordingTableDecorator::m_glVertexAttrib3svARB_recording;
+if(this->m_ptr_glGetNamedBufferParameterivEXT)this->m_ptr_glGetNamedBufferParameterivEXT = (FunctionTable::MEMBERPFNGLGETNAMEDBUFFERPARAMETERIVEXTPROC)&RecordingTableDecorator::m_glGetNamedBufferParameterivEXT_recording;
+if(this->m_ptr_glMatrixScaledEXT)this->m_ptr_glMatrixScaledEXT = (FunctionTable::MEMBERPFNGLMATRIXSCALEDEXTPROC)&RecordingTableDecorator::m_glMatrixScaledEXT_recording;
+if(this->m_ptr_glProgramUniformMatrix2x3fv)this->m_ptr_glProgramUniformMatrix2x3fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X3FVPROC)&RecordingTableDecorator::m_glProgramUniformMatrix2x3fv_recording;
+if(this->m_ptr_glGetFragmentLightivSGIX)this->m_ptr_glGetFragmentLightivSGIX = (FunctionTable::MEMBERPFNGLGETFRAGMENTLIGHTIVSGIXPROC)&RecordingTableDecorator::m_glGetFragmentLightivSGIX_recording;
+if(this->m_ptr_glWindowPos2svARB)this->m_ptr_glWindowPos2svARB = (FunctionTable::MEMBERPFNGLWINDOWPOS2SVARBPROC)&RecordingTableDecorator::m_glWindowPos2svARB_recording;
+if(this->m_ptr_glVertexAttrib2svNV)this->m_ptr_glVertexAttrib2svNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2SVNVPROC)&RecordingTableDecorator::m_glVertexAttrib2svNV_recording;
+if(this->m_ptr_glWindowPos2ivARB)this->m_ptr_glWindowPos2ivARB = (FunctionTable::MEMBERPFNGLWINDOWPOS2IVARBPROC)&RecordingTableDecorator::m_glWindowPos2ivARB_recording;
+if(this->m_ptr_glGetVertexAttribPointervNV)this->m_ptr_glGetVertexAttribPointervNV = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBPOINTERVNVPROC)&RecordingTableDecorator::m_glGetVertexAttribPointervNV_recording;
+if(this->m_ptr_glPushMatrix)this->m_ptr_glPushMatrix = (FunctionTable::MEMBERPFNGLPUSHMATRIXPROC)&RecordingTableDecorator::m_glPushMatrix_recording;
+if(this->m_ptr_glEdgeFlagPointerListIBM)this->m_ptr_glEdgeFlagPointerListIBM = (FunctionTable::MEMBERPFNGLEDGEFLAGPOINTERLISTIBMPROC)&RecordingTableDecorator::m_glEdgeFlagPointerListIBM_recording;
+if(this->m_ptr_glGenerateMipmapEXT)this->m_ptr_glGenerateMipmapEXT = (FunctionTable::MEMBERPFNGLGENERATEMIPMAPEXTPROC)&RecordingTableDecorator::m_glGenerateMipmapEXT_recording;
+if(this->m_ptr_glWindowPos3sv)this->m_ptr_glWindowPos3sv = (FunctionTable::MEMBERPFNGLWINDOWPOS3SVPROC)&RecordingTableDecorator::m_glWindowPos3sv_recording;
+if(this->m_ptr_glPathCoordsNV)this->m_ptr_glPathCoordsNV = (FunctionTable::MEMBERPFNGLPATHCOORDSNVPROC)&RecordingTableDecorator::m_glPathCoordsNV_recording;
+if(this->m_ptr_glProgramUniform1i)this->m_ptr_glProgramUniform1i = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1IPROC)&RecordingTableDecorator::m_glProgramUniform1i_recording;
+if(this->m_ptr_glProgramUniform1d)this->m_ptr_glProgramUniform1d = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1DPROC)&RecordingTableDecorator::m_glProgramUniform1d_recording;
+if(this->m_ptr_glProgramUniform1f)this->m_ptr_glProgramUniform1f = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1FPROC)&RecordingTableDecorator::m_glProgramUniform1f_recording;
+if(this->m_ptr_glProgramParameteriEXT)this->m_ptr_glProgramParameteriEXT = (FunctionTable::MEMBERPFNGLPROGRAMPARAMETERIEXTPROC)&RecordingTableDecorator::m_glProgramParameteriEXT_recording;
+if(this->m_ptr_glCompressedMultiTexImage2DEXT)this->m_ptr_glCompressedMultiTexImage2DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDMULTITEXIMAGE2DEXTPROC)&RecordingTableDecorator::m_glCompressedMultiTexImage2DEXT_recording;
+if(this->m_ptr_glProgramUniform3iv)this->m_ptr_glProgramUniform3iv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3IVPROC)&RecordingTableDecorator::m_glProgramUniform3iv_recording;
+if(this->m_ptr_glIndexiv)this->m_ptr_glIndexiv = (FunctionTable::MEMBERPFNGLINDEXIVPROC)&RecordingTableDecorator::m_glIndexiv_recording;
+if(this->m_ptr_glMultiTexCoord4xvOES)this->m_ptr_glMultiTexCoord4xvOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4XVOESPROC)&RecordingTableDecorator::m_glMultiTexCoord4xvOES_recording;
+if(this->m_ptr_glEGLImageTargetTexture2DOES)this->m_ptr_glEGLImageTargetTexture2DOES = (FunctionTable::MEMBERPFNGLEGLIMAGETARGETTEXTURE2DOESPROC)&RecordingTableDecorator::m_glEGLImageTargetTexture2DOES_recording;
+if(this->m_ptr_glPixelZoom)this->m_ptr_glPixelZoom = (FunctionTable::MEMBERPFNGLPIXELZOOMPROC)&RecordingTableDecorator::m_glPixelZoom_recording;
+if(this->m_ptr_glVertex3bvOES)this->m_ptr_glVertex3bvOES = (FunctionTable::MEMBERPFNGLVERTEX3BVOESPROC)&RecordingTableDecorator::m_glVertex3bvOES_recording;
+if(this->m_ptr_glFramebufferReadBufferEXT)this->m_ptr_glFramebufferReadBufferEXT = (FunctionTable::MEMBERPFNGLFRAMEBUFFERREADBUFFEREXTPROC)&RecordingTableDecorator::m_glFramebufferReadBufferEXT_recording;
+if(this->m_ptr_glExtractComponentEXT)this->m_ptr_glExtractComponentEXT = (FunctionTable::MEMBERPFNGLEXTRACTCOMPONENTEXTPROC)&RecordingTableDecorator::m_glExtractComponentEXT_recording;
+if(this->m_ptr_glCombinerParameterivNV)this->m_ptr_glCombinerParameterivNV = (FunctionTable::MEMBERPFNGLCOMBINERPARAMETERIVNVPROC)&RecordingTableDecorator::m_glCombinerParameterivNV_recording;
+if(this->m_ptr_glMinmax)this->m_ptr_glMinmax = (FunctionTable::MEMBERPFNGLMINMAXPROC)&RecordingTableDecorator::m_glMinmax_recording;
+if(this->m_ptr_glGenBuffersARB)this->m_ptr_glGenBuffersARB = (FunctionTable::MEMBERPFNGLGENBUFFERSARBPROC)&RecordingTableDecorator::m_glGenBuffersARB_recording;
+if(this->m_ptr_glColor3usv)this->m_ptr_glColor3usv = (FunctionTable::MEMBERPFNGLCOLOR3USVPROC)&RecordingTableDecorator::m_glColor3usv_recording;
+if(this->m_ptr_glBlendEquationi)this->m_ptr_glBlendEquationi = (FunctionTable::MEMBERPFNGLBLENDEQUATIONIPROC)&RecordingTableDecorator::m_glBlendEquationi_recording;
+if(this->m_ptr_glGetFogFuncSGIS)this->m_ptr_glGetFogFuncSGIS = (FunctionTable::MEMBERPFNGLGETFOGFUNCSGISPROC)&RecordingTableDecorator::m_glGetFogFuncSGIS_recording;
+if(this->m_ptr_glVertexAttrib4fvNV)this->m_ptr_glVertexAttrib4fvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4FVNVPROC)&RecordingTableDecorator::m_glVertexAttrib4fvNV_recording;
+if(this->m_ptr_glGetnMinmax)this->m_ptr_glGetnMinmax = (FunctionTable::MEMBERPFNGLGETNMINMAXPROC)&RecordingTableDecorator::m_glGetnMinmax_recording;
+if(this->m_ptr_glFragmentLightiSGIX)this->m_ptr_glFragmentLightiSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTLIGHTISGIXPROC)&RecordingTableDecorator::m_glFragmentLightiSGIX_recording;
+if(this->m_ptr_glMultiTexCoord1bvOES)this->m_ptr_glMultiTexCoord1bvOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1BVOESPROC)&RecordingTableDecorator::m_glMultiTexCoord1bvOES_recording;
+if(this->m_ptr_glSecondaryColorPointerEXT)this->m_ptr_glSecondaryColorPointerEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLORPOINTEREXTPROC)&RecordingTableDecorator::m_glSecondaryColorPointerEXT_recording;
+if(this->m_ptr_glMultiTexCoordP4uiv)this->m_ptr_glMultiTexCoordP4uiv = (FunctionTable::MEMBERPFNGLMULTITEXCOORDP4UIVPROC)&RecordingTableDecorator::m_glMultiTexCoordP4uiv_recording;
+if(this->m_ptr_glGetBufferSubDataARB)this->m_ptr_glGetBufferSubDataARB = (FunctionTable::MEMBERPFNGLGETBUFFERSUBDATAARBPROC)&RecordingTableDecorator::m_glGetBufferSubDataARB_recording;
+if(this->m_ptr_glGetPathParameterivNV)this->m_ptr_glGetPathParameterivNV = (FunctionTable::MEMBERPFNGLGETPATHPARAMETERIVNVPROC)&RecordingTableDecorator::m_glGetPathParameterivNV_recording;
+if(this->m_ptr_glFlushRasterSGIX)this->m_ptr_glFlushRasterSGIX = (FunctionTable::MEMBERPFNGLFLUSHRASTERSGIXPROC)&RecordingTableDecorator::m_glFlushRasterSGIX_recording;
+if(this->m_ptr_glElementPointerATI)this->m_ptr_glElementPointerATI = (FunctionTable::MEMBERPFNGLELEMENTPOINTERATIPROC)&RecordingTableDecorator::m_glElementPointerATI_recording;
+if(this->m_ptr_glGetAttachedObjectsARB)this->m_ptr_glGetAttachedObjectsARB = (FunctionTable::MEMBERPFNGLGETATTACHEDOBJECTSARBPROC)&RecordingTableDecorator::m_glGetAttachedObjectsARB_recording;
+if(this->m_ptr_glUniform4iv)this->m_ptr_glUniform4iv = (FunctionTable::MEMBERPFNGLUNIFORM4IVPROC)&RecordingTableDecorator::m_glUniform4iv_recording;
+if(this->m_ptr_glFogxOES)this->m_ptr_glFogxOES = (FunctionTable::MEMBERPFNGLFOGXOESPROC)&RecordingTableDecorator::m_glFogxOES_recording;
+if(this->m_ptr_glSharpenTexFuncSGIS)this->m_ptr_glSharpenTexFuncSGIS = (FunctionTable::MEMBERPFNGLSHARPENTEXFUNCSGISPROC)&RecordingTableDecorator::m_glSharpenTexFuncSGIS_recording;
+if(this->m_ptr_glClearDepthfOES)this->m_ptr_glClearDepthfOES = (FunctionTable::MEMBERPFNGLCLEARDEPTHFOESPROC)&RecordingTableDecorator::m_glClearDepthfOES_recording;
+if(this->m_ptr_glDeleteCommandListsNV)this->m_ptr_glDeleteCommandListsNV = (FunctionTable::MEMBERPFNGLDELETECOMMANDLISTSNVPROC)&RecordingTableDecorator::m_glDeleteCommandListsNV_recording;
+if(this->m_ptr_glVertex4hNV)this->m_ptr_glVertex4hNV = (FunctionTable::MEMBERPFNGLVERTEX4HNVPROC)&RecordingTableDecorator::m_glVertex4hNV_recording;
+if(this->m_ptr_glSecondaryColor3dvEXT)this->m_ptr_glSecondaryColor3dvEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3DVEXTPROC)&RecordingTableDecorator::m_glSecondaryColor3dvEXT_recording;
+if(this->m_ptr_glGenTextures)this->m_ptr_glGenTextures = (FunctionTable::MEMBERPFNGLGENTEXTURESPROC)&RecordingTableDecorator::m_glGenTextures_recording;
+if(this->m_ptr_glTextureStorage2DMultisample)this->m_ptr_glTextureStorage2DMultisample = (FunctionTable::MEMBERPFNGLTEXTURESTORAGE2DMULTISAMPLEPROC)&RecordingTableDecorator::m_glTextureStorage2DMultisample_recording;
+if(this->m_ptr_glUniform3ui64vNV)this->m_ptr_glUniform3ui64vNV = (FunctionTable::MEMBERPFNGLUNIFORM3UI64VNVPROC)&RecordingTableDecorator::m_glUniform3ui64vNV_recording;
+if(this->m_ptr_glBlendFuncSeparateIndexedAMD)this->m_ptr_glBlendFuncSeparateIndexedAMD = (FunctionTable::MEMBERPFNGLBLENDFUNCSEPARATEINDEXEDAMDPROC)&RecordingTableDecorator::m_glBlendFuncSeparateIndexedAMD_recording;
+if(this->m_ptr_glMakeBufferResidentNV)this->m_ptr_glMakeBufferResidentNV = (FunctionTable::MEMBERPFNGLMAKEBUFFERRESIDENTNVPROC)&RecordingTableDecorator::m_glMakeBufferResidentNV_recording;
+if(this->m_ptr_glShaderOp2EXT)this->m_ptr_glShaderOp2EXT = (FunctionTable::MEMBERPFNGLSHADEROP2EXTPROC)&RecordingTableDecorator::m_glShaderOp2EXT_recording;
+if(this->m_ptr_glGetVertexAttribivNV)this->m_ptr_glGetVertexAttribivNV = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBIVNVPROC)&RecordingTableDecorator::m_glGetVertexAttribivNV_recording;
+if(this->m_ptr_glTexParameterIivEXT)this->m_ptr_glTexParameterIivEXT = (FunctionTable::MEMBERPFNGLTEXPARAMETERIIVEXTPROC)&RecordingTableDecorator::m_glTexParameterIivEXT_recording;
+if(this->m_ptr_glGetPerfQueryDataINTEL)this->m_ptr_glGetPerfQueryDataINTEL = (FunctionTable::MEMBERPFNGLGETPERFQUERYDATAINTELPROC)&RecordingTableDecorator::m_glGetPerfQueryDataINTEL_recording;
+if(this->m_ptr_glVertexAttrib4dvARB)this->m_ptr_glVertexAttrib4dvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4DVARBPROC)&RecordingTableDecorator::m_glVertexAttrib4dvARB_recording;
+if(this->m_ptr_glTextureSubImage1DEXT)this->m_ptr_glTextureSubImage1DEXT = (FunctionTable::MEMBERPFNGLTEXTURESUBIMAGE1DEXTPROC)&RecordingTableDecorator::m_glTextureSubImage1DEXT_recording;
+if(this->m_ptr_glGetActiveUniformBlockName)this->m_ptr_glGetActiveUniformBlockName = (FunctionTable::MEMBERPFNGLGETACTIVEUNIFORMBLOCKNAMEPROC)&RecordingTableDecorator::m_glGetActiveUniformBlockName_recording;
+if(this->m_ptr_glVertexAttrib2dvARB)this->m_ptr_glVertexAttrib2dvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2DVARBPROC)&RecordingTableDecorator::m_glVertexAttrib2dvARB_recording;
+if(this->m_ptr_glVertexAttribPointer)this->m_ptr_glVertexAttribPointer = (FunctionTable::MEMBERPFNGLVERTEXATTRIBPOINTERPROC)&RecordingTableDecorator::m_glVertexAttribPointer_recording;
+if(this->m_ptr_glDepthBoundsdNV)this->m_ptr_glDepthBoundsdNV = (FunctionTable::MEMBERPFNGLDEPTHBOUNDSDNVPROC)&RecordingTableDecorator::m_glDepthBoundsdNV_recording;
+if(this->m_ptr_glDeleteTexturesEXT)this->m_ptr_glDeleteTexturesEXT = (FunctionTable::MEMBERPFNGLDELETETEXTURESEXTPROC)&RecordingTableDecorator::m_glDeleteTexturesEXT_recording;
+if(this->m_ptr_glDrawBuffersATI)this->m_ptr_glDrawBuffersATI = (FunctionTable::MEMBERPFNGLDRAWBUFFERSATIPROC)&RecordingTableDecorator::m_glDrawBuffersATI_recording;
+if(this->m_ptr_glLightModelxvOES)this->m_ptr_glLightModelxvOES = (FunctionTable::MEMBERPFNGLLIGHTMODELXVOESPROC)&RecordingTableDecorator::m_glLightModelxvOES_recording;
+if(this->m_ptr_glApplyTextureEXT)this->m_ptr_glApplyTextureEXT = (FunctionTable::MEMBERPFNGLAPPLYTEXTUREEXTPROC)&RecordingTableDecorator::m_glApplyTextureEXT_recording;
+if(this->m_ptr_glGetImageHandleNV)this->m_ptr_glGetImageHandleNV = (FunctionTable::MEMBERPFNGLGETIMAGEHANDLENVPROC)&RecordingTableDecorator::m_glGetImageHandleNV_recording;
+if(this->m_ptr_glGetMinmax)this->m_ptr_glGetMinmax = (FunctionTable::MEMBERPFNGLGETMINMAXPROC)&RecordingTableDecorator::m_glGetMinmax_recording;
+if(this->m_ptr_glGetFixedvOES)this->m_ptr_glGetFixedvOES = (FunctionTable::MEMBERPFNGLGETFIXEDVOESPROC)&RecordingTableDecorator::m_glGetFixedvOES_recording;
+if(this->m_ptr_glSamplePatternEXT)this->m_ptr_glSamplePatternEXT = (FunctionTable::MEMBERPFNGLSAMPLEPATTERNEXTPROC)&RecordingTableDecorator::m_glSamplePatternEXT_recording;
+if(this->m_ptr_glUniform1f)this->m_ptr_glUniform1f = (FunctionTable::MEMBERPFNGLUNIFORM1FPROC)&RecordingTableDecorator::m_glUniform1f_recording;
+if(this->m_ptr_glColor4fNormal3fVertex3fSUN)this->m_ptr_glColor4fNormal3fVertex3fSUN = (FunctionTable::MEMBERPFNGLCOLOR4FNORMAL3FVERTEX3FSUNPROC)&RecordingTableDecorator::m_glColor4fNormal3fVertex3fSUN_recording;
+if(this->m_ptr_glFogCoorddvEXT)this->m_ptr_glFogCoorddvEXT = (FunctionTable::MEMBERPFNGLFOGCOORDDVEXTPROC)&RecordingTableDecorator::m_glFogCoorddvEXT_recording;
+if(this->m_ptr_glCopyTextureImage1DEXT)this->m_ptr_glCopyTextureImage1DEXT = (FunctionTable::MEMBERPFNGLCOPYTEXTUREIMAGE1DEXTPROC)&RecordingTableDecorator::m_glCopyTextureImage1DEXT_recording;
+if(this->m_ptr_glFlushMappedBufferRangeAPPLE)this->m_ptr_glFlushMappedBufferRangeAPPLE = (FunctionTable::MEMBERPFNGLFLUSHMAPPEDBUFFERRANGEAPPLEPROC)&RecordingTableDecorator::m_glFlushMappedBufferRangeAPPLE_recording;
+if(this->m_ptr_glVertex3sv)this->m_ptr_glVertex3sv = (FunctionTable::MEMBERPFNGLVERTEX3SVPROC)&RecordingTableDecorator::m_glVertex3sv_recording;
+if(this->m_ptr_glFlushStaticDataIBM)this->m_ptr_glFlushStaticDataIBM = (FunctionTable::MEMBERPFNGLFLUSHSTATICDATAIBMPROC)&RecordingTableDecorator::m_glFlushStaticDataIBM_recording;
+if(this->m_ptr_glProgramUniform4ui64NV)this->m_ptr_glProgramUniform4ui64NV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UI64NVPROC)&RecordingTableDecorator::m_glProgramUniform4ui64NV_recording;
+if(this->m_ptr_glRasterPos4xOES)this->m_ptr_glRasterPos4xOES = (FunctionTable::MEMBERPFNGLRASTERPOS4XOESPROC)&RecordingTableDecorator::m_glRasterPos4xOES_recording;
+if(this->m_ptr_glVertexAttribP1ui)this->m_ptr_glVertexAttribP1ui = (FunctionTable::MEMBERPFNGLVERTEXATTRIBP1UIPROC)&RecordingTableDecorator::m_glVertexAttribP1ui_recording;
+if(this->m_ptr_glProgramUniform4dvEXT)this->m_ptr_glProgramUniform4dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4DVEXTPROC)&RecordingTableDecorator::m_glProgramUniform4dvEXT_recording;
+if(this->m_ptr_glEndTransformFeedbackEXT)this->m_ptr_glEndTransformFeedbackEXT = (FunctionTable::MEMBERPFNGLENDTRANSFORMFEEDBACKEXTPROC)&RecordingTableDecorator::m_glEndTransformFeedbackEXT_recording;
+if(this->m_ptr_glBinormal3dEXT)this->m_ptr_glBinormal3dEXT = (FunctionTable::MEMBERPFNGLBINORMAL3DEXTPROC)&RecordingTableDecorator::m_glBinormal3dEXT_recording;
+if(this->m_ptr_glGetTextureSubImage)this->m_ptr_glGetTextureSubImage = (FunctionTable::MEMBERPFNGLGETTEXTURESUBIMAGEPROC)&RecordingTableDecorator::m_glGetTextureSubImage_recording;
+if(this->m_ptr_glGetNamedRenderbufferParameteriv)this->m_ptr_glGetNamedRenderbufferParameteriv = (FunctionTable::MEMBERPFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC)&RecordingTableDecorator::m_glGetNamedRenderbufferParameteriv_recording;
+if(this->m_ptr_glBindBuffersRange)this->m_ptr_glBindBuffersRange = (FunctionTable::MEMBERPFNGLBINDBUFFERSRANGEPROC)&RecordingTableDecorator::m_glBindBuffersRange_recording;
+if(this->m_ptr_glFinishAsyncSGIX)this->m_ptr_glFinishAsyncSGIX = (FunctionTable::MEMBERPFNGLFINISHASYNCSGIXPROC)&RecordingTableDecorator::m_glFinishAsyncSGIX_recording;
+if(this->m_ptr_glBindFragDataLocationIndexed)this->m_ptr_glBindFragDataLocationIndexed = (FunctionTable::MEMBERPFNGLBINDFRAGDATALOCATIONINDEXEDPROC)&RecordingTableDecorator::m_glBindFragDataLocationIndexed_recording;
+if(this->m_ptr_glMultiTexCoord2dv)this->m_ptr_glMultiTexCoord2dv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2DVPROC)&RecordingTableDecorator::m_glMultiTexCoord2dv_recording;
+if(this->m_ptr_glUniform2iv)this->m_ptr_glUniform2iv = (FunctionTable::MEMBERPFNGLUNIFORM2IVPROC)&RecordingTableDecorator::m_glUniform2iv_recording;
+if(this->m_ptr_glProgramUniform2i64vNV)this->m_ptr_glProgramUniform2i64vNV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2I64VNVPROC)&RecordingTableDecorator::m_glProgramUniform2i64vNV_recording;
+if(this->m_ptr_glFlushVertexArrayRangeAPPLE)this->m_ptr_glFlushVertexArrayRangeAPPLE = (FunctionTable::MEMBERPFNGLFLUSHVERTEXARRAYRANGEAPPLEPROC)&RecordingTableDecorator::m_glFlushVertexArrayRangeAPPLE_recording;
+if(this->m_ptr_glTextureParameterf)this->m_ptr_glTextureParameterf = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERFPROC)&RecordingTableDecorator::m_glTextureParameterf_recording;
+if(this->m_ptr_glMultiTexCoord3dvARB)this->m_ptr_glMultiTexCoord3dvARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3DVARBPROC)&RecordingTableDecorator::m_glMultiTexCoord3dvARB_recording;
+if(this->m_ptr_glFeedbackBuffer)this->m_ptr_glFeedbackBuffer = (FunctionTable::MEMBERPFNGLFEEDBACKBUFFERPROC)&RecordingTableDecorator::m_glFeedbackBuffer_recording;
+if(this->m_ptr_glDebugMessageInsertARB)this->m_ptr_glDebugMessageInsertARB = (FunctionTable::MEMBERPFNGLDEBUGMESSAGEINSERTARBPROC)&RecordingTableDecorator::m_glDebugMessageInsertARB_recording;
+if(this->m_ptr_glMultiTexCoord2i)this->m_ptr_glMultiTexCoord2i = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2IPROC)&RecordingTableDecorator::m_glMultiTexCoord2i_recording;
+if(this->m_ptr_glTextureSubImage3D)this->m_ptr_glTextureSubImage3D = (FunctionTable::MEMBERPFNGLTEXTURESUBIMAGE3DPROC)&RecordingTableDecorator::m_glTextureSubImage3D_recording;
+if(this->m_ptr_glFramebufferTexture1D)this->m_ptr_glFramebufferTexture1D = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURE1DPROC)&RecordingTableDecorator::m_glFramebufferTexture1D_recording;
+if(this->m_ptr_glGetShaderiv)this->m_ptr_glGetShaderiv = (FunctionTable::MEMBERPFNGLGETSHADERIVPROC)&RecordingTableDecorator::m_glGetShaderiv_recording;
+if(this->m_ptr_glMultiTexCoord2d)this->m_ptr_glMultiTexCoord2d = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2DPROC)&RecordingTableDecorator::m_glMultiTexCoord2d_recording;
+if(this->m_ptr_glArrayObjectATI)this->m_ptr_glArrayObjectATI = (FunctionTable::MEMBERPFNGLARRAYOBJECTATIPROC)&RecordingTableDecorator::m_glArrayObjectATI_recording;
+if(this->m_ptr_glGetPointeri_vEXT)this->m_ptr_glGetPointeri_vEXT = (FunctionTable::MEMBERPFNGLGETPOINTERI_VEXTPROC)&RecordingTableDecorator::m_glGetPointeri_vEXT_recording;
+if(this->m_ptr_glGetPerfMonitorCountersAMD)this->m_ptr_glGetPerfMonitorCountersAMD = (FunctionTable::MEMBERPFNGLGETPERFMONITORCOUNTERSAMDPROC)&RecordingTableDecorator::m_glGetPerfMonitorCountersAMD_recording;
+if(this->m_ptr_glNamedBufferStorage)this->m_ptr_glNamedBufferStorage = (FunctionTable::MEMBERPFNGLNAMEDBUFFERSTORAGEPROC)&RecordingTableDecorator::m_glNamedBufferStorage_recording;
+if(this->m_ptr_glTexEnvxvOES)this->m_ptr_glTexEnvxvOES = (FunctionTable::MEMBERPFNGLTEXENVXVOESPROC)&RecordingTableDecorator::m_glTexEnvxvOES_recording;
+if(this->m_ptr_glProgramUniform2ui64NV)this->m_ptr_glProgramUniform2ui64NV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UI64NVPROC)&RecordingTableDecorator::m_glProgramUniform2ui64NV_recording;
+if(this->m_ptr_glMultiTexCoord3bOES)this->m_ptr_glMultiTexCoord3bOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3BOESPROC)&RecordingTableDecorator::m_glMultiTexCoord3bOES_recording;
+if(this->m_ptr_glUniform1dv)this->m_ptr_glUniform1dv = (FunctionTable::MEMBERPFNGLUNIFORM1DVPROC)&RecordingTableDecorator::m_glUniform1dv_recording;
+if(this->m_ptr_glPixelTransferi)this->m_ptr_glPixelTransferi = (FunctionTable::MEMBERPFNGLPIXELTRANSFERIPROC)&RecordingTableDecorator::m_glPixelTransferi_recording;
+if(this->m_ptr_glSecondaryColor3usvEXT)this->m_ptr_glSecondaryColor3usvEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3USVEXTPROC)&RecordingTableDecorator::m_glSecondaryColor3usvEXT_recording;
+if(this->m_ptr_glProgramEnvParameterI4uivNV)this->m_ptr_glProgramEnvParameterI4uivNV = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERI4UIVNVPROC)&RecordingTableDecorator::m_glProgramEnvParameterI4uivNV_recording;
+if(this->m_ptr_glVertex2sv)this->m_ptr_glVertex2sv = (FunctionTable::MEMBERPFNGLVERTEX2SVPROC)&RecordingTableDecorator::m_glVertex2sv_recording;
+if(this->m_ptr_glWindowPos4dMESA)this->m_ptr_glWindowPos4dMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS4DMESAPROC)&RecordingTableDecorator::m_glWindowPos4dMESA_recording;
+if(this->m_ptr_glDebugMessageControlARB)this->m_ptr_glDebugMessageControlARB = (FunctionTable::MEMBERPFNGLDEBUGMESSAGECONTROLARBPROC)&RecordingTableDecorator::m_glDebugMessageControlARB_recording;
+if(this->m_ptr_glIsTextureEXT)this->m_ptr_glIsTextureEXT = (FunctionTable::MEMBERPFNGLISTEXTUREEXTPROC)&RecordingTableDecorator::m_glIsTextureEXT_recording;
+if(this->m_ptr_glFragmentMaterialivSGIX)this->m_ptr_glFragmentMaterialivSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTMATERIALIVSGIXPROC)&RecordingTableDecorator::m_glFragmentMaterialivSGIX_recording;
+if(this->m_ptr_glLinkProgramARB)this->m_ptr_glLinkProgramARB = (FunctionTable::MEMBERPFNGLLINKPROGRAMARBPROC)&RecordingTableDecorator::m_glLinkProgramARB_recording;
+if(this->m_ptr_glFinishFenceAPPLE)this->m_ptr_glFinishFenceAPPLE = (FunctionTable::MEMBERPFNGLFINISHFENCEAPPLEPROC)&RecordingTableDecorator::m_glFinishFenceAPPLE_recording;
+if(this->m_ptr_glVertexArrayVertexAttribBindingEXT)this->m_ptr_glVertexArrayVertexAttribBindingEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBBINDINGEXTPROC)&RecordingTableDecorator::m_glVertexArrayVertexAttribBindingEXT_recording;
+if(this->m_ptr_glMultiTexCoord4fv)this->m_ptr_glMultiTexCoord4fv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4FVPROC)&RecordingTableDecorator::m_glMultiTexCoord4fv_recording;
+if(this->m_ptr_glRasterPos3i)this->m_ptr_glRasterPos3i = (FunctionTable::MEMBERPFNGLRASTERPOS3IPROC)&RecordingTableDecorator::m_glRasterPos3i_recording;
+if(this->m_ptr_glRasterPos3d)this->m_ptr_glRasterPos3d = (FunctionTable::MEMBERPFNGLRASTERPOS3DPROC)&RecordingTableDecorator::m_glRasterPos3d_recording;
+if(this->m_ptr_glPollAsyncSGIX)this->m_ptr_glPollAsyncSGIX = (FunctionTable::MEMBERPFNGLPOLLASYNCSGIXPROC)&RecordingTableDecorator::m_glPollAsyncSGIX_recording;
+if(this->m_ptr_glRasterPos3f)this->m_ptr_glRasterPos3f = (FunctionTable::MEMBERPFNGLRASTERPOS3FPROC)&RecordingTableDecorator::m_glRasterPos3f_recording;
+if(this->m_ptr_glCompressedTexImage3D)this->m_ptr_glCompressedTexImage3D = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXIMAGE3DPROC)&RecordingTableDecorator::m_glCompressedTexImage3D_recording;
+if(this->m_ptr_glVariantivEXT)this->m_ptr_glVariantivEXT = (FunctionTable::MEMBERPFNGLVARIANTIVEXTPROC)&RecordingTableDecorator::m_glVariantivEXT_recording;
+if(this->m_ptr_glUnmapTexture2DINTEL)this->m_ptr_glUnmapTexture2DINTEL = (FunctionTable::MEMBERPFNGLUNMAPTEXTURE2DINTELPROC)&RecordingTableDecorator::m_glUnmapTexture2DINTEL_recording;
+if(this->m_ptr_glGetVertexAttribiv)this->m_ptr_glGetVertexAttribiv = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBIVPROC)&RecordingTableDecorator::m_glGetVertexAttribiv_recording;
+if(this->m_ptr_glGetPathCoordsNV)this->m_ptr_glGetPathCoordsNV = (FunctionTable::MEMBERPFNGLGETPATHCOORDSNVPROC)&RecordingTableDecorator::m_glGetPathCoordsNV_recording;
+if(this->m_ptr_glColor4xvOES)this->m_ptr_glColor4xvOES = (FunctionTable::MEMBERPFNGLCOLOR4XVOESPROC)&RecordingTableDecorator::m_glColor4xvOES_recording;
+if(this->m_ptr_glVertexAttrib3fv)this->m_ptr_glVertexAttrib3fv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3FVPROC)&RecordingTableDecorator::m_glVertexAttrib3fv_recording;
+if(this->m_ptr_glRasterPos3s)this->m_ptr_glRasterPos3s = (FunctionTable::MEMBERPFNGLRASTERPOS3SPROC)&RecordingTableDecorator::m_glRasterPos3s_recording;
+if(this->m_ptr_glVertex4bOES)this->m_ptr_glVertex4bOES = (FunctionTable::MEMBERPFNGLVERTEX4BOESPROC)&RecordingTableDecorator::m_glVertex4bOES_recording;
+if(this->m_ptr_glTransformFeedbackVaryingsEXT)this->m_ptr_glTransformFeedbackVaryingsEXT = (FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKVARYINGSEXTPROC)&RecordingTableDecorator::m_glTransformFeedbackVaryingsEXT_recording;
+if(this->m_ptr_glCombinerOutputNV)this->m_ptr_glCombinerOutputNV = (FunctionTable::MEMBERPFNGLCOMBINEROUTPUTNVPROC)&RecordingTableDecorator::m_glCombinerOutputNV_recording;
+if(this->m_ptr_glWindowPos4sMESA)this->m_ptr_glWindowPos4sMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS4SMESAPROC)&RecordingTableDecorator::m_glWindowPos4sMESA_recording;
+if(this->m_ptr_glVertexAttrib4svARB)this->m_ptr_glVertexAttrib4svARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4SVARBPROC)&RecordingTableDecorator::m_glVertexAttrib4svARB_recording;
+if(this->m_ptr_glIsList)this->m_ptr_glIsList = (FunctionTable::MEMBERPFNGLISLISTPROC)&RecordingTableDecorator::m_glIsList_recording;
+if(this->m_ptr_glGetInfoLogARB)this->m_ptr_glGetInfoLogARB = (FunctionTable::MEMBERPFNGLGETINFOLOGARBPROC)&RecordingTableDecorator::m_glGetInfoLogARB_recording;
+if(this->m_ptr_glUniformMatrix2fv)this->m_ptr_glUniformMatrix2fv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX2FVPROC)&RecordingTableDecorator::m_glUniformMatrix2fv_recording;
+if(this->m_ptr_glVertexAttribs3dvNV)this->m_ptr_glVertexAttribs3dvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS3DVNVPROC)&RecordingTableDecorator::m_glVertexAttribs3dvNV_recording;
+if(this->m_ptr_glGlobalAlphaFactorsSUN)this->m_ptr_glGlobalAlphaFactorsSUN = (FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORSSUNPROC)&RecordingTableDecorator::m_glGlobalAlphaFactorsSUN_recording;
+if(this->m_ptr_glGetTrackMatrixivNV)this->m_ptr_glGetTrackMatrixivNV = (FunctionTable::MEMBERPFNGLGETTRACKMATRIXIVNVPROC)&RecordingTableDecorator::m_glGetTrackMatrixivNV_recording;
+if(this->m_ptr_glTextureParameterfvEXT)this->m_ptr_glTextureParameterfvEXT = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERFVEXTPROC)&RecordingTableDecorator::m_glTextureParameterfvEXT_recording;
+if(this->m_ptr_glIsNamedBufferResidentNV)this->m_ptr_glIsNamedBufferResidentNV = (FunctionTable::MEMBERPFNGLISNAMEDBUFFERRESIDENTNVPROC)&RecordingTableDecorator::m_glIsNamedBufferResidentNV_recording;
+if(this->m_ptr_glProgramUniform4ui64vARB)this->m_ptr_glProgramUniform4ui64vARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UI64VARBPROC)&RecordingTableDecorator::m_glProgramUniform4ui64vARB_recording;
+if(this->m_ptr_glTbufferMask3DFX)this->m_ptr_glTbufferMask3DFX = (FunctionTable::MEMBERPFNGLTBUFFERMASK3DFXPROC)&RecordingTableDecorator::m_glTbufferMask3DFX_recording;
+if(this->m_ptr_glCoverFillPathNV)this->m_ptr_glCoverFillPathNV = (FunctionTable::MEMBERPFNGLCOVERFILLPATHNVPROC)&RecordingTableDecorator::m_glCoverFillPathNV_recording;
+if(this->m_ptr_glVertexAttrib1fvARB)this->m_ptr_glVertexAttrib1fvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1FVARBPROC)&RecordingTableDecorator::m_glVertexAttrib1fvARB_recording;
+if(this->m_ptr_glGenerateTextureMipmap)this->m_ptr_glGenerateTextureMipmap = (FunctionTable::MEMBERPFNGLGENERATETEXTUREMIPMAPPROC)&RecordingTableDecorator::m_glGenerateTextureMipmap_recording;
+if(this->m_ptr_glNamedProgramLocalParameterI4uivEXT)this->m_ptr_glNamedProgramLocalParameterI4uivEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERI4UIVEXTPROC)&RecordingTableDecorator::m_glNamedProgramLocalParameterI4uivEXT_recording;
+if(this->m_ptr_glMultiDrawElementsBaseVertex)this->m_ptr_glMultiDrawElementsBaseVertex = (FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSBASEVERTEXPROC)&RecordingTableDecorator::m_glMultiDrawElementsBaseVertex_recording;
+if(this->m_ptr_glProgramSubroutineParametersuivNV)this->m_ptr_glProgramSubroutineParametersuivNV = (FunctionTable::MEMBERPFNGLPROGRAMSUBROUTINEPARAMETERSUIVNVPROC)&RecordingTableDecorator::m_glProgramSubroutineParametersuivNV_recording;
+if(this->m_ptr_glProgramUniformMatrix2x4dvEXT)this->m_ptr_glProgramUniformMatrix2x4dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X4DVEXTPROC)&RecordingTableDecorator::m_glProgramUniformMatrix2x4dvEXT_recording;
+if(this->m_ptr_glRotatexOES)this->m_ptr_glRotatexOES = (FunctionTable::MEMBERPFNGLROTATEXOESPROC)&RecordingTableDecorator::m_glRotatexOES_recording;
+if(this->m_ptr_glMemoryBarrierEXT)this->m_ptr_glMemoryBarrierEXT = (FunctionTable::MEMBERPFNGLMEMORYBARRIEREXTPROC)&RecordingTableDecorator::m_glMemoryBarrierEXT_recording;
+if(this->m_ptr_glVertexAttrib3svNV)this->m_ptr_glVertexAttrib3svNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3SVNVPROC)&RecordingTableDecorator::m_glVertexAttrib3svNV_recording;
+if(this->m_ptr_glVertexStream3iATI)this->m_ptr_glVertexStream3iATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM3IATIPROC)&RecordingTableDecorator::m_glVertexStream3iATI_recording;
+if(this->m_ptr_glCompressedTexSubImage1D)this->m_ptr_glCompressedTexSubImage1D = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXSUBIMAGE1DPROC)&RecordingTableDecorator::m_glCompressedTexSubImage1D_recording;
+if(this->m_ptr_glSetFenceNV)this->m_ptr_glSetFenceNV = (FunctionTable::MEMBERPFNGLSETFENCENVPROC)&RecordingTableDecorator::m_glSetFenceNV_recording;
+if(this->m_ptr_glAttachObjectARB)this->m_ptr_glAttachObjectARB = (FunctionTable::MEMBERPFNGLATTACHOBJECTARBPROC)&RecordingTableDecorator::m_glAttachObjectARB_recording;
+if(this->m_ptr_glCopyConvolutionFilter1D)this->m_ptr_glCopyConvolutionFilter1D = (FunctionTable::MEMBERPFNGLCOPYCONVOLUTIONFILTER1DPROC)&RecordingTableDecorator::m_glCopyConvolutionFilter1D_recording;
+if(this->m_ptr_glProgramParameters4fvNV)this->m_ptr_glProgramParameters4fvNV = (FunctionTable::MEMBERPFNGLPROGRAMPARAMETERS4FVNVPROC)&RecordingTableDecorator::m_glProgramParameters4fvNV_recording;
+if(this->m_ptr_glNamedFramebufferParameteriEXT)this->m_ptr_glNamedFramebufferParameteriEXT = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERPARAMETERIEXTPROC)&RecordingTableDecorator::m_glNamedFramebufferParameteriEXT_recording;
+if(this->m_ptr_glVertexAttrib4Nsv)this->m_ptr_glVertexAttrib4Nsv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NSVPROC)&RecordingTableDecorator::m_glVertexAttrib4Nsv_recording;
+if(this->m_ptr_glVertexAttribI4usvEXT)this->m_ptr_glVertexAttribI4usvEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4USVEXTPROC)&RecordingTableDecorator::m_glVertexAttribI4usvEXT_recording;
+if(this->m_ptr_glTextureBufferRangeEXT)this->m_ptr_glTextureBufferRangeEXT = (FunctionTable::MEMBERPFNGLTEXTUREBUFFERRANGEEXTPROC)&RecordingTableDecorator::m_glTextureBufferRangeEXT_recording;
+if(this->m_ptr_glVertexP3uiv)this->m_ptr_glVertexP3uiv = (FunctionTable::MEMBERPFNGLVERTEXP3UIVPROC)&RecordingTableDecorator::m_glVertexP3uiv_recording;
+if(this->m_ptr_glIsPathNV)this->m_ptr_glIsPathNV = (FunctionTable::MEMBERPFNGLISPATHNVPROC)&RecordingTableDecorator::m_glIsPathNV_recording;
+if(this->m_ptr_glGetnUniformi64vARB)this->m_ptr_glGetnUniformi64vARB = (FunctionTable::MEMBERPFNGLGETNUNIFORMI64VARBPROC)&RecordingTableDecorator::m_glGetnUniformi64vARB_recording;
+if(this->m_ptr_glFramebufferTextureMultiviewOVR)this->m_ptr_glFramebufferTextureMultiviewOVR = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTUREMULTIVIEWOVRPROC)&RecordingTableDecorator::m_glFramebufferTextureMultiviewOVR_recording;
+if(this->m_ptr_glCompressedMultiTexSubImage2DEXT)this->m_ptr_glCompressedMultiTexSubImage2DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDMULTITEXSUBIMAGE2DEXTPROC)&RecordingTableDecorator::m_glCompressedMultiTexSubImage2DEXT_recording;
+if(this->m_ptr_glGetnMapdv)this->m_ptr_glGetnMapdv = (FunctionTable::MEMBERPFNGLGETNMAPDVPROC)&RecordingTableDecorator::m_glGetnMapdv_recording;
+if(this->m_ptr_glDebugMessageCallback)this->m_ptr_glDebugMessageCallback = (FunctionTable::MEMBERPFNGLDEBUGMESSAGECALLBACKPROC)&RecordingTableDecorator::m_glDebugMessageCallback_recording;
+if(this->m_ptr_glTangent3svEXT)this->m_ptr_glTangent3svEXT = (FunctionTable::MEMBERPFNGLTANGENT3SVEXTPROC)&RecordingTableDecorator::m_glTangent3svEXT_recording;
+if(this->m_ptr_glVertexAttribParameteriAMD)this->m_ptr_glVertexAttribParameteriAMD = (FunctionTable::MEMBERPFNGLVERTEXATTRIBPARAMETERIAMDPROC)&RecordingTableDecorator::m_glVertexAttribParameteriAMD_recording;
+if(this->m_ptr_glBufferSubDataARB)this->m_ptr_glBufferSubDataARB = (FunctionTable::MEMBERPFNGLBUFFERSUBDATAARBPROC)&RecordingTableDecorator::m_glBufferSubDataARB_recording;
+if(this->m_ptr_glGetVertexAttribLui64vARB)this->m_ptr_glGetVertexAttribLui64vARB = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBLUI64VARBPROC)&RecordingTableDecorator::m_glGetVertexAttribLui64vARB_recording;
+if(this->m_ptr_glVertexAttribL4ui64NV)this->m_ptr_glVertexAttribL4ui64NV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL4UI64NVPROC)&RecordingTableDecorator::m_glVertexAttribL4ui64NV_recording;
+if(this->m_ptr_glReplacementCodeuiColor4ubVertex3fSUN)this->m_ptr_glReplacementCodeuiColor4ubVertex3fSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUICOLOR4UBVERTEX3FSUNPROC)&RecordingTableDecorator::m_glReplacementCodeuiColor4ubVertex3fSUN_recording;
+if(this->m_ptr_glImageTransformParameterfHP)this->m_ptr_glImageTransformParameterfHP = (FunctionTable::MEMBERPFNGLIMAGETRANSFORMPARAMETERFHPPROC)&RecordingTableDecorator::m_glImageTransformParameterfHP_recording;
+if(this->m_ptr_glMap1f)this->m_ptr_glMap1f = (FunctionTable::MEMBERPFNGLMAP1FPROC)&RecordingTableDecorator::m_glMap1f_recording;
+if(this->m_ptr_glRasterPos4fv)this->m_ptr_glRasterPos4fv = (FunctionTable::MEMBERPFNGLRASTERPOS4FVPROC)&RecordingTableDecorator::m_glRasterPos4fv_recording;
+if(this->m_ptr_glVertex2bvOES)this->m_ptr_glVertex2bvOES = (FunctionTable::MEMBERPFNGLVERTEX2BVOESPROC)&RecordingTableDecorator::m_glVertex2bvOES_recording;
+if(this->m_ptr_glGetMapControlPointsNV)this->m_ptr_glGetMapControlPointsNV = (FunctionTable::MEMBERPFNGLGETMAPCONTROLPOINTSNVPROC)&RecordingTableDecorator::m_glGetMapControlPointsNV_recording;
+if(this->m_ptr_glNamedProgramLocalParametersI4ivEXT)this->m_ptr_glNamedProgramLocalParametersI4ivEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERSI4IVEXTPROC)&RecordingTableDecorator::m_glNamedProgramLocalParametersI4ivEXT_recording;
+if(this->m_ptr_glBindBufferRangeNV)this->m_ptr_glBindBufferRangeNV = (FunctionTable::MEMBERPFNGLBINDBUFFERRANGENVPROC)&RecordingTableDecorator::m_glBindBufferRangeNV_recording;
+if(this->m_ptr_glVertexStream3dvATI)this->m_ptr_glVertexStream3dvATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM3DVATIPROC)&RecordingTableDecorator::m_glVertexStream3dvATI_recording;
+if(this->m_ptr_glNormalPointerListIBM)this->m_ptr_glNormalPointerListIBM = (FunctionTable::MEMBERPFNGLNORMALPOINTERLISTIBMPROC)&RecordingTableDecorator::m_glNormalPointerListIBM_recording;
+if(this->m_ptr_glFogFuncSGIS)this->m_ptr_glFogFuncSGIS = (FunctionTable::MEMBERPFNGLFOGFUNCSGISPROC)&RecordingTableDecorator::m_glFogFuncSGIS_recording;
+if(this->m_ptr_glMultiModeDrawArraysIBM)this->m_ptr_glMultiModeDrawArraysIBM = (FunctionTable::MEMBERPFNGLMULTIMODEDRAWARRAYSIBMPROC)&RecordingTableDecorator::m_glMultiModeDrawArraysIBM_recording;
+if(this->m_ptr_glGetNamedFramebufferAttachmentParameterivEXT)this->m_ptr_glGetNamedFramebufferAttachmentParameterivEXT = (FunctionTable::MEMBERPFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVEXTPROC)&RecordingTableDecorator::m_glGetNamedFramebufferAttachmentParameterivEXT_recording;
+if(this->m_ptr_glGetFloatv)this->m_ptr_glGetFloatv = (FunctionTable::MEMBERPFNGLGETFLOATVPROC)&RecordingTableDecorator::m_glGetFloatv_recording;
+if(this->m_ptr_glVertexArrayVertexAttribIFormatEXT)this->m_ptr_glVertexArrayVertexAttribIFormatEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBIFORMATEXTPROC)&RecordingTableDecorator::m_glVertexArrayVertexAttribIFormatEXT_recording;
+if(this->m_ptr_glHint)this->m_ptr_glHint = (FunctionTable::MEMBERPFNGLHINTPROC)&RecordingTableDecorator::m_glHint_recording;
+if(this->m_ptr_glPointAlongPathNV)this->m_ptr_glPointAlongPathNV = (FunctionTable::MEMBERPFNGLPOINTALONGPATHNVPROC)&RecordingTableDecorator::m_glPointAlongPathNV_recording;
+if(this->m_ptr_glVertexStream2svATI)this->m_ptr_glVertexStream2svATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM2SVATIPROC)&RecordingTableDecorator::m_glVertexStream2svATI_recording;
+if(this->m_ptr_glMultiDrawArraysIndirect)this->m_ptr_glMultiDrawArraysIndirect = (FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSINDIRECTPROC)&RecordingTableDecorator::m_glMultiDrawArraysIndirect_recording;
+if(this->m_ptr_glVertexAttribP2uiv)this->m_ptr_glVertexAttribP2uiv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBP2UIVPROC)&RecordingTableDecorator::m_glVertexAttribP2uiv_recording;
+if(this->m_ptr_glProgramUniform1i64vARB)this->m_ptr_glProgramUniform1i64vARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1I64VARBPROC)&RecordingTableDecorator::m_glProgramUniform1i64vARB_recording;
+if(this->m_ptr_glFramebufferTextureARB)this->m_ptr_glFramebufferTextureARB = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTUREARBPROC)&RecordingTableDecorator::m_glFramebufferTextureARB_recording;
+if(this->m_ptr_glPushClientAttribDefaultEXT)this->m_ptr_glPushClientAttribDefaultEXT = (FunctionTable::MEMBERPFNGLPUSHCLIENTATTRIBDEFAULTEXTPROC)&RecordingTableDecorator::m_glPushClientAttribDefaultEXT_recording;
+if(this->m_ptr_glScalef)this->m_ptr_glScalef = (FunctionTable::MEMBERPFNGLSCALEFPROC)&RecordingTableDecorator::m_glScalef_recording;
+if(this->m_ptr_glScaled)this->m_ptr_glScaled = (FunctionTable::MEMBERPFNGLSCALEDPROC)&RecordingTableDecorator::m_glScaled_recording;
+if(this->m_ptr_glGetConvolutionParameterxvOES)this->m_ptr_glGetConvolutionParameterxvOES = (FunctionTable::MEMBERPFNGLGETCONVOLUTIONPARAMETERXVOESPROC)&RecordingTableDecorator::m_glGetConvolutionParameterxvOES_recording;
+if(this->m_ptr_glGetProgramResourceName)this->m_ptr_glGetProgramResourceName = (FunctionTable::MEMBERPFNGLGETPROGRAMRESOURCENAMEPROC)&RecordingTableDecorator::m_glGetProgramResourceName_recording;
+if(this->m_ptr_glCopyColorTable)this->m_ptr_glCopyColorTable = (FunctionTable::MEMBERPFNGLCOPYCOLORTABLEPROC)&RecordingTableDecorator::m_glCopyColorTable_recording;
+if(this->m_ptr_glDepthRangeArrayv)this->m_ptr_glDepthRangeArrayv = (FunctionTable::MEMBERPFNGLDEPTHRANGEARRAYVPROC)&RecordingTableDecorator::m_glDepthRangeArrayv_recording;
+if(this->m_ptr_glCoverFillPathInstancedNV)this->m_ptr_glCoverFillPathInstancedNV = (FunctionTable::MEMBERPFNGLCOVERFILLPATHINSTANCEDNVPROC)&RecordingTableDecorator::m_glCoverFillPathInstancedNV_recording;
+if(this->m_ptr_glMultiTexParameterivEXT)this->m_ptr_glMultiTexParameterivEXT = (FunctionTable::MEMBERPFNGLMULTITEXPARAMETERIVEXTPROC)&RecordingTableDecorator::m_glMultiTexParameterivEXT_recording;
+if(this->m_ptr_glGetActiveAtomicCounterBufferiv)this->m_ptr_glGetActiveAtomicCounterBufferiv = (FunctionTable::MEMBERPFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC)&RecordingTableDecorator::m_glGetActiveAtomicCounterBufferiv_recording;
+if(this->m_ptr_glStencilOpSeparate)this->m_ptr_glStencilOpSeparate = (FunctionTable::MEMBERPFNGLSTENCILOPSEPARATEPROC)&RecordingTableDecorator::m_glStencilOpSeparate_recording;
+if(this->m_ptr_glVertexAttrib4fNV)this->m_ptr_glVertexAttrib4fNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4FNVPROC)&RecordingTableDecorator::m_glVertexAttrib4fNV_recording;
+if(this->m_ptr_glGetColorTableParameterivSGI)this->m_ptr_glGetColorTableParameterivSGI = (FunctionTable::MEMBERPFNGLGETCOLORTABLEPARAMETERIVSGIPROC)&RecordingTableDecorator::m_glGetColorTableParameterivSGI_recording;
+if(this->m_ptr_glVertexArrayAttribBinding)this->m_ptr_glVertexArrayAttribBinding = (FunctionTable::MEMBERPFNGLVERTEXARRAYATTRIBBINDINGPROC)&RecordingTableDecorator::m_glVertexArrayAttribBinding_recording;
+if(this->m_ptr_glProgramParameters4dvNV)this->m_ptr_glProgramParameters4dvNV = (FunctionTable::MEMBERPFNGLPROGRAMPARAMETERS4DVNVPROC)&RecordingTableDecorator::m_glProgramParameters4dvNV_recording;
+if(this->m_ptr_glVertexAttribL4dv)this->m_ptr_glVertexAttribL4dv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL4DVPROC)&RecordingTableDecorator::m_glVertexAttribL4dv_recording;
+if(this->m_ptr_glVertexStream3dATI)this->m_ptr_glVertexStream3dATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM3DATIPROC)&RecordingTableDecorator::m_glVertexStream3dATI_recording;
+if(this->m_ptr_glGetUniformOffsetEXT)this->m_ptr_glGetUniformOffsetEXT = (FunctionTable::MEMBERPFNGLGETUNIFORMOFFSETEXTPROC)&RecordingTableDecorator::m_glGetUniformOffsetEXT_recording;
+if(this->m_ptr_glGetVertexAttribPointerv)this->m_ptr_glGetVertexAttribPointerv = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBPOINTERVPROC)&RecordingTableDecorator::m_glGetVertexAttribPointerv_recording;
+if(this->m_ptr_glProgramUniform3i64vNV)this->m_ptr_glProgramUniform3i64vNV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3I64VNVPROC)&RecordingTableDecorator::m_glProgramUniform3i64vNV_recording;
+if(this->m_ptr_glTangent3fEXT)this->m_ptr_glTangent3fEXT = (FunctionTable::MEMBERPFNGLTANGENT3FEXTPROC)&RecordingTableDecorator::m_glTangent3fEXT_recording;
+if(this->m_ptr_glGetPathMetricRangeNV)this->m_ptr_glGetPathMetricRangeNV = (FunctionTable::MEMBERPFNGLGETPATHMETRICRANGENVPROC)&RecordingTableDecorator::m_glGetPathMetricRangeNV_recording;
+if(this->m_ptr_glWindowPos2iMESA)this->m_ptr_glWindowPos2iMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS2IMESAPROC)&RecordingTableDecorator::m_glWindowPos2iMESA_recording;
+if(this->m_ptr_glVertex2xvOES)this->m_ptr_glVertex2xvOES = (FunctionTable::MEMBERPFNGLVERTEX2XVOESPROC)&RecordingTableDecorator::m_glVertex2xvOES_recording;
+if(this->m_ptr_glGetnCompressedTexImage)this->m_ptr_glGetnCompressedTexImage = (FunctionTable::MEMBERPFNGLGETNCOMPRESSEDTEXIMAGEPROC)&RecordingTableDecorator::m_glGetnCompressedTexImage_recording;
+if(this->m_ptr_glWindowPos2dv)this->m_ptr_glWindowPos2dv = (FunctionTable::MEMBERPFNGLWINDOWPOS2DVPROC)&RecordingTableDecorator::m_glWindowPos2dv_recording;
+if(this->m_ptr_glReplacementCodeuiVertex3fSUN)this->m_ptr_glReplacementCodeuiVertex3fSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUIVERTEX3FSUNPROC)&RecordingTableDecorator::m_glReplacementCodeuiVertex3fSUN_recording;
+if(this->m_ptr_glGetTransformFeedbackVaryingEXT)this->m_ptr_glGetTransformFeedbackVaryingEXT = (FunctionTable::MEMBERPFNGLGETTRANSFORMFEEDBACKVARYINGEXTPROC)&RecordingTableDecorator::m_glGetTransformFeedbackVaryingEXT_recording;
+if(this->m_ptr_glWindowPos3fARB)this->m_ptr_glWindowPos3fARB = (FunctionTable::MEMBERPFNGLWINDOWPOS3FARBPROC)&RecordingTableDecorator::m_glWindowPos3fARB_recording;
+if(this->m_ptr_glMapNamedBufferEXT)this->m_ptr_glMapNamedBufferEXT = (FunctionTable::MEMBERPFNGLMAPNAMEDBUFFEREXTPROC)&RecordingTableDecorator::m_glMapNamedBufferEXT_recording;
+if(this->m_ptr_glDisable)this->m_ptr_glDisable = (FunctionTable::MEMBERPFNGLDISABLEPROC)&RecordingTableDecorator::m_glDisable_recording;
+if(this->m_ptr_glIsPointInFillPathNV)this->m_ptr_glIsPointInFillPathNV = (FunctionTable::MEMBERPFNGLISPOINTINFILLPATHNVPROC)&RecordingTableDecorator::m_glIsPointInFillPathNV_recording;
+if(this->m_ptr_glVertexAttribI2uiEXT)this->m_ptr_glVertexAttribI2uiEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI2UIEXTPROC)&RecordingTableDecorator::m_glVertexAttribI2uiEXT_recording;
+if(this->m_ptr_glProgramUniform4uiv)this->m_ptr_glProgramUniform4uiv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UIVPROC)&RecordingTableDecorator::m_glProgramUniform4uiv_recording;
+if(this->m_ptr_glQueryCounter)this->m_ptr_glQueryCounter = (FunctionTable::MEMBERPFNGLQUERYCOUNTERPROC)&RecordingTableDecorator::m_glQueryCounter_recording;
+if(this->m_ptr_glFramebufferRenderbufferEXT)this->m_ptr_glFramebufferRenderbufferEXT = (FunctionTable::MEMBERPFNGLFRAMEBUFFERRENDERBUFFEREXTPROC)&RecordingTableDecorator::m_glFramebufferRenderbufferEXT_recording;
+if(this->m_ptr_glBinormal3svEXT)this->m_ptr_glBinormal3svEXT = (FunctionTable::MEMBERPFNGLBINORMAL3SVEXTPROC)&RecordingTableDecorator::m_glBinormal3svEXT_recording;
+if(this->m_ptr_glBindBufferOffsetNV)this->m_ptr_glBindBufferOffsetNV = (FunctionTable::MEMBERPFNGLBINDBUFFEROFFSETNVPROC)&RecordingTableDecorator::m_glBindBufferOffsetNV_recording;
+if(this->m_ptr_glCopyTextureSubImage2D)this->m_ptr_glCopyTextureSubImage2D = (FunctionTable::MEMBERPFNGLCOPYTEXTURESUBIMAGE2DPROC)&RecordingTableDecorator::m_glCopyTextureSubImage2D_recording;
+if(this->m_ptr_glGetProgramResourcefvNV)this->m_ptr_glGetProgramResourcefvNV = (FunctionTable::MEMBERPFNGLGETPROGRAMRESOURCEFVNVPROC)&RecordingTableDecorator::m_glGetProgramResourcefvNV_recording;
+if(this->m_ptr_glBinormalPointerEXT)this->m_ptr_glBinormalPointerEXT = (FunctionTable::MEMBERPFNGLBINORMALPOINTEREXTPROC)&RecordingTableDecorator::m_glBinormalPointerEXT_recording;
+if(this->m_ptr_glGetLightfv)this->m_ptr_glGetLightfv = (FunctionTable::MEMBERPFNGLGETLIGHTFVPROC)&RecordingTableDecorator::m_glGetLightfv_recording;
+if(this->m_ptr_glVertex2bOES)this->m_ptr_glVertex2bOES = (FunctionTable::MEMBERPFNGLVERTEX2BOESPROC)&RecordingTableDecorator::m_glVertex2bOES_recording;
+if(this->m_ptr_glUniform2ivARB)this->m_ptr_glUniform2ivARB = (FunctionTable::MEMBERPFNGLUNIFORM2IVARBPROC)&RecordingTableDecorator::m_glUniform2ivARB_recording;
+if(this->m_ptr_glMultiTexCoord3s)this->m_ptr_glMultiTexCoord3s = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3SPROC)&RecordingTableDecorator::m_glMultiTexCoord3s_recording;
+if(this->m_ptr_glGetHistogramParameterfvEXT)this->m_ptr_glGetHistogramParameterfvEXT = (FunctionTable::MEMBERPFNGLGETHISTOGRAMPARAMETERFVEXTPROC)&RecordingTableDecorator::m_glGetHistogramParameterfvEXT_recording;
+if(this->m_ptr_glGetProgramStringNV)this->m_ptr_glGetProgramStringNV = (FunctionTable::MEMBERPFNGLGETPROGRAMSTRINGNVPROC)&RecordingTableDecorator::m_glGetProgramStringNV_recording;
+if(this->m_ptr_glGetTexGenxvOES)this->m_ptr_glGetTexGenxvOES = (FunctionTable::MEMBERPFNGLGETTEXGENXVOESPROC)&RecordingTableDecorator::m_glGetTexGenxvOES_recording;
+if(this->m_ptr_glTextureSubImage2D)this->m_ptr_glTextureSubImage2D = (FunctionTable::MEMBERPFNGLTEXTURESUBIMAGE2DPROC)&RecordingTableDecorator::m_glTextureSubImage2D_recording;
+if(this->m_ptr_glObjectPurgeableAPPLE)this->m_ptr_glObjectPurgeableAPPLE = (FunctionTable::MEMBERPFNGLOBJECTPURGEABLEAPPLEPROC)&RecordingTableDecorator::m_glObjectPurgeableAPPLE_recording;
+if(this->m_ptr_glColorTableSGI)this->m_ptr_glColorTableSGI = (FunctionTable::MEMBERPFNGLCOLORTABLESGIPROC)&RecordingTableDecorator::m_glColorTableSGI_recording;
+if(this->m_ptr_glCopyConvolutionFilter2DEXT)this->m_ptr_glCopyConvolutionFilter2DEXT = (FunctionTable::MEMBERPFNGLCOPYCONVOLUTIONFILTER2DEXTPROC)&RecordingTableDecorator::m_glCopyConvolutionFilter2DEXT_recording;
+if(this->m_ptr_glMultiTexCoord3f)this->m_ptr_glMultiTexCoord3f = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3FPROC)&RecordingTableDecorator::m_glMultiTexCoord3f_recording;
+if(this->m_ptr_glMultiTexCoord3d)this->m_ptr_glMultiTexCoord3d = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3DPROC)&RecordingTableDecorator::m_glMultiTexCoord3d_recording;
+if(this->m_ptr_glFogCoorddv)this->m_ptr_glFogCoorddv = (FunctionTable::MEMBERPFNGLFOGCOORDDVPROC)&RecordingTableDecorator::m_glFogCoorddv_recording;
+if(this->m_ptr_glGetBufferPointerv)this->m_ptr_glGetBufferPointerv = (FunctionTable::MEMBERPFNGLGETBUFFERPOINTERVPROC)&RecordingTableDecorator::m_glGetBufferPointerv_recording;
+if(this->m_ptr_glProgramUniform1fEXT)this->m_ptr_glProgramUniform1fEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1FEXTPROC)&RecordingTableDecorator::m_glProgramUniform1fEXT_recording;
+if(this->m_ptr_glWindowPos2fvMESA)this->m_ptr_glWindowPos2fvMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS2FVMESAPROC)&RecordingTableDecorator::m_glWindowPos2fvMESA_recording;
+if(this->m_ptr_glPolygonOffsetxOES)this->m_ptr_glPolygonOffsetxOES = (FunctionTable::MEMBERPFNGLPOLYGONOFFSETXOESPROC)&RecordingTableDecorator::m_glPolygonOffsetxOES_recording;
+if(this->m_ptr_glVertexAttrib4dARB)this->m_ptr_glVertexAttrib4dARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4DARBPROC)&RecordingTableDecorator::m_glVertexAttrib4dARB_recording;
+if(this->m_ptr_glUniformHandleui64vARB)this->m_ptr_glUniformHandleui64vARB = (FunctionTable::MEMBERPFNGLUNIFORMHANDLEUI64VARBPROC)&RecordingTableDecorator::m_glUniformHandleui64vARB_recording;
+if(this->m_ptr_glFragmentLightModelfvSGIX)this->m_ptr_glFragmentLightModelfvSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTLIGHTMODELFVSGIXPROC)&RecordingTableDecorator::m_glFragmentLightModelfvSGIX_recording;
+if(this->m_ptr_glSwizzleEXT)this->m_ptr_glSwizzleEXT = (FunctionTable::MEMBERPFNGLSWIZZLEEXTPROC)&RecordingTableDecorator::m_glSwizzleEXT_recording;
+if(this->m_ptr_glBindFragmentShaderATI)this->m_ptr_glBindFragmentShaderATI = (FunctionTable::MEMBERPFNGLBINDFRAGMENTSHADERATIPROC)&RecordingTableDecorator::m_glBindFragmentShaderATI_recording;
+if(this->m_ptr_glVertexAttribs3hvNV)this->m_ptr_glVertexAttribs3hvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS3HVNVPROC)&RecordingTableDecorator::m_glVertexAttribs3hvNV_recording;
+if(this->m_ptr_glColorP3ui)this->m_ptr_glColorP3ui = (FunctionTable::MEMBERPFNGLCOLORP3UIPROC)&RecordingTableDecorator::m_glColorP3ui_recording;
+if(this->m_ptr_glListParameterfvSGIX)this->m_ptr_glListParameterfvSGIX = (FunctionTable::MEMBERPFNGLLISTPARAMETERFVSGIXPROC)&RecordingTableDecorator::m_glListParameterfvSGIX_recording;
+if(this->m_ptr_glNamedRenderbufferStorageMultisample)this->m_ptr_glNamedRenderbufferStorageMultisample = (FunctionTable::MEMBERPFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC)&RecordingTableDecorator::m_glNamedRenderbufferStorageMultisample_recording;
+if(this->m_ptr_glVertexAttribI1iEXT)this->m_ptr_glVertexAttribI1iEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI1IEXTPROC)&RecordingTableDecorator::m_glVertexAttribI1iEXT_recording;
+if(this->m_ptr_glMultiTexCoord2ivARB)this->m_ptr_glMultiTexCoord2ivARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2IVARBPROC)&RecordingTableDecorator::m_glMultiTexCoord2ivARB_recording;
+if(this->m_ptr_glLightModelxOES)this->m_ptr_glLightModelxOES = (FunctionTable::MEMBERPFNGLLIGHTMODELXOESPROC)&RecordingTableDecorator::m_glLightModelxOES_recording;
+if(this->m_ptr_glColor3xOES)this->m_ptr_glColor3xOES = (FunctionTable::MEMBERPFNGLCOLOR3XOESPROC)&RecordingTableDecorator::m_glColor3xOES_recording;
+if(this->m_ptr_glReadBuffer)this->m_ptr_glReadBuffer = (FunctionTable::MEMBERPFNGLREADBUFFERPROC)&RecordingTableDecorator::m_glReadBuffer_recording;
+if(this->m_ptr_glStencilFillPathInstancedNV)this->m_ptr_glStencilFillPathInstancedNV = (FunctionTable::MEMBERPFNGLSTENCILFILLPATHINSTANCEDNVPROC)&RecordingTableDecorator::m_glStencilFillPathInstancedNV_recording;
+if(this->m_ptr_glVDPAUUnmapSurfacesNV)this->m_ptr_glVDPAUUnmapSurfacesNV = (FunctionTable::MEMBERPFNGLVDPAUUNMAPSURFACESNVPROC)&RecordingTableDecorator::m_glVDPAUUnmapSurfacesNV_recording;
+if(this->m_ptr_glProgramUniform4i64NV)this->m_ptr_glProgramUniform4i64NV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4I64NVPROC)&RecordingTableDecorator::m_glProgramUniform4i64NV_recording;
+if(this->m_ptr_glVertexStream4dvATI)this->m_ptr_glVertexStream4dvATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM4DVATIPROC)&RecordingTableDecorator::m_glVertexStream4dvATI_recording;
+if(this->m_ptr_glIsQuery)this->m_ptr_glIsQuery = (FunctionTable::MEMBERPFNGLISQUERYPROC)&RecordingTableDecorator::m_glIsQuery_recording;
+if(this->m_ptr_glProgramUniformMatrix4fvEXT)this->m_ptr_glProgramUniformMatrix4fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4FVEXTPROC)&RecordingTableDecorator::m_glProgramUniformMatrix4fvEXT_recording;
+if(this->m_ptr_glVertexAttrib3hNV)this->m_ptr_glVertexAttrib3hNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3HNVPROC)&RecordingTableDecorator::m_glVertexAttrib3hNV_recording;
+if(this->m_ptr_glFlushMappedNamedBufferRange)this->m_ptr_glFlushMappedNamedBufferRange = (FunctionTable::MEMBERPFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC)&RecordingTableDecorator::m_glFlushMappedNamedBufferRange_recording;
+if(this->m_ptr_glPushName)this->m_ptr_glPushName = (FunctionTable::MEMBERPFNGLPUSHNAMEPROC)&RecordingTableDecorator::m_glPushName_recording;
+if(this->m_ptr_glGetClipPlane)this->m_ptr_glGetClipPlane = (FunctionTable::MEMBERPFNGLGETCLIPPLANEPROC)&RecordingTableDecorator::m_glGetClipPlane_recording;
+if(this->m_ptr_glVertex4dv)this->m_ptr_glVertex4dv = (FunctionTable::MEMBERPFNGLVERTEX4DVPROC)&RecordingTableDecorator::m_glVertex4dv_recording;
+if(this->m_ptr_glVertexAttrib3d)this->m_ptr_glVertexAttrib3d = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3DPROC)&RecordingTableDecorator::m_glVertexAttrib3d_recording;
+if(this->m_ptr_glBlendColor)this->m_ptr_glBlendColor = (FunctionTable::MEMBERPFNGLBLENDCOLORPROC)&RecordingTableDecorator::m_glBlendColor_recording;
+if(this->m_ptr_glBindTransformFeedbackNV)this->m_ptr_glBindTransformFeedbackNV = (FunctionTable::MEMBERPFNGLBINDTRANSFORMFEEDBACKNVPROC)&RecordingTableDecorator::m_glBindTransformFeedbackNV_recording;
+if(this->m_ptr_glSamplerParameterIuiv)this->m_ptr_glSamplerParameterIuiv = (FunctionTable::MEMBERPFNGLSAMPLERPARAMETERIUIVPROC)&RecordingTableDecorator::m_glSamplerParameterIuiv_recording;
+if(this->m_ptr_glIndexubv)this->m_ptr_glIndexubv = (FunctionTable::MEMBERPFNGLINDEXUBVPROC)&RecordingTableDecorator::m_glIndexubv_recording;
+if(this->m_ptr_glNamedBufferPageCommitmentEXT)this->m_ptr_glNamedBufferPageCommitmentEXT = (FunctionTable::MEMBERPFNGLNAMEDBUFFERPAGECOMMITMENTEXTPROC)&RecordingTableDecorator::m_glNamedBufferPageCommitmentEXT_recording;
+if(this->m_ptr_glCheckNamedFramebufferStatus)this->m_ptr_glCheckNamedFramebufferStatus = (FunctionTable::MEMBERPFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC)&RecordingTableDecorator::m_glCheckNamedFramebufferStatus_recording;
+if(this->m_ptr_glGetObjectBufferfvATI)this->m_ptr_glGetObjectBufferfvATI = (FunctionTable::MEMBERPFNGLGETOBJECTBUFFERFVATIPROC)&RecordingTableDecorator::m_glGetObjectBufferfvATI_recording;
+if(this->m_ptr_glRasterPos4d)this->m_ptr_glRasterPos4d = (FunctionTable::MEMBERPFNGLRASTERPOS4DPROC)&RecordingTableDecorator::m_glRasterPos4d_recording;
+if(this->m_ptr_glRasterPos4f)this->m_ptr_glRasterPos4f = (FunctionTable::MEMBERPFNGLRASTERPOS4FPROC)&RecordingTableDecorator::m_glRasterPos4f_recording;
+if(this->m_ptr_glGetPerfMonitorCounterStringAMD)this->m_ptr_glGetPerfMonitorCounterStringAMD = (FunctionTable::MEMBERPFNGLGETPERFMONITORCOUNTERSTRINGAMDPROC)&RecordingTableDecorator::m_glGetPerfMonitorCounterStringAMD_recording;
+if(this->m_ptr_glVertexAttrib3s)this->m_ptr_glVertexAttrib3s = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3SPROC)&RecordingTableDecorator::m_glVertexAttrib3s_recording;
+if(this->m_ptr_glDrawElementsInstancedEXT)this->m_ptr_glDrawElementsInstancedEXT = (FunctionTable::MEMBERPFNGLDRAWELEMENTSINSTANCEDEXTPROC)&RecordingTableDecorator::m_glDrawElementsInstancedEXT_recording;
+if(this->m_ptr_glNamedProgramLocalParameterI4iEXT)this->m_ptr_glNamedProgramLocalParameterI4iEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERI4IEXTPROC)&RecordingTableDecorator::m_glNamedProgramLocalParameterI4iEXT_recording;
+if(this->m_ptr_glRasterPos4s)this->m_ptr_glRasterPos4s = (FunctionTable::MEMBERPFNGLRASTERPOS4SPROC)&RecordingTableDecorator::m_glRasterPos4s_recording;
+if(this->m_ptr_glGetProgramStageiv)this->m_ptr_glGetProgramStageiv = (FunctionTable::MEMBERPFNGLGETPROGRAMSTAGEIVPROC)&RecordingTableDecorator::m_glGetProgramStageiv_recording;
+if(this->m_ptr_glGetMaterialxOES)this->m_ptr_glGetMaterialxOES = (FunctionTable::MEMBERPFNGLGETMATERIALXOESPROC)&RecordingTableDecorator::m_glGetMaterialxOES_recording;
+if(this->m_ptr_glPopMatrix)this->m_ptr_glPopMatrix = (FunctionTable::MEMBERPFNGLPOPMATRIXPROC)&RecordingTableDecorator::m_glPopMatrix_recording;
+if(this->m_ptr_glGetVideoui64vNV)this->m_ptr_glGetVideoui64vNV = (FunctionTable::MEMBERPFNGLGETVIDEOUI64VNVPROC)&RecordingTableDecorator::m_glGetVideoui64vNV_recording;
+if(this->m_ptr_glTangent3bEXT)this->m_ptr_glTangent3bEXT = (FunctionTable::MEMBERPFNGLTANGENT3BEXTPROC)&RecordingTableDecorator::m_glTangent3bEXT_recording;
+if(this->m_ptr_glGetGraphicsResetStatusARB)this->m_ptr_glGetGraphicsResetStatusARB = (FunctionTable::MEMBERPFNGLGETGRAPHICSRESETSTATUSARBPROC)&RecordingTableDecorator::m_glGetGraphicsResetStatusARB_recording;
+if(this->m_ptr_glUniform4i)this->m_ptr_glUniform4i = (FunctionTable::MEMBERPFNGLUNIFORM4IPROC)&RecordingTableDecorator::m_glUniform4i_recording;
+if(this->m_ptr_glActiveTexture)this->m_ptr_glActiveTexture = (FunctionTable::MEMBERPFNGLACTIVETEXTUREPROC)&RecordingTableDecorator::m_glActiveTexture_recording;
+if(this->m_ptr_glEnableVertexAttribArray)this->m_ptr_glEnableVertexAttribArray = (FunctionTable::MEMBERPFNGLENABLEVERTEXATTRIBARRAYPROC)&RecordingTableDecorator::m_glEnableVertexAttribArray_recording;
+if(this->m_ptr_glTexCoord4fVertex4fvSUN)this->m_ptr_glTexCoord4fVertex4fvSUN = (FunctionTable::MEMBERPFNGLTEXCOORD4FVERTEX4FVSUNPROC)&RecordingTableDecorator::m_glTexCoord4fVertex4fvSUN_recording;
+if(this->m_ptr_glUniform4d)this->m_ptr_glUniform4d = (FunctionTable::MEMBERPFNGLUNIFORM4DPROC)&RecordingTableDecorator::m_glUniform4d_recording;
+if(this->m_ptr_glUniform4f)this->m_ptr_glUniform4f = (FunctionTable::MEMBERPFNGLUNIFORM4FPROC)&RecordingTableDecorator::m_glUniform4f_recording;
+if(this->m_ptr_glRenderbufferStorageMultisample)this->m_ptr_glRenderbufferStorageMultisample = (FunctionTable::MEMBERPFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC)&RecordingTableDecorator::m_glRenderbufferStorageMultisample_recording;
+if(this->m_ptr_glCreateProgramPipelines)this->m_ptr_glCreateProgramPipelines = (FunctionTable::MEMBERPFNGLCREATEPROGRAMPIPELINESPROC)&RecordingTableDecorator::m_glCreateProgramPipelines_recording;
+if(this->m_ptr_glVertexAttribLPointer)this->m_ptr_glVertexAttribLPointer = (FunctionTable::MEMBERPFNGLVERTEXATTRIBLPOINTERPROC)&RecordingTableDecorator::m_glVertexAttribLPointer_recording;
+if(this->m_ptr_glUniform2uiEXT)this->m_ptr_glUniform2uiEXT = (FunctionTable::MEMBERPFNGLUNIFORM2UIEXTPROC)&RecordingTableDecorator::m_glUniform2uiEXT_recording;
+if(this->m_ptr_glMultiTexCoord3sv)this->m_ptr_glMultiTexCoord3sv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3SVPROC)&RecordingTableDecorator::m_glMultiTexCoord3sv_recording;
+if(this->m_ptr_glDrawElementsInstancedBaseVertex)this->m_ptr_glDrawElementsInstancedBaseVertex = (FunctionTable::MEMBERPFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC)&RecordingTableDecorator::m_glDrawElementsInstancedBaseVertex_recording;
+if(this->m_ptr_glPixelTransformParameterfvEXT)this->m_ptr_glPixelTransformParameterfvEXT = (FunctionTable::MEMBERPFNGLPIXELTRANSFORMPARAMETERFVEXTPROC)&RecordingTableDecorator::m_glPixelTransformParameterfvEXT_recording;
+if(this->m_ptr_glDrawTransformFeedbackNV)this->m_ptr_glDrawTransformFeedbackNV = (FunctionTable::MEMBERPFNGLDRAWTRANSFORMFEEDBACKNVPROC)&RecordingTableDecorator::m_glDrawTransformFeedbackNV_recording;
+if(this->m_ptr_glTextureImage2DMultisampleCoverageNV)this->m_ptr_glTextureImage2DMultisampleCoverageNV = (FunctionTable::MEMBERPFNGLTEXTUREIMAGE2DMULTISAMPLECOVERAGENVPROC)&RecordingTableDecorator::m_glTextureImage2DMultisampleCoverageNV_recording;
+if(this->m_ptr_glNamedRenderbufferStorageMultisampleCoverageEXT)this->m_ptr_glNamedRenderbufferStorageMultisampleCoverageEXT = (FunctionTable::MEMBERPFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLECOVERAGEEXTPROC)&RecordingTableDecorator::m_glNamedRenderbufferStorageMultisampleCoverageEXT_recording;
+if(this->m_ptr_glIsTexture)this->m_ptr_glIsTexture = (FunctionTable::MEMBERPFNGLISTEXTUREPROC)&RecordingTableDecorator::m_glIsTexture_recording;
+if(this->m_ptr_glMultiTexCoord4iv)this->m_ptr_glMultiTexCoord4iv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4IVPROC)&RecordingTableDecorator::m_glMultiTexCoord4iv_recording;
+if(this->m_ptr_glTexEnvfv)this->m_ptr_glTexEnvfv = (FunctionTable::MEMBERPFNGLTEXENVFVPROC)&RecordingTableDecorator::m_glTexEnvfv_recording;
+if(this->m_ptr_glPopDebugGroup)this->m_ptr_glPopDebugGroup = (FunctionTable::MEMBERPFNGLPOPDEBUGGROUPPROC)&RecordingTableDecorator::m_glPopDebugGroup_recording;
+if(this->m_ptr_glUniformBlockBinding)this->m_ptr_glUniformBlockBinding = (FunctionTable::MEMBERPFNGLUNIFORMBLOCKBINDINGPROC)&RecordingTableDecorator::m_glUniformBlockBinding_recording;
+if(this->m_ptr_glWindowPos2svMESA)this->m_ptr_glWindowPos2svMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS2SVMESAPROC)&RecordingTableDecorator::m_glWindowPos2svMESA_recording;
+if(this->m_ptr_glGenerateTextureMipmapEXT)this->m_ptr_glGenerateTextureMipmapEXT = (FunctionTable::MEMBERPFNGLGENERATETEXTUREMIPMAPEXTPROC)&RecordingTableDecorator::m_glGenerateTextureMipmapEXT_recording;
+if(this->m_ptr_glBindLightParameterEXT)this->m_ptr_glBindLightParameterEXT = (FunctionTable::MEMBERPFNGLBINDLIGHTPARAMETEREXTPROC)&RecordingTableDecorator::m_glBindLightParameterEXT_recording;
+if(this->m_ptr_glTexCoord3bOES)this->m_ptr_glTexCoord3bOES = (FunctionTable::MEMBERPFNGLTEXCOORD3BOESPROC)&RecordingTableDecorator::m_glTexCoord3bOES_recording;
+if(this->m_ptr_glTexCoordPointer)this->m_ptr_glTexCoordPointer = (FunctionTable::MEMBERPFNGLTEXCOORDPOINTERPROC)&RecordingTableDecorator::m_glTexCoordPointer_recording;
+if(this->m_ptr_glProgramUniformMatrix3x2fv)this->m_ptr_glProgramUniformMatrix3x2fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X2FVPROC)&RecordingTableDecorator::m_glProgramUniformMatrix3x2fv_recording;
+if(this->m_ptr_glUniform2fvARB)this->m_ptr_glUniform2fvARB = (FunctionTable::MEMBERPFNGLUNIFORM2FVARBPROC)&RecordingTableDecorator::m_glUniform2fvARB_recording;
+if(this->m_ptr_glProgramLocalParameterI4uivNV)this->m_ptr_glProgramLocalParameterI4uivNV = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERI4UIVNVPROC)&RecordingTableDecorator::m_glProgramLocalParameterI4uivNV_recording;
+if(this->m_ptr_glFlushVertexArrayRangeNV)this->m_ptr_glFlushVertexArrayRangeNV = (FunctionTable::MEMBERPFNGLFLUSHVERTEXARRAYRANGENVPROC)&RecordingTableDecorator::m_glFlushVertexArrayRangeNV_recording;
+if(this->m_ptr_glSecondaryColor3svEXT)this->m_ptr_glSecondaryColor3svEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3SVEXTPROC)&RecordingTableDecorator::m_glSecondaryColor3svEXT_recording;
+if(this->m_ptr_glGetBufferParameteriv)this->m_ptr_glGetBufferParameteriv = (FunctionTable::MEMBERPFNGLGETBUFFERPARAMETERIVPROC)&RecordingTableDecorator::m_glGetBufferParameteriv_recording;
+if(this->m_ptr_glGetQueryIndexediv)this->m_ptr_glGetQueryIndexediv = (FunctionTable::MEMBERPFNGLGETQUERYINDEXEDIVPROC)&RecordingTableDecorator::m_glGetQueryIndexediv_recording;
+if(this->m_ptr_glFramebufferTexture3DEXT)this->m_ptr_glFramebufferTexture3DEXT = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURE3DEXTPROC)&RecordingTableDecorator::m_glFramebufferTexture3DEXT_recording;
+if(this->m_ptr_glLoadTransposeMatrixxOES)this->m_ptr_glLoadTransposeMatrixxOES = (FunctionTable::MEMBERPFNGLLOADTRANSPOSEMATRIXXOESPROC)&RecordingTableDecorator::m_glLoadTransposeMatrixxOES_recording;
+if(this->m_ptr_glDeleteTransformFeedbacksNV)this->m_ptr_glDeleteTransformFeedbacksNV = (FunctionTable::MEMBERPFNGLDELETETRANSFORMFEEDBACKSNVPROC)&RecordingTableDecorator::m_glDeleteTransformFeedbacksNV_recording;
+if(this->m_ptr_glGetCompressedTextureImageEXT)this->m_ptr_glGetCompressedTextureImageEXT = (FunctionTable::MEMBERPFNGLGETCOMPRESSEDTEXTUREIMAGEEXTPROC)&RecordingTableDecorator::m_glGetCompressedTextureImageEXT_recording;
+if(this->m_ptr_glIndexMaterialEXT)this->m_ptr_glIndexMaterialEXT = (FunctionTable::MEMBERPFNGLINDEXMATERIALEXTPROC)&RecordingTableDecorator::m_glIndexMaterialEXT_recording;
+if(this->m_ptr_glFogCoorddEXT)this->m_ptr_glFogCoorddEXT = (FunctionTable::MEMBERPFNGLFOGCOORDDEXTPROC)&RecordingTableDecorator::m_glFogCoorddEXT_recording;
+if(this->m_ptr_glTexCoord2hvNV)this->m_ptr_glTexCoord2hvNV = (FunctionTable::MEMBERPFNGLTEXCOORD2HVNVPROC)&RecordingTableDecorator::m_glTexCoord2hvNV_recording;
+if(this->m_ptr_glFramebufferTexture2DEXT)this->m_ptr_glFramebufferTexture2DEXT = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURE2DEXTPROC)&RecordingTableDecorator::m_glFramebufferTexture2DEXT_recording;
+if(this->m_ptr_glTexEnviv)this->m_ptr_glTexEnviv = (FunctionTable::MEMBERPFNGLTEXENVIVPROC)&RecordingTableDecorator::m_glTexEnviv_recording;
+if(this->m_ptr_glEndTransformFeedbackNV)this->m_ptr_glEndTransformFeedbackNV = (FunctionTable::MEMBERPFNGLENDTRANSFORMFEEDBACKNVPROC)&RecordingTableDecorator::m_glEndTransformFeedbackNV_recording;
+if(this->m_ptr_glGlobalAlphaFactoruiSUN)this->m_ptr_glGlobalAlphaFactoruiSUN = (FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORUISUNPROC)&RecordingTableDecorator::m_glGlobalAlphaFactoruiSUN_recording;
+if(this->m_ptr_glSelectBuffer)this->m_ptr_glSelectBuffer = (FunctionTable::MEMBERPFNGLSELECTBUFFERPROC)&RecordingTableDecorator::m_glSelectBuffer_recording;
+if(this->m_ptr_glNamedBufferSubDataEXT)this->m_ptr_glNamedBufferSubDataEXT = (FunctionTable::MEMBERPFNGLNAMEDBUFFERSUBDATAEXTPROC)&RecordingTableDecorator::m_glNamedBufferSubDataEXT_recording;
+if(this->m_ptr_glDisableVertexArrayAttrib)this->m_ptr_glDisableVertexArrayAttrib = (FunctionTable::MEMBERPFNGLDISABLEVERTEXARRAYATTRIBPROC)&RecordingTableDecorator::m_glDisableVertexArrayAttrib_recording;
+if(this->m_ptr_glBlendFunc)this->m_ptr_glBlendFunc = (FunctionTable::MEMBERPFNGLBLENDFUNCPROC)&RecordingTableDecorator::m_glBlendFunc_recording;
+if(this->m_ptr_glCreateProgram)this->m_ptr_glCreateProgram = (FunctionTable::MEMBERPFNGLCREATEPROGRAMPROC)&RecordingTableDecorator::m_glCreateProgram_recording;
+if(this->m_ptr_glVertexStream2dATI)this->m_ptr_glVertexStream2dATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM2DATIPROC)&RecordingTableDecorator::m_glVertexStream2dATI_recording;
+if(this->m_ptr_glUniform4ui64vARB)this->m_ptr_glUniform4ui64vARB = (FunctionTable::MEMBERPFNGLUNIFORM4UI64VARBPROC)&RecordingTableDecorator::m_glUniform4ui64vARB_recording;
+if(this->m_ptr_glPrimitiveRestartIndex)this->m_ptr_glPrimitiveRestartIndex = (FunctionTable::MEMBERPFNGLPRIMITIVERESTARTINDEXPROC)&RecordingTableDecorator::m_glPrimitiveRestartIndex_recording;
+if(this->m_ptr_glNormalStream3fATI)this->m_ptr_glNormalStream3fATI = (FunctionTable::MEMBERPFNGLNORMALSTREAM3FATIPROC)&RecordingTableDecorator::m_glNormalStream3fATI_recording;
+if(this->m_ptr_glProgramUniformMatrix2fv)this->m_ptr_glProgramUniformMatrix2fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2FVPROC)&RecordingTableDecorator::m_glProgramUniformMatrix2fv_recording;
+if(this->m_ptr_glVertexAttribs1hvNV)this->m_ptr_glVertexAttribs1hvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS1HVNVPROC)&RecordingTableDecorator::m_glVertexAttribs1hvNV_recording;
+if(this->m_ptr_glWindowPos4svMESA)this->m_ptr_glWindowPos4svMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS4SVMESAPROC)&RecordingTableDecorator::m_glWindowPos4svMESA_recording;
+if(this->m_ptr_glDeleteFragmentShaderATI)this->m_ptr_glDeleteFragmentShaderATI = (FunctionTable::MEMBERPFNGLDELETEFRAGMENTSHADERATIPROC)&RecordingTableDecorator::m_glDeleteFragmentShaderATI_recording;
+if(this->m_ptr_glBindImageTextures)this->m_ptr_glBindImageTextures = (FunctionTable::MEMBERPFNGLBINDIMAGETEXTURESPROC)&RecordingTableDecorator::m_glBindImageTextures_recording;
+if(this->m_ptr_glMap2xOES)this->m_ptr_glMap2xOES = (FunctionTable::MEMBERPFNGLMAP2XOESPROC)&RecordingTableDecorator::m_glMap2xOES_recording;
+if(this->m_ptr_glEnd)this->m_ptr_glEnd = (FunctionTable::MEMBERPFNGLENDPROC)&RecordingTableDecorator::m_glEnd_recording;
+if(this->m_ptr_glMultiTexCoord2dARB)this->m_ptr_glMultiTexCoord2dARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2DARBPROC)&RecordingTableDecorator::m_glMultiTexCoord2dARB_recording;
+if(this->m_ptr_glUniform1i64NV)this->m_ptr_glUniform1i64NV = (FunctionTable::MEMBERPFNGLUNIFORM1I64NVPROC)&RecordingTableDecorator::m_glUniform1i64NV_recording;
+if(this->m_ptr_glPathStringNV)this->m_ptr_glPathStringNV = (FunctionTable::MEMBERPFNGLPATHSTRINGNVPROC)&RecordingTableDecorator::m_glPathStringNV_recording;
+if(this->m_ptr_glGetNamedFramebufferParameterivEXT)this->m_ptr_glGetNamedFramebufferParameterivEXT = (FunctionTable::MEMBERPFNGLGETNAMEDFRAMEBUFFERPARAMETERIVEXTPROC)&RecordingTableDecorator::m_glGetNamedFramebufferParameterivEXT_recording;
+if(this->m_ptr_glGetProgramNamedParameterdvNV)this->m_ptr_glGetProgramNamedParameterdvNV = (FunctionTable::MEMBERPFNGLGETPROGRAMNAMEDPARAMETERDVNVPROC)&RecordingTableDecorator::m_glGetProgramNamedParameterdvNV_recording;
+if(this->m_ptr_glPathDashArrayNV)this->m_ptr_glPathDashArrayNV = (FunctionTable::MEMBERPFNGLPATHDASHARRAYNVPROC)&RecordingTableDecorator::m_glPathDashArrayNV_recording;
+if(this->m_ptr_glUniform3uiv)this->m_ptr_glUniform3uiv = (FunctionTable::MEMBERPFNGLUNIFORM3UIVPROC)&RecordingTableDecorator::m_glUniform3uiv_recording;
+if(this->m_ptr_glColor3fVertex3fvSUN)this->m_ptr_glColor3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLCOLOR3FVERTEX3FVSUNPROC)&RecordingTableDecorator::m_glColor3fVertex3fvSUN_recording;
+if(this->m_ptr_glMultTransposeMatrixd)this->m_ptr_glMultTransposeMatrixd = (FunctionTable::MEMBERPFNGLMULTTRANSPOSEMATRIXDPROC)&RecordingTableDecorator::m_glMultTransposeMatrixd_recording;
+if(this->m_ptr_glClearColor)this->m_ptr_glClearColor = (FunctionTable::MEMBERPFNGLCLEARCOLORPROC)&RecordingTableDecorator::m_glClearColor_recording;
+if(this->m_ptr_glGetImageHandleARB)this->m_ptr_glGetImageHandleARB = (FunctionTable::MEMBERPFNGLGETIMAGEHANDLEARBPROC)&RecordingTableDecorator::m_glGetImageHandleARB_recording;
+if(this->m_ptr_glTangent3dEXT)this->m_ptr_glTangent3dEXT = (FunctionTable::MEMBERPFNGLTANGENT3DEXTPROC)&RecordingTableDecorator::m_glTangent3dEXT_recording;
+if(this->m_ptr_glGetQueryObjectivARB)this->m_ptr_glGetQueryObjectivARB = (FunctionTable::MEMBERPFNGLGETQUERYOBJECTIVARBPROC)&RecordingTableDecorator::m_glGetQueryObjectivARB_recording;
+if(this->m_ptr_glGetLocalConstantFloatvEXT)this->m_ptr_glGetLocalConstantFloatvEXT = (FunctionTable::MEMBERPFNGLGETLOCALCONSTANTFLOATVEXTPROC)&RecordingTableDecorator::m_glGetLocalConstantFloatvEXT_recording;
+if(this->m_ptr_glUseShaderProgramEXT)this->m_ptr_glUseShaderProgramEXT = (FunctionTable::MEMBERPFNGLUSESHADERPROGRAMEXTPROC)&RecordingTableDecorator::m_glUseShaderProgramEXT_recording;
+if(this->m_ptr_glBindRenderbufferEXT)this->m_ptr_glBindRenderbufferEXT = (FunctionTable::MEMBERPFNGLBINDRENDERBUFFEREXTPROC)&RecordingTableDecorator::m_glBindRenderbufferEXT_recording;
+if(this->m_ptr_glInterleavedArrays)this->m_ptr_glInterleavedArrays = (FunctionTable::MEMBERPFNGLINTERLEAVEDARRAYSPROC)&RecordingTableDecorator::m_glInterleavedArrays_recording;
+if(this->m_ptr_glGetPerfMonitorGroupStringAMD)this->m_ptr_glGetPerfMonitorGroupStringAMD = (FunctionTable::MEMBERPFNGLGETPERFMONITORGROUPSTRINGAMDPROC)&RecordingTableDecorator::m_glGetPerfMonitorGroupStringAMD_recording;
+if(this->m_ptr_glUniform3ui)this->m_ptr_glUniform3ui = (FunctionTable::MEMBERPFNGLUNIFORM3UIPROC)&RecordingTableDecorator::m_glUniform3ui_recording;
+if(this->m_ptr_glGetNamedProgramLocalParameterdvEXT)this->m_ptr_glGetNamedProgramLocalParameterdvEXT = (FunctionTable::MEMBERPFNGLGETNAMEDPROGRAMLOCALPARAMETERDVEXTPROC)&RecordingTableDecorator::m_glGetNamedProgramLocalParameterdvEXT_recording;
+if(this->m_ptr_glSecondaryColor3us)this->m_ptr_glSecondaryColor3us = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3USPROC)&RecordingTableDecorator::m_glSecondaryColor3us_recording;
+if(this->m_ptr_glVertexAttribI4uiv)this->m_ptr_glVertexAttribI4uiv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4UIVPROC)&RecordingTableDecorator::m_glVertexAttribI4uiv_recording;
+if(this->m_ptr_glVertexAttrib4bv)this->m_ptr_glVertexAttrib4bv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4BVPROC)&RecordingTableDecorator::m_glVertexAttrib4bv_recording;
+if(this->m_ptr_glMultiTexCoord3xOES)this->m_ptr_glMultiTexCoord3xOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3XOESPROC)&RecordingTableDecorator::m_glMultiTexCoord3xOES_recording;
+if(this->m_ptr_glSecondaryColor3ub)this->m_ptr_glSecondaryColor3ub = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UBPROC)&RecordingTableDecorator::m_glSecondaryColor3ub_recording;
+if(this->m_ptr_glFragmentMaterialfSGIX)this->m_ptr_glFragmentMaterialfSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTMATERIALFSGIXPROC)&RecordingTableDecorator::m_glFragmentMaterialfSGIX_recording;
+if(this->m_ptr_glGetVariantArrayObjectivATI)this->m_ptr_glGetVariantArrayObjectivATI = (FunctionTable::MEMBERPFNGLGETVARIANTARRAYOBJECTIVATIPROC)&RecordingTableDecorator::m_glGetVariantArrayObjectivATI_recording;
+if(this->m_ptr_glSecondaryColor3ui)this->m_ptr_glSecondaryColor3ui = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UIPROC)&RecordingTableDecorator::m_glSecondaryColor3ui_recording;
+if(this->m_ptr_glVertexAttrib1dARB)this->m_ptr_glVertexAttrib1dARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1DARBPROC)&RecordingTableDecorator::m_glVertexAttrib1dARB_recording;
+if(this->m_ptr_glGetNamedBufferPointerv)this->m_ptr_glGetNamedBufferPointerv = (FunctionTable::MEMBERPFNGLGETNAMEDBUFFERPOINTERVPROC)&RecordingTableDecorator::m_glGetNamedBufferPointerv_recording;
+if(this->m_ptr_glLockArraysEXT)this->m_ptr_glLockArraysEXT = (FunctionTable::MEMBERPFNGLLOCKARRAYSEXTPROC)&RecordingTableDecorator::m_glLockArraysEXT_recording;
+if(this->m_ptr_glVertexAttribPointerNV)this->m_ptr_glVertexAttribPointerNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBPOINTERNVPROC)&RecordingTableDecorator::m_glVertexAttribPointerNV_recording;
+if(this->m_ptr_glConvolutionParameterf)this->m_ptr_glConvolutionParameterf = (FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERFPROC)&RecordingTableDecorator::m_glConvolutionParameterf_recording;
+if(this->m_ptr_glBindBufferBaseEXT)this->m_ptr_glBindBufferBaseEXT = (FunctionTable::MEMBERPFNGLBINDBUFFERBASEEXTPROC)&RecordingTableDecorator::m_glBindBufferBaseEXT_recording;
+if(this->m_ptr_glTexCoord2xvOES)this->m_ptr_glTexCoord2xvOES = (FunctionTable::MEMBERPFNGLTEXCOORD2XVOESPROC)&RecordingTableDecorator::m_glTexCoord2xvOES_recording;
+if(this->m_ptr_glGetQueryBufferObjectui64v)this->m_ptr_glGetQueryBufferObjectui64v = (FunctionTable::MEMBERPFNGLGETQUERYBUFFEROBJECTUI64VPROC)&RecordingTableDecorator::m_glGetQueryBufferObjectui64v_recording;
+if(this->m_ptr_glSetMultisamplefvAMD)this->m_ptr_glSetMultisamplefvAMD = (FunctionTable::MEMBERPFNGLSETMULTISAMPLEFVAMDPROC)&RecordingTableDecorator::m_glSetMultisamplefvAMD_recording;
+if(this->m_ptr_glPathColorGenNV)this->m_ptr_glPathColorGenNV = (FunctionTable::MEMBERPFNGLPATHCOLORGENNVPROC)&RecordingTableDecorator::m_glPathColorGenNV_recording;
+if(this->m_ptr_glVertexAttrib3sARB)this->m_ptr_glVertexAttrib3sARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3SARBPROC)&RecordingTableDecorator::m_glVertexAttrib3sARB_recording;
+if(this->m_ptr_glVertexAttrib4ivARB)this->m_ptr_glVertexAttrib4ivARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4IVARBPROC)&RecordingTableDecorator::m_glVertexAttrib4ivARB_recording;
+if(this->m_ptr_glGenTransformFeedbacks)this->m_ptr_glGenTransformFeedbacks = (FunctionTable::MEMBERPFNGLGENTRANSFORMFEEDBACKSPROC)&RecordingTableDecorator::m_glGenTransformFeedbacks_recording;
+if(this->m_ptr_glGetVertexAttribIuiv)this->m_ptr_glGetVertexAttribIuiv = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBIUIVPROC)&RecordingTableDecorator::m_glGetVertexAttribIuiv_recording;
+if(this->m_ptr_glPixelTransformParameterfEXT)this->m_ptr_glPixelTransformParameterfEXT = (FunctionTable::MEMBERPFNGLPIXELTRANSFORMPARAMETERFEXTPROC)&RecordingTableDecorator::m_glPixelTransformParameterfEXT_recording;
+if(this->m_ptr_glGetTexParameterIuivEXT)this->m_ptr_glGetTexParameterIuivEXT = (FunctionTable::MEMBERPFNGLGETTEXPARAMETERIUIVEXTPROC)&RecordingTableDecorator::m_glGetTexParameterIuivEXT_recording;
+if(this->m_ptr_glGetObjectParameterivARB)this->m_ptr_glGetObjectParameterivARB = (FunctionTable::MEMBERPFNGLGETOBJECTPARAMETERIVARBPROC)&RecordingTableDecorator::m_glGetObjectParameterivARB_recording;
+if(this->m_ptr_glVertexArraySecondaryColorOffsetEXT)this->m_ptr_glVertexArraySecondaryColorOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYSECONDARYCOLOROFFSETEXTPROC)&RecordingTableDecorator::m_glVertexArraySecondaryColorOffsetEXT_recording;
+if(this->m_ptr_glWindowPos2fARB)this->m_ptr_glWindowPos2fARB = (FunctionTable::MEMBERPFNGLWINDOWPOS2FARBPROC)&RecordingTableDecorator::m_glWindowPos2fARB_recording;
+if(this->m_ptr_glCompressedTexSubImage2D)this->m_ptr_glCompressedTexSubImage2D = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXSUBIMAGE2DPROC)&RecordingTableDecorator::m_glCompressedTexSubImage2D_recording;
+if(this->m_ptr_glCompressedTexSubImage3DARB)this->m_ptr_glCompressedTexSubImage3DARB = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXSUBIMAGE3DARBPROC)&RecordingTableDecorator::m_glCompressedTexSubImage3DARB_recording;
+if(this->m_ptr_glProgramBinary)this->m_ptr_glProgramBinary = (FunctionTable::MEMBERPFNGLPROGRAMBINARYPROC)&RecordingTableDecorator::m_glProgramBinary_recording;
+if(this->m_ptr_glPresentFrameKeyedNV)this->m_ptr_glPresentFrameKeyedNV = (FunctionTable::MEMBERPFNGLPRESENTFRAMEKEYEDNVPROC)&RecordingTableDecorator::m_glPresentFrameKeyedNV_recording;
+if(this->m_ptr_glVertexAttribI4bv)this->m_ptr_glVertexAttribI4bv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4BVPROC)&RecordingTableDecorator::m_glVertexAttribI4bv_recording;
+if(this->m_ptr_glPathCoverDepthFuncNV)this->m_ptr_glPathCoverDepthFuncNV = (FunctionTable::MEMBERPFNGLPATHCOVERDEPTHFUNCNVPROC)&RecordingTableDecorator::m_glPathCoverDepthFuncNV_recording;
+if(this->m_ptr_glTransformFeedbackStreamAttribsNV)this->m_ptr_glTransformFeedbackStreamAttribsNV = (FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKSTREAMATTRIBSNVPROC)&RecordingTableDecorator::m_glTransformFeedbackStreamAttribsNV_recording;
+if(this->m_ptr_glSecondaryColor3usEXT)this->m_ptr_glSecondaryColor3usEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3USEXTPROC)&RecordingTableDecorator::m_glSecondaryColor3usEXT_recording;
+if(this->m_ptr_glCopyColorTableSGI)this->m_ptr_glCopyColorTableSGI = (FunctionTable::MEMBERPFNGLCOPYCOLORTABLESGIPROC)&RecordingTableDecorator::m_glCopyColorTableSGI_recording;
+if(this->m_ptr_glProgramEnvParameter4fvARB)this->m_ptr_glProgramEnvParameter4fvARB = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETER4FVARBPROC)&RecordingTableDecorator::m_glProgramEnvParameter4fvARB_recording;
+if(this->m_ptr_glMultiTexCoord4sARB)this->m_ptr_glMultiTexCoord4sARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4SARBPROC)&RecordingTableDecorator::m_glMultiTexCoord4sARB_recording;
+if(this->m_ptr_glGetVertexArrayIndexed64iv)this->m_ptr_glGetVertexArrayIndexed64iv = (FunctionTable::MEMBERPFNGLGETVERTEXARRAYINDEXED64IVPROC)&RecordingTableDecorator::m_glGetVertexArrayIndexed64iv_recording;
+if(this->m_ptr_glMatrixMultTranspose3x3fNV)this->m_ptr_glMatrixMultTranspose3x3fNV = (FunctionTable::MEMBERPFNGLMATRIXMULTTRANSPOSE3X3FNVPROC)&RecordingTableDecorator::m_glMatrixMultTranspose3x3fNV_recording;
+if(this->m_ptr_glTexParameterIiv)this->m_ptr_glTexParameterIiv = (FunctionTable::MEMBERPFNGLTEXPARAMETERIIVPROC)&RecordingTableDecorator::m_glTexParameterIiv_recording;
+if(this->m_ptr_glVertexArrayAttribFormat)this->m_ptr_glVertexArrayAttribFormat = (FunctionTable::MEMBERPFNGLVERTEXARRAYATTRIBFORMATPROC)&RecordingTableDecorator::m_glVertexArrayAttribFormat_recording;
+if(this->m_ptr_glEndTransformFeedback)this->m_ptr_glEndTransformFeedback = (FunctionTable::MEMBERPFNGLENDTRANSFORMFEEDBACKPROC)&RecordingTableDecorator::m_glEndTransformFeedback_recording;
+if(this->m_ptr_glDrawCommandsStatesAddressNV)this->m_ptr_glDrawCommandsStatesAddressNV = (FunctionTable::MEMBERPFNGLDRAWCOMMANDSSTATESADDRESSNVPROC)&RecordingTableDecorator::m_glDrawCommandsStatesAddressNV_recording;
+if(this->m_ptr_glUniform4ui64NV)this->m_ptr_glUniform4ui64NV = (FunctionTable::MEMBERPFNGLUNIFORM4UI64NVPROC)&RecordingTableDecorator::m_glUniform4ui64NV_recording;
+if(this->m_ptr_glMaterialiv)this->m_ptr_glMaterialiv = (FunctionTable::MEMBERPFNGLMATERIALIVPROC)&RecordingTableDecorator::m_glMaterialiv_recording;
+if(this->m_ptr_glTexImage2DMultisample)this->m_ptr_glTexImage2DMultisample = (FunctionTable::MEMBERPFNGLTEXIMAGE2DMULTISAMPLEPROC)&RecordingTableDecorator::m_glTexImage2DMultisample_recording;
+if(this->m_ptr_glBindTextureEXT)this->m_ptr_glBindTextureEXT = (FunctionTable::MEMBERPFNGLBINDTEXTUREEXTPROC)&RecordingTableDecorator::m_glBindTextureEXT_recording;
+if(this->m_ptr_glIsBuffer)this->m_ptr_glIsBuffer = (FunctionTable::MEMBERPFNGLISBUFFERPROC)&RecordingTableDecorator::m_glIsBuffer_recording;
+if(this->m_ptr_glVertexAttribI1iv)this->m_ptr_glVertexAttribI1iv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI1IVPROC)&RecordingTableDecorator::m_glVertexAttribI1iv_recording;
+if(this->m_ptr_glGetFinalCombinerInputParameterfvNV)this->m_ptr_glGetFinalCombinerInputParameterfvNV = (FunctionTable::MEMBERPFNGLGETFINALCOMBINERINPUTPARAMETERFVNVPROC)&RecordingTableDecorator::m_glGetFinalCombinerInputParameterfvNV_recording;
+if(this->m_ptr_glMultiTexCoord3bvOES)this->m_ptr_glMultiTexCoord3bvOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3BVOESPROC)&RecordingTableDecorator::m_glMultiTexCoord3bvOES_recording;
+if(this->m_ptr_glVertexAttribDivisor)this->m_ptr_glVertexAttribDivisor = (FunctionTable::MEMBERPFNGLVERTEXATTRIBDIVISORPROC)&RecordingTableDecorator::m_glVertexAttribDivisor_recording;
+if(this->m_ptr_glCopyBufferSubData)this->m_ptr_glCopyBufferSubData = (FunctionTable::MEMBERPFNGLCOPYBUFFERSUBDATAPROC)&RecordingTableDecorator::m_glCopyBufferSubData_recording;
+if(this->m_ptr_glBindTexGenParameterEXT)this->m_ptr_glBindTexGenParameterEXT = (FunctionTable::MEMBERPFNGLBINDTEXGENPARAMETEREXTPROC)&RecordingTableDecorator::m_glBindTexGenParameterEXT_recording;
+if(this->m_ptr_glNormalStream3bATI)this->m_ptr_glNormalStream3bATI = (FunctionTable::MEMBERPFNGLNORMALSTREAM3BATIPROC)&RecordingTableDecorator::m_glNormalStream3bATI_recording;
+if(this->m_ptr_glTextureImage2DEXT)this->m_ptr_glTextureImage2DEXT = (FunctionTable::MEMBERPFNGLTEXTUREIMAGE2DEXTPROC)&RecordingTableDecorator::m_glTextureImage2DEXT_recording;
+if(this->m_ptr_glGetColorTableParameteriv)this->m_ptr_glGetColorTableParameteriv = (FunctionTable::MEMBERPFNGLGETCOLORTABLEPARAMETERIVPROC)&RecordingTableDecorator::m_glGetColorTableParameteriv_recording;
+if(this->m_ptr_glActiveTextureARB)this->m_ptr_glActiveTextureARB = (FunctionTable::MEMBERPFNGLACTIVETEXTUREARBPROC)&RecordingTableDecorator::m_glActiveTextureARB_recording;
+if(this->m_ptr_glTexCoord4xOES)this->m_ptr_glTexCoord4xOES = (FunctionTable::MEMBERPFNGLTEXCOORD4XOESPROC)&RecordingTableDecorator::m_glTexCoord4xOES_recording;
+if(this->m_ptr_glSecondaryColor3fvEXT)this->m_ptr_glSecondaryColor3fvEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3FVEXTPROC)&RecordingTableDecorator::m_glSecondaryColor3fvEXT_recording;
+if(this->m_ptr_glUniformMatrix4x2fv)this->m_ptr_glUniformMatrix4x2fv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX4X2FVPROC)&RecordingTableDecorator::m_glUniformMatrix4x2fv_recording;
+if(this->m_ptr_glStartInstrumentsSGIX)this->m_ptr_glStartInstrumentsSGIX = (FunctionTable::MEMBERPFNGLSTARTINSTRUMENTSSGIXPROC)&RecordingTableDecorator::m_glStartInstrumentsSGIX_recording;
+if(this->m_ptr_glProgramNamedParameter4fvNV)this->m_ptr_glProgramNamedParameter4fvNV = (FunctionTable::MEMBERPFNGLPROGRAMNAMEDPARAMETER4FVNVPROC)&RecordingTableDecorator::m_glProgramNamedParameter4fvNV_recording;
+if(this->m_ptr_glEndVideoCaptureNV)this->m_ptr_glEndVideoCaptureNV = (FunctionTable::MEMBERPFNGLENDVIDEOCAPTURENVPROC)&RecordingTableDecorator::m_glEndVideoCaptureNV_recording;
+if(this->m_ptr_glGenLists)this->m_ptr_glGenLists = (FunctionTable::MEMBERPFNGLGENLISTSPROC)&RecordingTableDecorator::m_glGenLists_recording;
+if(this->m_ptr_glUniform1fARB)this->m_ptr_glUniform1fARB = (FunctionTable::MEMBERPFNGLUNIFORM1FARBPROC)&RecordingTableDecorator::m_glUniform1fARB_recording;
+if(this->m_ptr_glNamedFramebufferTexture1DEXT)this->m_ptr_glNamedFramebufferTexture1DEXT = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTURE1DEXTPROC)&RecordingTableDecorator::m_glNamedFramebufferTexture1DEXT_recording;
+if(this->m_ptr_glMapBufferRange)this->m_ptr_glMapBufferRange = (FunctionTable::MEMBERPFNGLMAPBUFFERRANGEPROC)&RecordingTableDecorator::m_glMapBufferRange_recording;
+if(this->m_ptr_glMultiDrawElementsIndirectCountARB)this->m_ptr_glMultiDrawElementsIndirectCountARB = (FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSINDIRECTCOUNTARBPROC)&RecordingTableDecorator::m_glMultiDrawElementsIndirectCountARB_recording;
+if(this->m_ptr_glProgramUniformMatrix4x2fv)this->m_ptr_glProgramUniformMatrix4x2fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X2FVPROC)&RecordingTableDecorator::m_glProgramUniformMatrix4x2fv_recording;
+if(this->m_ptr_glGetTextureParameterIivEXT)this->m_ptr_glGetTextureParameterIivEXT = (FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERIIVEXTPROC)&RecordingTableDecorator::m_glGetTextureParameterIivEXT_recording;
+if(this->m_ptr_glMultiTexCoord3hNV)this->m_ptr_glMultiTexCoord3hNV = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3HNVPROC)&RecordingTableDecorator::m_glMultiTexCoord3hNV_recording;
+if(this->m_ptr_glNamedProgramLocalParametersI4uivEXT)this->m_ptr_glNamedProgramLocalParametersI4uivEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERSI4UIVEXTPROC)&RecordingTableDecorator::m_glNamedProgramLocalParametersI4uivEXT_recording;
+if(this->m_ptr_glEndList)this->m_ptr_glEndList = (FunctionTable::MEMBERPFNGLENDLISTPROC)&RecordingTableDecorator::m_glEndList_recording;
+if(this->m_ptr_glTexCoord2fColor4fNormal3fVertex3fSUN)this->m_ptr_glTexCoord2fColor4fNormal3fVertex3fSUN = (FunctionTable::MEMBERPFNGLTEXCOORD2FCOLOR4FNORMAL3FVERTEX3FSUNPROC)&RecordingTableDecorator::m_glTexCoord2fColor4fNormal3fVertex3fSUN_recording;
+if(this->m_ptr_glGenTransformFeedbacksNV)this->m_ptr_glGenTransformFeedbacksNV = (FunctionTable::MEMBERPFNGLGENTRANSFORMFEEDBACKSNVPROC)&RecordingTableDecorator::m_glGenTransformFeedbacksNV_recording;
+if(this->m_ptr_glEdgeFlagv)this->m_ptr_glEdgeFlagv = (FunctionTable::MEMBERPFNGLEDGEFLAGVPROC)&RecordingTableDecorator::m_glEdgeFlagv_recording;
+if(this->m_ptr_glVertexAttribI2iv)this->m_ptr_glVertexAttribI2iv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI2IVPROC)&RecordingTableDecorator::m_glVertexAttribI2iv_recording;
+if(this->m_ptr_glCopyMultiTexImage2DEXT)this->m_ptr_glCopyMultiTexImage2DEXT = (FunctionTable::MEMBERPFNGLCOPYMULTITEXIMAGE2DEXTPROC)&RecordingTableDecorator::m_glCopyMultiTexImage2DEXT_recording;
+if(this->m_ptr_glUniformMatrix3x2dv)this->m_ptr_glUniformMatrix3x2dv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX3X2DVPROC)&RecordingTableDecorator::m_glUniformMatrix3x2dv_recording;
+if(this->m_ptr_glTexImage3DMultisampleCoverageNV)this->m_ptr_glTexImage3DMultisampleCoverageNV = (FunctionTable::MEMBERPFNGLTEXIMAGE3DMULTISAMPLECOVERAGENVPROC)&RecordingTableDecorator::m_glTexImage3DMultisampleCoverageNV_recording;
+if(this->m_ptr_glGetShaderPrecisionFormat)this->m_ptr_glGetShaderPrecisionFormat = (FunctionTable::MEMBERPFNGLGETSHADERPRECISIONFORMATPROC)&RecordingTableDecorator::m_glGetShaderPrecisionFormat_recording;
+if(this->m_ptr_glTexSubImage4DSGIS)this->m_ptr_glTexSubImage4DSGIS = (FunctionTable::MEMBERPFNGLTEXSUBIMAGE4DSGISPROC)&RecordingTableDecorator::m_glTexSubImage4DSGIS_recording;
+if(this->m_ptr_glRasterSamplesEXT)this->m_ptr_glRasterSamplesEXT = (FunctionTable::MEMBERPFNGLRASTERSAMPLESEXTPROC)&RecordingTableDecorator::m_glRasterSamplesEXT_recording;
+if(this->m_ptr_glTextureView)this->m_ptr_glTextureView = (FunctionTable::MEMBERPFNGLTEXTUREVIEWPROC)&RecordingTableDecorator::m_glTextureView_recording;
+if(this->m_ptr_glEvalMapsNV)this->m_ptr_glEvalMapsNV = (FunctionTable::MEMBERPFNGLEVALMAPSNVPROC)&RecordingTableDecorator::m_glEvalMapsNV_recording;
+if(this->m_ptr_glGetFragDataLocationEXT)this->m_ptr_glGetFragDataLocationEXT = (FunctionTable::MEMBERPFNGLGETFRAGDATALOCATIONEXTPROC)&RecordingTableDecorator::m_glGetFragDataLocationEXT_recording;
+if(this->m_ptr_glGetCompressedMultiTexImageEXT)this->m_ptr_glGetCompressedMultiTexImageEXT = (FunctionTable::MEMBERPFNGLGETCOMPRESSEDMULTITEXIMAGEEXTPROC)&RecordingTableDecorator::m_glGetCompressedMultiTexImageEXT_recording;
+if(this->m_ptr_glIndexMask)this->m_ptr_glIndexMask = (FunctionTable::MEMBERPFNGLINDEXMASKPROC)&RecordingTableDecorator::m_glIndexMask_recording;
+if(this->m_ptr_glPushClientAttrib)this->m_ptr_glPushClientAttrib = (FunctionTable::MEMBERPFNGLPUSHCLIENTATTRIBPROC)&RecordingTableDecorator::m_glPushClientAttrib_recording;
+if(this->m_ptr_glShaderSource)this->m_ptr_glShaderSource = (FunctionTable::MEMBERPFNGLSHADERSOURCEPROC)&RecordingTableDecorator::m_glShaderSource_recording;
+if(this->m_ptr_glDispatchComputeGroupSizeARB)this->m_ptr_glDispatchComputeGroupSizeARB = (FunctionTable::MEMBERPFNGLDISPATCHCOMPUTEGROUPSIZEARBPROC)&RecordingTableDecorator::m_glDispatchComputeGroupSizeARB_recording;
+if(this->m_ptr_glGetnPixelMapfv)this->m_ptr_glGetnPixelMapfv = (FunctionTable::MEMBERPFNGLGETNPIXELMAPFVPROC)&RecordingTableDecorator::m_glGetnPixelMapfv_recording;
+if(this->m_ptr_glTexCoordP2uiv)this->m_ptr_glTexCoordP2uiv = (FunctionTable::MEMBERPFNGLTEXCOORDP2UIVPROC)&RecordingTableDecorator::m_glTexCoordP2uiv_recording;
+if(this->m_ptr_glUniform2f)this->m_ptr_glUniform2f = (FunctionTable::MEMBERPFNGLUNIFORM2FPROC)&RecordingTableDecorator::m_glUniform2f_recording;
+if(this->m_ptr_glGetNamedBufferParameteri64v)this->m_ptr_glGetNamedBufferParameteri64v = (FunctionTable::MEMBERPFNGLGETNAMEDBUFFERPARAMETERI64VPROC)&RecordingTableDecorator::m_glGetNamedBufferParameteri64v_recording;
+if(this->m_ptr_glCommandListSegmentsNV)this->m_ptr_glCommandListSegmentsNV = (FunctionTable::MEMBERPFNGLCOMMANDLISTSEGMENTSNVPROC)&RecordingTableDecorator::m_glCommandListSegmentsNV_recording;
+if(this->m_ptr_glTextureParameterIivEXT)this->m_ptr_glTextureParameterIivEXT = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIIVEXTPROC)&RecordingTableDecorator::m_glTextureParameterIivEXT_recording;
+if(this->m_ptr_glMultiTexParameterfvEXT)this->m_ptr_glMultiTexParameterfvEXT = (FunctionTable::MEMBERPFNGLMULTITEXPARAMETERFVEXTPROC)&RecordingTableDecorator::m_glMultiTexParameterfvEXT_recording;
+if(this->m_ptr_glProgramUniform2ui64ARB)this->m_ptr_glProgramUniform2ui64ARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UI64ARBPROC)&RecordingTableDecorator::m_glProgramUniform2ui64ARB_recording;
+if(this->m_ptr_glVertex4d)this->m_ptr_glVertex4d = (FunctionTable::MEMBERPFNGLVERTEX4DPROC)&RecordingTableDecorator::m_glVertex4d_recording;
+if(this->m_ptr_glNewObjectBufferATI)this->m_ptr_glNewObjectBufferATI = (FunctionTable::MEMBERPFNGLNEWOBJECTBUFFERATIPROC)&RecordingTableDecorator::m_glNewObjectBufferATI_recording;
+if(this->m_ptr_glViewportSwizzleNV)this->m_ptr_glViewportSwizzleNV = (FunctionTable::MEMBERPFNGLVIEWPORTSWIZZLENVPROC)&RecordingTableDecorator::m_glViewportSwizzleNV_recording;
+if(this->m_ptr_glBufferData)this->m_ptr_glBufferData = (FunctionTable::MEMBERPFNGLBUFFERDATAPROC)&RecordingTableDecorator::m_glBufferData_recording;
+if(this->m_ptr_glTextureImage1DEXT)this->m_ptr_glTextureImage1DEXT = (FunctionTable::MEMBERPFNGLTEXTUREIMAGE1DEXTPROC)&RecordingTableDecorator::m_glTextureImage1DEXT_recording;
+if(this->m_ptr_glGetTexParameterIiv)this->m_ptr_glGetTexParameterIiv = (FunctionTable::MEMBERPFNGLGETTEXPARAMETERIIVPROC)&RecordingTableDecorator::m_glGetTexParameterIiv_recording;
+if(this->m_ptr_glCopyTexSubImage1DEXT)this->m_ptr_glCopyTexSubImage1DEXT = (FunctionTable::MEMBERPFNGLCOPYTEXSUBIMAGE1DEXTPROC)&RecordingTableDecorator::m_glCopyTexSubImage1DEXT_recording;
+if(this->m_ptr_glVertex4f)this->m_ptr_glVertex4f = (FunctionTable::MEMBERPFNGLVERTEX4FPROC)&RecordingTableDecorator::m_glVertex4f_recording;
+if(this->m_ptr_glUniformMatrix3fvARB)this->m_ptr_glUniformMatrix3fvARB = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX3FVARBPROC)&RecordingTableDecorator::m_glUniformMatrix3fvARB_recording;
+if(this->m_ptr_glTexCoordP1ui)this->m_ptr_glTexCoordP1ui = (FunctionTable::MEMBERPFNGLTEXCOORDP1UIPROC)&RecordingTableDecorator::m_glTexCoordP1ui_recording;
+if(this->m_ptr_glPointParameterfvEXT)this->m_ptr_glPointParameterfvEXT = (FunctionTable::MEMBERPFNGLPOINTPARAMETERFVEXTPROC)&RecordingTableDecorator::m_glPointParameterfvEXT_recording;
+if(this->m_ptr_glUniform4fARB)this->m_ptr_glUniform4fARB = (FunctionTable::MEMBERPFNGLUNIFORM4FARBPROC)&RecordingTableDecorator::m_glUniform4fARB_recording;
+if(this->m_ptr_glCopyTextureSubImage3D)this->m_ptr_glCopyTextureSubImage3D = (FunctionTable::MEMBERPFNGLCOPYTEXTURESUBIMAGE3DPROC)&RecordingTableDecorator::m_glCopyTextureSubImage3D_recording;
+if(this->m_ptr_glMultiTexCoord2fv)this->m_ptr_glMultiTexCoord2fv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2FVPROC)&RecordingTableDecorator::m_glMultiTexCoord2fv_recording;
+if(this->m_ptr_glMultiTexEnvfvEXT)this->m_ptr_glMultiTexEnvfvEXT = (FunctionTable::MEMBERPFNGLMULTITEXENVFVEXTPROC)&RecordingTableDecorator::m_glMultiTexEnvfvEXT_recording;
+if(this->m_ptr_glNormalP3ui)this->m_ptr_glNormalP3ui = (FunctionTable::MEMBERPFNGLNORMALP3UIPROC)&RecordingTableDecorator::m_glNormalP3ui_recording;
+if(this->m_ptr_glDrawRangeElementArrayATI)this->m_ptr_glDrawRangeElementArrayATI = (FunctionTable::MEMBERPFNGLDRAWRANGEELEMENTARRAYATIPROC)&RecordingTableDecorator::m_glDrawRangeElementArrayATI_recording;
+if(this->m_ptr_glVertexAttribI1i)this->m_ptr_glVertexAttribI1i = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI1IPROC)&RecordingTableDecorator::m_glVertexAttribI1i_recording;
+if(this->m_ptr_glDrawArraysInstancedARB)this->m_ptr_glDrawArraysInstancedARB = (FunctionTable::MEMBERPFNGLDRAWARRAYSINSTANCEDARBPROC)&RecordingTableDecorator::m_glDrawArraysInstancedARB_recording;
+if(this->m_ptr_glEnableVertexAttribAPPLE)this->m_ptr_glEnableVertexAttribAPPLE = (FunctionTable::MEMBERPFNGLENABLEVERTEXATTRIBAPPLEPROC)&RecordingTableDecorator::m_glEnableVertexAttribAPPLE_recording;
+if(this->m_ptr_glGetDebugMessageLogARB)this->m_ptr_glGetDebugMessageLogARB = (FunctionTable::MEMBERPFNGLGETDEBUGMESSAGELOGARBPROC)&RecordingTableDecorator::m_glGetDebugMessageLogARB_recording;
+if(this->m_ptr_glGetPathTexGenfvNV)this->m_ptr_glGetPathTexGenfvNV = (FunctionTable::MEMBERPFNGLGETPATHTEXGENFVNVPROC)&RecordingTableDecorator::m_glGetPathTexGenfvNV_recording;
+if(this->m_ptr_glNamedProgramLocalParameters4fvEXT)this->m_ptr_glNamedProgramLocalParameters4fvEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERS4FVEXTPROC)&RecordingTableDecorator::m_glNamedProgramLocalParameters4fvEXT_recording;
+if(this->m_ptr_glVertexStream3fvATI)this->m_ptr_glVertexStream3fvATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM3FVATIPROC)&RecordingTableDecorator::m_glVertexStream3fvATI_recording;
+if(this->m_ptr_glFramebufferTexture3D)this->m_ptr_glFramebufferTexture3D = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURE3DPROC)&RecordingTableDecorator::m_glFramebufferTexture3D_recording;
+if(this->m_ptr_glCompressedTextureSubImage2DEXT)this->m_ptr_glCompressedTextureSubImage2DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTURESUBIMAGE2DEXTPROC)&RecordingTableDecorator::m_glCompressedTextureSubImage2DEXT_recording;
+if(this->m_ptr_glWindowPos3dv)this->m_ptr_glWindowPos3dv = (FunctionTable::MEMBERPFNGLWINDOWPOS3DVPROC)&RecordingTableDecorator::m_glWindowPos3dv_recording;
+if(this->m_ptr_glCopyConvolutionFilter2D)this->m_ptr_glCopyConvolutionFilter2D = (FunctionTable::MEMBERPFNGLCOPYCONVOLUTIONFILTER2DPROC)&RecordingTableDecorator::m_glCopyConvolutionFilter2D_recording;
+if(this->m_ptr_glReadInstrumentsSGIX)this->m_ptr_glReadInstrumentsSGIX = (FunctionTable::MEMBERPFNGLREADINSTRUMENTSSGIXPROC)&RecordingTableDecorator::m_glReadInstrumentsSGIX_recording;
+if(this->m_ptr_glSamplerParameterfv)this->m_ptr_glSamplerParameterfv = (FunctionTable::MEMBERPFNGLSAMPLERPARAMETERFVPROC)&RecordingTableDecorator::m_glSamplerParameterfv_recording;
+if(this->m_ptr_glBindBufferARB)this->m_ptr_glBindBufferARB = (FunctionTable::MEMBERPFNGLBINDBUFFERARBPROC)&RecordingTableDecorator::m_glBindBufferARB_recording;
+if(this->m_ptr_glVertexAttrib1sNV)this->m_ptr_glVertexAttrib1sNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1SNVPROC)&RecordingTableDecorator::m_glVertexAttrib1sNV_recording;
+if(this->m_ptr_glGetMaterialiv)this->m_ptr_glGetMaterialiv = (FunctionTable::MEMBERPFNGLGETMATERIALIVPROC)&RecordingTableDecorator::m_glGetMaterialiv_recording;
+if(this->m_ptr_glUniform1fv)this->m_ptr_glUniform1fv = (FunctionTable::MEMBERPFNGLUNIFORM1FVPROC)&RecordingTableDecorator::m_glUniform1fv_recording;
+if(this->m_ptr_glBeginOcclusionQueryNV)this->m_ptr_glBeginOcclusionQueryNV = (FunctionTable::MEMBERPFNGLBEGINOCCLUSIONQUERYNVPROC)&RecordingTableDecorator::m_glBeginOcclusionQueryNV_recording;
+if(this->m_ptr_glGenFencesAPPLE)this->m_ptr_glGenFencesAPPLE = (FunctionTable::MEMBERPFNGLGENFENCESAPPLEPROC)&RecordingTableDecorator::m_glGenFencesAPPLE_recording;
+if(this->m_ptr_glScissorIndexedv)this->m_ptr_glScissorIndexedv = (FunctionTable::MEMBERPFNGLSCISSORINDEXEDVPROC)&RecordingTableDecorator::m_glScissorIndexedv_recording;
+if(this->m_ptr_glDisableVariantClientStateEXT)this->m_ptr_glDisableVariantClientStateEXT = (FunctionTable::MEMBERPFNGLDISABLEVARIANTCLIENTSTATEEXTPROC)&RecordingTableDecorator::m_glDisableVariantClientStateEXT_recording;
+if(this->m_ptr_glMinmaxEXT)this->m_ptr_glMinmaxEXT = (FunctionTable::MEMBERPFNGLMINMAXEXTPROC)&RecordingTableDecorator::m_glMinmaxEXT_recording;
+if(this->m_ptr_glNormalPointervINTEL)this->m_ptr_glNormalPointervINTEL = (FunctionTable::MEMBERPFNGLNORMALPOINTERVINTELPROC)&RecordingTableDecorator::m_glNormalPointervINTEL_recording;
+if(this->m_ptr_glNormal3s)this->m_ptr_glNormal3s = (FunctionTable::MEMBERPFNGLNORMAL3SPROC)&RecordingTableDecorator::m_glNormal3s_recording;
+if(this->m_ptr_glGetnPixelMapuiv)this->m_ptr_glGetnPixelMapuiv = (FunctionTable::MEMBERPFNGLGETNPIXELMAPUIVPROC)&RecordingTableDecorator::m_glGetnPixelMapuiv_recording;
+if(this->m_ptr_glNormalStream3bvATI)this->m_ptr_glNormalStream3bvATI = (FunctionTable::MEMBERPFNGLNORMALSTREAM3BVATIPROC)&RecordingTableDecorator::m_glNormalStream3bvATI_recording;
+if(this->m_ptr_glGetObjectParameterivAPPLE)this->m_ptr_glGetObjectParameterivAPPLE = (FunctionTable::MEMBERPFNGLGETOBJECTPARAMETERIVAPPLEPROC)&RecordingTableDecorator::m_glGetObjectParameterivAPPLE_recording;
+if(this->m_ptr_glNormal3i)this->m_ptr_glNormal3i = (FunctionTable::MEMBERPFNGLNORMAL3IPROC)&RecordingTableDecorator::m_glNormal3i_recording;
+if(this->m_ptr_glUniform1ivARB)this->m_ptr_glUniform1ivARB = (FunctionTable::MEMBERPFNGLUNIFORM1IVARBPROC)&RecordingTableDecorator::m_glUniform1ivARB_recording;
+if(this->m_ptr_glNormal3d)this->m_ptr_glNormal3d = (FunctionTable::MEMBERPFNGLNORMAL3DPROC)&RecordingTableDecorator::m_glNormal3d_recording;
+if(this->m_ptr_glUpdateObjectBufferATI)this->m_ptr_glUpdateObjectBufferATI = (FunctionTable::MEMBERPFNGLUPDATEOBJECTBUFFERATIPROC)&RecordingTableDecorator::m_glUpdateObjectBufferATI_recording;
+if(this->m_ptr_glNormal3b)this->m_ptr_glNormal3b = (FunctionTable::MEMBERPFNGLNORMAL3BPROC)&RecordingTableDecorator::m_glNormal3b_recording;
+if(this->m_ptr_glGetUniformBufferSizeEXT)this->m_ptr_glGetUniformBufferSizeEXT = (FunctionTable::MEMBERPFNGLGETUNIFORMBUFFERSIZEEXTPROC)&RecordingTableDecorator::m_glGetUniformBufferSizeEXT_recording;
+if(this->m_ptr_glMultiTexCoord4dv)this->m_ptr_glMultiTexCoord4dv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4DVPROC)&RecordingTableDecorator::m_glMultiTexCoord4dv_recording;
+if(this->m_ptr_glProgramUniform3i64ARB)this->m_ptr_glProgramUniform3i64ARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3I64ARBPROC)&RecordingTableDecorator::m_glProgramUniform3i64ARB_recording;
+if(this->m_ptr_glVertexAttrib2d)this->m_ptr_glVertexAttrib2d = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2DPROC)&RecordingTableDecorator::m_glVertexAttrib2d_recording;
+if(this->m_ptr_glVertexAttrib2f)this->m_ptr_glVertexAttrib2f = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2FPROC)&RecordingTableDecorator::m_glVertexAttrib2f_recording;
+if(this->m_ptr_glMultiDrawElementsEXT)this->m_ptr_glMultiDrawElementsEXT = (FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSEXTPROC)&RecordingTableDecorator::m_glMultiDrawElementsEXT_recording;
+if(this->m_ptr_glVertexAttrib3dv)this->m_ptr_glVertexAttrib3dv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3DVPROC)&RecordingTableDecorator::m_glVertexAttrib3dv_recording;
+if(this->m_ptr_glMultiTexCoord2bOES)this->m_ptr_glMultiTexCoord2bOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2BOESPROC)&RecordingTableDecorator::m_glMultiTexCoord2bOES_recording;
+if(this->m_ptr_glVertexAttrib2s)this->m_ptr_glVertexAttrib2s = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2SPROC)&RecordingTableDecorator::m_glVertexAttrib2s_recording;
+if(this->m_ptr_glTexImage3DMultisample)this->m_ptr_glTexImage3DMultisample = (FunctionTable::MEMBERPFNGLTEXIMAGE3DMULTISAMPLEPROC)&RecordingTableDecorator::m_glTexImage3DMultisample_recording;
+if(this->m_ptr_glGetUniformBlockIndex)this->m_ptr_glGetUniformBlockIndex = (FunctionTable::MEMBERPFNGLGETUNIFORMBLOCKINDEXPROC)&RecordingTableDecorator::m_glGetUniformBlockIndex_recording;
+if(this->m_ptr_glFrontFace)this->m_ptr_glFrontFace = (FunctionTable::MEMBERPFNGLFRONTFACEPROC)&RecordingTableDecorator::m_glFrontFace_recording;
+if(this->m_ptr_glEvalCoord1xOES)this->m_ptr_glEvalCoord1xOES = (FunctionTable::MEMBERPFNGLEVALCOORD1XOESPROC)&RecordingTableDecorator::m_glEvalCoord1xOES_recording;
+if(this->m_ptr_glDrawArraysInstancedBaseInstance)this->m_ptr_glDrawArraysInstancedBaseInstance = (FunctionTable::MEMBERPFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC)&RecordingTableDecorator::m_glDrawArraysInstancedBaseInstance_recording;
+if(this->m_ptr_glIsPointInStrokePathNV)this->m_ptr_glIsPointInStrokePathNV = (FunctionTable::MEMBERPFNGLISPOINTINSTROKEPATHNVPROC)&RecordingTableDecorator::m_glIsPointInStrokePathNV_recording;
@@ -0,0 +1,5713 @@
+static void replay_glMultiDrawArraysIndirectBindlessCountNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<const void*>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.value<GLsizei>();auto const a5=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glMultiDrawArraysIndirectBindlessCountNV(a0,a1,a2,a3,a4,a5);}
+static void replay_glTextureParameterfv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glTextureParameterfv(a0,a1,a2);}
+static void replay_glGetListParameterivSGIX(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetListParameterivSGIX(a0,a1,a2);}
+static void replay_glProgramUniform1i64ARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint64>();if(replayer.isCorrupted())return;gl.glProgramUniform1i64ARB(a0,a1,a2);}
+static void replay_glVertexArrayElementBuffer(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glVertexArrayElementBuffer(a0,a1);}
+static void replay_glHintPGI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glHintPGI(a0,a1);}
+static void replay_glStencilMaskSeparate(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glStencilMaskSeparate(a0,a1);}
+static void replay_glGetFramebufferAttachmentParameterivEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetFramebufferAttachmentParameterivEXT(a0,a1,a2,a3);}
+static void replay_glTextureStorage3DMultisample(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.value<GLsizei>();auto const a5=replayer.value<GLsizei>();auto const a6=replayer.value<GLboolean>();if(replayer.isCorrupted())return;gl.glTextureStorage3DMultisample(a0,a1,a2,a3,a4,a5,a6);}
+static void replay_glGetIntegerIndexedvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetIntegerIndexedvEXT(a0,a1,a2);}
+static void replay_glCopyTexImage1D(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLint>();auto const a5=replayer.value<GLsizei>();auto const a6=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glCopyTexImage1D(a0,a1,a2,a3,a4,a5,a6);}
+static void replay_glVertexAttrib4usv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLushort*>();if(replayer.isCorrupted())return;gl.glVertexAttrib4usv(a0,a1);}
+static void replay_glTexRenderbufferNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glTexRenderbufferNV(a0,a1);}
+static void replay_glVertexAttrib3hvNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLhalfNV*>();if(replayer.isCorrupted())return;gl.glVertexAttrib3hvNV(a0,a1);}
+static void replay_glProgramUniform4ui64ARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLuint64>();auto const a3=replayer.value<GLuint64>();auto const a4=replayer.value<GLuint64>();auto const a5=replayer.value<GLuint64>();if(replayer.isCorrupted())return;gl.glProgramUniform4ui64ARB(a0,a1,a2,a3,a4,a5);}
+static void replay_glInstrumentsBufferSGIX(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glInstrumentsBufferSGIX(a0,a1);}
+static void replay_glIndexi(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glIndexi(a0);}
+static void replay_glMultiTexCoord2sARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLshort>();auto const a2=replayer.value<GLshort>();if(replayer.isCorrupted())return;gl.glMultiTexCoord2sARB(a0,a1,a2);}
+static void replay_glProgramEnvParameter4fARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLfloat>();auto const a3=replayer.value<GLfloat>();auto const a4=replayer.value<GLfloat>();auto const a5=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glProgramEnvParameter4fARB(a0,a1,a2,a3,a4,a5);}
+static void replay_glCompressedTexSubImage3D(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLint>();auto const a5=replayer.value<GLsizei>();auto const a6=replayer.value<GLsizei>();auto const a7=replayer.value<GLsizei>();auto const a8=replayer.value<GLenum>();auto const a9=replayer.value<GLsizei>();auto const a10=replayer.pixels<const GLvoid*>();if(replayer.isCorrupted())return;gl.glCompressedTexSubImage3D(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10);}
+static void replay_glEvalCoord2d(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLdouble>();auto const a1=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glEvalCoord2d(a0,a1);}
+static void replay_glEvalCoord2f(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfloat>();auto const a1=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glEvalCoord2f(a0,a1);}
+static void replay_glIndexd(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glIndexd(a0);}
+static void replay_glSecondaryColor3hvNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLhalfNV*>();if(replayer.isCorrupted())return;gl.glSecondaryColor3hvNV(a0);}
+static void replay_glIndexf(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glIndexf(a0);}
+static void replay_glFrustumxOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfixed>();auto const a1=replayer.value<GLfixed>();auto const a2=replayer.value<GLfixed>();auto const a3=replayer.value<GLfixed>();auto const a4=replayer.value<GLfixed>();auto const a5=replayer.value<GLfixed>();if(replayer.isCorrupted())return;gl.glFrustumxOES(a0,a1,a2,a3,a4,a5);}
+static void replay_glTextureStorage3DEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLenum>();auto const a4=replayer.value<GLsizei>();auto const a5=replayer.value<GLsizei>();auto const a6=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glTextureStorage3DEXT(a0,a1,a2,a3,a4,a5,a6);}
+static void replay_glDrawCommandsStatesNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLintptr*>();auto const a2=replayer.data<const GLsizei*>();auto const a3=replayer.data<const GLuint*>();auto const a4=replayer.data<const GLuint*>();auto const a5=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glDrawCommandsStatesNV(a0,a1,a2,a3,a4,a5);}
+static void replay_glUniform4uiEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<GLuint>();auto const a4=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glUniform4uiEXT(a0,a1,a2,a3,a4);}
+static void replay_glProgramUniform3ui64ARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLuint64>();auto const a3=replayer.value<GLuint64>();auto const a4=replayer.value<GLuint64>();if(replayer.isCorrupted())return;gl.glProgramUniform3ui64ARB(a0,a1,a2,a3,a4);}
+static void replay_glIndexs(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLshort>();if(replayer.isCorrupted())return;gl.glIndexs(a0);}
+static void replay_glVertexArrayBindVertexBufferEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<GLintptr>();auto const a4=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glVertexArrayBindVertexBufferEXT(a0,a1,a2,a3,a4);}
+static void replay_glConvolutionParameteriEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glConvolutionParameteriEXT(a0,a1,a2);}
+static void replay_glColor4ubVertex2fSUN(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLubyte>();auto const a1=replayer.value<GLubyte>();auto const a2=replayer.value<GLubyte>();auto const a3=replayer.value<GLubyte>();auto const a4=replayer.value<GLfloat>();auto const a5=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glColor4ubVertex2fSUN(a0,a1,a2,a3,a4,a5);}
+static void replay_glProgramUniform1ivEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glProgramUniform1ivEXT(a0,a1,a2,a3);}
+static void replay_glGetnMapfv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glGetnMapfv(a0,a1,a2,a3);}
+static void replay_glTransformFeedbackBufferRange(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<GLintptr>();auto const a4=replayer.value<GLsizeiptr>();if(replayer.isCorrupted())return;gl.glTransformFeedbackBufferRange(a0,a1,a2,a3,a4);}
+static void replay_glPathGlyphsNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<const void*>();auto const a3=replayer.value<GLbitfield>();auto const a4=replayer.value<GLsizei>();auto const a5=replayer.value<GLenum>();auto const a6=replayer.value<const void*>();auto const a7=replayer.value<GLenum>();auto const a8=replayer.value<GLuint>();auto const a9=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glPathGlyphsNV(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}
+static void replay_glSecondaryColor3fv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glSecondaryColor3fv(a0);}
+static void replay_glGetCombinerInputParameterivNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLenum>();auto const a4=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetCombinerInputParameterivNV(a0,a1,a2,a3,a4);}
+static void replay_glEndPerfMonitorAMD(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glEndPerfMonitorAMD(a0);}
+static void replay_glPointParameterfvARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.null<const GLfloat*>();if(replayer.isCorrupted())return;gl.glPointParameterfvARB(a0,a1);}
+static void replay_glVertex2xOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfixed>();if(replayer.isCorrupted())return;gl.glVertex2xOES(a0);}
+static void replay_glDrawElementsInstancedBaseInstance(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<const void*>();auto const a4=replayer.value<GLsizei>();auto const a5=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glDrawElementsInstancedBaseInstance(a0,a1,a2,a3,a4,a5);}
+static void replay_glMultTransposeMatrixdARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glMultTransposeMatrixdARB(a0);}
+static void replay_glVertexAttribL4dEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLdouble>();auto const a2=replayer.value<GLdouble>();auto const a3=replayer.value<GLdouble>();auto const a4=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glVertexAttribL4dEXT(a0,a1,a2,a3,a4);}
+static void replay_glVertex4iv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glVertex4iv(a0);}
+static void replay_glCoverStrokePathInstancedNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<const void*>();auto const a3=replayer.value<GLuint>();auto const a4=replayer.value<GLenum>();auto const a5=replayer.value<GLenum>();auto const a6=replayer.null<const GLfloat*>();if(replayer.isCorrupted())return;gl.glCoverStrokePathInstancedNV(a0,a1,a2,a3,a4,a5,a6);}
+static void replay_glDeformSGIX(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLbitfield>();if(replayer.isCorrupted())return;gl.glDeformSGIX(a0);}
+static void replay_glUniform2ui64NV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLuint64EXT>();auto const a2=replayer.value<GLuint64EXT>();if(replayer.isCorrupted())return;gl.glUniform2ui64NV(a0,a1,a2);}
+static void replay_glCopyPathNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glCopyPathNV(a0,a1);}
+static void replay_glVertexAttribP4ui(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLboolean>();auto const a3=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glVertexAttribP4ui(a0,a1,a2,a3);}
+static void replay_glVertexAttribL2d(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLdouble>();auto const a2=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glVertexAttribL2d(a0,a1,a2);}
+static void replay_glGetMultisamplefv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glGetMultisamplefv(a0,a1,a2);}
+static void replay_glCompressedMultiTexSubImage3DEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLint>();auto const a5=replayer.value<GLint>();auto const a6=replayer.value<GLsizei>();auto const a7=replayer.value<GLsizei>();auto const a8=replayer.value<GLsizei>();auto const a9=replayer.value<GLenum>();auto const a10=replayer.value<GLsizei>();auto const a11=replayer.pixels<const void*>();if(replayer.isCorrupted())return;gl.glCompressedMultiTexSubImage3DEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11);}
+static void replay_glVDPAURegisterOutputSurfaceNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<const void*>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.null<const GLuint*>();if(replayer.isCorrupted())return;gl.glVDPAURegisterOutputSurfaceNV(a0,a1,a2,a3);}
+static void replay_glMinSampleShading(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glMinSampleShading(a0);}
+static void replay_glProgramUniform4fEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLfloat>();auto const a3=replayer.value<GLfloat>();auto const a4=replayer.value<GLfloat>();auto const a5=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glProgramUniform4fEXT(a0,a1,a2,a3,a4,a5);}
+static void replay_glCoverStrokePathNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glCoverStrokePathNV(a0,a1);}
+static void replay_glTextureImage2DMultisampleNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLsizei>();auto const a5=replayer.value<GLsizei>();auto const a6=replayer.value<GLboolean>();if(replayer.isCorrupted())return;gl.glTextureImage2DMultisampleNV(a0,a1,a2,a3,a4,a5,a6);}
+static void replay_glVertex3bOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLbyte>();auto const a1=replayer.value<GLbyte>();auto const a2=replayer.value<GLbyte>();if(replayer.isCorrupted())return;gl.glVertex3bOES(a0,a1,a2);}
+static void replay_glTessellationFactorAMD(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glTessellationFactorAMD(a0);}
+static void replay_glDebugMessageControl(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.data<const GLuint*>();auto const a5=replayer.value<GLboolean>();if(replayer.isCorrupted())return;gl.glDebugMessageControl(a0,a1,a2,a3,a4,a5);}
+static void replay_glIsObjectBufferATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glIsObjectBufferATI(a0);}
+static void replay_glPopAttrib(FunctionTable const&gl,CallReplayer&replayer){if(replayer.isCorrupted())return;gl.glPopAttrib();}
+static void replay_glProgramUniform4iEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLint>();auto const a5=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glProgramUniform4iEXT(a0,a1,a2,a3,a4,a5);}
+static void replay_glVertexAttrib4ubNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLubyte>();auto const a2=replayer.value<GLubyte>();auto const a3=replayer.value<GLubyte>();auto const a4=replayer.value<GLubyte>();if(replayer.isCorrupted())return;gl.glVertexAttrib4ubNV(a0,a1,a2,a3,a4);}
+static void replay_glColorMaterial(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glColorMaterial(a0,a1);}
+static void replay_glVertexAttrib2svARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLshort*>();if(replayer.isCorrupted())return;gl.glVertexAttrib2svARB(a0,a1);}
+static void replay_glMinSampleShadingARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glMinSampleShadingARB(a0);}
+static void replay_glColor3b(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLbyte>();auto const a1=replayer.value<GLbyte>();auto const a2=replayer.value<GLbyte>();if(replayer.isCorrupted())return;gl.glColor3b(a0,a1,a2);}
+static void replay_glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLfloat>();auto const a2=replayer.value<GLfloat>();auto const a3=replayer.value<GLfloat>();auto const a4=replayer.value<GLfloat>();auto const a5=replayer.value<GLfloat>();auto const a6=replayer.value<GLfloat>();auto const a7=replayer.value<GLfloat>();auto const a8=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN(a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+static void replay_glColor3f(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfloat>();auto const a1=replayer.value<GLfloat>();auto const a2=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glColor3f(a0,a1,a2);}
+static void replay_glVDPAUGetSurfaceivNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLvdpauSurfaceNV>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.output<GLsizei*>();auto const a4=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glVDPAUGetSurfaceivNV(a0,a1,a2,a3,a4);}
+static void replay_glColor3d(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLdouble>();auto const a1=replayer.value<GLdouble>();auto const a2=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glColor3d(a0,a1,a2);}
+static void replay_glGetnMapiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetnMapiv(a0,a1,a2,a3);}
+static void replay_glColor3i(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glColor3i(a0,a1,a2);}
+static void replay_glGetInternalformatSampleivNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLenum>();auto const a4=replayer.value<GLsizei>();auto const a5=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetInternalformatSampleivNV(a0,a1,a2,a3,a4,a5);}
+static void replay_glVertexAttrib4ubv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLubyte*>();if(replayer.isCorrupted())return;gl.glVertexAttrib4ubv(a0,a1);}
+static void replay_glColor3s(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLshort>();auto const a1=replayer.value<GLshort>();auto const a2=replayer.value<GLshort>();if(replayer.isCorrupted())return;gl.glColor3s(a0,a1,a2);}
+static void replay_glVertexAttribs4hvNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLhalfNV*>();if(replayer.isCorrupted())return;gl.glVertexAttribs4hvNV(a0,a1,a2);}
+static void replay_glVertexAttrib4NubvARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLubyte*>();if(replayer.isCorrupted())return;gl.glVertexAttrib4NubvARB(a0,a1);}
+static void replay_glMultiTexCoord3hvNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLhalfNV*>();if(replayer.isCorrupted())return;gl.glMultiTexCoord3hvNV(a0,a1);}
+static void replay_glMatrixPushEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glMatrixPushEXT(a0);}
+static void replay_glProgramUniform2fEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLfloat>();auto const a3=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glProgramUniform2fEXT(a0,a1,a2,a3);}
+static void replay_glGetVertexArrayIndexediv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetVertexArrayIndexediv(a0,a1,a2,a3);}
+static void replay_glBlitFramebuffer(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLint>();auto const a5=replayer.value<GLint>();auto const a6=replayer.value<GLint>();auto const a7=replayer.value<GLint>();auto const a8=replayer.value<GLbitfield>();auto const a9=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glBlitFramebuffer(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}
+static void replay_glMultiTexCoordP2ui(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glMultiTexCoordP2ui(a0,a1,a2);}
+static void replay_glColorPointerListIBM(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<const void**>();auto const a4=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glColorPointerListIBM(a0,a1,a2,a3,a4);}
+static void replay_glVertexAttribL4d(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLdouble>();auto const a2=replayer.value<GLdouble>();auto const a3=replayer.value<GLdouble>();auto const a4=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glVertexAttribL4d(a0,a1,a2,a3,a4);}
+static void replay_glGetFragmentMaterialfvSGIX(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glGetFragmentMaterialfvSGIX(a0,a1,a2);}
+static void replay_glVertex2iv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glVertex2iv(a0);}
+static void replay_glGetTexEnvxvOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLfixed*>();if(replayer.isCorrupted())return;gl.glGetTexEnvxvOES(a0,a1,a2);}
+static void replay_glUniformMatrix3dv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.value<GLboolean>();auto const a3=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glUniformMatrix3dv(a0,a1,a2,a3);}
+static void replay_glGetVertexAttribLdvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLdouble*>();if(replayer.isCorrupted())return;gl.glGetVertexAttribLdvEXT(a0,a1,a2);}
+static void replay_glTexCoordP3uiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glTexCoordP3uiv(a0,a1);}
+static void replay_glDeformationMap3dSGIX(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLdouble>();auto const a2=replayer.value<GLdouble>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLint>();auto const a5=replayer.value<GLdouble>();auto const a6=replayer.value<GLdouble>();auto const a7=replayer.value<GLint>();auto const a8=replayer.value<GLint>();auto const a9=replayer.value<GLdouble>();auto const a10=replayer.value<GLdouble>();auto const a11=replayer.value<GLint>();auto const a12=replayer.value<GLint>();auto const a13=replayer.null<const GLdouble*>();if(replayer.isCorrupted())return;gl.glDeformationMap3dSGIX(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13);}
+static void replay_glResumeTransformFeedback(FunctionTable const&gl,CallReplayer&replayer){if(replayer.isCorrupted())return;gl.glResumeTransformFeedback();}
+static void replay_glInsertEventMarkerEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.data<const GLchar*>();if(replayer.isCorrupted())return;gl.glInsertEventMarkerEXT(a0,a1);}
+static void replay_glTessellationModeAMD(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glTessellationModeAMD(a0);}
+static void replay_glDrawCommandsAddressNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLuint64*>();auto const a2=replayer.data<const GLsizei*>();auto const a3=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glDrawCommandsAddressNV(a0,a1,a2,a3);}
+static void replay_glFogi(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glFogi(a0,a1);}
+static void replay_glGetTexParameterxvOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLfixed*>();if(replayer.isCorrupted())return;gl.glGetTexParameterxvOES(a0,a1,a2);}
+static void replay_glVertexPointer(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<const GLvoid*>();if(replayer.isCorrupted())return;gl.glVertexPointer(a0,a1,a2,a3);}
+static void replay_glGetPerfMonitorCounterDataAMD(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.output<GLuint*>();auto const a4=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetPerfMonitorCounterDataAMD(a0,a1,a2,a3,a4);}
+static void replay_glFogf(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glFogf(a0,a1);}
+static void replay_glMultiTexCoord1d(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glMultiTexCoord1d(a0,a1);}
+static void replay_glMultiTexCoord1f(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glMultiTexCoord1f(a0,a1);}
+static void replay_glGetMultiTexParameterivEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetMultiTexParameterivEXT(a0,a1,a2,a3);}
+static void replay_glProgramUniformMatrix3x4fvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLboolean>();auto const a4=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glProgramUniformMatrix3x4fvEXT(a0,a1,a2,a3,a4);}
+static void replay_glVertexAttribI2i(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glVertexAttribI2i(a0,a1,a2);}
+static void replay_glMultiTexCoord1i(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glMultiTexCoord1i(a0,a1);}
+static void replay_glUniform1ui64vARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLuint64*>();if(replayer.isCorrupted())return;gl.glUniform1ui64vARB(a0,a1,a2);}
+static void replay_glLoadProgramNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.null<const GLubyte*>();if(replayer.isCorrupted())return;gl.glLoadProgramNV(a0,a1,a2,a3);}
+static void replay_glWriteMaskEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLenum>();auto const a4=replayer.value<GLenum>();auto const a5=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glWriteMaskEXT(a0,a1,a2,a3,a4,a5);}
+static void replay_glGetGraphicsResetStatus(FunctionTable const&gl,CallReplayer&replayer){if(replayer.isCorrupted())return;gl.glGetGraphicsResetStatus();}
+static void replay_glVertexAttrib1fv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glVertexAttrib1fv(a0,a1);}
+static void replay_glIsEnabled(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glIsEnabled(a0);}
+static void replay_glImageTransformParameterfvHP(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.null<const GLfloat*>();if(replayer.isCorrupted())return;gl.glImageTransformParameterfvHP(a0,a1,a2);}
+static void replay_glFramebufferTexture2D(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLuint>();auto const a4=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glFramebufferTexture2D(a0,a1,a2,a3,a4);}
+static void replay_glGetFragmentLightfvSGIX(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glGetFragmentLightfvSGIX(a0,a1,a2);}
+static void replay_glListParameterfSGIX(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glListParameterfSGIX(a0,a1,a2);}
+static void replay_glTexCoord3sv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLshort*>();if(replayer.isCorrupted())return;gl.glTexCoord3sv(a0);}
+static void replay_glNamedFramebufferRenderbufferEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glNamedFramebufferRenderbufferEXT(a0,a1,a2,a3);}
+static void replay_glFragmentLightModelfSGIX(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glFragmentLightModelfSGIX(a0,a1);}
+static void replay_glIndexPointerEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<const void*>();if(replayer.isCorrupted())return;gl.glIndexPointerEXT(a0,a1,a2,a3);}
+static void replay_glBlendEquationSeparateATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glBlendEquationSeparateATI(a0,a1);}
+static void replay_glVertexArrayAttribIFormat(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLenum>();auto const a4=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glVertexArrayAttribIFormat(a0,a1,a2,a3,a4);}
+static void replay_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLfloat>();auto const a2=replayer.value<GLfloat>();auto const a3=replayer.value<GLfloat>();auto const a4=replayer.value<GLfloat>();auto const a5=replayer.value<GLfloat>();auto const a6=replayer.value<GLfloat>();auto const a7=replayer.value<GLfloat>();auto const a8=replayer.value<GLfloat>();auto const a9=replayer.value<GLfloat>();auto const a10=replayer.value<GLfloat>();auto const a11=replayer.value<GLfloat>();auto const a12=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12);}
+static void replay_glReplacementCodeubvSUN(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.null<const GLubyte*>();if(replayer.isCorrupted())return;gl.glReplacementCodeubvSUN(a0);}
+static void replay_glGenFramebuffers(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.output<GLuint*>();if(replayer.isCorrupted())return;gl.glGenFramebuffers(a0,a1);replayer.checkNames(a1);}
+static void replay_glPixelMapx(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();auto const a2=replayer.null<const GLfixed*>();if(replayer.isCorrupted())return;gl.glPixelMapx(a0,a1,a2);}
+static void replay_glTexSubImage3DEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLint>();auto const a5=replayer.value<GLsizei>();auto const a6=replayer.value<GLsizei>();auto const a7=replayer.value<GLsizei>();auto const a8=replayer.value<GLenum>();auto const a9=replayer.value<GLenum>();auto const a10=replayer.value<const void*>();if(replayer.isCorrupted())return;gl.glTexSubImage3DEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10);}
+static void replay_glGetAttachedShaders(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.output<GLsizei*>();auto const a3=replayer.output<GLuint*>();if(replayer.isCorrupted())return;gl.glGetAttachedShaders(a0,a1,a2,a3);}
+static void replay_glGetPixelTexGenParameterfvSGIS(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glGetPixelTexGenParameterfvSGIS(a0,a1);}
+static void replay_glReplacementCodeuiNormal3fVertex3fSUN(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLfloat>();auto const a2=replayer.value<GLfloat>();auto const a3=replayer.value<GLfloat>();auto const a4=replayer.value<GLfloat>();auto const a5=replayer.value<GLfloat>();auto const a6=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glReplacementCodeuiNormal3fVertex3fSUN(a0,a1,a2,a3,a4,a5,a6);}
+static void replay_glGetDebugMessageLogAMD(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.output<GLenum*>();auto const a3=replayer.output<GLuint*>();auto const a4=replayer.output<GLuint*>();auto const a5=replayer.output<GLsizei*>();auto const a6=replayer.output<GLchar*>();if(replayer.isCorrupted())return;gl.glGetDebugMessageLogAMD(a0,a1,a2,a3,a4,a5,a6);}
+static void replay_glVertexStream4sATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLshort>();auto const a2=replayer.value<GLshort>();auto const a3=replayer.value<GLshort>();auto const a4=replayer.value<GLshort>();if(replayer.isCorrupted())return;gl.glVertexStream4sATI(a0,a1,a2,a3,a4);}
+static void replay_glVertexAttribs4dvNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glVertexAttribs4dvNV(a0,a1,a2);}
+static void replay_glGetnMapdvARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.output<GLdouble*>();if(replayer.isCorrupted())return;gl.glGetnMapdvARB(a0,a1,a2,a3);}
+static void replay_glOrthofOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfloat>();auto const a1=replayer.value<GLfloat>();auto const a2=replayer.value<GLfloat>();auto const a3=replayer.value<GLfloat>();auto const a4=replayer.value<GLfloat>();auto const a5=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glOrthofOES(a0,a1,a2,a3,a4,a5);}
+static void replay_glViewportArrayv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glViewportArrayv(a0,a1,a2);}
+static void replay_glDrawElementArrayATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glDrawElementArrayATI(a0,a1);}
+static void replay_glGetPathColorGenfvNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glGetPathColorGenfvNV(a0,a1,a2);}
+static void replay_glWindowPos3iMESA(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glWindowPos3iMESA(a0,a1,a2);}
+static void replay_glMultiTexCoord2s(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLshort>();auto const a2=replayer.value<GLshort>();if(replayer.isCorrupted())return;gl.glMultiTexCoord2s(a0,a1,a2);}
+static void replay_glVertex3dv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glVertex3dv(a0);}
+static void replay_glVertexAttribI3uivEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glVertexAttribI3uivEXT(a0,a1);}
+static void replay_glUniform3ui64ARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLuint64>();auto const a2=replayer.value<GLuint64>();auto const a3=replayer.value<GLuint64>();if(replayer.isCorrupted())return;gl.glUniform3ui64ARB(a0,a1,a2,a3);}
+static void replay_glVertexAttrib2fvNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glVertexAttrib2fvNV(a0,a1);}
+static void replay_glGetNamedBufferSubDataEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLintptr>();auto const a2=replayer.value<GLsizeiptr>();auto const a3=replayer.output<void*>();if(replayer.isCorrupted())return;gl.glGetNamedBufferSubDataEXT(a0,a1,a2,a3);}
+static void replay_glConvolutionFilter2D(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.value<GLenum>();auto const a5=replayer.value<GLenum>();auto const a6=replayer.value<const GLvoid*>();if(replayer.isCorrupted())return;gl.glConvolutionFilter2D(a0,a1,a2,a3,a4,a5,a6);}
+static void replay_glMemoryBarrierByRegion(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLbitfield>();if(replayer.isCorrupted())return;gl.glMemoryBarrierByRegion(a0);}
+static void replay_glVertexArrayBindingDivisor(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glVertexArrayBindingDivisor(a0,a1,a2);}
+static void replay_glMatrixRotatedEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLdouble>();auto const a2=replayer.value<GLdouble>();auto const a3=replayer.value<GLdouble>();auto const a4=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glMatrixRotatedEXT(a0,a1,a2,a3,a4);}
+static void replay_glTexCoord2sv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLshort*>();if(replayer.isCorrupted())return;gl.glTexCoord2sv(a0);}
+static void replay_glIsProgramNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glIsProgramNV(a0);}
+static void replay_glUniform2dv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glUniform2dv(a0,a1,a2);}
+static void replay_glGetPixelMapuiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.output<GLuint*>();if(replayer.isCorrupted())return;gl.glGetPixelMapuiv(a0,a1);}
+static void replay_glDepthBoundsEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLclampd>();auto const a1=replayer.value<GLclampd>();if(replayer.isCorrupted())return;gl.glDepthBoundsEXT(a0,a1);}
+static void replay_glVertexAttrib4hvNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLhalfNV*>();if(replayer.isCorrupted())return;gl.glVertexAttrib4hvNV(a0,a1);}
+static void replay_glMultiTexParameteriEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glMultiTexParameteriEXT(a0,a1,a2,a3);}
+static void replay_glGetPointerv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.output<GLvoid**>();if(replayer.isCorrupted())return;gl.glGetPointerv(a0,a1);}
+static void replay_glPathCommandsNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.null<const GLubyte*>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.value<GLenum>();auto const a5=replayer.value<const void*>();if(replayer.isCorrupted())return;gl.glPathCommandsNV(a0,a1,a2,a3,a4,a5);}
+static void replay_glGetUniformfv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glGetUniformfv(a0,a1,a2);}
+static void replay_glGetUniformuiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.output<GLuint*>();if(replayer.isCorrupted())return;gl.glGetUniformuiv(a0,a1,a2);}
+static void replay_glDebugMessageInsertAMD(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.data<const GLchar*>();if(replayer.isCorrupted())return;gl.glDebugMessageInsertAMD(a0,a1,a2,a3,a4);}
+static void replay_glFrustum(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLdouble>();auto const a1=replayer.value<GLdouble>();auto const a2=replayer.value<GLdouble>();auto const a3=replayer.value<GLdouble>();auto const a4=replayer.value<GLdouble>();auto const a5=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glFrustum(a0,a1,a2,a3,a4,a5);}
+static void replay_glVertexAttribL1ui64vNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLuint64EXT*>();if(replayer.isCorrupted())return;gl.glVertexAttribL1ui64vNV(a0,a1);}
+static void replay_glClearColorxOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfixed>();auto const a1=replayer.value<GLfixed>();auto const a2=replayer.value<GLfixed>();auto const a3=replayer.value<GLfixed>();if(replayer.isCorrupted())return;gl.glClearColorxOES(a0,a1,a2,a3);}
+static void replay_glProgramUniformMatrix3fv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLboolean>();auto const a4=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glProgramUniformMatrix3fv(a0,a1,a2,a3,a4);}
+static void replay_glSampleMaskIndexedNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLbitfield>();if(replayer.isCorrupted())return;gl.glSampleMaskIndexedNV(a0,a1);}
+static void replay_glCompileShaderIncludeARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLsizei>();auto const a2=(const GLchar*const*)replayer.strings();auto const a3=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glCompileShaderIncludeARB(a0,a1,a2,a3);}
+static void replay_glGetArrayObjectfvATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glGetArrayObjectfvATI(a0,a1,a2);}
+static void replay_glVertexStream4svATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLshort*>();if(replayer.isCorrupted())return;gl.glVertexStream4svATI(a0,a1);}
+static void replay_glMultiTexCoord4iARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glMultiTexCoord4iARB(a0,a1,a2,a3,a4);}
+static void replay_glVariantfvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.null<const GLfloat*>();if(replayer.isCorrupted())return;gl.glVariantfvEXT(a0,a1);}
+static void replay_glMatrixLoadfEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glMatrixLoadfEXT(a0,a1);}
+static void replay_glLoadIdentityDeformationMapSGIX(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLbitfield>();if(replayer.isCorrupted())return;gl.glLoadIdentityDeformationMapSGIX(a0);}
+static void replay_glGetRenderbufferParameteriv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetRenderbufferParameteriv(a0,a1,a2);}
+static void replay_glProgramUniform3fEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLfloat>();auto const a3=replayer.value<GLfloat>();auto const a4=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glProgramUniform3fEXT(a0,a1,a2,a3,a4);}
+static void replay_glNamedRenderbufferStorage(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glNamedRenderbufferStorage(a0,a1,a2,a3);}
+static void replay_glProgramPathFragmentInputGenNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLint>();auto const a4=replayer.null<const GLfloat*>();if(replayer.isCorrupted())return;gl.glProgramPathFragmentInputGenNV(a0,a1,a2,a3,a4);}
+static void replay_glFogCoordPointerListIBM(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<const void**>();auto const a3=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glFogCoordPointerListIBM(a0,a1,a2,a3);}
+static void replay_glFenceSync(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLbitfield>();if(replayer.isCorrupted())return;auto const result=gl.glFenceSync(a0,a1);replayer.syncResult(result);}
+static void replay_glGetVertexAttribIivEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetVertexAttribIivEXT(a0,a1,a2);}
+static void replay_glFramebufferDrawBuffersEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLenum*>();if(replayer.isCorrupted())return;gl.glFramebufferDrawBuffersEXT(a0,a1,a2);}
+static void replay_glVertexAttribs4fvNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glVertexAttribs4fvNV(a0,a1,a2);}
+static void replay_glPauseTransformFeedbackNV(FunctionTable const&gl,CallReplayer&replayer){if(replayer.isCorrupted())return;gl.glPauseTransformFeedbackNV();}
+static void replay_glGetQueryObjecti64vEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLint64*>();if(replayer.isCorrupted())return;gl.glGetQueryObjecti64vEXT(a0,a1,a2);}
+static void replay_glVDPAUSurfaceAccessNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLvdpauSurfaceNV>();auto const a1=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glVDPAUSurfaceAccessNV(a0,a1);}
+static void replay_glValidateProgramPipeline(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glValidateProgramPipeline(a0);}
+static void replay_glTexPageCommitmentARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLint>();auto const a5=replayer.value<GLsizei>();auto const a6=replayer.value<GLsizei>();auto const a7=replayer.value<GLsizei>();auto const a8=replayer.value<GLboolean>();if(replayer.isCorrupted())return;gl.glTexPageCommitmentARB(a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+static void replay_glWindowPos3dvARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glWindowPos3dvARB(a0);}
+static void replay_glStencilStrokePathInstancedNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<const void*>();auto const a3=replayer.value<GLuint>();auto const a4=replayer.value<GLint>();auto const a5=replayer.value<GLuint>();auto const a6=replayer.value<GLenum>();auto const a7=replayer.null<const GLfloat*>();if(replayer.isCorrupted())return;gl.glStencilStrokePathInstancedNV(a0,a1,a2,a3,a4,a5,a6,a7);}
+static void replay_glFogfv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.null<const GLfloat*>();if(replayer.isCorrupted())return;gl.glFogfv(a0,a1);}
+static void replay_glGenQueriesARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.output<GLuint*>();if(replayer.isCorrupted())return;gl.glGenQueriesARB(a0,a1);replayer.checkNames(a1);}
+static void replay_glProgramUniform2i64NV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint64EXT>();auto const a3=replayer.value<GLint64EXT>();if(replayer.isCorrupted())return;gl.glProgramUniform2i64NV(a0,a1,a2,a3);}
+static void replay_glVertexP4ui(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glVertexP4ui(a0,a1);}
+static void replay_glVertexStream1ivATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glVertexStream1ivATI(a0,a1);}
+static void replay_glProgramEnvParameterI4iNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLint>();auto const a5=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glProgramEnvParameterI4iNV(a0,a1,a2,a3,a4,a5);}
+static void replay_glGenVertexArraysAPPLE(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.output<GLuint*>();if(replayer.isCorrupted())return;gl.glGenVertexArraysAPPLE(a0,a1);replayer.checkNames(a1);}
+static void replay_glDrawTransformFeedbackInstanced(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glDrawTransformFeedbackInstanced(a0,a1,a2);}
+static void replay_glStencilThenCoverStrokePathNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glStencilThenCoverStrokePathNV(a0,a1,a2,a3);}
+static void replay_glDeleteVertexArraysAPPLE(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glDeleteVertexArraysAPPLE(a0,a1);}
+static void replay_glGetNamedBufferParameterui64vNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLuint64EXT*>();if(replayer.isCorrupted())return;gl.glGetNamedBufferParameterui64vNV(a0,a1,a2);}
+static void replay_glQueryMatrixxOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.output<GLfixed*>();auto const a1=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glQueryMatrixxOES(a0,a1);}
+static void replay_glSecondaryColor3usv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLushort*>();if(replayer.isCorrupted())return;gl.glSecondaryColor3usv(a0);}
+static void replay_glTranslatexOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfixed>();auto const a1=replayer.value<GLfixed>();auto const a2=replayer.value<GLfixed>();if(replayer.isCorrupted())return;gl.glTranslatexOES(a0,a1,a2);}
+static void replay_glDrawTransformFeedback(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glDrawTransformFeedback(a0,a1);}
+static void replay_glTexCoord2fColor4fNormal3fVertex3fvSUN(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLfloat*>();auto const a1=replayer.data<const GLfloat*>();auto const a2=replayer.data<const GLfloat*>();auto const a3=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glTexCoord2fColor4fNormal3fVertex3fvSUN(a0,a1,a2,a3);}
+static void replay_glVDPAURegisterVideoSurfaceNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<const void*>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.null<const GLuint*>();if(replayer.isCorrupted())return;gl.glVDPAURegisterVideoSurfaceNV(a0,a1,a2,a3);}
+static void replay_glGetTexParameterIuiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLuint*>();if(replayer.isCorrupted())return;gl.glGetTexParameterIuiv(a0,a1,a2);}
+static void replay_glBindBufferBaseNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glBindBufferBaseNV(a0,a1,a2);}
+static void replay_glIndexPointer(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.value<const GLvoid*>();if(replayer.isCorrupted())return;gl.glIndexPointer(a0,a1,a2);}
+static void replay_glVertexAttrib4Nbv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLbyte*>();if(replayer.isCorrupted())return;gl.glVertexAttrib4Nbv(a0,a1);}
+static void replay_glListParameteriSGIX(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glListParameteriSGIX(a0,a1,a2);}
+static void replay_glBlendColorxOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfixed>();auto const a1=replayer.value<GLfixed>();auto const a2=replayer.value<GLfixed>();auto const a3=replayer.value<GLfixed>();if(replayer.isCorrupted())return;gl.glBlendColorxOES(a0,a1,a2,a3);}
+static void replay_glUniformui64vNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLuint64EXT*>();if(replayer.isCorrupted())return;gl.glUniformui64vNV(a0,a1,a2);}
+static void replay_glIsSync(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.sync();if(replayer.isCorrupted())return;gl.glIsSync(a0);}
+static void replay_glGetTextureParameterivEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetTextureParameterivEXT(a0,a1,a2,a3);}
+static void replay_glFogCoordhvNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.null<const GLhalfNV*>();if(replayer.isCorrupted())return;gl.glFogCoordhvNV(a0);}
+static void replay_glFramebufferTextureLayerEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glFramebufferTextureLayerEXT(a0,a1,a2,a3,a4);}
+static void replay_glGetObjectPtrLabel(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<const void*>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.output<GLsizei*>();auto const a3=replayer.output<GLchar*>();if(replayer.isCorrupted())return;gl.glGetObjectPtrLabel(a0,a1,a2,a3);}
+static void replay_glTextureParameteri(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glTextureParameteri(a0,a1,a2);}
+static void replay_glMultiTexCoord1fARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glMultiTexCoord1fARB(a0,a1);}
+static void replay_glUniformMatrix2x3dv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.value<GLboolean>();auto const a3=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glUniformMatrix2x3dv(a0,a1,a2,a3);}
+static void replay_glFramebufferDrawBufferEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glFramebufferDrawBufferEXT(a0,a1);}
+static void replay_glCopyColorSubTable(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glCopyColorSubTable(a0,a1,a2,a3,a4);}
+static void replay_glVertexAttribL3d(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLdouble>();auto const a2=replayer.value<GLdouble>();auto const a3=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glVertexAttribL3d(a0,a1,a2,a3);}
+static void replay_glFragmentMaterialfvSGIX(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.null<const GLfloat*>();if(replayer.isCorrupted())return;gl.glFragmentMaterialfvSGIX(a0,a1,a2);}
+static void replay_glMatrixLoadTranspose3x3fNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glMatrixLoadTranspose3x3fNV(a0,a1);}
+static void replay_glDeleteNamesAMD(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.null<const GLuint*>();if(replayer.isCorrupted())return;gl.glDeleteNamesAMD(a0,a1,a2);}
+static void replay_glDrawRangeElementsEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.value<GLenum>();auto const a5=replayer.value<const void*>();if(replayer.isCorrupted())return;gl.glDrawRangeElementsEXT(a0,a1,a2,a3,a4,a5);}
+static void replay_glOrtho(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLdouble>();auto const a1=replayer.value<GLdouble>();auto const a2=replayer.value<GLdouble>();auto const a3=replayer.value<GLdouble>();auto const a4=replayer.value<GLdouble>();auto const a5=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glOrtho(a0,a1,a2,a3,a4,a5);}
+static void replay_glProgramUniform1dvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glProgramUniform1dvEXT(a0,a1,a2,a3);}
+static void replay_glColor4xOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfixed>();auto const a1=replayer.value<GLfixed>();auto const a2=replayer.value<GLfixed>();auto const a3=replayer.value<GLfixed>();if(replayer.isCorrupted())return;gl.glColor4xOES(a0,a1,a2,a3);}
+static void replay_glTexImage4DSGIS(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.value<GLsizei>();auto const a5=replayer.value<GLsizei>();auto const a6=replayer.value<GLsizei>();auto const a7=replayer.value<GLint>();auto const a8=replayer.value<GLenum>();auto const a9=replayer.value<GLenum>();auto const a10=replayer.value<const void*>();if(replayer.isCorrupted())return;gl.glTexImage4DSGIS(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10);}
+static void replay_glProgramUniform1ui(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glProgramUniform1ui(a0,a1,a2);}
+static void replay_glDeleteBuffersARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glDeleteBuffersARB(a0,a1);}
+static void replay_glUnmapBufferARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glUnmapBufferARB(a0);}
+static void replay_glCopyTexImage2D(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLint>();auto const a5=replayer.value<GLsizei>();auto const a6=replayer.value<GLsizei>();auto const a7=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glCopyTexImage2D(a0,a1,a2,a3,a4,a5,a6,a7);}
+static void replay_glMaterialxOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLfixed>();if(replayer.isCorrupted())return;gl.glMaterialxOES(a0,a1,a2);}
+static void replay_glProgramUniformMatrix2x4fvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLboolean>();auto const a4=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glProgramUniformMatrix2x4fvEXT(a0,a1,a2,a3,a4);}
+static void replay_glTestObjectAPPLE(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glTestObjectAPPLE(a0,a1);}
+static void replay_glRenderbufferStorageEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glRenderbufferStorageEXT(a0,a1,a2,a3);}
+static void replay_glVertexAttribL1ui64ARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint64EXT>();if(replayer.isCorrupted())return;gl.glVertexAttribL1ui64ARB(a0,a1);}
+static void replay_glEndFragmentShaderATI(FunctionTable const&gl,CallReplayer&replayer){if(replayer.isCorrupted())return;gl.glEndFragmentShaderATI();}
+static void replay_glPathParameterivNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.null<const GLint*>();if(replayer.isCorrupted())return;gl.glPathParameterivNV(a0,a1,a2);}
+static void replay_glUniform4uiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glUniform4uiv(a0,a1,a2);}
+static void replay_glFrameZoomSGIX(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glFrameZoomSGIX(a0);}
+static void replay_glSecondaryColor3fEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfloat>();auto const a1=replayer.value<GLfloat>();auto const a2=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glSecondaryColor3fEXT(a0,a1,a2);}
+static void replay_glVertexAttribL1dv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glVertexAttribL1dv(a0,a1);}
+static void replay_glNormalStream3svATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLshort*>();if(replayer.isCorrupted())return;gl.glNormalStream3svATI(a0,a1);}
+static void replay_glPathStencilFuncNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glPathStencilFuncNV(a0,a1,a2);}
+static void replay_glSetInvariantEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<const void*>();if(replayer.isCorrupted())return;gl.glSetInvariantEXT(a0,a1,a2);}
+static void replay_glGetTexBumpParameterivATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetTexBumpParameterivATI(a0,a1);}
+static void replay_glBlendEquationSeparateEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glBlendEquationSeparateEXT(a0,a1);}
+static void replay_glEndOcclusionQueryNV(FunctionTable const&gl,CallReplayer&replayer){if(replayer.isCorrupted())return;gl.glEndOcclusionQueryNV();}
+static void replay_glScissorArrayv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glScissorArrayv(a0,a1,a2);}
+static void replay_glCallList(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glCallList(a0);}
+static void replay_glMapTexture2DINTEL(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLbitfield>();auto const a3=replayer.output<GLint*>();auto const a4=replayer.output<GLenum*>();if(replayer.isCorrupted())return;gl.glMapTexture2DINTEL(a0,a1,a2,a3,a4);}
+static void replay_glPixelTransferxOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLfixed>();if(replayer.isCorrupted())return;gl.glPixelTransferxOES(a0,a1);}
+static void replay_glDeleteRenderbuffersEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glDeleteRenderbuffersEXT(a0,a1);}
+static void replay_glTexCoord4fColor4fNormal3fVertex4fSUN(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfloat>();auto const a1=replayer.value<GLfloat>();auto const a2=replayer.value<GLfloat>();auto const a3=replayer.value<GLfloat>();auto const a4=replayer.value<GLfloat>();auto const a5=replayer.value<GLfloat>();auto const a6=replayer.value<GLfloat>();auto const a7=replayer.value<GLfloat>();auto const a8=replayer.value<GLfloat>();auto const a9=replayer.value<GLfloat>();auto const a10=replayer.value<GLfloat>();auto const a11=replayer.value<GLfloat>();auto const a12=replayer.value<GLfloat>();auto const a13=replayer.value<GLfloat>();auto const a14=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glTexCoord4fColor4fNormal3fVertex4fSUN(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14);}
+static void replay_glProgramUniformMatrix4dvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLboolean>();auto const a4=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glProgramUniformMatrix4dvEXT(a0,a1,a2,a3,a4);}
+static void replay_glGetnColorTable(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.output<void*>();if(replayer.isCorrupted())return;gl.glGetnColorTable(a0,a1,a2,a3,a4);}
+static void replay_glFramebufferTextureLayerARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glFramebufferTextureLayerARB(a0,a1,a2,a3,a4);}
+static void replay_glVertexAttribL2dvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glVertexAttribL2dvEXT(a0,a1);}
+static void replay_glGetCombinerStageParameterfvNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glGetCombinerStageParameterfvNV(a0,a1,a2);}
+static void replay_glMultiTexCoord1xvOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLfixed*>();if(replayer.isCorrupted())return;gl.glMultiTexCoord1xvOES(a0,a1);}
+static void replay_glMapBuffer(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();if(replayer.isCorrupted())return;auto const result=gl.glMapBuffer(a0,a1);replayer.mapResult(result);}
+static void replay_glSecondaryColor3d(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLdouble>();auto const a1=replayer.value<GLdouble>();auto const a2=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glSecondaryColor3d(a0,a1,a2);}
+static void replay_glSecondaryColor3f(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfloat>();auto const a1=replayer.value<GLfloat>();auto const a2=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glSecondaryColor3f(a0,a1,a2);}
+static void replay_glVertexAttribLFormat(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glVertexAttribLFormat(a0,a1,a2,a3);}
+static void replay_glElementPointerAPPLE(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<const void*>();if(replayer.isCorrupted())return;gl.glElementPointerAPPLE(a0,a1);}
+static void replay_glVertexStream1fATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glVertexStream1fATI(a0,a1);}
+static void replay_glCoverageModulationNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glCoverageModulationNV(a0);}
+static void replay_glSecondaryColor3i(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glSecondaryColor3i(a0,a1,a2);}
+static void replay_glDeleteSync(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.sync();if(replayer.isCorrupted())return;gl.glDeleteSync(a0);}
+static void replay_glGetProgramParameterfvNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glGetProgramParameterfvNV(a0,a1,a2,a3);}
+static void replay_glMaxShaderCompilerThreadsARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glMaxShaderCompilerThreadsARB(a0);}
+static void replay_glUniformMatrix4x2dv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.value<GLboolean>();auto const a3=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glUniformMatrix4x2dv(a0,a1,a2,a3);}
+static void replay_glVertexArrayVertexAttribLOffsetEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLenum>();auto const a5=replayer.value<GLsizei>();auto const a6=replayer.value<GLintptr>();if(replayer.isCorrupted())return;gl.glVertexArrayVertexAttribLOffsetEXT(a0,a1,a2,a3,a4,a5,a6);}
+static void replay_glSecondaryColor3s(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLshort>();auto const a1=replayer.value<GLshort>();auto const a2=replayer.value<GLshort>();if(replayer.isCorrupted())return;gl.glSecondaryColor3s(a0,a1,a2);}
+static void replay_glIsImageHandleResidentNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint64>();if(replayer.isCorrupted())return;gl.glIsImageHandleResidentNV(a0);}
+static void replay_glUniform3iv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glUniform3iv(a0,a1,a2);}
+static void replay_glVertexAttribL3i64vNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLint64EXT*>();if(replayer.isCorrupted())return;gl.glVertexAttribL3i64vNV(a0,a1);}
+static void replay_glPolygonMode(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glPolygonMode(a0,a1);}
+static void replay_glConvolutionFilter1DEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLenum>();auto const a4=replayer.value<GLenum>();auto const a5=replayer.value<const void*>();if(replayer.isCorrupted())return;gl.glConvolutionFilter1DEXT(a0,a1,a2,a3,a4,a5);}
+static void replay_glVertexAttrib1dvARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glVertexAttrib1dvARB(a0,a1);}
+static void replay_glTextureSubImage2DEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLint>();auto const a5=replayer.value<GLsizei>();auto const a6=replayer.value<GLsizei>();auto const a7=replayer.value<GLenum>();auto const a8=replayer.value<GLenum>();auto const a9=replayer.pixels<const void*>();if(replayer.isCorrupted())return;gl.glTextureSubImage2DEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}
+static void replay_glIsVertexArrayAPPLE(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glIsVertexArrayAPPLE(a0);}
+static void replay_glUseProgram(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glUseProgram(a0);}
+static void replay_glLineStipple(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLushort>();if(replayer.isCorrupted())return;gl.glLineStipple(a0,a1);}
+static void replay_glMultiTexCoord4fvARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glMultiTexCoord4fvARB(a0,a1);}
+static void replay_glVideoCaptureNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.output<GLuint*>();auto const a2=replayer.output<GLuint64EXT*>();if(replayer.isCorrupted())return;gl.glVideoCaptureNV(a0,a1,a2);}
+static void replay_glVertexArrayVertexAttribLFormatEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLenum>();auto const a4=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glVertexArrayVertexAttribLFormatEXT(a0,a1,a2,a3,a4);}
+static void replay_glUniform3fvARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glUniform3fvARB(a0,a1,a2);}
+static void replay_glProgramUniformMatrix3x2fvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLboolean>();auto const a4=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glProgramUniformMatrix3x2fvEXT(a0,a1,a2,a3,a4);}
+static void replay_glCopyTextureSubImage3DEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLint>();auto const a5=replayer.value<GLint>();auto const a6=replayer.value<GLint>();auto const a7=replayer.value<GLint>();auto const a8=replayer.value<GLsizei>();auto const a9=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glCopyTextureSubImage3DEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}
+static void replay_glMultiTexCoord2bvOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLbyte*>();if(replayer.isCorrupted())return;gl.glMultiTexCoord2bvOES(a0,a1);}
+static void replay_glDeleteObjectARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLhandleARB>();if(replayer.isCorrupted())return;gl.glDeleteObjectARB(a0);}
+static void replay_glTextureLightEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glTextureLightEXT(a0);}
+static void replay_glMultiTexCoord3dARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLdouble>();auto const a2=replayer.value<GLdouble>();auto const a3=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glMultiTexCoord3dARB(a0,a1,a2,a3);}
+static void replay_glNamedFramebufferTextureEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glNamedFramebufferTextureEXT(a0,a1,a2,a3);}
+static void replay_glTextureParameteriEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glTextureParameteriEXT(a0,a1,a2,a3);}
+static void replay_glEvalCoord2xvOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLfixed*>();if(replayer.isCorrupted())return;gl.glEvalCoord2xvOES(a0);}
+static void replay_glBindVideoCaptureStreamBufferNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLintptrARB>();if(replayer.isCorrupted())return;gl.glBindVideoCaptureStreamBufferNV(a0,a1,a2,a3);}
+static void replay_glTexImage2DMultisampleCoverageNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLsizei>();auto const a5=replayer.value<GLsizei>();auto const a6=replayer.value<GLboolean>();if(replayer.isCorrupted())return;gl.glTexImage2DMultisampleCoverageNV(a0,a1,a2,a3,a4,a5,a6);}
+static void replay_glGetAttribLocationARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLhandleARB>();auto const a1=replayer.data<const GLcharARB*>();if(replayer.isCorrupted())return;gl.glGetAttribLocationARB(a0,a1);}
+static void replay_glDeleteShader(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glDeleteShader(a0);}
+static void replay_glVertexAttrib1fARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glVertexAttrib1fARB(a0,a1);}
+static void replay_glTexCoord2fColor4ubVertex3fSUN(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfloat>();auto const a1=replayer.value<GLfloat>();auto const a2=replayer.value<GLubyte>();auto const a3=replayer.value<GLubyte>();auto const a4=replayer.value<GLubyte>();auto const a5=replayer.value<GLubyte>();auto const a6=replayer.value<GLfloat>();auto const a7=replayer.value<GLfloat>();auto const a8=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glTexCoord2fColor4ubVertex3fSUN(a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+static void replay_glTexCoord4fVertex4fSUN(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfloat>();auto const a1=replayer.value<GLfloat>();auto const a2=replayer.value<GLfloat>();auto const a3=replayer.value<GLfloat>();auto const a4=replayer.value<GLfloat>();auto const a5=replayer.value<GLfloat>();auto const a6=replayer.value<GLfloat>();auto const a7=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glTexCoord4fVertex4fSUN(a0,a1,a2,a3,a4,a5,a6,a7);}
+static void replay_glGetMapdv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLdouble*>();if(replayer.isCorrupted())return;gl.glGetMapdv(a0,a1,a2);}
+static void replay_glMapParameterfvNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.null<const GLfloat*>();if(replayer.isCorrupted())return;gl.glMapParameterfvNV(a0,a1,a2);}
+static void replay_glTextureParameterIuiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glTextureParameterIuiv(a0,a1,a2);}
+static void replay_glTransformFeedbackAttribsNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.data<const GLint*>();auto const a2=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glTransformFeedbackAttribsNV(a0,a1,a2);}
+static void replay_glFragmentLightfvSGIX(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.null<const GLfloat*>();if(replayer.isCorrupted())return;gl.glFragmentLightfvSGIX(a0,a1,a2);}
+static void replay_glWindowPos3sARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLshort>();auto const a1=replayer.value<GLshort>();auto const a2=replayer.value<GLshort>();if(replayer.isCorrupted())return;gl.glWindowPos3sARB(a0,a1,a2);}
+static void replay_glGetConvolutionParameterfv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glGetConvolutionParameterfv(a0,a1,a2);}
+static void replay_glCopyTexSubImage3D(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLint>();auto const a5=replayer.value<GLint>();auto const a6=replayer.value<GLint>();auto const a7=replayer.value<GLsizei>();auto const a8=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glCopyTexSubImage3D(a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+static void replay_glVertexAttribI3i(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glVertexAttribI3i(a0,a1,a2,a3);}
+static void replay_glCreateShaderObjectARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glCreateShaderObjectARB(a0);}
+static void replay_glVertexAttribFormat(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLboolean>();auto const a4=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glVertexAttribFormat(a0,a1,a2,a3,a4);}
+static void replay_glGetProgramivARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetProgramivARB(a0,a1,a2);}
+static void replay_glVertexAttribI4usv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLushort*>();if(replayer.isCorrupted())return;gl.glVertexAttribI4usv(a0,a1);}
+static void replay_glTexParameterf(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glTexParameterf(a0,a1,a2);}
+static void replay_glVertexAttribBinding(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glVertexAttribBinding(a0,a1);}
+static void replay_glGetHistogramParameteriv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetHistogramParameteriv(a0,a1,a2);}
+static void replay_glTexParameteri(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glTexParameteri(a0,a1,a2);}
+static void replay_glGetShaderSource(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.output<GLsizei*>();auto const a3=replayer.output<GLchar*>();if(replayer.isCorrupted())return;gl.glGetShaderSource(a0,a1,a2,a3);}
+static void replay_glVertexAttrib4s(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLshort>();auto const a2=replayer.value<GLshort>();auto const a3=replayer.value<GLshort>();auto const a4=replayer.value<GLshort>();if(replayer.isCorrupted())return;gl.glVertexAttrib4s(a0,a1,a2,a3,a4);}
+static void replay_glVertexAttrib4dvNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glVertexAttrib4dvNV(a0,a1);}
+static void replay_glVertexAttrib1dvNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glVertexAttrib1dvNV(a0,a1);}
+static void replay_glPopName(FunctionTable const&gl,CallReplayer&replayer){if(replayer.isCorrupted())return;gl.glPopName();}
+static void replay_glTextureBufferEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glTextureBufferEXT(a0,a1,a2,a3);}
+static void replay_glGetMultiTexImageEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLenum>();auto const a4=replayer.value<GLenum>();auto const a5=replayer.output<void*>();if(replayer.isCorrupted())return;gl.glGetMultiTexImageEXT(a0,a1,a2,a3,a4,a5);}
+static void replay_glGetPointerIndexedvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.output<void**>();if(replayer.isCorrupted())return;gl.glGetPointerIndexedvEXT(a0,a1,a2);}
+static void replay_glIsNameAMD(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glIsNameAMD(a0,a1);}
+static void replay_glColor4ub(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLubyte>();auto const a1=replayer.value<GLubyte>();auto const a2=replayer.value<GLubyte>();auto const a3=replayer.value<GLubyte>();if(replayer.isCorrupted())return;gl.glColor4ub(a0,a1,a2,a3);}
+static void replay_glBufferParameteriAPPLE(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glBufferParameteriAPPLE(a0,a1,a2);}
+static void replay_glColor4ui(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glColor4ui(a0,a1,a2,a3);}
+static void replay_glGetInternalformativ(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetInternalformativ(a0,a1,a2,a3,a4);}
+static void replay_glColor4us(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLushort>();auto const a1=replayer.value<GLushort>();auto const a2=replayer.value<GLushort>();auto const a3=replayer.value<GLushort>();if(replayer.isCorrupted())return;gl.glColor4us(a0,a1,a2,a3);}
+static void replay_glVertexAttribP1uiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLboolean>();auto const a3=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glVertexAttribP1uiv(a0,a1,a2,a3);}
+static void replay_glLinkProgram(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glLinkProgram(a0);}
+static void replay_glTexCoord3s(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLshort>();auto const a1=replayer.value<GLshort>();auto const a2=replayer.value<GLshort>();if(replayer.isCorrupted())return;gl.glTexCoord3s(a0,a1,a2);}
+static void replay_glTexCoord2dv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glTexCoord2dv(a0);}
+static void replay_glGetObjectLabel(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.output<GLsizei*>();auto const a4=replayer.output<GLchar*>();if(replayer.isCorrupted())return;gl.glGetObjectLabel(a0,a1,a2,a3,a4);}
+static void replay_glVertexPointerEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.value<const void*>();if(replayer.isCorrupted())return;gl.glVertexPointerEXT(a0,a1,a2,a3,a4);}
+static void replay_glDebugMessageCallbackARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.null<GLDEBUGPROCARB>();auto const a1=replayer.value<const void*>();if(replayer.isCorrupted())return;gl.glDebugMessageCallbackARB(a0,a1);}
+static void replay_glGetString(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glGetString(a0);}
+static void replay_glGetPathParameterfvNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glGetPathParameterfvNV(a0,a1,a2);}
+static void replay_glLightxvOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.null<const GLfixed*>();if(replayer.isCorrupted())return;gl.glLightxvOES(a0,a1,a2);}
+static void replay_glEndQuery(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glEndQuery(a0);}
+static void replay_glSecondaryColor3uiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glSecondaryColor3uiv(a0);}
+static void replay_glPrioritizeTexturesxOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.data<const GLuint*>();auto const a2=replayer.data<const GLfixed*>();if(replayer.isCorrupted())return;gl.glPrioritizeTexturesxOES(a0,a1,a2);}
+static void replay_glEdgeFlagPointer(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.value<const GLvoid*>();if(replayer.isCorrupted())return;gl.glEdgeFlagPointer(a0,a1);}
+static void replay_glFramebufferParameteri(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glFramebufferParameteri(a0,a1,a2);}
+static void replay_glTexCoord3hNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLhalfNV>();auto const a1=replayer.value<GLhalfNV>();auto const a2=replayer.value<GLhalfNV>();if(replayer.isCorrupted())return;gl.glTexCoord3hNV(a0,a1,a2);}
+static void replay_glMultiModeDrawElementsIBM(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLenum*>();auto const a1=replayer.data<const GLsizei*>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.data<const void*const*>();auto const a4=replayer.value<GLsizei>();auto const a5=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glMultiModeDrawElementsIBM(a0,a1,a2,a3,a4,a5);}
+static void replay_glCopyPixels(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glCopyPixels(a0,a1,a2,a3,a4);}
+static void replay_glVertexAttribI2ui(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glVertexAttribI2ui(a0,a1,a2);}
+static void replay_glClampColorARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glClampColorARB(a0,a1);}
+static void replay_glColorPointervINTEL(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<const void**>();if(replayer.isCorrupted())return;gl.glColorPointervINTEL(a0,a1,a2);}
+static void replay_glDeleteTextures(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glDeleteTextures(a0,a1);}
+static void replay_glGetMinmaxParameterfvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glGetMinmaxParameterfvEXT(a0,a1,a2);}
+static void replay_glWindowPos3sMESA(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLshort>();auto const a1=replayer.value<GLshort>();auto const a2=replayer.value<GLshort>();if(replayer.isCorrupted())return;gl.glWindowPos3sMESA(a0,a1,a2);}
+static void replay_glVertexAttrib4f(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLfloat>();auto const a2=replayer.value<GLfloat>();auto const a3=replayer.value<GLfloat>();auto const a4=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glVertexAttrib4f(a0,a1,a2,a3,a4);}
+static void replay_glNamedFramebufferParameteri(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glNamedFramebufferParameteri(a0,a1,a2);}
+static void replay_glTexCoord2fVertex3fvSUN(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLfloat*>();auto const a1=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glTexCoord2fVertex3fvSUN(a0,a1);}
+static void replay_glReplacementCodeusSUN(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLushort>();if(replayer.isCorrupted())return;gl.glReplacementCodeusSUN(a0);}
+static void replay_glGetNamedFramebufferParameteriv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetNamedFramebufferParameteriv(a0,a1,a2);}
+static void replay_glVertexStream1fvATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glVertexStream1fvATI(a0,a1);}
+static void replay_glCreateVertexArrays(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.output<GLuint*>();if(replayer.isCorrupted())return;gl.glCreateVertexArrays(a0,a1);replayer.checkNames(a1);}
+static void replay_glBeginConditionalRender(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glBeginConditionalRender(a0,a1);}
+static void replay_glConvolutionFilter1D(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLenum>();auto const a4=replayer.value<GLenum>();auto const a5=replayer.value<const GLvoid*>();if(replayer.isCorrupted())return;gl.glConvolutionFilter1D(a0,a1,a2,a3,a4,a5);}
+static void replay_glMultiTexCoord3fARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLfloat>();auto const a2=replayer.value<GLfloat>();auto const a3=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glMultiTexCoord3fARB(a0,a1,a2,a3);}
+static void replay_glGetQueryObjectuivARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLuint*>();if(replayer.isCorrupted())return;gl.glGetQueryObjectuivARB(a0,a1,a2);}
+static void replay_glScalexOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfixed>();auto const a1=replayer.value<GLfixed>();auto const a2=replayer.value<GLfixed>();if(replayer.isCorrupted())return;gl.glScalexOES(a0,a1,a2);}
+static void replay_glSamplerParameteri(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glSamplerParameteri(a0,a1,a2);}
+static void replay_glSamplerParameterf(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glSamplerParameterf(a0,a1,a2);}
+static void replay_glShaderOp1EXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glShaderOp1EXT(a0,a1,a2);}
+static void replay_glBeginVideoCaptureNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glBeginVideoCaptureNV(a0);}
+static void replay_glGetnHistogram(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLboolean>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLenum>();auto const a4=replayer.value<GLsizei>();auto const a5=replayer.output<void*>();if(replayer.isCorrupted())return;gl.glGetnHistogram(a0,a1,a2,a3,a4,a5);}
+static void replay_glUniform1d(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glUniform1d(a0,a1);}
+static void replay_glRenderMode(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glRenderMode(a0);}
+static void replay_glClearColorIiEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glClearColorIiEXT(a0,a1,a2,a3);}
+static void replay_glGetCompressedTexImage(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();auto const a2=replayer.output<GLvoid*>();if(replayer.isCorrupted())return;gl.glGetCompressedTexImage(a0,a1,a2);}
+static void replay_glCompressedTextureImage1DEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLenum>();auto const a4=replayer.value<GLsizei>();auto const a5=replayer.value<GLint>();auto const a6=replayer.value<GLsizei>();auto const a7=replayer.pixels<const void*>();if(replayer.isCorrupted())return;gl.glCompressedTextureImage1DEXT(a0,a1,a2,a3,a4,a5,a6,a7);}
+static void replay_glGetActiveUniformBlockiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetActiveUniformBlockiv(a0,a1,a2,a3);}
+static void replay_glUniform1i(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glUniform1i(a0,a1);}
+static void replay_glGetTexEnvfv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glGetTexEnvfv(a0,a1,a2);}
+static void replay_glColorTableParameterivSGI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.null<const GLint*>();if(replayer.isCorrupted())return;gl.glColorTableParameterivSGI(a0,a1,a2);}
+static void replay_glCullFace(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glCullFace(a0);}
+static void replay_glDeleteFencesAPPLE(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glDeleteFencesAPPLE(a0,a1);}
+static void replay_glProgramUniform4i(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLint>();auto const a5=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glProgramUniform4i(a0,a1,a2,a3,a4,a5);}
+static void replay_glUniformHandleui64ARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLuint64>();if(replayer.isCorrupted())return;gl.glUniformHandleui64ARB(a0,a1);}
+static void replay_glProgramUniform4f(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLfloat>();auto const a3=replayer.value<GLfloat>();auto const a4=replayer.value<GLfloat>();auto const a5=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glProgramUniform4f(a0,a1,a2,a3,a4,a5);}
+static void replay_glViewportIndexedf(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLfloat>();auto const a2=replayer.value<GLfloat>();auto const a3=replayer.value<GLfloat>();auto const a4=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glViewportIndexedf(a0,a1,a2,a3,a4);}
+static void replay_glProgramUniform4d(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLdouble>();auto const a3=replayer.value<GLdouble>();auto const a4=replayer.value<GLdouble>();auto const a5=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glProgramUniform4d(a0,a1,a2,a3,a4,a5);}
+static void replay_glTexCoord1xOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfixed>();if(replayer.isCorrupted())return;gl.glTexCoord1xOES(a0);}
+static void replay_glVertexStream3ivATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glVertexStream3ivATI(a0,a1);}
+static void replay_glGetStringi(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glGetStringi(a0,a1);}
+static void replay_glEndQueryARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glEndQueryARB(a0);}
+static void replay_glVDPAUMapSurfacesNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.null<const GLvdpauSurfaceNV*>();if(replayer.isCorrupted())return;gl.glVDPAUMapSurfacesNV(a0,a1);}
+static void replay_glVertex3i(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glVertex3i(a0,a1,a2);}
+static void replay_glVertexAttrib4uivARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glVertexAttrib4uivARB(a0,a1);}
+static void replay_glResumeTransformFeedbackNV(FunctionTable const&gl,CallReplayer&replayer){if(replayer.isCorrupted())return;gl.glResumeTransformFeedbackNV();}
+static void replay_glAttachShader(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glAttachShader(a0,a1);}
+static void replay_glColor4hNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLhalfNV>();auto const a1=replayer.value<GLhalfNV>();auto const a2=replayer.value<GLhalfNV>();auto const a3=replayer.value<GLhalfNV>();if(replayer.isCorrupted())return;gl.glColor4hNV(a0,a1,a2,a3);}
+static void replay_glGetFenceivNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetFenceivNV(a0,a1,a2);}
+static void replay_glTexCoord2fColor4ubVertex3fvSUN(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLfloat*>();auto const a1=replayer.data<const GLubyte*>();auto const a2=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glTexCoord2fColor4ubVertex3fvSUN(a0,a1,a2);}
+static void replay_glGetColorTable(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.output<GLvoid*>();if(replayer.isCorrupted())return;gl.glGetColorTable(a0,a1,a2,a3);}
+static void replay_glFogCoordPointer(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.value<const void*>();if(replayer.isCorrupted())return;gl.glFogCoordPointer(a0,a1,a2);}
+static void replay_glTexStorageSparseAMD(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.value<GLsizei>();auto const a5=replayer.value<GLsizei>();auto const a6=replayer.value<GLbitfield>();if(replayer.isCorrupted())return;gl.glTexStorageSparseAMD(a0,a1,a2,a3,a4,a5,a6);}
+static void replay_glUnmapNamedBuffer(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glUnmapNamedBuffer(a0);}
+static void replay_glTexCoord4bvOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLbyte*>();if(replayer.isCorrupted())return;gl.glTexCoord4bvOES(a0);}
+static void replay_glVertexAttrib3fARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLfloat>();auto const a2=replayer.value<GLfloat>();auto const a3=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glVertexAttrib3fARB(a0,a1,a2,a3);}
+static void replay_glRasterPos2xOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfixed>();auto const a1=replayer.value<GLfixed>();if(replayer.isCorrupted())return;gl.glRasterPos2xOES(a0,a1);}
+static void replay_glColor4ubVertex2fvSUN(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLubyte*>();auto const a1=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glColor4ubVertex2fvSUN(a0,a1);}
+static void replay_glSecondaryColor3dv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glSecondaryColor3dv(a0);}
+static void replay_glVertexAttribI4sv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLshort*>();if(replayer.isCorrupted())return;gl.glVertexAttribI4sv(a0,a1);}
+static void replay_glDrawTransformFeedbackStreamInstanced(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glDrawTransformFeedbackStreamInstanced(a0,a1,a2,a3);}
+static void replay_glMultiTexCoord4ivARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glMultiTexCoord4ivARB(a0,a1);}
+static void replay_glSpriteParameterfSGIX(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glSpriteParameterfSGIX(a0,a1);}
+static void replay_glSecondaryColor3sv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLshort*>();if(replayer.isCorrupted())return;gl.glSecondaryColor3sv(a0);}
+static void replay_glBindVideoCaptureStreamTextureNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLenum>();auto const a4=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glBindVideoCaptureStreamTextureNV(a0,a1,a2,a3,a4);}
+static void replay_glTexParameterIuiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glTexParameterIuiv(a0,a1,a2);}
+static void replay_glFlushPixelDataRangeNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glFlushPixelDataRangeNV(a0);}
+static void replay_glWindowPos3fv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glWindowPos3fv(a0);}
+static void replay_glVertexAttribLFormatNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glVertexAttribLFormatNV(a0,a1,a2,a3);}
+static void replay_glLightModelfv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.null<const GLfloat*>();if(replayer.isCorrupted())return;gl.glLightModelfv(a0,a1);}
+static void replay_glGetColorTableSGI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.output<void*>();if(replayer.isCorrupted())return;gl.glGetColorTableSGI(a0,a1,a2,a3);}
+static void replay_glGetCompressedTexImageARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();auto const a2=replayer.output<void*>();if(replayer.isCorrupted())return;gl.glGetCompressedTexImageARB(a0,a1,a2);}
+static void replay_glConvolutionParameteri(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glConvolutionParameteri(a0,a1,a2);}
+static void replay_glVertexWeighthNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLhalfNV>();if(replayer.isCorrupted())return;gl.glVertexWeighthNV(a0);}
+static void replay_glColorMaskIndexedEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLboolean>();auto const a2=replayer.value<GLboolean>();auto const a3=replayer.value<GLboolean>();auto const a4=replayer.value<GLboolean>();if(replayer.isCorrupted())return;gl.glColorMaskIndexedEXT(a0,a1,a2,a3,a4);}
+static void replay_glColorMaski(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLboolean>();auto const a2=replayer.value<GLboolean>();auto const a3=replayer.value<GLboolean>();auto const a4=replayer.value<GLboolean>();if(replayer.isCorrupted())return;gl.glColorMaski(a0,a1,a2,a3,a4);}
+static void replay_glColorFragmentOp1ATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<GLuint>();auto const a4=replayer.value<GLuint>();auto const a5=replayer.value<GLuint>();auto const a6=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glColorFragmentOp1ATI(a0,a1,a2,a3,a4,a5,a6);}
+static void replay_glVertexAttribI4ubvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLubyte*>();if(replayer.isCorrupted())return;gl.glVertexAttribI4ubvEXT(a0,a1);}
+static void replay_glVertexAttrib1dNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glVertexAttrib1dNV(a0,a1);}
+static void replay_glUnmapObjectBufferATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glUnmapObjectBufferATI(a0);}
+static void replay_glNamedProgramLocalParameterI4uiEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<GLuint>();auto const a4=replayer.value<GLuint>();auto const a5=replayer.value<GLuint>();auto const a6=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glNamedProgramLocalParameterI4uiEXT(a0,a1,a2,a3,a4,a5,a6);}
+static void replay_glProgramUniform1iEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glProgramUniform1iEXT(a0,a1,a2);}
+static void replay_glDeleteQueriesARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glDeleteQueriesARB(a0,a1);}
+static void replay_glWindowPos3svARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLshort*>();if(replayer.isCorrupted())return;gl.glWindowPos3svARB(a0);}
+static void replay_glVertex4s(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLshort>();auto const a1=replayer.value<GLshort>();auto const a2=replayer.value<GLshort>();auto const a3=replayer.value<GLshort>();if(replayer.isCorrupted())return;gl.glVertex4s(a0,a1,a2,a3);}
+static void replay_glStringMarkerGREMEDY(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.value<const void*>();if(replayer.isCorrupted())return;gl.glStringMarkerGREMEDY(a0,a1);}
+static void replay_glIsTransformFeedback(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glIsTransformFeedback(a0);}
+static void replay_glProgramUniformMatrix2x3dvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLboolean>();auto const a4=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glProgramUniformMatrix2x3dvEXT(a0,a1,a2,a3,a4);}
+static void replay_glGetObjectLabelEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.output<GLsizei*>();auto const a4=replayer.output<GLchar*>();if(replayer.isCorrupted())return;gl.glGetObjectLabelEXT(a0,a1,a2,a3,a4);}
+static void replay_glUniformHandleui64vNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLuint64*>();if(replayer.isCorrupted())return;gl.glUniformHandleui64vNV(a0,a1,a2);}
+static void replay_glRotated(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLdouble>();auto const a1=replayer.value<GLdouble>();auto const a2=replayer.value<GLdouble>();auto const a3=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glRotated(a0,a1,a2,a3);}
+static void replay_glIsProgramPipeline(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glIsProgramPipeline(a0);}
+static void replay_glRotatef(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfloat>();auto const a1=replayer.value<GLfloat>();auto const a2=replayer.value<GLfloat>();auto const a3=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glRotatef(a0,a1,a2,a3);}
+static void replay_glVertex4i(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glVertex4i(a0,a1,a2,a3);}
+static void replay_glGetActiveSubroutineUniformName(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.output<GLsizei*>();auto const a5=replayer.output<GLchar*>();if(replayer.isCorrupted())return;gl.glGetActiveSubroutineUniformName(a0,a1,a2,a3,a4,a5);}
+static void replay_glVertexAttrib4sNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLshort>();auto const a2=replayer.value<GLshort>();auto const a3=replayer.value<GLshort>();auto const a4=replayer.value<GLshort>();if(replayer.isCorrupted())return;gl.glVertexAttrib4sNV(a0,a1,a2,a3,a4);}
+static void replay_glProgramLocalParameter4dvARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glProgramLocalParameter4dvARB(a0,a1,a2);}
+static void replay_glReplacementCodeubSUN(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLubyte>();if(replayer.isCorrupted())return;gl.glReplacementCodeubSUN(a0);}
+static void replay_glMultiDrawElementsIndirectBindlessNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<const void*>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.value<GLsizei>();auto const a5=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glMultiDrawElementsIndirectBindlessNV(a0,a1,a2,a3,a4,a5);}
+static void replay_glUniformMatrix3fv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.value<GLboolean>();auto const a3=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glUniformMatrix3fv(a0,a1,a2,a3);}
+static void replay_glGetnMapfvARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glGetnMapfvARB(a0,a1,a2,a3);}
+static void replay_glGetnUniformfv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glGetnUniformfv(a0,a1,a2,a3);}
+static void replay_glVertexAttribL2dv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glVertexAttribL2dv(a0,a1);}
+static void replay_glVertexWeightPointerEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<const void*>();if(replayer.isCorrupted())return;gl.glVertexWeightPointerEXT(a0,a1,a2,a3);}
+static void replay_glTangent3sEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLshort>();auto const a1=replayer.value<GLshort>();auto const a2=replayer.value<GLshort>();if(replayer.isCorrupted())return;gl.glTangent3sEXT(a0,a1,a2);}
+static void replay_glSecondaryColorPointer(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<const void*>();if(replayer.isCorrupted())return;gl.glSecondaryColorPointer(a0,a1,a2,a3);}
+static void replay_glAlphaFunc(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLclampf>();if(replayer.isCorrupted())return;gl.glAlphaFunc(a0,a1);}
+static void replay_glGetNamedStringARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.data<const GLchar*>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.output<GLint*>();auto const a4=replayer.output<GLchar*>();if(replayer.isCorrupted())return;gl.glGetNamedStringARB(a0,a1,a2,a3,a4);}
+static void replay_glTexCoord4d(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLdouble>();auto const a1=replayer.value<GLdouble>();auto const a2=replayer.value<GLdouble>();auto const a3=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glTexCoord4d(a0,a1,a2,a3);}
+static void replay_glBufferPageCommitmentARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLintptr>();auto const a2=replayer.value<GLsizeiptr>();auto const a3=replayer.value<GLboolean>();if(replayer.isCorrupted())return;gl.glBufferPageCommitmentARB(a0,a1,a2,a3);}
+static void replay_glProgramLocalParameters4fvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glProgramLocalParameters4fvEXT(a0,a1,a2,a3);}
+static void replay_glStencilFunc(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glStencilFunc(a0,a1,a2);}
+static void replay_glGetVertexAttribdvNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLdouble*>();if(replayer.isCorrupted())return;gl.glGetVertexAttribdvNV(a0,a1,a2);}
+static void replay_glTexCoord3dv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glTexCoord3dv(a0);}
+static void replay_glGetQueryBufferObjectiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLintptr>();if(replayer.isCorrupted())return;gl.glGetQueryBufferObjectiv(a0,a1,a2,a3);}
+static void replay_glTexGenxOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLfixed>();if(replayer.isCorrupted())return;gl.glTexGenxOES(a0,a1,a2);}
+static void replay_glMultiTexCoord1fvARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glMultiTexCoord1fvARB(a0,a1);}
+static void replay_glLightEnviSGIX(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glLightEnviSGIX(a0,a1);}
+static void replay_glGetProgramPipelineiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetProgramPipelineiv(a0,a1,a2);}
+static void replay_glVertexStream2ivATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glVertexStream2ivATI(a0,a1);}
+static void replay_glGetColorTableEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.output<void*>();if(replayer.isCorrupted())return;gl.glGetColorTableEXT(a0,a1,a2,a3);}
+static void replay_glGetShaderInfoLog(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.output<GLsizei*>();auto const a3=replayer.output<GLchar*>();if(replayer.isCorrupted())return;gl.glGetShaderInfoLog(a0,a1,a2,a3);}
+static void replay_glGetOcclusionQueryuivNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLuint*>();if(replayer.isCorrupted())return;gl.glGetOcclusionQueryuivNV(a0,a1,a2);}
+static void replay_glInvalidateNamedFramebufferSubData(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLenum*>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLint>();auto const a5=replayer.value<GLsizei>();auto const a6=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glInvalidateNamedFramebufferSubData(a0,a1,a2,a3,a4,a5,a6);}
+static void replay_glVertexAttribL1i64NV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint64EXT>();if(replayer.isCorrupted())return;gl.glVertexAttribL1i64NV(a0,a1);}
+static void replay_glVDPAUInitNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<const void*>();auto const a1=replayer.value<const void*>();if(replayer.isCorrupted())return;gl.glVDPAUInitNV(a0,a1);}
+static void replay_glVertexAttrib1hvNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLhalfNV*>();if(replayer.isCorrupted())return;gl.glVertexAttrib1hvNV(a0,a1);}
+static void replay_glVertexAttribI4i(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glVertexAttribI4i(a0,a1,a2,a3,a4);}
+static void replay_glRasterPos2iv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glRasterPos2iv(a0);}
+static void replay_glGetIntegerui64i_vNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.output<GLuint64EXT*>();if(replayer.isCorrupted())return;gl.glGetIntegerui64i_vNV(a0,a1,a2);}
+static void replay_glUniformHandleui64NV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLuint64>();if(replayer.isCorrupted())return;gl.glUniformHandleui64NV(a0,a1);}
+static void replay_glWindowPos3ivMESA(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glWindowPos3ivMESA(a0);}
+static void replay_glBlendEquationSeparate(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glBlendEquationSeparate(a0,a1);}
+static void replay_glDrawElementsInstancedARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<const void*>();auto const a4=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glDrawElementsInstancedARB(a0,a1,a2,a3,a4);}
+static void replay_glGetSubroutineIndex(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.data<const GLchar*>();if(replayer.isCorrupted())return;gl.glGetSubroutineIndex(a0,a1,a2);}
+static void replay_glVertexAttrib2sv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLshort*>();if(replayer.isCorrupted())return;gl.glVertexAttrib2sv(a0,a1);}
+static void replay_glSamplePatternSGIS(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glSamplePatternSGIS(a0);}
+static void replay_glEGLImageTargetRenderbufferStorageOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLeglImageOES>();if(replayer.isCorrupted())return;gl.glEGLImageTargetRenderbufferStorageOES(a0,a1);}
+static void replay_glPushAttrib(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLbitfield>();if(replayer.isCorrupted())return;gl.glPushAttrib(a0);}
+static void replay_glVertex3hNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLhalfNV>();auto const a1=replayer.value<GLhalfNV>();auto const a2=replayer.value<GLhalfNV>();if(replayer.isCorrupted())return;gl.glVertex3hNV(a0,a1,a2);}
+static void replay_glRasterPos3xvOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLfixed*>();if(replayer.isCorrupted())return;gl.glRasterPos3xvOES(a0);}
+static void replay_glPathParameterfNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glPathParameterfNV(a0,a1,a2);}
+static void replay_glGetUniformi64vNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.output<GLint64EXT*>();if(replayer.isCorrupted())return;gl.glGetUniformi64vNV(a0,a1,a2);}
+static void replay_glLightiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.null<const GLint*>();if(replayer.isCorrupted())return;gl.glLightiv(a0,a1,a2);}
+static void replay_glMaterialxvOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.null<const GLfixed*>();if(replayer.isCorrupted())return;gl.glMaterialxvOES(a0,a1,a2);}
+static void replay_glNamedProgramLocalParameter4fEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<GLfloat>();auto const a4=replayer.value<GLfloat>();auto const a5=replayer.value<GLfloat>();auto const a6=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glNamedProgramLocalParameter4fEXT(a0,a1,a2,a3,a4,a5,a6);}
+static void replay_glVertexAttribL1dEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glVertexAttribL1dEXT(a0,a1);}
+static void replay_glGetnUniformdvARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.output<GLdouble*>();if(replayer.isCorrupted())return;gl.glGetnUniformdvARB(a0,a1,a2,a3);}
+static void replay_glSecondaryColor3bEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLbyte>();auto const a1=replayer.value<GLbyte>();auto const a2=replayer.value<GLbyte>();if(replayer.isCorrupted())return;gl.glSecondaryColor3bEXT(a0,a1,a2);}
+static void replay_glBeginPerfQueryINTEL(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glBeginPerfQueryINTEL(a0);}
+static void replay_glProgramUniform1uivEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glProgramUniform1uivEXT(a0,a1,a2,a3);}
+static void replay_glImageTransformParameterivHP(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.null<const GLint*>();if(replayer.isCorrupted())return;gl.glImageTransformParameterivHP(a0,a1,a2);}
+static void replay_glDeleteBuffers(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glDeleteBuffers(a0,a1);}
+static void replay_glBindProgramPipeline(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glBindProgramPipeline(a0);}
+static void replay_glScissor(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glScissor(a0,a1,a2,a3);}
+static void replay_glProgramUniform4fv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glProgramUniform4fv(a0,a1,a2,a3);}
+static void replay_glGetBooleanv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.output<GLboolean*>();if(replayer.isCorrupted())return;gl.glGetBooleanv(a0,a1);}
+static void replay_glMaterialfv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.null<const GLfloat*>();if(replayer.isCorrupted())return;gl.glMaterialfv(a0,a1,a2);}
+static void replay_glWindowPos4fvMESA(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glWindowPos4fvMESA(a0);}
+static void replay_glVertexAttribIPointerEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.value<const void*>();if(replayer.isCorrupted())return;gl.glVertexAttribIPointerEXT(a0,a1,a2,a3,a4);}
+static void replay_glProgramBufferParametersfvNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glProgramBufferParametersfvNV(a0,a1,a2,a3,a4);}
+static void replay_glAlphaFuncxOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLfixed>();if(replayer.isCorrupted())return;gl.glAlphaFuncxOES(a0,a1);}
+static void replay_glMultiDrawArraysIndirectAMD(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<const void*>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glMultiDrawArraysIndirectAMD(a0,a1,a2,a3);}
+static void replay_glNormalStream3ivATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glNormalStream3ivATI(a0,a1);}
+static void replay_glTextureImage3DMultisampleNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLsizei>();auto const a5=replayer.value<GLsizei>();auto const a6=replayer.value<GLsizei>();auto const a7=replayer.value<GLboolean>();if(replayer.isCorrupted())return;gl.glTextureImage3DMultisampleNV(a0,a1,a2,a3,a4,a5,a6,a7);}
+static void replay_glProgramUniform4uivEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glProgramUniform4uivEXT(a0,a1,a2,a3);}
+static void replay_glReplacementCodeusvSUN(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.null<const GLushort*>();if(replayer.isCorrupted())return;gl.glReplacementCodeusvSUN(a0);}
+static void replay_glPollInstrumentsSGIX(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glPollInstrumentsSGIX(a0);}
+static void replay_glGetTextureLevelParameteriv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetTextureLevelParameteriv(a0,a1,a2,a3);}
+static void replay_glVertexAttribI2uiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glVertexAttribI2uiv(a0,a1);}
+static void replay_glMapControlPointsNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.value<GLsizei>();auto const a5=replayer.value<GLint>();auto const a6=replayer.value<GLint>();auto const a7=replayer.value<GLboolean>();auto const a8=replayer.value<const void*>();if(replayer.isCorrupted())return;gl.glMapControlPointsNV(a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+static void replay_glColor4dv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glColor4dv(a0);}
+static void replay_glInvalidateBufferSubData(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLintptr>();auto const a2=replayer.value<GLsizeiptr>();if(replayer.isCorrupted())return;gl.glInvalidateBufferSubData(a0,a1,a2);}
+static void replay_glMultiTexCoord1hNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLhalfNV>();if(replayer.isCorrupted())return;gl.glMultiTexCoord1hNV(a0,a1);}
+static void replay_glPointParameterfv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.null<const GLfloat*>();if(replayer.isCorrupted())return;gl.glPointParameterfv(a0,a1);}
+static void replay_glUniformMatrix2fvARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.value<GLboolean>();auto const a3=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glUniformMatrix2fvARB(a0,a1,a2,a3);}
+static void replay_glUniform2fv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glUniform2fv(a0,a1,a2);}
+static void replay_glVertexPointerListIBM(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<const void**>();auto const a4=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glVertexPointerListIBM(a0,a1,a2,a3,a4);}
+static void replay_glGetMultiTexGenfvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glGetMultiTexGenfvEXT(a0,a1,a2,a3);}
+static void replay_glGetMinmaxEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLboolean>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLenum>();auto const a4=replayer.output<void*>();if(replayer.isCorrupted())return;gl.glGetMinmaxEXT(a0,a1,a2,a3,a4);}
+static void replay_glIsFenceNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glIsFenceNV(a0);}
+static void replay_glMatrixFrustumEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLdouble>();auto const a2=replayer.value<GLdouble>();auto const a3=replayer.value<GLdouble>();auto const a4=replayer.value<GLdouble>();auto const a5=replayer.value<GLdouble>();auto const a6=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glMatrixFrustumEXT(a0,a1,a2,a3,a4,a5,a6);}
+static void replay_glDispatchComputeIndirect(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLintptr>();if(replayer.isCorrupted())return;gl.glDispatchComputeIndirect(a0);}
+static void replay_glMultiTexCoord4bOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLbyte>();auto const a2=replayer.value<GLbyte>();auto const a3=replayer.value<GLbyte>();auto const a4=replayer.value<GLbyte>();if(replayer.isCorrupted())return;gl.glMultiTexCoord4bOES(a0,a1,a2,a3,a4);}
+static void replay_glProgramEnvParameter4dARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLdouble>();auto const a3=replayer.value<GLdouble>();auto const a4=replayer.value<GLdouble>();auto const a5=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glProgramEnvParameter4dARB(a0,a1,a2,a3,a4,a5);}
+static void replay_glProgramUniform1uiEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glProgramUniform1uiEXT(a0,a1,a2);}
+static void replay_glBindBufferRange(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<GLintptr>();auto const a4=replayer.value<GLsizeiptr>();if(replayer.isCorrupted())return;gl.glBindBufferRange(a0,a1,a2,a3,a4);}
+static void replay_glNormal3iv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glNormal3iv(a0);}
+static void replay_glVertexAttribL3dv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glVertexAttribL3dv(a0,a1);}
+static void replay_glGetUniformdv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.output<GLdouble*>();if(replayer.isCorrupted())return;gl.glGetUniformdv(a0,a1,a2);}
+static void replay_glGetMultiTexLevelParameterfvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLenum>();auto const a4=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glGetMultiTexLevelParameterfvEXT(a0,a1,a2,a3,a4);}
+static void replay_glFinalCombinerInputNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glFinalCombinerInputNV(a0,a1,a2,a3);}
+static void replay_glCullParameterdvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.output<GLdouble*>();if(replayer.isCorrupted())return;gl.glCullParameterdvEXT(a0,a1);}
+static void replay_glMultiTexCoord4s(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLshort>();auto const a2=replayer.value<GLshort>();auto const a3=replayer.value<GLshort>();auto const a4=replayer.value<GLshort>();if(replayer.isCorrupted())return;gl.glMultiTexCoord4s(a0,a1,a2,a3,a4);}
+static void replay_glMapVertexAttrib1fAPPLE(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLfloat>();auto const a3=replayer.value<GLfloat>();auto const a4=replayer.value<GLint>();auto const a5=replayer.value<GLint>();auto const a6=replayer.null<const GLfloat*>();if(replayer.isCorrupted())return;gl.glMapVertexAttrib1fAPPLE(a0,a1,a2,a3,a4,a5,a6);}
+static void replay_glConvolutionParameterfEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glConvolutionParameterfEXT(a0,a1,a2);}
+static void replay_glTexCoord1iv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glTexCoord1iv(a0);}
+static void replay_glProgramUniform3fvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glProgramUniform3fvEXT(a0,a1,a2,a3);}
+static void replay_glColor3uiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glColor3uiv(a0);}
+static void replay_glListBase(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glListBase(a0);}
+static void replay_glTexCoord2bOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLbyte>();auto const a1=replayer.value<GLbyte>();if(replayer.isCorrupted())return;gl.glTexCoord2bOES(a0,a1);}
+static void replay_glBindMaterialParameterEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glBindMaterialParameterEXT(a0,a1);}
+static void replay_glGlobalAlphaFactorubSUN(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLubyte>();if(replayer.isCorrupted())return;gl.glGlobalAlphaFactorubSUN(a0);}
+static void replay_glVertexAttribL1ui64NV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint64EXT>();if(replayer.isCorrupted())return;gl.glVertexAttribL1ui64NV(a0,a1);}
+static void replay_glPointParameterfSGIS(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glPointParameterfSGIS(a0,a1);}
+static void replay_glGetImageTransformParameterivHP(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetImageTransformParameterivHP(a0,a1,a2);}
+static void replay_glColorSubTableEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLenum>();auto const a4=replayer.value<GLenum>();auto const a5=replayer.value<const void*>();if(replayer.isCorrupted())return;gl.glColorSubTableEXT(a0,a1,a2,a3,a4,a5);}
+static void replay_glPixelTexGenParameterfvSGIS(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.null<const GLfloat*>();if(replayer.isCorrupted())return;gl.glPixelTexGenParameterfvSGIS(a0,a1);}
+static void replay_glClientWaitSync(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.sync();auto const a1=replayer.value<GLbitfield>();auto const a2=replayer.value<GLuint64>();if(replayer.isCorrupted())return;gl.glClientWaitSync(a0,a1,a2);}
+static void replay_glQueryObjectParameteruiAMD(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glQueryObjectParameteruiAMD(a0,a1,a2,a3);}
+static void replay_glVertexAttribs1fvNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glVertexAttribs1fvNV(a0,a1,a2);}
+static void replay_glVertexAttrib4NusvARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLushort*>();if(replayer.isCorrupted())return;gl.glVertexAttrib4NusvARB(a0,a1);}
+static void replay_glVariantPointerEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<const void*>();if(replayer.isCorrupted())return;gl.glVariantPointerEXT(a0,a1,a2,a3);}
+static void replay_glTextureBuffer(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glTextureBuffer(a0,a1,a2);}
+static void replay_glVertexAttribI1uiEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glVertexAttribI1uiEXT(a0,a1);}
+static void replay_glInvalidateTexImage(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glInvalidateTexImage(a0,a1);}
+static void replay_glProgramEnvParametersI4ivNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glProgramEnvParametersI4ivNV(a0,a1,a2,a3);}
+static void replay_glPathGlyphIndexArrayNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<const void*>();auto const a3=replayer.value<GLbitfield>();auto const a4=replayer.value<GLuint>();auto const a5=replayer.value<GLsizei>();auto const a6=replayer.value<GLuint>();auto const a7=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glPathGlyphIndexArrayNV(a0,a1,a2,a3,a4,a5,a6,a7);}
+static void replay_glCopyImageSubData(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLint>();auto const a5=replayer.value<GLint>();auto const a6=replayer.value<GLuint>();auto const a7=replayer.value<GLenum>();auto const a8=replayer.value<GLint>();auto const a9=replayer.value<GLint>();auto const a10=replayer.value<GLint>();auto const a11=replayer.value<GLint>();auto const a12=replayer.value<GLsizei>();auto const a13=replayer.value<GLsizei>();auto const a14=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glCopyImageSubData(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14);}
+static void replay_glGetUniformSubroutineuiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();auto const a2=replayer.output<GLuint*>();if(replayer.isCorrupted())return;gl.glGetUniformSubroutineuiv(a0,a1,a2);}
+static void replay_glBindVertexBuffer(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLintptr>();auto const a3=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glBindVertexBuffer(a0,a1,a2,a3);}
+static void replay_glMultiTexCoord1iARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glMultiTexCoord1iARB(a0,a1);}
+static void replay_glDebugMessageInsert(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<GLenum>();auto const a4=replayer.value<GLsizei>();auto const a5=replayer.data<const GLchar*>();if(replayer.isCorrupted())return;gl.glDebugMessageInsert(a0,a1,a2,a3,a4,a5);}
+static void replay_glBeginVertexShaderEXT(FunctionTable const&gl,CallReplayer&replayer){if(replayer.isCorrupted())return;gl.glBeginVertexShaderEXT();}
+static void replay_glIsVariantEnabledEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glIsVariantEnabledEXT(a0,a1);}
+static void replay_glPassThroughxOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfixed>();if(replayer.isCorrupted())return;gl.glPassThroughxOES(a0);}
+static void replay_glIsSampler(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glIsSampler(a0);}
+static void replay_glConservativeRasterParameterfNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glConservativeRasterParameterfNV(a0,a1);}
+static void replay_glMultiTexGenivEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.null<const GLint*>();if(replayer.isCorrupted())return;gl.glMultiTexGenivEXT(a0,a1,a2,a3);}
+static void replay_glNamedFramebufferTexture2DEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLuint>();auto const a4=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glNamedFramebufferTexture2DEXT(a0,a1,a2,a3,a4);}
+static void replay_glCopyTexSubImage1D(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLint>();auto const a5=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glCopyTexSubImage1D(a0,a1,a2,a3,a4,a5);}
+static void replay_glTexCoord1i(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glTexCoord1i(a0);}
+static void replay_glCheckFramebufferStatus(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glCheckFramebufferStatus(a0);}
+static void replay_glDrawElementArrayAPPLE(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glDrawElementArrayAPPLE(a0,a1,a2);}
+static void replay_glTexCoord1d(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glTexCoord1d(a0);}
+static void replay_glTexCoord1f(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glTexCoord1f(a0);}
+static void replay_glFragmentLightivSGIX(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.null<const GLint*>();if(replayer.isCorrupted())return;gl.glFragmentLightivSGIX(a0,a1,a2);}
+static void replay_glBindImageTexture(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLboolean>();auto const a4=replayer.value<GLint>();auto const a5=replayer.value<GLenum>();auto const a6=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glBindImageTexture(a0,a1,a2,a3,a4,a5,a6);}
+static void replay_glTransformFeedbackVaryings(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLsizei>();auto const a2=(const GLchar*const*)replayer.strings();auto const a3=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glTransformFeedbackVaryings(a0,a1,a2,a3);}
+static void replay_glDrawRangeElements(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.value<GLenum>();auto const a5=replayer.value<const GLvoid*>();if(replayer.isCorrupted())return;gl.glDrawRangeElements(a0,a1,a2,a3,a4,a5);}
+static void replay_glTexCoord1s(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLshort>();if(replayer.isCorrupted())return;gl.glTexCoord1s(a0);}
+static void replay_glBindBufferBase(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glBindBufferBase(a0,a1,a2);}
+static void replay_glColor3bv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLbyte*>();if(replayer.isCorrupted())return;gl.glColor3bv(a0);}
+static void replay_glSyncTextureINTEL(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glSyncTextureINTEL(a0);}
+static void replay_glCreateSamplers(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.output<GLuint*>();if(replayer.isCorrupted())return;gl.glCreateSamplers(a0,a1);replayer.checkNames(a1);}
+static void replay_glCombinerParameterfNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glCombinerParameterfNV(a0,a1);}
+static void replay_glGetArrayObjectivATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetArrayObjectivATI(a0,a1,a2);}
+static void replay_glMultiDrawArrays(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLint*>();auto const a2=replayer.data<const GLsizei*>();auto const a3=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glMultiDrawArrays(a0,a1,a2,a3);}
+static void replay_glSampleMapATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glSampleMapATI(a0,a1,a2);}
+static void replay_glProgramUniform2i64ARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint64>();auto const a3=replayer.value<GLint64>();if(replayer.isCorrupted())return;gl.glProgramUniform2i64ARB(a0,a1,a2,a3);}
+static void replay_glBinormal3ivEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glBinormal3ivEXT(a0);}
+static void replay_glMultiDrawArraysIndirectCountARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLintptr>();auto const a2=replayer.value<GLintptr>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glMultiDrawArraysIndirectCountARB(a0,a1,a2,a3,a4);}
+static void replay_glUniformBufferEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glUniformBufferEXT(a0,a1,a2);}
+static void replay_glWindowPos2ivMESA(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glWindowPos2ivMESA(a0);}
+static void replay_glTexCoordP4ui(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glTexCoordP4ui(a0,a1);}
+static void replay_glMultiTexSubImage1DEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLsizei>();auto const a5=replayer.value<GLenum>();auto const a6=replayer.value<GLenum>();auto const a7=replayer.value<const void*>();if(replayer.isCorrupted())return;gl.glMultiTexSubImage1DEXT(a0,a1,a2,a3,a4,a5,a6,a7);}
+static void replay_glProgramUniformMatrix2x3fvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLboolean>();auto const a4=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glProgramUniformMatrix2x3fvEXT(a0,a1,a2,a3,a4);}
+static void replay_glBufferDataARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLsizeiptrARB>();auto const a2=replayer.data<const void*>();auto const a3=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glBufferDataARB(a0,a1,a2,a3);}
+static void replay_glVertexAttribIFormat(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glVertexAttribIFormat(a0,a1,a2,a3);}
+static void replay_glCreateFramebuffers(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.output<GLuint*>();if(replayer.isCorrupted())return;gl.glCreateFramebuffers(a0,a1);replayer.checkNames(a1);}
+static void replay_glNormalStream3dvATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glNormalStream3dvATI(a0,a1);}
+static void replay_glClearAccum(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfloat>();auto const a1=replayer.value<GLfloat>();auto const a2=replayer.value<GLfloat>();auto const a3=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glClearAccum(a0,a1,a2,a3);}
+static void replay_glUniform3i64vNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLint64EXT*>();if(replayer.isCorrupted())return;gl.glUniform3i64vNV(a0,a1,a2);}
+static void replay_glNormal3fVertex3fSUN(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfloat>();auto const a1=replayer.value<GLfloat>();auto const a2=replayer.value<GLfloat>();auto const a3=replayer.value<GLfloat>();auto const a4=replayer.value<GLfloat>();auto const a5=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glNormal3fVertex3fSUN(a0,a1,a2,a3,a4,a5);}
+static void replay_glUniform2uivEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glUniform2uivEXT(a0,a1,a2);}
+static void replay_glBeginQuery(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glBeginQuery(a0,a1);}
+static void replay_glStencilThenCoverStrokePathInstancedNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<const void*>();auto const a3=replayer.value<GLuint>();auto const a4=replayer.value<GLint>();auto const a5=replayer.value<GLuint>();auto const a6=replayer.value<GLenum>();auto const a7=replayer.value<GLenum>();auto const a8=replayer.null<const GLfloat*>();if(replayer.isCorrupted())return;gl.glStencilThenCoverStrokePathInstancedNV(a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+static void replay_glBindBuffer(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glBindBuffer(a0,a1);}
+static void replay_glMap2d(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLdouble>();auto const a2=replayer.value<GLdouble>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLint>();auto const a5=replayer.value<GLdouble>();auto const a6=replayer.value<GLdouble>();auto const a7=replayer.value<GLint>();auto const a8=replayer.value<GLint>();auto const a9=replayer.null<const GLdouble*>();if(replayer.isCorrupted())return;gl.glMap2d(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}
+static void replay_glMap2f(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLfloat>();auto const a2=replayer.value<GLfloat>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLint>();auto const a5=replayer.value<GLfloat>();auto const a6=replayer.value<GLfloat>();auto const a7=replayer.value<GLint>();auto const a8=replayer.value<GLint>();auto const a9=replayer.null<const GLfloat*>();if(replayer.isCorrupted())return;gl.glMap2f(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}
+static void replay_glMakeImageHandleResidentNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint64>();auto const a1=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glMakeImageHandleResidentNV(a0,a1);}
+static void replay_glUniformMatrix2x4fv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.value<GLboolean>();auto const a3=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glUniformMatrix2x4fv(a0,a1,a2,a3);}
+static void replay_glGetMultiTexParameterfvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glGetMultiTexParameterfvEXT(a0,a1,a2,a3);}
+static void replay_glDepthRangeIndexed(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLdouble>();auto const a2=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glDepthRangeIndexed(a0,a1,a2);}
+static void replay_glMultiTexCoord1s(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLshort>();if(replayer.isCorrupted())return;gl.glMultiTexCoord1s(a0,a1);}
+static void replay_glMatrixScalefEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLfloat>();auto const a2=replayer.value<GLfloat>();auto const a3=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glMatrixScalefEXT(a0,a1,a2,a3);}
+static void replay_glGetError(FunctionTable const&gl,CallReplayer&replayer){if(replayer.isCorrupted())return;gl.glGetError();}
+static void replay_glGetTexEnviv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetTexEnviv(a0,a1,a2);}
+static void replay_glBindTextureUnitParameterEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glBindTextureUnitParameterEXT(a0,a1);}
+static void replay_glGetnUniformfvARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glGetnUniformfvARB(a0,a1,a2,a3);}
+static void replay_glReplacementCodeuiNormal3fVertex3fvSUN(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLuint*>();auto const a1=replayer.data<const GLfloat*>();auto const a2=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glReplacementCodeuiNormal3fVertex3fvSUN(a0,a1,a2);}
+static void replay_glDeletePerfQueryINTEL(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glDeletePerfQueryINTEL(a0);}
+static void replay_glActiveVaryingNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLchar*>();if(replayer.isCorrupted())return;gl.glActiveVaryingNV(a0,a1);}
+static void replay_glGetActiveUniformARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLhandleARB>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.output<GLsizei*>();auto const a4=replayer.output<GLint*>();auto const a5=replayer.output<GLenum*>();auto const a6=replayer.output<GLcharARB*>();if(replayer.isCorrupted())return;gl.glGetActiveUniformARB(a0,a1,a2,a3,a4,a5,a6);}
+static void replay_glVertexAttribI3ivEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glVertexAttribI3ivEXT(a0,a1);}
+static void replay_glEvalCoord1d(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glEvalCoord1d(a0);}
+static void replay_glNamedCopyBufferSubDataEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLintptr>();auto const a3=replayer.value<GLintptr>();auto const a4=replayer.value<GLsizeiptr>();if(replayer.isCorrupted())return;gl.glNamedCopyBufferSubDataEXT(a0,a1,a2,a3,a4);}
+static void replay_glEvalCoord1f(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glEvalCoord1f(a0);}
+static void replay_glPixelMapfv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.null<const GLfloat*>();if(replayer.isCorrupted())return;gl.glPixelMapfv(a0,a1,a2);}
+static void replay_glVertexAttribI1ivEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glVertexAttribI1ivEXT(a0,a1);}
+static void replay_glCreateSyncFromCLeventARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.output<struct _cl_context*>();auto const a1=replayer.output<struct _cl_event*>();auto const a2=replayer.value<GLbitfield>();if(replayer.isCorrupted())return;auto const result=gl.glCreateSyncFromCLeventARB(a0,a1,a2);replayer.syncResult(result);}
+static void replay_glGetPixelMapusv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.output<GLushort*>();if(replayer.isCorrupted())return;gl.glGetPixelMapusv(a0,a1);}
+static void replay_glGetnColorTableARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.output<void*>();if(replayer.isCorrupted())return;gl.glGetnColorTableARB(a0,a1,a2,a3,a4);}
+static void replay_glAccum(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glAccum(a0,a1);}
+static void replay_glRasterPos3sv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLshort*>();if(replayer.isCorrupted())return;gl.glRasterPos3sv(a0);}
+static void replay_glTexCoord2iv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glTexCoord2iv(a0);}
+static void replay_glBlendFunciARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glBlendFunciARB(a0,a1,a2);}
+static void replay_glProgramUniform3i64vARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.data<const GLint64*>();if(replayer.isCorrupted())return;gl.glProgramUniform3i64vARB(a0,a1,a2,a3);}
+static void replay_glGetFramebufferAttachmentParameteriv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetFramebufferAttachmentParameteriv(a0,a1,a2,a3);}
+static void replay_glProgramUniform4ui(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<GLuint>();auto const a4=replayer.value<GLuint>();auto const a5=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glProgramUniform4ui(a0,a1,a2,a3,a4,a5);}
+static void replay_glStencilMask(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glStencilMask(a0);}
+static void replay_glResetHistogramEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glResetHistogramEXT(a0);}
+static void replay_glLightxOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLfixed>();if(replayer.isCorrupted())return;gl.glLightxOES(a0,a1,a2);}
+static void replay_glNamedBufferData(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLsizeiptr>();auto const a2=replayer.data<const void*>();auto const a3=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glNamedBufferData(a0,a1,a2,a3);}
+static void replay_glVertexStream3sATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLshort>();auto const a2=replayer.value<GLshort>();auto const a3=replayer.value<GLshort>();if(replayer.isCorrupted())return;gl.glVertexStream3sATI(a0,a1,a2,a3);}
+static void replay_glVertexAttrib3fvARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glVertexAttrib3fvARB(a0,a1);}
+static void replay_glClearNamedBufferSubData(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLintptr>();auto const a3=replayer.value<GLsizeiptr>();auto const a4=replayer.value<GLenum>();auto const a5=replayer.value<GLenum>();auto const a6=replayer.data<const void*>();if(replayer.isCorrupted())return;gl.glClearNamedBufferSubData(a0,a1,a2,a3,a4,a5,a6);}
+static void replay_glProgramUniformHandleui64ARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLuint64>();if(replayer.isCorrupted())return;gl.glProgramUniformHandleui64ARB(a0,a1,a2);}
+static void replay_glUniform3iARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glUniform3iARB(a0,a1,a2,a3);}
+static void replay_glCreateProgramObjectARB(FunctionTable const&gl,CallReplayer&replayer){if(replayer.isCorrupted())return;gl.glCreateProgramObjectARB();}
+static void replay_glMultiTexCoord1dvARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glMultiTexCoord1dvARB(a0,a1);}
+static void replay_glGetObjectParameterfvARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLhandleARB>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glGetObjectParameterfvARB(a0,a1,a2);}
+static void replay_glRectsv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.null<const GLshort*>();auto const a1=replayer.null<const GLshort*>();if(replayer.isCorrupted())return;gl.glRectsv(a0,a1);}
+static void replay_glMultiTexImage2DEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLsizei>();auto const a5=replayer.value<GLsizei>();auto const a6=replayer.value<GLint>();auto const a7=replayer.value<GLenum>();auto const a8=replayer.value<GLenum>();auto const a9=replayer.value<const void*>();if(replayer.isCorrupted())return;gl.glMultiTexImage2DEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}
+static void replay_glProgramUniform1i64NV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint64EXT>();if(replayer.isCorrupted())return;gl.glProgramUniform1i64NV(a0,a1,a2);}
+static void replay_glGetObjectBufferivATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetObjectBufferivATI(a0,a1,a2);}
+static void replay_glUniform4i64ARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLint64>();auto const a2=replayer.value<GLint64>();auto const a3=replayer.value<GLint64>();auto const a4=replayer.value<GLint64>();if(replayer.isCorrupted())return;gl.glUniform4i64ARB(a0,a1,a2,a3,a4);}
+static void replay_glReplacementCodeuiColor4ubVertex3fvSUN(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLuint*>();auto const a1=replayer.data<const GLubyte*>();auto const a2=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glReplacementCodeuiColor4ubVertex3fvSUN(a0,a1,a2);}
+static void replay_glBlendFuncSeparateINGR(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glBlendFuncSeparateINGR(a0,a1,a2,a3);}
+static void replay_glGetVideoCaptureStreamfvNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glGetVideoCaptureStreamfvNV(a0,a1,a2,a3);}
+static void replay_glVertexAttrib2fARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLfloat>();auto const a2=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glVertexAttrib2fARB(a0,a1,a2);}
+static void replay_glGetTexGeniv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetTexGeniv(a0,a1,a2);}
+static void replay_glPixelStorei(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glPixelStorei(a0,a1);}
+static void replay_glGetCompressedTextureSubImage(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLint>();auto const a5=replayer.value<GLsizei>();auto const a6=replayer.value<GLsizei>();auto const a7=replayer.value<GLsizei>();auto const a8=replayer.value<GLsizei>();auto const a9=replayer.output<void*>();if(replayer.isCorrupted())return;gl.glGetCompressedTextureSubImage(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}
+static void replay_glCopyImageSubDataNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLint>();auto const a5=replayer.value<GLint>();auto const a6=replayer.value<GLuint>();auto const a7=replayer.value<GLenum>();auto const a8=replayer.value<GLint>();auto const a9=replayer.value<GLint>();auto const a10=replayer.value<GLint>();auto const a11=replayer.value<GLint>();auto const a12=replayer.value<GLsizei>();auto const a13=replayer.value<GLsizei>();auto const a14=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glCopyImageSubDataNV(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14);}
+static void replay_glActiveShaderProgram(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glActiveShaderProgram(a0,a1);}
+static void replay_glVertexStream1iATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glVertexStream1iATI(a0,a1);}
+static void replay_glPatchParameterfv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glPatchParameterfv(a0,a1);}
+static void replay_glIsFramebufferEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glIsFramebufferEXT(a0);}
+static void replay_glTextureStorage2D(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glTextureStorage2D(a0,a1,a2,a3,a4);}
+static void replay_glProgramUniform1ui64ARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLuint64>();if(replayer.isCorrupted())return;gl.glProgramUniform1ui64ARB(a0,a1,a2);}
+static void replay_glTexBufferRange(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<GLintptr>();auto const a4=replayer.value<GLsizeiptr>();if(replayer.isCorrupted())return;gl.glTexBufferRange(a0,a1,a2,a3,a4);}
+static void replay_glGetPixelTexGenParameterivSGIS(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetPixelTexGenParameterivSGIS(a0,a1);}
+static void replay_glTextureSubImage3DEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLint>();auto const a5=replayer.value<GLint>();auto const a6=replayer.value<GLsizei>();auto const a7=replayer.value<GLsizei>();auto const a8=replayer.value<GLsizei>();auto const a9=replayer.value<GLenum>();auto const a10=replayer.value<GLenum>();auto const a11=replayer.pixels<const void*>();if(replayer.isCorrupted())return;gl.glTextureSubImage3DEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11);}
+static void replay_glClipControl(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glClipControl(a0,a1);}
+static void replay_glGetProgramResourceiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.data<const GLenum*>();auto const a5=replayer.value<GLsizei>();auto const a6=replayer.output<GLsizei*>();auto const a7=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetProgramResourceiv(a0,a1,a2,a3,a4,a5,a6,a7);}
+static void replay_glMultiTexCoordP2uiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glMultiTexCoordP2uiv(a0,a1,a2);}
+static void replay_glVertexAttribI3ui(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glVertexAttribI3ui(a0,a1,a2,a3);}
+static void replay_glSampleMaskSGIS(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLclampf>();auto const a1=replayer.value<GLboolean>();if(replayer.isCorrupted())return;gl.glSampleMaskSGIS(a0,a1);}
+static void replay_glVertexAttrib4NivARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glVertexAttrib4NivARB(a0,a1);}
+static void replay_glGlobalAlphaFactorfSUN(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glGlobalAlphaFactorfSUN(a0);}
+static void replay_glBlendEquationSeparateIndexedAMD(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glBlendEquationSeparateIndexedAMD(a0,a1,a2);}
+static void replay_glGetPerfCounterInfoINTEL(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.output<GLchar*>();auto const a4=replayer.value<GLuint>();auto const a5=replayer.output<GLchar*>();auto const a6=replayer.output<GLuint*>();auto const a7=replayer.output<GLuint*>();auto const a8=replayer.output<GLuint*>();auto const a9=replayer.output<GLuint*>();auto const a10=replayer.output<GLuint64*>();if(replayer.isCorrupted())return;gl.glGetPerfCounterInfoINTEL(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10);}
+static void replay_glDeleteProgramsNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glDeleteProgramsNV(a0,a1);}
+static void replay_glPixelZoomxOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfixed>();auto const a1=replayer.value<GLfixed>();if(replayer.isCorrupted())return;gl.glPixelZoomxOES(a0,a1);}
+static void replay_glGetCombinerOutputParameterivNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetCombinerOutputParameterivNV(a0,a1,a2,a3);}
+static void replay_glRasterPos2xvOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLfixed*>();if(replayer.isCorrupted())return;gl.glRasterPos2xvOES(a0);}
+static void replay_glGetTexImage(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLenum>();auto const a4=replayer.output<GLvoid*>();if(replayer.isCorrupted())return;gl.glGetTexImage(a0,a1,a2,a3,a4);}
+static void replay_glVertexArrayVertexBuffers(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.data<const GLuint*>();auto const a4=replayer.data<const GLintptr*>();auto const a5=replayer.data<const GLsizei*>();if(replayer.isCorrupted())return;gl.glVertexArrayVertexBuffers(a0,a1,a2,a3,a4,a5);}
+static void replay_glUniform1ui64NV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLuint64EXT>();if(replayer.isCorrupted())return;gl.glUniform1ui64NV(a0,a1);}
+static void replay_glProgramParameteri(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glProgramParameteri(a0,a1,a2);}
+static void replay_glNormal3xOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfixed>();auto const a1=replayer.value<GLfixed>();auto const a2=replayer.value<GLfixed>();if(replayer.isCorrupted())return;gl.glNormal3xOES(a0,a1,a2);}
+static void replay_glGetMapfv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glGetMapfv(a0,a1,a2);}
+static void replay_glVertexStream2dvATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glVertexStream2dvATI(a0,a1);}
+static void replay_glPathStencilDepthOffsetNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfloat>();auto const a1=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glPathStencilDepthOffsetNV(a0,a1);}
+static void replay_glIsStateNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glIsStateNV(a0);}
+static void replay_glGetIntegerui64vNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.output<GLuint64EXT*>();if(replayer.isCorrupted())return;gl.glGetIntegerui64vNV(a0,a1);}
+static void replay_glGetImageTransformParameterfvHP(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glGetImageTransformParameterfvHP(a0,a1,a2);}
+static void replay_glRasterPos2fv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glRasterPos2fv(a0);}
+static void replay_glVertex3xOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfixed>();auto const a1=replayer.value<GLfixed>();if(replayer.isCorrupted())return;gl.glVertex3xOES(a0,a1);}
+static void replay_glProgramUniform2dvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glProgramUniform2dvEXT(a0,a1,a2,a3);}
+static void replay_glWeightPointerARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<const void*>();if(replayer.isCorrupted())return;gl.glWeightPointerARB(a0,a1,a2,a3);}
+static void replay_glFinishFenceNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glFinishFenceNV(a0);}
+static void replay_glDepthRangexOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfixed>();auto const a1=replayer.value<GLfixed>();if(replayer.isCorrupted())return;gl.glDepthRangexOES(a0,a1);}
+static void replay_glEnableVertexArrayAttribEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glEnableVertexArrayAttribEXT(a0,a1);}
+static void replay_glProgramUniform2uivEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glProgramUniform2uivEXT(a0,a1,a2,a3);}
+static void replay_glGetDoubleIndexedvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.output<GLdouble*>();if(replayer.isCorrupted())return;gl.glGetDoubleIndexedvEXT(a0,a1,a2);}
+static void replay_glWindowPos2fMESA(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfloat>();auto const a1=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glWindowPos2fMESA(a0,a1);}
+static void replay_glSecondaryColor3b(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLbyte>();auto const a1=replayer.value<GLbyte>();auto const a2=replayer.value<GLbyte>();if(replayer.isCorrupted())return;gl.glSecondaryColor3b(a0,a1,a2);}
+static void replay_glCopyConvolutionFilter1DEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glCopyConvolutionFilter1DEXT(a0,a1,a2,a3,a4);}
+static void replay_glWindowPos2sv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLshort*>();if(replayer.isCorrupted())return;gl.glWindowPos2sv(a0);}
+static void replay_glBindFramebufferEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glBindFramebufferEXT(a0,a1);}
+static void replay_glCreateShader(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();if(replayer.isCorrupted())return;auto const result=gl.glCreateShader(a0);replayer.checkName(result);}
+static void replay_glGenPathsNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glGenPathsNV(a0);}
+static void replay_glGenRenderbuffers(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.output<GLuint*>();if(replayer.isCorrupted())return;gl.glGenRenderbuffers(a0,a1);replayer.checkNames(a1);}
+static void replay_glCopyTexSubImage2D(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLint>();auto const a5=replayer.value<GLint>();auto const a6=replayer.value<GLsizei>();auto const a7=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glCopyTexSubImage2D(a0,a1,a2,a3,a4,a5,a6,a7);}
+static void replay_glVertexAttrib4ubvARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLubyte*>();if(replayer.isCorrupted())return;gl.glVertexAttrib4ubvARB(a0,a1);}
+static void replay_glDrawTextureNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLfloat>();auto const a3=replayer.value<GLfloat>();auto const a4=replayer.value<GLfloat>();auto const a5=replayer.value<GLfloat>();auto const a6=replayer.value<GLfloat>();auto const a7=replayer.value<GLfloat>();auto const a8=replayer.value<GLfloat>();auto const a9=replayer.value<GLfloat>();auto const a10=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glDrawTextureNV(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10);}
+static void replay_glVertexAttribs1svNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLshort*>();if(replayer.isCorrupted())return;gl.glVertexAttribs1svNV(a0,a1,a2);}
+static void replay_glClearNamedBufferSubDataEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLsizeiptr>();auto const a3=replayer.value<GLsizeiptr>();auto const a4=replayer.value<GLenum>();auto const a5=replayer.value<GLenum>();auto const a6=replayer.data<const void*>();if(replayer.isCorrupted())return;gl.glClearNamedBufferSubDataEXT(a0,a1,a2,a3,a4,a5,a6);}
+static void replay_glBlendFuncSeparate(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glBlendFuncSeparate(a0,a1,a2,a3);}
+static void replay_glPointParameterfARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glPointParameterfARB(a0,a1);}
+static void replay_glTexCoord2fv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glTexCoord2fv(a0);}
+static void replay_glGetVariantFloatvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glGetVariantFloatvEXT(a0,a1,a2);}
+static void replay_glVertexP2ui(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glVertexP2ui(a0,a1);}
+static void replay_glWindowPos2dMESA(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLdouble>();auto const a1=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glWindowPos2dMESA(a0,a1);}
+static void replay_glTexCoord4fv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glTexCoord4fv(a0);}
+static void replay_glBindFragDataLocationEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.data<const GLchar*>();if(replayer.isCorrupted())return;gl.glBindFragDataLocationEXT(a0,a1,a2);}
+static void replay_glCompressedTexSubImage1DARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.value<GLenum>();auto const a5=replayer.value<GLsizei>();auto const a6=replayer.value<const void*>();if(replayer.isCorrupted())return;gl.glCompressedTexSubImage1DARB(a0,a1,a2,a3,a4,a5,a6);}
+static void replay_glGetTextureImageEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLenum>();auto const a4=replayer.value<GLenum>();auto const a5=replayer.output<void*>();if(replayer.isCorrupted())return;gl.glGetTextureImageEXT(a0,a1,a2,a3,a4,a5);}
+static void replay_glFogCoordd(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glFogCoordd(a0);}
+static void replay_glPointSize(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glPointSize(a0);}
+static void replay_glBindTextureUnit(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glBindTextureUnit(a0,a1);}
+static void replay_glProgramEnvParameterI4uiNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<GLuint>();auto const a4=replayer.value<GLuint>();auto const a5=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glProgramEnvParameterI4uiNV(a0,a1,a2,a3,a4,a5);}
+static void replay_glGetProgramPipelineInfoLog(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.output<GLsizei*>();auto const a3=replayer.output<GLchar*>();if(replayer.isCorrupted())return;gl.glGetProgramPipelineInfoLog(a0,a1,a2,a3);}
+static void replay_glProgramUniform4i64vARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.data<const GLint64*>();if(replayer.isCorrupted())return;gl.glProgramUniform4i64vARB(a0,a1,a2,a3);}
+static void replay_glVertexAttrib4Nuiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glVertexAttrib4Nuiv(a0,a1);}
+static void replay_glGetUniformfvARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLhandleARB>();auto const a1=replayer.value<GLint>();auto const a2=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glGetUniformfvARB(a0,a1,a2);}
+static void replay_glWaitSync(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.sync();auto const a1=replayer.value<GLbitfield>();auto const a2=replayer.value<GLuint64>();if(replayer.isCorrupted())return;gl.glWaitSync(a0,a1,a2);}
+static void replay_glUniform3i(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glUniform3i(a0,a1,a2,a3);}
+static void replay_glBlendEquationSeparatei(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glBlendEquationSeparatei(a0,a1,a2);}
+static void replay_glVertexAttrib2hvNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLhalfNV*>();if(replayer.isCorrupted())return;gl.glVertexAttrib2hvNV(a0,a1);}
+static void replay_glTextureParameterivEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glTextureParameterivEXT(a0,a1,a2,a3);}
+static void replay_glUniform3d(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLdouble>();auto const a2=replayer.value<GLdouble>();auto const a3=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glUniform3d(a0,a1,a2,a3);}
+static void replay_glUniform3f(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLfloat>();auto const a2=replayer.value<GLfloat>();auto const a3=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glUniform3f(a0,a1,a2,a3);}
+static void replay_glActiveProgramEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glActiveProgramEXT(a0);}
+static void replay_glDeleteVertexArrays(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glDeleteVertexArrays(a0,a1);}
+static void replay_glUniform3ui64vARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLuint64*>();if(replayer.isCorrupted())return;gl.glUniform3ui64vARB(a0,a1,a2);}
+static void replay_glProgramUniform1ui64vARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.data<const GLuint64*>();if(replayer.isCorrupted())return;gl.glProgramUniform1ui64vARB(a0,a1,a2,a3);}
+static void replay_glTextureParameterfEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glTextureParameterfEXT(a0,a1,a2,a3);}
+static void replay_glSetFragmentShaderConstantATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.null<const GLfloat*>();if(replayer.isCorrupted())return;gl.glSetFragmentShaderConstantATI(a0,a1);}
+static void replay_glColorSubTable(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLenum>();auto const a4=replayer.value<GLenum>();auto const a5=replayer.value<const GLvoid*>();if(replayer.isCorrupted())return;gl.glColorSubTable(a0,a1,a2,a3,a4,a5);}
+static void replay_glReplacementCodeuiSUN(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glReplacementCodeuiSUN(a0);}
+static void replay_glStateCaptureNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glStateCaptureNV(a0,a1);}
+static void replay_glBindAttribLocation(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.data<const GLchar*>();if(replayer.isCorrupted())return;gl.glBindAttribLocation(a0,a1,a2);}
+static void replay_glWeightusvARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.data<const GLushort*>();if(replayer.isCorrupted())return;gl.glWeightusvARB(a0,a1);}
+static void replay_glGetFragDataIndex(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLchar*>();if(replayer.isCorrupted())return;gl.glGetFragDataIndex(a0,a1);}
+static void replay_glMultiTexCoord2xOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLfixed>();auto const a2=replayer.value<GLfixed>();if(replayer.isCorrupted())return;gl.glMultiTexCoord2xOES(a0,a1,a2);}
+static void replay_glColor3sv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLshort*>();if(replayer.isCorrupted())return;gl.glColor3sv(a0);}
+static void replay_glTexCoord2fVertex3fSUN(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfloat>();auto const a1=replayer.value<GLfloat>();auto const a2=replayer.value<GLfloat>();auto const a3=replayer.value<GLfloat>();auto const a4=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glTexCoord2fVertex3fSUN(a0,a1,a2,a3,a4);}
+static void replay_glPolygonOffsetEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfloat>();auto const a1=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glPolygonOffsetEXT(a0,a1);}
+static void replay_glWeightPathsNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.null<const GLuint*>();auto const a3=replayer.null<const GLfloat*>();if(replayer.isCorrupted())return;gl.glWeightPathsNV(a0,a1,a2,a3);}
+static void replay_glCombinerStageParameterfvNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.null<const GLfloat*>();if(replayer.isCorrupted())return;gl.glCombinerStageParameterfvNV(a0,a1,a2);}
+static void replay_glPointParameterfEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glPointParameterfEXT(a0,a1);}
+static void replay_glCopyTexImage1DEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLint>();auto const a5=replayer.value<GLsizei>();auto const a6=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glCopyTexImage1DEXT(a0,a1,a2,a3,a4,a5,a6);}
+static void replay_glVertex4sv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLshort*>();if(replayer.isCorrupted())return;gl.glVertex4sv(a0);}
+static void replay_glMatrixMultfEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glMatrixMultfEXT(a0,a1);}
+static void replay_glCompressedTextureSubImage3DEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLint>();auto const a5=replayer.value<GLint>();auto const a6=replayer.value<GLsizei>();auto const a7=replayer.value<GLsizei>();auto const a8=replayer.value<GLsizei>();auto const a9=replayer.value<GLenum>();auto const a10=replayer.value<GLsizei>();auto const a11=replayer.pixels<const void*>();if(replayer.isCorrupted())return;gl.glCompressedTextureSubImage3DEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11);}
+static void replay_glGetTexLevelParameterxvOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.output<GLfixed*>();if(replayer.isCorrupted())return;gl.glGetTexLevelParameterxvOES(a0,a1,a2,a3);}
+static void replay_glVertexAttribL3dvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glVertexAttribL3dvEXT(a0,a1);}
+static void replay_glMultiTexCoordP4ui(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glMultiTexCoordP4ui(a0,a1,a2);}
+static void replay_glGetTextureLevelParameterivEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLenum>();auto const a4=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetTextureLevelParameterivEXT(a0,a1,a2,a3,a4);}
+static void replay_glAlphaFragmentOp2ATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<GLuint>();auto const a4=replayer.value<GLuint>();auto const a5=replayer.value<GLuint>();auto const a6=replayer.value<GLuint>();auto const a7=replayer.value<GLuint>();auto const a8=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glAlphaFragmentOp2ATI(a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+static void replay_glDeleteFramebuffers(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glDeleteFramebuffers(a0,a1);}
+static void replay_glDrawArrays(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glDrawArrays(a0,a1,a2);}
+static void replay_glGetTransformFeedbackiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetTransformFeedbackiv(a0,a1,a2);}
+static void replay_glGetnTexImageARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLenum>();auto const a4=replayer.value<GLsizei>();auto const a5=replayer.output<void*>();if(replayer.isCorrupted())return;gl.glGetnTexImageARB(a0,a1,a2,a3,a4,a5);}
+static void replay_glClear(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLbitfield>();if(replayer.isCorrupted())return;gl.glClear(a0);}
+static void replay_glVertexArrayParameteriAPPLE(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glVertexArrayParameteriAPPLE(a0,a1);}
+static void replay_glMultiTexCoord2dvARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glMultiTexCoord2dvARB(a0,a1);}
+static void replay_glGetVideoCaptureStreamdvNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.output<GLdouble*>();if(replayer.isCorrupted())return;gl.glGetVideoCaptureStreamdvNV(a0,a1,a2,a3);}
+static void replay_glFragmentLightModelivSGIX(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.null<const GLint*>();if(replayer.isCorrupted())return;gl.glFragmentLightModelivSGIX(a0,a1);}
+static void replay_glVertexAttribP2ui(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLboolean>();auto const a3=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glVertexAttribP2ui(a0,a1,a2,a3);}
+static void replay_glMultiTexCoordPointerEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.value<const void*>();if(replayer.isCorrupted())return;gl.glMultiTexCoordPointerEXT(a0,a1,a2,a3,a4);}
+static void replay_glProgramUniform3iEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glProgramUniform3iEXT(a0,a1,a2,a3,a4);}
+static void replay_glTranslatef(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfloat>();auto const a1=replayer.value<GLfloat>();auto const a2=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glTranslatef(a0,a1,a2);}
+static void replay_glVertexAttrib4Nub(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLubyte>();auto const a2=replayer.value<GLubyte>();auto const a3=replayer.value<GLubyte>();auto const a4=replayer.value<GLubyte>();if(replayer.isCorrupted())return;gl.glVertexAttrib4Nub(a0,a1,a2,a3,a4);}
+static void replay_glTranslated(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLdouble>();auto const a1=replayer.value<GLdouble>();auto const a2=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glTranslated(a0,a1,a2);}
+static void replay_glSamplerParameterIiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glSamplerParameterIiv(a0,a1,a2);}
+static void replay_glTexCoord4hNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLhalfNV>();auto const a1=replayer.value<GLhalfNV>();auto const a2=replayer.value<GLhalfNV>();auto const a3=replayer.value<GLhalfNV>();if(replayer.isCorrupted())return;gl.glTexCoord4hNV(a0,a1,a2,a3);}
+static void replay_glDrawElementsIndirect(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<const void*>();if(replayer.isCorrupted())return;gl.glDrawElementsIndirect(a0,a1,a2);}
+static void replay_glDeletePerfMonitorsAMD(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.output<GLuint*>();if(replayer.isCorrupted())return;gl.glDeletePerfMonitorsAMD(a0,a1);}
+static void replay_glIsRenderbufferEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glIsRenderbufferEXT(a0);}
+static void replay_glDrawCommandsNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.data<const GLintptr*>();auto const a3=replayer.data<const GLsizei*>();auto const a4=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glDrawCommandsNV(a0,a1,a2,a3,a4);}
+static void replay_glUniform3ivARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glUniform3ivARB(a0,a1,a2);}
+static void replay_glBufferSubData(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLintptr>();auto const a2=replayer.value<GLsizeiptr>();auto const a3=replayer.data<const void*>();if(replayer.isCorrupted())return;gl.glBufferSubData(a0,a1,a2,a3);}
+static void replay_glSecondaryColor3bv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLbyte*>();if(replayer.isCorrupted())return;gl.glSecondaryColor3bv(a0);}
+static void replay_glMatrixMultTransposedEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glMatrixMultTransposedEXT(a0,a1);}
+static void replay_glRequestResidentProgramsNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glRequestResidentProgramsNV(a0,a1);}
+static void replay_glAlphaFragmentOp1ATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<GLuint>();auto const a4=replayer.value<GLuint>();auto const a5=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glAlphaFragmentOp1ATI(a0,a1,a2,a3,a4,a5);}
+static void replay_glGetQueryObjecti64v(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLint64*>();if(replayer.isCorrupted())return;gl.glGetQueryObjecti64v(a0,a1,a2);}
+static void replay_glMatrixMult3x3fNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glMatrixMult3x3fNV(a0,a1);}
+static void replay_glColorTableParameteriv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.null<const GLint*>();if(replayer.isCorrupted())return;gl.glColorTableParameteriv(a0,a1,a2);}
+static void replay_glPathSubCommandsNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.null<const GLubyte*>();auto const a5=replayer.value<GLsizei>();auto const a6=replayer.value<GLenum>();auto const a7=replayer.value<const void*>();if(replayer.isCorrupted())return;gl.glPathSubCommandsNV(a0,a1,a2,a3,a4,a5,a6,a7);}
+static void replay_glGetFinalCombinerInputParameterivNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetFinalCombinerInputParameterivNV(a0,a1,a2);}
+static void replay_glIsRenderbuffer(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glIsRenderbuffer(a0);}
+static void replay_glVertex3iv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glVertex3iv(a0);}
+static void replay_glTexGenfv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.null<const GLfloat*>();if(replayer.isCorrupted())return;gl.glTexGenfv(a0,a1,a2);}
+static void replay_glFrustumfOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfloat>();auto const a1=replayer.value<GLfloat>();auto const a2=replayer.value<GLfloat>();auto const a3=replayer.value<GLfloat>();auto const a4=replayer.value<GLfloat>();auto const a5=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glFrustumfOES(a0,a1,a2,a3,a4,a5);}
+static void replay_glBindVertexBuffers(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLuint*>();auto const a3=replayer.data<const GLintptr*>();auto const a4=replayer.data<const GLsizei*>();if(replayer.isCorrupted())return;gl.glBindVertexBuffers(a0,a1,a2,a3,a4);}
+static void replay_glMateriali(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glMateriali(a0,a1,a2);}
+static void replay_glMultiTexCoord2svARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLshort*>();if(replayer.isCorrupted())return;gl.glMultiTexCoord2svARB(a0,a1);}
+static void replay_glDisableVertexAttribArray(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glDisableVertexAttribArray(a0);}
+static void replay_glWindowPos3ivARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glWindowPos3ivARB(a0);}
+static void replay_glTexCoordFormatNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glTexCoordFormatNV(a0,a1,a2);}
+static void replay_glBlitNamedFramebuffer(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLint>();auto const a5=replayer.value<GLint>();auto const a6=replayer.value<GLint>();auto const a7=replayer.value<GLint>();auto const a8=replayer.value<GLint>();auto const a9=replayer.value<GLint>();auto const a10=replayer.value<GLbitfield>();auto const a11=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glBlitNamedFramebuffer(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11);}
+static void replay_glMatrixLoadTransposefEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glMatrixLoadTransposefEXT(a0,a1);}
+static void replay_glMultiTexGenfEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glMultiTexGenfEXT(a0,a1,a2,a3);}
+static void replay_glShaderStorageBlockBinding(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glShaderStorageBlockBinding(a0,a1,a2);}
+static void replay_glMaterialf(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glMaterialf(a0,a1,a2);}
+static void replay_glReplacementCodeuiColor4fNormal3fVertex3fSUN(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLfloat>();auto const a2=replayer.value<GLfloat>();auto const a3=replayer.value<GLfloat>();auto const a4=replayer.value<GLfloat>();auto const a5=replayer.value<GLfloat>();auto const a6=replayer.value<GLfloat>();auto const a7=replayer.value<GLfloat>();auto const a8=replayer.value<GLfloat>();auto const a9=replayer.value<GLfloat>();auto const a10=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glReplacementCodeuiColor4fNormal3fVertex3fSUN(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10);}
+static void replay_glCheckNamedFramebufferStatusEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glCheckNamedFramebufferStatusEXT(a0,a1);}
+static void replay_glVertexArrayVertexAttribFormatEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLenum>();auto const a4=replayer.value<GLboolean>();auto const a5=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glVertexArrayVertexAttribFormatEXT(a0,a1,a2,a3,a4,a5);}
+static void replay_glVertex2hNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLhalfNV>();auto const a1=replayer.value<GLhalfNV>();if(replayer.isCorrupted())return;gl.glVertex2hNV(a0,a1);}
+static void replay_glDeleteVertexShaderEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glDeleteVertexShaderEXT(a0);}
+static void replay_glTexImage3DEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.value<GLsizei>();auto const a5=replayer.value<GLsizei>();auto const a6=replayer.value<GLint>();auto const a7=replayer.value<GLenum>();auto const a8=replayer.value<GLenum>();auto const a9=replayer.value<const void*>();if(replayer.isCorrupted())return;gl.glTexImage3DEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}
+static void replay_glProgramLocalParameterI4ivNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glProgramLocalParameterI4ivNV(a0,a1,a2);}
+static void replay_glGlobalAlphaFactoriSUN(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glGlobalAlphaFactoriSUN(a0);}
+static void replay_glTextureStorage1D(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glTextureStorage1D(a0,a1,a2,a3);}
+static void replay_glBinormal3sEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLshort>();auto const a1=replayer.value<GLshort>();auto const a2=replayer.value<GLshort>();if(replayer.isCorrupted())return;gl.glBinormal3sEXT(a0,a1,a2);}
+static void replay_glGetProgramInterfaceiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetProgramInterfaceiv(a0,a1,a2,a3);}
+static void replay_glMatrixIndexPointerARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<const void*>();if(replayer.isCorrupted())return;gl.glMatrixIndexPointerARB(a0,a1,a2,a3);}
+static void replay_glTexCoordPointerEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.value<const void*>();if(replayer.isCorrupted())return;gl.glTexCoordPointerEXT(a0,a1,a2,a3,a4);}
+static void replay_glMultiTexGeniEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glMultiTexGeniEXT(a0,a1,a2,a3);}
+static void replay_glVertexAttrib2fNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLfloat>();auto const a2=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glVertexAttrib2fNV(a0,a1,a2);}
+static void replay_glNamedProgramStringEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.value<const void*>();if(replayer.isCorrupted())return;gl.glNamedProgramStringEXT(a0,a1,a2,a3,a4);}
+static void replay_glMapNamedBuffer(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();if(replayer.isCorrupted())return;auto const result=gl.glMapNamedBuffer(a0,a1);replayer.mapResult(result);}
+static void replay_glGetMinmaxParameteriv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetMinmaxParameteriv(a0,a1,a2);}
+static void replay_glGetnUniformdv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.output<GLdouble*>();if(replayer.isCorrupted())return;gl.glGetnUniformdv(a0,a1,a2,a3);}
+static void replay_glEndConditionalRenderNVX(FunctionTable const&gl,CallReplayer&replayer){if(replayer.isCorrupted())return;gl.glEndConditionalRenderNVX();}
+static void replay_glBinormal3fEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfloat>();auto const a1=replayer.value<GLfloat>();auto const a2=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glBinormal3fEXT(a0,a1,a2);}
+static void replay_glNormalStream3iATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glNormalStream3iATI(a0,a1,a2,a3);}
+static void replay_glProgramBufferParametersIivNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glProgramBufferParametersIivNV(a0,a1,a2,a3,a4);}
+static void replay_glMapGrid1xOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLfixed>();auto const a2=replayer.value<GLfixed>();if(replayer.isCorrupted())return;gl.glMapGrid1xOES(a0,a1,a2);}
+static void replay_glGetVertexAttribPointervARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<void**>();if(replayer.isCorrupted())return;gl.glGetVertexAttribPointervARB(a0,a1,a2);}
+static void replay_glFlushMappedNamedBufferRangeEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLintptr>();auto const a2=replayer.value<GLsizeiptr>();if(replayer.isCorrupted())return;gl.glFlushMappedNamedBufferRangeEXT(a0,a1,a2);}
+static void replay_glGetVertexAttribIiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetVertexAttribIiv(a0,a1,a2);}
+static void replay_glVertexP4uiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glVertexP4uiv(a0,a1);}
+static void replay_glUniformui64NV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLuint64EXT>();if(replayer.isCorrupted())return;gl.glUniformui64NV(a0,a1);}
+static void replay_glColor4fv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glColor4fv(a0);}
+static void replay_glTexParameterxvOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.data<const GLfixed*>();if(replayer.isCorrupted())return;gl.glTexParameterxvOES(a0,a1,a2);}
+static void replay_glPatchParameteri(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glPatchParameteri(a0,a1);}
+static void replay_glMap1d(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLdouble>();auto const a2=replayer.value<GLdouble>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLint>();auto const a5=replayer.null<const GLdouble*>();if(replayer.isCorrupted())return;gl.glMap1d(a0,a1,a2,a3,a4,a5);}
+static void replay_glGetTexFilterFuncSGIS(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glGetTexFilterFuncSGIS(a0,a1,a2);}
+static void replay_glGetTexParameteriv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetTexParameteriv(a0,a1,a2);}
+static void replay_glVertexArrayVertexBindingDivisorEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glVertexArrayVertexBindingDivisorEXT(a0,a1,a2);}
+static void replay_glMultiTexCoord3svARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLshort*>();if(replayer.isCorrupted())return;gl.glMultiTexCoord3svARB(a0,a1);}
+static void replay_glBindProgramNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glBindProgramNV(a0,a1);}
+static void replay_glGetConvolutionParameteriv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetConvolutionParameteriv(a0,a1,a2);}
+static void replay_glGetProgramLocalParameterfvARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glGetProgramLocalParameterfvARB(a0,a1,a2);}
+static void replay_glGenFragmentShadersATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glGenFragmentShadersATI(a0);}
+static void replay_glTexBumpParameterivATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.null<const GLint*>();if(replayer.isCorrupted())return;gl.glTexBumpParameterivATI(a0,a1);}
+static void replay_glGetNamedFramebufferAttachmentParameteriv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetNamedFramebufferAttachmentParameteriv(a0,a1,a2,a3);}
+static void replay_glGetnSeparableFilter(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.output<void*>();auto const a5=replayer.value<GLsizei>();auto const a6=replayer.output<void*>();auto const a7=replayer.output<void*>();if(replayer.isCorrupted())return;gl.glGetnSeparableFilter(a0,a1,a2,a3,a4,a5,a6,a7);}
+static void replay_glNormal3xvOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLfixed*>();if(replayer.isCorrupted())return;gl.glNormal3xvOES(a0);}
+static void replay_glPassTexCoordATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glPassTexCoordATI(a0,a1,a2);}
+static void replay_glFramebufferTextureFaceARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glFramebufferTextureFaceARB(a0,a1,a2,a3,a4);}
+static void replay_glProgramUniform1dv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glProgramUniform1dv(a0,a1,a2,a3);}
+static void replay_glTextureStorage2DEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLenum>();auto const a4=replayer.value<GLsizei>();auto const a5=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glTextureStorage2DEXT(a0,a1,a2,a3,a4,a5);}
+static void replay_glVertexArrayFogCoordOffsetEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.value<GLintptr>();if(replayer.isCorrupted())return;gl.glVertexArrayFogCoordOffsetEXT(a0,a1,a2,a3,a4);}
+static void replay_glDeleteNamedStringARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.data<const GLchar*>();if(replayer.isCorrupted())return;gl.glDeleteNamedStringARB(a0,a1);}
+static void replay_glGenOcclusionQueriesNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.output<GLuint*>();if(replayer.isCorrupted())return;gl.glGenOcclusionQueriesNV(a0,a1);replayer.checkNames(a1);}
+static void replay_glLighti(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glLighti(a0,a1,a2);}
+static void replay_glTexImage1D(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.value<GLint>();auto const a5=replayer.value<GLenum>();auto const a6=replayer.value<GLenum>();auto const a7=replayer.pixels<const GLvoid*>();if(replayer.isCorrupted())return;gl.glTexImage1D(a0,a1,a2,a3,a4,a5,a6,a7);}
+static void replay_glLightf(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glLightf(a0,a1,a2);}
+static void replay_glClientAttribDefaultEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLbitfield>();if(replayer.isCorrupted())return;gl.glClientAttribDefaultEXT(a0);}
+static void replay_glVertexAttrib4bvARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLbyte*>();if(replayer.isCorrupted())return;gl.glVertexAttrib4bvARB(a0,a1);}
+static void replay_glVertexAttribIFormatNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glVertexAttribIFormatNV(a0,a1,a2,a3);}
+static void replay_glStencilFuncSeparate(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glStencilFuncSeparate(a0,a1,a2,a3);}
+static void replay_glGetVertexAttribfvARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glGetVertexAttribfvARB(a0,a1,a2);}
+static void replay_glVertexAttrib2dNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLdouble>();auto const a2=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glVertexAttrib2dNV(a0,a1,a2);}
+static void replay_glProgramUniform2iEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glProgramUniform2iEXT(a0,a1,a2,a3);}
+static void replay_glClientActiveVertexStreamATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glClientActiveVertexStreamATI(a0);}
+static void replay_glRasterPos3xOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfixed>();auto const a1=replayer.value<GLfixed>();auto const a2=replayer.value<GLfixed>();if(replayer.isCorrupted())return;gl.glRasterPos3xOES(a0,a1,a2);}
+static void replay_glGetMapParameterivNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetMapParameterivNV(a0,a1,a2);}
+static void replay_glSampleCoverage(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLclampf>();auto const a1=replayer.value<GLboolean>();if(replayer.isCorrupted())return;gl.glSampleCoverage(a0,a1);}
+static void replay_glClearDepthxOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfixed>();if(replayer.isCorrupted())return;gl.glClearDepthxOES(a0);}
+static void replay_glTexCoord2fNormal3fVertex3fvSUN(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLfloat*>();auto const a1=replayer.data<const GLfloat*>();auto const a2=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glTexCoord2fNormal3fVertex3fvSUN(a0,a1,a2);}
+static void replay_glGetFirstPerfQueryIdINTEL(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.output<GLuint*>();if(replayer.isCorrupted())return;gl.glGetFirstPerfQueryIdINTEL(a0);}
+static void replay_glUnmapNamedBufferEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glUnmapNamedBufferEXT(a0);}
+static void replay_glGetTransformFeedbacki_v(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetTransformFeedbacki_v(a0,a1,a2,a3);}
+static void replay_glUniform4fvARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glUniform4fvARB(a0,a1,a2);}
+static void replay_glRenderbufferStorageMultisampleCoverageNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLenum>();auto const a4=replayer.value<GLsizei>();auto const a5=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glRenderbufferStorageMultisampleCoverageNV(a0,a1,a2,a3,a4,a5);}
+static void replay_glGetFloati_vEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glGetFloati_vEXT(a0,a1,a2);}
+static void replay_glBindAttribLocationARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLhandleARB>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.data<const GLcharARB*>();if(replayer.isCorrupted())return;gl.glBindAttribLocationARB(a0,a1,a2);}
+static void replay_glBufferAddressRangeNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLuint64EXT>();auto const a3=replayer.value<GLsizeiptr>();if(replayer.isCorrupted())return;gl.glBufferAddressRangeNV(a0,a1,a2,a3);}
+static void replay_glGenProgramsARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.output<GLuint*>();if(replayer.isCorrupted())return;gl.glGenProgramsARB(a0,a1);replayer.checkNames(a1);}
+static void replay_glMultiTexEnvivEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.null<const GLint*>();if(replayer.isCorrupted())return;gl.glMultiTexEnvivEXT(a0,a1,a2,a3);}
+static void replay_glSecondaryColor3uiEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glSecondaryColor3uiEXT(a0,a1,a2);}
+static void replay_glCompressedTextureImage2DEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLenum>();auto const a4=replayer.value<GLsizei>();auto const a5=replayer.value<GLsizei>();auto const a6=replayer.value<GLint>();auto const a7=replayer.value<GLsizei>();auto const a8=replayer.pixels<const void*>();if(replayer.isCorrupted())return;gl.glCompressedTextureImage2DEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+static void replay_glUniform2i(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glUniform2i(a0,a1,a2);}
+static void replay_glCopyTexImage2DEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLint>();auto const a5=replayer.value<GLsizei>();auto const a6=replayer.value<GLsizei>();auto const a7=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glCopyTexImage2DEXT(a0,a1,a2,a3,a4,a5,a6,a7);}
+static void replay_glUniform2d(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLdouble>();auto const a2=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glUniform2d(a0,a1,a2);}
+static void replay_glVertexAttribL1d(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glVertexAttribL1d(a0,a1);}
+static void replay_glFramebufferTextureFaceEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glFramebufferTextureFaceEXT(a0,a1,a2,a3,a4);}
+static void replay_glFramebufferTextureLayer(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glFramebufferTextureLayer(a0,a1,a2,a3,a4);}
+static void replay_glMultiTexCoord4bvOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLbyte*>();if(replayer.isCorrupted())return;gl.glMultiTexCoord4bvOES(a0,a1);}
+static void replay_glGetVertexArrayPointeri_vEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.output<void**>();if(replayer.isCorrupted())return;gl.glGetVertexArrayPointeri_vEXT(a0,a1,a2,a3);}
+static void replay_glNamedProgramLocalParameter4dEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<GLdouble>();auto const a4=replayer.value<GLdouble>();auto const a5=replayer.value<GLdouble>();auto const a6=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glNamedProgramLocalParameter4dEXT(a0,a1,a2,a3,a4,a5,a6);}
+static void replay_glBinormal3bEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLbyte>();auto const a1=replayer.value<GLbyte>();auto const a2=replayer.value<GLbyte>();if(replayer.isCorrupted())return;gl.glBinormal3bEXT(a0,a1,a2);}
+static void replay_glConvolutionFilter2DEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.value<GLenum>();auto const a5=replayer.value<GLenum>();auto const a6=replayer.value<const void*>();if(replayer.isCorrupted())return;gl.glConvolutionFilter2DEXT(a0,a1,a2,a3,a4,a5,a6);}
+static void replay_glProgramUniform2fv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glProgramUniform2fv(a0,a1,a2,a3);}
+static void replay_glColor3fVertex3fSUN(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfloat>();auto const a1=replayer.value<GLfloat>();auto const a2=replayer.value<GLfloat>();auto const a3=replayer.value<GLfloat>();auto const a4=replayer.value<GLfloat>();auto const a5=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glColor3fVertex3fSUN(a0,a1,a2,a3,a4,a5);}
+static void replay_glNormal3fVertex3fvSUN(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLfloat*>();auto const a1=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glNormal3fVertex3fvSUN(a0,a1);}
+static void replay_glCopyMultiTexSubImage3DEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLint>();auto const a5=replayer.value<GLint>();auto const a6=replayer.value<GLint>();auto const a7=replayer.value<GLint>();auto const a8=replayer.value<GLsizei>();auto const a9=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glCopyMultiTexSubImage3DEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}
+static void replay_glProgramLocalParameterI4iNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLint>();auto const a5=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glProgramLocalParameterI4iNV(a0,a1,a2,a3,a4,a5);}
+static void replay_glProgramUniformMatrix2x4dv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLboolean>();auto const a4=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glProgramUniformMatrix2x4dv(a0,a1,a2,a3,a4);}
+static void replay_glPathMemoryGlyphIndexArrayNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLsizeiptr>();auto const a3=replayer.value<const void*>();auto const a4=replayer.value<GLsizei>();auto const a5=replayer.value<GLuint>();auto const a6=replayer.value<GLsizei>();auto const a7=replayer.value<GLuint>();auto const a8=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glPathMemoryGlyphIndexArrayNV(a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+static void replay_glDrawArraysEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glDrawArraysEXT(a0,a1,a2);}
+static void replay_glBlendEquationEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glBlendEquationEXT(a0);}
+static void replay_glStencilOp(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glStencilOp(a0,a1,a2);}
+static void replay_glCopyTextureSubImage2DEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLint>();auto const a5=replayer.value<GLint>();auto const a6=replayer.value<GLint>();auto const a7=replayer.value<GLsizei>();auto const a8=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glCopyTextureSubImage2DEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+static void replay_glTexEnvf(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glTexEnvf(a0,a1,a2);}
+static void replay_glVertexAttrib2dvNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glVertexAttrib2dvNV(a0,a1);}
+static void replay_glGenPerfMonitorsAMD(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.output<GLuint*>();if(replayer.isCorrupted())return;gl.glGenPerfMonitorsAMD(a0,a1);replayer.checkNames(a1);}
+static void replay_glGetInteger64i_v(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.output<GLint64*>();if(replayer.isCorrupted())return;gl.glGetInteger64i_v(a0,a1,a2);}
+static void replay_glGetHistogramParameterfv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glGetHistogramParameterfv(a0,a1,a2);}
+static void replay_glVertexFormatNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glVertexFormatNV(a0,a1,a2);}
+static void replay_glBlendFuncIndexedAMD(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glBlendFuncIndexedAMD(a0,a1,a2);}
+static void replay_glTexEnvi(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glTexEnvi(a0,a1,a2);}
+static void replay_glMultiTexCoord1iv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glMultiTexCoord1iv(a0,a1);}
+static void replay_glIsEnabledi(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glIsEnabledi(a0,a1);}
+static void replay_glVertexAttribL2ui64vNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLuint64EXT*>();if(replayer.isCorrupted())return;gl.glVertexAttribL2ui64vNV(a0,a1);}
+static void replay_glVertexAttribL4i64NV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint64EXT>();auto const a2=replayer.value<GLint64EXT>();auto const a3=replayer.value<GLint64EXT>();auto const a4=replayer.value<GLint64EXT>();if(replayer.isCorrupted())return;gl.glVertexAttribL4i64NV(a0,a1,a2,a3,a4);}
+static void replay_glMatrixTranslatedEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLdouble>();auto const a2=replayer.value<GLdouble>();auto const a3=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glMatrixTranslatedEXT(a0,a1,a2,a3);}
+static void replay_glMakeTextureHandleResidentARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint64>();if(replayer.isCorrupted())return;gl.glMakeTextureHandleResidentARB(a0);}
+static void replay_glMatrixMultdEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glMatrixMultdEXT(a0,a1);}
+static void replay_glBinormal3dvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glBinormal3dvEXT(a0);}
+static void replay_glImportSyncEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLintptr>();auto const a2=replayer.value<GLbitfield>();if(replayer.isCorrupted())return;auto const result=gl.glImportSyncEXT(a0,a1,a2);replayer.syncResult(result);}
+static void replay_glGetMapiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetMapiv(a0,a1,a2);}
+static void replay_glGetListParameterfvSGIX(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glGetListParameterfvSGIX(a0,a1,a2);}
+static void replay_glMultiTexCoord4sv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLshort*>();if(replayer.isCorrupted())return;gl.glMultiTexCoord4sv(a0,a1);}
+static void replay_glPNTrianglesiATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glPNTrianglesiATI(a0,a1);}
+static void replay_glBindVertexArrayAPPLE(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glBindVertexArrayAPPLE(a0);}
+static void replay_glObjectPtrLabel(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<const void*>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLchar*>();if(replayer.isCorrupted())return;gl.glObjectPtrLabel(a0,a1,a2);}
+static void replay_glGetDebugMessageLog(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.output<GLenum*>();auto const a3=replayer.output<GLenum*>();auto const a4=replayer.output<GLuint*>();auto const a5=replayer.output<GLenum*>();auto const a6=replayer.output<GLsizei*>();auto const a7=replayer.output<GLchar*>();if(replayer.isCorrupted())return;gl.glGetDebugMessageLog(a0,a1,a2,a3,a4,a5,a6,a7);}
+static void replay_glTrackMatrixNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glTrackMatrixNV(a0,a1,a2,a3);}
+static void replay_glBindFragDataLocation(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.data<const GLchar*>();if(replayer.isCorrupted())return;gl.glBindFragDataLocation(a0,a1,a2);}
+static void replay_glTangent3ivEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glTangent3ivEXT(a0);}
+static void replay_glSecondaryColor3ubv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLubyte*>();if(replayer.isCorrupted())return;gl.glSecondaryColor3ubv(a0);}
+static void replay_glMakeTextureHandleNonResidentNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint64>();if(replayer.isCorrupted())return;gl.glMakeTextureHandleNonResidentNV(a0);}
+static void replay_glVertexAttribs4ubvNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLubyte*>();if(replayer.isCorrupted())return;gl.glVertexAttribs4ubvNV(a0,a1,a2);}
+static void replay_glClipPlanexOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.null<const GLfixed*>();if(replayer.isCorrupted())return;gl.glClipPlanexOES(a0,a1);}
+static void replay_glMultiTexCoord3iv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glMultiTexCoord3iv(a0,a1);}
+static void replay_glGetnPolygonStippleARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.output<GLubyte*>();if(replayer.isCorrupted())return;gl.glGetnPolygonStippleARB(a0,a1);}
+static void replay_glUniform2i64vNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLint64EXT*>();if(replayer.isCorrupted())return;gl.glUniform2i64vNV(a0,a1,a2);}
+static void replay_glLightModelf(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glLightModelf(a0,a1);}
+static void replay_glMultiTexSubImage2DEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLint>();auto const a5=replayer.value<GLsizei>();auto const a6=replayer.value<GLsizei>();auto const a7=replayer.value<GLenum>();auto const a8=replayer.value<GLenum>();auto const a9=replayer.value<const void*>();if(replayer.isCorrupted())return;gl.glMultiTexSubImage2DEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}
+static void replay_glReplacementCodeuiColor3fVertex3fSUN(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLfloat>();auto const a2=replayer.value<GLfloat>();auto const a3=replayer.value<GLfloat>();auto const a4=replayer.value<GLfloat>();auto const a5=replayer.value<GLfloat>();auto const a6=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glReplacementCodeuiColor3fVertex3fSUN(a0,a1,a2,a3,a4,a5,a6);}
+static void replay_glTangent3dvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glTangent3dvEXT(a0);}
+static void replay_glLightModeli(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glLightModeli(a0,a1);}
+static void replay_glVertexWeighthvNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.null<const GLhalfNV*>();if(replayer.isCorrupted())return;gl.glVertexWeighthvNV(a0);}
+static void replay_glWindowPos3iv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glWindowPos3iv(a0);}
+static void replay_glMultiTexCoordP1uiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glMultiTexCoordP1uiv(a0,a1,a2);}
+static void replay_glTransformPathNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.null<const GLfloat*>();if(replayer.isCorrupted())return;gl.glTransformPathNV(a0,a1,a2,a3);}
+static void replay_glProgramNamedParameter4dNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.null<const GLubyte*>();auto const a3=replayer.value<GLdouble>();auto const a4=replayer.value<GLdouble>();auto const a5=replayer.value<GLdouble>();auto const a6=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glProgramNamedParameter4dNV(a0,a1,a2,a3,a4,a5,a6);}
+static void replay_glMultiDrawElementsIndirect(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<const void*>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glMultiDrawElementsIndirect(a0,a1,a2,a3,a4);}
+static void replay_glProgramUniform1dEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glProgramUniform1dEXT(a0,a1,a2);}
+static void replay_glCallLists(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<const GLvoid*>();if(replayer.isCorrupted())return;gl.glCallLists(a0,a1,a2);}
+static void replay_glNormal3hvNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLhalfNV*>();if(replayer.isCorrupted())return;gl.glNormal3hvNV(a0);}
+static void replay_glGetCombinerOutputParameterfvNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glGetCombinerOutputParameterfvNV(a0,a1,a2,a3);}
+static void replay_glVertexAttrib4sARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLshort>();auto const a2=replayer.value<GLshort>();auto const a3=replayer.value<GLshort>();auto const a4=replayer.value<GLshort>();if(replayer.isCorrupted())return;gl.glVertexAttrib4sARB(a0,a1,a2,a3,a4);}
+static void replay_glTexCoord3i(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glTexCoord3i(a0,a1,a2);}
+static void replay_glVertexAttribI3uiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glVertexAttribI3uiv(a0,a1);}
+static void replay_glPushDebugGroup(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.data<const GLchar*>();if(replayer.isCorrupted())return;gl.glPushDebugGroup(a0,a1,a2,a3);}
+static void replay_glTexCoord3f(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfloat>();auto const a1=replayer.value<GLfloat>();auto const a2=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glTexCoord3f(a0,a1,a2);}
+static void replay_glTexCoord3d(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLdouble>();auto const a1=replayer.value<GLdouble>();auto const a2=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glTexCoord3d(a0,a1,a2);}
+static void replay_glTexCoord2xOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfixed>();auto const a1=replayer.value<GLfixed>();if(replayer.isCorrupted())return;gl.glTexCoord2xOES(a0,a1);}
+static void replay_glGetStageIndexNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glGetStageIndexNV(a0);}
+static void replay_glProgramUniform4i64vNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.data<const GLint64EXT*>();if(replayer.isCorrupted())return;gl.glProgramUniform4i64vNV(a0,a1,a2,a3);}
+static void replay_glGetNamedBufferPointervEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<void**>();if(replayer.isCorrupted())return;gl.glGetNamedBufferPointervEXT(a0,a1,a2);}
+static void replay_glTextureBarrierNV(FunctionTable const&gl,CallReplayer&replayer){if(replayer.isCorrupted())return;gl.glTextureBarrierNV();}
+static void replay_glColor4ubVertex3fvSUN(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLubyte*>();auto const a1=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glColor4ubVertex3fvSUN(a0,a1);}
+static void replay_glGetCommandHeaderNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glGetCommandHeaderNV(a0,a1);}
+static void replay_glGetPerfMonitorCounterInfoAMD(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.output<void*>();if(replayer.isCorrupted())return;gl.glGetPerfMonitorCounterInfoAMD(a0,a1,a2,a3);}
+static void replay_glVertexAttrib1svARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLshort*>();if(replayer.isCorrupted())return;gl.glVertexAttrib1svARB(a0,a1);}
+static void replay_glCombinerParameteriNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glCombinerParameteriNV(a0,a1);}
+static void replay_glMatrixMultTransposefEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glMatrixMultTransposefEXT(a0,a1);}
+static void replay_glDetailTexFuncSGIS(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glDetailTexFuncSGIS(a0,a1,a2);}
+static void replay_glAreTexturesResident(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.data<const GLuint*>();auto const a2=replayer.output<GLboolean*>();if(replayer.isCorrupted())return;gl.glAreTexturesResident(a0,a1,a2);}
+static void replay_glProgramUniform2d(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLdouble>();auto const a3=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glProgramUniform2d(a0,a1,a2,a3);}
+static void replay_glGetConvolutionParameterfvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glGetConvolutionParameterfvEXT(a0,a1,a2);}
+static void replay_glIndexPointerListIBM(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<const void**>();auto const a3=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glIndexPointerListIBM(a0,a1,a2,a3);}
+static void replay_glVertexAttribI4iEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glVertexAttribI4iEXT(a0,a1,a2,a3,a4);}
+static void replay_glProgramUniform2f(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLfloat>();auto const a3=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glProgramUniform2f(a0,a1,a2,a3);}
+static void replay_glRasterPos4sv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLshort*>();if(replayer.isCorrupted())return;gl.glRasterPos4sv(a0);}
+static void replay_glColor4s(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLshort>();auto const a1=replayer.value<GLshort>();auto const a2=replayer.value<GLshort>();auto const a3=replayer.value<GLshort>();if(replayer.isCorrupted())return;gl.glColor4s(a0,a1,a2,a3);}
+static void replay_glColorFragmentOp3ATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<GLuint>();auto const a4=replayer.value<GLuint>();auto const a5=replayer.value<GLuint>();auto const a6=replayer.value<GLuint>();auto const a7=replayer.value<GLuint>();auto const a8=replayer.value<GLuint>();auto const a9=replayer.value<GLuint>();auto const a10=replayer.value<GLuint>();auto const a11=replayer.value<GLuint>();auto const a12=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glColorFragmentOp3ATI(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12);}
+static void replay_glResizeBuffersMESA(FunctionTable const&gl,CallReplayer&replayer){if(replayer.isCorrupted())return;gl.glResizeBuffersMESA();}
+static void replay_glGetMinmaxParameterfv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glGetMinmaxParameterfv(a0,a1,a2);}
+static void replay_glClientActiveTextureARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glClientActiveTextureARB(a0);}
+static void replay_glBindVertexArray(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glBindVertexArray(a0);}
+static void replay_glColor4b(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLbyte>();auto const a1=replayer.value<GLbyte>();auto const a2=replayer.value<GLbyte>();auto const a3=replayer.value<GLbyte>();if(replayer.isCorrupted())return;gl.glColor4b(a0,a1,a2,a3);}
+static void replay_glColor4f(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfloat>();auto const a1=replayer.value<GLfloat>();auto const a2=replayer.value<GLfloat>();auto const a3=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glColor4f(a0,a1,a2,a3);}
+static void replay_glColor4d(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLdouble>();auto const a1=replayer.value<GLdouble>();auto const a2=replayer.value<GLdouble>();auto const a3=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glColor4d(a0,a1,a2,a3);}
+static void replay_glColor4i(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glColor4i(a0,a1,a2,a3);}
+static void replay_glEdgeFlagFormatNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glEdgeFlagFormatNV(a0);}
+static void replay_glNamedBufferSubData(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLintptr>();auto const a2=replayer.value<GLsizeiptr>();auto const a3=replayer.data<const void*>();if(replayer.isCorrupted())return;gl.glNamedBufferSubData(a0,a1,a2,a3);}
+static void replay_glDrawElementsInstanced(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<const void*>();auto const a4=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glDrawElementsInstanced(a0,a1,a2,a3,a4);}
+static void replay_glGetMultiTexParameterIivEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetMultiTexParameterIivEXT(a0,a1,a2,a3);}
+static void replay_glVertex2dv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glVertex2dv(a0);}
+static void replay_glDisableVertexArrayAttribEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glDisableVertexArrayAttribEXT(a0,a1);}
+static void replay_glObjectUnpurgeableAPPLE(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glObjectUnpurgeableAPPLE(a0,a1,a2);}
+static void replay_glVertexAttribs2dvNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glVertexAttribs2dvNV(a0,a1,a2);}
+static void replay_glReplacementCodeuiTexCoord2fVertex3fSUN(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLfloat>();auto const a2=replayer.value<GLfloat>();auto const a3=replayer.value<GLfloat>();auto const a4=replayer.value<GLfloat>();auto const a5=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glReplacementCodeuiTexCoord2fVertex3fSUN(a0,a1,a2,a3,a4,a5);}
+static void replay_glGetMapParameterfvNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glGetMapParameterfvNV(a0,a1,a2);}
+static void replay_glProgramUniform4ivEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glProgramUniform4ivEXT(a0,a1,a2,a3);}
+static void replay_glProgramUniform3ui64vNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.data<const GLuint64EXT*>();if(replayer.isCorrupted())return;gl.glProgramUniform3ui64vNV(a0,a1,a2,a3);}
+static void replay_glRectfv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.null<const GLfloat*>();auto const a1=replayer.null<const GLfloat*>();if(replayer.isCorrupted())return;gl.glRectfv(a0,a1);}
+static void replay_glTexFilterFuncSGIS(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glTexFilterFuncSGIS(a0,a1,a2,a3);}
+static void replay_glSpriteParameterfvSGIX(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.null<const GLfloat*>();if(replayer.isCorrupted())return;gl.glSpriteParameterfvSGIX(a0,a1);}
+static void replay_glCopyMultiTexImage1DEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLenum>();auto const a4=replayer.value<GLint>();auto const a5=replayer.value<GLint>();auto const a6=replayer.value<GLsizei>();auto const a7=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glCopyMultiTexImage1DEXT(a0,a1,a2,a3,a4,a5,a6,a7);}
+static void replay_glGetVertexAttribIuivEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLuint*>();if(replayer.isCorrupted())return;gl.glGetVertexAttribIuivEXT(a0,a1,a2);}
+static void replay_glUniformMatrix2x4dv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.value<GLboolean>();auto const a3=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glUniformMatrix2x4dv(a0,a1,a2,a3);}
+static void replay_glGetProgramResourceLocationIndex(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.data<const GLchar*>();if(replayer.isCorrupted())return;gl.glGetProgramResourceLocationIndex(a0,a1,a2);}
+static void replay_glColor3hNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLhalfNV>();auto const a1=replayer.value<GLhalfNV>();auto const a2=replayer.value<GLhalfNV>();if(replayer.isCorrupted())return;gl.glColor3hNV(a0,a1,a2);}
+static void replay_glViewport(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glViewport(a0,a1,a2,a3);}
+static void replay_glProgramNamedParameter4fNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.null<const GLubyte*>();auto const a3=replayer.value<GLfloat>();auto const a4=replayer.value<GLfloat>();auto const a5=replayer.value<GLfloat>();auto const a6=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glProgramNamedParameter4fNV(a0,a1,a2,a3,a4,a5,a6);}
+static void replay_glGetInvariantBooleanvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLboolean*>();if(replayer.isCorrupted())return;gl.glGetInvariantBooleanvEXT(a0,a1,a2);}
+static void replay_glTexStorage2DMultisample(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.value<GLsizei>();auto const a5=replayer.value<GLboolean>();if(replayer.isCorrupted())return;gl.glTexStorage2DMultisample(a0,a1,a2,a3,a4,a5);}
+static void replay_glPixelStorex(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLfixed>();if(replayer.isCorrupted())return;gl.glPixelStorex(a0,a1);}
+static void replay_glVertexAttribL1dvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glVertexAttribL1dvEXT(a0,a1);}
+static void replay_glGetActiveSubroutineUniformiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<GLenum>();auto const a4=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetActiveSubroutineUniformiv(a0,a1,a2,a3,a4);}
+static void replay_glVertexAttribPointerARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLboolean>();auto const a4=replayer.value<GLsizei>();auto const a5=replayer.value<const void*>();if(replayer.isCorrupted())return;gl.glVertexAttribPointerARB(a0,a1,a2,a3,a4,a5);}
+static void replay_glCompressedTexSubImage2DARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLsizei>();auto const a5=replayer.value<GLsizei>();auto const a6=replayer.value<GLenum>();auto const a7=replayer.value<GLsizei>();auto const a8=replayer.value<const void*>();if(replayer.isCorrupted())return;gl.glCompressedTexSubImage2DARB(a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+static void replay_glVertex2hvNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLhalfNV*>();if(replayer.isCorrupted())return;gl.glVertex2hvNV(a0);}
+static void replay_glTexBuffer(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glTexBuffer(a0,a1,a2);}
+static void replay_glArrayElement(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glArrayElement(a0);}
+static void replay_glValidateProgram(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glValidateProgram(a0);}
+static void replay_glPixelStoref(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glPixelStoref(a0,a1);}
+static void replay_glWindowPos3dARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLdouble>();auto const a1=replayer.value<GLdouble>();auto const a2=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glWindowPos3dARB(a0,a1,a2);}
+static void replay_glEvalCoord1dv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glEvalCoord1dv(a0);}
+static void replay_glVertexAttribs2fvNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glVertexAttribs2fvNV(a0,a1,a2);}
+static void replay_glRecti(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glRecti(a0,a1,a2,a3);}
+static void replay_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLuint*>();auto const a1=replayer.data<const GLfloat*>();auto const a2=replayer.data<const GLfloat*>();auto const a3=replayer.data<const GLfloat*>();auto const a4=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN(a0,a1,a2,a3,a4);}
+static void replay_glTexCoord1bOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLbyte>();if(replayer.isCorrupted())return;gl.glTexCoord1bOES(a0);}
+static void replay_glProgramUniform2i64vARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.data<const GLint64*>();if(replayer.isCorrupted())return;gl.glProgramUniform2i64vARB(a0,a1,a2,a3);}
+static void replay_glWindowPos2dARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLdouble>();auto const a1=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glWindowPos2dARB(a0,a1);}
+static void replay_glGetProgramParameterdvNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.output<GLdouble*>();if(replayer.isCorrupted())return;gl.glGetProgramParameterdvNV(a0,a1,a2,a3);}
+static void replay_glRectf(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfloat>();auto const a1=replayer.value<GLfloat>();auto const a2=replayer.value<GLfloat>();auto const a3=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glRectf(a0,a1,a2,a3);}
+static void replay_glRectd(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLdouble>();auto const a1=replayer.value<GLdouble>();auto const a2=replayer.value<GLdouble>();auto const a3=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glRectd(a0,a1,a2,a3);}
+static void replay_glMap1xOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLfixed>();auto const a2=replayer.value<GLfixed>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLint>();auto const a5=replayer.value<GLfixed>();if(replayer.isCorrupted())return;gl.glMap1xOES(a0,a1,a2,a3,a4,a5);}
+static void replay_glVertexAttrib3fvNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glVertexAttrib3fvNV(a0,a1);}
+static void replay_glReferencePlaneSGIX(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.null<const GLdouble*>();if(replayer.isCorrupted())return;gl.glReferencePlaneSGIX(a0);}
+static void replay_glGetMultiTexGendvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.output<GLdouble*>();if(replayer.isCorrupted())return;gl.glGetMultiTexGendvEXT(a0,a1,a2,a3);}
+static void replay_glGetCombinerInputParameterfvNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLenum>();auto const a4=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glGetCombinerInputParameterfvNV(a0,a1,a2,a3,a4);}
+static void replay_glGetTextureSamplerHandleARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glGetTextureSamplerHandleARB(a0,a1);}
+static void replay_glBindTexture(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glBindTexture(a0,a1);}
+static void replay_glRects(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLshort>();auto const a1=replayer.value<GLshort>();auto const a2=replayer.value<GLshort>();auto const a3=replayer.value<GLshort>();if(replayer.isCorrupted())return;gl.glRects(a0,a1,a2,a3);}
+static void replay_glGetActiveAttribARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLhandleARB>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.output<GLsizei*>();auto const a4=replayer.output<GLint*>();auto const a5=replayer.output<GLenum*>();auto const a6=replayer.output<GLcharARB*>();if(replayer.isCorrupted())return;gl.glGetActiveAttribARB(a0,a1,a2,a3,a4,a5,a6);}
+static void replay_glHistogramEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLboolean>();if(replayer.isCorrupted())return;gl.glHistogramEXT(a0,a1,a2,a3);}
+static void replay_glGetTextureSamplerHandleNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glGetTextureSamplerHandleNV(a0,a1);}
+static void replay_glDetachShader(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glDetachShader(a0,a1);}
+static void replay_glFinishTextureSUNX(FunctionTable const&gl,CallReplayer&replayer){if(replayer.isCorrupted())return;gl.glFinishTextureSUNX();}
+static void replay_glUniformMatrix3x4dv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.value<GLboolean>();auto const a3=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glUniformMatrix3x4dv(a0,a1,a2,a3);}
+static void replay_glVertexAttrib4fARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLfloat>();auto const a2=replayer.value<GLfloat>();auto const a3=replayer.value<GLfloat>();auto const a4=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glVertexAttrib4fARB(a0,a1,a2,a3,a4);}
+static void replay_glGetPathColorGenivNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetPathColorGenivNV(a0,a1,a2);}
+static void replay_glGetProgramResourceLocation(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.data<const GLchar*>();if(replayer.isCorrupted())return;gl.glGetProgramResourceLocation(a0,a1,a2);}
+static void replay_glVertexArrayAttribLFormat(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLenum>();auto const a4=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glVertexArrayAttribLFormat(a0,a1,a2,a3,a4);}
+static void replay_glGetTexLevelParameterfv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glGetTexLevelParameterfv(a0,a1,a2,a3);}
+static void replay_glVertexArrayVertexAttribOffsetEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLenum>();auto const a5=replayer.value<GLboolean>();auto const a6=replayer.value<GLsizei>();auto const a7=replayer.value<GLintptr>();if(replayer.isCorrupted())return;gl.glVertexArrayVertexAttribOffsetEXT(a0,a1,a2,a3,a4,a5,a6,a7);}
+static void replay_glIndexFormatNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glIndexFormatNV(a0,a1);}
+static void replay_glMultiTexCoord3i(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glMultiTexCoord3i(a0,a1,a2,a3);}
+static void replay_glReplacementCodeuiVertex3fvSUN(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLuint*>();auto const a1=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glReplacementCodeuiVertex3fvSUN(a0,a1);}
+static void replay_glViewportIndexedfv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glViewportIndexedfv(a0,a1);}
+static void replay_glBindBuffersBase(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glBindBuffersBase(a0,a1,a2,a3);}
+static void replay_glTexBumpParameterfvATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.null<const GLfloat*>();if(replayer.isCorrupted())return;gl.glTexBumpParameterfvATI(a0,a1);}
+static void replay_glMatrixIndexuivARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glMatrixIndexuivARB(a0,a1);}
+static void replay_glVertexAttrib1hNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLhalfNV>();if(replayer.isCorrupted())return;gl.glVertexAttrib1hNV(a0,a1);}
+static void replay_glWindowPos3svMESA(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLshort*>();if(replayer.isCorrupted())return;gl.glWindowPos3svMESA(a0);}
+static void replay_glStencilOpSeparateATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glStencilOpSeparateATI(a0,a1,a2,a3);}
+static void replay_glDrawElementsBaseVertex(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<const void*>();auto const a4=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glDrawElementsBaseVertex(a0,a1,a2,a3,a4);}
+static void replay_glBlendEquationSeparateiARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glBlendEquationSeparateiARB(a0,a1,a2);}
+static void replay_glVertexAttrib1fNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glVertexAttrib1fNV(a0,a1);}
+static void replay_glMapVertexAttrib2fAPPLE(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLfloat>();auto const a3=replayer.value<GLfloat>();auto const a4=replayer.value<GLint>();auto const a5=replayer.value<GLint>();auto const a6=replayer.value<GLfloat>();auto const a7=replayer.value<GLfloat>();auto const a8=replayer.value<GLint>();auto const a9=replayer.value<GLint>();auto const a10=replayer.null<const GLfloat*>();if(replayer.isCorrupted())return;gl.glMapVertexAttrib2fAPPLE(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10);}
+static void replay_glCompressedTextureSubImage1DEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLsizei>();auto const a5=replayer.value<GLenum>();auto const a6=replayer.value<GLsizei>();auto const a7=replayer.pixels<const void*>();if(replayer.isCorrupted())return;gl.glCompressedTextureSubImage1DEXT(a0,a1,a2,a3,a4,a5,a6,a7);}
+static void replay_glClearBufferSubData(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLintptr>();auto const a3=replayer.value<GLsizeiptr>();auto const a4=replayer.value<GLenum>();auto const a5=replayer.value<GLenum>();auto const a6=replayer.data<const void*>();if(replayer.isCorrupted())return;gl.glClearBufferSubData(a0,a1,a2,a3,a4,a5,a6);}
+static void replay_glTexStorage1D(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glTexStorage1D(a0,a1,a2,a3);}
+static void replay_glVertexAttribI3iEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glVertexAttribI3iEXT(a0,a1,a2,a3);}
+static void replay_glMakeTextureHandleNonResidentARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint64>();if(replayer.isCorrupted())return;gl.glMakeTextureHandleNonResidentARB(a0);}
+static void replay_glMultiDrawElementArrayAPPLE(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLint*>();auto const a2=replayer.data<const GLsizei*>();auto const a3=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glMultiDrawElementArrayAPPLE(a0,a1,a2,a3);}
+static void replay_glVertexStream4dATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLdouble>();auto const a2=replayer.value<GLdouble>();auto const a3=replayer.value<GLdouble>();auto const a4=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glVertexStream4dATI(a0,a1,a2,a3,a4);}
+static void replay_glProgramUniformMatrix2dvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLboolean>();auto const a4=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glProgramUniformMatrix2dvEXT(a0,a1,a2,a3,a4);}
+static void replay_glVertexAttribs2hvNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLhalfNV*>();if(replayer.isCorrupted())return;gl.glVertexAttribs2hvNV(a0,a1,a2);}
+static void replay_glGetUniformiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetUniformiv(a0,a1,a2);}
+static void replay_glClipPlanefOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.null<const GLfloat*>();if(replayer.isCorrupted())return;gl.glClipPlanefOES(a0,a1);}
+static void replay_glRenderbufferStorage(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glRenderbufferStorage(a0,a1,a2,a3);}
+static void replay_glUniform4ui(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<GLuint>();auto const a4=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glUniform4ui(a0,a1,a2,a3,a4);}
+static void replay_glBindFramebuffer(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glBindFramebuffer(a0,a1);}
+static void replay_glValidateProgramARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLhandleARB>();if(replayer.isCorrupted())return;gl.glValidateProgramARB(a0);}
+static void replay_glTexGenf(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glTexGenf(a0,a1,a2);}
+static void replay_glTexGend(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glTexGend(a0,a1,a2);}
+static void replay_glTexGeni(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glTexGeni(a0,a1,a2);}
+static void replay_glDeleteFramebuffersEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glDeleteFramebuffersEXT(a0,a1);}
+static void replay_glResetMinmaxEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glResetMinmaxEXT(a0);}
+static void replay_glVertexAttrib1fvNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glVertexAttrib1fvNV(a0,a1);}
+static void replay_glIsQueryARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glIsQueryARB(a0);}
+static void replay_glEnableVariantClientStateEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glEnableVariantClientStateEXT(a0);}
+static void replay_glScissorIndexed(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glScissorIndexed(a0,a1,a2,a3,a4);}
+static void replay_glGetInvariantIntegervEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetInvariantIntegervEXT(a0,a1,a2);}
+static void replay_glProgramLocalParameterI4uiNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<GLuint>();auto const a4=replayer.value<GLuint>();auto const a5=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glProgramLocalParameterI4uiNV(a0,a1,a2,a3,a4,a5);}
+static void replay_glConvolutionParameterxvOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.null<const GLfixed*>();if(replayer.isCorrupted())return;gl.glConvolutionParameterxvOES(a0,a1,a2);}
+static void replay_glGenFramebuffersEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.output<GLuint*>();if(replayer.isCorrupted())return;gl.glGenFramebuffersEXT(a0,a1);replayer.checkNames(a1);}
+static void replay_glVertexArrayColorOffsetEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLenum>();auto const a4=replayer.value<GLsizei>();auto const a5=replayer.value<GLintptr>();if(replayer.isCorrupted())return;gl.glVertexArrayColorOffsetEXT(a0,a1,a2,a3,a4,a5);}
+static void replay_glMultiTexCoord3ivARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glMultiTexCoord3ivARB(a0,a1);}
+static void replay_glVertexWeightfEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glVertexWeightfEXT(a0);}
+static void replay_glRasterPos4dv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glRasterPos4dv(a0);}
+static void replay_glIsTextureHandleResidentARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint64>();if(replayer.isCorrupted())return;gl.glIsTextureHandleResidentARB(a0);}
+static void replay_glRasterPos2dv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glRasterPos2dv(a0);}
+static void replay_glWindowPos4ivMESA(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glWindowPos4ivMESA(a0);}
+static void replay_glGetVariantPointervEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<void**>();if(replayer.isCorrupted())return;gl.glGetVariantPointervEXT(a0,a1,a2);}
+static void replay_glMapNamedBufferRangeEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLintptr>();auto const a2=replayer.value<GLsizeiptr>();auto const a3=replayer.value<GLbitfield>();if(replayer.isCorrupted())return;auto const result=gl.glMapNamedBufferRangeEXT(a0,a1,a2,a3);replayer.mapResult(result);}
+static void replay_glGetnUniformui64vARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.output<GLuint64*>();if(replayer.isCorrupted())return;gl.glGetnUniformui64vARB(a0,a1,a2,a3);}
+static void replay_glCreateShaderProgramv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLsizei>();auto const a2=(const GLchar*const*)replayer.strings();if(replayer.isCorrupted())return;auto const result=gl.glCreateShaderProgramv(a0,a1,a2);replayer.checkName(result);}
+static void replay_glGetQueryObjectiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetQueryObjectiv(a0,a1,a2);}
+static void replay_glPNTrianglesfATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glPNTrianglesfATI(a0,a1);}
+static void replay_glGlobalAlphaFactorusSUN(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLushort>();if(replayer.isCorrupted())return;gl.glGlobalAlphaFactorusSUN(a0);}
+static void replay_glVertexAttrib3dvNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glVertexAttrib3dvNV(a0,a1);}
+static void replay_glMultiTexCoord3sARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLshort>();auto const a2=replayer.value<GLshort>();auto const a3=replayer.value<GLshort>();if(replayer.isCorrupted())return;gl.glMultiTexCoord3sARB(a0,a1,a2,a3);}
+static void replay_glGenerateMipmap(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glGenerateMipmap(a0);}
+static void replay_glCompressedTextureSubImage2D(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLsizei>();auto const a5=replayer.value<GLsizei>();auto const a6=replayer.value<GLenum>();auto const a7=replayer.value<GLsizei>();auto const a8=replayer.pixels<const void*>();if(replayer.isCorrupted())return;gl.glCompressedTextureSubImage2D(a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+static void replay_glNamedRenderbufferStorageMultisampleEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glNamedRenderbufferStorageMultisampleEXT(a0,a1,a2,a3,a4);}
+static void replay_glPolygonOffsetClampEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfloat>();auto const a1=replayer.value<GLfloat>();auto const a2=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glPolygonOffsetClampEXT(a0,a1,a2);}
+static void replay_glTextureRangeAPPLE(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.value<const void*>();if(replayer.isCorrupted())return;gl.glTextureRangeAPPLE(a0,a1,a2);}
+static void replay_glBlendEquationIndexedAMD(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glBlendEquationIndexedAMD(a0,a1);}
+static void replay_glTexCoord2d(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLdouble>();auto const a1=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glTexCoord2d(a0,a1);}
+static void replay_glPointParameteri(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glPointParameteri(a0,a1);}
+static void replay_glTexCoord2f(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfloat>();auto const a1=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glTexCoord2f(a0,a1);}
+static void replay_glColor4iv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glColor4iv(a0);}
+static void replay_glMapNamedBufferRange(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLintptr>();auto const a2=replayer.value<GLsizeiptr>();auto const a3=replayer.value<GLbitfield>();if(replayer.isCorrupted())return;auto const result=gl.glMapNamedBufferRange(a0,a1,a2,a3);replayer.mapResult(result);}
+static void replay_glUnmapBuffer(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glUnmapBuffer(a0);}
+static void replay_glSampleMaskEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLclampf>();auto const a1=replayer.value<GLboolean>();if(replayer.isCorrupted())return;gl.glSampleMaskEXT(a0,a1);}
+static void replay_glTexCoord2i(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glTexCoord2i(a0,a1);}
+static void replay_glTexCoord1xvOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLfixed*>();if(replayer.isCorrupted())return;gl.glTexCoord1xvOES(a0);}
+static void replay_glVertexAttrib1sARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLshort>();if(replayer.isCorrupted())return;gl.glVertexAttrib1sARB(a0,a1);}
+static void replay_glGetVertexArrayiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetVertexArrayiv(a0,a1,a2);}
+static void replay_glProgramParameter4dvNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glProgramParameter4dvNV(a0,a1,a2);}
+static void replay_glTexCoord2s(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLshort>();auto const a1=replayer.value<GLshort>();if(replayer.isCorrupted())return;gl.glTexCoord2s(a0,a1);}
+static void replay_glTextureParameterIuivEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glTextureParameterIuivEXT(a0,a1,a2,a3);}
+static void replay_glGetColorTableParameterfvSGI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glGetColorTableParameterfvSGI(a0,a1,a2);}
+static void replay_glTexCoord4dv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glTexCoord4dv(a0);}
+static void replay_glVertexAttrib1svNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLshort*>();if(replayer.isCorrupted())return;gl.glVertexAttrib1svNV(a0,a1);}
+static void replay_glNamedFramebufferTextureFaceEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glNamedFramebufferTextureFaceEXT(a0,a1,a2,a3,a4);}
+static void replay_glProgramUniform2ui64vNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.data<const GLuint64EXT*>();if(replayer.isCorrupted())return;gl.glProgramUniform2ui64vNV(a0,a1,a2,a3);}
+static void replay_glNormal3dv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glNormal3dv(a0);}
+static void replay_glReleaseShaderCompiler(FunctionTable const&gl,CallReplayer&replayer){if(replayer.isCorrupted())return;gl.glReleaseShaderCompiler();}
+static void replay_glTexCoord3bvOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLbyte*>();if(replayer.isCorrupted())return;gl.glTexCoord3bvOES(a0);}
+static void replay_glIsVertexAttribEnabledAPPLE(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glIsVertexAttribEnabledAPPLE(a0,a1);}
+static void replay_glTexCoord1dv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glTexCoord1dv(a0);}
+static void replay_glReadPixels(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.value<GLenum>();auto const a5=replayer.value<GLenum>();auto const a6=replayer.outputPixels<GLvoid*>();if(replayer.isCorrupted())return;gl.glReadPixels(a0,a1,a2,a3,a4,a5,a6);}
+static void replay_glVertexAttribI3iv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glVertexAttribI3iv(a0,a1);}
+static void replay_glSetFenceAPPLE(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glSetFenceAPPLE(a0);}
+static void replay_glWeightsvARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.data<const GLshort*>();if(replayer.isCorrupted())return;gl.glWeightsvARB(a0,a1);}
+static void replay_glShadeModel(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glShadeModel(a0);}
+static void replay_glMapGrid1d(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLdouble>();auto const a2=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glMapGrid1d(a0,a1,a2);}
+static void replay_glGetHistogramParameterivEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetHistogramParameterivEXT(a0,a1,a2);}
+static void replay_glConservativeRasterParameteriNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glConservativeRasterParameteriNV(a0,a1);}
+static void replay_glClearNamedBufferData(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLenum>();auto const a4=replayer.data<const void*>();if(replayer.isCorrupted())return;gl.glClearNamedBufferData(a0,a1,a2,a3,a4);}
+static void replay_glClearDepthf(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glClearDepthf(a0);}
+static void replay_glCreatePerfQueryINTEL(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.output<GLuint*>();if(replayer.isCorrupted())return;gl.glCreatePerfQueryINTEL(a0,a1);}
+static void replay_glFogCoordfEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glFogCoordfEXT(a0);}
+static void replay_glVertexAttrib2dARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLdouble>();auto const a2=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glVertexAttrib2dARB(a0,a1,a2);}
+static void replay_glMultiTexCoord4dARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLdouble>();auto const a2=replayer.value<GLdouble>();auto const a3=replayer.value<GLdouble>();auto const a4=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glMultiTexCoord4dARB(a0,a1,a2,a3,a4);}
+static void replay_glReadnPixelsARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.value<GLenum>();auto const a5=replayer.value<GLenum>();auto const a6=replayer.value<GLsizei>();auto const a7=replayer.output<void*>();if(replayer.isCorrupted())return;gl.glReadnPixelsARB(a0,a1,a2,a3,a4,a5,a6,a7);}
+static void replay_glMultiTexBufferEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glMultiTexBufferEXT(a0,a1,a2,a3);}
+static void replay_glWindowPos4dvMESA(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glWindowPos4dvMESA(a0);}
+static void replay_glInvalidateNamedFramebufferData(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLenum*>();if(replayer.isCorrupted())return;gl.glInvalidateNamedFramebufferData(a0,a1,a2);}
+static void replay_glSecondaryColorPointerListIBM(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<const void**>();auto const a4=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glSecondaryColorPointerListIBM(a0,a1,a2,a3,a4);}
+static void replay_glRectiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.null<const GLint*>();auto const a1=replayer.null<const GLint*>();if(replayer.isCorrupted())return;gl.glRectiv(a0,a1);}
+static void replay_glColorP4ui(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glColorP4ui(a0,a1);}
+static void replay_glUseProgramStages(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLbitfield>();auto const a2=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glUseProgramStages(a0,a1,a2);}
+static void replay_glRasterPos3dv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glRasterPos3dv(a0);}
+static void replay_glPathTexGenNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLint>();auto const a3=replayer.null<const GLfloat*>();if(replayer.isCorrupted())return;gl.glPathTexGenNV(a0,a1,a2,a3);}
+static void replay_glVertexBlendEnviATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glVertexBlendEnviATI(a0,a1);}
+static void replay_glUniform3i64ARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLint64>();auto const a2=replayer.value<GLint64>();auto const a3=replayer.value<GLint64>();if(replayer.isCorrupted())return;gl.glUniform3i64ARB(a0,a1,a2,a3);}
+static void replay_glLoadMatrixf(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glLoadMatrixf(a0);}
+static void replay_glProgramUniform2dEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLdouble>();auto const a3=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glProgramUniform2dEXT(a0,a1,a2,a3);}
+static void replay_glVertexAttribI4iv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glVertexAttribI4iv(a0,a1);}
+static void replay_glNamedFramebufferDrawBuffer(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glNamedFramebufferDrawBuffer(a0,a1);}
+static void replay_glColor4ubv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLubyte*>();if(replayer.isCorrupted())return;gl.glColor4ubv(a0);}
+static void replay_glColor3hvNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLhalfNV*>();if(replayer.isCorrupted())return;gl.glColor3hvNV(a0);}
+static void replay_glGetMapAttribParameterfvNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glGetMapAttribParameterfvNV(a0,a1,a2,a3);}
+static void replay_glGetBufferSubData(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLintptr>();auto const a2=replayer.value<GLsizeiptr>();auto const a3=replayer.output<void*>();if(replayer.isCorrupted())return;gl.glGetBufferSubData(a0,a1,a2,a3);}
+static void replay_glGetVertexAttribLdv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLdouble*>();if(replayer.isCorrupted())return;gl.glGetVertexAttribLdv(a0,a1,a2);}
+static void replay_glGetnUniformuiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.output<GLuint*>();if(replayer.isCorrupted())return;gl.glGetnUniformuiv(a0,a1,a2,a3);}
+static void replay_glGetUniformui64vNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.output<GLuint64EXT*>();if(replayer.isCorrupted())return;gl.glGetUniformui64vNV(a0,a1,a2);}
+static void replay_glNamedRenderbufferStorageEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glNamedRenderbufferStorageEXT(a0,a1,a2,a3);}
+static void replay_glVertexAttrib3dNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLdouble>();auto const a2=replayer.value<GLdouble>();auto const a3=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glVertexAttrib3dNV(a0,a1,a2,a3);}
+static void replay_glTextureStorage1DEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLenum>();auto const a4=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glTextureStorage1DEXT(a0,a1,a2,a3,a4);}
+static void replay_glPixelTexGenParameteriSGIS(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glPixelTexGenParameteriSGIS(a0,a1);}
+static void replay_glColorTableEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLenum>();auto const a4=replayer.value<GLenum>();auto const a5=replayer.value<const void*>();if(replayer.isCorrupted())return;gl.glColorTableEXT(a0,a1,a2,a3,a4,a5);}
+static void replay_glGenBuffers(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.output<GLuint*>();if(replayer.isCorrupted())return;gl.glGenBuffers(a0,a1);replayer.checkNames(a1);}
+static void replay_glMultiTexCoord3xvOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLfixed*>();if(replayer.isCorrupted())return;gl.glMultiTexCoord3xvOES(a0,a1);}
+static void replay_glExecuteProgramNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.null<const GLfloat*>();if(replayer.isCorrupted())return;gl.glExecuteProgramNV(a0,a1,a2);}
+static void replay_glVariantArrayObjectATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLuint>();auto const a4=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glVariantArrayObjectATI(a0,a1,a2,a3,a4);}
+static void replay_glColor3xvOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLfixed*>();if(replayer.isCorrupted())return;gl.glColor3xvOES(a0);}
+static void replay_glGetnConvolutionFilterARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.output<void*>();if(replayer.isCorrupted())return;gl.glGetnConvolutionFilterARB(a0,a1,a2,a3,a4);}
+static void replay_glNormalFormatNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glNormalFormatNV(a0,a1);}
+static void replay_glGetInvariantFloatvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glGetInvariantFloatvEXT(a0,a1,a2);}
+static void replay_glClearNamedFramebufferiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLint>();auto const a3=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glClearNamedFramebufferiv(a0,a1,a2,a3);}
+static void replay_glTexImage3D(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.value<GLsizei>();auto const a5=replayer.value<GLsizei>();auto const a6=replayer.value<GLint>();auto const a7=replayer.value<GLenum>();auto const a8=replayer.value<GLenum>();auto const a9=replayer.pixels<const GLvoid*>();if(replayer.isCorrupted())return;gl.glTexImage3D(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}
+static void replay_glGenSamplers(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.output<GLuint*>();if(replayer.isCorrupted())return;gl.glGenSamplers(a0,a1);}
+static void replay_glIsFramebuffer(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glIsFramebuffer(a0);}
+static void replay_glProgramUniform3dvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glProgramUniform3dvEXT(a0,a1,a2,a3);}
+static void replay_glGetVertexAttribfvNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glGetVertexAttribfvNV(a0,a1,a2);}
+static void replay_glDrawRangeElementArrayAPPLE(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glDrawRangeElementArrayAPPLE(a0,a1,a2,a3,a4);}
+static void replay_glUniform3i64NV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLint64EXT>();auto const a2=replayer.value<GLint64EXT>();auto const a3=replayer.value<GLint64EXT>();if(replayer.isCorrupted())return;gl.glUniform3i64NV(a0,a1,a2,a3);}
+static void replay_glMatrixPopEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glMatrixPopEXT(a0);}
+static void replay_glVertexStream1sATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLshort>();if(replayer.isCorrupted())return;gl.glVertexStream1sATI(a0,a1);}
+static void replay_glGetnPixelMapuivARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.output<GLuint*>();if(replayer.isCorrupted())return;gl.glGetnPixelMapuivARB(a0,a1,a2);}
+static void replay_glMultiTexEnviEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glMultiTexEnviEXT(a0,a1,a2,a3);}
+static void replay_glVertexAttribI2iEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glVertexAttribI2iEXT(a0,a1,a2);}
+static void replay_glProgramParameter4fvNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glProgramParameter4fvNV(a0,a1,a2);}
+static void replay_glNamedFramebufferSampleLocationsfvNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glNamedFramebufferSampleLocationsfvNV(a0,a1,a2,a3);}
+static void replay_glTexCoordP4uiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glTexCoordP4uiv(a0,a1);}
+static void replay_glRectxvOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.null<const GLfixed*>();auto const a1=replayer.null<const GLfixed*>();if(replayer.isCorrupted())return;gl.glRectxvOES(a0,a1);}
+static void replay_glGetVariantIntegervEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetVariantIntegervEXT(a0,a1,a2);}
+static void replay_glDeleteLists(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glDeleteLists(a0,a1);}
+static void replay_glTexGendv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.null<const GLdouble*>();if(replayer.isCorrupted())return;gl.glTexGendv(a0,a1,a2);}
+static void replay_glVertexP2uiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glVertexP2uiv(a0,a1);}
+static void replay_glGetPerfMonitorGroupsAMD(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.output<GLint*>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.output<GLuint*>();if(replayer.isCorrupted())return;gl.glGetPerfMonitorGroupsAMD(a0,a1,a2);}
+static void replay_glMultTransposeMatrixfARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glMultTransposeMatrixfARB(a0);}
+static void replay_glVertexAttribI2ivEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glVertexAttribI2ivEXT(a0,a1);}
+static void replay_glReplacementCodeuiColor4fNormal3fVertex3fvSUN(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLuint*>();auto const a1=replayer.data<const GLfloat*>();auto const a2=replayer.data<const GLfloat*>();auto const a3=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glReplacementCodeuiColor4fNormal3fVertex3fvSUN(a0,a1,a2,a3);}
+static void replay_glDeleteStatesNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glDeleteStatesNV(a0,a1);}
+static void replay_glGetBufferParameteri64v(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLint64*>();if(replayer.isCorrupted())return;gl.glGetBufferParameteri64v(a0,a1,a2);}
+static void replay_glProgramUniform4dv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glProgramUniform4dv(a0,a1,a2,a3);}
+static void replay_glEdgeFlagPointerEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLboolean*>();if(replayer.isCorrupted())return;gl.glEdgeFlagPointerEXT(a0,a1,a2);}
+static void replay_glVideoCaptureStreamParameterivNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.null<const GLint*>();if(replayer.isCorrupted())return;gl.glVideoCaptureStreamParameterivNV(a0,a1,a2,a3);}
+static void replay_glVertexStream4iATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glVertexStream4iATI(a0,a1,a2,a3,a4);}
+static void replay_glVDPAUFiniNV(FunctionTable const&gl,CallReplayer&replayer){if(replayer.isCorrupted())return;gl.glVDPAUFiniNV();}
+static void replay_glMakeBufferNonResidentNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glMakeBufferNonResidentNV(a0);}
+static void replay_glUniform1ui64ARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLuint64>();if(replayer.isCorrupted())return;gl.glUniform1ui64ARB(a0,a1);}
+static void replay_glStencilStrokePathNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glStencilStrokePathNV(a0,a1,a2);}
+static void replay_glProgramUniform3uiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glProgramUniform3uiv(a0,a1,a2,a3);}
+static void replay_glVariantuivEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.null<const GLuint*>();if(replayer.isCorrupted())return;gl.glVariantuivEXT(a0,a1);}
+static void replay_glCopyTexSubImage3DEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLint>();auto const a5=replayer.value<GLint>();auto const a6=replayer.value<GLint>();auto const a7=replayer.value<GLsizei>();auto const a8=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glCopyTexSubImage3DEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+static void replay_glSpriteParameteriSGIX(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glSpriteParameteriSGIX(a0,a1);}
+static void replay_glMultiTexCoord1sARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLshort>();if(replayer.isCorrupted())return;gl.glMultiTexCoord1sARB(a0,a1);}
+static void replay_glConvolutionParameterfv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.null<const GLfloat*>();if(replayer.isCorrupted())return;gl.glConvolutionParameterfv(a0,a1,a2);}
+static void replay_glMakeTextureHandleResidentNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint64>();if(replayer.isCorrupted())return;gl.glMakeTextureHandleResidentNV(a0);}
+static void replay_glMultMatrixxOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLfixed*>();if(replayer.isCorrupted())return;gl.glMultMatrixxOES(a0);}
+static void replay_glTextureNormalEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glTextureNormalEXT(a0);}
+static void replay_glGetQueryivARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetQueryivARB(a0,a1,a2);}
+static void replay_glCompressedMultiTexImage3DEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLenum>();auto const a4=replayer.value<GLsizei>();auto const a5=replayer.value<GLsizei>();auto const a6=replayer.value<GLsizei>();auto const a7=replayer.value<GLint>();auto const a8=replayer.value<GLsizei>();auto const a9=replayer.pixels<const void*>();if(replayer.isCorrupted())return;gl.glCompressedMultiTexImage3DEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}
+static void replay_glGetInstrumentsSGIX(FunctionTable const&gl,CallReplayer&replayer){if(replayer.isCorrupted())return;gl.glGetInstrumentsSGIX();}
+static void replay_glProgramUniformMatrix4x3fvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLboolean>();auto const a4=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glProgramUniformMatrix4x3fvEXT(a0,a1,a2,a3,a4);}
+static void replay_glPointParameterf(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glPointParameterf(a0,a1);}
+static void replay_glProgramUniform3dEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLdouble>();auto const a3=replayer.value<GLdouble>();auto const a4=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glProgramUniform3dEXT(a0,a1,a2,a3,a4);}
+static void replay_glMultiTexCoord2hNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLhalfNV>();auto const a2=replayer.value<GLhalfNV>();if(replayer.isCorrupted())return;gl.glMultiTexCoord2hNV(a0,a1,a2);}
+static void replay_glGetConvolutionFilterEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.output<void*>();if(replayer.isCorrupted())return;gl.glGetConvolutionFilterEXT(a0,a1,a2,a3);}
+static void replay_glVertexAttrib2hNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLhalfNV>();auto const a2=replayer.value<GLhalfNV>();if(replayer.isCorrupted())return;gl.glVertexAttrib2hNV(a0,a1,a2);}
+static void replay_glCurrentPaletteMatrixARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glCurrentPaletteMatrixARB(a0);}
+static void replay_glFogxvOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.null<const GLfixed*>();if(replayer.isCorrupted())return;gl.glFogxvOES(a0,a1);}
+static void replay_glCreateRenderbuffers(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.output<GLuint*>();if(replayer.isCorrupted())return;gl.glCreateRenderbuffers(a0,a1);replayer.checkNames(a1);}
+static void replay_glVertexAttrib4Nusv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLushort*>();if(replayer.isCorrupted())return;gl.glVertexAttrib4Nusv(a0,a1);}
+static void replay_glCombinerInputNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLenum>();auto const a4=replayer.value<GLenum>();auto const a5=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glCombinerInputNV(a0,a1,a2,a3,a4,a5);}
+static void replay_glDepthFunc(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glDepthFunc(a0);}
+static void replay_glWindowPos4fMESA(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfloat>();auto const a1=replayer.value<GLfloat>();auto const a2=replayer.value<GLfloat>();auto const a3=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glWindowPos4fMESA(a0,a1,a2,a3);}
+static void replay_glEnableClientStateIndexedEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glEnableClientStateIndexedEXT(a0,a1);}
+static void replay_glTexCoord4iv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glTexCoord4iv(a0);}
+static void replay_glProgramUniform4i64ARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint64>();auto const a3=replayer.value<GLint64>();auto const a4=replayer.value<GLint64>();auto const a5=replayer.value<GLint64>();if(replayer.isCorrupted())return;gl.glProgramUniform4i64ARB(a0,a1,a2,a3,a4,a5);}
+static void replay_glBlendFunci(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glBlendFunci(a0,a1,a2);}
+static void replay_glResolveDepthValuesNV(FunctionTable const&gl,CallReplayer&replayer){if(replayer.isCorrupted())return;gl.glResolveDepthValuesNV();}
+static void replay_glTextureColorMaskSGIS(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLboolean>();auto const a1=replayer.value<GLboolean>();auto const a2=replayer.value<GLboolean>();auto const a3=replayer.value<GLboolean>();if(replayer.isCorrupted())return;gl.glTextureColorMaskSGIS(a0,a1,a2,a3);}
+static void replay_glCreateShaderProgramEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLchar*>();if(replayer.isCorrupted())return;auto const result=gl.glCreateShaderProgramEXT(a0,a1);replayer.checkName(result);}
+static void replay_glBufferStorage(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLsizeiptr>();auto const a2=replayer.data<const void*>();auto const a3=replayer.value<GLbitfield>();if(replayer.isCorrupted())return;gl.glBufferStorage(a0,a1,a2,a3);}
+static void replay_glMakeNamedBufferNonResidentNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glMakeNamedBufferNonResidentNV(a0);}
+static void replay_glRenderbufferStorageMultisampleEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glRenderbufferStorageMultisampleEXT(a0,a1,a2,a3,a4);}
+static void replay_glGetFloati_v(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glGetFloati_v(a0,a1,a2);}
+static void replay_glUniform2ui64ARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLuint64>();auto const a2=replayer.value<GLuint64>();if(replayer.isCorrupted())return;gl.glUniform2ui64ARB(a0,a1,a2);}
+static void replay_glVertex3fv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glVertex3fv(a0);}
+static void replay_glGetUniformLocation(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLchar*>();if(replayer.isCorrupted())return;gl.glGetUniformLocation(a0,a1);}
+static void replay_glVertexStream1svATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLshort*>();if(replayer.isCorrupted())return;gl.glVertexStream1svATI(a0,a1);}
+static void replay_glVertexStream3fATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLfloat>();auto const a2=replayer.value<GLfloat>();auto const a3=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glVertexStream3fATI(a0,a1,a2,a3);}
+static void replay_glNamedFramebufferDrawBuffers(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLenum*>();if(replayer.isCorrupted())return;gl.glNamedFramebufferDrawBuffers(a0,a1,a2);}
+static void replay_glUniform2ui64vNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLuint64EXT*>();if(replayer.isCorrupted())return;gl.glUniform2ui64vNV(a0,a1,a2);}
+static void replay_glTexCoordPointervINTEL(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<const void**>();if(replayer.isCorrupted())return;gl.glTexCoordPointervINTEL(a0,a1,a2);}
+static void replay_glUniform4fv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glUniform4fv(a0,a1,a2);}
+static void replay_glNormalPointerEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<const void*>();if(replayer.isCorrupted())return;gl.glNormalPointerEXT(a0,a1,a2,a3);}
+static void replay_glVertexAttrib4hNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLhalfNV>();auto const a2=replayer.value<GLhalfNV>();auto const a3=replayer.value<GLhalfNV>();auto const a4=replayer.value<GLhalfNV>();if(replayer.isCorrupted())return;gl.glVertexAttrib4hNV(a0,a1,a2,a3,a4);}
+static void replay_glNormal3f(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfloat>();auto const a1=replayer.value<GLfloat>();auto const a2=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glNormal3f(a0,a1,a2);}
+static void replay_glVertexStream2iATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glVertexStream2iATI(a0,a1,a2);}
+static void replay_glVertexAttribP4uiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLboolean>();auto const a3=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glVertexAttribP4uiv(a0,a1,a2,a3);}
+static void replay_glCompressedTextureSubImage3D(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLint>();auto const a5=replayer.value<GLsizei>();auto const a6=replayer.value<GLsizei>();auto const a7=replayer.value<GLsizei>();auto const a8=replayer.value<GLenum>();auto const a9=replayer.value<GLsizei>();auto const a10=replayer.pixels<const void*>();if(replayer.isCorrupted())return;gl.glCompressedTextureSubImage3D(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10);}
+static void replay_glAsyncMarkerSGIX(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glAsyncMarkerSGIX(a0);}
+static void replay_glTextureStorageSparseAMD(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.value<GLsizei>();auto const a5=replayer.value<GLsizei>();auto const a6=replayer.value<GLsizei>();auto const a7=replayer.value<GLbitfield>();if(replayer.isCorrupted())return;gl.glTextureStorageSparseAMD(a0,a1,a2,a3,a4,a5,a6,a7);}
+static void replay_glGetConvolutionParameterivEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetConvolutionParameterivEXT(a0,a1,a2);}
+static void replay_glEndPerfQueryINTEL(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glEndPerfQueryINTEL(a0);}
+static void replay_glFragmentLightModeliSGIX(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glFragmentLightModeliSGIX(a0,a1);}
+static void replay_glPrioritizeTexturesEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.data<const GLuint*>();auto const a2=replayer.data<const GLclampf*>();if(replayer.isCorrupted())return;gl.glPrioritizeTexturesEXT(a0,a1,a2);}
+static void replay_glEndConditionalRender(FunctionTable const&gl,CallReplayer&replayer){if(replayer.isCorrupted())return;gl.glEndConditionalRender();}
+static void replay_glEnableClientState(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glEnableClientState(a0);}
+static void replay_glResetHistogram(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glResetHistogram(a0);}
+static void replay_glGetOcclusionQueryivNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetOcclusionQueryivNV(a0,a1,a2);}
+static void replay_glUniform1uiEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glUniform1uiEXT(a0,a1);}
+static void replay_glMultiTexCoord2sv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLshort*>();if(replayer.isCorrupted())return;gl.glMultiTexCoord2sv(a0,a1);}
+static void replay_glTexSubImage2DEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLsizei>();auto const a5=replayer.value<GLsizei>();auto const a6=replayer.value<GLenum>();auto const a7=replayer.value<GLenum>();auto const a8=replayer.value<const void*>();if(replayer.isCorrupted())return;gl.glTexSubImage2DEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+static void replay_glProgramUniform2uiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glProgramUniform2uiv(a0,a1,a2,a3);}
+static void replay_glMultiTexCoord2iARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glMultiTexCoord2iARB(a0,a1,a2);}
+static void replay_glGetQueryObjectuiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLuint*>();if(replayer.isCorrupted())return;gl.glGetQueryObjectuiv(a0,a1,a2);}
+static void replay_glGenerateMultiTexMipmapEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glGenerateMultiTexMipmapEXT(a0,a1);}
+static void replay_glVertexAttrib4iv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glVertexAttrib4iv(a0,a1);}
+static void replay_glWindowPos3dvMESA(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glWindowPos3dvMESA(a0);}
+static void replay_glLabelObjectEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.data<const GLchar*>();if(replayer.isCorrupted())return;gl.glLabelObjectEXT(a0,a1,a2,a3);}
+static void replay_glProgramUniform1uiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glProgramUniform1uiv(a0,a1,a2,a3);}
+static void replay_glFramebufferTexture(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glFramebufferTexture(a0,a1,a2,a3);}
+static void replay_glMultiTexEnvfEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glMultiTexEnvfEXT(a0,a1,a2,a3);}
+static void replay_glGetTexGendv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLdouble*>();if(replayer.isCorrupted())return;gl.glGetTexGendv(a0,a1,a2);}
+static void replay_glVertex4xOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfixed>();auto const a1=replayer.value<GLfixed>();auto const a2=replayer.value<GLfixed>();if(replayer.isCorrupted())return;gl.glVertex4xOES(a0,a1,a2);}
+static void replay_glVertexAttribI2uivEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glVertexAttribI2uivEXT(a0,a1);}
+static void replay_glNamedProgramLocalParameter4fvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glNamedProgramLocalParameter4fvEXT(a0,a1,a2,a3);}
+static void replay_glPointParameterfvSGIS(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.null<const GLfloat*>();if(replayer.isCorrupted())return;gl.glPointParameterfvSGIS(a0,a1);}
+static void replay_glGetPixelTransformParameterfvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glGetPixelTransformParameterfvEXT(a0,a1,a2);}
+static void replay_glIndexxvOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.null<const GLfixed*>();if(replayer.isCorrupted())return;gl.glIndexxvOES(a0);}
+static void replay_glDepthMask(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLboolean>();if(replayer.isCorrupted())return;gl.glDepthMask(a0);}
+static void replay_glProgramUniformMatrix2x4fv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLboolean>();auto const a4=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glProgramUniformMatrix2x4fv(a0,a1,a2,a3,a4);}
+static void replay_glAreProgramsResidentNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.data<const GLuint*>();auto const a2=replayer.output<GLboolean*>();if(replayer.isCorrupted())return;gl.glAreProgramsResidentNV(a0,a1,a2);}
+static void replay_glColorTable(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLenum>();auto const a4=replayer.value<GLenum>();auto const a5=replayer.value<const GLvoid*>();if(replayer.isCorrupted())return;gl.glColorTable(a0,a1,a2,a3,a4,a5);}
+static void replay_glBeginQueryIndexed(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glBeginQueryIndexed(a0,a1,a2);}
+static void replay_glVertexStream1dvATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glVertexStream1dvATI(a0,a1);}
+static void replay_glGetMultiTexEnvfvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glGetMultiTexEnvfvEXT(a0,a1,a2,a3);}
+static void replay_glDeleteFencesNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glDeleteFencesNV(a0,a1);}
+static void replay_glVertexAttribs1dvNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glVertexAttribs1dvNV(a0,a1,a2);}
+static void replay_glVertexStream2sATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLshort>();auto const a2=replayer.value<GLshort>();if(replayer.isCorrupted())return;gl.glVertexStream2sATI(a0,a1,a2);}
+static void replay_glGetnSeparableFilterARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.output<void*>();auto const a5=replayer.value<GLsizei>();auto const a6=replayer.output<void*>();auto const a7=replayer.output<void*>();if(replayer.isCorrupted())return;gl.glGetnSeparableFilterARB(a0,a1,a2,a3,a4,a5,a6,a7);}
+static void replay_glProgramUniform2dv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glProgramUniform2dv(a0,a1,a2,a3);}
+static void replay_glActiveStencilFaceEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glActiveStencilFaceEXT(a0);}
+static void replay_glProgramUniform4dEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLdouble>();auto const a3=replayer.value<GLdouble>();auto const a4=replayer.value<GLdouble>();auto const a5=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glProgramUniform4dEXT(a0,a1,a2,a3,a4,a5);}
+static void replay_glPointSizexOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfixed>();if(replayer.isCorrupted())return;gl.glPointSizexOES(a0);}
+static void replay_glRasterPos2sv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLshort*>();if(replayer.isCorrupted())return;gl.glRasterPos2sv(a0);}
+static void replay_glBindParameterEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glBindParameterEXT(a0);}
+static void replay_glTexCoord1sv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLshort*>();if(replayer.isCorrupted())return;gl.glTexCoord1sv(a0);}
+static void replay_glBlendParameteriNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glBlendParameteriNV(a0,a1);}
+static void replay_glNamedProgramLocalParameter4dvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glNamedProgramLocalParameter4dvEXT(a0,a1,a2,a3);}
+static void replay_glProgramUniformHandleui64NV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLuint64>();if(replayer.isCorrupted())return;gl.glProgramUniformHandleui64NV(a0,a1,a2);}
+static void replay_glGetTextureParameterfvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glGetTextureParameterfvEXT(a0,a1,a2,a3);}
+static void replay_glGetPathMetricsNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLbitfield>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<const void*>();auto const a4=replayer.value<GLuint>();auto const a5=replayer.value<GLsizei>();auto const a6=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glGetPathMetricsNV(a0,a1,a2,a3,a4,a5,a6);}
+static void replay_glVertex2i(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glVertex2i(a0,a1);}
+static void replay_glNewList(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glNewList(a0,a1);}
+static void replay_glMatrixLoad3x3fNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glMatrixLoad3x3fNV(a0,a1);}
+static void replay_glMultiTexCoord2fARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLfloat>();auto const a2=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glMultiTexCoord2fARB(a0,a1,a2);}
+static void replay_glWeightdvARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glWeightdvARB(a0,a1);}
+static void replay_glIsTransformFeedbackNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glIsTransformFeedbackNV(a0);}
+static void replay_glVertexAttribDivisorARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glVertexAttribDivisorARB(a0,a1);}
+static void replay_glSecondaryColorP3uiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glSecondaryColorP3uiv(a0,a1);}
+static void replay_glGetnCompressedTexImageARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.output<void*>();if(replayer.isCorrupted())return;gl.glGetnCompressedTexImageARB(a0,a1,a2,a3);}
+static void replay_glGetIntegerv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetIntegerv(a0,a1);}
+static void replay_glMatrixLoaddEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glMatrixLoaddEXT(a0,a1);}
+static void replay_glGetPathLengthNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glGetPathLengthNV(a0,a1,a2);}
+static void replay_glProgramUniformMatrix3dv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLboolean>();auto const a4=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glProgramUniformMatrix3dv(a0,a1,a2,a3,a4);}
+static void replay_glUniform4i64NV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLint64EXT>();auto const a2=replayer.value<GLint64EXT>();auto const a3=replayer.value<GLint64EXT>();auto const a4=replayer.value<GLint64EXT>();if(replayer.isCorrupted())return;gl.glUniform4i64NV(a0,a1,a2,a3,a4);}
+static void replay_glGetHistogramEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLboolean>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLenum>();auto const a4=replayer.output<void*>();if(replayer.isCorrupted())return;gl.glGetHistogramEXT(a0,a1,a2,a3,a4);}
+static void replay_glVertexAttrib4NuivARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glVertexAttrib4NuivARB(a0,a1);}
+static void replay_glMapGrid2xOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLfixed>();auto const a2=replayer.value<GLfixed>();auto const a3=replayer.value<GLfixed>();auto const a4=replayer.value<GLfixed>();if(replayer.isCorrupted())return;gl.glMapGrid2xOES(a0,a1,a2,a3,a4);}
+static void replay_glTexImage2D(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.value<GLsizei>();auto const a5=replayer.value<GLint>();auto const a6=replayer.value<GLenum>();auto const a7=replayer.value<GLenum>();auto const a8=replayer.pixels<const GLvoid*>();if(replayer.isCorrupted())return;gl.glTexImage2D(a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+static void replay_glWindowPos2fvARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glWindowPos2fvARB(a0);}
+static void replay_glEnableIndexedEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glEnableIndexedEXT(a0,a1);}
+static void replay_glTexCoord1bvOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLbyte*>();if(replayer.isCorrupted())return;gl.glTexCoord1bvOES(a0);}
+static void replay_glDrawPixels(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLenum>();auto const a4=replayer.value<const GLvoid*>();if(replayer.isCorrupted())return;gl.glDrawPixels(a0,a1,a2,a3,a4);}
+static void replay_glMultMatrixd(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glMultMatrixd(a0);}
+static void replay_glMultMatrixf(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glMultMatrixf(a0);}
+static void replay_glReplacementCodePointerSUN(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.value<const void**>();if(replayer.isCorrupted())return;gl.glReplacementCodePointerSUN(a0,a1,a2);}
+static void replay_glLoadTransposeMatrixdARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glLoadTransposeMatrixdARB(a0);}
+static void replay_glVertexAttrib4Nubv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLubyte*>();if(replayer.isCorrupted())return;gl.glVertexAttrib4Nubv(a0,a1);}
+static void replay_glVertexArrayVertexAttribIOffsetEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLenum>();auto const a5=replayer.value<GLsizei>();auto const a6=replayer.value<GLintptr>();if(replayer.isCorrupted())return;gl.glVertexArrayVertexAttribIOffsetEXT(a0,a1,a2,a3,a4,a5,a6);}
+static void replay_glCompileShaderARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLhandleARB>();if(replayer.isCorrupted())return;gl.glCompileShaderARB(a0);}
+static void replay_glWindowPos3dMESA(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLdouble>();auto const a1=replayer.value<GLdouble>();auto const a2=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glWindowPos3dMESA(a0,a1,a2);}
+static void replay_glNormalStream3fvATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glNormalStream3fvATI(a0,a1);}
+static void replay_glColor4usv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLushort*>();if(replayer.isCorrupted())return;gl.glColor4usv(a0);}
+static void replay_glMapGrid1f(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLfloat>();auto const a2=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glMapGrid1f(a0,a1,a2);}
+static void replay_glPolygonStipple(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.null<const GLubyte*>();if(replayer.isCorrupted())return;gl.glPolygonStipple(a0);}
+static void replay_glUniform4ui64ARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLuint64>();auto const a2=replayer.value<GLuint64>();auto const a3=replayer.value<GLuint64>();auto const a4=replayer.value<GLuint64>();if(replayer.isCorrupted())return;gl.glUniform4ui64ARB(a0,a1,a2,a3,a4);}
+static void replay_glTextureRenderbufferEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glTextureRenderbufferEXT(a0,a1,a2);}
+static void replay_glGetSubroutineUniformLocation(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.data<const GLchar*>();if(replayer.isCorrupted())return;gl.glGetSubroutineUniformLocation(a0,a1,a2);}
+static void replay_glGetFramebufferParameteriv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetFramebufferParameteriv(a0,a1,a2);}
+static void replay_glPixelMapusv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.null<const GLushort*>();if(replayer.isCorrupted())return;gl.glPixelMapusv(a0,a1,a2);}
+static void replay_glGetSamplerParameteriv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetSamplerParameteriv(a0,a1,a2);}
+static void replay_glVertexStream2fvATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glVertexStream2fvATI(a0,a1);}
+static void replay_glProgramStringARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<const void*>();if(replayer.isCorrupted())return;gl.glProgramStringARB(a0,a1,a2,a3);}
+static void replay_glProgramUniformMatrix3dvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLboolean>();auto const a4=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glProgramUniformMatrix3dvEXT(a0,a1,a2,a3,a4);}
+static void replay_glSeparableFilter2D(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.value<GLenum>();auto const a5=replayer.value<GLenum>();auto const a6=replayer.value<const GLvoid*>();auto const a7=replayer.value<const GLvoid*>();if(replayer.isCorrupted())return;gl.glSeparableFilter2D(a0,a1,a2,a3,a4,a5,a6,a7);}
+static void replay_glVertexAttribI1uiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glVertexAttribI1uiv(a0,a1);}
+static void replay_glTexStorage2D(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glTexStorage2D(a0,a1,a2,a3,a4);}
+static void replay_glColor3fv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glColor3fv(a0);}
+static void replay_glVertexAttribL4dvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glVertexAttribL4dvEXT(a0,a1);}
+static void replay_glGetActiveUniform(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.output<GLsizei*>();auto const a4=replayer.output<GLint*>();auto const a5=replayer.output<GLenum*>();auto const a6=replayer.output<GLchar*>();if(replayer.isCorrupted())return;gl.glGetActiveUniform(a0,a1,a2,a3,a4,a5,a6);}
+static void replay_glUniform2ui64vARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLuint64*>();if(replayer.isCorrupted())return;gl.glUniform2ui64vARB(a0,a1,a2);}
+static void replay_glMakeNamedBufferResidentNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glMakeNamedBufferResidentNV(a0,a1);}
+static void replay_glPathGlyphIndexRangeNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<const void*>();auto const a2=replayer.value<GLbitfield>();auto const a3=replayer.value<GLuint>();auto const a4=replayer.value<GLfloat>();auto const a5=replayer.output<GLuint*>();if(replayer.isCorrupted())return;gl.glPathGlyphIndexRangeNV(a0,a1,a2,a3,a4,a5);}
+static void replay_glColorPointer(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<const GLvoid*>();if(replayer.isCorrupted())return;gl.glColorPointer(a0,a1,a2,a3);}
+static void replay_glProgramEnvParameterI4ivNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glProgramEnvParameterI4ivNV(a0,a1,a2);}
+static void replay_glMultiTexParameterfEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glMultiTexParameterfEXT(a0,a1,a2,a3);}
+static void replay_glNamedFramebufferTextureLayer(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glNamedFramebufferTextureLayer(a0,a1,a2,a3,a4);}
+static void replay_glGetVertexArrayIntegervEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetVertexArrayIntegervEXT(a0,a1,a2);}
+static void replay_glVertexAttrib3dARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLdouble>();auto const a2=replayer.value<GLdouble>();auto const a3=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glVertexAttrib3dARB(a0,a1,a2,a3);}
+static void replay_glVDPAUIsSurfaceNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLvdpauSurfaceNV>();if(replayer.isCorrupted())return;gl.glVDPAUIsSurfaceNV(a0);}
+static void replay_glMultiTexImage1DEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLsizei>();auto const a5=replayer.value<GLint>();auto const a6=replayer.value<GLenum>();auto const a7=replayer.value<GLenum>();auto const a8=replayer.value<const void*>();if(replayer.isCorrupted())return;gl.glMultiTexImage1DEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+static void replay_glIsAsyncMarkerSGIX(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glIsAsyncMarkerSGIX(a0);}
+static void replay_glGetDoublei_vEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.output<GLdouble*>();if(replayer.isCorrupted())return;gl.glGetDoublei_vEXT(a0,a1,a2);}
+static void replay_glUniform2i64NV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLint64EXT>();auto const a2=replayer.value<GLint64EXT>();if(replayer.isCorrupted())return;gl.glUniform2i64NV(a0,a1,a2);}
+static void replay_glIsCommandListNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glIsCommandListNV(a0);}
+static void replay_glUniform3uiEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glUniform3uiEXT(a0,a1,a2,a3);}
+static void replay_glTexParameterIuivEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glTexParameterIuivEXT(a0,a1,a2);}
+static void replay_glProgramUniformMatrix4fv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLboolean>();auto const a4=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glProgramUniformMatrix4fv(a0,a1,a2,a3,a4);}
+static void replay_glVertex2fv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glVertex2fv(a0);}
+static void replay_glVertexAttribL3dEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLdouble>();auto const a2=replayer.value<GLdouble>();auto const a3=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glVertexAttribL3dEXT(a0,a1,a2,a3);}
+static void replay_glFramebufferRenderbuffer(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glFramebufferRenderbuffer(a0,a1,a2,a3);}
+static void replay_glGetUniformLocationARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLhandleARB>();auto const a1=replayer.data<const GLcharARB*>();if(replayer.isCorrupted())return;gl.glGetUniformLocationARB(a0,a1);}
+static void replay_glPathParameterfvNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.null<const GLfloat*>();if(replayer.isCorrupted())return;gl.glPathParameterfvNV(a0,a1,a2);}
+static void replay_glVertexAttrib3sNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLshort>();auto const a2=replayer.value<GLshort>();auto const a3=replayer.value<GLshort>();if(replayer.isCorrupted())return;gl.glVertexAttrib3sNV(a0,a1,a2,a3);}
+static void replay_glGetDoublei_v(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.output<GLdouble*>();if(replayer.isCorrupted())return;gl.glGetDoublei_v(a0,a1,a2);}
+static void replay_glVertexAttrib1sv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLshort*>();if(replayer.isCorrupted())return;gl.glVertexAttrib1sv(a0,a1);}
+static void replay_glBindSampler(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glBindSampler(a0,a1);}
+static void replay_glLineWidth(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glLineWidth(a0);}
+static void replay_glVertexArrayRangeAPPLE(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.output<void*>();if(replayer.isCorrupted())return;gl.glVertexArrayRangeAPPLE(a0,a1);}
+static void replay_glBindBufferOffsetEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<GLintptr>();if(replayer.isCorrupted())return;gl.glBindBufferOffsetEXT(a0,a1,a2,a3);}
+static void replay_glWeightfvARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glWeightfvARB(a0,a1);}
+static void replay_glGetIntegeri_v(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetIntegeri_v(a0,a1,a2);}
+static void replay_glGetTransformFeedbackVarying(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.output<GLsizei*>();auto const a4=replayer.output<GLsizei*>();auto const a5=replayer.output<GLenum*>();auto const a6=replayer.output<GLchar*>();if(replayer.isCorrupted())return;gl.glGetTransformFeedbackVarying(a0,a1,a2,a3,a4,a5,a6);}
+static void replay_glProgramLocalParameter4fvARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glProgramLocalParameter4fvARB(a0,a1,a2);}
+static void replay_glGetTransformFeedbackVaryingNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetTransformFeedbackVaryingNV(a0,a1,a2);}
+static void replay_glWindowPos2iv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glWindowPos2iv(a0);}
+static void replay_glVertexStream1dATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glVertexStream1dATI(a0,a1);}
+static void replay_glColorFragmentOp2ATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<GLuint>();auto const a4=replayer.value<GLuint>();auto const a5=replayer.value<GLuint>();auto const a6=replayer.value<GLuint>();auto const a7=replayer.value<GLuint>();auto const a8=replayer.value<GLuint>();auto const a9=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glColorFragmentOp2ATI(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}
+static void replay_glFogiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.null<const GLint*>();if(replayer.isCorrupted())return;gl.glFogiv(a0,a1);}
+static void replay_glGetTextureHandleNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glGetTextureHandleNV(a0);}
+static void replay_glLightModeliv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.null<const GLint*>();if(replayer.isCorrupted())return;gl.glLightModeliv(a0,a1);}
+static void replay_glDepthRangef(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfloat>();auto const a1=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glDepthRangef(a0,a1);}
+static void replay_glGetFragmentMaterialivSGIX(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetFragmentMaterialivSGIX(a0,a1,a2);}
+static void replay_glVideoCaptureStreamParameterfvNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.null<const GLfloat*>();if(replayer.isCorrupted())return;gl.glVideoCaptureStreamParameterfvNV(a0,a1,a2,a3);}
+static void replay_glDeleteProgramsARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glDeleteProgramsARB(a0,a1);}
+static void replay_glWindowPos3fvARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glWindowPos3fvARB(a0);}
+static void replay_glFeedbackBufferxOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.data<const GLfixed*>();if(replayer.isCorrupted())return;gl.glFeedbackBufferxOES(a0,a1,a2);}
+static void replay_glGetTexBumpParameterfvATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glGetTexBumpParameterfvATI(a0,a1);}
+static void replay_glEnablei(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glEnablei(a0,a1);}
+static void replay_glGetActiveSubroutineName(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.output<GLsizei*>();auto const a5=replayer.output<GLchar*>();if(replayer.isCorrupted())return;gl.glGetActiveSubroutineName(a0,a1,a2,a3,a4,a5);}
+static void replay_glDrawBuffersARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.data<const GLenum*>();if(replayer.isCorrupted())return;gl.glDrawBuffersARB(a0,a1);}
+static void replay_glBindProgramARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glBindProgramARB(a0,a1);}
+static void replay_glEvalCoord1fv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glEvalCoord1fv(a0);}
+static void replay_glProgramUniform3ui64vARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.data<const GLuint64*>();if(replayer.isCorrupted())return;gl.glProgramUniform3ui64vARB(a0,a1,a2,a3);}
+static void replay_glProgramUniformMatrix2dv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLboolean>();auto const a4=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glProgramUniformMatrix2dv(a0,a1,a2,a3,a4);}
+static void replay_glMultiTexCoord2hvNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLhalfNV*>();if(replayer.isCorrupted())return;gl.glMultiTexCoord2hvNV(a0,a1);}
+static void replay_glGetFloatIndexedvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glGetFloatIndexedvEXT(a0,a1,a2);}
+static void replay_glSampleCoverageARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfloat>();auto const a1=replayer.value<GLboolean>();if(replayer.isCorrupted())return;gl.glSampleCoverageARB(a0,a1);}
+static void replay_glProgramUniform2ui64vARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.data<const GLuint64*>();if(replayer.isCorrupted())return;gl.glProgramUniform2ui64vARB(a0,a1,a2,a3);}
+static void replay_glPixelDataRangeNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.value<const void*>();if(replayer.isCorrupted())return;gl.glPixelDataRangeNV(a0,a1,a2);}
+static void replay_glVertexStream3svATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLshort*>();if(replayer.isCorrupted())return;gl.glVertexStream3svATI(a0,a1);}
+static void replay_glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLuint*>();auto const a1=replayer.data<const GLfloat*>();auto const a2=replayer.data<const GLfloat*>();auto const a3=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN(a0,a1,a2,a3);}
+static void replay_glTexCoord3hvNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLhalfNV*>();if(replayer.isCorrupted())return;gl.glTexCoord3hvNV(a0);}
+static void replay_glSampleMaski(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLbitfield>();if(replayer.isCorrupted())return;gl.glSampleMaski(a0,a1);}
+static void replay_glIndexFuncEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLclampf>();if(replayer.isCorrupted())return;gl.glIndexFuncEXT(a0,a1);}
+static void replay_glPointParameteriNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glPointParameteriNV(a0,a1);}
+static void replay_glUniformMatrix3x2fv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.value<GLboolean>();auto const a3=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glUniformMatrix3x2fv(a0,a1,a2,a3);}
+static void replay_glGetFramebufferParameterivEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetFramebufferParameterivEXT(a0,a1,a2);}
+static void replay_glUniform2i64ARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLint64>();auto const a2=replayer.value<GLint64>();if(replayer.isCorrupted())return;gl.glUniform2i64ARB(a0,a1,a2);}
+static void replay_glNamedBufferStorageEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLsizeiptr>();auto const a2=replayer.data<const void*>();auto const a3=replayer.value<GLbitfield>();if(replayer.isCorrupted())return;gl.glNamedBufferStorageEXT(a0,a1,a2,a3);}
+static void replay_glNamedFramebufferTexture3DEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLuint>();auto const a4=replayer.value<GLint>();auto const a5=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glNamedFramebufferTexture3DEXT(a0,a1,a2,a3,a4,a5);}
+static void replay_glVertexAttrib2dv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glVertexAttrib2dv(a0,a1);}
+static void replay_glGetVertexArrayPointervEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<void**>();if(replayer.isCorrupted())return;gl.glGetVertexArrayPointervEXT(a0,a1,a2);}
+static void replay_glGetVertexAttribArrayObjectivATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetVertexAttribArrayObjectivATI(a0,a1,a2);}
+static void replay_glProgramUniformMatrix3fvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLboolean>();auto const a4=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glProgramUniformMatrix3fvEXT(a0,a1,a2,a3,a4);}
+static void replay_glEnableVertexArrayEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glEnableVertexArrayEXT(a0,a1);}
+static void replay_glColorTableParameterfvSGI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.null<const GLfloat*>();if(replayer.isCorrupted())return;gl.glColorTableParameterfvSGI(a0,a1,a2);}
+static void replay_glEdgeFlag(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLboolean>();if(replayer.isCorrupted())return;gl.glEdgeFlag(a0);}
+static void replay_glFogCoordf(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glFogCoordf(a0);}
+static void replay_glVertex3d(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLdouble>();auto const a1=replayer.value<GLdouble>();auto const a2=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glVertex3d(a0,a1,a2);}
+static void replay_glVertex3f(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfloat>();auto const a1=replayer.value<GLfloat>();auto const a2=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glVertex3f(a0,a1,a2);}
+static void replay_glSpriteParameterivSGIX(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.null<const GLint*>();if(replayer.isCorrupted())return;gl.glSpriteParameterivSGIX(a0,a1);}
+static void replay_glPathGlyphRangeNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<const void*>();auto const a3=replayer.value<GLbitfield>();auto const a4=replayer.value<GLuint>();auto const a5=replayer.value<GLsizei>();auto const a6=replayer.value<GLenum>();auto const a7=replayer.value<GLuint>();auto const a8=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glPathGlyphRangeNV(a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+static void replay_glPrimitiveBoundingBoxARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfloat>();auto const a1=replayer.value<GLfloat>();auto const a2=replayer.value<GLfloat>();auto const a3=replayer.value<GLfloat>();auto const a4=replayer.value<GLfloat>();auto const a5=replayer.value<GLfloat>();auto const a6=replayer.value<GLfloat>();auto const a7=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glPrimitiveBoundingBoxARB(a0,a1,a2,a3,a4,a5,a6,a7);}
+static void replay_glVertexAttribL3ui64vNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLuint64EXT*>();if(replayer.isCorrupted())return;gl.glVertexAttribL3ui64vNV(a0,a1);}
+static void replay_glVertex3s(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLshort>();auto const a1=replayer.value<GLshort>();auto const a2=replayer.value<GLshort>();if(replayer.isCorrupted())return;gl.glVertex3s(a0,a1,a2);}
+static void replay_glTexCoordP2ui(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glTexCoordP2ui(a0,a1);}
+static void replay_glProgramUniform2fvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glProgramUniform2fvEXT(a0,a1,a2,a3);}
+static void replay_glDeletePathsNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glDeletePathsNV(a0,a1);}
+static void replay_glPrimitiveRestartIndexNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glPrimitiveRestartIndexNV(a0);}
+static void replay_glTexCoord2fColor3fVertex3fvSUN(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLfloat*>();auto const a1=replayer.data<const GLfloat*>();auto const a2=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glTexCoord2fColor3fVertex3fvSUN(a0,a1,a2);}
+static void replay_glTexCoordPointerListIBM(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<const void**>();auto const a4=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glTexCoordPointerListIBM(a0,a1,a2,a3,a4);}
+static void replay_glRectxOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfixed>();auto const a1=replayer.value<GLfixed>();auto const a2=replayer.value<GLfixed>();auto const a3=replayer.value<GLfixed>();if(replayer.isCorrupted())return;gl.glRectxOES(a0,a1,a2,a3);}
+static void replay_glCopyNamedBufferSubData(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLintptr>();auto const a3=replayer.value<GLintptr>();auto const a4=replayer.value<GLsizeiptr>();if(replayer.isCorrupted())return;gl.glCopyNamedBufferSubData(a0,a1,a2,a3,a4);}
+static void replay_glGenProgramsNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.output<GLuint*>();if(replayer.isCorrupted())return;gl.glGenProgramsNV(a0,a1);replayer.checkNames(a1);}
+static void replay_glFragmentLightfSGIX(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glFragmentLightfSGIX(a0,a1,a2);}
+static void replay_glTexStorage3D(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.value<GLsizei>();auto const a5=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glTexStorage3D(a0,a1,a2,a3,a4,a5);}
+static void replay_glTextureParameteriv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glTextureParameteriv(a0,a1,a2);}
+static void replay_glNamedBufferDataEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLsizeiptr>();auto const a2=replayer.data<const void*>();auto const a3=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glNamedBufferDataEXT(a0,a1,a2,a3);}
+static void replay_glMultiTexCoord3fvARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glMultiTexCoord3fvARB(a0,a1);}
+static void replay_glUniformMatrix3x4fv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.value<GLboolean>();auto const a3=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glUniformMatrix3x4fv(a0,a1,a2,a3);}
+static void replay_glSubpixelPrecisionBiasNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glSubpixelPrecisionBiasNV(a0,a1);}
+static void replay_glNormalPointer(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.value<const GLvoid*>();if(replayer.isCorrupted())return;gl.glNormalPointer(a0,a1,a2);}
+static void replay_glNamedFramebufferTexture(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glNamedFramebufferTexture(a0,a1,a2,a3);}
+static void replay_glVertexAttrib4NsvARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLshort*>();if(replayer.isCorrupted())return;gl.glVertexAttrib4NsvARB(a0,a1);}
+static void replay_glPassThrough(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glPassThrough(a0);}
+static void replay_glSecondaryColorP3ui(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glSecondaryColorP3ui(a0,a1);}
+static void replay_glInvalidateTexSubImage(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLint>();auto const a5=replayer.value<GLsizei>();auto const a6=replayer.value<GLsizei>();auto const a7=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glInvalidateTexSubImage(a0,a1,a2,a3,a4,a5,a6,a7);}
+static void replay_glIsImageHandleResidentARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint64>();if(replayer.isCorrupted())return;gl.glIsImageHandleResidentARB(a0);}
+static void replay_glTangent3fvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glTangent3fvEXT(a0);}
+static void replay_glProgramUniformMatrix4x3fv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLboolean>();auto const a4=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glProgramUniformMatrix4x3fv(a0,a1,a2,a3,a4);}
+static void replay_glBegin(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glBegin(a0);}
+static void replay_glEvalCoord2dv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glEvalCoord2dv(a0);}
+static void replay_glColor3ubv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLubyte*>();if(replayer.isCorrupted())return;gl.glColor3ubv(a0);}
+static void replay_glFogCoordfvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.null<const GLfloat*>();if(replayer.isCorrupted())return;gl.glFogCoordfvEXT(a0);}
+static void replay_glVertexP3ui(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glVertexP3ui(a0,a1);}
+static void replay_glLightfv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.null<const GLfloat*>();if(replayer.isCorrupted())return;gl.glLightfv(a0,a1,a2);}
+static void replay_glVertexAttribL3i64NV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint64EXT>();auto const a2=replayer.value<GLint64EXT>();auto const a3=replayer.value<GLint64EXT>();if(replayer.isCorrupted())return;gl.glVertexAttribL3i64NV(a0,a1,a2,a3);}
+static void replay_glStencilClearTagEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glStencilClearTagEXT(a0,a1);}
+static void replay_glGetActiveUniformName(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.output<GLsizei*>();auto const a4=replayer.output<GLchar*>();if(replayer.isCorrupted())return;gl.glGetActiveUniformName(a0,a1,a2,a3,a4);}
+static void replay_glTangentPointerEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.value<const void*>();if(replayer.isCorrupted())return;gl.glTangentPointerEXT(a0,a1,a2);}
+static void replay_glUniform4ui64vNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLuint64EXT*>();if(replayer.isCorrupted())return;gl.glUniform4ui64vNV(a0,a1,a2);}
+static void replay_glDebugMessageEnableAMD(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.data<const GLuint*>();auto const a4=replayer.value<GLboolean>();if(replayer.isCorrupted())return;gl.glDebugMessageEnableAMD(a0,a1,a2,a3,a4);}
+static void replay_glProgramUniform2ui(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glProgramUniform2ui(a0,a1,a2,a3);}
+static void replay_glCopyTexSubImage2DEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLint>();auto const a5=replayer.value<GLint>();auto const a6=replayer.value<GLsizei>();auto const a7=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glCopyTexSubImage2DEXT(a0,a1,a2,a3,a4,a5,a6,a7);}
+static void replay_glGenRenderbuffersEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.output<GLuint*>();if(replayer.isCorrupted())return;gl.glGenRenderbuffersEXT(a0,a1);replayer.checkNames(a1);}
+static void replay_glNamedProgramLocalParameterI4ivEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glNamedProgramLocalParameterI4ivEXT(a0,a1,a2,a3);}
+static void replay_glMultiTexCoord2f(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLfloat>();auto const a2=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glMultiTexCoord2f(a0,a1,a2);}
+static void replay_glMapGrid2d(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLdouble>();auto const a2=replayer.value<GLdouble>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLdouble>();auto const a5=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glMapGrid2d(a0,a1,a2,a3,a4,a5);}
+static void replay_glGetMultiTexParameterIuivEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.output<GLuint*>();if(replayer.isCorrupted())return;gl.glGetMultiTexParameterIuivEXT(a0,a1,a2,a3);}
+static void replay_glBlendEquationiARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glBlendEquationiARB(a0,a1);}
+static void replay_glTexParameteriv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glTexParameteriv(a0,a1,a2);}
+static void replay_glUniform4ivARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glUniform4ivARB(a0,a1,a2);}
+static void replay_glMatrixOrthoEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLdouble>();auto const a2=replayer.value<GLdouble>();auto const a3=replayer.value<GLdouble>();auto const a4=replayer.value<GLdouble>();auto const a5=replayer.value<GLdouble>();auto const a6=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glMatrixOrthoEXT(a0,a1,a2,a3,a4,a5,a6);}
+static void replay_glVertexArrayVertexBuffer(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<GLintptr>();auto const a4=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glVertexArrayVertexBuffer(a0,a1,a2,a3,a4);}
+static void replay_glProgramLocalParametersI4ivNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glProgramLocalParametersI4ivNV(a0,a1,a2,a3);}
+static void replay_glProgramUniform4ui64vNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.data<const GLuint64EXT*>();if(replayer.isCorrupted())return;gl.glProgramUniform4ui64vNV(a0,a1,a2,a3);}
+static void replay_glGetNamedStringivARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.data<const GLchar*>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetNamedStringivARB(a0,a1,a2,a3);}
+static void replay_glVertexAttribL1i64vNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLint64EXT*>();if(replayer.isCorrupted())return;gl.glVertexAttribL1i64vNV(a0,a1);}
+static void replay_glTransformFeedbackBufferBase(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glTransformFeedbackBufferBase(a0,a1,a2);}
+static void replay_glIndexsv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.null<const GLshort*>();if(replayer.isCorrupted())return;gl.glIndexsv(a0);}
+static void replay_glPointParameterivNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.null<const GLint*>();if(replayer.isCorrupted())return;gl.glPointParameterivNV(a0,a1);}
+static void replay_glGetDetailTexFuncSGIS(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glGetDetailTexFuncSGIS(a0,a1);}
+static void replay_glReplacementCodeuiColor3fVertex3fvSUN(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLuint*>();auto const a1=replayer.data<const GLfloat*>();auto const a2=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glReplacementCodeuiColor3fVertex3fvSUN(a0,a1,a2);}
+static void replay_glProgramLocalParameter4fARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLfloat>();auto const a3=replayer.value<GLfloat>();auto const a4=replayer.value<GLfloat>();auto const a5=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glProgramLocalParameter4fARB(a0,a1,a2,a3,a4,a5);}
+static void replay_glBitmap(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.value<GLfloat>();auto const a3=replayer.value<GLfloat>();auto const a4=replayer.value<GLfloat>();auto const a5=replayer.value<GLfloat>();auto const a6=replayer.null<const GLubyte*>();if(replayer.isCorrupted())return;gl.glBitmap(a0,a1,a2,a3,a4,a5,a6);}
+static void replay_glNamedFramebufferTextureLayerEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glNamedFramebufferTextureLayerEXT(a0,a1,a2,a3,a4);}
+static void replay_glMultiTexGenfvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.null<const GLfloat*>();if(replayer.isCorrupted())return;gl.glMultiTexGenfvEXT(a0,a1,a2,a3);}
+static void replay_glGetNamedBufferSubData(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLintptr>();auto const a2=replayer.value<GLsizeiptr>();auto const a3=replayer.output<void*>();if(replayer.isCorrupted())return;gl.glGetNamedBufferSubData(a0,a1,a2,a3);}
+static void replay_glStencilFuncSeparateATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glStencilFuncSeparateATI(a0,a1,a2,a3);}
+static void replay_glProgramUniform2iv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glProgramUniform2iv(a0,a1,a2,a3);}
+static void replay_glGetQueryiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetQueryiv(a0,a1,a2);}
+static void replay_glTexCoord4f(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfloat>();auto const a1=replayer.value<GLfloat>();auto const a2=replayer.value<GLfloat>();auto const a3=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glTexCoord4f(a0,a1,a2,a3);}
+static void replay_glMapGrid2f(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLfloat>();auto const a2=replayer.value<GLfloat>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLfloat>();auto const a5=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glMapGrid2f(a0,a1,a2,a3,a4,a5);}
+static void replay_glListParameterivSGIX(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.null<const GLint*>();if(replayer.isCorrupted())return;gl.glListParameterivSGIX(a0,a1,a2);}
+static void replay_glCreateQueries(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.output<GLuint*>();if(replayer.isCorrupted())return;gl.glCreateQueries(a0,a1,a2);replayer.checkNames(a2);}
+static void replay_glGetSamplerParameterfv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glGetSamplerParameterfv(a0,a1,a2);}
+static void replay_glTexCoord4i(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glTexCoord4i(a0,a1,a2,a3);}
+static void replay_glObjectLabel(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.data<const GLchar*>();if(replayer.isCorrupted())return;gl.glObjectLabel(a0,a1,a2,a3);}
+static void replay_glProgramUniform3i64NV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint64EXT>();auto const a3=replayer.value<GLint64EXT>();auto const a4=replayer.value<GLint64EXT>();if(replayer.isCorrupted())return;gl.glProgramUniform3i64NV(a0,a1,a2,a3,a4);}
+static void replay_glGetTextureHandleARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glGetTextureHandleARB(a0);}
+static void replay_glTexCoord4s(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLshort>();auto const a1=replayer.value<GLshort>();auto const a2=replayer.value<GLshort>();auto const a3=replayer.value<GLshort>();if(replayer.isCorrupted())return;gl.glTexCoord4s(a0,a1,a2,a3);}
+static void replay_glUniform4iARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glUniform4iARB(a0,a1,a2,a3,a4);}
+static void replay_glGetUniformIndices(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLsizei>();auto const a2=(const GLchar*const*)replayer.strings();auto const a3=replayer.output<GLuint*>();if(replayer.isCorrupted())return;gl.glGetUniformIndices(a0,a1,a2,a3);}
+static void replay_glMultiTexImage3DEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLsizei>();auto const a5=replayer.value<GLsizei>();auto const a6=replayer.value<GLsizei>();auto const a7=replayer.value<GLint>();auto const a8=replayer.value<GLenum>();auto const a9=replayer.value<GLenum>();auto const a10=replayer.value<const void*>();if(replayer.isCorrupted())return;gl.glMultiTexImage3DEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10);}
+static void replay_glCoverageModulationTableNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glCoverageModulationTableNV(a0,a1);}
+static void replay_glPointParameteriv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.null<const GLint*>();if(replayer.isCorrupted())return;gl.glPointParameteriv(a0,a1);}
+static void replay_glMultiTexCoord4svARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLshort*>();if(replayer.isCorrupted())return;gl.glMultiTexCoord4svARB(a0,a1);}
+static void replay_glNormal3fv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glNormal3fv(a0);}
+static void replay_glProgramUniformMatrix3x4dvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLboolean>();auto const a4=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glProgramUniformMatrix3x4dvEXT(a0,a1,a2,a3,a4);}
+static void replay_glTexCoord1fv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glTexCoord1fv(a0);}
+static void replay_glProgramUniformMatrix4x3dvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLboolean>();auto const a4=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glProgramUniformMatrix4x3dvEXT(a0,a1,a2,a3,a4);}
+static void replay_glGetActiveVaryingNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.output<GLsizei*>();auto const a4=replayer.output<GLsizei*>();auto const a5=replayer.output<GLenum*>();auto const a6=replayer.output<GLchar*>();if(replayer.isCorrupted())return;gl.glGetActiveVaryingNV(a0,a1,a2,a3,a4,a5,a6);}
+static void replay_glUniform1i64vARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLint64*>();if(replayer.isCorrupted())return;gl.glUniform1i64vARB(a0,a1,a2);}
+static void replay_glMultiTexCoord1dv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glMultiTexCoord1dv(a0,a1);}
+static void replay_glTexCoord3fv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glTexCoord3fv(a0);}
+static void replay_glMatrixTranslatefEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLfloat>();auto const a2=replayer.value<GLfloat>();auto const a3=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glMatrixTranslatefEXT(a0,a1,a2,a3);}
+static void replay_glProgramUniform1ui64vNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.data<const GLuint64EXT*>();if(replayer.isCorrupted())return;gl.glProgramUniform1ui64vNV(a0,a1,a2,a3);}
+static void replay_glTextureMaterialEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glTextureMaterialEXT(a0,a1);}
+static void replay_glMultiTexCoordP3uiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glMultiTexCoordP3uiv(a0,a1,a2);}
+static void replay_glVertexAttribP3ui(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLboolean>();auto const a3=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glVertexAttribP3ui(a0,a1,a2,a3);}
+static void replay_glInterpolatePathsNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glInterpolatePathsNV(a0,a1,a2,a3);}
+static void replay_glTextureBufferRange(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<GLintptr>();auto const a4=replayer.value<GLsizeiptr>();if(replayer.isCorrupted())return;gl.glTextureBufferRange(a0,a1,a2,a3,a4);}
+static void replay_glVertexAttribL2dEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLdouble>();auto const a2=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glVertexAttribL2dEXT(a0,a1,a2);}
+static void replay_glGetPixelTransformParameterivEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetPixelTransformParameterivEXT(a0,a1,a2);}
+static void replay_glTexCoord4xvOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLfixed*>();if(replayer.isCorrupted())return;gl.glTexCoord4xvOES(a0);}
+static void replay_glGetVariantBooleanvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLboolean*>();if(replayer.isCorrupted())return;gl.glGetVariantBooleanvEXT(a0,a1,a2);}
+static void replay_glDepthRange(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLclampd>();auto const a1=replayer.value<GLclampd>();if(replayer.isCorrupted())return;gl.glDepthRange(a0,a1);}
+static void replay_glGetVertexAttribdvARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLdouble*>();if(replayer.isCorrupted())return;gl.glGetVertexAttribdvARB(a0,a1,a2);}
+static void replay_glGetColorTableParameterfv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glGetColorTableParameterfv(a0,a1,a2);}
+static void replay_glDrawArraysInstancedEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glDrawArraysInstancedEXT(a0,a1,a2,a3);}
+static void replay_glDisableClientStateIndexedEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glDisableClientStateIndexedEXT(a0,a1);}
+static void replay_glDrawBuffer(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glDrawBuffer(a0);}
+static void replay_glMultiDrawArraysIndirectBindlessNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<const void*>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glMultiDrawArraysIndirectBindlessNV(a0,a1,a2,a3,a4);}
+static void replay_glGetnPixelMapusv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.output<GLushort*>();if(replayer.isCorrupted())return;gl.glGetnPixelMapusv(a0,a1,a2);}
+static void replay_glRasterPos3fv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glRasterPos3fv(a0);}
+static void replay_glClearBufferuiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();auto const a2=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glClearBufferuiv(a0,a1,a2);}
+static void replay_glGetInternalformati64v(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.output<GLint64*>();if(replayer.isCorrupted())return;gl.glGetInternalformati64v(a0,a1,a2,a3,a4);}
+static void replay_glShaderSourceARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLhandleARB>();auto const a1=replayer.value<GLsizei>();auto const a2=(const GLcharARB**)replayer.strings();auto const a3=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glShaderSourceARB(a0,a1,a2,a3);}
+static void replay_glShaderOp3EXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<GLuint>();auto const a4=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glShaderOp3EXT(a0,a1,a2,a3,a4);}
+static void replay_glWindowPos2dvMESA(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glWindowPos2dvMESA(a0);}
+static void replay_glClearIndex(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glClearIndex(a0);}
+static void replay_glProvokingVertexEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glProvokingVertexEXT(a0);}
+static void replay_glVariantubvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.null<const GLubyte*>();if(replayer.isCorrupted())return;gl.glVariantubvEXT(a0,a1);}
+static void replay_glFlush(FunctionTable const&gl,CallReplayer&replayer){if(replayer.isCorrupted())return;gl.glFlush();}
+static void replay_glGetColorTableParameterivEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetColorTableParameterivEXT(a0,a1,a2);}
+static void replay_glPresentFrameDualFillNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint64EXT>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<GLuint>();auto const a4=replayer.value<GLenum>();auto const a5=replayer.value<GLenum>();auto const a6=replayer.value<GLuint>();auto const a7=replayer.value<GLenum>();auto const a8=replayer.value<GLuint>();auto const a9=replayer.value<GLenum>();auto const a10=replayer.value<GLuint>();auto const a11=replayer.value<GLenum>();auto const a12=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glPresentFrameDualFillNV(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12);}
+static void replay_glGenVertexShadersEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glGenVertexShadersEXT(a0);}
+static void replay_glProgramUniformHandleui64vARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.data<const GLuint64*>();if(replayer.isCorrupted())return;gl.glProgramUniformHandleui64vARB(a0,a1,a2,a3);}
+static void replay_glDepthRangefOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLclampf>();auto const a1=replayer.value<GLclampf>();if(replayer.isCorrupted())return;gl.glDepthRangefOES(a0,a1);}
+static void replay_glDrawElementsInstancedBaseVertexBaseInstance(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<const void*>();auto const a4=replayer.value<GLsizei>();auto const a5=replayer.value<GLint>();auto const a6=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glDrawElementsInstancedBaseVertexBaseInstance(a0,a1,a2,a3,a4,a5,a6);}
+static void replay_glGetTexLevelParameteriv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetTexLevelParameteriv(a0,a1,a2,a3);}
+static void replay_glStencilFillPathNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glStencilFillPathNV(a0,a1,a2);}
+static void replay_glWindowPos3iARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glWindowPos3iARB(a0,a1,a2);}
+static void replay_glPrioritizeTextures(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.data<const GLuint*>();auto const a2=replayer.data<const GLclampf*>();if(replayer.isCorrupted())return;gl.glPrioritizeTextures(a0,a1,a2);}
+static void replay_glWindowPos3fvMESA(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glWindowPos3fvMESA(a0);}
+static void replay_glProgramUniformMatrix3x2dvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLboolean>();auto const a4=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glProgramUniformMatrix3x2dvEXT(a0,a1,a2,a3,a4);}
+static void replay_glVertex4xvOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLfixed*>();if(replayer.isCorrupted())return;gl.glVertex4xvOES(a0);}
+static void replay_glTexStorage3DMultisample(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.value<GLsizei>();auto const a5=replayer.value<GLsizei>();auto const a6=replayer.value<GLboolean>();if(replayer.isCorrupted())return;gl.glTexStorage3DMultisample(a0,a1,a2,a3,a4,a5,a6);}
+static void replay_glWindowPos2sARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLshort>();auto const a1=replayer.value<GLshort>();if(replayer.isCorrupted())return;gl.glWindowPos2sARB(a0,a1);}
+static void replay_glStencilOpValueAMD(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glStencilOpValueAMD(a0,a1);}
+static void replay_glProgramVertexLimitNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glProgramVertexLimitNV(a0,a1);}
+static void replay_glGetTexParameterPointervAPPLE(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<void**>();if(replayer.isCorrupted())return;gl.glGetTexParameterPointervAPPLE(a0,a1,a2);}
+static void replay_glProgramUniform3uivEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glProgramUniform3uivEXT(a0,a1,a2,a3);}
+static void replay_glClampColor(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glClampColor(a0,a1);}
+static void replay_glClearStencil(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glClearStencil(a0);}
+static void replay_glTexCoordP1uiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glTexCoordP1uiv(a0,a1);}
+static void replay_glVertexAttribs3svNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLshort*>();if(replayer.isCorrupted())return;gl.glVertexAttribs3svNV(a0,a1,a2);}
+static void replay_glMultiTexCoord3fv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glMultiTexCoord3fv(a0,a1);}
+static void replay_glVertexBlendEnvfATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glVertexBlendEnvfATI(a0,a1);}
+static void replay_glIsFenceAPPLE(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glIsFenceAPPLE(a0);}
+static void replay_glGetBufferParameterui64vNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLuint64EXT*>();if(replayer.isCorrupted())return;gl.glGetBufferParameterui64vNV(a0,a1,a2);}
+static void replay_glVertexAttribI4bvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLbyte*>();if(replayer.isCorrupted())return;gl.glVertexAttribI4bvEXT(a0,a1);}
+static void replay_glUniform2fARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLfloat>();auto const a2=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glUniform2fARB(a0,a1,a2);}
+static void replay_glStopInstrumentsSGIX(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glStopInstrumentsSGIX(a0);}
+static void replay_glVertexAttrib3fNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLfloat>();auto const a2=replayer.value<GLfloat>();auto const a3=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glVertexAttrib3fNV(a0,a1,a2,a3);}
+static void replay_glMapVertexAttrib2dAPPLE(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLdouble>();auto const a3=replayer.value<GLdouble>();auto const a4=replayer.value<GLint>();auto const a5=replayer.value<GLint>();auto const a6=replayer.value<GLdouble>();auto const a7=replayer.value<GLdouble>();auto const a8=replayer.value<GLint>();auto const a9=replayer.value<GLint>();auto const a10=replayer.null<const GLdouble*>();if(replayer.isCorrupted())return;gl.glMapVertexAttrib2dAPPLE(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10);}
+static void replay_glVertex2f(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfloat>();auto const a1=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glVertex2f(a0,a1);}
+static void replay_glCopyTextureImage2DEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLenum>();auto const a4=replayer.value<GLint>();auto const a5=replayer.value<GLint>();auto const a6=replayer.value<GLsizei>();auto const a7=replayer.value<GLsizei>();auto const a8=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glCopyTextureImage2DEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+static void replay_glVertex2d(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLdouble>();auto const a1=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glVertex2d(a0,a1);}
+static void replay_glSecondaryColor3bvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLbyte*>();if(replayer.isCorrupted())return;gl.glSecondaryColor3bvEXT(a0);}
+static void replay_glMultiTexCoord4fARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLfloat>();auto const a2=replayer.value<GLfloat>();auto const a3=replayer.value<GLfloat>();auto const a4=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glMultiTexCoord4fARB(a0,a1,a2,a3,a4);}
+static void replay_glPolygonOffset(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfloat>();auto const a1=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glPolygonOffset(a0,a1);}
+static void replay_glTangent3bvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLbyte*>();if(replayer.isCorrupted())return;gl.glTangent3bvEXT(a0);}
+static void replay_glHistogram(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLboolean>();if(replayer.isCorrupted())return;gl.glHistogram(a0,a1,a2,a3);}
+static void replay_glGetProgramiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetProgramiv(a0,a1,a2);}
+static void replay_glMatrixIndexubvARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.data<const GLubyte*>();if(replayer.isCorrupted())return;gl.glMatrixIndexubvARB(a0,a1);}
+static void replay_glVertex2s(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLshort>();auto const a1=replayer.value<GLshort>();if(replayer.isCorrupted())return;gl.glVertex2s(a0,a1);}
+static void replay_glGetVertexAttribLui64vNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLuint64EXT*>();if(replayer.isCorrupted())return;gl.glGetVertexAttribLui64vNV(a0,a1,a2);}
+static void replay_glGetProgramStringARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<void*>();if(replayer.isCorrupted())return;gl.glGetProgramStringARB(a0,a1,a2);}
+static void replay_glFlushMappedBufferRange(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLintptr>();auto const a2=replayer.value<GLsizeiptr>();if(replayer.isCorrupted())return;gl.glFlushMappedBufferRange(a0,a1,a2);}
+static void replay_glVertexAttribI3uiEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glVertexAttribI3uiEXT(a0,a1,a2,a3);}
+static void replay_glLineWidthxOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfixed>();if(replayer.isCorrupted())return;gl.glLineWidthxOES(a0);}
+static void replay_glProgramUniformMatrix2fvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLboolean>();auto const a4=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glProgramUniformMatrix2fvEXT(a0,a1,a2,a3,a4);}
+static void replay_glGetTextureParameterIuivEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.output<GLuint*>();if(replayer.isCorrupted())return;gl.glGetTextureParameterIuivEXT(a0,a1,a2,a3);}
+static void replay_glGetMultiTexEnvivEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetMultiTexEnvivEXT(a0,a1,a2,a3);}
+static void replay_glPixelTexGenParameterivSGIS(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.null<const GLint*>();if(replayer.isCorrupted())return;gl.glPixelTexGenParameterivSGIS(a0,a1);}
+static void replay_glGenQueries(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.output<GLuint*>();if(replayer.isCorrupted())return;gl.glGenQueries(a0,a1);replayer.checkNames(a1);}
+static void replay_glGetPixelMapfv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glGetPixelMapfv(a0,a1);}
+static void replay_glBlendColorEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfloat>();auto const a1=replayer.value<GLfloat>();auto const a2=replayer.value<GLfloat>();auto const a3=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glBlendColorEXT(a0,a1,a2,a3);}
+static void replay_glResetMinmax(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glResetMinmax(a0);}
+static void replay_glGetnUniformivARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetnUniformivARB(a0,a1,a2,a3);}
+static void replay_glVertexBlendARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glVertexBlendARB(a0);}
+static void replay_glVertexAttrib4d(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLdouble>();auto const a2=replayer.value<GLdouble>();auto const a3=replayer.value<GLdouble>();auto const a4=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glVertexAttrib4d(a0,a1,a2,a3,a4);}
+static void replay_glGetVaryingLocationNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLchar*>();if(replayer.isCorrupted())return;gl.glGetVaryingLocationNV(a0,a1);}
+static void replay_glGetMapAttribParameterivNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetMapAttribParameterivNV(a0,a1,a2,a3);}
+static void replay_glTexSubImage3D(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLint>();auto const a5=replayer.value<GLsizei>();auto const a6=replayer.value<GLsizei>();auto const a7=replayer.value<GLsizei>();auto const a8=replayer.value<GLenum>();auto const a9=replayer.value<GLenum>();auto const a10=replayer.pixels<const GLvoid*>();if(replayer.isCorrupted())return;gl.glTexSubImage3D(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10);}
+static void replay_glDeleteSamplers(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glDeleteSamplers(a0,a1);}
+static void replay_glGetLightxOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLfixed*>();if(replayer.isCorrupted())return;gl.glGetLightxOES(a0,a1,a2);}
+static void replay_glGetVertexAttribArrayObjectfvATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glGetVertexAttribArrayObjectfvATI(a0,a1,a2);}
+static void replay_glVertexArrayNormalOffsetEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.value<GLintptr>();if(replayer.isCorrupted())return;gl.glVertexArrayNormalOffsetEXT(a0,a1,a2,a3,a4);}
+static void replay_glGetBufferParameterivARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetBufferParameterivARB(a0,a1,a2);}
+static void replay_glGetTextureParameterfv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glGetTextureParameterfv(a0,a1,a2);}
+static void replay_glDrawMeshArraysSUN(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glDrawMeshArraysSUN(a0,a1,a2,a3);}
+static void replay_glVertexAttrib4dNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLdouble>();auto const a2=replayer.value<GLdouble>();auto const a3=replayer.value<GLdouble>();auto const a4=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glVertexAttrib4dNV(a0,a1,a2,a3,a4);}
+static void replay_glGetMultisamplefvNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glGetMultisamplefvNV(a0,a1,a2);}
+static void replay_glMapObjectBufferATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glMapObjectBufferATI(a0);}
+static void replay_glGetPathCommandsNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.output<GLubyte*>();if(replayer.isCorrupted())return;gl.glGetPathCommandsNV(a0,a1);}
+static void replay_glVertexArrayTexCoordOffsetEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLenum>();auto const a4=replayer.value<GLsizei>();auto const a5=replayer.value<GLintptr>();if(replayer.isCorrupted())return;gl.glVertexArrayTexCoordOffsetEXT(a0,a1,a2,a3,a4,a5);}
+static void replay_glGetHistogram(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLboolean>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLenum>();auto const a4=replayer.output<GLvoid*>();if(replayer.isCorrupted())return;gl.glGetHistogram(a0,a1,a2,a3,a4);}
+static void replay_glMatrixMode(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glMatrixMode(a0);}
+static void replay_glColorFormatNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glColorFormatNV(a0,a1,a2);}
+static void replay_glProgramUniformui64NV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLuint64EXT>();if(replayer.isCorrupted())return;gl.glProgramUniformui64NV(a0,a1,a2);}
+static void replay_glProgramUniformMatrix4x2fvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLboolean>();auto const a4=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glProgramUniformMatrix4x2fvEXT(a0,a1,a2,a3,a4);}
+static void replay_glLoadMatrixxOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLfixed*>();if(replayer.isCorrupted())return;gl.glLoadMatrixxOES(a0);}
+static void replay_glGetColorTableParameterfvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glGetColorTableParameterfvEXT(a0,a1,a2);}
+static void replay_glRasterPos4i(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glRasterPos4i(a0,a1,a2,a3);}
+static void replay_glVertexAttribL2i64NV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint64EXT>();auto const a2=replayer.value<GLint64EXT>();if(replayer.isCorrupted())return;gl.glVertexAttribL2i64NV(a0,a1,a2);}
+static void replay_glBindTextures(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glBindTextures(a0,a1,a2);}
+static void replay_glMatrixRotatefEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLfloat>();auto const a2=replayer.value<GLfloat>();auto const a3=replayer.value<GLfloat>();auto const a4=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glMatrixRotatefEXT(a0,a1,a2,a3,a4);}
+static void replay_glGetClipPlanexOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.output<GLfixed*>();if(replayer.isCorrupted())return;gl.glGetClipPlanexOES(a0,a1);}
+static void replay_glSecondaryColor3uivEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glSecondaryColor3uivEXT(a0);}
+static void replay_glGetPerfQueryInfoINTEL(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.output<GLchar*>();auto const a3=replayer.output<GLuint*>();auto const a4=replayer.output<GLuint*>();auto const a5=replayer.output<GLuint*>();auto const a6=replayer.output<GLuint*>();if(replayer.isCorrupted())return;gl.glGetPerfQueryInfoINTEL(a0,a1,a2,a3,a4,a5,a6);}
+static void replay_glGetDoublev(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.output<GLdouble*>();if(replayer.isCorrupted())return;gl.glGetDoublev(a0,a1);}
+static void replay_glBindBufferRangeEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<GLintptr>();auto const a4=replayer.value<GLsizeiptr>();if(replayer.isCorrupted())return;gl.glBindBufferRangeEXT(a0,a1,a2,a3,a4);}
+static void replay_glCompressedTexImage2D(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.value<GLsizei>();auto const a5=replayer.value<GLint>();auto const a6=replayer.value<GLsizei>();auto const a7=replayer.pixels<const GLvoid*>();if(replayer.isCorrupted())return;gl.glCompressedTexImage2D(a0,a1,a2,a3,a4,a5,a6,a7);}
+static void replay_glMapBufferARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();if(replayer.isCorrupted())return;auto const result=gl.glMapBufferARB(a0,a1);replayer.mapResult(result);}
+static void replay_glGetPathSpacingNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<const void*>();auto const a4=replayer.value<GLuint>();auto const a5=replayer.value<GLfloat>();auto const a6=replayer.value<GLfloat>();auto const a7=replayer.value<GLenum>();auto const a8=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glGetPathSpacingNV(a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+static void replay_glUniform4dv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glUniform4dv(a0,a1,a2);}
+static void replay_glGlobalAlphaFactordSUN(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glGlobalAlphaFactordSUN(a0);}
+static void replay_glProgramUniform3dv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glProgramUniform3dv(a0,a1,a2,a3);}
+static void replay_glGetShaderSourceARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLhandleARB>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.output<GLsizei*>();auto const a3=replayer.output<GLcharARB*>();if(replayer.isCorrupted())return;gl.glGetShaderSourceARB(a0,a1,a2,a3);}
+static void replay_glVertexAttrib3dvARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glVertexAttrib3dvARB(a0,a1);}
+static void replay_glInvalidateBufferData(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glInvalidateBufferData(a0);}
+static void replay_glMatrixLoad3x2fNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glMatrixLoad3x2fNV(a0,a1);}
+static void replay_glCompressedTextureSubImage1D(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.value<GLenum>();auto const a5=replayer.value<GLsizei>();auto const a6=replayer.pixels<const void*>();if(replayer.isCorrupted())return;gl.glCompressedTextureSubImage1D(a0,a1,a2,a3,a4,a5,a6);}
+static void replay_glTexCoord3xvOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLfixed*>();if(replayer.isCorrupted())return;gl.glTexCoord3xvOES(a0);}
+static void replay_glGenTexturesEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.output<GLuint*>();if(replayer.isCorrupted())return;gl.glGenTexturesEXT(a0,a1);replayer.checkNames(a1);}
+static void replay_glTangent3iEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glTangent3iEXT(a0,a1,a2);}
+static void replay_glClearTexImage(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLenum>();auto const a4=replayer.data<const void*>();if(replayer.isCorrupted())return;gl.glClearTexImage(a0,a1,a2,a3,a4);}
+static void replay_glBinormal3bvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLbyte*>();if(replayer.isCorrupted())return;gl.glBinormal3bvEXT(a0);}
+static void replay_glUniform3fv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glUniform3fv(a0,a1,a2);}
+static void replay_glGetnPixelMapusvARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.output<GLushort*>();if(replayer.isCorrupted())return;gl.glGetnPixelMapusvARB(a0,a1,a2);}
+static void replay_glMultiTexCoordP1ui(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glMultiTexCoordP1ui(a0,a1,a2);}
+static void replay_glClearNamedBufferDataEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLenum>();auto const a4=replayer.data<const void*>();if(replayer.isCorrupted())return;gl.glClearNamedBufferDataEXT(a0,a1,a2,a3,a4);}
+static void replay_glUniformMatrix4dv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.value<GLboolean>();auto const a3=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glUniformMatrix4dv(a0,a1,a2,a3);}
+static void replay_glWindowPos3fMESA(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfloat>();auto const a1=replayer.value<GLfloat>();auto const a2=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glWindowPos3fMESA(a0,a1,a2);}
+static void replay_glDeleteRenderbuffers(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glDeleteRenderbuffers(a0,a1);}
+static void replay_glGetTextureLevelParameterfvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLenum>();auto const a4=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glGetTextureLevelParameterfvEXT(a0,a1,a2,a3,a4);}
+static void replay_glGetHistogramParameterxvOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLfixed*>();if(replayer.isCorrupted())return;gl.glGetHistogramParameterxvOES(a0,a1,a2);}
+static void replay_glMultiDrawElements(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLsizei*>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.data<const void*const*>();auto const a4=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glMultiDrawElements(a0,a1,a2,a3,a4);}
+static void replay_glMakeImageHandleNonResidentNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint64>();if(replayer.isCorrupted())return;gl.glMakeImageHandleNonResidentNV(a0);}
+static void replay_glTexSubImage1DEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.value<GLenum>();auto const a5=replayer.value<GLenum>();auto const a6=replayer.value<const void*>();if(replayer.isCorrupted())return;gl.glTexSubImage1DEXT(a0,a1,a2,a3,a4,a5,a6);}
+static void replay_glNormalStream3dATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLdouble>();auto const a2=replayer.value<GLdouble>();auto const a3=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glNormalStream3dATI(a0,a1,a2,a3);}
+static void replay_glVertexAttribL4i64vNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLint64EXT*>();if(replayer.isCorrupted())return;gl.glVertexAttribL4i64vNV(a0,a1);}
+static void replay_glDrawBuffers(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.data<const GLenum*>();if(replayer.isCorrupted())return;gl.glDrawBuffers(a0,a1);}
+static void replay_glCopyTextureSubImage1DEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLint>();auto const a5=replayer.value<GLint>();auto const a6=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glCopyTextureSubImage1DEXT(a0,a1,a2,a3,a4,a5,a6);}
+static void replay_glWindowRectanglesEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glWindowRectanglesEXT(a0,a1,a2);}
+static void replay_glNamedFramebufferReadBuffer(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glNamedFramebufferReadBuffer(a0,a1);}
+static void replay_glUniform2i64vARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLint64*>();if(replayer.isCorrupted())return;gl.glUniform2i64vARB(a0,a1,a2);}
+static void replay_glVertexAttribI1uivEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glVertexAttribI1uivEXT(a0,a1);}
+static void replay_glGetTexGenfv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glGetTexGenfv(a0,a1,a2);}
+static void replay_glBeginQueryARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glBeginQueryARB(a0,a1);}
+static void replay_glUniform1iARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glUniform1iARB(a0,a1);}
+static void replay_glVertex4bvOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLbyte*>();if(replayer.isCorrupted())return;gl.glVertex4bvOES(a0);}
+static void replay_glInvalidateSubFramebuffer(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLenum*>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLint>();auto const a5=replayer.value<GLsizei>();auto const a6=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glInvalidateSubFramebuffer(a0,a1,a2,a3,a4,a5,a6);}
+static void replay_glUniform1fvARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glUniform1fvARB(a0,a1,a2);}
+static void replay_glTestFenceNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glTestFenceNV(a0);}
+static void replay_glBindTransformFeedback(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glBindTransformFeedback(a0,a1);}
+static void replay_glMultiTexCoord2iv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glMultiTexCoord2iv(a0,a1);}
+static void replay_glCopyMultiTexSubImage1DEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLint>();auto const a5=replayer.value<GLint>();auto const a6=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glCopyMultiTexSubImage1DEXT(a0,a1,a2,a3,a4,a5,a6);}
+static void replay_glVariantbvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.null<const GLbyte*>();if(replayer.isCorrupted())return;gl.glVariantbvEXT(a0,a1);}
+static void replay_glTexCoord1hNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLhalfNV>();if(replayer.isCorrupted())return;gl.glTexCoord1hNV(a0);}
+static void replay_glGenFencesNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.output<GLuint*>();if(replayer.isCorrupted())return;gl.glGenFencesNV(a0,a1);replayer.checkNames(a1);}
+static void replay_glRasterPos3iv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glRasterPos3iv(a0);}
+static void replay_glVertexAttribL2ui64NV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint64EXT>();auto const a2=replayer.value<GLuint64EXT>();if(replayer.isCorrupted())return;gl.glVertexAttribL2ui64NV(a0,a1,a2);}
+static void replay_glMultiTexCoord1hvNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLhalfNV*>();if(replayer.isCorrupted())return;gl.glMultiTexCoord1hvNV(a0,a1);}
+static void replay_glGetnConvolutionFilter(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.output<void*>();if(replayer.isCorrupted())return;gl.glGetnConvolutionFilter(a0,a1,a2,a3,a4);}
+static void replay_glNormal3bv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLbyte*>();if(replayer.isCorrupted())return;gl.glNormal3bv(a0);}
+static void replay_glWeightbvARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.data<const GLbyte*>();if(replayer.isCorrupted())return;gl.glWeightbvARB(a0,a1);}
+static void replay_glTexCoord4sv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLshort*>();if(replayer.isCorrupted())return;gl.glTexCoord4sv(a0);}
+static void replay_glUniform2uiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glUniform2uiv(a0,a1,a2);}
+static void replay_glBeginConditionalRenderNVX(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glBeginConditionalRenderNVX(a0);}
+static void replay_glFinish(FunctionTable const&gl,CallReplayer&replayer){if(replayer.isCorrupted())return;gl.glFinish();}
+static void replay_glColorTableParameterfv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.null<const GLfloat*>();if(replayer.isCorrupted())return;gl.glColorTableParameterfv(a0,a1,a2);}
+static void replay_glFragmentCoverageColorNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glFragmentCoverageColorNV(a0);}
+static void replay_glProgramUniform3ivEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glProgramUniform3ivEXT(a0,a1,a2,a3);}
+static void replay_glVertexArrayVertexOffsetEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLenum>();auto const a4=replayer.value<GLsizei>();auto const a5=replayer.value<GLintptr>();if(replayer.isCorrupted())return;gl.glVertexArrayVertexOffsetEXT(a0,a1,a2,a3,a4,a5);}
+static void replay_glViewportPositionWScaleNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLfloat>();auto const a2=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glViewportPositionWScaleNV(a0,a1,a2);}
+static void replay_glGetProgramLocalParameterIuivNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.output<GLuint*>();if(replayer.isCorrupted())return;gl.glGetProgramLocalParameterIuivNV(a0,a1,a2);}
+static void replay_glReplacementCodeuiTexCoord2fVertex3fvSUN(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLuint*>();auto const a1=replayer.data<const GLfloat*>();auto const a2=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glReplacementCodeuiTexCoord2fVertex3fvSUN(a0,a1,a2);}
+static void replay_glUniform1uiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glUniform1uiv(a0,a1,a2);}
+static void replay_glUniformMatrix2dv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.value<GLboolean>();auto const a3=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glUniformMatrix2dv(a0,a1,a2,a3);}
+static void replay_glIndexdv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.null<const GLdouble*>();if(replayer.isCorrupted())return;gl.glIndexdv(a0);}
+static void replay_glSecondaryColor3ivEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glSecondaryColor3ivEXT(a0);}
+static void replay_glTexCoord3iv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glTexCoord3iv(a0);}
+static void replay_glVertexStream4fvATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glVertexStream4fvATI(a0,a1);}
+static void replay_glDeformationMap3fSGIX(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLfloat>();auto const a2=replayer.value<GLfloat>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLint>();auto const a5=replayer.value<GLfloat>();auto const a6=replayer.value<GLfloat>();auto const a7=replayer.value<GLint>();auto const a8=replayer.value<GLint>();auto const a9=replayer.value<GLfloat>();auto const a10=replayer.value<GLfloat>();auto const a11=replayer.value<GLint>();auto const a12=replayer.value<GLint>();auto const a13=replayer.null<const GLfloat*>();if(replayer.isCorrupted())return;gl.glDeformationMap3fSGIX(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13);}
+static void replay_glClearDepth(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLclampd>();if(replayer.isCorrupted())return;gl.glClearDepth(a0);}
+static void replay_glGenAsyncMarkersSGIX(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glGenAsyncMarkersSGIX(a0);}
+static void replay_glDisableIndexedEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glDisableIndexedEXT(a0,a1);}
+static void replay_glVertexWeightfvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.null<const GLfloat*>();if(replayer.isCorrupted())return;gl.glVertexWeightfvEXT(a0);}
+static void replay_glGetProgramLocalParameterIivNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetProgramLocalParameterIivNV(a0,a1,a2);}
+static void replay_glCompressedTexImage3DARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.value<GLsizei>();auto const a5=replayer.value<GLsizei>();auto const a6=replayer.value<GLint>();auto const a7=replayer.value<GLsizei>();auto const a8=replayer.value<const void*>();if(replayer.isCorrupted())return;gl.glCompressedTexImage3DARB(a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+static void replay_glProgramParameter4fNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLfloat>();auto const a3=replayer.value<GLfloat>();auto const a4=replayer.value<GLfloat>();auto const a5=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glProgramParameter4fNV(a0,a1,a2,a3,a4,a5);}
+static void replay_glConvolutionParameterxOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLfixed>();if(replayer.isCorrupted())return;gl.glConvolutionParameterxOES(a0,a1,a2);}
+static void replay_glInsertComponentEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glInsertComponentEXT(a0,a1,a2);}
+static void replay_glCreateTextures(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.output<GLuint*>();if(replayer.isCorrupted())return;gl.glCreateTextures(a0,a1,a2);replayer.checkNames(a2);}
+static void replay_glSecondaryColor3iv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glSecondaryColor3iv(a0);}
+static void replay_glCreateBuffers(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.output<GLuint*>();if(replayer.isCorrupted())return;gl.glCreateBuffers(a0,a1);replayer.checkNames(a1);}
+static void replay_glMultiTexCoord2xvOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLfixed*>();if(replayer.isCorrupted())return;gl.glMultiTexCoord2xvOES(a0,a1);}
+static void replay_glTexGenxvOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.null<const GLfixed*>();if(replayer.isCorrupted())return;gl.glTexGenxvOES(a0,a1,a2);}
+static void replay_glMultTransposeMatrixf(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glMultTransposeMatrixf(a0);}
+static void replay_glBeginTransformFeedbackEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glBeginTransformFeedbackEXT(a0);}
+static void replay_glTexCoord2fColor3fVertex3fSUN(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfloat>();auto const a1=replayer.value<GLfloat>();auto const a2=replayer.value<GLfloat>();auto const a3=replayer.value<GLfloat>();auto const a4=replayer.value<GLfloat>();auto const a5=replayer.value<GLfloat>();auto const a6=replayer.value<GLfloat>();auto const a7=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glTexCoord2fColor3fVertex3fSUN(a0,a1,a2,a3,a4,a5,a6,a7);}
+static void replay_glNormal3sv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLshort*>();if(replayer.isCorrupted())return;gl.glNormal3sv(a0);}
+static void replay_glFreeObjectBufferATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glFreeObjectBufferATI(a0);}
+static void replay_glBlendBarrierNV(FunctionTable const&gl,CallReplayer&replayer){if(replayer.isCorrupted())return;gl.glBlendBarrierNV();}
+static void replay_glUniform4i64vNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLint64EXT*>();if(replayer.isCorrupted())return;gl.glUniform4i64vNV(a0,a1,a2);}
+static void replay_glGetnUniformuivARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.output<GLuint*>();if(replayer.isCorrupted())return;gl.glGetnUniformuivARB(a0,a1,a2,a3);}
+static void replay_glAlphaFragmentOp3ATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<GLuint>();auto const a4=replayer.value<GLuint>();auto const a5=replayer.value<GLuint>();auto const a6=replayer.value<GLuint>();auto const a7=replayer.value<GLuint>();auto const a8=replayer.value<GLuint>();auto const a9=replayer.value<GLuint>();auto const a10=replayer.value<GLuint>();auto const a11=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glAlphaFragmentOp3ATI(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11);}
+static void replay_glProgramEnvParameters4fvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glProgramEnvParameters4fvEXT(a0,a1,a2,a3);}
+static void replay_glBlendFuncSeparateEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glBlendFuncSeparateEXT(a0,a1,a2,a3);}
+static void replay_glConvolutionParameterivEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.null<const GLint*>();if(replayer.isCorrupted())return;gl.glConvolutionParameterivEXT(a0,a1,a2);}
+static void replay_glPixelTexGenSGIX(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glPixelTexGenSGIX(a0);}
+static void replay_glDeleteProgram(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glDeleteProgram(a0);}
+static void replay_glUniformMatrix4x3dv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.value<GLboolean>();auto const a3=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glUniformMatrix4x3dv(a0,a1,a2,a3);}
+static void replay_glGetVideoCaptureStreamivNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetVideoCaptureStreamivNV(a0,a1,a2,a3);}
+static void replay_glProgramUniform4uiEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<GLuint>();auto const a4=replayer.value<GLuint>();auto const a5=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glProgramUniform4uiEXT(a0,a1,a2,a3,a4,a5);}
+static void replay_glMakeImageHandleNonResidentARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint64>();if(replayer.isCorrupted())return;gl.glMakeImageHandleNonResidentARB(a0);}
+static void replay_glSecondaryColor3dEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLdouble>();auto const a1=replayer.value<GLdouble>();auto const a2=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glSecondaryColor3dEXT(a0,a1,a2);}
+static void replay_glDeleteQueries(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glDeleteQueries(a0,a1);}
+static void replay_glNormalP3uiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glNormalP3uiv(a0,a1);}
+static void replay_glRasterPos2d(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLdouble>();auto const a1=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glRasterPos2d(a0,a1);}
+static void replay_glInitNames(FunctionTable const&gl,CallReplayer&replayer){if(replayer.isCorrupted())return;gl.glInitNames();}
+static void replay_glBinormal3fvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glBinormal3fvEXT(a0);}
+static void replay_glColor3dv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glColor3dv(a0);}
+static void replay_glVertexArrayVertexAttribDivisorEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glVertexArrayVertexAttribDivisorEXT(a0,a1,a2);}
+static void replay_glArrayElementEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glArrayElementEXT(a0);}
+static void replay_glProgramParameter4dNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLdouble>();auto const a3=replayer.value<GLdouble>();auto const a4=replayer.value<GLdouble>();auto const a5=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glProgramParameter4dNV(a0,a1,a2,a3,a4,a5);}
+static void replay_glIndexxOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfixed>();if(replayer.isCorrupted())return;gl.glIndexxOES(a0);}
+static void replay_glUniform3uivEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glUniform3uivEXT(a0,a1,a2);}
+static void replay_glPopGroupMarkerEXT(FunctionTable const&gl,CallReplayer&replayer){if(replayer.isCorrupted())return;gl.glPopGroupMarkerEXT();}
+static void replay_glClearNamedFramebufferuiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLint>();auto const a3=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glClearNamedFramebufferuiv(a0,a1,a2,a3);}
+static void replay_glSetLocalConstantEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<const void*>();if(replayer.isCorrupted())return;gl.glSetLocalConstantEXT(a0,a1,a2);}
+static void replay_glProgramUniform1ui64NV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLuint64EXT>();if(replayer.isCorrupted())return;gl.glProgramUniform1ui64NV(a0,a1,a2);}
+static void replay_glColor4hvNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLhalfNV*>();if(replayer.isCorrupted())return;gl.glColor4hvNV(a0);}
+static void replay_glGetVertexAttribfv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glGetVertexAttribfv(a0,a1,a2);}
+static void replay_glDispatchCompute(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glDispatchCompute(a0,a1,a2);}
+static void replay_glGetActiveAttrib(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.output<GLsizei*>();auto const a4=replayer.output<GLint*>();auto const a5=replayer.output<GLenum*>();auto const a6=replayer.output<GLchar*>();if(replayer.isCorrupted())return;gl.glGetActiveAttrib(a0,a1,a2,a3,a4,a5,a6);}
+static void replay_glFragmentColorMaterialSGIX(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glFragmentColorMaterialSGIX(a0,a1);}
+static void replay_glTexSubImage2D(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLsizei>();auto const a5=replayer.value<GLsizei>();auto const a6=replayer.value<GLenum>();auto const a7=replayer.value<GLenum>();auto const a8=replayer.pixels<const GLvoid*>();if(replayer.isCorrupted())return;gl.glTexSubImage2D(a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+static void replay_glGetnMinmaxARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLboolean>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLenum>();auto const a4=replayer.value<GLsizei>();auto const a5=replayer.output<void*>();if(replayer.isCorrupted())return;gl.glGetnMinmaxARB(a0,a1,a2,a3,a4,a5);}
+static void replay_glLogicOp(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glLogicOp(a0);}
+static void replay_glProgramUniformMatrix3x4fv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLboolean>();auto const a4=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glProgramUniformMatrix3x4fv(a0,a1,a2,a3,a4);}
+static void replay_glWindowPos4iMESA(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glWindowPos4iMESA(a0,a1,a2,a3);}
+static void replay_glPixelTransferf(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glPixelTransferf(a0,a1);}
+static void replay_glGetTextureParameterIuiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLuint*>();if(replayer.isCorrupted())return;gl.glGetTextureParameterIuiv(a0,a1,a2);}
+static void replay_glMultiTexCoord1xOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLfixed>();if(replayer.isCorrupted())return;gl.glMultiTexCoord1xOES(a0,a1);}
+static void replay_glProgramUniformMatrix4dv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLboolean>();auto const a4=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glProgramUniformMatrix4dv(a0,a1,a2,a3,a4);}
+static void replay_glGetnUniformiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetnUniformiv(a0,a1,a2,a3);}
+static void replay_glFramebufferTexture1DEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLuint>();auto const a4=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glFramebufferTexture1DEXT(a0,a1,a2,a3,a4);}
+static void replay_glVertexPointervINTEL(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<const void**>();if(replayer.isCorrupted())return;gl.glVertexPointervINTEL(a0,a1,a2);}
+static void replay_glTextureParameterIiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glTextureParameterIiv(a0,a1,a2);}
+static void replay_glGetSeparableFilterEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.output<void*>();auto const a4=replayer.output<void*>();auto const a5=replayer.output<void*>();if(replayer.isCorrupted())return;gl.glGetSeparableFilterEXT(a0,a1,a2,a3,a4,a5);}
+static void replay_glMultiTexCoord3iARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glMultiTexCoord3iARB(a0,a1,a2,a3);}
+static void replay_glRasterPos4xvOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLfixed*>();if(replayer.isCorrupted())return;gl.glRasterPos4xvOES(a0);}
+static void replay_glDrawTransformFeedbackStream(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glDrawTransformFeedbackStream(a0,a1,a2);}
+static void replay_glVertex3hvNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLhalfNV*>();if(replayer.isCorrupted())return;gl.glVertex3hvNV(a0);}
+static void replay_glVertexArrayMultiTexCoordOffsetEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLenum>();auto const a5=replayer.value<GLsizei>();auto const a6=replayer.value<GLintptr>();if(replayer.isCorrupted())return;gl.glVertexArrayMultiTexCoordOffsetEXT(a0,a1,a2,a3,a4,a5,a6);}
+static void replay_glProvokingVertex(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glProvokingVertex(a0);}
+static void replay_glAccumxOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLfixed>();if(replayer.isCorrupted())return;gl.glAccumxOES(a0,a1);}
+static void replay_glShaderBinary(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.data<const GLuint*>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.data<const void*>();auto const a4=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glShaderBinary(a0,a1,a2,a3,a4);}
+static void replay_glGetMultiTexGenivEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetMultiTexGenivEXT(a0,a1,a2,a3);}
+static void replay_glPointParameterxvOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.null<const GLfixed*>();if(replayer.isCorrupted())return;gl.glPointParameterxvOES(a0,a1);}
+static void replay_glCreateStatesNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.output<GLuint*>();if(replayer.isCorrupted())return;gl.glCreateStatesNV(a0,a1);replayer.checkNames(a1);}
+static void replay_glClearDepthdNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glClearDepthdNV(a0);}
+static void replay_glClearColorIuiEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glClearColorIuiEXT(a0,a1,a2,a3);}
+static void replay_glBindMultiTextureEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glBindMultiTextureEXT(a0,a1,a2);}
+static void replay_glTexGeniv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.null<const GLint*>();if(replayer.isCorrupted())return;gl.glTexGeniv(a0,a1,a2);}
+static void replay_glDrawElements(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<const GLvoid*>();if(replayer.isCorrupted())return;gl.glDrawElements(a0,a1,a2,a3);}
+static void replay_glProgramUniform4iv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glProgramUniform4iv(a0,a1,a2,a3);}
+static void replay_glDisableVertexArrayEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glDisableVertexArrayEXT(a0,a1);}
+static void replay_glProgramUniform3ui64NV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLuint64EXT>();auto const a3=replayer.value<GLuint64EXT>();auto const a4=replayer.value<GLuint64EXT>();if(replayer.isCorrupted())return;gl.glProgramUniform3ui64NV(a0,a1,a2,a3,a4);}
+static void replay_glClientActiveTexture(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glClientActiveTexture(a0);}
+static void replay_glMultiTexParameterIivEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glMultiTexParameterIivEXT(a0,a1,a2,a3);}
+static void replay_glUniform1i64ARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLint64>();if(replayer.isCorrupted())return;gl.glUniform1i64ARB(a0,a1);}
+static void replay_glUniform1iv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glUniform1iv(a0,a1,a2);}
+static void replay_glVertexAttribArrayObjectATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLboolean>();auto const a4=replayer.value<GLsizei>();auto const a5=replayer.value<GLuint>();auto const a6=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glVertexAttribArrayObjectATI(a0,a1,a2,a3,a4,a5,a6);}
+static void replay_glUniform2iARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glUniform2iARB(a0,a1,a2);}
+static void replay_glDrawArraysInstanced(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glDrawArraysInstanced(a0,a1,a2,a3);}
+static void replay_glVertexAttrib2sNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLshort>();auto const a2=replayer.value<GLshort>();if(replayer.isCorrupted())return;gl.glVertexAttrib2sNV(a0,a1,a2);}
+static void replay_glTexBufferEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glTexBufferEXT(a0,a1,a2);}
+static void replay_glVertexStream2fATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLfloat>();auto const a2=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glVertexStream2fATI(a0,a1,a2);}
+static void replay_glDebugMessageCallbackAMD(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.null<GLDEBUGPROCAMD>();auto const a1=replayer.output<void*>();if(replayer.isCorrupted())return;gl.glDebugMessageCallbackAMD(a0,a1);}
+static void replay_glSamplerParameteriv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glSamplerParameteriv(a0,a1,a2);}
+static void replay_glVertexAttrib4uiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glVertexAttrib4uiv(a0,a1);}
+static void replay_glEndQueryIndexed(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glEndQueryIndexed(a0,a1);}
+static void replay_glNormalStream3sATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLshort>();auto const a2=replayer.value<GLshort>();auto const a3=replayer.value<GLshort>();if(replayer.isCorrupted())return;gl.glNormalStream3sATI(a0,a1,a2,a3);}
+static void replay_glProgramParameteriARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glProgramParameteriARB(a0,a1,a2);}
+static void replay_glTexEnvxOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLfixed>();if(replayer.isCorrupted())return;gl.glTexEnvxOES(a0,a1,a2);}
+static void replay_glProgramUniform1iv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glProgramUniform1iv(a0,a1,a2,a3);}
+static void replay_glDisableVertexAttribAPPLE(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glDisableVertexAttribAPPLE(a0,a1);}
+static void replay_glBindRenderbuffer(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glBindRenderbuffer(a0,a1);}
+static void replay_glMultiTexSubImage3DEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLint>();auto const a5=replayer.value<GLint>();auto const a6=replayer.value<GLsizei>();auto const a7=replayer.value<GLsizei>();auto const a8=replayer.value<GLsizei>();auto const a9=replayer.value<GLenum>();auto const a10=replayer.value<GLenum>();auto const a11=replayer.value<const void*>();if(replayer.isCorrupted())return;gl.glMultiTexSubImage3DEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11);}
+static void replay_glIsProgram(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glIsProgram(a0);}
+static void replay_glMultiDrawElementsIndirectAMD(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<const void*>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glMultiDrawElementsIndirectAMD(a0,a1,a2,a3,a4);}
+static void replay_glGetProgramInfoLog(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.output<GLsizei*>();auto const a3=replayer.output<GLchar*>();if(replayer.isCorrupted())return;gl.glGetProgramInfoLog(a0,a1,a2,a3);}
+static void replay_glGetLocalConstantBooleanvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLboolean*>();if(replayer.isCorrupted())return;gl.glGetLocalConstantBooleanvEXT(a0,a1,a2);}
+static void replay_glPixelTransformParameteriEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glPixelTransformParameteriEXT(a0,a1,a2);}
+static void replay_glTexCoord4bOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLbyte>();auto const a1=replayer.value<GLbyte>();auto const a2=replayer.value<GLbyte>();auto const a3=replayer.value<GLbyte>();if(replayer.isCorrupted())return;gl.glTexCoord4bOES(a0,a1,a2,a3);}
+static void replay_glVertexAttrib4fv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glVertexAttrib4fv(a0,a1);}
+static void replay_glProgramUniformMatrix2x3dv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLboolean>();auto const a4=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glProgramUniformMatrix2x3dv(a0,a1,a2,a3,a4);}
+static void replay_glProgramEnvParametersI4uivNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glProgramEnvParametersI4uivNV(a0,a1,a2,a3);}
+static void replay_glTexCoord3xOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfixed>();auto const a1=replayer.value<GLfixed>();auto const a2=replayer.value<GLfixed>();if(replayer.isCorrupted())return;gl.glTexCoord3xOES(a0,a1,a2);}
+static void replay_glLoadTransposeMatrixfARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glLoadTransposeMatrixfARB(a0);}
+static void replay_glImageTransformParameteriHP(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glImageTransformParameteriHP(a0,a1,a2);}
+static void replay_glMultiTexCoord4xOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLfixed>();auto const a2=replayer.value<GLfixed>();auto const a3=replayer.value<GLfixed>();auto const a4=replayer.value<GLfixed>();if(replayer.isCorrupted())return;gl.glMultiTexCoord4xOES(a0,a1,a2,a3,a4);}
+static void replay_glVertexAttribs3fvNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glVertexAttribs3fvNV(a0,a1,a2);}
+static void replay_glVertexAttrib2fv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glVertexAttrib2fv(a0,a1);}
+static void replay_glUniform3ui64NV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLuint64EXT>();auto const a2=replayer.value<GLuint64EXT>();auto const a3=replayer.value<GLuint64EXT>();if(replayer.isCorrupted())return;gl.glUniform3ui64NV(a0,a1,a2,a3);}
+static void replay_glCombinerParameterfvNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.null<const GLfloat*>();if(replayer.isCorrupted())return;gl.glCombinerParameterfvNV(a0,a1);}
+static void replay_glFragmentMaterialiSGIX(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glFragmentMaterialiSGIX(a0,a1,a2);}
+static void replay_glGetBooleani_v(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.output<GLboolean*>();if(replayer.isCorrupted())return;gl.glGetBooleani_v(a0,a1,a2);}
+static void replay_glGetProgramResourceIndex(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.data<const GLchar*>();if(replayer.isCorrupted())return;gl.glGetProgramResourceIndex(a0,a1,a2);}
+static void replay_glBeginConditionalRenderNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glBeginConditionalRenderNV(a0,a1);}
+static void replay_glDisableClientState(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glDisableClientState(a0);}
+static void replay_glPathFogGenNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glPathFogGenNV(a0);}
+static void replay_glStencilThenCoverFillPathNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glStencilThenCoverFillPathNV(a0,a1,a2,a3);}
+static void replay_glVertexArrayIndexOffsetEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.value<GLintptr>();if(replayer.isCorrupted())return;gl.glVertexArrayIndexOffsetEXT(a0,a1,a2,a3,a4);}
+static void replay_glProgramBufferParametersIuivNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glProgramBufferParametersIuivNV(a0,a1,a2,a3,a4);}
+static void replay_glPixelTransformParameterivEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.null<const GLint*>();if(replayer.isCorrupted())return;gl.glPixelTransformParameterivEXT(a0,a1,a2);}
+static void replay_glDisableClientStateiEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glDisableClientStateiEXT(a0,a1);}
+static void replay_glTexBufferARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glTexBufferARB(a0,a1,a2);}
+static void replay_glGetLocalConstantIntegervEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetLocalConstantIntegervEXT(a0,a1,a2);}
+static void replay_glColor4uiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glColor4uiv(a0);}
+static void replay_glProgramUniform3i(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glProgramUniform3i(a0,a1,a2,a3,a4);}
+static void replay_glMultiDrawElementsIndirectBindlessCountNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<const void*>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.value<GLsizei>();auto const a5=replayer.value<GLsizei>();auto const a6=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glMultiDrawElementsIndirectBindlessCountNV(a0,a1,a2,a3,a4,a5,a6);}
+static void replay_glGetBufferPointervARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<void**>();if(replayer.isCorrupted())return;gl.glGetBufferPointervARB(a0,a1,a2);}
+static void replay_glMultiTexParameterIuivEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glMultiTexParameterIuivEXT(a0,a1,a2,a3);}
+static void replay_glEvalMesh2(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glEvalMesh2(a0,a1,a2,a3,a4);}
+static void replay_glEvalMesh1(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glEvalMesh1(a0,a1,a2);}
+static void replay_glProgramUniform3f(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLfloat>();auto const a3=replayer.value<GLfloat>();auto const a4=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glProgramUniform3f(a0,a1,a2,a3,a4);}
+static void replay_glStencilThenCoverFillPathInstancedNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<const void*>();auto const a3=replayer.value<GLuint>();auto const a4=replayer.value<GLenum>();auto const a5=replayer.value<GLuint>();auto const a6=replayer.value<GLenum>();auto const a7=replayer.value<GLenum>();auto const a8=replayer.null<const GLfloat*>();if(replayer.isCorrupted())return;gl.glStencilThenCoverFillPathInstancedNV(a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+static void replay_glProgramUniform3d(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLdouble>();auto const a3=replayer.value<GLdouble>();auto const a4=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glProgramUniform3d(a0,a1,a2,a3,a4);}
+static void replay_glMapVertexAttrib1dAPPLE(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLdouble>();auto const a3=replayer.value<GLdouble>();auto const a4=replayer.value<GLint>();auto const a5=replayer.value<GLint>();auto const a6=replayer.null<const GLdouble*>();if(replayer.isCorrupted())return;gl.glMapVertexAttrib1dAPPLE(a0,a1,a2,a3,a4,a5,a6);}
+static void replay_glEvalCoord2fv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glEvalCoord2fv(a0);}
+static void replay_glGetUniformivARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLhandleARB>();auto const a1=replayer.value<GLint>();auto const a2=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetUniformivARB(a0,a1,a2);}
+static void replay_glLoadTransposeMatrixd(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glLoadTransposeMatrixd(a0);}
+static void replay_glLoadTransposeMatrixf(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glLoadTransposeMatrixf(a0);}
+static void replay_glGetPointervEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.output<void**>();if(replayer.isCorrupted())return;gl.glGetPointervEXT(a0,a1);}
+static void replay_glEndConditionalRenderNV(FunctionTable const&gl,CallReplayer&replayer){if(replayer.isCorrupted())return;gl.glEndConditionalRenderNV();}
+static void replay_glTexCoord2fNormal3fVertex3fSUN(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfloat>();auto const a1=replayer.value<GLfloat>();auto const a2=replayer.value<GLfloat>();auto const a3=replayer.value<GLfloat>();auto const a4=replayer.value<GLfloat>();auto const a5=replayer.value<GLfloat>();auto const a6=replayer.value<GLfloat>();auto const a7=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glTexCoord2fNormal3fVertex3fSUN(a0,a1,a2,a3,a4,a5,a6,a7);}
+static void replay_glUniform3i64vARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLint64*>();if(replayer.isCorrupted())return;gl.glUniform3i64vARB(a0,a1,a2);}
+static void replay_glProgramUniform2uiEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glProgramUniform2uiEXT(a0,a1,a2,a3);}
+static void replay_glVertexAttribI1ui(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glVertexAttribI1ui(a0,a1);}
+static void replay_glProgramNamedParameter4dvNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLubyte*>();auto const a3=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glProgramNamedParameter4dvNV(a0,a1,a2,a3);}
+static void replay_glCompileCommandListNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glCompileCommandListNV(a0);}
+static void replay_glGetRenderbufferParameterivEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetRenderbufferParameterivEXT(a0,a1,a2);}
+static void replay_glGetnPolygonStipple(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.output<GLubyte*>();if(replayer.isCorrupted())return;gl.glGetnPolygonStipple(a0,a1);}
+static void replay_glIsBufferResidentNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glIsBufferResidentNV(a0);}
+static void replay_glSecondaryColor3ubvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLubyte*>();if(replayer.isCorrupted())return;gl.glSecondaryColor3ubvEXT(a0);}
+static void replay_glGetNamedRenderbufferParameterivEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetNamedRenderbufferParameterivEXT(a0,a1,a2);}
+static void replay_glNamedFramebufferSampleLocationsfvARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glNamedFramebufferSampleLocationsfvARB(a0,a1,a2,a3);}
+static void replay_glMultiTexGendvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.null<const GLdouble*>();if(replayer.isCorrupted())return;gl.glMultiTexGendvEXT(a0,a1,a2,a3);}
+static void replay_glVertexArrayRangeNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.value<const void*>();if(replayer.isCorrupted())return;gl.glVertexArrayRangeNV(a0,a1);}
+static void replay_glIsTextureHandleResidentNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint64>();if(replayer.isCorrupted())return;gl.glIsTextureHandleResidentNV(a0);}
+static void replay_glGetProgramEnvParameterdvARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.output<GLdouble*>();if(replayer.isCorrupted())return;gl.glGetProgramEnvParameterdvARB(a0,a1,a2);}
+static void replay_glIsNamedStringARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.data<const GLchar*>();if(replayer.isCorrupted())return;gl.glIsNamedStringARB(a0,a1);}
+static void replay_glSecondaryColorFormatNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glSecondaryColorFormatNV(a0,a1,a2);}
+static void replay_glVertexAttrib4ubvNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLubyte*>();if(replayer.isCorrupted())return;gl.glVertexAttrib4ubvNV(a0,a1);}
+static void replay_glTagSampleBufferSGIX(FunctionTable const&gl,CallReplayer&replayer){if(replayer.isCorrupted())return;gl.glTagSampleBufferSGIX();}
+static void replay_glVDPAUUnregisterSurfaceNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLvdpauSurfaceNV>();if(replayer.isCorrupted())return;gl.glVDPAUUnregisterSurfaceNV(a0);}
+static void replay_glGetPerfQueryIdByNameINTEL(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.output<GLchar*>();auto const a1=replayer.output<GLuint*>();if(replayer.isCorrupted())return;gl.glGetPerfQueryIdByNameINTEL(a0,a1);}
+static void replay_glGetInteger64v(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.output<GLint64*>();if(replayer.isCorrupted())return;gl.glGetInteger64v(a0,a1);}
+static void replay_glClipPlane(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.null<const GLdouble*>();if(replayer.isCorrupted())return;gl.glClipPlane(a0,a1);}
+static void replay_glColor4ubVertex3fSUN(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLubyte>();auto const a1=replayer.value<GLubyte>();auto const a2=replayer.value<GLubyte>();auto const a3=replayer.value<GLubyte>();auto const a4=replayer.value<GLfloat>();auto const a5=replayer.value<GLfloat>();auto const a6=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glColor4ubVertex3fSUN(a0,a1,a2,a3,a4,a5,a6);}
+static void replay_glIndexub(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLubyte>();if(replayer.isCorrupted())return;gl.glIndexub(a0);}
+static void replay_glGetProgramEnvParameterfvARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glGetProgramEnvParameterfvARB(a0,a1,a2);}
+static void replay_glVertexAttrib4usvARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLushort*>();if(replayer.isCorrupted())return;gl.glVertexAttrib4usvARB(a0,a1);}
+static void replay_glNamedFramebufferRenderbuffer(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glNamedFramebufferRenderbuffer(a0,a1,a2,a3);}
+static void replay_glProgramUniformMatrix3x4dv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLboolean>();auto const a4=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glProgramUniformMatrix3x4dv(a0,a1,a2,a3,a4);}
+static void replay_glTestFenceAPPLE(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glTestFenceAPPLE(a0);}
+static void replay_glVertexAttrib4Niv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glVertexAttrib4Niv(a0,a1);}
+static void replay_glVertexAttribL2i64vNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLint64EXT*>();if(replayer.isCorrupted())return;gl.glVertexAttribL2i64vNV(a0,a1);}
+static void replay_glColorP4uiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glColorP4uiv(a0,a1);}
+static void replay_glUniformMatrix2x3fv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.value<GLboolean>();auto const a3=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glUniformMatrix2x3fv(a0,a1,a2,a3);}
+static void replay_glCallCommandListNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glCallCommandListNV(a0);}
+static void replay_glClearBufferiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();auto const a2=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glClearBufferiv(a0,a1,a2);}
+static void replay_glNamedStringARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();auto const a2=replayer.data<const GLchar*>();auto const a3=replayer.value<GLint>();auto const a4=replayer.data<const GLchar*>();if(replayer.isCorrupted())return;gl.glNamedStringARB(a0,a1,a2,a3,a4);}
+static void replay_glMatrixMult3x2fNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glMatrixMult3x2fNV(a0,a1);}
+static void replay_glGetNamedProgramStringEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.output<void*>();if(replayer.isCorrupted())return;gl.glGetNamedProgramStringEXT(a0,a1,a2,a3);}
+static void replay_glGetnHistogramARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLboolean>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLenum>();auto const a4=replayer.value<GLsizei>();auto const a5=replayer.output<void*>();if(replayer.isCorrupted())return;gl.glGetnHistogramARB(a0,a1,a2,a3,a4,a5);}
+static void replay_glGetTextureLevelParameterfv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glGetTextureLevelParameterfv(a0,a1,a2,a3);}
+static void replay_glMultiTexCoord1fv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glMultiTexCoord1fv(a0,a1);}
+static void replay_glBitmapxOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.value<GLfixed>();auto const a3=replayer.value<GLfixed>();auto const a4=replayer.value<GLfixed>();auto const a5=replayer.value<GLfixed>();auto const a6=replayer.null<const GLubyte*>();if(replayer.isCorrupted())return;gl.glBitmapxOES(a0,a1,a2,a3,a4,a5,a6);}
+static void replay_glGetSamplerParameterIuiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLuint*>();if(replayer.isCorrupted())return;gl.glGetSamplerParameterIuiv(a0,a1,a2);}
+static void replay_glTexCoordP3ui(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glTexCoordP3ui(a0,a1);}
+static void replay_glTextureSubImage1D(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.value<GLenum>();auto const a5=replayer.value<GLenum>();auto const a6=replayer.pixels<const void*>();if(replayer.isCorrupted())return;gl.glTextureSubImage1D(a0,a1,a2,a3,a4,a5,a6);}
+static void replay_glVertexAttribLPointerEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.value<const void*>();if(replayer.isCorrupted())return;gl.glVertexAttribLPointerEXT(a0,a1,a2,a3,a4);}
+static void replay_glFogCoordPointerEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.value<const void*>();if(replayer.isCorrupted())return;gl.glFogCoordPointerEXT(a0,a1,a2);}
+static void replay_glWindowPos3s(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLshort>();auto const a1=replayer.value<GLshort>();auto const a2=replayer.value<GLshort>();if(replayer.isCorrupted())return;gl.glWindowPos3s(a0,a1,a2);}
+static void replay_glVertexAttribs2svNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLshort*>();if(replayer.isCorrupted())return;gl.glVertexAttribs2svNV(a0,a1,a2);}
+static void replay_glTextureImage3DEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLsizei>();auto const a5=replayer.value<GLsizei>();auto const a6=replayer.value<GLsizei>();auto const a7=replayer.value<GLint>();auto const a8=replayer.value<GLenum>();auto const a9=replayer.value<GLenum>();auto const a10=replayer.pixels<const void*>();if(replayer.isCorrupted())return;gl.glTextureImage3DEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10);}
+static void replay_glWindowPos3i(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glWindowPos3i(a0,a1,a2);}
+static void replay_glWindowPos3d(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLdouble>();auto const a1=replayer.value<GLdouble>();auto const a2=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glWindowPos3d(a0,a1,a2);}
+static void replay_glWindowPos3f(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfloat>();auto const a1=replayer.value<GLfloat>();auto const a2=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glWindowPos3f(a0,a1,a2);}
+static void replay_glIsEnabledIndexedEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glIsEnabledIndexedEXT(a0,a1);}
+static void replay_glGetNamedProgramivEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetNamedProgramivEXT(a0,a1,a2,a3);}
+static void replay_glVertex3xvOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLfixed*>();if(replayer.isCorrupted())return;gl.glVertex3xvOES(a0);}
+static void replay_glColor3us(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLushort>();auto const a1=replayer.value<GLushort>();auto const a2=replayer.value<GLushort>();if(replayer.isCorrupted())return;gl.glColor3us(a0,a1,a2);}
+static void replay_glBeginPerfMonitorAMD(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glBeginPerfMonitorAMD(a0);}
+static void replay_glProgramUniformMatrix4x3dv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLboolean>();auto const a4=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glProgramUniformMatrix4x3dv(a0,a1,a2,a3,a4);}
+static void replay_glGetNamedProgramLocalParameterIuivEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.output<GLuint*>();if(replayer.isCorrupted())return;gl.glGetNamedProgramLocalParameterIuivEXT(a0,a1,a2,a3);}
+static void replay_glReadnPixels(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.value<GLenum>();auto const a5=replayer.value<GLenum>();auto const a6=replayer.value<GLsizei>();auto const a7=replayer.outputPixels<void*>();if(replayer.isCorrupted())return;gl.glReadnPixels(a0,a1,a2,a3,a4,a5,a6,a7);}
+static void replay_glMultiTexCoord4f(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLfloat>();auto const a2=replayer.value<GLfloat>();auto const a3=replayer.value<GLfloat>();auto const a4=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glMultiTexCoord4f(a0,a1,a2,a3,a4);}
+static void replay_glColor3ub(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLubyte>();auto const a1=replayer.value<GLubyte>();auto const a2=replayer.value<GLubyte>();if(replayer.isCorrupted())return;gl.glColor3ub(a0,a1,a2);}
+static void replay_glMultiTexCoord4d(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLdouble>();auto const a2=replayer.value<GLdouble>();auto const a3=replayer.value<GLdouble>();auto const a4=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glMultiTexCoord4d(a0,a1,a2,a3,a4);}
+static void replay_glVertexAttribL3ui64NV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint64EXT>();auto const a2=replayer.value<GLuint64EXT>();auto const a3=replayer.value<GLuint64EXT>();if(replayer.isCorrupted())return;gl.glVertexAttribL3ui64NV(a0,a1,a2,a3);}
+static void replay_glColor3ui(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glColor3ui(a0,a1,a2);}
+static void replay_glProgramUniform4fvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glProgramUniform4fvEXT(a0,a1,a2,a3);}
+static void replay_glVertexAttrib2sARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLshort>();auto const a2=replayer.value<GLshort>();if(replayer.isCorrupted())return;gl.glVertexAttrib2sARB(a0,a1,a2);}
+static void replay_glMultiTexCoord4i(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glMultiTexCoord4i(a0,a1,a2,a3,a4);}
+static void replay_glCheckFramebufferStatusEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glCheckFramebufferStatusEXT(a0);}
+static void replay_glGetnMapivARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetnMapivARB(a0,a1,a2,a3);}
+static void replay_glMultiTexCoord1ivARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glMultiTexCoord1ivARB(a0,a1);}
+static void replay_glDisableVertexAttribArrayARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glDisableVertexAttribArrayARB(a0);}
+static void replay_glGetPolygonStipple(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.output<GLubyte*>();if(replayer.isCorrupted())return;gl.glGetPolygonStipple(a0);}
+static void replay_glVertexAttribI4ui(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<GLuint>();auto const a4=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glVertexAttribI4ui(a0,a1,a2,a3,a4);}
+static void replay_glGetPathDashArrayNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glGetPathDashArrayNV(a0,a1);}
+static void replay_glMultiTexRenderbufferEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glMultiTexRenderbufferEXT(a0,a1,a2);}
+static void replay_glCopyTextureSubImage1D(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLint>();auto const a5=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glCopyTextureSubImage1D(a0,a1,a2,a3,a4,a5);}
+static void replay_glDeleteOcclusionQueriesNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glDeleteOcclusionQueriesNV(a0,a1);}
+static void replay_glVertex4hvNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLhalfNV*>();if(replayer.isCorrupted())return;gl.glVertex4hvNV(a0);}
+static void replay_glGetnTexImage(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLenum>();auto const a4=replayer.value<GLsizei>();auto const a5=replayer.output<void*>();if(replayer.isCorrupted())return;gl.glGetnTexImage(a0,a1,a2,a3,a4,a5);}
+static void replay_glProgramLocalParameter4dARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLdouble>();auto const a3=replayer.value<GLdouble>();auto const a4=replayer.value<GLdouble>();auto const a5=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glProgramLocalParameter4dARB(a0,a1,a2,a3,a4,a5);}
+static void replay_glBlendEquation(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glBlendEquation(a0);}
+static void replay_glUnlockArraysEXT(FunctionTable const&gl,CallReplayer&replayer){if(replayer.isCorrupted())return;gl.glUnlockArraysEXT();}
+static void replay_glGetQueryObjectui64vEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLuint64*>();if(replayer.isCorrupted())return;gl.glGetQueryObjectui64vEXT(a0,a1,a2);}
+static void replay_glVertexAttribI4uivEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glVertexAttribI4uivEXT(a0,a1);}
+static void replay_glUniform1i64vNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLint64EXT*>();if(replayer.isCorrupted())return;gl.glUniform1i64vNV(a0,a1,a2);}
+static void replay_glMultiTexCoord3dv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glMultiTexCoord3dv(a0,a1);}
+static void replay_glColor4sv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLshort*>();if(replayer.isCorrupted())return;gl.glColor4sv(a0);}
+static void replay_glVertexStream4ivATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glVertexStream4ivATI(a0,a1);}
+static void replay_glPopClientAttrib(FunctionTable const&gl,CallReplayer&replayer){if(replayer.isCorrupted())return;gl.glPopClientAttrib();}
+static void replay_glClearBufferData(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLenum>();auto const a4=replayer.data<const void*>();if(replayer.isCorrupted())return;gl.glClearBufferData(a0,a1,a2,a3,a4);}
+static void replay_glGetProgramivNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetProgramivNV(a0,a1,a2);}
+static void replay_glBeginTransformFeedback(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glBeginTransformFeedback(a0);}
+static void replay_glFinishObjectAPPLE(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glFinishObjectAPPLE(a0,a1);}
+static void replay_glGetMinmaxParameterivEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetMinmaxParameterivEXT(a0,a1,a2);}
+static void replay_glColor3iv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glColor3iv(a0);}
+static void replay_glVertexAttrib3sv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLshort*>();if(replayer.isCorrupted())return;gl.glVertexAttrib3sv(a0,a1);}
+static void replay_glCompressedTexImage1D(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.value<GLint>();auto const a5=replayer.value<GLsizei>();auto const a6=replayer.pixels<const GLvoid*>();if(replayer.isCorrupted())return;gl.glCompressedTexImage1D(a0,a1,a2,a3,a4,a5,a6);}
+static void replay_glDeleteTransformFeedbacks(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glDeleteTransformFeedbacks(a0,a1);}
+static void replay_glGetVideoi64vNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLint64EXT*>();if(replayer.isCorrupted())return;gl.glGetVideoi64vNV(a0,a1,a2);}
+static void replay_glDrawRangeElementsBaseVertex(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.value<GLenum>();auto const a5=replayer.value<const void*>();auto const a6=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glDrawRangeElementsBaseVertex(a0,a1,a2,a3,a4,a5,a6);}
+static void replay_glUniform4i64vARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLint64*>();if(replayer.isCorrupted())return;gl.glUniform4i64vARB(a0,a1,a2);}
+static void replay_glTextureStorage3DMultisampleEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLenum>();auto const a4=replayer.value<GLsizei>();auto const a5=replayer.value<GLsizei>();auto const a6=replayer.value<GLsizei>();auto const a7=replayer.value<GLboolean>();if(replayer.isCorrupted())return;gl.glTextureStorage3DMultisampleEXT(a0,a1,a2,a3,a4,a5,a6,a7);}
+static void replay_glGetTexParameterfv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glGetTexParameterfv(a0,a1,a2);}
+static void replay_glProgramUniformui64vNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.data<const GLuint64EXT*>();if(replayer.isCorrupted())return;gl.glProgramUniformui64vNV(a0,a1,a2,a3);}
+static void replay_glCompressedMultiTexImage1DEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLenum>();auto const a4=replayer.value<GLsizei>();auto const a5=replayer.value<GLint>();auto const a6=replayer.value<GLsizei>();auto const a7=replayer.pixels<const void*>();if(replayer.isCorrupted())return;gl.glCompressedMultiTexImage1DEXT(a0,a1,a2,a3,a4,a5,a6,a7);}
+static void replay_glProgramUniform2ivEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glProgramUniform2ivEXT(a0,a1,a2,a3);}
+static void replay_glPushGroupMarkerEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.data<const GLchar*>();if(replayer.isCorrupted())return;gl.glPushGroupMarkerEXT(a0,a1);}
+static void replay_glVertexAttrib1dv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glVertexAttrib1dv(a0,a1);}
+static void replay_glMatrixLoadIdentityEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glMatrixLoadIdentityEXT(a0);}
+static void replay_glMultTransposeMatrixxOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLfixed*>();if(replayer.isCorrupted())return;gl.glMultTransposeMatrixxOES(a0);}
+static void replay_glGetPixelMapxv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();auto const a2=replayer.output<GLfixed*>();if(replayer.isCorrupted())return;gl.glGetPixelMapxv(a0,a1,a2);}
+static void replay_glFramebufferSampleLocationsfvARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glFramebufferSampleLocationsfvARB(a0,a1,a2,a3);}
+static void replay_glGetLightiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetLightiv(a0,a1,a2);}
+static void replay_glBlendFuncSeparatei(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLenum>();auto const a4=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glBlendFuncSeparatei(a0,a1,a2,a3,a4);}
+static void replay_glGetBooleanIndexedvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.output<GLboolean*>();if(replayer.isCorrupted())return;gl.glGetBooleanIndexedvEXT(a0,a1,a2);}
+static void replay_glGetProgramSubroutineParameteruivNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.output<GLuint*>();if(replayer.isCorrupted())return;gl.glGetProgramSubroutineParameteruivNV(a0,a1,a2);}
+static void replay_glUniform2ui(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glUniform2ui(a0,a1,a2);}
+static void replay_glApplyFramebufferAttachmentCMAAINTEL(FunctionTable const&gl,CallReplayer&replayer){if(replayer.isCorrupted())return;gl.glApplyFramebufferAttachmentCMAAINTEL();}
+static void replay_glWindowPos2fv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glWindowPos2fv(a0);}
+static void replay_glDisablei(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glDisablei(a0,a1);}
+static void replay_glSelectPerfMonitorCountersAMD(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLboolean>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.output<GLuint*>();if(replayer.isCorrupted())return;gl.glSelectPerfMonitorCountersAMD(a0,a1,a2,a3,a4);}
+static void replay_glGetVertexAttribLi64vNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLint64EXT*>();if(replayer.isCorrupted())return;gl.glGetVertexAttribLi64vNV(a0,a1,a2);}
+static void replay_glBlendFuncSeparateiARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLenum>();auto const a4=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glBlendFuncSeparateiARB(a0,a1,a2,a3,a4);}
+static void replay_glWeightuivARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glWeightuivARB(a0,a1);}
+static void replay_glWindowPos2iARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glWindowPos2iARB(a0,a1);}
+static void replay_glGetProgramLocalParameterdvARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.output<GLdouble*>();if(replayer.isCorrupted())return;gl.glGetProgramLocalParameterdvARB(a0,a1,a2);}
+static void replay_glGetUniformui64vARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.output<GLuint64*>();if(replayer.isCorrupted())return;gl.glGetUniformui64vARB(a0,a1,a2);}
+static void replay_glGetSynciv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.sync();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.output<GLsizei*>();auto const a4=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetSynciv(a0,a1,a2,a3,a4);}
+static void replay_glMakeImageHandleResidentARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint64>();auto const a1=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glMakeImageHandleResidentARB(a0,a1);}
+static void replay_glGetProgramNamedParameterfvNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.null<const GLubyte*>();auto const a3=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glGetProgramNamedParameterfvNV(a0,a1,a2,a3);}
+static void replay_glTextureStorage3D(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.value<GLsizei>();auto const a5=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glTextureStorage3D(a0,a1,a2,a3,a4,a5);}
+static void replay_glVertexAttrib4svNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLshort*>();if(replayer.isCorrupted())return;gl.glVertexAttrib4svNV(a0,a1);}
+static void replay_glProgramUniform2i(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glProgramUniform2i(a0,a1,a2,a3);}
+static void replay_glListDrawCommandsStatesClientNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<const void**>();auto const a3=replayer.data<const GLsizei*>();auto const a4=replayer.data<const GLuint*>();auto const a5=replayer.data<const GLuint*>();auto const a6=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glListDrawCommandsStatesClientNV(a0,a1,a2,a3,a4,a5,a6);}
+static void replay_glProgramLocalParametersI4uivNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glProgramLocalParametersI4uivNV(a0,a1,a2,a3);}
+static void replay_glBeginTransformFeedbackNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glBeginTransformFeedbackNV(a0);}
+static void replay_glGetProgramBinary(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.output<GLsizei*>();auto const a3=replayer.output<GLenum*>();auto const a4=replayer.output<void*>();if(replayer.isCorrupted())return;gl.glGetProgramBinary(a0,a1,a2,a3,a4);}
+static void replay_glBinormal3iEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glBinormal3iEXT(a0,a1,a2);}
+static void replay_glEvalPoint1(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glEvalPoint1(a0);}
+static void replay_glEvalPoint2(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glEvalPoint2(a0,a1);}
+static void replay_glPauseTransformFeedback(FunctionTable const&gl,CallReplayer&replayer){if(replayer.isCorrupted())return;gl.glPauseTransformFeedback();}
+static void replay_glWindowPos2sMESA(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLshort>();auto const a1=replayer.value<GLshort>();if(replayer.isCorrupted())return;gl.glWindowPos2sMESA(a0,a1);}
+static void replay_glGlobalAlphaFactorbSUN(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLbyte>();if(replayer.isCorrupted())return;gl.glGlobalAlphaFactorbSUN(a0);}
+static void replay_glCreateTransformFeedbacks(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.output<GLuint*>();if(replayer.isCorrupted())return;gl.glCreateTransformFeedbacks(a0,a1);replayer.checkNames(a1);}
+static void replay_glTexturePageCommitmentEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLint>();auto const a5=replayer.value<GLsizei>();auto const a6=replayer.value<GLsizei>();auto const a7=replayer.value<GLsizei>();auto const a8=replayer.value<GLboolean>();if(replayer.isCorrupted())return;gl.glTexturePageCommitmentEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+static void replay_glTransformFeedbackVaryingsNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLint*>();auto const a3=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glTransformFeedbackVaryingsNV(a0,a1,a2,a3);}
+static void replay_glTexSubImage1D(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.value<GLenum>();auto const a5=replayer.value<GLenum>();auto const a6=replayer.pixels<const GLvoid*>();if(replayer.isCorrupted())return;gl.glTexSubImage1D(a0,a1,a2,a3,a4,a5,a6);}
+static void replay_glConvolutionParameterfvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.null<const GLfloat*>();if(replayer.isCorrupted())return;gl.glConvolutionParameterfvEXT(a0,a1,a2);}
+static void replay_glBlitFramebufferEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLint>();auto const a5=replayer.value<GLint>();auto const a6=replayer.value<GLint>();auto const a7=replayer.value<GLint>();auto const a8=replayer.value<GLbitfield>();auto const a9=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glBlitFramebufferEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}
+static void replay_glUniformMatrix4fvARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.value<GLboolean>();auto const a3=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glUniformMatrix4fvARB(a0,a1,a2,a3);}
+static void replay_glProgramEnvParameter4dvARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glProgramEnvParameter4dvARB(a0,a1,a2);}
+static void replay_glSecondaryColor3hNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLhalfNV>();auto const a1=replayer.value<GLhalfNV>();auto const a2=replayer.value<GLhalfNV>();if(replayer.isCorrupted())return;gl.glSecondaryColor3hNV(a0,a1,a2);}
+static void replay_glVertexAttribP3uiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLboolean>();auto const a3=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glVertexAttribP3uiv(a0,a1,a2,a3);}
+static void replay_glFogCoordFormatNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glFogCoordFormatNV(a0,a1);}
+static void replay_glGetMultiTexLevelParameterivEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLenum>();auto const a4=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetMultiTexLevelParameterivEXT(a0,a1,a2,a3,a4);}
+static void replay_glIsOcclusionQueryNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glIsOcclusionQueryNV(a0);}
+static void replay_glCompressedTexImage2DARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.value<GLsizei>();auto const a5=replayer.value<GLint>();auto const a6=replayer.value<GLsizei>();auto const a7=replayer.value<const void*>();if(replayer.isCorrupted())return;gl.glCompressedTexImage2DARB(a0,a1,a2,a3,a4,a5,a6,a7);}
+static void replay_glGetProgramEnvParameterIuivNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.output<GLuint*>();if(replayer.isCorrupted())return;gl.glGetProgramEnvParameterIuivNV(a0,a1,a2);}
+static void replay_glVertexAttrib4sv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLshort*>();if(replayer.isCorrupted())return;gl.glVertexAttrib4sv(a0,a1);}
+static void replay_glVertexAttrib4fvARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glVertexAttrib4fvARB(a0,a1);}
+static void replay_glLoadName(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glLoadName(a0);}
+static void replay_glBindVertexShaderEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glBindVertexShaderEXT(a0);}
+static void replay_glGetNamedProgramLocalParameterIivEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetNamedProgramLocalParameterIivEXT(a0,a1,a2,a3);}
+static void replay_glProgramUniform3uiEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<GLuint>();auto const a4=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glProgramUniform3uiEXT(a0,a1,a2,a3,a4);}
+static void replay_glProgramUniformMatrix4x2dvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLboolean>();auto const a4=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glProgramUniformMatrix4x2dvEXT(a0,a1,a2,a3,a4);}
+static void replay_glTexCoord1hvNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLhalfNV*>();if(replayer.isCorrupted())return;gl.glTexCoord1hvNV(a0);}
+static void replay_glLoadMatrixd(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glLoadMatrixd(a0);}
+static void replay_glTexParameterfv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glTexParameterfv(a0,a1,a2);}
+static void replay_glVariantdvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.null<const GLdouble*>();if(replayer.isCorrupted())return;gl.glVariantdvEXT(a0,a1);}
+static void replay_glCullParameterfvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glCullParameterfvEXT(a0,a1);}
+static void replay_glUniform3dv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glUniform3dv(a0,a1,a2);}
+static void replay_glProgramUniform3fv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glProgramUniform3fv(a0,a1,a2,a3);}
+static void replay_glIsBufferARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glIsBufferARB(a0);}
+static void replay_glMultiTexCoord1bOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLbyte>();if(replayer.isCorrupted())return;gl.glMultiTexCoord1bOES(a0,a1);}
+static void replay_glFogCoordhNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLhalfNV>();if(replayer.isCorrupted())return;gl.glFogCoordhNV(a0);}
+static void replay_glFramebufferSampleLocationsfvNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glFramebufferSampleLocationsfvNV(a0,a1,a2,a3);}
+static void replay_glGenSymbolsEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glGenSymbolsEXT(a0,a1,a2,a3);}
+static void replay_glGetConvolutionFilter(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.output<GLvoid*>();if(replayer.isCorrupted())return;gl.glGetConvolutionFilter(a0,a1,a2,a3);}
+static void replay_glProgramUniform1fvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glProgramUniform1fvEXT(a0,a1,a2,a3);}
+static void replay_glGetNextPerfQueryIdINTEL(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.output<GLuint*>();if(replayer.isCorrupted())return;gl.glGetNextPerfQueryIdINTEL(a0,a1);}
+static void replay_glCompressedTexImage1DARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.value<GLint>();auto const a5=replayer.value<GLsizei>();auto const a6=replayer.value<const void*>();if(replayer.isCorrupted())return;gl.glCompressedTexImage1DARB(a0,a1,a2,a3,a4,a5,a6);}
+static void replay_glBindSamplers(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glBindSamplers(a0,a1,a2);}
+static void replay_glGetProgramEnvParameterIivNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetProgramEnvParameterIivNV(a0,a1,a2);}
+static void replay_glGetQueryObjectui64v(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLuint64*>();if(replayer.isCorrupted())return;gl.glGetQueryObjectui64v(a0,a1,a2);}
+static void replay_glVertexAttribL4ui64vNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLuint64EXT*>();if(replayer.isCorrupted())return;gl.glVertexAttribL4ui64vNV(a0,a1);}
+static void replay_glGetVideoivNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetVideoivNV(a0,a1,a2);}
+static void replay_glGetTextureImage(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLenum>();auto const a4=replayer.value<GLsizei>();auto const a5=replayer.output<void*>();if(replayer.isCorrupted())return;gl.glGetTextureImage(a0,a1,a2,a3,a4,a5);}
+static void replay_glProgramUniform1fv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glProgramUniform1fv(a0,a1,a2,a3);}
+static void replay_glUniformMatrix4fv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.value<GLboolean>();auto const a3=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glUniformMatrix4fv(a0,a1,a2,a3);}
+static void replay_glColorMask(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLboolean>();auto const a1=replayer.value<GLboolean>();auto const a2=replayer.value<GLboolean>();auto const a3=replayer.value<GLboolean>();if(replayer.isCorrupted())return;gl.glColorMask(a0,a1,a2,a3);}
+static void replay_glBeginFragmentShaderATI(FunctionTable const&gl,CallReplayer&replayer){if(replayer.isCorrupted())return;gl.glBeginFragmentShaderATI();}
+static void replay_glMultiDrawArraysEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLint*>();auto const a2=replayer.data<const GLsizei*>();auto const a3=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glMultiDrawArraysEXT(a0,a1,a2,a3);}
+static void replay_glGenNamesAMD(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.output<GLuint*>();if(replayer.isCorrupted())return;gl.glGenNamesAMD(a0,a1,a2);}
+static void replay_glPathParameteriNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glPathParameteriNV(a0,a1,a2);}
+static void replay_glCreateCommandListsNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.output<GLuint*>();if(replayer.isCorrupted())return;gl.glCreateCommandListsNV(a0,a1);replayer.checkNames(a1);}
+static void replay_glDeleteProgramPipelines(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glDeleteProgramPipelines(a0,a1);}
+static void replay_glCopyColorSubTableEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glCopyColorSubTableEXT(a0,a1,a2,a3,a4);}
+static void replay_glVariantsvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.null<const GLshort*>();if(replayer.isCorrupted())return;gl.glVariantsvEXT(a0,a1);}
+static void replay_glGenProgramPipelines(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.output<GLuint*>();if(replayer.isCorrupted())return;gl.glGenProgramPipelines(a0,a1);replayer.checkNames(a1);}
+static void replay_glVertexArrayEdgeFlagOffsetEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLintptr>();if(replayer.isCorrupted())return;gl.glVertexArrayEdgeFlagOffsetEXT(a0,a1,a2,a3);}
+static void replay_glWindowPos2s(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLshort>();auto const a1=replayer.value<GLshort>();if(replayer.isCorrupted())return;gl.glWindowPos2s(a0,a1);}
+static void replay_glSecondaryColor3iEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glSecondaryColor3iEXT(a0,a1,a2);}
+static void replay_glWindowPos2i(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glWindowPos2i(a0,a1);}
+static void replay_glWindowPos2f(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfloat>();auto const a1=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glWindowPos2f(a0,a1);}
+static void replay_glWindowPos2d(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLdouble>();auto const a1=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glWindowPos2d(a0,a1);}
+static void replay_glUniform4uivEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glUniform4uivEXT(a0,a1,a2);}
+static void replay_glOrthoxOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfixed>();auto const a1=replayer.value<GLfixed>();auto const a2=replayer.value<GLfixed>();auto const a3=replayer.value<GLfixed>();auto const a4=replayer.value<GLfixed>();auto const a5=replayer.value<GLfixed>();if(replayer.isCorrupted())return;gl.glOrthoxOES(a0,a1,a2,a3,a4,a5);}
+static void replay_glUniformSubroutinesuiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glUniformSubroutinesuiv(a0,a1,a2);}
+static void replay_glRectdv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.null<const GLdouble*>();auto const a1=replayer.null<const GLdouble*>();if(replayer.isCorrupted())return;gl.glRectdv(a0,a1);}
+static void replay_glProgramUniform1i64vNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.data<const GLint64EXT*>();if(replayer.isCorrupted())return;gl.glProgramUniform1i64vNV(a0,a1,a2,a3);}
+static void replay_glVertexAttribI4uiEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<GLuint>();auto const a4=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glVertexAttribI4uiEXT(a0,a1,a2,a3,a4);}
+static void replay_glSecondaryColor3ubEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLubyte>();auto const a1=replayer.value<GLubyte>();auto const a2=replayer.value<GLubyte>();if(replayer.isCorrupted())return;gl.glSecondaryColor3ubEXT(a0,a1,a2);}
+static void replay_glCompressedMultiTexSubImage1DEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLsizei>();auto const a5=replayer.value<GLenum>();auto const a6=replayer.value<GLsizei>();auto const a7=replayer.pixels<const void*>();if(replayer.isCorrupted())return;gl.glCompressedMultiTexSubImage1DEXT(a0,a1,a2,a3,a4,a5,a6,a7);}
+static void replay_glMultiTexGendEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glMultiTexGendEXT(a0,a1,a2,a3);}
+static void replay_glColorP3uiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glColorP3uiv(a0,a1);}
+static void replay_glFogCoordfv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.null<const GLfloat*>();if(replayer.isCorrupted())return;gl.glFogCoordfv(a0);}
+static void replay_glCompileShader(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glCompileShader(a0);}
+static void replay_glTexCoord2hNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLhalfNV>();auto const a1=replayer.value<GLhalfNV>();if(replayer.isCorrupted())return;gl.glTexCoord2hNV(a0,a1);}
+static void replay_glUniform1uivEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glUniform1uivEXT(a0,a1,a2);}
+static void replay_glMatrixLoadTransposedEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glMatrixLoadTransposedEXT(a0,a1);}
+static void replay_glIndexfv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.null<const GLfloat*>();if(replayer.isCorrupted())return;gl.glIndexfv(a0);}
+static void replay_glGetCompressedTextureImage(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.output<void*>();if(replayer.isCorrupted())return;gl.glGetCompressedTextureImage(a0,a1,a2,a3);}
+static void replay_glGetUniformuivEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.output<GLuint*>();if(replayer.isCorrupted())return;gl.glGetUniformuivEXT(a0,a1,a2);}
+static void replay_glGetnPixelMapfvARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glGetnPixelMapfvARB(a0,a1,a2);}
+static void replay_glFramebufferTextureEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glFramebufferTextureEXT(a0,a1,a2,a3);}
+static void replay_glVertexAttribIPointer(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.value<const void*>();if(replayer.isCorrupted())return;gl.glVertexAttribIPointer(a0,a1,a2,a3,a4);}
+static void replay_glMultiTexCoordP3ui(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glMultiTexCoordP3ui(a0,a1,a2);}
+static void replay_glEvaluateDepthValuesARB(FunctionTable const&gl,CallReplayer&replayer){if(replayer.isCorrupted())return;gl.glEvaluateDepthValuesARB();}
+static void replay_glGetNamedBufferParameteriv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetNamedBufferParameteriv(a0,a1,a2);}
+static void replay_glGetNamedProgramLocalParameterfvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glGetNamedProgramLocalParameterfvEXT(a0,a1,a2,a3);}
+static void replay_glColor4fNormal3fVertex3fvSUN(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLfloat*>();auto const a1=replayer.data<const GLfloat*>();auto const a2=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glColor4fNormal3fVertex3fvSUN(a0,a1,a2);}
+static void replay_glSeparableFilter2DEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.value<GLenum>();auto const a5=replayer.value<GLenum>();auto const a6=replayer.value<const void*>();auto const a7=replayer.value<const void*>();if(replayer.isCorrupted())return;gl.glSeparableFilter2DEXT(a0,a1,a2,a3,a4,a5,a6,a7);}
+static void replay_glTexParameterxOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLfixed>();if(replayer.isCorrupted())return;gl.glTexParameterxOES(a0,a1,a2);}
+static void replay_glClearAccumxOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfixed>();auto const a1=replayer.value<GLfixed>();auto const a2=replayer.value<GLfixed>();auto const a3=replayer.value<GLfixed>();if(replayer.isCorrupted())return;gl.glClearAccumxOES(a0,a1,a2,a3);}
+static void replay_glInvalidateFramebuffer(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLenum*>();if(replayer.isCorrupted())return;gl.glInvalidateFramebuffer(a0,a1,a2);}
+static void replay_glWeightubvARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.data<const GLubyte*>();if(replayer.isCorrupted())return;gl.glWeightubvARB(a0,a1);}
+static void replay_glVertexAttrib1d(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glVertexAttrib1d(a0,a1);}
+static void replay_glVertexAttrib1f(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glVertexAttrib1f(a0,a1);}
+static void replay_glVertex4fv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glVertex4fv(a0);}
+static void replay_glClearNamedFramebufferfi(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLfloat>();auto const a4=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glClearNamedFramebufferfi(a0,a1,a2,a3,a4);}
+static void replay_glGetQueryBufferObjectuiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLintptr>();if(replayer.isCorrupted())return;gl.glGetQueryBufferObjectuiv(a0,a1,a2,a3);}
+static void replay_glClearNamedFramebufferfv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLint>();auto const a3=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glClearNamedFramebufferfv(a0,a1,a2,a3);}
+static void replay_glEndVertexShaderEXT(FunctionTable const&gl,CallReplayer&replayer){if(replayer.isCorrupted())return;gl.glEndVertexShaderEXT();}
+static void replay_glVertexAttrib1s(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLshort>();if(replayer.isCorrupted())return;gl.glVertexAttrib1s(a0,a1);}
+static void replay_glMultiTexCoord4dvARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glMultiTexCoord4dvARB(a0,a1);}
+static void replay_glMultiTexCoord1sv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLshort*>();if(replayer.isCorrupted())return;gl.glMultiTexCoord1sv(a0,a1);}
+static void replay_glUniform1ui64vNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLuint64EXT*>();if(replayer.isCorrupted())return;gl.glUniform1ui64vNV(a0,a1,a2);}
+static void replay_glGetClipPlanefOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glGetClipPlanefOES(a0,a1);}
+static void replay_glRasterPos2s(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLshort>();auto const a1=replayer.value<GLshort>();if(replayer.isCorrupted())return;gl.glRasterPos2s(a0,a1);}
+static void replay_glWeightivARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glWeightivARB(a0,a1);}
+static void replay_glMultiTexCoord4hvNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLhalfNV*>();if(replayer.isCorrupted())return;gl.glMultiTexCoord4hvNV(a0,a1);}
+static void replay_glNormal3hNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLhalfNV>();auto const a1=replayer.value<GLhalfNV>();auto const a2=replayer.value<GLhalfNV>();if(replayer.isCorrupted())return;gl.glNormal3hNV(a0,a1,a2);}
+static void replay_glGetSeparableFilter(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.output<GLvoid*>();auto const a4=replayer.output<GLvoid*>();auto const a5=replayer.output<GLvoid*>();if(replayer.isCorrupted())return;gl.glGetSeparableFilter(a0,a1,a2,a3,a4,a5);}
+static void replay_glGetPathTexGenivNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetPathTexGenivNV(a0,a1,a2);}
+static void replay_glColor4bv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLbyte*>();if(replayer.isCorrupted())return;gl.glColor4bv(a0);}
+static void replay_glRasterPos2f(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfloat>();auto const a1=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glRasterPos2f(a0,a1);}
+static void replay_glNamedBufferPageCommitmentARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLintptr>();auto const a2=replayer.value<GLsizeiptr>();auto const a3=replayer.value<GLboolean>();if(replayer.isCorrupted())return;gl.glNamedBufferPageCommitmentARB(a0,a1,a2,a3);}
+static void replay_glLoadIdentity(FunctionTable const&gl,CallReplayer&replayer){if(replayer.isCorrupted())return;gl.glLoadIdentity();}
+static void replay_glRasterPos2i(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glRasterPos2i(a0,a1);}
+static void replay_glRasterPos4iv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glRasterPos4iv(a0);}
+static void replay_glMultiTexCoord2fvARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glMultiTexCoord2fvARB(a0,a1);}
+static void replay_glUniformMatrix4x3fv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.value<GLboolean>();auto const a3=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glUniformMatrix4x3fv(a0,a1,a2,a3);}
+static void replay_glClearBufferfv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();auto const a2=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glClearBufferfv(a0,a1,a2);}
+static void replay_glMultiTexCoord4hNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLhalfNV>();auto const a2=replayer.value<GLhalfNV>();auto const a3=replayer.value<GLhalfNV>();auto const a4=replayer.value<GLhalfNV>();if(replayer.isCorrupted())return;gl.glMultiTexCoord4hNV(a0,a1,a2,a3,a4);}
+static void replay_glTextureBarrier(FunctionTable const&gl,CallReplayer&replayer){if(replayer.isCorrupted())return;gl.glTextureBarrier();}
+static void replay_glReplacementCodeuivSUN(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.null<const GLuint*>();if(replayer.isCorrupted())return;gl.glReplacementCodeuivSUN(a0);}
+static void replay_glDeleteAsyncMarkersSGIX(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glDeleteAsyncMarkersSGIX(a0,a1);}
+static void replay_glTexCoord2bvOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLbyte*>();if(replayer.isCorrupted())return;gl.glTexCoord2bvOES(a0);}
+static void replay_glEvalCoord2xOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfixed>();auto const a1=replayer.value<GLfixed>();if(replayer.isCorrupted())return;gl.glEvalCoord2xOES(a0,a1);}
+static void replay_glGetSharpenTexFuncSGIS(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glGetSharpenTexFuncSGIS(a0,a1);}
+static void replay_glProgramUniformHandleui64vNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.data<const GLuint64*>();if(replayer.isCorrupted())return;gl.glProgramUniformHandleui64vNV(a0,a1,a2,a3);}
+static void replay_glIglooInterfaceSGIX(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<const void*>();if(replayer.isCorrupted())return;gl.glIglooInterfaceSGIX(a0,a1);}
+static void replay_glWindowPos2dvARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glWindowPos2dvARB(a0);}
+static void replay_glClearBufferfi(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLfloat>();auto const a3=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glClearBufferfi(a0,a1,a2,a3);}
+static void replay_glDrawArraysIndirect(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<const void*>();if(replayer.isCorrupted())return;gl.glDrawArraysIndirect(a0,a1);}
+static void replay_glGenVertexArrays(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.output<GLuint*>();if(replayer.isCorrupted())return;gl.glGenVertexArrays(a0,a1);replayer.checkNames(a1);}
+static void replay_glGetTransformFeedbacki64_v(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.output<GLint64*>();if(replayer.isCorrupted())return;gl.glGetTransformFeedbacki64_v(a0,a1,a2,a3);}
+static void replay_glEnableVertexArrayAttrib(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glEnableVertexArrayAttrib(a0,a1);}
+static void replay_glProgramUniformMatrix3x2dv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLboolean>();auto const a4=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glProgramUniformMatrix3x2dv(a0,a1,a2,a3,a4);}
+static void replay_glVertexStream4fATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLfloat>();auto const a2=replayer.value<GLfloat>();auto const a3=replayer.value<GLfloat>();auto const a4=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glVertexStream4fATI(a0,a1,a2,a3,a4);}
+static void replay_glVertexBindingDivisor(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glVertexBindingDivisor(a0,a1);}
+static void replay_glGetSamplerParameterIiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetSamplerParameterIiv(a0,a1,a2);}
+static void replay_glGetCoverageModulationTableNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glGetCoverageModulationTableNV(a0,a1);}
+static void replay_glDepthRangedNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLdouble>();auto const a1=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glDepthRangedNV(a0,a1);}
+static void replay_glVertexAttrib3f(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLfloat>();auto const a2=replayer.value<GLfloat>();auto const a3=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glVertexAttrib3f(a0,a1,a2,a3);}
+static void replay_glMultiDrawRangeElementArrayAPPLE(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.data<const GLint*>();auto const a4=replayer.data<const GLsizei*>();auto const a5=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glMultiDrawRangeElementArrayAPPLE(a0,a1,a2,a3,a4,a5);}
+static void replay_glVertexAttribFormatNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLboolean>();auto const a4=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glVertexAttribFormatNV(a0,a1,a2,a3,a4);}
+static void replay_glGetQueryBufferObjecti64v(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLintptr>();if(replayer.isCorrupted())return;gl.glGetQueryBufferObjecti64v(a0,a1,a2,a3);}
+static void replay_glGetVertexAttribdv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLdouble*>();if(replayer.isCorrupted())return;gl.glGetVertexAttribdv(a0,a1,a2);}
+static void replay_glGetUniformi64vARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.output<GLint64*>();if(replayer.isCorrupted())return;gl.glGetUniformi64vARB(a0,a1,a2);}
+static void replay_glAreTexturesResidentEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.data<const GLuint*>();auto const a2=replayer.output<GLboolean*>();if(replayer.isCorrupted())return;gl.glAreTexturesResidentEXT(a0,a1,a2);}
+static void replay_glGetHandleARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glGetHandleARB(a0);}
+static void replay_glVideoCaptureStreamParameterdvNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.null<const GLdouble*>();if(replayer.isCorrupted())return;gl.glVideoCaptureStreamParameterdvNV(a0,a1,a2,a3);}
+static void replay_glMapParameterivNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.null<const GLint*>();if(replayer.isCorrupted())return;gl.glMapParameterivNV(a0,a1,a2);}
+static void replay_glIsVertexArray(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glIsVertexArray(a0);}
+static void replay_glSecondaryColor3sEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLshort>();auto const a1=replayer.value<GLshort>();auto const a2=replayer.value<GLshort>();if(replayer.isCorrupted())return;gl.glSecondaryColor3sEXT(a0,a1,a2);}
+static void replay_glGetTexParameterIivEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetTexParameterIivEXT(a0,a1,a2);}
+static void replay_glFrameTerminatorGREMEDY(FunctionTable const&gl,CallReplayer&replayer){if(replayer.isCorrupted())return;gl.glFrameTerminatorGREMEDY();}
+static void replay_glBlendBarrierKHR(FunctionTable const&gl,CallReplayer&replayer){if(replayer.isCorrupted())return;gl.glBlendBarrierKHR();}
+static void replay_glVertexAttrib4NubARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLubyte>();auto const a2=replayer.value<GLubyte>();auto const a3=replayer.value<GLubyte>();auto const a4=replayer.value<GLubyte>();if(replayer.isCorrupted())return;gl.glVertexAttrib4NubARB(a0,a1,a2,a3,a4);}
+static void replay_glPrimitiveRestartNV(FunctionTable const&gl,CallReplayer&replayer){if(replayer.isCorrupted())return;gl.glPrimitiveRestartNV();}
+static void replay_glVertexAttribL1ui64vARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLuint64EXT*>();if(replayer.isCorrupted())return;gl.glVertexAttribL1ui64vARB(a0,a1);}
+static void replay_glVertexAttribI4ivEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glVertexAttribI4ivEXT(a0,a1);}
+static void replay_glVertexAttribs4svNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLshort*>();if(replayer.isCorrupted())return;gl.glVertexAttribs4svNV(a0,a1,a2);}
+static void replay_glUniform1ui(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glUniform1ui(a0,a1);}
+static void replay_glVertexAttrib2fvARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glVertexAttrib2fvARB(a0,a1);}
+static void replay_glVertexAttribI4svEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLshort*>();if(replayer.isCorrupted())return;gl.glVertexAttribI4svEXT(a0,a1);}
+static void replay_glTextureImage3DMultisampleCoverageNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.value<GLint>();auto const a5=replayer.value<GLsizei>();auto const a6=replayer.value<GLsizei>();auto const a7=replayer.value<GLsizei>();auto const a8=replayer.value<GLboolean>();if(replayer.isCorrupted())return;gl.glTextureImage3DMultisampleCoverageNV(a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+static void replay_glMemoryBarrier(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLbitfield>();if(replayer.isCorrupted())return;gl.glMemoryBarrier(a0);}
+static void replay_glGetVariantArrayObjectfvATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glGetVariantArrayObjectfvATI(a0,a1,a2);}
+static void replay_glTexCoord4fColor4fNormal3fVertex4fvSUN(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLfloat*>();auto const a1=replayer.data<const GLfloat*>();auto const a2=replayer.data<const GLfloat*>();auto const a3=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glTexCoord4fColor4fNormal3fVertex4fvSUN(a0,a1,a2,a3);}
+static void replay_glIsProgramARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glIsProgramARB(a0);}
+static void replay_glBindImageTextureEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLboolean>();auto const a4=replayer.value<GLint>();auto const a5=replayer.value<GLenum>();auto const a6=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glBindImageTextureEXT(a0,a1,a2,a3,a4,a5,a6);}
+static void replay_glGetFragDataLocation(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLchar*>();if(replayer.isCorrupted())return;gl.glGetFragDataLocation(a0,a1);}
+static void replay_glMultiTexCoord1svARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLshort*>();if(replayer.isCorrupted())return;gl.glMultiTexCoord1svARB(a0,a1);}
+static void replay_glGetMapxvOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLfixed*>();if(replayer.isCorrupted())return;gl.glGetMapxvOES(a0,a1,a2);}
+static void replay_glTextureStorage2DMultisampleEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLenum>();auto const a4=replayer.value<GLsizei>();auto const a5=replayer.value<GLsizei>();auto const a6=replayer.value<GLboolean>();if(replayer.isCorrupted())return;gl.glTextureStorage2DMultisampleEXT(a0,a1,a2,a3,a4,a5,a6);}
+static void replay_glGetMaterialfv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glGetMaterialfv(a0,a1,a2);}
+static void replay_glVertexAttrib4NbvARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLbyte*>();if(replayer.isCorrupted())return;gl.glVertexAttrib4NbvARB(a0,a1);}
+static void replay_glPixelMapuiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.null<const GLuint*>();if(replayer.isCorrupted())return;gl.glPixelMapuiv(a0,a1,a2);}
+static void replay_glColorPointerEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.value<const void*>();if(replayer.isCorrupted())return;gl.glColorPointerEXT(a0,a1,a2,a3,a4);}
+static void replay_glEnableClientStateiEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glEnableClientStateiEXT(a0,a1);}
+static void replay_glClearTexSubImage(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLint>();auto const a5=replayer.value<GLsizei>();auto const a6=replayer.value<GLsizei>();auto const a7=replayer.value<GLsizei>();auto const a8=replayer.value<GLenum>();auto const a9=replayer.value<GLenum>();auto const a10=replayer.data<const void*>();if(replayer.isCorrupted())return;gl.glClearTexSubImage(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10);}
+static void replay_glEvalCoord1xvOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLfixed*>();if(replayer.isCorrupted())return;gl.glEvalCoord1xvOES(a0);}
+static void replay_glDetachObjectARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLhandleARB>();auto const a1=replayer.value<GLhandleARB>();if(replayer.isCorrupted())return;gl.glDetachObjectARB(a0,a1);}
+static void replay_glGetTextureParameterIiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetTextureParameterIiv(a0,a1,a2);}
+static void replay_glVariantusvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.null<const GLushort*>();if(replayer.isCorrupted())return;gl.glVariantusvEXT(a0,a1);}
+static void replay_glCompressedTextureImage3DEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLenum>();auto const a4=replayer.value<GLsizei>();auto const a5=replayer.value<GLsizei>();auto const a6=replayer.value<GLsizei>();auto const a7=replayer.value<GLint>();auto const a8=replayer.value<GLsizei>();auto const a9=replayer.pixels<const void*>();if(replayer.isCorrupted())return;gl.glCompressedTextureImage3DEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}
+static void replay_glMultiTexCoord1dARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glMultiTexCoord1dARB(a0,a1);}
+static void replay_glGetVertexArrayIntegeri_vEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetVertexArrayIntegeri_vEXT(a0,a1,a2,a3);}
+static void replay_glVertexAttribI4ubv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLubyte*>();if(replayer.isCorrupted())return;gl.glVertexAttribI4ubv(a0,a1);}
+static void replay_glPixelTexGenParameterfSGIS(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glPixelTexGenParameterfSGIS(a0,a1);}
+static void replay_glProgramUniformMatrix4x2dv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLboolean>();auto const a4=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glProgramUniformMatrix4x2dv(a0,a1,a2,a3,a4);}
+static void replay_glUniform3fARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLfloat>();auto const a2=replayer.value<GLfloat>();auto const a3=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glUniform3fARB(a0,a1,a2,a3);}
+static void replay_glIsShader(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glIsShader(a0);}
+static void replay_glConvolutionParameteriv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.null<const GLint*>();if(replayer.isCorrupted())return;gl.glConvolutionParameteriv(a0,a1,a2);}
+static void replay_glCopyMultiTexSubImage2DEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLint>();auto const a5=replayer.value<GLint>();auto const a6=replayer.value<GLint>();auto const a7=replayer.value<GLsizei>();auto const a8=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glCopyMultiTexSubImage2DEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+static void replay_glEnableVertexAttribArrayARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glEnableVertexAttribArrayARB(a0);}
+static void replay_glEnable(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glEnable(a0);}
+static void replay_glGetActiveUniformsiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLuint*>();auto const a3=replayer.value<GLenum>();auto const a4=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetActiveUniformsiv(a0,a1,a2,a3,a4);}
+static void replay_glGetVertexAttribivARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetVertexAttribivARB(a0,a1,a2);}
+static void replay_glTexCoord4hvNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLhalfNV*>();if(replayer.isCorrupted())return;gl.glTexCoord4hvNV(a0);}
+static void replay_glUseProgramObjectARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLhandleARB>();if(replayer.isCorrupted())return;gl.glUseProgramObjectARB(a0);}
+static void replay_glGetAttribLocation(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLchar*>();if(replayer.isCorrupted())return;gl.glGetAttribLocation(a0,a1);}
+static void replay_glVertexAttrib4dv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glVertexAttrib4dv(a0,a1);}
+static void replay_glGetTextureParameteriv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetTextureParameteriv(a0,a1,a2);}
+static void replay_glPathSubCoordsNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLenum>();auto const a4=replayer.value<const void*>();if(replayer.isCorrupted())return;gl.glPathSubCoordsNV(a0,a1,a2,a3,a4);}
+static void replay_glMatrixIndexusvARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.data<const GLushort*>();if(replayer.isCorrupted())return;gl.glMatrixIndexusvARB(a0,a1);}
+static void replay_glGetVideouivNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLuint*>();if(replayer.isCorrupted())return;gl.glGetVideouivNV(a0,a1,a2);}
+static void replay_glGetVideoCaptureivNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetVideoCaptureivNV(a0,a1,a2);}
+static void replay_glProgramUniform3ui(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<GLuint>();auto const a4=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glProgramUniform3ui(a0,a1,a2,a3,a4);}
+static void replay_glVertexAttrib3svARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLshort*>();if(replayer.isCorrupted())return;gl.glVertexAttrib3svARB(a0,a1);}
+static void replay_glGetNamedBufferParameterivEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetNamedBufferParameterivEXT(a0,a1,a2);}
+static void replay_glMatrixScaledEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLdouble>();auto const a2=replayer.value<GLdouble>();auto const a3=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glMatrixScaledEXT(a0,a1,a2,a3);}
+static void replay_glProgramUniformMatrix2x3fv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLboolean>();auto const a4=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glProgramUniformMatrix2x3fv(a0,a1,a2,a3,a4);}
+static void replay_glGetFragmentLightivSGIX(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetFragmentLightivSGIX(a0,a1,a2);}
+static void replay_glWindowPos2svARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLshort*>();if(replayer.isCorrupted())return;gl.glWindowPos2svARB(a0);}
+static void replay_glVertexAttrib2svNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLshort*>();if(replayer.isCorrupted())return;gl.glVertexAttrib2svNV(a0,a1);}
+static void replay_glWindowPos2ivARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glWindowPos2ivARB(a0);}
+static void replay_glGetVertexAttribPointervNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<void**>();if(replayer.isCorrupted())return;gl.glGetVertexAttribPointervNV(a0,a1,a2);}
+static void replay_glPushMatrix(FunctionTable const&gl,CallReplayer&replayer){if(replayer.isCorrupted())return;gl.glPushMatrix();}
+static void replay_glEdgeFlagPointerListIBM(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.null<const GLboolean**>();auto const a2=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glEdgeFlagPointerListIBM(a0,a1,a2);}
+static void replay_glGenerateMipmapEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glGenerateMipmapEXT(a0);}
+static void replay_glWindowPos3sv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLshort*>();if(replayer.isCorrupted())return;gl.glWindowPos3sv(a0);}
+static void replay_glPathCoordsNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<const void*>();if(replayer.isCorrupted())return;gl.glPathCoordsNV(a0,a1,a2,a3);}
+static void replay_glProgramUniform1i(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glProgramUniform1i(a0,a1,a2);}
+static void replay_glProgramUniform1d(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glProgramUniform1d(a0,a1,a2);}
+static void replay_glProgramUniform1f(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glProgramUniform1f(a0,a1,a2);}
+static void replay_glProgramParameteriEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glProgramParameteriEXT(a0,a1,a2);}
+static void replay_glCompressedMultiTexImage2DEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLenum>();auto const a4=replayer.value<GLsizei>();auto const a5=replayer.value<GLsizei>();auto const a6=replayer.value<GLint>();auto const a7=replayer.value<GLsizei>();auto const a8=replayer.pixels<const void*>();if(replayer.isCorrupted())return;gl.glCompressedMultiTexImage2DEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+static void replay_glProgramUniform3iv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glProgramUniform3iv(a0,a1,a2,a3);}
+static void replay_glIndexiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.null<const GLint*>();if(replayer.isCorrupted())return;gl.glIndexiv(a0);}
+static void replay_glMultiTexCoord4xvOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLfixed*>();if(replayer.isCorrupted())return;gl.glMultiTexCoord4xvOES(a0,a1);}
+static void replay_glEGLImageTargetTexture2DOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLeglImageOES>();if(replayer.isCorrupted())return;gl.glEGLImageTargetTexture2DOES(a0,a1);}
+static void replay_glPixelZoom(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfloat>();auto const a1=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glPixelZoom(a0,a1);}
+static void replay_glVertex3bvOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLbyte*>();if(replayer.isCorrupted())return;gl.glVertex3bvOES(a0);}
+static void replay_glFramebufferReadBufferEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glFramebufferReadBufferEXT(a0,a1);}
+static void replay_glExtractComponentEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glExtractComponentEXT(a0,a1,a2);}
+static void replay_glCombinerParameterivNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.null<const GLint*>();if(replayer.isCorrupted())return;gl.glCombinerParameterivNV(a0,a1);}
+static void replay_glMinmax(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLboolean>();if(replayer.isCorrupted())return;gl.glMinmax(a0,a1,a2);}
+static void replay_glGenBuffersARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.output<GLuint*>();if(replayer.isCorrupted())return;gl.glGenBuffersARB(a0,a1);replayer.checkNames(a1);}
+static void replay_glColor3usv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLushort*>();if(replayer.isCorrupted())return;gl.glColor3usv(a0);}
+static void replay_glBlendEquationi(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glBlendEquationi(a0,a1);}
+static void replay_glGetFogFuncSGIS(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glGetFogFuncSGIS(a0);}
+static void replay_glVertexAttrib4fvNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glVertexAttrib4fvNV(a0,a1);}
+static void replay_glGetnMinmax(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLboolean>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLenum>();auto const a4=replayer.value<GLsizei>();auto const a5=replayer.output<void*>();if(replayer.isCorrupted())return;gl.glGetnMinmax(a0,a1,a2,a3,a4,a5);}
+static void replay_glFragmentLightiSGIX(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glFragmentLightiSGIX(a0,a1,a2);}
+static void replay_glMultiTexCoord1bvOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLbyte*>();if(replayer.isCorrupted())return;gl.glMultiTexCoord1bvOES(a0,a1);}
+static void replay_glSecondaryColorPointerEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<const void*>();if(replayer.isCorrupted())return;gl.glSecondaryColorPointerEXT(a0,a1,a2,a3);}
+static void replay_glMultiTexCoordP4uiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glMultiTexCoordP4uiv(a0,a1,a2);}
+static void replay_glGetBufferSubDataARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLintptrARB>();auto const a2=replayer.value<GLsizeiptrARB>();auto const a3=replayer.output<void*>();if(replayer.isCorrupted())return;gl.glGetBufferSubDataARB(a0,a1,a2,a3);}
+static void replay_glGetPathParameterivNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetPathParameterivNV(a0,a1,a2);}
+static void replay_glFlushRasterSGIX(FunctionTable const&gl,CallReplayer&replayer){if(replayer.isCorrupted())return;gl.glFlushRasterSGIX();}
+static void replay_glElementPointerATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<const void*>();if(replayer.isCorrupted())return;gl.glElementPointerATI(a0,a1);}
+static void replay_glGetAttachedObjectsARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLhandleARB>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.output<GLsizei*>();auto const a3=replayer.output<GLhandleARB*>();if(replayer.isCorrupted())return;gl.glGetAttachedObjectsARB(a0,a1,a2,a3);}
+static void replay_glUniform4iv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glUniform4iv(a0,a1,a2);}
+static void replay_glFogxOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLfixed>();if(replayer.isCorrupted())return;gl.glFogxOES(a0,a1);}
+static void replay_glSharpenTexFuncSGIS(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glSharpenTexFuncSGIS(a0,a1,a2);}
+static void replay_glClearDepthfOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLclampf>();if(replayer.isCorrupted())return;gl.glClearDepthfOES(a0);}
+static void replay_glDeleteCommandListsNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glDeleteCommandListsNV(a0,a1);}
+static void replay_glVertex4hNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLhalfNV>();auto const a1=replayer.value<GLhalfNV>();auto const a2=replayer.value<GLhalfNV>();auto const a3=replayer.value<GLhalfNV>();if(replayer.isCorrupted())return;gl.glVertex4hNV(a0,a1,a2,a3);}
+static void replay_glSecondaryColor3dvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glSecondaryColor3dvEXT(a0);}
+static void replay_glGenTextures(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.output<GLuint*>();if(replayer.isCorrupted())return;gl.glGenTextures(a0,a1);replayer.checkNames(a1);}
+static void replay_glTextureStorage2DMultisample(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.value<GLsizei>();auto const a5=replayer.value<GLboolean>();if(replayer.isCorrupted())return;gl.glTextureStorage2DMultisample(a0,a1,a2,a3,a4,a5);}
+static void replay_glUniform3ui64vNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLuint64EXT*>();if(replayer.isCorrupted())return;gl.glUniform3ui64vNV(a0,a1,a2);}
+static void replay_glBlendFuncSeparateIndexedAMD(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLenum>();auto const a4=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glBlendFuncSeparateIndexedAMD(a0,a1,a2,a3,a4);}
+static void replay_glMakeBufferResidentNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glMakeBufferResidentNV(a0,a1);}
+static void replay_glShaderOp2EXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glShaderOp2EXT(a0,a1,a2,a3);}
+static void replay_glGetVertexAttribivNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetVertexAttribivNV(a0,a1,a2);}
+static void replay_glTexParameterIivEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glTexParameterIivEXT(a0,a1,a2);}
+static void replay_glGetPerfQueryDataINTEL(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.output<GLvoid*>();auto const a4=replayer.output<GLuint*>();if(replayer.isCorrupted())return;gl.glGetPerfQueryDataINTEL(a0,a1,a2,a3,a4);}
+static void replay_glVertexAttrib4dvARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glVertexAttrib4dvARB(a0,a1);}
+static void replay_glTextureSubImage1DEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLsizei>();auto const a5=replayer.value<GLenum>();auto const a6=replayer.value<GLenum>();auto const a7=replayer.pixels<const void*>();if(replayer.isCorrupted())return;gl.glTextureSubImage1DEXT(a0,a1,a2,a3,a4,a5,a6,a7);}
+static void replay_glGetActiveUniformBlockName(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.output<GLsizei*>();auto const a4=replayer.output<GLchar*>();if(replayer.isCorrupted())return;gl.glGetActiveUniformBlockName(a0,a1,a2,a3,a4);}
+static void replay_glVertexAttrib2dvARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glVertexAttrib2dvARB(a0,a1);}
+static void replay_glVertexAttribPointer(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLboolean>();auto const a4=replayer.value<GLsizei>();auto const a5=replayer.value<const void*>();if(replayer.isCorrupted())return;gl.glVertexAttribPointer(a0,a1,a2,a3,a4,a5);}
+static void replay_glDepthBoundsdNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLdouble>();auto const a1=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glDepthBoundsdNV(a0,a1);}
+static void replay_glDeleteTexturesEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glDeleteTexturesEXT(a0,a1);}
+static void replay_glDrawBuffersATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.data<const GLenum*>();if(replayer.isCorrupted())return;gl.glDrawBuffersATI(a0,a1);}
+static void replay_glLightModelxvOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.null<const GLfixed*>();if(replayer.isCorrupted())return;gl.glLightModelxvOES(a0,a1);}
+static void replay_glApplyTextureEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glApplyTextureEXT(a0);}
+static void replay_glGetImageHandleNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLboolean>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glGetImageHandleNV(a0,a1,a2,a3,a4);}
+static void replay_glGetMinmax(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLboolean>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLenum>();auto const a4=replayer.output<GLvoid*>();if(replayer.isCorrupted())return;gl.glGetMinmax(a0,a1,a2,a3,a4);}
+static void replay_glGetFixedvOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.output<GLfixed*>();if(replayer.isCorrupted())return;gl.glGetFixedvOES(a0,a1);}
+static void replay_glSamplePatternEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glSamplePatternEXT(a0);}
+static void replay_glUniform1f(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glUniform1f(a0,a1);}
+static void replay_glColor4fNormal3fVertex3fSUN(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfloat>();auto const a1=replayer.value<GLfloat>();auto const a2=replayer.value<GLfloat>();auto const a3=replayer.value<GLfloat>();auto const a4=replayer.value<GLfloat>();auto const a5=replayer.value<GLfloat>();auto const a6=replayer.value<GLfloat>();auto const a7=replayer.value<GLfloat>();auto const a8=replayer.value<GLfloat>();auto const a9=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glColor4fNormal3fVertex3fSUN(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}
+static void replay_glFogCoorddvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.null<const GLdouble*>();if(replayer.isCorrupted())return;gl.glFogCoorddvEXT(a0);}
+static void replay_glCopyTextureImage1DEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLenum>();auto const a4=replayer.value<GLint>();auto const a5=replayer.value<GLint>();auto const a6=replayer.value<GLsizei>();auto const a7=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glCopyTextureImage1DEXT(a0,a1,a2,a3,a4,a5,a6,a7);}
+static void replay_glFlushMappedBufferRangeAPPLE(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLintptr>();auto const a2=replayer.value<GLsizeiptr>();if(replayer.isCorrupted())return;gl.glFlushMappedBufferRangeAPPLE(a0,a1,a2);}
+static void replay_glVertex3sv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLshort*>();if(replayer.isCorrupted())return;gl.glVertex3sv(a0);}
+static void replay_glFlushStaticDataIBM(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glFlushStaticDataIBM(a0);}
+static void replay_glProgramUniform4ui64NV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLuint64EXT>();auto const a3=replayer.value<GLuint64EXT>();auto const a4=replayer.value<GLuint64EXT>();auto const a5=replayer.value<GLuint64EXT>();if(replayer.isCorrupted())return;gl.glProgramUniform4ui64NV(a0,a1,a2,a3,a4,a5);}
+static void replay_glRasterPos4xOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfixed>();auto const a1=replayer.value<GLfixed>();auto const a2=replayer.value<GLfixed>();auto const a3=replayer.value<GLfixed>();if(replayer.isCorrupted())return;gl.glRasterPos4xOES(a0,a1,a2,a3);}
+static void replay_glVertexAttribP1ui(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLboolean>();auto const a3=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glVertexAttribP1ui(a0,a1,a2,a3);}
+static void replay_glProgramUniform4dvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glProgramUniform4dvEXT(a0,a1,a2,a3);}
+static void replay_glEndTransformFeedbackEXT(FunctionTable const&gl,CallReplayer&replayer){if(replayer.isCorrupted())return;gl.glEndTransformFeedbackEXT();}
+static void replay_glBinormal3dEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLdouble>();auto const a1=replayer.value<GLdouble>();auto const a2=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glBinormal3dEXT(a0,a1,a2);}
+static void replay_glGetTextureSubImage(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLint>();auto const a5=replayer.value<GLsizei>();auto const a6=replayer.value<GLsizei>();auto const a7=replayer.value<GLsizei>();auto const a8=replayer.value<GLenum>();auto const a9=replayer.value<GLenum>();auto const a10=replayer.value<GLsizei>();auto const a11=replayer.output<void*>();if(replayer.isCorrupted())return;gl.glGetTextureSubImage(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11);}
+static void replay_glGetNamedRenderbufferParameteriv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetNamedRenderbufferParameteriv(a0,a1,a2);}
+static void replay_glBindBuffersRange(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.data<const GLuint*>();auto const a4=replayer.data<const GLintptr*>();auto const a5=replayer.data<const GLsizeiptr*>();if(replayer.isCorrupted())return;gl.glBindBuffersRange(a0,a1,a2,a3,a4,a5);}
+static void replay_glFinishAsyncSGIX(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.output<GLuint*>();if(replayer.isCorrupted())return;gl.glFinishAsyncSGIX(a0);}
+static void replay_glBindFragDataLocationIndexed(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.data<const GLchar*>();if(replayer.isCorrupted())return;gl.glBindFragDataLocationIndexed(a0,a1,a2,a3);}
+static void replay_glMultiTexCoord2dv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glMultiTexCoord2dv(a0,a1);}
+static void replay_glUniform2iv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glUniform2iv(a0,a1,a2);}
+static void replay_glProgramUniform2i64vNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.data<const GLint64EXT*>();if(replayer.isCorrupted())return;gl.glProgramUniform2i64vNV(a0,a1,a2,a3);}
+static void replay_glFlushVertexArrayRangeAPPLE(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.output<void*>();if(replayer.isCorrupted())return;gl.glFlushVertexArrayRangeAPPLE(a0,a1);}
+static void replay_glTextureParameterf(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glTextureParameterf(a0,a1,a2);}
+static void replay_glMultiTexCoord3dvARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glMultiTexCoord3dvARB(a0,a1);}
+static void replay_glFeedbackBuffer(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glFeedbackBuffer(a0,a1,a2);}
+static void replay_glDebugMessageInsertARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<GLenum>();auto const a4=replayer.value<GLsizei>();auto const a5=replayer.data<const GLchar*>();if(replayer.isCorrupted())return;gl.glDebugMessageInsertARB(a0,a1,a2,a3,a4,a5);}
+static void replay_glMultiTexCoord2i(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glMultiTexCoord2i(a0,a1,a2);}
+static void replay_glTextureSubImage3D(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLint>();auto const a5=replayer.value<GLsizei>();auto const a6=replayer.value<GLsizei>();auto const a7=replayer.value<GLsizei>();auto const a8=replayer.value<GLenum>();auto const a9=replayer.value<GLenum>();auto const a10=replayer.pixels<const void*>();if(replayer.isCorrupted())return;gl.glTextureSubImage3D(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10);}
+static void replay_glFramebufferTexture1D(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLuint>();auto const a4=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glFramebufferTexture1D(a0,a1,a2,a3,a4);}
+static void replay_glGetShaderiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetShaderiv(a0,a1,a2);}
+static void replay_glMultiTexCoord2d(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLdouble>();auto const a2=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glMultiTexCoord2d(a0,a1,a2);}
+static void replay_glArrayObjectATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.value<GLuint>();auto const a5=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glArrayObjectATI(a0,a1,a2,a3,a4,a5);}
+static void replay_glGetPointeri_vEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.output<void**>();if(replayer.isCorrupted())return;gl.glGetPointeri_vEXT(a0,a1,a2);}
+static void replay_glGetPerfMonitorCountersAMD(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.output<GLint*>();auto const a2=replayer.output<GLint*>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.output<GLuint*>();if(replayer.isCorrupted())return;gl.glGetPerfMonitorCountersAMD(a0,a1,a2,a3,a4);}
+static void replay_glNamedBufferStorage(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLsizeiptr>();auto const a2=replayer.data<const void*>();auto const a3=replayer.value<GLbitfield>();if(replayer.isCorrupted())return;gl.glNamedBufferStorage(a0,a1,a2,a3);}
+static void replay_glTexEnvxvOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.null<const GLfixed*>();if(replayer.isCorrupted())return;gl.glTexEnvxvOES(a0,a1,a2);}
+static void replay_glProgramUniform2ui64NV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLuint64EXT>();auto const a3=replayer.value<GLuint64EXT>();if(replayer.isCorrupted())return;gl.glProgramUniform2ui64NV(a0,a1,a2,a3);}
+static void replay_glMultiTexCoord3bOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLbyte>();auto const a2=replayer.value<GLbyte>();auto const a3=replayer.value<GLbyte>();if(replayer.isCorrupted())return;gl.glMultiTexCoord3bOES(a0,a1,a2,a3);}
+static void replay_glUniform1dv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glUniform1dv(a0,a1,a2);}
+static void replay_glPixelTransferi(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glPixelTransferi(a0,a1);}
+static void replay_glSecondaryColor3usvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLushort*>();if(replayer.isCorrupted())return;gl.glSecondaryColor3usvEXT(a0);}
+static void replay_glProgramEnvParameterI4uivNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glProgramEnvParameterI4uivNV(a0,a1,a2);}
+static void replay_glVertex2sv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLshort*>();if(replayer.isCorrupted())return;gl.glVertex2sv(a0);}
+static void replay_glWindowPos4dMESA(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLdouble>();auto const a1=replayer.value<GLdouble>();auto const a2=replayer.value<GLdouble>();auto const a3=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glWindowPos4dMESA(a0,a1,a2,a3);}
+static void replay_glDebugMessageControlARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.data<const GLuint*>();auto const a5=replayer.value<GLboolean>();if(replayer.isCorrupted())return;gl.glDebugMessageControlARB(a0,a1,a2,a3,a4,a5);}
+static void replay_glIsTextureEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glIsTextureEXT(a0);}
+static void replay_glFragmentMaterialivSGIX(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.null<const GLint*>();if(replayer.isCorrupted())return;gl.glFragmentMaterialivSGIX(a0,a1,a2);}
+static void replay_glLinkProgramARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLhandleARB>();if(replayer.isCorrupted())return;gl.glLinkProgramARB(a0);}
+static void replay_glFinishFenceAPPLE(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glFinishFenceAPPLE(a0);}
+static void replay_glVertexArrayVertexAttribBindingEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glVertexArrayVertexAttribBindingEXT(a0,a1,a2);}
+static void replay_glMultiTexCoord4fv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glMultiTexCoord4fv(a0,a1);}
+static void replay_glRasterPos3i(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glRasterPos3i(a0,a1,a2);}
+static void replay_glRasterPos3d(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLdouble>();auto const a1=replayer.value<GLdouble>();auto const a2=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glRasterPos3d(a0,a1,a2);}
+static void replay_glPollAsyncSGIX(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.output<GLuint*>();if(replayer.isCorrupted())return;gl.glPollAsyncSGIX(a0);}
+static void replay_glRasterPos3f(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfloat>();auto const a1=replayer.value<GLfloat>();auto const a2=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glRasterPos3f(a0,a1,a2);}
+static void replay_glCompressedTexImage3D(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.value<GLsizei>();auto const a5=replayer.value<GLsizei>();auto const a6=replayer.value<GLint>();auto const a7=replayer.value<GLsizei>();auto const a8=replayer.pixels<const GLvoid*>();if(replayer.isCorrupted())return;gl.glCompressedTexImage3D(a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+static void replay_glVariantivEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.null<const GLint*>();if(replayer.isCorrupted())return;gl.glVariantivEXT(a0,a1);}
+static void replay_glUnmapTexture2DINTEL(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glUnmapTexture2DINTEL(a0,a1);}
+static void replay_glGetVertexAttribiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetVertexAttribiv(a0,a1,a2);}
+static void replay_glGetPathCoordsNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glGetPathCoordsNV(a0,a1);}
+static void replay_glColor4xvOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLfixed*>();if(replayer.isCorrupted())return;gl.glColor4xvOES(a0);}
+static void replay_glVertexAttrib3fv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glVertexAttrib3fv(a0,a1);}
+static void replay_glRasterPos3s(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLshort>();auto const a1=replayer.value<GLshort>();auto const a2=replayer.value<GLshort>();if(replayer.isCorrupted())return;gl.glRasterPos3s(a0,a1,a2);}
+static void replay_glVertex4bOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLbyte>();auto const a1=replayer.value<GLbyte>();auto const a2=replayer.value<GLbyte>();auto const a3=replayer.value<GLbyte>();if(replayer.isCorrupted())return;gl.glVertex4bOES(a0,a1,a2,a3);}
+static void replay_glTransformFeedbackVaryingsEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLsizei>();auto const a2=(const GLchar*const*)replayer.strings();auto const a3=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glTransformFeedbackVaryingsEXT(a0,a1,a2,a3);}
+static void replay_glCombinerOutputNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLenum>();auto const a4=replayer.value<GLenum>();auto const a5=replayer.value<GLenum>();auto const a6=replayer.value<GLenum>();auto const a7=replayer.value<GLboolean>();auto const a8=replayer.value<GLboolean>();auto const a9=replayer.value<GLboolean>();if(replayer.isCorrupted())return;gl.glCombinerOutputNV(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}
+static void replay_glWindowPos4sMESA(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLshort>();auto const a1=replayer.value<GLshort>();auto const a2=replayer.value<GLshort>();auto const a3=replayer.value<GLshort>();if(replayer.isCorrupted())return;gl.glWindowPos4sMESA(a0,a1,a2,a3);}
+static void replay_glVertexAttrib4svARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLshort*>();if(replayer.isCorrupted())return;gl.glVertexAttrib4svARB(a0,a1);}
+static void replay_glIsList(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glIsList(a0);}
+static void replay_glGetInfoLogARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLhandleARB>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.output<GLsizei*>();auto const a3=replayer.output<GLcharARB*>();if(replayer.isCorrupted())return;gl.glGetInfoLogARB(a0,a1,a2,a3);}
+static void replay_glUniformMatrix2fv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.value<GLboolean>();auto const a3=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glUniformMatrix2fv(a0,a1,a2,a3);}
+static void replay_glVertexAttribs3dvNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glVertexAttribs3dvNV(a0,a1,a2);}
+static void replay_glGlobalAlphaFactorsSUN(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLshort>();if(replayer.isCorrupted())return;gl.glGlobalAlphaFactorsSUN(a0);}
+static void replay_glGetTrackMatrixivNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetTrackMatrixivNV(a0,a1,a2,a3);}
+static void replay_glTextureParameterfvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glTextureParameterfvEXT(a0,a1,a2,a3);}
+static void replay_glIsNamedBufferResidentNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glIsNamedBufferResidentNV(a0);}
+static void replay_glProgramUniform4ui64vARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.data<const GLuint64*>();if(replayer.isCorrupted())return;gl.glProgramUniform4ui64vARB(a0,a1,a2,a3);}
+static void replay_glTbufferMask3DFX(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glTbufferMask3DFX(a0);}
+static void replay_glCoverFillPathNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glCoverFillPathNV(a0,a1);}
+static void replay_glVertexAttrib1fvARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glVertexAttrib1fvARB(a0,a1);}
+static void replay_glGenerateTextureMipmap(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glGenerateTextureMipmap(a0);}
+static void replay_glNamedProgramLocalParameterI4uivEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glNamedProgramLocalParameterI4uivEXT(a0,a1,a2,a3);}
+static void replay_glMultiDrawElementsBaseVertex(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLsizei*>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.data<const void*const*>();auto const a4=replayer.value<GLsizei>();auto const a5=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glMultiDrawElementsBaseVertex(a0,a1,a2,a3,a4,a5);}
+static void replay_glProgramSubroutineParametersuivNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glProgramSubroutineParametersuivNV(a0,a1,a2);}
+static void replay_glProgramUniformMatrix2x4dvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLboolean>();auto const a4=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glProgramUniformMatrix2x4dvEXT(a0,a1,a2,a3,a4);}
+static void replay_glRotatexOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfixed>();auto const a1=replayer.value<GLfixed>();auto const a2=replayer.value<GLfixed>();auto const a3=replayer.value<GLfixed>();if(replayer.isCorrupted())return;gl.glRotatexOES(a0,a1,a2,a3);}
+static void replay_glMemoryBarrierEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLbitfield>();if(replayer.isCorrupted())return;gl.glMemoryBarrierEXT(a0);}
+static void replay_glVertexAttrib3svNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLshort*>();if(replayer.isCorrupted())return;gl.glVertexAttrib3svNV(a0,a1);}
+static void replay_glVertexStream3iATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glVertexStream3iATI(a0,a1,a2,a3);}
+static void replay_glCompressedTexSubImage1D(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.value<GLenum>();auto const a5=replayer.value<GLsizei>();auto const a6=replayer.pixels<const GLvoid*>();if(replayer.isCorrupted())return;gl.glCompressedTexSubImage1D(a0,a1,a2,a3,a4,a5,a6);}
+static void replay_glSetFenceNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glSetFenceNV(a0,a1);}
+static void replay_glAttachObjectARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLhandleARB>();auto const a1=replayer.value<GLhandleARB>();if(replayer.isCorrupted())return;gl.glAttachObjectARB(a0,a1);}
+static void replay_glCopyConvolutionFilter1D(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glCopyConvolutionFilter1D(a0,a1,a2,a3,a4);}
+static void replay_glProgramParameters4fvNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glProgramParameters4fvNV(a0,a1,a2,a3);}
+static void replay_glNamedFramebufferParameteriEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glNamedFramebufferParameteriEXT(a0,a1,a2);}
+static void replay_glVertexAttrib4Nsv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLshort*>();if(replayer.isCorrupted())return;gl.glVertexAttrib4Nsv(a0,a1);}
+static void replay_glVertexAttribI4usvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLushort*>();if(replayer.isCorrupted())return;gl.glVertexAttribI4usvEXT(a0,a1);}
+static void replay_glTextureBufferRangeEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLuint>();auto const a4=replayer.value<GLintptr>();auto const a5=replayer.value<GLsizeiptr>();if(replayer.isCorrupted())return;gl.glTextureBufferRangeEXT(a0,a1,a2,a3,a4,a5);}
+static void replay_glVertexP3uiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glVertexP3uiv(a0,a1);}
+static void replay_glIsPathNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glIsPathNV(a0);}
+static void replay_glGetnUniformi64vARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.output<GLint64*>();if(replayer.isCorrupted())return;gl.glGetnUniformi64vARB(a0,a1,a2,a3);}
+static void replay_glFramebufferTextureMultiviewOVR(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLint>();auto const a5=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glFramebufferTextureMultiviewOVR(a0,a1,a2,a3,a4,a5);}
+static void replay_glCompressedMultiTexSubImage2DEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLint>();auto const a5=replayer.value<GLsizei>();auto const a6=replayer.value<GLsizei>();auto const a7=replayer.value<GLenum>();auto const a8=replayer.value<GLsizei>();auto const a9=replayer.pixels<const void*>();if(replayer.isCorrupted())return;gl.glCompressedMultiTexSubImage2DEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}
+static void replay_glGetnMapdv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.output<GLdouble*>();if(replayer.isCorrupted())return;gl.glGetnMapdv(a0,a1,a2,a3);}
+static void replay_glDebugMessageCallback(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.null<GLDEBUGPROC>();auto const a1=replayer.value<const void*>();if(replayer.isCorrupted())return;gl.glDebugMessageCallback(a0,a1);}
+static void replay_glTangent3svEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLshort*>();if(replayer.isCorrupted())return;gl.glTangent3svEXT(a0);}
+static void replay_glVertexAttribParameteriAMD(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glVertexAttribParameteriAMD(a0,a1,a2);}
+static void replay_glBufferSubDataARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLintptrARB>();auto const a2=replayer.value<GLsizeiptrARB>();auto const a3=replayer.data<const void*>();if(replayer.isCorrupted())return;gl.glBufferSubDataARB(a0,a1,a2,a3);}
+static void replay_glGetVertexAttribLui64vARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLuint64EXT*>();if(replayer.isCorrupted())return;gl.glGetVertexAttribLui64vARB(a0,a1,a2);}
+static void replay_glVertexAttribL4ui64NV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint64EXT>();auto const a2=replayer.value<GLuint64EXT>();auto const a3=replayer.value<GLuint64EXT>();auto const a4=replayer.value<GLuint64EXT>();if(replayer.isCorrupted())return;gl.glVertexAttribL4ui64NV(a0,a1,a2,a3,a4);}
+static void replay_glReplacementCodeuiColor4ubVertex3fSUN(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLubyte>();auto const a2=replayer.value<GLubyte>();auto const a3=replayer.value<GLubyte>();auto const a4=replayer.value<GLubyte>();auto const a5=replayer.value<GLfloat>();auto const a6=replayer.value<GLfloat>();auto const a7=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glReplacementCodeuiColor4ubVertex3fSUN(a0,a1,a2,a3,a4,a5,a6,a7);}
+static void replay_glImageTransformParameterfHP(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glImageTransformParameterfHP(a0,a1,a2);}
+static void replay_glMap1f(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLfloat>();auto const a2=replayer.value<GLfloat>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLint>();auto const a5=replayer.null<const GLfloat*>();if(replayer.isCorrupted())return;gl.glMap1f(a0,a1,a2,a3,a4,a5);}
+static void replay_glRasterPos4fv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glRasterPos4fv(a0);}
+static void replay_glVertex2bvOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLbyte*>();if(replayer.isCorrupted())return;gl.glVertex2bvOES(a0);}
+static void replay_glGetMapControlPointsNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.value<GLsizei>();auto const a5=replayer.value<GLboolean>();auto const a6=replayer.output<void*>();if(replayer.isCorrupted())return;gl.glGetMapControlPointsNV(a0,a1,a2,a3,a4,a5,a6);}
+static void replay_glNamedProgramLocalParametersI4ivEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glNamedProgramLocalParametersI4ivEXT(a0,a1,a2,a3,a4);}
+static void replay_glBindBufferRangeNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<GLintptr>();auto const a4=replayer.value<GLsizeiptr>();if(replayer.isCorrupted())return;gl.glBindBufferRangeNV(a0,a1,a2,a3,a4);}
+static void replay_glVertexStream3dvATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glVertexStream3dvATI(a0,a1);}
+static void replay_glNormalPointerListIBM(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<const void**>();auto const a3=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glNormalPointerListIBM(a0,a1,a2,a3);}
+static void replay_glFogFuncSGIS(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glFogFuncSGIS(a0,a1);}
+static void replay_glMultiModeDrawArraysIBM(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLenum*>();auto const a1=replayer.data<const GLint*>();auto const a2=replayer.data<const GLsizei*>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glMultiModeDrawArraysIBM(a0,a1,a2,a3,a4);}
+static void replay_glGetNamedFramebufferAttachmentParameterivEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetNamedFramebufferAttachmentParameterivEXT(a0,a1,a2,a3);}
+static void replay_glGetFloatv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glGetFloatv(a0,a1);}
+static void replay_glVertexArrayVertexAttribIFormatEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLenum>();auto const a4=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glVertexArrayVertexAttribIFormatEXT(a0,a1,a2,a3,a4);}
+static void replay_glHint(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glHint(a0,a1);}
+static void replay_glPointAlongPathNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLfloat>();auto const a4=replayer.output<GLfloat*>();auto const a5=replayer.output<GLfloat*>();auto const a6=replayer.output<GLfloat*>();auto const a7=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glPointAlongPathNV(a0,a1,a2,a3,a4,a5,a6,a7);}
+static void replay_glVertexStream2svATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLshort*>();if(replayer.isCorrupted())return;gl.glVertexStream2svATI(a0,a1);}
+static void replay_glMultiDrawArraysIndirect(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<const void*>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glMultiDrawArraysIndirect(a0,a1,a2,a3);}
+static void replay_glVertexAttribP2uiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLboolean>();auto const a3=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glVertexAttribP2uiv(a0,a1,a2,a3);}
+static void replay_glProgramUniform1i64vARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.data<const GLint64*>();if(replayer.isCorrupted())return;gl.glProgramUniform1i64vARB(a0,a1,a2,a3);}
+static void replay_glFramebufferTextureARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glFramebufferTextureARB(a0,a1,a2,a3);}
+static void replay_glPushClientAttribDefaultEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLbitfield>();if(replayer.isCorrupted())return;gl.glPushClientAttribDefaultEXT(a0);}
+static void replay_glScalef(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfloat>();auto const a1=replayer.value<GLfloat>();auto const a2=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glScalef(a0,a1,a2);}
+static void replay_glScaled(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLdouble>();auto const a1=replayer.value<GLdouble>();auto const a2=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glScaled(a0,a1,a2);}
+static void replay_glGetConvolutionParameterxvOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLfixed*>();if(replayer.isCorrupted())return;gl.glGetConvolutionParameterxvOES(a0,a1,a2);}
+static void replay_glGetProgramResourceName(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.output<GLsizei*>();auto const a5=replayer.output<GLchar*>();if(replayer.isCorrupted())return;gl.glGetProgramResourceName(a0,a1,a2,a3,a4,a5);}
+static void replay_glCopyColorTable(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glCopyColorTable(a0,a1,a2,a3,a4);}
+static void replay_glDepthRangeArrayv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glDepthRangeArrayv(a0,a1,a2);}
+static void replay_glCoverFillPathInstancedNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<const void*>();auto const a3=replayer.value<GLuint>();auto const a4=replayer.value<GLenum>();auto const a5=replayer.value<GLenum>();auto const a6=replayer.null<const GLfloat*>();if(replayer.isCorrupted())return;gl.glCoverFillPathInstancedNV(a0,a1,a2,a3,a4,a5,a6);}
+static void replay_glMultiTexParameterivEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glMultiTexParameterivEXT(a0,a1,a2,a3);}
+static void replay_glGetActiveAtomicCounterBufferiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetActiveAtomicCounterBufferiv(a0,a1,a2,a3);}
+static void replay_glStencilOpSeparate(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glStencilOpSeparate(a0,a1,a2,a3);}
+static void replay_glVertexAttrib4fNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLfloat>();auto const a2=replayer.value<GLfloat>();auto const a3=replayer.value<GLfloat>();auto const a4=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glVertexAttrib4fNV(a0,a1,a2,a3,a4);}
+static void replay_glGetColorTableParameterivSGI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetColorTableParameterivSGI(a0,a1,a2);}
+static void replay_glVertexArrayAttribBinding(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glVertexArrayAttribBinding(a0,a1,a2);}
+static void replay_glProgramParameters4dvNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glProgramParameters4dvNV(a0,a1,a2,a3);}
+static void replay_glVertexAttribL4dv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glVertexAttribL4dv(a0,a1);}
+static void replay_glVertexStream3dATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLdouble>();auto const a2=replayer.value<GLdouble>();auto const a3=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glVertexStream3dATI(a0,a1,a2,a3);}
+static void replay_glGetUniformOffsetEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glGetUniformOffsetEXT(a0,a1);}
+static void replay_glGetVertexAttribPointerv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<void**>();if(replayer.isCorrupted())return;gl.glGetVertexAttribPointerv(a0,a1,a2);}
+static void replay_glProgramUniform3i64vNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.data<const GLint64EXT*>();if(replayer.isCorrupted())return;gl.glProgramUniform3i64vNV(a0,a1,a2,a3);}
+static void replay_glTangent3fEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfloat>();auto const a1=replayer.value<GLfloat>();auto const a2=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glTangent3fEXT(a0,a1,a2);}
+static void replay_glGetPathMetricRangeNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLbitfield>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glGetPathMetricRangeNV(a0,a1,a2,a3,a4);}
+static void replay_glWindowPos2iMESA(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glWindowPos2iMESA(a0,a1);}
+static void replay_glVertex2xvOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLfixed*>();if(replayer.isCorrupted())return;gl.glVertex2xvOES(a0);}
+static void replay_glGetnCompressedTexImage(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.output<void*>();if(replayer.isCorrupted())return;gl.glGetnCompressedTexImage(a0,a1,a2,a3);}
+static void replay_glWindowPos2dv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glWindowPos2dv(a0);}
+static void replay_glReplacementCodeuiVertex3fSUN(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLfloat>();auto const a2=replayer.value<GLfloat>();auto const a3=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glReplacementCodeuiVertex3fSUN(a0,a1,a2,a3);}
+static void replay_glGetTransformFeedbackVaryingEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.output<GLsizei*>();auto const a4=replayer.output<GLsizei*>();auto const a5=replayer.output<GLenum*>();auto const a6=replayer.output<GLchar*>();if(replayer.isCorrupted())return;gl.glGetTransformFeedbackVaryingEXT(a0,a1,a2,a3,a4,a5,a6);}
+static void replay_glWindowPos3fARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfloat>();auto const a1=replayer.value<GLfloat>();auto const a2=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glWindowPos3fARB(a0,a1,a2);}
+static void replay_glMapNamedBufferEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();if(replayer.isCorrupted())return;auto const result=gl.glMapNamedBufferEXT(a0,a1);replayer.mapResult(result);}
+static void replay_glDisable(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glDisable(a0);}
+static void replay_glIsPointInFillPathNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLfloat>();auto const a3=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glIsPointInFillPathNV(a0,a1,a2,a3);}
+static void replay_glVertexAttribI2uiEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glVertexAttribI2uiEXT(a0,a1,a2);}
+static void replay_glProgramUniform4uiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glProgramUniform4uiv(a0,a1,a2,a3);}
+static void replay_glQueryCounter(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glQueryCounter(a0,a1);}
+static void replay_glFramebufferRenderbufferEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glFramebufferRenderbufferEXT(a0,a1,a2,a3);}
+static void replay_glBinormal3svEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLshort*>();if(replayer.isCorrupted())return;gl.glBinormal3svEXT(a0);}
+static void replay_glBindBufferOffsetNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<GLintptr>();if(replayer.isCorrupted())return;gl.glBindBufferOffsetNV(a0,a1,a2,a3);}
+static void replay_glCopyTextureSubImage2D(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLint>();auto const a5=replayer.value<GLint>();auto const a6=replayer.value<GLsizei>();auto const a7=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glCopyTextureSubImage2D(a0,a1,a2,a3,a4,a5,a6,a7);}
+static void replay_glGetProgramResourcefvNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.data<const GLenum*>();auto const a5=replayer.value<GLsizei>();auto const a6=replayer.output<GLsizei*>();auto const a7=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glGetProgramResourcefvNV(a0,a1,a2,a3,a4,a5,a6,a7);}
+static void replay_glBinormalPointerEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.value<const void*>();if(replayer.isCorrupted())return;gl.glBinormalPointerEXT(a0,a1,a2);}
+static void replay_glGetLightfv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glGetLightfv(a0,a1,a2);}
+static void replay_glVertex2bOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLbyte>();auto const a1=replayer.value<GLbyte>();if(replayer.isCorrupted())return;gl.glVertex2bOES(a0,a1);}
+static void replay_glUniform2ivARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glUniform2ivARB(a0,a1,a2);}
+static void replay_glMultiTexCoord3s(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLshort>();auto const a2=replayer.value<GLshort>();auto const a3=replayer.value<GLshort>();if(replayer.isCorrupted())return;gl.glMultiTexCoord3s(a0,a1,a2,a3);}
+static void replay_glGetHistogramParameterfvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glGetHistogramParameterfvEXT(a0,a1,a2);}
+static void replay_glGetProgramStringNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLubyte*>();if(replayer.isCorrupted())return;gl.glGetProgramStringNV(a0,a1,a2);}
+static void replay_glGetTexGenxvOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLfixed*>();if(replayer.isCorrupted())return;gl.glGetTexGenxvOES(a0,a1,a2);}
+static void replay_glTextureSubImage2D(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLsizei>();auto const a5=replayer.value<GLsizei>();auto const a6=replayer.value<GLenum>();auto const a7=replayer.value<GLenum>();auto const a8=replayer.pixels<const void*>();if(replayer.isCorrupted())return;gl.glTextureSubImage2D(a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+static void replay_glObjectPurgeableAPPLE(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glObjectPurgeableAPPLE(a0,a1,a2);}
+static void replay_glColorTableSGI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLenum>();auto const a4=replayer.value<GLenum>();auto const a5=replayer.value<const void*>();if(replayer.isCorrupted())return;gl.glColorTableSGI(a0,a1,a2,a3,a4,a5);}
+static void replay_glCopyConvolutionFilter2DEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLsizei>();auto const a5=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glCopyConvolutionFilter2DEXT(a0,a1,a2,a3,a4,a5);}
+static void replay_glMultiTexCoord3f(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLfloat>();auto const a2=replayer.value<GLfloat>();auto const a3=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glMultiTexCoord3f(a0,a1,a2,a3);}
+static void replay_glMultiTexCoord3d(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLdouble>();auto const a2=replayer.value<GLdouble>();auto const a3=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glMultiTexCoord3d(a0,a1,a2,a3);}
+static void replay_glFogCoorddv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.null<const GLdouble*>();if(replayer.isCorrupted())return;gl.glFogCoorddv(a0);}
+static void replay_glGetBufferPointerv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<void**>();if(replayer.isCorrupted())return;gl.glGetBufferPointerv(a0,a1,a2);}
+static void replay_glProgramUniform1fEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glProgramUniform1fEXT(a0,a1,a2);}
+static void replay_glWindowPos2fvMESA(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glWindowPos2fvMESA(a0);}
+static void replay_glPolygonOffsetxOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfixed>();auto const a1=replayer.value<GLfixed>();if(replayer.isCorrupted())return;gl.glPolygonOffsetxOES(a0,a1);}
+static void replay_glVertexAttrib4dARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLdouble>();auto const a2=replayer.value<GLdouble>();auto const a3=replayer.value<GLdouble>();auto const a4=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glVertexAttrib4dARB(a0,a1,a2,a3,a4);}
+static void replay_glUniformHandleui64vARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLuint64*>();if(replayer.isCorrupted())return;gl.glUniformHandleui64vARB(a0,a1,a2);}
+static void replay_glFragmentLightModelfvSGIX(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.null<const GLfloat*>();if(replayer.isCorrupted())return;gl.glFragmentLightModelfvSGIX(a0,a1);}
+static void replay_glSwizzleEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLenum>();auto const a4=replayer.value<GLenum>();auto const a5=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glSwizzleEXT(a0,a1,a2,a3,a4,a5);}
+static void replay_glBindFragmentShaderATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glBindFragmentShaderATI(a0);}
+static void replay_glVertexAttribs3hvNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLhalfNV*>();if(replayer.isCorrupted())return;gl.glVertexAttribs3hvNV(a0,a1,a2);}
+static void replay_glColorP3ui(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glColorP3ui(a0,a1);}
+static void replay_glListParameterfvSGIX(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.null<const GLfloat*>();if(replayer.isCorrupted())return;gl.glListParameterfvSGIX(a0,a1,a2);}
+static void replay_glNamedRenderbufferStorageMultisample(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glNamedRenderbufferStorageMultisample(a0,a1,a2,a3,a4);}
+static void replay_glVertexAttribI1iEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glVertexAttribI1iEXT(a0,a1);}
+static void replay_glMultiTexCoord2ivARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glMultiTexCoord2ivARB(a0,a1);}
+static void replay_glLightModelxOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLfixed>();if(replayer.isCorrupted())return;gl.glLightModelxOES(a0,a1);}
+static void replay_glColor3xOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfixed>();auto const a1=replayer.value<GLfixed>();auto const a2=replayer.value<GLfixed>();if(replayer.isCorrupted())return;gl.glColor3xOES(a0,a1,a2);}
+static void replay_glReadBuffer(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glReadBuffer(a0);}
+static void replay_glStencilFillPathInstancedNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<const void*>();auto const a3=replayer.value<GLuint>();auto const a4=replayer.value<GLenum>();auto const a5=replayer.value<GLuint>();auto const a6=replayer.value<GLenum>();auto const a7=replayer.null<const GLfloat*>();if(replayer.isCorrupted())return;gl.glStencilFillPathInstancedNV(a0,a1,a2,a3,a4,a5,a6,a7);}
+static void replay_glVDPAUUnmapSurfacesNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.null<const GLvdpauSurfaceNV*>();if(replayer.isCorrupted())return;gl.glVDPAUUnmapSurfacesNV(a0,a1);}
+static void replay_glProgramUniform4i64NV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint64EXT>();auto const a3=replayer.value<GLint64EXT>();auto const a4=replayer.value<GLint64EXT>();auto const a5=replayer.value<GLint64EXT>();if(replayer.isCorrupted())return;gl.glProgramUniform4i64NV(a0,a1,a2,a3,a4,a5);}
+static void replay_glVertexStream4dvATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glVertexStream4dvATI(a0,a1);}
+static void replay_glIsQuery(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glIsQuery(a0);}
+static void replay_glProgramUniformMatrix4fvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLboolean>();auto const a4=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glProgramUniformMatrix4fvEXT(a0,a1,a2,a3,a4);}
+static void replay_glVertexAttrib3hNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLhalfNV>();auto const a2=replayer.value<GLhalfNV>();auto const a3=replayer.value<GLhalfNV>();if(replayer.isCorrupted())return;gl.glVertexAttrib3hNV(a0,a1,a2,a3);}
+static void replay_glFlushMappedNamedBufferRange(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLintptr>();auto const a2=replayer.value<GLsizeiptr>();if(replayer.isCorrupted())return;gl.glFlushMappedNamedBufferRange(a0,a1,a2);}
+static void replay_glPushName(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glPushName(a0);}
+static void replay_glGetClipPlane(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.output<GLdouble*>();if(replayer.isCorrupted())return;gl.glGetClipPlane(a0,a1);}
+static void replay_glVertex4dv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glVertex4dv(a0);}
+static void replay_glVertexAttrib3d(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLdouble>();auto const a2=replayer.value<GLdouble>();auto const a3=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glVertexAttrib3d(a0,a1,a2,a3);}
+static void replay_glBlendColor(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfloat>();auto const a1=replayer.value<GLfloat>();auto const a2=replayer.value<GLfloat>();auto const a3=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glBlendColor(a0,a1,a2,a3);}
+static void replay_glBindTransformFeedbackNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glBindTransformFeedbackNV(a0,a1);}
+static void replay_glSamplerParameterIuiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glSamplerParameterIuiv(a0,a1,a2);}
+static void replay_glIndexubv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.null<const GLubyte*>();if(replayer.isCorrupted())return;gl.glIndexubv(a0);}
+static void replay_glNamedBufferPageCommitmentEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLintptr>();auto const a2=replayer.value<GLsizeiptr>();auto const a3=replayer.value<GLboolean>();if(replayer.isCorrupted())return;gl.glNamedBufferPageCommitmentEXT(a0,a1,a2,a3);}
+static void replay_glCheckNamedFramebufferStatus(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glCheckNamedFramebufferStatus(a0,a1);}
+static void replay_glGetObjectBufferfvATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glGetObjectBufferfvATI(a0,a1,a2);}
+static void replay_glRasterPos4d(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLdouble>();auto const a1=replayer.value<GLdouble>();auto const a2=replayer.value<GLdouble>();auto const a3=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glRasterPos4d(a0,a1,a2,a3);}
+static void replay_glRasterPos4f(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfloat>();auto const a1=replayer.value<GLfloat>();auto const a2=replayer.value<GLfloat>();auto const a3=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glRasterPos4f(a0,a1,a2,a3);}
+static void replay_glGetPerfMonitorCounterStringAMD(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.output<GLsizei*>();auto const a4=replayer.output<GLchar*>();if(replayer.isCorrupted())return;gl.glGetPerfMonitorCounterStringAMD(a0,a1,a2,a3,a4);}
+static void replay_glVertexAttrib3s(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLshort>();auto const a2=replayer.value<GLshort>();auto const a3=replayer.value<GLshort>();if(replayer.isCorrupted())return;gl.glVertexAttrib3s(a0,a1,a2,a3);}
+static void replay_glDrawElementsInstancedEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<const void*>();auto const a4=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glDrawElementsInstancedEXT(a0,a1,a2,a3,a4);}
+static void replay_glNamedProgramLocalParameterI4iEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLint>();auto const a5=replayer.value<GLint>();auto const a6=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glNamedProgramLocalParameterI4iEXT(a0,a1,a2,a3,a4,a5,a6);}
+static void replay_glRasterPos4s(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLshort>();auto const a1=replayer.value<GLshort>();auto const a2=replayer.value<GLshort>();auto const a3=replayer.value<GLshort>();if(replayer.isCorrupted())return;gl.glRasterPos4s(a0,a1,a2,a3);}
+static void replay_glGetProgramStageiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetProgramStageiv(a0,a1,a2,a3);}
+static void replay_glGetMaterialxOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLfixed>();if(replayer.isCorrupted())return;gl.glGetMaterialxOES(a0,a1,a2);}
+static void replay_glPopMatrix(FunctionTable const&gl,CallReplayer&replayer){if(replayer.isCorrupted())return;gl.glPopMatrix();}
+static void replay_glGetVideoui64vNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLuint64EXT*>();if(replayer.isCorrupted())return;gl.glGetVideoui64vNV(a0,a1,a2);}
+static void replay_glTangent3bEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLbyte>();auto const a1=replayer.value<GLbyte>();auto const a2=replayer.value<GLbyte>();if(replayer.isCorrupted())return;gl.glTangent3bEXT(a0,a1,a2);}
+static void replay_glGetGraphicsResetStatusARB(FunctionTable const&gl,CallReplayer&replayer){if(replayer.isCorrupted())return;gl.glGetGraphicsResetStatusARB();}
+static void replay_glUniform4i(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glUniform4i(a0,a1,a2,a3,a4);}
+static void replay_glActiveTexture(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glActiveTexture(a0);}
+static void replay_glEnableVertexAttribArray(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glEnableVertexAttribArray(a0);}
+static void replay_glTexCoord4fVertex4fvSUN(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLfloat*>();auto const a1=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glTexCoord4fVertex4fvSUN(a0,a1);}
+static void replay_glUniform4d(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLdouble>();auto const a2=replayer.value<GLdouble>();auto const a3=replayer.value<GLdouble>();auto const a4=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glUniform4d(a0,a1,a2,a3,a4);}
+static void replay_glUniform4f(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLfloat>();auto const a2=replayer.value<GLfloat>();auto const a3=replayer.value<GLfloat>();auto const a4=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glUniform4f(a0,a1,a2,a3,a4);}
+static void replay_glRenderbufferStorageMultisample(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glRenderbufferStorageMultisample(a0,a1,a2,a3,a4);}
+static void replay_glCreateProgramPipelines(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.output<GLuint*>();if(replayer.isCorrupted())return;gl.glCreateProgramPipelines(a0,a1);replayer.checkNames(a1);}
+static void replay_glVertexAttribLPointer(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.value<const void*>();if(replayer.isCorrupted())return;gl.glVertexAttribLPointer(a0,a1,a2,a3,a4);}
+static void replay_glUniform2uiEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glUniform2uiEXT(a0,a1,a2);}
+static void replay_glMultiTexCoord3sv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLshort*>();if(replayer.isCorrupted())return;gl.glMultiTexCoord3sv(a0,a1);}
+static void replay_glDrawElementsInstancedBaseVertex(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<const void*>();auto const a4=replayer.value<GLsizei>();auto const a5=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glDrawElementsInstancedBaseVertex(a0,a1,a2,a3,a4,a5);}
+static void replay_glPixelTransformParameterfvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.null<const GLfloat*>();if(replayer.isCorrupted())return;gl.glPixelTransformParameterfvEXT(a0,a1,a2);}
+static void replay_glDrawTransformFeedbackNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glDrawTransformFeedbackNV(a0,a1);}
+static void replay_glTextureImage2DMultisampleCoverageNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.value<GLint>();auto const a5=replayer.value<GLsizei>();auto const a6=replayer.value<GLsizei>();auto const a7=replayer.value<GLboolean>();if(replayer.isCorrupted())return;gl.glTextureImage2DMultisampleCoverageNV(a0,a1,a2,a3,a4,a5,a6,a7);}
+static void replay_glNamedRenderbufferStorageMultisampleCoverageEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLenum>();auto const a4=replayer.value<GLsizei>();auto const a5=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glNamedRenderbufferStorageMultisampleCoverageEXT(a0,a1,a2,a3,a4,a5);}
+static void replay_glIsTexture(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glIsTexture(a0);}
+static void replay_glMultiTexCoord4iv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glMultiTexCoord4iv(a0,a1);}
+static void replay_glTexEnvfv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.null<const GLfloat*>();if(replayer.isCorrupted())return;gl.glTexEnvfv(a0,a1,a2);}
+static void replay_glPopDebugGroup(FunctionTable const&gl,CallReplayer&replayer){if(replayer.isCorrupted())return;gl.glPopDebugGroup();}
+static void replay_glUniformBlockBinding(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glUniformBlockBinding(a0,a1,a2);}
+static void replay_glWindowPos2svMESA(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLshort*>();if(replayer.isCorrupted())return;gl.glWindowPos2svMESA(a0);}
+static void replay_glGenerateTextureMipmapEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glGenerateTextureMipmapEXT(a0,a1);}
+static void replay_glBindLightParameterEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glBindLightParameterEXT(a0,a1);}
+static void replay_glTexCoord3bOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLbyte>();auto const a1=replayer.value<GLbyte>();auto const a2=replayer.value<GLbyte>();if(replayer.isCorrupted())return;gl.glTexCoord3bOES(a0,a1,a2);}
+static void replay_glTexCoordPointer(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<const GLvoid*>();if(replayer.isCorrupted())return;gl.glTexCoordPointer(a0,a1,a2,a3);}
+static void replay_glProgramUniformMatrix3x2fv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLboolean>();auto const a4=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glProgramUniformMatrix3x2fv(a0,a1,a2,a3,a4);}
+static void replay_glUniform2fvARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glUniform2fvARB(a0,a1,a2);}
+static void replay_glProgramLocalParameterI4uivNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glProgramLocalParameterI4uivNV(a0,a1,a2);}
+static void replay_glFlushVertexArrayRangeNV(FunctionTable const&gl,CallReplayer&replayer){if(replayer.isCorrupted())return;gl.glFlushVertexArrayRangeNV();}
+static void replay_glSecondaryColor3svEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLshort*>();if(replayer.isCorrupted())return;gl.glSecondaryColor3svEXT(a0);}
+static void replay_glGetBufferParameteriv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetBufferParameteriv(a0,a1,a2);}
+static void replay_glGetQueryIndexediv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetQueryIndexediv(a0,a1,a2,a3);}
+static void replay_glFramebufferTexture3DEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLuint>();auto const a4=replayer.value<GLint>();auto const a5=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glFramebufferTexture3DEXT(a0,a1,a2,a3,a4,a5);}
+static void replay_glLoadTransposeMatrixxOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLfixed*>();if(replayer.isCorrupted())return;gl.glLoadTransposeMatrixxOES(a0);}
+static void replay_glDeleteTransformFeedbacksNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glDeleteTransformFeedbacksNV(a0,a1);}
+static void replay_glGetCompressedTextureImageEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLint>();auto const a3=replayer.output<void*>();if(replayer.isCorrupted())return;gl.glGetCompressedTextureImageEXT(a0,a1,a2,a3);}
+static void replay_glIndexMaterialEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glIndexMaterialEXT(a0,a1);}
+static void replay_glFogCoorddEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glFogCoorddEXT(a0);}
+static void replay_glTexCoord2hvNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLhalfNV*>();if(replayer.isCorrupted())return;gl.glTexCoord2hvNV(a0);}
+static void replay_glFramebufferTexture2DEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLuint>();auto const a4=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glFramebufferTexture2DEXT(a0,a1,a2,a3,a4);}
+static void replay_glTexEnviv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.null<const GLint*>();if(replayer.isCorrupted())return;gl.glTexEnviv(a0,a1,a2);}
+static void replay_glEndTransformFeedbackNV(FunctionTable const&gl,CallReplayer&replayer){if(replayer.isCorrupted())return;gl.glEndTransformFeedbackNV();}
+static void replay_glGlobalAlphaFactoruiSUN(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glGlobalAlphaFactoruiSUN(a0);}
+static void replay_glSelectBuffer(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.output<GLuint*>();if(replayer.isCorrupted())return;gl.glSelectBuffer(a0,a1);}
+static void replay_glNamedBufferSubDataEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLintptr>();auto const a2=replayer.value<GLsizeiptr>();auto const a3=replayer.data<const void*>();if(replayer.isCorrupted())return;gl.glNamedBufferSubDataEXT(a0,a1,a2,a3);}
+static void replay_glDisableVertexArrayAttrib(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glDisableVertexArrayAttrib(a0,a1);}
+static void replay_glBlendFunc(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glBlendFunc(a0,a1);}
+static void replay_glCreateProgram(FunctionTable const&gl,CallReplayer&replayer){if(replayer.isCorrupted())return;auto const result=gl.glCreateProgram();replayer.checkName(result);}
+static void replay_glVertexStream2dATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLdouble>();auto const a2=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glVertexStream2dATI(a0,a1,a2);}
+static void replay_glUniform4ui64vARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLuint64*>();if(replayer.isCorrupted())return;gl.glUniform4ui64vARB(a0,a1,a2);}
+static void replay_glPrimitiveRestartIndex(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glPrimitiveRestartIndex(a0);}
+static void replay_glNormalStream3fATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLfloat>();auto const a2=replayer.value<GLfloat>();auto const a3=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glNormalStream3fATI(a0,a1,a2,a3);}
+static void replay_glProgramUniformMatrix2fv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLboolean>();auto const a4=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glProgramUniformMatrix2fv(a0,a1,a2,a3,a4);}
+static void replay_glVertexAttribs1hvNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLhalfNV*>();if(replayer.isCorrupted())return;gl.glVertexAttribs1hvNV(a0,a1,a2);}
+static void replay_glWindowPos4svMESA(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLshort*>();if(replayer.isCorrupted())return;gl.glWindowPos4svMESA(a0);}
+static void replay_glDeleteFragmentShaderATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glDeleteFragmentShaderATI(a0);}
+static void replay_glBindImageTextures(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glBindImageTextures(a0,a1,a2);}
+static void replay_glMap2xOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLfixed>();auto const a2=replayer.value<GLfixed>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLint>();auto const a5=replayer.value<GLfixed>();auto const a6=replayer.value<GLfixed>();auto const a7=replayer.value<GLint>();auto const a8=replayer.value<GLint>();auto const a9=replayer.value<GLfixed>();if(replayer.isCorrupted())return;gl.glMap2xOES(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}
+static void replay_glEnd(FunctionTable const&gl,CallReplayer&replayer){if(replayer.isCorrupted())return;gl.glEnd();}
+static void replay_glMultiTexCoord2dARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLdouble>();auto const a2=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glMultiTexCoord2dARB(a0,a1,a2);}
+static void replay_glUniform1i64NV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLint64EXT>();if(replayer.isCorrupted())return;gl.glUniform1i64NV(a0,a1);}
+static void replay_glPathStringNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<const void*>();if(replayer.isCorrupted())return;gl.glPathStringNV(a0,a1,a2,a3);}
+static void replay_glGetNamedFramebufferParameterivEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetNamedFramebufferParameterivEXT(a0,a1,a2);}
+static void replay_glGetProgramNamedParameterdvNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.null<const GLubyte*>();auto const a3=replayer.output<GLdouble*>();if(replayer.isCorrupted())return;gl.glGetProgramNamedParameterdvNV(a0,a1,a2,a3);}
+static void replay_glPathDashArrayNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.null<const GLfloat*>();if(replayer.isCorrupted())return;gl.glPathDashArrayNV(a0,a1,a2);}
+static void replay_glUniform3uiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glUniform3uiv(a0,a1,a2);}
+static void replay_glColor3fVertex3fvSUN(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLfloat*>();auto const a1=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glColor3fVertex3fvSUN(a0,a1);}
+static void replay_glMultTransposeMatrixd(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glMultTransposeMatrixd(a0);}
+static void replay_glClearColor(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLclampf>();auto const a1=replayer.value<GLclampf>();auto const a2=replayer.value<GLclampf>();auto const a3=replayer.value<GLclampf>();if(replayer.isCorrupted())return;gl.glClearColor(a0,a1,a2,a3);}
+static void replay_glGetImageHandleARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLboolean>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glGetImageHandleARB(a0,a1,a2,a3,a4);}
+static void replay_glTangent3dEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLdouble>();auto const a1=replayer.value<GLdouble>();auto const a2=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glTangent3dEXT(a0,a1,a2);}
+static void replay_glGetQueryObjectivARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetQueryObjectivARB(a0,a1,a2);}
+static void replay_glGetLocalConstantFloatvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glGetLocalConstantFloatvEXT(a0,a1,a2);}
+static void replay_glUseShaderProgramEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glUseShaderProgramEXT(a0,a1);}
+static void replay_glBindRenderbufferEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glBindRenderbufferEXT(a0,a1);}
+static void replay_glInterleavedArrays(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.value<const GLvoid*>();if(replayer.isCorrupted())return;gl.glInterleavedArrays(a0,a1,a2);}
+static void replay_glGetPerfMonitorGroupStringAMD(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.output<GLsizei*>();auto const a3=replayer.output<GLchar*>();if(replayer.isCorrupted())return;gl.glGetPerfMonitorGroupStringAMD(a0,a1,a2,a3);}
+static void replay_glUniform3ui(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glUniform3ui(a0,a1,a2,a3);}
+static void replay_glGetNamedProgramLocalParameterdvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.output<GLdouble*>();if(replayer.isCorrupted())return;gl.glGetNamedProgramLocalParameterdvEXT(a0,a1,a2,a3);}
+static void replay_glSecondaryColor3us(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLushort>();auto const a1=replayer.value<GLushort>();auto const a2=replayer.value<GLushort>();if(replayer.isCorrupted())return;gl.glSecondaryColor3us(a0,a1,a2);}
+static void replay_glVertexAttribI4uiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glVertexAttribI4uiv(a0,a1);}
+static void replay_glVertexAttrib4bv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLbyte*>();if(replayer.isCorrupted())return;gl.glVertexAttrib4bv(a0,a1);}
+static void replay_glMultiTexCoord3xOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLfixed>();auto const a2=replayer.value<GLfixed>();auto const a3=replayer.value<GLfixed>();if(replayer.isCorrupted())return;gl.glMultiTexCoord3xOES(a0,a1,a2,a3);}
+static void replay_glSecondaryColor3ub(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLubyte>();auto const a1=replayer.value<GLubyte>();auto const a2=replayer.value<GLubyte>();if(replayer.isCorrupted())return;gl.glSecondaryColor3ub(a0,a1,a2);}
+static void replay_glFragmentMaterialfSGIX(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glFragmentMaterialfSGIX(a0,a1,a2);}
+static void replay_glGetVariantArrayObjectivATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetVariantArrayObjectivATI(a0,a1,a2);}
+static void replay_glSecondaryColor3ui(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glSecondaryColor3ui(a0,a1,a2);}
+static void replay_glVertexAttrib1dARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glVertexAttrib1dARB(a0,a1);}
+static void replay_glGetNamedBufferPointerv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<void**>();if(replayer.isCorrupted())return;gl.glGetNamedBufferPointerv(a0,a1,a2);}
+static void replay_glLockArraysEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glLockArraysEXT(a0,a1);}
+static void replay_glVertexAttribPointerNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.value<const void*>();if(replayer.isCorrupted())return;gl.glVertexAttribPointerNV(a0,a1,a2,a3,a4);}
+static void replay_glConvolutionParameterf(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glConvolutionParameterf(a0,a1,a2);}
+static void replay_glBindBufferBaseEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glBindBufferBaseEXT(a0,a1,a2);}
+static void replay_glTexCoord2xvOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLfixed*>();if(replayer.isCorrupted())return;gl.glTexCoord2xvOES(a0);}
+static void replay_glGetQueryBufferObjectui64v(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLintptr>();if(replayer.isCorrupted())return;gl.glGetQueryBufferObjectui64v(a0,a1,a2,a3);}
+static void replay_glSetMultisamplefvAMD(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.null<const GLfloat*>();if(replayer.isCorrupted())return;gl.glSetMultisamplefvAMD(a0,a1,a2);}
+static void replay_glPathColorGenNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.null<const GLfloat*>();if(replayer.isCorrupted())return;gl.glPathColorGenNV(a0,a1,a2,a3);}
+static void replay_glVertexAttrib3sARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLshort>();auto const a2=replayer.value<GLshort>();auto const a3=replayer.value<GLshort>();if(replayer.isCorrupted())return;gl.glVertexAttrib3sARB(a0,a1,a2,a3);}
+static void replay_glVertexAttrib4ivARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glVertexAttrib4ivARB(a0,a1);}
+static void replay_glGenTransformFeedbacks(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.output<GLuint*>();if(replayer.isCorrupted())return;gl.glGenTransformFeedbacks(a0,a1);replayer.checkNames(a1);}
+static void replay_glGetVertexAttribIuiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLuint*>();if(replayer.isCorrupted())return;gl.glGetVertexAttribIuiv(a0,a1,a2);}
+static void replay_glPixelTransformParameterfEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glPixelTransformParameterfEXT(a0,a1,a2);}
+static void replay_glGetTexParameterIuivEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLuint*>();if(replayer.isCorrupted())return;gl.glGetTexParameterIuivEXT(a0,a1,a2);}
+static void replay_glGetObjectParameterivARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLhandleARB>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetObjectParameterivARB(a0,a1,a2);}
+static void replay_glVertexArraySecondaryColorOffsetEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLenum>();auto const a4=replayer.value<GLsizei>();auto const a5=replayer.value<GLintptr>();if(replayer.isCorrupted())return;gl.glVertexArraySecondaryColorOffsetEXT(a0,a1,a2,a3,a4,a5);}
+static void replay_glWindowPos2fARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfloat>();auto const a1=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glWindowPos2fARB(a0,a1);}
+static void replay_glCompressedTexSubImage2D(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLsizei>();auto const a5=replayer.value<GLsizei>();auto const a6=replayer.value<GLenum>();auto const a7=replayer.value<GLsizei>();auto const a8=replayer.pixels<const GLvoid*>();if(replayer.isCorrupted())return;gl.glCompressedTexSubImage2D(a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+static void replay_glCompressedTexSubImage3DARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLint>();auto const a5=replayer.value<GLsizei>();auto const a6=replayer.value<GLsizei>();auto const a7=replayer.value<GLsizei>();auto const a8=replayer.value<GLenum>();auto const a9=replayer.value<GLsizei>();auto const a10=replayer.value<const void*>();if(replayer.isCorrupted())return;gl.glCompressedTexSubImage3DARB(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10);}
+static void replay_glProgramBinary(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.data<const void*>();auto const a3=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glProgramBinary(a0,a1,a2,a3);}
+static void replay_glPresentFrameKeyedNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint64EXT>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<GLuint>();auto const a4=replayer.value<GLenum>();auto const a5=replayer.value<GLenum>();auto const a6=replayer.value<GLuint>();auto const a7=replayer.value<GLuint>();auto const a8=replayer.value<GLenum>();auto const a9=replayer.value<GLuint>();auto const a10=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glPresentFrameKeyedNV(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10);}
+static void replay_glVertexAttribI4bv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLbyte*>();if(replayer.isCorrupted())return;gl.glVertexAttribI4bv(a0,a1);}
+static void replay_glPathCoverDepthFuncNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glPathCoverDepthFuncNV(a0);}
+static void replay_glTransformFeedbackStreamAttribsNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.data<const GLint*>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.data<const GLint*>();auto const a4=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glTransformFeedbackStreamAttribsNV(a0,a1,a2,a3,a4);}
+static void replay_glSecondaryColor3usEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLushort>();auto const a1=replayer.value<GLushort>();auto const a2=replayer.value<GLushort>();if(replayer.isCorrupted())return;gl.glSecondaryColor3usEXT(a0,a1,a2);}
+static void replay_glCopyColorTableSGI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glCopyColorTableSGI(a0,a1,a2,a3,a4);}
+static void replay_glProgramEnvParameter4fvARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glProgramEnvParameter4fvARB(a0,a1,a2);}
+static void replay_glMultiTexCoord4sARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLshort>();auto const a2=replayer.value<GLshort>();auto const a3=replayer.value<GLshort>();auto const a4=replayer.value<GLshort>();if(replayer.isCorrupted())return;gl.glMultiTexCoord4sARB(a0,a1,a2,a3,a4);}
+static void replay_glGetVertexArrayIndexed64iv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.output<GLint64*>();if(replayer.isCorrupted())return;gl.glGetVertexArrayIndexed64iv(a0,a1,a2,a3);}
+static void replay_glMatrixMultTranspose3x3fNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glMatrixMultTranspose3x3fNV(a0,a1);}
+static void replay_glTexParameterIiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glTexParameterIiv(a0,a1,a2);}
+static void replay_glVertexArrayAttribFormat(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLenum>();auto const a4=replayer.value<GLboolean>();auto const a5=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glVertexArrayAttribFormat(a0,a1,a2,a3,a4,a5);}
+static void replay_glEndTransformFeedback(FunctionTable const&gl,CallReplayer&replayer){if(replayer.isCorrupted())return;gl.glEndTransformFeedback();}
+static void replay_glDrawCommandsStatesAddressNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLuint64*>();auto const a1=replayer.data<const GLsizei*>();auto const a2=replayer.data<const GLuint*>();auto const a3=replayer.data<const GLuint*>();auto const a4=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glDrawCommandsStatesAddressNV(a0,a1,a2,a3,a4);}
+static void replay_glUniform4ui64NV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLuint64EXT>();auto const a2=replayer.value<GLuint64EXT>();auto const a3=replayer.value<GLuint64EXT>();auto const a4=replayer.value<GLuint64EXT>();if(replayer.isCorrupted())return;gl.glUniform4ui64NV(a0,a1,a2,a3,a4);}
+static void replay_glMaterialiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.null<const GLint*>();if(replayer.isCorrupted())return;gl.glMaterialiv(a0,a1,a2);}
+static void replay_glTexImage2DMultisample(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.value<GLsizei>();auto const a5=replayer.value<GLboolean>();if(replayer.isCorrupted())return;gl.glTexImage2DMultisample(a0,a1,a2,a3,a4,a5);}
+static void replay_glBindTextureEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glBindTextureEXT(a0,a1);}
+static void replay_glIsBuffer(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glIsBuffer(a0);}
+static void replay_glVertexAttribI1iv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glVertexAttribI1iv(a0,a1);}
+static void replay_glGetFinalCombinerInputParameterfvNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glGetFinalCombinerInputParameterfvNV(a0,a1,a2);}
+static void replay_glMultiTexCoord3bvOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLbyte*>();if(replayer.isCorrupted())return;gl.glMultiTexCoord3bvOES(a0,a1);}
+static void replay_glVertexAttribDivisor(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glVertexAttribDivisor(a0,a1);}
+static void replay_glCopyBufferSubData(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLintptr>();auto const a3=replayer.value<GLintptr>();auto const a4=replayer.value<GLsizeiptr>();if(replayer.isCorrupted())return;gl.glCopyBufferSubData(a0,a1,a2,a3,a4);}
+static void replay_glBindTexGenParameterEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glBindTexGenParameterEXT(a0,a1,a2);}
+static void replay_glNormalStream3bATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLbyte>();auto const a2=replayer.value<GLbyte>();auto const a3=replayer.value<GLbyte>();if(replayer.isCorrupted())return;gl.glNormalStream3bATI(a0,a1,a2,a3);}
+static void replay_glTextureImage2DEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLsizei>();auto const a5=replayer.value<GLsizei>();auto const a6=replayer.value<GLint>();auto const a7=replayer.value<GLenum>();auto const a8=replayer.value<GLenum>();auto const a9=replayer.pixels<const void*>();if(replayer.isCorrupted())return;gl.glTextureImage2DEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}
+static void replay_glGetColorTableParameteriv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetColorTableParameteriv(a0,a1,a2);}
+static void replay_glActiveTextureARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glActiveTextureARB(a0);}
+static void replay_glTexCoord4xOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfixed>();auto const a1=replayer.value<GLfixed>();auto const a2=replayer.value<GLfixed>();auto const a3=replayer.value<GLfixed>();if(replayer.isCorrupted())return;gl.glTexCoord4xOES(a0,a1,a2,a3);}
+static void replay_glSecondaryColor3fvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glSecondaryColor3fvEXT(a0);}
+static void replay_glUniformMatrix4x2fv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.value<GLboolean>();auto const a3=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glUniformMatrix4x2fv(a0,a1,a2,a3);}
+static void replay_glStartInstrumentsSGIX(FunctionTable const&gl,CallReplayer&replayer){if(replayer.isCorrupted())return;gl.glStartInstrumentsSGIX();}
+static void replay_glProgramNamedParameter4fvNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLubyte*>();auto const a3=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glProgramNamedParameter4fvNV(a0,a1,a2,a3);}
+static void replay_glEndVideoCaptureNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glEndVideoCaptureNV(a0);}
+static void replay_glGenLists(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glGenLists(a0);}
+static void replay_glUniform1fARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glUniform1fARB(a0,a1);}
+static void replay_glNamedFramebufferTexture1DEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLuint>();auto const a4=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glNamedFramebufferTexture1DEXT(a0,a1,a2,a3,a4);}
+static void replay_glMapBufferRange(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLintptr>();auto const a2=replayer.value<GLsizeiptr>();auto const a3=replayer.value<GLbitfield>();if(replayer.isCorrupted())return;auto const result=gl.glMapBufferRange(a0,a1,a2,a3);replayer.mapResult(result);}
+static void replay_glMultiDrawElementsIndirectCountARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLintptr>();auto const a3=replayer.value<GLintptr>();auto const a4=replayer.value<GLsizei>();auto const a5=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glMultiDrawElementsIndirectCountARB(a0,a1,a2,a3,a4,a5);}
+static void replay_glProgramUniformMatrix4x2fv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLboolean>();auto const a4=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glProgramUniformMatrix4x2fv(a0,a1,a2,a3,a4);}
+static void replay_glGetTextureParameterIivEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetTextureParameterIivEXT(a0,a1,a2,a3);}
+static void replay_glMultiTexCoord3hNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLhalfNV>();auto const a2=replayer.value<GLhalfNV>();auto const a3=replayer.value<GLhalfNV>();if(replayer.isCorrupted())return;gl.glMultiTexCoord3hNV(a0,a1,a2,a3);}
+static void replay_glNamedProgramLocalParametersI4uivEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glNamedProgramLocalParametersI4uivEXT(a0,a1,a2,a3,a4);}
+static void replay_glEndList(FunctionTable const&gl,CallReplayer&replayer){if(replayer.isCorrupted())return;gl.glEndList();}
+static void replay_glTexCoord2fColor4fNormal3fVertex3fSUN(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfloat>();auto const a1=replayer.value<GLfloat>();auto const a2=replayer.value<GLfloat>();auto const a3=replayer.value<GLfloat>();auto const a4=replayer.value<GLfloat>();auto const a5=replayer.value<GLfloat>();auto const a6=replayer.value<GLfloat>();auto const a7=replayer.value<GLfloat>();auto const a8=replayer.value<GLfloat>();auto const a9=replayer.value<GLfloat>();auto const a10=replayer.value<GLfloat>();auto const a11=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glTexCoord2fColor4fNormal3fVertex3fSUN(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11);}
+static void replay_glGenTransformFeedbacksNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.output<GLuint*>();if(replayer.isCorrupted())return;gl.glGenTransformFeedbacksNV(a0,a1);replayer.checkNames(a1);}
+static void replay_glEdgeFlagv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.null<const GLboolean*>();if(replayer.isCorrupted())return;gl.glEdgeFlagv(a0);}
+static void replay_glVertexAttribI2iv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glVertexAttribI2iv(a0,a1);}
+static void replay_glCopyMultiTexImage2DEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLenum>();auto const a4=replayer.value<GLint>();auto const a5=replayer.value<GLint>();auto const a6=replayer.value<GLsizei>();auto const a7=replayer.value<GLsizei>();auto const a8=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glCopyMultiTexImage2DEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+static void replay_glUniformMatrix3x2dv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.value<GLboolean>();auto const a3=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glUniformMatrix3x2dv(a0,a1,a2,a3);}
+static void replay_glTexImage3DMultisampleCoverageNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLsizei>();auto const a5=replayer.value<GLsizei>();auto const a6=replayer.value<GLsizei>();auto const a7=replayer.value<GLboolean>();if(replayer.isCorrupted())return;gl.glTexImage3DMultisampleCoverageNV(a0,a1,a2,a3,a4,a5,a6,a7);}
+static void replay_glGetShaderPrecisionFormat(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLint*>();auto const a3=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetShaderPrecisionFormat(a0,a1,a2,a3);}
+static void replay_glTexSubImage4DSGIS(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLint>();auto const a5=replayer.value<GLint>();auto const a6=replayer.value<GLsizei>();auto const a7=replayer.value<GLsizei>();auto const a8=replayer.value<GLsizei>();auto const a9=replayer.value<GLsizei>();auto const a10=replayer.value<GLenum>();auto const a11=replayer.value<GLenum>();auto const a12=replayer.value<const void*>();if(replayer.isCorrupted())return;gl.glTexSubImage4DSGIS(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12);}
+static void replay_glRasterSamplesEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLboolean>();if(replayer.isCorrupted())return;gl.glRasterSamplesEXT(a0,a1);}
+static void replay_glTextureView(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<GLenum>();auto const a4=replayer.value<GLuint>();auto const a5=replayer.value<GLuint>();auto const a6=replayer.value<GLuint>();auto const a7=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glTextureView(a0,a1,a2,a3,a4,a5,a6,a7);}
+static void replay_glEvalMapsNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glEvalMapsNV(a0,a1);}
+static void replay_glGetFragDataLocationEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLchar*>();if(replayer.isCorrupted())return;gl.glGetFragDataLocationEXT(a0,a1);}
+static void replay_glGetCompressedMultiTexImageEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLint>();auto const a3=replayer.output<void*>();if(replayer.isCorrupted())return;gl.glGetCompressedMultiTexImageEXT(a0,a1,a2,a3);}
+static void replay_glIndexMask(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glIndexMask(a0);}
+static void replay_glPushClientAttrib(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLbitfield>();if(replayer.isCorrupted())return;gl.glPushClientAttrib(a0);}
+static void replay_glShaderSource(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLsizei>();auto const a2=(const GLchar*const*)replayer.strings();auto const a3=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glShaderSource(a0,a1,a2,a3);}
+static void replay_glDispatchComputeGroupSizeARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<GLuint>();auto const a4=replayer.value<GLuint>();auto const a5=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glDispatchComputeGroupSizeARB(a0,a1,a2,a3,a4,a5);}
+static void replay_glGetnPixelMapfv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glGetnPixelMapfv(a0,a1,a2);}
+static void replay_glTexCoordP2uiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLuint*>();if(replayer.isCorrupted())return;gl.glTexCoordP2uiv(a0,a1);}
+static void replay_glUniform2f(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLfloat>();auto const a2=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glUniform2f(a0,a1,a2);}
+static void replay_glGetNamedBufferParameteri64v(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLint64*>();if(replayer.isCorrupted())return;gl.glGetNamedBufferParameteri64v(a0,a1,a2);}
+static void replay_glCommandListSegmentsNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glCommandListSegmentsNV(a0,a1);}
+static void replay_glTextureParameterIivEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glTextureParameterIivEXT(a0,a1,a2,a3);}
+static void replay_glMultiTexParameterfvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glMultiTexParameterfvEXT(a0,a1,a2,a3);}
+static void replay_glProgramUniform2ui64ARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLuint64>();auto const a3=replayer.value<GLuint64>();if(replayer.isCorrupted())return;gl.glProgramUniform2ui64ARB(a0,a1,a2,a3);}
+static void replay_glVertex4d(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLdouble>();auto const a1=replayer.value<GLdouble>();auto const a2=replayer.value<GLdouble>();auto const a3=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glVertex4d(a0,a1,a2,a3);}
+static void replay_glNewObjectBufferATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.value<const void*>();auto const a2=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glNewObjectBufferATI(a0,a1,a2);}
+static void replay_glViewportSwizzleNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLenum>();auto const a4=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glViewportSwizzleNV(a0,a1,a2,a3,a4);}
+static void replay_glBufferData(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLsizeiptr>();auto const a2=replayer.data<const void*>();auto const a3=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glBufferData(a0,a1,a2,a3);}
+static void replay_glTextureImage1DEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLsizei>();auto const a5=replayer.value<GLint>();auto const a6=replayer.value<GLenum>();auto const a7=replayer.value<GLenum>();auto const a8=replayer.pixels<const void*>();if(replayer.isCorrupted())return;gl.glTextureImage1DEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+static void replay_glGetTexParameterIiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetTexParameterIiv(a0,a1,a2);}
+static void replay_glCopyTexSubImage1DEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLint>();auto const a5=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glCopyTexSubImage1DEXT(a0,a1,a2,a3,a4,a5);}
+static void replay_glVertex4f(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfloat>();auto const a1=replayer.value<GLfloat>();auto const a2=replayer.value<GLfloat>();auto const a3=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glVertex4f(a0,a1,a2,a3);}
+static void replay_glUniformMatrix3fvARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.value<GLboolean>();auto const a3=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glUniformMatrix3fvARB(a0,a1,a2,a3);}
+static void replay_glTexCoordP1ui(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glTexCoordP1ui(a0,a1);}
+static void replay_glPointParameterfvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.null<const GLfloat*>();if(replayer.isCorrupted())return;gl.glPointParameterfvEXT(a0,a1);}
+static void replay_glUniform4fARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLfloat>();auto const a2=replayer.value<GLfloat>();auto const a3=replayer.value<GLfloat>();auto const a4=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glUniform4fARB(a0,a1,a2,a3,a4);}
+static void replay_glCopyTextureSubImage3D(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLint>();auto const a5=replayer.value<GLint>();auto const a6=replayer.value<GLint>();auto const a7=replayer.value<GLsizei>();auto const a8=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glCopyTextureSubImage3D(a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+static void replay_glMultiTexCoord2fv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glMultiTexCoord2fv(a0,a1);}
+static void replay_glMultiTexEnvfvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.null<const GLfloat*>();if(replayer.isCorrupted())return;gl.glMultiTexEnvfvEXT(a0,a1,a2,a3);}
+static void replay_glNormalP3ui(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glNormalP3ui(a0,a1);}
+static void replay_glDrawRangeElementArrayATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glDrawRangeElementArrayATI(a0,a1,a2,a3);}
+static void replay_glVertexAttribI1i(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glVertexAttribI1i(a0,a1);}
+static void replay_glDrawArraysInstancedARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glDrawArraysInstancedARB(a0,a1,a2,a3);}
+static void replay_glEnableVertexAttribAPPLE(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glEnableVertexAttribAPPLE(a0,a1);}
+static void replay_glGetDebugMessageLogARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.output<GLenum*>();auto const a3=replayer.output<GLenum*>();auto const a4=replayer.output<GLuint*>();auto const a5=replayer.output<GLenum*>();auto const a6=replayer.output<GLsizei*>();auto const a7=replayer.output<GLchar*>();if(replayer.isCorrupted())return;gl.glGetDebugMessageLogARB(a0,a1,a2,a3,a4,a5,a6,a7);}
+static void replay_glGetPathTexGenfvNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLfloat*>();if(replayer.isCorrupted())return;gl.glGetPathTexGenfvNV(a0,a1,a2);}
+static void replay_glNamedProgramLocalParameters4fvEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLuint>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glNamedProgramLocalParameters4fvEXT(a0,a1,a2,a3,a4);}
+static void replay_glVertexStream3fvATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glVertexStream3fvATI(a0,a1);}
+static void replay_glFramebufferTexture3D(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLuint>();auto const a4=replayer.value<GLint>();auto const a5=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glFramebufferTexture3D(a0,a1,a2,a3,a4,a5);}
+static void replay_glCompressedTextureSubImage2DEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLint>();auto const a5=replayer.value<GLsizei>();auto const a6=replayer.value<GLsizei>();auto const a7=replayer.value<GLenum>();auto const a8=replayer.value<GLsizei>();auto const a9=replayer.pixels<const void*>();if(replayer.isCorrupted())return;gl.glCompressedTextureSubImage2DEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}
+static void replay_glWindowPos3dv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glWindowPos3dv(a0);}
+static void replay_glCopyConvolutionFilter2D(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLint>();auto const a3=replayer.value<GLint>();auto const a4=replayer.value<GLsizei>();auto const a5=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glCopyConvolutionFilter2D(a0,a1,a2,a3,a4,a5);}
+static void replay_glReadInstrumentsSGIX(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glReadInstrumentsSGIX(a0);}
+static void replay_glSamplerParameterfv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glSamplerParameterfv(a0,a1,a2);}
+static void replay_glBindBufferARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glBindBufferARB(a0,a1);}
+static void replay_glVertexAttrib1sNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLshort>();if(replayer.isCorrupted())return;gl.glVertexAttrib1sNV(a0,a1);}
+static void replay_glGetMaterialiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetMaterialiv(a0,a1,a2);}
+static void replay_glUniform1fv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLfloat*>();if(replayer.isCorrupted())return;gl.glUniform1fv(a0,a1,a2);}
+static void replay_glBeginOcclusionQueryNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glBeginOcclusionQueryNV(a0);}
+static void replay_glGenFencesAPPLE(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLsizei>();auto const a1=replayer.output<GLuint*>();if(replayer.isCorrupted())return;gl.glGenFencesAPPLE(a0,a1);replayer.checkNames(a1);}
+static void replay_glScissorIndexedv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.null<const GLint*>();if(replayer.isCorrupted())return;gl.glScissorIndexedv(a0,a1);}
+static void replay_glDisableVariantClientStateEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glDisableVariantClientStateEXT(a0);}
+static void replay_glMinmaxEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLenum>();auto const a2=replayer.value<GLboolean>();if(replayer.isCorrupted())return;gl.glMinmaxEXT(a0,a1,a2);}
+static void replay_glNormalPointervINTEL(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<const void**>();if(replayer.isCorrupted())return;gl.glNormalPointervINTEL(a0,a1);}
+static void replay_glNormal3s(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLshort>();auto const a1=replayer.value<GLshort>();auto const a2=replayer.value<GLshort>();if(replayer.isCorrupted())return;gl.glNormal3s(a0,a1,a2);}
+static void replay_glGetnPixelMapuiv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.output<GLuint*>();if(replayer.isCorrupted())return;gl.glGetnPixelMapuiv(a0,a1,a2);}
+static void replay_glNormalStream3bvATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLbyte*>();if(replayer.isCorrupted())return;gl.glNormalStream3bvATI(a0,a1);}
+static void replay_glGetObjectParameterivAPPLE(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.output<GLint*>();if(replayer.isCorrupted())return;gl.glGetObjectParameterivAPPLE(a0,a1,a2,a3);}
+static void replay_glNormal3i(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glNormal3i(a0,a1,a2);}
+static void replay_glUniform1ivARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLint>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.data<const GLint*>();if(replayer.isCorrupted())return;gl.glUniform1ivARB(a0,a1,a2);}
+static void replay_glNormal3d(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLdouble>();auto const a1=replayer.value<GLdouble>();auto const a2=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glNormal3d(a0,a1,a2);}
+static void replay_glUpdateObjectBufferATI(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLuint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<const void*>();auto const a4=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glUpdateObjectBufferATI(a0,a1,a2,a3,a4);}
+static void replay_glNormal3b(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLbyte>();auto const a1=replayer.value<GLbyte>();auto const a2=replayer.value<GLbyte>();if(replayer.isCorrupted())return;gl.glNormal3b(a0,a1,a2);}
+static void replay_glGetUniformBufferSizeEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();if(replayer.isCorrupted())return;gl.glGetUniformBufferSizeEXT(a0,a1);}
+static void replay_glMultiTexCoord4dv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glMultiTexCoord4dv(a0,a1);}
+static void replay_glProgramUniform3i64ARB(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLint64>();auto const a3=replayer.value<GLint64>();auto const a4=replayer.value<GLint64>();if(replayer.isCorrupted())return;gl.glProgramUniform3i64ARB(a0,a1,a2,a3,a4);}
+static void replay_glVertexAttrib2d(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLdouble>();auto const a2=replayer.value<GLdouble>();if(replayer.isCorrupted())return;gl.glVertexAttrib2d(a0,a1,a2);}
+static void replay_glVertexAttrib2f(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLfloat>();auto const a2=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glVertexAttrib2f(a0,a1,a2);}
+static void replay_glMultiDrawElementsEXT(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.data<const GLsizei*>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.data<const void*const*>();auto const a4=replayer.value<GLsizei>();if(replayer.isCorrupted())return;gl.glMultiDrawElementsEXT(a0,a1,a2,a3,a4);}
+static void replay_glVertexAttrib3dv(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLdouble*>();if(replayer.isCorrupted())return;gl.glVertexAttrib3dv(a0,a1);}
+static void replay_glMultiTexCoord2bOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLbyte>();auto const a2=replayer.value<GLbyte>();if(replayer.isCorrupted())return;gl.glMultiTexCoord2bOES(a0,a1,a2);}
+static void replay_glVertexAttrib2s(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLshort>();auto const a2=replayer.value<GLshort>();if(replayer.isCorrupted())return;gl.glVertexAttrib2s(a0,a1,a2);}
+static void replay_glTexImage3DMultisample(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLsizei>();auto const a2=replayer.value<GLenum>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.value<GLsizei>();auto const a5=replayer.value<GLsizei>();auto const a6=replayer.value<GLboolean>();if(replayer.isCorrupted())return;gl.glTexImage3DMultisample(a0,a1,a2,a3,a4,a5,a6);}
+static void replay_glGetUniformBlockIndex(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.data<const GLchar*>();if(replayer.isCorrupted())return;gl.glGetUniformBlockIndex(a0,a1);}
+static void replay_glFrontFace(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();if(replayer.isCorrupted())return;gl.glFrontFace(a0);}
+static void replay_glEvalCoord1xOES(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLfixed>();if(replayer.isCorrupted())return;gl.glEvalCoord1xOES(a0);}
+static void replay_glDrawArraysInstancedBaseInstance(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLenum>();auto const a1=replayer.value<GLint>();auto const a2=replayer.value<GLsizei>();auto const a3=replayer.value<GLsizei>();auto const a4=replayer.value<GLuint>();if(replayer.isCorrupted())return;gl.glDrawArraysInstancedBaseInstance(a0,a1,a2,a3,a4);}
+static void replay_glIsPointInStrokePathNV(FunctionTable const&gl,CallReplayer&replayer){auto const a0=replayer.value<GLuint>();auto const a1=replayer.value<GLfloat>();auto const a2=replayer.value<GLfloat>();if(replayer.isCorrupted())return;gl.glIsPointInStrokePathNV(a0,a1,a2);}
+using ReplayFunction = void(*)(FunctionTable const&,CallReplayer&);
+static ReplayFunction const replayFunctions[] = {
+  replay_glMultiDrawArraysIndirectBindlessCountNV,
+  replay_glTextureParameterfv,
+  replay_glGetListParameterivSGIX,
+  replay_glProgramUniform1i64ARB,
+  replay_glVertexArrayElementBuffer,
+  replay_glHintPGI,
+  replay_glStencilMaskSeparate,
+  replay_glGetFramebufferAttachmentParameterivEXT,
+  replay_glTextureStorage3DMultisample,
+  replay_glGetIntegerIndexedvEXT,
+  replay_glCopyTexImage1D,
+  replay_glVertexAttrib4usv,
+  replay_glTexRenderbufferNV,
+  replay_glVertexAttrib3hvNV,
+  replay_glProgramUniform4ui64ARB,
+  replay_glInstrumentsBufferSGIX,
+  replay_glIndexi,
+  replay_glMultiTexCoord2sARB,
+  replay_glProgramEnvParameter4fARB,
+  replay_glCompressedTexSubImage3D,
+  replay_glEvalCoord2d,
+  replay_glEvalCoord2f,
+  replay_glIndexd,
+  replay_glSecondaryColor3hvNV,
+  replay_glIndexf,
+  replay_glFrustumxOES,
+  replay_glTextureStorage3DEXT,
+  replay_glDrawCommandsStatesNV,
+  replay_glUniform4uiEXT,
+  replay_glProgramUniform3ui64ARB,
+  replay_glIndexs,
+  replay_glVertexArrayBindVertexBufferEXT,
+  replay_glConvolutionParameteriEXT,
+  replay_glColor4ubVertex2fSUN,
+  replay_glProgramUniform1ivEXT,
+  replay_glGetnMapfv,
+  replay_glTransformFeedbackBufferRange,
+  replay_glPathGlyphsNV,
+  replay_glSecondaryColor3fv,
+  replay_glGetCombinerInputParameterivNV,
+  replay_glEndPerfMonitorAMD,
+  replay_glPointParameterfvARB,
+  replay_glVertex2xOES,
+  replay_glDrawElementsInstancedBaseInstance,
+  replay_glMultTransposeMatrixdARB,
+  replay_glVertexAttribL4dEXT,
+  replay_glVertex4iv,
+  replay_glCoverStrokePathInstancedNV,
+  replay_glDeformSGIX,
+  replay_glUniform2ui64NV,
+  replay_glCopyPathNV,
+  replay_glVertexAttribP4ui,
+  replay_glVertexAttribL2d,
+  replay_glGetMultisamplefv,
+  replay_glCompressedMultiTexSubImage3DEXT,
+  replay_glVDPAURegisterOutputSurfaceNV,
+  replay_glMinSampleShading,
+  replay_glProgramUniform4fEXT,
+  replay_glCoverStrokePathNV,
+  replay_glTextureImage2DMultisampleNV,
+  replay_glVertex3bOES,
+  replay_glTessellationFactorAMD,
+  replay_glDebugMessageControl,
+  replay_glIsObjectBufferATI,
+  replay_glPopAttrib,
+  replay_glProgramUniform4iEXT,
+  replay_glVertexAttrib4ubNV,
+  replay_glColorMaterial,
+  replay_glVertexAttrib2svARB,
+  replay_glMinSampleShadingARB,
+  replay_glColor3b,
+  replay_glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN,
+  replay_glColor3f,
+  replay_glVDPAUGetSurfaceivNV,
+  replay_glColor3d,
+  replay_glGetnMapiv,
+  replay_glColor3i,
+  replay_glGetInternalformatSampleivNV,
+  replay_glVertexAttrib4ubv,
+  replay_glColor3s,
+  replay_glVertexAttribs4hvNV,
+  replay_glVertexAttrib4NubvARB,
+  replay_glMultiTexCoord3hvNV,
+  replay_glMatrixPushEXT,
+  replay_glProgramUniform2fEXT,
+  replay_glGetVertexArrayIndexediv,
+  replay_glBlitFramebuffer,
+  replay_glMultiTexCoordP2ui,
+  replay_glColorPointerListIBM,
+  replay_glVertexAttribL4d,
+  replay_glGetFragmentMaterialfvSGIX,
+  replay_glVertex2iv,
+  replay_glGetTexEnvxvOES,
+  replay_glUniformMatrix3dv,
+  replay_glGetVertexAttribLdvEXT,
+  replay_glTexCoordP3uiv,
+  replay_glDeformationMap3dSGIX,
+  replay_glResumeTransformFeedback,
+  replay_glInsertEventMarkerEXT,
+  replay_glTessellationModeAMD,
+  replay_glDrawCommandsAddressNV,
+  replay_glFogi,
+  replay_glGetTexParameterxvOES,
+  replay_glVertexPointer,
+  replay_glGetPerfMonitorCounterDataAMD,
+  replay_glFogf,
+  replay_glMultiTexCoord1d,
+  replay_glMultiTexCoord1f,
+  replay_glGetMultiTexParameterivEXT,
+  replay_glProgramUniformMatrix3x4fvEXT,
+  replay_glVertexAttribI2i,
+  replay_glMultiTexCoord1i,
+  replay_glUniform1ui64vARB,
+  replay_glLoadProgramNV,
+  replay_glWriteMaskEXT,
+  replay_glGetGraphicsResetStatus,
+  replay_glVertexAttrib1fv,
+  replay_glIsEnabled,
+  replay_glImageTransformParameterfvHP,
+  replay_glFramebufferTexture2D,
+  replay_glGetFragmentLightfvSGIX,
+  replay_glListParameterfSGIX,
+  replay_glTexCoord3sv,
+  replay_glNamedFramebufferRenderbufferEXT,
+  replay_glFragmentLightModelfSGIX,
+  replay_glIndexPointerEXT,
+  replay_glBlendEquationSeparateATI,
+  replay_glVertexArrayAttribIFormat,
+  replay_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN,
+  replay_glReplacementCodeubvSUN,
+  replay_glGenFramebuffers,
+  replay_glPixelMapx,
+  replay_glTexSubImage3DEXT,
+  replay_glGetAttachedShaders,
+  replay_glGetPixelTexGenParameterfvSGIS,
+  replay_glReplacementCodeuiNormal3fVertex3fSUN,
+  replay_glGetDebugMessageLogAMD,
+  replay_glVertexStream4sATI,
+  replay_glVertexAttribs4dvNV,
+  replay_glGetnMapdvARB,
+  replay_glOrthofOES,
+  replay_glViewportArrayv,
+  replay_glDrawElementArrayATI,
+  replay_glGetPathColorGenfvNV,
+  replay_glWindowPos3iMESA,
+  replay_glMultiTexCoord2s,
+  replay_glVertex3dv,
+  replay_glVertexAttribI3uivEXT,
+  replay_glUniform3ui64ARB,
+  replay_glVertexAttrib2fvNV,
+  replay_glGetNamedBufferSubDataEXT,
+  replay_glConvolutionFilter2D,
+  replay_glMemoryBarrierByRegion,
+  replay_glVertexArrayBindingDivisor,
+  replay_glMatrixRotatedEXT,
+  replay_glTexCoord2sv,
+  replay_glIsProgramNV,
+  replay_glUniform2dv,
+  replay_glGetPixelMapuiv,
+  replay_glDepthBoundsEXT,
+  replay_glVertexAttrib4hvNV,
+  replay_glMultiTexParameteriEXT,
+  replay_glGetPointerv,
+  replay_glPathCommandsNV,
+  replay_glGetUniformfv,
+  replay_glGetUniformuiv,
+  replay_glDebugMessageInsertAMD,
+  replay_glFrustum,
+  replay_glVertexAttribL1ui64vNV,
+  replay_glClearColorxOES,
+  replay_glProgramUniformMatrix3fv,
+  replay_glSampleMaskIndexedNV,
+  replay_glCompileShaderIncludeARB,
+  replay_glGetArrayObjectfvATI,
+  replay_glVertexStream4svATI,
+  replay_glMultiTexCoord4iARB,
+  replay_glVariantfvEXT,
+  replay_glMatrixLoadfEXT,
+  replay_glLoadIdentityDeformationMapSGIX,
+  replay_glGetRenderbufferParameteriv,
+  replay_glProgramUniform3fEXT,
+  replay_glNamedRenderbufferStorage,
+  replay_glProgramPathFragmentInputGenNV,
+  replay_glFogCoordPointerListIBM,
+  replay_glFenceSync,
+  replay_glGetVertexAttribIivEXT,
+  replay_glFramebufferDrawBuffersEXT,
+  replay_glVertexAttribs4fvNV,
+  replay_glPauseTransformFeedbackNV,
+  replay_glGetQueryObjecti64vEXT,
+  replay_glVDPAUSurfaceAccessNV,
+  replay_glValidateProgramPipeline,
+  replay_glTexPageCommitmentARB,
+  replay_glWindowPos3dvARB,
+  replay_glStencilStrokePathInstancedNV,
+  replay_glFogfv,
+  replay_glGenQueriesARB,
+  replay_glProgramUniform2i64NV,
+  replay_glVertexP4ui,
+  replay_glVertexStream1ivATI,
+  replay_glProgramEnvParameterI4iNV,
+  replay_glGenVertexArraysAPPLE,
+  replay_glDrawTransformFeedbackInstanced,
+  replay_glStencilThenCoverStrokePathNV,
+  replay_glDeleteVertexArraysAPPLE,
+  replay_glGetNamedBufferParameterui64vNV,
+  replay_glQueryMatrixxOES,
+  replay_glSecondaryColor3usv,
+  replay_glTranslatexOES,
+  replay_glDrawTransformFeedback,
+  replay_glTexCoord2fColor4fNormal3fVertex3fvSUN,
+  replay_glVDPAURegisterVideoSurfaceNV,
+  replay_glGetTexParameterIuiv,
+  replay_glBindBufferBaseNV,
+  replay_glIndexPointer,
+  replay_glVertexAttrib4Nbv,
+  replay_glListParameteriSGIX,
+  replay_glBlendColorxOES,
+  replay_glUniformui64vNV,
+  replay_glIsSync,
+  replay_glGetTextureParameterivEXT,
+  replay_glFogCoordhvNV,
+  replay_glFramebufferTextureLayerEXT,
+  replay_glGetObjectPtrLabel,
+  replay_glTextureParameteri,
+  replay_glMultiTexCoord1fARB,
+  replay_glUniformMatrix2x3dv,
+  replay_glFramebufferDrawBufferEXT,
+  replay_glCopyColorSubTable,
+  replay_glVertexAttribL3d,
+  replay_glFragmentMaterialfvSGIX,
+  replay_glMatrixLoadTranspose3x3fNV,
+  replay_glDeleteNamesAMD,
+  replay_glDrawRangeElementsEXT,
+  replay_glOrtho,
+  replay_glProgramUniform1dvEXT,
+  replay_glColor4xOES,
+  replay_glTexImage4DSGIS,
+  replay_glProgramUniform1ui,
+  replay_glDeleteBuffersARB,
+  replay_glUnmapBufferARB,
+  replay_glCopyTexImage2D,
+  replay_glMaterialxOES,
+  replay_glProgramUniformMatrix2x4fvEXT,
+  replay_glTestObjectAPPLE,
+  replay_glRenderbufferStorageEXT,
+  replay_glVertexAttribL1ui64ARB,
+  replay_glEndFragmentShaderATI,
+  replay_glPathParameterivNV,
+  replay_glUniform4uiv,
+  replay_glFrameZoomSGIX,
+  replay_glSecondaryColor3fEXT,
+  replay_glVertexAttribL1dv,
+  replay_glNormalStream3svATI,
+  replay_glPathStencilFuncNV,
+  replay_glSetInvariantEXT,
+  replay_glGetTexBumpParameterivATI,
+  replay_glBlendEquationSeparateEXT,
+  replay_glEndOcclusionQueryNV,
+  replay_glScissorArrayv,
+  replay_glCallList,
+  replay_glMapTexture2DINTEL,
+  replay_glPixelTransferxOES,
+  replay_glDeleteRenderbuffersEXT,
+  replay_glTexCoord4fColor4fNormal3fVertex4fSUN,
+  replay_glProgramUniformMatrix4dvEXT,
+  replay_glGetnColorTable,
+  replay_glFramebufferTextureLayerARB,
+  replay_glVertexAttribL2dvEXT,
+  replay_glGetCombinerStageParameterfvNV,
+  replay_glMultiTexCoord1xvOES,
+  replay_glMapBuffer,
+  replay_glSecondaryColor3d,
+  replay_glSecondaryColor3f,
+  replay_glVertexAttribLFormat,
+  replay_glElementPointerAPPLE,
+  replay_glVertexStream1fATI,
+  replay_glCoverageModulationNV,
+  replay_glSecondaryColor3i,
+  replay_glDeleteSync,
+  replay_glGetProgramParameterfvNV,
+  replay_glMaxShaderCompilerThreadsARB,
+  replay_glUniformMatrix4x2dv,
+  replay_glVertexArrayVertexAttribLOffsetEXT,
+  replay_glSecondaryColor3s,
+  replay_glIsImageHandleResidentNV,
+  replay_glUniform3iv,
+  replay_glVertexAttribL3i64vNV,
+  replay_glPolygonMode,
+  replay_glConvolutionFilter1DEXT,
+  replay_glVertexAttrib1dvARB,
+  replay_glTextureSubImage2DEXT,
+  replay_glIsVertexArrayAPPLE,
+  replay_glUseProgram,
+  replay_glLineStipple,
+  replay_glMultiTexCoord4fvARB,
+  replay_glVideoCaptureNV,
+  replay_glVertexArrayVertexAttribLFormatEXT,
+  replay_glUniform3fvARB,
+  replay_glProgramUniformMatrix3x2fvEXT,
+  replay_glCopyTextureSubImage3DEXT,
+  replay_glMultiTexCoord2bvOES,
+  replay_glDeleteObjectARB,
+  replay_glTextureLightEXT,
+  replay_glMultiTexCoord3dARB,
+  replay_glNamedFramebufferTextureEXT,
+  replay_glTextureParameteriEXT,
+  replay_glEvalCoord2xvOES,
+  replay_glBindVideoCaptureStreamBufferNV,
+  replay_glTexImage2DMultisampleCoverageNV,
+  replay_glGetAttribLocationARB,
+  replay_glDeleteShader,
+  replay_glVertexAttrib1fARB,
+  replay_glTexCoord2fColor4ubVertex3fSUN,
+  replay_glTexCoord4fVertex4fSUN,
+  replay_glGetMapdv,
+  replay_glMapParameterfvNV,
+  replay_glTextureParameterIuiv,
+  replay_glTransformFeedbackAttribsNV,
+  replay_glFragmentLightfvSGIX,
+  replay_glWindowPos3sARB,
+  replay_glGetConvolutionParameterfv,
+  replay_glCopyTexSubImage3D,
+  replay_glVertexAttribI3i,
+  replay_glCreateShaderObjectARB,
+  replay_glVertexAttribFormat,
+  replay_glGetProgramivARB,
+  replay_glVertexAttribI4usv,
+  replay_glTexParameterf,
+  replay_glVertexAttribBinding,
+  replay_glGetHistogramParameteriv,
+  replay_glTexParameteri,
+  replay_glGetShaderSource,
+  replay_glVertexAttrib4s,
+  replay_glVertexAttrib4dvNV,
+  replay_glVertexAttrib1dvNV,
+  replay_glPopName,
+  replay_glTextureBufferEXT,
+  replay_glGetMultiTexImageEXT,
+  replay_glGetPointerIndexedvEXT,
+  replay_glIsNameAMD,
+  replay_glColor4ub,
+  replay_glBufferParameteriAPPLE,
+  replay_glColor4ui,
+  replay_glGetInternalformativ,
+  replay_glColor4us,
+  replay_glVertexAttribP1uiv,
+  replay_glLinkProgram,
+  replay_glTexCoord3s,
+  replay_glTexCoord2dv,
+  replay_glGetObjectLabel,
+  replay_glVertexPointerEXT,
+  replay_glDebugMessageCallbackARB,
+  replay_glGetString,
+  replay_glGetPathParameterfvNV,
+  replay_glLightxvOES,
+  replay_glEndQuery,
+  replay_glSecondaryColor3uiv,
+  replay_glPrioritizeTexturesxOES,
+  replay_glEdgeFlagPointer,
+  replay_glFramebufferParameteri,
+  replay_glTexCoord3hNV,
+  replay_glMultiModeDrawElementsIBM,
+  replay_glCopyPixels,
+  replay_glVertexAttribI2ui,
+  replay_glClampColorARB,
+  replay_glColorPointervINTEL,
+  replay_glDeleteTextures,
+  replay_glGetMinmaxParameterfvEXT,
+  replay_glWindowPos3sMESA,
+  replay_glVertexAttrib4f,
+  replay_glNamedFramebufferParameteri,
+  replay_glTexCoord2fVertex3fvSUN,
+  replay_glReplacementCodeusSUN,
+  replay_glGetNamedFramebufferParameteriv,
+  replay_glVertexStream1fvATI,
+  replay_glCreateVertexArrays,
+  replay_glBeginConditionalRender,
+  replay_glConvolutionFilter1D,
+  replay_glMultiTexCoord3fARB,
+  replay_glGetQueryObjectuivARB,
+  replay_glScalexOES,
+  replay_glSamplerParameteri,
+  replay_glSamplerParameterf,
+  replay_glShaderOp1EXT,
+  replay_glBeginVideoCaptureNV,
+  replay_glGetnHistogram,
+  replay_glUniform1d,
+  replay_glRenderMode,
+  replay_glClearColorIiEXT,
+  replay_glGetCompressedTexImage,
+  replay_glCompressedTextureImage1DEXT,
+  replay_glGetActiveUniformBlockiv,
+  replay_glUniform1i,
+  replay_glGetTexEnvfv,
+  replay_glColorTableParameterivSGI,
+  replay_glCullFace,
+  replay_glDeleteFencesAPPLE,
+  replay_glProgramUniform4i,
+  replay_glUniformHandleui64ARB,
+  replay_glProgramUniform4f,
+  replay_glViewportIndexedf,
+  replay_glProgramUniform4d,
+  replay_glTexCoord1xOES,
+  replay_glVertexStream3ivATI,
+  replay_glGetStringi,
+  replay_glEndQueryARB,
+  replay_glVDPAUMapSurfacesNV,
+  replay_glVertex3i,
+  replay_glVertexAttrib4uivARB,
+  replay_glResumeTransformFeedbackNV,
+  replay_glAttachShader,
+  replay_glColor4hNV,
+  replay_glGetFenceivNV,
+  replay_glTexCoord2fColor4ubVertex3fvSUN,
+  replay_glGetColorTable,
+  replay_glFogCoordPointer,
+  replay_glTexStorageSparseAMD,
+  replay_glUnmapNamedBuffer,
+  replay_glTexCoord4bvOES,
+  replay_glVertexAttrib3fARB,
+  replay_glRasterPos2xOES,
+  replay_glColor4ubVertex2fvSUN,
+  replay_glSecondaryColor3dv,
+  replay_glVertexAttribI4sv,
+  replay_glDrawTransformFeedbackStreamInstanced,
+  replay_glMultiTexCoord4ivARB,
+  replay_glSpriteParameterfSGIX,
+  replay_glSecondaryColor3sv,
+  replay_glBindVideoCaptureStreamTextureNV,
+  replay_glTexParameterIuiv,
+  replay_glFlushPixelDataRangeNV,
+  replay_glWindowPos3fv,
+  replay_glVertexAttribLFormatNV,
+  replay_glLightModelfv,
+  replay_glGetColorTableSGI,
+  replay_glGetCompressedTexImageARB,
+  replay_glConvolutionParameteri,
+  replay_glVertexWeighthNV,
+  replay_glColorMaskIndexedEXT,
+  replay_glColorMaski,
+  replay_glColorFragmentOp1ATI,
+  replay_glVertexAttribI4ubvEXT,
+  replay_glVertexAttrib1dNV,
+  replay_glUnmapObjectBufferATI,
+  replay_glNamedProgramLocalParameterI4uiEXT,
+  replay_glProgramUniform1iEXT,
+  replay_glDeleteQueriesARB,
+  replay_glWindowPos3svARB,
+  replay_glVertex4s,
+  replay_glStringMarkerGREMEDY,
+  replay_glIsTransformFeedback,
+  replay_glProgramUniformMatrix2x3dvEXT,
+  replay_glGetObjectLabelEXT,
+  replay_glUniformHandleui64vNV,
+  replay_glRotated,
+  replay_glIsProgramPipeline,
+  replay_glRotatef,
+  replay_glVertex4i,
+  replay_glGetActiveSubroutineUniformName,
+  replay_glVertexAttrib4sNV,
+  replay_glProgramLocalParameter4dvARB,
+  replay_glReplacementCodeubSUN,
+  replay_glMultiDrawElementsIndirectBindlessNV,
+  replay_glUniformMatrix3fv,
+  replay_glGetnMapfvARB,
+  replay_glGetnUniformfv,
+  replay_glVertexAttribL2dv,
+  replay_glVertexWeightPointerEXT,
+  replay_glTangent3sEXT,
+  replay_glSecondaryColorPointer,
+  replay_glAlphaFunc,
+  replay_glGetNamedStringARB,
+  replay_glTexCoord4d,
+  replay_glBufferPageCommitmentARB,
+  replay_glProgramLocalParameters4fvEXT,
+  replay_glStencilFunc,
+  replay_glGetVertexAttribdvNV,
+  replay_glTexCoord3dv,
+  replay_glGetQueryBufferObjectiv,
+  replay_glTexGenxOES,
+  replay_glMultiTexCoord1fvARB,
+  replay_glLightEnviSGIX,
+  replay_glGetProgramPipelineiv,
+  replay_glVertexStream2ivATI,
+  replay_glGetColorTableEXT,
+  replay_glGetShaderInfoLog,
+  replay_glGetOcclusionQueryuivNV,
+  replay_glInvalidateNamedFramebufferSubData,
+  replay_glVertexAttribL1i64NV,
+  replay_glVDPAUInitNV,
+  replay_glVertexAttrib1hvNV,
+  replay_glVertexAttribI4i,
+  replay_glRasterPos2iv,
+  replay_glGetIntegerui64i_vNV,
+  replay_glUniformHandleui64NV,
+  replay_glWindowPos3ivMESA,
+  replay_glBlendEquationSeparate,
+  replay_glDrawElementsInstancedARB,
+  replay_glGetSubroutineIndex,
+  replay_glVertexAttrib2sv,
+  replay_glSamplePatternSGIS,
+  replay_glEGLImageTargetRenderbufferStorageOES,
+  replay_glPushAttrib,
+  replay_glVertex3hNV,
+  replay_glRasterPos3xvOES,
+  replay_glPathParameterfNV,
+  replay_glGetUniformi64vNV,
+  replay_glLightiv,
+  replay_glMaterialxvOES,
+  replay_glNamedProgramLocalParameter4fEXT,
+  replay_glVertexAttribL1dEXT,
+  replay_glGetnUniformdvARB,
+  replay_glSecondaryColor3bEXT,
+  replay_glBeginPerfQueryINTEL,
+  replay_glProgramUniform1uivEXT,
+  replay_glImageTransformParameterivHP,
+  replay_glDeleteBuffers,
+  replay_glBindProgramPipeline,
+  replay_glScissor,
+  replay_glProgramUniform4fv,
+  replay_glGetBooleanv,
+  replay_glMaterialfv,
+  replay_glWindowPos4fvMESA,
+  replay_glVertexAttribIPointerEXT,
+  replay_glProgramBufferParametersfvNV,
+  replay_glAlphaFuncxOES,
+  replay_glMultiDrawArraysIndirectAMD,
+  replay_glNormalStream3ivATI,
+  replay_glTextureImage3DMultisampleNV,
+  replay_glProgramUniform4uivEXT,
+  replay_glReplacementCodeusvSUN,
+  replay_glPollInstrumentsSGIX,
+  replay_glGetTextureLevelParameteriv,
+  replay_glVertexAttribI2uiv,
+  replay_glMapControlPointsNV,
+  replay_glColor4dv,
+  replay_glInvalidateBufferSubData,
+  replay_glMultiTexCoord1hNV,
+  replay_glPointParameterfv,
+  replay_glUniformMatrix2fvARB,
+  replay_glUniform2fv,
+  replay_glVertexPointerListIBM,
+  replay_glGetMultiTexGenfvEXT,
+  replay_glGetMinmaxEXT,
+  replay_glIsFenceNV,
+  replay_glMatrixFrustumEXT,
+  replay_glDispatchComputeIndirect,
+  replay_glMultiTexCoord4bOES,
+  replay_glProgramEnvParameter4dARB,
+  replay_glProgramUniform1uiEXT,
+  replay_glBindBufferRange,
+  replay_glNormal3iv,
+  replay_glVertexAttribL3dv,
+  replay_glGetUniformdv,
+  replay_glGetMultiTexLevelParameterfvEXT,
+  replay_glFinalCombinerInputNV,
+  replay_glCullParameterdvEXT,
+  replay_glMultiTexCoord4s,
+  replay_glMapVertexAttrib1fAPPLE,
+  replay_glConvolutionParameterfEXT,
+  replay_glTexCoord1iv,
+  replay_glProgramUniform3fvEXT,
+  replay_glColor3uiv,
+  replay_glListBase,
+  replay_glTexCoord2bOES,
+  replay_glBindMaterialParameterEXT,
+  replay_glGlobalAlphaFactorubSUN,
+  replay_glVertexAttribL1ui64NV,
+  replay_glPointParameterfSGIS,
+  replay_glGetImageTransformParameterivHP,
+  replay_glColorSubTableEXT,
+  replay_glPixelTexGenParameterfvSGIS,
+  replay_glClientWaitSync,
+  replay_glQueryObjectParameteruiAMD,
+  replay_glVertexAttribs1fvNV,
+  replay_glVertexAttrib4NusvARB,
+  replay_glVariantPointerEXT,
+  replay_glTextureBuffer,
+  replay_glVertexAttribI1uiEXT,
+  replay_glInvalidateTexImage,
+  replay_glProgramEnvParametersI4ivNV,
+  replay_glPathGlyphIndexArrayNV,
+  replay_glCopyImageSubData,
+  replay_glGetUniformSubroutineuiv,
+  replay_glBindVertexBuffer,
+  replay_glMultiTexCoord1iARB,
+  replay_glDebugMessageInsert,
+  replay_glBeginVertexShaderEXT,
+  replay_glIsVariantEnabledEXT,
+  replay_glPassThroughxOES,
+  replay_glIsSampler,
+  replay_glConservativeRasterParameterfNV,
+  replay_glMultiTexGenivEXT,
+  replay_glNamedFramebufferTexture2DEXT,
+  replay_glCopyTexSubImage1D,
+  replay_glTexCoord1i,
+  replay_glCheckFramebufferStatus,
+  replay_glDrawElementArrayAPPLE,
+  replay_glTexCoord1d,
+  replay_glTexCoord1f,
+  replay_glFragmentLightivSGIX,
+  replay_glBindImageTexture,
+  replay_glTransformFeedbackVaryings,
+  replay_glDrawRangeElements,
+  replay_glTexCoord1s,
+  replay_glBindBufferBase,
+  replay_glColor3bv,
+  replay_glSyncTextureINTEL,
+  replay_glCreateSamplers,
+  replay_glCombinerParameterfNV,
+  replay_glGetArrayObjectivATI,
+  replay_glMultiDrawArrays,
+  replay_glSampleMapATI,
+  replay_glProgramUniform2i64ARB,
+  replay_glBinormal3ivEXT,
+  replay_glMultiDrawArraysIndirectCountARB,
+  replay_glUniformBufferEXT,
+  replay_glWindowPos2ivMESA,
+  replay_glTexCoordP4ui,
+  replay_glMultiTexSubImage1DEXT,
+  replay_glProgramUniformMatrix2x3fvEXT,
+  replay_glBufferDataARB,
+  replay_glVertexAttribIFormat,
+  replay_glCreateFramebuffers,
+  replay_glNormalStream3dvATI,
+  replay_glClearAccum,
+  replay_glUniform3i64vNV,
+  replay_glNormal3fVertex3fSUN,
+  replay_glUniform2uivEXT,
+  replay_glBeginQuery,
+  replay_glStencilThenCoverStrokePathInstancedNV,
+  replay_glBindBuffer,
+  replay_glMap2d,
+  replay_glMap2f,
+  replay_glMakeImageHandleResidentNV,
+  replay_glUniformMatrix2x4fv,
+  replay_glGetMultiTexParameterfvEXT,
+  replay_glDepthRangeIndexed,
+  replay_glMultiTexCoord1s,
+  replay_glMatrixScalefEXT,
+  replay_glGetError,
+  replay_glGetTexEnviv,
+  replay_glBindTextureUnitParameterEXT,
+  replay_glGetnUniformfvARB,
+  replay_glReplacementCodeuiNormal3fVertex3fvSUN,
+  replay_glDeletePerfQueryINTEL,
+  replay_glActiveVaryingNV,
+  replay_glGetActiveUniformARB,
+  replay_glVertexAttribI3ivEXT,
+  replay_glEvalCoord1d,
+  replay_glNamedCopyBufferSubDataEXT,
+  replay_glEvalCoord1f,
+  replay_glPixelMapfv,
+  replay_glVertexAttribI1ivEXT,
+  replay_glCreateSyncFromCLeventARB,
+  replay_glGetPixelMapusv,
+  replay_glGetnColorTableARB,
+  replay_glAccum,
+  replay_glRasterPos3sv,
+  replay_glTexCoord2iv,
+  replay_glBlendFunciARB,
+  replay_glProgramUniform3i64vARB,
+  replay_glGetFramebufferAttachmentParameteriv,
+  replay_glProgramUniform4ui,
+  replay_glStencilMask,
+  replay_glResetHistogramEXT,
+  replay_glLightxOES,
+  replay_glNamedBufferData,
+  replay_glVertexStream3sATI,
+  replay_glVertexAttrib3fvARB,
+  replay_glClearNamedBufferSubData,
+  replay_glProgramUniformHandleui64ARB,
+  replay_glUniform3iARB,
+  replay_glCreateProgramObjectARB,
+  replay_glMultiTexCoord1dvARB,
+  replay_glGetObjectParameterfvARB,
+  replay_glRectsv,
+  replay_glMultiTexImage2DEXT,
+  replay_glProgramUniform1i64NV,
+  replay_glGetObjectBufferivATI,
+  replay_glUniform4i64ARB,
+  replay_glReplacementCodeuiColor4ubVertex3fvSUN,
+  replay_glBlendFuncSeparateINGR,
+  replay_glGetVideoCaptureStreamfvNV,
+  replay_glVertexAttrib2fARB,
+  replay_glGetTexGeniv,
+  replay_glPixelStorei,
+  replay_glGetCompressedTextureSubImage,
+  replay_glCopyImageSubDataNV,
+  replay_glActiveShaderProgram,
+  replay_glVertexStream1iATI,
+  replay_glPatchParameterfv,
+  replay_glIsFramebufferEXT,
+  replay_glTextureStorage2D,
+  replay_glProgramUniform1ui64ARB,
+  replay_glTexBufferRange,
+  replay_glGetPixelTexGenParameterivSGIS,
+  replay_glTextureSubImage3DEXT,
+  replay_glClipControl,
+  replay_glGetProgramResourceiv,
+  replay_glMultiTexCoordP2uiv,
+  replay_glVertexAttribI3ui,
+  replay_glSampleMaskSGIS,
+  replay_glVertexAttrib4NivARB,
+  replay_glGlobalAlphaFactorfSUN,
+  replay_glBlendEquationSeparateIndexedAMD,
+  replay_glGetPerfCounterInfoINTEL,
+  replay_glDeleteProgramsNV,
+  replay_glPixelZoomxOES,
+  replay_glGetCombinerOutputParameterivNV,
+  replay_glRasterPos2xvOES,
+  replay_glGetTexImage,
+  replay_glVertexArrayVertexBuffers,
+  replay_glUniform1ui64NV,
+  replay_glProgramParameteri,
+  replay_glNormal3xOES,
+  replay_glGetMapfv,
+  replay_glVertexStream2dvATI,
+  replay_glPathStencilDepthOffsetNV,
+  replay_glIsStateNV,
+  replay_glGetIntegerui64vNV,
+  replay_glGetImageTransformParameterfvHP,
+  replay_glRasterPos2fv,
+  replay_glVertex3xOES,
+  replay_glProgramUniform2dvEXT,
+  replay_glWeightPointerARB,
+  replay_glFinishFenceNV,
+  replay_glDepthRangexOES,
+  replay_glEnableVertexArrayAttribEXT,
+  replay_glProgramUniform2uivEXT,
+  replay_glGetDoubleIndexedvEXT,
+  replay_glWindowPos2fMESA,
+  replay_glSecondaryColor3b,
+  replay_glCopyConvolutionFilter1DEXT,
+  replay_glWindowPos2sv,
+  replay_glBindFramebufferEXT,
+  replay_glCreateShader,
+  replay_glGenPathsNV,
+  replay_glGenRenderbuffers,
+  replay_glCopyTexSubImage2D,
+  replay_glVertexAttrib4ubvARB,
+  replay_glDrawTextureNV,
+  replay_glVertexAttribs1svNV,
+  replay_glClearNamedBufferSubDataEXT,
+  replay_glBlendFuncSeparate,
+  replay_glPointParameterfARB,
+  replay_glTexCoord2fv,
+  replay_glGetVariantFloatvEXT,
+  replay_glVertexP2ui,
+  replay_glWindowPos2dMESA,
+  replay_glTexCoord4fv,
+  replay_glBindFragDataLocationEXT,
+  replay_glCompressedTexSubImage1DARB,
+  replay_glGetTextureImageEXT,
+  replay_glFogCoordd,
+  replay_glPointSize,
+  replay_glBindTextureUnit,
+  replay_glProgramEnvParameterI4uiNV,
+  replay_glGetProgramPipelineInfoLog,
+  replay_glProgramUniform4i64vARB,
+  replay_glVertexAttrib4Nuiv,
+  replay_glGetUniformfvARB,
+  replay_glWaitSync,
+  replay_glUniform3i,
+  replay_glBlendEquationSeparatei,
+  replay_glVertexAttrib2hvNV,
+  replay_glTextureParameterivEXT,
+  replay_glUniform3d,
+  replay_glUniform3f,
+  replay_glActiveProgramEXT,
+  replay_glDeleteVertexArrays,
+  replay_glUniform3ui64vARB,
+  replay_glProgramUniform1ui64vARB,
+  replay_glTextureParameterfEXT,
+  replay_glSetFragmentShaderConstantATI,
+  replay_glColorSubTable,
+  replay_glReplacementCodeuiSUN,
+  replay_glStateCaptureNV,
+  replay_glBindAttribLocation,
+  replay_glWeightusvARB,
+  replay_glGetFragDataIndex,
+  replay_glMultiTexCoord2xOES,
+  replay_glColor3sv,
+  replay_glTexCoord2fVertex3fSUN,
+  replay_glPolygonOffsetEXT,
+  replay_glWeightPathsNV,
+  replay_glCombinerStageParameterfvNV,
+  replay_glPointParameterfEXT,
+  replay_glCopyTexImage1DEXT,
+  replay_glVertex4sv,
+  replay_glMatrixMultfEXT,
+  replay_glCompressedTextureSubImage3DEXT,
+  replay_glGetTexLevelParameterxvOES,
+  replay_glVertexAttribL3dvEXT,
+  replay_glMultiTexCoordP4ui,
+  replay_glGetTextureLevelParameterivEXT,
+  replay_glAlphaFragmentOp2ATI,
+  replay_glDeleteFramebuffers,
+  replay_glDrawArrays,
+  replay_glGetTransformFeedbackiv,
+  replay_glGetnTexImageARB,
+  replay_glClear,
+  replay_glVertexArrayParameteriAPPLE,
+  replay_glMultiTexCoord2dvARB,
+  replay_glGetVideoCaptureStreamdvNV,
+  replay_glFragmentLightModelivSGIX,
+  replay_glVertexAttribP2ui,
+  replay_glMultiTexCoordPointerEXT,
+  replay_glProgramUniform3iEXT,
+  replay_glTranslatef,
+  replay_glVertexAttrib4Nub,
+  replay_glTranslated,
+  replay_glSamplerParameterIiv,
+  replay_glTexCoord4hNV,
+  replay_glDrawElementsIndirect,
+  replay_glDeletePerfMonitorsAMD,
+  replay_glIsRenderbufferEXT,
+  replay_glDrawCommandsNV,
+  replay_glUniform3ivARB,
+  replay_glBufferSubData,
+  replay_glSecondaryColor3bv,
+  replay_glMatrixMultTransposedEXT,
+  replay_glRequestResidentProgramsNV,
+  replay_glAlphaFragmentOp1ATI,
+  replay_glGetQueryObjecti64v,
+  replay_glMatrixMult3x3fNV,
+  replay_glColorTableParameteriv,
+  replay_glPathSubCommandsNV,
+  replay_glGetFinalCombinerInputParameterivNV,
+  replay_glIsRenderbuffer,
+  replay_glVertex3iv,
+  replay_glTexGenfv,
+  replay_glFrustumfOES,
+  replay_glBindVertexBuffers,
+  replay_glMateriali,
+  replay_glMultiTexCoord2svARB,
+  replay_glDisableVertexAttribArray,
+  replay_glWindowPos3ivARB,
+  replay_glTexCoordFormatNV,
+  replay_glBlitNamedFramebuffer,
+  replay_glMatrixLoadTransposefEXT,
+  replay_glMultiTexGenfEXT,
+  replay_glShaderStorageBlockBinding,
+  replay_glMaterialf,
+  replay_glReplacementCodeuiColor4fNormal3fVertex3fSUN,
+  replay_glCheckNamedFramebufferStatusEXT,
+  replay_glVertexArrayVertexAttribFormatEXT,
+  replay_glVertex2hNV,
+  replay_glDeleteVertexShaderEXT,
+  replay_glTexImage3DEXT,
+  replay_glProgramLocalParameterI4ivNV,
+  replay_glGlobalAlphaFactoriSUN,
+  replay_glTextureStorage1D,
+  replay_glBinormal3sEXT,
+  replay_glGetProgramInterfaceiv,
+  replay_glMatrixIndexPointerARB,
+  replay_glTexCoordPointerEXT,
+  replay_glMultiTexGeniEXT,
+  replay_glVertexAttrib2fNV,
+  replay_glNamedProgramStringEXT,
+  replay_glMapNamedBuffer,
+  replay_glGetMinmaxParameteriv,
+  replay_glGetnUniformdv,
+  replay_glEndConditionalRenderNVX,
+  replay_glBinormal3fEXT,
+  replay_glNormalStream3iATI,
+  replay_glProgramBufferParametersIivNV,
+  replay_glMapGrid1xOES,
+  replay_glGetVertexAttribPointervARB,
+  replay_glFlushMappedNamedBufferRangeEXT,
+  replay_glGetVertexAttribIiv,
+  replay_glVertexP4uiv,
+  replay_glUniformui64NV,
+  replay_glColor4fv,
+  replay_glTexParameterxvOES,
+  replay_glPatchParameteri,
+  replay_glMap1d,
+  replay_glGetTexFilterFuncSGIS,
+  replay_glGetTexParameteriv,
+  replay_glVertexArrayVertexBindingDivisorEXT,
+  replay_glMultiTexCoord3svARB,
+  replay_glBindProgramNV,
+  replay_glGetConvolutionParameteriv,
+  replay_glGetProgramLocalParameterfvARB,
+  replay_glGenFragmentShadersATI,
+  replay_glTexBumpParameterivATI,
+  replay_glGetNamedFramebufferAttachmentParameteriv,
+  replay_glGetnSeparableFilter,
+  replay_glNormal3xvOES,
+  replay_glPassTexCoordATI,
+  replay_glFramebufferTextureFaceARB,
+  replay_glProgramUniform1dv,
+  replay_glTextureStorage2DEXT,
+  replay_glVertexArrayFogCoordOffsetEXT,
+  replay_glDeleteNamedStringARB,
+  replay_glGenOcclusionQueriesNV,
+  replay_glLighti,
+  replay_glTexImage1D,
+  replay_glLightf,
+  replay_glClientAttribDefaultEXT,
+  replay_glVertexAttrib4bvARB,
+  replay_glVertexAttribIFormatNV,
+  replay_glStencilFuncSeparate,
+  replay_glGetVertexAttribfvARB,
+  replay_glVertexAttrib2dNV,
+  replay_glProgramUniform2iEXT,
+  replay_glClientActiveVertexStreamATI,
+  replay_glRasterPos3xOES,
+  replay_glGetMapParameterivNV,
+  replay_glSampleCoverage,
+  replay_glClearDepthxOES,
+  replay_glTexCoord2fNormal3fVertex3fvSUN,
+  replay_glGetFirstPerfQueryIdINTEL,
+  replay_glUnmapNamedBufferEXT,
+  replay_glGetTransformFeedbacki_v,
+  replay_glUniform4fvARB,
+  replay_glRenderbufferStorageMultisampleCoverageNV,
+  replay_glGetFloati_vEXT,
+  replay_glBindAttribLocationARB,
+  replay_glBufferAddressRangeNV,
+  replay_glGenProgramsARB,
+  replay_glMultiTexEnvivEXT,
+  replay_glSecondaryColor3uiEXT,
+  replay_glCompressedTextureImage2DEXT,
+  replay_glUniform2i,
+  replay_glCopyTexImage2DEXT,
+  replay_glUniform2d,
+  replay_glVertexAttribL1d,
+  replay_glFramebufferTextureFaceEXT,
+  replay_glFramebufferTextureLayer,
+  replay_glMultiTexCoord4bvOES,
+  replay_glGetVertexArrayPointeri_vEXT,
+  replay_glNamedProgramLocalParameter4dEXT,
+  replay_glBinormal3bEXT,
+  replay_glConvolutionFilter2DEXT,
+  replay_glProgramUniform2fv,
+  replay_glColor3fVertex3fSUN,
+  replay_glNormal3fVertex3fvSUN,
+  replay_glCopyMultiTexSubImage3DEXT,
+  replay_glProgramLocalParameterI4iNV,
+  replay_glProgramUniformMatrix2x4dv,
+  replay_glPathMemoryGlyphIndexArrayNV,
+  replay_glDrawArraysEXT,
+  replay_glBlendEquationEXT,
+  replay_glStencilOp,
+  replay_glCopyTextureSubImage2DEXT,
+  replay_glTexEnvf,
+  replay_glVertexAttrib2dvNV,
+  replay_glGenPerfMonitorsAMD,
+  replay_glGetInteger64i_v,
+  replay_glGetHistogramParameterfv,
+  replay_glVertexFormatNV,
+  replay_glBlendFuncIndexedAMD,
+  replay_glTexEnvi,
+  replay_glMultiTexCoord1iv,
+  replay_glIsEnabledi,
+  replay_glVertexAttribL2ui64vNV,
+  replay_glVertexAttribL4i64NV,
+  replay_glMatrixTranslatedEXT,
+  replay_glMakeTextureHandleResidentARB,
+  replay_glMatrixMultdEXT,
+  replay_glBinormal3dvEXT,
+  replay_glImportSyncEXT,
+  replay_glGetMapiv,
+  replay_glGetListParameterfvSGIX,
+  replay_glMultiTexCoord4sv,
+  replay_glPNTrianglesiATI,
+  replay_glBindVertexArrayAPPLE,
+  replay_glObjectPtrLabel,
+  replay_glGetDebugMessageLog,
+  replay_glTrackMatrixNV,
+  replay_glBindFragDataLocation,
+  replay_glTangent3ivEXT,
+  replay_glSecondaryColor3ubv,
+  replay_glMakeTextureHandleNonResidentNV,
+  replay_glVertexAttribs4ubvNV,
+  replay_glClipPlanexOES,
+  replay_glMultiTexCoord3iv,
+  replay_glGetnPolygonStippleARB,
+  replay_glUniform2i64vNV,
+  replay_glLightModelf,
+  replay_glMultiTexSubImage2DEXT,
+  replay_glReplacementCodeuiColor3fVertex3fSUN,
+  replay_glTangent3dvEXT,
+  replay_glLightModeli,
+  replay_glVertexWeighthvNV,
+  replay_glWindowPos3iv,
+  replay_glMultiTexCoordP1uiv,
+  replay_glTransformPathNV,
+  replay_glProgramNamedParameter4dNV,
+  replay_glMultiDrawElementsIndirect,
+  replay_glProgramUniform1dEXT,
+  replay_glCallLists,
+  replay_glNormal3hvNV,
+  replay_glGetCombinerOutputParameterfvNV,
+  replay_glVertexAttrib4sARB,
+  replay_glTexCoord3i,
+  replay_glVertexAttribI3uiv,
+  replay_glPushDebugGroup,
+  replay_glTexCoord3f,
+  replay_glTexCoord3d,
+  replay_glTexCoord2xOES,
+  replay_glGetStageIndexNV,
+  replay_glProgramUniform4i64vNV,
+  replay_glGetNamedBufferPointervEXT,
+  replay_glTextureBarrierNV,
+  replay_glColor4ubVertex3fvSUN,
+  replay_glGetCommandHeaderNV,
+  replay_glGetPerfMonitorCounterInfoAMD,
+  replay_glVertexAttrib1svARB,
+  replay_glCombinerParameteriNV,
+  replay_glMatrixMultTransposefEXT,
+  replay_glDetailTexFuncSGIS,
+  replay_glAreTexturesResident,
+  replay_glProgramUniform2d,
+  replay_glGetConvolutionParameterfvEXT,
+  replay_glIndexPointerListIBM,
+  replay_glVertexAttribI4iEXT,
+  replay_glProgramUniform2f,
+  replay_glRasterPos4sv,
+  replay_glColor4s,
+  replay_glColorFragmentOp3ATI,
+  replay_glResizeBuffersMESA,
+  replay_glGetMinmaxParameterfv,
+  replay_glClientActiveTextureARB,
+  replay_glBindVertexArray,
+  replay_glColor4b,
+  replay_glColor4f,
+  replay_glColor4d,
+  replay_glColor4i,
+  replay_glEdgeFlagFormatNV,
+  replay_glNamedBufferSubData,
+  replay_glDrawElementsInstanced,
+  replay_glGetMultiTexParameterIivEXT,
+  replay_glVertex2dv,
+  replay_glDisableVertexArrayAttribEXT,
+  replay_glObjectUnpurgeableAPPLE,
+  replay_glVertexAttribs2dvNV,
+  replay_glReplacementCodeuiTexCoord2fVertex3fSUN,
+  replay_glGetMapParameterfvNV,
+  replay_glProgramUniform4ivEXT,
+  replay_glProgramUniform3ui64vNV,
+  replay_glRectfv,
+  replay_glTexFilterFuncSGIS,
+  replay_glSpriteParameterfvSGIX,
+  replay_glCopyMultiTexImage1DEXT,
+  replay_glGetVertexAttribIuivEXT,
+  replay_glUniformMatrix2x4dv,
+  replay_glGetProgramResourceLocationIndex,
+  replay_glColor3hNV,
+  replay_glViewport,
+  replay_glProgramNamedParameter4fNV,
+  replay_glGetInvariantBooleanvEXT,
+  replay_glTexStorage2DMultisample,
+  replay_glPixelStorex,
+  replay_glVertexAttribL1dvEXT,
+  replay_glGetActiveSubroutineUniformiv,
+  replay_glVertexAttribPointerARB,
+  replay_glCompressedTexSubImage2DARB,
+  replay_glVertex2hvNV,
+  replay_glTexBuffer,
+  replay_glArrayElement,
+  replay_glValidateProgram,
+  replay_glPixelStoref,
+  replay_glWindowPos3dARB,
+  replay_glEvalCoord1dv,
+  replay_glVertexAttribs2fvNV,
+  replay_glRecti,
+  replay_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN,
+  replay_glTexCoord1bOES,
+  replay_glProgramUniform2i64vARB,
+  replay_glWindowPos2dARB,
+  replay_glGetProgramParameterdvNV,
+  replay_glRectf,
+  replay_glRectd,
+  replay_glMap1xOES,
+  replay_glVertexAttrib3fvNV,
+  replay_glReferencePlaneSGIX,
+  replay_glGetMultiTexGendvEXT,
+  replay_glGetCombinerInputParameterfvNV,
+  replay_glGetTextureSamplerHandleARB,
+  replay_glBindTexture,
+  replay_glRects,
+  replay_glGetActiveAttribARB,
+  replay_glHistogramEXT,
+  replay_glGetTextureSamplerHandleNV,
+  replay_glDetachShader,
+  replay_glFinishTextureSUNX,
+  replay_glUniformMatrix3x4dv,
+  replay_glVertexAttrib4fARB,
+  replay_glGetPathColorGenivNV,
+  replay_glGetProgramResourceLocation,
+  replay_glVertexArrayAttribLFormat,
+  replay_glGetTexLevelParameterfv,
+  replay_glVertexArrayVertexAttribOffsetEXT,
+  replay_glIndexFormatNV,
+  replay_glMultiTexCoord3i,
+  replay_glReplacementCodeuiVertex3fvSUN,
+  replay_glViewportIndexedfv,
+  replay_glBindBuffersBase,
+  replay_glTexBumpParameterfvATI,
+  replay_glMatrixIndexuivARB,
+  replay_glVertexAttrib1hNV,
+  replay_glWindowPos3svMESA,
+  replay_glStencilOpSeparateATI,
+  replay_glDrawElementsBaseVertex,
+  replay_glBlendEquationSeparateiARB,
+  replay_glVertexAttrib1fNV,
+  replay_glMapVertexAttrib2fAPPLE,
+  replay_glCompressedTextureSubImage1DEXT,
+  replay_glClearBufferSubData,
+  replay_glTexStorage1D,
+  replay_glVertexAttribI3iEXT,
+  replay_glMakeTextureHandleNonResidentARB,
+  replay_glMultiDrawElementArrayAPPLE,
+  replay_glVertexStream4dATI,
+  replay_glProgramUniformMatrix2dvEXT,
+  replay_glVertexAttribs2hvNV,
+  replay_glGetUniformiv,
+  replay_glClipPlanefOES,
+  replay_glRenderbufferStorage,
+  replay_glUniform4ui,
+  replay_glBindFramebuffer,
+  replay_glValidateProgramARB,
+  replay_glTexGenf,
+  replay_glTexGend,
+  replay_glTexGeni,
+  replay_glDeleteFramebuffersEXT,
+  replay_glResetMinmaxEXT,
+  replay_glVertexAttrib1fvNV,
+  replay_glIsQueryARB,
+  replay_glEnableVariantClientStateEXT,
+  replay_glScissorIndexed,
+  replay_glGetInvariantIntegervEXT,
+  replay_glProgramLocalParameterI4uiNV,
+  replay_glConvolutionParameterxvOES,
+  replay_glGenFramebuffersEXT,
+  replay_glVertexArrayColorOffsetEXT,
+  replay_glMultiTexCoord3ivARB,
+  replay_glVertexWeightfEXT,
+  replay_glRasterPos4dv,
+  replay_glIsTextureHandleResidentARB,
+  replay_glRasterPos2dv,
+  replay_glWindowPos4ivMESA,
+  replay_glGetVariantPointervEXT,
+  replay_glMapNamedBufferRangeEXT,
+  replay_glGetnUniformui64vARB,
+  replay_glCreateShaderProgramv,
+  replay_glGetQueryObjectiv,
+  replay_glPNTrianglesfATI,
+  replay_glGlobalAlphaFactorusSUN,
+  replay_glVertexAttrib3dvNV,
+  replay_glMultiTexCoord3sARB,
+  replay_glGenerateMipmap,
+  replay_glCompressedTextureSubImage2D,
+  replay_glNamedRenderbufferStorageMultisampleEXT,
+  replay_glPolygonOffsetClampEXT,
+  replay_glTextureRangeAPPLE,
+  replay_glBlendEquationIndexedAMD,
+  replay_glTexCoord2d,
+  replay_glPointParameteri,
+  replay_glTexCoord2f,
+  replay_glColor4iv,
+  replay_glMapNamedBufferRange,
+  replay_glUnmapBuffer,
+  replay_glSampleMaskEXT,
+  replay_glTexCoord2i,
+  replay_glTexCoord1xvOES,
+  replay_glVertexAttrib1sARB,
+  replay_glGetVertexArrayiv,
+  replay_glProgramParameter4dvNV,
+  replay_glTexCoord2s,
+  replay_glTextureParameterIuivEXT,
+  replay_glGetColorTableParameterfvSGI,
+  replay_glTexCoord4dv,
+  replay_glVertexAttrib1svNV,
+  replay_glNamedFramebufferTextureFaceEXT,
+  replay_glProgramUniform2ui64vNV,
+  replay_glNormal3dv,
+  replay_glReleaseShaderCompiler,
+  replay_glTexCoord3bvOES,
+  replay_glIsVertexAttribEnabledAPPLE,
+  replay_glTexCoord1dv,
+  replay_glReadPixels,
+  replay_glVertexAttribI3iv,
+  replay_glSetFenceAPPLE,
+  replay_glWeightsvARB,
+  replay_glShadeModel,
+  replay_glMapGrid1d,
+  replay_glGetHistogramParameterivEXT,
+  replay_glConservativeRasterParameteriNV,
+  replay_glClearNamedBufferData,
+  replay_glClearDepthf,
+  replay_glCreatePerfQueryINTEL,
+  replay_glFogCoordfEXT,
+  replay_glVertexAttrib2dARB,
+  replay_glMultiTexCoord4dARB,
+  replay_glReadnPixelsARB,
+  replay_glMultiTexBufferEXT,
+  replay_glWindowPos4dvMESA,
+  replay_glInvalidateNamedFramebufferData,
+  replay_glSecondaryColorPointerListIBM,
+  replay_glRectiv,
+  replay_glColorP4ui,
+  replay_glUseProgramStages,
+  replay_glRasterPos3dv,
+  replay_glPathTexGenNV,
+  replay_glVertexBlendEnviATI,
+  replay_glUniform3i64ARB,
+  replay_glLoadMatrixf,
+  replay_glProgramUniform2dEXT,
+  replay_glVertexAttribI4iv,
+  replay_glNamedFramebufferDrawBuffer,
+  replay_glColor4ubv,
+  replay_glColor3hvNV,
+  replay_glGetMapAttribParameterfvNV,
+  replay_glGetBufferSubData,
+  replay_glGetVertexAttribLdv,
+  replay_glGetnUniformuiv,
+  replay_glGetUniformui64vNV,
+  replay_glNamedRenderbufferStorageEXT,
+  replay_glVertexAttrib3dNV,
+  replay_glTextureStorage1DEXT,
+  replay_glPixelTexGenParameteriSGIS,
+  replay_glColorTableEXT,
+  replay_glGenBuffers,
+  replay_glMultiTexCoord3xvOES,
+  replay_glExecuteProgramNV,
+  replay_glVariantArrayObjectATI,
+  replay_glColor3xvOES,
+  replay_glGetnConvolutionFilterARB,
+  replay_glNormalFormatNV,
+  replay_glGetInvariantFloatvEXT,
+  replay_glClearNamedFramebufferiv,
+  replay_glTexImage3D,
+  replay_glGenSamplers,
+  replay_glIsFramebuffer,
+  replay_glProgramUniform3dvEXT,
+  replay_glGetVertexAttribfvNV,
+  replay_glDrawRangeElementArrayAPPLE,
+  replay_glUniform3i64NV,
+  replay_glMatrixPopEXT,
+  replay_glVertexStream1sATI,
+  replay_glGetnPixelMapuivARB,
+  replay_glMultiTexEnviEXT,
+  replay_glVertexAttribI2iEXT,
+  replay_glProgramParameter4fvNV,
+  replay_glNamedFramebufferSampleLocationsfvNV,
+  replay_glTexCoordP4uiv,
+  replay_glRectxvOES,
+  replay_glGetVariantIntegervEXT,
+  replay_glDeleteLists,
+  replay_glTexGendv,
+  replay_glVertexP2uiv,
+  replay_glGetPerfMonitorGroupsAMD,
+  replay_glMultTransposeMatrixfARB,
+  replay_glVertexAttribI2ivEXT,
+  replay_glReplacementCodeuiColor4fNormal3fVertex3fvSUN,
+  replay_glDeleteStatesNV,
+  replay_glGetBufferParameteri64v,
+  replay_glProgramUniform4dv,
+  replay_glEdgeFlagPointerEXT,
+  replay_glVideoCaptureStreamParameterivNV,
+  replay_glVertexStream4iATI,
+  replay_glVDPAUFiniNV,
+  replay_glMakeBufferNonResidentNV,
+  replay_glUniform1ui64ARB,
+  replay_glStencilStrokePathNV,
+  replay_glProgramUniform3uiv,
+  replay_glVariantuivEXT,
+  replay_glCopyTexSubImage3DEXT,
+  replay_glSpriteParameteriSGIX,
+  replay_glMultiTexCoord1sARB,
+  replay_glConvolutionParameterfv,
+  replay_glMakeTextureHandleResidentNV,
+  replay_glMultMatrixxOES,
+  replay_glTextureNormalEXT,
+  replay_glGetQueryivARB,
+  replay_glCompressedMultiTexImage3DEXT,
+  replay_glGetInstrumentsSGIX,
+  replay_glProgramUniformMatrix4x3fvEXT,
+  replay_glPointParameterf,
+  replay_glProgramUniform3dEXT,
+  replay_glMultiTexCoord2hNV,
+  replay_glGetConvolutionFilterEXT,
+  replay_glVertexAttrib2hNV,
+  replay_glCurrentPaletteMatrixARB,
+  replay_glFogxvOES,
+  replay_glCreateRenderbuffers,
+  replay_glVertexAttrib4Nusv,
+  replay_glCombinerInputNV,
+  replay_glDepthFunc,
+  replay_glWindowPos4fMESA,
+  replay_glEnableClientStateIndexedEXT,
+  replay_glTexCoord4iv,
+  replay_glProgramUniform4i64ARB,
+  replay_glBlendFunci,
+  replay_glResolveDepthValuesNV,
+  replay_glTextureColorMaskSGIS,
+  replay_glCreateShaderProgramEXT,
+  replay_glBufferStorage,
+  replay_glMakeNamedBufferNonResidentNV,
+  replay_glRenderbufferStorageMultisampleEXT,
+  replay_glGetFloati_v,
+  replay_glUniform2ui64ARB,
+  replay_glVertex3fv,
+  replay_glGetUniformLocation,
+  replay_glVertexStream1svATI,
+  replay_glVertexStream3fATI,
+  replay_glNamedFramebufferDrawBuffers,
+  replay_glUniform2ui64vNV,
+  replay_glTexCoordPointervINTEL,
+  replay_glUniform4fv,
+  replay_glNormalPointerEXT,
+  replay_glVertexAttrib4hNV,
+  replay_glNormal3f,
+  replay_glVertexStream2iATI,
+  replay_glVertexAttribP4uiv,
+  replay_glCompressedTextureSubImage3D,
+  replay_glAsyncMarkerSGIX,
+  replay_glTextureStorageSparseAMD,
+  replay_glGetConvolutionParameterivEXT,
+  replay_glEndPerfQueryINTEL,
+  replay_glFragmentLightModeliSGIX,
+  replay_glPrioritizeTexturesEXT,
+  replay_glEndConditionalRender,
+  replay_glEnableClientState,
+  replay_glResetHistogram,
+  replay_glGetOcclusionQueryivNV,
+  replay_glUniform1uiEXT,
+  replay_glMultiTexCoord2sv,
+  replay_glTexSubImage2DEXT,
+  replay_glProgramUniform2uiv,
+  replay_glMultiTexCoord2iARB,
+  replay_glGetQueryObjectuiv,
+  replay_glGenerateMultiTexMipmapEXT,
+  replay_glVertexAttrib4iv,
+  replay_glWindowPos3dvMESA,
+  replay_glLabelObjectEXT,
+  replay_glProgramUniform1uiv,
+  replay_glFramebufferTexture,
+  replay_glMultiTexEnvfEXT,
+  replay_glGetTexGendv,
+  replay_glVertex4xOES,
+  replay_glVertexAttribI2uivEXT,
+  replay_glNamedProgramLocalParameter4fvEXT,
+  replay_glPointParameterfvSGIS,
+  replay_glGetPixelTransformParameterfvEXT,
+  replay_glIndexxvOES,
+  replay_glDepthMask,
+  replay_glProgramUniformMatrix2x4fv,
+  replay_glAreProgramsResidentNV,
+  replay_glColorTable,
+  replay_glBeginQueryIndexed,
+  replay_glVertexStream1dvATI,
+  replay_glGetMultiTexEnvfvEXT,
+  replay_glDeleteFencesNV,
+  replay_glVertexAttribs1dvNV,
+  replay_glVertexStream2sATI,
+  replay_glGetnSeparableFilterARB,
+  replay_glProgramUniform2dv,
+  replay_glActiveStencilFaceEXT,
+  replay_glProgramUniform4dEXT,
+  replay_glPointSizexOES,
+  replay_glRasterPos2sv,
+  replay_glBindParameterEXT,
+  replay_glTexCoord1sv,
+  replay_glBlendParameteriNV,
+  replay_glNamedProgramLocalParameter4dvEXT,
+  replay_glProgramUniformHandleui64NV,
+  replay_glGetTextureParameterfvEXT,
+  replay_glGetPathMetricsNV,
+  replay_glVertex2i,
+  replay_glNewList,
+  replay_glMatrixLoad3x3fNV,
+  replay_glMultiTexCoord2fARB,
+  replay_glWeightdvARB,
+  replay_glIsTransformFeedbackNV,
+  replay_glVertexAttribDivisorARB,
+  replay_glSecondaryColorP3uiv,
+  replay_glGetnCompressedTexImageARB,
+  replay_glGetIntegerv,
+  replay_glMatrixLoaddEXT,
+  replay_glGetPathLengthNV,
+  replay_glProgramUniformMatrix3dv,
+  replay_glUniform4i64NV,
+  replay_glGetHistogramEXT,
+  replay_glVertexAttrib4NuivARB,
+  replay_glMapGrid2xOES,
+  replay_glTexImage2D,
+  replay_glWindowPos2fvARB,
+  replay_glEnableIndexedEXT,
+  replay_glTexCoord1bvOES,
+  replay_glDrawPixels,
+  replay_glMultMatrixd,
+  replay_glMultMatrixf,
+  replay_glReplacementCodePointerSUN,
+  replay_glLoadTransposeMatrixdARB,
+  replay_glVertexAttrib4Nubv,
+  replay_glVertexArrayVertexAttribIOffsetEXT,
+  replay_glCompileShaderARB,
+  replay_glWindowPos3dMESA,
+  replay_glNormalStream3fvATI,
+  replay_glColor4usv,
+  replay_glMapGrid1f,
+  replay_glPolygonStipple,
+  replay_glUniform4ui64ARB,
+  replay_glTextureRenderbufferEXT,
+  replay_glGetSubroutineUniformLocation,
+  replay_glGetFramebufferParameteriv,
+  replay_glPixelMapusv,
+  replay_glGetSamplerParameteriv,
+  replay_glVertexStream2fvATI,
+  replay_glProgramStringARB,
+  replay_glProgramUniformMatrix3dvEXT,
+  replay_glSeparableFilter2D,
+  replay_glVertexAttribI1uiv,
+  replay_glTexStorage2D,
+  replay_glColor3fv,
+  replay_glVertexAttribL4dvEXT,
+  replay_glGetActiveUniform,
+  replay_glUniform2ui64vARB,
+  replay_glMakeNamedBufferResidentNV,
+  replay_glPathGlyphIndexRangeNV,
+  replay_glColorPointer,
+  replay_glProgramEnvParameterI4ivNV,
+  replay_glMultiTexParameterfEXT,
+  replay_glNamedFramebufferTextureLayer,
+  replay_glGetVertexArrayIntegervEXT,
+  replay_glVertexAttrib3dARB,
+  replay_glVDPAUIsSurfaceNV,
+  replay_glMultiTexImage1DEXT,
+  replay_glIsAsyncMarkerSGIX,
+  replay_glGetDoublei_vEXT,
+  replay_glUniform2i64NV,
+  replay_glIsCommandListNV,
+  replay_glUniform3uiEXT,
+  replay_glTexParameterIuivEXT,
+  replay_glProgramUniformMatrix4fv,
+  replay_glVertex2fv,
+  replay_glVertexAttribL3dEXT,
+  replay_glFramebufferRenderbuffer,
+  replay_glGetUniformLocationARB,
+  replay_glPathParameterfvNV,
+  replay_glVertexAttrib3sNV,
+  replay_glGetDoublei_v,
+  replay_glVertexAttrib1sv,
+  replay_glBindSampler,
+  replay_glLineWidth,
+  replay_glVertexArrayRangeAPPLE,
+  replay_glBindBufferOffsetEXT,
+  replay_glWeightfvARB,
+  replay_glGetIntegeri_v,
+  replay_glGetTransformFeedbackVarying,
+  replay_glProgramLocalParameter4fvARB,
+  replay_glGetTransformFeedbackVaryingNV,
+  replay_glWindowPos2iv,
+  replay_glVertexStream1dATI,
+  replay_glColorFragmentOp2ATI,
+  replay_glFogiv,
+  replay_glGetTextureHandleNV,
+  replay_glLightModeliv,
+  replay_glDepthRangef,
+  replay_glGetFragmentMaterialivSGIX,
+  replay_glVideoCaptureStreamParameterfvNV,
+  replay_glDeleteProgramsARB,
+  replay_glWindowPos3fvARB,
+  replay_glFeedbackBufferxOES,
+  replay_glGetTexBumpParameterfvATI,
+  replay_glEnablei,
+  replay_glGetActiveSubroutineName,
+  replay_glDrawBuffersARB,
+  replay_glBindProgramARB,
+  replay_glEvalCoord1fv,
+  replay_glProgramUniform3ui64vARB,
+  replay_glProgramUniformMatrix2dv,
+  replay_glMultiTexCoord2hvNV,
+  replay_glGetFloatIndexedvEXT,
+  replay_glSampleCoverageARB,
+  replay_glProgramUniform2ui64vARB,
+  replay_glPixelDataRangeNV,
+  replay_glVertexStream3svATI,
+  replay_glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN,
+  replay_glTexCoord3hvNV,
+  replay_glSampleMaski,
+  replay_glIndexFuncEXT,
+  replay_glPointParameteriNV,
+  replay_glUniformMatrix3x2fv,
+  replay_glGetFramebufferParameterivEXT,
+  replay_glUniform2i64ARB,
+  replay_glNamedBufferStorageEXT,
+  replay_glNamedFramebufferTexture3DEXT,
+  replay_glVertexAttrib2dv,
+  replay_glGetVertexArrayPointervEXT,
+  replay_glGetVertexAttribArrayObjectivATI,
+  replay_glProgramUniformMatrix3fvEXT,
+  replay_glEnableVertexArrayEXT,
+  replay_glColorTableParameterfvSGI,
+  replay_glEdgeFlag,
+  replay_glFogCoordf,
+  replay_glVertex3d,
+  replay_glVertex3f,
+  replay_glSpriteParameterivSGIX,
+  replay_glPathGlyphRangeNV,
+  replay_glPrimitiveBoundingBoxARB,
+  replay_glVertexAttribL3ui64vNV,
+  replay_glVertex3s,
+  replay_glTexCoordP2ui,
+  replay_glProgramUniform2fvEXT,
+  replay_glDeletePathsNV,
+  replay_glPrimitiveRestartIndexNV,
+  replay_glTexCoord2fColor3fVertex3fvSUN,
+  replay_glTexCoordPointerListIBM,
+  replay_glRectxOES,
+  replay_glCopyNamedBufferSubData,
+  replay_glGenProgramsNV,
+  replay_glFragmentLightfSGIX,
+  replay_glTexStorage3D,
+  replay_glTextureParameteriv,
+  replay_glNamedBufferDataEXT,
+  replay_glMultiTexCoord3fvARB,
+  replay_glUniformMatrix3x4fv,
+  replay_glSubpixelPrecisionBiasNV,
+  replay_glNormalPointer,
+  replay_glNamedFramebufferTexture,
+  replay_glVertexAttrib4NsvARB,
+  replay_glPassThrough,
+  replay_glSecondaryColorP3ui,
+  replay_glInvalidateTexSubImage,
+  replay_glIsImageHandleResidentARB,
+  replay_glTangent3fvEXT,
+  replay_glProgramUniformMatrix4x3fv,
+  replay_glBegin,
+  replay_glEvalCoord2dv,
+  replay_glColor3ubv,
+  replay_glFogCoordfvEXT,
+  replay_glVertexP3ui,
+  replay_glLightfv,
+  replay_glVertexAttribL3i64NV,
+  replay_glStencilClearTagEXT,
+  replay_glGetActiveUniformName,
+  replay_glTangentPointerEXT,
+  replay_glUniform4ui64vNV,
+  replay_glDebugMessageEnableAMD,
+  replay_glProgramUniform2ui,
+  replay_glCopyTexSubImage2DEXT,
+  replay_glGenRenderbuffersEXT,
+  replay_glNamedProgramLocalParameterI4ivEXT,
+  replay_glMultiTexCoord2f,
+  replay_glMapGrid2d,
+  replay_glGetMultiTexParameterIuivEXT,
+  replay_glBlendEquationiARB,
+  replay_glTexParameteriv,
+  replay_glUniform4ivARB,
+  replay_glMatrixOrthoEXT,
+  replay_glVertexArrayVertexBuffer,
+  replay_glProgramLocalParametersI4ivNV,
+  replay_glProgramUniform4ui64vNV,
+  replay_glGetNamedStringivARB,
+  replay_glVertexAttribL1i64vNV,
+  replay_glTransformFeedbackBufferBase,
+  replay_glIndexsv,
+  replay_glPointParameterivNV,
+  replay_glGetDetailTexFuncSGIS,
+  replay_glReplacementCodeuiColor3fVertex3fvSUN,
+  replay_glProgramLocalParameter4fARB,
+  replay_glBitmap,
+  replay_glNamedFramebufferTextureLayerEXT,
+  replay_glMultiTexGenfvEXT,
+  replay_glGetNamedBufferSubData,
+  replay_glStencilFuncSeparateATI,
+  replay_glProgramUniform2iv,
+  replay_glGetQueryiv,
+  replay_glTexCoord4f,
+  replay_glMapGrid2f,
+  replay_glListParameterivSGIX,
+  replay_glCreateQueries,
+  replay_glGetSamplerParameterfv,
+  replay_glTexCoord4i,
+  replay_glObjectLabel,
+  replay_glProgramUniform3i64NV,
+  replay_glGetTextureHandleARB,
+  replay_glTexCoord4s,
+  replay_glUniform4iARB,
+  replay_glGetUniformIndices,
+  replay_glMultiTexImage3DEXT,
+  replay_glCoverageModulationTableNV,
+  replay_glPointParameteriv,
+  replay_glMultiTexCoord4svARB,
+  replay_glNormal3fv,
+  replay_glProgramUniformMatrix3x4dvEXT,
+  replay_glTexCoord1fv,
+  replay_glProgramUniformMatrix4x3dvEXT,
+  replay_glGetActiveVaryingNV,
+  replay_glUniform1i64vARB,
+  replay_glMultiTexCoord1dv,
+  replay_glTexCoord3fv,
+  replay_glMatrixTranslatefEXT,
+  replay_glProgramUniform1ui64vNV,
+  replay_glTextureMaterialEXT,
+  replay_glMultiTexCoordP3uiv,
+  replay_glVertexAttribP3ui,
+  replay_glInterpolatePathsNV,
+  replay_glTextureBufferRange,
+  replay_glVertexAttribL2dEXT,
+  replay_glGetPixelTransformParameterivEXT,
+  replay_glTexCoord4xvOES,
+  replay_glGetVariantBooleanvEXT,
+  replay_glDepthRange,
+  replay_glGetVertexAttribdvARB,
+  replay_glGetColorTableParameterfv,
+  replay_glDrawArraysInstancedEXT,
+  replay_glDisableClientStateIndexedEXT,
+  replay_glDrawBuffer,
+  replay_glMultiDrawArraysIndirectBindlessNV,
+  replay_glGetnPixelMapusv,
+  replay_glRasterPos3fv,
+  replay_glClearBufferuiv,
+  replay_glGetInternalformati64v,
+  replay_glShaderSourceARB,
+  replay_glShaderOp3EXT,
+  replay_glWindowPos2dvMESA,
+  replay_glClearIndex,
+  replay_glProvokingVertexEXT,
+  replay_glVariantubvEXT,
+  replay_glFlush,
+  replay_glGetColorTableParameterivEXT,
+  replay_glPresentFrameDualFillNV,
+  replay_glGenVertexShadersEXT,
+  replay_glProgramUniformHandleui64vARB,
+  replay_glDepthRangefOES,
+  replay_glDrawElementsInstancedBaseVertexBaseInstance,
+  replay_glGetTexLevelParameteriv,
+  replay_glStencilFillPathNV,
+  replay_glWindowPos3iARB,
+  replay_glPrioritizeTextures,
+  replay_glWindowPos3fvMESA,
+  replay_glProgramUniformMatrix3x2dvEXT,
+  replay_glVertex4xvOES,
+  replay_glTexStorage3DMultisample,
+  replay_glWindowPos2sARB,
+  replay_glStencilOpValueAMD,
+  replay_glProgramVertexLimitNV,
+  replay_glGetTexParameterPointervAPPLE,
+  replay_glProgramUniform3uivEXT,
+  replay_glClampColor,
+  replay_glClearStencil,
+  replay_glTexCoordP1uiv,
+  replay_glVertexAttribs3svNV,
+  replay_glMultiTexCoord3fv,
+  replay_glVertexBlendEnvfATI,
+  replay_glIsFenceAPPLE,
+  replay_glGetBufferParameterui64vNV,
+  replay_glVertexAttribI4bvEXT,
+  replay_glUniform2fARB,
+  replay_glStopInstrumentsSGIX,
+  replay_glVertexAttrib3fNV,
+  replay_glMapVertexAttrib2dAPPLE,
+  replay_glVertex2f,
+  replay_glCopyTextureImage2DEXT,
+  replay_glVertex2d,
+  replay_glSecondaryColor3bvEXT,
+  replay_glMultiTexCoord4fARB,
+  replay_glPolygonOffset,
+  replay_glTangent3bvEXT,
+  replay_glHistogram,
+  replay_glGetProgramiv,
+  replay_glMatrixIndexubvARB,
+  replay_glVertex2s,
+  replay_glGetVertexAttribLui64vNV,
+  replay_glGetProgramStringARB,
+  replay_glFlushMappedBufferRange,
+  replay_glVertexAttribI3uiEXT,
+  replay_glLineWidthxOES,
+  replay_glProgramUniformMatrix2fvEXT,
+  replay_glGetTextureParameterIuivEXT,
+  replay_glGetMultiTexEnvivEXT,
+  replay_glPixelTexGenParameterivSGIS,
+  replay_glGenQueries,
+  replay_glGetPixelMapfv,
+  replay_glBlendColorEXT,
+  replay_glResetMinmax,
+  replay_glGetnUniformivARB,
+  replay_glVertexBlendARB,
+  replay_glVertexAttrib4d,
+  replay_glGetVaryingLocationNV,
+  replay_glGetMapAttribParameterivNV,
+  replay_glTexSubImage3D,
+  replay_glDeleteSamplers,
+  replay_glGetLightxOES,
+  replay_glGetVertexAttribArrayObjectfvATI,
+  replay_glVertexArrayNormalOffsetEXT,
+  replay_glGetBufferParameterivARB,
+  replay_glGetTextureParameterfv,
+  replay_glDrawMeshArraysSUN,
+  replay_glVertexAttrib4dNV,
+  replay_glGetMultisamplefvNV,
+  replay_glMapObjectBufferATI,
+  replay_glGetPathCommandsNV,
+  replay_glVertexArrayTexCoordOffsetEXT,
+  replay_glGetHistogram,
+  replay_glMatrixMode,
+  replay_glColorFormatNV,
+  replay_glProgramUniformui64NV,
+  replay_glProgramUniformMatrix4x2fvEXT,
+  replay_glLoadMatrixxOES,
+  replay_glGetColorTableParameterfvEXT,
+  replay_glRasterPos4i,
+  replay_glVertexAttribL2i64NV,
+  replay_glBindTextures,
+  replay_glMatrixRotatefEXT,
+  replay_glGetClipPlanexOES,
+  replay_glSecondaryColor3uivEXT,
+  replay_glGetPerfQueryInfoINTEL,
+  replay_glGetDoublev,
+  replay_glBindBufferRangeEXT,
+  replay_glCompressedTexImage2D,
+  replay_glMapBufferARB,
+  replay_glGetPathSpacingNV,
+  replay_glUniform4dv,
+  replay_glGlobalAlphaFactordSUN,
+  replay_glProgramUniform3dv,
+  replay_glGetShaderSourceARB,
+  replay_glVertexAttrib3dvARB,
+  replay_glInvalidateBufferData,
+  replay_glMatrixLoad3x2fNV,
+  replay_glCompressedTextureSubImage1D,
+  replay_glTexCoord3xvOES,
+  replay_glGenTexturesEXT,
+  replay_glTangent3iEXT,
+  replay_glClearTexImage,
+  replay_glBinormal3bvEXT,
+  replay_glUniform3fv,
+  replay_glGetnPixelMapusvARB,
+  replay_glMultiTexCoordP1ui,
+  replay_glClearNamedBufferDataEXT,
+  replay_glUniformMatrix4dv,
+  replay_glWindowPos3fMESA,
+  replay_glDeleteRenderbuffers,
+  replay_glGetTextureLevelParameterfvEXT,
+  replay_glGetHistogramParameterxvOES,
+  replay_glMultiDrawElements,
+  replay_glMakeImageHandleNonResidentNV,
+  replay_glTexSubImage1DEXT,
+  replay_glNormalStream3dATI,
+  replay_glVertexAttribL4i64vNV,
+  replay_glDrawBuffers,
+  replay_glCopyTextureSubImage1DEXT,
+  replay_glWindowRectanglesEXT,
+  replay_glNamedFramebufferReadBuffer,
+  replay_glUniform2i64vARB,
+  replay_glVertexAttribI1uivEXT,
+  replay_glGetTexGenfv,
+  replay_glBeginQueryARB,
+  replay_glUniform1iARB,
+  replay_glVertex4bvOES,
+  replay_glInvalidateSubFramebuffer,
+  replay_glUniform1fvARB,
+  replay_glTestFenceNV,
+  replay_glBindTransformFeedback,
+  replay_glMultiTexCoord2iv,
+  replay_glCopyMultiTexSubImage1DEXT,
+  replay_glVariantbvEXT,
+  replay_glTexCoord1hNV,
+  replay_glGenFencesNV,
+  replay_glRasterPos3iv,
+  replay_glVertexAttribL2ui64NV,
+  replay_glMultiTexCoord1hvNV,
+  replay_glGetnConvolutionFilter,
+  replay_glNormal3bv,
+  replay_glWeightbvARB,
+  replay_glTexCoord4sv,
+  replay_glUniform2uiv,
+  replay_glBeginConditionalRenderNVX,
+  replay_glFinish,
+  replay_glColorTableParameterfv,
+  replay_glFragmentCoverageColorNV,
+  replay_glProgramUniform3ivEXT,
+  replay_glVertexArrayVertexOffsetEXT,
+  replay_glViewportPositionWScaleNV,
+  replay_glGetProgramLocalParameterIuivNV,
+  replay_glReplacementCodeuiTexCoord2fVertex3fvSUN,
+  replay_glUniform1uiv,
+  replay_glUniformMatrix2dv,
+  replay_glIndexdv,
+  replay_glSecondaryColor3ivEXT,
+  replay_glTexCoord3iv,
+  replay_glVertexStream4fvATI,
+  replay_glDeformationMap3fSGIX,
+  replay_glClearDepth,
+  replay_glGenAsyncMarkersSGIX,
+  replay_glDisableIndexedEXT,
+  replay_glVertexWeightfvEXT,
+  replay_glGetProgramLocalParameterIivNV,
+  replay_glCompressedTexImage3DARB,
+  replay_glProgramParameter4fNV,
+  replay_glConvolutionParameterxOES,
+  replay_glInsertComponentEXT,
+  replay_glCreateTextures,
+  replay_glSecondaryColor3iv,
+  replay_glCreateBuffers,
+  replay_glMultiTexCoord2xvOES,
+  replay_glTexGenxvOES,
+  replay_glMultTransposeMatrixf,
+  replay_glBeginTransformFeedbackEXT,
+  replay_glTexCoord2fColor3fVertex3fSUN,
+  replay_glNormal3sv,
+  replay_glFreeObjectBufferATI,
+  replay_glBlendBarrierNV,
+  replay_glUniform4i64vNV,
+  replay_glGetnUniformuivARB,
+  replay_glAlphaFragmentOp3ATI,
+  replay_glProgramEnvParameters4fvEXT,
+  replay_glBlendFuncSeparateEXT,
+  replay_glConvolutionParameterivEXT,
+  replay_glPixelTexGenSGIX,
+  replay_glDeleteProgram,
+  replay_glUniformMatrix4x3dv,
+  replay_glGetVideoCaptureStreamivNV,
+  replay_glProgramUniform4uiEXT,
+  replay_glMakeImageHandleNonResidentARB,
+  replay_glSecondaryColor3dEXT,
+  replay_glDeleteQueries,
+  replay_glNormalP3uiv,
+  replay_glRasterPos2d,
+  replay_glInitNames,
+  replay_glBinormal3fvEXT,
+  replay_glColor3dv,
+  replay_glVertexArrayVertexAttribDivisorEXT,
+  replay_glArrayElementEXT,
+  replay_glProgramParameter4dNV,
+  replay_glIndexxOES,
+  replay_glUniform3uivEXT,
+  replay_glPopGroupMarkerEXT,
+  replay_glClearNamedFramebufferuiv,
+  replay_glSetLocalConstantEXT,
+  replay_glProgramUniform1ui64NV,
+  replay_glColor4hvNV,
+  replay_glGetVertexAttribfv,
+  replay_glDispatchCompute,
+  replay_glGetActiveAttrib,
+  replay_glFragmentColorMaterialSGIX,
+  replay_glTexSubImage2D,
+  replay_glGetnMinmaxARB,
+  replay_glLogicOp,
+  replay_glProgramUniformMatrix3x4fv,
+  replay_glWindowPos4iMESA,
+  replay_glPixelTransferf,
+  replay_glGetTextureParameterIuiv,
+  replay_glMultiTexCoord1xOES,
+  replay_glProgramUniformMatrix4dv,
+  replay_glGetnUniformiv,
+  replay_glFramebufferTexture1DEXT,
+  replay_glVertexPointervINTEL,
+  replay_glTextureParameterIiv,
+  replay_glGetSeparableFilterEXT,
+  replay_glMultiTexCoord3iARB,
+  replay_glRasterPos4xvOES,
+  replay_glDrawTransformFeedbackStream,
+  replay_glVertex3hvNV,
+  replay_glVertexArrayMultiTexCoordOffsetEXT,
+  replay_glProvokingVertex,
+  replay_glAccumxOES,
+  replay_glShaderBinary,
+  replay_glGetMultiTexGenivEXT,
+  replay_glPointParameterxvOES,
+  replay_glCreateStatesNV,
+  replay_glClearDepthdNV,
+  replay_glClearColorIuiEXT,
+  replay_glBindMultiTextureEXT,
+  replay_glTexGeniv,
+  replay_glDrawElements,
+  replay_glProgramUniform4iv,
+  replay_glDisableVertexArrayEXT,
+  replay_glProgramUniform3ui64NV,
+  replay_glClientActiveTexture,
+  replay_glMultiTexParameterIivEXT,
+  replay_glUniform1i64ARB,
+  replay_glUniform1iv,
+  replay_glVertexAttribArrayObjectATI,
+  replay_glUniform2iARB,
+  replay_glDrawArraysInstanced,
+  replay_glVertexAttrib2sNV,
+  replay_glTexBufferEXT,
+  replay_glVertexStream2fATI,
+  replay_glDebugMessageCallbackAMD,
+  replay_glSamplerParameteriv,
+  replay_glVertexAttrib4uiv,
+  replay_glEndQueryIndexed,
+  replay_glNormalStream3sATI,
+  replay_glProgramParameteriARB,
+  replay_glTexEnvxOES,
+  replay_glProgramUniform1iv,
+  replay_glDisableVertexAttribAPPLE,
+  replay_glBindRenderbuffer,
+  replay_glMultiTexSubImage3DEXT,
+  replay_glIsProgram,
+  replay_glMultiDrawElementsIndirectAMD,
+  replay_glGetProgramInfoLog,
+  replay_glGetLocalConstantBooleanvEXT,
+  replay_glPixelTransformParameteriEXT,
+  replay_glTexCoord4bOES,
+  replay_glVertexAttrib4fv,
+  replay_glProgramUniformMatrix2x3dv,
+  replay_glProgramEnvParametersI4uivNV,
+  replay_glTexCoord3xOES,
+  replay_glLoadTransposeMatrixfARB,
+  replay_glImageTransformParameteriHP,
+  replay_glMultiTexCoord4xOES,
+  replay_glVertexAttribs3fvNV,
+  replay_glVertexAttrib2fv,
+  replay_glUniform3ui64NV,
+  replay_glCombinerParameterfvNV,
+  replay_glFragmentMaterialiSGIX,
+  replay_glGetBooleani_v,
+  replay_glGetProgramResourceIndex,
+  replay_glBeginConditionalRenderNV,
+  replay_glDisableClientState,
+  replay_glPathFogGenNV,
+  replay_glStencilThenCoverFillPathNV,
+  replay_glVertexArrayIndexOffsetEXT,
+  replay_glProgramBufferParametersIuivNV,
+  replay_glPixelTransformParameterivEXT,
+  replay_glDisableClientStateiEXT,
+  replay_glTexBufferARB,
+  replay_glGetLocalConstantIntegervEXT,
+  replay_glColor4uiv,
+  replay_glProgramUniform3i,
+  replay_glMultiDrawElementsIndirectBindlessCountNV,
+  replay_glGetBufferPointervARB,
+  replay_glMultiTexParameterIuivEXT,
+  replay_glEvalMesh2,
+  replay_glEvalMesh1,
+  replay_glProgramUniform3f,
+  replay_glStencilThenCoverFillPathInstancedNV,
+  replay_glProgramUniform3d,
+  replay_glMapVertexAttrib1dAPPLE,
+  replay_glEvalCoord2fv,
+  replay_glGetUniformivARB,
+  replay_glLoadTransposeMatrixd,
+  replay_glLoadTransposeMatrixf,
+  replay_glGetPointervEXT,
+  replay_glEndConditionalRenderNV,
+  replay_glTexCoord2fNormal3fVertex3fSUN,
+  replay_glUniform3i64vARB,
+  replay_glProgramUniform2uiEXT,
+  replay_glVertexAttribI1ui,
+  replay_glProgramNamedParameter4dvNV,
+  replay_glCompileCommandListNV,
+  replay_glGetRenderbufferParameterivEXT,
+  replay_glGetnPolygonStipple,
+  replay_glIsBufferResidentNV,
+  replay_glSecondaryColor3ubvEXT,
+  replay_glGetNamedRenderbufferParameterivEXT,
+  replay_glNamedFramebufferSampleLocationsfvARB,
+  replay_glMultiTexGendvEXT,
+  replay_glVertexArrayRangeNV,
+  replay_glIsTextureHandleResidentNV,
+  replay_glGetProgramEnvParameterdvARB,
+  replay_glIsNamedStringARB,
+  replay_glSecondaryColorFormatNV,
+  replay_glVertexAttrib4ubvNV,
+  replay_glTagSampleBufferSGIX,
+  replay_glVDPAUUnregisterSurfaceNV,
+  replay_glGetPerfQueryIdByNameINTEL,
+  replay_glGetInteger64v,
+  replay_glClipPlane,
+  replay_glColor4ubVertex3fSUN,
+  replay_glIndexub,
+  replay_glGetProgramEnvParameterfvARB,
+  replay_glVertexAttrib4usvARB,
+  replay_glNamedFramebufferRenderbuffer,
+  replay_glProgramUniformMatrix3x4dv,
+  replay_glTestFenceAPPLE,
+  replay_glVertexAttrib4Niv,
+  replay_glVertexAttribL2i64vNV,
+  replay_glColorP4uiv,
+  replay_glUniformMatrix2x3fv,
+  replay_glCallCommandListNV,
+  replay_glClearBufferiv,
+  replay_glNamedStringARB,
+  replay_glMatrixMult3x2fNV,
+  replay_glGetNamedProgramStringEXT,
+  replay_glGetnHistogramARB,
+  replay_glGetTextureLevelParameterfv,
+  replay_glMultiTexCoord1fv,
+  replay_glBitmapxOES,
+  replay_glGetSamplerParameterIuiv,
+  replay_glTexCoordP3ui,
+  replay_glTextureSubImage1D,
+  replay_glVertexAttribLPointerEXT,
+  replay_glFogCoordPointerEXT,
+  replay_glWindowPos3s,
+  replay_glVertexAttribs2svNV,
+  replay_glTextureImage3DEXT,
+  replay_glWindowPos3i,
+  replay_glWindowPos3d,
+  replay_glWindowPos3f,
+  replay_glIsEnabledIndexedEXT,
+  replay_glGetNamedProgramivEXT,
+  replay_glVertex3xvOES,
+  replay_glColor3us,
+  replay_glBeginPerfMonitorAMD,
+  replay_glProgramUniformMatrix4x3dv,
+  replay_glGetNamedProgramLocalParameterIuivEXT,
+  replay_glReadnPixels,
+  replay_glMultiTexCoord4f,
+  replay_glColor3ub,
+  replay_glMultiTexCoord4d,
+  replay_glVertexAttribL3ui64NV,
+  replay_glColor3ui,
+  replay_glProgramUniform4fvEXT,
+  replay_glVertexAttrib2sARB,
+  replay_glMultiTexCoord4i,
+  replay_glCheckFramebufferStatusEXT,
+  replay_glGetnMapivARB,
+  replay_glMultiTexCoord1ivARB,
+  replay_glDisableVertexAttribArrayARB,
+  replay_glGetPolygonStipple,
+  replay_glVertexAttribI4ui,
+  replay_glGetPathDashArrayNV,
+  replay_glMultiTexRenderbufferEXT,
+  replay_glCopyTextureSubImage1D,
+  replay_glDeleteOcclusionQueriesNV,
+  replay_glVertex4hvNV,
+  replay_glGetnTexImage,
+  replay_glProgramLocalParameter4dARB,
+  replay_glBlendEquation,
+  replay_glUnlockArraysEXT,
+  replay_glGetQueryObjectui64vEXT,
+  replay_glVertexAttribI4uivEXT,
+  replay_glUniform1i64vNV,
+  replay_glMultiTexCoord3dv,
+  replay_glColor4sv,
+  replay_glVertexStream4ivATI,
+  replay_glPopClientAttrib,
+  replay_glClearBufferData,
+  replay_glGetProgramivNV,
+  replay_glBeginTransformFeedback,
+  replay_glFinishObjectAPPLE,
+  replay_glGetMinmaxParameterivEXT,
+  replay_glColor3iv,
+  replay_glVertexAttrib3sv,
+  replay_glCompressedTexImage1D,
+  replay_glDeleteTransformFeedbacks,
+  replay_glGetVideoi64vNV,
+  replay_glDrawRangeElementsBaseVertex,
+  replay_glUniform4i64vARB,
+  replay_glTextureStorage3DMultisampleEXT,
+  replay_glGetTexParameterfv,
+  replay_glProgramUniformui64vNV,
+  replay_glCompressedMultiTexImage1DEXT,
+  replay_glProgramUniform2ivEXT,
+  replay_glPushGroupMarkerEXT,
+  replay_glVertexAttrib1dv,
+  replay_glMatrixLoadIdentityEXT,
+  replay_glMultTransposeMatrixxOES,
+  replay_glGetPixelMapxv,
+  replay_glFramebufferSampleLocationsfvARB,
+  replay_glGetLightiv,
+  replay_glBlendFuncSeparatei,
+  replay_glGetBooleanIndexedvEXT,
+  replay_glGetProgramSubroutineParameteruivNV,
+  replay_glUniform2ui,
+  replay_glApplyFramebufferAttachmentCMAAINTEL,
+  replay_glWindowPos2fv,
+  replay_glDisablei,
+  replay_glSelectPerfMonitorCountersAMD,
+  replay_glGetVertexAttribLi64vNV,
+  replay_glBlendFuncSeparateiARB,
+  replay_glWeightuivARB,
+  replay_glWindowPos2iARB,
+  replay_glGetProgramLocalParameterdvARB,
+  replay_glGetUniformui64vARB,
+  replay_glGetSynciv,
+  replay_glMakeImageHandleResidentARB,
+  replay_glGetProgramNamedParameterfvNV,
+  replay_glTextureStorage3D,
+  replay_glVertexAttrib4svNV,
+  replay_glProgramUniform2i,
+  replay_glListDrawCommandsStatesClientNV,
+  replay_glProgramLocalParametersI4uivNV,
+  replay_glBeginTransformFeedbackNV,
+  replay_glGetProgramBinary,
+  replay_glBinormal3iEXT,
+  replay_glEvalPoint1,
+  replay_glEvalPoint2,
+  replay_glPauseTransformFeedback,
+  replay_glWindowPos2sMESA,
+  replay_glGlobalAlphaFactorbSUN,
+  replay_glCreateTransformFeedbacks,
+  replay_glTexturePageCommitmentEXT,
+  replay_glTransformFeedbackVaryingsNV,
+  replay_glTexSubImage1D,
+  replay_glConvolutionParameterfvEXT,
+  replay_glBlitFramebufferEXT,
+  replay_glUniformMatrix4fvARB,
+  replay_glProgramEnvParameter4dvARB,
+  replay_glSecondaryColor3hNV,
+  replay_glVertexAttribP3uiv,
+  replay_glFogCoordFormatNV,
+  replay_glGetMultiTexLevelParameterivEXT,
+  replay_glIsOcclusionQueryNV,
+  replay_glCompressedTexImage2DARB,
+  replay_glGetProgramEnvParameterIuivNV,
+  replay_glVertexAttrib4sv,
+  replay_glVertexAttrib4fvARB,
+  replay_glLoadName,
+  replay_glBindVertexShaderEXT,
+  replay_glGetNamedProgramLocalParameterIivEXT,
+  replay_glProgramUniform3uiEXT,
+  replay_glProgramUniformMatrix4x2dvEXT,
+  replay_glTexCoord1hvNV,
+  replay_glLoadMatrixd,
+  replay_glTexParameterfv,
+  replay_glVariantdvEXT,
+  replay_glCullParameterfvEXT,
+  replay_glUniform3dv,
+  replay_glProgramUniform3fv,
+  replay_glIsBufferARB,
+  replay_glMultiTexCoord1bOES,
+  replay_glFogCoordhNV,
+  replay_glFramebufferSampleLocationsfvNV,
+  replay_glGenSymbolsEXT,
+  replay_glGetConvolutionFilter,
+  replay_glProgramUniform1fvEXT,
+  replay_glGetNextPerfQueryIdINTEL,
+  replay_glCompressedTexImage1DARB,
+  replay_glBindSamplers,
+  replay_glGetProgramEnvParameterIivNV,
+  replay_glGetQueryObjectui64v,
+  replay_glVertexAttribL4ui64vNV,
+  replay_glGetVideoivNV,
+  replay_glGetTextureImage,
+  replay_glProgramUniform1fv,
+  replay_glUniformMatrix4fv,
+  replay_glColorMask,
+  replay_glBeginFragmentShaderATI,
+  replay_glMultiDrawArraysEXT,
+  replay_glGenNamesAMD,
+  replay_glPathParameteriNV,
+  replay_glCreateCommandListsNV,
+  replay_glDeleteProgramPipelines,
+  replay_glCopyColorSubTableEXT,
+  replay_glVariantsvEXT,
+  replay_glGenProgramPipelines,
+  replay_glVertexArrayEdgeFlagOffsetEXT,
+  replay_glWindowPos2s,
+  replay_glSecondaryColor3iEXT,
+  replay_glWindowPos2i,
+  replay_glWindowPos2f,
+  replay_glWindowPos2d,
+  replay_glUniform4uivEXT,
+  replay_glOrthoxOES,
+  replay_glUniformSubroutinesuiv,
+  replay_glRectdv,
+  replay_glProgramUniform1i64vNV,
+  replay_glVertexAttribI4uiEXT,
+  replay_glSecondaryColor3ubEXT,
+  replay_glCompressedMultiTexSubImage1DEXT,
+  replay_glMultiTexGendEXT,
+  replay_glColorP3uiv,
+  replay_glFogCoordfv,
+  replay_glCompileShader,
+  replay_glTexCoord2hNV,
+  replay_glUniform1uivEXT,
+  replay_glMatrixLoadTransposedEXT,
+  replay_glIndexfv,
+  replay_glGetCompressedTextureImage,
+  replay_glGetUniformuivEXT,
+  replay_glGetnPixelMapfvARB,
+  replay_glFramebufferTextureEXT,
+  replay_glVertexAttribIPointer,
+  replay_glMultiTexCoordP3ui,
+  replay_glEvaluateDepthValuesARB,
+  replay_glGetNamedBufferParameteriv,
+  replay_glGetNamedProgramLocalParameterfvEXT,
+  replay_glColor4fNormal3fVertex3fvSUN,
+  replay_glSeparableFilter2DEXT,
+  replay_glTexParameterxOES,
+  replay_glClearAccumxOES,
+  replay_glInvalidateFramebuffer,
+  replay_glWeightubvARB,
+  replay_glVertexAttrib1d,
+  replay_glVertexAttrib1f,
+  replay_glVertex4fv,
+  replay_glClearNamedFramebufferfi,
+  replay_glGetQueryBufferObjectuiv,
+  replay_glClearNamedFramebufferfv,
+  replay_glEndVertexShaderEXT,
+  replay_glVertexAttrib1s,
+  replay_glMultiTexCoord4dvARB,
+  replay_glMultiTexCoord1sv,
+  replay_glUniform1ui64vNV,
+  replay_glGetClipPlanefOES,
+  replay_glRasterPos2s,
+  replay_glWeightivARB,
+  replay_glMultiTexCoord4hvNV,
+  replay_glNormal3hNV,
+  replay_glGetSeparableFilter,
+  replay_glGetPathTexGenivNV,
+  replay_glColor4bv,
+  replay_glRasterPos2f,
+  replay_glNamedBufferPageCommitmentARB,
+  replay_glLoadIdentity,
+  replay_glRasterPos2i,
+  replay_glRasterPos4iv,
+  replay_glMultiTexCoord2fvARB,
+  replay_glUniformMatrix4x3fv,
+  replay_glClearBufferfv,
+  replay_glMultiTexCoord4hNV,
+  replay_glTextureBarrier,
+  replay_glReplacementCodeuivSUN,
+  replay_glDeleteAsyncMarkersSGIX,
+  replay_glTexCoord2bvOES,
+  replay_glEvalCoord2xOES,
+  replay_glGetSharpenTexFuncSGIS,
+  replay_glProgramUniformHandleui64vNV,
+  replay_glIglooInterfaceSGIX,
+  replay_glWindowPos2dvARB,
+  replay_glClearBufferfi,
+  replay_glDrawArraysIndirect,
+  replay_glGenVertexArrays,
+  replay_glGetTransformFeedbacki64_v,
+  replay_glEnableVertexArrayAttrib,
+  replay_glProgramUniformMatrix3x2dv,
+  replay_glVertexStream4fATI,
+  replay_glVertexBindingDivisor,
+  replay_glGetSamplerParameterIiv,
+  replay_glGetCoverageModulationTableNV,
+  replay_glDepthRangedNV,
+  replay_glVertexAttrib3f,
+  replay_glMultiDrawRangeElementArrayAPPLE,
+  replay_glVertexAttribFormatNV,
+  replay_glGetQueryBufferObjecti64v,
+  replay_glGetVertexAttribdv,
+  replay_glGetUniformi64vARB,
+  replay_glAreTexturesResidentEXT,
+  replay_glGetHandleARB,
+  replay_glVideoCaptureStreamParameterdvNV,
+  replay_glMapParameterivNV,
+  replay_glIsVertexArray,
+  replay_glSecondaryColor3sEXT,
+  replay_glGetTexParameterIivEXT,
+  replay_glFrameTerminatorGREMEDY,
+  replay_glBlendBarrierKHR,
+  replay_glVertexAttrib4NubARB,
+  replay_glPrimitiveRestartNV,
+  replay_glVertexAttribL1ui64vARB,
+  replay_glVertexAttribI4ivEXT,
+  replay_glVertexAttribs4svNV,
+  replay_glUniform1ui,
+  replay_glVertexAttrib2fvARB,
+  replay_glVertexAttribI4svEXT,
+  replay_glTextureImage3DMultisampleCoverageNV,
+  replay_glMemoryBarrier,
+  replay_glGetVariantArrayObjectfvATI,
+  replay_glTexCoord4fColor4fNormal3fVertex4fvSUN,
+  replay_glIsProgramARB,
+  replay_glBindImageTextureEXT,
+  replay_glGetFragDataLocation,
+  replay_glMultiTexCoord1svARB,
+  replay_glGetMapxvOES,
+  replay_glTextureStorage2DMultisampleEXT,
+  replay_glGetMaterialfv,
+  replay_glVertexAttrib4NbvARB,
+  replay_glPixelMapuiv,
+  replay_glColorPointerEXT,
+  replay_glEnableClientStateiEXT,
+  replay_glClearTexSubImage,
+  replay_glEvalCoord1xvOES,
+  replay_glDetachObjectARB,
+  replay_glGetTextureParameterIiv,
+  replay_glVariantusvEXT,
+  replay_glCompressedTextureImage3DEXT,
+  replay_glMultiTexCoord1dARB,
+  replay_glGetVertexArrayIntegeri_vEXT,
+  replay_glVertexAttribI4ubv,
+  replay_glPixelTexGenParameterfSGIS,
+  replay_glProgramUniformMatrix4x2dv,
+  replay_glUniform3fARB,
+  replay_glIsShader,
+  replay_glConvolutionParameteriv,
+  replay_glCopyMultiTexSubImage2DEXT,
+  replay_glEnableVertexAttribArrayARB,
+  replay_glEnable,
+  replay_glGetActiveUniformsiv,
+  replay_glGetVertexAttribivARB,
+  replay_glTexCoord4hvNV,
+  replay_glUseProgramObjectARB,
+  replay_glGetAttribLocation,
+  replay_glVertexAttrib4dv,
+  replay_glGetTextureParameteriv,
+  replay_glPathSubCoordsNV,
+  replay_glMatrixIndexusvARB,
+  replay_glGetVideouivNV,
+  replay_glGetVideoCaptureivNV,
+  replay_glProgramUniform3ui,
+  replay_glVertexAttrib3svARB,
+  replay_glGetNamedBufferParameterivEXT,
+  replay_glMatrixScaledEXT,
+  replay_glProgramUniformMatrix2x3fv,
+  replay_glGetFragmentLightivSGIX,
+  replay_glWindowPos2svARB,
+  replay_glVertexAttrib2svNV,
+  replay_glWindowPos2ivARB,
+  replay_glGetVertexAttribPointervNV,
+  replay_glPushMatrix,
+  replay_glEdgeFlagPointerListIBM,
+  replay_glGenerateMipmapEXT,
+  replay_glWindowPos3sv,
+  replay_glPathCoordsNV,
+  replay_glProgramUniform1i,
+  replay_glProgramUniform1d,
+  replay_glProgramUniform1f,
+  replay_glProgramParameteriEXT,
+  replay_glCompressedMultiTexImage2DEXT,
+  replay_glProgramUniform3iv,
+  replay_glIndexiv,
+  replay_glMultiTexCoord4xvOES,
+  replay_glEGLImageTargetTexture2DOES,
+  replay_glPixelZoom,
+  replay_glVertex3bvOES,
+  replay_glFramebufferReadBufferEXT,
+  replay_glExtractComponentEXT,
+  replay_glCombinerParameterivNV,
+  replay_glMinmax,
+  replay_glGenBuffersARB,
+  replay_glColor3usv,
+  replay_glBlendEquationi,
+  replay_glGetFogFuncSGIS,
+  replay_glVertexAttrib4fvNV,
+  replay_glGetnMinmax,
+  replay_glFragmentLightiSGIX,
+  replay_glMultiTexCoord1bvOES,
+  replay_glSecondaryColorPointerEXT,
+  replay_glMultiTexCoordP4uiv,
+  replay_glGetBufferSubDataARB,
+  replay_glGetPathParameterivNV,
+  replay_glFlushRasterSGIX,
+  replay_glElementPointerATI,
+  replay_glGetAttachedObjectsARB,
+  replay_glUniform4iv,
+  replay_glFogxOES,
+  replay_glSharpenTexFuncSGIS,
+  replay_glClearDepthfOES,
+  replay_glDeleteCommandListsNV,
+  replay_glVertex4hNV,
+  replay_glSecondaryColor3dvEXT,
+  replay_glGenTextures,
+  replay_glTextureStorage2DMultisample,
+  replay_glUniform3ui64vNV,
+  replay_glBlendFuncSeparateIndexedAMD,
+  replay_glMakeBufferResidentNV,
+  replay_glShaderOp2EXT,
+  replay_glGetVertexAttribivNV,
+  replay_glTexParameterIivEXT,
+  replay_glGetPerfQueryDataINTEL,
+  replay_glVertexAttrib4dvARB,
+  replay_glTextureSubImage1DEXT,
+  replay_glGetActiveUniformBlockName,
+  replay_glVertexAttrib2dvARB,
+  replay_glVertexAttribPointer,
+  replay_glDepthBoundsdNV,
+  replay_glDeleteTexturesEXT,
+  replay_glDrawBuffersATI,
+  replay_glLightModelxvOES,
+  replay_glApplyTextureEXT,
+  replay_glGetImageHandleNV,
+  replay_glGetMinmax,
+  replay_glGetFixedvOES,
+  replay_glSamplePatternEXT,
+  replay_glUniform1f,
+  replay_glColor4fNormal3fVertex3fSUN,
+  replay_glFogCoorddvEXT,
+  replay_glCopyTextureImage1DEXT,
+  replay_glFlushMappedBufferRangeAPPLE,
+  replay_glVertex3sv,
+  replay_glFlushStaticDataIBM,
+  replay_glProgramUniform4ui64NV,
+  replay_glRasterPos4xOES,
+  replay_glVertexAttribP1ui,
+  replay_glProgramUniform4dvEXT,
+  replay_glEndTransformFeedbackEXT,
+  replay_glBinormal3dEXT,
+  replay_glGetTextureSubImage,
+  replay_glGetNamedRenderbufferParameteriv,
+  replay_glBindBuffersRange,
+  replay_glFinishAsyncSGIX,
+  replay_glBindFragDataLocationIndexed,
+  replay_glMultiTexCoord2dv,
+  replay_glUniform2iv,
+  replay_glProgramUniform2i64vNV,
+  replay_glFlushVertexArrayRangeAPPLE,
+  replay_glTextureParameterf,
+  replay_glMultiTexCoord3dvARB,
+  replay_glFeedbackBuffer,
+  replay_glDebugMessageInsertARB,
+  replay_glMultiTexCoord2i,
+  replay_glTextureSubImage3D,
+  replay_glFramebufferTexture1D,
+  replay_glGetShaderiv,
+  replay_glMultiTexCoord2d,
+  replay_glArrayObjectATI,
+  replay_glGetPointeri_vEXT,
+  replay_glGetPerfMonitorCountersAMD,
+  replay_glNamedBufferStorage,
+  replay_glTexEnvxvOES,
+  replay_glProgramUniform2ui64NV,
+  replay_glMultiTexCoord3bOES,
+  replay_glUniform1dv,
+  replay_glPixelTransferi,
+  replay_glSecondaryColor3usvEXT,
+  replay_glProgramEnvParameterI4uivNV,
+  replay_glVertex2sv,
+  replay_glWindowPos4dMESA,
+  replay_glDebugMessageControlARB,
+  replay_glIsTextureEXT,
+  replay_glFragmentMaterialivSGIX,
+  replay_glLinkProgramARB,
+  replay_glFinishFenceAPPLE,
+  replay_glVertexArrayVertexAttribBindingEXT,
+  replay_glMultiTexCoord4fv,
+  replay_glRasterPos3i,
+  replay_glRasterPos3d,
+  replay_glPollAsyncSGIX,
+  replay_glRasterPos3f,
+  replay_glCompressedTexImage3D,
+  replay_glVariantivEXT,
+  replay_glUnmapTexture2DINTEL,
+  replay_glGetVertexAttribiv,
+  replay_glGetPathCoordsNV,
+  replay_glColor4xvOES,
+  replay_glVertexAttrib3fv,
+  replay_glRasterPos3s,
+  replay_glVertex4bOES,
+  replay_glTransformFeedbackVaryingsEXT,
+  replay_glCombinerOutputNV,
+  replay_glWindowPos4sMESA,
+  replay_glVertexAttrib4svARB,
+  replay_glIsList,
+  replay_glGetInfoLogARB,
+  replay_glUniformMatrix2fv,
+  replay_glVertexAttribs3dvNV,
+  replay_glGlobalAlphaFactorsSUN,
+  replay_glGetTrackMatrixivNV,
+  replay_glTextureParameterfvEXT,
+  replay_glIsNamedBufferResidentNV,
+  replay_glProgramUniform4ui64vARB,
+  replay_glTbufferMask3DFX,
+  replay_glCoverFillPathNV,
+  replay_glVertexAttrib1fvARB,
+  replay_glGenerateTextureMipmap,
+  replay_glNamedProgramLocalParameterI4uivEXT,
+  replay_glMultiDrawElementsBaseVertex,
+  replay_glProgramSubroutineParametersuivNV,
+  replay_glProgramUniformMatrix2x4dvEXT,
+  replay_glRotatexOES,
+  replay_glMemoryBarrierEXT,
+  replay_glVertexAttrib3svNV,
+  replay_glVertexStream3iATI,
+  replay_glCompressedTexSubImage1D,
+  replay_glSetFenceNV,
+  replay_glAttachObjectARB,
+  replay_glCopyConvolutionFilter1D,
+  replay_glProgramParameters4fvNV,
+  replay_glNamedFramebufferParameteriEXT,
+  replay_glVertexAttrib4Nsv,
+  replay_glVertexAttribI4usvEXT,
+  replay_glTextureBufferRangeEXT,
+  replay_glVertexP3uiv,
+  replay_glIsPathNV,
+  replay_glGetnUniformi64vARB,
+  replay_glFramebufferTextureMultiviewOVR,
+  replay_glCompressedMultiTexSubImage2DEXT,
+  replay_glGetnMapdv,
+  replay_glDebugMessageCallback,
+  replay_glTangent3svEXT,
+  replay_glVertexAttribParameteriAMD,
+  replay_glBufferSubDataARB,
+  replay_glGetVertexAttribLui64vARB,
+  replay_glVertexAttribL4ui64NV,
+  replay_glReplacementCodeuiColor4ubVertex3fSUN,
+  replay_glImageTransformParameterfHP,
+  replay_glMap1f,
+  replay_glRasterPos4fv,
+  replay_glVertex2bvOES,
+  replay_glGetMapControlPointsNV,
+  replay_glNamedProgramLocalParametersI4ivEXT,
+  replay_glBindBufferRangeNV,
+  replay_glVertexStream3dvATI,
+  replay_glNormalPointerListIBM,
+  replay_glFogFuncSGIS,
+  replay_glMultiModeDrawArraysIBM,
+  replay_glGetNamedFramebufferAttachmentParameterivEXT,
+  replay_glGetFloatv,
+  replay_glVertexArrayVertexAttribIFormatEXT,
+  replay_glHint,
+  replay_glPointAlongPathNV,
+  replay_glVertexStream2svATI,
+  replay_glMultiDrawArraysIndirect,
+  replay_glVertexAttribP2uiv,
+  replay_glProgramUniform1i64vARB,
+  replay_glFramebufferTextureARB,
+  replay_glPushClientAttribDefaultEXT,
+  replay_glScalef,
+  replay_glScaled,
+  replay_glGetConvolutionParameterxvOES,
+  replay_glGetProgramResourceName,
+  replay_glCopyColorTable,
+  replay_glDepthRangeArrayv,
+  replay_glCoverFillPathInstancedNV,
+  replay_glMultiTexParameterivEXT,
+  replay_glGetActiveAtomicCounterBufferiv,
+  replay_glStencilOpSeparate,
+  replay_glVertexAttrib4fNV,
+  replay_glGetColorTableParameterivSGI,
+  replay_glVertexArrayAttribBinding,
+  replay_glProgramParameters4dvNV,
+  replay_glVertexAttribL4dv,
+  replay_glVertexStream3dATI,
+  replay_glGetUniformOffsetEXT,
+  replay_glGetVertexAttribPointerv,
+  replay_glProgramUniform3i64vNV,
+  replay_glTangent3fEXT,
+  replay_glGetPathMetricRangeNV,
+  replay_glWindowPos2iMESA,
+  replay_glVertex2xvOES,
+  replay_glGetnCompressedTexImage,
+  replay_glWindowPos2dv,
+  replay_glReplacementCodeuiVertex3fSUN,
+  replay_glGetTransformFeedbackVaryingEXT,
+  replay_glWindowPos3fARB,
+  replay_glMapNamedBufferEXT,
+  replay_glDisable,
+  replay_glIsPointInFillPathNV,
+  replay_glVertexAttribI2uiEXT,
+  replay_glProgramUniform4uiv,
+  replay_glQueryCounter,
+  replay_glFramebufferRenderbufferEXT,
+  replay_glBinormal3svEXT,
+  replay_glBindBufferOffsetNV,
+  replay_glCopyTextureSubImage2D,
+  replay_glGetProgramResourcefvNV,
+  replay_glBinormalPointerEXT,
+  replay_glGetLightfv,
+  replay_glVertex2bOES,
+  replay_glUniform2ivARB,
+  replay_glMultiTexCoord3s,
+  replay_glGetHistogramParameterfvEXT,
+  replay_glGetProgramStringNV,
+  replay_glGetTexGenxvOES,
+  replay_glTextureSubImage2D,
+  replay_glObjectPurgeableAPPLE,
+  replay_glColorTableSGI,
+  replay_glCopyConvolutionFilter2DEXT,
+  replay_glMultiTexCoord3f,
+  replay_glMultiTexCoord3d,
+  replay_glFogCoorddv,
+  replay_glGetBufferPointerv,
+  replay_glProgramUniform1fEXT,
+  replay_glWindowPos2fvMESA,
+  replay_glPolygonOffsetxOES,
+  replay_glVertexAttrib4dARB,
+  replay_glUniformHandleui64vARB,
+  replay_glFragmentLightModelfvSGIX,
+  replay_glSwizzleEXT,
+  replay_glBindFragmentShaderATI,
+  replay_glVertexAttribs3hvNV,
+  replay_glColorP3ui,
+  replay_glListParameterfvSGIX,
+  replay_glNamedRenderbufferStorageMultisample,
+  replay_glVertexAttribI1iEXT,
+  replay_glMultiTexCoord2ivARB,
+  replay_glLightModelxOES,
+  replay_glColor3xOES,
+  replay_glReadBuffer,
+  replay_glStencilFillPathInstancedNV,
+  replay_glVDPAUUnmapSurfacesNV,
+  replay_glProgramUniform4i64NV,
+  replay_glVertexStream4dvATI,
+  replay_glIsQuery,
+  replay_glProgramUniformMatrix4fvEXT,
+  replay_glVertexAttrib3hNV,
+  replay_glFlushMappedNamedBufferRange,
+  replay_glPushName,
+  replay_glGetClipPlane,
+  replay_glVertex4dv,
+  replay_glVertexAttrib3d,
+  replay_glBlendColor,
+  replay_glBindTransformFeedbackNV,
+  replay_glSamplerParameterIuiv,
+  replay_glIndexubv,
+  replay_glNamedBufferPageCommitmentEXT,
+  replay_glCheckNamedFramebufferStatus,
+  replay_glGetObjectBufferfvATI,
+  replay_glRasterPos4d,
+  replay_glRasterPos4f,
+  replay_glGetPerfMonitorCounterStringAMD,
+  replay_glVertexAttrib3s,
+  replay_glDrawElementsInstancedEXT,
+  replay_glNamedProgramLocalParameterI4iEXT,
+  replay_glRasterPos4s,
+  replay_glGetProgramStageiv,
+  replay_glGetMaterialxOES,
+  replay_glPopMatrix,
+  replay_glGetVideoui64vNV,
+  replay_glTangent3bEXT,
+  replay_glGetGraphicsResetStatusARB,
+  replay_glUniform4i,
+  replay_glActiveTexture,
+  replay_glEnableVertexAttribArray,
+  replay_glTexCoord4fVertex4fvSUN,
+  replay_glUniform4d,
+  replay_glUniform4f,
+  replay_glRenderbufferStorageMultisample,
+  replay_glCreateProgramPipelines,
+  replay_glVertexAttribLPointer,
+  replay_glUniform2uiEXT,
+  replay_glMultiTexCoord3sv,
+  replay_glDrawElementsInstancedBaseVertex,
+  replay_glPixelTransformParameterfvEXT,
+  replay_glDrawTransformFeedbackNV,
+  replay_glTextureImage2DMultisampleCoverageNV,
+  replay_glNamedRenderbufferStorageMultisampleCoverageEXT,
+  replay_glIsTexture,
+  replay_glMultiTexCoord4iv,
+  replay_glTexEnvfv,
+  replay_glPopDebugGroup,
+  replay_glUniformBlockBinding,
+  replay_glWindowPos2svMESA,
+  replay_glGenerateTextureMipmapEXT,
+  replay_glBindLightParameterEXT,
+  replay_glTexCoord3bOES,
+  replay_glTexCoordPointer,
+  replay_glProgramUniformMatrix3x2fv,
+  replay_glUniform2fvARB,
+  replay_glProgramLocalParameterI4uivNV,
+  replay_glFlushVertexArrayRangeNV,
+  replay_glSecondaryColor3svEXT,
+  replay_glGetBufferParameteriv,
+  replay_glGetQueryIndexediv,
+  replay_glFramebufferTexture3DEXT,
+  replay_glLoadTransposeMatrixxOES,
+  replay_glDeleteTransformFeedbacksNV,
+  replay_glGetCompressedTextureImageEXT,
+  replay_glIndexMaterialEXT,
+  replay_glFogCoorddEXT,
+  replay_glTexCoord2hvNV,
+  replay_glFramebufferTexture2DEXT,
+  replay_glTexEnviv,
+  replay_glEndTransformFeedbackNV,
+  replay_glGlobalAlphaFactoruiSUN,
+  replay_glSelectBuffer,
+  replay_glNamedBufferSubDataEXT,
+  replay_glDisableVertexArrayAttrib,
+  replay_glBlendFunc,
+  replay_glCreateProgram,
+  replay_glVertexStream2dATI,
+  replay_glUniform4ui64vARB,
+  replay_glPrimitiveRestartIndex,
+  replay_glNormalStream3fATI,
+  replay_glProgramUniformMatrix2fv,
+  replay_glVertexAttribs1hvNV,
+  replay_glWindowPos4svMESA,
+  replay_glDeleteFragmentShaderATI,
+  replay_glBindImageTextures,
+  replay_glMap2xOES,
+  replay_glEnd,
+  replay_glMultiTexCoord2dARB,
+  replay_glUniform1i64NV,
+  replay_glPathStringNV,
+  replay_glGetNamedFramebufferParameterivEXT,
+  replay_glGetProgramNamedParameterdvNV,
+  replay_glPathDashArrayNV,
+  replay_glUniform3uiv,
+  replay_glColor3fVertex3fvSUN,
+  replay_glMultTransposeMatrixd,
+  replay_glClearColor,
+  replay_glGetImageHandleARB,
+  replay_glTangent3dEXT,
+  replay_glGetQueryObjectivARB,
+  replay_glGetLocalConstantFloatvEXT,
+  replay_glUseShaderProgramEXT,
+  replay_glBindRenderbufferEXT,
+  replay_glInterleavedArrays,
+  replay_glGetPerfMonitorGroupStringAMD,
+  replay_glUniform3ui,
+  replay_glGetNamedProgramLocalParameterdvEXT,
+  replay_glSecondaryColor3us,
+  replay_glVertexAttribI4uiv,
+  replay_glVertexAttrib4bv,
+  replay_glMultiTexCoord3xOES,
+  replay_glSecondaryColor3ub,
+  replay_glFragmentMaterialfSGIX,
+  replay_glGetVariantArrayObjectivATI,
+  replay_glSecondaryColor3ui,
+  replay_glVertexAttrib1dARB,
+  replay_glGetNamedBufferPointerv,
+  replay_glLockArraysEXT,
+  replay_glVertexAttribPointerNV,
+  replay_glConvolutionParameterf,
+  replay_glBindBufferBaseEXT,
+  replay_glTexCoord2xvOES,
+  replay_glGetQueryBufferObjectui64v,
+  replay_glSetMultisamplefvAMD,
+  replay_glPathColorGenNV,
+  replay_glVertexAttrib3sARB,
+  replay_glVertexAttrib4ivARB,
+  replay_glGenTransformFeedbacks,
+  replay_glGetVertexAttribIuiv,
+  replay_glPixelTransformParameterfEXT,
+  replay_glGetTexParameterIuivEXT,
+  replay_glGetObjectParameterivARB,
+  replay_glVertexArraySecondaryColorOffsetEXT,
+  replay_glWindowPos2fARB,
+  replay_glCompressedTexSubImage2D,
+  replay_glCompressedTexSubImage3DARB,
+  replay_glProgramBinary,
+  replay_glPresentFrameKeyedNV,
+  replay_glVertexAttribI4bv,
+  replay_glPathCoverDepthFuncNV,
+  replay_glTransformFeedbackStreamAttribsNV,
+  replay_glSecondaryColor3usEXT,
+  replay_glCopyColorTableSGI,
+  replay_glProgramEnvParameter4fvARB,
+  replay_glMultiTexCoord4sARB,
+  replay_glGetVertexArrayIndexed64iv,
+  replay_glMatrixMultTranspose3x3fNV,
+  replay_glTexParameterIiv,
+  replay_glVertexArrayAttribFormat,
+  replay_glEndTransformFeedback,
+  replay_glDrawCommandsStatesAddressNV,
+  replay_glUniform4ui64NV,
+  replay_glMaterialiv,
+  replay_glTexImage2DMultisample,
+  replay_glBindTextureEXT,
+  replay_glIsBuffer,
+  replay_glVertexAttribI1iv,
+  replay_glGetFinalCombinerInputParameterfvNV,
+  replay_glMultiTexCoord3bvOES,
+  replay_glVertexAttribDivisor,
+  replay_glCopyBufferSubData,
+  replay_glBindTexGenParameterEXT,
+  replay_glNormalStream3bATI,
+  replay_glTextureImage2DEXT,
+  replay_glGetColorTableParameteriv,
+  replay_glActiveTextureARB,
+  replay_glTexCoord4xOES,
+  replay_glSecondaryColor3fvEXT,
+  replay_glUniformMatrix4x2fv,
+  replay_glStartInstrumentsSGIX,
+  replay_glProgramNamedParameter4fvNV,
+  replay_glEndVideoCaptureNV,
+  replay_glGenLists,
+  replay_glUniform1fARB,
+  replay_glNamedFramebufferTexture1DEXT,
+  replay_glMapBufferRange,
+  replay_glMultiDrawElementsIndirectCountARB,
+  replay_glProgramUniformMatrix4x2fv,
+  replay_glGetTextureParameterIivEXT,
+  replay_glMultiTexCoord3hNV,
+  replay_glNamedProgramLocalParametersI4uivEXT,
+  replay_glEndList,
+  replay_glTexCoord2fColor4fNormal3fVertex3fSUN,
+  replay_glGenTransformFeedbacksNV,
+  replay_glEdgeFlagv,
+  replay_glVertexAttribI2iv,
+  replay_glCopyMultiTexImage2DEXT,
+  replay_glUniformMatrix3x2dv,
+  replay_glTexImage3DMultisampleCoverageNV,
+  replay_glGetShaderPrecisionFormat,
+  replay_glTexSubImage4DSGIS,
+  replay_glRasterSamplesEXT,
+  replay_glTextureView,
+  replay_glEvalMapsNV,
+  replay_glGetFragDataLocationEXT,
+  replay_glGetCompressedMultiTexImageEXT,
+  replay_glIndexMask,
+  replay_glPushClientAttrib,
+  replay_glShaderSource,
+  replay_glDispatchComputeGroupSizeARB,
+  replay_glGetnPixelMapfv,
+  replay_glTexCoordP2uiv,
+  replay_glUniform2f,
+  replay_glGetNamedBufferParameteri64v,
+  replay_glCommandListSegmentsNV,
+  replay_glTextureParameterIivEXT,
+  replay_glMultiTexParameterfvEXT,
+  replay_glProgramUniform2ui64ARB,
+  replay_glVertex4d,
+  replay_glNewObjectBufferATI,
+  replay_glViewportSwizzleNV,
+  replay_glBufferData,
+  replay_glTextureImage1DEXT,
+  replay_glGetTexParameterIiv,
+  replay_glCopyTexSubImage1DEXT,
+  replay_glVertex4f,
+  replay_glUniformMatrix3fvARB,
+  replay_glTexCoordP1ui,
+  replay_glPointParameterfvEXT,
+  replay_glUniform4fARB,
+  replay_glCopyTextureSubImage3D,
+  replay_glMultiTexCoord2fv,
+  replay_glMultiTexEnvfvEXT,
+  replay_glNormalP3ui,
+  replay_glDrawRangeElementArrayATI,
+  replay_glVertexAttribI1i,
+  replay_glDrawArraysInstancedARB,
+  replay_glEnableVertexAttribAPPLE,
+  replay_glGetDebugMessageLogARB,
+  replay_glGetPathTexGenfvNV,
+  replay_glNamedProgramLocalParameters4fvEXT,
+  replay_glVertexStream3fvATI,
+  replay_glFramebufferTexture3D,
+  replay_glCompressedTextureSubImage2DEXT,
+  replay_glWindowPos3dv,
+  replay_glCopyConvolutionFilter2D,
+  replay_glReadInstrumentsSGIX,
+  replay_glSamplerParameterfv,
+  replay_glBindBufferARB,
+  replay_glVertexAttrib1sNV,
+  replay_glGetMaterialiv,
+  replay_glUniform1fv,
+  replay_glBeginOcclusionQueryNV,
+  replay_glGenFencesAPPLE,
+  replay_glScissorIndexedv,
+  replay_glDisableVariantClientStateEXT,
+  replay_glMinmaxEXT,
+  replay_glNormalPointervINTEL,
+  replay_glNormal3s,
+  replay_glGetnPixelMapuiv,
+  replay_glNormalStream3bvATI,
+  replay_glGetObjectParameterivAPPLE,
+  replay_glNormal3i,
+  replay_glUniform1ivARB,
+  replay_glNormal3d,
+  replay_glUpdateObjectBufferATI,
+  replay_glNormal3b,
+  replay_glGetUniformBufferSizeEXT,
+  replay_glMultiTexCoord4dv,
+  replay_glProgramUniform3i64ARB,
+  replay_glVertexAttrib2d,
+  replay_glVertexAttrib2f,
+  replay_glMultiDrawElementsEXT,
+  replay_glVertexAttrib3dv,
+  replay_glMultiTexCoord2bOES,
+  replay_glVertexAttrib2s,
+  replay_glTexImage3DMultisample,
+  replay_glGetUniformBlockIndex,
+  replay_glFrontFace,
+  replay_glEvalCoord1xOES,
+  replay_glDrawArraysInstancedBaseInstance,
+  replay_glIsPointInStrokePathNV,
+};
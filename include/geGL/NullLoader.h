@@ -0,0 +1,46 @@
+#pragma once
+
+#include<geGL/OpenGL.h>
+#include<geGL/FunctionLoaderInterface.h>
+#include<map>
+#include<memory>
+#include<string>
+
+/**
+ * @brief loader of emulated OpenGL that does not need GPU nor window
+ * It can be used for tests and benchmarks of CPU side of geGL and geRG
+ * on machines without GPU (ge::gl::init(std::make_shared<NullLoader>())).
+ * All OpenGL functions are loaded, most of them do nothing.
+ * Object lifetime is emulated: buffers are stored in host memory and they can be mapped,
+ * vertex arrays, textures, samplers, framebuffers, sync objects and queries keep their state.
+ * Shaders always compile and programs always link (GL_KHR_parallel_shader_compile is emulated,
+ * see setCompileLatency), their reflection table
+ * (active uniforms, attributes and shader storage blocks) is parsed from declarations in shader sources.
+ * Program binary contains shader sources, so it can be loaded back by glProgramBinary.
+ * Queries measure CPU time (their latency can be emulated, see setQueryLatency). Nothing is rendered.
+ * Loaded functions work with state of the current NullLoader like with current OpenGL context.
+ * New loader is made current in the constructor, the state is per thread.
+ * Any function can be replaced by setFunction, tests use it to observe the calls.
+ */
+class GEGL_EXPORT ge::gl::NullLoader: public FunctionLoaderInterface{
+  public:
+    struct State;
+    NullLoader();
+    virtual ~NullLoader();
+    virtual FUNCTION_POINTER load(char const*fceName)const override;
+    void    makeCurrent ();
+    bool    isCurrent   ()const;
+    void    setInteger  (GLenum pname,GLint64 value);
+    GLint64 getInteger  (GLenum pname)const;
+    void    setCompileLatency(GLuint nofQueries);
+    void    setQueryLatency  (GLuint nofQueries);
+    size_t  getNofObjects()const;
+    void    setFunction(char const*fceName,FUNCTION_POINTER function);
+    template<typename F>
+      void setFunction(char const*fceName,F*function){
+        this->setFunction(fceName,reinterpret_cast<FUNCTION_POINTER>(function));
+      }
+  protected:
+    std::shared_ptr<State>_state;
+    std::map<std::string,FUNCTION_POINTER>_functions;///< functions replaced by setFunction
+};
@@ -0,0 +1,35 @@
+#pragma once
+
+#include<geGL/OpenGLFunctionTable.h>
+#include<geGL/FunctionProfiler.h>
+#include<cassert>
+
+namespace ge{
+  namespace gl{
+    /**
+     * @brief Decorator that measures OpenGL function calls
+     * Every loaded function is wrapped, statistics are collected in profiler.
+     * The decorator should be the outermost one, calls made by inner decorators
+     * (for example DSA emulation) are measured too and included in time of outer call.
+     * Only number of calls is counted if timing of profiler is disabled.
+     */
+    template<typename T>
+      class ProfilingTableDecorator: public T{
+        public:
+          template<typename...ARGS>
+            ProfilingTableDecorator(ARGS&&...args):T(args...){}
+          virtual ~ProfilingTableDecorator(){}
+          mutable FunctionProfiler profiler;
+        protected:
+          virtual bool m_init(){
+            assert(this!=nullptr);
+            if(!T::m_init())return false;
+            this->profiler.setFunctions(GE_GL_NOF_OPENGL_FUNCTIONS,&ProfilingTableDecorator::m_profilingFunctionName);
+#include<geGL/Generated/ProfilingCalls.h>
+            return true;
+          }
+          FunctionTable::MEMBER_FUNCTION_POINTER m_profiledFunctions[GE_GL_NOF_OPENGL_FUNCTIONS];
+#include<geGL/Generated/ProfilingImplementation.h>
+      };
+  }
+}
@@ -4,9 +4,12 @@
 #include<memory>
 #include<set>
 #include<map>
+#include<unordered_map>
+#include<vector>
 
 #include<geGL/Shader.h>
 #include<geGL/ProgramInfo.h>
+#include<geGL/UniformHandle.h>
 
 class GEGL_EXPORT ge::gl::Program: public OpenGLObject, public std::enable_shared_from_this<Program>{
   public:
@@ -21,6 +24,11 @@ class GEGL_EXPORT ge::gl::Program: public OpenGLObject, public std::enable_share
     void attachShaders(ShaderPointers const&shaders = {});
     void detachShaders(ShaderPointers const&shaders = {});
     void link         (ShaderPointers const&shaders = {});
+    void linkAsync    (ShaderPointers const&shaders = {});
+    bool isLinkCompleted()const;
+    void setBinaryRetrievableHint(GLboolean hint = GL_TRUE);
+    std::vector<uint8_t>getBinary(GLenum&format)const;
+    bool setBinary(GLenum format,void const*binary,GLsizei length);
     GLboolean isProgram()const;
     void use ()const;
     void validate()const;
@@ -44,6 +52,7 @@ class GEGL_EXPORT ge::gl::Program: public OpenGLObject, public std::enable_share
     std::string getInfoLog                          ()const;
     void        getComputeWorkGroupSize(GLint*x                                )const;
     GLint       getUniformLocation     (std::string const&name                 )const;
+    UniformHandle getUniformHandle     (std::string const&name                 )const;
     GLint       getAttribLocation      (std::string const&name                 )const;
     GLint       getInterfaceParam      (GLenum interf,GLenum pname             )const;
     std::string getResourceName        (GLenum interf,GLuint index             )const;
@@ -90,6 +99,48 @@ class GEGL_EXPORT ge::gl::Program: public OpenGLObject, public std::enable_share
     Program const*setMatrix3x2dv(std::string const&name,double   const*v0,GLsizei count = 1,GLboolean transpose = GL_FALSE)const;
     Program const*setMatrix2x4dv(std::string const&name,double   const*v0,GLsizei count = 1,GLboolean transpose = GL_FALSE)const;
     Program const*setMatrix2x3dv(std::string const&name,double   const*v0,GLsizei count = 1,GLboolean transpose = GL_FALSE)const;
+    Program const*set1f         (UniformHandle const&handle,float    v0                                                       )const;
+    Program const*set2f         (UniformHandle const&handle,float    v0,float    v1                                           )const;
+    Program const*set3f         (UniformHandle const&handle,float    v0,float    v1,float    v2                               )const;
+    Program const*set4f         (UniformHandle const&handle,float    v0,float    v1,float    v2,float    v3                   )const;
+    Program const*set1i         (UniformHandle const&handle,int32_t  v0                                                       )const;
+    Program const*set2i         (UniformHandle const&handle,int32_t  v0,int32_t  v1                                           )const;
+    Program const*set3i         (UniformHandle const&handle,int32_t  v0,int32_t  v1,int32_t  v2                               )const;
+    Program const*set4i         (UniformHandle const&handle,int32_t  v0,int32_t  v1,int32_t  v2,int32_t  v3                   )const;
+    Program const*set1ui        (UniformHandle const&handle,uint32_t v0                                                       )const;
+    Program const*set2ui        (UniformHandle const&handle,uint32_t v0,uint32_t v1                                           )const;
+    Program const*set3ui        (UniformHandle const&handle,uint32_t v0,uint32_t v1,uint32_t v2                               )const;
+    Program const*set4ui        (UniformHandle const&handle,uint32_t v0,uint32_t v1,uint32_t v2,uint32_t v3                   )const;
+    Program const*set1fv        (UniformHandle const&handle,float    const*v0,GLsizei count = 1                               )const;
+    Program const*set2fv        (UniformHandle const&handle,float    const*v0,GLsizei count = 1                               )const;
+    Program const*set3fv        (UniformHandle const&handle,float    const*v0,GLsizei count = 1                               )const;
+    Program const*set4fv        (UniformHandle const&handle,float    const*v0,GLsizei count = 1                               )const;
+    Program const*set1iv        (UniformHandle const&handle,int32_t  const*v0,GLsizei count = 1                               )const;
+    Program const*set2iv        (UniformHandle const&handle,int32_t  const*v0,GLsizei count = 1                               )const;
+    Program const*set3iv        (UniformHandle const&handle,int32_t  const*v0,GLsizei count = 1                               )const;
+    Program const*set4iv        (UniformHandle const&handle,int32_t  const*v0,GLsizei count = 1                               )const;
+    Program const*set1uiv       (UniformHandle const&handle,uint32_t const*v0,GLsizei count = 1                               )const;
+    Program const*set2uiv       (UniformHandle const&handle,uint32_t const*v0,GLsizei count = 1                               )const;
+    Program const*set3uiv       (UniformHandle const&handle,uint32_t const*v0,GLsizei count = 1                               )const;
+    Program const*set4uiv       (UniformHandle const&handle,uint32_t const*v0,GLsizei count = 1                               )const;
+    Program const*setMatrix4fv  (UniformHandle const&handle,float    const*v0,GLsizei count = 1,GLboolean transpose = GL_FALSE)const;
+    Program const*setMatrix3fv  (UniformHandle const&handle,float    const*v0,GLsizei count = 1,GLboolean transpose = GL_FALSE)const;
+    Program const*setMatrix2fv  (UniformHandle const&handle,float    const*v0,GLsizei count = 1,GLboolean transpose = GL_FALSE)const;
+    Program const*setMatrix4x3fv(UniformHandle const&handle,float    const*v0,GLsizei count = 1,GLboolean transpose = GL_FALSE)const;
+    Program const*setMatrix4x2fv(UniformHandle const&handle,float    const*v0,GLsizei count = 1,GLboolean transpose = GL_FALSE)const;
+    Program const*setMatrix3x4fv(UniformHandle const&handle,float    const*v0,GLsizei count = 1,GLboolean transpose = GL_FALSE)const;
+    Program const*setMatrix3x2fv(UniformHandle const&handle,float    const*v0,GLsizei count = 1,GLboolean transpose = GL_FALSE)const;
+    Program const*setMatrix2x4fv(UniformHandle const&handle,float    const*v0,GLsizei count = 1,GLboolean transpose = GL_FALSE)const;
+    Program const*setMatrix2x3fv(UniformHandle const&handle,float    const*v0,GLsizei count = 1,GLboolean transpose = GL_FALSE)const;
+    Program const*setMatrix4dv  (UniformHandle const&handle,double   const*v0,GLsizei count = 1,GLboolean transpose = GL_FALSE)const;
+    Program const*setMatrix3dv  (UniformHandle const&handle,double   const*v0,GLsizei count = 1,GLboolean transpose = GL_FALSE)const;
+    Program const*setMatrix2dv  (UniformHandle const&handle,double   const*v0,GLsizei count = 1,GLboolean transpose = GL_FALSE)const;
+    Program const*setMatrix4x3dv(UniformHandle const&handle,double   const*v0,GLsizei count = 1,GLboolean transpose = GL_FALSE)const;
+    Program const*setMatrix4x2dv(UniformHandle const&handle,double   const*v0,GLsizei count = 1,GLboolean transpose = GL_FALSE)const;
+    Program const*setMatrix3x4dv(UniformHandle const&handle,double   const*v0,GLsizei count = 1,GLboolean transpose = GL_FALSE)const;
+    Program const*setMatrix3x2dv(UniformHandle const&handle,double   const*v0,GLsizei count = 1,GLboolean transpose = GL_FALSE)const;
+    Program const*setMatrix2x4dv(UniformHandle const&handle,double   const*v0,GLsizei count = 1,GLboolean transpose = GL_FALSE)const;
+    Program const*setMatrix2x3dv(UniformHandle const&handle,double   const*v0,GLsizei count = 1,GLboolean transpose = GL_FALSE)const;
     void set(std::string const&name,float    v0                                    );
     void set(std::string const&name,float    v0,float    v1                        );
     void set(std::string const&name,float    v0,float    v1,float    v2            );
@@ -117,7 +168,10 @@ class GEGL_EXPORT ge::gl::Program: public OpenGLObject, public std::enable_share
     Program const*bindBuffer(std::string const&name,std::shared_ptr<Buffer>const&buffer)const;
     Program const*dispatch(GLuint nofWorkGroupsX = 1,GLuint nofWorkGroupsY = 1,GLuint nofWorkGroupsZ = 1)const;
 
-    std::shared_ptr<ProgramInfo> const&getInfo()const{return this->_info;}
+    std::shared_ptr<ProgramInfo> const&getInfo()const{this->_ensureInfo();return this->_info;}
+    void setUniformCaching(bool enable = true);
+    bool isUniformCachingEnabled()const;
+    void invalidateUniformCache()const;
     static void setNonexistingUniformWarning(bool enableWarning = true);
     static bool isNonexistingUniformWarningEnabled();
 
@@ -141,7 +195,20 @@ class GEGL_EXPORT ge::gl::Program: public OpenGLObject, public std::enable_share
     GLint _getParam(GLenum pname)const;
     std::map<std::string,GLint>_name2Uniform;
     GLint _getUniform(std::string name);
+    std::unordered_map<std::string,UniformHandle>_uniformHandles;
+    mutable std::vector<uint8_t>_uniformCache     ;///< shadow copy of uniform values
+    mutable std::vector<uint8_t>_uniformCacheValid;///< flag per uniform element, shadow copy holds the value set to OpenGL
+    bool _uniformCaching = true;
+    uint64_t _uniformGeneration = 0;///< generation of handles in _uniformHandles, it is unique for every reflection of every program
+    bool _isCachedHandle(UniformHandle const&handle,GLsizei count)const;
+    UniformHandle const&_getUniformHandle(std::string const&name)const;
+    bool _updateUniformCache(UniformHandle const&handle,void const*data,size_t elementSize,GLsizei count)const;
+    void _invalidateUniformCache(UniformHandle const&handle,GLsizei count)const;
     std::shared_ptr<ProgramInfo> _info;
+    mutable bool _infoPending     = false;///< reflection is filled by the first use of it
+    mutable bool _checkLinkStatus = false;///< info log of asynchronous link has not been checked yet
+    bool         _parallelCompile = false;///< GL_COMPLETION_STATUS_ARB can be queried
+    void _ensureInfo()const;
     void _fillUniformInfo();
     void _fillAttribInfo();
     void _fillBufferInfo();
@@ -0,0 +1,45 @@
+#pragma once
+
+#include<memory>
+#include<string>
+#include<utility>
+#include<vector>
+#include<geGL/Program.h>
+
+/**
+ * @brief on-disk cache of program binaries
+ * Programs are keyed by hash of shader types, shader sources (including defines,
+ * see Shader::define) and driver string (vendor, renderer and version).
+ * Warm start loads binary by glProgramBinary and skips compilation of shaders.
+ * If binary is missing, corrupted, written by different version of the cache or
+ * rejected by driver, the program is compiled from sources and the binary is stored again.
+ * Each binary is stored in its own file in the directory of the cache,
+ * the directory has to exist.
+ */
+class GEGL_EXPORT ge::gl::ProgramBinaryCache{
+  public:
+    using Stage  = std::pair<GLenum,Shader::Sources>;
+    using Stages = std::vector<Stage>;
+    uint32_t static const version;
+    ProgramBinaryCache(std::string const&directory);
+    std::string const&getDirectory()const;
+    static uint64_t computeKey(Stages const&stages,std::string const&driver);
+    static std::string getDriverString(Context const&gl);
+    std::string getPath(uint64_t key)const;
+    bool load  (uint64_t key,GLenum&format,std::vector<uint8_t>&binary)const;
+    bool store (uint64_t key,GLenum format,std::vector<uint8_t>const&binary)const;
+    void remove(uint64_t key)const;
+    std::shared_ptr<Program>createProgram(Stages const&stages);
+    std::shared_ptr<Program>createProgram(
+        FunctionTablePointer const&table ,
+        Stages               const&stages);
+    size_t getNofHits  ()const;
+    size_t getNofMisses()const;
+  protected:
+    std::string _directory;
+    size_t      _nofHits   = 0;
+    size_t      _nofMisses = 0;
+    std::shared_ptr<Program>_createProgram(
+        std::shared_ptr<Program>const&program,
+        Stages                  const&stages );
+};
@@ -0,0 +1,36 @@
+#pragma once
+
+#include<geGL/OpenGLFunctionTable.h>
+#include<geGL/CallRecorder.h>
+#include<cassert>
+
+namespace ge{
+  namespace gl{
+    /**
+     * @brief Decorator that records OpenGL function calls
+     * Every loaded function is wrapped, calls and client memory they read are written into recorder.
+     * The stream can be saved and replayed by CallReplayer against any function table.
+     * The decorator should be the outermost one and it should be constructed together with the context,
+     * replay needs all objects that are used by recorded calls.
+     * Calls made by inner decorators (for example DSA emulation) are not recorded,
+     * replay issues the outer call.
+     */
+    template<typename T>
+      class RecordingTableDecorator: public T{
+        public:
+          template<typename...ARGS>
+            RecordingTableDecorator(ARGS&&...args):T(args...){}
+          virtual ~RecordingTableDecorator(){}
+          mutable CallRecorder recorder;
+        protected:
+          virtual bool m_init(){
+            assert(this!=nullptr);
+            if(!T::m_init())return false;
+#include<geGL/Generated/RecordingCalls.h>
+            return true;
+          }
+          FunctionTable::MEMBER_FUNCTION_POINTER m_recordedFunctions[GE_GL_NOF_OPENGL_FUNCTIONS];
+#include<geGL/Generated/RecordingImplementation.h>
+      };
+  }
+}
@@ -23,6 +23,8 @@ class GEGL_EXPORT ge::gl::Shader:public OpenGLObject{
   void        create(GLenum type);
   void        setSource(Sources const& sources = {});
   void        compile  (Sources const& sources = {});
+  void        compileAsync(Sources const& sources = {});
+  bool        isCompileCompleted()const;
   GLboolean   isShader        ()const;
   GLenum      getType         ()const;
   GLboolean   getDeleteStatus ()const;
@@ -31,6 +33,8 @@ class GEGL_EXPORT ge::gl::Shader:public OpenGLObject{
   GLuint      getSourceLength ()const;
   std::string getInfoLog      ()const;
   Source      getSource       ()const;
+  static bool isParallelCompileSupported(Context const&gl);
+  static void setMaxCompilerThreads(Context const&gl,GLuint count);
   static std::string define(std::string const&name);
   static std::string define(std::string const&name,uint32_t value);
   static std::string define(std::string const&name,uint32_t value0,uint32_t value1);
@@ -62,6 +66,7 @@ class GEGL_EXPORT ge::gl::Shader:public OpenGLObject{
   protected:
   GLint _getParam(GLenum pname)const;
   std::set<Program*>_programs;
+  bool _parallelCompile = false;///< GL_COMPLETION_STATUS_ARB can be queried
 };
 
 template<typename...ARGS>
@@ -0,0 +1,72 @@
+#pragma once
+
+#include<map>
+#include<memory>
+#include<set>
+#include<string>
+#include<utility>
+#include<vector>
+#include<geGL/Program.h>
+
+/**
+ * @brief preprocessor of shader sources with virtual file table
+ * Files are registered by name (addFile), #include "name" (or <name>) directives are resolved
+ * against the table, relative to the directory of the including file first.
+ * Files with #pragma once are included only once per shader, circular includes are reported.
+ * Set of defines is canonicalized into variant key (getVariantKey), defines are inserted after #version.
+ * Expanded files and programs are memoized, the same variant of program is compiled only once.
+ * Programs are memoized per function table, the table is identified by ownership, not by address.
+ * Memoized programs hold their table, clearPrograms(table) releases them when the context is destroyed.
+ * Conditional compilation (#if, #ifdef) is left to the driver.
+ */
+class GEGL_EXPORT ge::gl::ShaderPreprocessor{
+  public:
+    using Defines = std::map<std::string,std::string>;///< name -> value, empty value for defines without value
+    using Stage   = std::pair<GLenum,std::string>    ;///< shader type and name of file
+    using Stages  = std::vector<Stage>;
+    ShaderPreprocessor();
+    void addFile   (std::string const&name,std::string const&source);
+    void removeFile(std::string const&name);
+    bool hasFile   (std::string const&name)const;
+    std::string const&getFile(std::string const&name)const;
+    size_t getFileIndex(std::string const&name)const;
+    std::string const&getFileName(size_t index)const;
+    static std::string getVariantKey(Defines const&defines);
+    std::string const&expand(std::string const&name);
+    Shader::Sources getSources(std::string const&name,Defines const&defines = {});
+    std::shared_ptr<Program>createProgram(
+        Stages               const&stages        ,
+        Defines              const&defines = {}  );
+    std::shared_ptr<Program>createProgram(
+        FunctionTablePointer const&table         ,
+        Stages               const&stages        ,
+        Defines              const&defines = {}  );
+    void setProgramBinaryCache(std::shared_ptr<ProgramBinaryCache>const&cache);
+    std::shared_ptr<ProgramBinaryCache>const&getProgramBinaryCache()const;
+    void   clearPrograms();
+    void   clearPrograms(FunctionTablePointer const&table);
+    size_t getNofPrograms()const;
+    size_t getNofHits    ()const;
+    size_t getNofMisses  ()const;
+  protected:
+    using TableKey = std::weak_ptr<FunctionTable const>;
+    using Variants = std::map<std::string,std::shared_ptr<Program>>;///< variant key -> program
+    std::map<std::string,std::string>              _files       ;
+    std::map<std::string,size_t>                   _fileIndices ;///< index of file is used as source string number in #line
+    std::vector<std::string>                       _fileNames   ;
+    std::map<std::string,std::string>              _expanded    ;///< memoized expanded files
+    std::map<TableKey,Variants,std::owner_less<TableKey>>_programs;///< memoized variants of programs per function table
+    std::shared_ptr<ProgramBinaryCache>            _programBinaryCache;
+    size_t                                         _nofHits     = 0;
+    size_t                                         _nofMisses   = 0;
+    std::string _resolve(std::string const&name,std::string const&includer)const;
+    bool _expand(
+        std::string          &result  ,
+        std::string     const&name    ,
+        std::vector<std::string>&stack,
+        std::set<std::string>&once    );
+    std::shared_ptr<Program>_createProgram(
+        FunctionTablePointer const&table  ,
+        Stages               const&stages ,
+        Defines              const&defines);
+};
@@ -0,0 +1,430 @@
+#pragma once
+
+#include<geGL/OpenGLFunctionTable.h>
+#include<geGL/OpenGLUtil.h>
+#include<map>
+#include<algorithm>
+#include<utility>
+#include<cassert>
+
+#define CACHE_STATE(name)\
+  this->m_next_##name = this->m_ptr_##name;\
+  if(this->m_ptr_##name)\
+    this->m_ptr_##name =\
+      (decltype(FunctionTable::m_ptr_##name))\
+        &StateCacheTableDecorator::m_##name##_cache
+
+#define CALL_NEXT(name,...)\
+  (this->*(this->m_next_##name))(__VA_ARGS__)
+
+namespace ge{
+  namespace gl{
+    /**
+     * @brief Decorator that eliminates redundant state changes
+     * It keeps shadow copy of bindings (buffers per target, vertex array, program,
+     * textures per unit, samplers, framebuffers, renderbuffer, program pipeline)
+     * and enable/disable capabilities.
+     * Bind/enable calls that would not change the state are not issued and
+     * glGetIntegerv/glIsEnabled queries of known state are answered without OpenGL.
+     * It should be placed above DSATableDecorator so the emulated DSA functions
+     * do not query the previous bindings every call.
+     *
+     * Shadow state is filled by bind calls and by the first query, nothing is assumed.
+     * If OpenGL state is changed without this table (other library, another table,
+     * shared context), invalidateStateCache() has to be called
+     * (ge::gl::invalidateStateCache() for table of createStateCachingTable()).
+     */
+    template<typename T>
+      class StateCacheTableDecorator: public T{
+        public:
+          template<typename...ARGS>
+            StateCacheTableDecorator(ARGS&&...args):T(args...){}
+          virtual ~StateCacheTableDecorator(){}
+          void invalidateStateCache()const{
+            assert(this!=nullptr);
+            this->m_bindings    .clear();
+            this->m_textures    .clear();
+            this->m_textureUnits.clear();
+            this->m_samplers    .clear();
+            this->m_capabilities.clear();
+          }
+        protected:
+          virtual bool m_init(){
+            assert(this!=nullptr);
+            if(!T::m_init())return false;
+            this->invalidateStateCache();
+            CACHE_STATE(glBindBuffer            );
+            CACHE_STATE(glBindBufferBase        );
+            CACHE_STATE(glBindBufferRange       );
+            CACHE_STATE(glBindBuffersBase       );
+            CACHE_STATE(glBindBuffersRange      );
+            CACHE_STATE(glDeleteBuffers         );
+            CACHE_STATE(glBindVertexArray       );
+            CACHE_STATE(glDeleteVertexArrays    );
+            CACHE_STATE(glVertexArrayElementBuffer);
+            CACHE_STATE(glUseProgram            );
+            CACHE_STATE(glBindProgramPipeline   );
+            CACHE_STATE(glDeleteProgramPipelines);
+            CACHE_STATE(glActiveTexture         );
+            CACHE_STATE(glBindTexture           );
+            CACHE_STATE(glBindTextureUnit       );
+            CACHE_STATE(glBindTextures          );
+            CACHE_STATE(glDeleteTextures        );
+            CACHE_STATE(glBindSampler           );
+            CACHE_STATE(glBindSamplers          );
+            CACHE_STATE(glDeleteSamplers        );
+            CACHE_STATE(glBindFramebuffer       );
+            CACHE_STATE(glDeleteFramebuffers    );
+            CACHE_STATE(glBindRenderbuffer      );
+            CACHE_STATE(glDeleteRenderbuffers   );
+            CACHE_STATE(glEnable                );
+            CACHE_STATE(glDisable               );
+            CACHE_STATE(glEnablei               );
+            CACHE_STATE(glDisablei              );
+            CACHE_STATE(glIsEnabled             );
+            CACHE_STATE(glGetIntegerv           );
+            CACHE_STATE(glGetIntegeri_v         );
+            return true;
+          }
+
+          //functions of decorated table
+          decltype(FunctionTable::m_ptr_glBindBuffer            )m_next_glBindBuffer             = nullptr;
+          decltype(FunctionTable::m_ptr_glBindBufferBase        )m_next_glBindBufferBase         = nullptr;
+          decltype(FunctionTable::m_ptr_glBindBufferRange       )m_next_glBindBufferRange        = nullptr;
+          decltype(FunctionTable::m_ptr_glBindBuffersBase       )m_next_glBindBuffersBase        = nullptr;
+          decltype(FunctionTable::m_ptr_glBindBuffersRange      )m_next_glBindBuffersRange       = nullptr;
+          decltype(FunctionTable::m_ptr_glDeleteBuffers         )m_next_glDeleteBuffers          = nullptr;
+          decltype(FunctionTable::m_ptr_glBindVertexArray       )m_next_glBindVertexArray        = nullptr;
+          decltype(FunctionTable::m_ptr_glDeleteVertexArrays    )m_next_glDeleteVertexArrays     = nullptr;
+          decltype(FunctionTable::m_ptr_glVertexArrayElementBuffer)m_next_glVertexArrayElementBuffer = nullptr;
+          decltype(FunctionTable::m_ptr_glUseProgram            )m_next_glUseProgram             = nullptr;
+          decltype(FunctionTable::m_ptr_glBindProgramPipeline   )m_next_glBindProgramPipeline    = nullptr;
+          decltype(FunctionTable::m_ptr_glDeleteProgramPipelines)m_next_glDeleteProgramPipelines = nullptr;
+          decltype(FunctionTable::m_ptr_glActiveTexture         )m_next_glActiveTexture          = nullptr;
+          decltype(FunctionTable::m_ptr_glBindTexture           )m_next_glBindTexture            = nullptr;
+          decltype(FunctionTable::m_ptr_glBindTextureUnit       )m_next_glBindTextureUnit        = nullptr;
+          decltype(FunctionTable::m_ptr_glBindTextures          )m_next_glBindTextures           = nullptr;
+          decltype(FunctionTable::m_ptr_glDeleteTextures        )m_next_glDeleteTextures         = nullptr;
+          decltype(FunctionTable::m_ptr_glBindSampler           )m_next_glBindSampler            = nullptr;
+          decltype(FunctionTable::m_ptr_glBindSamplers          )m_next_glBindSamplers           = nullptr;
+          decltype(FunctionTable::m_ptr_glDeleteSamplers        )m_next_glDeleteSamplers         = nullptr;
+          decltype(FunctionTable::m_ptr_glBindFramebuffer       )m_next_glBindFramebuffer        = nullptr;
+          decltype(FunctionTable::m_ptr_glDeleteFramebuffers    )m_next_glDeleteFramebuffers     = nullptr;
+          decltype(FunctionTable::m_ptr_glBindRenderbuffer      )m_next_glBindRenderbuffer       = nullptr;
+          decltype(FunctionTable::m_ptr_glDeleteRenderbuffers   )m_next_glDeleteRenderbuffers    = nullptr;
+          decltype(FunctionTable::m_ptr_glEnable                )m_next_glEnable                 = nullptr;
+          decltype(FunctionTable::m_ptr_glDisable               )m_next_glDisable                = nullptr;
+          decltype(FunctionTable::m_ptr_glEnablei               )m_next_glEnablei                = nullptr;
+          decltype(FunctionTable::m_ptr_glDisablei              )m_next_glDisablei               = nullptr;
+          decltype(FunctionTable::m_ptr_glIsEnabled             )m_next_glIsEnabled              = nullptr;
+          decltype(FunctionTable::m_ptr_glGetIntegerv           )m_next_glGetIntegerv            = nullptr;
+          decltype(FunctionTable::m_ptr_glGetIntegeri_v         )m_next_glGetIntegeri_v          = nullptr;
+
+          //shadow state, missing item means that the state is not known
+          mutable std::map<GLenum,GLuint>m_bindings;///< binding query (GL_ARRAY_BUFFER_BINDING, GL_CURRENT_PROGRAM, ...) -> value
+          mutable std::map<std::pair<GLuint,GLenum>,GLuint>m_textures;///< (unit,target) -> texture bound by glBindTexture
+          mutable std::map<GLuint,GLuint>m_textureUnits;///< unit -> texture bound by glBindTextureUnit
+          mutable std::map<GLuint,GLuint>m_samplers;///< unit -> sampler
+          mutable std::map<GLenum,GLboolean>m_capabilities;///< capability -> enabled
+
+          bool m_isBound(GLenum binding,GLuint id)const{
+            auto const ii = this->m_bindings.find(binding);
+            return ii != this->m_bindings.end() && ii->second == id;
+          }
+
+          template<typename KEY>
+            static void m_unbindDeleted(std::map<KEY,GLuint>&bindings,GLsizei n,const GLuint*ids){
+              for(auto&x:bindings)
+                for(GLsizei i=0;i<n;++i)
+                  if(x.second == ids[i])x.second = 0;
+            }
+
+          template<typename KEY>
+            static void m_forgetDeleted(std::map<KEY,GLuint>&bindings,GLsizei n,const GLuint*ids){
+              for(auto ii = bindings.begin();ii != bindings.end();){
+                if(std::find(ids,ids+n,ii->second) != ids+n)ii = bindings.erase(ii);
+                else ++ii;
+              }
+            }
+
+          void m_unbindDeleted(GLenum binding,GLsizei n,const GLuint*ids)const{
+            auto const ii = this->m_bindings.find(binding);
+            if(ii == this->m_bindings.end())return;
+            for(GLsizei i=0;i<n;++i)
+              if(ii->second == ids[i])ii->second = 0;
+          }
+
+          GLuint m_activeTextureUnit()const{
+            auto const ii = this->m_bindings.find(GL_ACTIVE_TEXTURE);
+            if(ii != this->m_bindings.end())return ii->second - GL_TEXTURE0;
+            GLint activeTexture = GL_TEXTURE0;
+            CALL_NEXT(glGetIntegerv,GL_ACTIVE_TEXTURE,&activeTexture);
+            this->m_bindings[GL_ACTIVE_TEXTURE] = GLuint(activeTexture);
+            return GLuint(activeTexture) - GL_TEXTURE0;
+          }
+
+          void m_forgetTextureUnit(GLuint unit)const{
+            auto ii = this->m_textures.lower_bound(std::make_pair(unit,GLenum(0)));
+            while(ii != this->m_textures.end() && ii->first.first == unit)
+              ii = this->m_textures.erase(ii);
+          }
+
+          void m_glBindBuffer_cache(GLenum target,GLuint buffer){
+            GLenum const binding = bufferTarget2Binding(target);
+            if(this->m_isBound(binding,buffer))return;
+            CALL_NEXT(glBindBuffer,target,buffer);
+            if(binding)this->m_bindings[binding] = buffer;
+          }
+
+          void m_glBindBufferBase_cache(GLenum target,GLuint index,GLuint buffer){
+            CALL_NEXT(glBindBufferBase,target,index,buffer);
+            GLenum const binding = bufferTarget2Binding(target);
+            if(binding)this->m_bindings[binding] = buffer;
+          }
+
+          void m_glBindBufferRange_cache(GLenum target,GLuint index,GLuint buffer,GLintptr offset,GLsizeiptr size){
+            CALL_NEXT(glBindBufferRange,target,index,buffer,offset,size);
+            GLenum const binding = bufferTarget2Binding(target);
+            if(binding)this->m_bindings[binding] = buffer;
+          }
+
+          void m_glBindBuffersBase_cache(GLenum target,GLuint first,GLsizei count,const GLuint*buffers){
+            CALL_NEXT(glBindBuffersBase,target,first,count,buffers);
+            this->m_bindings.erase(bufferTarget2Binding(target));
+          }
+
+          void m_glBindBuffersRange_cache(GLenum target,GLuint first,GLsizei count,const GLuint*buffers,const GLintptr*offsets,const GLsizeiptr*sizes){
+            CALL_NEXT(glBindBuffersRange,target,first,count,buffers,offsets,sizes);
+            this->m_bindings.erase(bufferTarget2Binding(target));
+          }
+
+          void m_glDeleteBuffers_cache(GLsizei n,const GLuint*buffers){
+            CALL_NEXT(glDeleteBuffers,n,buffers);
+            for(auto&x:this->m_bindings)
+              if(bufferBinding2Target(x.first))
+                for(GLsizei i=0;i<n;++i)
+                  if(x.second == buffers[i])x.second = 0;
+          }
+
+          void m_glBindVertexArray_cache(GLuint array){
+            if(this->m_isBound(GL_VERTEX_ARRAY_BINDING,array))return;
+            CALL_NEXT(glBindVertexArray,array);
+            this->m_bindings[GL_VERTEX_ARRAY_BINDING] = array;
+            //element buffer binding is part of vertex array state
+            this->m_bindings.erase(GL_ELEMENT_ARRAY_BUFFER_BINDING);
+          }
+
+          void m_glDeleteVertexArrays_cache(GLsizei n,const GLuint*arrays){
+            CALL_NEXT(glDeleteVertexArrays,n,arrays);
+            //element buffer binding is kept only if bound vertex array is known and it is not deleted
+            auto const ii = this->m_bindings.find(GL_VERTEX_ARRAY_BINDING);
+            if(ii == this->m_bindings.end() || std::find(arrays,arrays+n,ii->second) != arrays+n)
+              this->m_bindings.erase(GL_ELEMENT_ARRAY_BUFFER_BINDING);
+            this->m_unbindDeleted(GL_VERTEX_ARRAY_BINDING,n,arrays);
+          }
+
+          void m_glVertexArrayElementBuffer_cache(GLuint vaobj,GLuint buffer){
+            CALL_NEXT(glVertexArrayElementBuffer,vaobj,buffer);
+            //vertex array may be the bound one, binding is updated if it is known
+            auto const ii = this->m_bindings.find(GL_VERTEX_ARRAY_BINDING);
+            if(ii == this->m_bindings.end())this->m_bindings.erase(GL_ELEMENT_ARRAY_BUFFER_BINDING);
+            else if(ii->second == vaobj)this->m_bindings[GL_ELEMENT_ARRAY_BUFFER_BINDING] = buffer;
+          }
+
+          void m_glUseProgram_cache(GLuint program){
+            if(this->m_isBound(GL_CURRENT_PROGRAM,program))return;
+            CALL_NEXT(glUseProgram,program);
+            this->m_bindings[GL_CURRENT_PROGRAM] = program;
+          }
+
+          void m_glBindProgramPipeline_cache(GLuint pipeline){
+            if(this->m_isBound(GL_PROGRAM_PIPELINE_BINDING,pipeline))return;
+            CALL_NEXT(glBindProgramPipeline,pipeline);
+            this->m_bindings[GL_PROGRAM_PIPELINE_BINDING] = pipeline;
+          }
+
+          void m_glDeleteProgramPipelines_cache(GLsizei n,const GLuint*pipelines){
+            CALL_NEXT(glDeleteProgramPipelines,n,pipelines);
+            this->m_unbindDeleted(GL_PROGRAM_PIPELINE_BINDING,n,pipelines);
+          }
+
+          void m_glActiveTexture_cache(GLenum texture){
+            if(this->m_isBound(GL_ACTIVE_TEXTURE,texture))return;
+            CALL_NEXT(glActiveTexture,texture);
+            this->m_bindings[GL_ACTIVE_TEXTURE] = texture;
+          }
+
+          void m_glBindTexture_cache(GLenum target,GLuint texture){
+            GLuint const unit = this->m_activeTextureUnit();
+            auto const key = std::make_pair(unit,target);
+            auto const ii = this->m_textures.find(key);
+            if(ii != this->m_textures.end() && ii->second == texture)return;
+            CALL_NEXT(glBindTexture,target,texture);
+            this->m_textures[key] = texture;
+            this->m_textureUnits.erase(unit);
+          }
+
+          void m_glBindTextureUnit_cache(GLuint unit,GLuint texture){
+            auto const ii = this->m_textureUnits.find(unit);
+            if(ii != this->m_textureUnits.end() && ii->second == texture)return;
+            CALL_NEXT(glBindTextureUnit,unit,texture);
+            //target of texture is not known, all targets of the unit are forgotten
+            this->m_forgetTextureUnit(unit);
+            this->m_textureUnits[unit] = texture;
+          }
+
+          void m_glBindTextures_cache(GLuint first,GLsizei count,const GLuint*textures){
+            CALL_NEXT(glBindTextures,first,count,textures);
+            for(GLuint unit=first;unit<first+GLuint(count);++unit){
+              this->m_forgetTextureUnit(unit);
+              this->m_textureUnits.erase(unit);
+            }
+          }
+
+          void m_glDeleteTextures_cache(GLsizei n,const GLuint*textures){
+            CALL_NEXT(glDeleteTextures,n,textures);
+            m_unbindDeleted(this->m_textures    ,n,textures);
+            //only the target of deleted texture is reset to 0, other targets of the unit are not known
+            m_forgetDeleted(this->m_textureUnits,n,textures);
+          }
+
+          void m_glBindSampler_cache(GLuint unit,GLuint sampler){
+            auto const ii = this->m_samplers.find(unit);
+            if(ii != this->m_samplers.end() && ii->second == sampler)return;
+            CALL_NEXT(glBindSampler,unit,sampler);
+            this->m_samplers[unit] = sampler;
+          }
+
+          void m_glBindSamplers_cache(GLuint first,GLsizei count,const GLuint*samplers){
+            CALL_NEXT(glBindSamplers,first,count,samplers);
+            for(GLsizei i=0;i<count;++i)
+              this->m_samplers[first+GLuint(i)] = samplers?samplers[i]:0;
+          }
+
+          void m_glDeleteSamplers_cache(GLsizei count,const GLuint*samplers){
+            CALL_NEXT(glDeleteSamplers,count,samplers);
+            m_unbindDeleted(this->m_samplers,count,samplers);
+          }
+
+          void m_glBindFramebuffer_cache(GLenum target,GLuint framebuffer){
+            bool const draw = target == GL_FRAMEBUFFER || target == GL_DRAW_FRAMEBUFFER;
+            bool const read = target == GL_FRAMEBUFFER || target == GL_READ_FRAMEBUFFER;
+            if((!draw || this->m_isBound(GL_DRAW_FRAMEBUFFER_BINDING,framebuffer)) &&
+               (!read || this->m_isBound(GL_READ_FRAMEBUFFER_BINDING,framebuffer)))return;
+            CALL_NEXT(glBindFramebuffer,target,framebuffer);
+            if(draw)this->m_bindings[GL_DRAW_FRAMEBUFFER_BINDING] = framebuffer;
+            if(read)this->m_bindings[GL_READ_FRAMEBUFFER_BINDING] = framebuffer;
+          }
+
+          void m_glDeleteFramebuffers_cache(GLsizei n,const GLuint*framebuffers){
+            CALL_NEXT(glDeleteFramebuffers,n,framebuffers);
+            this->m_unbindDeleted(GL_DRAW_FRAMEBUFFER_BINDING,n,framebuffers);
+            this->m_unbindDeleted(GL_READ_FRAMEBUFFER_BINDING,n,framebuffers);
+          }
+
+          void m_glBindRenderbuffer_cache(GLenum target,GLuint renderbuffer){
+            if(this->m_isBound(GL_RENDERBUFFER_BINDING,renderbuffer))return;
+            CALL_NEXT(glBindRenderbuffer,target,renderbuffer);
+            this->m_bindings[GL_RENDERBUFFER_BINDING] = renderbuffer;
+          }
+
+          void m_glDeleteRenderbuffers_cache(GLsizei n,const GLuint*renderbuffers){
+            CALL_NEXT(glDeleteRenderbuffers,n,renderbuffers);
+            this->m_unbindDeleted(GL_RENDERBUFFER_BINDING,n,renderbuffers);
+          }
+
+          void m_glEnable_cache(GLenum cap){
+            auto const ii = this->m_capabilities.find(cap);
+            if(ii != this->m_capabilities.end() && ii->second == GL_TRUE)return;
+            CALL_NEXT(glEnable,cap);
+            this->m_capabilities[cap] = GL_TRUE;
+          }
+
+          void m_glDisable_cache(GLenum cap){
+            auto const ii = this->m_capabilities.find(cap);
+            if(ii != this->m_capabilities.end() && ii->second == GL_FALSE)return;
+            CALL_NEXT(glDisable,cap);
+            this->m_capabilities[cap] = GL_FALSE;
+          }
+
+          void m_glEnablei_cache(GLenum cap,GLuint index){
+            CALL_NEXT(glEnablei,cap,index);
+            this->m_capabilities.erase(cap);
+          }
+
+          void m_glDisablei_cache(GLenum cap,GLuint index){
+            CALL_NEXT(glDisablei,cap,index);
+            this->m_capabilities.erase(cap);
+          }
+
+          GLboolean m_glIsEnabled_cache(GLenum cap){
+            auto const ii = this->m_capabilities.find(cap);
+            if(ii != this->m_capabilities.end())return ii->second;
+            GLboolean const enabled = CALL_NEXT(glIsEnabled,cap);
+            this->m_capabilities[cap] = enabled;
+            return enabled;
+          }
+
+          void m_glGetIntegerv_cache(GLenum pname,GLint*data){
+            GLenum const textureTarget = textureBinding2Target(pname);
+            if(textureTarget){
+              auto const key = std::make_pair(this->m_activeTextureUnit(),textureTarget);
+              auto const ii = this->m_textures.find(key);
+              if(ii != this->m_textures.end()){
+                *data = GLint(ii->second);
+                return;
+              }
+              CALL_NEXT(glGetIntegerv,pname,data);
+              this->m_textures[key] = GLuint(*data);
+              return;
+            }
+            if(pname == GL_SAMPLER_BINDING){
+              this->m_glGetIntegeri_v_cache(pname,this->m_activeTextureUnit(),data);
+              return;
+            }
+            bool const cached =
+              bufferBinding2Target(pname)                ||
+              pname == GL_VERTEX_ARRAY_BINDING           ||
+              pname == GL_CURRENT_PROGRAM                ||
+              pname == GL_PROGRAM_PIPELINE_BINDING       ||
+              pname == GL_ACTIVE_TEXTURE                 ||
+              pname == GL_DRAW_FRAMEBUFFER_BINDING       ||
+              pname == GL_READ_FRAMEBUFFER_BINDING       ||
+              pname == GL_RENDERBUFFER_BINDING           ;
+            if(!cached){
+              CALL_NEXT(glGetIntegerv,pname,data);
+              return;
+            }
+            auto const ii = this->m_bindings.find(pname);
+            if(ii != this->m_bindings.end()){
+              *data = GLint(ii->second);
+              return;
+            }
+            CALL_NEXT(glGetIntegerv,pname,data);
+            this->m_bindings[pname] = GLuint(*data);
+          }
+
+          void m_glGetIntegeri_v_cache(GLenum target,GLuint index,GLint*data){
+            if(target != GL_SAMPLER_BINDING){
+              CALL_NEXT(glGetIntegeri_v,target,index,data);
+              return;
+            }
+            auto const ii = this->m_samplers.find(index);
+            if(ii != this->m_samplers.end()){
+              *data = GLint(ii->second);
+              return;
+            }
+            //GL_SAMPLER_BINDING is not an indexed state, it is queried on active texture unit
+            GLuint const activeUnit = this->m_activeTextureUnit();
+            if(index != activeUnit)CALL_NEXT(glActiveTexture,GL_TEXTURE0+index);
+            *data = 0;
+            CALL_NEXT(glGetIntegerv,GL_SAMPLER_BINDING,data);
+            if(index != activeUnit)CALL_NEXT(glActiveTexture,GL_TEXTURE0+activeUnit);
+            this->m_samplers[index] = GLuint(*data);
+          }
+      };
+  }
+}
+
+#undef CALL_NEXT
+#undef CACHE_STATE
@@ -0,0 +1,116 @@
+#pragma once
+
+#include<condition_variable>
+#include<cstdint>
+#include<deque>
+#include<functional>
+#include<map>
+#include<memory>
+#include<mutex>
+#include<string>
+#include<thread>
+#include<vector>
+#include<geGL/Texture.h>
+#include<geGL/Buffer.h>
+
+/**
+ * @brief asynchronous streaming of 2D textures
+ * Images are decoded by pool of worker threads (decoder is supplied by application,
+ * for example it wraps FreeImageImageLoader), decoded mip levels are uploaded on render thread
+ * by update() through persistently mapped pixel buffer ring, so neither decoding nor
+ * driver copies stall the frame.
+ * Textures are refined progressively from the coarsest level, GL_TEXTURE_BASE_LEVEL is
+ * moved to the finest uploaded level, so texture can be used as soon as getTexture() returns it.
+ * Priority is screen-space size of texture in pixels, it orders decoding and uploads and
+ * it limits the finest level that is uploaded.
+ * Textures that exceed memory budget are evicted in LRU order, texture is used
+ * in the frame in which it is requested. Evicted texture is released by the streamer
+ * and it is decoded again when it is requested later.
+ * All methods except decoder have to be called from the thread of OpenGL context.
+ */
+class GEGL_EXPORT ge::gl::TextureStreamer{
+  public:
+    /**
+     * @brief decoded image, levels are tightly packed, level 0 is the largest one
+     */
+    struct Image{
+      GLenum  internalFormat = GL_RGBA8        ;
+      GLenum  format         = GL_RGBA         ;
+      GLenum  type           = GL_UNSIGNED_BYTE;
+      GLsizei width          = 0               ;
+      GLsizei height         = 0               ;
+      std::vector<std::vector<uint8_t>>levels  ;
+    };
+    enum State{
+      UNKNOWN  ,///< texture has not been requested
+      QUEUED   ,///< waiting for decoder
+      DECODING ,
+      DECODED  ,///< waiting for upload
+      RESIDENT ,///< at least one level is uploaded
+      FAILED   ,///< decoder failed
+    };
+    using Decoder = std::function<bool(std::string const&path,Image&image)>;
+    TextureStreamer(
+        Decoder              const&decoder              ,
+        size_t                     nofWorkers   = 2     ,
+        size_t                     ringSize     = 1<<24 );
+    TextureStreamer(
+        FunctionTablePointer const&table                ,
+        Decoder              const&decoder              ,
+        size_t                     nofWorkers   = 2     ,
+        size_t                     ringSize     = 1<<24 );
+    ~TextureStreamer();
+    void request(std::string const&path,float screenSize = 0.f);
+    void update();
+    std::shared_ptr<Texture>getTexture(std::string const&path)const;
+    State  getState        (std::string const&path)const;
+    GLint  getResidentLevel(std::string const&path)const;
+    void   setMemoryBudget(size_t bytes);
+    size_t getMemoryBudget()const;
+    void   setUploadBudget(size_t bytes);
+    size_t getUploadBudget()const;
+    size_t getMemoryUsage ()const;
+    size_t getRingSize    ()const;
+    uint64_t getFrame     ()const;
+  protected:
+    struct Item{
+      State                   state      = QUEUED;
+      float                   priority   = 0.f   ;
+      uint64_t                lastUse    = 0     ;
+      Image                   image              ;
+      std::shared_ptr<Texture>texture            ;
+      GLint                   level      = -1    ;///< finest completely uploaded level, -1 if none
+      GLsizei                 rows       = 0     ;///< uploaded rows of level-1
+      size_t                  size       = 0     ;///< bytes of all levels
+    };
+    struct Fence{
+      GLsync sync ;
+      size_t bytes;///< bytes of ring released by the fence
+    };
+    FunctionTablePointer                        _table                 ;
+    Decoder                                     _decoder               ;
+    std::map<std::string,std::shared_ptr<Item>> _items                 ;
+    mutable std::mutex                          _mutex                 ;///< guards state, priority and image of items
+    std::condition_variable                     _condition             ;
+    std::vector<std::thread>                    _workers               ;
+    bool                                        _stop          = false ;
+    std::shared_ptr<Buffer>                     _ring                  ;
+    uint8_t*                                    _ringData      = nullptr;
+    size_t                                      _ringSize      = 0     ;
+    size_t                                      _ringHead      = 0     ;
+    size_t                                      _ringUsed      = 0     ;
+    size_t                                      _frameBytes    = 0     ;///< ring bytes used by current frame
+    std::deque<Fence>                           _fences                ;
+    size_t                                      _memoryBudget  = size_t(-1);
+    size_t                                      _uploadBudget  = 1<<22 ;
+    size_t                                      _memoryUsage   = 0     ;
+    uint64_t                                    _frame         = 0     ;
+    void _init(size_t nofWorkers,size_t ringSize);
+    void _work();
+    GLint _targetLevel(Item const&item)const;
+    bool _makeResident(Item&item);
+    void _evict(Item&item);
+    bool _allocate(size_t size,size_t&offset);
+    void _retireFences();
+    size_t _upload(Item&item,size_t budget);
+};
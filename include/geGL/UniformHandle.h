@@ -0,0 +1,29 @@
+#pragma once
+
+#include<geGL/OpenGL.h>
+
+namespace ge{
+  namespace gl{
+    class UniformHandle;
+    class Program;
+  }
+}
+
+/**
+ * @brief resolved uniform variable of a Program
+ * It is obtained by Program::getUniformHandle after linking.
+ * Program::set* methods that take handle do not search uniform by name
+ * and can skip redundant glProgramUniform* calls using shadow copy of uniform values.
+ */
+class ge::gl::UniformHandle{
+  public:
+    GLint  location     = -1;///< uniform location
+    GLenum type         =  0;///< type of uniform (GL_FLOAT_VEC4, ...)
+    GLint  size         =  0;///< number of array elements
+    GLuint elementSize  =  0;///< size of one array element in bytes
+    GLuint cacheOffset  =  0;///< offset of values in shadow copy in bytes
+    GLuint cacheElement =  0;///< index of first element in shadow copy
+    Program const*program    = nullptr;///< program that created the handle
+    uint64_t      generation = 0      ;///< reflection of the program the handle belongs to, it changes by relinking
+    bool isValid()const{return this->location >= 0;}
+};
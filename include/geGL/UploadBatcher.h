@@ -0,0 +1,69 @@
+#pragma once
+
+#include<cstdint>
+#include<deque>
+#include<memory>
+#include<vector>
+#include<geGL/Buffer.h>
+
+/**
+ * @brief coalesces many small buffer updates into few copies
+ * setData() only copies data into CPU staging memory and records destination range.
+ * flush() sorts recorded ranges per buffer, merges overlapping and adjacent ones
+ * (later writes win), packs merged ranges into persistently mapped staging buffer
+ * and issues one glCopyNamedBufferSubData per merged range.
+ * Number of driver calls scales with the number of changed regions instead of the number of writes.
+ * Staging buffer is a ring fenced per flush, if it is full (GPU is behind), the merged range
+ * is uploaded by glNamedBufferSubData instead of waiting.
+ * Destination buffers have to live until flush(), their ids are read in flush(),
+ * so they can be reallocated in between. Buffer that is released before flush()
+ * has to be removed from the batcher by cancel().
+ */
+class GEGL_EXPORT ge::gl::UploadBatcher{
+  public:
+    UploadBatcher(
+        GLsizeiptr                 stagingSize = 1<<22);
+    UploadBatcher(
+        FunctionTablePointer const&table              ,
+        GLsizeiptr                 stagingSize = 1<<22);
+    ~UploadBatcher();
+    UploadBatcher(UploadBatcher const&) = delete;
+    void setData(
+        Buffer     const&buffer,
+        GLvoid     const*data  ,
+        GLsizeiptr       size  ,
+        GLintptr         offset);
+    void flush();
+    void cancel(Buffer const&buffer);
+    size_t     getNofPendingWrites()const;
+    GLsizeiptr getPendingSize     ()const;
+    GLsizeiptr getStagingSize     ()const;
+    size_t     getNofWrites       ()const;
+    size_t     getNofCopies       ()const;
+    size_t     getNofFallbacks    ()const;
+  protected:
+    struct Write{
+      Buffer const*buffer;
+      GLintptr     offset;///< offset in destination buffer
+      GLsizeiptr   size  ;
+      size_t       data  ;///< offset in _data
+    };
+    struct Fence{
+      GLsync sync ;
+      size_t bytes;///< bytes of ring released by the fence
+    };
+    std::shared_ptr<Buffer> _staging              ;
+    uint8_t*                _stagingData = nullptr;
+    size_t                  _stagingSize = 0      ;
+    size_t                  _ringHead    = 0      ;
+    size_t                  _ringUsed    = 0      ;
+    std::deque<Fence>       _fences               ;
+    std::vector<uint8_t>    _data                 ;///< data of pending writes
+    std::vector<Write>      _writes               ;///< pending writes in order of calls
+    size_t                  _nofWrites    = 0     ;///< statistics of the last flush
+    size_t                  _nofCopies    = 0     ;
+    size_t                  _nofFallbacks = 0     ;
+    void _init(GLsizeiptr stagingSize);
+    void _retireFences();
+    bool _allocate(size_t size,size_t&offset);
+};
@@ -1,6 +1,9 @@
 #ifndef GE_RG_ALLOCATION_MANAGERS_H
 #define GE_RG_ALLOCATION_MANAGERS_H
 
+#include <map>
+#include <set>
+#include <utility>
 #include <vector>
 #include <geRG/Export.h>
 
@@ -18,15 +21,21 @@ namespace ge
        *  The smallest allocation is one array element, or theoretically zero
        *  for allocating just ID. All the items in the array are expected to be
        *  of the same size. The smallest item size is 1 byte.
+       *
+       *  Allocations are linked in the order of their memory by nextRec and prevRec
+       *  members. The chain starts by the null object (id 0). Freed memory blocks
+       *  stay in the chain with the owner set to null until they are reused
+       *  or merged with the neighbouring free blocks.
        */
       template<typename OwnerType>
       struct ArrayAllocation {
          unsigned startIndex;       ///< Index of the start of the allocated array. The real offset is startIndex multiplied by the size of the array item.
          unsigned numItems;         ///< Number of items in the array. The real size is numItems multiplied by the size of the item.
          unsigned nextRec;          ///< \brief Index of ArrayAllocation whose allocated memory follows the current block's memory.
+         unsigned prevRec;          ///< \brief Index of ArrayAllocation whose allocated memory precedes the current block's memory.
          OwnerType *owner;          ///< Object that owns the allocated array. Null indicates free memory block.
          inline ArrayAllocation()  {}  ///< Default constructor. It does nothing.
-         inline ArrayAllocation(unsigned startIndex,unsigned numItems,unsigned nextRec,OwnerType *owner);  ///< Constructs object by the given values.
+         inline ArrayAllocation(unsigned startIndex,unsigned numItems,unsigned nextRec,unsigned prevRec,OwnerType *owner);  ///< Constructs object by the given values.
       };
 
 
@@ -37,6 +46,13 @@ namespace ge
        *  The smallest allocation unit is one item. The largest allocation possible
        *  is equal to the largest available continuous block.
        *
+       *  New arrays are placed into the smallest free block that is large enough
+       *  (best fit). Only if there is no such block, the array is allocated
+       *  from the free space at the end of the managed memory. Freed arrays
+       *  are merged with adjacent free blocks, and free blocks touching the end
+       *  of the allocated memory are returned to the free space at the end.
+       *  Ids of the merged blocks are recycled by the following allocations.
+       *
        *  ArrayAllocationManager does not maintain any memory buffer. It just provides
        *  memory management functionality. See BufferStorage template for combining
        *  ge::gl::BufferObject and ArrayAllocationManager functionality.
@@ -51,6 +67,15 @@ namespace ge
          unsigned _numItemsAvailableAtTheEnd;   ///< Number of available items at the end of the managed memory, e.g. number of items in the block at the end.
          unsigned _firstItemAvailableAtTheEnd;  ///< Index of the first available item at the end of the managed memory, e.g. the first available item that is followed by available items only.
          unsigned _idOfArrayAtTheEnd;           ///< Id (index to std::vector\<BlockAllocation\>) of the last allocated block at the end of the managed memory.
+         std::set<std::pair<unsigned,unsigned>> _freeBlocks;  ///< Free blocks that are not at the end of the managed memory, ordered by their size (first) and id (second).
+         std::map<unsigned,unsigned> _freeBlocksByStartIndex;  ///< The same free blocks as in _freeBlocks, mapping their startIndex to their id. It gives the first free block in constant time.
+         std::vector<unsigned> _unusedIds;      ///< Ids of ArrayAllocations that were released by merging of free blocks and that are ready for reuse.
+
+         inline unsigned newRecord();
+         inline void releaseRecord(unsigned id);
+         void mergeFreeBlock(unsigned id);
+         inline void insertFreeBlock(unsigned id);
+         inline void eraseFreeBlock(unsigned id);
 
       public:
 
@@ -68,6 +93,10 @@ namespace ge
          inline unsigned firstItemAvailableAtTheEnd() const; ///< Returns the index of the first available item at the end of the managed memory, e.g. the first available item that is followed by available items only.
          inline unsigned idOfArrayAtTheEnd() const;          ///< Returns id (index to std::vector\<ArrayAllocation\>) of the last allocated array at the end of the managed memory.
          inline unsigned numNullItems() const;               ///< Returns the number of null items. Null items are stored in the array with Id 0 and always placed on the beginning of the allocated memory or buffer.
+         inline unsigned numFreeBlocks() const;              ///< Returns the number of free blocks surrounded by allocated arrays, e.g. the free space at the end is not counted.
+         inline unsigned numItemsInFreeBlocks() const;       ///< Returns the number of available items that are not at the end of the managed memory.
+         inline unsigned largestFreeBlock() const;           ///< Returns the number of items of the largest free block surrounded by allocated arrays.
+         inline float fragmentation() const;                 ///< Returns the fragmentation ratio in the range 0 to 1. Zero means that all available items form a single continuous block.
 
          inline ArrayAllocation<ArrayOwnerType>& operator[](unsigned id);
          inline const ArrayAllocation<ArrayOwnerType>& operator[](unsigned id) const;
@@ -78,8 +107,13 @@ namespace ge
 
          inline bool canAllocate(unsigned numItems) const;
          unsigned alloc(unsigned numItems,ArrayOwnerType &owner);  // Allocates number of items. Returns id or zero on failure.
-         inline void free(unsigned id);  // Frees allocated items. Id must be valid. Zero id is allowed and safely ignored.
+         void free(unsigned id);  // Frees allocated items. Id must be valid. Zero id is allowed and safely ignored.
          void clear();
+
+         unsigned firstFreeBlock() const;  ///< Returns id of the free block with the lowest startIndex or zero if there are no free blocks except the free space at the end.
+         void moveToPrecedingFreeBlock(unsigned id);
+         template<typename CopyFunc,typename MovedFunc>
+         unsigned compact(unsigned maxItems,CopyFunc copy,MovedFunc moved);
       };
 
 
@@ -148,6 +182,7 @@ namespace ge
 
 // inline and template methods
 
+#include <cassert>
 #include <cstring>
 
 namespace ge
@@ -155,8 +190,8 @@ namespace ge
    namespace rg
    {
 
-      template<typename OwnerType> inline ArrayAllocation<OwnerType>::ArrayAllocation(unsigned startIndex,unsigned numItems,unsigned nextRec,OwnerType *owner)
-      { this->startIndex=startIndex; this->numItems=numItems; this->nextRec=nextRec; this->owner=owner; }
+      template<typename OwnerType> inline ArrayAllocation<OwnerType>::ArrayAllocation(unsigned startIndex,unsigned numItems,unsigned nextRec,unsigned prevRec,OwnerType *owner)
+      { this->startIndex=startIndex; this->numItems=numItems; this->nextRec=nextRec; this->prevRec=prevRec; this->owner=owner; }
 
       template<typename OwnerType>
       inline ArrayAllocationManager<OwnerType>::ArrayAllocationManager(unsigned capacity)
@@ -165,7 +200,7 @@ namespace ge
       {
          // zero element is reserved for invalid object
          // and it serves as Null object (Null object design pattern)
-         _allocations.emplace_back(0,0,0,nullptr);
+         _allocations.emplace_back(0,0,0,0,nullptr);
       }
       template<typename OwnerType>
       inline ArrayAllocationManager<OwnerType>::ArrayAllocationManager(unsigned capacity,unsigned numItemsOfNullObject)
@@ -175,7 +210,7 @@ namespace ge
       {
          // zero element is reserved for invalid object
          // and it serves as Null object (Null object design pattern)
-         _allocations.emplace_back(0,numItemsOfNullObject,0,nullptr);
+         _allocations.emplace_back(0,numItemsOfNullObject,0,0,nullptr);
       }
       template<typename OwnerType> void ArrayAllocationManager<OwnerType>::setCapacity(unsigned value)
       {
@@ -189,7 +224,10 @@ namespace ge
       {
          auto numItemsOfNullArray=numNullItems();
          _allocations.clear();
-         _allocations.emplace_back(0,numItemsOfNullArray,0,nullptr);
+         _allocations.emplace_back(0,numItemsOfNullArray,0,0,nullptr);
+         _freeBlocks.clear();
+         _freeBlocksByStartIndex.clear();
+         _unusedIds.clear();
          _available=_capacity-numItemsOfNullArray;
          _numItemsAvailableAtTheEnd=_available;
          _firstItemAvailableAtTheEnd=numItemsOfNullArray;
@@ -210,11 +248,18 @@ namespace ge
 
       template<typename OwnerType> inline unsigned ArrayAllocationManager<OwnerType>::capacity() const  { return _capacity; }
       template<typename OwnerType> inline unsigned ArrayAllocationManager<OwnerType>::available() const  { return _available; }
-      template<typename OwnerType> inline unsigned ArrayAllocationManager<OwnerType>::largestAvailable() const  { return _numItemsAvailableAtTheEnd; }
+      template<typename OwnerType> inline unsigned ArrayAllocationManager<OwnerType>::largestAvailable() const
+      { unsigned b=largestFreeBlock(); return b>_numItemsAvailableAtTheEnd?b:_numItemsAvailableAtTheEnd; }
       template<typename OwnerType> inline unsigned ArrayAllocationManager<OwnerType>::numItemsAvailableAtTheEnd() const  { return _numItemsAvailableAtTheEnd; }
       template<typename OwnerType> inline unsigned ArrayAllocationManager<OwnerType>::firstItemAvailableAtTheEnd() const  { return _firstItemAvailableAtTheEnd; }
       template<typename OwnerType> inline unsigned ArrayAllocationManager<OwnerType>::idOfArrayAtTheEnd() const  { return _idOfArrayAtTheEnd; }
       template<typename OwnerType> inline unsigned ArrayAllocationManager<OwnerType>::numNullItems() const  { return _allocations[0].numItems; }
+      template<typename OwnerType> inline unsigned ArrayAllocationManager<OwnerType>::numFreeBlocks() const  { return unsigned(_freeBlocks.size()); }
+      template<typename OwnerType> inline unsigned ArrayAllocationManager<OwnerType>::numItemsInFreeBlocks() const  { return _available-_numItemsAvailableAtTheEnd; }
+      template<typename OwnerType> inline unsigned ArrayAllocationManager<OwnerType>::largestFreeBlock() const
+      { return _freeBlocks.empty() ? 0 : _freeBlocks.rbegin()->first; }
+      template<typename OwnerType> inline float ArrayAllocationManager<OwnerType>::fragmentation() const
+      { return _available==0 ? 0.f : 1.f-float(largestAvailable())/float(_available); }
       inline unsigned ItemAllocationManager::capacity() const  { return _capacity; }
       inline unsigned ItemAllocationManager::available() const  { return _available; }
       inline unsigned ItemAllocationManager::largestAvailable() const  { return _numItemsAvailableAtTheEnd; }
@@ -244,18 +289,76 @@ namespace ge
       inline unsigned ItemAllocationManager::lastId() const  { return _firstItemAvailableAtTheEnd-1; }
 
       template<typename OwnerType> inline bool ArrayAllocationManager<OwnerType>::canAllocate(unsigned numItems) const
-      { return _numItemsAvailableAtTheEnd>=numItems; }
+      { return largestAvailable()>=numItems; }
       inline bool ItemAllocationManager::canAllocate(unsigned numItems) const
       { return _numItemsAvailableAtTheEnd>=numItems; }
 
+      template<typename OwnerType>
+      inline unsigned ArrayAllocationManager<OwnerType>::newRecord()
+      {
+         if(_unusedIds.empty()) {
+            _allocations.emplace_back(0,0,0,0,nullptr);
+            return unsigned(_allocations.size()-1);
+         }
+         unsigned id=_unusedIds.back();
+         _unusedIds.pop_back();
+         return id;
+      }
+      template<typename OwnerType>
+      inline void ArrayAllocationManager<OwnerType>::releaseRecord(unsigned id)
+      {
+         _allocations[id]=ArrayAllocation<OwnerType>(0,0,0,0,nullptr);
+         _unusedIds.push_back(id);
+      }
+      template<typename OwnerType>
+      inline void ArrayAllocationManager<OwnerType>::insertFreeBlock(unsigned id)
+      {
+         const ArrayAllocation<OwnerType> &a=_allocations[id];
+         _freeBlocks.emplace(a.numItems,id);
+         _freeBlocksByStartIndex.emplace(a.startIndex,id);
+      }
+      template<typename OwnerType>
+      inline void ArrayAllocationManager<OwnerType>::eraseFreeBlock(unsigned id)
+      {
+         const ArrayAllocation<OwnerType> &a=_allocations[id];
+         _freeBlocks.erase(std::make_pair(a.numItems,id));
+         _freeBlocksByStartIndex.erase(a.startIndex);
+      }
+
       template<typename OwnerType>
       unsigned ArrayAllocationManager<OwnerType>::alloc(unsigned numItems,OwnerType &owner)
       {
+         // best fit among free blocks
+         if(numItems>0) {
+            auto it=_freeBlocks.lower_bound(std::make_pair(numItems,0u));
+            if(it!=_freeBlocks.end()) {
+               unsigned id=it->second;
+               eraseFreeBlock(id);
+
+               // split the block, the remainder stays free
+               unsigned remainder=_allocations[id].numItems-numItems;
+               if(remainder>0) {
+                  unsigned rid=newRecord(); // may reallocate _allocations
+                  ArrayAllocation<OwnerType> &a=_allocations[id];
+                  _allocations[rid]=ArrayAllocation<OwnerType>(a.startIndex+numItems,remainder,a.nextRec,id,nullptr);
+                  _allocations[a.nextRec].prevRec=rid; // nextRec is never zero for free blocks
+                  a.numItems=numItems;
+                  a.nextRec=rid;
+                  insertFreeBlock(rid);
+               }
+
+               _allocations[id].owner=&owner;
+               _available-=numItems;
+               return id;
+            }
+         }
+
+         // allocate at the end
          if(_numItemsAvailableAtTheEnd<numItems)
             return 0;
 
-         unsigned id=unsigned(_allocations.size());
-         _allocations.emplace_back(_firstItemAvailableAtTheEnd,numItems,0,&owner);
+         unsigned id=newRecord();
+         _allocations[id]=ArrayAllocation<OwnerType>(_firstItemAvailableAtTheEnd,numItems,0,_idOfArrayAtTheEnd,&owner);
          _allocations.operator[](_idOfArrayAtTheEnd).nextRec=id;
          _available-=numItems;
          _numItemsAvailableAtTheEnd-=numItems;
@@ -263,7 +366,150 @@ namespace ge
          _idOfArrayAtTheEnd=id;
          return id;
       }
-      template<typename OwnerType> inline void ArrayAllocationManager<OwnerType>::free(unsigned id)  { _allocations.operator[](id).owner=nullptr; }
+      template<typename OwnerType>
+      void ArrayAllocationManager<OwnerType>::free(unsigned id)
+      {
+         if(id==0)
+            return;
+         if(_allocations[id].owner==nullptr) {
+            assert(0 && "ArrayAllocationManager::free(): Freeing non-allocated or already freed array");
+            return;
+         }
+         _allocations[id].owner=nullptr;
+         _available+=_allocations[id].numItems;
+         mergeFreeBlock(id);
+      }
+      template<typename OwnerType>
+      void ArrayAllocationManager<OwnerType>::mergeFreeBlock(unsigned id)
+      {
+         // merge with the following free block
+         unsigned next=_allocations[id].nextRec;
+         if(next!=0 && _allocations[next].owner==nullptr) {
+            ArrayAllocation<OwnerType> &a=_allocations[id];
+            ArrayAllocation<OwnerType> &n=_allocations[next];
+            eraseFreeBlock(next);
+            a.numItems+=n.numItems;
+            a.nextRec=n.nextRec;
+            if(n.nextRec!=0)
+               _allocations[n.nextRec].prevRec=id;
+            releaseRecord(next);
+         }
+
+         // merge with the preceding free block
+         // (null object with id 0 is never free block)
+         unsigned prev=_allocations[id].prevRec;
+         if(prev!=0 && _allocations[prev].owner==nullptr) {
+            ArrayAllocation<OwnerType> &a=_allocations[id];
+            ArrayAllocation<OwnerType> &p=_allocations[prev];
+            eraseFreeBlock(prev);
+            p.numItems+=a.numItems;
+            p.nextRec=a.nextRec;
+            if(a.nextRec!=0)
+               _allocations[a.nextRec].prevRec=prev;
+            if(_idOfArrayAtTheEnd==id)
+               _idOfArrayAtTheEnd=prev;
+            releaseRecord(id);
+            id=prev;
+         }
+
+         // return the block at the end of allocated memory to the free space at the end
+         ArrayAllocation<OwnerType> &a=_allocations[id];
+         if(a.nextRec==0) {
+            _numItemsAvailableAtTheEnd+=a.numItems;
+            _firstItemAvailableAtTheEnd=a.startIndex;
+            _idOfArrayAtTheEnd=a.prevRec;
+            _allocations[a.prevRec].nextRec=0;
+            releaseRecord(id);
+         }
+         else if(a.numItems==0) {
+            // freed zero-size array between allocated arrays does not form a free block
+            _allocations[a.prevRec].nextRec=a.nextRec;
+            _allocations[a.nextRec].prevRec=a.prevRec;
+            releaseRecord(id);
+         }
+         else
+            insertFreeBlock(id);
+      }
+
+      template<typename OwnerType>
+      unsigned ArrayAllocationManager<OwnerType>::firstFreeBlock() const
+      {
+         return _freeBlocksByStartIndex.empty() ? 0 : _freeBlocksByStartIndex.begin()->second;
+      }
+
+      /** Moves the allocated array given by id to the beginning of the preceding free block.
+       *  The free block is placed after the array and merged with the following free space.
+       *  Only the allocation info is updated. Moving of the array content
+       *  is responsibility of the caller.
+       */
+      template<typename OwnerType>
+      void ArrayAllocationManager<OwnerType>::moveToPrecedingFreeBlock(unsigned id)
+      {
+         unsigned fid=_allocations[id].prevRec;
+         assert(fid!=0 && _allocations[fid].owner==nullptr && _allocations[id].owner!=nullptr &&
+                "ArrayAllocationManager::moveToPrecedingFreeBlock(): Array must be allocated and preceded by free block");
+         ArrayAllocation<OwnerType> &a=_allocations[id];
+         ArrayAllocation<OwnerType> &f=_allocations[fid];
+         eraseFreeBlock(fid);
+
+         // swap the blocks in the chain (prev->f->a->next becomes prev->a->f->next)
+         unsigned prev=f.prevRec;
+         unsigned next=a.nextRec;
+         a.startIndex=f.startIndex;
+         f.startIndex=a.startIndex+a.numItems;
+         _allocations[prev].nextRec=id;
+         a.prevRec=prev;
+         a.nextRec=fid;
+         f.prevRec=id;
+         f.nextRec=next;
+         if(next!=0)
+            _allocations[next].prevRec=fid;
+         if(_idOfArrayAtTheEnd==id)
+            _idOfArrayAtTheEnd=fid;
+
+         mergeFreeBlock(fid);
+      }
+
+      /** Moves allocated arrays towards the beginning of the managed memory
+       *  to remove free blocks between them. The method processes the free block
+       *  with the lowest address and moves the following array into it,
+       *  until there are no free blocks or maxItems would be exceeded.
+       *  A single array larger than maxItems is moved only if it is the first one,
+       *  so the compaction always progresses.
+       *
+       *  copy(srcIndex,dstIndex,numItems) is called once to move content of each array.
+       *  Destination always precedes the source, but the ranges overlap
+       *  if the array is larger than the free block, so copy has to behave like memmove
+       *  (for instance, by copying through a temporary buffer).
+       *  moved(id,oldStartIndex) is called after the array allocation info was updated,
+       *  oldStartIndex is the index of the first item of the array before the move.
+       *
+       *  Returns the number of moved items.
+       */
+      template<typename OwnerType>
+      template<typename CopyFunc,typename MovedFunc>
+      unsigned ArrayAllocationManager<OwnerType>::compact(unsigned maxItems,CopyFunc copy,MovedFunc moved)
+      {
+         unsigned numMoved=0;
+         while(maxItems>0) {
+            unsigned fid=firstFreeBlock();
+            if(fid==0)
+               break;
+            unsigned id=_allocations[fid].nextRec; // free block is always followed by allocated array
+            unsigned numItems=_allocations[id].numItems;
+            if(numMoved>0 && numMoved+numItems>maxItems)
+               break;
+
+            unsigned src=_allocations[id].startIndex;
+            if(numItems>0)
+               copy(src,_allocations[fid].startIndex,numItems);
+
+            moveToPrecedingFreeBlock(id);
+            moved(id,src);
+            numMoved+=numItems;
+         }
+         return numMoved;
+      }
 
    }
 }
@@ -41,6 +41,12 @@ namespace ge
          std::shared_ptr<ge::gl::VertexArray> _va;
          std::vector<std::shared_ptr<ge::gl::Buffer>> _bufferList;
          std::shared_ptr<ge::gl::Buffer> _eb;
+         std::shared_ptr<ge::gl::Buffer> _compactionBuffer;  ///< Temporary buffer for arrays that overlap their destination during compaction. It grows to the size of the largest moved array.
+
+         void moveBufferData(ge::gl::Buffer &buffer,size_t srcOffset,size_t dstOffset,size_t size);
+
+         void uploadVertexData(Mesh &mesh,const void*const *attribList,unsigned attribListSize,
+                               unsigned numVertices,unsigned fromIndex,bool encoded);
 
       public:
 
@@ -58,6 +64,9 @@ namespace ge
          virtual void uploadVertices(Mesh &mesh,const void*const *attribList,
                                      unsigned attribListSize,
                                      unsigned numVertices,unsigned fromIndex=0);
+         virtual void uploadEncodedVertices(Mesh &mesh,const void*const *attribList,
+                                            unsigned attribListSize,
+                                            unsigned numVertices,unsigned fromIndex=0);  ///< Uploads vertices already converted by AttribType::encode(), each attribute is given by items of AttribType::elementSize() bytes.
          virtual void uploadIndices(Mesh &mesh,const void *indices,
                                     unsigned numIndices,unsigned fromIndex=0);
 
@@ -82,7 +91,10 @@ namespace ge
          inline const std::shared_ptr<ge::gl::Buffer>& elementBuffer() const;
 
          virtual void render(const std::vector<RenderingCommandData>& renderingDataList);
+         virtual void draw(const std::vector<RenderingCommandData>& renderingDataList);  ///< Performs indirect draw calls of render() without binding VAO. The storage is expected to be bound.
          virtual void cancelAllAllocations();
+         virtual unsigned compact(unsigned maxBytes);
+         virtual void setupInstancingMatrixAttribs();
 
          class Factory {
          public:
@@ -1,6 +1,7 @@
 #ifndef GE_RG_ATTRIB_TYPE_H
 #define GE_RG_ATTRIB_TYPE_H
 
+#include <cassert>
 #include <cstdint>
 #include <glm/glm.hpp>
 #include <geRG/Export.h>
@@ -91,6 +92,18 @@ namespace ge
             USE_DOUBLE=3,         ///< Double precision floats are passed directly to the OpenGL pipeline as doubles.
          };
 
+         /** Specifies how attribute data given to AttribStorage::uploadVertices()
+          *  are converted into the stored format. Source data of all encodings
+          *  are floats with numComponents components, except for OCTAHEDRAL_ENCODING
+          *  that takes three-component float normals.
+          */
+         enum Encoding {
+            NO_ENCODING=0,          ///< Data are stored as given.
+            HALF_FLOAT_ENCODING=1,  ///< Floats are converted to half-floats (GLType::HALF_FLOAT).
+            OCTAHEDRAL_ENCODING=2,  ///< Unit vectors are projected on octahedron and stored as two snorm components (GLType::SHORT).
+            UNORM_ENCODING=3,       ///< Floats in the range 0..1 are stored as unorm values (GLType::UNSIGNED_SHORT or GLType::UNSIGNED_BYTE).
+         };
+
       protected:
 
          /** AttribType is stored on 64 bits. Bits distribution is as follows:
@@ -99,7 +112,8 @@ namespace ge
           *  - 10 - bgra flag
           *  - 11..15 - number of components
           *  - 16..31 - glType
-          *  - 32..63 - divisor
+          *  - 32..55 - divisor
+          *  - 56..63 - encoding
           */
          union {
             uint64_t _data64;
@@ -111,10 +125,12 @@ namespace ge
 
          inline AttribType()  {}  ///< \brief Default constructor does nothing.
          inline constexpr AttribType(GLType glType,uint8_t numComponents,uint8_t elementSize,
-                                     TypeHandling typeHandling,unsigned divisor=0);
+                                     TypeHandling typeHandling,unsigned divisor=0,
+                                     Encoding encoding=NO_ENCODING);
                                      ///< Initializes the object by parameters.
          inline constexpr AttribType(GLType glType,uint8_t numComponents,bool bgra,uint8_t elementSize,
-                                     TypeHandling typeHandling,unsigned divisor=0);
+                                     TypeHandling typeHandling,unsigned divisor=0,
+                                     Encoding encoding=NO_ENCODING);
                                      ///< Initializes the object by parameters.
          inline AttribType(const AttribType& a);  ///< Copy constructor.
 
@@ -133,6 +149,10 @@ namespace ge
          inline void setTypeHandling(TypeHandling value);  ///< \brief Sets how the attribute is handled to OpenGL.
          inline uint32_t divisor() const;                  ///< \brief Returns attribute divisor.
          inline void setDivisor(uint32_t value);           ///< \brief Sets attribute divisor.
+         inline Encoding encoding() const;                 ///< \brief Returns how the source data are converted on upload.
+         inline void setEncoding(Encoding value);          ///< \brief Sets how the source data are converted on upload.
+         inline unsigned sourceElementSize() const;        ///< \brief Returns the size (in bytes) of single attribute item of the source data.
+         void encode(void *dst,const void *src,unsigned numVertices) const;
          inline uint64_t asInt64() const;                  ///< \brief Returns AttribType object content as the 64-bit value.
          inline void setAsInt64(uint64_t value);           ///< \brief Sets AttribType object content by the 64-bit value.
 
@@ -243,18 +263,23 @@ namespace ge
          static const AttribType DMat4x2;
          static const AttribType DMat4x3;
 
+         static const AttribType CompressedPosition;  ///< Half-float vec3 encoded from vec3 floats.
+         static const AttribType CompressedNormal;    ///< Octahedral snorm16 vec2 encoded from vec3 float unit vectors.
+         static const AttribType CompressedTexCoord;  ///< Unorm16 vec2 encoded from vec2 floats in the range 0..1.
+         static const AttribType CompressedColor;     ///< Unorm8 vec4 encoded from vec4 floats in the range 0..1.
+
       };
 
 
       // inline and template methods
       inline constexpr AttribType::AttribType(GLType glType,uint8_t numComponents,uint8_t elementSize,
-                                              TypeHandling typeHandling,unsigned divisor)
-            :_data64(uint64_t(divisor)<<32 | uint32_t(glType)<<16 | uint32_t(numComponents)<<11 |
-                     uint32_t(typeHandling)<<8 | elementSize)  {}
+                                              TypeHandling typeHandling,unsigned divisor,Encoding encoding)
+            :_data64(uint64_t(encoding)<<56 | uint64_t(divisor&0x00ffffff)<<32 | uint32_t(glType)<<16 |
+                     uint32_t(numComponents)<<11 | uint32_t(typeHandling)<<8 | elementSize)  {}
       inline constexpr AttribType::AttribType(GLType glType,uint8_t numComponents,bool bgra,uint8_t elementSize,
-                                              TypeHandling typeHandling,unsigned divisor)
-            :_data64(uint64_t(divisor)<<32 | uint32_t(glType)<<16 | uint32_t(numComponents)<<11 |
-                     (bgra?0x0400:0) | uint32_t(typeHandling)<<8 | elementSize)  {}
+                                              TypeHandling typeHandling,unsigned divisor,Encoding encoding)
+            :_data64(uint64_t(encoding)<<56 | uint64_t(divisor&0x00ffffff)<<32 | uint32_t(glType)<<16 |
+                     uint32_t(numComponents)<<11 | (bgra?0x0400:0) | uint32_t(typeHandling)<<8 | elementSize)  {}
       inline AttribType::AttribType(const AttribType& a) : _data64(a._data64)  {}
       inline AttribType& AttribType::operator=(AttribType a) { _data64=a._data64; return *this; }
 
@@ -269,8 +294,18 @@ namespace ge
       inline void AttribType::setElementSize(unsigned value)  { unsigned v=_data16[0]&0xff00; _data16[0]=uint16_t(v|(value&0xff)); }
       inline AttribType::TypeHandling AttribType::typeHandling() const  { return TypeHandling((_data16[0]&0x0300)>>8); }
       inline void AttribType::setTypeHandling(AttribType::TypeHandling value)  { auto v=_data16[0]&0xfc00; _data16[0]=uint16_t(v|value); }
-      inline uint32_t AttribType::divisor() const  { return _data32[1]; }
-      inline void AttribType::setDivisor(uint32_t value)  { _data32[1]=value; }
+      inline uint32_t AttribType::divisor() const  { return _data32[1]&0x00ffffff; }
+      inline void AttribType::setDivisor(uint32_t value)  { _data32[1]=(_data32[1]&0xff000000)|(value&0x00ffffff); }
+      inline AttribType::Encoding AttribType::encoding() const  { return Encoding(_data32[1]>>24); }
+      inline void AttribType::setEncoding(Encoding value)  { _data32[1]=(_data32[1]&0x00ffffff)|(uint32_t(value)<<24); }
+      inline unsigned AttribType::sourceElementSize() const
+      {
+         switch(encoding()) {
+            case NO_ENCODING:         return elementSize();
+            case OCTAHEDRAL_ENCODING: return 4*3;
+            default:                  return 4*numComponents();
+         }
+      }
       inline uint64_t AttribType::asInt64() const  { return _data64; }
       inline void AttribType::setAsInt64(uint64_t value)  { _data64=value; }
 
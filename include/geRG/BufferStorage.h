@@ -31,6 +31,13 @@ namespace ge
        *  BufferStorage maintains buffer (using ge::gl::Buffer) and allows to
        *  allocate data inside it using one of allocation managers. When the buffer
        *  free space is exhausted or gets low, it allows for buffer reallocation.
+       *
+       *  In persistent ring mode (see setPersistentRing()), the buffer holds
+       *  numSegments() copies of the data (segments), each of them used by one frame,
+       *  and it is kept persistently mapped. The current segment is selected by
+       *  setCurrentSegment(). map() returns pointer to the current segment without
+       *  any OpenGL call and unmap() does nothing. Synchronization of the segments
+       *  with GPU is the responsibility of the caller (see RenderingContext::setFrameRingSize()).
        */
       template<typename AllocationManagerT=NoAllocationManager,typename Type=char,unsigned AllocationItemSize=sizeof(Type)>
       class BufferStorage : public AllocationManagerT {
@@ -39,6 +46,13 @@ namespace ge
          std::shared_ptr<ge::gl::Buffer> _buffer;
          Type* _mappedBufferPtr;
          BufferStorageAccess _mappedBufferAccess;
+         unsigned _numSegments;     ///< Number of segments in persistent ring mode, zero if persistent ring mode is not used.
+         unsigned _currentSegment;
+         unsigned _segmentSize;     ///< Size of one segment in bytes.
+         unsigned _bufferFlags;     ///< Buffer usage flags used when persistent ring mode is disabled.
+         char* _persistentBufferPtr;
+
+         void _reallocRing(unsigned numSegments,unsigned segmentSize);
 
       public:
          // MSVC 2013 requires following templated structures to be public
@@ -65,6 +79,16 @@ namespace ge
          inline Type* ptr() const;
          Type* map(BufferStorageAccess access=BufferStorageAccess::READ_WRITE);
          void unmap();
+         void bindBase(unsigned target,unsigned index) const;
+
+         static const unsigned segmentAlignment=256;  ///< Alignment of segments in bytes (maximal GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT of common hardware).
+         void setPersistentRing(unsigned numSegments);
+         inline bool isPersistentRing() const;
+         inline unsigned numSegments() const;
+         inline unsigned currentSegment() const;
+         void setCurrentSegment(unsigned index);
+         inline unsigned segmentSize() const;    ///< Returns size of one segment in bytes in persistent ring mode, size of the buffer otherwise.
+         inline unsigned segmentOffset() const;  ///< Returns offset of the current segment in bytes, zero if persistent ring mode is not used.
 
 #if !defined(_MSC_VER)
          // g++ and similar compilers
@@ -93,6 +117,9 @@ namespace ge
 
 // inline and template methods
 
+#include <algorithm>
+#include <cstring>
+#include <vector>
 #include <geGL/Buffer.h>
 #include <assert.h>
 
@@ -107,6 +134,11 @@ namespace ge
          , _buffer(std::make_shared<ge::gl::Buffer>(capacity*AllocationItemSize,data,flags))
          , _mappedBufferPtr(nullptr)
          , _mappedBufferAccess(BufferStorageAccess::NO_ACCESS)
+         , _numSegments(0)
+         , _currentSegment(0)
+         , _segmentSize(0)
+         , _bufferFlags(flags)
+         , _persistentBufferPtr(nullptr)
       {}
 
       template<typename AllocationManagerT,typename Type,unsigned AllocationItemSize>
@@ -115,6 +147,11 @@ namespace ge
          , _buffer(std::make_shared<ge::gl::Buffer>(capacity*AllocationItemSize,data,flags))
          , _mappedBufferPtr(nullptr)
          , _mappedBufferAccess(BufferStorageAccess::NO_ACCESS)
+         , _numSegments(0)
+         , _currentSegment(0)
+         , _segmentSize(0)
+         , _bufferFlags(flags)
+         , _persistentBufferPtr(nullptr)
       {}
 
       template<typename AllocationManagerT,typename Type,unsigned AllocationItemSize>
@@ -124,6 +161,11 @@ namespace ge
          , _buffer(std::make_shared<ge::gl::Buffer>(bufferSize,data,flags))
          , _mappedBufferPtr(nullptr)
          , _mappedBufferAccess(BufferStorageAccess::NO_ACCESS)
+         , _numSegments(0)
+         , _currentSegment(0)
+         , _segmentSize(0)
+         , _bufferFlags(flags)
+         , _persistentBufferPtr(nullptr)
       {
          assert(bufferSize>=allocManagerCapacity*AllocationItemSize &&
                 "BufferStorage error: Buffer is not large enough to hold all items of AllocationManager.");
@@ -142,9 +184,32 @@ namespace ge
       inline Type* BufferStorage<AllocationManagerT,Type,AllocationItemSize>::ptr() const
       { return _mappedBufferPtr; }
 
+      template<typename AllocationManagerT,typename Type,unsigned AllocationItemSize>
+      inline bool BufferStorage<AllocationManagerT,Type,AllocationItemSize>::isPersistentRing() const
+      { return _numSegments!=0; }
+
+      template<typename AllocationManagerT,typename Type,unsigned AllocationItemSize>
+      inline unsigned BufferStorage<AllocationManagerT,Type,AllocationItemSize>::numSegments() const
+      { return _numSegments; }
+
+      template<typename AllocationManagerT,typename Type,unsigned AllocationItemSize>
+      inline unsigned BufferStorage<AllocationManagerT,Type,AllocationItemSize>::currentSegment() const
+      { return _currentSegment; }
+
+      template<typename AllocationManagerT,typename Type,unsigned AllocationItemSize>
+      inline unsigned BufferStorage<AllocationManagerT,Type,AllocationItemSize>::segmentSize() const
+      { return _numSegments!=0 ? _segmentSize : unsigned(_buffer->getSize()); }
+
+      template<typename AllocationManagerT,typename Type,unsigned AllocationItemSize>
+      inline unsigned BufferStorage<AllocationManagerT,Type,AllocationItemSize>::segmentOffset() const
+      { return _currentSegment*_segmentSize; }
+
       template<typename AllocationManagerT,typename Type,unsigned AllocationItemSize>
       Type* BufferStorage<AllocationManagerT,Type,AllocationItemSize>::map(BufferStorageAccess requestedAccess)
       {
+         if(_numSegments!=0)
+            return _mappedBufferPtr;  // persistently mapped
+
          if(_mappedBufferAccess==BufferStorageAccess::READ_WRITE ||
             _mappedBufferAccess==requestedAccess ||
             requestedAccess==BufferStorageAccess::NO_ACCESS)
@@ -161,7 +226,7 @@ namespace ge
       template<typename AllocationManagerT,typename Type,unsigned AllocationItemSize>
       void BufferStorage<AllocationManagerT,Type,AllocationItemSize>::unmap()
       {
-         if(_mappedBufferAccess==BufferStorageAccess::NO_ACCESS)
+         if(_mappedBufferAccess==BufferStorageAccess::NO_ACCESS || _numSegments!=0)
             return;
 
          _buffer->unmap();
@@ -169,6 +234,95 @@ namespace ge
          _mappedBufferAccess=BufferStorageAccess::NO_ACCESS;
       }
 
+      /** Binds the buffer to the indexed target. In persistent ring mode,
+       *  only the current segment is bound.
+       */
+      template<typename AllocationManagerT,typename Type,unsigned AllocationItemSize>
+      void BufferStorage<AllocationManagerT,Type,AllocationItemSize>::bindBase(unsigned target,unsigned index) const
+      {
+         if(_numSegments==0)
+            _buffer->bindBase(target,index);
+         else
+            _buffer->bindRange(target,index,segmentOffset(),_segmentSize);
+      }
+
+      /** Switches the storage to persistent ring mode with numSegments segments
+       *  or, if numSegments is zero, back to the ordinary mode.
+       *  When called with unchanged number of segments, the segments are enlarged
+       *  to hold capacity() items (for example, after AllocationManager::setCapacity()).
+       *
+       *  The content of the current segment (or of the whole buffer
+       *  in ordinary mode) is copied to all the segments of the new buffer.
+       *  The current segment is reset to zero if the number of segments changes.
+       *  Once persistently mapped, the buffer gets new id on each reallocation.
+       */
+      template<typename AllocationManagerT,typename Type,unsigned AllocationItemSize>
+      void BufferStorage<AllocationManagerT,Type,AllocationItemSize>::setPersistentRing(unsigned numSegments)
+      {
+         unsigned segmentSize=AllocationManagerT::capacity()*AllocationItemSize;
+         segmentSize=(segmentSize+segmentAlignment-1)/segmentAlignment*segmentAlignment;
+         if(numSegments==_numSegments && (numSegments==0 || segmentSize<=_segmentSize))
+            return;
+         _reallocRing(numSegments,segmentSize);
+      }
+
+      template<typename AllocationManagerT,typename Type,unsigned AllocationItemSize>
+      void BufferStorage<AllocationManagerT,Type,AllocationItemSize>::setCurrentSegment(unsigned index)
+      {
+         assert(((_numSegments==0 && index==0) || index<_numSegments) &&
+                "BufferStorage::setCurrentSegment(): Segment index out of range.");
+         _currentSegment=index;
+         if(_numSegments!=0)
+            _mappedBufferPtr=reinterpret_cast<Type*>(_persistentBufferPtr+segmentOffset());
+      }
+
+      template<typename AllocationManagerT,typename Type,unsigned AllocationItemSize>
+      void BufferStorage<AllocationManagerT,Type,AllocationItemSize>::_reallocRing(unsigned numSegments,unsigned segmentSize)
+      {
+         // get the content of the current segment
+         std::vector<char> data;
+         if(_numSegments!=0) {
+            data.assign(_persistentBufferPtr+segmentOffset(),
+                        _persistentBufferPtr+segmentOffset()+std::min(_segmentSize,segmentSize));
+            _buffer->unmap();
+         } else {
+            unmap();
+            data.resize(std::min(unsigned(_buffer->getSize()),segmentSize));
+            if(!data.empty())
+               _buffer->getData(data.data(),GLsizeiptr(data.size()));
+         }
+
+         if(numSegments==0) {
+
+            // ordinary buffer
+            // (once the buffer is immutable, it can not keep its id)
+            _buffer->realloc(segmentSize,ge::gl::Buffer::NEW_BUFFER,_bufferFlags);
+            if(!data.empty())
+               _buffer->setData(data.data(),GLsizeiptr(data.size()));
+            _persistentBufferPtr=nullptr;
+            _mappedBufferPtr=nullptr;
+            _mappedBufferAccess=BufferStorageAccess::NO_ACCESS;
+
+         } else {
+
+            // persistently mapped buffer with the data in each segment
+            // (mutable buffer keeps its id when turned into immutable one)
+            const GLbitfield flags=GL_MAP_READ_BIT|GL_MAP_WRITE_BIT|GL_MAP_PERSISTENT_BIT|GL_MAP_COHERENT_BIT;
+            _buffer->realloc(GLsizeiptr(numSegments)*segmentSize,
+                             _numSegments==0 ? ge::gl::Buffer::KEEP_ID : ge::gl::Buffer::NEW_BUFFER,flags);
+            _persistentBufferPtr=static_cast<char*>(_buffer->map(0,GLsizeiptr(numSegments)*segmentSize,flags));
+            for(unsigned i=0; i<numSegments && !data.empty(); i++)
+               memcpy(_persistentBufferPtr+i*segmentSize,data.data(),data.size());
+            _mappedBufferAccess=BufferStorageAccess::READ_WRITE;
+
+         }
+
+         unsigned currentSegment=(numSegments==_numSegments)?_currentSegment:0;
+         _numSegments=numSegments;
+         _segmentSize=segmentSize;
+         setCurrentSegment(currentSegment);
+      }
+
       template<typename AllocationManagerT,typename Type,unsigned AllocationItemSize>
       template<typename,typename>
       void BufferStorage<AllocationManagerT,Type,AllocationItemSize>::alloc(unsigned *id)
@@ -219,6 +373,14 @@ namespace ge
          unsigned newCapacity=capacity+delta;
          AllocationManagerT::setCapacity(newCapacity);
 
+         // realloc persistent ring
+         if(_numSegments!=0) {
+            unsigned segmentSize=(newCapacity*AllocationItemSize+segmentAlignment-1)/segmentAlignment*segmentAlignment;
+            if(segmentSize>_segmentSize)
+               _reallocRing(_numSegments,segmentSize);
+            return;
+         }
+
          // realloc Buffer
          unsigned bufferSize=unsigned(_buffer->getSize());
          unsigned newBufferSize=newCapacity*AllocationItemSize;
@@ -0,0 +1,110 @@
+#ifndef GE_RG_CULLING_H
+#define GE_RG_CULLING_H
+
+#include <vector>
+#include <geRG/Export.h>
+
+namespace ge
+{
+   namespace rg
+   {
+
+      /** BoundingSphereGpuData is bounding volume of a draw command.
+       *  It is stored in the buffer indexed by the same index as DrawCommandGpuData
+       *  (see RenderingContext::drawCommandBounds()). The sphere is given
+       *  in the space of the instancing matrices of the draw command.
+       *  Negative radius means no bounds, so the draw command is never culled.
+       */
+      struct BoundingSphereGpuData {
+         float center[3];
+         float radius;
+      };
+
+
+      /** HiZBuffer is CPU version of hierarchical depth buffer
+       *  used for occlusion culling.
+       *
+       *  Level 0 holds the depth buffer (values in the range 0..1, rows from the bottom).
+       *  Each texel of the level l holds maximal depth of the corresponding
+       *  2^l x 2^l block of level 0 texels. The levels are rounded up on odd sizes,
+       *  so the last row and column of each level cover the remaining texels.
+       */
+      class GERG_EXPORT HiZBuffer {
+      protected:
+
+         struct Level {
+            unsigned width;
+            unsigned height;
+            std::vector<float> depth;
+         };
+         std::vector<Level> _levels;
+
+      public:
+
+         void build(const float *depth,unsigned width,unsigned height);
+         void clear();
+         inline bool empty() const;
+         inline unsigned numLevels() const;
+         inline unsigned width(unsigned level) const;
+         inline unsigned height(unsigned level) const;
+         inline float depth(unsigned level,unsigned x,unsigned y) const;
+
+         float maxDepth(float x0,float y0,float x1,float y1) const;  ///< Returns maximal depth of the rectangle given in normalized coordinates (0..1). Coarse level is used so that at most 2x2 texels are visited, thus the result is conservative.
+         inline bool isOccluded(float x0,float y0,float x1,float y1,float depth) const;  ///< Returns true if depth is farther than all the depths of the rectangle given in normalized coordinates.
+
+      };
+
+
+      /** Culling class performs frustum and Hi-Z occlusion culling of bounding spheres on CPU.
+       *
+       *  It implements the same test as the culling stage of the compute shader
+       *  used by RenderingContext::processDrawCommands(), so it serves
+       *  as CPU fallback of the culling (see DrawCommandProcessor) and
+       *  as a reference for testing.
+       *
+       *  The sphere is transformed by the instancing matrix, tested against
+       *  the frustum planes extracted from the projection matrix and, if hiZBuffer
+       *  is given, its screen-space bounding rectangle is tested against HiZBuffer.
+       *  Spheres crossing the plane of the camera are considered visible.
+       */
+      class GERG_EXPORT Culling {
+      protected:
+
+         float _projection[16];
+         float _frustumPlanes[6][4];
+
+      public:
+
+         const HiZBuffer *hiZBuffer = nullptr;  ///< Depth buffer for occlusion culling, null disables occlusion culling.
+
+         Culling();
+         void setProjection(const float *projection);  ///< Sets column-major projection matrix and extracts the frustum planes.
+         inline const float* projection() const;
+         inline const float* frustumPlanes() const;  ///< Returns six normalized planes (24 floats) in the order left, right, bottom, top, near and far.
+
+         bool isVisible(const float *instancingMatrix,const BoundingSphereGpuData &bounds) const;
+
+      };
+
+   }
+}
+
+
+
+// inline methods
+namespace ge
+{
+   namespace rg
+   {
+      inline bool HiZBuffer::empty() const  { return _levels.empty(); }
+      inline unsigned HiZBuffer::numLevels() const  { return unsigned(_levels.size()); }
+      inline unsigned HiZBuffer::width(unsigned level) const  { return _levels[level].width; }
+      inline unsigned HiZBuffer::height(unsigned level) const  { return _levels[level].height; }
+      inline float HiZBuffer::depth(unsigned level,unsigned x,unsigned y) const  { return _levels[level].depth[y*_levels[level].width+x]; }
+      inline bool HiZBuffer::isOccluded(float x0,float y0,float x1,float y1,float depth) const  { return depth>maxDepth(x0,y0,x1,y1); }
+      inline const float* Culling::projection() const  { return _projection; }
+      inline const float* Culling::frustumPlanes() const  { return &_frustumPlanes[0][0]; }
+   }
+}
+
+#endif /* GE_RG_CULLING_H */
@@ -0,0 +1,101 @@
+#ifndef GE_RG_DRAW_COMMAND_PROCESSOR_H
+#define GE_RG_DRAW_COMMAND_PROCESSOR_H
+
+#include <vector>
+#include <geRG/Export.h>
+
+namespace ge
+{
+   namespace core
+   {
+      class ThreadPool;
+   }
+   namespace rg
+   {
+      class Culling;
+      struct BoundingSphereGpuData;
+      struct MatrixGpuData;
+
+
+      /** DrawCommandProcessor is CPU implementation of the compute shader
+       *  used by RenderingContext::processDrawCommands().
+       *
+       *  It expands DrawCommandGpuData, PrimitiveGpuData, ListControlGpuData
+       *  and StateSetGpuData into draw indirect buffer records
+       *  (DrawArraysIndirectCommand or DrawElementsIndirectCommand).
+       *  The buffers are addressed by offsets multiplied by 4 (uint indices),
+       *  exactly as they are addressed by the shader.
+       *
+       *  The compute shader places the records of a StateSet in undefined order
+       *  given by atomicAdd() calls. DrawCommandProcessor places them
+       *  in the order of draw commands. The result is the same for any number of threads,
+       *  so it is suitable as a reference for testing.
+       *
+       *  If Culling is given, each draw command whose instances are all culled
+       *  by Culling::isVisible() gets zero instance count.
+       *
+       *  If count buffer is given, records with zero instance count are not written at all
+       *  and the number of written records of each StateSet is counted in the count buffer
+       *  (compaction for ARB_indirect_parameters rendering, see RenderingContext::setIndirectCountEnabled()).
+       *  The records of each StateSet stay packed from its original position.
+       *
+       *  If instance offset buffer is given, base instances of the records
+       *  are draw command indices and the matrix offsets are written into that buffer.
+       *
+       *  When ThreadPool is given, the draw commands are split into chunks.
+       *  The sizes of records of each chunk are summed per StateSet first,
+       *  then the chunks are given their positions in draw indirect buffer
+       *  and finally, the records are written by all the chunks concurrently.
+       */
+      class GERG_EXPORT DrawCommandProcessor {
+      public:
+
+         struct Buffers {
+            const unsigned *primitiveBuffer;          ///< PrimitiveGpuData buffer, usually RenderingContext::primitiveStorage().
+            const unsigned *drawCommandBuffer;        ///< DrawCommandGpuData buffer, usually RenderingContext::drawCommandStorage().
+            const unsigned *matrixListControlBuffer;  ///< ListControlGpuData buffer, usually RenderingContext::matrixListControlStorage().
+            unsigned *drawIndirectBuffer;             ///< Buffer receiving the draw indirect records, usually RenderingContext::drawIndirectBuffer().
+            unsigned *stateSetBuffer;                 ///< StateSetGpuData buffer, usually RenderingContext::stateSetStorage(). Each StateSetGpuData is advanced by the size of the written records.
+            unsigned numStateSetItems;                ///< Number of items in stateSetBuffer.
+            const MatrixGpuData *matrixBuffer;        ///< Instancing matrices, usually RenderingContext::matrixStorage(). Used for culling only.
+            const BoundingSphereGpuData *boundsBuffer;  ///< Bounds of draw commands, indexed by draw command index. Used for culling only.
+            const Culling *culling;                   ///< Culling parameters, null disables culling.
+            unsigned matrixOffset64;                  ///< Added to base instance of each record, usually RenderingContext::matrixStorage()->segmentOffset()/64 (matrixBuffer points to the current segment).
+            unsigned *countBuffer;                    ///< Number of records of each StateSet item, usually RenderingContext::drawCountBuffer(). Null disables compaction. The counts are incremented, so the caller is expected to zero them.
+            unsigned *instanceOffsetBuffer;           ///< Matrix offsets of draw commands, indexed by draw command index. If given, base instance of each record is the draw command index and the matrix offset is written here, so the shaders can fetch per-draw-command data (see RenderingContext::setMaterialTable()). Null keeps matrix offset in base instance.
+         };
+
+      protected:
+
+         std::vector<unsigned> _chunkPositions;  ///< Draw indirect buffer positions of each chunk and StateSet.
+         std::vector<unsigned> _chunkCounts;     ///< Number of records of each chunk and StateSet, used for compaction only.
+         std::vector<unsigned> _instanceCounts;  ///< Instance counts of draw commands computed by the first pass of compaction.
+
+      public:
+
+         void process(const Buffers &buffers,unsigned numDrawCommands,
+                      ge::core::ThreadPool *threadPool=nullptr);
+
+         static void processRange(const Buffers &buffers,unsigned firstDrawCommand,unsigned numDrawCommands);
+         static unsigned instanceCount(const Buffers &buffers,const unsigned *drawCommand);  ///< Returns instance count of the draw command, zero if all the instances are culled.
+         static inline unsigned recordSize(unsigned countAndIndexedFlag);  ///< Returns number of uints of the draw indirect record, 5 for indexed primitives, 4 otherwise.
+
+         unsigned minDrawCommandsPerChunk = 4096;  ///< Smaller amount of draw commands is not split among threads.
+
+      };
+
+   }
+}
+
+
+
+// inline methods
+namespace ge
+{
+   namespace rg
+   {
+      inline unsigned DrawCommandProcessor::recordSize(unsigned countAndIndexedFlag)  { return 4+(countAndIndexedFlag>>31); }
+   }
+}
+
+#endif /* GE_RG_DRAW_COMMAND_PROCESSOR_H */
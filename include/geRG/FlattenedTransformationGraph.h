@@ -0,0 +1,74 @@
+#ifndef GE_RG_FLATTENED_TRANSFORMATION_GRAPH_H
+#define GE_RG_FLATTENED_TRANSFORMATION_GRAPH_H
+
+#include <memory>
+#include <vector>
+#include <geRG/Export.h>
+#include <geRG/MatrixGpuData.h>
+
+namespace ge
+{
+   namespace rg
+   {
+      class Transformation;
+
+
+      /** FlattenedTransformationGraph is compiled, pointer-free form of transformation graph.
+       *
+       *  The nodes are stored in breadth-first order in structure-of-arrays layout:
+       *  index of parent node, index of local matrix, index of world matrix in the output buffer
+       *  and the computed world matrix. As each parent precedes its children,
+       *  world matrices are computed by a single linear pass over the arrays
+       *  (see evaluate()), using SSE for 4x4 matrix multiplication when available.
+       *
+       *  Local matrices are read from the array given to evaluate(), usually
+       *  RenderingContext::cpuTransformationBuffer(), so the changes made through
+       *  Transformation::uploadMatrix() or Transformation::getMatrixPtr() are reflected
+       *  without recompilation. Changes of the graph structure require compile() to be called again.
+       */
+      class GERG_EXPORT FlattenedTransformationGraph {
+      protected:
+
+         std::vector<unsigned> _parentIndices;         ///< Index of the parent node. Root nodes use noParent value.
+         std::vector<unsigned> _localMatrixOffsets64;  ///< Index of the local matrix (usually Transformation::gpuDataOffset64()).
+         std::vector<unsigned> _outputOffsets64;       ///< Index to the output buffer where the world matrix is written. Zero means that it is not written.
+         std::vector<MatrixGpuData> _worldMatrices;    ///< World matrices computed by the last evaluate() call.
+
+      public:
+
+         static const unsigned noParent=0xffffffff;
+
+         void compile(const std::vector<std::shared_ptr<Transformation>>& roots);  ///< Builds flattened graph from transformation graph roots. World matrices are written to Transformation::matrixOffset64() of Transformations with MatrixList, so the graph must be evaluated by RenderingContext before and each Transformation must be reached by single path only.
+         unsigned addNode(unsigned parentIndex,unsigned localMatrixOffset64,unsigned outputOffset64);  ///< Appends node and returns its index. Parent must be added before its children.
+         void clear();
+         void evaluate(const float *localMatrices,MatrixGpuData *outputBuffer);
+
+         inline unsigned numNodes() const;
+         inline unsigned parentIndex(unsigned nodeIndex) const;
+         inline unsigned localMatrixOffset64(unsigned nodeIndex) const;
+         inline unsigned outputOffset64(unsigned nodeIndex) const;
+         inline const MatrixGpuData& worldMatrix(unsigned nodeIndex) const;
+
+         static void multiplyMatrices(const float *a,const float *b,float *result);  ///< Computes result=a*b for column-major 4x4 matrices. The result must not overlap with the operands.
+
+      };
+
+   }
+}
+
+
+
+// inline methods
+namespace ge
+{
+   namespace rg
+   {
+      inline unsigned FlattenedTransformationGraph::numNodes() const  { return unsigned(_parentIndices.size()); }
+      inline unsigned FlattenedTransformationGraph::parentIndex(unsigned nodeIndex) const  { return _parentIndices[nodeIndex]; }
+      inline unsigned FlattenedTransformationGraph::localMatrixOffset64(unsigned nodeIndex) const  { return _localMatrixOffsets64[nodeIndex]; }
+      inline unsigned FlattenedTransformationGraph::outputOffset64(unsigned nodeIndex) const  { return _outputOffsets64[nodeIndex]; }
+      inline const MatrixGpuData& FlattenedTransformationGraph::worldMatrix(unsigned nodeIndex) const  { return _worldMatrices[nodeIndex]; }
+   }
+}
+
+#endif /* GE_RG_FLATTENED_TRANSFORMATION_GRAPH_H */
@@ -148,7 +148,7 @@ namespace ge
       template<typename T>
       inline T* FlexibleArrayList<T>::Iterator::operator->()  { return node; }
       template<typename T>
-      inline typename FlexibleArrayList<T>::Iterator& FlexibleArrayList<T>::Iterator::operator=(const Iterator &rhs)  { node=rhs.node; }
+      inline typename FlexibleArrayList<T>::Iterator& FlexibleArrayList<T>::Iterator::operator=(const Iterator &rhs)  { node=rhs.node; return *this; }
       template<typename T>
       inline bool FlexibleArrayList<T>::Iterator::operator==(typename FlexibleArrayList<T>::Iterator const &rhs) const  { return node==rhs.node; }
       template<typename T>
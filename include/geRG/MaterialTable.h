@@ -0,0 +1,100 @@
+#ifndef GE_RG_MATERIAL_TABLE_H
+#define GE_RG_MATERIAL_TABLE_H
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <geRG/Export.h>
+
+namespace ge
+{
+   namespace gl
+   {
+      class Buffer;
+      class Texture;
+   }
+   namespace rg
+   {
+
+      /** MaterialGpuData is a single item of MaterialTable as seen by the shaders.
+       *
+       *  Non-zero textureHandle is bindless texture handle (ARB_bindless_texture),
+       *  otherwise the layer of the texture array of MaterialTable is used.
+       *  Texturing mode has the meaning of colorTexturingMode uniform
+       *  (0 - no texturing, 1 - modulate, 2 - replace).
+       */
+      struct MaterialGpuData {
+         uint32_t textureHandle[2];
+         uint32_t layer;
+         uint32_t texturingMode;
+      };
+
+
+      /** MaterialTable holds textures of Drawables that share the same StateSet.
+       *
+       *  Without the table, each texture requires its own StateSet
+       *  (see StateSetDefaultGLState) and so its own multi-draw calls.
+       *  With the table set by RenderingContext::setMaterialTable(), each draw command
+       *  carries material index (see RenderingContext::setDrawableMaterial()),
+       *  the built-in programs fetch it by gl_BaseInstanceARB and sample the texture
+       *  of the material. Drawables that differ only by their textures
+       *  then share the StateSet (colorTexture is not given to their StateSetDefaultGLState)
+       *  and they are drawn by the same multi-draw call.
+       *
+       *  A material refers either to a bindless texture handle (requires ARB_bindless_texture)
+       *  or to a layer of the texture array given by setTextureArray().
+       *  The table is uploaded to the shader storage buffer on bind() if it was changed.
+       */
+      class GERG_EXPORT MaterialTable {
+      public:
+
+         enum TexturingMode : uint32_t { NO_TEXTURING=0, MODULATE=1, REPLACE=2 };
+
+      protected:
+
+         std::vector<MaterialGpuData> _materials;
+         std::vector<std::shared_ptr<ge::gl::Texture>> _textures;  ///< Textures of bindless materials, kept alive while their handles are resident.
+         std::shared_ptr<ge::gl::Texture> _textureArray;
+         std::shared_ptr<ge::gl::Buffer> _buffer;
+         bool _dirty = true;
+
+      public:
+
+         MaterialTable();
+         ~MaterialTable();
+
+         unsigned addMaterial(TexturingMode mode=NO_TEXTURING);
+         unsigned addTexture(const std::shared_ptr<ge::gl::Texture>& texture,TexturingMode mode=MODULATE);
+         unsigned addArrayLayer(unsigned layer,TexturingMode mode=MODULATE);
+         void setMaterial(unsigned index,const MaterialGpuData& data);
+         void clear();
+
+         inline unsigned size() const;
+         inline const MaterialGpuData& material(unsigned index) const;
+         inline const std::shared_ptr<ge::gl::Texture>& textureArray() const;
+         inline void setTextureArray(const std::shared_ptr<ge::gl::Texture>& texture);  ///< Sets GL_TEXTURE_2D_ARRAY texture whose layers are referred by addArrayLayer() materials.
+         inline const std::shared_ptr<ge::gl::Buffer>& buffer() const;
+
+         void bind(unsigned storageBinding,unsigned textureUnit);
+
+      };
+
+   }
+}
+
+
+
+// inline methods
+namespace ge
+{
+   namespace rg
+   {
+      inline unsigned MaterialTable::size() const  { return unsigned(_materials.size()); }
+      inline const MaterialGpuData& MaterialTable::material(unsigned index) const  { return _materials[index]; }
+      inline const std::shared_ptr<ge::gl::Texture>& MaterialTable::textureArray() const  { return _textureArray; }
+      inline void MaterialTable::setTextureArray(const std::shared_ptr<ge::gl::Texture>& texture)  { _textureArray=texture; }
+      inline const std::shared_ptr<ge::gl::Buffer>& MaterialTable::buffer() const  { return _buffer; }
+   }
+}
+
+#endif /* GE_RG_MATERIAL_TABLE_H */
@@ -40,6 +40,7 @@ namespace ge
          unsigned _numMatrices;       ///< Number of matrices. The value is kept in synchrony with ListControlGpuData::numItems. Its value can range from 0 to _capacity.
          bool     _restartFlag;       ///< Internal flip-flop flag used, for example, when evaluating number of matrices in the Transformation graph by RenderingContext::evaluateTransformationGraph() method.
          unsigned _startIndex;
+         unsigned _taskIndex;         ///< Index of the task that visited the MatrixList first during parallel evaluation of transformation graph by RenderingContext::evaluateTransformationGraph().
          //unsigned _arrayId;           ///< Allocation id of matrix array. The matrices are usually stored in RenderingContext::matrixStorage().
          //unsigned _capacity;          ///< Current capacity of MatrixList. Maximum number of matrices that can be stored in the MatrixList until it is reallocated.
          std::shared_ptr<MatrixList> _self;  ///< Reference to itself. It is used by _referenceCounter to prevent the object from deleting whenever there are references.
@@ -68,6 +69,9 @@ namespace ge
          inline bool restartFlag() const;
          inline void setRestartFlag(bool on);
 
+         inline unsigned taskIndex() const;
+         inline void setTaskIndex(unsigned value);
+
          //inline unsigned capacity() const;
          //inline void setCapacity(unsigned num);
 
@@ -107,6 +111,8 @@ namespace ge
       inline void MatrixList::setNumMatrices(unsigned num)  { _numMatrices=num; }
       inline bool MatrixList::restartFlag() const  { return _restartFlag; }
       inline void MatrixList::setRestartFlag(bool on)  { _restartFlag=on; }
+      inline unsigned MatrixList::taskIndex() const  { return _taskIndex; }
+      inline void MatrixList::setTaskIndex(unsigned value)  { _taskIndex=value; }
       //inline unsigned MatrixList::capacity() const  { return _capacity; }
       //inline void MatrixList::setCapacity(unsigned num)  { _capacity=num; }
       inline std::shared_ptr<MatrixList> MatrixList::create()  { return std::make_shared<MatrixList>(); }
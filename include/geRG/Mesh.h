@@ -64,19 +64,21 @@ namespace ge
 
          inline void uploadVertices(const void*const *attribList,unsigned attribListSize,
                                     unsigned numVertices,unsigned fromIndex=0);
+         inline void uploadEncodedVertices(const void*const *attribList,unsigned attribListSize,
+                                           unsigned numVertices,unsigned fromIndex=0);
          inline void uploadIndices(const void *indices,unsigned numIndices,unsigned fromIndex=0);
 
          inline void uploadPrimitives(const PrimitiveGpuData *bufferData,
-                                      unsigned numPrimitives,unsigned dstIndex=0);
+                                      unsigned numPrimitives,unsigned dstIndex=0);  ///< Uploads PrimitiveGpuData as they are, so indexed primitives have to hold absolute first index and vertexOffset (see updateVertexOffsets()).
          inline void setPrimitives(const Primitive *primitiveList,
                                    unsigned numPrimitives,unsigned startIndex=0,
                                    bool truncate=true);
          inline void setAndUploadPrimitives(PrimitiveGpuData *nonConstBufferData,
-                                            const Primitive *primitiveList,unsigned numPrimitives);
+                                            const Primitive *primitiveList,unsigned numPrimitives);  ///< Sets primitives and uploads PrimitiveGpuData. First index of indexed primitives is relative to the indices of the mesh, it is made absolute in the uploaded copy and nonConstBufferData is not modified.
          inline void setAndUploadPrimitives(PrimitiveGpuData *nonConstBufferData,
                                             const unsigned *modesAndOffsets4,unsigned numPrimitives);
          inline void updateVertexOffsets(void *primitiveBuffer,
-                                         const Primitive *primitiveList,unsigned numPrimitives);
+                                         const Primitive *primitiveList,unsigned numPrimitives);  ///< Sets vertexOffset and makes relative first index of indexed primitives absolute in primitiveBuffer. It must be called only once on the same data.
          inline static std::vector<Primitive> generatePrimitiveList(
                                          const unsigned *modesAndOffsets4,unsigned numPrimitives);
 
@@ -167,6 +169,11 @@ namespace ge
          if(_attribStorage)
             _attribStorage->uploadVertices(*this,attribList,attribListSize,numVertices,fromIndex);
       }
+      inline void Mesh::uploadEncodedVertices(const void*const* attribList,unsigned attribListSize,unsigned numVertices,unsigned fromIndex)
+      {
+         if(_attribStorage)
+            _attribStorage->uploadEncodedVertices(*this,attribList,attribListSize,numVertices,fromIndex);
+      }
       inline void Mesh::uploadIndices(const void *indices,unsigned numIndices,unsigned fromIndex)
       {
          if(_attribStorage)
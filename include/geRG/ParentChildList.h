@@ -224,6 +224,12 @@ namespace ge
 
       };
 
+      /** Called by the methods generated by GERG_CHILD_LIST after they change the child list.
+       *  Parent class may declare non-template overload for itself before the class
+       *  definition to be notified about the changes (see Transformation).
+       *  Direct modifications of childList() do not call it. */
+      template<typename T> inline void parentChildListChanged(T*)  {}
+
       template<typename T> struct ParentChildList_is_shared_ptr : std::false_type {};
       template<typename T> struct ParentChildList_is_shared_ptr<std::shared_ptr<T>> : std::true_type {};
 
@@ -264,7 +270,11 @@ namespace ge
             inline Child##_name_suffix_##List::iterator \
             addChild##_name_suffix_(Child##_name_suffix_##List::ChildParamT child, \
                                     Child##_name_suffix_##List::ParentParamT self) \
-            { return _child##_name_suffix_##List.push_back(child,self,child->_parent##_name_suffix_##List); } \
+            { \
+               auto r=_child##_name_suffix_##List.push_back(child,self,child->_parent##_name_suffix_##List); \
+               parentChildListChanged(this); \
+               return r; \
+            } \
          \
             /* addChild(child), addChild???(child) */ \
             inline Child##_name_suffix_##List::iterator \
@@ -277,8 +287,10 @@ namespace ge
                                        Child##_name_suffix_##List::ChildParamT child, \
                                        Child##_name_suffix_##List::ParentParamT self) \
             { \
-               return _child##_name_suffix_##List.insert(it, \
+               auto r=_child##_name_suffix_##List.insert(it, \
                      child,self,child->_parent##_name_suffix_##List); \
+               parentChildListChanged(this); \
+               return r; \
             } \
          \
             /* insertChild(iterator,child), insertChild???(iterator,child) */ \
@@ -291,13 +303,17 @@ namespace ge
             inline void replaceChild##_name_suffix_(Child##_name_suffix_##List::iterator it, \
                   Child##_name_suffix_##List::ChildParamT newChild) \
             { \
-               return _child##_name_suffix_##List.replace(it,newChild, \
+               _child##_name_suffix_##List.replace(it,newChild, \
                      (*it)->_parent##_name_suffix_##List,newChild->_parent##_name_suffix_##List); \
+               parentChildListChanged(this); \
             } \
          \
             /* removeChild(iterator), removeChild???(iterator) */ \
             inline void removeChild##_name_suffix_(Child##_name_suffix_##List::iterator it) \
-            { _child##_name_suffix_##List.erase(it,(*it)->_parent##_name_suffix_##List); } \
+            { \
+               _child##_name_suffix_##List.erase(it,(*it)->_parent##_name_suffix_##List); \
+               parentChildListChanged(this); \
+            } \
          \
             /* removeChild(child), removeChild???(child) */ \
             template<typename T> \
@@ -313,6 +329,7 @@ namespace ge
                   it->child->_parent##_name_suffix_##List.getInternalList().erase( \
                         it->parentListDeleteIterator); \
                } \
+               parentChildListChanged(this); \
             } \
          \
             /* numChildren(), num???() */ \
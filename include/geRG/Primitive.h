@@ -14,8 +14,8 @@ namespace ge
        */
       struct PrimitiveGpuData {
          unsigned countAndIndexedFlag; ///< Number of vertices of the primitive and indexing flag on the highest bit indicating whether glDrawArrays or glDrawElements should be used for rendering.
-         unsigned first;               ///< Index of the first vertex or first index of the primitive.
-         unsigned vertexOffset;        ///< Offset of the start of the allocated block of vertices or indices within AttribStorage. Thus, the real start index is first+vertexOffset. The value is computed and updated automatically.
+         unsigned first;               ///< Index of the first vertex or first index of the primitive. Data passed to Mesh::setAndUploadPrimitives() and Mesh::updateVertexOffsets() hold the first index relative to the indices of the mesh. The start of the allocated block of indices within AttribStorage is added to it, so the data in primitive storage hold absolute index. Mesh::uploadPrimitives() expects absolute index.
+         unsigned vertexOffset;        ///< Offset of the start of the allocated block of vertices within AttribStorage. The real start vertex of non-indexed primitive is first+vertexOffset, indexed primitives use it as base vertex. The value is computed and updated automatically.
 
          inline PrimitiveGpuData()  {}
          constexpr inline PrimitiveGpuData(unsigned countAndIndexedFlag,unsigned first);
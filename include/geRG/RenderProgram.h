@@ -0,0 +1,109 @@
+#ifndef GE_RG_RENDER_PROGRAM_H
+#define GE_RG_RENDER_PROGRAM_H
+
+#include <vector>
+#include <geRG/Export.h>
+#include <geRG/StateSet.h>
+
+namespace ge
+{
+   namespace core
+   {
+      class Command;
+   }
+   namespace rg
+   {
+      class AttribStorage;
+      class FlexibleUseProgram;
+
+
+      /** RenderProgram is StateSet tree compiled into flat array of operations.
+       *
+       *  StateSet::render() walks the tree recursively, calls virtual commands
+       *  and iterates AttribStorageData maps of all the StateSets each frame.
+       *  RenderProgram does the walk only in compile(). It produces
+       *  the same sequence of commands and indirect draw calls as StateSet::render(),
+       *  but StateSet::RenderCommand is expanded inline, FlexibleUseProgram commands
+       *  and AttribStorage (VAO) binds are tagged, so the redundant ones are removed,
+       *  and each AttribStorage is drawn by a single operation.
+       *  execute() is just a loop over the operations.
+       *
+       *  Generic commands (OpType::COMMAND) are expected to not change VAO binding
+       *  nor the active program, otherwise the removal of redundant operations
+       *  would skip binds that are needed. StateSet commands created by geRG
+       *  (uniforms, texture binds) satisfy it.
+       *
+       *  Sorting is disabled by default. When enabled, sibling StateSets drawing
+       *  from the same AttribStorage are moved right after the first sibling that draws
+       *  from it, so they share VAO binding. The order does not depend on memory
+       *  addresses, the relative order of the siblings is kept otherwise.
+       *  Sibling StateSets are expected to set all their state themselves
+       *  (as StateSetDefaultGLState does), because their order is changed.
+       *
+       *  The operations refer to commands and AttribStorageData of the StateSets,
+       *  so the program must be recompiled after the topology of the tree changes.
+       *  StateSet does it automatically using RenderingContext::stateSetTopologyVersion(),
+       *  see StateSet::render().
+       */
+      class GERG_EXPORT RenderProgram {
+      public:
+
+         enum class OpType : unsigned {
+            COMMAND,              ///< Generic ge::core::Command, usually uniform setting or texture binding. It must not change VAO binding nor the active program.
+            USE_PROGRAM,          ///< FlexibleUseProgram command.
+            BIND_ATTRIB_STORAGE,  ///< Binds VAO of AttribStorage.
+            DRAW,                 ///< Multi-draw-indirect calls of all RenderingCommandData of AttribStorageData.
+         };
+
+         struct Op {
+            OpType type;
+            union {
+               ge::core::Command *command;
+               FlexibleUseProgram *useProgram;
+               AttribStorage *attribStorage;
+               const StateSet::AttribStorageData *storageData;
+            };
+         };
+
+      protected:
+
+         std::vector<Op> _ops;
+         unsigned _version = 0;     ///< RenderingContext::stateSetTopologyVersion() of the compilation, zero if not compiled.
+         bool _sortingEnabled = false;
+
+         void compileStateSet(std::vector<Op>& ops,StateSet *stateSet) const;
+         void compileRenderCommand(std::vector<Op>& ops,StateSet *stateSet) const;
+         static void removeRedundantOps(std::vector<Op>& ops);
+
+      public:
+
+         void compile(StateSet *root,unsigned version=0);
+         void execute() const;
+         inline void clear();
+
+         inline const std::vector<Op>& ops() const;
+         inline unsigned version() const;
+         inline bool isSortingEnabled() const;
+         inline void setSortingEnabled(bool value);  ///< Enables grouping of sibling StateSets by the first AttribStorage they draw from. It is disabled by default and it takes effect at the next compile().
+
+      };
+
+   }
+}
+
+
+
+// inline methods
+namespace ge
+{
+   namespace rg
+   {
+      inline void RenderProgram::clear()  { _ops.clear(); _version=0; }
+      inline const std::vector<RenderProgram::Op>& RenderProgram::ops() const  { return _ops; }
+      inline unsigned RenderProgram::version() const  { return _version; }
+      inline bool RenderProgram::isSortingEnabled() const  { return _sortingEnabled; }
+      inline void RenderProgram::setSortingEnabled(bool value)  { _sortingEnabled=value; }
+   }
+}
+
+#endif /* GE_RG_RENDER_PROGRAM_H */
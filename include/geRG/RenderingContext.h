@@ -8,12 +8,17 @@
 #define GE_RG_RENDERING_CONTEXT_H
 
 #include <memory>
+#include <mutex>
+#include <glm/vec3.hpp>
 #include <geRG/Export.h>
 #include <geRG/AllocationManagers.h>
 #include <geRG/Basics.h>
 #include <geRG/BufferStorage.h>
+#include <geRG/Culling.h>
 #include <geRG/Drawable.h>
+#include <geRG/FlattenedTransformationGraph.h>
 #include <geRG/DrawCommand.h>
+#include <geRG/DrawCommandProcessor.h>
 #include <geRG/Primitive.h>
 #include <geRG/ProgressStamp.h>
 #include <geRG/StateSet.h>
@@ -23,14 +28,23 @@
 
 namespace ge
 {
+   namespace core
+   {
+      class ThreadPool;
+   }
    namespace gl
    {
       class Buffer;
+      class FrameProfiler;
       class Program;
+      class ProgramBinaryCache;
       class Texture;
+      class UploadBatcher;
    }
    namespace rg
    {
+      class MaterialTable;
+      class SceneRecorder;
       class Transformation;
 
 
@@ -63,6 +77,7 @@ namespace ge
 
          typedef AttribConfig::InstanceList AttribConfigInstances;
          typedef std::vector<std::shared_ptr<Transformation>> TransformationGraphList;
+         enum class DrawCommandProcessingBackend { GPU_COMPUTE, CPU };
          enum class MappedBufferAccess : uint8_t { READ=0x1, WRITE=0x2, READ_WRITE=0x3, NO_ACCESS=0x0 };
 
          ge::gl::Context gl;
@@ -77,6 +92,7 @@ namespace ge
          ItemAllocationManager _transformationAllocationManager;
          float *_cpuTransformationBuffer;
          std::shared_ptr<ge::gl::Buffer> _drawIndirectBuffer;
+         std::shared_ptr<ge::gl::Buffer> _drawCountBuffer; // number of draw indirect records of each StateSet item, used by indirect count rendering only
 
          AttribConfigInstances _attribConfigInstances;
          unsigned _numAttribStorages;
@@ -85,8 +101,40 @@ namespace ge
          TransformationGraphList _transformationGraphs;
          std::shared_ptr<MatrixList> _emptyMatrixList;
          bool _useARBShaderDrawParameters;
+         std::shared_ptr<ge::gl::ProgramBinaryCache> _programBinaryCache;
+         std::shared_ptr<ge::gl::FrameProfiler> _frameProfiler; // measures stages of frame(), null if profiling is disabled
+         std::shared_ptr<ge::gl::UploadBatcher> _uploadBatcher; // coalesces vertex and index uploads, null if uploads are immediate
          unsigned _defaultAttribStorageVertexCapacity = 1000*1024; // 1M vertices (for just float coordinates ~12MiB, including normals, color and texCoord, ~36MiB)
          unsigned _defaultAttribStorageIndexCapacity = 4000*1024; // 4M indices (~16MiB)
+         unsigned _vertexDataCompactionBudget = 0; // max number of bytes moved by AttribStorage compaction per frame, zero disables compaction
+         bool _incrementalTransformationGraphEvaluation = false; // recompute only changed subtrees of transformation graph
+         bool _transformationGraphValid = false; // matrix layout computed by the last full evaluation of transformation graph can be reused
+         bool _flattenedTransformationGraphEvaluation = false; // evaluate transformation graph using its flattened form
+         FlattenedTransformationGraph _flattenedTransformationGraph;
+         DrawCommandProcessingBackend _drawCommandProcessingBackend = DrawCommandProcessingBackend::GPU_COMPUTE;
+         DrawCommandProcessor _drawCommandProcessor;
+         bool _cullingEnabled = false;
+         bool _indirectCountEnabled = false; // culled draw commands are compacted and rendered by glMultiDraw*IndirectCountARB()
+         bool _renderProgramsEnabled = false; // StateSet::render() executes compiled RenderProgram instead of walking the tree
+         unsigned _stateSetTopologyVersion = 1; // incremented on each change of StateSet tree, RenderPrograms of older versions are recompiled
+         Culling _culling;
+         HiZBuffer _hiZBuffer; // used by CPU backend of draw command processing
+         std::shared_ptr<ge::gl::Texture> _hiZTexture; // used by GPU backend of draw command processing
+         std::vector<BoundingSphereGpuData> _drawCommandBounds; // indexed by draw command index
+         std::shared_ptr<ge::gl::Buffer> _drawCommandBoundsBuffer;
+         bool _drawCommandBoundsDirty = false;
+         std::shared_ptr<MaterialTable> _materialTable; // materials sampled by built-in programs, null if textures are bound by StateSets
+         std::vector<unsigned> _drawCommandMaterials; // material indices, indexed by draw command index
+         std::shared_ptr<ge::gl::Buffer> _drawCommandMaterialBuffer;
+         bool _drawCommandMaterialsDirty = false;
+         std::shared_ptr<ge::gl::Buffer> _instanceOffsetBuffer; // matrix offsets of draw commands written by processDrawCommands(), used with material table only
+         unsigned _frameRingSize = 0; // number of segments of persistently mapped storages, zero if persistent ring is not used
+         unsigned _frameRingIndex = 0; // segment used by the current frame
+         std::vector<GLsync> _frameFences; // fence of each segment, signaled when GPU finishes the frame that used the segment
+         std::shared_ptr<ge::core::ThreadPool> _threadPool; // threads used for parallel evaluation of transformation graph and processing of draw commands on CPU, null for single-threaded processing
+         std::vector<std::shared_ptr<SceneRecorder>> _submittedSceneRecorders; // recorders waiting for commitSceneRecorders(), guarded by _sceneRecorderMutex
+         size_t _sceneRecorderCommitBudget = 0; // max number of bytes of recorded data committed by commitSceneRecorders() per frame, zero means no limit
+         std::mutex _sceneRecorderMutex;
 
          unsigned _bufferPosition;
          ProgressStamp _progressStamp; ///< Monotonically increasing number wrapping on overflow.
@@ -131,6 +179,8 @@ namespace ge
          inline unsigned defaultAttribStorageIndexCapacity() const;
          inline void setDefaultAttribStorageVertexCapacity(unsigned capacity);
          inline void setDefaultAttribStorageIndexCapacity(unsigned capacity);
+         inline unsigned vertexDataCompactionBudget() const;
+         inline void setVertexDataCompactionBudget(unsigned numBytes);
 
          inline PrimitiveStorage* primitiveStorage() const;                   ///< Returns BufferStorage that contains primitive set data of this graphics context. Any modification to the buffer must be done carefully to not break internal data consistency.
          inline DrawCommandStorage* drawCommandStorage() const;               ///< Returns BufferStorage that contains draw commands. Any modification to the buffer must be done carefully to not break internal data consistency.
@@ -139,6 +189,7 @@ namespace ge
          inline StateSetStorage* stateSetStorage() const;                     ///< Returns BufferStorage that contains StateSet specific data.
 
          inline const std::shared_ptr<ge::gl::Buffer>& drawIndirectBuffer();  ///< Returns draw indirect buffer used for indirect rendering.
+         inline const std::shared_ptr<ge::gl::Buffer>& drawCountBuffer();  ///< Returns parameter buffer with number of draw indirect records of each StateSet item. The buffer is null until processDrawCommands() runs with indirect count enabled.
          inline float* cpuTransformationBuffer();
 
          void unmapBuffers();
@@ -170,6 +221,7 @@ namespace ge
                                             const unsigned *modesAndOffsets4,unsigned numPrimitives);
          static void updateVertexOffsets(Mesh &mesh,void *primitiveBuffer,
                                          const Primitive *primitiveList,unsigned numPrimitives);
+         void updateVertexOffsets(Mesh &mesh,int firstIndexShift=0);
          static std::vector<Primitive> generatePrimitiveList(
                                          const unsigned *modesAndOffsets4,unsigned numPrimitives);
 
@@ -183,14 +235,27 @@ namespace ge
                                            const unsigned primtiveCount,
                                            MatrixList *matrixList,StateSet *stateSet);
          virtual void deleteDrawable(Mesh &mesh,DrawableId id);
+         void submitSceneRecorder(const std::shared_ptr<SceneRecorder>& recorder);
+         virtual void commitSceneRecorders();
+         inline size_t sceneRecorderCommitBudget() const;
+         inline void setSceneRecorderCommitBudget(size_t numBytes);  ///< Sets the number of bytes of recorded data (SceneRecorder::arenaSize()) committed per frame by commitSceneRecorders(). At least one recorder is committed each frame, the others wait for the next frames. Zero (default) commits all submitted recorders.
 
          inline TransformationGraphList& transformationGraphs();
          inline const TransformationGraphList& transformationGraphs() const;
          virtual void addTransformationGraph(std::shared_ptr<Transformation>& transformation);
          virtual void removeTransformationGraph(std::shared_ptr<Transformation>& transformation);
+         inline bool incrementalTransformationGraphEvaluation() const;
+         inline void setIncrementalTransformationGraphEvaluation(bool value);
+         inline bool flattenedTransformationGraphEvaluation() const;
+         inline void setFlattenedTransformationGraphEvaluation(bool value);  ///< Enables evaluation of transformation graph using FlattenedTransformationGraph. The flattened graph is compiled by full evaluation and reused until invalidateTransformationGraph() is called. Incremental evaluation takes precedence if both are enabled.
+         inline const FlattenedTransformationGraph& flattenedTransformationGraph() const;
+         inline const std::shared_ptr<ge::core::ThreadPool>& threadPool() const;
+         inline void setThreadPool(const std::shared_ptr<ge::core::ThreadPool>& threadPool);  ///< Sets ThreadPool used for parallel evaluation of transformation graph and by CPU backend of processDrawCommands(). Null value (default) means single-threaded processing.
+         inline void invalidateTransformationGraph();  ///< Forces full evaluation of transformation graph in the next frame. Child list methods of Transformation call it automatically, it has to be called after other changes of structure of the graph, such as direct modification of Transformation::childList().
 
          virtual void cancelAllAllocations();
          virtual void handleContextLost();
+         virtual unsigned compactVertexData(unsigned maxBytes);
 
          inline unsigned bufferPosition() const;
          inline void setBufferPosition(unsigned pos);
@@ -201,9 +266,35 @@ namespace ge
          virtual void evaluateTransformationGraph();
          virtual void setupRendering();
          virtual void processDrawCommands();
+         inline DrawCommandProcessingBackend drawCommandProcessingBackend() const;
+         inline bool cullingEnabled() const;
+         inline void setCullingEnabled(bool value);  ///< Enables culling stage of processDrawCommands(). Draw commands whose instances are all outside of the frustum given by culling().setProjection() or occluded according to Hi-Z buffer get zero instance count.
+         inline bool indirectCountEnabled() const;
+         inline void setIndirectCountEnabled(bool value);  ///< Makes processDrawCommands() skip draw commands with zero instance count (culled ones) and count the written records of each StateSet in drawCountBuffer(). AttribStorage then renders by glMultiDraw*IndirectCountARB(), so culled draw commands are not submitted at all. Requires ARB_indirect_parameters.
+         inline bool renderProgramsEnabled() const;
+         inline void setRenderProgramsEnabled(bool value);  ///< Makes StateSet::render() compile the StateSet tree into RenderProgram once and execute the program each frame. The program is recompiled when stateSetTopologyVersion() changes.
+         inline unsigned stateSetTopologyVersion() const;
+         inline void invalidateStateSetTopology();  ///< Forces recompilation of RenderPrograms. StateSet calls it on changes of its commands, children and AttribStorageData, StateSetManager on creation of StateSets.
+         inline Culling& culling();                  ///< Returns culling parameters. Set the projection matrix used for rendering by Culling::setProjection().
+         inline HiZBuffer& hiZBuffer();              ///< Returns Hi-Z buffer used for occlusion culling by CPU backend. Empty buffer disables occlusion culling.
+         inline const std::shared_ptr<ge::gl::Texture>& hiZTexture() const;
+         inline void setHiZTexture(const std::shared_ptr<ge::gl::Texture>& texture);  ///< Sets Hi-Z texture used for occlusion culling by GPU backend. Its red channel of level l must contain maximal depth of the corresponding 2^l x 2^l texels of level 0. Null disables occlusion culling.
+         void setDrawableBounds(DrawableId id,const glm::vec3& center,float radius);  ///< Sets bounding sphere of all draw commands of the Drawable. The sphere is given in the space transformed by instancing matrices. Negative radius disables culling of the Drawable.
+         inline const std::vector<BoundingSphereGpuData>& drawCommandBounds() const;
+         inline const std::shared_ptr<MaterialTable>& materialTable() const;
+         void setMaterialTable(const std::shared_ptr<MaterialTable>& table);  ///< Sets table of materials sampled by the built-in programs. Material of each Drawable is given by setDrawableMaterial(), so Drawables differing only by textures can share StateSet. Requires ARB_shader_draw_parameters. Null (default) makes programs use colorTexture bound by StateSets.
+         void setDrawableMaterial(DrawableId id,unsigned material);  ///< Sets index to materialTable() used by all draw commands of the Drawable. Draw commands use material 0 until it is set.
+         inline const std::vector<unsigned>& drawCommandMaterials() const;
+         inline void setDrawCommandProcessingBackend(DrawCommandProcessingBackend value);  ///< Selects whether processDrawCommands() uses compute shader (default) or DrawCommandProcessor running on CPU. CPU backend might be useful on drivers with poor compute shader performance.
          virtual void fenceSyncGpuComputation();
          virtual void render();
          virtual void frame();
+         inline unsigned frameRingSize() const;
+         virtual void setFrameRingSize(unsigned numFrames);
+         inline unsigned frameRingIndex() const;
+         virtual void waitForFrameFences();
+         virtual void waitForFrameFence(unsigned index);
+         virtual void updateInstancingMatrixAttribs();
 
          inline std::shared_ptr<StateSet> getOrCreateStateSet(const StateSetManager::GLState* state);
          inline std::shared_ptr<StateSet> findStateSet(const StateSetManager::GLState* state);
@@ -217,7 +308,13 @@ namespace ge
          const std::shared_ptr<ge::gl::Program>& getAmbientUniformColorProgram() const;
          const std::shared_ptr<ge::gl::Program>& getPhongUniformColorProgram() const;
          enum class ProgramType { AMBIENT_PASS,LIGHT_PASS,AMBIENT_AND_LIGHT_PASS };
-         const std::shared_ptr<ge::gl::Program>& getProgram(ProgramType type,bool uniformColor) const;
+         const std::shared_ptr<ge::gl::Program>& getProgram(ProgramType type,bool uniformColor,bool octahedralNormals=false) const;
+         inline const std::shared_ptr<ge::gl::ProgramBinaryCache>& programBinaryCache() const;
+         inline void setProgramBinaryCache(const std::shared_ptr<ge::gl::ProgramBinaryCache>& cache);  ///< Sets on-disk cache used by createProgram() to skip shader compilation on warm start. Null value (default) disables the cache. Programs created before the call are not affected.
+         inline const std::shared_ptr<ge::gl::FrameProfiler>& frameProfiler() const;
+         inline void setFrameProfiler(const std::shared_ptr<ge::gl::FrameProfiler>& profiler);  ///< Sets profiler that measures CPU and GPU time of stages of frame() (each frame() is one profiler frame). Null value (default) disables profiling.
+         inline const std::shared_ptr<ge::gl::UploadBatcher>& uploadBatcher() const;
+         void setUploadBatcher(const std::shared_ptr<ge::gl::UploadBatcher>& batcher);  ///< Sets batcher that coalesces AttribStorage::uploadVertices() and uploadIndices() writes until frame(). Null value (default) uploads data immediately.
 
          std::shared_ptr<ge::gl::Texture> cachedTexture(const std::string& path) const;
          inline void addCacheTexture(const std::string &path,const std::shared_ptr<ge::gl::Texture>& texture);
@@ -247,11 +344,15 @@ namespace ge
          struct ProgramConfig {
             ProgramType type;
             bool uniformColor;
+            bool octahedralNormals;
             bool operator<(const ProgramConfig& rhs) const;
          };
          mutable std::map<ProgramConfig,std::shared_ptr<ge::gl::Program>> _programCache;
          static std::shared_ptr<ge::gl::Program> createProgram(ProgramType type,bool uniformColor,
-                                                               bool useARBShaderDrawParameters=false);
+                                                               bool octahedralNormals=false,
+                                                               bool useARBShaderDrawParameters=false,
+                                                               bool materialTable=false,
+                                                               const std::shared_ptr<ge::gl::ProgramBinaryCache>& programBinaryCache=nullptr);
 
       };
 
@@ -283,17 +384,27 @@ namespace ge
       inline AttribConfig RenderingContext::getAttribConfig(const std::vector<AttribType>& attribTypes,bool ebo,AttribConfigId id)
       { return getAttribConfig(AttribConfig::Configuration(attribTypes,ebo,id)); }
       inline bool RenderingContext::getUseARBShaderDrawParameters() const  { return _useARBShaderDrawParameters; }
+      inline const std::shared_ptr<ge::gl::ProgramBinaryCache>& RenderingContext::programBinaryCache() const  { return _programBinaryCache; }
+      inline void RenderingContext::setProgramBinaryCache(const std::shared_ptr<ge::gl::ProgramBinaryCache>& cache)  { _programBinaryCache=cache; }
+      inline const std::shared_ptr<ge::gl::FrameProfiler>& RenderingContext::frameProfiler() const  { return _frameProfiler; }
+      inline void RenderingContext::setFrameProfiler(const std::shared_ptr<ge::gl::FrameProfiler>& profiler)  { _frameProfiler=profiler; }
+      inline const std::shared_ptr<ge::gl::UploadBatcher>& RenderingContext::uploadBatcher() const  { return _uploadBatcher; }
       inline unsigned RenderingContext::numAttribStorages() const  { return _numAttribStorages; }
       inline unsigned RenderingContext::defaultAttribStorageVertexCapacity() const  { return _defaultAttribStorageVertexCapacity; }
       inline unsigned RenderingContext::defaultAttribStorageIndexCapacity() const  { return _defaultAttribStorageIndexCapacity; }
       inline void RenderingContext::setDefaultAttribStorageVertexCapacity(unsigned capacity)  { _defaultAttribStorageVertexCapacity=capacity; }
       inline void RenderingContext::setDefaultAttribStorageIndexCapacity(unsigned capacity)  { _defaultAttribStorageIndexCapacity=capacity; }
+      inline unsigned RenderingContext::vertexDataCompactionBudget() const  { return _vertexDataCompactionBudget; }
+      inline void RenderingContext::setVertexDataCompactionBudget(unsigned numBytes)  { _vertexDataCompactionBudget=numBytes; }
+      inline size_t RenderingContext::sceneRecorderCommitBudget() const  { return _sceneRecorderCommitBudget; }
+      inline void RenderingContext::setSceneRecorderCommitBudget(size_t numBytes)  { _sceneRecorderCommitBudget=numBytes; }
       inline PrimitiveStorage* RenderingContext::primitiveStorage() const  { return &_primitiveStorage; }
       inline DrawCommandStorage* RenderingContext::drawCommandStorage() const  { return &_drawCommandStorage; }
       inline MatrixStorage* RenderingContext::matrixStorage() const  { return &_matrixStorage; }
       inline ListControlStorage* RenderingContext::matrixListControlStorage() const  { return &_matrixListControlStorage; }
       inline StateSetStorage* RenderingContext::stateSetStorage() const  { return &_stateSetStorage; }
       inline const std::shared_ptr<ge::gl::Buffer>& RenderingContext::drawIndirectBuffer()  { return _drawIndirectBuffer; }
+      inline const std::shared_ptr<ge::gl::Buffer>& RenderingContext::drawCountBuffer()  { return _drawCountBuffer; }
       inline float* RenderingContext::cpuTransformationBuffer()  { return _cpuTransformationBuffer; }
       inline unsigned* RenderingContext::transformationAllocation(unsigned id) const  { return _transformationAllocationManager[id]; }
       inline ItemAllocationManager& RenderingContext::transformationAllocationManager()  { return _transformationAllocationManager; }
@@ -304,6 +415,33 @@ namespace ge
       inline void RenderingContext::clearPrimitives(Mesh &mesh)  { setNumPrimitives(mesh,0); }
       inline DrawableId RenderingContext::createDrawable(Mesh &mesh,MatrixList *matrixList,StateSet *stateSet)
       { return createDrawable(mesh,nullptr,0,matrixList,stateSet); }
+      inline bool RenderingContext::incrementalTransformationGraphEvaluation() const  { return _incrementalTransformationGraphEvaluation; }
+      inline void RenderingContext::setIncrementalTransformationGraphEvaluation(bool value)  { _incrementalTransformationGraphEvaluation=value; _transformationGraphValid=false; }
+      inline bool RenderingContext::flattenedTransformationGraphEvaluation() const  { return _flattenedTransformationGraphEvaluation; }
+      inline void RenderingContext::setFlattenedTransformationGraphEvaluation(bool value)  { _flattenedTransformationGraphEvaluation=value; _transformationGraphValid=false; }
+      inline const FlattenedTransformationGraph& RenderingContext::flattenedTransformationGraph() const  { return _flattenedTransformationGraph; }
+      inline RenderingContext::DrawCommandProcessingBackend RenderingContext::drawCommandProcessingBackend() const  { return _drawCommandProcessingBackend; }
+      inline void RenderingContext::setDrawCommandProcessingBackend(DrawCommandProcessingBackend value)  { _drawCommandProcessingBackend=value; }
+      inline bool RenderingContext::cullingEnabled() const  { return _cullingEnabled; }
+      inline void RenderingContext::setCullingEnabled(bool value)  { _cullingEnabled=value; }
+      inline bool RenderingContext::indirectCountEnabled() const  { return _indirectCountEnabled; }
+      inline void RenderingContext::setIndirectCountEnabled(bool value)  { _indirectCountEnabled=value; }
+      inline bool RenderingContext::renderProgramsEnabled() const  { return _renderProgramsEnabled; }
+      inline void RenderingContext::setRenderProgramsEnabled(bool value)  { _renderProgramsEnabled=value; }
+      inline unsigned RenderingContext::stateSetTopologyVersion() const  { return _stateSetTopologyVersion; }
+      inline void RenderingContext::invalidateStateSetTopology()  { if(++_stateSetTopologyVersion==0) _stateSetTopologyVersion=1; }
+      inline Culling& RenderingContext::culling()  { return _culling; }
+      inline HiZBuffer& RenderingContext::hiZBuffer()  { return _hiZBuffer; }
+      inline const std::shared_ptr<ge::gl::Texture>& RenderingContext::hiZTexture() const  { return _hiZTexture; }
+      inline void RenderingContext::setHiZTexture(const std::shared_ptr<ge::gl::Texture>& texture)  { _hiZTexture=texture; }
+      inline const std::vector<BoundingSphereGpuData>& RenderingContext::drawCommandBounds() const  { return _drawCommandBounds; }
+      inline const std::shared_ptr<MaterialTable>& RenderingContext::materialTable() const  { return _materialTable; }
+      inline const std::vector<unsigned>& RenderingContext::drawCommandMaterials() const  { return _drawCommandMaterials; }
+      inline const std::shared_ptr<ge::core::ThreadPool>& RenderingContext::threadPool() const  { return _threadPool; }
+      inline void RenderingContext::setThreadPool(const std::shared_ptr<ge::core::ThreadPool>& threadPool)  { _threadPool=threadPool; }
+      inline unsigned RenderingContext::frameRingSize() const  { return _frameRingSize; }
+      inline unsigned RenderingContext::frameRingIndex() const  { return _frameRingIndex; }
+      inline void RenderingContext::invalidateTransformationGraph()  { _transformationGraphValid=false; }
       inline RenderingContext::TransformationGraphList& RenderingContext::transformationGraphs()  { return _transformationGraphs; }
       inline const RenderingContext::TransformationGraphList& RenderingContext::transformationGraphs() const  { return _transformationGraphs; }
       inline unsigned RenderingContext::bufferPosition() const  { return _bufferPosition; }
@@ -0,0 +1,157 @@
+#ifndef GE_RG_SCENE_RECORDER_H
+#define GE_RG_SCENE_RECORDER_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <glm/vec3.hpp>
+#include <geRG/Export.h>
+#include <geRG/AttribConfig.h>
+#include <geRG/Drawable.h>
+#include <geRG/Primitive.h>
+#include <geRG/StateSetManager.h>
+
+namespace ge
+{
+   namespace rg
+   {
+      class MatrixList;
+      class Mesh;
+      class RenderingContext;
+      class StateSet;
+
+
+      /** SceneRecorder records construction of meshes, StateSets and Drawables
+       *  on a worker thread and replays it on the rendering thread.
+       *
+       *  Methods of RenderingContext that build the scene modify shared allocators
+       *  and maps without synchronization, so they may be called
+       *  from the rendering thread only. SceneRecorder methods that record the scene
+       *  do not touch RenderingContext (nor RenderingContext::current()) at all.
+       *  Vertex, index and primitive data are copied into the local arena
+       *  of the recorder, so the caller may release its buffers immediately.
+       *  Compressed attributes are encoded by the recording thread as well.
+       *  Each recorder is expected to be used by a single thread.
+       *
+       *  Finished recorder is given to RenderingContext::submitSceneRecorder(),
+       *  that may be called from any thread. All the submitted recorders are merged
+       *  by RenderingContext::commitSceneRecorders() at the beginning of the next frame().
+       *  After committed() returns true, drawableId() and stateSet() give the created objects.
+       *
+       *  Meshes given to addMesh() and MatrixLists given to addDrawable() must stay alive
+       *  until the recorder is committed. MatrixLists have to be created on the rendering
+       *  thread in advance (for example by Transformation::getOrCreateMatrixList()).
+       *  GLStates given to addStateSet() may be created by StateSetManager::createGLState()
+       *  on any thread as it does not modify StateSetManager. StateSets created by the commit
+       *  are referenced by the recorder, keep the recorder (or the StateSets
+       *  returned by stateSet()) alive as long as their Drawables exist.
+       */
+      class GERG_EXPORT SceneRecorder {
+      public:
+
+         typedef unsigned MeshHandle;      ///< Index of the mesh in the order of addMesh() calls.
+         typedef unsigned StateSetHandle;  ///< Index of the StateSet in the order of addStateSet() calls.
+         typedef unsigned DrawableHandle;  ///< Index of the Drawable in the order of addDrawable() calls.
+
+      protected:
+
+         struct MeshRecord {
+            Mesh *mesh;
+            AttribConfig::Configuration config;
+            unsigned numVertices;
+            unsigned numIndices;
+            unsigned numPrimitives;
+            size_t verticesOffset;    // arena offset of the first attribute, the others follow
+            size_t indicesOffset;
+            size_t primitivesOffset;  // arena offset of PrimitiveGpuData
+            size_t modesOffset;       // arena offset of modesAndOffsets4 (aligned, so it need not follow primitives directly)
+         };
+         struct StateSetRecord {
+            std::unique_ptr<StateSetManager::GLState> glState;  // null if stateSet was given
+            std::shared_ptr<StateSet> stateSet;
+         };
+         struct DrawableRecord {
+            MeshHandle mesh;
+            MatrixList *matrixList;
+            StateSetHandle stateSet;
+            unsigned primitiveCount;  // zero means all primitives of the mesh
+            size_t primitiveIndicesOffset;
+            glm::vec3 boundsCenter;
+            float boundsRadius;       // negative radius means no bounds
+            unsigned material;
+            DrawableId id;            // DrawableId(nullptr) until the Drawable is created
+         };
+
+         std::vector<uint8_t> _arena;
+         std::vector<MeshRecord> _meshes;
+         std::vector<StateSetRecord> _stateSets;
+         std::vector<DrawableRecord> _drawables;
+         std::atomic<bool> _committed;
+
+         size_t copyToArena(const void *data,size_t size);
+         size_t allocInArena(size_t size);
+
+      public:
+
+         SceneRecorder();
+         ~SceneRecorder();
+
+         SceneRecorder(const SceneRecorder&) = delete;
+         SceneRecorder& operator=(const SceneRecorder&) = delete;
+
+         MeshHandle addMesh(Mesh *mesh,const AttribConfig::Configuration& config,
+                            const void*const *attribList,unsigned numVertices,
+                            const void *indices,unsigned numIndices,
+                            const PrimitiveGpuData *primitives,const unsigned *modesAndOffsets4,
+                            unsigned numPrimitives);
+         StateSetHandle addStateSet(StateSetManager::GLState *glState);
+         StateSetHandle addStateSet(const std::shared_ptr<StateSet>& stateSet);
+         inline DrawableHandle addDrawable(MeshHandle mesh,MatrixList *matrixList,StateSetHandle stateSet);
+         DrawableHandle addDrawable(MeshHandle mesh,const unsigned *primitiveIndices,
+                                    unsigned primitiveCount,MatrixList *matrixList,
+                                    StateSetHandle stateSet);
+         inline void setDrawableBounds(DrawableHandle drawable,const glm::vec3& center,float radius);  ///< Records RenderingContext::setDrawableBounds() of the Drawable.
+         inline void setDrawableMaterial(DrawableHandle drawable,unsigned material);  ///< Records RenderingContext::setDrawableMaterial() of the Drawable.
+
+         inline unsigned numMeshes() const;
+         inline unsigned numStateSets() const;
+         inline unsigned numDrawables() const;
+         inline size_t arenaSize() const;
+         inline bool empty() const;
+
+         void commit(RenderingContext *rc);
+         inline bool committed() const;
+         inline DrawableId drawableId(DrawableHandle drawable) const;  ///< Returns DrawableId created by the commit. Valid only when committed() returns true, DrawableId(nullptr) means the Drawable could not be created.
+         inline const std::shared_ptr<StateSet>& stateSet(StateSetHandle stateSet) const;  ///< Returns StateSet used by the commit. Valid only when committed() returns true.
+         void clear();
+
+      };
+
+   }
+}
+
+
+
+// inline methods
+namespace ge
+{
+   namespace rg
+   {
+      inline SceneRecorder::DrawableHandle SceneRecorder::addDrawable(MeshHandle mesh,MatrixList *matrixList,StateSetHandle stateSet)
+      { return addDrawable(mesh,nullptr,0,matrixList,stateSet); }
+      inline void SceneRecorder::setDrawableBounds(DrawableHandle drawable,const glm::vec3& center,float radius)
+      { _drawables[drawable].boundsCenter=center; _drawables[drawable].boundsRadius=radius; }
+      inline void SceneRecorder::setDrawableMaterial(DrawableHandle drawable,unsigned material)  { _drawables[drawable].material=material; }
+      inline unsigned SceneRecorder::numMeshes() const  { return unsigned(_meshes.size()); }
+      inline unsigned SceneRecorder::numStateSets() const  { return unsigned(_stateSets.size()); }
+      inline unsigned SceneRecorder::numDrawables() const  { return unsigned(_drawables.size()); }
+      inline size_t SceneRecorder::arenaSize() const  { return _arena.size(); }
+      inline bool SceneRecorder::empty() const  { return _meshes.empty() && _stateSets.empty() && _drawables.empty(); }
+      inline bool SceneRecorder::committed() const  { return _committed.load(std::memory_order_acquire); }
+      inline DrawableId SceneRecorder::drawableId(DrawableHandle drawable) const  { return _drawables[drawable].id; }
+      inline const std::shared_ptr<StateSet>& SceneRecorder::stateSet(StateSetHandle stateSet) const  { return _stateSets[stateSet].stateSet; }
+   }
+}
+
+#endif /* GE_RG_SCENE_RECORDER_H */
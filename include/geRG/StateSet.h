@@ -16,6 +16,10 @@ namespace ge
    namespace rg
    {
       class AttribStorage;
+      class RenderProgram;
+      class StateSet;
+
+      GERG_EXPORT void parentChildListChanged(StateSet *s);  ///< Invalidates RenderPrograms of the current RenderingContext after a change of the child list of StateSet.
 
 
       struct StateSetGpuData {
@@ -84,10 +88,12 @@ namespace ge
 
          std::map<AttribStorage*,AttribStorageData> _attribStorageData;
          CommandList _commandList;
+         std::shared_ptr<RenderProgram> _renderProgram;  ///< Compiled render(), used when RenderingContext::renderProgramsEnabled() is set.
 
       public:
 
          inline StateSet();
+         ~StateSet();
 
          inline AttribStorageData* getAttribStorageData(const AttribStorage *storage) const;
          inline std::map<AttribStorage*,AttribStorageData>::iterator getOrCreateAttribStorageData(AttribStorage *storage);
@@ -112,6 +118,8 @@ namespace ge
 
          void setupRendering();
          void render();
+         static void invalidateRenderPrograms();
+         inline const std::shared_ptr<RenderProgram>& renderProgram() const;
 
          inline unsigned addCommand(const std::shared_ptr<ge::core::Command>& command);
          inline unsigned addRenderCommand();
@@ -178,11 +186,12 @@ namespace ge
       inline void StateSet::incrementDrawCommandModeCounter(unsigned incrementAmount,unsigned mode,AttribStorage *storage)
       { if(incrementAmount!=0) incrementDrawCommandModeCounter(incrementAmount,mode,getOrCreateAttribStorageData(storage)->second); }
 
-      inline unsigned StateSet::addCommand(const std::shared_ptr<ge::core::Command>& command)  { unsigned r=unsigned(_commandList.size()); _commandList.push_back(command); return r; }
+      inline const std::shared_ptr<RenderProgram>& StateSet::renderProgram() const  { return _renderProgram; }
+      inline unsigned StateSet::addCommand(const std::shared_ptr<ge::core::Command>& command)  { unsigned r=unsigned(_commandList.size()); _commandList.push_back(command); invalidateRenderPrograms(); return r; }
       inline unsigned StateSet::addRenderCommand()  { return addCommand(RenderCommand::create(this)); }
-      inline unsigned StateSet::insertCommand(unsigned index,const std::shared_ptr<ge::core::Command>& command)  { return unsigned(std::distance(_commandList.emplace(_commandList.begin()+index,command),_commandList.begin())); }
-      inline void StateSet::removeCommand(unsigned index)  { _commandList.erase(_commandList.begin()+index); }
-      inline void StateSet::clearCommands()  { _commandList.clear(); }
+      inline unsigned StateSet::insertCommand(unsigned index,const std::shared_ptr<ge::core::Command>& command)  { invalidateRenderPrograms(); return unsigned(std::distance(_commandList.emplace(_commandList.begin()+index,command),_commandList.begin())); }
+      inline void StateSet::removeCommand(unsigned index)  { _commandList.erase(_commandList.begin()+index); invalidateRenderPrograms(); }
+      inline void StateSet::clearCommands()  { _commandList.clear(); invalidateRenderPrograms(); }
       inline const StateSet::CommandList& StateSet::commandList() const  { return _commandList; }
       inline StateSet::CommandList& StateSet::commandList()  { return _commandList; }
 
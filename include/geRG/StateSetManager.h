@@ -189,6 +189,7 @@ namespace ge
             r=std::make_shared<StateSet>();
             w=r;
             state->init(r,this);
+            StateSet::invalidateRenderPrograms();
          }
          return r;
       }
@@ -12,6 +12,9 @@ namespace ge
    namespace rg
    {
       class MatrixList;
+      class Transformation;
+
+      GERG_EXPORT void parentChildListChanged(Transformation *t);  ///< Invalidates transformation graph of the current RenderingContext after a change of the child list of Transformation.
 
 
       /** Transformation class maintains 4x4 matrix transformation.
@@ -23,6 +26,13 @@ namespace ge
        *
        *  Transformation objects are organized in a graph structure,
        *  allowing for hierarchical transformations.
+       *
+       *  Each Transformation tracks whether its matrix was changed since the last
+       *  evaluation of the transformation graph (see setDirty()). The flag
+       *  is propagated to all parents, so RenderingContext can recompute
+       *  only the changed subtrees (see RenderingContext::setIncrementalTransformationGraphEvaluation()).
+       *  Changes of the structure of the graph made by child list methods
+       *  (addChild(), removeChild(), etc.) invalidate the transformation graph automatically.
        */
       class GERG_EXPORT Transformation : public std::enable_shared_from_this<Transformation> {
       public:
@@ -55,9 +65,21 @@ namespace ge
          unsigned *_gpuDataOffsetPtr;  ///< Points either to _gpuDataOffset64 member or to externally allocated SharedDataOffset::_gpuDataOffset64.
          unsigned _gpuDataOffset64;    ///< Index (or offset multiplied by 64) to the matrix buffer where the transformation matrix is stored. Zero value is reserved for non-allocated matrix.
          std::shared_ptr<MatrixList> _matrixList;  ///< MatrixList, if attached, will receive the transformation computed by multiplication of all parent Transformations.
+         unsigned _matrixOffset64;     ///< Index (or offset multiplied by 64) to RenderingContext::matrixStorage() where the computed transformation was written by the last evaluation of transformation graph. Zero if not written.
+         unsigned _dirtyFlags;         ///< Combination of DirtyFlags values.
+
+         void setSubtreeDirtyOnParents();
 
       public:
 
+         enum DirtyFlags { MATRIX_DIRTY=0x1, SUBTREE_DIRTY=0x2 };
+         void setDirty();                          ///< Marks the transformation matrix as changed, so the matrices of the whole subtree will be recomputed by the next evaluation of transformation graph. It is called by uploadMatrix() automatically. Call it after modifying the matrix through getMatrixPtr().
+         inline bool isDirty() const;              ///< Returns true if the matrix was changed since the last evaluation of transformation graph.
+         inline bool isSubtreeDirty() const;       ///< Returns true if a matrix of any child Transformation was changed since the last evaluation of transformation graph.
+         inline void clearDirtyFlags();            ///< Clears dirty flags. It is called by RenderingContext during evaluation of transformation graph.
+         inline unsigned matrixOffset64() const;   ///< Returns index (or offset multiplied by 64) to RenderingContext::matrixStorage() where the computed transformation was written by the last evaluation of transformation graph.
+         inline void setMatrixOffset64(unsigned offset64);
+
          void uploadMatrix(const float *matrix);  ///< Uploads transformation matrix. The parameter matrix must point to array of 16 floats. The uploaded matrix is generally stored in GPU buffers, but it depends on implementation.
          inline void uploadMatrix(const glm::mat4& matrix);    ///< Uploads transformation matrix. The matrix is generally stored in GPU buffers, but it depends on implementation.
          void downloadMatrix(float *matrix);      ///< Downloads transformation matrix. The memory pointed by parameter matrix will receive 16 floats. The matrix is generally stored in GPU buffers, but it depends on implementation.
@@ -70,7 +92,7 @@ namespace ge
 
          inline const std::shared_ptr<MatrixList>& getOrCreateMatrixList() const;  ///< Returns MatrixList. If no MatrixList is attached, one is created and before return.
          inline const std::shared_ptr<MatrixList>& matrixList() const;             ///< Returns MatrixList. It returns empty shared_ptr if no MatrixList was created or assigned yet.
-         inline void setMatrixList(std::shared_ptr<MatrixList>& matrixList);       ///< Sets MatrixList.
+         void setMatrixList(std::shared_ptr<MatrixList>& matrixList);              ///< Sets MatrixList.
 
          enum ConstructionFlags { SHARE_MATRIX=0x1, SHARE_MATRIX_LIST=0x2,
                                   COPY_CHILDREN=0x4, SHARE_AND_COPY_ALL=0x7 };
@@ -93,9 +115,19 @@ namespace ge
       inline void Transformation::downloadMatrix(glm::mat4& matrix)  { downloadMatrix(glm::value_ptr(matrix)); }
       inline unsigned Transformation::gpuDataOffset64() const  { return *_gpuDataOffsetPtr; }
       inline const std::shared_ptr<MatrixList>& Transformation::getOrCreateMatrixList() const
-      { if(_matrixList==nullptr) const_cast<Transformation*>(this)->_matrixList=std::make_shared<MatrixList>(); return _matrixList; }
+      {
+         if(_matrixList==nullptr) {
+            const_cast<Transformation*>(this)->_matrixList=std::make_shared<MatrixList>();
+            RenderingContext::current()->invalidateTransformationGraph();
+         }
+         return _matrixList;
+      }
       inline const std::shared_ptr<MatrixList>& Transformation::matrixList() const  { return _matrixList; }
-      inline void Transformation::setMatrixList(std::shared_ptr<MatrixList>& matrixList)  { _matrixList=matrixList; }
+      inline bool Transformation::isDirty() const  { return (_dirtyFlags&MATRIX_DIRTY)!=0; }
+      inline bool Transformation::isSubtreeDirty() const  { return (_dirtyFlags&SUBTREE_DIRTY)!=0; }
+      inline void Transformation::clearDirtyFlags()  { _dirtyFlags=0; }
+      inline unsigned Transformation::matrixOffset64() const  { return _matrixOffset64; }
+      inline void Transformation::setMatrixOffset64(unsigned offset64)  { _matrixOffset64=offset64; }
       inline std::shared_ptr<Transformation> Transformation::shareFrom(const Transformation& t)
       { return std::make_shared<Transformation>(t,Transformation::SHARE_MATRIX); }
    }
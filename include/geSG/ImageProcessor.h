@@ -0,0 +1,72 @@
+#pragma once
+
+#include <geSG/Export.h>
+#include <geSG/Image.h>
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace ge
+{
+   namespace core
+   {
+      class ThreadPool;
+   }
+
+   namespace sg
+   {
+      /**
+       * CPU processing of textures before upload: mip-chain generation and block compression.
+       *
+       * Images are converted to RGBA8, mip levels are filtered by box or Kaiser filter
+       * (SSE when available) and levels can be compressed into 4x4 blocks of BC1, BC3 or BC7 format.
+       * Work is split into tiles (bands of rows, rows of blocks) that are executed on ThreadPool
+       * if one is given, so the results can be precomputed offline or in loading threads and
+       * uploaded as compressed textures (GL_COMPRESSED_RGBA_S3TC_DXT1_EXT, ..._DXT5_EXT,
+       * GL_COMPRESSED_RGBA_BPTC_UNORM).
+       */
+      class GESG_EXPORT ImageProcessor
+      {
+      public:
+
+         enum class Filter { BOX, KAISER };
+         enum class BlockFormat { BC1, BC3, BC7 };
+
+         /**
+          * One level of texture. Uncompressed levels are tightly packed RGBA8,
+          * compressed levels are rows of 4x4 blocks.
+          */
+         struct Level
+         {
+            size_t width = 0;
+            size_t height = 0;
+            std::vector<unsigned char> data;
+         };
+
+         ImageProcessor(const std::shared_ptr<ge::core::ThreadPool>& threadPool = nullptr);
+
+         static bool toRGBA8(Image& image, Level& level);
+         std::vector<Level> generateMipmaps(Image& image, Filter filter = Filter::BOX) const;
+         std::vector<Level> generateMipmaps(const Level& level, Filter filter = Filter::BOX) const;
+         Level downsample(const Level& level, Filter filter = Filter::BOX) const;
+         Level compress(const Level& level, BlockFormat format) const;
+         std::vector<Level> compress(const std::vector<Level>& levels, BlockFormat format) const;
+         Level decompress(const Level& level, BlockFormat format) const;
+
+         static size_t getBlockSize(BlockFormat format);
+         static size_t getCompressedSize(size_t width, size_t height, BlockFormat format);
+
+         inline const std::shared_ptr<ge::core::ThreadPool>& getThreadPool() const { return _threadPool; }
+         inline void setThreadPool(const std::shared_ptr<ge::core::ThreadPool>& threadPool) { _threadPool = threadPool; }
+
+      protected:
+
+         static const size_t tileRows = 16; ///< rows of pixels processed by one task
+
+         void parallelFor(size_t numTasks, const std::function<void(size_t)>& task) const;
+
+         std::shared_ptr<ge::core::ThreadPool> _threadPool;
+      };
+   }
+}
@@ -98,6 +98,36 @@ os.system(
 "./"+subscriptsDir+"generateTrapImplementation.py >"+
 outputDir+"TrapImplementation.h")
 
+os.system(
+"cat "+allFormatedFunctions+" |"+
+"./"+subscriptsDir+"generateProfilingCalls.py >"+
+outputDir+"ProfilingCalls.h")
+
+os.system(
+"cat "+allFormatedFunctions+" |"+
+"./"+subscriptsDir+"generateProfilingImplementation.py >"+
+outputDir+"ProfilingImplementation.h")
+
+os.system(
+"cat "+allFormatedFunctions+" |"+
+"./"+subscriptsDir+"generateRecordingCalls.py >"+
+outputDir+"RecordingCalls.h")
+
+os.system(
+"cat "+allFormatedFunctions+" |"+
+"./"+subscriptsDir+"generateRecordingImplementation.py >"+
+outputDir+"RecordingImplementation.h")
+
+os.system(
+"cat "+allFormatedFunctions+" |"+
+"./"+subscriptsDir+"generateReplayImplementation.py >"+
+outputDir+"ReplayImplementation.h")
+
+os.system(
+"cat "+allFormatedFunctions+" |"+
+"./"+subscriptsDir+"generateNullImplementation.py >"+
+outputDir+"NullImplementation.h")
+
 os.system(
 "./"+subscriptsDir+"printHEADER.py "+glHeader+" "+glextHeader+" |"+
 "./"+subscriptsDir+"extractConstants.py |"+
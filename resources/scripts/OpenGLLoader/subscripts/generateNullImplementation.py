@@ -0,0 +1,46 @@
+#!/usr/bin/python
+
+import sys
+import re
+import os
+
+import fileinput
+from subprocess import Popen, PIPE
+
+data0=""
+for line in fileinput.input():
+    data0+=line
+
+data0=data0.split("\n")[:-1]
+
+def getBody(type):
+    if type == "void" or type == "GLvoid":
+        return "{}"
+    return "{return ("+type+")0;}"
+
+def getTypes(params):
+    types = []
+    i = 2
+    while i<len(params):
+        if re.search("\[.*\]",params[i+1]):
+            types.append(params[i]+"*")
+        else:
+            types.append(params[i])
+        i+=2
+    return types
+
+def printNullImplementation(data):
+    params = data.split(",")
+    print "static "+params[0]+" null_"+params[1]+"("+",".join(getTypes(params))+")"+getBody(params[0])
+
+def printNullFunction(data):
+    params = data.split(",")
+    print "  {\""+params[1]+"\",reinterpret_cast<FUNCTION_POINTER>(null_"+params[1]+")},"
+
+for x in data0:
+    printNullImplementation(x)
+
+print "std::pair<char const*,FUNCTION_POINTER> const nullFunctions[] = {"
+for x in data0:
+    printNullFunction(x)
+print "};"
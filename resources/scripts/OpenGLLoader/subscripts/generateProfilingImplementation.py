@@ -0,0 +1,45 @@
+#!/usr/bin/python
+
+import sys
+import re
+import os
+
+import fileinput
+from subprocess import Popen, PIPE
+
+data0=""
+for line in fileinput.input():
+    data0+=line
+
+data0=data0.split("\n")[:-1]
+
+def isVoid(type):
+    return type == "void" or type == "GLvoid"
+
+def printFunctionNames(data):
+    print "static char const*m_profilingFunctionName(size_t id){"
+    print "  static char const*const names[] = {"
+    for x in data:
+        print "    \""+x.split(",")[1]+"\","
+    print "  };"
+    print "  return names[id];"
+    print "}"
+
+def printProfilingImplementation(id,data):
+    params = data.split(",")
+    pfn = ("memberpfn"+params[1]+"proc").upper()
+    args = ",".join(map(lambda x:x[0]+" "+x[1],zip(params[2::2],params[3::2])))
+    params2 = map(lambda x:re.sub(r"\[.*\]","",x),params);
+    call = "(this->*((FunctionTable::"+pfn+")this->m_profiledFunctions["+str(id)+"]))("+",".join(params2[3::2])+")"
+    begin = "auto const profilingStart=this->profiler.begin("+str(id)+");"
+    end = "this->profiler.end("+str(id)+",profilingStart);"
+    if isVoid(params[0]):
+        body = begin+call+";"+end
+    else:
+        body = begin+"auto const profilingResult="+call+";"+end+"return profilingResult;"
+    print params[0]+" m_"+params[1]+"_profiling("+args+")const{"+body+"}"
+
+printFunctionNames(data0)
+for i,x in enumerate(data0):
+    printProfilingImplementation(i,x)
+
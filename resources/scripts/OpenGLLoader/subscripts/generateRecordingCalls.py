@@ -0,0 +1,30 @@
+#!/usr/bin/python
+
+import sys
+import re
+import os
+
+import fileinput
+from subprocess import Popen, PIPE
+
+data0=""
+for line in fileinput.input():
+    data0+=line
+
+data0=data0.split("\n")[:-1]
+
+def printRecordingCall(data):
+    params = data.split(",")
+    pfn = ("memberpfn"+params[1]+"proc").upper()
+    print "if(this->m_ptr_"+params[1]+")this->m_ptr_"+params[1]+" = (FunctionTable::"+pfn+")&RecordingTableDecorator::m_"+params[1]+"_recording;"
+
+def printCopyOfRecordedFunctions(data):
+    first = data[0].split(",")[1]
+    print "FunctionTable::MEMBER_FUNCTION_POINTER const*recordedFunctions = (FunctionTable::MEMBER_FUNCTION_POINTER const*)&this->FunctionTable::m_ptr_"+first+";"
+    print "for(size_t i=0;i<GE_GL_NOF_OPENGL_FUNCTIONS;++i)"
+    print "  this->m_recordedFunctions[i] = recordedFunctions[i];"
+
+printCopyOfRecordedFunctions(data0)
+for x in data0:
+    printRecordingCall(x)
+
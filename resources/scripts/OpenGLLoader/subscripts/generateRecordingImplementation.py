@@ -0,0 +1,80 @@
+#!/usr/bin/python
+
+import sys
+import re
+import os
+
+import fileinput
+from subprocess import Popen, PIPE
+from recordingRules import *
+
+data0=""
+for line in fileinput.input():
+    data0+=line
+
+data0=data0.split("\n")[:-1]
+
+def recordArgument(name,names,types,i):
+    kind,size = argumentKind(name,names,types,i)
+    arg = stripArray(names[i])
+    if kind in ["value","sync","null","unknown"]:
+        return "this->recorder.value("+arg+");"
+    if kind == "data":
+        return "this->recorder.data("+arg+","+size+");"
+    if kind == "pixels":
+        return "this->recorder.pixels("+arg+","+size+");"
+    if kind == "strings":
+        length = "nullptr"
+        if "length" in names and isPointer(types[names.index("length")]):
+            length = "length"
+        return "this->recorder.strings("+countArgument(names,types)+","+arg+","+length+");"
+    if kind in ["output","names"]:
+        if size == None:
+            size = "0"
+        return "this->recorder.output("+arg+","+size+");"
+    return "this->recorder.outputPixels("+arg+","+size+");"
+
+def recordable(name,names,types):
+    unknown = []
+    for i in range(len(names)):
+        if argumentKind(name,names,types,i)[0] == "unknown":
+            unknown.append(stripArray(names[i])+"==nullptr")
+    if len(unknown) == 0:
+        return ""
+    return ","+"&&".join(unknown)
+
+def printRecordingImplementation(id,data):
+    ret,name,types,names = parseFunction(data)
+    pfn = ("memberpfn"+name+"proc").upper()
+    args = ",".join(map(lambda x:x[0]+" "+x[1],zip(types,names)))
+    argNames = map(stripArray,names)
+    call = "(this->*((FunctionTable::"+pfn+")this->m_recordedFunctions["+str(id)+"]))("+",".join(argNames)+")"
+    capture = "false"
+    if capturesMappedMemory(name):
+        capture = "true"
+    body = "if(!this->recorder.beginCall("+str(id)+","+capture+recordable(name,names,types)+"))return "+call+";"
+    for i in range(len(names)):
+        body += recordArgument(name,names,types,i)
+    if isVoid(ret):
+        body += call+";"
+    else:
+        body += "auto const recordingResult="+call+";"
+    for i in range(len(names)):
+        if argumentKind(name,names,types,i)[0] == "names":
+            body += "this->recorder.names(n,"+argNames[i]+");"
+    if resultKind(name,ret) != None:
+        body += "this->recorder.value(recordingResult);"
+    o = observer(name)
+    if o != None:
+        observerArgs = list(argNames)
+        if not isVoid(ret):
+            observerArgs.append("recordingResult")
+        body += "this->recorder."+o+"("+",".join(observerArgs)+");"
+    body += "this->recorder.endCall();"
+    if not isVoid(ret):
+        body += "return recordingResult;"
+    print ret+" m_"+name+"_recording("+args+")const{"+body+"}"
+
+for i,x in enumerate(data0):
+    printRecordingImplementation(i,x)
+
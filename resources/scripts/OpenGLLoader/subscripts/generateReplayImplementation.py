@@ -0,0 +1,75 @@
+#!/usr/bin/python
+
+import sys
+import re
+import os
+
+import fileinput
+from subprocess import Popen, PIPE
+from recordingRules import *
+
+data0=""
+for line in fileinput.input():
+    data0+=line
+
+data0=data0.split("\n")[:-1]
+
+def pointerType(type,name):
+    if "[" in name:
+        return type+"*"
+    return type
+
+def replayArgument(name,names,types,i):
+    kind,size = argumentKind(name,names,types,i)
+    type = pointerType(types[i],names[i])
+    arg = "a"+str(i)
+    if kind == "value":
+        return "auto const "+arg+"=replayer.value<"+type+">();"
+    if kind == "sync":
+        return "auto const "+arg+"=replayer.sync();"
+    if kind in ["null","unknown"]:
+        return "auto const "+arg+"=replayer.null<"+type+">();"
+    if kind == "data":
+        return "auto const "+arg+"=replayer.data<"+type+">();"
+    if kind == "pixels":
+        return "auto const "+arg+"=replayer.pixels<"+type+">();"
+    if kind == "strings":
+        return "auto const "+arg+"=("+type+")replayer.strings();"
+    if kind in ["output","names"]:
+        return "auto const "+arg+"=replayer.output<"+type+">();"
+    return "auto const "+arg+"=replayer.outputPixels<"+type+">();"
+
+def printReplayImplementation(id,data):
+    ret,name,types,names = parseFunction(data)
+    body = ""
+    for i in range(len(names)):
+        body += replayArgument(name,names,types,i)
+    body += "if(replayer.isCorrupted())return;"
+    call = "gl."+name+"("+",".join(map(lambda i:"a"+str(i),range(len(names))))+")"
+    result = resultKind(name,ret)
+    if result == None:
+        body += call+";"
+    else:
+        body += "auto const result="+call+";"
+    for i in range(len(names)):
+        if argumentKind(name,names,types,i)[0] == "names":
+            body += "replayer.checkNames(a"+str(i)+");"
+    if result == "sync":
+        body += "replayer.syncResult(result);"
+    if result == "map":
+        body += "replayer.mapResult(result);"
+    if result == "name":
+        body += "replayer.checkName(result);"
+    print "static void replay_"+name+"(FunctionTable const&gl,CallReplayer&replayer){"+body+"}"
+
+def printReplayFunctions(data):
+    print "using ReplayFunction = void(*)(FunctionTable const&,CallReplayer&);"
+    print "static ReplayFunction const replayFunctions[] = {"
+    for x in data:
+        print "  replay_"+x.split(",")[1]+","
+    print "};"
+
+for i,x in enumerate(data0):
+    printReplayImplementation(i,x)
+printReplayFunctions(data0)
+
@@ -0,0 +1,266 @@
+#!/usr/bin/python
+
+# Rules that describe client memory of OpenGL function arguments.
+# They are used by generateRecordingImplementation.py and generateReplayImplementation.py.
+#
+# Every argument gets kind and size (C++ expression in bytes):
+#   value    - scalar or pointer that is stored by value (buffer offsets)
+#   sync     - GLsync, replayed objects are mapped
+#   null     - callbacks, replayed as nullptr
+#   data     - client memory read by OpenGL
+#   pixels   - image data, offset if pixel unpack buffer is bound
+#   strings  - array of strings
+#   output   - client memory written by OpenGL
+#   names    - names of objects generated by OpenGL, they are compared during replay
+#   opixels  - image data written by OpenGL, offset if pixel pack buffer is bound
+#   unknown  - client memory of unknown size, calls with non-null pointer are not recorded
+
+import re
+
+def isVoid(type):
+    return type == "void" or type == "GLvoid"
+
+def isPointer(type):
+    return "*" in type
+
+def isConst(type):
+    return type.startswith("const")
+
+def elementType(type):
+    return re.sub(r"\*$","",re.sub(r"^const ","",type)).strip()
+
+def elementSize(type):
+    t = elementType(type)
+    if isVoid(t):
+        return "1"
+    return "sizeof("+t+")"
+
+countNames = ["count","n","drawcount","primcount","numAttachments","uniformCount","propCount"]
+
+explicitSizes = {
+    "glBufferData:data"                  : "size_t(size)",
+    "glBufferDataARB:data"               : "size_t(size)",
+    "glBufferSubData:data"               : "size_t(size)",
+    "glBufferSubDataARB:data"            : "size_t(size)",
+    "glBufferStorage:data"               : "size_t(size)",
+    "glNamedBufferData:data"             : "size_t(size)",
+    "glNamedBufferDataEXT:data"          : "size_t(size)",
+    "glNamedBufferSubData:data"          : "size_t(size)",
+    "glNamedBufferSubDataEXT:data"       : "size_t(size)",
+    "glNamedBufferStorage:data"          : "size_t(size)",
+    "glNamedBufferStorageEXT:data"       : "size_t(size)",
+    "glClearBufferData:data"             : "CallRecorder::pixelSize(format,type)",
+    "glClearBufferSubData:data"          : "CallRecorder::pixelSize(format,type)",
+    "glClearNamedBufferData:data"        : "CallRecorder::pixelSize(format,type)",
+    "glClearNamedBufferSubData:data"     : "CallRecorder::pixelSize(format,type)",
+    "glClearNamedBufferDataEXT:data"     : "CallRecorder::pixelSize(format,type)",
+    "glClearNamedBufferSubDataEXT:data"  : "CallRecorder::pixelSize(format,type)",
+    "glClearTexImage:data"               : "CallRecorder::pixelSize(format,type)",
+    "glClearTexSubImage:data"            : "CallRecorder::pixelSize(format,type)",
+    "glClearBufferfv:value"              : "(buffer==GL_COLOR?4:1)*sizeof(GLfloat)",
+    "glClearBufferiv:value"              : "(buffer==GL_COLOR?4:1)*sizeof(GLint)",
+    "glClearBufferuiv:value"             : "(buffer==GL_COLOR?4:1)*sizeof(GLuint)",
+    "glClearNamedFramebufferfv:value"    : "(buffer==GL_COLOR?4:1)*sizeof(GLfloat)",
+    "glClearNamedFramebufferiv:value"    : "(buffer==GL_COLOR?4:1)*sizeof(GLint)",
+    "glClearNamedFramebufferuiv:value"   : "(buffer==GL_COLOR?4:1)*sizeof(GLuint)",
+    "glViewportArrayv:v"                 : "size_t(count)*4*sizeof(GLfloat)",
+    "glScissorArrayv:v"                  : "size_t(count)*4*sizeof(GLint)",
+    "glDepthRangeArrayv:v"               : "size_t(count)*2*sizeof(GLdouble)",
+    "glViewportIndexedfv:v"              : "4*sizeof(GLfloat)",
+    "glLoadMatrixf:m"                    : "16*sizeof(GLfloat)",
+    "glLoadMatrixd:m"                    : "16*sizeof(GLdouble)",
+    "glMultMatrixf:m"                    : "16*sizeof(GLfloat)",
+    "glMultMatrixd:m"                    : "16*sizeof(GLdouble)",
+    "glPatchParameterfv:values"          : "(pname==GL_PATCH_DEFAULT_OUTER_LEVEL?4:2)*sizeof(GLfloat)",
+    "glShaderBinary:binary"              : "size_t(length)",
+    "glProgramBinary:binary"             : "size_t(length)",
+    "glGetBufferSubData:data"            : "size_t(size)",
+    "glGetNamedBufferSubData:data"       : "size_t(size)",
+    "glGetNamedBufferSubDataEXT:data"    : "size_t(size)",
+    "glNamedStringARB:name"              : "CallRecorder::stringSize(name,namelen)",
+    "glNamedStringARB:string"            : "CallRecorder::stringSize(string,stringlen)",
+}
+
+# functions with image data, the last pointer argument is the image
+imageFunctions = {
+    "glTexImage1D"          : "unpack,width,1,1",
+    "glTexImage2D"          : "unpack,width,height,1",
+    "glTexImage3D"          : "unpack,width,height,depth",
+    "glTexSubImage1D"       : "unpack,width,1,1",
+    "glTexSubImage2D"       : "unpack,width,height,1",
+    "glTexSubImage3D"       : "unpack,width,height,depth",
+    "glTextureSubImage1D"   : "unpack,width,1,1",
+    "glTextureSubImage2D"   : "unpack,width,height,1",
+    "glTextureSubImage3D"   : "unpack,width,height,depth",
+    "glTextureImage1DEXT"   : "unpack,width,1,1",
+    "glTextureImage2DEXT"   : "unpack,width,height,1",
+    "glTextureImage3DEXT"   : "unpack,width,height,depth",
+    "glTextureSubImage1DEXT": "unpack,width,1,1",
+    "glTextureSubImage2DEXT": "unpack,width,height,1",
+    "glTextureSubImage3DEXT": "unpack,width,height,depth",
+    "glReadPixels"          : "pack,width,height,1",
+    "glReadnPixels"         : "pack,width,height,1",
+}
+
+# functions that may consume data written to mapped buffers
+def capturesMappedMemory(name):
+    for prefix in ["glDraw","glMultiDraw","glDispatch","glMemoryBarrier","glUnmap","glFlushMapped",
+            "glTexSubImage","glTextureSubImage","glCompressedTexSubImage","glCompressedTextureSubImage"]:
+        if name.startswith(prefix):
+            return True
+    return name in ["glFenceSync","glFinish","glFlush","glCopyBufferSubData","glCopyNamedBufferSubData"]
+
+# functions that are observed by CallRecorder after they are called
+observedFunctions = [
+    "glBindBuffer",
+    "glBindBufferBase",
+    "glBindBufferRange",
+    "glBufferData",
+    "glBufferStorage",
+    "glNamedBufferData",
+    "glNamedBufferStorage",
+    "glDeleteBuffers",
+    "glPixelStorei",
+    "glMapBuffer",
+    "glMapBufferRange",
+    "glMapNamedBuffer",
+    "glMapNamedBufferRange",
+    "glUnmapBuffer",
+    "glUnmapNamedBuffer",
+]
+
+def observer(name):
+    if name in observedFunctions:
+        return "on"+name[2:]
+    return None
+
+def resultKind(name,type):
+    if type == "GLsync":
+        return "sync"
+    if name in ["glMapBuffer","glMapBufferRange","glMapNamedBuffer","glMapNamedBufferRange","glMapNamedBufferEXT","glMapNamedBufferRangeEXT","glMapBufferARB"]:
+        return "map"
+    if name in ["glCreateProgram","glCreateShader","glCreateShaderProgramv","glCreateShaderProgramEXT"]:
+        return "name"
+    return None
+
+def uniformComponents(name):
+    m = re.match(r"^gl(Program)?Uniform(Matrix)?(\d)(x(\d))?(fv|iv|uiv|dv|i64vARB|ui64vARB|i64vNV|ui64vNV)(ARB|EXT)?$",name)
+    if m == None:
+        return None
+    n = int(m.group(3))
+    if m.group(2) == None:
+        return n
+    if m.group(5) == None:
+        return n*n
+    return n*int(m.group(5))
+
+def vectorComponents(name):
+    m = re.match(r"^gl.*[a-zA-Z](\d)N?(b|s|i|f|d|ub|us|ui|x|h|i64|ui64|hNV|i64NV|ui64NV)v(ARB|EXT|NV|OES|SUN|ATI|MESA)?$",name)
+    if m == None:
+        return None
+    return int(m.group(1))
+
+def matrixComponents(name):
+    if re.match(r"^gl(Load|Mult)(Transpose)?Matrix[fdx](ARB|OES)?$",name):
+        return 16
+    if re.match(r"^glMatrix(Load|Mult)(Transpose)?[fd]EXT$",name):
+        return 16
+    if re.match(r"^glMatrix(Load|Mult)(Transpose)?3x3fNV$",name):
+        return 9
+    if re.match(r"^glMatrix(Load|Mult)3x2fNV$",name):
+        return 6
+    return None
+
+def sizedArrayComponents(name,names):
+    if re.match(r"^gl(MatrixIndex|Weight)(b|s|i|f|d|ub|us|ui)vARB$",name) and "size" in names:
+        return "size_t(size)"
+    return None
+
+def parameterComponents(name):
+    if re.match(r"^gl(Tex|Texture|Sampler|MultiTex)Parameter(I)?(f|i|ui|x)v(EXT|OES)?$",name):
+        return "(pname==GL_TEXTURE_BORDER_COLOR||pname==GL_TEXTURE_SWIZZLE_RGBA?4:1)"
+    return None
+
+def countArgument(names,types):
+    for c in countNames:
+        if c in names and not isPointer(types[names.index(c)]):
+            return c
+    return None
+
+def argumentKind(name,names,types,i):
+    type = types[i]
+    arg  = names[i]
+    key  = name+":"+arg
+    m = re.match(r"^(\w+)\[(\d+)\]$",arg)
+    if m != None:
+        size = m.group(2)+"*sizeof("+elementType(type)+")"
+        if isConst(type):
+            return ("data",size)
+        return ("output",size)
+    if type == "GLsync":
+        return ("sync",None)
+    if "PROC" in type:
+        return ("null",None)
+    if not isPointer(type):
+        return ("value",None)
+    if name in imageFunctions and i == len(names)-1:
+        p = imageFunctions[name].split(",")
+        size = "this->recorder."+p[0]+"ImageSize(format,type,"+",".join(p[1:])+")"
+        if p[0] == "pack":
+            return ("opixels",size)
+        return ("pixels",size)
+    if re.match(r"^glCompressed(Tex|Texture|MultiTex)(Sub)?Image[123]D(EXT)?$",name) and i == len(names)-1:
+        return ("pixels","size_t(imageSize)")
+    if key in explicitSizes:
+        if isConst(type):
+            return ("data",explicitSizes[key])
+        return ("output",explicitSizes[key])
+    if type in ["const GLchar*const*","const GLcharARB**"]:
+        return ("strings",None)
+    if not isConst(type):
+        if re.match(r"^gl(Gen|Create)",name) and "n" in names and elementType(type) == "GLuint":
+            return ("names","size_t(n)*sizeof(GLuint)")
+        if "bufSize" in names and not isPointer(types[names.index("bufSize")]):
+            if arg == "length":
+                return ("output","sizeof(GLsizei)")
+            return ("output","size_t(bufSize)*"+elementSize(type))
+        c = countArgument(names,types)
+        if c != None and not isVoid(elementType(type)):
+            return ("output","size_t("+c+")*"+elementSize(type))
+        return ("output",None)
+    if elementType(type) in ["GLchar","GLcharARB"]:
+        if "length" in names and types[names.index("length")] in ["GLsizei","GLint"]:
+            return ("data","CallRecorder::stringSize("+arg+",length)")
+        return ("data","CallRecorder::stringSize("+arg+",-1)")
+    if type in ["const void*const*","const void**"] and "drawcount" in names:
+        return ("data","size_t(drawcount)*sizeof(void*)")
+    if isVoid(elementType(type)) or elementType(type) in ["void*","GLvoid*"]:
+        return ("value",None)
+    components = uniformComponents(name)
+    if components != None and countArgument(names,types) == "count":
+        return ("data","size_t(count)*"+str(components)+"*"+elementSize(type))
+    c = countArgument(names,types)
+    if c != None:
+        return ("data","size_t("+c+")*"+elementSize(type))
+    components = vectorComponents(name)
+    if components != None:
+        return ("data",str(components)+"*"+elementSize(type))
+    components = parameterComponents(name)
+    if components != None:
+        return ("data",components+"*"+elementSize(type))
+    components = matrixComponents(name)
+    if components != None:
+        return ("data",str(components)+"*"+elementSize(type))
+    components = sizedArrayComponents(name,names)
+    if components != None:
+        return ("data",components+"*"+elementSize(type))
+    return ("unknown",None)
+
+def parseFunction(line):
+    params = line.split(",")
+    types  = params[2::2]
+    names  = params[3::2]
+    return params[0],params[1],types,names
+
+def stripArray(name):
+    return re.sub(r"\[.*\]","",name)
@@ -0,0 +1,135 @@
+#include <geCore/ThreadPool.h>
+
+using namespace std;
+using namespace ge::core;
+
+
+
+/** Constructor.
+ *
+ *  @param numThreads Number of threads executing the tasks, including
+ *                    the thread calling parallelFor(). Zero means to use
+ *                    the number of hardware threads. One means no worker threads,
+ *                    all the tasks are executed by the calling thread.
+ */
+ThreadPool::ThreadPool(unsigned numThreads)
+   : _task(nullptr)
+   , _numTasks(0)
+   , _nextTask(0)
+   , _numWorkersRunning(0)
+   , _generation(0)
+   , _quit(false)
+{
+   if(numThreads==0) {
+      numThreads=thread::hardware_concurrency();
+      if(numThreads==0)
+         numThreads=1;
+   }
+
+   _workers.reserve(numThreads-1);
+   for(unsigned i=1; i<numThreads; i++)
+      _workers.emplace_back(&ThreadPool::workerMain,this);
+}
+
+
+ThreadPool::~ThreadPool()
+{
+   {
+      lock_guard<mutex> lock(_mutex);
+      _quit=true;
+   }
+   _workAvailable.notify_all();
+   for(thread &t : _workers)
+      t.join();
+}
+
+
+/** Executes task for each task index in the range <0,numTasks)
+ *  and returns after all of them are finished.
+ *  The first exception thrown by a task is rethrown
+ *  when all the threads finished their work.
+ */
+void ThreadPool::parallelFor(unsigned numTasks,const Task& task)
+{
+   if(numTasks==0)
+      return;
+
+   // no need to wake up the workers
+   if(_workers.empty() || numTasks==1) {
+      for(unsigned i=0; i<numTasks; i++)
+         task(i);
+      return;
+   }
+
+   lock_guard<mutex> parallelForLock(_parallelForMutex);
+
+   // publish the work
+   {
+      lock_guard<mutex> lock(_mutex);
+      _task=&task;
+      _numTasks=numTasks;
+      _nextTask.store(0,memory_order_relaxed);
+      _numWorkersRunning=unsigned(_workers.size());
+      _generation++;
+   }
+   _workAvailable.notify_all();
+
+   // participate on the work
+   runTasks();
+
+   // wait for the workers
+   unique_lock<mutex> lock(_mutex);
+   _workDone.wait(lock,[this]{ return _numWorkersRunning==0; });
+   _task=nullptr;
+   exception_ptr e=_exception;
+   _exception=nullptr;
+   lock.unlock();
+   if(e)
+      rethrow_exception(e);
+}
+
+
+/** Executes tasks until there are no more of them.
+ *  Exception thrown by a task is stored for parallelFor() and remaining tasks are skipped,
+ *  so the thread always reports its finished work and parallelFor() does not wait forever.
+ */
+void ThreadPool::runTasks()
+{
+   try {
+      for(unsigned i=_nextTask.fetch_add(1,memory_order_relaxed); i<_numTasks;
+          i=_nextTask.fetch_add(1,memory_order_relaxed))
+         (*_task)(i);
+   }
+   catch(...) {
+      lock_guard<mutex> lock(_mutex);
+      if(!_exception)
+         _exception=current_exception();
+      _nextTask.store(_numTasks,memory_order_relaxed);
+   }
+}
+
+
+void ThreadPool::workerMain()
+{
+   unsigned generation=0;
+   while(true) {
+
+      // wait for the work
+      {
+         unique_lock<mutex> lock(_mutex);
+         _workAvailable.wait(lock,[this,generation]{ return _quit || _generation!=generation; });
+         if(_quit)
+            return;
+         generation=_generation;
+      }
+
+      runTasks();
+
+      // report finished work
+      {
+         lock_guard<mutex> lock(_mutex);
+         if(--_numWorkersRunning==0)
+            _workDone.notify_one();
+      }
+   }
+}
@@ -174,14 +174,32 @@ bool Buffer::realloc(
     GLsizeiptr   const&newSize,
     ReallocFlags const&flags  ){
   assert(this!=nullptr);
+  if(this->isImmutable())
+    return this->realloc(newSize,flags,this->getStorageFlags());
+  return this->realloc(newSize,flags,this->getUsage());
+}
+
+/**
+ * @brief This function reallocates buffer with new usage or storage flags.
+ * Mutable buffer can be turned into immutable one (for example, to be
+ * persistently mapped), but KEEP_ID can not be used once it is immutable.
+ *
+ * @param newSize new size
+ * @param flags KEEP_ID|KEEP_DATA
+ * @param bufferFlags usage or storage flags of new buffer
+ */
+bool Buffer::realloc(
+    GLsizeiptr   const&newSize    ,
+    ReallocFlags const&flags      ,
+    GLbitfield   const&bufferFlags){
+  assert(this!=nullptr);
   if((flags&KEEP_ID)&&this->isImmutable()){
     ge::core::printError(
         GE_CORE_FCENAME,
         "can't sustain buffer id: "+ge::core::value2str(this->getId())+
-        ", buffer is immutable",newSize,flags);
+        ", buffer is immutable",newSize,flags,bufferFlags);
     return false;
   }
-  GLbitfield bufferFlags=this->getUsage();
   if      (flags==(KEEP_ID|KEEP_DATA)){
     Buffer*temp=new Buffer(newSize,nullptr,bufferFlags);
     assert(temp!=nullptr);
@@ -516,6 +534,16 @@ GLboolean Buffer::isImmutable()const{
   return (GLboolean)this->_getBufferParameter(GL_BUFFER_IMMUTABLE_STORAGE);
 }
 
+/**
+ * @brief gets storage flags of this buffer
+ *
+ * @return storage flags (GL_BUFFER_STORAGE_FLAGS)
+ */
+GLbitfield Buffer::getStorageFlags()const{
+  assert(this!=nullptr);
+  return this->_getBufferParameter(GL_BUFFER_STORAGE_FLAGS);
+}
+
 /**
  * @brief gets map buffer pointer
  *
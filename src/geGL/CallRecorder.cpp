@@ -0,0 +1,472 @@
+#include<geGL/CallRecorder.h>
+#include<geGL/Generated/NumberOfFunctions.h>
+#include<algorithm>
+#include<cassert>
+
+using namespace ge::gl;
+
+uint32_t const CallRecorder::frameMarker;
+uint32_t const CallRecorder::mappedWrite;
+uint32_t const CallRecorder::version;
+
+CallRecorder::CallRecorder(){
+  assert(this!=nullptr);
+}
+
+/**
+ * @brief removes recorded calls
+ * Storage is kept for next recording.
+ * Bindings, buffer sizes, mappings and pixel store state are kept,
+ * they describe current state of OpenGL.
+ */
+void CallRecorder::clear(){
+  assert(this!=nullptr);
+  this->_size            = 0;
+  this->_nofCalls        = 0;
+  this->_nofFrames       = 0;
+  this->_nofRefusedCalls = 0;
+}
+
+/**
+ * @brief marks end of frame
+ * CallReplayer::replayFrame() replays calls until this mark.
+ */
+void CallRecorder::endFrame(){
+  assert(this!=nullptr);
+  this->value(frameMarker);
+  this->_nofFrames++;
+}
+
+size_t CallRecorder::getNofCalls()const{
+  assert(this!=nullptr);
+  return this->_nofCalls;
+}
+
+/**
+ * @brief returns number of calls that were not recorded
+ * They pass client memory of unknown size, the stream can not be replayed faithfully if it is not 0.
+ *
+ * @return number of refused calls
+ */
+size_t CallRecorder::getNofRefusedCalls()const{
+  assert(this!=nullptr);
+  return this->_nofRefusedCalls;
+}
+
+size_t CallRecorder::getNofFrames()const{
+  assert(this!=nullptr);
+  return this->_nofFrames;
+}
+
+uint8_t const*CallRecorder::getData()const{
+  assert(this!=nullptr);
+  return this->_data.data();
+}
+
+/**
+ * @brief returns size of recorded calls
+ *
+ * @return size in bytes
+ */
+size_t CallRecorder::getSize()const{
+  assert(this!=nullptr);
+  return this->_size;
+}
+
+/**
+ * @brief writes recorded calls to stream
+ * It can be loaded by CallReplayer::load().
+ *
+ * @param out binary output stream
+ */
+void CallRecorder::save(std::ostream&out)const{
+  assert(this!=nullptr);
+  uint32_t const header[4] = {version,GE_GL_NOF_OPENGL_FUNCTIONS,uint32_t(sizeof(void*)),0};
+  uint64_t const size = this->_size;
+  out.write("GEGLCALL",8);
+  out.write((char const*)header,sizeof(header));
+  out.write((char const*)&size,sizeof(size));
+  out.write((char const*)this->_data.data(),this->_size);
+}
+
+/**
+ * @brief computes size of one pixel
+ *
+ * @param format format of pixel data (GL_RGBA, ...)
+ * @param type type of pixel data (GL_UNSIGNED_BYTE, ...)
+ *
+ * @return size of pixel in bytes
+ */
+size_t CallRecorder::pixelSize(GLenum format,GLenum type){
+  switch(type){
+    case GL_UNSIGNED_BYTE_3_3_2:
+    case GL_UNSIGNED_BYTE_2_3_3_REV:
+      return 1;
+    case GL_UNSIGNED_SHORT_5_6_5:
+    case GL_UNSIGNED_SHORT_5_6_5_REV:
+    case GL_UNSIGNED_SHORT_4_4_4_4:
+    case GL_UNSIGNED_SHORT_4_4_4_4_REV:
+    case GL_UNSIGNED_SHORT_5_5_5_1:
+    case GL_UNSIGNED_SHORT_1_5_5_5_REV:
+      return 2;
+    case GL_UNSIGNED_INT_8_8_8_8:
+    case GL_UNSIGNED_INT_8_8_8_8_REV:
+    case GL_UNSIGNED_INT_10_10_10_2:
+    case GL_UNSIGNED_INT_2_10_10_10_REV:
+    case GL_UNSIGNED_INT_24_8:
+    case GL_UNSIGNED_INT_10F_11F_11F_REV:
+    case GL_UNSIGNED_INT_5_9_9_9_REV:
+      return 4;
+    case GL_FLOAT_32_UNSIGNED_INT_24_8_REV:
+      return 8;
+  }
+  size_t components = 4;
+  switch(format){
+    case GL_RED:
+    case GL_GREEN:
+    case GL_BLUE:
+    case GL_ALPHA:
+    case GL_RED_INTEGER:
+    case GL_GREEN_INTEGER:
+    case GL_BLUE_INTEGER:
+    case GL_DEPTH_COMPONENT:
+    case GL_STENCIL_INDEX:
+    case GL_LUMINANCE:
+      components = 1;
+      break;
+    case GL_RG:
+    case GL_RG_INTEGER:
+    case GL_DEPTH_STENCIL:
+    case GL_LUMINANCE_ALPHA:
+      components = 2;
+      break;
+    case GL_RGB:
+    case GL_BGR:
+    case GL_RGB_INTEGER:
+    case GL_BGR_INTEGER:
+      components = 3;
+      break;
+  }
+  switch(type){
+    case GL_BYTE:
+    case GL_UNSIGNED_BYTE:
+      return components;
+    case GL_SHORT:
+    case GL_UNSIGNED_SHORT:
+    case GL_HALF_FLOAT:
+      return components*2;
+    case GL_DOUBLE:
+      return components*8;
+  }
+  return components*4;
+}
+
+/**
+ * @brief computes size of string argument
+ *
+ * @param string string
+ * @param length length of string, negative for null-terminated string
+ *
+ * @return size in bytes including null terminator
+ */
+size_t CallRecorder::stringSize(GLchar const*string,GLint length){
+  if(!string)return 0;
+  if(length<0)return std::strlen(string)+1;
+  return size_t(length);
+}
+
+size_t CallRecorder::_imageSize(PixelStore const&store,GLenum format,GLenum type,GLsizei width,GLsizei height,GLsizei depth){
+  if(width<=0||height<=0||depth<=0)return 0;
+  size_t const pixel       = pixelSize(format,type);
+  size_t const alignment   = size_t(std::max(store.alignment,1));
+  size_t const rowLength   = size_t(store.rowLength  >0?store.rowLength  :width );
+  size_t const imageHeight = size_t(store.imageHeight>0?store.imageHeight:height);
+  size_t const row         = (rowLength*pixel+alignment-1)/alignment*alignment;
+  size_t const image       = row*imageHeight;
+  return
+    (size_t(store.skipImages)+size_t(depth )-1)*image+
+    (size_t(store.skipRows  )+size_t(height)-1)*row  +
+    (size_t(store.skipPixels)+size_t(width ))  *pixel;
+}
+
+/**
+ * @brief computes size of client memory with image that is read by OpenGL
+ * Current GL_UNPACK_* state is used.
+ *
+ * @return size in bytes
+ */
+size_t CallRecorder::unpackImageSize(GLenum format,GLenum type,GLsizei width,GLsizei height,GLsizei depth)const{
+  assert(this!=nullptr);
+  return _imageSize(this->_unpack,format,type,width,height,depth);
+}
+
+/**
+ * @brief computes size of client memory with image that is written by OpenGL
+ * Current GL_PACK_* state is used.
+ *
+ * @return size in bytes
+ */
+size_t CallRecorder::packImageSize(GLenum format,GLenum type,GLsizei width,GLsizei height,GLsizei depth)const{
+  assert(this!=nullptr);
+  return _imageSize(this->_pack,format,type,width,height,depth);
+}
+
+/**
+ * @brief starts recording of call
+ * Calls made while another call is recorded (for example by DSA emulation) are not recorded,
+ * they are part of the outer call.
+ *
+ * @param id id of function
+ * @param captureMappedMemory true if the function can read data written to mapped buffers
+ * @param recordable false if the call passes client memory of unknown size, such call is refused
+ *
+ * @return false if the call should not be recorded
+ */
+bool CallRecorder::beginCall(uint32_t id,bool captureMappedMemory,bool recordable){
+  assert(this!=nullptr);
+  if(this->_inCall)return false;
+  if(!recordable){
+    this->_nofRefusedCalls++;
+    return false;
+  }
+  this->_inCall = true;
+  if(captureMappedMemory)this->captureMappedMemory();
+  this->value(id);
+  this->_nofCalls++;
+  return true;
+}
+
+void CallRecorder::endCall(){
+  assert(this!=nullptr);
+  this->_inCall = false;
+}
+
+void CallRecorder::_align(){
+  uint64_t const zero = 0;
+  this->_write(&zero,((this->_size+7)&~size_t(7))-this->_size);
+}
+
+/**
+ * @brief writes client memory that is read by OpenGL
+ *
+ * @param data pointer to data, it can be nullptr
+ * @param size size of data in bytes
+ */
+void CallRecorder::data(void const*data,size_t size){
+  assert(this!=nullptr);
+  if(!data){
+    this->value(uint64_t(0));
+    return;
+  }
+  this->value(uint64_t(size+1));
+  this->_align();
+  this->_write(data,size);
+}
+
+/**
+ * @brief writes image data that are read by OpenGL
+ * The pointer is offset if pixel unpack buffer is bound.
+ *
+ * @param data pointer to data or offset
+ * @param size size of data in bytes
+ */
+void CallRecorder::pixels(void const*data,size_t size){
+  assert(this!=nullptr);
+  bool const offset = this->_bufferBindings[GL_PIXEL_UNPACK_BUFFER] != 0;
+  this->value(uint8_t(offset?0:1));
+  if(offset)this->value(data);
+  else this->data(data,size);
+}
+
+/**
+ * @brief writes array of strings
+ *
+ * @param count number of strings
+ * @param strings strings
+ * @param length lengths of strings, nullptr or negative length for null-terminated strings
+ */
+void CallRecorder::strings(GLsizei count,GLchar const*const*strings,GLint const*length){
+  assert(this!=nullptr);
+  if(!strings)count = 0;
+  this->value(count);
+  for(GLsizei i=0;i<count;++i){
+    if(!strings[i]){
+      this->value(uint64_t(0));
+      continue;
+    }
+    size_t const size = length&&length[i]>=0?size_t(length[i]):std::strlen(strings[i]);
+    this->value(uint64_t(size+2));
+    this->_align();
+    this->_write(strings[i],size);
+    this->value(GLchar(0));
+  }
+}
+
+/**
+ * @brief writes size of client memory that is written by OpenGL
+ *
+ * @param data pointer to memory, it can be nullptr
+ * @param size size of memory, 0 if it is unknown
+ */
+void CallRecorder::output(void const*data,size_t size){
+  assert(this!=nullptr);
+  this->value(uint64_t(data?size+1:0));
+}
+
+/**
+ * @brief writes image data that are written by OpenGL
+ * The pointer is offset if pixel pack buffer is bound.
+ *
+ * @param data pointer to data or offset
+ * @param size size of data in bytes
+ */
+void CallRecorder::outputPixels(void const*data,size_t size){
+  assert(this!=nullptr);
+  bool const offset = this->_bufferBindings[GL_PIXEL_PACK_BUFFER] != 0;
+  this->value(uint8_t(offset?0:1));
+  if(offset)this->value(data);
+  else this->output(data,size);
+}
+
+/**
+ * @brief writes names of generated objects
+ * It is called after glGen* or glCreate* function.
+ *
+ * @param n number of names
+ * @param names names
+ */
+void CallRecorder::names(GLsizei n,GLuint const*names){
+  assert(this!=nullptr);
+  this->data(names,size_t(std::max(n,0))*sizeof(GLuint));
+}
+
+/**
+ * @brief writes data that were written to mapped buffers since last capture
+ * Mapped memory is compared with its copy in blocks, only changed blocks are recorded.
+ */
+void CallRecorder::captureMappedMemory(){
+  assert(this!=nullptr);
+  size_t const blockSize = 256;
+  for(auto&m:this->_mappings){
+    auto&mapping = m.second;
+    size_t const size = mapping.shadow.size();
+    auto const changed = [&](size_t b){
+      return std::memcmp(mapping.pointer+b,mapping.shadow.data()+b,std::min(blockSize,size-b)) != 0;
+    };
+    size_t begin = 0;
+    while(begin<size){
+      while(begin<size && !changed(begin))begin+=blockSize;
+      if(begin>=size)break;
+      size_t end = begin;
+      while(end<size && changed(end))end+=blockSize;
+      end = std::min(end,size);
+      std::memcpy(mapping.shadow.data()+begin,mapping.pointer+begin,end-begin);
+      this->value(mappedWrite);
+      this->value(static_cast<void const*>(mapping.pointer));
+      this->value(uint64_t(begin));
+      this->data(mapping.shadow.data()+begin,end-begin);
+      begin = end;
+    }
+  }
+}
+
+void CallRecorder::_map(GLuint buffer,size_t size,bool write,void*pointer){
+  if(!write||!pointer)return;
+  auto&mapping = this->_mappings[buffer];
+  mapping.pointer = static_cast<uint8_t*>(pointer);
+  mapping.shadow.assign(mapping.pointer,mapping.pointer+size);
+}
+
+void CallRecorder::onBindBuffer(GLenum target,GLuint buffer){
+  assert(this!=nullptr);
+  this->_bufferBindings[target] = buffer;
+}
+
+void CallRecorder::onBindBufferBase(GLenum target,GLuint,GLuint buffer){
+  assert(this!=nullptr);
+  this->_bufferBindings[target] = buffer;
+}
+
+void CallRecorder::onBindBufferRange(GLenum target,GLuint,GLuint buffer,GLintptr,GLsizeiptr){
+  assert(this!=nullptr);
+  this->_bufferBindings[target] = buffer;
+}
+
+void CallRecorder::onBufferData(GLenum target,GLsizeiptr size,void const*,GLenum){
+  assert(this!=nullptr);
+  this->_bufferSizes[this->_bufferBindings[target]] = size_t(size);
+}
+
+void CallRecorder::onBufferStorage(GLenum target,GLsizeiptr size,void const*,GLbitfield){
+  assert(this!=nullptr);
+  this->_bufferSizes[this->_bufferBindings[target]] = size_t(size);
+}
+
+void CallRecorder::onNamedBufferData(GLuint buffer,GLsizeiptr size,void const*,GLenum){
+  assert(this!=nullptr);
+  this->_bufferSizes[buffer] = size_t(size);
+}
+
+void CallRecorder::onNamedBufferStorage(GLuint buffer,GLsizeiptr size,void const*,GLbitfield){
+  assert(this!=nullptr);
+  this->_bufferSizes[buffer] = size_t(size);
+}
+
+void CallRecorder::onDeleteBuffers(GLsizei n,GLuint const*buffers){
+  assert(this!=nullptr);
+  for(GLsizei i=0;i<n;++i){
+    this->_bufferSizes.erase(buffers[i]);
+    this->_mappings   .erase(buffers[i]);
+    for(auto&b:this->_bufferBindings)
+      if(b.second == buffers[i])b.second = 0;
+  }
+}
+
+void CallRecorder::onPixelStorei(GLenum pname,GLint param){
+  assert(this!=nullptr);
+  switch(pname){
+    case GL_UNPACK_ALIGNMENT   :this->_unpack.alignment   = param;break;
+    case GL_UNPACK_ROW_LENGTH  :this->_unpack.rowLength   = param;break;
+    case GL_UNPACK_IMAGE_HEIGHT:this->_unpack.imageHeight = param;break;
+    case GL_UNPACK_SKIP_PIXELS :this->_unpack.skipPixels  = param;break;
+    case GL_UNPACK_SKIP_ROWS   :this->_unpack.skipRows    = param;break;
+    case GL_UNPACK_SKIP_IMAGES :this->_unpack.skipImages  = param;break;
+    case GL_PACK_ALIGNMENT     :this->_pack  .alignment   = param;break;
+    case GL_PACK_ROW_LENGTH    :this->_pack  .rowLength   = param;break;
+    case GL_PACK_IMAGE_HEIGHT  :this->_pack  .imageHeight = param;break;
+    case GL_PACK_SKIP_PIXELS   :this->_pack  .skipPixels  = param;break;
+    case GL_PACK_SKIP_ROWS     :this->_pack  .skipRows    = param;break;
+    case GL_PACK_SKIP_IMAGES   :this->_pack  .skipImages  = param;break;
+  }
+}
+
+void CallRecorder::onMapBuffer(GLenum target,GLenum access,void*pointer){
+  assert(this!=nullptr);
+  GLuint const buffer = this->_bufferBindings[target];
+  this->_map(buffer,this->_bufferSizes[buffer],access != GL_READ_ONLY,pointer);
+}
+
+void CallRecorder::onMapBufferRange(GLenum target,GLintptr,GLsizeiptr length,GLbitfield access,void*pointer){
+  assert(this!=nullptr);
+  this->_map(this->_bufferBindings[target],size_t(length),(access&GL_MAP_WRITE_BIT) != 0,pointer);
+}
+
+void CallRecorder::onMapNamedBuffer(GLuint buffer,GLenum access,void*pointer){
+  assert(this!=nullptr);
+  this->_map(buffer,this->_bufferSizes[buffer],access != GL_READ_ONLY,pointer);
+}
+
+void CallRecorder::onMapNamedBufferRange(GLuint buffer,GLintptr,GLsizeiptr length,GLbitfield access,void*pointer){
+  assert(this!=nullptr);
+  this->_map(buffer,size_t(length),(access&GL_MAP_WRITE_BIT) != 0,pointer);
+}
+
+void CallRecorder::onUnmapBuffer(GLenum target,GLboolean){
+  assert(this!=nullptr);
+  this->_mappings.erase(this->_bufferBindings[target]);
+}
+
+void CallRecorder::onUnmapNamedBuffer(GLuint buffer,GLboolean){
+  assert(this!=nullptr);
+  this->_mappings.erase(buffer);
+}
@@ -0,0 +1,274 @@
+#include<geGL/CallReplayer.h>
+#include<geGL/OpenGLFunctionTable.h>
+#include<algorithm>
+#include<cassert>
+
+using namespace ge::gl;
+
+namespace{
+#include<geGL/Generated/ReplayImplementation.h>
+}
+
+size_t const CallReplayer::defaultOutputSize;
+
+CallReplayer::CallReplayer(FunctionTablePointer const&table):_table(table){
+  assert(this!=nullptr);
+  assert(table!=nullptr);
+}
+
+/**
+ * @brief loads calls written by CallRecorder::save()
+ *
+ * @param in binary input stream
+ *
+ * @return false if the stream is not a call stream of the same OpenGL function set
+ */
+bool CallReplayer::load(std::istream&in){
+  assert(this!=nullptr);
+  char magic[8];
+  uint32_t header[4];
+  uint64_t size = 0;
+  in.read(magic,sizeof(magic));
+  in.read((char*)header,sizeof(header));
+  in.read((char*)&size,sizeof(size));
+  if(!in || std::memcmp(magic,"GEGLCALL",8) != 0)return false;
+  if(header[0] != CallRecorder::version)return false;
+  if(header[1] != GE_GL_NOF_OPENGL_FUNCTIONS)return false;
+  if(header[2] != sizeof(void*))return false;
+  std::vector<uint8_t>data(size);
+  in.read((char*)data.data(),size);
+  if(!in)return false;
+  this->_data.swap(data);
+  this->rewind();
+  return true;
+}
+
+/**
+ * @brief sets calls directly from CallRecorder::getData()
+ *
+ * @param data recorded calls
+ * @param size size of recorded calls in bytes
+ */
+void CallReplayer::setData(uint8_t const*data,size_t size){
+  assert(this!=nullptr);
+  this->_data.assign(data,data+size);
+  this->rewind();
+}
+
+/**
+ * @brief replays one call
+ * End of frame is replayed as a call without OpenGL function.
+ *
+ * @return false if there are no more calls or the stream is corrupted
+ */
+bool CallReplayer::replayCall(){
+  assert(this!=nullptr);
+  if(this->_corrupted || this->_position >= this->_data.size())return false;
+  auto const id = this->value<uint32_t>();
+  if(this->_corrupted)return false;
+  if(id == CallRecorder::frameMarker){
+    this->_nofFrames++;
+    return true;
+  }
+  if(id == CallRecorder::mappedWrite){
+    this->_replayMappedWrite();
+    return !this->_corrupted;
+  }
+  if(id >= GE_GL_NOF_OPENGL_FUNCTIONS){
+    this->_position  = this->_data.size();
+    this->_corrupted = true;
+    return false;
+  }
+  this->_strings.clear();
+  this->_nofOutputs = 0;
+  replayFunctions[id](*this->_table,*this);
+  if(this->_corrupted)return false;
+  this->_nofCalls++;
+  return true;
+}
+
+/**
+ * @brief replays calls until end of frame
+ *
+ * @return false if the stream ended before end of frame or it is corrupted
+ */
+bool CallReplayer::replayFrame(){
+  assert(this!=nullptr);
+  size_t const frames = this->_nofFrames;
+  while(this->_nofFrames == frames)
+    if(!this->replayCall())return false;
+  return true;
+}
+
+/**
+ * @brief replays all remaining calls
+ */
+void CallReplayer::replay(){
+  assert(this!=nullptr);
+  while(this->replayCall());
+}
+
+/**
+ * @brief moves to the beginning of the stream, counters are reset
+ */
+void CallReplayer::rewind(){
+  assert(this!=nullptr);
+  this->_position          = 0;
+  this->_nofCalls          = 0;
+  this->_nofFrames         = 0;
+  this->_nofNameMismatches = 0;
+  this->_corrupted         = false;
+  this->_syncs   .clear();
+  this->_mappings.clear();
+}
+
+/**
+ * @brief returns position in the stream
+ * It can be used with setPosition() for replaying one frame many times.
+ *
+ * @return position in bytes
+ */
+size_t CallReplayer::getPosition()const{
+  assert(this!=nullptr);
+  return this->_position;
+}
+
+/**
+ * @brief sets position in the stream
+ *
+ * @param position value returned by getPosition()
+ */
+void CallReplayer::setPosition(size_t position){
+  assert(this!=nullptr);
+  assert(position<=this->_data.size());
+  this->_position = position;
+}
+
+size_t CallReplayer::getSize()const{
+  assert(this!=nullptr);
+  return this->_data.size();
+}
+
+size_t CallReplayer::getNofReplayedCalls()const{
+  assert(this!=nullptr);
+  return this->_nofCalls;
+}
+
+size_t CallReplayer::getNofReplayedFrames()const{
+  assert(this!=nullptr);
+  return this->_nofFrames;
+}
+
+/**
+ * @brief returns number of objects that got different name than during recording
+ * Replayed calls use recorded names, so they refer to wrong objects if it is not 0.
+ *
+ * @return number of mismatched names
+ */
+size_t CallReplayer::getNofNameMismatches()const{
+  assert(this!=nullptr);
+  return this->_nofNameMismatches;
+}
+
+/**
+ * @brief returns true if the stream is truncated or it contains invalid data
+ * Replay stops at the first call that can not be read, the call is not issued.
+ * rewind() clears the state.
+ *
+ * @return true if the stream is corrupted
+ */
+bool CallReplayer::isCorrupted()const{
+  assert(this!=nullptr);
+  return this->_corrupted;
+}
+
+void const*CallReplayer::_blob(){
+  auto const size = this->value<uint64_t>();
+  if(size == 0)return nullptr;
+  size_t const position = (this->_position+7)&~size_t(7);
+  if(position > this->_data.size() || size-1 > this->_data.size()-position){
+    this->_position  = this->_data.size();
+    this->_corrupted = true;
+    return nullptr;
+  }
+  this->_position = position+size_t(size-1);
+  return this->_data.data()+position;
+}
+
+void*CallReplayer::_output(){
+  auto const size = this->value<uint64_t>();
+  if(size == 0 || this->_corrupted)return nullptr;
+  if(this->_outputs.size() <= this->_nofOutputs)
+    this->_outputs.emplace_back();
+  auto&output = this->_outputs[this->_nofOutputs++];
+  size_t const required = std::max(size_t(size-1),defaultOutputSize);
+  if(output.size()<required)output.resize(required,0);
+  return output.data();
+}
+
+/**
+ * @brief reads array of strings
+ *
+ * @return pointers to strings in stream
+ */
+GLchar const*const*CallReplayer::strings(){
+  assert(this!=nullptr);
+  auto const count = this->value<GLsizei>();
+  size_t const first = this->_strings.size();
+  for(GLsizei i=0;i<count && !this->_corrupted;++i)
+    this->_strings.push_back(static_cast<GLchar const*>(this->_blob()));
+  return this->_strings.data()+first;
+}
+
+/**
+ * @brief reads sync object and translates it to replayed sync object
+ *
+ * @return replayed sync object
+ */
+GLsync CallReplayer::sync(){
+  assert(this!=nullptr);
+  auto const recorded = this->value<GLsync>();
+  auto const it = this->_syncs.find(recorded);
+  if(it == this->_syncs.end())return nullptr;
+  return it->second;
+}
+
+/**
+ * @brief compares generated names with recorded names
+ *
+ * @param names names generated during replay
+ */
+void CallReplayer::checkNames(GLuint const*names){
+  assert(this!=nullptr);
+  auto const size = this->value<uint64_t>();
+  if(size == 0)return;
+  this->_position = std::min((this->_position+7)&~size_t(7),this->_data.size());
+  size_t const n = size_t(size-1)/sizeof(GLuint);
+  for(size_t i=0;i<n && !this->_corrupted;++i)
+    this->checkName(names?names[i]:0);
+}
+
+void CallReplayer::checkName(GLuint name){
+  assert(this!=nullptr);
+  if(this->value<GLuint>() != name)this->_nofNameMismatches++;
+}
+
+void CallReplayer::syncResult(GLsync sync){
+  assert(this!=nullptr);
+  this->_syncs[this->value<GLsync>()] = sync;
+}
+
+void CallReplayer::mapResult(void*pointer){
+  assert(this!=nullptr);
+  this->_mappings[this->value<void const*>()] = static_cast<uint8_t*>(pointer);
+}
+
+void CallReplayer::_replayMappedWrite(){
+  auto const recorded = this->value<void const*>();
+  auto const offset   = this->value<uint64_t>();
+  auto const data     = this->_blob();
+  size_t const size   = data?size_t(this->_position-(static_cast<uint8_t const*>(data)-this->_data.data())):0;
+  auto const it = this->_mappings.find(recorded);
+  if(it == this->_mappings.end() || !it->second || !data || this->_corrupted)return;
+  std::memcpy(it->second+offset,data,size);
+}
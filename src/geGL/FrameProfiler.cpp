@@ -0,0 +1,379 @@
+#include<geGL/FrameProfiler.h>
+#include<algorithm>
+#include<cassert>
+#include<iomanip>
+
+using namespace ge::gl;
+
+namespace{
+  GLsizei const queryBatch = 32;///< number of queries created at once when the pool is empty
+}
+
+/**
+ * @brief creates profiler using default function table
+ *
+ * @param maxLatency number of frames that GPU can be behind before frames are dropped
+ * @param historySize number of frames used by statistics
+ */
+FrameProfiler::FrameProfiler(
+    size_t maxLatency ,
+    size_t historySize):FrameProfiler(nullptr,maxLatency,historySize){
+}
+
+/**
+ * @brief creates profiler
+ *
+ * @param table opengl function table
+ * @param maxLatency number of frames that GPU can be behind before frames are dropped
+ * @param historySize number of frames used by statistics
+ */
+FrameProfiler::FrameProfiler(
+    FunctionTablePointer const&table      ,
+    size_t                     maxLatency ,
+    size_t                     historySize):_gl(table),_maxLatency(maxLatency),_historySize(historySize){
+  assert(this!=nullptr);
+  assert(historySize>0);
+  this->_epoch = Clock::now();
+}
+
+/**
+ * @brief deletes all queries, pending frames are not resolved
+ */
+FrameProfiler::~FrameProfiler(){
+  assert(this!=nullptr);
+  for(auto const&f:this->_pending)this->_dropFrame(f);
+  for(auto const&s:this->_frame.scopes){
+    this->_freeQueries.push_back(s.begin);
+    if(s.end)this->_freeQueries.push_back(s.end);
+  }
+  if(!this->_freeQueries.empty())
+    this->_gl.glDeleteQueries(GLsizei(this->_freeQueries.size()),this->_freeQueries.data());
+}
+
+uint64_t FrameProfiler::_now()const{
+  return uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now()-this->_epoch).count());
+}
+
+GLuint FrameProfiler::_allocateQuery(){
+  assert(this!=nullptr);
+  if(this->_freeQueries.empty()){
+    this->_freeQueries.resize(queryBatch);
+    this->_gl.glGenQueries(queryBatch,this->_freeQueries.data());
+    this->_nofQueries += queryBatch;
+  }
+  GLuint const query = this->_freeQueries.back();
+  this->_freeQueries.pop_back();
+  return query;
+}
+
+/**
+ * @brief begins frame, it resolves finished frames and it opens root scope "frame"
+ */
+void FrameProfiler::beginFrame(){
+  assert(this!=nullptr);
+  assert(!this->_inFrame);
+  this->_resolve();
+  this->_frameId++;
+  if(!this->_enabled)return;
+  this->_inFrame = true;
+  if(this->_frameId == 1 || (this->_calibrationPeriod && this->_frameId%this->_calibrationPeriod == 0)){
+    GLint64 gpu = 0;
+    this->_gl.glGetInteger64v(GL_TIMESTAMP,&gpu);
+    this->_offset = int64_t(gpu)-int64_t(this->_now());
+  }
+  this->_frame.id     = this->_frameId;
+  this->_frame.offset = this->_offset;
+  this->_frame.scopes.clear();
+  this->_stack.clear();
+  this->begin("frame");
+}
+
+/**
+ * @brief ends frame, all scopes have to be ended
+ */
+void FrameProfiler::endFrame(){
+  assert(this!=nullptr);
+  if(!this->_inFrame)return;
+  this->end();
+  assert(this->_stack.empty());
+  this->_inFrame = false;
+  this->_pending.push_back(std::move(this->_frame));
+  this->_frame = PendingFrame();
+}
+
+/**
+ * @brief begins nested scope
+ *
+ * @param name name of scope, it should not contain '/'
+ */
+void FrameProfiler::begin(std::string const&name){
+  assert(this!=nullptr);
+  if(!this->_inFrame)return;
+  PendingScope scope;
+  scope.name     = this->_stack.empty()?name:this->_frame.scopes[this->_stack.back()].name+"/"+name;
+  scope.depth    = this->_stack.size();
+  scope.begin    = this->_allocateQuery();
+  scope.end      = 0;
+  scope.cpuEnd   = 0;
+  this->_gl.glQueryCounter(scope.begin,GL_TIMESTAMP);
+  scope.cpuBegin = this->_now();
+  this->_stack.push_back(this->_frame.scopes.size());
+  this->_frame.scopes.push_back(std::move(scope));
+}
+
+/**
+ * @brief ends the innermost scope
+ */
+void FrameProfiler::end(){
+  assert(this!=nullptr);
+  if(!this->_inFrame)return;
+  assert(!this->_stack.empty());
+  auto&scope = this->_frame.scopes[this->_stack.back()];
+  this->_stack.pop_back();
+  scope.cpuEnd = this->_now();
+  scope.end    = this->_allocateQuery();
+  this->_gl.glQueryCounter(scope.end,GL_TIMESTAMP);
+}
+
+/**
+ * @brief resolves pending frames whose queries are available
+ * Queries finish in order, so the frame is resolved when the end of its root scope is available.
+ */
+void FrameProfiler::_resolve(){
+  assert(this!=nullptr);
+  while(!this->_pending.empty()){
+    auto const&frame = this->_pending.front();
+    GLuint available = GL_FALSE;
+    this->_gl.glGetQueryObjectuiv(frame.scopes.front().end,GL_QUERY_RESULT_AVAILABLE,&available);
+    if(available)
+      this->_resolveFrame(frame);
+    else if(this->_pending.size()>this->_maxLatency)
+      this->_dropFrame(frame);
+    else break;
+    this->_pending.pop_front();
+  }
+}
+
+void FrameProfiler::_resolveFrame(PendingFrame const&frame){
+  assert(this!=nullptr);
+  auto const toCpu = [&](GLuint64 gpu){
+    return uint64_t(std::max<int64_t>(int64_t(gpu)-frame.offset,0));
+  };
+  auto const push = [&](std::deque<uint64_t>&samples,uint64_t value){
+    samples.push_back(value);
+    if(samples.size()>this->_historySize)samples.pop_front();
+  };
+  this->_timeline.clear();
+  for(auto const&s:frame.scopes){
+    GLuint64 begin = 0;
+    GLuint64 end   = 0;
+    this->_gl.glGetQueryObjectui64v(s.begin,GL_QUERY_RESULT,&begin);
+    this->_gl.glGetQueryObjectui64v(s.end  ,GL_QUERY_RESULT,&end  );
+    this->_freeQueries.push_back(s.begin);
+    this->_freeQueries.push_back(s.end  );
+    Event event;
+    event.name     = s.name;
+    event.depth    = s.depth;
+    event.cpuBegin = s.cpuBegin;
+    event.cpuEnd   = s.cpuEnd;
+    event.gpuBegin = toCpu(begin);
+    event.gpuEnd   = std::max(toCpu(end),event.gpuBegin);
+    auto&history = this->_history[s.name];
+    push(history.cpu,event.cpuEnd-event.cpuBegin);
+    push(history.gpu,event.gpuEnd-event.gpuBegin);
+    this->_timeline.push_back(std::move(event));
+  }
+  this->_nofResolved++;
+}
+
+/**
+ * @brief drops frame that GPU has not finished yet
+ * Its queries are deleted, they are still in use.
+ */
+void FrameProfiler::_dropFrame(PendingFrame const&frame){
+  assert(this!=nullptr);
+  std::vector<GLuint>queries;
+  for(auto const&s:frame.scopes){
+    queries.push_back(s.begin);
+    queries.push_back(s.end  );
+  }
+  this->_gl.glDeleteQueries(GLsizei(queries.size()),queries.data());
+  this->_nofQueries -= queries.size();
+  this->_nofDropped++;
+}
+
+/**
+ * @brief enables or disables profiling, disabled profiler does not record frames
+ * Pending frames are still resolved.
+ *
+ * @param enable enable profiling
+ */
+void FrameProfiler::setEnabled(bool enable){
+  assert(this!=nullptr);
+  assert(!this->_inFrame);
+  this->_enabled = enable;
+}
+
+bool FrameProfiler::isEnabled()const{
+  assert(this!=nullptr);
+  return this->_enabled;
+}
+
+/**
+ * @brief sets how often the GPU clock is sampled for the combined timeline
+ * Sampling of GPU clock is a round trip to the driver.
+ *
+ * @param frames period in frames, 0 samples only the first frame
+ */
+void FrameProfiler::setCalibrationPeriod(size_t frames){
+  assert(this!=nullptr);
+  this->_calibrationPeriod = frames;
+}
+
+size_t FrameProfiler::getCalibrationPeriod()const{
+  assert(this!=nullptr);
+  return this->_calibrationPeriod;
+}
+
+/**
+ * @brief gets paths of all scopes that have statistics
+ *
+ * @return sorted paths of scopes
+ */
+std::vector<std::string>FrameProfiler::getScopeNames()const{
+  assert(this!=nullptr);
+  std::vector<std::string>names;
+  for(auto const&x:this->_history)names.push_back(x.first);
+  return names;
+}
+
+FrameProfiler::Statistics FrameProfiler::_statistics(std::deque<uint64_t>const&samples){
+  Statistics result;
+  if(samples.empty())return result;
+  std::vector<uint64_t>sorted(samples.begin(),samples.end());
+  std::sort(sorted.begin(),sorted.end());
+  uint64_t sum = 0;
+  for(auto const&x:sorted)sum += x;
+  result.samples = sorted.size();
+  result.min     = sorted.front();
+  result.max     = sorted.back();
+  result.avg     = sum/sorted.size();
+  result.p99     = sorted[(sorted.size()*99+99)/100-1];
+  result.last    = samples.back();
+  return result;
+}
+
+/**
+ * @brief gets CPU statistics of scope
+ *
+ * @param name path of scope (for example "frame/render")
+ *
+ * @return statistics, empty if the scope has not been resolved
+ */
+FrameProfiler::Statistics FrameProfiler::getCpuStatistics(std::string const&name)const{
+  assert(this!=nullptr);
+  auto const ii = this->_history.find(name);
+  if(ii == this->_history.end())return Statistics();
+  return _statistics(ii->second.cpu);
+}
+
+/**
+ * @brief gets GPU statistics of scope
+ *
+ * @param name path of scope (for example "frame/render")
+ *
+ * @return statistics, empty if the scope has not been resolved
+ */
+FrameProfiler::Statistics FrameProfiler::getGpuStatistics(std::string const&name)const{
+  assert(this!=nullptr);
+  auto const ii = this->_history.find(name);
+  if(ii == this->_history.end())return Statistics();
+  return _statistics(ii->second.gpu);
+}
+
+/**
+ * @brief gets scopes of the last resolved frame in order of their beginning
+ *
+ * @return timeline
+ */
+std::vector<FrameProfiler::Event>const&FrameProfiler::getTimeline()const{
+  assert(this!=nullptr);
+  return this->_timeline;
+}
+
+uint64_t FrameProfiler::getFrameId()const{
+  assert(this!=nullptr);
+  return this->_frameId;
+}
+
+uint64_t FrameProfiler::getNofResolvedFrames()const{
+  assert(this!=nullptr);
+  return this->_nofResolved;
+}
+
+uint64_t FrameProfiler::getNofDroppedFrames()const{
+  assert(this!=nullptr);
+  return this->_nofDropped;
+}
+
+size_t FrameProfiler::getNofPendingFrames()const{
+  assert(this!=nullptr);
+  return this->_pending.size();
+}
+
+/**
+ * @brief gets number of query objects owned by the pool
+ *
+ * @return number of queries
+ */
+size_t FrameProfiler::getNofQueries()const{
+  assert(this!=nullptr);
+  return this->_nofQueries;
+}
+
+/**
+ * @brief writes timeline of the last resolved frame in Chrome trace format (chrome://tracing)
+ * CPU scopes are in thread 0, GPU scopes in thread 1.
+ *
+ * @param out output stream
+ */
+void FrameProfiler::writeChromeTrace(std::ostream&out)const{
+  assert(this!=nullptr);
+  auto const microseconds = [&](uint64_t ns){
+    return double(ns)/1000.;
+  };
+  auto const flags     = out.flags();
+  auto const precision = out.precision();
+  out<<std::fixed<<std::setprecision(3);
+  out<<"{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+  out<<"\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":0,\"args\":{\"name\":\"CPU\"}}";
+  out<<",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":1,\"args\":{\"name\":\"GPU\"}}";
+  for(auto const&e:this->_timeline){
+    out<<",\n{\"name\":\""<<e.name<<"\",\"cat\":\"cpu\",\"ph\":\"X\",\"pid\":0,\"tid\":0";
+    out<<",\"ts\":"<<microseconds(e.cpuBegin)<<",\"dur\":"<<microseconds(e.cpuEnd-e.cpuBegin)<<"}";
+    out<<",\n{\"name\":\""<<e.name<<"\",\"cat\":\"gpu\",\"ph\":\"X\",\"pid\":0,\"tid\":1";
+    out<<",\"ts\":"<<microseconds(e.gpuBegin)<<",\"dur\":"<<microseconds(e.gpuEnd-e.gpuBegin)<<"}";
+  }
+  out<<"\n]}\n";
+  out.flags(flags);
+  out.precision(precision);
+}
+
+/**
+ * @brief begins scope
+ *
+ * @param profiler profiler
+ * @param name name of scope
+ */
+FrameProfiler::Scope::Scope(FrameProfiler&profiler,std::string const&name):_profiler(profiler){
+  assert(this!=nullptr);
+  this->_profiler.begin(name);
+}
+
+/**
+ * @brief ends scope
+ */
+FrameProfiler::Scope::~Scope(){
+  assert(this!=nullptr);
+  this->_profiler.end();
+}
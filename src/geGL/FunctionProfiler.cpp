@@ -0,0 +1,250 @@
+#include<geGL/FunctionProfiler.h>
+#include<algorithm>
+#include<cassert>
+#include<iomanip>
+
+using namespace ge::gl;
+
+size_t const FunctionProfiler::nofHistogramBuckets;
+size_t const FunctionProfiler::noFunction;
+
+FunctionProfiler::FunctionProfiler(){
+  assert(this!=nullptr);
+  this->reset();
+}
+
+/**
+ * @brief sets profiled functions
+ * It is called by ProfilingTableDecorator, statistics are reset.
+ *
+ * @param nofFunctions number of functions
+ * @param name function that returns name of function with given id
+ */
+void FunctionProfiler::setFunctions(size_t nofFunctions,FunctionName const&name){
+  assert(this!=nullptr);
+  this->_functionName = name;
+  this->_statistics     .assign(nofFunctions,Statistics());
+  this->_frameStatistics.assign(nofFunctions,Statistics());
+  this->reset();
+}
+
+size_t FunctionProfiler::getNofFunctions()const{
+  assert(this!=nullptr);
+  return this->_statistics.size();
+}
+
+char const*FunctionProfiler::getFunctionName(size_t id)const{
+  assert(this!=nullptr);
+  assert(id<this->getNofFunctions());
+  return this->_functionName(id);
+}
+
+/**
+ * @brief finds id of function
+ *
+ * @param name name of function (glDrawArrays, ...)
+ *
+ * @return id of function or noFunction
+ */
+size_t FunctionProfiler::findFunction(std::string const&name)const{
+  assert(this!=nullptr);
+  for(size_t i=0;i<this->getNofFunctions();++i)
+    if(name == this->getFunctionName(i))return i;
+  return noFunction;
+}
+
+/**
+ * @brief enables measurement of time spent in functions
+ * When it is disabled, only number of calls is counted.
+ *
+ * @param enable true for enabling
+ */
+void FunctionProfiler::setTimingEnabled(bool enable){
+  assert(this!=nullptr);
+  this->_timing = enable;
+}
+
+bool FunctionProfiler::isTimingEnabled()const{
+  assert(this!=nullptr);
+  return this->_timing;
+}
+
+/**
+ * @brief sets how often calls are timed
+ * Every period-th call of each function is timed, other calls are only counted.
+ *
+ * @param period power of two, 1 times every call
+ */
+void FunctionProfiler::setTimingPeriod(size_t period){
+  assert(this!=nullptr);
+  assert(period>0 && (period&(period-1))==0);
+  this->_timingMask = uint64_t(period-1);
+}
+
+size_t FunctionProfiler::getTimingPeriod()const{
+  assert(this!=nullptr);
+  return size_t(this->_timingMask+1);
+}
+
+/**
+ * @brief enables recording of individual calls and frames for trace export
+ * Only timed calls are recorded, timing period should be 1 for complete trace.
+ *
+ * @param enable true for enabling
+ * @param maxEvents maximal number of recorded calls, later calls are not recorded
+ */
+void FunctionProfiler::setTracingEnabled(bool enable,size_t maxEvents){
+  assert(this!=nullptr);
+  this->_tracing = enable;
+  this->_maxTraceEvents = maxEvents;
+  if(enable)this->_trace.reserve(std::min(maxEvents,size_t(1)<<16));
+}
+
+bool FunctionProfiler::isTracingEnabled()const{
+  assert(this!=nullptr);
+  return this->_tracing;
+}
+
+/**
+ * @brief clears all statistics, trace and frames
+ */
+void FunctionProfiler::reset(){
+  assert(this!=nullptr);
+  std::fill(this->_statistics     .begin(),this->_statistics     .end(),Statistics());
+  std::fill(this->_frameStatistics.begin(),this->_frameStatistics.end(),Statistics());
+  this->_frameFunctions.clear();
+  this->_trace         .clear();
+  this->_frames        .clear();
+  this->_frameId    = 0;
+  this->_frameCalls = 0;
+  this->_epoch      = Clock::now();
+  this->_frameStart = this->_epoch;
+}
+
+/**
+ * @brief starts new frame
+ * Frame statistics are cleared.
+ */
+void FunctionProfiler::beginFrame(){
+  assert(this!=nullptr);
+  for(auto const&id:this->_frameFunctions)
+    this->_frameStatistics[id] = Statistics();
+  this->_frameFunctions.clear();
+  this->_frameCalls = 0;
+  this->_frameStart = Clock::now();
+}
+
+/**
+ * @brief ends frame
+ * Frame statistics are kept until next beginFrame().
+ * If tracing is enabled, the frame is recorded.
+ */
+void FunctionProfiler::endFrame(){
+  assert(this!=nullptr);
+  if(this->_tracing)
+    this->_frames.push_back({this->_frameId,this->_frameStart,Clock::now()-this->_frameStart,this->_frameCalls});
+  this->_frameId++;
+}
+
+uint64_t FunctionProfiler::getFrameId()const{
+  assert(this!=nullptr);
+  return this->_frameId;
+}
+
+FunctionProfiler::Statistics const&FunctionProfiler::getStatistics(size_t id)const{
+  assert(this!=nullptr);
+  assert(id<this->getNofFunctions());
+  return this->_statistics[id];
+}
+
+FunctionProfiler::Statistics const&FunctionProfiler::getFrameStatistics(size_t id)const{
+  assert(this!=nullptr);
+  assert(id<this->getNofFunctions());
+  return this->_frameStatistics[id];
+}
+
+std::vector<FunctionProfiler::TraceEvent>const&FunctionProfiler::getTrace()const{
+  assert(this!=nullptr);
+  return this->_trace;
+}
+
+std::vector<FunctionProfiler::Frame>const&FunctionProfiler::getFrames()const{
+  assert(this!=nullptr);
+  return this->_frames;
+}
+
+void FunctionProfiler::_writeStatistics(std::ostream&out,std::vector<Statistics>const&statistics)const{
+  assert(this!=nullptr);
+  std::vector<size_t>ids;
+  for(size_t i=0;i<statistics.size();++i)
+    if(statistics[i].calls)ids.push_back(i);
+  std::sort(ids.begin(),ids.end(),[&](size_t a,size_t b){
+      if(statistics[a].time != statistics[b].time)return statistics[a].time > statistics[b].time;
+      return statistics[a].calls > statistics[b].calls;});
+  out<<"[";
+  for(size_t i=0;i<ids.size();++i){
+    auto const&s = statistics[ids[i]];
+    out<<(i?",":"")<<"\n    {\"name\":\""<<this->getFunctionName(ids[i])<<"\"";
+    out<<",\"calls\":"<<s.calls<<",\"timedCalls\":"<<s.timedCalls<<",\"time\":"<<s.time<<",\"maxTime\":"<<s.maxTime;
+    out<<",\"histogram\":[";
+    for(size_t b=0;b<nofHistogramBuckets;++b)
+      out<<(b?",":"")<<s.histogram[b];
+    out<<"]}";
+  }
+  out<<"]";
+}
+
+/**
+ * @brief writes statistics in JSON
+ * Functions are sorted by time, times are in nanoseconds.
+ * Time, maxTime and histogram include only timed calls.
+ *
+ * @param out output stream
+ */
+void FunctionProfiler::writeJSON(std::ostream&out)const{
+  assert(this!=nullptr);
+  out<<"{\n  \"timing\":"<<(this->_timing?"true":"false")<<",\n";
+  out<<"  \"timingPeriod\":"<<this->getTimingPeriod()<<",\n";
+  out<<"  \"histogramBucketStart\":[0";
+  for(size_t b=1;b<nofHistogramBuckets;++b)
+    out<<","<<(uint64_t(32)<<b);
+  out<<"],\n";
+  out<<"  \"functions\":";
+  this->_writeStatistics(out,this->_statistics);
+  out<<",\n  \"frame\":"<<this->_frameId<<",\n";
+  out<<"  \"frameFunctions\":";
+  this->_writeStatistics(out,this->_frameStatistics);
+  out<<"\n}\n";
+}
+
+/**
+ * @brief writes recorded frames and calls in Chrome trace event format
+ * The output can be loaded into chrome://tracing or Perfetto.
+ *
+ * @param out output stream
+ */
+void FunctionProfiler::writeChromeTrace(std::ostream&out)const{
+  assert(this!=nullptr);
+  auto const microseconds = [&](Clock::duration const&d){
+    return std::chrono::duration<double,std::micro>(d).count();
+  };
+  auto const flags     = out.flags();
+  auto const precision = out.precision();
+  out<<std::fixed<<std::setprecision(3);
+  out<<"{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+  bool first = true;
+  for(auto const&f:this->_frames){
+    out<<(first?"":",")<<"\n{\"name\":\"frame "<<f.id<<"\",\"cat\":\"frame\",\"ph\":\"X\",\"pid\":0,\"tid\":0";
+    out<<",\"ts\":"<<microseconds(f.start-this->_epoch)<<",\"dur\":"<<microseconds(f.duration);
+    out<<",\"args\":{\"calls\":"<<f.calls<<"}}";
+    first = false;
+  }
+  for(auto const&e:this->_trace){
+    out<<(first?"":",")<<"\n{\"name\":\""<<this->getFunctionName(e.function)<<"\",\"cat\":\"gl\",\"ph\":\"X\",\"pid\":0,\"tid\":0";
+    out<<",\"ts\":"<<microseconds(e.start-this->_epoch)<<",\"dur\":"<<microseconds(e.duration)<<"}";
+    first = false;
+  }
+  out<<"\n]}\n";
+  out.flags(flags);
+  out.precision(precision);
+}
@@ -0,0 +1,1838 @@
+#include<geGL/NullLoader.h>
+#include<geGL/CallRecorder.h>
+#include<geGL/OpenGLUtil.h>
+#include<algorithm>
+#include<cassert>
+#include<cctype>
+#include<chrono>
+#include<cstdlib>
+#include<cstring>
+#include<map>
+#include<set>
+#include<string>
+#include<type_traits>
+#include<unordered_map>
+#include<utility>
+#include<vector>
+
+using namespace ge::gl;
+
+namespace{
+  struct NullBuffer{
+    std::vector<uint8_t>data              ;
+    GLenum              usage     = GL_STATIC_DRAW;
+    GLbitfield          flags     = 0     ;
+    GLboolean           immutable = GL_FALSE;
+    GLbitfield          access    = 0     ;///< access of mapping, 0 if the buffer is not mapped
+    GLintptr            mapOffset = 0     ;
+    GLsizeiptr          mapLength = 0     ;
+  };
+  struct NullAttrib{
+    GLint  enabled        = GL_FALSE;
+    GLint  size           = 4       ;
+    GLint  type           = GL_FLOAT;
+    GLint  normalized     = GL_FALSE;
+    GLint  integer        = GL_FALSE;
+    GLint  isLong         = GL_FALSE;
+    GLint  relativeOffset = 0       ;
+    GLuint binding        = 0       ;
+  };
+  struct NullVertexBinding{
+    GLuint   buffer  = 0;
+    GLintptr offset  = 0;
+    GLsizei  stride  = 16;
+    GLuint   divisor = 0;
+  };
+  struct NullVertexArray{
+    GLuint                             elementBuffer = 0;
+    std::map<GLuint,NullAttrib       > attribs          ;
+    std::map<GLuint,NullVertexBinding> bindings         ;
+    NullAttrib&attrib(GLuint index){
+      auto ii = this->attribs.find(index);
+      if(ii != this->attribs.end())return ii->second;
+      auto&a = this->attribs[index];
+      a.binding = index;
+      return a;
+    }
+  };
+  struct NullShader{
+    GLenum      type     = 0;
+    std::string source      ;
+    GLboolean   compiled = GL_FALSE;
+    GLuint      pending  = 0       ;///< number of GL_COMPLETION_STATUS_ARB queries that report unfinished compilation
+  };
+  /**
+   * @brief active resource of program (uniform, input, storage block or buffer variable)
+   */
+  struct NullResource{
+    std::string     name          ;
+    GLenum          type     = 0  ;
+    GLint           size     = 1  ;
+    GLint           location = -1 ;
+    GLint           binding  = 0  ;
+    GLint           members  = 0  ;
+    std::set<GLenum>stages        ;
+  };
+  struct NullProgram{
+    std::set<GLuint>         shaders                    ;
+    GLboolean                linked        = GL_FALSE   ;
+    std::vector<NullResource>uniforms                   ;
+    std::vector<NullResource>inputs                     ;
+    std::vector<NullResource>storageBlocks              ;
+    std::vector<NullResource>bufferVariables            ;
+    GLint                    workGroupSize[3] = {1,1,1} ;
+    std::vector<std::pair<GLenum,std::string>>sources   ;///< linked shaders, they form program binary
+    GLuint                   pending       = 0          ;///< number of GL_COMPLETION_STATUS_ARB queries that report unfinished linking
+  };
+  struct NullTextureLevel{
+    GLint width  = 0;
+    GLint height = 0;
+    GLint depth  = 0;
+  };
+  struct NullTexture{
+    GLenum                         target         = 0       ;
+    GLenum                         internalFormat = GL_RGBA ;
+    GLint                          immutable      = GL_FALSE;
+    GLint                          nofLevels      = 0       ;
+    std::map<GLint,NullTextureLevel>levels                  ;
+    std::map<GLenum,GLint>          parameters              ;
+  };
+  struct NullQuery{
+    GLenum   target  = 0;
+    GLuint64 begin   = 0;
+    GLuint64 result  = 0;
+    GLuint   pending = 0;///< number of GL_QUERY_RESULT_AVAILABLE queries that report unavailable result
+  };
+}
+
+namespace{
+  GLenum const nullBinaryFormat = 0x4e4c;///< format of emulated program binaries
+  char   const*const extensions[] = {
+    "GL_ARB_parallel_shader_compile",
+    "GL_KHR_parallel_shader_compile",
+  };
+}
+
+/**
+ * @brief emulated OpenGL context
+ */
+struct NullLoader::State{
+  GLuint                                     nextName = 1;
+  std::map<GLuint,GLenum>                    objects        ;///< name -> kind of object (GL_BUFFER, GL_TEXTURE, ...)
+  std::map<GLuint,NullBuffer>                buffers        ;
+  std::map<GLuint,NullVertexArray>           vertexArrays   ;
+  std::map<GLuint,NullShader>                shaders        ;
+  std::map<GLuint,NullProgram>               programs       ;
+  std::map<GLuint,NullTexture>               textures       ;
+  std::map<GLuint,NullQuery>                 queries        ;
+  std::set<GLsync>                           syncs          ;
+  std::map<GLenum,GLuint>                    activeQueries  ;
+  std::map<GLenum,GLint64>                   integers       ;///< limits and bindings
+  std::map<std::pair<GLenum,GLuint>,GLint64> indexedIntegers;///< indexed limits and bindings
+  std::map<std::pair<GLuint,GLenum>,GLuint>  textureUnits   ;///< (unit,texture binding) -> texture
+  std::set<GLenum>                           enabled        ;
+  GLint                                      viewport[4] = {0,0,1,1};
+  GLint                                      scissor [4] = {0,0,1,1};
+  GLuint                                     compileLatency = 0;///< see NullLoader::setCompileLatency
+  GLuint                                     queryLatency   = 0;///< see NullLoader::setQueryLatency
+  State(){
+    this->vertexArrays[0];
+    this->enabled.insert(GL_DITHER     );
+    this->enabled.insert(GL_MULTISAMPLE);
+    auto&i = this->integers;
+    i[GL_MAJOR_VERSION                          ] = 4;
+    i[GL_MINOR_VERSION                          ] = 5;
+    i[GL_CONTEXT_PROFILE_MASK                   ] = GL_CONTEXT_CORE_PROFILE_BIT;
+    i[GL_NUM_EXTENSIONS                         ] = GLint64(sizeof(extensions)/sizeof(extensions[0]));
+    i[GL_ACTIVE_TEXTURE                         ] = GL_TEXTURE0;
+    i[GL_UNPACK_ALIGNMENT                       ] = 4;
+    i[GL_PACK_ALIGNMENT                         ] = 4;
+    i[GL_MAX_VERTEX_ATTRIBS                     ] = 16;
+    i[GL_MAX_VERTEX_ATTRIB_BINDINGS             ] = 16;
+    i[GL_MAX_VERTEX_ATTRIB_RELATIVE_OFFSET      ] = 2047;
+    i[GL_MAX_TEXTURE_SIZE                       ] = 16384;
+    i[GL_MAX_3D_TEXTURE_SIZE                    ] = 2048;
+    i[GL_MAX_CUBE_MAP_TEXTURE_SIZE              ] = 16384;
+    i[GL_MAX_ARRAY_TEXTURE_LAYERS               ] = 2048;
+    i[GL_MAX_TEXTURE_IMAGE_UNITS                ] = 32;
+    i[GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS       ] = 192;
+    i[GL_MAX_IMAGE_UNITS                        ] = 8;
+    i[GL_MAX_SHADER_COMPILER_THREADS_ARB        ] = 0xffffffff;
+    i[GL_MAX_TEXTURE_BUFFER_SIZE                ] = 134217728;
+    i[GL_MAX_RENDERBUFFER_SIZE                  ] = 16384;
+    i[GL_MAX_COLOR_ATTACHMENTS                  ] = 8;
+    i[GL_MAX_DRAW_BUFFERS                       ] = 8;
+    i[GL_MAX_SAMPLES                            ] = 8;
+    i[GL_MAX_VIEWPORTS                          ] = 16;
+    i[GL_MAX_UNIFORM_BUFFER_BINDINGS            ] = 84;
+    i[GL_MAX_UNIFORM_BLOCK_SIZE                 ] = 65536;
+    i[GL_MAX_UNIFORM_LOCATIONS                  ] = 4096;
+    i[GL_MAX_SHADER_STORAGE_BUFFER_BINDINGS     ] = 96;
+    i[GL_MAX_SHADER_STORAGE_BLOCK_SIZE          ] = 134217728;
+    i[GL_MAX_ATOMIC_COUNTER_BUFFER_BINDINGS     ] = 8;
+    i[GL_MAX_TRANSFORM_FEEDBACK_BUFFERS         ] = 4;
+    i[GL_MAX_COMPUTE_WORK_GROUP_INVOCATIONS     ] = 1024;
+    i[GL_MAX_COMPUTE_SHARED_MEMORY_SIZE         ] = 49152;
+    i[GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT        ] = 256;
+    i[GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT ] = 16;
+    i[GL_TEXTURE_BUFFER_OFFSET_ALIGNMENT        ] = 16;
+    i[GL_MIN_MAP_BUFFER_ALIGNMENT               ] = 64;
+    i[GL_MAX_ELEMENTS_VERTICES                  ] = 1048576;
+    i[GL_MAX_ELEMENTS_INDICES                   ] = 1048576;
+    i[GL_MAX_LABEL_LENGTH                       ] = 256;
+    i[GL_MAX_DEBUG_MESSAGE_LENGTH               ] = 1024;
+    i[GL_MAX_SERVER_WAIT_TIMEOUT                ] = 0x7fffffff;
+    i[GL_QUERY_COUNTER_BITS                     ] = 64;
+    i[GL_NUM_PROGRAM_BINARY_FORMATS             ] = 1;
+    i[GL_PROGRAM_BINARY_FORMATS                 ] = nullBinaryFormat;
+    auto&x = this->indexedIntegers;
+    x[std::make_pair(GLenum(GL_MAX_COMPUTE_WORK_GROUP_COUNT),0u)] = 65535;
+    x[std::make_pair(GLenum(GL_MAX_COMPUTE_WORK_GROUP_COUNT),1u)] = 65535;
+    x[std::make_pair(GLenum(GL_MAX_COMPUTE_WORK_GROUP_COUNT),2u)] = 65535;
+    x[std::make_pair(GLenum(GL_MAX_COMPUTE_WORK_GROUP_SIZE ),0u)] = 1024;
+    x[std::make_pair(GLenum(GL_MAX_COMPUTE_WORK_GROUP_SIZE ),1u)] = 1024;
+    x[std::make_pair(GLenum(GL_MAX_COMPUTE_WORK_GROUP_SIZE ),2u)] = 64;
+  }
+};
+
+namespace{
+#include<geGL/Generated/NullImplementation.h>
+
+  thread_local std::shared_ptr<NullLoader::State>current = nullptr;
+
+  NullLoader::State&state(){
+    assert(current!=nullptr);
+    return *current;
+  }
+
+  GLuint64 now(){
+    return GLuint64(std::chrono::duration_cast<std::chrono::nanoseconds>(
+          std::chrono::steady_clock::now().time_since_epoch()).count());
+  }
+
+  template<typename T>
+    typename T::mapped_type*find(T&objects,GLuint name){
+      auto ii = objects.find(name);
+      if(ii == objects.end())return nullptr;
+      return &ii->second;
+    }
+
+  GLenum bufferBinding(GLenum target){
+    if(target == GL_PARAMETER_BUFFER_ARB)return GL_PARAMETER_BUFFER_BINDING_ARB;
+    GLenum const binding = bufferTarget2Binding(target);
+    return binding?binding:target;
+  }
+
+  GLenum textureTarget(GLenum target){
+    if(target>=GL_TEXTURE_CUBE_MAP_POSITIVE_X && target<=GL_TEXTURE_CUBE_MAP_NEGATIVE_Z)
+      return GL_TEXTURE_CUBE_MAP;
+    return target;
+  }
+
+  GLuint activeTextureUnit(NullLoader::State&s){
+    return GLuint(s.integers[GL_ACTIVE_TEXTURE]-GL_TEXTURE0);
+  }
+
+  NullVertexArray&currentVertexArray(NullLoader::State&s){
+    return s.vertexArrays[GLuint(s.integers[GL_VERTEX_ARRAY_BINDING])];
+  }
+
+  GLint64 getInteger(NullLoader::State&s,GLenum pname){
+    if(pname == GL_ELEMENT_ARRAY_BUFFER_BINDING)return currentVertexArray(s).elementBuffer;
+    if(pname == GL_TIMESTAMP)return GLint64(now());
+    if(s.enabled.count(pname))return GL_TRUE;
+    if(textureBinding2Target(pname) != 0){
+      auto ii = s.textureUnits.find(std::make_pair(activeTextureUnit(s),pname));
+      return ii == s.textureUnits.end()?0:ii->second;
+    }
+    auto ii = s.integers.find(pname);
+    return ii == s.integers.end()?0:ii->second;
+  }
+
+  template<typename T>
+    void getValues(GLenum pname,T*data){
+      if(!data)return;
+      auto&s = state();
+      if(pname == GL_VIEWPORT || pname == GL_SCISSOR_BOX){
+        GLint const*values = pname == GL_VIEWPORT?s.viewport:s.scissor;
+        for(size_t i=0;i<4;++i)data[i] = T(values[i]);
+        return;
+      }
+      *data = T(getInteger(s,pname));
+    }
+
+  template<typename T>
+    void getIndexedValues(GLenum target,GLuint index,T*data){
+      if(!data)return;
+      auto&s = state();
+      auto ii = s.indexedIntegers.find(std::make_pair(target,index));
+      *data = ii == s.indexedIntegers.end()?T(0):T(ii->second);
+    }
+
+  void createObjects(GLenum kind,GLsizei n,GLuint*names){
+    auto&s = state();
+    for(GLsizei i=0;i<n;++i){
+      GLuint const name = s.nextName++;
+      s.objects[name] = kind;
+      switch(kind){
+        case GL_BUFFER      :s.buffers     [name];break;
+        case GL_VERTEX_ARRAY:s.vertexArrays[name];break;
+        case GL_TEXTURE     :s.textures    [name];break;
+        case GL_QUERY       :s.queries     [name];break;
+      }
+      if(names)names[i] = name;
+    }
+  }
+
+  void deleteObjects(GLenum kind,GLsizei n,GLuint const*names){
+    if(!names)return;
+    auto&s = state();
+    for(GLsizei i=0;i<n;++i){
+      GLuint const name = names[i];
+      auto ii = s.objects.find(name);
+      if(ii == s.objects.end() || ii->second != kind)continue;
+      s.objects.erase(ii);
+      switch(kind){
+        case GL_BUFFER      :s.buffers     .erase(name);break;
+        case GL_VERTEX_ARRAY:s.vertexArrays.erase(name);break;
+        case GL_TEXTURE     :s.textures    .erase(name);break;
+        case GL_QUERY       :s.queries     .erase(name);break;
+      }
+    }
+  }
+
+  GLboolean isObject(GLenum kind,GLuint name){
+    auto&s = state();
+    auto ii = s.objects.find(name);
+    return ii != s.objects.end() && ii->second == kind;
+  }
+
+  //parsing of shader declarations for reflection
+  std::vector<std::string>tokenize(std::string const&source){
+    std::vector<std::string>tokens;
+    size_t const n = source.size();
+    size_t i = 0;
+    while(i<n){
+      char const c = source[i];
+      if(std::isspace((unsigned char)c)){
+        ++i;
+        continue;
+      }
+      if(c == '/' && i+1<n && source[i+1] == '/'){
+        while(i<n && source[i] != '\n')++i;
+        continue;
+      }
+      if(c == '/' && i+1<n && source[i+1] == '*'){
+        size_t const end = source.find("*/",i+2);
+        i = end == std::string::npos?n:end+2;
+        continue;
+      }
+      if(c == '#'){
+        while(i<n && source[i] != '\n'){
+          if(source[i] == '\\')++i;
+          ++i;
+        }
+        continue;
+      }
+      if(std::isalnum((unsigned char)c) || c == '_'){
+        size_t const begin = i;
+        while(i<n && (std::isalnum((unsigned char)source[i]) || source[i] == '_'))++i;
+        tokens.push_back(source.substr(begin,i-begin));
+        continue;
+      }
+      tokens.push_back(std::string(1,c));
+      ++i;
+    }
+    return tokens;
+  }
+
+  GLenum glslType(std::string const&name){
+    static std::map<std::string,GLenum>const types = {
+      {"float"               ,GL_FLOAT                                   },
+      {"vec2"                ,GL_FLOAT_VEC2                              },
+      {"vec3"                ,GL_FLOAT_VEC3                              },
+      {"vec4"                ,GL_FLOAT_VEC4                              },
+      {"double"              ,GL_DOUBLE                                  },
+      {"dvec2"               ,GL_DOUBLE_VEC2                             },
+      {"dvec3"               ,GL_DOUBLE_VEC3                             },
+      {"dvec4"               ,GL_DOUBLE_VEC4                             },
+      {"int"                 ,GL_INT                                     },
+      {"ivec2"               ,GL_INT_VEC2                                },
+      {"ivec3"               ,GL_INT_VEC3                                },
+      {"ivec4"               ,GL_INT_VEC4                                },
+      {"uint"                ,GL_UNSIGNED_INT                            },
+      {"uvec2"               ,GL_UNSIGNED_INT_VEC2                       },
+      {"uvec3"               ,GL_UNSIGNED_INT_VEC3                       },
+      {"uvec4"               ,GL_UNSIGNED_INT_VEC4                       },
+      {"bool"                ,GL_BOOL                                    },
+      {"bvec2"               ,GL_BOOL_VEC2                               },
+      {"bvec3"               ,GL_BOOL_VEC3                               },
+      {"bvec4"               ,GL_BOOL_VEC4                               },
+      {"mat2"                ,GL_FLOAT_MAT2                              },
+      {"mat3"                ,GL_FLOAT_MAT3                              },
+      {"mat4"                ,GL_FLOAT_MAT4                              },
+      {"mat2x2"              ,GL_FLOAT_MAT2                              },
+      {"mat2x3"              ,GL_FLOAT_MAT2x3                            },
+      {"mat2x4"              ,GL_FLOAT_MAT2x4                            },
+      {"mat3x2"              ,GL_FLOAT_MAT3x2                            },
+      {"mat3x3"              ,GL_FLOAT_MAT3                              },
+      {"mat3x4"              ,GL_FLOAT_MAT3x4                            },
+      {"mat4x2"              ,GL_FLOAT_MAT4x2                            },
+      {"mat4x3"              ,GL_FLOAT_MAT4x3                            },
+      {"mat4x4"              ,GL_FLOAT_MAT4                              },
+      {"dmat2"               ,GL_DOUBLE_MAT2                             },
+      {"dmat3"               ,GL_DOUBLE_MAT3                             },
+      {"dmat4"               ,GL_DOUBLE_MAT4                             },
+      {"sampler1D"           ,GL_SAMPLER_1D                              },
+      {"sampler2D"           ,GL_SAMPLER_2D                              },
+      {"sampler3D"           ,GL_SAMPLER_3D                              },
+      {"samplerCube"         ,GL_SAMPLER_CUBE                            },
+      {"sampler1DArray"      ,GL_SAMPLER_1D_ARRAY                        },
+      {"sampler2DArray"      ,GL_SAMPLER_2D_ARRAY                        },
+      {"samplerCubeArray"    ,GL_SAMPLER_CUBE_MAP_ARRAY                  },
+      {"sampler2DRect"       ,GL_SAMPLER_2D_RECT                         },
+      {"samplerBuffer"       ,GL_SAMPLER_BUFFER                          },
+      {"sampler2DMS"         ,GL_SAMPLER_2D_MULTISAMPLE                  },
+      {"sampler2DShadow"     ,GL_SAMPLER_2D_SHADOW                       },
+      {"sampler2DArrayShadow",GL_SAMPLER_2D_ARRAY_SHADOW                 },
+      {"samplerCubeShadow"   ,GL_SAMPLER_CUBE_SHADOW                     },
+      {"isampler2D"          ,GL_INT_SAMPLER_2D                          },
+      {"isampler3D"          ,GL_INT_SAMPLER_3D                          },
+      {"isamplerBuffer"      ,GL_INT_SAMPLER_BUFFER                      },
+      {"usampler2D"          ,GL_UNSIGNED_INT_SAMPLER_2D                 },
+      {"usampler3D"          ,GL_UNSIGNED_INT_SAMPLER_3D                 },
+      {"usampler2DArray"     ,GL_UNSIGNED_INT_SAMPLER_2D_ARRAY           },
+      {"usamplerBuffer"      ,GL_UNSIGNED_INT_SAMPLER_BUFFER             },
+      {"image1D"             ,GL_IMAGE_1D                                },
+      {"image2D"             ,GL_IMAGE_2D                                },
+      {"image3D"             ,GL_IMAGE_3D                                },
+      {"image2DArray"        ,GL_IMAGE_2D_ARRAY                          },
+      {"imageBuffer"         ,GL_IMAGE_BUFFER                            },
+      {"iimage2D"            ,GL_INT_IMAGE_2D                            },
+      {"uimage2D"            ,GL_UNSIGNED_INT_IMAGE_2D                   },
+      {"uimage3D"            ,GL_UNSIGNED_INT_IMAGE_3D                   },
+      {"uimageBuffer"        ,GL_UNSIGNED_INT_IMAGE_BUFFER               },
+      {"atomic_uint"         ,GL_UNSIGNED_INT_ATOMIC_COUNTER             },
+    };
+    auto ii = types.find(name);
+    if(ii == types.end())return 0;
+    return ii->second;
+  }
+
+  GLint nofAttribLocations(GLenum type){
+    switch(type){
+      case GL_FLOAT_MAT2  :
+      case GL_FLOAT_MAT2x3:
+      case GL_FLOAT_MAT2x4:
+      case GL_DOUBLE_MAT2 :return 2;
+      case GL_FLOAT_MAT3  :
+      case GL_FLOAT_MAT3x2:
+      case GL_FLOAT_MAT3x4:
+      case GL_DOUBLE_MAT3 :return 3;
+      case GL_FLOAT_MAT4  :
+      case GL_FLOAT_MAT4x2:
+      case GL_FLOAT_MAT4x3:
+      case GL_DOUBLE_MAT4 :return 4;
+    }
+    return 1;
+  }
+
+  bool isQualifier(std::string const&token){
+    static std::set<std::string>const qualifiers = {
+      "uniform","in","out","buffer","const","shared","attribute","varying",
+      "flat","smooth","noperspective","centroid","sample","patch","invariant","precise",
+      "highp","mediump","lowp","coherent","volatile","restrict","readonly","writeonly"};
+    return qualifiers.count(token) != 0;
+  }
+
+  void addResource(std::vector<NullResource>&resources,NullResource const&resource,GLenum stage){
+    for(auto&r:resources)
+      if(r.name == resource.name){
+        r.stages.insert(stage);
+        return;
+      }
+    resources.push_back(resource);
+    resources.back().stages.insert(stage);
+  }
+
+  /**
+   * @brief parses global declarations of uniforms, vertex inputs and storage blocks
+   * It is not a GLSL parser, it only recognizes simple declarations
+   * (layout(...) qualifiers type name[size], ...;).
+   */
+  void parseShader(NullProgram&program,GLenum stage,std::string const&source){
+    auto const tokens = tokenize(source);
+    std::string const none;
+    auto const at = [&](size_t i)->std::string const&{return i<tokens.size()?tokens[i]:none;};
+    auto const skipTo = [&](size_t i,char const*token){
+      while(i<tokens.size() && tokens[i] != token)++i;
+      return i;
+    };
+    size_t i     = 0;
+    int    depth = 0;
+    while(i<tokens.size()){
+      if(at(i) == "{"){depth++;i++;continue;}
+      if(at(i) == "}"){depth--;i++;continue;}
+      if(depth>0){i++;continue;}
+      std::map<std::string,GLint>layout;
+      std::string storage;
+      while(i<tokens.size()){
+        if(at(i) == "layout" && at(i+1) == "("){
+          i+=2;
+          while(i<tokens.size() && at(i) != ")"){
+            std::string const key = at(i++);
+            GLint value = 0;
+            if(at(i) == "="){
+              value = GLint(std::strtol(at(i+1).c_str(),nullptr,0));
+              i+=2;
+            }
+            layout[key] = value;
+            if(at(i) == ",")i++;
+          }
+          i++;
+          continue;
+        }
+        if(isQualifier(at(i))){
+          if(at(i) == "uniform" || at(i) == "in" || at(i) == "buffer")storage = at(i);
+          i++;
+          continue;
+        }
+        break;
+      }
+      if(storage == "in" && at(i) == ";"){
+        if(layout.count("local_size_x"))program.workGroupSize[0] = layout["local_size_x"];
+        if(layout.count("local_size_y"))program.workGroupSize[1] = layout["local_size_y"];
+        if(layout.count("local_size_z"))program.workGroupSize[2] = layout["local_size_z"];
+        i++;
+        continue;
+      }
+      bool const uniform = storage == "uniform";
+      bool const input   = storage == "in" && stage == GL_VERTEX_SHADER;
+      if(storage == "buffer" && at(i+1) == "{"){
+        NullResource block;
+        block.name    = at(i);
+        block.type    = GL_SHADER_STORAGE_BLOCK;
+        block.binding = layout.count("binding")?layout["binding"]:0;
+        i+=2;
+        while(i<tokens.size() && at(i) != "}"){
+          while(isQualifier(at(i)))i++;
+          NullResource variable;
+          variable.type = glslType(at(i));
+          variable.name = at(i+1);
+          if(at(i+2) == "[")variable.size = at(i+3) == "]"?0:GLint(std::strtol(at(i+3).c_str(),nullptr,0));
+          addResource(program.bufferVariables,variable,stage);
+          block.members++;
+          i = skipTo(i,";")+1;
+        }
+        addResource(program.storageBlocks,block,stage);
+        i = skipTo(i,";")+1;
+        continue;
+      }
+      if((!uniform && !input) || glslType(at(i)) == 0){
+        while(i<tokens.size() && at(i) != ";" && at(i) != "{")i++;
+        if(at(i) == ";")i++;
+        continue;
+      }
+      GLenum const type = glslType(at(i++));
+      while(i<tokens.size()){
+        NullResource variable;
+        variable.name     = at(i++);
+        variable.type     = type;
+        variable.location = layout.count("location")?layout["location"]:-1;
+        if(at(i) == "["){
+          variable.size = GLint(std::strtol(at(i+1).c_str(),nullptr,0));
+          if(variable.size<1)variable.size = 1;
+          i = skipTo(i,"]")+1;
+        }
+        if(at(i) == "="){
+          int parenthesis = 0;
+          while(i<tokens.size()){
+            if(at(i) == "(")parenthesis++;
+            if(at(i) == ")")parenthesis--;
+            if(parenthesis == 0 && (at(i) == "," || at(i) == ";"))break;
+            i++;
+          }
+        }
+        addResource(uniform?program.uniforms:program.inputs,variable,stage);
+        layout.erase("location");
+        if(at(i) != ",")break;
+        i++;
+      }
+      i = skipTo(i,";")+1;
+    }
+  }
+
+  void assignLocations(std::vector<NullResource>&resources,bool attributes){
+    std::set<GLint>used;
+    auto const count = [&](NullResource const&r){
+      return attributes?r.size*nofAttribLocations(r.type):r.size;
+    };
+    for(auto const&r:resources)
+      if(r.location>=0)
+        for(GLint l=0;l<count(r);++l)used.insert(r.location+l);
+    GLint next = 0;
+    for(auto&r:resources){
+      if(r.location>=0)continue;
+      auto const isFree = [&](GLint location){
+        for(GLint l=0;l<count(r);++l)
+          if(used.count(location+l))return false;
+        return true;
+      };
+      while(!isFree(next))next++;
+      r.location = next;
+      for(GLint l=0;l<count(r);++l)used.insert(next+l);
+    }
+  }
+
+  std::string resourceName(NullResource const&resource){
+    if(resource.size>1 && resource.type != GL_SHADER_STORAGE_BLOCK)return resource.name+"[0]";
+    return resource.name;
+  }
+
+  std::vector<NullResource>*programResources(GLuint program,GLenum programInterface){
+    auto p = find(state().programs,program);
+    if(!p)return nullptr;
+    switch(programInterface){
+      case GL_UNIFORM             :return &p->uniforms       ;
+      case GL_PROGRAM_INPUT       :return &p->inputs         ;
+      case GL_SHADER_STORAGE_BLOCK:return &p->storageBlocks  ;
+      case GL_BUFFER_VARIABLE     :return &p->bufferVariables;
+    }
+    return nullptr;
+  }
+
+  GLint maxNameLength(std::vector<NullResource>const&resources){
+    size_t length = 0;
+    for(auto const&r:resources)length = std::max(length,resourceName(r).size()+1);
+    return GLint(length);
+  }
+
+  GLint resourceLocation(std::vector<NullResource>const*resources,GLchar const*name){
+    if(!resources||!name)return -1;
+    std::string base = name;
+    GLint element = 0;
+    size_t const bracket = base.find('[');
+    if(bracket != std::string::npos){
+      element = GLint(std::strtol(base.c_str()+bracket+1,nullptr,10));
+      base    = base.substr(0,bracket);
+    }
+    for(auto const&r:*resources)
+      if(r.name == base){
+        if(element<0 || element>=r.size)return -1;
+        return r.location+element;
+      }
+    return -1;
+  }
+
+  void writeString(std::string const&string,GLsizei bufSize,GLsizei*length,GLchar*buffer){
+    GLsizei const n = bufSize>0?std::min(GLsizei(string.size()),bufSize-1):0;
+    if(buffer && bufSize>0){
+      std::memcpy(buffer,string.c_str(),size_t(n));
+      buffer[n] = 0;
+    }
+    if(length)*length = n;
+  }
+
+  void textureStorage(GLuint texture,GLsizei levels,GLenum internalFormat,GLsizei width,GLsizei height,GLsizei depth){
+    auto t = find(state().textures,texture);
+    if(!t || t->immutable)return;
+    t->internalFormat = internalFormat;
+    t->immutable      = GL_TRUE;
+    t->nofLevels      = levels;
+    for(GLsizei l=0;l<levels;++l){
+      auto&level = t->levels[l];
+      level.width  = std::max(1,width>>l);
+      level.height = t->target == GL_TEXTURE_1D_ARRAY?height:std::max(1,height>>l);
+      level.depth  = t->target == GL_TEXTURE_3D?std::max(1,depth>>l):depth;
+    }
+  }
+
+  void textureImage(GLuint texture,GLint level,GLint internalFormat,GLsizei width,GLsizei height,GLsizei depth){
+    auto t = find(state().textures,texture);
+    if(!t || t->immutable || level<0)return;
+    t->internalFormat = GLenum(internalFormat);
+    t->nofLevels      = std::max(t->nofLevels,level+1);
+    t->levels[level].width  = width ;
+    t->levels[level].height = height;
+    t->levels[level].depth  = depth ;
+  }
+
+  GLint textureParameter(GLuint texture,GLenum pname){
+    auto t = find(state().textures,texture);
+    if(!t)return 0;
+    switch(pname){
+      case GL_TEXTURE_TARGET          :return GLint(t->target);
+      case GL_TEXTURE_IMMUTABLE_FORMAT:return t->immutable;
+      case GL_TEXTURE_IMMUTABLE_LEVELS:
+      case GL_TEXTURE_VIEW_NUM_LEVELS :return t->immutable?t->nofLevels:0;
+    }
+    auto ii = t->parameters.find(pname);
+    if(ii != t->parameters.end())return ii->second;
+    switch(pname){
+      case GL_TEXTURE_MIN_FILTER:return GL_NEAREST_MIPMAP_LINEAR;
+      case GL_TEXTURE_MAG_FILTER:return GL_LINEAR;
+      case GL_TEXTURE_WRAP_S    :
+      case GL_TEXTURE_WRAP_T    :
+      case GL_TEXTURE_WRAP_R    :return GL_REPEAT;
+      case GL_TEXTURE_MAX_LEVEL :return 1000;
+      case GL_TEXTURE_SWIZZLE_R :return GL_RED;
+      case GL_TEXTURE_SWIZZLE_G :return GL_GREEN;
+      case GL_TEXTURE_SWIZZLE_B :return GL_BLUE;
+      case GL_TEXTURE_SWIZZLE_A :return GL_ALPHA;
+    }
+    return 0;
+  }
+
+  GLint textureLevelParameter(GLuint texture,GLint level,GLenum pname){
+    auto t = find(state().textures,texture);
+    if(!t)return 0;
+    auto l = find(t->levels,GLuint(level));
+    if(!l)return 0;
+    switch(pname){
+      case GL_TEXTURE_WIDTH          :return l->width ;
+      case GL_TEXTURE_HEIGHT         :return l->height;
+      case GL_TEXTURE_DEPTH          :return l->depth ;
+      case GL_TEXTURE_INTERNAL_FORMAT:return GLint(t->internalFormat);
+    }
+    return 0;
+  }
+
+  GLuint boundTexture(GLenum target){
+    auto&s = state();
+    auto ii = s.textureUnits.find(std::make_pair(activeTextureUnit(s),textureTarget2Binding(textureTarget(target))));
+    return ii == s.textureUnits.end()?0:ii->second;
+  }
+
+  void bindTextureUnit(GLuint unit,GLuint texture,GLenum target){
+    auto&s = state();
+    auto t = find(s.textures,texture);
+    if(t && t->target == 0)t->target = target;
+    if(t)target = t->target;
+    GLenum const binding = textureTarget2Binding(target);
+    if(binding == 0)return;
+    s.textureUnits[std::make_pair(unit,binding)] = texture;
+  }
+
+  void getQueryObject(GLuint id,GLenum pname,GLuint64&result){
+    auto q = find(state().queries,id);
+    if(!q)return;
+    switch(pname){
+      case GL_QUERY_RESULT          :q->pending = 0;result = q->result;break;
+      case GL_QUERY_RESULT_NO_WAIT  :if(!q->pending)result = q->result;break;
+      case GL_QUERY_RESULT_AVAILABLE:
+        result = q->pending?GL_FALSE:GL_TRUE;
+        if(q->pending)q->pending--;
+        break;
+      case GL_QUERY_TARGET          :result = q->target;break;
+    }
+  }
+}
+
+/**
+ * @brief emulated functions, they replace generated functions that do nothing
+ */
+namespace emulation{
+  using ge::gl::NullLoader;
+
+  //state
+  void glEnable (GLenum cap){state().enabled.insert(cap);}
+  void glDisable(GLenum cap){state().enabled.erase (cap);}
+  GLboolean glIsEnabled(GLenum cap){return GLboolean(state().enabled.count(cap) != 0);}
+  void glViewport(GLint x,GLint y,GLsizei width,GLsizei height){
+    auto&v = state().viewport;
+    v[0] = x;v[1] = y;v[2] = width;v[3] = height;
+  }
+  void glScissor(GLint x,GLint y,GLsizei width,GLsizei height){
+    auto&v = state().scissor;
+    v[0] = x;v[1] = y;v[2] = width;v[3] = height;
+  }
+  void glPixelStorei(GLenum pname,GLint param){state().integers[pname] = param;}
+  void glActiveTexture(GLenum texture){state().integers[GL_ACTIVE_TEXTURE] = texture;}
+  void glGetIntegerv  (GLenum pname,GLint    *data){getValues(pname,data);}
+  void glGetInteger64v(GLenum pname,GLint64  *data){getValues(pname,data);}
+  void glGetFloatv    (GLenum pname,GLfloat  *data){getValues(pname,data);}
+  void glGetDoublev   (GLenum pname,GLdouble *data){getValues(pname,data);}
+  void glGetBooleanv  (GLenum pname,GLboolean*data){
+    GLint64 values[4] = {};
+    getValues(pname,values);
+    if(!data)return;
+    size_t const n = pname == GL_VIEWPORT || pname == GL_SCISSOR_BOX?4:1;
+    for(size_t i=0;i<n;++i)data[i] = GLboolean(values[i] != 0);
+  }
+  void glGetIntegeri_v  (GLenum target,GLuint index,GLint  *data){getIndexedValues(target,index,data);}
+  void glGetInteger64i_v(GLenum target,GLuint index,GLint64*data){getIndexedValues(target,index,data);}
+  GLubyte const*glGetString(GLenum name){
+    switch(name){
+      case GL_VENDOR                  :return reinterpret_cast<GLubyte const*>("GPUEngine"       );
+      case GL_RENDERER                :return reinterpret_cast<GLubyte const*>("geGL NullLoader" );
+      case GL_VERSION                 :return reinterpret_cast<GLubyte const*>("4.5.0 NullLoader");
+      case GL_SHADING_LANGUAGE_VERSION:return reinterpret_cast<GLubyte const*>("4.50"            );
+    }
+    return nullptr;
+  }
+  GLubyte const*glGetStringi(GLenum name,GLuint index){
+    if(name != GL_EXTENSIONS || index >= GLuint(getInteger(state(),GL_NUM_EXTENSIONS)))return nullptr;
+    if(index >= sizeof(extensions)/sizeof(extensions[0]))return nullptr;
+    return reinterpret_cast<GLubyte const*>(extensions[index]);
+  }
+  void glMaxShaderCompilerThreadsARB(GLuint count){state().integers[GL_MAX_SHADER_COMPILER_THREADS_ARB] = count;}
+
+  //buffers
+  void      glGenBuffers   (GLsizei n,GLuint      *buffers){createObjects(GL_BUFFER,n,buffers);}
+  void      glCreateBuffers(GLsizei n,GLuint      *buffers){createObjects(GL_BUFFER,n,buffers);}
+  GLboolean glIsBuffer     (GLuint buffer                 ){return isObject(GL_BUFFER,buffer);}
+  void      glDeleteBuffers(GLsizei n,GLuint const*buffers){
+    deleteObjects(GL_BUFFER,n,buffers);
+    auto&s = state();
+    for(GLsizei i=0;buffers && i<n;++i){
+      for(auto&b:s.integers       )if(bufferBinding2Target(b.first) && b.second == buffers[i])b.second = 0;
+      for(auto&b:s.indexedIntegers)if(bufferBinding2Target(b.first.first) && b.second == buffers[i])b.second = 0;
+      for(auto&v:s.vertexArrays)
+        if(v.second.elementBuffer == buffers[i])v.second.elementBuffer = 0;
+    }
+  }
+  void glBindBuffer(GLenum target,GLuint buffer){
+    auto&s = state();
+    if(target == GL_ELEMENT_ARRAY_BUFFER)currentVertexArray(s).elementBuffer = buffer;
+    else s.integers[bufferBinding(target)] = buffer;
+  }
+  void glBindBufferRange(GLenum target,GLuint index,GLuint buffer,GLintptr offset,GLsizeiptr size){
+    auto&s = state();
+    GLenum const binding = bufferBinding(target);
+    s.integers[binding] = buffer;
+    s.indexedIntegers[std::make_pair(binding,index)] = buffer;
+    if(target == GL_UNIFORM_BUFFER){
+      s.indexedIntegers[std::make_pair(GLenum(GL_UNIFORM_BUFFER_START),index)] = offset;
+      s.indexedIntegers[std::make_pair(GLenum(GL_UNIFORM_BUFFER_SIZE ),index)] = size  ;
+    }
+    if(target == GL_SHADER_STORAGE_BUFFER){
+      s.indexedIntegers[std::make_pair(GLenum(GL_SHADER_STORAGE_BUFFER_START),index)] = offset;
+      s.indexedIntegers[std::make_pair(GLenum(GL_SHADER_STORAGE_BUFFER_SIZE ),index)] = size  ;
+    }
+  }
+  void glBindBufferBase(GLenum target,GLuint index,GLuint buffer){
+    glBindBufferRange(target,index,buffer,0,0);
+  }
+  void glBindBuffersBase(GLenum target,GLuint first,GLsizei count,GLuint const*buffers){
+    for(GLsizei i=0;i<count;++i)
+      glBindBufferBase(target,first+GLuint(i),buffers?buffers[i]:0);
+  }
+  void glBindBuffersRange(GLenum target,GLuint first,GLsizei count,GLuint const*buffers,GLintptr const*offsets,GLsizeiptr const*sizes){
+    for(GLsizei i=0;i<count;++i){
+      if(buffers)glBindBufferRange(target,first+GLuint(i),buffers[i],offsets[i],sizes[i]);
+      else glBindBufferBase(target,first+GLuint(i),0);
+    }
+  }
+  GLuint boundBuffer(GLenum target){
+    auto&s = state();
+    return GLuint(getInteger(s,bufferBinding(target)));
+  }
+  void bufferData(GLuint buffer,GLsizeiptr size,void const*data,GLenum usage,GLbitfield flags,GLboolean immutable){
+    auto b = find(state().buffers,buffer);
+    if(!b || b->immutable || size<0)return;
+    b->data.assign(size_t(size),0);
+    if(data && size>0)std::memcpy(b->data.data(),data,size_t(size));
+    b->usage     = usage    ;
+    b->flags     = flags    ;
+    b->immutable = immutable;
+    b->access    = 0        ;
+    b->mapOffset = 0        ;
+    b->mapLength = 0        ;
+  }
+  GLbitfield const mutableFlags = GL_MAP_READ_BIT|GL_MAP_WRITE_BIT|GL_DYNAMIC_STORAGE_BIT;
+  void glNamedBufferData   (GLuint buffer,GLsizeiptr size,void const*data,GLenum     usage){bufferData(buffer,size,data,usage,mutableFlags,GL_FALSE);}
+  void glNamedBufferStorage(GLuint buffer,GLsizeiptr size,void const*data,GLbitfield flags){bufferData(buffer,size,data,GL_DYNAMIC_DRAW,flags,GL_TRUE);}
+  void glBufferData        (GLenum target,GLsizeiptr size,void const*data,GLenum     usage){glNamedBufferData   (boundBuffer(target),size,data,usage);}
+  void glBufferStorage     (GLenum target,GLsizeiptr size,void const*data,GLbitfield flags){glNamedBufferStorage(boundBuffer(target),size,data,flags);}
+  uint8_t*bufferRange(GLuint buffer,GLintptr offset,GLsizeiptr size){
+    auto b = find(state().buffers,buffer);
+    if(!b || offset<0 || size<0 || size_t(offset+size)>b->data.size())return nullptr;
+    return b->data.data()+offset;
+  }
+  void glNamedBufferSubData(GLuint buffer,GLintptr offset,GLsizeiptr size,void const*data){
+    auto d = bufferRange(buffer,offset,size);
+    if(d && data && size>0)std::memcpy(d,data,size_t(size));
+  }
+  void glGetNamedBufferSubData(GLuint buffer,GLintptr offset,GLsizeiptr size,void*data){
+    auto d = bufferRange(buffer,offset,size);
+    if(d && data && size>0)std::memcpy(data,d,size_t(size));
+  }
+  void glBufferSubData   (GLenum target,GLintptr offset,GLsizeiptr size,void const*data){glNamedBufferSubData   (boundBuffer(target),offset,size,data);}
+  void glGetBufferSubData(GLenum target,GLintptr offset,GLsizeiptr size,void      *data){glGetNamedBufferSubData(boundBuffer(target),offset,size,data);}
+  void glCopyNamedBufferSubData(GLuint readBuffer,GLuint writeBuffer,GLintptr readOffset,GLintptr writeOffset,GLsizeiptr size){
+    auto r = bufferRange(readBuffer ,readOffset ,size);
+    auto w = bufferRange(writeBuffer,writeOffset,size);
+    if(r && w && size>0)std::memmove(w,r,size_t(size));
+  }
+  void glCopyBufferSubData(GLenum readTarget,GLenum writeTarget,GLintptr readOffset,GLintptr writeOffset,GLsizeiptr size){
+    glCopyNamedBufferSubData(boundBuffer(readTarget),boundBuffer(writeTarget),readOffset,writeOffset,size);
+  }
+  void glClearNamedBufferSubData(GLuint buffer,GLenum,GLintptr offset,GLsizeiptr size,GLenum format,GLenum type,void const*data){
+    auto d = bufferRange(buffer,offset,size);
+    if(!d || size<=0)return;
+    size_t const element = CallRecorder::pixelSize(format,type);
+    for(size_t i=0;i<size_t(size);i+=element){
+      size_t const n = std::min(element,size_t(size)-i);
+      if(data)std::memcpy(d+i,data,n);
+      else std::memset(d+i,0,n);
+    }
+  }
+  void glClearNamedBufferData(GLuint buffer,GLenum internalformat,GLenum format,GLenum type,void const*data){
+    auto b = find(state().buffers,buffer);
+    if(!b)return;
+    glClearNamedBufferSubData(buffer,internalformat,0,GLsizeiptr(b->data.size()),format,type,data);
+  }
+  void glClearBufferSubData(GLenum target,GLenum internalformat,GLintptr offset,GLsizeiptr size,GLenum format,GLenum type,void const*data){
+    glClearNamedBufferSubData(boundBuffer(target),internalformat,offset,size,format,type,data);
+  }
+  void glClearBufferData(GLenum target,GLenum internalformat,GLenum format,GLenum type,void const*data){
+    glClearNamedBufferData(boundBuffer(target),internalformat,format,type,data);
+  }
+  void*glMapNamedBufferRange(GLuint buffer,GLintptr offset,GLsizeiptr length,GLbitfield access){
+    auto b = find(state().buffers,buffer);
+    if(!b || b->access != 0 || (access&(GL_MAP_READ_BIT|GL_MAP_WRITE_BIT)) == 0)return nullptr;
+    auto d = bufferRange(buffer,offset,length);
+    if(!d)return nullptr;
+    b->access    = access;
+    b->mapOffset = offset;
+    b->mapLength = length;
+    return d;
+  }
+  GLbitfield mapAccess(GLenum access){
+    switch(access){
+      case GL_READ_ONLY :return GL_MAP_READ_BIT ;
+      case GL_WRITE_ONLY:return GL_MAP_WRITE_BIT;
+      case GL_READ_WRITE:return GL_MAP_READ_BIT|GL_MAP_WRITE_BIT;
+    }
+    return 0;
+  }
+  void*glMapNamedBuffer(GLuint buffer,GLenum access){
+    auto b = find(state().buffers,buffer);
+    if(!b)return nullptr;
+    return glMapNamedBufferRange(buffer,0,GLsizeiptr(b->data.size()),mapAccess(access));
+  }
+  void*glMapBuffer     (GLenum target,GLenum access){return glMapNamedBuffer(boundBuffer(target),access);}
+  void*glMapBufferRange(GLenum target,GLintptr offset,GLsizeiptr length,GLbitfield access){
+    return glMapNamedBufferRange(boundBuffer(target),offset,length,access);
+  }
+  GLboolean glUnmapNamedBuffer(GLuint buffer){
+    auto b = find(state().buffers,buffer);
+    if(!b || b->access == 0)return GL_FALSE;
+    b->access    = 0;
+    b->mapOffset = 0;
+    b->mapLength = 0;
+    return GL_TRUE;
+  }
+  GLboolean glUnmapBuffer(GLenum target){return glUnmapNamedBuffer(boundBuffer(target));}
+  GLint64 bufferParameter(GLuint buffer,GLenum pname){
+    auto b = find(state().buffers,buffer);
+    if(!b)return 0;
+    switch(pname){
+      case GL_BUFFER_SIZE             :return GLint64(b->data.size());
+      case GL_BUFFER_USAGE            :return b->usage;
+      case GL_BUFFER_IMMUTABLE_STORAGE:return b->immutable;
+      case GL_BUFFER_STORAGE_FLAGS    :return b->flags;
+      case GL_BUFFER_MAPPED           :return b->access != 0;
+      case GL_BUFFER_ACCESS_FLAGS     :return b->access;
+      case GL_BUFFER_MAP_OFFSET       :return b->mapOffset;
+      case GL_BUFFER_MAP_LENGTH       :return b->mapLength;
+      case GL_BUFFER_ACCESS           :return GL_READ_WRITE;
+    }
+    return 0;
+  }
+  void glGetNamedBufferParameteriv  (GLuint buffer,GLenum pname,GLint  *params){if(params)*params = GLint(bufferParameter(buffer,pname));}
+  void glGetNamedBufferParameteri64v(GLuint buffer,GLenum pname,GLint64*params){if(params)*params = bufferParameter(buffer,pname);}
+  void glGetBufferParameteriv       (GLenum target,GLenum pname,GLint  *params){glGetNamedBufferParameteriv  (boundBuffer(target),pname,params);}
+  void glGetBufferParameteri64v     (GLenum target,GLenum pname,GLint64*params){glGetNamedBufferParameteri64v(boundBuffer(target),pname,params);}
+  void glGetNamedBufferPointerv(GLuint buffer,GLenum pname,void**params){
+    if(!params)return;
+    *params = nullptr;
+    auto b = find(state().buffers,buffer);
+    if(!b || pname != GL_BUFFER_MAP_POINTER || b->access == 0)return;
+    *params = b->data.data()+b->mapOffset;
+  }
+  void glGetBufferPointerv(GLenum target,GLenum pname,void**params){glGetNamedBufferPointerv(boundBuffer(target),pname,params);}
+
+  //vertex arrays
+  void      glGenVertexArrays   (GLsizei n,GLuint      *arrays){createObjects(GL_VERTEX_ARRAY,n,arrays);}
+  void      glCreateVertexArrays(GLsizei n,GLuint      *arrays){createObjects(GL_VERTEX_ARRAY,n,arrays);}
+  GLboolean glIsVertexArray     (GLuint array                 ){return isObject(GL_VERTEX_ARRAY,array);}
+  void      glDeleteVertexArrays(GLsizei n,GLuint const*arrays){
+    auto&s = state();
+    for(GLsizei i=0;arrays && i<n;++i)
+      if(arrays[i] == GLuint(s.integers[GL_VERTEX_ARRAY_BINDING]))s.integers[GL_VERTEX_ARRAY_BINDING] = 0;
+    deleteObjects(GL_VERTEX_ARRAY,n,arrays);
+  }
+  void glBindVertexArray(GLuint array){
+    auto&s = state();
+    if(!find(s.vertexArrays,array))return;
+    s.integers[GL_VERTEX_ARRAY_BINDING] = array;
+  }
+  NullVertexArray*vertexArray(GLuint vaobj){return find(state().vertexArrays,vaobj);}
+  GLuint currentVertexArrayName(){return GLuint(state().integers[GL_VERTEX_ARRAY_BINDING]);}
+  void glVertexArrayElementBuffer(GLuint vaobj,GLuint buffer){
+    auto v = vertexArray(vaobj);
+    if(v)v->elementBuffer = buffer;
+  }
+  void enableAttrib(GLuint vaobj,GLuint index,GLint enabled){
+    auto v = vertexArray(vaobj);
+    if(v)v->attrib(index).enabled = enabled;
+  }
+  void glEnableVertexArrayAttrib (GLuint vaobj,GLuint index){enableAttrib(vaobj,index,GL_TRUE );}
+  void glDisableVertexArrayAttrib(GLuint vaobj,GLuint index){enableAttrib(vaobj,index,GL_FALSE);}
+  void glEnableVertexAttribArray (GLuint index){enableAttrib(currentVertexArrayName(),index,GL_TRUE );}
+  void glDisableVertexAttribArray(GLuint index){enableAttrib(currentVertexArrayName(),index,GL_FALSE);}
+  void attribFormat(GLuint vaobj,GLuint index,GLint size,GLenum type,GLint normalized,GLint integer,GLint isLong,GLuint relativeOffset){
+    auto v = vertexArray(vaobj);
+    if(!v)return;
+    auto&a = v->attrib(index);
+    a.size           = size;
+    a.type           = GLint(type);
+    a.normalized     = normalized;
+    a.integer        = integer;
+    a.isLong         = isLong;
+    a.relativeOffset = GLint(relativeOffset);
+  }
+  void glVertexArrayAttribFormat (GLuint vaobj,GLuint index,GLint size,GLenum type,GLboolean normalized,GLuint relativeoffset){attribFormat(vaobj,index,size,type,normalized,GL_FALSE,GL_FALSE,relativeoffset);}
+  void glVertexArrayAttribIFormat(GLuint vaobj,GLuint index,GLint size,GLenum type,GLuint relativeoffset){attribFormat(vaobj,index,size,type,GL_FALSE,GL_TRUE,GL_FALSE,relativeoffset);}
+  void glVertexArrayAttribLFormat(GLuint vaobj,GLuint index,GLint size,GLenum type,GLuint relativeoffset){attribFormat(vaobj,index,size,type,GL_FALSE,GL_FALSE,GL_TRUE,relativeoffset);}
+  void glVertexAttribFormat (GLuint index,GLint size,GLenum type,GLboolean normalized,GLuint relativeoffset){glVertexArrayAttribFormat (currentVertexArrayName(),index,size,type,normalized,relativeoffset);}
+  void glVertexAttribIFormat(GLuint index,GLint size,GLenum type,GLuint relativeoffset){glVertexArrayAttribIFormat(currentVertexArrayName(),index,size,type,relativeoffset);}
+  void glVertexAttribLFormat(GLuint index,GLint size,GLenum type,GLuint relativeoffset){glVertexArrayAttribLFormat(currentVertexArrayName(),index,size,type,relativeoffset);}
+  void glVertexArrayAttribBinding(GLuint vaobj,GLuint attribindex,GLuint bindingindex){
+    auto v = vertexArray(vaobj);
+    if(v)v->attrib(attribindex).binding = bindingindex;
+  }
+  void glVertexAttribBinding(GLuint attribindex,GLuint bindingindex){glVertexArrayAttribBinding(currentVertexArrayName(),attribindex,bindingindex);}
+  void glVertexArrayVertexBuffer(GLuint vaobj,GLuint bindingindex,GLuint buffer,GLintptr offset,GLsizei stride){
+    auto v = vertexArray(vaobj);
+    if(!v)return;
+    auto&b = v->bindings[bindingindex];
+    b.buffer = buffer;
+    b.offset = offset;
+    b.stride = stride;
+  }
+  void glBindVertexBuffer(GLuint bindingindex,GLuint buffer,GLintptr offset,GLsizei stride){glVertexArrayVertexBuffer(currentVertexArrayName(),bindingindex,buffer,offset,stride);}
+  void glVertexArrayBindingDivisor(GLuint vaobj,GLuint bindingindex,GLuint divisor){
+    auto v = vertexArray(vaobj);
+    if(v)v->bindings[bindingindex].divisor = divisor;
+  }
+  void glVertexBindingDivisor(GLuint bindingindex,GLuint divisor){glVertexArrayBindingDivisor(currentVertexArrayName(),bindingindex,divisor);}
+  void glVertexAttribDivisor (GLuint index,GLuint divisor){
+    glVertexAttribBinding (index,index  );
+    glVertexBindingDivisor(index,divisor);
+  }
+  void attribPointer(GLuint index,GLint size,GLenum type,GLint normalized,GLint integer,GLint isLong,GLsizei stride,void const*pointer){
+    GLuint const vaobj = currentVertexArrayName();
+    attribFormat(vaobj,index,size,type,normalized,integer,isLong,0);
+    glVertexArrayAttribBinding(vaobj,index,index);
+    if(stride == 0)stride = GLsizei(size*GLint(getTypeSize(type))*(isLong?2:1));
+    glVertexArrayVertexBuffer(vaobj,index,boundBuffer(GL_ARRAY_BUFFER),GLintptr(pointer),stride);
+  }
+  void glVertexAttribPointer (GLuint index,GLint size,GLenum type,GLboolean normalized,GLsizei stride,void const*pointer){attribPointer(index,size,type,normalized,GL_FALSE,GL_FALSE,stride,pointer);}
+  void glVertexAttribIPointer(GLuint index,GLint size,GLenum type,GLsizei stride,void const*pointer){attribPointer(index,size,type,GL_FALSE,GL_TRUE,GL_FALSE,stride,pointer);}
+  void glVertexAttribLPointer(GLuint index,GLint size,GLenum type,GLsizei stride,void const*pointer){attribPointer(index,size,type,GL_FALSE,GL_FALSE,GL_TRUE,stride,pointer);}
+  GLint64 attribParameter(GLuint vaobj,GLuint index,GLenum pname){
+    auto v = vertexArray(vaobj);
+    if(!v)return 0;
+    auto const&a = v->attrib(index);
+    auto const&b = v->bindings[a.binding];
+    switch(pname){
+      case GL_VERTEX_ATTRIB_ARRAY_ENABLED       :return a.enabled;
+      case GL_VERTEX_ATTRIB_ARRAY_SIZE          :return a.size;
+      case GL_VERTEX_ATTRIB_ARRAY_TYPE          :return a.type;
+      case GL_VERTEX_ATTRIB_ARRAY_NORMALIZED    :return a.normalized;
+      case GL_VERTEX_ATTRIB_ARRAY_INTEGER       :return a.integer;
+      case GL_VERTEX_ATTRIB_ARRAY_LONG          :return a.isLong;
+      case GL_VERTEX_ATTRIB_RELATIVE_OFFSET     :return a.relativeOffset;
+      case GL_VERTEX_ATTRIB_BINDING             :return a.binding;
+      case GL_VERTEX_ATTRIB_ARRAY_STRIDE        :return b.stride;
+      case GL_VERTEX_ATTRIB_ARRAY_DIVISOR       :return b.divisor;
+      case GL_VERTEX_ATTRIB_ARRAY_BUFFER_BINDING:return b.buffer;
+      case GL_VERTEX_BINDING_OFFSET             :return b.offset;
+    }
+    return 0;
+  }
+  void glGetVertexArrayIndexediv  (GLuint vaobj,GLuint index,GLenum pname,GLint  *param){if(param)*param = GLint(attribParameter(vaobj,index,pname));}
+  void glGetVertexArrayIndexed64iv(GLuint vaobj,GLuint index,GLenum pname,GLint64*param){if(param)*param = attribParameter(vaobj,index,pname);}
+  void glGetVertexAttribiv        (GLuint index,GLenum pname,GLint*params){glGetVertexArrayIndexediv(currentVertexArrayName(),index,pname,params);}
+  void glGetVertexArrayiv(GLuint vaobj,GLenum pname,GLint*param){
+    auto v = vertexArray(vaobj);
+    if(!v || !param)return;
+    *param = pname == GL_ELEMENT_ARRAY_BUFFER_BINDING?GLint(v->elementBuffer):0;
+  }
+
+  //shaders and programs
+  GLuint glCreateShader(GLenum type){
+    auto&s = state();
+    GLuint const name = s.nextName++;
+    s.objects[name] = GL_SHADER;
+    s.shaders[name].type = type;
+    return name;
+  }
+  void glDeleteShader(GLuint shader){
+    deleteObjects(GL_SHADER,1,&shader);
+    state().shaders.erase(shader);
+  }
+  GLboolean glIsShader(GLuint shader){return isObject(GL_SHADER,shader);}
+  void glShaderSource(GLuint shader,GLsizei count,GLchar const*const*string,GLint const*length){
+    auto sh = find(state().shaders,shader);
+    if(!sh)return;
+    sh->source.clear();
+    for(GLsizei i=0;string && i<count;++i){
+      if(!string[i])continue;
+      if(length && length[i]>=0)sh->source.append(string[i],size_t(length[i]));
+      else sh->source.append(string[i]);
+    }
+  }
+  void glCompileShader(GLuint shader){
+    auto&s = state();
+    auto sh = find(s.shaders,shader);
+    if(!sh)return;
+    sh->compiled = GL_TRUE;
+    sh->pending  = s.compileLatency;
+  }
+  void glGetShaderiv(GLuint shader,GLenum pname,GLint*params){
+    auto sh = find(state().shaders,shader);
+    if(!sh || !params)return;
+    if(pname == GL_COMPLETION_STATUS_ARB){
+      *params = sh->pending == 0;
+      if(sh->pending)sh->pending--;
+      return;
+    }
+    sh->pending = 0;
+    switch(pname){
+      case GL_SHADER_TYPE         :*params = GLint(sh->type);break;
+      case GL_COMPILE_STATUS      :*params = sh->compiled   ;break;
+      case GL_SHADER_SOURCE_LENGTH:*params = sh->source.empty()?0:GLint(sh->source.size()+1);break;
+      default                     :*params = 0;break;
+    }
+  }
+  void glGetShaderSource(GLuint shader,GLsizei bufSize,GLsizei*length,GLchar*source){
+    auto sh = find(state().shaders,shader);
+    writeString(sh?sh->source:"",bufSize,length,source);
+  }
+  void glGetShaderInfoLog (GLuint,GLsizei bufSize,GLsizei*length,GLchar*infoLog){writeString("",bufSize,length,infoLog);}
+  void glGetProgramInfoLog(GLuint,GLsizei bufSize,GLsizei*length,GLchar*infoLog){writeString("",bufSize,length,infoLog);}
+  GLuint glCreateProgram(){
+    auto&s = state();
+    GLuint const name = s.nextName++;
+    s.objects[name] = GL_PROGRAM;
+    s.programs[name];
+    return name;
+  }
+  void glDeleteProgram(GLuint program){
+    auto&s = state();
+    deleteObjects(GL_PROGRAM,1,&program);
+    s.programs.erase(program);
+    if(GLuint(s.integers[GL_CURRENT_PROGRAM]) == program)s.integers[GL_CURRENT_PROGRAM] = 0;
+  }
+  GLboolean glIsProgram(GLuint program){return isObject(GL_PROGRAM,program);}
+  void glAttachShader(GLuint program,GLuint shader){
+    auto p = find(state().programs,program);
+    if(p)p->shaders.insert(shader);
+  }
+  void glDetachShader(GLuint program,GLuint shader){
+    auto p = find(state().programs,program);
+    if(p)p->shaders.erase(shader);
+  }
+  void glGetAttachedShaders(GLuint program,GLsizei maxCount,GLsizei*count,GLuint*shaders){
+    auto p = find(state().programs,program);
+    GLsizei n = 0;
+    if(p && shaders)
+      for(auto const&x:p->shaders)
+        if(n<maxCount)shaders[n++] = x;
+    if(count)*count = n;
+  }
+  void linkProgram(NullProgram&program,std::vector<std::pair<GLenum,std::string>>const&sources){
+    program.uniforms       .clear();
+    program.inputs         .clear();
+    program.storageBlocks  .clear();
+    program.bufferVariables.clear();
+    for(auto const&x:sources)
+      parseShader(program,x.first,x.second);
+    assignLocations(program.uniforms,false);
+    assignLocations(program.inputs  ,true );
+    program.sources = sources;
+    program.linked  = GL_TRUE;
+  }
+  void glLinkProgram(GLuint program){
+    auto&s = state();
+    auto p = find(s.programs,program);
+    if(!p)return;
+    std::vector<std::pair<GLenum,std::string>>sources;
+    for(auto const&x:p->shaders){
+      auto sh = find(s.shaders,x);
+      if(sh)sources.emplace_back(sh->type,sh->source);
+    }
+    linkProgram(*p,sources);
+    p->pending = s.compileLatency;
+  }
+  //binary is sequence of (uint32 type,uint32 length,source) triplets
+  std::vector<uint8_t>programBinary(NullProgram const&program){
+    std::vector<uint8_t>binary;
+    for(auto const&x:program.sources){
+      uint32_t const header[2] = {uint32_t(x.first),uint32_t(x.second.size())};
+      auto const h = reinterpret_cast<uint8_t const*>(header);
+      binary.insert(binary.end(),h,h+sizeof(header));
+      binary.insert(binary.end(),x.second.begin(),x.second.end());
+    }
+    return binary;
+  }
+  void glGetProgramBinary(GLuint program,GLsizei bufSize,GLsizei*length,GLenum*binaryFormat,void*binary){
+    auto p = find(state().programs,program);
+    GLsizei n = 0;
+    if(p && p->linked){
+      auto const data = programBinary(*p);
+      if(GLsizei(data.size())<=bufSize && binary){
+        std::memcpy(binary,data.data(),data.size());
+        n = GLsizei(data.size());
+      }
+    }
+    if(length)*length = n;
+    if(binaryFormat)*binaryFormat = nullBinaryFormat;
+  }
+  void glProgramBinary(GLuint program,GLenum binaryFormat,void const*binary,GLsizei length){
+    auto p = find(state().programs,program);
+    if(!p)return;
+    p->linked = GL_FALSE;
+    if(binaryFormat != nullBinaryFormat || !binary || length<=0)return;
+    auto const data = static_cast<uint8_t const*>(binary);
+    std::vector<std::pair<GLenum,std::string>>sources;
+    size_t i = 0;
+    while(i<size_t(length)){
+      uint32_t header[2];
+      if(i+sizeof(header)>size_t(length))return;
+      std::memcpy(header,data+i,sizeof(header));
+      i += sizeof(header);
+      if(i+header[1]>size_t(length))return;
+      sources.emplace_back(GLenum(header[0]),std::string(reinterpret_cast<char const*>(data+i),header[1]));
+      i += header[1];
+    }
+    linkProgram(*p,sources);
+  }
+  void glUseProgram(GLuint program){state().integers[GL_CURRENT_PROGRAM] = program;}
+  void glGetProgramiv(GLuint program,GLenum pname,GLint*params){
+    auto p = find(state().programs,program);
+    if(!p || !params)return;
+    if(pname == GL_COMPLETION_STATUS_ARB){
+      *params = p->pending == 0;
+      if(p->pending)p->pending--;
+      return;
+    }
+    p->pending = 0;
+    switch(pname){
+      case GL_LINK_STATUS                  :*params = p->linked;break;
+      case GL_VALIDATE_STATUS              :*params = GL_TRUE;break;
+      case GL_ATTACHED_SHADERS             :*params = GLint(p->shaders.size());break;
+      case GL_ACTIVE_UNIFORMS              :*params = GLint(p->uniforms.size());break;
+      case GL_ACTIVE_UNIFORM_MAX_LENGTH    :*params = maxNameLength(p->uniforms);break;
+      case GL_ACTIVE_ATTRIBUTES            :*params = GLint(p->inputs.size());break;
+      case GL_ACTIVE_ATTRIBUTE_MAX_LENGTH  :*params = maxNameLength(p->inputs);break;
+      case GL_PROGRAM_BINARY_LENGTH        :*params = p->linked?GLint(programBinary(*p).size()):0;break;
+      case GL_COMPUTE_WORK_GROUP_SIZE      :
+        for(size_t i=0;i<3;++i)params[i] = p->workGroupSize[i];
+        break;
+      default:*params = 0;break;
+    }
+  }
+  void getActiveResource(std::vector<NullResource>const&resources,GLuint index,GLsizei bufSize,GLsizei*length,GLint*size,GLenum*type,GLchar*name){
+    if(index>=resources.size())return;
+    auto const&r = resources[index];
+    if(size)*size = r.size;
+    if(type)*type = r.type;
+    writeString(resourceName(r),bufSize,length,name);
+  }
+  void glGetActiveUniform(GLuint program,GLuint index,GLsizei bufSize,GLsizei*length,GLint*size,GLenum*type,GLchar*name){
+    auto p = find(state().programs,program);
+    if(p)getActiveResource(p->uniforms,index,bufSize,length,size,type,name);
+  }
+  void glGetActiveAttrib(GLuint program,GLuint index,GLsizei bufSize,GLsizei*length,GLint*size,GLenum*type,GLchar*name){
+    auto p = find(state().programs,program);
+    if(p)getActiveResource(p->inputs,index,bufSize,length,size,type,name);
+  }
+  GLint glGetUniformLocation(GLuint program,GLchar const*name){return resourceLocation(programResources(program,GL_UNIFORM      ),name);}
+  GLint glGetAttribLocation (GLuint program,GLchar const*name){return resourceLocation(programResources(program,GL_PROGRAM_INPUT),name);}
+  void glGetProgramInterfaceiv(GLuint program,GLenum programInterface,GLenum pname,GLint*params){
+    if(!params)return;
+    *params = 0;
+    auto resources = programResources(program,programInterface);
+    if(!resources)return;
+    switch(pname){
+      case GL_ACTIVE_RESOURCES         :*params = GLint(resources->size());break;
+      case GL_MAX_NAME_LENGTH          :*params = maxNameLength(*resources);break;
+      case GL_MAX_NUM_ACTIVE_VARIABLES :
+        for(auto const&r:*resources)*params = std::max(*params,r.members);
+        break;
+    }
+  }
+  GLuint glGetProgramResourceIndex(GLuint program,GLenum programInterface,GLchar const*name){
+    auto resources = programResources(program,programInterface);
+    if(!resources || !name)return GL_INVALID_INDEX;
+    for(size_t i=0;i<resources->size();++i)
+      if(resourceName((*resources)[i]) == name || (*resources)[i].name == name)return GLuint(i);
+    return GL_INVALID_INDEX;
+  }
+  GLint glGetProgramResourceLocation(GLuint program,GLenum programInterface,GLchar const*name){
+    return resourceLocation(programResources(program,programInterface),name);
+  }
+  void glGetProgramResourceName(GLuint program,GLenum programInterface,GLuint index,GLsizei bufSize,GLsizei*length,GLchar*name){
+    auto resources = programResources(program,programInterface);
+    if(!resources || index>=resources->size()){
+      writeString("",bufSize,length,name);
+      return;
+    }
+    writeString(resourceName((*resources)[index]),bufSize,length,name);
+  }
+  void glGetProgramResourceiv(GLuint program,GLenum programInterface,GLuint index,GLsizei propCount,GLenum const*props,GLsizei bufSize,GLsizei*length,GLint*params){
+    auto resources = programResources(program,programInterface);
+    GLsizei n = 0;
+    for(GLsizei i=0;resources && index<resources->size() && i<propCount && n<bufSize;++i){
+      auto const&r = (*resources)[index];
+      GLint value = 0;
+      switch(props[i]){
+        case GL_TYPE                                :value = GLint(r.type);break;
+        case GL_ARRAY_SIZE                          :value = r.size;break;
+        case GL_LOCATION                            :value = r.location;break;
+        case GL_NAME_LENGTH                         :value = GLint(resourceName(r).size()+1);break;
+        case GL_BUFFER_BINDING                      :value = r.binding;break;
+        case GL_NUM_ACTIVE_VARIABLES                :value = r.members;break;
+        case GL_BLOCK_INDEX                         :
+        case GL_OFFSET                              :value = -1;break;
+        case GL_REFERENCED_BY_VERTEX_SHADER         :value = GLint(r.stages.count(GL_VERTEX_SHADER         ));break;
+        case GL_REFERENCED_BY_TESS_CONTROL_SHADER   :value = GLint(r.stages.count(GL_TESS_CONTROL_SHADER   ));break;
+        case GL_REFERENCED_BY_TESS_EVALUATION_SHADER:value = GLint(r.stages.count(GL_TESS_EVALUATION_SHADER));break;
+        case GL_REFERENCED_BY_GEOMETRY_SHADER       :value = GLint(r.stages.count(GL_GEOMETRY_SHADER       ));break;
+        case GL_REFERENCED_BY_FRAGMENT_SHADER       :value = GLint(r.stages.count(GL_FRAGMENT_SHADER       ));break;
+        case GL_REFERENCED_BY_COMPUTE_SHADER        :value = GLint(r.stages.count(GL_COMPUTE_SHADER        ));break;
+      }
+      if(params)params[n] = value;
+      n++;
+    }
+    if(length)*length = n;
+  }
+
+  //sync objects
+  GLsync glFenceSync(GLenum,GLbitfield){
+    auto&s = state();
+    GLsync const sync = reinterpret_cast<GLsync>(size_t(s.nextName++));
+    s.syncs.insert(sync);
+    return sync;
+  }
+  void      glDeleteSync(GLsync sync){state().syncs.erase(sync);}
+  GLboolean glIsSync    (GLsync sync){return GLboolean(state().syncs.count(sync) != 0);}
+  GLenum glClientWaitSync(GLsync sync,GLbitfield,GLuint64){
+    return glIsSync(sync)?GLenum(GL_ALREADY_SIGNALED):GLenum(GL_WAIT_FAILED);
+  }
+  void glGetSynciv(GLsync sync,GLenum pname,GLsizei bufSize,GLsizei*length,GLint*values){
+    GLsizei n = 0;
+    if(glIsSync(sync) && values && bufSize>0){
+      switch(pname){
+        case GL_OBJECT_TYPE   :values[0] = GL_SYNC_FENCE;break;
+        case GL_SYNC_STATUS   :values[0] = GL_SIGNALED;break;
+        case GL_SYNC_CONDITION:values[0] = GL_SYNC_GPU_COMMANDS_COMPLETE;break;
+        default               :values[0] = 0;break;
+      }
+      n = 1;
+    }
+    if(length)*length = n;
+  }
+
+  //queries
+  void      glGenQueries   (GLsizei n,GLuint      *ids){createObjects(GL_QUERY,n,ids);}
+  GLboolean glIsQuery      (GLuint id                 ){return isObject(GL_QUERY,id);}
+  void      glDeleteQueries(GLsizei n,GLuint const*ids){deleteObjects(GL_QUERY,n,ids);}
+  void glCreateQueries(GLenum target,GLsizei n,GLuint*ids){
+    createObjects(GL_QUERY,n,ids);
+    for(GLsizei i=0;ids && i<n;++i)state().queries[ids[i]].target = target;
+  }
+  void glBeginQuery(GLenum target,GLuint id){
+    auto&s = state();
+    auto q = find(s.queries,id);
+    if(!q)return;
+    q->target = target;
+    q->begin  = now();
+    q->result = 0;
+    s.activeQueries[target] = id;
+  }
+  void glEndQuery(GLenum target){
+    auto&s = state();
+    auto q = find(s.queries,s.activeQueries[target]);
+    s.activeQueries.erase(target);
+    if(!q)return;
+    if(target == GL_TIME_ELAPSED)q->result = now()-q->begin;
+    q->pending = s.queryLatency;
+  }
+  void glBeginQueryIndexed(GLenum target,GLuint,GLuint id){glBeginQuery(target,id);}
+  void glEndQueryIndexed  (GLenum target,GLuint          ){glEndQuery  (target   );}
+  void glQueryCounter(GLuint id,GLenum target){
+    auto q = find(state().queries,id);
+    if(!q)return;
+    q->target  = target;
+    q->result  = now();
+    q->pending = state().queryLatency;
+  }
+  void glGetQueryiv(GLenum target,GLenum pname,GLint*params){
+    if(!params)return;
+    auto&s = state();
+    switch(pname){
+      case GL_QUERY_COUNTER_BITS:*params = 64;break;
+      case GL_CURRENT_QUERY     :*params = s.activeQueries.count(target)?GLint(s.activeQueries[target]):0;break;
+      default                   :*params = 0;break;
+    }
+  }
+  template<typename T>
+    void getQueryObjectv(GLuint id,GLenum pname,T*params){
+      if(!params)return;
+      GLuint64 result = 0;
+      getQueryObject(id,pname,result);
+      *params = T(result);
+    }
+  void glGetQueryObjectiv    (GLuint id,GLenum pname,GLint   *params){getQueryObjectv(id,pname,params);}
+  void glGetQueryObjectuiv   (GLuint id,GLenum pname,GLuint  *params){getQueryObjectv(id,pname,params);}
+  void glGetQueryObjecti64v  (GLuint id,GLenum pname,GLint64 *params){getQueryObjectv(id,pname,params);}
+  void glGetQueryObjectui64v (GLuint id,GLenum pname,GLuint64*params){getQueryObjectv(id,pname,params);}
+
+  //textures
+  void      glGenTextures   (GLsizei n,GLuint      *textures){createObjects(GL_TEXTURE,n,textures);}
+  GLboolean glIsTexture     (GLuint texture                 ){return isObject(GL_TEXTURE,texture);}
+  void      glDeleteTextures(GLsizei n,GLuint const*textures){
+    auto&s = state();
+    for(GLsizei i=0;textures && i<n;++i)
+      for(auto&u:s.textureUnits)
+        if(u.second == textures[i])u.second = 0;
+    deleteObjects(GL_TEXTURE,n,textures);
+  }
+  void glCreateTextures(GLenum target,GLsizei n,GLuint*textures){
+    createObjects(GL_TEXTURE,n,textures);
+    for(GLsizei i=0;textures && i<n;++i)state().textures[textures[i]].target = target;
+  }
+  void glBindTexture    (GLenum target,GLuint texture){bindTextureUnit(activeTextureUnit(state()),texture,target);}
+  void glBindTextureUnit(GLuint unit  ,GLuint texture){bindTextureUnit(unit,texture,0);}
+  void glBindTextures(GLuint first,GLsizei count,GLuint const*textures){
+    for(GLsizei i=0;i<count;++i){
+      GLuint const texture = textures?textures[i]:0;
+      if(texture != 0){
+        bindTextureUnit(first+GLuint(i),texture,0);
+        continue;
+      }
+      auto&s = state();
+      for(auto&u:s.textureUnits)
+        if(u.first.first == first+GLuint(i))u.second = 0;
+    }
+  }
+  void glTextureStorage1D(GLuint texture,GLsizei levels,GLenum internalformat,GLsizei width                              ){textureStorage(texture,levels,internalformat,width,1     ,1    );}
+  void glTextureStorage2D(GLuint texture,GLsizei levels,GLenum internalformat,GLsizei width,GLsizei height               ){textureStorage(texture,levels,internalformat,width,height,1    );}
+  void glTextureStorage3D(GLuint texture,GLsizei levels,GLenum internalformat,GLsizei width,GLsizei height,GLsizei depth){textureStorage(texture,levels,internalformat,width,height,depth);}
+  void glTexStorage1D(GLenum target,GLsizei levels,GLenum internalformat,GLsizei width                              ){glTextureStorage1D(boundTexture(target),levels,internalformat,width             );}
+  void glTexStorage2D(GLenum target,GLsizei levels,GLenum internalformat,GLsizei width,GLsizei height               ){glTextureStorage2D(boundTexture(target),levels,internalformat,width,height      );}
+  void glTexStorage3D(GLenum target,GLsizei levels,GLenum internalformat,GLsizei width,GLsizei height,GLsizei depth){glTextureStorage3D(boundTexture(target),levels,internalformat,width,height,depth);}
+  void glTexImage1D(GLenum target,GLint level,GLint internalformat,GLsizei width,GLint,GLenum,GLenum,void const*){
+    textureImage(boundTexture(target),level,internalformat,width,1,1);
+  }
+  void glTexImage2D(GLenum target,GLint level,GLint internalformat,GLsizei width,GLsizei height,GLint,GLenum,GLenum,void const*){
+    textureImage(boundTexture(target),level,internalformat,width,height,1);
+  }
+  void glTexImage3D(GLenum target,GLint level,GLint internalformat,GLsizei width,GLsizei height,GLsizei depth,GLint,GLenum,GLenum,void const*){
+    textureImage(boundTexture(target),level,internalformat,width,height,depth);
+  }
+  void glTextureImage1DEXT(GLuint texture,GLenum,GLint level,GLint internalformat,GLsizei width,GLint,GLenum,GLenum,void const*){
+    textureImage(texture,level,internalformat,width,1,1);
+  }
+  void glTextureImage2DEXT(GLuint texture,GLenum,GLint level,GLint internalformat,GLsizei width,GLsizei height,GLint,GLenum,GLenum,void const*){
+    textureImage(texture,level,internalformat,width,height,1);
+  }
+  void glTextureImage3DEXT(GLuint texture,GLenum,GLint level,GLint internalformat,GLsizei width,GLsizei height,GLsizei depth,GLint,GLenum,GLenum,void const*){
+    textureImage(texture,level,internalformat,width,height,depth);
+  }
+  void glGenerateTextureMipmap(GLuint texture){
+    auto t = find(state().textures,texture);
+    if(!t || t->immutable || !find(t->levels,0u))return;
+    auto const base = t->levels[0];
+    GLint level = 1;
+    while((base.width>>level) || (base.height>>level) || (t->target == GL_TEXTURE_3D && (base.depth>>level))){
+      auto&l = t->levels[level];
+      l.width  = std::max(1,base.width >>level);
+      l.height = std::max(1,base.height>>level);
+      l.depth  = t->target == GL_TEXTURE_3D?std::max(1,base.depth>>level):base.depth;
+      level++;
+    }
+    t->nofLevels = level;
+  }
+  void glGenerateMipmap(GLenum target){glGenerateTextureMipmap(boundTexture(target));}
+  void setTextureParameter(GLuint texture,GLenum pname,GLint param){
+    auto t = find(state().textures,texture);
+    if(t)t->parameters[pname] = param;
+  }
+  void glTextureParameteri (GLuint texture,GLenum pname,GLint         param ){setTextureParameter(texture,pname,param);}
+  void glTextureParameterf (GLuint texture,GLenum pname,GLfloat       param ){setTextureParameter(texture,pname,GLint(param));}
+  void glTextureParameteriv(GLuint texture,GLenum pname,GLint   const*params){if(params)setTextureParameter(texture,pname,params[0]);}
+  void glTextureParameterfv(GLuint texture,GLenum pname,GLfloat const*params){if(params)setTextureParameter(texture,pname,GLint(params[0]));}
+  void glTexParameteri (GLenum target,GLenum pname,GLint         param ){glTextureParameteri (boundTexture(target),pname,param );}
+  void glTexParameterf (GLenum target,GLenum pname,GLfloat       param ){glTextureParameterf (boundTexture(target),pname,param );}
+  void glTexParameteriv(GLenum target,GLenum pname,GLint   const*params){glTextureParameteriv(boundTexture(target),pname,params);}
+  void glTexParameterfv(GLenum target,GLenum pname,GLfloat const*params){glTextureParameterfv(boundTexture(target),pname,params);}
+  void glGetTextureParameteriv(GLuint texture,GLenum pname,GLint  *params){if(params)*params = textureParameter(texture,pname);}
+  void glGetTextureParameterfv(GLuint texture,GLenum pname,GLfloat*params){if(params)*params = GLfloat(textureParameter(texture,pname));}
+  void glGetTexParameteriv    (GLenum target ,GLenum pname,GLint  *params){glGetTextureParameteriv(boundTexture(target),pname,params);}
+  void glGetTexParameterfv    (GLenum target ,GLenum pname,GLfloat*params){glGetTextureParameterfv(boundTexture(target),pname,params);}
+  void glGetTextureLevelParameteriv(GLuint texture,GLint level,GLenum pname,GLint  *params){if(params)*params = textureLevelParameter(texture,level,pname);}
+  void glGetTextureLevelParameterfv(GLuint texture,GLint level,GLenum pname,GLfloat*params){if(params)*params = GLfloat(textureLevelParameter(texture,level,pname));}
+  void glGetTexLevelParameteriv    (GLenum target ,GLint level,GLenum pname,GLint  *params){glGetTextureLevelParameteriv(boundTexture(target),level,pname,params);}
+  void glGetTexLevelParameterfv    (GLenum target ,GLint level,GLenum pname,GLfloat*params){glGetTextureLevelParameterfv(boundTexture(target),level,pname,params);}
+
+  //other objects
+  void      glGenSamplers             (GLsizei n,GLuint      *samplers){createObjects(GL_SAMPLER,n,samplers);}
+  void      glCreateSamplers          (GLsizei n,GLuint      *samplers){createObjects(GL_SAMPLER,n,samplers);}
+  void      glDeleteSamplers          (GLsizei n,GLuint const*samplers){deleteObjects(GL_SAMPLER,n,samplers);}
+  GLboolean glIsSampler               (GLuint sampler                 ){return isObject(GL_SAMPLER,sampler);}
+  void      glGenFramebuffers         (GLsizei n,GLuint      *framebuffers){createObjects(GL_FRAMEBUFFER,n,framebuffers);}
+  void      glCreateFramebuffers      (GLsizei n,GLuint      *framebuffers){createObjects(GL_FRAMEBUFFER,n,framebuffers);}
+  void      glDeleteFramebuffers      (GLsizei n,GLuint const*framebuffers){deleteObjects(GL_FRAMEBUFFER,n,framebuffers);}
+  GLboolean glIsFramebuffer           (GLuint framebuffer                 ){return isObject(GL_FRAMEBUFFER,framebuffer);}
+  void      glGenRenderbuffers        (GLsizei n,GLuint      *renderbuffers){createObjects(GL_RENDERBUFFER,n,renderbuffers);}
+  void      glCreateRenderbuffers     (GLsizei n,GLuint      *renderbuffers){createObjects(GL_RENDERBUFFER,n,renderbuffers);}
+  void      glDeleteRenderbuffers     (GLsizei n,GLuint const*renderbuffers){deleteObjects(GL_RENDERBUFFER,n,renderbuffers);}
+  GLboolean glIsRenderbuffer          (GLuint renderbuffer                 ){return isObject(GL_RENDERBUFFER,renderbuffer);}
+  void      glGenProgramPipelines     (GLsizei n,GLuint      *pipelines){createObjects(GL_PROGRAM_PIPELINE,n,pipelines);}
+  void      glCreateProgramPipelines  (GLsizei n,GLuint      *pipelines){createObjects(GL_PROGRAM_PIPELINE,n,pipelines);}
+  void      glDeleteProgramPipelines  (GLsizei n,GLuint const*pipelines){deleteObjects(GL_PROGRAM_PIPELINE,n,pipelines);}
+  GLboolean glIsProgramPipeline       (GLuint pipeline                 ){return isObject(GL_PROGRAM_PIPELINE,pipeline);}
+  void      glGenTransformFeedbacks   (GLsizei n,GLuint      *ids){createObjects(GL_TRANSFORM_FEEDBACK,n,ids);}
+  void      glCreateTransformFeedbacks(GLsizei n,GLuint      *ids){createObjects(GL_TRANSFORM_FEEDBACK,n,ids);}
+  void      glDeleteTransformFeedbacks(GLsizei n,GLuint const*ids){deleteObjects(GL_TRANSFORM_FEEDBACK,n,ids);}
+  GLboolean glIsTransformFeedback     (GLuint id                 ){return isObject(GL_TRANSFORM_FEEDBACK,id);}
+  void glBindFramebuffer(GLenum target,GLuint framebuffer){
+    auto&s = state();
+    if(target == GL_FRAMEBUFFER || target == GL_DRAW_FRAMEBUFFER)s.integers[GL_DRAW_FRAMEBUFFER_BINDING] = framebuffer;
+    if(target == GL_FRAMEBUFFER || target == GL_READ_FRAMEBUFFER)s.integers[GL_READ_FRAMEBUFFER_BINDING] = framebuffer;
+  }
+  void   glBindRenderbuffer        (GLenum,GLuint renderbuffer){state().integers[GL_RENDERBUFFER_BINDING      ] = renderbuffer;}
+  void   glBindProgramPipeline     (GLuint pipeline           ){state().integers[GL_PROGRAM_PIPELINE_BINDING  ] = pipeline    ;}
+  void   glBindTransformFeedback   (GLenum,GLuint id          ){state().integers[GL_TRANSFORM_FEEDBACK_BINDING] = id          ;}
+  void   glBindSampler             (GLuint unit,GLuint sampler){state().indexedIntegers[std::make_pair(GLenum(GL_SAMPLER_BINDING),unit)] = sampler;}
+  GLenum glCheckFramebufferStatus     (GLenum       ){return GL_FRAMEBUFFER_COMPLETE;}
+  GLenum glCheckNamedFramebufferStatus(GLuint,GLenum){return GL_FRAMEBUFFER_COMPLETE;}
+}
+
+#define GE_GL_NULL_EMULATE(name)\
+  static_assert(std::is_same<decltype(&emulation::name),decltype(&null_##name)>::value,"emulated "#name" has wrong type");\
+  functions[#name] = reinterpret_cast<FUNCTION_POINTER>(emulation::name)
+
+namespace{
+  std::unordered_map<std::string,FUNCTION_POINTER>createFunctions(){
+    std::unordered_map<std::string,FUNCTION_POINTER>functions;
+    for(auto const&x:nullFunctions)functions[x.first] = x.second;
+    GE_GL_NULL_EMULATE(glEnable);
+    GE_GL_NULL_EMULATE(glDisable);
+    GE_GL_NULL_EMULATE(glIsEnabled);
+    GE_GL_NULL_EMULATE(glViewport);
+    GE_GL_NULL_EMULATE(glScissor);
+    GE_GL_NULL_EMULATE(glPixelStorei);
+    GE_GL_NULL_EMULATE(glActiveTexture);
+    GE_GL_NULL_EMULATE(glGetIntegerv);
+    GE_GL_NULL_EMULATE(glGetInteger64v);
+    GE_GL_NULL_EMULATE(glGetFloatv);
+    GE_GL_NULL_EMULATE(glGetDoublev);
+    GE_GL_NULL_EMULATE(glGetBooleanv);
+    GE_GL_NULL_EMULATE(glGetIntegeri_v);
+    GE_GL_NULL_EMULATE(glGetInteger64i_v);
+    GE_GL_NULL_EMULATE(glGetString);
+    GE_GL_NULL_EMULATE(glGetStringi);
+    GE_GL_NULL_EMULATE(glMaxShaderCompilerThreadsARB);
+
+    GE_GL_NULL_EMULATE(glGenBuffers);
+    GE_GL_NULL_EMULATE(glCreateBuffers);
+    GE_GL_NULL_EMULATE(glIsBuffer);
+    GE_GL_NULL_EMULATE(glDeleteBuffers);
+    GE_GL_NULL_EMULATE(glBindBuffer);
+    GE_GL_NULL_EMULATE(glBindBufferRange);
+    GE_GL_NULL_EMULATE(glBindBufferBase);
+    GE_GL_NULL_EMULATE(glBindBuffersBase);
+    GE_GL_NULL_EMULATE(glBindBuffersRange);
+    GE_GL_NULL_EMULATE(glNamedBufferData);
+    GE_GL_NULL_EMULATE(glNamedBufferStorage);
+    GE_GL_NULL_EMULATE(glBufferData);
+    GE_GL_NULL_EMULATE(glBufferStorage);
+    GE_GL_NULL_EMULATE(glNamedBufferSubData);
+    GE_GL_NULL_EMULATE(glGetNamedBufferSubData);
+    GE_GL_NULL_EMULATE(glBufferSubData);
+    GE_GL_NULL_EMULATE(glGetBufferSubData);
+    GE_GL_NULL_EMULATE(glCopyNamedBufferSubData);
+    GE_GL_NULL_EMULATE(glCopyBufferSubData);
+    GE_GL_NULL_EMULATE(glClearNamedBufferSubData);
+    GE_GL_NULL_EMULATE(glClearNamedBufferData);
+    GE_GL_NULL_EMULATE(glClearBufferSubData);
+    GE_GL_NULL_EMULATE(glClearBufferData);
+    GE_GL_NULL_EMULATE(glMapNamedBufferRange);
+    GE_GL_NULL_EMULATE(glMapNamedBuffer);
+    GE_GL_NULL_EMULATE(glMapBuffer);
+    GE_GL_NULL_EMULATE(glMapBufferRange);
+    GE_GL_NULL_EMULATE(glUnmapNamedBuffer);
+    GE_GL_NULL_EMULATE(glUnmapBuffer);
+    GE_GL_NULL_EMULATE(glGetNamedBufferParameteriv);
+    GE_GL_NULL_EMULATE(glGetNamedBufferParameteri64v);
+    GE_GL_NULL_EMULATE(glGetBufferParameteriv);
+    GE_GL_NULL_EMULATE(glGetBufferParameteri64v);
+    GE_GL_NULL_EMULATE(glGetNamedBufferPointerv);
+    GE_GL_NULL_EMULATE(glGetBufferPointerv);
+
+    GE_GL_NULL_EMULATE(glGenVertexArrays);
+    GE_GL_NULL_EMULATE(glCreateVertexArrays);
+    GE_GL_NULL_EMULATE(glIsVertexArray);
+    GE_GL_NULL_EMULATE(glDeleteVertexArrays);
+    GE_GL_NULL_EMULATE(glBindVertexArray);
+    GE_GL_NULL_EMULATE(glVertexArrayElementBuffer);
+    GE_GL_NULL_EMULATE(glEnableVertexArrayAttrib);
+    GE_GL_NULL_EMULATE(glDisableVertexArrayAttrib);
+    GE_GL_NULL_EMULATE(glEnableVertexAttribArray);
+    GE_GL_NULL_EMULATE(glDisableVertexAttribArray);
+    GE_GL_NULL_EMULATE(glVertexArrayAttribFormat);
+    GE_GL_NULL_EMULATE(glVertexArrayAttribIFormat);
+    GE_GL_NULL_EMULATE(glVertexArrayAttribLFormat);
+    GE_GL_NULL_EMULATE(glVertexAttribFormat);
+    GE_GL_NULL_EMULATE(glVertexAttribIFormat);
+    GE_GL_NULL_EMULATE(glVertexAttribLFormat);
+    GE_GL_NULL_EMULATE(glVertexArrayAttribBinding);
+    GE_GL_NULL_EMULATE(glVertexAttribBinding);
+    GE_GL_NULL_EMULATE(glVertexArrayVertexBuffer);
+    GE_GL_NULL_EMULATE(glBindVertexBuffer);
+    GE_GL_NULL_EMULATE(glVertexArrayBindingDivisor);
+    GE_GL_NULL_EMULATE(glVertexBindingDivisor);
+    GE_GL_NULL_EMULATE(glVertexAttribDivisor);
+    GE_GL_NULL_EMULATE(glVertexAttribPointer);
+    GE_GL_NULL_EMULATE(glVertexAttribIPointer);
+    GE_GL_NULL_EMULATE(glVertexAttribLPointer);
+    GE_GL_NULL_EMULATE(glGetVertexArrayIndexediv);
+    GE_GL_NULL_EMULATE(glGetVertexArrayIndexed64iv);
+    GE_GL_NULL_EMULATE(glGetVertexAttribiv);
+    GE_GL_NULL_EMULATE(glGetVertexArrayiv);
+
+    GE_GL_NULL_EMULATE(glCreateShader);
+    GE_GL_NULL_EMULATE(glDeleteShader);
+    GE_GL_NULL_EMULATE(glIsShader);
+    GE_GL_NULL_EMULATE(glShaderSource);
+    GE_GL_NULL_EMULATE(glCompileShader);
+    GE_GL_NULL_EMULATE(glGetShaderiv);
+    GE_GL_NULL_EMULATE(glGetShaderSource);
+    GE_GL_NULL_EMULATE(glGetShaderInfoLog);
+    GE_GL_NULL_EMULATE(glGetProgramInfoLog);
+    GE_GL_NULL_EMULATE(glCreateProgram);
+    GE_GL_NULL_EMULATE(glDeleteProgram);
+    GE_GL_NULL_EMULATE(glIsProgram);
+    GE_GL_NULL_EMULATE(glAttachShader);
+    GE_GL_NULL_EMULATE(glDetachShader);
+    GE_GL_NULL_EMULATE(glGetAttachedShaders);
+    GE_GL_NULL_EMULATE(glLinkProgram);
+    GE_GL_NULL_EMULATE(glGetProgramBinary);
+    GE_GL_NULL_EMULATE(glProgramBinary);
+    GE_GL_NULL_EMULATE(glUseProgram);
+    GE_GL_NULL_EMULATE(glGetProgramiv);
+    GE_GL_NULL_EMULATE(glGetActiveUniform);
+    GE_GL_NULL_EMULATE(glGetActiveAttrib);
+    GE_GL_NULL_EMULATE(glGetUniformLocation);
+    GE_GL_NULL_EMULATE(glGetAttribLocation);
+    GE_GL_NULL_EMULATE(glGetProgramInterfaceiv);
+    GE_GL_NULL_EMULATE(glGetProgramResourceIndex);
+    GE_GL_NULL_EMULATE(glGetProgramResourceLocation);
+    GE_GL_NULL_EMULATE(glGetProgramResourceName);
+    GE_GL_NULL_EMULATE(glGetProgramResourceiv);
+
+    GE_GL_NULL_EMULATE(glFenceSync);
+    GE_GL_NULL_EMULATE(glDeleteSync);
+    GE_GL_NULL_EMULATE(glIsSync);
+    GE_GL_NULL_EMULATE(glClientWaitSync);
+    GE_GL_NULL_EMULATE(glGetSynciv);
+
+    GE_GL_NULL_EMULATE(glGenQueries);
+    GE_GL_NULL_EMULATE(glCreateQueries);
+    GE_GL_NULL_EMULATE(glIsQuery);
+    GE_GL_NULL_EMULATE(glDeleteQueries);
+    GE_GL_NULL_EMULATE(glBeginQuery);
+    GE_GL_NULL_EMULATE(glEndQuery);
+    GE_GL_NULL_EMULATE(glBeginQueryIndexed);
+    GE_GL_NULL_EMULATE(glEndQueryIndexed);
+    GE_GL_NULL_EMULATE(glQueryCounter);
+    GE_GL_NULL_EMULATE(glGetQueryiv);
+    GE_GL_NULL_EMULATE(glGetQueryObjectiv);
+    GE_GL_NULL_EMULATE(glGetQueryObjectuiv);
+    GE_GL_NULL_EMULATE(glGetQueryObjecti64v);
+    GE_GL_NULL_EMULATE(glGetQueryObjectui64v);
+
+    GE_GL_NULL_EMULATE(glGenTextures);
+    GE_GL_NULL_EMULATE(glCreateTextures);
+    GE_GL_NULL_EMULATE(glIsTexture);
+    GE_GL_NULL_EMULATE(glDeleteTextures);
+    GE_GL_NULL_EMULATE(glBindTexture);
+    GE_GL_NULL_EMULATE(glBindTextureUnit);
+    GE_GL_NULL_EMULATE(glBindTextures);
+    GE_GL_NULL_EMULATE(glTextureStorage1D);
+    GE_GL_NULL_EMULATE(glTextureStorage2D);
+    GE_GL_NULL_EMULATE(glTextureStorage3D);
+    GE_GL_NULL_EMULATE(glTexStorage1D);
+    GE_GL_NULL_EMULATE(glTexStorage2D);
+    GE_GL_NULL_EMULATE(glTexStorage3D);
+    GE_GL_NULL_EMULATE(glTexImage1D);
+    GE_GL_NULL_EMULATE(glTexImage2D);
+    GE_GL_NULL_EMULATE(glTexImage3D);
+    GE_GL_NULL_EMULATE(glTextureImage1DEXT);
+    GE_GL_NULL_EMULATE(glTextureImage2DEXT);
+    GE_GL_NULL_EMULATE(glTextureImage3DEXT);
+    GE_GL_NULL_EMULATE(glGenerateTextureMipmap);
+    GE_GL_NULL_EMULATE(glGenerateMipmap);
+    GE_GL_NULL_EMULATE(glTextureParameteri);
+    GE_GL_NULL_EMULATE(glTextureParameterf);
+    GE_GL_NULL_EMULATE(glTextureParameteriv);
+    GE_GL_NULL_EMULATE(glTextureParameterfv);
+    GE_GL_NULL_EMULATE(glTexParameteri);
+    GE_GL_NULL_EMULATE(glTexParameterf);
+    GE_GL_NULL_EMULATE(glTexParameteriv);
+    GE_GL_NULL_EMULATE(glTexParameterfv);
+    GE_GL_NULL_EMULATE(glGetTextureParameteriv);
+    GE_GL_NULL_EMULATE(glGetTextureParameterfv);
+    GE_GL_NULL_EMULATE(glGetTexParameteriv);
+    GE_GL_NULL_EMULATE(glGetTexParameterfv);
+    GE_GL_NULL_EMULATE(glGetTextureLevelParameteriv);
+    GE_GL_NULL_EMULATE(glGetTextureLevelParameterfv);
+    GE_GL_NULL_EMULATE(glGetTexLevelParameteriv);
+    GE_GL_NULL_EMULATE(glGetTexLevelParameterfv);
+
+    GE_GL_NULL_EMULATE(glGenSamplers);
+    GE_GL_NULL_EMULATE(glCreateSamplers);
+    GE_GL_NULL_EMULATE(glDeleteSamplers);
+    GE_GL_NULL_EMULATE(glIsSampler);
+    GE_GL_NULL_EMULATE(glGenFramebuffers);
+    GE_GL_NULL_EMULATE(glCreateFramebuffers);
+    GE_GL_NULL_EMULATE(glDeleteFramebuffers);
+    GE_GL_NULL_EMULATE(glIsFramebuffer);
+    GE_GL_NULL_EMULATE(glGenRenderbuffers);
+    GE_GL_NULL_EMULATE(glCreateRenderbuffers);
+    GE_GL_NULL_EMULATE(glDeleteRenderbuffers);
+    GE_GL_NULL_EMULATE(glIsRenderbuffer);
+    GE_GL_NULL_EMULATE(glGenProgramPipelines);
+    GE_GL_NULL_EMULATE(glCreateProgramPipelines);
+    GE_GL_NULL_EMULATE(glDeleteProgramPipelines);
+    GE_GL_NULL_EMULATE(glIsProgramPipeline);
+    GE_GL_NULL_EMULATE(glGenTransformFeedbacks);
+    GE_GL_NULL_EMULATE(glCreateTransformFeedbacks);
+    GE_GL_NULL_EMULATE(glDeleteTransformFeedbacks);
+    GE_GL_NULL_EMULATE(glIsTransformFeedback);
+    GE_GL_NULL_EMULATE(glBindFramebuffer);
+    GE_GL_NULL_EMULATE(glBindRenderbuffer);
+    GE_GL_NULL_EMULATE(glBindProgramPipeline);
+    GE_GL_NULL_EMULATE(glBindTransformFeedback);
+    GE_GL_NULL_EMULATE(glBindSampler);
+    GE_GL_NULL_EMULATE(glCheckFramebufferStatus);
+    GE_GL_NULL_EMULATE(glCheckNamedFramebufferStatus);
+    return functions;
+  }
+}
+
+NullLoader::NullLoader(){
+  assert(this!=nullptr);
+  this->_state = std::make_shared<State>();
+  this->makeCurrent();
+}
+
+NullLoader::~NullLoader(){
+}
+
+/**
+ * @brief returns emulated or empty OpenGL function
+ *
+ * @param fceName name of OpenGL function
+ *
+ * @return function pointer, nullptr if the function is not OpenGL function
+ * or if it was replaced by nullptr
+ */
+FUNCTION_POINTER NullLoader::load(char const*fceName)const{
+  assert(this!=nullptr);
+  auto jj = this->_functions.find(fceName);
+  if(jj != this->_functions.end())return jj->second;
+  static auto const functions = createFunctions();
+  auto ii = functions.find(fceName);
+  if(ii == functions.end())return nullptr;
+  return ii->second;
+}
+
+/**
+ * @brief makes state of this loader current in calling thread
+ * Loaded functions of all loaders work with the current state.
+ */
+void NullLoader::makeCurrent(){
+  assert(this!=nullptr);
+  current = this->_state;
+}
+
+bool NullLoader::isCurrent()const{
+  assert(this!=nullptr);
+  return current == this->_state;
+}
+
+/**
+ * @brief sets value returned by glGetIntegerv
+ * It can be used to emulate different limits (GL_MAX_VERTEX_ATTRIBS, ...).
+ *
+ * @param pname parameter name
+ * @param value value
+ */
+void NullLoader::setInteger(GLenum pname,GLint64 value){
+  assert(this!=nullptr);
+  this->_state->integers[pname] = value;
+}
+
+/**
+ * @brief emulates asynchronous compilation of shaders and linking of programs
+ * After glCompileShader and glLinkProgram, GL_COMPLETION_STATUS_ARB reports
+ * unfinished work for the given number of queries.
+ * Any other query of the shader or program waits for completion.
+ *
+ * @param nofQueries number of queries, 0 means that compilation finishes immediately
+ */
+void NullLoader::setCompileLatency(GLuint nofQueries){
+  assert(this!=nullptr);
+  this->_state->compileLatency = nofQueries;
+}
+
+/**
+ * @brief emulates latency of queries
+ * After glEndQuery and glQueryCounter, GL_QUERY_RESULT_AVAILABLE reports
+ * unavailable result for the given number of queries.
+ * GL_QUERY_RESULT waits for the result.
+ *
+ * @param nofQueries number of queries, 0 means that results are available immediately
+ */
+void NullLoader::setQueryLatency(GLuint nofQueries){
+  assert(this!=nullptr);
+  this->_state->queryLatency = nofQueries;
+}
+
+GLint64 NullLoader::getInteger(GLenum pname)const{
+  assert(this!=nullptr);
+  return ::getInteger(*this->_state,pname);
+}
+
+/**
+ * @brief returns number of living emulated objects
+ * It can be used to check that all objects were deleted.
+ *
+ * @return number of objects including sync objects
+ */
+size_t NullLoader::getNofObjects()const{
+  assert(this!=nullptr);
+  return this->_state->objects.size()+this->_state->syncs.size();
+}
+
+/**
+ * @brief replaces emulated OpenGL function
+ * Replaced function is returned by subsequent load calls, so it has to be set
+ * before the function table is constructed. Tests use it to log or count calls,
+ * nullptr emulates missing function.
+ *
+ * @param fceName name of OpenGL function
+ * @param function function with signature of the OpenGL function
+ */
+void NullLoader::setFunction(char const*fceName,FUNCTION_POINTER function){
+  assert(this!=nullptr);
+  this->_functions[fceName] = function;
+}
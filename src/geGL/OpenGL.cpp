@@ -5,6 +5,7 @@
 #include<geGL/DSATableDecorator.h>
 #include<geGL/CapabilitiesTableDecorator.h>
 #include<geGL/TrapTableDecorator.h>
+#include<geGL/StateCacheTableDecorator.h>
 #include<geGL/OpenGLCapabilities.h>
 #include<geGL/OpenGLContext.h>
 
@@ -13,6 +14,14 @@ thread_local ge::gl::ContextPointer       _defaultOpenGLContext       = nullptr;
 
 using namespace ge::gl;
 
+using StateCachingTable =
+  TrapTableDecorator<
+  CapabilitiesTableDecorator<
+  StateCacheTableDecorator<
+  DSATableDecorator<
+  LoaderTableDecorator<
+  FunctionTable>>>>>;
+
 /**
  * @brief Function returns default, global OpenGLFunctionTable
  *
@@ -70,6 +79,37 @@ FunctionTablePointer ge::gl::createTable(FunctionLoaderInterfacePointer const&lo
   return table;
 }
 
+/**
+ * @brief Function creates OpenGL function table that eliminates redundant state changes
+ * Function table is decorated like in createTable and StateCacheTableDecorator is placed above DSATableDecorator.
+ * It can be used only if all OpenGL calls of the context go through this table.
+ *
+ * @param loader valid FunctionLoaderInterface that can load OpenGL functions
+ *
+ * @return OpenGLFunctionTable
+ */
+FunctionTablePointer ge::gl::createStateCachingTable(FunctionLoaderInterfacePointer const&loader){
+  auto table = std::make_shared<StateCachingTable>(loader);
+  table->construct();
+  return table;
+}
+
+/**
+ * @brief Function forgets shadow state of table created by createStateCachingTable
+ * It has to be called when OpenGL state is changed without the table
+ * (other library, another table, shared context).
+ *
+ * @param table OpenGLFunctionTable
+ *
+ * @return false if the table was not created by createStateCachingTable
+ */
+bool ge::gl::invalidateStateCache(FunctionTablePointer const&table){
+  auto const stateCachingTable = std::dynamic_pointer_cast<StateCachingTable const>(table);
+  if(!stateCachingTable)return false;
+  stateCachingTable->invalidateStateCache();
+  return true;
+}
+
 /**
  * @brief Function creates Context instance
  *
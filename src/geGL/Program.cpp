@@ -4,6 +4,9 @@
 #include<iostream>
 #include<string>
 #include<limits>
+#include<algorithm>
+#include<cstring>
+#include<atomic>
 #include<geCore/ErrorPrinter.h>
 
 using namespace ge::gl;
@@ -123,6 +126,7 @@ void Program::detachShaders(ShaderPointers const&shaders){
 
 /**
  * @brief link program with optional additional vector of compiled shaders
+ * Reflection (getInfo(), uniform handles, buffer bindings) is filled by the first use of it.
  *
  * @param shaders optional vector fo compiled shaders
  */
@@ -133,7 +137,60 @@ void Program::link(ShaderPointers const&shaders){
   if(!this->getLinkStatus()){
     std::cerr<<this->getInfoLog()<<std::endl;
   }
-  this->_fillInfo();
+  this->invalidateUniformCache();
+  this->_infoPending = true;
+}
+
+/**
+ * @brief starts linking of program with optional additional vector of shaders
+ * It does not wait for the linking, shaders can still be compiled (see Shader::compileAsync).
+ * Driver with GL_KHR_parallel_shader_compile links in background threads,
+ * so many programs can be compiled and linked at once and polled by isLinkCompleted().
+ * Info log is printed and reflection is filled by the first use of reflection
+ * (getInfo(), uniform handles, set* by name, buffer bindings).
+ *
+ * @param shaders optional vector of shaders
+ */
+void Program::linkAsync(ShaderPointers const&shaders){
+  assert(this!=nullptr);
+  this->attachShaders(shaders);
+  this->_parallelCompile = Shader::isParallelCompileSupported(this->_gl);
+  this->_gl.glLinkProgram(this->_id);
+  this->invalidateUniformCache();
+  this->_infoPending     = true;
+  this->_checkLinkStatus = true;
+}
+
+/**
+ * @brief polls linking started by linkAsync
+ * It does not block. Without GL_KHR_parallel_shader_compile, it always returns true
+ * and the linking is finished by the next query.
+ *
+ * @return true if the linking is finished
+ */
+bool Program::isLinkCompleted()const{
+  assert(this!=nullptr);
+  if(!this->_parallelCompile)return true;
+  return this->_getParam(GL_COMPLETION_STATUS_ARB) != GL_FALSE;
+}
+
+/**
+ * @brief fills reflection of linked program if it has not been filled yet
+ * It waits for the linking.
+ */
+void Program::_ensureInfo()const{
+  assert(this!=nullptr);
+  if(!this->_infoPending)return;
+  this->_infoPending = false;
+  if(this->_checkLinkStatus){
+    this->_checkLinkStatus = false;
+    if(!this->getLinkStatus()){
+      for(auto const&x:this->_shaders)
+        if(!x->getCompileStatus())std::cerr<<x->getInfoLog()<<std::endl;
+      std::cerr<<this->getInfoLog()<<std::endl;
+    }
+  }
+  const_cast<Program*>(this)->_fillInfo();
 }
 
 /**
@@ -286,6 +343,57 @@ GLuint    Program::getBinaryLength()const{
   return this->_getParam(GL_PROGRAM_BINARY_LENGTH);
 }
 
+/**
+ * @brief sets GL_PROGRAM_BINARY_RETRIEVABLE_HINT
+ * It should be set before linking if the binary is going to be retrieved by getBinary().
+ *
+ * @param hint GL_TRUE if the binary is going to be retrieved
+ */
+void Program::setBinaryRetrievableHint(GLboolean hint){
+  assert(this!=nullptr);
+  this->create();
+  this->_gl.glProgramParameteri(this->_id,GL_PROGRAM_BINARY_RETRIEVABLE_HINT,hint);
+}
+
+/**
+ * @brief gets binary of linked program
+ *
+ * @param format returned implementation dependent format of binary
+ *
+ * @return binary, empty if the program has no binary
+ */
+std::vector<uint8_t>Program::getBinary(GLenum&format)const{
+  assert(this!=nullptr);
+  format = 0;
+  std::vector<uint8_t>binary(this->getBinaryLength());
+  if(binary.empty())return binary;
+  GLsizei length = 0;
+  this->_gl.glGetProgramBinary(this->_id,GLsizei(binary.size()),&length,&format,binary.data());
+  binary.resize(size_t(std::max(length,0)));
+  return binary;
+}
+
+/**
+ * @brief loads program from binary obtained by getBinary()
+ * Binary is rejected by driver if it was created by different driver or hardware.
+ * Program is usable only if this function returns true.
+ *
+ * @param format format of binary
+ * @param binary binary data
+ * @param length size of binary in bytes
+ *
+ * @return true if the program was successfully loaded
+ */
+bool Program::setBinary(GLenum format,void const*binary,GLsizei length){
+  assert(this!=nullptr);
+  this->create();
+  this->_gl.glProgramBinary(this->_id,format,binary,length);
+  this->_checkLinkStatus = false;
+  this->invalidateUniformCache();
+  this->_infoPending = true;
+  return this->getLinkStatus() != GL_FALSE;
+}
+
 /**
  * @brief gets compute shaders work group size
  *
@@ -413,249 +521,570 @@ GLint Program::getResourceParam(GLenum interf,GLenum pname,GLuint index)const{
   return param;
 }
 
-#define GE_GL_PROGRAM_SET(fce,type,...)\
+#define GE_GL_PROGRAM_SET(fce,uniformType,ctype,...)\
   assert(this!=nullptr);\
-  auto ii = this->_info->uniforms.find(name);\
-  if(ii==this->_info->uniforms.end()){\
-    if(printUniformWarnings)\
-      ge::core::printError(GE_CORE_FCENAME,"there is no such uniform",name);\
-    return this;\
-  }\
-  assert(std::get<ProgramInfo::TYPE>(this->_info->uniforms[name]) == type);\
-  std::get<ProgramInfo::LOCATION>(ii->second);\
-  this->_gl.fce(this->_id,std::get<ProgramInfo::LOCATION>(ii->second),__VA_ARGS__);\
+  if(!handle.isValid())return this;\
+  assert(handle.type == uniformType);\
+  ctype const values[] = {__VA_ARGS__};\
+  if(this->_updateUniformCache(handle,values,sizeof(values),1))\
+    this->_gl.fce(this->_id,handle.location,__VA_ARGS__);\
   return this
 
 #define GE_GL_PROGRAM_SETI(fce,type0,type1,...)\
   assert(this!=nullptr);\
-  auto ii = this->_info->uniforms.find(name);\
-  if(ii==this->_info->uniforms.end()){\
-    if(printUniformWarnings)\
-      ge::core::printError(GE_CORE_FCENAME,"there is no such uniform",name);\
-    return this;\
-  }\
+  if(!handle.isValid())return this;\
   assert(\
-      std::get<ProgramInfo::TYPE>(this->_info->uniforms[name]) == type0 ||\
-      std::get<ProgramInfo::TYPE>(this->_info->uniforms[name]) == type1);\
-  std::get<ProgramInfo::LOCATION>(ii->second);\
-  this->_gl.fce(this->_id,std::get<ProgramInfo::LOCATION>(ii->second),__VA_ARGS__);\
+      handle.type == type0 ||\
+      handle.type == type1);\
+  int32_t const values[] = {__VA_ARGS__};\
+  if(this->_updateUniformCache(handle,values,sizeof(values),1))\
+    this->_gl.fce(this->_id,handle.location,__VA_ARGS__);\
   return this
 
-#define GE_GL_PROGRAM_SETV(fce,type)\
+#define GE_GL_PROGRAM_SETV(fce,uniformType,nofComponents)\
   assert(this!=nullptr);\
-  auto ii = this->_info->uniforms.find(name);\
-  if(ii==this->_info->uniforms.end()){\
-    if(printUniformWarnings)\
-      ge::core::printError(GE_CORE_FCENAME,"there is no such uniform",name);\
-    return this;\
-  }\
-  assert(std::get<ProgramInfo::TYPE>(this->_info->uniforms[name]) == type);\
-  assert(count<=std::get<ProgramInfo::SIZE>(this->_info->uniforms[name]));\
-  this->_gl.fce(this->_id,std::get<ProgramInfo::LOCATION>(ii->second),count,v0);\
+  if(!handle.isValid())return this;\
+  assert(handle.type == uniformType);\
+  assert(count<=handle.size);\
+  if(this->_updateUniformCache(handle,v0,sizeof(*v0)*nofComponents,count))\
+    this->_gl.fce(this->_id,handle.location,count,v0);\
   return this
 
-#define GE_GL_PROGRAM_SETIV(fce,type0,type1)\
+#define GE_GL_PROGRAM_SETIV(fce,type0,type1,nofComponents)\
   assert(this!=nullptr);\
-  auto ii = this->_info->uniforms.find(name);\
-  if(ii==this->_info->uniforms.end()){\
-    if(printUniformWarnings)\
-      ge::core::printError(GE_CORE_FCENAME,"there is no such uniform",name);\
-    return this;\
-  }\
+  if(!handle.isValid())return this;\
   assert(\
-      std::get<ProgramInfo::TYPE>(this->_info->uniforms[name]) == type0 ||\
-      std::get<ProgramInfo::TYPE>(this->_info->uniforms[name]) == type1);\
-  assert(count<=std::get<ProgramInfo::SIZE>(this->_info->uniforms[name]));\
-  this->_gl.fce(this->_id,std::get<ProgramInfo::LOCATION>(ii->second),count,v0);\
+      handle.type == type0 ||\
+      handle.type == type1);\
+  assert(count<=handle.size);\
+  if(this->_updateUniformCache(handle,v0,sizeof(*v0)*nofComponents,count))\
+    this->_gl.fce(this->_id,handle.location,count,v0);\
   return this
 
-
-#define GE_GL_PROGRAM_SETMATRIX(fce,type)\
+//transposed matrices are not cached, the shadow copy holds only untransposed values
+#define GE_GL_PROGRAM_SETMATRIX(fce,uniformType,nofComponents)\
   assert(this!=nullptr);\
-  auto ii = this->_info->uniforms.find(name);\
-  if(ii==this->_info->uniforms.end()){\
-    if(printUniformWarnings)\
-      ge::core::printError(GE_CORE_FCENAME,"there is no such uniform",name);\
-    return this;\
-  }\
-  assert(std::get<ProgramInfo::TYPE>(this->_info->uniforms[name]) == type);\
-  assert(count<=std::get<ProgramInfo::SIZE>(this->_info->uniforms[name]));\
-  this->_gl.fce(this->_id,std::get<ProgramInfo::LOCATION>(ii->second),count,transpose,v0);\
+  if(!handle.isValid())return this;\
+  assert(handle.type == uniformType);\
+  assert(count<=handle.size);\
+  if(transpose)\
+    this->_invalidateUniformCache(handle,count);\
+  if(transpose || this->_updateUniformCache(handle,v0,sizeof(*v0)*nofComponents,count))\
+    this->_gl.fce(this->_id,handle.location,count,transpose,v0);\
   return this
 
 
 
+Program const* Program::set1f(UniformHandle const&handle,float v0)const{
+  GE_GL_PROGRAM_SET(glProgramUniform1f,GL_FLOAT,float,v0);
+}
+
+Program const* Program::set2f(UniformHandle const&handle,float v0,float v1)const{
+  GE_GL_PROGRAM_SET(glProgramUniform2f,GL_FLOAT_VEC2,float,v0,v1);
+}
+
+Program const* Program::set3f(UniformHandle const&handle,float v0,float v1,float v2)const{
+  GE_GL_PROGRAM_SET(glProgramUniform3f,GL_FLOAT_VEC3,float,v0,v1,v2);
+}
+
+Program const* Program::set4f(UniformHandle const&handle,float v0,float v1,float v2,float v3)const{
+  GE_GL_PROGRAM_SET(glProgramUniform4f,GL_FLOAT_VEC4,float,v0,v1,v2,v3);
+}
+
+Program const* Program::set1i(UniformHandle const&handle,int32_t v0)const{
+  GE_GL_PROGRAM_SETI(glProgramUniform1i,GL_INT,GL_BOOL,v0);
+}
+
+Program const* Program::set2i(UniformHandle const&handle,int32_t v0,int32_t v1)const{
+  GE_GL_PROGRAM_SETI(glProgramUniform2i,GL_INT_VEC2,GL_BOOL_VEC2,v0,v1);
+}
+
+Program const* Program::set3i(UniformHandle const&handle,int32_t v0,int32_t v1,int32_t v2)const{
+  GE_GL_PROGRAM_SETI(glProgramUniform3i,GL_INT_VEC3,GL_BOOL_VEC3,v0,v1,v2);
+}
+
+Program const* Program::set4i(UniformHandle const&handle,int32_t v0,int32_t v1,int32_t v2,int32_t v3)const{
+  GE_GL_PROGRAM_SETI(glProgramUniform4i,GL_INT_VEC4,GL_BOOL_VEC4,v0,v1,v2,v3);
+}
+
+Program const* Program::set1ui(UniformHandle const&handle,uint32_t v0)const{
+  GE_GL_PROGRAM_SET(glProgramUniform1ui,GL_UNSIGNED_INT,uint32_t,v0);
+}
+
+Program const* Program::set2ui(UniformHandle const&handle,uint32_t v0,uint32_t v1)const{
+  GE_GL_PROGRAM_SET(glProgramUniform2ui,GL_UNSIGNED_INT_VEC2,uint32_t,v0,v1);
+}
+
+Program const* Program::set3ui(UniformHandle const&handle,uint32_t v0,uint32_t v1,uint32_t v2)const{
+  GE_GL_PROGRAM_SET(glProgramUniform3ui,GL_UNSIGNED_INT_VEC3,uint32_t,v0,v1,v2);
+}
+
+Program const* Program::set4ui(UniformHandle const&handle,uint32_t v0,uint32_t v1,uint32_t v2,uint32_t v3)const{
+  GE_GL_PROGRAM_SET(glProgramUniform4ui,GL_UNSIGNED_INT_VEC4,uint32_t,v0,v1,v2,v3);
+}
+
+Program const* Program::set1fv(UniformHandle const&handle,float const*v0,GLsizei count)const{
+  GE_GL_PROGRAM_SETV(glProgramUniform1fv,GL_FLOAT,1);
+}
+
+Program const* Program::set2fv(UniformHandle const&handle,float const*v0,GLsizei count)const{
+  GE_GL_PROGRAM_SETV(glProgramUniform2fv,GL_FLOAT_VEC2,2);
+}
+
+Program const* Program::set3fv(UniformHandle const&handle,float const*v0,GLsizei count)const{
+  GE_GL_PROGRAM_SETV(glProgramUniform3fv,GL_FLOAT_VEC3,3);
+}
+
+Program const* Program::set4fv(UniformHandle const&handle,float const*v0,GLsizei count)const{
+  GE_GL_PROGRAM_SETV(glProgramUniform4fv,GL_FLOAT_VEC4,4);
+}
+
+Program const* Program::set1iv(UniformHandle const&handle,int32_t const*v0,GLsizei count)const{
+  GE_GL_PROGRAM_SETIV(glProgramUniform1iv,GL_INT,GL_BOOL,1);
+}
+
+Program const* Program::set2iv(UniformHandle const&handle,int32_t const*v0,GLsizei count)const{
+  GE_GL_PROGRAM_SETIV(glProgramUniform2iv,GL_INT_VEC2,GL_BOOL_VEC2,2);
+}
+
+Program const* Program::set3iv(UniformHandle const&handle,int32_t const*v0,GLsizei count)const{
+  GE_GL_PROGRAM_SETIV(glProgramUniform3iv,GL_INT_VEC3,GL_BOOL_VEC3,3);
+}
+
+Program const* Program::set4iv(UniformHandle const&handle,int32_t const*v0,GLsizei count)const{
+  GE_GL_PROGRAM_SETIV(glProgramUniform4iv,GL_INT_VEC4,GL_BOOL_VEC4,4);
+}
+
+Program const* Program::set1uiv(UniformHandle const&handle,uint32_t const*v0,GLsizei count)const{
+  GE_GL_PROGRAM_SETV(glProgramUniform1uiv,GL_UNSIGNED_INT,1);
+}
+
+Program const* Program::set2uiv(UniformHandle const&handle,uint32_t const*v0,GLsizei count)const{
+  GE_GL_PROGRAM_SETV(glProgramUniform2uiv,GL_UNSIGNED_INT_VEC2,2);
+}
+
+Program const* Program::set3uiv(UniformHandle const&handle,uint32_t const*v0,GLsizei count)const{
+  GE_GL_PROGRAM_SETV(glProgramUniform3uiv,GL_UNSIGNED_INT_VEC3,3);
+}
+
+Program const* Program::set4uiv(UniformHandle const&handle,uint32_t const*v0,GLsizei count)const{
+  GE_GL_PROGRAM_SETV(glProgramUniform4uiv,GL_UNSIGNED_INT_VEC4,4);
+}
+
+Program const* Program::setMatrix4fv(UniformHandle const&handle,float const*v0,GLsizei count,GLboolean transpose)const{
+  GE_GL_PROGRAM_SETMATRIX(glProgramUniformMatrix4fv,GL_FLOAT_MAT4,16);
+}
+
+Program const* Program::setMatrix3fv(UniformHandle const&handle,float const*v0,GLsizei count,GLboolean transpose)const{
+  GE_GL_PROGRAM_SETMATRIX(glProgramUniformMatrix3fv,GL_FLOAT_MAT3,9);
+}
+
+Program const* Program::setMatrix2fv(UniformHandle const&handle,float const*v0,GLsizei count,GLboolean transpose)const{
+  GE_GL_PROGRAM_SETMATRIX(glProgramUniformMatrix2fv,GL_FLOAT_MAT2,4);
+}
+
+Program const* Program::setMatrix4x3fv(UniformHandle const&handle,float const*v0,GLsizei count,GLboolean transpose)const{
+  GE_GL_PROGRAM_SETMATRIX(glProgramUniformMatrix4x3fv,GL_FLOAT_MAT4x3,12);
+}
+
+Program const* Program::setMatrix4x2fv(UniformHandle const&handle,float const*v0,GLsizei count,GLboolean transpose)const{
+  GE_GL_PROGRAM_SETMATRIX(glProgramUniformMatrix4x2fv,GL_FLOAT_MAT4x2,8);
+}
+
+Program const* Program::setMatrix3x4fv(UniformHandle const&handle,float const*v0,GLsizei count,GLboolean transpose)const{
+  GE_GL_PROGRAM_SETMATRIX(glProgramUniformMatrix3x4fv,GL_FLOAT_MAT3x4,12);
+}
+
+Program const* Program::setMatrix3x2fv(UniformHandle const&handle,float const*v0,GLsizei count,GLboolean transpose)const{
+  GE_GL_PROGRAM_SETMATRIX(glProgramUniformMatrix3x2fv,GL_FLOAT_MAT3x2,6);
+}
+
+Program const* Program::setMatrix2x4fv(UniformHandle const&handle,float const*v0,GLsizei count,GLboolean transpose)const{
+  GE_GL_PROGRAM_SETMATRIX(glProgramUniformMatrix2x4fv,GL_FLOAT_MAT2x4,8);
+}
+
+Program const* Program::setMatrix2x3fv(UniformHandle const&handle,float const*v0,GLsizei count,GLboolean transpose)const{
+  GE_GL_PROGRAM_SETMATRIX(glProgramUniformMatrix2x3fv,GL_FLOAT_MAT2x3,6);
+}
+
+Program const* Program::setMatrix4dv(UniformHandle const&handle,double const*v0,GLsizei count,GLboolean transpose)const{
+  GE_GL_PROGRAM_SETMATRIX(glProgramUniformMatrix4dv,GL_DOUBLE_MAT4,16);
+}
+
+Program const* Program::setMatrix3dv(UniformHandle const&handle,double const*v0,GLsizei count,GLboolean transpose)const{
+  GE_GL_PROGRAM_SETMATRIX(glProgramUniformMatrix3dv,GL_DOUBLE_MAT3,9);
+}
+
+Program const* Program::setMatrix2dv(UniformHandle const&handle,double const*v0,GLsizei count,GLboolean transpose)const{
+  GE_GL_PROGRAM_SETMATRIX(glProgramUniformMatrix2dv,GL_DOUBLE_MAT2,4);
+}
+
+Program const* Program::setMatrix4x3dv(UniformHandle const&handle,double const*v0,GLsizei count,GLboolean transpose)const{
+  GE_GL_PROGRAM_SETMATRIX(glProgramUniformMatrix4x3dv,GL_DOUBLE_MAT4x3,12);
+}
+
+Program const* Program::setMatrix4x2dv(UniformHandle const&handle,double const*v0,GLsizei count,GLboolean transpose)const{
+  GE_GL_PROGRAM_SETMATRIX(glProgramUniformMatrix4x2dv,GL_DOUBLE_MAT4x2,8);
+}
+
+Program const* Program::setMatrix3x4dv(UniformHandle const&handle,double const*v0,GLsizei count,GLboolean transpose)const{
+  GE_GL_PROGRAM_SETMATRIX(glProgramUniformMatrix3x4dv,GL_DOUBLE_MAT3x4,12);
+}
+
+Program const* Program::setMatrix3x2dv(UniformHandle const&handle,double const*v0,GLsizei count,GLboolean transpose)const{
+  GE_GL_PROGRAM_SETMATRIX(glProgramUniformMatrix3x2dv,GL_DOUBLE_MAT3x2,6);
+}
+
+Program const* Program::setMatrix2x4dv(UniformHandle const&handle,double const*v0,GLsizei count,GLboolean transpose)const{
+  GE_GL_PROGRAM_SETMATRIX(glProgramUniformMatrix2x4dv,GL_DOUBLE_MAT2x4,8);
+}
+
+Program const* Program::setMatrix2x3dv(UniformHandle const&handle,double const*v0,GLsizei count,GLboolean transpose)const{
+  GE_GL_PROGRAM_SETMATRIX(glProgramUniformMatrix2x3dv,GL_DOUBLE_MAT2x3,6);
+}
+
 Program const* Program::set1f(std::string const&name,float v0)const{
-  GE_GL_PROGRAM_SET(glProgramUniform1f,GL_FLOAT,v0);
+  return this->set1f(this->_getUniformHandle(name),v0);
 }
 
 Program const* Program::set2f(std::string const&name,float v0,float v1)const{
-  GE_GL_PROGRAM_SET(glProgramUniform2f,GL_FLOAT_VEC2,v0,v1);
+  return this->set2f(this->_getUniformHandle(name),v0,v1);
 }
 
 Program const* Program::set3f(std::string const&name,float v0,float v1,float v2)const{
-  GE_GL_PROGRAM_SET(glProgramUniform3f,GL_FLOAT_VEC3,v0,v1,v2);
+  return this->set3f(this->_getUniformHandle(name),v0,v1,v2);
 }
 
 Program const* Program::set4f(std::string const&name,float v0,float v1,float v2,float v3)const{
-  GE_GL_PROGRAM_SET(glProgramUniform4f,GL_FLOAT_VEC4,v0,v1,v2,v3);
+  return this->set4f(this->_getUniformHandle(name),v0,v1,v2,v3);
 }
 
 Program const* Program::set1i(std::string const&name,int32_t v0)const{
-  GE_GL_PROGRAM_SETI(glProgramUniform1i,GL_INT,GL_BOOL,v0);
+  return this->set1i(this->_getUniformHandle(name),v0);
 }
 
 Program const* Program::set2i(std::string const&name,int32_t v0,int32_t v1)const{
-  GE_GL_PROGRAM_SETI(glProgramUniform2i,GL_INT_VEC2,GL_BOOL_VEC2,v0,v1);
+  return this->set2i(this->_getUniformHandle(name),v0,v1);
 }
 
 Program const* Program::set3i(std::string const&name,int32_t v0,int32_t v1,int32_t v2)const{
-  GE_GL_PROGRAM_SETI(glProgramUniform3i,GL_INT_VEC3,GL_BOOL_VEC3,v0,v1,v2);
+  return this->set3i(this->_getUniformHandle(name),v0,v1,v2);
 }
 
 Program const* Program::set4i(std::string const&name,int32_t v0,int32_t v1,int32_t v2,int32_t v3)const{
-  GE_GL_PROGRAM_SETI(glProgramUniform4i,GL_INT_VEC4,GL_BOOL_VEC4,v0,v1,v2,v3);
+  return this->set4i(this->_getUniformHandle(name),v0,v1,v2,v3);
 }
 
 Program const* Program::set1ui(std::string const&name,uint32_t v0)const{
-  GE_GL_PROGRAM_SET(glProgramUniform1ui,GL_UNSIGNED_INT,v0);
+  return this->set1ui(this->_getUniformHandle(name),v0);
 }
 
 Program const* Program::set2ui(std::string const&name,uint32_t v0,uint32_t v1)const{
-  GE_GL_PROGRAM_SET(glProgramUniform2ui,GL_UNSIGNED_INT_VEC2,v0,v1);
+  return this->set2ui(this->_getUniformHandle(name),v0,v1);
 }
 
 Program const* Program::set3ui(std::string const&name,uint32_t v0,uint32_t v1,uint32_t v2)const{
-  GE_GL_PROGRAM_SET(glProgramUniform3ui,GL_UNSIGNED_INT_VEC3,v0,v1,v2);
+  return this->set3ui(this->_getUniformHandle(name),v0,v1,v2);
 }
 
 Program const* Program::set4ui(std::string const&name,uint32_t v0,uint32_t v1,uint32_t v2,uint32_t v3)const{
-  GE_GL_PROGRAM_SET(glProgramUniform4ui,GL_UNSIGNED_INT_VEC4,v0,v1,v2,v3);
+  return this->set4ui(this->_getUniformHandle(name),v0,v1,v2,v3);
 }
 
-
 Program const* Program::set1fv(std::string const&name,float const*v0,GLsizei count)const{
-  GE_GL_PROGRAM_SETV(glProgramUniform1fv,GL_FLOAT);
+  return this->set1fv(this->_getUniformHandle(name),v0,count);
 }
 
 Program const* Program::set2fv(std::string const&name,float const*v0,GLsizei count)const{
-  GE_GL_PROGRAM_SETV(glProgramUniform2fv,GL_FLOAT_VEC2);
+  return this->set2fv(this->_getUniformHandle(name),v0,count);
 }
 
 Program const* Program::set3fv(std::string const&name,float const*v0,GLsizei count)const{
-  GE_GL_PROGRAM_SETV(glProgramUniform3fv,GL_FLOAT_VEC3);
+  return this->set3fv(this->_getUniformHandle(name),v0,count);
 }
 
 Program const* Program::set4fv(std::string const&name,float const*v0,GLsizei count)const{
-  GE_GL_PROGRAM_SETV(glProgramUniform4fv,GL_FLOAT_VEC4);
+  return this->set4fv(this->_getUniformHandle(name),v0,count);
 }
 
 Program const* Program::set1iv(std::string const&name,int32_t const*v0,GLsizei count)const{
-  GE_GL_PROGRAM_SETIV(glProgramUniform1iv,GL_INT,GL_BOOL);
+  return this->set1iv(this->_getUniformHandle(name),v0,count);
 }
 
 Program const* Program::set2iv(std::string const&name,int32_t const*v0,GLsizei count)const{
-  GE_GL_PROGRAM_SETIV(glProgramUniform2iv,GL_INT_VEC2,GL_BOOL_VEC2);
+  return this->set2iv(this->_getUniformHandle(name),v0,count);
 }
 
 Program const* Program::set3iv(std::string const&name,int32_t const*v0,GLsizei count)const{
-  GE_GL_PROGRAM_SETIV(glProgramUniform3iv,GL_INT_VEC3,GL_BOOL_VEC3);
+  return this->set3iv(this->_getUniformHandle(name),v0,count);
 }
 
 Program const* Program::set4iv(std::string const&name,int32_t const*v0,GLsizei count)const{
-  GE_GL_PROGRAM_SETIV(glProgramUniform4iv,GL_INT_VEC4,GL_BOOL_VEC4);
+  return this->set4iv(this->_getUniformHandle(name),v0,count);
 }
 
 Program const* Program::set1uiv(std::string const&name,uint32_t const*v0,GLsizei count)const{
-  GE_GL_PROGRAM_SETV(glProgramUniform1uiv,GL_UNSIGNED_INT);
+  return this->set1uiv(this->_getUniformHandle(name),v0,count);
 }
 
 Program const* Program::set2uiv(std::string const&name,uint32_t const*v0,GLsizei count)const{
-  GE_GL_PROGRAM_SETV(glProgramUniform2uiv,GL_UNSIGNED_INT_VEC2);
+  return this->set2uiv(this->_getUniformHandle(name),v0,count);
 }
 
 Program const* Program::set3uiv(std::string const&name,uint32_t const*v0,GLsizei count)const{
-  GE_GL_PROGRAM_SETV(glProgramUniform3uiv,GL_UNSIGNED_INT_VEC3);
+  return this->set3uiv(this->_getUniformHandle(name),v0,count);
 }
 
 Program const* Program::set4uiv(std::string const&name,uint32_t const*v0,GLsizei count)const{
-  GE_GL_PROGRAM_SETV(glProgramUniform4uiv,GL_UNSIGNED_INT_VEC4);
+  return this->set4uiv(this->_getUniformHandle(name),v0,count);
 }
 
 Program const* Program::setMatrix4fv(std::string const&name,float const*v0,GLsizei count,GLboolean transpose)const{
-  GE_GL_PROGRAM_SETMATRIX(glProgramUniformMatrix4fv,GL_FLOAT_MAT4);
+  return this->setMatrix4fv(this->_getUniformHandle(name),v0,count,transpose);
 }
 
 Program const* Program::setMatrix3fv(std::string const&name,float const*v0,GLsizei count,GLboolean transpose)const{
-  GE_GL_PROGRAM_SETMATRIX(glProgramUniformMatrix3fv,GL_FLOAT_MAT3);
+  return this->setMatrix3fv(this->_getUniformHandle(name),v0,count,transpose);
 }
 
 Program const* Program::setMatrix2fv(std::string const&name,float const*v0,GLsizei count,GLboolean transpose)const{
-  GE_GL_PROGRAM_SETMATRIX(glProgramUniformMatrix2fv,GL_FLOAT_MAT2);
+  return this->setMatrix2fv(this->_getUniformHandle(name),v0,count,transpose);
 }
 
 Program const* Program::setMatrix4x3fv(std::string const&name,float const*v0,GLsizei count,GLboolean transpose)const{
-  GE_GL_PROGRAM_SETMATRIX(glProgramUniformMatrix4x3fv,GL_FLOAT_MAT4x3);
+  return this->setMatrix4x3fv(this->_getUniformHandle(name),v0,count,transpose);
 }
 
 Program const* Program::setMatrix4x2fv(std::string const&name,float const*v0,GLsizei count,GLboolean transpose)const{
-  GE_GL_PROGRAM_SETMATRIX(glProgramUniformMatrix4x2fv,GL_FLOAT_MAT4x2);
+  return this->setMatrix4x2fv(this->_getUniformHandle(name),v0,count,transpose);
 }
 
 Program const* Program::setMatrix3x4fv(std::string const&name,float const*v0,GLsizei count,GLboolean transpose)const{
-  GE_GL_PROGRAM_SETMATRIX(glProgramUniformMatrix3x4fv,GL_FLOAT_MAT3x4);
+  return this->setMatrix3x4fv(this->_getUniformHandle(name),v0,count,transpose);
 }
 
 Program const* Program::setMatrix3x2fv(std::string const&name,float const*v0,GLsizei count,GLboolean transpose)const{
-  GE_GL_PROGRAM_SETMATRIX(glProgramUniformMatrix3x2fv,GL_FLOAT_MAT3x2);
+  return this->setMatrix3x2fv(this->_getUniformHandle(name),v0,count,transpose);
 }
 
 Program const* Program::setMatrix2x4fv(std::string const&name,float const*v0,GLsizei count,GLboolean transpose)const{
-  GE_GL_PROGRAM_SETMATRIX(glProgramUniformMatrix2x4fv,GL_FLOAT_MAT2x4);
+  return this->setMatrix2x4fv(this->_getUniformHandle(name),v0,count,transpose);
 }
 
 Program const* Program::setMatrix2x3fv(std::string const&name,float const*v0,GLsizei count,GLboolean transpose)const{
-  GE_GL_PROGRAM_SETMATRIX(glProgramUniformMatrix2x3fv,GL_FLOAT_MAT2x3);
+  return this->setMatrix2x3fv(this->_getUniformHandle(name),v0,count,transpose);
 }
 
 Program const* Program::setMatrix4dv(std::string const&name,double const*v0,GLsizei count,GLboolean transpose)const{
-  GE_GL_PROGRAM_SETMATRIX(glProgramUniformMatrix4dv,GL_DOUBLE_MAT4);
+  return this->setMatrix4dv(this->_getUniformHandle(name),v0,count,transpose);
 }
 
 Program const* Program::setMatrix3dv(std::string const&name,double const*v0,GLsizei count,GLboolean transpose)const{
-  GE_GL_PROGRAM_SETMATRIX(glProgramUniformMatrix3dv,GL_DOUBLE_MAT3);
+  return this->setMatrix3dv(this->_getUniformHandle(name),v0,count,transpose);
 }
 
 Program const* Program::setMatrix2dv(std::string const&name,double const*v0,GLsizei count,GLboolean transpose)const{
-  GE_GL_PROGRAM_SETMATRIX(glProgramUniformMatrix2dv,GL_DOUBLE_MAT2);
+  return this->setMatrix2dv(this->_getUniformHandle(name),v0,count,transpose);
 }
 
 Program const* Program::setMatrix4x3dv(std::string const&name,double const*v0,GLsizei count,GLboolean transpose)const{
-  GE_GL_PROGRAM_SETMATRIX(glProgramUniformMatrix4x3dv,GL_DOUBLE_MAT4x3);
+  return this->setMatrix4x3dv(this->_getUniformHandle(name),v0,count,transpose);
 }
 
 Program const* Program::setMatrix4x2dv(std::string const&name,double const*v0,GLsizei count,GLboolean transpose)const{
-  GE_GL_PROGRAM_SETMATRIX(glProgramUniformMatrix4x2dv,GL_DOUBLE_MAT4x2);
+  return this->setMatrix4x2dv(this->_getUniformHandle(name),v0,count,transpose);
 }
 
 Program const* Program::setMatrix3x4dv(std::string const&name,double const*v0,GLsizei count,GLboolean transpose)const{
-  GE_GL_PROGRAM_SETMATRIX(glProgramUniformMatrix3x4dv,GL_DOUBLE_MAT3x4);
+  return this->setMatrix3x4dv(this->_getUniformHandle(name),v0,count,transpose);
 }
 
 Program const* Program::setMatrix3x2dv(std::string const&name,double const*v0,GLsizei count,GLboolean transpose)const{
-  GE_GL_PROGRAM_SETMATRIX(glProgramUniformMatrix3x2dv,GL_DOUBLE_MAT3x2);
+  return this->setMatrix3x2dv(this->_getUniformHandle(name),v0,count,transpose);
 }
 
 Program const* Program::setMatrix2x4dv(std::string const&name,double const*v0,GLsizei count,GLboolean transpose)const{
-  GE_GL_PROGRAM_SETMATRIX(glProgramUniformMatrix2x4dv,GL_DOUBLE_MAT2x4);
+  return this->setMatrix2x4dv(this->_getUniformHandle(name),v0,count,transpose);
 }
 
 Program const* Program::setMatrix2x3dv(std::string const&name,double const*v0,GLsizei count,GLboolean transpose)const{
-  GE_GL_PROGRAM_SETMATRIX(glProgramUniformMatrix2x3dv,GL_DOUBLE_MAT2x3);
+  return this->setMatrix2x3dv(this->_getUniformHandle(name),v0,count,transpose);
+}
+
+/**
+ * @brief gets handle of uniform variable
+ * The handle should be obtained once after linking and used in set* methods
+ * instead of uniform name, it avoids lookup of uniform by name.
+ *
+ * @param name name of uniform variable, array element can be specified ("name[2]")
+ *
+ * @return handle of uniform, invalid handle if there is no such uniform
+ */
+UniformHandle Program::getUniformHandle(std::string const&name)const{
+  assert(this!=nullptr);
+  this->_ensureInfo();
+  auto ii = this->_uniformHandles.find(name);
+  if(ii==this->_uniformHandles.end())return UniformHandle();
+  return ii->second;
+}
+
+/**
+ * @brief enables or disables shadow copy of uniform values
+ * When enabled (default), set* methods skip glProgramUniform* calls
+ * that would set the same values as the previous call.
+ *
+ * @param enable true for enabling of uniform cache
+ */
+void Program::setUniformCaching(bool enable){
+  assert(this!=nullptr);
+  this->_uniformCaching = enable;
+  this->invalidateUniformCache();
+}
+
+/**
+ * @brief is shadow copy of uniform values enabled
+ *
+ * @return true if uniform cache is enabled
+ */
+bool Program::isUniformCachingEnabled()const{
+  assert(this!=nullptr);
+  return this->_uniformCaching;
+}
+
+/**
+ * @brief forgets shadow copy of uniform values
+ * It has to be called when uniforms of this program are set
+ * without set* methods (for example, by glProgramUniform* directly).
+ */
+void Program::invalidateUniformCache()const{
+  assert(this!=nullptr);
+  std::fill(this->_uniformCacheValid.begin(),this->_uniformCacheValid.end(),0);
+}
+
+UniformHandle const&Program::_getUniformHandle(std::string const&name)const{
+  assert(this!=nullptr);
+  static UniformHandle const invalidHandle;
+  this->_ensureInfo();
+  auto ii = this->_uniformHandles.find(name);
+  if(ii==this->_uniformHandles.end()){
+    if(printUniformWarnings)
+      ge::core::printError(GE_CORE_FCENAME,"there is no such uniform",name);
+    return invalidHandle;
+  }
+  return ii->second;
+}
+
+/**
+ * @brief checks that handle points into shadow copy of this program
+ * Handle of other program, handle obtained before relinking or handle
+ * with elements outside of the shadow copy is not cached.
+ *
+ * @param handle uniform handle
+ * @param count number of elements
+ *
+ * @return true if shadow copy can be used for the handle
+ */
+bool Program::_isCachedHandle(UniformHandle const&handle,GLsizei count)const{
+  assert(this!=nullptr);
+  if(this->_infoPending)return false;//relinked, handles are not rebuilt yet
+  if(handle.program    != this                    )return false;
+  if(handle.generation != this->_uniformGeneration)return false;
+  if(count < 0 || count > handle.size)return false;
+  size_t const end        = size_t(handle.cacheOffset )+size_t(handle.elementSize)*size_t(count);
+  size_t const endElement = size_t(handle.cacheElement)+size_t(count);
+  return end <= this->_uniformCache.size() && endElement <= this->_uniformCacheValid.size();
+}
+
+/**
+ * @brief compares values with shadow copy and updates it
+ *
+ * @param handle uniform handle
+ * @param data new values
+ * @param elementSize size of one element of data in bytes
+ * @param count number of elements
+ *
+ * @return true if values differ and uniform has to be set
+ */
+bool Program::_updateUniformCache(
+    UniformHandle const&handle     ,
+    void          const*data       ,
+    size_t              elementSize,
+    GLsizei             count      )const{
+  assert(this!=nullptr);
+  if(!this->_uniformCaching)return true;
+  if(!this->_isCachedHandle(handle,count))return true;
+  assert(elementSize == handle.elementSize);
+  size_t const size = elementSize*size_t(count);
+  uint8_t*cache = this->_uniformCache.data()+handle.cacheOffset;
+  uint8_t*valid = this->_uniformCacheValid.data()+handle.cacheElement;
+  bool const known = std::find(valid,valid+count,0)==valid+count;
+  if(known && std::memcmp(cache,data,size)==0)return false;
+  std::memcpy(cache,data,size);
+  std::fill(valid,valid+count,1);
+  return true;
+}
+
+void Program::_invalidateUniformCache(UniformHandle const&handle,GLsizei count)const{
+  assert(this!=nullptr);
+  if(!this->_isCachedHandle(handle,count))return;
+  uint8_t*valid = this->_uniformCacheValid.data()+handle.cacheElement;
+  std::fill(valid,valid+count,0);
+}
+
+/**
+ * @brief gets size of one element of uniform in bytes, as it is passed to glProgramUniform*
+ *
+ * @param type type of uniform
+ *
+ * @return size of uniform element in bytes
+ */
+static GLuint getUniformElementSize(GLenum type){
+  switch(type){
+    case GL_FLOAT            :return  4;
+    case GL_FLOAT_VEC2       :return  8;
+    case GL_FLOAT_VEC3       :return 12;
+    case GL_FLOAT_VEC4       :return 16;
+    case GL_INT              :return  4;
+    case GL_INT_VEC2         :return  8;
+    case GL_INT_VEC3         :return 12;
+    case GL_INT_VEC4         :return 16;
+    case GL_UNSIGNED_INT     :return  4;
+    case GL_UNSIGNED_INT_VEC2:return  8;
+    case GL_UNSIGNED_INT_VEC3:return 12;
+    case GL_UNSIGNED_INT_VEC4:return 16;
+    case GL_BOOL             :return  4;
+    case GL_BOOL_VEC2        :return  8;
+    case GL_BOOL_VEC3        :return 12;
+    case GL_BOOL_VEC4        :return 16;
+    case GL_DOUBLE           :return  8;
+    case GL_DOUBLE_VEC2      :return 16;
+    case GL_DOUBLE_VEC3      :return 24;
+    case GL_DOUBLE_VEC4      :return 32;
+    case GL_FLOAT_MAT2       :return 16;
+    case GL_FLOAT_MAT3       :return 36;
+    case GL_FLOAT_MAT4       :return 64;
+    case GL_FLOAT_MAT2x3     :return 24;
+    case GL_FLOAT_MAT2x4     :return 32;
+    case GL_FLOAT_MAT3x2     :return 24;
+    case GL_FLOAT_MAT3x4     :return 48;
+    case GL_FLOAT_MAT4x2     :return 32;
+    case GL_FLOAT_MAT4x3     :return 48;
+    case GL_DOUBLE_MAT2      :return 32;
+    case GL_DOUBLE_MAT3      :return 72;
+    case GL_DOUBLE_MAT4      :return 128;
+    case GL_DOUBLE_MAT2x3    :return 48;
+    case GL_DOUBLE_MAT2x4    :return 64;
+    case GL_DOUBLE_MAT3x2    :return 48;
+    case GL_DOUBLE_MAT3x4    :return 96;
+    case GL_DOUBLE_MAT4x2    :return 64;
+    case GL_DOUBLE_MAT4x3    :return 96;
+    default                  :return  4;//samplers, images and atomic counters are set as int
+  }
 }
 
 GLint Program::_getUniform(std::string name){
   assert(this!=nullptr);
+  this->_ensureInfo();
   auto ii = this->_info->uniforms.find(name);
   if(ii==this->_info->uniforms.end())
     return -1;
@@ -668,6 +1097,11 @@ void Program::_fillUniformInfo(){
   GLint longestUniform = this->getActiveUniformMaxLength();
   GLchar*buffer = new GLchar[longestUniform+1];
   assert(buffer!=nullptr);
+  this->_uniformHandles.clear();
+  static std::atomic<uint64_t>generationCounter(0);
+  this->_uniformGeneration = ++generationCounter;
+  GLuint cacheSize     = 0;
+  GLuint cacheElements = 0;
   for(GLint i=0;i<nofUniforms;++i){
     GLenum type;
     GLint size;
@@ -678,6 +1112,19 @@ void Program::_fillUniformInfo(){
     name = this->_chopIndexingInPropertyName(std::string(buffer));
     location = this->getUniformLocation(name);
     this->_info->uniforms[name] = ProgramInfo::Properties(location,type,name,size);
+    //handle with place in shadow copy of uniform values
+    UniformHandle handle;
+    handle.location     = location;
+    handle.type         = type;
+    handle.size         = size;
+    handle.elementSize  = getUniformElementSize(type);
+    handle.cacheOffset  = cacheSize;
+    handle.cacheElement = cacheElements;
+    handle.program      = this;
+    handle.generation   = this->_uniformGeneration;
+    this->_uniformHandles[name] = handle;
+    cacheSize     += handle.elementSize*GLuint(size);
+    cacheElements += GLuint(size);
     //add all variants name[0], name[1], ...
     for(GLint s=0;s<size;++s){
       std::string uniformNameWithIndexing = name+"["+ge::core::value2str(s)+"]";
@@ -686,9 +1133,17 @@ void Program::_fillUniformInfo(){
           type,
           uniformNameWithIndexing,
           1);
+      UniformHandle elementHandle = handle;
+      elementHandle.location      = std::get<ProgramInfo::LOCATION>(this->_info->uniforms[uniformNameWithIndexing]);
+      elementHandle.size          = 1;
+      elementHandle.cacheOffset  += handle.elementSize*GLuint(s);
+      elementHandle.cacheElement += GLuint(s);
+      this->_uniformHandles[uniformNameWithIndexing] = elementHandle;
     }
   }
   delete[]buffer;
+  this->_uniformCache.assign(cacheSize,0);
+  this->_uniformCacheValid.assign(cacheElements,0);
 }
 
 void Program::_fillAttribInfo(){
@@ -757,6 +1212,7 @@ GLuint const Program::nonExistingBufferBinding = std::numeric_limits<GLuint>::ma
 
 GLuint Program::getBufferBinding(std::string const&name)const{
   assert(this != nullptr);
+  this->_ensureInfo();
   auto ii = this->_info->buffers.find(name);
   if(ii == this->_info->buffers.end()){
     ge::core::printError(GE_CORE_FCENAME,"there is no such buffer",name);
@@ -0,0 +1,321 @@
+#include<geGL/ProgramBinaryCache.h>
+#include<cassert>
+#include<cstdio>
+#include<cstring>
+#include<fstream>
+#include<sstream>
+#include<iomanip>
+#include<atomic>
+#if defined(_WIN32)
+#include<process.h>
+#else
+#include<unistd.h>
+#endif
+
+using namespace ge::gl;
+
+namespace{
+  char     const magic[8] = {'G','E','G','L','P','B','I','N'};
+  uint64_t const fnvOffset = 14695981039346656037ull;
+  uint64_t const fnvPrime  = 1099511628211ull;
+
+  uint64_t hash(uint64_t h,void const*data,size_t size){
+    auto const bytes = static_cast<uint8_t const*>(data);
+    for(size_t i=0;i<size;++i){
+      h ^= bytes[i];
+      h *= fnvPrime;
+    }
+    return h;
+  }
+
+  template<typename T>
+    uint64_t hashValue(uint64_t h,T const&value){
+      return hash(h,&value,sizeof(T));
+    }
+
+  uint64_t hashString(uint64_t h,std::string const&string){
+    h = hashValue(h,uint64_t(string.size()));
+    return hash(h,string.data(),string.size());
+  }
+
+  /**
+   * @brief creates name of temporary file that is unique among processes and threads
+   *
+   * @param path path of cache file
+   *
+   * @return path of temporary file
+   */
+  std::string temporaryPath(std::string const&path){
+    static std::atomic<uint64_t>counter(0);
+#if defined(_WIN32)
+    auto const pid = _getpid();
+#else
+    auto const pid = getpid();
+#endif
+    std::stringstream ss;
+    ss<<path<<"."<<pid<<"."<<counter++<<".tmp";
+    return ss.str();
+  }
+
+  /**
+   * @brief header of cache file, it is followed by binary
+   */
+  struct Header{
+    char     magic[8];
+    uint32_t version ;
+    uint32_t format  ;
+    uint64_t key     ;
+    uint64_t size    ;
+    uint64_t checksum;
+  };
+}
+
+uint32_t const ProgramBinaryCache::version = 1;
+
+/**
+ * @brief creates cache
+ *
+ * @param directory existing directory for binaries
+ */
+ProgramBinaryCache::ProgramBinaryCache(std::string const&directory):_directory(directory){
+  assert(this!=nullptr);
+}
+
+std::string const&ProgramBinaryCache::getDirectory()const{
+  assert(this!=nullptr);
+  return this->_directory;
+}
+
+/**
+ * @brief computes key of program
+ *
+ * @param stages shader types and their sources
+ * @param driver driver string (see getDriverString())
+ *
+ * @return 64bit FNV-1a hash
+ */
+uint64_t ProgramBinaryCache::computeKey(Stages const&stages,std::string const&driver){
+  uint64_t h = fnvOffset;
+  h = hashValue (h,version);
+  h = hashString(h,driver);
+  h = hashValue (h,uint64_t(stages.size()));
+  for(auto const&stage:stages){
+    h = hashValue(h,uint32_t(stage.first));
+    h = hashValue(h,uint64_t(stage.second.size()));
+    for(auto const&source:stage.second)
+      h = hashString(h,source);
+  }
+  return h;
+}
+
+/**
+ * @brief gets string that identifies driver and hardware
+ *
+ * @param gl context
+ *
+ * @return vendor, renderer and version separated by new lines
+ */
+std::string ProgramBinaryCache::getDriverString(Context const&gl){
+  std::string result;
+  for(auto const name:{GL_VENDOR,GL_RENDERER,GL_VERSION}){
+    auto const string = gl.glGetString(name);
+    if(string)result += reinterpret_cast<char const*>(string);
+    result += "\n";
+  }
+  return result;
+}
+
+/**
+ * @brief gets path of file with binary
+ *
+ * @param key key of program
+ *
+ * @return path
+ */
+std::string ProgramBinaryCache::getPath(uint64_t key)const{
+  assert(this!=nullptr);
+  std::stringstream ss;
+  ss<<this->_directory;
+  if(!this->_directory.empty() && this->_directory.back() != '/' && this->_directory.back() != '\\')
+    ss<<"/";
+  ss<<std::hex<<std::setw(16)<<std::setfill('0')<<key<<".glbin";
+  return ss.str();
+}
+
+/**
+ * @brief loads binary from file
+ * Corrupted file or file of different version is removed.
+ *
+ * @param key key of program
+ * @param format returned format of binary
+ * @param binary returned binary
+ *
+ * @return true if the binary was loaded
+ */
+bool ProgramBinaryCache::load(uint64_t key,GLenum&format,std::vector<uint8_t>&binary)const{
+  assert(this!=nullptr);
+  std::ifstream file(this->getPath(key),std::ios::binary);
+  if(!file.is_open())return false;
+  Header header;
+  file.read(reinterpret_cast<char*>(&header),sizeof(header));
+  bool valid =
+    file                                               &&
+    std::memcmp(header.magic,magic,sizeof(magic)) == 0 &&
+    header.version == version                          &&
+    header.key     == key                              &&
+    header.size    >  0                                ;
+  if(valid){
+    file.seekg(0,std::ios::end);
+    valid = uint64_t(file.tellg()) == sizeof(header)+header.size;
+    file.seekg(sizeof(header),std::ios::beg);
+  }
+  std::vector<uint8_t>data;
+  if(valid){
+    data.resize(size_t(header.size));
+    file.read(reinterpret_cast<char*>(data.data()),std::streamsize(data.size()));
+    valid = file && hash(fnvOffset,data.data(),data.size()) == header.checksum;
+  }
+  file.close();
+  if(!valid){
+    this->remove(key);
+    return false;
+  }
+  format = GLenum(header.format);
+  binary.swap(data);
+  return true;
+}
+
+/**
+ * @brief stores binary into file
+ * The file is written under temporary name unique for the writer and renamed,
+ * so concurrent writers do not share the temporary file
+ * and concurrent readers never see partially written nor missing file.
+ *
+ * @param key key of program
+ * @param format format of binary
+ * @param binary binary
+ *
+ * @return true if the binary was stored
+ */
+bool ProgramBinaryCache::store(uint64_t key,GLenum format,std::vector<uint8_t>const&binary)const{
+  assert(this!=nullptr);
+  if(binary.empty())return false;
+  Header header;
+  std::memcpy(header.magic,magic,sizeof(magic));
+  header.version  = version;
+  header.format   = uint32_t(format);
+  header.key      = key;
+  header.size     = binary.size();
+  header.checksum = hash(fnvOffset,binary.data(),binary.size());
+  auto const path      = this->getPath(key);
+  auto const temporary = temporaryPath(path);
+  std::ofstream file(temporary,std::ios::binary|std::ios::trunc);
+  if(!file.is_open())return false;
+  file.write(reinterpret_cast<char const*>(&header),sizeof(header));
+  file.write(reinterpret_cast<char const*>(binary.data()),std::streamsize(binary.size()));
+  file.close();
+  if(!file){
+    std::remove(temporary.c_str());
+    return false;
+  }
+  //rename replaces existing file atomically on POSIX
+  bool renamed = std::rename(temporary.c_str(),path.c_str()) == 0;
+#if defined(_WIN32)
+  //rename does not replace existing file on Windows
+  if(!renamed){
+    std::remove(path.c_str());
+    renamed = std::rename(temporary.c_str(),path.c_str()) == 0;
+  }
+#endif
+  if(!renamed){
+    std::remove(temporary.c_str());
+    return false;
+  }
+  return true;
+}
+
+/**
+ * @brief removes binary from cache
+ *
+ * @param key key of program
+ */
+void ProgramBinaryCache::remove(uint64_t key)const{
+  assert(this!=nullptr);
+  std::remove(this->getPath(key).c_str());
+}
+
+/**
+ * @brief creates program using default function table
+ *
+ * @param stages shader types and their sources
+ *
+ * @return program loaded from binary or compiled from sources
+ */
+std::shared_ptr<Program>ProgramBinaryCache::createProgram(Stages const&stages){
+  assert(this!=nullptr);
+  return this->_createProgram(std::make_shared<Program>(Program::ShaderPointers{}),stages);
+}
+
+/**
+ * @brief creates program
+ *
+ * @param table opengl function table
+ * @param stages shader types and their sources
+ *
+ * @return program loaded from binary or compiled from sources
+ */
+std::shared_ptr<Program>ProgramBinaryCache::createProgram(
+    FunctionTablePointer const&table ,
+    Stages               const&stages){
+  assert(this!=nullptr);
+  return this->_createProgram(std::make_shared<Program>(table,Program::ShaderPointers{}),stages);
+}
+
+std::shared_ptr<Program>ProgramBinaryCache::_createProgram(
+    std::shared_ptr<Program>const&program,
+    Stages                  const&stages ){
+  assert(this!=nullptr);
+  assert(program!=nullptr);
+  auto const&gl = program->getContext();
+  auto const compile = [&](){
+    this->_nofMisses++;
+    Program::ShaderPointers shaders;
+    for(auto const&stage:stages)
+      shaders.push_back(std::make_shared<Shader>(gl.getFunctionTable(),stage.first,stage.second));
+    program->link(shaders);
+  };
+  GLint nofFormats = 0;
+  gl.glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS,&nofFormats);
+  if(nofFormats == 0){
+    compile();
+    return program;
+  }
+
+  uint64_t const key = computeKey(stages,getDriverString(gl));
+  program->setBinaryRetrievableHint();
+  GLenum format = 0;
+  std::vector<uint8_t>binary;
+  if(this->load(key,format,binary)){
+    if(program->setBinary(format,binary.data(),GLsizei(binary.size()))){
+      this->_nofHits++;
+      return program;
+    }
+    this->remove(key);
+  }
+
+  compile();
+  if(!program->getLinkStatus())return program;
+  binary = program->getBinary(format);
+  this->store(key,format,binary);
+  return program;
+}
+
+size_t ProgramBinaryCache::getNofHits()const{
+  assert(this!=nullptr);
+  return this->_nofHits;
+}
+
+size_t ProgramBinaryCache::getNofMisses()const{
+  assert(this!=nullptr);
+  return this->_nofMisses;
+}
@@ -1,6 +1,7 @@
 #include<geGL/Shader.h>
 #include<geGL/Program.h>
 #include<sstream>
+#include<cstring>
 
 using namespace ge::gl;
 
@@ -118,6 +119,66 @@ void Shader::compile(Sources const& sources){
   }
 }
 
+/**
+ * @brief this function can set shader source code and starts compilation.
+ * It does not wait for the compilation and it does not relink programs that are using this shader.
+ * Driver with GL_KHR_parallel_shader_compile compiles in background threads,
+ * so many shaders can be compiled at once. Compilation is finished by
+ * any query of shader or by linking of program (see Program::linkAsync).
+ *
+ * @param sources optional source codes
+ */
+void Shader::compileAsync(Sources const& sources){
+  assert(this!=nullptr);
+  if(sources.size()>0)this->setSource(sources);
+  this->_parallelCompile = isParallelCompileSupported(this->_gl);
+  this->_gl.glCompileShader(this->getId());
+}
+
+/**
+ * @brief polls compilation started by compileAsync
+ * It does not block. Without GL_KHR_parallel_shader_compile, it always returns true
+ * and the compilation is finished by the next query.
+ *
+ * @return true if the compilation is finished
+ */
+bool Shader::isCompileCompleted()const{
+  assert(this!=nullptr);
+  if(!this->_parallelCompile)return true;
+  return this->_getParam(GL_COMPLETION_STATUS_ARB) != GL_FALSE;
+}
+
+/**
+ * @brief checks GL_KHR_parallel_shader_compile (or GL_ARB_parallel_shader_compile)
+ *
+ * @param gl context
+ *
+ * @return true if completion status of shaders and programs can be polled
+ */
+bool Shader::isParallelCompileSupported(Context const&gl){
+  GLint nofExtensions = 0;
+  gl.glGetIntegerv(GL_NUM_EXTENSIONS,&nofExtensions);
+  for(GLint i=0;i<nofExtensions;++i){
+    auto const extension = reinterpret_cast<char const*>(gl.glGetStringi(GL_EXTENSIONS,GLuint(i)));
+    if(!extension)continue;
+    if(std::strcmp(extension,"GL_KHR_parallel_shader_compile") == 0)return true;
+    if(std::strcmp(extension,"GL_ARB_parallel_shader_compile") == 0)return true;
+  }
+  return false;
+}
+
+/**
+ * @brief sets number of background threads of driver for compilation of shaders
+ * It does nothing if GL_KHR_parallel_shader_compile is not supported.
+ *
+ * @param gl context
+ * @param count number of threads, 0 disables parallel compilation, 0xffffffff lets driver decide
+ */
+void Shader::setMaxCompilerThreads(Context const&gl,GLuint count){
+  if(!isParallelCompileSupported(gl))return;
+  gl.glMaxShaderCompilerThreadsARB(count);
+}
+
 /**
  * @brief function returns true if object represents valid shader
  *
@@ -230,12 +291,12 @@ std::string Shader::define(std::string const&name,uint32_t value0,uint32_t value
 
 std::string Shader::define(std::string const&name,uint32_t value0,uint32_t value1,uint32_t value2,uint32_t value3){
   std::stringstream result;
-  result<<"#define "<<name<<" uvec3("<<value0<<"u,"<<value1<<"u,"<<value2<<"u,"<<value3<<"u)\n";
+  result<<"#define "<<name<<" uvec4("<<value0<<"u,"<<value1<<"u,"<<value2<<"u,"<<value3<<"u)\n";
   return result.str();
 }
 
 std::string Shader::define(std::string const&Name,uint32_t vectorSize,uint32_t const*values){
-  assert(vectorSize<4);
+  assert(vectorSize>0 && vectorSize<=4);
   if(vectorSize==1)return define(Name,values[0]);
   std::stringstream result;
   result<<"#define "<<Name<<" uvec"<<vectorSize<<"(";
@@ -267,12 +328,12 @@ std::string Shader::define(std::string const&Name,int32_t value0,int32_t value1,
 
 std::string Shader::define(std::string const&Name,int32_t value0,int32_t value1,int32_t value2,int32_t value3){
   std::stringstream result;
-  result<<"#define "<<Name<<" ivec3("<<value0<<","<<value1<<","<<value2<<","<<value3<<")\n";
+  result<<"#define "<<Name<<" ivec4("<<value0<<","<<value1<<","<<value2<<","<<value3<<")\n";
   return result.str();
 }
 
 std::string Shader::define(std::string const&Name,uint32_t vectorSize,int32_t const*values){
-  assert(vectorSize<4);
+  assert(vectorSize>0 && vectorSize<=4);
   if(vectorSize==1)return define(Name,values[0]);
   std::stringstream result;
   result<<"#define "<<Name<<" ivec"<<vectorSize<<"(";
@@ -304,12 +365,12 @@ std::string Shader::define(std::string const&Name,float value0,float value1,floa
 
 std::string Shader::define(std::string const&Name,float value0,float value1,float value2,float value3){
   std::stringstream result;
-  result<<"#define "<<Name<<" vec3("<<value0<<","<<value1<<","<<value2<<","<<value3<<")\n";
+  result<<"#define "<<Name<<" vec4("<<value0<<","<<value1<<","<<value2<<","<<value3<<")\n";
   return result.str();
 }
 
 std::string Shader::define(std::string const&Name,uint32_t vectorSize,float const*values){
-  assert(vectorSize<4);
+  assert(vectorSize>0 && vectorSize<=4);
   if(vectorSize==1)return define(Name,values[0]);
   std::stringstream result;
   result<<"#define "<<Name<<" vec"<<vectorSize<<"(";
@@ -0,0 +1,481 @@
+#include<geGL/ShaderPreprocessor.h>
+#include<geGL/ProgramBinaryCache.h>
+#include<geCore/ErrorPrinter.h>
+#include<algorithm>
+#include<cassert>
+#include<cctype>
+#include<sstream>
+
+using namespace ge::gl;
+
+namespace{
+  size_t skipSpaces(std::string const&line,size_t i){
+    while(i<line.size() && (line[i] == ' ' || line[i] == '\t'))++i;
+    return i;
+  }
+
+  /**
+   * @brief parses preprocessor directive
+   *
+   * @param line line of source
+   * @param directive returned name of directive
+   * @param argument returned rest of line
+   *
+   * @return true if the line is directive
+   */
+  bool parseDirective(std::string const&line,std::string&directive,std::string&argument){
+    size_t i = skipSpaces(line,0);
+    if(i>=line.size() || line[i] != '#')return false;
+    i = skipSpaces(line,i+1);
+    size_t const begin = i;
+    while(i<line.size() && (std::isalnum(static_cast<unsigned char>(line[i])) || line[i] == '_'))++i;
+    directive = line.substr(begin,i-begin);
+    argument  = line.substr(skipSpaces(line,i));
+    while(!argument.empty() && std::isspace(static_cast<unsigned char>(argument.back())))argument.pop_back();
+    return true;
+  }
+
+  /**
+   * @brief parses "name" or <name> of #include directive
+   *
+   * @param argument argument of directive
+   * @param name returned name of file
+   *
+   * @return true if the argument is valid
+   */
+  bool parseIncludeName(std::string const&argument,std::string&name){
+    if(argument.size()<2)return false;
+    char const close = argument[0] == '"'?'"':argument[0] == '<'?'>':0;
+    if(!close)return false;
+    size_t const end = argument.find(close,1);
+    if(end == std::string::npos)return false;
+    name = argument.substr(1,end-1);
+    return !name.empty();
+  }
+
+  /**
+   * @brief removes comments from line, block comments can span more lines
+   *
+   * @param line line of source
+   * @param inComment true if the line starts inside of block comment, it is updated for the next line
+   *
+   * @return line without comments
+   */
+  std::string stripComments(std::string const&line,bool&inComment){
+    std::string result;
+    size_t i = 0;
+    while(i<line.size()){
+      if(inComment){
+        size_t const end = line.find("*/",i);
+        if(end == std::string::npos)return result;
+        inComment = false;
+        i = end+2;
+        result += ' ';
+        continue;
+      }
+      if(line.compare(i,2,"//") == 0)return result;
+      if(line.compare(i,2,"/*") == 0){
+        inComment = true;
+        i += 2;
+        continue;
+      }
+      result += line[i++];
+    }
+    return result;
+  }
+
+  std::string directoryOf(std::string const&name){
+    size_t const slash = name.find_last_of("/\\");
+    if(slash == std::string::npos)return"";
+    return name.substr(0,slash+1);
+  }
+
+  /**
+   * @brief removes "." and "dir/.." parts of path
+   */
+  std::string normalize(std::string const&path){
+    std::vector<std::string>parts;
+    std::stringstream ss(path);
+    std::string part;
+    while(std::getline(ss,part,'/')){
+      if(part.empty() || part == ".")continue;
+      if(part == ".." && !parts.empty() && parts.back() != ".."){
+        parts.pop_back();
+        continue;
+      }
+      parts.push_back(part);
+    }
+    std::string result;
+    for(auto const&x:parts){
+      if(!result.empty())result += "/";
+      result += x;
+    }
+    return result;
+  }
+}
+
+ShaderPreprocessor::ShaderPreprocessor(){
+  assert(this!=nullptr);
+}
+
+/**
+ * @brief adds file into virtual file table or replaces it
+ * Memoized expansions and programs are forgotten, programs that have been
+ * already returned stay valid.
+ *
+ * @param name name of file, it can contain directories separated by '/'
+ * @param source source code
+ */
+void ShaderPreprocessor::addFile(std::string const&name,std::string const&source){
+  assert(this!=nullptr);
+  auto const file = normalize(name);
+  this->_files[file] = source;
+  if(!this->_fileIndices.count(file)){
+    this->_fileIndices[file] = this->_fileNames.size();
+    this->_fileNames.push_back(file);
+  }
+  this->_expanded.clear();
+  this->clearPrograms();
+}
+
+/**
+ * @brief removes file from virtual file table
+ *
+ * @param name name of file
+ */
+void ShaderPreprocessor::removeFile(std::string const&name){
+  assert(this!=nullptr);
+  this->_files.erase(normalize(name));
+  this->_expanded.clear();
+  this->clearPrograms();
+}
+
+bool ShaderPreprocessor::hasFile(std::string const&name)const{
+  assert(this!=nullptr);
+  return this->_files.count(normalize(name)) != 0;
+}
+
+/**
+ * @brief gets source of file
+ *
+ * @param name name of file
+ *
+ * @return source, empty string if there is no such file
+ */
+std::string const&ShaderPreprocessor::getFile(std::string const&name)const{
+  assert(this!=nullptr);
+  static std::string const empty;
+  auto const ii = this->_files.find(normalize(name));
+  if(ii == this->_files.end())return empty;
+  return ii->second;
+}
+
+/**
+ * @brief gets index of file, it is used as source string number of #line directives,
+ * so it appears in info logs of compilation
+ *
+ * @param name name of file
+ *
+ * @return index of file
+ */
+size_t ShaderPreprocessor::getFileIndex(std::string const&name)const{
+  assert(this!=nullptr);
+  auto const ii = this->_fileIndices.find(normalize(name));
+  assert(ii != this->_fileIndices.end());
+  return ii->second;
+}
+
+/**
+ * @brief gets name of file from source string number found in info log
+ *
+ * @param index index of file
+ *
+ * @return name of file
+ */
+std::string const&ShaderPreprocessor::getFileName(size_t index)const{
+  assert(this!=nullptr);
+  assert(index<this->_fileNames.size());
+  return this->_fileNames[index];
+}
+
+/**
+ * @brief canonicalizes set of defines
+ * Defines are sorted by name, so the same set gives the same key.
+ *
+ * @param defines defines
+ *
+ * @return key of variant, for example "LIGHTS=4;SHADOWS"
+ */
+std::string ShaderPreprocessor::getVariantKey(Defines const&defines){
+  std::string key;
+  for(auto const&x:defines){
+    if(!key.empty())key += ";";
+    key += x.first;
+    if(!x.second.empty())key += "="+x.second;
+  }
+  return key;
+}
+
+std::string ShaderPreprocessor::_resolve(std::string const&name,std::string const&includer)const{
+  assert(this!=nullptr);
+  auto const relative = normalize(directoryOf(includer)+name);
+  if(this->_files.count(relative))return relative;
+  auto const absolute = normalize(name);
+  if(this->_files.count(absolute))return absolute;
+  return"";
+}
+
+bool ShaderPreprocessor::_expand(
+    std::string             &result,
+    std::string        const&name  ,
+    std::vector<std::string>&stack ,
+    std::set<std::string>   &once  ){
+  assert(this!=nullptr);
+  auto const index = std::to_string(this->_fileIndices.at(name));
+  std::stringstream ss(this->_files.at(name));
+  std::string line;
+  size_t lineNumber = 0;
+  stack.push_back(name);
+  while(std::getline(ss,line)){
+    ++lineNumber;
+    std::string directive;
+    std::string argument ;
+    if(!parseDirective(line,directive,argument)){
+      result += line+"\n";
+      continue;
+    }
+    if(directive == "pragma" && argument == "once"){
+      once.insert(name);
+      result += "\n";
+      continue;
+    }
+    if(directive != "include"){
+      result += line+"\n";
+      continue;
+    }
+    std::string includeName;
+    if(!parseIncludeName(argument,includeName)){
+      ge::core::printError(GE_CORE_FCENAME,"invalid #include in "+name+":"+std::to_string(lineNumber),argument);
+      return false;
+    }
+    auto const file = this->_resolve(includeName,name);
+    if(file.empty()){
+      ge::core::printError(GE_CORE_FCENAME,"there is no such file, included from "+name+":"+std::to_string(lineNumber),includeName);
+      return false;
+    }
+    if(std::find(stack.begin(),stack.end(),file) != stack.end()){
+      ge::core::printError(GE_CORE_FCENAME,"circular #include in "+name+":"+std::to_string(lineNumber),file);
+      return false;
+    }
+    if(once.count(file)){
+      result += "\n";
+      continue;
+    }
+    result += "#line 1 "+std::to_string(this->_fileIndices.at(file))+"\n";
+    if(!this->_expand(result,file,stack,once))return false;
+    result += "#line "+std::to_string(lineNumber+1)+" "+index+"\n";
+  }
+  stack.pop_back();
+  return true;
+}
+
+/**
+ * @brief resolves #include directives of file
+ * Result is memoized until the file table changes.
+ *
+ * @param name name of file
+ *
+ * @return expanded source, empty string if the file or some included file is missing
+ */
+std::string const&ShaderPreprocessor::expand(std::string const&name){
+  assert(this!=nullptr);
+  static std::string const empty;
+  auto const file = normalize(name);
+  auto const ii = this->_expanded.find(file);
+  if(ii != this->_expanded.end())return ii->second;
+  if(!this->_files.count(file)){
+    ge::core::printError(GE_CORE_FCENAME,"there is no such file",name);
+    return empty;
+  }
+  std::string result;
+  std::vector<std::string>stack;
+  std::set<std::string>once;
+  if(!this->_expand(result,file,stack,once))return empty;
+  return this->_expanded[file] = result;
+}
+
+/**
+ * @brief gets sources of variant of shader
+ * Defines are inserted after #version directive, #line directive keeps
+ * line numbers of the file in info logs.
+ * #version may be preceded by blank lines and comments (license headers).
+ *
+ * @param name name of file
+ * @param defines defines of variant
+ *
+ * @return sources that can be passed to Shader, empty if the file cannot be expanded
+ */
+Shader::Sources ShaderPreprocessor::getSources(std::string const&name,Defines const&defines){
+  assert(this!=nullptr);
+  auto const&expanded = this->expand(name);
+  if(!this->_expanded.count(normalize(name)))return{};
+  Shader::Sources sources;
+  size_t bodyBegin  = 0;
+  size_t bodyLine   = 1;
+  size_t lineBegin  = 0;
+  size_t lineNumber = 1;
+  bool   inComment  = false;
+  bool   version    = false;
+  while(lineBegin<expanded.size()){
+    size_t lineEnd = expanded.find('\n',lineBegin);
+    if(lineEnd == std::string::npos)lineEnd = expanded.size();
+    auto const line = stripComments(expanded.substr(lineBegin,lineEnd-lineBegin),inComment);
+    std::string directive;
+    std::string argument ;
+    if(!version){
+      if(parseDirective(line,directive,argument) && directive == "version")version = true;
+      else if(skipSpaces(line,0) != line.size())break;
+    }
+    lineBegin = lineEnd+1;
+    ++lineNumber;
+    //defines can not be inserted into block comment that continues after #version
+    if(version && !inComment){
+      bodyBegin = std::min(lineBegin,expanded.size());
+      bodyLine  = lineNumber;
+      sources.push_back(expanded.substr(0,bodyBegin));
+      break;
+    }
+  }
+  for(auto const&x:defines){
+    if(x.second.empty())sources.push_back(Shader::define(x.first));
+    else sources.push_back(Shader::define(x.first,x.second));
+  }
+  sources.push_back("#line "+std::to_string(bodyLine)+" "+std::to_string(this->getFileIndex(name))+"\n"+expanded.substr(bodyBegin));
+  return sources;
+}
+
+/**
+ * @brief creates variant of program using default function table
+ *
+ * @param stages shader types and names of files
+ * @param defines defines of variant, they are shared by all stages
+ *
+ * @return memoized program, nullptr if some file cannot be expanded
+ */
+std::shared_ptr<Program>ShaderPreprocessor::createProgram(
+    Stages  const&stages ,
+    Defines const&defines){
+  assert(this!=nullptr);
+  return this->_createProgram(getDefaultFunctionTable(),stages,defines);
+}
+
+/**
+ * @brief creates variant of program
+ *
+ * @param table opengl function table
+ * @param stages shader types and names of files
+ * @param defines defines of variant, they are shared by all stages
+ *
+ * @return memoized program, nullptr if some file cannot be expanded
+ */
+std::shared_ptr<Program>ShaderPreprocessor::createProgram(
+    FunctionTablePointer const&table  ,
+    Stages               const&stages ,
+    Defines              const&defines){
+  assert(this!=nullptr);
+  return this->_createProgram(table,stages,defines);
+}
+
+std::shared_ptr<Program>ShaderPreprocessor::_createProgram(
+    FunctionTablePointer const&table  ,
+    Stages               const&stages ,
+    Defines              const&defines){
+  assert(this!=nullptr);
+  std::string key;
+  for(auto const&x:stages)
+    key += std::to_string(x.first)+":"+normalize(x.second)+"|";
+  key += getVariantKey(defines);
+  auto&variants = this->_programs[table];
+  auto const ii = variants.find(key);
+  if(ii != variants.end()){
+    this->_nofHits++;
+    return ii->second;
+  }
+
+  ProgramBinaryCache::Stages sources;
+  for(auto const&x:stages){
+    sources.emplace_back(x.first,this->getSources(x.second,defines));
+    if(sources.back().second.empty())return nullptr;
+  }
+
+  this->_nofMisses++;
+  std::shared_ptr<Program>program;
+  if(this->_programBinaryCache)
+    program = this->_programBinaryCache->createProgram(table,sources);
+  else{
+    Program::ShaderPointers shaders;
+    for(auto const&x:sources){
+      auto shader = std::make_shared<Shader>(table);
+      shader->create(x.first);
+      shader->compileAsync(x.second);
+      shaders.push_back(shader);
+    }
+    program = std::make_shared<Program>(table);
+    program->linkAsync(shaders);
+  }
+  variants[key] = program;
+  return program;
+}
+
+/**
+ * @brief sets cache of program binaries that is used for new variants of programs
+ *
+ * @param cache cache, nullptr for compilation from sources
+ */
+void ShaderPreprocessor::setProgramBinaryCache(std::shared_ptr<ProgramBinaryCache>const&cache){
+  assert(this!=nullptr);
+  this->_programBinaryCache = cache;
+}
+
+std::shared_ptr<ProgramBinaryCache>const&ShaderPreprocessor::getProgramBinaryCache()const{
+  assert(this!=nullptr);
+  return this->_programBinaryCache;
+}
+
+/**
+ * @brief forgets memoized programs
+ */
+void ShaderPreprocessor::clearPrograms(){
+  assert(this!=nullptr);
+  this->_programs.clear();
+}
+
+/**
+ * @brief forgets memoized programs of function table
+ * It should be called before the context of the table is destroyed,
+ * memoized programs keep the table alive.
+ *
+ * @param table opengl function table
+ */
+void ShaderPreprocessor::clearPrograms(FunctionTablePointer const&table){
+  assert(this!=nullptr);
+  this->_programs.erase(table);
+}
+
+size_t ShaderPreprocessor::getNofPrograms()const{
+  assert(this!=nullptr);
+  size_t n = 0;
+  for(auto const&x:this->_programs)
+    n += x.second.size();
+  return n;
+}
+
+size_t ShaderPreprocessor::getNofHits()const{
+  assert(this!=nullptr);
+  return this->_nofHits;
+}
+
+size_t ShaderPreprocessor::getNofMisses()const{
+  assert(this!=nullptr);
+  return this->_nofMisses;
+}
@@ -0,0 +1,409 @@
+#include<geGL/TextureStreamer.h>
+#include<geGL/OpenGLUtil.h>
+#include<algorithm>
+#include<cassert>
+#include<cmath>
+#include<cstring>
+
+using namespace ge::gl;
+
+namespace{
+  size_t const ringAlignment = 16;
+
+  size_t alignSize(size_t size){
+    return (size+ringAlignment-1)/ringAlignment*ringAlignment;
+  }
+}
+
+/**
+ * @brief creates streamer using default function table
+ *
+ * @param decoder function that decodes image, it is called from worker threads
+ * @param nofWorkers number of decoding threads
+ * @param ringSize size of pixel buffer ring in bytes
+ */
+TextureStreamer::TextureStreamer(
+    Decoder const&decoder   ,
+    size_t        nofWorkers,
+    size_t        ringSize  ):_table(getDefaultFunctionTable()),_decoder(decoder){
+  assert(this!=nullptr);
+  this->_init(nofWorkers,ringSize);
+}
+
+/**
+ * @brief creates streamer
+ *
+ * @param table opengl function table
+ * @param decoder function that decodes image, it is called from worker threads
+ * @param nofWorkers number of decoding threads
+ * @param ringSize size of pixel buffer ring in bytes
+ */
+TextureStreamer::TextureStreamer(
+    FunctionTablePointer const&table     ,
+    Decoder              const&decoder   ,
+    size_t                     nofWorkers,
+    size_t                     ringSize  ):_table(table),_decoder(decoder){
+  assert(this!=nullptr);
+  this->_init(nofWorkers,ringSize);
+}
+
+void TextureStreamer::_init(size_t nofWorkers,size_t ringSize){
+  assert(this!=nullptr);
+  assert(this->_decoder);
+  assert(ringSize>0);
+  this->_ringSize = alignSize(ringSize);
+  GLbitfield const flags = GL_MAP_WRITE_BIT|GL_MAP_PERSISTENT_BIT|GL_MAP_COHERENT_BIT;
+  this->_ring     = std::make_shared<Buffer>(this->_table,GLsizeiptr(this->_ringSize),nullptr,flags);
+  this->_ringData = static_cast<uint8_t*>(this->_ring->map(flags));
+  assert(this->_ringData!=nullptr);
+  for(size_t i=0;i<std::max<size_t>(nofWorkers,1);++i)
+    this->_workers.emplace_back(&TextureStreamer::_work,this);
+}
+
+/**
+ * @brief stops workers and releases textures and pixel buffer ring
+ * It waits for decoders that are running.
+ */
+TextureStreamer::~TextureStreamer(){
+  assert(this!=nullptr);
+  {
+    std::lock_guard<std::mutex>lock(this->_mutex);
+    this->_stop = true;
+  }
+  this->_condition.notify_all();
+  for(auto&x:this->_workers)x.join();
+  auto const&gl = this->_ring->getContext();
+  for(auto const&x:this->_fences){
+    gl.glClientWaitSync(x.sync,GL_SYNC_FLUSH_COMMANDS_BIT,GLuint64(1e9));
+    gl.glDeleteSync(x.sync);
+  }
+  this->_ring->unmap();
+}
+
+/**
+ * @brief requests texture for current frame
+ * It should be called every frame for every visible texture,
+ * it keeps the texture resident and updates its priority.
+ *
+ * @param path identifier of image passed to decoder
+ * @param screenSize size of texture on screen in pixels, 0 if unknown (only the coarsest level is required)
+ */
+void TextureStreamer::request(std::string const&path,float screenSize){
+  assert(this!=nullptr);
+  bool notify = false;
+  {
+    std::lock_guard<std::mutex>lock(this->_mutex);
+    auto&item = this->_items[path];
+    if(!item){
+      item = std::make_shared<Item>();
+      notify = true;
+    }
+    if(item->lastUse != this->_frame+1)item->priority = screenSize;
+    else item->priority = std::max(item->priority,screenSize);
+    item->lastUse = this->_frame+1;
+  }
+  if(notify)this->_condition.notify_one();
+}
+
+void TextureStreamer::_work(){
+  assert(this!=nullptr);
+  std::unique_lock<std::mutex>lock(this->_mutex);
+  for(;;){
+    std::string                path;
+    std::shared_ptr<Item>      item;
+    this->_condition.wait(lock,[&](){
+      if(this->_stop)return true;
+      for(auto const&x:this->_items){
+        if(x.second->state != QUEUED)continue;
+        if(!item || x.second->priority>item->priority){
+          path = x.first;
+          item = x.second;
+        }
+      }
+      return item != nullptr;
+    });
+    if(this->_stop)return;
+    item->state = DECODING;
+    lock.unlock();
+    Image image;
+    bool const decoded = this->_decoder(path,image) && !image.levels.empty() && image.width>0 && image.height>0;
+    lock.lock();
+    item->image = std::move(image);
+    item->state = decoded?DECODED:FAILED;
+  }
+}
+
+/**
+ * @brief computes the finest level that is needed for priority of item
+ */
+GLint TextureStreamer::_targetLevel(Item const&item)const{
+  assert(this!=nullptr);
+  GLint const coarsest = GLint(item.image.levels.size())-1;
+  if(item.priority<=0.f)return coarsest;
+  float const size  = float(std::max(item.image.width,item.image.height));
+  GLint const level = GLint(std::floor(std::log2(std::max(size/item.priority,1.f))));
+  return std::min(level,coarsest);
+}
+
+/**
+ * @brief creates texture of decoded item, it evicts least recently used textures if needed
+ *
+ * @return true if the texture fits into memory budget
+ */
+bool TextureStreamer::_makeResident(Item&item){
+  assert(this!=nullptr);
+  item.size = 0;
+  for(auto const&x:item.image.levels)item.size += x.size();
+  while(this->_memoryUsage+item.size>this->_memoryBudget){
+    auto victim = this->_items.end();
+    for(auto ii=this->_items.begin();ii!=this->_items.end();++ii){
+      auto const&candidate = *ii->second;
+      if(!candidate.texture || candidate.lastUse>=this->_frame)continue;
+      if(victim == this->_items.end() || candidate.lastUse<victim->second->lastUse)victim = ii;
+    }
+    if(victim == this->_items.end())return false;
+    this->_evict(*victim->second);
+    std::lock_guard<std::mutex>lock(this->_mutex);
+    this->_items.erase(victim);
+  }
+  GLsizei const levels = GLsizei(item.image.levels.size());
+  item.texture = std::make_shared<Texture>(this->_table,GL_TEXTURE_2D,item.image.internalFormat,levels,item.image.width,item.image.height);
+  item.texture->texParameteri(GL_TEXTURE_BASE_LEVEL,levels-1);
+  item.texture->texParameteri(GL_TEXTURE_MAX_LEVEL ,levels-1);
+  item.level = levels;
+  item.rows  = 0;
+  this->_memoryUsage += item.size;
+  return true;
+}
+
+/**
+ * @brief releases texture and decoded image of item
+ */
+void TextureStreamer::_evict(Item&item){
+  assert(this!=nullptr);
+  this->_memoryUsage -= item.size;
+  item.texture = nullptr;
+  item.image   = Image();
+  item.level   = -1;
+  item.rows    = 0;
+  item.size    = 0;
+  std::lock_guard<std::mutex>lock(this->_mutex);
+  item.state = UNKNOWN;
+}
+
+void TextureStreamer::_retireFences(){
+  assert(this!=nullptr);
+  auto const&gl = this->_ring->getContext();
+  while(!this->_fences.empty()){
+    GLenum const status = gl.glClientWaitSync(this->_fences.front().sync,0,0);
+    if(status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED)break;
+    gl.glDeleteSync(this->_fences.front().sync);
+    this->_ringUsed -= this->_fences.front().bytes;
+    this->_fences.pop_front();
+  }
+}
+
+/**
+ * @brief allocates part of pixel buffer ring that is not used by GPU
+ *
+ * @param size size in bytes
+ * @param offset returned offset
+ *
+ * @return false if the ring is full
+ */
+bool TextureStreamer::_allocate(size_t size,size_t&offset){
+  assert(this!=nullptr);
+  size = alignSize(size);
+  if(this->_ringUsed == 0)this->_ringHead = 0;//GPU does not use the ring, so the whole ring is available
+  bool   const wrap  = this->_ringHead+size>this->_ringSize;
+  size_t const waste = wrap?this->_ringSize-this->_ringHead:0;
+  if(this->_ringUsed+waste+size>this->_ringSize)return false;
+  offset = (wrap?0:this->_ringHead);
+  this->_ringHead    = offset+size;
+  this->_ringUsed   += waste+size;
+  this->_frameBytes += waste+size;
+  return true;
+}
+
+/**
+ * @brief uploads rows of the next level of item
+ * Rows are tightly packed in the ring, GL_UNPACK_ALIGNMENT has to be 1.
+ * Rows larger than the whole ring are uploaded from client memory.
+ *
+ * @param item resident item
+ * @param budget maximal number of bytes
+ *
+ * @return number of uploaded bytes
+ */
+size_t TextureStreamer::_upload(Item&item,size_t budget){
+  assert(this!=nullptr);
+  auto const&gl = this->_ring->getContext();
+  size_t uploaded = 0;
+  GLint const target = this->_targetLevel(item);
+  while(item.level>target && uploaded<budget){
+    GLint   const level    = item.level-1;
+    auto    const&data     = item.image.levels.at(size_t(level));
+    GLsizei const width    = std::max(item.image.width >>level,1);
+    GLsizei const height   = std::max(item.image.height>>level,1);
+    size_t  const rowSize  = data.size()/size_t(height);
+    size_t  const maxRows  = std::min(this->_ringSize,budget-uploaded)/std::max<size_t>(rowSize,1);
+    GLsizei const rows     = GLsizei(std::min<size_t>(std::max<size_t>(maxRows,1),size_t(height-item.rows)));
+    size_t  const size     = rowSize*size_t(rows);
+    uint8_t const*const src = data.data()+rowSize*size_t(item.rows);
+    if(rowSize>this->_ringSize){
+      //row never fits into the ring, it is uploaded directly from decoded image
+      this->_ring->unbind(GL_PIXEL_UNPACK_BUFFER);
+      gl.glTextureSubImage2D(item.texture->getId(),level,0,item.rows,width,rows,item.image.format,item.image.type,src);
+      this->_ring->bind(GL_PIXEL_UNPACK_BUFFER);
+    }else{
+      size_t offset;
+      if(!this->_allocate(size,offset))break;
+      std::memcpy(this->_ringData+offset,src,size);
+      gl.glTextureSubImage2D(item.texture->getId(),level,0,item.rows,width,rows,item.image.format,item.image.type,reinterpret_cast<GLvoid const*>(offset));
+    }
+    item.rows += rows;
+    uploaded  += size;
+    if(item.rows<height)continue;
+    item.level = level;
+    item.rows  = 0;
+    item.texture->texParameteri(GL_TEXTURE_BASE_LEVEL,level);
+    std::vector<uint8_t>().swap(item.image.levels[size_t(level)]);
+  }
+  return uploaded;
+}
+
+/**
+ * @brief processes decoded images and uploads levels in order of priority
+ * It should be called once per frame.
+ */
+void TextureStreamer::update(){
+  assert(this!=nullptr);
+  this->_frame++;
+  this->_retireFences();
+
+  std::vector<std::pair<std::string,std::shared_ptr<Item>>>items;
+  {
+    std::lock_guard<std::mutex>lock(this->_mutex);
+    for(auto const&x:this->_items)
+      if(x.second->state == DECODED || x.second->state == RESIDENT)items.push_back(x);
+  }
+  std::stable_sort(items.begin(),items.end(),[](
+        std::pair<std::string,std::shared_ptr<Item>>const&a,
+        std::pair<std::string,std::shared_ptr<Item>>const&b){
+      return a.second->priority>b.second->priority;
+      });
+
+  auto const&gl = this->_ring->getContext();
+  GLint alignment = 4;
+  gl.glGetIntegerv(GL_UNPACK_ALIGNMENT,&alignment);
+  gl.glPixelStorei(GL_UNPACK_ALIGNMENT,1);
+  this->_ring->bind(GL_PIXEL_UNPACK_BUFFER);
+  size_t uploaded = 0;
+  for(auto const&x:items){
+    auto&item = *x.second;
+    if(uploaded>=this->_uploadBudget)break;
+    if(!item.texture){
+      if(item.lastUse<this->_frame || !this->_makeResident(item))continue;
+    }
+    uploaded += this->_upload(item,this->_uploadBudget-uploaded);
+    if(item.level<GLint(item.image.levels.size())){
+      std::lock_guard<std::mutex>lock(this->_mutex);
+      item.state = RESIDENT;
+    }
+  }
+  this->_ring->unbind(GL_PIXEL_UNPACK_BUFFER);
+  gl.glPixelStorei(GL_UNPACK_ALIGNMENT,alignment);
+
+  if(this->_frameBytes){
+    this->_fences.push_back({gl.glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE,0),this->_frameBytes});
+    this->_frameBytes = 0;
+  }
+}
+
+/**
+ * @brief gets texture
+ *
+ * @param path identifier of image
+ *
+ * @return texture with at least one level uploaded, nullptr if it is not resident
+ */
+std::shared_ptr<Texture>TextureStreamer::getTexture(std::string const&path)const{
+  assert(this!=nullptr);
+  auto const ii = this->_items.find(path);
+  if(ii == this->_items.end())return nullptr;
+  auto const&item = *ii->second;
+  if(!item.texture || item.level>=GLint(item.image.levels.size()))return nullptr;
+  return item.texture;
+}
+
+TextureStreamer::State TextureStreamer::getState(std::string const&path)const{
+  assert(this!=nullptr);
+  std::lock_guard<std::mutex>lock(this->_mutex);
+  auto const ii = this->_items.find(path);
+  if(ii == this->_items.end())return UNKNOWN;
+  return ii->second->state;
+}
+
+/**
+ * @brief gets the finest uploaded level
+ *
+ * @param path identifier of image
+ *
+ * @return level, -1 if the texture is not resident
+ */
+GLint TextureStreamer::getResidentLevel(std::string const&path)const{
+  assert(this!=nullptr);
+  auto const texture = this->getTexture(path);
+  if(!texture)return -1;
+  return this->_items.at(path)->level;
+}
+
+/**
+ * @brief sets budget of texture memory
+ *
+ * @param bytes budget in bytes
+ */
+void TextureStreamer::setMemoryBudget(size_t bytes){
+  assert(this!=nullptr);
+  this->_memoryBudget = bytes;
+}
+
+size_t TextureStreamer::getMemoryBudget()const{
+  assert(this!=nullptr);
+  return this->_memoryBudget;
+}
+
+/**
+ * @brief sets maximal number of bytes uploaded by one update()
+ *
+ * @param bytes budget in bytes
+ */
+void TextureStreamer::setUploadBudget(size_t bytes){
+  assert(this!=nullptr);
+  this->_uploadBudget = bytes;
+}
+
+size_t TextureStreamer::getUploadBudget()const{
+  assert(this!=nullptr);
+  return this->_uploadBudget;
+}
+
+/**
+ * @brief gets memory of resident textures
+ *
+ * @return bytes of all levels of resident textures
+ */
+size_t TextureStreamer::getMemoryUsage()const{
+  assert(this!=nullptr);
+  return this->_memoryUsage;
+}
+
+size_t TextureStreamer::getRingSize()const{
+  assert(this!=nullptr);
+  return this->_ringSize;
+}
+
+uint64_t TextureStreamer::getFrame()const{
+  assert(this!=nullptr);
+  return this->_frame;
+}
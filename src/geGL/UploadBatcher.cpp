@@ -0,0 +1,252 @@
+#include<geGL/UploadBatcher.h>
+#include<algorithm>
+#include<cassert>
+#include<cstring>
+#include<numeric>
+
+using namespace ge::gl;
+
+namespace{
+  size_t const stagingAlignment = 16;
+
+  size_t alignSize(size_t size){
+    return (size+stagingAlignment-1)/stagingAlignment*stagingAlignment;
+  }
+}
+
+/**
+ * @brief creates batcher using default function table
+ *
+ * @param stagingSize size of staging buffer in bytes
+ */
+UploadBatcher::UploadBatcher(GLsizeiptr stagingSize){
+  assert(this!=nullptr);
+  this->_staging = std::make_shared<Buffer>();
+  this->_init(stagingSize);
+}
+
+/**
+ * @brief creates batcher
+ *
+ * @param table opengl function table
+ * @param stagingSize size of staging buffer in bytes
+ */
+UploadBatcher::UploadBatcher(
+    FunctionTablePointer const&table      ,
+    GLsizeiptr                 stagingSize){
+  assert(this!=nullptr);
+  this->_staging = std::make_shared<Buffer>(table);
+  this->_init(stagingSize);
+}
+
+void UploadBatcher::_init(GLsizeiptr stagingSize){
+  assert(this!=nullptr);
+  assert(stagingSize>0);
+  this->_stagingSize = alignSize(size_t(stagingSize));
+  GLbitfield const flags = GL_MAP_WRITE_BIT|GL_MAP_PERSISTENT_BIT|GL_MAP_COHERENT_BIT;
+  this->_staging->alloc(GLsizeiptr(this->_stagingSize),nullptr,flags);
+  this->_stagingData = static_cast<uint8_t*>(this->_staging->map(flags));
+  assert(this->_stagingData!=nullptr);
+}
+
+/**
+ * @brief flushes pending writes and releases staging buffer
+ * It waits for copies that are in flight.
+ */
+UploadBatcher::~UploadBatcher(){
+  assert(this!=nullptr);
+  this->flush();
+  auto const&gl = this->_staging->getContext();
+  for(auto const&x:this->_fences){
+    gl.glClientWaitSync(x.sync,GL_SYNC_FLUSH_COMMANDS_BIT,GLuint64(1e9));
+    gl.glDeleteSync(x.sync);
+  }
+  this->_staging->unmap();
+}
+
+/**
+ * @brief records write into buffer, the data are copied, so they can be released after the call
+ *
+ * @param buffer destination buffer, it has to live until flush()
+ * @param data data
+ * @param size size of data in bytes
+ * @param offset offset in destination buffer
+ */
+void UploadBatcher::setData(
+    Buffer     const&buffer,
+    GLvoid     const*data  ,
+    GLsizeiptr       size  ,
+    GLintptr         offset){
+  assert(this!=nullptr);
+  assert(data!=nullptr || size==0);
+  if(size<=0)return;
+  size_t const position = this->_data.size();
+  this->_data.resize(position+size_t(size));
+  std::memcpy(this->_data.data()+position,data,size_t(size));
+  this->_writes.push_back({&buffer,offset,size,position});
+}
+
+void UploadBatcher::_retireFences(){
+  assert(this!=nullptr);
+  auto const&gl = this->_staging->getContext();
+  while(!this->_fences.empty()){
+    GLenum const status = gl.glClientWaitSync(this->_fences.front().sync,0,0);
+    if(status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED)break;
+    gl.glDeleteSync(this->_fences.front().sync);
+    this->_ringUsed -= this->_fences.front().bytes;
+    this->_fences.pop_front();
+  }
+}
+
+/**
+ * @brief allocates part of staging ring that is not used by GPU
+ *
+ * @param size size in bytes
+ * @param offset returned offset
+ *
+ * @return false if the ring is full
+ */
+bool UploadBatcher::_allocate(size_t size,size_t&offset){
+  assert(this!=nullptr);
+  size = alignSize(size);
+  size_t const waste = this->_ringHead+size>this->_stagingSize?this->_stagingSize-this->_ringHead:0;
+  if(this->_ringUsed+waste+size>this->_stagingSize)return false;
+  offset = (waste?0:this->_ringHead);
+  this->_ringHead  = offset+size;
+  this->_ringUsed += waste+size;
+  return true;
+}
+
+/**
+ * @brief uploads pending writes
+ * Writes are merged into ranges of consecutive bytes per buffer,
+ * each range is uploaded by one copy from staging buffer.
+ */
+void UploadBatcher::flush(){
+  assert(this!=nullptr);
+  this->_retireFences();
+  this->_nofWrites    = this->_writes.size();
+  this->_nofCopies    = 0;
+  this->_nofFallbacks = 0;
+  if(this->_writes.empty())return;
+
+  auto const&writes = this->_writes;
+  std::vector<size_t>order(writes.size());
+  std::iota(order.begin(),order.end(),size_t(0));
+  std::sort(order.begin(),order.end(),[&](size_t a,size_t b){
+      if(writes[a].buffer != writes[b].buffer)return writes[a].buffer<writes[b].buffer;
+      if(writes[a].offset != writes[b].offset)return writes[a].offset<writes[b].offset;
+      return a<b;
+      });
+
+  auto const&gl = this->_staging->getContext();
+  size_t const usedBefore = this->_ringUsed;
+  std::vector<uint8_t>scratch;
+  for(size_t i=0;i<order.size();){
+    Buffer const*const buffer = writes[order[i]].buffer;
+    GLintptr const begin = writes[order[i]].offset;
+    GLintptr       end   = begin+writes[order[i]].size;
+    size_t j = i+1;
+    while(j<order.size() && writes[order[j]].buffer == buffer && writes[order[j]].offset<=end){
+      end = std::max(end,writes[order[j]].offset+writes[order[j]].size);
+      j++;
+    }
+    //later writes overwrite earlier ones
+    std::sort(order.begin()+std::ptrdiff_t(i),order.begin()+std::ptrdiff_t(j));
+    size_t const size = size_t(end-begin);
+    size_t offset = 0;
+    bool const staged = this->_allocate(size,offset);
+    uint8_t*destination;
+    if(staged)destination = this->_stagingData+offset;
+    else{
+      scratch.resize(size);
+      destination = scratch.data();
+    }
+    for(size_t k=i;k<j;++k){
+      auto const&w = writes[order[k]];
+      std::memcpy(destination+(w.offset-begin),this->_data.data()+w.data,size_t(w.size));
+    }
+    if(staged){
+      gl.glCopyNamedBufferSubData(this->_staging->getId(),buffer->getId(),GLintptr(offset),begin,GLsizeiptr(size));
+      this->_nofCopies++;
+    }else{
+      buffer->setData(destination,GLsizeiptr(size),begin);
+      this->_nofFallbacks++;
+    }
+    i = j;
+  }
+  if(this->_ringUsed != usedBefore)
+    this->_fences.push_back({gl.glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE,0),this->_ringUsed-usedBefore});
+  this->_writes.clear();
+  this->_data.clear();
+}
+
+/**
+ * @brief drops pending writes into buffer
+ * It has to be called before the buffer is released if it has writes pending.
+ * Memory of dropped data is released by the next flush().
+ *
+ * @param buffer destination buffer
+ */
+void UploadBatcher::cancel(Buffer const&buffer){
+  assert(this!=nullptr);
+  auto const newEnd = std::remove_if(this->_writes.begin(),this->_writes.end(),
+      [&buffer](Write const&w){return w.buffer == &buffer;});
+  this->_writes.erase(newEnd,this->_writes.end());
+  if(this->_writes.empty())this->_data.clear();
+}
+
+/**
+ * @brief gets number of writes recorded since the last flush
+ *
+ * @return number of writes
+ */
+size_t UploadBatcher::getNofPendingWrites()const{
+  assert(this!=nullptr);
+  return this->_writes.size();
+}
+
+/**
+ * @brief gets size of data recorded since the last flush
+ *
+ * @return size in bytes
+ */
+GLsizeiptr UploadBatcher::getPendingSize()const{
+  assert(this!=nullptr);
+  return GLsizeiptr(this->_data.size());
+}
+
+GLsizeiptr UploadBatcher::getStagingSize()const{
+  assert(this!=nullptr);
+  return GLsizeiptr(this->_stagingSize);
+}
+
+/**
+ * @brief gets number of writes uploaded by the last flush
+ *
+ * @return number of writes
+ */
+size_t UploadBatcher::getNofWrites()const{
+  assert(this!=nullptr);
+  return this->_nofWrites;
+}
+
+/**
+ * @brief gets number of copies issued by the last flush
+ *
+ * @return number of glCopyNamedBufferSubData calls
+ */
+size_t UploadBatcher::getNofCopies()const{
+  assert(this!=nullptr);
+  return this->_nofCopies;
+}
+
+/**
+ * @brief gets number of ranges of the last flush that did not fit into staging buffer
+ *
+ * @return number of glNamedBufferSubData calls
+ */
+size_t UploadBatcher::getNofFallbacks()const{
+  assert(this!=nullptr);
+  return this->_nofFallbacks;
+}
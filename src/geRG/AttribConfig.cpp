@@ -52,6 +52,13 @@ static AttribConfigId getAttribTypeId(const AttribType t)
 {
    if(t==AttribType::Empty)
       return 0;
+   else if(t.encoding()!=AttribType::NO_ENCODING) {
+      if(t==AttribType::CompressedPosition) return 10;
+      if(t==AttribType::CompressedNormal)   return 11;
+      if(t==AttribType::CompressedTexCoord) return 12;
+      if(t==AttribType::CompressedColor)    return 13;
+      return unsigned(-1);
+   }
    else
       switch(t.glType()) {
          case GLType::FLOAT:
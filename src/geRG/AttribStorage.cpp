@@ -1,8 +1,10 @@
 #include <iostream> // for cerr
 #include <memory>
+#include <vector>
 #include <geRG/AttribStorage.h>
 #include <geRG/Mesh.h>
 #include <geRG/StateSet.h>
+#include <geGL/UploadBatcher.h>
 #include <geGL/VertexArray.h>
 
 using namespace ge::rg;
@@ -59,30 +61,49 @@ AttribStorage::AttribStorage(const AttribConfig& attribConfig,unsigned numVertic
    }
 
    // append transformation matrix to VAO
-   if(_renderingContext->getUseARBShaderDrawParameters()==false) {
-      _va->bind();
-      _renderingContext->matrixStorage()->buffer()->bind(GL_ARRAY_BUFFER);
-      const GLuint index=12;
-      auto& gl=_va->getContext();
-      gl.glEnableVertexAttribArray(index+0);
-      gl.glEnableVertexAttribArray(index+1);
-      gl.glEnableVertexAttribArray(index+2);
-      gl.glEnableVertexAttribArray(index+3);
-      gl.glVertexAttribPointer(index+0,4,GL_FLOAT,GL_FALSE,int(sizeof(float)*16),(void*)(sizeof(float)*0));
-      gl.glVertexAttribPointer(index+1,4,GL_FLOAT,GL_FALSE,int(sizeof(float)*16),(void*)(sizeof(float)*4));
-      gl.glVertexAttribPointer(index+2,4,GL_FLOAT,GL_FALSE,int(sizeof(float)*16),(void*)(sizeof(float)*8));
-      gl.glVertexAttribPointer(index+3,4,GL_FLOAT,GL_FALSE,int(sizeof(float)*16),(void*)(sizeof(float)*12));
-      gl.glVertexAttribDivisor(index+0,1);
-      gl.glVertexAttribDivisor(index+1,1);
-      gl.glVertexAttribDivisor(index+2,1);
-      gl.glVertexAttribDivisor(index+3,1);
-      _va->unbind();
-   }
+   if(_renderingContext->getUseARBShaderDrawParameters()==false)
+      setupInstancingMatrixAttribs();
+}
+
+
+/** Sets up vertex attributes 12..15 of the VAO to source instancing matrices
+ *  from RenderingContext::matrixStorage() buffer. It is used when
+ *  ARB_shader_draw_parameters is not in use. It has to be called again
+ *  whenever the matrix buffer gets new id (see RenderingContext::setFrameRingSize()).
+ */
+void AttribStorage::setupInstancingMatrixAttribs()
+{
+   _va->bind();
+   _renderingContext->matrixStorage()->buffer()->bind(GL_ARRAY_BUFFER);
+   const GLuint index=12;
+   auto& gl=_va->getContext();
+   gl.glEnableVertexAttribArray(index+0);
+   gl.glEnableVertexAttribArray(index+1);
+   gl.glEnableVertexAttribArray(index+2);
+   gl.glEnableVertexAttribArray(index+3);
+   gl.glVertexAttribPointer(index+0,4,GL_FLOAT,GL_FALSE,int(sizeof(float)*16),(void*)(sizeof(float)*0));
+   gl.glVertexAttribPointer(index+1,4,GL_FLOAT,GL_FALSE,int(sizeof(float)*16),(void*)(sizeof(float)*4));
+   gl.glVertexAttribPointer(index+2,4,GL_FLOAT,GL_FALSE,int(sizeof(float)*16),(void*)(sizeof(float)*8));
+   gl.glVertexAttribPointer(index+3,4,GL_FLOAT,GL_FALSE,int(sizeof(float)*16),(void*)(sizeof(float)*12));
+   gl.glVertexAttribDivisor(index+0,1);
+   gl.glVertexAttribDivisor(index+1,1);
+   gl.glVertexAttribDivisor(index+2,1);
+   gl.glVertexAttribDivisor(index+3,1);
+   _va->unbind();
 }
 
 
 AttribStorage::~AttribStorage()
 {
+   // drop batched uploads, the buffers are going to be released
+   UploadBatcher *batcher=_renderingContext->uploadBatcher().get();
+   if(batcher) {
+      for(auto& b : _bufferList)
+         batcher->cancel(*b);
+      if(_eb)
+         batcher->cancel(*_eb);
+   }
+
    // invalidate all allocations and clean up
    cancelAllAllocations();
    _renderingContext->onAttribStorageRelease(this);
@@ -211,23 +232,55 @@ void AttribStorage::freeData(Mesh &mesh)
 void AttribStorage::uploadVertices(Mesh &mesh,const void*const *attribList,
                                    unsigned attribListSize,
                                    unsigned numVertices,unsigned fromIndex)
+{
+   uploadVertexData(mesh,attribList,attribListSize,numVertices,fromIndex,false);
+}
+
+
+/** Uploads vertices that were converted by AttribType::encode() in advance,
+ *  for instance on a worker thread by SceneRecorder. Attributes without encoding
+ *  are uploaded as by uploadVertices().
+ */
+void AttribStorage::uploadEncodedVertices(Mesh &mesh,const void*const *attribList,
+                                          unsigned attribListSize,
+                                          unsigned numVertices,unsigned fromIndex)
+{
+   uploadVertexData(mesh,attribList,attribListSize,numVertices,fromIndex,true);
+}
+
+
+void AttribStorage::uploadVertexData(Mesh &mesh,const void*const *attribList,
+                                     unsigned attribListSize,
+                                     unsigned numVertices,unsigned fromIndex,bool encoded)
 {
    auto& cfg=_attribConfig.configuration();
    unsigned c=unsigned(cfg.attribTypes.size());
    assert(c==attribListSize && "Number of attributes passed in parameters and stored inside "
                                "AttribStorage must match.");
    unsigned dstIndex=_vertexAllocationManager[mesh.verticesDataId()].startIndex+fromIndex;
+   UploadBatcher *batcher=_renderingContext->uploadBatcher().get();
+   vector<uint8_t> encodedData;
    for(unsigned i=0,j=0; i<c; i++)
    {
       AttribType t=cfg.attribTypes[i];
       if(t==AttribType::Empty)
          continue;
       unsigned elementSize=t.elementSize();
-      unsigned srcOffset=fromIndex*elementSize;
+      unsigned srcOffset=fromIndex*(encoded?elementSize:t.sourceElementSize());
       unsigned dstOffset=dstIndex*elementSize;
-      const void *data=attribList[i];
-      _bufferList[j]->setData(((uint8_t*)data)+srcOffset,
-                              numVertices*elementSize,dstOffset);
+      const uint8_t *data=((const uint8_t*)attribList[i])+srcOffset;
+
+      // convert compressed attributes from float source data
+      if(!encoded && t.encoding()!=AttribType::NO_ENCODING) {
+         encodedData.resize(numVertices*elementSize);
+         t.encode(encodedData.data(),data,numVertices);
+         data=encodedData.data();
+      }
+
+      if(batcher)
+         batcher->setData(*_bufferList[j],data,numVertices*elementSize,dstOffset);
+      else
+         _bufferList[j]->setData(data,numVertices*elementSize,dstOffset);
       j++;
    }
 }
@@ -245,7 +298,11 @@ void AttribStorage::uploadIndices(Mesh &mesh,const void *indices,
    const unsigned elementSize=4;
    unsigned srcOffset=fromIndex*elementSize;
    unsigned dstOffset=(_indexAllocationManager[mesh.indicesDataId()].startIndex+fromIndex)*elementSize;
-   _eb->setData((uint8_t*)indices+srcOffset,numIndices*elementSize,dstOffset);
+   UploadBatcher *batcher=_renderingContext->uploadBatcher().get();
+   if(batcher)
+      batcher->setData(*_eb,(uint8_t*)indices+srcOffset,numIndices*elementSize,dstOffset);
+   else
+      _eb->setData((uint8_t*)indices+srcOffset,numIndices*elementSize,dstOffset);
 }
 
 
@@ -254,8 +311,31 @@ void AttribStorage::render(const std::vector<RenderingCommandData>& renderingDat
    // bind VAO
    bind();
 
+   // perform indirect draw calls
+   draw(renderingDataList);
+}
+
+
+void AttribStorage::draw(const std::vector<RenderingCommandData>& renderingDataList)
+{
    // perform indirect draw calls
    auto& gl=_va->getContext();
+   if(_renderingContext->indirectCountEnabled())
+   {
+      // number of records is read from draw count buffer (bound as GL_PARAMETER_BUFFER),
+      // drawCommandCount is just the upper bound
+      bool ebo=attribConfig().configuration().ebo;
+      for(auto it2=renderingDataList.begin(),e=renderingDataList.end(); it2!=e; it2++)
+      {
+         GLintptr offset=it2->indirectBufferOffset4*4;
+         GLintptr countOffset=it2->stateSetBufferOffset4*4;
+         if(ebo)
+            gl.glMultiDrawElementsIndirectCountARB(it2->glMode,GL_UNSIGNED_INT,offset,countOffset,GLsizei(it2->drawCommandCount),0);
+         else
+            gl.glMultiDrawArraysIndirectCountARB(it2->glMode,offset,countOffset,GLsizei(it2->drawCommandCount),0);
+      }
+      return;
+   }
    if(attribConfig().configuration().ebo)
       for(auto it2=renderingDataList.begin(),e=renderingDataList.end(); it2!=e; it2++)
       {
@@ -289,6 +369,99 @@ void AttribStorage::cancelAllAllocations()
 }
 
 
+/** Moves data inside the buffer towards its beginning (dstOffset<srcOffset).
+ *  Overlapping ranges are copied through the temporary buffer,
+ *  so the move costs at most two copies regardless of the overlap.
+ */
+void AttribStorage::moveBufferData(Buffer &buffer,size_t srcOffset,size_t dstOffset,size_t size)
+{
+   auto& gl=_va->getContext();
+   if(dstOffset+size<=srcOffset) {
+      gl.glCopyNamedBufferSubData(buffer.getId(),buffer.getId(),srcOffset,dstOffset,size);
+      return;
+   }
+   if(_compactionBuffer==nullptr || size_t(_compactionBuffer->getSize())<size)
+      _compactionBuffer=make_shared<Buffer>(size,nullptr,GL_DYNAMIC_COPY);
+   GLuint tmp=_compactionBuffer->getId();
+   gl.glCopyNamedBufferSubData(buffer.getId(),tmp,srcOffset,0,size);
+   gl.glCopyNamedBufferSubData(tmp,buffer.getId(),0,dstOffset,size);
+}
+
+
+/** Performs incremental compaction of vertex and index buffers.
+ *
+ *  Allocated arrays are moved towards the beginning of the buffers
+ *  to fill free blocks left by freed meshes. Data are moved on GPU
+ *  by buffer-to-buffer copies, at most two per buffer and moved array
+ *  (array overlapping its destination goes through a temporary buffer),
+ *  and vertexOffsets of all primitives of moved meshes
+ *  are updated in the primitive storage. At most maxBytes are copied in a single call
+ *  (with exception of a single array that is larger than maxBytes),
+ *  so the method can be called each frame to spread the work over time.
+ *
+ *  Returns the number of copied bytes.
+ *
+ *  The method requires active graphics context.
+ *  Pending uploads of RenderingContext::uploadBatcher() are flushed first,
+ *  so the moved data are up to date and no batched write targets the freed range.
+ *  Primitive storage is left mapped, call RenderingContext::unmapBuffers()
+ *  before GPU work.
+ */
+unsigned AttribStorage::compact(unsigned maxBytes)
+{
+   // batched writes have to land before the data are moved
+   UploadBatcher *batcher=_renderingContext->uploadBatcher().get();
+   if(batcher && batcher->getNofPendingWrites()>0)
+      batcher->flush();
+
+   // vertex size of all attributes
+   auto& cfg=_attribConfig.configuration();
+   unsigned vertexSize=0;
+   for(auto it=cfg.attribTypes.begin(); it!=cfg.attribTypes.end(); it++)
+      if(*it!=AttribType::Empty)
+         vertexSize+=it->elementSize();
+
+   unsigned numBytes=0;
+
+   // compact vertices
+   if(vertexSize>0 && maxBytes>=vertexSize)
+   {
+      unsigned numVertices=_vertexAllocationManager.compact(maxBytes/vertexSize,
+         [this,&cfg](unsigned src,unsigned dst,unsigned num) {
+            for(unsigned i=0,j=0,c=unsigned(cfg.attribTypes.size()); i<c; i++)
+            {
+               AttribType t=cfg.attribTypes[i];
+               if(t==AttribType::Empty)
+                  continue;
+               size_t elementSize=t.elementSize();
+               moveBufferData(*_bufferList[j],src*elementSize,dst*elementSize,num*elementSize);
+               j++;
+            }
+         },
+         [this](unsigned id,unsigned) { _renderingContext->updateVertexOffsets(*_vertexAllocationManager[id].owner); });
+      numBytes+=numVertices*vertexSize;
+   }
+
+   // compact indices
+   const unsigned indexSize=4;
+   if(_eb && maxBytes>=numBytes+indexSize)
+   {
+      unsigned numIndices=_indexAllocationManager.compact((maxBytes-numBytes)/indexSize,
+         [this](unsigned src,unsigned dst,unsigned num) {
+            moveBufferData(*_eb,size_t(src)*indexSize,size_t(dst)*indexSize,size_t(num)*indexSize);
+         },
+         [this](unsigned id,unsigned oldStartIndex) {
+            // base vertex is not affected, first index is shifted
+            auto& a=_indexAllocationManager[id];
+            _renderingContext->updateVertexOffsets(*a.owner,int(a.startIndex)-int(oldStartIndex));
+         });
+      numBytes+=numIndices*indexSize;
+   }
+
+   return numBytes;
+}
+
+
 shared_ptr<AttribStorage> AttribStorage::Factory::create(const AttribConfig& config,
         unsigned numVertices,unsigned numIndices)
 {
@@ -1,5 +1,12 @@
+#include <cmath>
+#include <cstring>
 #include <geRG/AttribType.h>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP>=2)
+# define GE_RG_USE_SSE
+# include <emmintrin.h>
+#endif
+
 using namespace ge::rg;
 
 static_assert(sizeof(AttribType)==8,
@@ -93,6 +100,223 @@ const AttribType AttribType::DMat3x4{GLType::DMAT3X4,12,8*12,NOT_DEFINED};
 const AttribType AttribType::DMat4x2{GLType::DMAT4X2,8, 8*8, NOT_DEFINED};
 const AttribType AttribType::DMat4x3{GLType::DMAT4X3,12,8*12,NOT_DEFINED};
 
+const AttribType AttribType::CompressedPosition{GLType::HALF_FLOAT,    3,2*3,USE_FLOAT,        0,HALF_FLOAT_ENCODING};
+const AttribType AttribType::CompressedNormal  {GLType::SHORT,         2,2*2,INTEGER_NORMALIZE,0,OCTAHEDRAL_ENCODING};
+const AttribType AttribType::CompressedTexCoord{GLType::UNSIGNED_SHORT,2,2*2,INTEGER_NORMALIZE,0,UNORM_ENCODING};
+const AttribType AttribType::CompressedColor   {GLType::UNSIGNED_BYTE, 4,1*4,INTEGER_NORMALIZE,0,UNORM_ENCODING};
+
+
+
+// scalar encoders
+// (used for the data that do not fill whole SSE register and when SSE is not available)
+
+static inline uint16_t floatToHalf(float value)
+{
+   uint32_t f;
+   memcpy(&f,&value,4);
+   uint32_t sign=f&0x80000000;
+   f^=sign;
+   uint32_t r;
+   if(f>=0x47800000)  // overflow to infinity, NaN
+      r=f>0x7f800000 ? 0x7e00 : 0x7c00;
+   else if(f<0x38800000) {  // denormals and zero
+      // rounding is done by float addition of the value scaled to half denormal range
+      float v;
+      memcpy(&v,&f,4);
+      v+=0.5f;
+      memcpy(&r,&v,4);
+      r-=0x3f000000;
+   }
+   else  // normals, rounded to nearest even
+      r=(f+0xc8000fff+((f>>13)&1))>>13;
+   return uint16_t(r|(sign>>16));
+}
+
+static inline float clamp01(float v)  { return v<0.f ? 0.f : v>1.f ? 1.f : v; }
+
+static inline void octahedralEncode(int16_t *dst,const float *n)
+{
+   float l1=fabs(n[0])+fabs(n[1])+fabs(n[2]);
+   float inv=l1>1e-30f ? 1.f/l1 : 0.f;
+   float x=n[0]*inv;
+   float y=n[1]*inv;
+   if(n[2]<0.f) {
+      float fx=(1.f-fabs(y))*(x>=0.f?1.f:-1.f);
+      y=(1.f-fabs(x))*(y>=0.f?1.f:-1.f);
+      x=fx;
+   }
+   dst[0]=int16_t(floor(x*32767.f+0.5f));
+   dst[1]=int16_t(floor(y*32767.f+0.5f));
+}
+
+
+#ifdef GE_RG_USE_SSE
+
+// SSE encoders, each processes four values at once
+
+static inline __m128i floatToHalf4(__m128 f)
+{
+   // the same operations as floatToHalf(), so the results are identical
+   // (round to nearest even, denormals rounded by float addition)
+   const __m128i absMask=_mm_set1_epi32(0x7fffffff);
+   const __m128i f32Infinity=_mm_set1_epi32(255<<23);
+
+   __m128i fi=_mm_castps_si128(f);
+   __m128i absi=_mm_and_si128(fi,absMask);
+   __m128i sign=_mm_srli_epi32(_mm_andnot_si128(absMask,fi),16);
+
+   // overflow to infinity, NaN
+   __m128i isOverflow=_mm_cmpgt_epi32(absi,_mm_set1_epi32(0x477fffff));
+   __m128i isNaN=_mm_cmpgt_epi32(absi,f32Infinity);
+   __m128i infOrNaN=_mm_or_si128(_mm_and_si128(isNaN,_mm_set1_epi32(0x200)),_mm_set1_epi32(0x7c00));
+
+   // denormals and zero
+   __m128i isDenormal=_mm_cmpgt_epi32(_mm_set1_epi32(0x38800000),absi);
+   __m128 d=_mm_add_ps(_mm_castsi128_ps(absi),_mm_set1_ps(0.5f));
+   __m128i denormal=_mm_sub_epi32(_mm_castps_si128(d),_mm_set1_epi32(0x3f000000));
+
+   // normals, rounded to nearest even
+   __m128i odd=_mm_and_si128(_mm_srli_epi32(absi,13),_mm_set1_epi32(1));
+   __m128i normal=_mm_srli_epi32(_mm_add_epi32(_mm_add_epi32(absi,_mm_set1_epi32(int(0xc8000fff))),odd),13);
+
+   __m128i r=_mm_or_si128(_mm_and_si128(isDenormal,denormal),_mm_andnot_si128(isDenormal,normal));
+   r=_mm_or_si128(_mm_and_si128(isOverflow,infOrNaN),_mm_andnot_si128(isOverflow,r));
+   return _mm_or_si128(r,sign);
+}
+
+static inline __m128i packU32ToU16(__m128i lo,__m128i hi)
+{
+   // SSE2 has only signed saturating pack, so values are sign-extended from 16 bits first
+   lo=_mm_srai_epi32(_mm_slli_epi32(lo,16),16);
+   hi=_mm_srai_epi32(_mm_slli_epi32(hi,16),16);
+   return _mm_packs_epi32(lo,hi);
+}
+
+static inline __m128i floatToUnorm4(__m128 f,float scale)
+{
+   f=_mm_min_ps(_mm_max_ps(f,_mm_setzero_ps()),_mm_set1_ps(1.f));
+   return _mm_cvtps_epi32(_mm_mul_ps(f,_mm_set1_ps(scale)));
+}
+
+static inline __m128i octahedralEncode4(const float *src)
+{
+   // AoS xyz,xyz,xyz,xyz to SoA xxxx,yyyy,zzzz
+   __m128 a=_mm_loadu_ps(src);
+   __m128 b=_mm_loadu_ps(src+4);
+   __m128 c=_mm_loadu_ps(src+8);
+   __m128 x=_mm_shuffle_ps(_mm_shuffle_ps(a,a,_MM_SHUFFLE(3,3,0,0)),_mm_shuffle_ps(b,c,_MM_SHUFFLE(1,1,2,2)),_MM_SHUFFLE(2,0,2,0));
+   __m128 y=_mm_shuffle_ps(_mm_shuffle_ps(a,b,_MM_SHUFFLE(0,0,1,1)),_mm_shuffle_ps(b,c,_MM_SHUFFLE(2,2,3,3)),_MM_SHUFFLE(2,0,2,0));
+   __m128 z=_mm_shuffle_ps(_mm_shuffle_ps(a,b,_MM_SHUFFLE(1,1,2,2)),_mm_shuffle_ps(c,c,_MM_SHUFFLE(3,3,0,0)),_MM_SHUFFLE(2,0,2,0));
+
+   // projection on octahedron
+   const __m128 signMask=_mm_castsi128_ps(_mm_set1_epi32(int(0x80000000)));
+   const __m128 one=_mm_set1_ps(1.f);
+   __m128 ax=_mm_andnot_ps(signMask,x);
+   __m128 ay=_mm_andnot_ps(signMask,y);
+   __m128 az=_mm_andnot_ps(signMask,z);
+   __m128 l1=_mm_max_ps(_mm_add_ps(_mm_add_ps(ax,ay),az),_mm_set1_ps(1e-30f));
+   __m128 inv=_mm_div_ps(one,l1);
+   x=_mm_mul_ps(x,inv);
+   y=_mm_mul_ps(y,inv);
+   ax=_mm_mul_ps(ax,inv);
+   ay=_mm_mul_ps(ay,inv);
+
+   // lower hemisphere is folded over the diagonals
+   __m128 lower=_mm_cmplt_ps(z,_mm_setzero_ps());
+   __m128 fx=_mm_or_ps(_mm_sub_ps(one,ay),_mm_and_ps(x,signMask));
+   __m128 fy=_mm_or_ps(_mm_sub_ps(one,ax),_mm_and_ps(y,signMask));
+   x=_mm_or_ps(_mm_and_ps(lower,fx),_mm_andnot_ps(lower,x));
+   y=_mm_or_ps(_mm_and_ps(lower,fy),_mm_andnot_ps(lower,y));
+
+   // snorm16, interleaved xy,xy,xy,xy
+   const __m128 scale=_mm_set1_ps(32767.f);
+   __m128i ix=_mm_cvtps_epi32(_mm_mul_ps(x,scale));
+   __m128i iy=_mm_cvtps_epi32(_mm_mul_ps(y,scale));
+   return _mm_packs_epi32(_mm_unpacklo_epi32(ix,iy),_mm_unpackhi_epi32(ix,iy));
+}
+
+#endif
+
+
+
+/** Converts numVertices attribute items of source data into the stored format.
+ *
+ *  Source items are of sourceElementSize() bytes, destination items
+ *  are of elementSize() bytes. For NO_ENCODING, the data are copied.
+ *  Values out of range of UNORM_ENCODING are clamped. Normals of OCTAHEDRAL_ENCODING
+ *  need not be normalized, zero vectors are encoded as (0,0,1).
+ */
+void AttribType::encode(void *dst,const void *src,unsigned numVertices) const
+{
+   const float *s=static_cast<const float*>(src);
+   switch(encoding()) {
+
+      case NO_ENCODING:
+         memcpy(dst,src,size_t(numVertices)*elementSize());
+         break;
+
+      case HALF_FLOAT_ENCODING: {
+         assert(glType()==GLType::HALF_FLOAT && "HALF_FLOAT_ENCODING requires GLType::HALF_FLOAT.");
+         uint16_t *d=static_cast<uint16_t*>(dst);
+         size_t n=size_t(numVertices)*numComponents();
+         size_t i=0;
+#ifdef GE_RG_USE_SSE
+         for(; i+8<=n; i+=8)
+            _mm_storeu_si128((__m128i*)(d+i),packU32ToU16(floatToHalf4(_mm_loadu_ps(s+i)),
+                                                          floatToHalf4(_mm_loadu_ps(s+i+4))));
+#endif
+         for(; i<n; i++)
+            d[i]=floatToHalf(s[i]);
+         break;
+      }
+
+      case OCTAHEDRAL_ENCODING: {
+         assert(glType()==GLType::SHORT && numComponents()==2 &&
+                "OCTAHEDRAL_ENCODING requires two components of GLType::SHORT.");
+         int16_t *d=static_cast<int16_t*>(dst);
+         unsigned i=0;
+#ifdef GE_RG_USE_SSE
+         for(; i+4<=numVertices; i+=4)
+            _mm_storeu_si128((__m128i*)(d+i*2),octahedralEncode4(s+i*3));
+#endif
+         for(; i<numVertices; i++)
+            octahedralEncode(d+i*2,s+i*3);
+         break;
+      }
+
+      case UNORM_ENCODING: {
+         size_t n=size_t(numVertices)*numComponents();
+         size_t i=0;
+         if(glType()==GLType::UNSIGNED_SHORT) {
+            uint16_t *d=static_cast<uint16_t*>(dst);
+#ifdef GE_RG_USE_SSE
+            for(; i+8<=n; i+=8)
+               _mm_storeu_si128((__m128i*)(d+i),packU32ToU16(floatToUnorm4(_mm_loadu_ps(s+i),65535.f),
+                                                             floatToUnorm4(_mm_loadu_ps(s+i+4),65535.f)));
+#endif
+            for(; i<n; i++)
+               d[i]=uint16_t(floor(clamp01(s[i])*65535.f+0.5f));
+         }
+         else {
+            assert(glType()==GLType::UNSIGNED_BYTE && "UNORM_ENCODING requires GLType::UNSIGNED_SHORT or GLType::UNSIGNED_BYTE.");
+            uint8_t *d=static_cast<uint8_t*>(dst);
+#ifdef GE_RG_USE_SSE
+            for(; i+16<=n; i+=16) {
+               __m128i lo=_mm_packs_epi32(floatToUnorm4(_mm_loadu_ps(s+i),255.f),
+                                          floatToUnorm4(_mm_loadu_ps(s+i+4),255.f));
+               __m128i hi=_mm_packs_epi32(floatToUnorm4(_mm_loadu_ps(s+i+8),255.f),
+                                          floatToUnorm4(_mm_loadu_ps(s+i+12),255.f));
+               _mm_storeu_si128((__m128i*)(d+i),_mm_packus_epi16(lo,hi));
+            }
+#endif
+            for(; i<n; i++)
+               d[i]=uint8_t(floor(clamp01(s[i])*255.f+0.5f));
+         }
+         break;
+      }
+   }
+}
+
 
 // AttribType::AttribType() documentation
 // note: brief description is with the constructor declaration
@@ -194,6 +418,17 @@ const AttribType AttribType::DMat4x3{GLType::DMAT4X3,12,8*12,NOT_DEFINED};
  *  rendering GL_TRIANGLE primitives.
  */
 
+// AttribType::encoding() documentation
+// note: brief description is with the method declaration
+/** \fn AttribType::encoding() const
+ *
+ *  Encoded attributes are uploaded from float data and converted
+ *  by encode() in AttribStorage::uploadVertices(). They take half
+ *  or less of the memory of the source data. Half-floats and unorm values
+ *  are converted back to floats by vertex fetch, octahedral normals
+ *  need to be decoded in the vertex shader, see RenderingContext::getProgram().
+ */
+
 // AttribType::getAsInt64() documentation
 // note: brief description is with the method declaration
 /** \fn AttribType::getAsInt64() const
@@ -0,0 +1,153 @@
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <geRG/Culling.h>
+
+using namespace std;
+using namespace ge::rg;
+
+
+
+void HiZBuffer::build(const float *depth,unsigned width,unsigned height)
+{
+   _levels.clear();
+   if(width==0 || height==0)
+      return;
+
+   // level 0
+   _levels.emplace_back();
+   _levels[0].width=width;
+   _levels[0].height=height;
+   _levels[0].depth.assign(depth,depth+size_t(width)*height);
+
+   // reduce until 1x1
+   while(width>1 || height>1) {
+      const Level &src=_levels.back();
+      Level dst;
+      dst.width=(width+1)/2;
+      dst.height=(height+1)/2;
+      dst.depth.resize(size_t(dst.width)*dst.height);
+      for(unsigned y=0; y<dst.height; y++) {
+         unsigned y0=y*2,y1=min(y0+1,height-1);
+         for(unsigned x=0; x<dst.width; x++) {
+            unsigned x0=x*2,x1=min(x0+1,width-1);
+            dst.depth[y*dst.width+x]=max(max(src.depth[y0*width+x0],src.depth[y0*width+x1]),
+                                         max(src.depth[y1*width+x0],src.depth[y1*width+x1]));
+         }
+      }
+      width=dst.width;
+      height=dst.height;
+      _levels.push_back(move(dst));
+   }
+}
+
+
+void HiZBuffer::clear()
+{
+   _levels.clear();
+}
+
+
+float HiZBuffer::maxDepth(float x0,float y0,float x1,float y1) const
+{
+   if(_levels.empty())
+      return 1.f;
+
+   // rectangle in level 0 texels
+   const unsigned w=_levels[0].width;
+   const unsigned h=_levels[0].height;
+   auto toTexel=[](float v,unsigned size) {
+      return min(unsigned(max(v,0.f)*float(size)),size-1);
+   };
+   unsigned px0=toTexel(x0,w),px1=toTexel(x1,w);
+   unsigned py0=toTexel(y0,h),py1=toTexel(y1,h);
+
+   // find level where the rectangle spans at most 2x2 texels
+   unsigned level=0;
+   while(level+1<_levels.size() &&
+         ((px1>>level)-(px0>>level)>1 || (py1>>level)-(py0>>level)>1))
+      level++;
+
+   // max of visited texels
+   const Level &l=_levels[level];
+   float r=0.f;
+   for(unsigned y=py0>>level; y<=(py1>>level); y++)
+      for(unsigned x=px0>>level; x<=(px1>>level); x++)
+         r=max(r,l.depth[y*l.width+x]);
+   return r;
+}
+
+
+Culling::Culling()
+{
+   static const float identity[16]={ 1.f,0.f,0.f,0.f, 0.f,1.f,0.f,0.f, 0.f,0.f,1.f,0.f, 0.f,0.f,0.f,1.f };
+   setProjection(identity);
+}
+
+
+void Culling::setProjection(const float *p)
+{
+   memcpy(_projection,p,sizeof(_projection));
+
+   // extract planes from rows of the matrix (Gribb-Hartmann method)
+   // (the matrix is column-major, so row i is p[i],p[4+i],p[8+i],p[12+i])
+   for(unsigned i=0; i<6; i++) {
+      unsigned row=i/2;
+      float sign=(i%2==0)?1.f:-1.f;
+      float *plane=_frustumPlanes[i];
+      for(unsigned j=0; j<4; j++)
+         plane[j]=p[j*4+3]+sign*p[j*4+row];
+      float l=sqrt(plane[0]*plane[0]+plane[1]*plane[1]+plane[2]*plane[2]);
+      if(l>0.f)
+         for(unsigned j=0; j<4; j++)
+            plane[j]/=l;
+   }
+}
+
+
+bool Culling::isVisible(const float *m,const BoundingSphereGpuData &bounds) const
+{
+   if(bounds.radius<0.f)
+      return true;
+
+   // transform sphere
+   float c[3];
+   for(unsigned i=0; i<3; i++)
+      c[i]=m[i]*bounds.center[0]+m[4+i]*bounds.center[1]+m[8+i]*bounds.center[2]+m[12+i];
+   float scale2=0.f;
+   for(unsigned j=0; j<3; j++)
+      scale2=max(scale2,m[j*4]*m[j*4]+m[j*4+1]*m[j*4+1]+m[j*4+2]*m[j*4+2]);
+   float r=bounds.radius*sqrt(scale2);
+
+   // frustum culling
+   for(unsigned i=0; i<6; i++) {
+      const float *plane=_frustumPlanes[i];
+      if(plane[0]*c[0]+plane[1]*c[1]+plane[2]*c[2]+plane[3]<-r)
+         return false;
+   }
+
+   if(hiZBuffer==nullptr || hiZBuffer->empty())
+      return true;
+
+   // screen-space bounds of the box around the sphere
+   float mn[3]={ 1e30f, 1e30f, 1e30f };
+   float mx[3]={ -1e30f,-1e30f,-1e30f };
+   for(unsigned i=0; i<8; i++) {
+      float corner[3]={ c[0]+((i&1)?r:-r), c[1]+((i&2)?r:-r), c[2]+((i&4)?r:-r) };
+      float clip[4];
+      for(unsigned j=0; j<4; j++)
+         clip[j]=_projection[j]*corner[0]+_projection[4+j]*corner[1]+_projection[8+j]*corner[2]+_projection[12+j];
+      if(clip[3]<=0.f)
+         return true;
+      for(unsigned j=0; j<3; j++) {
+         float ndc=clip[j]/clip[3];
+         mn[j]=min(mn[j],ndc);
+         mx[j]=max(mx[j],ndc);
+      }
+   }
+
+   // occlusion culling
+   return !hiZBuffer->isOccluded(mn[0]*0.5f+0.5f,mn[1]*0.5f+0.5f,
+                                 mx[0]*0.5f+0.5f,mx[1]*0.5f+0.5f,
+                                 mn[2]*0.5f+0.5f);
+}
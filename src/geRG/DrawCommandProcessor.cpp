@@ -0,0 +1,169 @@
+#include <algorithm>
+#include <geRG/DrawCommandProcessor.h>
+#include <geRG/Culling.h>
+#include <geRG/MatrixGpuData.h>
+#include <geCore/ThreadPool.h>
+
+using namespace std;
+using namespace ge::rg;
+
+
+
+unsigned DrawCommandProcessor::instanceCount(const Buffers &b,const unsigned *drawCommand)
+{
+   // matrix control data
+   unsigned matrixControlOffset4=drawCommand[1];
+   unsigned matrixListOffset64=b.matrixListControlBuffer[matrixControlOffset4+0];
+   unsigned numMatrices=b.matrixListControlBuffer[matrixControlOffset4+1];
+
+   // culling (draw command is rendered if any of its instances is visible)
+   if(b.culling) {
+      const BoundingSphereGpuData &bounds=b.boundsBuffer[(drawCommand-b.drawCommandBuffer)/3];
+      unsigned i=0;
+      while(i<numMatrices && !b.culling->isVisible(b.matrixBuffer[matrixListOffset64+i].matrix,bounds))
+         i++;
+      if(i==numMatrices)
+         return 0;
+   }
+   return numMatrices;
+}
+
+
+/** Writes the draw indirect record of a single draw command
+ *  on the given position. Returns the position after the record.
+ */
+static inline unsigned writeRecord(const DrawCommandProcessor::Buffers &b,const unsigned *drawCommand,
+                                   unsigned primitiveOffset4,unsigned instanceCount,
+                                   unsigned indirectBufferOffset4)
+{
+   unsigned matrixListOffset64=b.matrixListControlBuffer[drawCommand[1]+0];
+   unsigned baseInstance=b.matrixOffset64+matrixListOffset64;
+
+   // per-draw-command data: base instance addresses the draw command
+   // and matrix offset is fetched by the shader from instance offset buffer
+   if(b.instanceOffsetBuffer) {
+      unsigned drawCommandIndex=unsigned(drawCommand-b.drawCommandBuffer)/3;
+      b.instanceOffsetBuffer[drawCommandIndex]=baseInstance;
+      baseInstance=drawCommandIndex;
+   }
+
+   // write indirect buffer data
+   unsigned countAndIndexedFlag=b.primitiveBuffer[primitiveOffset4+0];
+   unsigned first=b.primitiveBuffer[primitiveOffset4+1]; // firstIndex or firstVertex
+   unsigned vertexOffset=b.primitiveBuffer[primitiveOffset4+2]; // vertexOffset
+   unsigned *p=&b.drawIndirectBuffer[indirectBufferOffset4];
+   p[0]=countAndIndexedFlag&0x7fffffff; // indexCount or vertexCount
+   p[1]=instanceCount; // instanceCount
+   if(countAndIndexedFlag>=0x80000000) {
+      p[2]=first; // firstIndex
+      p[3]=vertexOffset; // vertexOffset
+      p[4]=baseInstance; // base instance
+      return indirectBufferOffset4+5;
+   } else {
+      p[2]=first+vertexOffset; // firstVertex
+      p[3]=baseInstance; // base instance
+      return indirectBufferOffset4+4;
+   }
+}
+
+
+/** Processes the range of draw commands in a single thread.
+ *  The StateSetGpuData positions (and counts in the case of compaction)
+ *  are advanced the same way as by atomicAdd() of the compute shader.
+ */
+void DrawCommandProcessor::processRange(const Buffers &b,unsigned firstDrawCommand,unsigned numDrawCommands)
+{
+   const unsigned *drawCommand=&b.drawCommandBuffer[firstDrawCommand*3];
+   const unsigned *end=drawCommand+numDrawCommands*3;
+   for(; drawCommand!=end; drawCommand+=3) {
+      unsigned primitiveOffset4=drawCommand[0];
+      if(primitiveOffset4==0) continue; // skip empty record
+      unsigned instances=instanceCount(b,drawCommand);
+      if(b.countBuffer) {
+         if(instances==0) continue; // compaction: culled draw commands are not written
+         b.countBuffer[drawCommand[2]]++;
+      }
+      unsigned &stateSetPosition=b.stateSetBuffer[drawCommand[2]];
+      stateSetPosition=writeRecord(b,drawCommand,primitiveOffset4,instances,stateSetPosition);
+   }
+}
+
+
+/** Processes numDrawCommands draw commands starting by the first one.
+ *  If threadPool is given and there are enough draw commands,
+ *  the work is split among threads. The result does not depend
+ *  on the number of threads.
+ */
+void DrawCommandProcessor::process(const Buffers &b,unsigned numDrawCommands,
+                                   ge::core::ThreadPool *threadPool)
+{
+   // number of chunks
+   unsigned numChunks=1;
+   if(threadPool && minDrawCommandsPerChunk>0)
+      numChunks=min(threadPool->numThreads()*4,numDrawCommands/minDrawCommandsPerChunk);
+
+   // single-threaded processing
+   if(numChunks<=1) {
+      processRange(b,0,numDrawCommands);
+      return;
+   }
+
+   unsigned chunkSize=(numDrawCommands+numChunks-1)/numChunks;
+   const unsigned numStateSetItems=b.numStateSetItems;
+   const bool compaction=b.countBuffer!=nullptr;
+   _chunkPositions.assign(size_t(numChunks)*numStateSetItems,0);
+   if(compaction) {
+      // instance counts are needed to know which records will be written
+      _chunkCounts.assign(size_t(numChunks)*numStateSetItems,0);
+      _instanceCounts.resize(numDrawCommands);
+   }
+
+   // sum record sizes of each chunk per StateSet
+   threadPool->parallelFor(numChunks,[this,&b,chunkSize,numDrawCommands,numStateSetItems,compaction](unsigned chunk) {
+      unsigned *sizes=&_chunkPositions[size_t(chunk)*numStateSetItems];
+      unsigned *counts=compaction ? &_chunkCounts[size_t(chunk)*numStateSetItems] : nullptr;
+      unsigned first=min(chunk*chunkSize,numDrawCommands);
+      unsigned last=min(first+chunkSize,numDrawCommands);
+      for(unsigned i=first; i<last; i++) {
+         const unsigned *drawCommand=&b.drawCommandBuffer[i*3];
+         unsigned primitiveOffset4=drawCommand[0];
+         if(primitiveOffset4==0) continue; // skip empty record
+         if(compaction) {
+            unsigned instances=_instanceCounts[i]=instanceCount(b,drawCommand);
+            if(instances==0) continue;
+            counts[drawCommand[2]]++;
+         }
+         sizes[drawCommand[2]]+=recordSize(b.primitiveBuffer[primitiveOffset4]);
+      }
+   });
+
+   // convert sizes to positions (exclusive prefix sum over chunks for each StateSet)
+   for(unsigned s=0; s<numStateSetItems; s++) {
+      unsigned position=b.stateSetBuffer[s];
+      for(unsigned chunk=0; chunk<numChunks; chunk++) {
+         unsigned &v=_chunkPositions[size_t(chunk)*numStateSetItems+s];
+         unsigned size=v;
+         v=position;
+         position+=size;
+         if(compaction)
+            b.countBuffer[s]+=_chunkCounts[size_t(chunk)*numStateSetItems+s];
+      }
+      b.stateSetBuffer[s]=position;
+   }
+
+   // write records
+   threadPool->parallelFor(numChunks,[this,&b,chunkSize,numDrawCommands,numStateSetItems,compaction](unsigned chunk) {
+      unsigned *positions=&_chunkPositions[size_t(chunk)*numStateSetItems];
+      unsigned first=min(chunk*chunkSize,numDrawCommands);
+      unsigned last=min(first+chunkSize,numDrawCommands);
+      for(unsigned i=first; i<last; i++) {
+         const unsigned *drawCommand=&b.drawCommandBuffer[i*3];
+         unsigned primitiveOffset4=drawCommand[0];
+         if(primitiveOffset4==0) continue; // skip empty record
+         unsigned instances=compaction ? _instanceCounts[i] : instanceCount(b,drawCommand);
+         if(compaction && instances==0) continue;
+         unsigned &position=positions[drawCommand[2]];
+         position=writeRecord(b,drawCommand,primitiveOffset4,instances,position);
+      }
+   });
+}
@@ -0,0 +1,119 @@
+#include <cassert>
+#include <cstring>
+#include <geRG/FlattenedTransformationGraph.h>
+#include <geRG/Transformation.h>
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP>=1)
+# define GE_RG_USE_SSE
+# include <xmmintrin.h>
+#endif
+
+using namespace std;
+using namespace ge::rg;
+
+const unsigned FlattenedTransformationGraph::noParent;
+
+
+
+void FlattenedTransformationGraph::compile(const vector<shared_ptr<Transformation>>& roots)
+{
+   clear();
+
+   // breadth-first traversal,
+   // queue is formed by the nodes that were not expanded yet
+   vector<Transformation*> queue;
+   for(auto it=roots.begin(); it!=roots.end(); it++) {
+      Transformation *t=it->get();
+      addNode(noParent,t->gpuDataOffset64(),t->matrixList()?t->matrixOffset64():0);
+      queue.push_back(t);
+   }
+   for(unsigned i=0; i<queue.size(); i++) {
+      Transformation *t=queue[i];
+      for(auto it=t->childList().begin(); it!=t->childList().end(); it++) {
+         Transformation *c=it->get();
+         addNode(i,c->gpuDataOffset64(),c->matrixList()?c->matrixOffset64():0);
+         queue.push_back(c);
+      }
+   }
+}
+
+
+unsigned FlattenedTransformationGraph::addNode(unsigned parentIndex,unsigned localMatrixOffset64,
+                                               unsigned outputOffset64)
+{
+   assert((parentIndex==noParent || parentIndex<numNodes()) &&
+          "FlattenedTransformationGraph::addNode(): Parent must be added before its children.");
+   unsigned index=numNodes();
+   _parentIndices.push_back(parentIndex);
+   _localMatrixOffsets64.push_back(localMatrixOffset64);
+   _outputOffsets64.push_back(outputOffset64);
+   return index;
+}
+
+
+void FlattenedTransformationGraph::clear()
+{
+   _parentIndices.clear();
+   _localMatrixOffsets64.clear();
+   _outputOffsets64.clear();
+   _worldMatrices.clear();
+}
+
+
+/** Computes world matrices of all the nodes and writes them to the outputBuffer.
+ *
+ *  @param localMatrices Array of local matrices indexed by node local matrix offsets,
+ *                       usually RenderingContext::cpuTransformationBuffer().
+ *  @param outputBuffer  Buffer receiving world matrices of the nodes with non-zero output offset,
+ *                       usually mapped RenderingContext::matrixStorage().
+ */
+void FlattenedTransformationGraph::evaluate(const float *localMatrices,MatrixGpuData *outputBuffer)
+{
+   const unsigned n=numNodes();
+   _worldMatrices.resize(n);
+   const unsigned *parentIndices=_parentIndices.data();
+   const unsigned *localMatrixOffsets64=_localMatrixOffsets64.data();
+   const unsigned *outputOffsets64=_outputOffsets64.data();
+   MatrixGpuData *worldMatrices=_worldMatrices.data();
+
+   for(unsigned i=0; i<n; i++) {
+      const float *local=&localMatrices[localMatrixOffsets64[i]*16];
+      float *world=worldMatrices[i].matrix;
+      unsigned p=parentIndices[i];
+      if(p==noParent)
+         memcpy(world,local,sizeof(float)*16);
+      else
+         multiplyMatrices(worldMatrices[p].matrix,local,world);
+      unsigned o=outputOffsets64[i];
+      if(o!=0)
+         memcpy(outputBuffer[o].matrix,world,sizeof(float)*16);
+   }
+}
+
+
+void FlattenedTransformationGraph::multiplyMatrices(const float *a,const float *b,float *result)
+{
+#if defined(GE_RG_USE_SSE)
+
+   // each column of the result is linear combination of columns of a
+   __m128 a0=_mm_loadu_ps(a);
+   __m128 a1=_mm_loadu_ps(a+4);
+   __m128 a2=_mm_loadu_ps(a+8);
+   __m128 a3=_mm_loadu_ps(a+12);
+   for(unsigned j=0; j<4; j++) {
+      const float *bc=b+j*4;
+      __m128 r=_mm_mul_ps(a0,_mm_set1_ps(bc[0]));
+      r=_mm_add_ps(r,_mm_mul_ps(a1,_mm_set1_ps(bc[1])));
+      r=_mm_add_ps(r,_mm_mul_ps(a2,_mm_set1_ps(bc[2])));
+      r=_mm_add_ps(r,_mm_mul_ps(a3,_mm_set1_ps(bc[3])));
+      _mm_storeu_ps(result+j*4,r);
+   }
+
+#else
+
+   for(unsigned j=0; j<4; j++)
+      for(unsigned i=0; i<4; i++)
+         result[j*4+i]=a[i]*b[j*4]+a[4+i]*b[j*4+1]+a[8+i]*b[j*4+2]+a[12+i]*b[j*4+3];
+
+#endif
+}
@@ -0,0 +1,108 @@
+#include <algorithm>
+#include <geRG/MaterialTable.h>
+#include <geGL/Buffer.h>
+#include <geGL/Texture.h>
+
+using namespace std;
+using namespace ge::rg;
+using namespace ge::gl;
+
+
+
+MaterialTable::MaterialTable()
+{
+}
+
+
+/** Makes the bindless texture handles non-resident.
+ */
+MaterialTable::~MaterialTable()
+{
+   clear();
+}
+
+
+/** Appends material without a texture and returns its index.
+ */
+unsigned MaterialTable::addMaterial(TexturingMode mode)
+{
+   _materials.push_back(MaterialGpuData{{0,0},0,mode});
+   _dirty=true;
+   return unsigned(_materials.size()-1);
+}
+
+
+/** Appends material referring to the texture by bindless handle and returns its index.
+ *
+ *  The handle is made resident, so the texture must not be modified
+ *  (its storage nor sampling parameters) afterwards. Requires ARB_bindless_texture.
+ */
+unsigned MaterialTable::addTexture(const shared_ptr<Texture>& texture,TexturingMode mode)
+{
+   if(!texture)
+      return addMaterial(NO_TEXTURING);
+   auto& gl=texture->getContext();
+   GLuint64 handle=gl.glGetTextureHandleARB(texture->getId());
+   if(!gl.glIsTextureHandleResidentARB(handle))
+      gl.glMakeTextureHandleResidentARB(handle);
+   _textures.push_back(texture);
+   _materials.push_back(MaterialGpuData{{uint32_t(handle),uint32_t(handle>>32)},0,mode});
+   _dirty=true;
+   return unsigned(_materials.size()-1);
+}
+
+
+/** Appends material referring to the layer of textureArray() and returns its index.
+ */
+unsigned MaterialTable::addArrayLayer(unsigned layer,TexturingMode mode)
+{
+   _materials.push_back(MaterialGpuData{{0,0},layer,mode});
+   _dirty=true;
+   return unsigned(_materials.size()-1);
+}
+
+
+/** Replaces the material data. Bindless handles given here are not made resident
+ *  by MaterialTable, it is the responsibility of the caller.
+ */
+void MaterialTable::setMaterial(unsigned index,const MaterialGpuData& data)
+{
+   _materials[index]=data;
+   _dirty=true;
+}
+
+
+/** Removes all the materials and makes handles of their textures non-resident.
+ */
+void MaterialTable::clear()
+{
+   for(auto& t : _textures) {
+      auto& gl=t->getContext();
+      GLuint64 handle=gl.glGetTextureHandleARB(t->getId());
+      if(gl.glIsTextureHandleResidentARB(handle))
+         gl.glMakeTextureHandleNonResidentARB(handle);
+   }
+   _textures.clear();
+   _materials.clear();
+   _dirty=true;
+}
+
+
+/** Uploads the table if it was changed and binds it to the shader storage buffer binding point.
+ *  The texture array (if any) is bound to the texture unit.
+ */
+void MaterialTable::bind(unsigned storageBinding,unsigned textureUnit)
+{
+   if(_dirty) {
+      // at least one item, empty buffers can not be bound
+      GLsizeiptr size=GLsizeiptr(max(_materials.size(),size_t(1))*sizeof(MaterialGpuData));
+      if(!_buffer || _buffer->getSize()<size)
+         _buffer=make_shared<Buffer>(size,nullptr,GL_DYNAMIC_DRAW);
+      if(!_materials.empty())
+         _buffer->setData(_materials.data(),GLsizeiptr(_materials.size()*sizeof(MaterialGpuData)));
+      _dirty=false;
+   }
+   _buffer->bindBase(GL_SHADER_STORAGE_BUFFER,storageBinding);
+   if(_textureArray)
+      _textureArray->bind(textureUnit);
+}
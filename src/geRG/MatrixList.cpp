@@ -55,6 +55,7 @@ MatrixList::MatrixList()
    , _numMatrices(0)
    , _restartFlag(true)
    , _startIndex(0)
+   , _taskIndex(0)
    //, _arrayId(0)
    //, _capacity(0)
 {
@@ -71,6 +72,7 @@ MatrixList::MatrixList(unsigned listControlId,unsigned startIndex,unsigned numMa
    , _restartFlag(true)
    //, _arrayId(matrixArrayId)
    , _startIndex(startIndex)
+   , _taskIndex(0)
 {
    //RenderingContext *rc=RenderingContext::current().get();
    //auto &a=rc->matrixStorage()->operator[](_arrayId);
@@ -0,0 +1,175 @@
+#include <algorithm>
+#include <map>
+#include <geRG/RenderProgram.h>
+#include <geRG/AttribStorage.h>
+#include <geRG/FlexibleUniform.h>
+
+using namespace std;
+using namespace ge::rg;
+
+
+
+/** Compiles the tree given by root StateSet.
+ *
+ *  The operations reproduce root->render() with the commands of the tree
+ *  at the time of the call. The version is stored for the comparison
+ *  with RenderingContext::stateSetTopologyVersion() and it is returned by version().
+ */
+void RenderProgram::compile(StateSet *root,unsigned version)
+{
+   _ops.clear();
+   if(root)
+      compileStateSet(_ops,root);
+   removeRedundantOps(_ops);
+   _version=version;
+}
+
+
+/** Appends operations of StateSet::render() of the stateSet.
+ */
+void RenderProgram::compileStateSet(vector<Op>& ops,StateSet *stateSet) const
+{
+   // empty command list means default render command
+   const StateSet::CommandList& commandList=stateSet->commandList();
+   if(commandList.empty()) {
+      compileRenderCommand(ops,stateSet);
+      return;
+   }
+
+   // tag known commands, expand render commands inline
+   for(auto& c : commandList)
+   {
+      ge::core::Command *command=c.get();
+      if(auto renderCommand=dynamic_cast<StateSet::RenderCommand*>(command)) {
+         if(renderCommand->stateSet())
+            compileRenderCommand(ops,renderCommand->stateSet());
+         continue;
+      }
+      Op op;
+      if(auto useProgram=dynamic_cast<FlexibleUseProgram*>(command)) {
+         op.type=OpType::USE_PROGRAM;
+         op.useProgram=useProgram;
+      } else {
+         op.type=OpType::COMMAND;
+         op.command=command;
+      }
+      ops.push_back(op);
+   }
+}
+
+
+/** Appends operations of StateSet::RenderCommand::execute() of the stateSet.
+ */
+void RenderProgram::compileRenderCommand(vector<Op>& ops,StateSet *stateSet) const
+{
+   // attached geometry
+   // (AttribStorageData are ordered by AttribStorage already as they are kept in std::map)
+   for(auto& i : stateSet->attribStorageDataMap())
+   {
+      if(i.second.numDrawCommands==0)
+         continue;
+      Op op;
+      op.type=OpType::BIND_ATTRIB_STORAGE;
+      op.attribStorage=i.second.attribStorage;
+      ops.push_back(op);
+      op.type=OpType::DRAW;
+      op.storageData=&i.second;
+      ops.push_back(op);
+   }
+
+   // child StateSets in original order
+   if(!_sortingEnabled) {
+      for(auto& child : stateSet->childList())
+         compileStateSet(ops,child.get());
+      return;
+   }
+
+   // child StateSets grouped by the first AttribStorage they bind;
+   // key is the index of the first child binding the same AttribStorage
+   // (children binding no AttribStorage keep their own index),
+   // so the result is deterministic and the original order is kept among the groups
+   struct Chunk {
+      size_t key;
+      size_t begin,end;
+   };
+   vector<Op> childOps;
+   vector<Chunk> chunks;
+   map<AttribStorage*,size_t> groupKeys;
+   chunks.reserve(stateSet->childList().size());
+   for(auto& child : stateSet->childList())
+   {
+      size_t begin=childOps.size();
+      compileStateSet(childOps,child.get());
+      AttribStorage *firstStorage=nullptr;
+      for(size_t j=begin,e=childOps.size(); j<e; j++)
+         if(childOps[j].type==OpType::BIND_ATTRIB_STORAGE) {
+            firstStorage=childOps[j].attribStorage;
+            break;
+         }
+      size_t key=chunks.size();
+      if(firstStorage)
+         key=groupKeys.emplace(firstStorage,key).first->second;
+      chunks.push_back({key,begin,childOps.size()});
+   }
+   stable_sort(chunks.begin(),chunks.end(),
+               [](const Chunk& a,const Chunk& b) { return a.key<b.key; });
+   for(auto& chunk : chunks)
+      ops.insert(ops.end(),childOps.begin()+chunk.begin,childOps.begin()+chunk.end);
+}
+
+
+/** Removes binds of AttribStorage that is already bound
+ *  and repeated FlexibleUseProgram commands.
+ *
+ *  Generic commands are expected to not change VAO binding nor the active program
+ *  (see class description), so the binds are not repeated after them.
+ */
+void RenderProgram::removeRedundantOps(vector<Op>& ops)
+{
+   AttribStorage *boundStorage=nullptr;
+   FlexibleUseProgram *activeProgram=nullptr;
+   auto dst=ops.begin();
+   for(auto it=ops.begin(),e=ops.end(); it!=e; it++)
+   {
+      if(it->type==OpType::BIND_ATTRIB_STORAGE) {
+         if(it->attribStorage==boundStorage)
+            continue;
+         boundStorage=it->attribStorage;
+      }
+      else if(it->type==OpType::USE_PROGRAM) {
+         if(it->useProgram==activeProgram)
+            continue;
+         activeProgram=it->useProgram;
+      }
+      *dst++=*it;
+   }
+   ops.erase(dst,ops.end());
+}
+
+
+/** Executes the compiled operations.
+ *
+ *  Draw counts and indirect buffer offsets are read from StateSets during the execution,
+ *  so the program stays valid as long as the topology of the tree does not change.
+ */
+void RenderProgram::execute() const
+{
+   for(const Op& op : _ops)
+   {
+      switch(op.type) {
+      case OpType::COMMAND:
+         op.command->operator()();
+         break;
+      case OpType::USE_PROGRAM:
+         op.useProgram->operator()();
+         break;
+      case OpType::BIND_ATTRIB_STORAGE:
+         op.attribStorage->bind();
+         break;
+      case OpType::DRAW:
+         if(op.storageData->numDrawCommands!=0)
+            op.storageData->attribStorage->draw(op.storageData->renderingData);
+         break;
+      }
+   }
+}
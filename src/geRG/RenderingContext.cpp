@@ -5,12 +5,19 @@
 #include <geRG/RenderingContext.h>
 #include <geRG/AttribStorage.h>
 #include <geRG/MatrixList.h>
+#include <geRG/MaterialTable.h>
 #include <geRG/Mesh.h>
+#include <geRG/SceneRecorder.h>
 #include <geRG/StateSet.h>
 #include <geRG/StateSetManager.h>
 #include <geRG/Transformation.h>
 #include <geGL/Buffer.h>
+#include <geGL/FrameProfiler.h>
 #include <geGL/Program.h>
+#include <geGL/ProgramBinaryCache.h>
+#include <geGL/Texture.h>
+#include <geGL/UploadBatcher.h>
+#include <geCore/ThreadPool.h>
 
 using namespace std;
 using namespace ge::rg;
@@ -178,6 +185,9 @@ RenderingContext::~RenderingContext()
    //_instancingMatrixCollectionAllocationManager.assertEmpty();
    //_instancingMatrixAllocationManager.assertEmpty();
 
+   // release fences of persistent ring
+   waitForFrameFences();
+
    // delete buffers
    //delete _transformationBuffer;
    delete[] _cpuTransformationBuffer;
@@ -311,8 +321,8 @@ bool RenderingContext::allocVertexData(Mesh& mesh,const AttribConfig& attribConf
    auto storageIt=attribStorageList.end();
    for(auto it=attribStorageList.begin(); it!=attribStorageList.end(); it++)
    {
-      if((*it)->vertexAllocationManager().numItemsAvailableAtTheEnd()>=numVertices &&
-         (*it)->indexAllocationManager().numItemsAvailableAtTheEnd()>=numIndices)
+      if((*it)->vertexAllocationManager().canAllocate(numVertices) &&
+         (*it)->indexAllocationManager().canAllocate(numIndices))
       {
          storageIt=it;
          break;
@@ -421,7 +431,8 @@ void RenderingContext::freePrimitives(Mesh &mesh)
 
 /** Uploads raw primitive data to GPU buffers.
  *  Note that buffer must contain correct values
- *  in PrimitiveGpuData::vertexOffset.
+ *  in PrimitiveGpuData::vertexOffset and absolute first index
+ *  of indexed primitives (see updateVertexOffsets()).
  *  The method maps gpu-buffers to cpu address space.
  *  Call RenderingContext::unmapBuffers() when all buffer updates are completed.
  */
@@ -466,12 +477,11 @@ void RenderingContext::setPrimitives(Mesh &mesh,const Primitive *primitiveList,
  *  as PrimitiveGpuData unsigned integers followed
  * by arbitrary user data.
  *
- * Before uploading all draw commands to GPU,
- * the buffer have to be preprocessed to update
- * startIndex of each draw command. As a performance optimization,
- * the preprocessing is performed directly in nonConstDrawCommandBuffer,
- * thus if you do not want the data to be modified,
- * create temporary copy and pass it to the method instead.
+ * PrimitiveGpuData::first of indexed primitives is relative to the indices
+ * of the mesh (index 0 is the first index uploaded by Mesh::uploadIndices()).
+ * The uploaded copy is updated by the start of the index allocation
+ * and by PrimitiveGpuData::vertexOffset (see updateVertexOffsets()),
+ * nonConstBufferData itself is not modified.
  *
  * DrawCommandControlData carries the offset of each
  * draw command inside draw command buffer and mode of each draw command.
@@ -481,28 +491,68 @@ void RenderingContext::setPrimitives(Mesh &mesh,const Primitive *primitiveList,
 void RenderingContext::setAndUploadPrimitives(Mesh& mesh,PrimitiveGpuData* nonConstBufferData,const Primitive* primitiveList,unsigned numPrimitives)
 {
    clearPrimitives(mesh);
-   updateVertexOffsets(mesh,nonConstBufferData,primitiveList,numPrimitives);
    uploadPrimitives(mesh,nonConstBufferData,numPrimitives);
    setPrimitives(mesh,primitiveList,numPrimitives);
+
+   // make first index absolute and set vertex offset in the uploaded copy
+   if(mesh.attribStorage()==nullptr)
+      return;
+   unsigned indexOffset=mesh.indicesDataId()==0 ? 0 :
+         mesh.attribStorage()->indexArrayAllocation(mesh.indicesDataId()).startIndex;
+   updateVertexOffsets(mesh,int(indexOffset));
 }
 
 
+/** Updates primitives of the mesh to point into the allocated blocks of AttribStorage.
+ *
+ *  PrimitiveGpuData::vertexOffset of all primitives is set to the start
+ *  of the vertex allocation of the mesh. It is used as base vertex by indexed primitives.
+ *  PrimitiveGpuData::first of indexed primitives is expected to be relative
+ *  to the index allocation of the mesh and the start of the allocation is added to it,
+ *  so the method has to be called only once on each buffer data.
+ */
 void RenderingContext::updateVertexOffsets(Mesh &mesh,void *primitiveBuffer,
                                            const Primitive *primitiveList,unsigned numPrimitives)
 {
-   // get index of allocated block
-   unsigned vertexOffset;
-   if(mesh.indicesDataId()==0)
-      vertexOffset=mesh.attribStorage()->vertexArrayAllocation(mesh.verticesDataId()).startIndex;
-   else
-      vertexOffset=mesh.attribStorage()->indexArrayAllocation(mesh.indicesDataId()).startIndex;
+   // get starts of allocated blocks
+   unsigned vertexOffset=mesh.attribStorage()->vertexArrayAllocation(mesh.verticesDataId()).startIndex;
+   unsigned indexOffset=mesh.indicesDataId()==0 ? 0 :
+         mesh.attribStorage()->indexArrayAllocation(mesh.indicesDataId()).startIndex;
 
-   // update vertexOffset of all primitive sets
+   // update all primitive sets
    for(unsigned i=0; i<numPrimitives; i++)
    {
-      // set PrimitiveSetGpuData::vertexOffset
-      unsigned index=primitiveList[i].offset4();
-      static_cast<unsigned*>(primitiveBuffer)[index+2]=vertexOffset;
+      unsigned *p=static_cast<unsigned*>(primitiveBuffer)+primitiveList[i].offset4();
+      if(p[0]>=0x80000000) // indexed primitive
+         p[1]+=indexOffset; // PrimitiveGpuData::first
+      p[2]=vertexOffset; // PrimitiveGpuData::vertexOffset
+   }
+}
+
+
+/** Updates primitives of the mesh directly in the primitive storage.
+ *  It is used when vertex or index data of the mesh were moved inside AttribStorage.
+ *
+ *  PrimitiveGpuData::vertexOffset is set to the current start of the vertex allocation
+ *  and firstIndexShift (the distance the index allocation moved by)
+ *  is added to PrimitiveGpuData::first of indexed primitives.
+ *  The method maps primitive storage to cpu address space.
+ *  Call RenderingContext::unmapBuffers() when all buffer updates are completed.
+ */
+void RenderingContext::updateVertexOffsets(Mesh &mesh,int firstIndexShift)
+{
+   if(mesh.attribStorage()==nullptr || mesh.primitivesDataId()==0)
+      return;
+
+   unsigned vertexOffset=mesh.attribStorage()->vertexArrayAllocation(mesh.verticesDataId()).startIndex;
+   PrimitiveGpuData *ptr=_primitiveStorage.map(BufferStorageAccess::READ_WRITE);
+   unsigned *buffer=reinterpret_cast<unsigned*>(ptr+_primitiveStorage[mesh.primitivesDataId()].startIndex);
+   for(auto& primitive : mesh.primitiveList())
+   {
+      unsigned *p=buffer+primitive.offset4();
+      if(p[0]>=0x80000000) // indexed primitive
+         p[1]+=unsigned(firstIndexShift);
+      p[2]=vertexOffset;
    }
 }
 
@@ -552,6 +602,20 @@ DrawableId RenderingContext::createDrawable(
    // allocate draw commands
    _drawCommandStorage.alloc(numDrawCommands,drawable->items());
 
+   // reset bounds of draw commands (they might be left by deleted Drawable)
+   if(_drawCommandBounds.size()<_drawCommandStorage.capacity())
+      _drawCommandBounds.resize(_drawCommandStorage.capacity(),BoundingSphereGpuData{{0.f,0.f,0.f},-1.f});
+   for(unsigned i=0; i<numDrawCommands; i++)
+      _drawCommandBounds[drawable->item(i).index()].radius=-1.f;
+   _drawCommandBoundsDirty=true;
+
+   // reset materials of draw commands
+   if(_drawCommandMaterials.size()<_drawCommandStorage.capacity())
+      _drawCommandMaterials.resize(_drawCommandStorage.capacity(),0);
+   for(unsigned i=0; i<numDrawCommands; i++)
+      _drawCommandMaterials[drawable->item(i).index()]=0;
+   _drawCommandMaterialsDirty=true;
+
    // iterate through instances
    auto storageDataIterator=stateSet->getOrCreateAttribStorageData(mesh.attribStorage());
    StateSet::AttribStorageData &storageData=storageDataIterator->second;
@@ -612,9 +676,117 @@ void RenderingContext::deleteDrawable(Mesh &mesh,DrawableId id)
 }
 
 
+/** Queues the recorder for commitSceneRecorders().
+ *
+ *  Unlike the other methods that build the scene, it may be called from any thread,
+ *  so worker threads can record meshes and Drawables by SceneRecorder
+ *  and hand them over to the rendering thread. The recorder must not be modified
+ *  after the submission until it is committed.
+ */
+void RenderingContext::submitSceneRecorder(const shared_ptr<SceneRecorder>& recorder)
+{
+   if(!recorder || recorder->empty())
+      return;
+   lock_guard<mutex> lock(_sceneRecorderMutex);
+   _submittedSceneRecorders.push_back(recorder);
+}
+
+
+/** Commits the submitted SceneRecorders in the order of their submission.
+ *
+ *  It is called by frame() before the evaluation of transformation graph, so the scene
+ *  recorded by worker threads is merged in a single batch per frame. The lock is held
+ *  only while the queue is taken over, so submissions do not wait for the commit.
+ *  If sceneRecorderCommitBudget() is set, only the recorders that fit into the budget
+ *  are committed (but at least one) and the remaining ones are kept for the next frame.
+ */
+void RenderingContext::commitSceneRecorders()
+{
+   vector<shared_ptr<SceneRecorder>> recorders;
+   {
+      lock_guard<mutex> lock(_sceneRecorderMutex);
+      if(_submittedSceneRecorders.empty())
+         return;
+      recorders.swap(_submittedSceneRecorders);
+   }
+
+   // commit recorders that fit into the budget
+   // (at least one per frame, so large recorders are not postponed forever)
+   size_t numCommitted=0;
+   size_t numBytes=0;
+   for(size_t c=recorders.size(); numCommitted<c; numCommitted++) {
+      size_t size=recorders[numCommitted]->arenaSize();
+      if(_sceneRecorderCommitBudget!=0 && numCommitted!=0 && numBytes+size>_sceneRecorderCommitBudget)
+         break;
+      numBytes+=size;
+      recorders[numCommitted]->commit(this);
+   }
+
+   // return the remaining recorders to the front of the queue
+   if(numCommitted<recorders.size()) {
+      lock_guard<mutex> lock(_sceneRecorderMutex);
+      _submittedSceneRecorders.insert(_submittedSceneRecorders.begin(),
+                                      recorders.begin()+numCommitted,recorders.end());
+   }
+}
+
+
+void RenderingContext::setDrawableBounds(DrawableId id,const glm::vec3& center,float radius)
+{
+   for(unsigned i=0,c=id->numItems; i<c; i++) {
+      BoundingSphereGpuData &b=_drawCommandBounds[id->item(i).index()];
+      b.center[0]=center[0];
+      b.center[1]=center[1];
+      b.center[2]=center[2];
+      b.radius=radius;
+   }
+   _drawCommandBoundsDirty=true;
+}
+
+
+void RenderingContext::setDrawableMaterial(DrawableId id,unsigned material)
+{
+   for(unsigned i=0,c=id->numItems; i<c; i++)
+      _drawCommandMaterials[id->item(i).index()]=material;
+   _drawCommandMaterialsDirty=true;
+}
+
+
+/** Sets material table used by the built-in programs.
+ *
+ *  When the table is set, processDrawCommands() writes draw command indices
+ *  as base instances of draw indirect records and matrix offsets into a separate buffer
+ *  (see DrawCommandProcessor::Buffers::instanceOffsetBuffer). The programs
+ *  fetch the matrix offset and the material index of the draw command
+ *  by gl_BaseInstanceARB, so ARB_shader_draw_parameters rendering is required.
+ *
+ *  Enabling or disabling the table changes the built-in programs,
+ *  thus it can be done only until the first program is created.
+ *  Replacing one table by another is possible at any time.
+ */
+void RenderingContext::setMaterialTable(const shared_ptr<MaterialTable>& table)
+{
+   if((table!=nullptr)!=(_materialTable!=nullptr)) {
+      if(table && !_useARBShaderDrawParameters) {
+         cerr<<"RenderingContext::setMaterialTable(): Material table requires\n"
+               "   ARB_shader_draw_parameters rendering (see setUseARBShaderDrawParameters())."<<endl;
+         return;
+      }
+      if(_programCache.size()!=0 || _ambientProgram || _ambientUniformColorProgram ||
+         _phongProgram || _phongUniformColorProgram) {
+         cerr<<"RenderingContext::setMaterialTable(): The material table can be enabled or disabled\n"
+               "   only until the first ge::gl::Program is created by RenderingContext::getProgram()."<<endl;
+         return;
+      }
+   }
+   _materialTable=table;
+}
+
+
 void RenderingContext::addTransformationGraph(shared_ptr<Transformation>& transformation)
 {
    _transformationGraphs.emplace_back(transformation);
+   invalidateTransformationGraph();
 }
 
 
@@ -623,6 +795,7 @@ void RenderingContext::removeTransformationGraph(shared_ptr<Transformation>& tra
    auto it=std::find(_transformationGraphs.begin(),_transformationGraphs.end(),transformation);
    if(it!=_transformationGraphs.end())
       _transformationGraphs.erase(it);
+   invalidateTransformationGraph();
 }
 
 
@@ -683,6 +856,29 @@ void RenderingContext::handleContextLost()
 }
 
 
+/** Compacts vertex and index data of all AttribStorages.
+ *
+ *  Free blocks left in AttribStorages by released meshes are filled
+ *  by moving the following data (see AttribStorage::compact()).
+ *  At most maxBytes are copied in a single call, so the method
+ *  can be called each frame. The method is called by frame()
+ *  when vertexDataCompactionBudget() is not zero.
+ *
+ *  Returns the number of copied bytes.
+ */
+unsigned RenderingContext::compactVertexData(unsigned maxBytes)
+{
+   unsigned numBytes=0;
+   for(auto acIt=_attribConfigInstances.begin(); acIt!=_attribConfigInstances.end() && numBytes<maxBytes; acIt++)
+   {
+      auto& list=acIt->second->attribStorageList;
+      for(auto asIt=list.begin(); asIt!=list.end() && numBytes<maxBytes; asIt++)
+         numBytes+=(*asIt)->compact(maxBytes-numBytes);
+   }
+   return numBytes;
+}
+
+
 const shared_ptr<Program>& RenderingContext::getProcessDrawCommandsProgram() const
 {
    if(!_processDrawCommandsProgram)
@@ -707,8 +903,69 @@ const shared_ptr<Program>& RenderingContext::getProcessDrawCommandsProgram() con
             "layout(std430,binding=4) restrict buffer StateSetBuffer {\n"
             "   uint stateSetBuffer[];\n"
             "};\n"
+            "layout(std430,binding=5) restrict readonly buffer MatrixBuffer {\n"
+            "   mat4 matrixBuffer[];\n"
+            "};\n"
+            "layout(std430,binding=6) restrict readonly buffer BoundsBuffer {\n"
+            "   vec4 boundsBuffer[];\n" // xyz - center, w - radius
+            "};\n"
+            "layout(std430,binding=7) restrict buffer CountBuffer {\n"
+            "   uint countBuffer[];\n"
+            "};\n"
+            "layout(std430,binding=8) restrict writeonly buffer InstanceOffsetBuffer {\n"
+            "   uint instanceOffsetBuffer[];\n"
+            "};\n"
             "\n"
             "uniform uint numToProcess;\n"
+            "uniform uint matrixOffset64; // offset of MatrixBuffer segment in the whole matrix buffer, added to base instance\n"
+            "uniform bool cullingEnabled;\n"
+            "uniform bool compactionEnabled; // skip culled draw commands and count the written records in CountBuffer\n"
+            "uniform bool instanceOffsetsEnabled; // base instance is draw command index, matrix offset goes to InstanceOffsetBuffer\n"
+            "uniform mat4 projection;\n"
+            "uniform vec4 frustumPlanes[6];\n"
+            "uniform bool hiZEnabled;\n"
+            "uniform sampler2D hiZTexture;\n"
+            "\n"
+            "// the same test as performed by ge::rg::Culling::isVisible()\n"
+            "bool isVisible(mat4 m,vec4 bounds)\n"
+            "{\n"
+            "   if(bounds.w<0.) return true; // no bounds\n"
+            "\n"
+            "   // transform sphere\n"
+            "   vec3 c=(m*vec4(bounds.xyz,1.)).xyz;\n"
+            "   float r=bounds.w*sqrt(max(max(dot(m[0].xyz,m[0].xyz),dot(m[1].xyz,m[1].xyz)),dot(m[2].xyz,m[2].xyz)));\n"
+            "\n"
+            "   // frustum culling\n"
+            "   for(int i=0; i<6; i++)\n"
+            "      if(dot(frustumPlanes[i].xyz,c)+frustumPlanes[i].w<-r) return false;\n"
+            "   if(!hiZEnabled) return true;\n"
+            "\n"
+            "   // screen-space bounds of the box around the sphere\n"
+            "   vec3 mn=vec3(1e30),mx=vec3(-1e30);\n"
+            "   for(int i=0; i<8; i++) {\n"
+            "      vec3 corner=c+r*vec3((i&1)!=0?1.:-1.,(i&2)!=0?1.:-1.,(i&4)!=0?1.:-1.);\n"
+            "      vec4 clip=projection*vec4(corner,1.);\n"
+            "      if(clip.w<=0.) return true;\n"
+            "      vec3 ndc=clip.xyz/clip.w;\n"
+            "      mn=min(mn,ndc);\n"
+            "      mx=max(mx,ndc);\n"
+            "   }\n"
+            "\n"
+            "   // occlusion culling on level where the rectangle spans at most 2x2 texels\n"
+            "   ivec2 size=textureSize(hiZTexture,0);\n"
+            "   ivec2 p0=min(ivec2(max(mn.xy*0.5+0.5,0.)*vec2(size)),size-1);\n"
+            "   ivec2 p1=min(ivec2(max(mx.xy*0.5+0.5,0.)*vec2(size)),size-1);\n"
+            "   int level=0;\n"
+            "   int numLevels=textureQueryLevels(hiZTexture);\n"
+            "   while(level+1<numLevels && any(greaterThan((p1>>level)-(p0>>level),ivec2(1))))\n"
+            "      level++;\n"
+            "   ivec2 levelSize=textureSize(hiZTexture,level);\n"
+            "   float hiZ=0.;\n"
+            "   for(int y=p0.y>>level; y<=(p1.y>>level); y++)\n"
+            "      for(int x=p0.x>>level; x<=(p1.x>>level); x++)\n"
+            "         hiZ=max(hiZ,texelFetch(hiZTexture,min(ivec2(x,y),levelSize-1),level).r);\n"
+            "   return mn.z*0.5+0.5<=hiZ;\n"
+            "}\n"
             "\n"
             "void main()\n"
             "{\n"
@@ -726,6 +983,24 @@ const shared_ptr<Program>& RenderingContext::getProcessDrawCommandsProgram() con
             "   uint matrixListOffset64=matrixListControlBuffer[matrixControlOffset4+0];\n"
             "   uint numMatrices=matrixListControlBuffer[matrixControlOffset4+1];\n"
             "\n"
+            "   // culling (draw command is rendered if any of its instances is visible)\n"
+            "   uint instanceCount=numMatrices;\n"
+            "   if(cullingEnabled) {\n"
+            "      vec4 bounds=boundsBuffer[gl_GlobalInvocationID.x];\n"
+            "      uint i=0;\n"
+            "      while(i<numMatrices && !isVisible(matrixBuffer[matrixListOffset64+i],bounds))\n"
+            "         i++;\n"
+            "      if(i==numMatrices)\n"
+            "         instanceCount=0;\n"
+            "   }\n"
+            "\n"
+            "   // compaction (culled draw commands are not written, records of StateSet are packed)\n"
+            "   if(compactionEnabled) {\n"
+            "      if(instanceCount==0)\n"
+            "         return;\n"
+            "      atomicAdd(countBuffer[stateSetDataOffset4],1u);\n"
+            "   }\n"
+            "\n"
             "   // compute increment and get indirectBufferOffset\n"
             "   uint countAndIndexedFlag=primitiveBuffer[primitiveOffset4+0];\n"
             "   uint indirectBufferIncrement=4+bitfieldExtract(countAndIndexedFlag,31,1); // make increment 4 or 5\n"
@@ -734,7 +1009,7 @@ const shared_ptr<Program>& RenderingContext::getProcessDrawCommandsProgram() con
             "   // write indirect buffer data\n"
             "   drawIndirectBuffer[indirectBufferOffset4]=countAndIndexedFlag&0x7fffffff; // indexCount or vertexCount\n"
             "   indirectBufferOffset4++;\n"
-            "   drawIndirectBuffer[indirectBufferOffset4]=numMatrices; // instanceCount\n"
+            "   drawIndirectBuffer[indirectBufferOffset4]=instanceCount; // instanceCount\n"
             "   indirectBufferOffset4++;\n"
             "   uint first=primitiveBuffer[primitiveOffset4+1]; // firstIndex or firstVertex\n"
             "   uint vertexOffset=primitiveBuffer[primitiveOffset4+2]; // vertexOffset\n"
@@ -747,18 +1022,26 @@ const shared_ptr<Program>& RenderingContext::getProcessDrawCommandsProgram() con
             "      drawIndirectBuffer[indirectBufferOffset4]=first+vertexOffset; // firstVertex\n"
             "      indirectBufferOffset4++;\n"
             "   }\n"
-            "   drawIndirectBuffer[indirectBufferOffset4]=matrixListOffset64; // base instance\n"
+            "   uint baseInstance=matrixOffset64+matrixListOffset64;\n"
+            "   if(instanceOffsetsEnabled) {\n"
+            "      instanceOffsetBuffer[gl_GlobalInvocationID.x]=baseInstance;\n"
+            "      baseInstance=gl_GlobalInvocationID.x;\n"
+            "   }\n"
+            "   drawIndirectBuffer[indirectBufferOffset4]=baseInstance; // base instance\n"
             "}\n"));
    return _processDrawCommandsProgram;
 }
 
 
 shared_ptr<Program> RenderingContext::createProgram(RenderingContext::ProgramType type,
-                                                    bool uniformColor,
-                                                    bool useARBShaderDrawParameters)
+                                                    bool uniformColor,bool octahedralNormals,
+                                                    bool useARBShaderDrawParameters,bool materialTable,
+                                                    const shared_ptr<ProgramBinaryCache>& programBinaryCache)
 {
-   return make_shared<Program>(
-      make_shared<Shader>(GL_VERTEX_SHADER,
+   assert((!materialTable || useARBShaderDrawParameters) &&
+          "RenderingContext::createProgram(): material table requires ARB_shader_draw_parameters.");
+
+   const string vertexShader=
          static_cast<std::stringstream&>(stringstream()
 
             // buffer for shader_draw_parameters rendering
@@ -770,14 +1053,28 @@ shared_ptr<Program> RenderingContext::createProgram(RenderingContext::ProgramTyp
             "   mat4 instancingMatrixBuffer[];\n"
             "};\n"
             : "#version 330\n"
+            )
+
+            // per-draw-command data for material table rendering
+            <<(materialTable
+            ? "layout(std430,binding=1) restrict readonly buffer InstanceOffsetBuffer {\n"
+              "   uint instanceOffsetBuffer[];\n"
+              "};\n"
+              "layout(std430,binding=2) restrict readonly buffer DrawCommandMaterialBuffer {\n"
+              "   uint drawCommandMaterialBuffer[];\n"
+              "};\n"
+            : ""
             )<<
             "\n"
 
             // attributes
             "layout(location=0) in vec4 position;\n"
-            <<(type!=ProgramType::AMBIENT_PASS // normals are not used in ambient pass
+            <<(type!=ProgramType::AMBIENT_PASS && !octahedralNormals // normals are not used in ambient pass
             ? "layout(location=1) in vec3 normal;\n"
             : "")
+            <<(type!=ProgramType::AMBIENT_PASS && octahedralNormals // AttribType::CompressedNormal
+            ? "layout(location=1) in vec2 encodedNormal;\n"
+            : "")
             <<(!uniformColor
             ? "layout(location=2) in vec4 color;\n"
             : "")<<
@@ -807,6 +1104,9 @@ shared_ptr<Program> RenderingContext::createProgram(RenderingContext::ProgramTyp
             ? "   flat vec4 ambientColor;\n"
             : "")<<
             "   vec2 texCoord;\n"
+            <<(materialTable
+            ? "   flat uint material;\n"
+            : "")<<
             "} o;\n"
             "\n"
 
@@ -820,20 +1120,39 @@ shared_ptr<Program> RenderingContext::createProgram(RenderingContext::ProgramTyp
             "uniform mat4 projection;\n"
             "\n"
 
+            // octahedral normal decoding
+            <<(type!=ProgramType::AMBIENT_PASS && octahedralNormals
+            ? "vec3 octahedralDecode(vec2 e)\n"
+              "{\n"
+              "   vec3 n=vec3(e,1.-abs(e.x)-abs(e.y));\n"
+              "   if(n.z<0.)\n"
+              "      n.xy=(1.-abs(n.yx))*vec2(n.x>=0.?1.:-1.,n.y>=0.?1.:-1.);\n"
+              "   return normalize(n);\n"
+              "}\n"
+              "\n"
+            : "")<<
+
             // main function
             "void main()\n"
             "{\n"
 
             // instancing matrix (shader_draw_parameters)
             <<(useARBShaderDrawParameters
-            ? "   uint matrixOffset64=gl_BaseInstanceARB+gl_InstanceID;\n"
-              "   mat4 instancingMatrix=instancingMatrixBuffer[matrixOffset64];\n"
+            ? (materialTable
+               ? "   uint matrixOffset64=instanceOffsetBuffer[gl_BaseInstanceARB]+gl_InstanceID;\n"
+                 "   mat4 instancingMatrix=instancingMatrixBuffer[matrixOffset64];\n"
+                 "   o.material=drawCommandMaterialBuffer[gl_BaseInstanceARB];\n"
+               : "   uint matrixOffset64=gl_BaseInstanceARB+gl_InstanceID;\n"
+                 "   mat4 instancingMatrix=instancingMatrixBuffer[matrixOffset64];\n")
             : ""
             )<<
 
             // output data
             "   vec4 v=instancingMatrix*position;\n"
             "   gl_Position=projection*v;\n"
+            <<(type!=ProgramType::AMBIENT_PASS && octahedralNormals
+            ? "   vec3 normal=octahedralDecode(encodedNormal);\n"
+            : "")
             <<(type!=ProgramType::AMBIENT_PASS
             ? "   o.eyePosition=v.xyz;\n"
               "   o.eyeNormal=transpose(inverse(mat3(instancingMatrix)))*normal;\n"
@@ -843,11 +1162,17 @@ shared_ptr<Program> RenderingContext::createProgram(RenderingContext::ProgramTyp
             ? "   o.ambientColor=globalAmbientLight*color;\n"
             : "")<<
             "   o.texCoord=texCoord;\n"
-            "}\n").str()),
+            "}\n").str();
+
+   const string fragmentShader=
+         static_cast<std::stringstream&>(stringstream()
 
-      make_shared<Shader>(GL_FRAGMENT_SHADER,
-         static_cast<std::stringstream&>(stringstream()<<
-            "#version 330\n"
+            // material table needs shader storage buffer and optionally bindless textures
+            <<(materialTable
+            ? "#version 430\n"
+              "#extension GL_ARB_bindless_texture : enable\n"
+            : "#version 330\n"
+            )<<
             "\n"
 
             // input interface
@@ -869,6 +1194,9 @@ shared_ptr<Program> RenderingContext::createProgram(RenderingContext::ProgramTyp
             ? "   flat vec4 ambientColor;\n"
             : "")<<
             "   vec2 texCoord;\n"
+            <<(materialTable
+            ? "   flat uint material;\n"
+            : "")<<
             "};\n"
             "\n"
 
@@ -876,9 +1204,35 @@ shared_ptr<Program> RenderingContext::createProgram(RenderingContext::ProgramTyp
             "layout(location=0) out vec4 fragColor;\n"
             "\n"
 
+            // color texture given by StateSet uniforms or by material table
+            <<(!materialTable
+            ? "uniform int colorTexturingMode; // 0 - no texturing, 1 - modulate, 2 - replace\n"
+              "uniform sampler2D colorTexture;\n"
+              "\n"
+              "vec4 sampleColorTexture()\n"
+              "{\n"
+              "   return texture(colorTexture,texCoord);\n"
+              "}\n"
+              "\n"
+            : "layout(std430,binding=3) restrict readonly buffer MaterialBuffer {\n"
+              "   uvec4 materialBuffer[]; // xy - bindless texture handle, z - texture array layer, w - texturing mode\n"
+              "};\n"
+              "uniform sampler2DArray colorTextureArray;\n"
+              "int colorTexturingMode; // 0 - no texturing, 1 - modulate, 2 - replace, taken from the material\n"
+              "\n"
+              "vec4 sampleColorTexture()\n"
+              "{\n"
+              "   uvec4 m=materialBuffer[material];\n"
+              "#ifdef GL_ARB_bindless_texture\n"
+              "   if(m.x!=0u || m.y!=0u)\n"
+              "      return texture(sampler2D(m.xy),texCoord);\n"
+              "#endif\n"
+              "   return texture(colorTextureArray,vec3(texCoord,float(m.z)));\n"
+              "}\n"
+              "\n"
+            )
+
             // uniforms
-            "uniform int colorTexturingMode; // 0 - no texturing, 1 - modulate, 2 - replace\n"
-            "uniform sampler2D colorTexture;\n"
             <<(type!=ProgramType::AMBIENT_PASS
             ? "uniform vec4 specularAndShininess; // shininess in alpha\n"
               "uniform vec4 lightPosition; // in eye coordinates, w must be 0 or 1\n"
@@ -890,6 +1244,10 @@ shared_ptr<Program> RenderingContext::createProgram(RenderingContext::ProgramTyp
             // main function
             "void main()\n"
             "{\n"
+            <<(materialTable
+            ? "   colorTexturingMode=int(materialBuffer[material].w);\n"
+              "\n"
+            : "")
 
             // texturing for AMBIENT_AND_LIGHT_PASS
             <<(type==ProgramType::AMBIENT_AND_LIGHT_PASS
@@ -898,7 +1256,7 @@ shared_ptr<Program> RenderingContext::createProgram(RenderingContext::ProgramTyp
               "   if(colorTexturingMode==0) // no texturing\n"
               "      c=color;\n"
               "   else {\n"
-              "      vec4 t=texture(colorTexture,texCoord);\n"
+              "      vec4 t=sampleColorTexture();\n"
               "      if(colorTexturingMode==1) { // modulate\n"
               "         c=t*color;\n"
               "         ac=t*ambientColor;\n"
@@ -975,9 +1333,9 @@ shared_ptr<Program> RenderingContext::createProgram(RenderingContext::ProgramTyp
               "      if(colorTexturingMode==0) // no texturing\n"
               "         c=color;\n"
               "      else if(colorTexturingMode==1) // modulate\n"
-              "         c=texture(colorTexture,texCoord)*color;\n"
+              "         c=sampleColorTexture()*color;\n"
               "      else // replace\n"
-              "         c=texture(colorTexture,texCoord);\n"
+              "         c=sampleColorTexture();\n"
               "\n"
 
             // final lighting sum in LIGHT_PASS
@@ -1009,22 +1367,36 @@ shared_ptr<Program> RenderingContext::createProgram(RenderingContext::ProgramTyp
               "   if(colorTexturingMode==0) // no texturing\n"
               "      ac=ambientColor;\n"
               "   else if(colorTexturingMode==1) // modulate\n"
-              "      ac=texture(colorTexture,texCoord)*ambientColor;\n"
+              "      ac=sampleColorTexture()*ambientColor;\n"
               "   else // replace\n"
-              "      ac=texture(colorTexture,texCoord);\n"
+              "      ac=sampleColorTexture();\n"
               "\n"
               "   // final sum for light-facing fragments\n"
               "   fragColor=ac;\n"
               "}\n"
-            : "")).str()));
+            : "")).str();
+
+   if(programBinaryCache)
+      return programBinaryCache->createProgram({{GL_VERTEX_SHADER,{vertexShader}},
+                                                {GL_FRAGMENT_SHADER,{fragmentShader}}});
+   return make_shared<Program>(make_shared<Shader>(GL_VERTEX_SHADER,vertexShader),
+                               make_shared<Shader>(GL_FRAGMENT_SHADER,fragmentShader));
 }
 
 
-const std::shared_ptr<ge::gl::Program>& RenderingContext::getProgram(ProgramType type,bool uniformColor) const
+/** Returns built-in program for given pass.
+ *
+ *  If octahedralNormals is true, the program expects normals
+ *  of AttribType::CompressedNormal type at location 1 and decodes them.
+ *  Other compressed attribute types (AttribType::CompressedPosition,
+ *  CompressedTexCoord, CompressedColor) need no decoding and work with all the programs.
+ */
+const std::shared_ptr<ge::gl::Program>& RenderingContext::getProgram(ProgramType type,bool uniformColor,
+                                                                     bool octahedralNormals) const
 {
-   auto &ptr=_programCache[ProgramConfig{type,uniformColor}];
+   auto &ptr=_programCache[ProgramConfig{type,uniformColor,octahedralNormals}];
    if(!ptr)
-      ptr=createProgram(type,uniformColor,_useARBShaderDrawParameters);
+      ptr=createProgram(type,uniformColor,octahedralNormals,_useARBShaderDrawParameters,_materialTable!=nullptr,_programBinaryCache);
    return ptr;
 }
 
@@ -1033,7 +1405,8 @@ bool RenderingContext::ProgramConfig::operator<(const ProgramConfig& rhs) const
 {
    if(this->type<rhs.type)  return true;
    if(this->type>rhs.type)  return false;
-   return this->uniformColor<rhs.uniformColor;
+   if(this->uniformColor!=rhs.uniformColor)  return this->uniformColor<rhs.uniformColor;
+   return this->octahedralNormals<rhs.octahedralNormals;
 }
 
 
@@ -1041,7 +1414,7 @@ const shared_ptr<Program>& RenderingContext::getAmbientProgram() const
 {
    if(!_ambientProgram) {
       const_cast<RenderingContext*>(this)->_ambientProgram=
-            createProgram(ProgramType::AMBIENT_PASS,false,_useARBShaderDrawParameters);
+            createProgram(ProgramType::AMBIENT_PASS,false,false,_useARBShaderDrawParameters,_materialTable!=nullptr,_programBinaryCache);
    }
    return _ambientProgram;
 }
@@ -1051,7 +1424,7 @@ const shared_ptr<Program>& RenderingContext::getAmbientUniformColorProgram() con
 {
    if(!_ambientUniformColorProgram) {
       const_cast<RenderingContext*>(this)->_ambientUniformColorProgram=
-            createProgram(ProgramType::AMBIENT_PASS,true,_useARBShaderDrawParameters);
+            createProgram(ProgramType::AMBIENT_PASS,true,false,_useARBShaderDrawParameters,_materialTable!=nullptr,_programBinaryCache);
    }
    return _ambientUniformColorProgram;
 }
@@ -1061,7 +1434,7 @@ const shared_ptr<Program>& RenderingContext::getPhongProgram() const
 {
    if(!_phongProgram) {
       const_cast<RenderingContext*>(this)->_phongProgram=
-            createProgram(ProgramType::LIGHT_PASS,false,_useARBShaderDrawParameters);
+            createProgram(ProgramType::LIGHT_PASS,false,false,_useARBShaderDrawParameters,_materialTable!=nullptr,_programBinaryCache);
    }
    return _phongProgram;
 }
@@ -1071,7 +1444,7 @@ const shared_ptr<Program>& RenderingContext::getPhongUniformColorProgram() const
 {
    if(!_phongUniformColorProgram) {
       const_cast<RenderingContext*>(this)->_phongUniformColorProgram=
-            createProgram(ProgramType::LIGHT_PASS,true,_useARBShaderDrawParameters);
+            createProgram(ProgramType::LIGHT_PASS,true,false,_useARBShaderDrawParameters,_materialTable!=nullptr,_programBinaryCache);
    }
    return _phongUniformColorProgram;
 }
@@ -1117,27 +1490,63 @@ static void printFloatBufferContent(shared_ptr<ge::gl::Buffer>& b,unsigned numFl
 #endif
 
 
-static void countMatrices(Transformation *t,unsigned &totalMatrices)
+/** State of a single traversal of transformation graph. It is either the traversal
+ *  of the whole graph (serial evaluation) or of a single task (parallel evaluation).
+ *  The buffers are accessed directly, without RenderingContext::current(),
+ *  so the traversal can be performed by any thread.
+ */
+struct TransformationTraversal {
+   const float *cpuTransformationBuffer;
+   MatrixGpuData *matrixBuffer;
+   ListControlGpuData *listControlBuffer;
+   unsigned bufferPosition;
+   bool singleVisits;
+};
+
+
+/** Part of transformation graph processed as a single task of parallel evaluation.
+ *  The task is either the whole subtree of the transformation or, if the subtree
+ *  was split into more tasks, the transformation alone.
+ */
+struct TransformationTask {
+   Transformation *transformation;
+   glm::mat4 parentMV;
+   bool processChildren;
+   unsigned numMatrices;
+   unsigned bufferPosition;
+};
+
+
+static void countMatrices(Transformation *t,unsigned &totalMatrices,
+                          unsigned taskIndex,bool &listsShared,bool processChildren=true)
 {
+   t->setMatrixOffset64(0);
+   t->clearDirtyFlags();
    MatrixList *ml=t->matrixList().get();
    if(ml) {
       if(ml->restartFlag()) {
          ml->setNumMatrices(1);
          ml->setRestartFlag(false);
+         ml->setTaskIndex(taskIndex);
       } else {
          ml->setNumMatrices(ml->numMatrices()+1);
+         if(ml->taskIndex()!=taskIndex)
+            listsShared=true;
       }
       totalMatrices++;
    }
-   for(auto it=t->childList().begin(); it!=t->childList().end(); it++)
-      countMatrices(it->get(),totalMatrices);
+   if(processChildren)
+      for(auto it=t->childList().begin(); it!=t->childList().end(); it++)
+         countMatrices(it->get(),totalMatrices,taskIndex,listsShared);
 }
 
 
-static void processTransformation(Transformation *t,const glm::mat4& parentMV,RenderingContext *rc)
+static void processTransformation(Transformation *t,const glm::mat4& parentMV,
+                                  TransformationTraversal &d,bool processChildren=true)
 {
    // compute new matrix
-   glm::mat4 mv=parentMV*(*reinterpret_cast<glm::mat4*>(t->getMatrixPtr()));
+   glm::mat4 mv=parentMV*(*reinterpret_cast<const glm::mat4*>(
+         &d.cpuTransformationBuffer[t->gpuDataOffset64()*16]));
 
    // update number of matrices and allocated space for them
    MatrixList *ml=t->matrixList().get();
@@ -1146,54 +1555,221 @@ static void processTransformation(Transformation *t,const glm::mat4& parentMV,Re
       if(ml->restartFlag()==false)
       {
          ml->setRestartFlag(true);
-         unsigned matrixOffset64=rc->bufferPosition();
-         ml->setStartIndex(matrixOffset64);
-         rc->setBufferPosition(matrixOffset64+ml->numMatrices());
-         ml->uploadListControlData(); // upload startIndex and numMatrices
+         ml->setStartIndex(d.bufferPosition);
+         d.bufferPosition+=ml->numMatrices();
+         ListControlGpuData &control=d.listControlBuffer[ml->listControlId()];
+         control.startIndex=ml->startIndex();
+         control.numItems=ml->numMatrices();
          ml->setNumMatrices(0);
       }
-      ml->uploadMatrixData(glm::value_ptr(mv),ml->numMatrices(),1);
+
+      // remember matrix placement for incremental evaluation
+      // (Transformations reached by more paths do not have single placement)
+      if(t->matrixOffset64()!=0)
+         d.singleVisits=false;
+      unsigned matrixOffset64=ml->startIndex()+ml->numMatrices();
+      t->setMatrixOffset64(matrixOffset64);
+
+      d.matrixBuffer[matrixOffset64].asGlmMatrix()=mv;
       ml->setNumMatrices(ml->numMatrices()+1);
    }
 
+   // process child transformations
+   if(processChildren)
+      for(auto it=t->childList().begin(); it!=t->childList().end(); it++)
+         processTransformation(it->get(),mv,d);
+}
+
+
+/** Splits transformation graph into tasks for parallel evaluation.
+ *  Each graph root makes a task. Then, the tasks are split into their
+ *  child subtrees until there is at least minNumTasks tasks
+ *  or maxLevels levels of the graph were split.
+ *  The tasks are kept in the depth-first order of the graph traversal.
+ */
+static void createTransformationTasks(vector<TransformationTask> &tasks,
+                                      const RenderingContext::TransformationGraphList &graphs,
+                                      const float *cpuTransformationBuffer,
+                                      size_t minNumTasks,unsigned maxLevels)
+{
+   tasks.clear();
+   for(auto it=graphs.begin(); it!=graphs.end(); it++)
+      tasks.push_back(TransformationTask{it->get(),glm::mat4{},true,0,0});
+
+   vector<TransformationTask> splitTasks;
+   for(unsigned level=0; level<maxLevels && tasks.size()<minNumTasks; level++) {
+      splitTasks.clear();
+      splitTasks.reserve(tasks.size()*2);
+      for(TransformationTask &task : tasks) {
+         Transformation *t=task.transformation;
+         if(!task.processChildren || t->childList().empty()) {
+            splitTasks.push_back(task);
+            continue;
+         }
+         task.processChildren=false;
+         splitTasks.push_back(task);
+         glm::mat4 mv=task.parentMV*(*reinterpret_cast<const glm::mat4*>(
+               &cpuTransformationBuffer[t->gpuDataOffset64()*16]));
+         for(auto it=t->childList().begin(); it!=t->childList().end(); it++)
+            splitTasks.push_back(TransformationTask{it->get(),mv,true,0,0});
+      }
+      tasks.swap(splitTasks);
+   }
+}
+
+
+/** Recomputes matrices of changed subtrees only. Matrices are written
+ *  to the places assigned by the last full evaluation of transformation graph.
+ */
+static void processDirtyTransformation(Transformation *t,const glm::mat4& parentMV,
+                                       bool parentDirty,MatrixGpuData *matrixBuffer)
+{
+   bool dirty=parentDirty || t->isDirty();
+   if(!dirty && !t->isSubtreeDirty())
+      return;
+   t->clearDirtyFlags();
+
+   // compute new matrix
+   glm::mat4 mv=parentMV*(*reinterpret_cast<glm::mat4*>(t->getMatrixPtr()));
+   if(dirty && t->matrixList())
+      matrixBuffer[t->matrixOffset64()].asGlmMatrix()=mv;
+
    // process child transformations
    for(auto it=t->childList().begin(); it!=t->childList().end(); it++)
-      processTransformation(it->get(),mv,rc);
+      processDirtyTransformation(it->get(),mv,dirty,matrixBuffer);
 }
 
 
 void RenderingContext::evaluateTransformationGraph()
 {
+   // update changed subtrees only
+   // (matrix placement from the previous evaluation is kept)
+   // (not used with persistent ring as each segment has to be written completely)
+   if(_incrementalTransformationGraphEvaluation && _transformationGraphValid && _frameRingSize==0) {
+      glm::mat4 mv{}; // identity matrix
+      MatrixGpuData *matrixBuffer=matrixStorage()->map(BufferStorageAccess::WRITE);
+      for(auto it=_transformationGraphs.begin(); it!=_transformationGraphs.end(); it++)
+         processDirtyTransformation(it->get(),mv,false,matrixBuffer);
+      matrixStorage()->unmap();
+      return;
+   }
+
+   // recompute all matrices using flattened graph
+   // (the structure of the graph did not change since it was compiled)
+   if(_flattenedTransformationGraphEvaluation && _transformationGraphValid && _frameRingSize==0) {
+      MatrixGpuData *matrixBuffer=matrixStorage()->map(BufferStorageAccess::WRITE);
+      _flattenedTransformationGraph.evaluate(_cpuTransformationBuffer,matrixBuffer);
+      matrixStorage()->unmap();
+      return;
+   }
+
+   // split the graph into tasks for parallel evaluation
+   // (four tasks per thread give reasonable load balancing)
+   vector<TransformationTask> tasks;
+   bool parallel=_threadPool && _threadPool->numThreads()>1;
+   if(parallel)
+      createTransformationTasks(tasks,_transformationGraphs,_cpuTransformationBuffer,
+                                _threadPool->numThreads()*4,3);
+
    // count matrices
    unsigned totalMatrices=_matrixStorage.numNullItems(); // skip null items
-   for(auto it=_transformationGraphs.begin(); it!=_transformationGraphs.end(); it++)
-      countMatrices(it->get(),totalMatrices);
+   bool listsShared=false;
+   if(parallel) {
+      for(unsigned i=0,c=unsigned(tasks.size()); i<c; i++) {
+         TransformationTask &task=tasks[i];
+         task.numMatrices=0;
+         countMatrices(task.transformation,task.numMatrices,i,listsShared,task.processChildren);
+         totalMatrices+=task.numMatrices;
+      }
+
+      // MatrixLists visited by more tasks would be written concurrently,
+      // use serial evaluation in such case
+      if(listsShared)
+         parallel=false;
+   }
+   else
+      for(auto it=_transformationGraphs.begin(); it!=_transformationGraphs.end(); it++)
+         countMatrices(it->get(),totalMatrices,0,listsShared);
 
    if(totalMatrices>_matrixStorage.capacity()) {
 
       // resize matrix buffer
       unsigned newSize=unsigned(float(totalMatrices)*1.2f);
       _matrixStorage.setCapacity(newSize);
-      _matrixStorage.buffer()->realloc(newSize*sizeof(float)*16,ge::gl::Buffer::KEEP_ID);
+      if(_matrixStorage.isPersistentRing()) {
+         // persistently mapped buffer can not keep its id
+         // (identity matrix is copied from the current segment)
+         _matrixStorage.setPersistentRing(_frameRingSize);
+         updateInstancingMatrixAttribs();
+      }
+      else {
+         _matrixStorage.buffer()->realloc(newSize*sizeof(float)*16,ge::gl::Buffer::KEEP_ID);
+
+         // initialize identity matrix on the beginning of the buffer
+         float *p=static_cast<float*>(_matrixStorage.buffer()->map(0,sizeof(float)*16,GL_MAP_WRITE_BIT));
+         memcpy(p,identityMatrix,sizeof(float)*16);
+         _matrixStorage.buffer()->unmap();
+      }
+   }
+
+   MatrixGpuData *matrixBuffer=matrixStorage()->map(BufferStorageAccess::WRITE);
+   memcpy(matrixBuffer,identityMatrix,sizeof(float)*16);
+   ListControlGpuData *listControlBuffer=matrixListControlStorage()->map(BufferStorageAccess::WRITE);
+   bool singleVisits=true;
+
+   if(parallel) {
+
+      // assign buffer range to each task
+      // (prefix sum of numbers of matrices gives the same layout as serial evaluation)
+      unsigned position=_matrixStorage.numNullItems(); // skip null items
+      for(TransformationTask &task : tasks) {
+         task.bufferPosition=position;
+         position+=task.numMatrices;
+      }
+
+      // process tasks concurrently
+      vector<char> taskSingleVisits(tasks.size(),1); // vector<bool> can not be written concurrently
+      _threadPool->parallelFor(unsigned(tasks.size()),
+         [&tasks,&taskSingleVisits,matrixBuffer,listControlBuffer,this](unsigned i) {
+            TransformationTask &task=tasks[i];
+            TransformationTraversal d{_cpuTransformationBuffer,matrixBuffer,listControlBuffer,
+                                      task.bufferPosition,true};
+            processTransformation(task.transformation,task.parentMV,d,task.processChildren);
+            assert(d.bufferPosition==task.bufferPosition+task.numMatrices &&
+                   "RenderingContext::evaluateTransformationGraph(): Task wrote matrices outside of its buffer range.");
+            taskSingleVisits[i]=d.singleVisits;
+         });
+      for(char v : taskSingleVisits)
+         singleVisits=singleVisits && v;
+
+      // here, we use buffer position as index to matrix4 buffer that is stored in MatrixStorage
+      setBufferPosition(position);
+
+   }
+   else {
+
+      // here, we use buffer position as index to matrix4 buffer that is stored in MatrixStorage
+      TransformationTraversal d{_cpuTransformationBuffer,matrixBuffer,listControlBuffer,
+                                _matrixStorage.numNullItems(),true}; // skip null items
+      glm::mat4 mv{}; // identity matrix
+      for(auto it=_transformationGraphs.begin(); it!=_transformationGraphs.end(); it++)
+         processTransformation(it->get(),mv,d);
+      singleVisits=d.singleVisits;
+      setBufferPosition(d.bufferPosition);
 
-      // initialize identity matrix on the beginning of the buffer
-      float *p=static_cast<float*>(_matrixStorage.buffer()->map(0,sizeof(float)*16,GL_MAP_WRITE_BIT));
-      memcpy(p,identityMatrix,sizeof(float)*16);
-      _matrixStorage.buffer()->unmap();
    }
 
-   // reset buffer position
-   // here, we use it as index to matrix4 buffer that is stored in MatrixStorage
-   setBufferPosition(_matrixStorage.numNullItems()); // skip null items
-
-   glm::mat4 mv{}; // identity matrix
-   matrixStorage()->map(BufferStorageAccess::WRITE);
-   memcpy(matrixStorage()->ptr(),identityMatrix,sizeof(float)*16);
-   matrixListControlStorage()->map(BufferStorageAccess::WRITE);
-   for(auto it=_transformationGraphs.begin(); it!=_transformationGraphs.end(); it++)
-      processTransformation(it->get(),mv,this);
    matrixStorage()->unmap();
    matrixListControlStorage()->unmap();
+
+   // incremental and flattened evaluation require each matrix to have single place in the buffer
+   _transformationGraphValid=singleVisits;
+   if(_flattenedTransformationGraphEvaluation) {
+      if(singleVisits)
+         _flattenedTransformationGraph.compile(_transformationGraphs);
+      else
+         _flattenedTransformationGraph.clear();
+   }
 }
 
 
@@ -1224,22 +1800,123 @@ void RenderingContext::setupRendering()
 
 void RenderingContext::processDrawCommands()
 {
+   unsigned numDrawCommands=drawCommandStorage()->firstItemAvailableAtTheEnd();
+   if(_drawCommandBounds.size()<numDrawCommands)
+      _drawCommandBounds.resize(numDrawCommands,BoundingSphereGpuData{{0.f,0.f,0.f},-1.f});
+
+   // matrix offsets of draw commands for material table rendering (one uint per draw command)
+   if(_materialTable) {
+      GLsizeiptr instanceOffsetBufferSize=GLsizeiptr(max(numDrawCommands,1u))*4;
+      if(!_instanceOffsetBuffer || _instanceOffsetBuffer->getSize()<instanceOffsetBufferSize)
+         _instanceOffsetBuffer=make_shared<Buffer>(instanceOffsetBufferSize,nullptr,GL_DYNAMIC_COPY);
+   }
+
+   // draw counts for indirect count rendering (one uint per StateSet item)
+   if(_indirectCountEnabled) {
+      GLsizeiptr countBufferSize=GLsizeiptr(stateSetStorage()->firstItemAvailableAtTheEnd())*4;
+      if(!_drawCountBuffer || _drawCountBuffer->getSize()<countBufferSize)
+         _drawCountBuffer=make_shared<Buffer>(max(countBufferSize,GLsizeiptr(4)),nullptr,GL_DYNAMIC_COPY);
+   }
+
+   // process draw commands and generate content of draw indirect buffer on CPU
+   if(_drawCommandProcessingBackend==DrawCommandProcessingBackend::CPU) {
+      DrawCommandProcessor::Buffers b;
+      if(_cullingEnabled) {
+         _culling.hiZBuffer=_hiZBuffer.empty() ? nullptr : &_hiZBuffer;
+         b.matrixBuffer=matrixStorage()->map(BufferStorageAccess::READ);
+         b.boundsBuffer=_drawCommandBounds.data();
+         b.culling=&_culling;
+      } else {
+         b.matrixBuffer=nullptr;
+         b.boundsBuffer=nullptr;
+         b.culling=nullptr;
+      }
+      b.primitiveBuffer=reinterpret_cast<const unsigned*>(primitiveStorage()->map(BufferStorageAccess::READ));
+      b.drawCommandBuffer=reinterpret_cast<const unsigned*>(drawCommandStorage()->map(BufferStorageAccess::READ));
+      b.matrixListControlBuffer=reinterpret_cast<const unsigned*>(matrixListControlStorage()->map(BufferStorageAccess::READ));
+      b.stateSetBuffer=reinterpret_cast<unsigned*>(stateSetStorage()->map(BufferStorageAccess::READ_WRITE));
+      b.numStateSetItems=stateSetStorage()->firstItemAvailableAtTheEnd();
+      b.drawIndirectBuffer=static_cast<unsigned*>(drawIndirectBuffer()->map(GL_MAP_WRITE_BIT));
+      b.matrixOffset64=matrixStorage()->segmentOffset()/unsigned(sizeof(MatrixGpuData));
+      b.countBuffer=nullptr;
+      if(_indirectCountEnabled) {
+         b.countBuffer=static_cast<unsigned*>(_drawCountBuffer->map(GL_MAP_WRITE_BIT|GL_MAP_INVALIDATE_BUFFER_BIT));
+         memset(b.countBuffer,0,size_t(_drawCountBuffer->getSize()));
+      }
+      b.instanceOffsetBuffer=nullptr;
+      if(_materialTable)
+         b.instanceOffsetBuffer=static_cast<unsigned*>(_instanceOffsetBuffer->map(GL_MAP_WRITE_BIT|GL_MAP_INVALIDATE_BUFFER_BIT));
+      _drawCommandProcessor.process(b,numDrawCommands,_threadPool.get());
+      if(_materialTable)
+         _instanceOffsetBuffer->unmap();
+      if(_indirectCountEnabled)
+         _drawCountBuffer->unmap();
+      drawIndirectBuffer()->unmap();
+      unmapBuffers();
+      return;
+   }
+
    // process draw commands and generate content of draw indirect buffer using compute shader
    auto processDrawCommandsProgram=getProcessDrawCommandsProgram();
    processDrawCommandsProgram->use();
-   unsigned numInstances=drawCommandStorage()->firstItemAvailableAtTheEnd();
-   processDrawCommandsProgram->set1ui("numToProcess",numInstances);
+   processDrawCommandsProgram->set1ui("numToProcess",numDrawCommands);
+   processDrawCommandsProgram->set1ui("matrixOffset64",matrixStorage()->segmentOffset()/unsigned(sizeof(MatrixGpuData)));
+   processDrawCommandsProgram->set1i("cullingEnabled",_cullingEnabled);
+   processDrawCommandsProgram->set1i("compactionEnabled",_indirectCountEnabled);
+   processDrawCommandsProgram->set1i("instanceOffsetsEnabled",_materialTable!=nullptr);
+   if(_materialTable)
+      _instanceOffsetBuffer->bindBase(GL_SHADER_STORAGE_BUFFER,8);
+   if(_indirectCountEnabled) {
+      const unsigned zero=0;
+      gl.glClearNamedBufferData(_drawCountBuffer->getId(),GL_R32UI,GL_RED_INTEGER,GL_UNSIGNED_INT,&zero);
+      _drawCountBuffer->bindBase(GL_SHADER_STORAGE_BUFFER,7);
+   }
+   if(_cullingEnabled) {
+
+      // upload bounds
+      size_t boundsSize=_drawCommandBounds.size()*sizeof(BoundingSphereGpuData);
+      if(!_drawCommandBoundsBuffer || size_t(_drawCommandBoundsBuffer->getSize())<boundsSize) {
+         _drawCommandBoundsBuffer=make_shared<Buffer>(boundsSize,_drawCommandBounds.data(),GL_DYNAMIC_DRAW);
+         _drawCommandBoundsDirty=false;
+      }
+      if(_drawCommandBoundsDirty) {
+         _drawCommandBoundsBuffer->setData(_drawCommandBounds.data(),boundsSize);
+         _drawCommandBoundsDirty=false;
+      }
+
+      processDrawCommandsProgram->setMatrix4fv("projection",_culling.projection());
+      processDrawCommandsProgram->set4fv("frustumPlanes",_culling.frustumPlanes(),6);
+      processDrawCommandsProgram->set1i("hiZEnabled",_hiZTexture!=nullptr);
+      if(_hiZTexture) {
+         processDrawCommandsProgram->set1i("hiZTexture",0);
+         _hiZTexture->bind(0);
+      }
+      matrixStorage()->bindBase(GL_SHADER_STORAGE_BUFFER,5);
+      _drawCommandBoundsBuffer->bindBase(GL_SHADER_STORAGE_BUFFER,6);
+   }
    primitiveStorage()->buffer()->bindBase(GL_SHADER_STORAGE_BUFFER,0);
    drawCommandStorage()->buffer()->bindBase(GL_SHADER_STORAGE_BUFFER,1);
-   matrixListControlStorage()->buffer()->bindBase(GL_SHADER_STORAGE_BUFFER,2);
+   matrixListControlStorage()->bindBase(GL_SHADER_STORAGE_BUFFER,2);
    drawIndirectBuffer()->bindBase(GL_SHADER_STORAGE_BUFFER,3);
-   stateSetStorage()->buffer()->bindBase(GL_SHADER_STORAGE_BUFFER,4);
-   gl.glDispatchCompute((numInstances+63)/64,1,1);
+   stateSetStorage()->bindBase(GL_SHADER_STORAGE_BUFFER,4);
+   gl.glDispatchCompute((numDrawCommands+63)/64,1,1);
 }
 
 
 void RenderingContext::fenceSyncGpuComputation()
 {
+   // with persistent ring, CPU does not wait for GPU here;
+   // memory barrier makes draw indirect buffer written by compute shader
+   // visible to the following indirect draw commands
+   // (and instance offset buffer visible to vertex shaders if material table is used)
+   if(_frameRingSize!=0) {
+      GLbitfield barriers=GL_COMMAND_BARRIER_BIT;
+      if(_materialTable)
+         barriers|=GL_SHADER_STORAGE_BARRIER_BIT;
+      gl.glMemoryBarrier(barriers);
+      return;
+   }
+
    // finish all current commands in GPU queue
    GLsync syncObj=gl.glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE,0);
 #if 0 // glWaitSync does not work on my Quadro K1000M (Keppler architecture), drivers 352.21
@@ -1258,8 +1935,29 @@ void RenderingContext::render()
 {
    // bind buffers for rendering
    drawIndirectBuffer()->bind(GL_DRAW_INDIRECT_BUFFER);
+   if(_indirectCountEnabled)
+      _drawCountBuffer->bind(GL_PARAMETER_BUFFER_ARB);
    if(_useARBShaderDrawParameters)
       matrixStorage()->buffer()->bindBase(GL_SHADER_STORAGE_BUFFER,0);
+   if(_materialTable && _instanceOffsetBuffer) {
+
+      // upload material indices of draw commands
+      size_t materialsSize=max(_drawCommandMaterials.size(),size_t(1))*4;
+      if(!_drawCommandMaterialBuffer || size_t(_drawCommandMaterialBuffer->getSize())<materialsSize) {
+         _drawCommandMaterialBuffer=make_shared<Buffer>(materialsSize,nullptr,GL_DYNAMIC_DRAW);
+         _drawCommandMaterialsDirty=true;
+      }
+      if(_drawCommandMaterialsDirty) {
+         if(!_drawCommandMaterials.empty())
+            _drawCommandMaterialBuffer->setData(_drawCommandMaterials.data(),_drawCommandMaterials.size()*4);
+         _drawCommandMaterialsDirty=false;
+      }
+
+      // bind buffers of built-in programs (see createProgram())
+      _instanceOffsetBuffer->bindBase(GL_SHADER_STORAGE_BUFFER,1);
+      _drawCommandMaterialBuffer->bindBase(GL_SHADER_STORAGE_BUFFER,2);
+      _materialTable->bind(3,0);
+   }
 
 #if 0
    cout<<_primitiveStorage.buffer()->getSize()<<endl;
@@ -1286,30 +1984,92 @@ void RenderingContext::render()
 }
 
 
+/** Sets batcher used by AttribStorage::uploadVertices() and AttribStorage::uploadIndices().
+ *
+ *  The uploads are only recorded by the batcher. They are merged into ranges
+ *  of consecutive bytes and uploaded by few buffer copies when frame() starts
+ *  GPU work (or when the batcher is flushed by the application).
+ *  Null value (default) uploads data immediately. Writes recorded by the previous
+ *  batcher are flushed.
+ */
+void RenderingContext::setUploadBatcher(const shared_ptr<UploadBatcher>& batcher)
+{
+   if(_uploadBatcher)
+      _uploadBatcher->flush();
+   _uploadBatcher=batcher;
+}
+
+
 void RenderingContext::frame()
 {
+   // profiling of frame stages (queries are resolved frames later, they do not stall)
+   FrameProfiler *profiler=_frameProfiler.get();
+   if(profiler)
+      profiler->beginFrame();
+
    // update progressStamp (monotonically increasing number wrapping on overflow)
    incrementProgressStamp();
 
    // clear screen
    gl.glClear(GL_COLOR_BUFFER_BIT|GL_DEPTH_BUFFER_BIT);
 
+   // switch persistent ring to the next segment
+   // (wait until GPU finishes the frame that used it)
+   if(_frameRingSize!=0) {
+      _frameRingIndex=(_frameRingIndex+1)%_frameRingSize;
+      waitForFrameFence(_frameRingIndex);
+      _matrixStorage.setCurrentSegment(_frameRingIndex);
+      _matrixListControlStorage.setCurrentSegment(_frameRingIndex);
+      _stateSetStorage.setCurrentSegment(_frameRingIndex);
+   }
+
+   // merge scene recorded by worker threads
+   if(profiler) profiler->begin("sceneRecorders");
+   commitSceneRecorders();
+   if(profiler) profiler->end();
+
    // compute transformation matrices
+   if(profiler) profiler->begin("transformations");
    evaluateTransformationGraph();
+   if(profiler) profiler->end();
+
+   // move vertex data to free blocks in AttribStorages
+   if(_vertexDataCompactionBudget>0) {
+      if(profiler) profiler->begin("compaction");
+      compactVertexData(_vertexDataCompactionBudget);
+      if(profiler) profiler->end();
+   }
 
    // prepare internal structures for rendering
+   if(profiler) profiler->begin("setup");
    stateSetStorage()->map(BufferStorageAccess::WRITE);
    setupRendering();
 
    // unmap buffers before GPU work
    unmapBuffers();
 
+   // upload vertex data recorded by the batcher
+   if(_uploadBatcher)
+      _uploadBatcher->flush();
+   if(profiler) profiler->end();
+
    // fill indirect buffer with draw commands
+   if(profiler) profiler->begin("drawCommands");
    processDrawCommands();
    fenceSyncGpuComputation();
+   if(profiler) profiler->end();
 
    // render scene
+   if(profiler) profiler->begin("render");
    render();
+   if(profiler) profiler->end();
+
+   // mark the end of GPU work using the current segment of persistent ring
+   if(_frameRingSize!=0)
+      _frameFences[_frameRingIndex]=gl.glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE,0);
+
+   if(profiler)
+      profiler->endFrame();
 
    // check for OpenGL errors
    unsigned e=gl.glGetError();
@@ -1318,6 +2078,92 @@ void RenderingContext::frame()
 }
 
 
+/** Sets the number of frames that can be prepared by CPU
+ *  while GPU renders the previous ones.
+ *
+ *  Non-zero value makes matrixStorage(), matrixListControlStorage() and
+ *  stateSetStorage() persistently mapped rings of numFrames segments
+ *  (see BufferStorage::setPersistentRing()). Each frame writes its own segment,
+ *  so the buffers are not mapped and unmapped each frame and CPU waits
+ *  in frame() only when it gets numFrames frames ahead of GPU.
+ *  Three frames are usually enough. Zero (default) disables the ring.
+ *
+ *  As each segment is written completely by each frame, incremental and flattened
+ *  evaluation of transformation graph are not used with the ring.
+ */
+void RenderingContext::setFrameRingSize(unsigned numFrames)
+{
+   if(numFrames==_frameRingSize)
+      return;
+
+   // no segment may be in use by GPU during reallocation
+   waitForFrameFences();
+
+   GLuint matrixBufferId=_matrixStorage.buffer()->getId();
+   _matrixStorage.setPersistentRing(numFrames);
+   _matrixListControlStorage.setPersistentRing(numFrames);
+   _stateSetStorage.setPersistentRing(numFrames);
+   if(_matrixStorage.buffer()->getId()!=matrixBufferId)
+      updateInstancingMatrixAttribs();
+
+   _frameRingSize=numFrames;
+   _frameRingIndex=0;
+   _frameFences.assign(numFrames,nullptr);
+   _transformationGraphValid=false;
+}
+
+
+/** Waits until GPU finishes all the frames using the persistent ring
+ *  and releases their fences.
+ */
+void RenderingContext::waitForFrameFences()
+{
+   for(unsigned i=0,c=unsigned(_frameFences.size()); i<c; i++)
+      waitForFrameFence(i);
+}
+
+
+/** Waits until GPU finishes the frame that used the given segment
+ *  of the persistent ring and releases its fence.
+ *
+ *  The wait is repeated until the fence is signaled, the segment
+ *  must not be written while GPU might be still reading it.
+ *  If the wait fails, the error is reported and glFinish() is used instead,
+ *  so the segment is not reused before GPU finishes all the commands.
+ */
+void RenderingContext::waitForFrameFence(unsigned index)
+{
+   GLsync &fence=_frameFences[index];
+   if(!fence)
+      return;
+   GLenum r;
+   do {
+      r=gl.glClientWaitSync(fence,GL_SYNC_FLUSH_COMMANDS_BIT,(GLuint64)1e9);
+   } while(r==GL_TIMEOUT_EXPIRED);
+   if(r!=GL_ALREADY_SIGNALED && r!=GL_CONDITION_SATISFIED) {
+      cerr<<"Error: RenderingContext::waitForFrameFence(): glClientWaitSync() failed\n"
+            "   for segment "<<index<<" of the persistent ring (error 0x"<<std::hex<<gl.glGetError()<<std::dec<<").\n"
+            "   Waiting for GPU to finish all the commands before the segment is reused."<<endl;
+      gl.glFinish();
+   }
+   gl.glDeleteSync(fence);
+   fence=nullptr;
+}
+
+
+/** Updates instancing matrix attributes of all AttribStorages
+ *  after matrix buffer got new id.
+ */
+void RenderingContext::updateInstancingMatrixAttribs()
+{
+   if(_useARBShaderDrawParameters)
+      return;
+   for(auto acIt=_attribConfigInstances.begin(); acIt!=_attribConfigInstances.end(); acIt++)
+      for(auto& attribStorage : acIt->second->attribStorageList)
+         attribStorage->setupInstancingMatrixAttribs();
+}
+
+
 std::shared_ptr<ge::gl::Texture> RenderingContext::cachedTexture(const std::string& path) const
 {
    auto it=_textureCache.find(path);
@@ -0,0 +1,224 @@
+#include <cstring>
+#include <iostream> // for cerr
+#include <geRG/SceneRecorder.h>
+#include <geRG/AttribStorage.h>
+#include <geRG/Mesh.h>
+#include <geRG/RenderingContext.h>
+#include <geRG/StateSet.h>
+
+using namespace std;
+using namespace ge::rg;
+
+
+
+SceneRecorder::SceneRecorder()
+   : _committed(false)
+{
+}
+
+
+SceneRecorder::~SceneRecorder()
+{
+}
+
+
+/** Appends the data to the arena and returns their offset.
+ *  The offsets are aligned to 8 bytes, so the data can be read as PrimitiveGpuData
+ *  or as any attribute type in place.
+ */
+size_t SceneRecorder::copyToArena(const void *data,size_t size)
+{
+   size_t offset=allocInArena(size);
+   if(size!=0)
+      memcpy(_arena.data()+offset,data,size);
+   return offset;
+}
+
+
+/** Appends uninitialized space to the arena and returns its offset.
+ *  The offset is aligned to 8 bytes as in copyToArena().
+ */
+size_t SceneRecorder::allocInArena(size_t size)
+{
+   size_t offset=(_arena.size()+7)&~size_t(7);
+   _arena.resize(offset+size);
+   return offset;
+}
+
+
+/** Records allocation of the mesh data and upload of vertices, indices and primitives.
+ *
+ *  The parameters have the meaning of Mesh::allocData(), Mesh::uploadVertices(),
+ *  Mesh::uploadIndices() and Mesh::setAndUploadPrimitives(). The data are copied
+ *  into the arena, compressed attributes (see AttribType::Encoding) are encoded
+ *  during the copy. Indices may be null if numIndices is zero.
+ *  The mesh must not be allocated yet and it must stay alive until the commit.
+ */
+SceneRecorder::MeshHandle SceneRecorder::addMesh(Mesh *mesh,const AttribConfig::Configuration& config,
+                                                 const void*const *attribList,unsigned numVertices,
+                                                 const void *indices,unsigned numIndices,
+                                                 const PrimitiveGpuData *primitives,const unsigned *modesAndOffsets4,
+                                                 unsigned numPrimitives)
+{
+   MeshRecord r;
+   r.mesh=mesh;
+   r.config=config;
+   r.numVertices=numVertices;
+   r.numIndices=numIndices;
+   r.numPrimitives=numPrimitives;
+
+   // attributes follow each other, each of them aligned
+   // (compressed attributes are encoded here, so the worker thread does the conversion)
+   r.verticesOffset=_arena.size();
+   for(size_t i=0,c=config.attribTypes.size(); i<c; i++) {
+      const AttribType& t=config.attribTypes[i];
+      size_t size=size_t(t.elementSize())*numVertices;
+      size_t offset;
+      if(t.encoding()==AttribType::NO_ENCODING)
+         offset=copyToArena(attribList[i],size);
+      else {
+         offset=allocInArena(size);
+         t.encode(_arena.data()+offset,attribList[i],numVertices);
+      }
+      if(i==0)
+         r.verticesOffset=offset;
+   }
+   r.indicesOffset=copyToArena(indices,size_t(numIndices)*4);
+   r.primitivesOffset=copyToArena(primitives,size_t(numPrimitives)*sizeof(PrimitiveGpuData));
+   r.modesOffset=copyToArena(modesAndOffsets4,size_t(numPrimitives)*2*sizeof(unsigned));
+
+   _meshes.push_back(std::move(r));
+   return MeshHandle(_meshes.size()-1);
+}
+
+
+/** Records getOrCreateStateSet() of the GLState. The recorder takes the ownership
+ *  of the GLState (usually created by StateSetManager::createGLState())
+ *  and deletes it after the commit.
+ */
+SceneRecorder::StateSetHandle SceneRecorder::addStateSet(StateSetManager::GLState *glState)
+{
+   StateSetRecord r;
+   r.glState.reset(glState);
+   _stateSets.push_back(std::move(r));
+   return StateSetHandle(_stateSets.size()-1);
+}
+
+
+/** Registers already existing StateSet to be used by addDrawable().
+ */
+SceneRecorder::StateSetHandle SceneRecorder::addStateSet(const shared_ptr<StateSet>& stateSet)
+{
+   StateSetRecord r;
+   r.stateSet=stateSet;
+   _stateSets.push_back(std::move(r));
+   return StateSetHandle(_stateSets.size()-1);
+}
+
+
+/** Records creation of the Drawable. The parameters have the meaning
+ *  of RenderingContext::createDrawable(). Primitive indices are copied into the arena.
+ */
+SceneRecorder::DrawableHandle SceneRecorder::addDrawable(MeshHandle mesh,const unsigned *primitiveIndices,
+                                                         unsigned primitiveCount,MatrixList *matrixList,
+                                                         StateSetHandle stateSet)
+{
+   size_t primitiveIndicesOffset=copyToArena(primitiveIndices,size_t(primitiveCount)*sizeof(unsigned));
+   _drawables.push_back(DrawableRecord{mesh,matrixList,stateSet,primitiveCount,primitiveIndicesOffset,
+                                       glm::vec3(0.f),-1.f,0,DrawableId(nullptr)});
+   return DrawableHandle(_drawables.size()-1);
+}
+
+
+/** Replays the recorded operations on the RenderingContext.
+ *
+ *  It must be called on the rendering thread, usually by
+ *  RenderingContext::commitSceneRecorders(). Afterwards, the arena is released,
+ *  drawableId() and stateSet() become valid and committed() returns true.
+ */
+void SceneRecorder::commit(RenderingContext *rc)
+{
+   if(committed()) {
+      cerr<<"SceneRecorder::commit(): The recorder was already committed."<<endl;
+      return;
+   }
+
+   // meshes
+   vector<bool> meshValid(_meshes.size(),false);
+   vector<const void*> attribList;
+   vector<Primitive> primitiveList;
+   for(size_t i=0,c=_meshes.size(); i<c; i++)
+   {
+      MeshRecord &r=_meshes[i];
+      AttribConfig attribConfig=rc->getAttribConfig(r.config);
+      if(!rc->allocVertexData(*r.mesh,attribConfig,r.numVertices,r.numIndices) ||
+         !rc->allocPrimitives(*r.mesh,r.numPrimitives))
+      {
+         cerr<<"SceneRecorder::commit(): Failed to allocate data of mesh "<<i<<"."<<endl;
+         rc->freeVertexData(*r.mesh);
+         continue;
+      }
+      meshValid[i]=true;
+
+      // vertices and indices
+      attribList.clear();
+      size_t offset=r.verticesOffset;
+      for(auto& t : r.config.attribTypes) {
+         offset=(offset+7)&~size_t(7);
+         attribList.push_back(_arena.data()+offset);
+         offset+=size_t(t.elementSize())*r.numVertices;
+      }
+      if(r.numVertices!=0)
+         r.mesh->uploadEncodedVertices(attribList.data(),unsigned(attribList.size()),r.numVertices);
+      if(r.numIndices!=0)
+         r.mesh->uploadIndices(_arena.data()+r.indicesOffset,r.numIndices);
+
+      // primitives
+      // (vertex offsets are set in the uploaded copy, the arena is not modified)
+      PrimitiveGpuData *primitives=reinterpret_cast<PrimitiveGpuData*>(_arena.data()+r.primitivesOffset);
+      const unsigned *modesAndOffsets4=reinterpret_cast<const unsigned*>(_arena.data()+r.modesOffset);
+      primitiveList=RenderingContext::generatePrimitiveList(modesAndOffsets4,r.numPrimitives);
+      rc->setAndUploadPrimitives(*r.mesh,primitives,primitiveList.data(),r.numPrimitives);
+   }
+
+   // StateSets
+   for(auto& r : _stateSets)
+      if(r.glState) {
+         r.stateSet=rc->getOrCreateStateSet(r.glState.get());
+         r.glState.reset();
+      }
+
+   // Drawables
+   for(auto& r : _drawables)
+   {
+      if(!meshValid[r.mesh] || !_stateSets[r.stateSet].stateSet)
+         continue;
+      Mesh &mesh=*_meshes[r.mesh].mesh;
+      const unsigned *primitiveIndices=r.primitiveCount==0 ? nullptr :
+            reinterpret_cast<const unsigned*>(_arena.data()+r.primitiveIndicesOffset);
+      r.id=rc->createDrawable(mesh,primitiveIndices,r.primitiveCount,
+                              r.matrixList,_stateSets[r.stateSet].stateSet.get());
+      if(r.boundsRadius>=0.f)
+         rc->setDrawableBounds(r.id,r.boundsCenter,r.boundsRadius);
+      if(r.material!=0)
+         rc->setDrawableMaterial(r.id,r.material);
+   }
+
+   // release recorded data
+   _arena.clear();
+   _arena.shrink_to_fit();
+   _committed.store(true,memory_order_release);
+}
+
+
+/** Removes all the records and makes the recorder ready for the new recording.
+ *  Objects created by the previous commit are not affected.
+ */
+void SceneRecorder::clear()
+{
+   _arena.clear();
+   _meshes.clear();
+   _stateSets.clear();
+   _drawables.clear();
+   _committed.store(false,memory_order_relaxed);
+}
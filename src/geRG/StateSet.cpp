@@ -1,6 +1,7 @@
 #include <algorithm>
 #include <geRG/StateSet.h>
 #include <geRG/RenderingContext.h>
+#include <geRG/RenderProgram.h>
 #if _MSC_VER<1900
 # include <cstdlib>
 #endif
@@ -28,6 +29,33 @@ RenderingCommandData& RenderingCommandData::operator=(RenderingCommandData&& rhs
 }
 
 
+StateSet::~StateSet()
+{
+   // the StateSet is being removed from the tree
+   invalidateRenderPrograms();
+}
+
+
+/** Forces recompilation of all RenderPrograms of the current RenderingContext.
+ *
+ *  It is called on each change that makes compiled RenderProgram invalid,
+ *  e.g. modification of the command list or child list
+ *  or appearance of the first draw command of a particular primitive kind.
+ */
+void StateSet::invalidateRenderPrograms()
+{
+   RenderingContext *rc=RenderingContext::current().get();
+   if(rc)
+      rc->invalidateStateSetTopology();
+}
+
+
+void ge::rg::parentChildListChanged(StateSet*)
+{
+   StateSet::invalidateRenderPrograms();
+}
+
+
 void StateSet::incrementDrawCommandModeCounter(unsigned incrementAmount,unsigned mode,
                                                AttribStorageData &storageData)
 {
@@ -47,6 +75,7 @@ void StateSet::incrementDrawCommandModeCounter(unsigned incrementAmount,unsigned
       storageData.setIndexToRenderingData(glMode,unsigned(storageData.renderingData.size()));
       storageData.renderingData.emplace_back(0,glMode,newNum);
       RenderingContext::current()->stateSetStorage()->alloc(&storageData.renderingData.back().stateSetBufferOffset4);
+      invalidateRenderPrograms();
    }
    else
    {
@@ -88,6 +117,7 @@ void StateSet::decrementDrawCommandModeCounter(unsigned decrementAmount,unsigned
          storageData.renderingData[index]=std::move(storageData.renderingData[lastIndex]);
       }
       storageData.renderingData.pop_back();
+      invalidateRenderPrograms();
    }
 }
 
@@ -103,8 +133,10 @@ void StateSet::decrementDrawCommandModeCounter(unsigned decrementAmount,unsigned
 void StateSet::removeCommand(const std::shared_ptr<ge::core::Command>& command)
 {
    auto it=std::find(_commandList.begin(),_commandList.end(),command);
-   if(it!=_commandList.end())
+   if(it!=_commandList.end()) {
       _commandList.erase(it);
+      invalidateRenderPrograms();
+   }
 }
 
 
@@ -158,8 +190,27 @@ void StateSet::setupRendering()
 }
 
 
+/** Renders the StateSet by executing its command list.
+ *
+ *  If RenderingContext::renderProgramsEnabled() is set, the StateSet tree
+ *  is compiled into RenderProgram on the first call and after each change
+ *  of RenderingContext::stateSetTopologyVersion(). The program is executed
+ *  instead of walking the tree.
+ */
 void StateSet::render()
 {
+   RenderingContext *rc=RenderingContext::current().get();
+   if(rc->renderProgramsEnabled())
+   {
+      if(!_renderProgram)
+         _renderProgram=std::make_shared<RenderProgram>();
+      if(_renderProgram->version()!=rc->stateSetTopologyVersion())
+         _renderProgram->compile(this,rc->stateSetTopologyVersion());
+      _renderProgram->execute();
+      return;
+   }
+   _renderProgram.reset();
+
    if(_commandList.empty())
    {
       // if command list is empty, execute default render command
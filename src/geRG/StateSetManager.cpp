@@ -243,9 +243,12 @@ void StateSetDefaultGLState::init(const std::shared_ptr<StateSet>& ss,StateSetMa
              "requires size of colorTextureList to be 1 or 0.");
 
       // create colorTexturingMode uniform
+      // (built-in programs of material table take the mode from the material
+      // and they have no such uniform)
       ss->clearCommands();
-      ss->addCommand(make_shared<FlexibleUniform1i>("colorTexturingMode",
-                                                    colorTextureList.size()==0?0:1));
+      if(!RenderingContext::current()->materialTable())
+         ss->addCommand(make_shared<FlexibleUniform1i>("colorTexturingMode",
+                                                       colorTextureList.size()==0?0:1));
       ss->addRenderCommand();
 
       // store colorTextureList in temporary variable and leave it empty
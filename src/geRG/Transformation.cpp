@@ -27,6 +27,7 @@ void Transformation::uploadMatrix(const float *matrix)
 {
    float* buffer=RenderingContext::current()->cpuTransformationBuffer();
    memcpy(&buffer[gpuDataOffset64()*16],matrix,16*sizeof(float));
+   setDirty();
 }
 
 
@@ -44,9 +45,46 @@ float* Transformation::getMatrixPtr()
 }
 
 
+void Transformation::setDirty()
+{
+   // matrix shared by more Transformations changes all of them,
+   // we do not track them, so request full evaluation of transformation graph
+   if(_gpuDataOffsetPtr!=&_gpuDataOffset64)
+      RenderingContext::current()->invalidateTransformationGraph();
+
+   _dirtyFlags|=MATRIX_DIRTY;
+   setSubtreeDirtyOnParents();
+}
+
+
+/** Propagates SUBTREE_DIRTY flag to all parents up to the roots.
+ *  Propagation stops on already marked parents as their parents are marked already.
+ */
+void Transformation::setSubtreeDirtyOnParents()
+{
+   for(auto it=parentList().begin(); it!=parentList().end(); it++)
+   {
+      Transformation *p=*it;
+      if((p->_dirtyFlags&SUBTREE_DIRTY)==0) {
+         p->_dirtyFlags|=SUBTREE_DIRTY;
+         p->setSubtreeDirtyOnParents();
+      }
+   }
+}
+
+
+void Transformation::setMatrixList(std::shared_ptr<MatrixList>& matrixList)
+{
+   _matrixList=matrixList;
+   RenderingContext::current()->invalidateTransformationGraph();
+}
+
+
 Transformation::Transformation()
    : _gpuDataOffsetPtr(&_gpuDataOffset64)
    , _gpuDataOffset64(0)
+   , _matrixOffset64(0)
+   , _dirtyFlags(MATRIX_DIRTY)
 {
    allocTransformationGpuData();
 }
@@ -56,7 +94,10 @@ Transformation::Transformation(const Transformation &t,unsigned constructionFlag
    : enable_shared_from_this<Transformation>()
    , _gpuDataOffsetPtr(&_gpuDataOffset64)
    , _gpuDataOffset64(0)
+   , _matrixOffset64(0)
+   , _dirtyFlags(MATRIX_DIRTY)
 {
+   RenderingContext::current()->invalidateTransformationGraph();
    if((constructionFlags&SHARE_MATRIX)!=0)
       shareTransformationFrom(t);
    if((constructionFlags&SHARE_MATRIX_LIST)!=0)
@@ -68,13 +109,26 @@ Transformation::Transformation(const Transformation &t,unsigned constructionFlag
 
 Transformation::~Transformation()
 {
-   if(gpuDataOffset64()!=0)
-      RenderingContext::current()->transformationAllocationManager().free(_gpuDataOffsetPtr[0]);
+   // RenderingContext might be already released
+   // (scene graph destroyed after the context), no gpu data to free in that case
+   RenderingContext *rc=RenderingContext::current().get();
+   if(gpuDataOffset64()!=0 && rc)
+      rc->transformationAllocationManager().free(_gpuDataOffsetPtr[0]);
    if(_gpuDataOffsetPtr!=&_gpuDataOffset64) {
       if(--_gpuDataOffsetPtr[1]==0)
          delete reinterpret_cast<SharedDataOffset*>(_gpuDataOffsetPtr);
    }
    removeAllChildren();
+   if(rc)
+      rc->invalidateTransformationGraph();
+}
+
+
+void ge::rg::parentChildListChanged(Transformation*)
+{
+   RenderingContext *rc=RenderingContext::current().get();
+   if(rc)
+      rc->invalidateTransformationGraph();
 }
 
 
@@ -112,11 +166,15 @@ void Transformation::allocTransformationGpuData()
       // alloc gpu data
       transformationAllocationManager.alloc(&_gpuDataOffset64);
    }
+
+   RenderingContext::current()->invalidateTransformationGraph();
 }
 
 
 void Transformation::shareTransformationFrom(const Transformation &t)
 {
+   RenderingContext::current()->invalidateTransformationGraph();
+
    // test gpu data existence
    if(gpuDataOffset64()!=0)
    {
@@ -0,0 +1,784 @@
+#include <geSG/ImageProcessor.h>
+#include <geCore/ThreadPool.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <utility>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP>=2)
+# define GE_SG_USE_SSE
+# include <emmintrin.h>
+#endif
+
+using namespace std;
+using namespace ge::sg;
+
+
+
+namespace
+{
+   typedef unsigned char Pixel[4];
+
+   /// Tap of separable filter: source coordinate and its weight.
+   struct Tap
+   {
+      size_t index;
+      float weight;
+   };
+
+   float sinc(float x)
+   {
+      if(fabs(x)<1e-6f)
+         return 1.f;
+      const float pi=3.14159265358979f;
+      return sin(pi*x)/(pi*x);
+   }
+
+   /// Modified Bessel function of the first kind of order zero.
+   float besselI0(float x)
+   {
+      float sum=1.f,term=1.f;
+      for(int k=1; k<16; k++) {
+         term*=(x/(2.f*float(k)))*(x/(2.f*float(k)));
+         sum+=term;
+      }
+      return sum;
+   }
+
+   /**
+    * Computes taps of Kaiser-windowed sinc for each destination coordinate.
+    * Filter support is 3 destination texels wide.
+    */
+   vector<vector<Tap>> kaiserTaps(size_t srcSize,size_t dstSize)
+   {
+      const float alpha=4.f;
+      const float radius=1.5f;
+      const float scale=float(srcSize)/float(dstSize);
+      vector<vector<Tap>> taps(dstSize);
+      for(size_t i=0; i<dstSize; i++) {
+         const float center=(float(i)+0.5f)*scale;
+         const int first=int(floor(center-radius*scale));
+         const int last=int(ceil(center+radius*scale));
+         float sum=0.f;
+         for(int s=first; s<=last; s++) {
+            const float d=(float(s)+0.5f-center)/scale;
+            const float t=d/radius;
+            if(fabs(t)>=1.f)
+               continue;
+            const float w=sinc(d)*besselI0(alpha*sqrt(1.f-t*t))/besselI0(alpha);
+            taps[i].push_back({size_t(min(max(s,0),int(srcSize)-1)),w});
+            sum+=w;
+         }
+         for(auto &tap:taps[i])
+            tap.weight/=sum;
+      }
+      return taps;
+   }
+
+   /// Accumulates weighted RGBA pixels.
+   inline void accumulate(const float *src,const vector<Tap>& taps,size_t stride,float *dst)
+   {
+#if defined(GE_SG_USE_SSE)
+      __m128 sum=_mm_setzero_ps();
+      for(auto &tap:taps)
+         sum=_mm_add_ps(sum,_mm_mul_ps(_mm_loadu_ps(src+tap.index*stride),_mm_set1_ps(tap.weight)));
+      _mm_storeu_ps(dst,sum);
+#else
+      float sum[4]={0.f,0.f,0.f,0.f};
+      for(auto &tap:taps)
+         for(unsigned c=0; c<4; c++)
+            sum[c]+=src[tap.index*stride+c]*tap.weight;
+      memcpy(dst,sum,sizeof(sum));
+#endif
+   }
+
+   inline unsigned char toByte(float v)
+   {
+      return (unsigned char)(min(max(v+0.5f,0.f),255.f));
+   }
+
+   /// Averages 2x2 pixels of two rows into row of destination pixels.
+   void boxRow(const unsigned char *row0,const unsigned char *row1,size_t srcWidth,unsigned char *dst,size_t dstWidth)
+   {
+      size_t x=0;
+#if defined(GE_SG_USE_SSE)
+      if(srcWidth==dstWidth*2) {
+         const __m128i zero=_mm_setzero_si128();
+         const __m128i two=_mm_set1_epi16(2);
+         for(; x+4<=dstWidth; x+=4) {
+            __m128i r[2];
+            for(unsigned i=0; i<2; i++) {
+               // 4 source pixels of each row, vertical sums as 16-bit lanes
+               const __m128i a=_mm_loadu_si128((const __m128i*)(row0+x*8+i*16));
+               const __m128i b=_mm_loadu_si128((const __m128i*)(row1+x*8+i*16));
+               const __m128i lo=_mm_add_epi16(_mm_unpacklo_epi8(a,zero),_mm_unpacklo_epi8(b,zero));
+               const __m128i hi=_mm_add_epi16(_mm_unpackhi_epi8(a,zero),_mm_unpackhi_epi8(b,zero));
+               // horizontal sums of neighbouring pixels
+               const __m128i sum=_mm_add_epi16(_mm_unpacklo_epi64(lo,hi),_mm_unpackhi_epi64(lo,hi));
+               r[i]=_mm_srli_epi16(_mm_add_epi16(sum,two),2);
+            }
+            _mm_storeu_si128((__m128i*)(dst+x*4),_mm_packus_epi16(r[0],r[1]));
+         }
+      }
+#endif
+      for(; x<dstWidth; x++) {
+         const size_t x0=min(x*2,srcWidth-1);
+         const size_t x1=min(x*2+1,srcWidth-1);
+         for(unsigned c=0; c<4; c++)
+            dst[x*4+c]=(unsigned char)((row0[x0*4+c]+row0[x1*4+c]+row1[x0*4+c]+row1[x1*4+c]+2)>>2);
+      }
+   }
+
+   /// Reads 4x4 block of RGBA pixels, pixels outside of the level are clamped to the edge.
+   void fetchBlock(const ImageProcessor::Level& level,size_t bx,size_t by,Pixel block[16])
+   {
+      for(size_t y=0; y<4; y++)
+         for(size_t x=0; x<4; x++) {
+            const size_t sx=min(bx*4+x,level.width-1);
+            const size_t sy=min(by*4+y,level.height-1);
+            memcpy(block[y*4+x],&level.data[(sy*level.width+sx)*4],4);
+         }
+   }
+
+   void storeBlock(ImageProcessor::Level& level,size_t bx,size_t by,const Pixel block[16])
+   {
+      for(size_t y=0; y<4; y++)
+         for(size_t x=0; x<4; x++) {
+            const size_t dx=bx*4+x;
+            const size_t dy=by*4+y;
+            if(dx<level.width&&dy<level.height)
+               memcpy(&level.data[(dy*level.width+dx)*4],block[y*4+x],4);
+         }
+   }
+
+   unsigned distance(const unsigned char *a,const unsigned char *b,unsigned channels)
+   {
+      unsigned d=0;
+      for(unsigned c=0; c<channels; c++) {
+         const int e=int(a[c])-int(b[c]);
+         d+=unsigned(e*e);
+      }
+      return d;
+   }
+
+   /**
+    * Finds endpoints of block as extreme pixels along principal axis
+    * of the first channels of pixels.
+    */
+   void principalEndpoints(const Pixel block[16],unsigned channels,unsigned char e0[4],unsigned char e1[4])
+   {
+      float mean[4]={0.f,0.f,0.f,0.f};
+      for(unsigned i=0; i<16; i++)
+         for(unsigned c=0; c<channels; c++)
+            mean[c]+=block[i][c]/16.f;
+      float cov[4][4]={};
+      for(unsigned i=0; i<16; i++)
+         for(unsigned a=0; a<channels; a++)
+            for(unsigned b=0; b<channels; b++)
+               cov[a][b]+=(block[i][a]-mean[a])*(block[i][b]-mean[b]);
+
+      // power iteration starting from covariances of the channel with the largest variance,
+      // diagonal would be orthogonal to the axis of anti-correlated channels
+      unsigned largest=0;
+      for(unsigned c=1; c<channels; c++)
+         if(cov[c][c]>cov[largest][largest])
+            largest=c;
+      float axis[4]={0.f,0.f,0.f,0.f};
+      for(unsigned c=0; c<channels; c++)
+         axis[c]=cov[largest][c];
+      for(unsigned it=0; it<8; it++) {
+         float next[4]={0.f,0.f,0.f,0.f};
+         float len=0.f;
+         for(unsigned a=0; a<channels; a++) {
+            for(unsigned b=0; b<channels; b++)
+               next[a]+=cov[a][b]*axis[b];
+            len=max(len,fabs(next[a]));
+         }
+         if(len==0.f)
+            break;
+         for(unsigned a=0; a<channels; a++)
+            axis[a]=next[a]/len;
+      }
+
+      float minT=0.f,maxT=0.f;
+      unsigned minI=0,maxI=0;
+      for(unsigned i=0; i<16; i++) {
+         float t=0.f;
+         for(unsigned c=0; c<channels; c++)
+            t+=(block[i][c]-mean[c])*axis[c];
+         if(i==0||t<minT) { minT=t; minI=i; }
+         if(i==0||t>maxT) { maxT=t; maxI=i; }
+      }
+      memcpy(e0,block[maxI],4);
+      memcpy(e1,block[minI],4);
+   }
+
+   /**
+    * Fits endpoints to pixels by least squares for given indices, weights are positions
+    * of palette entries between the first (0) and the second (1) endpoint.
+    *
+    * @return false if the system is singular (all pixels use the same weight)
+    */
+   bool refitEndpoints(const Pixel block[16],unsigned channels,const unsigned indices[16],const float *weights,
+                       unsigned char e0[4],unsigned char e1[4])
+   {
+      float aa=0.f,ab=0.f,bb=0.f;
+      float ax[4]={0.f,0.f,0.f,0.f},bx[4]={0.f,0.f,0.f,0.f};
+      for(unsigned i=0; i<16; i++) {
+         const float b=weights[indices[i]];
+         const float a=1.f-b;
+         aa+=a*a;
+         ab+=a*b;
+         bb+=b*b;
+         for(unsigned c=0; c<channels; c++) {
+            ax[c]+=a*block[i][c];
+            bx[c]+=b*block[i][c];
+         }
+      }
+      const float det=aa*bb-ab*ab;
+      if(fabs(det)<1e-6f)
+         return false;
+      for(unsigned c=0; c<channels; c++) {
+         e0[c]=toByte((ax[c]*bb-bx[c]*ab)/det);
+         e1[c]=toByte((bx[c]*aa-ax[c]*ab)/det);
+      }
+      for(unsigned c=channels; c<4; c++)
+         e0[c]=e1[c]=255;
+      return true;
+   }
+
+   unsigned short to565(const unsigned char *c)
+   {
+      return (unsigned short)(((c[0]*31+127)/255)<<11|((c[1]*63+127)/255)<<5|((c[2]*31+127)/255));
+   }
+
+   void from565(unsigned short v,unsigned char *c)
+   {
+      const unsigned r=(v>>11)&31,g=(v>>5)&63,b=v&31;
+      c[0]=(unsigned char)(r<<3|r>>2);
+      c[1]=(unsigned char)(g<<2|g>>4);
+      c[2]=(unsigned char)(b<<3|b>>2);
+      c[3]=255;
+   }
+
+   void bc1Palette(unsigned short c0,unsigned short c1,bool fourColors,Pixel palette[4])
+   {
+      from565(c0,palette[0]);
+      from565(c1,palette[1]);
+      for(unsigned c=0; c<3; c++) {
+         if(fourColors||c0>c1) {
+            palette[2][c]=(unsigned char)((2*palette[0][c]+palette[1][c]+1)/3);
+            palette[3][c]=(unsigned char)((palette[0][c]+2*palette[1][c]+1)/3);
+         }
+         else {
+            palette[2][c]=(unsigned char)((palette[0][c]+palette[1][c]+1)/2);
+            palette[3][c]=0;
+         }
+      }
+      palette[2][3]=255;
+      palette[3][3]=(fourColors||c0>c1)?255:0;
+   }
+
+   /**
+    * Orders endpoints for four color mode and chooses the nearest palette entries.
+    *
+    * @return squared error of the block
+    */
+   unsigned bc1Indices(const Pixel block[16],unsigned short &c0,unsigned short &c1,unsigned indices[16])
+   {
+      if(c0<c1)
+         swap(c0,c1);
+      Pixel palette[4];
+      bc1Palette(c0,c1,true,palette);
+      const unsigned numEntries=c0==c1?1:4;
+      unsigned error=0;
+      for(unsigned i=0; i<16; i++) {
+         unsigned bestDistance=~0u;
+         for(unsigned p=0; p<numEntries; p++) {
+            const unsigned d=distance(block[i],palette[p],3);
+            if(d<bestDistance) { bestDistance=d; indices[i]=p; }
+         }
+         error+=bestDistance;
+      }
+      return error;
+   }
+
+   const float bc1Weights[4]={0.f,1.f,1.f/3.f,2.f/3.f};
+
+   void encodeBC1(const Pixel block[16],unsigned char *out)
+   {
+      unsigned char e0[4],e1[4];
+      principalEndpoints(block,3,e0,e1);
+      unsigned short c0=to565(e0),c1=to565(e1);
+      unsigned indices[16];
+      const unsigned error=bc1Indices(block,c0,c1,indices);
+      if(error>0&&refitEndpoints(block,3,indices,bc1Weights,e0,e1)) {
+         unsigned short r0=to565(e0),r1=to565(e1);
+         unsigned refitted[16];
+         if(bc1Indices(block,r0,r1,refitted)<error) {
+            c0=r0;
+            c1=r1;
+            memcpy(indices,refitted,sizeof(indices));
+         }
+      }
+      uint32_t bits=0;
+      for(unsigned i=0; i<16; i++)
+         bits|=uint32_t(indices[i])<<(i*2);
+      out[0]=(unsigned char)(c0&0xff); out[1]=(unsigned char)(c0>>8);
+      out[2]=(unsigned char)(c1&0xff); out[3]=(unsigned char)(c1>>8);
+      for(unsigned i=0; i<4; i++)
+         out[4+i]=(unsigned char)(bits>>(i*8));
+   }
+
+   void decodeBC1(const unsigned char *in,bool fourColors,Pixel block[16])
+   {
+      const unsigned short c0=(unsigned short)(in[0]|in[1]<<8);
+      const unsigned short c1=(unsigned short)(in[2]|in[3]<<8);
+      Pixel palette[4];
+      bc1Palette(c0,c1,fourColors,palette);
+      const uint32_t indices=uint32_t(in[4])|uint32_t(in[5])<<8|uint32_t(in[6])<<16|uint32_t(in[7])<<24;
+      for(unsigned i=0; i<16; i++)
+         memcpy(block[i],palette[(indices>>(i*2))&3],4);
+   }
+
+   void alphaPalette(unsigned char a0,unsigned char a1,unsigned char palette[8])
+   {
+      palette[0]=a0;
+      palette[1]=a1;
+      if(a0>a1)
+         for(unsigned k=1; k<7; k++)
+            palette[k+1]=(unsigned char)(((7-k)*a0+k*a1+3)/7);
+      else {
+         for(unsigned k=1; k<5; k++)
+            palette[k+1]=(unsigned char)(((5-k)*a0+k*a1+2)/5);
+         palette[6]=0;
+         palette[7]=255;
+      }
+   }
+
+   void encodeBC3(const Pixel block[16],unsigned char *out)
+   {
+      unsigned char a0=0,a1=255;
+      for(unsigned i=0; i<16; i++) {
+         a0=max(a0,block[i][3]);
+         a1=min(a1,block[i][3]);
+      }
+      uint64_t indices=0;
+      if(a0!=a1) {
+         unsigned char palette[8];
+         alphaPalette(a0,a1,palette);
+         for(unsigned i=0; i<16; i++) {
+            unsigned best=0,bestDistance=~0u;
+            for(unsigned p=0; p<8; p++) {
+               const unsigned d=unsigned(abs(int(block[i][3])-int(palette[p])));
+               if(d<bestDistance) { bestDistance=d; best=p; }
+            }
+            indices|=uint64_t(best)<<(i*3);
+         }
+      }
+      out[0]=a0;
+      out[1]=a1;
+      for(unsigned i=0; i<6; i++)
+         out[2+i]=(unsigned char)(indices>>(i*8));
+      encodeBC1(block,out+8);
+   }
+
+   void decodeBC3(const unsigned char *in,Pixel block[16])
+   {
+      decodeBC1(in+8,true,block);
+      unsigned char palette[8];
+      alphaPalette(in[0],in[1],palette);
+      uint64_t indices=0;
+      for(unsigned i=0; i<6; i++)
+         indices|=uint64_t(in[2+i])<<(i*8);
+      for(unsigned i=0; i<16; i++)
+         block[i][3]=palette[(indices>>(i*3))&7];
+   }
+
+   /// Writes and reads bit fields of 128-bit block, LSB first.
+   class BitStream
+   {
+   public:
+      BitStream(unsigned char *data) : _data(data),_position(0) {}
+      void write(unsigned value,unsigned bits)
+      {
+         for(unsigned i=0; i<bits; i++,_position++)
+            if(value&(1u<<i))
+               _data[_position/8]|=(unsigned char)(1u<<(_position%8));
+      }
+      unsigned read(unsigned bits)
+      {
+         unsigned value=0;
+         for(unsigned i=0; i<bits; i++,_position++)
+            value|=unsigned((_data[_position/8]>>(_position%8))&1)<<i;
+         return value;
+      }
+   protected:
+      unsigned char *_data;
+      unsigned _position;
+   };
+
+   const unsigned bc7Weights4[16]={0,4,9,13,17,21,26,30,34,38,43,47,51,55,60,64};
+
+   /// Quantizes endpoint into 7 bits per channel with shared p-bit.
+   void quantizeBC7(const unsigned char e[4],unsigned char q[4],unsigned &pbit)
+   {
+      unsigned bestError=~0u;
+      for(unsigned p=0; p<2; p++) {
+         unsigned char candidate[4];
+         unsigned error=0;
+         for(unsigned c=0; c<4; c++) {
+            const int v=min(max((int(e[c])-int(p)+1)/2,0),127);
+            candidate[c]=(unsigned char)v;
+            const int d=int(e[c])-int(v<<1|p);
+            error+=unsigned(d*d);
+         }
+         if(error<bestError) {
+            bestError=error;
+            memcpy(q,candidate,4);
+            pbit=p;
+         }
+      }
+   }
+
+   void bc7Palette(const unsigned char q0[4],unsigned p0,const unsigned char q1[4],unsigned p1,Pixel palette[16])
+   {
+      for(unsigned i=0; i<16; i++)
+         for(unsigned c=0; c<4; c++) {
+            const unsigned e0=unsigned(q0[c])<<1|p0;
+            const unsigned e1=unsigned(q1[c])<<1|p1;
+            palette[i][c]=(unsigned char)(((64-bc7Weights4[i])*e0+bc7Weights4[i]*e1+32)>>6);
+         }
+   }
+
+   /**
+    * Encodes block in BC7 mode 6: single subset, RGBA endpoints
+    * with 7 bits per channel and p-bit, 4-bit indices.
+    */
+   struct BC7Endpoints
+   {
+      unsigned char q0[4],q1[4];
+      unsigned p0,p1;
+      unsigned indices[16];
+   };
+
+   /**
+    * Quantizes endpoints and chooses the nearest palette entries.
+    *
+    * @return squared error of the block
+    */
+   unsigned bc7Fit(const Pixel block[16],const unsigned char e0[4],const unsigned char e1[4],BC7Endpoints &result)
+   {
+      quantizeBC7(e0,result.q0,result.p0);
+      quantizeBC7(e1,result.q1,result.p1);
+      Pixel palette[16];
+      bc7Palette(result.q0,result.p0,result.q1,result.p1,palette);
+      unsigned error=0;
+      for(unsigned i=0; i<16; i++) {
+         unsigned bestDistance=~0u;
+         for(unsigned p=0; p<16; p++) {
+            const unsigned d=distance(block[i],palette[p],4);
+            if(d<bestDistance) { bestDistance=d; result.indices[i]=p; }
+         }
+         error+=bestDistance;
+      }
+      return error;
+   }
+
+   void encodeBC7(const Pixel block[16],unsigned char *out)
+   {
+      unsigned char e0[4],e1[4];
+      principalEndpoints(block,4,e0,e1);
+      BC7Endpoints fit;
+      const unsigned error=bc7Fit(block,e0,e1,fit);
+      float weights[16];
+      for(unsigned i=0; i<16; i++)
+         weights[i]=float(bc7Weights4[i])/64.f;
+      if(error>0&&refitEndpoints(block,4,fit.indices,weights,e0,e1)) {
+         BC7Endpoints refitted;
+         if(bc7Fit(block,e0,e1,refitted)<error)
+            fit=refitted;
+      }
+      // the most significant bit of the first index is implicit zero
+      if(fit.indices[0]&8) {
+         swap(fit.q0,fit.q1);
+         swap(fit.p0,fit.p1);
+         for(unsigned i=0; i<16; i++)
+            fit.indices[i]=15-fit.indices[i];
+      }
+      memset(out,0,16);
+      BitStream stream(out);
+      stream.write(1<<6,7);
+      for(unsigned c=0; c<4; c++) {
+         stream.write(fit.q0[c],7);
+         stream.write(fit.q1[c],7);
+      }
+      stream.write(fit.p0,1);
+      stream.write(fit.p1,1);
+      stream.write(fit.indices[0],3);
+      for(unsigned i=1; i<16; i++)
+         stream.write(fit.indices[i],4);
+   }
+
+   /// Decodes BC7 block, only mode 6 is supported, other modes are decoded as transparent black.
+   void decodeBC7(const unsigned char *in,Pixel block[16])
+   {
+      unsigned char data[16];
+      memcpy(data,in,16);
+      BitStream stream(data);
+      if(stream.read(7)!=1<<6) {
+         memset(block,0,sizeof(Pixel)*16);
+         return;
+      }
+      unsigned char q0[4],q1[4];
+      for(unsigned c=0; c<4; c++) {
+         q0[c]=(unsigned char)stream.read(7);
+         q1[c]=(unsigned char)stream.read(7);
+      }
+      const unsigned p0=stream.read(1);
+      const unsigned p1=stream.read(1);
+      Pixel palette[16];
+      bc7Palette(q0,p0,q1,p1,palette);
+      memcpy(block[0],palette[stream.read(3)],4);
+      for(unsigned i=1; i<16; i++)
+         memcpy(block[i],palette[stream.read(4)],4);
+   }
+}
+
+
+
+ImageProcessor::ImageProcessor(const shared_ptr<ge::core::ThreadPool>& threadPool)
+   : _threadPool(threadPool)
+{
+}
+
+
+/**
+ * Executes task for each index in <0,numTasks) on the thread pool,
+ * or on the calling thread if there is no thread pool.
+ */
+void ImageProcessor::parallelFor(size_t numTasks,const function<void(size_t)>& task) const
+{
+   if(_threadPool)
+      _threadPool->parallelFor(unsigned(numTasks),[&task](unsigned i) { task(i); });
+   else
+      for(size_t i=0; i<numTasks; i++)
+         task(i);
+}
+
+
+/**
+ * Converts image of unsigned bytes into tightly packed RGBA8 level.
+ * Missing color channels are zero, missing alpha is 255. Rows of the image
+ * may be padded (as rows of FreeImage images are).
+ *
+ * @return false if the format or data type of the image is not supported
+ */
+bool ImageProcessor::toRGBA8(Image& image,Level& level)
+{
+   if(image.getDataType()!=Image::DataType::UNSIGNED_BYTE)
+      return false;
+   unsigned channels;
+   const unsigned *order;
+   static const unsigned rgba[4]={0,1,2,3};
+   static const unsigned bgra[4]={2,1,0,3};
+   switch(image.getFormat())
+   {
+      case Image::Format::R: channels=1; order=rgba; break;
+      case Image::Format::RG: channels=2; order=rgba; break;
+      case Image::Format::RGB: channels=3; order=rgba; break;
+      case Image::Format::BGR: channels=3; order=bgra; break;
+      case Image::Format::RGBA: channels=4; order=rgba; break;
+      case Image::Format::BGRA: channels=4; order=bgra; break;
+      default: return false;
+   }
+   const size_t width=image.getWidth();
+   const size_t height=image.getHeight();
+   const unsigned char *bits=image.getBits();
+   if(width==0||height==0||bits==nullptr)
+      return false;
+   const size_t stride=max(image.getSizeInBytes()/height,width*channels);
+
+   level.width=width;
+   level.height=height;
+   level.data.assign(width*height*4,0);
+   for(size_t y=0; y<height; y++)
+      for(size_t x=0; x<width; x++) {
+         const unsigned char *src=bits+y*stride+x*channels;
+         unsigned char *dst=&level.data[(y*width+x)*4];
+         dst[3]=255;
+         for(unsigned c=0; c<channels; c++)
+            dst[order[c]]=src[c];
+      }
+   return true;
+}
+
+
+/**
+ * Generates complete mip chain of the image.
+ *
+ * @return levels from the image down to 1x1, empty if the image is not supported
+ */
+vector<ImageProcessor::Level> ImageProcessor::generateMipmaps(Image& image,Filter filter) const
+{
+   Level level;
+   if(!toRGBA8(image,level))
+      return vector<Level>();
+   return generateMipmaps(level,filter);
+}
+
+
+/**
+ * Generates complete mip chain of RGBA8 level.
+ *
+ * @return levels from the given one down to 1x1
+ */
+vector<ImageProcessor::Level> ImageProcessor::generateMipmaps(const Level& level,Filter filter) const
+{
+   vector<Level> levels;
+   levels.push_back(level);
+   while(levels.back().width>1||levels.back().height>1)
+      levels.push_back(downsample(levels.back(),filter));
+   return levels;
+}
+
+
+/**
+ * Computes the next mip level of RGBA8 level, its size is half of the size (rounded down, at least 1).
+ */
+ImageProcessor::Level ImageProcessor::downsample(const Level& level,Filter filter) const
+{
+   Level result;
+   result.width=max<size_t>(level.width/2,1);
+   result.height=max<size_t>(level.height/2,1);
+   result.data.resize(result.width*result.height*4);
+   const size_t numTiles=(result.height+tileRows-1)/tileRows;
+
+   if(filter==Filter::BOX) {
+      parallelFor(numTiles,[&](size_t tile) {
+         const size_t last=min((tile+1)*tileRows,result.height);
+         for(size_t y=tile*tileRows; y<last; y++) {
+            const size_t y0=min(y*2,level.height-1);
+            const size_t y1=min(y*2+1,level.height-1);
+            boxRow(&level.data[y0*level.width*4],&level.data[y1*level.width*4],level.width,
+                   &result.data[y*result.width*4],result.width);
+         }
+      });
+      return result;
+   }
+
+   // separable Kaiser filter, horizontal pass into floats, then vertical pass
+   const vector<vector<Tap>> horizontal=kaiserTaps(level.width,result.width);
+   const vector<vector<Tap>> vertical=kaiserTaps(level.height,result.height);
+   vector<float> temp(result.width*level.height*4);
+   parallelFor((level.height+tileRows-1)/tileRows,[&](size_t tile) {
+      vector<float> row(level.width*4);
+      const size_t last=min((tile+1)*tileRows,level.height);
+      for(size_t y=tile*tileRows; y<last; y++) {
+         for(size_t i=0; i<row.size(); i++)
+            row[i]=level.data[y*level.width*4+i];
+         for(size_t x=0; x<result.width; x++)
+            accumulate(row.data(),horizontal[x],4,&temp[(y*result.width+x)*4]);
+      }
+   });
+   parallelFor(numTiles,[&](size_t tile) {
+      const size_t last=min((tile+1)*tileRows,result.height);
+      for(size_t y=tile*tileRows; y<last; y++)
+         for(size_t x=0; x<result.width; x++) {
+            float pixel[4];
+            accumulate(&temp[x*4],vertical[y],result.width*4,pixel);
+            for(unsigned c=0; c<4; c++)
+               result.data[(y*result.width+x)*4+c]=toByte(pixel[c]);
+         }
+   });
+   return result;
+}
+
+
+/// Returns number of bytes of one 4x4 block.
+size_t ImageProcessor::getBlockSize(BlockFormat format)
+{
+   return format==BlockFormat::BC1?8:16;
+}
+
+
+size_t ImageProcessor::getCompressedSize(size_t width,size_t height,BlockFormat format)
+{
+   return ((width+3)/4)*((height+3)/4)*getBlockSize(format);
+}
+
+
+/**
+ * Compresses RGBA8 level into 4x4 blocks. BC1 ignores alpha, BC3 stores
+ * interpolated alpha, BC7 uses mode 6 (single subset RGBA) for all blocks.
+ * Rows of blocks are compressed in parallel.
+ */
+ImageProcessor::Level ImageProcessor::compress(const Level& level,BlockFormat format) const
+{
+   Level result;
+   result.width=level.width;
+   result.height=level.height;
+   result.data.assign(getCompressedSize(level.width,level.height,format),0);
+   const size_t blocksX=(level.width+3)/4;
+   const size_t blocksY=(level.height+3)/4;
+   const size_t blockSize=getBlockSize(format);
+   parallelFor(blocksY,[&](size_t by) {
+      Pixel block[16];
+      for(size_t bx=0; bx<blocksX; bx++) {
+         fetchBlock(level,bx,by,block);
+         unsigned char *out=&result.data[(by*blocksX+bx)*blockSize];
+         switch(format)
+         {
+            case BlockFormat::BC1: encodeBC1(block,out); break;
+            case BlockFormat::BC3: encodeBC3(block,out); break;
+            case BlockFormat::BC7: encodeBC7(block,out); break;
+         }
+      }
+   });
+   return result;
+}
+
+
+vector<ImageProcessor::Level> ImageProcessor::compress(const vector<Level>& levels,BlockFormat format) const
+{
+   vector<Level> result;
+   result.reserve(levels.size());
+   for(auto &level:levels)
+      result.push_back(compress(level,format));
+   return result;
+}
+
+
+/**
+ * Decompresses level produced by compress() back into RGBA8, it can be used
+ * when the compressed format is not supported by the hardware.
+ * BC7 blocks of other modes than 6 are decoded as transparent black.
+ */
+ImageProcessor::Level ImageProcessor::decompress(const Level& level,BlockFormat format) const
+{
+   Level result;
+   result.width=level.width;
+   result.height=level.height;
+   result.data.resize(level.width*level.height*4);
+   const size_t blocksX=(level.width+3)/4;
+   const size_t blocksY=(level.height+3)/4;
+   const size_t blockSize=getBlockSize(format);
+   if(level.data.size()<blocksX*blocksY*blockSize)
+      return Level();
+   parallelFor(blocksY,[&](size_t by) {
+      Pixel block[16];
+      for(size_t bx=0; bx<blocksX; bx++) {
+         const unsigned char *in=&level.data[(by*blocksX+bx)*blockSize];
+         switch(format)
+         {
+            case BlockFormat::BC1: decodeBC1(in,false,block); break;
+            case BlockFormat::BC3: decodeBC3(in,block); break;
+            case BlockFormat::BC7: decodeBC7(in,block); break;
+         }
+         storeBlock(result,bx,by,block);
+      }
+   });
+   return result;
+}
@@ -0,0 +1,204 @@
+#include<geRG/AllocationManagers.h>
+
+#define CATCH_CONFIG_MAIN
+#include"catch.hpp"
+
+using namespace ge::rg;
+using namespace std;
+
+
+
+struct Owner {};
+
+
+
+SCENARIO("ArrayAllocationManager free block reuse") {
+
+   GIVEN("manager with three allocated arrays and free space at the end") {
+      ArrayAllocationManager<Owner> m(100,1);
+      Owner o;
+      unsigned a=m.alloc(10,o);
+      unsigned b=m.alloc(20,o);
+      unsigned c=m.alloc(30,o);
+      REQUIRE(m.available()==39);
+      REQUIRE(m.numItemsAvailableAtTheEnd()==39);
+
+      WHEN("freeing the array in the middle") {
+         m.free(b);
+         THEN("it becomes free block and is reused by smaller allocation") {
+            REQUIRE(m.numFreeBlocks()==1);
+            REQUIRE(m.numItemsInFreeBlocks()==20);
+            REQUIRE(m.largestFreeBlock()==20);
+            REQUIRE(m.available()==59);
+            unsigned d=m.alloc(15,o);
+            REQUIRE(m[d].startIndex==11);
+            REQUIRE(m.numFreeBlocks()==1);
+            REQUIRE(m.largestFreeBlock()==5);
+            REQUIRE(m.numItemsAvailableAtTheEnd()==39);
+         }
+      }
+
+      WHEN("freeing two neighbouring arrays") {
+         m.free(a);
+         m.free(b);
+         THEN("they are merged into single block") {
+            REQUIRE(m.numFreeBlocks()==1);
+            REQUIRE(m.largestFreeBlock()==30);
+            REQUIRE(m.largestAvailable()==39);
+            unsigned d=m.alloc(30,o);
+            REQUIRE(m[d].startIndex==1);
+            REQUIRE(m.numFreeBlocks()==0);
+            REQUIRE(m[d].nextRec==c);
+            REQUIRE(m[c].prevRec==d);
+         }
+      }
+
+      WHEN("freeing the last array") {
+         m.free(b);
+         m.free(c);
+         THEN("all free space at the end is merged") {
+            REQUIRE(m.numFreeBlocks()==0);
+            REQUIRE(m.numItemsAvailableAtTheEnd()==89);
+            REQUIRE(m.firstItemAvailableAtTheEnd()==11);
+            REQUIRE(m.idOfArrayAtTheEnd()==a);
+            REQUIRE(m[a].nextRec==0);
+            REQUIRE(m.fragmentation()==0.f);
+         }
+      }
+
+      WHEN("allocating and freeing repeatedly") {
+         m.free(b);
+         for(unsigned i=0; i<1000; i++) {
+            unsigned d=m.alloc(5+i%16,o);
+            m.free(d);
+         }
+         THEN("the memory does not grow and ids are recycled") {
+            REQUIRE(m.available()==59);
+            REQUIRE(m.numItemsAvailableAtTheEnd()==39);
+            REQUIRE(m.largestFreeBlock()==20);
+            REQUIRE(unsigned(m.end()-m.begin())<=4);
+         }
+      }
+   }
+}
+
+
+
+SCENARIO("ArrayAllocationManager compaction") {
+
+   GIVEN("fragmented manager with array content in host memory") {
+      ArrayAllocationManager<Owner> m(100,1);
+      vector<unsigned> data(100,0);
+      Owner o;
+      unsigned ids[6];
+      for(unsigned i=0; i<6; i++) {
+         ids[i]=m.alloc(10+i,o);
+         for(unsigned j=0; j<10+i; j++)
+            data[m[ids[i]].startIndex+j]=i*100+j;
+      }
+      m.free(ids[0]);
+      m.free(ids[2]);
+      m.free(ids[4]);
+      REQUIRE(m.numFreeBlocks()==3);
+
+      unsigned numCopyCalls=0;
+      auto copy=[&data,&numCopyCalls](unsigned src,unsigned dst,unsigned num) {
+         REQUIRE(dst<src);
+         for(unsigned i=0; i<num; i++)  // ascending order handles overlap as memmove
+            data[dst+i]=data[src+i];
+         numCopyCalls++;
+      };
+      unsigned numMovedCalls=0;
+      unsigned numMovedItems=0;
+      auto moved=[&numMovedCalls,&numMovedItems,&m](unsigned id,unsigned oldStartIndex) {
+         REQUIRE(m[id].startIndex<oldStartIndex);
+         numMovedCalls++;
+         numMovedItems+=m[id].numItems;
+      };
+
+      WHEN("compacting without limit") {
+         unsigned n=m.compact(100,copy,moved);
+         THEN("all free blocks are removed and content is preserved") {
+            REQUIRE(n==11+13+15);
+            REQUIRE(numMovedCalls==3);
+            REQUIRE(numCopyCalls==3);
+            REQUIRE(numMovedItems==n);
+            REQUIRE(m.numFreeBlocks()==0);
+            REQUIRE(m.numItemsAvailableAtTheEnd()==m.available());
+            REQUIRE(m.fragmentation()==0.f);
+            REQUIRE(m[ids[1]].startIndex==1);
+            REQUIRE(m[ids[3]].startIndex==12);
+            REQUIRE(m[ids[5]].startIndex==25);
+            for(unsigned i=1; i<6; i+=2)
+               for(unsigned j=0; j<10+i; j++)
+                  REQUIRE(data[m[ids[i]].startIndex+j]==i*100+j);
+         }
+      }
+
+      WHEN("compacting with limit") {
+         unsigned n=m.compact(20,copy,moved);
+         THEN("only arrays fitting into the limit are moved") {
+            REQUIRE(n==11);
+            REQUIRE(numMovedCalls==1);
+            REQUIRE(m.numFreeBlocks()==2);
+            REQUIRE(m.largestFreeBlock()==22);
+         }
+      }
+   }
+}
+
+
+SCENARIO("ArrayAllocationManager with zero-size and large arrays") {
+
+   Owner o;
+   auto copy=[](unsigned,unsigned,unsigned) {};
+   auto moved=[](unsigned,unsigned) {};
+
+   GIVEN("zero-size array between two arrays") {
+      ArrayAllocationManager<Owner> m(100,1);
+      unsigned a=m.alloc(10,o);
+      unsigned z=m.alloc(0,o);
+      unsigned b=m.alloc(10,o);
+
+      WHEN("the zero-size array is freed") {
+         m.free(z);
+         THEN("no free block is created and compaction terminates") {
+            REQUIRE(m.numFreeBlocks()==0);
+            REQUIRE(m[a].nextRec==b);
+            REQUIRE(m[b].prevRec==a);
+            REQUIRE(m.compact(100,copy,moved)==0);
+         }
+      }
+
+      WHEN("the zero-size array is freed after its neighbour") {
+         m.free(a);
+         m.free(z);
+         THEN("it is merged into the free block") {
+            REQUIRE(m.numFreeBlocks()==1);
+            REQUIRE(m.largestFreeBlock()==10);
+            REQUIRE(m.compact(100,copy,moved)==10);
+            REQUIRE(m[b].startIndex==1);
+         }
+      }
+   }
+
+   GIVEN("large array behind small free block") {
+      ArrayAllocationManager<Owner> m(100000,1);
+      unsigned a=m.alloc(1,o);
+      unsigned b=m.alloc(90000,o);
+      m.free(a);
+      unsigned numCopyCalls=0;
+      auto countingCopy=[&numCopyCalls](unsigned src,unsigned dst,unsigned num) {
+         REQUIRE(src==2);
+         REQUIRE(dst==1);
+         REQUIRE(num==90000);
+         numCopyCalls++;
+      };
+
+      THEN("the array is moved by a single copy") {
+         REQUIRE(m.compact(100000,countingCopy,moved)==90000);
+         REQUIRE(numCopyCalls==1);
+         REQUIRE(m[b].startIndex==1);
+      }
+   }
+}
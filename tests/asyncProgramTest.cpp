@@ -0,0 +1,122 @@
+#include<memory>
+#include<vector>
+#include<geGL/geGL.h>
+#include<geGL/NullLoader.h>
+#include<geGL/LoaderTableDecorator.h>
+#include<geGL/ProfilingTableDecorator.h>
+
+#define CATCH_CONFIG_MAIN
+#include"catch.hpp"
+
+using namespace ge::gl;
+using namespace std;
+
+
+
+static const char*vertexSource="#version 450\nuniform mat4 mvp;\nin vec3 position;\nvoid main(){gl_Position=mvp*vec4(position,1);}\n";
+static const char*fragmentSource="#version 450\nuniform vec4 color;\nout vec4 fColor;\nvoid main(){fColor=color;}\n";
+
+using Table=ProfilingTableDecorator<LoaderTableDecorator<FunctionTable>>;
+
+
+SCENARIO( "Programs are compiled and linked asynchronously", "[Program]" )
+{
+   auto loader=make_shared<NullLoader>();
+   auto profiled=make_shared<Table>(loader);
+   profiled->construct();
+   FunctionTablePointer table=profiled;
+   auto &profiler=profiled->profiler;
+   size_t getActiveUniform=profiler.findFunction("glGetActiveUniform");
+   size_t getProgramiv=profiler.findFunction("glGetProgramiv");
+   size_t getShaderiv=profiler.findFunction("glGetShaderiv");
+
+   GIVEN( "parallel shader compilation" ) {
+
+      REQUIRE( Shader::isParallelCompileSupported(Context(table)) );
+      Shader::setMaxCompilerThreads(Context(table),4);
+      REQUIRE( loader->getInteger(GL_MAX_SHADER_COMPILER_THREADS_ARB)==4 );
+      loader->setCompileLatency(2);
+
+      WHEN( "many programs are compiled and linked" ) {
+         vector<shared_ptr<Program>> programs;
+         for(int i=0; i<8; i++) {
+            auto vs=make_shared<Shader>(table);
+            auto fs=make_shared<Shader>(table);
+            vs->create(GL_VERTEX_SHADER);
+            fs->create(GL_FRAGMENT_SHADER);
+            vs->compileAsync({vertexSource});
+            fs->compileAsync({fragmentSource});
+            auto program=make_shared<Program>(table);
+            program->linkAsync({vs,fs});
+            programs.push_back(program);
+         }
+
+         THEN( "status and reflection are not queried" ) {
+            REQUIRE( profiler.getStatistics(getShaderiv).calls==0 );
+            REQUIRE( profiler.getStatistics(getProgramiv).calls==0 );
+            REQUIRE( profiler.getStatistics(getActiveUniform).calls==0 );
+         }
+
+         THEN( "completion is polled without waiting" ) {
+            REQUIRE( !programs[0]->isLinkCompleted() );
+            REQUIRE( !programs[0]->isLinkCompleted() );
+            REQUIRE( programs[0]->isLinkCompleted() );
+            REQUIRE( profiler.getStatistics(getActiveUniform).calls==0 );
+         }
+
+         THEN( "reflection is filled by the first use" ) {
+            REQUIRE( programs[0]->getUniformHandle("color").isValid() );
+            REQUIRE( profiler.getStatistics(getActiveUniform).calls==2 );
+            REQUIRE( programs[1]->getInfo()->uniforms.count("mvp")==1 );
+            REQUIRE( programs[1]->getInfo()->attribs.count("position")==1 );
+            REQUIRE( programs[1]->getLinkStatus()==GL_TRUE );
+            REQUIRE( profiler.getStatistics(getActiveUniform).calls==4 );
+         }
+      }
+
+      WHEN( "shader is compiled asynchronously" ) {
+         auto vs=make_shared<Shader>(table);
+         vs->create(GL_VERTEX_SHADER);
+         vs->compileAsync({vertexSource});
+
+         THEN( "completion is polled" ) {
+            REQUIRE( !vs->isCompileCompleted() );
+            REQUIRE( vs->getCompileStatus()==GL_TRUE );
+            REQUIRE( vs->isCompileCompleted() );
+         }
+      }
+   }
+
+   GIVEN( "driver without parallel shader compilation" ) {
+
+      loader->setInteger(GL_NUM_EXTENSIONS,0);
+      loader->setCompileLatency(2);
+      REQUIRE( !Shader::isParallelCompileSupported(Context(table)) );
+
+      WHEN( "program is linked asynchronously" ) {
+         auto program=make_shared<Program>(table);
+         program->linkAsync({make_shared<Shader>(table,GL_VERTEX_SHADER,Shader::Sources{vertexSource})});
+
+         THEN( "it is always completed" ) {
+            REQUIRE( program->isLinkCompleted() );
+            REQUIRE( profiler.getStatistics(getProgramiv).calls==0 );
+            REQUIRE( program->getInfo()->uniforms.count("mvp")==1 );
+         }
+      }
+   }
+
+   GIVEN( "synchronously linked program" ) {
+
+      auto program=make_shared<Program>(table,
+            make_shared<Shader>(table,GL_VERTEX_SHADER,Shader::Sources{vertexSource}),
+            make_shared<Shader>(table,GL_FRAGMENT_SHADER,Shader::Sources{fragmentSource}));
+
+      THEN( "reflection is filled by the first use too" ) {
+         REQUIRE( profiler.getStatistics(getActiveUniform).calls==0 );
+         program->set4f("color",1.f,0.f,0.f,1.f);
+         REQUIRE( profiler.getStatistics(getActiveUniform).calls==2 );
+         REQUIRE( program->getUniformHandle("mvp").isValid() );
+         REQUIRE( profiler.getStatistics(getActiveUniform).calls==2 );
+      }
+   }
+}
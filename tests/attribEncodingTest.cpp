@@ -0,0 +1,185 @@
+#include<cmath>
+#include<cstdint>
+#include<cstring>
+#include<vector>
+#include<geRG/AttribType.h>
+
+#define CATCH_CONFIG_MAIN
+#include"catch.hpp"
+
+using namespace ge::rg;
+using namespace std;
+
+
+
+// reference decoders, they do what OpenGL vertex fetch and decoding shader do
+
+static float halfToFloat(uint16_t h)
+{
+   uint32_t sign=uint32_t(h&0x8000)<<16;
+   uint32_t exponent=(h>>10)&0x1f;
+   uint32_t mantissa=h&0x3ff;
+   float v;
+   if(exponent==0)
+      v=ldexp(float(mantissa),-24);
+   else if(exponent==31)
+      v=mantissa ? NAN : INFINITY;
+   else
+      v=ldexp(float(mantissa|0x400),int(exponent)-25);
+   uint32_t bits;
+   memcpy(&bits,&v,4);
+   bits|=sign;
+   memcpy(&v,&bits,4);
+   return v;
+}
+
+
+static void octahedralDecode(float *n,const int16_t *e)
+{
+   float x=max(e[0]/32767.f,-1.f);
+   float y=max(e[1]/32767.f,-1.f);
+   float z=1.f-fabs(x)-fabs(y);
+   if(z<0.f) {
+      float fx=(1.f-fabs(y))*(x>=0.f?1.f:-1.f);
+      y=(1.f-fabs(x))*(y>=0.f?1.f:-1.f);
+      x=fx;
+   }
+   float l=sqrt(x*x+y*y+z*z);
+   n[0]=x/l;
+   n[1]=y/l;
+   n[2]=z/l;
+}
+
+
+
+SCENARIO( "Compressed attribute types", "[AttribType]" )
+{
+   GIVEN( "compressed types" ) {
+
+      THEN( "they keep encoding separately from divisor" ) {
+         AttribType t=AttribType::CompressedNormal;
+         REQUIRE( t.encoding()==AttribType::OCTAHEDRAL_ENCODING );
+         t.setDivisor(3);
+         REQUIRE( t.divisor()==3 );
+         REQUIRE( t.encoding()==AttribType::OCTAHEDRAL_ENCODING );
+         t.setEncoding(AttribType::NO_ENCODING);
+         REQUIRE( t.divisor()==3 );
+         REQUIRE( AttribType::CompressedPosition!=AttribType::HVec3 );
+      }
+
+      THEN( "they take half or less of source data size" ) {
+         REQUIRE( AttribType::CompressedPosition.sourceElementSize()==12 );
+         REQUIRE( AttribType::CompressedPosition.elementSize()==6 );
+         REQUIRE( AttribType::CompressedNormal.sourceElementSize()==12 );
+         REQUIRE( AttribType::CompressedNormal.elementSize()==4 );
+         REQUIRE( AttribType::CompressedTexCoord.sourceElementSize()==8 );
+         REQUIRE( AttribType::CompressedTexCoord.elementSize()==4 );
+         REQUIRE( AttribType::CompressedColor.sourceElementSize()==16 );
+         REQUIRE( AttribType::CompressedColor.elementSize()==4 );
+         REQUIRE( AttribType::Vec3.sourceElementSize()==12 );
+      }
+   }
+
+   GIVEN( "positions" ) {
+
+      // 11 vertices to cover both SIMD and scalar paths
+      vector<float> src={ 0.f,1.f,-2.f, 0.5f,65504.f,-65504.f, 1e-5f,-1e-7f,3.14159f,
+                          100000.f,-0.f,0.3333f, 12.34f,-56.78f,0.001f, 7.f,8.f,9.f,
+                          -1.5f,2.25f,1024.5f, 0.1f,0.2f,0.3f, 1e-3f,2e-3f,4e-3f,
+                          -7.77f,5e-6f,60000.f, 0.7f,0.8f,0.9f };
+      unsigned numVertices=unsigned(src.size()/3);
+      vector<uint16_t> dst(src.size());
+      AttribType::CompressedPosition.encode(dst.data(),src.data(),numVertices);
+
+      THEN( "they are converted to half-floats" ) {
+         for(size_t i=0; i<src.size(); i++) {
+            float v=halfToFloat(dst[i]);
+            if(fabs(src[i])>65520.f)
+               REQUIRE( std::isinf(v) );
+            else
+               REQUIRE( fabs(v-src[i])<=max(fabs(src[i])*0.0005f,3e-8f) );
+         }
+         REQUIRE( dst[0]==0x0000 );
+         REQUIRE( dst[1]==0x3c00 );
+         REQUIRE( dst[2]==0xc000 );
+         REQUIRE( dst[4]==0x7bff );
+         REQUIRE( dst[5]==0xfbff );
+         REQUIRE( dst[10]==0x8000 );
+      }
+   }
+
+   GIVEN( "positions halfway between two half-floats" ) {
+
+      // 9 values to cover both SIMD and scalar paths
+      vector<float> src={ 1.f+ldexp(1.f,-11),1.f+ldexp(3.f,-11),-1.f-ldexp(1.f,-11),
+                          2049.f,2051.f,ldexp(1.f,-25),
+                          ldexp(3.f,-25),65520.f,1.f+ldexp(1.f,-11) };
+      vector<uint16_t> dst(src.size());
+      AttribType::CompressedPosition.encode(dst.data(),src.data(),3);
+
+      THEN( "they are rounded to even" ) {
+         vector<uint16_t> expected={ 0x3c00,0x3c02,0xbc00,
+                                     0x6800,0x6802,0x0000,
+                                     0x0002,0x7c00,0x3c00 };
+         REQUIRE( dst==expected );
+      }
+   }
+
+   GIVEN( "normals" ) {
+
+      vector<float> src;
+      for(unsigned i=0; i<37; i++) {
+         float theta=float(i)*0.35f;
+         float phi=float(i)*0.71f;
+         src.push_back(sin(theta)*cos(phi));
+         src.push_back(sin(theta)*sin(phi));
+         src.push_back(cos(theta));
+      }
+      src.insert(src.end(),{0.f,0.f,-1.f, 0.f,0.f,0.f, 0.f,-3.f,0.f});
+      unsigned numVertices=unsigned(src.size()/3);
+      vector<int16_t> dst(numVertices*2);
+      AttribType::CompressedNormal.encode(dst.data(),src.data(),numVertices);
+
+      THEN( "they are decoded with small error" ) {
+         for(unsigned i=0; i<numVertices; i++) {
+            const float *s=&src[i*3];
+            float l=sqrt(s[0]*s[0]+s[1]*s[1]+s[2]*s[2]);
+            float n[3];
+            octahedralDecode(n,&dst[i*2]);
+            if(l==0.f) {
+               REQUIRE( n[2]==Approx(1.f) );
+               continue;
+            }
+            float dot=(n[0]*s[0]+n[1]*s[1]+n[2]*s[2])/l;
+            REQUIRE( dot>0.99999f );
+         }
+      }
+   }
+
+   GIVEN( "texture coordinates and colors" ) {
+
+      vector<float> src;
+      for(unsigned i=0; i<43; i++)
+         src.push_back(float(i)/40.f-0.05f);
+      vector<uint16_t> tc(src.size());
+      vector<uint8_t> color(src.size());
+      AttribType t=AttribType::CompressedTexCoord;
+      t.setNumComponents(1);
+      t.encode(tc.data(),src.data(),unsigned(src.size()));
+      t=AttribType::CompressedColor;
+      t.setNumComponents(1);
+      t.encode(color.data(),src.data(),unsigned(src.size()));
+
+      THEN( "they are converted to clamped unorm values" ) {
+         for(size_t i=0; i<src.size(); i++) {
+            float v=min(max(src[i],0.f),1.f);
+            REQUIRE( fabs(tc[i]/65535.f-v)<=0.5f/65535.f+1e-7f );
+            REQUIRE( fabs(color[i]/255.f-v)<=0.5f/255.f+1e-6f );
+         }
+         REQUIRE( tc[0]==0 );
+         REQUIRE( tc[42]==65535 );
+         REQUIRE( color[0]==0 );
+         REQUIRE( color[42]==255 );
+      }
+   }
+}
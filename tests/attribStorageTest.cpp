@@ -0,0 +1,178 @@
+#include<memory>
+#include<vector>
+#include<geGL/geGL.h>
+#include<geGL/NullLoader.h>
+#include<geGL/UploadBatcher.h>
+#include<geRG/AttribStorage.h>
+#include<geRG/RenderingContext.h>
+
+#define CATCH_CONFIG_MAIN
+#include"catch.hpp"
+
+using namespace ge::rg;
+using namespace std;
+
+
+
+static vector<float> vertexContent(AttribStorage *storage,unsigned startIndex,unsigned numVertices)
+{
+   vector<float> data(numVertices*3);
+   storage->buffer(0)->getData(data.data(),data.size()*sizeof(float),startIndex*3*sizeof(float));
+   return data;
+}
+
+
+static vector<unsigned> primitiveContent(Mesh &mesh)
+{
+   RenderingContext::current()->unmapBuffers();
+   unsigned startIndex=RenderingContext::current()->primitiveStorage()->operator[](mesh.primitivesDataId()).startIndex;
+   vector<unsigned> data(mesh.primitiveList().size()*3);
+   RenderingContext::current()->primitiveStorage()->buffer()->getData(
+         data.data(),data.size()*sizeof(unsigned),startIndex*sizeof(PrimitiveGpuData));
+   return data;
+}
+
+
+
+SCENARIO( "AttribStorage compaction", "[AttribStorage]" )
+{
+   auto loader=make_shared<ge::gl::NullLoader>();
+   ge::gl::init(loader);
+   RenderingContext::setCurrent(make_shared<RenderingContext>());
+   auto rc=RenderingContext::current();
+
+   GIVEN( "mesh uploaded through upload batcher behind a freed mesh" ) {
+
+      auto batcher=make_shared<ge::gl::UploadBatcher>(4096);
+      rc->setUploadBatcher(batcher);
+      AttribConfig config=rc->getAttribConfig({AttribType::Vec3},false);
+      Mesh a,b;
+      a.allocData(config,3,0,0);
+      b.allocData(config,3,0,0);
+      vector<float> coords={ 1.f,2.f,3.f, 4.f,5.f,6.f, 7.f,8.f,9.f };
+      const void *attribList[]={ coords.data() };
+      b.uploadVertices(attribList,1,3);
+      a.freeData();
+      REQUIRE( batcher->getNofPendingWrites()==1 );
+      AttribStorage *storage=b.attribStorage();
+      REQUIRE( storage->vertexArrayAllocation(b.verticesDataId()).startIndex==3 );
+
+      WHEN( "data are compacted before the batcher is flushed" ) {
+
+         rc->compactVertexData(1<<20);
+
+         THEN( "uploaded data are moved with the mesh" ) {
+            REQUIRE( batcher->getNofPendingWrites()==0 );
+            REQUIRE( storage->vertexArrayAllocation(b.verticesDataId()).startIndex==0 );
+            REQUIRE( vertexContent(storage,0,3)==coords );
+         }
+      }
+   }
+
+   GIVEN( "AttribStorage with pending uploads" ) {
+
+      auto batcher=make_shared<ge::gl::UploadBatcher>(4096);
+      rc->setUploadBatcher(batcher);
+      {
+         AttribConfig config=rc->getAttribConfig({AttribType::Vec3},false);
+         Mesh m;
+         m.allocData(config,3,0,0);
+         vector<float> coords(9,1.f);
+         const void *attribList[]={ coords.data() };
+         m.uploadVertices(attribList,1,3);
+         REQUIRE( batcher->getNofPendingWrites()==1 );
+      }
+
+      WHEN( "it is released before the batcher is flushed" ) {
+
+         rc.reset();
+         RenderingContext::setCurrent(nullptr);
+
+         THEN( "its writes are dropped" ) {
+            REQUIRE( batcher->getNofPendingWrites()==0 );
+            batcher->flush();
+         }
+      }
+   }
+
+   GIVEN( "indexed mesh behind other meshes" ) {
+
+      AttribConfig config=rc->getAttribConfig({AttribType::Vec3},true);
+      Mesh a,c,b;
+      a.allocData(config,3,3,1);
+      c.allocData(config,2,0,1); // vertices only
+      b.allocData(config,4,6,2);
+      vector<float> coords={ 0.f,0.f,0.f, 1.f,0.f,0.f, 1.f,1.f,0.f, 0.f,1.f,0.f };
+      vector<unsigned> indices={ 0,1,2, 0,2,3 };
+      const void *attribList[]={ coords.data() };
+      b.uploadVertices(attribList,1,4);
+      b.uploadIndices(indices.data(),6);
+      vector<PrimitiveGpuData> primitives={ PrimitiveGpuData(3,0,true),PrimitiveGpuData(3,3,true) };
+      vector<unsigned> modesAndOffsets4={ GL_TRIANGLES,0, GL_TRIANGLES,3 };
+      b.setAndUploadPrimitives(primitives.data(),modesAndOffsets4.data(),2);
+      AttribStorage *storage=b.attribStorage();
+      unsigned vertexStart=storage->vertexArrayAllocation(b.verticesDataId()).startIndex;
+      unsigned indexStart=storage->indexArrayAllocation(b.indicesDataId()).startIndex;
+
+      THEN( "primitives use index allocation as first index and vertex allocation as base vertex" ) {
+         REQUIRE( vertexStart==5 );
+         REQUIRE( indexStart==3 );
+         auto p=primitiveContent(b);
+         REQUIRE( p[1]==indexStart+0 );
+         REQUIRE( p[2]==vertexStart );
+         REQUIRE( p[4]==indexStart+3 );
+         REQUIRE( p[5]==vertexStart );
+      }
+
+      THEN( "primitive data of the caller stay relative to the mesh" ) {
+         REQUIRE( primitives[0].first==0 );
+         REQUIRE( primitives[1].first==3 );
+         REQUIRE( primitives[1].vertexOffset==0 );
+      }
+
+      WHEN( "vertices and indices are moved by compaction" ) {
+
+         a.freeData();
+         c.freeData();
+         rc->compactVertexData(1<<20);
+
+         THEN( "first index and base vertex follow the moved data" ) {
+            REQUIRE( storage->vertexArrayAllocation(b.verticesDataId()).startIndex==0 );
+            REQUIRE( storage->indexArrayAllocation(b.indicesDataId()).startIndex==0 );
+            auto p=primitiveContent(b);
+            REQUIRE( p[1]==0 );
+            REQUIRE( p[2]==0 );
+            REQUIRE( p[4]==3 );
+            REQUIRE( p[5]==0 );
+            vector<unsigned> movedIndices(6);
+            storage->elementBuffer()->getData(movedIndices.data(),6*sizeof(unsigned),0);
+            REQUIRE( movedIndices==indices );
+         }
+      }
+
+      WHEN( "only vertices are moved" ) {
+
+         c.freeData();
+         rc->compactVertexData(1<<20);
+
+         THEN( "base vertex is rebased and first index is kept" ) {
+            REQUIRE( storage->indexArrayAllocation(b.indicesDataId()).startIndex==indexStart );
+            unsigned newVertexStart=storage->vertexArrayAllocation(b.verticesDataId()).startIndex;
+            REQUIRE( newVertexStart==3 );
+            auto p=primitiveContent(b);
+            REQUIRE( p[1]==indexStart+0 );
+            REQUIRE( p[2]==newVertexStart );
+            REQUIRE( p[4]==indexStart+3 );
+            REQUIRE( p[5]==newVertexStart );
+         }
+
+         THEN( "vertices overlapping their destination are preserved" ) {
+            vector<float> movedCoords(12);
+            storage->buffer(0)->getData(movedCoords.data(),12*sizeof(float),3*3*sizeof(float));
+            REQUIRE( movedCoords==coords );
+         }
+      }
+   }
+
+   RenderingContext::setCurrent(nullptr);
+}
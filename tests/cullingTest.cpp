@@ -0,0 +1,184 @@
+#include<cmath>
+#include<vector>
+#include<geRG/Culling.h>
+#include<geRG/DrawCommandProcessor.h>
+#include<geRG/MatrixGpuData.h>
+
+#define CATCH_CONFIG_MAIN
+#include"catch.hpp"
+
+using namespace ge::rg;
+using namespace std;
+
+
+
+// OpenGL perspective projection (column-major)
+static void perspective(float *m,float fovy,float aspect,float near,float far)
+{
+   float f=1.f/tan(fovy/2.f);
+   for(unsigned i=0; i<16; i++)
+      m[i]=0.f;
+   m[0]=f/aspect;
+   m[5]=f;
+   m[10]=(far+near)/(near-far);
+   m[11]=-1.f;
+   m[14]=2.f*far*near/(near-far);
+}
+
+
+static void translation(float *m,float x,float y,float z)
+{
+   for(unsigned i=0; i<16; i++)
+      m[i]=(i%5==0)?1.f:0.f;
+   m[12]=x; m[13]=y; m[14]=z;
+}
+
+
+
+SCENARIO("frustum culling of bounding spheres") {
+
+   GIVEN("perspective projection looking along negative z") {
+      Culling c;
+      float p[16];
+      perspective(p,1.5f,1.f,1.f,100.f);
+      c.setProjection(p);
+      BoundingSphereGpuData unitSphere={{0.f,0.f,0.f},1.f};
+      float m[16];
+
+      WHEN("sphere is in front of the camera") {
+         translation(m,0.f,0.f,-10.f);
+         THEN("it is visible") {
+            REQUIRE(c.isVisible(m,unitSphere));
+         }
+      }
+      WHEN("sphere is behind the camera") {
+         translation(m,0.f,0.f,10.f);
+         THEN("it is culled") {
+            REQUIRE(!c.isVisible(m,unitSphere));
+         }
+      }
+      WHEN("sphere is far to the side or beyond far plane") {
+         THEN("it is culled") {
+            translation(m,100.f,0.f,-10.f);
+            REQUIRE(!c.isVisible(m,unitSphere));
+            translation(m,0.f,0.f,-200.f);
+            REQUIRE(!c.isVisible(m,unitSphere));
+         }
+      }
+      WHEN("sphere intersects the frustum boundary") {
+         translation(m,10.f,0.f,-10.f);
+         BoundingSphereGpuData big={{0.f,0.f,0.f},3.f};
+         THEN("it is visible") {
+            REQUIRE(c.isVisible(m,big));
+         }
+      }
+      WHEN("sphere has negative radius") {
+         translation(m,0.f,0.f,10.f);
+         BoundingSphereGpuData none={{0.f,0.f,0.f},-1.f};
+         THEN("it is never culled") {
+            REQUIRE(c.isVisible(m,none));
+         }
+      }
+   }
+}
+
+
+SCENARIO("Hi-Z occlusion culling") {
+
+   GIVEN("Hi-Z buffer of 5x3 depth buffer") {
+      vector<float> depth(15,1.f);
+      depth[7]=0.2f;
+      HiZBuffer h;
+      h.build(depth.data(),5,3);
+      THEN("levels are rounded up and hold maximal depth") {
+         REQUIRE(h.numLevels()==4);
+         REQUIRE(h.width(1)==3);
+         REQUIRE(h.height(1)==2);
+         REQUIRE(h.width(3)==1);
+         REQUIRE(h.depth(3,0,0)==1.f);
+      }
+   }
+
+   GIVEN("depth buffer with near occluder in the centre") {
+      const unsigned size=64;
+      vector<float> depth(size*size,1.f);
+      for(unsigned y=16; y<48; y++)
+         for(unsigned x=16; x<48; x++)
+            depth[y*size+x]=0.5f;
+      HiZBuffer h;
+      h.build(depth.data(),size,size);
+      REQUIRE(h.numLevels()==7);
+
+      THEN("rectangle behind the occluder is occluded") {
+         REQUIRE(h.isOccluded(0.3f,0.3f,0.7f,0.7f,0.6f));
+      }
+      THEN("rectangle in front of the occluder is not occluded") {
+         REQUIRE(!h.isOccluded(0.3f,0.3f,0.7f,0.7f,0.4f));
+      }
+      THEN("rectangle overlapping the uncovered area is not occluded") {
+         REQUIRE(!h.isOccluded(0.1f,0.3f,0.7f,0.7f,0.6f));
+      }
+
+      WHEN("culling spheres using it") {
+         Culling c;
+         float p[16];
+         perspective(p,1.5f,1.f,1.f,100.f);
+         c.setProjection(p);
+         c.hiZBuffer=&h;
+         BoundingSphereGpuData unitSphere={{0.f,0.f,0.f},1.f};
+         float m[16];
+         THEN("small sphere far behind is occluded and near one is not") {
+            translation(m,0.f,0.f,-90.f);
+            REQUIRE(!c.isVisible(m,unitSphere));
+            translation(m,0.f,0.f,-1.5f);
+            REQUIRE(c.isVisible(m,unitSphere));
+         }
+      }
+   }
+}
+
+
+SCENARIO("DrawCommandProcessor culling") {
+
+   GIVEN("two draw commands with one instance inside and one outside the frustum") {
+      vector<unsigned> primitives={ 0,0,0, 3,0,0 };
+      vector<unsigned> drawCommands={ 0,0,0, 3,2,1, 3,4,1 };
+      vector<unsigned> matrixListControl={ 0,0, 1,1, 2,1 };
+      vector<unsigned> stateSets={ 0,0 };
+      vector<unsigned> drawIndirect(8,0xffffffff);
+      vector<MatrixGpuData> matrices(3);
+      translation(matrices[1].matrix,0.f,0.f,-10.f);
+      translation(matrices[2].matrix,0.f,0.f,10.f);
+      vector<BoundingSphereGpuData> bounds(3,BoundingSphereGpuData{{0.f,0.f,0.f},1.f});
+      Culling c;
+      float p[16];
+      perspective(p,1.5f,1.f,1.f,100.f);
+      c.setProjection(p);
+
+      WHEN("processing them with culling") {
+         DrawCommandProcessor::Buffers b{primitives.data(),drawCommands.data(),matrixListControl.data(),
+                                         drawIndirect.data(),stateSets.data(),unsigned(stateSets.size()),
+                                         matrices.data(),bounds.data(),&c,0,nullptr,nullptr};
+         DrawCommandProcessor().process(b,3);
+         THEN("instance count of the culled draw command is zero") {
+            REQUIRE(drawIndirect[1]==1);
+            REQUIRE(drawIndirect[5]==0);
+            REQUIRE(stateSets[1]==8);
+         }
+      }
+
+      WHEN("processing them with culling and compaction") {
+         vector<unsigned> counts(2,0);
+         DrawCommandProcessor::Buffers b{primitives.data(),drawCommands.data(),matrixListControl.data(),
+                                         drawIndirect.data(),stateSets.data(),unsigned(stateSets.size()),
+                                         matrices.data(),bounds.data(),&c,0,counts.data(),nullptr};
+         DrawCommandProcessor().process(b,3);
+         THEN("only the visible draw command is written and counted") {
+            REQUIRE(drawIndirect[1]==1);
+            REQUIRE(drawIndirect[5]==0xffffffff);
+            REQUIRE(stateSets[1]==4);
+            REQUIRE(counts[1]==1);
+         }
+      }
+   }
+}
@@ -0,0 +1,169 @@
+#include<vector>
+#include<geRG/DrawCommandProcessor.h>
+#include<geCore/ThreadPool.h>
+
+#define CATCH_CONFIG_MAIN
+#include"catch.hpp"
+
+using namespace ge::rg;
+using namespace std;
+
+
+
+struct TestScene {
+   vector<unsigned> primitives;
+   vector<unsigned> drawCommands;
+   vector<unsigned> matrixListControl;
+   vector<unsigned> stateSets;
+   vector<unsigned> drawIndirect;
+
+   DrawCommandProcessor::Buffers buffers() {
+      return DrawCommandProcessor::Buffers{primitives.data(),drawCommands.data(),matrixListControl.data(),
+                                           drawIndirect.data(),stateSets.data(),unsigned(stateSets.size()),
+                                           nullptr,nullptr,nullptr,0,nullptr,nullptr};
+   }
+   unsigned numDrawCommands() const  { return unsigned(drawCommands.size()/3); }
+};
+
+
+// null items on index 0, primitive 1 is indexed, primitive 2 is not,
+// two matrix lists and two StateSets, draw commands alternate all of them
+static TestScene createScene(unsigned numDrawCommands)
+{
+   TestScene s;
+   s.primitives={ 0,0,0, 0x80000000|36,6,100, 3,2,50 };
+   s.matrixListControl={ 0,0, 1,10, 11,3 };
+   s.stateSets={ 0,4,0 };
+   s.drawCommands={ 0,0,0 };
+   unsigned sizes[3]={0,0,0};
+   for(unsigned i=1; i<numDrawCommands; i++) {
+      unsigned primitive=(i%2==0)?3:6;
+      unsigned stateSet=1+i%3/2;
+      if(i%7==0) primitive=0; // empty record
+      s.drawCommands.push_back(primitive);
+      s.drawCommands.push_back(2+(i%5/3)*2);
+      s.drawCommands.push_back(stateSet);
+      if(primitive!=0)
+         sizes[stateSet]+=DrawCommandProcessor::recordSize(s.primitives[primitive]);
+   }
+   s.stateSets[2]=s.stateSets[1]+sizes[1];
+   s.drawIndirect.assign(s.stateSets[2]+sizes[2],0xffffffff);
+   return s;
+}
+
+
+
+SCENARIO("DrawCommandProcessor expansion") {
+
+   GIVEN("three draw commands") {
+      TestScene s=createScene(3);
+      DrawCommandProcessor p;
+
+      WHEN("processing them") {
+         p.process(s.buffers(),s.numDrawCommands());
+         THEN("indexed and non-indexed records are written on StateSet positions") {
+            // draw command 1: primitive 6 (non-indexed), matrix list 2, StateSet 1
+            REQUIRE(s.drawIndirect[4]==3);
+            REQUIRE(s.drawIndirect[5]==10);
+            REQUIRE(s.drawIndirect[6]==52);
+            REQUIRE(s.drawIndirect[7]==1);
+            // draw command 2: primitive 3 (indexed), matrix list 2, StateSet 2
+            REQUIRE(s.stateSets[2]==13);
+            REQUIRE(s.drawIndirect[8]==36);
+            REQUIRE(s.drawIndirect[9]==10);
+            REQUIRE(s.drawIndirect[10]==6);
+            REQUIRE(s.drawIndirect[11]==100);
+            REQUIRE(s.drawIndirect[12]==1);
+         }
+         THEN("StateSet positions are advanced by the sizes of the records") {
+            REQUIRE(s.stateSets[1]==8);
+         }
+      }
+      WHEN("processing them with matrix offset of persistent ring segment") {
+         DrawCommandProcessor::Buffers b=s.buffers();
+         b.matrixOffset64=1024;
+         p.process(b,s.numDrawCommands());
+         THEN("the offset is added to base instances") {
+            REQUIRE(s.drawIndirect[7]==1025);
+            REQUIRE(s.drawIndirect[12]==1025);
+         }
+      }
+      WHEN("processing them with instance offset buffer") {
+         vector<unsigned> instanceOffsets(s.numDrawCommands(),0xffffffff);
+         DrawCommandProcessor::Buffers b=s.buffers();
+         b.matrixOffset64=1024;
+         b.instanceOffsetBuffer=instanceOffsets.data();
+         p.process(b,s.numDrawCommands());
+         THEN("base instances are draw command indices and matrix offsets are in the buffer") {
+            REQUIRE(s.drawIndirect[7]==1);
+            REQUIRE(s.drawIndirect[12]==2);
+            REQUIRE(instanceOffsets[0]==0xffffffff);
+            REQUIRE(instanceOffsets[1]==1025);
+            REQUIRE(instanceOffsets[2]==1025);
+         }
+      }
+   }
+
+   GIVEN("large number of draw commands") {
+      TestScene serial=createScene(100000);
+      TestScene parallel=serial;
+
+      WHEN("processing them single-threaded and by ThreadPool") {
+         DrawCommandProcessor p;
+         p.process(serial.buffers(),serial.numDrawCommands());
+         ge::core::ThreadPool pool(4);
+         p.minDrawCommandsPerChunk=1000;
+         p.process(parallel.buffers(),parallel.numDrawCommands(),&pool);
+         THEN("the results are identical and fill the whole draw indirect buffer") {
+            REQUIRE(serial.drawIndirect==parallel.drawIndirect);
+            REQUIRE(serial.stateSets==parallel.stateSets);
+            REQUIRE(serial.stateSets[2]==unsigned(serial.drawIndirect.size()));
+            bool allWritten=true;
+            for(unsigned i=4; i<serial.drawIndirect.size(); i++)
+               allWritten=allWritten && serial.drawIndirect[i]!=0xffffffff;
+            REQUIRE(allWritten);
+         }
+      }
+   }
+
+   GIVEN("large number of draw commands, some of them without instances") {
+      TestScene serial=createScene(100000);
+      unsigned numVisible=0,visibleSize=0;
+      for(unsigned i=1; i<serial.numDrawCommands(); i++) {
+         if(i%11==0)
+            serial.drawCommands[i*3+1]=0; // matrix list with zero matrices
+         else if(serial.drawCommands[i*3]!=0) {
+            numVisible++;
+            visibleSize+=DrawCommandProcessor::recordSize(serial.primitives[serial.drawCommands[i*3]]);
+         }
+      }
+      TestScene parallel=serial;
+      vector<unsigned> serialCounts(3,0);
+      vector<unsigned> parallelCounts(3,0);
+
+      WHEN("processing them with compaction single-threaded and by ThreadPool") {
+         DrawCommandProcessor p;
+         DrawCommandProcessor::Buffers b=serial.buffers();
+         b.countBuffer=serialCounts.data();
+         unsigned begin1=serial.stateSets[1];
+         unsigned begin2=serial.stateSets[2];
+         p.process(b,serial.numDrawCommands());
+         ge::core::ThreadPool pool(4);
+         p.minDrawCommandsPerChunk=1000;
+         b=parallel.buffers();
+         b.countBuffer=parallelCounts.data();
+         p.process(b,parallel.numDrawCommands(),&pool);
+         THEN("the results are identical") {
+            REQUIRE(serial.drawIndirect==parallel.drawIndirect);
+            REQUIRE(serial.stateSets==parallel.stateSets);
+            REQUIRE(serialCounts==parallelCounts);
+         }
+         THEN("only the records with instances are written and counted") {
+            REQUIRE(serialCounts[0]==0);
+            REQUIRE(serialCounts[1]+serialCounts[2]==numVisible);
+            REQUIRE((serial.stateSets[1]-begin1)+(serial.stateSets[2]-begin2)==visibleSize);
+            REQUIRE(serial.drawIndirect[serial.stateSets[1]]==0xffffffff);
+         }
+      }
+   }
+}
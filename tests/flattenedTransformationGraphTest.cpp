@@ -0,0 +1,88 @@
+#include<cstring>
+#include<vector>
+#include<geRG/FlattenedTransformationGraph.h>
+
+#define CATCH_CONFIG_MAIN
+#include"catch.hpp"
+
+using namespace ge::rg;
+using namespace std;
+
+
+
+static void referenceMultiply(const float *a,const float *b,float *r)
+{
+   for(unsigned j=0; j<4; j++)
+      for(unsigned i=0; i<4; i++) {
+         float s=0.f;
+         for(unsigned k=0; k<4; k++)
+            s+=a[k*4+i]*b[j*4+k];
+         r[j*4+i]=s;
+      }
+}
+
+
+static void translation(float *m,float x,float y,float z)
+{
+   memset(m,0,sizeof(float)*16);
+   m[0]=m[5]=m[10]=m[15]=1.f;
+   m[12]=x; m[13]=y; m[14]=z;
+}
+
+
+
+SCENARIO("FlattenedTransformationGraph evaluation") {
+
+   GIVEN("two general matrices") {
+      float a[16],b[16],r1[16],r2[16];
+      for(unsigned i=0; i<16; i++) {
+         a[i]=float(i)*0.5f-3.f;
+         b[i]=float(15-i)*0.25f+1.f;
+      }
+      WHEN("multiplying them") {
+         FlattenedTransformationGraph::multiplyMatrices(a,b,r1);
+         referenceMultiply(a,b,r2);
+         THEN("the result equals to the reference implementation") {
+            for(unsigned i=0; i<16; i++)
+               REQUIRE(r1[i]==Approx(r2[i]));
+         }
+      }
+   }
+
+   GIVEN("graph of root with two children, one of them having a child") {
+      // local matrices, index 0 is identity (null item)
+      vector<float> local(16*5);
+      translation(&local[0],0.f,0.f,0.f);
+      translation(&local[16],1.f,0.f,0.f);
+      translation(&local[32],0.f,2.f,0.f);
+      translation(&local[48],0.f,0.f,3.f);
+      translation(&local[64],10.f,0.f,0.f);
+
+      FlattenedTransformationGraph g;
+      unsigned root=g.addNode(FlattenedTransformationGraph::noParent,1,0);
+      unsigned c1=g.addNode(root,2,1);
+      unsigned c2=g.addNode(root,3,2);
+      g.addNode(c1,4,3);
+      REQUIRE(g.numNodes()==4);
+      REQUIRE(g.parentIndex(c2)==root);
+
+      WHEN("evaluating it") {
+         vector<MatrixGpuData> out(4);
+         memset(out.data(),0,out.size()*sizeof(MatrixGpuData));
+         g.evaluate(local.data(),out.data());
+         THEN("world matrices are products of local matrices from the root") {
+            REQUIRE(out[1].matrix[12]==Approx(1.f));
+            REQUIRE(out[1].matrix[13]==Approx(2.f));
+            REQUIRE(out[2].matrix[12]==Approx(1.f));
+            REQUIRE(out[2].matrix[14]==Approx(3.f));
+            REQUIRE(out[3].matrix[12]==Approx(11.f));
+            REQUIRE(out[3].matrix[13]==Approx(2.f));
+            REQUIRE(out[3].matrix[15]==Approx(1.f));
+         }
+         THEN("nodes with zero output offset are not written") {
+            REQUIRE(out[0].matrix[12]==0.f);
+            REQUIRE(g.worldMatrix(root).matrix[12]==Approx(1.f));
+         }
+      }
+   }
+}
@@ -0,0 +1,138 @@
+#include<chrono>
+#include<memory>
+#include<sstream>
+#include<string>
+#include<thread>
+#include<geGL/geGL.h>
+#include<geGL/NullLoader.h>
+#include<geGL/FrameProfiler.h>
+
+#define CATCH_CONFIG_MAIN
+#include"catch.hpp"
+
+using namespace ge::gl;
+using namespace std;
+
+
+
+static void frame(FrameProfiler&profiler)
+{
+   profiler.beginFrame();
+   {
+      FrameProfiler::Scope render(profiler,"render");
+      {
+         FrameProfiler::Scope shadows(profiler,"shadows");
+         this_thread::sleep_for(chrono::microseconds(100));
+      }
+   }
+   profiler.begin("postprocess");
+   profiler.end();
+   profiler.endFrame();
+}
+
+
+
+SCENARIO( "Frame profiler measures nested scopes", "[FrameProfiler]" )
+{
+   auto loader=make_shared<NullLoader>();
+   ge::gl::init(loader);
+   FrameProfiler profiler(3,4);
+
+   GIVEN( "resolved frame" ) {
+
+      frame(profiler);
+      profiler.beginFrame();
+      profiler.endFrame();
+
+      THEN( "scopes are identified by paths and form timeline" ) {
+         REQUIRE( profiler.getNofResolvedFrames()==1 );
+         auto names=profiler.getScopeNames();
+         REQUIRE( names==vector<string>({"frame","frame/postprocess","frame/render","frame/render/shadows"}) );
+         auto const&timeline=profiler.getTimeline();
+         REQUIRE( timeline.size()==4 );
+         REQUIRE( timeline[0].name=="frame" );
+         REQUIRE( timeline[2].name=="frame/render/shadows" );
+         REQUIRE( timeline[2].depth==2 );
+         REQUIRE( timeline[2].cpuBegin>=timeline[1].cpuBegin );
+         REQUIRE( timeline[2].cpuEnd<=timeline[1].cpuEnd );
+         REQUIRE( timeline[2].gpuBegin>=timeline[0].gpuBegin );
+         REQUIRE( timeline[2].gpuEnd<=timeline[0].gpuEnd );
+         REQUIRE( profiler.getCpuStatistics("frame/render/shadows").min>=100000 );
+         REQUIRE( profiler.getGpuStatistics("frame/render").samples==1 );
+         REQUIRE( profiler.getCpuStatistics("unknown").samples==0 );
+      }
+
+      THEN( "trace contains CPU and GPU scopes" ) {
+         stringstream ss;
+         profiler.writeChromeTrace(ss);
+         REQUIRE( ss.str().find("\"name\":\"frame/render\",\"cat\":\"cpu\"")!=string::npos );
+         REQUIRE( ss.str().find("\"name\":\"frame/render\",\"cat\":\"gpu\"")!=string::npos );
+      }
+   }
+
+   GIVEN( "many frames" ) {
+
+      for(int i=0; i<20; i++)
+         frame(profiler);
+      profiler.beginFrame();
+      profiler.endFrame();
+
+      THEN( "queries are reused and statistics are rolling" ) {
+         REQUIRE( profiler.getNofResolvedFrames()==20 );
+         REQUIRE( profiler.getNofQueries()==32 );
+         auto statistics=profiler.getCpuStatistics("frame/render");
+         REQUIRE( statistics.samples==4 );
+         REQUIRE( statistics.min<=statistics.avg );
+         REQUIRE( statistics.avg<=statistics.p99 );
+         REQUIRE( statistics.p99<=statistics.max );
+      }
+   }
+}
+
+
+SCENARIO( "Frame profiler does not wait for GPU", "[FrameProfiler]" )
+{
+   auto loader=make_shared<NullLoader>();
+   ge::gl::init(loader);
+   FrameProfiler profiler(3);
+
+   GIVEN( "queries with latency" ) {
+
+      loader->setQueryLatency(2);
+      frame(profiler);
+      frame(profiler);
+      frame(profiler);
+
+      THEN( "frames are resolved later" ) {
+         REQUIRE( profiler.getNofResolvedFrames()==0 );
+         REQUIRE( profiler.getNofPendingFrames()==3 );
+         frame(profiler);
+         REQUIRE( profiler.getNofResolvedFrames()==1 );
+         REQUIRE( profiler.getNofDroppedFrames()==0 );
+      }
+   }
+
+   GIVEN( "GPU that is too far behind" ) {
+
+      loader->setQueryLatency(1000);
+      for(int i=0; i<10; i++)
+         frame(profiler);
+
+      THEN( "the oldest frames are dropped" ) {
+         REQUIRE( profiler.getNofResolvedFrames()==0 );
+         REQUIRE( profiler.getNofPendingFrames()==4 );
+         REQUIRE( profiler.getNofDroppedFrames()==6 );
+      }
+   }
+
+   GIVEN( "disabled profiler" ) {
+
+      profiler.setEnabled(false);
+      frame(profiler);
+
+      THEN( "nothing is recorded" ) {
+         REQUIRE( profiler.getNofPendingFrames()==0 );
+         REQUIRE( profiler.getNofQueries()==0 );
+      }
+   }
+}
@@ -0,0 +1,201 @@
+#include <geSG/ImageProcessor.h>
+#include <geSG/DefaultImage.h>
+#include <geCore/ThreadPool.h>
+#include <cstdlib>
+#include <memory>
+#include <vector>
+
+using namespace std;
+using namespace ge::sg;
+using namespace ge::core;
+
+
+#define CATCH_CONFIG_MAIN
+#include "catch.hpp"
+
+
+class TestImage : public Image
+{
+public:
+   TestImage(size_t w,size_t h,Format f,size_t stride) : width(w),height(h),format(f),bits(stride*h) {}
+   virtual unsigned char* getBits() override { return bits.data(); }
+   virtual size_t getSizeInBytes() override { return bits.size(); }
+   virtual Format getFormat() override { return format; }
+   virtual DataType getDataType() override { return DataType::UNSIGNED_BYTE; }
+   virtual size_t getWidth() override { return width; }
+   virtual size_t getHeight() override { return height; }
+   size_t width,height;
+   Format format;
+   vector<unsigned char> bits;
+};
+
+
+static ImageProcessor::Level gradient(size_t w,size_t h)
+{
+   ImageProcessor::Level level;
+   level.width=w;
+   level.height=h;
+   for(size_t y=0; y<h; y++)
+      for(size_t x=0; x<w; x++) {
+         level.data.push_back((unsigned char)(x*255/(w-1)));
+         level.data.push_back((unsigned char)(y*16/(h-1)));
+         level.data.push_back((unsigned char)(128));
+         level.data.push_back((unsigned char)(255-x*255/(w-1)));
+      }
+   return level;
+}
+
+
+static double meanError(const ImageProcessor::Level& a,const ImageProcessor::Level& b,unsigned channels)
+{
+   double sum=0.;
+   for(size_t i=0; i<a.data.size(); i++)
+      if(i%4<channels)
+         sum+=abs(int(a.data[i])-int(b.data[i]));
+   return sum/double(a.width*a.height*channels);
+}
+
+
+SCENARIO("Images are converted to RGBA8","[ImageProcessor]")
+{
+   GIVEN("BGR image with padded rows")
+   {
+      TestImage image(3,2,Image::Format::BGR,12);
+      for(size_t y=0; y<2; y++)
+         for(size_t x=0; x<3; x++) {
+            image.bits[y*12+x*3+0]=1;
+            image.bits[y*12+x*3+1]=2;
+            image.bits[y*12+x*3+2]=3;
+         }
+
+      THEN("channels are swizzled and padding is skipped")
+      {
+         ImageProcessor::Level level;
+         REQUIRE(ImageProcessor::toRGBA8(image,level));
+         REQUIRE(level.width==3);
+         REQUIRE(level.height==2);
+         for(size_t i=0; i<6; i++) {
+            REQUIRE(level.data[i*4+0]==3);
+            REQUIRE(level.data[i*4+1]==2);
+            REQUIRE(level.data[i*4+2]==1);
+            REQUIRE(level.data[i*4+3]==255);
+         }
+      }
+   }
+
+   GIVEN("default image")
+   {
+      DefaultImage image;
+
+      THEN("mip chain has single level")
+      {
+         ImageProcessor processor;
+         auto levels=processor.generateMipmaps(image);
+         REQUIRE(levels.size()==1);
+         REQUIRE(levels[0].data==vector<unsigned char>(4,255));
+      }
+   }
+}
+
+
+SCENARIO("Mip chains are generated","[ImageProcessor]")
+{
+   ImageProcessor processor;
+   ImageProcessor::Level level;
+   level.width=20;
+   level.height=6;
+   srand(1);
+   for(size_t i=0; i<level.width*level.height*4; i++)
+      level.data.push_back((unsigned char)(rand()&255));
+
+   GIVEN("box filter")
+   {
+      auto levels=processor.generateMipmaps(level);
+
+      THEN("levels are halved down to 1x1 and texels are averages of 2x2 texels")
+      {
+         REQUIRE(levels.size()==5);
+         REQUIRE(levels[1].width==10); REQUIRE(levels[1].height==3);
+         REQUIRE(levels[2].width==5);  REQUIRE(levels[2].height==1);
+         REQUIRE(levels[3].width==2);  REQUIRE(levels[3].height==1);
+         REQUIRE(levels[4].width==1);  REQUIRE(levels[4].height==1);
+         for(size_t y=0; y<levels[1].height; y++)
+            for(size_t x=0; x<levels[1].width; x++)
+               for(size_t c=0; c<4; c++) {
+                  auto src=[&](size_t sx,size_t sy) { return unsigned(level.data[(sy*level.width+sx)*4+c]); };
+                  unsigned expected=(src(x*2,y*2)+src(x*2+1,y*2)+src(x*2,y*2+1)+src(x*2+1,y*2+1)+2)/4;
+                  REQUIRE(levels[1].data[(y*levels[1].width+x)*4+c]==expected);
+               }
+      }
+   }
+
+   GIVEN("Kaiser filter and constant image")
+   {
+      for(size_t i=0; i<level.data.size(); i++)
+         level.data[i]=(unsigned char)(i%4*50);
+      auto levels=processor.generateMipmaps(level,ImageProcessor::Filter::KAISER);
+
+      THEN("the image stays constant")
+      {
+         REQUIRE(levels.size()==5);
+         for(auto &l:levels)
+            for(size_t i=0; i<l.data.size(); i++)
+               REQUIRE(l.data[i]==i%4*50);
+      }
+   }
+
+   GIVEN("thread pool")
+   {
+      ImageProcessor parallel(make_shared<ThreadPool>(4));
+
+      THEN("results are the same as serial ones")
+      {
+         REQUIRE(parallel.downsample(level).data==processor.downsample(level).data);
+         REQUIRE(parallel.downsample(level,ImageProcessor::Filter::KAISER).data==processor.downsample(level,ImageProcessor::Filter::KAISER).data);
+         REQUIRE(parallel.compress(level,ImageProcessor::BlockFormat::BC7).data==processor.compress(level,ImageProcessor::BlockFormat::BC7).data);
+      }
+   }
+}
+
+
+SCENARIO("Levels are block compressed","[ImageProcessor]")
+{
+   ImageProcessor processor(make_shared<ThreadPool>(2));
+   auto level=gradient(34,18);
+
+   GIVEN("BC1")
+   {
+      auto compressed=processor.compress(level,ImageProcessor::BlockFormat::BC1);
+      auto decompressed=processor.decompress(compressed,ImageProcessor::BlockFormat::BC1);
+
+      THEN("colors are preserved")
+      {
+         REQUIRE(compressed.data.size()==9*5*8);
+         REQUIRE(meanError(level,decompressed,3)<4.);
+      }
+   }
+
+   GIVEN("BC3")
+   {
+      auto compressed=processor.compress(level,ImageProcessor::BlockFormat::BC3);
+      auto decompressed=processor.decompress(compressed,ImageProcessor::BlockFormat::BC3);
+
+      THEN("colors and alpha are preserved")
+      {
+         REQUIRE(compressed.data.size()==9*5*16);
+         REQUIRE(meanError(level,decompressed,4)<4.);
+      }
+   }
+
+   GIVEN("BC7")
+   {
+      auto compressed=processor.compress(level,ImageProcessor::BlockFormat::BC7);
+      auto decompressed=processor.decompress(compressed,ImageProcessor::BlockFormat::BC7);
+
+      THEN("colors and alpha are preserved")
+      {
+         REQUIRE(ImageProcessor::getCompressedSize(34,18,ImageProcessor::BlockFormat::BC7)==compressed.data.size());
+         REQUIRE(meanError(level,decompressed,4)<1.);
+      }
+   }
+}
@@ -0,0 +1,163 @@
+#include<memory>
+#include<typeindex>
+#include<vector>
+#include<geGL/geGL.h>
+#include<geGL/NullLoader.h>
+#include<geGL/StaticCalls.h>
+#include<geRG/FlexibleUniform.h>
+#include<geRG/MaterialTable.h>
+#include<geRG/RenderingContext.h>
+
+#define CATCH_CONFIG_MAIN
+#include"catch.hpp"
+
+using namespace ge::rg;
+using namespace std;
+
+
+
+static vector<MaterialGpuData> bufferContent(const MaterialTable& table)
+{
+   vector<MaterialGpuData> data(table.size());
+   table.buffer()->getData(data.data(),data.size()*sizeof(MaterialGpuData));
+   return data;
+}
+
+
+static unsigned numColorTexturingModeUniforms(StateSet *ss)
+{
+   unsigned n=0;
+   for(auto& c : ss->commandList())
+      if(dynamic_cast<FlexibleUniform1i*>(c.get()))
+         n++;
+   for(auto& child : ss->childList())
+      n+=numColorTexturingModeUniforms(child.get());
+   return n;
+}
+
+
+static GLint storageBlockBinding(ge::gl::Program *program,const char *name)
+{
+   GLuint index=ge::gl::glGetProgramResourceIndex(program->getId(),GL_SHADER_STORAGE_BLOCK,name);
+   if(index==GL_INVALID_INDEX)
+      return -1;
+   return program->getResourceParam(GL_SHADER_STORAGE_BLOCK,GL_BUFFER_BINDING,index);
+}
+
+
+static shared_ptr<StateSet> createStateSetWithTwoPrograms(RenderingContext *rc)
+{
+   auto ambient=rc->getProgram(RenderingContext::ProgramType::AMBIENT_PASS,false);
+   auto light=rc->getProgram(RenderingContext::ProgramType::LIGHT_PASS,false);
+   StateSetManager::GLState *state=rc->createGLState();
+   state->add("glProgram",type_index(typeid(shared_ptr<ge::gl::Program>*)),&ambient);
+   state->add("glProgram",type_index(typeid(shared_ptr<ge::gl::Program>*)),&light);
+   auto ss=rc->getOrCreateStateSet(state);
+   delete state;
+   return ss;
+}
+
+
+
+SCENARIO( "MaterialTable content", "[MaterialTable]" )
+{
+   auto loader=make_shared<ge::gl::NullLoader>();
+   ge::gl::init(loader);
+
+   GIVEN( "table with materials" ) {
+
+      MaterialTable table;
+      unsigned m0=table.addMaterial();
+      unsigned m1=table.addArrayLayer(5);
+      unsigned m2=table.addArrayLayer(7,MaterialTable::REPLACE);
+
+      THEN( "materials are appended" ) {
+         REQUIRE( m0==0 );
+         REQUIRE( m1==1 );
+         REQUIRE( m2==2 );
+         REQUIRE( table.size()==3 );
+         REQUIRE( table.material(1).layer==5 );
+         REQUIRE( table.material(1).texturingMode==MaterialTable::MODULATE );
+         REQUIRE( table.material(2).texturingMode==MaterialTable::REPLACE );
+         REQUIRE( table.buffer()==nullptr );
+      }
+
+      WHEN( "the table is bound" ) {
+
+         table.bind(3,0);
+
+         THEN( "it is uploaded to the shader storage buffer" ) {
+            REQUIRE( table.buffer()!=nullptr );
+            GLint binding=0;
+            ge::gl::glGetIntegeri_v(GL_SHADER_STORAGE_BUFFER_BINDING,3,&binding);
+            REQUIRE( GLuint(binding)==table.buffer()->getId() );
+            auto data=bufferContent(table);
+            REQUIRE( data[0].texturingMode==MaterialTable::NO_TEXTURING );
+            REQUIRE( data[1].layer==5 );
+            REQUIRE( data[2].layer==7 );
+            REQUIRE( data[2].texturingMode==MaterialTable::REPLACE );
+         }
+
+         THEN( "changed material is uploaded by the next bind" ) {
+            table.setMaterial(1,MaterialGpuData{{0,0},9,MaterialTable::MODULATE});
+            REQUIRE( bufferContent(table)[1].layer==5 );
+            table.bind(3,0);
+            REQUIRE( bufferContent(table)[1].layer==9 );
+         }
+      }
+   }
+}
+
+
+SCENARIO( "Material table rendering", "[MaterialTable]" )
+{
+   auto loader=make_shared<ge::gl::NullLoader>();
+   ge::gl::init(loader);
+   RenderingContext::setCurrent(make_shared<RenderingContext>());
+   auto rc=RenderingContext::current();
+   rc->setUseARBShaderDrawParameters(true);
+
+   GIVEN( "RenderingContext with material table" ) {
+
+      auto table=make_shared<MaterialTable>();
+      table->addMaterial();
+      rc->setMaterialTable(table);
+      REQUIRE( rc->materialTable()==table );
+
+      THEN( "built-in programs take the texturing mode from the material" ) {
+         auto program=rc->getProgram(RenderingContext::ProgramType::AMBIENT_PASS,false);
+         REQUIRE( program->getUniformLocation("colorTexturingMode")==-1 );
+         REQUIRE( storageBlockBinding(program.get(),"MaterialBuffer")==3 );
+         REQUIRE( storageBlockBinding(program.get(),"DrawCommandMaterialBuffer")==2 );
+      }
+
+      THEN( "StateSets do not set colorTexturingMode uniform" ) {
+         auto ss=createStateSetWithTwoPrograms(rc.get());
+         REQUIRE( numColorTexturingModeUniforms(rc->stateSetManager()->root().get())==0 );
+      }
+
+      THEN( "the table can not be disabled after the programs were created" ) {
+         rc->getProgram(RenderingContext::ProgramType::AMBIENT_PASS,false);
+         rc->setMaterialTable(nullptr);
+         REQUIRE( rc->materialTable()==table );
+      }
+   }
+
+   GIVEN( "RenderingContext without material table" ) {
+
+      THEN( "built-in programs use colorTexturingMode uniform set by StateSets" ) {
+         auto program=rc->getProgram(RenderingContext::ProgramType::AMBIENT_PASS,false);
+         REQUIRE( program->getUniformLocation("colorTexturingMode")!=-1 );
+         auto ss=createStateSetWithTwoPrograms(rc.get());
+         REQUIRE( numColorTexturingModeUniforms(rc->stateSetManager()->root().get())>0 );
+      }
+
+      THEN( "the table can not be enabled after the programs were created" ) {
+         rc->getProgram(RenderingContext::ProgramType::AMBIENT_PASS,false);
+         rc->setMaterialTable(make_shared<MaterialTable>());
+         REQUIRE( rc->materialTable()==nullptr );
+      }
+   }
+
+   RenderingContext::setCurrent(nullptr);
+}
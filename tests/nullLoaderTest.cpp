@@ -0,0 +1,231 @@
+#include<memory>
+#include<vector>
+#include<geGL/geGL.h>
+#include<geGL/NullLoader.h>
+#include<geGL/StaticCalls.h>
+
+#define CATCH_CONFIG_MAIN
+#include"catch.hpp"
+
+using namespace ge::gl;
+using namespace std;
+
+
+
+SCENARIO( "Buffers of NullLoader are stored in host memory", "[NullLoader]" )
+{
+   auto loader=make_shared<NullLoader>();
+   ge::gl::init(loader);
+
+   GIVEN( "buffer with data" ) {
+
+      vector<uint32_t> data={1,2,3,4};
+      auto buffer=make_shared<Buffer>(data.size()*sizeof(uint32_t),data.data(),GL_DYNAMIC_DRAW);
+
+      THEN( "object exists and data can be read back" ) {
+         REQUIRE( glIsBuffer(buffer->getId())==GL_TRUE );
+         REQUIRE( buffer->getSize()==GLsizeiptr(data.size()*sizeof(uint32_t)) );
+         vector<uint32_t> read(4,0);
+         buffer->getData(read.data());
+         REQUIRE( read==data );
+      }
+
+      WHEN( "buffer is mapped and written" ) {
+         auto ptr=static_cast<uint32_t*>(buffer->map(GL_MAP_WRITE_BIT));
+         REQUIRE( ptr!=nullptr );
+         REQUIRE( buffer->isMapped() );
+         ptr[2]=7;
+         buffer->unmap();
+
+         THEN( "data is changed" ) {
+            vector<uint32_t> read(4,0);
+            buffer->getData(read.data());
+            REQUIRE( !buffer->isMapped() );
+            REQUIRE( read[2]==7 );
+         }
+      }
+
+      WHEN( "buffer is reallocated with data" ) {
+         buffer->realloc(8*sizeof(uint32_t),Buffer::KEEP_DATA);
+
+         THEN( "data is kept" ) {
+            vector<uint32_t> read(4,0);
+            buffer->getData(read.data(),read.size()*sizeof(uint32_t));
+            REQUIRE( buffer->getSize()==GLsizeiptr(8*sizeof(uint32_t)) );
+            REQUIRE( read==data );
+         }
+      }
+
+      WHEN( "buffer is destroyed" ) {
+         size_t n=loader->getNofObjects();
+         buffer=nullptr;
+
+         THEN( "emulated object is deleted" ) {
+            REQUIRE( loader->getNofObjects()==n-1 );
+         }
+      }
+   }
+}
+
+
+SCENARIO( "Programs of NullLoader have reflection parsed from shader sources", "[NullLoader]" )
+{
+   auto loader=make_shared<NullLoader>();
+   ge::gl::init(loader);
+
+   GIVEN( "program with uniforms, inputs and storage block" ) {
+
+      auto vs=make_shared<Shader>(GL_VERTEX_SHADER,Shader::Sources{
+         "#version 450\n",
+         "layout(location=3) in vec3 position;\n"
+         "in vec2 coord;\n"
+         "uniform mat4 mvp;\n"
+         "uniform vec4 colors[4];// comment with uniform int fake;\n"
+         "layout(std430,binding=2) buffer Data{float values[];};\n"
+         "void main(){vec4 uniformLike=vec4(1);gl_Position=mvp*vec4(position,1);}\n"});
+      auto fs=make_shared<Shader>(GL_FRAGMENT_SHADER,Shader::Sources{
+         "#version 450\n"
+         "uniform vec4 colors[4];\n"
+         "layout(location=8) uniform float alpha;\n"
+         "out vec4 fColor;\n"
+         "void main(){fColor=colors[0];}\n"});
+      auto program=make_shared<Program>(vs,fs);
+
+      THEN( "program is linked and active resources are reported" ) {
+         REQUIRE( program->getLinkStatus()==GL_TRUE );
+         REQUIRE( program->getNofActiveUniforms()==3 );
+         REQUIRE( program->getNofActiveAttributes()==2 );
+         REQUIRE( program->getUniformLocation("mvp")==0 );
+         REQUIRE( program->getUniformLocation("colors")==1 );
+         REQUIRE( program->getUniformLocation("colors[2]")==3 );
+         REQUIRE( program->getUniformLocation("alpha")==8 );
+         REQUIRE( program->getUniformLocation("fake")==-1 );
+         REQUIRE( program->getAttribLocation("position")==3 );
+         REQUIRE( program->getAttribLocation("coord")==0 );
+         REQUIRE( program->getInterfaceParam(GL_SHADER_STORAGE_BLOCK,GL_ACTIVE_RESOURCES)==1 );
+         REQUIRE( program->getResourceName(GL_SHADER_STORAGE_BLOCK,0)=="Data" );
+         REQUIRE( program->getResourceParam(GL_SHADER_STORAGE_BLOCK,GL_BUFFER_BINDING,0)==2 );
+      }
+   }
+
+   GIVEN( "compute program" ) {
+
+      auto cs=make_shared<Shader>(GL_COMPUTE_SHADER,Shader::Sources{
+         "#version 450\n"
+         "layout(local_size_x=64,local_size_y=2)in;\n"
+         "void main(){}\n"});
+      auto program=make_shared<Program>(cs);
+
+      THEN( "work group size is parsed" ) {
+         GLint size[3]={0,0,0};
+         program->getComputeWorkGroupSize(size);
+         REQUIRE( size[0]==64 );
+         REQUIRE( size[1]==2 );
+         REQUIRE( size[2]==1 );
+      }
+   }
+}
+
+
+SCENARIO( "Vertex arrays of NullLoader keep attribute state", "[NullLoader]" )
+{
+   auto loader=make_shared<NullLoader>();
+   ge::gl::init(loader);
+
+   GIVEN( "vertex array with attribute and element buffer" ) {
+
+      auto vbo=make_shared<Buffer>(1024);
+      auto ebo=make_shared<Buffer>(256);
+      auto vao=make_shared<VertexArray>();
+      vao->addAttrib(vbo,1,3,GL_FLOAT,sizeof(float)*5,sizeof(float)*2,GL_FALSE,1);
+      vao->addElementBuffer(ebo);
+
+      THEN( "attribute state can be queried" ) {
+         REQUIRE( vao->isAttribEnabled(1)==GL_TRUE );
+         REQUIRE( vao->isAttribEnabled(0)==GL_FALSE );
+         REQUIRE( vao->getAttribSize(1)==3 );
+         REQUIRE( vao->getAttribType(1)==GL_FLOAT );
+         REQUIRE( vao->getAttribStride(1)==GLsizei(sizeof(float)*5) );
+         REQUIRE( vao->getAttribDivisor(1)==1 );
+         REQUIRE( vao->getAttribBufferBinding(1)==vbo->getId() );
+         REQUIRE( vao->getElementBuffer()==ebo->getId() );
+      }
+   }
+}
+
+
+SCENARIO( "Sync objects and queries of NullLoader", "[NullLoader]" )
+{
+   auto loader=make_shared<NullLoader>();
+   ge::gl::init(loader);
+
+   GIVEN( "fence" ) {
+
+      GLsync sync=glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE,0);
+
+      THEN( "fence is signaled until it is deleted" ) {
+         REQUIRE( glIsSync(sync)==GL_TRUE );
+         REQUIRE( glClientWaitSync(sync,0,0)==GL_ALREADY_SIGNALED );
+         glDeleteSync(sync);
+         REQUIRE( glIsSync(sync)==GL_FALSE );
+         REQUIRE( glClientWaitSync(sync,0,0)==GL_WAIT_FAILED );
+      }
+   }
+
+   GIVEN( "time elapsed query" ) {
+
+      GLuint query=0;
+      glGenQueries(1,&query);
+      glBeginQuery(GL_TIME_ELAPSED,query);
+      glEndQuery(GL_TIME_ELAPSED);
+
+      THEN( "result is available" ) {
+         GLuint available=0;
+         GLuint64 elapsed=0;
+         glGetQueryObjectuiv(query,GL_QUERY_RESULT_AVAILABLE,&available);
+         glGetQueryObjectui64v(query,GL_QUERY_RESULT,&elapsed);
+         REQUIRE( available==GL_TRUE );
+         REQUIRE( elapsed<1000000000u );
+         glDeleteQueries(1,&query);
+         REQUIRE( loader->getNofObjects()==0 );
+      }
+   }
+
+   GIVEN( "limits overriden by user" ) {
+
+      loader->setInteger(GL_MAX_VERTEX_ATTRIBS,32);
+
+      THEN( "glGetIntegerv returns them" ) {
+         GLint value=0;
+         glGetIntegerv(GL_MAX_VERTEX_ATTRIBS,&value);
+         REQUIRE( value==32 );
+      }
+   }
+}
+
+
+static GLuint nofReplacedDraws=0;
+static void replacedDrawArrays(GLenum,GLint,GLsizei)  { nofReplacedDraws++; }
+
+SCENARIO( "Functions of NullLoader can be replaced", "[NullLoader]" )
+{
+   auto loader=make_shared<NullLoader>();
+   loader->setFunction("glDrawArrays",replacedDrawArrays);
+   loader->setFunction("glCreateBuffers",nullptr);
+
+   GIVEN( "loader with replaced functions" ) {
+
+      THEN( "the replacements are loaded, other functions are emulated" ) {
+         REQUIRE( loader->load("glDrawArrays")==reinterpret_cast<FUNCTION_POINTER>(replacedDrawArrays) );
+         REQUIRE( loader->load("glCreateBuffers")==nullptr );
+         REQUIRE( loader->load("glGenBuffers")!=nullptr );
+      }
+
+      THEN( "the replacement is called through function table" ) {
+         ge::gl::init(loader);
+         nofReplacedDraws=0;
+         glDrawArrays(GL_TRIANGLES,0,3);
+         REQUIRE( nofReplacedDraws==1 );
+      }
+   }
+}
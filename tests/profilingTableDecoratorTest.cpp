@@ -0,0 +1,121 @@
+#include<memory>
+#include<sstream>
+#include<string>
+#include<geGL/NullLoader.h>
+#include<geGL/LoaderTableDecorator.h>
+#include<geGL/ProfilingTableDecorator.h>
+
+#define CATCH_CONFIG_MAIN
+#include"catch.hpp"
+
+using namespace ge::gl;
+using namespace std;
+
+
+
+// NullLoader with functions that count calls
+static size_t numCalls=0;
+
+static void fakeBindBuffer(GLenum,GLuint)                         { numCalls++; }
+static void fakeDrawArrays(GLenum,GLint,GLsizei)                  { numCalls++; }
+static GLboolean fakeIsEnabled(GLenum)                            { numCalls++; return GL_TRUE; }
+
+static shared_ptr<NullLoader> createCountingLoader()
+{
+   auto loader=make_shared<NullLoader>();
+   loader->setFunction("glBindBuffer",fakeBindBuffer);
+   loader->setFunction("glDrawArrays",fakeDrawArrays);
+   loader->setFunction("glIsEnabled",fakeIsEnabled);
+   return loader;
+}
+
+using Table=ProfilingTableDecorator<LoaderTableDecorator<FunctionTable>>;
+
+
+
+SCENARIO("ProfilingTableDecorator collects statistics of OpenGL calls") {
+
+   Table table(createCountingLoader());
+   table.construct();
+   numCalls=0;
+   auto &profiler=table.profiler;
+   size_t bindBuffer=profiler.findFunction("glBindBuffer");
+   size_t drawArrays=profiler.findFunction("glDrawArrays");
+
+   GIVEN("profiled table") {
+      THEN("functions are found by name") {
+         REQUIRE(bindBuffer!=FunctionProfiler::noFunction);
+         REQUIRE(drawArrays!=FunctionProfiler::noFunction);
+         REQUIRE(string(profiler.getFunctionName(bindBuffer))=="glBindBuffer");
+         REQUIRE(profiler.findFunction("glNoSuchFunction")==FunctionProfiler::noFunction);
+      }
+   }
+
+   GIVEN("calls in two frames") {
+      profiler.beginFrame();
+      table.glBindBuffer(GL_ARRAY_BUFFER,1);
+      table.glDrawArrays(GL_TRIANGLES,0,3);
+      table.glDrawArrays(GL_TRIANGLES,0,3);
+      profiler.endFrame();
+      profiler.beginFrame();
+      table.glDrawArrays(GL_TRIANGLES,0,3);
+      profiler.endFrame();
+
+      THEN("calls are forwarded and counted") {
+         REQUIRE(numCalls==4);
+         REQUIRE(profiler.getStatistics(bindBuffer).calls==1);
+         REQUIRE(profiler.getStatistics(drawArrays).calls==3);
+         REQUIRE(profiler.getStatistics(drawArrays).timedCalls==3);
+         REQUIRE(profiler.getFrameId()==2);
+      }
+      THEN("frame statistics contain only the last frame") {
+         REQUIRE(profiler.getFrameStatistics(bindBuffer).calls==0);
+         REQUIRE(profiler.getFrameStatistics(drawArrays).calls==1);
+      }
+      THEN("JSON contains called functions") {
+         ostringstream json;
+         profiler.writeJSON(json);
+         REQUIRE(json.str().find("\"name\":\"glDrawArrays\"")!=string::npos);
+         REQUIRE(json.str().find("\"name\":\"glIsEnabled\"")==string::npos);
+      }
+      WHEN("statistics are reset") {
+         profiler.reset();
+         THEN("everything is zero") {
+            REQUIRE(profiler.getStatistics(drawArrays).calls==0);
+            REQUIRE(profiler.getFrameId()==0);
+         }
+      }
+   }
+
+   GIVEN("timing of every 4th call") {
+      profiler.setTimingPeriod(4);
+      for(int i=0;i<10;i++)
+         table.glDrawArrays(GL_TRIANGLES,0,3);
+      THEN("all calls are counted, only some are timed") {
+         REQUIRE(profiler.getStatistics(drawArrays).calls==10);
+         REQUIRE(profiler.getStatistics(drawArrays).timedCalls==3);
+      }
+   }
+
+   GIVEN("tracing") {
+      profiler.setTracingEnabled(true,2);
+      profiler.beginFrame();
+      table.glIsEnabled(GL_DEPTH_TEST);
+      table.glBindBuffer(GL_ARRAY_BUFFER,1);
+      table.glDrawArrays(GL_TRIANGLES,0,3);
+      profiler.endFrame();
+
+      THEN("calls are recorded up to the limit") {
+         REQUIRE(table.glIsEnabled(GL_DEPTH_TEST)==GL_TRUE);
+         REQUIRE(profiler.getTrace().size()==2);
+         REQUIRE(profiler.getFrames().size()==1);
+         REQUIRE(profiler.getFrames()[0].calls==3);
+      }
+      THEN("Chrome trace contains recorded calls") {
+         ostringstream trace;
+         profiler.writeChromeTrace(trace);
+         REQUIRE(trace.str().find("\"name\":\"glBindBuffer\"")!=string::npos);
+         REQUIRE(trace.str().find("\"name\":\"glDrawArrays\"")==string::npos);
+      }
+   }
+}
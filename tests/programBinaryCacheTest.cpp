@@ -0,0 +1,144 @@
+#include<cstdio>
+#include<fstream>
+#include<memory>
+#include<vector>
+#include<geGL/geGL.h>
+#include<geGL/NullLoader.h>
+#include<geGL/ProgramBinaryCache.h>
+
+#define CATCH_CONFIG_MAIN
+#include"catch.hpp"
+
+using namespace ge::gl;
+using namespace std;
+
+
+
+static const ProgramBinaryCache::Stages stages={
+   {GL_VERTEX_SHADER,{"#version 450\n","uniform mat4 mvp;\nvoid main(){gl_Position=mvp*vec4(1);}\n"}},
+   {GL_FRAGMENT_SHADER,{"#version 450\n","uniform vec4 color;\nout vec4 fColor;\nvoid main(){fColor=color;}\n"}},
+};
+
+static size_t fileSize(const string&path)
+{
+   ifstream f(path,ios::binary|ios::ate);
+   return f.is_open()?size_t(f.tellg()):0;
+}
+
+
+SCENARIO( "Program binary cache keys", "[ProgramBinaryCache]" )
+{
+   GIVEN( "key of program" ) {
+
+      uint64_t key=ProgramBinaryCache::computeKey(stages,"vendor\nrenderer\n4.5\n");
+
+      THEN( "key depends on sources, defines, stages and driver" ) {
+         REQUIRE( key==ProgramBinaryCache::computeKey(stages,"vendor\nrenderer\n4.5\n") );
+         REQUIRE( key!=ProgramBinaryCache::computeKey(stages,"vendor\nrenderer\n4.6\n") );
+         auto defined=stages;
+         defined[0].second.insert(defined[0].second.begin()+1,Shader::define("SHADOWS"));
+         REQUIRE( key!=ProgramBinaryCache::computeKey(defined,"vendor\nrenderer\n4.5\n") );
+         auto split=stages;
+         split[0].second={split[0].second[0]+split[0].second[1]};
+         REQUIRE( key!=ProgramBinaryCache::computeKey(split,"vendor\nrenderer\n4.5\n") );
+         auto swapped=stages;
+         swap(swapped[0].first,swapped[1].first);
+         REQUIRE( key!=ProgramBinaryCache::computeKey(swapped,"vendor\nrenderer\n4.5\n") );
+      }
+   }
+}
+
+
+SCENARIO( "Program binary cache file store", "[ProgramBinaryCache]" )
+{
+   ProgramBinaryCache cache(".");
+   uint64_t key=0x1234;
+   vector<uint8_t> binary={1,2,3,4,5,6,7,8,9};
+
+   GIVEN( "stored binary" ) {
+
+      REQUIRE( cache.store(key,0x87,binary) );
+
+      THEN( "binary can be loaded" ) {
+         GLenum format=0;
+         vector<uint8_t> loaded;
+         REQUIRE( cache.load(key,format,loaded) );
+         REQUIRE( format==0x87 );
+         REQUIRE( loaded==binary );
+         cache.remove(key);
+         REQUIRE( !cache.load(key,format,loaded) );
+      }
+
+      WHEN( "file is corrupted" ) {
+         {
+            fstream f(cache.getPath(key),ios::binary|ios::in|ios::out);
+            f.seekp(-2,ios::end);
+            f.put(char(0xff));
+         }
+
+         THEN( "load fails and the file is removed" ) {
+            GLenum format=0;
+            vector<uint8_t> loaded;
+            REQUIRE( !cache.load(key,format,loaded) );
+            REQUIRE( fileSize(cache.getPath(key))==0 );
+         }
+      }
+
+      WHEN( "file is truncated" ) {
+         {
+            ofstream f(cache.getPath(key),ios::binary|ios::trunc);
+            f.write("GEGLPBIN",8);
+         }
+
+         THEN( "load fails" ) {
+            GLenum format=0;
+            vector<uint8_t> loaded;
+            REQUIRE( !cache.load(key,format,loaded) );
+         }
+      }
+   }
+}
+
+
+SCENARIO( "Programs are loaded from binary cache on warm start", "[ProgramBinaryCache]" )
+{
+   auto loader=make_shared<NullLoader>();
+   ge::gl::init(loader);
+   ProgramBinaryCache cache(".");
+
+   GIVEN( "program created by cache" ) {
+
+      auto cold=cache.createProgram(stages);
+      uint64_t key=ProgramBinaryCache::computeKey(stages,ProgramBinaryCache::getDriverString(cold->getContext()));
+
+      THEN( "first creation compiles and stores binary" ) {
+         REQUIRE( cache.getNofMisses()==1 );
+         REQUIRE( cache.getNofHits()==0 );
+         REQUIRE( cold->getLinkStatus()==GL_TRUE );
+         REQUIRE( fileSize(cache.getPath(key))>0 );
+
+         WHEN( "program is created again" ) {
+            auto warm=cache.createProgram(stages);
+
+            THEN( "it is loaded from binary with the same reflection" ) {
+               REQUIRE( cache.getNofHits()==1 );
+               REQUIRE( warm->getLinkStatus()==GL_TRUE );
+               REQUIRE( warm->getNofShaders()==0 );
+               REQUIRE( warm->getUniformLocation("color")==cold->getUniformLocation("color") );
+               REQUIRE( warm->getInfo()->uniforms.size()==cold->getInfo()->uniforms.size() );
+            }
+         }
+
+         WHEN( "driver does not support program binaries" ) {
+            loader->setInteger(GL_NUM_PROGRAM_BINARY_FORMATS,0);
+            auto program=cache.createProgram(stages);
+
+            THEN( "program is compiled" ) {
+               REQUIRE( cache.getNofMisses()==2 );
+               REQUIRE( program->getLinkStatus()==GL_TRUE );
+            }
+         }
+         cache.remove(key);
+      }
+   }
+}
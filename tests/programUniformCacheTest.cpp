@@ -0,0 +1,186 @@
+#include<memory>
+#include<string>
+#include<geGL/geGL.h>
+#include<geGL/NullLoader.h>
+#include<geGL/LoaderTableDecorator.h>
+#include<geGL/ProfilingTableDecorator.h>
+
+#define CATCH_CONFIG_MAIN
+#include"catch.hpp"
+
+using namespace ge::gl;
+using namespace std;
+
+
+
+// NullLoader emulates the program, profiler counts glProgramUniform* calls that reach it
+using Table=ProfilingTableDecorator<LoaderTableDecorator<FunctionTable>>;
+
+static uint64_t numCalls(const Table &table,const string &name)
+{
+   return table.profiler.getStatistics(table.profiler.findFunction(name)).calls;
+}
+
+
+static shared_ptr<Program> createProgram(const shared_ptr<Table> &table)
+{
+   auto vs=make_shared<Shader>(FunctionTablePointer(table),GL_VERTEX_SHADER,Shader::Sources{
+      "#version 450\n"
+      "uniform mat4 mvp;\n"
+      "uniform vec4 color;\n"
+      "uniform float weights[3];\n"
+      "void main(){gl_Position=mvp*color*weights[0];}\n"});
+   return make_shared<Program>(FunctionTablePointer(table),vs);
+}
+
+
+
+SCENARIO( "Shadow uniform cache of Program", "[Program]" )
+{
+   auto loader=make_shared<NullLoader>();
+   auto table=make_shared<Table>(loader);
+   table->construct();
+   table->profiler.setTimingEnabled(false);
+   auto program=createProgram(table);
+   REQUIRE( program->getLinkStatus()==GL_TRUE );
+   REQUIRE( program->isUniformCachingEnabled() );
+   UniformHandle color=program->getUniformHandle("color");
+   UniformHandle mvp=program->getUniformHandle("mvp");
+   UniformHandle weights=program->getUniformHandle("weights");
+   UniformHandle weight1=program->getUniformHandle("weights[1]");
+   REQUIRE( color.isValid() );
+   REQUIRE( mvp.isValid() );
+   REQUIRE( weights.size==3 );
+   REQUIRE( weight1.size==1 );
+   REQUIRE( !program->getUniformHandle("nothing").isValid() );
+   float identity[16]={ 1.f,0.f,0.f,0.f, 0.f,1.f,0.f,0.f, 0.f,0.f,1.f,0.f, 0.f,0.f,0.f,1.f };
+   float translation[16]={ 1.f,0.f,0.f,0.f, 0.f,1.f,0.f,0.f, 0.f,0.f,1.f,0.f, 1.f,2.f,3.f,1.f };
+
+   GIVEN( "uniform set by handle" ) {
+
+      program->set4f(color,1.f,0.f,0.f,1.f);
+      REQUIRE( numCalls(*table,"glProgramUniform4f")==1 );
+
+      THEN( "setting the same value is skipped" ) {
+         program->set4f(color,1.f,0.f,0.f,1.f);
+         program->set4f("color",1.f,0.f,0.f,1.f);
+         REQUIRE( numCalls(*table,"glProgramUniform4f")==1 );
+      }
+
+      THEN( "different value is set" ) {
+         program->set4f(color,0.f,1.f,0.f,1.f);
+         REQUIRE( numCalls(*table,"glProgramUniform4f")==2 );
+         program->set4f("color",1.f,0.f,0.f,1.f);
+         REQUIRE( numCalls(*table,"glProgramUniform4f")==3 );
+      }
+
+      THEN( "the value is set again after invalidateUniformCache()" ) {
+         program->invalidateUniformCache();
+         program->set4f(color,1.f,0.f,0.f,1.f);
+         REQUIRE( numCalls(*table,"glProgramUniform4f")==2 );
+         program->set4f(color,1.f,0.f,0.f,1.f);
+         REQUIRE( numCalls(*table,"glProgramUniform4f")==2 );
+      }
+
+      THEN( "the value is set again after the program is relinked" ) {
+         program->link();
+         program->set4f(color,1.f,0.f,0.f,1.f);
+         REQUIRE( numCalls(*table,"glProgramUniform4f")==2 );
+      }
+
+      THEN( "handle obtained before relinking is never cached" ) {
+         program->link();
+         program->set4f(color,1.f,0.f,0.f,1.f);
+         program->set4f(color,1.f,0.f,0.f,1.f);
+         REQUIRE( numCalls(*table,"glProgramUniform4f")==3 );
+         UniformHandle relinkedColor=program->getUniformHandle("color");
+         program->set4f(relinkedColor,1.f,0.f,0.f,1.f);
+         program->set4f(relinkedColor,1.f,0.f,0.f,1.f);
+         REQUIRE( numCalls(*table,"glProgramUniform4f")==4 );
+      }
+
+      THEN( "handle of other program is never cached" ) {
+         auto other=createProgram(table);
+         UniformHandle otherWeight1=other->getUniformHandle("weights[1]");
+         REQUIRE( otherWeight1.isValid() );
+         program->set1f(otherWeight1,1.f);
+         program->set1f(otherWeight1,1.f);
+         REQUIRE( numCalls(*table,"glProgramUniform1f")==2 );
+         other->set1f(otherWeight1,1.f);
+         other->set1f(otherWeight1,1.f);
+         REQUIRE( numCalls(*table,"glProgramUniform1f")==3 );
+      }
+   }
+
+   GIVEN( "uniform array" ) {
+
+      float values[3]={ 1.f,2.f,3.f };
+      program->set1fv(weights,values,3);
+      REQUIRE( numCalls(*table,"glProgramUniform1fv")==1 );
+
+      THEN( "array elements share the cache with the whole array" ) {
+         program->set1fv(weight1,values+1);
+         REQUIRE( numCalls(*table,"glProgramUniform1fv")==1 );
+         float value=5.f;
+         program->set1fv(weight1,&value);
+         REQUIRE( numCalls(*table,"glProgramUniform1fv")==2 );
+         program->set1fv(weights,values,3);
+         REQUIRE( numCalls(*table,"glProgramUniform1fv")==3 );
+      }
+
+      THEN( "setting of the array prefix of the same values is skipped" ) {
+         program->set1fv(weights,values,2);
+         REQUIRE( numCalls(*table,"glProgramUniform1fv")==1 );
+      }
+   }
+
+   GIVEN( "matrix set without transposition" ) {
+
+      program->setMatrix4fv(mvp,translation);
+      REQUIRE( numCalls(*table,"glProgramUniformMatrix4fv")==1 );
+
+      THEN( "the same matrix is skipped" ) {
+         program->setMatrix4fv(mvp,translation);
+         REQUIRE( numCalls(*table,"glProgramUniformMatrix4fv")==1 );
+      }
+
+      THEN( "transposed matrices are always set" ) {
+         program->setMatrix4fv(mvp,translation,1,GL_TRUE);
+         program->setMatrix4fv(mvp,translation,1,GL_TRUE);
+         REQUIRE( numCalls(*table,"glProgramUniformMatrix4fv")==3 );
+      }
+
+      THEN( "transposed matrix invalidates the cached value" ) {
+         program->setMatrix4fv(mvp,translation,1,GL_TRUE);
+         program->setMatrix4fv(mvp,translation);
+         REQUIRE( numCalls(*table,"glProgramUniformMatrix4fv")==3 );
+         program->setMatrix4fv(mvp,translation);
+         program->setMatrix4fv(mvp,identity);
+         REQUIRE( numCalls(*table,"glProgramUniformMatrix4fv")==4 );
+      }
+   }
+
+   GIVEN( "disabled uniform caching" ) {
+
+      program->setUniformCaching(false);
+
+      THEN( "every value is set" ) {
+         REQUIRE( !program->isUniformCachingEnabled() );
+         program->set4f(color,1.f,0.f,0.f,1.f);
+         program->set4f(color,1.f,0.f,0.f,1.f);
+         program->setMatrix4fv(mvp,identity);
+         program->setMatrix4fv(mvp,identity);
+         REQUIRE( numCalls(*table,"glProgramUniform4f")==2 );
+         REQUIRE( numCalls(*table,"glProgramUniformMatrix4fv")==2 );
+      }
+
+      THEN( "values set meanwhile are not skipped after it is enabled again" ) {
+         program->set4f(color,1.f,0.f,0.f,1.f);
+         program->setUniformCaching(true);
+         program->set4f(color,1.f,0.f,0.f,1.f);
+         REQUIRE( numCalls(*table,"glProgramUniform4f")==2 );
+         program->set4f(color,1.f,0.f,0.f,1.f);
+         REQUIRE( numCalls(*table,"glProgramUniform4f")==2 );
+      }
+   }
+}
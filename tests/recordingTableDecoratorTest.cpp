@@ -0,0 +1,298 @@
+#include<cstring>
+#include<memory>
+#include<sstream>
+#include<string>
+#include<vector>
+#include<geGL/NullLoader.h>
+#include<geGL/LoaderTableDecorator.h>
+#include<geGL/RecordingTableDecorator.h>
+#include<geGL/CallReplayer.h>
+
+#define CATCH_CONFIG_MAIN
+#include"catch.hpp"
+
+using namespace ge::gl;
+using namespace std;
+
+
+
+// NullLoader with functions that log calls together with client memory they read
+static vector<string> calls;
+static GLuint nextName=1;
+static uint8_t mapMemory[2][64];
+static size_t nofMaps=0;
+static uint8_t*mapped=nullptr;
+
+static string bytes(const void*data,size_t size)
+{
+   string s;
+   for(size_t i=0; i<size; i++)
+      s+=to_string(static_cast<const uint8_t*>(data)[i])+" ";
+   return s;
+}
+
+static void fakeGenBuffers(GLsizei n,GLuint*buffers)              { for(GLsizei i=0; i<n; i++) buffers[i]=nextName++; calls.push_back("glGenBuffers"); }
+static void fakeBindBuffer(GLenum target,GLuint buffer)           { calls.push_back("glBindBuffer "+to_string(target)+" "+to_string(buffer)); }
+static void fakeBufferSubData(GLenum,GLintptr offset,GLsizeiptr size,const void*data) { calls.push_back("glBufferSubData "+to_string(offset)+" "+bytes(data,size_t(size))); }
+static void fakeShaderSource(GLuint shader,GLsizei count,const GLchar*const*string,const GLint*) {
+   std::string s="glShaderSource "+to_string(shader);
+   for(GLsizei i=0; i<count; i++)
+      s+=std::string(" ")+string[i];
+   calls.push_back(s);
+}
+static void fakeUniform4fv(GLint location,GLsizei count,const GLfloat*value) { calls.push_back("glUniform4fv "+to_string(location)+" "+bytes(value,size_t(count)*4*sizeof(GLfloat))); }
+static void*fakeMapNamedBufferRange(GLuint buffer,GLintptr offset,GLsizeiptr,GLbitfield) {
+   calls.push_back("glMapNamedBufferRange "+to_string(buffer));
+   mapped=mapMemory[nofMaps++%2]+offset;
+   return mapped;
+}
+static void fakeDrawArrays(GLenum,GLint first,GLsizei count)      { calls.push_back("glDrawArrays "+bytes(mapped+first,size_t(count))); }
+static GLsync fakeFenceSync(GLenum,GLbitfield)                    { calls.push_back("glFenceSync"); return reinterpret_cast<GLsync>(size_t(nextName++)); }
+static GLenum fakeClientWaitSync(GLsync sync,GLbitfield,GLuint64) { calls.push_back("glClientWaitSync "+to_string(reinterpret_cast<size_t>(sync))); return GL_ALREADY_SIGNALED; }
+static void fakeGetIntegerv(GLenum,GLint*data)                    { calls.push_back("glGetIntegerv"); *data=7; }
+static void fakeMatrixLoaddEXT(GLenum mode,const GLdouble*m)      { calls.push_back("glMatrixLoaddEXT "+to_string(mode)+" "+bytes(m,16*sizeof(GLdouble))); }
+static void fakeFogfv(GLenum,const GLfloat*params)                { calls.push_back(params?"glFogfv params":"glFogfv"); }
+
+static shared_ptr<NullLoader> createLoggingLoader()
+{
+   auto loader=make_shared<NullLoader>();
+   loader->setFunction("glGenBuffers",fakeGenBuffers);
+   loader->setFunction("glBindBuffer",fakeBindBuffer);
+   loader->setFunction("glBufferSubData",fakeBufferSubData);
+   loader->setFunction("glShaderSource",fakeShaderSource);
+   loader->setFunction("glUniform4fv",fakeUniform4fv);
+   loader->setFunction("glMapNamedBufferRange",fakeMapNamedBufferRange);
+   loader->setFunction("glDrawArrays",fakeDrawArrays);
+   loader->setFunction("glFenceSync",fakeFenceSync);
+   loader->setFunction("glClientWaitSync",fakeClientWaitSync);
+   loader->setFunction("glGetIntegerv",fakeGetIntegerv);
+   loader->setFunction("glMatrixLoaddEXT",fakeMatrixLoaddEXT);
+   loader->setFunction("glFogfv",fakeFogfv);
+   return loader;
+}
+
+using RecordingTable=RecordingTableDecorator<LoaderTableDecorator<FunctionTable>>;
+using Table=LoaderTableDecorator<FunctionTable>;
+
+static void recordFrames(RecordingTable &gl)
+{
+   GLuint buffers[2];
+   gl.glGenBuffers(2,buffers);
+   gl.glBindBuffer(GL_ARRAY_BUFFER,buffers[1]);
+   uint8_t data[4]={1,2,3,4};
+   gl.glBufferSubData(GL_ARRAY_BUFFER,8,4,data);
+   data[0]=100;
+   const GLchar*sources[2]={"#version 450","void main(){}"};
+   gl.glShaderSource(3,2,sources,nullptr);
+   GLfloat values[8]={1,2,3,4,5,6,7,8};
+   gl.glUniform4fv(0,2,values);
+   uint8_t*p=static_cast<uint8_t*>(gl.glMapNamedBufferRange(buffers[0],0,64,GL_MAP_WRITE_BIT|GL_MAP_PERSISTENT_BIT|GL_MAP_COHERENT_BIT));
+   p[0]=10; p[1]=11;
+   gl.glDrawArrays(GL_POINTS,0,2);
+   p[1]=12; p[63]=13;
+   gl.glDrawArrays(GL_POINTS,0,2);
+   gl.glDrawArrays(GL_POINTS,62,2);
+   gl.recorder.endFrame();
+   GLsync sync=gl.glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE,0);
+   gl.glClientWaitSync(sync,0,0);
+   GLint value=0;
+   gl.glGetIntegerv(GL_MAX_VERTEX_ATTRIBS,&value);
+   gl.recorder.endFrame();
+}
+
+
+
+SCENARIO("RecordingTableDecorator records calls that are replayed by CallReplayer") {
+
+   auto loader=createLoggingLoader();
+   RecordingTable recording(loader);
+   recording.construct();
+   auto table=make_shared<Table>(loader);
+   table->construct();
+
+   calls.clear();
+   nextName=1;
+   nofMaps=0;
+   memset(mapMemory,0,sizeof(mapMemory));
+   recordFrames(recording);
+   vector<string> recordedCalls=calls;
+
+   GIVEN("recorded frames") {
+      THEN("calls are counted") {
+         REQUIRE(recording.recorder.getNofCalls()==12);
+         REQUIRE(recording.recorder.getNofFrames()==2);
+      }
+
+      WHEN("the stream is saved, loaded and replayed") {
+         stringstream stream;
+         recording.recorder.save(stream);
+         CallReplayer replayer(table);
+         REQUIRE(replayer.load(stream));
+         calls.clear();
+         nextName=1;
+         bool firstFrame=replayer.replayFrame();
+         size_t firstFrameCalls=calls.size();
+         bool secondFrame=replayer.replayFrame();
+         THEN("the same calls with the same client memory are issued") {
+            REQUIRE(firstFrame);
+            REQUIRE(secondFrame);
+            REQUIRE(firstFrameCalls==9);
+            REQUIRE(calls==recordedCalls);
+            REQUIRE(replayer.getNofReplayedCalls()==12);
+            REQUIRE(replayer.getNofReplayedFrames()==2);
+            REQUIRE(replayer.getNofNameMismatches()==0);
+            REQUIRE(replayer.replayFrame()==false);
+         }
+      }
+
+      WHEN("a frame is replayed again") {
+         CallReplayer replayer(table);
+         replayer.setData(recording.recorder.getData(),recording.recorder.getSize());
+         nextName=1;
+         replayer.replayFrame();
+         size_t position=replayer.getPosition();
+         replayer.replayFrame();
+         calls.clear();
+         replayer.setPosition(position);
+         replayer.replayFrame();
+         THEN("calls of the frame are issued") {
+            REQUIRE(calls.size()==3);
+            REQUIRE(calls[0]=="glFenceSync");
+         }
+      }
+
+      WHEN("objects get different names during replay") {
+         CallReplayer replayer(table);
+         replayer.setData(recording.recorder.getData(),recording.recorder.getSize());
+         nextName=100;
+         calls.clear();
+         replayer.replay();
+         THEN("mismatches are counted") {
+            REQUIRE(replayer.getNofNameMismatches()==2);
+         }
+         THEN("syncs are translated to replayed syncs") {
+            REQUIRE(calls[10]=="glClientWaitSync 102");
+         }
+      }
+   }
+
+   GIVEN("stream of different format") {
+      stringstream stream("not a recording");
+      CallReplayer replayer(table);
+      THEN("it is not loaded") {
+         REQUIRE(replayer.load(stream)==false);
+      }
+   }
+}
+
+
+SCENARIO("Client memory of unknown size is not recorded") {
+
+   auto loader=createLoggingLoader();
+   RecordingTable recording(loader);
+   recording.construct();
+   auto table=make_shared<Table>(loader);
+   table->construct();
+
+   GLdouble matrix[16];
+   for(unsigned i=0; i<16; i++)
+      matrix[i]=GLdouble(i);
+   GLfloat color[4]={1,2,3,4};
+   calls.clear();
+   recording.glMatrixLoaddEXT(GL_MODELVIEW,matrix);
+   recording.glFogfv(GL_FOG_COLOR,color);
+   recording.glFogfv(GL_FOG_COLOR,nullptr);
+   vector<string> recordedCalls=calls;
+
+   GIVEN("calls with and without size rule") {
+      THEN("calls are issued") {
+         REQUIRE(recordedCalls.size()==3);
+      }
+      THEN("call with memory of unknown size is refused") {
+         REQUIRE(recording.recorder.getNofCalls()==2);
+         REQUIRE(recording.recorder.getNofRefusedCalls()==1);
+      }
+      WHEN("the stream is replayed") {
+         CallReplayer replayer(table);
+         replayer.setData(recording.recorder.getData(),recording.recorder.getSize());
+         calls.clear();
+         replayer.replay();
+         THEN("the matrix is replayed and the refused call is missing") {
+            REQUIRE(calls.size()==2);
+            REQUIRE(calls[0]==recordedCalls[0]);
+            REQUIRE(calls[1]=="glFogfv");
+            REQUIRE(!replayer.isCorrupted());
+         }
+      }
+   }
+}
+
+
+SCENARIO("CallReplayer detects corrupted streams") {
+
+   auto loader=createLoggingLoader();
+   RecordingTable recording(loader);
+   recording.construct();
+   auto table=make_shared<Table>(loader);
+   table->construct();
+
+   uint8_t data[4]={1,2,3,4};
+   recording.glBufferSubData(GL_ARRAY_BUFFER,8,4,data);
+   vector<uint8_t> stream(recording.recorder.getData(),recording.recorder.getData()+recording.recorder.getSize());
+
+   GIVEN("truncated stream") {
+      THEN("no call is issued and corruption is reported") {
+         for(size_t size=1; size<stream.size(); size++) {
+            CallReplayer replayer(table);
+            replayer.setData(stream.data(),size);
+            calls.clear();
+            REQUIRE(replayer.replayCall()==false);
+            REQUIRE(replayer.isCorrupted());
+            REQUIRE(calls.empty());
+            REQUIRE(replayer.getNofReplayedCalls()==0);
+         }
+      }
+   }
+
+   GIVEN("stream with invalid size of client memory") {
+      uint64_t size=~uint64_t(0);
+      memcpy(stream.data()+4+sizeof(GLenum)+sizeof(GLintptr)+sizeof(GLsizeiptr),&size,sizeof(size));
+      CallReplayer replayer(table);
+      replayer.setData(stream.data(),stream.size());
+      calls.clear();
+      THEN("the call is not issued") {
+         REQUIRE(replayer.replayCall()==false);
+         REQUIRE(replayer.isCorrupted());
+         REQUIRE(calls.empty());
+      }
+   }
+
+   GIVEN("stream with unknown function") {
+      uint32_t id=0x7fffffffu;
+      memcpy(stream.data(),&id,sizeof(id));
+      CallReplayer replayer(table);
+      replayer.setData(stream.data(),stream.size());
+      THEN("replay stops") {
+         REQUIRE(replayer.replayFrame()==false);
+         REQUIRE(replayer.isCorrupted());
+         REQUIRE(replayer.getPosition()==replayer.getSize());
+      }
+      THEN("rewind clears the state") {
+         replayer.replay();
+         replayer.rewind();
+         REQUIRE(!replayer.isCorrupted());
+      }
+   }
+
+   GIVEN("valid stream") {
+      CallReplayer replayer(table);
+      replayer.setData(stream.data(),stream.size());
+      calls.clear();
+      THEN("it is replayed") {
+         REQUIRE(replayer.replayCall());
+         REQUIRE(replayer.replayCall()==false);
+         REQUIRE(!replayer.isCorrupted());
+         REQUIRE(calls.size()==1);
+      }
+   }
+}
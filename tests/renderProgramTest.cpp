@@ -0,0 +1,251 @@
+#include<algorithm>
+#include<memory>
+#include<string>
+#include<vector>
+#include<geGL/geGL.h>
+#include<geGL/NullLoader.h>
+#include<geRG/AttribStorage.h>
+#include<geRG/FlexibleUniform.h>
+#include<geRG/MatrixList.h>
+#include<geRG/RenderingContext.h>
+#include<geRG/RenderProgram.h>
+
+#define CATCH_CONFIG_MAIN
+#include"catch.hpp"
+
+using namespace ge::rg;
+using namespace std;
+
+
+
+// log of VAO binds, draw calls and commands executed during rendering
+static vector<string> callLog;
+
+
+class LoggingAttribStorage : public AttribStorage {
+protected:
+   unsigned _id;
+public:
+   LoggingAttribStorage(const AttribConfig& config,unsigned numVertices,unsigned numIndices,unsigned id)
+      : AttribStorage(config,numVertices,numIndices), _id(id)  {}
+   virtual void bind() const override  { callLog.push_back("bind "+to_string(_id)); }
+   virtual void draw(const vector<RenderingCommandData>& renderingDataList) override
+   {
+      string s="draw "+to_string(_id);
+      for(auto& r : renderingDataList)
+         s+=" "+to_string(r.glMode)+":"+to_string(r.drawCommandCount)+":"+to_string(r.stateSetBufferOffset4);
+      callLog.push_back(s);
+   }
+};
+
+
+class LoggingAttribStorageFactory : public AttribStorage::Factory {
+protected:
+   unsigned _numStorages=0;
+public:
+   virtual shared_ptr<AttribStorage> create(const AttribConfig& config,
+                                            unsigned numVertices,unsigned numIndices) override
+   { return make_shared<LoggingAttribStorage>(config,numVertices,numIndices,_numStorages++); }
+};
+
+
+class LoggingCommand : public ge::core::Command {
+protected:
+   string _name;
+public:
+   LoggingCommand(const string& name) : _name(name)  {}
+   virtual void operator()() override  { callLog.push_back(_name); }
+};
+
+
+class LoggingUseProgram : public FlexibleUseProgram {
+protected:
+   string _name;
+public:
+   LoggingUseProgram(const string& name) : FlexibleUseProgram(nullptr), _name(name)  {}
+   virtual void operator()() override  { callLog.push_back("use "+_name); }
+};
+
+
+/** Removes binds of already bound AttribStorage and use of already active program,
+ *  giving the calls that change the state.
+ */
+static vector<string> effectiveCalls(const vector<string>& calls)
+{
+   vector<string> r;
+   string boundStorage,activeProgram;
+   for(auto& c : calls) {
+      if(c.compare(0,5,"bind ")==0) {
+         if(c==boundStorage)
+            continue;
+         boundStorage=c;
+      }
+      else if(c.compare(0,4,"use ")==0) {
+         if(c==activeProgram)
+            continue;
+         activeProgram=c;
+      }
+      r.push_back(c);
+   }
+   return r;
+}
+
+
+static vector<string> draws(vector<string> calls)
+{
+   calls.erase(remove_if(calls.begin(),calls.end(),
+                         [](const string& c) { return c.compare(0,5,"draw ")!=0; }),
+               calls.end());
+   sort(calls.begin(),calls.end());
+   return calls;
+}
+
+
+static vector<string> renderTree(StateSet *root,bool useRenderProgram)
+{
+   RenderingContext::current()->setRenderProgramsEnabled(useRenderProgram);
+   callLog.clear();
+   root->render();
+   return callLog;
+}
+
+
+
+SCENARIO( "RenderProgram execution", "[RenderProgram]" )
+{
+   auto loader=make_shared<ge::gl::NullLoader>();
+   ge::gl::init(loader);
+   RenderingContext::setCurrent(make_shared<RenderingContext>());
+   auto rc=RenderingContext::current();
+   shared_ptr<AttribStorage::Factory> defaultFactory=AttribStorage::factory();
+   shared_ptr<AttribStorage::Factory> loggingFactory=make_shared<LoggingAttribStorageFactory>();
+   AttribStorage::setFactory(loggingFactory);
+
+   {
+      // meshes in two AttribStorages, mesh a2 shares AttribStorage with mesh a1
+      AttribConfig configA=rc->getAttribConfig({AttribType::Vec3},false);
+      AttribConfig configB=rc->getAttribConfig({AttribType::Vec3,AttribType::Vec3},false);
+      Mesh a1,a2,b;
+      a1.allocData(configA,3,0,1);
+      a2.allocData(configA,2,0,1);
+      b.allocData(configB,3,0,1);
+      vector<PrimitiveGpuData> triangles={ PrimitiveGpuData(3,0,false) };
+      vector<PrimitiveGpuData> lines={ PrimitiveGpuData(2,0,false) };
+      vector<unsigned> trianglesModesAndOffsets4={ GL_TRIANGLES,0 };
+      vector<unsigned> linesModesAndOffsets4={ GL_LINES,0 };
+      a1.setAndUploadPrimitives(triangles.data(),trianglesModesAndOffsets4.data(),1);
+      a2.setAndUploadPrimitives(lines.data(),linesModesAndOffsets4.data(),1);
+      b.setAndUploadPrimitives(triangles.data(),trianglesModesAndOffsets4.data(),1);
+      REQUIRE( a1.attribStorage()==a2.attribStorage() );
+      REQUIRE( a1.attribStorage()!=b.attribStorage() );
+
+      // root: use p1, u0, render
+      //   s1: default render
+      //   s2: u2, render
+      //   s3: use p1, u3, render
+      //   s4: use p2, render
+      //     s5: default render
+      auto p1=make_shared<LoggingUseProgram>("p1");
+      auto p2=make_shared<LoggingUseProgram>("p2");
+      vector<shared_ptr<StateSet>> ss(6);
+      for(auto& s : ss)
+         s=make_shared<StateSet>();
+      ss[0]->addCommand(p1);
+      ss[0]->addCommand(make_shared<LoggingCommand>("u0"));
+      ss[0]->addRenderCommand();
+      ss[2]->addCommand(make_shared<LoggingCommand>("u2"));
+      ss[2]->addRenderCommand();
+      ss[3]->addCommand(p1);
+      ss[3]->addCommand(make_shared<LoggingCommand>("u3"));
+      ss[3]->addRenderCommand();
+      ss[4]->addCommand(p2);
+      ss[4]->addRenderCommand();
+      for(unsigned i=1; i<=4; i++)
+         ss[0]->addChild(ss[i]);
+      ss[4]->addChild(ss[5]);
+
+      auto matrixList=make_shared<MatrixList>();
+      vector<pair<Mesh*,DrawableId>> drawables;
+      auto createDrawable=[&drawables,&matrixList](Mesh& mesh,StateSet *stateSet) {
+         drawables.emplace_back(&mesh,mesh.createDrawable(matrixList.get(),stateSet));
+      };
+      createDrawable(a1,ss[0].get());
+      createDrawable(a1,ss[1].get());
+      createDrawable(a2,ss[1].get());
+      createDrawable(b,ss[2].get());
+      createDrawable(b,ss[2].get());
+      createDrawable(a1,ss[3].get());
+      createDrawable(a2,ss[3].get());
+      createDrawable(b,ss[4].get());
+      createDrawable(b,ss[5].get());
+
+      GIVEN( "StateSet tree rendered by walking the tree" ) {
+
+         auto treeCalls=renderTree(ss[0].get(),false);
+         REQUIRE( draws(treeCalls).size()==6 );
+
+         THEN( "compiled RenderProgram makes the same state changes and draw calls" ) {
+            auto programCalls=renderTree(ss[0].get(),true);
+            REQUIRE( programCalls==effectiveCalls(treeCalls) );
+            REQUIRE( programCalls.size()<treeCalls.size() );
+         }
+
+         THEN( "recompiled RenderProgram follows changes of the tree" ) {
+            renderTree(ss[0].get(),true);
+            ss[2]->addCommand(make_shared<LoggingCommand>("u2b"));
+            createDrawable(a2,ss[4].get());
+            auto programCalls=renderTree(ss[0].get(),true);
+            treeCalls=renderTree(ss[0].get(),false);
+            REQUIRE( find(treeCalls.begin(),treeCalls.end(),"u2b")!=treeCalls.end() );
+            REQUIRE( programCalls==effectiveCalls(treeCalls) );
+         }
+
+         THEN( "recompiled RenderProgram follows removed and re-parented children" ) {
+            renderTree(ss[0].get(),true);
+            ss[0]->removeChild(ss[2]);
+            ss[4]->addChild(ss[2]);
+            auto programCalls=renderTree(ss[0].get(),true);
+            auto movedCalls=renderTree(ss[0].get(),false);
+            REQUIRE( programCalls==effectiveCalls(movedCalls) );
+            REQUIRE( draws(movedCalls)==draws(treeCalls) );
+            REQUIRE( movedCalls!=treeCalls );
+
+            ss[4]->removeChild(ss[2]);
+            programCalls=renderTree(ss[0].get(),true);
+            auto removedCalls=renderTree(ss[0].get(),false);
+            REQUIRE( programCalls==effectiveCalls(removedCalls) );
+            REQUIRE( find(programCalls.begin(),programCalls.end(),"u2")==programCalls.end() );
+            REQUIRE( draws(removedCalls).size()<draws(treeCalls).size() );
+         }
+
+         THEN( "sorted RenderProgram makes the same draw calls with fewer binds" ) {
+            RenderProgram program;
+            program.setSortingEnabled(true);
+            program.compile(ss[0].get());
+            callLog.clear();
+            program.execute();
+            auto sortedCalls=callLog;
+            REQUIRE( draws(sortedCalls)==draws(treeCalls) );
+            REQUIRE( sortedCalls==effectiveCalls(sortedCalls) );
+            auto numBinds=[](const vector<string>& calls) {
+               return count_if(calls.begin(),calls.end(),
+                               [](const string& c) { return c.compare(0,5,"bind ")==0; });
+            };
+            REQUIRE( numBinds(sortedCalls)<numBinds(effectiveCalls(treeCalls)) );
+
+            RenderProgram program2;
+            program2.setSortingEnabled(true);
+            program2.compile(ss[0].get());
+            callLog.clear();
+            program2.execute();
+            REQUIRE( callLog==sortedCalls );
+         }
+      }
+
+      for(auto& d : drawables)
+         d.first->deleteDrawable(d.second);
+   }
+
+   AttribStorage::setFactory(defaultFactory);
+   RenderingContext::setCurrent(nullptr);
+}
@@ -0,0 +1,271 @@
+#include<memory>
+#include<thread>
+#include<vector>
+#include<geGL/geGL.h>
+#include<geGL/NullLoader.h>
+#include<geRG/AttribStorage.h>
+#include<geRG/MatrixList.h>
+#include<geRG/Mesh.h>
+#include<geRG/RenderingContext.h>
+#include<geRG/SceneRecorder.h>
+
+#define CATCH_CONFIG_MAIN
+#include"catch.hpp"
+
+using namespace ge::rg;
+using namespace std;
+
+
+
+static vector<PrimitiveGpuData> primitiveContent(Mesh &mesh)
+{
+   RenderingContext::current()->unmapBuffers();
+   unsigned startIndex=RenderingContext::current()->primitiveStorage()->operator[](mesh.primitivesDataId()).startIndex;
+   vector<PrimitiveGpuData> data(mesh.primitiveList().size());
+   RenderingContext::current()->primitiveStorage()->buffer()->getData(
+         data.data(),data.size()*sizeof(PrimitiveGpuData),startIndex*sizeof(PrimitiveGpuData));
+   return data;
+}
+
+
+
+SCENARIO( "SceneRecorder recording", "[SceneRecorder]" )
+{
+   GIVEN( "a recorder" ) {
+
+      SceneRecorder r;
+      REQUIRE( r.empty() );
+      REQUIRE( !r.committed() );
+
+      WHEN( "a mesh with a drawable is recorded" ) {
+
+         Mesh mesh; // recording does not touch the mesh
+         vector<float> coords={ 0.f,2.f,0.f, 1.f,0.f,0.f, -1.f,0.f,0.f };
+         vector<float> normals={ 0.f,0.f,1.f, 0.f,0.f,1.f, 0.f,0.f,1.f };
+         vector<unsigned> indices={ 0,1,2 };
+         vector<PrimitiveGpuData> primitives={ PrimitiveGpuData(3,0,true) };
+         vector<unsigned> modesAndOffsets4={ 4,0 };
+         const void *attribList[]={ coords.data(),normals.data() };
+         AttribConfig::Configuration config({AttribType::Vec3,AttribType::Vec3},true);
+         auto m=r.addMesh(&mesh,config,attribList,3,indices.data(),3,
+                          primitives.data(),modesAndOffsets4.data(),1);
+         auto d=r.addDrawable(m,nullptr,0);
+         r.setDrawableBounds(d,glm::vec3(0.f),2.f);
+         r.setDrawableMaterial(d,1);
+
+         THEN( "the data are copied into the arena" ) {
+            REQUIRE( m==0 );
+            REQUIRE( d==0 );
+            REQUIRE( r.numMeshes()==1 );
+            REQUIRE( r.numDrawables()==1 );
+            REQUIRE( r.arenaSize()>=2*36+12+12+8 );
+            REQUIRE( !r.empty() );
+         }
+
+         THEN( "clear removes the records" ) {
+            r.clear();
+            REQUIRE( r.empty() );
+            REQUIRE( r.arenaSize()==0 );
+         }
+      }
+   }
+
+   GIVEN( "recorders filled by worker threads" ) {
+
+      vector<SceneRecorder> recorders(4);
+      vector<thread> threads;
+      for(auto& rec : recorders)
+         threads.emplace_back([&rec]() {
+            vector<float> coords(300,1.f);
+            const void *attribList[]={ coords.data() };
+            AttribConfig::Configuration config({AttribType::Vec3},false);
+            vector<PrimitiveGpuData> primitives={ PrimitiveGpuData(100,0,false) };
+            vector<unsigned> modesAndOffsets4={ 4,0 };
+            vector<Mesh> meshes(100);
+            for(unsigned i=0; i<100; i++) {
+               auto m=rec.addMesh(&meshes[i],config,attribList,100,nullptr,0,
+                                  primitives.data(),modesAndOffsets4.data(),1);
+               rec.addDrawable(m,nullptr,0);
+            }
+         });
+      for(auto& t : threads)
+         t.join();
+
+      THEN( "each of them holds its own records" ) {
+         for(auto& rec : recorders) {
+            REQUIRE( rec.numMeshes()==100 );
+            REQUIRE( rec.numDrawables()==100 );
+            REQUIRE( rec.arenaSize()>=100*(1200+12+8) );
+         }
+      }
+   }
+}
+
+
+SCENARIO( "SceneRecorder commit", "[SceneRecorder]" )
+{
+   auto loader=make_shared<ge::gl::NullLoader>();
+   ge::gl::init(loader);
+   RenderingContext::setCurrent(make_shared<RenderingContext>());
+   auto rc=RenderingContext::current();
+
+   {
+      vector<float> coords={ 0.f,2.f,0.f, 1.f,0.f,0.f, -1.f,0.f,0.f };
+      vector<unsigned> indices={ 0,1,2 };
+      vector<PrimitiveGpuData> primitives={ PrimitiveGpuData(3,0,true) };
+      vector<unsigned> modesAndOffsets4={ GL_TRIANGLES,0 };
+      const void *attribList[]={ coords.data() };
+      AttribConfig::Configuration config({AttribType::CompressedPosition},true);
+      auto matrixList=make_shared<MatrixList>();
+      auto stateSet=make_shared<StateSet>();
+      Mesh mesh;
+
+      GIVEN( "a recorder with compressed mesh and two Drawables" ) {
+
+         auto r=make_shared<SceneRecorder>();
+         auto m=r->addMesh(&mesh,config,attribList,3,indices.data(),3,
+                           primitives.data(),modesAndOffsets4.data(),1);
+         auto s=r->addStateSet(stateSet);
+         auto d1=r->addDrawable(m,matrixList.get(),s);
+         auto d2=r->addDrawable(m,matrixList.get(),s);
+         r->setDrawableBounds(d1,glm::vec3(1.f,2.f,3.f),4.f);
+         r->setDrawableMaterial(d2,5);
+
+         THEN( "the attributes are encoded into the arena" ) {
+            REQUIRE( r->arenaSize()<3*12+12+12+8 );
+         }
+
+         WHEN( "it is committed" ) {
+
+            rc->submitSceneRecorder(r);
+            rc->commitSceneRecorders();
+
+            THEN( "the mesh is uploaded in the encoded format" ) {
+               REQUIRE( r->committed() );
+               REQUIRE( mesh.numVertices()==3 );
+               REQUIRE( mesh.numIndices()==3 );
+               vector<uint8_t> expected(3*AttribType::CompressedPosition.elementSize());
+               AttribType::CompressedPosition.encode(expected.data(),coords.data(),3);
+               vector<uint8_t> uploaded(expected.size());
+               AttribStorage *storage=mesh.attribStorage();
+               storage->buffer(0)->getData(uploaded.data(),uploaded.size(),
+                     storage->vertexArrayAllocation(mesh.verticesDataId()).startIndex*
+                     AttribType::CompressedPosition.elementSize());
+               REQUIRE( uploaded==expected );
+            }
+
+            THEN( "Drawables are created with their bounds and materials" ) {
+               DrawableId id1=r->drawableId(d1);
+               DrawableId id2=r->drawableId(d2);
+               REQUIRE( id1!=DrawableId(nullptr) );
+               REQUIRE( id2!=DrawableId(nullptr) );
+               REQUIRE( id1->stateSet==stateSet.get() );
+               REQUIRE( id1->matrixList==matrixList.get() );
+               REQUIRE( stateSet->drawableCount()==2 );
+               const BoundingSphereGpuData& b1=rc->drawCommandBounds()[id1->item(0).index()];
+               const BoundingSphereGpuData& b2=rc->drawCommandBounds()[id2->item(0).index()];
+               REQUIRE( b1.center[0]==1.f );
+               REQUIRE( b1.center[2]==3.f );
+               REQUIRE( b1.radius==4.f );
+               REQUIRE( b2.radius<0.f );
+               REQUIRE( rc->drawCommandMaterials()[id1->item(0).index()]==0 );
+               REQUIRE( rc->drawCommandMaterials()[id2->item(0).index()]==5 );
+            }
+
+            mesh.deleteDrawable(r->drawableId(d1));
+            mesh.deleteDrawable(r->drawableId(d2));
+         }
+      }
+
+      GIVEN( "a recorder with meshes of one and three primitives" ) {
+
+         // odd number of primitives makes PrimitiveGpuData end off the arena alignment
+         vector<PrimitiveGpuData> primitives3={ PrimitiveGpuData(3,0,true),
+                                                PrimitiveGpuData(2,1,false),
+                                                PrimitiveGpuData(3,0,false) };
+         vector<unsigned> modesAndOffsets3={ GL_TRIANGLES,0, GL_LINES,3, GL_TRIANGLE_STRIP,6 };
+         Mesh mesh3;
+         auto r=make_shared<SceneRecorder>();
+         r->addMesh(&mesh,config,attribList,3,indices.data(),3,
+                    primitives.data(),modesAndOffsets4.data(),1);
+         r->addMesh(&mesh3,config,attribList,3,indices.data(),3,
+                    primitives3.data(),modesAndOffsets3.data(),3);
+
+         WHEN( "it is committed" ) {
+
+            rc->submitSceneRecorder(r);
+            rc->commitSceneRecorders();
+
+            THEN( "primitive modes and offsets are generated from the recorded data" ) {
+               REQUIRE( mesh.primitiveList().size()==1 );
+               REQUIRE( mesh.primitiveList()[0].mode()==GL_TRIANGLES );
+               REQUIRE( mesh.primitiveList()[0].offset4()==0 );
+               REQUIRE( mesh3.primitiveList().size()==3 );
+               for(unsigned i=0; i<3; i++) {
+                  REQUIRE( mesh3.primitiveList()[i].mode()==modesAndOffsets3[i*2+0] );
+                  REQUIRE( mesh3.primitiveList()[i].offset4()==modesAndOffsets3[i*2+1] );
+               }
+            }
+
+            THEN( "PrimitiveGpuData are uploaded with vertex and index offsets" ) {
+               AttribStorage *storage=mesh3.attribStorage();
+               unsigned vertexOffset=storage->vertexArrayAllocation(mesh3.verticesDataId()).startIndex;
+               unsigned indexOffset=storage->indexArrayAllocation(mesh3.indicesDataId()).startIndex;
+               auto data=primitiveContent(mesh3);
+               REQUIRE( data[0].countAndIndexedFlag==primitives3[0].countAndIndexedFlag );
+               REQUIRE( data[0].first==indexOffset );
+               REQUIRE( data[1].countAndIndexedFlag==2 );
+               REQUIRE( data[1].first==1 );
+               REQUIRE( data[2].countAndIndexedFlag==3 );
+               REQUIRE( data[2].first==0 );
+               for(auto& p : data)
+                  REQUIRE( p.vertexOffset==vertexOffset );
+               auto data1=primitiveContent(mesh);
+               REQUIRE( data1.size()==1 );
+               REQUIRE( data1[0].first==storage->indexArrayAllocation(mesh.indicesDataId()).startIndex );
+               REQUIRE( data1[0].vertexOffset==storage->vertexArrayAllocation(mesh.verticesDataId()).startIndex );
+            }
+         }
+      }
+
+      GIVEN( "recorders submitted with commit budget" ) {
+
+         vector<Mesh> meshes(3);
+         vector<shared_ptr<SceneRecorder>> recorders;
+         for(auto& mesh : meshes) {
+            recorders.emplace_back(make_shared<SceneRecorder>());
+            auto m=recorders.back()->addMesh(&mesh,config,attribList,3,indices.data(),3,
+                                             primitives.data(),modesAndOffsets4.data(),1);
+            recorders.back()->addDrawable(m,matrixList.get(),recorders.back()->addStateSet(stateSet));
+            rc->submitSceneRecorder(recorders.back());
+         }
+         rc->setSceneRecorderCommitBudget(recorders[0]->arenaSize()*2);
+
+         THEN( "each frame commits the recorders fitting into the budget in submission order" ) {
+            rc->commitSceneRecorders();
+            REQUIRE( recorders[0]->committed() );
+            REQUIRE( recorders[1]->committed() );
+            REQUIRE( !recorders[2]->committed() );
+            rc->commitSceneRecorders();
+            REQUIRE( recorders[2]->committed() );
+         }
+
+         THEN( "recorder larger than the budget is committed alone" ) {
+            rc->setSceneRecorderCommitBudget(1);
+            rc->commitSceneRecorders();
+            REQUIRE( recorders[0]->committed() );
+            REQUIRE( !recorders[1]->committed() );
+            rc->setSceneRecorderCommitBudget(0);
+            rc->commitSceneRecorders();
+            REQUIRE( recorders[1]->committed() );
+            REQUIRE( recorders[2]->committed() );
+         }
+
+         rc->commitSceneRecorders();
+         for(unsigned i=0; i<3; i++)
+            meshes[i].deleteDrawable(recorders[i]->drawableId(0));
+      }
+   }
+
+   RenderingContext::setCurrent(nullptr);
+}
@@ -0,0 +1,218 @@
+#include<memory>
+#include<string>
+#include<geGL/geGL.h>
+#include<geGL/NullLoader.h>
+#include<geGL/LoaderTableDecorator.h>
+#include<geGL/ShaderPreprocessor.h>
+
+#define CATCH_CONFIG_MAIN
+#include"catch.hpp"
+
+using namespace ge::gl;
+using namespace std;
+
+
+
+static size_t count(const string&s,const string&what)
+{
+   size_t n=0;
+   for(size_t i=s.find(what); i!=string::npos; i=s.find(what,i+1))
+      n++;
+   return n;
+}
+
+
+SCENARIO( "Shader preprocessor resolves includes", "[ShaderPreprocessor]" )
+{
+   ShaderPreprocessor preprocessor;
+   preprocessor.addFile("common/math.glsl","#pragma once\nfloat sqr(float x){return x*x;}\n");
+   preprocessor.addFile("common/light.glsl","#include \"math.glsl\"\nuniform vec4 light;\n");
+   preprocessor.addFile("shading.frag","#version 450\n#include <common/light.glsl>\n#include \"common/math.glsl\"\nout vec4 fColor;\nvoid main(){fColor=light*sqr(2);}\n");
+
+   GIVEN( "expanded file" ) {
+
+      string expanded=preprocessor.expand("shading.frag");
+
+      THEN( "includes are resolved relative to includer and only once with #pragma once" ) {
+         REQUIRE( count(expanded,"float sqr")==1 );
+         REQUIRE( count(expanded,"uniform vec4 light")==1 );
+         REQUIRE( count(expanded,"#include")==0 );
+         REQUIRE( expanded.find("#line 1 "+to_string(preprocessor.getFileIndex("common/light.glsl")))!=string::npos );
+         REQUIRE( expanded.find("#line 3 "+to_string(preprocessor.getFileIndex("shading.frag")))!=string::npos );
+         REQUIRE( preprocessor.getFileName(preprocessor.getFileIndex("common/math.glsl"))=="common/math.glsl" );
+      }
+   }
+
+   GIVEN( "file with missing or circular include" ) {
+
+      preprocessor.addFile("missing.glsl","#include \"nothing.glsl\"\n");
+      preprocessor.addFile("a.glsl","#include \"b.glsl\"\n");
+      preprocessor.addFile("b.glsl","#include \"a.glsl\"\n");
+
+      THEN( "expansion fails" ) {
+         REQUIRE( preprocessor.expand("missing.glsl").empty() );
+         REQUIRE( preprocessor.expand("a.glsl").empty() );
+         REQUIRE( preprocessor.getSources("a.glsl").empty() );
+      }
+   }
+
+   GIVEN( "sources of variant" ) {
+
+      auto sources=preprocessor.getSources("shading.frag",{{"SHADOWS",""},{"LIGHTS","4"}});
+
+      THEN( "defines follow #version" ) {
+         REQUIRE( sources.size()==4 );
+         REQUIRE( sources[0]=="#version 450\n" );
+         REQUIRE( sources[1]==Shader::define("LIGHTS","4") );
+         REQUIRE( sources[2]==Shader::define("SHADOWS") );
+         REQUIRE( sources[3].find("#line 2 ")==0 );
+      }
+   }
+
+   GIVEN( "sources of file starting with comments" ) {
+
+      preprocessor.addFile("licensed.frag",
+         "/* Copyright\n"
+         " * license */\n"
+         "// shading\n"
+         "\n"
+         "#version 450 /* core\n"
+         "profile */\n"
+         "void main(){}\n");
+      auto sources=preprocessor.getSources("licensed.frag",{{"LIGHTS","4"}});
+
+      THEN( "defines follow #version and its comment" ) {
+         REQUIRE( sources.size()==3 );
+         REQUIRE( sources[0].find("#version 450")!=string::npos );
+         REQUIRE( sources[0].find("profile */\n")==sources[0].size()-11 );
+         REQUIRE( sources[1]==Shader::define("LIGHTS","4") );
+         REQUIRE( sources[2].find("#line 7 ")==0 );
+      }
+   }
+}
+
+
+SCENARIO( "Variant keys are canonical", "[ShaderPreprocessor]" )
+{
+   ShaderPreprocessor::Defines a;
+   a["SHADOWS"]="";
+   a["LIGHTS"]="4";
+   ShaderPreprocessor::Defines b;
+   b["LIGHTS"]="4";
+   b["SHADOWS"]="";
+
+   REQUIRE( ShaderPreprocessor::getVariantKey(a)==ShaderPreprocessor::getVariantKey(b) );
+   REQUIRE( ShaderPreprocessor::getVariantKey(a)=="LIGHTS=4;SHADOWS" );
+   b["LIGHTS"]="8";
+   REQUIRE( ShaderPreprocessor::getVariantKey(a)!=ShaderPreprocessor::getVariantKey(b) );
+}
+
+
+SCENARIO( "Programs are memoized per variant", "[ShaderPreprocessor]" )
+{
+   auto loader=make_shared<NullLoader>();
+   ge::gl::init(loader);
+   ShaderPreprocessor preprocessor;
+   preprocessor.addFile("common.glsl","uniform mat4 mvp;\n");
+   preprocessor.addFile("draw.vert","#version 450\n#include \"common.glsl\"\nvoid main(){gl_Position=mvp*vec4(1);}\n");
+   preprocessor.addFile("draw.frag","#version 450\nuniform vec4 color;\nout vec4 fColor;\nvoid main(){fColor=color;}\n");
+   ShaderPreprocessor::Stages stages={{GL_VERTEX_SHADER,"draw.vert"},{GL_FRAGMENT_SHADER,"draw.frag"}};
+
+   GIVEN( "program" ) {
+
+      auto program=preprocessor.createProgram(stages,{{"LIGHTS","4"}});
+
+      THEN( "it is linked from expanded sources" ) {
+         REQUIRE( program!=nullptr );
+         REQUIRE( program->getLinkStatus()==GL_TRUE );
+         REQUIRE( program->getInfo()->uniforms.count("mvp")==1 );
+         REQUIRE( preprocessor.getNofMisses()==1 );
+      }
+
+      WHEN( "the same variant is requested again" ) {
+         auto again=preprocessor.createProgram(stages,{{"LIGHTS","4"}});
+
+         THEN( "program is shared" ) {
+            REQUIRE( again==program );
+            REQUIRE( preprocessor.getNofHits()==1 );
+            REQUIRE( preprocessor.getNofPrograms()==1 );
+         }
+      }
+
+      WHEN( "different variant is requested" ) {
+         auto other=preprocessor.createProgram(stages,{{"LIGHTS","8"}});
+
+         THEN( "new program is created" ) {
+            REQUIRE( other!=program );
+            REQUIRE( preprocessor.getNofPrograms()==2 );
+         }
+      }
+
+      WHEN( "included file changes" ) {
+         preprocessor.addFile("common.glsl","uniform mat4 mvp;\nuniform float time;\n");
+         auto changed=preprocessor.createProgram(stages,{{"LIGHTS","4"}});
+
+         THEN( "program is recompiled" ) {
+            REQUIRE( changed!=program );
+            REQUIRE( changed->getInfo()->uniforms.count("time")==1 );
+         }
+      }
+
+      WHEN( "file is missing" ) {
+
+         THEN( "no program is created" ) {
+            REQUIRE( preprocessor.createProgram({{GL_VERTEX_SHADER,"none.vert"}})==nullptr );
+         }
+      }
+   }
+}
+
+
+SCENARIO( "Programs are memoized per function table", "[ShaderPreprocessor]" )
+{
+   auto loader=make_shared<NullLoader>();
+   ShaderPreprocessor preprocessor;
+   preprocessor.addFile("draw.vert","#version 450\nvoid main(){gl_Position=vec4(1);}\n");
+   ShaderPreprocessor::Stages stages={{GL_VERTEX_SHADER,"draw.vert"}};
+   auto createTable=[&loader]() {
+      auto table=make_shared<LoaderTableDecorator<FunctionTable>>(loader);
+      table->construct();
+      return FunctionTablePointer(table);
+   };
+   auto table1=createTable();
+   auto table2=createTable();
+
+   GIVEN( "programs of two tables" ) {
+
+      auto program1=preprocessor.createProgram(table1,stages);
+      auto program2=preprocessor.createProgram(table2,stages);
+
+      THEN( "each table gets its own program" ) {
+         REQUIRE( program1!=program2 );
+         REQUIRE( preprocessor.createProgram(table1,stages)==program1 );
+         REQUIRE( preprocessor.getNofPrograms()==2 );
+      }
+
+      WHEN( "programs of one table are cleared" ) {
+
+         weak_ptr<FunctionTable const> released=table1;
+         preprocessor.clearPrograms(table1);
+         program1=nullptr;
+         table1=nullptr;
+
+         THEN( "the table is released and programs of the other table are kept" ) {
+            REQUIRE( released.expired() );
+            REQUIRE( preprocessor.getNofPrograms()==1 );
+            REQUIRE( preprocessor.createProgram(table2,stages)==program2 );
+         }
+
+         THEN( "new table does not get program of the released one" ) {
+            auto table3=createTable();
+            auto program3=preprocessor.createProgram(table3,stages);
+            REQUIRE( program3!=nullptr );
+            REQUIRE( program3!=program2 );
+            REQUIRE( preprocessor.getNofMisses()==3 );
+         }
+      }
+   }
+}
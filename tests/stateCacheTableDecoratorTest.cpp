@@ -0,0 +1,350 @@
+#include<memory>
+#include<string>
+#include<vector>
+#include<geGL/NullLoader.h>
+#include<geGL/OpenGL.h>
+#include<geGL/LoaderTableDecorator.h>
+#include<geGL/DSATableDecorator.h>
+#include<geGL/StateCacheTableDecorator.h>
+
+#define CATCH_CONFIG_MAIN
+#include"catch.hpp"
+
+using namespace ge::gl;
+using namespace std;
+
+
+
+// NullLoader with functions that record their names,
+// every query returns 0
+static vector<string> calls;
+
+static void fakeBindBuffer(GLenum,GLuint)                         { calls.push_back("glBindBuffer"); }
+static void fakeBufferSubData(GLenum,GLintptr,GLsizeiptr,const void*) { calls.push_back("glBufferSubData"); }
+static void fakeDeleteBuffers(GLsizei,const GLuint*)              { calls.push_back("glDeleteBuffers"); }
+static void fakeBindVertexArray(GLuint)                           { calls.push_back("glBindVertexArray"); }
+static void fakeDeleteVertexArrays(GLsizei,const GLuint*)         { calls.push_back("glDeleteVertexArrays"); }
+static void fakeVertexArrayElementBuffer(GLuint,GLuint)           { calls.push_back("glVertexArrayElementBuffer"); }
+static void fakeUseProgram(GLuint)                                { calls.push_back("glUseProgram"); }
+static void fakeActiveTexture(GLenum)                             { calls.push_back("glActiveTexture"); }
+static void fakeBindTexture(GLenum,GLuint)                        { calls.push_back("glBindTexture"); }
+static void fakeBindTextureUnit(GLuint,GLuint)                    { calls.push_back("glBindTextureUnit"); }
+static void fakeDeleteTextures(GLsizei,const GLuint*)             { calls.push_back("glDeleteTextures"); }
+static void fakeEnable(GLenum)                                    { calls.push_back("glEnable"); }
+static void fakeDisable(GLenum)                                   { calls.push_back("glDisable"); }
+static GLboolean fakeIsEnabled(GLenum)                            { calls.push_back("glIsEnabled"); return GL_FALSE; }
+static void fakeGetIntegerv(GLenum,GLint*data)                    { calls.push_back("glGetIntegerv"); *data=0; }
+static void fakeGetIntegeri_v(GLenum,GLuint,GLint*)               { calls.push_back("glGetIntegeri_v"); }
+static void fakeBindSampler(GLuint,GLuint)                        { calls.push_back("glBindSampler"); }
+
+static shared_ptr<NullLoader> createRecordingLoader()
+{
+   auto loader=make_shared<NullLoader>();
+   loader->setFunction("glBindBuffer",fakeBindBuffer);
+   loader->setFunction("glBufferSubData",fakeBufferSubData);
+   loader->setFunction("glDeleteBuffers",fakeDeleteBuffers);
+   loader->setFunction("glBindVertexArray",fakeBindVertexArray);
+   loader->setFunction("glDeleteVertexArrays",fakeDeleteVertexArrays);
+   loader->setFunction("glVertexArrayElementBuffer",fakeVertexArrayElementBuffer);
+   loader->setFunction("glUseProgram",fakeUseProgram);
+   loader->setFunction("glActiveTexture",fakeActiveTexture);
+   loader->setFunction("glBindTexture",fakeBindTexture);
+   loader->setFunction("glBindTextureUnit",fakeBindTextureUnit);
+   loader->setFunction("glDeleteTextures",fakeDeleteTextures);
+   loader->setFunction("glEnable",fakeEnable);
+   loader->setFunction("glDisable",fakeDisable);
+   loader->setFunction("glIsEnabled",fakeIsEnabled);
+   loader->setFunction("glGetIntegerv",fakeGetIntegerv);
+   loader->setFunction("glGetIntegeri_v",fakeGetIntegeri_v);
+   loader->setFunction("glBindSampler",fakeBindSampler);
+   // buffer updates are emulated by DSATableDecorator
+   loader->setFunction("glNamedBufferSubData",nullptr);
+   loader->setFunction("glNamedBufferSubDataEXT",nullptr);
+   return loader;
+}
+
+using Table=StateCacheTableDecorator<DSATableDecorator<LoaderTableDecorator<FunctionTable>>>;
+
+static size_t numCalls(const string &name)
+{
+   size_t n=0;
+   for(auto &c : calls)
+      if(c==name) n++;
+   return n;
+}
+
+
+
+SCENARIO("StateCacheTableDecorator eliminates redundant state changes") {
+
+   Table table(createRecordingLoader());
+   table.construct();
+   calls.clear();
+
+   GIVEN("a bound buffer") {
+      table.glBindBuffer(GL_ARRAY_BUFFER,1);
+
+      WHEN("binding the same buffer again") {
+         table.glBindBuffer(GL_ARRAY_BUFFER,1);
+         THEN("the call is dropped") {
+            REQUIRE(numCalls("glBindBuffer")==1);
+         }
+      }
+      WHEN("binding another buffer") {
+         table.glBindBuffer(GL_ARRAY_BUFFER,2);
+         THEN("the call is issued") {
+            REQUIRE(numCalls("glBindBuffer")==2);
+         }
+      }
+      WHEN("querying the binding") {
+         GLint id=-1;
+         table.glGetIntegerv(GL_ARRAY_BUFFER_BINDING,&id);
+         THEN("it is answered without OpenGL") {
+            REQUIRE(id==1);
+            REQUIRE(numCalls("glGetIntegerv")==0);
+         }
+      }
+      WHEN("the buffer is deleted and its name is bound again") {
+         GLuint id=1;
+         table.glDeleteBuffers(1,&id);
+         table.glBindBuffer(GL_ARRAY_BUFFER,0);
+         table.glBindBuffer(GL_ARRAY_BUFFER,1);
+         THEN("binding 0 is dropped and the name is bound") {
+            REQUIRE(numCalls("glBindBuffer")==2);
+         }
+      }
+      WHEN("the cache is invalidated") {
+         table.invalidateStateCache();
+         table.glBindBuffer(GL_ARRAY_BUFFER,1);
+         THEN("the same buffer is bound again") {
+            REQUIRE(numCalls("glBindBuffer")==2);
+         }
+      }
+   }
+
+   GIVEN("an unknown binding") {
+      WHEN("querying it twice") {
+         GLint id=-1;
+         table.glGetIntegerv(GL_COPY_WRITE_BUFFER_BINDING,&id);
+         table.glGetIntegerv(GL_COPY_WRITE_BUFFER_BINDING,&id);
+         THEN("only the first query goes to OpenGL") {
+            REQUIRE(id==0);
+            REQUIRE(numCalls("glGetIntegerv")==1);
+         }
+      }
+   }
+
+   GIVEN("DSA emulated by binding to GL_COPY_WRITE_BUFFER") {
+      WHEN("updating a buffer twice") {
+         char data[4]={};
+         table.glNamedBufferSubData(5,0,4,data);
+         table.glNamedBufferSubData(5,0,4,data);
+         THEN("the previous binding is queried only once") {
+            REQUIRE(numCalls("glGetIntegerv")==1);
+            REQUIRE(numCalls("glBufferSubData")==2);
+         }
+      }
+   }
+
+   GIVEN("element buffer bound to a vertex array") {
+      table.glBindVertexArray(1);
+      table.glBindBuffer(GL_ELEMENT_ARRAY_BUFFER,3);
+
+      WHEN("switching vertex arrays and binding the element buffer again") {
+         table.glBindVertexArray(2);
+         table.glBindVertexArray(1);
+         table.glBindBuffer(GL_ELEMENT_ARRAY_BUFFER,3);
+         THEN("the element buffer binding is issued, it is vertex array state") {
+            REQUIRE(numCalls("glBindVertexArray")==3);
+            REQUIRE(numCalls("glBindBuffer")==2);
+         }
+      }
+      WHEN("binding the same vertex array") {
+         table.glBindVertexArray(1);
+         THEN("the call is dropped") {
+            REQUIRE(numCalls("glBindVertexArray")==1);
+         }
+      }
+      WHEN("element buffer of the bound vertex array is set by DSA") {
+         table.glVertexArrayElementBuffer(1,4);
+         GLint id=-1;
+         table.glGetIntegerv(GL_ELEMENT_ARRAY_BUFFER_BINDING,&id);
+         table.glBindBuffer(GL_ELEMENT_ARRAY_BUFFER,3);
+         THEN("the binding follows it") {
+            REQUIRE(id==4);
+            REQUIRE(numCalls("glGetIntegerv")==0);
+            REQUIRE(numCalls("glBindBuffer")==2);
+         }
+      }
+      WHEN("element buffer of another vertex array is set by DSA") {
+         table.glVertexArrayElementBuffer(2,4);
+         table.glBindBuffer(GL_ELEMENT_ARRAY_BUFFER,3);
+         THEN("the binding is kept") {
+            REQUIRE(numCalls("glBindBuffer")==1);
+         }
+      }
+      WHEN("another vertex array is deleted") {
+         GLuint id=2;
+         table.glDeleteVertexArrays(1,&id);
+         table.glBindBuffer(GL_ELEMENT_ARRAY_BUFFER,3);
+         THEN("the binding is kept") {
+            REQUIRE(numCalls("glBindBuffer")==1);
+         }
+      }
+      WHEN("the bound vertex array is deleted") {
+         GLuint id=1;
+         table.glDeleteVertexArrays(1,&id);
+         table.glBindBuffer(GL_ELEMENT_ARRAY_BUFFER,3);
+         THEN("the element buffer binding is forgotten") {
+            REQUIRE(numCalls("glBindBuffer")==2);
+         }
+      }
+   }
+
+   GIVEN("element buffer bound to unknown vertex array") {
+      table.glBindBuffer(GL_ELEMENT_ARRAY_BUFFER,3);
+
+      WHEN("element buffer of some vertex array is set by DSA") {
+         table.glVertexArrayElementBuffer(1,4);
+         table.glBindBuffer(GL_ELEMENT_ARRAY_BUFFER,3);
+         THEN("the binding is forgotten") {
+            REQUIRE(numCalls("glBindBuffer")==2);
+         }
+      }
+      WHEN("some vertex array is deleted") {
+         GLuint id=1;
+         table.glDeleteVertexArrays(1,&id);
+         table.glBindBuffer(GL_ELEMENT_ARRAY_BUFFER,3);
+         THEN("the binding is forgotten") {
+            REQUIRE(numCalls("glBindBuffer")==2);
+         }
+      }
+   }
+
+   GIVEN("textures bound to two units") {
+      table.glActiveTexture(GL_TEXTURE1);
+      table.glBindTexture(GL_TEXTURE_2D,3);
+      table.glActiveTexture(GL_TEXTURE0);
+      table.glBindTexture(GL_TEXTURE_2D,4);
+
+      WHEN("binding the same textures again") {
+         table.glBindTexture(GL_TEXTURE_2D,4);
+         table.glActiveTexture(GL_TEXTURE1);
+         table.glBindTexture(GL_TEXTURE_2D,3);
+         THEN("only the change of active texture is issued") {
+            REQUIRE(numCalls("glBindTexture")==2);
+            REQUIRE(numCalls("glActiveTexture")==3);
+         }
+      }
+      WHEN("querying the texture binding of active unit") {
+         GLint id=-1;
+         table.glGetIntegerv(GL_TEXTURE_BINDING_2D,&id);
+         THEN("it is answered without OpenGL") {
+            REQUIRE(id==4);
+            REQUIRE(numCalls("glGetIntegerv")==0);
+         }
+      }
+   }
+
+   GIVEN("unknown sampler bindings and active unit 0") {
+      table.glActiveTexture(GL_TEXTURE0);
+
+      WHEN("binding a sampler to a unit") {
+         table.glBindSampler(4,0);
+         THEN("the first bind is issued") {
+            REQUIRE(numCalls("glBindSampler")==1);
+         }
+      }
+      WHEN("querying sampler binding of another unit") {
+         GLint id=-1;
+         table.glGetIntegeri_v(GL_SAMPLER_BINDING,3,&id);
+         table.glBindSampler(3,0);
+         THEN("it is queried on that unit by glGetIntegerv and the active unit is restored") {
+            REQUIRE(id==0);
+            REQUIRE(numCalls("glGetIntegeri_v")==0);
+            REQUIRE(numCalls("glGetIntegerv")==1);
+            REQUIRE(numCalls("glActiveTexture")==3);
+            REQUIRE(numCalls("glBindSampler")==0);
+         }
+      }
+   }
+
+   GIVEN("texture bound by glBindTextureUnit") {
+      table.glBindTextureUnit(2,5);
+
+      WHEN("binding the same texture again") {
+         table.glBindTextureUnit(2,5);
+         THEN("the call is dropped") {
+            REQUIRE(numCalls("glBindTextureUnit")==1);
+         }
+      }
+      WHEN("the texture is deleted and the unit is unbound") {
+         GLuint id=5;
+         table.glDeleteTextures(1,&id);
+         table.glBindTextureUnit(2,0);
+         THEN("the unbinding is issued, other targets of the unit may be bound") {
+            REQUIRE(numCalls("glBindTextureUnit")==2);
+         }
+      }
+   }
+
+   GIVEN("enabled capability and used program") {
+      table.glEnable(GL_DEPTH_TEST);
+      table.glUseProgram(7);
+
+      WHEN("setting the same state again") {
+         table.glEnable(GL_DEPTH_TEST);
+         table.glUseProgram(7);
+         THEN("the calls are dropped") {
+            REQUIRE(numCalls("glEnable")==1);
+            REQUIRE(numCalls("glUseProgram")==1);
+         }
+      }
+      WHEN("querying the state") {
+         GLint program=0;
+         table.glGetIntegerv(GL_CURRENT_PROGRAM,&program);
+         THEN("it is answered without OpenGL") {
+            REQUIRE(table.glIsEnabled(GL_DEPTH_TEST)==GL_TRUE);
+            REQUIRE(program==7);
+            REQUIRE(numCalls("glIsEnabled")==0);
+            REQUIRE(numCalls("glGetIntegerv")==0);
+         }
+      }
+      WHEN("disabling the capability") {
+         table.glDisable(GL_DEPTH_TEST);
+         table.glDisable(GL_DEPTH_TEST);
+         THEN("only the first call is issued") {
+            REQUIRE(numCalls("glDisable")==1);
+            REQUIRE(table.glIsEnabled(GL_DEPTH_TEST)==GL_FALSE);
+         }
+      }
+   }
+}
+
+
+SCENARIO("Table of createStateCachingTable can be invalidated") {
+
+   auto loader=createRecordingLoader();
+   auto table=createStateCachingTable(loader);
+   calls.clear();
+
+   GIVEN("a bound buffer") {
+      table->glBindBuffer(GL_ARRAY_BUFFER,1);
+      table->glBindBuffer(GL_ARRAY_BUFFER,1);
+      REQUIRE(numCalls("glBindBuffer")==1);
+
+      WHEN("the cache is invalidated by the free function") {
+         REQUIRE(invalidateStateCache(table));
+         table->glBindBuffer(GL_ARRAY_BUFFER,1);
+         THEN("the same buffer is bound again") {
+            REQUIRE(numCalls("glBindBuffer")==2);
+         }
+      }
+   }
+
+   GIVEN("table without state cache") {
+      THEN("it is not invalidated") {
+         REQUIRE(!invalidateStateCache(createTable(loader)));
+      }
+   }
+}
@@ -0,0 +1,233 @@
+#include<chrono>
+#include<memory>
+#include<string>
+#include<thread>
+#include<geGL/geGL.h>
+#include<geGL/NullLoader.h>
+#include<geGL/TextureStreamer.h>
+
+#define CATCH_CONFIG_MAIN
+#include"catch.hpp"
+
+using namespace ge::gl;
+using namespace std;
+
+
+
+static bool decode(const string&path,TextureStreamer::Image&image)
+{
+   if(path=="broken.png")
+      return false;
+   image.width=64;
+   image.height=64;
+   for(GLsizei size=64; size>0; size/=2)
+      image.levels.emplace_back(size_t(size*size*4),uint8_t(size));
+   return true;
+}
+
+
+static size_t imageSize()
+{
+   TextureStreamer::Image image;
+   decode("",image);
+   size_t size=0;
+   for(auto&l:image.levels)
+      size+=l.size();
+   return size;
+}
+
+
+static void stream(TextureStreamer&streamer,const string&path,float screenSize,GLint level)
+{
+   for(int i=0; i<1000; i++) {
+      streamer.request(path,screenSize);
+      streamer.update();
+      if(streamer.getResidentLevel(path)==level||streamer.getState(path)==TextureStreamer::FAILED)
+         return;
+      this_thread::sleep_for(chrono::milliseconds(1));
+   }
+}
+
+
+
+SCENARIO( "Textures are streamed progressively", "[TextureStreamer]" )
+{
+   auto loader=make_shared<NullLoader>();
+   ge::gl::init(loader);
+   TextureStreamer streamer(decode);
+
+   GIVEN( "requested texture" ) {
+
+      stream(streamer,"a.png",64.f,0);
+
+      THEN( "all levels are resident" ) {
+         REQUIRE( streamer.getState("a.png")==TextureStreamer::RESIDENT );
+         REQUIRE( streamer.getResidentLevel("a.png")==0 );
+         REQUIRE( streamer.getTexture("a.png")!=nullptr );
+         REQUIRE( streamer.getTexture("a.png")->getWidth(0)==64 );
+         REQUIRE( streamer.getMemoryUsage()==imageSize() );
+      }
+   }
+
+   GIVEN( "small upload budget" ) {
+
+      streamer.setUploadBudget(64);
+      GLint level=-1;
+      for(int i=0; i<1000&&level==-1; i++) {
+         streamer.request("a.png",64.f);
+         streamer.update();
+         level=streamer.getResidentLevel("a.png");
+         this_thread::sleep_for(chrono::milliseconds(1));
+      }
+
+      THEN( "texture is refined from the coarsest level" ) {
+         REQUIRE( level==5 );
+         streamer.request("a.png",64.f);
+         streamer.update();
+         REQUIRE( streamer.getResidentLevel("a.png")==4 );
+         stream(streamer,"a.png",64.f,0);
+         REQUIRE( streamer.getResidentLevel("a.png")==0 );
+      }
+   }
+
+   GIVEN( "texture that is small on screen" ) {
+
+      stream(streamer,"a.png",16.f,2);
+      for(int i=0; i<3; i++) {
+         streamer.request("a.png",16.f);
+         streamer.update();
+      }
+
+      THEN( "finer levels are not uploaded" ) {
+         REQUIRE( streamer.getResidentLevel("a.png")==2 );
+      }
+   }
+
+   GIVEN( "image that cannot be decoded" ) {
+
+      stream(streamer,"broken.png",64.f,0);
+
+      THEN( "texture fails" ) {
+         REQUIRE( streamer.getState("broken.png")==TextureStreamer::FAILED );
+         REQUIRE( streamer.getTexture("broken.png")==nullptr );
+         REQUIRE( streamer.getResidentLevel("broken.png")==-1 );
+      }
+   }
+}
+
+
+// odd-width RGB8 image, its rows are not multiples of 4 bytes
+static bool decodeRGB(const string&,TextureStreamer::Image&image)
+{
+   image.internalFormat=GL_RGB8;
+   image.format=GL_RGB;
+   image.width=5;
+   image.height=3;
+   for(GLsizei w=5,h=3; w>0; w/=2,h=h>1?h/2:1)
+      image.levels.emplace_back(size_t(w*h*3),uint8_t(w));
+   return true;
+}
+
+static GLint unpackAlignment=4;
+static vector<GLint> uploadAlignments;
+static size_t uploadedBytes=0;
+
+static void fakePixelStorei(GLenum pname,GLint param)
+{
+   if(pname==GL_UNPACK_ALIGNMENT)
+      unpackAlignment=param;
+}
+
+static void fakeTextureSubImage2D(GLuint,GLint,GLint,GLint,GLsizei width,GLsizei height,GLenum,GLenum,const void*)
+{
+   // bytes read by OpenGL from the pixel buffer for the current alignment
+   size_t rowSize=size_t(width)*3;
+   size_t pitch=(rowSize+unpackAlignment-1)/unpackAlignment*unpackAlignment;
+   uploadAlignments.push_back(unpackAlignment);
+   uploadedBytes+=pitch*size_t(height-1)+rowSize;
+}
+
+
+SCENARIO( "Rows that are not aligned to 4 bytes are streamed", "[TextureStreamer]" )
+{
+   auto loader=make_shared<NullLoader>();
+   loader->setFunction("glPixelStorei",fakePixelStorei);
+   loader->setFunction("glTextureSubImage2D",fakeTextureSubImage2D);
+   ge::gl::init(loader);
+   unpackAlignment=4;
+   uploadAlignments.clear();
+   uploadedBytes=0;
+   TextureStreamer streamer(decodeRGB);
+
+   stream(streamer,"rgb.png",64.f,0);
+
+   THEN( "levels are uploaded tightly packed and unpack alignment is restored" ) {
+      REQUIRE( streamer.getResidentLevel("rgb.png")==0 );
+      REQUIRE( !uploadAlignments.empty() );
+      for(auto a:uploadAlignments)
+         REQUIRE( a==1 );
+      REQUIRE( uploadedBytes==size_t(5*3*3+2*1*3+1*1*3) );
+      REQUIRE( unpackAlignment==4 );
+   }
+}
+
+
+SCENARIO( "Rows larger than the pixel buffer ring are streamed", "[TextureStreamer]" )
+{
+   auto loader=make_shared<NullLoader>();
+   ge::gl::init(loader);
+   TextureStreamer streamer(decode,2,64); // rows of the two finest levels do not fit
+
+   stream(streamer,"a.png",64.f,0);
+
+   THEN( "all levels are resident" ) {
+      REQUIRE( streamer.getState("a.png")==TextureStreamer::RESIDENT );
+      REQUIRE( streamer.getResidentLevel("a.png")==0 );
+      REQUIRE( streamer.getMemoryUsage()==imageSize() );
+   }
+}
+
+
+SCENARIO( "Textures are evicted in LRU order", "[TextureStreamer]" )
+{
+   auto loader=make_shared<NullLoader>();
+   ge::gl::init(loader);
+   TextureStreamer streamer(decode);
+   streamer.setMemoryBudget(imageSize()*2);
+
+   stream(streamer,"a.png",64.f,0);
+   stream(streamer,"b.png",64.f,0);
+   REQUIRE( streamer.getMemoryUsage()==imageSize()*2 );
+
+   WHEN( "texture does not fit into budget" ) {
+      streamer.request("a.png",64.f);
+      stream(streamer,"c.png",64.f,0);
+
+      THEN( "the least recently used texture is evicted" ) {
+         REQUIRE( streamer.getResidentLevel("c.png")==0 );
+         REQUIRE( streamer.getState("b.png")==TextureStreamer::UNKNOWN );
+         REQUIRE( streamer.getTexture("b.png")==nullptr );
+         REQUIRE( streamer.getTexture("a.png")!=nullptr );
+         REQUIRE( streamer.getMemoryUsage()==imageSize()*2 );
+      }
+   }
+
+   WHEN( "all textures are used in current frame" ) {
+      streamer.request("a.png",64.f);
+      streamer.request("b.png",64.f);
+      for(int i=0; i<50; i++) {
+         streamer.request("a.png",64.f);
+         streamer.request("b.png",64.f);
+         streamer.request("c.png",64.f);
+         streamer.update();
+         this_thread::sleep_for(chrono::milliseconds(1));
+      }
+
+      THEN( "nothing is evicted and new texture waits" ) {
+         REQUIRE( streamer.getState("c.png")==TextureStreamer::DECODED );
+         REQUIRE( streamer.getTexture("a.png")!=nullptr );
+         REQUIRE( streamer.getTexture("b.png")!=nullptr );
+         REQUIRE( streamer.getMemoryUsage()==imageSize()*2 );
+      }
+   }
+}
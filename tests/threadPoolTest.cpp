@@ -0,0 +1,72 @@
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+#include <geCore/ThreadPool.h>
+
+#define CATCH_CONFIG_MAIN
+#include"catch.hpp"
+
+using namespace ge::core;
+using namespace std;
+
+
+
+SCENARIO("ThreadPool parallelFor") {
+
+   GIVEN("ThreadPool with four threads") {
+      ThreadPool pool(4);
+      REQUIRE(pool.numThreads()==4);
+
+      WHEN("running 1000 tasks") {
+         vector<atomic<unsigned>> counters(1000);
+         for(auto &c : counters)
+            c=0;
+         pool.parallelFor(1000,[&counters](unsigned i) { counters[i]++; });
+         THEN("each task is executed exactly once") {
+            bool allOnce=true;
+            for(auto &c : counters)
+               allOnce=allOnce && c==1;
+            REQUIRE(allOnce);
+         }
+      }
+
+      WHEN("running parallelFor repeatedly") {
+         atomic<unsigned> sum(0);
+         for(unsigned j=0; j<100; j++)
+            pool.parallelFor(j,[&sum](unsigned i) { sum+=i+1; });
+         THEN("all the tasks of all the calls are executed") {
+            unsigned expected=0;
+            for(unsigned j=0; j<100; j++)
+               expected+=j*(j+1)/2;
+            REQUIRE(sum==expected);
+         }
+      }
+
+      WHEN("a task throws") {
+         atomic<unsigned> count(0);
+         auto task=[&count](unsigned i) {
+            if(i==10)
+               throw runtime_error("task failed");
+            count++;
+         };
+         THEN("parallelFor rethrows the exception and the pool is still usable") {
+            REQUIRE_THROWS_AS(pool.parallelFor(1000,task),const runtime_error&);
+            REQUIRE(count<1000);
+            count=0;
+            pool.parallelFor(1000,[&count](unsigned) { count++; });
+            REQUIRE(count==1000);
+         }
+      }
+   }
+
+   GIVEN("ThreadPool with single thread") {
+      ThreadPool pool(1);
+      WHEN("running tasks") {
+         vector<unsigned> order;
+         pool.parallelFor(5,[&order](unsigned i) { order.push_back(i); });
+         THEN("they are executed by calling thread in order") {
+            REQUIRE(order==vector<unsigned>({0,1,2,3,4}));
+         }
+      }
+   }
+}
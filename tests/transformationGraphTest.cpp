@@ -0,0 +1,220 @@
+#include<cstring>
+#include<memory>
+#include<vector>
+#include<geCore/ThreadPool.h>
+#include<geGL/geGL.h>
+#include<geGL/NullLoader.h>
+#include<geRG/RenderingContext.h>
+#include<geRG/Transformation.h>
+
+#define CATCH_CONFIG_MAIN
+#include"catch.hpp"
+
+using namespace ge::rg;
+using namespace std;
+
+
+
+static void uploadTranslation(Transformation &t,float x,float y,float z)
+{
+   float m[16];
+   memset(m,0,sizeof(m));
+   m[0]=m[5]=m[10]=m[15]=1.f;
+   m[12]=x; m[13]=y; m[14]=z;
+   t.uploadMatrix(m);
+}
+
+
+static shared_ptr<Transformation> createTransformation(float x,float y,float z)
+{
+   auto t=make_shared<Transformation>();
+   uploadTranslation(*t,x,y,z);
+   t->getOrCreateMatrixList();
+   return t;
+}
+
+
+static vector<float> matrixContent(unsigned numMatrices)
+{
+   RenderingContext::current()->unmapBuffers();
+   vector<float> data(numMatrices*16);
+   RenderingContext::current()->matrixStorage()->buffer()->getData(data.data(),data.size()*sizeof(float));
+   return data;
+}
+
+
+static void buildSubtree(const shared_ptr<Transformation> &t,unsigned depth,unsigned &counter)
+{
+   uploadTranslation(*t,float(counter),float(depth),float(counter%7));
+   t->getOrCreateMatrixList();
+   counter++;
+   if(depth==0)
+      return;
+   for(unsigned i=0,n=1+counter%3; i<n; i++) {
+      auto child=make_shared<Transformation>();
+      t->addChild(child);
+      buildSubtree(child,depth-1,counter);
+   }
+}
+
+
+/** Evaluates the graph incrementally, then forces full evaluation
+ *  and returns true if both produced the same matrices.
+ */
+static bool incrementalEqualsFull(RenderingContext *rc,unsigned numMatrices)
+{
+   rc->evaluateTransformationGraph();
+   auto incremental=matrixContent(numMatrices);
+   rc->invalidateTransformationGraph();
+   rc->evaluateTransformationGraph();
+   auto full=matrixContent(numMatrices);
+   return incremental==full;
+}
+
+
+
+SCENARIO( "Incremental evaluation of transformation graph", "[Transformation]" )
+{
+   auto loader=make_shared<ge::gl::NullLoader>();
+   ge::gl::init(loader);
+   RenderingContext::setCurrent(make_shared<RenderingContext>());
+   auto rc=RenderingContext::current();
+   rc->setIncrementalTransformationGraphEvaluation(true);
+
+   {
+      // root -> a -> (b,c), root -> d
+      auto root=make_shared<Transformation>();
+      auto a=createTransformation(1.f,0.f,0.f);
+      auto b=createTransformation(0.f,2.f,0.f);
+      auto c=createTransformation(0.f,0.f,3.f);
+      auto d=createTransformation(4.f,0.f,0.f);
+      root->addChild(a);
+      root->addChild(d);
+      a->addChild(b);
+      a->addChild(c);
+      rc->addTransformationGraph(root);
+      rc->evaluateTransformationGraph();
+      const unsigned numMatrices=rc->bufferPosition();
+      REQUIRE( numMatrices==1+4 );
+
+      GIVEN( "graph without changes" ) {
+         THEN( "incremental evaluation keeps the matrices of full evaluation" ) {
+            REQUIRE( incrementalEqualsFull(rc.get(),numMatrices) );
+         }
+      }
+
+      GIVEN( "changed inner Transformation" ) {
+         uploadTranslation(*a,5.f,6.f,7.f);
+         THEN( "incremental evaluation gives the same matrices as full evaluation" ) {
+            REQUIRE( incrementalEqualsFull(rc.get(),numMatrices) );
+         }
+      }
+
+      GIVEN( "changed leaf Transformations in different subtrees" ) {
+         uploadTranslation(*c,-1.f,0.f,0.f);
+         uploadTranslation(*d,0.f,-1.f,0.f);
+         THEN( "incremental evaluation gives the same matrices as full evaluation" ) {
+            REQUIRE( incrementalEqualsFull(rc.get(),numMatrices) );
+         }
+      }
+
+      GIVEN( "matrix modified through getMatrixPtr() and marked dirty" ) {
+         b->getMatrixPtr()[12]=8.f;
+         b->setDirty();
+         THEN( "incremental evaluation gives the same matrices as full evaluation" ) {
+            REQUIRE( incrementalEqualsFull(rc.get(),numMatrices) );
+         }
+      }
+
+      GIVEN( "child added by addChild()" ) {
+         auto e=createTransformation(0.f,9.f,0.f);
+         rc->evaluateTransformationGraph();
+         b->addChild(e);
+         uploadTranslation(*a,2.f,0.f,0.f);
+         THEN( "the graph is evaluated with the new child" ) {
+            rc->evaluateTransformationGraph();
+            REQUIRE( rc->bufferPosition()==numMatrices+1 );
+            REQUIRE( incrementalEqualsFull(rc.get(),numMatrices+1) );
+         }
+      }
+
+      GIVEN( "child removed by removeChild()" ) {
+         a->removeChild(b);
+         uploadTranslation(*c,0.f,0.f,-3.f);
+         THEN( "the graph is evaluated without the removed child" ) {
+            rc->evaluateTransformationGraph();
+            REQUIRE( rc->bufferPosition()==numMatrices-1 );
+            REQUIRE( incrementalEqualsFull(rc.get(),numMatrices-1) );
+         }
+      }
+
+      rc->removeTransformationGraph(root);
+   }
+
+   RenderingContext::setCurrent(nullptr);
+}
+
+
+SCENARIO( "Parallel evaluation of transformation graph", "[Transformation]" )
+{
+   auto loader=make_shared<ge::gl::NullLoader>();
+   ge::gl::init(loader);
+   RenderingContext::setCurrent(make_shared<RenderingContext>());
+   auto rc=RenderingContext::current();
+
+   {
+      vector<shared_ptr<Transformation>> roots(3);
+      unsigned numNodes=0;
+      for(auto& r : roots) {
+         r=make_shared<Transformation>();
+         buildSubtree(r,4,numNodes);
+         rc->addTransformationGraph(r);
+      }
+
+      GIVEN( "graph evaluated serially" ) {
+         rc->evaluateTransformationGraph();
+         const unsigned numMatrices=rc->bufferPosition();
+         REQUIRE( numMatrices==1+numNodes );
+         auto serial=matrixContent(numMatrices);
+         vector<unsigned> startIndices;
+         for(auto& r : roots)
+            startIndices.push_back(r->matrixList()->startIndex());
+
+         WHEN( "it is evaluated by ThreadPool" ) {
+
+            rc->setThreadPool(make_shared<ge::core::ThreadPool>(4));
+            rc->evaluateTransformationGraph();
+            rc->setThreadPool(nullptr);
+
+            THEN( "matrices and their placement equal to the serial evaluation" ) {
+               REQUIRE( rc->bufferPosition()==numMatrices );
+               REQUIRE( matrixContent(numMatrices)==serial );
+               for(unsigned i=0; i<roots.size(); i++)
+                  REQUIRE( roots[i]->matrixList()->startIndex()==startIndices[i] );
+            }
+         }
+
+         WHEN( "MatrixList is shared by Transformations of different subtrees" ) {
+
+            auto ml=roots[0]->matrixList();
+            roots[2]->childList().begin()->get()->setMatrixList(ml);
+            rc->evaluateTransformationGraph();
+            const unsigned numSharedMatrices=rc->bufferPosition();
+            auto sharedSerial=matrixContent(numSharedMatrices);
+            rc->setThreadPool(make_shared<ge::core::ThreadPool>(4));
+            rc->evaluateTransformationGraph();
+            rc->setThreadPool(nullptr);
+
+            THEN( "the result equals to the serial evaluation" ) {
+               REQUIRE( rc->bufferPosition()==numSharedMatrices );
+               REQUIRE( matrixContent(numSharedMatrices)==sharedSerial );
+            }
+         }
+      }
+
+      for(auto& r : roots)
+         rc->removeTransformationGraph(r);
+   }
+
+   RenderingContext::setCurrent(nullptr);
+}
@@ -0,0 +1,113 @@
+#include<cstdint>
+#include<memory>
+#include<vector>
+#include<geGL/geGL.h>
+#include<geGL/NullLoader.h>
+#include<geGL/LoaderTableDecorator.h>
+#include<geGL/ProfilingTableDecorator.h>
+#include<geGL/UploadBatcher.h>
+
+#define CATCH_CONFIG_MAIN
+#include"catch.hpp"
+
+using namespace ge::gl;
+using namespace std;
+
+
+
+using Table=ProfilingTableDecorator<LoaderTableDecorator<FunctionTable>>;
+
+
+static vector<uint8_t> content(Buffer&buffer,GLsizeiptr size)
+{
+   vector<uint8_t> data(size_t(size),0);
+   buffer.getData(data.data(),size);
+   return data;
+}
+
+
+
+SCENARIO( "Upload batcher merges small writes", "[UploadBatcher]" )
+{
+   auto loader=make_shared<NullLoader>();
+   auto profiled=make_shared<Table>(loader);
+   profiled->construct();
+   FunctionTablePointer table=profiled;
+   auto &profiler=profiled->profiler;
+   size_t copy=profiler.findFunction("glCopyNamedBufferSubData");
+   size_t subData=profiler.findFunction("glNamedBufferSubData");
+
+   Buffer a(table,1024);
+   Buffer b(table,1024);
+   UploadBatcher batcher(table,4096);
+
+   GIVEN( "many adjacent writes" ) {
+
+      for(uint8_t i=0; i<64; i++) {
+         uint8_t data[4]={i,i,i,i};
+         batcher.setData(a,data,4,GLintptr(i)*4);
+      }
+      REQUIRE( batcher.getNofPendingWrites()==64 );
+      REQUIRE( batcher.getPendingSize()==256 );
+      batcher.flush();
+
+      THEN( "they are uploaded by one copy" ) {
+         REQUIRE( batcher.getNofPendingWrites()==0 );
+         REQUIRE( batcher.getNofWrites()==64 );
+         REQUIRE( batcher.getNofCopies()==1 );
+         REQUIRE( profiler.getStatistics(copy).calls==1 );
+         REQUIRE( profiler.getStatistics(subData).calls==0 );
+         auto data=content(a,256);
+         REQUIRE( data[0]==0 );
+         REQUIRE( data[7]==1 );
+         REQUIRE( data[255]==63 );
+      }
+   }
+
+   GIVEN( "overlapping writes" ) {
+
+      vector<uint8_t> first(16,1);
+      vector<uint8_t> second(8,2);
+      batcher.setData(a,first.data(),16,0);
+      batcher.setData(a,second.data(),8,4);
+      batcher.setData(a,first.data(),2,10);
+      batcher.flush();
+
+      THEN( "later writes win" ) {
+         REQUIRE( batcher.getNofCopies()==1 );
+         auto data=content(a,16);
+         REQUIRE( data==vector<uint8_t>({1,1,1,1,2,2,2,2,2,2,1,1,1,1,1,1}) );
+      }
+   }
+
+   GIVEN( "writes into two buffers and disjoint ranges" ) {
+
+      vector<uint8_t> data(8,3);
+      batcher.setData(b,data.data(),8,0);
+      batcher.setData(a,data.data(),8,0);
+      batcher.setData(a,data.data(),8,100);
+      batcher.flush();
+
+      THEN( "each range is uploaded by its own copy" ) {
+         REQUIRE( batcher.getNofCopies()==3 );
+         REQUIRE( content(b,8)==data );
+         REQUIRE( content(a,8)==data );
+      }
+   }
+
+   GIVEN( "writes larger than staging buffer" ) {
+
+      Buffer c(table,8192);
+      vector<uint8_t> data(8192,4);
+      batcher.setData(c,data.data(),8192,0);
+      batcher.setData(a,data.data(),16,0);
+      batcher.flush();
+
+      THEN( "the range is uploaded directly" ) {
+         REQUIRE( batcher.getNofFallbacks()==1 );
+         REQUIRE( batcher.getNofCopies()==1 );
+         REQUIRE( profiler.getStatistics(subData).calls>=1 );
+         REQUIRE( content(c,8192)==data );
+      }
+   }
+}